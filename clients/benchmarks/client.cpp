@@ -1,5 +1,5 @@
 /* **************************************************************************
- * Copyright (C) 2016-2024 Advanced Micro Devices, Inc. All rights reserved.
+ * Copyright (C) 2016-2025 Advanced Micro Devices, Inc. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions
@@ -30,6 +30,10 @@
 
 #include "common/misc/program_options.hpp"
 #include "common/misc/rocsolver_dispatcher.hpp"
+#include "common/misc/rocsolver_perf_model.hpp"
+#include "streams.hpp"
+#include "suite.hpp"
+#include "tuner.hpp"
 
 using namespace roc;
 
@@ -80,25 +84,45 @@ static void print_version_info()
     std::fflush(stdout);
 }
 
-int main(int argc, char* argv[])
-try
+// JSON fields describing the library versions and the device used by a benchmark suite
+static std::string suite_header(rocblas_int device_id)
 {
-    Arguments argus;
-
-    // disable unit_check in client benchmark, it is only
-    // used in gtest unit test
-    argus.unit_check = 0;
-
-    // enable timing check,otherwise no performance data collected
-    argus.timing = 1;
+    return fmt::format("  \"rocsolver_version\": \"{}\",\n  \"rocblas_version\": \"{}\",\n"
+                       "  \"device\": \"{}\"",
+                       rocsolver_version(), rocblas_version(), tuner_device_arch(device_id));
+}
 
+struct bench_options
+{
+    Arguments argus;
     std::string function;
     char precision = 's';
     rocblas_int device_id = 0;
+    std::string tune_file;
+    std::string tune_sizes;
+    std::string tune_blksizes;
+    std::string suite_file;
+    std::string suite_output;
+    std::string replay_file;
+    std::string workflow;
+};
+
+// take arguments and set default values
+static void add_bench_options(options_description& desc, bench_options& opt)
+{
+    Arguments& argus = opt.argus;
+    std::string& function = opt.function;
+    char& precision = opt.precision;
+    rocblas_int& device_id = opt.device_id;
+    std::string& tune_file = opt.tune_file;
+    std::string& tune_sizes = opt.tune_sizes;
+    std::string& tune_blksizes = opt.tune_blksizes;
+    std::string& suite_file = opt.suite_file;
+    std::string& suite_output = opt.suite_output;
+    std::string& replay_file = opt.replay_file;
+    std::string& workflow = opt.workflow;
 
-    // take arguments and set default values
     // clang-format off
-    options_description desc("rocsolver client command line options");
     desc.add_options()("help,h", "Produces this help message.")
 
         // test options
@@ -108,11 +132,28 @@ try
             "                           Only applicable to batch routines.\n"
             "                           ")
 
+        ("breakdown",
+         value<rocblas_int>(&argus.breakdown)->default_value(0),
+            "Break down the GPU time? 0 = No, 1 = Yes.\n"
+            "                           This reports, besides the average hot call, the time of the first call, the time\n"
+            "                           of a call after flushing the L2 cache, the time until a call returns control to\n"
+            "                           the host, and the time of synchronizing an empty stream.\n"
+            "                           ")
+
         ("device",
          value<rocblas_int>(&device_id)->default_value(0),
             "Set the default device to be used for subsequent program runs.\n"
             "                           ")
 
+        ("device_init",
+         value<rocblas_int>(&argus.device_init)->default_value(0),
+            "Generate the input matrices on the device? 0 = No, 1 = Yes.\n"
+            "                           The host copies of the data are not allocated, which makes large sizes and\n"
+            "                           batches start quickly and allows them to exceed the host memory. CPU timing\n"
+            "                           and --verify are not available. Only applicable to getrf, potrf, geqrf, sytrd,\n"
+            "                           syevd and stedc (and their unblocked, batched and strided_batched versions).\n"
+            "                           ")
+
         ("function,f",
          value<std::string>(&function)->default_value("potf2"),
             "The LAPACK function to test.\n"
@@ -132,6 +173,14 @@ try
             "                           the function, in bytes.\n"
             "                           ")
 
+        ("memory",
+         value<rocblas_int>(&argus.memory)->default_value(0),
+            "Report the device memory used by the call? 0 = No, 1 = Yes.\n"
+            "                           This reports the peak workspace requested by the rocSOLVER function and the\n"
+            "                           total device memory footprint of the test (arrays, workspace and handle), in\n"
+            "                           bytes, measured after the first call.\n"
+            "                           ")
+
         ("perf",
          value<rocblas_int>(&argus.perf)->default_value(0),
             "Ignore CPU timing results? 0 = No, 1 = Yes.\n"
@@ -142,6 +191,8 @@ try
          value<char>(&precision)->default_value('s'),
             "Precision to be used in the tests.\n"
             "                           Options are: s, d, c, z.\n"
+            "                           (h and b, for half and bfloat16 storage, are also available for some\n"
+            "                           strided batched factorizations.)\n"
             "                           ")
 
         ("profile",
@@ -157,18 +208,84 @@ try
             "                           Used in conjunction with --profile to include kernels in the profile log.\n"
             "                           ")
 
+        ("roofline",
+         value<rocblas_int>(&argus.roofline)->default_value(0),
+            "Report the efficiency of the function? 0 = No, 1 = Yes.\n"
+            "                           This reports the GFLOP/s and GB/s achieved by the average hot call, and the\n"
+            "                           percentage of the nominal peaks of the device that they represent. Only\n"
+            "                           applicable to the functions with a performance model.\n"
+            "                           ")
+
         ("singular",
          value<rocblas_int>(&argus.singular)->default_value(0),
             "Test with degenerate matrices? 0 = No, 1 = Yes\n"
             "                           This will produce matrices that are singular, non positive-definite, etc.\n"
             "                           ")
 
+        ("streams",
+         value<rocblas_int>(&argus.streams)->default_value(1),
+            "Number of streams on which to run the test at once.\n"
+            "                           If greater than 1, the test is run from as many host threads, each with its own\n"
+            "                           stream and handle, and the aggregate throughput of the hot calls is reported.\n"
+            "                           ")
+
+        ("suite",
+         value<std::string>(&suite_file)->default_value(""),
+            "Run all the configurations of the given sweep file in the same process.\n"
+            "                           Each configuration is run --iters times and the median, 95th percentile and\n"
+            "                           minimum GPU times of a single call are written to --suite_output, together with\n"
+            "                           the GFLOP/s and bandwidth achieved by the functions with a known nominal cost.\n"
+            "                           ")
+
+        ("suite_output",
+         value<std::string>(&suite_output)->default_value("rocsolver_suite.json"),
+            "Output file of --suite and --replay. The results are written in CSV format if the name\n"
+            "                           ends in .csv, and in JSON format otherwise.\n"
+            "                           ")
+
+        ("replay",
+         value<std::string>(&replay_file)->default_value(""),
+            "Replay the calls of the given bench log (as written to ROCSOLVER_LOG_BENCH_PATH).\n"
+            "                           Identical calls are run once, --iters times, and the results are written to\n"
+            "                           --suite_output with the number of calls of each configuration. A table of the\n"
+            "                           configurations sorted by their share of the time of the workload is printed.\n"
+            "                           ")
+
+        ("tune",
+         value<std::string>(&tune_file)->default_value(""),
+            "Tune the block sizes of the tested function and write the results to the given file.\n"
+            "                           For every size in --tune_sizes, the function is timed with every block size\n"
+            "                           in --tune_blksizes. The resulting file can be used with ROCSOLVER_TUNING_PATH,\n"
+            "                           or copied to the persistent cache as $ROCSOLVER_CACHE_PATH/<arch>/tuning.\n"
+            "                           Tunable functions are getrf, getrf_npvt, getri and trtri (and their batched\n"
+            "                           and strided_batched versions).\n"
+            "                           ")
+
+        ("tune_blksizes",
+         value<std::string>(&tune_blksizes)->default_value(""),
+            "Comma-separated list of block sizes to try when tuning.\n"
+            "                           If not provided, a default list for the tested function is used.\n"
+            "                           ")
+
+        ("tune_sizes",
+         value<std::string>(&tune_sizes)->default_value("16,32,64,128,256,512,1024,2048"),
+            "Comma-separated, increasing list of matrix sizes used when tuning.\n"
+            "                           ")
+
         ("verify,v",
          value<rocblas_int>(&argus.norm_check)->default_value(0),
             "Validate GPU results with CPU? 0 = No, 1 = Yes.\n"
             "                           This will additionally print the relative error of the computations.\n"
             "                           ")
 
+        ("workflow",
+         value<std::string>(&workflow)->default_value(""),
+            "Benchmark a sequence of calls instead of a single function.\n"
+            "                           refactlu = csrrf_analysis once, followed by csrrf_refactlu and csrrf_solve\n"
+            "                           for every value update (--iters updates). The times of the three phases are\n"
+            "                           reported separately. The matrices are read from --sparse_dir.\n"
+            "                           ")
+
         // size options
         ("k",
          value<rocblas_int>(),
@@ -177,6 +294,24 @@ try
             "                           For example, the number of Householder reflections in a transformation.\n"
             "                           ")
 
+        ("kd",
+         value<rocblas_int>(),
+            "Matrix size parameter.\n"
+            "                           Number of super- or sub-diagonals of a symmetric/Hermitian band matrix.\n"
+            "                           ")
+
+        ("kl",
+         value<rocblas_int>(),
+            "Matrix size parameter.\n"
+            "                           Number of sub-diagonals of a general band matrix.\n"
+            "                           ")
+
+        ("ku",
+         value<rocblas_int>(),
+            "Matrix size parameter.\n"
+            "                           Number of super-diagonals of a general band matrix.\n"
+            "                           ")
+
         ("m",
          value<rocblas_int>(),
             "Matrix/vector size parameter.\n"
@@ -228,6 +363,12 @@ try
             "                           Leading dimension of matrices A.\n"
             "                           ")
 
+        ("ldab",
+         value<rocblas_int>(),
+            "Matrix size parameter.\n"
+            "                           Leading dimension of band matrices AB.\n"
+            "                           ")
+
         ("ldb",
          value<rocblas_int>(),
             "Matrix size parameter.\n"
@@ -240,6 +381,24 @@ try
             "                           Leading dimension of matrices C.\n"
             "                           ")
 
+        ("ldh",
+         value<rocblas_int>(),
+            "Matrix size parameter.\n"
+            "                           Leading dimension of matrices H.\n"
+            "                           ")
+
+        ("ldq",
+         value<rocblas_int>(),
+            "Matrix size parameter.\n"
+            "                           Leading dimension of matrices Q.\n"
+            "                           ")
+
+        ("ldr",
+         value<rocblas_int>(),
+            "Matrix size parameter.\n"
+            "                           Leading dimension of matrices R.\n"
+            "                           ")
+
         ("ldt",
          value<rocblas_int>(),
             "Matrix size parameter.\n"
@@ -314,6 +473,24 @@ try
             "                           ")
 
 
+        ("strideH",
+         value<rocblas_stride>(),
+            "Matrix/vector stride parameter.\n"
+            "                           Stride for matrices H.\n"
+            "                           ")
+
+        ("strideJ",
+         value<rocblas_stride>(),
+            "Matrix/vector stride parameter.\n"
+            "                           Stride for vectors jpvt.\n"
+            "                           ")
+
+        ("strideL",
+         value<rocblas_stride>(),
+            "Matrix/vector stride parameter.\n"
+            "                           Stride for the values of sparse matrices L.\n"
+            "                           ")
+
         ("strideQ",
          value<rocblas_stride>(),
             "Matrix/vector stride parameter.\n"
@@ -326,12 +503,24 @@ try
             "                           Stride for vectors tau, taup, and ipiv.\n"
             "                           ")
 
+        ("strideR",
+         value<rocblas_stride>(),
+            "Matrix/vector stride parameter.\n"
+            "                           Stride for matrices R.\n"
+            "                           ")
+
         ("strideS",
          value<rocblas_stride>(),
             "Matrix/vector stride parameter.\n"
             "                           Stride for matrices/vectors S.\n"
             "                           ")
 
+        ("strideT",
+         value<rocblas_stride>(),
+            "Matrix/vector stride parameter.\n"
+            "                           Stride for the values of sparse matrices T.\n"
+            "                           ")
+
         ("strideU",
          value<rocblas_stride>(),
             "Matrix/vector stride parameter.\n"
@@ -404,6 +593,34 @@ try
             "                           1 = LU, 2 = Cholesky.\n"
             "                           ")
 
+        ("rfinfo_solve_mode",
+         value<char>(),
+            "Specifies how the triangular solves of csrrf_solve are computed.\n"
+            "                           S = rocSPARSE, L = level-scheduled rocSOLVER kernel.\n"
+            "                           ")
+
+        ("rfinfo_refact_mode",
+         value<char>(),
+            "Specifies how csrrf_refactlu and csrrf_refactchol are computed.\n"
+            "                           S = rocSPARSE, N = supernodal rocSOLVER algorithm.\n"
+            "                           ")
+
+        ("rfinfo_precision_mode",
+         value<char>(),
+            "Specifies the precision of the factors of csrrf_refactlu and csrrf_solve.\n"
+            "                           F = full precision, M = single precision factors with\n"
+            "                           iterative refinement in double precision.\n"
+            "                           ")
+
+        ("sparse_dir",
+         value<std::string>(),
+            "Directory with the matrices A and T, and the permutations P and Q, of a refactorization.\n"
+            "                           A matrix X can be given as a binary CSR file X.csr (memory-mapped), as a Matrix\n"
+            "                           Market file X.mtx, or as the text files ptrX, indX and valX. P and Q are text\n"
+            "                           files. Only applicable to --workflow refactlu; if not provided, the test data\n"
+            "                           closest to --n and --nnzA is used.\n"
+            "                           ")
+
         // bdsqr options
         ("nc",
          value<rocblas_int>()->default_value(0),
@@ -444,6 +661,13 @@ try
             "                           Only applicable to laswp.\n"
             "                           ")
 
+        // geqrf_coldelete options
+        ("col",
+         value<rocblas_int>(),
+            "Index of the column to remove (1-based).\n"
+            "                           Only applicable to geqrf_coldelete.\n"
+            "                           ")
+
         // gesvd options
         ("left_svect",
          value<char>()->default_value('N'),
@@ -465,7 +689,7 @@ try
          ("nev",
          value<rocblas_int>(),
             "Number of eigenvectors to compute in a partial decomposition.\n"
-            "                           Only applicable to stein.\n"
+            "                           Only applicable to stein and to the subspace iteration (syevs and heevs).\n"
             "                           ")
 
         // trtri options
@@ -488,7 +712,8 @@ try
         ("nb",
          value<rocblas_int>(),
             "Number of rows and columns in each block.\n"
-            "                           Only applicable to block tridiagonal matrix APIs.\n"
+            "                           Only applicable to block tridiagonal matrix APIs, and\n"
+            "                           to geqrt and gemqrt (block size of the T factors).\n"
             "                           ")
 
         ("nblocks",
@@ -542,7 +767,8 @@ try
         ("max_sweeps",
          value<rocblas_int>()->default_value(100),
             "Maximum number of sweeps/iterations.\n"
-            "                           Used in iterative Jacobi functions.\n"
+            "                           Used in iterative Jacobi functions, in the eigenvector refinement\n"
+            "                           and in the subspace iteration (syevs and heevs).\n"
             "                           ")
 
         ("esort",
@@ -552,11 +778,44 @@ try
             "                           Used in iterative Jacobi functions.\n"
             "                           ")
 
+        // randomized singular value decomposition options
+        ("oversample",
+         value<rocblas_int>()->default_value(10),
+            "Number of extra random samples.\n"
+            "                           Used in randomized singular value decomposition functions.\n"
+            "                           ")
+
+        ("niter",
+         value<rocblas_int>()->default_value(2),
+            "Number of power iterations.\n"
+            "                           Used in randomized singular value decomposition functions.\n"
+            "                           ")
+
         // other options
         ("abstol",
          value<double>()->default_value(0),
             "Absolute tolerance at which convergence is accepted.\n"
             "                           Used in iterative Jacobi and partial eigenvalue decomposition functions.\n"
+            "                           Relative to the norm of the matrix in the subspace iteration (syevs and heevs).\n"
+            "                           ")
+
+        ("rcond",
+         value<double>()->default_value(-1),
+            "Reciprocal condition number threshold. A negative value selects the machine precision.\n"
+            "                           Used to determine the effective rank in rank-deficient least-squares solvers.\n"
+            "                           ")
+
+        ("alg_mode",
+         value<char>()->default_value('Q'),
+            "Q = QR iteration, D = divide and conquer, H = hybrid CPU+GPU QR iteration,\n"
+            "                           R = QR preconditioning, M = mixed precision, S = shifted,\n"
+            "                           T = tournament pivoting.\n"
+            "                           The algorithm used for the singular value decomposition of the bidiagonal form\n"
+            "                           (bdsqr with Q or H, and gesvd with Q, D or H), to precondition the Jacobi\n"
+            "                           method (gesvdj and gesvdj_notransv with Q, R or M), or by the Jacobi\n"
+            "                           eigensolver (syevj and heevj with Q or M), or to orthonormalize ill-conditioned\n"
+            "                           matrices (cholqr with Q or S), or to select the pivots of the LU factorization\n"
+            "                           (getrf with Q or T).\n"
             "                           ")
 
         ("direct",
@@ -574,8 +833,8 @@ try
 
         ("fast_alg",
          value<char>()->default_value('O'),
-            "O = out-of-place, I = in-place.\n"
-            "                           Enables out-of-place computations.\n"
+            "O = out-of-place, I = in-place, A = automatic.\n"
+            "                           Enables out-of-place computations (A: if the workspace fits).\n"
             "                           ")
 
         ("itype",
@@ -602,6 +861,12 @@ try
             "                           Indicates if a matrix should be transposed.\n"
             "                           ")
 
+        ("transr",
+         value<char>()->default_value('N'),
+            "N = normal, T = transpose, C = conjugate transpose.\n"
+            "                           Indicates the storage form of a matrix in rectangular full packed format.\n"
+            "                           ")
+
         ("uplo",
          value<char>()->default_value('U'),
             "U = upper, L = lower.\n"
@@ -609,6 +874,54 @@ try
             "                           ");
 
     // clang-format on
+}
+
+// catch invalid arguments
+static void validate_bench_arguments(const Arguments& argus)
+{
+    argus.validate_precision("precision");
+    argus.validate_operation("trans");
+    argus.validate_operation("transr");
+    argus.validate_side("side");
+    argus.validate_fill("uplo");
+    argus.validate_diag("diag");
+    argus.validate_direct("direct");
+    argus.validate_storev("storev");
+    argus.validate_svect("svect");
+    argus.validate_svect("left_svect");
+    argus.validate_svect("right_svect");
+    argus.validate_erange("srange");
+    argus.validate_workmode("fast_alg");
+    argus.validate_alg_mode("alg_mode");
+    argus.validate_evect("evect");
+    argus.validate_erange("erange");
+    argus.validate_eorder("eorder");
+    argus.validate_esort("esort");
+    argus.validate_itype("itype");
+    argus.validate_rfinfo_mode("rfinfo_mode");
+    argus.validate_rfinfo_solve_mode("rfinfo_solve_mode");
+    argus.validate_rfinfo_refact_mode("rfinfo_refact_mode");
+    argus.validate_rfinfo_precision_mode("rfinfo_precision_mode");
+}
+
+int main(int argc, char* argv[])
+try
+{
+    bench_options opt;
+    Arguments& argus = opt.argus;
+    const std::string& function = opt.function;
+    const char& precision = opt.precision;
+    const rocblas_int& device_id = opt.device_id;
+
+    // disable unit_check in client benchmark, it is only
+    // used in gtest unit test
+    argus.unit_check = 0;
+
+    // enable timing check,otherwise no performance data collected
+    argus.timing = 1;
+
+    options_description desc("rocsolver client command line options");
+    add_bench_options(desc, opt);
 
     variables_map vm;
     store(parse_command_line(argc, argv, desc), vm);
@@ -635,33 +948,147 @@ try
     }
     set_device(device_id);
 
-    // catch invalid arguments
-    argus.validate_precision("precision");
-    argus.validate_operation("trans");
-    argus.validate_side("side");
-    argus.validate_fill("uplo");
-    argus.validate_diag("diag");
-    argus.validate_direct("direct");
-    argus.validate_storev("storev");
-    argus.validate_svect("svect");
-    argus.validate_svect("left_svect");
-    argus.validate_svect("right_svect");
-    argus.validate_erange("srange");
-    argus.validate_workmode("fast_alg");
-    argus.validate_evect("evect");
-    argus.validate_erange("erange");
-    argus.validate_eorder("eorder");
-    argus.validate_esort("esort");
-    argus.validate_itype("itype");
-    argus.validate_rfinfo_mode("rfinfo_mode");
+    validate_bench_arguments(argus);
+
+    if(argus.device_init && argus.norm_check)
+        throw std::invalid_argument("--device_init cannot be used with --verify");
+    rocsolver_bench_device_init = argus.device_init;
+
+    // benchmark a workflow (a sequence of calls) instead of a single function
+    if(!opt.workflow.empty())
+    {
+        if(opt.workflow != "refactlu")
+            throw std::invalid_argument("Invalid value for --workflow");
+        opt.function = "csrrf_" + opt.workflow + "_workflow";
+    }
+
+    // tune the function block sizes (every run is executed in a new process)
+    if(!opt.tune_file.empty())
+    {
+        run_tuner({argv[0], function, precision, device_id, argus.batch_count, argus.iters,
+                   opt.tune_sizes, opt.tune_blksizes, opt.tune_file});
+        return 0;
+    }
+
+    // run all the configurations of a sweep file or a bench log (every run is executed in
+    // this process)
+    if(!opt.suite_file.empty() || !opt.replay_file.empty())
+    {
+        rocsolver_log_begin();
+        rocsolver_log_set_layer_mode(rocblas_layer_mode_none);
+
+        // every configuration is parsed with a fresh description bound to cfg, so that no
+        // option leaks from one configuration to the next
+        bench_options cfg;
+        auto parse = [&](const suite_config& config) -> Arguments& {
+            cfg = bench_options();
+            cfg.argus.unit_check = 0;
+            cfg.argus.timing = 1;
+            options_description cfg_desc("");
+            add_bench_options(cfg_desc, cfg);
+
+            std::vector<std::string> tokens = {argv[0], "--function", config.function,
+                                               "--precision", std::string(1, config.precision)};
+            for(const auto& arg : config.args)
+            {
+                tokens.push_back(suite_option(arg.first));
+                tokens.push_back(arg.second);
+            }
+            std::vector<char*> cargv;
+            for(auto& token : tokens)
+                cargv.push_back(&token[0]);
+
+            variables_map cfg_vm;
+            store(parse_command_line(int(cargv.size()), cargv.data(), cfg_desc), cfg_vm);
+            notify(cfg_vm);
+            cfg.argus.populate(cfg_vm);
+            validate_bench_arguments(cfg.argus);
+            return cfg.argus;
+        };
+
+        if(!opt.replay_file.empty())
+            run_replay({opt.replay_file, opt.suite_output, argus.iters}, suite_header(device_id),
+                       parse);
+        else
+            run_suite({opt.suite_file, opt.suite_output, argus.iters}, suite_header(device_id),
+                      parse);
+
+        rocsolver_log_end();
+        return 0;
+    }
 
     // prepare logging infrastructure and ignore environment variables
     rocsolver_log_begin();
     rocsolver_log_set_layer_mode(rocblas_layer_mode_none);
 
+    // run the test on several streams at once
+    if(argus.streams > 1)
+    {
+        run_streams({function, precision, device_id, argus.streams}, argus);
+        rocsolver_log_end();
+        return 0;
+    }
+
     // select and dispatch function test/benchmark
+    rocsolver_bench_breakdown.enabled = argus.breakdown;
+    if(argus.memory)
+        rocsolver_bench_memory.start();
     rocsolver_dispatcher::invoke(function, precision, argus);
 
+    // output the device memory used by the first call (if the function was timed)
+    if(argus.memory && rocsolver_bench_memory.recorded)
+    {
+        const rocsolver_bench_memory_data& mem = rocsolver_bench_memory;
+        if(!argus.perf)
+        {
+            rocsolver_bench_header("Device memory:");
+            rocsolver_bench_output("workspace_bytes", "footprint_bytes");
+        }
+        rocsolver_bench_output(mem.workspace_bytes, mem.footprint_bytes);
+        if(!argus.perf)
+            rocsolver_bench_endl();
+    }
+
+    // output the timing breakdown (if the function was timed)
+    if(argus.breakdown && rocsolver_bench_breakdown.hot_us > 0)
+    {
+        const rocsolver_bench_breakdown_data& b = rocsolver_bench_breakdown;
+        if(!argus.perf)
+        {
+            rocsolver_bench_header("Timing breakdown:");
+            rocsolver_bench_output("first_call_us", "hot_call_us", "cold_l2_us", "host_api_us",
+                                   "empty_sync_us");
+        }
+        rocsolver_bench_output(b.first_call_us, b.hot_us, b.cold_l2_us, b.host_us,
+                               b.empty_stream_us);
+        if(!argus.perf)
+            rocsolver_bench_endl();
+    }
+
+    // output the efficiency with respect to the nominal peaks of the device
+    double flops, bytes;
+    if(argus.roofline && rocsolver_bench_breakdown.hot_us > 0
+       && rocsolver_perf_model(function, precision, argus, flops, bytes))
+    {
+        rocsolver_device_peaks peaks = rocsolver_get_device_peaks(device_id);
+        bool fp64 = (precision == 'd' || precision == 'z');
+        double peak_flops = fp64 ? peaks.gflops_fp64 : peaks.gflops_fp32;
+        double gflops = flops / (rocsolver_bench_breakdown.hot_us * 1e3);
+        double gbytes = bytes / (rocsolver_bench_breakdown.hot_us * 1e3);
+        double roof = std::min(peak_flops, flops / bytes * peaks.gbytes);
+        if(!argus.perf)
+        {
+            rocsolver_bench_header("Roofline:");
+            rocsolver_bench_output("gflops", "gbytes_per_s", "pct_peak_flops", "pct_peak_bw",
+                                   "pct_roofline");
+        }
+        rocsolver_bench_output(gflops, gbytes, 100 * gflops / peak_flops,
+                               100 * gbytes / peaks.gbytes, 100 * gflops / roof);
+        if(!argus.perf)
+            rocsolver_bench_endl();
+    }
+    rocsolver_bench_breakdown.release();
+
     // terminate logging
     rocsolver_log_end();
 
@@ -0,0 +1,197 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fmt/core.h>
+
+#include "common/misc/clients_utility.hpp"
+#include "common/misc/rocsolver_arguments.hpp"
+#include "common/misc/rocsolver_dispatcher.hpp"
+#include "common/misc/rocsolver_test.hpp"
+
+/*
+ * ===========================================================================
+ *    The multi-stream benchmark runs the same test from several host threads
+ *    at once. Every thread creates its own stream, and the testers create
+ *    their handle on it; the hot calls of all the threads start at the same
+ *    time, and the aggregate throughput is the total number of hot calls
+ *    divided by the time between the first start and the last end.
+ * ===========================================================================
+ */
+
+struct streams_options
+{
+    std::string function;
+    char precision;
+    rocblas_int device_id;
+    rocblas_int streams;
+};
+
+/** Barrier for the threads of a multi-stream benchmark. A thread that terminates without
+    reaching the barrier (e.g. because its test failed) must leave it so that the others do not
+    wait forever. **/
+class streams_barrier
+{
+    std::mutex mutex;
+    std::condition_variable cv;
+    int expected;
+    int waiting = 0;
+    bool open = false;
+
+    void release_if_complete()
+    {
+        if(!open && waiting >= expected)
+        {
+            open = true;
+            cv.notify_all();
+        }
+    }
+
+public:
+    explicit streams_barrier(int count)
+        : expected(count)
+    {
+    }
+
+    void arrive_and_wait()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        waiting++;
+        release_if_complete();
+        cv.wait(lock, [this] { return open; });
+    }
+
+    void leave()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        expected--;
+        release_if_complete();
+    }
+};
+
+/** Runs the test described by argus on the given number of streams at once, and prints the
+    aggregate throughput and the average and worst latency of the hot calls. **/
+static void run_streams(const streams_options& opt, const Arguments& argus)
+{
+    if(opt.streams < 1)
+        throw std::invalid_argument("The number of streams must be positive");
+    if(argus.profile)
+        throw std::invalid_argument("Profile logging is not supported with multiple streams");
+
+    streams_barrier barrier(opt.streams);
+    thread_local bool arrived;
+    rocsolver_bench_hot_barrier = [&barrier] {
+        arrived = true;
+        barrier.arrive_and_wait();
+    };
+
+    std::vector<std::thread> threads;
+    std::vector<std::string> errors(opt.streams);
+    std::vector<rocsolver_bench_breakdown_data> times(opt.streams);
+    for(rocblas_int t = 0; t < opt.streams; ++t)
+    {
+        threads.emplace_back([&, t] {
+            arrived = false;
+            hipStream_t stream = nullptr;
+            std::vector<std::string> rows;
+            try
+            {
+                set_device(opt.device_id);
+                THROW_IF_HIP_ERROR(hipStreamCreateWithFlags(&stream, hipStreamNonBlocking));
+                rocblas_local_handle_stream = stream;
+                rocsolver_bench_capture = &rows;
+
+                Arguments thread_argus = argus;
+                thread_argus.unit_check = 0;
+                thread_argus.norm_check = 0;
+                thread_argus.timing = 1;
+                thread_argus.perf = 1;
+                rocsolver_dispatcher::invoke(opt.function, opt.precision, thread_argus);
+                times[t] = rocsolver_bench_breakdown;
+            }
+            catch(const std::exception& exp)
+            {
+                errors[t] = exp.what();
+            }
+            if(!arrived)
+                barrier.leave();
+
+            rocsolver_bench_capture = nullptr;
+            rocblas_local_handle_stream = nullptr;
+            if(stream)
+                (void)hipStreamDestroy(stream);
+        });
+    }
+    for(auto& thread : threads)
+        thread.join();
+    rocsolver_bench_hot_barrier = nullptr;
+
+    for(rocblas_int t = 0; t < opt.streams; ++t)
+    {
+        if(!errors[t].empty())
+            throw std::runtime_error(fmt::format("Stream {}: {}", t, errors[t]));
+    }
+
+    double begin = times[0].hot_begin_us, end = times[0].hot_end_us, latency = 0, worst = 0;
+    for(const rocsolver_bench_breakdown_data& time : times)
+    {
+        begin = std::min(begin, time.hot_begin_us);
+        end = std::max(end, time.hot_end_us);
+        latency += time.hot_us;
+        worst = std::max(worst, time.hot_us);
+    }
+    latency /= opt.streams;
+    if(end <= begin || latency <= 0)
+    {
+        fmt::print("No performance data to collect.\n");
+        return;
+    }
+
+    // hot calls per second of all the streams together
+    double calls = double(opt.streams) * argus.iters;
+    double throughput = calls / (end - begin) * 1e6;
+
+    if(!argus.perf)
+    {
+        rocsolver_bench_header("Multi-stream results:");
+        rocsolver_bench_output("streams", "calls", "wall_time_us", "calls_per_s", "avg_call_us",
+                               "max_call_us");
+    }
+    rocsolver_bench_output(opt.streams, calls, end - begin, throughput, latency, worst);
+    if(!argus.perf)
+        rocsolver_bench_endl();
+}
@@ -0,0 +1,487 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <fmt/core.h>
+#include <fmt/ostream.h>
+#include <fmt/ranges.h>
+
+#include "common/misc/rocsolver_arguments.hpp"
+#include "common/misc/rocsolver_dispatcher.hpp"
+#include "common/misc/rocsolver_perf_model.hpp"
+#include "common/misc/rocsolver_test.hpp"
+
+/*
+ * ===========================================================================
+ *    The suite runner reads a sweep file and benchmarks every configuration
+ *    in the same process. A sweep file is a list of entries in a small subset
+ *    of YAML, for example:
+ *
+ *      # LU factorizations of batches of small matrices
+ *      - function: getrf_strided_batched
+ *        precision: [s, d]
+ *        m: [16, 32, 64]
+ *        batch_count: [1000, 10000]
+ *      - function: potrf
+ *        precision: d
+ *        n: [1024, 2048, 4096]
+ *        lda: 4160
+ *
+ *    Every key other than function and precision is a rocsolver-bench option,
+ *    and every combination of the values of an entry is a configuration. Each
+ *    configuration is run --iters times, and the median, 95th percentile and
+ *    minimum of the GPU time of a single call are reported (in JSON or, if the
+ *    name of the output file ends in .csv, in CSV format).
+ *
+ *    The replay mode reads a bench log instead (the rocsolver-bench command
+ *    lines written to ROCSOLVER_LOG_BENCH_PATH by an application), runs every
+ *    distinct configuration of the log, and weighs its median time by the
+ *    number of times it was called to report the hotspots of the workload.
+ * ===========================================================================
+ */
+
+struct suite_options
+{
+    std::string file;
+    std::string output;
+    rocblas_int samples;
+};
+
+struct suite_config
+{
+    std::string function;
+    char precision;
+    // option names and values, in the order given in the sweep file
+    std::vector<std::pair<std::string, std::string>> args;
+};
+
+struct suite_result
+{
+    suite_config config;
+    std::string status;
+    double median_us = 0;
+    double p95_us = 0;
+    double min_us = 0;
+    double gflops = 0;
+    double gbytes = 0;
+    // number of calls in the replayed bench log
+    size_t calls = 1;
+};
+
+// parses the benchmark options of a configuration and returns the resulting arguments
+using suite_parser = std::function<Arguments&(const suite_config&)>;
+
+static std::string suite_trim(const std::string& str)
+{
+    size_t first = str.find_first_not_of(" \t\r");
+    if(first == std::string::npos)
+        return "";
+    size_t last = str.find_last_not_of(" \t\r");
+    std::string res = str.substr(first, last - first + 1);
+    if(res.size() >= 2 && (res.front() == '"' || res.front() == '\'') && res.back() == res.front())
+        res = res.substr(1, res.size() - 2);
+    return res;
+}
+
+/** Reads the entries of a sweep file as maps from keys to lists of values. **/
+static std::vector<std::vector<std::pair<std::string, std::vector<std::string>>>>
+    suite_read(const std::string& file)
+{
+    std::ifstream is(file);
+    if(!is.good())
+        throw std::runtime_error(fmt::format("Could not open {}", file));
+
+    std::vector<std::vector<std::pair<std::string, std::vector<std::string>>>> entries;
+    std::string line;
+    for(int number = 1; std::getline(is, line); ++number)
+    {
+        line = line.substr(0, line.find('#'));
+        if(suite_trim(line).empty())
+            continue;
+
+        size_t start = line.find_first_not_of(" \t");
+        if(line.compare(start, 2, "- ") == 0)
+        {
+            entries.emplace_back();
+            start += 2;
+        }
+        else if(start == 0 || entries.empty())
+            throw std::invalid_argument(fmt::format("{}:{}: expected an entry", file, number));
+
+        size_t colon = line.find(':', start);
+        if(colon == std::string::npos)
+            throw std::invalid_argument(fmt::format("{}:{}: expected 'key: value'", file, number));
+        std::string key = suite_trim(line.substr(start, colon - start));
+        std::string value = suite_trim(line.substr(colon + 1));
+
+        std::vector<std::string> values;
+        if(!value.empty() && value.front() == '[' && value.back() == ']')
+        {
+            value = value.substr(1, value.size() - 2);
+            size_t pos = 0;
+            while(pos <= value.size())
+            {
+                size_t end = std::min(value.find(',', pos), value.size());
+                std::string item = suite_trim(value.substr(pos, end - pos));
+                if(!item.empty())
+                    values.push_back(item);
+                pos = end + 1;
+            }
+        }
+        else if(!value.empty())
+            values.push_back(value);
+
+        if(key.empty() || values.empty())
+            throw std::invalid_argument(fmt::format("{}:{}: expected 'key: value'", file, number));
+        entries.back().emplace_back(key, values);
+    }
+    return entries;
+}
+
+/** Expands the entries of a sweep file into the list of configurations. **/
+static std::vector<suite_config> suite_expand(const std::string& file)
+{
+    std::vector<suite_config> configs;
+    for(auto& entry : suite_read(file))
+    {
+        std::vector<size_t> index(entry.size(), 0);
+        while(true)
+        {
+            suite_config config;
+            config.precision = 's';
+            for(size_t k = 0; k < entry.size(); ++k)
+            {
+                const std::string& key = entry[k].first;
+                const std::string& value = entry[k].second[index[k]];
+                if(key == "function")
+                    config.function = value;
+                else if(key == "precision")
+                    config.precision = value[0];
+                else
+                    config.args.emplace_back(key, value);
+            }
+            if(config.function.empty())
+                throw std::invalid_argument(fmt::format("{}: entry without function", file));
+            configs.push_back(config);
+
+            // next combination of values
+            size_t k = 0;
+            for(; k < entry.size(); ++k)
+            {
+                if(++index[k] < entry[k].second.size())
+                    break;
+                index[k] = 0;
+            }
+            if(k == entry.size())
+                break;
+        }
+    }
+    return configs;
+}
+
+/** Runs one configuration the given number of times, and returns the GPU times in
+    microseconds. **/
+static std::vector<double>
+    suite_time(const suite_config& config, const suite_parser& parse, rocblas_int samples)
+{
+    std::vector<std::string> rows;
+    rocsolver_bench_capture = &rows;
+    try
+    {
+        for(rocblas_int s = 0; s < samples; ++s)
+        {
+            Arguments& argus = parse(config);
+            argus.unit_check = 0;
+            argus.norm_check = 0;
+            argus.timing = 1;
+            argus.perf = 1;
+            argus.iters = 1;
+            rocsolver_dispatcher::invoke(config.function, config.precision, argus);
+        }
+    }
+    catch(...)
+    {
+        rocsolver_bench_capture = nullptr;
+        throw;
+    }
+    rocsolver_bench_capture = nullptr;
+
+    std::vector<double> times;
+    for(const std::string& row : rows)
+        times.push_back(std::stod(row));
+    return times;
+}
+
+// options with a single-character name take a single dash (e.g. -m 10 --lda 10)
+static std::string suite_option(const std::string& key)
+{
+    return (key.size() == 1 ? "-" : "--") + key;
+}
+
+static std::string suite_args_string(const suite_config& config)
+{
+    std::string str;
+    for(auto& arg : config.args)
+        str += fmt::format("{}{} {}", str.empty() ? "" : " ", suite_option(arg.first), arg.second);
+    return str;
+}
+
+static void suite_write(const suite_options& opt,
+                        const std::string& header,
+                        const std::vector<suite_result>& results,
+                        bool replay = false)
+{
+    std::ofstream os(opt.output);
+    if(!os.good())
+        throw std::runtime_error(fmt::format("Could not open {}", opt.output));
+
+    bool csv = opt.output.size() >= 4 && opt.output.compare(opt.output.size() - 4, 4, ".csv") == 0;
+    if(csv)
+    {
+        fmt::print(os, "function,precision,args,status,samples,median_us,p95_us,min_us,gflops,"
+                       "gbytes_per_s{}\n",
+                   replay ? ",calls,total_us" : "");
+        for(const suite_result& r : results)
+        {
+            fmt::print(os, "{},{},\"{}\",{},{},{:.3f},{:.3f},{:.3f},{:.3f},{:.3f}",
+                       r.config.function, r.config.precision, suite_args_string(r.config),
+                       r.status, opt.samples, r.median_us, r.p95_us, r.min_us, r.gflops, r.gbytes);
+            if(replay)
+                fmt::print(os, ",{},{:.3f}", r.calls, r.calls * r.median_us);
+            fmt::print(os, "\n");
+        }
+    }
+    else
+    {
+        fmt::print(os, "{{\n{},\n  \"results\": [", header);
+        for(size_t i = 0; i < results.size(); ++i)
+        {
+            const suite_result& r = results[i];
+            std::string args;
+            for(auto& arg : r.config.args)
+                args += fmt::format("{}\"{}\": \"{}\"", args.empty() ? "" : ", ", arg.first,
+                                    arg.second);
+            fmt::print(os,
+                       "{}\n    {{\"function\": \"{}\", \"precision\": \"{}\", \"args\": {{{}}}, "
+                       "\"status\": \"{}\", \"samples\": {}, \"median_us\": {:.3f}, "
+                       "\"p95_us\": {:.3f}, \"min_us\": {:.3f}, \"gflops\": {:.3f}, "
+                       "\"gbytes_per_s\": {:.3f}",
+                       i ? "," : "", r.config.function, r.config.precision, args, r.status,
+                       opt.samples, r.median_us, r.p95_us, r.min_us, r.gflops, r.gbytes);
+            if(replay)
+                fmt::print(os, ", \"calls\": {}, \"total_us\": {:.3f}", r.calls,
+                           r.calls * r.median_us);
+            fmt::print(os, "}}");
+        }
+        fmt::print(os, "\n  ]\n}}\n");
+    }
+}
+
+/** Times one configuration and fills in its results. **/
+static void suite_measure(suite_result& r, const suite_parser& parse, rocblas_int samples)
+{
+    const suite_config& config = r.config;
+    std::vector<double> times;
+    try
+    {
+        times = suite_time(config, parse, samples);
+        r.status = times.empty() ? "no timing" : "ok";
+    }
+    catch(const std::exception& exp)
+    {
+        r.status = exp.what();
+        std::replace(r.status.begin(), r.status.end(), '"', '\'');
+    }
+
+    if(!times.empty())
+    {
+        std::sort(times.begin(), times.end());
+        size_t count = times.size();
+        r.min_us = times[0];
+        r.median_us
+            = (count % 2) ? times[count / 2] : 0.5 * (times[count / 2 - 1] + times[count / 2]);
+        r.p95_us = times[std::min(count - 1, size_t(std::ceil(0.95 * count)) - 1)];
+
+        double flops, bytes;
+        if(rocsolver_perf_model(config.function, config.precision, parse(config), flops, bytes)
+           && r.median_us > 0)
+        {
+            r.gflops = flops / (r.median_us * 1e3);
+            r.gbytes = bytes / (r.median_us * 1e3);
+        }
+    }
+}
+
+/** Runs all the configurations of the sweep file and writes the results. The header holds
+    the JSON fields describing the library versions and the device. **/
+static void
+    run_suite(const suite_options& opt, const std::string& header, const suite_parser& parse)
+{
+    std::vector<suite_config> configs = suite_expand(opt.file);
+    if(opt.samples < 1)
+        throw std::invalid_argument("The number of iterations must be positive");
+
+    std::vector<suite_result> results;
+    for(const suite_config& config : configs)
+    {
+        suite_result r;
+        r.config = config;
+        fmt::print("{} -r {} {}: ", config.function, config.precision, suite_args_string(config));
+        std::fflush(stdout);
+
+        suite_measure(r, parse, opt.samples);
+
+        fmt::print("{} (median {:.3f} us)\n", r.status, r.median_us);
+        std::fflush(stdout);
+        results.push_back(r);
+    }
+
+    suite_write(opt, header, results);
+    fmt::print("Results written to {}\n", opt.output);
+}
+
+/** Reads the rocsolver-bench command lines of a bench log, and returns its distinct
+    configurations (in order of first appearance) with the number of calls of each one.
+    Lines that are not bench commands (e.g. the header of the log file) are skipped. **/
+static std::vector<suite_result> replay_read(const std::string& file)
+{
+    std::ifstream is(file);
+    if(!is.good())
+        throw std::runtime_error(fmt::format("Could not open {}", file));
+
+    std::vector<suite_result> configs;
+    std::map<std::string, size_t> index;
+    std::string line;
+    for(int number = 1; std::getline(is, line); ++number)
+    {
+        size_t start = line.find("rocsolver-bench ");
+        if(start == std::string::npos)
+            continue;
+
+        std::istringstream tokens(line.substr(start + 16));
+        suite_config config;
+        config.precision = 's';
+        std::string key, value;
+        while(tokens >> key)
+        {
+            if(key.size() < 2 || key[0] != '-' || !(tokens >> value))
+                throw std::invalid_argument(
+                    fmt::format("{}:{}: expected '-option value' pairs", file, number));
+            key = key.substr(key.find_first_not_of('-'));
+
+            if(key == "f" || key == "function")
+                config.function = value;
+            else if(key == "r" || key == "precision")
+                config.precision = value[0];
+            else
+                config.args.emplace_back(key, value);
+        }
+        if(config.function.empty())
+            throw std::invalid_argument(
+                fmt::format("{}:{}: command without function", file, number));
+
+        // identical configurations are run once
+        std::string id
+            = fmt::format("{} {} {}", config.function, config.precision, suite_args_string(config));
+        auto it = index.find(id);
+        if(it != index.end())
+            configs[it->second].calls++;
+        else
+        {
+            index.emplace(id, configs.size());
+            configs.emplace_back();
+            configs.back().config = config;
+        }
+    }
+    return configs;
+}
+
+/** Replays the distinct configurations of a bench log, writes the results (with the number of
+    calls and the total time of every configuration), and prints the configurations sorted by
+    their share of the total time of the workload. **/
+static void
+    run_replay(const suite_options& opt, const std::string& header, const suite_parser& parse)
+{
+    std::vector<suite_result> results = replay_read(opt.file);
+    if(opt.samples < 1)
+        throw std::invalid_argument("The number of iterations must be positive");
+
+    size_t calls = 0;
+    for(const suite_result& r : results)
+        calls += r.calls;
+    fmt::print("Replaying {} calls ({} distinct configurations) of {}\n", calls, results.size(),
+               opt.file);
+
+    double total_us = 0;
+    for(suite_result& r : results)
+    {
+        fmt::print("{} -r {} {} (x{}): ", r.config.function, r.config.precision,
+                   suite_args_string(r.config), r.calls);
+        std::fflush(stdout);
+
+        suite_measure(r, parse, opt.samples);
+        total_us += r.calls * r.median_us;
+
+        fmt::print("{} (median {:.3f} us)\n", r.status, r.median_us);
+        std::fflush(stdout);
+    }
+
+    suite_write(opt, header, results, true);
+
+    // hotspot table
+    std::vector<const suite_result*> sorted;
+    for(const suite_result& r : results)
+        sorted.push_back(&r);
+    std::stable_sort(sorted.begin(), sorted.end(),
+                     [](const suite_result* a, const suite_result* b) {
+                         return a->calls * a->median_us > b->calls * b->median_us;
+                     });
+
+    fmt::print("\nHotspots (median time weighted by the number of calls):\n");
+    fmt::print("{:>7} {:>12} {:>8} {:>12}  {}\n", "share", "total_ms", "calls", "median_us",
+               "configuration");
+    for(const suite_result* r : sorted)
+    {
+        double share = total_us > 0 ? 100 * r->calls * r->median_us / total_us : 0;
+        fmt::print("{:>6.1f}% {:>12.3f} {:>8} {:>12.3f}  {} -r {} {}{}\n", share,
+                   r->calls * r->median_us * 1e-3, r->calls, r->median_us, r->config.function,
+                   r->config.precision, suite_args_string(r->config),
+                   r->status == "ok" ? "" : " (" + r->status + ")");
+    }
+    fmt::print("Total: {:.3f} ms\nResults written to {}\n", total_us * 1e-3, opt.output);
+}
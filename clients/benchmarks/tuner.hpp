@@ -0,0 +1,307 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <fmt/core.h>
+#include <fmt/ostream.h>
+#include <fmt/ranges.h>
+#include <hip/hip_runtime_api.h>
+
+#ifdef _WIN32
+#define popen _popen
+#define pclose _pclose
+#endif
+
+/*
+ * ===========================================================================
+ *    The tuner runs the benchmark client repeatedly with different run-time
+ *    tuning tables (see ROCSOLVER_TUNING_PATH) in order to find the best block
+ *    size for each size in a grid, and writes the resulting tuning file.
+ *    Every run is executed in a separate process, as the library reads the
+ *    tuning file only once.
+ * ===========================================================================
+ */
+
+struct tuner_options
+{
+    std::string program;
+    std::string function;
+    char precision;
+    rocblas_int device_id;
+    rocblas_int batch_count;
+    rocblas_int iters;
+    std::string sizes;
+    std::string blksizes;
+    std::string output;
+};
+
+static std::vector<rocblas_int> tuner_parse_list(const std::string& str, const char* option)
+{
+    std::vector<rocblas_int> values;
+    size_t start = 0;
+    while(start <= str.size())
+    {
+        size_t end = str.find(',', start);
+        if(end == std::string::npos)
+            end = str.size();
+        std::string item = str.substr(start, end - start);
+        size_t pos;
+        try
+        {
+            values.push_back(std::stoi(item, &pos));
+        }
+        catch(const std::exception&)
+        {
+            pos = 0;
+        }
+        if(pos == 0)
+            throw std::invalid_argument(fmt::format("Invalid value '{}' for --{}", item, option));
+        start = end + 1;
+    }
+    return values;
+}
+
+static void tuner_set_env(const char* name, const std::string& value)
+{
+#ifdef _WIN32
+    _putenv_s(name, value.c_str());
+#else
+    setenv(name, value.c_str(), 1);
+#endif
+}
+
+static std::string tuner_device_arch(rocblas_int device_id)
+{
+    hipDeviceProp_t props;
+    if(hipGetDeviceProperties(&props, device_id) != hipSuccess)
+        throw std::runtime_error("Could not query the device properties");
+    std::string name(props.gcnArchName);
+    return name.substr(0, name.find(':'));
+}
+
+/** Returns the name of the tuning table used by the given function, and the block sizes tried
+    by default. For the batched GETRI and TRTRI, gj_table is also set to the name of the table that
+    selects the blocked Gauss-Jordan kernel; in that case, a negative block size -nb stands for the
+    Gauss-Jordan kernel with panels of nb columns. **/
+static std::string tuner_table(const std::string& function,
+                               char precision,
+                               std::string& blksizes,
+                               std::string& gj_table)
+{
+    std::string base = function;
+    bool batched = false;
+    for(const char* suffix : {"_strided_batched", "_batched"})
+    {
+        size_t len = std::string(suffix).size();
+        if(base.size() > len && base.compare(base.size() - len, len, suffix) == 0)
+        {
+            base.resize(base.size() - len);
+            batched = true;
+            break;
+        }
+    }
+
+    bool complex = (precision == 'c' || precision == 'z');
+    std::string batch = (batched ? "_batch" : "");
+    if(base == "getrf")
+    {
+        blksizes = "0,1,16,32,64,128,256,512";
+        return "getrf" + batch + (complex ? "_complex" : "_real");
+    }
+    if(base == "getrf_npvt")
+    {
+        blksizes = "0,-1,16,32,64,128,256,512";
+        return "getrf_npvt" + batch + (complex ? "_complex" : "_real");
+    }
+    if(base == "getri")
+    {
+        blksizes = batched ? "0,16,32,64,128,256,-4,-8,-16" : "0,16,32,64,128,256";
+        gj_table = batched ? "getri_batch_gj" : "";
+        return "getri" + batch;
+    }
+    if(base == "trtri")
+    {
+        blksizes = batched ? "0,1,16,32,64,128,-4,-8,-16" : "0,1,16,32,64,128";
+        gj_table = batched ? "trtri_batch_gj" : "";
+        return "trtri" + batch;
+    }
+
+    throw std::invalid_argument(fmt::format(
+        "Function {} cannot be tuned. Tunable functions are getrf, getrf_npvt, getri and "
+        "trtri (with batched and strided_batched versions)",
+        function));
+}
+
+/** Runs the benchmark for one size and block size, and returns the GPU time in microseconds. **/
+static double tuner_run(const tuner_options& opt,
+                        const std::string& table,
+                        const std::string& gj_table,
+                        const std::string& tuning_file,
+                        rocblas_int n,
+                        rocblas_int blk)
+{
+    // force the block size blk for all matrix sizes
+    // (or the Gauss-Jordan kernel with panels of -blk columns)
+    {
+        std::ofstream file(tuning_file);
+        rocblas_int gj_blk = (blk < 0) ? -blk : 0;
+        if(blk >= 0 || gj_table.empty())
+            fmt::print(file, "{}.intervals = {}\n{}.blksizes = {}, {}\n", table, n, table, blk,
+                       blk);
+        if(!gj_table.empty())
+            fmt::print(file, "{}.intervals = {}\n{}.blksizes = {}, {}\n", gj_table, n, gj_table,
+                       gj_blk, gj_blk);
+    }
+
+    bool getrf = (opt.function.rfind("getrf", 0) == 0);
+    std::string cmd = fmt::format("\"{}\" -f {} -r {} --device {} -i {} --perf 1 -n {}",
+                                  opt.program, opt.function, opt.precision, opt.device_id,
+                                  opt.iters, n);
+    if(getrf)
+        cmd += fmt::format(" -m {}", n);
+    if(opt.function.find("batched") != std::string::npos)
+        cmd += fmt::format(" --batch_count {}", opt.batch_count);
+
+    FILE* pipe = popen(cmd.c_str(), "r");
+    if(!pipe)
+        throw std::runtime_error("Could not run the benchmark client");
+
+    std::string output;
+    char buffer[256];
+    while(fgets(buffer, sizeof(buffer), pipe))
+        output += buffer;
+    int status = pclose(pipe);
+
+    double time;
+    try
+    {
+        time = std::stod(output);
+    }
+    catch(const std::exception&)
+    {
+        status = -1;
+    }
+    if(status != 0)
+        return std::numeric_limits<double>::infinity();
+
+    return time;
+}
+
+/** Writes the table with the given best block size for every size, merging consecutive sizes
+    with the same block size into intervals. **/
+static void tuner_write_table(std::ofstream& file,
+                              const std::string& table,
+                              const std::vector<rocblas_int>& sizes,
+                              const std::vector<rocblas_int>& best)
+{
+    std::vector<rocblas_int> intervals, blks;
+    for(size_t i = 0; i < sizes.size(); ++i)
+    {
+        if(i + 1 == sizes.size() || best[i] != best[i + 1])
+        {
+            intervals.push_back(sizes[i]);
+            blks.push_back(best[i]);
+        }
+    }
+    blks.push_back(blks.back());
+
+    fmt::print(file, "{}.intervals = {}\n", table, fmt::join(intervals, ", "));
+    fmt::print(file, "{}.blksizes = {}\n", table, fmt::join(blks, ", "));
+}
+
+static void run_tuner(const tuner_options& opt)
+{
+    std::string default_blksizes, gj_table;
+    std::string table = tuner_table(opt.function, opt.precision, default_blksizes, gj_table);
+    std::vector<rocblas_int> sizes = tuner_parse_list(opt.sizes, "tune_sizes");
+    std::vector<rocblas_int> blksizes
+        = tuner_parse_list(opt.blksizes.empty() ? default_blksizes : opt.blksizes, "tune_blksizes");
+    for(size_t i = 1; i < sizes.size(); ++i)
+    {
+        if(sizes[i] <= sizes[i - 1])
+            throw std::invalid_argument("Values of --tune_sizes must be increasing");
+    }
+
+    std::string tuning_file = opt.output + ".tmp";
+    tuner_set_env("ROCSOLVER_TUNING_PATH", tuning_file);
+
+    // find the best block size for every size in the grid; when the Gauss-Jordan kernel is
+    // tuned, the best block size of the other path is also kept, as it is used where the kernel
+    // is not selected
+    std::vector<rocblas_int> best(sizes.size()), best_gj(sizes.size(), 0);
+    for(size_t i = 0; i < sizes.size(); ++i)
+    {
+        double best_time = std::numeric_limits<double>::infinity();
+        double best_time_gj = std::numeric_limits<double>::infinity();
+        best[i] = blksizes[0];
+        for(rocblas_int blk : blksizes)
+        {
+            double time = tuner_run(opt, table, gj_table, tuning_file, sizes[i], blk);
+            bool gj = (blk < 0 && !gj_table.empty());
+            fmt::print("{}: n = {}, blksize = {}: {} us\n", gj ? gj_table : table, sizes[i],
+                       gj ? -blk : blk, time);
+            if(gj && time < best_time_gj)
+            {
+                best_time_gj = time;
+                best_gj[i] = -blk;
+            }
+            if(!gj && time < best_time)
+            {
+                best_time = time;
+                best[i] = blk;
+            }
+        }
+        if(best_time <= best_time_gj)
+            best_gj[i] = 0;
+        std::fflush(stdout);
+    }
+    std::remove(tuning_file.c_str());
+
+    std::ofstream file(opt.output);
+    if(!file.good())
+        throw std::runtime_error(fmt::format("Could not open {}", opt.output));
+    fmt::print(file, "# generated by rocsolver-bench --tune\n");
+    fmt::print(file, "# function: {}, precision: {}", opt.function, opt.precision);
+    if(opt.function.find("batched") != std::string::npos)
+        fmt::print(file, ", batch_count: {}", opt.batch_count);
+    fmt::print(file, "\n[{}]\n", tuner_device_arch(opt.device_id));
+    tuner_write_table(file, table, sizes, best);
+    if(!gj_table.empty())
+        tuner_write_table(file, gj_table, sizes, best_gj);
+
+
+    fmt::print("Tuning table written to {}\n", opt.output);
+}
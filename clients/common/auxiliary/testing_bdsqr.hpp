@@ -121,6 +121,22 @@ void testing_bdsqr_bad_arg()
     // check bad arguments
     bdsqr_checkBadArgs(handle, uplo, n, nv, nu, nc, dD.data(), dE.data(), dV.data(), ldv, dU.data(),
                        ldu, dC.data(), ldc, dinfo.data());
+
+    // check algorithm selection
+    // (divide and conquer is not an algorithm of BDSQR)
+    rocsolver_alg_mode alg;
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_set_alg_mode(handle, rocsolver_function_bdsqr, rocsolver_alg_mode_dc),
+        rocblas_status_invalid_value);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_set_alg_mode(handle, rocsolver_function_bdsqr, rocsolver_alg_mode_hybrid),
+        rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(rocsolver_get_alg_mode(handle, rocsolver_function_bdsqr, &alg),
+                          rocblas_status_success);
+    EXPECT_EQ(alg, rocsolver_alg_mode_hybrid);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_set_alg_mode(handle, rocsolver_function_bdsqr, rocsolver_alg_mode_qr),
+        rocblas_status_success);
 }
 
 template <bool CPU, bool GPU, typename T, typename S, typename Sd, typename Td, typename Ud, typename Sh, typename Th, typename Uh>
@@ -426,6 +442,7 @@ void bdsqr_getPerfData(const rocblas_handle handle,
         bdsqr_initData<false, true, T>(handle, uplo, n, nv, nu, nc, dD, dE, dV, ldv, dU, ldu, dC,
                                        ldc, dInfo, hD, hE, hV, hU, hC, hInfo, D, E, false);
 
+        rocsolver_bench_first_call first_call(handle, iter);
         CHECK_ROCBLAS_ERROR(rocsolver_bdsqr(handle, uplo, n, nv, nu, nc, dD.data(), dE.data(),
                                             dV.data(), ldv, dU.data(), ldu, dC.data(), ldc,
                                             dInfo.data()));
@@ -434,7 +451,7 @@ void bdsqr_getPerfData(const rocblas_handle handle,
     // gpu-lapack performance
     hipStream_t stream;
     CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
-    double start;
+    rocsolver_bench_timer timer(stream, hot_calls);
 
     if(profile > 0)
     {
@@ -446,15 +463,15 @@ void bdsqr_getPerfData(const rocblas_handle handle,
         rocsolver_log_set_max_levels(profile);
     }
 
-    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    for(rocblas_int iter = 0; iter < timer.calls(); iter++)
     {
         bdsqr_initData<false, true, T>(handle, uplo, n, nv, nu, nc, dD, dE, dV, ldv, dU, ldu, dC,
                                        ldc, dInfo, hD, hE, hV, hU, hC, hInfo, D, E, false);
 
-        start = get_time_us_sync(stream);
+        timer.start(iter);
         rocsolver_bdsqr(handle, uplo, n, nv, nu, nc, dD.data(), dE.data(), dV.data(), ldv,
                         dU.data(), ldu, dC.data(), ldc, dInfo.data());
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        *gpu_time_used += timer.stop(iter);
     }
     *gpu_time_used /= hot_calls;
 }
@@ -474,10 +491,15 @@ void testing_bdsqr(Arguments& argus)
     rocblas_int ldv = argus.get<rocblas_int>("ldv", nv > 0 ? n : 1);
     rocblas_int ldu = argus.get<rocblas_int>("ldu", nu > 0 ? nu : 1);
     rocblas_int ldc = argus.get<rocblas_int>("ldc", nc > 0 ? n : 1);
+    char algC = argus.get<char>("alg_mode", 'Q');
 
     rocblas_fill uplo = char2rocblas_fill(uploC);
+    rocsolver_alg_mode alg = char2rocsolver_alg_mode(algC);
     rocblas_int hot_calls = argus.iters;
 
+    // select the algorithm
+    CHECK_ROCBLAS_ERROR(rocsolver_set_alg_mode(handle, rocsolver_function_bdsqr, alg));
+
     // check non-supported values
     if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
     {
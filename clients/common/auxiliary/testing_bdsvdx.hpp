@@ -384,6 +384,7 @@ void bdsvdx_getPerfData(const rocblas_handle handle,
     {
         bdsvdx_initData<false, true, T>(handle, n, dD, dE, hD, hE);
 
+        rocsolver_bench_first_call first_call(handle, iter);
         CHECK_ROCBLAS_ERROR(rocsolver_bdsvdx(handle, uplo, svect, srange, n, dD.data(), dE.data(),
                                              vl, vu, il, iu, dNsv.data(), dS.data(), dZ.data(), ldz,
                                              dIfail.data(), dInfo.data()));
@@ -392,7 +393,7 @@ void bdsvdx_getPerfData(const rocblas_handle handle,
     // gpu-lapack performance
     hipStream_t stream;
     CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
-    double start;
+    rocsolver_bench_timer timer(stream, hot_calls);
 
     if(profile > 0)
     {
@@ -404,14 +405,14 @@ void bdsvdx_getPerfData(const rocblas_handle handle,
         rocsolver_log_set_max_levels(profile);
     }
 
-    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    for(rocblas_int iter = 0; iter < timer.calls(); iter++)
     {
         bdsvdx_initData<false, true, T>(handle, n, dD, dE, hD, hE);
 
-        start = get_time_us_sync(stream);
+        timer.start(iter);
         rocsolver_bdsvdx(handle, uplo, svect, srange, n, dD.data(), dE.data(), vl, vu, il, iu,
                          dNsv.data(), dS.data(), dZ.data(), ldz, dIfail.data(), dInfo.data());
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        *gpu_time_used += timer.stop(iter);
     }
     *gpu_time_used /= hot_calls;
 }
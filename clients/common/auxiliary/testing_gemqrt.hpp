@@ -0,0 +1,468 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "common/misc/client_util.hpp"
+#include "common/misc/clientcommon.hpp"
+#include "common/misc/lapack_host_reference.hpp"
+#include "common/misc/norm.hpp"
+#include "common/misc/rocsolver.hpp"
+#include "common/misc/rocsolver_arguments.hpp"
+#include "common/misc/rocsolver_test.hpp"
+
+template <bool COMPLEX, typename T>
+void gemqrt_checkBadArgs(const rocblas_handle handle,
+                         const rocblas_side side,
+                         const rocblas_operation trans,
+                         const rocblas_int m,
+                         const rocblas_int n,
+                         const rocblas_int k,
+                         const rocblas_int nb,
+                         T dV,
+                         const rocblas_int ldv,
+                         T dT,
+                         const rocblas_int ldt,
+                         T dC,
+                         const rocblas_int ldc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_gemqrt(nullptr, side, trans, m, n, k, nb, dV, ldv, dT, ldt, dC, ldc),
+        rocblas_status_invalid_handle);
+
+    // values
+    EXPECT_ROCBLAS_STATUS(rocsolver_gemqrt(handle, rocblas_side(0), trans, m, n, k, nb, dV, ldv, dT,
+                                           ldt, dC, ldc),
+                          rocblas_status_invalid_value);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gemqrt(handle, side, rocblas_operation(0), m, n, k, nb, dV, ldv,
+                                           dT, ldt, dC, ldc),
+                          rocblas_status_invalid_value);
+    if(COMPLEX)
+        EXPECT_ROCBLAS_STATUS(rocsolver_gemqrt(handle, side, rocblas_operation_transpose, m, n, k,
+                                               nb, dV, ldv, dT, ldt, dC, ldc),
+                              rocblas_status_invalid_value);
+    else
+        EXPECT_ROCBLAS_STATUS(rocsolver_gemqrt(handle, side, rocblas_operation_conjugate_transpose,
+                                               m, n, k, nb, dV, ldv, dT, ldt, dC, ldc),
+                              rocblas_status_invalid_value);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_gemqrt(handle, side, trans, m, n, k, nb, (T) nullptr, ldv, dT, ldt, dC, ldc),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_gemqrt(handle, side, trans, m, n, k, nb, dV, ldv, (T) nullptr, ldt, dC, ldc),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_gemqrt(handle, side, trans, m, n, k, nb, dV, ldv, dT, ldt, (T) nullptr, ldc),
+        rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_gemqrt(handle, rocblas_side_right, trans, 0, n, k, nb, dV, ldv,
+                                           dT, ldt, (T) nullptr, ldc),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gemqrt(handle, rocblas_side_left, trans, m, 0, k, nb, dV, ldv,
+                                           dT, ldt, (T) nullptr, ldc),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gemqrt(handle, rocblas_side_left, trans, m, n, 0, nb,
+                                           (T) nullptr, ldv, (T) nullptr, ldt, dC, ldc),
+                          rocblas_status_success);
+}
+
+template <typename T, bool COMPLEX = rocblas_is_complex<T>>
+void testing_gemqrt_bad_arg()
+{
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_side side = rocblas_side_left;
+    rocblas_operation trans = rocblas_operation_none;
+    rocblas_int k = 1;
+    rocblas_int m = 1;
+    rocblas_int n = 1;
+    rocblas_int nb = 1;
+    rocblas_int ldv = 1;
+    rocblas_int ldt = 1;
+    rocblas_int ldc = 1;
+
+    // memory allocation
+    device_strided_batch_vector<T> dV(1, 1, 1, 1);
+    device_strided_batch_vector<T> dT(1, 1, 1, 1);
+    device_strided_batch_vector<T> dC(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dV.memcheck());
+    CHECK_HIP_ERROR(dT.memcheck());
+    CHECK_HIP_ERROR(dC.memcheck());
+
+    // check bad arguments
+    gemqrt_checkBadArgs<COMPLEX>(handle, side, trans, m, n, k, nb, dV.data(), ldv, dT.data(), ldt,
+                                 dC.data(), ldc);
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Th>
+void gemqrt_initData(const rocblas_handle handle,
+                     const rocblas_side side,
+                     const rocblas_operation trans,
+                     const rocblas_int m,
+                     const rocblas_int n,
+                     const rocblas_int k,
+                     const rocblas_int nb,
+                     Td& dV,
+                     const rocblas_int ldv,
+                     Td& dT,
+                     const rocblas_int ldt,
+                     Td& dC,
+                     const rocblas_int ldc,
+                     Th& hV,
+                     Th& hT,
+                     Th& hC,
+                     std::vector<T>& hW)
+{
+    if(CPU)
+    {
+        rocblas_int nq = (side == rocblas_side_left) ? m : n;
+
+        rocblas_init<T>(hV, true);
+        rocblas_init<T>(hT, true);
+        rocblas_init<T>(hC, true);
+
+        // scale to avoid singularities
+        for(int i = 0; i < nq; ++i)
+        {
+            for(int j = 0; j < k; ++j)
+            {
+                if(i == j)
+                    hV[0][i + j * ldv] += 400;
+                else
+                    hV[0][i + j * ldv] -= 4;
+            }
+        }
+
+        // compute QR factorization
+        cpu_geqrt(nq, k, nb, hV[0], ldv, hT[0], ldt, hW.data());
+    }
+
+    if(GPU)
+    {
+        // copy data from CPU to device
+        CHECK_HIP_ERROR(dV.transfer_from(hV));
+        CHECK_HIP_ERROR(dT.transfer_from(hT));
+        CHECK_HIP_ERROR(dC.transfer_from(hC));
+    }
+}
+
+template <typename T, typename Td, typename Th>
+void gemqrt_getError(const rocblas_handle handle,
+                     const rocblas_side side,
+                     const rocblas_operation trans,
+                     const rocblas_int m,
+                     const rocblas_int n,
+                     const rocblas_int k,
+                     const rocblas_int nb,
+                     Td& dV,
+                     const rocblas_int ldv,
+                     Td& dT,
+                     const rocblas_int ldt,
+                     Td& dC,
+                     const rocblas_int ldc,
+                     Th& hV,
+                     Th& hT,
+                     Th& hC,
+                     Th& hCr,
+                     double* max_err)
+{
+    std::vector<T> hW(size_t(nb) * std::max(std::max(m, n), k));
+
+    // initialize data
+    gemqrt_initData<true, true, T>(handle, side, trans, m, n, k, nb, dV, ldv, dT, ldt, dC, ldc, hV,
+                                   hT, hC, hW);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_gemqrt(handle, side, trans, m, n, k, nb, dV.data(), ldv,
+                                         dT.data(), ldt, dC.data(), ldc));
+    CHECK_HIP_ERROR(hCr.transfer_from(dC));
+
+    // CPU lapack
+    cpu_gemqrt(side, trans, m, n, k, nb, hV[0], ldv, hT[0], ldt, hC[0], ldc, hW.data());
+
+    // error is ||hC - hCr|| / ||hC||
+    // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
+    // IT MIGHT BE REVISITED IN THE FUTURE)
+    // using frobenius norm
+    *max_err = norm_error('F', m, n, ldc, hC[0], hCr[0]);
+}
+
+template <typename T, typename Td, typename Th>
+void gemqrt_getPerfData(const rocblas_handle handle,
+                        const rocblas_side side,
+                        const rocblas_operation trans,
+                        const rocblas_int m,
+                        const rocblas_int n,
+                        const rocblas_int k,
+                        const rocblas_int nb,
+                        Td& dV,
+                        const rocblas_int ldv,
+                        Td& dT,
+                        const rocblas_int ldt,
+                        Td& dC,
+                        const rocblas_int ldc,
+                        Th& hV,
+                        Th& hT,
+                        Th& hC,
+                        double* gpu_time_used,
+                        double* cpu_time_used,
+                        const rocblas_int hot_calls,
+                        const int profile,
+                        const bool profile_kernels,
+                        const bool perf)
+{
+    std::vector<T> hW(size_t(nb) * std::max(std::max(m, n), k));
+
+    if(!perf)
+    {
+        gemqrt_initData<true, false, T>(handle, side, trans, m, n, k, nb, dV, ldv, dT, ldt, dC, ldc,
+                                        hV, hT, hC, hW);
+
+        // cpu-lapack performance (only if not in perf mode)
+        *cpu_time_used = get_time_us_no_sync();
+        cpu_gemqrt(side, trans, m, n, k, nb, hV[0], ldv, hT[0], ldt, hC[0], ldc, hW.data());
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    gemqrt_initData<true, false, T>(handle, side, trans, m, n, k, nb, dV, ldv, dT, ldt, dC, ldc, hV,
+                                    hT, hC, hW);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        gemqrt_initData<false, true, T>(handle, side, trans, m, n, k, nb, dV, ldv, dT, ldt, dC, ldc,
+                                        hV, hT, hC, hW);
+
+        rocsolver_bench_first_call first_call(handle, iter);
+        CHECK_ROCBLAS_ERROR(rocsolver_gemqrt(handle, side, trans, m, n, k, nb, dV.data(), ldv,
+                                             dT.data(), ldt, dC.data(), ldc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    rocsolver_bench_timer timer(stream, hot_calls);
+
+    if(profile > 0)
+    {
+        if(profile_kernels)
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile
+                                         | rocblas_layer_mode_ex_log_kernel);
+        else
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile);
+        rocsolver_log_set_max_levels(profile);
+    }
+
+    for(int iter = 0; iter < timer.calls(); iter++)
+    {
+        gemqrt_initData<false, true, T>(handle, side, trans, m, n, k, nb, dV, ldv, dT, ldt, dC, ldc,
+                                        hV, hT, hC, hW);
+
+        timer.start(iter);
+        rocsolver_gemqrt(handle, side, trans, m, n, k, nb, dV.data(), ldv, dT.data(), ldt,
+                         dC.data(), ldc);
+        *gpu_time_used += timer.stop(iter);
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <typename T, bool COMPLEX = rocblas_is_complex<T>>
+void testing_gemqrt(Arguments& argus)
+{
+    // get arguments
+    rocblas_local_handle handle;
+    char sideC = argus.get<char>("side");
+    char transC = argus.get<char>("trans");
+    rocblas_int m, n, k;
+    if(sideC == 'L')
+    {
+        m = argus.get<rocblas_int>("m");
+        n = argus.get<rocblas_int>("n", m);
+        k = argus.get<rocblas_int>("k", m);
+    }
+    else
+    {
+        n = argus.get<rocblas_int>("n");
+        m = argus.get<rocblas_int>("m", n);
+        k = argus.get<rocblas_int>("k", n);
+    }
+    rocblas_int nb = argus.get<rocblas_int>("nb", std::max(std::min(k, 32), 1));
+    rocblas_int ldv = argus.get<rocblas_int>("ldv", sideC == 'L' ? m : n);
+    rocblas_int ldt = argus.get<rocblas_int>("ldt", nb);
+    rocblas_int ldc = argus.get<rocblas_int>("ldc", m);
+
+    rocblas_side side = char2rocblas_side(sideC);
+    rocblas_operation trans = char2rocblas_operation(transC);
+    rocblas_int hot_calls = argus.iters;
+
+    // check non-supported values
+    bool invalid_value
+        = (side == rocblas_side_both || (COMPLEX && trans == rocblas_operation_transpose)
+           || (!COMPLEX && trans == rocblas_operation_conjugate_transpose));
+    if(invalid_value)
+    {
+        EXPECT_ROCBLAS_STATUS(rocsolver_gemqrt(handle, side, trans, m, n, k, nb, (T*)nullptr, ldv,
+                                               (T*)nullptr, ldt, (T*)nullptr, ldc),
+                              rocblas_status_invalid_value);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_args);
+
+        return;
+    }
+
+    // determine sizes
+    bool left = (side == rocblas_side_left);
+    size_t size_V = size_t(ldv) * k;
+    size_t size_T = size_t(ldt) * k;
+    size_t size_C = size_t(ldc) * n;
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_Cr = (argus.unit_check || argus.norm_check) ? size_C : 0;
+
+    // check invalid sizes
+    bool invalid_size = ((m < 0 || n < 0 || k < 0 || ldc < m || nb < 1 || ldt < nb)
+                         || (k > 0 && nb > k) || (left && (ldv < m || k > m))
+                         || (!left && (ldv < n || k > n)));
+    if(invalid_size)
+    {
+        EXPECT_ROCBLAS_STATUS(rocsolver_gemqrt(handle, side, trans, m, n, k, nb, (T*)nullptr, ldv,
+                                               (T*)nullptr, ldt, (T*)nullptr, ldc),
+                              rocblas_status_invalid_size);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_size);
+
+        return;
+    }
+
+    // memory size query is necessary
+    if(argus.mem_query || !USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        CHECK_ALLOC_QUERY(rocsolver_gemqrt(handle, side, trans, m, n, k, nb, (T*)nullptr, ldv,
+                                           (T*)nullptr, ldt, (T*)nullptr, ldc));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        if(argus.mem_query)
+        {
+            rocsolver_bench_inform(inform_mem_query, size);
+            return;
+        }
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    // memory allocations
+    host_strided_batch_vector<T> hC(size_C, 1, size_C, 1);
+    host_strided_batch_vector<T> hCr(size_Cr, 1, size_Cr, 1);
+    host_strided_batch_vector<T> hT(size_T, 1, size_T, 1);
+    host_strided_batch_vector<T> hV(size_V, 1, size_V, 1);
+    device_strided_batch_vector<T> dC(size_C, 1, size_C, 1);
+    device_strided_batch_vector<T> dT(size_T, 1, size_T, 1);
+    device_strided_batch_vector<T> dV(size_V, 1, size_V, 1);
+    if(size_V)
+        CHECK_HIP_ERROR(dV.memcheck());
+    if(size_T)
+        CHECK_HIP_ERROR(dT.memcheck());
+    if(size_C)
+        CHECK_HIP_ERROR(dC.memcheck());
+
+    // check quick return
+    if(n == 0 || m == 0 || k == 0)
+    {
+        EXPECT_ROCBLAS_STATUS(rocsolver_gemqrt(handle, side, trans, m, n, k, nb, dV.data(), ldv,
+                                               dT.data(), ldt, dC.data(), ldc),
+                              rocblas_status_success);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_quick_return);
+
+        return;
+    }
+
+    // check computations
+    if(argus.unit_check || argus.norm_check)
+        gemqrt_getError<T>(handle, side, trans, m, n, k, nb, dV, ldv, dT, ldt, dC, ldc, hV, hT, hC,
+                           hCr, &max_error);
+
+    // collect performance data
+    if(argus.timing)
+        gemqrt_getPerfData<T>(handle, side, trans, m, n, k, nb, dV, ldv, dT, ldt, dC, ldc, hV, hT,
+                              hC, &gpu_time_used, &cpu_time_used, hot_calls, argus.profile,
+                              argus.profile_kernels, argus.perf);
+
+    // validate results for rocsolver-test
+    // using s * machine_precision as tolerance
+    rocblas_int s = left ? m : n;
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, s);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            rocsolver_bench_header("Arguments:");
+            rocsolver_bench_output("side", "trans", "m", "n", "k", "nb", "ldv", "ldt", "ldc");
+            rocsolver_bench_output(sideC, transC, m, n, k, nb, ldv, ldt, ldc);
+
+            rocsolver_bench_header("Results:");
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_bench_endl();
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
+
+#define EXTERN_TESTING_GEMQRT(...) extern template void testing_gemqrt<__VA_ARGS__>(Arguments&);
+
+INSTANTIATE(EXTERN_TESTING_GEMQRT, FOREACH_SCALAR_TYPE, APPLY_STAMP)
@@ -283,6 +283,7 @@ void labrd_getPerfData(const rocblas_handle handle,
         labrd_initData<false, true, T>(handle, m, n, nb, dA, lda, dD, dE, dTauq, dTaup, dX, ldx, dY,
                                        ldy, hA, hD, hE, hTauq, hTaup, hX, hY);
 
+        rocsolver_bench_first_call first_call(handle, iter);
         CHECK_ROCBLAS_ERROR(rocsolver_labrd(handle, m, n, nb, dA.data(), lda, dD.data(), dE.data(),
                                             dTauq.data(), dTaup.data(), dX.data(), ldx, dY.data(),
                                             ldy));
@@ -291,7 +292,7 @@ void labrd_getPerfData(const rocblas_handle handle,
     // gpu-lapack performance
     hipStream_t stream;
     CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
-    double start;
+    rocsolver_bench_timer timer(stream, hot_calls);
 
     if(profile > 0)
     {
@@ -303,15 +304,15 @@ void labrd_getPerfData(const rocblas_handle handle,
         rocsolver_log_set_max_levels(profile);
     }
 
-    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    for(rocblas_int iter = 0; iter < timer.calls(); iter++)
     {
         labrd_initData<false, true, T>(handle, m, n, nb, dA, lda, dD, dE, dTauq, dTaup, dX, ldx, dY,
                                        ldy, hA, hD, hE, hTauq, hTaup, hX, hY);
 
-        start = get_time_us_sync(stream);
+        timer.start(iter);
         rocsolver_labrd(handle, m, n, nb, dA.data(), lda, dD.data(), dE.data(), dTauq.data(),
                         dTaup.data(), dX.data(), ldx, dY.data(), ldy);
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        *gpu_time_used += timer.stop(iter);
     }
     *gpu_time_used /= hot_calls;
 }
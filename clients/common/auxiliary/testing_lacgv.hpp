@@ -147,13 +147,14 @@ void lacgv_getPerfData(const rocblas_handle handle,
     {
         lacgv_initData<false, true, T>(handle, n, dA, inc, hA);
 
+        rocsolver_bench_first_call first_call(handle, iter);
         CHECK_ROCBLAS_ERROR(rocsolver_lacgv(handle, n, dA.data(), inc));
     }
 
     // gpu-lapack performance
     hipStream_t stream;
     CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
-    double start;
+    rocsolver_bench_timer timer(stream, hot_calls);
 
     if(profile > 0)
     {
@@ -165,13 +166,13 @@ void lacgv_getPerfData(const rocblas_handle handle,
         rocsolver_log_set_max_levels(profile);
     }
 
-    for(int iter = 0; iter < hot_calls; iter++)
+    for(int iter = 0; iter < timer.calls(); iter++)
     {
         lacgv_initData<false, true, T>(handle, n, dA, inc, hA);
 
-        start = get_time_us_sync(stream);
+        timer.start(iter);
         rocsolver_lacgv(handle, n, dA.data(), inc);
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        *gpu_time_used += timer.stop(iter);
     }
     *gpu_time_used /= hot_calls;
 }
@@ -216,6 +216,7 @@ void larf_getPerfData(const rocblas_handle handle,
     {
         larf_initData<false, true, T>(handle, side, m, n, dx, inc, dt, dA, lda, xx, hx, ht, hA);
 
+        rocsolver_bench_first_call first_call(handle, iter);
         CHECK_ROCBLAS_ERROR(
             rocsolver_larf(handle, side, m, n, dx.data(), inc, dt.data(), dA.data(), lda));
     }
@@ -223,7 +224,7 @@ void larf_getPerfData(const rocblas_handle handle,
     // gpu-lapack performance
     hipStream_t stream;
     CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
-    double start;
+    rocsolver_bench_timer timer(stream, hot_calls);
 
     if(profile > 0)
     {
@@ -235,13 +236,13 @@ void larf_getPerfData(const rocblas_handle handle,
         rocsolver_log_set_max_levels(profile);
     }
 
-    for(int iter = 0; iter < hot_calls; iter++)
+    for(int iter = 0; iter < timer.calls(); iter++)
     {
         larf_initData<false, true, T>(handle, side, m, n, dx, inc, dt, dA, lda, xx, hx, ht, hA);
 
-        start = get_time_us_sync(stream);
+        timer.start(iter);
         rocsolver_larf(handle, side, m, n, dx.data(), inc, dt.data(), dA.data(), lda);
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        *gpu_time_used += timer.stop(iter);
     }
     *gpu_time_used /= hot_calls;
 }
@@ -344,6 +344,7 @@ void larfb_getPerfData(const rocblas_handle handle,
         larfb_initData<false, true, T>(handle, side, trans, direct, storev, m, n, k, dV, ldv, dT,
                                        ldt, dA, lda, hV, hT, hA, hW, sizeW);
 
+        rocsolver_bench_first_call first_call(handle, iter);
         CHECK_ROCBLAS_ERROR(rocsolver_larfb(handle, side, trans, direct, storev, m, n, k, dV.data(),
                                             ldv, dT.data(), ldt, dA.data(), lda));
     }
@@ -351,7 +352,7 @@ void larfb_getPerfData(const rocblas_handle handle,
     // gpu-lapack performance
     hipStream_t stream;
     CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
-    double start;
+    rocsolver_bench_timer timer(stream, hot_calls);
 
     if(profile > 0)
     {
@@ -363,15 +364,15 @@ void larfb_getPerfData(const rocblas_handle handle,
         rocsolver_log_set_max_levels(profile);
     }
 
-    for(int iter = 0; iter < hot_calls; iter++)
+    for(int iter = 0; iter < timer.calls(); iter++)
     {
         larfb_initData<false, true, T>(handle, side, trans, direct, storev, m, n, k, dV, ldv, dT,
                                        ldt, dA, lda, hV, hT, hA, hW, sizeW);
 
-        start = get_time_us_sync(stream);
+        timer.start(iter);
         rocsolver_larfb(handle, side, trans, direct, storev, m, n, k, dV.data(), ldv, dT.data(),
                         ldt, dA.data(), lda);
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        *gpu_time_used += timer.stop(iter);
     }
     *gpu_time_used /= hot_calls;
 }
@@ -299,6 +299,7 @@ void lasyf_getPerfData(const rocblas_handle handle,
     {
         lasyf_initData<false, true, T>(handle, n, dA, lda, hA, singular);
 
+        rocsolver_bench_first_call first_call(handle, iter);
         CHECK_ROCBLAS_ERROR(rocsolver_lasyf(handle, uplo, n, nb, dKB.data(), dA.data(), lda,
                                             dIpiv.data(), dInfo.data()));
     }
@@ -306,7 +307,7 @@ void lasyf_getPerfData(const rocblas_handle handle,
     // gpu-lapack performance
     hipStream_t stream;
     CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
-    double start;
+    rocsolver_bench_timer timer(stream, hot_calls);
 
     if(profile > 0)
     {
@@ -318,13 +319,13 @@ void lasyf_getPerfData(const rocblas_handle handle,
         rocsolver_log_set_max_levels(profile);
     }
 
-    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    for(rocblas_int iter = 0; iter < timer.calls(); iter++)
     {
         lasyf_initData<false, true, T>(handle, n, dA, lda, hA, singular);
 
-        start = get_time_us_sync(stream);
+        timer.start(iter);
         rocsolver_lasyf(handle, uplo, n, nb, dKB.data(), dA.data(), lda, dIpiv.data(), dInfo.data());
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        *gpu_time_used += timer.stop(iter);
     }
     *gpu_time_used /= hot_calls;
 }
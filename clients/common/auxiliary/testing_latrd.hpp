@@ -248,6 +248,7 @@ void latrd_getPerfData(const rocblas_handle handle,
     {
         latrd_initData<false, true, T>(handle, n, dA, lda, hA);
 
+        rocsolver_bench_first_call first_call(handle, iter);
         CHECK_ROCBLAS_ERROR(rocsolver_latrd(handle, uplo, n, k, dA.data(), lda, dE.data(),
                                             dTau.data(), dW.data(), ldw));
     }
@@ -255,7 +256,7 @@ void latrd_getPerfData(const rocblas_handle handle,
     // gpu-lapack performance
     hipStream_t stream;
     CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
-    double start;
+    rocsolver_bench_timer timer(stream, hot_calls);
 
     if(profile > 0)
     {
@@ -267,13 +268,13 @@ void latrd_getPerfData(const rocblas_handle handle,
         rocsolver_log_set_max_levels(profile);
     }
 
-    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    for(rocblas_int iter = 0; iter < timer.calls(); iter++)
     {
         latrd_initData<false, true, T>(handle, n, dA, lda, hA);
 
-        start = get_time_us_sync(stream);
+        timer.start(iter);
         rocsolver_latrd(handle, uplo, n, k, dA.data(), lda, dE.data(), dTau.data(), dW.data(), ldw);
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        *gpu_time_used += timer.stop(iter);
     }
     *gpu_time_used /= hot_calls;
 }
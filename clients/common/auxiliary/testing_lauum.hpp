@@ -158,13 +158,14 @@ void lauum_getPerfData(const rocblas_handle handle,
     {
         lauum_initData<false, true, T>(handle, uplo, n, dA, lda, hA);
 
+        rocsolver_bench_first_call first_call(handle, iter);
         CHECK_ROCBLAS_ERROR(rocsolver_lauum(handle, uplo, n, dA.data(), lda));
     }
 
     // gpu-lapack performance
     hipStream_t stream;
     CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
-    double start;
+    rocsolver_bench_timer timer(stream, hot_calls);
 
     if(profile > 0)
     {
@@ -176,13 +177,13 @@ void lauum_getPerfData(const rocblas_handle handle,
         rocsolver_log_set_max_levels(profile);
     }
 
-    for(int iter = 0; iter < hot_calls; iter++)
+    for(int iter = 0; iter < timer.calls(); iter++)
     {
         lauum_initData<false, true, T>(handle, uplo, n, dA, lda, hA);
 
-        start = get_time_us_sync(stream);
+        timer.start(iter);
         rocsolver_lauum(handle, uplo, n, dA.data(), lda);
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        *gpu_time_used += timer.stop(iter);
     }
     *gpu_time_used /= hot_calls;
 }
@@ -0,0 +1,345 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "common/auxiliary/testing_orgxr_ungxr.hpp"
+
+template <typename T>
+void orgqr_ungqr_outofplace_checkBadArgs(const rocblas_handle handle,
+                                         const rocblas_int m,
+                                         const rocblas_int n,
+                                         const rocblas_int k,
+                                         T dA,
+                                         const rocblas_int lda,
+                                         T dIpiv,
+                                         T dQ,
+                                         const rocblas_int ldq)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_orgqr_ungqr_outofplace(nullptr, m, n, k, dA, lda, dIpiv, dQ, ldq),
+        rocblas_status_invalid_handle);
+
+    // values
+    // N/A
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_orgqr_ungqr_outofplace(handle, m, n, k, (T) nullptr, lda, dIpiv, dQ, ldq),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_orgqr_ungqr_outofplace(handle, m, n, k, dA, lda, (T) nullptr, dQ, ldq),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_orgqr_ungqr_outofplace(handle, m, n, k, dA, lda, dIpiv, (T) nullptr, ldq),
+        rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_orgqr_ungqr_outofplace(handle, 0, 0, 0, (T) nullptr, lda,
+                                                           (T) nullptr, (T) nullptr, ldq),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(rocsolver_orgqr_ungqr_outofplace(handle, m, 0, 0, (T) nullptr, lda,
+                                                           (T) nullptr, (T) nullptr, ldq),
+                          rocblas_status_success);
+}
+
+template <typename T>
+void testing_orgqr_ungqr_outofplace_bad_arg()
+{
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_int k = 1;
+    rocblas_int m = 1;
+    rocblas_int n = 1;
+    rocblas_int lda = 1;
+    rocblas_int ldq = 1;
+
+    // memory allocation
+    device_strided_batch_vector<T> dA(1, 1, 1, 1);
+    device_strided_batch_vector<T> dIpiv(1, 1, 1, 1);
+    device_strided_batch_vector<T> dQ(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dIpiv.memcheck());
+    CHECK_HIP_ERROR(dQ.memcheck());
+
+    // check bad arguments
+    orgqr_ungqr_outofplace_checkBadArgs(handle, m, n, k, dA.data(), lda, dIpiv.data(), dQ.data(),
+                                        ldq);
+}
+
+template <typename T, typename Td, typename Th>
+void orgqr_ungqr_outofplace_getError(const rocblas_handle handle,
+                                     const rocblas_int m,
+                                     const rocblas_int n,
+                                     const rocblas_int k,
+                                     Td& dA,
+                                     const rocblas_int lda,
+                                     Td& dIpiv,
+                                     Td& dQ,
+                                     const rocblas_int ldq,
+                                     Th& hA,
+                                     Th& hAr,
+                                     Th& hQr,
+                                     Th& hIpiv,
+                                     double* max_err)
+{
+    size_t size_W = size_t(n);
+    std::vector<T> hW(size_W);
+
+    // initialize data (the reflectors are generated as for ORGQR/UNGQR)
+    orgxr_ungxr_initData<true, true, T>(handle, m, n, k, dA, lda, dIpiv, hA, hIpiv, hW, size_W);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_orgqr_ungqr_outofplace(handle, m, n, k, dA.data(), lda,
+                                                         dIpiv.data(), dQ.data(), ldq));
+    CHECK_HIP_ERROR(hAr.transfer_from(dA));
+    CHECK_HIP_ERROR(hQr.transfer_from(dQ));
+
+    // A must be left unchanged
+    double err = norm_error('F', m, n, lda, hA[0], hAr[0]);
+
+    // CPU lapack
+    cpu_orgqr_ungqr(m, n, k, hA[0], lda, hIpiv[0], hW.data(), size_W);
+
+    // error is ||hA - hQr|| / ||hA||
+    // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
+    // IT MIGHT BE REVISITED IN THE FUTURE)
+    // using frobenius norm
+    *max_err = norm_error('F', m, n, lda, hA[0], hQr[0], ldq);
+    *max_err = err > *max_err ? err : *max_err;
+}
+
+template <typename T, typename Td, typename Th>
+void orgqr_ungqr_outofplace_getPerfData(const rocblas_handle handle,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        const rocblas_int k,
+                                        Td& dA,
+                                        const rocblas_int lda,
+                                        Td& dIpiv,
+                                        Td& dQ,
+                                        const rocblas_int ldq,
+                                        Th& hA,
+                                        Th& hIpiv,
+                                        double* gpu_time_used,
+                                        double* cpu_time_used,
+                                        const rocblas_int hot_calls,
+                                        const int profile,
+                                        const bool profile_kernels,
+                                        const bool perf)
+{
+    size_t size_W = size_t(n);
+    std::vector<T> hW(size_W);
+
+    if(!perf)
+    {
+        orgxr_ungxr_initData<true, false, T>(handle, m, n, k, dA, lda, dIpiv, hA, hIpiv, hW, size_W);
+
+        // cpu-lapack performance (only if not in perf mode)
+        *cpu_time_used = get_time_us_no_sync();
+        cpu_orgqr_ungqr(m, n, k, hA[0], lda, hIpiv[0], hW.data(), size_W);
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    // A is not overwritten, so it is only transferred once
+    orgxr_ungxr_initData<true, true, T>(handle, m, n, k, dA, lda, dIpiv, hA, hIpiv, hW, size_W);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        rocsolver_bench_first_call first_call(handle, iter);
+        CHECK_ROCBLAS_ERROR(rocsolver_orgqr_ungqr_outofplace(handle, m, n, k, dA.data(), lda,
+                                                             dIpiv.data(), dQ.data(), ldq));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    rocsolver_bench_timer timer(stream, hot_calls);
+
+    if(profile > 0)
+    {
+        if(profile_kernels)
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile
+                                         | rocblas_layer_mode_ex_log_kernel);
+        else
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile);
+        rocsolver_log_set_max_levels(profile);
+    }
+
+    for(int iter = 0; iter < timer.calls(); iter++)
+    {
+        timer.start(iter);
+        rocsolver_orgqr_ungqr_outofplace(handle, m, n, k, dA.data(), lda, dIpiv.data(), dQ.data(),
+                                         ldq);
+        *gpu_time_used += timer.stop(iter);
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <typename T>
+void testing_orgqr_ungqr_outofplace(Arguments& argus)
+{
+    // get arguments
+    rocblas_local_handle handle;
+    rocblas_int n = argus.get<rocblas_int>("n");
+    rocblas_int m = argus.get<rocblas_int>("m", n);
+    rocblas_int k = argus.get<rocblas_int>("k", n);
+    rocblas_int lda = argus.get<rocblas_int>("lda", m);
+    rocblas_int ldq = argus.get<rocblas_int>("ldq", m);
+
+    rocblas_int hot_calls = argus.iters;
+
+    // check non-supported values
+    // N/A
+
+    // determine sizes
+    size_t size_A = size_t(lda) * n;
+    size_t size_Q = size_t(ldq) * n;
+    size_t size_P = size_t(n);
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_Ar = (argus.unit_check || argus.norm_check) ? size_A : 0;
+    size_t size_Qr = (argus.unit_check || argus.norm_check) ? size_Q : 0;
+
+    // check invalid sizes
+    bool invalid_size = (m < 0 || n < 0 || k < 0 || lda < m || ldq < m || n > m || k > n);
+    if(invalid_size)
+    {
+        EXPECT_ROCBLAS_STATUS(rocsolver_orgqr_ungqr_outofplace(handle, m, n, k, (T*)nullptr, lda,
+                                                               (T*)nullptr, (T*)nullptr, ldq),
+                              rocblas_status_invalid_size);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_size);
+
+        return;
+    }
+
+    // memory size query is necessary
+    if(argus.mem_query || !USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        CHECK_ALLOC_QUERY(rocsolver_orgqr_ungqr_outofplace(handle, m, n, k, (T*)nullptr, lda,
+                                                           (T*)nullptr, (T*)nullptr, ldq));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        if(argus.mem_query)
+        {
+            rocsolver_bench_inform(inform_mem_query, size);
+            return;
+        }
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    // memory allocations
+    host_strided_batch_vector<T> hA(size_A, 1, size_A, 1);
+    host_strided_batch_vector<T> hAr(size_Ar, 1, size_Ar, 1);
+    host_strided_batch_vector<T> hQr(size_Qr, 1, size_Qr, 1);
+    host_strided_batch_vector<T> hIpiv(size_P, 1, size_P, 1);
+    device_strided_batch_vector<T> dA(size_A, 1, size_A, 1);
+    device_strided_batch_vector<T> dIpiv(size_P, 1, size_P, 1);
+    device_strided_batch_vector<T> dQ(size_Q, 1, size_Q, 1);
+    if(size_A)
+        CHECK_HIP_ERROR(dA.memcheck());
+    if(size_P)
+        CHECK_HIP_ERROR(dIpiv.memcheck());
+    if(size_Q)
+        CHECK_HIP_ERROR(dQ.memcheck());
+
+    // check quick return
+    if(n == 0 || m == 0)
+    {
+        EXPECT_ROCBLAS_STATUS(rocsolver_orgqr_ungqr_outofplace(handle, m, n, k, dA.data(), lda,
+                                                               dIpiv.data(), dQ.data(), ldq),
+                              rocblas_status_success);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_quick_return);
+
+        return;
+    }
+
+    // check computations
+    if(argus.unit_check || argus.norm_check)
+        orgqr_ungqr_outofplace_getError<T>(handle, m, n, k, dA, lda, dIpiv, dQ, ldq, hA, hAr, hQr,
+                                           hIpiv, &max_error);
+
+    // collect performance data
+    if(argus.timing)
+        orgqr_ungqr_outofplace_getPerfData<T>(handle, m, n, k, dA, lda, dIpiv, dQ, ldq, hA, hIpiv,
+                                              &gpu_time_used, &cpu_time_used, hot_calls,
+                                              argus.profile, argus.profile_kernels, argus.perf);
+
+    // validate results for rocsolver-test
+    // using m * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, m);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            rocsolver_bench_header("Arguments:");
+            rocsolver_bench_output("m", "n", "k", "lda", "ldq");
+            rocsolver_bench_output(m, n, k, lda, ldq);
+
+            rocsolver_bench_header("Results:");
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_bench_endl();
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
+
+#define EXTERN_TESTING_ORGQR_UNGQR_OUTOFPLACE(...) \
+    extern template void testing_orgqr_ungqr_outofplace<__VA_ARGS__>(Arguments&);
+
+INSTANTIATE(EXTERN_TESTING_ORGQR_UNGQR_OUTOFPLACE, FOREACH_SCALAR_TYPE, APPLY_STAMP)
@@ -259,6 +259,7 @@ void ormtr_unmtr_getPerfData(const rocblas_handle handle,
         ormtr_unmtr_initData<false, true, T>(handle, side, uplo, trans, m, n, dA, lda, dIpiv, dC,
                                              ldc, hA, hIpiv, hC, hW, size_W);
 
+        rocsolver_bench_first_call first_call(handle, iter);
         CHECK_ROCBLAS_ERROR(rocsolver_ormtr_unmtr(handle, side, uplo, trans, m, n, dA.data(), lda,
                                                   dIpiv.data(), dC.data(), ldc));
     }
@@ -266,7 +267,7 @@ void ormtr_unmtr_getPerfData(const rocblas_handle handle,
     // gpu-lapack performance
     hipStream_t stream;
     CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
-    double start;
+    rocsolver_bench_timer timer(stream, hot_calls);
 
     if(profile > 0)
     {
@@ -278,15 +279,15 @@ void ormtr_unmtr_getPerfData(const rocblas_handle handle,
         rocsolver_log_set_max_levels(profile);
     }
 
-    for(int iter = 0; iter < hot_calls; iter++)
+    for(int iter = 0; iter < timer.calls(); iter++)
     {
         ormtr_unmtr_initData<false, true, T>(handle, side, uplo, trans, m, n, dA, lda, dIpiv, dC,
                                              ldc, hA, hIpiv, hC, hW, size_W);
 
-        start = get_time_us_sync(stream);
+        timer.start(iter);
         rocsolver_ormtr_unmtr(handle, side, uplo, trans, m, n, dA.data(), lda, dIpiv.data(),
                               dC.data(), ldc);
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        *gpu_time_used += timer.stop(iter);
     }
     *gpu_time_used /= hot_calls;
 }
@@ -331,6 +331,7 @@ void stebz_getPerfData(const rocblas_handle handle,
     {
         stebz_initData<false, true, T>(handle, n, dD, dE, hD, hE);
 
+        rocsolver_bench_first_call first_call(handle, iter);
         CHECK_ROCBLAS_ERROR(rocsolver_stebz(handle, erange, eorder, n, vl, vu, il, iu, abstol,
                                             dD.data(), dE.data(), dnev.data(), dnsplit.data(),
                                             dW.data(), dIblock.data(), dIsplit.data(), dinfo.data()));
@@ -339,7 +340,7 @@ void stebz_getPerfData(const rocblas_handle handle,
     // gpu-lapack performance
     hipStream_t stream;
     CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
-    double start;
+    rocsolver_bench_timer timer(stream, hot_calls);
 
     if(profile > 0)
     {
@@ -351,15 +352,15 @@ void stebz_getPerfData(const rocblas_handle handle,
         rocsolver_log_set_max_levels(profile);
     }
 
-    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    for(rocblas_int iter = 0; iter < timer.calls(); iter++)
     {
         stebz_initData<false, true, T>(handle, n, dD, dE, hD, hE);
 
-        start = get_time_us_sync(stream);
+        timer.start(iter);
         rocsolver_stebz(handle, erange, eorder, n, vl, vu, il, iu, abstol, dD.data(), dE.data(),
                         dnev.data(), dnsplit.data(), dW.data(), dIblock.data(), dIsplit.data(),
                         dinfo.data());
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        *gpu_time_used += timer.stop(iter);
     }
     *gpu_time_used /= hot_calls;
 }
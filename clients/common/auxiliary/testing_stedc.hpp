@@ -29,6 +29,7 @@
 
 #include "common/misc/client_util.hpp"
 #include "common/misc/clientcommon.hpp"
+#include "common/misc/device_data_initializer.hpp"
 #include "common/misc/lapack_host_reference.hpp"
 #include "common/misc/norm.hpp"
 #include "common/misc/rocsolver.hpp"
@@ -108,7 +109,7 @@ void stedc_initData(const rocblas_handle handle,
                     Th& hC,
                     Uh& hInfo)
 {
-    if(CPU)
+    if(CPU && !rocsolver_bench_device_init)
     {
         using S = decltype(std::real(T{}));
 
@@ -231,12 +232,28 @@ void stedc_initData(const rocblas_handle handle,
 
     if(GPU)
     {
-        // now copy to the GPU
-        CHECK_HIP_ERROR(dD.transfer_from(hD));
-        CHECK_HIP_ERROR(dE.transfer_from(hE));
+        if(rocsolver_bench_device_init)
+        {
+            // generate a random tridiagonal matrix (and the identity C) directly on the GPU
+            using S = decltype(std::real(T{}));
+            hipStream_t stream;
+            CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+            device_init_tridiagonal<S>(n, dD.data(), dD.stride(), dE.data(), dE.stride(), 1,
+                                       stream);
+
+            if(evect == rocblas_evect_original)
+                device_init_matrix<T>(device_init_identity, n, n, dC.data(), ldc, dC.stride(), 1,
+                                      stream);
+        }
+        else
+        {
+            // now copy to the GPU
+            CHECK_HIP_ERROR(dD.transfer_from(hD));
+            CHECK_HIP_ERROR(dE.transfer_from(hE));
 
-        if(evect == rocblas_evect_original)
-            CHECK_HIP_ERROR(dC.transfer_from(hC));
+            if(evect == rocblas_evect_original)
+                CHECK_HIP_ERROR(dC.transfer_from(hC));
+        }
     }
 }
 
@@ -376,11 +393,16 @@ void stedc_getPerfData(const rocblas_handle handle,
     size_t lwork = (COMPLEX) ? n * n : 0;
     size_t lrwork = (evect == rocblas_evect_none || n <= 1) ? 1 : 1 + 3 * n + 4 * n * n + 2 * n * lgn;
     size_t liwork = (evect == rocblas_evect_none || n <= 1) ? 1 : 6 + 6 * n + 5 * n * lgn;
+
+    // the cpu-lapack workspace is not needed if the input data is generated on the device
+    if(rocsolver_bench_device_init)
+        lwork = lrwork = liwork = 0;
+
     std::vector<T> work(lwork);
     std::vector<S> rwork(lrwork);
     std::vector<rocblas_int> iwork(liwork);
 
-    if(!perf)
+    if(!perf && !rocsolver_bench_device_init)
     {
         stedc_initData<true, false, T>(handle, evect, n, dD, dE, dC, ldc, dInfo, hD, hE, hC, hInfo);
 
@@ -390,6 +412,8 @@ void stedc_getPerfData(const rocblas_handle handle,
                   iwork.data(), liwork, hInfo[0]);
         *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
     }
+    else if(rocsolver_bench_device_init)
+        *cpu_time_used = nan(""); // no host data for cpu-lapack execution
 
     stedc_initData<true, false, T>(handle, evect, n, dD, dE, dC, ldc, dInfo, hD, hE, hC, hInfo);
 
@@ -398,6 +422,7 @@ void stedc_getPerfData(const rocblas_handle handle,
     {
         stedc_initData<false, true, T>(handle, evect, n, dD, dE, dC, ldc, dInfo, hD, hE, hC, hInfo);
 
+        rocsolver_bench_first_call first_call(handle, iter);
         CHECK_ROCBLAS_ERROR(
             rocsolver_stedc(handle, evect, n, dD.data(), dE.data(), dC.data(), ldc, dInfo.data()));
     }
@@ -405,7 +430,7 @@ void stedc_getPerfData(const rocblas_handle handle,
     // gpu-lapack performance
     hipStream_t stream;
     CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
-    double start;
+    rocsolver_bench_timer timer(stream, hot_calls);
 
     if(profile > 0)
     {
@@ -417,13 +442,13 @@ void stedc_getPerfData(const rocblas_handle handle,
         rocsolver_log_set_max_levels(profile);
     }
 
-    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    for(rocblas_int iter = 0; iter < timer.calls(); iter++)
     {
         stedc_initData<false, true, T>(handle, evect, n, dD, dE, dC, ldc, dInfo, hD, hE, hC, hInfo);
 
-        start = get_time_us_sync(stream);
+        timer.start(iter);
         rocsolver_stedc(handle, evect, n, dD.data(), dE.data(), dC.data(), ldc, dInfo.data());
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        *gpu_time_used += timer.stop(iter);
     }
     *gpu_time_used /= hot_calls;
 }
@@ -455,6 +480,9 @@ void testing_stedc(Arguments& argus)
     size_t size_ERes = (argus.unit_check || argus.norm_check) ? size_E : 0;
     size_t size_CRes = (argus.unit_check || argus.norm_check) ? size_C : 0;
 
+    // the host copy of C is not needed if the input data is generated on the device
+    size_t size_hC = rocsolver_bench_device_init ? 0 : size_C;
+
     // check invalid sizes
     bool invalid_size = (n < 0 || (evect != rocblas_evect_none && ldc < n));
     if(invalid_size)
@@ -492,7 +520,7 @@ void testing_stedc(Arguments& argus)
     host_strided_batch_vector<S> hDRes(size_DRes, 1, size_DRes, 1);
     host_strided_batch_vector<S> hE(size_E, 1, size_E, 1);
     host_strided_batch_vector<S> hERes(size_ERes, 1, size_ERes, 1);
-    host_strided_batch_vector<T> hC(size_C, 1, size_C, 1);
+    host_strided_batch_vector<T> hC(size_hC, 1, size_hC, 1);
     host_strided_batch_vector<T> hCRes(size_CRes, 1, size_CRes, 1);
     host_strided_batch_vector<rocblas_int> hInfo(1, 1, 1, 1);
     host_strided_batch_vector<rocblas_int> hInfoRes(1, 1, 1, 1);
@@ -175,13 +175,14 @@ void sterf_getPerfData(const rocblas_handle handle,
     {
         sterf_initData<false, true, T>(handle, n, dD, dE, dInfo, hD, hE, hInfo);
 
+        rocsolver_bench_first_call first_call(handle, iter);
         CHECK_ROCBLAS_ERROR(rocsolver_sterf(handle, n, dD.data(), dE.data(), dInfo.data()));
     }
 
     // gpu-lapack performance
     hipStream_t stream;
     CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
-    double start;
+    rocsolver_bench_timer timer(stream, hot_calls);
 
     if(profile > 0)
     {
@@ -193,13 +194,13 @@ void sterf_getPerfData(const rocblas_handle handle,
         rocsolver_log_set_max_levels(profile);
     }
 
-    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    for(rocblas_int iter = 0; iter < timer.calls(); iter++)
     {
         sterf_initData<false, true, T>(handle, n, dD, dE, dInfo, hD, hE, hInfo);
 
-        start = get_time_us_sync(stream);
+        timer.start(iter);
         rocsolver_sterf(handle, n, dD.data(), dE.data(), dInfo.data());
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        *gpu_time_used += timer.stop(iter);
     }
     *gpu_time_used /= hot_calls;
 }
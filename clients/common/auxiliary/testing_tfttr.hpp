@@ -0,0 +1,350 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "common/misc/client_util.hpp"
+#include "common/misc/clientcommon.hpp"
+#include "common/misc/lapack_host_reference.hpp"
+#include "common/misc/norm.hpp"
+#include "common/misc/rocsolver.hpp"
+#include "common/misc/rocsolver_arguments.hpp"
+#include "common/misc/rocsolver_test.hpp"
+
+template <typename T>
+void tfttr_checkBadArgs(const rocblas_handle handle,
+                        const rocblas_operation transr,
+                        const rocblas_fill uplo,
+                        const rocblas_int n,
+                        T ARF,
+                        T A,
+                        const rocblas_int lda)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_tfttr(nullptr, transr, uplo, n, ARF, A, lda),
+                          rocblas_status_invalid_handle);
+
+    // values
+    EXPECT_ROCBLAS_STATUS(rocsolver_tfttr(handle, rocblas_operation(0), uplo, n, ARF, A, lda),
+                          rocblas_status_invalid_value);
+    EXPECT_ROCBLAS_STATUS(rocsolver_tfttr(handle, transr, rocblas_fill_full, n, ARF, A, lda),
+                          rocblas_status_invalid_value);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_tfttr(handle, transr, uplo, n, (T) nullptr, A, lda),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_tfttr(handle, transr, uplo, n, ARF, (T) nullptr, lda),
+                          rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_tfttr(handle, transr, uplo, 0, (T) nullptr, (T) nullptr, lda),
+                          rocblas_status_success);
+}
+
+template <typename T>
+void testing_tfttr_bad_arg()
+{
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_operation transr = rocblas_operation_none;
+    rocblas_fill uplo = rocblas_fill_upper;
+    rocblas_int n = 1;
+    rocblas_int lda = 1;
+
+    // memory allocation
+    device_strided_batch_vector<T> dARF(1, 1, 1, 1);
+    device_strided_batch_vector<T> dA(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dARF.memcheck());
+    CHECK_HIP_ERROR(dA.memcheck());
+
+    // check bad arguments
+    tfttr_checkBadArgs(handle, transr, uplo, n, dARF.data(), dA.data(), lda);
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Th>
+void tfttr_initData(const rocblas_handle handle,
+                    const rocblas_operation transr,
+                    const rocblas_fill uplo,
+                    const rocblas_int n,
+                    Td& dARF,
+                    Td& dA,
+                    const rocblas_int lda,
+                    Th& hARF,
+                    Th& hA)
+{
+    if(CPU)
+    {
+        rocblas_init<T>(hARF, true);
+        // the opposite triangle of A must stay untouched
+        rocblas_init<T>(hA, false);
+    }
+
+    if(GPU)
+    {
+        // copy data from CPU to device
+        CHECK_HIP_ERROR(dARF.transfer_from(hARF));
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+    }
+}
+
+template <typename T, typename Td, typename Th>
+void tfttr_getError(const rocblas_handle handle,
+                    const rocblas_operation transr,
+                    const rocblas_fill uplo,
+                    const rocblas_int n,
+                    Td& dARF,
+                    Td& dA,
+                    const rocblas_int lda,
+                    Th& hARF,
+                    Th& hA,
+                    Th& hARes,
+                    double* max_err)
+{
+    // initialize data
+    tfttr_initData<true, true, T>(handle, transr, uplo, n, dARF, dA, lda, hARF, hA);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_tfttr(handle, transr, uplo, n, dARF.data(), dA.data(), lda));
+    CHECK_HIP_ERROR(hARes.transfer_from(dA));
+
+    // CPU lapack
+    cpu_tfttr<T>(transr, uplo, n, hARF[0], hA[0], lda);
+
+    // error is ||hA - hARes|| / ||hA||
+    // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
+    // IT MIGHT BE REVISITED IN THE FUTURE)
+    // using frobenius norm over the whole matrix (it should be a plain copy)
+    *max_err = norm_error('F', n, n, lda, hA[0], hARes[0]);
+}
+
+template <typename T, typename Td, typename Th>
+void tfttr_getPerfData(const rocblas_handle handle,
+                       const rocblas_operation transr,
+                       const rocblas_fill uplo,
+                       const rocblas_int n,
+                       Td& dARF,
+                       Td& dA,
+                       const rocblas_int lda,
+                       Th& hARF,
+                       Th& hA,
+                       double* gpu_time_used,
+                       double* cpu_time_used,
+                       const rocblas_int hot_calls,
+                       const int profile,
+                       const bool profile_kernels,
+                       const bool perf)
+{
+    if(!perf)
+    {
+        tfttr_initData<true, false, T>(handle, transr, uplo, n, dARF, dA, lda, hARF, hA);
+
+        // cpu-lapack performance (only if not in perf mode)
+        *cpu_time_used = get_time_us_no_sync();
+        cpu_tfttr<T>(transr, uplo, n, hARF[0], hA[0], lda);
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    tfttr_initData<true, false, T>(handle, transr, uplo, n, dARF, dA, lda, hARF, hA);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        tfttr_initData<false, true, T>(handle, transr, uplo, n, dARF, dA, lda, hARF, hA);
+
+        rocsolver_bench_first_call first_call(handle, iter);
+        CHECK_ROCBLAS_ERROR(rocsolver_tfttr(handle, transr, uplo, n, dARF.data(), dA.data(), lda));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    rocsolver_bench_timer timer(stream, hot_calls);
+
+    if(profile > 0)
+    {
+        if(profile_kernels)
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile
+                                         | rocblas_layer_mode_ex_log_kernel);
+        else
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile);
+        rocsolver_log_set_max_levels(profile);
+    }
+
+    for(int iter = 0; iter < timer.calls(); iter++)
+    {
+        tfttr_initData<false, true, T>(handle, transr, uplo, n, dARF, dA, lda, hARF, hA);
+
+        timer.start(iter);
+        rocsolver_tfttr(handle, transr, uplo, n, dARF.data(), dA.data(), lda);
+        *gpu_time_used += timer.stop(iter);
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <typename T>
+void testing_tfttr(Arguments& argus)
+{
+    // get arguments
+    rocblas_local_handle handle;
+    char transrC = argus.get<char>("transr");
+    char uploC = argus.get<char>("uplo");
+    rocblas_int n = argus.get<rocblas_int>("n");
+    rocblas_int lda = argus.get<rocblas_int>("lda", n);
+
+    rocblas_int hot_calls = argus.iters;
+    rocblas_operation transr = char2rocblas_operation(transrC);
+    rocblas_fill uplo = char2rocblas_fill(uploC);
+
+    // check non-supported values
+    if((uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+       || (rocblas_is_complex<T> && transr == rocblas_operation_transpose)
+       || (!rocblas_is_complex<T> && transr == rocblas_operation_conjugate_transpose))
+    {
+        EXPECT_ROCBLAS_STATUS(
+            rocsolver_tfttr(handle, transr, uplo, n, (T*)nullptr, (T*)nullptr, lda),
+            rocblas_status_invalid_value);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_args);
+
+        return;
+    }
+
+    // determine sizes
+    size_t size_ARF = size_t(n) * (n + 1) / 2;
+    size_t size_A = size_t(n) * lda;
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    // check invalid sizes
+    bool invalid_size = (n < 0 || lda < n);
+    if(invalid_size)
+    {
+        EXPECT_ROCBLAS_STATUS(
+            rocsolver_tfttr(handle, transr, uplo, n, (T*)nullptr, (T*)nullptr, lda),
+            rocblas_status_invalid_size);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_size);
+
+        return;
+    }
+
+    // memory size query is necessary
+    if(argus.mem_query || !USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        CHECK_ALLOC_QUERY(rocsolver_tfttr(handle, transr, uplo, n, (T*)nullptr, (T*)nullptr, lda));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        if(argus.mem_query)
+        {
+            rocsolver_bench_inform(inform_mem_query, size);
+            return;
+        }
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    // memory allocations
+    host_strided_batch_vector<T> hARF(size_ARF, 1, size_ARF, 1);
+    host_strided_batch_vector<T> hA(size_A, 1, size_A, 1);
+    host_strided_batch_vector<T> hARes(size_A, 1, size_A, 1);
+    device_strided_batch_vector<T> dARF(size_ARF, 1, size_ARF, 1);
+    device_strided_batch_vector<T> dA(size_A, 1, size_A, 1);
+
+    if(size_ARF)
+        CHECK_HIP_ERROR(dARF.memcheck());
+    if(size_A)
+        CHECK_HIP_ERROR(dA.memcheck());
+
+    // check quick return
+    if(n == 0)
+    {
+        EXPECT_ROCBLAS_STATUS(rocsolver_tfttr(handle, transr, uplo, n, dARF.data(), dA.data(), lda),
+                              rocblas_status_success);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_quick_return);
+
+        return;
+    }
+
+    // check computations
+    if(argus.unit_check || argus.norm_check)
+        tfttr_getError<T>(handle, transr, uplo, n, dARF, dA, lda, hARF, hA, hARes, &max_error);
+
+    // collect performance data
+    if(argus.timing)
+        tfttr_getPerfData<T>(handle, transr, uplo, n, dARF, dA, lda, hARF, hA, &gpu_time_used,
+                             &cpu_time_used, hot_calls, argus.profile, argus.profile_kernels,
+                             argus.perf);
+
+    // validate results for rocsolver-test
+    // no computations are done, the result must be exact
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, 0);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            rocsolver_bench_header("Arguments:");
+            rocsolver_bench_output("transr", "uplo", "n", "lda");
+            rocsolver_bench_output(transrC, uploC, n, lda);
+
+            rocsolver_bench_header("Results:");
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_bench_endl();
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
+
+#define EXTERN_TESTING_TFTTR(...) extern template void testing_tfttr<__VA_ARGS__>(Arguments&);
+
+INSTANTIATE(EXTERN_TESTING_TFTTR, FOREACH_SCALAR_TYPE, APPLY_STAMP)
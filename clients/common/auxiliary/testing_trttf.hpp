@@ -0,0 +1,346 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "common/misc/client_util.hpp"
+#include "common/misc/clientcommon.hpp"
+#include "common/misc/lapack_host_reference.hpp"
+#include "common/misc/norm.hpp"
+#include "common/misc/rocsolver.hpp"
+#include "common/misc/rocsolver_arguments.hpp"
+#include "common/misc/rocsolver_test.hpp"
+
+template <typename T>
+void trttf_checkBadArgs(const rocblas_handle handle,
+                        const rocblas_operation transr,
+                        const rocblas_fill uplo,
+                        const rocblas_int n,
+                        T A,
+                        const rocblas_int lda,
+                        T ARF)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_trttf(nullptr, transr, uplo, n, A, lda, ARF),
+                          rocblas_status_invalid_handle);
+
+    // values
+    EXPECT_ROCBLAS_STATUS(rocsolver_trttf(handle, rocblas_operation(0), uplo, n, A, lda, ARF),
+                          rocblas_status_invalid_value);
+    EXPECT_ROCBLAS_STATUS(rocsolver_trttf(handle, transr, rocblas_fill_full, n, A, lda, ARF),
+                          rocblas_status_invalid_value);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_trttf(handle, transr, uplo, n, (T) nullptr, lda, ARF),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_trttf(handle, transr, uplo, n, A, lda, (T) nullptr),
+                          rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_trttf(handle, transr, uplo, 0, (T) nullptr, lda, (T) nullptr),
+                          rocblas_status_success);
+}
+
+template <typename T>
+void testing_trttf_bad_arg()
+{
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_operation transr = rocblas_operation_none;
+    rocblas_fill uplo = rocblas_fill_upper;
+    rocblas_int n = 1;
+    rocblas_int lda = 1;
+
+    // memory allocation
+    device_strided_batch_vector<T> dA(1, 1, 1, 1);
+    device_strided_batch_vector<T> dARF(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dARF.memcheck());
+
+    // check bad arguments
+    trttf_checkBadArgs(handle, transr, uplo, n, dA.data(), lda, dARF.data());
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Th>
+void trttf_initData(const rocblas_handle handle,
+                    const rocblas_operation transr,
+                    const rocblas_fill uplo,
+                    const rocblas_int n,
+                    Td& dA,
+                    const rocblas_int lda,
+                    Th& hA)
+{
+    if(CPU)
+    {
+        rocblas_init<T>(hA, true);
+    }
+
+    if(GPU)
+    {
+        // copy data from CPU to device
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+    }
+}
+
+template <typename T, typename Td, typename Th>
+void trttf_getError(const rocblas_handle handle,
+                    const rocblas_operation transr,
+                    const rocblas_fill uplo,
+                    const rocblas_int n,
+                    Td& dA,
+                    const rocblas_int lda,
+                    Td& dARF,
+                    Th& hA,
+                    Th& hARF,
+                    Th& hARFRes,
+                    double* max_err)
+{
+    // initialize data
+    trttf_initData<true, true, T>(handle, transr, uplo, n, dA, lda, hA);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_trttf(handle, transr, uplo, n, dA.data(), lda, dARF.data()));
+    CHECK_HIP_ERROR(hARFRes.transfer_from(dARF));
+
+    // CPU lapack
+    cpu_trttf<T>(transr, uplo, n, hA[0], lda, hARF[0]);
+
+    // error is ||hARF - hARFRes|| / ||hARF||
+    // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
+    // IT MIGHT BE REVISITED IN THE FUTURE)
+    // using frobenius norm over the RFP array (it should be a plain copy)
+    rocblas_int nt = n * (n + 1) / 2;
+    *max_err = norm_error('F', nt, 1, nt, hARF[0], hARFRes[0]);
+}
+
+template <typename T, typename Td, typename Th>
+void trttf_getPerfData(const rocblas_handle handle,
+                       const rocblas_operation transr,
+                       const rocblas_fill uplo,
+                       const rocblas_int n,
+                       Td& dA,
+                       const rocblas_int lda,
+                       Td& dARF,
+                       Th& hA,
+                       Th& hARF,
+                       double* gpu_time_used,
+                       double* cpu_time_used,
+                       const rocblas_int hot_calls,
+                       const int profile,
+                       const bool profile_kernels,
+                       const bool perf)
+{
+    if(!perf)
+    {
+        trttf_initData<true, false, T>(handle, transr, uplo, n, dA, lda, hA);
+
+        // cpu-lapack performance (only if not in perf mode)
+        *cpu_time_used = get_time_us_no_sync();
+        cpu_trttf<T>(transr, uplo, n, hA[0], lda, hARF[0]);
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    trttf_initData<true, false, T>(handle, transr, uplo, n, dA, lda, hA);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        trttf_initData<false, true, T>(handle, transr, uplo, n, dA, lda, hA);
+
+        rocsolver_bench_first_call first_call(handle, iter);
+        CHECK_ROCBLAS_ERROR(rocsolver_trttf(handle, transr, uplo, n, dA.data(), lda, dARF.data()));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    rocsolver_bench_timer timer(stream, hot_calls);
+
+    if(profile > 0)
+    {
+        if(profile_kernels)
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile
+                                         | rocblas_layer_mode_ex_log_kernel);
+        else
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile);
+        rocsolver_log_set_max_levels(profile);
+    }
+
+    for(int iter = 0; iter < timer.calls(); iter++)
+    {
+        trttf_initData<false, true, T>(handle, transr, uplo, n, dA, lda, hA);
+
+        timer.start(iter);
+        rocsolver_trttf(handle, transr, uplo, n, dA.data(), lda, dARF.data());
+        *gpu_time_used += timer.stop(iter);
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <typename T>
+void testing_trttf(Arguments& argus)
+{
+    // get arguments
+    rocblas_local_handle handle;
+    char transrC = argus.get<char>("transr");
+    char uploC = argus.get<char>("uplo");
+    rocblas_int n = argus.get<rocblas_int>("n");
+    rocblas_int lda = argus.get<rocblas_int>("lda", n);
+
+    rocblas_int hot_calls = argus.iters;
+    rocblas_operation transr = char2rocblas_operation(transrC);
+    rocblas_fill uplo = char2rocblas_fill(uploC);
+
+    // check non-supported values
+    if((uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+       || (rocblas_is_complex<T> && transr == rocblas_operation_transpose)
+       || (!rocblas_is_complex<T> && transr == rocblas_operation_conjugate_transpose))
+    {
+        EXPECT_ROCBLAS_STATUS(
+            rocsolver_trttf(handle, transr, uplo, n, (T*)nullptr, lda, (T*)nullptr),
+            rocblas_status_invalid_value);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_args);
+
+        return;
+    }
+
+    // determine sizes
+    size_t size_A = size_t(n) * lda;
+    size_t size_ARF = size_t(n) * (n + 1) / 2;
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    // check invalid sizes
+    bool invalid_size = (n < 0 || lda < n);
+    if(invalid_size)
+    {
+        EXPECT_ROCBLAS_STATUS(
+            rocsolver_trttf(handle, transr, uplo, n, (T*)nullptr, lda, (T*)nullptr),
+            rocblas_status_invalid_size);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_size);
+
+        return;
+    }
+
+    // memory size query is necessary
+    if(argus.mem_query || !USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        CHECK_ALLOC_QUERY(rocsolver_trttf(handle, transr, uplo, n, (T*)nullptr, lda, (T*)nullptr));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        if(argus.mem_query)
+        {
+            rocsolver_bench_inform(inform_mem_query, size);
+            return;
+        }
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    // memory allocations
+    host_strided_batch_vector<T> hA(size_A, 1, size_A, 1);
+    host_strided_batch_vector<T> hARF(size_ARF, 1, size_ARF, 1);
+    host_strided_batch_vector<T> hARFRes(size_ARF, 1, size_ARF, 1);
+    device_strided_batch_vector<T> dA(size_A, 1, size_A, 1);
+    device_strided_batch_vector<T> dARF(size_ARF, 1, size_ARF, 1);
+
+    if(size_A)
+        CHECK_HIP_ERROR(dA.memcheck());
+    if(size_ARF)
+        CHECK_HIP_ERROR(dARF.memcheck());
+
+    // check quick return
+    if(n == 0)
+    {
+        EXPECT_ROCBLAS_STATUS(rocsolver_trttf(handle, transr, uplo, n, dA.data(), lda, dARF.data()),
+                              rocblas_status_success);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_quick_return);
+
+        return;
+    }
+
+    // check computations
+    if(argus.unit_check || argus.norm_check)
+        trttf_getError<T>(handle, transr, uplo, n, dA, lda, dARF, hA, hARF, hARFRes, &max_error);
+
+    // collect performance data
+    if(argus.timing)
+        trttf_getPerfData<T>(handle, transr, uplo, n, dA, lda, dARF, hA, hARF, &gpu_time_used,
+                             &cpu_time_used, hot_calls, argus.profile, argus.profile_kernels,
+                             argus.perf);
+
+    // validate results for rocsolver-test
+    // no computations are done, the result must be exact
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, 0);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            rocsolver_bench_header("Arguments:");
+            rocsolver_bench_output("transr", "uplo", "n", "lda");
+            rocsolver_bench_output(transrC, uploC, n, lda);
+
+            rocsolver_bench_header("Results:");
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_bench_endl();
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
+
+#define EXTERN_TESTING_TRTTF(...) extern template void testing_trttf<__VA_ARGS__>(Arguments&);
+
+INSTANTIATE(EXTERN_TESTING_TRTTF, FOREACH_SCALAR_TYPE, APPLY_STAMP)
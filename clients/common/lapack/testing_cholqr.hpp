@@ -0,0 +1,533 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "common/misc/client_util.hpp"
+#include "common/misc/clientcommon.hpp"
+#include "common/misc/lapack_host_reference.hpp"
+#include "common/misc/norm.hpp"
+#include "common/misc/rocsolver.hpp"
+#include "common/misc/rocsolver_arguments.hpp"
+#include "common/misc/rocsolver_test.hpp"
+
+template <bool STRIDED, typename T, typename U>
+void cholqr_checkBadArgs(const rocblas_handle handle,
+                         const rocblas_int m,
+                         const rocblas_int n,
+                         T dA,
+                         const rocblas_int lda,
+                         const rocblas_stride stA,
+                         U dR,
+                         const rocblas_int ldr,
+                         const rocblas_stride stR,
+                         rocblas_int* dinfo,
+                         const rocblas_int bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_cholqr(STRIDED, nullptr, m, n, dA, lda, stA, dR, ldr, stR, dinfo, bc),
+        rocblas_status_invalid_handle);
+
+    // values
+    // N/A
+
+    // sizes (only check batch_count if applicable)
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(
+            rocsolver_cholqr(STRIDED, handle, m, n, dA, lda, stA, dR, ldr, stR, dinfo, -1),
+            rocblas_status_invalid_size);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_cholqr(STRIDED, handle, m, n, (T) nullptr, lda, stA, dR, ldr, stR, dinfo, bc),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_cholqr(STRIDED, handle, m, n, dA, lda, stA, (U) nullptr, ldr, stR, dinfo, bc),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_cholqr(STRIDED, handle, m, n, dA, lda, stA, dR, ldr, stR,
+                                           (rocblas_int*)nullptr, bc),
+                          rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_cholqr(STRIDED, handle, m, 0, (T) nullptr, lda, stA,
+                                           (U) nullptr, ldr, stR, dinfo, bc),
+                          rocblas_status_success);
+
+    // quick return with zero batch_count if applicable
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_cholqr(STRIDED, handle, m, n, dA, lda, stA, dR, ldr, stR,
+                                               (rocblas_int*)nullptr, 0),
+                              rocblas_status_success);
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_cholqr_bad_arg()
+{
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_int m = 1;
+    rocblas_int n = 1;
+    rocblas_int lda = 1;
+    rocblas_int ldr = 1;
+    rocblas_stride stA = 1;
+    rocblas_stride stR = 1;
+    rocblas_int bc = 1;
+
+    if(BATCHED)
+    {
+        // memory allocations
+        device_batch_vector<T> dA(1, 1, 1);
+        device_strided_batch_vector<T> dR(1, 1, 1, 1);
+        device_strided_batch_vector<rocblas_int> dinfo(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dR.memcheck());
+        CHECK_HIP_ERROR(dinfo.memcheck());
+
+        // check bad arguments
+        cholqr_checkBadArgs<STRIDED>(handle, m, n, dA.data(), lda, stA, dR.data(), ldr, stR,
+                                     dinfo.data(), bc);
+    }
+    else
+    {
+        // memory allocations
+        device_strided_batch_vector<T> dA(1, 1, 1, 1);
+        device_strided_batch_vector<T> dR(1, 1, 1, 1);
+        device_strided_batch_vector<rocblas_int> dinfo(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dR.memcheck());
+        CHECK_HIP_ERROR(dinfo.memcheck());
+
+        // check bad arguments
+        cholqr_checkBadArgs<STRIDED>(handle, m, n, dA.data(), lda, stA, dR.data(), ldr, stR,
+                                     dinfo.data(), bc);
+    }
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Th>
+void cholqr_initData(const rocblas_handle handle,
+                     const rocblas_int m,
+                     const rocblas_int n,
+                     Td& dA,
+                     const rocblas_int lda,
+                     const rocblas_int bc,
+                     Th& hA)
+{
+    if(CPU)
+    {
+        rocblas_init<T>(hA, true);
+
+        // scale A to avoid singularities
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            for(rocblas_int i = 0; i < m; i++)
+            {
+                for(rocblas_int j = 0; j < n; j++)
+                {
+                    if(i == j)
+                        hA[b][i + j * lda] += 400;
+                    else
+                        hA[b][i + j * lda] -= 4;
+                }
+            }
+        }
+    }
+
+    if(GPU)
+    {
+        // now copy to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+    }
+}
+
+template <bool STRIDED,
+          typename T,
+          typename Td,
+          typename Ud,
+          typename Vd,
+          typename Th,
+          typename Uh,
+          typename Vh>
+void cholqr_getError(const rocblas_handle handle,
+                     const rocblas_int m,
+                     const rocblas_int n,
+                     Td& dA,
+                     const rocblas_int lda,
+                     const rocblas_stride stA,
+                     Ud& dR,
+                     const rocblas_int ldr,
+                     const rocblas_stride stR,
+                     Vd& dinfo,
+                     const rocblas_int bc,
+                     Th& hA,
+                     Th& hARes,
+                     Uh& hRRes,
+                     Vh& hinfoRes,
+                     double* max_err)
+{
+    std::vector<T> QR(size_t(m) * n);
+    std::vector<T> QQ(size_t(n) * n);
+    std::vector<T> I(size_t(n) * n, T(0));
+    for(rocblas_int i = 0; i < n; i++)
+        I[i + i * n] = T(1);
+
+    // input data initialization
+    cholqr_initData<true, true, T>(handle, m, n, dA, lda, bc, hA);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_cholqr(STRIDED, handle, m, n, dA.data(), lda, stA, dR.data(), ldr,
+                                         stR, dinfo.data(), bc));
+    CHECK_HIP_ERROR(hARes.transfer_from(dA));
+    CHECK_HIP_ERROR(hRRes.transfer_from(dR));
+    CHECK_HIP_ERROR(hinfoRes.transfer_from(dinfo));
+
+    // the matrices are full rank, so the factorizations must be completed
+    double err;
+    *max_err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        EXPECT_EQ(hinfoRes[b][0], 0) << "where b = " << b;
+        if(hinfoRes[b][0] != 0)
+            *max_err += 1;
+    }
+    if(*max_err > 0)
+        return;
+
+    // there is no reference to compare with (the factorization is unique only up to the signs
+    // of the diagonal of R), so the error is the largest of ||A - Q * R|| / ||A|| and
+    // ||Q' * Q - I|| / ||I||
+    // using frobenius norm
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        // R must be upper triangular
+        for(rocblas_int j = 0; j < n; j++)
+        {
+            for(rocblas_int i = j + 1; i < n; i++)
+            {
+                EXPECT_EQ(hRRes[b][i + j * ldr], T(0)) << "where b = " << b;
+                if(hRRes[b][i + j * ldr] != T(0))
+                    *max_err += 1;
+            }
+        }
+
+        cpu_gemm(rocblas_operation_none, rocblas_operation_none, m, n, n, T(1), hARes[b], lda,
+                 hRRes[b], ldr, T(0), QR.data(), m);
+        err = norm_error('F', m, n, lda, hA[b], QR.data(), m);
+        *max_err = err > *max_err ? err : *max_err;
+
+        cpu_gemm(rocblas_operation_conjugate_transpose, rocblas_operation_none, n, n, m, T(1),
+                 hARes[b], lda, hARes[b], lda, T(0), QQ.data(), n);
+        err = norm_error('F', n, n, n, I.data(), QQ.data());
+        *max_err = err > *max_err ? err : *max_err;
+    }
+}
+
+template <bool STRIDED, typename T, typename Td, typename Ud, typename Vd, typename Th, typename Uh>
+void cholqr_getPerfData(const rocblas_handle handle,
+                        const rocblas_int m,
+                        const rocblas_int n,
+                        Td& dA,
+                        const rocblas_int lda,
+                        const rocblas_stride stA,
+                        Ud& dR,
+                        const rocblas_int ldr,
+                        const rocblas_stride stR,
+                        Vd& dinfo,
+                        const rocblas_int bc,
+                        Th& hA,
+                        Uh& hIpiv,
+                        double* gpu_time_used,
+                        double* cpu_time_used,
+                        const rocblas_int hot_calls,
+                        const int profile,
+                        const bool profile_kernels,
+                        const bool perf)
+{
+    std::vector<T> hW(n);
+
+    if(!perf)
+    {
+        cholqr_initData<true, false, T>(handle, m, n, dA, lda, bc, hA);
+
+        // cpu-lapack performance (only if not in perf mode)
+        // (the CPU reference is GEQRF followed by ORGQR/UNGQR)
+        *cpu_time_used = get_time_us_no_sync();
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            cpu_geqrf(m, n, hA[b], lda, hIpiv[0], hW.data(), n);
+            cpu_orgqr_ungqr(m, n, n, hA[b], lda, hIpiv[0], hW.data(), n);
+        }
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    cholqr_initData<true, false, T>(handle, m, n, dA, lda, bc, hA);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        cholqr_initData<false, true, T>(handle, m, n, dA, lda, bc, hA);
+
+        rocsolver_bench_first_call first_call(handle, iter);
+        CHECK_ROCBLAS_ERROR(rocsolver_cholqr(STRIDED, handle, m, n, dA.data(), lda, stA, dR.data(),
+                                             ldr, stR, dinfo.data(), bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    rocsolver_bench_timer timer(stream, hot_calls);
+
+    if(profile > 0)
+    {
+        if(profile_kernels)
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile
+                                         | rocblas_layer_mode_ex_log_kernel);
+        else
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile);
+        rocsolver_log_set_max_levels(profile);
+    }
+
+    for(rocblas_int iter = 0; iter < timer.calls(); iter++)
+    {
+        cholqr_initData<false, true, T>(handle, m, n, dA, lda, bc, hA);
+
+        timer.start(iter);
+        rocsolver_cholqr(STRIDED, handle, m, n, dA.data(), lda, stA, dR.data(), ldr, stR,
+                         dinfo.data(), bc);
+        *gpu_time_used += timer.stop(iter);
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_cholqr(Arguments& argus)
+{
+    // get arguments
+    rocblas_local_handle handle;
+    rocblas_int m = argus.get<rocblas_int>("m");
+    rocblas_int n = argus.get<rocblas_int>("n", m);
+    rocblas_int lda = argus.get<rocblas_int>("lda", m);
+    rocblas_int ldr = argus.get<rocblas_int>("ldr", n);
+    rocblas_stride stA = argus.get<rocblas_stride>("strideA", lda * n);
+    rocblas_stride stR = argus.get<rocblas_stride>("strideR", ldr * n);
+    char algC = argus.get<char>("alg_mode", 'Q');
+
+    rocsolver_alg_mode alg = char2rocsolver_alg_mode(algC);
+    rocblas_int bc = argus.batch_count;
+    rocblas_int hot_calls = argus.iters;
+
+    rocblas_stride stARes = (argus.unit_check || argus.norm_check) ? stA : 0;
+    rocblas_stride stRRes = (argus.unit_check || argus.norm_check) ? stR : 0;
+
+    // select the shifted algorithm if required
+    CHECK_ROCBLAS_ERROR(rocsolver_set_alg_mode(handle, rocsolver_function_cholqr, alg));
+
+    // check non-supported values
+    // N/A
+
+    // determine sizes
+    size_t size_A = size_t(lda) * n;
+    size_t size_R = size_t(ldr) * n;
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_ARes = (argus.unit_check || argus.norm_check) ? size_A : 0;
+    size_t size_RRes = (argus.unit_check || argus.norm_check) ? size_R : 0;
+
+    // check invalid sizes
+    bool invalid_size = (m < 0 || n < 0 || n > m || lda < m || ldr < n || bc < 0);
+    if(invalid_size)
+    {
+        if(BATCHED)
+            EXPECT_ROCBLAS_STATUS(rocsolver_cholqr(STRIDED, handle, m, n, (T* const*)nullptr, lda,
+                                                   stA, (T*)nullptr, ldr, stR,
+                                                   (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_size);
+        else
+            EXPECT_ROCBLAS_STATUS(rocsolver_cholqr(STRIDED, handle, m, n, (T*)nullptr, lda, stA,
+                                                   (T*)nullptr, ldr, stR, (rocblas_int*)nullptr,
+                                                   bc),
+                                  rocblas_status_invalid_size);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_size);
+
+        return;
+    }
+
+    // memory size query is necessary
+    if(argus.mem_query || !USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        if(BATCHED)
+            CHECK_ALLOC_QUERY(rocsolver_cholqr(STRIDED, handle, m, n, (T* const*)nullptr, lda, stA,
+                                               (T*)nullptr, ldr, stR, (rocblas_int*)nullptr, bc));
+        else
+            CHECK_ALLOC_QUERY(rocsolver_cholqr(STRIDED, handle, m, n, (T*)nullptr, lda, stA,
+                                               (T*)nullptr, ldr, stR, (rocblas_int*)nullptr, bc));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        if(argus.mem_query)
+        {
+            rocsolver_bench_inform(inform_mem_query, size);
+            return;
+        }
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    // memory allocations (the factors R are always strided)
+    host_strided_batch_vector<T> hRRes(size_RRes, 1, stRRes, bc);
+    host_strided_batch_vector<T> hIpiv(n, 1, n, 1);
+    host_strided_batch_vector<rocblas_int> hinfoRes(1, 1, 1, bc);
+    device_strided_batch_vector<T> dR(size_R, 1, stR, bc);
+    device_strided_batch_vector<rocblas_int> dinfo(1, 1, 1, bc);
+    if(size_R)
+        CHECK_HIP_ERROR(dR.memcheck());
+    CHECK_HIP_ERROR(dinfo.memcheck());
+
+    if(BATCHED)
+    {
+        host_batch_vector<T> hA(size_A, 1, bc);
+        host_batch_vector<T> hARes(size_ARes, 1, bc);
+        device_batch_vector<T> dA(size_A, 1, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+
+        // check quick return
+        if(n == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_cholqr(STRIDED, handle, m, n, dA.data(), lda, stA,
+                                                   dR.data(), ldr, stR, dinfo.data(), bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                rocsolver_bench_inform(inform_quick_return);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            cholqr_getError<STRIDED, T>(handle, m, n, dA, lda, stA, dR, ldr, stR, dinfo, bc, hA,
+                                        hARes, hRRes, hinfoRes, &max_error);
+
+        // collect performance data
+        if(argus.timing)
+            cholqr_getPerfData<STRIDED, T>(handle, m, n, dA, lda, stA, dR, ldr, stR, dinfo, bc, hA,
+                                           hIpiv, &gpu_time_used, &cpu_time_used, hot_calls,
+                                           argus.profile, argus.profile_kernels, argus.perf);
+    }
+
+    else
+    {
+        host_strided_batch_vector<T> hA(size_A, 1, stA, bc);
+        host_strided_batch_vector<T> hARes(size_ARes, 1, stARes, bc);
+        device_strided_batch_vector<T> dA(size_A, 1, stA, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+
+        // check quick return
+        if(n == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_cholqr(STRIDED, handle, m, n, dA.data(), lda, stA,
+                                                   dR.data(), ldr, stR, dinfo.data(), bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                rocsolver_bench_inform(inform_quick_return);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            cholqr_getError<STRIDED, T>(handle, m, n, dA, lda, stA, dR, ldr, stR, dinfo, bc, hA,
+                                        hARes, hRRes, hinfoRes, &max_error);
+
+        // collect performance data
+        if(argus.timing)
+            cholqr_getPerfData<STRIDED, T>(handle, m, n, dA, lda, stA, dR, ldr, stR, dinfo, bc, hA,
+                                           hIpiv, &gpu_time_used, &cpu_time_used, hot_calls,
+                                           argus.profile, argus.profile_kernels, argus.perf);
+    }
+
+    // validate results for rocsolver-test
+    // using m * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, m);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            rocsolver_bench_header("Arguments:");
+            if(BATCHED)
+            {
+                rocsolver_bench_output("m", "n", "lda", "ldr", "strideR", "alg_mode", "batch_c");
+                rocsolver_bench_output(m, n, lda, ldr, stR, algC, bc);
+            }
+            else if(STRIDED)
+            {
+                rocsolver_bench_output("m", "n", "lda", "strideA", "ldr", "strideR", "alg_mode",
+                                       "batch_c");
+                rocsolver_bench_output(m, n, lda, stA, ldr, stR, algC, bc);
+            }
+            else
+            {
+                rocsolver_bench_output("m", "n", "lda", "ldr", "alg_mode");
+                rocsolver_bench_output(m, n, lda, ldr, algC);
+            }
+            rocsolver_bench_header("Results:");
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_bench_endl();
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
+
+#define EXTERN_TESTING_CHOLQR(...) extern template void testing_cholqr<__VA_ARGS__>(Arguments&);
+
+INSTANTIATE(EXTERN_TESTING_CHOLQR, FOREACH_MATRIX_DATA_LAYOUT, FOREACH_SCALAR_TYPE, APPLY_STAMP)
@@ -404,6 +404,7 @@ void gebd2_gebrd_getPerfData(const rocblas_handle handle,
         gebd2_gebrd_initData<false, true, T>(handle, m, n, dA, lda, stA, dD, stD, dE, stE, dTauq,
                                              stQ, dTaup, stP, bc, hA, hD, hE, hTauq, hTaup);
 
+        rocsolver_bench_first_call first_call(handle, iter);
         CHECK_ROCBLAS_ERROR(rocsolver_gebd2_gebrd(STRIDED, GEBRD, handle, m, n, dA.data(), lda, stA,
                                                   dD.data(), stD, dE.data(), stE, dTauq.data(), stQ,
                                                   dTaup.data(), stP, bc));
@@ -412,7 +413,7 @@ void gebd2_gebrd_getPerfData(const rocblas_handle handle,
     // gpu-lapack performance
     hipStream_t stream;
     CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
-    double start;
+    rocsolver_bench_timer timer(stream, hot_calls);
 
     if(profile > 0)
     {
@@ -424,15 +425,15 @@ void gebd2_gebrd_getPerfData(const rocblas_handle handle,
         rocsolver_log_set_max_levels(profile);
     }
 
-    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    for(rocblas_int iter = 0; iter < timer.calls(); iter++)
     {
         gebd2_gebrd_initData<false, true, T>(handle, m, n, dA, lda, stA, dD, stD, dE, stE, dTauq,
                                              stQ, dTaup, stP, bc, hA, hD, hE, hTauq, hTaup);
 
-        start = get_time_us_sync(stream);
+        timer.start(iter);
         rocsolver_gebd2_gebrd(STRIDED, GEBRD, handle, m, n, dA.data(), lda, stA, dD.data(), stD,
                               dE.data(), stE, dTauq.data(), stQ, dTaup.data(), stP, bc);
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        *gpu_time_used += timer.stop(iter);
     }
     *gpu_time_used /= hot_calls;
 }
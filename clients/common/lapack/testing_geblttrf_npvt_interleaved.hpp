@@ -452,6 +452,7 @@ void geblttrf_npvt_interleaved_getPerfData(const rocblas_handle handle,
                                                            dB, incb, ldb, stB, dC, incc, ldc, stC,
                                                            bc, hA, hB, hC, singular);
 
+        rocsolver_bench_first_call first_call(handle, iter);
         CHECK_ROCBLAS_ERROR(rocsolver_geblttrf_npvt_interleaved(
             handle, nb, nblocks, dA.data(), inca, lda, stA, dB.data(), incb, ldb, stB, dC.data(),
             incc, ldc, stC, dInfo.data(), bc));
@@ -460,7 +461,7 @@ void geblttrf_npvt_interleaved_getPerfData(const rocblas_handle handle,
     // gpu-lapack performance
     hipStream_t stream;
     CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
-    double start;
+    rocsolver_bench_timer timer(stream, hot_calls);
 
     if(profile > 0)
     {
@@ -472,17 +473,17 @@ void geblttrf_npvt_interleaved_getPerfData(const rocblas_handle handle,
         rocsolver_log_set_max_levels(profile);
     }
 
-    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    for(rocblas_int iter = 0; iter < timer.calls(); iter++)
     {
         geblttrf_npvt_interleaved_initData<false, true, T>(handle, nb, nblocks, dA, inca, lda, stA,
                                                            dB, incb, ldb, stB, dC, incc, ldc, stC,
                                                            bc, hA, hB, hC, singular);
 
-        start = get_time_us_sync(stream);
+        timer.start(iter);
         rocsolver_geblttrf_npvt_interleaved(handle, nb, nblocks, dA.data(), inca, lda, stA,
                                             dB.data(), incb, ldb, stB, dC.data(), incc, ldc, stC,
                                             dInfo.data(), bc);
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        *gpu_time_used += timer.stop(iter);
     }
     *gpu_time_used /= hot_calls;
 }
@@ -375,6 +375,7 @@ void geblttrs_npvt_getPerfData(const rocblas_handle handle,
         geblttrs_npvt_initData<false, true, T>(handle, nb, nblocks, nrhs, dA, lda, dB, ldb, dC, ldc,
                                                dX, ldx, bc, hA, hB, hC, hX, hXRes);
 
+        rocsolver_bench_first_call first_call(handle, iter);
         CHECK_ROCBLAS_ERROR(rocsolver_geblttrs_npvt(STRIDED, handle, nb, nblocks, nrhs, dA.data(),
                                                     lda, stA, dB.data(), ldb, stB, dC.data(), ldc,
                                                     stC, dX.data(), ldx, stX, bc));
@@ -383,7 +384,7 @@ void geblttrs_npvt_getPerfData(const rocblas_handle handle,
     // gpu-lapack performance
     hipStream_t stream;
     CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
-    double start;
+    rocsolver_bench_timer timer(stream, hot_calls);
 
     if(profile > 0)
     {
@@ -395,15 +396,15 @@ void geblttrs_npvt_getPerfData(const rocblas_handle handle,
         rocsolver_log_set_max_levels(profile);
     }
 
-    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    for(rocblas_int iter = 0; iter < timer.calls(); iter++)
     {
         geblttrs_npvt_initData<false, true, T>(handle, nb, nblocks, nrhs, dA, lda, dB, ldb, dC, ldc,
                                                dX, ldx, bc, hA, hB, hC, hX, hXRes);
 
-        start = get_time_us_sync(stream);
+        timer.start(iter);
         rocsolver_geblttrs_npvt(STRIDED, handle, nb, nblocks, nrhs, dA.data(), lda, stA, dB.data(),
                                 ldb, stB, dC.data(), ldc, stC, dX.data(), ldx, stX, bc);
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        *gpu_time_used += timer.stop(iter);
     }
     *gpu_time_used /= hot_calls;
 }
@@ -417,6 +417,7 @@ void geblttrs_npvt_interleaved_getPerfData(const rocblas_handle handle,
             handle, nb, nblocks, nrhs, dA, inca, lda, stA, dB, incb, ldb, stB, dC, incc, ldc, stC,
             dX, incx, ldx, stX, bc, hA, hB, hC, hX, hXRes);
 
+        rocsolver_bench_first_call first_call(handle, iter);
         CHECK_ROCBLAS_ERROR(rocsolver_geblttrs_npvt_interleaved(
             handle, nb, nblocks, nrhs, dA.data(), inca, lda, stA, dB.data(), incb, ldb, stB,
             dC.data(), incc, ldc, stC, dX.data(), incx, ldx, stX, bc));
@@ -425,7 +426,7 @@ void geblttrs_npvt_interleaved_getPerfData(const rocblas_handle handle,
     // gpu-lapack performance
     hipStream_t stream;
     CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
-    double start;
+    rocsolver_bench_timer timer(stream, hot_calls);
 
     if(profile > 0)
     {
@@ -437,17 +438,17 @@ void geblttrs_npvt_interleaved_getPerfData(const rocblas_handle handle,
         rocsolver_log_set_max_levels(profile);
     }
 
-    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    for(rocblas_int iter = 0; iter < timer.calls(); iter++)
     {
         geblttrs_npvt_interleaved_initData<false, true, T>(
             handle, nb, nblocks, nrhs, dA, inca, lda, stA, dB, incb, ldb, stB, dC, incc, ldc, stC,
             dX, incx, ldx, stX, bc, hA, hB, hC, hX, hXRes);
 
-        start = get_time_us_sync(stream);
+        timer.start(iter);
         rocsolver_geblttrs_npvt_interleaved(handle, nb, nblocks, nrhs, dA.data(), inca, lda, stA,
                                             dB.data(), incb, ldb, stB, dC.data(), incc, ldc, stC,
                                             dX.data(), incx, ldx, stX, bc);
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        *gpu_time_used += timer.stop(iter);
     }
     *gpu_time_used /= hot_calls;
 }
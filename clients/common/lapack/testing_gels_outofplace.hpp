@@ -393,6 +393,7 @@ void gels_outofplace_getPerfData(const rocblas_handle handle,
         gels_outofplace_initData<false, true, T>(handle, trans, m, n, nrhs, dA, lda, stA, dB, ldb,
                                                  stB, dInfo, bc, hA, hB, hX, hInfo, singular);
 
+        rocsolver_bench_first_call first_call(handle, iter);
         CHECK_ROCBLAS_ERROR(rocsolver_gels_outofplace(STRIDED, handle, trans, m, n, nrhs, dA.data(),
                                                       lda, stA, dB.data(), ldb, stB, dX.data(), ldx,
                                                       stX, dInfo.data(), bc));
@@ -401,7 +402,7 @@ void gels_outofplace_getPerfData(const rocblas_handle handle,
     // gpu-lapack performance
     hipStream_t stream;
     CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
-    double start;
+    rocsolver_bench_timer timer(stream, hot_calls);
 
     if(profile > 0)
     {
@@ -413,15 +414,15 @@ void gels_outofplace_getPerfData(const rocblas_handle handle,
         rocsolver_log_set_max_levels(profile);
     }
 
-    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    for(rocblas_int iter = 0; iter < timer.calls(); iter++)
     {
         gels_outofplace_initData<false, true, T>(handle, trans, m, n, nrhs, dA, lda, stA, dB, ldb,
                                                  stB, dInfo, bc, hA, hB, hX, hInfo, singular);
 
-        start = get_time_us_sync(stream);
+        timer.start(iter);
         rocsolver_gels_outofplace(STRIDED, handle, trans, m, n, nrhs, dA.data(), lda, stA,
                                   dB.data(), ldb, stB, dX.data(), ldx, stX, dInfo.data(), bc);
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        *gpu_time_used += timer.stop(iter);
     }
     *gpu_time_used /= hot_calls;
 }
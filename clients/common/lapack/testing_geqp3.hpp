@@ -0,0 +1,557 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "common/misc/client_util.hpp"
+#include "common/misc/clientcommon.hpp"
+#include "common/misc/lapack_host_reference.hpp"
+#include "common/misc/norm.hpp"
+#include "common/misc/rocsolver.hpp"
+#include "common/misc/rocsolver_arguments.hpp"
+#include "common/misc/rocsolver_test.hpp"
+
+template <bool STRIDED, typename T, typename U>
+void geqp3_checkBadArgs(const rocblas_handle handle,
+                        const rocblas_int m,
+                        const rocblas_int n,
+                        T dA,
+                        const rocblas_int lda,
+                        const rocblas_stride stA,
+                        rocblas_int* dJpvt,
+                        const rocblas_stride stJ,
+                        U dIpiv,
+                        const rocblas_stride stP,
+                        const rocblas_int bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_geqp3(STRIDED, nullptr, m, n, dA, lda, stA, dJpvt, stJ, dIpiv, stP, bc),
+        rocblas_status_invalid_handle);
+
+    // values
+    // N/A
+
+    // sizes (only check batch_count if applicable)
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(
+            rocsolver_geqp3(STRIDED, handle, m, n, dA, lda, stA, dJpvt, stJ, dIpiv, stP, -1),
+            rocblas_status_invalid_size);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_geqp3(STRIDED, handle, m, n, (T) nullptr, lda, stA, dJpvt, stJ, dIpiv, stP, bc),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_geqp3(STRIDED, handle, m, n, dA, lda, stA,
+                                          (rocblas_int*)nullptr, stJ, dIpiv, stP, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_geqp3(STRIDED, handle, m, n, dA, lda, stA, dJpvt, stJ, (U) nullptr, stP, bc),
+        rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_geqp3(STRIDED, handle, 0, n, (T) nullptr, lda, stA, dJpvt, stJ,
+                                          (U) nullptr, stP, bc),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(rocsolver_geqp3(STRIDED, handle, m, 0, (T) nullptr, lda, stA,
+                                          (rocblas_int*)nullptr, stJ, (U) nullptr, stP, bc),
+                          rocblas_status_success);
+
+    // quick return with zero batch_count if applicable
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(
+            rocsolver_geqp3(STRIDED, handle, m, n, dA, lda, stA, dJpvt, stJ, dIpiv, stP, 0),
+            rocblas_status_success);
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_geqp3_bad_arg()
+{
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_int m = 1;
+    rocblas_int n = 1;
+    rocblas_int lda = 1;
+    rocblas_stride stA = 1;
+    rocblas_stride stJ = 1;
+    rocblas_stride stP = 1;
+    rocblas_int bc = 1;
+
+    if(BATCHED)
+    {
+        // memory allocations
+        device_batch_vector<T> dA(1, 1, 1);
+        device_strided_batch_vector<rocblas_int> dJpvt(1, 1, 1, 1);
+        device_strided_batch_vector<T> dIpiv(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dJpvt.memcheck());
+        CHECK_HIP_ERROR(dIpiv.memcheck());
+
+        // check bad arguments
+        geqp3_checkBadArgs<STRIDED>(handle, m, n, dA.data(), lda, stA, dJpvt.data(), stJ,
+                                    dIpiv.data(), stP, bc);
+    }
+    else
+    {
+        // memory allocations
+        device_strided_batch_vector<T> dA(1, 1, 1, 1);
+        device_strided_batch_vector<rocblas_int> dJpvt(1, 1, 1, 1);
+        device_strided_batch_vector<T> dIpiv(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dJpvt.memcheck());
+        CHECK_HIP_ERROR(dIpiv.memcheck());
+
+        // check bad arguments
+        geqp3_checkBadArgs<STRIDED>(handle, m, n, dA.data(), lda, stA, dJpvt.data(), stJ,
+                                    dIpiv.data(), stP, bc);
+    }
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Th>
+void geqp3_initData(const rocblas_handle handle,
+                    const rocblas_int m,
+                    const rocblas_int n,
+                    Td& dA,
+                    const rocblas_int lda,
+                    const rocblas_stride stA,
+                    const rocblas_int bc,
+                    Th& hA)
+{
+    if(CPU)
+    {
+        rocblas_init<T>(hA, true);
+
+        // make the trailing columns linear combinations of the leading ones, so that
+        // the matrices are rank deficient and the pivoting is exercised
+        rocblas_int rank = std::max(1, std::min(m, n) / 2);
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            for(rocblas_int j = rank; j < n; j++)
+            {
+                rocblas_int j1 = j % rank;
+                rocblas_int j2 = (j + 1) % rank;
+                for(rocblas_int i = 0; i < m; i++)
+                    hA[b][i + j * lda] = hA[b][i + j1 * lda] - T(j % 3) * hA[b][i + j2 * lda];
+            }
+        }
+    }
+
+    if(GPU)
+    {
+        // now copy to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+    }
+}
+
+template <bool STRIDED,
+          typename T,
+          typename Td,
+          typename Id,
+          typename Ud,
+          typename Th,
+          typename Ih,
+          typename Uh>
+void geqp3_getError(const rocblas_handle handle,
+                    const rocblas_int m,
+                    const rocblas_int n,
+                    Td& dA,
+                    const rocblas_int lda,
+                    const rocblas_stride stA,
+                    Id& dJpvt,
+                    const rocblas_stride stJ,
+                    Ud& dIpiv,
+                    const rocblas_stride stP,
+                    const rocblas_int bc,
+                    Th& hA,
+                    Th& hARes,
+                    Ih& hJpvtRes,
+                    Uh& hIpivRes,
+                    double* max_err)
+{
+    using S = decltype(std::real(T{}));
+    rocblas_int dim = std::min(m, n);
+    size_t ldc = m;
+    std::vector<T> hW(n);
+    std::vector<T> hAP(ldc * n);
+    std::vector<T> hQR(ldc * n);
+
+    // input data initialization
+    geqp3_initData<true, true, T>(handle, m, n, dA, lda, stA, bc, hA);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_geqp3(STRIDED, handle, m, n, dA.data(), lda, stA, dJpvt.data(),
+                                        stJ, dIpiv.data(), stP, bc));
+    CHECK_HIP_ERROR(hARes.transfer_from(dA));
+    CHECK_HIP_ERROR(hJpvtRes.transfer_from(dJpvt));
+    CHECK_HIP_ERROR(hIpivRes.transfer_from(dIpiv));
+
+    // the pivoted factorization is not unique (columns with equal norms can be chosen in any
+    // order), so the result is validated by reconstructing A*P from the computed factors.
+    // error is ||A*P - Q*R|| / ||A*P||, using frobenius norm
+    double err;
+    *max_err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        // jpvt must be a permutation
+        std::vector<bool> seen(n, false);
+        err = 0;
+        for(rocblas_int j = 0; j < n; j++)
+        {
+            rocblas_int p = hJpvtRes[b][j];
+            if(p < 1 || p > n || seen[p - 1])
+                err = 1;
+            else
+                seen[p - 1] = true;
+        }
+        if(err > 0)
+        {
+            *max_err = err > *max_err ? err : *max_err;
+            continue;
+        }
+
+        // compute A*P and Q*R
+        for(rocblas_int j = 0; j < n; j++)
+        {
+            rocblas_int p = hJpvtRes[b][j] - 1;
+            for(rocblas_int i = 0; i < m; i++)
+            {
+                hAP[i + j * ldc] = hA[b][i + p * lda];
+                hQR[i + j * ldc] = (i <= j) ? hARes[b][i + j * lda] : T(0);
+            }
+        }
+        cpu_ormqr_unmqr(rocblas_side_left, rocblas_operation_none, m, n, dim, hARes[b], lda,
+                        hIpivRes[b], hQR.data(), m, hW.data(), n);
+
+        err = norm_error('F', m, n, m, hAP.data(), hQR.data());
+
+        // the diagonal of R should have non-increasing magnitude (up to the accuracy of the
+        // downdated column norms used to choose the pivots)
+        for(rocblas_int k = 1; k < dim; k++)
+        {
+            S rk = std::abs(hARes[b][k + k * lda]);
+            S rp = std::abs(hARes[b][(k - 1) + (k - 1) * lda]);
+            if(rk > S(1.1) * rp)
+                err = 1;
+        }
+
+        *max_err = err > *max_err ? err : *max_err;
+    }
+}
+
+template <bool STRIDED,
+          typename T,
+          typename Td,
+          typename Id,
+          typename Ud,
+          typename Th,
+          typename Ih,
+          typename Uh>
+void geqp3_getPerfData(const rocblas_handle handle,
+                       const rocblas_int m,
+                       const rocblas_int n,
+                       Td& dA,
+                       const rocblas_int lda,
+                       const rocblas_stride stA,
+                       Id& dJpvt,
+                       const rocblas_stride stJ,
+                       Ud& dIpiv,
+                       const rocblas_stride stP,
+                       const rocblas_int bc,
+                       Th& hA,
+                       Ih& hJpvt,
+                       Uh& hIpiv,
+                       double* gpu_time_used,
+                       double* cpu_time_used,
+                       const rocblas_int hot_calls,
+                       const int profile,
+                       const bool profile_kernels,
+                       const bool perf)
+{
+    using S = decltype(std::real(T{}));
+    rocblas_int lwork = 3 * n + 1;
+    std::vector<T> hW(lwork);
+    std::vector<S> hRW(2 * n);
+
+    if(!perf)
+    {
+        geqp3_initData<true, false, T>(handle, m, n, dA, lda, stA, bc, hA);
+
+        // cpu-lapack performance (only if not in perf mode)
+        // (all the columns are free)
+        for(rocblas_int b = 0; b < bc; ++b)
+            for(rocblas_int j = 0; j < n; j++)
+                hJpvt[b][j] = 0;
+
+        *cpu_time_used = get_time_us_no_sync();
+        for(rocblas_int b = 0; b < bc; ++b)
+            cpu_geqp3(m, n, hA[b], lda, hJpvt[b], hIpiv[b], hW.data(), lwork, hRW.data());
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    geqp3_initData<true, false, T>(handle, m, n, dA, lda, stA, bc, hA);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        geqp3_initData<false, true, T>(handle, m, n, dA, lda, stA, bc, hA);
+
+        rocsolver_bench_first_call first_call(handle, iter);
+        CHECK_ROCBLAS_ERROR(rocsolver_geqp3(STRIDED, handle, m, n, dA.data(), lda, stA,
+                                            dJpvt.data(), stJ, dIpiv.data(), stP, bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    rocsolver_bench_timer timer(stream, hot_calls);
+
+    if(profile > 0)
+    {
+        if(profile_kernels)
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile
+                                         | rocblas_layer_mode_ex_log_kernel);
+        else
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile);
+        rocsolver_log_set_max_levels(profile);
+    }
+
+    for(rocblas_int iter = 0; iter < timer.calls(); iter++)
+    {
+        geqp3_initData<false, true, T>(handle, m, n, dA, lda, stA, bc, hA);
+
+        timer.start(iter);
+        rocsolver_geqp3(STRIDED, handle, m, n, dA.data(), lda, stA, dJpvt.data(), stJ, dIpiv.data(),
+                        stP, bc);
+        *gpu_time_used += timer.stop(iter);
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_geqp3(Arguments& argus)
+{
+    // get arguments
+    rocblas_local_handle handle;
+    rocblas_int m = argus.get<rocblas_int>("m");
+    rocblas_int n = argus.get<rocblas_int>("n", m);
+    rocblas_int lda = argus.get<rocblas_int>("lda", m);
+    rocblas_stride stA = argus.get<rocblas_stride>("strideA", lda * n);
+    rocblas_stride stJ = argus.get<rocblas_stride>("strideJ", n);
+    rocblas_stride stP = argus.get<rocblas_stride>("strideP", min(m, n));
+
+    rocblas_int bc = argus.batch_count;
+    rocblas_int hot_calls = argus.iters;
+
+    rocblas_stride stARes = (argus.unit_check || argus.norm_check) ? stA : 0;
+
+    // check non-supported values
+    // N/A
+
+    // determine sizes
+    size_t size_A = size_t(lda) * n;
+    size_t size_J = size_t(n);
+    size_t size_P = size_t(min(m, n));
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_ARes = (argus.unit_check || argus.norm_check) ? size_A : 0;
+
+    // check invalid sizes
+    bool invalid_size = (m < 0 || n < 0 || lda < m || bc < 0);
+    if(invalid_size)
+    {
+        if(BATCHED)
+            EXPECT_ROCBLAS_STATUS(rocsolver_geqp3(STRIDED, handle, m, n, (T* const*)nullptr, lda,
+                                                  stA, (rocblas_int*)nullptr, stJ, (T*)nullptr, stP,
+                                                  bc),
+                                  rocblas_status_invalid_size);
+        else
+            EXPECT_ROCBLAS_STATUS(rocsolver_geqp3(STRIDED, handle, m, n, (T*)nullptr, lda, stA,
+                                                  (rocblas_int*)nullptr, stJ, (T*)nullptr, stP, bc),
+                                  rocblas_status_invalid_size);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_size);
+
+        return;
+    }
+
+    // memory size query is necessary
+    if(argus.mem_query || !USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        if(BATCHED)
+            CHECK_ALLOC_QUERY(rocsolver_geqp3(STRIDED, handle, m, n, (T* const*)nullptr, lda, stA,
+                                              (rocblas_int*)nullptr, stJ, (T*)nullptr, stP, bc));
+        else
+            CHECK_ALLOC_QUERY(rocsolver_geqp3(STRIDED, handle, m, n, (T*)nullptr, lda, stA,
+                                              (rocblas_int*)nullptr, stJ, (T*)nullptr, stP, bc));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        if(argus.mem_query)
+        {
+            rocsolver_bench_inform(inform_mem_query, size);
+            return;
+        }
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    // memory allocations (all cases)
+    host_strided_batch_vector<rocblas_int> hJpvt(size_J, 1, stJ, bc);
+    host_strided_batch_vector<T> hIpiv(size_P, 1, stP, bc);
+    device_strided_batch_vector<rocblas_int> dJpvt(size_J, 1, stJ, bc);
+    device_strided_batch_vector<T> dIpiv(size_P, 1, stP, bc);
+    if(size_J)
+        CHECK_HIP_ERROR(dJpvt.memcheck());
+    if(size_P)
+        CHECK_HIP_ERROR(dIpiv.memcheck());
+
+    if(BATCHED)
+    {
+        // memory allocations
+        host_batch_vector<T> hA(size_A, 1, bc);
+        host_batch_vector<T> hARes(size_ARes, 1, bc);
+        device_batch_vector<T> dA(size_A, 1, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+
+        // check quick return
+        if(m == 0 || n == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_geqp3(STRIDED, handle, m, n, dA.data(), lda, stA,
+                                                  dJpvt.data(), stJ, dIpiv.data(), stP, bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                rocsolver_bench_inform(inform_quick_return);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            geqp3_getError<STRIDED, T>(handle, m, n, dA, lda, stA, dJpvt, stJ, dIpiv, stP, bc, hA,
+                                       hARes, hJpvt, hIpiv, &max_error);
+
+        // collect performance data
+        if(argus.timing)
+            geqp3_getPerfData<STRIDED, T>(handle, m, n, dA, lda, stA, dJpvt, stJ, dIpiv, stP, bc,
+                                          hA, hJpvt, hIpiv, &gpu_time_used, &cpu_time_used,
+                                          hot_calls, argus.profile, argus.profile_kernels,
+                                          argus.perf);
+    }
+
+    else
+    {
+        // memory allocations
+        host_strided_batch_vector<T> hA(size_A, 1, stA, bc);
+        host_strided_batch_vector<T> hARes(size_ARes, 1, stARes, bc);
+        device_strided_batch_vector<T> dA(size_A, 1, stA, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+
+        // check quick return
+        if(m == 0 || n == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_geqp3(STRIDED, handle, m, n, dA.data(), lda, stA,
+                                                  dJpvt.data(), stJ, dIpiv.data(), stP, bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                rocsolver_bench_inform(inform_quick_return);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            geqp3_getError<STRIDED, T>(handle, m, n, dA, lda, stA, dJpvt, stJ, dIpiv, stP, bc, hA,
+                                       hARes, hJpvt, hIpiv, &max_error);
+
+        // collect performance data
+        if(argus.timing)
+            geqp3_getPerfData<STRIDED, T>(handle, m, n, dA, lda, stA, dJpvt, stJ, dIpiv, stP, bc,
+                                          hA, hJpvt, hIpiv, &gpu_time_used, &cpu_time_used,
+                                          hot_calls, argus.profile, argus.profile_kernels,
+                                          argus.perf);
+    }
+
+    // validate results for rocsolver-test
+    // using m * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, m);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            rocsolver_bench_header("Arguments:");
+            if(BATCHED)
+            {
+                rocsolver_bench_output("m", "n", "lda", "strideJ", "strideP", "batch_c");
+                rocsolver_bench_output(m, n, lda, stJ, stP, bc);
+            }
+            else if(STRIDED)
+            {
+                rocsolver_bench_output("m", "n", "lda", "strideA", "strideJ", "strideP", "batch_c");
+                rocsolver_bench_output(m, n, lda, stA, stJ, stP, bc);
+            }
+            else
+            {
+                rocsolver_bench_output("m", "n", "lda");
+                rocsolver_bench_output(m, n, lda);
+            }
+            rocsolver_bench_header("Results:");
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_bench_endl();
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
+
+#define EXTERN_TESTING_GEQP3(...) extern template void testing_geqp3<__VA_ARGS__>(Arguments&);
+
+INSTANTIATE(EXTERN_TESTING_GEQP3, FOREACH_MATRIX_DATA_LAYOUT, FOREACH_SCALAR_TYPE, APPLY_STAMP)
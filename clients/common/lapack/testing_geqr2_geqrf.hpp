@@ -29,6 +29,7 @@
 
 #include "common/misc/client_util.hpp"
 #include "common/misc/clientcommon.hpp"
+#include "common/misc/device_data_initializer.hpp"
 #include "common/misc/lapack_host_reference.hpp"
 #include "common/misc/norm.hpp"
 #include "common/misc/rocsolver.hpp"
@@ -134,7 +135,7 @@ void geqr2_geqrf_initData(const rocblas_handle handle,
                           Th& hA,
                           Uh& hIpiv)
 {
-    if(CPU)
+    if(CPU && !rocsolver_bench_device_init)
     {
         rocblas_init<T>(hA, true);
 
@@ -156,8 +157,18 @@ void geqr2_geqrf_initData(const rocblas_handle handle,
 
     if(GPU)
     {
-        // now copy to the GPU
-        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        if(rocsolver_bench_device_init)
+        {
+            // generate a random matrix directly on the GPU
+            hipStream_t stream;
+            CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+            device_init_matrix<T>(device_init_general, m, n, dA.data(), lda, stA, bc, stream);
+        }
+        else
+        {
+            // now copy to the GPU
+            CHECK_HIP_ERROR(dA.transfer_from(hA));
+        }
     }
 }
 
@@ -228,7 +239,7 @@ void geqr2_geqrf_getPerfData(const rocblas_handle handle,
 {
     std::vector<T> hW(n);
 
-    if(!perf)
+    if(!perf && !rocsolver_bench_device_init)
     {
         geqr2_geqrf_initData<true, false, T>(handle, m, n, dA, lda, stA, dIpiv, stP, bc, hA, hIpiv);
 
@@ -241,6 +252,8 @@ void geqr2_geqrf_getPerfData(const rocblas_handle handle,
         }
         *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
     }
+    else if(rocsolver_bench_device_init)
+        *cpu_time_used = nan(""); // no host data for cpu-lapack execution
 
     geqr2_geqrf_initData<true, false, T>(handle, m, n, dA, lda, stA, dIpiv, stP, bc, hA, hIpiv);
 
@@ -249,6 +262,7 @@ void geqr2_geqrf_getPerfData(const rocblas_handle handle,
     {
         geqr2_geqrf_initData<false, true, T>(handle, m, n, dA, lda, stA, dIpiv, stP, bc, hA, hIpiv);
 
+        rocsolver_bench_first_call first_call(handle, iter);
         CHECK_ROCBLAS_ERROR(rocsolver_geqr2_geqrf(STRIDED, GEQRF, handle, m, n, dA.data(), lda, stA,
                                                   dIpiv.data(), stP, bc));
     }
@@ -256,7 +270,7 @@ void geqr2_geqrf_getPerfData(const rocblas_handle handle,
     // gpu-lapack performance
     hipStream_t stream;
     CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
-    double start;
+    rocsolver_bench_timer timer(stream, hot_calls);
 
     if(profile > 0)
     {
@@ -268,14 +282,14 @@ void geqr2_geqrf_getPerfData(const rocblas_handle handle,
         rocsolver_log_set_max_levels(profile);
     }
 
-    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    for(rocblas_int iter = 0; iter < timer.calls(); iter++)
     {
         geqr2_geqrf_initData<false, true, T>(handle, m, n, dA, lda, stA, dIpiv, stP, bc, hA, hIpiv);
 
-        start = get_time_us_sync(stream);
+        timer.start(iter);
         rocsolver_geqr2_geqrf(STRIDED, GEQRF, handle, m, n, dA.data(), lda, stA, dIpiv.data(), stP,
                               bc);
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        *gpu_time_used += timer.stop(iter);
     }
     *gpu_time_used /= hot_calls;
 }
@@ -306,6 +320,10 @@ void testing_geqr2_geqrf(Arguments& argus)
 
     size_t size_ARes = (argus.unit_check || argus.norm_check) ? size_A : 0;
 
+    // the host copy of A is not needed if the input data is generated on the device
+    size_t size_hA = rocsolver_bench_device_init ? 0 : size_A;
+    rocblas_stride sthA = rocsolver_bench_device_init ? 0 : stA;
+
     // check invalid sizes
     bool invalid_size = (m < 0 || n < 0 || lda < m || bc < 0);
     if(invalid_size)
@@ -351,7 +369,7 @@ void testing_geqr2_geqrf(Arguments& argus)
     if(BATCHED && STRIDED)
     {
         // memory allocations
-        host_batch_vector<T> hA(size_A, 1, bc);
+        host_batch_vector<T> hA(size_hA, 1, bc);
         host_batch_vector<T> hARes(size_ARes, 1, bc);
         host_strided_batch_vector<T> hIpiv(size_P, 1, stP, bc);
         device_batch_vector<T> dA(size_A, 1, bc);
@@ -388,7 +406,7 @@ void testing_geqr2_geqrf(Arguments& argus)
     else if(BATCHED)
     {
         // memory allocations
-        host_batch_vector<T> hA(size_A, 1, bc);
+        host_batch_vector<T> hA(size_hA, 1, bc);
         host_batch_vector<T> hARes(size_ARes, 1, bc);
         host_batch_vector<T> hIpiv(size_P, 1, bc);
         device_batch_vector<T> dA(size_A, 1, bc);
@@ -425,7 +443,7 @@ void testing_geqr2_geqrf(Arguments& argus)
     else
     {
         // memory allocations
-        host_strided_batch_vector<T> hA(size_A, 1, stA, bc);
+        host_strided_batch_vector<T> hA(size_hA, 1, sthA, bc);
         host_strided_batch_vector<T> hARes(size_ARes, 1, stARes, bc);
         host_strided_batch_vector<T> hIpiv(size_P, 1, stP, bc);
         device_strided_batch_vector<T> dA(size_A, 1, stA, bc);
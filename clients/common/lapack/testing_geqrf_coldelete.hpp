@@ -0,0 +1,485 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "common/misc/client_util.hpp"
+#include "common/misc/clientcommon.hpp"
+#include "common/misc/lapack_host_reference.hpp"
+#include "common/misc/norm.hpp"
+#include "common/misc/rocsolver.hpp"
+#include "common/misc/rocsolver_arguments.hpp"
+#include "common/misc/rocsolver_test.hpp"
+
+template <bool STRIDED, typename T>
+void geqrf_coldelete_checkBadArgs(const rocblas_handle handle,
+                                  const rocblas_int m,
+                                  const rocblas_int n,
+                                  const rocblas_int col,
+                                  T dA,
+                                  const rocblas_int lda,
+                                  const rocblas_stride stA,
+                                  const rocblas_int bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_geqrf_coldelete(STRIDED, nullptr, m, n, col, dA, lda, stA, bc),
+                          rocblas_status_invalid_handle);
+
+    // values
+    // N/A
+
+    // sizes (only check batch_count if applicable)
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(
+            rocsolver_geqrf_coldelete(STRIDED, handle, m, n, col, dA, lda, stA, -1),
+            rocblas_status_invalid_size);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_geqrf_coldelete(STRIDED, handle, m, n, col, (T) nullptr, lda, stA, bc),
+        rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_geqrf_coldelete(STRIDED, handle, 0, n, col, (T) nullptr, lda, stA, bc),
+        rocblas_status_success);
+
+    // quick return with zero batch_count if applicable
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(
+            rocsolver_geqrf_coldelete(STRIDED, handle, m, n, col, dA, lda, stA, 0),
+            rocblas_status_success);
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_geqrf_coldelete_bad_arg()
+{
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_int m = 1;
+    rocblas_int n = 1;
+    rocblas_int col = 1;
+    rocblas_int lda = 1;
+    rocblas_stride stA = 1;
+    rocblas_int bc = 1;
+
+    if(BATCHED)
+    {
+        // memory allocations
+        device_batch_vector<T> dA(1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+
+        // check bad arguments
+        geqrf_coldelete_checkBadArgs<STRIDED>(handle, m, n, col, dA.data(), lda, stA, bc);
+    }
+    else
+    {
+        // memory allocations
+        device_strided_batch_vector<T> dA(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+
+        // check bad arguments
+        geqrf_coldelete_checkBadArgs<STRIDED>(handle, m, n, col, dA.data(), lda, stA, bc);
+    }
+}
+
+/** Initializes hA with the output of GEQRF for a random m-by-n matrix A, and hG with the
+    n-by-n matrix A'A that is used as reference. **/
+template <bool CPU, bool GPU, typename T, typename Td, typename Th>
+void geqrf_coldelete_initData(const rocblas_handle handle,
+                              const rocblas_int m,
+                              const rocblas_int n,
+                              Td& dA,
+                              const rocblas_int lda,
+                              const rocblas_stride stA,
+                              const rocblas_int bc,
+                              Th& hA,
+                              Th& hG)
+{
+    if(CPU)
+    {
+        std::vector<T> hIpiv(std::min(m, n));
+        std::vector<T> hW(n);
+        rocblas_init<T>(hA, true);
+
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            // scale A to avoid singularities
+            for(rocblas_int i = 0; i < m; i++)
+            {
+                for(rocblas_int j = 0; j < n; j++)
+                {
+                    if(i == j)
+                        hA[b][i + j * lda] += 400;
+                    else
+                        hA[b][i + j * lda] -= 4;
+                }
+            }
+
+            cpu_gemm(rocblas_operation_conjugate_transpose, rocblas_operation_none, n, n, m, T(1),
+                     hA[b], lda, hA[b], lda, T(0), hG[b], n);
+            cpu_geqrf(m, n, hA[b], lda, hIpiv.data(), hW.data(), n);
+        }
+    }
+
+    if(GPU)
+    {
+        // now copy to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+    }
+}
+
+template <bool STRIDED, typename T, typename Td, typename Th>
+void geqrf_coldelete_getError(const rocblas_handle handle,
+                              const rocblas_int m,
+                              const rocblas_int n,
+                              const rocblas_int col,
+                              Td& dA,
+                              const rocblas_int lda,
+                              const rocblas_stride stA,
+                              const rocblas_int bc,
+                              Th& hA,
+                              Th& hARes,
+                              Th& hG,
+                              double* max_err)
+{
+    rocblas_int nn = n - 1;
+    std::vector<T> hR(size_t(m) * nn);
+    std::vector<T> hGRes(size_t(nn) * nn);
+
+    // input data initialization
+    geqrf_coldelete_initData<true, true, T>(handle, m, n, dA, lda, stA, bc, hA, hG);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(
+        rocsolver_geqrf_coldelete(STRIDED, handle, m, n, col, dA.data(), lda, stA, bc));
+    CHECK_HIP_ERROR(hARes.transfer_from(dA));
+
+    // error is ||A'A - R'R|| / ||A'A||, where the column col is removed from A'A
+    // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
+    // IT MIGHT BE REVISITED IN THE FUTURE)
+    // using frobenius norm
+    double err;
+    *max_err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        // the upper part of the last column must be set to zero
+        err = 0;
+        for(rocblas_int i = 0; i < std::min(m, n); i++)
+        {
+            if(hARes[b][i + nn * lda] != T(0))
+                err++;
+        }
+
+        if(nn > 0)
+        {
+            // extract the updated factor and remove the column from the reference
+            for(rocblas_int j = 0; j < nn; j++)
+                for(rocblas_int i = 0; i < m; i++)
+                    hR[i + j * m] = (i <= j ? hARes[b][i + j * lda] : T(0));
+
+            for(rocblas_int j = 0; j < nn; j++)
+                for(rocblas_int i = 0; i < nn; i++)
+                    hG[b][i + j * nn]
+                        = hG[b][(i < col - 1 ? i : i + 1) + (j < col - 1 ? j : j + 1) * n];
+
+            cpu_gemm(rocblas_operation_conjugate_transpose, rocblas_operation_none, nn, nn, m, T(1),
+                     hR.data(), m, hR.data(), m, T(0), hGRes.data(), nn);
+            err += norm_error('F', nn, nn, nn, hG[b], hGRes.data());
+        }
+        *max_err = err > *max_err ? err : *max_err;
+    }
+}
+
+template <bool STRIDED, typename T, typename Td, typename Th>
+void geqrf_coldelete_getPerfData(const rocblas_handle handle,
+                                 const rocblas_int m,
+                                 const rocblas_int n,
+                                 const rocblas_int col,
+                                 Td& dA,
+                                 const rocblas_int lda,
+                                 const rocblas_stride stA,
+                                 const rocblas_int bc,
+                                 Th& hA,
+                                 Th& hG,
+                                 double* gpu_time_used,
+                                 double* cpu_time_used,
+                                 const rocblas_int hot_calls,
+                                 const int profile,
+                                 const bool profile_kernels,
+                                 const bool perf)
+{
+    std::vector<T> hIpiv(std::min(m, n));
+    std::vector<T> hW(n);
+
+    if(!perf)
+    {
+        geqrf_coldelete_initData<true, false, T>(handle, m, n, dA, lda, stA, bc, hA, hG);
+
+        // cpu-lapack performance (only if not in perf mode)
+        // (the alternative to the update is a new factorization of the m-by-(n-1) matrix)
+        *cpu_time_used = get_time_us_no_sync();
+        for(rocblas_int b = 0; b < bc; ++b)
+            cpu_geqrf(m, n - 1, hA[b], lda, hIpiv.data(), hW.data(), n);
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    geqrf_coldelete_initData<true, false, T>(handle, m, n, dA, lda, stA, bc, hA, hG);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        geqrf_coldelete_initData<false, true, T>(handle, m, n, dA, lda, stA, bc, hA, hG);
+
+        rocsolver_bench_first_call first_call(handle, iter);
+        CHECK_ROCBLAS_ERROR(
+            rocsolver_geqrf_coldelete(STRIDED, handle, m, n, col, dA.data(), lda, stA, bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    rocsolver_bench_timer timer(stream, hot_calls);
+
+    if(profile > 0)
+    {
+        if(profile_kernels)
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile
+                                         | rocblas_layer_mode_ex_log_kernel);
+        else
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile);
+        rocsolver_log_set_max_levels(profile);
+    }
+
+    for(rocblas_int iter = 0; iter < timer.calls(); iter++)
+    {
+        geqrf_coldelete_initData<false, true, T>(handle, m, n, dA, lda, stA, bc, hA, hG);
+
+        timer.start(iter);
+        rocsolver_geqrf_coldelete(STRIDED, handle, m, n, col, dA.data(), lda, stA, bc);
+        *gpu_time_used += timer.stop(iter);
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_geqrf_coldelete(Arguments& argus)
+{
+    // get arguments
+    rocblas_local_handle handle;
+    rocblas_int m = argus.get<rocblas_int>("m");
+    rocblas_int n = argus.get<rocblas_int>("n", m);
+    rocblas_int col = argus.get<rocblas_int>("col", 1);
+    rocblas_int lda = argus.get<rocblas_int>("lda", m);
+    rocblas_stride stA = argus.get<rocblas_stride>("strideA", lda * n);
+
+    rocblas_int bc = argus.batch_count;
+    rocblas_int hot_calls = argus.iters;
+
+    rocblas_stride stARes = (argus.unit_check || argus.norm_check) ? stA : 0;
+
+    // check non-supported values
+    // N/A
+
+    // determine sizes
+    size_t size_A = size_t(lda) * n;
+    size_t size_G = size_t(n) * n;
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_ARes = (argus.unit_check || argus.norm_check) ? size_A : 0;
+
+    // check invalid sizes
+    bool invalid_size = (m < 0 || n < 1 || lda < m || col < 1 || col > n || bc < 0);
+    if(invalid_size)
+    {
+        if(BATCHED)
+            EXPECT_ROCBLAS_STATUS(rocsolver_geqrf_coldelete(STRIDED, handle, m, n, col,
+                                                            (T* const*)nullptr, lda, stA, bc),
+                                  rocblas_status_invalid_size);
+        else
+            EXPECT_ROCBLAS_STATUS(rocsolver_geqrf_coldelete(STRIDED, handle, m, n, col,
+                                                            (T*)nullptr, lda, stA, bc),
+                                  rocblas_status_invalid_size);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_size);
+
+        return;
+    }
+
+    // memory size query is necessary
+    if(argus.mem_query || !USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        if(BATCHED)
+            CHECK_ALLOC_QUERY(rocsolver_geqrf_coldelete(STRIDED, handle, m, n, col,
+                                                        (T* const*)nullptr, lda, stA, bc));
+        else
+            CHECK_ALLOC_QUERY(
+                rocsolver_geqrf_coldelete(STRIDED, handle, m, n, col, (T*)nullptr, lda, stA, bc));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        if(argus.mem_query)
+        {
+            rocsolver_bench_inform(inform_mem_query, size);
+            return;
+        }
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    if(BATCHED)
+    {
+        // memory allocations
+        host_batch_vector<T> hA(size_A, 1, bc);
+        host_batch_vector<T> hARes(size_ARes, 1, bc);
+        host_batch_vector<T> hG(size_G, 1, bc);
+        device_batch_vector<T> dA(size_A, 1, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+
+        // check quick return
+        if(m == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(
+                rocsolver_geqrf_coldelete(STRIDED, handle, m, n, col, dA.data(), lda, stA, bc),
+                rocblas_status_success);
+            if(argus.timing)
+                rocsolver_bench_inform(inform_quick_return);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            geqrf_coldelete_getError<STRIDED, T>(handle, m, n, col, dA, lda, stA, bc, hA, hARes,
+                                                 hG, &max_error);
+
+        // collect performance data
+        if(argus.timing)
+            geqrf_coldelete_getPerfData<STRIDED, T>(handle, m, n, col, dA, lda, stA, bc, hA, hG,
+                                                    &gpu_time_used, &cpu_time_used, hot_calls,
+                                                    argus.profile, argus.profile_kernels,
+                                                    argus.perf);
+    }
+
+    else
+    {
+        // memory allocations
+        host_strided_batch_vector<T> hA(size_A, 1, stA, bc);
+        host_strided_batch_vector<T> hARes(size_ARes, 1, stARes, bc);
+        host_strided_batch_vector<T> hG(size_G, 1, size_G, bc);
+        device_strided_batch_vector<T> dA(size_A, 1, stA, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+
+        // check quick return
+        if(m == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(
+                rocsolver_geqrf_coldelete(STRIDED, handle, m, n, col, dA.data(), lda, stA, bc),
+                rocblas_status_success);
+            if(argus.timing)
+                rocsolver_bench_inform(inform_quick_return);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            geqrf_coldelete_getError<STRIDED, T>(handle, m, n, col, dA, lda, stA, bc, hA, hARes,
+                                                 hG, &max_error);
+
+        // collect performance data
+        if(argus.timing)
+            geqrf_coldelete_getPerfData<STRIDED, T>(handle, m, n, col, dA, lda, stA, bc, hA, hG,
+                                                    &gpu_time_used, &cpu_time_used, hot_calls,
+                                                    argus.profile, argus.profile_kernels,
+                                                    argus.perf);
+    }
+
+    // validate results for rocsolver-test
+    // using max(m,n) * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, std::max(m, n));
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            rocsolver_bench_header("Arguments:");
+            if(BATCHED)
+            {
+                rocsolver_bench_output("m", "n", "col", "lda", "batch_c");
+                rocsolver_bench_output(m, n, col, lda, bc);
+            }
+            else if(STRIDED)
+            {
+                rocsolver_bench_output("m", "n", "col", "lda", "strideA", "batch_c");
+                rocsolver_bench_output(m, n, col, lda, stA, bc);
+            }
+            else
+            {
+                rocsolver_bench_output("m", "n", "col", "lda");
+                rocsolver_bench_output(m, n, col, lda);
+            }
+            rocsolver_bench_header("Results:");
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_bench_endl();
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
+
+#define EXTERN_TESTING_GEQRF_COLDELETE(...) \
+    extern template void testing_geqrf_coldelete<__VA_ARGS__>(Arguments&);
+
+INSTANTIATE(EXTERN_TESTING_GEQRF_COLDELETE,
+            FOREACH_MATRIX_DATA_LAYOUT,
+            FOREACH_SCALAR_TYPE,
+            APPLY_STAMP)
@@ -0,0 +1,599 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "common/misc/client_util.hpp"
+#include "common/misc/clientcommon.hpp"
+#include "common/misc/lapack_host_reference.hpp"
+#include "common/misc/norm.hpp"
+#include "common/misc/rocsolver.hpp"
+#include "common/misc/rocsolver_arguments.hpp"
+#include "common/misc/rocsolver_test.hpp"
+
+template <bool STRIDED, bool DOWNDATE, typename T, typename U>
+void geqrf_rowupdate_checkBadArgs(const rocblas_handle handle,
+                                  const rocblas_int n,
+                                  const rocblas_int k,
+                                  T dA,
+                                  const rocblas_int lda,
+                                  const rocblas_stride stA,
+                                  T dW,
+                                  const rocblas_int ldw,
+                                  const rocblas_stride stW,
+                                  U dinfo,
+                                  const rocblas_int bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_geqrf_rowupdate(STRIDED, DOWNDATE, nullptr, n, k, dA, lda, stA,
+                                                    dW, ldw, stW, dinfo, bc),
+                          rocblas_status_invalid_handle);
+
+    // values
+    // N/A
+
+    // sizes (only check batch_count if applicable)
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_geqrf_rowupdate(STRIDED, DOWNDATE, handle, n, k, dA, lda,
+                                                        stA, dW, ldw, stW, dinfo, -1),
+                              rocblas_status_invalid_size);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_geqrf_rowupdate(STRIDED, DOWNDATE, handle, n, k, (T) nullptr,
+                                                    lda, stA, dW, ldw, stW, dinfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_geqrf_rowupdate(STRIDED, DOWNDATE, handle, n, k, dA, lda, stA,
+                                                    (T) nullptr, ldw, stW, dinfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_geqrf_rowupdate(STRIDED, DOWNDATE, handle, n, k, dA, lda, stA,
+                                                    dW, ldw, stW, (U) nullptr, bc),
+                          rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_geqrf_rowupdate(STRIDED, DOWNDATE, handle, 0, k, (T) nullptr,
+                                                    lda, stA, (T) nullptr, ldw, stW, dinfo, bc),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(rocsolver_geqrf_rowupdate(STRIDED, DOWNDATE, handle, n, 0, dA, lda, stA,
+                                                    (T) nullptr, 0, stW, dinfo, bc),
+                          rocblas_status_success);
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_geqrf_rowupdate(STRIDED, DOWNDATE, handle, n, k, dA, lda,
+                                                        stA, dW, ldw, stW, (U) nullptr, 0),
+                              rocblas_status_success);
+
+    // quick return with zero batch_count if applicable
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_geqrf_rowupdate(STRIDED, DOWNDATE, handle, n, k, dA, lda,
+                                                        stA, dW, ldw, stW, dinfo, 0),
+                              rocblas_status_success);
+}
+
+template <bool BATCHED, bool STRIDED, bool DOWNDATE, typename T>
+void testing_geqrf_rowupdate_bad_arg()
+{
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_int n = 1;
+    rocblas_int k = 1;
+    rocblas_int lda = 1;
+    rocblas_int ldw = 1;
+    rocblas_stride stA = 1;
+    rocblas_stride stW = 1;
+    rocblas_int bc = 1;
+
+    if(BATCHED)
+    {
+        // memory allocations
+        device_batch_vector<T> dA(1, 1, 1);
+        device_batch_vector<T> dW(1, 1, 1);
+        device_strided_batch_vector<rocblas_int> dinfo(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dW.memcheck());
+        CHECK_HIP_ERROR(dinfo.memcheck());
+
+        // check bad arguments
+        geqrf_rowupdate_checkBadArgs<STRIDED, DOWNDATE>(handle, n, k, dA.data(), lda, stA,
+                                                        dW.data(), ldw, stW, dinfo.data(), bc);
+    }
+    else
+    {
+        // memory allocations
+        device_strided_batch_vector<T> dA(1, 1, 1, 1);
+        device_strided_batch_vector<T> dW(1, 1, 1, 1);
+        device_strided_batch_vector<rocblas_int> dinfo(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dW.memcheck());
+        CHECK_HIP_ERROR(dinfo.memcheck());
+
+        // check bad arguments
+        geqrf_rowupdate_checkBadArgs<STRIDED, DOWNDATE>(handle, n, k, dA.data(), lda, stA,
+                                                        dW.data(), ldw, stW, dinfo.data(), bc);
+    }
+}
+
+/** Initializes hW with a random k-by-n matrix and hA with the triangular factor R of the QR
+    factorization of a matrix A, computed as the Cholesky factor of the random positive definite
+    matrix B = A'A (kept in hB). The signs of some rows of R are flipped, as GEQRF can return
+    negative diagonal elements. For a downdate, B includes the term W'W so that the rows of W can
+    be removed; in the singular cases, one element of the W that is removed is scaled so that the
+    remaining rows have deficient rank. **/
+template <bool CPU, bool GPU, bool DOWNDATE, typename T, typename Td, typename Ud, typename Th, typename Uh>
+void geqrf_rowupdate_initData(const rocblas_handle handle,
+                              const rocblas_int n,
+                              const rocblas_int k,
+                              Td& dA,
+                              const rocblas_int lda,
+                              const rocblas_stride stA,
+                              Td& dW,
+                              const rocblas_int ldw,
+                              const rocblas_stride stW,
+                              Ud& dInfo,
+                              const rocblas_int bc,
+                              Th& hA,
+                              Th& hB,
+                              Th& hW,
+                              Uh& hInfo,
+                              const bool singular)
+{
+    if(CPU)
+    {
+        using S = decltype(std::real(T{}));
+        rocblas_init<T>(hB, true);
+        rocblas_init<T>(hW, false);
+
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            // make B hermitian and diagonally dominant
+            for(rocblas_int j = 0; j < n; j++)
+            {
+                for(rocblas_int i = j; i < n; i++)
+                {
+                    T& a = hB[b][i + j * lda];
+                    if(i == j)
+                        a = T(std::real(a * sconj(a)) * 400 + S(10 * n));
+                    else
+                    {
+                        a -= 4;
+                        hB[b][j + i * lda] = sconj(a);
+                    }
+                }
+            }
+
+            if(DOWNDATE)
+                cpu_gemm(rocblas_operation_conjugate_transpose, rocblas_operation_none, n, n, k,
+                         T(1), hW[b], ldw, hW[b], ldw, T(1), hB[b], lda);
+
+            for(rocblas_int j = 0; j < n; j++)
+                for(rocblas_int i = 0; i < n; i++)
+                    hA[b][i + j * lda] = hB[b][i + j * lda];
+            cpu_potrf(rocblas_fill_upper, n, hA[b], lda, hInfo[b]);
+
+            // flip the sign of every other row of R
+            for(rocblas_int i = 1; i < n; i += 2)
+                for(rocblas_int j = i; j < n; j++)
+                    hA[b][i + j * lda] = -hA[b][i + j * lda];
+
+            if(DOWNDATE && singular && (b == bc / 4 || b == bc / 2 || b == bc - 1))
+            {
+                // make some downdates remove too much of the matrix
+                // always the same elements for debugging purposes
+                rocblas_int j = n / 2 + b;
+                j -= (j / n) * n;
+                hW[b][j * ldw] *= 1000;
+            }
+        }
+    }
+
+    if(GPU)
+    {
+        // now copy data to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        CHECK_HIP_ERROR(dW.transfer_from(hW));
+    }
+}
+
+template <bool STRIDED, bool DOWNDATE, typename T, typename Td, typename Ud, typename Th, typename Uh>
+void geqrf_rowupdate_getError(const rocblas_handle handle,
+                              const rocblas_int n,
+                              const rocblas_int k,
+                              Td& dA,
+                              const rocblas_int lda,
+                              const rocblas_stride stA,
+                              Td& dW,
+                              const rocblas_int ldw,
+                              const rocblas_stride stW,
+                              Ud& dInfo,
+                              const rocblas_int bc,
+                              Th& hA,
+                              Th& hARes,
+                              Th& hB,
+                              Th& hW,
+                              Uh& hInfo,
+                              Uh& hInfoRes,
+                              double* max_err,
+                              const bool singular)
+{
+    // input data initialization
+    geqrf_rowupdate_initData<true, true, DOWNDATE, T>(handle, n, k, dA, lda, stA, dW, ldw, stW,
+                                                      dInfo, bc, hA, hB, hW, hInfo, singular);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_geqrf_rowupdate(STRIDED, DOWNDATE, handle, n, k, dA.data(), lda,
+                                                  stA, dW.data(), ldw, stW, dInfo.data(), bc));
+    CHECK_HIP_ERROR(hARes.transfer_from(dA));
+    CHECK_HIP_ERROR(hInfoRes.transfer_from(dInfo));
+
+    // CPU lapack
+    // the updated R (with positive diagonal) is the Cholesky factor of A'A +/- W'W
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        cpu_gemm(rocblas_operation_conjugate_transpose, rocblas_operation_none, n, n, k,
+                 T(DOWNDATE ? -1 : 1), hW[b], ldw, hW[b], ldw, T(1), hB[b], lda);
+        cpu_potrf(rocblas_fill_upper, n, hB[b], lda, hInfo[b]);
+    }
+
+    // error is ||hB - hARes|| / ||hB||
+    // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
+    // IT MIGHT BE REVISITED IN THE FUTURE)
+    // using frobenius norm over the triangular factor
+    double err;
+    *max_err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        // when the downdate fails, the factor is left partially modified
+        if(hInfoRes[b][0] == 0)
+        {
+            err = norm_error_upperTr('F', n, n, lda, hB[b], hARes[b]);
+            *max_err = err > *max_err ? err : *max_err;
+        }
+    }
+
+    // also check info for rank deficient cases
+    err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        EXPECT_EQ(hInfo[b][0], hInfoRes[b][0]) << "where b = " << b;
+        if(hInfo[b][0] != hInfoRes[b][0])
+            err++;
+    }
+    *max_err += err;
+}
+
+template <bool STRIDED, bool DOWNDATE, typename T, typename Td, typename Ud, typename Th, typename Uh>
+void geqrf_rowupdate_getPerfData(const rocblas_handle handle,
+                                 const rocblas_int n,
+                                 const rocblas_int k,
+                                 Td& dA,
+                                 const rocblas_int lda,
+                                 const rocblas_stride stA,
+                                 Td& dW,
+                                 const rocblas_int ldw,
+                                 const rocblas_stride stW,
+                                 Ud& dInfo,
+                                 const rocblas_int bc,
+                                 Th& hA,
+                                 Th& hB,
+                                 Th& hW,
+                                 Uh& hInfo,
+                                 double* gpu_time_used,
+                                 double* cpu_time_used,
+                                 const rocblas_int hot_calls,
+                                 const int profile,
+                                 const bool profile_kernels,
+                                 const bool perf,
+                                 const bool singular)
+{
+    if(!perf)
+    {
+        geqrf_rowupdate_initData<true, false, DOWNDATE, T>(handle, n, k, dA, lda, stA, dW, ldw,
+                                                           stW, dInfo, bc, hA, hB, hW, hInfo,
+                                                           singular);
+
+        // cpu-lapack performance (only if not in perf mode)
+        // (the alternative to the update is a new factorization of the normal equations)
+        *cpu_time_used = get_time_us_no_sync();
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            cpu_gemm(rocblas_operation_conjugate_transpose, rocblas_operation_none, n, n, k,
+                     T(DOWNDATE ? -1 : 1), hW[b], ldw, hW[b], ldw, T(1), hB[b], lda);
+            cpu_potrf(rocblas_fill_upper, n, hB[b], lda, hInfo[b]);
+        }
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    geqrf_rowupdate_initData<true, false, DOWNDATE, T>(handle, n, k, dA, lda, stA, dW, ldw, stW,
+                                                       dInfo, bc, hA, hB, hW, hInfo, singular);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        geqrf_rowupdate_initData<false, true, DOWNDATE, T>(handle, n, k, dA, lda, stA, dW, ldw,
+                                                           stW, dInfo, bc, hA, hB, hW, hInfo,
+                                                           singular);
+
+        rocsolver_bench_first_call first_call(handle, iter);
+        CHECK_ROCBLAS_ERROR(rocsolver_geqrf_rowupdate(STRIDED, DOWNDATE, handle, n, k, dA.data(),
+                                                      lda, stA, dW.data(), ldw, stW, dInfo.data(),
+                                                      bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    rocsolver_bench_timer timer(stream, hot_calls);
+
+    if(profile > 0)
+    {
+        if(profile_kernels)
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile
+                                         | rocblas_layer_mode_ex_log_kernel);
+        else
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile);
+        rocsolver_log_set_max_levels(profile);
+    }
+
+    for(rocblas_int iter = 0; iter < timer.calls(); iter++)
+    {
+        geqrf_rowupdate_initData<false, true, DOWNDATE, T>(handle, n, k, dA, lda, stA, dW, ldw,
+                                                           stW, dInfo, bc, hA, hB, hW, hInfo,
+                                                           singular);
+
+        timer.start(iter);
+        rocsolver_geqrf_rowupdate(STRIDED, DOWNDATE, handle, n, k, dA.data(), lda, stA, dW.data(),
+                                  ldw, stW, dInfo.data(), bc);
+        *gpu_time_used += timer.stop(iter);
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <bool BATCHED, bool STRIDED, bool DOWNDATE, typename T>
+void testing_geqrf_rowupdate(Arguments& argus)
+{
+    // get arguments
+    rocblas_local_handle handle;
+    rocblas_int n = argus.get<rocblas_int>("n");
+    rocblas_int k = argus.get<rocblas_int>("k", 1);
+    rocblas_int lda = argus.get<rocblas_int>("lda", n);
+    rocblas_int ldw = argus.get<rocblas_int>("ldw", k);
+    rocblas_stride stA = argus.get<rocblas_stride>("strideA", lda * n);
+    rocblas_stride stW = argus.get<rocblas_stride>("strideW", ldw * n);
+
+    rocblas_int bc = argus.batch_count;
+    rocblas_int hot_calls = argus.iters;
+
+    rocblas_stride stARes = (argus.unit_check || argus.norm_check) ? stA : 0;
+
+    // check non-supported values
+    // N/A
+
+    // determine sizes
+    size_t size_A = size_t(lda) * n;
+    size_t size_W = size_t(ldw) * n;
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_ARes = (argus.unit_check || argus.norm_check) ? size_A : 0;
+
+    // check invalid sizes
+    bool invalid_size = (n < 0 || k < 0 || lda < n || ldw < k || bc < 0);
+    if(invalid_size)
+    {
+        if(BATCHED)
+            EXPECT_ROCBLAS_STATUS(rocsolver_geqrf_rowupdate(STRIDED, DOWNDATE, handle, n, k,
+                                                            (T* const*)nullptr, lda, stA,
+                                                            (T* const*)nullptr, ldw, stW,
+                                                            (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_size);
+        else
+            EXPECT_ROCBLAS_STATUS(rocsolver_geqrf_rowupdate(STRIDED, DOWNDATE, handle, n, k,
+                                                            (T*)nullptr, lda, stA, (T*)nullptr,
+                                                            ldw, stW, (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_size);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_size);
+
+        return;
+    }
+
+    // memory size query is necessary
+    if(argus.mem_query || !USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        if(BATCHED)
+            CHECK_ALLOC_QUERY(rocsolver_geqrf_rowupdate(STRIDED, DOWNDATE, handle, n, k,
+                                                        (T* const*)nullptr, lda, stA,
+                                                        (T* const*)nullptr, ldw, stW,
+                                                        (rocblas_int*)nullptr, bc));
+        else
+            CHECK_ALLOC_QUERY(rocsolver_geqrf_rowupdate(STRIDED, DOWNDATE, handle, n, k,
+                                                        (T*)nullptr, lda, stA, (T*)nullptr, ldw,
+                                                        stW, (rocblas_int*)nullptr, bc));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        if(argus.mem_query)
+        {
+            rocsolver_bench_inform(inform_mem_query, size);
+            return;
+        }
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    if(BATCHED)
+    {
+        // memory allocations
+        host_batch_vector<T> hA(size_A, 1, bc);
+        host_batch_vector<T> hARes(size_ARes, 1, bc);
+        host_batch_vector<T> hB(size_A, 1, bc);
+        host_batch_vector<T> hW(size_W, 1, bc);
+        host_strided_batch_vector<rocblas_int> hInfo(1, 1, 1, bc);
+        host_strided_batch_vector<rocblas_int> hInfoRes(1, 1, 1, bc);
+        device_batch_vector<T> dA(size_A, 1, bc);
+        device_batch_vector<T> dW(size_W, 1, bc);
+        device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+        if(size_W)
+            CHECK_HIP_ERROR(dW.memcheck());
+        CHECK_HIP_ERROR(dInfo.memcheck());
+
+        // check quick return
+        if(n == 0 || k == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_geqrf_rowupdate(STRIDED, DOWNDATE, handle, n, k,
+                                                            dA.data(), lda, stA, dW.data(), ldw,
+                                                            stW, dInfo.data(), bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                rocsolver_bench_inform(inform_quick_return);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            geqrf_rowupdate_getError<STRIDED, DOWNDATE, T>(handle, n, k, dA, lda, stA, dW, ldw,
+                                                           stW, dInfo, bc, hA, hARes, hB, hW,
+                                                           hInfo, hInfoRes, &max_error,
+                                                           argus.singular);
+
+        // collect performance data
+        if(argus.timing)
+            geqrf_rowupdate_getPerfData<STRIDED, DOWNDATE, T>(
+                handle, n, k, dA, lda, stA, dW, ldw, stW, dInfo, bc, hA, hB, hW, hInfo,
+                &gpu_time_used, &cpu_time_used, hot_calls, argus.profile, argus.profile_kernels,
+                argus.perf, argus.singular);
+    }
+
+    else
+    {
+        // memory allocations
+        host_strided_batch_vector<T> hA(size_A, 1, stA, bc);
+        host_strided_batch_vector<T> hARes(size_ARes, 1, stARes, bc);
+        host_strided_batch_vector<T> hB(size_A, 1, stA, bc);
+        host_strided_batch_vector<T> hW(size_W, 1, stW, bc);
+        host_strided_batch_vector<rocblas_int> hInfo(1, 1, 1, bc);
+        host_strided_batch_vector<rocblas_int> hInfoRes(1, 1, 1, bc);
+        device_strided_batch_vector<T> dA(size_A, 1, stA, bc);
+        device_strided_batch_vector<T> dW(size_W, 1, stW, bc);
+        device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+        if(size_W)
+            CHECK_HIP_ERROR(dW.memcheck());
+        CHECK_HIP_ERROR(dInfo.memcheck());
+
+        // check quick return
+        if(n == 0 || k == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_geqrf_rowupdate(STRIDED, DOWNDATE, handle, n, k,
+                                                            dA.data(), lda, stA, dW.data(), ldw,
+                                                            stW, dInfo.data(), bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                rocsolver_bench_inform(inform_quick_return);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            geqrf_rowupdate_getError<STRIDED, DOWNDATE, T>(handle, n, k, dA, lda, stA, dW, ldw,
+                                                           stW, dInfo, bc, hA, hARes, hB, hW,
+                                                           hInfo, hInfoRes, &max_error,
+                                                           argus.singular);
+
+        // collect performance data
+        if(argus.timing)
+            geqrf_rowupdate_getPerfData<STRIDED, DOWNDATE, T>(
+                handle, n, k, dA, lda, stA, dW, ldw, stW, dInfo, bc, hA, hB, hW, hInfo,
+                &gpu_time_used, &cpu_time_used, hot_calls, argus.profile, argus.profile_kernels,
+                argus.perf, argus.singular);
+    }
+
+    // validate results for rocsolver-test
+    // using n * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, n);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            rocsolver_bench_header("Arguments:");
+            if(BATCHED)
+            {
+                rocsolver_bench_output("n", "k", "lda", "ldw", "batch_c");
+                rocsolver_bench_output(n, k, lda, ldw, bc);
+            }
+            else if(STRIDED)
+            {
+                rocsolver_bench_output("n", "k", "lda", "strideA", "ldw", "strideW", "batch_c");
+                rocsolver_bench_output(n, k, lda, stA, ldw, stW, bc);
+            }
+            else
+            {
+                rocsolver_bench_output("n", "k", "lda", "ldw");
+                rocsolver_bench_output(n, k, lda, ldw);
+            }
+            rocsolver_bench_header("Results:");
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_bench_endl();
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
+
+#define EXTERN_TESTING_GEQRF_ROWUPDATE(...) \
+    extern template void testing_geqrf_rowupdate<__VA_ARGS__>(Arguments&);
+
+INSTANTIATE(EXTERN_TESTING_GEQRF_ROWUPDATE,
+            FOREACH_MATRIX_DATA_LAYOUT,
+            FOREACH_BLOCKED_VARIANT,
+            FOREACH_SCALAR_TYPE,
+            APPLY_STAMP)
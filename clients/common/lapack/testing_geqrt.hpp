@@ -0,0 +1,367 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "common/misc/client_util.hpp"
+#include "common/misc/clientcommon.hpp"
+#include "common/misc/lapack_host_reference.hpp"
+#include "common/misc/norm.hpp"
+#include "common/misc/rocsolver.hpp"
+#include "common/misc/rocsolver_arguments.hpp"
+#include "common/misc/rocsolver_test.hpp"
+
+template <typename T>
+void geqrt_checkBadArgs(const rocblas_handle handle,
+                        const rocblas_int m,
+                        const rocblas_int n,
+                        const rocblas_int nb,
+                        T dA,
+                        const rocblas_int lda,
+                        T dT,
+                        const rocblas_int ldt)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_geqrt(nullptr, m, n, nb, dA, lda, dT, ldt),
+                          rocblas_status_invalid_handle);
+
+    // values
+    // N/A
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_geqrt(handle, m, n, nb, (T) nullptr, lda, dT, ldt),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_geqrt(handle, m, n, nb, dA, lda, (T) nullptr, ldt),
+                          rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_geqrt(handle, 0, n, nb, (T) nullptr, lda, (T) nullptr, ldt),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(rocsolver_geqrt(handle, m, 0, nb, (T) nullptr, lda, (T) nullptr, ldt),
+                          rocblas_status_success);
+}
+
+template <typename T>
+void testing_geqrt_bad_arg()
+{
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_int m = 1;
+    rocblas_int n = 1;
+    rocblas_int nb = 1;
+    rocblas_int lda = 1;
+    rocblas_int ldt = 1;
+
+    // memory allocations
+    device_strided_batch_vector<T> dA(1, 1, 1, 1);
+    device_strided_batch_vector<T> dT(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dT.memcheck());
+
+    // check bad arguments
+    geqrt_checkBadArgs(handle, m, n, nb, dA.data(), lda, dT.data(), ldt);
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Th>
+void geqrt_initData(const rocblas_handle handle,
+                    const rocblas_int m,
+                    const rocblas_int n,
+                    Td& dA,
+                    const rocblas_int lda,
+                    Th& hA)
+{
+    if(CPU)
+    {
+        rocblas_init<T>(hA, true);
+
+        // scale A to avoid singularities
+        for(rocblas_int i = 0; i < m; i++)
+        {
+            for(rocblas_int j = 0; j < n; j++)
+            {
+                if(i == j)
+                    hA[0][i + j * lda] += 400;
+                else
+                    hA[0][i + j * lda] -= 4;
+            }
+        }
+    }
+
+    if(GPU)
+    {
+        // now copy to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+    }
+}
+
+template <typename T, typename Td, typename Th>
+void geqrt_getError(const rocblas_handle handle,
+                    const rocblas_int m,
+                    const rocblas_int n,
+                    const rocblas_int nb,
+                    Td& dA,
+                    const rocblas_int lda,
+                    Td& dT,
+                    const rocblas_int ldt,
+                    Th& hA,
+                    Th& hARes,
+                    Th& hT,
+                    Th& hTRes,
+                    double* max_err)
+{
+    std::vector<T> hW(size_t(nb) * n);
+    rocblas_int dim = std::min(m, n);
+
+    // input data initialization
+    geqrt_initData<true, true, T>(handle, m, n, dA, lda, hA);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_geqrt(handle, m, n, nb, dA.data(), lda, dT.data(), ldt));
+    CHECK_HIP_ERROR(hARes.transfer_from(dA));
+    CHECK_HIP_ERROR(hTRes.transfer_from(dT));
+
+    // CPU lapack
+    cpu_geqrt(m, n, nb, hA[0], lda, hT[0], ldt, hW.data());
+
+    // error is ||hA - hARes|| / ||hA||
+    // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
+    // IT MIGHT BE REVISITED IN THE FUTURE)
+    // using frobenius norm
+    *max_err = norm_error('F', m, n, lda, hA[0], hARes[0]);
+
+    // also check the triangular factors of the block reflectors
+    // (only their upper triangular part is referenced)
+    double err;
+    for(rocblas_int j = 0; j < dim; j += nb)
+    {
+        rocblas_int jb = std::min(dim - j, nb);
+        err = norm_error_upperTr('F', jb, jb, ldt, hT[0] + j * ldt, hTRes[0] + j * ldt);
+        *max_err = err > *max_err ? err : *max_err;
+    }
+}
+
+template <typename T, typename Td, typename Th>
+void geqrt_getPerfData(const rocblas_handle handle,
+                       const rocblas_int m,
+                       const rocblas_int n,
+                       const rocblas_int nb,
+                       Td& dA,
+                       const rocblas_int lda,
+                       Td& dT,
+                       const rocblas_int ldt,
+                       Th& hA,
+                       Th& hT,
+                       double* gpu_time_used,
+                       double* cpu_time_used,
+                       const rocblas_int hot_calls,
+                       const int profile,
+                       const bool profile_kernels,
+                       const bool perf)
+{
+    std::vector<T> hW(size_t(nb) * n);
+
+    if(!perf)
+    {
+        geqrt_initData<true, false, T>(handle, m, n, dA, lda, hA);
+
+        // cpu-lapack performance (only if not in perf mode)
+        *cpu_time_used = get_time_us_no_sync();
+        cpu_geqrt(m, n, nb, hA[0], lda, hT[0], ldt, hW.data());
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    geqrt_initData<true, false, T>(handle, m, n, dA, lda, hA);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        geqrt_initData<false, true, T>(handle, m, n, dA, lda, hA);
+
+        rocsolver_bench_first_call first_call(handle, iter);
+        CHECK_ROCBLAS_ERROR(rocsolver_geqrt(handle, m, n, nb, dA.data(), lda, dT.data(), ldt));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    rocsolver_bench_timer timer(stream, hot_calls);
+
+    if(profile > 0)
+    {
+        if(profile_kernels)
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile
+                                         | rocblas_layer_mode_ex_log_kernel);
+        else
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile);
+        rocsolver_log_set_max_levels(profile);
+    }
+
+    for(rocblas_int iter = 0; iter < timer.calls(); iter++)
+    {
+        geqrt_initData<false, true, T>(handle, m, n, dA, lda, hA);
+
+        timer.start(iter);
+        rocsolver_geqrt(handle, m, n, nb, dA.data(), lda, dT.data(), ldt);
+        *gpu_time_used += timer.stop(iter);
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <typename T>
+void testing_geqrt(Arguments& argus)
+{
+    // get arguments
+    rocblas_local_handle handle;
+    rocblas_int m = argus.get<rocblas_int>("m");
+    rocblas_int n = argus.get<rocblas_int>("n", m);
+    rocblas_int nb = argus.get<rocblas_int>("nb", std::max(std::min(std::min(m, n), 32), 1));
+    rocblas_int lda = argus.get<rocblas_int>("lda", m);
+    rocblas_int ldt = argus.get<rocblas_int>("ldt", nb);
+
+    rocblas_int hot_calls = argus.iters;
+
+    // check non-supported values
+    // N/A
+
+    // determine sizes
+    rocblas_int dim = std::min(m, n);
+    size_t size_A = size_t(lda) * n;
+    size_t size_T = size_t(ldt) * dim;
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_ARes = (argus.unit_check || argus.norm_check) ? size_A : 0;
+    size_t size_TRes = (argus.unit_check || argus.norm_check) ? size_T : 0;
+
+    // check invalid sizes
+    bool invalid_size
+        = (m < 0 || n < 0 || lda < m || nb < 1 || ldt < nb || (dim > 0 && nb > dim));
+    if(invalid_size)
+    {
+        EXPECT_ROCBLAS_STATUS(
+            rocsolver_geqrt(handle, m, n, nb, (T*)nullptr, lda, (T*)nullptr, ldt),
+            rocblas_status_invalid_size);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_size);
+
+        return;
+    }
+
+    // memory size query is necessary
+    if(argus.mem_query || !USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        CHECK_ALLOC_QUERY(rocsolver_geqrt(handle, m, n, nb, (T*)nullptr, lda, (T*)nullptr, ldt));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        if(argus.mem_query)
+        {
+            rocsolver_bench_inform(inform_mem_query, size);
+            return;
+        }
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    // memory allocations
+    host_strided_batch_vector<T> hA(size_A, 1, size_A, 1);
+    host_strided_batch_vector<T> hARes(size_ARes, 1, size_ARes, 1);
+    host_strided_batch_vector<T> hT(size_T, 1, size_T, 1);
+    host_strided_batch_vector<T> hTRes(size_TRes, 1, size_TRes, 1);
+    device_strided_batch_vector<T> dA(size_A, 1, size_A, 1);
+    device_strided_batch_vector<T> dT(size_T, 1, size_T, 1);
+    if(size_A)
+        CHECK_HIP_ERROR(dA.memcheck());
+    if(size_T)
+        CHECK_HIP_ERROR(dT.memcheck());
+
+    // check quick return
+    if(m == 0 || n == 0)
+    {
+        EXPECT_ROCBLAS_STATUS(rocsolver_geqrt(handle, m, n, nb, dA.data(), lda, dT.data(), ldt),
+                              rocblas_status_success);
+        if(argus.timing)
+            rocsolver_bench_inform(inform_quick_return);
+
+        return;
+    }
+
+    // check computations
+    if(argus.unit_check || argus.norm_check)
+        geqrt_getError<T>(handle, m, n, nb, dA, lda, dT, ldt, hA, hARes, hT, hTRes, &max_error);
+
+    // collect performance data
+    if(argus.timing)
+        geqrt_getPerfData<T>(handle, m, n, nb, dA, lda, dT, ldt, hA, hT, &gpu_time_used,
+                             &cpu_time_used, hot_calls, argus.profile, argus.profile_kernels,
+                             argus.perf);
+
+    // validate results for rocsolver-test
+    // using m * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, m);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            rocsolver_bench_header("Arguments:");
+            rocsolver_bench_output("m", "n", "nb", "lda", "ldt");
+            rocsolver_bench_output(m, n, nb, lda, ldt);
+
+            rocsolver_bench_header("Results:");
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_bench_endl();
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
+
+#define EXTERN_TESTING_GEQRT(...) extern template void testing_geqrt<__VA_ARGS__>(Arguments&);
+
+INSTANTIATE(EXTERN_TESTING_GEQRT, FOREACH_SCALAR_TYPE, APPLY_STAMP)
@@ -347,6 +347,7 @@ void gesv_outofplace_getPerfData(const rocblas_handle handle,
         gesv_outofplace_initData<false, true, T>(handle, n, nrhs, dA, lda, stA, dIpiv, stP, dB, ldb,
                                                  stB, bc, hA, hIpiv, hB, singular);
 
+        rocsolver_bench_first_call first_call(handle, iter);
         CHECK_ROCBLAS_ERROR(rocsolver_gesv_outofplace(STRIDED, handle, n, nrhs, dA.data(), lda, stA,
                                                       dIpiv.data(), stP, dB.data(), ldb, stB,
                                                       dX.data(), ldx, stX, dInfo.data(), bc));
@@ -355,7 +356,7 @@ void gesv_outofplace_getPerfData(const rocblas_handle handle,
     // gpu-lapack performance
     hipStream_t stream;
     CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
-    double start;
+    rocsolver_bench_timer timer(stream, hot_calls);
 
     if(profile > 0)
     {
@@ -367,15 +368,15 @@ void gesv_outofplace_getPerfData(const rocblas_handle handle,
         rocsolver_log_set_max_levels(profile);
     }
 
-    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    for(rocblas_int iter = 0; iter < timer.calls(); iter++)
     {
         gesv_outofplace_initData<false, true, T>(handle, n, nrhs, dA, lda, stA, dIpiv, stP, dB, ldb,
                                                  stB, bc, hA, hIpiv, hB, singular);
 
-        start = get_time_us_sync(stream);
+        timer.start(iter);
         rocsolver_gesv_outofplace(STRIDED, handle, n, nrhs, dA.data(), lda, stA, dIpiv.data(), stP,
                                   dB.data(), ldb, stB, dX.data(), ldx, stX, dInfo.data(), bc);
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        *gpu_time_used += timer.stop(iter);
     }
     *gpu_time_used /= hot_calls;
 }
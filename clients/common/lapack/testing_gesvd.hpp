@@ -193,6 +193,19 @@ void testing_gesvd_bad_arg()
                                     dS.data(), stS, dU.data(), ldu, stU, dV.data(), ldv, stV,
                                     dE.data(), stE, fa, dinfo.data(), bc);
     }
+
+    // check algorithm selection
+    rocsolver_alg_mode alg;
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_set_alg_mode(nullptr, rocsolver_function_gesvd, rocsolver_alg_mode_qr),
+        rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_set_alg_mode(handle, rocsolver_function_gesvd, rocsolver_alg_mode(0)),
+        rocblas_status_invalid_value);
+    EXPECT_ROCBLAS_STATUS(rocsolver_get_alg_mode(nullptr, rocsolver_function_gesvd, &alg),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocsolver_get_alg_mode(handle, rocsolver_function_gesvd, nullptr),
+                          rocblas_status_invalid_pointer);
 }
 
 template <bool CPU, bool GPU, typename T, typename Td, typename Th>
@@ -465,6 +478,7 @@ void gesvd_getPerfData(const rocblas_handle handle,
     {
         gesvd_initData<false, true, T>(handle, left_svect, right_svect, m, n, dA, lda, bc, hA, A, 0);
 
+        rocsolver_bench_first_call first_call(handle, iter);
         CHECK_ROCBLAS_ERROR(rocsolver_gesvd(
             STRIDED, handle, left_svect, right_svect, m, n, dA.data(), lda, stA, dS.data(), stS,
             dU.data(), ldu, stU, dV.data(), ldv, stV, dE.data(), stE, fa, dinfo.data(), bc));
@@ -473,7 +487,7 @@ void gesvd_getPerfData(const rocblas_handle handle,
     // gpu-lapack performance
     hipStream_t stream;
     CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
-    double start;
+    rocsolver_bench_timer timer(stream, hot_calls);
 
     if(profile > 0)
     {
@@ -485,15 +499,15 @@ void gesvd_getPerfData(const rocblas_handle handle,
         rocsolver_log_set_max_levels(profile);
     }
 
-    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    for(rocblas_int iter = 0; iter < timer.calls(); iter++)
     {
         gesvd_initData<false, true, T>(handle, left_svect, right_svect, m, n, dA, lda, bc, hA, A, 0);
 
-        start = get_time_us_sync(stream);
+        timer.start(iter);
         rocsolver_gesvd(STRIDED, handle, left_svect, right_svect, m, n, dA.data(), lda, stA,
                         dS.data(), stS, dU.data(), ldu, stU, dV.data(), ldv, stV, dE.data(), stE,
                         fa, dinfo.data(), bc);
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        *gpu_time_used += timer.stop(iter);
     }
     *gpu_time_used /= hot_calls;
 }
@@ -518,13 +532,18 @@ void testing_gesvd(Arguments& argus)
     rocblas_stride stV = argus.get<rocblas_stride>("strideV", ldv * n);
     rocblas_stride stE = argus.get<rocblas_stride>("strideE", std::min(m, n) - 1);
     char faC = argus.get<char>("fast_alg");
+    char algC = argus.get<char>("alg_mode", 'Q');
 
     rocblas_svect leftv = char2rocblas_svect(leftvC);
     rocblas_svect rightv = char2rocblas_svect(rightvC);
     rocblas_workmode fa = char2rocblas_workmode(faC);
+    rocsolver_alg_mode alg = char2rocsolver_alg_mode(algC);
     rocblas_int bc = argus.batch_count;
     rocblas_int hot_calls = argus.iters;
 
+    // select the algorithm for the bidiagonal SVD
+    CHECK_ROCBLAS_ERROR(rocsolver_set_alg_mode(handle, rocsolver_function_gesvd, alg));
+
     // check non-supported values
     if(rightv == rocblas_svect_overwrite && leftv == rocblas_svect_overwrite)
     {
@@ -506,6 +506,7 @@ void gesvdj_notransv_getPerfData(const rocblas_handle handle,
         gesvdj_notransv_initData<false, true, T>(handle, left_svect, right_svect, m, n, dA, lda, bc,
                                                  hA, A, 0);
 
+        rocsolver_bench_first_call first_call(handle, iter);
         CHECK_ROCBLAS_ERROR(rocsolver_gesvdj_notransv(
             STRIDED, handle, left_svect, right_svect, m, n, dA.data(), lda, stA, abstol,
             dResidual.data(), max_sweeps, dSweeps.data(), dS.data(), stS, dU.data(), ldu, stU,
@@ -515,7 +516,7 @@ void gesvdj_notransv_getPerfData(const rocblas_handle handle,
     // gpu-lapack performance
     hipStream_t stream;
     CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
-    double start;
+    rocsolver_bench_timer timer(stream, hot_calls);
 
     if(profile > 0)
     {
@@ -527,16 +528,16 @@ void gesvdj_notransv_getPerfData(const rocblas_handle handle,
         rocsolver_log_set_max_levels(profile);
     }
 
-    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    for(rocblas_int iter = 0; iter < timer.calls(); iter++)
     {
         gesvdj_notransv_initData<false, true, T>(handle, left_svect, right_svect, m, n, dA, lda, bc,
                                                  hA, A, 0);
 
-        start = get_time_us_sync(stream);
+        timer.start(iter);
         rocsolver_gesvdj_notransv(STRIDED, handle, left_svect, right_svect, m, n, dA.data(), lda, stA,
                                   abstol, dResidual.data(), max_sweeps, dSweeps.data(), dS.data(),
                                   stS, dU.data(), ldu, stU, dV.data(), ldv, stV, dinfo.data(), bc);
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        *gpu_time_used += timer.stop(iter);
     }
     *gpu_time_used /= hot_calls;
 }
@@ -564,12 +565,17 @@ void testing_gesvdj_notransv(Arguments& argus)
 
     S abstol = S(argus.get<double>("abstol", 0));
     rocblas_int max_sweeps = argus.get<rocblas_int>("max_sweeps", 100);
+    char algC = argus.get<char>("alg_mode", 'Q');
 
     rocblas_svect leftv = char2rocblas_svect(leftvC);
     rocblas_svect rightv = char2rocblas_svect(rightvC);
+    rocsolver_alg_mode alg = char2rocsolver_alg_mode(algC);
     rocblas_int bc = argus.batch_count;
     rocblas_int hot_calls = argus.iters;
 
+    // select the preconditioning
+    CHECK_ROCBLAS_ERROR(rocsolver_set_alg_mode(handle, rocsolver_function_gesvdj, alg));
+
     // check non-supported values
     if((rightv != rocblas_svect_none && rightv != rocblas_svect_singular && rightv != rocblas_svect_all)
        || (leftv != rocblas_svect_none && leftv != rocblas_svect_singular
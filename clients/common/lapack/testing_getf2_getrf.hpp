@@ -29,6 +29,7 @@
 
 #include "common/misc/client_util.hpp"
 #include "common/misc/clientcommon.hpp"
+#include "common/misc/device_data_initializer.hpp"
 #include "common/misc/lapack_host_reference.hpp"
 #include "common/misc/norm.hpp"
 #include "common/misc/rocsolver.hpp"
@@ -148,7 +149,7 @@ void getf2_getrf_initData(const rocblas_handle handle,
                           Uh& hIpiv,
                           const bool singular)
 {
-    if(CPU)
+    if(CPU && !rocsolver_bench_device_init)
     {
         T tmp;
         rocblas_init<T>(hA, true);
@@ -203,8 +204,18 @@ void getf2_getrf_initData(const rocblas_handle handle,
 
     if(GPU)
     {
-        // now copy data to the GPU
-        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        if(rocsolver_bench_device_init)
+        {
+            // generate a random matrix directly on the GPU
+            hipStream_t stream;
+            CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+            device_init_matrix<T>(device_init_general, m, n, dA.data(), lda, stA, bc, stream);
+        }
+        else
+        {
+            // now copy data to the GPU
+            CHECK_HIP_ERROR(dA.transfer_from(hA));
+        }
     }
 }
 
@@ -226,12 +237,18 @@ void getf2_getrf_getError(const rocblas_handle handle,
                           Uh& hInfo,
                           Ih& hInfoRes,
                           double* max_err,
-                          const bool singular)
+                          const bool singular,
+                          const bool tournament)
 {
     // input data initialization
     getf2_getrf_initData<true, true, T>(handle, m, n, dA, lda, stA, dIpiv, stP, dInfo, bc, hA,
                                         hIpiv, singular);
 
+    // keep the original matrices to check the tournament pivoting
+    std::vector<std::vector<T>> hA0(tournament ? bc : 0);
+    for(I b = 0; b < I(hA0.size()); ++b)
+        hA0[b].assign(hA[b], hA[b] + size_t(lda) * n);
+
     // execute computations
     // GPU lapack
     CHECK_ROCBLAS_ERROR(rocsolver_getf2_getrf(STRIDED, GETRF, handle, m, n, dA.data(), lda, stA,
@@ -254,7 +271,25 @@ void getf2_getrf_getError(const rocblas_handle handle,
     // using frobenius norm
     double err;
     *max_err = 0;
-    for(I b = 0; b < bc; ++b)
+    for(I b = 0; b < bc && tournament; ++b)
+    {
+        // the pivots selected by tournament may differ from those of partial pivoting:
+        // error is ||A - P'LU|| / ||A|| (using frobenius norm)
+        I k = min(m, n);
+        std::vector<T> LU(size_t(lda) * n, T(0));
+        for(I j = 0; j < n; ++j)
+            for(I i = 0; i < m; ++i)
+                for(I l = 0; l <= min(min(i, j), k - 1); ++l)
+                    LU[i + j * lda]
+                        += (l == i ? T(1) : hARes[b][i + l * lda]) * hARes[b][l + j * lda];
+        for(I i = k - 1; i >= 0; --i)
+            for(I j = 0; j < n; ++j)
+                std::swap(LU[i + j * lda], LU[hIpivRes[b][i] - 1 + j * lda]);
+
+        err = norm_error('F', m, n, lda, hA0[b].data(), LU.data());
+        *max_err = err > *max_err ? err : *max_err;
+    }
+    for(I b = 0; b < bc && !tournament; ++b)
     {
         err = norm_error('F', m, n, lda, hA[b], hARes[b]);
         *max_err = err > *max_err ? err : *max_err;
@@ -303,7 +338,7 @@ void getf2_getrf_getPerfData(const rocblas_handle handle,
                              const bool perf,
                              const bool singular)
 {
-    if(!perf)
+    if(!perf && !rocsolver_bench_device_init)
     {
         getf2_getrf_initData<true, false, T>(handle, m, n, dA, lda, stA, dIpiv, stP, dInfo, bc, hA,
                                              hIpiv, singular);
@@ -317,6 +352,8 @@ void getf2_getrf_getPerfData(const rocblas_handle handle,
         }
         *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
     }
+    else if(rocsolver_bench_device_init)
+        *cpu_time_used = nan(""); // no host data for cpu-lapack execution
 
     getf2_getrf_initData<true, false, T>(handle, m, n, dA, lda, stA, dIpiv, stP, dInfo, bc, hA,
                                          hIpiv, singular);
@@ -327,6 +364,7 @@ void getf2_getrf_getPerfData(const rocblas_handle handle,
         getf2_getrf_initData<false, true, T>(handle, m, n, dA, lda, stA, dIpiv, stP, dInfo, bc, hA,
                                              hIpiv, singular);
 
+        rocsolver_bench_first_call first_call(handle, iter);
         CHECK_ROCBLAS_ERROR(rocsolver_getf2_getrf(STRIDED, GETRF, handle, m, n, dA.data(), lda, stA,
                                                   dIpiv.data(), stP, dInfo.data(), bc));
     }
@@ -334,7 +372,7 @@ void getf2_getrf_getPerfData(const rocblas_handle handle,
     // gpu-lapack performance
     hipStream_t stream;
     CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
-    double start;
+    rocsolver_bench_timer timer(stream, hot_calls);
 
     if(profile > 0)
     {
@@ -346,15 +384,15 @@ void getf2_getrf_getPerfData(const rocblas_handle handle,
         rocsolver_log_set_max_levels(profile);
     }
 
-    for(int iter = 0; iter < hot_calls; iter++)
+    for(int iter = 0; iter < timer.calls(); iter++)
     {
         getf2_getrf_initData<false, true, T>(handle, m, n, dA, lda, stA, dIpiv, stP, dInfo, bc, hA,
                                              hIpiv, singular);
 
-        start = get_time_us_sync(stream);
+        timer.start(iter);
         rocsolver_getf2_getrf(STRIDED, GETRF, handle, m, n, dA.data(), lda, stA, dIpiv.data(), stP,
                               dInfo.data(), bc);
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        *gpu_time_used += timer.stop(iter);
     }
     *gpu_time_used /= hot_calls;
 }
@@ -369,13 +407,19 @@ void testing_getf2_getrf(Arguments& argus)
     I lda = argus.get<rocblas_int>("lda", m);
     rocblas_stride stA = argus.get<rocblas_stride>("strideA", lda * n);
     rocblas_stride stP = argus.get<rocblas_stride>("strideP", min(m, n));
+    char algC = GETRF ? argus.get<char>("alg_mode", 'Q') : 'Q';
 
+    rocsolver_alg_mode alg = char2rocsolver_alg_mode(algC);
     I bc = argus.batch_count;
     int hot_calls = argus.iters;
 
     rocblas_stride stARes = (argus.unit_check || argus.norm_check) ? stA : 0;
     rocblas_stride stPRes = (argus.unit_check || argus.norm_check) ? stP : 0;
 
+    // select tournament pivoting if required
+    if(GETRF)
+        CHECK_ROCBLAS_ERROR(rocsolver_set_alg_mode(handle, rocsolver_function_getrf, alg));
+
     // check non-supported values
     // N/A
 
@@ -387,6 +431,10 @@ void testing_getf2_getrf(Arguments& argus)
     size_t size_ARes = (argus.unit_check || argus.norm_check) ? size_A : 0;
     size_t size_PRes = (argus.unit_check || argus.norm_check) ? size_P : 0;
 
+    // the host copy of A is not needed if the input data is generated on the device
+    size_t size_hA = rocsolver_bench_device_init ? 0 : size_A;
+    rocblas_stride sthA = rocsolver_bench_device_init ? 0 : stA;
+
     // check invalid sizes
     bool invalid_size = (m < 0 || n < 0 || lda < m || bc < 0);
     if(invalid_size)
@@ -432,7 +480,7 @@ void testing_getf2_getrf(Arguments& argus)
     if(BATCHED)
     {
         // memory allocations
-        host_batch_vector<T> hA(size_A, 1, bc);
+        host_batch_vector<T> hA(size_hA, 1, bc);
         host_batch_vector<T> hARes(size_ARes, 1, bc);
         host_strided_batch_vector<rocblas_int> hIpiv(size_P, 1, stP, bc);
         host_strided_batch_vector<I> hIpivRes(size_PRes, 1, stPRes, bc);
@@ -463,7 +511,7 @@ void testing_getf2_getrf(Arguments& argus)
         if(argus.unit_check || argus.norm_check)
             getf2_getrf_getError<STRIDED, GETRF, T>(handle, m, n, dA, lda, stA, dIpiv, stP, dInfo,
                                                     bc, hA, hARes, hIpiv, hIpivRes, hInfo, hInfoRes,
-                                                    &max_error, argus.singular);
+                                                    &max_error, argus.singular, algC == 'T');
 
         // collect performance data
         if(argus.timing)
@@ -476,7 +524,7 @@ void testing_getf2_getrf(Arguments& argus)
     else
     {
         // memory allocations
-        host_strided_batch_vector<T> hA(size_A, 1, stA, bc);
+        host_strided_batch_vector<T> hA(size_hA, 1, sthA, bc);
         host_strided_batch_vector<T> hARes(size_ARes, 1, stARes, bc);
         host_strided_batch_vector<rocblas_int> hIpiv(size_P, 1, stP, bc);
         host_strided_batch_vector<I> hIpivRes(size_PRes, 1, stPRes, bc);
@@ -507,7 +555,7 @@ void testing_getf2_getrf(Arguments& argus)
         if(argus.unit_check || argus.norm_check)
             getf2_getrf_getError<STRIDED, GETRF, T>(handle, m, n, dA, lda, stA, dIpiv, stP, dInfo,
                                                     bc, hA, hARes, hIpiv, hIpivRes, hInfo, hInfoRes,
-                                                    &max_error, argus.singular);
+                                                    &max_error, argus.singular, algC == 'T');
 
         // collect performance data
         if(argus.timing)
@@ -280,6 +280,7 @@ void getf2_getrf_npvt_getPerfData(const rocblas_handle handle,
         getf2_getrf_npvt_initData<false, true, T>(handle, m, n, dA, lda, stA, dInfo, bc, hA,
                                                   singular);
 
+        rocsolver_bench_first_call first_call(handle, iter);
         CHECK_ROCBLAS_ERROR(rocsolver_getf2_getrf_npvt(STRIDED, GETRF, handle, m, n, dA.data(), lda,
                                                        stA, dInfo.data(), bc));
     }
@@ -287,7 +288,7 @@ void getf2_getrf_npvt_getPerfData(const rocblas_handle handle,
     // gpu-lapack performance
     hipStream_t stream;
     CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
-    double start;
+    rocsolver_bench_timer timer(stream, hot_calls);
 
     if(profile > 0)
     {
@@ -298,15 +299,15 @@ void getf2_getrf_npvt_getPerfData(const rocblas_handle handle,
             rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile);
         rocsolver_log_set_max_levels(profile);
     }
-    for(int iter = 0; iter < hot_calls; iter++)
+    for(int iter = 0; iter < timer.calls(); iter++)
     {
         getf2_getrf_npvt_initData<false, true, T>(handle, m, n, dA, lda, stA, dInfo, bc, hA,
                                                   singular);
 
-        start = get_time_us_sync(stream);
+        timer.start(iter);
         rocsolver_getf2_getrf_npvt(STRIDED, GETRF, handle, m, n, dA.data(), lda, stA, dInfo.data(),
                                    bc);
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        *gpu_time_used += timer.stop(iter);
     }
     *gpu_time_used /= hot_calls;
 }
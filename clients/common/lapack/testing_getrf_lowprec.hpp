@@ -0,0 +1,477 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "common/misc/client_util.hpp"
+#include "common/misc/clientcommon.hpp"
+#include "common/misc/lapack_host_reference.hpp"
+#include "common/misc/norm.hpp"
+#include "common/misc/rocsolver.hpp"
+#include "common/misc/rocsolver_arguments.hpp"
+#include "common/misc/rocsolver_test.hpp"
+
+/** The routines with half or bfloat16 storage are checked against the single precision reference,
+    computed from the same input data (rounded to the storage precision). LOWPREC_HOST_COPY copies
+    the m-by-n matrices A into B, converting their entries to the type of B. **/
+template <typename Ta, typename Tb>
+void lowprec_host_copy(const rocblas_int m,
+                       const rocblas_int n,
+                       Ta& A,
+                       const rocblas_int lda,
+                       Tb& B,
+                       const rocblas_int ldb,
+                       const rocblas_int bc)
+{
+    using S = std::remove_reference_t<decltype(B[0][0])>;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        for(rocblas_int j = 0; j < n; j++)
+        {
+            for(rocblas_int i = 0; i < m; i++)
+                B[b][i + j * ldb] = static_cast<S>(static_cast<float>(A[b][i + j * lda]));
+        }
+    }
+}
+
+template <bool NPVT, typename T, typename U>
+void getrf_lowprec_checkBadArgs(const rocblas_handle handle,
+                                const rocblas_int m,
+                                const rocblas_int n,
+                                T dA,
+                                const rocblas_int lda,
+                                const rocblas_stride stA,
+                                U dIpiv,
+                                const rocblas_stride stP,
+                                U dInfo,
+                                const rocblas_int bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_getrf_lowprec(NPVT, nullptr, m, n, dA, lda, stA, dIpiv, stP, dInfo, bc),
+        rocblas_status_invalid_handle);
+
+    // values
+    // N/A
+
+    // sizes (only check batch_count if applicable)
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_getrf_lowprec(NPVT, handle, m, n, dA, lda, stA, dIpiv, stP, dInfo, -1),
+        rocblas_status_invalid_size);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_getrf_lowprec(NPVT, handle, m, n, (T) nullptr, lda, stA, dIpiv, stP, dInfo, bc),
+        rocblas_status_invalid_pointer);
+    if(!NPVT)
+        EXPECT_ROCBLAS_STATUS(rocsolver_getrf_lowprec(NPVT, handle, m, n, dA, lda, stA, (U) nullptr,
+                                                      stP, dInfo, bc),
+                              rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_getrf_lowprec(NPVT, handle, m, n, dA, lda, stA, dIpiv, stP, (U) nullptr, bc),
+        rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrf_lowprec(NPVT, handle, 0, n, (T) nullptr, lda, stA,
+                                                  (U) nullptr, stP, dInfo, bc),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrf_lowprec(NPVT, handle, m, 0, (T) nullptr, lda, stA,
+                                                  (U) nullptr, stP, dInfo, bc),
+                          rocblas_status_success);
+
+    // quick return with zero batch_count
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_getrf_lowprec(NPVT, handle, m, n, dA, lda, stA, dIpiv, stP, (U) nullptr, 0),
+        rocblas_status_success);
+}
+
+template <bool NPVT, typename T>
+void testing_getrf_lowprec_bad_arg()
+{
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_int m = 1;
+    rocblas_int n = 1;
+    rocblas_int lda = 1;
+    rocblas_stride stA = 1;
+    rocblas_stride stP = 1;
+    rocblas_int bc = 1;
+
+    // memory allocations
+    device_strided_batch_vector<T> dA(1, 1, 1, 1);
+    device_strided_batch_vector<rocblas_int> dIpiv(1, 1, 1, 1);
+    device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dIpiv.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    // check bad arguments
+    getrf_lowprec_checkBadArgs<NPVT>(handle, m, n, dA.data(), lda, stA, dIpiv.data(), stP,
+                                     dInfo.data(), bc);
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Th, typename Fh>
+void getrf_lowprec_initData(const rocblas_handle handle,
+                            const rocblas_int m,
+                            const rocblas_int n,
+                            Td& dA,
+                            const rocblas_int lda,
+                            const rocblas_stride stA,
+                            const rocblas_int bc,
+                            Th& hA,
+                            Fh& hAf,
+                            const bool singular)
+{
+    if(CPU)
+    {
+        rocblas_init<float>(hAf, true);
+
+        // scale A to avoid singularities
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            for(rocblas_int i = 0; i < m; i++)
+            {
+                for(rocblas_int j = 0; j < n; j++)
+                {
+                    if(i == j)
+                        hAf[b][i + j * lda] += 400;
+                    else
+                        hAf[b][i + j * lda] -= 4;
+                }
+            }
+
+            if(singular && (b == bc / 4 || b == bc / 2 || b == bc - 1))
+            {
+                // When required, add some singularities
+                // (always the same elements for debugging purposes).
+                // The algorithm must detect the first zero element in the
+                // diagonal of those matrices in the batch that are singular
+                rocblas_int j = n / 4 + b;
+                j -= (j / n) * n;
+                for(rocblas_int i = 0; i < m; i++)
+                    hAf[b][i + j * lda] = 0;
+                j = n / 2 + b;
+                j -= (j / n) * n;
+                for(rocblas_int i = 0; i < m; i++)
+                    hAf[b][i + j * lda] = 0;
+                j = n - 1 + b;
+                j -= (j / n) * n;
+                for(rocblas_int i = 0; i < m; i++)
+                    hAf[b][i + j * lda] = 0;
+            }
+        }
+
+        // round the data to the storage precision
+        lowprec_host_copy(m, n, hAf, lda, hA, lda, bc);
+        lowprec_host_copy(m, n, hA, lda, hAf, lda, bc);
+    }
+
+    if(GPU)
+    {
+        // now copy data to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+    }
+}
+
+template <bool NPVT, typename T, typename Td, typename Ud, typename Th, typename Fh, typename Uh>
+void getrf_lowprec_getError(const rocblas_handle handle,
+                            const rocblas_int m,
+                            const rocblas_int n,
+                            Td& dA,
+                            const rocblas_int lda,
+                            const rocblas_stride stA,
+                            Ud& dIpiv,
+                            const rocblas_stride stP,
+                            Ud& dInfo,
+                            const rocblas_int bc,
+                            Th& hA,
+                            Th& hARes,
+                            Fh& hAf,
+                            Fh& hAResf,
+                            Uh& hIpiv,
+                            Uh& hInfo,
+                            Uh& hInfoRes,
+                            double* max_err,
+                            const bool singular)
+{
+    // input data initialization
+    getrf_lowprec_initData<true, true, T>(handle, m, n, dA, lda, stA, bc, hA, hAf, singular);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_getrf_lowprec(NPVT, handle, m, n, dA.data(), lda, stA,
+                                                dIpiv.data(), stP, dInfo.data(), bc));
+    CHECK_HIP_ERROR(hARes.transfer_from(dA));
+    CHECK_HIP_ERROR(hInfoRes.transfer_from(dInfo));
+    lowprec_host_copy(m, n, hARes, lda, hAResf, lda, bc);
+
+    // CPU lapack
+    // (the reference factorization is computed in single precision;
+    // no pivoting is required by the test matrices when NPVT)
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        cpu_getrf(m, n, hAf[b], lda, hIpiv[b], hInfo[b]);
+    }
+
+    // expecting original matrix to be non-singular
+    // error is ||hA - hARes|| / ||hA|| (ideally ||LU - Lres Ures|| / ||LU||)
+    // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
+    // IT MIGHT BE REVISITED IN THE FUTURE)
+    // using frobenius norm
+    double err;
+    *max_err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        err = norm_error('F', m, n, lda, hAf[b], hAResf[b]);
+        *max_err = err > *max_err ? err : *max_err;
+    }
+
+    // also check info for singularities
+    err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        EXPECT_EQ(hInfo[b][0], hInfoRes[b][0]) << "where b = " << b;
+        if(hInfo[b][0] != hInfoRes[b][0])
+            err++;
+    }
+    *max_err += err;
+}
+
+template <bool NPVT, typename T, typename Td, typename Ud, typename Th, typename Fh, typename Uh>
+void getrf_lowprec_getPerfData(const rocblas_handle handle,
+                               const rocblas_int m,
+                               const rocblas_int n,
+                               Td& dA,
+                               const rocblas_int lda,
+                               const rocblas_stride stA,
+                               Ud& dIpiv,
+                               const rocblas_stride stP,
+                               Ud& dInfo,
+                               const rocblas_int bc,
+                               Th& hA,
+                               Fh& hAf,
+                               Uh& hIpiv,
+                               Uh& hInfo,
+                               double* gpu_time_used,
+                               double* cpu_time_used,
+                               const rocblas_int hot_calls,
+                               const int profile,
+                               const bool profile_kernels,
+                               const bool perf,
+                               const bool singular)
+{
+    if(!perf)
+    {
+        getrf_lowprec_initData<true, false, T>(handle, m, n, dA, lda, stA, bc, hA, hAf, singular);
+
+        // cpu-lapack performance (only if not in perf mode)
+        *cpu_time_used = get_time_us_no_sync();
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            cpu_getrf(m, n, hAf[b], lda, hIpiv[b], hInfo[b]);
+        }
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    getrf_lowprec_initData<true, false, T>(handle, m, n, dA, lda, stA, bc, hA, hAf, singular);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        getrf_lowprec_initData<false, true, T>(handle, m, n, dA, lda, stA, bc, hA, hAf, singular);
+
+        rocsolver_bench_first_call first_call(handle, iter);
+        CHECK_ROCBLAS_ERROR(rocsolver_getrf_lowprec(NPVT, handle, m, n, dA.data(), lda, stA,
+                                                    dIpiv.data(), stP, dInfo.data(), bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    rocsolver_bench_timer timer(stream, hot_calls);
+
+    if(profile > 0)
+    {
+        if(profile_kernels)
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile
+                                         | rocblas_layer_mode_ex_log_kernel);
+        else
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile);
+        rocsolver_log_set_max_levels(profile);
+    }
+
+    for(rocblas_int iter = 0; iter < timer.calls(); iter++)
+    {
+        getrf_lowprec_initData<false, true, T>(handle, m, n, dA, lda, stA, bc, hA, hAf, singular);
+
+        timer.start(iter);
+        rocsolver_getrf_lowprec(NPVT, handle, m, n, dA.data(), lda, stA, dIpiv.data(), stP,
+                                dInfo.data(), bc);
+        *gpu_time_used += timer.stop(iter);
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <bool NPVT, typename T>
+void testing_getrf_lowprec(Arguments& argus)
+{
+    // get arguments
+    rocblas_local_handle handle;
+    rocblas_int m = argus.get<rocblas_int>("m");
+    rocblas_int n = argus.get<rocblas_int>("n", m);
+    rocblas_int lda = argus.get<rocblas_int>("lda", m);
+    rocblas_stride stA = argus.get<rocblas_stride>("strideA", lda * n);
+    rocblas_stride stP = argus.get<rocblas_stride>("strideP", min(m, n));
+
+    rocblas_int bc = argus.batch_count;
+    rocblas_int hot_calls = argus.iters;
+
+    rocblas_stride stARes = (argus.unit_check || argus.norm_check) ? stA : 0;
+
+    // check non-supported values
+    // N/A
+
+    // determine sizes
+    size_t size_A = size_t(lda) * n;
+    size_t size_P = size_t(min(m, n));
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_ARes = (argus.unit_check || argus.norm_check) ? size_A : 0;
+
+    // check invalid sizes
+    bool invalid_size = (m < 0 || n < 0 || lda < m || bc < 0);
+    if(invalid_size)
+    {
+        EXPECT_ROCBLAS_STATUS(rocsolver_getrf_lowprec(NPVT, handle, m, n, (T*)nullptr, lda, stA,
+                                                      (rocblas_int*)nullptr, stP,
+                                                      (rocblas_int*)nullptr, bc),
+                              rocblas_status_invalid_size);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_size);
+
+        return;
+    }
+
+    // memory size query is necessary
+    if(argus.mem_query || !USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        CHECK_ALLOC_QUERY(rocsolver_getrf_lowprec(NPVT, handle, m, n, (T*)nullptr, lda, stA,
+                                                  (rocblas_int*)nullptr, stP, (rocblas_int*)nullptr,
+                                                  bc));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        if(argus.mem_query)
+        {
+            rocsolver_bench_inform(inform_mem_query, size);
+            return;
+        }
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    // memory allocations
+    host_strided_batch_vector<T> hA(size_A, 1, stA, bc);
+    host_strided_batch_vector<T> hARes(size_ARes, 1, stARes, bc);
+    host_strided_batch_vector<float> hAf(size_A, 1, stA, bc);
+    host_strided_batch_vector<float> hAResf(size_ARes, 1, stARes, bc);
+    host_strided_batch_vector<rocblas_int> hIpiv(size_P, 1, stP, bc);
+    host_strided_batch_vector<rocblas_int> hInfo(1, 1, 1, bc);
+    host_strided_batch_vector<rocblas_int> hInfoRes(1, 1, 1, bc);
+    device_strided_batch_vector<T> dA(size_A, 1, stA, bc);
+    device_strided_batch_vector<rocblas_int> dIpiv(size_P, 1, stP, bc);
+    device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, bc);
+    if(size_A)
+        CHECK_HIP_ERROR(dA.memcheck());
+    if(size_P)
+        CHECK_HIP_ERROR(dIpiv.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    // check quick return
+    if(m == 0 || n == 0 || bc == 0)
+    {
+        EXPECT_ROCBLAS_STATUS(rocsolver_getrf_lowprec(NPVT, handle, m, n, dA.data(), lda, stA,
+                                                      dIpiv.data(), stP, dInfo.data(), bc),
+                              rocblas_status_success);
+        if(argus.timing)
+            rocsolver_bench_inform(inform_quick_return);
+
+        return;
+    }
+
+    // check computations
+    if(argus.unit_check || argus.norm_check)
+        getrf_lowprec_getError<NPVT, T>(handle, m, n, dA, lda, stA, dIpiv, stP, dInfo, bc, hA,
+                                        hARes, hAf, hAResf, hIpiv, hInfo, hInfoRes, &max_error,
+                                        argus.singular);
+
+    // collect performance data
+    if(argus.timing)
+        getrf_lowprec_getPerfData<NPVT, T>(handle, m, n, dA, lda, stA, dIpiv, stP, dInfo, bc, hA,
+                                           hAf, hIpiv, hInfo, &gpu_time_used, &cpu_time_used,
+                                           hot_calls, argus.profile, argus.profile_kernels,
+                                           argus.perf, argus.singular);
+
+    // validate results for rocsolver-test
+    // using min(m,n) * machine_precision (of the storage type) as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, min(m, n));
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            rocsolver_bench_header("Arguments:");
+            rocsolver_bench_output("m", "n", "lda", "strideA", "strideP", "batch_c");
+            rocsolver_bench_output(m, n, lda, stA, stP, bc);
+            rocsolver_bench_header("Results:");
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_bench_endl();
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
@@ -327,6 +327,7 @@ void getri_outofplace_getPerfData(const rocblas_handle handle,
         getri_outofplace_initData<false, true, T>(handle, n, dA, lda, dIpiv, bc, hA, hIpiv, hInfo,
                                                   singular);
 
+        rocsolver_bench_first_call first_call(handle, iter);
         CHECK_ROCBLAS_ERROR(rocsolver_getri_outofplace(STRIDED, handle, n, dA.data(), lda, stA,
                                                        dIpiv.data(), stP, dC.data(), ldc, stC,
                                                        dInfo.data(), bc));
@@ -335,7 +336,7 @@ void getri_outofplace_getPerfData(const rocblas_handle handle,
     // gpu-lapack performance
     hipStream_t stream;
     CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
-    double start;
+    rocsolver_bench_timer timer(stream, hot_calls);
 
     if(profile > 0)
     {
@@ -347,15 +348,15 @@ void getri_outofplace_getPerfData(const rocblas_handle handle,
         rocsolver_log_set_max_levels(profile);
     }
 
-    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    for(rocblas_int iter = 0; iter < timer.calls(); iter++)
     {
         getri_outofplace_initData<false, true, T>(handle, n, dA, lda, dIpiv, bc, hA, hIpiv, hInfo,
                                                   singular);
 
-        start = get_time_us_sync(stream);
+        timer.start(iter);
         rocsolver_getri_outofplace(STRIDED, handle, n, dA.data(), lda, stA, dIpiv.data(), stP,
                                    dC.data(), ldc, stC, dInfo.data(), bc);
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        *gpu_time_used += timer.stop(iter);
     }
     *gpu_time_used /= hot_calls;
 }
@@ -0,0 +1,465 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "common/lapack/testing_getrf_lowprec.hpp"
+
+template <typename T, typename U>
+void getrs_lowprec_checkBadArgs(const rocblas_handle handle,
+                                const rocblas_operation trans,
+                                const rocblas_int n,
+                                const rocblas_int nrhs,
+                                T dA,
+                                const rocblas_int lda,
+                                const rocblas_stride stA,
+                                U dIpiv,
+                                const rocblas_stride stP,
+                                T dB,
+                                const rocblas_int ldb,
+                                const rocblas_stride stB,
+                                const rocblas_int bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrs_lowprec(nullptr, trans, n, nrhs, dA, lda, stA, dIpiv,
+                                                  stP, dB, ldb, stB, bc),
+                          rocblas_status_invalid_handle);
+
+    // values
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrs_lowprec(handle, rocblas_operation(0), n, nrhs, dA, lda,
+                                                  stA, dIpiv, stP, dB, ldb, stB, bc),
+                          rocblas_status_invalid_value);
+
+    // sizes (only check batch_count if applicable)
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrs_lowprec(handle, trans, n, nrhs, dA, lda, stA, dIpiv, stP,
+                                                  dB, ldb, stB, -1),
+                          rocblas_status_invalid_size);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrs_lowprec(handle, trans, n, nrhs, (T) nullptr, lda, stA,
+                                                  dIpiv, stP, dB, ldb, stB, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrs_lowprec(handle, trans, n, nrhs, dA, lda, stA,
+                                                  (U) nullptr, stP, dB, ldb, stB, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrs_lowprec(handle, trans, n, nrhs, dA, lda, stA, dIpiv, stP,
+                                                  (T) nullptr, ldb, stB, bc),
+                          rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrs_lowprec(handle, trans, 0, nrhs, (T) nullptr, lda, stA,
+                                                  (U) nullptr, stP, (T) nullptr, ldb, stB, bc),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrs_lowprec(handle, trans, n, 0, dA, lda, stA, dIpiv, stP,
+                                                  (T) nullptr, ldb, stB, bc),
+                          rocblas_status_success);
+
+    // quick return with zero batch_count
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrs_lowprec(handle, trans, n, nrhs, dA, lda, stA, dIpiv, stP,
+                                                  dB, ldb, stB, 0),
+                          rocblas_status_success);
+}
+
+template <typename T>
+void testing_getrs_lowprec_bad_arg()
+{
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_int n = 1;
+    rocblas_int nrhs = 1;
+    rocblas_int lda = 1;
+    rocblas_int ldb = 1;
+    rocblas_stride stA = 1;
+    rocblas_stride stP = 1;
+    rocblas_stride stB = 1;
+    rocblas_int bc = 1;
+    rocblas_operation trans = rocblas_operation_none;
+
+    // memory allocations
+    device_strided_batch_vector<T> dA(1, 1, 1, 1);
+    device_strided_batch_vector<T> dB(1, 1, 1, 1);
+    device_strided_batch_vector<rocblas_int> dIpiv(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dB.memcheck());
+    CHECK_HIP_ERROR(dIpiv.memcheck());
+
+    // check bad arguments
+    getrs_lowprec_checkBadArgs(handle, trans, n, nrhs, dA.data(), lda, stA, dIpiv.data(), stP,
+                               dB.data(), ldb, stB, bc);
+}
+
+template <bool CPU,
+          bool GPU,
+          typename T,
+          typename Td,
+          typename Ud,
+          typename Th,
+          typename Fh,
+          typename Uh>
+void getrs_lowprec_initData(const rocblas_handle handle,
+                            const rocblas_operation trans,
+                            const rocblas_int n,
+                            const rocblas_int nrhs,
+                            Td& dA,
+                            const rocblas_int lda,
+                            const rocblas_stride stA,
+                            Ud& dIpiv,
+                            const rocblas_stride stP,
+                            Td& dB,
+                            const rocblas_int ldb,
+                            const rocblas_stride stB,
+                            const rocblas_int bc,
+                            Th& hA,
+                            Fh& hAf,
+                            Uh& hIpiv,
+                            Th& hB,
+                            Fh& hBf)
+{
+    if(CPU)
+    {
+        rocblas_init<float>(hAf, true);
+        rocblas_init<float>(hBf, true);
+
+        // scale A to avoid singularities
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            for(rocblas_int i = 0; i < n; i++)
+            {
+                for(rocblas_int j = 0; j < n; j++)
+                {
+                    if(i == j)
+                        hAf[b][i + j * lda] += 400;
+                    else
+                        hAf[b][i + j * lda] -= 4;
+                }
+            }
+        }
+
+        // do the LU decomposition of matrix A w/ the reference LAPACK routine
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            int info;
+            cpu_getrf(n, n, hAf[b], lda, hIpiv[b], &info);
+        }
+
+        // round the factors and the right-hand sides to the storage precision
+        lowprec_host_copy(n, n, hAf, lda, hA, lda, bc);
+        lowprec_host_copy(n, n, hA, lda, hAf, lda, bc);
+        lowprec_host_copy(n, nrhs, hBf, ldb, hB, ldb, bc);
+        lowprec_host_copy(n, nrhs, hB, ldb, hBf, ldb, bc);
+    }
+
+    if(GPU)
+    {
+        // now copy pivoting indices and matrices to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        CHECK_HIP_ERROR(dB.transfer_from(hB));
+        CHECK_HIP_ERROR(dIpiv.transfer_from(hIpiv));
+    }
+}
+
+template <typename T, typename Td, typename Ud, typename Th, typename Fh, typename Uh>
+void getrs_lowprec_getError(const rocblas_handle handle,
+                            const rocblas_operation trans,
+                            const rocblas_int n,
+                            const rocblas_int nrhs,
+                            Td& dA,
+                            const rocblas_int lda,
+                            const rocblas_stride stA,
+                            Ud& dIpiv,
+                            const rocblas_stride stP,
+                            Td& dB,
+                            const rocblas_int ldb,
+                            const rocblas_stride stB,
+                            const rocblas_int bc,
+                            Th& hA,
+                            Fh& hAf,
+                            Uh& hIpiv,
+                            Th& hB,
+                            Th& hBRes,
+                            Fh& hBf,
+                            Fh& hBResf,
+                            double* max_err)
+{
+    // input data initialization
+    getrs_lowprec_initData<true, true, T>(handle, trans, n, nrhs, dA, lda, stA, dIpiv, stP, dB, ldb,
+                                          stB, bc, hA, hAf, hIpiv, hB, hBf);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_getrs_lowprec(handle, trans, n, nrhs, dA.data(), lda, stA,
+                                                dIpiv.data(), stP, dB.data(), ldb, stB, bc));
+    CHECK_HIP_ERROR(hBRes.transfer_from(dB));
+    lowprec_host_copy(n, nrhs, hBRes, ldb, hBResf, ldb, bc);
+
+    // CPU lapack
+    // (the reference solution is computed in single precision)
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        cpu_getrs(trans, n, nrhs, hAf[b], lda, hIpiv[b], hBf[b], ldb);
+    }
+
+    // error is ||hB - hBRes|| / ||hB||
+    // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
+    // IT MIGHT BE REVISITED IN THE FUTURE)
+    // using vector-induced infinity norm
+    double err;
+    *max_err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        err = norm_error('I', n, nrhs, ldb, hBf[b], hBResf[b]);
+        *max_err = err > *max_err ? err : *max_err;
+    }
+}
+
+template <typename T, typename Td, typename Ud, typename Th, typename Fh, typename Uh>
+void getrs_lowprec_getPerfData(const rocblas_handle handle,
+                               const rocblas_operation trans,
+                               const rocblas_int n,
+                               const rocblas_int nrhs,
+                               Td& dA,
+                               const rocblas_int lda,
+                               const rocblas_stride stA,
+                               Ud& dIpiv,
+                               const rocblas_stride stP,
+                               Td& dB,
+                               const rocblas_int ldb,
+                               const rocblas_stride stB,
+                               const rocblas_int bc,
+                               Th& hA,
+                               Fh& hAf,
+                               Uh& hIpiv,
+                               Th& hB,
+                               Fh& hBf,
+                               double* gpu_time_used,
+                               double* cpu_time_used,
+                               const rocblas_int hot_calls,
+                               const int profile,
+                               const bool profile_kernels,
+                               const bool perf)
+{
+    if(!perf)
+    {
+        getrs_lowprec_initData<true, false, T>(handle, trans, n, nrhs, dA, lda, stA, dIpiv, stP, dB,
+                                               ldb, stB, bc, hA, hAf, hIpiv, hB, hBf);
+
+        // cpu-lapack performance (only if not in perf mode)
+        *cpu_time_used = get_time_us_no_sync();
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            cpu_getrs(trans, n, nrhs, hAf[b], lda, hIpiv[b], hBf[b], ldb);
+        }
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    getrs_lowprec_initData<true, false, T>(handle, trans, n, nrhs, dA, lda, stA, dIpiv, stP, dB,
+                                           ldb, stB, bc, hA, hAf, hIpiv, hB, hBf);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        getrs_lowprec_initData<false, true, T>(handle, trans, n, nrhs, dA, lda, stA, dIpiv, stP, dB,
+                                               ldb, stB, bc, hA, hAf, hIpiv, hB, hBf);
+
+        rocsolver_bench_first_call first_call(handle, iter);
+        CHECK_ROCBLAS_ERROR(rocsolver_getrs_lowprec(handle, trans, n, nrhs, dA.data(), lda, stA,
+                                                    dIpiv.data(), stP, dB.data(), ldb, stB, bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    rocsolver_bench_timer timer(stream, hot_calls);
+
+    if(profile > 0)
+    {
+        if(profile_kernels)
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile
+                                         | rocblas_layer_mode_ex_log_kernel);
+        else
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile);
+        rocsolver_log_set_max_levels(profile);
+    }
+
+    for(rocblas_int iter = 0; iter < timer.calls(); iter++)
+    {
+        getrs_lowprec_initData<false, true, T>(handle, trans, n, nrhs, dA, lda, stA, dIpiv, stP, dB,
+                                               ldb, stB, bc, hA, hAf, hIpiv, hB, hBf);
+
+        timer.start(iter);
+        rocsolver_getrs_lowprec(handle, trans, n, nrhs, dA.data(), lda, stA, dIpiv.data(), stP,
+                                dB.data(), ldb, stB, bc);
+        *gpu_time_used += timer.stop(iter);
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <typename T>
+void testing_getrs_lowprec(Arguments& argus)
+{
+    // get arguments
+    rocblas_local_handle handle;
+    char transC = argus.get<char>("trans");
+    rocblas_int n = argus.get<rocblas_int>("n");
+    rocblas_int nrhs = argus.get<rocblas_int>("nrhs", n);
+    rocblas_int lda = argus.get<rocblas_int>("lda", n);
+    rocblas_int ldb = argus.get<rocblas_int>("ldb", n);
+    rocblas_stride stA = argus.get<rocblas_stride>("strideA", lda * n);
+    rocblas_stride stP = argus.get<rocblas_stride>("strideP", n);
+    rocblas_stride stB = argus.get<rocblas_stride>("strideB", ldb * nrhs);
+
+    rocblas_operation trans = char2rocblas_operation(transC);
+    rocblas_int bc = argus.batch_count;
+    rocblas_int hot_calls = argus.iters;
+
+    rocblas_stride stBRes = (argus.unit_check || argus.norm_check) ? stB : 0;
+
+    // check non-supported values
+    // N/A
+
+    // determine sizes
+    size_t size_A = size_t(lda) * n;
+    size_t size_B = size_t(ldb) * nrhs;
+    size_t size_P = size_t(n);
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_BRes = (argus.unit_check || argus.norm_check) ? size_B : 0;
+
+    // check invalid sizes
+    bool invalid_size = (n < 0 || nrhs < 0 || lda < n || ldb < n || bc < 0);
+    if(invalid_size)
+    {
+        EXPECT_ROCBLAS_STATUS(rocsolver_getrs_lowprec(handle, trans, n, nrhs, (T*)nullptr, lda, stA,
+                                                      (rocblas_int*)nullptr, stP, (T*)nullptr, ldb,
+                                                      stB, bc),
+                              rocblas_status_invalid_size);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_size);
+
+        return;
+    }
+
+    // memory size query is necessary
+    if(argus.mem_query || !USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        CHECK_ALLOC_QUERY(rocsolver_getrs_lowprec(handle, trans, n, nrhs, (T*)nullptr, lda, stA,
+                                                  (rocblas_int*)nullptr, stP, (T*)nullptr, ldb, stB,
+                                                  bc));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        if(argus.mem_query)
+        {
+            rocsolver_bench_inform(inform_mem_query, size);
+            return;
+        }
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    // memory allocations
+    host_strided_batch_vector<T> hA(size_A, 1, stA, bc);
+    host_strided_batch_vector<T> hB(size_B, 1, stB, bc);
+    host_strided_batch_vector<T> hBRes(size_BRes, 1, stBRes, bc);
+    host_strided_batch_vector<float> hAf(size_A, 1, stA, bc);
+    host_strided_batch_vector<float> hBf(size_B, 1, stB, bc);
+    host_strided_batch_vector<float> hBResf(size_BRes, 1, stBRes, bc);
+    host_strided_batch_vector<rocblas_int> hIpiv(size_P, 1, stP, bc);
+    device_strided_batch_vector<T> dA(size_A, 1, stA, bc);
+    device_strided_batch_vector<T> dB(size_B, 1, stB, bc);
+    device_strided_batch_vector<rocblas_int> dIpiv(size_P, 1, stP, bc);
+    if(size_A)
+        CHECK_HIP_ERROR(dA.memcheck());
+    if(size_B)
+        CHECK_HIP_ERROR(dB.memcheck());
+    if(size_P)
+        CHECK_HIP_ERROR(dIpiv.memcheck());
+
+    // check quick return
+    if(n == 0 || nrhs == 0 || bc == 0)
+    {
+        EXPECT_ROCBLAS_STATUS(rocsolver_getrs_lowprec(handle, trans, n, nrhs, dA.data(), lda, stA,
+                                                      dIpiv.data(), stP, dB.data(), ldb, stB, bc),
+                              rocblas_status_success);
+        if(argus.timing)
+            rocsolver_bench_inform(inform_quick_return);
+
+        return;
+    }
+
+    // check computations
+    if(argus.unit_check || argus.norm_check)
+        getrs_lowprec_getError<T>(handle, trans, n, nrhs, dA, lda, stA, dIpiv, stP, dB, ldb, stB,
+                                  bc, hA, hAf, hIpiv, hB, hBRes, hBf, hBResf, &max_error);
+
+    // collect performance data
+    if(argus.timing)
+        getrs_lowprec_getPerfData<T>(handle, trans, n, nrhs, dA, lda, stA, dIpiv, stP, dB, ldb,
+                                     stB, bc, hA, hAf, hIpiv, hB, hBf, &gpu_time_used,
+                                     &cpu_time_used, hot_calls, argus.profile,
+                                     argus.profile_kernels, argus.perf);
+
+    // validate results for rocsolver-test
+    // using n * machine_precision (of the storage type) as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, n);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            rocsolver_bench_header("Arguments:");
+            rocsolver_bench_output("trans", "n", "nrhs", "lda", "ldb", "strideA", "strideP",
+                                   "strideB", "batch_c");
+            rocsolver_bench_output(transC, n, nrhs, lda, ldb, stA, stP, stB, bc);
+            rocsolver_bench_header("Results:");
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_bench_endl();
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
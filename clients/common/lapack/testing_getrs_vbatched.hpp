@@ -0,0 +1,497 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "common/misc/client_util.hpp"
+#include "common/misc/clientcommon.hpp"
+#include "common/misc/lapack_host_reference.hpp"
+#include "common/misc/norm.hpp"
+#include "common/misc/rocsolver.hpp"
+#include "common/misc/rocsolver_arguments.hpp"
+#include "common/misc/rocsolver_test.hpp"
+
+template <typename T, typename U>
+void getrs_vbatched_checkBadArgs(const rocblas_handle handle,
+                                 const rocblas_operation trans,
+                                 U dN,
+                                 U dNrhs,
+                                 T dA,
+                                 U dLda,
+                                 U dIpiv,
+                                 const rocblas_stride stP,
+                                 T dB,
+                                 U dLdb,
+                                 const rocblas_int bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrs_vbatched(nullptr, trans, dN, dNrhs, dA, dLda, dIpiv, stP,
+                                                   dB, dLdb, bc),
+                          rocblas_status_invalid_handle);
+
+    // values
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrs_vbatched(handle, rocblas_operation(0), dN, dNrhs, dA,
+                                                   dLda, dIpiv, stP, dB, dLdb, bc),
+                          rocblas_status_invalid_value);
+
+    // sizes (only check batch_count)
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrs_vbatched(handle, trans, dN, dNrhs, dA, dLda, dIpiv, stP,
+                                                   dB, dLdb, -1),
+                          rocblas_status_invalid_size);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrs_vbatched(handle, trans, (U) nullptr, dNrhs, dA, dLda,
+                                                   dIpiv, stP, dB, dLdb, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrs_vbatched(handle, trans, dN, (U) nullptr, dA, dLda, dIpiv,
+                                                   stP, dB, dLdb, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrs_vbatched(handle, trans, dN, dNrhs, (T) nullptr, dLda,
+                                                   dIpiv, stP, dB, dLdb, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrs_vbatched(handle, trans, dN, dNrhs, dA, (U) nullptr,
+                                                   dIpiv, stP, dB, dLdb, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrs_vbatched(handle, trans, dN, dNrhs, dA, dLda,
+                                                   (U) nullptr, stP, dB, dLdb, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrs_vbatched(handle, trans, dN, dNrhs, dA, dLda, dIpiv, stP,
+                                                   (T) nullptr, dLdb, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrs_vbatched(handle, trans, dN, dNrhs, dA, dLda, dIpiv, stP,
+                                                   dB, (U) nullptr, bc),
+                          rocblas_status_invalid_pointer);
+
+    // quick return with zero batch_count
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrs_vbatched(handle, trans, (U) nullptr, (U) nullptr,
+                                                   (T) nullptr, (U) nullptr, (U) nullptr, stP,
+                                                   (T) nullptr, (U) nullptr, 0),
+                          rocblas_status_success);
+}
+
+template <typename T>
+void testing_getrs_vbatched_bad_arg()
+{
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_operation trans = rocblas_operation_none;
+    rocblas_stride stP = 1;
+    rocblas_int bc = 1;
+
+    // memory allocations
+    device_batch_vector<T> dA(1, 1, 1);
+    device_batch_vector<T> dB(1, 1, 1);
+    device_strided_batch_vector<rocblas_int> dN(1, 1, 1, 1);
+    device_strided_batch_vector<rocblas_int> dNrhs(1, 1, 1, 1);
+    device_strided_batch_vector<rocblas_int> dLda(1, 1, 1, 1);
+    device_strided_batch_vector<rocblas_int> dLdb(1, 1, 1, 1);
+    device_strided_batch_vector<rocblas_int> dIpiv(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dB.memcheck());
+    CHECK_HIP_ERROR(dN.memcheck());
+    CHECK_HIP_ERROR(dNrhs.memcheck());
+    CHECK_HIP_ERROR(dLda.memcheck());
+    CHECK_HIP_ERROR(dLdb.memcheck());
+    CHECK_HIP_ERROR(dIpiv.memcheck());
+
+    // check bad arguments
+    getrs_vbatched_checkBadArgs(handle, trans, dN.data(), dNrhs.data(), dA.data(), dLda.data(),
+                                dIpiv.data(), stP, dB.data(), dLdb.data(), bc);
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Ud, typename Th, typename Uh>
+void getrs_vbatched_initData(const rocblas_handle handle,
+                             Td& dA,
+                             Ud& dIpiv,
+                             Td& dB,
+                             const rocblas_int bc,
+                             Th& hA,
+                             Uh& hIpiv,
+                             Th& hB,
+                             Uh& hN,
+                             Uh& hNrhs,
+                             Uh& hLda,
+                             Uh& hLdb)
+{
+    if(CPU)
+    {
+        rocblas_init<T>(hA, true);
+        rocblas_init<T>(hB, true);
+
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            rocblas_int n = hN[b][0];
+            rocblas_int lda = hLda[b][0];
+
+            // scale A to avoid singularities
+            for(rocblas_int i = 0; i < n; i++)
+            {
+                for(rocblas_int j = 0; j < n; j++)
+                {
+                    if(i == j)
+                        hA[b][i + j * lda] += 400;
+                    else
+                        hA[b][i + j * lda] -= 4;
+                }
+            }
+
+            // do the LU decomposition of matrix A w/ the reference LAPACK routine
+            int info;
+            if(n > 0)
+                cpu_getrf(n, n, hA[b], lda, hIpiv[b], &info);
+        }
+    }
+
+    if(GPU)
+    {
+        // now copy pivoting indices and matrices to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        CHECK_HIP_ERROR(dB.transfer_from(hB));
+        CHECK_HIP_ERROR(dIpiv.transfer_from(hIpiv));
+    }
+}
+
+template <typename T, typename Td, typename Ud, typename Th, typename Uh>
+void getrs_vbatched_getError(const rocblas_handle handle,
+                             const rocblas_operation trans,
+                             Ud& dN,
+                             Ud& dNrhs,
+                             Td& dA,
+                             Ud& dLda,
+                             Ud& dIpiv,
+                             const rocblas_stride stP,
+                             Td& dB,
+                             Ud& dLdb,
+                             const rocblas_int bc,
+                             Uh& hN,
+                             Uh& hNrhs,
+                             Uh& hLda,
+                             Uh& hLdb,
+                             Th& hA,
+                             Uh& hIpiv,
+                             Th& hB,
+                             Th& hBRes,
+                             double* max_err)
+{
+    // input data initialization
+    getrs_vbatched_initData<true, true, T>(handle, dA, dIpiv, dB, bc, hA, hIpiv, hB, hN, hNrhs,
+                                           hLda, hLdb);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_getrs_vbatched(handle, trans, dN.data(), dNrhs.data(), dA.data(),
+                                                 dLda.data(), dIpiv.data(), stP, dB.data(),
+                                                 dLdb.data(), bc));
+    CHECK_HIP_ERROR(hBRes.transfer_from(dB));
+
+    // CPU lapack
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        if(hN[b][0] > 0 && hNrhs[b][0] > 0)
+            cpu_getrs(trans, hN[b][0], hNrhs[b][0], hA[b], hLda[b][0], hIpiv[b], hB[b],
+                      hLdb[b][0]);
+    }
+
+    // error is ||hB - hBRes|| / ||hB||
+    // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
+    // IT MIGHT BE REVISITED IN THE FUTURE)
+    // using vector-induced infinity norm
+    double err;
+    *max_err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        if(hN[b][0] == 0 || hNrhs[b][0] == 0)
+            continue;
+
+        err = norm_error('I', hN[b][0], hNrhs[b][0], hLdb[b][0], hB[b], hBRes[b]);
+        *max_err = err > *max_err ? err : *max_err;
+    }
+}
+
+template <typename T, typename Td, typename Ud, typename Th, typename Uh>
+void getrs_vbatched_getPerfData(const rocblas_handle handle,
+                                const rocblas_operation trans,
+                                Ud& dN,
+                                Ud& dNrhs,
+                                Td& dA,
+                                Ud& dLda,
+                                Ud& dIpiv,
+                                const rocblas_stride stP,
+                                Td& dB,
+                                Ud& dLdb,
+                                const rocblas_int bc,
+                                Uh& hN,
+                                Uh& hNrhs,
+                                Uh& hLda,
+                                Uh& hLdb,
+                                Th& hA,
+                                Uh& hIpiv,
+                                Th& hB,
+                                double* gpu_time_used,
+                                double* cpu_time_used,
+                                const rocblas_int hot_calls,
+                                const int profile,
+                                const bool profile_kernels,
+                                const bool perf)
+{
+    if(!perf)
+    {
+        getrs_vbatched_initData<true, false, T>(handle, dA, dIpiv, dB, bc, hA, hIpiv, hB, hN,
+                                                hNrhs, hLda, hLdb);
+
+        // cpu-lapack performance (only if not in perf mode)
+        *cpu_time_used = get_time_us_no_sync();
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            if(hN[b][0] > 0 && hNrhs[b][0] > 0)
+                cpu_getrs(trans, hN[b][0], hNrhs[b][0], hA[b], hLda[b][0], hIpiv[b], hB[b],
+                          hLdb[b][0]);
+        }
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    getrs_vbatched_initData<true, false, T>(handle, dA, dIpiv, dB, bc, hA, hIpiv, hB, hN, hNrhs,
+                                            hLda, hLdb);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        getrs_vbatched_initData<false, true, T>(handle, dA, dIpiv, dB, bc, hA, hIpiv, hB, hN,
+                                                hNrhs, hLda, hLdb);
+
+        rocsolver_bench_first_call first_call(handle, iter);
+        CHECK_ROCBLAS_ERROR(rocsolver_getrs_vbatched(handle, trans, dN.data(), dNrhs.data(),
+                                                     dA.data(), dLda.data(), dIpiv.data(), stP,
+                                                     dB.data(), dLdb.data(), bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    rocsolver_bench_timer timer(stream, hot_calls);
+
+    if(profile > 0)
+    {
+        if(profile_kernels)
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile
+                                         | rocblas_layer_mode_ex_log_kernel);
+        else
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile);
+        rocsolver_log_set_max_levels(profile);
+    }
+
+    for(rocblas_int iter = 0; iter < timer.calls(); iter++)
+    {
+        getrs_vbatched_initData<false, true, T>(handle, dA, dIpiv, dB, bc, hA, hIpiv, hB, hN,
+                                                hNrhs, hLda, hLdb);
+
+        timer.start(iter);
+        rocsolver_getrs_vbatched(handle, trans, dN.data(), dNrhs.data(), dA.data(), dLda.data(),
+                                 dIpiv.data(), stP, dB.data(), dLdb.data(), bc);
+        *gpu_time_used += timer.stop(iter);
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <typename T>
+void testing_getrs_vbatched(Arguments& argus)
+{
+    // get arguments
+    // (n, nrhs, lda and ldb are the values for the largest instance of the batch;
+    // see vbatched_size for the sizes of the other instances)
+    rocblas_local_handle handle;
+    char transC = argus.get<char>("trans");
+    rocblas_int n = argus.get<rocblas_int>("n");
+    rocblas_int nrhs = argus.get<rocblas_int>("nrhs", n);
+    rocblas_int lda = argus.get<rocblas_int>("lda", n);
+    rocblas_int ldb = argus.get<rocblas_int>("ldb", n);
+    rocblas_stride stP = argus.get<rocblas_stride>("strideP", n);
+
+    rocblas_operation trans = char2rocblas_operation(transC);
+    rocblas_int bc = argus.batch_count;
+    rocblas_int hot_calls = argus.iters;
+
+    // check non-supported values
+    // N/A
+
+    // determine sizes
+    size_t size_A = size_t(lda) * n;
+    size_t size_B = size_t(ldb) * nrhs;
+    size_t size_P = size_t(n);
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_BRes = (argus.unit_check || argus.norm_check) ? size_B : 0;
+
+    // check invalid sizes
+    // (only batch_count is checked by the library)
+    bool invalid_size = (n < 0 || nrhs < 0 || lda < n || ldb < n || bc < 0);
+    if(invalid_size)
+    {
+        if(bc < 0)
+            EXPECT_ROCBLAS_STATUS(
+                rocsolver_getrs_vbatched(handle, trans, (rocblas_int*)nullptr,
+                                         (rocblas_int*)nullptr, (T* const*)nullptr,
+                                         (rocblas_int*)nullptr, (rocblas_int*)nullptr, stP,
+                                         (T* const*)nullptr, (rocblas_int*)nullptr, bc),
+                rocblas_status_invalid_size);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_size);
+
+        return;
+    }
+
+    // memory size query is necessary
+    if(argus.mem_query || !USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        CHECK_ALLOC_QUERY(rocsolver_getrs_vbatched(handle, trans, (rocblas_int*)nullptr,
+                                                   (rocblas_int*)nullptr, (T* const*)nullptr,
+                                                   (rocblas_int*)nullptr, (rocblas_int*)nullptr,
+                                                   stP, (T* const*)nullptr, (rocblas_int*)nullptr,
+                                                   bc));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        if(argus.mem_query)
+        {
+            rocsolver_bench_inform(inform_mem_query, size);
+            return;
+        }
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    // memory allocations
+    host_batch_vector<T> hA(size_A, 1, bc);
+    host_batch_vector<T> hB(size_B, 1, bc);
+    host_batch_vector<T> hBRes(size_BRes, 1, bc);
+    host_strided_batch_vector<rocblas_int> hIpiv(size_P, 1, stP, bc);
+    host_strided_batch_vector<rocblas_int> hN(1, 1, 1, bc);
+    host_strided_batch_vector<rocblas_int> hNrhs(1, 1, 1, bc);
+    host_strided_batch_vector<rocblas_int> hLda(1, 1, 1, bc);
+    host_strided_batch_vector<rocblas_int> hLdb(1, 1, 1, bc);
+    device_batch_vector<T> dA(size_A, 1, bc);
+    device_batch_vector<T> dB(size_B, 1, bc);
+    device_strided_batch_vector<rocblas_int> dIpiv(size_P, 1, stP, bc);
+    device_strided_batch_vector<rocblas_int> dN(1, 1, 1, bc);
+    device_strided_batch_vector<rocblas_int> dNrhs(1, 1, 1, bc);
+    device_strided_batch_vector<rocblas_int> dLda(1, 1, 1, bc);
+    device_strided_batch_vector<rocblas_int> dLdb(1, 1, 1, bc);
+    if(size_A)
+        CHECK_HIP_ERROR(dA.memcheck());
+    if(size_B)
+        CHECK_HIP_ERROR(dB.memcheck());
+    if(size_P)
+        CHECK_HIP_ERROR(dIpiv.memcheck());
+    CHECK_HIP_ERROR(dN.memcheck());
+    CHECK_HIP_ERROR(dNrhs.memcheck());
+    CHECK_HIP_ERROR(dLda.memcheck());
+    CHECK_HIP_ERROR(dLdb.memcheck());
+
+    // set the sizes of the instances
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        hN[b][0] = vbatched_size(b, n);
+        hNrhs[b][0] = vbatched_size(b, nrhs);
+        hLda[b][0] = hN[b][0] + (lda - n);
+        hLdb[b][0] = hN[b][0] + (ldb - n);
+    }
+    CHECK_HIP_ERROR(dN.transfer_from(hN));
+    CHECK_HIP_ERROR(dNrhs.transfer_from(hNrhs));
+    CHECK_HIP_ERROR(dLda.transfer_from(hLda));
+    CHECK_HIP_ERROR(dLdb.transfer_from(hLdb));
+
+    // check quick return
+    if(n == 0 || nrhs == 0 || bc == 0)
+    {
+        EXPECT_ROCBLAS_STATUS(rocsolver_getrs_vbatched(handle, trans, dN.data(), dNrhs.data(),
+                                                       dA.data(), dLda.data(), dIpiv.data(), stP,
+                                                       dB.data(), dLdb.data(), bc),
+                              rocblas_status_success);
+        if(argus.timing)
+            rocsolver_bench_inform(inform_quick_return);
+
+        return;
+    }
+
+    // check computations
+    if(argus.unit_check || argus.norm_check)
+        getrs_vbatched_getError<T>(handle, trans, dN, dNrhs, dA, dLda, dIpiv, stP, dB, dLdb, bc, hN,
+                                   hNrhs, hLda, hLdb, hA, hIpiv, hB, hBRes, &max_error);
+
+    // collect performance data
+    if(argus.timing)
+        getrs_vbatched_getPerfData<T>(handle, trans, dN, dNrhs, dA, dLda, dIpiv, stP, dB, dLdb, bc,
+                                      hN, hNrhs, hLda, hLdb, hA, hIpiv, hB, &gpu_time_used,
+                                      &cpu_time_used, hot_calls, argus.profile,
+                                      argus.profile_kernels, argus.perf);
+
+    // validate results for rocsolver-test
+    // using n * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, n);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            rocsolver_bench_header("Arguments:");
+            rocsolver_bench_output("trans", "max_n", "max_nrhs", "max_lda", "max_ldb", "strideP",
+                                   "batch_c");
+            rocsolver_bench_output(transC, n, nrhs, lda, ldb, stP, bc);
+            rocsolver_bench_header("Results:");
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_bench_endl();
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
+
+#define EXTERN_TESTING_GETRS_VBATCHED(...) \
+    extern template void testing_getrs_vbatched<__VA_ARGS__>(Arguments&);
+
+INSTANTIATE(EXTERN_TESTING_GETRS_VBATCHED, FOREACH_SCALAR_TYPE, APPLY_STAMP)
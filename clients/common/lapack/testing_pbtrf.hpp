@@ -0,0 +1,550 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "common/misc/client_util.hpp"
+#include "common/misc/clientcommon.hpp"
+#include "common/misc/lapack_host_reference.hpp"
+#include "common/misc/norm.hpp"
+#include "common/misc/rocsolver.hpp"
+#include "common/misc/rocsolver_arguments.hpp"
+#include "common/misc/rocsolver_test.hpp"
+
+template <bool STRIDED, typename T, typename U>
+void pbtrf_checkBadArgs(const rocblas_handle handle,
+                        const rocblas_fill uplo,
+                        const rocblas_int n,
+                        const rocblas_int kd,
+                        T dAB,
+                        const rocblas_int ldab,
+                        const rocblas_stride stA,
+                        U dinfo,
+                        const rocblas_int bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_pbtrf(STRIDED, nullptr, uplo, n, kd, dAB, ldab, stA, dinfo, bc),
+                          rocblas_status_invalid_handle);
+
+    // values
+    EXPECT_ROCBLAS_STATUS(rocsolver_pbtrf(STRIDED, handle, rocblas_fill_full, n, kd, dAB, ldab, stA,
+                                          dinfo, bc),
+                          rocblas_status_invalid_value);
+
+    // sizes (only check batch_count if applicable)
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(
+            rocsolver_pbtrf(STRIDED, handle, uplo, n, kd, dAB, ldab, stA, dinfo, -1),
+            rocblas_status_invalid_size);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_pbtrf(STRIDED, handle, uplo, n, kd, (T) nullptr, ldab, stA, dinfo, bc),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_pbtrf(STRIDED, handle, uplo, n, kd, dAB, ldab, stA, (U) nullptr, bc),
+        rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_pbtrf(STRIDED, handle, uplo, 0, kd, (T) nullptr, ldab, stA, dinfo, bc),
+        rocblas_status_success);
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(
+            rocsolver_pbtrf(STRIDED, handle, uplo, n, kd, dAB, ldab, stA, (U) nullptr, 0),
+            rocblas_status_success);
+
+    // quick return with zero batch_count if applicable
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(
+            rocsolver_pbtrf(STRIDED, handle, uplo, n, kd, dAB, ldab, stA, dinfo, 0),
+            rocblas_status_success);
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_pbtrf_bad_arg()
+{
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_fill uplo = rocblas_fill_upper;
+    rocblas_int n = 1;
+    rocblas_int kd = 0;
+    rocblas_int ldab = 1;
+    rocblas_stride stA = 1;
+    rocblas_int bc = 1;
+
+    if(BATCHED)
+    {
+        // memory allocations
+        device_batch_vector<T> dAB(1, 1, 1);
+        device_strided_batch_vector<rocblas_int> dinfo(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dAB.memcheck());
+        CHECK_HIP_ERROR(dinfo.memcheck());
+
+        // check bad arguments
+        pbtrf_checkBadArgs<STRIDED>(handle, uplo, n, kd, dAB.data(), ldab, stA, dinfo.data(), bc);
+    }
+    else
+    {
+        // memory allocations
+        device_strided_batch_vector<T> dAB(1, 1, 1, 1);
+        device_strided_batch_vector<rocblas_int> dinfo(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dAB.memcheck());
+        CHECK_HIP_ERROR(dinfo.memcheck());
+
+        // check bad arguments
+        pbtrf_checkBadArgs<STRIDED>(handle, uplo, n, kd, dAB.data(), ldab, stA, dinfo.data(), bc);
+    }
+}
+
+/** Initializes the band storage of a random real symmetric (complex hermitian) band matrix
+    with kd off-diagonals; the diagonal is made dominant for the matrix to be positive
+    definite, and the entries of the band array that fall outside the matrix are set to zero **/
+template <typename T, typename Th>
+void pbtrf_initBand(const rocblas_fill uplo,
+                    const rocblas_int n,
+                    const rocblas_int kd,
+                    const rocblas_int ldab,
+                    const rocblas_int bc,
+                    Th& hAB)
+{
+    using S = decltype(std::real(T{}));
+    rocblas_init<T>(hAB, true);
+
+    const rocblas_int dg = (uplo == rocblas_fill_lower) ? 0 : kd;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        for(rocblas_int j = 0; j < n; j++)
+        {
+            for(rocblas_int r = 0; r <= kd; r++)
+            {
+                // row of the band element in the matrix
+                rocblas_int i = j + r - dg;
+                T& a = hAB[b][r + j * ldab];
+                if(i < 0 || i >= n)
+                    a = 0;
+                else if(i == j)
+                    a = T(std::real(a * sconj(a)) * 400 + S(40 * kd));
+                else
+                    a -= 4;
+            }
+        }
+    }
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Ud, typename Th, typename Uh>
+void pbtrf_initData(const rocblas_handle handle,
+                    const rocblas_fill uplo,
+                    const rocblas_int n,
+                    const rocblas_int kd,
+                    Td& dAB,
+                    const rocblas_int ldab,
+                    const rocblas_stride stA,
+                    Ud& dInfo,
+                    const rocblas_int bc,
+                    Th& hAB,
+                    Uh& hInfo,
+                    const bool singular)
+{
+    if(CPU)
+    {
+        pbtrf_initBand<T>(uplo, n, kd, ldab, bc, hAB);
+
+        const rocblas_int dg = (uplo == rocblas_fill_lower) ? 0 : kd;
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            if(singular && (b == bc / 4 || b == bc / 2 || b == bc - 1))
+            {
+                // make some matrices not positive definite
+                // always the same elements for debugging purposes
+                // the algorithm must detect the lower order of the principal minors <= 0
+                // in those matrices in the batch that are non positive definite
+                rocblas_int i = n / 4 + b;
+                i -= (i / n) * n;
+                hAB[b][dg + i * ldab] = 0;
+                i = n / 2 + b;
+                i -= (i / n) * n;
+                hAB[b][dg + i * ldab] = 0;
+                i = n - 1 + b;
+                i -= (i / n) * n;
+                hAB[b][dg + i * ldab] = 0;
+            }
+        }
+    }
+
+    if(GPU)
+    {
+        // now copy data to the GPU
+        CHECK_HIP_ERROR(dAB.transfer_from(hAB));
+    }
+}
+
+template <bool STRIDED, typename T, typename Td, typename Ud, typename Th, typename Uh>
+void pbtrf_getError(const rocblas_handle handle,
+                    const rocblas_fill uplo,
+                    const rocblas_int n,
+                    const rocblas_int kd,
+                    Td& dAB,
+                    const rocblas_int ldab,
+                    const rocblas_stride stA,
+                    Ud& dInfo,
+                    const rocblas_int bc,
+                    Th& hAB,
+                    Th& hABRes,
+                    Uh& hInfo,
+                    Uh& hInfoRes,
+                    double* max_err,
+                    const bool singular)
+{
+    // input data initialization
+    pbtrf_initData<true, true, T>(handle, uplo, n, kd, dAB, ldab, stA, dInfo, bc, hAB, hInfo,
+                                  singular);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_pbtrf(STRIDED, handle, uplo, n, kd, dAB.data(), ldab, stA,
+                                        dInfo.data(), bc));
+    CHECK_HIP_ERROR(hABRes.transfer_from(dAB));
+    CHECK_HIP_ERROR(hInfoRes.transfer_from(dInfo));
+
+    // CPU lapack
+    for(rocblas_int b = 0; b < bc; ++b)
+        cpu_pbtrf(uplo, n, kd, hAB[b], ldab, hInfo[b]);
+
+    // error is ||hAB - hABRes|| / ||hAB||
+    // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
+    // IT MIGHT BE REVISITED IN THE FUTURE)
+    // using frobenius norm over the band storage
+    double err;
+    rocblas_int nn;
+    *max_err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        // when the matrix is not positive definite, only the columns before the failing
+        // one are final
+        nn = hInfoRes[b][0] == 0 ? n : hInfoRes[b][0] - 1;
+        err = norm_error('F', kd + 1, nn, ldab, hAB[b], hABRes[b]);
+        *max_err = err > *max_err ? err : *max_err;
+    }
+
+    // also check info for non positive definite cases
+    err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        EXPECT_EQ(hInfo[b][0], hInfoRes[b][0]) << "where b = " << b;
+        if(hInfo[b][0] != hInfoRes[b][0])
+            err++;
+    }
+    *max_err += err;
+}
+
+template <bool STRIDED, typename T, typename Td, typename Ud, typename Th, typename Uh>
+void pbtrf_getPerfData(const rocblas_handle handle,
+                       const rocblas_fill uplo,
+                       const rocblas_int n,
+                       const rocblas_int kd,
+                       Td& dAB,
+                       const rocblas_int ldab,
+                       const rocblas_stride stA,
+                       Ud& dInfo,
+                       const rocblas_int bc,
+                       Th& hAB,
+                       Uh& hInfo,
+                       double* gpu_time_used,
+                       double* cpu_time_used,
+                       const rocblas_int hot_calls,
+                       const int profile,
+                       const bool profile_kernels,
+                       const bool perf,
+                       const bool singular)
+{
+    if(!perf)
+    {
+        pbtrf_initData<true, false, T>(handle, uplo, n, kd, dAB, ldab, stA, dInfo, bc, hAB, hInfo,
+                                       singular);
+
+        // cpu-lapack performance (only if not in perf mode)
+        *cpu_time_used = get_time_us_no_sync();
+        for(rocblas_int b = 0; b < bc; ++b)
+            cpu_pbtrf(uplo, n, kd, hAB[b], ldab, hInfo[b]);
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    pbtrf_initData<true, false, T>(handle, uplo, n, kd, dAB, ldab, stA, dInfo, bc, hAB, hInfo,
+                                   singular);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        pbtrf_initData<false, true, T>(handle, uplo, n, kd, dAB, ldab, stA, dInfo, bc, hAB, hInfo,
+                                       singular);
+
+        rocsolver_bench_first_call first_call(handle, iter);
+        CHECK_ROCBLAS_ERROR(rocsolver_pbtrf(STRIDED, handle, uplo, n, kd, dAB.data(), ldab, stA,
+                                            dInfo.data(), bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    rocsolver_bench_timer timer(stream, hot_calls);
+
+    if(profile > 0)
+    {
+        if(profile_kernels)
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile
+                                         | rocblas_layer_mode_ex_log_kernel);
+        else
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile);
+        rocsolver_log_set_max_levels(profile);
+    }
+
+    for(rocblas_int iter = 0; iter < timer.calls(); iter++)
+    {
+        pbtrf_initData<false, true, T>(handle, uplo, n, kd, dAB, ldab, stA, dInfo, bc, hAB, hInfo,
+                                       singular);
+
+        timer.start(iter);
+        rocsolver_pbtrf(STRIDED, handle, uplo, n, kd, dAB.data(), ldab, stA, dInfo.data(), bc);
+        *gpu_time_used += timer.stop(iter);
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_pbtrf(Arguments& argus)
+{
+    // get arguments
+    rocblas_local_handle handle;
+    char uploC = argus.get<char>("uplo");
+    rocblas_int n = argus.get<rocblas_int>("n");
+    rocblas_int kd = argus.get<rocblas_int>("kd");
+    rocblas_int ldab = argus.get<rocblas_int>("ldab", kd + 1);
+    rocblas_stride stA = argus.get<rocblas_stride>("strideA", ldab * n);
+
+    rocblas_fill uplo = char2rocblas_fill(uploC);
+    rocblas_int bc = argus.batch_count;
+    rocblas_int hot_calls = argus.iters;
+
+    rocblas_stride stARes = (argus.unit_check || argus.norm_check) ? stA : 0;
+
+    // check non-supported values
+    if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+    {
+        if(BATCHED)
+            EXPECT_ROCBLAS_STATUS(rocsolver_pbtrf(STRIDED, handle, uplo, n, kd, (T* const*)nullptr,
+                                                  ldab, stA, (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_value);
+        else
+            EXPECT_ROCBLAS_STATUS(rocsolver_pbtrf(STRIDED, handle, uplo, n, kd, (T*)nullptr, ldab,
+                                                  stA, (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_value);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_args);
+
+        return;
+    }
+
+    // determine sizes
+    size_t size_A = size_t(ldab) * n;
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_ARes = (argus.unit_check || argus.norm_check) ? size_A : 0;
+
+    // check invalid sizes
+    bool invalid_size = (n < 0 || kd < 0 || ldab < kd + 1 || bc < 0);
+    if(invalid_size)
+    {
+        if(BATCHED)
+            EXPECT_ROCBLAS_STATUS(rocsolver_pbtrf(STRIDED, handle, uplo, n, kd, (T* const*)nullptr,
+                                                  ldab, stA, (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_size);
+        else
+            EXPECT_ROCBLAS_STATUS(rocsolver_pbtrf(STRIDED, handle, uplo, n, kd, (T*)nullptr, ldab,
+                                                  stA, (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_size);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_size);
+
+        return;
+    }
+
+    // memory size query is necessary
+    if(argus.mem_query || !USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        if(BATCHED)
+            CHECK_ALLOC_QUERY(rocsolver_pbtrf(STRIDED, handle, uplo, n, kd, (T* const*)nullptr,
+                                              ldab, stA, (rocblas_int*)nullptr, bc));
+        else
+            CHECK_ALLOC_QUERY(rocsolver_pbtrf(STRIDED, handle, uplo, n, kd, (T*)nullptr, ldab, stA,
+                                              (rocblas_int*)nullptr, bc));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        if(argus.mem_query)
+        {
+            rocsolver_bench_inform(inform_mem_query, size);
+            return;
+        }
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    if(BATCHED)
+    {
+        // memory allocations
+        host_batch_vector<T> hAB(size_A, 1, bc);
+        host_batch_vector<T> hABRes(size_ARes, 1, bc);
+        host_strided_batch_vector<rocblas_int> hInfo(1, 1, 1, bc);
+        host_strided_batch_vector<rocblas_int> hInfoRes(1, 1, 1, bc);
+        device_batch_vector<T> dAB(size_A, 1, bc);
+        device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dAB.memcheck());
+        CHECK_HIP_ERROR(dInfo.memcheck());
+
+        // check quick return
+        if(n == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_pbtrf(STRIDED, handle, uplo, n, kd, dAB.data(), ldab,
+                                                  stA, dInfo.data(), bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                rocsolver_bench_inform(inform_quick_return);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            pbtrf_getError<STRIDED, T>(handle, uplo, n, kd, dAB, ldab, stA, dInfo, bc, hAB, hABRes,
+                                       hInfo, hInfoRes, &max_error, argus.singular);
+
+        // collect performance data
+        if(argus.timing)
+            pbtrf_getPerfData<STRIDED, T>(handle, uplo, n, kd, dAB, ldab, stA, dInfo, bc, hAB,
+                                          hInfo, &gpu_time_used, &cpu_time_used, hot_calls,
+                                          argus.profile, argus.profile_kernels, argus.perf,
+                                          argus.singular);
+    }
+
+    else
+    {
+        // memory allocations
+        host_strided_batch_vector<T> hAB(size_A, 1, stA, bc);
+        host_strided_batch_vector<T> hABRes(size_ARes, 1, stARes, bc);
+        host_strided_batch_vector<rocblas_int> hInfo(1, 1, 1, bc);
+        host_strided_batch_vector<rocblas_int> hInfoRes(1, 1, 1, bc);
+        device_strided_batch_vector<T> dAB(size_A, 1, stA, bc);
+        device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dAB.memcheck());
+        CHECK_HIP_ERROR(dInfo.memcheck());
+
+        // check quick return
+        if(n == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_pbtrf(STRIDED, handle, uplo, n, kd, dAB.data(), ldab,
+                                                  stA, dInfo.data(), bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                rocsolver_bench_inform(inform_quick_return);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            pbtrf_getError<STRIDED, T>(handle, uplo, n, kd, dAB, ldab, stA, dInfo, bc, hAB, hABRes,
+                                       hInfo, hInfoRes, &max_error, argus.singular);
+
+        // collect performance data
+        if(argus.timing)
+            pbtrf_getPerfData<STRIDED, T>(handle, uplo, n, kd, dAB, ldab, stA, dInfo, bc, hAB,
+                                          hInfo, &gpu_time_used, &cpu_time_used, hot_calls,
+                                          argus.profile, argus.profile_kernels, argus.perf,
+                                          argus.singular);
+    }
+
+    // validate results for rocsolver-test
+    // using n * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, n);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            rocsolver_bench_header("Arguments:");
+            if(BATCHED)
+            {
+                rocsolver_bench_output("uplo", "n", "kd", "ldab", "batch_c");
+                rocsolver_bench_output(uploC, n, kd, ldab, bc);
+            }
+            else if(STRIDED)
+            {
+                rocsolver_bench_output("uplo", "n", "kd", "ldab", "strideA", "batch_c");
+                rocsolver_bench_output(uploC, n, kd, ldab, stA, bc);
+            }
+            else
+            {
+                rocsolver_bench_output("uplo", "n", "kd", "ldab");
+                rocsolver_bench_output(uploC, n, kd, ldab);
+            }
+            rocsolver_bench_header("Results:");
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_bench_endl();
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
+
+#define EXTERN_TESTING_PBTRF(...) extern template void testing_pbtrf<__VA_ARGS__>(Arguments&);
+
+INSTANTIATE(EXTERN_TESTING_PBTRF, FOREACH_MATRIX_DATA_LAYOUT, FOREACH_SCALAR_TYPE, APPLY_STAMP)
@@ -29,21 +29,22 @@
 
 #include "common/misc/client_util.hpp"
 #include "common/misc/clientcommon.hpp"
+#include "common/misc/device_data_initializer.hpp"
 #include "common/misc/lapack_host_reference.hpp"
 #include "common/misc/norm.hpp"
 #include "common/misc/rocsolver.hpp"
 #include "common/misc/rocsolver_arguments.hpp"
 #include "common/misc/rocsolver_test.hpp"
 
-template <bool STRIDED, bool POTRF, typename T, typename U>
+template <bool STRIDED, bool POTRF, typename I, typename T, typename U>
 void potf2_potrf_checkBadArgs(const rocblas_handle handle,
                               const rocblas_fill uplo,
-                              const rocblas_int n,
+                              const I n,
                               T dA,
-                              const rocblas_int lda,
+                              const I lda,
                               const rocblas_stride stA,
                               U dinfo,
-                              const rocblas_int bc)
+                              const I bc)
 {
     // handle
     EXPECT_ROCBLAS_STATUS(
@@ -85,22 +86,22 @@ void potf2_potrf_checkBadArgs(const rocblas_handle handle,
             rocblas_status_success);
 }
 
-template <bool BATCHED, bool STRIDED, bool POTRF, typename T>
+template <bool BATCHED, bool STRIDED, bool POTRF, typename T, typename I>
 void testing_potf2_potrf_bad_arg()
 {
     // safe arguments
     rocblas_local_handle handle;
     rocblas_fill uplo = rocblas_fill_upper;
-    rocblas_int n = 1;
-    rocblas_int lda = 1;
+    I n = 1;
+    I lda = 1;
     rocblas_stride stA = 1;
-    rocblas_int bc = 1;
+    I bc = 1;
 
     if(BATCHED)
     {
         // memory allocations
         device_batch_vector<T> dA(1, 1, 1);
-        device_strided_batch_vector<rocblas_int> dinfo(1, 1, 1, 1);
+        device_strided_batch_vector<I> dinfo(1, 1, 1, 1);
         CHECK_HIP_ERROR(dA.memcheck());
         CHECK_HIP_ERROR(dinfo.memcheck());
 
@@ -112,7 +113,7 @@ void testing_potf2_potrf_bad_arg()
     {
         // memory allocations
         device_strided_batch_vector<T> dA(1, 1, 1, 1);
-        device_strided_batch_vector<rocblas_int> dinfo(1, 1, 1, 1);
+        device_strided_batch_vector<I> dinfo(1, 1, 1, 1);
         CHECK_HIP_ERROR(dA.memcheck());
         CHECK_HIP_ERROR(dinfo.memcheck());
 
@@ -122,27 +123,27 @@ void testing_potf2_potrf_bad_arg()
     }
 }
 
-template <bool CPU, bool GPU, typename T, typename Td, typename Ud, typename Th, typename Uh>
+template <bool CPU, bool GPU, typename T, typename I, typename Td, typename Ud, typename Th, typename Uh>
 void potf2_potrf_initData(const rocblas_handle handle,
                           const rocblas_fill uplo,
-                          const rocblas_int n,
+                          const I n,
                           Td& dA,
-                          const rocblas_int lda,
+                          const I lda,
                           const rocblas_stride stA,
                           Ud& dInfo,
-                          const rocblas_int bc,
+                          const I bc,
                           Th& hA,
                           Uh& hInfo,
                           const bool singular)
 {
-    if(CPU)
+    if(CPU && !rocsolver_bench_device_init)
     {
         rocblas_init<T>(hA, true);
 
-        for(rocblas_int b = 0; b < bc; ++b)
+        for(I b = 0; b < bc; ++b)
         {
             // scale to ensure positive definiteness
-            for(rocblas_int i = 0; i < n; i++)
+            for(I i = 0; i < n; i++)
                 hA[b][i + i * lda] = hA[b][i + i * lda] * sconj(hA[b][i + i * lda]) * 400;
 
             if(singular && (b == bc / 4 || b == bc / 2 || b == bc - 1))
@@ -151,7 +152,7 @@ void potf2_potrf_initData(const rocblas_handle handle,
                 // always the same elements for debugging purposes
                 // the algorithm must detect the lower order of the principal minors <= 0
                 // in those matrices in the batch that are non positive definite
-                rocblas_int i = n / 4 + b;
+                I i = n / 4 + b;
                 i -= (i / n) * n;
                 hA[b][i + i * lda] = 0;
                 i = n / 2 + b;
@@ -166,24 +167,34 @@ void potf2_potrf_initData(const rocblas_handle handle,
 
     if(GPU)
     {
-        // now copy data to the GPU
-        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        if(rocsolver_bench_device_init)
+        {
+            // generate a diagonally dominant positive definite matrix directly on the GPU
+            hipStream_t stream;
+            CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+            device_init_matrix<T>(device_init_spd, n, n, dA.data(), lda, stA, bc, stream);
+        }
+        else
+        {
+            // now copy data to the GPU
+            CHECK_HIP_ERROR(dA.transfer_from(hA));
+        }
     }
 }
 
-template <bool STRIDED, bool POTRF, typename T, typename Td, typename Ud, typename Th, typename Uh>
+template <bool STRIDED, bool POTRF, typename T, typename I, typename Td, typename Ud, typename Th, typename Uh, typename Ih>
 void potf2_potrf_getError(const rocblas_handle handle,
                           const rocblas_fill uplo,
-                          const rocblas_int n,
+                          const I n,
                           Td& dA,
-                          const rocblas_int lda,
+                          const I lda,
                           const rocblas_stride stA,
                           Ud& dInfo,
-                          const rocblas_int bc,
+                          const I bc,
                           Th& hA,
                           Th& hARes,
                           Uh& hInfo,
-                          Uh& hInfoRes,
+                          Ih& hInfoRes,
                           double* max_err,
                           const bool singular)
 {
@@ -199,7 +210,7 @@ void potf2_potrf_getError(const rocblas_handle handle,
     CHECK_HIP_ERROR(hInfoRes.transfer_from(dInfo));
 
     // CPU lapack
-    for(rocblas_int b = 0; b < bc; ++b)
+    for(I b = 0; b < bc; ++b)
     {
         POTRF ? cpu_potrf(uplo, n, hA[b], lda, hInfo[b]) : cpu_potf2(uplo, n, hA[b], lda, hInfo[b]);
     }
@@ -209,9 +220,9 @@ void potf2_potrf_getError(const rocblas_handle handle,
     // IT MIGHT BE REVISITED IN THE FUTURE)
     // using frobenius norm
     double err;
-    rocblas_int nn;
+    I nn;
     *max_err = 0;
-    for(rocblas_int b = 0; b < bc; ++b)
+    for(I b = 0; b < bc; ++b)
     {
         nn = hInfoRes[b][0] == 0 ? n : hInfoRes[b][0];
         // (TODO: For now, the algorithm is modifying the whole input matrix even when
@@ -224,7 +235,7 @@ void potf2_potrf_getError(const rocblas_handle handle,
 
     // also check info for non positive definite cases
     err = 0;
-    for(rocblas_int b = 0; b < bc; ++b)
+    for(I b = 0; b < bc; ++b)
     {
         EXPECT_EQ(hInfo[b][0], hInfoRes[b][0]) << "where b = " << b;
         if(hInfo[b][0] != hInfoRes[b][0])
@@ -233,15 +244,15 @@ void potf2_potrf_getError(const rocblas_handle handle,
     *max_err += err;
 }
 
-template <bool STRIDED, bool POTRF, typename T, typename Td, typename Ud, typename Th, typename Uh>
+template <bool STRIDED, bool POTRF, typename T, typename I, typename Td, typename Ud, typename Th, typename Uh>
 void potf2_potrf_getPerfData(const rocblas_handle handle,
                              const rocblas_fill uplo,
-                             const rocblas_int n,
+                             const I n,
                              Td& dA,
-                             const rocblas_int lda,
+                             const I lda,
                              const rocblas_stride stA,
                              Ud& dInfo,
-                             const rocblas_int bc,
+                             const I bc,
                              Th& hA,
                              Uh& hInfo,
                              double* gpu_time_used,
@@ -252,20 +263,22 @@ void potf2_potrf_getPerfData(const rocblas_handle handle,
                              const bool perf,
                              const bool singular)
 {
-    if(!perf)
+    if(!perf && !rocsolver_bench_device_init)
     {
         potf2_potrf_initData<true, false, T>(handle, uplo, n, dA, lda, stA, dInfo, bc, hA, hInfo,
                                              singular);
 
         // cpu-lapack performance (only if not in perf mode)
         *cpu_time_used = get_time_us_no_sync();
-        for(rocblas_int b = 0; b < bc; ++b)
+        for(I b = 0; b < bc; ++b)
         {
             POTRF ? cpu_potrf(uplo, n, hA[b], lda, hInfo[b])
                   : cpu_potf2(uplo, n, hA[b], lda, hInfo[b]);
         }
         *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
     }
+    else if(rocsolver_bench_device_init)
+        *cpu_time_used = nan(""); // no host data for cpu-lapack execution
 
     potf2_potrf_initData<true, false, T>(handle, uplo, n, dA, lda, stA, dInfo, bc, hA, hInfo,
                                          singular);
@@ -276,6 +289,7 @@ void potf2_potrf_getPerfData(const rocblas_handle handle,
         potf2_potrf_initData<false, true, T>(handle, uplo, n, dA, lda, stA, dInfo, bc, hA, hInfo,
                                              singular);
 
+        rocsolver_bench_first_call first_call(handle, iter);
         CHECK_ROCBLAS_ERROR(rocsolver_potf2_potrf(STRIDED, POTRF, handle, uplo, n, dA.data(), lda,
                                                   stA, dInfo.data(), bc));
     }
@@ -283,7 +297,7 @@ void potf2_potrf_getPerfData(const rocblas_handle handle,
     // gpu-lapack performance
     hipStream_t stream;
     CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
-    double start;
+    rocsolver_bench_timer timer(stream, hot_calls);
 
     if(profile > 0)
     {
@@ -295,30 +309,30 @@ void potf2_potrf_getPerfData(const rocblas_handle handle,
         rocsolver_log_set_max_levels(profile);
     }
 
-    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    for(rocblas_int iter = 0; iter < timer.calls(); iter++)
     {
         potf2_potrf_initData<false, true, T>(handle, uplo, n, dA, lda, stA, dInfo, bc, hA, hInfo,
                                              singular);
 
-        start = get_time_us_sync(stream);
+        timer.start(iter);
         rocsolver_potf2_potrf(STRIDED, POTRF, handle, uplo, n, dA.data(), lda, stA, dInfo.data(), bc);
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        *gpu_time_used += timer.stop(iter);
     }
     *gpu_time_used /= hot_calls;
 }
 
-template <bool BATCHED, bool STRIDED, bool POTRF, typename T>
+template <bool BATCHED, bool STRIDED, bool POTRF, typename T, typename I>
 void testing_potf2_potrf(Arguments& argus)
 {
     // get arguments
     rocblas_local_handle handle;
     char uploC = argus.get<char>("uplo");
-    rocblas_int n = argus.get<rocblas_int>("n");
-    rocblas_int lda = argus.get<rocblas_int>("lda", n);
+    I n = argus.get<rocblas_int>("n");
+    I lda = argus.get<rocblas_int>("lda", n);
     rocblas_stride stA = argus.get<rocblas_stride>("strideA", lda * n);
 
     rocblas_fill uplo = char2rocblas_fill(uploC);
-    rocblas_int bc = argus.batch_count;
+    I bc = argus.batch_count;
     rocblas_int hot_calls = argus.iters;
 
     rocblas_stride stARes = (argus.unit_check || argus.norm_check) ? stA : 0;
@@ -328,12 +342,12 @@ void testing_potf2_potrf(Arguments& argus)
     {
         if(BATCHED)
             EXPECT_ROCBLAS_STATUS(rocsolver_potf2_potrf(STRIDED, POTRF, handle, uplo, n,
-                                                        (T* const*)nullptr, lda, stA,
-                                                        (rocblas_int*)nullptr, bc),
+                                                        (T* const*)nullptr, lda, stA, (I*)nullptr,
+                                                        bc),
                                   rocblas_status_invalid_value);
         else
             EXPECT_ROCBLAS_STATUS(rocsolver_potf2_potrf(STRIDED, POTRF, handle, uplo, n, (T*)nullptr,
-                                                        lda, stA, (rocblas_int*)nullptr, bc),
+                                                        lda, stA, (I*)nullptr, bc),
                                   rocblas_status_invalid_value);
 
         if(argus.timing)
@@ -348,18 +362,22 @@ void testing_potf2_potrf(Arguments& argus)
 
     size_t size_ARes = (argus.unit_check || argus.norm_check) ? size_A : 0;
 
+    // the host copy of A is not needed if the input data is generated on the device
+    size_t size_hA = rocsolver_bench_device_init ? 0 : size_A;
+    rocblas_stride sthA = rocsolver_bench_device_init ? 0 : stA;
+
     // check invalid sizes
     bool invalid_size = (n < 0 || lda < n || bc < 0);
     if(invalid_size)
     {
         if(BATCHED)
             EXPECT_ROCBLAS_STATUS(rocsolver_potf2_potrf(STRIDED, POTRF, handle, uplo, n,
-                                                        (T* const*)nullptr, lda, stA,
-                                                        (rocblas_int*)nullptr, bc),
+                                                        (T* const*)nullptr, lda, stA, (I*)nullptr,
+                                                        bc),
                                   rocblas_status_invalid_size);
         else
             EXPECT_ROCBLAS_STATUS(rocsolver_potf2_potrf(STRIDED, POTRF, handle, uplo, n, (T*)nullptr,
-                                                        lda, stA, (rocblas_int*)nullptr, bc),
+                                                        lda, stA, (I*)nullptr, bc),
                                   rocblas_status_invalid_size);
 
         if(argus.timing)
@@ -374,11 +392,10 @@ void testing_potf2_potrf(Arguments& argus)
         CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
         if(BATCHED)
             CHECK_ALLOC_QUERY(rocsolver_potf2_potrf(STRIDED, POTRF, handle, uplo, n,
-                                                    (T* const*)nullptr, lda, stA,
-                                                    (rocblas_int*)nullptr, bc));
+                                                    (T* const*)nullptr, lda, stA, (I*)nullptr, bc));
         else
             CHECK_ALLOC_QUERY(rocsolver_potf2_potrf(STRIDED, POTRF, handle, uplo, n, (T*)nullptr,
-                                                    lda, stA, (rocblas_int*)nullptr, bc));
+                                                    lda, stA, (I*)nullptr, bc));
 
         size_t size;
         CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
@@ -394,12 +411,12 @@ void testing_potf2_potrf(Arguments& argus)
     if(BATCHED)
     {
         // memory allocations
-        host_batch_vector<T> hA(size_A, 1, bc);
+        host_batch_vector<T> hA(size_hA, 1, bc);
         host_batch_vector<T> hARes(size_ARes, 1, bc);
         host_strided_batch_vector<rocblas_int> hInfo(1, 1, 1, bc);
-        host_strided_batch_vector<rocblas_int> hInfoRes(1, 1, 1, bc);
+        host_strided_batch_vector<I> hInfoRes(1, 1, 1, bc);
         device_batch_vector<T> dA(size_A, 1, bc);
-        device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, bc);
+        device_strided_batch_vector<I> dInfo(1, 1, 1, bc);
         if(size_A)
             CHECK_HIP_ERROR(dA.memcheck());
         CHECK_HIP_ERROR(dInfo.memcheck());
@@ -432,12 +449,12 @@ void testing_potf2_potrf(Arguments& argus)
     else
     {
         // memory allocations
-        host_strided_batch_vector<T> hA(size_A, 1, stA, bc);
+        host_strided_batch_vector<T> hA(size_hA, 1, sthA, bc);
         host_strided_batch_vector<T> hARes(size_ARes, 1, stARes, bc);
         host_strided_batch_vector<rocblas_int> hInfo(1, 1, 1, bc);
-        host_strided_batch_vector<rocblas_int> hInfoRes(1, 1, 1, bc);
+        host_strided_batch_vector<I> hInfoRes(1, 1, 1, bc);
         device_strided_batch_vector<T> dA(size_A, 1, stA, bc);
-        device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, bc);
+        device_strided_batch_vector<I> dInfo(1, 1, 1, bc);
         if(size_A)
             CHECK_HIP_ERROR(dA.memcheck());
         CHECK_HIP_ERROR(dInfo.memcheck());
@@ -526,4 +543,5 @@ INSTANTIATE(EXTERN_TESTING_POTF2_POTRF,
             FOREACH_MATRIX_DATA_LAYOUT,
             FOREACH_BLOCKED_VARIANT,
             FOREACH_SCALAR_TYPE,
+            FOREACH_INT_TYPE,
             APPLY_STAMP)
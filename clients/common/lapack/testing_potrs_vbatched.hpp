@@ -0,0 +1,467 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "common/misc/client_util.hpp"
+#include "common/misc/clientcommon.hpp"
+#include "common/misc/lapack_host_reference.hpp"
+#include "common/misc/norm.hpp"
+#include "common/misc/rocsolver.hpp"
+#include "common/misc/rocsolver_arguments.hpp"
+#include "common/misc/rocsolver_test.hpp"
+
+template <typename T, typename U>
+void potrs_vbatched_checkBadArgs(const rocblas_handle handle,
+                                 const rocblas_fill uplo,
+                                 U dN,
+                                 U dNrhs,
+                                 T dA,
+                                 U dLda,
+                                 T dB,
+                                 U dLdb,
+                                 const rocblas_int bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_potrs_vbatched(nullptr, uplo, dN, dNrhs, dA, dLda, dB, dLdb, bc),
+        rocblas_status_invalid_handle);
+
+    // values
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_potrs_vbatched(handle, rocblas_fill_full, dN, dNrhs, dA, dLda, dB, dLdb, bc),
+        rocblas_status_invalid_value);
+
+    // sizes (only check batch_count)
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_potrs_vbatched(handle, uplo, dN, dNrhs, dA, dLda, dB, dLdb, -1),
+        rocblas_status_invalid_size);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_potrs_vbatched(handle, uplo, (U) nullptr, dNrhs, dA, dLda, dB, dLdb, bc),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_potrs_vbatched(handle, uplo, dN, (U) nullptr, dA, dLda, dB, dLdb, bc),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_potrs_vbatched(handle, uplo, dN, dNrhs, (T) nullptr, dLda, dB, dLdb, bc),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_potrs_vbatched(handle, uplo, dN, dNrhs, dA, (U) nullptr, dB, dLdb, bc),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_potrs_vbatched(handle, uplo, dN, dNrhs, dA, dLda, (T) nullptr, dLdb, bc),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_potrs_vbatched(handle, uplo, dN, dNrhs, dA, dLda, dB, (U) nullptr, bc),
+        rocblas_status_invalid_pointer);
+
+    // quick return with zero batch_count
+    EXPECT_ROCBLAS_STATUS(rocsolver_potrs_vbatched(handle, uplo, (U) nullptr, (U) nullptr,
+                                                   (T) nullptr, (U) nullptr, (T) nullptr,
+                                                   (U) nullptr, 0),
+                          rocblas_status_success);
+}
+
+template <typename T>
+void testing_potrs_vbatched_bad_arg()
+{
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_fill uplo = rocblas_fill_upper;
+    rocblas_int bc = 1;
+
+    // memory allocations
+    device_batch_vector<T> dA(1, 1, 1);
+    device_batch_vector<T> dB(1, 1, 1);
+    device_strided_batch_vector<rocblas_int> dN(1, 1, 1, 1);
+    device_strided_batch_vector<rocblas_int> dNrhs(1, 1, 1, 1);
+    device_strided_batch_vector<rocblas_int> dLda(1, 1, 1, 1);
+    device_strided_batch_vector<rocblas_int> dLdb(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dB.memcheck());
+    CHECK_HIP_ERROR(dN.memcheck());
+    CHECK_HIP_ERROR(dNrhs.memcheck());
+    CHECK_HIP_ERROR(dLda.memcheck());
+    CHECK_HIP_ERROR(dLdb.memcheck());
+
+    // check bad arguments
+    potrs_vbatched_checkBadArgs(handle, uplo, dN.data(), dNrhs.data(), dA.data(), dLda.data(),
+                                dB.data(), dLdb.data(), bc);
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Th, typename Uh>
+void potrs_vbatched_initData(const rocblas_handle handle,
+                             const rocblas_fill uplo,
+                             Td& dA,
+                             Td& dB,
+                             const rocblas_int bc,
+                             Th& hA,
+                             Th& hB,
+                             Uh& hN,
+                             Uh& hLda)
+{
+    if(CPU)
+    {
+        rocblas_init<T>(hA, true);
+        rocblas_init<T>(hB, true);
+        int info;
+
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            rocblas_int n = hN[b][0];
+            rocblas_int lda = hLda[b][0];
+
+            // scale to ensure positive definiteness
+            for(rocblas_int i = 0; i < n; i++)
+                hA[b][i + i * lda] = hA[b][i + i * lda] * sconj(hA[b][i + i * lda]) * 400;
+
+            // do the Cholesky factorization of matrix A w/ the reference LAPACK routine
+            if(n > 0)
+                cpu_potrf(uplo, n, hA[b], lda, &info);
+        }
+    }
+
+    if(GPU)
+    {
+        // now copy matrices to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        CHECK_HIP_ERROR(dB.transfer_from(hB));
+    }
+}
+
+template <typename T, typename Td, typename Ud, typename Th, typename Uh>
+void potrs_vbatched_getError(const rocblas_handle handle,
+                             const rocblas_fill uplo,
+                             Ud& dN,
+                             Ud& dNrhs,
+                             Td& dA,
+                             Ud& dLda,
+                             Td& dB,
+                             Ud& dLdb,
+                             const rocblas_int bc,
+                             Uh& hN,
+                             Uh& hNrhs,
+                             Uh& hLda,
+                             Uh& hLdb,
+                             Th& hA,
+                             Th& hB,
+                             Th& hBRes,
+                             double* max_err)
+{
+    // input data initialization
+    potrs_vbatched_initData<true, true, T>(handle, uplo, dA, dB, bc, hA, hB, hN, hLda);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_potrs_vbatched(handle, uplo, dN.data(), dNrhs.data(), dA.data(),
+                                                 dLda.data(), dB.data(), dLdb.data(), bc));
+    CHECK_HIP_ERROR(hBRes.transfer_from(dB));
+
+    // CPU lapack
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        if(hN[b][0] > 0 && hNrhs[b][0] > 0)
+            cpu_potrs(uplo, hN[b][0], hNrhs[b][0], hA[b], hLda[b][0], hB[b], hLdb[b][0]);
+    }
+
+    // error is ||hB - hBRes|| / ||hB||
+    // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
+    // IT MIGHT BE REVISITED IN THE FUTURE)
+    // using vector-induced infinity norm
+    double err;
+    *max_err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        if(hN[b][0] == 0 || hNrhs[b][0] == 0)
+            continue;
+
+        err = norm_error('I', hN[b][0], hNrhs[b][0], hLdb[b][0], hB[b], hBRes[b]);
+        *max_err = err > *max_err ? err : *max_err;
+    }
+}
+
+template <typename T, typename Td, typename Ud, typename Th, typename Uh>
+void potrs_vbatched_getPerfData(const rocblas_handle handle,
+                                const rocblas_fill uplo,
+                                Ud& dN,
+                                Ud& dNrhs,
+                                Td& dA,
+                                Ud& dLda,
+                                Td& dB,
+                                Ud& dLdb,
+                                const rocblas_int bc,
+                                Uh& hN,
+                                Uh& hNrhs,
+                                Uh& hLda,
+                                Uh& hLdb,
+                                Th& hA,
+                                Th& hB,
+                                double* gpu_time_used,
+                                double* cpu_time_used,
+                                const rocblas_int hot_calls,
+                                const int profile,
+                                const bool profile_kernels,
+                                const bool perf)
+{
+    if(!perf)
+    {
+        potrs_vbatched_initData<true, false, T>(handle, uplo, dA, dB, bc, hA, hB, hN, hLda);
+
+        // cpu-lapack performance (only if not in perf mode)
+        *cpu_time_used = get_time_us_no_sync();
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            if(hN[b][0] > 0 && hNrhs[b][0] > 0)
+                cpu_potrs(uplo, hN[b][0], hNrhs[b][0], hA[b], hLda[b][0], hB[b], hLdb[b][0]);
+        }
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    potrs_vbatched_initData<true, false, T>(handle, uplo, dA, dB, bc, hA, hB, hN, hLda);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        potrs_vbatched_initData<false, true, T>(handle, uplo, dA, dB, bc, hA, hB, hN, hLda);
+
+        rocsolver_bench_first_call first_call(handle, iter);
+        CHECK_ROCBLAS_ERROR(rocsolver_potrs_vbatched(handle, uplo, dN.data(), dNrhs.data(),
+                                                     dA.data(), dLda.data(), dB.data(),
+                                                     dLdb.data(), bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    rocsolver_bench_timer timer(stream, hot_calls);
+
+    if(profile > 0)
+    {
+        if(profile_kernels)
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile
+                                         | rocblas_layer_mode_ex_log_kernel);
+        else
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile);
+        rocsolver_log_set_max_levels(profile);
+    }
+
+    for(rocblas_int iter = 0; iter < timer.calls(); iter++)
+    {
+        potrs_vbatched_initData<false, true, T>(handle, uplo, dA, dB, bc, hA, hB, hN, hLda);
+
+        timer.start(iter);
+        rocsolver_potrs_vbatched(handle, uplo, dN.data(), dNrhs.data(), dA.data(), dLda.data(),
+                                 dB.data(), dLdb.data(), bc);
+        *gpu_time_used += timer.stop(iter);
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <typename T>
+void testing_potrs_vbatched(Arguments& argus)
+{
+    // get arguments
+    // (n, nrhs, lda and ldb are the values for the largest instance of the batch;
+    // see vbatched_size for the sizes of the other instances)
+    rocblas_local_handle handle;
+    char uploC = argus.get<char>("uplo");
+    rocblas_int n = argus.get<rocblas_int>("n");
+    rocblas_int nrhs = argus.get<rocblas_int>("nrhs", n);
+    rocblas_int lda = argus.get<rocblas_int>("lda", n);
+    rocblas_int ldb = argus.get<rocblas_int>("ldb", n);
+
+    rocblas_fill uplo = char2rocblas_fill(uploC);
+    rocblas_int bc = argus.batch_count;
+    rocblas_int hot_calls = argus.iters;
+
+    // check non-supported values
+    if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+    {
+        EXPECT_ROCBLAS_STATUS(
+            rocsolver_potrs_vbatched(handle, uplo, (rocblas_int*)nullptr, (rocblas_int*)nullptr,
+                                     (T* const*)nullptr, (rocblas_int*)nullptr,
+                                     (T* const*)nullptr, (rocblas_int*)nullptr, bc),
+            rocblas_status_invalid_value);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_args);
+
+        return;
+    }
+
+    // determine sizes
+    size_t size_A = size_t(lda) * n;
+    size_t size_B = size_t(ldb) * nrhs;
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_BRes = (argus.unit_check || argus.norm_check) ? size_B : 0;
+
+    // check invalid sizes
+    // (only batch_count is checked by the library)
+    bool invalid_size = (n < 0 || nrhs < 0 || lda < n || ldb < n || bc < 0);
+    if(invalid_size)
+    {
+        if(bc < 0)
+            EXPECT_ROCBLAS_STATUS(
+                rocsolver_potrs_vbatched(handle, uplo, (rocblas_int*)nullptr,
+                                         (rocblas_int*)nullptr, (T* const*)nullptr,
+                                         (rocblas_int*)nullptr, (T* const*)nullptr,
+                                         (rocblas_int*)nullptr, bc),
+                rocblas_status_invalid_size);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_size);
+
+        return;
+    }
+
+    // memory size query is necessary
+    if(argus.mem_query || !USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        CHECK_ALLOC_QUERY(rocsolver_potrs_vbatched(handle, uplo, (rocblas_int*)nullptr,
+                                                   (rocblas_int*)nullptr, (T* const*)nullptr,
+                                                   (rocblas_int*)nullptr, (T* const*)nullptr,
+                                                   (rocblas_int*)nullptr, bc));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        if(argus.mem_query)
+        {
+            rocsolver_bench_inform(inform_mem_query, size);
+            return;
+        }
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    // memory allocations
+    host_batch_vector<T> hA(size_A, 1, bc);
+    host_batch_vector<T> hB(size_B, 1, bc);
+    host_batch_vector<T> hBRes(size_BRes, 1, bc);
+    host_strided_batch_vector<rocblas_int> hN(1, 1, 1, bc);
+    host_strided_batch_vector<rocblas_int> hNrhs(1, 1, 1, bc);
+    host_strided_batch_vector<rocblas_int> hLda(1, 1, 1, bc);
+    host_strided_batch_vector<rocblas_int> hLdb(1, 1, 1, bc);
+    device_batch_vector<T> dA(size_A, 1, bc);
+    device_batch_vector<T> dB(size_B, 1, bc);
+    device_strided_batch_vector<rocblas_int> dN(1, 1, 1, bc);
+    device_strided_batch_vector<rocblas_int> dNrhs(1, 1, 1, bc);
+    device_strided_batch_vector<rocblas_int> dLda(1, 1, 1, bc);
+    device_strided_batch_vector<rocblas_int> dLdb(1, 1, 1, bc);
+    if(size_A)
+        CHECK_HIP_ERROR(dA.memcheck());
+    if(size_B)
+        CHECK_HIP_ERROR(dB.memcheck());
+    CHECK_HIP_ERROR(dN.memcheck());
+    CHECK_HIP_ERROR(dNrhs.memcheck());
+    CHECK_HIP_ERROR(dLda.memcheck());
+    CHECK_HIP_ERROR(dLdb.memcheck());
+
+    // set the sizes of the instances
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        hN[b][0] = vbatched_size(b, n);
+        hNrhs[b][0] = vbatched_size(b, nrhs);
+        hLda[b][0] = hN[b][0] + (lda - n);
+        hLdb[b][0] = hN[b][0] + (ldb - n);
+    }
+    CHECK_HIP_ERROR(dN.transfer_from(hN));
+    CHECK_HIP_ERROR(dNrhs.transfer_from(hNrhs));
+    CHECK_HIP_ERROR(dLda.transfer_from(hLda));
+    CHECK_HIP_ERROR(dLdb.transfer_from(hLdb));
+
+    // check quick return
+    if(n == 0 || nrhs == 0 || bc == 0)
+    {
+        EXPECT_ROCBLAS_STATUS(rocsolver_potrs_vbatched(handle, uplo, dN.data(), dNrhs.data(),
+                                                       dA.data(), dLda.data(), dB.data(),
+                                                       dLdb.data(), bc),
+                              rocblas_status_success);
+        if(argus.timing)
+            rocsolver_bench_inform(inform_quick_return);
+
+        return;
+    }
+
+    // check computations
+    if(argus.unit_check || argus.norm_check)
+        potrs_vbatched_getError<T>(handle, uplo, dN, dNrhs, dA, dLda, dB, dLdb, bc, hN, hNrhs,
+                                   hLda, hLdb, hA, hB, hBRes, &max_error);
+
+    // collect performance data
+    if(argus.timing)
+        potrs_vbatched_getPerfData<T>(handle, uplo, dN, dNrhs, dA, dLda, dB, dLdb, bc, hN, hNrhs,
+                                      hLda, hLdb, hA, hB, &gpu_time_used, &cpu_time_used,
+                                      hot_calls, argus.profile, argus.profile_kernels,
+                                      argus.perf);
+
+    // validate results for rocsolver-test
+    // using n * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, n);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            rocsolver_bench_header("Arguments:");
+            rocsolver_bench_output("uplo", "max_n", "max_nrhs", "max_lda", "max_ldb", "batch_c");
+            rocsolver_bench_output(uploC, n, nrhs, lda, ldb, bc);
+            rocsolver_bench_header("Results:");
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_bench_endl();
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
+
+#define EXTERN_TESTING_POTRS_VBATCHED(...) \
+    extern template void testing_potrs_vbatched<__VA_ARGS__>(Arguments&);
+
+INSTANTIATE(EXTERN_TESTING_POTRS_VBATCHED, FOREACH_SCALAR_TYPE, APPLY_STAMP)
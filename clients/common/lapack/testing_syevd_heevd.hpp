@@ -29,6 +29,7 @@
 
 #include "common/misc/client_util.hpp"
 #include "common/misc/clientcommon.hpp"
+#include "common/misc/device_data_initializer.hpp"
 #include "common/misc/lapack_host_reference.hpp"
 #include "common/misc/norm.hpp"
 #include "common/misc/rocsolver.hpp"
@@ -156,7 +157,7 @@ void syevd_heevd_initData(const rocblas_handle handle,
                           std::vector<T>& A,
                           bool test = true)
 {
-    if(CPU)
+    if(CPU && !rocsolver_bench_device_init)
     {
         rocblas_init<T>(hA, true);
 
@@ -188,8 +189,23 @@ void syevd_heevd_initData(const rocblas_handle handle,
 
     if(GPU)
     {
-        // now copy to the GPU
-        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        if(rocsolver_bench_device_init)
+        {
+            // generate a matrix with eigenvalues evenly spaced in [-1, 1] directly on the GPU
+            using S = decltype(std::real(T{}));
+            std::vector<S> D(n);
+            for(rocblas_int i = 0; i < n; ++i)
+                D[i] = S(2 * i + 1) / n - 1;
+
+            hipStream_t stream;
+            CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+            device_init_spectrum<T>(D, dA.data(), lda, dA.stride(), bc, stream);
+        }
+        else
+        {
+            // now copy to the GPU
+            CHECK_HIP_ERROR(dA.transfer_from(hA));
+        }
     }
 }
 
@@ -347,12 +363,16 @@ void syevd_heevd_getPerfData(const rocblas_handle handle,
     }
     int liwork = (evect == rocblas_evect_none ? 1 : 3 + 5 * n);
 
+    // the cpu-lapack workspace is not needed if the input data is generated on the device
+    if(rocsolver_bench_device_init)
+        sizeE = lwork = liwork = 0;
+
     std::vector<T> work(lwork);
     std::vector<S> hE(sizeE);
     std::vector<int> iwork(liwork);
     std::vector<T> A;
 
-    if(!perf)
+    if(!perf && !rocsolver_bench_device_init)
     {
         syevd_heevd_initData<true, false, T>(handle, evect, n, dA, lda, bc, hA, A, 0);
 
@@ -363,6 +383,8 @@ void syevd_heevd_getPerfData(const rocblas_handle handle,
                             iwork.data(), liwork, hinfo[b]);
         *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
     }
+    else if(rocsolver_bench_device_init)
+        *cpu_time_used = nan(""); // no host data for cpu-lapack execution
 
     syevd_heevd_initData<true, false, T>(handle, evect, n, dA, lda, bc, hA, A, 0);
 
@@ -371,6 +393,7 @@ void syevd_heevd_getPerfData(const rocblas_handle handle,
     {
         syevd_heevd_initData<false, true, T>(handle, evect, n, dA, lda, bc, hA, A, 0);
 
+        rocsolver_bench_first_call first_call(handle, iter);
         CHECK_ROCBLAS_ERROR(rocsolver_syevd_heevd(STRIDED, handle, evect, uplo, n, dA.data(), lda, stA,
                                                   dD.data(), stD, dE.data(), stE, dinfo.data(), bc));
     }
@@ -378,7 +401,7 @@ void syevd_heevd_getPerfData(const rocblas_handle handle,
     // gpu-lapack performance
     hipStream_t stream;
     CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
-    double start;
+    rocsolver_bench_timer timer(stream, hot_calls);
 
     if(profile > 0)
     {
@@ -390,14 +413,14 @@ void syevd_heevd_getPerfData(const rocblas_handle handle,
         rocsolver_log_set_max_levels(profile);
     }
 
-    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    for(rocblas_int iter = 0; iter < timer.calls(); iter++)
     {
         syevd_heevd_initData<false, true, T>(handle, evect, n, dA, lda, bc, hA, A, 0);
 
-        start = get_time_us_sync(stream);
+        timer.start(iter);
         rocsolver_syevd_heevd(STRIDED, handle, evect, uplo, n, dA.data(), lda, stA, dD.data(), stD,
                               dE.data(), stE, dinfo.data(), bc);
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        *gpu_time_used += timer.stop(iter);
     }
     *gpu_time_used /= hot_calls;
 }
@@ -449,6 +472,10 @@ void testing_syevd_heevd(Arguments& argus)
     size_t size_Ares = (argus.unit_check || argus.norm_check) ? size_A : 0;
     size_t size_Dres = (argus.unit_check || argus.norm_check) ? size_D : 0;
 
+    // the host copy of A is not needed if the input data is generated on the device
+    size_t size_hA = rocsolver_bench_device_init ? 0 : size_A;
+    rocblas_stride sthA = rocsolver_bench_device_init ? 0 : stA;
+
     double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
 
     // check invalid sizes
@@ -515,7 +542,7 @@ void testing_syevd_heevd(Arguments& argus)
     if(BATCHED)
     {
         // memory allocations
-        host_batch_vector<T> hA(size_A, 1, bc);
+        host_batch_vector<T> hA(size_hA, 1, bc);
         host_batch_vector<T> hAres(size_Ares, 1, bc);
         device_batch_vector<T> dA(size_A, 1, bc);
         if(size_A)
@@ -555,7 +582,7 @@ void testing_syevd_heevd(Arguments& argus)
     else
     {
         // memory allocations
-        host_strided_batch_vector<T> hA(size_A, 1, stA, bc);
+        host_strided_batch_vector<T> hA(size_hA, 1, sthA, bc);
         host_strided_batch_vector<T> hAres(size_Ares, 1, stA, bc);
         device_strided_batch_vector<T> dA(size_A, 1, stA, bc);
         if(size_A)
@@ -419,6 +419,7 @@ void syevdx_heevdx_inplace_getPerfData(const rocblas_handle handle,
     {
         syevdx_heevdx_inplace_initData<false, true, T>(handle, evect, n, dA, lda, bc, hA, A, 0);
 
+        rocsolver_bench_first_call first_call(handle, iter);
         CHECK_ROCBLAS_ERROR(rocsolver_syevdx_heevdx_inplace(
             STRIDED, handle, evect, erange, uplo, n, dA.data(), lda, stA, vl, vu, il, iu, abstol,
             hNevRes.data(), dW.data(), stW, dinfo.data(), bc));
@@ -427,7 +428,7 @@ void syevdx_heevdx_inplace_getPerfData(const rocblas_handle handle,
     // gpu-lapack performance
     hipStream_t stream;
     CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
-    double start;
+    rocsolver_bench_timer timer(stream, hot_calls);
 
     if(profile > 0)
     {
@@ -439,15 +440,15 @@ void syevdx_heevdx_inplace_getPerfData(const rocblas_handle handle,
         rocsolver_log_set_max_levels(profile);
     }
 
-    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    for(rocblas_int iter = 0; iter < timer.calls(); iter++)
     {
         syevdx_heevdx_inplace_initData<false, true, T>(handle, evect, n, dA, lda, bc, hA, A, 0);
 
-        start = get_time_us_sync(stream);
+        timer.start(iter);
         rocsolver_syevdx_heevdx_inplace(STRIDED, handle, evect, erange, uplo, n, dA.data(), lda,
                                         stA, vl, vu, il, iu, abstol, hNevRes.data(), dW.data(), stW,
                                         dinfo.data(), bc);
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        *gpu_time_used += timer.stop(iter);
     }
     *gpu_time_used /= hot_calls;
 }
@@ -409,6 +409,7 @@ void syevj_heevj_getPerfData(const rocblas_handle handle,
     {
         syevj_heevj_initData<false, true, T>(handle, evect, n, dA, lda, bc, hA, A, 0);
 
+        rocsolver_bench_first_call first_call(handle, iter);
         CHECK_ROCBLAS_ERROR(rocsolver_syevj_heevj(STRIDED, handle, esort, evect, uplo, n, dA.data(),
                                                   lda, stA, abstol, dResidual.data(), max_sweeps,
                                                   dSweeps.data(), dW.data(), stW, dInfo.data(), bc));
@@ -417,7 +418,7 @@ void syevj_heevj_getPerfData(const rocblas_handle handle,
     // gpu-lapack performance
     hipStream_t stream;
     CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
-    double start;
+    rocsolver_bench_timer timer(stream, hot_calls);
 
     if(profile > 0)
     {
@@ -429,15 +430,15 @@ void syevj_heevj_getPerfData(const rocblas_handle handle,
         rocsolver_log_set_max_levels(profile);
     }
 
-    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    for(rocblas_int iter = 0; iter < timer.calls(); iter++)
     {
         syevj_heevj_initData<false, true, T>(handle, evect, n, dA, lda, bc, hA, A, 0);
 
-        start = get_time_us_sync(stream);
+        timer.start(iter);
         rocsolver_syevj_heevj(STRIDED, handle, esort, evect, uplo, n, dA.data(), lda, stA, abstol,
                               dResidual.data(), max_sweeps, dSweeps.data(), dW.data(), stW,
                               dInfo.data(), bc);
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        *gpu_time_used += timer.stop(iter);
     }
     *gpu_time_used /= hot_calls;
 }
@@ -459,13 +460,18 @@ void testing_syevj_heevj(Arguments& argus)
 
     S abstol = S(argus.get<double>("abstol", 0));
     rocblas_int max_sweeps = argus.get<rocblas_int>("max_sweeps", 100);
+    char algC = argus.get<char>("alg_mode", 'Q');
 
     rocblas_evect evect = char2rocblas_evect(evectC);
     rocblas_esort esort = char2rocblas_esort(esortC);
     rocblas_fill uplo = char2rocblas_fill(uploC);
+    rocsolver_alg_mode alg = char2rocsolver_alg_mode(algC);
     rocblas_int bc = argus.batch_count;
     rocblas_int hot_calls = argus.iters;
 
+    // select the algorithm
+    CHECK_ROCBLAS_ERROR(rocsolver_set_alg_mode(handle, rocsolver_function_syevj, alg));
+
     // check non-supported values
     if(uplo == rocblas_fill_full || evect == rocblas_evect_tridiagonal)
     {
@@ -0,0 +1,530 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "common/misc/client_util.hpp"
+#include "common/misc/clientcommon.hpp"
+#include "common/misc/lapack_host_reference.hpp"
+#include "common/misc/norm.hpp"
+#include "common/misc/rocsolver.hpp"
+#include "common/misc/rocsolver_arguments.hpp"
+#include "common/misc/rocsolver_test.hpp"
+
+template <typename T, typename S>
+void syevs_heevs_checkBadArgs(const rocblas_handle handle,
+                              const rocblas_fill uplo,
+                              const rocblas_int n,
+                              T* dA,
+                              const rocblas_int lda,
+                              const rocblas_int nev,
+                              const rocblas_int k,
+                              T* dX,
+                              const rocblas_int ldx,
+                              const S tol,
+                              const rocblas_int max_iter,
+                              rocblas_int* dIter,
+                              S* dW,
+                              rocblas_int* dInfo)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_syevs_heevs(nullptr, uplo, n, dA, lda, nev, k, dX, ldx, tol,
+                                                max_iter, dIter, dW, dInfo),
+                          rocblas_status_invalid_handle);
+
+    // values
+    EXPECT_ROCBLAS_STATUS(rocsolver_syevs_heevs(handle, rocblas_fill_full, n, dA, lda, nev, k, dX,
+                                                ldx, tol, max_iter, dIter, dW, dInfo),
+                          rocblas_status_invalid_value);
+
+    // sizes
+    EXPECT_ROCBLAS_STATUS(rocsolver_syevs_heevs(handle, uplo, n, dA, lda, nev, k, dX, ldx, tol, -1,
+                                                dIter, dW, dInfo),
+                          rocblas_status_invalid_size);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_syevs_heevs(handle, uplo, n, (T*)nullptr, lda, nev, k, dX, ldx,
+                                                tol, max_iter, dIter, dW, dInfo),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_syevs_heevs(handle, uplo, n, dA, lda, nev, k, (T*)nullptr, ldx,
+                                                tol, max_iter, dIter, dW, dInfo),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_syevs_heevs(handle, uplo, n, dA, lda, nev, k, dX, ldx, tol,
+                                                max_iter, (rocblas_int*)nullptr, dW, dInfo),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_syevs_heevs(handle, uplo, n, dA, lda, nev, k, dX, ldx, tol,
+                                                max_iter, dIter, (S*)nullptr, dInfo),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_syevs_heevs(handle, uplo, n, dA, lda, nev, k, dX, ldx, tol,
+                                                max_iter, dIter, dW, (rocblas_int*)nullptr),
+                          rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_syevs_heevs(handle, uplo, 0, (T*)nullptr, lda, 0, 0,
+                                                (T*)nullptr, ldx, tol, max_iter, dIter,
+                                                (S*)nullptr, dInfo),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(rocsolver_syevs_heevs(handle, uplo, n, dA, lda, 0, 0, (T*)nullptr, ldx,
+                                                tol, max_iter, dIter, (S*)nullptr, dInfo),
+                          rocblas_status_success);
+}
+
+template <typename T>
+void testing_syevs_heevs_bad_arg()
+{
+    using S = decltype(std::real(T{}));
+
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_fill uplo = rocblas_fill_lower;
+    rocblas_int n = 1;
+    rocblas_int lda = 1;
+    rocblas_int nev = 1;
+    rocblas_int k = 1;
+    rocblas_int ldx = 1;
+    S tol = 0;
+    rocblas_int max_iter = 10;
+
+    // memory allocations
+    device_strided_batch_vector<T> dA(1, 1, 1, 1);
+    device_strided_batch_vector<T> dX(1, 1, 1, 1);
+    device_strided_batch_vector<rocblas_int> dIter(1, 1, 1, 1);
+    device_strided_batch_vector<S> dW(1, 1, 1, 1);
+    device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dX.memcheck());
+    CHECK_HIP_ERROR(dIter.memcheck());
+    CHECK_HIP_ERROR(dW.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    // check bad arguments
+    syevs_heevs_checkBadArgs(handle, uplo, n, dA.data(), lda, nev, k, dX.data(), ldx, tol,
+                             max_iter, dIter.data(), dW.data(), dInfo.data());
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Th>
+void syevs_heevs_initData(const rocblas_handle handle,
+                          const rocblas_int n,
+                          Td& dA,
+                          const rocblas_int lda,
+                          Td& dX,
+                          const rocblas_int ldx,
+                          Th& hA,
+                          Th& hX,
+                          std::vector<T>& A)
+{
+    if(CPU)
+    {
+        rocblas_init<T>(hA, true);
+        rocblas_init<T>(hX, true);
+
+        // build a Hermitian matrix with a spread spectrum (diagonal entries growing with the
+        // row index and small off-diagonal entries), so that the lowest eigenvalues are well
+        // separated from the rest
+        for(rocblas_int j = 0; j < n; j++)
+        {
+            hA[0][j + j * lda] = std::real(hA[0][j + j * lda]) + 10 * (j + 1);
+            for(rocblas_int i = j + 1; i < n; i++)
+            {
+                hA[0][i + j * lda] = hA[0][i + j * lda] / T(n);
+                hA[0][j + i * lda] = sconj(hA[0][i + j * lda]);
+            }
+        }
+
+        // make copy of original data to test vectors
+        for(rocblas_int j = 0; j < n; j++)
+        {
+            for(rocblas_int i = 0; i < n; i++)
+                A[i + j * lda] = hA[0][i + j * lda];
+        }
+    }
+
+    if(GPU)
+    {
+        // now copy to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        CHECK_HIP_ERROR(dX.transfer_from(hX));
+    }
+}
+
+template <typename T, typename S, typename Td, typename Id, typename Sd, typename Th, typename Ih, typename Sh>
+void syevs_heevs_getError(const rocblas_handle handle,
+                          const rocblas_fill uplo,
+                          const rocblas_int n,
+                          Td& dA,
+                          const rocblas_int lda,
+                          const rocblas_int nev,
+                          const rocblas_int k,
+                          Td& dX,
+                          const rocblas_int ldx,
+                          const S tol,
+                          const rocblas_int max_iter,
+                          Id& dIter,
+                          Sd& dW,
+                          Id& dInfo,
+                          Th& hA,
+                          Th& hX,
+                          Th& hXRes,
+                          Ih& hIterRes,
+                          Sh& hW,
+                          Sh& hWRes,
+                          Ih& hInfoRes,
+                          double* max_err)
+{
+    constexpr bool COMPLEX = rocblas_is_complex<T>;
+
+    int lwork = (COMPLEX ? 2 * n - 1 : 0);
+    int lrwork = 3 * n - 1;
+    std::vector<T> work(lwork);
+    std::vector<S> rwork(lrwork);
+    std::vector<T> A(size_t(lda) * n);
+    rocblas_int info;
+
+    // input data initialization
+    syevs_heevs_initData<true, true, T>(handle, n, dA, lda, dX, ldx, hA, hX, A);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_syevs_heevs(handle, uplo, n, dA.data(), lda, nev, k, dX.data(),
+                                              ldx, tol, max_iter, dIter.data(), dW.data(),
+                                              dInfo.data()));
+    CHECK_HIP_ERROR(hXRes.transfer_from(dX));
+    CHECK_HIP_ERROR(hIterRes.transfer_from(dIter));
+    CHECK_HIP_ERROR(hWRes.transfer_from(dW));
+    CHECK_HIP_ERROR(hInfoRes.transfer_from(dInfo));
+
+    // CPU lapack
+    cpu_syev_heev(rocblas_evect_none, uplo, n, hA[0], lda, hW[0], work.data(), lwork, rwork.data(),
+                  lrwork, &info);
+
+    // (We expect the used input matrices to always converge)
+    *max_err = 0;
+    EXPECT_EQ(hInfoRes[0][0], 0);
+    if(hInfoRes[0][0] != 0)
+        *max_err += 1;
+
+    // Also check validity of the number of iterations
+    EXPECT_GE(hIterRes[0][0], 0);
+    EXPECT_LE(hIterRes[0][0], max_iter);
+    if(hIterRes[0][0] < 0 || hIterRes[0][0] > max_iter)
+        *max_err += 1;
+
+    // error is ||hW - hWRes|| / ||hW|| over the nev lowest eigenvalues
+    // using frobenius norm
+    double err = norm_error('F', 1, nev, 1, hW[0], hWRes[0]);
+    *max_err = err > *max_err ? err : *max_err;
+
+    // check the wanted Ritz vectors implicitly (A*x_j = w_j*x_j)
+    err = 0;
+    for(rocblas_int jj = 0; jj < nev; jj++)
+    {
+        for(rocblas_int i = 0; i < n; i++)
+        {
+            T tmp = 0;
+            for(rocblas_int j = 0; j < n; j++)
+                tmp += A[i + j * lda] * hXRes[0][j + jj * ldx];
+            tmp -= hWRes[0][jj] * hXRes[0][i + jj * ldx];
+            err += std::abs(tmp) * std::abs(tmp);
+        }
+    }
+    err = std::sqrt(err) / double(snorm('F', n, n, A.data(), lda));
+    *max_err = err > *max_err ? err : *max_err;
+
+    // and the orthonormality of all the Ritz vectors
+    err = 0;
+    for(rocblas_int jj = 0; jj < k; jj++)
+    {
+        for(rocblas_int ii = 0; ii < k; ii++)
+        {
+            T tmp = (ii == jj ? T(-1) : T(0));
+            for(rocblas_int i = 0; i < n; i++)
+                tmp += sconj(hXRes[0][i + ii * ldx]) * hXRes[0][i + jj * ldx];
+            err += std::abs(tmp) * std::abs(tmp);
+        }
+    }
+    err = std::sqrt(err);
+    *max_err = err > *max_err ? err : *max_err;
+}
+
+template <typename T, typename S, typename Td, typename Id, typename Sd, typename Th, typename Sh>
+void syevs_heevs_getPerfData(const rocblas_handle handle,
+                             const rocblas_fill uplo,
+                             const rocblas_int n,
+                             Td& dA,
+                             const rocblas_int lda,
+                             const rocblas_int nev,
+                             const rocblas_int k,
+                             Td& dX,
+                             const rocblas_int ldx,
+                             const S tol,
+                             const rocblas_int max_iter,
+                             Id& dIter,
+                             Sd& dW,
+                             Id& dInfo,
+                             Th& hA,
+                             Th& hX,
+                             Sh& hW,
+                             double* gpu_time_used,
+                             double* cpu_time_used,
+                             const rocblas_int hot_calls,
+                             const int profile,
+                             const bool profile_kernels,
+                             const bool perf)
+{
+    constexpr bool COMPLEX = rocblas_is_complex<T>;
+
+    int lwork = (COMPLEX ? 2 * n - 1 : 0);
+    int lrwork = 3 * n - 1;
+    std::vector<T> work(lwork);
+    std::vector<S> rwork(lrwork);
+    std::vector<T> A(size_t(lda) * n);
+    rocblas_int info;
+
+    if(!perf)
+    {
+        syevs_heevs_initData<true, false, T>(handle, n, dA, lda, dX, ldx, hA, hX, A);
+
+        // cpu-lapack performance (only if not in perf mode)
+        // (the full eigenvalue decomposition is used as reference)
+        *cpu_time_used = get_time_us_no_sync();
+        cpu_syev_heev(rocblas_evect_none, uplo, n, hA[0], lda, hW[0], work.data(), lwork,
+                      rwork.data(), lrwork, &info);
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    syevs_heevs_initData<true, false, T>(handle, n, dA, lda, dX, ldx, hA, hX, A);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        syevs_heevs_initData<false, true, T>(handle, n, dA, lda, dX, ldx, hA, hX, A);
+
+        rocsolver_bench_first_call first_call(handle, iter);
+        CHECK_ROCBLAS_ERROR(rocsolver_syevs_heevs(handle, uplo, n, dA.data(), lda, nev, k,
+                                                  dX.data(), ldx, tol, max_iter, dIter.data(),
+                                                  dW.data(), dInfo.data()));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    rocsolver_bench_timer timer(stream, hot_calls);
+
+    if(profile > 0)
+    {
+        if(profile_kernels)
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile
+                                         | rocblas_layer_mode_ex_log_kernel);
+        else
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile);
+        rocsolver_log_set_max_levels(profile);
+    }
+
+    for(rocblas_int iter = 0; iter < timer.calls(); iter++)
+    {
+        syevs_heevs_initData<false, true, T>(handle, n, dA, lda, dX, ldx, hA, hX, A);
+
+        timer.start(iter);
+        rocsolver_syevs_heevs(handle, uplo, n, dA.data(), lda, nev, k, dX.data(), ldx, tol,
+                              max_iter, dIter.data(), dW.data(), dInfo.data());
+        *gpu_time_used += timer.stop(iter);
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <typename T>
+void testing_syevs_heevs(Arguments& argus)
+{
+    using S = decltype(std::real(T{}));
+
+    // get arguments
+    rocblas_local_handle handle;
+    char uploC = argus.get<char>("uplo");
+    rocblas_int n = argus.get<rocblas_int>("n");
+    rocblas_int lda = argus.get<rocblas_int>("lda", n);
+    rocblas_int nev = argus.get<rocblas_int>("nev", std::min(n, 4));
+    rocblas_int k = argus.get<rocblas_int>("k", std::min(n, nev + std::max(5, nev / 2)));
+    rocblas_int ldx = argus.get<rocblas_int>("ldx", n);
+
+    S tol = S(argus.get<double>("abstol", 0));
+    rocblas_int max_iter = argus.get<rocblas_int>("max_sweeps", 100);
+
+    rocblas_fill uplo = char2rocblas_fill(uploC);
+    rocblas_int hot_calls = argus.iters;
+
+    // check non-supported values
+    if(uplo == rocblas_fill_full)
+    {
+        EXPECT_ROCBLAS_STATUS(rocsolver_syevs_heevs(handle, uplo, n, (T*)nullptr, lda, nev, k,
+                                                    (T*)nullptr, ldx, tol, max_iter,
+                                                    (rocblas_int*)nullptr, (S*)nullptr,
+                                                    (rocblas_int*)nullptr),
+                              rocblas_status_invalid_value);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_args);
+
+        return;
+    }
+
+    // determine sizes
+    size_t size_A = size_t(lda) * n;
+    size_t size_X = size_t(ldx) * k;
+    size_t size_W = std::max(n, 1);
+    size_t size_XRes = (argus.unit_check || argus.norm_check) ? size_X : 0;
+    size_t size_WRes = (argus.unit_check || argus.norm_check) ? size_W : 0;
+
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    // check invalid sizes
+    bool invalid_size
+        = (n < 0 || lda < n || nev < 0 || k < nev || k > n || ldx < n || max_iter < 0);
+    if(invalid_size)
+    {
+        EXPECT_ROCBLAS_STATUS(rocsolver_syevs_heevs(handle, uplo, n, (T*)nullptr, lda, nev, k,
+                                                    (T*)nullptr, ldx, tol, max_iter,
+                                                    (rocblas_int*)nullptr, (S*)nullptr,
+                                                    (rocblas_int*)nullptr),
+                              rocblas_status_invalid_size);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_size);
+
+        return;
+    }
+
+    // memory size query is necessary
+    if(argus.mem_query || !USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        CHECK_ALLOC_QUERY(rocsolver_syevs_heevs(handle, uplo, n, (T*)nullptr, lda, nev, k,
+                                                (T*)nullptr, ldx, tol, max_iter,
+                                                (rocblas_int*)nullptr, (S*)nullptr,
+                                                (rocblas_int*)nullptr));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        if(argus.mem_query)
+        {
+            rocsolver_bench_inform(inform_mem_query, size);
+            return;
+        }
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    // memory allocations
+    host_strided_batch_vector<T> hA(size_A, 1, size_A, 1);
+    host_strided_batch_vector<T> hX(size_X, 1, size_X, 1);
+    host_strided_batch_vector<T> hXRes(size_XRes, 1, size_XRes, 1);
+    host_strided_batch_vector<S> hW(size_W, 1, size_W, 1);
+    host_strided_batch_vector<S> hWRes(size_WRes, 1, size_WRes, 1);
+    host_strided_batch_vector<rocblas_int> hIterRes(1, 1, 1, 1);
+    host_strided_batch_vector<rocblas_int> hInfoRes(1, 1, 1, 1);
+    device_strided_batch_vector<T> dA(size_A, 1, size_A, 1);
+    device_strided_batch_vector<T> dX(size_X, 1, size_X, 1);
+    device_strided_batch_vector<S> dW(size_W, 1, size_W, 1);
+    device_strided_batch_vector<rocblas_int> dIter(1, 1, 1, 1);
+    device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, 1);
+    if(size_A)
+        CHECK_HIP_ERROR(dA.memcheck());
+    if(size_X)
+        CHECK_HIP_ERROR(dX.memcheck());
+    CHECK_HIP_ERROR(dW.memcheck());
+    CHECK_HIP_ERROR(dIter.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    // check quick return
+    if(n == 0 || k == 0)
+    {
+        EXPECT_ROCBLAS_STATUS(rocsolver_syevs_heevs(handle, uplo, n, dA.data(), lda, nev, k,
+                                                    dX.data(), ldx, tol, max_iter, dIter.data(),
+                                                    dW.data(), dInfo.data()),
+                              rocblas_status_success);
+        if(argus.timing)
+            rocsolver_bench_inform(inform_quick_return);
+
+        return;
+    }
+
+    // check computations
+    if(argus.unit_check || argus.norm_check)
+        syevs_heevs_getError<T>(handle, uplo, n, dA, lda, nev, k, dX, ldx, tol, max_iter, dIter,
+                                dW, dInfo, hA, hX, hXRes, hIterRes, hW, hWRes, hInfoRes,
+                                &max_error);
+
+    // collect performance data
+    if(argus.timing)
+        syevs_heevs_getPerfData<T>(handle, uplo, n, dA, lda, nev, k, dX, ldx, tol, max_iter, dIter,
+                                   dW, dInfo, hA, hX, hW, &gpu_time_used, &cpu_time_used,
+                                   hot_calls, argus.profile, argus.profile_kernels, argus.perf);
+
+    // validate results for rocsolver-test
+    // using 2 * n * machine_precision as tolerance
+    // (the tests use tol = n * machine_precision, relative to the largest eigenvalue)
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, 2 * n);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            rocsolver_bench_header("Arguments:");
+            rocsolver_bench_output("uplo", "n", "lda", "nev", "k", "ldx", "tol", "max_iter");
+            rocsolver_bench_output(uploC, n, lda, nev, k, ldx, tol, max_iter);
+
+            rocsolver_bench_header("Results:");
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_bench_endl();
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
+
+#define EXTERN_TESTING_SYEVS_HEEVS(...) \
+    extern template void testing_syevs_heevs<__VA_ARGS__>(Arguments&);
+
+INSTANTIATE(EXTERN_TESTING_SYEVS_HEEVS, FOREACH_SCALAR_TYPE, APPLY_STAMP)
@@ -436,6 +436,7 @@ void sygvdj_hegvdj_getPerfData(const rocblas_handle handle,
         sygvdj_hegvdj_initData<false, true, T>(handle, itype, evect, n, dA, lda, stA, dB, ldb, stB,
                                                bc, hA, hB, A, B, false, singular);
 
+        rocsolver_bench_first_call first_call(handle, iter);
         CHECK_ROCBLAS_ERROR(rocsolver_sygvdj_hegvdj(STRIDED, handle, itype, evect, uplo, n,
                                                     dA.data(), lda, stA, dB.data(), ldb, stB,
                                                     dD.data(), stD, dInfo.data(), bc));
@@ -444,7 +445,7 @@ void sygvdj_hegvdj_getPerfData(const rocblas_handle handle,
     // gpu-lapack performance
     hipStream_t stream;
     CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
-    double start;
+    rocsolver_bench_timer timer(stream, hot_calls);
 
     if(profile > 0)
     {
@@ -456,15 +457,15 @@ void sygvdj_hegvdj_getPerfData(const rocblas_handle handle,
         rocsolver_log_set_max_levels(profile);
     }
 
-    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    for(rocblas_int iter = 0; iter < timer.calls(); iter++)
     {
         sygvdj_hegvdj_initData<false, true, T>(handle, itype, evect, n, dA, lda, stA, dB, ldb, stB,
                                                bc, hA, hB, A, B, false, singular);
 
-        start = get_time_us_sync(stream);
+        timer.start(iter);
         rocsolver_sygvdj_hegvdj(STRIDED, handle, itype, evect, uplo, n, dA.data(), lda, stA,
                                 dB.data(), ldb, stB, dD.data(), stD, dInfo.data(), bc);
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        *gpu_time_used += timer.stop(iter);
     }
     *gpu_time_used /= hot_calls;
 }
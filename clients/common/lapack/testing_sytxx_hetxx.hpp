@@ -29,6 +29,7 @@
 
 #include "common/misc/client_util.hpp"
 #include "common/misc/clientcommon.hpp"
+#include "common/misc/device_data_initializer.hpp"
 #include "common/misc/lapack_host_reference.hpp"
 #include "common/misc/norm.hpp"
 #include "common/misc/rocsolver.hpp"
@@ -151,7 +152,7 @@ void sytxx_hetxx_initData(const rocblas_handle handle,
                           const rocblas_int bc,
                           Th& hA)
 {
-    if(CPU)
+    if(CPU && !rocsolver_bench_device_init)
     {
         rocblas_init<T>(hA, true);
 
@@ -173,8 +174,19 @@ void sytxx_hetxx_initData(const rocblas_handle handle,
 
     if(GPU)
     {
-        // now copy to the GPU
-        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        if(rocsolver_bench_device_init)
+        {
+            // generate a random symmetric/Hermitian matrix directly on the GPU
+            hipStream_t stream;
+            CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+            device_init_matrix<T>(device_init_symmetric, n, n, dA.data(), lda, dA.stride(), bc,
+                                  stream);
+        }
+        else
+        {
+            // now copy to the GPU
+            CHECK_HIP_ERROR(dA.transfer_from(hA));
+        }
     }
 }
 
@@ -186,7 +198,7 @@ void sytxx_hetxx_initData(const rocblas_handle handle,
                           const rocblas_int bc,
                           Th& hA)
 {
-    if(CPU)
+    if(CPU && !rocsolver_bench_device_init)
     {
         rocblas_init<T>(hA, true);
 
@@ -210,8 +222,19 @@ void sytxx_hetxx_initData(const rocblas_handle handle,
 
     if(GPU)
     {
-        // now copy to the GPU
-        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        if(rocsolver_bench_device_init)
+        {
+            // generate a random symmetric/Hermitian matrix directly on the GPU
+            hipStream_t stream;
+            CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+            device_init_matrix<T>(device_init_symmetric, n, n, dA.data(), lda, dA.stride(), bc,
+                                  stream);
+        }
+        else
+        {
+            // now copy to the GPU
+            CHECK_HIP_ERROR(dA.transfer_from(hA));
+        }
     }
 }
 
@@ -359,7 +382,7 @@ void sytxx_hetxx_getPerfData(const rocblas_handle handle,
 {
     std::vector<T> hW(32 * n);
 
-    if(!perf)
+    if(!perf && !rocsolver_bench_device_init)
     {
         sytxx_hetxx_initData<true, false, T>(handle, n, dA, lda, bc, hA);
 
@@ -373,6 +396,8 @@ void sytxx_hetxx_getPerfData(const rocblas_handle handle,
         }
         *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
     }
+    else if(rocsolver_bench_device_init)
+        *cpu_time_used = nan(""); // no host data for cpu-lapack execution
 
     sytxx_hetxx_initData<true, false, T>(handle, n, dA, lda, bc, hA);
 
@@ -381,6 +406,7 @@ void sytxx_hetxx_getPerfData(const rocblas_handle handle,
     {
         sytxx_hetxx_initData<false, true, T>(handle, n, dA, lda, bc, hA);
 
+        rocsolver_bench_first_call first_call(handle, iter);
         CHECK_ROCBLAS_ERROR(rocsolver_sytxx_hetxx(STRIDED, SYTRD, handle, uplo, n, dA.data(), lda,
                                                   stA, dD.data(), stD, dE.data(), stE, dTau.data(),
                                                   stP, bc));
@@ -389,7 +415,7 @@ void sytxx_hetxx_getPerfData(const rocblas_handle handle,
     // gpu-lapack performance
     hipStream_t stream;
     CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
-    double start;
+    rocsolver_bench_timer timer(stream, hot_calls);
 
     if(profile > 0)
     {
@@ -401,14 +427,14 @@ void sytxx_hetxx_getPerfData(const rocblas_handle handle,
         rocsolver_log_set_max_levels(profile);
     }
 
-    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    for(rocblas_int iter = 0; iter < timer.calls(); iter++)
     {
         sytxx_hetxx_initData<false, true, T>(handle, n, dA, lda, bc, hA);
 
-        start = get_time_us_sync(stream);
+        timer.start(iter);
         rocsolver_sytxx_hetxx(STRIDED, SYTRD, handle, uplo, n, dA.data(), lda, stA, dD.data(), stD,
                               dE.data(), stE, dTau.data(), stP, bc);
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        *gpu_time_used += timer.stop(iter);
     }
     *gpu_time_used /= hot_calls;
 }
@@ -463,6 +489,10 @@ void testing_sytxx_hetxx(Arguments& argus)
 
     size_t size_ARes = (argus.unit_check || argus.norm_check) ? size_A : 0;
 
+    // the host copy of A is not needed if the input data is generated on the device
+    size_t size_hA = rocsolver_bench_device_init ? 0 : size_A;
+    rocblas_stride sthA = rocsolver_bench_device_init ? 0 : stA;
+
     // check invalid sizes
     bool invalid_size = (n < 0 || lda < n || bc < 0);
     if(invalid_size)
@@ -527,7 +557,7 @@ void testing_sytxx_hetxx(Arguments& argus)
     if(BATCHED)
     {
         // memory allocations
-        host_batch_vector<T> hA(size_A, 1, bc);
+        host_batch_vector<T> hA(size_hA, 1, bc);
         host_batch_vector<T> hARes(size_ARes, 1, bc);
         device_batch_vector<T> dA(size_A, 1, bc);
         if(size_A)
@@ -563,7 +593,7 @@ void testing_sytxx_hetxx(Arguments& argus)
     else
     {
         // memory allocations
-        host_strided_batch_vector<T> hA(size_A, 1, stA, bc);
+        host_strided_batch_vector<T> hA(size_hA, 1, sthA, bc);
         host_strided_batch_vector<T> hARes(size_ARes, 1, stARes, bc);
         device_strided_batch_vector<T> dA(size_A, 1, stA, bc);
         if(size_A)
@@ -56,6 +56,9 @@
 #define FOREACH_BLOCKED_VARIANT(STAMP, F, ...) \
     F(STAMP, ##__VA_ARGS__, false)             \
     F(STAMP, ##__VA_ARGS__, true)
+#define FOREACH_STRIDED_VARIANT(STAMP, F, ...) \
+    F(STAMP, ##__VA_ARGS__, false)             \
+    F(STAMP, ##__VA_ARGS__, true)
 #define FOREACH_INT_TYPE(STAMP, F, ...)  \
     F(STAMP, ##__VA_ARGS__, rocblas_int) \
     F(STAMP, ##__VA_ARGS__, int64_t)
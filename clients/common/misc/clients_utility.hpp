@@ -53,6 +53,10 @@ static constexpr char LIMITED_MEMORY_STRING_GTEST[]
 // Return the path to the client executable, for finding test matrices on filesystem
 std::string rocsolver_exepath();
 
+/*! \brief  stream assigned to the local handles created by the current thread (if non-null);
+ *  used by the multi-stream benchmarks to run independent tests concurrently */
+inline thread_local hipStream_t rocblas_local_handle_stream = nullptr;
+
 /* ============================================================================================
  */
 /*! \brief  local handle which is automatically created and destroyed  */
@@ -64,6 +68,8 @@ public:
     rocblas_local_handle()
     {
         rocblas_create_handle(&m_handle);
+        if(rocblas_local_handle_stream)
+            rocblas_set_stream(m_handle, rocblas_local_handle_stream);
     }
     ~rocblas_local_handle()
     {
@@ -94,6 +100,13 @@ rocblas_int query_device_property();
 /*  set current device to device_id */
 void set_device(rocblas_int device_id);
 
+/*  size of the instance b of a variable-size (vbatched) test batch with maximum size n.
+    The sizes cycle between n/2 and n, and the first instance is always of size n */
+inline rocblas_int vbatched_size(rocblas_int b, rocblas_int n)
+{
+    return n - (5 * b) % (n / 2 + 1);
+}
+
 /* ============================================================================================
  */
 template <typename T>
@@ -0,0 +1,272 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include <hip/hip_runtime.h>
+#include <rocblas/rocblas.h>
+
+#include "rocblas_test.hpp"
+
+/*
+ * ===========================================================================
+ *    Generators of the input data of the benchmarks directly in device
+ *    memory (see --device_init in rocsolver-bench). Every element is computed
+ *    from a counter-based hash of its position, so that the matrices are
+ *    reproducible, do not depend on the leading dimension or on the launch
+ *    configuration, and no host memory (or host to device copy) is needed for
+ *    them. The entries of the random matrices are uniformly distributed in
+ *    [-1, 1) (in the real and imaginary parts for the complex cases).
+ * ===========================================================================
+ */
+
+static constexpr uint64_t device_init_seed = 0x5eed2025ull;
+
+enum device_init_type
+{
+    device_init_general, // random general matrix
+    device_init_symmetric, // random symmetric/Hermitian matrix (both triangles are set)
+    device_init_spd, // diagonally dominant symmetric/Hermitian positive definite matrix
+    device_init_identity, // identity matrix (for the initial eigenvectors)
+};
+
+// splitmix64 finalizer of the counter idx, mapped to [-1, 1)
+__host__ __device__ inline double device_init_uniform(uint64_t seed, uint64_t idx)
+{
+    uint64_t z = seed + (idx + 1) * 0x9e3779b97f4a7c15ull;
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    z ^= z >> 31;
+    return double(z >> 11) * 0x1.0p-52 - 1.0;
+}
+
+__device__ inline void device_init_set(float& a, uint64_t seed, uint64_t idx, bool real)
+{
+    a = float(device_init_uniform(seed, idx));
+}
+__device__ inline void device_init_set(double& a, uint64_t seed, uint64_t idx, bool real)
+{
+    a = device_init_uniform(seed, idx);
+}
+__device__ inline void device_init_set(rocblas_float_complex& a,
+                                       uint64_t seed,
+                                       uint64_t idx,
+                                       bool real)
+{
+    a = rocblas_float_complex(float(device_init_uniform(seed, 2 * idx)),
+                              real ? 0.0f : float(device_init_uniform(seed, 2 * idx + 1)));
+}
+__device__ inline void device_init_set(rocblas_double_complex& a,
+                                       uint64_t seed,
+                                       uint64_t idx,
+                                       bool real)
+{
+    a = rocblas_double_complex(device_init_uniform(seed, 2 * idx),
+                               real ? 0.0 : device_init_uniform(seed, 2 * idx + 1));
+}
+
+template <typename T>
+__device__ inline T device_init_conj(T a)
+{
+    return a;
+}
+__device__ inline rocblas_float_complex device_init_conj(rocblas_float_complex a)
+{
+    return rocblas_float_complex(a.real(), -a.imag());
+}
+__device__ inline rocblas_double_complex device_init_conj(rocblas_double_complex a)
+{
+    return rocblas_double_complex(a.real(), -a.imag());
+}
+
+// pointer to the matrix of instance b, for the strided and the batched containers
+template <typename T>
+__device__ inline T* device_init_ptr(T* A, int64_t b, rocblas_stride stA)
+{
+    return A + b * stA;
+}
+template <typename T>
+__device__ inline T* device_init_ptr(T* const* A, int64_t b, rocblas_stride stA)
+{
+    return A[b];
+}
+
+template <typename T, typename U>
+__global__ void device_init_matrix_kernel(const device_init_type type,
+                                          const int64_t m,
+                                          const int64_t n,
+                                          U AA,
+                                          const int64_t lda,
+                                          const rocblas_stride stA,
+                                          const uint64_t seed)
+{
+    int64_t b = blockIdx.z;
+    int64_t i = blockIdx.x * int64_t(blockDim.x) + threadIdx.x;
+    int64_t j = blockIdx.y * int64_t(blockDim.y) + threadIdx.y;
+    if(i >= m || j >= n)
+        return;
+
+    T* A = device_init_ptr(AA, b, stA);
+    T a;
+    if(type == device_init_identity)
+        a = (i == j) ? T(1) : T(0);
+    else if(type == device_init_general)
+        device_init_set(a, seed, uint64_t(b * m + i) * n + j, false);
+    else
+    {
+        // the element is drawn from the position in the lower triangle, so that the upper
+        // triangle is its conjugate, and the diagonal is real
+        int64_t r = (i >= j) ? i : j;
+        int64_t c = (i >= j) ? j : i;
+        device_init_set(a, seed, uint64_t(b * n + r) * n + c, r == c);
+        if(i < j)
+            a = device_init_conj(a);
+        if(type == device_init_spd && i == j)
+            a += T(2 * n);
+    }
+    A[i + j * lda] = a;
+}
+
+// rank-one structure of the matrices with a given spectrum, A = H * diag(D) * H, with the
+// Householder reflector H = I - 2 * w * w' (|w| = 1); the element (i, j) is
+// D[i] * delta(i, j) + w[i] * w[j] * (4 * s - 2 * (D[i] + D[j])) with s = sum(D[k] * w[k]^2)
+template <typename T, typename U, typename S>
+__global__ void device_init_spectrum_kernel(const int64_t n,
+                                            const S* Dw,
+                                            const S s,
+                                            U AA,
+                                            const int64_t lda,
+                                            const rocblas_stride stA)
+{
+    int64_t b = blockIdx.z;
+    int64_t i = blockIdx.x * int64_t(blockDim.x) + threadIdx.x;
+    int64_t j = blockIdx.y * int64_t(blockDim.y) + threadIdx.y;
+    if(i >= n || j >= n)
+        return;
+
+    T* A = device_init_ptr(AA, b, stA);
+    const S* D = Dw;
+    const S* w = Dw + n;
+    S a = w[i] * w[j] * (4 * s - 2 * (D[i] + D[j]));
+    if(i == j)
+        a += D[i];
+    A[i + j * lda] = T(a);
+}
+
+/** Sets the m-by-n matrices A of the batch (stored with leading dimension lda and stride stA,
+    or as an array of pointers) to matrices of the given type. **/
+template <typename T, typename U>
+void device_init_matrix(const device_init_type type,
+                        const int64_t m,
+                        const int64_t n,
+                        U A,
+                        const int64_t lda,
+                        const rocblas_stride stA,
+                        const int64_t bc,
+                        hipStream_t stream,
+                        const uint64_t seed = device_init_seed)
+{
+    if(m <= 0 || n <= 0 || bc <= 0)
+        return;
+
+    dim3 threads(32, 8, 1);
+    dim3 blocks((m - 1) / 32 + 1, (n - 1) / 8 + 1, bc);
+    hipLaunchKernelGGL((device_init_matrix_kernel<T, U>), blocks, threads, 0, stream, type, m, n,
+                       A, lda, stA, seed);
+    CHECK_HIP_ERROR(hipGetLastError());
+}
+
+/** Sets the n-by-n matrices A of the batch to the same symmetric matrix with eigenvalues D (of
+    size n). The eigenvectors are the columns of a random Householder reflector. **/
+template <typename T, typename U, typename S>
+void device_init_spectrum(const std::vector<S>& D,
+                          U A,
+                          const int64_t lda,
+                          const rocblas_stride stA,
+                          const int64_t bc,
+                          hipStream_t stream,
+                          const uint64_t seed = device_init_seed)
+{
+    int64_t n = D.size();
+    if(n <= 0 || bc <= 0)
+        return;
+
+    // D and the (normalized) direction w of the reflector are the only host data, of size 2n
+    std::vector<S> Dw(2 * n);
+    double norm = 0, s = 0;
+    for(int64_t k = 0; k < n; ++k)
+    {
+        double w = device_init_uniform(seed, k);
+        Dw[k] = D[k];
+        Dw[n + k] = S(w);
+        norm += w * w;
+    }
+    norm = std::sqrt(norm);
+    for(int64_t k = 0; k < n; ++k)
+    {
+        Dw[n + k] = S(Dw[n + k] / norm);
+        s += double(D[k]) * Dw[n + k] * Dw[n + k];
+    }
+
+    S* dDw;
+    CHECK_HIP_ERROR(hipMalloc(&dDw, sizeof(S) * 2 * n));
+    CHECK_HIP_ERROR(
+        hipMemcpyAsync(dDw, Dw.data(), sizeof(S) * 2 * n, hipMemcpyHostToDevice, stream));
+
+    dim3 threads(32, 8, 1);
+    dim3 blocks((n - 1) / 32 + 1, (n - 1) / 8 + 1, bc);
+    hipLaunchKernelGGL((device_init_spectrum_kernel<T, U, S>), blocks, threads, 0, stream, n, dDw,
+                       S(s), A, lda, stA);
+    CHECK_HIP_ERROR(hipGetLastError());
+
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+    CHECK_HIP_ERROR(hipFree(dDw));
+}
+
+/** Sets the diagonals D (of size n) and off-diagonals E (of size n - 1) of the batch of
+    symmetric tridiagonal matrices to random values. **/
+template <typename S>
+void device_init_tridiagonal(const int64_t n,
+                             S* D,
+                             const rocblas_stride stD,
+                             S* E,
+                             const rocblas_stride stE,
+                             const int64_t bc,
+                             hipStream_t stream,
+                             const uint64_t seed = device_init_seed)
+{
+    // (D and E are drawn as the columns of general matrices with different seeds)
+    device_init_matrix<S>(device_init_general, n, 1, D, std::max(n, int64_t(1)), stD, bc, stream,
+                          seed);
+    device_init_matrix<S>(device_init_general, n - 1, 1, E, std::max(n, int64_t(1)), stE, bc,
+                          stream, ~seed);
+}
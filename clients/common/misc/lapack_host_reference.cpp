@@ -84,6 +84,84 @@ void zgecon_(char* norm,
              double* rwork,
              int* info);
 
+void spocon_(char* uplo,
+             int* n,
+             float* A,
+             int* lda,
+             float* anorm,
+             float* rcond,
+             float* work,
+             int* iwork,
+             int* info);
+void dpocon_(char* uplo,
+             int* n,
+             double* A,
+             int* lda,
+             double* anorm,
+             double* rcond,
+             double* work,
+             int* iwork,
+             int* info);
+void cpocon_(char* uplo,
+             int* n,
+             rocblas_float_complex* A,
+             int* lda,
+             float* anorm,
+             float* rcond,
+             rocblas_float_complex* work,
+             float* rwork,
+             int* info);
+void zpocon_(char* uplo,
+             int* n,
+             rocblas_double_complex* A,
+             int* lda,
+             double* anorm,
+             double* rcond,
+             rocblas_double_complex* work,
+             double* rwork,
+             int* info);
+
+void strcon_(char* norm,
+             char* uplo,
+             char* diag,
+             int* n,
+             float* A,
+             int* lda,
+             float* rcond,
+             float* work,
+             int* iwork,
+             int* info);
+void dtrcon_(char* norm,
+             char* uplo,
+             char* diag,
+             int* n,
+             double* A,
+             int* lda,
+             double* rcond,
+             double* work,
+             int* iwork,
+             int* info);
+void ctrcon_(char* norm,
+             char* uplo,
+             char* diag,
+             int* n,
+             rocblas_float_complex* A,
+             int* lda,
+             float* rcond,
+             rocblas_float_complex* work,
+             float* rwork,
+             int* info);
+void ztrcon_(char* norm,
+             char* uplo,
+             char* diag,
+             int* n,
+             rocblas_double_complex* A,
+             int* lda,
+             double* rcond,
+             rocblas_double_complex* work,
+             double* rwork,
+             int* info);
+
 void saxpy_(int* n, float* alpha, float* x, int* incx, float* y, int* incy);
 void daxpy_(int* n, double* alpha, double* x, int* incx, double* y, int* incy);
 void caxpy_(int* n,
@@ -485,6 +563,182 @@ void zgetrs_(char* trans,
              int* ldb,
              int* info);
 
+void sgbtrf_(int* m, int* n, int* kl, int* ku, float* AB, int* ldab, int* ipiv, int* info);
+void dgbtrf_(int* m, int* n, int* kl, int* ku, double* AB, int* ldab, int* ipiv, int* info);
+void cgbtrf_(int* m,
+             int* n,
+             int* kl,
+             int* ku,
+             rocblas_float_complex* AB,
+             int* ldab,
+             int* ipiv,
+             int* info);
+void zgbtrf_(int* m,
+             int* n,
+             int* kl,
+             int* ku,
+             rocblas_double_complex* AB,
+             int* ldab,
+             int* ipiv,
+             int* info);
+
+void sgbtrs_(char* trans,
+             int* n,
+             int* kl,
+             int* ku,
+             int* nrhs,
+             float* AB,
+             int* ldab,
+             int* ipiv,
+             float* B,
+             int* ldb,
+             int* info);
+void dgbtrs_(char* trans,
+             int* n,
+             int* kl,
+             int* ku,
+             int* nrhs,
+             double* AB,
+             int* ldab,
+             int* ipiv,
+             double* B,
+             int* ldb,
+             int* info);
+void cgbtrs_(char* trans,
+             int* n,
+             int* kl,
+             int* ku,
+             int* nrhs,
+             rocblas_float_complex* AB,
+             int* ldab,
+             int* ipiv,
+             rocblas_float_complex* B,
+             int* ldb,
+             int* info);
+void zgbtrs_(char* trans,
+             int* n,
+             int* kl,
+             int* ku,
+             int* nrhs,
+             rocblas_double_complex* AB,
+             int* ldab,
+             int* ipiv,
+             rocblas_double_complex* B,
+             int* ldb,
+             int* info);
+
+void spbtrf_(char* uplo, int* n, int* kd, float* AB, int* ldab, int* info);
+void dpbtrf_(char* uplo, int* n, int* kd, double* AB, int* ldab, int* info);
+void cpbtrf_(char* uplo, int* n, int* kd, rocblas_float_complex* AB, int* ldab, int* info);
+void zpbtrf_(char* uplo, int* n, int* kd, rocblas_double_complex* AB, int* ldab, int* info);
+
+void spbtrs_(char* uplo,
+             int* n,
+             int* kd,
+             int* nrhs,
+             float* AB,
+             int* ldab,
+             float* B,
+             int* ldb,
+             int* info);
+void dpbtrs_(char* uplo,
+             int* n,
+             int* kd,
+             int* nrhs,
+             double* AB,
+             int* ldab,
+             double* B,
+             int* ldb,
+             int* info);
+void cpbtrs_(char* uplo,
+             int* n,
+             int* kd,
+             int* nrhs,
+             rocblas_float_complex* AB,
+             int* ldab,
+             rocblas_float_complex* B,
+             int* ldb,
+             int* info);
+void zpbtrs_(char* uplo,
+             int* n,
+             int* kd,
+             int* nrhs,
+             rocblas_double_complex* AB,
+             int* ldab,
+             rocblas_double_complex* B,
+             int* ldb,
+             int* info);
+
+void strttf_(char* transr, char* uplo, int* n, float* A, int* lda, float* ARF, int* info);
+void dtrttf_(char* transr, char* uplo, int* n, double* A, int* lda, double* ARF, int* info);
+void ctrttf_(char* transr,
+             char* uplo,
+             int* n,
+             rocblas_float_complex* A,
+             int* lda,
+             rocblas_float_complex* ARF,
+             int* info);
+void ztrttf_(char* transr,
+             char* uplo,
+             int* n,
+             rocblas_double_complex* A,
+             int* lda,
+             rocblas_double_complex* ARF,
+             int* info);
+
+void stfttr_(char* transr, char* uplo, int* n, float* ARF, float* A, int* lda, int* info);
+void dtfttr_(char* transr, char* uplo, int* n, double* ARF, double* A, int* lda, int* info);
+void ctfttr_(char* transr,
+             char* uplo,
+             int* n,
+             rocblas_float_complex* ARF,
+             rocblas_float_complex* A,
+             int* lda,
+             int* info);
+void ztfttr_(char* transr,
+             char* uplo,
+             int* n,
+             rocblas_double_complex* ARF,
+             rocblas_double_complex* A,
+             int* lda,
+             int* info);
+
+void spftrf_(char* transr, char* uplo, int* n, float* A, int* info);
+void dpftrf_(char* transr, char* uplo, int* n, double* A, int* info);
+void cpftrf_(char* transr, char* uplo, int* n, rocblas_float_complex* A, int* info);
+void zpftrf_(char* transr, char* uplo, int* n, rocblas_double_complex* A, int* info);
+
+void spftrs_(char* transr, char* uplo, int* n, int* nrhs, float* A, float* B, int* ldb, int* info);
+void dpftrs_(char* transr,
+             char* uplo,
+             int* n,
+             int* nrhs,
+             double* A,
+             double* B,
+             int* ldb,
+             int* info);
+void cpftrs_(char* transr,
+             char* uplo,
+             int* n,
+             int* nrhs,
+             rocblas_float_complex* A,
+             rocblas_float_complex* B,
+             int* ldb,
+             int* info);
+void zpftrs_(char* transr,
+             char* uplo,
+             int* n,
+             int* nrhs,
+             rocblas_double_complex* A,
+             rocblas_double_complex* B,
+             int* ldb,
+             int* info);
+
+void spftri_(char* transr, char* uplo, int* n, float* A, int* info);
+void dpftri_(char* transr, char* uplo, int* n, double* A, int* info);
+void cpftri_(char* transr, char* uplo, int* n, rocblas_float_complex* A, int* info);
+void zpftri_(char* transr, char* uplo, int* n, rocblas_double_complex* A, int* info);
+
 void sgesv_(int* n, int* nrhs, float* A, int* lda, int* ipiv, float* B, int* ldb, int* info);
 void dgesv_(int* n, int* nrhs, double* A, int* lda, int* ipiv, double* B, int* ldb, int* info);
 void cgesv_(int* n,
@@ -549,67 +803,181 @@ void zgels_(char* trans,
             int* lwork,
             int* info);
 
-void sgetri_(int* n, float* A, int* lda, int* ipiv, float* work, int* lwork, int* info);
-void dgetri_(int* n, double* A, int* lda, int* ipiv, double* work, int* lwork, int* info);
-void cgetri_(int* n,
+void sgelsd_(int* m,
+             int* n,
+             int* nrhs,
+             float* A,
+             int* lda,
+             float* B,
+             int* ldb,
+             float* S,
+             float* rcond,
+             int* rank,
+             float* work,
+             int* lwork,
+             int* iwork,
+             int* info);
+void dgelsd_(int* m,
+             int* n,
+             int* nrhs,
+             double* A,
+             int* lda,
+             double* B,
+             int* ldb,
+             double* S,
+             double* rcond,
+             int* rank,
+             double* work,
+             int* lwork,
+             int* iwork,
+             int* info);
+void cgelsd_(int* m,
+             int* n,
+             int* nrhs,
              rocblas_float_complex* A,
              int* lda,
-             int* ipiv,
+             rocblas_float_complex* B,
+             int* ldb,
+             float* S,
+             float* rcond,
+             int* rank,
              rocblas_float_complex* work,
              int* lwork,
+             float* rwork,
+             int* iwork,
              int* info);
-void zgetri_(int* n,
+void zgelsd_(int* m,
+             int* n,
+             int* nrhs,
              rocblas_double_complex* A,
              int* lda,
-             int* ipiv,
+             rocblas_double_complex* B,
+             int* ldb,
+             double* S,
+             double* rcond,
+             int* rank,
              rocblas_double_complex* work,
              int* lwork,
+             double* rwork,
+             int* iwork,
              int* info);
 
-void strtri_(char* uplo, char* diag, int* n, float* A, int* lda, int* info);
-void dtrtri_(char* uplo, char* diag, int* n, double* A, int* lda, int* info);
-void ctrtri_(char* uplo, char* diag, int* n, rocblas_float_complex* A, int* lda, int* info);
-void ztrtri_(char* uplo, char* diag, int* n, rocblas_double_complex* A, int* lda, int* info);
-
-void slarfg_(int* n, float* alpha, float* x, int* incx, float* tau);
-void dlarfg_(int* n, double* alpha, double* x, int* incx, double* tau);
-void clarfg_(int* n,
-             rocblas_float_complex* alpha,
-             rocblas_float_complex* x,
-             int* incx,
-             rocblas_float_complex* tau);
-void zlarfg_(int* n,
-             rocblas_double_complex* alpha,
-             rocblas_double_complex* x,
-             int* incx,
-             rocblas_double_complex* tau);
-
-void slarf_(char* side, int* m, int* n, float* x, int* incx, float* alpha, float* A, int* lda, float* work);
-void dlarf_(char* side,
-            int* m,
-            int* n,
-            double* x,
-            int* incx,
-            double* alpha,
-            double* A,
-            int* lda,
-            double* work);
-void clarf_(char* side,
-            int* m,
-            int* n,
-            rocblas_float_complex* x,
-            int* incx,
-            rocblas_float_complex* alpha,
-            rocblas_float_complex* A,
-            int* lda,
-            rocblas_float_complex* work);
-void zlarf_(char* side,
-            int* m,
-            int* n,
-            rocblas_double_complex* x,
-            int* incx,
-            rocblas_double_complex* alpha,
-            rocblas_double_complex* A,
+void sgelsy_(int* m,
+             int* n,
+             int* nrhs,
+             float* A,
+             int* lda,
+             float* B,
+             int* ldb,
+             int* jpvt,
+             float* rcond,
+             int* rank,
+             float* work,
+             int* lwork,
+             int* info);
+void dgelsy_(int* m,
+             int* n,
+             int* nrhs,
+             double* A,
+             int* lda,
+             double* B,
+             int* ldb,
+             int* jpvt,
+             double* rcond,
+             int* rank,
+             double* work,
+             int* lwork,
+             int* info);
+void cgelsy_(int* m,
+             int* n,
+             int* nrhs,
+             rocblas_float_complex* A,
+             int* lda,
+             rocblas_float_complex* B,
+             int* ldb,
+             int* jpvt,
+             float* rcond,
+             int* rank,
+             rocblas_float_complex* work,
+             int* lwork,
+             float* rwork,
+             int* info);
+void zgelsy_(int* m,
+             int* n,
+             int* nrhs,
+             rocblas_double_complex* A,
+             int* lda,
+             rocblas_double_complex* B,
+             int* ldb,
+             int* jpvt,
+             double* rcond,
+             int* rank,
+             rocblas_double_complex* work,
+             int* lwork,
+             double* rwork,
+             int* info);
+
+void sgetri_(int* n, float* A, int* lda, int* ipiv, float* work, int* lwork, int* info);
+void dgetri_(int* n, double* A, int* lda, int* ipiv, double* work, int* lwork, int* info);
+void cgetri_(int* n,
+             rocblas_float_complex* A,
+             int* lda,
+             int* ipiv,
+             rocblas_float_complex* work,
+             int* lwork,
+             int* info);
+void zgetri_(int* n,
+             rocblas_double_complex* A,
+             int* lda,
+             int* ipiv,
+             rocblas_double_complex* work,
+             int* lwork,
+             int* info);
+
+void strtri_(char* uplo, char* diag, int* n, float* A, int* lda, int* info);
+void dtrtri_(char* uplo, char* diag, int* n, double* A, int* lda, int* info);
+void ctrtri_(char* uplo, char* diag, int* n, rocblas_float_complex* A, int* lda, int* info);
+void ztrtri_(char* uplo, char* diag, int* n, rocblas_double_complex* A, int* lda, int* info);
+
+void slarfg_(int* n, float* alpha, float* x, int* incx, float* tau);
+void dlarfg_(int* n, double* alpha, double* x, int* incx, double* tau);
+void clarfg_(int* n,
+             rocblas_float_complex* alpha,
+             rocblas_float_complex* x,
+             int* incx,
+             rocblas_float_complex* tau);
+void zlarfg_(int* n,
+             rocblas_double_complex* alpha,
+             rocblas_double_complex* x,
+             int* incx,
+             rocblas_double_complex* tau);
+
+void slarf_(char* side, int* m, int* n, float* x, int* incx, float* alpha, float* A, int* lda, float* work);
+void dlarf_(char* side,
+            int* m,
+            int* n,
+            double* x,
+            int* incx,
+            double* alpha,
+            double* A,
+            int* lda,
+            double* work);
+void clarf_(char* side,
+            int* m,
+            int* n,
+            rocblas_float_complex* x,
+            int* incx,
+            rocblas_float_complex* alpha,
+            rocblas_float_complex* A,
+            int* lda,
+            rocblas_float_complex* work);
+void zlarf_(char* side,
+            int* m,
+            int* n,
+            rocblas_double_complex* x,
+            int* incx,
+            rocblas_double_complex* alpha,
+            rocblas_double_complex* A,
             int* lda,
             rocblas_double_complex* work);
 
@@ -874,6 +1242,82 @@ void zgeqrf_(int* m,
              int* lwork,
              int* info);
 
+void sgeqp3_(int* m,
+             int* n,
+             float* A,
+             int* lda,
+             int* jpvt,
+             float* ipiv,
+             float* work,
+             int* lwork,
+             int* info);
+void dgeqp3_(int* m,
+             int* n,
+             double* A,
+             int* lda,
+             int* jpvt,
+             double* ipiv,
+             double* work,
+             int* lwork,
+             int* info);
+void cgeqp3_(int* m,
+             int* n,
+             rocblas_float_complex* A,
+             int* lda,
+             int* jpvt,
+             rocblas_float_complex* ipiv,
+             rocblas_float_complex* work,
+             int* lwork,
+             float* rwork,
+             int* info);
+void zgeqp3_(int* m,
+             int* n,
+             rocblas_double_complex* A,
+             int* lda,
+             int* jpvt,
+             rocblas_double_complex* ipiv,
+             rocblas_double_complex* work,
+             int* lwork,
+             double* rwork,
+             int* info);
+
+void sgeqrt_(int* m,
+             int* n,
+             int* nb,
+             float* A,
+             int* lda,
+             float* T,
+             int* ldt,
+             float* work,
+             int* info);
+void dgeqrt_(int* m,
+             int* n,
+             int* nb,
+             double* A,
+             int* lda,
+             double* T,
+             int* ldt,
+             double* work,
+             int* info);
+void cgeqrt_(int* m,
+             int* n,
+             int* nb,
+             rocblas_float_complex* A,
+             int* lda,
+             rocblas_float_complex* T,
+             int* ldt,
+             rocblas_float_complex* work,
+             int* info);
+void zgeqrt_(int* m,
+             int* n,
+             int* nb,
+             rocblas_double_complex* A,
+             int* lda,
+             rocblas_double_complex* T,
+             int* ldt,
+             rocblas_double_complex* work,
+             int* info);
+
 void sgerq2_(int* m, int* n, float* A, int* lda, float* ipiv, float* work, int* info);
 void dgerq2_(int* m, int* n, double* A, int* lda, double* ipiv, double* work, int* info);
 void cgerq2_(int* m,
@@ -1292,6 +1736,63 @@ void zunmqr_(char* side,
              int* sizeW,
              int* info);
 
+void sgemqrt_(char* side,
+              char* trans,
+              int* m,
+              int* n,
+              int* k,
+              int* nb,
+              float* V,
+              int* ldv,
+              float* T,
+              int* ldt,
+              float* C,
+              int* ldc,
+              float* work,
+              int* info);
+void dgemqrt_(char* side,
+              char* trans,
+              int* m,
+              int* n,
+              int* k,
+              int* nb,
+              double* V,
+              int* ldv,
+              double* T,
+              int* ldt,
+              double* C,
+              int* ldc,
+              double* work,
+              int* info);
+void cgemqrt_(char* side,
+              char* trans,
+              int* m,
+              int* n,
+              int* k,
+              int* nb,
+              rocblas_float_complex* V,
+              int* ldv,
+              rocblas_float_complex* T,
+              int* ldt,
+              rocblas_float_complex* C,
+              int* ldc,
+              rocblas_float_complex* work,
+              int* info);
+void zgemqrt_(char* side,
+              char* trans,
+              int* m,
+              int* n,
+              int* k,
+              int* nb,
+              rocblas_double_complex* V,
+              int* ldv,
+              rocblas_double_complex* T,
+              int* ldt,
+              rocblas_double_complex* C,
+              int* ldc,
+              rocblas_double_complex* work,
+              int* info);
+
 void sorml2_(char* side,
              char* trans,
              int* m,
@@ -1692,6 +2193,62 @@ void zgebrd_(int* m,
              int* size_w,
              int* info);
 
+void sgehd2_(int* n, int* ilo, int* ihi, float* A, int* lda, float* tau, float* work, int* info);
+void dgehd2_(int* n, int* ilo, int* ihi, double* A, int* lda, double* tau, double* work, int* info);
+void cgehd2_(int* n,
+             int* ilo,
+             int* ihi,
+             rocblas_float_complex* A,
+             int* lda,
+             rocblas_float_complex* tau,
+             rocblas_float_complex* work,
+             int* info);
+void zgehd2_(int* n,
+             int* ilo,
+             int* ihi,
+             rocblas_double_complex* A,
+             int* lda,
+             rocblas_double_complex* tau,
+             rocblas_double_complex* work,
+             int* info);
+
+void sgehrd_(int* n,
+             int* ilo,
+             int* ihi,
+             float* A,
+             int* lda,
+             float* tau,
+             float* work,
+             int* size_w,
+             int* info);
+void dgehrd_(int* n,
+             int* ilo,
+             int* ihi,
+             double* A,
+             int* lda,
+             double* tau,
+             double* work,
+             int* size_w,
+             int* info);
+void cgehrd_(int* n,
+             int* ilo,
+             int* ihi,
+             rocblas_float_complex* A,
+             int* lda,
+             rocblas_float_complex* tau,
+             rocblas_float_complex* work,
+             int* size_w,
+             int* info);
+void zgehrd_(int* n,
+             int* ilo,
+             int* ihi,
+             rocblas_double_complex* A,
+             int* lda,
+             rocblas_double_complex* tau,
+             rocblas_double_complex* work,
+             int* size_w,
+             int* info);
+
 void ssytrd_(char* uplo,
              int* n,
              float* A,
@@ -2540,33 +3097,115 @@ void zsytrf_(char* uplo,
              int* lwork,
              int* info);
 
-void sbdsvdx_(char* uplo,
-              char* svect,
-              char* srange,
-              int* n,
-              float* D,
-              float* E,
-              float* vl,
-              float* vu,
-              int* il,
-              int* iu,
-              int* nsv,
-              float* S,
-              float* Z,
-              int* ldz,
-              float* work,
-              int* iwork,
-              int* info);
-void dbdsvdx_(char* uplo,
-              char* svect,
-              char* srange,
-              int* n,
-              double* D,
-              double* E,
-              double* vl,
-              double* vu,
-              int* il,
-              int* iu,
+void ssytrs_(char* uplo,
+             int* n,
+             int* nrhs,
+             float* A,
+             int* lda,
+             int* ipiv,
+             float* B,
+             int* ldb,
+             int* info);
+void dsytrs_(char* uplo,
+             int* n,
+             int* nrhs,
+             double* A,
+             int* lda,
+             int* ipiv,
+             double* B,
+             int* ldb,
+             int* info);
+void csytrs_(char* uplo,
+             int* n,
+             int* nrhs,
+             rocblas_float_complex* A,
+             int* lda,
+             int* ipiv,
+             rocblas_float_complex* B,
+             int* ldb,
+             int* info);
+void zsytrs_(char* uplo,
+             int* n,
+             int* nrhs,
+             rocblas_double_complex* A,
+             int* lda,
+             int* ipiv,
+             rocblas_double_complex* B,
+             int* ldb,
+             int* info);
+
+void ssysv_(char* uplo,
+            int* n,
+            int* nrhs,
+            float* A,
+            int* lda,
+            int* ipiv,
+            float* B,
+            int* ldb,
+            float* work,
+            int* lwork,
+            int* info);
+void dsysv_(char* uplo,
+            int* n,
+            int* nrhs,
+            double* A,
+            int* lda,
+            int* ipiv,
+            double* B,
+            int* ldb,
+            double* work,
+            int* lwork,
+            int* info);
+void csysv_(char* uplo,
+            int* n,
+            int* nrhs,
+            rocblas_float_complex* A,
+            int* lda,
+            int* ipiv,
+            rocblas_float_complex* B,
+            int* ldb,
+            rocblas_float_complex* work,
+            int* lwork,
+            int* info);
+void zsysv_(char* uplo,
+            int* n,
+            int* nrhs,
+            rocblas_double_complex* A,
+            int* lda,
+            int* ipiv,
+            rocblas_double_complex* B,
+            int* ldb,
+            rocblas_double_complex* work,
+            int* lwork,
+            int* info);
+
+void sbdsvdx_(char* uplo,
+              char* svect,
+              char* srange,
+              int* n,
+              float* D,
+              float* E,
+              float* vl,
+              float* vu,
+              int* il,
+              int* iu,
+              int* nsv,
+              float* S,
+              float* Z,
+              int* ldz,
+              float* work,
+              int* iwork,
+              int* info);
+void dbdsvdx_(char* uplo,
+              char* svect,
+              char* srange,
+              int* n,
+              double* D,
+              double* E,
+              double* vl,
+              double* vu,
+              int* il,
+              int* iu,
               int* nsv,
               double* S,
               double* Z,
@@ -2695,6 +3334,154 @@ double cpu_gecon<rocblas_double_complex, double>(char norm,
     return rcond;
 }
 
+// pocon
+
+template <>
+float cpu_pocon<float, float>(rocblas_fill uplo,
+                              rocblas_int n,
+                              float* A,
+                              rocblas_int lda,
+                              float anorm,
+                              float* work,
+                              float* rwork,
+                              rocblas_int* iwork)
+{
+    float rcond;
+    rocblas_int info;
+    char uploC = rocblas2char_fill(uplo);
+    spocon_(&uploC, &n, A, &lda, &anorm, &rcond, work, iwork, &info);
+    return rcond;
+}
+
+template <>
+double cpu_pocon<double, double>(rocblas_fill uplo,
+                                 rocblas_int n,
+                                 double* A,
+                                 rocblas_int lda,
+                                 double anorm,
+                                 double* work,
+                                 double* rwork,
+                                 rocblas_int* iwork)
+{
+    double rcond;
+    rocblas_int info;
+    char uploC = rocblas2char_fill(uplo);
+    dpocon_(&uploC, &n, A, &lda, &anorm, &rcond, work, iwork, &info);
+    return rcond;
+}
+
+template <>
+float cpu_pocon<rocblas_float_complex, float>(rocblas_fill uplo,
+                                              rocblas_int n,
+                                              rocblas_float_complex* A,
+                                              rocblas_int lda,
+                                              float anorm,
+                                              rocblas_float_complex* work,
+                                              float* rwork,
+                                              rocblas_int* iwork)
+{
+    float rcond;
+    rocblas_int info;
+    char uploC = rocblas2char_fill(uplo);
+    cpocon_(&uploC, &n, A, &lda, &anorm, &rcond, work, rwork, &info);
+    return rcond;
+}
+
+template <>
+double cpu_pocon<rocblas_double_complex, double>(rocblas_fill uplo,
+                                                 rocblas_int n,
+                                                 rocblas_double_complex* A,
+                                                 rocblas_int lda,
+                                                 double anorm,
+                                                 rocblas_double_complex* work,
+                                                 double* rwork,
+                                                 rocblas_int* iwork)
+{
+    double rcond;
+    rocblas_int info;
+    char uploC = rocblas2char_fill(uplo);
+    zpocon_(&uploC, &n, A, &lda, &anorm, &rcond, work, rwork, &info);
+    return rcond;
+}
+
+// trcon
+
+template <>
+float cpu_trcon<float, float>(char norm,
+                              rocblas_fill uplo,
+                              rocblas_diagonal diag,
+                              rocblas_int n,
+                              float* A,
+                              rocblas_int lda,
+                              float* work,
+                              float* rwork,
+                              rocblas_int* iwork)
+{
+    float rcond;
+    rocblas_int info;
+    char uploC = rocblas2char_fill(uplo);
+    char diagC = rocblas2char_diagonal(diag);
+    strcon_(&norm, &uploC, &diagC, &n, A, &lda, &rcond, work, iwork, &info);
+    return rcond;
+}
+
+template <>
+double cpu_trcon<double, double>(char norm,
+                                 rocblas_fill uplo,
+                                 rocblas_diagonal diag,
+                                 rocblas_int n,
+                                 double* A,
+                                 rocblas_int lda,
+                                 double* work,
+                                 double* rwork,
+                                 rocblas_int* iwork)
+{
+    double rcond;
+    rocblas_int info;
+    char uploC = rocblas2char_fill(uplo);
+    char diagC = rocblas2char_diagonal(diag);
+    dtrcon_(&norm, &uploC, &diagC, &n, A, &lda, &rcond, work, iwork, &info);
+    return rcond;
+}
+
+template <>
+float cpu_trcon<rocblas_float_complex, float>(char norm,
+                                              rocblas_fill uplo,
+                                              rocblas_diagonal diag,
+                                              rocblas_int n,
+                                              rocblas_float_complex* A,
+                                              rocblas_int lda,
+                                              rocblas_float_complex* work,
+                                              float* rwork,
+                                              rocblas_int* iwork)
+{
+    float rcond;
+    rocblas_int info;
+    char uploC = rocblas2char_fill(uplo);
+    char diagC = rocblas2char_diagonal(diag);
+    ctrcon_(&norm, &uploC, &diagC, &n, A, &lda, &rcond, work, rwork, &info);
+    return rcond;
+}
+
+template <>
+double cpu_trcon<rocblas_double_complex, double>(char norm,
+                                                 rocblas_fill uplo,
+                                                 rocblas_diagonal diag,
+                                                 rocblas_int n,
+                                                 rocblas_double_complex* A,
+                                                 rocblas_int lda,
+                                                 rocblas_double_complex* work,
+                                                 double* rwork,
+                                                 rocblas_int* iwork)
+{
+    double rcond;
+    rocblas_int info;
+    char uploC = rocblas2char_fill(uplo);
+    char diagC = rocblas2char_diagonal(diag);
+    ztrcon_(&norm, &uploC, &diagC, &n, A, &lda, &rcond, work, rwork, &info);
+    return rcond;
+}
+
 // axpy
 
 template <>
@@ -4101,39 +4888,128 @@ void cpu_ormqr_unmqr<rocblas_double_complex>(rocblas_side side,
     zunmqr_(&sideC, &transC, &m, &n, &k, A, &lda, ipiv, C, &ldc, work, &lwork, &info);
 }
 
-// orm2r & unm2r
+// gemqrt
 template <>
-void cpu_orm2r_unm2r<float>(rocblas_side side,
-                            rocblas_operation trans,
-                            rocblas_int m,
-                            rocblas_int n,
-                            rocblas_int k,
-                            float* A,
-                            rocblas_int lda,
-                            float* ipiv,
-                            float* C,
-                            rocblas_int ldc,
-                            float* work)
+void cpu_gemqrt<float>(rocblas_side side,
+                       rocblas_operation trans,
+                       rocblas_int m,
+                       rocblas_int n,
+                       rocblas_int k,
+                       rocblas_int nb,
+                       float* V,
+                       rocblas_int ldv,
+                       float* Tf,
+                       rocblas_int ldt,
+                       float* C,
+                       rocblas_int ldc,
+                       float* work)
 {
     int info;
     char sideC = rocblas2char_side(side);
     char transC = rocblas2char_operation(trans);
 
-    sorm2r_(&sideC, &transC, &m, &n, &k, A, &lda, ipiv, C, &ldc, work, &info);
+    sgemqrt_(&sideC, &transC, &m, &n, &k, &nb, V, &ldv, Tf, &ldt, C, &ldc, work, &info);
 }
 
 template <>
-void cpu_orm2r_unm2r<double>(rocblas_side side,
-                             rocblas_operation trans,
-                             rocblas_int m,
-                             rocblas_int n,
-                             rocblas_int k,
-                             double* A,
-                             rocblas_int lda,
-                             double* ipiv,
-                             double* C,
-                             rocblas_int ldc,
-                             double* work)
+void cpu_gemqrt<double>(rocblas_side side,
+                        rocblas_operation trans,
+                        rocblas_int m,
+                        rocblas_int n,
+                        rocblas_int k,
+                        rocblas_int nb,
+                        double* V,
+                        rocblas_int ldv,
+                        double* Tf,
+                        rocblas_int ldt,
+                        double* C,
+                        rocblas_int ldc,
+                        double* work)
+{
+    int info;
+    char sideC = rocblas2char_side(side);
+    char transC = rocblas2char_operation(trans);
+
+    dgemqrt_(&sideC, &transC, &m, &n, &k, &nb, V, &ldv, Tf, &ldt, C, &ldc, work, &info);
+}
+
+template <>
+void cpu_gemqrt<rocblas_float_complex>(rocblas_side side,
+                                       rocblas_operation trans,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       rocblas_int k,
+                                       rocblas_int nb,
+                                       rocblas_float_complex* V,
+                                       rocblas_int ldv,
+                                       rocblas_float_complex* Tf,
+                                       rocblas_int ldt,
+                                       rocblas_float_complex* C,
+                                       rocblas_int ldc,
+                                       rocblas_float_complex* work)
+{
+    int info;
+    char sideC = rocblas2char_side(side);
+    char transC = rocblas2char_operation(trans);
+
+    cgemqrt_(&sideC, &transC, &m, &n, &k, &nb, V, &ldv, Tf, &ldt, C, &ldc, work, &info);
+}
+
+template <>
+void cpu_gemqrt<rocblas_double_complex>(rocblas_side side,
+                                        rocblas_operation trans,
+                                        rocblas_int m,
+                                        rocblas_int n,
+                                        rocblas_int k,
+                                        rocblas_int nb,
+                                        rocblas_double_complex* V,
+                                        rocblas_int ldv,
+                                        rocblas_double_complex* Tf,
+                                        rocblas_int ldt,
+                                        rocblas_double_complex* C,
+                                        rocblas_int ldc,
+                                        rocblas_double_complex* work)
+{
+    int info;
+    char sideC = rocblas2char_side(side);
+    char transC = rocblas2char_operation(trans);
+
+    zgemqrt_(&sideC, &transC, &m, &n, &k, &nb, V, &ldv, Tf, &ldt, C, &ldc, work, &info);
+}
+
+// orm2r & unm2r
+template <>
+void cpu_orm2r_unm2r<float>(rocblas_side side,
+                            rocblas_operation trans,
+                            rocblas_int m,
+                            rocblas_int n,
+                            rocblas_int k,
+                            float* A,
+                            rocblas_int lda,
+                            float* ipiv,
+                            float* C,
+                            rocblas_int ldc,
+                            float* work)
+{
+    int info;
+    char sideC = rocblas2char_side(side);
+    char transC = rocblas2char_operation(trans);
+
+    sorm2r_(&sideC, &transC, &m, &n, &k, A, &lda, ipiv, C, &ldc, work, &info);
+}
+
+template <>
+void cpu_orm2r_unm2r<double>(rocblas_side side,
+                             rocblas_operation trans,
+                             rocblas_int m,
+                             rocblas_int n,
+                             rocblas_int k,
+                             double* A,
+                             rocblas_int lda,
+                             double* ipiv,
+                             double* C,
+                             rocblas_int ldc,
+                             double* work)
 {
     int info;
     char sideC = rocblas2char_side(side);
@@ -5602,281 +6478,1062 @@ void cpu_getrs<rocblas_double_complex>(rocblas_operation trans,
     zgetrs_(&transC, &n, &nrhs, A, &lda, ipiv, B, &ldb, &info);
 }
 
-// gesv
+// gbtrf
 template <>
-void cpu_gesv<float>(rocblas_int n,
-                     rocblas_int nrhs,
-                     float* A,
-                     rocblas_int lda,
-                     rocblas_int* ipiv,
-                     float* B,
-                     rocblas_int ldb,
-                     rocblas_int* info)
+void cpu_gbtrf(rocblas_int m,
+               rocblas_int n,
+               rocblas_int kl,
+               rocblas_int ku,
+               float* AB,
+               rocblas_int ldab,
+               rocblas_int* ipiv,
+               rocblas_int* info)
 {
-    sgesv_(&n, &nrhs, A, &lda, ipiv, B, &ldb, info);
+    sgbtrf_(&m, &n, &kl, &ku, AB, &ldab, ipiv, info);
 }
 
 template <>
-void cpu_gesv<double>(rocblas_int n,
-                      rocblas_int nrhs,
-                      double* A,
-                      rocblas_int lda,
-                      rocblas_int* ipiv,
-                      double* B,
-                      rocblas_int ldb,
-                      rocblas_int* info)
+void cpu_gbtrf(rocblas_int m,
+               rocblas_int n,
+               rocblas_int kl,
+               rocblas_int ku,
+               double* AB,
+               rocblas_int ldab,
+               rocblas_int* ipiv,
+               rocblas_int* info)
 {
-    dgesv_(&n, &nrhs, A, &lda, ipiv, B, &ldb, info);
+    dgbtrf_(&m, &n, &kl, &ku, AB, &ldab, ipiv, info);
 }
 
 template <>
-void cpu_gesv<rocblas_float_complex>(rocblas_int n,
-                                     rocblas_int nrhs,
-                                     rocblas_float_complex* A,
-                                     rocblas_int lda,
-                                     rocblas_int* ipiv,
-                                     rocblas_float_complex* B,
-                                     rocblas_int ldb,
-                                     rocblas_int* info)
+void cpu_gbtrf(rocblas_int m,
+               rocblas_int n,
+               rocblas_int kl,
+               rocblas_int ku,
+               rocblas_float_complex* AB,
+               rocblas_int ldab,
+               rocblas_int* ipiv,
+               rocblas_int* info)
 {
-    cgesv_(&n, &nrhs, A, &lda, ipiv, B, &ldb, info);
+    cgbtrf_(&m, &n, &kl, &ku, AB, &ldab, ipiv, info);
 }
 
 template <>
-void cpu_gesv<rocblas_double_complex>(rocblas_int n,
-                                      rocblas_int nrhs,
-                                      rocblas_double_complex* A,
-                                      rocblas_int lda,
-                                      rocblas_int* ipiv,
-                                      rocblas_double_complex* B,
-                                      rocblas_int ldb,
-                                      rocblas_int* info)
+void cpu_gbtrf(rocblas_int m,
+               rocblas_int n,
+               rocblas_int kl,
+               rocblas_int ku,
+               rocblas_double_complex* AB,
+               rocblas_int ldab,
+               rocblas_int* ipiv,
+               rocblas_int* info)
 {
-    zgesv_(&n, &nrhs, A, &lda, ipiv, B, &ldb, info);
+    zgbtrf_(&m, &n, &kl, &ku, AB, &ldab, ipiv, info);
 }
 
-// gels
+// gbtrs
 template <>
-void cpu_gels<float>(rocblas_operation transR,
-                     rocblas_int m,
-                     rocblas_int n,
-                     rocblas_int nrhs,
-                     float* A,
-                     rocblas_int lda,
-                     float* B,
-                     rocblas_int ldb,
-                     float* work,
-                     rocblas_int lwork,
-                     rocblas_int* info)
+void cpu_gbtrs(rocblas_operation trans,
+               rocblas_int n,
+               rocblas_int kl,
+               rocblas_int ku,
+               rocblas_int nrhs,
+               float* AB,
+               rocblas_int ldab,
+               rocblas_int* ipiv,
+               float* B,
+               rocblas_int ldb)
 {
-    char trans = rocblas2char_operation(transR);
-    sgels_(&trans, &m, &n, &nrhs, A, &lda, B, &ldb, work, &lwork, info);
+    int info;
+    char transC = rocblas2char_operation(trans);
+    sgbtrs_(&transC, &n, &kl, &ku, &nrhs, AB, &ldab, ipiv, B, &ldb, &info);
 }
 
 template <>
-void cpu_gels<double>(rocblas_operation transR,
-                      rocblas_int m,
-                      rocblas_int n,
-                      rocblas_int nrhs,
-                      double* A,
-                      rocblas_int lda,
-                      double* B,
-                      rocblas_int ldb,
-                      double* work,
-                      rocblas_int lwork,
-                      rocblas_int* info)
+void cpu_gbtrs(rocblas_operation trans,
+               rocblas_int n,
+               rocblas_int kl,
+               rocblas_int ku,
+               rocblas_int nrhs,
+               double* AB,
+               rocblas_int ldab,
+               rocblas_int* ipiv,
+               double* B,
+               rocblas_int ldb)
 {
-    char trans = rocblas2char_operation(transR);
-    dgels_(&trans, &m, &n, &nrhs, A, &lda, B, &ldb, work, &lwork, info);
+    int info;
+    char transC = rocblas2char_operation(trans);
+    dgbtrs_(&transC, &n, &kl, &ku, &nrhs, AB, &ldab, ipiv, B, &ldb, &info);
 }
 
 template <>
-void cpu_gels<rocblas_float_complex>(rocblas_operation transR,
-                                     rocblas_int m,
-                                     rocblas_int n,
-                                     rocblas_int nrhs,
-                                     rocblas_float_complex* A,
-                                     rocblas_int lda,
-                                     rocblas_float_complex* B,
-                                     rocblas_int ldb,
-                                     rocblas_float_complex* work,
-                                     rocblas_int lwork,
-                                     rocblas_int* info)
+void cpu_gbtrs(rocblas_operation trans,
+               rocblas_int n,
+               rocblas_int kl,
+               rocblas_int ku,
+               rocblas_int nrhs,
+               rocblas_float_complex* AB,
+               rocblas_int ldab,
+               rocblas_int* ipiv,
+               rocblas_float_complex* B,
+               rocblas_int ldb)
 {
-    char trans = rocblas2char_operation(transR);
-    cgels_(&trans, &m, &n, &nrhs, A, &lda, B, &ldb, work, &lwork, info);
+    int info;
+    char transC = rocblas2char_operation(trans);
+    cgbtrs_(&transC, &n, &kl, &ku, &nrhs, AB, &ldab, ipiv, B, &ldb, &info);
 }
 
 template <>
-void cpu_gels<rocblas_double_complex>(rocblas_operation transR,
-                                      rocblas_int m,
-                                      rocblas_int n,
-                                      rocblas_int nrhs,
-                                      rocblas_double_complex* A,
-                                      rocblas_int lda,
-                                      rocblas_double_complex* B,
-                                      rocblas_int ldb,
-                                      rocblas_double_complex* work,
-                                      rocblas_int lwork,
-                                      rocblas_int* info)
+void cpu_gbtrs(rocblas_operation trans,
+               rocblas_int n,
+               rocblas_int kl,
+               rocblas_int ku,
+               rocblas_int nrhs,
+               rocblas_double_complex* AB,
+               rocblas_int ldab,
+               rocblas_int* ipiv,
+               rocblas_double_complex* B,
+               rocblas_int ldb)
 {
-    char trans = rocblas2char_operation(transR);
-    zgels_(&trans, &m, &n, &nrhs, A, &lda, B, &ldb, work, &lwork, info);
+    int info;
+    char transC = rocblas2char_operation(trans);
+    zgbtrs_(&transC, &n, &kl, &ku, &nrhs, AB, &ldab, ipiv, B, &ldb, &info);
 }
 
-// trtri
+// pbtrf
 template <>
-void cpu_trtri<float>(rocblas_fill uplo,
-                      rocblas_diagonal diag,
-                      rocblas_int n,
-                      float* A,
-                      rocblas_int lda,
-                      rocblas_int* info)
+void cpu_pbtrf(rocblas_fill uplo,
+               rocblas_int n,
+               rocblas_int kd,
+               float* AB,
+               rocblas_int ldab,
+               rocblas_int* info)
 {
     char uploC = rocblas2char_fill(uplo);
-    char diagC = rocblas2char_diagonal(diag);
-    strtri_(&uploC, &diagC, &n, A, &lda, info);
+    spbtrf_(&uploC, &n, &kd, AB, &ldab, info);
 }
 
 template <>
-void cpu_trtri<double>(rocblas_fill uplo,
-                       rocblas_diagonal diag,
-                       rocblas_int n,
-                       double* A,
-                       rocblas_int lda,
-                       rocblas_int* info)
+void cpu_pbtrf(rocblas_fill uplo,
+               rocblas_int n,
+               rocblas_int kd,
+               double* AB,
+               rocblas_int ldab,
+               rocblas_int* info)
 {
     char uploC = rocblas2char_fill(uplo);
-    char diagC = rocblas2char_diagonal(diag);
-    dtrtri_(&uploC, &diagC, &n, A, &lda, info);
+    dpbtrf_(&uploC, &n, &kd, AB, &ldab, info);
 }
 
 template <>
-void cpu_trtri<rocblas_float_complex>(rocblas_fill uplo,
-                                      rocblas_diagonal diag,
-                                      rocblas_int n,
-                                      rocblas_float_complex* A,
-                                      rocblas_int lda,
-                                      rocblas_int* info)
+void cpu_pbtrf(rocblas_fill uplo,
+               rocblas_int n,
+               rocblas_int kd,
+               rocblas_float_complex* AB,
+               rocblas_int ldab,
+               rocblas_int* info)
 {
     char uploC = rocblas2char_fill(uplo);
-    char diagC = rocblas2char_diagonal(diag);
-    ctrtri_(&uploC, &diagC, &n, A, &lda, info);
+    cpbtrf_(&uploC, &n, &kd, AB, &ldab, info);
 }
 
 template <>
-void cpu_trtri<rocblas_double_complex>(rocblas_fill uplo,
-                                       rocblas_diagonal diag,
-                                       rocblas_int n,
-                                       rocblas_double_complex* A,
-                                       rocblas_int lda,
-                                       rocblas_int* info)
+void cpu_pbtrf(rocblas_fill uplo,
+               rocblas_int n,
+               rocblas_int kd,
+               rocblas_double_complex* AB,
+               rocblas_int ldab,
+               rocblas_int* info)
 {
     char uploC = rocblas2char_fill(uplo);
-    char diagC = rocblas2char_diagonal(diag);
-    ztrtri_(&uploC, &diagC, &n, A, &lda, info);
+    zpbtrf_(&uploC, &n, &kd, AB, &ldab, info);
 }
 
-// getri
+// pbtrs
 template <>
-void cpu_getri<float>(rocblas_int n,
-                      float* A,
-                      rocblas_int lda,
-                      rocblas_int* ipiv,
-                      float* work,
-                      rocblas_int lwork,
-                      rocblas_int* info)
+void cpu_pbtrs(rocblas_fill uplo,
+               rocblas_int n,
+               rocblas_int kd,
+               rocblas_int nrhs,
+               float* AB,
+               rocblas_int ldab,
+               float* B,
+               rocblas_int ldb)
+{
+    int info;
+    char uploC = rocblas2char_fill(uplo);
+    spbtrs_(&uploC, &n, &kd, &nrhs, AB, &ldab, B, &ldb, &info);
+}
+
+template <>
+void cpu_pbtrs(rocblas_fill uplo,
+               rocblas_int n,
+               rocblas_int kd,
+               rocblas_int nrhs,
+               double* AB,
+               rocblas_int ldab,
+               double* B,
+               rocblas_int ldb)
+{
+    int info;
+    char uploC = rocblas2char_fill(uplo);
+    dpbtrs_(&uploC, &n, &kd, &nrhs, AB, &ldab, B, &ldb, &info);
+}
+
+template <>
+void cpu_pbtrs(rocblas_fill uplo,
+               rocblas_int n,
+               rocblas_int kd,
+               rocblas_int nrhs,
+               rocblas_float_complex* AB,
+               rocblas_int ldab,
+               rocblas_float_complex* B,
+               rocblas_int ldb)
+{
+    int info;
+    char uploC = rocblas2char_fill(uplo);
+    cpbtrs_(&uploC, &n, &kd, &nrhs, AB, &ldab, B, &ldb, &info);
+}
+
+template <>
+void cpu_pbtrs(rocblas_fill uplo,
+               rocblas_int n,
+               rocblas_int kd,
+               rocblas_int nrhs,
+               rocblas_double_complex* AB,
+               rocblas_int ldab,
+               rocblas_double_complex* B,
+               rocblas_int ldb)
+{
+    int info;
+    char uploC = rocblas2char_fill(uplo);
+    zpbtrs_(&uploC, &n, &kd, &nrhs, AB, &ldab, B, &ldb, &info);
+}
+
+// trttf
+template <>
+void cpu_trttf(rocblas_operation transr,
+               rocblas_fill uplo,
+               rocblas_int n,
+               float* A,
+               rocblas_int lda,
+               float* ARF)
+{
+    int info;
+    char transrC = rocblas2char_operation(transr);
+    char uploC = rocblas2char_fill(uplo);
+    strttf_(&transrC, &uploC, &n, A, &lda, ARF, &info);
+}
+
+template <>
+void cpu_trttf(rocblas_operation transr,
+               rocblas_fill uplo,
+               rocblas_int n,
+               double* A,
+               rocblas_int lda,
+               double* ARF)
+{
+    int info;
+    char transrC = rocblas2char_operation(transr);
+    char uploC = rocblas2char_fill(uplo);
+    dtrttf_(&transrC, &uploC, &n, A, &lda, ARF, &info);
+}
+
+template <>
+void cpu_trttf(rocblas_operation transr,
+               rocblas_fill uplo,
+               rocblas_int n,
+               rocblas_float_complex* A,
+               rocblas_int lda,
+               rocblas_float_complex* ARF)
+{
+    int info;
+    char transrC = rocblas2char_operation(transr);
+    char uploC = rocblas2char_fill(uplo);
+    ctrttf_(&transrC, &uploC, &n, A, &lda, ARF, &info);
+}
+
+template <>
+void cpu_trttf(rocblas_operation transr,
+               rocblas_fill uplo,
+               rocblas_int n,
+               rocblas_double_complex* A,
+               rocblas_int lda,
+               rocblas_double_complex* ARF)
+{
+    int info;
+    char transrC = rocblas2char_operation(transr);
+    char uploC = rocblas2char_fill(uplo);
+    ztrttf_(&transrC, &uploC, &n, A, &lda, ARF, &info);
+}
+
+// tfttr
+template <>
+void cpu_tfttr(rocblas_operation transr,
+               rocblas_fill uplo,
+               rocblas_int n,
+               float* ARF,
+               float* A,
+               rocblas_int lda)
+{
+    int info;
+    char transrC = rocblas2char_operation(transr);
+    char uploC = rocblas2char_fill(uplo);
+    stfttr_(&transrC, &uploC, &n, ARF, A, &lda, &info);
+}
+
+template <>
+void cpu_tfttr(rocblas_operation transr,
+               rocblas_fill uplo,
+               rocblas_int n,
+               double* ARF,
+               double* A,
+               rocblas_int lda)
+{
+    int info;
+    char transrC = rocblas2char_operation(transr);
+    char uploC = rocblas2char_fill(uplo);
+    dtfttr_(&transrC, &uploC, &n, ARF, A, &lda, &info);
+}
+
+template <>
+void cpu_tfttr(rocblas_operation transr,
+               rocblas_fill uplo,
+               rocblas_int n,
+               rocblas_float_complex* ARF,
+               rocblas_float_complex* A,
+               rocblas_int lda)
+{
+    int info;
+    char transrC = rocblas2char_operation(transr);
+    char uploC = rocblas2char_fill(uplo);
+    ctfttr_(&transrC, &uploC, &n, ARF, A, &lda, &info);
+}
+
+template <>
+void cpu_tfttr(rocblas_operation transr,
+               rocblas_fill uplo,
+               rocblas_int n,
+               rocblas_double_complex* ARF,
+               rocblas_double_complex* A,
+               rocblas_int lda)
+{
+    int info;
+    char transrC = rocblas2char_operation(transr);
+    char uploC = rocblas2char_fill(uplo);
+    ztfttr_(&transrC, &uploC, &n, ARF, A, &lda, &info);
+}
+
+// pftrf
+template <>
+void cpu_pftrf(rocblas_operation transr,
+               rocblas_fill uplo,
+               rocblas_int n,
+               float* A,
+               rocblas_int* info)
+{
+    char transrC = rocblas2char_operation(transr);
+    char uploC = rocblas2char_fill(uplo);
+    spftrf_(&transrC, &uploC, &n, A, info);
+}
+
+template <>
+void cpu_pftrf(rocblas_operation transr,
+               rocblas_fill uplo,
+               rocblas_int n,
+               double* A,
+               rocblas_int* info)
+{
+    char transrC = rocblas2char_operation(transr);
+    char uploC = rocblas2char_fill(uplo);
+    dpftrf_(&transrC, &uploC, &n, A, info);
+}
+
+template <>
+void cpu_pftrf(rocblas_operation transr,
+               rocblas_fill uplo,
+               rocblas_int n,
+               rocblas_float_complex* A,
+               rocblas_int* info)
+{
+    char transrC = rocblas2char_operation(transr);
+    char uploC = rocblas2char_fill(uplo);
+    cpftrf_(&transrC, &uploC, &n, A, info);
+}
+
+template <>
+void cpu_pftrf(rocblas_operation transr,
+               rocblas_fill uplo,
+               rocblas_int n,
+               rocblas_double_complex* A,
+               rocblas_int* info)
+{
+    char transrC = rocblas2char_operation(transr);
+    char uploC = rocblas2char_fill(uplo);
+    zpftrf_(&transrC, &uploC, &n, A, info);
+}
+
+// pftrs
+template <>
+void cpu_pftrs(rocblas_operation transr,
+               rocblas_fill uplo,
+               rocblas_int n,
+               rocblas_int nrhs,
+               float* A,
+               float* B,
+               rocblas_int ldb)
+{
+    int info;
+    char transrC = rocblas2char_operation(transr);
+    char uploC = rocblas2char_fill(uplo);
+    spftrs_(&transrC, &uploC, &n, &nrhs, A, B, &ldb, &info);
+}
+
+template <>
+void cpu_pftrs(rocblas_operation transr,
+               rocblas_fill uplo,
+               rocblas_int n,
+               rocblas_int nrhs,
+               double* A,
+               double* B,
+               rocblas_int ldb)
+{
+    int info;
+    char transrC = rocblas2char_operation(transr);
+    char uploC = rocblas2char_fill(uplo);
+    dpftrs_(&transrC, &uploC, &n, &nrhs, A, B, &ldb, &info);
+}
+
+template <>
+void cpu_pftrs(rocblas_operation transr,
+               rocblas_fill uplo,
+               rocblas_int n,
+               rocblas_int nrhs,
+               rocblas_float_complex* A,
+               rocblas_float_complex* B,
+               rocblas_int ldb)
+{
+    int info;
+    char transrC = rocblas2char_operation(transr);
+    char uploC = rocblas2char_fill(uplo);
+    cpftrs_(&transrC, &uploC, &n, &nrhs, A, B, &ldb, &info);
+}
+
+template <>
+void cpu_pftrs(rocblas_operation transr,
+               rocblas_fill uplo,
+               rocblas_int n,
+               rocblas_int nrhs,
+               rocblas_double_complex* A,
+               rocblas_double_complex* B,
+               rocblas_int ldb)
+{
+    int info;
+    char transrC = rocblas2char_operation(transr);
+    char uploC = rocblas2char_fill(uplo);
+    zpftrs_(&transrC, &uploC, &n, &nrhs, A, B, &ldb, &info);
+}
+
+// pftri
+template <>
+void cpu_pftri(rocblas_operation transr,
+               rocblas_fill uplo,
+               rocblas_int n,
+               float* A,
+               rocblas_int* info)
+{
+    char transrC = rocblas2char_operation(transr);
+    char uploC = rocblas2char_fill(uplo);
+    spftri_(&transrC, &uploC, &n, A, info);
+}
+
+template <>
+void cpu_pftri(rocblas_operation transr,
+               rocblas_fill uplo,
+               rocblas_int n,
+               double* A,
+               rocblas_int* info)
+{
+    char transrC = rocblas2char_operation(transr);
+    char uploC = rocblas2char_fill(uplo);
+    dpftri_(&transrC, &uploC, &n, A, info);
+}
+
+template <>
+void cpu_pftri(rocblas_operation transr,
+               rocblas_fill uplo,
+               rocblas_int n,
+               rocblas_float_complex* A,
+               rocblas_int* info)
+{
+    char transrC = rocblas2char_operation(transr);
+    char uploC = rocblas2char_fill(uplo);
+    cpftri_(&transrC, &uploC, &n, A, info);
+}
+
+template <>
+void cpu_pftri(rocblas_operation transr,
+               rocblas_fill uplo,
+               rocblas_int n,
+               rocblas_double_complex* A,
+               rocblas_int* info)
+{
+    char transrC = rocblas2char_operation(transr);
+    char uploC = rocblas2char_fill(uplo);
+    zpftri_(&transrC, &uploC, &n, A, info);
+}
+
+// gesv
+template <>
+void cpu_gesv<float>(rocblas_int n,
+                     rocblas_int nrhs,
+                     float* A,
+                     rocblas_int lda,
+                     rocblas_int* ipiv,
+                     float* B,
+                     rocblas_int ldb,
+                     rocblas_int* info)
+{
+    sgesv_(&n, &nrhs, A, &lda, ipiv, B, &ldb, info);
+}
+
+template <>
+void cpu_gesv<double>(rocblas_int n,
+                      rocblas_int nrhs,
+                      double* A,
+                      rocblas_int lda,
+                      rocblas_int* ipiv,
+                      double* B,
+                      rocblas_int ldb,
+                      rocblas_int* info)
+{
+    dgesv_(&n, &nrhs, A, &lda, ipiv, B, &ldb, info);
+}
+
+template <>
+void cpu_gesv<rocblas_float_complex>(rocblas_int n,
+                                     rocblas_int nrhs,
+                                     rocblas_float_complex* A,
+                                     rocblas_int lda,
+                                     rocblas_int* ipiv,
+                                     rocblas_float_complex* B,
+                                     rocblas_int ldb,
+                                     rocblas_int* info)
+{
+    cgesv_(&n, &nrhs, A, &lda, ipiv, B, &ldb, info);
+}
+
+template <>
+void cpu_gesv<rocblas_double_complex>(rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_double_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_int* ipiv,
+                                      rocblas_double_complex* B,
+                                      rocblas_int ldb,
+                                      rocblas_int* info)
+{
+    zgesv_(&n, &nrhs, A, &lda, ipiv, B, &ldb, info);
+}
+
+// gels
+template <>
+void cpu_gels<float>(rocblas_operation transR,
+                     rocblas_int m,
+                     rocblas_int n,
+                     rocblas_int nrhs,
+                     float* A,
+                     rocblas_int lda,
+                     float* B,
+                     rocblas_int ldb,
+                     float* work,
+                     rocblas_int lwork,
+                     rocblas_int* info)
+{
+    char trans = rocblas2char_operation(transR);
+    sgels_(&trans, &m, &n, &nrhs, A, &lda, B, &ldb, work, &lwork, info);
+}
+
+template <>
+void cpu_gels<double>(rocblas_operation transR,
+                      rocblas_int m,
+                      rocblas_int n,
+                      rocblas_int nrhs,
+                      double* A,
+                      rocblas_int lda,
+                      double* B,
+                      rocblas_int ldb,
+                      double* work,
+                      rocblas_int lwork,
+                      rocblas_int* info)
+{
+    char trans = rocblas2char_operation(transR);
+    dgels_(&trans, &m, &n, &nrhs, A, &lda, B, &ldb, work, &lwork, info);
+}
+
+template <>
+void cpu_gels<rocblas_float_complex>(rocblas_operation transR,
+                                     rocblas_int m,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     rocblas_float_complex* A,
+                                     rocblas_int lda,
+                                     rocblas_float_complex* B,
+                                     rocblas_int ldb,
+                                     rocblas_float_complex* work,
+                                     rocblas_int lwork,
+                                     rocblas_int* info)
+{
+    char trans = rocblas2char_operation(transR);
+    cgels_(&trans, &m, &n, &nrhs, A, &lda, B, &ldb, work, &lwork, info);
+}
+
+template <>
+void cpu_gels<rocblas_double_complex>(rocblas_operation transR,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_double_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_double_complex* B,
+                                      rocblas_int ldb,
+                                      rocblas_double_complex* work,
+                                      rocblas_int lwork,
+                                      rocblas_int* info)
+{
+    char trans = rocblas2char_operation(transR);
+    zgels_(&trans, &m, &n, &nrhs, A, &lda, B, &ldb, work, &lwork, info);
+}
+
+// gelsd
+template <>
+void cpu_gelsd<float, float>(rocblas_int m,
+                             rocblas_int n,
+                             rocblas_int nrhs,
+                             float* A,
+                             rocblas_int lda,
+                             float* B,
+                             rocblas_int ldb,
+                             float* sval,
+                             float rcond,
+                             rocblas_int* rank,
+                             float* work,
+                             rocblas_int lwork,
+                             float* rwork,
+                             rocblas_int* iwork,
+                             rocblas_int* info)
+{
+    sgelsd_(&m, &n, &nrhs, A, &lda, B, &ldb, sval, &rcond, rank, work, &lwork, iwork, info);
+}
+
+template <>
+void cpu_gelsd<double, double>(rocblas_int m,
+                               rocblas_int n,
+                               rocblas_int nrhs,
+                               double* A,
+                               rocblas_int lda,
+                               double* B,
+                               rocblas_int ldb,
+                               double* sval,
+                               double rcond,
+                               rocblas_int* rank,
+                               double* work,
+                               rocblas_int lwork,
+                               double* rwork,
+                               rocblas_int* iwork,
+                               rocblas_int* info)
+{
+    dgelsd_(&m, &n, &nrhs, A, &lda, B, &ldb, sval, &rcond, rank, work, &lwork, iwork, info);
+}
+
+template <>
+void cpu_gelsd<rocblas_float_complex, float>(rocblas_int m,
+                                             rocblas_int n,
+                                             rocblas_int nrhs,
+                                             rocblas_float_complex* A,
+                                             rocblas_int lda,
+                                             rocblas_float_complex* B,
+                                             rocblas_int ldb,
+                                             float* sval,
+                                             float rcond,
+                                             rocblas_int* rank,
+                                             rocblas_float_complex* work,
+                                             rocblas_int lwork,
+                                             float* rwork,
+                                             rocblas_int* iwork,
+                                             rocblas_int* info)
+{
+    cgelsd_(&m, &n, &nrhs, A, &lda, B, &ldb, sval, &rcond, rank, work, &lwork, rwork, iwork, info);
+}
+
+template <>
+void cpu_gelsd<rocblas_double_complex, double>(rocblas_int m,
+                                               rocblas_int n,
+                                               rocblas_int nrhs,
+                                               rocblas_double_complex* A,
+                                               rocblas_int lda,
+                                               rocblas_double_complex* B,
+                                               rocblas_int ldb,
+                                               double* sval,
+                                               double rcond,
+                                               rocblas_int* rank,
+                                               rocblas_double_complex* work,
+                                               rocblas_int lwork,
+                                               double* rwork,
+                                               rocblas_int* iwork,
+                                               rocblas_int* info)
+{
+    zgelsd_(&m, &n, &nrhs, A, &lda, B, &ldb, sval, &rcond, rank, work, &lwork, rwork, iwork, info);
+}
+
+// gelsy
+template <>
+void cpu_gelsy<float, float>(rocblas_int m,
+                             rocblas_int n,
+                             rocblas_int nrhs,
+                             float* A,
+                             rocblas_int lda,
+                             float* B,
+                             rocblas_int ldb,
+                             rocblas_int* jpvt,
+                             float rcond,
+                             rocblas_int* rank,
+                             float* work,
+                             rocblas_int lwork,
+                             float* rwork)
+{
+    int info;
+    sgelsy_(&m, &n, &nrhs, A, &lda, B, &ldb, jpvt, &rcond, rank, work, &lwork, &info);
+}
+
+template <>
+void cpu_gelsy<double, double>(rocblas_int m,
+                               rocblas_int n,
+                               rocblas_int nrhs,
+                               double* A,
+                               rocblas_int lda,
+                               double* B,
+                               rocblas_int ldb,
+                               rocblas_int* jpvt,
+                               double rcond,
+                               rocblas_int* rank,
+                               double* work,
+                               rocblas_int lwork,
+                               double* rwork)
+{
+    int info;
+    dgelsy_(&m, &n, &nrhs, A, &lda, B, &ldb, jpvt, &rcond, rank, work, &lwork, &info);
+}
+
+template <>
+void cpu_gelsy<rocblas_float_complex, float>(rocblas_int m,
+                                             rocblas_int n,
+                                             rocblas_int nrhs,
+                                             rocblas_float_complex* A,
+                                             rocblas_int lda,
+                                             rocblas_float_complex* B,
+                                             rocblas_int ldb,
+                                             rocblas_int* jpvt,
+                                             float rcond,
+                                             rocblas_int* rank,
+                                             rocblas_float_complex* work,
+                                             rocblas_int lwork,
+                                             float* rwork)
+{
+    int info;
+    cgelsy_(&m, &n, &nrhs, A, &lda, B, &ldb, jpvt, &rcond, rank, work, &lwork, rwork, &info);
+}
+
+template <>
+void cpu_gelsy<rocblas_double_complex, double>(rocblas_int m,
+                                               rocblas_int n,
+                                               rocblas_int nrhs,
+                                               rocblas_double_complex* A,
+                                               rocblas_int lda,
+                                               rocblas_double_complex* B,
+                                               rocblas_int ldb,
+                                               rocblas_int* jpvt,
+                                               double rcond,
+                                               rocblas_int* rank,
+                                               rocblas_double_complex* work,
+                                               rocblas_int lwork,
+                                               double* rwork)
+{
+    int info;
+    zgelsy_(&m, &n, &nrhs, A, &lda, B, &ldb, jpvt, &rcond, rank, work, &lwork, rwork, &info);
+}
+
+// trtri
+template <>
+void cpu_trtri<float>(rocblas_fill uplo,
+                      rocblas_diagonal diag,
+                      rocblas_int n,
+                      float* A,
+                      rocblas_int lda,
+                      rocblas_int* info)
+{
+    char uploC = rocblas2char_fill(uplo);
+    char diagC = rocblas2char_diagonal(diag);
+    strtri_(&uploC, &diagC, &n, A, &lda, info);
+}
+
+template <>
+void cpu_trtri<double>(rocblas_fill uplo,
+                       rocblas_diagonal diag,
+                       rocblas_int n,
+                       double* A,
+                       rocblas_int lda,
+                       rocblas_int* info)
+{
+    char uploC = rocblas2char_fill(uplo);
+    char diagC = rocblas2char_diagonal(diag);
+    dtrtri_(&uploC, &diagC, &n, A, &lda, info);
+}
+
+template <>
+void cpu_trtri<rocblas_float_complex>(rocblas_fill uplo,
+                                      rocblas_diagonal diag,
+                                      rocblas_int n,
+                                      rocblas_float_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_int* info)
+{
+    char uploC = rocblas2char_fill(uplo);
+    char diagC = rocblas2char_diagonal(diag);
+    ctrtri_(&uploC, &diagC, &n, A, &lda, info);
+}
+
+template <>
+void cpu_trtri<rocblas_double_complex>(rocblas_fill uplo,
+                                       rocblas_diagonal diag,
+                                       rocblas_int n,
+                                       rocblas_double_complex* A,
+                                       rocblas_int lda,
+                                       rocblas_int* info)
+{
+    char uploC = rocblas2char_fill(uplo);
+    char diagC = rocblas2char_diagonal(diag);
+    ztrtri_(&uploC, &diagC, &n, A, &lda, info);
+}
+
+// getri
+template <>
+void cpu_getri<float>(rocblas_int n,
+                      float* A,
+                      rocblas_int lda,
+                      rocblas_int* ipiv,
+                      float* work,
+                      rocblas_int lwork,
+                      rocblas_int* info)
+{
+    sgetri_(&n, A, &lda, ipiv, work, &lwork, info);
+}
+
+template <>
+void cpu_getri<double>(rocblas_int n,
+                       double* A,
+                       rocblas_int lda,
+                       rocblas_int* ipiv,
+                       double* work,
+                       rocblas_int lwork,
+                       rocblas_int* info)
+{
+    dgetri_(&n, A, &lda, ipiv, work, &lwork, info);
+}
+
+template <>
+void cpu_getri<rocblas_float_complex>(rocblas_int n,
+                                      rocblas_float_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_int* ipiv,
+                                      rocblas_float_complex* work,
+                                      rocblas_int lwork,
+                                      rocblas_int* info)
+{
+    cgetri_(&n, A, &lda, ipiv, work, &lwork, info);
+}
+
+template <>
+void cpu_getri<rocblas_double_complex>(rocblas_int n,
+                                       rocblas_double_complex* A,
+                                       rocblas_int lda,
+                                       rocblas_int* ipiv,
+                                       rocblas_double_complex* work,
+                                       rocblas_int lwork,
+                                       rocblas_int* info)
+{
+    zgetri_(&n, A, &lda, ipiv, work, &lwork, info);
+}
+
+// geqrf
+template <>
+void cpu_geqrf<float>(rocblas_int m,
+                      rocblas_int n,
+                      float* A,
+                      rocblas_int lda,
+                      float* ipiv,
+                      float* work,
+                      rocblas_int lwork)
+{
+    int info;
+    sgeqrf_(&m, &n, A, &lda, ipiv, work, &lwork, &info);
+}
+
+template <>
+void cpu_geqrf<double>(rocblas_int m,
+                       rocblas_int n,
+                       double* A,
+                       rocblas_int lda,
+                       double* ipiv,
+                       double* work,
+                       rocblas_int lwork)
+{
+    int info;
+    dgeqrf_(&m, &n, A, &lda, ipiv, work, &lwork, &info);
+}
+
+template <>
+void cpu_geqrf<rocblas_float_complex>(rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_float_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_float_complex* ipiv,
+                                      rocblas_float_complex* work,
+                                      rocblas_int lwork)
+{
+    int info;
+    cgeqrf_(&m, &n, A, &lda, ipiv, work, &lwork, &info);
+}
+
+template <>
+void cpu_geqrf<rocblas_double_complex>(rocblas_int m,
+                                       rocblas_int n,
+                                       rocblas_double_complex* A,
+                                       rocblas_int lda,
+                                       rocblas_double_complex* ipiv,
+                                       rocblas_double_complex* work,
+                                       rocblas_int lwork)
+{
+    int info;
+    zgeqrf_(&m, &n, A, &lda, ipiv, work, &lwork, &info);
+}
+
+// geqp3
+template <>
+void cpu_geqp3<float, float>(rocblas_int m,
+                             rocblas_int n,
+                             float* A,
+                             rocblas_int lda,
+                             rocblas_int* jpvt,
+                             float* ipiv,
+                             float* work,
+                             rocblas_int lwork,
+                             float* rwork)
 {
-    sgetri_(&n, A, &lda, ipiv, work, &lwork, info);
+    int info;
+    sgeqp3_(&m, &n, A, &lda, jpvt, ipiv, work, &lwork, &info);
 }
 
 template <>
-void cpu_getri<double>(rocblas_int n,
-                       double* A,
-                       rocblas_int lda,
-                       rocblas_int* ipiv,
-                       double* work,
-                       rocblas_int lwork,
-                       rocblas_int* info)
+void cpu_geqp3<double, double>(rocblas_int m,
+                               rocblas_int n,
+                               double* A,
+                               rocblas_int lda,
+                               rocblas_int* jpvt,
+                               double* ipiv,
+                               double* work,
+                               rocblas_int lwork,
+                               double* rwork)
 {
-    dgetri_(&n, A, &lda, ipiv, work, &lwork, info);
+    int info;
+    dgeqp3_(&m, &n, A, &lda, jpvt, ipiv, work, &lwork, &info);
 }
 
 template <>
-void cpu_getri<rocblas_float_complex>(rocblas_int n,
-                                      rocblas_float_complex* A,
-                                      rocblas_int lda,
-                                      rocblas_int* ipiv,
-                                      rocblas_float_complex* work,
-                                      rocblas_int lwork,
-                                      rocblas_int* info)
+void cpu_geqp3<rocblas_float_complex, float>(rocblas_int m,
+                                             rocblas_int n,
+                                             rocblas_float_complex* A,
+                                             rocblas_int lda,
+                                             rocblas_int* jpvt,
+                                             rocblas_float_complex* ipiv,
+                                             rocblas_float_complex* work,
+                                             rocblas_int lwork,
+                                             float* rwork)
 {
-    cgetri_(&n, A, &lda, ipiv, work, &lwork, info);
+    int info;
+    cgeqp3_(&m, &n, A, &lda, jpvt, ipiv, work, &lwork, rwork, &info);
 }
 
 template <>
-void cpu_getri<rocblas_double_complex>(rocblas_int n,
-                                       rocblas_double_complex* A,
-                                       rocblas_int lda,
-                                       rocblas_int* ipiv,
-                                       rocblas_double_complex* work,
-                                       rocblas_int lwork,
-                                       rocblas_int* info)
+void cpu_geqp3<rocblas_double_complex, double>(rocblas_int m,
+                                               rocblas_int n,
+                                               rocblas_double_complex* A,
+                                               rocblas_int lda,
+                                               rocblas_int* jpvt,
+                                               rocblas_double_complex* ipiv,
+                                               rocblas_double_complex* work,
+                                               rocblas_int lwork,
+                                               double* rwork)
 {
-    zgetri_(&n, A, &lda, ipiv, work, &lwork, info);
+    int info;
+    zgeqp3_(&m, &n, A, &lda, jpvt, ipiv, work, &lwork, rwork, &info);
 }
 
-// geqrf
+// geqrt
 template <>
-void cpu_geqrf<float>(rocblas_int m,
+void cpu_geqrt<float>(rocblas_int m,
                       rocblas_int n,
+                      rocblas_int nb,
                       float* A,
                       rocblas_int lda,
-                      float* ipiv,
-                      float* work,
-                      rocblas_int lwork)
+                      float* Tf,
+                      rocblas_int ldt,
+                      float* work)
 {
     int info;
-    sgeqrf_(&m, &n, A, &lda, ipiv, work, &lwork, &info);
+    sgeqrt_(&m, &n, &nb, A, &lda, Tf, &ldt, work, &info);
 }
 
 template <>
-void cpu_geqrf<double>(rocblas_int m,
+void cpu_geqrt<double>(rocblas_int m,
                        rocblas_int n,
+                       rocblas_int nb,
                        double* A,
                        rocblas_int lda,
-                       double* ipiv,
-                       double* work,
-                       rocblas_int lwork)
+                       double* Tf,
+                       rocblas_int ldt,
+                       double* work)
 {
     int info;
-    dgeqrf_(&m, &n, A, &lda, ipiv, work, &lwork, &info);
+    dgeqrt_(&m, &n, &nb, A, &lda, Tf, &ldt, work, &info);
 }
 
 template <>
-void cpu_geqrf<rocblas_float_complex>(rocblas_int m,
+void cpu_geqrt<rocblas_float_complex>(rocblas_int m,
                                       rocblas_int n,
+                                      rocblas_int nb,
                                       rocblas_float_complex* A,
                                       rocblas_int lda,
-                                      rocblas_float_complex* ipiv,
-                                      rocblas_float_complex* work,
-                                      rocblas_int lwork)
+                                      rocblas_float_complex* Tf,
+                                      rocblas_int ldt,
+                                      rocblas_float_complex* work)
 {
     int info;
-    cgeqrf_(&m, &n, A, &lda, ipiv, work, &lwork, &info);
+    cgeqrt_(&m, &n, &nb, A, &lda, Tf, &ldt, work, &info);
 }
 
 template <>
-void cpu_geqrf<rocblas_double_complex>(rocblas_int m,
+void cpu_geqrt<rocblas_double_complex>(rocblas_int m,
                                        rocblas_int n,
+                                       rocblas_int nb,
                                        rocblas_double_complex* A,
                                        rocblas_int lda,
-                                       rocblas_double_complex* ipiv,
-                                       rocblas_double_complex* work,
-                                       rocblas_int lwork)
+                                       rocblas_double_complex* Tf,
+                                       rocblas_int ldt,
+                                       rocblas_double_complex* work)
 {
     int info;
-    zgeqrf_(&m, &n, A, &lda, ipiv, work, &lwork, &info);
+    zgeqrt_(&m, &n, &nb, A, &lda, Tf, &ldt, work, &info);
 }
 
 // geqr2
@@ -6320,6 +7977,100 @@ void cpu_gebrd<rocblas_double_complex, double>(rocblas_int m,
     zgebrd_(&m, &n, A, &lda, D, E, tauq, taup, work, &size_w, &info);
 }
 
+// gehd2
+template <>
+void cpu_gehd2<float>(rocblas_int n, float* A, rocblas_int lda, float* tau, float* work)
+{
+    int info;
+    int ilo = 1;
+    sgehd2_(&n, &ilo, &n, A, &lda, tau, work, &info);
+}
+
+template <>
+void cpu_gehd2<double>(rocblas_int n, double* A, rocblas_int lda, double* tau, double* work)
+{
+    int info;
+    int ilo = 1;
+    dgehd2_(&n, &ilo, &n, A, &lda, tau, work, &info);
+}
+
+template <>
+void cpu_gehd2<rocblas_float_complex>(rocblas_int n,
+                                      rocblas_float_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_float_complex* tau,
+                                      rocblas_float_complex* work)
+{
+    int info;
+    int ilo = 1;
+    cgehd2_(&n, &ilo, &n, A, &lda, tau, work, &info);
+}
+
+template <>
+void cpu_gehd2<rocblas_double_complex>(rocblas_int n,
+                                       rocblas_double_complex* A,
+                                       rocblas_int lda,
+                                       rocblas_double_complex* tau,
+                                       rocblas_double_complex* work)
+{
+    int info;
+    int ilo = 1;
+    zgehd2_(&n, &ilo, &n, A, &lda, tau, work, &info);
+}
+
+// gehrd
+template <>
+void cpu_gehrd<float>(rocblas_int n,
+                      float* A,
+                      rocblas_int lda,
+                      float* tau,
+                      float* work,
+                      rocblas_int size_w)
+{
+    int info;
+    int ilo = 1;
+    sgehrd_(&n, &ilo, &n, A, &lda, tau, work, &size_w, &info);
+}
+
+template <>
+void cpu_gehrd<double>(rocblas_int n,
+                       double* A,
+                       rocblas_int lda,
+                       double* tau,
+                       double* work,
+                       rocblas_int size_w)
+{
+    int info;
+    int ilo = 1;
+    dgehrd_(&n, &ilo, &n, A, &lda, tau, work, &size_w, &info);
+}
+
+template <>
+void cpu_gehrd<rocblas_float_complex>(rocblas_int n,
+                                      rocblas_float_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_float_complex* tau,
+                                      rocblas_float_complex* work,
+                                      rocblas_int size_w)
+{
+    int info;
+    int ilo = 1;
+    cgehrd_(&n, &ilo, &n, A, &lda, tau, work, &size_w, &info);
+}
+
+template <>
+void cpu_gehrd<rocblas_double_complex>(rocblas_int n,
+                                       rocblas_double_complex* A,
+                                       rocblas_int lda,
+                                       rocblas_double_complex* tau,
+                                       rocblas_double_complex* work,
+                                       rocblas_int size_w)
+{
+    int info;
+    int ilo = 1;
+    zgehrd_(&n, &ilo, &n, A, &lda, tau, work, &size_w, &info);
+}
+
 // sytrd & hetrd
 template <>
 void cpu_sytrd_hetrd<float, float>(rocblas_fill uplo,
@@ -7604,6 +9355,136 @@ void cpu_sytrf<rocblas_double_complex>(rocblas_fill uplo,
     zsytrf_(&uploC, &n, A, &lda, ipiv, work, &lwork, info);
 }
 
+// sytrs
+template <>
+void cpu_sytrs<float>(rocblas_fill uplo,
+                      rocblas_int n,
+                      rocblas_int nrhs,
+                      float* A,
+                      rocblas_int lda,
+                      rocblas_int* ipiv,
+                      float* B,
+                      rocblas_int ldb)
+{
+    int info;
+    char uploC = rocblas2char_fill(uplo);
+    ssytrs_(&uploC, &n, &nrhs, A, &lda, ipiv, B, &ldb, &info);
+}
+
+template <>
+void cpu_sytrs<double>(rocblas_fill uplo,
+                       rocblas_int n,
+                       rocblas_int nrhs,
+                       double* A,
+                       rocblas_int lda,
+                       rocblas_int* ipiv,
+                       double* B,
+                       rocblas_int ldb)
+{
+    int info;
+    char uploC = rocblas2char_fill(uplo);
+    dsytrs_(&uploC, &n, &nrhs, A, &lda, ipiv, B, &ldb, &info);
+}
+
+template <>
+void cpu_sytrs<rocblas_float_complex>(rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_float_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_int* ipiv,
+                                      rocblas_float_complex* B,
+                                      rocblas_int ldb)
+{
+    int info;
+    char uploC = rocblas2char_fill(uplo);
+    csytrs_(&uploC, &n, &nrhs, A, &lda, ipiv, B, &ldb, &info);
+}
+
+template <>
+void cpu_sytrs<rocblas_double_complex>(rocblas_fill uplo,
+                                       rocblas_int n,
+                                       rocblas_int nrhs,
+                                       rocblas_double_complex* A,
+                                       rocblas_int lda,
+                                       rocblas_int* ipiv,
+                                       rocblas_double_complex* B,
+                                       rocblas_int ldb)
+{
+    int info;
+    char uploC = rocblas2char_fill(uplo);
+    zsytrs_(&uploC, &n, &nrhs, A, &lda, ipiv, B, &ldb, &info);
+}
+
+// sysv
+template <>
+void cpu_sysv<float>(rocblas_fill uplo,
+                     rocblas_int n,
+                     rocblas_int nrhs,
+                     float* A,
+                     rocblas_int lda,
+                     rocblas_int* ipiv,
+                     float* B,
+                     rocblas_int ldb,
+                     float* work,
+                     rocblas_int lwork,
+                     rocblas_int* info)
+{
+    char uploC = rocblas2char_fill(uplo);
+    ssysv_(&uploC, &n, &nrhs, A, &lda, ipiv, B, &ldb, work, &lwork, info);
+}
+
+template <>
+void cpu_sysv<double>(rocblas_fill uplo,
+                      rocblas_int n,
+                      rocblas_int nrhs,
+                      double* A,
+                      rocblas_int lda,
+                      rocblas_int* ipiv,
+                      double* B,
+                      rocblas_int ldb,
+                      double* work,
+                      rocblas_int lwork,
+                      rocblas_int* info)
+{
+    char uploC = rocblas2char_fill(uplo);
+    dsysv_(&uploC, &n, &nrhs, A, &lda, ipiv, B, &ldb, work, &lwork, info);
+}
+
+template <>
+void cpu_sysv<rocblas_float_complex>(rocblas_fill uplo,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     rocblas_float_complex* A,
+                                     rocblas_int lda,
+                                     rocblas_int* ipiv,
+                                     rocblas_float_complex* B,
+                                     rocblas_int ldb,
+                                     rocblas_float_complex* work,
+                                     rocblas_int lwork,
+                                     rocblas_int* info)
+{
+    char uploC = rocblas2char_fill(uplo);
+    csysv_(&uploC, &n, &nrhs, A, &lda, ipiv, B, &ldb, work, &lwork, info);
+}
+
+template <>
+void cpu_sysv<rocblas_double_complex>(rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_double_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_int* ipiv,
+                                      rocblas_double_complex* B,
+                                      rocblas_int ldb,
+                                      rocblas_double_complex* work,
+                                      rocblas_int lwork,
+                                      rocblas_int* info)
+{
+    char uploC = rocblas2char_fill(uplo);
+    zsysv_(&uploC, &n, &nrhs, A, &lda, ipiv, B, &ldb, work, &lwork, info);
+}
+
 // bdsvdx
 template <>
 void cpu_bdsvdx<float>(rocblas_fill uplo,
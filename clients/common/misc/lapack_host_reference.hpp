@@ -78,6 +78,27 @@ S cpu_lange(char norm, rocblas_int m, rocblas_int n, T* A, rocblas_int lda, S* w
 template <typename T, typename S>
 S cpu_gecon(char norm, rocblas_int n, T* A, rocblas_int lda, S anorm, T* work, S* rwork, rocblas_int* iwork);
 
+template <typename T, typename S>
+S cpu_pocon(rocblas_fill uplo,
+            rocblas_int n,
+            T* A,
+            rocblas_int lda,
+            S anorm,
+            T* work,
+            S* rwork,
+            rocblas_int* iwork);
+
+template <typename T, typename S>
+S cpu_trcon(char norm,
+            rocblas_fill uplo,
+            rocblas_diagonal diag,
+            rocblas_int n,
+            T* A,
+            rocblas_int lda,
+            T* work,
+            S* rwork,
+            rocblas_int* iwork);
+
 template <typename T>
 void cpu_axpy(rocblas_int n, T alpha, T* x, rocblas_int incx, T* y, rocblas_int incy);
 
@@ -215,6 +236,77 @@ void cpu_getrs(rocblas_operation trans,
                T* B,
                rocblas_int ldb);
 
+template <typename T>
+void cpu_gbtrf(rocblas_int m,
+               rocblas_int n,
+               rocblas_int kl,
+               rocblas_int ku,
+               T* AB,
+               rocblas_int ldab,
+               rocblas_int* ipiv,
+               rocblas_int* info);
+
+template <typename T>
+void cpu_gbtrs(rocblas_operation trans,
+               rocblas_int n,
+               rocblas_int kl,
+               rocblas_int ku,
+               rocblas_int nrhs,
+               T* AB,
+               rocblas_int ldab,
+               rocblas_int* ipiv,
+               T* B,
+               rocblas_int ldb);
+
+template <typename T>
+void cpu_pbtrf(rocblas_fill uplo,
+               rocblas_int n,
+               rocblas_int kd,
+               T* AB,
+               rocblas_int ldab,
+               rocblas_int* info);
+
+template <typename T>
+void cpu_pbtrs(rocblas_fill uplo,
+               rocblas_int n,
+               rocblas_int kd,
+               rocblas_int nrhs,
+               T* AB,
+               rocblas_int ldab,
+               T* B,
+               rocblas_int ldb);
+
+template <typename T>
+void cpu_trttf(rocblas_operation transr,
+               rocblas_fill uplo,
+               rocblas_int n,
+               T* A,
+               rocblas_int lda,
+               T* ARF);
+
+template <typename T>
+void cpu_tfttr(rocblas_operation transr,
+               rocblas_fill uplo,
+               rocblas_int n,
+               T* ARF,
+               T* A,
+               rocblas_int lda);
+
+template <typename T>
+void cpu_pftrf(rocblas_operation transr, rocblas_fill uplo, rocblas_int n, T* A, rocblas_int* info);
+
+template <typename T>
+void cpu_pftrs(rocblas_operation transr,
+               rocblas_fill uplo,
+               rocblas_int n,
+               rocblas_int nrhs,
+               T* A,
+               T* B,
+               rocblas_int ldb);
+
+template <typename T>
+void cpu_pftri(rocblas_operation transr, rocblas_fill uplo, rocblas_int n, T* A, rocblas_int* info);
+
 template <typename T>
 void cpu_gesv(rocblas_int n,
               rocblas_int nrhs,
@@ -238,6 +330,38 @@ void cpu_gels(rocblas_operation transR,
               rocblas_int lwork,
               rocblas_int* info);
 
+template <typename T, typename S>
+void cpu_gelsd(rocblas_int m,
+               rocblas_int n,
+               rocblas_int nrhs,
+               T* A,
+               rocblas_int lda,
+               T* B,
+               rocblas_int ldb,
+               S* sval,
+               S rcond,
+               rocblas_int* rank,
+               T* work,
+               rocblas_int lwork,
+               S* rwork,
+               rocblas_int* iwork,
+               rocblas_int* info);
+
+template <typename T, typename S>
+void cpu_gelsy(rocblas_int m,
+               rocblas_int n,
+               rocblas_int nrhs,
+               T* A,
+               rocblas_int lda,
+               T* B,
+               rocblas_int ldb,
+               rocblas_int* jpvt,
+               S rcond,
+               rocblas_int* rank,
+               T* work,
+               rocblas_int lwork,
+               S* rwork);
+
 template <typename T>
 void cpu_getri(rocblas_int n,
                T* A,
@@ -346,6 +470,27 @@ void cpu_geqr2(rocblas_int m, rocblas_int n, T* A, rocblas_int lda, T* ipiv, T*
 template <typename T>
 void cpu_geqrf(rocblas_int m, rocblas_int n, T* A, rocblas_int lda, T* ipiv, T* work, rocblas_int sizeW);
 
+template <typename T, typename S>
+void cpu_geqp3(rocblas_int m,
+               rocblas_int n,
+               T* A,
+               rocblas_int lda,
+               rocblas_int* jpvt,
+               T* ipiv,
+               T* work,
+               rocblas_int lwork,
+               S* rwork);
+
+template <typename T>
+void cpu_geqrt(rocblas_int m,
+               rocblas_int n,
+               rocblas_int nb,
+               T* A,
+               rocblas_int lda,
+               T* Tf,
+               rocblas_int ldt,
+               T* work);
+
 template <typename T>
 void cpu_gerq2(rocblas_int m, rocblas_int n, T* A, rocblas_int lda, T* ipiv, T* work);
 
@@ -471,6 +616,21 @@ void cpu_ormqr_unmqr(rocblas_side side,
                      T* work,
                      rocblas_int sizeW);
 
+template <typename T>
+void cpu_gemqrt(rocblas_side side,
+                rocblas_operation trans,
+                rocblas_int m,
+                rocblas_int n,
+                rocblas_int k,
+                rocblas_int nb,
+                T* V,
+                rocblas_int ldv,
+                T* Tf,
+                rocblas_int ldt,
+                T* C,
+                rocblas_int ldc,
+                T* work);
+
 template <typename T>
 void cpu_orml2_unml2(rocblas_side side,
                      rocblas_operation trans,
@@ -572,6 +732,12 @@ void cpu_gebrd(rocblas_int m,
                T* work,
                rocblas_int size_w);
 
+template <typename T>
+void cpu_gehd2(rocblas_int n, T* A, rocblas_int lda, T* tau, T* work);
+
+template <typename T>
+void cpu_gehrd(rocblas_int n, T* A, rocblas_int lda, T* tau, T* work, rocblas_int size_w);
+
 template <typename T, typename S>
 void cpu_sytrd_hetrd(rocblas_fill uplo,
                      rocblas_int n,
@@ -824,6 +990,29 @@ void cpu_sytrf(rocblas_fill uplo,
                rocblas_int lwork,
                rocblas_int* info);
 
+template <typename T>
+void cpu_sytrs(rocblas_fill uplo,
+               rocblas_int n,
+               rocblas_int nrhs,
+               T* A,
+               rocblas_int lda,
+               rocblas_int* ipiv,
+               T* B,
+               rocblas_int ldb);
+
+template <typename T>
+void cpu_sysv(rocblas_fill uplo,
+              rocblas_int n,
+              rocblas_int nrhs,
+              T* A,
+              rocblas_int lda,
+              rocblas_int* ipiv,
+              T* B,
+              rocblas_int ldb,
+              T* work,
+              rocblas_int lwork,
+              rocblas_int* info);
+
 template <typename T>
 void cpu_bdsvdx(rocblas_fill uplo,
                 rocblas_svect svect,
@@ -1234,6 +1234,100 @@ inline rocblas_status rocsolver_lauum(rocblas_handle handle,
 }
 /***************************************************************/
 
+/******************** TRTTF ********************/
+
+inline rocblas_status rocsolver_trttf(rocblas_handle handle,
+                                      rocblas_operation transr,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      float* A,
+                                      rocblas_int lda,
+                                      float* ARF)
+{
+    return rocsolver_strttf(handle, transr, uplo, n, A, lda, ARF);
+}
+
+inline rocblas_status rocsolver_trttf(rocblas_handle handle,
+                                      rocblas_operation transr,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      double* A,
+                                      rocblas_int lda,
+                                      double* ARF)
+{
+    return rocsolver_dtrttf(handle, transr, uplo, n, A, lda, ARF);
+}
+
+inline rocblas_status rocsolver_trttf(rocblas_handle handle,
+                                      rocblas_operation transr,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_float_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_float_complex* ARF)
+{
+    return rocsolver_ctrttf(handle, transr, uplo, n, A, lda, ARF);
+}
+
+inline rocblas_status rocsolver_trttf(rocblas_handle handle,
+                                      rocblas_operation transr,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_double_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_double_complex* ARF)
+{
+    return rocsolver_ztrttf(handle, transr, uplo, n, A, lda, ARF);
+}
+/***************************************************************/
+
+/******************** TFTTR ********************/
+
+inline rocblas_status rocsolver_tfttr(rocblas_handle handle,
+                                      rocblas_operation transr,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      float* ARF,
+                                      float* A,
+                                      rocblas_int lda)
+{
+    return rocsolver_stfttr(handle, transr, uplo, n, ARF, A, lda);
+}
+
+inline rocblas_status rocsolver_tfttr(rocblas_handle handle,
+                                      rocblas_operation transr,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      double* ARF,
+                                      double* A,
+                                      rocblas_int lda)
+{
+    return rocsolver_dtfttr(handle, transr, uplo, n, ARF, A, lda);
+}
+
+inline rocblas_status rocsolver_tfttr(rocblas_handle handle,
+                                      rocblas_operation transr,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_float_complex* ARF,
+                                      rocblas_float_complex* A,
+                                      rocblas_int lda)
+{
+    return rocsolver_ctfttr(handle, transr, uplo, n, ARF, A, lda);
+}
+
+inline rocblas_status rocsolver_tfttr(rocblas_handle handle,
+                                      rocblas_operation transr,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_double_complex* ARF,
+                                      rocblas_double_complex* A,
+                                      rocblas_int lda)
+{
+    return rocsolver_ztfttr(handle, transr, uplo, n, ARF, A, lda);
+}
+/***************************************************************/
+
 /******************** BDSQR ********************/
 inline rocblas_status rocsolver_bdsqr(rocblas_handle handle,
                                       rocblas_fill uplo,
@@ -1498,6 +1592,60 @@ inline rocblas_status rocsolver_orgxr_ungxr(bool GQR,
 }
 /***************************************************************/
 
+/******************** ORGQR_UNGQR_OUTOFPLACE ********************/
+inline rocblas_status rocsolver_orgqr_ungqr_outofplace(rocblas_handle handle,
+                                                       rocblas_int m,
+                                                       rocblas_int n,
+                                                       rocblas_int k,
+                                                       float* A,
+                                                       rocblas_int lda,
+                                                       float* Ipiv,
+                                                       float* Q,
+                                                       rocblas_int ldq)
+{
+    return rocsolver_sorgqr_outofplace(handle, m, n, k, A, lda, Ipiv, Q, ldq);
+}
+
+inline rocblas_status rocsolver_orgqr_ungqr_outofplace(rocblas_handle handle,
+                                                       rocblas_int m,
+                                                       rocblas_int n,
+                                                       rocblas_int k,
+                                                       double* A,
+                                                       rocblas_int lda,
+                                                       double* Ipiv,
+                                                       double* Q,
+                                                       rocblas_int ldq)
+{
+    return rocsolver_dorgqr_outofplace(handle, m, n, k, A, lda, Ipiv, Q, ldq);
+}
+
+inline rocblas_status rocsolver_orgqr_ungqr_outofplace(rocblas_handle handle,
+                                                       rocblas_int m,
+                                                       rocblas_int n,
+                                                       rocblas_int k,
+                                                       rocblas_float_complex* A,
+                                                       rocblas_int lda,
+                                                       rocblas_float_complex* Ipiv,
+                                                       rocblas_float_complex* Q,
+                                                       rocblas_int ldq)
+{
+    return rocsolver_cungqr_outofplace(handle, m, n, k, A, lda, Ipiv, Q, ldq);
+}
+
+inline rocblas_status rocsolver_orgqr_ungqr_outofplace(rocblas_handle handle,
+                                                       rocblas_int m,
+                                                       rocblas_int n,
+                                                       rocblas_int k,
+                                                       rocblas_double_complex* A,
+                                                       rocblas_int lda,
+                                                       rocblas_double_complex* Ipiv,
+                                                       rocblas_double_complex* Q,
+                                                       rocblas_int ldq)
+{
+    return rocsolver_zungqr_outofplace(handle, m, n, k, A, lda, Ipiv, Q, ldq);
+}
+/***************************************************************/
+
 /******************** ORGLx_UNGLx ********************/
 inline rocblas_status rocsolver_orglx_unglx(bool GLQ,
                                             rocblas_handle handle,
@@ -2036,6 +2184,76 @@ inline rocblas_status rocsolver_ormtr_unmtr(rocblas_handle handle,
 }
 /***************************************************************/
 
+/******************** GEMQRT ********************/
+inline rocblas_status rocsolver_gemqrt(rocblas_handle handle,
+                                       rocblas_side side,
+                                       rocblas_operation trans,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       rocblas_int k,
+                                       rocblas_int nb,
+                                       float* V,
+                                       rocblas_int ldv,
+                                       float* T,
+                                       rocblas_int ldt,
+                                       float* C,
+                                       rocblas_int ldc)
+{
+    return rocsolver_sgemqrt(handle, side, trans, m, n, k, nb, V, ldv, T, ldt, C, ldc);
+}
+
+inline rocblas_status rocsolver_gemqrt(rocblas_handle handle,
+                                       rocblas_side side,
+                                       rocblas_operation trans,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       rocblas_int k,
+                                       rocblas_int nb,
+                                       double* V,
+                                       rocblas_int ldv,
+                                       double* T,
+                                       rocblas_int ldt,
+                                       double* C,
+                                       rocblas_int ldc)
+{
+    return rocsolver_dgemqrt(handle, side, trans, m, n, k, nb, V, ldv, T, ldt, C, ldc);
+}
+
+inline rocblas_status rocsolver_gemqrt(rocblas_handle handle,
+                                       rocblas_side side,
+                                       rocblas_operation trans,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       rocblas_int k,
+                                       rocblas_int nb,
+                                       rocblas_float_complex* V,
+                                       rocblas_int ldv,
+                                       rocblas_float_complex* T,
+                                       rocblas_int ldt,
+                                       rocblas_float_complex* C,
+                                       rocblas_int ldc)
+{
+    return rocsolver_cgemqrt(handle, side, trans, m, n, k, nb, V, ldv, T, ldt, C, ldc);
+}
+
+inline rocblas_status rocsolver_gemqrt(rocblas_handle handle,
+                                       rocblas_side side,
+                                       rocblas_operation trans,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       rocblas_int k,
+                                       rocblas_int nb,
+                                       rocblas_double_complex* V,
+                                       rocblas_int ldv,
+                                       rocblas_double_complex* T,
+                                       rocblas_int ldt,
+                                       rocblas_double_complex* C,
+                                       rocblas_int ldc)
+{
+    return rocsolver_zgemqrt(handle, side, trans, m, n, k, nb, V, ldv, T, ldt, C, ldc);
+}
+/***************************************************************/
+
 /******************** STERF ********************/
 inline rocblas_status
     rocsolver_sterf(rocblas_handle handle, rocblas_int n, float* D, float* E, rocblas_int* info)
@@ -2050,6 +2268,56 @@ inline rocblas_status
 }
 /********************************************************/
 
+/******************** GEQRF_VBATCHED ********************/
+inline rocblas_status rocsolver_geqrf_vbatched(rocblas_handle handle,
+                                               rocblas_int* m,
+                                               rocblas_int* n,
+                                               float* const A[],
+                                               rocblas_int* lda,
+                                               float* ipiv,
+                                               rocblas_stride stP,
+                                               rocblas_int bc)
+{
+    return rocsolver_sgeqrf_vbatched(handle, m, n, A, lda, ipiv, stP, bc);
+}
+
+inline rocblas_status rocsolver_geqrf_vbatched(rocblas_handle handle,
+                                               rocblas_int* m,
+                                               rocblas_int* n,
+                                               double* const A[],
+                                               rocblas_int* lda,
+                                               double* ipiv,
+                                               rocblas_stride stP,
+                                               rocblas_int bc)
+{
+    return rocsolver_dgeqrf_vbatched(handle, m, n, A, lda, ipiv, stP, bc);
+}
+
+inline rocblas_status rocsolver_geqrf_vbatched(rocblas_handle handle,
+                                               rocblas_int* m,
+                                               rocblas_int* n,
+                                               rocblas_float_complex* const A[],
+                                               rocblas_int* lda,
+                                               rocblas_float_complex* ipiv,
+                                               rocblas_stride stP,
+                                               rocblas_int bc)
+{
+    return rocsolver_cgeqrf_vbatched(handle, m, n, A, lda, ipiv, stP, bc);
+}
+
+inline rocblas_status rocsolver_geqrf_vbatched(rocblas_handle handle,
+                                               rocblas_int* m,
+                                               rocblas_int* n,
+                                               rocblas_double_complex* const A[],
+                                               rocblas_int* lda,
+                                               rocblas_double_complex* ipiv,
+                                               rocblas_stride stP,
+                                               rocblas_int bc)
+{
+    return rocsolver_zgeqrf_vbatched(handle, m, n, A, lda, ipiv, stP, bc);
+}
+/********************************************************/
+
 /******************** STEBZ ********************/
 inline rocblas_status rocsolver_stebz(rocblas_handle handle,
                                       rocblas_erange erange,
@@ -2572,6 +2840,86 @@ inline rocblas_status rocsolver_potf2_potrf(bool STRIDED,
                      : rocsolver_zpotf2(handle, uplo, n, A, lda, info);
 }
 
+inline rocblas_status rocsolver_potf2_potrf(bool STRIDED,
+                                            bool POTRF,
+                                            rocblas_handle handle,
+                                            rocblas_fill uplo,
+                                            int64_t n,
+                                            float* A,
+                                            int64_t lda,
+                                            rocblas_stride stA,
+                                            int64_t* info,
+                                            int64_t batch_count)
+{
+    if(STRIDED)
+        return POTRF ? rocsolver_spotrf_strided_batched_64(handle, uplo, n, A, lda, stA, info,
+                                                            batch_count)
+                     : rocblas_status_not_implemented;
+    else
+        return POTRF ? rocsolver_spotrf_64(handle, uplo, n, A, lda, info)
+                     : rocblas_status_not_implemented;
+}
+
+inline rocblas_status rocsolver_potf2_potrf(bool STRIDED,
+                                            bool POTRF,
+                                            rocblas_handle handle,
+                                            rocblas_fill uplo,
+                                            int64_t n,
+                                            double* A,
+                                            int64_t lda,
+                                            rocblas_stride stA,
+                                            int64_t* info,
+                                            int64_t batch_count)
+{
+    if(STRIDED)
+        return POTRF ? rocsolver_dpotrf_strided_batched_64(handle, uplo, n, A, lda, stA, info,
+                                                            batch_count)
+                     : rocblas_status_not_implemented;
+    else
+        return POTRF ? rocsolver_dpotrf_64(handle, uplo, n, A, lda, info)
+                     : rocblas_status_not_implemented;
+}
+
+inline rocblas_status rocsolver_potf2_potrf(bool STRIDED,
+                                            bool POTRF,
+                                            rocblas_handle handle,
+                                            rocblas_fill uplo,
+                                            int64_t n,
+                                            rocblas_float_complex* A,
+                                            int64_t lda,
+                                            rocblas_stride stA,
+                                            int64_t* info,
+                                            int64_t batch_count)
+{
+    if(STRIDED)
+        return POTRF ? rocsolver_cpotrf_strided_batched_64(handle, uplo, n, A, lda, stA, info,
+                                                            batch_count)
+                     : rocblas_status_not_implemented;
+    else
+        return POTRF ? rocsolver_cpotrf_64(handle, uplo, n, A, lda, info)
+                     : rocblas_status_not_implemented;
+}
+
+inline rocblas_status rocsolver_potf2_potrf(bool STRIDED,
+                                            bool POTRF,
+                                            rocblas_handle handle,
+                                            rocblas_fill uplo,
+                                            int64_t n,
+                                            rocblas_double_complex* A,
+                                            int64_t lda,
+                                            rocblas_stride stA,
+                                            int64_t* info,
+                                            int64_t batch_count)
+{
+    if(STRIDED)
+        return POTRF ? rocsolver_zpotrf_strided_batched_64(handle, uplo, n, A, lda, stA, info,
+                                                            batch_count)
+                     : rocblas_status_not_implemented;
+    else
+        return POTRF ? rocsolver_zpotrf_64(handle, uplo, n, A, lda, info)
+                     : rocblas_status_not_implemented;
+}
+
 // batched
 inline rocblas_status rocsolver_potf2_potrf(bool STRIDED,
                                             bool POTRF,
@@ -2632,6 +2980,355 @@ inline rocblas_status rocsolver_potf2_potrf(bool STRIDED,
     return POTRF ? rocsolver_zpotrf_batched(handle, uplo, n, A, lda, info, batch_count)
                  : rocsolver_zpotf2_batched(handle, uplo, n, A, lda, info, batch_count);
 }
+
+inline rocblas_status rocsolver_potf2_potrf(bool STRIDED,
+                                            bool POTRF,
+                                            rocblas_handle handle,
+                                            rocblas_fill uplo,
+                                            int64_t n,
+                                            float* const A[],
+                                            int64_t lda,
+                                            rocblas_stride stA,
+                                            int64_t* info,
+                                            int64_t batch_count)
+{
+    return POTRF ? rocsolver_spotrf_batched_64(handle, uplo, n, A, lda, info, batch_count)
+                 : rocblas_status_not_implemented;
+}
+
+inline rocblas_status rocsolver_potf2_potrf(bool STRIDED,
+                                            bool POTRF,
+                                            rocblas_handle handle,
+                                            rocblas_fill uplo,
+                                            int64_t n,
+                                            double* const A[],
+                                            int64_t lda,
+                                            rocblas_stride stA,
+                                            int64_t* info,
+                                            int64_t batch_count)
+{
+    return POTRF ? rocsolver_dpotrf_batched_64(handle, uplo, n, A, lda, info, batch_count)
+                 : rocblas_status_not_implemented;
+}
+
+inline rocblas_status rocsolver_potf2_potrf(bool STRIDED,
+                                            bool POTRF,
+                                            rocblas_handle handle,
+                                            rocblas_fill uplo,
+                                            int64_t n,
+                                            rocblas_float_complex* const A[],
+                                            int64_t lda,
+                                            rocblas_stride stA,
+                                            int64_t* info,
+                                            int64_t batch_count)
+{
+    return POTRF ? rocsolver_cpotrf_batched_64(handle, uplo, n, A, lda, info, batch_count)
+                 : rocblas_status_not_implemented;
+}
+
+inline rocblas_status rocsolver_potf2_potrf(bool STRIDED,
+                                            bool POTRF,
+                                            rocblas_handle handle,
+                                            rocblas_fill uplo,
+                                            int64_t n,
+                                            rocblas_double_complex* const A[],
+                                            int64_t lda,
+                                            rocblas_stride stA,
+                                            int64_t* info,
+                                            int64_t batch_count)
+{
+    return POTRF ? rocsolver_zpotrf_batched_64(handle, uplo, n, A, lda, info, batch_count)
+                 : rocblas_status_not_implemented;
+}
+/********************************************************/
+
+/******************** POTRF_INTERLEAVED ********************/
+inline rocblas_status rocsolver_potrf_interleaved(rocblas_handle handle,
+                                                  rocblas_fill uplo,
+                                                  rocblas_int n,
+                                                  float* A,
+                                                  rocblas_int inca,
+                                                  rocblas_int lda,
+                                                  rocblas_stride stA,
+                                                  rocblas_int* info,
+                                                  rocblas_int bc)
+{
+    return rocsolver_spotrf_interleaved_batched(handle, uplo, n, A, inca, lda, stA, info, bc);
+}
+
+inline rocblas_status rocsolver_potrf_interleaved(rocblas_handle handle,
+                                                  rocblas_fill uplo,
+                                                  rocblas_int n,
+                                                  double* A,
+                                                  rocblas_int inca,
+                                                  rocblas_int lda,
+                                                  rocblas_stride stA,
+                                                  rocblas_int* info,
+                                                  rocblas_int bc)
+{
+    return rocsolver_dpotrf_interleaved_batched(handle, uplo, n, A, inca, lda, stA, info, bc);
+}
+
+inline rocblas_status rocsolver_potrf_interleaved(rocblas_handle handle,
+                                                  rocblas_fill uplo,
+                                                  rocblas_int n,
+                                                  rocblas_float_complex* A,
+                                                  rocblas_int inca,
+                                                  rocblas_int lda,
+                                                  rocblas_stride stA,
+                                                  rocblas_int* info,
+                                                  rocblas_int bc)
+{
+    return rocsolver_cpotrf_interleaved_batched(handle, uplo, n, A, inca, lda, stA, info, bc);
+}
+
+inline rocblas_status rocsolver_potrf_interleaved(rocblas_handle handle,
+                                                  rocblas_fill uplo,
+                                                  rocblas_int n,
+                                                  rocblas_double_complex* A,
+                                                  rocblas_int inca,
+                                                  rocblas_int lda,
+                                                  rocblas_stride stA,
+                                                  rocblas_int* info,
+                                                  rocblas_int bc)
+{
+    return rocsolver_zpotrf_interleaved_batched(handle, uplo, n, A, inca, lda, stA, info, bc);
+}
+/********************************************************/
+
+/******************** POTRF_VBATCHED ********************/
+inline rocblas_status rocsolver_potrf_vbatched(rocblas_handle handle,
+                                               rocblas_fill uplo,
+                                               rocblas_int* n,
+                                               float* const A[],
+                                               rocblas_int* lda,
+                                               rocblas_int* info,
+                                               rocblas_int bc)
+{
+    return rocsolver_spotrf_vbatched(handle, uplo, n, A, lda, info, bc);
+}
+
+inline rocblas_status rocsolver_potrf_vbatched(rocblas_handle handle,
+                                               rocblas_fill uplo,
+                                               rocblas_int* n,
+                                               double* const A[],
+                                               rocblas_int* lda,
+                                               rocblas_int* info,
+                                               rocblas_int bc)
+{
+    return rocsolver_dpotrf_vbatched(handle, uplo, n, A, lda, info, bc);
+}
+
+inline rocblas_status rocsolver_potrf_vbatched(rocblas_handle handle,
+                                               rocblas_fill uplo,
+                                               rocblas_int* n,
+                                               rocblas_float_complex* const A[],
+                                               rocblas_int* lda,
+                                               rocblas_int* info,
+                                               rocblas_int bc)
+{
+    return rocsolver_cpotrf_vbatched(handle, uplo, n, A, lda, info, bc);
+}
+
+inline rocblas_status rocsolver_potrf_vbatched(rocblas_handle handle,
+                                               rocblas_fill uplo,
+                                               rocblas_int* n,
+                                               rocblas_double_complex* const A[],
+                                               rocblas_int* lda,
+                                               rocblas_int* info,
+                                               rocblas_int bc)
+{
+    return rocsolver_zpotrf_vbatched(handle, uplo, n, A, lda, info, bc);
+}
+/********************************************************/
+
+/******************** POTRF_UPDATE ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_potrf_update(bool STRIDED,
+                                             bool DOWNDATE,
+                                             rocblas_handle handle,
+                                             rocblas_fill uplo,
+                                             rocblas_int n,
+                                             rocblas_int k,
+                                             float* A,
+                                             rocblas_int lda,
+                                             rocblas_stride stA,
+                                             float* X,
+                                             rocblas_int ldx,
+                                             rocblas_stride stX,
+                                             rocblas_int* info,
+                                             rocblas_int batch_count)
+{
+    if(STRIDED)
+        return DOWNDATE
+            ? rocsolver_spotrf_downdate_strided_batched(handle, uplo, n, k, A, lda, stA, X, ldx,
+                                                        stX, info, batch_count)
+            : rocsolver_spotrf_update_strided_batched(handle, uplo, n, k, A, lda, stA, X, ldx, stX,
+                                                      info, batch_count);
+    else
+        return DOWNDATE ? rocsolver_spotrf_downdate(handle, uplo, n, k, A, lda, X, ldx, info)
+                        : rocsolver_spotrf_update(handle, uplo, n, k, A, lda, X, ldx, info);
+}
+
+inline rocblas_status rocsolver_potrf_update(bool STRIDED,
+                                             bool DOWNDATE,
+                                             rocblas_handle handle,
+                                             rocblas_fill uplo,
+                                             rocblas_int n,
+                                             rocblas_int k,
+                                             double* A,
+                                             rocblas_int lda,
+                                             rocblas_stride stA,
+                                             double* X,
+                                             rocblas_int ldx,
+                                             rocblas_stride stX,
+                                             rocblas_int* info,
+                                             rocblas_int batch_count)
+{
+    if(STRIDED)
+        return DOWNDATE
+            ? rocsolver_dpotrf_downdate_strided_batched(handle, uplo, n, k, A, lda, stA, X, ldx,
+                                                        stX, info, batch_count)
+            : rocsolver_dpotrf_update_strided_batched(handle, uplo, n, k, A, lda, stA, X, ldx, stX,
+                                                      info, batch_count);
+    else
+        return DOWNDATE ? rocsolver_dpotrf_downdate(handle, uplo, n, k, A, lda, X, ldx, info)
+                        : rocsolver_dpotrf_update(handle, uplo, n, k, A, lda, X, ldx, info);
+}
+
+inline rocblas_status rocsolver_potrf_update(bool STRIDED,
+                                             bool DOWNDATE,
+                                             rocblas_handle handle,
+                                             rocblas_fill uplo,
+                                             rocblas_int n,
+                                             rocblas_int k,
+                                             rocblas_float_complex* A,
+                                             rocblas_int lda,
+                                             rocblas_stride stA,
+                                             rocblas_float_complex* X,
+                                             rocblas_int ldx,
+                                             rocblas_stride stX,
+                                             rocblas_int* info,
+                                             rocblas_int batch_count)
+{
+    if(STRIDED)
+        return DOWNDATE
+            ? rocsolver_cpotrf_downdate_strided_batched(handle, uplo, n, k, A, lda, stA, X, ldx,
+                                                        stX, info, batch_count)
+            : rocsolver_cpotrf_update_strided_batched(handle, uplo, n, k, A, lda, stA, X, ldx, stX,
+                                                      info, batch_count);
+    else
+        return DOWNDATE ? rocsolver_cpotrf_downdate(handle, uplo, n, k, A, lda, X, ldx, info)
+                        : rocsolver_cpotrf_update(handle, uplo, n, k, A, lda, X, ldx, info);
+}
+
+inline rocblas_status rocsolver_potrf_update(bool STRIDED,
+                                             bool DOWNDATE,
+                                             rocblas_handle handle,
+                                             rocblas_fill uplo,
+                                             rocblas_int n,
+                                             rocblas_int k,
+                                             rocblas_double_complex* A,
+                                             rocblas_int lda,
+                                             rocblas_stride stA,
+                                             rocblas_double_complex* X,
+                                             rocblas_int ldx,
+                                             rocblas_stride stX,
+                                             rocblas_int* info,
+                                             rocblas_int batch_count)
+{
+    if(STRIDED)
+        return DOWNDATE
+            ? rocsolver_zpotrf_downdate_strided_batched(handle, uplo, n, k, A, lda, stA, X, ldx,
+                                                        stX, info, batch_count)
+            : rocsolver_zpotrf_update_strided_batched(handle, uplo, n, k, A, lda, stA, X, ldx, stX,
+                                                      info, batch_count);
+    else
+        return DOWNDATE ? rocsolver_zpotrf_downdate(handle, uplo, n, k, A, lda, X, ldx, info)
+                        : rocsolver_zpotrf_update(handle, uplo, n, k, A, lda, X, ldx, info);
+}
+
+// batched
+inline rocblas_status rocsolver_potrf_update(bool STRIDED,
+                                             bool DOWNDATE,
+                                             rocblas_handle handle,
+                                             rocblas_fill uplo,
+                                             rocblas_int n,
+                                             rocblas_int k,
+                                             float* const A[],
+                                             rocblas_int lda,
+                                             rocblas_stride stA,
+                                             float* const X[],
+                                             rocblas_int ldx,
+                                             rocblas_stride stX,
+                                             rocblas_int* info,
+                                             rocblas_int batch_count)
+{
+    return DOWNDATE
+        ? rocsolver_spotrf_downdate_batched(handle, uplo, n, k, A, lda, X, ldx, info, batch_count)
+        : rocsolver_spotrf_update_batched(handle, uplo, n, k, A, lda, X, ldx, info, batch_count);
+}
+
+inline rocblas_status rocsolver_potrf_update(bool STRIDED,
+                                             bool DOWNDATE,
+                                             rocblas_handle handle,
+                                             rocblas_fill uplo,
+                                             rocblas_int n,
+                                             rocblas_int k,
+                                             double* const A[],
+                                             rocblas_int lda,
+                                             rocblas_stride stA,
+                                             double* const X[],
+                                             rocblas_int ldx,
+                                             rocblas_stride stX,
+                                             rocblas_int* info,
+                                             rocblas_int batch_count)
+{
+    return DOWNDATE
+        ? rocsolver_dpotrf_downdate_batched(handle, uplo, n, k, A, lda, X, ldx, info, batch_count)
+        : rocsolver_dpotrf_update_batched(handle, uplo, n, k, A, lda, X, ldx, info, batch_count);
+}
+
+inline rocblas_status rocsolver_potrf_update(bool STRIDED,
+                                             bool DOWNDATE,
+                                             rocblas_handle handle,
+                                             rocblas_fill uplo,
+                                             rocblas_int n,
+                                             rocblas_int k,
+                                             rocblas_float_complex* const A[],
+                                             rocblas_int lda,
+                                             rocblas_stride stA,
+                                             rocblas_float_complex* const X[],
+                                             rocblas_int ldx,
+                                             rocblas_stride stX,
+                                             rocblas_int* info,
+                                             rocblas_int batch_count)
+{
+    return DOWNDATE
+        ? rocsolver_cpotrf_downdate_batched(handle, uplo, n, k, A, lda, X, ldx, info, batch_count)
+        : rocsolver_cpotrf_update_batched(handle, uplo, n, k, A, lda, X, ldx, info, batch_count);
+}
+
+inline rocblas_status rocsolver_potrf_update(bool STRIDED,
+                                             bool DOWNDATE,
+                                             rocblas_handle handle,
+                                             rocblas_fill uplo,
+                                             rocblas_int n,
+                                             rocblas_int k,
+                                             rocblas_double_complex* const A[],
+                                             rocblas_int lda,
+                                             rocblas_stride stA,
+                                             rocblas_double_complex* const X[],
+                                             rocblas_int ldx,
+                                             rocblas_stride stX,
+                                             rocblas_int* info,
+                                             rocblas_int batch_count)
+{
+    return DOWNDATE
+        ? rocsolver_zpotrf_downdate_batched(handle, uplo, n, k, A, lda, X, ldx, info, batch_count)
+        : rocsolver_zpotrf_update_batched(handle, uplo, n, k, A, lda, X, ldx, info, batch_count);
+}
+
 /********************************************************/
 
 /******************** POTRS ********************/
@@ -2716,12 +3413,92 @@ inline rocblas_status rocsolver_potrs(bool STRIDED,
         return rocsolver_zpotrs(handle, uplo, n, nrhs, A, lda, B, ldb);
 }
 
-// batched
 inline rocblas_status rocsolver_potrs(bool STRIDED,
                                       rocblas_handle handle,
                                       rocblas_fill uplo,
-                                      rocblas_int n,
-                                      rocblas_int nrhs,
+                                      int64_t n,
+                                      int64_t nrhs,
+                                      float* A,
+                                      int64_t lda,
+                                      rocblas_stride stA,
+                                      float* B,
+                                      int64_t ldb,
+                                      rocblas_stride stB,
+                                      int64_t batch_count)
+{
+    if(STRIDED)
+        return rocsolver_spotrs_strided_batched_64(handle, uplo, n, nrhs, A, lda, stA, B, ldb,
+                                                    stB, batch_count);
+    else
+        return rocsolver_spotrs_64(handle, uplo, n, nrhs, A, lda, B, ldb);
+}
+
+inline rocblas_status rocsolver_potrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      int64_t n,
+                                      int64_t nrhs,
+                                      double* A,
+                                      int64_t lda,
+                                      rocblas_stride stA,
+                                      double* B,
+                                      int64_t ldb,
+                                      rocblas_stride stB,
+                                      int64_t batch_count)
+{
+    if(STRIDED)
+        return rocsolver_dpotrs_strided_batched_64(handle, uplo, n, nrhs, A, lda, stA, B, ldb,
+                                                    stB, batch_count);
+    else
+        return rocsolver_dpotrs_64(handle, uplo, n, nrhs, A, lda, B, ldb);
+}
+
+inline rocblas_status rocsolver_potrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      int64_t n,
+                                      int64_t nrhs,
+                                      rocblas_float_complex* A,
+                                      int64_t lda,
+                                      rocblas_stride stA,
+                                      rocblas_float_complex* B,
+                                      int64_t ldb,
+                                      rocblas_stride stB,
+                                      int64_t batch_count)
+{
+    if(STRIDED)
+        return rocsolver_cpotrs_strided_batched_64(handle, uplo, n, nrhs, A, lda, stA, B, ldb,
+                                                    stB, batch_count);
+    else
+        return rocsolver_cpotrs_64(handle, uplo, n, nrhs, A, lda, B, ldb);
+}
+
+inline rocblas_status rocsolver_potrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      int64_t n,
+                                      int64_t nrhs,
+                                      rocblas_double_complex* A,
+                                      int64_t lda,
+                                      rocblas_stride stA,
+                                      rocblas_double_complex* B,
+                                      int64_t ldb,
+                                      rocblas_stride stB,
+                                      int64_t batch_count)
+{
+    if(STRIDED)
+        return rocsolver_zpotrs_strided_batched_64(handle, uplo, n, nrhs, A, lda, stA, B, ldb,
+                                                    stB, batch_count);
+    else
+        return rocsolver_zpotrs_64(handle, uplo, n, nrhs, A, lda, B, ldb);
+}
+
+// batched
+inline rocblas_status rocsolver_potrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
                                       float* const A[],
                                       rocblas_int lda,
                                       rocblas_stride stA,
@@ -2780,3617 +3557,6915 @@ inline rocblas_status rocsolver_potrs(bool STRIDED,
 {
     return rocsolver_zpotrs_batched(handle, uplo, n, nrhs, A, lda, B, ldb, batch_count);
 }
+
+inline rocblas_status rocsolver_potrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      int64_t n,
+                                      int64_t nrhs,
+                                      float* const A[],
+                                      int64_t lda,
+                                      rocblas_stride stA,
+                                      float* const B[],
+                                      int64_t ldb,
+                                      rocblas_stride stB,
+                                      int64_t batch_count)
+{
+    return rocsolver_spotrs_batched_64(handle, uplo, n, nrhs, A, lda, B, ldb, batch_count);
+}
+
+inline rocblas_status rocsolver_potrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      int64_t n,
+                                      int64_t nrhs,
+                                      double* const A[],
+                                      int64_t lda,
+                                      rocblas_stride stA,
+                                      double* const B[],
+                                      int64_t ldb,
+                                      rocblas_stride stB,
+                                      int64_t batch_count)
+{
+    return rocsolver_dpotrs_batched_64(handle, uplo, n, nrhs, A, lda, B, ldb, batch_count);
+}
+
+inline rocblas_status rocsolver_potrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      int64_t n,
+                                      int64_t nrhs,
+                                      rocblas_float_complex* const A[],
+                                      int64_t lda,
+                                      rocblas_stride stA,
+                                      rocblas_float_complex* const B[],
+                                      int64_t ldb,
+                                      rocblas_stride stB,
+                                      int64_t batch_count)
+{
+    return rocsolver_cpotrs_batched_64(handle, uplo, n, nrhs, A, lda, B, ldb, batch_count);
+}
+
+inline rocblas_status rocsolver_potrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      int64_t n,
+                                      int64_t nrhs,
+                                      rocblas_double_complex* const A[],
+                                      int64_t lda,
+                                      rocblas_stride stA,
+                                      rocblas_double_complex* const B[],
+                                      int64_t ldb,
+                                      rocblas_stride stB,
+                                      int64_t batch_count)
+{
+    return rocsolver_zpotrs_batched_64(handle, uplo, n, nrhs, A, lda, B, ldb, batch_count);
+}
 /********************************************************/
 
-/******************** POSV ********************/
+/******************** POTRS_INTERLEAVED ********************/
+inline rocblas_status rocsolver_potrs_interleaved(rocblas_handle handle,
+                                                  rocblas_fill uplo,
+                                                  rocblas_int n,
+                                                  rocblas_int nrhs,
+                                                  float* A,
+                                                  rocblas_int inca,
+                                                  rocblas_int lda,
+                                                  rocblas_stride stA,
+                                                  float* B,
+                                                  rocblas_int incb,
+                                                  rocblas_int ldb,
+                                                  rocblas_stride stB,
+                                                  rocblas_int bc)
+{
+    return rocsolver_spotrs_interleaved_batched(handle, uplo, n, nrhs, A, inca, lda, stA, B, incb,
+                                                ldb, stB, bc);
+}
+
+inline rocblas_status rocsolver_potrs_interleaved(rocblas_handle handle,
+                                                  rocblas_fill uplo,
+                                                  rocblas_int n,
+                                                  rocblas_int nrhs,
+                                                  double* A,
+                                                  rocblas_int inca,
+                                                  rocblas_int lda,
+                                                  rocblas_stride stA,
+                                                  double* B,
+                                                  rocblas_int incb,
+                                                  rocblas_int ldb,
+                                                  rocblas_stride stB,
+                                                  rocblas_int bc)
+{
+    return rocsolver_dpotrs_interleaved_batched(handle, uplo, n, nrhs, A, inca, lda, stA, B, incb,
+                                                ldb, stB, bc);
+}
+
+inline rocblas_status rocsolver_potrs_interleaved(rocblas_handle handle,
+                                                  rocblas_fill uplo,
+                                                  rocblas_int n,
+                                                  rocblas_int nrhs,
+                                                  rocblas_float_complex* A,
+                                                  rocblas_int inca,
+                                                  rocblas_int lda,
+                                                  rocblas_stride stA,
+                                                  rocblas_float_complex* B,
+                                                  rocblas_int incb,
+                                                  rocblas_int ldb,
+                                                  rocblas_stride stB,
+                                                  rocblas_int bc)
+{
+    return rocsolver_cpotrs_interleaved_batched(handle, uplo, n, nrhs, A, inca, lda, stA, B, incb,
+                                                ldb, stB, bc);
+}
+
+inline rocblas_status rocsolver_potrs_interleaved(rocblas_handle handle,
+                                                  rocblas_fill uplo,
+                                                  rocblas_int n,
+                                                  rocblas_int nrhs,
+                                                  rocblas_double_complex* A,
+                                                  rocblas_int inca,
+                                                  rocblas_int lda,
+                                                  rocblas_stride stA,
+                                                  rocblas_double_complex* B,
+                                                  rocblas_int incb,
+                                                  rocblas_int ldb,
+                                                  rocblas_stride stB,
+                                                  rocblas_int bc)
+{
+    return rocsolver_zpotrs_interleaved_batched(handle, uplo, n, nrhs, A, inca, lda, stA, B, incb,
+                                                ldb, stB, bc);
+}
+/********************************************************/
+
+/******************** POTRS_VBATCHED ********************/
+inline rocblas_status rocsolver_potrs_vbatched(rocblas_handle handle,
+                                               rocblas_fill uplo,
+                                               rocblas_int* n,
+                                               rocblas_int* nrhs,
+                                               float* const A[],
+                                               rocblas_int* lda,
+                                               float* const B[],
+                                               rocblas_int* ldb,
+                                               rocblas_int bc)
+{
+    return rocsolver_spotrs_vbatched(handle, uplo, n, nrhs, A, lda, B, ldb, bc);
+}
+
+inline rocblas_status rocsolver_potrs_vbatched(rocblas_handle handle,
+                                               rocblas_fill uplo,
+                                               rocblas_int* n,
+                                               rocblas_int* nrhs,
+                                               double* const A[],
+                                               rocblas_int* lda,
+                                               double* const B[],
+                                               rocblas_int* ldb,
+                                               rocblas_int bc)
+{
+    return rocsolver_dpotrs_vbatched(handle, uplo, n, nrhs, A, lda, B, ldb, bc);
+}
+
+inline rocblas_status rocsolver_potrs_vbatched(rocblas_handle handle,
+                                               rocblas_fill uplo,
+                                               rocblas_int* n,
+                                               rocblas_int* nrhs,
+                                               rocblas_float_complex* const A[],
+                                               rocblas_int* lda,
+                                               rocblas_float_complex* const B[],
+                                               rocblas_int* ldb,
+                                               rocblas_int bc)
+{
+    return rocsolver_cpotrs_vbatched(handle, uplo, n, nrhs, A, lda, B, ldb, bc);
+}
+
+inline rocblas_status rocsolver_potrs_vbatched(rocblas_handle handle,
+                                               rocblas_fill uplo,
+                                               rocblas_int* n,
+                                               rocblas_int* nrhs,
+                                               rocblas_double_complex* const A[],
+                                               rocblas_int* lda,
+                                               rocblas_double_complex* const B[],
+                                               rocblas_int* ldb,
+                                               rocblas_int bc)
+{
+    return rocsolver_zpotrs_vbatched(handle, uplo, n, nrhs, A, lda, B, ldb, bc);
+}
+/********************************************************/
+
+/******************** GBTRF ********************/
 // normal and strided_batched
-inline rocblas_status rocsolver_posv(bool STRIDED,
-                                     rocblas_handle handle,
-                                     rocblas_fill uplo,
-                                     rocblas_int n,
-                                     rocblas_int nrhs,
-                                     float* A,
-                                     rocblas_int lda,
-                                     rocblas_stride stA,
-                                     float* B,
-                                     rocblas_int ldb,
-                                     rocblas_stride stB,
-                                     rocblas_int* info,
-                                     rocblas_int batch_count)
+inline rocblas_status rocsolver_gbtrf(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int kl,
+                                      rocblas_int ku,
+                                      float* AB,
+                                      rocblas_int ldab,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_int* info,
+                                      rocblas_int batch_count)
 {
     if(STRIDED)
-        return rocsolver_sposv_strided_batched(handle, uplo, n, nrhs, A, lda, stA, B, ldb, stB,
-                                               info, batch_count);
+        return rocsolver_sgbtrf_strided_batched(handle, m, n, kl, ku, AB, ldab, stA, ipiv, stP,
+                                                info, batch_count);
     else
-        return rocsolver_sposv(handle, uplo, n, nrhs, A, lda, B, ldb, info);
+        return rocsolver_sgbtrf(handle, m, n, kl, ku, AB, ldab, ipiv, info);
 }
 
-inline rocblas_status rocsolver_posv(bool STRIDED,
-                                     rocblas_handle handle,
-                                     rocblas_fill uplo,
-                                     rocblas_int n,
-                                     rocblas_int nrhs,
-                                     double* A,
-                                     rocblas_int lda,
-                                     rocblas_stride stA,
-                                     double* B,
-                                     rocblas_int ldb,
-                                     rocblas_stride stB,
-                                     rocblas_int* info,
-                                     rocblas_int batch_count)
+inline rocblas_status rocsolver_gbtrf(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int kl,
+                                      rocblas_int ku,
+                                      double* AB,
+                                      rocblas_int ldab,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_int* info,
+                                      rocblas_int batch_count)
 {
     if(STRIDED)
-        return rocsolver_dposv_strided_batched(handle, uplo, n, nrhs, A, lda, stA, B, ldb, stB,
-                                               info, batch_count);
+        return rocsolver_dgbtrf_strided_batched(handle, m, n, kl, ku, AB, ldab, stA, ipiv, stP,
+                                                info, batch_count);
     else
-        return rocsolver_dposv(handle, uplo, n, nrhs, A, lda, B, ldb, info);
+        return rocsolver_dgbtrf(handle, m, n, kl, ku, AB, ldab, ipiv, info);
 }
 
-inline rocblas_status rocsolver_posv(bool STRIDED,
-                                     rocblas_handle handle,
-                                     rocblas_fill uplo,
-                                     rocblas_int n,
-                                     rocblas_int nrhs,
-                                     rocblas_float_complex* A,
-                                     rocblas_int lda,
-                                     rocblas_stride stA,
-                                     rocblas_float_complex* B,
-                                     rocblas_int ldb,
-                                     rocblas_stride stB,
-                                     rocblas_int* info,
-                                     rocblas_int batch_count)
+inline rocblas_status rocsolver_gbtrf(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int kl,
+                                      rocblas_int ku,
+                                      rocblas_float_complex* AB,
+                                      rocblas_int ldab,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_int* info,
+                                      rocblas_int batch_count)
 {
     if(STRIDED)
-        return rocsolver_cposv_strided_batched(handle, uplo, n, nrhs, A, lda, stA, B, ldb, stB,
-                                               info, batch_count);
+        return rocsolver_cgbtrf_strided_batched(handle, m, n, kl, ku, AB, ldab, stA, ipiv, stP,
+                                                info, batch_count);
     else
-        return rocsolver_cposv(handle, uplo, n, nrhs, A, lda, B, ldb, info);
+        return rocsolver_cgbtrf(handle, m, n, kl, ku, AB, ldab, ipiv, info);
 }
 
-inline rocblas_status rocsolver_posv(bool STRIDED,
-                                     rocblas_handle handle,
-                                     rocblas_fill uplo,
-                                     rocblas_int n,
-                                     rocblas_int nrhs,
-                                     rocblas_double_complex* A,
-                                     rocblas_int lda,
-                                     rocblas_stride stA,
-                                     rocblas_double_complex* B,
-                                     rocblas_int ldb,
-                                     rocblas_stride stB,
-                                     rocblas_int* info,
-                                     rocblas_int batch_count)
+inline rocblas_status rocsolver_gbtrf(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int kl,
+                                      rocblas_int ku,
+                                      rocblas_double_complex* AB,
+                                      rocblas_int ldab,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_int* info,
+                                      rocblas_int batch_count)
 {
     if(STRIDED)
-        return rocsolver_zposv_strided_batched(handle, uplo, n, nrhs, A, lda, stA, B, ldb, stB,
-                                               info, batch_count);
+        return rocsolver_zgbtrf_strided_batched(handle, m, n, kl, ku, AB, ldab, stA, ipiv, stP,
+                                                info, batch_count);
     else
-        return rocsolver_zposv(handle, uplo, n, nrhs, A, lda, B, ldb, info);
+        return rocsolver_zgbtrf(handle, m, n, kl, ku, AB, ldab, ipiv, info);
 }
 
 // batched
-inline rocblas_status rocsolver_posv(bool STRIDED,
-                                     rocblas_handle handle,
-                                     rocblas_fill uplo,
-                                     rocblas_int n,
-                                     rocblas_int nrhs,
-                                     float* const A[],
-                                     rocblas_int lda,
-                                     rocblas_stride stA,
-                                     float* const B[],
-                                     rocblas_int ldb,
-                                     rocblas_stride stB,
-                                     rocblas_int* info,
-                                     rocblas_int batch_count)
+inline rocblas_status rocsolver_gbtrf(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int kl,
+                                      rocblas_int ku,
+                                      float* const AB[],
+                                      rocblas_int ldab,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_int* info,
+                                      rocblas_int batch_count)
 {
-    return rocsolver_sposv_batched(handle, uplo, n, nrhs, A, lda, B, ldb, info, batch_count);
+    return rocsolver_sgbtrf_batched(handle, m, n, kl, ku, AB, ldab, ipiv, stP, info, batch_count);
 }
 
-inline rocblas_status rocsolver_posv(bool STRIDED,
-                                     rocblas_handle handle,
-                                     rocblas_fill uplo,
-                                     rocblas_int n,
-                                     rocblas_int nrhs,
-                                     double* const A[],
-                                     rocblas_int lda,
-                                     rocblas_stride stA,
-                                     double* const B[],
-                                     rocblas_int ldb,
-                                     rocblas_stride stB,
-                                     rocblas_int* info,
-                                     rocblas_int batch_count)
+inline rocblas_status rocsolver_gbtrf(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int kl,
+                                      rocblas_int ku,
+                                      double* const AB[],
+                                      rocblas_int ldab,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_int* info,
+                                      rocblas_int batch_count)
 {
-    return rocsolver_dposv_batched(handle, uplo, n, nrhs, A, lda, B, ldb, info, batch_count);
+    return rocsolver_dgbtrf_batched(handle, m, n, kl, ku, AB, ldab, ipiv, stP, info, batch_count);
 }
 
-inline rocblas_status rocsolver_posv(bool STRIDED,
-                                     rocblas_handle handle,
-                                     rocblas_fill uplo,
-                                     rocblas_int n,
-                                     rocblas_int nrhs,
-                                     rocblas_float_complex* const A[],
-                                     rocblas_int lda,
-                                     rocblas_stride stA,
-                                     rocblas_float_complex* const B[],
-                                     rocblas_int ldb,
-                                     rocblas_stride stB,
-                                     rocblas_int* info,
-                                     rocblas_int batch_count)
+inline rocblas_status rocsolver_gbtrf(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int kl,
+                                      rocblas_int ku,
+                                      rocblas_float_complex* const AB[],
+                                      rocblas_int ldab,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_int* info,
+                                      rocblas_int batch_count)
 {
-    return rocsolver_cposv_batched(handle, uplo, n, nrhs, A, lda, B, ldb, info, batch_count);
+    return rocsolver_cgbtrf_batched(handle, m, n, kl, ku, AB, ldab, ipiv, stP, info, batch_count);
 }
 
-inline rocblas_status rocsolver_posv(bool STRIDED,
-                                     rocblas_handle handle,
-                                     rocblas_fill uplo,
-                                     rocblas_int n,
-                                     rocblas_int nrhs,
-                                     rocblas_double_complex* const A[],
-                                     rocblas_int lda,
-                                     rocblas_stride stA,
-                                     rocblas_double_complex* const B[],
-                                     rocblas_int ldb,
-                                     rocblas_stride stB,
-                                     rocblas_int* info,
-                                     rocblas_int batch_count)
+inline rocblas_status rocsolver_gbtrf(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int kl,
+                                      rocblas_int ku,
+                                      rocblas_double_complex* const AB[],
+                                      rocblas_int ldab,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_int* info,
+                                      rocblas_int batch_count)
 {
-    return rocsolver_zposv_batched(handle, uplo, n, nrhs, A, lda, B, ldb, info, batch_count);
+    return rocsolver_zgbtrf_batched(handle, m, n, kl, ku, AB, ldab, ipiv, stP, info, batch_count);
 }
+
 /********************************************************/
 
-/******************** POTRI ********************/
+/******************** GBTRS ********************/
 // normal and strided_batched
-inline rocblas_status rocsolver_potri(bool STRIDED,
+inline rocblas_status rocsolver_gbtrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation trans,
+                                      rocblas_int n,
+                                      rocblas_int kl,
+                                      rocblas_int ku,
+                                      rocblas_int nrhs,
+                                      float* AB,
+                                      rocblas_int ldab,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      float* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int batch_count)
+{
+    if(STRIDED)
+        return rocsolver_sgbtrs_strided_batched(handle, trans, n, kl, ku, nrhs, AB, ldab, stA, ipiv,
+                                                stP, B, ldb, stB, batch_count);
+    else
+        return rocsolver_sgbtrs(handle, trans, n, kl, ku, nrhs, AB, ldab, ipiv, B, ldb);
+}
+
+inline rocblas_status rocsolver_gbtrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation trans,
+                                      rocblas_int n,
+                                      rocblas_int kl,
+                                      rocblas_int ku,
+                                      rocblas_int nrhs,
+                                      double* AB,
+                                      rocblas_int ldab,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      double* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int batch_count)
+{
+    if(STRIDED)
+        return rocsolver_dgbtrs_strided_batched(handle, trans, n, kl, ku, nrhs, AB, ldab, stA, ipiv,
+                                                stP, B, ldb, stB, batch_count);
+    else
+        return rocsolver_dgbtrs(handle, trans, n, kl, ku, nrhs, AB, ldab, ipiv, B, ldb);
+}
+
+inline rocblas_status rocsolver_gbtrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation trans,
+                                      rocblas_int n,
+                                      rocblas_int kl,
+                                      rocblas_int ku,
+                                      rocblas_int nrhs,
+                                      rocblas_float_complex* AB,
+                                      rocblas_int ldab,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_float_complex* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int batch_count)
+{
+    if(STRIDED)
+        return rocsolver_cgbtrs_strided_batched(handle, trans, n, kl, ku, nrhs, AB, ldab, stA, ipiv,
+                                                stP, B, ldb, stB, batch_count);
+    else
+        return rocsolver_cgbtrs(handle, trans, n, kl, ku, nrhs, AB, ldab, ipiv, B, ldb);
+}
+
+inline rocblas_status rocsolver_gbtrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation trans,
+                                      rocblas_int n,
+                                      rocblas_int kl,
+                                      rocblas_int ku,
+                                      rocblas_int nrhs,
+                                      rocblas_double_complex* AB,
+                                      rocblas_int ldab,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_double_complex* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int batch_count)
+{
+    if(STRIDED)
+        return rocsolver_zgbtrs_strided_batched(handle, trans, n, kl, ku, nrhs, AB, ldab, stA, ipiv,
+                                                stP, B, ldb, stB, batch_count);
+    else
+        return rocsolver_zgbtrs(handle, trans, n, kl, ku, nrhs, AB, ldab, ipiv, B, ldb);
+}
+
+// batched
+inline rocblas_status rocsolver_gbtrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation trans,
+                                      rocblas_int n,
+                                      rocblas_int kl,
+                                      rocblas_int ku,
+                                      rocblas_int nrhs,
+                                      float* const AB[],
+                                      rocblas_int ldab,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      float* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int batch_count)
+{
+    return rocsolver_sgbtrs_batched(handle, trans, n, kl, ku, nrhs, AB, ldab, ipiv, stP, B, ldb,
+                                    batch_count);
+}
+
+inline rocblas_status rocsolver_gbtrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation trans,
+                                      rocblas_int n,
+                                      rocblas_int kl,
+                                      rocblas_int ku,
+                                      rocblas_int nrhs,
+                                      double* const AB[],
+                                      rocblas_int ldab,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      double* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int batch_count)
+{
+    return rocsolver_dgbtrs_batched(handle, trans, n, kl, ku, nrhs, AB, ldab, ipiv, stP, B, ldb,
+                                    batch_count);
+}
+
+inline rocblas_status rocsolver_gbtrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation trans,
+                                      rocblas_int n,
+                                      rocblas_int kl,
+                                      rocblas_int ku,
+                                      rocblas_int nrhs,
+                                      rocblas_float_complex* const AB[],
+                                      rocblas_int ldab,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_float_complex* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int batch_count)
+{
+    return rocsolver_cgbtrs_batched(handle, trans, n, kl, ku, nrhs, AB, ldab, ipiv, stP, B, ldb,
+                                    batch_count);
+}
+
+inline rocblas_status rocsolver_gbtrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation trans,
+                                      rocblas_int n,
+                                      rocblas_int kl,
+                                      rocblas_int ku,
+                                      rocblas_int nrhs,
+                                      rocblas_double_complex* const AB[],
+                                      rocblas_int ldab,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_double_complex* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int batch_count)
+{
+    return rocsolver_zgbtrs_batched(handle, trans, n, kl, ku, nrhs, AB, ldab, ipiv, stP, B, ldb,
+                                    batch_count);
+}
+
+/********************************************************/
+
+/******************** PBTRF ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_pbtrf(bool STRIDED,
                                       rocblas_handle handle,
                                       rocblas_fill uplo,
                                       rocblas_int n,
-                                      float* A,
-                                      rocblas_int lda,
+                                      rocblas_int kd,
+                                      float* AB,
+                                      rocblas_int ldab,
                                       rocblas_stride stA,
                                       rocblas_int* info,
                                       rocblas_int batch_count)
 {
     if(STRIDED)
-        return rocsolver_spotri_strided_batched(handle, uplo, n, A, lda, stA, info, batch_count);
+        return rocsolver_spbtrf_strided_batched(handle, uplo, n, kd, AB, ldab, stA, info,
+                                                batch_count);
     else
-        return rocsolver_spotri(handle, uplo, n, A, lda, info);
+        return rocsolver_spbtrf(handle, uplo, n, kd, AB, ldab, info);
 }
 
-inline rocblas_status rocsolver_potri(bool STRIDED,
+inline rocblas_status rocsolver_pbtrf(bool STRIDED,
                                       rocblas_handle handle,
                                       rocblas_fill uplo,
                                       rocblas_int n,
-                                      double* A,
-                                      rocblas_int lda,
+                                      rocblas_int kd,
+                                      double* AB,
+                                      rocblas_int ldab,
                                       rocblas_stride stA,
                                       rocblas_int* info,
                                       rocblas_int batch_count)
 {
     if(STRIDED)
-        return rocsolver_dpotri_strided_batched(handle, uplo, n, A, lda, stA, info, batch_count);
+        return rocsolver_dpbtrf_strided_batched(handle, uplo, n, kd, AB, ldab, stA, info,
+                                                batch_count);
     else
-        return rocsolver_dpotri(handle, uplo, n, A, lda, info);
+        return rocsolver_dpbtrf(handle, uplo, n, kd, AB, ldab, info);
 }
 
-inline rocblas_status rocsolver_potri(bool STRIDED,
+inline rocblas_status rocsolver_pbtrf(bool STRIDED,
                                       rocblas_handle handle,
                                       rocblas_fill uplo,
                                       rocblas_int n,
-                                      rocblas_float_complex* A,
-                                      rocblas_int lda,
+                                      rocblas_int kd,
+                                      rocblas_float_complex* AB,
+                                      rocblas_int ldab,
                                       rocblas_stride stA,
                                       rocblas_int* info,
                                       rocblas_int batch_count)
 {
     if(STRIDED)
-        return rocsolver_cpotri_strided_batched(handle, uplo, n, A, lda, stA, info, batch_count);
+        return rocsolver_cpbtrf_strided_batched(handle, uplo, n, kd, AB, ldab, stA, info,
+                                                batch_count);
     else
-        return rocsolver_cpotri(handle, uplo, n, A, lda, info);
+        return rocsolver_cpbtrf(handle, uplo, n, kd, AB, ldab, info);
 }
 
-inline rocblas_status rocsolver_potri(bool STRIDED,
+inline rocblas_status rocsolver_pbtrf(bool STRIDED,
                                       rocblas_handle handle,
                                       rocblas_fill uplo,
                                       rocblas_int n,
-                                      rocblas_double_complex* A,
-                                      rocblas_int lda,
+                                      rocblas_int kd,
+                                      rocblas_double_complex* AB,
+                                      rocblas_int ldab,
                                       rocblas_stride stA,
                                       rocblas_int* info,
                                       rocblas_int batch_count)
 {
     if(STRIDED)
-        return rocsolver_zpotri_strided_batched(handle, uplo, n, A, lda, stA, info, batch_count);
+        return rocsolver_zpbtrf_strided_batched(handle, uplo, n, kd, AB, ldab, stA, info,
+                                                batch_count);
     else
-        return rocsolver_zpotri(handle, uplo, n, A, lda, info);
+        return rocsolver_zpbtrf(handle, uplo, n, kd, AB, ldab, info);
 }
 
 // batched
-inline rocblas_status rocsolver_potri(bool STRIDED,
+inline rocblas_status rocsolver_pbtrf(bool STRIDED,
                                       rocblas_handle handle,
                                       rocblas_fill uplo,
                                       rocblas_int n,
-                                      float* const A[],
-                                      rocblas_int lda,
+                                      rocblas_int kd,
+                                      float* const AB[],
+                                      rocblas_int ldab,
                                       rocblas_stride stA,
                                       rocblas_int* info,
                                       rocblas_int batch_count)
 {
-    return rocsolver_spotri_batched(handle, uplo, n, A, lda, info, batch_count);
+    return rocsolver_spbtrf_batched(handle, uplo, n, kd, AB, ldab, info, batch_count);
 }
 
-inline rocblas_status rocsolver_potri(bool STRIDED,
+inline rocblas_status rocsolver_pbtrf(bool STRIDED,
                                       rocblas_handle handle,
                                       rocblas_fill uplo,
                                       rocblas_int n,
-                                      double* const A[],
-                                      rocblas_int lda,
+                                      rocblas_int kd,
+                                      double* const AB[],
+                                      rocblas_int ldab,
                                       rocblas_stride stA,
                                       rocblas_int* info,
                                       rocblas_int batch_count)
 {
-    return rocsolver_dpotri_batched(handle, uplo, n, A, lda, info, batch_count);
+    return rocsolver_dpbtrf_batched(handle, uplo, n, kd, AB, ldab, info, batch_count);
 }
 
-inline rocblas_status rocsolver_potri(bool STRIDED,
+inline rocblas_status rocsolver_pbtrf(bool STRIDED,
                                       rocblas_handle handle,
                                       rocblas_fill uplo,
                                       rocblas_int n,
-                                      rocblas_float_complex* const A[],
-                                      rocblas_int lda,
+                                      rocblas_int kd,
+                                      rocblas_float_complex* const AB[],
+                                      rocblas_int ldab,
                                       rocblas_stride stA,
                                       rocblas_int* info,
                                       rocblas_int batch_count)
 {
-    return rocsolver_cpotri_batched(handle, uplo, n, A, lda, info, batch_count);
+    return rocsolver_cpbtrf_batched(handle, uplo, n, kd, AB, ldab, info, batch_count);
 }
 
-inline rocblas_status rocsolver_potri(bool STRIDED,
+inline rocblas_status rocsolver_pbtrf(bool STRIDED,
                                       rocblas_handle handle,
                                       rocblas_fill uplo,
                                       rocblas_int n,
-                                      rocblas_double_complex* const A[],
-                                      rocblas_int lda,
+                                      rocblas_int kd,
+                                      rocblas_double_complex* const AB[],
+                                      rocblas_int ldab,
                                       rocblas_stride stA,
                                       rocblas_int* info,
                                       rocblas_int batch_count)
 {
-    return rocsolver_zpotri_batched(handle, uplo, n, A, lda, info, batch_count);
+    return rocsolver_zpbtrf_batched(handle, uplo, n, kd, AB, ldab, info, batch_count);
 }
+
 /********************************************************/
 
-/******************** GETF2_GETRF_NPVT ********************/
+/******************** PBTRS ********************/
 // normal and strided_batched
-inline rocblas_status rocsolver_getf2_getrf_npvt(bool STRIDED,
-                                                 bool GETRF,
-                                                 rocblas_handle handle,
-                                                 rocblas_int m,
-                                                 rocblas_int n,
-                                                 float* A,
-                                                 rocblas_int lda,
-                                                 rocblas_stride stA,
-                                                 rocblas_int* info,
-                                                 rocblas_int bc)
+inline rocblas_status rocsolver_pbtrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int kd,
+                                      rocblas_int nrhs,
+                                      float* AB,
+                                      rocblas_int ldab,
+                                      rocblas_stride stA,
+                                      float* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int batch_count)
 {
     if(STRIDED)
-        return GETRF ? rocsolver_sgetrf_npvt_strided_batched(handle, m, n, A, lda, stA, info, bc)
-                     : rocsolver_sgetf2_npvt_strided_batched(handle, m, n, A, lda, stA, info, bc);
+        return rocsolver_spbtrs_strided_batched(handle, uplo, n, kd, nrhs, AB, ldab, stA, B, ldb,
+                                                stB, batch_count);
     else
-        return GETRF ? rocsolver_sgetrf_npvt(handle, m, n, A, lda, info)
-                     : rocsolver_sgetf2_npvt(handle, m, n, A, lda, info);
+        return rocsolver_spbtrs(handle, uplo, n, kd, nrhs, AB, ldab, B, ldb);
 }
 
-inline rocblas_status rocsolver_getf2_getrf_npvt(bool STRIDED,
-                                                 bool GETRF,
-                                                 rocblas_handle handle,
-                                                 rocblas_int m,
-                                                 rocblas_int n,
-                                                 double* A,
-                                                 rocblas_int lda,
-                                                 rocblas_stride stA,
-                                                 rocblas_int* info,
-                                                 rocblas_int bc)
+inline rocblas_status rocsolver_pbtrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int kd,
+                                      rocblas_int nrhs,
+                                      double* AB,
+                                      rocblas_int ldab,
+                                      rocblas_stride stA,
+                                      double* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int batch_count)
 {
     if(STRIDED)
-        return GETRF ? rocsolver_dgetrf_npvt_strided_batched(handle, m, n, A, lda, stA, info, bc)
-                     : rocsolver_dgetf2_npvt_strided_batched(handle, m, n, A, lda, stA, info, bc);
+        return rocsolver_dpbtrs_strided_batched(handle, uplo, n, kd, nrhs, AB, ldab, stA, B, ldb,
+                                                stB, batch_count);
     else
-        return GETRF ? rocsolver_dgetrf_npvt(handle, m, n, A, lda, info)
-                     : rocsolver_dgetf2_npvt(handle, m, n, A, lda, info);
+        return rocsolver_dpbtrs(handle, uplo, n, kd, nrhs, AB, ldab, B, ldb);
 }
 
-inline rocblas_status rocsolver_getf2_getrf_npvt(bool STRIDED,
-                                                 bool GETRF,
-                                                 rocblas_handle handle,
-                                                 rocblas_int m,
-                                                 rocblas_int n,
-                                                 rocblas_float_complex* A,
-                                                 rocblas_int lda,
-                                                 rocblas_stride stA,
-                                                 rocblas_int* info,
-                                                 rocblas_int bc)
+inline rocblas_status rocsolver_pbtrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int kd,
+                                      rocblas_int nrhs,
+                                      rocblas_float_complex* AB,
+                                      rocblas_int ldab,
+                                      rocblas_stride stA,
+                                      rocblas_float_complex* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int batch_count)
 {
     if(STRIDED)
-        return GETRF ? rocsolver_cgetrf_npvt_strided_batched(handle, m, n, A, lda, stA, info, bc)
-                     : rocsolver_cgetf2_npvt_strided_batched(handle, m, n, A, lda, stA, info, bc);
+        return rocsolver_cpbtrs_strided_batched(handle, uplo, n, kd, nrhs, AB, ldab, stA, B, ldb,
+                                                stB, batch_count);
     else
-        return GETRF ? rocsolver_cgetrf_npvt(handle, m, n, A, lda, info)
-                     : rocsolver_cgetf2_npvt(handle, m, n, A, lda, info);
+        return rocsolver_cpbtrs(handle, uplo, n, kd, nrhs, AB, ldab, B, ldb);
 }
 
-inline rocblas_status rocsolver_getf2_getrf_npvt(bool STRIDED,
-                                                 bool GETRF,
-                                                 rocblas_handle handle,
-                                                 rocblas_int m,
-                                                 rocblas_int n,
-                                                 rocblas_double_complex* A,
-                                                 rocblas_int lda,
-                                                 rocblas_stride stA,
-                                                 rocblas_int* info,
-                                                 rocblas_int bc)
+inline rocblas_status rocsolver_pbtrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int kd,
+                                      rocblas_int nrhs,
+                                      rocblas_double_complex* AB,
+                                      rocblas_int ldab,
+                                      rocblas_stride stA,
+                                      rocblas_double_complex* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int batch_count)
 {
     if(STRIDED)
-        return GETRF ? rocsolver_zgetrf_npvt_strided_batched(handle, m, n, A, lda, stA, info, bc)
-                     : rocsolver_zgetf2_npvt_strided_batched(handle, m, n, A, lda, stA, info, bc);
+        return rocsolver_zpbtrs_strided_batched(handle, uplo, n, kd, nrhs, AB, ldab, stA, B, ldb,
+                                                stB, batch_count);
     else
-        return GETRF ? rocsolver_zgetrf_npvt(handle, m, n, A, lda, info)
-                     : rocsolver_zgetf2_npvt(handle, m, n, A, lda, info);
+        return rocsolver_zpbtrs(handle, uplo, n, kd, nrhs, AB, ldab, B, ldb);
 }
-inline rocblas_status rocsolver_getf2_getrf_npvt(bool STRIDED,
-                                                 bool GETRF,
-                                                 rocblas_handle handle,
-                                                 int64_t m,
-                                                 int64_t n,
-                                                 float* A,
-                                                 int64_t lda,
-                                                 rocblas_stride stA,
-                                                 int64_t* info,
-                                                 int64_t bc)
+
+// batched
+inline rocblas_status rocsolver_pbtrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int kd,
+                                      rocblas_int nrhs,
+                                      float* const AB[],
+                                      rocblas_int ldab,
+                                      rocblas_stride stA,
+                                      float* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int batch_count)
+{
+    return rocsolver_spbtrs_batched(handle, uplo, n, kd, nrhs, AB, ldab, B, ldb, batch_count);
+}
+
+inline rocblas_status rocsolver_pbtrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int kd,
+                                      rocblas_int nrhs,
+                                      double* const AB[],
+                                      rocblas_int ldab,
+                                      rocblas_stride stA,
+                                      double* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int batch_count)
+{
+    return rocsolver_dpbtrs_batched(handle, uplo, n, kd, nrhs, AB, ldab, B, ldb, batch_count);
+}
+
+inline rocblas_status rocsolver_pbtrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int kd,
+                                      rocblas_int nrhs,
+                                      rocblas_float_complex* const AB[],
+                                      rocblas_int ldab,
+                                      rocblas_stride stA,
+                                      rocblas_float_complex* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int batch_count)
+{
+    return rocsolver_cpbtrs_batched(handle, uplo, n, kd, nrhs, AB, ldab, B, ldb, batch_count);
+}
+
+inline rocblas_status rocsolver_pbtrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int kd,
+                                      rocblas_int nrhs,
+                                      rocblas_double_complex* const AB[],
+                                      rocblas_int ldab,
+                                      rocblas_stride stA,
+                                      rocblas_double_complex* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int batch_count)
+{
+    return rocsolver_zpbtrs_batched(handle, uplo, n, kd, nrhs, AB, ldab, B, ldb, batch_count);
+}
+
+/********************************************************/
+
+/******************** PFTRF ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_pftrf(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation transr,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      float* A,
+                                      rocblas_stride stA,
+                                      rocblas_int* info,
+                                      rocblas_int batch_count)
 {
     if(STRIDED)
-        return GETRF ? rocsolver_sgetrf_npvt_strided_batched_64(handle, m, n, A, lda, stA, info, bc)
-                     : rocsolver_sgetf2_npvt_strided_batched_64(handle, m, n, A, lda, stA, info, bc);
+        return rocsolver_spftrf_strided_batched(handle, transr, uplo, n, A, stA, info, batch_count);
     else
-        return GETRF ? rocsolver_sgetrf_npvt_64(handle, m, n, A, lda, info)
-                     : rocsolver_sgetf2_npvt_64(handle, m, n, A, lda, info);
+        return rocsolver_spftrf(handle, transr, uplo, n, A, info);
 }
 
-inline rocblas_status rocsolver_getf2_getrf_npvt(bool STRIDED,
-                                                 bool GETRF,
-                                                 rocblas_handle handle,
-                                                 int64_t m,
-                                                 int64_t n,
-                                                 double* A,
-                                                 int64_t lda,
-                                                 rocblas_stride stA,
-                                                 int64_t* info,
-                                                 int64_t bc)
+inline rocblas_status rocsolver_pftrf(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation transr,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      double* A,
+                                      rocblas_stride stA,
+                                      rocblas_int* info,
+                                      rocblas_int batch_count)
 {
     if(STRIDED)
-        return GETRF ? rocsolver_dgetrf_npvt_strided_batched_64(handle, m, n, A, lda, stA, info, bc)
-                     : rocsolver_dgetf2_npvt_strided_batched_64(handle, m, n, A, lda, stA, info, bc);
+        return rocsolver_dpftrf_strided_batched(handle, transr, uplo, n, A, stA, info, batch_count);
     else
-        return GETRF ? rocsolver_dgetrf_npvt_64(handle, m, n, A, lda, info)
-                     : rocsolver_dgetf2_npvt_64(handle, m, n, A, lda, info);
+        return rocsolver_dpftrf(handle, transr, uplo, n, A, info);
 }
 
-inline rocblas_status rocsolver_getf2_getrf_npvt(bool STRIDED,
-                                                 bool GETRF,
-                                                 rocblas_handle handle,
-                                                 int64_t m,
-                                                 int64_t n,
-                                                 rocblas_float_complex* A,
-                                                 int64_t lda,
-                                                 rocblas_stride stA,
-                                                 int64_t* info,
-                                                 int64_t bc)
+inline rocblas_status rocsolver_pftrf(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation transr,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_float_complex* A,
+                                      rocblas_stride stA,
+                                      rocblas_int* info,
+                                      rocblas_int batch_count)
 {
     if(STRIDED)
-        return GETRF ? rocsolver_cgetrf_npvt_strided_batched_64(handle, m, n, A, lda, stA, info, bc)
-                     : rocsolver_cgetf2_npvt_strided_batched_64(handle, m, n, A, lda, stA, info, bc);
+        return rocsolver_cpftrf_strided_batched(handle, transr, uplo, n, A, stA, info, batch_count);
     else
-        return GETRF ? rocsolver_cgetrf_npvt_64(handle, m, n, A, lda, info)
-                     : rocsolver_cgetf2_npvt_64(handle, m, n, A, lda, info);
+        return rocsolver_cpftrf(handle, transr, uplo, n, A, info);
 }
 
-inline rocblas_status rocsolver_getf2_getrf_npvt(bool STRIDED,
-                                                 bool GETRF,
-                                                 rocblas_handle handle,
-                                                 int64_t m,
-                                                 int64_t n,
-                                                 rocblas_double_complex* A,
-                                                 int64_t lda,
-                                                 rocblas_stride stA,
-                                                 int64_t* info,
-                                                 int64_t bc)
+inline rocblas_status rocsolver_pftrf(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation transr,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_double_complex* A,
+                                      rocblas_stride stA,
+                                      rocblas_int* info,
+                                      rocblas_int batch_count)
 {
     if(STRIDED)
-        return GETRF ? rocsolver_zgetrf_npvt_strided_batched_64(handle, m, n, A, lda, stA, info, bc)
-                     : rocsolver_zgetf2_npvt_strided_batched_64(handle, m, n, A, lda, stA, info, bc);
+        return rocsolver_zpftrf_strided_batched(handle, transr, uplo, n, A, stA, info, batch_count);
     else
-        return GETRF ? rocsolver_zgetrf_npvt_64(handle, m, n, A, lda, info)
-                     : rocsolver_zgetf2_npvt_64(handle, m, n, A, lda, info);
+        return rocsolver_zpftrf(handle, transr, uplo, n, A, info);
 }
 
 // batched
-inline rocblas_status rocsolver_getf2_getrf_npvt(bool STRIDED,
-                                                 bool GETRF,
-                                                 rocblas_handle handle,
-                                                 rocblas_int m,
-                                                 rocblas_int n,
-                                                 float* const A[],
-                                                 rocblas_int lda,
-                                                 rocblas_stride stA,
-                                                 rocblas_int* info,
-                                                 rocblas_int bc)
+inline rocblas_status rocsolver_pftrf(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation transr,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      float* const A[],
+                                      rocblas_stride stA,
+                                      rocblas_int* info,
+                                      rocblas_int batch_count)
 {
-    return GETRF ? rocsolver_sgetrf_npvt_batched(handle, m, n, A, lda, info, bc)
-                 : rocsolver_sgetf2_npvt_batched(handle, m, n, A, lda, info, bc);
+    return rocsolver_spftrf_batched(handle, transr, uplo, n, A, info, batch_count);
 }
 
-inline rocblas_status rocsolver_getf2_getrf_npvt(bool STRIDED,
-                                                 bool GETRF,
-                                                 rocblas_handle handle,
-                                                 rocblas_int m,
-                                                 rocblas_int n,
-                                                 double* const A[],
-                                                 rocblas_int lda,
-                                                 rocblas_stride stA,
-                                                 rocblas_int* info,
-                                                 rocblas_int bc)
+inline rocblas_status rocsolver_pftrf(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation transr,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      double* const A[],
+                                      rocblas_stride stA,
+                                      rocblas_int* info,
+                                      rocblas_int batch_count)
 {
-    return GETRF ? rocsolver_dgetrf_npvt_batched(handle, m, n, A, lda, info, bc)
-                 : rocsolver_dgetf2_npvt_batched(handle, m, n, A, lda, info, bc);
+    return rocsolver_dpftrf_batched(handle, transr, uplo, n, A, info, batch_count);
 }
 
-inline rocblas_status rocsolver_getf2_getrf_npvt(bool STRIDED,
-                                                 bool GETRF,
-                                                 rocblas_handle handle,
-                                                 rocblas_int m,
-                                                 rocblas_int n,
-                                                 rocblas_float_complex* const A[],
-                                                 rocblas_int lda,
-                                                 rocblas_stride stA,
-                                                 rocblas_int* info,
-                                                 rocblas_int bc)
+inline rocblas_status rocsolver_pftrf(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation transr,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_float_complex* const A[],
+                                      rocblas_stride stA,
+                                      rocblas_int* info,
+                                      rocblas_int batch_count)
 {
-    return GETRF ? rocsolver_cgetrf_npvt_batched(handle, m, n, A, lda, info, bc)
-                 : rocsolver_cgetf2_npvt_batched(handle, m, n, A, lda, info, bc);
+    return rocsolver_cpftrf_batched(handle, transr, uplo, n, A, info, batch_count);
 }
 
-inline rocblas_status rocsolver_getf2_getrf_npvt(bool STRIDED,
-                                                 bool GETRF,
-                                                 rocblas_handle handle,
-                                                 rocblas_int m,
-                                                 rocblas_int n,
-                                                 rocblas_double_complex* const A[],
-                                                 rocblas_int lda,
-                                                 rocblas_stride stA,
-                                                 rocblas_int* info,
-                                                 rocblas_int bc)
-{
-    return GETRF ? rocsolver_zgetrf_npvt_batched(handle, m, n, A, lda, info, bc)
-                 : rocsolver_zgetf2_npvt_batched(handle, m, n, A, lda, info, bc);
-}
-
-inline rocblas_status rocsolver_getf2_getrf_npvt(bool STRIDED,
-                                                 bool GETRF,
-                                                 rocblas_handle handle,
-                                                 int64_t m,
-                                                 int64_t n,
-                                                 float* const A[],
-                                                 int64_t lda,
-                                                 rocblas_stride stA,
-                                                 int64_t* info,
-                                                 int64_t bc)
-{
-    return GETRF ? rocsolver_sgetrf_npvt_batched_64(handle, m, n, A, lda, info, bc)
-                 : rocsolver_sgetf2_npvt_batched_64(handle, m, n, A, lda, info, bc);
-}
-
-inline rocblas_status rocsolver_getf2_getrf_npvt(bool STRIDED,
-                                                 bool GETRF,
-                                                 rocblas_handle handle,
-                                                 int64_t m,
-                                                 int64_t n,
-                                                 double* const A[],
-                                                 int64_t lda,
-                                                 rocblas_stride stA,
-                                                 int64_t* info,
-                                                 int64_t bc)
-{
-    return GETRF ? rocsolver_dgetrf_npvt_batched_64(handle, m, n, A, lda, info, bc)
-                 : rocsolver_dgetf2_npvt_batched_64(handle, m, n, A, lda, info, bc);
-}
-
-inline rocblas_status rocsolver_getf2_getrf_npvt(bool STRIDED,
-                                                 bool GETRF,
-                                                 rocblas_handle handle,
-                                                 int64_t m,
-                                                 int64_t n,
-                                                 rocblas_float_complex* const A[],
-                                                 int64_t lda,
-                                                 rocblas_stride stA,
-                                                 int64_t* info,
-                                                 int64_t bc)
+inline rocblas_status rocsolver_pftrf(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation transr,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_double_complex* const A[],
+                                      rocblas_stride stA,
+                                      rocblas_int* info,
+                                      rocblas_int batch_count)
 {
-    return GETRF ? rocsolver_cgetrf_npvt_batched_64(handle, m, n, A, lda, info, bc)
-                 : rocsolver_cgetf2_npvt_batched_64(handle, m, n, A, lda, info, bc);
+    return rocsolver_zpftrf_batched(handle, transr, uplo, n, A, info, batch_count);
 }
 
-inline rocblas_status rocsolver_getf2_getrf_npvt(bool STRIDED,
-                                                 bool GETRF,
-                                                 rocblas_handle handle,
-                                                 int64_t m,
-                                                 int64_t n,
-                                                 rocblas_double_complex* const A[],
-                                                 int64_t lda,
-                                                 rocblas_stride stA,
-                                                 int64_t* info,
-                                                 int64_t bc)
-{
-    return GETRF ? rocsolver_zgetrf_npvt_batched_64(handle, m, n, A, lda, info, bc)
-                 : rocsolver_zgetf2_npvt_batched_64(handle, m, n, A, lda, info, bc);
-}
 /********************************************************/
 
-/******************** GETF2_GETRF ********************/
+/******************** PFTRS ********************/
 // normal and strided_batched
-inline rocblas_status rocsolver_getf2_getrf(bool STRIDED,
-                                            bool GETRF,
-                                            rocblas_handle handle,
-                                            rocblas_int m,
-                                            rocblas_int n,
-                                            float* A,
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            rocblas_int* ipiv,
-                                            rocblas_stride stP,
-                                            rocblas_int* info,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_pftrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation transr,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      float* A,
+                                      rocblas_stride stA,
+                                      float* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int batch_count)
 {
     if(STRIDED)
-        return GETRF
-            ? rocsolver_sgetrf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, info, bc)
-            : rocsolver_sgetf2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, info, bc);
+        return rocsolver_spftrs_strided_batched(handle, transr, uplo, n, nrhs, A, stA, B, ldb, stB,
+                                                batch_count);
     else
-        return GETRF ? rocsolver_sgetrf(handle, m, n, A, lda, ipiv, info)
-                     : rocsolver_sgetf2(handle, m, n, A, lda, ipiv, info);
+        return rocsolver_spftrs(handle, transr, uplo, n, nrhs, A, B, ldb);
 }
 
-inline rocblas_status rocsolver_getf2_getrf(bool STRIDED,
-                                            bool GETRF,
-                                            rocblas_handle handle,
-                                            rocblas_int m,
-                                            rocblas_int n,
-                                            double* A,
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            rocblas_int* ipiv,
-                                            rocblas_stride stP,
-                                            rocblas_int* info,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_pftrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation transr,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      double* A,
+                                      rocblas_stride stA,
+                                      double* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int batch_count)
 {
     if(STRIDED)
-        return GETRF
-            ? rocsolver_dgetrf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, info, bc)
-            : rocsolver_dgetf2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, info, bc);
+        return rocsolver_dpftrs_strided_batched(handle, transr, uplo, n, nrhs, A, stA, B, ldb, stB,
+                                                batch_count);
     else
-        return GETRF ? rocsolver_dgetrf(handle, m, n, A, lda, ipiv, info)
-                     : rocsolver_dgetf2(handle, m, n, A, lda, ipiv, info);
+        return rocsolver_dpftrs(handle, transr, uplo, n, nrhs, A, B, ldb);
 }
 
-inline rocblas_status rocsolver_getf2_getrf(bool STRIDED,
-                                            bool GETRF,
-                                            rocblas_handle handle,
-                                            rocblas_int m,
-                                            rocblas_int n,
-                                            rocblas_float_complex* A,
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            rocblas_int* ipiv,
-                                            rocblas_stride stP,
-                                            rocblas_int* info,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_pftrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation transr,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_float_complex* A,
+                                      rocblas_stride stA,
+                                      rocblas_float_complex* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int batch_count)
 {
     if(STRIDED)
-        return GETRF
-            ? rocsolver_cgetrf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, info, bc)
-            : rocsolver_cgetf2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, info, bc);
+        return rocsolver_cpftrs_strided_batched(handle, transr, uplo, n, nrhs, A, stA, B, ldb, stB,
+                                                batch_count);
     else
-        return GETRF ? rocsolver_cgetrf(handle, m, n, A, lda, ipiv, info)
-                     : rocsolver_cgetf2(handle, m, n, A, lda, ipiv, info);
+        return rocsolver_cpftrs(handle, transr, uplo, n, nrhs, A, B, ldb);
 }
 
-inline rocblas_status rocsolver_getf2_getrf(bool STRIDED,
-                                            bool GETRF,
-                                            rocblas_handle handle,
-                                            rocblas_int m,
-                                            rocblas_int n,
-                                            rocblas_double_complex* A,
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            rocblas_int* ipiv,
-                                            rocblas_stride stP,
-                                            rocblas_int* info,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_pftrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation transr,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_double_complex* A,
+                                      rocblas_stride stA,
+                                      rocblas_double_complex* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int batch_count)
 {
     if(STRIDED)
-        return GETRF
-            ? rocsolver_zgetrf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, info, bc)
-            : rocsolver_zgetf2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, info, bc);
+        return rocsolver_zpftrs_strided_batched(handle, transr, uplo, n, nrhs, A, stA, B, ldb, stB,
+                                                batch_count);
     else
-        return GETRF ? rocsolver_zgetrf(handle, m, n, A, lda, ipiv, info)
-                     : rocsolver_zgetf2(handle, m, n, A, lda, ipiv, info);
+        return rocsolver_zpftrs(handle, transr, uplo, n, nrhs, A, B, ldb);
 }
 
-inline rocblas_status rocsolver_getf2_getrf(bool STRIDED,
-                                            bool GETRF,
-                                            rocblas_handle handle,
-                                            int64_t m,
-                                            int64_t n,
-                                            float* A,
-                                            int64_t lda,
-                                            rocblas_stride stA,
-                                            int64_t* ipiv,
-                                            rocblas_stride stP,
-                                            int64_t* info,
-                                            int64_t bc)
+// batched
+inline rocblas_status rocsolver_pftrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation transr,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      float* const A[],
+                                      rocblas_stride stA,
+                                      float* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int batch_count)
 {
-    if(STRIDED)
-        return GETRF
-            ? rocsolver_sgetrf_strided_batched_64(handle, m, n, A, lda, stA, ipiv, stP, info, bc)
-            : rocsolver_sgetf2_strided_batched_64(handle, m, n, A, lda, stA, ipiv, stP, info, bc);
-    else
-        return GETRF ? rocsolver_sgetrf_64(handle, m, n, A, lda, ipiv, info)
-                     : rocsolver_sgetf2_64(handle, m, n, A, lda, ipiv, info);
+    return rocsolver_spftrs_batched(handle, transr, uplo, n, nrhs, A, B, ldb, batch_count);
 }
 
-inline rocblas_status rocsolver_getf2_getrf(bool STRIDED,
-                                            bool GETRF,
-                                            rocblas_handle handle,
-                                            int64_t m,
-                                            int64_t n,
-                                            double* A,
-                                            int64_t lda,
-                                            rocblas_stride stA,
-                                            int64_t* ipiv,
-                                            rocblas_stride stP,
-                                            int64_t* info,
-                                            int64_t bc)
+inline rocblas_status rocsolver_pftrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation transr,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      double* const A[],
+                                      rocblas_stride stA,
+                                      double* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int batch_count)
 {
-    if(STRIDED)
-        return GETRF
-            ? rocsolver_dgetrf_strided_batched_64(handle, m, n, A, lda, stA, ipiv, stP, info, bc)
-            : rocsolver_dgetf2_strided_batched_64(handle, m, n, A, lda, stA, ipiv, stP, info, bc);
-    else
-        return GETRF ? rocsolver_dgetrf_64(handle, m, n, A, lda, ipiv, info)
-                     : rocsolver_dgetf2_64(handle, m, n, A, lda, ipiv, info);
+    return rocsolver_dpftrs_batched(handle, transr, uplo, n, nrhs, A, B, ldb, batch_count);
 }
 
-inline rocblas_status rocsolver_getf2_getrf(bool STRIDED,
-                                            bool GETRF,
-                                            rocblas_handle handle,
-                                            int64_t m,
-                                            int64_t n,
-                                            rocblas_float_complex* A,
-                                            int64_t lda,
-                                            rocblas_stride stA,
-                                            int64_t* ipiv,
-                                            rocblas_stride stP,
-                                            int64_t* info,
-                                            int64_t bc)
+inline rocblas_status rocsolver_pftrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation transr,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_float_complex* const A[],
+                                      rocblas_stride stA,
+                                      rocblas_float_complex* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int batch_count)
 {
-    if(STRIDED)
-        return GETRF
-            ? rocsolver_cgetrf_strided_batched_64(handle, m, n, A, lda, stA, ipiv, stP, info, bc)
-            : rocsolver_cgetf2_strided_batched_64(handle, m, n, A, lda, stA, ipiv, stP, info, bc);
-    else
-        return GETRF ? rocsolver_cgetrf_64(handle, m, n, A, lda, ipiv, info)
-                     : rocsolver_cgetf2_64(handle, m, n, A, lda, ipiv, info);
+    return rocsolver_cpftrs_batched(handle, transr, uplo, n, nrhs, A, B, ldb, batch_count);
 }
 
-inline rocblas_status rocsolver_getf2_getrf(bool STRIDED,
-                                            bool GETRF,
-                                            rocblas_handle handle,
-                                            int64_t m,
-                                            int64_t n,
-                                            rocblas_double_complex* A,
-                                            int64_t lda,
-                                            rocblas_stride stA,
-                                            int64_t* ipiv,
-                                            rocblas_stride stP,
-                                            int64_t* info,
-                                            int64_t bc)
+inline rocblas_status rocsolver_pftrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation transr,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_double_complex* const A[],
+                                      rocblas_stride stA,
+                                      rocblas_double_complex* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int batch_count)
 {
-    if(STRIDED)
-        return GETRF
-            ? rocsolver_zgetrf_strided_batched_64(handle, m, n, A, lda, stA, ipiv, stP, info, bc)
-            : rocsolver_zgetf2_strided_batched_64(handle, m, n, A, lda, stA, ipiv, stP, info, bc);
-    else
-        return GETRF ? rocsolver_zgetrf_64(handle, m, n, A, lda, ipiv, info)
-                     : rocsolver_zgetf2_64(handle, m, n, A, lda, ipiv, info);
+    return rocsolver_zpftrs_batched(handle, transr, uplo, n, nrhs, A, B, ldb, batch_count);
 }
 
-// batched
-inline rocblas_status rocsolver_getf2_getrf(bool STRIDED,
-                                            bool GETRF,
-                                            rocblas_handle handle,
-                                            rocblas_int m,
-                                            rocblas_int n,
-                                            float* const A[],
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            rocblas_int* ipiv,
-                                            rocblas_stride stP,
-                                            rocblas_int* info,
-                                            rocblas_int bc)
-{
-    return GETRF ? rocsolver_sgetrf_batched(handle, m, n, A, lda, ipiv, stP, info, bc)
-                 : rocsolver_sgetf2_batched(handle, m, n, A, lda, ipiv, stP, info, bc);
-}
+/********************************************************/
 
-inline rocblas_status rocsolver_getf2_getrf(bool STRIDED,
-                                            bool GETRF,
-                                            rocblas_handle handle,
-                                            rocblas_int m,
-                                            rocblas_int n,
-                                            double* const A[],
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            rocblas_int* ipiv,
-                                            rocblas_stride stP,
-                                            rocblas_int* info,
-                                            rocblas_int bc)
+/******************** PFTRI ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_pftri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation transr,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      float* A,
+                                      rocblas_stride stA,
+                                      rocblas_int* info,
+                                      rocblas_int batch_count)
 {
-    return GETRF ? rocsolver_dgetrf_batched(handle, m, n, A, lda, ipiv, stP, info, bc)
-                 : rocsolver_dgetf2_batched(handle, m, n, A, lda, ipiv, stP, info, bc);
+    if(STRIDED)
+        return rocsolver_spftri_strided_batched(handle, transr, uplo, n, A, stA, info, batch_count);
+    else
+        return rocsolver_spftri(handle, transr, uplo, n, A, info);
 }
 
-inline rocblas_status rocsolver_getf2_getrf(bool STRIDED,
-                                            bool GETRF,
-                                            rocblas_handle handle,
-                                            rocblas_int m,
-                                            rocblas_int n,
-                                            rocblas_float_complex* const A[],
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            rocblas_int* ipiv,
-                                            rocblas_stride stP,
-                                            rocblas_int* info,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_pftri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation transr,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      double* A,
+                                      rocblas_stride stA,
+                                      rocblas_int* info,
+                                      rocblas_int batch_count)
 {
-    return GETRF ? rocsolver_cgetrf_batched(handle, m, n, A, lda, ipiv, stP, info, bc)
-                 : rocsolver_cgetf2_batched(handle, m, n, A, lda, ipiv, stP, info, bc);
+    if(STRIDED)
+        return rocsolver_dpftri_strided_batched(handle, transr, uplo, n, A, stA, info, batch_count);
+    else
+        return rocsolver_dpftri(handle, transr, uplo, n, A, info);
 }
 
-inline rocblas_status rocsolver_getf2_getrf(bool STRIDED,
-                                            bool GETRF,
-                                            rocblas_handle handle,
-                                            rocblas_int m,
-                                            rocblas_int n,
-                                            rocblas_double_complex* const A[],
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            rocblas_int* ipiv,
-                                            rocblas_stride stP,
-                                            rocblas_int* info,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_pftri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation transr,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_float_complex* A,
+                                      rocblas_stride stA,
+                                      rocblas_int* info,
+                                      rocblas_int batch_count)
 {
-    return GETRF ? rocsolver_zgetrf_batched(handle, m, n, A, lda, ipiv, stP, info, bc)
-                 : rocsolver_zgetf2_batched(handle, m, n, A, lda, ipiv, stP, info, bc);
+    if(STRIDED)
+        return rocsolver_cpftri_strided_batched(handle, transr, uplo, n, A, stA, info, batch_count);
+    else
+        return rocsolver_cpftri(handle, transr, uplo, n, A, info);
 }
 
-inline rocblas_status rocsolver_getf2_getrf(bool STRIDED,
-                                            bool GETRF,
-                                            rocblas_handle handle,
-                                            int64_t m,
-                                            int64_t n,
-                                            float* const A[],
-                                            int64_t lda,
-                                            rocblas_stride stA,
-                                            int64_t* ipiv,
-                                            rocblas_stride stP,
-                                            int64_t* info,
-                                            int64_t bc)
+inline rocblas_status rocsolver_pftri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation transr,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_double_complex* A,
+                                      rocblas_stride stA,
+                                      rocblas_int* info,
+                                      rocblas_int batch_count)
 {
-    return GETRF ? rocsolver_sgetrf_batched_64(handle, m, n, A, lda, ipiv, stP, info, bc)
-                 : rocsolver_sgetf2_batched_64(handle, m, n, A, lda, ipiv, stP, info, bc);
+    if(STRIDED)
+        return rocsolver_zpftri_strided_batched(handle, transr, uplo, n, A, stA, info, batch_count);
+    else
+        return rocsolver_zpftri(handle, transr, uplo, n, A, info);
 }
 
-inline rocblas_status rocsolver_getf2_getrf(bool STRIDED,
-                                            bool GETRF,
-                                            rocblas_handle handle,
-                                            int64_t m,
-                                            int64_t n,
-                                            double* const A[],
-                                            int64_t lda,
-                                            rocblas_stride stA,
-                                            int64_t* ipiv,
-                                            rocblas_stride stP,
-                                            int64_t* info,
-                                            int64_t bc)
+// batched
+inline rocblas_status rocsolver_pftri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation transr,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      float* const A[],
+                                      rocblas_stride stA,
+                                      rocblas_int* info,
+                                      rocblas_int batch_count)
 {
-    return GETRF ? rocsolver_dgetrf_batched_64(handle, m, n, A, lda, ipiv, stP, info, bc)
-                 : rocsolver_dgetf2_batched_64(handle, m, n, A, lda, ipiv, stP, info, bc);
+    return rocsolver_spftri_batched(handle, transr, uplo, n, A, info, batch_count);
 }
 
-inline rocblas_status rocsolver_getf2_getrf(bool STRIDED,
-                                            bool GETRF,
-                                            rocblas_handle handle,
-                                            int64_t m,
-                                            int64_t n,
-                                            rocblas_float_complex* const A[],
-                                            int64_t lda,
-                                            rocblas_stride stA,
-                                            int64_t* ipiv,
-                                            rocblas_stride stP,
-                                            int64_t* info,
-                                            int64_t bc)
+inline rocblas_status rocsolver_pftri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation transr,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      double* const A[],
+                                      rocblas_stride stA,
+                                      rocblas_int* info,
+                                      rocblas_int batch_count)
 {
-    return GETRF ? rocsolver_cgetrf_batched_64(handle, m, n, A, lda, ipiv, stP, info, bc)
-                 : rocsolver_cgetf2_batched_64(handle, m, n, A, lda, ipiv, stP, info, bc);
+    return rocsolver_dpftri_batched(handle, transr, uplo, n, A, info, batch_count);
 }
 
-inline rocblas_status rocsolver_getf2_getrf(bool STRIDED,
-                                            bool GETRF,
-                                            rocblas_handle handle,
-                                            int64_t m,
-                                            int64_t n,
-                                            rocblas_double_complex* const A[],
-                                            int64_t lda,
-                                            rocblas_stride stA,
-                                            int64_t* ipiv,
-                                            rocblas_stride stP,
-                                            int64_t* info,
-                                            int64_t bc)
+inline rocblas_status rocsolver_pftri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation transr,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_float_complex* const A[],
+                                      rocblas_stride stA,
+                                      rocblas_int* info,
+                                      rocblas_int batch_count)
 {
-    return GETRF ? rocsolver_zgetrf_batched_64(handle, m, n, A, lda, ipiv, stP, info, bc)
-                 : rocsolver_zgetf2_batched_64(handle, m, n, A, lda, ipiv, stP, info, bc);
+    return rocsolver_cpftri_batched(handle, transr, uplo, n, A, info, batch_count);
 }
-/********************************************************/
 
-/******************** GESVD ********************/
-// normal and strided_batched
-inline rocblas_status rocsolver_gesvd(bool STRIDED,
+inline rocblas_status rocsolver_pftri(bool STRIDED,
                                       rocblas_handle handle,
-                                      rocblas_svect leftv,
-                                      rocblas_svect rightv,
-                                      rocblas_int m,
+                                      rocblas_operation transr,
+                                      rocblas_fill uplo,
                                       rocblas_int n,
-                                      float* A,
-                                      rocblas_int lda,
+                                      rocblas_double_complex* const A[],
                                       rocblas_stride stA,
-                                      float* S,
-                                      rocblas_stride stS,
-                                      float* U,
-                                      rocblas_int ldu,
-                                      rocblas_stride stU,
-                                      float* V,
-                                      rocblas_int ldv,
-                                      rocblas_stride stV,
-                                      float* E,
-                                      rocblas_stride stE,
-                                      rocblas_workmode fast_alg,
                                       rocblas_int* info,
-                                      rocblas_int bc)
+                                      rocblas_int batch_count)
 {
-    return STRIDED
-        ? rocsolver_sgesvd_strided_batched(handle, leftv, rightv, m, n, A, lda, stA, S, stS, U, ldu,
-                                           stU, V, ldv, stV, E, stE, fast_alg, info, bc)
-        : rocsolver_sgesvd(handle, leftv, rightv, m, n, A, lda, S, U, ldu, V, ldv, E, fast_alg, info);
+    return rocsolver_zpftri_batched(handle, transr, uplo, n, A, info, batch_count);
 }
 
-inline rocblas_status rocsolver_gesvd(bool STRIDED,
-                                      rocblas_handle handle,
-                                      rocblas_svect leftv,
-                                      rocblas_svect rightv,
-                                      rocblas_int m,
-                                      rocblas_int n,
-                                      double* A,
-                                      rocblas_int lda,
-                                      rocblas_stride stA,
-                                      double* S,
-                                      rocblas_stride stS,
-                                      double* U,
-                                      rocblas_int ldu,
-                                      rocblas_stride stU,
-                                      double* V,
-                                      rocblas_int ldv,
-                                      rocblas_stride stV,
-                                      double* E,
-                                      rocblas_stride stE,
-                                      rocblas_workmode fast_alg,
-                                      rocblas_int* info,
-                                      rocblas_int bc)
+/********************************************************/
+
+/******************** POSV ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_posv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_fill uplo,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     float* A,
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     float* B,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int batch_count)
 {
-    return STRIDED
-        ? rocsolver_dgesvd_strided_batched(handle, leftv, rightv, m, n, A, lda, stA, S, stS, U, ldu,
-                                           stU, V, ldv, stV, E, stE, fast_alg, info, bc)
-        : rocsolver_dgesvd(handle, leftv, rightv, m, n, A, lda, S, U, ldu, V, ldv, E, fast_alg, info);
+    if(STRIDED)
+        return rocsolver_sposv_strided_batched(handle, uplo, n, nrhs, A, lda, stA, B, ldb, stB,
+                                               info, batch_count);
+    else
+        return rocsolver_sposv(handle, uplo, n, nrhs, A, lda, B, ldb, info);
 }
 
-inline rocblas_status rocsolver_gesvd(bool STRIDED,
-                                      rocblas_handle handle,
-                                      rocblas_svect leftv,
-                                      rocblas_svect rightv,
-                                      rocblas_int m,
-                                      rocblas_int n,
-                                      rocblas_float_complex* A,
-                                      rocblas_int lda,
-                                      rocblas_stride stA,
-                                      float* S,
-                                      rocblas_stride stS,
-                                      rocblas_float_complex* U,
-                                      rocblas_int ldu,
-                                      rocblas_stride stU,
-                                      rocblas_float_complex* V,
-                                      rocblas_int ldv,
-                                      rocblas_stride stV,
-                                      float* E,
-                                      rocblas_stride stE,
-                                      rocblas_workmode fast_alg,
-                                      rocblas_int* info,
-                                      rocblas_int bc)
+inline rocblas_status rocsolver_posv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_fill uplo,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     double* A,
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     double* B,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int batch_count)
 {
-    return STRIDED
-        ? rocsolver_cgesvd_strided_batched(handle, leftv, rightv, m, n, A, lda, stA, S, stS, U, ldu,
-                                           stU, V, ldv, stV, E, stE, fast_alg, info, bc)
-        : rocsolver_cgesvd(handle, leftv, rightv, m, n, A, lda, S, U, ldu, V, ldv, E, fast_alg, info);
+    if(STRIDED)
+        return rocsolver_dposv_strided_batched(handle, uplo, n, nrhs, A, lda, stA, B, ldb, stB,
+                                               info, batch_count);
+    else
+        return rocsolver_dposv(handle, uplo, n, nrhs, A, lda, B, ldb, info);
 }
 
-inline rocblas_status rocsolver_gesvd(bool STRIDED,
-                                      rocblas_handle handle,
-                                      rocblas_svect leftv,
-                                      rocblas_svect rightv,
-                                      rocblas_int m,
-                                      rocblas_int n,
-                                      rocblas_double_complex* A,
-                                      rocblas_int lda,
-                                      rocblas_stride stA,
-                                      double* S,
-                                      rocblas_stride stS,
-                                      rocblas_double_complex* U,
-                                      rocblas_int ldu,
-                                      rocblas_stride stU,
-                                      rocblas_double_complex* V,
-                                      rocblas_int ldv,
-                                      rocblas_stride stV,
-                                      double* E,
-                                      rocblas_stride stE,
-                                      rocblas_workmode fast_alg,
-                                      rocblas_int* info,
-                                      rocblas_int bc)
+inline rocblas_status rocsolver_posv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_fill uplo,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     rocblas_float_complex* A,
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_float_complex* B,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int batch_count)
 {
-    return STRIDED
-        ? rocsolver_zgesvd_strided_batched(handle, leftv, rightv, m, n, A, lda, stA, S, stS, U, ldu,
-                                           stU, V, ldv, stV, E, stE, fast_alg, info, bc)
-        : rocsolver_zgesvd(handle, leftv, rightv, m, n, A, lda, S, U, ldu, V, ldv, E, fast_alg, info);
+    if(STRIDED)
+        return rocsolver_cposv_strided_batched(handle, uplo, n, nrhs, A, lda, stA, B, ldb, stB,
+                                               info, batch_count);
+    else
+        return rocsolver_cposv(handle, uplo, n, nrhs, A, lda, B, ldb, info);
 }
 
-// batched
-inline rocblas_status rocsolver_gesvd(bool STRIDED,
-                                      rocblas_handle handle,
-                                      rocblas_svect leftv,
-                                      rocblas_svect rightv,
-                                      rocblas_int m,
-                                      rocblas_int n,
-                                      float* const A[],
-                                      rocblas_int lda,
-                                      rocblas_stride stA,
-                                      float* S,
-                                      rocblas_stride stS,
-                                      float* U,
-                                      rocblas_int ldu,
-                                      rocblas_stride stU,
-                                      float* V,
-                                      rocblas_int ldv,
-                                      rocblas_stride stV,
-                                      float* E,
-                                      rocblas_stride stE,
-                                      rocblas_workmode fast_alg,
-                                      rocblas_int* info,
-                                      rocblas_int bc)
+inline rocblas_status rocsolver_posv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_fill uplo,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     rocblas_double_complex* A,
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_double_complex* B,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int batch_count)
 {
-    return rocsolver_sgesvd_batched(handle, leftv, rightv, m, n, A, lda, S, stS, U, ldu, stU, V,
-                                    ldv, stV, E, stE, fast_alg, info, bc);
+    if(STRIDED)
+        return rocsolver_zposv_strided_batched(handle, uplo, n, nrhs, A, lda, stA, B, ldb, stB,
+                                               info, batch_count);
+    else
+        return rocsolver_zposv(handle, uplo, n, nrhs, A, lda, B, ldb, info);
 }
 
-inline rocblas_status rocsolver_gesvd(bool STRIDED,
-                                      rocblas_handle handle,
-                                      rocblas_svect leftv,
-                                      rocblas_svect rightv,
-                                      rocblas_int m,
-                                      rocblas_int n,
-                                      double* const A[],
-                                      rocblas_int lda,
-                                      rocblas_stride stA,
-                                      double* S,
-                                      rocblas_stride stS,
-                                      double* U,
-                                      rocblas_int ldu,
-                                      rocblas_stride stU,
-                                      double* V,
-                                      rocblas_int ldv,
-                                      rocblas_stride stV,
-                                      double* E,
-                                      rocblas_stride stE,
-                                      rocblas_workmode fast_alg,
-                                      rocblas_int* info,
-                                      rocblas_int bc)
+// batched
+inline rocblas_status rocsolver_posv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_fill uplo,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     float* const A[],
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     float* const B[],
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int batch_count)
 {
-    return rocsolver_dgesvd_batched(handle, leftv, rightv, m, n, A, lda, S, stS, U, ldu, stU, V,
-                                    ldv, stV, E, stE, fast_alg, info, bc);
+    return rocsolver_sposv_batched(handle, uplo, n, nrhs, A, lda, B, ldb, info, batch_count);
 }
 
-inline rocblas_status rocsolver_gesvd(bool STRIDED,
-                                      rocblas_handle handle,
-                                      rocblas_svect leftv,
-                                      rocblas_svect rightv,
-                                      rocblas_int m,
-                                      rocblas_int n,
-                                      rocblas_float_complex* const A[],
-                                      rocblas_int lda,
-                                      rocblas_stride stA,
-                                      float* S,
-                                      rocblas_stride stS,
-                                      rocblas_float_complex* U,
-                                      rocblas_int ldu,
-                                      rocblas_stride stU,
-                                      rocblas_float_complex* V,
-                                      rocblas_int ldv,
-                                      rocblas_stride stV,
-                                      float* E,
-                                      rocblas_stride stE,
-                                      rocblas_workmode fast_alg,
-                                      rocblas_int* info,
-                                      rocblas_int bc)
+inline rocblas_status rocsolver_posv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_fill uplo,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     double* const A[],
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     double* const B[],
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int batch_count)
 {
-    return rocsolver_cgesvd_batched(handle, leftv, rightv, m, n, A, lda, S, stS, U, ldu, stU, V,
-                                    ldv, stV, E, stE, fast_alg, info, bc);
+    return rocsolver_dposv_batched(handle, uplo, n, nrhs, A, lda, B, ldb, info, batch_count);
 }
 
-inline rocblas_status rocsolver_gesvd(bool STRIDED,
-                                      rocblas_handle handle,
-                                      rocblas_svect leftv,
-                                      rocblas_svect rightv,
-                                      rocblas_int m,
-                                      rocblas_int n,
-                                      rocblas_double_complex* const A[],
-                                      rocblas_int lda,
-                                      rocblas_stride stA,
-                                      double* S,
-                                      rocblas_stride stS,
-                                      rocblas_double_complex* U,
-                                      rocblas_int ldu,
-                                      rocblas_stride stU,
-                                      rocblas_double_complex* V,
-                                      rocblas_int ldv,
-                                      rocblas_stride stV,
-                                      double* E,
-                                      rocblas_stride stE,
-                                      rocblas_workmode fast_alg,
-                                      rocblas_int* info,
-                                      rocblas_int bc)
+inline rocblas_status rocsolver_posv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_fill uplo,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     rocblas_float_complex* const A[],
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_float_complex* const B[],
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int batch_count)
 {
-    return rocsolver_zgesvd_batched(handle, leftv, rightv, m, n, A, lda, S, stS, U, ldu, stU, V,
-                                    ldv, stV, E, stE, fast_alg, info, bc);
+    return rocsolver_cposv_batched(handle, uplo, n, nrhs, A, lda, B, ldb, info, batch_count);
+}
+
+inline rocblas_status rocsolver_posv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_fill uplo,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     rocblas_double_complex* const A[],
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_double_complex* const B[],
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int batch_count)
+{
+    return rocsolver_zposv_batched(handle, uplo, n, nrhs, A, lda, B, ldb, info, batch_count);
 }
 /********************************************************/
 
-/******************** GESVDJ ********************/
+/******************** POSV_MIXED ********************/
 // normal and strided_batched
-inline rocblas_status rocsolver_gesvdj(bool STRIDED,
-                                       rocblas_handle handle,
-                                       rocblas_svect leftv,
-                                       rocblas_svect rightv,
-                                       rocblas_int m,
-                                       rocblas_int n,
-                                       float* A,
-                                       rocblas_int lda,
-                                       rocblas_stride stA,
-                                       float abstol,
-                                       float* residual,
-                                       rocblas_int max_sweeps,
-                                       rocblas_int* n_sweeps,
-                                       float* S,
-                                       rocblas_stride stS,
-                                       float* U,
-                                       rocblas_int ldu,
-                                       rocblas_stride stU,
-                                       float* V,
-                                       rocblas_int ldv,
-                                       rocblas_stride stV,
-                                       rocblas_int* info,
-                                       rocblas_int bc)
+inline rocblas_status rocsolver_posv_mixed(bool STRIDED,
+                                           rocblas_handle handle,
+                                           rocblas_fill uplo,
+                                           rocblas_int n,
+                                           rocblas_int nrhs,
+                                           double* A,
+                                           rocblas_int lda,
+                                           rocblas_stride stA,
+                                           double* B,
+                                           rocblas_int ldb,
+                                           rocblas_stride stB,
+                                           double* X,
+                                           rocblas_int ldx,
+                                           rocblas_stride stX,
+                                           rocblas_int* iter,
+                                           rocblas_int* info,
+                                           rocblas_int batch_count)
 {
-    return STRIDED ? rocsolver_sgesvdj_strided_batched(handle, leftv, rightv, m, n, A, lda, stA,
-                                                       abstol, residual, max_sweeps, n_sweeps, S,
-                                                       stS, U, ldu, stU, V, ldv, stV, info, bc)
-                   : rocsolver_sgesvdj(handle, leftv, rightv, m, n, A, lda, abstol, residual,
-                                       max_sweeps, n_sweeps, S, U, ldu, V, ldv, info);
+    if(STRIDED)
+        return rocsolver_dsposv_strided_batched(handle, uplo, n, nrhs, A, lda, stA, B, ldb, stB, X,
+                                                ldx, stX, iter, info, batch_count);
+    else
+        return rocsolver_dsposv(handle, uplo, n, nrhs, A, lda, B, ldb, X, ldx, iter, info);
 }
 
-inline rocblas_status rocsolver_gesvdj(bool STRIDED,
-                                       rocblas_handle handle,
-                                       rocblas_svect leftv,
-                                       rocblas_svect rightv,
-                                       rocblas_int m,
-                                       rocblas_int n,
-                                       double* A,
-                                       rocblas_int lda,
-                                       rocblas_stride stA,
-                                       double abstol,
-                                       double* residual,
-                                       rocblas_int max_sweeps,
-                                       rocblas_int* n_sweeps,
-                                       double* S,
-                                       rocblas_stride stS,
-                                       double* U,
-                                       rocblas_int ldu,
-                                       rocblas_stride stU,
-                                       double* V,
-                                       rocblas_int ldv,
-                                       rocblas_stride stV,
-                                       rocblas_int* info,
-                                       rocblas_int bc)
+inline rocblas_status rocsolver_posv_mixed(bool STRIDED,
+                                           rocblas_handle handle,
+                                           rocblas_fill uplo,
+                                           rocblas_int n,
+                                           rocblas_int nrhs,
+                                           rocblas_double_complex* A,
+                                           rocblas_int lda,
+                                           rocblas_stride stA,
+                                           rocblas_double_complex* B,
+                                           rocblas_int ldb,
+                                           rocblas_stride stB,
+                                           rocblas_double_complex* X,
+                                           rocblas_int ldx,
+                                           rocblas_stride stX,
+                                           rocblas_int* iter,
+                                           rocblas_int* info,
+                                           rocblas_int batch_count)
 {
-    return STRIDED ? rocsolver_dgesvdj_strided_batched(handle, leftv, rightv, m, n, A, lda, stA,
-                                                       abstol, residual, max_sweeps, n_sweeps, S,
-                                                       stS, U, ldu, stU, V, ldv, stV, info, bc)
-                   : rocsolver_dgesvdj(handle, leftv, rightv, m, n, A, lda, abstol, residual,
-                                       max_sweeps, n_sweeps, S, U, ldu, V, ldv, info);
+    if(STRIDED)
+        return rocsolver_zcposv_strided_batched(handle, uplo, n, nrhs, A, lda, stA, B, ldb, stB, X,
+                                                ldx, stX, iter, info, batch_count);
+    else
+        return rocsolver_zcposv(handle, uplo, n, nrhs, A, lda, B, ldb, X, ldx, iter, info);
 }
 
-inline rocblas_status rocsolver_gesvdj(bool STRIDED,
-                                       rocblas_handle handle,
-                                       rocblas_svect leftv,
-                                       rocblas_svect rightv,
-                                       rocblas_int m,
-                                       rocblas_int n,
-                                       rocblas_float_complex* A,
-                                       rocblas_int lda,
-                                       rocblas_stride stA,
-                                       float abstol,
-                                       float* residual,
-                                       rocblas_int max_sweeps,
-                                       rocblas_int* n_sweeps,
-                                       float* S,
-                                       rocblas_stride stS,
-                                       rocblas_float_complex* U,
-                                       rocblas_int ldu,
-                                       rocblas_stride stU,
-                                       rocblas_float_complex* V,
-                                       rocblas_int ldv,
-                                       rocblas_stride stV,
-                                       rocblas_int* info,
-                                       rocblas_int bc)
+// batched
+inline rocblas_status rocsolver_posv_mixed(bool STRIDED,
+                                           rocblas_handle handle,
+                                           rocblas_fill uplo,
+                                           rocblas_int n,
+                                           rocblas_int nrhs,
+                                           double* const A[],
+                                           rocblas_int lda,
+                                           rocblas_stride stA,
+                                           double* const B[],
+                                           rocblas_int ldb,
+                                           rocblas_stride stB,
+                                           double* const X[],
+                                           rocblas_int ldx,
+                                           rocblas_stride stX,
+                                           rocblas_int* iter,
+                                           rocblas_int* info,
+                                           rocblas_int batch_count)
 {
-    return STRIDED ? rocsolver_cgesvdj_strided_batched(handle, leftv, rightv, m, n, A, lda, stA,
-                                                       abstol, residual, max_sweeps, n_sweeps, S,
-                                                       stS, U, ldu, stU, V, ldv, stV, info, bc)
-                   : rocsolver_cgesvdj(handle, leftv, rightv, m, n, A, lda, abstol, residual,
-                                       max_sweeps, n_sweeps, S, U, ldu, V, ldv, info);
+    return rocsolver_dsposv_batched(handle, uplo, n, nrhs, A, lda, B, ldb, X, ldx, iter, info,
+                                    batch_count);
 }
 
-inline rocblas_status rocsolver_gesvdj(bool STRIDED,
-                                       rocblas_handle handle,
-                                       rocblas_svect leftv,
-                                       rocblas_svect rightv,
-                                       rocblas_int m,
-                                       rocblas_int n,
-                                       rocblas_double_complex* A,
-                                       rocblas_int lda,
-                                       rocblas_stride stA,
-                                       double abstol,
-                                       double* residual,
-                                       rocblas_int max_sweeps,
-                                       rocblas_int* n_sweeps,
-                                       double* S,
-                                       rocblas_stride stS,
-                                       rocblas_double_complex* U,
-                                       rocblas_int ldu,
-                                       rocblas_stride stU,
-                                       rocblas_double_complex* V,
-                                       rocblas_int ldv,
-                                       rocblas_stride stV,
-                                       rocblas_int* info,
-                                       rocblas_int bc)
+inline rocblas_status rocsolver_posv_mixed(bool STRIDED,
+                                           rocblas_handle handle,
+                                           rocblas_fill uplo,
+                                           rocblas_int n,
+                                           rocblas_int nrhs,
+                                           rocblas_double_complex* const A[],
+                                           rocblas_int lda,
+                                           rocblas_stride stA,
+                                           rocblas_double_complex* const B[],
+                                           rocblas_int ldb,
+                                           rocblas_stride stB,
+                                           rocblas_double_complex* const X[],
+                                           rocblas_int ldx,
+                                           rocblas_stride stX,
+                                           rocblas_int* iter,
+                                           rocblas_int* info,
+                                           rocblas_int batch_count)
 {
-    return STRIDED ? rocsolver_zgesvdj_strided_batched(handle, leftv, rightv, m, n, A, lda, stA,
-                                                       abstol, residual, max_sweeps, n_sweeps, S,
-                                                       stS, U, ldu, stU, V, ldv, stV, info, bc)
-                   : rocsolver_zgesvdj(handle, leftv, rightv, m, n, A, lda, abstol, residual,
-                                       max_sweeps, n_sweeps, S, U, ldu, V, ldv, info);
+    return rocsolver_zcposv_batched(handle, uplo, n, nrhs, A, lda, B, ldb, X, ldx, iter, info,
+                                    batch_count);
 }
+/********************************************************/
 
-// batched
-inline rocblas_status rocsolver_gesvdj(bool STRIDED,
-                                       rocblas_handle handle,
-                                       rocblas_svect leftv,
-                                       rocblas_svect rightv,
-                                       rocblas_int m,
-                                       rocblas_int n,
-                                       float* const A[],
-                                       rocblas_int lda,
-                                       rocblas_stride stA,
-                                       float abstol,
-                                       float* residual,
-                                       rocblas_int max_sweeps,
-                                       rocblas_int* n_sweeps,
-                                       float* S,
-                                       rocblas_stride stS,
-                                       float* U,
-                                       rocblas_int ldu,
-                                       rocblas_stride stU,
-                                       float* V,
-                                       rocblas_int ldv,
-                                       rocblas_stride stV,
-                                       rocblas_int* info,
-                                       rocblas_int bc)
+/******************** POTRI ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_potri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      float* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* info,
+                                      rocblas_int batch_count)
 {
-    return rocsolver_sgesvdj_batched(handle, leftv, rightv, m, n, A, lda, abstol, residual,
-                                     max_sweeps, n_sweeps, S, stS, U, ldu, stU, V, ldv, stV, info,
-                                     bc);
+    if(STRIDED)
+        return rocsolver_spotri_strided_batched(handle, uplo, n, A, lda, stA, info, batch_count);
+    else
+        return rocsolver_spotri(handle, uplo, n, A, lda, info);
 }
 
-inline rocblas_status rocsolver_gesvdj(bool STRIDED,
-                                       rocblas_handle handle,
-                                       rocblas_svect leftv,
-                                       rocblas_svect rightv,
-                                       rocblas_int m,
-                                       rocblas_int n,
-                                       double* const A[],
-                                       rocblas_int lda,
-                                       rocblas_stride stA,
-                                       double abstol,
-                                       double* residual,
-                                       rocblas_int max_sweeps,
-                                       rocblas_int* n_sweeps,
-                                       double* S,
-                                       rocblas_stride stS,
-                                       double* U,
-                                       rocblas_int ldu,
-                                       rocblas_stride stU,
-                                       double* V,
-                                       rocblas_int ldv,
-                                       rocblas_stride stV,
-                                       rocblas_int* info,
-                                       rocblas_int bc)
+inline rocblas_status rocsolver_potri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      double* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* info,
+                                      rocblas_int batch_count)
 {
-    return rocsolver_dgesvdj_batched(handle, leftv, rightv, m, n, A, lda, abstol, residual,
-                                     max_sweeps, n_sweeps, S, stS, U, ldu, stU, V, ldv, stV, info,
-                                     bc);
+    if(STRIDED)
+        return rocsolver_dpotri_strided_batched(handle, uplo, n, A, lda, stA, info, batch_count);
+    else
+        return rocsolver_dpotri(handle, uplo, n, A, lda, info);
 }
 
-inline rocblas_status rocsolver_gesvdj(bool STRIDED,
-                                       rocblas_handle handle,
-                                       rocblas_svect leftv,
-                                       rocblas_svect rightv,
-                                       rocblas_int m,
-                                       rocblas_int n,
-                                       rocblas_float_complex* const A[],
-                                       rocblas_int lda,
-                                       rocblas_stride stA,
-                                       float abstol,
-                                       float* residual,
-                                       rocblas_int max_sweeps,
-                                       rocblas_int* n_sweeps,
-                                       float* S,
-                                       rocblas_stride stS,
-                                       rocblas_float_complex* U,
-                                       rocblas_int ldu,
-                                       rocblas_stride stU,
-                                       rocblas_float_complex* V,
-                                       rocblas_int ldv,
-                                       rocblas_stride stV,
-                                       rocblas_int* info,
-                                       rocblas_int bc)
+inline rocblas_status rocsolver_potri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_float_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* info,
+                                      rocblas_int batch_count)
 {
-    return rocsolver_cgesvdj_batched(handle, leftv, rightv, m, n, A, lda, abstol, residual,
-                                     max_sweeps, n_sweeps, S, stS, U, ldu, stU, V, ldv, stV, info,
-                                     bc);
+    if(STRIDED)
+        return rocsolver_cpotri_strided_batched(handle, uplo, n, A, lda, stA, info, batch_count);
+    else
+        return rocsolver_cpotri(handle, uplo, n, A, lda, info);
 }
 
-inline rocblas_status rocsolver_gesvdj(bool STRIDED,
-                                       rocblas_handle handle,
-                                       rocblas_svect leftv,
-                                       rocblas_svect rightv,
-                                       rocblas_int m,
-                                       rocblas_int n,
-                                       rocblas_double_complex* const A[],
-                                       rocblas_int lda,
-                                       rocblas_stride stA,
-                                       double abstol,
-                                       double* residual,
-                                       rocblas_int max_sweeps,
-                                       rocblas_int* n_sweeps,
-                                       double* S,
-                                       rocblas_stride stS,
-                                       rocblas_double_complex* U,
-                                       rocblas_int ldu,
-                                       rocblas_stride stU,
-                                       rocblas_double_complex* V,
-                                       rocblas_int ldv,
-                                       rocblas_stride stV,
-                                       rocblas_int* info,
-                                       rocblas_int bc)
+inline rocblas_status rocsolver_potri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_double_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* info,
+                                      rocblas_int batch_count)
 {
-    return rocsolver_zgesvdj_batched(handle, leftv, rightv, m, n, A, lda, abstol, residual,
-                                     max_sweeps, n_sweeps, S, stS, U, ldu, stU, V, ldv, stV, info,
-                                     bc);
+    if(STRIDED)
+        return rocsolver_zpotri_strided_batched(handle, uplo, n, A, lda, stA, info, batch_count);
+    else
+        return rocsolver_zpotri(handle, uplo, n, A, lda, info);
 }
-/********************************************************/
 
-/******************** GESVDJ_NOTRANSV ********************/
-// normal and strided_batched
-inline rocblas_status rocsolver_gesvdj_notransv(bool STRIDED,
-                                                rocblas_handle handle,
-                                                rocblas_svect leftv,
-                                                rocblas_svect rightv,
-                                                rocblas_int m,
-                                                rocblas_int n,
-                                                float* A,
-                                                rocblas_int lda,
-                                                rocblas_stride stA,
-                                                float abstol,
-                                                float* residual,
-                                                rocblas_int max_sweeps,
-                                                rocblas_int* n_sweeps,
-                                                float* S,
-                                                rocblas_stride stS,
-                                                float* U,
-                                                rocblas_int ldu,
-                                                rocblas_stride stU,
-                                                float* V,
-                                                rocblas_int ldv,
-                                                rocblas_stride stV,
-                                                rocblas_int* info,
-                                                rocblas_int bc)
+// batched
+inline rocblas_status rocsolver_potri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      float* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* info,
+                                      rocblas_int batch_count)
 {
-    return STRIDED
-        ? rocsolver_sgesvdj_notransv_strided_batched(handle, leftv, rightv, m, n, A, lda, stA,
-                                                     abstol, residual, max_sweeps, n_sweeps, S, stS,
-                                                     U, ldu, stU, V, ldv, stV, info, bc)
-        : rocsolver_sgesvdj_notransv(handle, leftv, rightv, m, n, A, lda, abstol, residual,
-                                     max_sweeps, n_sweeps, S, U, ldu, V, ldv, info);
+    return rocsolver_spotri_batched(handle, uplo, n, A, lda, info, batch_count);
 }
 
-inline rocblas_status rocsolver_gesvdj_notransv(bool STRIDED,
-                                                rocblas_handle handle,
-                                                rocblas_svect leftv,
-                                                rocblas_svect rightv,
-                                                rocblas_int m,
-                                                rocblas_int n,
-                                                double* A,
-                                                rocblas_int lda,
-                                                rocblas_stride stA,
-                                                double abstol,
-                                                double* residual,
-                                                rocblas_int max_sweeps,
-                                                rocblas_int* n_sweeps,
-                                                double* S,
-                                                rocblas_stride stS,
-                                                double* U,
-                                                rocblas_int ldu,
-                                                rocblas_stride stU,
-                                                double* V,
-                                                rocblas_int ldv,
-                                                rocblas_stride stV,
-                                                rocblas_int* info,
-                                                rocblas_int bc)
+inline rocblas_status rocsolver_potri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      double* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* info,
+                                      rocblas_int batch_count)
 {
-    return STRIDED
-        ? rocsolver_dgesvdj_notransv_strided_batched(handle, leftv, rightv, m, n, A, lda, stA,
-                                                     abstol, residual, max_sweeps, n_sweeps, S, stS,
-                                                     U, ldu, stU, V, ldv, stV, info, bc)
-        : rocsolver_dgesvdj_notransv(handle, leftv, rightv, m, n, A, lda, abstol, residual,
-                                     max_sweeps, n_sweeps, S, U, ldu, V, ldv, info);
+    return rocsolver_dpotri_batched(handle, uplo, n, A, lda, info, batch_count);
 }
 
-inline rocblas_status rocsolver_gesvdj_notransv(bool STRIDED,
-                                                rocblas_handle handle,
-                                                rocblas_svect leftv,
-                                                rocblas_svect rightv,
-                                                rocblas_int m,
-                                                rocblas_int n,
-                                                rocblas_float_complex* A,
-                                                rocblas_int lda,
-                                                rocblas_stride stA,
-                                                float abstol,
-                                                float* residual,
-                                                rocblas_int max_sweeps,
-                                                rocblas_int* n_sweeps,
-                                                float* S,
-                                                rocblas_stride stS,
-                                                rocblas_float_complex* U,
-                                                rocblas_int ldu,
-                                                rocblas_stride stU,
-                                                rocblas_float_complex* V,
-                                                rocblas_int ldv,
-                                                rocblas_stride stV,
-                                                rocblas_int* info,
-                                                rocblas_int bc)
+inline rocblas_status rocsolver_potri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_float_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* info,
+                                      rocblas_int batch_count)
 {
-    return STRIDED
-        ? rocsolver_cgesvdj_notransv_strided_batched(handle, leftv, rightv, m, n, A, lda, stA,
-                                                     abstol, residual, max_sweeps, n_sweeps, S, stS,
-                                                     U, ldu, stU, V, ldv, stV, info, bc)
-        : rocsolver_cgesvdj_notransv(handle, leftv, rightv, m, n, A, lda, abstol, residual,
-                                     max_sweeps, n_sweeps, S, U, ldu, V, ldv, info);
+    return rocsolver_cpotri_batched(handle, uplo, n, A, lda, info, batch_count);
 }
 
-inline rocblas_status rocsolver_gesvdj_notransv(bool STRIDED,
-                                                rocblas_handle handle,
-                                                rocblas_svect leftv,
-                                                rocblas_svect rightv,
-                                                rocblas_int m,
-                                                rocblas_int n,
-                                                rocblas_double_complex* A,
-                                                rocblas_int lda,
-                                                rocblas_stride stA,
-                                                double abstol,
-                                                double* residual,
-                                                rocblas_int max_sweeps,
-                                                rocblas_int* n_sweeps,
-                                                double* S,
-                                                rocblas_stride stS,
-                                                rocblas_double_complex* U,
-                                                rocblas_int ldu,
-                                                rocblas_stride stU,
-                                                rocblas_double_complex* V,
-                                                rocblas_int ldv,
-                                                rocblas_stride stV,
-                                                rocblas_int* info,
-                                                rocblas_int bc)
+inline rocblas_status rocsolver_potri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_double_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* info,
+                                      rocblas_int batch_count)
 {
-    return STRIDED
-        ? rocsolver_zgesvdj_notransv_strided_batched(handle, leftv, rightv, m, n, A, lda, stA,
-                                                     abstol, residual, max_sweeps, n_sweeps, S, stS,
+    return rocsolver_zpotri_batched(handle, uplo, n, A, lda, info, batch_count);
+}
+/********************************************************/
+
+/******************** GETF2_GETRF_NPVT ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_getf2_getrf_npvt(bool STRIDED,
+                                                 bool GETRF,
+                                                 rocblas_handle handle,
+                                                 rocblas_int m,
+                                                 rocblas_int n,
+                                                 float* A,
+                                                 rocblas_int lda,
+                                                 rocblas_stride stA,
+                                                 rocblas_int* info,
+                                                 rocblas_int bc)
+{
+    if(STRIDED)
+        return GETRF ? rocsolver_sgetrf_npvt_strided_batched(handle, m, n, A, lda, stA, info, bc)
+                     : rocsolver_sgetf2_npvt_strided_batched(handle, m, n, A, lda, stA, info, bc);
+    else
+        return GETRF ? rocsolver_sgetrf_npvt(handle, m, n, A, lda, info)
+                     : rocsolver_sgetf2_npvt(handle, m, n, A, lda, info);
+}
+
+inline rocblas_status rocsolver_getf2_getrf_npvt(bool STRIDED,
+                                                 bool GETRF,
+                                                 rocblas_handle handle,
+                                                 rocblas_int m,
+                                                 rocblas_int n,
+                                                 double* A,
+                                                 rocblas_int lda,
+                                                 rocblas_stride stA,
+                                                 rocblas_int* info,
+                                                 rocblas_int bc)
+{
+    if(STRIDED)
+        return GETRF ? rocsolver_dgetrf_npvt_strided_batched(handle, m, n, A, lda, stA, info, bc)
+                     : rocsolver_dgetf2_npvt_strided_batched(handle, m, n, A, lda, stA, info, bc);
+    else
+        return GETRF ? rocsolver_dgetrf_npvt(handle, m, n, A, lda, info)
+                     : rocsolver_dgetf2_npvt(handle, m, n, A, lda, info);
+}
+
+inline rocblas_status rocsolver_getf2_getrf_npvt(bool STRIDED,
+                                                 bool GETRF,
+                                                 rocblas_handle handle,
+                                                 rocblas_int m,
+                                                 rocblas_int n,
+                                                 rocblas_float_complex* A,
+                                                 rocblas_int lda,
+                                                 rocblas_stride stA,
+                                                 rocblas_int* info,
+                                                 rocblas_int bc)
+{
+    if(STRIDED)
+        return GETRF ? rocsolver_cgetrf_npvt_strided_batched(handle, m, n, A, lda, stA, info, bc)
+                     : rocsolver_cgetf2_npvt_strided_batched(handle, m, n, A, lda, stA, info, bc);
+    else
+        return GETRF ? rocsolver_cgetrf_npvt(handle, m, n, A, lda, info)
+                     : rocsolver_cgetf2_npvt(handle, m, n, A, lda, info);
+}
+
+inline rocblas_status rocsolver_getf2_getrf_npvt(bool STRIDED,
+                                                 bool GETRF,
+                                                 rocblas_handle handle,
+                                                 rocblas_int m,
+                                                 rocblas_int n,
+                                                 rocblas_double_complex* A,
+                                                 rocblas_int lda,
+                                                 rocblas_stride stA,
+                                                 rocblas_int* info,
+                                                 rocblas_int bc)
+{
+    if(STRIDED)
+        return GETRF ? rocsolver_zgetrf_npvt_strided_batched(handle, m, n, A, lda, stA, info, bc)
+                     : rocsolver_zgetf2_npvt_strided_batched(handle, m, n, A, lda, stA, info, bc);
+    else
+        return GETRF ? rocsolver_zgetrf_npvt(handle, m, n, A, lda, info)
+                     : rocsolver_zgetf2_npvt(handle, m, n, A, lda, info);
+}
+inline rocblas_status rocsolver_getf2_getrf_npvt(bool STRIDED,
+                                                 bool GETRF,
+                                                 rocblas_handle handle,
+                                                 int64_t m,
+                                                 int64_t n,
+                                                 float* A,
+                                                 int64_t lda,
+                                                 rocblas_stride stA,
+                                                 int64_t* info,
+                                                 int64_t bc)
+{
+    if(STRIDED)
+        return GETRF ? rocsolver_sgetrf_npvt_strided_batched_64(handle, m, n, A, lda, stA, info, bc)
+                     : rocsolver_sgetf2_npvt_strided_batched_64(handle, m, n, A, lda, stA, info, bc);
+    else
+        return GETRF ? rocsolver_sgetrf_npvt_64(handle, m, n, A, lda, info)
+                     : rocsolver_sgetf2_npvt_64(handle, m, n, A, lda, info);
+}
+
+inline rocblas_status rocsolver_getf2_getrf_npvt(bool STRIDED,
+                                                 bool GETRF,
+                                                 rocblas_handle handle,
+                                                 int64_t m,
+                                                 int64_t n,
+                                                 double* A,
+                                                 int64_t lda,
+                                                 rocblas_stride stA,
+                                                 int64_t* info,
+                                                 int64_t bc)
+{
+    if(STRIDED)
+        return GETRF ? rocsolver_dgetrf_npvt_strided_batched_64(handle, m, n, A, lda, stA, info, bc)
+                     : rocsolver_dgetf2_npvt_strided_batched_64(handle, m, n, A, lda, stA, info, bc);
+    else
+        return GETRF ? rocsolver_dgetrf_npvt_64(handle, m, n, A, lda, info)
+                     : rocsolver_dgetf2_npvt_64(handle, m, n, A, lda, info);
+}
+
+inline rocblas_status rocsolver_getf2_getrf_npvt(bool STRIDED,
+                                                 bool GETRF,
+                                                 rocblas_handle handle,
+                                                 int64_t m,
+                                                 int64_t n,
+                                                 rocblas_float_complex* A,
+                                                 int64_t lda,
+                                                 rocblas_stride stA,
+                                                 int64_t* info,
+                                                 int64_t bc)
+{
+    if(STRIDED)
+        return GETRF ? rocsolver_cgetrf_npvt_strided_batched_64(handle, m, n, A, lda, stA, info, bc)
+                     : rocsolver_cgetf2_npvt_strided_batched_64(handle, m, n, A, lda, stA, info, bc);
+    else
+        return GETRF ? rocsolver_cgetrf_npvt_64(handle, m, n, A, lda, info)
+                     : rocsolver_cgetf2_npvt_64(handle, m, n, A, lda, info);
+}
+
+inline rocblas_status rocsolver_getf2_getrf_npvt(bool STRIDED,
+                                                 bool GETRF,
+                                                 rocblas_handle handle,
+                                                 int64_t m,
+                                                 int64_t n,
+                                                 rocblas_double_complex* A,
+                                                 int64_t lda,
+                                                 rocblas_stride stA,
+                                                 int64_t* info,
+                                                 int64_t bc)
+{
+    if(STRIDED)
+        return GETRF ? rocsolver_zgetrf_npvt_strided_batched_64(handle, m, n, A, lda, stA, info, bc)
+                     : rocsolver_zgetf2_npvt_strided_batched_64(handle, m, n, A, lda, stA, info, bc);
+    else
+        return GETRF ? rocsolver_zgetrf_npvt_64(handle, m, n, A, lda, info)
+                     : rocsolver_zgetf2_npvt_64(handle, m, n, A, lda, info);
+}
+
+// batched
+inline rocblas_status rocsolver_getf2_getrf_npvt(bool STRIDED,
+                                                 bool GETRF,
+                                                 rocblas_handle handle,
+                                                 rocblas_int m,
+                                                 rocblas_int n,
+                                                 float* const A[],
+                                                 rocblas_int lda,
+                                                 rocblas_stride stA,
+                                                 rocblas_int* info,
+                                                 rocblas_int bc)
+{
+    return GETRF ? rocsolver_sgetrf_npvt_batched(handle, m, n, A, lda, info, bc)
+                 : rocsolver_sgetf2_npvt_batched(handle, m, n, A, lda, info, bc);
+}
+
+inline rocblas_status rocsolver_getf2_getrf_npvt(bool STRIDED,
+                                                 bool GETRF,
+                                                 rocblas_handle handle,
+                                                 rocblas_int m,
+                                                 rocblas_int n,
+                                                 double* const A[],
+                                                 rocblas_int lda,
+                                                 rocblas_stride stA,
+                                                 rocblas_int* info,
+                                                 rocblas_int bc)
+{
+    return GETRF ? rocsolver_dgetrf_npvt_batched(handle, m, n, A, lda, info, bc)
+                 : rocsolver_dgetf2_npvt_batched(handle, m, n, A, lda, info, bc);
+}
+
+inline rocblas_status rocsolver_getf2_getrf_npvt(bool STRIDED,
+                                                 bool GETRF,
+                                                 rocblas_handle handle,
+                                                 rocblas_int m,
+                                                 rocblas_int n,
+                                                 rocblas_float_complex* const A[],
+                                                 rocblas_int lda,
+                                                 rocblas_stride stA,
+                                                 rocblas_int* info,
+                                                 rocblas_int bc)
+{
+    return GETRF ? rocsolver_cgetrf_npvt_batched(handle, m, n, A, lda, info, bc)
+                 : rocsolver_cgetf2_npvt_batched(handle, m, n, A, lda, info, bc);
+}
+
+inline rocblas_status rocsolver_getf2_getrf_npvt(bool STRIDED,
+                                                 bool GETRF,
+                                                 rocblas_handle handle,
+                                                 rocblas_int m,
+                                                 rocblas_int n,
+                                                 rocblas_double_complex* const A[],
+                                                 rocblas_int lda,
+                                                 rocblas_stride stA,
+                                                 rocblas_int* info,
+                                                 rocblas_int bc)
+{
+    return GETRF ? rocsolver_zgetrf_npvt_batched(handle, m, n, A, lda, info, bc)
+                 : rocsolver_zgetf2_npvt_batched(handle, m, n, A, lda, info, bc);
+}
+
+inline rocblas_status rocsolver_getf2_getrf_npvt(bool STRIDED,
+                                                 bool GETRF,
+                                                 rocblas_handle handle,
+                                                 int64_t m,
+                                                 int64_t n,
+                                                 float* const A[],
+                                                 int64_t lda,
+                                                 rocblas_stride stA,
+                                                 int64_t* info,
+                                                 int64_t bc)
+{
+    return GETRF ? rocsolver_sgetrf_npvt_batched_64(handle, m, n, A, lda, info, bc)
+                 : rocsolver_sgetf2_npvt_batched_64(handle, m, n, A, lda, info, bc);
+}
+
+inline rocblas_status rocsolver_getf2_getrf_npvt(bool STRIDED,
+                                                 bool GETRF,
+                                                 rocblas_handle handle,
+                                                 int64_t m,
+                                                 int64_t n,
+                                                 double* const A[],
+                                                 int64_t lda,
+                                                 rocblas_stride stA,
+                                                 int64_t* info,
+                                                 int64_t bc)
+{
+    return GETRF ? rocsolver_dgetrf_npvt_batched_64(handle, m, n, A, lda, info, bc)
+                 : rocsolver_dgetf2_npvt_batched_64(handle, m, n, A, lda, info, bc);
+}
+
+inline rocblas_status rocsolver_getf2_getrf_npvt(bool STRIDED,
+                                                 bool GETRF,
+                                                 rocblas_handle handle,
+                                                 int64_t m,
+                                                 int64_t n,
+                                                 rocblas_float_complex* const A[],
+                                                 int64_t lda,
+                                                 rocblas_stride stA,
+                                                 int64_t* info,
+                                                 int64_t bc)
+{
+    return GETRF ? rocsolver_cgetrf_npvt_batched_64(handle, m, n, A, lda, info, bc)
+                 : rocsolver_cgetf2_npvt_batched_64(handle, m, n, A, lda, info, bc);
+}
+
+inline rocblas_status rocsolver_getf2_getrf_npvt(bool STRIDED,
+                                                 bool GETRF,
+                                                 rocblas_handle handle,
+                                                 int64_t m,
+                                                 int64_t n,
+                                                 rocblas_double_complex* const A[],
+                                                 int64_t lda,
+                                                 rocblas_stride stA,
+                                                 int64_t* info,
+                                                 int64_t bc)
+{
+    return GETRF ? rocsolver_zgetrf_npvt_batched_64(handle, m, n, A, lda, info, bc)
+                 : rocsolver_zgetf2_npvt_batched_64(handle, m, n, A, lda, info, bc);
+}
+/********************************************************/
+
+/******************** GETF2_GETRF ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_getf2_getrf(bool STRIDED,
+                                            bool GETRF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            float* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_int* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return GETRF
+            ? rocsolver_sgetrf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, info, bc)
+            : rocsolver_sgetf2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, info, bc);
+    else
+        return GETRF ? rocsolver_sgetrf(handle, m, n, A, lda, ipiv, info)
+                     : rocsolver_sgetf2(handle, m, n, A, lda, ipiv, info);
+}
+
+inline rocblas_status rocsolver_getf2_getrf(bool STRIDED,
+                                            bool GETRF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            double* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_int* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return GETRF
+            ? rocsolver_dgetrf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, info, bc)
+            : rocsolver_dgetf2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, info, bc);
+    else
+        return GETRF ? rocsolver_dgetrf(handle, m, n, A, lda, ipiv, info)
+                     : rocsolver_dgetf2(handle, m, n, A, lda, ipiv, info);
+}
+
+inline rocblas_status rocsolver_getf2_getrf(bool STRIDED,
+                                            bool GETRF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_float_complex* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_int* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return GETRF
+            ? rocsolver_cgetrf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, info, bc)
+            : rocsolver_cgetf2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, info, bc);
+    else
+        return GETRF ? rocsolver_cgetrf(handle, m, n, A, lda, ipiv, info)
+                     : rocsolver_cgetf2(handle, m, n, A, lda, ipiv, info);
+}
+
+inline rocblas_status rocsolver_getf2_getrf(bool STRIDED,
+                                            bool GETRF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_double_complex* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_int* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return GETRF
+            ? rocsolver_zgetrf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, info, bc)
+            : rocsolver_zgetf2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, info, bc);
+    else
+        return GETRF ? rocsolver_zgetrf(handle, m, n, A, lda, ipiv, info)
+                     : rocsolver_zgetf2(handle, m, n, A, lda, ipiv, info);
+}
+
+inline rocblas_status rocsolver_getf2_getrf(bool STRIDED,
+                                            bool GETRF,
+                                            rocblas_handle handle,
+                                            int64_t m,
+                                            int64_t n,
+                                            float* A,
+                                            int64_t lda,
+                                            rocblas_stride stA,
+                                            int64_t* ipiv,
+                                            rocblas_stride stP,
+                                            int64_t* info,
+                                            int64_t bc)
+{
+    if(STRIDED)
+        return GETRF
+            ? rocsolver_sgetrf_strided_batched_64(handle, m, n, A, lda, stA, ipiv, stP, info, bc)
+            : rocsolver_sgetf2_strided_batched_64(handle, m, n, A, lda, stA, ipiv, stP, info, bc);
+    else
+        return GETRF ? rocsolver_sgetrf_64(handle, m, n, A, lda, ipiv, info)
+                     : rocsolver_sgetf2_64(handle, m, n, A, lda, ipiv, info);
+}
+
+inline rocblas_status rocsolver_getf2_getrf(bool STRIDED,
+                                            bool GETRF,
+                                            rocblas_handle handle,
+                                            int64_t m,
+                                            int64_t n,
+                                            double* A,
+                                            int64_t lda,
+                                            rocblas_stride stA,
+                                            int64_t* ipiv,
+                                            rocblas_stride stP,
+                                            int64_t* info,
+                                            int64_t bc)
+{
+    if(STRIDED)
+        return GETRF
+            ? rocsolver_dgetrf_strided_batched_64(handle, m, n, A, lda, stA, ipiv, stP, info, bc)
+            : rocsolver_dgetf2_strided_batched_64(handle, m, n, A, lda, stA, ipiv, stP, info, bc);
+    else
+        return GETRF ? rocsolver_dgetrf_64(handle, m, n, A, lda, ipiv, info)
+                     : rocsolver_dgetf2_64(handle, m, n, A, lda, ipiv, info);
+}
+
+inline rocblas_status rocsolver_getf2_getrf(bool STRIDED,
+                                            bool GETRF,
+                                            rocblas_handle handle,
+                                            int64_t m,
+                                            int64_t n,
+                                            rocblas_float_complex* A,
+                                            int64_t lda,
+                                            rocblas_stride stA,
+                                            int64_t* ipiv,
+                                            rocblas_stride stP,
+                                            int64_t* info,
+                                            int64_t bc)
+{
+    if(STRIDED)
+        return GETRF
+            ? rocsolver_cgetrf_strided_batched_64(handle, m, n, A, lda, stA, ipiv, stP, info, bc)
+            : rocsolver_cgetf2_strided_batched_64(handle, m, n, A, lda, stA, ipiv, stP, info, bc);
+    else
+        return GETRF ? rocsolver_cgetrf_64(handle, m, n, A, lda, ipiv, info)
+                     : rocsolver_cgetf2_64(handle, m, n, A, lda, ipiv, info);
+}
+
+inline rocblas_status rocsolver_getf2_getrf(bool STRIDED,
+                                            bool GETRF,
+                                            rocblas_handle handle,
+                                            int64_t m,
+                                            int64_t n,
+                                            rocblas_double_complex* A,
+                                            int64_t lda,
+                                            rocblas_stride stA,
+                                            int64_t* ipiv,
+                                            rocblas_stride stP,
+                                            int64_t* info,
+                                            int64_t bc)
+{
+    if(STRIDED)
+        return GETRF
+            ? rocsolver_zgetrf_strided_batched_64(handle, m, n, A, lda, stA, ipiv, stP, info, bc)
+            : rocsolver_zgetf2_strided_batched_64(handle, m, n, A, lda, stA, ipiv, stP, info, bc);
+    else
+        return GETRF ? rocsolver_zgetrf_64(handle, m, n, A, lda, ipiv, info)
+                     : rocsolver_zgetf2_64(handle, m, n, A, lda, ipiv, info);
+}
+
+// batched
+inline rocblas_status rocsolver_getf2_getrf(bool STRIDED,
+                                            bool GETRF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            float* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_int* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
+{
+    return GETRF ? rocsolver_sgetrf_batched(handle, m, n, A, lda, ipiv, stP, info, bc)
+                 : rocsolver_sgetf2_batched(handle, m, n, A, lda, ipiv, stP, info, bc);
+}
+
+inline rocblas_status rocsolver_getf2_getrf(bool STRIDED,
+                                            bool GETRF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            double* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_int* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
+{
+    return GETRF ? rocsolver_dgetrf_batched(handle, m, n, A, lda, ipiv, stP, info, bc)
+                 : rocsolver_dgetf2_batched(handle, m, n, A, lda, ipiv, stP, info, bc);
+}
+
+inline rocblas_status rocsolver_getf2_getrf(bool STRIDED,
+                                            bool GETRF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_float_complex* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_int* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
+{
+    return GETRF ? rocsolver_cgetrf_batched(handle, m, n, A, lda, ipiv, stP, info, bc)
+                 : rocsolver_cgetf2_batched(handle, m, n, A, lda, ipiv, stP, info, bc);
+}
+
+inline rocblas_status rocsolver_getf2_getrf(bool STRIDED,
+                                            bool GETRF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_double_complex* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_int* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
+{
+    return GETRF ? rocsolver_zgetrf_batched(handle, m, n, A, lda, ipiv, stP, info, bc)
+                 : rocsolver_zgetf2_batched(handle, m, n, A, lda, ipiv, stP, info, bc);
+}
+
+inline rocblas_status rocsolver_getf2_getrf(bool STRIDED,
+                                            bool GETRF,
+                                            rocblas_handle handle,
+                                            int64_t m,
+                                            int64_t n,
+                                            float* const A[],
+                                            int64_t lda,
+                                            rocblas_stride stA,
+                                            int64_t* ipiv,
+                                            rocblas_stride stP,
+                                            int64_t* info,
+                                            int64_t bc)
+{
+    return GETRF ? rocsolver_sgetrf_batched_64(handle, m, n, A, lda, ipiv, stP, info, bc)
+                 : rocsolver_sgetf2_batched_64(handle, m, n, A, lda, ipiv, stP, info, bc);
+}
+
+inline rocblas_status rocsolver_getf2_getrf(bool STRIDED,
+                                            bool GETRF,
+                                            rocblas_handle handle,
+                                            int64_t m,
+                                            int64_t n,
+                                            double* const A[],
+                                            int64_t lda,
+                                            rocblas_stride stA,
+                                            int64_t* ipiv,
+                                            rocblas_stride stP,
+                                            int64_t* info,
+                                            int64_t bc)
+{
+    return GETRF ? rocsolver_dgetrf_batched_64(handle, m, n, A, lda, ipiv, stP, info, bc)
+                 : rocsolver_dgetf2_batched_64(handle, m, n, A, lda, ipiv, stP, info, bc);
+}
+
+inline rocblas_status rocsolver_getf2_getrf(bool STRIDED,
+                                            bool GETRF,
+                                            rocblas_handle handle,
+                                            int64_t m,
+                                            int64_t n,
+                                            rocblas_float_complex* const A[],
+                                            int64_t lda,
+                                            rocblas_stride stA,
+                                            int64_t* ipiv,
+                                            rocblas_stride stP,
+                                            int64_t* info,
+                                            int64_t bc)
+{
+    return GETRF ? rocsolver_cgetrf_batched_64(handle, m, n, A, lda, ipiv, stP, info, bc)
+                 : rocsolver_cgetf2_batched_64(handle, m, n, A, lda, ipiv, stP, info, bc);
+}
+
+inline rocblas_status rocsolver_getf2_getrf(bool STRIDED,
+                                            bool GETRF,
+                                            rocblas_handle handle,
+                                            int64_t m,
+                                            int64_t n,
+                                            rocblas_double_complex* const A[],
+                                            int64_t lda,
+                                            rocblas_stride stA,
+                                            int64_t* ipiv,
+                                            rocblas_stride stP,
+                                            int64_t* info,
+                                            int64_t bc)
+{
+    return GETRF ? rocsolver_zgetrf_batched_64(handle, m, n, A, lda, ipiv, stP, info, bc)
+                 : rocsolver_zgetf2_batched_64(handle, m, n, A, lda, ipiv, stP, info, bc);
+}
+/********************************************************/
+
+/******************** GETRF_INTERLEAVED ********************/
+inline rocblas_status rocsolver_getrf_interleaved(bool NPVT,
+                                                  rocblas_handle handle,
+                                                  rocblas_int m,
+                                                  rocblas_int n,
+                                                  float* A,
+                                                  rocblas_int inca,
+                                                  rocblas_int lda,
+                                                  rocblas_stride stA,
+                                                  rocblas_int* ipiv,
+                                                  rocblas_stride stP,
+                                                  rocblas_int* info,
+                                                  rocblas_int bc)
+{
+    return NPVT
+        ? rocsolver_sgetrf_npvt_interleaved_batched(handle, m, n, A, inca, lda, stA, info, bc)
+        : rocsolver_sgetrf_interleaved_batched(handle, m, n, A, inca, lda, stA, ipiv, stP, info,
+                                               bc);
+}
+
+inline rocblas_status rocsolver_getrf_interleaved(bool NPVT,
+                                                  rocblas_handle handle,
+                                                  rocblas_int m,
+                                                  rocblas_int n,
+                                                  double* A,
+                                                  rocblas_int inca,
+                                                  rocblas_int lda,
+                                                  rocblas_stride stA,
+                                                  rocblas_int* ipiv,
+                                                  rocblas_stride stP,
+                                                  rocblas_int* info,
+                                                  rocblas_int bc)
+{
+    return NPVT
+        ? rocsolver_dgetrf_npvt_interleaved_batched(handle, m, n, A, inca, lda, stA, info, bc)
+        : rocsolver_dgetrf_interleaved_batched(handle, m, n, A, inca, lda, stA, ipiv, stP, info,
+                                               bc);
+}
+
+inline rocblas_status rocsolver_getrf_interleaved(bool NPVT,
+                                                  rocblas_handle handle,
+                                                  rocblas_int m,
+                                                  rocblas_int n,
+                                                  rocblas_float_complex* A,
+                                                  rocblas_int inca,
+                                                  rocblas_int lda,
+                                                  rocblas_stride stA,
+                                                  rocblas_int* ipiv,
+                                                  rocblas_stride stP,
+                                                  rocblas_int* info,
+                                                  rocblas_int bc)
+{
+    return NPVT
+        ? rocsolver_cgetrf_npvt_interleaved_batched(handle, m, n, A, inca, lda, stA, info, bc)
+        : rocsolver_cgetrf_interleaved_batched(handle, m, n, A, inca, lda, stA, ipiv, stP, info,
+                                               bc);
+}
+
+inline rocblas_status rocsolver_getrf_interleaved(bool NPVT,
+                                                  rocblas_handle handle,
+                                                  rocblas_int m,
+                                                  rocblas_int n,
+                                                  rocblas_double_complex* A,
+                                                  rocblas_int inca,
+                                                  rocblas_int lda,
+                                                  rocblas_stride stA,
+                                                  rocblas_int* ipiv,
+                                                  rocblas_stride stP,
+                                                  rocblas_int* info,
+                                                  rocblas_int bc)
+{
+    return NPVT
+        ? rocsolver_zgetrf_npvt_interleaved_batched(handle, m, n, A, inca, lda, stA, info, bc)
+        : rocsolver_zgetrf_interleaved_batched(handle, m, n, A, inca, lda, stA, ipiv, stP, info,
+                                               bc);
+}
+/********************************************************/
+
+/******************** GETRF_VBATCHED ********************/
+inline rocblas_status rocsolver_getrf_vbatched(rocblas_handle handle,
+                                               rocblas_int* m,
+                                               rocblas_int* n,
+                                               float* const A[],
+                                               rocblas_int* lda,
+                                               rocblas_int* ipiv,
+                                               rocblas_stride stP,
+                                               rocblas_int* info,
+                                               rocblas_int bc)
+{
+    return rocsolver_sgetrf_vbatched(handle, m, n, A, lda, ipiv, stP, info, bc);
+}
+
+inline rocblas_status rocsolver_getrf_vbatched(rocblas_handle handle,
+                                               rocblas_int* m,
+                                               rocblas_int* n,
+                                               double* const A[],
+                                               rocblas_int* lda,
+                                               rocblas_int* ipiv,
+                                               rocblas_stride stP,
+                                               rocblas_int* info,
+                                               rocblas_int bc)
+{
+    return rocsolver_dgetrf_vbatched(handle, m, n, A, lda, ipiv, stP, info, bc);
+}
+
+inline rocblas_status rocsolver_getrf_vbatched(rocblas_handle handle,
+                                               rocblas_int* m,
+                                               rocblas_int* n,
+                                               rocblas_float_complex* const A[],
+                                               rocblas_int* lda,
+                                               rocblas_int* ipiv,
+                                               rocblas_stride stP,
+                                               rocblas_int* info,
+                                               rocblas_int bc)
+{
+    return rocsolver_cgetrf_vbatched(handle, m, n, A, lda, ipiv, stP, info, bc);
+}
+
+inline rocblas_status rocsolver_getrf_vbatched(rocblas_handle handle,
+                                               rocblas_int* m,
+                                               rocblas_int* n,
+                                               rocblas_double_complex* const A[],
+                                               rocblas_int* lda,
+                                               rocblas_int* ipiv,
+                                               rocblas_stride stP,
+                                               rocblas_int* info,
+                                               rocblas_int bc)
+{
+    return rocsolver_zgetrf_vbatched(handle, m, n, A, lda, ipiv, stP, info, bc);
+}
+/********************************************************/
+
+/******************** GESVD ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_gesvd(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_svect leftv,
+                                      rocblas_svect rightv,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      float* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* S,
+                                      rocblas_stride stS,
+                                      float* U,
+                                      rocblas_int ldu,
+                                      rocblas_stride stU,
+                                      float* V,
+                                      rocblas_int ldv,
+                                      rocblas_stride stV,
+                                      float* E,
+                                      rocblas_stride stE,
+                                      rocblas_workmode fast_alg,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return STRIDED
+        ? rocsolver_sgesvd_strided_batched(handle, leftv, rightv, m, n, A, lda, stA, S, stS, U, ldu,
+                                           stU, V, ldv, stV, E, stE, fast_alg, info, bc)
+        : rocsolver_sgesvd(handle, leftv, rightv, m, n, A, lda, S, U, ldu, V, ldv, E, fast_alg, info);
+}
+
+inline rocblas_status rocsolver_gesvd(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_svect leftv,
+                                      rocblas_svect rightv,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      double* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* S,
+                                      rocblas_stride stS,
+                                      double* U,
+                                      rocblas_int ldu,
+                                      rocblas_stride stU,
+                                      double* V,
+                                      rocblas_int ldv,
+                                      rocblas_stride stV,
+                                      double* E,
+                                      rocblas_stride stE,
+                                      rocblas_workmode fast_alg,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return STRIDED
+        ? rocsolver_dgesvd_strided_batched(handle, leftv, rightv, m, n, A, lda, stA, S, stS, U, ldu,
+                                           stU, V, ldv, stV, E, stE, fast_alg, info, bc)
+        : rocsolver_dgesvd(handle, leftv, rightv, m, n, A, lda, S, U, ldu, V, ldv, E, fast_alg, info);
+}
+
+inline rocblas_status rocsolver_gesvd(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_svect leftv,
+                                      rocblas_svect rightv,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_float_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* S,
+                                      rocblas_stride stS,
+                                      rocblas_float_complex* U,
+                                      rocblas_int ldu,
+                                      rocblas_stride stU,
+                                      rocblas_float_complex* V,
+                                      rocblas_int ldv,
+                                      rocblas_stride stV,
+                                      float* E,
+                                      rocblas_stride stE,
+                                      rocblas_workmode fast_alg,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return STRIDED
+        ? rocsolver_cgesvd_strided_batched(handle, leftv, rightv, m, n, A, lda, stA, S, stS, U, ldu,
+                                           stU, V, ldv, stV, E, stE, fast_alg, info, bc)
+        : rocsolver_cgesvd(handle, leftv, rightv, m, n, A, lda, S, U, ldu, V, ldv, E, fast_alg, info);
+}
+
+inline rocblas_status rocsolver_gesvd(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_svect leftv,
+                                      rocblas_svect rightv,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_double_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* S,
+                                      rocblas_stride stS,
+                                      rocblas_double_complex* U,
+                                      rocblas_int ldu,
+                                      rocblas_stride stU,
+                                      rocblas_double_complex* V,
+                                      rocblas_int ldv,
+                                      rocblas_stride stV,
+                                      double* E,
+                                      rocblas_stride stE,
+                                      rocblas_workmode fast_alg,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return STRIDED
+        ? rocsolver_zgesvd_strided_batched(handle, leftv, rightv, m, n, A, lda, stA, S, stS, U, ldu,
+                                           stU, V, ldv, stV, E, stE, fast_alg, info, bc)
+        : rocsolver_zgesvd(handle, leftv, rightv, m, n, A, lda, S, U, ldu, V, ldv, E, fast_alg, info);
+}
+
+// batched
+inline rocblas_status rocsolver_gesvd(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_svect leftv,
+                                      rocblas_svect rightv,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      float* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* S,
+                                      rocblas_stride stS,
+                                      float* U,
+                                      rocblas_int ldu,
+                                      rocblas_stride stU,
+                                      float* V,
+                                      rocblas_int ldv,
+                                      rocblas_stride stV,
+                                      float* E,
+                                      rocblas_stride stE,
+                                      rocblas_workmode fast_alg,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return rocsolver_sgesvd_batched(handle, leftv, rightv, m, n, A, lda, S, stS, U, ldu, stU, V,
+                                    ldv, stV, E, stE, fast_alg, info, bc);
+}
+
+inline rocblas_status rocsolver_gesvd(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_svect leftv,
+                                      rocblas_svect rightv,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      double* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* S,
+                                      rocblas_stride stS,
+                                      double* U,
+                                      rocblas_int ldu,
+                                      rocblas_stride stU,
+                                      double* V,
+                                      rocblas_int ldv,
+                                      rocblas_stride stV,
+                                      double* E,
+                                      rocblas_stride stE,
+                                      rocblas_workmode fast_alg,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return rocsolver_dgesvd_batched(handle, leftv, rightv, m, n, A, lda, S, stS, U, ldu, stU, V,
+                                    ldv, stV, E, stE, fast_alg, info, bc);
+}
+
+inline rocblas_status rocsolver_gesvd(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_svect leftv,
+                                      rocblas_svect rightv,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_float_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* S,
+                                      rocblas_stride stS,
+                                      rocblas_float_complex* U,
+                                      rocblas_int ldu,
+                                      rocblas_stride stU,
+                                      rocblas_float_complex* V,
+                                      rocblas_int ldv,
+                                      rocblas_stride stV,
+                                      float* E,
+                                      rocblas_stride stE,
+                                      rocblas_workmode fast_alg,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return rocsolver_cgesvd_batched(handle, leftv, rightv, m, n, A, lda, S, stS, U, ldu, stU, V,
+                                    ldv, stV, E, stE, fast_alg, info, bc);
+}
+
+inline rocblas_status rocsolver_gesvd(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_svect leftv,
+                                      rocblas_svect rightv,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_double_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* S,
+                                      rocblas_stride stS,
+                                      rocblas_double_complex* U,
+                                      rocblas_int ldu,
+                                      rocblas_stride stU,
+                                      rocblas_double_complex* V,
+                                      rocblas_int ldv,
+                                      rocblas_stride stV,
+                                      double* E,
+                                      rocblas_stride stE,
+                                      rocblas_workmode fast_alg,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return rocsolver_zgesvd_batched(handle, leftv, rightv, m, n, A, lda, S, stS, U, ldu, stU, V,
+                                    ldv, stV, E, stE, fast_alg, info, bc);
+}
+/********************************************************/
+
+/******************** GESVDJ ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_gesvdj(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_svect leftv,
+                                       rocblas_svect rightv,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       float* A,
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       float abstol,
+                                       float* residual,
+                                       rocblas_int max_sweeps,
+                                       rocblas_int* n_sweeps,
+                                       float* S,
+                                       rocblas_stride stS,
+                                       float* U,
+                                       rocblas_int ldu,
+                                       rocblas_stride stU,
+                                       float* V,
+                                       rocblas_int ldv,
+                                       rocblas_stride stV,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return STRIDED ? rocsolver_sgesvdj_strided_batched(handle, leftv, rightv, m, n, A, lda, stA,
+                                                       abstol, residual, max_sweeps, n_sweeps, S,
+                                                       stS, U, ldu, stU, V, ldv, stV, info, bc)
+                   : rocsolver_sgesvdj(handle, leftv, rightv, m, n, A, lda, abstol, residual,
+                                       max_sweeps, n_sweeps, S, U, ldu, V, ldv, info);
+}
+
+inline rocblas_status rocsolver_gesvdj(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_svect leftv,
+                                       rocblas_svect rightv,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       double* A,
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       double abstol,
+                                       double* residual,
+                                       rocblas_int max_sweeps,
+                                       rocblas_int* n_sweeps,
+                                       double* S,
+                                       rocblas_stride stS,
+                                       double* U,
+                                       rocblas_int ldu,
+                                       rocblas_stride stU,
+                                       double* V,
+                                       rocblas_int ldv,
+                                       rocblas_stride stV,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return STRIDED ? rocsolver_dgesvdj_strided_batched(handle, leftv, rightv, m, n, A, lda, stA,
+                                                       abstol, residual, max_sweeps, n_sweeps, S,
+                                                       stS, U, ldu, stU, V, ldv, stV, info, bc)
+                   : rocsolver_dgesvdj(handle, leftv, rightv, m, n, A, lda, abstol, residual,
+                                       max_sweeps, n_sweeps, S, U, ldu, V, ldv, info);
+}
+
+inline rocblas_status rocsolver_gesvdj(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_svect leftv,
+                                       rocblas_svect rightv,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       rocblas_float_complex* A,
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       float abstol,
+                                       float* residual,
+                                       rocblas_int max_sweeps,
+                                       rocblas_int* n_sweeps,
+                                       float* S,
+                                       rocblas_stride stS,
+                                       rocblas_float_complex* U,
+                                       rocblas_int ldu,
+                                       rocblas_stride stU,
+                                       rocblas_float_complex* V,
+                                       rocblas_int ldv,
+                                       rocblas_stride stV,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return STRIDED ? rocsolver_cgesvdj_strided_batched(handle, leftv, rightv, m, n, A, lda, stA,
+                                                       abstol, residual, max_sweeps, n_sweeps, S,
+                                                       stS, U, ldu, stU, V, ldv, stV, info, bc)
+                   : rocsolver_cgesvdj(handle, leftv, rightv, m, n, A, lda, abstol, residual,
+                                       max_sweeps, n_sweeps, S, U, ldu, V, ldv, info);
+}
+
+inline rocblas_status rocsolver_gesvdj(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_svect leftv,
+                                       rocblas_svect rightv,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       rocblas_double_complex* A,
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       double abstol,
+                                       double* residual,
+                                       rocblas_int max_sweeps,
+                                       rocblas_int* n_sweeps,
+                                       double* S,
+                                       rocblas_stride stS,
+                                       rocblas_double_complex* U,
+                                       rocblas_int ldu,
+                                       rocblas_stride stU,
+                                       rocblas_double_complex* V,
+                                       rocblas_int ldv,
+                                       rocblas_stride stV,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return STRIDED ? rocsolver_zgesvdj_strided_batched(handle, leftv, rightv, m, n, A, lda, stA,
+                                                       abstol, residual, max_sweeps, n_sweeps, S,
+                                                       stS, U, ldu, stU, V, ldv, stV, info, bc)
+                   : rocsolver_zgesvdj(handle, leftv, rightv, m, n, A, lda, abstol, residual,
+                                       max_sweeps, n_sweeps, S, U, ldu, V, ldv, info);
+}
+
+// batched
+inline rocblas_status rocsolver_gesvdj(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_svect leftv,
+                                       rocblas_svect rightv,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       float* const A[],
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       float abstol,
+                                       float* residual,
+                                       rocblas_int max_sweeps,
+                                       rocblas_int* n_sweeps,
+                                       float* S,
+                                       rocblas_stride stS,
+                                       float* U,
+                                       rocblas_int ldu,
+                                       rocblas_stride stU,
+                                       float* V,
+                                       rocblas_int ldv,
+                                       rocblas_stride stV,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return rocsolver_sgesvdj_batched(handle, leftv, rightv, m, n, A, lda, abstol, residual,
+                                     max_sweeps, n_sweeps, S, stS, U, ldu, stU, V, ldv, stV, info,
+                                     bc);
+}
+
+inline rocblas_status rocsolver_gesvdj(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_svect leftv,
+                                       rocblas_svect rightv,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       double* const A[],
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       double abstol,
+                                       double* residual,
+                                       rocblas_int max_sweeps,
+                                       rocblas_int* n_sweeps,
+                                       double* S,
+                                       rocblas_stride stS,
+                                       double* U,
+                                       rocblas_int ldu,
+                                       rocblas_stride stU,
+                                       double* V,
+                                       rocblas_int ldv,
+                                       rocblas_stride stV,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return rocsolver_dgesvdj_batched(handle, leftv, rightv, m, n, A, lda, abstol, residual,
+                                     max_sweeps, n_sweeps, S, stS, U, ldu, stU, V, ldv, stV, info,
+                                     bc);
+}
+
+inline rocblas_status rocsolver_gesvdj(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_svect leftv,
+                                       rocblas_svect rightv,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       rocblas_float_complex* const A[],
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       float abstol,
+                                       float* residual,
+                                       rocblas_int max_sweeps,
+                                       rocblas_int* n_sweeps,
+                                       float* S,
+                                       rocblas_stride stS,
+                                       rocblas_float_complex* U,
+                                       rocblas_int ldu,
+                                       rocblas_stride stU,
+                                       rocblas_float_complex* V,
+                                       rocblas_int ldv,
+                                       rocblas_stride stV,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return rocsolver_cgesvdj_batched(handle, leftv, rightv, m, n, A, lda, abstol, residual,
+                                     max_sweeps, n_sweeps, S, stS, U, ldu, stU, V, ldv, stV, info,
+                                     bc);
+}
+
+inline rocblas_status rocsolver_gesvdj(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_svect leftv,
+                                       rocblas_svect rightv,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       rocblas_double_complex* const A[],
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       double abstol,
+                                       double* residual,
+                                       rocblas_int max_sweeps,
+                                       rocblas_int* n_sweeps,
+                                       double* S,
+                                       rocblas_stride stS,
+                                       rocblas_double_complex* U,
+                                       rocblas_int ldu,
+                                       rocblas_stride stU,
+                                       rocblas_double_complex* V,
+                                       rocblas_int ldv,
+                                       rocblas_stride stV,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return rocsolver_zgesvdj_batched(handle, leftv, rightv, m, n, A, lda, abstol, residual,
+                                     max_sweeps, n_sweeps, S, stS, U, ldu, stU, V, ldv, stV, info,
+                                     bc);
+}
+/********************************************************/
+
+/******************** GESVDR ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_gesvdr(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_svect leftv,
+                                       rocblas_svect rightv,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       float* A,
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       rocblas_int k,
+                                       rocblas_int oversample,
+                                       rocblas_int niter,
+                                       float* S,
+                                       rocblas_stride stS,
+                                       float* U,
+                                       rocblas_int ldu,
+                                       rocblas_stride stU,
+                                       float* V,
+                                       rocblas_int ldv,
+                                       rocblas_stride stV,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return STRIDED ? rocsolver_sgesvdr_strided_batched(handle, leftv, rightv, m, n, A, lda, stA, k,
+                                                       oversample, niter, S, stS, U, ldu, stU, V,
+                                                       ldv, stV, info, bc)
+                   : rocsolver_sgesvdr(handle, leftv, rightv, m, n, A, lda, k, oversample, niter,
+                                       S, U, ldu, V, ldv, info);
+}
+
+inline rocblas_status rocsolver_gesvdr(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_svect leftv,
+                                       rocblas_svect rightv,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       double* A,
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       rocblas_int k,
+                                       rocblas_int oversample,
+                                       rocblas_int niter,
+                                       double* S,
+                                       rocblas_stride stS,
+                                       double* U,
+                                       rocblas_int ldu,
+                                       rocblas_stride stU,
+                                       double* V,
+                                       rocblas_int ldv,
+                                       rocblas_stride stV,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return STRIDED ? rocsolver_dgesvdr_strided_batched(handle, leftv, rightv, m, n, A, lda, stA, k,
+                                                       oversample, niter, S, stS, U, ldu, stU, V,
+                                                       ldv, stV, info, bc)
+                   : rocsolver_dgesvdr(handle, leftv, rightv, m, n, A, lda, k, oversample, niter,
+                                       S, U, ldu, V, ldv, info);
+}
+
+inline rocblas_status rocsolver_gesvdr(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_svect leftv,
+                                       rocblas_svect rightv,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       rocblas_float_complex* A,
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       rocblas_int k,
+                                       rocblas_int oversample,
+                                       rocblas_int niter,
+                                       float* S,
+                                       rocblas_stride stS,
+                                       rocblas_float_complex* U,
+                                       rocblas_int ldu,
+                                       rocblas_stride stU,
+                                       rocblas_float_complex* V,
+                                       rocblas_int ldv,
+                                       rocblas_stride stV,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return STRIDED ? rocsolver_cgesvdr_strided_batched(handle, leftv, rightv, m, n, A, lda, stA, k,
+                                                       oversample, niter, S, stS, U, ldu, stU, V,
+                                                       ldv, stV, info, bc)
+                   : rocsolver_cgesvdr(handle, leftv, rightv, m, n, A, lda, k, oversample, niter,
+                                       S, U, ldu, V, ldv, info);
+}
+
+inline rocblas_status rocsolver_gesvdr(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_svect leftv,
+                                       rocblas_svect rightv,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       rocblas_double_complex* A,
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       rocblas_int k,
+                                       rocblas_int oversample,
+                                       rocblas_int niter,
+                                       double* S,
+                                       rocblas_stride stS,
+                                       rocblas_double_complex* U,
+                                       rocblas_int ldu,
+                                       rocblas_stride stU,
+                                       rocblas_double_complex* V,
+                                       rocblas_int ldv,
+                                       rocblas_stride stV,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return STRIDED ? rocsolver_zgesvdr_strided_batched(handle, leftv, rightv, m, n, A, lda, stA, k,
+                                                       oversample, niter, S, stS, U, ldu, stU, V,
+                                                       ldv, stV, info, bc)
+                   : rocsolver_zgesvdr(handle, leftv, rightv, m, n, A, lda, k, oversample, niter,
+                                       S, U, ldu, V, ldv, info);
+}
+
+// batched
+inline rocblas_status rocsolver_gesvdr(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_svect leftv,
+                                       rocblas_svect rightv,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       float* const A[],
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       rocblas_int k,
+                                       rocblas_int oversample,
+                                       rocblas_int niter,
+                                       float* S,
+                                       rocblas_stride stS,
+                                       float* U,
+                                       rocblas_int ldu,
+                                       rocblas_stride stU,
+                                       float* V,
+                                       rocblas_int ldv,
+                                       rocblas_stride stV,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return rocsolver_sgesvdr_batched(handle, leftv, rightv, m, n, A, lda, k, oversample, niter, S,
+                                     stS, U, ldu, stU, V, ldv, stV, info, bc);
+}
+
+inline rocblas_status rocsolver_gesvdr(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_svect leftv,
+                                       rocblas_svect rightv,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       double* const A[],
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       rocblas_int k,
+                                       rocblas_int oversample,
+                                       rocblas_int niter,
+                                       double* S,
+                                       rocblas_stride stS,
+                                       double* U,
+                                       rocblas_int ldu,
+                                       rocblas_stride stU,
+                                       double* V,
+                                       rocblas_int ldv,
+                                       rocblas_stride stV,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return rocsolver_dgesvdr_batched(handle, leftv, rightv, m, n, A, lda, k, oversample, niter, S,
+                                     stS, U, ldu, stU, V, ldv, stV, info, bc);
+}
+
+inline rocblas_status rocsolver_gesvdr(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_svect leftv,
+                                       rocblas_svect rightv,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       rocblas_float_complex* const A[],
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       rocblas_int k,
+                                       rocblas_int oversample,
+                                       rocblas_int niter,
+                                       float* S,
+                                       rocblas_stride stS,
+                                       rocblas_float_complex* U,
+                                       rocblas_int ldu,
+                                       rocblas_stride stU,
+                                       rocblas_float_complex* V,
+                                       rocblas_int ldv,
+                                       rocblas_stride stV,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return rocsolver_cgesvdr_batched(handle, leftv, rightv, m, n, A, lda, k, oversample, niter, S,
+                                     stS, U, ldu, stU, V, ldv, stV, info, bc);
+}
+
+inline rocblas_status rocsolver_gesvdr(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_svect leftv,
+                                       rocblas_svect rightv,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       rocblas_double_complex* const A[],
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       rocblas_int k,
+                                       rocblas_int oversample,
+                                       rocblas_int niter,
+                                       double* S,
+                                       rocblas_stride stS,
+                                       rocblas_double_complex* U,
+                                       rocblas_int ldu,
+                                       rocblas_stride stU,
+                                       rocblas_double_complex* V,
+                                       rocblas_int ldv,
+                                       rocblas_stride stV,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return rocsolver_zgesvdr_batched(handle, leftv, rightv, m, n, A, lda, k, oversample, niter, S,
+                                     stS, U, ldu, stU, V, ldv, stV, info, bc);
+}
+/********************************************************/
+
+/******************** CHOLQR ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_cholqr(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       float* A,
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       float* R,
+                                       rocblas_int ldr,
+                                       rocblas_stride stR,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return STRIDED ? rocsolver_scholqr_strided_batched(handle, m, n, A, lda, stA, R, ldr, stR, info,
+                                                       bc)
+                   : rocsolver_scholqr(handle, m, n, A, lda, R, ldr, info);
+}
+
+inline rocblas_status rocsolver_cholqr(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       double* A,
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       double* R,
+                                       rocblas_int ldr,
+                                       rocblas_stride stR,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return STRIDED ? rocsolver_dcholqr_strided_batched(handle, m, n, A, lda, stA, R, ldr, stR, info,
+                                                       bc)
+                   : rocsolver_dcholqr(handle, m, n, A, lda, R, ldr, info);
+}
+
+inline rocblas_status rocsolver_cholqr(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       rocblas_float_complex* A,
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       rocblas_float_complex* R,
+                                       rocblas_int ldr,
+                                       rocblas_stride stR,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return STRIDED ? rocsolver_ccholqr_strided_batched(handle, m, n, A, lda, stA, R, ldr, stR, info,
+                                                       bc)
+                   : rocsolver_ccholqr(handle, m, n, A, lda, R, ldr, info);
+}
+
+inline rocblas_status rocsolver_cholqr(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       rocblas_double_complex* A,
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       rocblas_double_complex* R,
+                                       rocblas_int ldr,
+                                       rocblas_stride stR,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return STRIDED ? rocsolver_zcholqr_strided_batched(handle, m, n, A, lda, stA, R, ldr, stR, info,
+                                                       bc)
+                   : rocsolver_zcholqr(handle, m, n, A, lda, R, ldr, info);
+}
+
+// batched
+inline rocblas_status rocsolver_cholqr(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       float* const A[],
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       float* R,
+                                       rocblas_int ldr,
+                                       rocblas_stride stR,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return rocsolver_scholqr_batched(handle, m, n, A, lda, R, ldr, stR, info, bc);
+}
+
+inline rocblas_status rocsolver_cholqr(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       double* const A[],
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       double* R,
+                                       rocblas_int ldr,
+                                       rocblas_stride stR,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return rocsolver_dcholqr_batched(handle, m, n, A, lda, R, ldr, stR, info, bc);
+}
+
+inline rocblas_status rocsolver_cholqr(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       rocblas_float_complex* const A[],
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       rocblas_float_complex* R,
+                                       rocblas_int ldr,
+                                       rocblas_stride stR,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return rocsolver_ccholqr_batched(handle, m, n, A, lda, R, ldr, stR, info, bc);
+}
+
+inline rocblas_status rocsolver_cholqr(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       rocblas_double_complex* const A[],
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       rocblas_double_complex* R,
+                                       rocblas_int ldr,
+                                       rocblas_stride stR,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return rocsolver_zcholqr_batched(handle, m, n, A, lda, R, ldr, stR, info, bc);
+}
+/********************************************************/
+
+/******************** GEPOLAR ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_gepolar(bool STRIDED,
+                                        rocblas_handle handle,
+                                        rocblas_int m,
+                                        rocblas_int n,
+                                        float* A,
+                                        rocblas_int lda,
+                                        rocblas_stride stA,
+                                        float* H,
+                                        rocblas_int ldh,
+                                        rocblas_stride stH,
+                                        rocblas_int* info,
+                                        rocblas_int bc)
+{
+    return STRIDED ? rocsolver_sgepolar_strided_batched(handle, m, n, A, lda, stA, H, ldh, stH,
+                                                        info, bc)
+                   : rocsolver_sgepolar(handle, m, n, A, lda, H, ldh, info);
+}
+
+inline rocblas_status rocsolver_gepolar(bool STRIDED,
+                                        rocblas_handle handle,
+                                        rocblas_int m,
+                                        rocblas_int n,
+                                        double* A,
+                                        rocblas_int lda,
+                                        rocblas_stride stA,
+                                        double* H,
+                                        rocblas_int ldh,
+                                        rocblas_stride stH,
+                                        rocblas_int* info,
+                                        rocblas_int bc)
+{
+    return STRIDED ? rocsolver_dgepolar_strided_batched(handle, m, n, A, lda, stA, H, ldh, stH,
+                                                        info, bc)
+                   : rocsolver_dgepolar(handle, m, n, A, lda, H, ldh, info);
+}
+
+inline rocblas_status rocsolver_gepolar(bool STRIDED,
+                                        rocblas_handle handle,
+                                        rocblas_int m,
+                                        rocblas_int n,
+                                        rocblas_float_complex* A,
+                                        rocblas_int lda,
+                                        rocblas_stride stA,
+                                        rocblas_float_complex* H,
+                                        rocblas_int ldh,
+                                        rocblas_stride stH,
+                                        rocblas_int* info,
+                                        rocblas_int bc)
+{
+    return STRIDED ? rocsolver_cgepolar_strided_batched(handle, m, n, A, lda, stA, H, ldh, stH,
+                                                        info, bc)
+                   : rocsolver_cgepolar(handle, m, n, A, lda, H, ldh, info);
+}
+
+inline rocblas_status rocsolver_gepolar(bool STRIDED,
+                                        rocblas_handle handle,
+                                        rocblas_int m,
+                                        rocblas_int n,
+                                        rocblas_double_complex* A,
+                                        rocblas_int lda,
+                                        rocblas_stride stA,
+                                        rocblas_double_complex* H,
+                                        rocblas_int ldh,
+                                        rocblas_stride stH,
+                                        rocblas_int* info,
+                                        rocblas_int bc)
+{
+    return STRIDED ? rocsolver_zgepolar_strided_batched(handle, m, n, A, lda, stA, H, ldh, stH,
+                                                        info, bc)
+                   : rocsolver_zgepolar(handle, m, n, A, lda, H, ldh, info);
+}
+
+// batched
+inline rocblas_status rocsolver_gepolar(bool STRIDED,
+                                        rocblas_handle handle,
+                                        rocblas_int m,
+                                        rocblas_int n,
+                                        float* const A[],
+                                        rocblas_int lda,
+                                        rocblas_stride stA,
+                                        float* H,
+                                        rocblas_int ldh,
+                                        rocblas_stride stH,
+                                        rocblas_int* info,
+                                        rocblas_int bc)
+{
+    return rocsolver_sgepolar_batched(handle, m, n, A, lda, H, ldh, stH, info, bc);
+}
+
+inline rocblas_status rocsolver_gepolar(bool STRIDED,
+                                        rocblas_handle handle,
+                                        rocblas_int m,
+                                        rocblas_int n,
+                                        double* const A[],
+                                        rocblas_int lda,
+                                        rocblas_stride stA,
+                                        double* H,
+                                        rocblas_int ldh,
+                                        rocblas_stride stH,
+                                        rocblas_int* info,
+                                        rocblas_int bc)
+{
+    return rocsolver_dgepolar_batched(handle, m, n, A, lda, H, ldh, stH, info, bc);
+}
+
+inline rocblas_status rocsolver_gepolar(bool STRIDED,
+                                        rocblas_handle handle,
+                                        rocblas_int m,
+                                        rocblas_int n,
+                                        rocblas_float_complex* const A[],
+                                        rocblas_int lda,
+                                        rocblas_stride stA,
+                                        rocblas_float_complex* H,
+                                        rocblas_int ldh,
+                                        rocblas_stride stH,
+                                        rocblas_int* info,
+                                        rocblas_int bc)
+{
+    return rocsolver_cgepolar_batched(handle, m, n, A, lda, H, ldh, stH, info, bc);
+}
+
+inline rocblas_status rocsolver_gepolar(bool STRIDED,
+                                        rocblas_handle handle,
+                                        rocblas_int m,
+                                        rocblas_int n,
+                                        rocblas_double_complex* const A[],
+                                        rocblas_int lda,
+                                        rocblas_stride stA,
+                                        rocblas_double_complex* H,
+                                        rocblas_int ldh,
+                                        rocblas_stride stH,
+                                        rocblas_int* info,
+                                        rocblas_int bc)
+{
+    return rocsolver_zgepolar_batched(handle, m, n, A, lda, H, ldh, stH, info, bc);
+}
+/********************************************************/
+
+/******************** GESVDJ_NOTRANSV ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_gesvdj_notransv(bool STRIDED,
+                                                rocblas_handle handle,
+                                                rocblas_svect leftv,
+                                                rocblas_svect rightv,
+                                                rocblas_int m,
+                                                rocblas_int n,
+                                                float* A,
+                                                rocblas_int lda,
+                                                rocblas_stride stA,
+                                                float abstol,
+                                                float* residual,
+                                                rocblas_int max_sweeps,
+                                                rocblas_int* n_sweeps,
+                                                float* S,
+                                                rocblas_stride stS,
+                                                float* U,
+                                                rocblas_int ldu,
+                                                rocblas_stride stU,
+                                                float* V,
+                                                rocblas_int ldv,
+                                                rocblas_stride stV,
+                                                rocblas_int* info,
+                                                rocblas_int bc)
+{
+    return STRIDED
+        ? rocsolver_sgesvdj_notransv_strided_batched(handle, leftv, rightv, m, n, A, lda, stA,
+                                                     abstol, residual, max_sweeps, n_sweeps, S, stS,
+                                                     U, ldu, stU, V, ldv, stV, info, bc)
+        : rocsolver_sgesvdj_notransv(handle, leftv, rightv, m, n, A, lda, abstol, residual,
+                                     max_sweeps, n_sweeps, S, U, ldu, V, ldv, info);
+}
+
+inline rocblas_status rocsolver_gesvdj_notransv(bool STRIDED,
+                                                rocblas_handle handle,
+                                                rocblas_svect leftv,
+                                                rocblas_svect rightv,
+                                                rocblas_int m,
+                                                rocblas_int n,
+                                                double* A,
+                                                rocblas_int lda,
+                                                rocblas_stride stA,
+                                                double abstol,
+                                                double* residual,
+                                                rocblas_int max_sweeps,
+                                                rocblas_int* n_sweeps,
+                                                double* S,
+                                                rocblas_stride stS,
+                                                double* U,
+                                                rocblas_int ldu,
+                                                rocblas_stride stU,
+                                                double* V,
+                                                rocblas_int ldv,
+                                                rocblas_stride stV,
+                                                rocblas_int* info,
+                                                rocblas_int bc)
+{
+    return STRIDED
+        ? rocsolver_dgesvdj_notransv_strided_batched(handle, leftv, rightv, m, n, A, lda, stA,
+                                                     abstol, residual, max_sweeps, n_sweeps, S, stS,
+                                                     U, ldu, stU, V, ldv, stV, info, bc)
+        : rocsolver_dgesvdj_notransv(handle, leftv, rightv, m, n, A, lda, abstol, residual,
+                                     max_sweeps, n_sweeps, S, U, ldu, V, ldv, info);
+}
+
+inline rocblas_status rocsolver_gesvdj_notransv(bool STRIDED,
+                                                rocblas_handle handle,
+                                                rocblas_svect leftv,
+                                                rocblas_svect rightv,
+                                                rocblas_int m,
+                                                rocblas_int n,
+                                                rocblas_float_complex* A,
+                                                rocblas_int lda,
+                                                rocblas_stride stA,
+                                                float abstol,
+                                                float* residual,
+                                                rocblas_int max_sweeps,
+                                                rocblas_int* n_sweeps,
+                                                float* S,
+                                                rocblas_stride stS,
+                                                rocblas_float_complex* U,
+                                                rocblas_int ldu,
+                                                rocblas_stride stU,
+                                                rocblas_float_complex* V,
+                                                rocblas_int ldv,
+                                                rocblas_stride stV,
+                                                rocblas_int* info,
+                                                rocblas_int bc)
+{
+    return STRIDED
+        ? rocsolver_cgesvdj_notransv_strided_batched(handle, leftv, rightv, m, n, A, lda, stA,
+                                                     abstol, residual, max_sweeps, n_sweeps, S, stS,
+                                                     U, ldu, stU, V, ldv, stV, info, bc)
+        : rocsolver_cgesvdj_notransv(handle, leftv, rightv, m, n, A, lda, abstol, residual,
+                                     max_sweeps, n_sweeps, S, U, ldu, V, ldv, info);
+}
+
+inline rocblas_status rocsolver_gesvdj_notransv(bool STRIDED,
+                                                rocblas_handle handle,
+                                                rocblas_svect leftv,
+                                                rocblas_svect rightv,
+                                                rocblas_int m,
+                                                rocblas_int n,
+                                                rocblas_double_complex* A,
+                                                rocblas_int lda,
+                                                rocblas_stride stA,
+                                                double abstol,
+                                                double* residual,
+                                                rocblas_int max_sweeps,
+                                                rocblas_int* n_sweeps,
+                                                double* S,
+                                                rocblas_stride stS,
+                                                rocblas_double_complex* U,
+                                                rocblas_int ldu,
+                                                rocblas_stride stU,
+                                                rocblas_double_complex* V,
+                                                rocblas_int ldv,
+                                                rocblas_stride stV,
+                                                rocblas_int* info,
+                                                rocblas_int bc)
+{
+    return STRIDED
+        ? rocsolver_zgesvdj_notransv_strided_batched(handle, leftv, rightv, m, n, A, lda, stA,
+                                                     abstol, residual, max_sweeps, n_sweeps, S, stS,
                                                      U, ldu, stU, V, ldv, stV, info, bc)
         : rocsolver_zgesvdj_notransv(handle, leftv, rightv, m, n, A, lda, abstol, residual,
                                      max_sweeps, n_sweeps, S, U, ldu, V, ldv, info);
 }
 
 // batched
-inline rocblas_status rocsolver_gesvdj_notransv(bool STRIDED,
+inline rocblas_status rocsolver_gesvdj_notransv(bool STRIDED,
+                                                rocblas_handle handle,
+                                                rocblas_svect leftv,
+                                                rocblas_svect rightv,
+                                                rocblas_int m,
+                                                rocblas_int n,
+                                                float* const A[],
+                                                rocblas_int lda,
+                                                rocblas_stride stA,
+                                                float abstol,
+                                                float* residual,
+                                                rocblas_int max_sweeps,
+                                                rocblas_int* n_sweeps,
+                                                float* S,
+                                                rocblas_stride stS,
+                                                float* U,
+                                                rocblas_int ldu,
+                                                rocblas_stride stU,
+                                                float* V,
+                                                rocblas_int ldv,
+                                                rocblas_stride stV,
+                                                rocblas_int* info,
+                                                rocblas_int bc)
+{
+    return rocblas_status_not_implemented; // rocsolver_sgesvdj_notransv_batched(handle, leftv, rightv, m, n, A, lda, abstol,
+        // residual, max_sweeps, n_sweeps, S, stS, U, ldu, stU, V, ldv, stV, info, bc);
+}
+
+inline rocblas_status rocsolver_gesvdj_notransv(bool STRIDED,
+                                                rocblas_handle handle,
+                                                rocblas_svect leftv,
+                                                rocblas_svect rightv,
+                                                rocblas_int m,
+                                                rocblas_int n,
+                                                double* const A[],
+                                                rocblas_int lda,
+                                                rocblas_stride stA,
+                                                double abstol,
+                                                double* residual,
+                                                rocblas_int max_sweeps,
+                                                rocblas_int* n_sweeps,
+                                                double* S,
+                                                rocblas_stride stS,
+                                                double* U,
+                                                rocblas_int ldu,
+                                                rocblas_stride stU,
+                                                double* V,
+                                                rocblas_int ldv,
+                                                rocblas_stride stV,
+                                                rocblas_int* info,
+                                                rocblas_int bc)
+{
+    return rocblas_status_not_implemented; // rocsolver_dgesvdj_notransv_batched(handle, leftv, rightv, m, n, A, lda, abstol,
+        // residual, max_sweeps, n_sweeps, S, stS, U, ldu, stU, V, ldv, stV, info, bc);
+}
+
+inline rocblas_status rocsolver_gesvdj_notransv(bool STRIDED,
+                                                rocblas_handle handle,
+                                                rocblas_svect leftv,
+                                                rocblas_svect rightv,
+                                                rocblas_int m,
+                                                rocblas_int n,
+                                                rocblas_float_complex* const A[],
+                                                rocblas_int lda,
+                                                rocblas_stride stA,
+                                                float abstol,
+                                                float* residual,
+                                                rocblas_int max_sweeps,
+                                                rocblas_int* n_sweeps,
+                                                float* S,
+                                                rocblas_stride stS,
+                                                rocblas_float_complex* U,
+                                                rocblas_int ldu,
+                                                rocblas_stride stU,
+                                                rocblas_float_complex* V,
+                                                rocblas_int ldv,
+                                                rocblas_stride stV,
+                                                rocblas_int* info,
+                                                rocblas_int bc)
+{
+    return rocblas_status_not_implemented; // rocsolver_cgesvdj_notransv_batched(handle, leftv, rightv, m, n, A, lda, abstol,
+        // residual, max_sweeps, n_sweeps, S, stS, U, ldu, stU, V, ldv, stV, info, bc);
+}
+
+inline rocblas_status rocsolver_gesvdj_notransv(bool STRIDED,
+                                                rocblas_handle handle,
+                                                rocblas_svect leftv,
+                                                rocblas_svect rightv,
+                                                rocblas_int m,
+                                                rocblas_int n,
+                                                rocblas_double_complex* const A[],
+                                                rocblas_int lda,
+                                                rocblas_stride stA,
+                                                double abstol,
+                                                double* residual,
+                                                rocblas_int max_sweeps,
+                                                rocblas_int* n_sweeps,
+                                                double* S,
+                                                rocblas_stride stS,
+                                                rocblas_double_complex* U,
+                                                rocblas_int ldu,
+                                                rocblas_stride stU,
+                                                rocblas_double_complex* V,
+                                                rocblas_int ldv,
+                                                rocblas_stride stV,
+                                                rocblas_int* info,
+                                                rocblas_int bc)
+{
+    return rocblas_status_not_implemented; // rocsolver_zgesvdj_notransv_batched(handle, leftv, rightv, m, n, A, lda, abstol,
+        // residual, max_sweeps, n_sweeps, S, stS, U, ldu, stU, V, ldv, stV, info, bc);
+}
+/********************************************************/
+
+/******************** GESVDX ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_gesvdx(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_svect leftv,
+                                       rocblas_svect rightv,
+                                       rocblas_srange srange,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       float* A,
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       float vl,
+                                       float vu,
+                                       rocblas_int il,
+                                       rocblas_int iu,
+                                       rocblas_int* ns,
+                                       float* S,
+                                       rocblas_stride stS,
+                                       float* U,
+                                       rocblas_int ldu,
+                                       rocblas_stride stU,
+                                       float* V,
+                                       rocblas_int ldv,
+                                       rocblas_stride stV,
+                                       rocblas_int* ifail,
+                                       rocblas_stride stF,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return STRIDED ? rocsolver_sgesvdx_strided_batched(handle, leftv, rightv, srange, m, n, A, lda,
+                                                       stA, vl, vu, il, iu, ns, S, stS, U, ldu, stU,
+                                                       V, ldv, stV, ifail, stF, info, bc)
+                   : rocsolver_sgesvdx(handle, leftv, rightv, srange, m, n, A, lda, vl, vu, il, iu,
+                                       ns, S, U, ldu, V, ldv, ifail, info);
+}
+
+inline rocblas_status rocsolver_gesvdx(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_svect leftv,
+                                       rocblas_svect rightv,
+                                       rocblas_srange srange,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       double* A,
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       double vl,
+                                       double vu,
+                                       rocblas_int il,
+                                       rocblas_int iu,
+                                       rocblas_int* ns,
+                                       double* S,
+                                       rocblas_stride stS,
+                                       double* U,
+                                       rocblas_int ldu,
+                                       rocblas_stride stU,
+                                       double* V,
+                                       rocblas_int ldv,
+                                       rocblas_stride stV,
+                                       rocblas_int* ifail,
+                                       rocblas_stride stF,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return STRIDED ? rocsolver_dgesvdx_strided_batched(handle, leftv, rightv, srange, m, n, A, lda,
+                                                       stA, vl, vu, il, iu, ns, S, stS, U, ldu, stU,
+                                                       V, ldv, stV, ifail, stF, info, bc)
+                   : rocsolver_dgesvdx(handle, leftv, rightv, srange, m, n, A, lda, vl, vu, il, iu,
+                                       ns, S, U, ldu, V, ldv, ifail, info);
+}
+
+inline rocblas_status rocsolver_gesvdx(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_svect leftv,
+                                       rocblas_svect rightv,
+                                       rocblas_srange srange,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       rocblas_float_complex* A,
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       float vl,
+                                       float vu,
+                                       rocblas_int il,
+                                       rocblas_int iu,
+                                       rocblas_int* ns,
+                                       float* S,
+                                       rocblas_stride stS,
+                                       rocblas_float_complex* U,
+                                       rocblas_int ldu,
+                                       rocblas_stride stU,
+                                       rocblas_float_complex* V,
+                                       rocblas_int ldv,
+                                       rocblas_stride stV,
+                                       rocblas_int* ifail,
+                                       rocblas_stride stF,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return STRIDED ? rocsolver_cgesvdx_strided_batched(handle, leftv, rightv, srange, m, n, A, lda,
+                                                       stA, vl, vu, il, iu, ns, S, stS, U, ldu, stU,
+                                                       V, ldv, stV, ifail, stF, info, bc)
+                   : rocsolver_cgesvdx(handle, leftv, rightv, srange, m, n, A, lda, vl, vu, il, iu,
+                                       ns, S, U, ldu, V, ldv, ifail, info);
+}
+
+inline rocblas_status rocsolver_gesvdx(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_svect leftv,
+                                       rocblas_svect rightv,
+                                       rocblas_srange srange,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       rocblas_double_complex* A,
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       double vl,
+                                       double vu,
+                                       rocblas_int il,
+                                       rocblas_int iu,
+                                       rocblas_int* ns,
+                                       double* S,
+                                       rocblas_stride stS,
+                                       rocblas_double_complex* U,
+                                       rocblas_int ldu,
+                                       rocblas_stride stU,
+                                       rocblas_double_complex* V,
+                                       rocblas_int ldv,
+                                       rocblas_stride stV,
+                                       rocblas_int* ifail,
+                                       rocblas_stride stF,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return STRIDED ? rocsolver_zgesvdx_strided_batched(handle, leftv, rightv, srange, m, n, A, lda,
+                                                       stA, vl, vu, il, iu, ns, S, stS, U, ldu, stU,
+                                                       V, ldv, stV, ifail, stF, info, bc)
+                   : rocsolver_zgesvdx(handle, leftv, rightv, srange, m, n, A, lda, vl, vu, il, iu,
+                                       ns, S, U, ldu, V, ldv, ifail, info);
+}
+
+// batched
+inline rocblas_status rocsolver_gesvdx(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_svect leftv,
+                                       rocblas_svect rightv,
+                                       rocblas_srange srange,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       float* const A[],
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       float vl,
+                                       float vu,
+                                       rocblas_int il,
+                                       rocblas_int iu,
+                                       rocblas_int* ns,
+                                       float* S,
+                                       rocblas_stride stS,
+                                       float* U,
+                                       rocblas_int ldu,
+                                       rocblas_stride stU,
+                                       float* V,
+                                       rocblas_int ldv,
+                                       rocblas_stride stV,
+                                       rocblas_int* ifail,
+                                       rocblas_stride stF,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return rocsolver_sgesvdx_batched(handle, leftv, rightv, srange, m, n, A, lda, vl, vu, il, iu,
+                                     ns, S, stS, U, ldu, stU, V, ldv, stV, ifail, stF, info, bc);
+}
+
+inline rocblas_status rocsolver_gesvdx(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_svect leftv,
+                                       rocblas_svect rightv,
+                                       rocblas_srange srange,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       double* const A[],
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       double vl,
+                                       double vu,
+                                       rocblas_int il,
+                                       rocblas_int iu,
+                                       rocblas_int* ns,
+                                       double* S,
+                                       rocblas_stride stS,
+                                       double* U,
+                                       rocblas_int ldu,
+                                       rocblas_stride stU,
+                                       double* V,
+                                       rocblas_int ldv,
+                                       rocblas_stride stV,
+                                       rocblas_int* ifail,
+                                       rocblas_stride stF,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return rocsolver_dgesvdx_batched(handle, leftv, rightv, srange, m, n, A, lda, vl, vu, il, iu,
+                                     ns, S, stS, U, ldu, stU, V, ldv, stV, ifail, stF, info, bc);
+}
+
+inline rocblas_status rocsolver_gesvdx(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_svect leftv,
+                                       rocblas_svect rightv,
+                                       rocblas_srange srange,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       rocblas_float_complex* const A[],
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       float vl,
+                                       float vu,
+                                       rocblas_int il,
+                                       rocblas_int iu,
+                                       rocblas_int* ns,
+                                       float* S,
+                                       rocblas_stride stS,
+                                       rocblas_float_complex* U,
+                                       rocblas_int ldu,
+                                       rocblas_stride stU,
+                                       rocblas_float_complex* V,
+                                       rocblas_int ldv,
+                                       rocblas_stride stV,
+                                       rocblas_int* ifail,
+                                       rocblas_stride stF,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return rocsolver_cgesvdx_batched(handle, leftv, rightv, srange, m, n, A, lda, vl, vu, il, iu,
+                                     ns, S, stS, U, ldu, stU, V, ldv, stV, ifail, stF, info, bc);
+}
+
+inline rocblas_status rocsolver_gesvdx(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_svect leftv,
+                                       rocblas_svect rightv,
+                                       rocblas_srange srange,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       rocblas_double_complex* const A[],
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       double vl,
+                                       double vu,
+                                       rocblas_int il,
+                                       rocblas_int iu,
+                                       rocblas_int* ns,
+                                       double* S,
+                                       rocblas_stride stS,
+                                       rocblas_double_complex* U,
+                                       rocblas_int ldu,
+                                       rocblas_stride stU,
+                                       rocblas_double_complex* V,
+                                       rocblas_int ldv,
+                                       rocblas_stride stV,
+                                       rocblas_int* ifail,
+                                       rocblas_stride stF,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return rocsolver_zgesvdx_batched(handle, leftv, rightv, srange, m, n, A, lda, vl, vu, il, iu,
+                                     ns, S, stS, U, ldu, stU, V, ldv, stV, ifail, stF, info, bc);
+}
+/********************************************************/
+
+/******************** GESVDX_NOTRANSV ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_gesvdx_notransv(bool STRIDED,
+                                                rocblas_handle handle,
+                                                rocblas_svect leftv,
+                                                rocblas_svect rightv,
+                                                rocblas_srange srange,
+                                                rocblas_int m,
+                                                rocblas_int n,
+                                                float* A,
+                                                rocblas_int lda,
+                                                rocblas_stride stA,
+                                                float vl,
+                                                float vu,
+                                                rocblas_int il,
+                                                rocblas_int iu,
+                                                rocblas_int* ns,
+                                                float* S,
+                                                rocblas_stride stS,
+                                                float* U,
+                                                rocblas_int ldu,
+                                                rocblas_stride stU,
+                                                float* V,
+                                                rocblas_int ldv,
+                                                rocblas_stride stV,
+                                                rocblas_int* ifail,
+                                                rocblas_stride stF,
+                                                rocblas_int* info,
+                                                rocblas_int bc)
+{
+    return STRIDED
+        ? rocsolver_sgesvdx_notransv_strided_batched(handle, leftv, rightv, srange, m, n, A, lda,
+                                                     stA, vl, vu, il, iu, ns, S, stS, U, ldu, stU,
+                                                     V, ldv, stV, ifail, stF, info, bc)
+        : rocblas_status_not_implemented; // rocsolver_sgesvdx_notransv(handle, leftv, rightv, srange, m, n, A, lda, vl, vu, il, iu,
+    // ns, S, U, ldu, V, ldv, ifail, info);
+}
+
+inline rocblas_status rocsolver_gesvdx_notransv(bool STRIDED,
+                                                rocblas_handle handle,
+                                                rocblas_svect leftv,
+                                                rocblas_svect rightv,
+                                                rocblas_srange srange,
+                                                rocblas_int m,
+                                                rocblas_int n,
+                                                double* A,
+                                                rocblas_int lda,
+                                                rocblas_stride stA,
+                                                double vl,
+                                                double vu,
+                                                rocblas_int il,
+                                                rocblas_int iu,
+                                                rocblas_int* ns,
+                                                double* S,
+                                                rocblas_stride stS,
+                                                double* U,
+                                                rocblas_int ldu,
+                                                rocblas_stride stU,
+                                                double* V,
+                                                rocblas_int ldv,
+                                                rocblas_stride stV,
+                                                rocblas_int* ifail,
+                                                rocblas_stride stF,
+                                                rocblas_int* info,
+                                                rocblas_int bc)
+{
+    return STRIDED
+        ? rocsolver_dgesvdx_notransv_strided_batched(handle, leftv, rightv, srange, m, n, A, lda,
+                                                     stA, vl, vu, il, iu, ns, S, stS, U, ldu, stU,
+                                                     V, ldv, stV, ifail, stF, info, bc)
+        : rocblas_status_not_implemented; // rocsolver_dgesvdx_notransv(handle, leftv, rightv, srange, m, n, A, lda, vl, vu, il, iu,
+    // ns, S, U, ldu, V, ldv, ifail, info);
+}
+
+inline rocblas_status rocsolver_gesvdx_notransv(bool STRIDED,
+                                                rocblas_handle handle,
+                                                rocblas_svect leftv,
+                                                rocblas_svect rightv,
+                                                rocblas_srange srange,
+                                                rocblas_int m,
+                                                rocblas_int n,
+                                                rocblas_float_complex* A,
+                                                rocblas_int lda,
+                                                rocblas_stride stA,
+                                                float vl,
+                                                float vu,
+                                                rocblas_int il,
+                                                rocblas_int iu,
+                                                rocblas_int* ns,
+                                                float* S,
+                                                rocblas_stride stS,
+                                                rocblas_float_complex* U,
+                                                rocblas_int ldu,
+                                                rocblas_stride stU,
+                                                rocblas_float_complex* V,
+                                                rocblas_int ldv,
+                                                rocblas_stride stV,
+                                                rocblas_int* ifail,
+                                                rocblas_stride stF,
+                                                rocblas_int* info,
+                                                rocblas_int bc)
+{
+    return STRIDED
+        ? rocsolver_cgesvdx_notransv_strided_batched(handle, leftv, rightv, srange, m, n, A, lda,
+                                                     stA, vl, vu, il, iu, ns, S, stS, U, ldu, stU,
+                                                     V, ldv, stV, ifail, stF, info, bc)
+        : rocblas_status_not_implemented; // rocsolver_cgesvdx_notransv(handle, leftv, rightv, srange, m, n, A, lda, vl, vu, il, iu,
+    // ns, S, U, ldu, V, ldv, ifail, info);
+}
+
+inline rocblas_status rocsolver_gesvdx_notransv(bool STRIDED,
+                                                rocblas_handle handle,
+                                                rocblas_svect leftv,
+                                                rocblas_svect rightv,
+                                                rocblas_srange srange,
+                                                rocblas_int m,
+                                                rocblas_int n,
+                                                rocblas_double_complex* A,
+                                                rocblas_int lda,
+                                                rocblas_stride stA,
+                                                double vl,
+                                                double vu,
+                                                rocblas_int il,
+                                                rocblas_int iu,
+                                                rocblas_int* ns,
+                                                double* S,
+                                                rocblas_stride stS,
+                                                rocblas_double_complex* U,
+                                                rocblas_int ldu,
+                                                rocblas_stride stU,
+                                                rocblas_double_complex* V,
+                                                rocblas_int ldv,
+                                                rocblas_stride stV,
+                                                rocblas_int* ifail,
+                                                rocblas_stride stF,
+                                                rocblas_int* info,
+                                                rocblas_int bc)
+{
+    return STRIDED
+        ? rocsolver_zgesvdx_notransv_strided_batched(handle, leftv, rightv, srange, m, n, A, lda,
+                                                     stA, vl, vu, il, iu, ns, S, stS, U, ldu, stU,
+                                                     V, ldv, stV, ifail, stF, info, bc)
+        : rocblas_status_not_implemented; // rocsolver_zgesvdx_notransv(handle, leftv, rightv, srange, m, n, A, lda, vl, vu, il, iu,
+    // ns, S, U, ldu, V, ldv, ifail, info);
+}
+
+// batched
+inline rocblas_status rocsolver_gesvdx_notransv(bool STRIDED,
+                                                rocblas_handle handle,
+                                                rocblas_svect leftv,
+                                                rocblas_svect rightv,
+                                                rocblas_srange srange,
+                                                rocblas_int m,
+                                                rocblas_int n,
+                                                float* const A[],
+                                                rocblas_int lda,
+                                                rocblas_stride stA,
+                                                float vl,
+                                                float vu,
+                                                rocblas_int il,
+                                                rocblas_int iu,
+                                                rocblas_int* ns,
+                                                float* S,
+                                                rocblas_stride stS,
+                                                float* U,
+                                                rocblas_int ldu,
+                                                rocblas_stride stU,
+                                                float* V,
+                                                rocblas_int ldv,
+                                                rocblas_stride stV,
+                                                rocblas_int* ifail,
+                                                rocblas_stride stF,
+                                                rocblas_int* info,
+                                                rocblas_int bc)
+{
+    return rocblas_status_not_implemented; // rocsolver_sgesvdx_notransv_batched(handle, leftv, rightv, srange, m, n, A, lda, vl, vu, il, iu,
+        // ns, S, stS, U, ldu, stU, V, ldv, stV, ifail, stF, info, bc);
+}
+
+inline rocblas_status rocsolver_gesvdx_notransv(bool STRIDED,
+                                                rocblas_handle handle,
+                                                rocblas_svect leftv,
+                                                rocblas_svect rightv,
+                                                rocblas_srange srange,
+                                                rocblas_int m,
+                                                rocblas_int n,
+                                                double* const A[],
+                                                rocblas_int lda,
+                                                rocblas_stride stA,
+                                                double vl,
+                                                double vu,
+                                                rocblas_int il,
+                                                rocblas_int iu,
+                                                rocblas_int* ns,
+                                                double* S,
+                                                rocblas_stride stS,
+                                                double* U,
+                                                rocblas_int ldu,
+                                                rocblas_stride stU,
+                                                double* V,
+                                                rocblas_int ldv,
+                                                rocblas_stride stV,
+                                                rocblas_int* ifail,
+                                                rocblas_stride stF,
+                                                rocblas_int* info,
+                                                rocblas_int bc)
+{
+    return rocblas_status_not_implemented; // rocsolver_dgesvdx_notransv_batched(handle, leftv, rightv, srange, m, n, A, lda, vl, vu, il, iu,
+        // ns, S, stS, U, ldu, stU, V, ldv, stV, ifail, stF, info, bc);
+}
+
+inline rocblas_status rocsolver_gesvdx_notransv(bool STRIDED,
+                                                rocblas_handle handle,
+                                                rocblas_svect leftv,
+                                                rocblas_svect rightv,
+                                                rocblas_srange srange,
+                                                rocblas_int m,
+                                                rocblas_int n,
+                                                rocblas_float_complex* const A[],
+                                                rocblas_int lda,
+                                                rocblas_stride stA,
+                                                float vl,
+                                                float vu,
+                                                rocblas_int il,
+                                                rocblas_int iu,
+                                                rocblas_int* ns,
+                                                float* S,
+                                                rocblas_stride stS,
+                                                rocblas_float_complex* U,
+                                                rocblas_int ldu,
+                                                rocblas_stride stU,
+                                                rocblas_float_complex* V,
+                                                rocblas_int ldv,
+                                                rocblas_stride stV,
+                                                rocblas_int* ifail,
+                                                rocblas_stride stF,
+                                                rocblas_int* info,
+                                                rocblas_int bc)
+{
+    return rocblas_status_not_implemented; // rocsolver_cgesvdx_notransv_batched(handle, leftv, rightv, srange, m, n, A, lda, vl, vu, il, iu,
+        // ns, S, stS, U, ldu, stU, V, ldv, stV, ifail, stF, info, bc);
+}
+
+inline rocblas_status rocsolver_gesvdx_notransv(bool STRIDED,
+                                                rocblas_handle handle,
+                                                rocblas_svect leftv,
+                                                rocblas_svect rightv,
+                                                rocblas_srange srange,
+                                                rocblas_int m,
+                                                rocblas_int n,
+                                                rocblas_double_complex* const A[],
+                                                rocblas_int lda,
+                                                rocblas_stride stA,
+                                                double vl,
+                                                double vu,
+                                                rocblas_int il,
+                                                rocblas_int iu,
+                                                rocblas_int* ns,
+                                                double* S,
+                                                rocblas_stride stS,
+                                                rocblas_double_complex* U,
+                                                rocblas_int ldu,
+                                                rocblas_stride stU,
+                                                rocblas_double_complex* V,
+                                                rocblas_int ldv,
+                                                rocblas_stride stV,
+                                                rocblas_int* ifail,
+                                                rocblas_stride stF,
+                                                rocblas_int* info,
+                                                rocblas_int bc)
+{
+    return rocblas_status_not_implemented; // rocsolver_zgesvdx_notransv_batched(handle, leftv, rightv, srange, m, n, A, lda, vl, vu, il, iu,
+        // ns, S, stS, U, ldu, stU, V, ldv, stV, ifail, stF, info, bc);
+}
+/********************************************************/
+
+/******************** GETRS ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_getrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation trans,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      float* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      float* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
+{
+    return STRIDED ? rocsolver_sgetrs_strided_batched(handle, trans, n, nrhs, A, lda, stA, ipiv,
+                                                      stP, B, ldb, stB, bc)
+                   : rocsolver_sgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb);
+}
+
+inline rocblas_status rocsolver_getrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation trans,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      double* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      double* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
+{
+    return STRIDED ? rocsolver_dgetrs_strided_batched(handle, trans, n, nrhs, A, lda, stA, ipiv,
+                                                      stP, B, ldb, stB, bc)
+                   : rocsolver_dgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb);
+}
+
+inline rocblas_status rocsolver_getrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation trans,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_float_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_float_complex* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
+{
+    return STRIDED ? rocsolver_cgetrs_strided_batched(handle, trans, n, nrhs, A, lda, stA, ipiv,
+                                                      stP, B, ldb, stB, bc)
+                   : rocsolver_cgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb);
+}
+
+inline rocblas_status rocsolver_getrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation trans,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_double_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_double_complex* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
+{
+    return STRIDED ? rocsolver_zgetrs_strided_batched(handle, trans, n, nrhs, A, lda, stA, ipiv,
+                                                      stP, B, ldb, stB, bc)
+                   : rocsolver_zgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb);
+}
+
+inline rocblas_status rocsolver_getrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation trans,
+                                      int64_t n,
+                                      int64_t nrhs,
+                                      float* A,
+                                      int64_t lda,
+                                      rocblas_stride stA,
+                                      int64_t* ipiv,
+                                      rocblas_stride stP,
+                                      float* B,
+                                      int64_t ldb,
+                                      rocblas_stride stB,
+                                      int64_t bc)
+{
+    return STRIDED ? rocsolver_sgetrs_strided_batched_64(handle, trans, n, nrhs, A, lda, stA, ipiv,
+                                                         stP, B, ldb, stB, bc)
+                   : rocsolver_sgetrs_64(handle, trans, n, nrhs, A, lda, ipiv, B, ldb);
+}
+
+inline rocblas_status rocsolver_getrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation trans,
+                                      int64_t n,
+                                      int64_t nrhs,
+                                      double* A,
+                                      int64_t lda,
+                                      rocblas_stride stA,
+                                      int64_t* ipiv,
+                                      rocblas_stride stP,
+                                      double* B,
+                                      int64_t ldb,
+                                      rocblas_stride stB,
+                                      int64_t bc)
+{
+    return STRIDED ? rocsolver_dgetrs_strided_batched_64(handle, trans, n, nrhs, A, lda, stA, ipiv,
+                                                         stP, B, ldb, stB, bc)
+                   : rocsolver_dgetrs_64(handle, trans, n, nrhs, A, lda, ipiv, B, ldb);
+}
+
+inline rocblas_status rocsolver_getrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation trans,
+                                      int64_t n,
+                                      int64_t nrhs,
+                                      rocblas_float_complex* A,
+                                      int64_t lda,
+                                      rocblas_stride stA,
+                                      int64_t* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_float_complex* B,
+                                      int64_t ldb,
+                                      rocblas_stride stB,
+                                      int64_t bc)
+{
+    return STRIDED ? rocsolver_cgetrs_strided_batched_64(handle, trans, n, nrhs, A, lda, stA, ipiv,
+                                                         stP, B, ldb, stB, bc)
+                   : rocsolver_cgetrs_64(handle, trans, n, nrhs, A, lda, ipiv, B, ldb);
+}
+
+inline rocblas_status rocsolver_getrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation trans,
+                                      int64_t n,
+                                      int64_t nrhs,
+                                      rocblas_double_complex* A,
+                                      int64_t lda,
+                                      rocblas_stride stA,
+                                      int64_t* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_double_complex* B,
+                                      int64_t ldb,
+                                      rocblas_stride stB,
+                                      int64_t bc)
+{
+    return STRIDED ? rocsolver_zgetrs_strided_batched_64(handle, trans, n, nrhs, A, lda, stA, ipiv,
+                                                         stP, B, ldb, stB, bc)
+                   : rocsolver_zgetrs_64(handle, trans, n, nrhs, A, lda, ipiv, B, ldb);
+}
+
+// batched
+inline rocblas_status rocsolver_getrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation trans,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      float* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      float* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
+{
+    return rocsolver_sgetrs_batched(handle, trans, n, nrhs, A, lda, ipiv, stP, B, ldb, bc);
+}
+
+inline rocblas_status rocsolver_getrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation trans,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      double* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      double* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
+{
+    return rocsolver_dgetrs_batched(handle, trans, n, nrhs, A, lda, ipiv, stP, B, ldb, bc);
+}
+
+inline rocblas_status rocsolver_getrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation trans,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_float_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_float_complex* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
+{
+    return rocsolver_cgetrs_batched(handle, trans, n, nrhs, A, lda, ipiv, stP, B, ldb, bc);
+}
+
+inline rocblas_status rocsolver_getrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation trans,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_double_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_double_complex* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
+{
+    return rocsolver_zgetrs_batched(handle, trans, n, nrhs, A, lda, ipiv, stP, B, ldb, bc);
+}
+
+inline rocblas_status rocsolver_getrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation trans,
+                                      int64_t n,
+                                      int64_t nrhs,
+                                      float* const A[],
+                                      int64_t lda,
+                                      rocblas_stride stA,
+                                      int64_t* ipiv,
+                                      rocblas_stride stP,
+                                      float* const B[],
+                                      int64_t ldb,
+                                      rocblas_stride stB,
+                                      int64_t bc)
+{
+    return rocsolver_sgetrs_batched_64(handle, trans, n, nrhs, A, lda, ipiv, stP, B, ldb, bc);
+}
+
+inline rocblas_status rocsolver_getrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation trans,
+                                      int64_t n,
+                                      int64_t nrhs,
+                                      double* const A[],
+                                      int64_t lda,
+                                      rocblas_stride stA,
+                                      int64_t* ipiv,
+                                      rocblas_stride stP,
+                                      double* const B[],
+                                      int64_t ldb,
+                                      rocblas_stride stB,
+                                      int64_t bc)
+{
+    return rocsolver_dgetrs_batched_64(handle, trans, n, nrhs, A, lda, ipiv, stP, B, ldb, bc);
+}
+
+inline rocblas_status rocsolver_getrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation trans,
+                                      int64_t n,
+                                      int64_t nrhs,
+                                      rocblas_float_complex* const A[],
+                                      int64_t lda,
+                                      rocblas_stride stA,
+                                      int64_t* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_float_complex* const B[],
+                                      int64_t ldb,
+                                      rocblas_stride stB,
+                                      int64_t bc)
+{
+    return rocsolver_cgetrs_batched_64(handle, trans, n, nrhs, A, lda, ipiv, stP, B, ldb, bc);
+}
+
+inline rocblas_status rocsolver_getrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation trans,
+                                      int64_t n,
+                                      int64_t nrhs,
+                                      rocblas_double_complex* const A[],
+                                      int64_t lda,
+                                      rocblas_stride stA,
+                                      int64_t* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_double_complex* const B[],
+                                      int64_t ldb,
+                                      rocblas_stride stB,
+                                      int64_t bc)
+{
+    return rocsolver_zgetrs_batched_64(handle, trans, n, nrhs, A, lda, ipiv, stP, B, ldb, bc);
+}
+/********************************************************/
+
+/******************** GETRS_INTERLEAVED ********************/
+inline rocblas_status rocsolver_getrs_interleaved(rocblas_handle handle,
+                                                  rocblas_operation trans,
+                                                  rocblas_int n,
+                                                  rocblas_int nrhs,
+                                                  float* A,
+                                                  rocblas_int inca,
+                                                  rocblas_int lda,
+                                                  rocblas_stride stA,
+                                                  rocblas_int* ipiv,
+                                                  rocblas_stride stP,
+                                                  float* B,
+                                                  rocblas_int incb,
+                                                  rocblas_int ldb,
+                                                  rocblas_stride stB,
+                                                  rocblas_int bc)
+{
+    return rocsolver_sgetrs_interleaved_batched(handle, trans, n, nrhs, A, inca, lda, stA, ipiv,
+                                                stP, B, incb, ldb, stB, bc);
+}
+
+inline rocblas_status rocsolver_getrs_interleaved(rocblas_handle handle,
+                                                  rocblas_operation trans,
+                                                  rocblas_int n,
+                                                  rocblas_int nrhs,
+                                                  double* A,
+                                                  rocblas_int inca,
+                                                  rocblas_int lda,
+                                                  rocblas_stride stA,
+                                                  rocblas_int* ipiv,
+                                                  rocblas_stride stP,
+                                                  double* B,
+                                                  rocblas_int incb,
+                                                  rocblas_int ldb,
+                                                  rocblas_stride stB,
+                                                  rocblas_int bc)
+{
+    return rocsolver_dgetrs_interleaved_batched(handle, trans, n, nrhs, A, inca, lda, stA, ipiv,
+                                                stP, B, incb, ldb, stB, bc);
+}
+
+inline rocblas_status rocsolver_getrs_interleaved(rocblas_handle handle,
+                                                  rocblas_operation trans,
+                                                  rocblas_int n,
+                                                  rocblas_int nrhs,
+                                                  rocblas_float_complex* A,
+                                                  rocblas_int inca,
+                                                  rocblas_int lda,
+                                                  rocblas_stride stA,
+                                                  rocblas_int* ipiv,
+                                                  rocblas_stride stP,
+                                                  rocblas_float_complex* B,
+                                                  rocblas_int incb,
+                                                  rocblas_int ldb,
+                                                  rocblas_stride stB,
+                                                  rocblas_int bc)
+{
+    return rocsolver_cgetrs_interleaved_batched(handle, trans, n, nrhs, A, inca, lda, stA, ipiv,
+                                                stP, B, incb, ldb, stB, bc);
+}
+
+inline rocblas_status rocsolver_getrs_interleaved(rocblas_handle handle,
+                                                  rocblas_operation trans,
+                                                  rocblas_int n,
+                                                  rocblas_int nrhs,
+                                                  rocblas_double_complex* A,
+                                                  rocblas_int inca,
+                                                  rocblas_int lda,
+                                                  rocblas_stride stA,
+                                                  rocblas_int* ipiv,
+                                                  rocblas_stride stP,
+                                                  rocblas_double_complex* B,
+                                                  rocblas_int incb,
+                                                  rocblas_int ldb,
+                                                  rocblas_stride stB,
+                                                  rocblas_int bc)
+{
+    return rocsolver_zgetrs_interleaved_batched(handle, trans, n, nrhs, A, inca, lda, stA, ipiv,
+                                                stP, B, incb, ldb, stB, bc);
+}
+/********************************************************/
+
+/******************** GETRS_VBATCHED ********************/
+inline rocblas_status rocsolver_getrs_vbatched(rocblas_handle handle,
+                                               rocblas_operation trans,
+                                               rocblas_int* n,
+                                               rocblas_int* nrhs,
+                                               float* const A[],
+                                               rocblas_int* lda,
+                                               rocblas_int* ipiv,
+                                               rocblas_stride stP,
+                                               float* const B[],
+                                               rocblas_int* ldb,
+                                               rocblas_int bc)
+{
+    return rocsolver_sgetrs_vbatched(handle, trans, n, nrhs, A, lda, ipiv, stP, B, ldb, bc);
+}
+
+inline rocblas_status rocsolver_getrs_vbatched(rocblas_handle handle,
+                                               rocblas_operation trans,
+                                               rocblas_int* n,
+                                               rocblas_int* nrhs,
+                                               double* const A[],
+                                               rocblas_int* lda,
+                                               rocblas_int* ipiv,
+                                               rocblas_stride stP,
+                                               double* const B[],
+                                               rocblas_int* ldb,
+                                               rocblas_int bc)
+{
+    return rocsolver_dgetrs_vbatched(handle, trans, n, nrhs, A, lda, ipiv, stP, B, ldb, bc);
+}
+
+inline rocblas_status rocsolver_getrs_vbatched(rocblas_handle handle,
+                                               rocblas_operation trans,
+                                               rocblas_int* n,
+                                               rocblas_int* nrhs,
+                                               rocblas_float_complex* const A[],
+                                               rocblas_int* lda,
+                                               rocblas_int* ipiv,
+                                               rocblas_stride stP,
+                                               rocblas_float_complex* const B[],
+                                               rocblas_int* ldb,
+                                               rocblas_int bc)
+{
+    return rocsolver_cgetrs_vbatched(handle, trans, n, nrhs, A, lda, ipiv, stP, B, ldb, bc);
+}
+
+inline rocblas_status rocsolver_getrs_vbatched(rocblas_handle handle,
+                                               rocblas_operation trans,
+                                               rocblas_int* n,
+                                               rocblas_int* nrhs,
+                                               rocblas_double_complex* const A[],
+                                               rocblas_int* lda,
+                                               rocblas_int* ipiv,
+                                               rocblas_stride stP,
+                                               rocblas_double_complex* const B[],
+                                               rocblas_int* ldb,
+                                               rocblas_int bc)
+{
+    return rocsolver_zgetrs_vbatched(handle, trans, n, nrhs, A, lda, ipiv, stP, B, ldb, bc);
+}
+/********************************************************/
+
+/******************** GESV ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_gesv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     float* A,
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_int* ipiv,
+                                     rocblas_stride stP,
+                                     float* B,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    return STRIDED ? rocsolver_sgesv_strided_batched(handle, n, nrhs, A, lda, stA, ipiv, stP, B,
+                                                     ldb, stB, info, bc)
+                   : rocsolver_sgesv(handle, n, nrhs, A, lda, ipiv, B, ldb, info);
+}
+
+inline rocblas_status rocsolver_gesv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     double* A,
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_int* ipiv,
+                                     rocblas_stride stP,
+                                     double* B,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    return STRIDED ? rocsolver_dgesv_strided_batched(handle, n, nrhs, A, lda, stA, ipiv, stP, B,
+                                                     ldb, stB, info, bc)
+                   : rocsolver_dgesv(handle, n, nrhs, A, lda, ipiv, B, ldb, info);
+}
+
+inline rocblas_status rocsolver_gesv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     rocblas_float_complex* A,
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_int* ipiv,
+                                     rocblas_stride stP,
+                                     rocblas_float_complex* B,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    return STRIDED ? rocsolver_cgesv_strided_batched(handle, n, nrhs, A, lda, stA, ipiv, stP, B,
+                                                     ldb, stB, info, bc)
+                   : rocsolver_cgesv(handle, n, nrhs, A, lda, ipiv, B, ldb, info);
+}
+
+inline rocblas_status rocsolver_gesv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     rocblas_double_complex* A,
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_int* ipiv,
+                                     rocblas_stride stP,
+                                     rocblas_double_complex* B,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    return STRIDED ? rocsolver_zgesv_strided_batched(handle, n, nrhs, A, lda, stA, ipiv, stP, B,
+                                                     ldb, stB, info, bc)
+                   : rocsolver_zgesv(handle, n, nrhs, A, lda, ipiv, B, ldb, info);
+}
+
+// batched
+inline rocblas_status rocsolver_gesv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     float* const A[],
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_int* ipiv,
+                                     rocblas_stride stP,
+                                     float* const B[],
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    return rocsolver_sgesv_batched(handle, n, nrhs, A, lda, ipiv, stP, B, ldb, info, bc);
+}
+
+inline rocblas_status rocsolver_gesv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     double* const A[],
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_int* ipiv,
+                                     rocblas_stride stP,
+                                     double* const B[],
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    return rocsolver_dgesv_batched(handle, n, nrhs, A, lda, ipiv, stP, B, ldb, info, bc);
+}
+
+inline rocblas_status rocsolver_gesv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     rocblas_float_complex* const A[],
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_int* ipiv,
+                                     rocblas_stride stP,
+                                     rocblas_float_complex* const B[],
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    return rocsolver_cgesv_batched(handle, n, nrhs, A, lda, ipiv, stP, B, ldb, info, bc);
+}
+
+inline rocblas_status rocsolver_gesv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     rocblas_double_complex* const A[],
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_int* ipiv,
+                                     rocblas_stride stP,
+                                     rocblas_double_complex* const B[],
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    return rocsolver_zgesv_batched(handle, n, nrhs, A, lda, ipiv, stP, B, ldb, info, bc);
+}
+/********************************************************/
+
+/******************** GESV_OUTOFPLACE ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_gesv_outofplace(bool STRIDED,
+                                                rocblas_handle handle,
+                                                rocblas_int n,
+                                                rocblas_int nrhs,
+                                                float* A,
+                                                rocblas_int lda,
+                                                rocblas_stride stA,
+                                                rocblas_int* ipiv,
+                                                rocblas_stride stP,
+                                                float* B,
+                                                rocblas_int ldb,
+                                                rocblas_stride stB,
+                                                float* X,
+                                                rocblas_int ldx,
+                                                rocblas_stride stX,
+                                                rocblas_int* info,
+                                                rocblas_int bc)
+{
+    return STRIDED
+        ? rocblas_status_not_implemented // rocsolver_sgesv_outofplace_strided_batched(handle, n, nrhs, A, lda, stA, ipiv, stP, B, ldb, stB, X, ldx, stX, info, bc)
+        : rocsolver_sgesv_outofplace(handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, info);
+}
+
+inline rocblas_status rocsolver_gesv_outofplace(bool STRIDED,
+                                                rocblas_handle handle,
+                                                rocblas_int n,
+                                                rocblas_int nrhs,
+                                                double* A,
+                                                rocblas_int lda,
+                                                rocblas_stride stA,
+                                                rocblas_int* ipiv,
+                                                rocblas_stride stP,
+                                                double* B,
+                                                rocblas_int ldb,
+                                                rocblas_stride stB,
+                                                double* X,
+                                                rocblas_int ldx,
+                                                rocblas_stride stX,
+                                                rocblas_int* info,
+                                                rocblas_int bc)
+{
+    return STRIDED
+        ? rocblas_status_not_implemented // rocsolver_dgesv_outofplace_strided_batched(handle, n, nrhs, A, lda, stA, ipiv, stP, B, ldb, stB, X, ldx, stX, info, bc)
+        : rocsolver_dgesv_outofplace(handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, info);
+}
+
+inline rocblas_status rocsolver_gesv_outofplace(bool STRIDED,
+                                                rocblas_handle handle,
+                                                rocblas_int n,
+                                                rocblas_int nrhs,
+                                                rocblas_float_complex* A,
+                                                rocblas_int lda,
+                                                rocblas_stride stA,
+                                                rocblas_int* ipiv,
+                                                rocblas_stride stP,
+                                                rocblas_float_complex* B,
+                                                rocblas_int ldb,
+                                                rocblas_stride stB,
+                                                rocblas_float_complex* X,
+                                                rocblas_int ldx,
+                                                rocblas_stride stX,
+                                                rocblas_int* info,
+                                                rocblas_int bc)
+{
+    return STRIDED
+        ? rocblas_status_not_implemented // rocsolver_cgesv_outofplace_strided_batched(handle, n, nrhs, A, lda, stA, ipiv, stP, B, ldb, stB, X, ldx, stX, info, bc)
+        : rocsolver_cgesv_outofplace(handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, info);
+}
+
+inline rocblas_status rocsolver_gesv_outofplace(bool STRIDED,
+                                                rocblas_handle handle,
+                                                rocblas_int n,
+                                                rocblas_int nrhs,
+                                                rocblas_double_complex* A,
+                                                rocblas_int lda,
+                                                rocblas_stride stA,
+                                                rocblas_int* ipiv,
+                                                rocblas_stride stP,
+                                                rocblas_double_complex* B,
+                                                rocblas_int ldb,
+                                                rocblas_stride stB,
+                                                rocblas_double_complex* X,
+                                                rocblas_int ldx,
+                                                rocblas_stride stX,
+                                                rocblas_int* info,
+                                                rocblas_int bc)
+{
+    return STRIDED
+        ? rocblas_status_not_implemented // rocsolver_zgesv_outofplace_strided_batched(handle, n, nrhs, A, lda, stA, ipiv, stP, B, ldb, stB, X, ldx, stX, info, bc)
+        : rocsolver_zgesv_outofplace(handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, info);
+}
+
+// batched
+inline rocblas_status rocsolver_gesv_outofplace(bool STRIDED,
                                                 rocblas_handle handle,
-                                                rocblas_svect leftv,
-                                                rocblas_svect rightv,
-                                                rocblas_int m,
                                                 rocblas_int n,
+                                                rocblas_int nrhs,
                                                 float* const A[],
                                                 rocblas_int lda,
                                                 rocblas_stride stA,
-                                                float abstol,
-                                                float* residual,
-                                                rocblas_int max_sweeps,
-                                                rocblas_int* n_sweeps,
-                                                float* S,
-                                                rocblas_stride stS,
-                                                float* U,
-                                                rocblas_int ldu,
-                                                rocblas_stride stU,
-                                                float* V,
-                                                rocblas_int ldv,
-                                                rocblas_stride stV,
+                                                rocblas_int* ipiv,
+                                                rocblas_stride stP,
+                                                float* const B[],
+                                                rocblas_int ldb,
+                                                rocblas_stride stB,
+                                                float* const X[],
+                                                rocblas_int ldx,
+                                                rocblas_stride stX,
                                                 rocblas_int* info,
                                                 rocblas_int bc)
 {
-    return rocblas_status_not_implemented; // rocsolver_sgesvdj_notransv_batched(handle, leftv, rightv, m, n, A, lda, abstol,
-        // residual, max_sweeps, n_sweeps, S, stS, U, ldu, stU, V, ldv, stV, info, bc);
+    return rocblas_status_not_implemented; // rocsolver_sgesv_outofplace_batched(handle, n, nrhs, A, lda, ipiv, stP, B, ldb, info, bc);
 }
 
-inline rocblas_status rocsolver_gesvdj_notransv(bool STRIDED,
+inline rocblas_status rocsolver_gesv_outofplace(bool STRIDED,
                                                 rocblas_handle handle,
-                                                rocblas_svect leftv,
-                                                rocblas_svect rightv,
-                                                rocblas_int m,
                                                 rocblas_int n,
+                                                rocblas_int nrhs,
                                                 double* const A[],
                                                 rocblas_int lda,
                                                 rocblas_stride stA,
-                                                double abstol,
-                                                double* residual,
-                                                rocblas_int max_sweeps,
-                                                rocblas_int* n_sweeps,
-                                                double* S,
-                                                rocblas_stride stS,
-                                                double* U,
-                                                rocblas_int ldu,
-                                                rocblas_stride stU,
-                                                double* V,
-                                                rocblas_int ldv,
-                                                rocblas_stride stV,
+                                                rocblas_int* ipiv,
+                                                rocblas_stride stP,
+                                                double* const B[],
+                                                rocblas_int ldb,
+                                                rocblas_stride stB,
+                                                double* const X[],
+                                                rocblas_int ldx,
+                                                rocblas_stride stX,
                                                 rocblas_int* info,
                                                 rocblas_int bc)
 {
-    return rocblas_status_not_implemented; // rocsolver_dgesvdj_notransv_batched(handle, leftv, rightv, m, n, A, lda, abstol,
-        // residual, max_sweeps, n_sweeps, S, stS, U, ldu, stU, V, ldv, stV, info, bc);
+    return rocblas_status_not_implemented; // rocsolver_dgesv_outofplace_batched(handle, n, nrhs, A, lda, ipiv, stP, B, ldb, info, bc);
 }
 
-inline rocblas_status rocsolver_gesvdj_notransv(bool STRIDED,
+inline rocblas_status rocsolver_gesv_outofplace(bool STRIDED,
                                                 rocblas_handle handle,
-                                                rocblas_svect leftv,
-                                                rocblas_svect rightv,
-                                                rocblas_int m,
                                                 rocblas_int n,
+                                                rocblas_int nrhs,
                                                 rocblas_float_complex* const A[],
                                                 rocblas_int lda,
                                                 rocblas_stride stA,
-                                                float abstol,
-                                                float* residual,
-                                                rocblas_int max_sweeps,
-                                                rocblas_int* n_sweeps,
-                                                float* S,
-                                                rocblas_stride stS,
-                                                rocblas_float_complex* U,
-                                                rocblas_int ldu,
-                                                rocblas_stride stU,
-                                                rocblas_float_complex* V,
-                                                rocblas_int ldv,
-                                                rocblas_stride stV,
+                                                rocblas_int* ipiv,
+                                                rocblas_stride stP,
+                                                rocblas_float_complex* const B[],
+                                                rocblas_int ldb,
+                                                rocblas_stride stB,
+                                                rocblas_float_complex* const X[],
+                                                rocblas_int ldx,
+                                                rocblas_stride stX,
                                                 rocblas_int* info,
                                                 rocblas_int bc)
 {
-    return rocblas_status_not_implemented; // rocsolver_cgesvdj_notransv_batched(handle, leftv, rightv, m, n, A, lda, abstol,
-        // residual, max_sweeps, n_sweeps, S, stS, U, ldu, stU, V, ldv, stV, info, bc);
+    return rocblas_status_not_implemented; // rocsolver_cgesv_outofplace_batched(handle, n, nrhs, A, lda, ipiv, stP, B, ldb, info, bc);
 }
 
-inline rocblas_status rocsolver_gesvdj_notransv(bool STRIDED,
+inline rocblas_status rocsolver_gesv_outofplace(bool STRIDED,
                                                 rocblas_handle handle,
-                                                rocblas_svect leftv,
-                                                rocblas_svect rightv,
-                                                rocblas_int m,
                                                 rocblas_int n,
+                                                rocblas_int nrhs,
                                                 rocblas_double_complex* const A[],
                                                 rocblas_int lda,
                                                 rocblas_stride stA,
-                                                double abstol,
-                                                double* residual,
-                                                rocblas_int max_sweeps,
-                                                rocblas_int* n_sweeps,
-                                                double* S,
-                                                rocblas_stride stS,
-                                                rocblas_double_complex* U,
-                                                rocblas_int ldu,
-                                                rocblas_stride stU,
-                                                rocblas_double_complex* V,
-                                                rocblas_int ldv,
-                                                rocblas_stride stV,
+                                                rocblas_int* ipiv,
+                                                rocblas_stride stP,
+                                                rocblas_double_complex* const B[],
+                                                rocblas_int ldb,
+                                                rocblas_stride stB,
+                                                rocblas_double_complex* const X[],
+                                                rocblas_int ldx,
+                                                rocblas_stride stX,
                                                 rocblas_int* info,
                                                 rocblas_int bc)
 {
-    return rocblas_status_not_implemented; // rocsolver_zgesvdj_notransv_batched(handle, leftv, rightv, m, n, A, lda, abstol,
-        // residual, max_sweeps, n_sweeps, S, stS, U, ldu, stU, V, ldv, stV, info, bc);
+    return rocblas_status_not_implemented; // rocsolver_zgesv_outofplace_batched(handle, n, nrhs, A, lda, ipiv, stP, B, ldb, info, bc);
+}
+/********************************************************/
+
+/******************** GESV_MIXED ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_gesv_mixed(bool STRIDED,
+                                           rocblas_handle handle,
+                                           rocblas_int n,
+                                           rocblas_int nrhs,
+                                           double* A,
+                                           rocblas_int lda,
+                                           rocblas_stride stA,
+                                           rocblas_int* ipiv,
+                                           rocblas_stride stP,
+                                           double* B,
+                                           rocblas_int ldb,
+                                           rocblas_stride stB,
+                                           double* X,
+                                           rocblas_int ldx,
+                                           rocblas_stride stX,
+                                           rocblas_int* iter,
+                                           rocblas_int* info,
+                                           rocblas_int bc)
+{
+    return STRIDED ? rocsolver_dsgesv_strided_batched(handle, n, nrhs, A, lda, stA, ipiv, stP, B,
+                                                      ldb, stB, X, ldx, stX, iter, info, bc)
+                   : rocsolver_dsgesv(handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, iter, info);
+}
+
+inline rocblas_status rocsolver_gesv_mixed(bool STRIDED,
+                                           rocblas_handle handle,
+                                           rocblas_int n,
+                                           rocblas_int nrhs,
+                                           rocblas_double_complex* A,
+                                           rocblas_int lda,
+                                           rocblas_stride stA,
+                                           rocblas_int* ipiv,
+                                           rocblas_stride stP,
+                                           rocblas_double_complex* B,
+                                           rocblas_int ldb,
+                                           rocblas_stride stB,
+                                           rocblas_double_complex* X,
+                                           rocblas_int ldx,
+                                           rocblas_stride stX,
+                                           rocblas_int* iter,
+                                           rocblas_int* info,
+                                           rocblas_int bc)
+{
+    return STRIDED ? rocsolver_zcgesv_strided_batched(handle, n, nrhs, A, lda, stA, ipiv, stP, B,
+                                                      ldb, stB, X, ldx, stX, iter, info, bc)
+                   : rocsolver_zcgesv(handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, iter, info);
+}
+
+// batched
+inline rocblas_status rocsolver_gesv_mixed(bool STRIDED,
+                                           rocblas_handle handle,
+                                           rocblas_int n,
+                                           rocblas_int nrhs,
+                                           double* const A[],
+                                           rocblas_int lda,
+                                           rocblas_stride stA,
+                                           rocblas_int* ipiv,
+                                           rocblas_stride stP,
+                                           double* const B[],
+                                           rocblas_int ldb,
+                                           rocblas_stride stB,
+                                           double* const X[],
+                                           rocblas_int ldx,
+                                           rocblas_stride stX,
+                                           rocblas_int* iter,
+                                           rocblas_int* info,
+                                           rocblas_int bc)
+{
+    return rocsolver_dsgesv_batched(handle, n, nrhs, A, lda, ipiv, stP, B, ldb, X, ldx, iter, info,
+                                    bc);
+}
+
+inline rocblas_status rocsolver_gesv_mixed(bool STRIDED,
+                                           rocblas_handle handle,
+                                           rocblas_int n,
+                                           rocblas_int nrhs,
+                                           rocblas_double_complex* const A[],
+                                           rocblas_int lda,
+                                           rocblas_stride stA,
+                                           rocblas_int* ipiv,
+                                           rocblas_stride stP,
+                                           rocblas_double_complex* const B[],
+                                           rocblas_int ldb,
+                                           rocblas_stride stB,
+                                           rocblas_double_complex* const X[],
+                                           rocblas_int ldx,
+                                           rocblas_stride stX,
+                                           rocblas_int* iter,
+                                           rocblas_int* info,
+                                           rocblas_int bc)
+{
+    return rocsolver_zcgesv_batched(handle, n, nrhs, A, lda, ipiv, stP, B, ldb, X, ldx, iter, info,
+                                    bc);
 }
 /********************************************************/
 
-/******************** GESVDX ********************/
+/******************** GESV_RBT ********************/
 // normal and strided_batched
-inline rocblas_status rocsolver_gesvdx(bool STRIDED,
-                                       rocblas_handle handle,
-                                       rocblas_svect leftv,
-                                       rocblas_svect rightv,
-                                       rocblas_srange srange,
-                                       rocblas_int m,
-                                       rocblas_int n,
-                                       float* A,
-                                       rocblas_int lda,
-                                       rocblas_stride stA,
-                                       float vl,
-                                       float vu,
-                                       rocblas_int il,
-                                       rocblas_int iu,
-                                       rocblas_int* ns,
-                                       float* S,
-                                       rocblas_stride stS,
-                                       float* U,
-                                       rocblas_int ldu,
-                                       rocblas_stride stU,
-                                       float* V,
-                                       rocblas_int ldv,
-                                       rocblas_stride stV,
-                                       rocblas_int* ifail,
-                                       rocblas_stride stF,
-                                       rocblas_int* info,
-                                       rocblas_int bc)
+inline rocblas_status rocsolver_gesv_rbt(bool STRIDED,
+                                         rocblas_handle handle,
+                                         rocblas_int n,
+                                         rocblas_int nrhs,
+                                         float* A,
+                                         rocblas_int lda,
+                                         rocblas_stride stA,
+                                         float* B,
+                                         rocblas_int ldb,
+                                         rocblas_stride stB,
+                                         rocblas_int* info,
+                                         rocblas_int bc)
 {
-    return STRIDED ? rocsolver_sgesvdx_strided_batched(handle, leftv, rightv, srange, m, n, A, lda,
-                                                       stA, vl, vu, il, iu, ns, S, stS, U, ldu, stU,
-                                                       V, ldv, stV, ifail, stF, info, bc)
-                   : rocsolver_sgesvdx(handle, leftv, rightv, srange, m, n, A, lda, vl, vu, il, iu,
-                                       ns, S, U, ldu, V, ldv, ifail, info);
+    return STRIDED ? rocsolver_sgesv_rbt_strided_batched(handle, n, nrhs, A, lda, stA, B, ldb, stB,
+                                                         info, bc)
+                   : rocsolver_sgesv_rbt(handle, n, nrhs, A, lda, B, ldb, info);
 }
 
-inline rocblas_status rocsolver_gesvdx(bool STRIDED,
-                                       rocblas_handle handle,
-                                       rocblas_svect leftv,
-                                       rocblas_svect rightv,
-                                       rocblas_srange srange,
-                                       rocblas_int m,
-                                       rocblas_int n,
-                                       double* A,
-                                       rocblas_int lda,
-                                       rocblas_stride stA,
-                                       double vl,
-                                       double vu,
-                                       rocblas_int il,
-                                       rocblas_int iu,
-                                       rocblas_int* ns,
-                                       double* S,
-                                       rocblas_stride stS,
-                                       double* U,
-                                       rocblas_int ldu,
-                                       rocblas_stride stU,
-                                       double* V,
-                                       rocblas_int ldv,
-                                       rocblas_stride stV,
-                                       rocblas_int* ifail,
-                                       rocblas_stride stF,
-                                       rocblas_int* info,
-                                       rocblas_int bc)
+inline rocblas_status rocsolver_gesv_rbt(bool STRIDED,
+                                         rocblas_handle handle,
+                                         rocblas_int n,
+                                         rocblas_int nrhs,
+                                         double* A,
+                                         rocblas_int lda,
+                                         rocblas_stride stA,
+                                         double* B,
+                                         rocblas_int ldb,
+                                         rocblas_stride stB,
+                                         rocblas_int* info,
+                                         rocblas_int bc)
 {
-    return STRIDED ? rocsolver_dgesvdx_strided_batched(handle, leftv, rightv, srange, m, n, A, lda,
-                                                       stA, vl, vu, il, iu, ns, S, stS, U, ldu, stU,
-                                                       V, ldv, stV, ifail, stF, info, bc)
-                   : rocsolver_dgesvdx(handle, leftv, rightv, srange, m, n, A, lda, vl, vu, il, iu,
-                                       ns, S, U, ldu, V, ldv, ifail, info);
+    return STRIDED ? rocsolver_dgesv_rbt_strided_batched(handle, n, nrhs, A, lda, stA, B, ldb, stB,
+                                                         info, bc)
+                   : rocsolver_dgesv_rbt(handle, n, nrhs, A, lda, B, ldb, info);
 }
 
-inline rocblas_status rocsolver_gesvdx(bool STRIDED,
-                                       rocblas_handle handle,
-                                       rocblas_svect leftv,
-                                       rocblas_svect rightv,
-                                       rocblas_srange srange,
-                                       rocblas_int m,
-                                       rocblas_int n,
-                                       rocblas_float_complex* A,
-                                       rocblas_int lda,
-                                       rocblas_stride stA,
-                                       float vl,
-                                       float vu,
-                                       rocblas_int il,
-                                       rocblas_int iu,
-                                       rocblas_int* ns,
-                                       float* S,
-                                       rocblas_stride stS,
-                                       rocblas_float_complex* U,
-                                       rocblas_int ldu,
-                                       rocblas_stride stU,
-                                       rocblas_float_complex* V,
-                                       rocblas_int ldv,
-                                       rocblas_stride stV,
-                                       rocblas_int* ifail,
-                                       rocblas_stride stF,
-                                       rocblas_int* info,
-                                       rocblas_int bc)
+inline rocblas_status rocsolver_gesv_rbt(bool STRIDED,
+                                         rocblas_handle handle,
+                                         rocblas_int n,
+                                         rocblas_int nrhs,
+                                         rocblas_float_complex* A,
+                                         rocblas_int lda,
+                                         rocblas_stride stA,
+                                         rocblas_float_complex* B,
+                                         rocblas_int ldb,
+                                         rocblas_stride stB,
+                                         rocblas_int* info,
+                                         rocblas_int bc)
 {
-    return STRIDED ? rocsolver_cgesvdx_strided_batched(handle, leftv, rightv, srange, m, n, A, lda,
-                                                       stA, vl, vu, il, iu, ns, S, stS, U, ldu, stU,
-                                                       V, ldv, stV, ifail, stF, info, bc)
-                   : rocsolver_cgesvdx(handle, leftv, rightv, srange, m, n, A, lda, vl, vu, il, iu,
-                                       ns, S, U, ldu, V, ldv, ifail, info);
+    return STRIDED ? rocsolver_cgesv_rbt_strided_batched(handle, n, nrhs, A, lda, stA, B, ldb, stB,
+                                                         info, bc)
+                   : rocsolver_cgesv_rbt(handle, n, nrhs, A, lda, B, ldb, info);
 }
 
-inline rocblas_status rocsolver_gesvdx(bool STRIDED,
-                                       rocblas_handle handle,
-                                       rocblas_svect leftv,
-                                       rocblas_svect rightv,
-                                       rocblas_srange srange,
-                                       rocblas_int m,
-                                       rocblas_int n,
-                                       rocblas_double_complex* A,
-                                       rocblas_int lda,
-                                       rocblas_stride stA,
-                                       double vl,
-                                       double vu,
-                                       rocblas_int il,
-                                       rocblas_int iu,
-                                       rocblas_int* ns,
-                                       double* S,
-                                       rocblas_stride stS,
-                                       rocblas_double_complex* U,
-                                       rocblas_int ldu,
-                                       rocblas_stride stU,
-                                       rocblas_double_complex* V,
-                                       rocblas_int ldv,
-                                       rocblas_stride stV,
-                                       rocblas_int* ifail,
-                                       rocblas_stride stF,
-                                       rocblas_int* info,
-                                       rocblas_int bc)
+inline rocblas_status rocsolver_gesv_rbt(bool STRIDED,
+                                         rocblas_handle handle,
+                                         rocblas_int n,
+                                         rocblas_int nrhs,
+                                         rocblas_double_complex* A,
+                                         rocblas_int lda,
+                                         rocblas_stride stA,
+                                         rocblas_double_complex* B,
+                                         rocblas_int ldb,
+                                         rocblas_stride stB,
+                                         rocblas_int* info,
+                                         rocblas_int bc)
 {
-    return STRIDED ? rocsolver_zgesvdx_strided_batched(handle, leftv, rightv, srange, m, n, A, lda,
-                                                       stA, vl, vu, il, iu, ns, S, stS, U, ldu, stU,
-                                                       V, ldv, stV, ifail, stF, info, bc)
-                   : rocsolver_zgesvdx(handle, leftv, rightv, srange, m, n, A, lda, vl, vu, il, iu,
-                                       ns, S, U, ldu, V, ldv, ifail, info);
+    return STRIDED ? rocsolver_zgesv_rbt_strided_batched(handle, n, nrhs, A, lda, stA, B, ldb, stB,
+                                                         info, bc)
+                   : rocsolver_zgesv_rbt(handle, n, nrhs, A, lda, B, ldb, info);
 }
 
 // batched
-inline rocblas_status rocsolver_gesvdx(bool STRIDED,
-                                       rocblas_handle handle,
-                                       rocblas_svect leftv,
-                                       rocblas_svect rightv,
-                                       rocblas_srange srange,
-                                       rocblas_int m,
-                                       rocblas_int n,
-                                       float* const A[],
-                                       rocblas_int lda,
-                                       rocblas_stride stA,
-                                       float vl,
-                                       float vu,
-                                       rocblas_int il,
-                                       rocblas_int iu,
-                                       rocblas_int* ns,
-                                       float* S,
-                                       rocblas_stride stS,
-                                       float* U,
-                                       rocblas_int ldu,
-                                       rocblas_stride stU,
-                                       float* V,
-                                       rocblas_int ldv,
-                                       rocblas_stride stV,
-                                       rocblas_int* ifail,
-                                       rocblas_stride stF,
-                                       rocblas_int* info,
-                                       rocblas_int bc)
+inline rocblas_status rocsolver_gesv_rbt(bool STRIDED,
+                                         rocblas_handle handle,
+                                         rocblas_int n,
+                                         rocblas_int nrhs,
+                                         float* const A[],
+                                         rocblas_int lda,
+                                         rocblas_stride stA,
+                                         float* const B[],
+                                         rocblas_int ldb,
+                                         rocblas_stride stB,
+                                         rocblas_int* info,
+                                         rocblas_int bc)
+{
+    return rocsolver_sgesv_rbt_batched(handle, n, nrhs, A, lda, B, ldb, info, bc);
+}
+
+inline rocblas_status rocsolver_gesv_rbt(bool STRIDED,
+                                         rocblas_handle handle,
+                                         rocblas_int n,
+                                         rocblas_int nrhs,
+                                         double* const A[],
+                                         rocblas_int lda,
+                                         rocblas_stride stA,
+                                         double* const B[],
+                                         rocblas_int ldb,
+                                         rocblas_stride stB,
+                                         rocblas_int* info,
+                                         rocblas_int bc)
+{
+    return rocsolver_dgesv_rbt_batched(handle, n, nrhs, A, lda, B, ldb, info, bc);
+}
+
+inline rocblas_status rocsolver_gesv_rbt(bool STRIDED,
+                                         rocblas_handle handle,
+                                         rocblas_int n,
+                                         rocblas_int nrhs,
+                                         rocblas_float_complex* const A[],
+                                         rocblas_int lda,
+                                         rocblas_stride stA,
+                                         rocblas_float_complex* const B[],
+                                         rocblas_int ldb,
+                                         rocblas_stride stB,
+                                         rocblas_int* info,
+                                         rocblas_int bc)
+{
+    return rocsolver_cgesv_rbt_batched(handle, n, nrhs, A, lda, B, ldb, info, bc);
+}
+
+inline rocblas_status rocsolver_gesv_rbt(bool STRIDED,
+                                         rocblas_handle handle,
+                                         rocblas_int n,
+                                         rocblas_int nrhs,
+                                         rocblas_double_complex* const A[],
+                                         rocblas_int lda,
+                                         rocblas_stride stA,
+                                         rocblas_double_complex* const B[],
+                                         rocblas_int ldb,
+                                         rocblas_stride stB,
+                                         rocblas_int* info,
+                                         rocblas_int bc)
+{
+    return rocsolver_zgesv_rbt_batched(handle, n, nrhs, A, lda, B, ldb, info, bc);
+}
+/********************************************************/
+
+/******************** GETRF_LOWPREC ********************/
+// strided_batched, with half or bfloat16 storage
+inline rocblas_status rocsolver_getrf_lowprec(bool NPVT,
+                                              rocblas_handle handle,
+                                              rocblas_int m,
+                                              rocblas_int n,
+                                              rocblas_half* A,
+                                              rocblas_int lda,
+                                              rocblas_stride stA,
+                                              rocblas_int* ipiv,
+                                              rocblas_stride stP,
+                                              rocblas_int* info,
+                                              rocblas_int bc)
 {
-    return rocsolver_sgesvdx_batched(handle, leftv, rightv, srange, m, n, A, lda, vl, vu, il, iu,
-                                     ns, S, stS, U, ldu, stU, V, ldv, stV, ifail, stF, info, bc);
+    return NPVT ? rocsolver_hsgetrf_npvt_strided_batched(handle, m, n, A, lda, stA, info, bc)
+                : rocsolver_hsgetrf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, info, bc);
 }
 
-inline rocblas_status rocsolver_gesvdx(bool STRIDED,
-                                       rocblas_handle handle,
-                                       rocblas_svect leftv,
-                                       rocblas_svect rightv,
-                                       rocblas_srange srange,
-                                       rocblas_int m,
-                                       rocblas_int n,
-                                       double* const A[],
-                                       rocblas_int lda,
-                                       rocblas_stride stA,
-                                       double vl,
-                                       double vu,
-                                       rocblas_int il,
-                                       rocblas_int iu,
-                                       rocblas_int* ns,
-                                       double* S,
-                                       rocblas_stride stS,
-                                       double* U,
-                                       rocblas_int ldu,
-                                       rocblas_stride stU,
-                                       double* V,
-                                       rocblas_int ldv,
-                                       rocblas_stride stV,
-                                       rocblas_int* ifail,
-                                       rocblas_stride stF,
-                                       rocblas_int* info,
-                                       rocblas_int bc)
+inline rocblas_status rocsolver_getrf_lowprec(bool NPVT,
+                                              rocblas_handle handle,
+                                              rocblas_int m,
+                                              rocblas_int n,
+                                              rocblas_bfloat16* A,
+                                              rocblas_int lda,
+                                              rocblas_stride stA,
+                                              rocblas_int* ipiv,
+                                              rocblas_stride stP,
+                                              rocblas_int* info,
+                                              rocblas_int bc)
 {
-    return rocsolver_dgesvdx_batched(handle, leftv, rightv, srange, m, n, A, lda, vl, vu, il, iu,
-                                     ns, S, stS, U, ldu, stU, V, ldv, stV, ifail, stF, info, bc);
+    return NPVT ? rocsolver_bsgetrf_npvt_strided_batched(handle, m, n, A, lda, stA, info, bc)
+                : rocsolver_bsgetrf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, info, bc);
 }
 
-inline rocblas_status rocsolver_gesvdx(bool STRIDED,
-                                       rocblas_handle handle,
-                                       rocblas_svect leftv,
-                                       rocblas_svect rightv,
-                                       rocblas_srange srange,
-                                       rocblas_int m,
-                                       rocblas_int n,
-                                       rocblas_float_complex* const A[],
-                                       rocblas_int lda,
-                                       rocblas_stride stA,
-                                       float vl,
-                                       float vu,
-                                       rocblas_int il,
-                                       rocblas_int iu,
-                                       rocblas_int* ns,
-                                       float* S,
-                                       rocblas_stride stS,
-                                       rocblas_float_complex* U,
-                                       rocblas_int ldu,
-                                       rocblas_stride stU,
-                                       rocblas_float_complex* V,
-                                       rocblas_int ldv,
-                                       rocblas_stride stV,
-                                       rocblas_int* ifail,
-                                       rocblas_stride stF,
-                                       rocblas_int* info,
-                                       rocblas_int bc)
+/********************************************************/
+
+/******************** GETRS_LOWPREC ********************/
+// strided_batched, with half or bfloat16 storage
+inline rocblas_status rocsolver_getrs_lowprec(rocblas_handle handle,
+                                              rocblas_operation trans,
+                                              rocblas_int n,
+                                              rocblas_int nrhs,
+                                              rocblas_half* A,
+                                              rocblas_int lda,
+                                              rocblas_stride stA,
+                                              rocblas_int* ipiv,
+                                              rocblas_stride stP,
+                                              rocblas_half* B,
+                                              rocblas_int ldb,
+                                              rocblas_stride stB,
+                                              rocblas_int bc)
 {
-    return rocsolver_cgesvdx_batched(handle, leftv, rightv, srange, m, n, A, lda, vl, vu, il, iu,
-                                     ns, S, stS, U, ldu, stU, V, ldv, stV, ifail, stF, info, bc);
+    return rocsolver_hsgetrs_strided_batched(handle, trans, n, nrhs, A, lda, stA, ipiv, stP, B, ldb,
+                                             stB, bc);
 }
 
-inline rocblas_status rocsolver_gesvdx(bool STRIDED,
-                                       rocblas_handle handle,
-                                       rocblas_svect leftv,
-                                       rocblas_svect rightv,
-                                       rocblas_srange srange,
-                                       rocblas_int m,
-                                       rocblas_int n,
-                                       rocblas_double_complex* const A[],
-                                       rocblas_int lda,
-                                       rocblas_stride stA,
-                                       double vl,
-                                       double vu,
-                                       rocblas_int il,
-                                       rocblas_int iu,
-                                       rocblas_int* ns,
-                                       double* S,
-                                       rocblas_stride stS,
-                                       rocblas_double_complex* U,
-                                       rocblas_int ldu,
-                                       rocblas_stride stU,
-                                       rocblas_double_complex* V,
-                                       rocblas_int ldv,
-                                       rocblas_stride stV,
-                                       rocblas_int* ifail,
-                                       rocblas_stride stF,
-                                       rocblas_int* info,
-                                       rocblas_int bc)
+inline rocblas_status rocsolver_getrs_lowprec(rocblas_handle handle,
+                                              rocblas_operation trans,
+                                              rocblas_int n,
+                                              rocblas_int nrhs,
+                                              rocblas_bfloat16* A,
+                                              rocblas_int lda,
+                                              rocblas_stride stA,
+                                              rocblas_int* ipiv,
+                                              rocblas_stride stP,
+                                              rocblas_bfloat16* B,
+                                              rocblas_int ldb,
+                                              rocblas_stride stB,
+                                              rocblas_int bc)
 {
-    return rocsolver_zgesvdx_batched(handle, leftv, rightv, srange, m, n, A, lda, vl, vu, il, iu,
-                                     ns, S, stS, U, ldu, stU, V, ldv, stV, ifail, stF, info, bc);
+    return rocsolver_bsgetrs_strided_batched(handle, trans, n, nrhs, A, lda, stA, ipiv, stP, B, ldb,
+                                             stB, bc);
 }
+
 /********************************************************/
 
-/******************** GESVDX_NOTRANSV ********************/
-// normal and strided_batched
-inline rocblas_status rocsolver_gesvdx_notransv(bool STRIDED,
-                                                rocblas_handle handle,
-                                                rocblas_svect leftv,
-                                                rocblas_svect rightv,
-                                                rocblas_srange srange,
-                                                rocblas_int m,
-                                                rocblas_int n,
-                                                float* A,
-                                                rocblas_int lda,
-                                                rocblas_stride stA,
-                                                float vl,
-                                                float vu,
-                                                rocblas_int il,
-                                                rocblas_int iu,
-                                                rocblas_int* ns,
-                                                float* S,
-                                                rocblas_stride stS,
-                                                float* U,
-                                                rocblas_int ldu,
-                                                rocblas_stride stU,
-                                                float* V,
-                                                rocblas_int ldv,
-                                                rocblas_stride stV,
-                                                rocblas_int* ifail,
-                                                rocblas_stride stF,
-                                                rocblas_int* info,
-                                                rocblas_int bc)
+/******************** POTRF_LOWPREC ********************/
+// strided_batched, with half or bfloat16 storage
+inline rocblas_status rocsolver_potrf_lowprec(rocblas_handle handle,
+                                              rocblas_fill uplo,
+                                              rocblas_int n,
+                                              rocblas_half* A,
+                                              rocblas_int lda,
+                                              rocblas_stride stA,
+                                              rocblas_int* info,
+                                              rocblas_int bc)
 {
-    return STRIDED
-        ? rocsolver_sgesvdx_notransv_strided_batched(handle, leftv, rightv, srange, m, n, A, lda,
-                                                     stA, vl, vu, il, iu, ns, S, stS, U, ldu, stU,
-                                                     V, ldv, stV, ifail, stF, info, bc)
-        : rocblas_status_not_implemented; // rocsolver_sgesvdx_notransv(handle, leftv, rightv, srange, m, n, A, lda, vl, vu, il, iu,
-    // ns, S, U, ldu, V, ldv, ifail, info);
+    return rocsolver_hspotrf_strided_batched(handle, uplo, n, A, lda, stA, info, bc);
 }
 
-inline rocblas_status rocsolver_gesvdx_notransv(bool STRIDED,
-                                                rocblas_handle handle,
-                                                rocblas_svect leftv,
-                                                rocblas_svect rightv,
-                                                rocblas_srange srange,
-                                                rocblas_int m,
-                                                rocblas_int n,
-                                                double* A,
-                                                rocblas_int lda,
-                                                rocblas_stride stA,
-                                                double vl,
-                                                double vu,
-                                                rocblas_int il,
-                                                rocblas_int iu,
-                                                rocblas_int* ns,
-                                                double* S,
-                                                rocblas_stride stS,
-                                                double* U,
-                                                rocblas_int ldu,
-                                                rocblas_stride stU,
-                                                double* V,
-                                                rocblas_int ldv,
-                                                rocblas_stride stV,
-                                                rocblas_int* ifail,
-                                                rocblas_stride stF,
-                                                rocblas_int* info,
-                                                rocblas_int bc)
+inline rocblas_status rocsolver_potrf_lowprec(rocblas_handle handle,
+                                              rocblas_fill uplo,
+                                              rocblas_int n,
+                                              rocblas_bfloat16* A,
+                                              rocblas_int lda,
+                                              rocblas_stride stA,
+                                              rocblas_int* info,
+                                              rocblas_int bc)
 {
-    return STRIDED
-        ? rocsolver_dgesvdx_notransv_strided_batched(handle, leftv, rightv, srange, m, n, A, lda,
-                                                     stA, vl, vu, il, iu, ns, S, stS, U, ldu, stU,
-                                                     V, ldv, stV, ifail, stF, info, bc)
-        : rocblas_status_not_implemented; // rocsolver_dgesvdx_notransv(handle, leftv, rightv, srange, m, n, A, lda, vl, vu, il, iu,
-    // ns, S, U, ldu, V, ldv, ifail, info);
+    return rocsolver_bspotrf_strided_batched(handle, uplo, n, A, lda, stA, info, bc);
 }
 
-inline rocblas_status rocsolver_gesvdx_notransv(bool STRIDED,
-                                                rocblas_handle handle,
-                                                rocblas_svect leftv,
-                                                rocblas_svect rightv,
-                                                rocblas_srange srange,
-                                                rocblas_int m,
-                                                rocblas_int n,
-                                                rocblas_float_complex* A,
-                                                rocblas_int lda,
-                                                rocblas_stride stA,
-                                                float vl,
-                                                float vu,
-                                                rocblas_int il,
-                                                rocblas_int iu,
-                                                rocblas_int* ns,
-                                                float* S,
-                                                rocblas_stride stS,
-                                                rocblas_float_complex* U,
-                                                rocblas_int ldu,
-                                                rocblas_stride stU,
-                                                rocblas_float_complex* V,
-                                                rocblas_int ldv,
-                                                rocblas_stride stV,
-                                                rocblas_int* ifail,
-                                                rocblas_stride stF,
-                                                rocblas_int* info,
-                                                rocblas_int bc)
+/********************************************************/
+
+/******************** GETRI_OUTOFPLACE ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_getri_outofplace(bool STRIDED,
+                                                 rocblas_handle handle,
+                                                 rocblas_int n,
+                                                 float* A,
+                                                 rocblas_int lda,
+                                                 rocblas_stride stA,
+                                                 rocblas_int* ipiv,
+                                                 rocblas_stride stP,
+                                                 float* C,
+                                                 rocblas_int ldc,
+                                                 rocblas_stride stC,
+                                                 rocblas_int* info,
+                                                 rocblas_int bc)
 {
-    return STRIDED
-        ? rocsolver_cgesvdx_notransv_strided_batched(handle, leftv, rightv, srange, m, n, A, lda,
-                                                     stA, vl, vu, il, iu, ns, S, stS, U, ldu, stU,
-                                                     V, ldv, stV, ifail, stF, info, bc)
-        : rocblas_status_not_implemented; // rocsolver_cgesvdx_notransv(handle, leftv, rightv, srange, m, n, A, lda, vl, vu, il, iu,
-    // ns, S, U, ldu, V, ldv, ifail, info);
+    return STRIDED ? rocsolver_sgetri_outofplace_strided_batched(handle, n, A, lda, stA, ipiv, stP,
+                                                                 C, ldc, stC, info, bc)
+                   : rocsolver_sgetri_outofplace(handle, n, A, lda, ipiv, C, ldc, info);
 }
 
-inline rocblas_status rocsolver_gesvdx_notransv(bool STRIDED,
-                                                rocblas_handle handle,
-                                                rocblas_svect leftv,
-                                                rocblas_svect rightv,
-                                                rocblas_srange srange,
-                                                rocblas_int m,
-                                                rocblas_int n,
-                                                rocblas_double_complex* A,
-                                                rocblas_int lda,
-                                                rocblas_stride stA,
-                                                double vl,
-                                                double vu,
-                                                rocblas_int il,
-                                                rocblas_int iu,
-                                                rocblas_int* ns,
-                                                double* S,
-                                                rocblas_stride stS,
-                                                rocblas_double_complex* U,
-                                                rocblas_int ldu,
-                                                rocblas_stride stU,
-                                                rocblas_double_complex* V,
-                                                rocblas_int ldv,
-                                                rocblas_stride stV,
-                                                rocblas_int* ifail,
-                                                rocblas_stride stF,
-                                                rocblas_int* info,
-                                                rocblas_int bc)
+inline rocblas_status rocsolver_getri_outofplace(bool STRIDED,
+                                                 rocblas_handle handle,
+                                                 rocblas_int n,
+                                                 double* A,
+                                                 rocblas_int lda,
+                                                 rocblas_stride stA,
+                                                 rocblas_int* ipiv,
+                                                 rocblas_stride stP,
+                                                 double* C,
+                                                 rocblas_int ldc,
+                                                 rocblas_stride stC,
+                                                 rocblas_int* info,
+                                                 rocblas_int bc)
 {
-    return STRIDED
-        ? rocsolver_zgesvdx_notransv_strided_batched(handle, leftv, rightv, srange, m, n, A, lda,
-                                                     stA, vl, vu, il, iu, ns, S, stS, U, ldu, stU,
-                                                     V, ldv, stV, ifail, stF, info, bc)
-        : rocblas_status_not_implemented; // rocsolver_zgesvdx_notransv(handle, leftv, rightv, srange, m, n, A, lda, vl, vu, il, iu,
-    // ns, S, U, ldu, V, ldv, ifail, info);
+    return STRIDED ? rocsolver_dgetri_outofplace_strided_batched(handle, n, A, lda, stA, ipiv, stP,
+                                                                 C, ldc, stC, info, bc)
+                   : rocsolver_dgetri_outofplace(handle, n, A, lda, ipiv, C, ldc, info);
+}
+
+inline rocblas_status rocsolver_getri_outofplace(bool STRIDED,
+                                                 rocblas_handle handle,
+                                                 rocblas_int n,
+                                                 rocblas_float_complex* A,
+                                                 rocblas_int lda,
+                                                 rocblas_stride stA,
+                                                 rocblas_int* ipiv,
+                                                 rocblas_stride stP,
+                                                 rocblas_float_complex* C,
+                                                 rocblas_int ldc,
+                                                 rocblas_stride stC,
+                                                 rocblas_int* info,
+                                                 rocblas_int bc)
+{
+    return STRIDED ? rocsolver_cgetri_outofplace_strided_batched(handle, n, A, lda, stA, ipiv, stP,
+                                                                 C, ldc, stC, info, bc)
+                   : rocsolver_cgetri_outofplace(handle, n, A, lda, ipiv, C, ldc, info);
+}
+
+inline rocblas_status rocsolver_getri_outofplace(bool STRIDED,
+                                                 rocblas_handle handle,
+                                                 rocblas_int n,
+                                                 rocblas_double_complex* A,
+                                                 rocblas_int lda,
+                                                 rocblas_stride stA,
+                                                 rocblas_int* ipiv,
+                                                 rocblas_stride stP,
+                                                 rocblas_double_complex* C,
+                                                 rocblas_int ldc,
+                                                 rocblas_stride stC,
+                                                 rocblas_int* info,
+                                                 rocblas_int bc)
+{
+    return STRIDED ? rocsolver_zgetri_outofplace_strided_batched(handle, n, A, lda, stA, ipiv, stP,
+                                                                 C, ldc, stC, info, bc)
+                   : rocsolver_zgetri_outofplace(handle, n, A, lda, ipiv, C, ldc, info);
 }
 
 // batched
-inline rocblas_status rocsolver_gesvdx_notransv(bool STRIDED,
-                                                rocblas_handle handle,
-                                                rocblas_svect leftv,
-                                                rocblas_svect rightv,
-                                                rocblas_srange srange,
-                                                rocblas_int m,
-                                                rocblas_int n,
-                                                float* const A[],
-                                                rocblas_int lda,
-                                                rocblas_stride stA,
-                                                float vl,
-                                                float vu,
-                                                rocblas_int il,
-                                                rocblas_int iu,
-                                                rocblas_int* ns,
-                                                float* S,
-                                                rocblas_stride stS,
-                                                float* U,
-                                                rocblas_int ldu,
-                                                rocblas_stride stU,
-                                                float* V,
-                                                rocblas_int ldv,
-                                                rocblas_stride stV,
-                                                rocblas_int* ifail,
-                                                rocblas_stride stF,
-                                                rocblas_int* info,
-                                                rocblas_int bc)
+inline rocblas_status rocsolver_getri_outofplace(bool STRIDED,
+                                                 rocblas_handle handle,
+                                                 rocblas_int n,
+                                                 float* const A[],
+                                                 rocblas_int lda,
+                                                 rocblas_stride stA,
+                                                 rocblas_int* ipiv,
+                                                 rocblas_stride stP,
+                                                 float* const C[],
+                                                 rocblas_int ldc,
+                                                 rocblas_stride stC,
+                                                 rocblas_int* info,
+                                                 rocblas_int bc)
 {
-    return rocblas_status_not_implemented; // rocsolver_sgesvdx_notransv_batched(handle, leftv, rightv, srange, m, n, A, lda, vl, vu, il, iu,
-        // ns, S, stS, U, ldu, stU, V, ldv, stV, ifail, stF, info, bc);
+    return rocsolver_sgetri_outofplace_batched(handle, n, A, lda, ipiv, stP, C, ldc, info, bc);
 }
 
-inline rocblas_status rocsolver_gesvdx_notransv(bool STRIDED,
-                                                rocblas_handle handle,
-                                                rocblas_svect leftv,
-                                                rocblas_svect rightv,
-                                                rocblas_srange srange,
-                                                rocblas_int m,
-                                                rocblas_int n,
-                                                double* const A[],
-                                                rocblas_int lda,
-                                                rocblas_stride stA,
-                                                double vl,
-                                                double vu,
-                                                rocblas_int il,
-                                                rocblas_int iu,
-                                                rocblas_int* ns,
-                                                double* S,
-                                                rocblas_stride stS,
-                                                double* U,
-                                                rocblas_int ldu,
-                                                rocblas_stride stU,
-                                                double* V,
-                                                rocblas_int ldv,
-                                                rocblas_stride stV,
-                                                rocblas_int* ifail,
-                                                rocblas_stride stF,
-                                                rocblas_int* info,
-                                                rocblas_int bc)
+inline rocblas_status rocsolver_getri_outofplace(bool STRIDED,
+                                                 rocblas_handle handle,
+                                                 rocblas_int n,
+                                                 double* const A[],
+                                                 rocblas_int lda,
+                                                 rocblas_stride stA,
+                                                 rocblas_int* ipiv,
+                                                 rocblas_stride stP,
+                                                 double* const C[],
+                                                 rocblas_int ldc,
+                                                 rocblas_stride stC,
+                                                 rocblas_int* info,
+                                                 rocblas_int bc)
 {
-    return rocblas_status_not_implemented; // rocsolver_dgesvdx_notransv_batched(handle, leftv, rightv, srange, m, n, A, lda, vl, vu, il, iu,
-        // ns, S, stS, U, ldu, stU, V, ldv, stV, ifail, stF, info, bc);
+    return rocsolver_dgetri_outofplace_batched(handle, n, A, lda, ipiv, stP, C, ldc, info, bc);
 }
 
-inline rocblas_status rocsolver_gesvdx_notransv(bool STRIDED,
-                                                rocblas_handle handle,
-                                                rocblas_svect leftv,
-                                                rocblas_svect rightv,
-                                                rocblas_srange srange,
-                                                rocblas_int m,
-                                                rocblas_int n,
-                                                rocblas_float_complex* const A[],
-                                                rocblas_int lda,
-                                                rocblas_stride stA,
-                                                float vl,
-                                                float vu,
-                                                rocblas_int il,
-                                                rocblas_int iu,
-                                                rocblas_int* ns,
-                                                float* S,
-                                                rocblas_stride stS,
-                                                rocblas_float_complex* U,
-                                                rocblas_int ldu,
-                                                rocblas_stride stU,
-                                                rocblas_float_complex* V,
-                                                rocblas_int ldv,
-                                                rocblas_stride stV,
-                                                rocblas_int* ifail,
-                                                rocblas_stride stF,
-                                                rocblas_int* info,
-                                                rocblas_int bc)
+inline rocblas_status rocsolver_getri_outofplace(bool STRIDED,
+                                                 rocblas_handle handle,
+                                                 rocblas_int n,
+                                                 rocblas_float_complex* const A[],
+                                                 rocblas_int lda,
+                                                 rocblas_stride stA,
+                                                 rocblas_int* ipiv,
+                                                 rocblas_stride stP,
+                                                 rocblas_float_complex* const C[],
+                                                 rocblas_int ldc,
+                                                 rocblas_stride stC,
+                                                 rocblas_int* info,
+                                                 rocblas_int bc)
 {
-    return rocblas_status_not_implemented; // rocsolver_cgesvdx_notransv_batched(handle, leftv, rightv, srange, m, n, A, lda, vl, vu, il, iu,
-        // ns, S, stS, U, ldu, stU, V, ldv, stV, ifail, stF, info, bc);
+    return rocsolver_cgetri_outofplace_batched(handle, n, A, lda, ipiv, stP, C, ldc, info, bc);
 }
 
-inline rocblas_status rocsolver_gesvdx_notransv(bool STRIDED,
-                                                rocblas_handle handle,
-                                                rocblas_svect leftv,
-                                                rocblas_svect rightv,
-                                                rocblas_srange srange,
-                                                rocblas_int m,
-                                                rocblas_int n,
-                                                rocblas_double_complex* const A[],
-                                                rocblas_int lda,
-                                                rocblas_stride stA,
-                                                double vl,
-                                                double vu,
-                                                rocblas_int il,
-                                                rocblas_int iu,
-                                                rocblas_int* ns,
-                                                double* S,
-                                                rocblas_stride stS,
-                                                rocblas_double_complex* U,
-                                                rocblas_int ldu,
-                                                rocblas_stride stU,
-                                                rocblas_double_complex* V,
-                                                rocblas_int ldv,
-                                                rocblas_stride stV,
-                                                rocblas_int* ifail,
-                                                rocblas_stride stF,
-                                                rocblas_int* info,
-                                                rocblas_int bc)
+inline rocblas_status rocsolver_getri_outofplace(bool STRIDED,
+                                                 rocblas_handle handle,
+                                                 rocblas_int n,
+                                                 rocblas_double_complex* const A[],
+                                                 rocblas_int lda,
+                                                 rocblas_stride stA,
+                                                 rocblas_int* ipiv,
+                                                 rocblas_stride stP,
+                                                 rocblas_double_complex* const C[],
+                                                 rocblas_int ldc,
+                                                 rocblas_stride stC,
+                                                 rocblas_int* info,
+                                                 rocblas_int bc)
 {
-    return rocblas_status_not_implemented; // rocsolver_zgesvdx_notransv_batched(handle, leftv, rightv, srange, m, n, A, lda, vl, vu, il, iu,
-        // ns, S, stS, U, ldu, stU, V, ldv, stV, ifail, stF, info, bc);
+    return rocsolver_zgetri_outofplace_batched(handle, n, A, lda, ipiv, stP, C, ldc, info, bc);
 }
 /********************************************************/
 
-/******************** GETRS ********************/
+/******************** GETRI_NPVT_OUTOFPLACE ********************/
 // normal and strided_batched
-inline rocblas_status rocsolver_getrs(bool STRIDED,
-                                      rocblas_handle handle,
-                                      rocblas_operation trans,
-                                      rocblas_int n,
-                                      rocblas_int nrhs,
-                                      float* A,
-                                      rocblas_int lda,
-                                      rocblas_stride stA,
-                                      rocblas_int* ipiv,
-                                      rocblas_stride stP,
-                                      float* B,
-                                      rocblas_int ldb,
-                                      rocblas_stride stB,
-                                      rocblas_int bc)
+inline rocblas_status rocsolver_getri_npvt_outofplace(bool STRIDED,
+                                                      rocblas_handle handle,
+                                                      rocblas_int n,
+                                                      float* A,
+                                                      rocblas_int lda,
+                                                      rocblas_stride stA,
+                                                      float* C,
+                                                      rocblas_int ldc,
+                                                      rocblas_stride stC,
+                                                      rocblas_int* info,
+                                                      rocblas_int bc)
 {
-    return STRIDED ? rocsolver_sgetrs_strided_batched(handle, trans, n, nrhs, A, lda, stA, ipiv,
-                                                      stP, B, ldb, stB, bc)
-                   : rocsolver_sgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb);
+    return STRIDED ? rocsolver_sgetri_npvt_outofplace_strided_batched(handle, n, A, lda, stA, C,
+                                                                      ldc, stC, info, bc)
+                   : rocsolver_sgetri_npvt_outofplace(handle, n, A, lda, C, ldc, info);
 }
 
-inline rocblas_status rocsolver_getrs(bool STRIDED,
-                                      rocblas_handle handle,
-                                      rocblas_operation trans,
-                                      rocblas_int n,
-                                      rocblas_int nrhs,
-                                      double* A,
-                                      rocblas_int lda,
-                                      rocblas_stride stA,
-                                      rocblas_int* ipiv,
-                                      rocblas_stride stP,
-                                      double* B,
-                                      rocblas_int ldb,
-                                      rocblas_stride stB,
-                                      rocblas_int bc)
+inline rocblas_status rocsolver_getri_npvt_outofplace(bool STRIDED,
+                                                      rocblas_handle handle,
+                                                      rocblas_int n,
+                                                      double* A,
+                                                      rocblas_int lda,
+                                                      rocblas_stride stA,
+                                                      double* C,
+                                                      rocblas_int ldc,
+                                                      rocblas_stride stC,
+                                                      rocblas_int* info,
+                                                      rocblas_int bc)
 {
-    return STRIDED ? rocsolver_dgetrs_strided_batched(handle, trans, n, nrhs, A, lda, stA, ipiv,
-                                                      stP, B, ldb, stB, bc)
-                   : rocsolver_dgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb);
+    return STRIDED ? rocsolver_dgetri_npvt_outofplace_strided_batched(handle, n, A, lda, stA, C,
+                                                                      ldc, stC, info, bc)
+                   : rocsolver_dgetri_npvt_outofplace(handle, n, A, lda, C, ldc, info);
 }
 
-inline rocblas_status rocsolver_getrs(bool STRIDED,
-                                      rocblas_handle handle,
-                                      rocblas_operation trans,
-                                      rocblas_int n,
-                                      rocblas_int nrhs,
-                                      rocblas_float_complex* A,
-                                      rocblas_int lda,
-                                      rocblas_stride stA,
-                                      rocblas_int* ipiv,
-                                      rocblas_stride stP,
-                                      rocblas_float_complex* B,
-                                      rocblas_int ldb,
-                                      rocblas_stride stB,
-                                      rocblas_int bc)
+inline rocblas_status rocsolver_getri_npvt_outofplace(bool STRIDED,
+                                                      rocblas_handle handle,
+                                                      rocblas_int n,
+                                                      rocblas_float_complex* A,
+                                                      rocblas_int lda,
+                                                      rocblas_stride stA,
+                                                      rocblas_float_complex* C,
+                                                      rocblas_int ldc,
+                                                      rocblas_stride stC,
+                                                      rocblas_int* info,
+                                                      rocblas_int bc)
 {
-    return STRIDED ? rocsolver_cgetrs_strided_batched(handle, trans, n, nrhs, A, lda, stA, ipiv,
-                                                      stP, B, ldb, stB, bc)
-                   : rocsolver_cgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb);
+    return STRIDED ? rocsolver_cgetri_npvt_outofplace_strided_batched(handle, n, A, lda, stA, C,
+                                                                      ldc, stC, info, bc)
+                   : rocsolver_cgetri_npvt_outofplace(handle, n, A, lda, C, ldc, info);
 }
 
-inline rocblas_status rocsolver_getrs(bool STRIDED,
-                                      rocblas_handle handle,
-                                      rocblas_operation trans,
-                                      rocblas_int n,
-                                      rocblas_int nrhs,
-                                      rocblas_double_complex* A,
-                                      rocblas_int lda,
-                                      rocblas_stride stA,
-                                      rocblas_int* ipiv,
-                                      rocblas_stride stP,
-                                      rocblas_double_complex* B,
-                                      rocblas_int ldb,
-                                      rocblas_stride stB,
-                                      rocblas_int bc)
+inline rocblas_status rocsolver_getri_npvt_outofplace(bool STRIDED,
+                                                      rocblas_handle handle,
+                                                      rocblas_int n,
+                                                      rocblas_double_complex* A,
+                                                      rocblas_int lda,
+                                                      rocblas_stride stA,
+                                                      rocblas_double_complex* C,
+                                                      rocblas_int ldc,
+                                                      rocblas_stride stC,
+                                                      rocblas_int* info,
+                                                      rocblas_int bc)
 {
-    return STRIDED ? rocsolver_zgetrs_strided_batched(handle, trans, n, nrhs, A, lda, stA, ipiv,
-                                                      stP, B, ldb, stB, bc)
-                   : rocsolver_zgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb);
+    return STRIDED ? rocsolver_zgetri_npvt_outofplace_strided_batched(handle, n, A, lda, stA, C,
+                                                                      ldc, stC, info, bc)
+                   : rocsolver_zgetri_npvt_outofplace(handle, n, A, lda, C, ldc, info);
 }
 
-inline rocblas_status rocsolver_getrs(bool STRIDED,
-                                      rocblas_handle handle,
-                                      rocblas_operation trans,
-                                      int64_t n,
-                                      int64_t nrhs,
-                                      float* A,
-                                      int64_t lda,
-                                      rocblas_stride stA,
-                                      int64_t* ipiv,
-                                      rocblas_stride stP,
-                                      float* B,
-                                      int64_t ldb,
-                                      rocblas_stride stB,
-                                      int64_t bc)
+// batched
+inline rocblas_status rocsolver_getri_npvt_outofplace(bool STRIDED,
+                                                      rocblas_handle handle,
+                                                      rocblas_int n,
+                                                      float* const A[],
+                                                      rocblas_int lda,
+                                                      rocblas_stride stA,
+                                                      float* const C[],
+                                                      rocblas_int ldc,
+                                                      rocblas_stride stC,
+                                                      rocblas_int* info,
+                                                      rocblas_int bc)
 {
-    return STRIDED ? rocsolver_sgetrs_strided_batched_64(handle, trans, n, nrhs, A, lda, stA, ipiv,
-                                                         stP, B, ldb, stB, bc)
-                   : rocsolver_sgetrs_64(handle, trans, n, nrhs, A, lda, ipiv, B, ldb);
+    return rocsolver_sgetri_npvt_outofplace_batched(handle, n, A, lda, C, ldc, info, bc);
 }
 
-inline rocblas_status rocsolver_getrs(bool STRIDED,
-                                      rocblas_handle handle,
-                                      rocblas_operation trans,
-                                      int64_t n,
-                                      int64_t nrhs,
-                                      double* A,
-                                      int64_t lda,
-                                      rocblas_stride stA,
-                                      int64_t* ipiv,
-                                      rocblas_stride stP,
-                                      double* B,
-                                      int64_t ldb,
-                                      rocblas_stride stB,
-                                      int64_t bc)
+inline rocblas_status rocsolver_getri_npvt_outofplace(bool STRIDED,
+                                                      rocblas_handle handle,
+                                                      rocblas_int n,
+                                                      double* const A[],
+                                                      rocblas_int lda,
+                                                      rocblas_stride stA,
+                                                      double* const C[],
+                                                      rocblas_int ldc,
+                                                      rocblas_stride stC,
+                                                      rocblas_int* info,
+                                                      rocblas_int bc)
 {
-    return STRIDED ? rocsolver_dgetrs_strided_batched_64(handle, trans, n, nrhs, A, lda, stA, ipiv,
-                                                         stP, B, ldb, stB, bc)
-                   : rocsolver_dgetrs_64(handle, trans, n, nrhs, A, lda, ipiv, B, ldb);
+    return rocsolver_dgetri_npvt_outofplace_batched(handle, n, A, lda, C, ldc, info, bc);
 }
 
-inline rocblas_status rocsolver_getrs(bool STRIDED,
-                                      rocblas_handle handle,
-                                      rocblas_operation trans,
-                                      int64_t n,
-                                      int64_t nrhs,
-                                      rocblas_float_complex* A,
-                                      int64_t lda,
-                                      rocblas_stride stA,
-                                      int64_t* ipiv,
-                                      rocblas_stride stP,
-                                      rocblas_float_complex* B,
-                                      int64_t ldb,
-                                      rocblas_stride stB,
-                                      int64_t bc)
+inline rocblas_status rocsolver_getri_npvt_outofplace(bool STRIDED,
+                                                      rocblas_handle handle,
+                                                      rocblas_int n,
+                                                      rocblas_float_complex* const A[],
+                                                      rocblas_int lda,
+                                                      rocblas_stride stA,
+                                                      rocblas_float_complex* const C[],
+                                                      rocblas_int ldc,
+                                                      rocblas_stride stC,
+                                                      rocblas_int* info,
+                                                      rocblas_int bc)
 {
-    return STRIDED ? rocsolver_cgetrs_strided_batched_64(handle, trans, n, nrhs, A, lda, stA, ipiv,
-                                                         stP, B, ldb, stB, bc)
-                   : rocsolver_cgetrs_64(handle, trans, n, nrhs, A, lda, ipiv, B, ldb);
+    return rocsolver_cgetri_npvt_outofplace_batched(handle, n, A, lda, C, ldc, info, bc);
 }
 
-inline rocblas_status rocsolver_getrs(bool STRIDED,
-                                      rocblas_handle handle,
-                                      rocblas_operation trans,
-                                      int64_t n,
-                                      int64_t nrhs,
-                                      rocblas_double_complex* A,
-                                      int64_t lda,
-                                      rocblas_stride stA,
-                                      int64_t* ipiv,
-                                      rocblas_stride stP,
-                                      rocblas_double_complex* B,
-                                      int64_t ldb,
-                                      rocblas_stride stB,
-                                      int64_t bc)
+inline rocblas_status rocsolver_getri_npvt_outofplace(bool STRIDED,
+                                                      rocblas_handle handle,
+                                                      rocblas_int n,
+                                                      rocblas_double_complex* const A[],
+                                                      rocblas_int lda,
+                                                      rocblas_stride stA,
+                                                      rocblas_double_complex* const C[],
+                                                      rocblas_int ldc,
+                                                      rocblas_stride stC,
+                                                      rocblas_int* info,
+                                                      rocblas_int bc)
 {
-    return STRIDED ? rocsolver_zgetrs_strided_batched_64(handle, trans, n, nrhs, A, lda, stA, ipiv,
-                                                         stP, B, ldb, stB, bc)
-                   : rocsolver_zgetrs_64(handle, trans, n, nrhs, A, lda, ipiv, B, ldb);
+    return rocsolver_zgetri_npvt_outofplace_batched(handle, n, A, lda, C, ldc, info, bc);
 }
+/********************************************************/
 
-// batched
-inline rocblas_status rocsolver_getrs(bool STRIDED,
+/******************** GETRI ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_getri(bool STRIDED,
                                       rocblas_handle handle,
-                                      rocblas_operation trans,
                                       rocblas_int n,
-                                      rocblas_int nrhs,
-                                      float* const A[],
+                                      float* A,
                                       rocblas_int lda,
                                       rocblas_stride stA,
                                       rocblas_int* ipiv,
                                       rocblas_stride stP,
-                                      float* const B[],
-                                      rocblas_int ldb,
-                                      rocblas_stride stB,
+                                      rocblas_int* info,
                                       rocblas_int bc)
 {
-    return rocsolver_sgetrs_batched(handle, trans, n, nrhs, A, lda, ipiv, stP, B, ldb, bc);
+    return STRIDED ? rocsolver_sgetri_strided_batched(handle, n, A, lda, stA, ipiv, stP, info, bc)
+                   : rocsolver_sgetri(handle, n, A, lda, ipiv, info);
 }
 
-inline rocblas_status rocsolver_getrs(bool STRIDED,
+inline rocblas_status rocsolver_getri(bool STRIDED,
                                       rocblas_handle handle,
-                                      rocblas_operation trans,
                                       rocblas_int n,
-                                      rocblas_int nrhs,
-                                      double* const A[],
+                                      double* A,
                                       rocblas_int lda,
                                       rocblas_stride stA,
                                       rocblas_int* ipiv,
                                       rocblas_stride stP,
-                                      double* const B[],
-                                      rocblas_int ldb,
-                                      rocblas_stride stB,
+                                      rocblas_int* info,
                                       rocblas_int bc)
 {
-    return rocsolver_dgetrs_batched(handle, trans, n, nrhs, A, lda, ipiv, stP, B, ldb, bc);
+    return STRIDED ? rocsolver_dgetri_strided_batched(handle, n, A, lda, stA, ipiv, stP, info, bc)
+                   : rocsolver_dgetri(handle, n, A, lda, ipiv, info);
 }
 
-inline rocblas_status rocsolver_getrs(bool STRIDED,
+inline rocblas_status rocsolver_getri(bool STRIDED,
                                       rocblas_handle handle,
-                                      rocblas_operation trans,
                                       rocblas_int n,
-                                      rocblas_int nrhs,
-                                      rocblas_float_complex* const A[],
+                                      rocblas_float_complex* A,
                                       rocblas_int lda,
                                       rocblas_stride stA,
                                       rocblas_int* ipiv,
                                       rocblas_stride stP,
-                                      rocblas_float_complex* const B[],
-                                      rocblas_int ldb,
-                                      rocblas_stride stB,
+                                      rocblas_int* info,
                                       rocblas_int bc)
 {
-    return rocsolver_cgetrs_batched(handle, trans, n, nrhs, A, lda, ipiv, stP, B, ldb, bc);
+    return STRIDED ? rocsolver_cgetri_strided_batched(handle, n, A, lda, stA, ipiv, stP, info, bc)
+                   : rocsolver_cgetri(handle, n, A, lda, ipiv, info);
 }
 
-inline rocblas_status rocsolver_getrs(bool STRIDED,
+inline rocblas_status rocsolver_getri(bool STRIDED,
                                       rocblas_handle handle,
-                                      rocblas_operation trans,
                                       rocblas_int n,
-                                      rocblas_int nrhs,
-                                      rocblas_double_complex* const A[],
+                                      rocblas_double_complex* A,
                                       rocblas_int lda,
                                       rocblas_stride stA,
                                       rocblas_int* ipiv,
                                       rocblas_stride stP,
-                                      rocblas_double_complex* const B[],
-                                      rocblas_int ldb,
-                                      rocblas_stride stB,
+                                      rocblas_int* info,
                                       rocblas_int bc)
 {
-    return rocsolver_zgetrs_batched(handle, trans, n, nrhs, A, lda, ipiv, stP, B, ldb, bc);
+    return STRIDED ? rocsolver_zgetri_strided_batched(handle, n, A, lda, stA, ipiv, stP, info, bc)
+                   : rocsolver_zgetri(handle, n, A, lda, ipiv, info);
 }
 
-inline rocblas_status rocsolver_getrs(bool STRIDED,
+// batched
+inline rocblas_status rocsolver_getri(bool STRIDED,
                                       rocblas_handle handle,
-                                      rocblas_operation trans,
-                                      int64_t n,
-                                      int64_t nrhs,
+                                      rocblas_int n,
                                       float* const A[],
-                                      int64_t lda,
+                                      rocblas_int lda,
                                       rocblas_stride stA,
-                                      int64_t* ipiv,
+                                      rocblas_int* ipiv,
                                       rocblas_stride stP,
-                                      float* const B[],
-                                      int64_t ldb,
-                                      rocblas_stride stB,
-                                      int64_t bc)
+                                      rocblas_int* info,
+                                      rocblas_int bc)
 {
-    return rocsolver_sgetrs_batched_64(handle, trans, n, nrhs, A, lda, ipiv, stP, B, ldb, bc);
+    return rocsolver_sgetri_batched(handle, n, A, lda, ipiv, stP, info, bc);
 }
 
-inline rocblas_status rocsolver_getrs(bool STRIDED,
+inline rocblas_status rocsolver_getri(bool STRIDED,
                                       rocblas_handle handle,
-                                      rocblas_operation trans,
-                                      int64_t n,
-                                      int64_t nrhs,
+                                      rocblas_int n,
                                       double* const A[],
-                                      int64_t lda,
+                                      rocblas_int lda,
                                       rocblas_stride stA,
-                                      int64_t* ipiv,
+                                      rocblas_int* ipiv,
                                       rocblas_stride stP,
-                                      double* const B[],
-                                      int64_t ldb,
-                                      rocblas_stride stB,
-                                      int64_t bc)
+                                      rocblas_int* info,
+                                      rocblas_int bc)
 {
-    return rocsolver_dgetrs_batched_64(handle, trans, n, nrhs, A, lda, ipiv, stP, B, ldb, bc);
+    return rocsolver_dgetri_batched(handle, n, A, lda, ipiv, stP, info, bc);
 }
 
-inline rocblas_status rocsolver_getrs(bool STRIDED,
+inline rocblas_status rocsolver_getri(bool STRIDED,
                                       rocblas_handle handle,
-                                      rocblas_operation trans,
-                                      int64_t n,
-                                      int64_t nrhs,
+                                      rocblas_int n,
                                       rocblas_float_complex* const A[],
-                                      int64_t lda,
+                                      rocblas_int lda,
                                       rocblas_stride stA,
-                                      int64_t* ipiv,
+                                      rocblas_int* ipiv,
                                       rocblas_stride stP,
-                                      rocblas_float_complex* const B[],
-                                      int64_t ldb,
-                                      rocblas_stride stB,
-                                      int64_t bc)
+                                      rocblas_int* info,
+                                      rocblas_int bc)
 {
-    return rocsolver_cgetrs_batched_64(handle, trans, n, nrhs, A, lda, ipiv, stP, B, ldb, bc);
+    return rocsolver_cgetri_batched(handle, n, A, lda, ipiv, stP, info, bc);
 }
 
-inline rocblas_status rocsolver_getrs(bool STRIDED,
+inline rocblas_status rocsolver_getri(bool STRIDED,
                                       rocblas_handle handle,
-                                      rocblas_operation trans,
-                                      int64_t n,
-                                      int64_t nrhs,
+                                      rocblas_int n,
                                       rocblas_double_complex* const A[],
-                                      int64_t lda,
+                                      rocblas_int lda,
                                       rocblas_stride stA,
-                                      int64_t* ipiv,
+                                      rocblas_int* ipiv,
                                       rocblas_stride stP,
-                                      rocblas_double_complex* const B[],
-                                      int64_t ldb,
-                                      rocblas_stride stB,
-                                      int64_t bc)
+                                      rocblas_int* info,
+                                      rocblas_int bc)
 {
-    return rocsolver_zgetrs_batched_64(handle, trans, n, nrhs, A, lda, ipiv, stP, B, ldb, bc);
+    return rocsolver_zgetri_batched(handle, n, A, lda, ipiv, stP, info, bc);
 }
 /********************************************************/
 
-/******************** GESV ********************/
+/******************** GETRI_NPVT ********************/
 // normal and strided_batched
-inline rocblas_status rocsolver_gesv(bool STRIDED,
-                                     rocblas_handle handle,
-                                     rocblas_int n,
-                                     rocblas_int nrhs,
-                                     float* A,
-                                     rocblas_int lda,
-                                     rocblas_stride stA,
-                                     rocblas_int* ipiv,
-                                     rocblas_stride stP,
-                                     float* B,
-                                     rocblas_int ldb,
-                                     rocblas_stride stB,
-                                     rocblas_int* info,
-                                     rocblas_int bc)
+inline rocblas_status rocsolver_getri_npvt(bool STRIDED,
+                                           rocblas_handle handle,
+                                           rocblas_int n,
+                                           float* A,
+                                           rocblas_int lda,
+                                           rocblas_stride stA,
+                                           rocblas_int* info,
+                                           rocblas_int bc)
 {
-    return STRIDED ? rocsolver_sgesv_strided_batched(handle, n, nrhs, A, lda, stA, ipiv, stP, B,
-                                                     ldb, stB, info, bc)
-                   : rocsolver_sgesv(handle, n, nrhs, A, lda, ipiv, B, ldb, info);
+    return STRIDED ? rocsolver_sgetri_npvt_strided_batched(handle, n, A, lda, stA, info, bc)
+                   : rocsolver_sgetri_npvt(handle, n, A, lda, info);
 }
 
-inline rocblas_status rocsolver_gesv(bool STRIDED,
-                                     rocblas_handle handle,
-                                     rocblas_int n,
-                                     rocblas_int nrhs,
-                                     double* A,
-                                     rocblas_int lda,
-                                     rocblas_stride stA,
-                                     rocblas_int* ipiv,
-                                     rocblas_stride stP,
-                                     double* B,
-                                     rocblas_int ldb,
-                                     rocblas_stride stB,
-                                     rocblas_int* info,
-                                     rocblas_int bc)
+inline rocblas_status rocsolver_getri_npvt(bool STRIDED,
+                                           rocblas_handle handle,
+                                           rocblas_int n,
+                                           double* A,
+                                           rocblas_int lda,
+                                           rocblas_stride stA,
+                                           rocblas_int* info,
+                                           rocblas_int bc)
 {
-    return STRIDED ? rocsolver_dgesv_strided_batched(handle, n, nrhs, A, lda, stA, ipiv, stP, B,
-                                                     ldb, stB, info, bc)
-                   : rocsolver_dgesv(handle, n, nrhs, A, lda, ipiv, B, ldb, info);
+    return STRIDED ? rocsolver_dgetri_npvt_strided_batched(handle, n, A, lda, stA, info, bc)
+                   : rocsolver_dgetri_npvt(handle, n, A, lda, info);
 }
 
-inline rocblas_status rocsolver_gesv(bool STRIDED,
-                                     rocblas_handle handle,
-                                     rocblas_int n,
-                                     rocblas_int nrhs,
-                                     rocblas_float_complex* A,
-                                     rocblas_int lda,
-                                     rocblas_stride stA,
-                                     rocblas_int* ipiv,
-                                     rocblas_stride stP,
-                                     rocblas_float_complex* B,
-                                     rocblas_int ldb,
-                                     rocblas_stride stB,
-                                     rocblas_int* info,
-                                     rocblas_int bc)
+inline rocblas_status rocsolver_getri_npvt(bool STRIDED,
+                                           rocblas_handle handle,
+                                           rocblas_int n,
+                                           rocblas_float_complex* A,
+                                           rocblas_int lda,
+                                           rocblas_stride stA,
+                                           rocblas_int* info,
+                                           rocblas_int bc)
 {
-    return STRIDED ? rocsolver_cgesv_strided_batched(handle, n, nrhs, A, lda, stA, ipiv, stP, B,
-                                                     ldb, stB, info, bc)
-                   : rocsolver_cgesv(handle, n, nrhs, A, lda, ipiv, B, ldb, info);
+    return STRIDED ? rocsolver_cgetri_npvt_strided_batched(handle, n, A, lda, stA, info, bc)
+                   : rocsolver_cgetri_npvt(handle, n, A, lda, info);
 }
 
-inline rocblas_status rocsolver_gesv(bool STRIDED,
-                                     rocblas_handle handle,
-                                     rocblas_int n,
-                                     rocblas_int nrhs,
-                                     rocblas_double_complex* A,
-                                     rocblas_int lda,
-                                     rocblas_stride stA,
-                                     rocblas_int* ipiv,
-                                     rocblas_stride stP,
-                                     rocblas_double_complex* B,
-                                     rocblas_int ldb,
-                                     rocblas_stride stB,
-                                     rocblas_int* info,
-                                     rocblas_int bc)
+inline rocblas_status rocsolver_getri_npvt(bool STRIDED,
+                                           rocblas_handle handle,
+                                           rocblas_int n,
+                                           rocblas_double_complex* A,
+                                           rocblas_int lda,
+                                           rocblas_stride stA,
+                                           rocblas_int* info,
+                                           rocblas_int bc)
 {
-    return STRIDED ? rocsolver_zgesv_strided_batched(handle, n, nrhs, A, lda, stA, ipiv, stP, B,
-                                                     ldb, stB, info, bc)
-                   : rocsolver_zgesv(handle, n, nrhs, A, lda, ipiv, B, ldb, info);
+    return STRIDED ? rocsolver_zgetri_npvt_strided_batched(handle, n, A, lda, stA, info, bc)
+                   : rocsolver_zgetri_npvt(handle, n, A, lda, info);
 }
 
 // batched
-inline rocblas_status rocsolver_gesv(bool STRIDED,
-                                     rocblas_handle handle,
-                                     rocblas_int n,
-                                     rocblas_int nrhs,
-                                     float* const A[],
-                                     rocblas_int lda,
-                                     rocblas_stride stA,
-                                     rocblas_int* ipiv,
-                                     rocblas_stride stP,
-                                     float* const B[],
-                                     rocblas_int ldb,
-                                     rocblas_stride stB,
-                                     rocblas_int* info,
-                                     rocblas_int bc)
+inline rocblas_status rocsolver_getri_npvt(bool STRIDED,
+                                           rocblas_handle handle,
+                                           rocblas_int n,
+                                           float* const A[],
+                                           rocblas_int lda,
+                                           rocblas_stride stA,
+                                           rocblas_int* info,
+                                           rocblas_int bc)
 {
-    return rocsolver_sgesv_batched(handle, n, nrhs, A, lda, ipiv, stP, B, ldb, info, bc);
+    return rocsolver_sgetri_npvt_batched(handle, n, A, lda, info, bc);
 }
 
-inline rocblas_status rocsolver_gesv(bool STRIDED,
-                                     rocblas_handle handle,
-                                     rocblas_int n,
-                                     rocblas_int nrhs,
-                                     double* const A[],
-                                     rocblas_int lda,
-                                     rocblas_stride stA,
-                                     rocblas_int* ipiv,
-                                     rocblas_stride stP,
-                                     double* const B[],
-                                     rocblas_int ldb,
-                                     rocblas_stride stB,
-                                     rocblas_int* info,
-                                     rocblas_int bc)
+inline rocblas_status rocsolver_getri_npvt(bool STRIDED,
+                                           rocblas_handle handle,
+                                           rocblas_int n,
+                                           double* const A[],
+                                           rocblas_int lda,
+                                           rocblas_stride stA,
+                                           rocblas_int* info,
+                                           rocblas_int bc)
+{
+    return rocsolver_dgetri_npvt_batched(handle, n, A, lda, info, bc);
+}
+
+inline rocblas_status rocsolver_getri_npvt(bool STRIDED,
+                                           rocblas_handle handle,
+                                           rocblas_int n,
+                                           rocblas_float_complex* const A[],
+                                           rocblas_int lda,
+                                           rocblas_stride stA,
+                                           rocblas_int* info,
+                                           rocblas_int bc)
+{
+    return rocsolver_cgetri_npvt_batched(handle, n, A, lda, info, bc);
+}
+
+inline rocblas_status rocsolver_getri_npvt(bool STRIDED,
+                                           rocblas_handle handle,
+                                           rocblas_int n,
+                                           rocblas_double_complex* const A[],
+                                           rocblas_int lda,
+                                           rocblas_stride stA,
+                                           rocblas_int* info,
+                                           rocblas_int bc)
+{
+    return rocsolver_zgetri_npvt_batched(handle, n, A, lda, info, bc);
+}
+/********************************************************/
+
+/******************** TRTRI ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_trtri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_diagonal diag,
+                                      rocblas_int n,
+                                      float* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return STRIDED ? rocsolver_strtri_strided_batched(handle, uplo, diag, n, A, lda, stA, info, bc)
+                   : rocsolver_strtri(handle, uplo, diag, n, A, lda, info);
+}
+
+inline rocblas_status rocsolver_trtri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_diagonal diag,
+                                      rocblas_int n,
+                                      double* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return STRIDED ? rocsolver_dtrtri_strided_batched(handle, uplo, diag, n, A, lda, stA, info, bc)
+                   : rocsolver_dtrtri(handle, uplo, diag, n, A, lda, info);
+}
+
+inline rocblas_status rocsolver_trtri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_diagonal diag,
+                                      rocblas_int n,
+                                      rocblas_float_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
 {
-    return rocsolver_dgesv_batched(handle, n, nrhs, A, lda, ipiv, stP, B, ldb, info, bc);
+    return STRIDED ? rocsolver_ctrtri_strided_batched(handle, uplo, diag, n, A, lda, stA, info, bc)
+                   : rocsolver_ctrtri(handle, uplo, diag, n, A, lda, info);
 }
 
-inline rocblas_status rocsolver_gesv(bool STRIDED,
-                                     rocblas_handle handle,
-                                     rocblas_int n,
-                                     rocblas_int nrhs,
-                                     rocblas_float_complex* const A[],
-                                     rocblas_int lda,
-                                     rocblas_stride stA,
-                                     rocblas_int* ipiv,
-                                     rocblas_stride stP,
-                                     rocblas_float_complex* const B[],
-                                     rocblas_int ldb,
-                                     rocblas_stride stB,
-                                     rocblas_int* info,
-                                     rocblas_int bc)
+inline rocblas_status rocsolver_trtri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_diagonal diag,
+                                      rocblas_int n,
+                                      rocblas_double_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
 {
-    return rocsolver_cgesv_batched(handle, n, nrhs, A, lda, ipiv, stP, B, ldb, info, bc);
+    return STRIDED ? rocsolver_ztrtri_strided_batched(handle, uplo, diag, n, A, lda, stA, info, bc)
+                   : rocsolver_ztrtri(handle, uplo, diag, n, A, lda, info);
 }
 
-inline rocblas_status rocsolver_gesv(bool STRIDED,
-                                     rocblas_handle handle,
-                                     rocblas_int n,
-                                     rocblas_int nrhs,
-                                     rocblas_double_complex* const A[],
-                                     rocblas_int lda,
-                                     rocblas_stride stA,
-                                     rocblas_int* ipiv,
-                                     rocblas_stride stP,
-                                     rocblas_double_complex* const B[],
-                                     rocblas_int ldb,
-                                     rocblas_stride stB,
-                                     rocblas_int* info,
-                                     rocblas_int bc)
+// batched
+inline rocblas_status rocsolver_trtri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_diagonal diag,
+                                      rocblas_int n,
+                                      float* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
 {
-    return rocsolver_zgesv_batched(handle, n, nrhs, A, lda, ipiv, stP, B, ldb, info, bc);
+    return rocsolver_strtri_batched(handle, uplo, diag, n, A, lda, info, bc);
 }
-/********************************************************/
 
-/******************** GESV_OUTOFPLACE ********************/
-// normal and strided_batched
-inline rocblas_status rocsolver_gesv_outofplace(bool STRIDED,
-                                                rocblas_handle handle,
-                                                rocblas_int n,
-                                                rocblas_int nrhs,
-                                                float* A,
-                                                rocblas_int lda,
-                                                rocblas_stride stA,
-                                                rocblas_int* ipiv,
-                                                rocblas_stride stP,
-                                                float* B,
-                                                rocblas_int ldb,
-                                                rocblas_stride stB,
-                                                float* X,
-                                                rocblas_int ldx,
-                                                rocblas_stride stX,
-                                                rocblas_int* info,
-                                                rocblas_int bc)
+inline rocblas_status rocsolver_trtri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_diagonal diag,
+                                      rocblas_int n,
+                                      double* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
 {
-    return STRIDED
-        ? rocblas_status_not_implemented // rocsolver_sgesv_outofplace_strided_batched(handle, n, nrhs, A, lda, stA, ipiv, stP, B, ldb, stB, X, ldx, stX, info, bc)
-        : rocsolver_sgesv_outofplace(handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, info);
+    return rocsolver_dtrtri_batched(handle, uplo, diag, n, A, lda, info, bc);
 }
 
-inline rocblas_status rocsolver_gesv_outofplace(bool STRIDED,
-                                                rocblas_handle handle,
-                                                rocblas_int n,
-                                                rocblas_int nrhs,
-                                                double* A,
-                                                rocblas_int lda,
-                                                rocblas_stride stA,
-                                                rocblas_int* ipiv,
-                                                rocblas_stride stP,
-                                                double* B,
-                                                rocblas_int ldb,
-                                                rocblas_stride stB,
-                                                double* X,
-                                                rocblas_int ldx,
-                                                rocblas_stride stX,
-                                                rocblas_int* info,
-                                                rocblas_int bc)
+inline rocblas_status rocsolver_trtri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_diagonal diag,
+                                      rocblas_int n,
+                                      rocblas_float_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
 {
-    return STRIDED
-        ? rocblas_status_not_implemented // rocsolver_dgesv_outofplace_strided_batched(handle, n, nrhs, A, lda, stA, ipiv, stP, B, ldb, stB, X, ldx, stX, info, bc)
-        : rocsolver_dgesv_outofplace(handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, info);
+    return rocsolver_ctrtri_batched(handle, uplo, diag, n, A, lda, info, bc);
 }
 
-inline rocblas_status rocsolver_gesv_outofplace(bool STRIDED,
-                                                rocblas_handle handle,
-                                                rocblas_int n,
-                                                rocblas_int nrhs,
-                                                rocblas_float_complex* A,
-                                                rocblas_int lda,
-                                                rocblas_stride stA,
-                                                rocblas_int* ipiv,
-                                                rocblas_stride stP,
-                                                rocblas_float_complex* B,
-                                                rocblas_int ldb,
-                                                rocblas_stride stB,
-                                                rocblas_float_complex* X,
-                                                rocblas_int ldx,
-                                                rocblas_stride stX,
-                                                rocblas_int* info,
-                                                rocblas_int bc)
+inline rocblas_status rocsolver_trtri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_diagonal diag,
+                                      rocblas_int n,
+                                      rocblas_double_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
 {
-    return STRIDED
-        ? rocblas_status_not_implemented // rocsolver_cgesv_outofplace_strided_batched(handle, n, nrhs, A, lda, stA, ipiv, stP, B, ldb, stB, X, ldx, stX, info, bc)
-        : rocsolver_cgesv_outofplace(handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, info);
+    return rocsolver_ztrtri_batched(handle, uplo, diag, n, A, lda, info, bc);
 }
+/********************************************************/
 
-inline rocblas_status rocsolver_gesv_outofplace(bool STRIDED,
-                                                rocblas_handle handle,
-                                                rocblas_int n,
-                                                rocblas_int nrhs,
-                                                rocblas_double_complex* A,
-                                                rocblas_int lda,
-                                                rocblas_stride stA,
-                                                rocblas_int* ipiv,
-                                                rocblas_stride stP,
-                                                rocblas_double_complex* B,
-                                                rocblas_int ldb,
-                                                rocblas_stride stB,
-                                                rocblas_double_complex* X,
-                                                rocblas_int ldx,
-                                                rocblas_stride stX,
-                                                rocblas_int* info,
-                                                rocblas_int bc)
+/******************** GECON ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_gecon(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int n,
+                                      float* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* anorm,
+                                      float* rcond,
+                                      rocblas_int bc)
 {
-    return STRIDED
-        ? rocblas_status_not_implemented // rocsolver_zgesv_outofplace_strided_batched(handle, n, nrhs, A, lda, stA, ipiv, stP, B, ldb, stB, X, ldx, stX, info, bc)
-        : rocsolver_zgesv_outofplace(handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, info);
+    return STRIDED ? rocsolver_sgecon_strided_batched(handle, n, A, lda, stA, anorm, rcond, bc)
+                   : rocsolver_sgecon(handle, n, A, lda, anorm, rcond);
 }
 
-// batched
-inline rocblas_status rocsolver_gesv_outofplace(bool STRIDED,
-                                                rocblas_handle handle,
-                                                rocblas_int n,
-                                                rocblas_int nrhs,
-                                                float* const A[],
-                                                rocblas_int lda,
-                                                rocblas_stride stA,
-                                                rocblas_int* ipiv,
-                                                rocblas_stride stP,
-                                                float* const B[],
-                                                rocblas_int ldb,
-                                                rocblas_stride stB,
-                                                float* const X[],
-                                                rocblas_int ldx,
-                                                rocblas_stride stX,
-                                                rocblas_int* info,
-                                                rocblas_int bc)
+inline rocblas_status rocsolver_gecon(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int n,
+                                      double* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* anorm,
+                                      double* rcond,
+                                      rocblas_int bc)
 {
-    return rocblas_status_not_implemented; // rocsolver_sgesv_outofplace_batched(handle, n, nrhs, A, lda, ipiv, stP, B, ldb, info, bc);
+    return STRIDED ? rocsolver_dgecon_strided_batched(handle, n, A, lda, stA, anorm, rcond, bc)
+                   : rocsolver_dgecon(handle, n, A, lda, anorm, rcond);
 }
 
-inline rocblas_status rocsolver_gesv_outofplace(bool STRIDED,
-                                                rocblas_handle handle,
-                                                rocblas_int n,
-                                                rocblas_int nrhs,
-                                                double* const A[],
-                                                rocblas_int lda,
-                                                rocblas_stride stA,
-                                                rocblas_int* ipiv,
-                                                rocblas_stride stP,
-                                                double* const B[],
-                                                rocblas_int ldb,
-                                                rocblas_stride stB,
-                                                double* const X[],
-                                                rocblas_int ldx,
-                                                rocblas_stride stX,
-                                                rocblas_int* info,
-                                                rocblas_int bc)
+inline rocblas_status rocsolver_gecon(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int n,
+                                      rocblas_float_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* anorm,
+                                      float* rcond,
+                                      rocblas_int bc)
 {
-    return rocblas_status_not_implemented; // rocsolver_dgesv_outofplace_batched(handle, n, nrhs, A, lda, ipiv, stP, B, ldb, info, bc);
+    return STRIDED ? rocsolver_cgecon_strided_batched(handle, n, A, lda, stA, anorm, rcond, bc)
+                   : rocsolver_cgecon(handle, n, A, lda, anorm, rcond);
 }
 
-inline rocblas_status rocsolver_gesv_outofplace(bool STRIDED,
-                                                rocblas_handle handle,
-                                                rocblas_int n,
-                                                rocblas_int nrhs,
-                                                rocblas_float_complex* const A[],
-                                                rocblas_int lda,
-                                                rocblas_stride stA,
-                                                rocblas_int* ipiv,
-                                                rocblas_stride stP,
-                                                rocblas_float_complex* const B[],
-                                                rocblas_int ldb,
-                                                rocblas_stride stB,
-                                                rocblas_float_complex* const X[],
-                                                rocblas_int ldx,
-                                                rocblas_stride stX,
-                                                rocblas_int* info,
-                                                rocblas_int bc)
+inline rocblas_status rocsolver_gecon(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int n,
+                                      rocblas_double_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* anorm,
+                                      double* rcond,
+                                      rocblas_int bc)
 {
-    return rocblas_status_not_implemented; // rocsolver_cgesv_outofplace_batched(handle, n, nrhs, A, lda, ipiv, stP, B, ldb, info, bc);
+    return STRIDED ? rocsolver_zgecon_strided_batched(handle, n, A, lda, stA, anorm, rcond, bc)
+                   : rocsolver_zgecon(handle, n, A, lda, anorm, rcond);
 }
 
-inline rocblas_status rocsolver_gesv_outofplace(bool STRIDED,
-                                                rocblas_handle handle,
-                                                rocblas_int n,
-                                                rocblas_int nrhs,
-                                                rocblas_double_complex* const A[],
-                                                rocblas_int lda,
-                                                rocblas_stride stA,
-                                                rocblas_int* ipiv,
-                                                rocblas_stride stP,
-                                                rocblas_double_complex* const B[],
-                                                rocblas_int ldb,
-                                                rocblas_stride stB,
-                                                rocblas_double_complex* const X[],
-                                                rocblas_int ldx,
-                                                rocblas_stride stX,
-                                                rocblas_int* info,
-                                                rocblas_int bc)
+// batched
+inline rocblas_status rocsolver_gecon(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int n,
+                                      float* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* anorm,
+                                      float* rcond,
+                                      rocblas_int bc)
 {
-    return rocblas_status_not_implemented; // rocsolver_zgesv_outofplace_batched(handle, n, nrhs, A, lda, ipiv, stP, B, ldb, info, bc);
+    return rocsolver_sgecon_batched(handle, n, A, lda, anorm, rcond, bc);
 }
-/********************************************************/
 
-/******************** GETRI_OUTOFPLACE ********************/
-// normal and strided_batched
-inline rocblas_status rocsolver_getri_outofplace(bool STRIDED,
-                                                 rocblas_handle handle,
-                                                 rocblas_int n,
-                                                 float* A,
-                                                 rocblas_int lda,
-                                                 rocblas_stride stA,
-                                                 rocblas_int* ipiv,
-                                                 rocblas_stride stP,
-                                                 float* C,
-                                                 rocblas_int ldc,
-                                                 rocblas_stride stC,
-                                                 rocblas_int* info,
-                                                 rocblas_int bc)
+inline rocblas_status rocsolver_gecon(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int n,
+                                      double* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* anorm,
+                                      double* rcond,
+                                      rocblas_int bc)
 {
-    return STRIDED ? rocsolver_sgetri_outofplace_strided_batched(handle, n, A, lda, stA, ipiv, stP,
-                                                                 C, ldc, stC, info, bc)
-                   : rocsolver_sgetri_outofplace(handle, n, A, lda, ipiv, C, ldc, info);
+    return rocsolver_dgecon_batched(handle, n, A, lda, anorm, rcond, bc);
 }
 
-inline rocblas_status rocsolver_getri_outofplace(bool STRIDED,
-                                                 rocblas_handle handle,
-                                                 rocblas_int n,
-                                                 double* A,
-                                                 rocblas_int lda,
-                                                 rocblas_stride stA,
-                                                 rocblas_int* ipiv,
-                                                 rocblas_stride stP,
-                                                 double* C,
-                                                 rocblas_int ldc,
-                                                 rocblas_stride stC,
-                                                 rocblas_int* info,
-                                                 rocblas_int bc)
+inline rocblas_status rocsolver_gecon(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int n,
+                                      rocblas_float_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* anorm,
+                                      float* rcond,
+                                      rocblas_int bc)
 {
-    return STRIDED ? rocsolver_dgetri_outofplace_strided_batched(handle, n, A, lda, stA, ipiv, stP,
-                                                                 C, ldc, stC, info, bc)
-                   : rocsolver_dgetri_outofplace(handle, n, A, lda, ipiv, C, ldc, info);
+    return rocsolver_cgecon_batched(handle, n, A, lda, anorm, rcond, bc);
 }
 
-inline rocblas_status rocsolver_getri_outofplace(bool STRIDED,
-                                                 rocblas_handle handle,
-                                                 rocblas_int n,
-                                                 rocblas_float_complex* A,
-                                                 rocblas_int lda,
-                                                 rocblas_stride stA,
-                                                 rocblas_int* ipiv,
-                                                 rocblas_stride stP,
-                                                 rocblas_float_complex* C,
-                                                 rocblas_int ldc,
-                                                 rocblas_stride stC,
-                                                 rocblas_int* info,
-                                                 rocblas_int bc)
+inline rocblas_status rocsolver_gecon(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int n,
+                                      rocblas_double_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* anorm,
+                                      double* rcond,
+                                      rocblas_int bc)
 {
-    return STRIDED ? rocsolver_cgetri_outofplace_strided_batched(handle, n, A, lda, stA, ipiv, stP,
-                                                                 C, ldc, stC, info, bc)
-                   : rocsolver_cgetri_outofplace(handle, n, A, lda, ipiv, C, ldc, info);
+    return rocsolver_zgecon_batched(handle, n, A, lda, anorm, rcond, bc);
 }
+/********************************************************/
 
-inline rocblas_status rocsolver_getri_outofplace(bool STRIDED,
-                                                 rocblas_handle handle,
-                                                 rocblas_int n,
-                                                 rocblas_double_complex* A,
-                                                 rocblas_int lda,
-                                                 rocblas_stride stA,
-                                                 rocblas_int* ipiv,
-                                                 rocblas_stride stP,
-                                                 rocblas_double_complex* C,
-                                                 rocblas_int ldc,
-                                                 rocblas_stride stC,
-                                                 rocblas_int* info,
-                                                 rocblas_int bc)
+/******************** POCON ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_pocon(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      float* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* anorm,
+                                      float* rcond,
+                                      rocblas_int bc)
 {
-    return STRIDED ? rocsolver_zgetri_outofplace_strided_batched(handle, n, A, lda, stA, ipiv, stP,
-                                                                 C, ldc, stC, info, bc)
-                   : rocsolver_zgetri_outofplace(handle, n, A, lda, ipiv, C, ldc, info);
+    return STRIDED ? rocsolver_spocon_strided_batched(handle, uplo, n, A, lda, stA, anorm, rcond,
+                                                      bc)
+                   : rocsolver_spocon(handle, uplo, n, A, lda, anorm, rcond);
 }
 
-// batched
-inline rocblas_status rocsolver_getri_outofplace(bool STRIDED,
-                                                 rocblas_handle handle,
-                                                 rocblas_int n,
-                                                 float* const A[],
-                                                 rocblas_int lda,
-                                                 rocblas_stride stA,
-                                                 rocblas_int* ipiv,
-                                                 rocblas_stride stP,
-                                                 float* const C[],
-                                                 rocblas_int ldc,
-                                                 rocblas_stride stC,
-                                                 rocblas_int* info,
-                                                 rocblas_int bc)
+inline rocblas_status rocsolver_pocon(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      double* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* anorm,
+                                      double* rcond,
+                                      rocblas_int bc)
 {
-    return rocsolver_sgetri_outofplace_batched(handle, n, A, lda, ipiv, stP, C, ldc, info, bc);
+    return STRIDED ? rocsolver_dpocon_strided_batched(handle, uplo, n, A, lda, stA, anorm, rcond,
+                                                      bc)
+                   : rocsolver_dpocon(handle, uplo, n, A, lda, anorm, rcond);
 }
 
-inline rocblas_status rocsolver_getri_outofplace(bool STRIDED,
-                                                 rocblas_handle handle,
-                                                 rocblas_int n,
-                                                 double* const A[],
-                                                 rocblas_int lda,
-                                                 rocblas_stride stA,
-                                                 rocblas_int* ipiv,
-                                                 rocblas_stride stP,
-                                                 double* const C[],
-                                                 rocblas_int ldc,
-                                                 rocblas_stride stC,
-                                                 rocblas_int* info,
-                                                 rocblas_int bc)
+inline rocblas_status rocsolver_pocon(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_float_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* anorm,
+                                      float* rcond,
+                                      rocblas_int bc)
 {
-    return rocsolver_dgetri_outofplace_batched(handle, n, A, lda, ipiv, stP, C, ldc, info, bc);
+    return STRIDED ? rocsolver_cpocon_strided_batched(handle, uplo, n, A, lda, stA, anorm, rcond,
+                                                      bc)
+                   : rocsolver_cpocon(handle, uplo, n, A, lda, anorm, rcond);
 }
 
-inline rocblas_status rocsolver_getri_outofplace(bool STRIDED,
-                                                 rocblas_handle handle,
-                                                 rocblas_int n,
-                                                 rocblas_float_complex* const A[],
-                                                 rocblas_int lda,
-                                                 rocblas_stride stA,
-                                                 rocblas_int* ipiv,
-                                                 rocblas_stride stP,
-                                                 rocblas_float_complex* const C[],
-                                                 rocblas_int ldc,
-                                                 rocblas_stride stC,
-                                                 rocblas_int* info,
-                                                 rocblas_int bc)
+inline rocblas_status rocsolver_pocon(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_double_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* anorm,
+                                      double* rcond,
+                                      rocblas_int bc)
 {
-    return rocsolver_cgetri_outofplace_batched(handle, n, A, lda, ipiv, stP, C, ldc, info, bc);
+    return STRIDED ? rocsolver_zpocon_strided_batched(handle, uplo, n, A, lda, stA, anorm, rcond,
+                                                      bc)
+                   : rocsolver_zpocon(handle, uplo, n, A, lda, anorm, rcond);
 }
 
-inline rocblas_status rocsolver_getri_outofplace(bool STRIDED,
-                                                 rocblas_handle handle,
-                                                 rocblas_int n,
-                                                 rocblas_double_complex* const A[],
-                                                 rocblas_int lda,
-                                                 rocblas_stride stA,
-                                                 rocblas_int* ipiv,
-                                                 rocblas_stride stP,
-                                                 rocblas_double_complex* const C[],
-                                                 rocblas_int ldc,
-                                                 rocblas_stride stC,
-                                                 rocblas_int* info,
-                                                 rocblas_int bc)
+// batched
+inline rocblas_status rocsolver_pocon(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      float* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* anorm,
+                                      float* rcond,
+                                      rocblas_int bc)
 {
-    return rocsolver_zgetri_outofplace_batched(handle, n, A, lda, ipiv, stP, C, ldc, info, bc);
+    return rocsolver_spocon_batched(handle, uplo, n, A, lda, anorm, rcond, bc);
 }
-/********************************************************/
 
-/******************** GETRI_NPVT_OUTOFPLACE ********************/
-// normal and strided_batched
-inline rocblas_status rocsolver_getri_npvt_outofplace(bool STRIDED,
-                                                      rocblas_handle handle,
-                                                      rocblas_int n,
-                                                      float* A,
-                                                      rocblas_int lda,
-                                                      rocblas_stride stA,
-                                                      float* C,
-                                                      rocblas_int ldc,
-                                                      rocblas_stride stC,
-                                                      rocblas_int* info,
-                                                      rocblas_int bc)
+inline rocblas_status rocsolver_pocon(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      double* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* anorm,
+                                      double* rcond,
+                                      rocblas_int bc)
 {
-    return STRIDED ? rocsolver_sgetri_npvt_outofplace_strided_batched(handle, n, A, lda, stA, C,
-                                                                      ldc, stC, info, bc)
-                   : rocsolver_sgetri_npvt_outofplace(handle, n, A, lda, C, ldc, info);
+    return rocsolver_dpocon_batched(handle, uplo, n, A, lda, anorm, rcond, bc);
 }
 
-inline rocblas_status rocsolver_getri_npvt_outofplace(bool STRIDED,
-                                                      rocblas_handle handle,
-                                                      rocblas_int n,
-                                                      double* A,
-                                                      rocblas_int lda,
-                                                      rocblas_stride stA,
-                                                      double* C,
-                                                      rocblas_int ldc,
-                                                      rocblas_stride stC,
-                                                      rocblas_int* info,
-                                                      rocblas_int bc)
+inline rocblas_status rocsolver_pocon(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_float_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* anorm,
+                                      float* rcond,
+                                      rocblas_int bc)
+{
+    return rocsolver_cpocon_batched(handle, uplo, n, A, lda, anorm, rcond, bc);
+}
+
+inline rocblas_status rocsolver_pocon(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_double_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* anorm,
+                                      double* rcond,
+                                      rocblas_int bc)
 {
-    return STRIDED ? rocsolver_dgetri_npvt_outofplace_strided_batched(handle, n, A, lda, stA, C,
-                                                                      ldc, stC, info, bc)
-                   : rocsolver_dgetri_npvt_outofplace(handle, n, A, lda, C, ldc, info);
+    return rocsolver_zpocon_batched(handle, uplo, n, A, lda, anorm, rcond, bc);
 }
+/********************************************************/
 
-inline rocblas_status rocsolver_getri_npvt_outofplace(bool STRIDED,
-                                                      rocblas_handle handle,
-                                                      rocblas_int n,
-                                                      rocblas_float_complex* A,
-                                                      rocblas_int lda,
-                                                      rocblas_stride stA,
-                                                      rocblas_float_complex* C,
-                                                      rocblas_int ldc,
-                                                      rocblas_stride stC,
-                                                      rocblas_int* info,
-                                                      rocblas_int bc)
+/******************** TRCON ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_trcon(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_diagonal diag,
+                                      rocblas_int n,
+                                      float* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* rcond,
+                                      rocblas_int bc)
 {
-    return STRIDED ? rocsolver_cgetri_npvt_outofplace_strided_batched(handle, n, A, lda, stA, C,
-                                                                      ldc, stC, info, bc)
-                   : rocsolver_cgetri_npvt_outofplace(handle, n, A, lda, C, ldc, info);
+    return STRIDED ? rocsolver_strcon_strided_batched(handle, uplo, diag, n, A, lda, stA, rcond, bc)
+                   : rocsolver_strcon(handle, uplo, diag, n, A, lda, rcond);
 }
 
-inline rocblas_status rocsolver_getri_npvt_outofplace(bool STRIDED,
-                                                      rocblas_handle handle,
-                                                      rocblas_int n,
-                                                      rocblas_double_complex* A,
-                                                      rocblas_int lda,
-                                                      rocblas_stride stA,
-                                                      rocblas_double_complex* C,
-                                                      rocblas_int ldc,
-                                                      rocblas_stride stC,
-                                                      rocblas_int* info,
-                                                      rocblas_int bc)
+inline rocblas_status rocsolver_trcon(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_diagonal diag,
+                                      rocblas_int n,
+                                      double* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* rcond,
+                                      rocblas_int bc)
 {
-    return STRIDED ? rocsolver_zgetri_npvt_outofplace_strided_batched(handle, n, A, lda, stA, C,
-                                                                      ldc, stC, info, bc)
-                   : rocsolver_zgetri_npvt_outofplace(handle, n, A, lda, C, ldc, info);
+    return STRIDED ? rocsolver_dtrcon_strided_batched(handle, uplo, diag, n, A, lda, stA, rcond, bc)
+                   : rocsolver_dtrcon(handle, uplo, diag, n, A, lda, rcond);
 }
 
-// batched
-inline rocblas_status rocsolver_getri_npvt_outofplace(bool STRIDED,
-                                                      rocblas_handle handle,
-                                                      rocblas_int n,
-                                                      float* const A[],
-                                                      rocblas_int lda,
-                                                      rocblas_stride stA,
-                                                      float* const C[],
-                                                      rocblas_int ldc,
-                                                      rocblas_stride stC,
-                                                      rocblas_int* info,
-                                                      rocblas_int bc)
+inline rocblas_status rocsolver_trcon(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_diagonal diag,
+                                      rocblas_int n,
+                                      rocblas_float_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* rcond,
+                                      rocblas_int bc)
 {
-    return rocsolver_sgetri_npvt_outofplace_batched(handle, n, A, lda, C, ldc, info, bc);
+    return STRIDED ? rocsolver_ctrcon_strided_batched(handle, uplo, diag, n, A, lda, stA, rcond, bc)
+                   : rocsolver_ctrcon(handle, uplo, diag, n, A, lda, rcond);
 }
 
-inline rocblas_status rocsolver_getri_npvt_outofplace(bool STRIDED,
-                                                      rocblas_handle handle,
-                                                      rocblas_int n,
-                                                      double* const A[],
-                                                      rocblas_int lda,
-                                                      rocblas_stride stA,
-                                                      double* const C[],
-                                                      rocblas_int ldc,
-                                                      rocblas_stride stC,
-                                                      rocblas_int* info,
-                                                      rocblas_int bc)
+inline rocblas_status rocsolver_trcon(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_diagonal diag,
+                                      rocblas_int n,
+                                      rocblas_double_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* rcond,
+                                      rocblas_int bc)
 {
-    return rocsolver_dgetri_npvt_outofplace_batched(handle, n, A, lda, C, ldc, info, bc);
+    return STRIDED ? rocsolver_ztrcon_strided_batched(handle, uplo, diag, n, A, lda, stA, rcond, bc)
+                   : rocsolver_ztrcon(handle, uplo, diag, n, A, lda, rcond);
 }
 
-inline rocblas_status rocsolver_getri_npvt_outofplace(bool STRIDED,
-                                                      rocblas_handle handle,
-                                                      rocblas_int n,
-                                                      rocblas_float_complex* const A[],
-                                                      rocblas_int lda,
-                                                      rocblas_stride stA,
-                                                      rocblas_float_complex* const C[],
-                                                      rocblas_int ldc,
-                                                      rocblas_stride stC,
-                                                      rocblas_int* info,
-                                                      rocblas_int bc)
+// batched
+inline rocblas_status rocsolver_trcon(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_diagonal diag,
+                                      rocblas_int n,
+                                      float* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* rcond,
+                                      rocblas_int bc)
 {
-    return rocsolver_cgetri_npvt_outofplace_batched(handle, n, A, lda, C, ldc, info, bc);
+    return rocsolver_strcon_batched(handle, uplo, diag, n, A, lda, rcond, bc);
 }
 
-inline rocblas_status rocsolver_getri_npvt_outofplace(bool STRIDED,
-                                                      rocblas_handle handle,
-                                                      rocblas_int n,
-                                                      rocblas_double_complex* const A[],
-                                                      rocblas_int lda,
-                                                      rocblas_stride stA,
-                                                      rocblas_double_complex* const C[],
-                                                      rocblas_int ldc,
-                                                      rocblas_stride stC,
-                                                      rocblas_int* info,
-                                                      rocblas_int bc)
+inline rocblas_status rocsolver_trcon(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_diagonal diag,
+                                      rocblas_int n,
+                                      double* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* rcond,
+                                      rocblas_int bc)
 {
-    return rocsolver_zgetri_npvt_outofplace_batched(handle, n, A, lda, C, ldc, info, bc);
+    return rocsolver_dtrcon_batched(handle, uplo, diag, n, A, lda, rcond, bc);
 }
-/********************************************************/
 
-/******************** GETRI ********************/
-// normal and strided_batched
-inline rocblas_status rocsolver_getri(bool STRIDED,
+inline rocblas_status rocsolver_trcon(bool STRIDED,
                                       rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_diagonal diag,
                                       rocblas_int n,
-                                      float* A,
+                                      rocblas_float_complex* const A[],
                                       rocblas_int lda,
                                       rocblas_stride stA,
-                                      rocblas_int* ipiv,
-                                      rocblas_stride stP,
-                                      rocblas_int* info,
+                                      float* rcond,
                                       rocblas_int bc)
 {
-    return STRIDED ? rocsolver_sgetri_strided_batched(handle, n, A, lda, stA, ipiv, stP, info, bc)
-                   : rocsolver_sgetri(handle, n, A, lda, ipiv, info);
+    return rocsolver_ctrcon_batched(handle, uplo, diag, n, A, lda, rcond, bc);
 }
 
-inline rocblas_status rocsolver_getri(bool STRIDED,
+inline rocblas_status rocsolver_trcon(bool STRIDED,
                                       rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_diagonal diag,
                                       rocblas_int n,
-                                      double* A,
+                                      rocblas_double_complex* const A[],
                                       rocblas_int lda,
                                       rocblas_stride stA,
-                                      rocblas_int* ipiv,
-                                      rocblas_stride stP,
-                                      rocblas_int* info,
+                                      double* rcond,
                                       rocblas_int bc)
 {
-    return STRIDED ? rocsolver_dgetri_strided_batched(handle, n, A, lda, stA, ipiv, stP, info, bc)
-                   : rocsolver_dgetri(handle, n, A, lda, ipiv, info);
+    return rocsolver_ztrcon_batched(handle, uplo, diag, n, A, lda, rcond, bc);
+}
+/********************************************************/
+
+/******************** GEQR2_GEQRF ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
+                                            bool GEQRF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            float* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return GEQRF ? rocsolver_sgeqrf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
+                     : rocsolver_sgeqr2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+    else
+        return GEQRF ? rocsolver_sgeqrf(handle, m, n, A, lda, ipiv)
+                     : rocsolver_sgeqr2(handle, m, n, A, lda, ipiv);
+}
+
+inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
+                                            bool GEQRF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            double* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return GEQRF ? rocsolver_dgeqrf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
+                     : rocsolver_dgeqr2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+    else
+        return GEQRF ? rocsolver_dgeqrf(handle, m, n, A, lda, ipiv)
+                     : rocsolver_dgeqr2(handle, m, n, A, lda, ipiv);
+}
+
+inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
+                                            bool GEQRF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_float_complex* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_float_complex* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return GEQRF ? rocsolver_cgeqrf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
+                     : rocsolver_cgeqr2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+    else
+        return GEQRF ? rocsolver_cgeqrf(handle, m, n, A, lda, ipiv)
+                     : rocsolver_cgeqr2(handle, m, n, A, lda, ipiv);
+}
+
+inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
+                                            bool GEQRF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_double_complex* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_double_complex* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return GEQRF ? rocsolver_zgeqrf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
+                     : rocsolver_zgeqr2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+    else
+        return GEQRF ? rocsolver_zgeqrf(handle, m, n, A, lda, ipiv)
+                     : rocsolver_zgeqr2(handle, m, n, A, lda, ipiv);
+}
+
+// batched
+inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
+                                            bool GEQRF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            float* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    return GEQRF ? rocsolver_sgeqrf_batched(handle, m, n, A, lda, ipiv, stP, bc)
+                 : rocsolver_sgeqr2_batched(handle, m, n, A, lda, ipiv, stP, bc);
 }
 
-inline rocblas_status rocsolver_getri(bool STRIDED,
-                                      rocblas_handle handle,
-                                      rocblas_int n,
-                                      rocblas_float_complex* A,
-                                      rocblas_int lda,
-                                      rocblas_stride stA,
-                                      rocblas_int* ipiv,
-                                      rocblas_stride stP,
-                                      rocblas_int* info,
-                                      rocblas_int bc)
+inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
+                                            bool GEQRF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            double* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
 {
-    return STRIDED ? rocsolver_cgetri_strided_batched(handle, n, A, lda, stA, ipiv, stP, info, bc)
-                   : rocsolver_cgetri(handle, n, A, lda, ipiv, info);
+    return GEQRF ? rocsolver_dgeqrf_batched(handle, m, n, A, lda, ipiv, stP, bc)
+                 : rocsolver_dgeqr2_batched(handle, m, n, A, lda, ipiv, stP, bc);
 }
 
-inline rocblas_status rocsolver_getri(bool STRIDED,
-                                      rocblas_handle handle,
-                                      rocblas_int n,
-                                      rocblas_double_complex* A,
-                                      rocblas_int lda,
-                                      rocblas_stride stA,
-                                      rocblas_int* ipiv,
-                                      rocblas_stride stP,
-                                      rocblas_int* info,
-                                      rocblas_int bc)
+inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
+                                            bool GEQRF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_float_complex* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_float_complex* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
 {
-    return STRIDED ? rocsolver_zgetri_strided_batched(handle, n, A, lda, stA, ipiv, stP, info, bc)
-                   : rocsolver_zgetri(handle, n, A, lda, ipiv, info);
+    return GEQRF ? rocsolver_cgeqrf_batched(handle, m, n, A, lda, ipiv, stP, bc)
+                 : rocsolver_cgeqr2_batched(handle, m, n, A, lda, ipiv, stP, bc);
 }
 
-// batched
-inline rocblas_status rocsolver_getri(bool STRIDED,
-                                      rocblas_handle handle,
-                                      rocblas_int n,
-                                      float* const A[],
-                                      rocblas_int lda,
-                                      rocblas_stride stA,
-                                      rocblas_int* ipiv,
-                                      rocblas_stride stP,
-                                      rocblas_int* info,
-                                      rocblas_int bc)
+inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
+                                            bool GEQRF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_double_complex* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_double_complex* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
 {
-    return rocsolver_sgetri_batched(handle, n, A, lda, ipiv, stP, info, bc);
+    return GEQRF ? rocsolver_zgeqrf_batched(handle, m, n, A, lda, ipiv, stP, bc)
+                 : rocsolver_zgeqr2_batched(handle, m, n, A, lda, ipiv, stP, bc);
 }
 
-inline rocblas_status rocsolver_getri(bool STRIDED,
-                                      rocblas_handle handle,
-                                      rocblas_int n,
-                                      double* const A[],
-                                      rocblas_int lda,
-                                      rocblas_stride stA,
-                                      rocblas_int* ipiv,
-                                      rocblas_stride stP,
-                                      rocblas_int* info,
-                                      rocblas_int bc)
+// ptr_batched
+inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
+                                            bool GEQRF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            float* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float* const ipiv[],
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
 {
-    return rocsolver_dgetri_batched(handle, n, A, lda, ipiv, stP, info, bc);
+    return GEQRF ? rocsolver_sgeqrf_ptr_batched(handle, m, n, A, lda, ipiv, bc)
+                 : rocblas_status_not_implemented;
 }
 
-inline rocblas_status rocsolver_getri(bool STRIDED,
-                                      rocblas_handle handle,
-                                      rocblas_int n,
-                                      rocblas_float_complex* const A[],
-                                      rocblas_int lda,
-                                      rocblas_stride stA,
-                                      rocblas_int* ipiv,
-                                      rocblas_stride stP,
-                                      rocblas_int* info,
-                                      rocblas_int bc)
+inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
+                                            bool GEQRF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            double* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double* const ipiv[],
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
 {
-    return rocsolver_cgetri_batched(handle, n, A, lda, ipiv, stP, info, bc);
+    return GEQRF ? rocsolver_dgeqrf_ptr_batched(handle, m, n, A, lda, ipiv, bc)
+                 : rocblas_status_not_implemented;
 }
 
-inline rocblas_status rocsolver_getri(bool STRIDED,
-                                      rocblas_handle handle,
-                                      rocblas_int n,
-                                      rocblas_double_complex* const A[],
-                                      rocblas_int lda,
-                                      rocblas_stride stA,
-                                      rocblas_int* ipiv,
-                                      rocblas_stride stP,
-                                      rocblas_int* info,
-                                      rocblas_int bc)
+inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
+                                            bool GEQRF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_float_complex* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_float_complex* const ipiv[],
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
 {
-    return rocsolver_zgetri_batched(handle, n, A, lda, ipiv, stP, info, bc);
+    return GEQRF ? rocsolver_cgeqrf_ptr_batched(handle, m, n, A, lda, ipiv, bc)
+                 : rocblas_status_not_implemented;
+}
+
+inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
+                                            bool GEQRF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_double_complex* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_double_complex* const ipiv[],
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    return GEQRF ? rocsolver_zgeqrf_ptr_batched(handle, m, n, A, lda, ipiv, bc)
+                 : rocblas_status_not_implemented;
 }
 /********************************************************/
 
-/******************** GETRI_NPVT ********************/
+/******************** GEQRF_ROWUPDATE ********************/
 // normal and strided_batched
-inline rocblas_status rocsolver_getri_npvt(bool STRIDED,
-                                           rocblas_handle handle,
-                                           rocblas_int n,
-                                           float* A,
-                                           rocblas_int lda,
-                                           rocblas_stride stA,
-                                           rocblas_int* info,
-                                           rocblas_int bc)
+inline rocblas_status rocsolver_geqrf_rowupdate(bool STRIDED,
+                                                bool DOWNDATE,
+                                                rocblas_handle handle,
+                                                rocblas_int n,
+                                                rocblas_int k,
+                                                float* A,
+                                                rocblas_int lda,
+                                                rocblas_stride stA,
+                                                float* W,
+                                                rocblas_int ldw,
+                                                rocblas_stride stW,
+                                                rocblas_int* info,
+                                                rocblas_int bc)
 {
-    return STRIDED ? rocsolver_sgetri_npvt_strided_batched(handle, n, A, lda, stA, info, bc)
-                   : rocsolver_sgetri_npvt(handle, n, A, lda, info);
+    if(STRIDED)
+        return DOWNDATE
+            ? rocsolver_sgeqrf_rowdowndate_strided_batched(handle, n, k, A, lda, stA, W, ldw, stW,
+                                                           info, bc)
+            : rocsolver_sgeqrf_rowupdate_strided_batched(handle, n, k, A, lda, stA, W, ldw, stW,
+                                                         info, bc);
+    else
+        return DOWNDATE
+            ? rocsolver_sgeqrf_rowdowndate(handle, n, k, A, lda, W, ldw, info)
+            : rocsolver_sgeqrf_rowupdate(handle, n, k, A, lda, W, ldw, info);
 }
 
-inline rocblas_status rocsolver_getri_npvt(bool STRIDED,
-                                           rocblas_handle handle,
-                                           rocblas_int n,
-                                           double* A,
-                                           rocblas_int lda,
-                                           rocblas_stride stA,
-                                           rocblas_int* info,
-                                           rocblas_int bc)
+inline rocblas_status rocsolver_geqrf_rowupdate(bool STRIDED,
+                                                bool DOWNDATE,
+                                                rocblas_handle handle,
+                                                rocblas_int n,
+                                                rocblas_int k,
+                                                double* A,
+                                                rocblas_int lda,
+                                                rocblas_stride stA,
+                                                double* W,
+                                                rocblas_int ldw,
+                                                rocblas_stride stW,
+                                                rocblas_int* info,
+                                                rocblas_int bc)
 {
-    return STRIDED ? rocsolver_dgetri_npvt_strided_batched(handle, n, A, lda, stA, info, bc)
-                   : rocsolver_dgetri_npvt(handle, n, A, lda, info);
+    if(STRIDED)
+        return DOWNDATE
+            ? rocsolver_dgeqrf_rowdowndate_strided_batched(handle, n, k, A, lda, stA, W, ldw, stW,
+                                                           info, bc)
+            : rocsolver_dgeqrf_rowupdate_strided_batched(handle, n, k, A, lda, stA, W, ldw, stW,
+                                                         info, bc);
+    else
+        return DOWNDATE
+            ? rocsolver_dgeqrf_rowdowndate(handle, n, k, A, lda, W, ldw, info)
+            : rocsolver_dgeqrf_rowupdate(handle, n, k, A, lda, W, ldw, info);
 }
 
-inline rocblas_status rocsolver_getri_npvt(bool STRIDED,
-                                           rocblas_handle handle,
-                                           rocblas_int n,
-                                           rocblas_float_complex* A,
-                                           rocblas_int lda,
-                                           rocblas_stride stA,
-                                           rocblas_int* info,
-                                           rocblas_int bc)
+inline rocblas_status rocsolver_geqrf_rowupdate(bool STRIDED,
+                                                bool DOWNDATE,
+                                                rocblas_handle handle,
+                                                rocblas_int n,
+                                                rocblas_int k,
+                                                rocblas_float_complex* A,
+                                                rocblas_int lda,
+                                                rocblas_stride stA,
+                                                rocblas_float_complex* W,
+                                                rocblas_int ldw,
+                                                rocblas_stride stW,
+                                                rocblas_int* info,
+                                                rocblas_int bc)
 {
-    return STRIDED ? rocsolver_cgetri_npvt_strided_batched(handle, n, A, lda, stA, info, bc)
-                   : rocsolver_cgetri_npvt(handle, n, A, lda, info);
+    if(STRIDED)
+        return DOWNDATE
+            ? rocsolver_cgeqrf_rowdowndate_strided_batched(handle, n, k, A, lda, stA, W, ldw, stW,
+                                                           info, bc)
+            : rocsolver_cgeqrf_rowupdate_strided_batched(handle, n, k, A, lda, stA, W, ldw, stW,
+                                                         info, bc);
+    else
+        return DOWNDATE
+            ? rocsolver_cgeqrf_rowdowndate(handle, n, k, A, lda, W, ldw, info)
+            : rocsolver_cgeqrf_rowupdate(handle, n, k, A, lda, W, ldw, info);
 }
 
-inline rocblas_status rocsolver_getri_npvt(bool STRIDED,
-                                           rocblas_handle handle,
-                                           rocblas_int n,
-                                           rocblas_double_complex* A,
-                                           rocblas_int lda,
-                                           rocblas_stride stA,
-                                           rocblas_int* info,
-                                           rocblas_int bc)
+inline rocblas_status rocsolver_geqrf_rowupdate(bool STRIDED,
+                                                bool DOWNDATE,
+                                                rocblas_handle handle,
+                                                rocblas_int n,
+                                                rocblas_int k,
+                                                rocblas_double_complex* A,
+                                                rocblas_int lda,
+                                                rocblas_stride stA,
+                                                rocblas_double_complex* W,
+                                                rocblas_int ldw,
+                                                rocblas_stride stW,
+                                                rocblas_int* info,
+                                                rocblas_int bc)
 {
-    return STRIDED ? rocsolver_zgetri_npvt_strided_batched(handle, n, A, lda, stA, info, bc)
-                   : rocsolver_zgetri_npvt(handle, n, A, lda, info);
+    if(STRIDED)
+        return DOWNDATE
+            ? rocsolver_zgeqrf_rowdowndate_strided_batched(handle, n, k, A, lda, stA, W, ldw, stW,
+                                                           info, bc)
+            : rocsolver_zgeqrf_rowupdate_strided_batched(handle, n, k, A, lda, stA, W, ldw, stW,
+                                                         info, bc);
+    else
+        return DOWNDATE
+            ? rocsolver_zgeqrf_rowdowndate(handle, n, k, A, lda, W, ldw, info)
+            : rocsolver_zgeqrf_rowupdate(handle, n, k, A, lda, W, ldw, info);
 }
-
-// batched
-inline rocblas_status rocsolver_getri_npvt(bool STRIDED,
-                                           rocblas_handle handle,
-                                           rocblas_int n,
-                                           float* const A[],
-                                           rocblas_int lda,
-                                           rocblas_stride stA,
-                                           rocblas_int* info,
-                                           rocblas_int bc)
+
+// batched
+inline rocblas_status rocsolver_geqrf_rowupdate(bool STRIDED,
+                                                bool DOWNDATE,
+                                                rocblas_handle handle,
+                                                rocblas_int n,
+                                                rocblas_int k,
+                                                float* const A[],
+                                                rocblas_int lda,
+                                                rocblas_stride stA,
+                                                float* const W[],
+                                                rocblas_int ldw,
+                                                rocblas_stride stW,
+                                                rocblas_int* info,
+                                                rocblas_int bc)
 {
-    return rocsolver_sgetri_npvt_batched(handle, n, A, lda, info, bc);
+    return DOWNDATE
+        ? rocsolver_sgeqrf_rowdowndate_batched(handle, n, k, A, lda, W, ldw, info, bc)
+        : rocsolver_sgeqrf_rowupdate_batched(handle, n, k, A, lda, W, ldw, info, bc);
 }
 
-inline rocblas_status rocsolver_getri_npvt(bool STRIDED,
-                                           rocblas_handle handle,
-                                           rocblas_int n,
-                                           double* const A[],
-                                           rocblas_int lda,
-                                           rocblas_stride stA,
-                                           rocblas_int* info,
-                                           rocblas_int bc)
+inline rocblas_status rocsolver_geqrf_rowupdate(bool STRIDED,
+                                                bool DOWNDATE,
+                                                rocblas_handle handle,
+                                                rocblas_int n,
+                                                rocblas_int k,
+                                                double* const A[],
+                                                rocblas_int lda,
+                                                rocblas_stride stA,
+                                                double* const W[],
+                                                rocblas_int ldw,
+                                                rocblas_stride stW,
+                                                rocblas_int* info,
+                                                rocblas_int bc)
 {
-    return rocsolver_dgetri_npvt_batched(handle, n, A, lda, info, bc);
+    return DOWNDATE
+        ? rocsolver_dgeqrf_rowdowndate_batched(handle, n, k, A, lda, W, ldw, info, bc)
+        : rocsolver_dgeqrf_rowupdate_batched(handle, n, k, A, lda, W, ldw, info, bc);
 }
 
-inline rocblas_status rocsolver_getri_npvt(bool STRIDED,
-                                           rocblas_handle handle,
-                                           rocblas_int n,
-                                           rocblas_float_complex* const A[],
-                                           rocblas_int lda,
-                                           rocblas_stride stA,
-                                           rocblas_int* info,
-                                           rocblas_int bc)
+inline rocblas_status rocsolver_geqrf_rowupdate(bool STRIDED,
+                                                bool DOWNDATE,
+                                                rocblas_handle handle,
+                                                rocblas_int n,
+                                                rocblas_int k,
+                                                rocblas_float_complex* const A[],
+                                                rocblas_int lda,
+                                                rocblas_stride stA,
+                                                rocblas_float_complex* const W[],
+                                                rocblas_int ldw,
+                                                rocblas_stride stW,
+                                                rocblas_int* info,
+                                                rocblas_int bc)
 {
-    return rocsolver_cgetri_npvt_batched(handle, n, A, lda, info, bc);
+    return DOWNDATE
+        ? rocsolver_cgeqrf_rowdowndate_batched(handle, n, k, A, lda, W, ldw, info, bc)
+        : rocsolver_cgeqrf_rowupdate_batched(handle, n, k, A, lda, W, ldw, info, bc);
 }
 
-inline rocblas_status rocsolver_getri_npvt(bool STRIDED,
-                                           rocblas_handle handle,
-                                           rocblas_int n,
-                                           rocblas_double_complex* const A[],
-                                           rocblas_int lda,
-                                           rocblas_stride stA,
-                                           rocblas_int* info,
-                                           rocblas_int bc)
+inline rocblas_status rocsolver_geqrf_rowupdate(bool STRIDED,
+                                                bool DOWNDATE,
+                                                rocblas_handle handle,
+                                                rocblas_int n,
+                                                rocblas_int k,
+                                                rocblas_double_complex* const A[],
+                                                rocblas_int lda,
+                                                rocblas_stride stA,
+                                                rocblas_double_complex* const W[],
+                                                rocblas_int ldw,
+                                                rocblas_stride stW,
+                                                rocblas_int* info,
+                                                rocblas_int bc)
 {
-    return rocsolver_zgetri_npvt_batched(handle, n, A, lda, info, bc);
+    return DOWNDATE
+        ? rocsolver_zgeqrf_rowdowndate_batched(handle, n, k, A, lda, W, ldw, info, bc)
+        : rocsolver_zgeqrf_rowupdate_batched(handle, n, k, A, lda, W, ldw, info, bc);
 }
 /********************************************************/
 
-/******************** TRTRI ********************/
+/******************** GEQRF_COLDELETE ********************/
 // normal and strided_batched
-inline rocblas_status rocsolver_trtri(bool STRIDED,
-                                      rocblas_handle handle,
-                                      rocblas_fill uplo,
-                                      rocblas_diagonal diag,
-                                      rocblas_int n,
-                                      float* A,
-                                      rocblas_int lda,
-                                      rocblas_stride stA,
-                                      rocblas_int* info,
-                                      rocblas_int bc)
+inline rocblas_status rocsolver_geqrf_coldelete(bool STRIDED,
+                                                rocblas_handle handle,
+                                                rocblas_int m,
+                                                rocblas_int n,
+                                                rocblas_int col,
+                                                float* A,
+                                                rocblas_int lda,
+                                                rocblas_stride stA,
+                                                rocblas_int bc)
 {
-    return STRIDED ? rocsolver_strtri_strided_batched(handle, uplo, diag, n, A, lda, stA, info, bc)
-                   : rocsolver_strtri(handle, uplo, diag, n, A, lda, info);
+    return STRIDED
+        ? rocsolver_sgeqrf_coldelete_strided_batched(handle, m, n, col, A, lda, stA, bc)
+        : rocsolver_sgeqrf_coldelete(handle, m, n, col, A, lda);
 }
 
-inline rocblas_status rocsolver_trtri(bool STRIDED,
-                                      rocblas_handle handle,
-                                      rocblas_fill uplo,
-                                      rocblas_diagonal diag,
-                                      rocblas_int n,
-                                      double* A,
-                                      rocblas_int lda,
-                                      rocblas_stride stA,
-                                      rocblas_int* info,
-                                      rocblas_int bc)
+inline rocblas_status rocsolver_geqrf_coldelete(bool STRIDED,
+                                                rocblas_handle handle,
+                                                rocblas_int m,
+                                                rocblas_int n,
+                                                rocblas_int col,
+                                                double* A,
+                                                rocblas_int lda,
+                                                rocblas_stride stA,
+                                                rocblas_int bc)
 {
-    return STRIDED ? rocsolver_dtrtri_strided_batched(handle, uplo, diag, n, A, lda, stA, info, bc)
-                   : rocsolver_dtrtri(handle, uplo, diag, n, A, lda, info);
+    return STRIDED
+        ? rocsolver_dgeqrf_coldelete_strided_batched(handle, m, n, col, A, lda, stA, bc)
+        : rocsolver_dgeqrf_coldelete(handle, m, n, col, A, lda);
 }
 
-inline rocblas_status rocsolver_trtri(bool STRIDED,
-                                      rocblas_handle handle,
-                                      rocblas_fill uplo,
-                                      rocblas_diagonal diag,
-                                      rocblas_int n,
-                                      rocblas_float_complex* A,
-                                      rocblas_int lda,
-                                      rocblas_stride stA,
-                                      rocblas_int* info,
-                                      rocblas_int bc)
+inline rocblas_status rocsolver_geqrf_coldelete(bool STRIDED,
+                                                rocblas_handle handle,
+                                                rocblas_int m,
+                                                rocblas_int n,
+                                                rocblas_int col,
+                                                rocblas_float_complex* A,
+                                                rocblas_int lda,
+                                                rocblas_stride stA,
+                                                rocblas_int bc)
 {
-    return STRIDED ? rocsolver_ctrtri_strided_batched(handle, uplo, diag, n, A, lda, stA, info, bc)
-                   : rocsolver_ctrtri(handle, uplo, diag, n, A, lda, info);
+    return STRIDED
+        ? rocsolver_cgeqrf_coldelete_strided_batched(handle, m, n, col, A, lda, stA, bc)
+        : rocsolver_cgeqrf_coldelete(handle, m, n, col, A, lda);
 }
 
-inline rocblas_status rocsolver_trtri(bool STRIDED,
-                                      rocblas_handle handle,
-                                      rocblas_fill uplo,
-                                      rocblas_diagonal diag,
-                                      rocblas_int n,
-                                      rocblas_double_complex* A,
-                                      rocblas_int lda,
-                                      rocblas_stride stA,
-                                      rocblas_int* info,
-                                      rocblas_int bc)
+inline rocblas_status rocsolver_geqrf_coldelete(bool STRIDED,
+                                                rocblas_handle handle,
+                                                rocblas_int m,
+                                                rocblas_int n,
+                                                rocblas_int col,
+                                                rocblas_double_complex* A,
+                                                rocblas_int lda,
+                                                rocblas_stride stA,
+                                                rocblas_int bc)
 {
-    return STRIDED ? rocsolver_ztrtri_strided_batched(handle, uplo, diag, n, A, lda, stA, info, bc)
-                   : rocsolver_ztrtri(handle, uplo, diag, n, A, lda, info);
+    return STRIDED
+        ? rocsolver_zgeqrf_coldelete_strided_batched(handle, m, n, col, A, lda, stA, bc)
+        : rocsolver_zgeqrf_coldelete(handle, m, n, col, A, lda);
 }
 
 // batched
-inline rocblas_status rocsolver_trtri(bool STRIDED,
-                                      rocblas_handle handle,
-                                      rocblas_fill uplo,
-                                      rocblas_diagonal diag,
-                                      rocblas_int n,
-                                      float* const A[],
-                                      rocblas_int lda,
-                                      rocblas_stride stA,
-                                      rocblas_int* info,
-                                      rocblas_int bc)
+inline rocblas_status rocsolver_geqrf_coldelete(bool STRIDED,
+                                                rocblas_handle handle,
+                                                rocblas_int m,
+                                                rocblas_int n,
+                                                rocblas_int col,
+                                                float* const A[],
+                                                rocblas_int lda,
+                                                rocblas_stride stA,
+                                                rocblas_int bc)
 {
-    return rocsolver_strtri_batched(handle, uplo, diag, n, A, lda, info, bc);
+    return rocsolver_sgeqrf_coldelete_batched(handle, m, n, col, A, lda, bc);
 }
 
-inline rocblas_status rocsolver_trtri(bool STRIDED,
-                                      rocblas_handle handle,
-                                      rocblas_fill uplo,
-                                      rocblas_diagonal diag,
-                                      rocblas_int n,
-                                      double* const A[],
-                                      rocblas_int lda,
-                                      rocblas_stride stA,
-                                      rocblas_int* info,
-                                      rocblas_int bc)
+inline rocblas_status rocsolver_geqrf_coldelete(bool STRIDED,
+                                                rocblas_handle handle,
+                                                rocblas_int m,
+                                                rocblas_int n,
+                                                rocblas_int col,
+                                                double* const A[],
+                                                rocblas_int lda,
+                                                rocblas_stride stA,
+                                                rocblas_int bc)
 {
-    return rocsolver_dtrtri_batched(handle, uplo, diag, n, A, lda, info, bc);
+    return rocsolver_dgeqrf_coldelete_batched(handle, m, n, col, A, lda, bc);
 }
 
-inline rocblas_status rocsolver_trtri(bool STRIDED,
-                                      rocblas_handle handle,
-                                      rocblas_fill uplo,
-                                      rocblas_diagonal diag,
-                                      rocblas_int n,
-                                      rocblas_float_complex* const A[],
-                                      rocblas_int lda,
-                                      rocblas_stride stA,
-                                      rocblas_int* info,
-                                      rocblas_int bc)
+inline rocblas_status rocsolver_geqrf_coldelete(bool STRIDED,
+                                                rocblas_handle handle,
+                                                rocblas_int m,
+                                                rocblas_int n,
+                                                rocblas_int col,
+                                                rocblas_float_complex* const A[],
+                                                rocblas_int lda,
+                                                rocblas_stride stA,
+                                                rocblas_int bc)
 {
-    return rocsolver_ctrtri_batched(handle, uplo, diag, n, A, lda, info, bc);
+    return rocsolver_cgeqrf_coldelete_batched(handle, m, n, col, A, lda, bc);
 }
 
-inline rocblas_status rocsolver_trtri(bool STRIDED,
-                                      rocblas_handle handle,
-                                      rocblas_fill uplo,
-                                      rocblas_diagonal diag,
-                                      rocblas_int n,
-                                      rocblas_double_complex* const A[],
-                                      rocblas_int lda,
-                                      rocblas_stride stA,
-                                      rocblas_int* info,
-                                      rocblas_int bc)
+inline rocblas_status rocsolver_geqrf_coldelete(bool STRIDED,
+                                                rocblas_handle handle,
+                                                rocblas_int m,
+                                                rocblas_int n,
+                                                rocblas_int col,
+                                                rocblas_double_complex* const A[],
+                                                rocblas_int lda,
+                                                rocblas_stride stA,
+                                                rocblas_int bc)
 {
-    return rocsolver_ztrtri_batched(handle, uplo, diag, n, A, lda, info, bc);
+    return rocsolver_zgeqrf_coldelete_batched(handle, m, n, col, A, lda, bc);
 }
 /********************************************************/
 
-/******************** GEQR2_GEQRF ********************/
+/******************** GEQP3 ********************/
 // normal and strided_batched
-inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
-                                            bool GEQRF,
-                                            rocblas_handle handle,
-                                            rocblas_int m,
-                                            rocblas_int n,
-                                            float* A,
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            float* ipiv,
-                                            rocblas_stride stP,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_geqp3(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      float* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      float* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_int bc)
 {
     if(STRIDED)
-        return GEQRF ? rocsolver_sgeqrf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
-                     : rocsolver_sgeqr2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+        return rocsolver_sgeqp3_strided_batched(handle, m, n, A, lda, stA, jpvt, stJ, ipiv, stP,
+                                                bc);
     else
-        return GEQRF ? rocsolver_sgeqrf(handle, m, n, A, lda, ipiv)
-                     : rocsolver_sgeqr2(handle, m, n, A, lda, ipiv);
+        return rocsolver_sgeqp3(handle, m, n, A, lda, jpvt, ipiv);
 }
 
-inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
-                                            bool GEQRF,
-                                            rocblas_handle handle,
-                                            rocblas_int m,
-                                            rocblas_int n,
-                                            double* A,
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            double* ipiv,
-                                            rocblas_stride stP,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_geqp3(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      double* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      double* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_int bc)
 {
     if(STRIDED)
-        return GEQRF ? rocsolver_dgeqrf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
-                     : rocsolver_dgeqr2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+        return rocsolver_dgeqp3_strided_batched(handle, m, n, A, lda, stA, jpvt, stJ, ipiv, stP,
+                                                bc);
     else
-        return GEQRF ? rocsolver_dgeqrf(handle, m, n, A, lda, ipiv)
-                     : rocsolver_dgeqr2(handle, m, n, A, lda, ipiv);
+        return rocsolver_dgeqp3(handle, m, n, A, lda, jpvt, ipiv);
 }
 
-inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
-                                            bool GEQRF,
-                                            rocblas_handle handle,
-                                            rocblas_int m,
-                                            rocblas_int n,
-                                            rocblas_float_complex* A,
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            rocblas_float_complex* ipiv,
-                                            rocblas_stride stP,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_geqp3(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_float_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      rocblas_float_complex* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_int bc)
 {
     if(STRIDED)
-        return GEQRF ? rocsolver_cgeqrf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
-                     : rocsolver_cgeqr2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+        return rocsolver_cgeqp3_strided_batched(handle, m, n, A, lda, stA, jpvt, stJ, ipiv, stP,
+                                                bc);
     else
-        return GEQRF ? rocsolver_cgeqrf(handle, m, n, A, lda, ipiv)
-                     : rocsolver_cgeqr2(handle, m, n, A, lda, ipiv);
+        return rocsolver_cgeqp3(handle, m, n, A, lda, jpvt, ipiv);
 }
 
-inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
-                                            bool GEQRF,
-                                            rocblas_handle handle,
-                                            rocblas_int m,
-                                            rocblas_int n,
-                                            rocblas_double_complex* A,
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            rocblas_double_complex* ipiv,
-                                            rocblas_stride stP,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_geqp3(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_double_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      rocblas_double_complex* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_int bc)
 {
     if(STRIDED)
-        return GEQRF ? rocsolver_zgeqrf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
-                     : rocsolver_zgeqr2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+        return rocsolver_zgeqp3_strided_batched(handle, m, n, A, lda, stA, jpvt, stJ, ipiv, stP,
+                                                bc);
     else
-        return GEQRF ? rocsolver_zgeqrf(handle, m, n, A, lda, ipiv)
-                     : rocsolver_zgeqr2(handle, m, n, A, lda, ipiv);
+        return rocsolver_zgeqp3(handle, m, n, A, lda, jpvt, ipiv);
 }
 
 // batched
-inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
-                                            bool GEQRF,
-                                            rocblas_handle handle,
-                                            rocblas_int m,
-                                            rocblas_int n,
-                                            float* const A[],
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            float* ipiv,
-                                            rocblas_stride stP,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_geqp3(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      float* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      float* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_int bc)
 {
-    return GEQRF ? rocsolver_sgeqrf_batched(handle, m, n, A, lda, ipiv, stP, bc)
-                 : rocsolver_sgeqr2_batched(handle, m, n, A, lda, ipiv, stP, bc);
+    return rocsolver_sgeqp3_batched(handle, m, n, A, lda, jpvt, stJ, ipiv, stP, bc);
 }
 
-inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
-                                            bool GEQRF,
-                                            rocblas_handle handle,
-                                            rocblas_int m,
-                                            rocblas_int n,
-                                            double* const A[],
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            double* ipiv,
-                                            rocblas_stride stP,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_geqp3(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      double* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      double* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_int bc)
 {
-    return GEQRF ? rocsolver_dgeqrf_batched(handle, m, n, A, lda, ipiv, stP, bc)
-                 : rocsolver_dgeqr2_batched(handle, m, n, A, lda, ipiv, stP, bc);
+    return rocsolver_dgeqp3_batched(handle, m, n, A, lda, jpvt, stJ, ipiv, stP, bc);
 }
 
-inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
-                                            bool GEQRF,
-                                            rocblas_handle handle,
-                                            rocblas_int m,
-                                            rocblas_int n,
-                                            rocblas_float_complex* const A[],
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            rocblas_float_complex* ipiv,
-                                            rocblas_stride stP,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_geqp3(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_float_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      rocblas_float_complex* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_int bc)
 {
-    return GEQRF ? rocsolver_cgeqrf_batched(handle, m, n, A, lda, ipiv, stP, bc)
-                 : rocsolver_cgeqr2_batched(handle, m, n, A, lda, ipiv, stP, bc);
+    return rocsolver_cgeqp3_batched(handle, m, n, A, lda, jpvt, stJ, ipiv, stP, bc);
 }
 
-inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
-                                            bool GEQRF,
-                                            rocblas_handle handle,
-                                            rocblas_int m,
-                                            rocblas_int n,
-                                            rocblas_double_complex* const A[],
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            rocblas_double_complex* ipiv,
-                                            rocblas_stride stP,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_geqp3(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_double_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      rocblas_double_complex* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_int bc)
 {
-    return GEQRF ? rocsolver_zgeqrf_batched(handle, m, n, A, lda, ipiv, stP, bc)
-                 : rocsolver_zgeqr2_batched(handle, m, n, A, lda, ipiv, stP, bc);
+    return rocsolver_zgeqp3_batched(handle, m, n, A, lda, jpvt, stJ, ipiv, stP, bc);
 }
 
-// ptr_batched
-inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
-                                            bool GEQRF,
-                                            rocblas_handle handle,
-                                            rocblas_int m,
-                                            rocblas_int n,
-                                            float* const A[],
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            float* const ipiv[],
-                                            rocblas_stride stP,
-                                            rocblas_int bc)
+/********************************************************/
+
+/******************** GEQRT ********************/
+inline rocblas_status rocsolver_geqrt(rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nb,
+                                      float* A,
+                                      rocblas_int lda,
+                                      float* T,
+                                      rocblas_int ldt)
 {
-    return GEQRF ? rocsolver_sgeqrf_ptr_batched(handle, m, n, A, lda, ipiv, bc)
-                 : rocblas_status_not_implemented;
+    return rocsolver_sgeqrt(handle, m, n, nb, A, lda, T, ldt);
 }
 
-inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
-                                            bool GEQRF,
-                                            rocblas_handle handle,
-                                            rocblas_int m,
-                                            rocblas_int n,
-                                            double* const A[],
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            double* const ipiv[],
-                                            rocblas_stride stP,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_geqrt(rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nb,
+                                      double* A,
+                                      rocblas_int lda,
+                                      double* T,
+                                      rocblas_int ldt)
 {
-    return GEQRF ? rocsolver_dgeqrf_ptr_batched(handle, m, n, A, lda, ipiv, bc)
-                 : rocblas_status_not_implemented;
+    return rocsolver_dgeqrt(handle, m, n, nb, A, lda, T, ldt);
 }
 
-inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
-                                            bool GEQRF,
-                                            rocblas_handle handle,
-                                            rocblas_int m,
-                                            rocblas_int n,
-                                            rocblas_float_complex* const A[],
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            rocblas_float_complex* const ipiv[],
-                                            rocblas_stride stP,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_geqrt(rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nb,
+                                      rocblas_float_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_float_complex* T,
+                                      rocblas_int ldt)
 {
-    return GEQRF ? rocsolver_cgeqrf_ptr_batched(handle, m, n, A, lda, ipiv, bc)
-                 : rocblas_status_not_implemented;
+    return rocsolver_cgeqrt(handle, m, n, nb, A, lda, T, ldt);
 }
 
-inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
-                                            bool GEQRF,
-                                            rocblas_handle handle,
-                                            rocblas_int m,
-                                            rocblas_int n,
-                                            rocblas_double_complex* const A[],
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            rocblas_double_complex* const ipiv[],
-                                            rocblas_stride stP,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_geqrt(rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nb,
+                                      rocblas_double_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_double_complex* T,
+                                      rocblas_int ldt)
 {
-    return GEQRF ? rocsolver_zgeqrf_ptr_batched(handle, m, n, A, lda, ipiv, bc)
-                 : rocblas_status_not_implemented;
+    return rocsolver_zgeqrt(handle, m, n, nb, A, lda, T, ldt);
 }
 /********************************************************/
 
@@ -6899,11 +10974,52 @@ inline rocblas_status rocsolver_gels(bool STRIDED,
                                      rocblas_int* info,
                                      rocblas_int bc)
 {
-    if(STRIDED)
-        return rocsolver_cgels_strided_batched(handle, trans, m, n, nrhs, A, lda, stA, B, ldb, stB,
-                                               info, bc);
-    else
-        return rocsolver_cgels(handle, trans, m, n, nrhs, A, lda, B, ldb, info);
+    if(STRIDED)
+        return rocsolver_cgels_strided_batched(handle, trans, m, n, nrhs, A, lda, stA, B, ldb, stB,
+                                               info, bc);
+    else
+        return rocsolver_cgels(handle, trans, m, n, nrhs, A, lda, B, ldb, info);
+}
+
+inline rocblas_status rocsolver_gels(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_operation trans,
+                                     rocblas_int m,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     rocblas_double_complex* A,
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_double_complex* B,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_zgels_strided_batched(handle, trans, m, n, nrhs, A, lda, stA, B, ldb, stB,
+                                               info, bc);
+    else
+        return rocsolver_zgels(handle, trans, m, n, nrhs, A, lda, B, ldb, info);
+}
+
+// batched
+inline rocblas_status rocsolver_gels(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_operation trans,
+                                     rocblas_int m,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     float* const A[],
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     float* const B[],
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    return rocsolver_sgels_batched(handle, trans, m, n, nrhs, A, lda, B, ldb, info, bc);
 }
 
 inline rocblas_status rocsolver_gels(bool STRIDED,
@@ -6912,39 +11028,34 @@ inline rocblas_status rocsolver_gels(bool STRIDED,
                                      rocblas_int m,
                                      rocblas_int n,
                                      rocblas_int nrhs,
-                                     rocblas_double_complex* A,
+                                     double* const A[],
                                      rocblas_int lda,
                                      rocblas_stride stA,
-                                     rocblas_double_complex* B,
+                                     double* const B[],
                                      rocblas_int ldb,
                                      rocblas_stride stB,
                                      rocblas_int* info,
                                      rocblas_int bc)
 {
-    if(STRIDED)
-        return rocsolver_zgels_strided_batched(handle, trans, m, n, nrhs, A, lda, stA, B, ldb, stB,
-                                               info, bc);
-    else
-        return rocsolver_zgels(handle, trans, m, n, nrhs, A, lda, B, ldb, info);
+    return rocsolver_dgels_batched(handle, trans, m, n, nrhs, A, lda, B, ldb, info, bc);
 }
 
-// batched
 inline rocblas_status rocsolver_gels(bool STRIDED,
                                      rocblas_handle handle,
                                      rocblas_operation trans,
                                      rocblas_int m,
                                      rocblas_int n,
                                      rocblas_int nrhs,
-                                     float* const A[],
+                                     rocblas_float_complex* const A[],
                                      rocblas_int lda,
                                      rocblas_stride stA,
-                                     float* const B[],
+                                     rocblas_float_complex* const B[],
                                      rocblas_int ldb,
                                      rocblas_stride stB,
                                      rocblas_int* info,
                                      rocblas_int bc)
 {
-    return rocsolver_sgels_batched(handle, trans, m, n, nrhs, A, lda, B, ldb, info, bc);
+    return rocsolver_cgels_batched(handle, trans, m, n, nrhs, A, lda, B, ldb, info, bc);
 }
 
 inline rocblas_status rocsolver_gels(bool STRIDED,
@@ -6953,52 +11064,388 @@ inline rocblas_status rocsolver_gels(bool STRIDED,
                                      rocblas_int m,
                                      rocblas_int n,
                                      rocblas_int nrhs,
-                                     double* const A[],
+                                     rocblas_double_complex* const A[],
                                      rocblas_int lda,
                                      rocblas_stride stA,
-                                     double* const B[],
+                                     rocblas_double_complex* const B[],
                                      rocblas_int ldb,
                                      rocblas_stride stB,
                                      rocblas_int* info,
                                      rocblas_int bc)
 {
-    return rocsolver_dgels_batched(handle, trans, m, n, nrhs, A, lda, B, ldb, info, bc);
+    return rocsolver_zgels_batched(handle, trans, m, n, nrhs, A, lda, B, ldb, info, bc);
+}
+/********************************************************/
+
+/******************** GELSD ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_gelsd(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      float* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      float* S,
+                                      rocblas_stride stS,
+                                      float rcond,
+                                      rocblas_int* rank,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_sgelsd_strided_batched(handle, m, n, nrhs, A, lda, stA, B, ldb, stB, S,
+                                                stS, rcond, rank, info, bc);
+    else
+        return rocsolver_sgelsd(handle, m, n, nrhs, A, lda, B, ldb, S, rcond, rank, info);
+}
+
+inline rocblas_status rocsolver_gelsd(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      double* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      double* S,
+                                      rocblas_stride stS,
+                                      double rcond,
+                                      rocblas_int* rank,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_dgelsd_strided_batched(handle, m, n, nrhs, A, lda, stA, B, ldb, stB, S,
+                                                stS, rcond, rank, info, bc);
+    else
+        return rocsolver_dgelsd(handle, m, n, nrhs, A, lda, B, ldb, S, rcond, rank, info);
+}
+
+inline rocblas_status rocsolver_gelsd(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_float_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_float_complex* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      float* S,
+                                      rocblas_stride stS,
+                                      float rcond,
+                                      rocblas_int* rank,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_cgelsd_strided_batched(handle, m, n, nrhs, A, lda, stA, B, ldb, stB, S,
+                                                stS, rcond, rank, info, bc);
+    else
+        return rocsolver_cgelsd(handle, m, n, nrhs, A, lda, B, ldb, S, rcond, rank, info);
+}
+
+inline rocblas_status rocsolver_gelsd(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_double_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_double_complex* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      double* S,
+                                      rocblas_stride stS,
+                                      double rcond,
+                                      rocblas_int* rank,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_zgelsd_strided_batched(handle, m, n, nrhs, A, lda, stA, B, ldb, stB, S,
+                                                stS, rcond, rank, info, bc);
+    else
+        return rocsolver_zgelsd(handle, m, n, nrhs, A, lda, B, ldb, S, rcond, rank, info);
+}
+
+// batched
+inline rocblas_status rocsolver_gelsd(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      float* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      float* S,
+                                      rocblas_stride stS,
+                                      float rcond,
+                                      rocblas_int* rank,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return rocsolver_sgelsd_batched(handle, m, n, nrhs, A, lda, B, ldb, S, stS, rcond, rank, info,
+                                    bc);
+}
+
+inline rocblas_status rocsolver_gelsd(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      double* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      double* S,
+                                      rocblas_stride stS,
+                                      double rcond,
+                                      rocblas_int* rank,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return rocsolver_dgelsd_batched(handle, m, n, nrhs, A, lda, B, ldb, S, stS, rcond, rank, info,
+                                    bc);
+}
+
+inline rocblas_status rocsolver_gelsd(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_float_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_float_complex* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      float* S,
+                                      rocblas_stride stS,
+                                      float rcond,
+                                      rocblas_int* rank,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return rocsolver_cgelsd_batched(handle, m, n, nrhs, A, lda, B, ldb, S, stS, rcond, rank, info,
+                                    bc);
+}
+
+inline rocblas_status rocsolver_gelsd(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_double_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_double_complex* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      double* S,
+                                      rocblas_stride stS,
+                                      double rcond,
+                                      rocblas_int* rank,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return rocsolver_zgelsd_batched(handle, m, n, nrhs, A, lda, B, ldb, S, stS, rcond, rank, info,
+                                    bc);
+}
+/********************************************************/
+
+/******************** GELSY ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_gelsy(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      float* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      float rcond,
+                                      rocblas_int* rank,
+                                      rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_sgelsy_strided_batched(handle, m, n, nrhs, A, lda, stA, B, ldb, stB, jpvt,
+                                                stJ, rcond, rank, bc);
+    else
+        return rocsolver_sgelsy(handle, m, n, nrhs, A, lda, B, ldb, jpvt, rcond, rank);
+}
+
+inline rocblas_status rocsolver_gelsy(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      double* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      double rcond,
+                                      rocblas_int* rank,
+                                      rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_dgelsy_strided_batched(handle, m, n, nrhs, A, lda, stA, B, ldb, stB, jpvt,
+                                                stJ, rcond, rank, bc);
+    else
+        return rocsolver_dgelsy(handle, m, n, nrhs, A, lda, B, ldb, jpvt, rcond, rank);
+}
+
+inline rocblas_status rocsolver_gelsy(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_float_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_float_complex* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      float rcond,
+                                      rocblas_int* rank,
+                                      rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_cgelsy_strided_batched(handle, m, n, nrhs, A, lda, stA, B, ldb, stB, jpvt,
+                                                stJ, rcond, rank, bc);
+    else
+        return rocsolver_cgelsy(handle, m, n, nrhs, A, lda, B, ldb, jpvt, rcond, rank);
+}
+
+inline rocblas_status rocsolver_gelsy(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_double_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_double_complex* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      double rcond,
+                                      rocblas_int* rank,
+                                      rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_zgelsy_strided_batched(handle, m, n, nrhs, A, lda, stA, B, ldb, stB, jpvt,
+                                                stJ, rcond, rank, bc);
+    else
+        return rocsolver_zgelsy(handle, m, n, nrhs, A, lda, B, ldb, jpvt, rcond, rank);
+}
+
+// batched
+inline rocblas_status rocsolver_gelsy(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      float* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      float rcond,
+                                      rocblas_int* rank,
+                                      rocblas_int bc)
+{
+    return rocsolver_sgelsy_batched(handle, m, n, nrhs, A, lda, B, ldb, jpvt, stJ, rcond, rank, bc);
 }
 
-inline rocblas_status rocsolver_gels(bool STRIDED,
-                                     rocblas_handle handle,
-                                     rocblas_operation trans,
-                                     rocblas_int m,
-                                     rocblas_int n,
-                                     rocblas_int nrhs,
-                                     rocblas_float_complex* const A[],
-                                     rocblas_int lda,
-                                     rocblas_stride stA,
-                                     rocblas_float_complex* const B[],
-                                     rocblas_int ldb,
-                                     rocblas_stride stB,
-                                     rocblas_int* info,
-                                     rocblas_int bc)
+inline rocblas_status rocsolver_gelsy(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      double* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      double rcond,
+                                      rocblas_int* rank,
+                                      rocblas_int bc)
 {
-    return rocsolver_cgels_batched(handle, trans, m, n, nrhs, A, lda, B, ldb, info, bc);
+    return rocsolver_dgelsy_batched(handle, m, n, nrhs, A, lda, B, ldb, jpvt, stJ, rcond, rank, bc);
 }
 
-inline rocblas_status rocsolver_gels(bool STRIDED,
-                                     rocblas_handle handle,
-                                     rocblas_operation trans,
-                                     rocblas_int m,
-                                     rocblas_int n,
-                                     rocblas_int nrhs,
-                                     rocblas_double_complex* const A[],
-                                     rocblas_int lda,
-                                     rocblas_stride stA,
-                                     rocblas_double_complex* const B[],
-                                     rocblas_int ldb,
-                                     rocblas_stride stB,
-                                     rocblas_int* info,
-                                     rocblas_int bc)
+inline rocblas_status rocsolver_gelsy(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_float_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_float_complex* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      float rcond,
+                                      rocblas_int* rank,
+                                      rocblas_int bc)
 {
-    return rocsolver_zgels_batched(handle, trans, m, n, nrhs, A, lda, B, ldb, info, bc);
+    return rocsolver_cgelsy_batched(handle, m, n, nrhs, A, lda, B, ldb, jpvt, stJ, rcond, rank, bc);
+}
+
+inline rocblas_status rocsolver_gelsy(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_double_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_double_complex* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      double rcond,
+                                      rocblas_int* rank,
+                                      rocblas_int bc)
+{
+    return rocsolver_zgelsy_batched(handle, m, n, nrhs, A, lda, B, ldb, jpvt, stJ, rcond, rank, bc);
 }
 /********************************************************/
 
@@ -7186,6 +11633,98 @@ inline rocblas_status rocsolver_gels_outofplace(bool STRIDED,
 }
 /********************************************************/
 
+/******************** GELS_MIXED ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_gels_mixed(bool STRIDED,
+                                           rocblas_handle handle,
+                                           rocblas_int m,
+                                           rocblas_int n,
+                                           rocblas_int nrhs,
+                                           double* A,
+                                           rocblas_int lda,
+                                           rocblas_stride stA,
+                                           double* B,
+                                           rocblas_int ldb,
+                                           rocblas_stride stB,
+                                           double* X,
+                                           rocblas_int ldx,
+                                           rocblas_stride stX,
+                                           rocblas_int* iter,
+                                           rocblas_int* info,
+                                           rocblas_int bc)
+{
+    return STRIDED ? rocsolver_dsgels_strided_batched(handle, m, n, nrhs, A, lda, stA, B, ldb, stB,
+                                                      X, ldx, stX, iter, info, bc)
+                   : rocsolver_dsgels(handle, m, n, nrhs, A, lda, B, ldb, X, ldx, iter, info);
+}
+
+inline rocblas_status rocsolver_gels_mixed(bool STRIDED,
+                                           rocblas_handle handle,
+                                           rocblas_int m,
+                                           rocblas_int n,
+                                           rocblas_int nrhs,
+                                           rocblas_double_complex* A,
+                                           rocblas_int lda,
+                                           rocblas_stride stA,
+                                           rocblas_double_complex* B,
+                                           rocblas_int ldb,
+                                           rocblas_stride stB,
+                                           rocblas_double_complex* X,
+                                           rocblas_int ldx,
+                                           rocblas_stride stX,
+                                           rocblas_int* iter,
+                                           rocblas_int* info,
+                                           rocblas_int bc)
+{
+    return STRIDED ? rocsolver_zcgels_strided_batched(handle, m, n, nrhs, A, lda, stA, B, ldb, stB,
+                                                      X, ldx, stX, iter, info, bc)
+                   : rocsolver_zcgels(handle, m, n, nrhs, A, lda, B, ldb, X, ldx, iter, info);
+}
+
+// batched
+inline rocblas_status rocsolver_gels_mixed(bool STRIDED,
+                                           rocblas_handle handle,
+                                           rocblas_int m,
+                                           rocblas_int n,
+                                           rocblas_int nrhs,
+                                           double* const A[],
+                                           rocblas_int lda,
+                                           rocblas_stride stA,
+                                           double* const B[],
+                                           rocblas_int ldb,
+                                           rocblas_stride stB,
+                                           double* const X[],
+                                           rocblas_int ldx,
+                                           rocblas_stride stX,
+                                           rocblas_int* iter,
+                                           rocblas_int* info,
+                                           rocblas_int bc)
+{
+    return rocsolver_dsgels_batched(handle, m, n, nrhs, A, lda, B, ldb, X, ldx, iter, info, bc);
+}
+
+inline rocblas_status rocsolver_gels_mixed(bool STRIDED,
+                                           rocblas_handle handle,
+                                           rocblas_int m,
+                                           rocblas_int n,
+                                           rocblas_int nrhs,
+                                           rocblas_double_complex* const A[],
+                                           rocblas_int lda,
+                                           rocblas_stride stA,
+                                           rocblas_double_complex* const B[],
+                                           rocblas_int ldb,
+                                           rocblas_stride stB,
+                                           rocblas_double_complex* const X[],
+                                           rocblas_int ldx,
+                                           rocblas_stride stX,
+                                           rocblas_int* iter,
+                                           rocblas_int* info,
+                                           rocblas_int bc)
+{
+    return rocsolver_zcgels_batched(handle, m, n, nrhs, A, lda, B, ldb, X, ldx, iter, info, bc);
+}
+/********************************************************/
+
 /******************** GEBD2_GEBRD ********************/
 // normal and strided_batched
 inline rocblas_status rocsolver_gebd2_gebrd(bool STRIDED,
@@ -7291,106 +11830,246 @@ inline rocblas_status rocsolver_gebd2_gebrd(bool STRIDED,
                                             rocblas_int bc)
 {
     if(STRIDED)
-        return GEBRD ? rocsolver_zgebrd_strided_batched(handle, m, n, A, lda, stA, D, stD, E, stE,
-                                                        tauq, stQ, taup, stP, bc)
-                     : rocsolver_zgebd2_strided_batched(handle, m, n, A, lda, stA, D, stD, E, stE,
-                                                        tauq, stQ, taup, stP, bc);
+        return GEBRD ? rocsolver_zgebrd_strided_batched(handle, m, n, A, lda, stA, D, stD, E, stE,
+                                                        tauq, stQ, taup, stP, bc)
+                     : rocsolver_zgebd2_strided_batched(handle, m, n, A, lda, stA, D, stD, E, stE,
+                                                        tauq, stQ, taup, stP, bc);
+    else
+        return GEBRD ? rocsolver_zgebrd(handle, m, n, A, lda, D, E, tauq, taup)
+                     : rocsolver_zgebd2(handle, m, n, A, lda, D, E, tauq, taup);
+}
+
+// batched
+inline rocblas_status rocsolver_gebd2_gebrd(bool STRIDED,
+                                            bool GEBRD,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            float* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float* D,
+                                            rocblas_stride stD,
+                                            float* E,
+                                            rocblas_stride stE,
+                                            float* tauq,
+                                            rocblas_stride stQ,
+                                            float* taup,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    return GEBRD
+        ? rocsolver_sgebrd_batched(handle, m, n, A, lda, D, stD, E, stE, tauq, stQ, taup, stP, bc)
+        : rocsolver_sgebd2_batched(handle, m, n, A, lda, D, stD, E, stE, tauq, stQ, taup, stP, bc);
+}
+
+inline rocblas_status rocsolver_gebd2_gebrd(bool STRIDED,
+                                            bool GEBRD,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            double* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double* D,
+                                            rocblas_stride stD,
+                                            double* E,
+                                            rocblas_stride stE,
+                                            double* tauq,
+                                            rocblas_stride stQ,
+                                            double* taup,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    return GEBRD
+        ? rocsolver_dgebrd_batched(handle, m, n, A, lda, D, stD, E, stE, tauq, stQ, taup, stP, bc)
+        : rocsolver_dgebd2_batched(handle, m, n, A, lda, D, stD, E, stE, tauq, stQ, taup, stP, bc);
+}
+
+inline rocblas_status rocsolver_gebd2_gebrd(bool STRIDED,
+                                            bool GEBRD,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_float_complex* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float* D,
+                                            rocblas_stride stD,
+                                            float* E,
+                                            rocblas_stride stE,
+                                            rocblas_float_complex* tauq,
+                                            rocblas_stride stQ,
+                                            rocblas_float_complex* taup,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    return GEBRD
+        ? rocsolver_cgebrd_batched(handle, m, n, A, lda, D, stD, E, stE, tauq, stQ, taup, stP, bc)
+        : rocsolver_cgebd2_batched(handle, m, n, A, lda, D, stD, E, stE, tauq, stQ, taup, stP, bc);
+}
+
+inline rocblas_status rocsolver_gebd2_gebrd(bool STRIDED,
+                                            bool GEBRD,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_double_complex* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double* D,
+                                            rocblas_stride stD,
+                                            double* E,
+                                            rocblas_stride stE,
+                                            rocblas_double_complex* tauq,
+                                            rocblas_stride stQ,
+                                            rocblas_double_complex* taup,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    return GEBRD
+        ? rocsolver_zgebrd_batched(handle, m, n, A, lda, D, stD, E, stE, tauq, stQ, taup, stP, bc)
+        : rocsolver_zgebd2_batched(handle, m, n, A, lda, D, stD, E, stE, tauq, stQ, taup, stP, bc);
+}
+/********************************************************/
+
+/******************** GEHD2_GEHRD ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_gehd2_gehrd(bool STRIDED,
+                                            bool GEHRD,
+                                            rocblas_handle handle,
+                                            rocblas_int n,
+                                            float* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float* tau,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return GEHRD ? rocsolver_sgehrd_strided_batched(handle, n, A, lda, stA, tau, stP, bc)
+                     : rocsolver_sgehd2_strided_batched(handle, n, A, lda, stA, tau, stP, bc);
+    else
+        return GEHRD ? rocsolver_sgehrd(handle, n, A, lda, tau)
+                     : rocsolver_sgehd2(handle, n, A, lda, tau);
+}
+
+inline rocblas_status rocsolver_gehd2_gehrd(bool STRIDED,
+                                            bool GEHRD,
+                                            rocblas_handle handle,
+                                            rocblas_int n,
+                                            double* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double* tau,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return GEHRD ? rocsolver_dgehrd_strided_batched(handle, n, A, lda, stA, tau, stP, bc)
+                     : rocsolver_dgehd2_strided_batched(handle, n, A, lda, stA, tau, stP, bc);
+    else
+        return GEHRD ? rocsolver_dgehrd(handle, n, A, lda, tau)
+                     : rocsolver_dgehd2(handle, n, A, lda, tau);
+}
+
+inline rocblas_status rocsolver_gehd2_gehrd(bool STRIDED,
+                                            bool GEHRD,
+                                            rocblas_handle handle,
+                                            rocblas_int n,
+                                            rocblas_float_complex* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_float_complex* tau,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return GEHRD ? rocsolver_cgehrd_strided_batched(handle, n, A, lda, stA, tau, stP, bc)
+                     : rocsolver_cgehd2_strided_batched(handle, n, A, lda, stA, tau, stP, bc);
+    else
+        return GEHRD ? rocsolver_cgehrd(handle, n, A, lda, tau)
+                     : rocsolver_cgehd2(handle, n, A, lda, tau);
+}
+
+inline rocblas_status rocsolver_gehd2_gehrd(bool STRIDED,
+                                            bool GEHRD,
+                                            rocblas_handle handle,
+                                            rocblas_int n,
+                                            rocblas_double_complex* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_double_complex* tau,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return GEHRD ? rocsolver_zgehrd_strided_batched(handle, n, A, lda, stA, tau, stP, bc)
+                     : rocsolver_zgehd2_strided_batched(handle, n, A, lda, stA, tau, stP, bc);
     else
-        return GEBRD ? rocsolver_zgebrd(handle, m, n, A, lda, D, E, tauq, taup)
-                     : rocsolver_zgebd2(handle, m, n, A, lda, D, E, tauq, taup);
+        return GEHRD ? rocsolver_zgehrd(handle, n, A, lda, tau)
+                     : rocsolver_zgehd2(handle, n, A, lda, tau);
 }
 
 // batched
-inline rocblas_status rocsolver_gebd2_gebrd(bool STRIDED,
-                                            bool GEBRD,
+inline rocblas_status rocsolver_gehd2_gehrd(bool STRIDED,
+                                            bool GEHRD,
                                             rocblas_handle handle,
-                                            rocblas_int m,
                                             rocblas_int n,
                                             float* const A[],
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            float* D,
-                                            rocblas_stride stD,
-                                            float* E,
-                                            rocblas_stride stE,
-                                            float* tauq,
-                                            rocblas_stride stQ,
-                                            float* taup,
+                                            float* tau,
                                             rocblas_stride stP,
                                             rocblas_int bc)
 {
-    return GEBRD
-        ? rocsolver_sgebrd_batched(handle, m, n, A, lda, D, stD, E, stE, tauq, stQ, taup, stP, bc)
-        : rocsolver_sgebd2_batched(handle, m, n, A, lda, D, stD, E, stE, tauq, stQ, taup, stP, bc);
+    return GEHRD ? rocsolver_sgehrd_batched(handle, n, A, lda, tau, stP, bc)
+                 : rocsolver_sgehd2_batched(handle, n, A, lda, tau, stP, bc);
 }
 
-inline rocblas_status rocsolver_gebd2_gebrd(bool STRIDED,
-                                            bool GEBRD,
+inline rocblas_status rocsolver_gehd2_gehrd(bool STRIDED,
+                                            bool GEHRD,
                                             rocblas_handle handle,
-                                            rocblas_int m,
                                             rocblas_int n,
                                             double* const A[],
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            double* D,
-                                            rocblas_stride stD,
-                                            double* E,
-                                            rocblas_stride stE,
-                                            double* tauq,
-                                            rocblas_stride stQ,
-                                            double* taup,
+                                            double* tau,
                                             rocblas_stride stP,
                                             rocblas_int bc)
 {
-    return GEBRD
-        ? rocsolver_dgebrd_batched(handle, m, n, A, lda, D, stD, E, stE, tauq, stQ, taup, stP, bc)
-        : rocsolver_dgebd2_batched(handle, m, n, A, lda, D, stD, E, stE, tauq, stQ, taup, stP, bc);
+    return GEHRD ? rocsolver_dgehrd_batched(handle, n, A, lda, tau, stP, bc)
+                 : rocsolver_dgehd2_batched(handle, n, A, lda, tau, stP, bc);
 }
 
-inline rocblas_status rocsolver_gebd2_gebrd(bool STRIDED,
-                                            bool GEBRD,
+inline rocblas_status rocsolver_gehd2_gehrd(bool STRIDED,
+                                            bool GEHRD,
                                             rocblas_handle handle,
-                                            rocblas_int m,
                                             rocblas_int n,
                                             rocblas_float_complex* const A[],
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            float* D,
-                                            rocblas_stride stD,
-                                            float* E,
-                                            rocblas_stride stE,
-                                            rocblas_float_complex* tauq,
-                                            rocblas_stride stQ,
-                                            rocblas_float_complex* taup,
+                                            rocblas_float_complex* tau,
                                             rocblas_stride stP,
                                             rocblas_int bc)
 {
-    return GEBRD
-        ? rocsolver_cgebrd_batched(handle, m, n, A, lda, D, stD, E, stE, tauq, stQ, taup, stP, bc)
-        : rocsolver_cgebd2_batched(handle, m, n, A, lda, D, stD, E, stE, tauq, stQ, taup, stP, bc);
+    return GEHRD ? rocsolver_cgehrd_batched(handle, n, A, lda, tau, stP, bc)
+                 : rocsolver_cgehd2_batched(handle, n, A, lda, tau, stP, bc);
 }
 
-inline rocblas_status rocsolver_gebd2_gebrd(bool STRIDED,
-                                            bool GEBRD,
+inline rocblas_status rocsolver_gehd2_gehrd(bool STRIDED,
+                                            bool GEHRD,
                                             rocblas_handle handle,
-                                            rocblas_int m,
                                             rocblas_int n,
                                             rocblas_double_complex* const A[],
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            double* D,
-                                            rocblas_stride stD,
-                                            double* E,
-                                            rocblas_stride stE,
-                                            rocblas_double_complex* tauq,
-                                            rocblas_stride stQ,
-                                            rocblas_double_complex* taup,
+                                            rocblas_double_complex* tau,
                                             rocblas_stride stP,
                                             rocblas_int bc)
 {
-    return GEBRD
-        ? rocsolver_zgebrd_batched(handle, m, n, A, lda, D, stD, E, stE, tauq, stQ, taup, stP, bc)
-        : rocsolver_zgebd2_batched(handle, m, n, A, lda, D, stD, E, stE, tauq, stQ, taup, stP, bc);
+    return GEHRD ? rocsolver_zgehrd_batched(handle, n, A, lda, tau, stP, bc)
+                 : rocsolver_zgehd2_batched(handle, n, A, lda, tau, stP, bc);
 }
 /********************************************************/
 
@@ -7906,6 +12585,162 @@ inline rocblas_status rocsolver_syev_heev(bool STRIDED,
 }
 /********************************************************/
 
+/******************** SYEV_AUTO/HEEV_AUTO ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_syev_heev_auto(bool STRIDED,
+                                               rocblas_handle handle,
+                                               rocblas_evect evect,
+                                               rocblas_fill uplo,
+                                               rocblas_int n,
+                                               float* A,
+                                               rocblas_int lda,
+                                               rocblas_stride stA,
+                                               float* D,
+                                               rocblas_stride stD,
+                                               float* E,
+                                               rocblas_stride stE,
+                                               rocblas_int* info,
+                                               rocblas_int bc)
+{
+    return STRIDED ? rocsolver_ssyev_auto_strided_batched(handle, evect, uplo, n, A, lda, stA, D,
+                                                          stD, E, stE, info, bc)
+                   : rocsolver_ssyev_auto(handle, evect, uplo, n, A, lda, D, E, info);
+}
+
+inline rocblas_status rocsolver_syev_heev_auto(bool STRIDED,
+                                               rocblas_handle handle,
+                                               rocblas_evect evect,
+                                               rocblas_fill uplo,
+                                               rocblas_int n,
+                                               double* A,
+                                               rocblas_int lda,
+                                               rocblas_stride stA,
+                                               double* D,
+                                               rocblas_stride stD,
+                                               double* E,
+                                               rocblas_stride stE,
+                                               rocblas_int* info,
+                                               rocblas_int bc)
+{
+    return STRIDED ? rocsolver_dsyev_auto_strided_batched(handle, evect, uplo, n, A, lda, stA, D,
+                                                          stD, E, stE, info, bc)
+                   : rocsolver_dsyev_auto(handle, evect, uplo, n, A, lda, D, E, info);
+}
+
+inline rocblas_status rocsolver_syev_heev_auto(bool STRIDED,
+                                               rocblas_handle handle,
+                                               rocblas_evect evect,
+                                               rocblas_fill uplo,
+                                               rocblas_int n,
+                                               rocblas_float_complex* A,
+                                               rocblas_int lda,
+                                               rocblas_stride stA,
+                                               float* D,
+                                               rocblas_stride stD,
+                                               float* E,
+                                               rocblas_stride stE,
+                                               rocblas_int* info,
+                                               rocblas_int bc)
+{
+    return STRIDED ? rocsolver_cheev_auto_strided_batched(handle, evect, uplo, n, A, lda, stA, D,
+                                                          stD, E, stE, info, bc)
+                   : rocsolver_cheev_auto(handle, evect, uplo, n, A, lda, D, E, info);
+}
+
+inline rocblas_status rocsolver_syev_heev_auto(bool STRIDED,
+                                               rocblas_handle handle,
+                                               rocblas_evect evect,
+                                               rocblas_fill uplo,
+                                               rocblas_int n,
+                                               rocblas_double_complex* A,
+                                               rocblas_int lda,
+                                               rocblas_stride stA,
+                                               double* D,
+                                               rocblas_stride stD,
+                                               double* E,
+                                               rocblas_stride stE,
+                                               rocblas_int* info,
+                                               rocblas_int bc)
+{
+    return STRIDED ? rocsolver_zheev_auto_strided_batched(handle, evect, uplo, n, A, lda, stA, D,
+                                                          stD, E, stE, info, bc)
+                   : rocsolver_zheev_auto(handle, evect, uplo, n, A, lda, D, E, info);
+}
+
+// batched
+inline rocblas_status rocsolver_syev_heev_auto(bool STRIDED,
+                                               rocblas_handle handle,
+                                               rocblas_evect evect,
+                                               rocblas_fill uplo,
+                                               rocblas_int n,
+                                               float* const A[],
+                                               rocblas_int lda,
+                                               rocblas_stride stA,
+                                               float* D,
+                                               rocblas_stride stD,
+                                               float* E,
+                                               rocblas_stride stE,
+                                               rocblas_int* info,
+                                               rocblas_int bc)
+{
+    return rocsolver_ssyev_auto_batched(handle, evect, uplo, n, A, lda, D, stD, E, stE, info, bc);
+}
+
+inline rocblas_status rocsolver_syev_heev_auto(bool STRIDED,
+                                               rocblas_handle handle,
+                                               rocblas_evect evect,
+                                               rocblas_fill uplo,
+                                               rocblas_int n,
+                                               double* const A[],
+                                               rocblas_int lda,
+                                               rocblas_stride stA,
+                                               double* D,
+                                               rocblas_stride stD,
+                                               double* E,
+                                               rocblas_stride stE,
+                                               rocblas_int* info,
+                                               rocblas_int bc)
+{
+    return rocsolver_dsyev_auto_batched(handle, evect, uplo, n, A, lda, D, stD, E, stE, info, bc);
+}
+
+inline rocblas_status rocsolver_syev_heev_auto(bool STRIDED,
+                                               rocblas_handle handle,
+                                               rocblas_evect evect,
+                                               rocblas_fill uplo,
+                                               rocblas_int n,
+                                               rocblas_float_complex* const A[],
+                                               rocblas_int lda,
+                                               rocblas_stride stA,
+                                               float* D,
+                                               rocblas_stride stD,
+                                               float* E,
+                                               rocblas_stride stE,
+                                               rocblas_int* info,
+                                               rocblas_int bc)
+{
+    return rocsolver_cheev_auto_batched(handle, evect, uplo, n, A, lda, D, stD, E, stE, info, bc);
+}
+
+inline rocblas_status rocsolver_syev_heev_auto(bool STRIDED,
+                                               rocblas_handle handle,
+                                               rocblas_evect evect,
+                                               rocblas_fill uplo,
+                                               rocblas_int n,
+                                               rocblas_double_complex* const A[],
+                                               rocblas_int lda,
+                                               rocblas_stride stA,
+                                               double* D,
+                                               rocblas_stride stD,
+                                               double* E,
+                                               rocblas_stride stE,
+                                               rocblas_int* info,
+                                               rocblas_int bc)
+{
+    return rocsolver_zheev_auto_batched(handle, evect, uplo, n, A, lda, D, stD, E, stE, info, bc);
+}
+/********************************************************/
+
 /******************** SYEVD/HEEVD ********************/
 // normal and strided_batched
 inline rocblas_status rocsolver_syevd_heevd(bool STRIDED,
@@ -8618,6 +13453,284 @@ inline rocblas_status rocsolver_syevj_heevj(bool STRIDED,
 }
 /********************************************************/
 
+/******************** SYEVS/HEEVS ********************/
+inline rocblas_status rocsolver_syevs_heevs(rocblas_handle handle,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            float* A,
+                                            rocblas_int lda,
+                                            rocblas_int nev,
+                                            rocblas_int k,
+                                            float* X,
+                                            rocblas_int ldx,
+                                            float tol,
+                                            rocblas_int max_iter,
+                                            rocblas_int* n_iter,
+                                            float* W,
+                                            rocblas_int* info)
+{
+    return rocsolver_ssyevs(handle, uplo, n, A, lda, nev, k, X, ldx, tol, max_iter, n_iter, W,
+                            info);
+}
+
+inline rocblas_status rocsolver_syevs_heevs(rocblas_handle handle,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            double* A,
+                                            rocblas_int lda,
+                                            rocblas_int nev,
+                                            rocblas_int k,
+                                            double* X,
+                                            rocblas_int ldx,
+                                            double tol,
+                                            rocblas_int max_iter,
+                                            rocblas_int* n_iter,
+                                            double* W,
+                                            rocblas_int* info)
+{
+    return rocsolver_dsyevs(handle, uplo, n, A, lda, nev, k, X, ldx, tol, max_iter, n_iter, W,
+                            info);
+}
+
+inline rocblas_status rocsolver_syevs_heevs(rocblas_handle handle,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            rocblas_float_complex* A,
+                                            rocblas_int lda,
+                                            rocblas_int nev,
+                                            rocblas_int k,
+                                            rocblas_float_complex* X,
+                                            rocblas_int ldx,
+                                            float tol,
+                                            rocblas_int max_iter,
+                                            rocblas_int* n_iter,
+                                            float* W,
+                                            rocblas_int* info)
+{
+    return rocsolver_cheevs(handle, uplo, n, A, lda, nev, k, X, ldx, tol, max_iter, n_iter, W,
+                            info);
+}
+
+inline rocblas_status rocsolver_syevs_heevs(rocblas_handle handle,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            rocblas_double_complex* A,
+                                            rocblas_int lda,
+                                            rocblas_int nev,
+                                            rocblas_int k,
+                                            rocblas_double_complex* X,
+                                            rocblas_int ldx,
+                                            double tol,
+                                            rocblas_int max_iter,
+                                            rocblas_int* n_iter,
+                                            double* W,
+                                            rocblas_int* info)
+{
+    return rocsolver_zheevs(handle, uplo, n, A, lda, nev, k, X, ldx, tol, max_iter, n_iter, W,
+                            info);
+}
+/********************************************************/
+
+/******************** SYEV_REFINE/HEEV_REFINE ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_syev_heev_refine(bool STRIDED,
+                                                 rocblas_handle handle,
+                                                 rocblas_fill uplo,
+                                                 rocblas_int n,
+                                                 float* A,
+                                                 rocblas_int lda,
+                                                 rocblas_stride stA,
+                                                 float* X,
+                                                 rocblas_int ldx,
+                                                 rocblas_stride stX,
+                                                 float abstol,
+                                                 float* residual,
+                                                 rocblas_int max_iters,
+                                                 rocblas_int* n_iters,
+                                                 float* W,
+                                                 rocblas_stride stW,
+                                                 rocblas_int* info,
+                                                 rocblas_int bc)
+{
+    return STRIDED
+        ? rocsolver_ssyev_refine_strided_batched(handle, uplo, n, A, lda, stA, X, ldx, stX, abstol,
+                                                 residual, max_iters, n_iters, W, stW, info, bc)
+        : rocsolver_ssyev_refine(handle, uplo, n, A, lda, X, ldx, abstol, residual, max_iters,
+                                 n_iters, W, info);
+}
+
+inline rocblas_status rocsolver_syev_heev_refine(bool STRIDED,
+                                                 rocblas_handle handle,
+                                                 rocblas_fill uplo,
+                                                 rocblas_int n,
+                                                 double* A,
+                                                 rocblas_int lda,
+                                                 rocblas_stride stA,
+                                                 double* X,
+                                                 rocblas_int ldx,
+                                                 rocblas_stride stX,
+                                                 double abstol,
+                                                 double* residual,
+                                                 rocblas_int max_iters,
+                                                 rocblas_int* n_iters,
+                                                 double* W,
+                                                 rocblas_stride stW,
+                                                 rocblas_int* info,
+                                                 rocblas_int bc)
+{
+    return STRIDED
+        ? rocsolver_dsyev_refine_strided_batched(handle, uplo, n, A, lda, stA, X, ldx, stX, abstol,
+                                                 residual, max_iters, n_iters, W, stW, info, bc)
+        : rocsolver_dsyev_refine(handle, uplo, n, A, lda, X, ldx, abstol, residual, max_iters,
+                                 n_iters, W, info);
+}
+
+inline rocblas_status rocsolver_syev_heev_refine(bool STRIDED,
+                                                 rocblas_handle handle,
+                                                 rocblas_fill uplo,
+                                                 rocblas_int n,
+                                                 rocblas_float_complex* A,
+                                                 rocblas_int lda,
+                                                 rocblas_stride stA,
+                                                 rocblas_float_complex* X,
+                                                 rocblas_int ldx,
+                                                 rocblas_stride stX,
+                                                 float abstol,
+                                                 float* residual,
+                                                 rocblas_int max_iters,
+                                                 rocblas_int* n_iters,
+                                                 float* W,
+                                                 rocblas_stride stW,
+                                                 rocblas_int* info,
+                                                 rocblas_int bc)
+{
+    return STRIDED
+        ? rocsolver_cheev_refine_strided_batched(handle, uplo, n, A, lda, stA, X, ldx, stX, abstol,
+                                                 residual, max_iters, n_iters, W, stW, info, bc)
+        : rocsolver_cheev_refine(handle, uplo, n, A, lda, X, ldx, abstol, residual, max_iters,
+                                 n_iters, W, info);
+}
+
+inline rocblas_status rocsolver_syev_heev_refine(bool STRIDED,
+                                                 rocblas_handle handle,
+                                                 rocblas_fill uplo,
+                                                 rocblas_int n,
+                                                 rocblas_double_complex* A,
+                                                 rocblas_int lda,
+                                                 rocblas_stride stA,
+                                                 rocblas_double_complex* X,
+                                                 rocblas_int ldx,
+                                                 rocblas_stride stX,
+                                                 double abstol,
+                                                 double* residual,
+                                                 rocblas_int max_iters,
+                                                 rocblas_int* n_iters,
+                                                 double* W,
+                                                 rocblas_stride stW,
+                                                 rocblas_int* info,
+                                                 rocblas_int bc)
+{
+    return STRIDED
+        ? rocsolver_zheev_refine_strided_batched(handle, uplo, n, A, lda, stA, X, ldx, stX, abstol,
+                                                 residual, max_iters, n_iters, W, stW, info, bc)
+        : rocsolver_zheev_refine(handle, uplo, n, A, lda, X, ldx, abstol, residual, max_iters,
+                                 n_iters, W, info);
+}
+
+// batched
+inline rocblas_status rocsolver_syev_heev_refine(bool STRIDED,
+                                                 rocblas_handle handle,
+                                                 rocblas_fill uplo,
+                                                 rocblas_int n,
+                                                 float* const A[],
+                                                 rocblas_int lda,
+                                                 rocblas_stride stA,
+                                                 float* const X[],
+                                                 rocblas_int ldx,
+                                                 rocblas_stride stX,
+                                                 float abstol,
+                                                 float* residual,
+                                                 rocblas_int max_iters,
+                                                 rocblas_int* n_iters,
+                                                 float* W,
+                                                 rocblas_stride stW,
+                                                 rocblas_int* info,
+                                                 rocblas_int bc)
+{
+    return rocsolver_ssyev_refine_batched(handle, uplo, n, A, lda, X, ldx, abstol, residual,
+                                          max_iters, n_iters, W, stW, info, bc);
+}
+
+inline rocblas_status rocsolver_syev_heev_refine(bool STRIDED,
+                                                 rocblas_handle handle,
+                                                 rocblas_fill uplo,
+                                                 rocblas_int n,
+                                                 double* const A[],
+                                                 rocblas_int lda,
+                                                 rocblas_stride stA,
+                                                 double* const X[],
+                                                 rocblas_int ldx,
+                                                 rocblas_stride stX,
+                                                 double abstol,
+                                                 double* residual,
+                                                 rocblas_int max_iters,
+                                                 rocblas_int* n_iters,
+                                                 double* W,
+                                                 rocblas_stride stW,
+                                                 rocblas_int* info,
+                                                 rocblas_int bc)
+{
+    return rocsolver_dsyev_refine_batched(handle, uplo, n, A, lda, X, ldx, abstol, residual,
+                                          max_iters, n_iters, W, stW, info, bc);
+}
+
+inline rocblas_status rocsolver_syev_heev_refine(bool STRIDED,
+                                                 rocblas_handle handle,
+                                                 rocblas_fill uplo,
+                                                 rocblas_int n,
+                                                 rocblas_float_complex* const A[],
+                                                 rocblas_int lda,
+                                                 rocblas_stride stA,
+                                                 rocblas_float_complex* const X[],
+                                                 rocblas_int ldx,
+                                                 rocblas_stride stX,
+                                                 float abstol,
+                                                 float* residual,
+                                                 rocblas_int max_iters,
+                                                 rocblas_int* n_iters,
+                                                 float* W,
+                                                 rocblas_stride stW,
+                                                 rocblas_int* info,
+                                                 rocblas_int bc)
+{
+    return rocsolver_cheev_refine_batched(handle, uplo, n, A, lda, X, ldx, abstol, residual,
+                                          max_iters, n_iters, W, stW, info, bc);
+}
+
+inline rocblas_status rocsolver_syev_heev_refine(bool STRIDED,
+                                                 rocblas_handle handle,
+                                                 rocblas_fill uplo,
+                                                 rocblas_int n,
+                                                 rocblas_double_complex* const A[],
+                                                 rocblas_int lda,
+                                                 rocblas_stride stA,
+                                                 rocblas_double_complex* const X[],
+                                                 rocblas_int ldx,
+                                                 rocblas_stride stX,
+                                                 double abstol,
+                                                 double* residual,
+                                                 rocblas_int max_iters,
+                                                 rocblas_int* n_iters,
+                                                 double* W,
+                                                 rocblas_stride stW,
+                                                 rocblas_int* info,
+                                                 rocblas_int bc)
+{
+    return rocsolver_zheev_refine_batched(handle, uplo, n, A, lda, X, ldx, abstol, residual,
+                                          max_iters, n_iters, W, stW, info, bc);
+}
+/********************************************************/
+
 /******************** SYEVX/HEEVX ********************/
 // normal and strided_batched
 inline rocblas_status rocsolver_syevx_heevx(bool STRIDED,
@@ -9266,6 +14379,206 @@ inline rocblas_status rocsolver_sygv_hegv(bool STRIDED,
 }
 /********************************************************/
 
+/******************** SYGV_AUTO/HEGV_AUTO ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_sygv_hegv_auto(bool STRIDED,
+                                               rocblas_handle handle,
+                                               rocblas_eform itype,
+                                               rocblas_evect evect,
+                                               rocblas_fill uplo,
+                                               rocblas_int n,
+                                               float* A,
+                                               rocblas_int lda,
+                                               rocblas_stride stA,
+                                               float* B,
+                                               rocblas_int ldb,
+                                               rocblas_stride stB,
+                                               float* D,
+                                               rocblas_stride stD,
+                                               float* E,
+                                               rocblas_stride stE,
+                                               rocblas_int* info,
+                                               rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_ssygv_auto_strided_batched(handle, itype, evect, uplo, n, A, lda, stA, B,
+                                                    ldb, stB, D, stD, E, stE, info, bc);
+    else
+        return rocsolver_ssygv_auto(handle, itype, evect, uplo, n, A, lda, B, ldb, D, E, info);
+}
+
+inline rocblas_status rocsolver_sygv_hegv_auto(bool STRIDED,
+                                               rocblas_handle handle,
+                                               rocblas_eform itype,
+                                               rocblas_evect evect,
+                                               rocblas_fill uplo,
+                                               rocblas_int n,
+                                               double* A,
+                                               rocblas_int lda,
+                                               rocblas_stride stA,
+                                               double* B,
+                                               rocblas_int ldb,
+                                               rocblas_stride stB,
+                                               double* D,
+                                               rocblas_stride stD,
+                                               double* E,
+                                               rocblas_stride stE,
+                                               rocblas_int* info,
+                                               rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_dsygv_auto_strided_batched(handle, itype, evect, uplo, n, A, lda, stA, B,
+                                                    ldb, stB, D, stD, E, stE, info, bc);
+    else
+        return rocsolver_dsygv_auto(handle, itype, evect, uplo, n, A, lda, B, ldb, D, E, info);
+}
+
+inline rocblas_status rocsolver_sygv_hegv_auto(bool STRIDED,
+                                               rocblas_handle handle,
+                                               rocblas_eform itype,
+                                               rocblas_evect evect,
+                                               rocblas_fill uplo,
+                                               rocblas_int n,
+                                               rocblas_float_complex* A,
+                                               rocblas_int lda,
+                                               rocblas_stride stA,
+                                               rocblas_float_complex* B,
+                                               rocblas_int ldb,
+                                               rocblas_stride stB,
+                                               float* D,
+                                               rocblas_stride stD,
+                                               float* E,
+                                               rocblas_stride stE,
+                                               rocblas_int* info,
+                                               rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_chegv_auto_strided_batched(handle, itype, evect, uplo, n, A, lda, stA, B,
+                                                    ldb, stB, D, stD, E, stE, info, bc);
+    else
+        return rocsolver_chegv_auto(handle, itype, evect, uplo, n, A, lda, B, ldb, D, E, info);
+}
+
+inline rocblas_status rocsolver_sygv_hegv_auto(bool STRIDED,
+                                               rocblas_handle handle,
+                                               rocblas_eform itype,
+                                               rocblas_evect evect,
+                                               rocblas_fill uplo,
+                                               rocblas_int n,
+                                               rocblas_double_complex* A,
+                                               rocblas_int lda,
+                                               rocblas_stride stA,
+                                               rocblas_double_complex* B,
+                                               rocblas_int ldb,
+                                               rocblas_stride stB,
+                                               double* D,
+                                               rocblas_stride stD,
+                                               double* E,
+                                               rocblas_stride stE,
+                                               rocblas_int* info,
+                                               rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_zhegv_auto_strided_batched(handle, itype, evect, uplo, n, A, lda, stA, B,
+                                                    ldb, stB, D, stD, E, stE, info, bc);
+    else
+        return rocsolver_zhegv_auto(handle, itype, evect, uplo, n, A, lda, B, ldb, D, E, info);
+}
+
+// batched
+inline rocblas_status rocsolver_sygv_hegv_auto(bool STRIDED,
+                                               rocblas_handle handle,
+                                               rocblas_eform itype,
+                                               rocblas_evect evect,
+                                               rocblas_fill uplo,
+                                               rocblas_int n,
+                                               float* const A[],
+                                               rocblas_int lda,
+                                               rocblas_stride stA,
+                                               float* const B[],
+                                               rocblas_int ldb,
+                                               rocblas_stride stB,
+                                               float* D,
+                                               rocblas_stride stD,
+                                               float* E,
+                                               rocblas_stride stE,
+                                               rocblas_int* info,
+                                               rocblas_int bc)
+{
+    return rocsolver_ssygv_auto_batched(handle, itype, evect, uplo, n, A, lda, B, ldb, D, stD, E,
+                                        stE, info, bc);
+}
+
+inline rocblas_status rocsolver_sygv_hegv_auto(bool STRIDED,
+                                               rocblas_handle handle,
+                                               rocblas_eform itype,
+                                               rocblas_evect evect,
+                                               rocblas_fill uplo,
+                                               rocblas_int n,
+                                               double* const A[],
+                                               rocblas_int lda,
+                                               rocblas_stride stA,
+                                               double* const B[],
+                                               rocblas_int ldb,
+                                               rocblas_stride stB,
+                                               double* D,
+                                               rocblas_stride stD,
+                                               double* E,
+                                               rocblas_stride stE,
+                                               rocblas_int* info,
+                                               rocblas_int bc)
+{
+    return rocsolver_dsygv_auto_batched(handle, itype, evect, uplo, n, A, lda, B, ldb, D, stD, E,
+                                        stE, info, bc);
+}
+
+inline rocblas_status rocsolver_sygv_hegv_auto(bool STRIDED,
+                                               rocblas_handle handle,
+                                               rocblas_eform itype,
+                                               rocblas_evect evect,
+                                               rocblas_fill uplo,
+                                               rocblas_int n,
+                                               rocblas_float_complex* const A[],
+                                               rocblas_int lda,
+                                               rocblas_stride stA,
+                                               rocblas_float_complex* const B[],
+                                               rocblas_int ldb,
+                                               rocblas_stride stB,
+                                               float* D,
+                                               rocblas_stride stD,
+                                               float* E,
+                                               rocblas_stride stE,
+                                               rocblas_int* info,
+                                               rocblas_int bc)
+{
+    return rocsolver_chegv_auto_batched(handle, itype, evect, uplo, n, A, lda, B, ldb, D, stD, E,
+                                        stE, info, bc);
+}
+
+inline rocblas_status rocsolver_sygv_hegv_auto(bool STRIDED,
+                                               rocblas_handle handle,
+                                               rocblas_eform itype,
+                                               rocblas_evect evect,
+                                               rocblas_fill uplo,
+                                               rocblas_int n,
+                                               rocblas_double_complex* const A[],
+                                               rocblas_int lda,
+                                               rocblas_stride stA,
+                                               rocblas_double_complex* const B[],
+                                               rocblas_int ldb,
+                                               rocblas_stride stB,
+                                               double* D,
+                                               rocblas_stride stD,
+                                               double* E,
+                                               rocblas_stride stE,
+                                               rocblas_int* info,
+                                               rocblas_int bc)
+{
+    return rocsolver_zhegv_auto_batched(handle, itype, evect, uplo, n, A, lda, B, ldb, D, stD, E,
+                                        stE, info, bc);
+}
+/********************************************************/
+
 /******************** SYGVD_HEGVD ********************/
 // normal and strided_batched
 inline rocblas_status rocsolver_sygvd_hegvd(bool STRIDED,
@@ -10776,25 +16089,361 @@ inline rocblas_status rocsolver_sytf2_sytrf(bool STRIDED,
                                             rocblas_int* info,
                                             rocblas_int bc)
 {
-    return SYTRF ? rocsolver_csytrf_batched(handle, uplo, n, A, lda, ipiv, stP, info, bc)
-                 : rocsolver_csytf2_batched(handle, uplo, n, A, lda, ipiv, stP, info, bc);
+    return SYTRF ? rocsolver_csytrf_batched(handle, uplo, n, A, lda, ipiv, stP, info, bc)
+                 : rocsolver_csytf2_batched(handle, uplo, n, A, lda, ipiv, stP, info, bc);
+}
+
+inline rocblas_status rocsolver_sytf2_sytrf(bool STRIDED,
+                                            bool SYTRF,
+                                            rocblas_handle handle,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            rocblas_double_complex* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_int* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
+{
+    return SYTRF ? rocsolver_zsytrf_batched(handle, uplo, n, A, lda, ipiv, stP, info, bc)
+                 : rocsolver_zsytf2_batched(handle, uplo, n, A, lda, ipiv, stP, info, bc);
+}
+/********************************************************/
+
+/******************** SYTRS ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_sytrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      float* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      const rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      float* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_ssytrs_strided_batched(handle, uplo, n, nrhs, A, lda, stA, ipiv, stP, B,
+                                                ldb, stB, bc);
+    else
+        return rocsolver_ssytrs(handle, uplo, n, nrhs, A, lda, ipiv, B, ldb);
+}
+
+inline rocblas_status rocsolver_sytrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      double* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      const rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      double* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_dsytrs_strided_batched(handle, uplo, n, nrhs, A, lda, stA, ipiv, stP, B,
+                                                ldb, stB, bc);
+    else
+        return rocsolver_dsytrs(handle, uplo, n, nrhs, A, lda, ipiv, B, ldb);
+}
+
+inline rocblas_status rocsolver_sytrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_float_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      const rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_float_complex* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_csytrs_strided_batched(handle, uplo, n, nrhs, A, lda, stA, ipiv, stP, B,
+                                                ldb, stB, bc);
+    else
+        return rocsolver_csytrs(handle, uplo, n, nrhs, A, lda, ipiv, B, ldb);
+}
+
+inline rocblas_status rocsolver_sytrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_double_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      const rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_double_complex* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_zsytrs_strided_batched(handle, uplo, n, nrhs, A, lda, stA, ipiv, stP, B,
+                                                ldb, stB, bc);
+    else
+        return rocsolver_zsytrs(handle, uplo, n, nrhs, A, lda, ipiv, B, ldb);
+}
+
+// batched
+inline rocblas_status rocsolver_sytrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      float* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      const rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      float* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
+{
+    return rocsolver_ssytrs_batched(handle, uplo, n, nrhs, A, lda, ipiv, stP, B, ldb, bc);
+}
+
+inline rocblas_status rocsolver_sytrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      double* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      const rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      double* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
+{
+    return rocsolver_dsytrs_batched(handle, uplo, n, nrhs, A, lda, ipiv, stP, B, ldb, bc);
+}
+
+inline rocblas_status rocsolver_sytrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_float_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      const rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_float_complex* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
+{
+    return rocsolver_csytrs_batched(handle, uplo, n, nrhs, A, lda, ipiv, stP, B, ldb, bc);
+}
+
+inline rocblas_status rocsolver_sytrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_double_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      const rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_double_complex* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
+{
+    return rocsolver_zsytrs_batched(handle, uplo, n, nrhs, A, lda, ipiv, stP, B, ldb, bc);
+}
+/********************************************************/
+
+/******************** SYSV ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_sysv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_fill uplo,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     float* A,
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_int* ipiv,
+                                     rocblas_stride stP,
+                                     float* B,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_ssysv_strided_batched(handle, uplo, n, nrhs, A, lda, stA, ipiv, stP, B,
+                                               ldb, stB, info, bc);
+    else
+        return rocsolver_ssysv(handle, uplo, n, nrhs, A, lda, ipiv, B, ldb, info);
+}
+
+inline rocblas_status rocsolver_sysv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_fill uplo,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     double* A,
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_int* ipiv,
+                                     rocblas_stride stP,
+                                     double* B,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_dsysv_strided_batched(handle, uplo, n, nrhs, A, lda, stA, ipiv, stP, B,
+                                               ldb, stB, info, bc);
+    else
+        return rocsolver_dsysv(handle, uplo, n, nrhs, A, lda, ipiv, B, ldb, info);
+}
+
+inline rocblas_status rocsolver_sysv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_fill uplo,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     rocblas_float_complex* A,
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_int* ipiv,
+                                     rocblas_stride stP,
+                                     rocblas_float_complex* B,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_csysv_strided_batched(handle, uplo, n, nrhs, A, lda, stA, ipiv, stP, B,
+                                               ldb, stB, info, bc);
+    else
+        return rocsolver_csysv(handle, uplo, n, nrhs, A, lda, ipiv, B, ldb, info);
+}
+
+inline rocblas_status rocsolver_sysv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_fill uplo,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     rocblas_double_complex* A,
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_int* ipiv,
+                                     rocblas_stride stP,
+                                     rocblas_double_complex* B,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_zsysv_strided_batched(handle, uplo, n, nrhs, A, lda, stA, ipiv, stP, B,
+                                               ldb, stB, info, bc);
+    else
+        return rocsolver_zsysv(handle, uplo, n, nrhs, A, lda, ipiv, B, ldb, info);
+}
+
+// batched
+inline rocblas_status rocsolver_sysv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_fill uplo,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     float* const A[],
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_int* ipiv,
+                                     rocblas_stride stP,
+                                     float* const B[],
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    return rocsolver_ssysv_batched(handle, uplo, n, nrhs, A, lda, ipiv, stP, B, ldb, info, bc);
+}
+
+inline rocblas_status rocsolver_sysv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_fill uplo,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     double* const A[],
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_int* ipiv,
+                                     rocblas_stride stP,
+                                     double* const B[],
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    return rocsolver_dsysv_batched(handle, uplo, n, nrhs, A, lda, ipiv, stP, B, ldb, info, bc);
 }
 
-inline rocblas_status rocsolver_sytf2_sytrf(bool STRIDED,
-                                            bool SYTRF,
-                                            rocblas_handle handle,
-                                            rocblas_fill uplo,
-                                            rocblas_int n,
-                                            rocblas_double_complex* const A[],
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            rocblas_int* ipiv,
-                                            rocblas_stride stP,
-                                            rocblas_int* info,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_sysv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_fill uplo,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     rocblas_float_complex* const A[],
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_int* ipiv,
+                                     rocblas_stride stP,
+                                     rocblas_float_complex* const B[],
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
 {
-    return SYTRF ? rocsolver_zsytrf_batched(handle, uplo, n, A, lda, ipiv, stP, info, bc)
-                 : rocsolver_zsytf2_batched(handle, uplo, n, A, lda, ipiv, stP, info, bc);
+    return rocsolver_csysv_batched(handle, uplo, n, nrhs, A, lda, ipiv, stP, B, ldb, info, bc);
+}
+
+inline rocblas_status rocsolver_sysv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_fill uplo,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     rocblas_double_complex* const A[],
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_int* ipiv,
+                                     rocblas_stride stP,
+                                     rocblas_double_complex* const B[],
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    return rocsolver_zsysv_batched(handle, uplo, n, nrhs, A, lda, ipiv, stP, B, ldb, info, bc);
 }
 /********************************************************/
 
@@ -11360,6 +17009,170 @@ inline rocblas_status rocsolver_geblttrs_npvt_interleaved(rocblas_handle handle,
 }
 /********************************************************/
 
+/****************** GTSV_NPVT_INTERLEAVED ******************/
+inline rocblas_status rocsolver_gtsv_npvt_interleaved(rocblas_handle handle,
+                                                      rocblas_int n,
+                                                      rocblas_int nrhs,
+                                                      float* DL,
+                                                      float* D,
+                                                      float* DU,
+                                                      rocblas_int incd,
+                                                      rocblas_stride stD,
+                                                      float* B,
+                                                      rocblas_int incb,
+                                                      rocblas_int ldb,
+                                                      rocblas_stride stB,
+                                                      rocblas_int* info,
+                                                      rocblas_int bc)
+{
+    return rocsolver_sgtsv_npvt_interleaved_batched(handle, n, nrhs, DL, D, DU, incd, stD, B, incb,
+                                                    ldb, stB, info, bc);
+}
+
+inline rocblas_status rocsolver_gtsv_npvt_interleaved(rocblas_handle handle,
+                                                      rocblas_int n,
+                                                      rocblas_int nrhs,
+                                                      double* DL,
+                                                      double* D,
+                                                      double* DU,
+                                                      rocblas_int incd,
+                                                      rocblas_stride stD,
+                                                      double* B,
+                                                      rocblas_int incb,
+                                                      rocblas_int ldb,
+                                                      rocblas_stride stB,
+                                                      rocblas_int* info,
+                                                      rocblas_int bc)
+{
+    return rocsolver_dgtsv_npvt_interleaved_batched(handle, n, nrhs, DL, D, DU, incd, stD, B, incb,
+                                                    ldb, stB, info, bc);
+}
+
+inline rocblas_status rocsolver_gtsv_npvt_interleaved(rocblas_handle handle,
+                                                      rocblas_int n,
+                                                      rocblas_int nrhs,
+                                                      rocblas_float_complex* DL,
+                                                      rocblas_float_complex* D,
+                                                      rocblas_float_complex* DU,
+                                                      rocblas_int incd,
+                                                      rocblas_stride stD,
+                                                      rocblas_float_complex* B,
+                                                      rocblas_int incb,
+                                                      rocblas_int ldb,
+                                                      rocblas_stride stB,
+                                                      rocblas_int* info,
+                                                      rocblas_int bc)
+{
+    return rocsolver_cgtsv_npvt_interleaved_batched(handle, n, nrhs, DL, D, DU, incd, stD, B, incb,
+                                                    ldb, stB, info, bc);
+}
+
+inline rocblas_status rocsolver_gtsv_npvt_interleaved(rocblas_handle handle,
+                                                      rocblas_int n,
+                                                      rocblas_int nrhs,
+                                                      rocblas_double_complex* DL,
+                                                      rocblas_double_complex* D,
+                                                      rocblas_double_complex* DU,
+                                                      rocblas_int incd,
+                                                      rocblas_stride stD,
+                                                      rocblas_double_complex* B,
+                                                      rocblas_int incb,
+                                                      rocblas_int ldb,
+                                                      rocblas_stride stB,
+                                                      rocblas_int* info,
+                                                      rocblas_int bc)
+{
+    return rocsolver_zgtsv_npvt_interleaved_batched(handle, n, nrhs, DL, D, DU, incd, stD, B, incb,
+                                                    ldb, stB, info, bc);
+}
+/********************************************************/
+
+/****************** GPSV_NPVT_INTERLEAVED ******************/
+inline rocblas_status rocsolver_gpsv_npvt_interleaved(rocblas_handle handle,
+                                                      rocblas_int n,
+                                                      rocblas_int nrhs,
+                                                      float* DS,
+                                                      float* DL,
+                                                      float* D,
+                                                      float* DU,
+                                                      float* DW,
+                                                      rocblas_int incd,
+                                                      rocblas_stride stD,
+                                                      float* B,
+                                                      rocblas_int incb,
+                                                      rocblas_int ldb,
+                                                      rocblas_stride stB,
+                                                      rocblas_int* info,
+                                                      rocblas_int bc)
+{
+    return rocsolver_sgpsv_npvt_interleaved_batched(handle, n, nrhs, DS, DL, D, DU, DW, incd, stD,
+                                                    B, incb, ldb, stB, info, bc);
+}
+
+inline rocblas_status rocsolver_gpsv_npvt_interleaved(rocblas_handle handle,
+                                                      rocblas_int n,
+                                                      rocblas_int nrhs,
+                                                      double* DS,
+                                                      double* DL,
+                                                      double* D,
+                                                      double* DU,
+                                                      double* DW,
+                                                      rocblas_int incd,
+                                                      rocblas_stride stD,
+                                                      double* B,
+                                                      rocblas_int incb,
+                                                      rocblas_int ldb,
+                                                      rocblas_stride stB,
+                                                      rocblas_int* info,
+                                                      rocblas_int bc)
+{
+    return rocsolver_dgpsv_npvt_interleaved_batched(handle, n, nrhs, DS, DL, D, DU, DW, incd, stD,
+                                                    B, incb, ldb, stB, info, bc);
+}
+
+inline rocblas_status rocsolver_gpsv_npvt_interleaved(rocblas_handle handle,
+                                                      rocblas_int n,
+                                                      rocblas_int nrhs,
+                                                      rocblas_float_complex* DS,
+                                                      rocblas_float_complex* DL,
+                                                      rocblas_float_complex* D,
+                                                      rocblas_float_complex* DU,
+                                                      rocblas_float_complex* DW,
+                                                      rocblas_int incd,
+                                                      rocblas_stride stD,
+                                                      rocblas_float_complex* B,
+                                                      rocblas_int incb,
+                                                      rocblas_int ldb,
+                                                      rocblas_stride stB,
+                                                      rocblas_int* info,
+                                                      rocblas_int bc)
+{
+    return rocsolver_cgpsv_npvt_interleaved_batched(handle, n, nrhs, DS, DL, D, DU, DW, incd, stD,
+                                                    B, incb, ldb, stB, info, bc);
+}
+
+inline rocblas_status rocsolver_gpsv_npvt_interleaved(rocblas_handle handle,
+                                                      rocblas_int n,
+                                                      rocblas_int nrhs,
+                                                      rocblas_double_complex* DS,
+                                                      rocblas_double_complex* DL,
+                                                      rocblas_double_complex* D,
+                                                      rocblas_double_complex* DU,
+                                                      rocblas_double_complex* DW,
+                                                      rocblas_int incd,
+                                                      rocblas_stride stD,
+                                                      rocblas_double_complex* B,
+                                                      rocblas_int incb,
+                                                      rocblas_int ldb,
+                                                      rocblas_stride stB,
+                                                      rocblas_int* info,
+                                                      rocblas_int bc)
+{
+    return rocsolver_zgpsv_npvt_interleaved_batched(handle, n, nrhs, DS, DL, D, DU, DW, incd, stD,
+                                                    B, incb, ldb, stB, info, bc);
+}
+/********************************************************/
+
 /*************** CREATE_ DESTROY_ RFINFO ****************/
 // local rocsolver_rfinfo; automatically created and destroyed
 class rocsolver_local_rfinfo
@@ -11502,6 +17315,56 @@ inline rocblas_status rocsolver_csrrf_splitlu(rocblas_handle handle,
     return rocsolver_dcsrrf_splitlu(handle, n, nnzT, ptrT, indT, valT, ptrL, indL, valL, ptrU, indU,
                                     valU);
 }
+
+inline rocblas_status rocsolver_csrrf_splitlu(bool STRIDED,
+                                              rocblas_handle handle,
+                                              rocblas_int n,
+                                              rocblas_int nnzT,
+                                              rocblas_int* ptrT,
+                                              rocblas_int* indT,
+                                              float* valT,
+                                              rocblas_stride stT,
+                                              rocblas_int* ptrL,
+                                              rocblas_int* indL,
+                                              float* valL,
+                                              rocblas_stride stL,
+                                              rocblas_int* ptrU,
+                                              rocblas_int* indU,
+                                              float* valU,
+                                              rocblas_stride stU,
+                                              rocblas_int bc)
+{
+    return STRIDED
+        ? rocsolver_scsrrf_splitlu_strided_batched(handle, n, nnzT, ptrT, indT, valT, stT, ptrL,
+                                                   indL, valL, stL, ptrU, indU, valU, stU, bc)
+        : rocsolver_scsrrf_splitlu(handle, n, nnzT, ptrT, indT, valT, ptrL, indL, valL, ptrU,
+                                   indU, valU);
+}
+
+inline rocblas_status rocsolver_csrrf_splitlu(bool STRIDED,
+                                              rocblas_handle handle,
+                                              rocblas_int n,
+                                              rocblas_int nnzT,
+                                              rocblas_int* ptrT,
+                                              rocblas_int* indT,
+                                              double* valT,
+                                              rocblas_stride stT,
+                                              rocblas_int* ptrL,
+                                              rocblas_int* indL,
+                                              double* valL,
+                                              rocblas_stride stL,
+                                              rocblas_int* ptrU,
+                                              rocblas_int* indU,
+                                              double* valU,
+                                              rocblas_stride stU,
+                                              rocblas_int bc)
+{
+    return STRIDED
+        ? rocsolver_dcsrrf_splitlu_strided_batched(handle, n, nnzT, ptrT, indT, valT, stT, ptrL,
+                                                   indL, valL, stL, ptrU, indU, valU, stU, bc)
+        : rocsolver_dcsrrf_splitlu(handle, n, nnzT, ptrT, indT, valT, ptrL, indL, valL, ptrU,
+                                   indU, valU);
+}
 /********************************************************/
 
 /********************* CSRRF_REFACTCHOL ************************/
@@ -11538,6 +17401,54 @@ inline rocblas_status rocsolver_csrrf_refactchol(rocblas_handle handle,
     return rocsolver_dcsrrf_refactchol(handle, n, nnzA, ptrA, indA, valA, nnzT, ptrT, indT, valT,
                                        pivQ, rfinfo);
 }
+
+inline rocblas_status rocsolver_csrrf_refactchol(bool STRIDED,
+                                                 rocblas_handle handle,
+                                                 rocblas_int n,
+                                                 rocblas_int nnzA,
+                                                 rocblas_int* ptrA,
+                                                 rocblas_int* indA,
+                                                 float* valA,
+                                                 rocblas_stride stA,
+                                                 rocblas_int nnzT,
+                                                 rocblas_int* ptrT,
+                                                 rocblas_int* indT,
+                                                 float* valT,
+                                                 rocblas_stride stT,
+                                                 rocblas_int* pivQ,
+                                                 rocsolver_rfinfo rfinfo,
+                                                 rocblas_int bc)
+{
+    return STRIDED ? rocsolver_scsrrf_refactchol_strided_batched(handle, n, nnzA, ptrA, indA, valA,
+                                                                 stA, nnzT, ptrT, indT, valT, stT,
+                                                                 pivQ, rfinfo, bc)
+                   : rocsolver_scsrrf_refactchol(handle, n, nnzA, ptrA, indA, valA, nnzT, ptrT,
+                                                 indT, valT, pivQ, rfinfo);
+}
+
+inline rocblas_status rocsolver_csrrf_refactchol(bool STRIDED,
+                                                 rocblas_handle handle,
+                                                 rocblas_int n,
+                                                 rocblas_int nnzA,
+                                                 rocblas_int* ptrA,
+                                                 rocblas_int* indA,
+                                                 double* valA,
+                                                 rocblas_stride stA,
+                                                 rocblas_int nnzT,
+                                                 rocblas_int* ptrT,
+                                                 rocblas_int* indT,
+                                                 double* valT,
+                                                 rocblas_stride stT,
+                                                 rocblas_int* pivQ,
+                                                 rocsolver_rfinfo rfinfo,
+                                                 rocblas_int bc)
+{
+    return STRIDED ? rocsolver_dcsrrf_refactchol_strided_batched(handle, n, nnzA, ptrA, indA, valA,
+                                                                 stA, nnzT, ptrT, indT, valT, stT,
+                                                                 pivQ, rfinfo, bc)
+                   : rocsolver_dcsrrf_refactchol(handle, n, nnzA, ptrA, indA, valA, nnzT, ptrT,
+                                                 indT, valT, pivQ, rfinfo);
+}
 /********************* CSRRF_REFACTLU ************************/
 inline rocblas_status rocsolver_csrrf_refactlu(rocblas_handle handle,
                                                rocblas_int n,
@@ -11574,6 +17485,56 @@ inline rocblas_status rocsolver_csrrf_refactlu(rocblas_handle handle,
     return rocsolver_dcsrrf_refactlu(handle, n, nnzA, ptrA, indA, valA, nnzT, ptrT, indT, valT,
                                      pivP, pivQ, rfinfo);
 }
+
+inline rocblas_status rocsolver_csrrf_refactlu(bool STRIDED,
+                                               rocblas_handle handle,
+                                               rocblas_int n,
+                                               rocblas_int nnzA,
+                                               rocblas_int* ptrA,
+                                               rocblas_int* indA,
+                                               float* valA,
+                                               rocblas_stride stA,
+                                               rocblas_int nnzT,
+                                               rocblas_int* ptrT,
+                                               rocblas_int* indT,
+                                               float* valT,
+                                               rocblas_stride stT,
+                                               rocblas_int* pivP,
+                                               rocblas_int* pivQ,
+                                               rocsolver_rfinfo rfinfo,
+                                               rocblas_int bc)
+{
+    return STRIDED ? rocsolver_scsrrf_refactlu_strided_batched(handle, n, nnzA, ptrA, indA, valA,
+                                                               stA, nnzT, ptrT, indT, valT, stT,
+                                                               pivP, pivQ, rfinfo, bc)
+                   : rocsolver_scsrrf_refactlu(handle, n, nnzA, ptrA, indA, valA, nnzT, ptrT, indT,
+                                               valT, pivP, pivQ, rfinfo);
+}
+
+inline rocblas_status rocsolver_csrrf_refactlu(bool STRIDED,
+                                               rocblas_handle handle,
+                                               rocblas_int n,
+                                               rocblas_int nnzA,
+                                               rocblas_int* ptrA,
+                                               rocblas_int* indA,
+                                               double* valA,
+                                               rocblas_stride stA,
+                                               rocblas_int nnzT,
+                                               rocblas_int* ptrT,
+                                               rocblas_int* indT,
+                                               double* valT,
+                                               rocblas_stride stT,
+                                               rocblas_int* pivP,
+                                               rocblas_int* pivQ,
+                                               rocsolver_rfinfo rfinfo,
+                                               rocblas_int bc)
+{
+    return STRIDED ? rocsolver_dcsrrf_refactlu_strided_batched(handle, n, nnzA, ptrA, indA, valA,
+                                                               stA, nnzT, ptrT, indT, valT, stT,
+                                                               pivP, pivQ, rfinfo, bc)
+                   : rocsolver_dcsrrf_refactlu(handle, n, nnzA, ptrA, indA, valA, nnzT, ptrT, indT,
+                                               valT, pivP, pivQ, rfinfo);
+}
 /********************************************************/
 
 /********************* CSRRF_SOLVE ************************/
@@ -11610,4 +17571,96 @@ inline rocblas_status rocsolver_csrrf_solve(rocblas_handle handle,
     return rocsolver_dcsrrf_solve(handle, n, nrhs, nnzT, ptrT, indT, valT, pivP, pivQ, B, ldb,
                                   rfinfo);
 }
+
+inline rocblas_status rocsolver_csrrf_solve(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocblas_int n,
+                                            rocblas_int nrhs,
+                                            rocblas_int nnzT,
+                                            rocblas_int* ptrT,
+                                            rocblas_int* indT,
+                                            float* valT,
+                                            rocblas_stride stT,
+                                            rocblas_int* pivP,
+                                            rocblas_int* pivQ,
+                                            float* B,
+                                            rocblas_int ldb,
+                                            rocblas_stride stB,
+                                            rocsolver_rfinfo rfinfo,
+                                            rocblas_int bc)
+{
+    return STRIDED ? rocsolver_scsrrf_solve_strided_batched(handle, n, nrhs, nnzT, ptrT, indT, valT,
+                                                            stT, pivP, pivQ, B, ldb, stB, rfinfo,
+                                                            bc)
+                   : rocsolver_scsrrf_solve(handle, n, nrhs, nnzT, ptrT, indT, valT, pivP, pivQ, B,
+                                            ldb, rfinfo);
+}
+
+inline rocblas_status rocsolver_csrrf_solve(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocblas_int n,
+                                            rocblas_int nrhs,
+                                            rocblas_int nnzT,
+                                            rocblas_int* ptrT,
+                                            rocblas_int* indT,
+                                            double* valT,
+                                            rocblas_stride stT,
+                                            rocblas_int* pivP,
+                                            rocblas_int* pivQ,
+                                            double* B,
+                                            rocblas_int ldb,
+                                            rocblas_stride stB,
+                                            rocsolver_rfinfo rfinfo,
+                                            rocblas_int bc)
+{
+    return STRIDED ? rocsolver_dcsrrf_solve_strided_batched(handle, n, nrhs, nnzT, ptrT, indT, valT,
+                                                            stT, pivP, pivQ, B, ldb, stB, rfinfo,
+                                                            bc)
+                   : rocsolver_dcsrrf_solve(handle, n, nrhs, nnzT, ptrT, indT, valT, pivP, pivQ, B,
+                                            ldb, rfinfo);
+}
+/********************************************************/
+
+/******************** CSRRF_REFACTSOLVE ********************/
+inline rocblas_status rocsolver_csrrf_refactsolve(rocblas_handle handle,
+                                                  rocblas_int n,
+                                                  rocblas_int nrhs,
+                                                  rocblas_int nnzA,
+                                                  rocblas_int* ptrA,
+                                                  rocblas_int* indA,
+                                                  float* valA,
+                                                  rocblas_int nnzT,
+                                                  rocblas_int* ptrT,
+                                                  rocblas_int* indT,
+                                                  float* valT,
+                                                  rocblas_int* pivP,
+                                                  rocblas_int* pivQ,
+                                                  float* B,
+                                                  rocblas_int ldb,
+                                                  rocsolver_rfinfo rfinfo)
+{
+    return rocsolver_scsrrf_refactsolve(handle, n, nrhs, nnzA, ptrA, indA, valA, nnzT, ptrT, indT,
+                                        valT, pivP, pivQ, B, ldb, rfinfo);
+}
+
+inline rocblas_status rocsolver_csrrf_refactsolve(rocblas_handle handle,
+                                                  rocblas_int n,
+                                                  rocblas_int nrhs,
+                                                  rocblas_int nnzA,
+                                                  rocblas_int* ptrA,
+                                                  rocblas_int* indA,
+                                                  double* valA,
+                                                  rocblas_int nnzT,
+                                                  rocblas_int* ptrT,
+                                                  rocblas_int* indT,
+                                                  double* valT,
+                                                  rocblas_int* pivP,
+                                                  rocblas_int* pivQ,
+                                                  double* B,
+                                                  rocblas_int ldb,
+                                                  rocsolver_rfinfo rfinfo)
+{
+    return rocsolver_dcsrrf_refactsolve(handle, n, nrhs, nnzA, ptrA, indA, valA, nnzT, ptrT, indT,
+                                        valT, pivP, pivQ, B, ldb, rfinfo);
+}
 /********************************************************/
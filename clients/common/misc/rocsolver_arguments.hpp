@@ -1,5 +1,5 @@
 /* **************************************************************************
- * Copyright (C) 2018-2024 Advanced Micro Devices, Inc. All rights reserved.
+ * Copyright (C) 2018-2025 Advanced Micro Devices, Inc. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions
@@ -55,8 +55,13 @@ public:
     rocblas_int singular = 0;
     rocblas_int iters = 5;
     rocblas_int mem_query = 0;
+    rocblas_int memory = 0;
     rocblas_int profile = 0;
     rocblas_int profile_kernels = 0;
+    rocblas_int breakdown = 0;
+    rocblas_int roofline = 0;
+    rocblas_int streams = 1;
+    rocblas_int device_init = 0;
     rocblas_int batch_count = 1;
 
     // get and set function arguments
@@ -66,6 +71,16 @@ public:
         return at(name).as<T>();
     }
 
+    template <typename T>
+    const T peek(const std::string& name, const T& default_value) const
+    {
+        auto val = find(name);
+        if(val != end() && !val->second.empty())
+            return val->second.as<T>();
+        else
+            return default_value;
+    }
+
     template <typename T>
     const T& get(const std::string& name)
     {
@@ -113,11 +128,17 @@ public:
         to_consume.erase("verify");
         to_consume.erase("iters");
         to_consume.erase("mem_query");
+        to_consume.erase("memory");
         to_consume.erase("profile");
         to_consume.erase("profile_kernels");
+        to_consume.erase("breakdown");
+        to_consume.erase("roofline");
+        to_consume.erase("streams");
         to_consume.erase("perf");
         to_consume.erase("singular");
         to_consume.erase("device");
+        to_consume.erase("device_init");
+        to_consume.erase("workflow");
     }
 
     void clear()
@@ -134,7 +155,8 @@ public:
             return;
 
         char precision = val->second.as<char>();
-        if(precision != 's' && precision != 'd' && precision != 'c' && precision != 'z')
+        if(precision != 's' && precision != 'd' && precision != 'c' && precision != 'z'
+           && precision != 'h' && precision != 'b')
             throw std::invalid_argument("Invalid value for " + name);
     }
 
@@ -233,7 +255,7 @@ public:
             return;
 
         char workmode = val->second.as<char>();
-        if(workmode != 'O' && workmode != 'I')
+        if(workmode != 'O' && workmode != 'I' && workmode != 'A')
             throw std::invalid_argument("Invalid value for " + name);
     }
 
@@ -303,6 +325,51 @@ public:
             throw std::invalid_argument("Invalid value for " + name);
     }
 
+    void validate_rfinfo_solve_mode(const std::string name) const
+    {
+        auto val = find(name);
+        if(val == end())
+            return;
+
+        char mode = val->second.as<char>();
+        if(mode != 'S' && mode != 'L')
+            throw std::invalid_argument("Invalid value for " + name);
+    }
+
+    void validate_rfinfo_refact_mode(const std::string name) const
+    {
+        auto val = find(name);
+        if(val == end())
+            return;
+
+        char mode = val->second.as<char>();
+        if(mode != 'S' && mode != 'N')
+            throw std::invalid_argument("Invalid value for " + name);
+    }
+
+    void validate_rfinfo_precision_mode(const std::string name) const
+    {
+        auto val = find(name);
+        if(val == end())
+            return;
+
+        char mode = val->second.as<char>();
+        if(mode != 'F' && mode != 'M')
+            throw std::invalid_argument("Invalid value for " + name);
+    }
+
+    void validate_alg_mode(const std::string name) const
+    {
+        auto val = find(name);
+        if(val == end())
+            return;
+
+        char mode = val->second.as<char>();
+        if(mode != 'Q' && mode != 'D' && mode != 'H' && mode != 'R' && mode != 'M' && mode != 'S'
+           && mode != 'T')
+            throw std::invalid_argument("Invalid value for " + name);
+    }
+
     void validate_consumed() const
     {
         if(!to_consume.empty())
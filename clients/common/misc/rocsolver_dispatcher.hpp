@@ -35,6 +35,7 @@
 // auxiliary
 #include "common/auxiliary/testing_bdsqr.hpp"
 #include "common/auxiliary/testing_bdsvdx.hpp"
+#include "common/auxiliary/testing_gemqrt.hpp"
 #include "common/auxiliary/testing_labrd.hpp"
 #include "common/auxiliary/testing_lacgv.hpp"
 #include "common/auxiliary/testing_larf.hpp"
@@ -50,6 +51,7 @@
 #include "common/auxiliary/testing_orgtr_ungtr.hpp"
 #include "common/auxiliary/testing_orgxl_ungxl.hpp"
 #include "common/auxiliary/testing_orgxr_ungxr.hpp"
+#include "common/auxiliary/testing_orgqr_ungqr_outofplace.hpp"
 #include "common/auxiliary/testing_ormbr_unmbr.hpp"
 #include "common/auxiliary/testing_ormlx_unmlx.hpp"
 #include "common/auxiliary/testing_ormtr_unmtr.hpp"
@@ -62,52 +64,90 @@
 #include "common/auxiliary/testing_stein.hpp"
 #include "common/auxiliary/testing_steqr.hpp"
 #include "common/auxiliary/testing_sterf.hpp"
+#include "common/auxiliary/testing_tfttr.hpp"
+#include "common/auxiliary/testing_trttf.hpp"
 
 // lapack
+#include "common/lapack/testing_cholqr.hpp"
 #include "common/lapack/testing_gebd2_gebrd.hpp"
+#include "common/lapack/testing_gehd2_gehrd.hpp"
 #include "common/lapack/testing_geblttrf_npvt.hpp"
 #include "common/lapack/testing_geblttrs_npvt.hpp"
+#include "common/lapack/testing_gbtrf.hpp"
+#include "common/lapack/testing_gbtrs.hpp"
+#include "common/lapack/testing_gecon.hpp"
 #include "common/lapack/testing_gelq2_gelqf.hpp"
 #include "common/lapack/testing_gels.hpp"
+#include "common/lapack/testing_gels_mixed.hpp"
+#include "common/lapack/testing_gelsd.hpp"
+#include "common/lapack/testing_gelsy.hpp"
+#include "common/lapack/testing_gepolar.hpp"
 #include "common/lapack/testing_geql2_geqlf.hpp"
+#include "common/lapack/testing_geqp3.hpp"
 #include "common/lapack/testing_geqr2_geqrf.hpp"
+#include "common/lapack/testing_geqrf_coldelete.hpp"
+#include "common/lapack/testing_geqrf_rowupdate.hpp"
+#include "common/lapack/testing_geqrt.hpp"
 #include "common/lapack/testing_gerq2_gerqf.hpp"
 #include "common/lapack/testing_gesv.hpp"
+#include "common/lapack/testing_gesv_mixed.hpp"
+#include "common/lapack/testing_gesv_rbt.hpp"
 #include "common/lapack/testing_gesvd.hpp"
 #include "common/lapack/testing_gesvdj.hpp"
+#include "common/lapack/testing_gesvdr.hpp"
 #include "common/lapack/testing_gesvdx.hpp"
 #include "common/lapack/testing_getf2_getrf.hpp"
 #include "common/lapack/testing_getf2_getrf_npvt.hpp"
+#include "common/lapack/testing_getrf_lowprec.hpp"
 #include "common/lapack/testing_getri.hpp"
 #include "common/lapack/testing_getri_npvt.hpp"
 #include "common/lapack/testing_getri_npvt_outofplace.hpp"
 #include "common/lapack/testing_getri_outofplace.hpp"
 #include "common/lapack/testing_getrs.hpp"
+#include "common/lapack/testing_getrs_lowprec.hpp"
+#include "common/lapack/testing_pbtrf.hpp"
+#include "common/lapack/testing_pbtrs.hpp"
+#include "common/lapack/testing_pftrf.hpp"
+#include "common/lapack/testing_pftri.hpp"
+#include "common/lapack/testing_pftrs.hpp"
+#include "common/lapack/testing_pocon.hpp"
 #include "common/lapack/testing_posv.hpp"
+#include "common/lapack/testing_posv_mixed.hpp"
 #include "common/lapack/testing_potf2_potrf.hpp"
+#include "common/lapack/testing_potrf_lowprec.hpp"
+#include "common/lapack/testing_potrf_update.hpp"
 #include "common/lapack/testing_potri.hpp"
 #include "common/lapack/testing_potrs.hpp"
 #include "common/lapack/testing_syev_heev.hpp"
+#include "common/lapack/testing_syev_heev_auto.hpp"
+#include "common/lapack/testing_syev_heev_refine.hpp"
 #include "common/lapack/testing_syevd_heevd.hpp"
 #include "common/lapack/testing_syevdj_heevdj.hpp"
 #include "common/lapack/testing_syevdx_heevdx.hpp"
 #include "common/lapack/testing_syevj_heevj.hpp"
+#include "common/lapack/testing_syevs_heevs.hpp"
 #include "common/lapack/testing_syevx_heevx.hpp"
 #include "common/lapack/testing_sygsx_hegsx.hpp"
 #include "common/lapack/testing_sygv_hegv.hpp"
+#include "common/lapack/testing_sygv_hegv_auto.hpp"
 #include "common/lapack/testing_sygvd_hegvd.hpp"
 #include "common/lapack/testing_sygvdj_hegvdj.hpp"
 #include "common/lapack/testing_sygvdx_hegvdx.hpp"
 #include "common/lapack/testing_sygvj_hegvj.hpp"
 #include "common/lapack/testing_sygvx_hegvx.hpp"
 #include "common/lapack/testing_sytf2_sytrf.hpp"
+#include "common/lapack/testing_sytrs.hpp"
+#include "common/lapack/testing_sysv.hpp"
 #include "common/lapack/testing_sytxx_hetxx.hpp"
+#include "common/lapack/testing_trcon.hpp"
 #include "common/lapack/testing_trtri.hpp"
 
 // refactorization
 #include "common/refact/testing_csrrf_analysis.hpp"
 #include "common/refact/testing_csrrf_refactchol.hpp"
 #include "common/refact/testing_csrrf_refactlu.hpp"
+#include "common/refact/testing_csrrf_refactlu_workflow.hpp"
+#include "common/refact/testing_csrrf_refactsolve.hpp"
 #include "common/refact/testing_csrrf_solve.hpp"
 #include "common/refact/testing_csrrf_splitlu.hpp"
 #include "common/refact/testing_csrrf_sumlu.hpp"
@@ -146,17 +186,32 @@ class rocsolver_dispatcher
             {"stein", testing_stein<T>},
             {"lasyf", testing_lasyf<T>},
             {"lauum", testing_lauum<T>},
+            {"trttf", testing_trttf<T>},
+            {"tfttr", testing_tfttr<T>},
             // potrf
-            {"potf2", testing_potf2_potrf<false, false, 0, T>},
-            {"potf2_batched", testing_potf2_potrf<true, true, 0, T>},
-            {"potf2_strided_batched", testing_potf2_potrf<false, true, 0, T>},
-            {"potrf", testing_potf2_potrf<false, false, 1, T>},
-            {"potrf_batched", testing_potf2_potrf<true, true, 1, T>},
-            {"potrf_strided_batched", testing_potf2_potrf<false, true, 1, T>},
+            {"potf2", testing_potf2_potrf<false, false, 0, T, rocblas_int>},
+            {"potf2_batched", testing_potf2_potrf<true, true, 0, T, rocblas_int>},
+            {"potf2_strided_batched", testing_potf2_potrf<false, true, 0, T, rocblas_int>},
+            {"potrf", testing_potf2_potrf<false, false, 1, T, rocblas_int>},
+            {"potrf_batched", testing_potf2_potrf<true, true, 1, T, rocblas_int>},
+            {"potrf_strided_batched", testing_potf2_potrf<false, true, 1, T, rocblas_int>},
+            {"potrf_64", testing_potf2_potrf<false, false, 1, T, int64_t>},
+            {"potrf_batched_64", testing_potf2_potrf<true, true, 1, T, int64_t>},
+            {"potrf_strided_batched_64", testing_potf2_potrf<false, true, 1, T, int64_t>},
+            // potrf_update
+            {"potrf_update", testing_potrf_update<false, false, false, T>},
+            {"potrf_update_batched", testing_potrf_update<true, true, false, T>},
+            {"potrf_update_strided_batched", testing_potrf_update<false, true, false, T>},
+            {"potrf_downdate", testing_potrf_update<false, false, true, T>},
+            {"potrf_downdate_batched", testing_potrf_update<true, true, true, T>},
+            {"potrf_downdate_strided_batched", testing_potrf_update<false, true, true, T>},
             // potrs
-            {"potrs", testing_potrs<false, false, T>},
-            {"potrs_batched", testing_potrs<true, true, T>},
-            {"potrs_strided_batched", testing_potrs<false, true, T>},
+            {"potrs", testing_potrs<false, false, T, rocblas_int>},
+            {"potrs_batched", testing_potrs<true, true, T, rocblas_int>},
+            {"potrs_strided_batched", testing_potrs<false, true, T, rocblas_int>},
+            {"potrs_64", testing_potrs<false, false, T, int64_t>},
+            {"potrs_batched_64", testing_potrs<true, true, T, int64_t>},
+            {"potrs_strided_batched_64", testing_potrs<false, true, T, int64_t>},
             // posv
             {"posv", testing_posv<false, false, T>},
             {"posv_batched", testing_posv<true, true, T>},
@@ -193,6 +248,20 @@ class rocsolver_dispatcher
             {"geqrf_batched", testing_geqr2_geqrf<true, true, 1, T>},
             {"geqrf_strided_batched", testing_geqr2_geqrf<false, true, 1, T>},
             {"geqrf_ptr_batched", testing_geqr2_geqrf<true, false, 1, T>},
+            {"geqrf_rowupdate", testing_geqrf_rowupdate<false, false, false, T>},
+            {"geqrf_rowupdate_batched", testing_geqrf_rowupdate<true, true, false, T>},
+            {"geqrf_rowupdate_strided_batched", testing_geqrf_rowupdate<false, true, false, T>},
+            {"geqrf_rowdowndate", testing_geqrf_rowupdate<false, false, true, T>},
+            {"geqrf_rowdowndate_batched", testing_geqrf_rowupdate<true, true, true, T>},
+            {"geqrf_rowdowndate_strided_batched", testing_geqrf_rowupdate<false, true, true, T>},
+            {"geqrf_coldelete", testing_geqrf_coldelete<false, false, T>},
+            {"geqrf_coldelete_batched", testing_geqrf_coldelete<true, true, T>},
+            {"geqrf_coldelete_strided_batched", testing_geqrf_coldelete<false, true, T>},
+            {"geqp3", testing_geqp3<false, false, T>},
+            {"geqp3_batched", testing_geqp3<true, true, T>},
+            {"geqp3_strided_batched", testing_geqp3<false, true, T>},
+            {"geqrt", testing_geqrt<T>},
+            {"gemqrt", testing_gemqrt<T>},
             // gerqf
             {"gerq2", testing_gerq2_gerqf<false, false, 0, T>},
             {"gerq2_batched", testing_gerq2_gerqf<true, true, 0, T>},
@@ -225,6 +294,10 @@ class rocsolver_dispatcher
             {"gesv", testing_gesv<false, false, T>},
             {"gesv_batched", testing_gesv<true, true, T>},
             {"gesv_strided_batched", testing_gesv<false, true, T>},
+            // gesv_rbt
+            {"gesv_rbt", testing_gesv_rbt<false, false, T>},
+            {"gesv_rbt_batched", testing_gesv_rbt<true, true, T>},
+            {"gesv_rbt_strided_batched", testing_gesv_rbt<false, true, T>},
             // gesvd
             {"gesvd", testing_gesvd<false, false, T>},
             {"gesvd_batched", testing_gesvd<true, true, T>},
@@ -233,6 +306,18 @@ class rocsolver_dispatcher
             {"gesvdj", testing_gesvdj<false, false, T>},
             {"gesvdj_batched", testing_gesvdj<true, true, T>},
             {"gesvdj_strided_batched", testing_gesvdj<false, true, T>},
+            // gesvdr
+            {"gesvdr", testing_gesvdr<false, false, T>},
+            {"gesvdr_batched", testing_gesvdr<true, true, T>},
+            {"gesvdr_strided_batched", testing_gesvdr<false, true, T>},
+            // cholqr
+            {"cholqr", testing_cholqr<false, false, T>},
+            {"cholqr_batched", testing_cholqr<true, true, T>},
+            {"cholqr_strided_batched", testing_cholqr<false, true, T>},
+            // gepolar
+            {"gepolar", testing_gepolar<false, false, T>},
+            {"gepolar_batched", testing_gepolar<true, true, T>},
+            {"gepolar_strided_batched", testing_gepolar<false, true, T>},
             // gesvdx
             {"gesvdx", testing_gesvdx<false, false, T>},
             {"gesvdx_batched", testing_gesvdx<true, true, T>},
@@ -257,10 +342,30 @@ class rocsolver_dispatcher
             {"getri_npvt_outofplace", testing_getri_npvt_outofplace<false, false, T>},
             {"getri_npvt_outofplace_batched", testing_getri_npvt_outofplace<true, true, T>},
             {"getri_npvt_outofplace_strided_batched", testing_getri_npvt_outofplace<false, true, T>},
+            // trcon
+            {"trcon", testing_trcon<false, false, T>},
+            {"trcon_batched", testing_trcon<true, true, T>},
+            {"trcon_strided_batched", testing_trcon<false, true, T>},
+            // gecon
+            {"gecon", testing_gecon<false, false, T>},
+            {"gecon_batched", testing_gecon<true, true, T>},
+            {"gecon_strided_batched", testing_gecon<false, true, T>},
+            // pocon
+            {"pocon", testing_pocon<false, false, T>},
+            {"pocon_batched", testing_pocon<true, true, T>},
+            {"pocon_strided_batched", testing_pocon<false, true, T>},
             // gels
             {"gels", testing_gels<false, false, T>},
             {"gels_batched", testing_gels<true, true, T>},
             {"gels_strided_batched", testing_gels<false, true, T>},
+            // gelsd
+            {"gelsd", testing_gelsd<false, false, T>},
+            {"gelsd_batched", testing_gelsd<true, true, T>},
+            {"gelsd_strided_batched", testing_gelsd<false, true, T>},
+            // gelsy
+            {"gelsy", testing_gelsy<false, false, T>},
+            {"gelsy_batched", testing_gelsy<true, true, T>},
+            {"gelsy_strided_batched", testing_gelsy<false, true, T>},
             // gebrd
             {"gebd2", testing_gebd2_gebrd<false, false, 0, T>},
             {"gebd2_batched", testing_gebd2_gebrd<true, true, 0, T>},
@@ -268,6 +373,41 @@ class rocsolver_dispatcher
             {"gebrd", testing_gebd2_gebrd<false, false, 1, T>},
             {"gebrd_batched", testing_gebd2_gebrd<true, true, 1, T>},
             {"gebrd_strided_batched", testing_gebd2_gebrd<false, true, 1, T>},
+            // gehrd
+            {"gehd2", testing_gehd2_gehrd<false, false, 0, T>},
+            {"gehd2_batched", testing_gehd2_gehrd<true, true, 0, T>},
+            {"gehd2_strided_batched", testing_gehd2_gehrd<false, true, 0, T>},
+            {"gehrd", testing_gehd2_gehrd<false, false, 1, T>},
+            {"gehrd_batched", testing_gehd2_gehrd<true, true, 1, T>},
+            {"gehrd_strided_batched", testing_gehd2_gehrd<false, true, 1, T>},
+            // gbtrf
+            {"gbtrf", testing_gbtrf<false, false, T>},
+            {"gbtrf_batched", testing_gbtrf<true, true, T>},
+            {"gbtrf_strided_batched", testing_gbtrf<false, true, T>},
+            // gbtrs
+            {"gbtrs", testing_gbtrs<false, false, T>},
+            {"gbtrs_batched", testing_gbtrs<true, true, T>},
+            {"gbtrs_strided_batched", testing_gbtrs<false, true, T>},
+            // pbtrf
+            {"pbtrf", testing_pbtrf<false, false, T>},
+            {"pbtrf_batched", testing_pbtrf<true, true, T>},
+            {"pbtrf_strided_batched", testing_pbtrf<false, true, T>},
+            // pbtrs
+            {"pbtrs", testing_pbtrs<false, false, T>},
+            {"pbtrs_batched", testing_pbtrs<true, true, T>},
+            {"pbtrs_strided_batched", testing_pbtrs<false, true, T>},
+            // pftrf
+            {"pftrf", testing_pftrf<false, false, T>},
+            {"pftrf_batched", testing_pftrf<true, true, T>},
+            {"pftrf_strided_batched", testing_pftrf<false, true, T>},
+            // pftrs
+            {"pftrs", testing_pftrs<false, false, T>},
+            {"pftrs_batched", testing_pftrs<true, true, T>},
+            {"pftrs_strided_batched", testing_pftrs<false, true, T>},
+            // pftri
+            {"pftri", testing_pftri<false, false, T>},
+            {"pftri_batched", testing_pftri<true, true, T>},
+            {"pftri_strided_batched", testing_pftri<false, true, T>},
             // sytrf
             {"sytf2", testing_sytf2_sytrf<false, false, 0, T>},
             {"sytf2_batched", testing_sytf2_sytrf<true, true, 0, T>},
@@ -275,6 +415,14 @@ class rocsolver_dispatcher
             {"sytrf", testing_sytf2_sytrf<false, false, 1, T>},
             {"sytrf_batched", testing_sytf2_sytrf<true, true, 1, T>},
             {"sytrf_strided_batched", testing_sytf2_sytrf<false, true, 1, T>},
+            // sytrs
+            {"sytrs", testing_sytrs<false, false, T>},
+            {"sytrs_batched", testing_sytrs<true, true, T>},
+            {"sytrs_strided_batched", testing_sytrs<false, true, T>},
+            // sysv
+            {"sysv", testing_sysv<false, false, T>},
+            {"sysv_batched", testing_sysv<true, true, T>},
+            {"sysv_strided_batched", testing_sysv<false, true, T>},
             // geblttrf_npvt
             {"geblttrf_npvt", testing_geblttrf_npvt<false, false, T>},
             {"geblttrf_npvt_batched", testing_geblttrf_npvt<true, true, T>},
@@ -307,6 +455,7 @@ class rocsolver_dispatcher
             // orgxx
             {"org2r", testing_orgxr_ungxr<T, 0>},
             {"orgqr", testing_orgxr_ungxr<T, 1>},
+            {"orgqr_outofplace", testing_orgqr_ungqr_outofplace<T>},
             {"org2l", testing_orgxl_ungxl<T, 0>},
             {"orgql", testing_orgxl_ungxl<T, 1>},
             {"orgl2", testing_orglx_unglx<T, 0>},
@@ -340,6 +489,12 @@ class rocsolver_dispatcher
             {"syev", testing_syev_heev<false, false, T>},
             {"syev_batched", testing_syev_heev<true, true, T>},
             {"syev_strided_batched", testing_syev_heev<false, true, T>},
+            {"syev_auto", testing_syev_heev_auto<false, false, T>},
+            {"syev_auto_batched", testing_syev_heev_auto<true, true, T>},
+            {"syev_auto_strided_batched", testing_syev_heev_auto<false, true, T>},
+            {"syev_refine", testing_syev_heev_refine<false, false, T>},
+            {"syev_refine_batched", testing_syev_heev_refine<true, true, T>},
+            {"syev_refine_strided_batched", testing_syev_heev_refine<false, true, T>},
             // syevd
             {"syevd", testing_syevd_heevd<false, false, T>},
             {"syevd_batched", testing_syevd_heevd<true, true, T>},
@@ -352,6 +507,8 @@ class rocsolver_dispatcher
             {"syevj", testing_syevj_heevj<false, false, T>},
             {"syevj_batched", testing_syevj_heevj<true, true, T>},
             {"syevj_strided_batched", testing_syevj_heevj<false, true, T>},
+            // syevs
+            {"syevs", testing_syevs_heevs<T>},
             // syevx
             {"syevx", testing_syevx_heevx<false, false, T>},
             {"syevx_batched", testing_syevx_heevx<true, true, T>},
@@ -364,6 +521,9 @@ class rocsolver_dispatcher
             {"sygv", testing_sygv_hegv<false, false, T>},
             {"sygv_batched", testing_sygv_hegv<true, true, T>},
             {"sygv_strided_batched", testing_sygv_hegv<false, true, T>},
+            {"sygv_auto", testing_sygv_hegv_auto<false, false, T>},
+            {"sygv_auto_batched", testing_sygv_hegv_auto<true, true, T>},
+            {"sygv_auto_strided_batched", testing_sygv_hegv_auto<false, true, T>},
             // sygvd
             {"sygvd", testing_sygvd_hegvd<false, false, T>},
             {"sygvd_batched", testing_sygvd_hegvd<true, true, T>},
@@ -387,10 +547,16 @@ class rocsolver_dispatcher
             // refactorization
             {"csrrf_analysis", testing_csrrf_analysis<T>},
             {"csrrf_sumlu", testing_csrrf_sumlu<T>},
-            {"csrrf_splitlu", testing_csrrf_splitlu<T>},
-            {"csrrf_refactlu", testing_csrrf_refactlu<T>},
-            {"csrrf_refactchol", testing_csrrf_refactchol<T>},
-            {"csrrf_solve", testing_csrrf_solve<T>},
+            {"csrrf_splitlu", testing_csrrf_splitlu<false, T>},
+            {"csrrf_splitlu_strided_batched", testing_csrrf_splitlu<true, T>},
+            {"csrrf_refactlu", testing_csrrf_refactlu<false, T>},
+            {"csrrf_refactlu_strided_batched", testing_csrrf_refactlu<true, T>},
+            {"csrrf_refactchol", testing_csrrf_refactchol<false, T>},
+            {"csrrf_refactchol_strided_batched", testing_csrrf_refactchol<true, T>},
+            {"csrrf_solve", testing_csrrf_solve<false, T>},
+            {"csrrf_solve_strided_batched", testing_csrrf_solve<true, T>},
+            {"csrrf_refactsolve", testing_csrrf_refactsolve<T>},
+            {"csrrf_refactlu_workflow", testing_csrrf_refactlu_workflow<T>},
         };
 
         // Grab function from the map and execute
@@ -413,6 +579,7 @@ class rocsolver_dispatcher
             // ungxx
             {"ung2r", testing_orgxr_ungxr<T, 0>},
             {"ungqr", testing_orgxr_ungxr<T, 1>},
+            {"ungqr_outofplace", testing_orgqr_ungqr_outofplace<T>},
             {"ung2l", testing_orgxl_ungxl<T, 0>},
             {"ungql", testing_orgxl_ungxl<T, 1>},
             {"ungl2", testing_orglx_unglx<T, 0>},
@@ -446,6 +613,12 @@ class rocsolver_dispatcher
             {"heev", testing_syev_heev<false, false, T>},
             {"heev_batched", testing_syev_heev<true, true, T>},
             {"heev_strided_batched", testing_syev_heev<false, true, T>},
+            {"heev_auto", testing_syev_heev_auto<false, false, T>},
+            {"heev_auto_batched", testing_syev_heev_auto<true, true, T>},
+            {"heev_auto_strided_batched", testing_syev_heev_auto<false, true, T>},
+            {"heev_refine", testing_syev_heev_refine<false, false, T>},
+            {"heev_refine_batched", testing_syev_heev_refine<true, true, T>},
+            {"heev_refine_strided_batched", testing_syev_heev_refine<false, true, T>},
             // heevd
             {"heevd", testing_syevd_heevd<false, false, T>},
             {"heevd_batched", testing_syevd_heevd<true, true, T>},
@@ -458,6 +631,8 @@ class rocsolver_dispatcher
             {"heevj", testing_syevj_heevj<false, false, T>},
             {"heevj_batched", testing_syevj_heevj<true, true, T>},
             {"heevj_strided_batched", testing_syevj_heevj<false, true, T>},
+            // heevs
+            {"heevs", testing_syevs_heevs<T>},
             // heevx
             {"heevx", testing_syevx_heevx<false, false, T>},
             {"heevx_batched", testing_syevx_heevx<true, true, T>},
@@ -470,6 +645,9 @@ class rocsolver_dispatcher
             {"hegv", testing_sygv_hegv<false, false, T>},
             {"hegv_batched", testing_sygv_hegv<true, true, T>},
             {"hegv_strided_batched", testing_sygv_hegv<false, true, T>},
+            {"hegv_auto", testing_sygv_hegv_auto<false, false, T>},
+            {"hegv_auto_batched", testing_sygv_hegv_auto<true, true, T>},
+            {"hegv_auto_strided_batched", testing_sygv_hegv_auto<false, true, T>},
             // hegvd
             {"hegvd", testing_sygvd_hegvd<false, false, T>},
             {"hegvd_batched", testing_sygvd_hegvd<true, true, T>},
@@ -503,6 +681,60 @@ class rocsolver_dispatcher
             return rocblas_status_invalid_value;
     }
 
+    template <typename T>
+    static rocblas_status run_function_mixed_precision(const char* name, Arguments& argus)
+    {
+        // Map for functions that support only double and double-complex precisions
+        // (the lower precision is used internally)
+        static const func_map map_mixed = {
+            // gesv_mixed
+            {"gesv_mixed", testing_gesv_mixed<false, false, T>},
+            {"gesv_mixed_batched", testing_gesv_mixed<true, true, T>},
+            {"gesv_mixed_strided_batched", testing_gesv_mixed<false, true, T>},
+            // posv_mixed
+            {"posv_mixed", testing_posv_mixed<false, false, T>},
+            {"posv_mixed_batched", testing_posv_mixed<true, true, T>},
+            {"posv_mixed_strided_batched", testing_posv_mixed<false, true, T>},
+            // gels_mixed
+            {"gels_mixed", testing_gels_mixed<false, false, T>},
+            {"gels_mixed_batched", testing_gels_mixed<true, true, T>},
+            {"gels_mixed_strided_batched", testing_gels_mixed<false, true, T>},
+        };
+
+        // Grab function from the map and execute
+        auto match = map_mixed.find(name);
+        if(match != map_mixed.end())
+        {
+            match->second(argus);
+            return rocblas_status_success;
+        }
+        else
+            return rocblas_status_invalid_value;
+    }
+
+    template <typename T>
+    static rocblas_status run_function_low_precision(const char* name, Arguments& argus)
+    {
+        // Map for functions that support half and bfloat16 storage
+        // (single precision is used internally)
+        static const func_map map_lowprec = {
+            {"getrf_strided_batched", testing_getrf_lowprec<false, T>},
+            {"getrf_npvt_strided_batched", testing_getrf_lowprec<true, T>},
+            {"getrs_strided_batched", testing_getrs_lowprec<T>},
+            {"potrf_strided_batched", testing_potrf_lowprec<T>},
+        };
+
+        // Grab function from the map and execute
+        auto match = map_lowprec.find(name);
+        if(match != map_lowprec.end())
+        {
+            match->second(argus);
+            return rocblas_status_success;
+        }
+        else
+            return rocblas_status_invalid_value;
+    }
+
 public:
     static void invoke(const std::string& name, char precision, Arguments& argus)
     {
@@ -516,6 +748,10 @@ public:
             status = run_function<rocblas_float_complex>(name.c_str(), argus);
         else if(precision == 'z')
             status = run_function<rocblas_double_complex>(name.c_str(), argus);
+        else if(precision == 'h')
+            status = run_function_low_precision<rocblas_half>(name.c_str(), argus);
+        else if(precision == 'b')
+            status = run_function_low_precision<rocblas_bfloat16>(name.c_str(), argus);
         else
             throw std::invalid_argument("Invalid value for --precision");
 
@@ -531,6 +767,14 @@ public:
                 status = run_function_limited_precision<rocblas_double_complex>(name.c_str(), argus);
         }
 
+        if(status == rocblas_status_invalid_value)
+        {
+            if(precision == 'd')
+                status = run_function_mixed_precision<double>(name.c_str(), argus);
+            else if(precision == 'z')
+                status = run_function_mixed_precision<rocblas_double_complex>(name.c_str(), argus);
+        }
+
         if(status == rocblas_status_invalid_value)
         {
             std::string msg = "Invalid combination --function ";
@@ -0,0 +1,311 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <initializer_list>
+#include <stdexcept>
+#include <string>
+
+#include <rocblas/rocblas.h>
+
+#include "common/misc/rocsolver_arguments.hpp"
+
+/*
+ * ===========================================================================
+ *    Performance models of the benchmarked functions. The flop counts are the
+ *    nominal counts of LAPACK Working Note 41 (complex multiplications and
+ *    additions count as 6 and 2 real flops), and the byte counts are the
+ *    minimum memory traffic of the function (reading and writing every
+ *    matrix argument once). Together with the nominal peaks of the device,
+ *    they give the fraction of the roofline achieved by a benchmark.
+ * ===========================================================================
+ */
+
+struct rocsolver_perf_cost
+{
+    double fmuls;
+    double fadds;
+    // number of elements read and written
+    double elems;
+};
+
+// LU factorization of an m-by-n matrix
+inline rocsolver_perf_cost rocsolver_perf_getrf(double m, double n)
+{
+    double k = std::min(m, n), l = std::max(m, n);
+    return {0.5 * k * (k * (l - k / 3 - 1) + l) + 2 * k / 3,
+            0.5 * k * (k * (l - k / 3) - l) + k / 6, 2 * m * n};
+}
+
+// Cholesky factorization of an n-by-n matrix
+inline rocsolver_perf_cost rocsolver_perf_potrf(double n)
+{
+    return {n * ((n / 6 + 0.5) * n + 1. / 3), n * (n * n / 6 - 1. / 6), n * n};
+}
+
+// QR factorization of an m-by-n matrix (the LQ factorization of an m-by-n matrix has the cost
+// of the QR factorization of an n-by-m matrix)
+inline rocsolver_perf_cost rocsolver_perf_geqrf(double m, double n)
+{
+    if(m > n)
+        return {n * (n * (0.5 - n / 3 + m) + m + 23. / 6), n * (n * (0.5 - n / 3 + m) + 5. / 6),
+                2 * m * n};
+    else
+        return {m * (m * (-0.5 - m / 3 + n) + 2 * n + 23. / 6),
+                m * (m * (-0.5 - m / 3 + n) + n + 5. / 6), 2 * m * n};
+}
+
+// solution of n-by-n LU-, LDL'- or Cholesky-factorized systems with nrhs right-hand sides
+inline rocsolver_perf_cost rocsolver_perf_getrs(double n, double nrhs, bool cholesky)
+{
+    return {nrhs * n * (cholesky ? n + 1 : n), nrhs * n * (n - 1), n * n + 2 * n * nrhs};
+}
+
+// inversion of an n-by-n triangular matrix
+inline rocsolver_perf_cost rocsolver_perf_trtri(double n)
+{
+    return {n * (n * (n / 6 + 0.5) + 1. / 3), n * (n * (n / 6 - 0.5) + 1. / 3), n * n};
+}
+
+// inversion of an n-by-n matrix from its LU factorization
+inline rocsolver_perf_cost rocsolver_perf_getri(double n)
+{
+    return {n * ((5. / 6 * n + 0.5) * n + 2. / 3), n * ((5. / 6 * n - 1.5) * n + 5. / 6),
+            2 * n * n};
+}
+
+// inversion of an n-by-n matrix from its Cholesky factorization
+inline rocsolver_perf_cost rocsolver_perf_potri(double n)
+{
+    return {n * ((2. / 3 * n + 0.5) * n + 5. / 6), n * ((2. / 3 * n - 1.5) * n + 5. / 6), n * n};
+}
+
+// generation of the m-by-n matrix Q with orthonormal columns from k Householder vectors
+inline rocsolver_perf_cost rocsolver_perf_orgqr(double m, double n, double k)
+{
+    return {k * (2 * m * n + 2 * n - 5. / 3 + k * (2. / 3 * k - (m + n) - 1)),
+            k * (2 * m * n + n - m + 1. / 3 + k * (2. / 3 * k - (m + n))), m * n + m * k};
+}
+
+// multiplication of an m-by-n matrix by the orthogonal matrix Q defined by k Householder vectors
+inline rocsolver_perf_cost rocsolver_perf_ormqr(double m, double n, double k, bool left)
+{
+    double q = left ? m : n;
+    if(left)
+        return {2 * n * m * k - n * k * k + 2 * n * k, 2 * n * m * k - n * k * k + n * k,
+                2 * m * n + q * k};
+    else
+        return {2 * n * m * k - m * k * k + m * k + n * k - 0.5 * k * k + 0.5 * k,
+                2 * n * m * k - m * k * k + m * k, 2 * m * n + q * k};
+}
+
+// reduction of an n-by-n symmetric/hermitian matrix to tridiagonal form
+inline rocsolver_perf_cost rocsolver_perf_sytrd(double n)
+{
+    if(n <= 0)
+        return {0, 0, 0};
+    return {n * (n * (2. / 3 * n + 2.5) - 1. / 6) - 15, n * (n * (2. / 3 * n + 1) - 8. / 3) - 4,
+            n * n};
+}
+
+// reduction of an m-by-n matrix to bidiagonal form
+inline rocsolver_perf_cost rocsolver_perf_gebrd(double m, double n)
+{
+    if(m >= n)
+        return {n * (n * (2 * m - 2. / 3 * n + 2) + 20. / 3),
+                n * (n * (2 * m - 2. / 3 * n + 1) - m + 5. / 3), 2 * m * n};
+    else
+        return {m * (m * (2 * n - 2. / 3 * m + 2) + 20. / 3),
+                m * (m * (2 * n - 2. / 3 * m + 1) - n + 5. / 3), 2 * m * n};
+}
+
+// Bunch-Kaufman factorization of an n-by-n symmetric matrix
+inline rocsolver_perf_cost rocsolver_perf_sytrf(double n)
+{
+    return {n * (n * (n / 6 + 0.5) + 10. / 3), n * (n * n / 6 - 1. / 6), n * n};
+}
+
+// reduction of a symmetric-definite generalized eigenproblem of size n to standard form
+inline rocsolver_perf_cost rocsolver_perf_sygst(double n)
+{
+    return {0.5 * n * n * n, 0.5 * n * n * n, 2 * n * n};
+}
+
+/** Computes the nominal flop count and the minimum memory traffic in bytes of the given
+    function for the sizes in argus. Returns false if the function has no model (e.g. the
+    iterative eigensolvers, whose cost depends on the data). **/
+inline bool rocsolver_perf_model(const std::string& function,
+                                 char precision,
+                                 const Arguments& argus,
+                                 double& flops,
+                                 double& bytes)
+{
+    std::string base = function;
+    auto strip = [&base](const std::string& suffix) {
+        size_t len = suffix.size();
+        bool found = base.size() > len && base.compare(base.size() - len, len, suffix) == 0;
+        if(found)
+            base.resize(base.size() - len);
+        return found;
+    };
+    strip("_64");
+    double bc = 1;
+    if(strip("_strided_batched") || strip("_batched"))
+        bc = argus.peek<rocblas_int>("batch_count", 1);
+    strip("_64");
+    for(const char* suffix : {"_outofplace", "_mixed", "_ptr"})
+        strip(suffix);
+
+    auto is = [&base](std::initializer_list<const char*> names) {
+        return std::find(names.begin(), names.end(), base) != names.end();
+    };
+    auto arg = [&argus](const char* name, double default_value) {
+        return double(argus.peek<rocblas_int>(name, rocblas_int(default_value)));
+    };
+
+    // the sizes are defaulted as in the testers
+    double m = arg("m", 0), n = arg("n", m), k;
+    rocsolver_perf_cost c{};
+    if(is({"getf2", "getrf", "getf2_npvt", "getrf_npvt"}))
+        c = rocsolver_perf_getrf(m, n);
+    else if(is({"potf2", "potrf"}))
+        c = rocsolver_perf_potrf(n);
+    else if(is({"geqr2", "geqrf", "geql2", "geqlf", "geqrt"}))
+        c = rocsolver_perf_geqrf(m, n);
+    else if(is({"gelq2", "gelqf", "gerq2", "gerqf"}))
+    {
+        c = rocsolver_perf_geqrf(n, m);
+        c.elems = 2 * m * n;
+    }
+    else if(is({"getrs", "potrs", "sytrs"}))
+        c = rocsolver_perf_getrs(n, arg("nrhs", n), base == "potrs");
+    else if(is({"gesv", "posv", "sysv"}))
+    {
+        double nrhs = arg("nrhs", n);
+        c = rocsolver_perf_getrs(n, nrhs, base == "posv");
+        rocsolver_perf_cost f = rocsolver_perf_getrf(n, n);
+        if(base == "posv")
+            f = rocsolver_perf_potrf(n);
+        else if(base == "sysv")
+            f = rocsolver_perf_sytrf(n);
+        c.fmuls += f.fmuls;
+        c.fadds += f.fadds;
+    }
+    else if(is({"trtri"}))
+        c = rocsolver_perf_trtri(n);
+    else if(is({"getri", "getri_npvt"}))
+        c = rocsolver_perf_getri(n);
+    else if(is({"potri"}))
+        c = rocsolver_perf_potri(n);
+    else if(is({"lauum"}))
+    {
+        rocsolver_perf_cost p = rocsolver_perf_potri(n), t = rocsolver_perf_trtri(n);
+        c = {p.fmuls - t.fmuls, p.fadds - t.fadds, n * n};
+    }
+    else if(is({"org2r", "orgqr", "ung2r", "ungqr", "org2l", "orgql", "ung2l", "ungql",
+                "orgqr_outofplace", "ungqr_outofplace"}))
+    {
+        m = arg("m", n);
+        c = rocsolver_perf_orgqr(m, n, arg("k", n));
+    }
+    else if(is({"orgl2", "orglq", "ungl2", "unglq"}))
+    {
+        m = arg("m", 0);
+        n = arg("n", m);
+        c = rocsolver_perf_orgqr(n, m, arg("k", m));
+    }
+    else if(is({"orm2r", "ormqr", "unm2r", "unmqr", "orm2l", "ormql", "unm2l", "unmql", "orml2",
+                "ormlq", "unml2", "unmlq"}))
+    {
+        bool left = argus.peek<char>("side", 'L') == 'L';
+        if(!left)
+        {
+            n = arg("n", 0);
+            m = arg("m", n);
+        }
+        k = arg("k", left ? m : n);
+        c = rocsolver_perf_ormqr(m, n, k, left);
+    }
+    else if(is({"sytd2", "sytrd", "hetd2", "hetrd"}))
+        c = rocsolver_perf_sytrd(n);
+    else if(is({"gebd2", "gebrd"}))
+        c = rocsolver_perf_gebrd(m, n);
+    else if(is({"sytf2", "sytrf"}))
+        c = rocsolver_perf_sytrf(n);
+    else if(is({"sygs2", "sygst", "hegs2", "hegst"}))
+        c = rocsolver_perf_sygst(n);
+    else
+        return false;
+
+    bool complex = (precision == 'c' || precision == 'z');
+    double size = (precision == 'h' || precision == 'b') ? 2
+                  : (precision == 's' || precision == 'c') ? 4
+                                                             : 8;
+    if(complex)
+        size *= 2;
+
+    flops = bc * (complex ? 6 * c.fmuls + 2 * c.fadds : c.fmuls + c.fadds);
+    bytes = bc * c.elems * size;
+    return true;
+}
+
+struct rocsolver_device_peaks
+{
+    // nominal vector (non-matrix-core) peaks in GFLOP/s
+    double gflops_fp32;
+    double gflops_fp64;
+    // nominal memory bandwidth in GB/s
+    double gbytes;
+};
+
+/** Returns the nominal peaks of the given device, computed from the clock rates, compute unit
+    count and memory bus width reported by hipDeviceProp and the vector flops per clock and
+    compute unit of its architecture. **/
+inline rocsolver_device_peaks rocsolver_get_device_peaks(int device_id)
+{
+    hipDeviceProp_t props;
+    if(hipGetDeviceProperties(&props, device_id) != hipSuccess)
+        throw std::runtime_error("Could not query the device properties");
+    std::string arch(props.gcnArchName);
+
+    // flops per clock and compute unit (FMA counted as two flops)
+    double fp32 = 128, fp64 = 64;
+    if(arch.compare(0, 6, "gfx90a") == 0)
+        fp32 = 256, fp64 = 128;
+    else if(arch.compare(0, 5, "gfx94") == 0 || arch.compare(0, 5, "gfx95") == 0)
+        fp32 = 256, fp64 = 128;
+    else if(arch.compare(0, 5, "gfx10") == 0)
+        fp32 = 128, fp64 = 8;
+    else if(arch.compare(0, 5, "gfx11") == 0 || arch.compare(0, 5, "gfx12") == 0)
+        fp32 = 256, fp64 = 8;
+
+    double gclocks = double(props.clockRate) * 1e-6 * props.multiProcessorCount;
+    return {fp32 * gclocks, fp64 * gclocks,
+            2. * props.memoryClockRate * 1e-6 * props.memoryBusWidth / 8};
+}
@@ -27,11 +27,15 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstdarg>
 #include <cstdio>
 #include <cstdlib>
+#include <functional>
 #include <ostream>
 #include <stdexcept>
+#include <string>
+#include <vector>
 
 #if __has_include(<filesystem>)
 #include <filesystem>
@@ -45,6 +49,9 @@ namespace fs = std::experimental::filesystem;
 #include <fmt/ostream.h>
 #include <fmt/ranges.h>
 #include <rocblas/rocblas.h>
+#include <rocsolver/rocsolver.h>
+
+#include "common_host_helpers.hpp"
 
 // If USE_ROCBLAS_REALLOC_ON_DEMAND is false, automatic reallocation is disable and we will manually
 // reallocate workspace
@@ -91,15 +98,239 @@ inline void format_bench_table(std::string& str, T arg, Ts... args)
     format_bench_table(str, args...);
 }
 
+// if set, the rows output by rocsolver_bench_output are appended to this vector instead of being
+// printed (the benchmark suite and the multi-stream benchmarks use it to collect the timings)
+inline thread_local std::vector<std::string>* rocsolver_bench_capture = nullptr;
+
 template <typename... Ts>
 void rocsolver_bench_output(Ts... args)
 {
     std::string table_row;
     format_bench_table(table_row, args...);
+    if(rocsolver_bench_capture)
+    {
+        rocsolver_bench_capture->push_back(table_row);
+        return;
+    }
     std::puts(table_row.c_str());
     std::fflush(stdout);
 }
 
+/* Breakdown of the benchmark timings, filled in by the testers. Only the average hot call is
+   measured unless rocsolver-bench is run with --breakdown. All the times are in microseconds. */
+struct rocsolver_bench_breakdown_data
+{
+    bool enabled = false;
+
+    // first call of the test (including code object loading and workspace allocation)
+    double first_call_us = 0;
+    // average hot call, with the input data freshly copied to the device
+    double hot_us = 0;
+    // average hot call after flushing the L2 cache
+    double cold_l2_us = 0;
+    // average time until the hot calls return control to the host
+    double host_us = 0;
+    // average time of synchronizing and timing an empty stream
+    double empty_stream_us = 0;
+    // wall-clock times at which the hot calls began and ended
+    double hot_begin_us = 0;
+    double hot_end_us = 0;
+
+    // device buffer overwritten to flush the L2 cache
+    void* flush_buffer = nullptr;
+    size_t flush_size = 0;
+
+    void flush_l2(hipStream_t stream)
+    {
+        if(!flush_buffer)
+        {
+            int device;
+            hipDeviceProp_t props;
+            THROW_IF_HIP_ERROR(hipGetDevice(&device));
+            THROW_IF_HIP_ERROR(hipGetDeviceProperties(&props, device));
+            flush_size = 2 * size_t(std::max(props.l2CacheSize, 1 << 20));
+            THROW_IF_HIP_ERROR(hipMalloc(&flush_buffer, flush_size));
+        }
+        THROW_IF_HIP_ERROR(hipMemsetAsync(flush_buffer, 0, flush_size, stream));
+    }
+
+    void release()
+    {
+        if(flush_buffer)
+            (void)hipFree(flush_buffer);
+        flush_buffer = nullptr;
+    }
+};
+
+inline thread_local rocsolver_bench_breakdown_data rocsolver_bench_breakdown;
+
+/* Device memory used by the first call of a test, recorded when rocsolver-bench is run with
+   --memory. The footprint is the decrease of the free device memory since the test started, and
+   includes the arrays allocated by the test, the memory of its handle and the workspace. */
+struct rocsolver_bench_memory_data
+{
+    bool enabled = false;
+    bool recorded = false;
+
+    // free device memory when the test started
+    size_t baseline_free = 0;
+    // peak workspace requested by the rocSOLVER function (see rocsolver_get_last_call_stats)
+    size_t workspace_bytes = 0;
+    // device memory in use by the test after the first call
+    size_t footprint_bytes = 0;
+
+    void start()
+    {
+        size_t total;
+        THROW_IF_HIP_ERROR(hipMemGetInfo(&baseline_free, &total));
+        enabled = true;
+        recorded = false;
+    }
+
+    void record(rocblas_handle handle)
+    {
+        rocsolver_call_stats stats;
+        size_t free_mem = 0, total = 0;
+        if(rocsolver_get_last_call_stats(handle, &stats) != rocblas_status_success
+           || hipMemGetInfo(&free_mem, &total) != hipSuccess)
+            return;
+
+        workspace_bytes = stats.workspace_size;
+        footprint_bytes = baseline_free > free_mem ? baseline_free - free_mem : 0;
+        recorded = true;
+    }
+};
+
+inline thread_local rocsolver_bench_memory_data rocsolver_bench_memory;
+
+// if set, the tests that support it generate their input data directly on the device (see
+// device_data_initializer.hpp), and neither allocate nor initialize the host copies of the data
+// that are only needed to verify the results or to time the CPU reference
+inline bool rocsolver_bench_device_init = false;
+
+// if set, called by every thread right before its hot calls (the multi-stream benchmarks use it
+// to start the hot calls of all the threads at the same time)
+inline std::function<void()> rocsolver_bench_hot_barrier;
+
+/* Times the first of the cold calls of a test, if the breakdown is enabled, and records the
+   device memory that it used, if requested. It is declared right before the call, and the
+   measurements are taken when it goes out of scope. */
+class rocsolver_bench_first_call
+{
+    rocblas_handle handle;
+    hipStream_t stream = 0;
+    double start = 0;
+    bool active;
+    bool memory;
+
+public:
+    rocsolver_bench_first_call(rocblas_handle handle, int iter)
+        : handle(handle)
+        , active(rocsolver_bench_breakdown.enabled && iter == 0)
+        , memory(rocsolver_bench_memory.enabled && iter == 0)
+    {
+        if(active)
+        {
+            rocblas_get_stream(handle, &stream);
+            start = get_time_us_sync(stream);
+        }
+    }
+
+    ~rocsolver_bench_first_call()
+    {
+        // (the destructor must not throw, so errors are left to the next synchronization)
+        if(active)
+        {
+            (void)hipStreamSynchronize(stream);
+            rocsolver_bench_breakdown.first_call_us = get_time_us_no_sync() - start;
+        }
+        if(memory)
+            rocsolver_bench_memory.record(handle);
+    }
+};
+
+/* Times the hot calls of a test. If the breakdown is enabled, the hot calls are executed a
+   second time after flushing the L2 cache, and the host and empty-stream times are measured;
+   otherwise, it is equivalent to timing each call with get_time_us_sync. */
+class rocsolver_bench_timer
+{
+    hipStream_t stream;
+    int hot_calls;
+    double start_time = 0;
+    double hot_time = 0;
+    double cold_time = 0;
+    double host_time = 0;
+
+public:
+    rocsolver_bench_timer(hipStream_t stream, int hot_calls)
+        : stream(stream)
+        , hot_calls(hot_calls)
+    {
+        if(rocsolver_bench_hot_barrier)
+            rocsolver_bench_hot_barrier();
+        rocsolver_bench_breakdown.hot_begin_us = get_time_us_no_sync();
+    }
+
+    // number of calls to execute
+    int calls() const
+    {
+        return rocsolver_bench_breakdown.enabled ? 2 * hot_calls : hot_calls;
+    }
+
+    void start(int iter)
+    {
+        if(iter >= hot_calls)
+            rocsolver_bench_breakdown.flush_l2(stream);
+        start_time = get_time_us_sync(stream);
+    }
+
+    // returns the time of the call if it is one of the hot calls, and 0 otherwise
+    double stop(int iter)
+    {
+        if(!rocsolver_bench_breakdown.enabled)
+        {
+            double time = get_time_us_sync(stream) - start_time;
+            hot_time += time;
+            return time;
+        }
+
+        double host_end = get_time_us_no_sync();
+        double time = get_time_us_sync(stream) - start_time;
+        if(iter >= hot_calls)
+        {
+            cold_time += time;
+            return 0;
+        }
+        host_time += host_end - start_time;
+        hot_time += time;
+        return time;
+    }
+
+    ~rocsolver_bench_timer()
+    {
+        if(hot_calls <= 0)
+            return;
+
+        rocsolver_bench_breakdown.hot_end_us = get_time_us_no_sync();
+        rocsolver_bench_breakdown.hot_us = hot_time / hot_calls;
+        if(!rocsolver_bench_breakdown.enabled)
+            return;
+
+        constexpr int empty_calls = 10;
+        double empty_time = 0;
+        for(int iter = 0; iter < empty_calls; iter++)
+        {
+            double start = get_time_us_no_sync();
+            (void)hipStreamSynchronize(stream);
+            empty_time += get_time_us_no_sync() - start;
+        }
+
+        rocsolver_bench_breakdown.cold_l2_us = cold_time / hot_calls;
+        rocsolver_bench_breakdown.host_us = host_time / hot_calls;
+        rocsolver_bench_breakdown.empty_stream_us = empty_time / empty_calls;
+    }
+};
+
 inline void rocsolver_bench_header(const char* title)
 {
     fmt::print("\n{:=<44}\n{}\n{:=<44}\n", "", title, "");
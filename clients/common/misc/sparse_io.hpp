@@ -0,0 +1,376 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <fmt/core.h>
+#include <hip/hip_runtime_api.h>
+
+#include "rocsolver_test.hpp"
+
+/*
+ * ===========================================================================
+ *    Readers of the sparse matrices used by the refactorization tests and
+ *    benchmarks. A matrix X in a test case directory can be given as:
+ *    - the text files ptrX, indX and valX of the test data (CSR format);
+ *    - a Matrix Market file X.mtx (real, integer or pattern coordinate
+ *      format, general or symmetric);
+ *    - a binary CSR file X.csr, which is memory-mapped and copied to the
+ *      device without any parsing.
+ *    If there is more than one, X.csr is preferred over X.mtx, and X.mtx over
+ *    the text files.
+ * ===========================================================================
+ */
+
+// A binary CSR file starts with this header, followed by the n + 1 row pointers and the nnz
+// column indices (as zero-based 32-bit integers), and by the nnz values (as floats or doubles,
+// according to value_size) starting at the next offset that is a multiple of 8 bytes.
+struct sparse_csr_header
+{
+    char magic[8]; // "RSLVCSR" and a terminating null character
+    int32_t n;
+    int32_t nnz;
+    int32_t value_size;
+    int32_t reserved;
+};
+
+static constexpr char sparse_csr_magic[8] = "RSLVCSR";
+
+inline size_t sparse_csr_values_offset(int32_t n, int32_t nnz)
+{
+    size_t offset = sizeof(sparse_csr_header) + sizeof(int32_t) * (size_t(n) + 1 + nnz);
+    return (offset + 7) / 8 * 8;
+}
+
+// read-only view of a binary CSR file
+class sparse_csr_file
+{
+    const char* data = nullptr;
+    size_t size = 0;
+#ifdef _WIN32
+    std::vector<char> buffer;
+#endif
+
+    const sparse_csr_header& header() const
+    {
+        return *reinterpret_cast<const sparse_csr_header*>(data);
+    }
+
+    void unmap()
+    {
+#ifndef _WIN32
+        if(data)
+            munmap(const_cast<char*>(data), size);
+#endif
+        data = nullptr;
+    }
+
+public:
+    explicit sparse_csr_file(const std::string& filename)
+    {
+#ifdef _WIN32
+        std::ifstream file(filename, std::ios::binary | std::ios::ate);
+        if(!file)
+            throw std::invalid_argument(
+                fmt::format("Error: Could not open file {} with test data...", filename));
+        size = size_t(file.tellg());
+        buffer.resize(size);
+        file.seekg(0);
+        file.read(buffer.data(), size);
+        data = buffer.data();
+#else
+        int fd = open(filename.c_str(), O_RDONLY);
+        if(fd < 0)
+            throw std::invalid_argument(
+                fmt::format("Error: Could not open file {} with test data...", filename));
+
+        struct stat st;
+        void* map = MAP_FAILED;
+        if(fstat(fd, &st) == 0 && st.st_size > 0)
+        {
+            size = size_t(st.st_size);
+            map = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        }
+        close(fd);
+        if(map == MAP_FAILED)
+            throw std::invalid_argument(
+                fmt::format("Error: Could not map file {} with test data...", filename));
+
+        // the file is read once, from beginning to end, when it is copied to the device
+        madvise(map, size, MADV_SEQUENTIAL);
+        data = static_cast<const char*>(map);
+#endif
+
+        int vsize = size >= sizeof(sparse_csr_header) ? header().value_size : 0;
+        bool valid = size >= sizeof(sparse_csr_header)
+            && std::memcmp(header().magic, sparse_csr_magic, sizeof(sparse_csr_magic)) == 0
+            && header().n >= 0 && header().nnz >= 0
+            && (vsize == int(sizeof(float)) || vsize == int(sizeof(double)))
+            && size >= sparse_csr_values_offset(header().n, header().nnz)
+                    + size_t(header().value_size) * header().nnz;
+        if(!valid)
+        {
+            unmap();
+            throw std::invalid_argument(
+                fmt::format("Error: File {} is not a valid binary CSR file", filename));
+        }
+    }
+
+    ~sparse_csr_file()
+    {
+        unmap();
+    }
+
+    sparse_csr_file(const sparse_csr_file&) = delete;
+    sparse_csr_file& operator=(const sparse_csr_file&) = delete;
+
+    rocblas_int n() const
+    {
+        return header().n;
+    }
+    rocblas_int nnz() const
+    {
+        return header().nnz;
+    }
+    int value_size() const
+    {
+        return header().value_size;
+    }
+    const rocblas_int* ptr() const
+    {
+        return reinterpret_cast<const rocblas_int*>(data + sizeof(sparse_csr_header));
+    }
+    const rocblas_int* ind() const
+    {
+        return ptr() + header().n + 1;
+    }
+    const void* val() const
+    {
+        return data + sparse_csr_values_offset(header().n, header().nnz);
+    }
+};
+
+// reads all the values of a text file
+template <typename V>
+void read_text_values(const std::string& filename, std::vector<V>& values)
+{
+    std::ifstream file(filename);
+    if(!file)
+        throw std::invalid_argument(
+            fmt::format("Error: Could not open file {} with test data...", filename));
+
+    values.clear();
+    V v;
+    while(file >> v)
+        values.push_back(v);
+    if(!file.eof())
+        throw std::out_of_range(
+            fmt::format("Error: Could not read element {} from file {}", values.size(), filename));
+}
+
+// reads a square matrix in Matrix Market coordinate format into (sorted) CSR arrays
+template <typename T>
+void read_matrix_market(const std::string& filename,
+                        rocblas_int& n,
+                        std::vector<rocblas_int>& ptr,
+                        std::vector<rocblas_int>& ind,
+                        std::vector<T>& val)
+{
+    std::ifstream file(filename);
+    if(!file)
+        throw std::invalid_argument(
+            fmt::format("Error: Could not open file {} with test data...", filename));
+
+    std::string line, banner, object, format, field, symmetry;
+    std::getline(file, line);
+    std::transform(line.begin(), line.end(), line.begin(),
+                   [](unsigned char c) { return std::tolower(c); });
+    std::istringstream(line) >> banner >> object >> format >> field >> symmetry;
+    bool pattern = (field == "pattern");
+    bool symmetric = (symmetry == "symmetric");
+    if(banner != "%%matrixmarket" || object != "matrix" || format != "coordinate"
+       || (field != "real" && field != "integer" && !pattern)
+       || (symmetry != "general" && !symmetric))
+        throw std::invalid_argument(
+            fmt::format("Error: File {} is not a supported Matrix Market file", filename));
+
+    // skip comments
+    while(std::getline(file, line) && (line.empty() || line[0] == '%'))
+        ;
+
+    int64_t m, ncols, entries;
+    if(!(std::istringstream(line) >> m >> ncols >> entries) || m != ncols || m < 0 || entries < 0)
+        throw std::invalid_argument(
+            fmt::format("Error: File {} does not contain a square sparse matrix", filename));
+
+    struct entry
+    {
+        rocblas_int row, col;
+        T val;
+    };
+    std::vector<entry> coo;
+    coo.reserve(symmetric ? 2 * entries : entries);
+    for(int64_t e = 0; e < entries; ++e)
+    {
+        int64_t i, j;
+        double v = 1;
+        if(!(file >> i >> j) || (!pattern && !(file >> v)) || i < 1 || i > m || j < 1 || j > m)
+            throw std::out_of_range(
+                fmt::format("Error: Could not read element {} from file {}", e, filename));
+        coo.push_back({rocblas_int(i - 1), rocblas_int(j - 1), T(v)});
+        if(symmetric && i != j)
+            coo.push_back({rocblas_int(j - 1), rocblas_int(i - 1), T(v)});
+    }
+
+    std::sort(coo.begin(), coo.end(), [](const entry& a, const entry& b) {
+        return a.row < b.row || (a.row == b.row && a.col < b.col);
+    });
+
+    n = rocblas_int(m);
+    ptr.assign(n + 1, 0);
+    ind.resize(coo.size());
+    val.resize(coo.size());
+    for(size_t k = 0; k < coo.size(); ++k)
+    {
+        ptr[coo[k].row + 1]++;
+        ind[k] = coo[k].col;
+        val[k] = coo[k].val;
+    }
+    for(rocblas_int i = 0; i < n; ++i)
+        ptr[i + 1] += ptr[i];
+}
+
+// sparse matrix in CSR format read from a test case directory
+template <typename T>
+class sparse_csr_matrix
+{
+    std::unique_ptr<sparse_csr_file> file;
+    std::vector<rocblas_int> hptr, hind;
+    std::vector<T> hval;
+    const rocblas_int* ptr_ = nullptr;
+    const rocblas_int* ind_ = nullptr;
+    const T* val_ = nullptr;
+
+public:
+    rocblas_int n = 0;
+    rocblas_int nnz = 0;
+
+    void read(const fs::path& testcase, const std::string& name)
+    {
+        fs::path bin = testcase / (name + ".csr");
+        fs::path mtx = testcase / (name + ".mtx");
+        if(fs::exists(bin))
+        {
+            file = std::make_unique<sparse_csr_file>(bin.string());
+            n = file->n();
+            nnz = file->nnz();
+            ptr_ = file->ptr();
+            ind_ = file->ind();
+            if(file->value_size() == int(sizeof(T)))
+                val_ = static_cast<const T*>(file->val());
+            else if(file->value_size() == int(sizeof(float)))
+            {
+                const float* v = static_cast<const float*>(file->val());
+                hval.assign(v, v + nnz);
+            }
+            else
+            {
+                const double* v = static_cast<const double*>(file->val());
+                hval.assign(v, v + nnz);
+            }
+        }
+        else if(fs::exists(mtx))
+        {
+            read_matrix_market(mtx.string(), n, hptr, hind, hval);
+            nnz = rocblas_int(hind.size());
+        }
+        else
+        {
+            read_text_values((testcase / ("ptr" + name)).string(), hptr);
+            read_text_values((testcase / ("ind" + name)).string(), hind);
+            read_text_values((testcase / ("val" + name)).string(), hval);
+            n = rocblas_int(hptr.size()) - 1;
+            nnz = rocblas_int(hind.size());
+        }
+
+        if(!file)
+        {
+            ptr_ = hptr.data();
+            ind_ = hind.data();
+        }
+        if(!hval.empty())
+            val_ = hval.data();
+
+        if(n < 0 || ptr_[0] != 0 || ptr_[n] != nnz || (!file && hval.size() != size_t(nnz)))
+            throw std::invalid_argument(
+                fmt::format("Error: Inconsistent CSR arrays for matrix {} in {}", name,
+                            testcase.string()));
+    }
+
+    const rocblas_int* ptr() const
+    {
+        return ptr_;
+    }
+    const rocblas_int* ind() const
+    {
+        return ind_;
+    }
+    const T* val() const
+    {
+        return val_;
+    }
+
+    // copies the arrays as they are (from the mapped file if possible) to the device
+    hipError_t copy_to_device(rocblas_int* dptr, rocblas_int* dind, T* dval) const
+    {
+        hipError_t status = hipMemcpy(dptr, ptr_, sizeof(rocblas_int) * (size_t(n) + 1),
+                                      hipMemcpyHostToDevice);
+        if(status == hipSuccess && nnz > 0)
+            status = hipMemcpy(dind, ind_, sizeof(rocblas_int) * nnz, hipMemcpyHostToDevice);
+        if(status == hipSuccess && nnz > 0)
+            status = hipMemcpy(dval, val_, sizeof(T) * nnz, hipMemcpyHostToDevice);
+        return status;
+    }
+};
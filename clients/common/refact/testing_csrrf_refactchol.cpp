@@ -30,4 +30,4 @@
 #define TESTING_CSRRF_REFACTCHOL(...) \
     template void testing_csrrf_refactchol<__VA_ARGS__>(Arguments&);
 
-INSTANTIATE(TESTING_CSRRF_REFACTCHOL, FOREACH_REAL_TYPE, APPLY_STAMP)
+INSTANTIATE(TESTING_CSRRF_REFACTCHOL, FOREACH_STRIDED_VARIANT, FOREACH_REAL_TYPE, APPLY_STAMP)
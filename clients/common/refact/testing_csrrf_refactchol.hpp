@@ -36,75 +36,99 @@
 #include "common/misc/rocsolver_arguments.hpp"
 #include "common/misc/rocsolver_test.hpp"
 
-template <typename T>
+template <bool STRIDED, typename T>
 void csrrf_refactchol_checkBadArgs(rocblas_handle handle,
                                    const rocblas_int n,
                                    const rocblas_int nnzA,
                                    rocblas_int* ptrA,
                                    rocblas_int* indA,
                                    T valA,
+                                   const rocblas_stride stA,
                                    const rocblas_int nnzT,
                                    rocblas_int* ptrT,
                                    rocblas_int* indT,
                                    T valT,
+                                   const rocblas_stride stT,
                                    rocblas_int* pivQ,
-                                   rocsolver_rfinfo rfinfo)
+                                   rocsolver_rfinfo rfinfo,
+                                   const rocblas_int bc)
 {
     // handle
-    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_refactchol(nullptr, n, nnzA, ptrA, indA, valA, nnzT, ptrT,
-                                                     indT, valT, pivQ, rfinfo),
+    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_refactchol(STRIDED, nullptr, n, nnzA, ptrA, indA, valA,
+                                                     stA, nnzT, ptrT, indT, valT, stT, pivQ, rfinfo,
+                                                     bc),
                           rocblas_status_invalid_handle);
 
     // values
     // N/A
 
     // sizes (only check batch_count if applicable)
-    // N/A
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_refactchol(STRIDED, handle, n, nnzA, ptrA, indA, valA,
+                                                         stA, nnzT, ptrT, indT, valT, stT, pivQ,
+                                                         rfinfo, -1),
+                              rocblas_status_invalid_size);
 
     // pointers
-    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_refactchol(handle, n, nnzA, (rocblas_int*)nullptr, indA,
-                                                     valA, nnzT, ptrT, indT, valT, pivQ, rfinfo),
+    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_refactchol(STRIDED, handle, n, nnzA,
+                                                     (rocblas_int*)nullptr, indA, valA, stA, nnzT,
+                                                     ptrT, indT, valT, stT, pivQ, rfinfo, bc),
                           rocblas_status_invalid_pointer);
-    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_refactchol(handle, n, nnzA, ptrA, (rocblas_int*)nullptr,
-                                                     valA, nnzT, ptrT, indT, valT, pivQ, rfinfo),
+    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_refactchol(STRIDED, handle, n, nnzA, ptrA,
+                                                     (rocblas_int*)nullptr, valA, stA, nnzT, ptrT,
+                                                     indT, valT, stT, pivQ, rfinfo, bc),
                           rocblas_status_invalid_pointer);
-    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_refactchol(handle, n, nnzA, ptrA, indA, (T) nullptr, nnzT,
-                                                     ptrT, indT, valT, pivQ, rfinfo),
+    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_refactchol(STRIDED, handle, n, nnzA, ptrA, indA,
+                                                     (T) nullptr, stA, nnzT, ptrT, indT, valT, stT,
+                                                     pivQ, rfinfo, bc),
                           rocblas_status_invalid_pointer);
-    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_refactchol(handle, n, nnzA, ptrA, indA, valA, nnzT,
-                                                     (rocblas_int*)nullptr, indT, valT, pivQ, rfinfo),
+    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_refactchol(STRIDED, handle, n, nnzA, ptrA, indA, valA,
+                                                     stA, nnzT, (rocblas_int*)nullptr, indT, valT,
+                                                     stT, pivQ, rfinfo, bc),
                           rocblas_status_invalid_pointer);
-    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_refactchol(handle, n, nnzA, ptrA, indA, valA, nnzT, ptrT,
-                                                     (rocblas_int*)nullptr, valT, pivQ, rfinfo),
+    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_refactchol(STRIDED, handle, n, nnzA, ptrA, indA, valA,
+                                                     stA, nnzT, ptrT, (rocblas_int*)nullptr, valT,
+                                                     stT, pivQ, rfinfo, bc),
                           rocblas_status_invalid_pointer);
-    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_refactchol(handle, n, nnzA, ptrA, indA, valA, nnzT, ptrT,
-                                                     indT, (T) nullptr, pivQ, rfinfo),
+    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_refactchol(STRIDED, handle, n, nnzA, ptrA, indA, valA,
+                                                     stA, nnzT, ptrT, indT, (T) nullptr, stT, pivQ,
+                                                     rfinfo, bc),
                           rocblas_status_invalid_pointer);
-    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_refactchol(handle, n, nnzA, ptrA, indA, valA, nnzT, ptrT,
-                                                     indT, valT, (rocblas_int*)nullptr, rfinfo),
+    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_refactchol(STRIDED, handle, n, nnzA, ptrA, indA, valA,
+                                                     stA, nnzT, ptrT, indT, valT, stT,
+                                                     (rocblas_int*)nullptr, rfinfo, bc),
                           rocblas_status_invalid_pointer);
-    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_refactchol(handle, n, nnzA, ptrA, indA, valA, nnzT, ptrT,
-                                                     indT, valT, pivQ, nullptr),
+    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_refactchol(STRIDED, handle, n, nnzA, ptrA, indA, valA,
+                                                     stA, nnzT, ptrT, indT, valT, stT, pivQ,
+                                                     nullptr, bc),
                           rocblas_status_invalid_pointer);
 
     // quick return with invalid pointers
-    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_refactchol(handle, 0, nnzA, ptrA, indA, valA, nnzT, ptrT,
-                                                     indT, valT, (rocblas_int*)nullptr, rfinfo),
+    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_refactchol(STRIDED, handle, 0, nnzA, ptrA, indA, valA,
+                                                     stA, nnzT, ptrT, indT, valT, stT,
+                                                     (rocblas_int*)nullptr, rfinfo, bc),
                           rocblas_status_success);
-    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_refactchol(handle, 0, 0, ptrA, (rocblas_int*)nullptr,
-                                                     (T) nullptr, nnzT, ptrT, indT, valT,
-                                                     (rocblas_int*)nullptr, rfinfo),
+    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_refactchol(STRIDED, handle, 0, 0, ptrA,
+                                                     (rocblas_int*)nullptr, (T) nullptr, stA, nnzT,
+                                                     ptrT, indT, valT, stT, (rocblas_int*)nullptr,
+                                                     rfinfo, bc),
                           rocblas_status_success);
-    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_refactchol(handle, 0, nnzA, ptrA, indA, valA, 0, ptrT,
-                                                     (rocblas_int*)nullptr, (T) nullptr,
-                                                     (rocblas_int*)nullptr, rfinfo),
+    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_refactchol(STRIDED, handle, 0, nnzA, ptrA, indA, valA,
+                                                     stA, 0, ptrT, (rocblas_int*)nullptr,
+                                                     (T) nullptr, stT, (rocblas_int*)nullptr,
+                                                     rfinfo, bc),
                           rocblas_status_success);
 
     // quick return with zero batch_count if applicable
-    // N/A
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_refactchol(STRIDED, handle, n, nnzA, ptrA, indA,
+                                                         (T) nullptr, stA, nnzT, ptrT, indT,
+                                                         (T) nullptr, stT, pivQ, rfinfo, 0),
+                              rocblas_status_success);
 }
 
-template <typename T>
+
+template <bool STRIDED, typename T>
 void testing_csrrf_refactchol_bad_arg()
 {
     // safe arguments
@@ -113,6 +137,9 @@ void testing_csrrf_refactchol_bad_arg()
     rocblas_int n = 1;
     rocblas_int nnzA = 1;
     rocblas_int nnzT = 1;
+    rocblas_stride stA = 1;
+    rocblas_stride stT = 1;
+    rocblas_int bc = 1;
 
     // memory allocations
     device_strided_batch_vector<rocblas_int> ptrA(1, 1, 1, 1);
@@ -131,8 +158,9 @@ void testing_csrrf_refactchol_bad_arg()
     CHECK_HIP_ERROR(pivQ.memcheck());
 
     // check bad arguments
-    csrrf_refactchol_checkBadArgs(handle, n, nnzA, ptrA.data(), indA.data(), valA.data(), nnzT,
-                                  ptrT.data(), indT.data(), valT.data(), pivQ.data(), rfinfo);
+    csrrf_refactchol_checkBadArgs<STRIDED>(handle, n, nnzA, ptrA.data(), indA.data(), valA.data(),
+                                           stA, nnzT, ptrT.data(), indT.data(), valT.data(), stT,
+                                           pivQ.data(), rfinfo, bc);
 }
 
 template <bool CPU, bool GPU, typename T, typename Td, typename Ud, typename Th, typename Uh>
@@ -147,6 +175,7 @@ void csrrf_refactchol_initData(rocblas_handle handle,
                                Ud& dindT,
                                Td& dvalT,
                                Ud& dpivQ,
+                               const rocblas_int bc,
                                Uh& hptrA,
                                Uh& hindA,
                                Th& hvalA,
@@ -166,7 +195,7 @@ void csrrf_refactchol_initData(rocblas_handle handle,
         file = testcase / "indA";
         read_matrix(file.string(), 1, nnzA, hindA.data(), 1);
         file = testcase / "valA";
-        read_matrix(file.string(), 1, nnzA, hvalA.data(), 1);
+        read_matrix(file.string(), 1, nnzA, hvalA[0], 1);
 
         // read-in T
         file = testcase / "ptrT";
@@ -174,11 +203,22 @@ void csrrf_refactchol_initData(rocblas_handle handle,
         file = testcase / "indT";
         read_matrix(file.string(), 1, nnzT, hindT.data(), 1);
         file = testcase / "valT";
-        read_matrix(file.string(), 1, nnzT, hvalT.data(), 1);
+        read_matrix(file.string(), 1, nnzT, hvalT[0], 1);
 
         // read-in Q
         file = testcase / "Q";
         read_matrix(file.string(), 1, n, hpivQ.data(), 1);
+
+        // the other instances in the batch are the matrix A scaled by s^2 with s = 2^(b % 4),
+        // so that their Cholesky factors are s * L
+        for(rocblas_int b = 1; b < bc; ++b)
+        {
+            T s = T(1 << (b % 4));
+            for(rocblas_int k = 0; k < nnzA; ++k)
+                hvalA[b][k] = s * s * hvalA[0][k];
+            for(rocblas_int k = 0; k < nnzT; ++k)
+                hvalT[b][k] = s * hvalT[0][k];
+        }
     }
 
     if(GPU)
@@ -193,19 +233,22 @@ void csrrf_refactchol_initData(rocblas_handle handle,
     }
 }
 
-template <typename T, typename Td, typename Ud, typename Th, typename Uh>
+template <bool STRIDED, typename T, typename Td, typename Ud, typename Th, typename Uh>
 void csrrf_refactchol_getError(rocblas_handle handle,
                                const rocblas_int n,
                                const rocblas_int nnzA,
                                Ud& dptrA,
                                Ud& dindA,
                                Td& dvalA,
+                               const rocblas_stride stA,
                                const rocblas_int nnzT,
                                Ud& dptrT,
                                Ud& dindT,
                                Td& dvalT,
+                               const rocblas_stride stT,
                                Ud& dpivQ,
                                rocsolver_rfinfo rfinfo,
+                               const rocblas_int bc,
                                Uh& hptrA,
                                Uh& hindA,
                                Th& hvalA,
@@ -219,8 +262,8 @@ void csrrf_refactchol_getError(rocblas_handle handle,
 {
     // input data initialization
     csrrf_refactchol_initData<true, true, T>(handle, n, nnzA, dptrA, dindA, dvalA, nnzT, dptrT,
-                                             dindT, dvalT, dpivQ, hptrA, hindA, hvalA, hptrT, hindT,
-                                             hvalT, hpivQ, testcase);
+                                             dindT, dvalT, dpivQ, bc, hptrA, hindA, hvalA, hptrT,
+                                             hindT, hvalT, hpivQ, testcase);
 
     // execute computations
     // GPU lapack
@@ -228,30 +271,42 @@ void csrrf_refactchol_getError(rocblas_handle handle,
         handle, n, 0, nnzA, dptrA.data(), dindA.data(), dvalA.data(), nnzT, dptrT.data(),
         dindT.data(), dvalT.data(), dpivQ.data(), dpivQ.data(), (T*)nullptr, n, rfinfo));
 
-    CHECK_ROCBLAS_ERROR(rocsolver_csrrf_refactchol(handle, n, nnzA, dptrA.data(), dindA.data(),
-                                                   dvalA.data(), nnzT, dptrT.data(), dindT.data(),
-                                                   dvalT.data(), dpivQ.data(), rfinfo));
+    // clear the expected results from T, so that every instance must be re-factorized
+    CHECK_HIP_ERROR(hipMemset(dvalT.data(), 0, sizeof(T) * stT * bc));
+
+    CHECK_ROCBLAS_ERROR(rocsolver_csrrf_refactchol(
+        STRIDED, handle, n, nnzA, dptrA.data(), dindA.data(), dvalA.data(), stA, nnzT, dptrT.data(),
+        dindT.data(), dvalT.data(), stT, dpivQ.data(), rfinfo, bc));
 
     CHECK_HIP_ERROR(hvalTres.transfer_from(dvalT));
 
     // compare computed results with original result
-    *max_err = csr_norm_error('F', 'L', n, n, hptrT[0], hindT[0], hvalT[0], hptrT[0], hindT[0],
-                              hvalTres[0]);
+    double err;
+    *max_err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        err = csr_norm_error('F', 'L', n, n, hptrT[0], hindT[0], hvalT[b], hptrT[0], hindT[0],
+                             hvalTres[b]);
+        *max_err = err > *max_err ? err : *max_err;
+    }
 }
 
-template <typename T, typename Td, typename Ud, typename Th, typename Uh>
+template <bool STRIDED, typename T, typename Td, typename Ud, typename Th, typename Uh>
 void csrrf_refactchol_getPerfData(rocblas_handle handle,
                                   const rocblas_int n,
                                   const rocblas_int nnzA,
                                   Ud& dptrA,
                                   Ud& dindA,
                                   Td& dvalA,
+                                  const rocblas_stride stA,
                                   const rocblas_int nnzT,
                                   Ud& dptrT,
                                   Ud& dindT,
                                   Td& dvalT,
+                                  const rocblas_stride stT,
                                   Ud& dpivQ,
                                   rocsolver_rfinfo rfinfo,
+                                  const rocblas_int bc,
                                   Uh& hptrA,
                                   Uh& hindA,
                                   Th& hvalA,
@@ -270,8 +325,8 @@ void csrrf_refactchol_getPerfData(rocblas_handle handle,
     *cpu_time_used = nan(""); // no timing on cpu-lapack execution
 
     csrrf_refactchol_initData<true, true, T>(handle, n, nnzA, dptrA, dindA, dvalA, nnzT, dptrT,
-                                             dindT, dvalT, dpivQ, hptrA, hindA, hvalA, hptrT, hindT,
-                                             hvalT, hpivQ, testcase);
+                                             dindT, dvalT, dpivQ, bc, hptrA, hindA, hvalA, hptrT,
+                                             hindT, hvalT, hpivQ, testcase);
 
     CHECK_ROCBLAS_ERROR(rocsolver_csrrf_analysis(
         handle, n, 0, nnzA, dptrA.data(), dindA.data(), dvalA.data(), nnzT, dptrT.data(),
@@ -281,18 +336,19 @@ void csrrf_refactchol_getPerfData(rocblas_handle handle,
     for(int iter = 0; iter < 2; iter++)
     {
         csrrf_refactchol_initData<false, true, T>(handle, n, nnzA, dptrA, dindA, dvalA, nnzT, dptrT,
-                                                  dindT, dvalT, dpivQ, hptrA, hindA, hvalA, hptrT,
-                                                  hindT, hvalT, hpivQ, testcase);
+                                                  dindT, dvalT, dpivQ, bc, hptrA, hindA, hvalA,
+                                                  hptrT, hindT, hvalT, hpivQ, testcase);
 
-        CHECK_ROCBLAS_ERROR(rocsolver_csrrf_refactchol(handle, n, nnzA, dptrA.data(), dindA.data(),
-                                                       dvalA.data(), nnzT, dptrT.data(), dindT.data(),
-                                                       dvalT.data(), dpivQ.data(), rfinfo));
+        rocsolver_bench_first_call first_call(handle, iter);
+        CHECK_ROCBLAS_ERROR(rocsolver_csrrf_refactchol(
+            STRIDED, handle, n, nnzA, dptrA.data(), dindA.data(), dvalA.data(), stA, nnzT,
+            dptrT.data(), dindT.data(), dvalT.data(), stT, dpivQ.data(), rfinfo, bc));
     }
 
     // gpu-lapack performance
     hipStream_t stream;
     CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
-    double start;
+    rocsolver_bench_timer timer(stream, hot_calls);
 
     if(profile > 0)
     {
@@ -304,21 +360,22 @@ void csrrf_refactchol_getPerfData(rocblas_handle handle,
         rocsolver_log_set_max_levels(profile);
     }
 
-    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    for(rocblas_int iter = 0; iter < timer.calls(); iter++)
     {
         csrrf_refactchol_initData<false, true, T>(handle, n, nnzA, dptrA, dindA, dvalA, nnzT, dptrT,
-                                                  dindT, dvalT, dpivQ, hptrA, hindA, hvalA, hptrT,
-                                                  hindT, hvalT, hpivQ, testcase);
-
-        start = get_time_us_sync(stream);
-        rocsolver_csrrf_refactchol(handle, n, nnzA, dptrA.data(), dindA.data(), dvalA.data(), nnzT,
-                                   dptrT.data(), dindT.data(), dvalT.data(), dpivQ.data(), rfinfo);
-        *gpu_time_used += get_time_us_sync(stream) - start;
+                                                  dindT, dvalT, dpivQ, bc, hptrA, hindA, hvalA,
+                                                  hptrT, hindT, hvalT, hpivQ, testcase);
+
+        timer.start(iter);
+        rocsolver_csrrf_refactchol(STRIDED, handle, n, nnzA, dptrA.data(), dindA.data(),
+                                   dvalA.data(), stA, nnzT, dptrT.data(), dindT.data(),
+                                   dvalT.data(), stT, dpivQ.data(), rfinfo, bc);
+        *gpu_time_used += timer.stop(iter);
     }
     *gpu_time_used /= hot_calls;
 }
 
-template <typename T>
+template <bool STRIDED, typename T>
 void testing_csrrf_refactchol(Arguments& argus)
 {
     // get arguments
@@ -327,21 +384,27 @@ void testing_csrrf_refactchol(Arguments& argus)
     rocblas_int n = argus.get<rocblas_int>("n");
     rocblas_int nnzA = argus.get<rocblas_int>("nnzA");
     rocblas_int nnzT = argus.get<rocblas_int>("nnzT");
+    rocblas_int bc = argus.batch_count;
+    char refactC = argus.get<char>("rfinfo_refact_mode", 'S');
     rocblas_int hot_calls = argus.iters;
 
     CHECK_ROCBLAS_ERROR(rocsolver_set_rfinfo_mode(rfinfo, rocsolver_rfinfo_mode_cholesky));
+    CHECK_ROCBLAS_ERROR(
+        rocsolver_set_rfinfo_refact_mode(rfinfo, char2rocsolver_rfinfo_refact_mode(refactC)));
 
     // check non-supported values
     // N/A
 
     // check invalid sizes
-    bool invalid_size = (n < 0 || nnzA < 0 || nnzT < 0);
+    bool invalid_size = (n < 0 || nnzA < 0 || nnzT < 0 || bc < 0);
     if(invalid_size)
     {
-        EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_refactchol(
-                                  handle, n, nnzA, (rocblas_int*)nullptr, (rocblas_int*)nullptr,
-                                  (T*)nullptr, nnzT, (rocblas_int*)nullptr, (rocblas_int*)nullptr,
-                                  (T*)nullptr, (rocblas_int*)nullptr, rfinfo),
+        EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_refactchol(STRIDED, handle, n, nnzA,
+                                                         (rocblas_int*)nullptr,
+                                                         (rocblas_int*)nullptr, (T*)nullptr, nnzA,
+                                                         nnzT, (rocblas_int*)nullptr,
+                                                         (rocblas_int*)nullptr, (T*)nullptr, nnzT,
+                                                         (rocblas_int*)nullptr, rfinfo, bc),
                               rocblas_status_invalid_size);
 
         if(argus.timing)
@@ -399,14 +462,18 @@ void testing_csrrf_refactchol(Arguments& argus)
         read_last(fileT.string(), &nnzT);
     }
 
+    rocblas_stride stA = argus.get<rocblas_stride>("strideA", nnzA);
+    rocblas_stride stT = argus.get<rocblas_stride>("strideT", nnzT);
+    rocblas_stride stTres = (argus.unit_check || argus.norm_check) ? stT : 0;
+
     // memory size query if necessary
     if(argus.mem_query || !USE_ROCBLAS_REALLOC_ON_DEMAND)
     {
         CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
-        CHECK_ALLOC_QUERY(rocsolver_csrrf_refactchol(handle, n, nnzA, (rocblas_int*)nullptr,
-                                                     (rocblas_int*)nullptr, (T*)nullptr, nnzT,
-                                                     (rocblas_int*)nullptr, (rocblas_int*)nullptr,
-                                                     (T*)nullptr, (rocblas_int*)nullptr, rfinfo));
+        CHECK_ALLOC_QUERY(rocsolver_csrrf_refactchol(
+            STRIDED, handle, n, nnzA, (rocblas_int*)nullptr, (rocblas_int*)nullptr, (T*)nullptr,
+            stA, nnzT, (rocblas_int*)nullptr, (rocblas_int*)nullptr, (T*)nullptr, stT,
+            (rocblas_int*)nullptr, rfinfo, bc));
 
         size_t size;
         CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
@@ -437,19 +504,19 @@ void testing_csrrf_refactchol(Arguments& argus)
     // memory allocations
     host_strided_batch_vector<rocblas_int> hptrA(size_ptrA, 1, size_ptrA, 1);
     host_strided_batch_vector<rocblas_int> hindA(size_indA, 1, size_indA, 1);
-    host_strided_batch_vector<T> hvalA(size_valA, 1, size_valA, 1);
+    host_strided_batch_vector<T> hvalA(size_valA, 1, stA, bc);
     host_strided_batch_vector<rocblas_int> hptrT(size_ptrT, 1, size_ptrT, 1);
     host_strided_batch_vector<rocblas_int> hindT(size_indT, 1, size_indT, 1);
-    host_strided_batch_vector<T> hvalT(size_valT, 1, size_valT, 1);
-    host_strided_batch_vector<T> hvalTres(size_valTres, 1, size_valTres, 1);
+    host_strided_batch_vector<T> hvalT(size_valT, 1, stT, bc);
+    host_strided_batch_vector<T> hvalTres(size_valTres, 1, stTres, bc);
     host_strided_batch_vector<rocblas_int> hpivQ(size_pivQ, 1, size_pivQ, 1);
 
     device_strided_batch_vector<rocblas_int> dptrA(size_ptrA, 1, size_ptrA, 1);
     device_strided_batch_vector<rocblas_int> dindA(size_indA, 1, size_indA, 1);
-    device_strided_batch_vector<T> dvalA(size_valA, 1, size_valA, 1);
+    device_strided_batch_vector<T> dvalA(size_valA, 1, stA, bc);
     device_strided_batch_vector<rocblas_int> dptrT(size_ptrT, 1, size_ptrT, 1);
     device_strided_batch_vector<rocblas_int> dindT(size_indT, 1, size_indT, 1);
-    device_strided_batch_vector<T> dvalT(size_valT, 1, size_valT, 1);
+    device_strided_batch_vector<T> dvalT(size_valT, 1, stT, bc);
     device_strided_batch_vector<rocblas_int> dpivQ(size_pivQ, 1, size_pivQ, 1);
     CHECK_HIP_ERROR(dptrA.memcheck());
     CHECK_HIP_ERROR(dptrT.memcheck());
@@ -465,11 +532,12 @@ void testing_csrrf_refactchol(Arguments& argus)
         CHECK_HIP_ERROR(dpivQ.memcheck());
 
     // check quick return
-    if(n == 0)
+    if(n == 0 || bc == 0)
     {
-        EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_refactchol(
-                                  handle, n, nnzA, dptrA.data(), dindA.data(), dvalA.data(), nnzT,
-                                  dptrT.data(), dindT.data(), dvalT.data(), dpivQ.data(), rfinfo),
+        EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_refactchol(STRIDED, handle, n, nnzA, dptrA.data(),
+                                                         dindA.data(), dvalA.data(), stA, nnzT,
+                                                         dptrT.data(), dindT.data(), dvalT.data(),
+                                                         stT, dpivQ.data(), rfinfo, bc),
                               rocblas_status_success);
         if(argus.timing)
             rocsolver_bench_inform(inform_quick_return);
@@ -479,16 +547,19 @@ void testing_csrrf_refactchol(Arguments& argus)
 
     // check computations
     if(argus.unit_check || argus.norm_check)
-        csrrf_refactchol_getError<T>(handle, n, nnzA, dptrA, dindA, dvalA, nnzT, dptrT, dindT,
-                                     dvalT, dpivQ, rfinfo, hptrA, hindA, hvalA, hptrT, hindT, hvalT,
-                                     hpivQ, hvalTres, &max_error, testcase);
+        csrrf_refactchol_getError<STRIDED, T>(handle, n, nnzA, dptrA, dindA, dvalA, stA, nnzT,
+                                              dptrT, dindT, dvalT, stT, dpivQ, rfinfo, bc, hptrA,
+                                              hindA, hvalA, hptrT, hindT, hvalT, hpivQ, hvalTres,
+                                              &max_error, testcase);
 
     // collect performance data
     if(argus.timing)
-        csrrf_refactchol_getPerfData<T>(handle, n, nnzA, dptrA, dindA, dvalA, nnzT, dptrT, dindT,
-                                        dvalT, dpivQ, rfinfo, hptrA, hindA, hvalA, hptrT, hindT,
-                                        hvalT, hpivQ, &gpu_time_used, &cpu_time_used, hot_calls,
-                                        argus.profile, argus.profile_kernels, argus.perf, testcase);
+        csrrf_refactchol_getPerfData<STRIDED, T>(handle, n, nnzA, dptrA, dindA, dvalA, stA, nnzT,
+                                                 dptrT, dindT, dvalT, stT, dpivQ, rfinfo, bc, hptrA,
+                                                 hindA, hvalA, hptrT, hindT, hvalT, hpivQ,
+                                                 &gpu_time_used, &cpu_time_used, hot_calls,
+                                                 argus.profile, argus.profile_kernels, argus.perf,
+                                                 testcase);
 
     // validate results for rocsolver-test
     // using 2 * n * machine precision for tolerance
@@ -501,8 +572,16 @@ void testing_csrrf_refactchol(Arguments& argus)
         if(!argus.perf)
         {
             rocsolver_bench_header("Arguments:");
-            rocsolver_bench_output("n", "nnzA", "nnzT");
-            rocsolver_bench_output(n, nnzA, nnzT);
+            if(STRIDED)
+            {
+                rocsolver_bench_output("n", "nnzA", "strideA", "nnzT", "strideT", "batch_c");
+                rocsolver_bench_output(n, nnzA, stA, nnzT, stT, bc);
+            }
+            else
+            {
+                rocsolver_bench_output("n", "nnzA", "nnzT");
+                rocsolver_bench_output(n, nnzA, nnzT);
+            }
 
             rocsolver_bench_header("Results:");
             if(argus.norm_check)
@@ -533,4 +612,7 @@ void testing_csrrf_refactchol(Arguments& argus)
 #define EXTERN_TESTING_CSRRF_REFACTCHOL(...) \
     extern template void testing_csrrf_refactchol<__VA_ARGS__>(Arguments&);
 
-INSTANTIATE(EXTERN_TESTING_CSRRF_REFACTCHOL, FOREACH_REAL_TYPE, APPLY_STAMP)
+INSTANTIATE(EXTERN_TESTING_CSRRF_REFACTCHOL,
+            FOREACH_STRIDED_VARIANT,
+            FOREACH_REAL_TYPE,
+            APPLY_STAMP)
@@ -29,4 +29,4 @@
 
 #define TESTING_CSRRF_REFACTLU(...) template void testing_csrrf_refactlu<__VA_ARGS__>(Arguments&);
 
-INSTANTIATE(TESTING_CSRRF_REFACTLU, FOREACH_REAL_TYPE, APPLY_STAMP)
+INSTANTIATE(TESTING_CSRRF_REFACTLU, FOREACH_STRIDED_VARIANT, FOREACH_REAL_TYPE, APPLY_STAMP)
@@ -25,6 +25,7 @@
  * SUCH DAMAGE.
  * *************************************************************************/
 
+
 #pragma once
 
 #include "common/misc/client_util.hpp"
@@ -35,81 +36,104 @@
 #include "common/misc/rocsolver_arguments.hpp"
 #include "common/misc/rocsolver_test.hpp"
 
-template <typename T>
+template <bool STRIDED, typename T>
 void csrrf_refactlu_checkBadArgs(rocblas_handle handle,
                                  const rocblas_int n,
                                  const rocblas_int nnzA,
                                  rocblas_int* ptrA,
                                  rocblas_int* indA,
                                  T valA,
+                                 const rocblas_stride stA,
                                  const rocblas_int nnzT,
                                  rocblas_int* ptrT,
                                  rocblas_int* indT,
                                  T valT,
+                                 const rocblas_stride stT,
                                  rocblas_int* pivP,
                                  rocblas_int* pivQ,
-                                 rocsolver_rfinfo rfinfo)
+                                 rocsolver_rfinfo rfinfo,
+                                 const rocblas_int bc)
 {
     // handle
-    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_refactlu(nullptr, n, nnzA, ptrA, indA, valA, nnzT, ptrT,
-                                                   indT, valT, pivP, pivQ, rfinfo),
+    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_refactlu(STRIDED, nullptr, n, nnzA, ptrA, indA, valA, stA,
+                                                   nnzT, ptrT, indT, valT, stT, pivP, pivQ, rfinfo,
+                                                   bc),
                           rocblas_status_invalid_handle);
 
     // values
     // N/A
 
     // sizes (only check batch_count if applicable)
-    // N/A
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_refactlu(STRIDED, handle, n, nnzA, ptrA, indA, valA,
+                                                       stA, nnzT, ptrT, indT, valT, stT, pivP, pivQ,
+                                                       rfinfo, -1),
+                              rocblas_status_invalid_size);
 
     // pointers
-    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_refactlu(handle, n, nnzA, (rocblas_int*)nullptr, indA,
-                                                   valA, nnzT, ptrT, indT, valT, pivP, pivQ, rfinfo),
+    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_refactlu(STRIDED, handle, n, nnzA, (rocblas_int*)nullptr,
+                                                   indA, valA, stA, nnzT, ptrT, indT, valT, stT,
+                                                   pivP, pivQ, rfinfo, bc),
                           rocblas_status_invalid_pointer);
-    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_refactlu(handle, n, nnzA, ptrA, (rocblas_int*)nullptr,
-                                                   valA, nnzT, ptrT, indT, valT, pivP, pivQ, rfinfo),
+    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_refactlu(STRIDED, handle, n, nnzA, ptrA,
+                                                   (rocblas_int*)nullptr, valA, stA, nnzT, ptrT,
+                                                   indT, valT, stT, pivP, pivQ, rfinfo, bc),
                           rocblas_status_invalid_pointer);
-    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_refactlu(handle, n, nnzA, ptrA, indA, (T) nullptr, nnzT,
-                                                   ptrT, indT, valT, pivP, pivQ, rfinfo),
+    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_refactlu(STRIDED, handle, n, nnzA, ptrA, indA,
+                                                   (T) nullptr, stA, nnzT, ptrT, indT, valT, stT,
+                                                   pivP, pivQ, rfinfo, bc),
                           rocblas_status_invalid_pointer);
-    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_refactlu(handle, n, nnzA, ptrA, indA, valA, nnzT,
-                                                   (rocblas_int*)nullptr, indT, valT, pivP, pivQ,
-                                                   rfinfo),
+    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_refactlu(STRIDED, handle, n, nnzA, ptrA, indA, valA, stA,
+                                                   nnzT, (rocblas_int*)nullptr, indT, valT, stT,
+                                                   pivP, pivQ, rfinfo, bc),
                           rocblas_status_invalid_pointer);
-    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_refactlu(handle, n, nnzA, ptrA, indA, valA, nnzT, ptrT,
-                                                   (rocblas_int*)nullptr, valT, pivP, pivQ, rfinfo),
+    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_refactlu(STRIDED, handle, n, nnzA, ptrA, indA, valA, stA,
+                                                   nnzT, ptrT, (rocblas_int*)nullptr, valT, stT,
+                                                   pivP, pivQ, rfinfo, bc),
                           rocblas_status_invalid_pointer);
-    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_refactlu(handle, n, nnzA, ptrA, indA, valA, nnzT, ptrT,
-                                                   indT, (T) nullptr, pivP, pivQ, rfinfo),
+    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_refactlu(STRIDED, handle, n, nnzA, ptrA, indA, valA, stA,
+                                                   nnzT, ptrT, indT, (T) nullptr, stT, pivP, pivQ,
+                                                   rfinfo, bc),
                           rocblas_status_invalid_pointer);
-    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_refactlu(handle, n, nnzA, ptrA, indA, valA, nnzT, ptrT,
-                                                   indT, valT, (rocblas_int*)nullptr, pivQ, rfinfo),
+    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_refactlu(STRIDED, handle, n, nnzA, ptrA, indA, valA, stA,
+                                                   nnzT, ptrT, indT, valT, stT,
+                                                   (rocblas_int*)nullptr, pivQ, rfinfo, bc),
                           rocblas_status_invalid_pointer);
-    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_refactlu(handle, n, nnzA, ptrA, indA, valA, nnzT, ptrT,
-                                                   indT, valT, pivP, (rocblas_int*)nullptr, rfinfo),
+    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_refactlu(STRIDED, handle, n, nnzA, ptrA, indA, valA, stA,
+                                                   nnzT, ptrT, indT, valT, stT, pivP,
+                                                   (rocblas_int*)nullptr, rfinfo, bc),
                           rocblas_status_invalid_pointer);
-    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_refactlu(handle, n, nnzA, ptrA, indA, valA, nnzT, ptrT,
-                                                   indT, valT, pivP, pivQ, nullptr),
+    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_refactlu(STRIDED, handle, n, nnzA, ptrA, indA, valA, stA,
+                                                   nnzT, ptrT, indT, valT, stT, pivP, pivQ, nullptr,
+                                                   bc),
                           rocblas_status_invalid_pointer);
 
     // quick return with invalid pointers
-    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_refactlu(handle, 0, nnzA, ptrA, indA, valA, nnzT, ptrT,
-                                                   indT, valT, (rocblas_int*)nullptr,
-                                                   (rocblas_int*)nullptr, rfinfo),
+    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_refactlu(STRIDED, handle, 0, nnzA, ptrA, indA, valA, stA,
+                                                   nnzT, ptrT, indT, valT, stT,
+                                                   (rocblas_int*)nullptr, (rocblas_int*)nullptr,
+                                                   rfinfo, bc),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_refactlu(STRIDED, handle, 0, 0, ptrA,
+                                                   (rocblas_int*)nullptr, (T) nullptr, stA, nnzT,
+                                                   ptrT, indT, valT, stT, (rocblas_int*)nullptr,
+                                                   (rocblas_int*)nullptr, rfinfo, bc),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_refactlu(STRIDED, handle, 0, nnzA, ptrA, indA, valA, stA,
+                                                   0, ptrT, (rocblas_int*)nullptr, (T) nullptr, stT,
+                                                   (rocblas_int*)nullptr, (rocblas_int*)nullptr,
+                                                   rfinfo, bc),
                           rocblas_status_success);
-    EXPECT_ROCBLAS_STATUS(
-        rocsolver_csrrf_refactlu(handle, 0, 0, ptrA, (rocblas_int*)nullptr, (T) nullptr, nnzT, ptrT,
-                                 indT, valT, (rocblas_int*)nullptr, (rocblas_int*)nullptr, rfinfo),
-        rocblas_status_success);
-    EXPECT_ROCBLAS_STATUS(
-        rocsolver_csrrf_refactlu(handle, 0, nnzA, ptrA, indA, valA, 0, ptrT, (rocblas_int*)nullptr,
-                                 (T) nullptr, (rocblas_int*)nullptr, (rocblas_int*)nullptr, rfinfo),
-        rocblas_status_success);
 
     // quick return with zero batch_count if applicable
-    // N/A
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_refactlu(STRIDED, handle, n, nnzA, ptrA, indA,
+                                                       (T) nullptr, stA, nnzT, ptrT, indT,
+                                                       (T) nullptr, stT, pivP, pivQ, rfinfo, 0),
+                              rocblas_status_success);
 }
 
-template <typename T>
+template <bool STRIDED, typename T>
 void testing_csrrf_refactlu_bad_arg()
 {
     // safe arguments
@@ -118,6 +142,9 @@ void testing_csrrf_refactlu_bad_arg()
     rocblas_int n = 1;
     rocblas_int nnzA = 1;
     rocblas_int nnzT = 1;
+    rocblas_stride stA = 1;
+    rocblas_stride stT = 1;
+    rocblas_int bc = 1;
 
     // memory allocations
     device_strided_batch_vector<rocblas_int> ptrA(1, 1, 1, 1);
@@ -138,9 +165,9 @@ void testing_csrrf_refactlu_bad_arg()
     CHECK_HIP_ERROR(pivQ.memcheck());
 
     // check bad arguments
-    csrrf_refactlu_checkBadArgs(handle, n, nnzA, ptrA.data(), indA.data(), valA.data(), nnzT,
-                                ptrT.data(), indT.data(), valT.data(), pivP.data(), pivQ.data(),
-                                rfinfo);
+    csrrf_refactlu_checkBadArgs<STRIDED>(handle, n, nnzA, ptrA.data(), indA.data(), valA.data(),
+                                         stA, nnzT, ptrT.data(), indT.data(), valT.data(), stT,
+                                         pivP.data(), pivQ.data(), rfinfo, bc);
 }
 
 template <bool CPU, bool GPU, typename T, typename Td, typename Ud, typename Th, typename Uh>
@@ -156,6 +183,7 @@ void csrrf_refactlu_initData(rocblas_handle handle,
                              Td& dvalT,
                              Ud& dpivP,
                              Ud& dpivQ,
+                             const rocblas_int bc,
                              Uh& hptrA,
                              Uh& hindA,
                              Th& hvalA,
@@ -176,7 +204,7 @@ void csrrf_refactlu_initData(rocblas_handle handle,
         file = testcase / "indA";
         read_matrix(file.string(), 1, nnzA, hindA.data(), 1);
         file = testcase / "valA";
-        read_matrix(file.string(), 1, nnzA, hvalA.data(), 1);
+        read_matrix(file.string(), 1, nnzA, hvalA[0], 1);
 
         // read-in T
         file = testcase / "ptrT";
@@ -184,7 +212,7 @@ void csrrf_refactlu_initData(rocblas_handle handle,
         file = testcase / "indT";
         read_matrix(file.string(), 1, nnzT, hindT.data(), 1);
         file = testcase / "valT";
-        read_matrix(file.string(), 1, nnzT, hvalT.data(), 1);
+        read_matrix(file.string(), 1, nnzT, hvalT[0], 1);
 
         // read-in P
         file = testcase / "P";
@@ -193,6 +221,20 @@ void csrrf_refactlu_initData(rocblas_handle handle,
         // read-in Q
         file = testcase / "Q";
         read_matrix(file.string(), 1, n, hpivQ.data(), 1);
+
+        // the other instances in the batch are the matrix A scaled by s = 2^(b % 4),
+        // so that their factors are (L - I) + s * U
+        for(rocblas_int b = 1; b < bc; ++b)
+        {
+            T s = T(1 << (b % 4));
+            for(rocblas_int k = 0; k < nnzA; ++k)
+                hvalA[b][k] = s * hvalA[0][k];
+            for(rocblas_int i = 0; i < n; ++i)
+            {
+                for(rocblas_int k = hptrT[0][i]; k < hptrT[0][i + 1]; ++k)
+                    hvalT[b][k] = (hindT[0][k] < i) ? hvalT[0][k] : s * hvalT[0][k];
+            }
+        }
     }
 
     if(GPU)
@@ -208,20 +250,23 @@ void csrrf_refactlu_initData(rocblas_handle handle,
     }
 }
 
-template <typename T, typename Td, typename Ud, typename Th, typename Uh>
+template <bool STRIDED, typename T, typename Td, typename Ud, typename Th, typename Uh>
 void csrrf_refactlu_getError(rocblas_handle handle,
                              const rocblas_int n,
                              const rocblas_int nnzA,
                              Ud& dptrA,
                              Ud& dindA,
                              Td& dvalA,
+                             const rocblas_stride stA,
                              const rocblas_int nnzT,
                              Ud& dptrT,
                              Ud& dindT,
                              Td& dvalT,
+                             const rocblas_stride stT,
                              Ud& dpivP,
                              Ud& dpivQ,
                              rocsolver_rfinfo rfinfo,
+                             const rocblas_int bc,
                              Uh& hptrA,
                              Uh& hindA,
                              Th& hvalA,
@@ -236,8 +281,8 @@ void csrrf_refactlu_getError(rocblas_handle handle,
 {
     // input data initialization
     csrrf_refactlu_initData<true, true, T>(handle, n, nnzA, dptrA, dindA, dvalA, nnzT, dptrT, dindT,
-                                           dvalT, dpivP, dpivQ, hptrA, hindA, hvalA, hptrT, hindT,
-                                           hvalT, hpivP, hpivQ, testcase);
+                                           dvalT, dpivP, dpivQ, bc, hptrA, hindA, hvalA, hptrT,
+                                           hindT, hvalT, hpivP, hpivQ, testcase);
 
     // execute computations
     // GPU lapack
@@ -245,30 +290,42 @@ void csrrf_refactlu_getError(rocblas_handle handle,
         handle, n, 0, nnzA, dptrA.data(), dindA.data(), dvalA.data(), nnzT, dptrT.data(),
         dindT.data(), dvalT.data(), dpivP.data(), dpivQ.data(), (T*)nullptr, n, rfinfo));
 
-    CHECK_ROCBLAS_ERROR(rocsolver_csrrf_refactlu(handle, n, nnzA, dptrA.data(), dindA.data(),
-                                                 dvalA.data(), nnzT, dptrT.data(), dindT.data(),
-                                                 dvalT.data(), dpivP.data(), dpivQ.data(), rfinfo));
+    // clear the expected results from T, so that every instance must be re-factorized
+    CHECK_HIP_ERROR(hipMemset(dvalT.data(), 0, sizeof(T) * stT * bc));
+
+    CHECK_ROCBLAS_ERROR(rocsolver_csrrf_refactlu(
+        STRIDED, handle, n, nnzA, dptrA.data(), dindA.data(), dvalA.data(), stA, nnzT, dptrT.data(),
+        dindT.data(), dvalT.data(), stT, dpivP.data(), dpivQ.data(), rfinfo, bc));
 
     CHECK_HIP_ERROR(hvalTres.transfer_from(dvalT));
 
     // compare computed results with original result
-    *max_err = norm_error('F', 1, nnzT, 1, hvalT[0], hvalTres[0]);
+    double err;
+    *max_err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        err = norm_error('F', 1, nnzT, 1, hvalT[b], hvalTres[b]);
+        *max_err = err > *max_err ? err : *max_err;
+    }
 }
 
-template <typename T, typename Td, typename Ud, typename Th, typename Uh>
+template <bool STRIDED, typename T, typename Td, typename Ud, typename Th, typename Uh>
 void csrrf_refactlu_getPerfData(rocblas_handle handle,
                                 const rocblas_int n,
                                 const rocblas_int nnzA,
                                 Ud& dptrA,
                                 Ud& dindA,
                                 Td& dvalA,
+                                const rocblas_stride stA,
                                 const rocblas_int nnzT,
                                 Ud& dptrT,
                                 Ud& dindT,
                                 Td& dvalT,
+                                const rocblas_stride stT,
                                 Ud& dpivP,
                                 Ud& dpivQ,
                                 rocsolver_rfinfo rfinfo,
+                                const rocblas_int bc,
                                 Uh& hptrA,
                                 Uh& hindA,
                                 Th& hvalA,
@@ -288,8 +345,8 @@ void csrrf_refactlu_getPerfData(rocblas_handle handle,
     *cpu_time_used = nan(""); // no timing on cpu-lapack execution
 
     csrrf_refactlu_initData<true, true, T>(handle, n, nnzA, dptrA, dindA, dvalA, nnzT, dptrT, dindT,
-                                           dvalT, dpivP, dpivQ, hptrA, hindA, hvalA, hptrT, hindT,
-                                           hvalT, hpivP, hpivQ, testcase);
+                                           dvalT, dpivP, dpivQ, bc, hptrA, hindA, hvalA, hptrT,
+                                           hindT, hvalT, hpivP, hpivQ, testcase);
 
     CHECK_ROCBLAS_ERROR(rocsolver_csrrf_analysis(
         handle, n, 0, nnzA, dptrA.data(), dindA.data(), dvalA.data(), nnzT, dptrT.data(),
@@ -299,18 +356,19 @@ void csrrf_refactlu_getPerfData(rocblas_handle handle,
     for(int iter = 0; iter < 2; iter++)
     {
         csrrf_refactlu_initData<false, true, T>(handle, n, nnzA, dptrA, dindA, dvalA, nnzT, dptrT,
-                                                dindT, dvalT, dpivP, dpivQ, hptrA, hindA, hvalA,
+                                                dindT, dvalT, dpivP, dpivQ, bc, hptrA, hindA, hvalA,
                                                 hptrT, hindT, hvalT, hpivP, hpivQ, testcase);
 
+        rocsolver_bench_first_call first_call(handle, iter);
         CHECK_ROCBLAS_ERROR(rocsolver_csrrf_refactlu(
-            handle, n, nnzA, dptrA.data(), dindA.data(), dvalA.data(), nnzT, dptrT.data(),
-            dindT.data(), dvalT.data(), dpivP.data(), dpivQ.data(), rfinfo));
+            STRIDED, handle, n, nnzA, dptrA.data(), dindA.data(), dvalA.data(), stA, nnzT,
+            dptrT.data(), dindT.data(), dvalT.data(), stT, dpivP.data(), dpivQ.data(), rfinfo, bc));
     }
 
     // gpu-lapack performance
     hipStream_t stream;
     CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
-    double start;
+    rocsolver_bench_timer timer(stream, hot_calls);
 
     if(profile > 0)
     {
@@ -322,22 +380,22 @@ void csrrf_refactlu_getPerfData(rocblas_handle handle,
         rocsolver_log_set_max_levels(profile);
     }
 
-    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    for(rocblas_int iter = 0; iter < timer.calls(); iter++)
     {
         csrrf_refactlu_initData<false, true, T>(handle, n, nnzA, dptrA, dindA, dvalA, nnzT, dptrT,
-                                                dindT, dvalT, dpivP, dpivQ, hptrA, hindA, hvalA,
+                                                dindT, dvalT, dpivP, dpivQ, bc, hptrA, hindA, hvalA,
                                                 hptrT, hindT, hvalT, hpivP, hpivQ, testcase);
 
-        start = get_time_us_sync(stream);
-        rocsolver_csrrf_refactlu(handle, n, nnzA, dptrA.data(), dindA.data(), dvalA.data(), nnzT,
-                                 dptrT.data(), dindT.data(), dvalT.data(), dpivP.data(),
-                                 dpivQ.data(), rfinfo);
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        timer.start(iter);
+        rocsolver_csrrf_refactlu(STRIDED, handle, n, nnzA, dptrA.data(), dindA.data(), dvalA.data(),
+                                 stA, nnzT, dptrT.data(), dindT.data(), dvalT.data(), stT,
+                                 dpivP.data(), dpivQ.data(), rfinfo, bc);
+        *gpu_time_used += timer.stop(iter);
     }
     *gpu_time_used /= hot_calls;
 }
 
-template <typename T>
+template <bool STRIDED, typename T>
 void testing_csrrf_refactlu(Arguments& argus)
 {
     // get arguments
@@ -346,19 +404,26 @@ void testing_csrrf_refactlu(Arguments& argus)
     rocblas_int n = argus.get<rocblas_int>("n");
     rocblas_int nnzA = argus.get<rocblas_int>("nnzA");
     rocblas_int nnzT = argus.get<rocblas_int>("nnzT");
+    rocblas_int bc = argus.batch_count;
+    char refactC = argus.get<char>("rfinfo_refact_mode", 'S');
     rocblas_int hot_calls = argus.iters;
 
+    CHECK_ROCBLAS_ERROR(
+        rocsolver_set_rfinfo_refact_mode(rfinfo, char2rocsolver_rfinfo_refact_mode(refactC)));
+
     // check non-supported values
     // N/A
 
     // check invalid sizes
-    bool invalid_size = (n < 0 || nnzA < 0 || nnzT < 0);
+    bool invalid_size = (n < 0 || nnzA < 0 || nnzT < 0 || bc < 0);
     if(invalid_size)
     {
-        EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_refactlu(
-                                  handle, n, nnzA, (rocblas_int*)nullptr, (rocblas_int*)nullptr,
-                                  (T*)nullptr, nnzT, (rocblas_int*)nullptr, (rocblas_int*)nullptr,
-                                  (T*)nullptr, (rocblas_int*)nullptr, (rocblas_int*)nullptr, rfinfo),
+        EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_refactlu(STRIDED, handle, n, nnzA,
+                                                       (rocblas_int*)nullptr, (rocblas_int*)nullptr,
+                                                       (T*)nullptr, nnzA, nnzT,
+                                                       (rocblas_int*)nullptr, (rocblas_int*)nullptr,
+                                                       (T*)nullptr, nnzT, (rocblas_int*)nullptr,
+                                                       (rocblas_int*)nullptr, rfinfo, bc),
                               rocblas_status_invalid_size);
 
         if(argus.timing)
@@ -410,14 +475,18 @@ void testing_csrrf_refactlu(Arguments& argus)
         read_last(fileT.string(), &nnzT);
     }
 
+    rocblas_stride stA = argus.get<rocblas_stride>("strideA", nnzA);
+    rocblas_stride stT = argus.get<rocblas_stride>("strideT", nnzT);
+    rocblas_stride stTres = (argus.unit_check || argus.norm_check) ? stT : 0;
+
     // memory size query if necessary
     if(argus.mem_query || !USE_ROCBLAS_REALLOC_ON_DEMAND)
     {
         CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
         CHECK_ALLOC_QUERY(rocsolver_csrrf_refactlu(
-            handle, n, nnzA, (rocblas_int*)nullptr, (rocblas_int*)nullptr, (T*)nullptr, nnzT,
-            (rocblas_int*)nullptr, (rocblas_int*)nullptr, (T*)nullptr, (rocblas_int*)nullptr,
-            (rocblas_int*)nullptr, rfinfo));
+            STRIDED, handle, n, nnzA, (rocblas_int*)nullptr, (rocblas_int*)nullptr, (T*)nullptr,
+            stA, nnzT, (rocblas_int*)nullptr, (rocblas_int*)nullptr, (T*)nullptr, stT,
+            (rocblas_int*)nullptr, (rocblas_int*)nullptr, rfinfo, bc));
 
         size_t size;
         CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
@@ -449,20 +518,20 @@ void testing_csrrf_refactlu(Arguments& argus)
     // memory allocations
     host_strided_batch_vector<rocblas_int> hptrA(size_ptrA, 1, size_ptrA, 1);
     host_strided_batch_vector<rocblas_int> hindA(size_indA, 1, size_indA, 1);
-    host_strided_batch_vector<T> hvalA(size_valA, 1, size_valA, 1);
+    host_strided_batch_vector<T> hvalA(size_valA, 1, stA, bc);
     host_strided_batch_vector<rocblas_int> hptrT(size_ptrT, 1, size_ptrT, 1);
     host_strided_batch_vector<rocblas_int> hindT(size_indT, 1, size_indT, 1);
-    host_strided_batch_vector<T> hvalT(size_valT, 1, size_valT, 1);
-    host_strided_batch_vector<T> hvalTres(size_valTres, 1, size_valTres, 1);
+    host_strided_batch_vector<T> hvalT(size_valT, 1, stT, bc);
+    host_strided_batch_vector<T> hvalTres(size_valTres, 1, stTres, bc);
     host_strided_batch_vector<rocblas_int> hpivP(size_pivP, 1, size_pivP, 1);
     host_strided_batch_vector<rocblas_int> hpivQ(size_pivQ, 1, size_pivQ, 1);
 
     device_strided_batch_vector<rocblas_int> dptrA(size_ptrA, 1, size_ptrA, 1);
     device_strided_batch_vector<rocblas_int> dindA(size_indA, 1, size_indA, 1);
-    device_strided_batch_vector<T> dvalA(size_valA, 1, size_valA, 1);
+    device_strided_batch_vector<T> dvalA(size_valA, 1, stA, bc);
     device_strided_batch_vector<rocblas_int> dptrT(size_ptrT, 1, size_ptrT, 1);
     device_strided_batch_vector<rocblas_int> dindT(size_indT, 1, size_indT, 1);
-    device_strided_batch_vector<T> dvalT(size_valT, 1, size_valT, 1);
+    device_strided_batch_vector<T> dvalT(size_valT, 1, stT, bc);
     device_strided_batch_vector<rocblas_int> dpivP(size_pivP, 1, size_pivP, 1);
     device_strided_batch_vector<rocblas_int> dpivQ(size_pivQ, 1, size_pivQ, 1);
     CHECK_HIP_ERROR(dptrA.memcheck());
@@ -481,12 +550,12 @@ void testing_csrrf_refactlu(Arguments& argus)
         CHECK_HIP_ERROR(dpivQ.memcheck());
 
     // check quick return
-    if(n == 0)
+    if(n == 0 || bc == 0)
     {
-        EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_refactlu(handle, n, nnzA, dptrA.data(), dindA.data(),
-                                                       dvalA.data(), nnzT, dptrT.data(),
-                                                       dindT.data(), dvalT.data(), dpivP.data(),
-                                                       dpivQ.data(), rfinfo),
+        EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_refactlu(STRIDED, handle, n, nnzA, dptrA.data(),
+                                                       dindA.data(), dvalA.data(), stA, nnzT,
+                                                       dptrT.data(), dindT.data(), dvalT.data(),
+                                                       stT, dpivP.data(), dpivQ.data(), rfinfo, bc),
                               rocblas_status_success);
         if(argus.timing)
             rocsolver_bench_inform(inform_quick_return);
@@ -496,16 +565,17 @@ void testing_csrrf_refactlu(Arguments& argus)
 
     // check computations
     if(argus.unit_check || argus.norm_check)
-        csrrf_refactlu_getError<T>(handle, n, nnzA, dptrA, dindA, dvalA, nnzT, dptrT, dindT, dvalT,
-                                   dpivP, dpivQ, rfinfo, hptrA, hindA, hvalA, hptrT, hindT, hvalT,
-                                   hpivP, hpivQ, hvalTres, &max_error, testcase);
+        csrrf_refactlu_getError<STRIDED, T>(handle, n, nnzA, dptrA, dindA, dvalA, stA, nnzT, dptrT,
+                                            dindT, dvalT, stT, dpivP, dpivQ, rfinfo, bc, hptrA,
+                                            hindA, hvalA, hptrT, hindT, hvalT, hpivP, hpivQ,
+                                            hvalTres, &max_error, testcase);
 
     // collect performance data
     if(argus.timing)
-        csrrf_refactlu_getPerfData<T>(handle, n, nnzA, dptrA, dindA, dvalA, nnzT, dptrT, dindT,
-                                      dvalT, dpivP, dpivQ, rfinfo, hptrA, hindA, hvalA, hptrT, hindT,
-                                      hvalT, hpivP, hpivQ, &gpu_time_used, &cpu_time_used, hot_calls,
-                                      argus.profile, argus.profile_kernels, argus.perf, testcase);
+        csrrf_refactlu_getPerfData<STRIDED, T>(
+            handle, n, nnzA, dptrA, dindA, dvalA, stA, nnzT, dptrT, dindT, dvalT, stT, dpivP, dpivQ,
+            rfinfo, bc, hptrA, hindA, hvalA, hptrT, hindT, hvalT, hpivP, hpivQ, &gpu_time_used,
+            &cpu_time_used, hot_calls, argus.profile, argus.profile_kernels, argus.perf, testcase);
 
     // validate results for rocsolver-test
     // using 2 * n * machine precision for tolerance
@@ -518,8 +588,16 @@ void testing_csrrf_refactlu(Arguments& argus)
         if(!argus.perf)
         {
             rocsolver_bench_header("Arguments:");
-            rocsolver_bench_output("n", "nnzA", "nnzT");
-            rocsolver_bench_output(n, nnzA, nnzT);
+            if(STRIDED)
+            {
+                rocsolver_bench_output("n", "nnzA", "strideA", "nnzT", "strideT", "batch_c");
+                rocsolver_bench_output(n, nnzA, stA, nnzT, stT, bc);
+            }
+            else
+            {
+                rocsolver_bench_output("n", "nnzA", "nnzT");
+                rocsolver_bench_output(n, nnzA, nnzT);
+            }
 
             rocsolver_bench_header("Results:");
             if(argus.norm_check)
@@ -550,4 +628,4 @@ void testing_csrrf_refactlu(Arguments& argus)
 #define EXTERN_TESTING_CSRRF_REFACTLU(...) \
     extern template void testing_csrrf_refactlu<__VA_ARGS__>(Arguments&);
 
-INSTANTIATE(EXTERN_TESTING_CSRRF_REFACTLU, FOREACH_REAL_TYPE, APPLY_STAMP)
+INSTANTIATE(EXTERN_TESTING_CSRRF_REFACTLU, FOREACH_STRIDED_VARIANT, FOREACH_REAL_TYPE, APPLY_STAMP)
@@ -0,0 +1,454 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "common/misc/client_util.hpp"
+#include "common/misc/clientcommon.hpp"
+#include "common/misc/norm.hpp"
+#include "common/misc/rocsolver.hpp"
+#include "common/misc/rocsolver_arguments.hpp"
+#include "common/misc/rocsolver_test.hpp"
+#include "common/misc/sparse_io.hpp"
+
+/*
+ * ===========================================================================
+ *    testing_csrrf_refactlu_workflow benchmarks the workflow of an application
+ *    that solves many linear systems with the same sparsity pattern: a single
+ *    call to csrrf_analysis followed, for every update of the values of A, by
+ *    a call to csrrf_refactlu and a call to csrrf_solve. The times of the
+ *    three phases are reported separately. It is used by rocsolver-bench with
+ *    --workflow refactlu.
+ * ===========================================================================
+ */
+
+template <typename T, typename Td, typename Ud>
+void csrrf_refactlu_workflow_initData(const sparse_csr_matrix<T>& matA,
+                                      const sparse_csr_matrix<T>& matT,
+                                      const std::vector<rocblas_int>& hpivP,
+                                      const std::vector<rocblas_int>& hpivQ,
+                                      Ud& dptrA,
+                                      Ud& dindA,
+                                      Td& dvalA,
+                                      Ud& dptrT,
+                                      Ud& dindT,
+                                      Td& dvalT,
+                                      Ud& dpivP,
+                                      Ud& dpivQ)
+{
+    const rocblas_int n = matA.n;
+
+    CHECK_HIP_ERROR(matA.copy_to_device(dptrA.data(), dindA.data(), dvalA.data()));
+    CHECK_HIP_ERROR(matT.copy_to_device(dptrT.data(), dindT.data(), dvalT.data()));
+    CHECK_HIP_ERROR(hipMemcpy(dpivP.data(), hpivP.data(), sizeof(rocblas_int) * n,
+                              hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dpivQ.data(), hpivQ.data(), sizeof(rocblas_int) * n,
+                              hipMemcpyHostToDevice));
+}
+
+// sets the values of A to those of the k-th update, s * A with s = 2^(k % 4), and restores the
+// right-hand side B = A * ones (so that the solution of the updated system is ones / s)
+template <typename T, typename Td>
+void csrrf_refactlu_workflow_update(const sparse_csr_matrix<T>& matA,
+                                    const rocblas_int k,
+                                    Td& dvalA,
+                                    Td& dB,
+                                    std::vector<T>& hvalA,
+                                    const std::vector<T>& hB)
+{
+    T s = T(1 << (k % 4));
+    for(rocblas_int i = 0; i < matA.nnz; ++i)
+        hvalA[i] = s * matA.val()[i];
+
+    CHECK_HIP_ERROR(hipMemcpy(dvalA.data(), hvalA.data(), sizeof(T) * matA.nnz,
+                              hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dB.data(), hB.data(), sizeof(T) * matA.n, hipMemcpyHostToDevice));
+}
+
+template <typename T, typename Td, typename Ud>
+void csrrf_refactlu_workflow_getError(rocblas_handle handle,
+                                      const rocblas_int n,
+                                      const rocblas_int nnzA,
+                                      Ud& dptrA,
+                                      Ud& dindA,
+                                      Td& dvalA,
+                                      const rocblas_int nnzT,
+                                      Ud& dptrT,
+                                      Ud& dindT,
+                                      Td& dvalT,
+                                      Ud& dpivP,
+                                      Ud& dpivQ,
+                                      Td& dB,
+                                      rocsolver_rfinfo rfinfo,
+                                      const sparse_csr_matrix<T>& matA,
+                                      std::vector<T>& hvalA,
+                                      const std::vector<T>& hB,
+                                      double* max_err)
+{
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_csrrf_analysis(
+        handle, n, 0, nnzA, dptrA.data(), dindA.data(), dvalA.data(), nnzT, dptrT.data(),
+        dindT.data(), dvalT.data(), dpivP.data(), dpivQ.data(), (T*)nullptr, n, rfinfo));
+
+    // solve the system of the first update with a different matrix, 2 * A
+    csrrf_refactlu_workflow_update(matA, 1, dvalA, dB, hvalA, hB);
+
+    CHECK_ROCBLAS_ERROR(rocsolver_csrrf_refactlu(handle, n, nnzA, dptrA.data(), dindA.data(),
+                                                 dvalA.data(), nnzT, dptrT.data(), dindT.data(),
+                                                 dvalT.data(), dpivP.data(), dpivQ.data(), rfinfo));
+    CHECK_ROCBLAS_ERROR(rocsolver_csrrf_solve(handle, n, 1, nnzT, dptrT.data(), dindT.data(),
+                                              dvalT.data(), dpivP.data(), dpivQ.data(), dB.data(),
+                                              n, rfinfo));
+
+    std::vector<T> hX(n, T(0.5)), hXres(n);
+    CHECK_HIP_ERROR(hipMemcpy(hXres.data(), dB.data(), sizeof(T) * n, hipMemcpyDeviceToHost));
+
+    // compare computed results with the expected solution
+    *max_err = norm_error('I', n, 1, n, hX.data(), hXres.data());
+}
+
+template <typename T, typename Td, typename Ud>
+void csrrf_refactlu_workflow_getPerfData(rocblas_handle handle,
+                                         const rocblas_int n,
+                                         const rocblas_int nnzA,
+                                         Ud& dptrA,
+                                         Ud& dindA,
+                                         Td& dvalA,
+                                         const rocblas_int nnzT,
+                                         Ud& dptrT,
+                                         Ud& dindT,
+                                         Td& dvalT,
+                                         Ud& dpivP,
+                                         Ud& dpivQ,
+                                         Td& dB,
+                                         rocsolver_rfinfo rfinfo,
+                                         const sparse_csr_matrix<T>& matA,
+                                         std::vector<T>& hvalA,
+                                         const std::vector<T>& hB,
+                                         double* analysis_time_used,
+                                         double* refact_time_used,
+                                         double* solve_time_used,
+                                         const rocblas_int hot_calls,
+                                         const int profile,
+                                         const bool profile_kernels)
+{
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    double start_time, refact_end;
+
+    // the analysis is executed once by the applications; its time is that of the second call
+    // (the first one also includes the initialization of the libraries)
+    csrrf_refactlu_workflow_update(matA, 0, dvalA, dB, hvalA, hB);
+    for(int iter = 0; iter < 2; iter++)
+    {
+        start_time = get_time_us_sync(stream);
+        CHECK_ROCBLAS_ERROR(rocsolver_csrrf_analysis(
+            handle, n, 0, nnzA, dptrA.data(), dindA.data(), dvalA.data(), nnzT, dptrT.data(),
+            dindT.data(), dvalT.data(), dpivP.data(), dpivQ.data(), (T*)nullptr, n, rfinfo));
+        *analysis_time_used = get_time_us_sync(stream) - start_time;
+    }
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        csrrf_refactlu_workflow_update(matA, iter, dvalA, dB, hvalA, hB);
+
+        CHECK_ROCBLAS_ERROR(rocsolver_csrrf_refactlu(
+            handle, n, nnzA, dptrA.data(), dindA.data(), dvalA.data(), nnzT, dptrT.data(),
+            dindT.data(), dvalT.data(), dpivP.data(), dpivQ.data(), rfinfo));
+        CHECK_ROCBLAS_ERROR(rocsolver_csrrf_solve(handle, n, 1, nnzT, dptrT.data(), dindT.data(),
+                                                  dvalT.data(), dpivP.data(), dpivQ.data(),
+                                                  dB.data(), n, rfinfo));
+    }
+
+    // gpu-lapack performance
+    if(profile > 0)
+    {
+        if(profile_kernels)
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile
+                                         | rocblas_layer_mode_ex_log_kernel);
+        else
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile);
+        rocsolver_log_set_max_levels(profile);
+    }
+
+    // every hot call is a new update of the values (uploaded outside of the timed region)
+    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    {
+        csrrf_refactlu_workflow_update(matA, iter, dvalA, dB, hvalA, hB);
+
+        start_time = get_time_us_sync(stream);
+        rocsolver_csrrf_refactlu(handle, n, nnzA, dptrA.data(), dindA.data(), dvalA.data(), nnzT,
+                                 dptrT.data(), dindT.data(), dvalT.data(), dpivP.data(),
+                                 dpivQ.data(), rfinfo);
+        refact_end = get_time_us_sync(stream);
+        rocsolver_csrrf_solve(handle, n, 1, nnzT, dptrT.data(), dindT.data(), dvalT.data(),
+                              dpivP.data(), dpivQ.data(), dB.data(), n, rfinfo);
+        *solve_time_used += get_time_us_sync(stream) - refact_end;
+        *refact_time_used += refact_end - start_time;
+    }
+    *refact_time_used /= hot_calls;
+    *solve_time_used /= hot_calls;
+}
+
+template <typename T>
+void testing_csrrf_refactlu_workflow(Arguments& argus)
+{
+    // get arguments
+    rocblas_local_handle handle;
+    rocsolver_local_rfinfo rfinfo(handle);
+    std::string sparse_dir = argus.get<std::string>("sparse_dir", "");
+    rocblas_int n = argus.get<rocblas_int>("n", 0);
+    rocblas_int nnzA = argus.get<rocblas_int>("nnzA", 0);
+    char solveC = argus.get<char>("rfinfo_solve_mode", 'S');
+    char refactC = argus.get<char>("rfinfo_refact_mode", 'S');
+    char precisionC = argus.get<char>("rfinfo_precision_mode", 'F');
+    rocblas_int hot_calls = argus.iters;
+
+    CHECK_ROCBLAS_ERROR(rocsolver_set_rfinfo_mode(rfinfo, rocsolver_rfinfo_mode_lu));
+    CHECK_ROCBLAS_ERROR(
+        rocsolver_set_rfinfo_solve_mode(rfinfo, char2rocsolver_rfinfo_solve_mode(solveC)));
+    CHECK_ROCBLAS_ERROR(
+        rocsolver_set_rfinfo_refact_mode(rfinfo, char2rocsolver_rfinfo_refact_mode(refactC)));
+    CHECK_ROCBLAS_ERROR(rocsolver_set_rfinfo_precision_mode(
+        rfinfo, char2rocsolver_rfinfo_precision_mode(precisionC)));
+
+    // check non-supported values
+    // N/A
+
+    // check invalid sizes
+    bool invalid_size = (n < 0 || nnzA < 0 || hot_calls <= 0);
+    if(invalid_size)
+    {
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_size);
+
+        return;
+    }
+
+    // determine the test case: the given directory, or the closest existing test data
+    fs::path testcase;
+    if(!sparse_dir.empty())
+        testcase = fs::path(sparse_dir);
+    else if(n > 0)
+    {
+        if(n <= 35)
+            n = 20;
+        else if(n <= 75)
+            n = 50;
+        else if(n <= 175)
+            n = 100;
+        else
+            n = 250;
+
+        if(n <= 50) // small case
+        {
+            if(nnzA <= 80)
+                nnzA = 60;
+            else if(nnzA <= 120)
+                nnzA = 100;
+            else
+                nnzA = 140;
+        }
+        else // large case
+        {
+            if(nnzA <= 400)
+                nnzA = 300;
+            else if(nnzA <= 600)
+                nnzA = 500;
+            else
+                nnzA = 700;
+        }
+
+        testcase = get_sparse_data_dir() / fs::path(fmt::format("mat_{}_{}", n, nnzA));
+    }
+
+    // read-in A, T, P and Q (the values of T are the initial factorization of A)
+    sparse_csr_matrix<T> matA, matT;
+    std::vector<rocblas_int> hpivP, hpivQ;
+    if(!testcase.empty())
+    {
+        matA.read(testcase, "A");
+        matT.read(testcase, "T");
+        read_text_values((testcase / "P").string(), hpivP);
+        read_text_values((testcase / "Q").string(), hpivQ);
+        if(matT.n != matA.n || hpivP.size() != size_t(matA.n) || hpivQ.size() != size_t(matA.n))
+            throw std::invalid_argument(
+                fmt::format("Error: Inconsistent sizes of A, T, P and Q in {}", testcase.string()));
+    }
+    n = matA.n;
+    nnzA = matA.nnz;
+    rocblas_int nnzT = matT.nnz;
+
+    // memory size query if necessary
+    if(argus.mem_query || !USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        CHECK_ALLOC_QUERY(rocsolver_csrrf_analysis(
+            handle, n, 0, nnzA, (rocblas_int*)nullptr, (rocblas_int*)nullptr, (T*)nullptr, nnzT,
+            (rocblas_int*)nullptr, (rocblas_int*)nullptr, (T*)nullptr, (rocblas_int*)nullptr,
+            (rocblas_int*)nullptr, (T*)nullptr, n, rfinfo));
+        CHECK_ALLOC_QUERY(rocsolver_csrrf_refactlu(
+            handle, n, nnzA, (rocblas_int*)nullptr, (rocblas_int*)nullptr, (T*)nullptr, nnzT,
+            (rocblas_int*)nullptr, (rocblas_int*)nullptr, (T*)nullptr, (rocblas_int*)nullptr,
+            (rocblas_int*)nullptr, rfinfo));
+        CHECK_ALLOC_QUERY(rocsolver_csrrf_solve(
+            handle, n, 1, nnzT, (rocblas_int*)nullptr, (rocblas_int*)nullptr, (T*)nullptr,
+            (rocblas_int*)nullptr, (rocblas_int*)nullptr, (T*)nullptr, n, rfinfo));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        if(argus.mem_query)
+        {
+            rocsolver_bench_inform(inform_mem_query, size);
+            return;
+        }
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    // check quick return
+    if(n == 0)
+    {
+        if(argus.timing)
+            rocsolver_bench_inform(inform_quick_return);
+
+        return;
+    }
+
+    // determine sizes
+    size_t size_ptrA = size_t(n) + 1;
+    size_t size_indA = size_t(nnzA);
+    size_t size_valA = size_t(nnzA);
+    size_t size_ptrT = size_t(n) + 1;
+    size_t size_indT = size_t(nnzT);
+    size_t size_valT = size_t(nnzT);
+    size_t size_pivP = size_t(n);
+    size_t size_pivQ = size_t(n);
+    size_t size_BX = size_t(n);
+
+    double max_error = 0, analysis_time_used = 0, refact_time_used = 0, solve_time_used = 0;
+
+    // memory allocations
+    // (only the values of A and the right-hand side are staged in host memory; the other
+    // arrays are copied to the device from the files, or the buffers, read by matA and matT)
+    std::vector<T> hvalA(size_valA);
+    std::vector<T> hB(size_BX, T(0));
+    for(rocblas_int i = 0; i < n; ++i)
+    {
+        for(rocblas_int k = matA.ptr()[i]; k < matA.ptr()[i + 1]; ++k)
+            hB[i] += matA.val()[k];
+    }
+
+    device_strided_batch_vector<rocblas_int> dptrA(size_ptrA, 1, size_ptrA, 1);
+    device_strided_batch_vector<rocblas_int> dindA(size_indA, 1, size_indA, 1);
+    device_strided_batch_vector<T> dvalA(size_valA, 1, size_valA, 1);
+    device_strided_batch_vector<rocblas_int> dptrT(size_ptrT, 1, size_ptrT, 1);
+    device_strided_batch_vector<rocblas_int> dindT(size_indT, 1, size_indT, 1);
+    device_strided_batch_vector<T> dvalT(size_valT, 1, size_valT, 1);
+    device_strided_batch_vector<rocblas_int> dpivP(size_pivP, 1, size_pivP, 1);
+    device_strided_batch_vector<rocblas_int> dpivQ(size_pivQ, 1, size_pivQ, 1);
+    device_strided_batch_vector<T> dB(size_BX, 1, size_BX, 1);
+    CHECK_HIP_ERROR(dptrA.memcheck());
+    CHECK_HIP_ERROR(dptrT.memcheck());
+    CHECK_HIP_ERROR(dpivP.memcheck());
+    CHECK_HIP_ERROR(dpivQ.memcheck());
+    CHECK_HIP_ERROR(dB.memcheck());
+    if(size_indA)
+        CHECK_HIP_ERROR(dindA.memcheck());
+    if(size_valA)
+        CHECK_HIP_ERROR(dvalA.memcheck());
+    if(size_indT)
+        CHECK_HIP_ERROR(dindT.memcheck());
+    if(size_valT)
+        CHECK_HIP_ERROR(dvalT.memcheck());
+
+    // input data initialization
+    csrrf_refactlu_workflow_initData(matA, matT, hpivP, hpivQ, dptrA, dindA, dvalA, dptrT, dindT,
+                                     dvalT, dpivP, dpivQ);
+
+    // check computations
+    if(argus.unit_check || argus.norm_check)
+        csrrf_refactlu_workflow_getError<T>(handle, n, nnzA, dptrA, dindA, dvalA, nnzT, dptrT,
+                                            dindT, dvalT, dpivP, dpivQ, dB, rfinfo, matA, hvalA,
+                                            hB, &max_error);
+
+    // collect performance data
+    if(argus.timing)
+        csrrf_refactlu_workflow_getPerfData<T>(
+            handle, n, nnzA, dptrA, dindA, dvalA, nnzT, dptrT, dindT, dvalT, dpivP, dpivQ, dB,
+            rfinfo, matA, hvalA, hB, &analysis_time_used, &refact_time_used, &solve_time_used,
+            hot_calls, argus.profile, argus.profile_kernels);
+
+    // validate results for rocsolver-test
+    // using n * machine precision for tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, n);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            rocsolver_bench_header("Arguments:");
+            rocsolver_bench_output("n", "nnzA", "nnzT", "updates");
+            rocsolver_bench_output(n, nnzA, nnzT, hot_calls);
+
+            rocsolver_bench_header("Results:");
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("analysis_us", "refactlu_us", "solve_us", "error");
+                rocsolver_bench_output(analysis_time_used, refact_time_used, solve_time_used,
+                                       max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("analysis_us", "refactlu_us", "solve_us");
+                rocsolver_bench_output(analysis_time_used, refact_time_used, solve_time_used);
+            }
+            rocsolver_bench_endl();
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(analysis_time_used, refact_time_used, solve_time_used,
+                                       max_error);
+            else
+                rocsolver_bench_output(analysis_time_used, refact_time_used, solve_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
+
+#define EXTERN_TESTING_CSRRF_REFACTLU_WORKFLOW(...) \
+    extern template void testing_csrrf_refactlu_workflow<__VA_ARGS__>(Arguments&);
+
+INSTANTIATE(EXTERN_TESTING_CSRRF_REFACTLU_WORKFLOW, FOREACH_REAL_TYPE, APPLY_STAMP)
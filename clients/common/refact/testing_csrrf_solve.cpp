@@ -29,4 +29,4 @@
 
 #define TESTING_CSRRF_SOLVE(...) template void testing_csrrf_solve<__VA_ARGS__>(Arguments&);
 
-INSTANTIATE(TESTING_CSRRF_SOLVE, FOREACH_REAL_TYPE, APPLY_STAMP)
+INSTANTIATE(TESTING_CSRRF_SOLVE, FOREACH_STRIDED_VARIANT, FOREACH_REAL_TYPE, APPLY_STAMP)
@@ -35,7 +35,7 @@
 #include "common/misc/rocsolver_arguments.hpp"
 #include "common/misc/rocsolver_test.hpp"
 
-template <typename T>
+template <bool STRIDED, typename T>
 void csrrf_solve_checkBadArgs(rocblas_handle handle,
                               const rocblas_int n,
                               const rocblas_int nrhs,
@@ -43,64 +43,79 @@ void csrrf_solve_checkBadArgs(rocblas_handle handle,
                               rocblas_int* ptrT,
                               rocblas_int* indT,
                               T valT,
+                              const rocblas_stride stT,
                               rocblas_int* pivP,
                               rocblas_int* pivQ,
                               T B,
                               const rocblas_int ldb,
-                              rocsolver_rfinfo rfinfo)
+                              const rocblas_stride stB,
+                              rocsolver_rfinfo rfinfo,
+                              const rocblas_int bc)
 {
     // handle
-    EXPECT_ROCBLAS_STATUS(
-        rocsolver_csrrf_solve(nullptr, n, nrhs, nnzT, ptrT, indT, valT, pivP, pivQ, B, ldb, rfinfo),
-        rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_solve(STRIDED, nullptr, n, nrhs, nnzT, ptrT, indT, valT,
+                                                stT, pivP, pivQ, B, ldb, stB, rfinfo, bc),
+                          rocblas_status_invalid_handle);
 
     // values
     // N/A
 
     // sizes (only check batch_count if applicable)
-    // N/A
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_solve(STRIDED, handle, n, nrhs, nnzT, ptrT, indT,
+                                                    valT, stT, pivP, pivQ, B, ldb, stB, rfinfo, -1),
+                              rocblas_status_invalid_size);
 
     // pointers
-    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_solve(handle, n, nrhs, nnzT, (rocblas_int*)nullptr, indT,
-                                                valT, pivP, pivQ, B, ldb, rfinfo),
+    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_solve(STRIDED, handle, n, nrhs, nnzT,
+                                                (rocblas_int*)nullptr, indT, valT, stT, pivP, pivQ,
+                                                B, ldb, stB, rfinfo, bc),
                           rocblas_status_invalid_pointer);
-    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_solve(handle, n, nrhs, nnzT, ptrT, (rocblas_int*)nullptr,
-                                                valT, pivP, pivQ, B, ldb, rfinfo),
+    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_solve(STRIDED, handle, n, nrhs, nnzT, ptrT,
+                                                (rocblas_int*)nullptr, valT, stT, pivP, pivQ, B,
+                                                ldb, stB, rfinfo, bc),
                           rocblas_status_invalid_pointer);
-    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_solve(handle, n, nrhs, nnzT, ptrT, indT, (T) nullptr,
-                                                pivP, pivQ, B, ldb, rfinfo),
+    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_solve(STRIDED, handle, n, nrhs, nnzT, ptrT, indT,
+                                                (T) nullptr, stT, pivP, pivQ, B, ldb, stB, rfinfo,
+                                                bc),
                           rocblas_status_invalid_pointer);
-    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_solve(handle, n, nrhs, nnzT, ptrT, indT, valT,
-                                                (rocblas_int*)nullptr, pivQ, B, ldb, rfinfo),
+    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_solve(STRIDED, handle, n, nrhs, nnzT, ptrT, indT, valT,
+                                                stT, (rocblas_int*)nullptr, pivQ, B, ldb, stB,
+                                                rfinfo, bc),
                           rocblas_status_invalid_pointer);
-    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_solve(handle, n, nrhs, nnzT, ptrT, indT, valT, pivP,
-                                                (rocblas_int*)nullptr, B, ldb, rfinfo),
+    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_solve(STRIDED, handle, n, nrhs, nnzT, ptrT, indT, valT,
+                                                stT, pivP, (rocblas_int*)nullptr, B, ldb, stB,
+                                                rfinfo, bc),
                           rocblas_status_invalid_pointer);
-    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_solve(handle, n, nrhs, nnzT, ptrT, indT, valT, pivP, pivQ,
-                                                (T) nullptr, ldb, rfinfo),
+    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_solve(STRIDED, handle, n, nrhs, nnzT, ptrT, indT, valT,
+                                                stT, pivP, pivQ, (T) nullptr, ldb, stB, rfinfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_solve(STRIDED, handle, n, nrhs, nnzT, ptrT, indT, valT,
+                                                stT, pivP, pivQ, B, ldb, stB, nullptr, bc),
                           rocblas_status_invalid_pointer);
-    EXPECT_ROCBLAS_STATUS(
-        rocsolver_csrrf_solve(handle, n, nrhs, nnzT, ptrT, indT, valT, pivP, pivQ, B, ldb, nullptr),
-        rocblas_status_invalid_pointer);
 
     // quick return with invalid pointers
-    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_solve(handle, 0, nrhs, nnzT, ptrT, indT, valT,
-                                                (rocblas_int*)nullptr, (rocblas_int*)nullptr, B,
-                                                ldb, rfinfo),
+    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_solve(STRIDED, handle, 0, nrhs, nnzT, ptrT, indT, valT,
+                                                stT, (rocblas_int*)nullptr, (rocblas_int*)nullptr,
+                                                B, ldb, stB, rfinfo, bc),
                           rocblas_status_success);
-    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_solve(handle, n, 0, nnzT, ptrT, indT, valT, pivP, pivQ,
-                                                (T) nullptr, ldb, rfinfo),
+    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_solve(STRIDED, handle, n, 0, nnzT, ptrT, indT, valT, stT,
+                                                pivP, pivQ, (T) nullptr, ldb, stB, rfinfo, bc),
                           rocblas_status_success);
-    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_solve(handle, 0, 0, nnzT, ptrT, indT, valT,
+    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_solve(STRIDED, handle, 0, 0, nnzT, ptrT, indT, valT, stT,
                                                 (rocblas_int*)nullptr, (rocblas_int*)nullptr,
-                                                (T) nullptr, ldb, rfinfo),
+                                                (T) nullptr, ldb, stB, rfinfo, bc),
                           rocblas_status_success);
 
     // quick return with zero batch_count if applicable
-    // N/A
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_solve(STRIDED, handle, n, nrhs, nnzT, ptrT, indT,
+                                                    (T) nullptr, stT, pivP, pivQ, (T) nullptr, ldb,
+                                                    stB, rfinfo, 0),
+                              rocblas_status_success);
 }
 
-template <typename T>
+template <bool STRIDED, typename T>
 void testing_csrrf_solve_bad_arg()
 {
     // safe arguments
@@ -110,6 +125,9 @@ void testing_csrrf_solve_bad_arg()
     rocblas_int nrhs = 1;
     rocblas_int nnzT = 1;
     rocblas_int ldb = 1;
+    rocblas_stride stT = 1;
+    rocblas_stride stB = 1;
+    rocblas_int bc = 1;
 
     // memory allocations
     device_strided_batch_vector<rocblas_int> ptrT(1, 1, 1, 1);
@@ -126,8 +144,9 @@ void testing_csrrf_solve_bad_arg()
     CHECK_HIP_ERROR(B.memcheck());
 
     // check bad arguments
-    csrrf_solve_checkBadArgs(handle, n, nrhs, nnzT, ptrT.data(), indT.data(), valT.data(),
-                             pivP.data(), pivQ.data(), B.data(), ldb, rfinfo);
+    csrrf_solve_checkBadArgs<STRIDED>(handle, n, nrhs, nnzT, ptrT.data(), indT.data(), valT.data(),
+                                      stT, pivP.data(), pivQ.data(), B.data(), ldb, stB, rfinfo,
+                                      bc);
 }
 
 template <bool CPU, bool GPU, typename T, typename Td, typename Ud, typename Th, typename Uh>
@@ -142,6 +161,7 @@ void csrrf_solve_initData(rocblas_handle handle,
                           Ud& dpivQ,
                           Td& dB,
                           const rocblas_int ldb,
+                          const rocblas_int bc,
                           Uh& hptrT,
                           Uh& hindT,
                           Th& hvalT,
@@ -163,7 +183,7 @@ void csrrf_solve_initData(rocblas_handle handle,
         file = testcase / "indT";
         read_matrix(file.string(), 1, nnzT, hindT.data(), 1);
         file = testcase / "valT";
-        read_matrix(file.string(), 1, nnzT, hvalT.data(), 1);
+        read_matrix(file.string(), 1, nnzT, hvalT[0], 1);
 
         // read-in P
         if(mode == rocsolver_rfinfo_mode_lu)
@@ -178,14 +198,43 @@ void csrrf_solve_initData(rocblas_handle handle,
 
         // read-in B
         file = testcase / fs::path(fmt::format("B_{}", nrhs));
-        read_matrix(file.string(), n, nrhs, hB.data(), ldb);
+        read_matrix(file.string(), n, nrhs, hB[0], ldb);
 
         // get results (matrix X) if validation is required
         if(test)
         {
             // read-in X
             file = testcase / fs::path(fmt::format("X_{}", nrhs));
-            read_matrix(file.string(), n, nrhs, hX.data(), ldb);
+            read_matrix(file.string(), n, nrhs, hX[0], ldb);
+        }
+
+        // the other instances in the batch have the same right-hand-side and the matrix A
+        // scaled by s = 2^(b % 4) in LU mode, or by s^2 in Cholesky mode; i.e. their factors
+        // are (L - I) + s * U or s * L, and their solutions are X / s or X / s^2, respectively
+        for(rocblas_int b = 1; b < bc; ++b)
+        {
+            T s = T(1 << (b % 4));
+            for(rocblas_int i = 0; i < n; ++i)
+            {
+                for(rocblas_int k = hptrT[0][i]; k < hptrT[0][i + 1]; ++k)
+                {
+                    if(mode == rocsolver_rfinfo_mode_lu)
+                        hvalT[b][k] = (hindT[0][k] < i) ? hvalT[0][k] : s * hvalT[0][k];
+                    else
+                        hvalT[b][k] = s * hvalT[0][k];
+                }
+            }
+
+            T sx = (mode == rocsolver_rfinfo_mode_lu) ? s : s * s;
+            for(rocblas_int j = 0; j < nrhs; ++j)
+            {
+                for(rocblas_int i = 0; i < n; ++i)
+                {
+                    hB[b][i + j * ldb] = hB[0][i + j * ldb];
+                    if(test)
+                        hX[b][i + j * ldb] = hX[0][i + j * ldb] / sx;
+                }
+            }
         }
     }
 
@@ -204,7 +253,7 @@ void csrrf_solve_initData(rocblas_handle handle,
     }
 }
 
-template <typename T, typename Td, typename Ud, typename Th, typename Uh>
+template <bool STRIDED, typename T, typename Td, typename Ud, typename Th, typename Uh>
 void csrrf_solve_getError(rocblas_handle handle,
                           const rocblas_int n,
                           const rocblas_int nrhs,
@@ -212,11 +261,14 @@ void csrrf_solve_getError(rocblas_handle handle,
                           Ud& dptrT,
                           Ud& dindT,
                           Td& dvalT,
+                          const rocblas_stride stT,
                           Ud& dpivP,
                           Ud& dpivQ,
                           Td& dB,
                           const rocblas_int ldb,
+                          const rocblas_stride stB,
                           rocsolver_rfinfo rfinfo,
+                          const rocblas_int bc,
                           Uh& hptrT,
                           Uh& hindT,
                           Th& hvalT,
@@ -227,11 +279,12 @@ void csrrf_solve_getError(rocblas_handle handle,
                           Th& hXres,
                           double* max_err,
                           const fs::path testcase,
-                          const rocsolver_rfinfo_mode mode)
+                          const rocsolver_rfinfo_mode mode,
+                          const bool import)
 {
     // input data initialization
     csrrf_solve_initData<true, true, T>(handle, n, nrhs, nnzT, dptrT, dindT, dvalT, dpivP, dpivQ,
-                                        dB, ldb, hptrT, hindT, hvalT, hpivP, hpivQ, hB, hX,
+                                        dB, ldb, bc, hptrT, hindT, hvalT, hpivP, hpivQ, hB, hX,
                                         testcase, mode);
 
     // execute computations
@@ -240,17 +293,37 @@ void csrrf_solve_getError(rocblas_handle handle,
         handle, n, nrhs, nnzT, dptrT.data(), dindT.data(), dvalT.data(), nnzT, dptrT.data(),
         dindT.data(), dvalT.data(), dpivP.data(), dpivQ.data(), dB.data(), ldb, rfinfo));
 
-    CHECK_ROCBLAS_ERROR(rocsolver_csrrf_solve(handle, n, nrhs, nnzT, dptrT.data(), dindT.data(),
-                                              dvalT.data(), dpivP.data(), dpivQ.data(), dB.data(),
-                                              ldb, rfinfo));
+    // optionally, export the analysis and solve with a copy of rfinfo imported from it
+    // (only the LU analysis can be exported)
+    rocsolver_local_rfinfo rfinfo_import(handle);
+    if(import && mode == rocsolver_rfinfo_mode_lu)
+    {
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocsolver_export_rfinfo(handle, rfinfo, nullptr, &size));
+        std::vector<char> blob(size);
+        CHECK_ROCBLAS_ERROR(rocsolver_export_rfinfo(handle, rfinfo, blob.data(), &size));
+        CHECK_ROCBLAS_ERROR(rocsolver_import_rfinfo(handle, n, nnzT, dptrT.data(), dindT.data(),
+                                                    blob.data(), size, rfinfo_import));
+        rfinfo = rfinfo_import;
+    }
+
+    CHECK_ROCBLAS_ERROR(rocsolver_csrrf_solve(STRIDED, handle, n, nrhs, nnzT, dptrT.data(),
+                                              dindT.data(), dvalT.data(), stT, dpivP.data(),
+                                              dpivQ.data(), dB.data(), ldb, stB, rfinfo, bc));
 
     CHECK_HIP_ERROR(hXres.transfer_from(dB));
 
     // compare computed results with original result
-    *max_err = norm_error('I', n, nrhs, ldb, hX[0], hXres[0]);
+    double err;
+    *max_err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        err = norm_error('I', n, nrhs, ldb, hX[b], hXres[b]);
+        *max_err = err > *max_err ? err : *max_err;
+    }
 }
 
-template <typename T, typename Td, typename Ud, typename Th, typename Uh>
+template <bool STRIDED, typename T, typename Td, typename Ud, typename Th, typename Uh>
 void csrrf_solve_getPerfData(rocblas_handle handle,
                              const rocblas_int n,
                              const rocblas_int nrhs,
@@ -258,11 +331,14 @@ void csrrf_solve_getPerfData(rocblas_handle handle,
                              Ud& dptrT,
                              Ud& dindT,
                              Td& dvalT,
+                             const rocblas_stride stT,
                              Ud& dpivP,
                              Ud& dpivQ,
                              Td& dB,
                              const rocblas_int ldb,
+                             const rocblas_stride stB,
                              rocsolver_rfinfo rfinfo,
+                             const rocblas_int bc,
                              Uh& hptrT,
                              Uh& hindT,
                              Th& hvalT,
@@ -282,7 +358,7 @@ void csrrf_solve_getPerfData(rocblas_handle handle,
     *cpu_time_used = nan(""); // no timing on cpu-lapack execution
 
     csrrf_solve_initData<true, true, T>(handle, n, nrhs, nnzT, dptrT, dindT, dvalT, dpivP, dpivQ,
-                                        dB, ldb, hptrT, hindT, hvalT, hpivP, hpivQ, hB, hX,
+                                        dB, ldb, bc, hptrT, hindT, hvalT, hpivP, hpivQ, hB, hX,
                                         testcase, mode, false);
 
     CHECK_ROCBLAS_ERROR(rocsolver_csrrf_analysis(
@@ -293,18 +369,19 @@ void csrrf_solve_getPerfData(rocblas_handle handle,
     for(int iter = 0; iter < 2; iter++)
     {
         csrrf_solve_initData<false, true, T>(handle, n, nrhs, nnzT, dptrT, dindT, dvalT, dpivP,
-                                             dpivQ, dB, ldb, hptrT, hindT, hvalT, hpivP, hpivQ, hB,
-                                             hX, testcase, mode, false);
+                                             dpivQ, dB, ldb, bc, hptrT, hindT, hvalT, hpivP, hpivQ,
+                                             hB, hX, testcase, mode, false);
 
-        CHECK_ROCBLAS_ERROR(rocsolver_csrrf_solve(handle, n, nrhs, nnzT, dptrT.data(), dindT.data(),
-                                                  dvalT.data(), dpivP.data(), dpivQ.data(),
-                                                  dB.data(), ldb, rfinfo));
+        rocsolver_bench_first_call first_call(handle, iter);
+        CHECK_ROCBLAS_ERROR(rocsolver_csrrf_solve(STRIDED, handle, n, nrhs, nnzT, dptrT.data(),
+                                                  dindT.data(), dvalT.data(), stT, dpivP.data(),
+                                                  dpivQ.data(), dB.data(), ldb, stB, rfinfo, bc));
     }
 
     // gpu-lapack performance
     hipStream_t stream;
     CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
-    double start;
+    rocsolver_bench_timer timer(stream, hot_calls);
 
     if(profile > 0)
     {
@@ -316,21 +393,22 @@ void csrrf_solve_getPerfData(rocblas_handle handle,
         rocsolver_log_set_max_levels(profile);
     }
 
-    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    for(rocblas_int iter = 0; iter < timer.calls(); iter++)
     {
         csrrf_solve_initData<false, true, T>(handle, n, nrhs, nnzT, dptrT, dindT, dvalT, dpivP,
-                                             dpivQ, dB, ldb, hptrT, hindT, hvalT, hpivP, hpivQ, hB,
-                                             hX, testcase, mode, false);
-
-        start = get_time_us_sync(stream);
-        rocsolver_csrrf_solve(handle, n, nrhs, nnzT, dptrT.data(), dindT.data(), dvalT.data(),
-                              dpivP.data(), dpivQ.data(), dB.data(), ldb, rfinfo);
-        *gpu_time_used += get_time_us_sync(stream) - start;
+                                             dpivQ, dB, ldb, bc, hptrT, hindT, hvalT, hpivP, hpivQ,
+                                             hB, hX, testcase, mode, false);
+
+        timer.start(iter);
+        rocsolver_csrrf_solve(STRIDED, handle, n, nrhs, nnzT, dptrT.data(), dindT.data(),
+                              dvalT.data(), stT, dpivP.data(), dpivQ.data(), dB.data(), ldb, stB,
+                              rfinfo, bc);
+        *gpu_time_used += timer.stop(iter);
     }
     *gpu_time_used /= hot_calls;
 }
 
-template <typename T>
+template <bool STRIDED, typename T>
 void testing_csrrf_solve(Arguments& argus)
 {
     // get arguments
@@ -340,23 +418,32 @@ void testing_csrrf_solve(Arguments& argus)
     rocblas_int nrhs = argus.get<rocblas_int>("nrhs", n);
     rocblas_int nnzT = argus.get<rocblas_int>("nnzT");
     rocblas_int ldb = argus.get<rocblas_int>("ldb", n);
+    rocblas_int bc = argus.batch_count;
     char modeC = argus.get<char>("rfinfo_mode", '1');
+    char solveC = argus.get<char>("rfinfo_solve_mode", 'S');
+    char refactC = argus.get<char>("rfinfo_refact_mode", 'S');
+    bool import = argus.get<rocblas_int>("rfinfo_import", 0);
     rocblas_int hot_calls = argus.iters;
 
     rocsolver_rfinfo_mode mode = char2rocsolver_rfinfo_mode(modeC);
     CHECK_ROCBLAS_ERROR(rocsolver_set_rfinfo_mode(rfinfo, mode));
+    CHECK_ROCBLAS_ERROR(
+        rocsolver_set_rfinfo_solve_mode(rfinfo, char2rocsolver_rfinfo_solve_mode(solveC)));
+    CHECK_ROCBLAS_ERROR(
+        rocsolver_set_rfinfo_refact_mode(rfinfo, char2rocsolver_rfinfo_refact_mode(refactC)));
 
     // check non-supported values
     // N/A
 
     // check invalid sizes
-    bool invalid_size = (n < 0 || nrhs < 0 || nnzT < 0 || ldb < n);
+    bool invalid_size = (n < 0 || nrhs < 0 || nnzT < 0 || ldb < n || bc < 0);
     if(invalid_size)
     {
-        EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_solve(handle, n, nrhs, nnzT, (rocblas_int*)nullptr,
-                                                    (rocblas_int*)nullptr, (T*)nullptr,
+        EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_solve(STRIDED, handle, n, nrhs, nnzT,
                                                     (rocblas_int*)nullptr, (rocblas_int*)nullptr,
-                                                    (T*)nullptr, ldb, rfinfo),
+                                                    (T*)nullptr, nnzT, (rocblas_int*)nullptr,
+                                                    (rocblas_int*)nullptr, (T*)nullptr, ldb,
+                                                    size_t(ldb) * nrhs, rfinfo, bc),
                               rocblas_status_invalid_size);
 
         if(argus.timing)
@@ -424,13 +511,18 @@ void testing_csrrf_solve(Arguments& argus)
             nrhs = 30;
     }
 
+    rocblas_stride stT = argus.get<rocblas_stride>("strideT", nnzT);
+    rocblas_stride stB = argus.get<rocblas_stride>("strideB", size_t(ldb) * nrhs);
+    rocblas_stride stBres = (argus.unit_check || argus.norm_check) ? stB : 0;
+
     // memory size query if necessary
     if(argus.mem_query || !USE_ROCBLAS_REALLOC_ON_DEMAND)
     {
         CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
         CHECK_ALLOC_QUERY(rocsolver_csrrf_solve(
-            handle, n, nrhs, nnzT, (rocblas_int*)nullptr, (rocblas_int*)nullptr, (T*)nullptr,
-            (rocblas_int*)nullptr, (rocblas_int*)nullptr, (T*)nullptr, ldb, rfinfo));
+            STRIDED, handle, n, nrhs, nnzT, (rocblas_int*)nullptr, (rocblas_int*)nullptr,
+            (T*)nullptr, stT, (rocblas_int*)nullptr, (rocblas_int*)nullptr, (T*)nullptr, ldb, stB,
+            rfinfo, bc));
 
         size_t size;
         CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
@@ -460,19 +552,19 @@ void testing_csrrf_solve(Arguments& argus)
     // memory allocations
     host_strided_batch_vector<rocblas_int> hptrT(size_ptrT, 1, size_ptrT, 1);
     host_strided_batch_vector<rocblas_int> hindT(size_indT, 1, size_indT, 1);
-    host_strided_batch_vector<T> hvalT(size_valT, 1, size_valT, 1);
+    host_strided_batch_vector<T> hvalT(size_valT, 1, stT, bc);
     host_strided_batch_vector<rocblas_int> hpivP(size_pivP, 1, size_pivP, 1);
     host_strided_batch_vector<rocblas_int> hpivQ(size_pivQ, 1, size_pivQ, 1);
-    host_strided_batch_vector<T> hB(size_BX, 1, size_BX, 1);
-    host_strided_batch_vector<T> hX(size_BX, 1, size_BX, 1);
-    host_strided_batch_vector<T> hXres(size_BXres, 1, size_BXres, 1);
+    host_strided_batch_vector<T> hB(size_BX, 1, stB, bc);
+    host_strided_batch_vector<T> hX(size_BX, 1, stB, bc);
+    host_strided_batch_vector<T> hXres(size_BXres, 1, stBres, bc);
 
     device_strided_batch_vector<rocblas_int> dptrT(size_ptrT, 1, size_ptrT, 1);
     device_strided_batch_vector<rocblas_int> dindT(size_indT, 1, size_indT, 1);
-    device_strided_batch_vector<T> dvalT(size_valT, 1, size_valT, 1);
+    device_strided_batch_vector<T> dvalT(size_valT, 1, stT, bc);
     device_strided_batch_vector<rocblas_int> dpivP(size_pivP, 1, size_pivP, 1);
     device_strided_batch_vector<rocblas_int> dpivQ(size_pivQ, 1, size_pivQ, 1);
-    device_strided_batch_vector<T> dB(size_BX, 1, size_BX, 1);
+    device_strided_batch_vector<T> dB(size_BX, 1, stB, bc);
     CHECK_HIP_ERROR(dptrT.memcheck());
     if(size_indT)
         CHECK_HIP_ERROR(dindT.memcheck());
@@ -486,11 +578,11 @@ void testing_csrrf_solve(Arguments& argus)
         CHECK_HIP_ERROR(dB.memcheck());
 
     // check quick return
-    if(n == 0 || nrhs == 0)
+    if(n == 0 || nrhs == 0 || bc == 0)
     {
-        EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_solve(handle, n, nrhs, nnzT, dptrT.data(),
-                                                    dindT.data(), dvalT.data(), dpivP.data(),
-                                                    dpivQ.data(), dB.data(), ldb, rfinfo),
+        EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_solve(STRIDED, handle, n, nrhs, nnzT, dptrT.data(),
+                                                    dindT.data(), dvalT.data(), stT, dpivP.data(),
+                                                    dpivQ.data(), dB.data(), ldb, stB, rfinfo, bc),
                               rocblas_status_success);
         if(argus.timing)
             rocsolver_bench_inform(inform_quick_return);
@@ -500,16 +592,18 @@ void testing_csrrf_solve(Arguments& argus)
 
     // check computations
     if(argus.unit_check || argus.norm_check)
-        csrrf_solve_getError<T>(handle, n, nrhs, nnzT, dptrT, dindT, dvalT, dpivP, dpivQ, dB, ldb,
-                                rfinfo, hptrT, hindT, hvalT, hpivP, hpivQ, hB, hX, hXres,
-                                &max_error, testcase, mode);
+        csrrf_solve_getError<STRIDED, T>(handle, n, nrhs, nnzT, dptrT, dindT, dvalT, stT, dpivP,
+                                         dpivQ, dB, ldb, stB, rfinfo, bc, hptrT, hindT, hvalT,
+                                         hpivP, hpivQ, hB, hX, hXres, &max_error, testcase, mode,
+                                         import);
 
     // collect performance data
     if(argus.timing)
-        csrrf_solve_getPerfData<T>(handle, n, nrhs, nnzT, dptrT, dindT, dvalT, dpivP, dpivQ, dB,
-                                   ldb, rfinfo, hptrT, hindT, hvalT, hpivP, hpivQ, hB, hX,
-                                   &gpu_time_used, &cpu_time_used, hot_calls, argus.profile,
-                                   argus.profile_kernels, argus.perf, testcase, mode);
+        csrrf_solve_getPerfData<STRIDED, T>(handle, n, nrhs, nnzT, dptrT, dindT, dvalT, stT, dpivP,
+                                            dpivQ, dB, ldb, stB, rfinfo, bc, hptrT, hindT, hvalT,
+                                            hpivP, hpivQ, hB, hX, &gpu_time_used, &cpu_time_used,
+                                            hot_calls, argus.profile, argus.profile_kernels,
+                                            argus.perf, testcase, mode);
 
     // validate results for rocsolver-test
     // using 20 * n * machine_precision as tolerance
@@ -522,8 +616,17 @@ void testing_csrrf_solve(Arguments& argus)
         if(!argus.perf)
         {
             rocsolver_bench_header("Arguments:");
-            rocsolver_bench_output("n", "nrhs", "nnzT", "ldb");
-            rocsolver_bench_output(n, nrhs, nnzT, ldb);
+            if(STRIDED)
+            {
+                rocsolver_bench_output("n", "nrhs", "nnzT", "strideT", "ldb", "strideB",
+                                       "batch_c");
+                rocsolver_bench_output(n, nrhs, nnzT, stT, ldb, stB, bc);
+            }
+            else
+            {
+                rocsolver_bench_output("n", "nrhs", "nnzT", "ldb");
+                rocsolver_bench_output(n, nrhs, nnzT, ldb);
+            }
 
             rocsolver_bench_header("Results:");
             if(argus.norm_check)
@@ -554,4 +657,4 @@ void testing_csrrf_solve(Arguments& argus)
 #define EXTERN_TESTING_CSRRF_SOLVE(...) \
     extern template void testing_csrrf_solve<__VA_ARGS__>(Arguments&);
 
-INSTANTIATE(EXTERN_TESTING_CSRRF_SOLVE, FOREACH_REAL_TYPE, APPLY_STAMP)
+INSTANTIATE(EXTERN_TESTING_CSRRF_SOLVE, FOREACH_STRIDED_VARIANT, FOREACH_REAL_TYPE, APPLY_STAMP)
@@ -29,4 +29,4 @@
 
 #define TESTING_CSRRF_SPLITLU(...) template void testing_csrrf_splitlu<__VA_ARGS__>(Arguments&);
 
-INSTANTIATE(TESTING_CSRRF_SPLITLU, FOREACH_REAL_TYPE, APPLY_STAMP)
+INSTANTIATE(TESTING_CSRRF_SPLITLU, FOREACH_STRIDED_VARIANT, FOREACH_REAL_TYPE, APPLY_STAMP)
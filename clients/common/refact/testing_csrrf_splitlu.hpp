@@ -25,6 +25,7 @@
  * SUCH DAMAGE.
  * *************************************************************************/
 
+
 #pragma once
 
 #include "common/misc/client_util.hpp"
@@ -35,82 +36,108 @@
 #include "common/misc/rocsolver_arguments.hpp"
 #include "common/misc/rocsolver_test.hpp"
 
-template <typename T>
+template <bool STRIDED, typename T>
 void csrrf_splitlu_checkBadArgs(rocblas_handle handle,
                                 const rocblas_int n,
                                 const rocblas_int nnzT,
                                 rocblas_int* ptrT,
                                 rocblas_int* indT,
                                 T valT,
+                                const rocblas_stride stT,
                                 rocblas_int* ptrL,
                                 rocblas_int* indL,
                                 T valL,
+                                const rocblas_stride stL,
                                 rocblas_int* ptrU,
                                 rocblas_int* indU,
-                                T valU)
+                                T valU,
+                                const rocblas_stride stU,
+                                const rocblas_int bc)
 {
     // handle
-    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_splitlu(nullptr, n, nnzT, ptrT, indT, valT, ptrL, indL,
-                                                  valL, ptrU, indU, valU),
+    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_splitlu(STRIDED, nullptr, n, nnzT, ptrT, indT, valT, stT,
+                                                  ptrL, indL, valL, stL, ptrU, indU, valU, stU, bc),
                           rocblas_status_invalid_handle);
 
     // values
     // N/A
 
     // sizes (only check batch_count if applicable)
-    // N/A
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_splitlu(STRIDED, handle, n, nnzT, ptrT, indT, valT,
+                                                      stT, ptrL, indL, valL, stL, ptrU, indU, valU,
+                                                      stU, -1),
+                              rocblas_status_invalid_size);
 
     // pointers
-    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_splitlu(handle, n, nnzT, (rocblas_int*)nullptr, indT,
-                                                  valT, ptrL, indL, valL, ptrU, indU, valU),
+    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_splitlu(STRIDED, handle, n, nnzT, (rocblas_int*)nullptr,
+                                                  indT, valT, stT, ptrL, indL, valL, stL, ptrU,
+                                                  indU, valU, stU, bc),
                           rocblas_status_invalid_pointer);
-    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_splitlu(handle, n, nnzT, ptrT, (rocblas_int*)nullptr,
-                                                  valT, ptrL, indL, valL, ptrU, indU, valU),
+    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_splitlu(STRIDED, handle, n, nnzT, ptrT,
+                                                  (rocblas_int*)nullptr, valT, stT, ptrL, indL,
+                                                  valL, stL, ptrU, indU, valU, stU, bc),
                           rocblas_status_invalid_pointer);
-    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_splitlu(handle, n, nnzT, ptrT, indT, (T) nullptr, ptrL,
-                                                  indL, valL, ptrU, indU, valU),
+    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_splitlu(STRIDED, handle, n, nnzT, ptrT, indT, (T) nullptr,
+                                                  stT, ptrL, indL, valL, stL, ptrU, indU, valU, stU,
+                                                  bc),
                           rocblas_status_invalid_pointer);
-    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_splitlu(handle, n, nnzT, ptrT, indT, valT,
-                                                  (rocblas_int*)nullptr, indL, valL, ptrU, indU, valU),
+    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_splitlu(STRIDED, handle, n, nnzT, ptrT, indT, valT, stT,
+                                                  (rocblas_int*)nullptr, indL, valL, stL, ptrU,
+                                                  indU, valU, stU, bc),
                           rocblas_status_invalid_pointer);
-    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_splitlu(handle, n, nnzT, ptrT, indT, valT, ptrL,
-                                                  (rocblas_int*)nullptr, valL, ptrU, indU, valU),
+    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_splitlu(STRIDED, handle, n, nnzT, ptrT, indT, valT, stT,
+                                                  ptrL, (rocblas_int*)nullptr, valL, stL, ptrU,
+                                                  indU, valU, stU, bc),
                           rocblas_status_invalid_pointer);
-    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_splitlu(handle, n, nnzT, ptrT, indT, valT, ptrL, indL,
-                                                  (T) nullptr, ptrU, indU, valU),
+    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_splitlu(STRIDED, handle, n, nnzT, ptrT, indT, valT, stT,
+                                                  ptrL, indL, (T) nullptr, stL, ptrU, indU, valU,
+                                                  stU, bc),
                           rocblas_status_invalid_pointer);
-    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_splitlu(handle, n, nnzT, ptrT, indT, valT, ptrL, indL,
-                                                  valL, (rocblas_int*)nullptr, indU, valU),
+    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_splitlu(STRIDED, handle, n, nnzT, ptrT, indT, valT, stT,
+                                                  ptrL, indL, valL, stL, (rocblas_int*)nullptr,
+                                                  indU, valU, stU, bc),
                           rocblas_status_invalid_pointer);
-    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_splitlu(handle, n, nnzT, ptrT, indT, valT, ptrL, indL,
-                                                  valL, ptrU, (rocblas_int*)nullptr, valU),
+    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_splitlu(STRIDED, handle, n, nnzT, ptrT, indT, valT, stT,
+                                                  ptrL, indL, valL, stL, ptrU,
+                                                  (rocblas_int*)nullptr, valU, stU, bc),
                           rocblas_status_invalid_pointer);
-    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_splitlu(handle, n, nnzT, ptrT, indT, valT, ptrL, indL,
-                                                  valL, ptrU, indU, (T) nullptr),
+    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_splitlu(STRIDED, handle, n, nnzT, ptrT, indT, valT, stT,
+                                                  ptrL, indL, valL, stL, ptrU, indU, (T) nullptr,
+                                                  stU, bc),
                           rocblas_status_invalid_pointer);
 
     // quick return with invalid pointers
-    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_splitlu(handle, n, 0, ptrT, (rocblas_int*)nullptr,
-                                                  (T) nullptr, ptrL, indL, valL, ptrU,
-                                                  (rocblas_int*)nullptr, (T) nullptr),
+    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_splitlu(STRIDED, handle, n, 0, ptrT,
+                                                  (rocblas_int*)nullptr, (T) nullptr, stT, ptrL,
+                                                  indL, valL, stL, ptrU, (rocblas_int*)nullptr,
+                                                  (T) nullptr, stU, bc),
                           rocblas_status_success);
-    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_splitlu(handle, 0, 0, ptrT, (rocblas_int*)nullptr,
-                                                  (T) nullptr, ptrL, (rocblas_int*)nullptr,
-                                                  (T) nullptr, ptrU, (rocblas_int*)nullptr,
-                                                  (T) nullptr),
+    EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_splitlu(STRIDED, handle, 0, 0, ptrT,
+                                                  (rocblas_int*)nullptr, (T) nullptr, stT, ptrL,
+                                                  (rocblas_int*)nullptr, (T) nullptr, stL, ptrU,
+                                                  (rocblas_int*)nullptr, (T) nullptr, stU, bc),
                           rocblas_status_success);
 
     // quick return with zero batch_count if applicable
-    // N/A
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_splitlu(STRIDED, handle, n, nnzT, ptrT, indT,
+                                                      (T) nullptr, stT, ptrL, indL, (T) nullptr,
+                                                      stL, ptrU, indU, (T) nullptr, stU, 0),
+                              rocblas_status_success);
 }
 
-template <typename T>
+template <bool STRIDED, typename T>
 void testing_csrrf_splitlu_bad_arg()
 {
     // safe arguments
     rocblas_local_handle handle;
     rocblas_int n = 1;
     rocblas_int nnzT = 1;
+    rocblas_stride stT = 1;
+    rocblas_stride stL = 1;
+    rocblas_stride stU = 1;
+    rocblas_int bc = 1;
 
     // memory allocations
     device_strided_batch_vector<rocblas_int> ptrT(1, 1, 1, 1);
@@ -133,8 +160,9 @@ void testing_csrrf_splitlu_bad_arg()
     CHECK_HIP_ERROR(valU.memcheck());
 
     // check bad arguments
-    csrrf_splitlu_checkBadArgs(handle, n, nnzT, ptrT.data(), indT.data(), valT.data(), ptrL.data(),
-                               indL.data(), valL.data(), ptrU.data(), indU.data(), valU.data());
+    csrrf_splitlu_checkBadArgs<STRIDED>(handle, n, nnzT, ptrT.data(), indT.data(), valT.data(), stT,
+                                        ptrL.data(), indL.data(), valL.data(), stL, ptrU.data(),
+                                        indU.data(), valU.data(), stU, bc);
 }
 
 template <bool CPU, bool GPU, typename T, typename Td, typename Ud, typename Th, typename Uh>
@@ -143,6 +171,7 @@ void csrrf_splitlu_initData(rocblas_handle handle,
                             const rocblas_int nnzT,
                             const rocblas_int nnzL,
                             const rocblas_int nnzU,
+                            const rocblas_int bc,
                             Ud& dptrT,
                             Ud& dindT,
                             Td& dvalT,
@@ -166,16 +195,32 @@ void csrrf_splitlu_initData(rocblas_handle handle,
         if(CPU)
         {
             // initialize golden result (factor L)
-            random_sparse_matrix(n, nnzL, hptrL.data(), hindL.data(), hvalL.data(),
+            random_sparse_matrix(n, nnzL, hptrL.data(), hindL.data(), hvalL[0],
                                  rocblas_fill_lower, rocsolver_diagonal_mode_unit);
 
             // initialize golden result (factor U)
-            random_sparse_matrix(n, nnzU, hptrU.data(), hindU.data(), hvalU.data(),
+            random_sparse_matrix(n, nnzU, hptrU.data(), hindU.data(), hvalU[0],
                                  rocblas_fill_upper, rocsolver_diagonal_mode_random);
 
             // construct input matrix (bundle matrix L - I + U)
-            cpu_sumlu(n, hptrL.data(), hindL.data(), hvalL.data(), hptrU.data(), hindU.data(),
-                      hvalU.data(), hptrT.data(), hindT.data(), hvalT.data());
+            cpu_sumlu(n, hptrL.data(), hindL.data(), hvalL[0], hptrU.data(), hindU.data(),
+                      hvalU[0], hptrT.data(), hindT.data(), hvalT[0]);
+
+            // the other instances in the batch are the matrix T scaled by s = 2^(b % 4);
+            // i.e. their factors are s * (L - I) + I and s * U
+            for(rocblas_int b = 1; b < bc; ++b)
+            {
+                T s = T(1 << (b % 4));
+                for(rocblas_int k = 0; k < nnzT; ++k)
+                    hvalT[b][k] = s * hvalT[0][k];
+                for(rocblas_int i = 0; i < n; ++i)
+                {
+                    for(rocblas_int k = hptrL[0][i]; k < hptrL[0][i + 1]; ++k)
+                        hvalL[b][k] = (hindL[0][k] == i) ? T(1) : s * hvalL[0][k];
+                }
+                for(rocblas_int k = 0; k < nnzU; ++k)
+                    hvalU[b][k] = s * hvalU[0][k];
+            }
         }
 
         if(GPU)
@@ -187,21 +232,25 @@ void csrrf_splitlu_initData(rocblas_handle handle,
     }
 }
 
-template <typename T, typename Td, typename Ud, typename Th, typename Uh>
+template <bool STRIDED, typename T, typename Td, typename Ud, typename Th, typename Uh>
 void csrrf_splitlu_getError(rocblas_handle handle,
                             const rocblas_int n,
                             const rocblas_int nnzT,
                             Ud& dptrT,
                             Ud& dindT,
                             Td& dvalT,
+                            const rocblas_stride stT,
                             const rocblas_int nnzL,
                             Ud& dptrL,
                             Ud& dindL,
                             Td& dvalL,
+                            const rocblas_stride stL,
                             const rocblas_int nnzU,
                             Ud& dptrU,
                             Ud& dindU,
                             Td& dvalU,
+                            const rocblas_stride stU,
+                            const rocblas_int bc,
                             Uh& hptrT,
                             Uh& hindT,
                             Th& hvalT,
@@ -220,14 +269,15 @@ void csrrf_splitlu_getError(rocblas_handle handle,
                             double* max_err)
 {
     // input data initialization
-    csrrf_splitlu_initData<true, true, T>(handle, n, nnzT, nnzL, nnzU, dptrT, dindT, dvalT, hptrT,
-                                          hindT, hvalT, hptrL, hindL, hvalL, hptrU, hindU, hvalU);
+    csrrf_splitlu_initData<true, true, T>(handle, n, nnzT, nnzL, nnzU, bc, dptrT, dindT, dvalT,
+                                          hptrT, hindT, hvalT, hptrL, hindL, hvalL, hptrU, hindU,
+                                          hvalU);
 
     // execute computations
     // GPU lapack
     CHECK_ROCBLAS_ERROR(rocsolver_csrrf_splitlu(
-        handle, n, nnzT, dptrT.data(), dindT.data(), dvalT.data(), dptrL.data(), dindL.data(),
-        dvalL.data(), dptrU.data(), dindU.data(), dvalU.data()));
+        STRIDED, handle, n, nnzT, dptrT.data(), dindT.data(), dvalT.data(), stT, dptrL.data(),
+        dindL.data(), dvalL.data(), stL, dptrU.data(), dindU.data(), dvalU.data(), stU, bc));
 
     CHECK_HIP_ERROR(hptrLres.transfer_from(dptrL));
     CHECK_HIP_ERROR(hindLres.transfer_from(dindL));
@@ -240,6 +290,7 @@ void csrrf_splitlu_getError(rocblas_handle handle,
     bool mat_zero = (nnzT == 0);
 
     // if not matrix zero, compare computed results with golden result
+    // (the sparsity patterns are shared by all the instances in the batch)
     if(!mat_zero)
     {
         for(rocblas_int i = 0; i <= n; ++i)
@@ -249,15 +300,16 @@ void csrrf_splitlu_getError(rocblas_handle handle,
         }
 
         for(rocblas_int i = 0; i < nnzL; ++i)
-        {
             err += (hindL[0][i] - hindLres[0][i]);
-            err += (hvalL[0][i] - hvalLres[0][i]);
-        }
-
         for(rocblas_int i = 0; i < nnzU; ++i)
-        {
             err += (hindU[0][i] - hindUres[0][i]);
-            err += (hvalU[0][i] - hvalUres[0][i]);
+
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            for(rocblas_int i = 0; i < nnzL; ++i)
+                err += (hvalL[b][i] - hvalLres[b][i]);
+            for(rocblas_int i = 0; i < nnzU; ++i)
+                err += (hvalU[b][i] - hvalUres[b][i]);
         }
     }
     // otherwise simply check that L = identity and ptrU = 0
@@ -267,8 +319,9 @@ void csrrf_splitlu_getError(rocblas_handle handle,
         {
             err += i - hptrLres[0][i];
             err += i - hindLres[0][i];
-            err += 1 - hvalLres[0][i];
             err += hptrUres[0][i];
+            for(rocblas_int b = 0; b < bc; ++b)
+                err += 1 - hvalLres[b][i];
         }
         err += n - hptrLres[0][n];
         err += hptrUres[0][n];
@@ -277,21 +330,25 @@ void csrrf_splitlu_getError(rocblas_handle handle,
     *max_err = err;
 }
 
-template <typename T, typename Td, typename Ud, typename Th, typename Uh>
+template <bool STRIDED, typename T, typename Td, typename Ud, typename Th, typename Uh>
 void csrrf_splitlu_getPerfData(rocblas_handle handle,
                                const rocblas_int n,
                                const rocblas_int nnzT,
                                Ud& dptrT,
                                Ud& dindT,
                                Td& dvalT,
+                               const rocblas_stride stT,
                                const rocblas_int nnzL,
                                Ud& dptrL,
                                Ud& dindL,
                                Td& dvalL,
+                               const rocblas_stride stL,
                                const rocblas_int nnzU,
                                Ud& dptrU,
                                Ud& dindU,
                                Td& dvalU,
+                               const rocblas_stride stU,
+                               const rocblas_int bc,
                                Uh& hptrT,
                                Uh& hindT,
                                Th& hvalT,
@@ -310,25 +367,27 @@ void csrrf_splitlu_getPerfData(rocblas_handle handle,
 {
     *cpu_time_used = nan(""); // no timing on cpu-lapack execution
 
-    csrrf_splitlu_initData<true, false, T>(handle, n, nnzT, nnzL, nnzU, dptrT, dindT, dvalT, hptrT,
-                                           hindT, hvalT, hptrL, hindL, hvalL, hptrU, hindU, hvalU);
+    csrrf_splitlu_initData<true, false, T>(handle, n, nnzT, nnzL, nnzU, bc, dptrT, dindT, dvalT,
+                                           hptrT, hindT, hvalT, hptrL, hindL, hvalL, hptrU, hindU,
+                                           hvalU);
 
     // cold calls
     for(int iter = 0; iter < 2; iter++)
     {
-        csrrf_splitlu_initData<false, true, T>(handle, n, nnzT, nnzL, nnzU, dptrT, dindT, dvalT,
-                                               hptrT, hindT, hvalT, hptrL, hindL, hvalL, hptrU,
-                                               hindU, hvalU);
+        csrrf_splitlu_initData<false, true, T>(handle, n, nnzT, nnzL, nnzU, bc, dptrT, dindT,
+                                               dvalT, hptrT, hindT, hvalT, hptrL, hindL, hvalL,
+                                               hptrU, hindU, hvalU);
 
+        rocsolver_bench_first_call first_call(handle, iter);
         CHECK_ROCBLAS_ERROR(rocsolver_csrrf_splitlu(
-            handle, n, nnzT, dptrT.data(), dindT.data(), dvalT.data(), dptrL.data(), dindL.data(),
-            dvalL.data(), dptrU.data(), dindU.data(), dvalU.data()));
+            STRIDED, handle, n, nnzT, dptrT.data(), dindT.data(), dvalT.data(), stT, dptrL.data(),
+            dindL.data(), dvalL.data(), stL, dptrU.data(), dindU.data(), dvalU.data(), stU, bc));
     }
 
     // gpu-lapack performance
     hipStream_t stream;
     CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
-    double start;
+    rocsolver_bench_timer timer(stream, hot_calls);
 
     if(profile > 0)
     {
@@ -340,42 +399,44 @@ void csrrf_splitlu_getPerfData(rocblas_handle handle,
         rocsolver_log_set_max_levels(profile);
     }
 
-    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    for(rocblas_int iter = 0; iter < timer.calls(); iter++)
     {
-        csrrf_splitlu_initData<false, true, T>(handle, n, nnzT, nnzL, nnzU, dptrT, dindT, dvalT,
-                                               hptrT, hindT, hvalT, hptrL, hindL, hvalL, hptrU,
-                                               hindU, hvalU);
-
-        start = get_time_us_sync(stream);
-        rocsolver_csrrf_splitlu(handle, n, nnzT, dptrT.data(), dindT.data(), dvalT.data(),
-                                dptrL.data(), dindL.data(), dvalL.data(), dptrU.data(),
-                                dindU.data(), dvalU.data());
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        csrrf_splitlu_initData<false, true, T>(handle, n, nnzT, nnzL, nnzU, bc, dptrT, dindT,
+                                               dvalT, hptrT, hindT, hvalT, hptrL, hindL, hvalL,
+                                               hptrU, hindU, hvalU);
+
+        timer.start(iter);
+        rocsolver_csrrf_splitlu(STRIDED, handle, n, nnzT, dptrT.data(), dindT.data(), dvalT.data(),
+                                stT, dptrL.data(), dindL.data(), dvalL.data(), stL, dptrU.data(),
+                                dindU.data(), dvalU.data(), stU, bc);
+        *gpu_time_used += timer.stop(iter);
     }
     *gpu_time_used /= hot_calls;
 }
 
-template <typename T>
+template <bool STRIDED, typename T>
 void testing_csrrf_splitlu(Arguments& argus)
 {
     // get arguments
     rocblas_local_handle handle;
     rocblas_int n = argus.get<rocblas_int>("n");
     rocblas_int nnzT = argus.get<rocblas_int>("nnzT");
+    rocblas_int bc = argus.batch_count;
     rocblas_int hot_calls = argus.iters;
 
     // check non-supported values
     // N/A
 
     // check invalid sizes
-    bool invalid_size = (n < 0 || nnzT < 0);
+    bool invalid_size = (n < 0 || nnzT < 0 || bc < 0);
     if(invalid_size)
     {
-        EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_splitlu(handle, n, nnzT, (rocblas_int*)nullptr,
-                                                      (rocblas_int*)nullptr, (T*)nullptr,
+        EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_splitlu(STRIDED, handle, n, nnzT,
                                                       (rocblas_int*)nullptr, (rocblas_int*)nullptr,
-                                                      (T*)nullptr, (rocblas_int*)nullptr,
-                                                      (rocblas_int*)nullptr, (T*)nullptr),
+                                                      (T*)nullptr, nnzT, (rocblas_int*)nullptr,
+                                                      (rocblas_int*)nullptr, (T*)nullptr, nnzT + n,
+                                                      (rocblas_int*)nullptr, (rocblas_int*)nullptr,
+                                                      (T*)nullptr, nnzT, bc),
                               rocblas_status_invalid_size);
 
         if(argus.timing)
@@ -384,26 +445,6 @@ void testing_csrrf_splitlu(Arguments& argus)
         return;
     }
 
-    // memory size query if necessary
-    if(argus.mem_query || !USE_ROCBLAS_REALLOC_ON_DEMAND)
-    {
-        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
-        CHECK_ALLOC_QUERY(rocsolver_csrrf_splitlu(
-            handle, n, nnzT, (rocblas_int*)nullptr, (rocblas_int*)nullptr, (T*)nullptr,
-            (rocblas_int*)nullptr, (rocblas_int*)nullptr, (T*)nullptr, (rocblas_int*)nullptr,
-            (rocblas_int*)nullptr, (T*)nullptr));
-
-        size_t size;
-        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
-        if(argus.mem_query)
-        {
-            rocsolver_bench_inform(inform_mem_query, size);
-            return;
-        }
-
-        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
-    }
-
     // determine/validate number of non-zeros
     rocblas_int nnzL = n;
     rocblas_int nnzU = 0;
@@ -422,6 +463,32 @@ void testing_csrrf_splitlu(Arguments& argus)
         nnzL += nnzT - nnzU;
     }
 
+    rocblas_stride stT = argus.get<rocblas_stride>("strideT", nnzT);
+    rocblas_stride stL = argus.get<rocblas_stride>("strideL", nnzL);
+    rocblas_stride stU = argus.get<rocblas_stride>("strideU", nnzU);
+    rocblas_stride stLres = (argus.unit_check || argus.norm_check) ? stL : 0;
+    rocblas_stride stUres = (argus.unit_check || argus.norm_check) ? stU : 0;
+
+    // memory size query if necessary
+    if(argus.mem_query || !USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        CHECK_ALLOC_QUERY(rocsolver_csrrf_splitlu(
+            STRIDED, handle, n, nnzT, (rocblas_int*)nullptr, (rocblas_int*)nullptr, (T*)nullptr,
+            stT, (rocblas_int*)nullptr, (rocblas_int*)nullptr, (T*)nullptr, stL,
+            (rocblas_int*)nullptr, (rocblas_int*)nullptr, (T*)nullptr, stU, bc));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        if(argus.mem_query)
+        {
+            rocsolver_bench_inform(inform_mem_query, size);
+            return;
+        }
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
     // determine sizes
     size_t size_ptrT = size_t(n) + 1;
     size_t size_indT = size_t(nnzT);
@@ -454,29 +521,29 @@ void testing_csrrf_splitlu(Arguments& argus)
     // memory allocations
     host_strided_batch_vector<rocblas_int> hptrT(size_ptrT, 1, size_ptrT, 1);
     host_strided_batch_vector<rocblas_int> hindT(size_indT, 1, size_indT, 1);
-    host_strided_batch_vector<T> hvalT(size_valT, 1, size_valT, 1);
+    host_strided_batch_vector<T> hvalT(size_valT, 1, stT, bc);
     host_strided_batch_vector<rocblas_int> hptrL(size_ptrL, 1, size_ptrL, 1);
     host_strided_batch_vector<rocblas_int> hindL(size_indL, 1, size_indL, 1);
-    host_strided_batch_vector<T> hvalL(size_valL, 1, size_valL, 1);
+    host_strided_batch_vector<T> hvalL(size_valL, 1, stL, bc);
     host_strided_batch_vector<rocblas_int> hptrU(size_ptrU, 1, size_ptrU, 1);
     host_strided_batch_vector<rocblas_int> hindU(size_indU, 1, size_indU, 1);
-    host_strided_batch_vector<T> hvalU(size_valU, 1, size_valU, 1);
+    host_strided_batch_vector<T> hvalU(size_valU, 1, stU, bc);
     host_strided_batch_vector<rocblas_int> hptrUres(size_ptrUres, 1, size_ptrUres, 1);
     host_strided_batch_vector<rocblas_int> hindUres(size_indUres, 1, size_indUres, 1);
-    host_strided_batch_vector<T> hvalUres(size_valUres, 1, size_valUres, 1);
+    host_strided_batch_vector<T> hvalUres(size_valUres, 1, stUres, bc);
     host_strided_batch_vector<rocblas_int> hptrLres(size_ptrLres, 1, size_ptrLres, 1);
     host_strided_batch_vector<rocblas_int> hindLres(size_indLres, 1, size_indLres, 1);
-    host_strided_batch_vector<T> hvalLres(size_valLres, 1, size_valLres, 1);
+    host_strided_batch_vector<T> hvalLres(size_valLres, 1, stLres, bc);
 
     device_strided_batch_vector<rocblas_int> dptrT(size_ptrT, 1, size_ptrT, 1);
     device_strided_batch_vector<rocblas_int> dindT(size_indT, 1, size_indT, 1);
-    device_strided_batch_vector<T> dvalT(size_valT, 1, size_valT, 1);
+    device_strided_batch_vector<T> dvalT(size_valT, 1, stT, bc);
     device_strided_batch_vector<rocblas_int> dptrL(size_ptrL, 1, size_ptrL, 1);
     device_strided_batch_vector<rocblas_int> dindL(size_indL, 1, size_indL, 1);
-    device_strided_batch_vector<T> dvalL(size_valL, 1, size_valL, 1);
+    device_strided_batch_vector<T> dvalL(size_valL, 1, stL, bc);
     device_strided_batch_vector<rocblas_int> dptrU(size_ptrU, 1, size_ptrU, 1);
     device_strided_batch_vector<rocblas_int> dindU(size_indU, 1, size_indU, 1);
-    device_strided_batch_vector<T> dvalU(size_valU, 1, size_valU, 1);
+    device_strided_batch_vector<T> dvalU(size_valU, 1, stU, bc);
     CHECK_HIP_ERROR(dptrT.memcheck());
     CHECK_HIP_ERROR(dptrL.memcheck());
     CHECK_HIP_ERROR(dptrU.memcheck());
@@ -494,12 +561,12 @@ void testing_csrrf_splitlu(Arguments& argus)
         CHECK_HIP_ERROR(dindU.memcheck());
 
     // check quick return
-    if(n == 0)
+    if(n == 0 || bc == 0)
     {
-        EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_splitlu(handle, n, nnzT, dptrT.data(), dindT.data(),
-                                                      dvalT.data(), dptrL.data(), dindL.data(),
-                                                      dvalL.data(), dptrU.data(), dindU.data(),
-                                                      dvalU.data()),
+        EXPECT_ROCBLAS_STATUS(rocsolver_csrrf_splitlu(STRIDED, handle, n, nnzT, dptrT.data(),
+                                                      dindT.data(), dvalT.data(), stT, dptrL.data(),
+                                                      dindL.data(), dvalL.data(), stL, dptrU.data(),
+                                                      dindU.data(), dvalU.data(), stU, bc),
                               rocblas_status_success);
         if(argus.timing)
             rocsolver_bench_inform(inform_quick_return);
@@ -509,17 +576,20 @@ void testing_csrrf_splitlu(Arguments& argus)
 
     // check computations
     if(argus.unit_check || argus.norm_check)
-        csrrf_splitlu_getError<T>(handle, n, nnzT, dptrT, dindT, dvalT, nnzL, dptrL, dindL, dvalL,
-                                  nnzU, dptrU, dindU, dvalU, hptrT, hindT, hvalT, hptrL, hindL,
-                                  hvalL, hptrU, hindU, hvalU, hptrLres, hindLres, hvalLres,
-                                  hptrUres, hindUres, hvalUres, &max_error);
+        csrrf_splitlu_getError<STRIDED, T>(handle, n, nnzT, dptrT, dindT, dvalT, stT, nnzL, dptrL,
+                                           dindL, dvalL, stL, nnzU, dptrU, dindU, dvalU, stU, bc,
+                                           hptrT, hindT, hvalT, hptrL, hindL, hvalL, hptrU, hindU,
+                                           hvalU, hptrLres, hindLres, hvalLres, hptrUres, hindUres,
+                                           hvalUres, &max_error);
 
     // collect performance data
     if(argus.timing)
-        csrrf_splitlu_getPerfData<T>(handle, n, nnzT, dptrT, dindT, dvalT, nnzL, dptrL, dindL, dvalL,
-                                     nnzU, dptrU, dindU, dvalU, hptrT, hindT, hvalT, hptrL, hindL,
-                                     hvalL, hptrU, hindU, hvalU, &gpu_time_used, &cpu_time_used,
-                                     hot_calls, argus.profile, argus.profile_kernels, argus.perf);
+        csrrf_splitlu_getPerfData<STRIDED, T>(handle, n, nnzT, dptrT, dindT, dvalT, stT, nnzL,
+                                              dptrL, dindL, dvalL, stL, nnzU, dptrU, dindU, dvalU,
+                                              stU, bc, hptrT, hindT, hvalT, hptrL, hindL, hvalL,
+                                              hptrU, hindU, hvalU, &gpu_time_used, &cpu_time_used,
+                                              hot_calls, argus.profile, argus.profile_kernels,
+                                              argus.perf);
 
     // validate results for rocsolver-test
     // using machine precision for tolerance
@@ -532,8 +602,16 @@ void testing_csrrf_splitlu(Arguments& argus)
         if(!argus.perf)
         {
             rocsolver_bench_header("Arguments:");
-            rocsolver_bench_output("n", "nnzT");
-            rocsolver_bench_output(n, nnzT);
+            if(STRIDED)
+            {
+                rocsolver_bench_output("n", "nnzT", "strideT", "strideL", "strideU", "batch_c");
+                rocsolver_bench_output(n, nnzT, stT, stL, stU, bc);
+            }
+            else
+            {
+                rocsolver_bench_output("n", "nnzT");
+                rocsolver_bench_output(n, nnzT);
+            }
 
             rocsolver_bench_header("Results:");
             if(argus.norm_check)
@@ -564,4 +642,4 @@ void testing_csrrf_splitlu(Arguments& argus)
 #define EXTERN_TESTING_CSRRF_SPLITLU(...) \
     extern template void testing_csrrf_splitlu<__VA_ARGS__>(Arguments&);
 
-INSTANTIATE(EXTERN_TESTING_CSRRF_SPLITLU, FOREACH_REAL_TYPE, APPLY_STAMP)
+INSTANTIATE(EXTERN_TESTING_CSRRF_SPLITLU, FOREACH_STRIDED_VARIANT, FOREACH_REAL_TYPE, APPLY_STAMP)
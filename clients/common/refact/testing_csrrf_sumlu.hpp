@@ -304,6 +304,7 @@ void csrrf_sumlu_getPerfData(rocblas_handle handle,
                                              dptrU, dindU, dvalU, hptrL, hindL, hvalL, hptrU, hindU,
                                              hvalU, hptrT, hindT, hvalT);
 
+        rocsolver_bench_first_call first_call(handle, iter);
         CHECK_ROCBLAS_ERROR(rocsolver_csrrf_sumlu(
             handle, n, nnzL, dptrL.data(), dindL.data(), dvalL.data(), nnzU, dptrU.data(),
             dindU.data(), dvalU.data(), dptrT.data(), dindT.data(), dvalT.data()));
@@ -312,7 +313,7 @@ void csrrf_sumlu_getPerfData(rocblas_handle handle,
     // gpu-lapack performance
     hipStream_t stream;
     CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
-    double start;
+    rocsolver_bench_timer timer(stream, hot_calls);
 
     if(profile > 0)
     {
@@ -324,17 +325,17 @@ void csrrf_sumlu_getPerfData(rocblas_handle handle,
         rocsolver_log_set_max_levels(profile);
     }
 
-    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    for(rocblas_int iter = 0; iter < timer.calls(); iter++)
     {
         csrrf_sumlu_initData<false, true, T>(handle, n, nnzT, nnzL, nnzU, dptrL, dindL, dvalL,
                                              dptrU, dindU, dvalU, hptrL, hindL, hvalL, hptrU, hindU,
                                              hvalU, hptrT, hindT, hvalT);
 
-        start = get_time_us_sync(stream);
+        timer.start(iter);
         rocsolver_csrrf_sumlu(handle, n, nnzL, dptrL.data(), dindL.data(), dvalL.data(), nnzU,
                               dptrU.data(), dindU.data(), dvalU.data(), dptrT.data(), dindT.data(),
                               dvalT.data());
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        *gpu_time_used += timer.stop(iter);
     }
     *gpu_time_used /= hot_calls;
 }
@@ -1384,6 +1384,84 @@ parameters = [
             'strideP': '10',
             'batch_c': '1',
         }
+    ),
+    (
+        'sytrs',
+        '-f sytrs -n 10',
+        {
+            'uplo': 'U',
+            'n': '10',
+            'nrhs': '10',
+            'lda': '10',
+            'ldb': '10',
+        }
+    ),
+    (
+        'sytrs_batched',
+        '-f sytrs_batched -n 10',
+        {
+            'uplo': 'U',
+            'n': '10',
+            'nrhs': '10',
+            'lda': '10',
+            'ldb': '10',
+            'strideP': '10',
+            'batch_c': '1',
+        }
+    ),
+    (
+        'sytrs_strided_batched',
+        '-f sytrs_strided_batched -n 10',
+        {
+            'uplo': 'U',
+            'n': '10',
+            'nrhs': '10',
+            'lda': '10',
+            'ldb': '10',
+            'strideA': '100',
+            'strideP': '10',
+            'strideB': '100',
+            'batch_c': '1',
+        }
+    ),
+    (
+        'sysv',
+        '-f sysv -n 10',
+        {
+            'uplo': 'U',
+            'n': '10',
+            'nrhs': '10',
+            'lda': '10',
+            'ldb': '10',
+        }
+    ),
+    (
+        'sysv_batched',
+        '-f sysv_batched -n 10',
+        {
+            'uplo': 'U',
+            'n': '10',
+            'nrhs': '10',
+            'lda': '10',
+            'ldb': '10',
+            'strideP': '10',
+            'batch_c': '1',
+        }
+    ),
+    (
+        'sysv_strided_batched',
+        '-f sysv_strided_batched -n 10',
+        {
+            'uplo': 'U',
+            'n': '10',
+            'nrhs': '10',
+            'lda': '10',
+            'ldb': '10',
+            'strideA': '100',
+            'strideP': '10',
+            'strideB': '100',
+            'batch_c': '1',
+        }
     )
 ]
 
@@ -35,7 +35,9 @@ using namespace std;
 
 typedef std::tuple<vector<int>, vector<int>> bdsqr_tuple;
 
-// each size_range is a {n, nv, nu, nc}
+// each size_range is a {n, nv, nu, nc, [alg]}
+// if alg = 1 then the hybrid CPU+GPU mode is used
+// (QR iteration on the device otherwise)
 
 // each opt_range is a {uplo, ldv, ldu, ldc}
 // if uplo = 0, then is upper bidiagonal
@@ -64,6 +66,10 @@ const vector<vector<int>> size_range = {
     {30, 50, 0, 0},
     {50, 60, 20, 0},
     {70, 0, 0, 0},
+    // hybrid samples
+    {15, 10, 10, 10, 1},
+    {50, 60, 20, 0, 1},
+    {70, 0, 0, 0, 1},
 };
 
 const vector<vector<int>> opt_range = {
@@ -81,7 +87,8 @@ const vector<vector<int>> opt_range = {
 
 // for daily_lapack tests
 const vector<vector<int>> large_size_range
-    = {{152, 152, 152, 152}, {640, 640, 656, 700}, {1000, 1024, 1000, 80}, {2000, 0, 0, 0}};
+    = {{152, 152, 152, 152}, {640, 640, 656, 700}, {1000, 1024, 1000, 80}, {2000, 0, 0, 0},
+       {152, 152, 152, 152, 1}, {1000, 1024, 1000, 80, 1}};
 
 const vector<vector<int>> large_opt_range = {{0, 0, 0, 0}, {1, 0, 1, 0}, {0, 1, 0, 1}, {1, 0, 0, 0}};
 
@@ -103,6 +110,9 @@ Arguments bdsqr_setup_arguments(bdsqr_tuple tup)
 
     arg.set<char>("uplo", opt[0] ? 'L' : 'U');
 
+    if(size.size() > 4 && size[4] == 1)
+        arg.set<char>("alg_mode", 'H');
+
     arg.set<rocblas_int>("ldv", (nv > 0 ? n : 1) + opt[1] * 10);
     arg.set<rocblas_int>("ldu", (nu > 0 ? nu : 1) + opt[2] * 10);
     arg.set<rocblas_int>("ldc", (nc > 0 ? n : 1) + opt[3] * 10);
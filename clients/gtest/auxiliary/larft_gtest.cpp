@@ -70,7 +70,7 @@ const vector<vector<int>> reflector_size_range = {
 
 // for daily_lapack tests
 const vector<vector<int>> large_order_size_range
-    = {{192, 192, 0}, {640, 75, 1}, {1024, 1200, 0}, {2048, 100, 1}};
+    = {{192, 192, 0}, {640, 75, 1}, {1024, 1200, 0}, {2048, 100, 1}, {1536, 1536, 0}};
 
 const vector<vector<int>> large_reflector_size_range
     = {{15, 15, 0}, {25, 40, 1}, {45, 45, 0}, {60, 70, 1}, {75, 75, 0}};
@@ -1,5 +1,5 @@
 /* **************************************************************************
- * Copyright (C) 2020-2024 Advanced Micro Devices, Inc. All rights reserved.
+ * Copyright (C) 2020-2025 Advanced Micro Devices, Inc. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions
@@ -25,6 +25,7 @@
  * SUCH DAMAGE.
  * *************************************************************************/
 
+#include "common/auxiliary/testing_orgqr_ungqr_outofplace.hpp"
 #include "common/auxiliary/testing_orgxr_ungxr.hpp"
 
 using ::testing::Combine;
@@ -114,6 +115,27 @@ protected:
     }
 };
 
+class ORGQR_UNGQR_OUTOFPLACE : public ::TestWithParam<orgqr_tuple>
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_EQ(hipGetLastError(), hipSuccess);
+    }
+
+    template <typename T>
+    void run_tests()
+    {
+        Arguments arg = orgqr_setup_arguments(GetParam());
+        arg.set<rocblas_int>("ldq", arg.peek<rocblas_int>("lda"));
+
+        if(arg.peek<rocblas_int>("m") == 0 && arg.peek<rocblas_int>("n") == 0)
+            testing_orgqr_ungqr_outofplace_bad_arg<T>();
+
+        testing_orgqr_ungqr_outofplace<T>(arg);
+    }
+};
+
 class ORG2R : public ORGXR_UNGXR<false>
 {
 };
@@ -130,6 +152,14 @@ class UNGQR : public ORGXR_UNGXR<true>
 {
 };
 
+class ORGQR_OUTOFPLACE : public ORGQR_UNGQR_OUTOFPLACE
+{
+};
+
+class UNGQR_OUTOFPLACE : public ORGQR_UNGQR_OUTOFPLACE
+{
+};
+
 // non-batch tests
 
 TEST_P(ORG2R, __float)
@@ -172,6 +202,26 @@ TEST_P(UNGQR, __double_complex)
     run_tests<rocblas_double_complex>();
 }
 
+TEST_P(ORGQR_OUTOFPLACE, __float)
+{
+    run_tests<float>();
+}
+
+TEST_P(ORGQR_OUTOFPLACE, __double)
+{
+    run_tests<double>();
+}
+
+TEST_P(UNGQR_OUTOFPLACE, __float_complex)
+{
+    run_tests<rocblas_float_complex>();
+}
+
+TEST_P(UNGQR_OUTOFPLACE, __double_complex)
+{
+    run_tests<rocblas_double_complex>();
+}
+
 INSTANTIATE_TEST_SUITE_P(daily_lapack,
                          ORG2R,
                          Combine(ValuesIn(large_m_size_range), ValuesIn(large_n_size_range)));
@@ -203,3 +253,19 @@ INSTANTIATE_TEST_SUITE_P(daily_lapack,
 INSTANTIATE_TEST_SUITE_P(checkin_lapack,
                          UNGQR,
                          Combine(ValuesIn(m_size_range), ValuesIn(n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         ORGQR_OUTOFPLACE,
+                         Combine(ValuesIn(large_m_size_range), ValuesIn(large_n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         ORGQR_OUTOFPLACE,
+                         Combine(ValuesIn(m_size_range), ValuesIn(n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         UNGQR_OUTOFPLACE,
+                         Combine(ValuesIn(large_m_size_range), ValuesIn(large_n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         UNGQR_OUTOFPLACE,
+                         Combine(ValuesIn(m_size_range), ValuesIn(n_size_range)));
@@ -0,0 +1,136 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "common/auxiliary/testing_tfttr.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<printable_char, printable_char, vector<int>> tfttr_tuple;
+
+// each range is a {n,lda}
+
+// the combinations of transr and type that are not supported (transr = T for
+// complex types, or transr = C for real types) check the invalid value case
+
+// case when n = 0, transr = N and uplo = L will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+// for checkin_lapack tests
+const vector<vector<int>> size_range = {
+    // quick return
+    {0, 1},
+    // invalid
+    {-1, 1},
+    {10, 5},
+    // normal (valid) samples
+    {1, 1},
+    {2, 2},
+    {15, 15},
+    {20, 20},
+    {25, 30},
+    {40, 50}};
+const vector<vector<int>> large_size_range = {{191, 200}, {300, 300}};
+const vector<printable_char> transr_range = {'N', 'T', 'C'};
+const vector<printable_char> uplo_range = {'L', 'U'};
+
+Arguments tfttr_setup_arguments(tfttr_tuple tup)
+{
+    char transr = std::get<0>(tup);
+    char uplo = std::get<1>(tup);
+    vector<int> size = std::get<2>(tup);
+
+    Arguments arg;
+
+    arg.set<rocblas_int>("n", size[0]);
+    arg.set<rocblas_int>("lda", size[1]);
+
+    arg.set<char>("transr", transr);
+    arg.set<char>("uplo", uplo);
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class TFTTR : public ::TestWithParam<tfttr_tuple>
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_EQ(hipGetLastError(), hipSuccess);
+    }
+
+    template <typename T>
+    void run_tests()
+    {
+        Arguments arg = tfttr_setup_arguments(GetParam());
+
+        if(arg.peek<rocblas_int>("n") == 0 && arg.peek<char>("transr") == 'N'
+           && arg.peek<char>("uplo") == 'L')
+            testing_tfttr_bad_arg<T>();
+
+        testing_tfttr<T>(arg);
+    }
+};
+
+// non-batch tests
+
+TEST_P(TFTTR, __float)
+{
+    run_tests<float>();
+}
+
+TEST_P(TFTTR, __double)
+{
+    run_tests<double>();
+}
+
+TEST_P(TFTTR, __float_complex)
+{
+    run_tests<rocblas_float_complex>();
+}
+
+TEST_P(TFTTR, __double_complex)
+{
+    run_tests<rocblas_double_complex>();
+}
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         TFTTR,
+                         Combine(ValuesIn(transr_range),
+                                 ValuesIn(uplo_range),
+                                 ValuesIn(large_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         TFTTR,
+                         Combine(ValuesIn(transr_range),
+                                 ValuesIn(uplo_range),
+                                 ValuesIn(size_range)));
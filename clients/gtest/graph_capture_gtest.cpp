@@ -0,0 +1,508 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <hip/hip_runtime_api.h>
+#include <rocblas/rocblas.h>
+#include <rocsolver/rocsolver.h>
+
+/***************************************************************************
+ * Conformance tests for stream capture: every function is first executed
+ * directly on the stream of the handle, and then captured into a HIP graph
+ * (as in clients/samples/example_graph.c) that is replayed several times.
+ * The outputs of every replay must match those of the direct execution.
+ ***************************************************************************/
+
+class checkin_misc_GRAPH_CAPTURE : public ::testing::Test
+{
+protected:
+    // a device array that is restored to its initial values before every execution, and
+    // whose final values are compared with those of the direct execution (if compare is true)
+    template <typename T>
+    struct buffer
+    {
+        T* ptr;
+        std::vector<T> initial;
+        bool compare;
+        std::vector<T> reference;
+    };
+
+    void SetUp() override
+    {
+        ASSERT_EQ(hipStreamCreate(&stream), hipSuccess);
+        ASSERT_EQ(rocblas_create_handle(&handle), rocblas_status_success);
+        ASSERT_EQ(rocblas_set_stream(handle, stream), rocblas_status_success);
+    }
+
+    void TearDown() override
+    {
+        for(auto& b : dbuffers)
+            EXPECT_EQ(hipFree(b.ptr), hipSuccess);
+        for(auto& b : ibuffers)
+            EXPECT_EQ(hipFree(b.ptr), hipSuccess);
+        EXPECT_EQ(rocblas_destroy_handle(handle), rocblas_status_success);
+        EXPECT_EQ(hipStreamDestroy(stream), hipSuccess);
+    }
+
+    template <typename T>
+    T* alloc(std::vector<buffer<T>>& buffers, std::vector<T> initial, bool compare)
+    {
+        T* ptr = nullptr;
+        EXPECT_EQ(hipMalloc(&ptr, sizeof(T) * std::max(initial.size(), size_t(1))), hipSuccess);
+        buffers.push_back({ptr, std::move(initial), compare, {}});
+        return ptr;
+    }
+
+    // device arrays of doubles and integers; an output-only array starts as zeros
+    double* dinput(std::vector<double> initial, bool compare = false)
+    {
+        return alloc(dbuffers, std::move(initial), compare);
+    }
+    double* doutput(size_t count)
+    {
+        return alloc(dbuffers, std::vector<double>(count, 0), true);
+    }
+    rocblas_int* ioutput(size_t count)
+    {
+        return alloc(ibuffers, std::vector<rocblas_int>(count, 0), true);
+    }
+
+    template <typename T>
+    void restore(std::vector<buffer<T>>& buffers)
+    {
+        for(auto& b : buffers)
+            ASSERT_EQ(hipMemcpy(b.ptr, b.initial.data(), sizeof(T) * b.initial.size(),
+                                hipMemcpyHostToDevice),
+                      hipSuccess);
+    }
+
+    template <typename T>
+    void download(buffer<T>& b, std::vector<T>& values)
+    {
+        values.resize(b.initial.size());
+        ASSERT_EQ(hipMemcpy(values.data(), b.ptr, sizeof(T) * values.size(),
+                            hipMemcpyDeviceToHost),
+                  hipSuccess);
+    }
+
+    /** Executes call directly, then captures it into a graph, replays the graph and compares
+        the outputs. After returning, the device arrays hold the outputs of the last replay. **/
+    template <typename F>
+    void check_capture(F call, const double tol = 1e-12)
+    {
+        // direct execution (this also allocates the workspace of the handle)
+        restore(dbuffers);
+        restore(ibuffers);
+        ASSERT_EQ(call(), rocblas_status_success);
+        ASSERT_EQ(hipStreamSynchronize(stream), hipSuccess);
+        for(auto& b : dbuffers)
+            download(b, b.reference);
+        for(auto& b : ibuffers)
+            download(b, b.reference);
+
+        // capture
+        hipGraph_t graph;
+        hipGraphExec_t exec;
+        ASSERT_EQ(hipStreamBeginCapture(stream, hipStreamCaptureModeGlobal), hipSuccess);
+        rocblas_status status = call();
+        ASSERT_EQ(hipStreamEndCapture(stream, &graph), hipSuccess);
+        ASSERT_EQ(status, rocblas_status_success);
+        ASSERT_EQ(hipGraphInstantiate(&exec, graph, nullptr, nullptr, 0), hipSuccess);
+        ASSERT_EQ(hipGraphDestroy(graph), hipSuccess);
+
+        // replays
+        for(int replay = 0; replay < 3; ++replay)
+        {
+            restore(dbuffers);
+            restore(ibuffers);
+            ASSERT_EQ(hipGraphLaunch(exec, stream), hipSuccess);
+            ASSERT_EQ(hipStreamSynchronize(stream), hipSuccess);
+
+            std::vector<double> dvalues;
+            for(auto& b : dbuffers)
+            {
+                if(!b.compare)
+                    continue;
+                download(b, dvalues);
+                double scale = 1;
+                for(double r : b.reference)
+                    scale = std::max(scale, std::abs(r));
+                for(size_t i = 0; i < dvalues.size(); ++i)
+                    ASSERT_LE(std::abs(dvalues[i] - b.reference[i]), tol * scale)
+                        << "replay " << replay << ", entry " << i;
+            }
+
+            std::vector<rocblas_int> ivalues;
+            for(auto& b : ibuffers)
+            {
+                if(!b.compare)
+                    continue;
+                download(b, ivalues);
+                ASSERT_EQ(ivalues, b.reference) << "replay " << replay;
+            }
+        }
+
+        ASSERT_EQ(hipGraphExecDestroy(exec), hipSuccess);
+    }
+
+    // bc diagonally dominant general matrices (or symmetric positive definite matrices if
+    // spd is true) of size rows-by-cols
+    std::vector<double> matrix(rocblas_int rows, rocblas_int cols, bool spd = false)
+    {
+        const rocblas_stride st = stA(rows, cols);
+        std::vector<double> hA(st * bc);
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            double* A = hA.data() + b * st;
+            for(rocblas_int j = 0; j < cols; ++j)
+                for(rocblas_int i = 0; i < rows; ++i)
+                    A[i + j * size_t(rows)] = (spd && i < j) ? A[j + i * size_t(rows)] : dist(gen);
+            for(rocblas_int j = 0; j < std::min(rows, cols); ++j)
+                A[j + j * size_t(rows)] += cols;
+        }
+        return hA;
+    }
+
+    static rocblas_stride stA(rocblas_int m, rocblas_int n)
+    {
+        return rocblas_stride(m) * n;
+    }
+
+    rocblas_handle handle;
+    hipStream_t stream;
+    std::vector<buffer<double>> dbuffers;
+    std::vector<buffer<rocblas_int>> ibuffers;
+    std::mt19937 gen{20250101};
+    std::uniform_real_distribution<double> dist{-1.0, 1.0};
+
+    const rocblas_int n = 64;
+    const rocblas_int m = 80;
+    const rocblas_int nrhs = 4;
+    const rocblas_int bc = 3;
+};
+
+TEST_F(checkin_misc_GRAPH_CAPTURE, getrf_getrs)
+{
+    double* dA = dinput(matrix(n, n), true);
+    double* dB = dinput(matrix(n, nrhs), true);
+    rocblas_int* dP = ioutput(size_t(n) * bc);
+    rocblas_int* dinfo = ioutput(bc);
+
+    check_capture([&] {
+        rocblas_status status = rocsolver_dgetrf_strided_batched(handle, n, n, dA, n, stA(n, n),
+                                                                 dP, n, dinfo, bc);
+        if(status != rocblas_status_success)
+            return status;
+        return rocsolver_dgetrs_strided_batched(handle, rocblas_operation_none, n, nrhs, dA, n,
+                                                stA(n, n), dP, n, dB, n, stA(n, nrhs), bc);
+    });
+}
+
+TEST_F(checkin_misc_GRAPH_CAPTURE, potrf_potrs)
+{
+    double* dA = dinput(matrix(n, n, true), true);
+    double* dB = dinput(matrix(n, nrhs), true);
+    rocblas_int* dinfo = ioutput(bc);
+
+    check_capture([&] {
+        rocblas_status status = rocsolver_dpotrf_strided_batched(handle, rocblas_fill_lower, n, dA,
+                                                                 n, stA(n, n), dinfo, bc);
+        if(status != rocblas_status_success)
+            return status;
+        return rocsolver_dpotrs_strided_batched(handle, rocblas_fill_lower, n, nrhs, dA, n,
+                                                stA(n, n), dB, n, stA(n, nrhs), bc);
+    });
+}
+
+TEST_F(checkin_misc_GRAPH_CAPTURE, geqrf)
+{
+    double* dA = dinput(matrix(m, n), true);
+    double* dtau = doutput(size_t(n) * bc);
+
+    check_capture([&] {
+        return rocsolver_dgeqrf_strided_batched(handle, m, n, dA, m, stA(m, n), dtau, n, bc);
+    });
+}
+
+TEST_F(checkin_misc_GRAPH_CAPTURE, gels)
+{
+    double* dA = dinput(matrix(m, n), true);
+    double* dB = dinput(matrix(m, nrhs), true);
+    rocblas_int* dinfo = ioutput(1);
+
+    check_capture([&] {
+        return rocsolver_dgels(handle, rocblas_operation_none, m, n, nrhs, dA, m, dB, m, dinfo);
+    });
+}
+
+TEST_F(checkin_misc_GRAPH_CAPTURE, gesv_posv)
+{
+    double* dA = dinput(matrix(n, n), true);
+    double* dS = dinput(matrix(n, n, true), true);
+    double* dB = dinput(matrix(n, nrhs), true);
+    double* dC = dinput(matrix(n, nrhs), true);
+    rocblas_int* dP = ioutput(size_t(n) * bc);
+    rocblas_int* dinfo = ioutput(2 * bc);
+
+    check_capture([&] {
+        rocblas_status status = rocsolver_dgesv_strided_batched(
+            handle, n, nrhs, dA, n, stA(n, n), dP, n, dB, n, stA(n, nrhs), dinfo, bc);
+        if(status != rocblas_status_success)
+            return status;
+        return rocsolver_dposv_strided_batched(handle, rocblas_fill_upper, n, nrhs, dS, n,
+                                               stA(n, n), dC, n, stA(n, nrhs), dinfo + bc, bc);
+    });
+}
+
+TEST_F(checkin_misc_GRAPH_CAPTURE, getri)
+{
+    double* dA = dinput(matrix(n, n), true);
+    rocblas_int* dP = ioutput(n);
+    rocblas_int* dinfo = ioutput(2);
+
+    check_capture([&] {
+        rocblas_status status = rocsolver_dgetrf(handle, n, n, dA, n, dP, dinfo);
+        if(status != rocblas_status_success)
+            return status;
+        return rocsolver_dgetri(handle, n, dA, n, dP, dinfo + 1);
+    });
+}
+
+TEST_F(checkin_misc_GRAPH_CAPTURE, syevd)
+{
+    double* dA = dinput(matrix(n, n, true), true);
+    double* dD = doutput(n);
+    double* dE = doutput(n);
+    rocblas_int* dinfo = ioutput(1);
+
+    check_capture([&] {
+        return rocsolver_dsyevd(handle, rocblas_evect_original, rocblas_fill_lower, n, dA, n, dD,
+                                dE, dinfo);
+    });
+}
+
+TEST_F(checkin_misc_GRAPH_CAPTURE, syevj)
+{
+    // the host does not check for convergence during the capture, so the graph always
+    // executes max_sweeps sweeps (the kernels return early once a problem has converged)
+    double* dA = dinput(matrix(n, n, true), true);
+    double* dres = doutput(bc);
+    double* dW = doutput(size_t(n) * bc);
+    rocblas_int* dsweeps = ioutput(bc);
+    rocblas_int* dinfo = ioutput(bc);
+
+    check_capture([&] {
+        return rocsolver_dsyevj_strided_batched(handle, rocblas_esort_ascending,
+                                                rocblas_evect_original, rocblas_fill_upper, n, dA,
+                                                n, stA(n, n), 0, dres, 100, dsweeps, dW, n, dinfo,
+                                                bc);
+    });
+}
+
+TEST_F(checkin_misc_GRAPH_CAPTURE, gesvd)
+{
+    double* dA = dinput(matrix(m, n), true);
+    double* dS = doutput(size_t(n) * bc);
+    double* dU = doutput(size_t(m) * n * bc);
+    double* dV = doutput(size_t(n) * n * bc);
+    double* dE = doutput(size_t(n) * bc);
+    rocblas_int* dinfo = ioutput(bc);
+
+    check_capture([&] {
+        return rocsolver_dgesvd_strided_batched(
+            handle, rocblas_svect_singular, rocblas_svect_singular, m, n, dA, m, stA(m, n), dS, n,
+            dU, m, stA(m, n), dV, n, stA(n, n), dE, n, rocblas_outofplace, dinfo, bc);
+    });
+}
+
+TEST_F(checkin_misc_GRAPH_CAPTURE, bdsqr)
+{
+    // the blocked algorithm checks for convergence on the host, and thus it is replaced by the
+    // unblocked one during the capture; the size is large enough for the blocked algorithm to be
+    // used in the direct execution, so only the singular values are compared
+    const rocblas_int nb = 600;
+    std::vector<double> hD(nb), hE(nb - 1), hI(size_t(nb) * nb, 0);
+    for(auto& d : hD)
+        d = 2 + dist(gen);
+    for(auto& e : hE)
+        e = dist(gen);
+    for(rocblas_int i = 0; i < nb; ++i)
+        hI[i + i * size_t(nb)] = 1;
+    double* dD = dinput(hD, true);
+    double* dE = dinput(hE);
+    double* dV = dinput(hI);
+    double* dU = dinput(hI);
+    rocblas_int* dinfo = ioutput(1);
+
+    check_capture(
+        [&] {
+            return rocsolver_dbdsqr(handle, rocblas_fill_upper, nb, nb, nb, 0, dD, dE, dV, nb, dU,
+                                    nb, nullptr, 1, dinfo);
+        },
+        1e-10);
+}
+
+TEST_F(checkin_misc_GRAPH_CAPTURE, mixed_precision)
+{
+    // the iterative refinement checks for convergence on the host, and thus the systems are
+    // solved directly in full precision during the capture (iter = -1)
+    double* dA = dinput(matrix(n, n));
+    double* dS = dinput(matrix(n, n, true));
+    double* dB = dinput(matrix(n, nrhs));
+    double* dX = doutput(size_t(n) * nrhs);
+    double* dY = doutput(size_t(n) * nrhs);
+    rocblas_int* dP = alloc(ibuffers, std::vector<rocblas_int>(n, 0), false);
+    rocblas_int* diter = alloc(ibuffers, std::vector<rocblas_int>(2, 0), false);
+    rocblas_int* dinfo = ioutput(2);
+
+    check_capture(
+        [&] {
+            rocblas_status status
+                = rocsolver_dsgesv(handle, n, nrhs, dA, n, dP, dB, n, dX, n, diter, dinfo);
+            if(status != rocblas_status_success)
+                return status;
+            return rocsolver_dsposv(handle, rocblas_fill_lower, n, nrhs, dS, n, dB, n, dY, n,
+                                    diter + 1, dinfo + 1);
+        },
+        1e-10);
+
+    std::vector<rocblas_int> hiter(2);
+    ASSERT_EQ(hipMemcpy(hiter.data(), diter, sizeof(rocblas_int) * 2, hipMemcpyDeviceToHost),
+              hipSuccess);
+    EXPECT_EQ(hiter[0], -1);
+    EXPECT_EQ(hiter[1], -1);
+}
+
+TEST_F(checkin_misc_GRAPH_CAPTURE, workspace_preallocation)
+{
+    // a workspace larger than the default device memory of the handle cannot be allocated
+    // during the capture, unless it is preallocated
+    const rocblas_int nl = 1500;
+    const rocblas_int bcl = 8;
+    double* dA;
+    rocblas_int *dP, *dinfo;
+    ASSERT_EQ(hipMalloc(&dA, sizeof(double) * stA(nl, nl) * bcl), hipSuccess);
+    ASSERT_EQ(hipMalloc(&dP, sizeof(rocblas_int) * nl * bcl), hipSuccess);
+    ASSERT_EQ(hipMalloc(&dinfo, sizeof(rocblas_int) * bcl), hipSuccess);
+
+    size_t size;
+    ASSERT_EQ(rocblas_start_device_memory_size_query(handle), rocblas_status_success);
+    ASSERT_EQ(rocsolver_dgetrf_strided_batched(handle, nl, nl, nullptr, nl, stA(nl, nl), nullptr,
+                                               nl, nullptr, bcl),
+              rocblas_status_size_increased);
+    ASSERT_EQ(rocblas_stop_device_memory_size_query(handle, &size), rocblas_status_success);
+
+    size_t current;
+    ASSERT_EQ(rocblas_get_device_memory_size(handle, &current), rocblas_status_success);
+    if(!rocblas_is_managing_device_memory(handle) || size <= current)
+        GTEST_SKIP() << "The workspace fits in the device memory of the handle";
+
+    for(int warmup = 0; warmup < 2; ++warmup)
+    {
+        if(warmup)
+        {
+            rocsolver_problem_shape shape
+                = {rocsolver_function_getrf, rocblas_datatype_f64_r, nl, nl, 0, bcl};
+            ASSERT_EQ(rocsolver_initialize(handle, &shape, 1), rocblas_status_success);
+        }
+
+        hipGraph_t graph;
+        ASSERT_EQ(hipStreamBeginCapture(stream, hipStreamCaptureModeGlobal), hipSuccess);
+        rocblas_status status = rocsolver_dgetrf_strided_batched(handle, nl, nl, dA, nl,
+                                                                 stA(nl, nl), dP, nl, dinfo, bcl);
+        ASSERT_EQ(hipStreamEndCapture(stream, &graph), hipSuccess);
+        ASSERT_EQ(hipGraphDestroy(graph), hipSuccess);
+        EXPECT_EQ(status, warmup ? rocblas_status_success : rocblas_status_memory_error);
+    }
+
+    EXPECT_EQ(hipFree(dA), hipSuccess);
+    EXPECT_EQ(hipFree(dP), hipSuccess);
+    EXPECT_EQ(hipFree(dinfo), hipSuccess);
+}
+
+TEST_F(checkin_misc_GRAPH_CAPTURE, plans)
+{
+    double* dA = dinput(matrix(n, n), true);
+    double* dB = dinput(matrix(n, nrhs), true);
+    rocblas_int* dP = ioutput(size_t(n) * bc);
+    rocblas_int* dinfo = ioutput(bc);
+
+    rocsolver_plan plan;
+    rocsolver_problem_shape shape
+        = {rocsolver_function_syevd, rocblas_datatype_f64_r, n, n, nrhs, bc};
+    EXPECT_EQ(rocsolver_create_plan(&plan, handle, &shape, rocsolver_plan_mode_graph),
+              rocblas_status_invalid_value);
+    shape.function = rocsolver_function_gesv;
+    EXPECT_EQ(rocsolver_create_plan(nullptr, handle, &shape, rocsolver_plan_mode_graph),
+              rocblas_status_invalid_pointer);
+    EXPECT_EQ(rocsolver_create_plan(&plan, nullptr, &shape, rocsolver_plan_mode_graph),
+              rocblas_status_invalid_handle);
+    ASSERT_EQ(rocsolver_create_plan(&plan, handle, &shape, rocsolver_plan_mode_graph),
+              rocblas_status_success);
+    EXPECT_EQ(rocsolver_execute_plan(plan, nullptr), rocblas_status_invalid_pointer);
+
+    rocsolver_plan_args args = {};
+    args.A = dA;
+    args.lda = n;
+    args.strideA = stA(n, n);
+    args.ipiv = dP;
+    args.strideP = n;
+    args.B = dB;
+    args.ldb = n;
+    args.strideB = stA(n, nrhs);
+    args.info = dinfo;
+
+    // the direct execution of the plan captures its graph, and the executions within the
+    // capture of the test call the function
+    check_capture([&] { return rocsolver_execute_plan(plan, &args); });
+
+    // the following executions with the same arguments launch the graph of the plan
+    for(int replay = 0; replay < 2; ++replay)
+    {
+        restore(dbuffers);
+        restore(ibuffers);
+        ASSERT_EQ(rocsolver_execute_plan(plan, &args), rocblas_status_success);
+        ASSERT_EQ(hipStreamSynchronize(stream), hipSuccess);
+
+        std::vector<double> dvalues;
+        for(auto& b : dbuffers)
+        {
+            download(b, dvalues);
+            for(size_t i = 0; i < dvalues.size(); ++i)
+                ASSERT_LE(std::abs(dvalues[i] - b.reference[i]),
+                          1e-12 * std::max(1.0, std::abs(b.reference[i])))
+                    << "replay " << replay << ", entry " << i;
+        }
+    }
+
+    EXPECT_EQ(rocsolver_destroy_plan(plan), rocblas_status_success);
+}
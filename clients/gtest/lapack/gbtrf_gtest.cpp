@@ -0,0 +1,200 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "common/lapack/testing_gbtrf.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, vector<int>> gbtrf_tuple;
+
+// each matrix_size_range vector is a {m, n, singular}
+// if singular = 1, then the used matrix for the tests is singular
+
+// each band_size_range vector is a {kl, ku, ldab}
+
+// case when m = n = 0 will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+// for checkin_lapack tests
+const vector<vector<int>> matrix_size_range = {
+    // quick return
+    {0, 0, 0},
+    // invalid
+    {-1, 1, 0},
+    {1, -1, 0},
+    // normal (valid) samples
+    {20, 20, 0},
+    {30, 25, 1},
+    {25, 40, 0},
+    {50, 50, 1}};
+
+const vector<vector<int>> band_size_range = {
+    // invalid
+    {1, 1, 3},
+    // normal (valid) samples
+    {0, 0, 1},
+    {1, 2, 5},
+    {3, 1, 9},
+    {5, 5, 20}};
+
+// for daily_lapack tests
+const vector<vector<int>> large_matrix_size_range = {
+    {200, 200, 0},
+    {500, 400, 1},
+    {1000, 1000, 0},
+};
+
+const vector<vector<int>> large_band_size_range = {
+    {2, 3, 10},
+    {16, 16, 50},
+    {40, 20, 101},
+};
+
+Arguments gbtrf_setup_arguments(gbtrf_tuple tup)
+{
+    vector<int> matrix_size = std::get<0>(tup);
+    vector<int> band_size = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.set<rocblas_int>("m", matrix_size[0]);
+    arg.set<rocblas_int>("n", matrix_size[1]);
+    arg.set<rocblas_int>("kl", band_size[0]);
+    arg.set<rocblas_int>("ku", band_size[1]);
+    arg.set<rocblas_int>("ldab", band_size[2]);
+
+    // only testing standard use case/defaults for strides
+
+    arg.timing = 0;
+    arg.singular = matrix_size[2];
+
+    return arg;
+}
+
+class GBTRF : public ::TestWithParam<gbtrf_tuple>
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_EQ(hipGetLastError(), hipSuccess);
+    }
+
+    template <bool BATCHED, bool STRIDED, typename T>
+    void run_tests()
+    {
+        Arguments arg = gbtrf_setup_arguments(GetParam());
+
+        if(arg.peek<rocblas_int>("m") == 0 && arg.peek<rocblas_int>("n") == 0)
+            testing_gbtrf_bad_arg<BATCHED, STRIDED, T>();
+
+        arg.batch_count = (BATCHED || STRIDED ? 3 : 1);
+        if(arg.singular == 1)
+            testing_gbtrf<BATCHED, STRIDED, T>(arg);
+
+        arg.singular = 0;
+        testing_gbtrf<BATCHED, STRIDED, T>(arg);
+    }
+};
+
+// non-batch tests
+
+TEST_P(GBTRF, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(GBTRF, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(GBTRF, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(GBTRF, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+// batched tests
+
+TEST_P(GBTRF, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(GBTRF, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(GBTRF, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(GBTRF, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
+// strided_batched tests
+
+TEST_P(GBTRF, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(GBTRF, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(GBTRF, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(GBTRF, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         GBTRF,
+                         Combine(ValuesIn(large_matrix_size_range),
+                                 ValuesIn(large_band_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GBTRF,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(band_size_range)));
@@ -56,13 +56,15 @@ const vector<vector<int>> matrix_size_range = {
     {16, 2, 20, 16, 16, 1},
     {10, 7, 10, 20, 10, 0},
     {10, 10, 10, 10, 20, 1},
+    {8, 100, 8, 8, 8, 0},
 };
 
 // for daily_lapack tests
 const vector<vector<int>> large_matrix_size_range = {{32, 6, 32, 32, 32, 0},
                                                      {50, 10, 60, 50, 50, 1},
                                                      {32, 10, 32, 40, 32, 0},
-                                                     {32, 20, 32, 32, 40, 0}};
+                                                     {32, 20, 32, 32, 40, 0},
+                                                     {8, 1000, 8, 8, 8, 0}};
 
 Arguments geblttrf_setup_arguments(geblttrf_tuple tup, bool interleaved)
 {
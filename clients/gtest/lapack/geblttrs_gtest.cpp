@@ -57,13 +57,15 @@ const vector<vector<int>> matrix_size_range = {
     {16, 2, 10, 20, 16, 16, 16},
     {10, 7, 20, 10, 20, 10, 10},
     {10, 10, 20, 10, 10, 20, 20},
+    {8, 100, 40, 8, 8, 8, 8},
 };
 
 // for daily_lapack tests
 const vector<vector<int>> large_matrix_size_range = {{32, 6, 10, 32, 32, 32, 32},
                                                      {50, 10, 10, 60, 50, 50, 50},
                                                      {32, 10, 20, 32, 40, 32, 40},
-                                                     {32, 20, 20, 32, 32, 40, 32}};
+                                                     {32, 20, 20, 32, 32, 40, 32},
+                                                     {8, 1000, 4, 8, 8, 8, 8}};
 
 Arguments geblttrs_setup_arguments(geblttrs_tuple tup, bool interleaved)
 {
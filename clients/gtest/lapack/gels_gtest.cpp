@@ -1,5 +1,5 @@
 /* **************************************************************************
- * Copyright (C) 2020-2024 Advanced Micro Devices, Inc. All rights reserved.
+ * Copyright (C) 2020-2025 Advanced Micro Devices, Inc. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions
@@ -26,6 +26,7 @@
  * *************************************************************************/
 
 #include "common/lapack/testing_gels.hpp"
+#include "common/lapack/testing_gels_mixed.hpp"
 #include "common/lapack/testing_gels_outofplace.hpp"
 
 using ::testing::Combine;
@@ -167,6 +168,35 @@ protected:
     }
 };
 
+class GELS_MIXED : public ::TestWithParam<gels_tuple>
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_EQ(hipGetLastError(), hipSuccess);
+    }
+
+    template <bool BATCHED, bool STRIDED, typename T>
+    void run_tests()
+    {
+        Arguments arg = gels_setup_arguments(GetParam(), true);
+
+        // the mixed precision solvers only support the non-transposed problem
+        if(arg.get<char>("trans") != 'N')
+            return;
+
+        if(arg.peek<rocblas_int>("n") == 0 && arg.peek<rocblas_int>("nrhs") == 0)
+            testing_gels_mixed_bad_arg<BATCHED, STRIDED, T>();
+
+        arg.batch_count = (BATCHED || STRIDED ? 3 : 1);
+        if(arg.singular == 1)
+            testing_gels_mixed<BATCHED, STRIDED, T>(arg);
+
+        arg.singular = 0;
+        testing_gels_mixed<BATCHED, STRIDED, T>(arg);
+    }
+};
+
 // non-batch tests
 
 TEST_P(GELS, __float)
@@ -209,6 +239,16 @@ TEST_P(GELS_OUTOFPLACE, __double_complex)
     run_tests<false, false, rocblas_double_complex>();
 }
 
+TEST_P(GELS_MIXED, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(GELS_MIXED, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
 // batched tests
 
 TEST_P(GELS, batched__float)
@@ -231,6 +271,16 @@ TEST_P(GELS, batched__double_complex)
     run_tests<true, true, rocblas_double_complex>();
 }
 
+TEST_P(GELS_MIXED, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(GELS_MIXED, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
 // strided_batched tests
 
 TEST_P(GELS, strided_batched__float)
@@ -253,6 +303,16 @@ TEST_P(GELS, strided_batched__double_complex)
     run_tests<false, true, rocblas_double_complex>();
 }
 
+TEST_P(GELS_MIXED, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(GELS_MIXED, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
 INSTANTIATE_TEST_SUITE_P(daily_lapack,
                          GELS,
                          Combine(ValuesIn(large_matrix_sizeA_range),
@@ -270,3 +330,12 @@ INSTANTIATE_TEST_SUITE_P(daily_lapack,
 INSTANTIATE_TEST_SUITE_P(checkin_lapack,
                          GELS_OUTOFPLACE,
                          Combine(ValuesIn(matrix_sizeA_range), ValuesIn(matrix_sizeB_range)));
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         GELS_MIXED,
+                         Combine(ValuesIn(large_matrix_sizeA_range),
+                                 ValuesIn(large_matrix_sizeB_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GELS_MIXED,
+                         Combine(ValuesIn(matrix_sizeA_range), ValuesIn(matrix_sizeB_range)));
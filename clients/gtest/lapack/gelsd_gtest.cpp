@@ -0,0 +1,204 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "common/lapack/testing_gelsd.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, int> gelsd_tuple;
+
+// each matrix_size_range vector is a {M, N, lda, ldb, singular};
+// if singular = 1, then some of the matrices used for the tests are rank deficient
+
+// each nrhs_range is the number of right-hand sides
+
+// case when N = nrhs = 0 will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+// for checkin_lapack tests
+const vector<vector<int>> matrix_size_range = {
+    // quick return
+    {0, 0, 0, 0, 0},
+    // invalid
+    {-1, 1, 1, 1, 0},
+    {1, -1, 1, 1, 0},
+    {10, 10, 10, 1, 0},
+    {10, 10, 1, 10, 0},
+    // normal (valid) samples
+    {20, 20, 20, 20, 1},
+    {30, 20, 40, 30, 0},
+    {20, 30, 30, 40, 0},
+    {40, 20, 40, 40, 1},
+    {20, 40, 40, 40, 1},
+};
+
+const vector<int> nrhs_range = {
+    // only the singular values are computed
+    0,
+    // invalid
+    -1,
+    // normal (valid) samples
+    1,
+    10,
+    30,
+};
+
+// for daily_lapack tests
+const vector<vector<int>> large_matrix_size_range = {
+    {75, 25, 75, 75, 1},    {25, 75, 75, 75, 1},    {150, 150, 150, 150, 1},
+    {500, 50, 600, 600, 0}, {50, 500, 600, 600, 0},
+};
+
+const vector<int> large_nrhs_range = {100, 500};
+
+Arguments gelsd_setup_arguments(gelsd_tuple tup)
+{
+    vector<int> matrix_size = std::get<0>(tup);
+    int nrhs = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.set<rocblas_int>("m", matrix_size[0]);
+    arg.set<rocblas_int>("n", matrix_size[1]);
+    arg.set<rocblas_int>("lda", matrix_size[2]);
+    arg.set<rocblas_int>("ldb", matrix_size[3]);
+    arg.set<rocblas_int>("nrhs", nrhs);
+
+    // use a threshold that clearly separates the zero singular values
+    // from the rest for the rank deficient test matrices
+    arg.set<double>("rcond", 1e-3);
+
+    // only testing standard use case/defaults for strides
+
+    arg.timing = 0;
+    arg.singular = matrix_size[4];
+
+    return arg;
+}
+
+class GELSD : public ::TestWithParam<gelsd_tuple>
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_EQ(hipGetLastError(), hipSuccess);
+    }
+
+    template <bool BATCHED, bool STRIDED, typename T>
+    void run_tests()
+    {
+        Arguments arg = gelsd_setup_arguments(GetParam());
+
+        if(arg.peek<rocblas_int>("n") == 0 && arg.peek<rocblas_int>("nrhs") == 0)
+            testing_gelsd_bad_arg<BATCHED, STRIDED, T>();
+
+        arg.batch_count = (BATCHED || STRIDED ? 3 : 1);
+        if(arg.singular == 1)
+            testing_gelsd<BATCHED, STRIDED, T>(arg);
+
+        arg.singular = 0;
+        testing_gelsd<BATCHED, STRIDED, T>(arg);
+    }
+};
+
+// non-batch tests
+
+TEST_P(GELSD, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(GELSD, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(GELSD, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(GELSD, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+// batched tests
+
+TEST_P(GELSD, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(GELSD, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(GELSD, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(GELSD, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
+// strided_batched tests
+
+TEST_P(GELSD, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(GELSD, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(GELSD, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(GELSD, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         GELSD,
+                         Combine(ValuesIn(large_matrix_size_range), ValuesIn(large_nrhs_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GELSD,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(nrhs_range)));
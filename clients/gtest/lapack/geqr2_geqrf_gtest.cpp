@@ -26,6 +26,7 @@
  * *************************************************************************/
 
 #include "common/lapack/testing_geqr2_geqrf.hpp"
+#include "common/lapack/testing_geqrf_vbatched.hpp"
 
 using ::testing::Combine;
 using ::testing::TestWithParam;
@@ -51,7 +52,8 @@ const vector<vector<int>> matrix_size_range = {
     {50, 50},
     {70, 100},
     {130, 130},
-    {150, 200}};
+    {150, 200},
+    {256, 256}};
 
 const vector<int> n_size_range = {
     // quick return
@@ -66,6 +68,8 @@ const vector<vector<int>> large_matrix_size_range = {
     {152, 152},
     {640, 640},
     {1000, 1024},
+    // (size using recursive panel factorizations in geqrf)
+    {4200, 4200},
 };
 
 const vector<int> large_n_size_range = {64, 98, 130, 220, 400};
@@ -110,6 +114,27 @@ protected:
     }
 };
 
+class GEQRF_VBATCHED : public ::TestWithParam<geqrf_tuple>
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_EQ(hipGetLastError(), hipSuccess);
+    }
+
+    template <typename T>
+    void run_tests()
+    {
+        Arguments arg = geqrf_setup_arguments(GetParam());
+
+        if(arg.peek<rocblas_int>("m") == 0 && arg.peek<rocblas_int>("n") == 0)
+            testing_geqrf_vbatched_bad_arg<T>();
+
+        arg.batch_count = 5;
+        testing_geqrf_vbatched<T>(arg);
+    }
+};
+
 class GEQR2 : public GEQR2_GEQRF<false>
 {
 };
@@ -266,6 +291,28 @@ TEST_P(GEQRF, ptr_batched__double_complex)
     run_tests<true, false, rocblas_double_complex>();
 }
 
+// variable-size batched tests
+
+TEST_P(GEQRF_VBATCHED, vbatched__float)
+{
+    run_tests<float>();
+}
+
+TEST_P(GEQRF_VBATCHED, vbatched__double)
+{
+    run_tests<double>();
+}
+
+TEST_P(GEQRF_VBATCHED, vbatched__float_complex)
+{
+    run_tests<rocblas_float_complex>();
+}
+
+TEST_P(GEQRF_VBATCHED, vbatched__double_complex)
+{
+    run_tests<rocblas_double_complex>();
+}
+
 INSTANTIATE_TEST_SUITE_P(daily_lapack,
                          GEQR2,
                          Combine(ValuesIn(large_matrix_size_range), ValuesIn(large_n_size_range)));
@@ -281,3 +328,11 @@ INSTANTIATE_TEST_SUITE_P(daily_lapack,
 INSTANTIATE_TEST_SUITE_P(checkin_lapack,
                          GEQRF,
                          Combine(ValuesIn(matrix_size_range), ValuesIn(n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         GEQRF_VBATCHED,
+                         Combine(ValuesIn(large_matrix_size_range), ValuesIn(large_n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GEQRF_VBATCHED,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(n_size_range)));
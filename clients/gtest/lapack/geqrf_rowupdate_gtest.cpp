@@ -0,0 +1,207 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "common/lapack/testing_geqrf_rowupdate.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, vector<int>> geqrf_rowupdate_tuple;
+
+// each matrix_size_range vector is a {n, lda, singular}
+// if singular = 1, then the rows removed by the downdate leave a rank deficient matrix
+
+// each update_size_range vector is a {k, ldw}
+
+// case when n = 0 and k = 1 will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+// for checkin_lapack tests
+const vector<vector<int>> matrix_size_range = {
+    // quick return
+    {0, 1, 0},
+    // invalid
+    {-1, 1, 0},
+    {10, 5, 0},
+    // normal (valid) samples
+    {1, 1, 0},
+    {20, 20, 1},
+    {50, 60, 0},
+    {100, 100, 1}};
+
+const vector<vector<int>> update_size_range = {
+    // quick return
+    {0, 1},
+    // invalid
+    {-1, 1},
+    {5, 3},
+    // normal (valid) samples
+    {1, 1},
+    {3, 5},
+    {16, 16}};
+
+// for daily_lapack tests
+const vector<vector<int>> large_matrix_size_range = {
+    {192, 192, 0},
+    {500, 510, 1},
+    {1000, 1000, 0},
+};
+
+const vector<vector<int>> large_update_size_range = {
+    {1, 1},
+    {8, 10},
+    {64, 64},
+};
+
+Arguments geqrf_rowupdate_setup_arguments(geqrf_rowupdate_tuple tup)
+{
+    vector<int> matrix_size = std::get<0>(tup);
+    vector<int> update_size = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.set<rocblas_int>("n", matrix_size[0]);
+    arg.set<rocblas_int>("lda", matrix_size[1]);
+    arg.set<rocblas_int>("k", update_size[0]);
+    arg.set<rocblas_int>("ldw", update_size[1]);
+
+    // only testing standard use case/defaults for strides
+
+    arg.timing = 0;
+    arg.singular = matrix_size[2];
+
+    return arg;
+}
+
+class GEQRF_ROWUPDATE : public ::TestWithParam<geqrf_rowupdate_tuple>
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_EQ(hipGetLastError(), hipSuccess);
+    }
+
+    template <bool BATCHED, bool STRIDED, typename T>
+    void run_tests()
+    {
+        Arguments arg = geqrf_rowupdate_setup_arguments(GetParam());
+
+        if(arg.peek<rocblas_int>("n") == 0 && arg.peek<rocblas_int>("k") == 1)
+        {
+            testing_geqrf_rowupdate_bad_arg<BATCHED, STRIDED, false, T>();
+            testing_geqrf_rowupdate_bad_arg<BATCHED, STRIDED, true, T>();
+        }
+
+        arg.batch_count = (BATCHED || STRIDED ? 3 : 1);
+
+        // the singular cases only apply to the downdate
+        if(arg.singular == 1)
+            testing_geqrf_rowupdate<BATCHED, STRIDED, true, T>(arg);
+
+        arg.singular = 0;
+        testing_geqrf_rowupdate<BATCHED, STRIDED, false, T>(arg);
+        testing_geqrf_rowupdate<BATCHED, STRIDED, true, T>(arg);
+    }
+};
+
+// non-batch tests
+
+TEST_P(GEQRF_ROWUPDATE, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(GEQRF_ROWUPDATE, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(GEQRF_ROWUPDATE, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(GEQRF_ROWUPDATE, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+// batched tests
+
+TEST_P(GEQRF_ROWUPDATE, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(GEQRF_ROWUPDATE, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(GEQRF_ROWUPDATE, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(GEQRF_ROWUPDATE, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
+// strided_batched tests
+
+TEST_P(GEQRF_ROWUPDATE, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(GEQRF_ROWUPDATE, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(GEQRF_ROWUPDATE, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(GEQRF_ROWUPDATE, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         GEQRF_ROWUPDATE,
+                         Combine(ValuesIn(large_matrix_size_range),
+                                 ValuesIn(large_update_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GEQRF_ROWUPDATE,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(update_size_range)));
@@ -26,7 +26,9 @@
  * *************************************************************************/
 
 #include "common/lapack/testing_gesv.hpp"
+#include "common/lapack/testing_gesv_mixed.hpp"
 #include "common/lapack/testing_gesv_outofplace.hpp"
+#include "common/lapack/testing_gesv_rbt.hpp"
 
 using ::testing::Combine;
 using ::testing::TestWithParam;
@@ -53,8 +55,11 @@ const vector<vector<int>> matrix_sizeA_range = {
     {10, 2, 10, 0},
     {10, 10, 2, 0},
     /// normal (valid) samples
+    {5, 5, 5, 0},
+    {7, 10, 7, 1},
     {20, 20, 20, 0},
     {30, 50, 30, 1},
+    {32, 32, 40, 0},
     {30, 30, 50, 0},
     {50, 60, 60, 1}};
 const vector<int> matrix_sizeB_range = {
@@ -151,6 +156,64 @@ protected:
     }
 };
 
+class GESV_MIXED : public ::TestWithParam<gesv_tuple>
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_EQ(hipGetLastError(), hipSuccess);
+    }
+
+    template <bool BATCHED, bool STRIDED, typename T>
+    void run_tests()
+    {
+        Arguments arg = gesv_setup_arguments(GetParam(), true);
+
+        if(arg.peek<rocblas_int>("n") == 0 && arg.peek<rocblas_int>("nrhs") == 0)
+            testing_gesv_mixed_bad_arg<BATCHED, STRIDED, T>();
+
+        arg.batch_count = (BATCHED || STRIDED ? 3 : 1);
+        if(arg.singular == 1)
+            testing_gesv_mixed<BATCHED, STRIDED, T>(arg);
+
+        // mixed batch where only some of the problems fall back to full precision
+        // (with 5 problems, only the 2nd, 3rd and 5th matrices are singular)
+        if(arg.singular == 1 && (BATCHED || STRIDED))
+        {
+            arg.batch_count = 5;
+            testing_gesv_mixed<BATCHED, STRIDED, T>(arg);
+            arg.batch_count = 3;
+        }
+
+        arg.singular = 0;
+        testing_gesv_mixed<BATCHED, STRIDED, T>(arg);
+    }
+};
+
+class GESV_RBT : public ::TestWithParam<gesv_tuple>
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_EQ(hipGetLastError(), hipSuccess);
+    }
+
+    template <bool BATCHED, bool STRIDED, typename T>
+    void run_tests()
+    {
+        Arguments arg = gesv_setup_arguments(GetParam(), false);
+
+        if(arg.peek<rocblas_int>("n") == 0 && arg.peek<rocblas_int>("nrhs") == 0)
+            testing_gesv_rbt_bad_arg<BATCHED, STRIDED, T>();
+
+        // without pivoting, singular matrices are not reliably detected after the
+        // random butterfly transforms; only the nonsingular cases are tested
+        arg.batch_count = (BATCHED || STRIDED ? 3 : 1);
+        arg.singular = 0;
+        testing_gesv_rbt<BATCHED, STRIDED, T>(arg);
+    }
+};
+
 // non-batch tests
 
 TEST_P(GESV, __float)
@@ -193,6 +256,36 @@ TEST_P(GESV_OUTOFPLACE, __double_complex)
     run_tests<false, false, rocblas_double_complex>();
 }
 
+TEST_P(GESV_MIXED, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(GESV_MIXED, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+TEST_P(GESV_RBT, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(GESV_RBT, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(GESV_RBT, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(GESV_RBT, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
 // batched tests
 
 TEST_P(GESV, batched__float)
@@ -215,6 +308,36 @@ TEST_P(GESV, batched__double_complex)
     run_tests<true, true, rocblas_double_complex>();
 }
 
+TEST_P(GESV_MIXED, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(GESV_MIXED, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
+TEST_P(GESV_RBT, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(GESV_RBT, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(GESV_RBT, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(GESV_RBT, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
 // strided_batched tests
 
 TEST_P(GESV, strided_batched__float)
@@ -237,6 +360,36 @@ TEST_P(GESV, strided_batched__double_complex)
     run_tests<false, true, rocblas_double_complex>();
 }
 
+TEST_P(GESV_MIXED, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(GESV_MIXED, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+TEST_P(GESV_RBT, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(GESV_RBT, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(GESV_RBT, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(GESV_RBT, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
 INSTANTIATE_TEST_SUITE_P(daily_lapack,
                          GESV,
                          Combine(ValuesIn(large_matrix_sizeA_range),
@@ -254,3 +407,21 @@ INSTANTIATE_TEST_SUITE_P(daily_lapack,
 INSTANTIATE_TEST_SUITE_P(checkin_lapack,
                          GESV_OUTOFPLACE,
                          Combine(ValuesIn(matrix_sizeA_range), ValuesIn(matrix_sizeB_range)));
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         GESV_MIXED,
+                         Combine(ValuesIn(large_matrix_sizeA_range),
+                                 ValuesIn(large_matrix_sizeB_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GESV_MIXED,
+                         Combine(ValuesIn(matrix_sizeA_range), ValuesIn(matrix_sizeB_range)));
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         GESV_RBT,
+                         Combine(ValuesIn(large_matrix_sizeA_range),
+                                 ValuesIn(large_matrix_sizeB_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GESV_RBT,
+                         Combine(ValuesIn(matrix_sizeA_range), ValuesIn(matrix_sizeB_range)));
@@ -35,9 +35,12 @@ using namespace std;
 
 typedef std::tuple<vector<int>, vector<int>> gesvd_tuple;
 
-// each size_range vector is a {m, n, fa};
+// each size_range vector is a {m, n, fa, [alg]};
 // if fa = 0 then no fast algorithm is allowed
 // if fa = 1 fast algorithm is used when possible
+// if alg = 1 then divide and conquer is used for the bidiagonal SVD
+// if alg = 2 then hybrid CPU+GPU QR iteration is used for the bidiagonal SVD
+// (QR iteration otherwise)
 
 // each opt_range vector is a {lda, ldu, ldv, leftsv, rightsv};
 // if ldx = -1 then ldx < limit (invalid size)
@@ -68,7 +71,15 @@ const vector<vector<int>> size_range = {
     {60, 30, 1},
     {30, 40, 0},
     {30, 60, 0},
-    {30, 60, 1}};
+    {30, 60, 1},
+    // divide and conquer samples
+    {20, 20, 0, 1},
+    {60, 30, 1, 1},
+    {30, 40, 0, 1},
+    {30, 60, 1, 1},
+    // hybrid samples
+    {60, 30, 1, 2},
+    {30, 60, 0, 2}};
 
 const vector<vector<int>> opt_range = {
     // invalid
@@ -95,7 +106,8 @@ const vector<vector<int>> opt_range = {
 
 // for daily_lapack tests
 const vector<vector<int>> large_size_range
-    = {{120, 100, 0}, {300, 120, 0}, {300, 120, 1}, {100, 120, 1}, {120, 300, 0}, {120, 300, 1}};
+    = {{120, 100, 0},    {300, 120, 0},    {300, 120, 1},    {100, 120, 1},    {120, 300, 0},
+       {120, 300, 1},    {120, 100, 0, 1}, {300, 120, 1, 1}, {100, 120, 0, 1}, {120, 300, 1, 1}};
 
 const vector<vector<int>> large_opt_range
     = {{0, 0, 0, 3, 3}, {1, 0, 0, 0, 1}, {0, 1, 0, 1, 0}, {0, 0, 1, 1, 1},
@@ -120,6 +132,12 @@ Arguments gesvd_setup_arguments(gesvd_tuple tup)
     else
         arg.set<char>("fast_alg", 'O');
 
+    // algorithm for the bidiagonal SVD
+    if(size.size() > 3 && size[3] == 1)
+        arg.set<char>("alg_mode", 'D');
+    else if(size.size() > 3 && size[3] == 2)
+        arg.set<char>("alg_mode", 'H');
+
     // leading dimensions
     arg.set<rocblas_int>("lda", m + opt[0] * 10);
     arg.set<rocblas_int>("ldu", m + opt[1] * 10);
@@ -36,7 +36,9 @@ using namespace std;
 
 typedef std::tuple<vector<int>, vector<int>> gesvdj_tuple;
 
-// each size_range vector is a {m, n};
+// each size_range vector is a {m, n, precond};
+// if precond = 1 then the QR preconditioning is selected (rocsolver_alg_mode_qr_precond)
+// if precond = 2 then the mixed-precision algorithm is selected (rocsolver_alg_mode_mixed)
 
 // each opt_range vector is a {lda, ldu, ldv, leftsv, rightsv};
 // if ldx = -1 then ldx < limit (invalid size)
@@ -60,11 +62,20 @@ const vector<vector<int>> size_range = {
     {1, -1},
     // normal (valid) samples
     {1, 1},
+    {3, 2},
     {20, 20},
+    {32, 17},
+    {17, 32},
     {40, 30},
     {60, 30},
     {30, 40},
     {30, 60},
+    // QR preconditioning
+    {40, 30, 1},
+    {60, 30, 1},
+    // mixed precision
+    {60, 30, 2},
+    {30, 60, 2},
 };
 
 const vector<vector<int>> opt_range = {
@@ -85,7 +96,8 @@ const vector<vector<int>> opt_range = {
 };
 
 // for daily_lapack tests
-const vector<vector<int>> large_size_range = {{120, 100}, {300, 120}, {100, 120}, {120, 300}};
+const vector<vector<int>> large_size_range
+    = {{120, 100}, {300, 120}, {100, 120}, {120, 300}, {300, 120, 1}, {1000, 60, 1}};
 
 const vector<vector<int>> large_opt_range
     = {{0, 0, 0, 0, 0}, {1, 0, 0, 1, 1}, {0, 1, 0, 2, 0}, {0, 0, 1, 0, 2}};
@@ -103,6 +115,12 @@ Arguments gesvdj_setup_arguments(gesvdj_tuple tup, bool notransv)
     arg.set<rocblas_int>("m", m);
     arg.set<rocblas_int>("n", n);
 
+    // preconditioning or mixed precision
+    if(size.size() > 2 && size[2] == 1)
+        arg.set<char>("alg_mode", 'R');
+    else if(size.size() > 2 && size[2] == 2)
+        arg.set<char>("alg_mode", 'M');
+
     // leading dimensions
     arg.set<rocblas_int>("lda", m + opt[0] * 10);
     arg.set<rocblas_int>("ldu", m + opt[1] * 10);
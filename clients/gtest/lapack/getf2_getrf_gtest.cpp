@@ -27,6 +27,9 @@
 
 #include "common/lapack/testing_getf2_getrf.hpp"
 #include "common/lapack/testing_getf2_getrf_npvt.hpp"
+#include "common/lapack/testing_getrf_interleaved.hpp"
+#include "common/lapack/testing_getrf_lowprec.hpp"
+#include "common/lapack/testing_getrf_vbatched.hpp"
 
 using ::testing::Combine;
 using ::testing::TestWithParam;
@@ -71,13 +74,17 @@ const vector<vector<int>> large_matrix_size_range = {
     {192, 192, 0},
     {640, 640, 1},
     {1000, 1024, 0},
+    // (sizes using look-ahead and recursive panel factorizations in getrf)
+    {1536, 1600, 1},
+    // (tall panels factorized by the cooperative getf2 kernel)
+    {5000, 5000, 1},
 };
 
 const vector<int> large_n_size_range = {
     45, 64, 520, 1024, 2000,
 };
 
-Arguments getrf_setup_arguments(getrf_tuple tup)
+Arguments getrf_setup_arguments(getrf_tuple tup, bool interleaved)
 {
     vector<int> matrix_size = std::get<0>(tup);
     int n_size = std::get<1>(tup);
@@ -86,9 +93,22 @@ Arguments getrf_setup_arguments(getrf_tuple tup)
 
     arg.set<rocblas_int>("m", matrix_size[0]);
     arg.set<rocblas_int>("n", n_size);
-    arg.set<rocblas_int>("lda", matrix_size[1]);
 
-    // only testing standard use case/defaults for strides
+    if(!interleaved)
+    {
+        arg.set<rocblas_int>("lda", matrix_size[1]);
+
+        // only testing standard use case/defaults for strides
+    }
+    else
+    {
+        // normal use case is covered by non-interleaved tests
+        rocblas_int bc = 3;
+
+        arg.set<rocblas_int>("inca", bc);
+        arg.set<rocblas_int>("lda", bc * matrix_size[1]);
+        arg.set<rocblas_stride>("strideA", 1);
+    }
 
     arg.timing = 0;
     arg.singular = matrix_size[2];
@@ -108,7 +128,7 @@ protected:
     template <bool BATCHED, bool STRIDED, typename T>
     void run_tests()
     {
-        Arguments arg = getrf_setup_arguments(GetParam());
+        Arguments arg = getrf_setup_arguments(GetParam(), false);
 
         if(arg.peek<rocblas_int>("m") == 0 && arg.peek<rocblas_int>("n") == 0)
             testing_getf2_getrf_bad_arg<BATCHED, STRIDED, BLOCKED, T, I>();
@@ -134,7 +154,7 @@ protected:
     template <bool BATCHED, bool STRIDED, typename T>
     void run_tests()
     {
-        Arguments arg = getrf_setup_arguments(GetParam());
+        Arguments arg = getrf_setup_arguments(GetParam(), false);
 
         if(arg.peek<rocblas_int>("m") == 0 && arg.peek<rocblas_int>("n") == 0)
             testing_getf2_getrf_npvt_bad_arg<BATCHED, STRIDED, BLOCKED, T, I>();
@@ -148,6 +168,83 @@ protected:
     }
 };
 
+template <bool NPVT>
+class GETRF_INTERLEAVED_BASE : public ::TestWithParam<getrf_tuple>
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_EQ(hipGetLastError(), hipSuccess);
+    }
+
+    template <typename T>
+    void run_tests()
+    {
+        Arguments arg = getrf_setup_arguments(GetParam(), true);
+
+        if(arg.peek<rocblas_int>("m") == 0 && arg.peek<rocblas_int>("n") == 0)
+            testing_getrf_interleaved_bad_arg<NPVT, T>();
+
+        arg.batch_count = 3;
+        if(arg.singular == 1)
+            testing_getrf_interleaved<NPVT, T>(arg);
+
+        arg.singular = 0;
+        testing_getrf_interleaved<NPVT, T>(arg);
+    }
+};
+
+template <bool NPVT>
+class GETRF_LOWPREC_BASE : public ::TestWithParam<getrf_tuple>
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_EQ(hipGetLastError(), hipSuccess);
+    }
+
+    template <typename T>
+    void run_tests()
+    {
+        Arguments arg = getrf_setup_arguments(GetParam(), false);
+
+        if(arg.peek<rocblas_int>("m") == 0 && arg.peek<rocblas_int>("n") == 0)
+            testing_getrf_lowprec_bad_arg<NPVT, T>();
+
+        arg.batch_count = 3;
+        if(arg.singular == 1)
+            testing_getrf_lowprec<NPVT, T>(arg);
+
+        arg.singular = 0;
+        testing_getrf_lowprec<NPVT, T>(arg);
+    }
+};
+
+class GETRF_VBATCHED : public ::TestWithParam<getrf_tuple>
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_EQ(hipGetLastError(), hipSuccess);
+    }
+
+    template <typename T>
+    void run_tests()
+    {
+        Arguments arg = getrf_setup_arguments(GetParam(), false);
+
+        if(arg.peek<rocblas_int>("m") == 0 && arg.peek<rocblas_int>("n") == 0)
+            testing_getrf_vbatched_bad_arg<T>();
+
+        arg.batch_count = 5;
+        if(arg.singular == 1)
+            testing_getrf_vbatched<T>(arg);
+
+        arg.singular = 0;
+        testing_getrf_vbatched<T>(arg);
+    }
+};
+
 class GETF2 : public GETF2_GETRF<false, rocblas_int>
 {
 };
@@ -180,6 +277,22 @@ class GETRF_NPVT_64 : public GETF2_GETRF_NPVT<true, int64_t>
 {
 };
 
+class GETRF_INTERLEAVED : public GETRF_INTERLEAVED_BASE<false>
+{
+};
+
+class GETRF_NPVT_INTERLEAVED : public GETRF_INTERLEAVED_BASE<true>
+{
+};
+
+class GETRF_LOWPREC : public GETRF_LOWPREC_BASE<false>
+{
+};
+
+class GETRF_NPVT_LOWPREC : public GETRF_LOWPREC_BASE<true>
+{
+};
+
 // non-batch tests
 TEST_P(GETF2_NPVT, __float)
 {
@@ -663,6 +776,89 @@ TEST_P(GETRF_64, strided_batched__double_complex)
     run_tests<false, true, rocblas_double_complex>();
 }
 
+// interleaved_batched tests
+TEST_P(GETRF_NPVT_INTERLEAVED, interleaved_batched__float)
+{
+    run_tests<float>();
+}
+
+TEST_P(GETRF_NPVT_INTERLEAVED, interleaved_batched__double)
+{
+    run_tests<double>();
+}
+
+TEST_P(GETRF_NPVT_INTERLEAVED, interleaved_batched__float_complex)
+{
+    run_tests<rocblas_float_complex>();
+}
+
+TEST_P(GETRF_NPVT_INTERLEAVED, interleaved_batched__double_complex)
+{
+    run_tests<rocblas_double_complex>();
+}
+
+TEST_P(GETRF_INTERLEAVED, interleaved_batched__float)
+{
+    run_tests<float>();
+}
+
+TEST_P(GETRF_INTERLEAVED, interleaved_batched__double)
+{
+    run_tests<double>();
+}
+
+TEST_P(GETRF_INTERLEAVED, interleaved_batched__float_complex)
+{
+    run_tests<rocblas_float_complex>();
+}
+
+TEST_P(GETRF_INTERLEAVED, interleaved_batched__double_complex)
+{
+    run_tests<rocblas_double_complex>();
+}
+
+// variable-size batched tests
+TEST_P(GETRF_VBATCHED, vbatched__float)
+{
+    run_tests<float>();
+}
+
+TEST_P(GETRF_VBATCHED, vbatched__double)
+{
+    run_tests<double>();
+}
+
+TEST_P(GETRF_VBATCHED, vbatched__float_complex)
+{
+    run_tests<rocblas_float_complex>();
+}
+
+TEST_P(GETRF_VBATCHED, vbatched__double_complex)
+{
+    run_tests<rocblas_double_complex>();
+}
+
+// half and bfloat16 storage tests
+TEST_P(GETRF_NPVT_LOWPREC, strided_batched__half)
+{
+    run_tests<rocblas_half>();
+}
+
+TEST_P(GETRF_NPVT_LOWPREC, strided_batched__bfloat16)
+{
+    run_tests<rocblas_bfloat16>();
+}
+
+TEST_P(GETRF_LOWPREC, strided_batched__half)
+{
+    run_tests<rocblas_half>();
+}
+
+TEST_P(GETRF_LOWPREC, strided_batched__bfloat16)
+{
+    run_tests<rocblas_bfloat16>();
+}
+
 INSTANTIATE_TEST_SUITE_P(daily_lapack,
                          GETF2_NPVT,
                          Combine(ValuesIn(large_matrix_size_range), ValuesIn(large_n_size_range)));
@@ -726,3 +922,36 @@ INSTANTIATE_TEST_SUITE_P(daily_lapack,
 INSTANTIATE_TEST_SUITE_P(checkin_lapack,
                          GETRF_64,
                          Combine(ValuesIn(matrix_size_range), ValuesIn(n_size_range)));
+
+// (interleaved variants use one thread per matrix and are only meant for small sizes)
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GETRF_NPVT_INTERLEAVED,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GETRF_INTERLEAVED,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         GETRF_NPVT_LOWPREC,
+                         Combine(ValuesIn(large_matrix_size_range), ValuesIn(large_n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GETRF_NPVT_LOWPREC,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         GETRF_LOWPREC,
+                         Combine(ValuesIn(large_matrix_size_range), ValuesIn(large_n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GETRF_LOWPREC,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         GETRF_VBATCHED,
+                         Combine(ValuesIn(large_matrix_size_range), ValuesIn(large_n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GETRF_VBATCHED,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(n_size_range)));
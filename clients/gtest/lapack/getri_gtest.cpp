@@ -58,8 +58,10 @@ const vector<vector<int>> matrix_size_range = {
     {100, 150, 1}};
 
 // for daily_lapack tests
-const vector<vector<int>> large_matrix_size_range
-    = {{192, 192, 1}, {500, 600, 1}, {640, 640, 0}, {1000, 1024, 0}, {1200, 1230, 0}};
+const vector<vector<int>> large_matrix_size_range = {
+    {192, 192, 1}, {256, 260, 0},   {300, 300, 0},   {500, 600, 1},
+    {640, 640, 0}, {1000, 1024, 0}, {1200, 1230, 0},
+};
 
 Arguments getri_setup_arguments(getri_tuple tup, bool outofplace)
 {
@@ -26,6 +26,9 @@
  * *************************************************************************/
 
 #include "common/lapack/testing_getrs.hpp"
+#include "common/lapack/testing_getrs_interleaved.hpp"
+#include "common/lapack/testing_getrs_lowprec.hpp"
+#include "common/lapack/testing_getrs_vbatched.hpp"
 
 using ::testing::Combine;
 using ::testing::TestWithParam;
@@ -76,7 +79,7 @@ const vector<vector<int>> large_matrix_sizeB_range = {
     {100, 0}, {150, 0}, {200, 1}, {524, 2}, {1000, 2},
 };
 
-Arguments getrs_setup_arguments(getrs_tuple tup)
+Arguments getrs_setup_arguments(getrs_tuple tup, bool interleaved)
 {
     vector<int> matrix_sizeA = std::get<0>(tup);
     vector<int> matrix_sizeB = std::get<1>(tup);
@@ -85,8 +88,25 @@ Arguments getrs_setup_arguments(getrs_tuple tup)
 
     arg.set<rocblas_int>("n", matrix_sizeA[0]);
     arg.set<rocblas_int>("nrhs", matrix_sizeB[0]);
-    arg.set<rocblas_int>("lda", matrix_sizeA[1]);
-    arg.set<rocblas_int>("ldb", matrix_sizeA[2]);
+    if(!interleaved)
+    {
+        arg.set<rocblas_int>("lda", matrix_sizeA[1]);
+        arg.set<rocblas_int>("ldb", matrix_sizeA[2]);
+
+        // only testing standard use case/defaults for strides
+    }
+    else
+    {
+        // normal use case is covered by non-interleaved tests
+        rocblas_int bc = 3;
+
+        arg.set<rocblas_int>("inca", bc);
+        arg.set<rocblas_int>("incb", bc);
+        arg.set<rocblas_int>("lda", bc * matrix_sizeA[1]);
+        arg.set<rocblas_int>("ldb", bc * matrix_sizeA[2]);
+        arg.set<rocblas_stride>("strideA", 1);
+        arg.set<rocblas_stride>("strideB", 1);
+    }
 
     if(matrix_sizeB[1] == 0)
         arg.set<char>("trans", 'N');
@@ -95,8 +115,6 @@ Arguments getrs_setup_arguments(getrs_tuple tup)
     else
         arg.set<char>("trans", 'C');
 
-    // only testing standard use case/defaults for strides
-
     arg.timing = 0;
 
     return arg;
@@ -114,7 +132,7 @@ protected:
     template <bool BATCHED, bool STRIDED, typename T>
     void run_tests()
     {
-        Arguments arg = getrs_setup_arguments(GetParam());
+        Arguments arg = getrs_setup_arguments(GetParam(), false);
 
         if(arg.peek<rocblas_int>("n") == 0 && arg.peek<rocblas_int>("nrhs") == 0)
             testing_getrs_bad_arg<BATCHED, STRIDED, T, I>();
@@ -124,6 +142,69 @@ protected:
     }
 };
 
+class GETRS_INTERLEAVED : public ::TestWithParam<getrs_tuple>
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_EQ(hipGetLastError(), hipSuccess);
+    }
+
+    template <typename T>
+    void run_tests()
+    {
+        Arguments arg = getrs_setup_arguments(GetParam(), true);
+
+        if(arg.peek<rocblas_int>("n") == 0 && arg.peek<rocblas_int>("nrhs") == 0)
+            testing_getrs_interleaved_bad_arg<T>();
+
+        arg.batch_count = 3;
+        testing_getrs_interleaved<T>(arg);
+    }
+};
+
+class GETRS_VBATCHED : public ::TestWithParam<getrs_tuple>
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_EQ(hipGetLastError(), hipSuccess);
+    }
+
+    template <typename T>
+    void run_tests()
+    {
+        Arguments arg = getrs_setup_arguments(GetParam(), false);
+
+        if(arg.peek<rocblas_int>("n") == 0 && arg.peek<rocblas_int>("nrhs") == 0)
+            testing_getrs_vbatched_bad_arg<T>();
+
+        arg.batch_count = 5;
+        testing_getrs_vbatched<T>(arg);
+    }
+};
+
+class GETRS_LOWPREC : public ::TestWithParam<getrs_tuple>
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_EQ(hipGetLastError(), hipSuccess);
+    }
+
+    template <typename T>
+    void run_tests()
+    {
+        Arguments arg = getrs_setup_arguments(GetParam(), false);
+
+        if(arg.peek<rocblas_int>("n") == 0 && arg.peek<rocblas_int>("nrhs") == 0)
+            testing_getrs_lowprec_bad_arg<T>();
+
+        arg.batch_count = 3;
+        testing_getrs_lowprec<T>(arg);
+    }
+};
+
 class GETRS : public GETRS_BASE<rocblas_int>
 {
 };
@@ -258,6 +339,62 @@ TEST_P(GETRS_64, strided_batched__double_complex)
     run_tests<false, true, rocblas_double_complex>();
 }
 
+// interleaved_batched tests
+
+TEST_P(GETRS_INTERLEAVED, interleaved_batched__float)
+{
+    run_tests<float>();
+}
+
+TEST_P(GETRS_INTERLEAVED, interleaved_batched__double)
+{
+    run_tests<double>();
+}
+
+TEST_P(GETRS_INTERLEAVED, interleaved_batched__float_complex)
+{
+    run_tests<rocblas_float_complex>();
+}
+
+TEST_P(GETRS_INTERLEAVED, interleaved_batched__double_complex)
+{
+    run_tests<rocblas_double_complex>();
+}
+
+// variable-size batched tests
+
+TEST_P(GETRS_VBATCHED, vbatched__float)
+{
+    run_tests<float>();
+}
+
+TEST_P(GETRS_VBATCHED, vbatched__double)
+{
+    run_tests<double>();
+}
+
+TEST_P(GETRS_VBATCHED, vbatched__float_complex)
+{
+    run_tests<rocblas_float_complex>();
+}
+
+TEST_P(GETRS_VBATCHED, vbatched__double_complex)
+{
+    run_tests<rocblas_double_complex>();
+}
+
+// half and bfloat16 storage tests
+
+TEST_P(GETRS_LOWPREC, strided_batched__half)
+{
+    run_tests<rocblas_half>();
+}
+
+TEST_P(GETRS_LOWPREC, strided_batched__bfloat16)
+{
+    run_tests<rocblas_bfloat16>();
+}
+
 INSTANTIATE_TEST_SUITE_P(daily_lapack,
                          GETRS,
                          Combine(ValuesIn(large_matrix_sizeA_range),
@@ -275,3 +412,26 @@ INSTANTIATE_TEST_SUITE_P(daily_lapack,
 INSTANTIATE_TEST_SUITE_P(checkin_lapack,
                          GETRS_64,
                          Combine(ValuesIn(matrix_sizeA_range), ValuesIn(matrix_sizeB_range)));
+
+// (interleaved variants use one thread per problem and are only meant for small sizes)
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GETRS_INTERLEAVED,
+                         Combine(ValuesIn(matrix_sizeA_range), ValuesIn(matrix_sizeB_range)));
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         GETRS_LOWPREC,
+                         Combine(ValuesIn(large_matrix_sizeA_range),
+                                 ValuesIn(large_matrix_sizeB_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GETRS_LOWPREC,
+                         Combine(ValuesIn(matrix_sizeA_range), ValuesIn(matrix_sizeB_range)));
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         GETRS_VBATCHED,
+                         Combine(ValuesIn(large_matrix_sizeA_range),
+                                 ValuesIn(large_matrix_sizeB_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GETRS_VBATCHED,
+                         Combine(ValuesIn(matrix_sizeA_range), ValuesIn(matrix_sizeB_range)));
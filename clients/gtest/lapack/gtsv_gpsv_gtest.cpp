@@ -0,0 +1,210 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "common/lapack/testing_gpsv_npvt_interleaved.hpp"
+#include "common/lapack/testing_gtsv_npvt_interleaved.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, int> gtsv_tuple;
+
+// each matrix_size_range vector is a {n, nrhs, ldb, singular}
+// if singular = 1, then the used matrices for the tests have a zero pivot
+
+// each layout_range value is 0 for the strided batched layout or 1 for the interleaved layout
+
+// case when n = 0 and nrhs = 0 will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+const vector<int> layout_range = {0, 1};
+
+// for checkin_lapack tests
+const vector<vector<int>> matrix_size_range = {
+    // quick return
+    {0, 0, 1, 0},
+    {0, 1, 1, 0},
+    {1, 0, 1, 0},
+    // invalid
+    {-1, 1, 1, 0},
+    {1, -1, 1, 0},
+    {10, 1, 5, 0},
+    // normal (valid) samples
+    {1, 1, 1, 0},
+    {2, 3, 2, 0},
+    {3, 1, 3, 1},
+    {20, 5, 20, 1},
+    {64, 10, 70, 0},
+    {128, 1, 128, 1},
+};
+
+// for daily_lapack tests
+const vector<vector<int>> large_matrix_size_range = {
+    {500, 10, 500, 1},
+    {1000, 2, 1000, 0},
+    {2048, 1, 2050, 1},
+};
+
+Arguments gtsv_setup_arguments(gtsv_tuple tup)
+{
+    vector<int> matrix_size = std::get<0>(tup);
+    int interleaved = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.set<rocblas_int>("n", matrix_size[0]);
+    arg.set<rocblas_int>("nrhs", matrix_size[1]);
+
+    if(!interleaved)
+    {
+        arg.set<rocblas_int>("ldb", matrix_size[2]);
+
+        // only testing standard use case/defaults for strides
+    }
+    else
+    {
+        rocblas_int bc = 5;
+
+        arg.set<rocblas_int>("incd", bc);
+        arg.set<rocblas_int>("incb", bc);
+        arg.set<rocblas_int>("ldb", bc * matrix_size[2]);
+        arg.set<rocblas_stride>("strideD", 1);
+        arg.set<rocblas_stride>("strideB", 1);
+    }
+
+    arg.timing = 0;
+    arg.singular = matrix_size[3];
+
+    return arg;
+}
+
+template <bool PENTA>
+class GTSV_GPSV_NPVT_INTERLEAVED : public ::TestWithParam<gtsv_tuple>
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_EQ(hipGetLastError(), hipSuccess);
+    }
+
+    template <typename T>
+    void run_tests()
+    {
+        Arguments arg = gtsv_setup_arguments(GetParam());
+
+        if(arg.peek<rocblas_int>("n") == 0 && arg.peek<rocblas_int>("nrhs") == 0)
+        {
+            if(PENTA)
+                testing_gpsv_npvt_interleaved_bad_arg<T>();
+            else
+                testing_gtsv_npvt_interleaved_bad_arg<T>();
+        }
+
+        arg.batch_count = 5;
+        if(arg.singular == 1)
+        {
+            if(PENTA)
+                testing_gpsv_npvt_interleaved<T>(arg);
+            else
+                testing_gtsv_npvt_interleaved<T>(arg);
+        }
+
+        arg.singular = 0;
+        if(PENTA)
+            testing_gpsv_npvt_interleaved<T>(arg);
+        else
+            testing_gtsv_npvt_interleaved<T>(arg);
+    }
+};
+
+class GTSV_NPVT_INTERLEAVED : public GTSV_GPSV_NPVT_INTERLEAVED<false>
+{
+};
+
+class GPSV_NPVT_INTERLEAVED : public GTSV_GPSV_NPVT_INTERLEAVED<true>
+{
+};
+
+// interleaved_batched tests
+TEST_P(GTSV_NPVT_INTERLEAVED, interleaved_batched__float)
+{
+    run_tests<float>();
+}
+
+TEST_P(GTSV_NPVT_INTERLEAVED, interleaved_batched__double)
+{
+    run_tests<double>();
+}
+
+TEST_P(GTSV_NPVT_INTERLEAVED, interleaved_batched__float_complex)
+{
+    run_tests<rocblas_float_complex>();
+}
+
+TEST_P(GTSV_NPVT_INTERLEAVED, interleaved_batched__double_complex)
+{
+    run_tests<rocblas_double_complex>();
+}
+
+TEST_P(GPSV_NPVT_INTERLEAVED, interleaved_batched__float)
+{
+    run_tests<float>();
+}
+
+TEST_P(GPSV_NPVT_INTERLEAVED, interleaved_batched__double)
+{
+    run_tests<double>();
+}
+
+TEST_P(GPSV_NPVT_INTERLEAVED, interleaved_batched__float_complex)
+{
+    run_tests<rocblas_float_complex>();
+}
+
+TEST_P(GPSV_NPVT_INTERLEAVED, interleaved_batched__double_complex)
+{
+    run_tests<rocblas_double_complex>();
+}
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         GTSV_NPVT_INTERLEAVED,
+                         Combine(ValuesIn(large_matrix_size_range), ValuesIn(layout_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GTSV_NPVT_INTERLEAVED,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(layout_range)));
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         GPSV_NPVT_INTERLEAVED,
+                         Combine(ValuesIn(large_matrix_size_range), ValuesIn(layout_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GPSV_NPVT_INTERLEAVED,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(layout_range)));
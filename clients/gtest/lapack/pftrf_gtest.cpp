@@ -0,0 +1,193 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "common/lapack/testing_pftrf.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, printable_char, printable_char> pftrf_tuple;
+
+// each matrix_size_range vector is a {n, singular}
+// if singular = 1, then the used matrix for the tests is not positive definite
+
+// each transr_range is a {transr}
+// the combinations of transr and type that are not supported (transr = T for
+// complex types, or transr = C for real types) check the invalid value case
+
+// each uplo_range is a {uplo}
+
+// case when n = 0, transr = N and uplo = L will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+const vector<printable_char> transr_range = {'N', 'T', 'C'};
+const vector<printable_char> uplo_range = {'L', 'U'};
+
+// for checkin_lapack tests
+const vector<vector<int>> matrix_size_range = {
+    // quick return
+    {0, 0},
+    // invalid
+    {-1, 0},
+    // normal (valid) samples
+    {1, 0},
+    {2, 0},
+    {15, 1},
+    {20, 0},
+    {35, 1},
+    {50, 0}};
+
+// for daily_lapack tests
+const vector<vector<int>> large_matrix_size_range = {{191, 1}, {256, 0}, {601, 1}, {1000, 0}};
+
+Arguments pftrf_setup_arguments(pftrf_tuple tup)
+{
+    vector<int> matrix_size = std::get<0>(tup);
+    char transr = std::get<1>(tup);
+    char uplo = std::get<2>(tup);
+
+    Arguments arg;
+
+    arg.set<rocblas_int>("n", matrix_size[0]);
+
+    arg.set<char>("transr", transr);
+    arg.set<char>("uplo", uplo);
+
+    // only testing standard use case/defaults for strides
+
+    arg.timing = 0;
+    arg.singular = matrix_size[1];
+
+    return arg;
+}
+
+class PFTRF : public ::TestWithParam<pftrf_tuple>
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_EQ(hipGetLastError(), hipSuccess);
+    }
+
+    template <bool BATCHED, bool STRIDED, typename T>
+    void run_tests()
+    {
+        Arguments arg = pftrf_setup_arguments(GetParam());
+
+        if(arg.peek<rocblas_int>("n") == 0 && arg.peek<char>("transr") == 'N'
+           && arg.peek<char>("uplo") == 'L')
+            testing_pftrf_bad_arg<BATCHED, STRIDED, T>();
+
+        arg.batch_count = (BATCHED || STRIDED ? 3 : 1);
+        if(arg.singular == 1)
+            testing_pftrf<BATCHED, STRIDED, T>(arg);
+
+        arg.singular = 0;
+        testing_pftrf<BATCHED, STRIDED, T>(arg);
+    }
+};
+
+// non-batch tests
+
+TEST_P(PFTRF, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(PFTRF, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(PFTRF, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(PFTRF, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+// batched tests
+
+TEST_P(PFTRF, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(PFTRF, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(PFTRF, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(PFTRF, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
+// strided_batched tests
+
+TEST_P(PFTRF, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(PFTRF, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(PFTRF, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(PFTRF, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         PFTRF,
+                         Combine(ValuesIn(large_matrix_size_range),
+                                 ValuesIn(transr_range),
+                                 ValuesIn(uplo_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         PFTRF,
+                         Combine(ValuesIn(matrix_size_range),
+                                 ValuesIn(transr_range),
+                                 ValuesIn(uplo_range)));
@@ -26,6 +26,7 @@
  * *************************************************************************/
 
 #include "common/lapack/testing_posv.hpp"
+#include "common/lapack/testing_posv_mixed.hpp"
 
 using ::testing::Combine;
 using ::testing::TestWithParam;
@@ -57,7 +58,8 @@ const vector<vector<int>> matrix_sizeA_range = {
     {20, 20, 20, 0},
     {30, 50, 30, 1},
     {30, 30, 50, 0},
-    {50, 60, 60, 1}};
+    {50, 60, 60, 1},
+    {64, 64, 70, 0}};
 const vector<vector<int>> matrix_sizeB_range = {
     // quick return
     {0, 0},
@@ -67,6 +69,7 @@ const vector<vector<int>> matrix_sizeB_range = {
     {10, 0},
     {20, 1},
     {30, 1},
+    {40, 0},
 };
 
 // for daily_lapack tests
@@ -79,7 +82,7 @@ const vector<vector<int>> large_matrix_sizeB_range = {
     {100, 0}, {150, 0}, {200, 1}, {524, 1}, {1000, 0},
 };
 
-Arguments posv_setup_arguments(posv_tuple tup)
+Arguments posv_setup_arguments(posv_tuple tup, bool mixed)
 {
     vector<int> matrix_sizeA = std::get<0>(tup);
     vector<int> matrix_sizeB = std::get<1>(tup);
@@ -90,6 +93,8 @@ Arguments posv_setup_arguments(posv_tuple tup)
     arg.set<rocblas_int>("nrhs", matrix_sizeB[0]);
     arg.set<rocblas_int>("lda", matrix_sizeA[1]);
     arg.set<rocblas_int>("ldb", matrix_sizeA[2]);
+    if(mixed)
+        arg.set<rocblas_int>("ldx", matrix_sizeA[2]);
 
     if(matrix_sizeB[1] == 0)
         arg.set<char>("uplo", 'U');
@@ -115,7 +120,7 @@ protected:
     template <bool BATCHED, bool STRIDED, typename T>
     void run_tests()
     {
-        Arguments arg = posv_setup_arguments(GetParam());
+        Arguments arg = posv_setup_arguments(GetParam(), false);
 
         if(arg.peek<rocblas_int>("n") == 0 && arg.peek<rocblas_int>("nrhs") == 0)
             testing_posv_bad_arg<BATCHED, STRIDED, T>();
@@ -129,6 +134,31 @@ protected:
     }
 };
 
+class POSV_MIXED : public ::TestWithParam<posv_tuple>
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_EQ(hipGetLastError(), hipSuccess);
+    }
+
+    template <bool BATCHED, bool STRIDED, typename T>
+    void run_tests()
+    {
+        Arguments arg = posv_setup_arguments(GetParam(), true);
+
+        if(arg.peek<rocblas_int>("n") == 0 && arg.peek<rocblas_int>("nrhs") == 0)
+            testing_posv_mixed_bad_arg<BATCHED, STRIDED, T>();
+
+        arg.batch_count = (BATCHED || STRIDED ? 3 : 1);
+        if(arg.singular == 1)
+            testing_posv_mixed<BATCHED, STRIDED, T>(arg);
+
+        arg.singular = 0;
+        testing_posv_mixed<BATCHED, STRIDED, T>(arg);
+    }
+};
+
 // non-batch tests
 
 TEST_P(POSV, __float)
@@ -151,6 +181,16 @@ TEST_P(POSV, __double_complex)
     run_tests<false, false, rocblas_double_complex>();
 }
 
+TEST_P(POSV_MIXED, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(POSV_MIXED, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
 // batched tests
 
 TEST_P(POSV, batched__float)
@@ -173,6 +213,16 @@ TEST_P(POSV, batched__double_complex)
     run_tests<true, true, rocblas_double_complex>();
 }
 
+TEST_P(POSV_MIXED, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(POSV_MIXED, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
 // strided_batched tests
 
 TEST_P(POSV, strided_batched__float)
@@ -195,6 +245,16 @@ TEST_P(POSV, strided_batched__double_complex)
     run_tests<false, true, rocblas_double_complex>();
 }
 
+TEST_P(POSV_MIXED, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(POSV_MIXED, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
 // daily_lapack tests normal execution with medium to large sizes
 INSTANTIATE_TEST_SUITE_P(daily_lapack,
                          POSV,
@@ -206,3 +266,12 @@ INSTANTIATE_TEST_SUITE_P(daily_lapack,
 INSTANTIATE_TEST_SUITE_P(checkin_lapack,
                          POSV,
                          Combine(ValuesIn(matrix_sizeA_range), ValuesIn(matrix_sizeB_range)));
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         POSV_MIXED,
+                         Combine(ValuesIn(large_matrix_sizeA_range),
+                                 ValuesIn(large_matrix_sizeB_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         POSV_MIXED,
+                         Combine(ValuesIn(matrix_sizeA_range), ValuesIn(matrix_sizeB_range)));
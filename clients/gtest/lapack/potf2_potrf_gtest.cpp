@@ -26,6 +26,9 @@
  * *************************************************************************/
 
 #include "common/lapack/testing_potf2_potrf.hpp"
+#include "common/lapack/testing_potrf_interleaved.hpp"
+#include "common/lapack/testing_potrf_lowprec.hpp"
+#include "common/lapack/testing_potrf_vbatched.hpp"
 
 using ::testing::Combine;
 using ::testing::TestWithParam;
@@ -35,8 +38,9 @@ using namespace std;
 
 typedef std::tuple<vector<int>, printable_char> potrf_tuple;
 
-// each size_range vector is a {N, lda, singular}
+// each size_range vector is a {N, lda, singular, [bc]}
 // if singular = 1, then the used matrix for the tests is not positive definite
+// if bc is given, it is the batch_count used by the batched tests (3 by default)
 
 // each uplo_range is a {uplo}
 
@@ -56,14 +60,16 @@ const vector<vector<int>> matrix_size_range = {
     {10, 10, 1},
     {20, 30, 0},
     {50, 50, 1},
-    {70, 80, 0}};
+    {70, 80, 0},
+    {200, 200, 1, 20}};
 
 // for daily_lapack tests
 const vector<vector<int>> large_matrix_size_range = {
-    {192, 192, 0}, {640, 960, 1}, {1000, 1000, 0}, {1024, 1024, 1}, {2000, 2000, 0},
+    {192, 192, 0},   {640, 960, 1},     {1000, 1000, 0},    {1024, 1024, 1},
+    {2000, 2000, 0}, {600, 600, 1, 20}, {4160, 4160, 1, 1},
 };
 
-Arguments potrf_setup_arguments(potrf_tuple tup)
+Arguments potrf_setup_arguments(potrf_tuple tup, bool interleaved)
 {
     vector<int> matrix_size = std::get<0>(tup);
     char uplo = std::get<1>(tup);
@@ -71,11 +77,23 @@ Arguments potrf_setup_arguments(potrf_tuple tup)
     Arguments arg;
 
     arg.set<rocblas_int>("n", matrix_size[0]);
-    arg.set<rocblas_int>("lda", matrix_size[1]);
-
     arg.set<char>("uplo", uplo);
 
-    // only testing standard use case/defaults for strides
+    if(!interleaved)
+    {
+        arg.set<rocblas_int>("lda", matrix_size[1]);
+
+        // only testing standard use case/defaults for strides
+    }
+    else
+    {
+        // normal use case is covered by non-interleaved tests
+        rocblas_int bc = 3;
+
+        arg.set<rocblas_int>("inca", bc);
+        arg.set<rocblas_int>("lda", bc * matrix_size[1]);
+        arg.set<rocblas_stride>("strideA", 1);
+    }
 
     arg.timing = 0;
     arg.singular = matrix_size[2];
@@ -83,7 +101,7 @@ Arguments potrf_setup_arguments(potrf_tuple tup)
     return arg;
 }
 
-template <bool BLOCKED>
+template <bool BLOCKED, typename I>
 class POTF2_POTRF : public ::TestWithParam<potrf_tuple>
 {
 protected:
@@ -95,25 +113,105 @@ protected:
     template <bool BATCHED, bool STRIDED, typename T>
     void run_tests()
     {
-        Arguments arg = potrf_setup_arguments(GetParam());
+        Arguments arg = potrf_setup_arguments(GetParam(), false);
 
         if(arg.peek<char>("uplo") == 'L' && arg.peek<rocblas_int>("n") == 0)
-            testing_potf2_potrf_bad_arg<BATCHED, STRIDED, BLOCKED, T>();
+            testing_potf2_potrf_bad_arg<BATCHED, STRIDED, BLOCKED, T, I>();
 
-        arg.batch_count = (BATCHED || STRIDED ? 3 : 1);
+        vector<int> matrix_size = std::get<0>(GetParam());
+        arg.batch_count = (BATCHED || STRIDED ? (matrix_size.size() > 3 ? matrix_size[3] : 3) : 1);
         if(arg.singular == 1)
-            testing_potf2_potrf<BATCHED, STRIDED, BLOCKED, T>(arg);
+            testing_potf2_potrf<BATCHED, STRIDED, BLOCKED, T, I>(arg);
 
         arg.singular = 0;
-        testing_potf2_potrf<BATCHED, STRIDED, BLOCKED, T>(arg);
+        testing_potf2_potrf<BATCHED, STRIDED, BLOCKED, T, I>(arg);
     }
 };
 
-class POTF2 : public POTF2_POTRF<false>
+class POTRF_INTERLEAVED : public ::TestWithParam<potrf_tuple>
 {
+protected:
+    void TearDown() override
+    {
+        EXPECT_EQ(hipGetLastError(), hipSuccess);
+    }
+
+    template <typename T>
+    void run_tests()
+    {
+        Arguments arg = potrf_setup_arguments(GetParam(), true);
+
+        if(arg.peek<char>("uplo") == 'L' && arg.peek<rocblas_int>("n") == 0)
+            testing_potrf_interleaved_bad_arg<T>();
+
+        arg.batch_count = 3;
+        if(arg.singular == 1)
+            testing_potrf_interleaved<T>(arg);
+
+        arg.singular = 0;
+        testing_potrf_interleaved<T>(arg);
+    }
 };
 
-class POTRF : public POTF2_POTRF<true>
+class POTRF_LOWPREC : public ::TestWithParam<potrf_tuple>
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_EQ(hipGetLastError(), hipSuccess);
+    }
+
+    template <typename T>
+    void run_tests()
+    {
+        Arguments arg = potrf_setup_arguments(GetParam(), false);
+
+        if(arg.peek<char>("uplo") == 'L' && arg.peek<rocblas_int>("n") == 0)
+            testing_potrf_lowprec_bad_arg<T>();
+
+        arg.batch_count = 3;
+        if(arg.singular == 1)
+            testing_potrf_lowprec<T>(arg);
+
+        arg.singular = 0;
+        testing_potrf_lowprec<T>(arg);
+    }
+};
+
+class POTRF_VBATCHED : public ::TestWithParam<potrf_tuple>
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_EQ(hipGetLastError(), hipSuccess);
+    }
+
+    template <typename T>
+    void run_tests()
+    {
+        Arguments arg = potrf_setup_arguments(GetParam(), false);
+
+        if(arg.peek<char>("uplo") == 'L' && arg.peek<rocblas_int>("n") == 0)
+            testing_potrf_vbatched_bad_arg<T>();
+
+        arg.batch_count = 5;
+        if(arg.singular == 1)
+            testing_potrf_vbatched<T>(arg);
+
+        arg.singular = 0;
+        testing_potrf_vbatched<T>(arg);
+    }
+};
+
+class POTF2 : public POTF2_POTRF<false, rocblas_int>
+{
+};
+
+class POTRF : public POTF2_POTRF<true, rocblas_int>
+{
+};
+
+class POTRF_64 : public POTF2_POTRF<true, int64_t>
 {
 };
 
@@ -159,6 +257,26 @@ TEST_P(POTRF, __double_complex)
     run_tests<false, false, rocblas_double_complex>();
 }
 
+TEST_P(POTRF_64, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(POTRF_64, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(POTRF_64, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(POTRF_64, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
 // batched tests
 
 TEST_P(POTF2, batched__float)
@@ -201,6 +319,26 @@ TEST_P(POTRF, batched__double_complex)
     run_tests<true, true, rocblas_double_complex>();
 }
 
+TEST_P(POTRF_64, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(POTRF_64, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(POTRF_64, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(POTRF_64, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
 // strided_batched cases
 
 TEST_P(POTF2, strided_batched__float)
@@ -243,6 +381,82 @@ TEST_P(POTRF, strided_batched__double_complex)
     run_tests<false, true, rocblas_double_complex>();
 }
 
+TEST_P(POTRF_64, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(POTRF_64, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(POTRF_64, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(POTRF_64, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+// interleaved_batched cases
+
+TEST_P(POTRF_INTERLEAVED, interleaved_batched__float)
+{
+    run_tests<float>();
+}
+
+TEST_P(POTRF_INTERLEAVED, interleaved_batched__double)
+{
+    run_tests<double>();
+}
+
+TEST_P(POTRF_INTERLEAVED, interleaved_batched__float_complex)
+{
+    run_tests<rocblas_float_complex>();
+}
+
+TEST_P(POTRF_INTERLEAVED, interleaved_batched__double_complex)
+{
+    run_tests<rocblas_double_complex>();
+}
+
+// variable-size batched cases
+
+TEST_P(POTRF_VBATCHED, vbatched__float)
+{
+    run_tests<float>();
+}
+
+TEST_P(POTRF_VBATCHED, vbatched__double)
+{
+    run_tests<double>();
+}
+
+TEST_P(POTRF_VBATCHED, vbatched__float_complex)
+{
+    run_tests<rocblas_float_complex>();
+}
+
+TEST_P(POTRF_VBATCHED, vbatched__double_complex)
+{
+    run_tests<rocblas_double_complex>();
+}
+
+// half and bfloat16 storage cases
+
+TEST_P(POTRF_LOWPREC, strided_batched__half)
+{
+    run_tests<rocblas_half>();
+}
+
+TEST_P(POTRF_LOWPREC, strided_batched__bfloat16)
+{
+    run_tests<rocblas_bfloat16>();
+}
+
 INSTANTIATE_TEST_SUITE_P(daily_lapack,
                          POTF2,
                          Combine(ValuesIn(large_matrix_size_range), ValuesIn(uplo_range)));
@@ -258,3 +472,32 @@ INSTANTIATE_TEST_SUITE_P(daily_lapack,
 INSTANTIATE_TEST_SUITE_P(checkin_lapack,
                          POTRF,
                          Combine(ValuesIn(matrix_size_range), ValuesIn(uplo_range)));
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         POTRF_64,
+                         Combine(ValuesIn(large_matrix_size_range), ValuesIn(uplo_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         POTRF_64,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(uplo_range)));
+
+// (interleaved variants use one thread per matrix and are only meant for small sizes)
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         POTRF_INTERLEAVED,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(uplo_range)));
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         POTRF_LOWPREC,
+                         Combine(ValuesIn(large_matrix_size_range), ValuesIn(uplo_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         POTRF_LOWPREC,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(uplo_range)));
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         POTRF_VBATCHED,
+                         Combine(ValuesIn(large_matrix_size_range), ValuesIn(uplo_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         POTRF_VBATCHED,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(uplo_range)));
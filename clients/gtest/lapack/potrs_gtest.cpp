@@ -26,6 +26,8 @@
  * *************************************************************************/
 
 #include "common/lapack/testing_potrs.hpp"
+#include "common/lapack/testing_potrs_interleaved.hpp"
+#include "common/lapack/testing_potrs_vbatched.hpp"
 
 using ::testing::Combine;
 using ::testing::TestWithParam;
@@ -75,7 +77,7 @@ const vector<vector<int>> large_matrix_sizeB_range = {
     {100, 0}, {150, 0}, {200, 1}, {524, 1}, {1000, 0},
 };
 
-Arguments potrs_setup_arguments(potrs_tuple tup)
+Arguments potrs_setup_arguments(potrs_tuple tup, bool interleaved)
 {
     vector<int> matrix_sizeA = std::get<0>(tup);
     vector<int> matrix_sizeB = std::get<1>(tup);
@@ -84,22 +86,38 @@ Arguments potrs_setup_arguments(potrs_tuple tup)
 
     arg.set<rocblas_int>("n", matrix_sizeA[0]);
     arg.set<rocblas_int>("nrhs", matrix_sizeB[0]);
-    arg.set<rocblas_int>("lda", matrix_sizeA[1]);
-    arg.set<rocblas_int>("ldb", matrix_sizeA[2]);
+    if(!interleaved)
+    {
+        arg.set<rocblas_int>("lda", matrix_sizeA[1]);
+        arg.set<rocblas_int>("ldb", matrix_sizeA[2]);
+
+        // only testing standard use case/defaults for strides
+    }
+    else
+    {
+        // normal use case is covered by non-interleaved tests
+        rocblas_int bc = 3;
+
+        arg.set<rocblas_int>("inca", bc);
+        arg.set<rocblas_int>("incb", bc);
+        arg.set<rocblas_int>("lda", bc * matrix_sizeA[1]);
+        arg.set<rocblas_int>("ldb", bc * matrix_sizeA[2]);
+        arg.set<rocblas_stride>("strideA", 1);
+        arg.set<rocblas_stride>("strideB", 1);
+    }
 
     if(matrix_sizeB[1] == 0)
         arg.set<char>("uplo", 'U');
     else
         arg.set<char>("uplo", 'L');
 
-    // only testing standard use case/defaults for strides
-
     arg.timing = 0;
 
     return arg;
 }
 
-class POTRS : public ::TestWithParam<potrs_tuple>
+template <typename I>
+class POTRS_BASE : public ::TestWithParam<potrs_tuple>
 {
 protected:
     void TearDown() override
@@ -110,16 +128,66 @@ protected:
     template <bool BATCHED, bool STRIDED, typename T>
     void run_tests()
     {
-        Arguments arg = potrs_setup_arguments(GetParam());
+        Arguments arg = potrs_setup_arguments(GetParam(), false);
 
         if(arg.peek<rocblas_int>("n") == 0 && arg.peek<rocblas_int>("nrhs") == 0)
-            testing_potrs_bad_arg<BATCHED, STRIDED, T>();
+            testing_potrs_bad_arg<BATCHED, STRIDED, T, I>();
 
         arg.batch_count = (BATCHED || STRIDED ? 3 : 1);
-        testing_potrs<BATCHED, STRIDED, T>(arg);
+        testing_potrs<BATCHED, STRIDED, T, I>(arg);
+    }
+};
+
+class POTRS_INTERLEAVED : public ::TestWithParam<potrs_tuple>
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_EQ(hipGetLastError(), hipSuccess);
+    }
+
+    template <typename T>
+    void run_tests()
+    {
+        Arguments arg = potrs_setup_arguments(GetParam(), true);
+
+        if(arg.peek<rocblas_int>("n") == 0 && arg.peek<rocblas_int>("nrhs") == 0)
+            testing_potrs_interleaved_bad_arg<T>();
+
+        arg.batch_count = 3;
+        testing_potrs_interleaved<T>(arg);
     }
 };
 
+class POTRS_VBATCHED : public ::TestWithParam<potrs_tuple>
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_EQ(hipGetLastError(), hipSuccess);
+    }
+
+    template <typename T>
+    void run_tests()
+    {
+        Arguments arg = potrs_setup_arguments(GetParam(), false);
+
+        if(arg.peek<rocblas_int>("n") == 0 && arg.peek<rocblas_int>("nrhs") == 0)
+            testing_potrs_vbatched_bad_arg<T>();
+
+        arg.batch_count = 5;
+        testing_potrs_vbatched<T>(arg);
+    }
+};
+
+class POTRS : public POTRS_BASE<rocblas_int>
+{
+};
+
+class POTRS_64 : public POTRS_BASE<int64_t>
+{
+};
+
 // non-batch tests
 
 TEST_P(POTRS, __float)
@@ -142,6 +210,26 @@ TEST_P(POTRS, __double_complex)
     run_tests<false, false, rocblas_double_complex>();
 }
 
+TEST_P(POTRS_64, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(POTRS_64, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(POTRS_64, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(POTRS_64, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
 // batched tests
 
 TEST_P(POTRS, batched__float)
@@ -164,6 +252,26 @@ TEST_P(POTRS, batched__double_complex)
     run_tests<true, true, rocblas_double_complex>();
 }
 
+TEST_P(POTRS_64, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(POTRS_64, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(POTRS_64, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(POTRS_64, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
 // strided_batched tests
 
 TEST_P(POTRS, strided_batched__float)
@@ -186,6 +294,70 @@ TEST_P(POTRS, strided_batched__double_complex)
     run_tests<false, true, rocblas_double_complex>();
 }
 
+TEST_P(POTRS_64, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(POTRS_64, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(POTRS_64, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(POTRS_64, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+// interleaved_batched tests
+
+TEST_P(POTRS_INTERLEAVED, interleaved_batched__float)
+{
+    run_tests<float>();
+}
+
+TEST_P(POTRS_INTERLEAVED, interleaved_batched__double)
+{
+    run_tests<double>();
+}
+
+TEST_P(POTRS_INTERLEAVED, interleaved_batched__float_complex)
+{
+    run_tests<rocblas_float_complex>();
+}
+
+TEST_P(POTRS_INTERLEAVED, interleaved_batched__double_complex)
+{
+    run_tests<rocblas_double_complex>();
+}
+
+// variable-size batched tests
+
+TEST_P(POTRS_VBATCHED, vbatched__float)
+{
+    run_tests<float>();
+}
+
+TEST_P(POTRS_VBATCHED, vbatched__double)
+{
+    run_tests<double>();
+}
+
+TEST_P(POTRS_VBATCHED, vbatched__float_complex)
+{
+    run_tests<rocblas_float_complex>();
+}
+
+TEST_P(POTRS_VBATCHED, vbatched__double_complex)
+{
+    run_tests<rocblas_double_complex>();
+}
+
 // daily_lapack tests normal execution with medium to large sizes
 INSTANTIATE_TEST_SUITE_P(daily_lapack,
                          POTRS,
@@ -197,3 +369,26 @@ INSTANTIATE_TEST_SUITE_P(daily_lapack,
 INSTANTIATE_TEST_SUITE_P(checkin_lapack,
                          POTRS,
                          Combine(ValuesIn(matrix_sizeA_range), ValuesIn(matrix_sizeB_range)));
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         POTRS_64,
+                         Combine(ValuesIn(large_matrix_sizeA_range),
+                                 ValuesIn(large_matrix_sizeB_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         POTRS_64,
+                         Combine(ValuesIn(matrix_sizeA_range), ValuesIn(matrix_sizeB_range)));
+
+// (interleaved variants use one thread per problem and are only meant for small sizes)
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         POTRS_INTERLEAVED,
+                         Combine(ValuesIn(matrix_sizeA_range), ValuesIn(matrix_sizeB_range)));
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         POTRS_VBATCHED,
+                         Combine(ValuesIn(large_matrix_sizeA_range),
+                                 ValuesIn(large_matrix_sizeB_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         POTRS_VBATCHED,
+                         Combine(ValuesIn(matrix_sizeA_range), ValuesIn(matrix_sizeB_range)));
@@ -35,7 +35,8 @@ using namespace std;
 
 typedef std::tuple<vector<int>, vector<printable_char>> syevj_heevj_tuple;
 
-// each size_range vector is a {n, lda}
+// each size_range vector is a {n, lda, mixed};
+// if mixed = 1 then the mixed-precision algorithm is selected (rocsolver_alg_mode_mixed)
 
 // each op_range vector is a {evect, uplo}
 
@@ -58,10 +59,24 @@ const vector<vector<int>> size_range = {
     {40, 45},
     {67, 70},
     {70, 70},
+    // (small-size kernel with the copy of A in LDS, for some precisions)
+    {90, 100},
+    {127, 127},
+    // mixed precision
+    {40, 45, 1},
+    {127, 127, 1},
 };
 
 // for daily_lapack tests
-const vector<vector<int>> large_size_range = {{192, 192}, {256, 270}, {300, 300}};
+const vector<vector<int>> large_size_range = {
+    {192, 192},
+    {256, 270},
+    {300, 300},
+    {300, 300, 1},
+    // (block Jacobi, with an odd number of blocks for the second size)
+    {1088, 1088},
+    {1100, 1110},
+};
 
 Arguments syevj_heevj_setup_arguments(syevj_heevj_tuple tup)
 {
@@ -73,6 +88,10 @@ Arguments syevj_heevj_setup_arguments(syevj_heevj_tuple tup)
     arg.set<rocblas_int>("n", size[0]);
     arg.set<rocblas_int>("lda", size[1]);
 
+    // mixed precision
+    if(size.size() > 2 && size[2] == 1)
+        arg.set<char>("alg_mode", 'M');
+
     arg.set<char>("evect", op[0]);
     arg.set<char>("uplo", op[1]);
 
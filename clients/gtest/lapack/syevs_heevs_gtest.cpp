@@ -0,0 +1,161 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "common/lapack/testing_syevs_heevs.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, printable_char> syevs_heevs_tuple;
+
+// each size_range vector is a {n, lda, nev, k, ldx}
+
+// each uplo_range is a {uplo}
+
+// case when n == 0 and uplo = L will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+const vector<printable_char> uplo_range = {'L', 'U'};
+
+// for checkin_lapack tests
+const vector<vector<int>> size_range = {
+    // quick return
+    {0, 1, 0, 0, 1},
+    {10, 10, 0, 0, 10},
+    // invalid
+    {-1, 1, 0, 0, 1},
+    {10, 5, 2, 4, 10},
+    {10, 10, 4, 2, 10},
+    {10, 10, 2, 11, 10},
+    {10, 10, 2, 4, 5},
+    // normal (valid) samples
+    {1, 1, 1, 1, 1},
+    {12, 12, 3, 12, 12},
+    {20, 20, 2, 8, 20},
+    {35, 40, 4, 12, 35},
+    {50, 50, 0, 4, 50},
+    {64, 64, 1, 6, 70},
+    {100, 110, 6, 16, 100},
+};
+
+// for daily_lapack tests
+const vector<vector<int>> large_size_range = {
+    {250, 250, 8, 20, 250},
+    {400, 410, 10, 24, 400},
+    {600, 600, 16, 32, 600},
+};
+
+Arguments syevs_heevs_setup_arguments(syevs_heevs_tuple tup)
+{
+    vector<int> size = std::get<0>(tup);
+    char uplo = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.set<rocblas_int>("n", size[0]);
+    arg.set<rocblas_int>("lda", size[1]);
+    arg.set<rocblas_int>("nev", size[2]);
+    arg.set<rocblas_int>("k", size[3]);
+    arg.set<rocblas_int>("ldx", size[4]);
+
+    arg.set<char>("uplo", uplo);
+
+    arg.set<rocblas_int>("max_sweeps", 100);
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class SYEVS_HEEVS : public ::TestWithParam<syevs_heevs_tuple>
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_EQ(hipGetLastError(), hipSuccess);
+    }
+
+    template <typename T>
+    void run_tests()
+    {
+        using S = decltype(std::real(T{}));
+
+        Arguments arg = syevs_heevs_setup_arguments(GetParam());
+
+        if(arg.peek<rocblas_int>("n") == 0 && arg.peek<char>("uplo") == 'L')
+            testing_syevs_heevs_bad_arg<T>();
+
+        // converge to n * machine_precision (relative to the largest eigenvalue)
+        arg.set<double>("abstol", std::max(arg.peek<rocblas_int>("n"), 1) * get_epsilon<S>());
+
+        testing_syevs_heevs<T>(arg);
+    }
+};
+
+class SYEVS : public SYEVS_HEEVS
+{
+};
+
+class HEEVS : public SYEVS_HEEVS
+{
+};
+
+// non-batch tests
+
+TEST_P(SYEVS, __float)
+{
+    run_tests<float>();
+}
+
+TEST_P(SYEVS, __double)
+{
+    run_tests<double>();
+}
+
+TEST_P(HEEVS, __float_complex)
+{
+    run_tests<rocblas_float_complex>();
+}
+
+TEST_P(HEEVS, __double_complex)
+{
+    run_tests<rocblas_double_complex>();
+}
+
+// daily_lapack tests normal execution with medium to large sizes
+INSTANTIATE_TEST_SUITE_P(daily_lapack, SYEVS, Combine(ValuesIn(large_size_range), ValuesIn(uplo_range)));
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack, HEEVS, Combine(ValuesIn(large_size_range), ValuesIn(uplo_range)));
+
+// checkin_lapack tests normal execution with small sizes, invalid sizes,
+// quick returns, and corner cases
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, SYEVS, Combine(ValuesIn(size_range), ValuesIn(uplo_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, HEEVS, Combine(ValuesIn(size_range), ValuesIn(uplo_range)));
@@ -55,7 +55,10 @@ const vector<vector<int>> matrix_size_range = {
     // normal (valid) samples
     {50, 50, 50},
     {70, 100, 110},
+    // small-size kernel beyond xxGST_BLOCKSIZE (single precision)
+    {120, 128, 126},
     {130, 130, 130},
+    {200, 210, 200},
 };
 
 // for daily_lapack tests
@@ -63,6 +66,8 @@ const vector<vector<int>> large_matrix_size_range = {
     {152, 152, 152},
     {640, 640, 640},
     {1000, 1024, 1024},
+    // recursive algorithm (itype = 1)
+    {1100, 1100, 1100},
 };
 
 Arguments sygst_setup_arguments(sygst_tuple tup)
@@ -64,7 +64,8 @@ const vector<vector<int>> matrix_size_range = {
 
 // for daily_lapack tests
 const vector<vector<int>> large_matrix_size_range
-    = {{192, 192, 1}, {500, 600, 2}, {640, 640, 0}, {1000, 1024, 1}, {1200, 1230, 2}};
+    = {{192, 192, 1},   {300, 300, 0},   {500, 600, 2}, {640, 640, 0}, {1000, 1024, 1},
+       {1200, 1230, 2}, {2100, 2100, 2}, {2200, 2200, 1}};
 
 Arguments trtri_setup_arguments(trtri_tuple tup)
 {
@@ -25,6 +25,9 @@
  * SUCH DAMAGE.
  * *************************************************************************/
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
 #include <cstdlib>
 #if __has_include(<filesystem>)
 #include <filesystem>
@@ -34,6 +37,7 @@ namespace fs = std::filesystem;
 namespace fs = std::experimental::filesystem;
 #endif
 #include <fstream>
+#include <thread>
 #include <vector>
 
 #include <fmt/format.h>
@@ -199,7 +203,9 @@ TEST_F(checkin_misc_LOGGING, rocblas_layer_mode_log_profile)
         "rocSOLVER Version: .*",
         "rocBLAS Version: .*",
         ".*PROFILE.*",
-        ".*getrf.*Calls: 1, Total Time: .+ .+ .in nested functions: .+ .+.",
+        // the functions called by the top-level function report the workspace of the call
+        ".*getrf.*Calls: 1, Total Time: .+ .+, Peak Workspace: [0-9]+ bytes .in nested functions: "
+        ".+ .+.",
         "\\s*",
     };
     verify_file(log_filepath, expected_lines);
@@ -436,3 +442,1735 @@ TEST_F(checkin_misc_LOGGING, end_before_begin)
 {
     ASSERT_EQ(rocsolver_log_end(), rocblas_status_internal_error);
 }
+
+TEST_F(checkin_misc_LOGGING, rocsolver_get_last_call_stats)
+{
+    rocblas_local_handle handle;
+    rocsolver_call_stats stats;
+
+    EXPECT_EQ(rocsolver_get_last_call_stats(nullptr, &stats), rocblas_status_invalid_handle);
+    EXPECT_EQ(rocsolver_get_last_call_stats(handle, nullptr), rocblas_status_invalid_pointer);
+
+    // no call has been made with the handle yet
+    ASSERT_EQ(rocsolver_get_last_call_stats(handle, &stats), rocblas_status_success);
+    EXPECT_EQ(stats.kernel_launches, 0);
+    EXPECT_EQ(stats.rocblas_calls, 0);
+    EXPECT_EQ(stats.host_syncs, 0);
+    EXPECT_EQ(stats.workspace_size, 0);
+    EXPECT_EQ(stats.flops, 0);
+
+    // the statistics do not depend on logging being enabled
+    EXPECT_EQ(rocsolver_dgetrf_strided_batched(handle, m, n, dA, lda, stA, dP, stP, dinfo, bc),
+              rocblas_status_success);
+    ASSERT_EQ(rocsolver_get_last_call_stats(handle, &stats), rocblas_status_success);
+    EXPECT_GT(stats.kernel_launches, 0);
+    EXPECT_GT(stats.workspace_size, 0);
+    EXPECT_EQ(stats.host_syncs, 0);
+
+    double k = n;
+    double fmuls = 0.5 * k * (k * (k - k / 3 - 1) + k) + 2 * k / 3;
+    double fadds = 0.5 * k * (k * (k - k / 3) - k) + k / 6;
+    EXPECT_DOUBLE_EQ(stats.flops, bc * (fmuls + fadds));
+
+    // functions without a nominal flop count report zero
+    EXPECT_EQ(rocsolver_dgetf2_strided_batched(handle, m, n, dA, lda, stA, dP, stP, dinfo, bc),
+              rocblas_status_success);
+    ASSERT_EQ(rocsolver_get_last_call_stats(handle, &stats), rocblas_status_success);
+    EXPECT_GT(stats.kernel_launches, 0);
+    EXPECT_EQ(stats.flops, 0);
+}
+
+TEST_F(checkin_misc_LOGGING, rocsolver_set_diagnostics)
+{
+    rocblas_local_handle handle;
+    rocsolver_diagnostics* ddiag;
+    ASSERT_EQ(hipMalloc(&ddiag, sizeof(rocsolver_diagnostics)), hipSuccess);
+
+    EXPECT_EQ(rocsolver_set_diagnostics(nullptr, ddiag, 1), rocblas_status_invalid_handle);
+    EXPECT_EQ(rocsolver_set_diagnostics(handle, ddiag, -1), rocblas_status_invalid_size);
+
+    // the 1-2-1 tridiagonal matrix (D in dA, E after D)
+    double* dD = dA;
+    double* dE = dA + n;
+    std::vector<double> hD(n, 2.0), hE(n - 1, -1.0);
+    ASSERT_EQ(hipMemcpy(dD, hD.data(), sizeof(double) * n, hipMemcpyHostToDevice), hipSuccess);
+    ASSERT_EQ(hipMemcpy(dE, hE.data(), sizeof(double) * (n - 1), hipMemcpyHostToDevice),
+              hipSuccess);
+
+    ASSERT_EQ(rocsolver_set_diagnostics(handle, ddiag, 1), rocblas_status_success);
+    EXPECT_EQ(rocsolver_dsterf(handle, n, dD, dE, dinfo), rocblas_status_success);
+
+    rocsolver_diagnostics hdiag;
+    ASSERT_EQ(hipMemcpy(&hdiag, ddiag, sizeof(rocsolver_diagnostics), hipMemcpyDeviceToHost),
+              hipSuccess);
+    EXPECT_GT(hdiag.iterations, 0);
+    EXPECT_GT(hdiag.deflations, 0);
+    EXPECT_GT(hdiag.stage_ticks[0], 0);
+    EXPECT_EQ(hdiag.stage_ticks[1], 0);
+
+    // the records are not written once the buffer is unregistered
+    ASSERT_EQ(hipMemset(ddiag, 0, sizeof(rocsolver_diagnostics)), hipSuccess);
+    ASSERT_EQ(rocsolver_set_diagnostics(handle, nullptr, 0), rocblas_status_success);
+    EXPECT_EQ(rocsolver_dsterf(handle, n, dD, dE, dinfo), rocblas_status_success);
+    ASSERT_EQ(hipMemcpy(&hdiag, ddiag, sizeof(rocsolver_diagnostics), hipMemcpyDeviceToHost),
+              hipSuccess);
+    EXPECT_EQ(hdiag.iterations, 0);
+    EXPECT_EQ(hdiag.stage_ticks[0], 0);
+
+    EXPECT_EQ(hipFree(ddiag), hipSuccess);
+}
+
+TEST_F(checkin_misc_LOGGING, rocsolver_initialize)
+{
+    rocblas_local_handle handle;
+    rocsolver_problem_shape shapes[]
+        = {{rocsolver_function_getrf, rocblas_datatype_f64_r, m, n, 0, 0},
+           {rocsolver_function_gesv, rocblas_datatype_f32_c, 0, n, 2, bc},
+           {rocsolver_function_syevd, rocblas_datatype_f64_r, 0, n, 0, 0}};
+
+    EXPECT_EQ(rocsolver_initialize(nullptr, shapes, 3), rocblas_status_invalid_handle);
+    EXPECT_EQ(rocsolver_initialize(handle, shapes, -1), rocblas_status_invalid_size);
+    EXPECT_EQ(rocsolver_initialize(handle, nullptr, 3), rocblas_status_invalid_pointer);
+
+    // only the one-time initialization of the library
+    EXPECT_EQ(rocsolver_initialize(handle, nullptr, 0), rocblas_status_success);
+
+    // non-supported functions and precisions
+    rocsolver_problem_shape invalid = shapes[0];
+    invalid.datatype = rocblas_datatype_i8_r;
+    EXPECT_EQ(rocsolver_initialize(handle, &invalid, 1), rocblas_status_invalid_value);
+    invalid = shapes[0];
+    invalid.function = rocsolver_function(0);
+    EXPECT_EQ(rocsolver_initialize(handle, &invalid, 1), rocblas_status_invalid_value);
+    invalid = shapes[0];
+    invalid.n = -1;
+    EXPECT_EQ(rocsolver_initialize(handle, &invalid, 1), rocblas_status_invalid_size);
+
+    // the warm-up calls are recorded as any other call
+    ASSERT_EQ(rocsolver_initialize(handle, shapes, 3), rocblas_status_success);
+    rocsolver_call_stats stats;
+    ASSERT_EQ(rocsolver_get_last_call_stats(handle, &stats), rocblas_status_success);
+    EXPECT_GT(stats.kernel_launches, 0);
+    EXPECT_GT(stats.workspace_size, 0);
+}
+
+TEST_F(checkin_misc_LOGGING, rocsolver_get_workspace_size)
+{
+    rocblas_local_handle handle;
+    rocsolver_problem_shape shape = {rocsolver_function_getrf, rocblas_datatype_f64_r, m, n, 0, 0};
+    size_t size, expected;
+
+    EXPECT_EQ(rocsolver_get_workspace_size(nullptr, &shape, &size), rocblas_status_invalid_handle);
+    EXPECT_EQ(rocsolver_get_workspace_size(handle, nullptr, &size), rocblas_status_invalid_pointer);
+    EXPECT_EQ(rocsolver_get_workspace_size(handle, &shape, nullptr),
+              rocblas_status_invalid_pointer);
+
+    rocsolver_problem_shape invalid = shape;
+    invalid.datatype = rocblas_datatype_i8_r;
+    EXPECT_EQ(rocsolver_get_workspace_size(handle, &invalid, &size), rocblas_status_invalid_value);
+    invalid = shape;
+    invalid.m = -1;
+    EXPECT_EQ(rocsolver_get_workspace_size(handle, &invalid, &size), rocblas_status_invalid_size);
+
+    // the size is the one given by the device memory size query of the function
+    ASSERT_EQ(rocblas_start_device_memory_size_query(handle), rocblas_status_success);
+    EXPECT_EQ(rocsolver_get_workspace_size(handle, &shape, &size), rocblas_status_invalid_value);
+    rocsolver_dgetrf(handle, m, n, nullptr, m, nullptr, nullptr);
+    ASSERT_EQ(rocblas_stop_device_memory_size_query(handle, &expected), rocblas_status_success);
+
+    ASSERT_EQ(rocsolver_get_workspace_size(handle, &shape, &size), rocblas_status_success);
+    EXPECT_EQ(size, expected);
+
+    // memoized sizes are returned for the following queries
+    ASSERT_EQ(rocsolver_get_workspace_size(handle, &shape, &size), rocblas_status_success);
+    EXPECT_EQ(size, expected);
+
+    // the leading dimension is part of the shape
+    invalid = shape;
+    invalid.lda = m - 1;
+    EXPECT_EQ(rocsolver_get_workspace_size(handle, &invalid, &size), rocblas_status_invalid_size);
+
+    rocsolver_problem_shape wide = shape;
+    wide.lda = m + 32;
+    ASSERT_EQ(rocblas_start_device_memory_size_query(handle), rocblas_status_success);
+    rocsolver_dgetrf(handle, m, n, nullptr, wide.lda, nullptr, nullptr);
+    ASSERT_EQ(rocblas_stop_device_memory_size_query(handle, &expected), rocblas_status_success);
+
+    ASSERT_EQ(rocsolver_get_workspace_size(handle, &wide, &size), rocblas_status_success);
+    EXPECT_EQ(size, expected);
+}
+
+TEST_F(checkin_misc_LOGGING, rocsolver_tuning_file)
+{
+    rocblas_local_handle handle;
+    const rocblas_int dim = 1024;
+    auto getrf_size = [&]() {
+        size_t size = 0;
+        EXPECT_EQ(rocblas_start_device_memory_size_query(handle), rocblas_status_success);
+        rocsolver_dgetrf(handle, dim, dim, nullptr, dim, nullptr, nullptr);
+        EXPECT_EQ(rocblas_stop_device_memory_size_query(handle, &size), rocblas_status_success);
+        return size;
+    };
+    auto size_with_tuning = [&](const char* suffix, const std::vector<std::string>& lines) {
+        fs::path tuning_filepath = fs::temp_directory_path()
+            / fmt::format("tuning_{}_{}", UnitTest::GetInstance()->current_test_info()->name(),
+                          suffix);
+        {
+            std::ofstream tuning_file(tuning_filepath);
+            for(const auto& line : lines)
+                tuning_file << line << '\n';
+        }
+        size_t size;
+        {
+            scoped_envvar tuning_variable("ROCSOLVER_TUNING_PATH",
+                                          tuning_filepath.generic_string().c_str());
+            EXPECT_EQ(rocsolver_initialize(handle, nullptr, 0), rocblas_status_success);
+            size = getrf_size();
+        }
+        EXPECT_TRUE(fs::remove(tuning_filepath));
+        return size;
+    };
+
+    ASSERT_EQ(rocsolver_initialize(handle, nullptr, 0), rocblas_status_success);
+    const size_t expected = getrf_size();
+
+    // a valid table is used (block size 0 means unblocked getf2)
+    EXPECT_NE(size_with_tuning("valid",
+                               {"getrf_real.intervals = 100000", "getrf_real.blksizes = 0, 0"}),
+              expected);
+
+    // tables with invalid intervals or a wrong number of block sizes are ignored
+    EXPECT_EQ(size_with_tuning("decreasing", {"getrf_real.intervals = 100000, 10",
+                                              "getrf_real.blksizes = 0, 0, 0"}),
+              expected);
+    EXPECT_EQ(size_with_tuning("zero", {"getrf_real.intervals = 0", "getrf_real.blksizes = 0, 0"}),
+              expected);
+    EXPECT_EQ(size_with_tuning("mismatch",
+                               {"getrf_real.intervals = 100000", "getrf_real.blksizes = 0"}),
+              expected);
+
+    // the default tables are used again once the variable is restored
+    ASSERT_EQ(rocsolver_initialize(handle, nullptr, 0), rocblas_status_success);
+    EXPECT_EQ(getrf_size(), expected);
+}
+
+TEST_F(checkin_misc_LOGGING, rocsolver_workmode_auto)
+{
+    rocblas_local_handle handle;
+    const rocblas_int m = 300, n = 20; // thin SVD
+    const rocblas_svect sv = rocblas_svect_singular;
+    double *dA, *dS, *dU, *dV, *dE;
+    rocblas_int* dinfo;
+    ASSERT_EQ(hipMalloc(&dA, sizeof(double) * m * n), hipSuccess);
+    ASSERT_EQ(hipMalloc(&dS, sizeof(double) * n), hipSuccess);
+    ASSERT_EQ(hipMalloc(&dU, sizeof(double) * m * n), hipSuccess);
+    ASSERT_EQ(hipMalloc(&dV, sizeof(double) * n * n), hipSuccess);
+    ASSERT_EQ(hipMalloc(&dE, sizeof(double) * n), hipSuccess);
+    ASSERT_EQ(hipMalloc(&dinfo, sizeof(rocblas_int)), hipSuccess);
+    std::vector<double> hA(m * n);
+    for(rocblas_int k = 0; k < m * n; ++k)
+        hA[k] = std::sin(1.0 + k);
+
+    // size queries report the workspace of the out-of-place algorithm
+    size_t size_in, size_out, size_auto;
+    ASSERT_EQ(rocblas_start_device_memory_size_query(handle), rocblas_status_success);
+    rocsolver_dgesvd(handle, sv, sv, m, n, dA, m, dS, dU, m, dV, n, dE, rocblas_inplace, dinfo);
+    ASSERT_EQ(rocblas_stop_device_memory_size_query(handle, &size_in), rocblas_status_success);
+    ASSERT_EQ(rocblas_start_device_memory_size_query(handle), rocblas_status_success);
+    rocsolver_dgesvd(handle, sv, sv, m, n, dA, m, dS, dU, m, dV, n, dE, rocblas_outofplace, dinfo);
+    ASSERT_EQ(rocblas_stop_device_memory_size_query(handle, &size_out), rocblas_status_success);
+    ASSERT_EQ(rocblas_start_device_memory_size_query(handle), rocblas_status_success);
+    rocsolver_dgesvd(handle, sv, sv, m, n, dA, m, dS, dU, m, dV, n, dE, rocblas_auto, dinfo);
+    ASSERT_EQ(rocblas_stop_device_memory_size_query(handle, &size_auto), rocblas_status_success);
+    EXPECT_EQ(size_auto, size_out);
+    ASSERT_GT(size_out, size_in);
+
+    // the out-of-place algorithm is used when the handle can grow its memory
+    rocsolver_call_stats stats;
+    ASSERT_EQ(hipMemcpy(dA, hA.data(), sizeof(double) * m * n, hipMemcpyHostToDevice), hipSuccess);
+    ASSERT_EQ(rocsolver_dgesvd(handle, sv, sv, m, n, dA, m, dS, dU, m, dV, n, dE, rocblas_auto,
+                               dinfo),
+              rocblas_status_success);
+    ASSERT_EQ(rocsolver_get_last_call_stats(handle, &stats), rocblas_status_success);
+    EXPECT_EQ(stats.workmode, rocblas_outofplace);
+    std::vector<double> hS(n), hS_in(n);
+    ASSERT_EQ(hipMemcpy(hS.data(), dS, sizeof(double) * n, hipMemcpyDeviceToHost), hipSuccess);
+
+    // functions without a work mode report zero
+    ASSERT_EQ(rocsolver_dgeqrf(handle, m, n, dA, m, dE), rocblas_status_success);
+    ASSERT_EQ(rocsolver_get_last_call_stats(handle, &stats), rocblas_status_success);
+    EXPECT_EQ(stats.workmode, 0);
+
+    // and the in-place algorithm when only its workspace is available
+    ASSERT_EQ(rocblas_set_device_memory_size(handle, size_in), rocblas_status_success);
+    ASSERT_EQ(hipMemcpy(dA, hA.data(), sizeof(double) * m * n, hipMemcpyHostToDevice), hipSuccess);
+    ASSERT_EQ(rocsolver_dgesvd(handle, sv, sv, m, n, dA, m, dS, dU, m, dV, n, dE, rocblas_auto,
+                               dinfo),
+              rocblas_status_success);
+    ASSERT_EQ(rocsolver_get_last_call_stats(handle, &stats), rocblas_status_success);
+    EXPECT_EQ(stats.workmode, rocblas_inplace);
+    ASSERT_EQ(hipMemcpy(hS_in.data(), dS, sizeof(double) * n, hipMemcpyDeviceToHost), hipSuccess);
+    for(rocblas_int i = 0; i < n; ++i)
+        EXPECT_NEAR(hS_in[i], hS[i], 1e-12 * hS[0]);
+
+    EXPECT_EQ(hipFree(dA), hipSuccess);
+    EXPECT_EQ(hipFree(dS), hipSuccess);
+    EXPECT_EQ(hipFree(dU), hipSuccess);
+    EXPECT_EQ(hipFree(dV), hipSuccess);
+    EXPECT_EQ(hipFree(dE), hipSuccess);
+    EXPECT_EQ(hipFree(dinfo), hipSuccess);
+}
+
+TEST_F(checkin_misc_LOGGING, rocsolver_set_workspace_pool)
+{
+    rocblas_local_handle handle;
+    int device;
+    hipMemPool_t pool, current;
+    ASSERT_EQ(hipGetDevice(&device), hipSuccess);
+    ASSERT_EQ(hipDeviceGetDefaultMemPool(&pool, device), hipSuccess);
+
+    EXPECT_EQ(rocsolver_set_workspace_pool(nullptr, pool, 0), rocblas_status_invalid_handle);
+    EXPECT_EQ(rocsolver_get_workspace_pool(nullptr, &current), rocblas_status_invalid_handle);
+    EXPECT_EQ(rocsolver_get_workspace_pool(handle, nullptr), rocblas_status_invalid_pointer);
+
+    // no pool is set by default
+    ASSERT_EQ(rocsolver_get_workspace_pool(handle, &current), rocblas_status_success);
+    EXPECT_EQ(current, nullptr);
+
+    ASSERT_EQ(rocsolver_set_workspace_pool(handle, pool, 1 << 20), rocblas_status_success);
+    ASSERT_EQ(rocsolver_get_workspace_pool(handle, &current), rocblas_status_success);
+    EXPECT_EQ(current, pool);
+    uint64_t threshold = 0;
+    ASSERT_EQ(hipMemPoolGetAttribute(pool, hipMemPoolAttrReleaseThreshold, &threshold), hipSuccess);
+    EXPECT_EQ(threshold, uint64_t(1 << 20));
+
+    // the functions still succeed with the pool
+    double* dA;
+    rocblas_int *dIpiv, *dInfo;
+    ASSERT_EQ(hipMalloc(&dA, sizeof(double) * lda * n), hipSuccess);
+    ASSERT_EQ(hipMalloc(&dIpiv, sizeof(rocblas_int) * n), hipSuccess);
+    ASSERT_EQ(hipMalloc(&dInfo, sizeof(rocblas_int)), hipSuccess);
+    ASSERT_EQ(hipMemset(dA, 0, sizeof(double) * lda * n), hipSuccess);
+    EXPECT_EQ(rocsolver_dgetrf(handle, m, n, dA, lda, dIpiv, dInfo), rocblas_status_success);
+    EXPECT_EQ(hipDeviceSynchronize(), hipSuccess);
+    EXPECT_EQ(hipFree(dA), hipSuccess);
+    EXPECT_EQ(hipFree(dIpiv), hipSuccess);
+    EXPECT_EQ(hipFree(dInfo), hipSuccess);
+
+    // a null pool disables the setting
+    threshold = 0;
+    ASSERT_EQ(hipMemPoolSetAttribute(pool, hipMemPoolAttrReleaseThreshold, &threshold), hipSuccess);
+    ASSERT_EQ(rocsolver_set_workspace_pool(handle, nullptr, 0), rocblas_status_success);
+    ASSERT_EQ(rocsolver_get_workspace_pool(handle, &current), rocblas_status_success);
+    EXPECT_EQ(current, nullptr);
+}
+
+TEST_F(checkin_misc_LOGGING, rocsolver_alg_mode_prefetch)
+{
+    rocblas_local_handle handle;
+    const rocblas_int nn = 600;
+    rocsolver_alg_mode mode;
+
+    EXPECT_EQ(rocsolver_set_alg_mode(handle, rocsolver_function_getrs, rocsolver_alg_mode_prefetch),
+              rocblas_status_invalid_value);
+    EXPECT_EQ(rocsolver_set_alg_mode(handle, rocsolver_function_potrf, rocsolver_alg_mode_dc),
+              rocblas_status_invalid_value);
+
+    // the factorizations of a matrix in managed memory are the same with the prefetch mode
+    std::vector<double> hA(size_t(nn) * nn), hR(size_t(nn) * nn);
+    for(rocblas_int j = 0; j < nn; ++j)
+        for(rocblas_int i = 0; i < nn; ++i)
+            hA[i + j * size_t(nn)] = (i == j) ? nn : 1.0 / (1 + i + j);
+
+    double* dA;
+    rocblas_int *dIpiv, *dInfo;
+    ASSERT_EQ(hipMallocManaged(&dA, sizeof(double) * nn * nn), hipSuccess);
+    ASSERT_EQ(hipMallocManaged(&dIpiv, sizeof(rocblas_int) * nn), hipSuccess);
+    ASSERT_EQ(hipMallocManaged(&dInfo, sizeof(rocblas_int)), hipSuccess);
+
+    for(rocsolver_function func : {rocsolver_function_getrf, rocsolver_function_potrf})
+    {
+        for(rocsolver_alg_mode m : {rocsolver_alg_mode_qr, rocsolver_alg_mode_prefetch})
+        {
+            ASSERT_EQ(rocsolver_set_alg_mode(handle, func, m), rocblas_status_success);
+            ASSERT_EQ(rocsolver_get_alg_mode(handle, func, &mode), rocblas_status_success);
+            EXPECT_EQ(mode, m);
+
+            std::copy(hA.begin(), hA.end(), dA);
+            if(func == rocsolver_function_getrf)
+                ASSERT_EQ(rocsolver_dgetrf(handle, nn, nn, dA, nn, dIpiv, dInfo),
+                          rocblas_status_success);
+            else
+                ASSERT_EQ(rocsolver_dpotrf(handle, rocblas_fill_lower, nn, dA, nn, dInfo),
+                          rocblas_status_success);
+            ASSERT_EQ(hipDeviceSynchronize(), hipSuccess);
+            EXPECT_EQ(*dInfo, 0);
+
+            if(m == rocsolver_alg_mode_qr)
+                std::copy(dA, dA + size_t(nn) * nn, hR.begin());
+            else
+            {
+                double err = 0;
+                for(size_t k = 0; k < hR.size(); ++k)
+                    err = std::max(err, std::abs(dA[k] - hR[k]));
+                EXPECT_LE(err, 1e-12 * nn);
+            }
+        }
+        ASSERT_EQ(rocsolver_set_alg_mode(handle, func, rocsolver_alg_mode_qr),
+                  rocblas_status_success);
+    }
+
+    EXPECT_EQ(hipFree(dA), hipSuccess);
+    EXPECT_EQ(hipFree(dIpiv), hipSuccess);
+    EXPECT_EQ(hipFree(dInfo), hipSuccess);
+}
+
+TEST_F(checkin_misc_LOGGING, rocsolver_alg_mode_tournament)
+{
+    rocblas_local_handle handle;
+    const rocblas_int m = 3000; // taller than the panels factorized with GETF2
+    const rocblas_int n = 128;
+    rocsolver_alg_mode mode;
+
+    EXPECT_EQ(
+        rocsolver_set_alg_mode(handle, rocsolver_function_potrf, rocsolver_alg_mode_tournament),
+        rocblas_status_invalid_value);
+    ASSERT_EQ(
+        rocsolver_set_alg_mode(handle, rocsolver_function_getrf, rocsolver_alg_mode_tournament),
+        rocblas_status_success);
+    ASSERT_EQ(rocsolver_get_alg_mode(handle, rocsolver_function_getrf, &mode),
+              rocblas_status_success);
+    EXPECT_EQ(mode, rocsolver_alg_mode_tournament);
+
+    // the pivots may differ from partial pivoting, but P*A = L*U must hold
+    std::vector<double> hA(size_t(m) * n);
+    for(rocblas_int j = 0; j < n; ++j)
+        for(rocblas_int i = 0; i < m; ++i)
+            hA[i + j * size_t(m)] = std::sin(1.0 + i + 7.0 * j) + ((i == j) ? 2.0 : 0.0);
+
+    double* dA;
+    rocblas_int *dIpiv, *dInfo;
+    ASSERT_EQ(hipMallocManaged(&dA, sizeof(double) * m * n), hipSuccess);
+    ASSERT_EQ(hipMallocManaged(&dIpiv, sizeof(rocblas_int) * n), hipSuccess);
+    ASSERT_EQ(hipMallocManaged(&dInfo, sizeof(rocblas_int)), hipSuccess);
+
+    std::copy(hA.begin(), hA.end(), dA);
+    ASSERT_EQ(rocsolver_dgetrf(handle, m, n, dA, m, dIpiv, dInfo), rocblas_status_success);
+    ASSERT_EQ(hipDeviceSynchronize(), hipSuccess);
+    EXPECT_EQ(*dInfo, 0);
+
+    for(rocblas_int i = 0; i < n; ++i)
+    {
+        ASSERT_GT(dIpiv[i], i);
+        ASSERT_LE(dIpiv[i], m);
+        for(rocblas_int j = 0; j < n; ++j)
+            std::swap(hA[i + j * size_t(m)], hA[dIpiv[i] - 1 + j * size_t(m)]);
+    }
+
+    double err = 0;
+    for(rocblas_int j = 0; j < n; ++j)
+    {
+        for(rocblas_int i = 0; i < m; ++i)
+        {
+            double lu = (i <= j) ? dA[i + j * size_t(m)] : 0;
+            for(rocblas_int l = 0; l < std::min(i, j + 1); ++l)
+                lu += dA[i + l * size_t(m)] * dA[l + j * size_t(m)];
+            err = std::max(err, std::abs(hA[i + j * size_t(m)] - lu));
+        }
+    }
+    EXPECT_LE(err, 1e-12 * n);
+
+    ASSERT_EQ(rocsolver_set_alg_mode(handle, rocsolver_function_getrf, rocsolver_alg_mode_qr),
+              rocblas_status_success);
+    EXPECT_EQ(hipFree(dA), hipSuccess);
+    EXPECT_EQ(hipFree(dIpiv), hipSuccess);
+    EXPECT_EQ(hipFree(dInfo), hipSuccess);
+}
+
+TEST_F(checkin_misc_LOGGING, rocsolver_alg_mode_compact)
+{
+    rocblas_local_handle handle;
+    const rocblas_int n = 256; // factorized by block columns
+    const rocblas_int bc = 3;
+    const rocblas_stride stA = rocblas_stride(n) * n;
+
+    // the second matrix is singular from the first column
+    std::vector<double> hA(stA * bc);
+    for(rocblas_int b = 0; b < bc; ++b)
+        for(rocblas_int j = 0; j < n; ++j)
+            for(rocblas_int i = 0; i < n; ++i)
+                hA[i + j * n + b * stA] = (b == 1 && j == 0)
+                    ? 0
+                    : std::sin(1.0 + i + 7.0 * j + 3.0 * b) + ((i == j) ? 4.0 : 0.0);
+
+    double *dA, *dR;
+    rocblas_int *dIpiv, *dInfo;
+    ASSERT_EQ(hipMallocManaged(&dA, sizeof(double) * stA * bc), hipSuccess);
+    ASSERT_EQ(hipMallocManaged(&dR, sizeof(double) * stA * bc), hipSuccess);
+    ASSERT_EQ(hipMallocManaged(&dIpiv, sizeof(rocblas_int) * n * bc), hipSuccess);
+    ASSERT_EQ(hipMallocManaged(&dInfo, sizeof(rocblas_int) * bc), hipSuccess);
+
+    // reference factorization of the whole batch
+    std::copy(hA.begin(), hA.end(), dR);
+    ASSERT_EQ(rocsolver_dgetrf_strided_batched(handle, n, n, dR, n, stA, dIpiv, n, dInfo, bc),
+              rocblas_status_success);
+    ASSERT_EQ(hipDeviceSynchronize(), hipSuccess);
+
+    ASSERT_EQ(rocsolver_set_alg_mode(handle, rocsolver_function_getrf, rocsolver_alg_mode_compact),
+              rocblas_status_success);
+    std::copy(hA.begin(), hA.end(), dA);
+    ASSERT_EQ(rocsolver_dgetrf_strided_batched(handle, n, n, dA, n, stA, dIpiv, n, dInfo, bc),
+              rocblas_status_success);
+    ASSERT_EQ(hipDeviceSynchronize(), hipSuccess);
+
+    // the singular matrix is flagged and its pivots are valid; the others are not affected
+    EXPECT_EQ(dInfo[0], 0);
+    EXPECT_EQ(dInfo[1], 1);
+    EXPECT_EQ(dInfo[2], 0);
+    for(rocblas_int i = 0; i < n * bc; ++i)
+    {
+        ASSERT_GT(dIpiv[i], i % n);
+        ASSERT_LE(dIpiv[i], n);
+    }
+    double err = 0;
+    for(rocblas_stride k = 0; k < stA; ++k)
+    {
+        err = std::max(err, std::abs(dA[k] - dR[k]));
+        err = std::max(err, std::abs(dA[k + 2 * stA] - dR[k + 2 * stA]));
+    }
+    EXPECT_LE(err, 1e-12 * n);
+
+    ASSERT_EQ(rocsolver_set_alg_mode(handle, rocsolver_function_getrf, rocsolver_alg_mode_qr),
+              rocblas_status_success);
+    EXPECT_EQ(hipFree(dA), hipSuccess);
+    EXPECT_EQ(hipFree(dR), hipSuccess);
+    EXPECT_EQ(hipFree(dIpiv), hipSuccess);
+    EXPECT_EQ(hipFree(dInfo), hipSuccess);
+}
+
+TEST_F(checkin_misc_LOGGING, rocsolver_lange_geres)
+{
+    rocblas_local_handle handle;
+    const rocblas_int m = 37, n = 29, nrhs = 3, lda = 40, ldb = 41;
+    const rocblas_int bc = 2;
+    const rocblas_stride stA = rocblas_stride(lda) * n;
+    const rocblas_stride stX = rocblas_stride(n) * nrhs;
+    const rocblas_stride stB = rocblas_stride(ldb) * nrhs;
+
+    double *dA, *dX, *dB, *dNorm;
+    ASSERT_EQ(hipMallocManaged(&dA, sizeof(double) * stA * bc), hipSuccess);
+    ASSERT_EQ(hipMallocManaged(&dX, sizeof(double) * stX * bc), hipSuccess);
+    ASSERT_EQ(hipMallocManaged(&dB, sizeof(double) * stB * bc), hipSuccess);
+    ASSERT_EQ(hipMallocManaged(&dNorm, sizeof(double) * bc), hipSuccess);
+    for(rocblas_stride k = 0; k < stA * bc; ++k)
+        dA[k] = std::sin(1.0 + 3.0 * k);
+    for(rocblas_stride k = 0; k < stX * bc; ++k)
+        dX[k] = std::cos(2.0 + 5.0 * k);
+    for(rocblas_stride k = 0; k < stB * bc; ++k)
+        dB[k] = std::sin(4.0 + 7.0 * k);
+
+    // norms of the general matrices
+    for(rocsolver_norm_type norm :
+        {rocsolver_norm_max, rocsolver_norm_one, rocsolver_norm_inf, rocsolver_norm_frobenius})
+    {
+        ASSERT_EQ(rocsolver_dlange_strided_batched(handle, norm, m, n, dA, lda, stA, dNorm, bc),
+                  rocblas_status_success);
+        ASSERT_EQ(hipDeviceSynchronize(), hipSuccess);
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            std::vector<double> rows(m, 0), cols(n, 0);
+            double amax = 0, ssq = 0;
+            for(rocblas_int j = 0; j < n; ++j)
+                for(rocblas_int i = 0; i < m; ++i)
+                {
+                    double a = std::abs(dA[i + j * lda + b * stA]);
+                    rows[i] += a;
+                    cols[j] += a;
+                    amax = std::max(amax, a);
+                    ssq += a * a;
+                }
+            double expected = std::sqrt(ssq);
+            if(norm == rocsolver_norm_max)
+                expected = amax;
+            else if(norm == rocsolver_norm_one)
+                expected = *std::max_element(cols.begin(), cols.end());
+            else if(norm == rocsolver_norm_inf)
+                expected = *std::max_element(rows.begin(), rows.end());
+            EXPECT_NEAR(dNorm[b], expected, 1e-13 * expected);
+        }
+    }
+
+    // only the lower triangular part of a symmetric matrix is referenced
+    ASSERT_EQ(rocsolver_dlansy(handle, rocsolver_norm_frobenius, rocblas_fill_lower, n, dA, lda,
+                               dNorm),
+              rocblas_status_success);
+    ASSERT_EQ(hipDeviceSynchronize(), hipSuccess);
+    double ssq = 0;
+    for(rocblas_int j = 0; j < n; ++j)
+        for(rocblas_int i = j; i < n; ++i)
+            ssq += (i == j ? 1 : 2) * dA[i + j * lda] * dA[i + j * lda];
+    EXPECT_NEAR(dNorm[0], std::sqrt(ssq), 1e-13 * std::sqrt(ssq));
+
+    // the residuals overwrite B and their max norms are returned
+    std::vector<double> hR(stB * bc);
+    for(rocblas_int b = 0; b < bc; ++b)
+        for(rocblas_int j = 0; j < nrhs; ++j)
+            for(rocblas_int i = 0; i < m; ++i)
+            {
+                double r = dB[i + j * ldb + b * stB];
+                for(rocblas_int k = 0; k < n; ++k)
+                    r -= dA[i + k * lda + b * stA] * dX[k + j * n + b * stX];
+                hR[i + j * ldb + b * stB] = r;
+            }
+    ASSERT_EQ(rocsolver_dgeres_strided_batched(handle, m, n, nrhs, dA, lda, stA, dX, n, stX, dB,
+                                               ldb, stB, dNorm, bc),
+              rocblas_status_success);
+    ASSERT_EQ(hipDeviceSynchronize(), hipSuccess);
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        double rmax = 0;
+        for(rocblas_int j = 0; j < nrhs; ++j)
+            for(rocblas_int i = 0; i < m; ++i)
+            {
+                double r = hR[i + j * ldb + b * stB];
+                EXPECT_NEAR(dB[i + j * ldb + b * stB], r, 1e-13 * n);
+                rmax = std::max(rmax, std::abs(r));
+            }
+        EXPECT_NEAR(dNorm[b], rmax, 1e-13 * n);
+    }
+
+    EXPECT_EQ(hipFree(dA), hipSuccess);
+    EXPECT_EQ(hipFree(dX), hipSuccess);
+    EXPECT_EQ(hipFree(dB), hipSuccess);
+    EXPECT_EQ(hipFree(dNorm), hipSuccess);
+}
+
+TEST_F(checkin_misc_LOGGING, rocsolver_csrrf_reorder_symbolic)
+{
+    rocblas_local_handle handle;
+    const rocblas_int g = 20, n = g * g;
+
+    // 5-point stencil on a g x g grid, with the nodes numbered in scrambled order
+    std::vector<std::vector<rocblas_int>> rows(n);
+    for(rocblas_int x = 0; x < g; ++x)
+        for(rocblas_int y = 0; y < g; ++y)
+        {
+            auto id = [&](rocblas_int a, rocblas_int b) { return ((a * g + b) * 7 + 3) % n; };
+            auto& r = rows[id(x, y)];
+            r.push_back(id(x, y));
+            if(x > 0)
+                r.push_back(id(x - 1, y));
+            if(x < g - 1)
+                r.push_back(id(x + 1, y));
+            if(y > 0)
+                r.push_back(id(x, y - 1));
+            if(y < g - 1)
+                r.push_back(id(x, y + 1));
+            std::sort(r.begin(), r.end());
+        }
+    const rocblas_int nnzM = 5 * n - 4 * g;
+
+    rocblas_int *ptrM, *indM, *perm, *ptrT, *indT;
+    ASSERT_EQ(hipMallocManaged(&ptrM, sizeof(rocblas_int) * (n + 1)), hipSuccess);
+    ASSERT_EQ(hipMallocManaged(&indM, sizeof(rocblas_int) * nnzM), hipSuccess);
+    ASSERT_EQ(hipMallocManaged(&perm, sizeof(rocblas_int) * n), hipSuccess);
+    ASSERT_EQ(hipMallocManaged(&ptrT, sizeof(rocblas_int) * (n + 1)), hipSuccess);
+    ptrM[0] = 0;
+    for(rocblas_int i = 0; i < n; ++i)
+    {
+        std::copy(rows[i].begin(), rows[i].end(), indM + ptrM[i]);
+        ptrM[i + 1] = ptrM[i] + rows[i].size();
+    }
+    ASSERT_EQ(ptrM[n], nnzM);
+
+    // the reverse Cuthill-McKee ordering recovers the bandwidth of the natural ordering
+    ASSERT_EQ(rocsolver_csrrf_reorder(handle, n, nnzM, ptrM, indM, perm), rocblas_status_success);
+    ASSERT_EQ(hipDeviceSynchronize(), hipSuccess);
+    std::vector<rocblas_int> iperm(n, -1);
+    for(rocblas_int k = 0; k < n; ++k)
+    {
+        ASSERT_TRUE(perm[k] >= 0 && perm[k] < n && iperm[perm[k]] < 0);
+        iperm[perm[k]] = k;
+    }
+    rocblas_int bw = 0;
+    for(rocblas_int i = 0; i < n; ++i)
+        for(rocblas_int j : rows[i])
+            bw = std::max(bw, std::abs(iperm[i] - iperm[j]));
+    EXPECT_LE(bw, g + 1);
+
+    // envelope of the re-ordered matrix (the suffix minimum of its first columns)
+    std::vector<rocblas_int> first(n);
+    for(rocblas_int k = 0; k < n; ++k)
+    {
+        first[k] = k;
+        for(rocblas_int j : rows[perm[k]])
+            first[k] = std::min(first[k], iperm[j]);
+    }
+    for(rocblas_int k = n - 2; k >= 0; --k)
+        first[k] = std::min(first[k], first[k + 1]);
+
+    // first call computes ptrT only
+    ASSERT_EQ(rocsolver_csrrf_symbolic(handle, n, nnzM, ptrM, indM, perm, ptrT, nullptr),
+              rocblas_status_success);
+    ASSERT_EQ(hipDeviceSynchronize(), hipSuccess);
+    const rocblas_int nnzT = ptrT[n];
+    ASSERT_GE(nnzT, nnzM);
+    ASSERT_EQ(hipMallocManaged(&indT, sizeof(rocblas_int) * nnzT), hipSuccess);
+    ASSERT_EQ(rocsolver_csrrf_symbolic(handle, n, nnzM, ptrM, indM, perm, ptrT, indT),
+              rocblas_status_success);
+    ASSERT_EQ(hipDeviceSynchronize(), hipSuccess);
+
+    EXPECT_EQ(ptrT[0], 0);
+    for(rocblas_int i = 0; i < n; ++i)
+    {
+        rocblas_int last = i;
+        while(last < n - 1 && first[last + 1] <= i)
+            ++last;
+        ASSERT_EQ(ptrT[i + 1] - ptrT[i], last - first[i] + 1);
+        for(rocblas_int k = ptrT[i]; k < ptrT[i + 1]; ++k)
+            EXPECT_EQ(indT[k], first[i] + (k - ptrT[i]));
+    }
+
+    EXPECT_EQ(hipFree(ptrM), hipSuccess);
+    EXPECT_EQ(hipFree(indM), hipSuccess);
+    EXPECT_EQ(hipFree(perm), hipSuccess);
+    EXPECT_EQ(hipFree(ptrT), hipSuccess);
+    EXPECT_EQ(hipFree(indT), hipSuccess);
+}
+
+TEST_F(checkin_misc_LOGGING, rocsolver_csrrf_qr)
+{
+    rocblas_local_handle handle;
+    const rocblas_int m = 60, n = 30, nrhs = 2, ldb = m, ldx = n;
+
+    // tall sparse matrix: a shifted bidiagonal block on top of a scattered block
+    std::vector<std::vector<std::pair<rocblas_int, double>>> rows(m);
+    for(rocblas_int i = 0; i < n; ++i)
+    {
+        rows[i].push_back({i, 2.0 + double(i) / n});
+        if(i < n - 1)
+            rows[i].push_back({i + 1, -1.0});
+        rows[n + i].push_back({(7 * i) % n, 1.0});
+        rows[n + i].push_back({(7 * i + 11) % n, 0.5});
+        std::sort(rows[n + i].begin(), rows[n + i].end());
+    }
+    rocblas_int nnzA = 0;
+    for(auto& r : rows)
+        nnzA += r.size();
+
+    // the lower triangular part of T holds the pattern of R', here the full lower triangle
+    const rocblas_int nnzT = n * (n + 1) / 2;
+
+    rocblas_int *ptrA, *indA, *ptrT, *indT, *pivQ;
+    double *valA, *valT, *B, *X;
+    ASSERT_EQ(hipMallocManaged(&ptrA, sizeof(rocblas_int) * (m + 1)), hipSuccess);
+    ASSERT_EQ(hipMallocManaged(&indA, sizeof(rocblas_int) * nnzA), hipSuccess);
+    ASSERT_EQ(hipMallocManaged(&valA, sizeof(double) * nnzA), hipSuccess);
+    ASSERT_EQ(hipMallocManaged(&ptrT, sizeof(rocblas_int) * (n + 1)), hipSuccess);
+    ASSERT_EQ(hipMallocManaged(&indT, sizeof(rocblas_int) * nnzT), hipSuccess);
+    ASSERT_EQ(hipMallocManaged(&valT, sizeof(double) * nnzT), hipSuccess);
+    ASSERT_EQ(hipMallocManaged(&pivQ, sizeof(rocblas_int) * n), hipSuccess);
+    ASSERT_EQ(hipMallocManaged(&B, sizeof(double) * ldb * nrhs), hipSuccess);
+    ASSERT_EQ(hipMallocManaged(&X, sizeof(double) * ldx * nrhs), hipSuccess);
+    ptrA[0] = 0;
+    for(rocblas_int i = 0; i < m; ++i)
+    {
+        ptrA[i + 1] = ptrA[i];
+        for(auto& e : rows[i])
+        {
+            indA[ptrA[i + 1]] = e.first;
+            valA[ptrA[i + 1]++] = e.second;
+        }
+    }
+    ptrT[0] = 0;
+    for(rocblas_int i = 0; i < n; ++i)
+    {
+        for(rocblas_int j = 0; j <= i; ++j)
+            indT[ptrT[i] + j] = j;
+        ptrT[i + 1] = ptrT[i] + i + 1;
+        pivQ[i] = n - 1 - i;
+    }
+    for(rocblas_int k = 0; k < ldb * nrhs; ++k)
+        B[k] = std::sin(double(k + 1));
+
+    for(rocsolver_rfinfo_solve_mode solve_mode :
+        {rocsolver_rfinfo_solve_mode_rocsparse, rocsolver_rfinfo_solve_mode_levels})
+    {
+        rocsolver_rfinfo rfinfo;
+        ASSERT_EQ(rocsolver_create_rfinfo(&rfinfo, handle), rocblas_status_success);
+        ASSERT_EQ(rocsolver_set_rfinfo_mode(rfinfo, rocsolver_rfinfo_mode_qr),
+                  rocblas_status_success);
+        ASSERT_EQ(rocsolver_set_rfinfo_solve_mode(rfinfo, solve_mode), rocblas_status_success);
+
+        // CSRRF_ANALYSIS does not work with the QR mode
+        EXPECT_EQ(rocsolver_dcsrrf_analysis(handle, n, nrhs, nnzT, ptrT, indT, valT, nnzT, ptrT,
+                                            indT, valT, pivQ, pivQ, B, n, rfinfo),
+                  rocblas_status_invalid_value);
+
+        ASSERT_EQ(rocsolver_dcsrrf_analysisqr(handle, m, n, nrhs, nnzA, ptrA, indA, nnzT, ptrT,
+                                              indT, valT, pivQ, B, ldb, rfinfo),
+                  rocblas_status_success);
+        ASSERT_EQ(rocsolver_dcsrrf_refactqr(handle, m, n, nnzA, ptrA, indA, valA, nnzT, ptrT,
+                                            indT, valT, pivQ, rfinfo),
+                  rocblas_status_success);
+        ASSERT_EQ(rocsolver_dcsrrf_solveqr(handle, m, n, nrhs, nnzA, ptrA, indA, valA, nnzT, ptrT,
+                                           indT, valT, pivQ, B, ldb, X, ldx, rfinfo),
+                  rocblas_status_success);
+        ASSERT_EQ(hipDeviceSynchronize(), hipSuccess);
+
+        // the residuals of the least-squares solutions are orthogonal to the columns of A
+        for(rocblas_int j = 0; j < nrhs; ++j)
+        {
+            std::vector<double> g(n, 0);
+            for(rocblas_int i = 0; i < m; ++i)
+            {
+                double r = B[i + j * ldb];
+                for(auto& e : rows[i])
+                    r -= e.second * X[e.first + j * ldx];
+                for(auto& e : rows[i])
+                    g[e.first] += e.second * r;
+            }
+            for(rocblas_int k = 0; k < n; ++k)
+                EXPECT_NEAR(g[k], 0.0, 1e-12);
+        }
+
+        EXPECT_EQ(rocsolver_destroy_rfinfo(rfinfo), rocblas_status_success);
+    }
+
+    EXPECT_EQ(hipFree(ptrA), hipSuccess);
+    EXPECT_EQ(hipFree(indA), hipSuccess);
+    EXPECT_EQ(hipFree(valA), hipSuccess);
+    EXPECT_EQ(hipFree(ptrT), hipSuccess);
+    EXPECT_EQ(hipFree(indT), hipSuccess);
+    EXPECT_EQ(hipFree(valT), hipSuccess);
+    EXPECT_EQ(hipFree(pivQ), hipSuccess);
+    EXPECT_EQ(hipFree(B), hipSuccess);
+    EXPECT_EQ(hipFree(X), hipSuccess);
+}
+
+TEST_F(checkin_misc_LOGGING, rocsolver_csrrf_static_pivoting)
+{
+    rocblas_local_handle handle;
+    const rocblas_int n = 3, nnz = 7, nrhs = 1;
+
+    // tridiagonal matrix with a zero second pivot (without pivoting), and P = Q = I
+    const rocblas_int hptr[] = {0, 2, 5, 7};
+    const rocblas_int hind[] = {0, 1, 0, 1, 2, 1, 2};
+    const double hval[] = {1, 1, 1, 1, 1, 1, 2};
+    const double hb[] = {1, 2, 3};
+
+    rocblas_int *ptrA, *indA, *piv, *npert;
+    double *valA, *valT, *B;
+    ASSERT_EQ(hipMallocManaged(&ptrA, sizeof(rocblas_int) * (n + 1)), hipSuccess);
+    ASSERT_EQ(hipMallocManaged(&indA, sizeof(rocblas_int) * nnz), hipSuccess);
+    ASSERT_EQ(hipMallocManaged(&piv, sizeof(rocblas_int) * n), hipSuccess);
+    ASSERT_EQ(hipMallocManaged(&npert, sizeof(rocblas_int)), hipSuccess);
+    ASSERT_EQ(hipMallocManaged(&valA, sizeof(double) * nnz), hipSuccess);
+    ASSERT_EQ(hipMallocManaged(&valT, sizeof(double) * nnz), hipSuccess);
+    ASSERT_EQ(hipMallocManaged(&B, sizeof(double) * n), hipSuccess);
+    std::copy(hptr, hptr + n + 1, ptrA);
+    std::copy(hind, hind + nnz, indA);
+    std::copy(hval, hval + nnz, valA);
+    std::copy(hval, hval + nnz, valT);
+    for(rocblas_int i = 0; i < n; ++i)
+        piv[i] = i;
+
+    for(rocsolver_rfinfo_refact_mode refact_mode :
+        {rocsolver_rfinfo_refact_mode_rocsparse, rocsolver_rfinfo_refact_mode_supernodal})
+    {
+        rocsolver_rfinfo rfinfo;
+        ASSERT_EQ(rocsolver_create_rfinfo(&rfinfo, handle), rocblas_status_success);
+        ASSERT_EQ(rocsolver_set_rfinfo_refact_mode(rfinfo, refact_mode), rocblas_status_success);
+        ASSERT_EQ(rocsolver_set_rfinfo_solve_mode(rfinfo, rocsolver_rfinfo_solve_mode_levels),
+                  rocblas_status_success);
+
+        double threshold = -1;
+        EXPECT_EQ(rocsolver_set_rfinfo_pivot_threshold(rfinfo, -1e-4),
+                  rocblas_status_invalid_value);
+        ASSERT_EQ(rocsolver_get_rfinfo_pivot_threshold(rfinfo, &threshold),
+                  rocblas_status_success);
+        EXPECT_EQ(threshold, 0.0);
+        ASSERT_EQ(rocsolver_set_rfinfo_pivot_threshold(rfinfo, 1e-4), rocblas_status_success);
+
+        // (the analysis only uses the sparsity pattern of the factors in T)
+        ASSERT_EQ(rocsolver_dcsrrf_analysis(handle, n, nrhs, nnz, ptrA, indA, valA, nnz, ptrA,
+                                            indA, valT, piv, piv, B, n, rfinfo),
+                  rocblas_status_success);
+        ASSERT_EQ(rocsolver_dcsrrf_refactlu(handle, n, nnz, ptrA, indA, valA, nnz, ptrA, indA,
+                                            valT, piv, piv, rfinfo),
+                  rocblas_status_success);
+        npert[0] = -1;
+        ASSERT_EQ(rocsolver_get_rfinfo_perturbed_pivots(handle, rfinfo, npert),
+                  rocblas_status_success);
+
+        // the solution of the perturbed system is refined with the original matrix
+        std::copy(hb, hb + n, B);
+        ASSERT_EQ(rocsolver_dcsrrf_solve(handle, n, nrhs, nnz, ptrA, indA, valT, piv, piv, B, n,
+                                         rfinfo),
+                  rocblas_status_success);
+        ASSERT_EQ(hipDeviceSynchronize(), hipSuccess);
+        EXPECT_EQ(npert[0], 1);
+        for(rocblas_int i = 0; i < n; ++i)
+        {
+            double r = hb[i];
+            for(rocblas_int k = hptr[i]; k < hptr[i + 1]; ++k)
+                r -= hval[k] * B[hind[k]];
+            EXPECT_NEAR(r, 0.0, 1e-12);
+        }
+
+        EXPECT_EQ(rocsolver_destroy_rfinfo(rfinfo), rocblas_status_success);
+    }
+
+    EXPECT_EQ(hipFree(ptrA), hipSuccess);
+    EXPECT_EQ(hipFree(indA), hipSuccess);
+    EXPECT_EQ(hipFree(piv), hipSuccess);
+    EXPECT_EQ(hipFree(npert), hipSuccess);
+    EXPECT_EQ(hipFree(valA), hipSuccess);
+    EXPECT_EQ(hipFree(valT), hipSuccess);
+    EXPECT_EQ(hipFree(B), hipSuccess);
+}
+
+TEST_F(checkin_misc_LOGGING, rocsolver_set_info_summary)
+{
+    rocblas_local_handle handle;
+    const rocblas_int n = 3;
+    const rocblas_int bc = 4;
+    const rocblas_stride stA = n * n;
+
+    double* A;
+    rocblas_int* info;
+    rocsolver_info_summary* summary;
+    ASSERT_EQ(hipMallocManaged(&A, sizeof(double) * stA * bc), hipSuccess);
+    ASSERT_EQ(hipMallocManaged(&info, sizeof(rocblas_int) * bc), hipSuccess);
+    ASSERT_EQ(hipMallocManaged(&summary, sizeof(rocsolver_info_summary)), hipSuccess);
+
+    EXPECT_EQ(rocsolver_set_info_summary(nullptr, summary), rocblas_status_invalid_handle);
+
+    // identity matrices, with the leading element of problems 1 and 3 made negative
+    auto set_matrices = [&](bool indefinite) {
+        std::fill(A, A + stA * bc, 0.0);
+        for(rocblas_int b = 0; b < bc; ++b)
+            for(rocblas_int i = 0; i < n; ++i)
+                A[b * stA + i + i * n] = 1.0;
+        if(indefinite)
+        {
+            A[1 * stA] = -1.0;
+            A[3 * stA] = -1.0;
+        }
+    };
+
+    ASSERT_EQ(rocsolver_set_info_summary(handle, summary), rocblas_status_success);
+    set_matrices(true);
+    EXPECT_EQ(rocsolver_dpotrf_strided_batched(handle, rocblas_fill_upper, n, A, n, stA, info, bc),
+              rocblas_status_success);
+    ASSERT_EQ(hipDeviceSynchronize(), hipSuccess);
+    EXPECT_EQ(summary->failures, 2);
+    EXPECT_EQ(summary->first, 1);
+    EXPECT_EQ(summary->first_info, 1);
+    EXPECT_EQ(summary->sequence, 1u);
+
+    set_matrices(false);
+    EXPECT_EQ(rocsolver_dpotrf_strided_batched(handle, rocblas_fill_upper, n, A, n, stA, info, bc),
+              rocblas_status_success);
+    ASSERT_EQ(hipDeviceSynchronize(), hipSuccess);
+    EXPECT_EQ(summary->failures, 0);
+    EXPECT_EQ(summary->first, -1);
+    EXPECT_EQ(summary->first_info, 0);
+    EXPECT_EQ(summary->sequence, 2u);
+
+    // the summary is not written once the buffer is unregistered
+    ASSERT_EQ(rocsolver_set_info_summary(handle, nullptr), rocblas_status_success);
+    set_matrices(true);
+    EXPECT_EQ(rocsolver_dpotrf_strided_batched(handle, rocblas_fill_upper, n, A, n, stA, info, bc),
+              rocblas_status_success);
+    ASSERT_EQ(hipDeviceSynchronize(), hipSuccess);
+    EXPECT_EQ(summary->failures, 0);
+    EXPECT_EQ(summary->first, -1);
+
+    EXPECT_EQ(hipFree(A), hipSuccess);
+    EXPECT_EQ(hipFree(info), hipSuccess);
+    EXPECT_EQ(hipFree(summary), hipSuccess);
+}
+
+TEST_F(checkin_misc_LOGGING, rocsolver_set_info_callback)
+{
+    rocblas_local_handle handle;
+    const rocblas_int n = 4;
+    std::atomic<int> calls{0};
+
+    rocsolver_info_callback callback = [](const rocsolver_info_summary* summary, void* data) {
+        if(summary->sequence > 0)
+            static_cast<std::atomic<int>*>(data)->fetch_add(1);
+    };
+
+    double *A, *W, *residual;
+    rocblas_int *ipiv, *info, *n_sweeps;
+    rocsolver_info_summary* summary;
+    ASSERT_EQ(hipMallocManaged(&A, sizeof(double) * n * n), hipSuccess);
+    ASSERT_EQ(hipMallocManaged(&W, sizeof(double) * n), hipSuccess);
+    ASSERT_EQ(hipMallocManaged(&residual, sizeof(double)), hipSuccess);
+    ASSERT_EQ(hipMallocManaged(&ipiv, sizeof(rocblas_int) * n), hipSuccess);
+    ASSERT_EQ(hipMallocManaged(&info, sizeof(rocblas_int)), hipSuccess);
+    ASSERT_EQ(hipMallocManaged(&n_sweeps, sizeof(rocblas_int)), hipSuccess);
+    ASSERT_EQ(hipHostMalloc(&summary, sizeof(rocsolver_info_summary)), hipSuccess);
+
+    EXPECT_EQ(rocsolver_set_info_callback(nullptr, callback, &calls),
+              rocblas_status_invalid_handle);
+    // a summary buffer is required
+    EXPECT_EQ(rocsolver_set_info_callback(handle, callback, &calls),
+              rocblas_status_invalid_value);
+
+    ASSERT_EQ(rocsolver_set_info_summary(handle, summary), rocblas_status_success);
+    ASSERT_EQ(rocsolver_set_info_callback(handle, callback, &calls), rocblas_status_success);
+
+    // a singular matrix (zero column 2) for the non-batched GETRF
+    std::fill(A, A + n * n, 0.0);
+    for(rocblas_int i = 0; i < n; ++i)
+        A[i + i * n] = (i == 2 ? 0.0 : 2.0);
+    EXPECT_EQ(rocsolver_dgetrf(handle, n, n, A, n, ipiv, info), rocblas_status_success);
+
+    // the host polls the summary in pinned memory instead of synchronizing the stream
+    volatile rocsolver_info_summary* vsummary = summary;
+    for(int k = 0; k < 100000 && vsummary->sequence < 1; ++k)
+        std::this_thread::yield();
+    ASSERT_EQ(hipDeviceSynchronize(), hipSuccess);
+    EXPECT_EQ(summary->sequence, 1u);
+    EXPECT_EQ(summary->failures, 1);
+    EXPECT_EQ(summary->first, 0);
+    EXPECT_EQ(summary->first_info, 3);
+    EXPECT_EQ(calls.load(), 1);
+
+    // the calls that fail the argument checks leave the summary and its sequence unchanged, and
+    // do not call the callback
+    EXPECT_EQ(rocsolver_dgetrf(handle, -1, n, A, n, ipiv, info), rocblas_status_invalid_size);
+    EXPECT_EQ(rocsolver_dgetrf_strided_batched(handle, n, n, A, n - 1, n * n, ipiv, n, info, 1),
+              rocblas_status_invalid_size);
+    ASSERT_EQ(hipDeviceSynchronize(), hipSuccess);
+    EXPECT_EQ(summary->sequence, 1u);
+    EXPECT_EQ(summary->failures, 1);
+    EXPECT_EQ(summary->first, 0);
+    EXPECT_EQ(summary->first_info, 3);
+    EXPECT_EQ(calls.load(), 1);
+
+    // the Jacobi functions also report their sweeps and residuals
+    std::fill(A, A + n * n, 0.0);
+    for(rocblas_int i = 0; i < n; ++i)
+    {
+        A[i + i * n] = 2.0;
+        if(i > 0)
+            A[i + (i - 1) * n] = A[i - 1 + i * n] = 1.0;
+    }
+    EXPECT_EQ(rocsolver_dsyevj(handle, rocblas_esort_ascending, rocblas_evect_none,
+                               rocblas_fill_upper, n, A, n, 1e-12, residual, 100, n_sweeps, W,
+                               info),
+              rocblas_status_success);
+    ASSERT_EQ(hipDeviceSynchronize(), hipSuccess);
+    EXPECT_EQ(summary->sequence, 2u);
+    EXPECT_EQ(summary->failures, 0);
+    EXPECT_EQ(summary->max_sweeps, *n_sweeps);
+    EXPECT_GT(summary->max_sweeps, 0);
+    EXPECT_EQ(summary->max_residual, *residual);
+    EXPECT_EQ(calls.load(), 2);
+
+    // the callback is not called once it is removed
+    ASSERT_EQ(rocsolver_set_info_callback(handle, nullptr, nullptr), rocblas_status_success);
+    EXPECT_EQ(rocsolver_dgetrf(handle, n, n, A, n, ipiv, info), rocblas_status_success);
+    ASSERT_EQ(hipDeviceSynchronize(), hipSuccess);
+    EXPECT_EQ(summary->sequence, 3u);
+    EXPECT_EQ(calls.load(), 2);
+
+    ASSERT_EQ(rocsolver_set_info_summary(handle, nullptr), rocblas_status_success);
+    EXPECT_EQ(hipFree(A), hipSuccess);
+    EXPECT_EQ(hipFree(W), hipSuccess);
+    EXPECT_EQ(hipFree(residual), hipSuccess);
+    EXPECT_EQ(hipFree(ipiv), hipSuccess);
+    EXPECT_EQ(hipFree(info), hipSuccess);
+    EXPECT_EQ(hipFree(n_sweeps), hipSuccess);
+    EXPECT_EQ(hipHostFree(summary), hipSuccess);
+}
+
+TEST_F(checkin_misc_LOGGING, rocsolver_values_only_workspace)
+{
+    rocblas_local_handle handle;
+    const rocblas_int n = 200, bc = 64;
+    const rocblas_stride stA = n * n, st = n;
+    const rocblas_evect none = rocblas_evect_none, orig = rocblas_evect_original;
+    const rocblas_svect svn = rocblas_svect_none, svs = rocblas_svect_singular;
+    const rocblas_fill lo = rocblas_fill_lower;
+    rocblas_int nev;
+
+    // without vectors, the workspace of every batch instance must not include an n-by-n array
+    // (the bound is half of it), while the vector computations do require it
+    const size_t bound = sizeof(double) * n * n * bc / 2;
+    size_t size_n, size_v;
+
+    ASSERT_EQ(rocblas_start_device_memory_size_query(handle), rocblas_status_success);
+    rocsolver_dsyevd_strided_batched(handle, none, lo, n, nullptr, n, stA, nullptr, st, nullptr,
+                                     st, nullptr, bc);
+    ASSERT_EQ(rocblas_stop_device_memory_size_query(handle, &size_n), rocblas_status_success);
+    ASSERT_EQ(rocblas_start_device_memory_size_query(handle), rocblas_status_success);
+    rocsolver_dsyevd_strided_batched(handle, orig, lo, n, nullptr, n, stA, nullptr, st, nullptr,
+                                     st, nullptr, bc);
+    ASSERT_EQ(rocblas_stop_device_memory_size_query(handle, &size_v), rocblas_status_success);
+    EXPECT_LT(size_n, bound);
+    EXPECT_GT(size_v, bound);
+
+    ASSERT_EQ(rocblas_start_device_memory_size_query(handle), rocblas_status_success);
+    rocsolver_dsyevdx_strided_batched(handle, none, rocblas_erange_all, lo, n, nullptr, n, stA, 0,
+                                      0, 0, 0, &nev, nullptr, st, nullptr, n, stA, nullptr, bc);
+    ASSERT_EQ(rocblas_stop_device_memory_size_query(handle, &size_n), rocblas_status_success);
+    EXPECT_LT(size_n, bound);
+
+    ASSERT_EQ(rocblas_start_device_memory_size_query(handle), rocblas_status_success);
+    rocsolver_dgesvdx_strided_batched(handle, svn, svn, rocblas_srange_all, n, n, nullptr, n, stA,
+                                      0, 0, 0, 0, &nev, nullptr, st, nullptr, n, stA, nullptr, n,
+                                      stA, nullptr, st, nullptr, bc);
+    ASSERT_EQ(rocblas_stop_device_memory_size_query(handle, &size_n), rocblas_status_success);
+    ASSERT_EQ(rocblas_start_device_memory_size_query(handle), rocblas_status_success);
+    rocsolver_dgesvdx_strided_batched(handle, svs, svs, rocblas_srange_all, n, n, nullptr, n, stA,
+                                      0, 0, 0, 0, &nev, nullptr, st, nullptr, n, stA, nullptr, n,
+                                      stA, nullptr, st, nullptr, bc);
+    ASSERT_EQ(rocblas_stop_device_memory_size_query(handle, &size_v), rocblas_status_success);
+    EXPECT_LT(size_n, bound);
+    EXPECT_GT(size_v, bound);
+}
+
+TEST_F(checkin_misc_LOGGING, rocsolver_potrf_ooc)
+{
+    rocblas_local_handle handle;
+    const rocblas_int nn = 2500; // more than two block columns of the smallest width
+    rocblas_int* dInfo;
+    double *hA, *dR;
+    ASSERT_EQ(hipHostMalloc(&hA, sizeof(double) * nn * nn), hipSuccess);
+    ASSERT_EQ(hipMallocManaged(&dR, sizeof(double) * nn * nn), hipSuccess);
+    ASSERT_EQ(hipMallocManaged(&dInfo, sizeof(rocblas_int)), hipSuccess);
+
+    // the out-of-core factorization of a matrix in host memory is the same as with POTRF
+    for(rocblas_fill uplo : {rocblas_fill_lower, rocblas_fill_upper})
+    {
+        for(rocblas_int j = 0; j < nn; ++j)
+            for(rocblas_int i = 0; i < nn; ++i)
+                hA[i + j * size_t(nn)] = dR[i + j * size_t(nn)] = (i == j) ? nn : 1.0 / (1 + i + j);
+
+        ASSERT_EQ(rocsolver_dpotrf(handle, uplo, nn, dR, nn, dInfo), rocblas_status_success);
+        ASSERT_EQ(hipDeviceSynchronize(), hipSuccess);
+        EXPECT_EQ(*dInfo, 0);
+
+        *dInfo = -1;
+        ASSERT_EQ(rocsolver_dpotrf_ooc(handle, uplo, nn, hA, nn, dInfo), rocblas_status_success);
+        ASSERT_EQ(hipDeviceSynchronize(), hipSuccess);
+        EXPECT_EQ(*dInfo, 0);
+
+        double err = 0;
+        for(size_t k = 0; k < size_t(nn) * nn; ++k)
+            err = std::max(err, std::abs(hA[k] - dR[k]));
+        EXPECT_LE(err, 1e-12 * nn);
+    }
+
+    // non-positive-definiteness is reported for the leading minor of the full matrix
+    for(rocblas_int j = 0; j < nn; ++j)
+        for(rocblas_int i = 0; i < nn; ++i)
+            hA[i + j * size_t(nn)] = (i == j) ? (i == 2000 ? -1.0 : nn) : 0.0;
+    ASSERT_EQ(rocsolver_dpotrf_ooc(handle, rocblas_fill_lower, nn, hA, nn, dInfo),
+              rocblas_status_success);
+    ASSERT_EQ(hipDeviceSynchronize(), hipSuccess);
+    EXPECT_EQ(*dInfo, 2001);
+
+    EXPECT_EQ(hipHostFree(hA), hipSuccess);
+    EXPECT_EQ(hipFree(dR), hipSuccess);
+    EXPECT_EQ(hipFree(dInfo), hipSuccess);
+}
+
+TEST_F(checkin_misc_LOGGING, rocsolver_potrf_tile)
+{
+    rocblas_local_handle handle;
+    const rocblas_int nn = 1000;
+    const rocblas_int nb = 192; // the last tile row and column are padded
+    const rocblas_int nt = (nn - 1) / nb + 1;
+    rocblas_int* dInfo;
+    double *dA, *dR, *dT;
+    ASSERT_EQ(hipMallocManaged(&dA, sizeof(double) * nn * nn), hipSuccess);
+    ASSERT_EQ(hipMallocManaged(&dR, sizeof(double) * nn * nn), hipSuccess);
+    ASSERT_EQ(hipMallocManaged(&dT, sizeof(double) * nt * nt * nb * nb), hipSuccess);
+    ASSERT_EQ(hipMallocManaged(&dInfo, sizeof(rocblas_int)), hipSuccess);
+
+    // the factorization in the tile layout is the same as with POTRF
+    for(rocblas_fill uplo : {rocblas_fill_lower, rocblas_fill_upper})
+    {
+        for(rocblas_int j = 0; j < nn; ++j)
+            for(rocblas_int i = 0; i < nn; ++i)
+                dA[i + j * size_t(nn)] = dR[i + j * size_t(nn)] = (i == j) ? nn : 1.0 / (1 + i + j);
+
+        ASSERT_EQ(rocsolver_dpotrf(handle, uplo, nn, dR, nn, dInfo), rocblas_status_success);
+        ASSERT_EQ(hipDeviceSynchronize(), hipSuccess);
+        EXPECT_EQ(*dInfo, 0);
+
+        *dInfo = -1;
+        ASSERT_EQ(rocsolver_dge2tile(handle, nn, nn, nb, dA, nn, dT), rocblas_status_success);
+        ASSERT_EQ(rocsolver_dpotrf_tile(handle, uplo, nn, nb, dT, dInfo), rocblas_status_success);
+        ASSERT_EQ(rocsolver_dtile2ge(handle, nn, nn, nb, dT, dA, nn), rocblas_status_success);
+        ASSERT_EQ(hipDeviceSynchronize(), hipSuccess);
+        EXPECT_EQ(*dInfo, 0);
+
+        double err = 0;
+        for(size_t k = 0; k < size_t(nn) * nn; ++k)
+            err = std::max(err, std::abs(dA[k] - dR[k]));
+        EXPECT_LE(err, 1e-12 * nn);
+    }
+
+    // non-positive-definiteness is reported for the leading minor of the full matrix
+    for(rocblas_int j = 0; j < nn; ++j)
+        for(rocblas_int i = 0; i < nn; ++i)
+            dA[i + j * size_t(nn)] = (i == j) ? (i == 700 ? -1.0 : nn) : 0.0;
+    ASSERT_EQ(rocsolver_dge2tile(handle, nn, nn, nb, dA, nn, dT), rocblas_status_success);
+    ASSERT_EQ(rocsolver_dpotrf_tile(handle, rocblas_fill_lower, nn, nb, dT, dInfo),
+              rocblas_status_success);
+    ASSERT_EQ(hipDeviceSynchronize(), hipSuccess);
+    EXPECT_EQ(*dInfo, 701);
+
+    EXPECT_EQ(hipFree(dA), hipSuccess);
+    EXPECT_EQ(hipFree(dR), hipSuccess);
+    EXPECT_EQ(hipFree(dT), hipSuccess);
+    EXPECT_EQ(hipFree(dInfo), hipSuccess);
+}
+
+TEST_F(checkin_misc_LOGGING, rocsolver_rowmajor)
+{
+    rocblas_local_handle handle;
+    const rocblas_int nn = 600; // large enough for the blocked algorithms
+    const rocblas_int nrhs = 40;
+    const size_t ld = nn + 8;
+    rocblas_int *dIpiv, *dIpivR, *dInfo;
+    double *dA, *dR, *dB, *dBR, *dTau, *dTauR;
+    ASSERT_EQ(hipMallocManaged(&dA, sizeof(double) * nn * ld), hipSuccess);
+    ASSERT_EQ(hipMallocManaged(&dR, sizeof(double) * nn * ld), hipSuccess);
+    ASSERT_EQ(hipMallocManaged(&dB, sizeof(double) * nn * nrhs), hipSuccess);
+    ASSERT_EQ(hipMallocManaged(&dBR, sizeof(double) * nn * nrhs), hipSuccess);
+    ASSERT_EQ(hipMallocManaged(&dTau, sizeof(double) * nn), hipSuccess);
+    ASSERT_EQ(hipMallocManaged(&dTauR, sizeof(double) * nn), hipSuccess);
+    ASSERT_EQ(hipMallocManaged(&dIpiv, sizeof(rocblas_int) * nn), hipSuccess);
+    ASSERT_EQ(hipMallocManaged(&dIpivR, sizeof(rocblas_int) * nn), hipSuccess);
+    ASSERT_EQ(hipMallocManaged(&dInfo, sizeof(rocblas_int)), hipSuccess);
+
+    // the element (i,j) is at i + j*ld in dA (column-major) and j + i*ld in dR (row-major)
+    auto set_matrices = [&](bool spd) {
+        for(rocblas_int j = 0; j < nn; ++j)
+            for(rocblas_int i = 0; i < nn; ++i)
+                dA[i + j * ld] = dR[j + i * ld]
+                    = spd ? ((i == j) ? nn : 1.0 / (1 + i + j)) : std::sin(1.0 + i * nn + j);
+    };
+    auto max_diff = [&]() {
+        double err = 0;
+        for(rocblas_int j = 0; j < nn; ++j)
+            for(rocblas_int i = 0; i < nn; ++i)
+                err = std::max(err, std::abs(dA[i + j * ld] - dR[j + i * ld]));
+        return err;
+    };
+
+    // GETRF and GETRS
+    set_matrices(false);
+    for(rocblas_int j = 0; j < nrhs; ++j)
+        for(rocblas_int i = 0; i < nn; ++i)
+            dB[i + j * size_t(nn)] = dBR[j + i * size_t(nrhs)] = std::cos(1.0 + i + j * nn);
+    ASSERT_EQ(rocsolver_dgetrf(handle, nn, nn, dA, ld, dIpiv, dInfo), rocblas_status_success);
+    ASSERT_EQ(rocsolver_dgetrs(handle, rocblas_operation_none, nn, nrhs, dA, ld, dIpiv, dB, nn),
+              rocblas_status_success);
+    ASSERT_EQ(rocsolver_dgetrf_rowmajor(handle, nn, nn, dR, ld, dIpivR, dInfo),
+              rocblas_status_success);
+    ASSERT_EQ(rocsolver_dgetrs_rowmajor(handle, rocblas_operation_none, nn, nrhs, dR, ld, dIpivR,
+                                        dBR, nrhs),
+              rocblas_status_success);
+    ASSERT_EQ(hipDeviceSynchronize(), hipSuccess);
+    EXPECT_EQ(*dInfo, 0);
+    for(rocblas_int i = 0; i < nn; ++i)
+        EXPECT_EQ(dIpiv[i], dIpivR[i]);
+    EXPECT_LE(max_diff(), 1e-10);
+    double errB = 0;
+    for(rocblas_int j = 0; j < nrhs; ++j)
+        for(rocblas_int i = 0; i < nn; ++i)
+            errB = std::max(errB, std::abs(dB[i + j * size_t(nn)] - dBR[j + i * size_t(nrhs)]));
+    EXPECT_LE(errB, 1e-8);
+
+    // POTRF
+    for(rocblas_fill uplo : {rocblas_fill_lower, rocblas_fill_upper})
+    {
+        set_matrices(true);
+        ASSERT_EQ(rocsolver_dpotrf(handle, uplo, nn, dA, ld, dInfo), rocblas_status_success);
+        ASSERT_EQ(rocsolver_dpotrf_rowmajor(handle, uplo, nn, dR, ld, dInfo),
+                  rocblas_status_success);
+        ASSERT_EQ(hipDeviceSynchronize(), hipSuccess);
+        EXPECT_EQ(*dInfo, 0);
+        EXPECT_LE(max_diff(), 1e-12 * nn);
+    }
+
+    // GEQRF
+    set_matrices(false);
+    ASSERT_EQ(rocsolver_dgeqrf(handle, nn, nn, dA, ld, dTau), rocblas_status_success);
+    ASSERT_EQ(rocsolver_dgeqrf_rowmajor(handle, nn, nn, dR, ld, dTauR), rocblas_status_success);
+    ASSERT_EQ(hipDeviceSynchronize(), hipSuccess);
+    EXPECT_LE(max_diff(), 1e-10);
+    double errT = 0;
+    for(rocblas_int i = 0; i < nn; ++i)
+        errT = std::max(errT, std::abs(dTau[i] - dTauR[i]));
+    EXPECT_LE(errT, 1e-10);
+
+    EXPECT_EQ(hipFree(dA), hipSuccess);
+    EXPECT_EQ(hipFree(dR), hipSuccess);
+    EXPECT_EQ(hipFree(dB), hipSuccess);
+    EXPECT_EQ(hipFree(dBR), hipSuccess);
+    EXPECT_EQ(hipFree(dTau), hipSuccess);
+    EXPECT_EQ(hipFree(dTauR), hipSuccess);
+    EXPECT_EQ(hipFree(dIpiv), hipSuccess);
+    EXPECT_EQ(hipFree(dIpivR), hipSuccess);
+    EXPECT_EQ(hipFree(dInfo), hipSuccess);
+}
+
+TEST_F(checkin_misc_LOGGING, rocsolver_sygvd_factored)
+{
+    rocblas_local_handle handle;
+    const rocblas_int nn = 300;
+    const rocblas_int bc = 3;
+    const size_t nsq = size_t(nn) * nn;
+    rocblas_int* dInfo;
+    double *dA, *dR, *dB, *dBR, *dD, *dDR, *dE;
+    ASSERT_EQ(hipMallocManaged(&dA, sizeof(double) * nsq * bc), hipSuccess);
+    ASSERT_EQ(hipMallocManaged(&dR, sizeof(double) * nsq * bc), hipSuccess);
+    ASSERT_EQ(hipMallocManaged(&dB, sizeof(double) * nsq), hipSuccess);
+    ASSERT_EQ(hipMallocManaged(&dBR, sizeof(double) * nsq * bc), hipSuccess);
+    ASSERT_EQ(hipMallocManaged(&dD, sizeof(double) * nn * bc), hipSuccess);
+    ASSERT_EQ(hipMallocManaged(&dDR, sizeof(double) * nn * bc), hipSuccess);
+    ASSERT_EQ(hipMallocManaged(&dE, sizeof(double) * nn * bc), hipSuccess);
+    ASSERT_EQ(hipMallocManaged(&dInfo, sizeof(rocblas_int) * bc), hipSuccess);
+
+    // all the problems share the matrix B, which is factorized only once for SYGVD_FACTORED
+    for(rocblas_fill uplo : {rocblas_fill_lower, rocblas_fill_upper})
+    {
+        for(rocblas_int l = 0; l < bc; ++l)
+            for(rocblas_int j = 0; j < nn; ++j)
+                for(rocblas_int i = 0; i < nn; ++i)
+                {
+                    dA[i + j * nn + l * nsq] = dR[i + j * nn + l * nsq]
+                        = std::cos(1.0 + (l + 1) * (std::min(i, j) * nn + std::max(i, j)));
+                    dB[i + j * nn] = dBR[i + j * nn + l * nsq] = (i == j) ? nn : 1.0 / (1 + i + j);
+                }
+
+        ASSERT_EQ(rocsolver_dsygvd_strided_batched(handle, rocblas_eform_ax, rocblas_evect_original,
+                                                   uplo, nn, dR, nn, nsq, dBR, nn, nsq, dDR, nn, dE,
+                                                   nn, dInfo, bc),
+                  rocblas_status_success);
+        ASSERT_EQ(hipDeviceSynchronize(), hipSuccess);
+        for(rocblas_int l = 0; l < bc; ++l)
+            EXPECT_EQ(dInfo[l], 0);
+
+        ASSERT_EQ(rocsolver_dpotrf(handle, uplo, nn, dB, nn, dInfo), rocblas_status_success);
+        ASSERT_EQ(rocsolver_dsygvd_factored_strided_batched(handle, rocblas_eform_ax,
+                                                            rocblas_evect_original, uplo, nn, dA,
+                                                            nn, nsq, dB, nn, 0, dD, nn, dE, nn,
+                                                            dInfo, bc),
+                  rocblas_status_success);
+        ASSERT_EQ(hipDeviceSynchronize(), hipSuccess);
+        for(rocblas_int l = 0; l < bc; ++l)
+            EXPECT_EQ(dInfo[l], 0);
+
+        // the eigenvalues and the (orthonormalized on B) eigenvectors are the same, up to sign
+        double errD = 0, errZ = 0;
+        for(rocblas_int l = 0; l < bc; ++l)
+            for(rocblas_int j = 0; j < nn; ++j)
+            {
+                errD = std::max(errD, std::abs(dD[j + l * nn] - dDR[j + l * nn]));
+                double* z = dA + j * nn + l * nsq;
+                double* zr = dR + j * nn + l * nsq;
+                double sign = (z[0] * zr[0] < 0) ? -1 : 1;
+                for(rocblas_int i = 0; i < nn; ++i)
+                    errZ = std::max(errZ, std::abs(z[i] - sign * zr[i]));
+            }
+        EXPECT_LE(errD, 1e-12 * nn);
+        EXPECT_LE(errZ, 1e-8);
+
+        // the single-problem API gives the same result as the first problem in the batch
+        for(rocblas_int j = 0; j < nn; ++j)
+            for(rocblas_int i = 0; i < nn; ++i)
+                dR[i + j * nn] = std::cos(1.0 + std::min(i, j) * nn + std::max(i, j));
+        ASSERT_EQ(rocsolver_dsygvd_factored(handle, rocblas_eform_ax, rocblas_evect_none, uplo, nn,
+                                            dR, nn, dB, nn, dDR, dE, dInfo),
+                  rocblas_status_success);
+        ASSERT_EQ(hipDeviceSynchronize(), hipSuccess);
+        EXPECT_EQ(*dInfo, 0);
+        errD = 0;
+        for(rocblas_int j = 0; j < nn; ++j)
+            errD = std::max(errD, std::abs(dD[j] - dDR[j]));
+        EXPECT_LE(errD, 1e-12 * nn);
+    }
+
+    EXPECT_EQ(hipFree(dA), hipSuccess);
+    EXPECT_EQ(hipFree(dR), hipSuccess);
+    EXPECT_EQ(hipFree(dB), hipSuccess);
+    EXPECT_EQ(hipFree(dBR), hipSuccess);
+    EXPECT_EQ(hipFree(dD), hipSuccess);
+    EXPECT_EQ(hipFree(dDR), hipSuccess);
+    EXPECT_EQ(hipFree(dE), hipSuccess);
+    EXPECT_EQ(hipFree(dInfo), hipSuccess);
+}
+
+TEST_F(checkin_misc_LOGGING, rocsolver_set_check_mode)
+{
+    rocblas_local_handle handle, other;
+    const rocblas_int nn = 64;
+    rocsolver_check_mode mode;
+
+    EXPECT_EQ(rocsolver_set_check_mode(nullptr, rocsolver_check_mode_none),
+              rocblas_status_invalid_handle);
+    EXPECT_EQ(rocsolver_set_check_mode(handle, rocsolver_check_mode(0)),
+              rocblas_status_invalid_value);
+    EXPECT_EQ(rocsolver_get_check_mode(nullptr, &mode), rocblas_status_invalid_handle);
+    EXPECT_EQ(rocsolver_get_check_mode(handle, nullptr), rocblas_status_invalid_pointer);
+
+    // the arguments are checked by default, and the setting only applies to the given handle
+    ASSERT_EQ(rocsolver_get_check_mode(handle, &mode), rocblas_status_success);
+    EXPECT_EQ(mode, rocsolver_check_mode_full);
+    ASSERT_EQ(rocsolver_set_check_mode(handle, rocsolver_check_mode_none), rocblas_status_success);
+    ASSERT_EQ(rocsolver_get_check_mode(handle, &mode), rocblas_status_success);
+    EXPECT_EQ(mode, rocsolver_check_mode_none);
+    ASSERT_EQ(rocsolver_get_check_mode(other, &mode), rocblas_status_success);
+    EXPECT_EQ(mode, rocsolver_check_mode_full);
+    EXPECT_EQ(rocsolver_dgetrf(other, -1, nn, nullptr, nn, nullptr, nullptr),
+              rocblas_status_invalid_size);
+
+    // valid calls give the same results without the checks
+    std::vector<double> hA(nn * nn);
+    for(rocblas_int j = 0; j < nn; ++j)
+        for(rocblas_int i = 0; i < nn; ++i)
+            hA[i + j * nn] = (i == j) ? nn : 1.0 / (1 + i + j);
+
+    double *dA, *dB;
+    rocblas_int *dIpiv, *dInfo;
+    ASSERT_EQ(hipMallocManaged(&dA, sizeof(double) * nn * nn), hipSuccess);
+    ASSERT_EQ(hipMallocManaged(&dB, sizeof(double) * nn), hipSuccess);
+    ASSERT_EQ(hipMallocManaged(&dIpiv, sizeof(rocblas_int) * nn), hipSuccess);
+    ASSERT_EQ(hipMallocManaged(&dInfo, sizeof(rocblas_int)), hipSuccess);
+
+    std::copy(hA.begin(), hA.end(), dA);
+    std::fill(dB, dB + nn, 1.0);
+    *dInfo = -1;
+    ASSERT_EQ(rocsolver_dgesv(handle, nn, 1, dA, nn, dIpiv, dB, nn, dInfo), rocblas_status_success);
+    ASSERT_EQ(hipDeviceSynchronize(), hipSuccess);
+    EXPECT_EQ(*dInfo, 0);
+
+    double err = 0;
+    for(rocblas_int i = 0; i < nn; ++i)
+    {
+        double r = -1;
+        for(rocblas_int j = 0; j < nn; ++j)
+            r += hA[i + j * nn] * dB[j];
+        err = std::max(err, std::abs(r));
+    }
+    EXPECT_LE(err, 1e-12 * nn);
+
+    ASSERT_EQ(rocsolver_set_check_mode(handle, rocsolver_check_mode_full), rocblas_status_success);
+    ASSERT_EQ(rocsolver_get_check_mode(handle, &mode), rocblas_status_success);
+    EXPECT_EQ(mode, rocsolver_check_mode_full);
+    EXPECT_EQ(rocsolver_dgetrf(handle, -1, nn, nullptr, nn, nullptr, nullptr),
+              rocblas_status_invalid_size);
+
+    EXPECT_EQ(hipFree(dA), hipSuccess);
+    EXPECT_EQ(hipFree(dB), hipSuccess);
+    EXPECT_EQ(hipFree(dIpiv), hipSuccess);
+    EXPECT_EQ(hipFree(dInfo), hipSuccess);
+}
+
+TEST_F(checkin_misc_LOGGING, rocsolver_set_gemm_mode)
+{
+    rocblas_local_handle handle, other;
+    const rocblas_int nn = 1200;
+    rocsolver_gemm_mode mode;
+
+    EXPECT_EQ(rocsolver_set_gemm_mode(nullptr, rocsolver_gemm_mode_3m),
+              rocblas_status_invalid_handle);
+    EXPECT_EQ(rocsolver_set_gemm_mode(handle, rocsolver_gemm_mode(0)),
+              rocblas_status_invalid_value);
+    EXPECT_EQ(rocsolver_get_gemm_mode(nullptr, &mode), rocblas_status_invalid_handle);
+    EXPECT_EQ(rocsolver_get_gemm_mode(handle, nullptr), rocblas_status_invalid_pointer);
+
+    // the default mode is used unless selected, and the setting only applies to the given handle
+    ASSERT_EQ(rocsolver_get_gemm_mode(handle, &mode), rocblas_status_success);
+    EXPECT_EQ(mode, rocsolver_gemm_mode_default);
+    ASSERT_EQ(rocsolver_set_gemm_mode(handle, rocsolver_gemm_mode_3m), rocblas_status_success);
+    ASSERT_EQ(rocsolver_get_gemm_mode(handle, &mode), rocblas_status_success);
+    EXPECT_EQ(mode, rocsolver_gemm_mode_3m);
+    ASSERT_EQ(rocsolver_get_gemm_mode(other, &mode), rocblas_status_success);
+    EXPECT_EQ(mode, rocsolver_gemm_mode_default);
+
+    // a complex system large enough for the trailing updates of GETRF to use the 3M method
+    std::vector<rocblas_double_complex> hA(size_t(nn) * nn);
+    for(rocblas_int j = 0; j < nn; ++j)
+        for(rocblas_int i = 0; i < nn; ++i)
+            hA[i + size_t(j) * nn] = (i == j) ? rocblas_double_complex(nn, 1)
+                                              : rocblas_double_complex(1.0 / (1 + i + j),
+                                                                       1.0 / (1 + 2 * i + j));
+
+    rocblas_double_complex *dA, *dB;
+    rocblas_int *dIpiv, *dInfo;
+    ASSERT_EQ(hipMallocManaged(&dA, sizeof(rocblas_double_complex) * nn * nn), hipSuccess);
+    ASSERT_EQ(hipMallocManaged(&dB, sizeof(rocblas_double_complex) * nn), hipSuccess);
+    ASSERT_EQ(hipMallocManaged(&dIpiv, sizeof(rocblas_int) * nn), hipSuccess);
+    ASSERT_EQ(hipMallocManaged(&dInfo, sizeof(rocblas_int)), hipSuccess);
+
+    std::copy(hA.begin(), hA.end(), dA);
+    std::fill(dB, dB + nn, rocblas_double_complex(1, 0));
+    *dInfo = -1;
+    ASSERT_EQ(rocsolver_zgesv(handle, nn, 1, dA, nn, dIpiv, dB, nn, dInfo), rocblas_status_success);
+    ASSERT_EQ(hipDeviceSynchronize(), hipSuccess);
+    EXPECT_EQ(*dInfo, 0);
+
+    // the 3M method only adds rounding errors
+    double err = 0;
+    for(rocblas_int i = 0; i < nn; ++i)
+    {
+        rocblas_double_complex r = -1;
+        for(rocblas_int j = 0; j < nn; ++j)
+            r += hA[i + size_t(j) * nn] * dB[j];
+        err = std::max(err, std::hypot(r.real(), r.imag()));
+    }
+    EXPECT_LE(err, 1e-11 * nn);
+
+    ASSERT_EQ(rocsolver_set_gemm_mode(handle, rocsolver_gemm_mode_default),
+              rocblas_status_success);
+    ASSERT_EQ(rocsolver_get_gemm_mode(handle, &mode), rocblas_status_success);
+    EXPECT_EQ(mode, rocsolver_gemm_mode_default);
+
+    EXPECT_EQ(hipFree(dA), hipSuccess);
+    EXPECT_EQ(hipFree(dB), hipSuccess);
+    EXPECT_EQ(hipFree(dIpiv), hipSuccess);
+    EXPECT_EQ(hipFree(dInfo), hipSuccess);
+}
+
+TEST_F(checkin_misc_LOGGING, rocsolver_set_thread_mode)
+{
+    rocblas_local_handle handle, other;
+    const int num_threads = 4;
+    rocsolver_thread_mode mode;
+    hipStream_t stream, handle_stream;
+
+    EXPECT_EQ(rocsolver_set_thread_mode(nullptr, rocsolver_thread_mode_multi),
+              rocblas_status_invalid_handle);
+    EXPECT_EQ(rocsolver_set_thread_mode(handle, rocsolver_thread_mode(0)),
+              rocblas_status_invalid_value);
+    EXPECT_EQ(rocsolver_get_thread_mode(nullptr, &mode), rocblas_status_invalid_handle);
+    EXPECT_EQ(rocsolver_get_thread_mode(handle, nullptr), rocblas_status_invalid_pointer);
+    EXPECT_EQ(rocsolver_set_thread_stream(nullptr, 0), rocblas_status_invalid_handle);
+    EXPECT_EQ(rocsolver_get_thread_stream(nullptr, &stream), rocblas_status_invalid_handle);
+    EXPECT_EQ(rocsolver_get_thread_stream(handle, nullptr), rocblas_status_invalid_pointer);
+
+    // the default mode is used unless selected, and the setting only applies to the given handle
+    ASSERT_EQ(rocsolver_get_thread_mode(handle, &mode), rocblas_status_success);
+    EXPECT_EQ(mode, rocsolver_thread_mode_single);
+    ASSERT_EQ(rocsolver_set_thread_mode(handle, rocsolver_thread_mode_multi),
+              rocblas_status_success);
+    ASSERT_EQ(rocsolver_get_thread_mode(handle, &mode), rocblas_status_success);
+    EXPECT_EQ(mode, rocsolver_thread_mode_multi);
+    ASSERT_EQ(rocsolver_get_thread_mode(other, &mode), rocblas_status_success);
+    EXPECT_EQ(mode, rocsolver_thread_mode_single);
+    ASSERT_EQ(rocblas_get_stream(handle, &handle_stream), rocblas_status_success);
+
+    // every thread factorizes its own matrix with the shared handle, on its own stream
+    std::vector<rocblas_int> sizes(num_threads);
+    std::vector<double> flops(num_threads), errors(num_threads);
+    std::vector<rocblas_int> infos(num_threads);
+    std::vector<hipStream_t> streams(num_threads);
+    std::vector<std::thread> threads;
+    for(int t = 0; t < num_threads; ++t)
+    {
+        sizes[t] = 64 * (t + 1);
+        ASSERT_EQ(hipStreamCreate(&streams[t]), hipSuccess);
+    }
+
+    for(int t = 0; t < num_threads; ++t)
+        threads.emplace_back([&, t]() {
+            const rocblas_int nn = sizes[t];
+            std::vector<double> hA(size_t(nn) * nn);
+            for(rocblas_int j = 0; j < nn; ++j)
+                for(rocblas_int i = 0; i < nn; ++i)
+                    hA[i + size_t(j) * nn] = (i == j) ? nn : 1.0 / (1 + i + j);
+
+            double *dA;
+            rocblas_int* dInfo;
+            hipStream_t thread_stream = 0;
+            rocsolver_call_stats stats;
+            if(hipMallocManaged(&dA, sizeof(double) * nn * nn) != hipSuccess
+               || hipMallocManaged(&dInfo, sizeof(rocblas_int)) != hipSuccess)
+                return;
+
+            std::copy(hA.begin(), hA.end(), dA);
+            *dInfo = -1;
+            rocsolver_set_thread_stream(handle, streams[t]);
+            rocsolver_get_thread_stream(handle, &thread_stream);
+            if(thread_stream == streams[t]
+               && rocsolver_dpotrf(handle, rocblas_fill_lower, nn, dA, nn, dInfo)
+                   == rocblas_status_success
+               && hipStreamSynchronize(streams[t]) == hipSuccess)
+            {
+                // the statistics are those of the call of this thread
+                rocsolver_get_last_call_stats(handle, &stats);
+                flops[t] = stats.flops;
+                infos[t] = *dInfo;
+
+                double err = 0;
+                for(rocblas_int j = 0; j < nn; ++j)
+                    for(rocblas_int i = j; i < nn; ++i)
+                    {
+                        double r = -hA[i + size_t(j) * nn];
+                        for(rocblas_int k = 0; k <= j; ++k)
+                            r += dA[i + size_t(k) * nn] * dA[j + size_t(k) * nn];
+                        err = std::max(err, std::abs(r));
+                    }
+                errors[t] = err;
+            }
+            else
+                infos[t] = -1;
+
+            rocsolver_set_thread_stream(handle, 0);
+            (void)hipFree(dA);
+            (void)hipFree(dInfo);
+        });
+    for(auto& thread : threads)
+        thread.join();
+
+    for(int t = 0; t < num_threads; ++t)
+    {
+        EXPECT_EQ(infos[t], 0);
+        EXPECT_LE(errors[t], 1e-12 * sizes[t] * sizes[t]);
+        if(t > 0)
+            EXPECT_GT(flops[t], flops[t - 1]);
+        EXPECT_EQ(hipStreamDestroy(streams[t]), hipSuccess);
+    }
+
+    // the stream of the handle is restored after every call
+    ASSERT_EQ(rocblas_get_stream(handle, &stream), rocblas_status_success);
+    EXPECT_EQ(stream, handle_stream);
+    ASSERT_EQ(rocsolver_get_thread_stream(handle, &stream), rocblas_status_success);
+    EXPECT_EQ(stream, handle_stream);
+
+    ASSERT_EQ(rocsolver_set_thread_mode(handle, rocsolver_thread_mode_single),
+              rocblas_status_success);
+    ASSERT_EQ(rocsolver_get_thread_mode(handle, &mode), rocblas_status_success);
+    EXPECT_EQ(mode, rocsolver_thread_mode_single);
+}
+
+TEST_F(checkin_misc_LOGGING, rocsolver_set_cu_mask)
+{
+    rocblas_local_handle handle, other;
+    const rocblas_int nn = 64;
+    const uint32_t half[1] = {0x55555555u};
+    const uint32_t none[1] = {0u};
+    rocblas_int count, total;
+    hipStream_t s0, s1;
+
+    EXPECT_EQ(rocsolver_set_cu_mask(nullptr, 1, half), rocblas_status_invalid_handle);
+    EXPECT_EQ(rocsolver_set_cu_mask(handle, -1, half), rocblas_status_invalid_size);
+    EXPECT_EQ(rocsolver_set_cu_mask(handle, 1, nullptr), rocblas_status_invalid_pointer);
+    EXPECT_EQ(rocsolver_set_cu_mask(handle, 1, none), rocblas_status_invalid_value);
+    EXPECT_EQ(rocsolver_get_cu_count(nullptr, &count), rocblas_status_invalid_handle);
+    EXPECT_EQ(rocsolver_get_cu_count(handle, nullptr), rocblas_status_invalid_pointer);
+
+    // without a mask, all the CUs are available
+    ASSERT_EQ(rocsolver_get_cu_count(handle, &total), rocblas_status_success);
+    EXPECT_GT(total, 0);
+
+    // the mask only applies to the given handle, and replaces its stream
+    ASSERT_EQ(rocblas_get_stream(handle, &s0), rocblas_status_success);
+    ASSERT_EQ(rocsolver_set_cu_mask(handle, 1, half), rocblas_status_success);
+    ASSERT_EQ(rocsolver_get_cu_count(handle, &count), rocblas_status_success);
+    EXPECT_EQ(count, (std::min(total, 32) + 1) / 2);
+    ASSERT_EQ(rocsolver_get_cu_count(other, &count), rocblas_status_success);
+    EXPECT_EQ(count, total);
+    ASSERT_EQ(rocblas_get_stream(handle, &s1), rocblas_status_success);
+    EXPECT_NE(s1, s0);
+
+    // the computations give the same results on the masked stream
+    std::vector<double> hA(nn * nn);
+    for(rocblas_int j = 0; j < nn; ++j)
+        for(rocblas_int i = 0; i < nn; ++i)
+            hA[i + j * nn] = (i == j) ? nn : 1.0 / (1 + i + j);
+
+    double *dA, *dB;
+    rocblas_int *dIpiv, *dInfo;
+    ASSERT_EQ(hipMallocManaged(&dA, sizeof(double) * nn * nn), hipSuccess);
+    ASSERT_EQ(hipMallocManaged(&dB, sizeof(double) * nn), hipSuccess);
+    ASSERT_EQ(hipMallocManaged(&dIpiv, sizeof(rocblas_int) * nn), hipSuccess);
+    ASSERT_EQ(hipMallocManaged(&dInfo, sizeof(rocblas_int)), hipSuccess);
+
+    std::copy(hA.begin(), hA.end(), dA);
+    std::fill(dB, dB + nn, 1.0);
+    *dInfo = -1;
+    ASSERT_EQ(rocsolver_dgesv(handle, nn, 1, dA, nn, dIpiv, dB, nn, dInfo), rocblas_status_success);
+    ASSERT_EQ(hipDeviceSynchronize(), hipSuccess);
+    EXPECT_EQ(*dInfo, 0);
+
+    double err = 0;
+    for(rocblas_int i = 0; i < nn; ++i)
+    {
+        double r = -1;
+        for(rocblas_int j = 0; j < nn; ++j)
+            r += hA[i + j * nn] * dB[j];
+        err = std::max(err, std::abs(r));
+    }
+    EXPECT_LE(err, 1e-12 * nn);
+
+    // removing the mask restores the original stream
+    ASSERT_EQ(rocsolver_set_cu_mask(handle, 0, nullptr), rocblas_status_success);
+    ASSERT_EQ(rocblas_get_stream(handle, &s1), rocblas_status_success);
+    EXPECT_EQ(s1, s0);
+    ASSERT_EQ(rocsolver_get_cu_count(handle, &count), rocblas_status_success);
+    EXPECT_EQ(count, total);
+
+    EXPECT_EQ(hipFree(dA), hipSuccess);
+    EXPECT_EQ(hipFree(dB), hipSuccess);
+    EXPECT_EQ(hipFree(dIpiv), hipSuccess);
+    EXPECT_EQ(hipFree(dInfo), hipSuccess);
+}
+
+TEST_F(checkin_misc_LOGGING, rocsolver_release_handle)
+{
+    rocblas_local_handle handle;
+    const uint32_t half[1] = {0x55555555u};
+    rocblas_int count, total;
+    hipStream_t s0, s1;
+    rocsolver_alg_mode alg;
+    rocsolver_check_mode check;
+    rocsolver_gemm_mode gemm;
+    rocsolver_thread_mode thread;
+
+    EXPECT_EQ(rocsolver_release_handle(nullptr), rocblas_status_invalid_handle);
+
+    // a handle without settings can be released
+    EXPECT_EQ(rocsolver_release_handle(handle), rocblas_status_success);
+
+    ASSERT_EQ(rocsolver_get_cu_count(handle, &total), rocblas_status_success);
+    ASSERT_EQ(rocblas_get_stream(handle, &s0), rocblas_status_success);
+    ASSERT_EQ(rocsolver_set_alg_mode(handle, rocsolver_function_gesvd, rocsolver_alg_mode_dc),
+              rocblas_status_success);
+    ASSERT_EQ(rocsolver_set_check_mode(handle, rocsolver_check_mode_none), rocblas_status_success);
+    ASSERT_EQ(rocsolver_set_gemm_mode(handle, rocsolver_gemm_mode_3m), rocblas_status_success);
+    ASSERT_EQ(rocsolver_set_thread_mode(handle, rocsolver_thread_mode_multi),
+              rocblas_status_success);
+    ASSERT_EQ(rocsolver_set_cu_mask(handle, 1, half), rocblas_status_success);
+
+    // after the release, the handle behaves as a new one
+    ASSERT_EQ(rocsolver_release_handle(handle), rocblas_status_success);
+
+    ASSERT_EQ(rocsolver_get_alg_mode(handle, rocsolver_function_gesvd, &alg),
+              rocblas_status_success);
+    EXPECT_EQ(alg, rocsolver_alg_mode_qr);
+    ASSERT_EQ(rocsolver_get_check_mode(handle, &check), rocblas_status_success);
+    EXPECT_EQ(check, rocsolver_check_mode_full);
+    ASSERT_EQ(rocsolver_get_gemm_mode(handle, &gemm), rocblas_status_success);
+    EXPECT_EQ(gemm, rocsolver_gemm_mode_default);
+    ASSERT_EQ(rocsolver_get_thread_mode(handle, &thread), rocblas_status_success);
+    EXPECT_EQ(thread, rocsolver_thread_mode_single);
+    ASSERT_EQ(rocsolver_get_cu_count(handle, &count), rocblas_status_success);
+    EXPECT_EQ(count, total);
+    ASSERT_EQ(rocblas_get_stream(handle, &s1), rocblas_status_success);
+    EXPECT_EQ(s1, s0);
+    EXPECT_EQ(rocsolver_dgetrf(handle, -1, 1, nullptr, 1, nullptr, nullptr),
+              rocblas_status_invalid_size);
+}
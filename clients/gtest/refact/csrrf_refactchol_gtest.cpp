@@ -103,15 +103,17 @@ protected:
         EXPECT_EQ(hipGetLastError(), hipSuccess);
     }
 
-    template <typename T>
-    void run_tests()
+    template <bool STRIDED, typename T>
+    void run_tests(const char refact_mode = 'S')
     {
         Arguments arg = csrrf_refactchol_setup_arguments(GetParam());
+        arg.set<char>("rfinfo_refact_mode", refact_mode);
 
         if(arg.peek<rocblas_int>("n") == 0 && arg.peek<rocblas_int>("nnzA") == 60)
-            testing_csrrf_refactchol_bad_arg<T>();
+            testing_csrrf_refactchol_bad_arg<STRIDED, T>();
 
-        testing_csrrf_refactchol<T>(arg);
+        arg.batch_count = (STRIDED ? 3 : 1);
+        testing_csrrf_refactchol<STRIDED, T>(arg);
     }
 };
 
@@ -119,24 +121,58 @@ protected:
 
 TEST_P(CSRRF_REFACTCHOL, __float)
 {
-    run_tests<float>();
+    run_tests<false, float>();
 }
 
 TEST_P(CSRRF_REFACTCHOL, __double)
 {
-    run_tests<double>();
+    run_tests<false, double>();
 }
 
 /*TEST_P(CSRRF_REFACTCHOL, __float_complex)
 {
-    run_tests<rocblas_float_complex>();
+    run_tests<false, rocblas_float_complex>();
 }
 
 TEST_P(CSRRF_REFACTCHOL, __double_complex)
 {
-    run_tests<rocblas_double_complex>();
+    run_tests<false, rocblas_double_complex>();
 }*/
 
+// strided_batched tests
+
+TEST_P(CSRRF_REFACTCHOL, strided_batched__float)
+{
+    run_tests<true, float>();
+}
+
+TEST_P(CSRRF_REFACTCHOL, strided_batched__double)
+{
+    run_tests<true, double>();
+}
+
+// tests with the supernodal re-factorization
+
+TEST_P(CSRRF_REFACTCHOL, supernodal__float)
+{
+    run_tests<false, float>('N');
+}
+
+TEST_P(CSRRF_REFACTCHOL, supernodal__double)
+{
+    run_tests<false, double>('N');
+}
+
+TEST_P(CSRRF_REFACTCHOL, strided_batched_supernodal__float)
+{
+    run_tests<true, float>('N');
+}
+
+TEST_P(CSRRF_REFACTCHOL, strided_batched_supernodal__double)
+{
+    run_tests<true, double>('N');
+}
+
 INSTANTIATE_TEST_SUITE_P(daily_lapack,
                          CSRRF_REFACTCHOL,
                          Combine(ValuesIn(large_n_range), ValuesIn(large_nnz_range)));
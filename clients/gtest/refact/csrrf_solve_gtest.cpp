@@ -122,15 +122,22 @@ protected:
         EXPECT_EQ(hipGetLastError(), hipSuccess);
     }
 
-    template <typename T>
-    void run_tests()
+    template <bool STRIDED, typename T>
+    void run_tests(const char solve_mode = 'S', const bool import = false)
     {
         Arguments arg = csrrf_solve_setup_arguments(GetParam());
+        arg.set<char>("rfinfo_solve_mode", solve_mode);
+        if(import)
+        {
+            arg.set<char>("rfinfo_refact_mode", 'N');
+            arg.set<rocblas_int>("rfinfo_import", 1);
+        }
 
         if(arg.peek<rocblas_int>("n") == 0 && arg.peek<rocblas_int>("nnzT") == 10)
-            testing_csrrf_solve_bad_arg<T>();
+            testing_csrrf_solve_bad_arg<STRIDED, T>();
 
-        testing_csrrf_solve<T>(arg);
+        arg.batch_count = (STRIDED ? 3 : 1);
+        testing_csrrf_solve<STRIDED, T>(arg);
     }
 };
 
@@ -138,24 +145,70 @@ protected:
 
 TEST_P(CSRRF_SOLVE, __float)
 {
-    run_tests<float>();
+    run_tests<false, float>();
 }
 
 TEST_P(CSRRF_SOLVE, __double)
 {
-    run_tests<double>();
+    run_tests<false, double>();
 }
 
 /*TEST_P(CSRRF_SOLVE, __float_complex)
 {
-    run_tests<rocblas_float_complex>();
+    run_tests<false, rocblas_float_complex>();
 }
 
 TEST_P(CSRRF_SOLVE, __double_complex)
 {
-    run_tests<rocblas_double_complex>();
+    run_tests<false, rocblas_double_complex>();
 }*/
 
+// strided_batched tests
+
+TEST_P(CSRRF_SOLVE, strided_batched__float)
+{
+    run_tests<true, float>();
+}
+
+TEST_P(CSRRF_SOLVE, strided_batched__double)
+{
+    run_tests<true, double>();
+}
+
+// tests with the level-scheduled triangular solves
+
+TEST_P(CSRRF_SOLVE, levels__float)
+{
+    run_tests<false, float>('L');
+}
+
+TEST_P(CSRRF_SOLVE, levels__double)
+{
+    run_tests<false, double>('L');
+}
+
+TEST_P(CSRRF_SOLVE, strided_batched_levels__float)
+{
+    run_tests<true, float>('L');
+}
+
+TEST_P(CSRRF_SOLVE, strided_batched_levels__double)
+{
+    run_tests<true, double>('L');
+}
+
+// tests with an exported and re-imported analysis
+
+TEST_P(CSRRF_SOLVE, import__float)
+{
+    run_tests<false, float>('L', true);
+}
+
+TEST_P(CSRRF_SOLVE, import__double)
+{
+    run_tests<false, double>('L', true);
+}
+
 INSTANTIATE_TEST_SUITE_P(daily_lapack,
                          CSRRF_SOLVE,
                          Combine(ValuesIn(large_n_range),
@@ -95,15 +95,16 @@ protected:
         EXPECT_EQ(hipGetLastError(), hipSuccess);
     }
 
-    template <typename T>
+    template <bool STRIDED, typename T>
     void run_tests()
     {
         Arguments arg = csrrf_splitlu_setup_arguments(GetParam());
 
         if(arg.peek<rocblas_int>("n") == 0 && arg.peek<rocblas_int>("nnzT") == 0)
-            testing_csrrf_splitlu_bad_arg<T>();
+            testing_csrrf_splitlu_bad_arg<STRIDED, T>();
 
-        testing_csrrf_splitlu<T>(arg);
+        arg.batch_count = (STRIDED ? 3 : 1);
+        testing_csrrf_splitlu<STRIDED, T>(arg);
     }
 };
 
@@ -111,24 +112,36 @@ protected:
 
 TEST_P(CSRRF_SPLITLU, __float)
 {
-    run_tests<float>();
+    run_tests<false, float>();
 }
 
 TEST_P(CSRRF_SPLITLU, __double)
 {
-    run_tests<double>();
+    run_tests<false, double>();
 }
 
 /*TEST_P(CSRRF_SPLITLU, __float_complex)
 {
-    run_tests<rocblas_float_complex>();
+    run_tests<false, rocblas_float_complex>();
 }
 
 TEST_P(CSRRF_SPLITLU, __double_complex)
 {
-    run_tests<rocblas_double_complex>();
+    run_tests<false, rocblas_double_complex>();
 }*/
 
+// strided_batched tests
+
+TEST_P(CSRRF_SPLITLU, strided_batched__float)
+{
+    run_tests<true, float>();
+}
+
+TEST_P(CSRRF_SPLITLU, strided_batched__double)
+{
+    run_tests<true, double>();
+}
+
 INSTANTIATE_TEST_SUITE_P(daily_lapack,
                          CSRRF_SPLITLU,
                          Combine(ValuesIn(large_n_range), ValuesIn(large_nnz_range)));
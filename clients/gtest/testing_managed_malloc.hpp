@@ -168,6 +168,7 @@ void managed_malloc_getPerfData(const rocblas_handle handle,
     {
         managed_malloc_initData<false, true, T>(handle, m, n, nb, dA, dARes, lda);
 
+        rocsolver_bench_first_call first_call(handle, iter);
         CHECK_ROCBLAS_ERROR(rocsolver_labrd(handle, m, n, nb, dARes, lda, dD, dE, dTauq, dTaup,
                                             dXRes, ldx, dYRes, ldy));
         CHECK_HIP_ERROR(hipDeviceSynchronize());
@@ -176,7 +177,7 @@ void managed_malloc_getPerfData(const rocblas_handle handle,
     // gpu-lapack performance
     hipStream_t stream;
     CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
-    double start;
+    rocsolver_bench_timer timer(stream, hot_calls);
 
     if(profile > 0)
     {
@@ -188,14 +189,14 @@ void managed_malloc_getPerfData(const rocblas_handle handle,
         rocsolver_log_set_max_levels(profile);
     }
 
-    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    for(rocblas_int iter = 0; iter < timer.calls(); iter++)
     {
         managed_malloc_initData<false, true, T>(handle, m, n, nb, dA, dARes, lda);
 
-        start = get_time_us_sync(stream);
+        timer.start(iter);
         rocsolver_labrd(handle, m, n, nb, dARes, lda, dD, dE, dTauq, dTaup, dXRes, ldx, dYRes, ldy);
         CHECK_HIP_ERROR(hipDeviceSynchronize());
-        *gpu_time_used += get_time_us_sync(stream) - start;
+        *gpu_time_used += timer.stop(iter);
     }
     *gpu_time_used /= hot_calls;
 }
@@ -0,0 +1,124 @@
+# ##########################################################################
+# Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions
+# are met:
+#
+# 1. Redistributions of source code must retain the above copyright
+#    notice, this list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright
+#    notice, this list of conditions and the following disclaimer in the
+#    documentation and/or other materials provided with the distribution.
+#
+# THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+# ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+# ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+# OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+# HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+# LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+
+"""Performance regression tests of rocSOLVER.
+
+Runs the cases of a sweep file with rocsolver-bench --suite, and compares the median time of every
+case with the baseline stored for the architecture of the device. The test fails if the throughput
+of any case drops by more than the threshold, or if any case fails to run. Without a baseline for
+the architecture, the test is skipped; --update stores the current results as the baseline.
+"""
+
+import argparse
+import json
+import os
+import subprocess
+import sys
+import tempfile
+
+SKIP_RETURN_CODE = 77
+
+def case_key(result):
+    return '{} -r {} {}'.format(result['function'], result['precision'],
+            ' '.join('--{} {}'.format(k, v) for k, v in sorted(result['args'].items())))
+
+def run_suite(args):
+    with tempfile.TemporaryDirectory() as tmp:
+        output = os.path.join(tmp, 'results.json')
+        cmd = [args.bench, '--suite', args.suite, '--suite_output', output,
+               '--iters', str(args.iters), '--device', str(args.device)]
+        subprocess.run(cmd, check=True)
+        with open(output) as f:
+            return json.load(f)
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+            formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--bench', default='./rocsolver-bench',
+            help='path of the rocsolver-bench executable')
+    parser.add_argument('--suite', required=True,
+            help='sweep file with the cases to run')
+    parser.add_argument('--baselines', required=True,
+            help='directory of the baselines, one <arch>.json file per architecture')
+    parser.add_argument('--threshold', type=float, default=0.1,
+            help='maximum relative throughput drop allowed (default: 0.1)')
+    parser.add_argument('--iters', type=int, default=20,
+            help='number of timed runs of every case (default: 20)')
+    parser.add_argument('--device', type=int, default=0,
+            help='device to run on (default: 0)')
+    parser.add_argument('--update', action='store_true',
+            help='store the results as the baseline of the architecture of the device')
+    args = parser.parse_args()
+
+    results = run_suite(args)
+    arch = results['device']
+    baseline_file = os.path.join(args.baselines, arch + '.json')
+
+    if args.update:
+        os.makedirs(args.baselines, exist_ok=True)
+        baseline = {
+            'device': arch,
+            'rocsolver_version': results['rocsolver_version'],
+            'rocblas_version': results['rocblas_version'],
+            'cases': {case_key(r): r['median_us'] for r in results['results'] if r['status'] == 'ok'},
+        }
+        with open(baseline_file, 'w') as f:
+            json.dump(baseline, f, indent=2, sort_keys=True)
+            f.write('\n')
+        print('Baseline written to {}'.format(baseline_file))
+        return 0
+
+    if not os.path.exists(baseline_file):
+        print('No baseline for {} in {}; skipping (use --update to create one)'.format(
+              arch, args.baselines))
+        return SKIP_RETURN_CODE
+
+    with open(baseline_file) as f:
+        baseline = json.load(f)['cases']
+
+    failures = 0
+    print('\n{:<70} {:>12} {:>12} {:>8}'.format('case', 'baseline_us', 'median_us', 'speedup'))
+    for r in results['results']:
+        key = case_key(r)
+        if r['status'] != 'ok':
+            print('{:<70} FAILED: {}'.format(key, r['status']))
+            failures += 1
+            continue
+        if key not in baseline:
+            print('{:<70} {:>12} {:>12.3f}   (no baseline)'.format(key, '-', r['median_us']))
+            continue
+        speedup = baseline[key] / r['median_us'] if r['median_us'] > 0 else float('inf')
+        regressed = speedup < 1 - args.threshold
+        print('{:<70} {:>12.3f} {:>12.3f} {:>8.3f}{}'.format(key, baseline[key], r['median_us'],
+              speedup, '   REGRESSION' if regressed else ''))
+        failures += regressed
+
+    if failures:
+        print('\n{} case(s) failed or regressed by more than {:.0%}'.format(failures,
+              args.threshold))
+        return 1
+    return 0
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -54,7 +54,8 @@ int main() {
   rocblas_create_handle(&handle);
 
   // Some rocsolver functions may trigger rocblas to load its GEMM kernels.
-  // You can preload the kernels by explicitly invoking rocblas_initialize
+  // You can preload the kernels by explicitly invoking rocblas_initialize,
+  // or warm up the rocsolver functions for given sizes with rocsolver_initialize
   // (e.g., to exclude one-time initialization overhead from benchmarking).
 
   // preload rocBLAS GEMM kernels (optional)
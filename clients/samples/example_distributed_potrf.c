@@ -0,0 +1,308 @@
+#include <hip/hip_runtime_api.h> // for hip functions
+#include <mpi.h>                 // for the processes and the exchange of the RCCL ids
+#include <rccl/rccl.h>           // for the collectives between devices
+#include <rocsolver/rocsolver.h> // for all the rocsolver C interfaces and type declarations
+#include <limits.h>  // for INT_MAX
+#include <math.h>    // for fabs, ldexp, sqrt
+#include <stdio.h>   // for printf
+#include <stdlib.h>  // for malloc
+
+// Example: Solve a symmetric positive definite system whose matrix is distributed over the GPUs
+// of several nodes (one MPI process per GPU).
+//
+// The N-by-N matrix A is split in NB-by-NB blocks that are assigned to a P-by-Q grid of processes
+// in a 2D block-cyclic fashion (block (i,j) lives on process (i % P, j % Q)), as in ScaLAPACK.
+// Every process stores its blocks in a local column-major matrix. The Cholesky factorization
+// A = L*L' is computed by the right-looking algorithm. At step k:
+//   1. the owner of the diagonal block factors it with rocsolver_dpotrf, and broadcasts L(k,k)
+//      to its process column,
+//   2. the process column computes its blocks of the panel, L(i,k) = A(i,k) * inv(L(k,k))', with
+//      rocblas_dtrsm, and broadcasts them (transposed) along the process rows,
+//   3. the block L(j,k) needed by every local block column j is broadcast along the process
+//      columns from its owner, and
+//   4. every process updates its blocks of the trailing matrix, A(i,j) -= L(i,k) * L(j,k)', with
+//      one rocblas_dgemm per local block column.
+// All the communication uses RCCL collectives on the stream of the rocBLAS handle, so the host
+// never waits inside the factorization. The RCCL communicators are created from the MPI ones
+// (any other way of creating them, such as the one of the application, works as well).
+//
+// The right-hand sides are replicated in all the processes. The triangular solves reduce the
+// partial products of every block row (or column) to the owner of the diagonal block, which
+// solves its block and broadcasts the result to all the processes.
+//
+// Build with MPI and RCCL, and run with one process per GPU, e.g.
+//     mpirun -np 8 ./example-c-distributed-potrf
+
+#define CHECK_NCCL(cmd)                                                                 \
+  do {                                                                                  \
+    ncclResult_t res = (cmd);                                                           \
+    if (res != ncclSuccess) {                                                           \
+      printf("RCCL error %s at %s:%d\n", ncclGetErrorString(res), __FILE__, __LINE__); \
+      MPI_Abort(MPI_COMM_WORLD, 1);                                                     \
+    }                                                                                   \
+  } while (0)
+
+static const double one = 1;
+static const double minus_one = -1;
+static const double zero = 0;
+
+// creates an RCCL communicator with the processes of the given MPI communicator
+static void create_comm(MPI_Comm mpi_comm, ncclComm_t *comm) {
+  int rank, size;
+  MPI_Comm_rank(mpi_comm, &rank);
+  MPI_Comm_size(mpi_comm, &size);
+  ncclUniqueId id;
+  if (rank == 0)
+    CHECK_NCCL(ncclGetUniqueId(&id));
+  MPI_Bcast(&id, sizeof(id), MPI_BYTE, 0, mpi_comm);
+  CHECK_NCCL(ncclCommInitRank(comm, size, id, rank));
+}
+
+// number of blocks among the first n that are assigned to index p of a grid dimension of size P
+static int num_local(int n, int p, int P) {
+  return (n > p) ? (n - p - 1) / P + 1 : 0;
+}
+
+// We use rocsolver_dpotrf and rocBLAS to factor a real N-by-N symmetric positive definite matrix,
+// A, distributed over all the processes, and then solve A*X = B for NRHS right-hand sides.
+// See https://rocm.docs.amd.com/projects/rocSOLVER/en/latest/api/lapack.html#rocsolver-type-potrf
+int main(int argc, char **argv) {
+  const int NB = 256;    // order of the distributed blocks
+  const int nblk = 32;   // number of block rows and columns
+  const int N = NB * nblk; // order of the system
+  const int NRHS = 4;    // number of right-hand sides
+
+  MPI_Init(&argc, &argv);
+  int rank, nprocs;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &nprocs);
+
+  // one device per process of the node
+  MPI_Comm node_comm;
+  int node_rank, ndev;
+  MPI_Comm_split_type(MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, rank, MPI_INFO_NULL, &node_comm);
+  MPI_Comm_rank(node_comm, &node_rank);
+  hipGetDeviceCount(&ndev);
+  if (ndev < 1) {
+    printf("no devices found\n");
+    MPI_Abort(MPI_COMM_WORLD, 1);
+  }
+  hipSetDevice(node_rank % ndev);
+
+  // the P-by-Q process grid is as square as possible; process (p,q) has rank p + q*P
+  int P = (int)sqrt((double)nprocs);
+  while (nprocs % P != 0)
+    --P;
+  const int Q = nprocs / P;
+  const int p = rank % P;
+  const int q = rank / P;
+
+  MPI_Comm row_mpi, col_mpi;
+  MPI_Comm_split(MPI_COMM_WORLD, p, q, &row_mpi);
+  MPI_Comm_split(MPI_COMM_WORLD, q, p, &col_mpi);
+  ncclComm_t world, row, col;
+  create_comm(MPI_COMM_WORLD, &world);
+  create_comm(row_mpi, &row); // rank q in the process row
+  create_comm(col_mpi, &col); // rank p in the process column
+
+  rocblas_handle handle;
+  hipStream_t stream;
+  rocblas_create_handle(&handle);
+  rocblas_get_stream(handle, &stream);
+
+  // local blocks: the local matrix is mloc-by-nloc, and block (i,j) is at local block position
+  // (i / P, j / Q)
+  const int mb = num_local(nblk, p, P);
+  const int nb = num_local(nblk, q, Q);
+  const int mloc = mb * NB;
+  const int nloc = nb * NB;
+  const int ld = (mloc > 0) ? mloc : 1;
+
+  // initialize the local blocks of the matrix with A(i,j) = 2^-|i-j|, which is symmetric
+  // positive definite, and the right-hand sides B = A * ones, so that the solution is ones;
+  // the blocks of B (and of the solution X) are stored one after the other, NB-by-NRHS each
+  double *hA = (double*)malloc(sizeof(double) * ld * (nloc > 0 ? nloc : 1));
+  double *hB = (double*)malloc(sizeof(double) * N * NRHS);
+  for (int lj = 0; lj < nloc; ++lj) {
+    int j = (lj / NB * Q + q) * NB + lj % NB;
+    for (int li = 0; li < mloc; ++li) {
+      int i = (li / NB * P + p) * NB + li % NB;
+      hA[li + (size_t)lj * ld] = ldexp(1.0, -abs(i - j));
+    }
+  }
+  for (int i = 0; i < N; ++i) {
+    double s = 0;
+    for (int j = 0; j < N; ++j)
+      s += ldexp(1.0, -abs(i - j));
+    for (int r = 0; r < NRHS; ++r)
+      hB[(size_t)(i / NB) * NB * NRHS + i % NB + r * NB] = s;
+  }
+
+  double *dA, *dD, *dR, *dC, *dB, *dW, *dT;
+  rocblas_int *dInfo;
+  hipMalloc((void**)&dA, sizeof(double) * ld * (nloc > 0 ? nloc : 1));
+  hipMalloc((void**)&dD, sizeof(double) * NB * NB);          // diagonal block L(k,k)
+  hipMalloc((void**)&dR, sizeof(double) * NB * (mloc + 1)); // L(i,k)' of the local block rows
+  hipMalloc((void**)&dC, sizeof(double) * NB * (nloc + 1)); // L(j,k)' of the local block columns
+  hipMalloc((void**)&dB, sizeof(double) * N * NRHS);
+  hipMalloc((void**)&dW, sizeof(double) * NB * NRHS * (nblk + 1)); // partial products
+  hipMalloc((void**)&dT, sizeof(double) * NB * NRHS);
+  hipMalloc((void**)&dInfo, sizeof(rocblas_int) * nblk);
+  hipMemcpy(dA, hA, sizeof(double) * ld * nloc, hipMemcpyHostToDevice);
+  hipMemcpy(dB, hB, sizeof(double) * N * NRHS, hipMemcpyHostToDevice);
+  hipMemset(dInfo, 0, sizeof(rocblas_int) * nblk);
+
+  MPI_Barrier(MPI_COMM_WORLD);
+  double t0 = MPI_Wtime();
+
+  // distributed factorization A = L*L'
+  for (int k = 0; k < nblk; ++k) {
+    const int pk = k % P, qk = k % Q;
+    double *Akk = dA + (size_t)(k / P) * NB + (size_t)(k / Q) * NB * ld;
+
+    if (q == qk) {
+      // 1. factor and broadcast the diagonal block
+      if (p == pk) {
+        rocsolver_dpotrf(handle, rocblas_fill_lower, NB, Akk, ld, dInfo + k);
+        hipMemcpy2DAsync(dD, sizeof(double) * NB, Akk, sizeof(double) * ld,
+                         sizeof(double) * NB, NB, hipMemcpyDeviceToDevice, stream);
+      }
+      CHECK_NCCL(ncclBroadcast(dD, dD, NB * NB, ncclDouble, pk, col, stream));
+
+      // 2. compute the local blocks of the panel below the diagonal, and store them transposed
+      // in dR, where every NB-by-NB block is contiguous
+      const int li0 = num_local(k + 1, p, P);
+      double *Aik = dA + (size_t)li0 * NB + (size_t)(k / Q) * NB * ld;
+      if (mloc - li0 * NB > 0) {
+        rocblas_dtrsm(handle, rocblas_side_right, rocblas_fill_lower, rocblas_operation_transpose,
+                      rocblas_diagonal_non_unit, mloc - li0 * NB, NB, &one, dD, NB, Aik, ld);
+        rocblas_dgeam(handle, rocblas_operation_transpose, rocblas_operation_none, NB,
+                      mloc - li0 * NB, &one, Aik, ld, &zero, dR + (size_t)li0 * NB * NB, NB,
+                      dR + (size_t)li0 * NB * NB, NB);
+      }
+    }
+    CHECK_NCCL(ncclBroadcast(dR, dR, NB * mloc, ncclDouble, qk, row, stream));
+
+    // 3. gather the blocks L(j,k)' of the local block columns j > k; block j is in dR of the
+    // processes of row j % P
+    CHECK_NCCL(ncclGroupStart());
+    for (int j = k + 1; j < nblk; ++j)
+      if (j % Q == q)
+        CHECK_NCCL(ncclBroadcast(dR + (size_t)(j / P) * NB * NB, dC + (size_t)(j / Q) * NB * NB,
+                                 NB * NB, ncclDouble, j % P, col, stream));
+    CHECK_NCCL(ncclGroupEnd());
+
+    // 4. update the local blocks (i,j) of the trailing matrix, with i >= j > k (the upper
+    // triangle of the diagonal blocks is also updated, but it is never referenced)
+    for (int lj = num_local(k + 1, q, Q); lj < nb; ++lj) {
+      const int j = lj * Q + q;
+      const int li = num_local(j, p, P);
+      if (mloc - li * NB > 0)
+        rocblas_dgemm(handle, rocblas_operation_transpose, rocblas_operation_none,
+                      mloc - li * NB, NB, NB, &minus_one, dR + (size_t)li * NB * NB, NB,
+                      dC + (size_t)lj * NB * NB, NB, &one,
+                      dA + (size_t)li * NB + (size_t)lj * NB * ld, ld);
+    }
+  }
+
+  // forward substitution, L*Y = B; dW accumulates the products L(i,k)*Y(k) of the local
+  // block rows i
+  hipMemsetAsync(dW, 0, sizeof(double) * NB * NRHS * (mb + 1), stream);
+  for (int k = 0; k < nblk; ++k) {
+    const int pk = k % P, qk = k % Q;
+    double *Akk = dA + (size_t)(k / P) * NB + (size_t)(k / Q) * NB * ld;
+    double *Bk = dB + (size_t)k * NB * NRHS;
+
+    if (p == pk) {
+      CHECK_NCCL(ncclReduce(dW + (size_t)(k / P) * NB * NRHS, dT, NB * NRHS, ncclDouble, ncclSum,
+                            qk, row, stream));
+      if (q == qk) {
+        rocblas_daxpy(handle, NB * NRHS, &minus_one, dT, 1, Bk, 1);
+        rocblas_dtrsm(handle, rocblas_side_left, rocblas_fill_lower, rocblas_operation_none,
+                      rocblas_diagonal_non_unit, NB, NRHS, &one, Akk, ld, Bk, NB);
+      }
+    }
+    CHECK_NCCL(ncclBroadcast(Bk, Bk, NB * NRHS, ncclDouble, pk + qk * P, world, stream));
+
+    const int li0 = num_local(k + 1, p, P);
+    const double *Aik = dA + (size_t)li0 * NB + (size_t)(k / Q) * NB * ld;
+    if (q == qk && mb - li0 > 0)
+      rocblas_dgemm_strided_batched(handle, rocblas_operation_none, rocblas_operation_none, NB,
+                                    NRHS, NB, &one, Aik, ld, NB, Bk, NB, 0, &one,
+                                    dW + (size_t)li0 * NB * NRHS, NB, NB * NRHS, mb - li0);
+  }
+
+  // backward substitution, L'*X = Y; dW accumulates the products L(k,j)'*X(k) of the local
+  // block columns j
+  hipMemsetAsync(dW, 0, sizeof(double) * NB * NRHS * (nb + 1), stream);
+  for (int k = nblk - 1; k >= 0; --k) {
+    const int pk = k % P, qk = k % Q;
+    double *Akk = dA + (size_t)(k / P) * NB + (size_t)(k / Q) * NB * ld;
+    double *Bk = dB + (size_t)k * NB * NRHS;
+
+    if (q == qk) {
+      CHECK_NCCL(ncclReduce(dW + (size_t)(k / Q) * NB * NRHS, dT, NB * NRHS, ncclDouble, ncclSum,
+                            pk, col, stream));
+      if (p == pk) {
+        rocblas_daxpy(handle, NB * NRHS, &minus_one, dT, 1, Bk, 1);
+        rocblas_dtrsm(handle, rocblas_side_left, rocblas_fill_lower, rocblas_operation_transpose,
+                      rocblas_diagonal_non_unit, NB, NRHS, &one, Akk, ld, Bk, NB);
+      }
+    }
+    CHECK_NCCL(ncclBroadcast(Bk, Bk, NB * NRHS, ncclDouble, pk + qk * P, world, stream));
+
+    const int nj = num_local(k, q, Q);
+    if (p == pk && nj > 0)
+      rocblas_dgemm_strided_batched(handle, rocblas_operation_transpose, rocblas_operation_none,
+                                    NB, NRHS, NB, &one, dA + (size_t)(k / P) * NB, ld,
+                                    (rocblas_stride)NB * ld, Bk, NB, 0, &one, dW, NB, NB * NRHS,
+                                    nj);
+  }
+  hipStreamSynchronize(stream);
+  double t1 = MPI_Wtime();
+
+  // check that the matrix was positive definite (the first non-positive minor, if any, is
+  // reported by the owner of its diagonal block) and that the solution is correct
+  rocblas_int hInfo[nblk];
+  hipMemcpy(hInfo, dInfo, sizeof(rocblas_int) * nblk, hipMemcpyDeviceToHost);
+  int info = INT_MAX;
+  for (int k = 0; k < nblk; ++k)
+    if (hInfo[k] > 0 && k * NB + hInfo[k] < info)
+      info = k * NB + hInfo[k];
+  MPI_Allreduce(MPI_IN_PLACE, &info, 1, MPI_INT, MPI_MIN, MPI_COMM_WORLD);
+
+  hipMemcpy(hB, dB, sizeof(double) * N * NRHS, hipMemcpyDeviceToHost);
+  double max_err = 0;
+  for (int i = 0; i < N * NRHS; ++i)
+    if (fabs(hB[i] - 1) > max_err)
+      max_err = fabs(hB[i] - 1);
+
+  if (rank == 0) {
+    if (info != INT_MAX)
+      printf("the leading minor of order %d is not positive definite\n", info);
+    else
+      printf("solved a system of order %d on a %d x %d process grid in %.3f s, max error = %e\n",
+             N, P, Q, t1 - t0, max_err);
+  }
+
+  // clean up
+  hipFree(dA);
+  hipFree(dD);
+  hipFree(dR);
+  hipFree(dC);
+  hipFree(dB);
+  hipFree(dW);
+  hipFree(dT);
+  hipFree(dInfo);
+  rocblas_destroy_handle(handle);
+  ncclCommDestroy(world);
+  ncclCommDestroy(row);
+  ncclCommDestroy(col);
+  MPI_Comm_free(&row_mpi);
+  MPI_Comm_free(&col_mpi);
+  MPI_Comm_free(&node_comm);
+  free(hA);
+  free(hB);
+  MPI_Finalize();
+  return 0;
+}
@@ -55,13 +55,6 @@ int main() {
   rocblas_handle handle;
   rocblas_create_handle(&handle);
 
-  // Some rocsolver functions may trigger rocblas to load its GEMM kernels.
-  // You can preload the kernels by explicitly invoking rocblas_initialize
-  // (e.g., to exclude one-time initialization overhead from benchmarking).
-
-  // preload rocBLAS GEMM kernels (optional)
-  // rocblas_initialize();
-
   // calculate the sizes of our arrays
   size_t size_A = lda * (size_t)N;   // count of elements in matrix A
   size_t size_piv = (M < N) ? M : N; // count of Householder scalars
@@ -80,6 +73,12 @@ int main() {
   hipStreamCreate(&stream);
   rocblas_set_stream(handle, stream);
 
+  // warm up rocsolver_dgeqrf for this size before the capture (optional):
+  // the kernels are loaded and the device workspace of the handle is allocated
+  // outside of the graph
+  rocsolver_problem_shape shape = {rocsolver_function_geqrf, rocblas_datatype_f64_r, M, N, 0, 0};
+  rocsolver_initialize(handle, &shape, 1);
+
   // create graph management objects
   hipGraph_t graph;
   rocblas_int graph_ready = 0;
@@ -0,0 +1,259 @@
+#include <hip/hip_runtime_api.h> // for hip functions
+#include <rocsolver/rocsolver.h> // for all the rocsolver C interfaces and type declarations
+#include <math.h>    // for fabs
+#include <stdio.h>   // for printf
+#include <stdlib.h>  // for malloc
+
+// Example: Solve a linear system whose matrix is distributed over all the GPUs of the node.
+//
+// The N-by-N matrix A is split in column blocks of width NB that are assigned to the devices
+// in a block-cyclic fashion (block j lives on device j % ndev). At step k, the owner of block k
+// factors the panel with rocsolver_dgetrf, the panel and its pivots are broadcast to the other
+// devices with peer copies, and every device updates its own trailing columns with
+// rocsolver_dlaswp, rocblas_dtrsm and rocblas_dgemm. The owner of block k+1 updates and factors
+// its next panel first (look-ahead), so the next broadcast can start while the rest of the
+// trailing matrix is still being updated on the other devices. Cross-device ordering is
+// expressed with HIP events only; the host never waits inside the factorization.
+//
+// The triangular solves then stream the factored column blocks, one at a time, to device 0
+// where the right-hand side lives, so no device ever needs to hold the whole matrix.
+
+#define MAX_DEVICES 16
+
+static const double one = 1;
+static const double minus_one = -1;
+
+typedef struct {
+  rocblas_handle handle;
+  hipStream_t stream;
+  hipEvent_t ready;  // recorded after the device factors one of its panels
+  hipEvent_t copied; // recorded after the device receives the current panel
+  double *dA;        // local column blocks, N-by-nloc with leading dimension N
+  double *dW;        // receive buffer for one panel, N-by-NB with leading dimension N
+  rocblas_int *dIpiv; // pivots of all the panels; the jb entries of step k start at row k*NB
+  rocblas_int *dInfo;
+  rocblas_int nloc;   // number of local columns
+} device_data;
+
+// number of column blocks of device d with global index <= k
+static rocblas_int blocks_upto(rocblas_int k, int d, int ndev) {
+  return (k >= d) ? (k - d) / ndev + 1 : 0;
+}
+
+// apply the pivots of step k to ncols local columns starting at column c0 and, if update is
+// set, compute the corresponding block row of U and update the trailing submatrix
+static void update_columns(device_data *g, rocblas_int N, rocblas_int r0, rocblas_int jb,
+                           const double *L, rocblas_int c0, rocblas_int ncols, int update) {
+  if (ncols <= 0)
+    return;
+  double *A = g->dA + r0 + (size_t)c0 * N;
+  rocsolver_dlaswp(g->handle, ncols, A, N, 1, jb, g->dIpiv + r0, 1);
+  if (!update)
+    return;
+  rocblas_dtrsm(g->handle, rocblas_side_left, rocblas_fill_lower, rocblas_operation_none,
+                rocblas_diagonal_unit, jb, ncols, &one, L, N, A, N);
+  if (N - r0 - jb > 0)
+    rocblas_dgemm(g->handle, rocblas_operation_none, rocblas_operation_none, N - r0 - jb,
+                  ncols, jb, &minus_one, L + jb, N, A, N, &one, A + jb, N);
+}
+
+// factor the panel of block k on its owner and signal the other devices
+static void factor_panel(device_data *g, rocblas_int N, rocblas_int NB, rocblas_int k, int ndev) {
+  rocblas_int r0 = k * NB;
+  rocblas_int jb = (N - r0 < NB) ? N - r0 : NB;
+  double *panel = g->dA + r0 + (size_t)(k / ndev) * NB * N;
+  rocsolver_dgetrf(g->handle, N - r0, jb, panel, N, g->dIpiv + r0, g->dInfo);
+  hipEventRecord(g->ready, g->stream);
+}
+
+// We use rocsolver_dgetrf, rocsolver_dlaswp and rocBLAS to factor a real N-by-N matrix, A,
+// distributed over all the devices, and then solve A*X = B for one right-hand side.
+// See https://rocm.docs.amd.com/projects/rocSOLVER/en/latest/api/lapack.html#rocsolver-type-getrf
+int main() {
+  const rocblas_int N = 4096; // order of the system
+  const rocblas_int NB = 256; // width of the distributed column blocks
+  const rocblas_int nblk = (N + NB - 1) / NB;
+
+  int ndev;
+  hipGetDeviceCount(&ndev);
+  if (ndev > MAX_DEVICES)
+    ndev = MAX_DEVICES;
+  if (ndev < 1) {
+    printf("no devices found\n");
+    return 1;
+  }
+
+  // enable direct peer access (e.g. over XGMI) where it is supported; peer copies between
+  // devices without it are still correct, only slower
+  for (int d = 0; d < ndev; ++d) {
+    hipSetDevice(d);
+    for (int p = 0; p < ndev; ++p) {
+      int can_access = 0;
+      if (p != d && hipDeviceCanAccessPeer(&can_access, d, p) == hipSuccess && can_access)
+        hipDeviceEnablePeerAccess(p, 0);
+    }
+  }
+
+  // initialize a matrix with random entries, and the right-hand side B = A * ones, so that
+  // the solution is a vector of ones
+  double *hA = (double*)malloc(sizeof(double)*N*N);
+  double *hB = (double*)malloc(sizeof(double)*N);
+  for (rocblas_int i = 0; i < N; ++i)
+    hB[i] = 0;
+  for (rocblas_int j = 0; j < N; ++j) {
+    for (rocblas_int i = 0; i < N; ++i) {
+      hA[i + (size_t)j*N] = (double)rand() / RAND_MAX - 0.5;
+      hB[i] += hA[i + (size_t)j*N];
+    }
+  }
+
+  // set up each device and copy its column blocks into its local storage
+  device_data g[MAX_DEVICES];
+  for (int d = 0; d < ndev; ++d) {
+    hipSetDevice(d);
+    rocblas_create_handle(&g[d].handle);
+    rocblas_get_stream(g[d].handle, &g[d].stream);
+    hipEventCreateWithFlags(&g[d].ready, hipEventDisableTiming);
+    hipEventCreateWithFlags(&g[d].copied, hipEventDisableTiming);
+
+    g[d].nloc = 0;
+    for (rocblas_int j = d; j < nblk; j += ndev)
+      g[d].nloc += (N - j * NB < NB) ? N - j * NB : NB;
+    hipMalloc((void**)&g[d].dA, sizeof(double)*N*(g[d].nloc > 0 ? g[d].nloc : 1));
+    hipMalloc((void**)&g[d].dW, sizeof(double)*N*NB);
+    hipMalloc((void**)&g[d].dIpiv, sizeof(rocblas_int)*N);
+    hipMalloc((void**)&g[d].dInfo, sizeof(rocblas_int));
+
+    for (rocblas_int j = d, t = 0; j < nblk; j += ndev, ++t) {
+      rocblas_int wj = (N - j * NB < NB) ? N - j * NB : NB;
+      hipMemcpy(g[d].dA + (size_t)t * NB * N, hA + (size_t)j * NB * N, sizeof(double)*N*wj,
+                hipMemcpyHostToDevice);
+    }
+  }
+
+  // distributed factorization P*A = L*U
+  hipSetDevice(0);
+  factor_panel(&g[0], N, NB, 0, ndev);
+  for (rocblas_int k = 0; k < nblk; ++k) {
+    int owner = k % ndev;
+    int next = (k + 1) % ndev;
+    rocblas_int r0 = k * NB;
+    rocblas_int jb = (N - r0 < NB) ? N - r0 : NB;
+    double *panel = g[owner].dA + r0 + (size_t)(k / ndev) * NB * N;
+
+    // the previous owner will now apply the new row interchanges to its previous panel, so it
+    // must wait until every device has received it (the waits are deferred to this point so
+    // that the previous owner could update its trailing columns meanwhile)
+    if (k > 0) {
+      int prev = (k - 1) % ndev;
+      hipSetDevice(prev);
+      for (int d = 0; d < ndev; ++d)
+        if (d != prev)
+          hipStreamWaitEvent(g[prev].stream, g[d].copied, 0);
+    }
+
+    // broadcast the factored panel (rows r0 to N-1) and its pivots
+    for (int d = 0; d < ndev; ++d) {
+      if (d == owner)
+        continue;
+      hipSetDevice(d);
+      hipStreamWaitEvent(g[d].stream, g[owner].ready, 0);
+      hipMemcpyPeerAsync(g[d].dW + r0, d, panel, owner,
+                         sizeof(double)*((size_t)(jb - 1) * N + N - r0), g[d].stream);
+      hipMemcpyPeerAsync(g[d].dIpiv + r0, d, g[owner].dIpiv + r0, owner,
+                         sizeof(rocblas_int)*jb, g[d].stream);
+      hipEventRecord(g[d].copied, g[d].stream);
+    }
+
+    // update the local columns; the owner of the next panel handles it first
+    for (int d = 0; d < ndev; ++d) {
+      hipSetDevice(d);
+      const double *L = (d == owner) ? panel : g[d].dW + r0;
+      rocblas_int done = blocks_upto(k, d, ndev);
+      rocblas_int left = (d == owner) ? (done - 1) * NB : done * NB;
+      rocblas_int c0 = done * NB;
+
+      if (d == next && k + 1 < nblk) {
+        rocblas_int wn = (N - (k + 1) * NB < NB) ? N - (k + 1) * NB : NB;
+        update_columns(&g[d], N, r0, jb, L, c0, wn, 1);
+        factor_panel(&g[d], N, NB, k + 1, ndev);
+        c0 += wn;
+      }
+      update_columns(&g[d], N, r0, jb, L, c0, g[d].nloc - c0, 1);
+      update_columns(&g[d], N, r0, jb, L, 0, left, 0);
+    }
+  }
+  for (int d = 0; d < ndev; ++d) {
+    hipSetDevice(d);
+    hipStreamSynchronize(g[d].stream);
+  }
+
+  // solve L*U*X = P*B on device 0, streaming one column block of the factors at a time
+  hipSetDevice(0);
+  double *dB;
+  hipMalloc((void**)&dB, sizeof(double)*N);
+  hipMemcpy(dB, hB, sizeof(double)*N, hipMemcpyHostToDevice);
+  rocblas_handle handle = g[0].handle;
+  hipStream_t stream = g[0].stream;
+
+  // apply the row interchanges of all the steps, in order (every device already received
+  // the pivots of all the panels during the broadcasts)
+  for (rocblas_int k = 0; k < nblk; ++k) {
+    rocblas_int r0 = k * NB;
+    rocblas_int jb = (N - r0 < NB) ? N - r0 : NB;
+    rocsolver_dlaswp(handle, 1, dB + r0, N, 1, jb, g[0].dIpiv + r0, 1);
+  }
+
+  // forward substitution with the unit lower triangular factor, then backward substitution
+  // with the upper triangular factor
+  for (int pass = 0; pass < 2; ++pass) {
+    for (rocblas_int s = 0; s < nblk; ++s) {
+      rocblas_int k = (pass == 0) ? s : nblk - 1 - s;
+      int owner = k % ndev;
+      rocblas_int r0 = k * NB;
+      rocblas_int jb = (N - r0 < NB) ? N - r0 : NB;
+      const double *blk = g[owner].dA + (size_t)(k / ndev) * NB * N;
+      if (owner != 0) {
+        hipMemcpyPeerAsync(g[0].dW, 0, blk, owner, sizeof(double)*N*jb, stream);
+        blk = g[0].dW;
+      }
+
+      if (pass == 0) {
+        rocblas_dtrsm(handle, rocblas_side_left, rocblas_fill_lower, rocblas_operation_none,
+                      rocblas_diagonal_unit, jb, 1, &one, blk + r0, N, dB + r0, N);
+        if (N - r0 - jb > 0)
+          rocblas_dgemv(handle, rocblas_operation_none, N - r0 - jb, jb, &minus_one,
+                        blk + r0 + jb, N, dB + r0, 1, &one, dB + r0 + jb, 1);
+      } else {
+        rocblas_dtrsm(handle, rocblas_side_left, rocblas_fill_upper, rocblas_operation_none,
+                      rocblas_diagonal_non_unit, jb, 1, &one, blk + r0, N, dB + r0, N);
+        if (r0 > 0)
+          rocblas_dgemv(handle, rocblas_operation_none, r0, jb, &minus_one, blk, N, dB + r0,
+                        1, &one, dB, 1);
+      }
+    }
+  }
+
+  // copy the solution back and check it
+  hipMemcpy(hB, dB, sizeof(double)*N, hipMemcpyDeviceToHost);
+  double max_err = 0;
+  for (rocblas_int i = 0; i < N; ++i)
+    if (fabs(hB[i] - 1) > max_err)
+      max_err = fabs(hB[i] - 1);
+  printf("solved a system of order %d on %d device(s), max error = %e\n", N, ndev, max_err);
+
+  // clean up
+  hipFree(dB);
+  for (int d = 0; d < ndev; ++d) {
+    hipSetDevice(d);
+    hipFree(g[d].dA);
+    hipFree(g[d].dW);
+    hipFree(g[d].dIpiv);
+    hipFree(g[d].dInfo);
+    hipEventDestroy(g[d].ready);
+    hipEventDestroy(g[d].copied);
+    rocblas_destroy_handle(g[d].handle);
+  }
+  free(hA);
+  free(hB);
+}
@@ -0,0 +1,208 @@
+#include <hip/hip_runtime_api.h> // for hip functions
+#include <rocsolver/rocsolver.h> // for all the rocsolver C interfaces and type declarations
+#include <math.h>    // for fabs
+#include <stdio.h>   // for printf
+#include <stdlib.h>  // for malloc
+
+// Example: Compute the eigenvalues and eigenvectors of a symmetric tridiagonal matrix whose
+// eigenvector matrix is distributed over all the GPUs of the node.
+//
+// The N-by-N eigenvector matrix of a tridiagonal matrix T is dense, and for very large N it
+// does not fit in the memory of a single device. Here the spectrum of T is sliced instead: the
+// eigenvalues are first computed by bisection with rocsolver_dstebz (which needs only O(N)
+// memory), and then each device computes the eigenvectors of a contiguous range of eigenvalues
+// with rocsolver_dstebz and rocsolver_dstein. Every device holds only its own N-by-nloc block of
+// columns, and the devices work independently of each other.
+//
+// Inverse iteration reorthogonalizes the eigenvectors of eigenvalues that are closer than
+// 1e-3 * ||T||_1 (see rocsolver_dstein), so the slice boundaries are moved to the nearest gap
+// larger than that. In this way, the distributed eigenvectors are exactly the ones that a single
+// call to rocsolver_dstein would compute.
+
+#define MAX_DEVICES 16
+
+typedef struct {
+  rocblas_handle handle;
+  hipStream_t stream;
+  double *dD;          // diagonal of T
+  double *dE;          // off-diagonal of T
+  double *dW;          // eigenvalues of the local slice
+  double *dZ;          // local eigenvectors, N-by-nloc with leading dimension N
+  rocblas_int *dIblock;
+  rocblas_int *dIsplit;
+  rocblas_int *dIfail;
+  rocblas_int *dNev;
+  rocblas_int *dNsplit;
+  rocblas_int *dInfo;
+  rocblas_int il, iu;  // global indices (1-based) of the eigenvalues of the local slice
+  rocblas_int nloc;    // number of local eigenvectors
+} device_data;
+
+// We use rocsolver_dstebz and rocsolver_dstein to compute all the eigenvalues and eigenvectors
+// of a real symmetric tridiagonal matrix, T, with the eigenvectors distributed over all the
+// devices.
+// See https://rocm.docs.amd.com/projects/rocSOLVER/en/latest/api/auxiliary.html#rocsolver-type-stein
+int main() {
+  const rocblas_int N = 2048; // order of the tridiagonal matrix
+
+  int ndev;
+  hipGetDeviceCount(&ndev);
+  if (ndev > MAX_DEVICES)
+    ndev = MAX_DEVICES;
+  if (ndev < 1) {
+    printf("no devices found\n");
+    return 1;
+  }
+
+  // initialize a tridiagonal matrix with random entries
+  double *hD = (double*)malloc(sizeof(double)*N);
+  double *hE = (double*)malloc(sizeof(double)*N);
+  double *hW = (double*)malloc(sizeof(double)*N);
+  for (rocblas_int i = 0; i < N; ++i) {
+    hD[i] = (double)rand() / RAND_MAX - 0.5;
+    hE[i] = (i < N - 1) ? (double)rand() / RAND_MAX - 0.5 : 0;
+  }
+
+  // set up each device and copy the matrix
+  device_data g[MAX_DEVICES];
+  for (int d = 0; d < ndev; ++d) {
+    hipSetDevice(d);
+    rocblas_create_handle(&g[d].handle);
+    rocblas_get_stream(g[d].handle, &g[d].stream);
+    hipMalloc((void**)&g[d].dD, sizeof(double)*N);
+    hipMalloc((void**)&g[d].dE, sizeof(double)*N);
+    hipMalloc((void**)&g[d].dW, sizeof(double)*N);
+    hipMalloc((void**)&g[d].dIblock, sizeof(rocblas_int)*N);
+    hipMalloc((void**)&g[d].dIsplit, sizeof(rocblas_int)*N);
+    hipMalloc((void**)&g[d].dIfail, sizeof(rocblas_int)*N);
+    hipMalloc((void**)&g[d].dNev, sizeof(rocblas_int));
+    hipMalloc((void**)&g[d].dNsplit, sizeof(rocblas_int));
+    hipMalloc((void**)&g[d].dInfo, sizeof(rocblas_int));
+    hipMemcpy(g[d].dD, hD, sizeof(double)*N, hipMemcpyHostToDevice);
+    hipMemcpy(g[d].dE, hE, sizeof(double)*N, hipMemcpyHostToDevice);
+    g[d].dZ = NULL;
+  }
+
+  // compute all the eigenvalues, in ascending order, on device 0
+  hipSetDevice(0);
+  rocsolver_dstebz(g[0].handle, rocblas_erange_all, rocblas_eorder_entire, N, 0, 0, 0, 0, 0,
+                   g[0].dD, g[0].dE, g[0].dNev, g[0].dNsplit, g[0].dW, g[0].dIblock,
+                   g[0].dIsplit, g[0].dInfo);
+  hipMemcpy(hW, g[0].dW, sizeof(double)*N, hipMemcpyDeviceToHost);
+
+  // slice the spectrum in ndev ranges of about N/ndev eigenvalues each, moving every boundary
+  // to the nearest gap that is larger than the reorthogonalization threshold of dstein
+  double onenrm = 0;
+  for (rocblas_int i = 0; i < N; ++i) {
+    double r = fabs(hD[i]) + fabs(hE[i]) + (i > 0 ? fabs(hE[i - 1]) : 0);
+    if (r > onenrm)
+      onenrm = r;
+  }
+  double ortol = 1e-3 * onenrm;
+
+  rocblas_int lo = 0;
+  for (int d = 0; d < ndev; ++d) {
+    rocblas_int hi = N;
+    if (d < ndev - 1) {
+      rocblas_int target = (rocblas_int)(((long long)N * (d + 1)) / ndev);
+      hi = lo;
+      for (rocblas_int s = 0; s < N; ++s) {
+        if (target + s < N && target + s > lo && hW[target + s] - hW[target + s - 1] > ortol) {
+          hi = target + s;
+          break;
+        }
+        if (target - s > lo && target - s < N && hW[target - s] - hW[target - s - 1] > ortol) {
+          hi = target - s;
+          break;
+        }
+      }
+    }
+    g[d].il = lo + 1;
+    g[d].iu = hi;
+    g[d].nloc = hi - lo;
+    lo = hi;
+  }
+
+  // compute the local eigenvectors; the devices run concurrently
+  for (int d = 0; d < ndev; ++d) {
+    if (g[d].nloc == 0)
+      continue;
+    hipSetDevice(d);
+    hipMalloc((void**)&g[d].dZ, sizeof(double)*N*g[d].nloc);
+
+    // recompute the local eigenvalues, ordered by split-off block as required by dstein
+    rocsolver_dstebz(g[d].handle, rocblas_erange_index, rocblas_eorder_blocks, N, 0, 0, g[d].il,
+                     g[d].iu, 0, g[d].dD, g[d].dE, g[d].dNev, g[d].dNsplit, g[d].dW,
+                     g[d].dIblock, g[d].dIsplit, g[d].dInfo);
+    rocsolver_dstein(g[d].handle, N, g[d].dD, g[d].dE, g[d].dNev, g[d].dW, g[d].dIblock,
+                     g[d].dIsplit, g[d].dZ, N, g[d].dIfail, g[d].dInfo);
+  }
+  for (int d = 0; d < ndev; ++d) {
+    hipSetDevice(d);
+    hipStreamSynchronize(g[d].stream);
+  }
+
+  // check the results: copy the eigenvectors back one device at a time, and compute the
+  // residuals T*z - lambda*z and the orthogonality of consecutive eigenvectors (including
+  // the ones at both sides of a slice boundary)
+  double *hZ = (double*)malloc(sizeof(double)*N*N);
+  double *hWl = (double*)malloc(sizeof(double)*N);
+  rocblas_int ncols = 0, failed = 0;
+  for (int d = 0; d < ndev; ++d) {
+    if (g[d].nloc == 0)
+      continue;
+    hipSetDevice(d);
+    rocblas_int info;
+    hipMemcpy(&info, g[d].dInfo, sizeof(rocblas_int), hipMemcpyDeviceToHost);
+    failed += info;
+    hipMemcpy(hZ + (size_t)ncols * N, g[d].dZ, sizeof(double)*N*g[d].nloc,
+              hipMemcpyDeviceToHost);
+    hipMemcpy(hWl + ncols, g[d].dW, sizeof(double)*g[d].nloc, hipMemcpyDeviceToHost);
+    ncols += g[d].nloc;
+  }
+
+  double max_res = 0, max_orth = 0;
+  for (rocblas_int j = 0; j < ncols; ++j) {
+    const double *z = hZ + (size_t)j * N;
+    for (rocblas_int i = 0; i < N; ++i) {
+      double r = hD[i] * z[i] - hWl[j] * z[i];
+      if (i > 0)
+        r += hE[i - 1] * z[i - 1];
+      if (i < N - 1)
+        r += hE[i] * z[i + 1];
+      if (fabs(r) > max_res)
+        max_res = fabs(r);
+    }
+    if (j > 0) {
+      double dot = 0;
+      for (rocblas_int i = 0; i < N; ++i)
+        dot += z[i] * z[i - N];
+      if (fabs(dot) > max_orth)
+        max_orth = fabs(dot);
+    }
+  }
+  printf("computed %d eigenvectors of order %d on %d device(s)\n", ncols, N, ndev);
+  printf("max residual = %e, max orthogonality error = %e, failed = %d\n", max_res, max_orth,
+         failed);
+
+  // clean up
+  for (int d = 0; d < ndev; ++d) {
+    hipSetDevice(d);
+    hipFree(g[d].dD);
+    hipFree(g[d].dE);
+    hipFree(g[d].dW);
+    hipFree(g[d].dZ);
+    hipFree(g[d].dIblock);
+    hipFree(g[d].dIsplit);
+    hipFree(g[d].dIfail);
+    hipFree(g[d].dNev);
+    hipFree(g[d].dNsplit);
+    hipFree(g[d].dInfo);
+    rocblas_destroy_handle(g[d].handle);
+  }
+  free(hD);
+  free(hE);
+  free(hW);
+  free(hZ);
+  free(hWl);
+}
@@ -0,0 +1,91 @@
+#include <hip/hip_runtime_api.h> // for hip functions
+#include <rocsolver/rocsolver.h> // for all the rocsolver C interfaces and type declarations
+#include <stdio.h>   // for printf
+#include <stdlib.h>  // for malloc
+
+// Example: Carve the workspace of several handles from a single device buffer owned by the
+// application (e.g. obtained from its own caching allocator), so that rocSOLVER does not
+// allocate any device memory, and independent solves on different streams can overlap
+// using disjoint regions of the buffer.
+
+#define NUM_STREAMS 2
+#define ALIGNMENT 256
+
+int main() {
+  const rocblas_int N = 512;   // order of the linear systems
+  const rocblas_int NRHS = 4;  // number of right-hand sides
+  const rocblas_int BC = 16;   // number of systems solved by each stream
+
+  // one handle per stream
+  rocblas_handle handle[NUM_STREAMS];
+  hipStream_t stream[NUM_STREAMS];
+  for (int s = 0; s < NUM_STREAMS; ++s) {
+    rocblas_create_handle(&handle[s]);
+    hipStreamCreate(&stream[s]);
+    rocblas_set_stream(handle[s], stream[s]);
+  }
+
+  // workspace required by each stream: the largest of the functions that it calls
+  rocsolver_problem_shape getrf = {rocsolver_function_getrf, rocblas_datatype_f64_r,
+                                   N, N, 0, BC};
+  rocsolver_problem_shape getrs = {rocsolver_function_getrs, rocblas_datatype_f64_r,
+                                   N, N, NRHS, BC};
+  size_t size_getrf, size_getrs;
+  rocsolver_get_workspace_size(handle[0], &getrf, &size_getrf);
+  rocsolver_get_workspace_size(handle[0], &getrs, &size_getrs);
+  size_t region = size_getrf > size_getrs ? size_getrf : size_getrs;
+  region = (region + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+  printf("workspace region of each stream: %zu bytes\n", region);
+
+  // the application owns a single buffer, and gives a disjoint region of it to each handle
+  char *work;
+  hipMalloc((void**)&work, region * NUM_STREAMS);
+  for (int s = 0; s < NUM_STREAMS; ++s)
+    rocblas_set_workspace(handle[s], work + s * region, region);
+
+  // allocate the problems on the GPU
+  const rocblas_stride strideA = (rocblas_stride)N * N;
+  const rocblas_stride strideB = (rocblas_stride)N * NRHS;
+  double *dA[NUM_STREAMS], *dB[NUM_STREAMS];
+  rocblas_int *dIpiv[NUM_STREAMS], *dInfo[NUM_STREAMS];
+  double *hA = (double*)malloc(sizeof(double)*strideA*BC);
+  for (size_t i = 0; i < (size_t)strideA * BC; ++i) // diagonally dominant matrices
+    hA[i] = ((i % strideA) % (N + 1) == 0) ? 2 * N : 1;
+  for (int s = 0; s < NUM_STREAMS; ++s) {
+    hipMalloc((void**)&dA[s], sizeof(double)*strideA*BC);
+    hipMalloc((void**)&dB[s], sizeof(double)*strideB*BC);
+    hipMalloc((void**)&dIpiv[s], sizeof(rocblas_int)*N*BC);
+    hipMalloc((void**)&dInfo[s], sizeof(rocblas_int)*BC);
+    hipMemcpy(dA[s], hA, sizeof(double)*strideA*BC, hipMemcpyHostToDevice);
+    hipMemset(dB[s], 0, sizeof(double)*strideB*BC);
+  }
+  free(hA);
+
+  // the solves on different streams can overlap, as their workspaces do not alias
+  for (int s = 0; s < NUM_STREAMS; ++s) {
+    rocblas_status st1 = rocsolver_dgetrf_strided_batched(handle[s], N, N, dA[s], N, strideA,
+                                                          dIpiv[s], N, dInfo[s], BC);
+    rocblas_status st2 = rocsolver_dgetrs_strided_batched(handle[s], rocblas_operation_none, N,
+                                                          NRHS, dA[s], N, strideA, dIpiv[s], N,
+                                                          dB[s], N, strideB, BC);
+    if (st1 != rocblas_status_success || st2 != rocblas_status_success)
+      printf("stream %d: the solve failed\n", s);
+  }
+
+  // wait for the computations to finish
+  for (int s = 0; s < NUM_STREAMS; ++s)
+    hipStreamSynchronize(stream[s]);
+  printf("solved %d systems on each of %d streams\n", BC, NUM_STREAMS);
+
+  // clean up: the handles stop using the buffer before it is released
+  for (int s = 0; s < NUM_STREAMS; ++s) {
+    rocblas_set_workspace(handle[s], NULL, 0);
+    hipFree(dA[s]);
+    hipFree(dB[s]);
+    hipFree(dIpiv[s]);
+    hipFree(dInfo[s]);
+    rocblas_destroy_handle(handle[s]);
+    hipStreamDestroy(stream[s]);
+  }
+  hipFree(work);
+}
@@ -0,0 +1,82 @@
+#include <hip/hip_runtime_api.h> // for hip functions
+#include <rocsolver/rocsolver.h> // for all the rocsolver C interfaces and type declarations
+#include <stdio.h>   // for printf
+#include <stdlib.h>  // for malloc
+
+// Example: Preallocate the workspace required by all the problem shapes that will be solved,
+// so that no device memory is allocated (and no synchronization occurs) inside the solve loop.
+
+#define NUM_SHAPES 3
+
+int main() {
+  // the shapes of the linear systems that will be solved (order, number of rhs and batch count)
+  const rocblas_int N[NUM_SHAPES] = {16, 64, 256};
+  const rocblas_int NRHS[NUM_SHAPES] = {1, 4, 8};
+  const rocblas_int BC[NUM_SHAPES] = {1000, 200, 10};
+  const rocblas_int ITER_COUNT = 10;
+
+  // initialization
+  rocblas_handle handle;
+  rocblas_create_handle(&handle);
+
+  // register the shapes: while the query is active, rocsolver functions only
+  // report the amount of workspace they need (null pointers can be passed)
+  size_t memory_size;
+  rocblas_start_device_memory_size_query(handle);
+  for (int s = 0; s < NUM_SHAPES; ++s) {
+    rocsolver_dgetrf_strided_batched(handle, N[s], N[s], NULL, N[s], N[s] * N[s], NULL, N[s],
+                                     NULL, BC[s]);
+    rocsolver_dgetrs_strided_batched(handle, rocblas_operation_none, N[s], NRHS[s], NULL, N[s],
+                                     N[s] * N[s], NULL, N[s], NULL, N[s], N[s] * NRHS[s], BC[s]);
+  }
+  rocblas_stop_device_memory_size_query(handle, &memory_size);
+  printf("workspace required by all shapes: %zu bytes\n", memory_size);
+
+  // allocate the workspace once; rocsolver sub-allocates from it on every call
+  rocblas_set_device_memory_size(handle, memory_size);
+
+  // allocate the problems on the GPU
+  double *dA[NUM_SHAPES], *dB[NUM_SHAPES];
+  rocblas_int *dIpiv[NUM_SHAPES], *dInfo[NUM_SHAPES];
+  for (int s = 0; s < NUM_SHAPES; ++s) {
+    size_t size_A = (size_t)N[s] * N[s] * BC[s];
+    size_t size_B = (size_t)N[s] * NRHS[s] * BC[s];
+    double *hA = (double*)malloc(sizeof(double)*size_A);
+    for (size_t i = 0; i < size_A; ++i) // diagonally dominant matrices
+      hA[i] = ((i % (N[s] * N[s])) % (N[s] + 1) == 0) ? 2 * N[s] : 1;
+
+    hipMalloc((void**)&dA[s], sizeof(double)*size_A);
+    hipMalloc((void**)&dB[s], sizeof(double)*size_B);
+    hipMalloc((void**)&dIpiv[s], sizeof(rocblas_int)*N[s]*BC[s]);
+    hipMalloc((void**)&dInfo[s], sizeof(rocblas_int)*BC[s]);
+    hipMemcpy(dA[s], hA, sizeof(double)*size_A, hipMemcpyHostToDevice);
+    hipMemset(dB[s], 0, sizeof(double)*size_B);
+    free(hA);
+  }
+
+  // solve loop: no workspace allocation or reallocation happens here
+  for (int i = 0; i < ITER_COUNT; ++i) {
+    for (int s = 0; s < NUM_SHAPES; ++s) {
+      rocsolver_dgetrf_strided_batched(handle, N[s], N[s], dA[s], N[s], N[s] * N[s], dIpiv[s],
+                                       N[s], dInfo[s], BC[s]);
+      rocsolver_dgetrs_strided_batched(handle, rocblas_operation_none, N[s], NRHS[s], dA[s],
+                                       N[s], N[s] * N[s], dIpiv[s], N[s], dB[s], N[s],
+                                       N[s] * NRHS[s], BC[s]);
+    }
+  }
+
+  // wait for the computations to finish
+  hipStream_t stream;
+  rocblas_get_stream(handle, &stream);
+  hipStreamSynchronize(stream);
+  printf("solved %d iterations of %d shapes\n", ITER_COUNT, NUM_SHAPES);
+
+  // clean up
+  for (int s = 0; s < NUM_SHAPES; ++s) {
+    hipFree(dA[s]);
+    hipFree(dB[s]);
+    hipFree(dIpiv[s]);
+    hipFree(dInfo[s]);
+  }
+  rocblas_destroy_handle(handle);
+}
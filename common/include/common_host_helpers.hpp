@@ -74,6 +74,19 @@ constexpr double get_epsilon()
     return std::numeric_limits<S>::epsilon();
 }
 
+// (storage types without arithmetic support in std::numeric_limits)
+template <>
+constexpr double get_epsilon<rocblas_half>()
+{
+    return 0x1p-10;
+}
+
+template <>
+constexpr double get_epsilon<rocblas_bfloat16>()
+{
+    return 0x1p-7;
+}
+
 template <typename T>
 constexpr double get_safemin()
 {
@@ -1,5 +1,5 @@
 /* **************************************************************************
- * Copyright (C) 2018-2024 Advanced Micro Devices, Inc. All rights reserved.
+ * Copyright (C) 2018-2025 Advanced Micro Devices, Inc. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions
@@ -123,6 +123,7 @@ constexpr auto rocblas2char_workmode(rocblas_workmode value)
     {
     case rocblas_outofplace: return 'O';
     case rocblas_inplace: return 'I';
+    case rocblas_auto: return 'A';
     }
     return '\0';
 }
@@ -238,6 +239,64 @@ constexpr auto rocsolver2char_rfinfo_mode(rocsolver_rfinfo_mode value)
     {
     case rocsolver_rfinfo_mode_lu: return '1';
     case rocsolver_rfinfo_mode_cholesky: return '2';
+    case rocsolver_rfinfo_mode_qr: return '3';
+    }
+    return '\0';
+}
+
+constexpr auto rocsolver2char_rfinfo_solve_mode(rocsolver_rfinfo_solve_mode value)
+{
+    switch(value)
+    {
+    case rocsolver_rfinfo_solve_mode_rocsparse: return 'S';
+    case rocsolver_rfinfo_solve_mode_levels: return 'L';
+    }
+    return '\0';
+}
+
+constexpr auto rocsolver2char_rfinfo_refact_mode(rocsolver_rfinfo_refact_mode value)
+{
+    switch(value)
+    {
+    case rocsolver_rfinfo_refact_mode_rocsparse: return 'S';
+    case rocsolver_rfinfo_refact_mode_supernodal: return 'N';
+    }
+    return '\0';
+}
+
+constexpr auto rocsolver2char_rfinfo_precision_mode(rocsolver_rfinfo_precision_mode value)
+{
+    switch(value)
+    {
+    case rocsolver_rfinfo_precision_mode_full: return 'F';
+    case rocsolver_rfinfo_precision_mode_mixed: return 'M';
+    }
+    return '\0';
+}
+
+constexpr auto rocsolver2char_alg_mode(rocsolver_alg_mode value)
+{
+    switch(value)
+    {
+    case rocsolver_alg_mode_qr: return 'Q';
+    case rocsolver_alg_mode_dc: return 'D';
+    case rocsolver_alg_mode_hybrid: return 'H';
+    case rocsolver_alg_mode_qr_precond: return 'R';
+    case rocsolver_alg_mode_mixed: return 'M';
+    case rocsolver_alg_mode_shifted: return 'S';
+    case rocsolver_alg_mode_tournament: return 'T';
+    }
+    return '\0';
+}
+
+constexpr auto rocsolver2char_norm_type(rocsolver_norm_type value)
+{
+    switch(value)
+    {
+    case rocsolver_norm_max: return 'M';
+    case rocsolver_norm_one: return 'O';
+    case rocsolver_norm_inf: return 'I';
+    case rocsolver_norm_frobenius: return 'F';
     }
     return '\0';
 }
@@ -322,6 +381,7 @@ constexpr rocblas_workmode char2rocblas_workmode(char value)
     {
     case 'O': return rocblas_outofplace;
     case 'I': return rocblas_inplace;
+    case 'A': return rocblas_auto;
     default: return static_cast<rocblas_workmode>(0);
     }
 }
@@ -437,10 +497,70 @@ constexpr rocsolver_rfinfo_mode char2rocsolver_rfinfo_mode(char value)
     {
     case '1': return rocsolver_rfinfo_mode_lu;
     case '2': return rocsolver_rfinfo_mode_cholesky;
+    case '3': return rocsolver_rfinfo_mode_qr;
     default: return static_cast<rocsolver_rfinfo_mode>(0);
     }
 }
 
+constexpr rocsolver_rfinfo_solve_mode char2rocsolver_rfinfo_solve_mode(char value)
+{
+    switch(value)
+    {
+    case 'S': return rocsolver_rfinfo_solve_mode_rocsparse;
+    case 'L': return rocsolver_rfinfo_solve_mode_levels;
+    default: return static_cast<rocsolver_rfinfo_solve_mode>(0);
+    }
+}
+
+constexpr rocsolver_rfinfo_refact_mode char2rocsolver_rfinfo_refact_mode(char value)
+{
+    switch(value)
+    {
+    case 'S': return rocsolver_rfinfo_refact_mode_rocsparse;
+    case 'N': return rocsolver_rfinfo_refact_mode_supernodal;
+    default: return static_cast<rocsolver_rfinfo_refact_mode>(0);
+    }
+}
+
+constexpr rocsolver_rfinfo_precision_mode char2rocsolver_rfinfo_precision_mode(char value)
+{
+    switch(value)
+    {
+    case 'F': return rocsolver_rfinfo_precision_mode_full;
+    case 'M': return rocsolver_rfinfo_precision_mode_mixed;
+    default: return static_cast<rocsolver_rfinfo_precision_mode>(0);
+    }
+}
+
+constexpr rocsolver_alg_mode char2rocsolver_alg_mode(char value)
+{
+    switch(value)
+    {
+    case 'Q': return rocsolver_alg_mode_qr;
+    case 'D': return rocsolver_alg_mode_dc;
+    case 'H': return rocsolver_alg_mode_hybrid;
+    case 'R': return rocsolver_alg_mode_qr_precond;
+    case 'M': return rocsolver_alg_mode_mixed;
+    case 'S': return rocsolver_alg_mode_shifted;
+    case 'T': return rocsolver_alg_mode_tournament;
+    default: return static_cast<rocsolver_alg_mode>(0);
+    }
+}
+
+constexpr rocsolver_norm_type char2rocsolver_norm_type(char value)
+{
+    switch(value)
+    {
+    case 'M': return rocsolver_norm_max;
+    case 'O':
+    case '1': return rocsolver_norm_one;
+    case 'I': return rocsolver_norm_inf;
+    case 'F':
+    case 'E': return rocsolver_norm_frobenius;
+    default: return static_cast<rocsolver_norm_type>(0);
+    }
+}
+
 #undef ROCSOLVER_ROCBLAS_HAS_F8_DATATYPES
 
 #ifdef ROCSOLVER_LIBRARY
@@ -68,6 +68,18 @@ Options:
 
   --no-sparse                  Pass this flag to remove rocSPARSE as a dependency and disable sparse methods.
 
+  --roctx                      Pass this flag to build with roctx range instrumentation. The ranges are
+                               enabled at runtime by setting the environment variable ROCSOLVER_ROCTX=1.
+
+  --hipblaslt                  Pass this flag to compute the trailing-matrix updates of the blocked algorithms
+                               with hipBLASLt. It can be disabled at runtime by setting ROCSOLVER_HIPBLASLT=0.
+
+  --lazy-specialized-kernels   Pass this flag to build the kernels for small sizes into a separate module,
+                               librocsolver-specialized, that is only loaded when one of them is first used.
+
+  --jit-kernels                Pass this flag to also compile kernels for small sizes at run time, with hipRTC,
+                               for the exact size in use. The code objects are cached in ROCSOLVER_CACHE_PATH.
+
   -a | --architecture          Set GPU architecture target, e.g. "gfx803;gfx900;gfx906;gfx908".
                                If you don't know the architecture of the GPU in your local machine, it can be
                                queried by running "mygpu".
@@ -326,6 +338,10 @@ cleanup=false
 build_sanitizer=false
 build_codecoverage=false
 build_with_sparse=true
+build_with_roctx=false
+build_with_hipblaslt=false
+build_lazy_specialized=false
+build_jit_kernels=false
 unset architecture
 unset rocblas_path
 unset rocsolver_path
@@ -340,7 +356,7 @@ declare -a cmake_client_options
 # check if we have a modern version of getopt that can handle whitespace and long parameters
 getopt -T
 if [[ $? -eq 4 ]]; then
-  GETOPT_PARSE=$(getopt --name "${0}" --longoptions help,install,package,clients,clients-only,dependencies,cleanup,debug,hip-clang,codecoverage,relwithdebinfo,build_dir:,build-path:,lib_dir:,lib-path:,install_dir:,install-path:,rocblas_dir:,rocblas-path:,rocsolver_dir:,rocsolver-path:,rocsparse_dir:,rocsparse-path:,architecture:,static,relocatable,no-optimizations,no-sparse,docs,address-sanitizer,cmake-arg: --options hipcdgsrnka: -- "$@")
+  GETOPT_PARSE=$(getopt --name "${0}" --longoptions help,install,package,clients,clients-only,dependencies,cleanup,debug,hip-clang,codecoverage,relwithdebinfo,build_dir:,build-path:,lib_dir:,lib-path:,install_dir:,install-path:,rocblas_dir:,rocblas-path:,rocsolver_dir:,rocsolver-path:,rocsparse_dir:,rocsparse-path:,architecture:,static,relocatable,no-optimizations,no-sparse,roctx,hipblaslt,lazy-specialized-kernels,jit-kernels,docs,address-sanitizer,cmake-arg: --options hipcdgsrnka: -- "$@")
 else
   echo "Need a new version of getopt"
   exit 1
@@ -391,6 +407,18 @@ while true; do
     --no-sparse)
         build_with_sparse=false
         shift ;;
+    --roctx)
+        build_with_roctx=true
+        shift ;;
+    --hipblaslt)
+        build_with_hipblaslt=true
+        shift ;;
+    --lazy-specialized-kernels)
+        build_lazy_specialized=true
+        shift ;;
+    --jit-kernels)
+        build_jit_kernels=true
+        shift ;;
     --build_dir|--build-path)
         build_dir=${2}
         shift 2;;
@@ -574,6 +602,22 @@ if [[ "${build_with_sparse}" == false ]]; then
   cmake_common_options+=('-DBUILD_WITH_SPARSE=OFF')
 fi
 
+if [[ "${build_with_roctx}" == true ]]; then
+  cmake_common_options+=('-DBUILD_WITH_ROCTX=ON')
+fi
+
+if [[ "${build_with_hipblaslt}" == true ]]; then
+  cmake_common_options+=('-DBUILD_WITH_HIPBLASLT=ON')
+fi
+
+if [[ "${build_lazy_specialized}" == true ]]; then
+  cmake_common_options+=('-DROCSOLVER_LAZY_SPECIALIZED_KERNELS=ON')
+fi
+
+if [[ "${build_jit_kernels}" == true ]]; then
+  cmake_common_options+=('-DROCSOLVER_JIT_KERNELS=ON')
+fi
+
 if [[ -n "${architecture+x}" ]]; then
   cmake_common_options+=("-DAMDGPU_TARGETS=${architecture}")
 fi
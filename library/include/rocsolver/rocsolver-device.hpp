@@ -0,0 +1,785 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#ifndef ROCSOLVER_DEVICE_HPP
+#define ROCSOLVER_DEVICE_HPP
+
+/*! \file
+    \brief rocsolver-device.hpp provides block-level device functions that factorize and solve
+    small matrices from inside user kernels.
+
+    \details
+    The functions in this header are meant to be called from a __global__ or __device__ function
+    compiled with hipcc. They work on matrices that are already resident in memory visible to the
+    calling thread block (typically LDS, but global memory is also valid), so that a kernel can
+    chain several small factorizations and solves without launching separate rocSOLVER calls.
+
+    All functions are collective at the thread-block level: every thread of the block must call
+    them with the same arguments, and the results are visible to all threads on return. Matrices
+    are stored in column-major order and pivot indices and info values are 1-based, as in the
+    host API. No workspace is needed.
+ ********************************************************************************/
+
+#include "rocsolver-extra-types.h"
+
+#include <hip/hip_runtime.h>
+#include <rocblas/rocblas.h>
+
+#include <limits>
+#include <type_traits>
+
+namespace rocsolver
+{
+namespace device
+{
+namespace detail
+{
+    __device__ inline rocblas_int thread_id()
+    {
+        return hipThreadIdx_x + hipBlockDim_x * (hipThreadIdx_y + hipBlockDim_y * hipThreadIdx_z);
+    }
+
+    __device__ inline rocblas_int num_threads()
+    {
+        return hipBlockDim_x * hipBlockDim_y * hipBlockDim_z;
+    }
+
+    template <typename T>
+    struct real_type
+    {
+        using type = T;
+    };
+    template <>
+    struct real_type<rocblas_float_complex>
+    {
+        using type = float;
+    };
+    template <>
+    struct real_type<rocblas_double_complex>
+    {
+        using type = double;
+    };
+    template <typename T>
+    using real_t = typename real_type<T>::type;
+
+    template <typename T>
+    __device__ inline T conj(const T& z)
+    {
+        if constexpr(rocblas_is_complex<T>)
+            return std::conj(z);
+        else
+            return z;
+    }
+
+    template <typename T>
+    __device__ inline real_t<T> real(const T& z)
+    {
+        if constexpr(rocblas_is_complex<T>)
+            return z.real();
+        else
+            return z;
+    }
+
+    template <typename T>
+    __device__ inline real_t<T> norm(const T& z)
+    {
+        if constexpr(rocblas_is_complex<T>)
+            return z.real() * z.real() + z.imag() * z.imag();
+        else
+            return z * z;
+    }
+
+    template <typename T>
+    __device__ inline real_t<T> abs1(const T& z)
+    {
+        if constexpr(rocblas_is_complex<T>)
+            return std::abs(z.real()) + std::abs(z.imag());
+        else
+            return std::abs(z);
+    }
+
+    /** Same convention as the LARTG device function used by the library Jacobi kernels. **/
+    template <typename S>
+    __device__ inline void lartg(const S f, const S g, S& c, S& s)
+    {
+        if(g == 0)
+        {
+            c = 1;
+            s = 0;
+        }
+        else if(f == 0)
+        {
+            c = 0;
+            s = 1;
+        }
+        else if(std::abs(g) > std::abs(f))
+        {
+            S t = -f / g;
+            s = 1 / std::sqrt(1 + t * t);
+            c = s * t;
+        }
+        else
+        {
+            S t = -g / f;
+            c = 1 / std::sqrt(1 + t * t);
+            s = c * t;
+        }
+    }
+}
+
+/*! \brief TRSM solves op(A)*X = B for an n-by-n triangular matrix A.
+
+    \details
+    B is n-by-nrhs and is overwritten with the solution X. The rows of each step are distributed
+    over all the threads of the block, which makes the function also efficient for a single
+    right-hand side.
+
+    @param[in]
+    uplo        rocblas_fill.\n
+                Specifies whether A is upper or lower triangular.
+    @param[in]
+    trans       rocblas_operation.\n
+                Specifies the form of op(A).
+    @param[in]
+    diag        rocblas_diagonal.\n
+                Specifies whether A is unit triangular.
+    @param[in]
+    n           rocblas_int. n >= 0.\n
+                The order of the matrix A.
+    @param[in]
+    nrhs        rocblas_int. nrhs >= 0.\n
+                The number of right-hand sides.
+    @param[in]
+    A           pointer to type. Array of dimension lda*n.\n
+                The triangular matrix A.
+    @param[in]
+    lda         rocblas_int. lda >= n.\n
+                Specifies the leading dimension of A.
+    @param[inout]
+    B           pointer to type. Array of dimension ldb*nrhs.\n
+                On entry, the right-hand side matrix B. On exit, the solution X.
+    @param[in]
+    ldb         rocblas_int. ldb >= n.\n
+                Specifies the leading dimension of B.
+    *************************************************************************/
+template <typename T>
+__device__ void trsm(const rocblas_fill uplo,
+                     const rocblas_operation trans,
+                     const rocblas_diagonal diag,
+                     const rocblas_int n,
+                     const rocblas_int nrhs,
+                     const T* A,
+                     const rocblas_int lda,
+                     T* B,
+                     const rocblas_int ldb)
+{
+    const rocblas_int tid = detail::thread_id();
+    const rocblas_int nt = detail::num_threads();
+    const bool notrans = (trans == rocblas_operation_none);
+    const bool forward = ((uplo == rocblas_fill_lower) == notrans);
+    const rocblas_int total = n * nrhs;
+
+    for(rocblas_int k = 0; k < n; ++k)
+    {
+        const rocblas_int j = forward ? k : n - 1 - k;
+
+        // compute the j-th row of the solution
+        if(diag == rocblas_diagonal_non_unit)
+        {
+            T d = A[j + j * lda];
+            if(trans == rocblas_operation_conjugate_transpose)
+                d = detail::conj(d);
+            for(rocblas_int c = tid; c < nrhs; c += nt)
+                B[j + c * ldb] = B[j + c * ldb] / d;
+            __syncthreads();
+        }
+
+        // update the remaining rows
+        for(rocblas_int idx = tid; idx < total; idx += nt)
+        {
+            const rocblas_int i = idx % n;
+            const rocblas_int c = idx / n;
+            if(forward ? (i > j) : (i < j))
+            {
+                T a;
+                if(notrans)
+                    a = A[i + j * lda];
+                else if(trans == rocblas_operation_transpose)
+                    a = A[j + i * lda];
+                else
+                    a = detail::conj(A[j + i * lda]);
+                B[i + c * ldb] -= a * B[j + c * ldb];
+            }
+        }
+        __syncthreads();
+    }
+}
+
+/*! \brief GETRF computes the LU factorization of an n-by-n matrix A with partial pivoting.
+
+    \details
+    The factorization has the form A = P * L * U, as returned by the host function
+    \ref rocsolver_sgetrf "GETRF", and is computed with an unblocked right-looking algorithm.
+
+    @param[in]
+    n           rocblas_int. n >= 0.\n
+                The order of the matrix A.
+    @param[inout]
+    A           pointer to type. Array of dimension lda*n.\n
+                On entry, the matrix A. On exit, the factors L and U.
+    @param[in]
+    lda         rocblas_int. lda >= n.\n
+                Specifies the leading dimension of A.
+    @param[out]
+    ipiv        pointer to rocblas_int. Array of dimension n.\n
+                The 1-based pivot indices; row i of the matrix was interchanged with row ipiv[i].
+    @param[out]
+    info        pointer to a rocblas_int.\n
+                If info = 0, successful exit. If info = i > 0, U is singular; U[i,i] is the first
+                zero pivot.
+    *************************************************************************/
+template <typename T>
+__device__ void
+    getrf(const rocblas_int n, T* A, const rocblas_int lda, rocblas_int* ipiv, rocblas_int* info)
+{
+    __shared__ rocblas_int sh_piv;
+
+    const rocblas_int tid = detail::thread_id();
+    const rocblas_int nt = detail::num_threads();
+    rocblas_int linfo = 0;
+
+    for(rocblas_int j = 0; j < n; ++j)
+    {
+        // find the pivot
+        if(tid == 0)
+        {
+            rocblas_int p = j;
+            auto vmax = detail::abs1(A[j + j * lda]);
+            for(rocblas_int i = j + 1; i < n; ++i)
+            {
+                auto v = detail::abs1(A[i + j * lda]);
+                if(v > vmax)
+                {
+                    vmax = v;
+                    p = i;
+                }
+            }
+            sh_piv = p;
+            ipiv[j] = p + 1;
+        }
+        __syncthreads();
+
+        const rocblas_int p = sh_piv;
+        const T pivot = A[p + j * lda];
+        __syncthreads();
+
+        if(pivot != T(0))
+        {
+            // interchange rows and scale the column of L
+            if(p != j)
+            {
+                for(rocblas_int c = tid; c < n; c += nt)
+                {
+                    T temp = A[j + c * lda];
+                    A[j + c * lda] = A[p + c * lda];
+                    A[p + c * lda] = temp;
+                }
+            }
+            __syncthreads();
+            for(rocblas_int i = j + 1 + tid; i < n; i += nt)
+                A[i + j * lda] = A[i + j * lda] / pivot;
+        }
+        else if(linfo == 0)
+            linfo = j + 1;
+        __syncthreads();
+
+        // update the trailing matrix
+        const rocblas_int m = n - j - 1;
+        for(rocblas_int idx = tid; idx < m * m; idx += nt)
+        {
+            const rocblas_int i = j + 1 + idx % m;
+            const rocblas_int c = j + 1 + idx / m;
+            A[i + c * lda] -= A[i + j * lda] * A[j + c * lda];
+        }
+        __syncthreads();
+    }
+
+    if(tid == 0)
+        *info = linfo;
+    __syncthreads();
+}
+
+/*! \brief GETRS solves op(A)*X = B using the LU factorization computed by
+    \ref rocsolver::device::getrf "getrf".
+
+    @param[in]
+    trans       rocblas_operation.\n
+                Specifies the form of op(A).
+    @param[in]
+    n           rocblas_int. n >= 0.\n
+                The order of the matrix A.
+    @param[in]
+    nrhs        rocblas_int. nrhs >= 0.\n
+                The number of right-hand sides.
+    @param[in]
+    A           pointer to type. Array of dimension lda*n.\n
+                The factors L and U returned by getrf.
+    @param[in]
+    lda         rocblas_int. lda >= n.\n
+                Specifies the leading dimension of A.
+    @param[in]
+    ipiv        pointer to rocblas_int. Array of dimension n.\n
+                The pivot indices returned by getrf.
+    @param[inout]
+    B           pointer to type. Array of dimension ldb*nrhs.\n
+                On entry, the right-hand side matrix B. On exit, the solution X.
+    @param[in]
+    ldb         rocblas_int. ldb >= n.\n
+                Specifies the leading dimension of B.
+    *************************************************************************/
+template <typename T>
+__device__ void getrs(const rocblas_operation trans,
+                      const rocblas_int n,
+                      const rocblas_int nrhs,
+                      const T* A,
+                      const rocblas_int lda,
+                      const rocblas_int* ipiv,
+                      T* B,
+                      const rocblas_int ldb)
+{
+    const rocblas_int tid = detail::thread_id();
+    const rocblas_int nt = detail::num_threads();
+
+    // each thread permutes its own columns of B, so no synchronization is needed in between
+    auto swap_rows = [&](const rocblas_int k) {
+        const rocblas_int p = ipiv[k] - 1;
+        if(p != k)
+        {
+            for(rocblas_int c = tid; c < nrhs; c += nt)
+            {
+                T temp = B[k + c * ldb];
+                B[k + c * ldb] = B[p + c * ldb];
+                B[p + c * ldb] = temp;
+            }
+        }
+    };
+
+    if(trans == rocblas_operation_none)
+    {
+        for(rocblas_int k = 0; k < n; ++k)
+            swap_rows(k);
+        __syncthreads();
+        trsm(rocblas_fill_lower, trans, rocblas_diagonal_unit, n, nrhs, A, lda, B, ldb);
+        trsm(rocblas_fill_upper, trans, rocblas_diagonal_non_unit, n, nrhs, A, lda, B, ldb);
+    }
+    else
+    {
+        trsm(rocblas_fill_upper, trans, rocblas_diagonal_non_unit, n, nrhs, A, lda, B, ldb);
+        trsm(rocblas_fill_lower, trans, rocblas_diagonal_unit, n, nrhs, A, lda, B, ldb);
+        for(rocblas_int k = n - 1; k >= 0; --k)
+            swap_rows(k);
+        __syncthreads();
+    }
+}
+
+/*! \brief POTRF computes the Cholesky factorization of an n-by-n Hermitian positive definite
+    matrix A.
+
+    \details
+    The factorization has the form A = U' * U or A = L * L', as returned by the host function
+    \ref rocsolver_spotrf "POTRF". Only the triangular part given by uplo is referenced and
+    overwritten.
+
+    @param[in]
+    uplo        rocblas_fill.\n
+                Specifies whether the factorization is upper or lower triangular.
+    @param[in]
+    n           rocblas_int. n >= 0.\n
+                The order of the matrix A.
+    @param[inout]
+    A           pointer to type. Array of dimension lda*n.\n
+                On entry, the matrix A. On exit, the factor U or L.
+    @param[in]
+    lda         rocblas_int. lda >= n.\n
+                Specifies the leading dimension of A.
+    @param[out]
+    info        pointer to a rocblas_int.\n
+                If info = 0, successful exit. If info = i > 0, the leading minor of order i of A
+                is not positive definite and the factorization was not completed.
+    *************************************************************************/
+template <typename T>
+__device__ void potrf(const rocblas_fill uplo,
+                      const rocblas_int n,
+                      T* A,
+                      const rocblas_int lda,
+                      rocblas_int* info)
+{
+    using S = detail::real_t<T>;
+    __shared__ S sh_diag;
+
+    const rocblas_int tid = detail::thread_id();
+    const rocblas_int nt = detail::num_threads();
+    const bool lower = (uplo == rocblas_fill_lower);
+    rocblas_int linfo = 0;
+
+    for(rocblas_int j = 0; j < n; ++j)
+    {
+        if(tid == 0)
+        {
+            S d = detail::real(A[j + j * lda]);
+            if(d > 0)
+            {
+                d = std::sqrt(d);
+                A[j + j * lda] = d;
+            }
+            sh_diag = d;
+        }
+        __syncthreads();
+
+        const S d = sh_diag;
+        if(!(d > 0))
+        {
+            linfo = j + 1;
+            break;
+        }
+
+        // scale the j-th column of L (or row of U)
+        for(rocblas_int i = j + 1 + tid; i < n; i += nt)
+        {
+            if(lower)
+                A[i + j * lda] = A[i + j * lda] / d;
+            else
+                A[j + i * lda] = A[j + i * lda] / d;
+        }
+        __syncthreads();
+
+        // update the trailing triangle
+        const rocblas_int m = n - j - 1;
+        for(rocblas_int idx = tid; idx < m * m; idx += nt)
+        {
+            const rocblas_int r = j + 1 + idx % m;
+            const rocblas_int c = j + 1 + idx / m;
+            if(lower && r >= c)
+                A[r + c * lda] -= A[r + j * lda] * detail::conj(A[c + j * lda]);
+            else if(!lower && r <= c)
+                A[r + c * lda] -= detail::conj(A[j + r * lda]) * A[j + c * lda];
+        }
+        __syncthreads();
+    }
+
+    if(tid == 0)
+        *info = linfo;
+    __syncthreads();
+}
+
+/*! \brief POTRS solves A*X = B using the Cholesky factorization computed by
+    \ref rocsolver::device::potrf "potrf".
+
+    @param[in]
+    uplo        rocblas_fill.\n
+                Specifies whether the factor is upper or lower triangular.
+    @param[in]
+    n           rocblas_int. n >= 0.\n
+                The order of the matrix A.
+    @param[in]
+    nrhs        rocblas_int. nrhs >= 0.\n
+                The number of right-hand sides.
+    @param[in]
+    A           pointer to type. Array of dimension lda*n.\n
+                The factor U or L returned by potrf.
+    @param[in]
+    lda         rocblas_int. lda >= n.\n
+                Specifies the leading dimension of A.
+    @param[inout]
+    B           pointer to type. Array of dimension ldb*nrhs.\n
+                On entry, the right-hand side matrix B. On exit, the solution X.
+    @param[in]
+    ldb         rocblas_int. ldb >= n.\n
+                Specifies the leading dimension of B.
+    *************************************************************************/
+template <typename T>
+__device__ void potrs(const rocblas_fill uplo,
+                      const rocblas_int n,
+                      const rocblas_int nrhs,
+                      const T* A,
+                      const rocblas_int lda,
+                      T* B,
+                      const rocblas_int ldb)
+{
+    constexpr rocblas_operation conjtrans = rocblas_is_complex<T>
+        ? rocblas_operation_conjugate_transpose
+        : rocblas_operation_transpose;
+
+    if(uplo == rocblas_fill_lower)
+    {
+        trsm(uplo, rocblas_operation_none, rocblas_diagonal_non_unit, n, nrhs, A, lda, B, ldb);
+        trsm(uplo, conjtrans, rocblas_diagonal_non_unit, n, nrhs, A, lda, B, ldb);
+    }
+    else
+    {
+        trsm(uplo, conjtrans, rocblas_diagonal_non_unit, n, nrhs, A, lda, B, ldb);
+        trsm(uplo, rocblas_operation_none, rocblas_diagonal_non_unit, n, nrhs, A, lda, B, ldb);
+    }
+}
+
+/*! \brief SYEVJ computes the eigenvalues and optionally the eigenvectors of an n-by-n real
+    symmetric or complex Hermitian matrix A using the cyclic Jacobi method.
+
+    \details
+    The rotations are computed and applied as in the host function
+    \ref rocsolver_ssyevj "SYEVJ"; the pairs of each sweep are processed one at a time with the
+    rows and columns of every rotation distributed over the threads of the block. Sweeps stop when
+    the off-diagonal norm of A falls below abstol times the Frobenius norm of A, or after
+    max_sweeps sweeps. The eigenvalues are returned in ascending order.
+
+    @param[in]
+    evect       #rocblas_evect.\n
+                Specifies whether the eigenvectors are to be computed. rocblas_evect_tridiagonal
+                is not supported.
+    @param[in]
+    uplo        rocblas_fill.\n
+                Specifies whether the upper or lower part of the matrix A is given.
+    @param[in]
+    n           rocblas_int. n >= 0.\n
+                The order of the matrix A.
+    @param[inout]
+    A           pointer to type. Array of dimension lda*n.\n
+                On entry, the matrix A. On exit, the contents of A are destroyed.
+    @param[in]
+    lda         rocblas_int. lda >= n.\n
+                Specifies the leading dimension of A.
+    @param[in]
+    abstol      real type.\n
+                The relative tolerance of the convergence test. If abstol <= 0, the machine
+                precision is used.
+    @param[in]
+    max_sweeps  rocblas_int. max_sweeps > 0.\n
+                The maximum number of sweeps.
+    @param[out]
+    W           pointer to real type. Array of dimension n.\n
+                The eigenvalues of A in increasing order.
+    @param[out]
+    V           pointer to type. Array of dimension ldv*n.\n
+                If evect is original, the orthonormal eigenvectors of A. Not referenced otherwise.
+    @param[in]
+    ldv         rocblas_int. ldv >= n if evect is original, ldv >= 1 otherwise.\n
+                Specifies the leading dimension of V.
+    @param[out]
+    info        pointer to a rocblas_int.\n
+                If info = 0, successful exit. If info = 1, the algorithm did not converge.
+    *************************************************************************/
+template <typename T, typename S>
+__device__ void syevj(const rocblas_evect evect,
+                      const rocblas_fill uplo,
+                      const rocblas_int n,
+                      T* A,
+                      const rocblas_int lda,
+                      S abstol,
+                      const rocblas_int max_sweeps,
+                      S* W,
+                      T* V,
+                      const rocblas_int ldv,
+                      rocblas_int* info)
+{
+    // rotation parameters and convergence flag shared by the block
+    __shared__ S sh_rot[3];
+    __shared__ rocblas_int sh_idx;
+
+    const rocblas_int tid = detail::thread_id();
+    const rocblas_int nt = detail::num_threads();
+    const bool vectors = (evect == rocblas_evect_original);
+    const S small_num = std::numeric_limits<S>::min() / std::numeric_limits<S>::epsilon();
+    if(abstol <= 0)
+        abstol = std::numeric_limits<S>::epsilon();
+
+    // complete the matrix from the given triangle, and initialize V
+    for(rocblas_int idx = tid; idx < n * n; idx += nt)
+    {
+        const rocblas_int i = idx % n;
+        const rocblas_int j = idx / n;
+        if(i == j)
+            A[i + j * lda] = T(detail::real(A[i + j * lda]));
+        else if((uplo == rocblas_fill_upper) == (i < j))
+            A[j + i * lda] = detail::conj(A[i + j * lda]);
+        if(vectors)
+            V[i + j * ldv] = (i == j) ? T(1) : T(0);
+    }
+    __syncthreads();
+
+    bool converged = false;
+    for(rocblas_int sweep = 0; sweep <= max_sweeps; ++sweep)
+    {
+        // check convergence
+        if(tid == 0)
+        {
+            S off = 0, total = 0;
+            for(rocblas_int j = 0; j < n; ++j)
+            {
+                for(rocblas_int i = 0; i < n; ++i)
+                {
+                    const S v = detail::norm(A[i + j * lda]);
+                    total += v;
+                    if(i != j)
+                        off += v;
+                }
+            }
+            sh_idx = (off <= abstol * abstol * total) ? 1 : 0;
+        }
+        __syncthreads();
+        converged = (sh_idx == 1);
+        __syncthreads();
+        if(converged || sweep == max_sweeps)
+            break;
+
+        for(rocblas_int p = 0; p < n - 1; ++p)
+        {
+            for(rocblas_int q = p + 1; q < n; ++q)
+            {
+                // calculate the rotation
+                if(tid == 0)
+                {
+                    const T apq = A[p + q * lda];
+                    const S mag = std::sqrt(detail::norm(apq));
+                    S c = 1, s = 0;
+                    T s1 = 0;
+                    if(mag * mag >= small_num)
+                    {
+                        const S g = 2 * mag;
+                        S f = detail::real(A[q + q * lda] - A[p + p * lda]);
+                        f += (f < 0) ? -std::hypot(f, g) : std::hypot(f, g);
+                        detail::lartg(f, g, c, s);
+                        s1 = apq * (s / mag);
+                    }
+                    sh_rot[0] = c;
+                    if constexpr(rocblas_is_complex<T>)
+                    {
+                        sh_rot[1] = s1.real();
+                        sh_rot[2] = s1.imag();
+                    }
+                    else
+                        sh_rot[1] = s1;
+                    sh_idx = (s == 0) ? 0 : 1;
+                }
+                __syncthreads();
+
+                const bool rotate = (sh_idx == 1);
+                const S c = sh_rot[0];
+                T s1;
+                if constexpr(rocblas_is_complex<T>)
+                    s1 = T(sh_rot[1], sh_rot[2]);
+                else
+                    s1 = sh_rot[1];
+                const T s2 = detail::conj(s1);
+                __syncthreads();
+                if(!rotate)
+                    continue;
+
+                // apply the rotation from the right and update the vectors
+                for(rocblas_int k = tid; k < n; k += nt)
+                {
+                    T t1 = A[k + p * lda];
+                    T t2 = A[k + q * lda];
+                    A[k + p * lda] = c * t1 + s2 * t2;
+                    A[k + q * lda] = -s1 * t1 + c * t2;
+                    if(vectors)
+                    {
+                        t1 = V[k + p * ldv];
+                        t2 = V[k + q * ldv];
+                        V[k + p * ldv] = c * t1 + s2 * t2;
+                        V[k + q * ldv] = -s1 * t1 + c * t2;
+                    }
+                }
+                __syncthreads();
+
+                // apply the rotation from the left
+                for(rocblas_int k = tid; k < n; k += nt)
+                {
+                    const T t1 = A[p + k * lda];
+                    const T t2 = A[q + k * lda];
+                    A[p + k * lda] = c * t1 + s1 * t2;
+                    A[q + k * lda] = -s2 * t1 + c * t2;
+                }
+                __syncthreads();
+
+                if(tid == 0)
+                {
+                    A[p + q * lda] = 0;
+                    A[q + p * lda] = 0;
+                }
+                __syncthreads();
+            }
+        }
+    }
+
+    // extract the eigenvalues and sort them in increasing order
+    for(rocblas_int i = tid; i < n; i += nt)
+        W[i] = detail::real(A[i + i * lda]);
+    __syncthreads();
+
+    for(rocblas_int j = 0; j < n - 1; ++j)
+    {
+        if(tid == 0)
+        {
+            rocblas_int m = j;
+            for(rocblas_int i = j + 1; i < n; ++i)
+                if(W[i] < W[m])
+                    m = i;
+            sh_idx = m;
+        }
+        __syncthreads();
+
+        const rocblas_int m = sh_idx;
+        if(m != j)
+        {
+            if(tid == 0)
+            {
+                const S temp = W[j];
+                W[j] = W[m];
+                W[m] = temp;
+            }
+            if(vectors)
+            {
+                for(rocblas_int k = tid; k < n; k += nt)
+                {
+                    const T temp = V[k + j * ldv];
+                    V[k + j * ldv] = V[k + m * ldv];
+                    V[k + m * ldv] = temp;
+                }
+            }
+        }
+        __syncthreads();
+    }
+
+    if(tid == 0)
+        *info = converged ? 0 : 1;
+    __syncthreads();
+}
+
+} // namespace device
+} // namespace rocsolver
+
+#endif /* ROCSOLVER_DEVICE_HPP */
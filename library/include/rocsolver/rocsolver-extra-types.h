@@ -28,6 +28,7 @@
 #ifndef ROCSOLVER_EXTRA_TYPES_H
 #define ROCSOLVER_EXTRA_TYPES_H
 
+#include <stddef.h>
 #include <stdint.h>
 
 /*! \brief Used to specify the logging layer mode using a bitwise combination
@@ -81,6 +82,9 @@ typedef enum rocblas_workmode_
     rocblas_outofplace = 201, /**< Out-of-place computations are allowed; this
                                    requires extra device memory for workspace. */
     rocblas_inplace = 202, /**< If not enough memory is available, this forces in-place computations.  */
+    rocblas_auto = 203, /**< Out-of-place computations are used if their workspace fits in the device
+                             memory available to the handle; otherwise, in-place computations are
+                             used. The choice is reported by \ref rocsolver_get_last_call_stats. */
 } rocblas_workmode;
 
 /*! \brief Used to specify how the eigenvectors are to be computed
@@ -144,6 +148,16 @@ typedef enum rocblas_srange_
     rocblas_srange_index = 263, /**< The \f$il\f$-th through \f$iu\f$-th singular values will be found.*/
 } rocblas_srange;
 
+/*! \brief Used to specify the matrix norm computed by the LANGE, LANSY/LANHE and GERES functions.
+ ********************************************************************************/
+typedef enum rocsolver_norm_type_
+{
+    rocsolver_norm_max = 321, /**< The largest absolute value of the entries of the matrix. */
+    rocsolver_norm_one = 322, /**< The 1-norm of the matrix (largest column sum). */
+    rocsolver_norm_inf = 323, /**< The infinity norm of the matrix (largest row sum). */
+    rocsolver_norm_frobenius = 324, /**< The Frobenius norm of the matrix. */
+} rocsolver_norm_type;
+
 /*! \brief Forward-declaration of opaque struct containing data used for the re-factorization interfaces.
  ********************************************************************************/
 struct rocsolver_rfinfo_;
@@ -162,6 +176,298 @@ typedef enum rocsolver_rfinfo_mode_
     = 271, /**< To work with LU factorization (for general sparse matrices). This is the default mode. */
     rocsolver_rfinfo_mode_cholesky
     = 272, /**< To work with Cholesky factorization (for symmetric positive definite sparse matrices). */
+    rocsolver_rfinfo_mode_qr
+    = 279, /**< To work with QR factorization (for the least-squares problems of sparse matrices with
+                full column rank). Only the factor R is computed, and stored as R' in the lower
+                triangular part of T. */
 } rocsolver_rfinfo_mode;
 
+/*! \brief Used to specify how the triangular solves of the re-factorization functionality are
+ *computed.
+ ********************************************************************************/
+typedef enum rocsolver_rfinfo_solve_mode_
+{
+    rocsolver_rfinfo_solve_mode_rocsparse
+    = 273, /**< The triangular solves are computed by rocSPARSE. This is the default mode. */
+    rocsolver_rfinfo_solve_mode_levels
+    = 274, /**< The triangular solves are computed by a rocSOLVER kernel, using the level sets
+                of the triangular factors built by CSRRF_ANALYSIS. Both solves, and all the
+                matrices in a batch, are done by a single kernel launch. */
+} rocsolver_rfinfo_solve_mode;
+
+/*! \brief Used to specify how the numeric LU and Cholesky re-factorizations of the
+ *re-factorization functionality are computed.
+ ********************************************************************************/
+typedef enum rocsolver_rfinfo_refact_mode_
+{
+    rocsolver_rfinfo_refact_mode_rocsparse
+    = 275, /**< The re-factorization is computed by the incomplete factorization of rocSPARSE.
+                This is the default mode. */
+    rocsolver_rfinfo_refact_mode_supernodal
+    = 276, /**< The re-factorization is computed by rocSOLVER, using the supernodes of the
+                triangular factors detected by CSRRF_ANALYSIS. The dense blocks of every
+                supernode are processed with rocBLAS kernels. */
+} rocsolver_rfinfo_refact_mode;
+
+/*! \brief Used to specify the precision of the triangular factors computed by the
+ *re-factorization functionality.
+ ********************************************************************************/
+typedef enum rocsolver_rfinfo_precision_mode_
+{
+    rocsolver_rfinfo_precision_mode_full
+    = 277, /**< The triangular factors are computed and stored in the precision of the
+                matrices. This is the default mode. */
+    rocsolver_rfinfo_precision_mode_mixed
+    = 278, /**< In double precision, the triangular factors are computed and stored in single
+                precision, and the solutions of the linear systems are refined in double
+                precision with the original matrix. */
+} rocsolver_rfinfo_precision_mode;
+
+/*! \brief Used to specify the function whose algorithm is selected with
+ *\ref rocsolver_set_alg_mode, or that is warmed up with \ref rocsolver_initialize.
+ ********************************************************************************/
+typedef enum rocsolver_function_
+{
+    rocsolver_function_gesvd = 281, /**< GESVD (including the batched and strided\_batched versions). */
+    rocsolver_function_bdsqr = 282, /**< BDSQR. */
+    rocsolver_function_getrf = 283, /**< GETRF (including the batched and strided\_batched versions). */
+    rocsolver_function_getrs = 284, /**< GETRS (including the batched and strided\_batched versions). */
+    rocsolver_function_potrf = 285, /**< POTRF (including the batched and strided\_batched versions). */
+    rocsolver_function_potrs = 286, /**< POTRS (including the batched and strided\_batched versions). */
+    rocsolver_function_geqrf = 287, /**< GEQRF (including the batched and strided\_batched versions). */
+    rocsolver_function_gesv = 288, /**< GESV (including the batched and strided\_batched versions). */
+    rocsolver_function_posv = 289, /**< POSV (including the batched and strided\_batched versions). */
+    rocsolver_function_syevd = 290, /**< SYEVD and HEEVD (including the batched and strided\_batched
+                                         versions). */
+    rocsolver_function_gesvdj = 295, /**< GESVDJ and GESVDJ\_NOTRANSV (including the batched and
+                                          strided\_batched versions). */
+    rocsolver_function_syevj = 297, /**< SYEVJ and HEEVJ (including the batched and strided\_batched
+                                         versions). */
+    rocsolver_function_cholqr = 299, /**< CHOLQR (including the batched and strided\_batched
+                                          versions). */
+} rocsolver_function;
+
+/*! \brief Used to specify the algorithm used by a function.
+ ********************************************************************************/
+typedef enum rocsolver_alg_mode_
+{
+    rocsolver_alg_mode_qr = 291, /**< QR iteration. For GESVD, the singular values and vectors of the
+                                      bidiagonal form are computed with BDSQR. This is the default mode. */
+    rocsolver_alg_mode_dc = 292, /**< Divide and conquer. For GESVD, the singular values and vectors of
+                                      the bidiagonal form are computed with a divide-and-conquer
+                                      eigensolver (as in STEDC). This is typically faster for large
+                                      sizes when singular vectors are required. */
+    rocsolver_alg_mode_hybrid = 293, /**< Hybrid CPU+GPU execution. For BDSQR (and GESVD), the QR
+                                          sweeps on the bidiagonal matrix, which are inherently
+                                          serial, are computed by host threads, while the device
+                                          applies the resulting rotations to the singular vectors.
+                                          This is typically faster for a few problems of moderate
+                                          size. The stream of the handle is synchronized with the
+                                          host, and thus the mode is ignored while the stream is
+                                          being captured into a graph. */
+    rocsolver_alg_mode_prefetch = 294, /**< Managed-memory prefetching. For GETRF and POTRF (the
+                                            normal versions, also when called within other
+                                            functions), if the matrix is allocated in managed
+                                            memory, the next block column is migrated to the
+                                            device with hipMemPrefetchAsync while the current
+                                            one is processed, and the completed block columns
+                                            are migrated back to the host. This is meant for
+                                            matrices that oversubscribe the device memory. The
+                                            mode is ignored while the stream is being captured
+                                            into a graph. */
+    rocsolver_alg_mode_qr_precond = 296, /**< QR preconditioning. For GESVDJ (and GESVDJ\_NOTRANSV),
+                                              if m > n and the full matrix U is not required, A is
+                                              first factorized as A = QR and the Jacobi method is
+                                              applied to the n-by-n triangular factor R. This is
+                                              typically faster when m is much larger than n. */
+    rocsolver_alg_mode_mixed = 298, /**< Mixed precision. For SYEVJ and HEEVJ (and GESVDJ and
+                                         GESVDJ\_NOTRANSV) in double precision, most Jacobi sweeps
+                                         are executed in single precision, and the result is then
+                                         refined with one or two sweeps in double precision. This
+                                         is typically faster for batches of small matrices. The
+                                         mode is ignored in single precision. */
+    rocsolver_alg_mode_shifted = 300, /**< Shifted Cholesky QR. For CHOLQR, a first pass on the
+                                           shifted Gram matrix A' * A + s * I precedes the two
+                                           usual passes (shifted CholeskyQR3). This is slower, but
+                                           remains stable for ill-conditioned matrices. */
+    rocsolver_alg_mode_tournament = 303, /**< Tournament pivoting. For GETRF (also when called
+                                              within other functions), the pivots of tall block
+                                              panels are selected by a tournament among tiles of
+                                              rows (as in communication-avoiding LU). The pivots
+                                              may then differ from those of partial pivoting, but
+                                              the factorization is stable in practice and requires
+                                              fewer global synchronizations. */
+    rocsolver_alg_mode_compact = 304, /**< Batch compaction. For the batched and strided\_batched
+                                           versions of GETRF (also when called within other
+                                           functions), the matrices found to be singular after
+                                           the factorization of a block column are removed from
+                                           the trailing-matrix updates of the following block
+                                           columns. For those matrices only info is meaningful;
+                                           the returned factors are incomplete. */
+} rocsolver_alg_mode;
+
+/*! \brief Used to specify whether the arguments of the functions are validated, as set with
+ *\ref rocsolver_set_check_mode.
+ ********************************************************************************/
+typedef enum rocsolver_check_mode_
+{
+    rocsolver_check_mode_full = 301, /**< The arguments are validated at every call. This is the
+                                          default mode. */
+    rocsolver_check_mode_none = 302, /**< The argument checks are skipped. The caller guarantees
+                                          that the arguments are valid; invalid arguments result
+                                          in undefined behavior instead of an error status. */
+} rocsolver_check_mode;
+
+/*! \brief Used to specify how the complex GEMMs within the functions are computed, as set with
+ *\ref rocsolver_set_gemm_mode.
+ ********************************************************************************/
+typedef enum rocsolver_gemm_mode_
+{
+    rocsolver_gemm_mode_default = 341, /**< The complex GEMMs are computed with the complex GEMM of
+                                            rocBLAS (four real multiplications per complex one).
+                                            This is the default mode. */
+    rocsolver_gemm_mode_3m = 342, /**< The large complex GEMMs of the trailing-matrix updates are
+                                       computed with the 3M (Gauss) method, i.e. with three real
+                                       GEMMs on the split real and imaginary parts of the
+                                       matrices. This saves a quarter of the multiplications, at
+                                       the cost of a slightly larger rounding error and of a
+                                       workspace for the split matrices. */
+} rocsolver_gemm_mode;
+
+/*! \brief Used to specify whether a handle can be shared by several host threads, as set with
+ *\ref rocsolver_set_thread_mode.
+ ********************************************************************************/
+typedef enum rocsolver_thread_mode_
+{
+    rocsolver_thread_mode_single = 331, /**< The handle is used by one host thread at a time.
+                                             This is the default mode. */
+    rocsolver_thread_mode_multi = 332, /**< The handle can be used concurrently by several host
+                                            threads. The calls are serialized on the host, run on
+                                            the stream of the calling thread, and take their
+                                            workspace from a memory pool. */
+} rocsolver_thread_mode;
+
+/*! \brief A function, precision and problem size, as given to \ref rocsolver_initialize and
+ *\ref rocsolver_get_workspace_size.
+ ********************************************************************************/
+typedef struct rocsolver_problem_shape_
+{
+    rocsolver_function function; /**< The function. */
+    rocblas_datatype datatype; /**< The precision of the function: rocblas_datatype_f32_r,
+                                    rocblas_datatype_f64_r, rocblas_datatype_f32_c or
+                                    rocblas_datatype_f64_c. */
+    rocblas_int m; /**< Number of rows of the matrix for GETRF, GEQRF and GESVD. It is ignored by
+                        the other functions, whose matrices are square. */
+    rocblas_int n; /**< Number of columns of the matrix, or order of the square matrix. */
+    rocblas_int nrhs; /**< Number of right-hand sides for GETRS, POTRS, GESV and POSV. It is ignored
+                           by the other functions. */
+    rocblas_int batch_count; /**< If zero, the normal version of the function is considered;
+                                  otherwise, the strided\_batched version with this number of
+                                  problems. It is ignored by BDSQR. */
+    rocblas_int lda; /**< Leading dimension of the matrix. If zero, the smallest valid one is
+                          considered (m for GETRF, GEQRF and GESVD, and n for the other
+                          functions). It is ignored by BDSQR. */
+} rocsolver_problem_shape;
+
+/*! \brief Forward-declaration of opaque struct containing the execution plan of a function.
+ ********************************************************************************/
+struct rocsolver_plan_;
+
+/*! \brief A handle to an execution plan of a function for a given problem shape. It needs to be
+ *created with \ref rocsolver_create_plan and destroyed with \ref rocsolver_destroy_plan.
+ ********************************************************************************/
+typedef struct rocsolver_plan_* rocsolver_plan;
+
+/*! \brief Used to specify how an execution plan runs its function.
+ ********************************************************************************/
+typedef enum rocsolver_plan_mode_
+{
+    rocsolver_plan_mode_direct = 311, /**< Each execution calls the function. */
+    rocsolver_plan_mode_graph = 312, /**< The function is captured into a HIP graph the first time
+                                          that the plan is executed with a given set of
+                                          arguments, and the following executions with the same
+                                          arguments launch the graph. */
+} rocsolver_plan_mode;
+
+/*! \brief The arguments of an execution of a plan, as given to \ref rocsolver_execute_plan.
+ *The arguments that are not used by the function of the plan are ignored.
+ ********************************************************************************/
+typedef struct rocsolver_plan_args_
+{
+    void* A; /**< Pointer to the matrix A (or to the first matrix of the batch) on the GPU, of the
+                  precision of the plan. */
+    rocblas_int lda; /**< Leading dimension of A. */
+    rocblas_stride strideA; /**< Stride between the matrices A of a batch. */
+    rocblas_int* ipiv; /**< Pivot indices, for GETRF, GETRS and GESV. */
+    void* tau; /**< Householder scalars, for GEQRF, of the precision of the plan. */
+    rocblas_stride strideP; /**< Stride between the vectors ipiv (or tau) of a batch. */
+    void* B; /**< Pointer to the right-hand sides B on the GPU, for GETRS, POTRS, GESV and POSV, of
+                  the precision of the plan. */
+    rocblas_int ldb; /**< Leading dimension of B. */
+    rocblas_stride strideB; /**< Stride between the matrices B of a batch. */
+    rocblas_int* info; /**< Pointer to info on the GPU, for GETRF, POTRF, GESV and POSV. */
+    rocblas_fill uplo; /**< The triangle of A that is used, for POTRF, POTRS and POSV. */
+    rocblas_operation trans; /**< The form of the system, for GETRS. */
+} rocsolver_plan_args;
+
+/*! \brief Statistics of the last call to a rocSOLVER function made with a given handle,
+ *as returned by \ref rocsolver_get_last_call_stats.
+ ********************************************************************************/
+typedef struct rocsolver_call_stats_
+{
+    int64_t kernel_launches; /**< Number of kernels launched by rocSOLVER (the kernels launched by
+                                  rocBLAS are not included). */
+    int64_t rocblas_calls; /**< Number of calls to rocBLAS functions. */
+    int64_t host_syncs; /**< Number of times the host waited for the device to complete
+                             (e.g. to read convergence flags or eigenvalue counts). */
+    size_t workspace_size; /**< Peak size of the device workspace requested, in bytes. */
+    double flops; /**< Nominal number of floating-point operations, or zero if it is not
+                       available for the function. */
+    rocblas_workmode workmode; /**< The work mode used by functions that take a #rocblas_workmode
+                                    (rocblas_outofplace or rocblas_inplace, also when rocblas_auto
+                                    is given), or zero for the other functions. */
+} rocsolver_call_stats;
+
+/*! \brief Convergence diagnostics of one problem in a batch, as written to the device buffer
+ *registered with \ref rocsolver_set_diagnostics.
+ ********************************************************************************/
+typedef struct rocsolver_diagnostics_
+{
+    rocblas_int iterations; /**< Number of QR/QL steps (BDSQR, STEQR, STERF and the solve phase
+                                 of STEDC) or inverse iterations (STEIN) applied. Zero when STERF uses
+                                 bisection. */
+    rocblas_int deflations; /**< Number of off-diagonal elements found negligible and set to
+                                 zero (BDSQR, STEQR, STERF and the solve phase of STEDC), plus the
+                                 number of eigenvalues deflated in the merge phase of STEDC.
+                                 Always zero for STEIN. */
+    int64_t stage_ticks[4]; /**< Device time spent in each stage of the algorithm, in ticks of the
+                                 device wall clock (see hipDeviceAttributeWallClockRate). The
+                                 stages of each function are described in
+                                 \ref rocsolver_set_diagnostics. */
+} rocsolver_diagnostics;
+
+/*! \brief Summary of the info array of a call, as written to the buffer registered with
+ *\ref rocsolver_set_info_summary.
+ ********************************************************************************/
+typedef struct rocsolver_info_summary_
+{
+    rocblas_int failures; /**< Number of problems in the batch with a nonzero info value. */
+    rocblas_int first; /**< Index (zero-based) of the first problem in the batch with a nonzero
+                            info value, or -1 if all the info values are zero. */
+    int64_t first_info; /**< The info value of the first problem with a nonzero info value, or
+                             zero if all the info values are zero. */
+    rocblas_int max_sweeps; /**< Largest number of sweeps in the batch, for the Jacobi functions
+                                 (SYEVJ/HEEVJ, SYGVJ/HEGVJ and GESVDJ); zero otherwise. */
+    double max_residual; /**< Largest residual in the batch, for the Jacobi functions; zero
+                              otherwise. */
+    uint64_t sequence; /**< Number of the call that wrote the summary, counted from 1 since the
+                            buffer was registered. It is written last, so that the host can poll
+                            it to detect the completion of the call. */
+} rocsolver_info_summary;
+
+/*! \brief Host function called after the info summary of a call has been written, as set with
+ *\ref rocsolver_set_info_callback.
+ ********************************************************************************/
+typedef void (*rocsolver_info_callback)(const rocsolver_info_summary* summary, void* user_data);
+
 #endif /* ROCSOLVER_EXTRA_TYPES_H */
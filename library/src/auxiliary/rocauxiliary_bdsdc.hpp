@@ -0,0 +1,369 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "rocauxiliary_bdsqr.hpp"
+#include "rocauxiliary_stedc.hpp"
+#include "rocblas.hpp"
+#include "rocsolver/rocsolver.h"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/** The singular values and vectors of the n-by-n upper bidiagonal matrix B = Q*S*P' are
+    obtained from the eigenvalues and eigenvectors of the 2n-by-2n Golub-Kahan tridiagonal
+    matrix, with zero diagonal and off-diagonal [d_1, e_1, d_2, e_2, ..., e_{n-1}, d_n].
+    Its eigenvalues are +/-s_i, and the eigenvector of +s_i is [p_1, q_1, p_2, q_2, ...]/sqrt(2),
+    where p and q are the i-th columns of P and Q. The eigenproblem is solved with the
+    divide-and-conquer algorithm of STEDC. (A lower bidiagonal matrix is the transpose of the
+    upper bidiagonal matrix with the same D and E, so that the roles of P and Q are swapped.) **/
+
+/************** Kernels and device functions *******************/
+/***************************************************************/
+
+/** BDSDC_GK_INIT kernel sets up the Golub-Kahan tridiagonal matrix given by the
+    bidiagonal matrix with diagonal D and off-diagonal E **/
+template <typename S>
+ROCSOLVER_KERNEL void bdsdc_gk_init(const rocblas_int n,
+                                    S* DD,
+                                    const rocblas_stride strideD,
+                                    S* EE,
+                                    const rocblas_stride strideE,
+                                    S* Dgk,
+                                    S* Egk,
+                                    const rocblas_stride strideGK)
+{
+    rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocblas_int bid = hipBlockIdx_y;
+
+    if(i < 2 * n)
+    {
+        S* D = DD + bid * strideD;
+        S* E = EE + bid * strideE;
+
+        Dgk[i + bid * strideGK] = 0;
+        if(i < 2 * n - 1)
+            Egk[i + bid * strideGK] = (i % 2 == 0) ? D[i / 2] : E[i / 2];
+    }
+}
+
+/** BDSDC_GK_VECTORS kernel extracts the singular values and vectors from the eigenvalues and
+    eigenvectors Z of the Golub-Kahan tridiagonal matrix. It writes the left singular vectors in
+    the columns of Q and the right singular vectors in the rows of Pt.
+    (Each thread group works with a different singular value.) **/
+template <typename T, typename S>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1)
+    bdsdc_gk_vectors(const rocblas_int n,
+                     const bool lower,
+                     S* DgkA,
+                     S* ZA,
+                     const rocblas_stride strideGK,
+                     S* DD,
+                     const rocblas_stride strideD,
+                     T* QA,
+                     T* PtA)
+{
+    rocblas_int c = hipBlockIdx_x;
+    rocblas_int bid = hipBlockIdx_y;
+    rocblas_int tid = hipThreadIdx_x;
+
+    // select batch instance to work with
+    const rocblas_int n2 = 2 * n;
+    S* Dgk = DgkA + bid * strideGK;
+    S* Z = ZA + bid * n2 * static_cast<int64_t>(n2);
+    S* D = DD + bid * strideD;
+    T* Q = QA + bid * n * static_cast<int64_t>(n);
+    T* Pt = PtA + bid * n * static_cast<int64_t>(n);
+
+    // eigenvectors of +s_c and -s_c (the eigenvalues are in increasing order)
+    S* z = Z + (n2 - 1 - c) * static_cast<int64_t>(n2);
+    S* zm = Z + c * static_cast<int64_t>(n2);
+
+    // squared norms of the halves of the eigenvectors
+    __shared__ S sval[4][BS1];
+    S nrm[4] = {0, 0, 0, 0};
+    for(rocblas_int i = tid; i < n; i += BS1)
+    {
+        nrm[0] += z[2 * i] * z[2 * i];
+        nrm[1] += z[2 * i + 1] * z[2 * i + 1];
+        nrm[2] += zm[2 * i] * zm[2 * i];
+        nrm[3] += zm[2 * i + 1] * zm[2 * i + 1];
+    }
+    for(int k = 0; k < 4; k++)
+        sval[k][tid] = nrm[k];
+    __syncthreads();
+
+    for(rocblas_int r = BS1 / 2; r > 0; r /= 2)
+    {
+        if(tid < r)
+        {
+            for(int k = 0; k < 4; k++)
+                sval[k][tid] += sval[k][tid + r];
+        }
+        __syncthreads();
+    }
+
+    // both halves of the eigenvector of a non-zero singular value have norm 1/sqrt(2);
+    // eigenvectors of a zero singular value could have only one non-zero half,
+    // and then the other half is taken from the eigenvector of -s_c
+    S* zp = z;
+    S* zq = z;
+    S np = sval[0][0];
+    S nq = sval[1][0];
+    if(np < S(0.25) || nq < S(0.25))
+    {
+        if(sval[2][0] > np)
+        {
+            zp = zm;
+            np = sval[2][0];
+        }
+        if(sval[3][0] > nq)
+        {
+            zq = zm;
+            nq = sval[3][0];
+        }
+    }
+    S sp = (np > 0) ? S(1) / std::sqrt(np) : S(0);
+    S sq = (nq > 0) ? S(1) / std::sqrt(nq) : S(0);
+
+    // write singular vectors
+    for(rocblas_int i = tid; i < n; i += BS1)
+    {
+        S p = zp[2 * i] * sp;
+        S q = zq[2 * i + 1] * sq;
+        Q[i + c * static_cast<int64_t>(n)] = T(lower ? p : q);
+        Pt[c + i * static_cast<int64_t>(n)] = T(lower ? q : p);
+    }
+
+    // write singular value
+    if(tid == 0)
+        D[c] = std::abs(Dgk[n2 - 1 - c]);
+}
+
+/****** Template function, workspace size and argument validation **********/
+/***************************************************************************/
+
+/** Helper to calculate the sizes of the arrays that the workspace of BDSDC is
+    partitioned into (padded so that every array is well aligned) **/
+template <typename T, typename S>
+void rocsolver_bdsdc_getWorkSizes(const rocblas_int n,
+                                  const rocblas_int nvuc,
+                                  const rocblas_int batch_count,
+                                  size_t* size_splits,
+                                  size_t* sizes)
+{
+    auto pad = [](size_t s) { return ((s + 255) / 256) * 256; };
+    size_t unused;
+
+    // Golub-Kahan tridiagonal matrix and its eigenvectors
+    sizes[0] = pad(sizeof(S) * 4 * n * batch_count);
+    sizes[1] = pad(sizeof(S) * 4 * n * n * batch_count);
+
+    // requirements for STEDC
+    rocsolver_stedc_getMemorySize<false, S, S>(rocblas_evect_tridiagonal, 2 * n, batch_count,
+                                               &sizes[2], &sizes[3], &sizes[4], &sizes[5],
+                                               size_splits, &unused);
+    for(int k = 2; k < 6; k++)
+        sizes[k] = pad(sizes[k]);
+
+    // singular vectors of the bidiagonal matrix, and temporary array for the updates
+    sizes[6] = pad(sizeof(T) * 2 * n * n * batch_count);
+    sizes[7] = pad(sizeof(T) * n * nvuc * batch_count);
+
+    // array of pointers for the (batched) updates
+    sizes[8] = pad(sizeof(T*) * 2 * batch_count);
+}
+
+template <typename T, typename S>
+void rocsolver_bdsdc_getMemorySize(const rocblas_int n,
+                                   const rocblas_int nv,
+                                   const rocblas_int nu,
+                                   const rocblas_int nc,
+                                   const rocblas_int batch_count,
+                                   size_t* size_splits_map,
+                                   size_t* size_work)
+{
+    // if no singular vectors are required, BDSQR is used
+    if(n <= 1 || (!nv && !nu && !nc) || batch_count == 0)
+    {
+        rocsolver_bdsqr_getMemorySize<S>(n, nv, nu, nc, batch_count, size_splits_map, size_work);
+        return;
+    }
+
+    size_t sizes[9];
+    rocblas_int nvuc = std::max(nv, std::max(nu, nc));
+    rocsolver_bdsdc_getWorkSizes<T, S>(n, nvuc, batch_count, size_splits_map, sizes);
+
+    *size_work = 0;
+    for(int k = 0; k < 9; k++)
+        *size_work += sizes[k];
+}
+
+/** BDSDC computes the singular values and vectors of the bidiagonal matrix given by D and E,
+    and updates V, U and C as in BDSQR. The arguments are the same as for BDSQR, and the workspace
+    is given by rocsolver_bdsdc_getMemorySize. **/
+template <typename T, typename S, typename W1, typename W2, typename W3>
+rocblas_status rocsolver_bdsdc_template(rocblas_handle handle,
+                                        const rocblas_fill uplo,
+                                        const rocblas_int n,
+                                        const rocblas_int nv,
+                                        const rocblas_int nu,
+                                        const rocblas_int nc,
+                                        S* D,
+                                        const rocblas_stride strideD,
+                                        S* E,
+                                        const rocblas_stride strideE,
+                                        W1 V,
+                                        const rocblas_int shiftV,
+                                        const rocblas_int ldv,
+                                        const rocblas_stride strideV,
+                                        W2 U,
+                                        const rocblas_int shiftU,
+                                        const rocblas_int ldu,
+                                        const rocblas_stride strideU,
+                                        W3 C,
+                                        const rocblas_int shiftC,
+                                        const rocblas_int ldc,
+                                        const rocblas_stride strideC,
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count,
+                                        rocblas_int* splits_map,
+                                        S* work)
+{
+    // if no singular vectors are required, use BDSQR
+    if(n <= 1 || (!nv && !nu && !nc) || batch_count == 0)
+        return rocsolver_bdsqr_template<T>(handle, uplo, n, nv, nu, nc, D, strideD, E, strideE, V,
+                                           shiftV, ldv, strideV, U, shiftU, ldu, strideU, C,
+                                           shiftC, ldc, strideC, info, batch_count, splits_map,
+                                           work);
+
+    ROCSOLVER_ENTER("bdsdc", "uplo:", uplo, "n:", n, "nv:", nv, "nu:", nu, "nc:", nc,
+                    "shiftV:", shiftV, "ldv:", ldv, "shiftU:", shiftU, "ldu:", ldu,
+                    "shiftC:", shiftC, "ldc:", ldc, "bc:", batch_count);
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // everything must be executed with scalars on the host
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+
+    T one = 1;
+    T zero = 0;
+
+    // partition the workspace
+    size_t sizes[9], unused;
+    rocblas_int nvuc = std::max(nv, std::max(nu, nc));
+    rocsolver_bdsdc_getWorkSizes<T, S>(n, nvuc, batch_count, &unused, sizes);
+
+    char* ptr = reinterpret_cast<char*>(work);
+    S* Dgk = reinterpret_cast<S*>(ptr);
+    S* Egk = Dgk + 2 * n * batch_count;
+    ptr += sizes[0];
+    S* Z = reinterpret_cast<S*>(ptr);
+    ptr += sizes[1];
+    void* work_stack = ptr;
+    ptr += sizes[2];
+    S* tempvect = reinterpret_cast<S*>(ptr);
+    ptr += sizes[3];
+    S* tempgemm = reinterpret_cast<S*>(ptr);
+    ptr += sizes[4];
+    S* tmpz = reinterpret_cast<S*>(ptr);
+    ptr += sizes[5];
+    T* Q = reinterpret_cast<T*>(ptr);
+    T* Pt = Q + n * n * batch_count;
+    ptr += sizes[6];
+    T* tmp = reinterpret_cast<T*>(ptr);
+    ptr += sizes[7];
+    T** workArr = reinterpret_cast<T**>(ptr);
+
+    const rocblas_int n2 = 2 * n;
+    const rocblas_stride strideGK = n2;
+    const rocblas_stride strideZ = n2 * n2;
+    const rocblas_stride strideQ = n * n;
+
+    // set up the Golub-Kahan tridiagonal matrix
+    rocblas_int blocks = (n2 - 1) / BS1 + 1;
+    ROCSOLVER_LAUNCH_KERNEL(bdsdc_gk_init<S>, dim3(blocks, batch_count, 1), dim3(BS1, 1, 1), 0,
+                            stream, n, D, strideD, E, strideE, Dgk, Egk, strideGK);
+
+    // compute its eigenvalues and eigenvectors by divide and conquer
+    rocsolver_stedc_template<false, true, S>(handle, rocblas_evect_tridiagonal, n2, Dgk, 0,
+                                             strideGK, Egk, 0, strideGK, Z, 0, n2, strideZ, info,
+                                             batch_count, work_stack, tempvect, tempgemm, tmpz,
+                                             splits_map, (S**)nullptr);
+
+    // extract the singular values and vectors of the bidiagonal matrix
+    ROCSOLVER_LAUNCH_KERNEL((bdsdc_gk_vectors<T, S>), dim3(n, batch_count, 1), dim3(BS1, 1, 1), 0,
+                            stream, n, (uplo == rocblas_fill_lower), Dgk, Z, strideGK, D, strideD,
+                            Q, Pt);
+
+    // update V, U and C
+    constexpr rocblas_int thread_count = 32;
+    const rocblas_int blocks_n = (n - 1) / thread_count + 1;
+    dim3 threads(thread_count, thread_count, 1);
+
+    if(nv)
+    {
+        // V = Pt * V
+        rocblasCall_gemm(handle, rocblas_operation_none, rocblas_operation_none, n, nv, n, &one, Pt,
+                         0, n, strideQ, V, shiftV, ldv, strideV, &zero, tmp, 0, n, n * nv,
+                         batch_count, workArr);
+
+        rocblas_int blocks_nv = (nv - 1) / thread_count + 1;
+        ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, dim3(blocks_n, blocks_nv, batch_count), threads, 0,
+                                stream, n, nv, tmp, 0, n, n * nv, V, shiftV, ldv, strideV);
+    }
+    if(nu)
+    {
+        // U = U * Q
+        rocblasCall_gemm(handle, rocblas_operation_none, rocblas_operation_none, nu, n, n, &one, U,
+                         shiftU, ldu, strideU, Q, 0, n, strideQ, &zero, tmp, 0, nu, nu * n,
+                         batch_count, workArr);
+
+        rocblas_int blocks_nu = (nu - 1) / thread_count + 1;
+        ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, dim3(blocks_nu, blocks_n, batch_count), threads, 0,
+                                stream, nu, n, tmp, 0, nu, nu * n, U, shiftU, ldu, strideU);
+    }
+    if(nc)
+    {
+        // C = Q' * C
+        rocblasCall_gemm(handle, rocblas_operation_transpose, rocblas_operation_none, n, nc, n,
+                         &one, Q, 0, n, strideQ, C, shiftC, ldc, strideC, &zero, tmp, 0, n, n * nc,
+                         batch_count, workArr);
+
+        rocblas_int blocks_nc = (nc - 1) / thread_count + 1;
+        ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, dim3(blocks_n, blocks_nc, batch_count), threads, 0,
+                                stream, n, nc, tmp, 0, n, n * nc, C, shiftC, ldc, strideC);
+    }
+
+    rocblas_set_pointer_mode(handle, old_mode);
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
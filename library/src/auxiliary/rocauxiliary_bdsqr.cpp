@@ -26,6 +26,7 @@
  * *************************************************************************/
 
 #include "rocauxiliary_bdsqr.hpp"
+#include "rocsolver_alg_mode.hpp"
 
 ROCSOLVER_BEGIN_NAMESPACE
 
@@ -71,10 +72,14 @@ rocblas_status rocsolver_bdsqr_impl(rocblas_handle handle,
     rocblas_stride strideC = 0;
     rocblas_int batch_count = 1;
 
+    // run the serial phases on the host, if selected
+    bool hybrid = (get_alg_mode(handle, rocsolver_function_bdsqr) == rocsolver_alg_mode_hybrid);
+
     // memory workspace sizes:
     // size of re-usable workspace
     size_t size_splits_map, size_work;
-    rocsolver_bdsqr_getMemorySize<S>(n, nv, nu, nc, batch_count, &size_splits_map, &size_work);
+    rocsolver_bdsqr_getMemorySize<S>(n, nv, nu, nc, batch_count, &size_splits_map, &size_work,
+                                     hybrid);
 
     if(rocblas_is_device_memory_size_query(handle))
         return rocblas_set_optimal_device_memory_size(handle, size_splits_map, size_work);
@@ -92,7 +97,7 @@ rocblas_status rocsolver_bdsqr_impl(rocblas_handle handle,
     return rocsolver_bdsqr_template<T>(handle, uplo, n, nv, nu, nc, D, strideD, E, strideE, V,
                                        shiftV, ldv, strideV, U, shiftU, ldu, strideU, C, shiftC,
                                        ldc, strideC, info, batch_count, (rocblas_int*)splits_map,
-                                       (S*)work);
+                                       (S*)work, hybrid);
 }
 
 ROCSOLVER_END_NAMESPACE
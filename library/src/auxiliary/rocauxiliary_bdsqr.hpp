@@ -33,10 +33,14 @@
 #pragma once
 
 #include "lapack_device_functions.hpp"
+#include "rocauxiliary_bdsqr_hybrid.hpp"
 #include "rocblas.hpp"
 #include "rocsolver/rocsolver.h"
+#include "rocsolver_diagnostics.hpp"
 
 #include <cmath>
+#include <thread>
+#include <vector>
 
 ROCSOLVER_BEGIN_NAMESPACE
 
@@ -73,7 +77,8 @@ __device__ T bdsqr_estimate(const rocblas_int n, T* D, T* E, int t2b, T tol, int
 
 /** BDSQR_T2BQRSTEP device function applies implicit QR interation to
     the n-by-n bidiagonal matrix given by D and E, using shift = sh,
-    from top to bottom **/
+    from top to bottom. If update = false, the rotations are only saved in rots
+    and the singular vectors are not updated **/
 template <typename T, typename S>
 __device__ void bdsqr_t2bQRstep(const rocblas_int tid,
                                 const rocblas_int n,
@@ -89,7 +94,8 @@ __device__ void bdsqr_t2bQRstep(const rocblas_int tid,
                                 T* C,
                                 const rocblas_int ldc,
                                 const S sh,
-                                S* rots)
+                                S* rots,
+                                const bool update = true)
 {
     S f, g, c, s, r;
     T temp1, temp2;
@@ -142,6 +148,9 @@ __device__ void bdsqr_t2bQRstep(const rocblas_int tid,
     }
     __syncthreads();
 
+    if(!update)
+        return;
+
     // update singular vectors
     if(nv)
     {
@@ -195,7 +204,8 @@ __device__ void bdsqr_t2bQRstep(const rocblas_int tid,
 
 /** BDSQR_B2TQRSTEP device function applies implicit QR interation to
     the n-by-n bidiagonal matrix given by D and E, using shift = sh,
-    from bottom to top **/
+    from bottom to top. If update = false, the rotations are only saved in rots
+    and the singular vectors are not updated **/
 template <typename T, typename S>
 __device__ void bdsqr_b2tQRstep(const rocblas_int tid,
                                 const rocblas_int n,
@@ -211,7 +221,8 @@ __device__ void bdsqr_b2tQRstep(const rocblas_int tid,
                                 T* C,
                                 const rocblas_int ldc,
                                 const S sh,
-                                S* rots)
+                                S* rots,
+                                const bool update = true)
 {
     S f, g, c, s, r;
     T temp1, temp2;
@@ -264,6 +275,9 @@ __device__ void bdsqr_b2tQRstep(const rocblas_int tid,
     }
     __syncthreads();
 
+    if(!update)
+        return;
+
     // update singular vectors
     if(nv)
     {
@@ -347,7 +361,8 @@ ROCSOLVER_KERNEL void bdsqr_kernel(const rocblas_int n,
                                    rocblas_int* splitsA,
                                    S* workA,
                                    const rocblas_int incW,
-                                   const rocblas_stride strideW)
+                                   const rocblas_stride strideW,
+                                   rocsolver_diagnostics* diagA)
 {
     rocblas_int tid = hipThreadIdx_x;
     rocblas_int sid = hipBlockIdx_y;
@@ -379,6 +394,9 @@ ROCSOLVER_KERNEL void bdsqr_kernel(const rocblas_int n,
     __shared__ rocblas_int i, k, start;
     __shared__ rocblas_int iter;
 
+    // number of QR steps and deflations (only updated by thread 0)
+    rocblas_int steps = 0, defl = 0;
+
     // get convergence threshold
     if(tid == 0)
     {
@@ -447,7 +465,10 @@ ROCSOLVER_KERNEL void bdsqr_kernel(const rocblas_int n,
             if(applyqr)
             {
                 if(tid == 0)
+                {
                     iter += k - i;
+                    steps++;
+                }
 
                 if(t2b)
                     bdsqr_t2bQRstep(tid, k - i + 1, nv, nu, nc, D + i, E + i, V + i, ldv,
@@ -464,6 +485,7 @@ ROCSOLVER_KERNEL void bdsqr_kernel(const rocblas_int n,
             {
                 while(k - 1 >= start && std::abs(E[k - 1]) < thresh)
                 {
+                    defl += (E[k - 1] != 0);
                     E[k - 1] = 0;
                     k--;
                 }
@@ -472,6 +494,7 @@ ROCSOLVER_KERNEL void bdsqr_kernel(const rocblas_int n,
                 {
                     if(std::abs(E[i]) < thresh)
                     {
+                        defl += (E[i] != 0);
                         E[i] = 0;
                         break;
                     }
@@ -482,6 +505,282 @@ ROCSOLVER_KERNEL void bdsqr_kernel(const rocblas_int n,
 
         sid += hipGridDim_y;
     }
+
+    if(tid == 0 && diagA)
+        diagnostics_add(diagA + bid, steps, defl);
+}
+
+/** BDSQR_BLOCKED_CHASE kernel runs up to nsteps iterations of the main loop of the bdsqr
+    algorithm on each diagonal block without updating the singular vectors. The rotations of
+    every QR step are saved in the history array, to be applied later by bdsqr_blocked_rotate,
+    and the state of the diagonal block is saved so that the next call can resume from it.
+    (Each thread group works with a different diagonal block.) **/
+template <typename S>
+ROCSOLVER_KERNEL void bdsqr_blocked_chase(const rocblas_int n,
+                                          const rocblas_int nv,
+                                          const rocblas_int nuc,
+                                          S* DD,
+                                          const rocblas_stride strideD,
+                                          S* EE,
+                                          const rocblas_stride strideE,
+                                          rocblas_int* info,
+                                          const rocblas_int maxiter,
+                                          const S eps,
+                                          const S tol,
+                                          const S minshift,
+                                          rocblas_int* splitsA,
+                                          rocblas_int* statesA,
+                                          rocblas_int* pending,
+                                          S* workA,
+                                          const rocblas_int incW,
+                                          const rocblas_stride strideW,
+                                          const rocblas_int nsteps,
+                                          const bool first,
+                                          rocsolver_diagnostics* diagA)
+{
+    rocblas_int sid = hipBlockIdx_y;
+    rocblas_int bid = hipBlockIdx_z;
+
+    // if a NaN or Inf was detected in the input, return
+    if(info[bid] != 0)
+        return;
+
+    // select batch instance to work with
+    rocblas_int* splits = splitsA + bid * n;
+    if(splits[2 * sid + 1] == 0)
+        return;
+
+    S* D = DD + bid * strideD;
+    S* E = EE + bid * strideE;
+    S* work = workA + bid * strideW;
+    S* rots = work + 2;
+    S* flags = rots + incW * n;
+    S* hist = flags + nsteps * n;
+    rocblas_int* state = statesA + bid * 2 * n + 4 * sid;
+    rocblas_int nr = nv ? 2 * n : 0;
+
+    // local variables
+    bool applyqr;
+    int t2b;
+    S smin, smax, sh;
+    S thresh = work[1];
+    rocblas_int start = splits[2 * sid];
+    rocblas_int last = splits[2 * sid + 1];
+    rocblas_int i, k, iter;
+    rocblas_int defl = 0;
+
+    // read diagonal block endpoints and number of iterations applied
+    // to current block
+    if(first)
+    {
+        i = start;
+        k = last;
+        iter = 0;
+    }
+    else
+    {
+        i = state[0];
+        k = state[1];
+        iter = state[2];
+    }
+
+    // clear the rotations saved in the previous call
+    for(rocblas_int t = 0; t < nsteps; t++)
+        for(rocblas_int p = start; p < last; p++)
+            flags[p + t * n] = 0;
+
+    // iterate while diagonal block has not converged
+    rocblas_int t = 0;
+    while(k > start && iter < maxiter && t < nsteps)
+    {
+        applyqr = false;
+
+        // current block goes from i until k
+        // determine shift for the QR step
+        // (apply convergence test to find gaps)
+        if(std::abs(D[i]) >= std::abs(D[k]))
+        {
+            t2b = 1;
+            sh = std::abs(D[i]);
+        }
+        else
+        {
+            t2b = 0;
+            sh = std::abs(D[k]);
+        }
+
+        // shift
+        smin = bdsqr_estimate<S>(k - i + 1, D + i, E + i, t2b, tol, 1);
+        // estimate of the largest singular value in the block
+        smax = find_max_tridiag(i, k, D, E);
+
+        // check for gaps, if none then continue
+        if(smin >= 0)
+        {
+            if(smin / smax <= minshift)
+                smin = 0; // shift set to zero if less than accepted value
+            else if(sh > 0)
+            {
+                if(smin * smin / sh / sh < eps)
+                    smin = 0; // shift set to zero if negligible
+            }
+
+            applyqr = true;
+        }
+
+        // apply QR step and save its rotations with their global row/column indices
+        if(applyqr)
+        {
+            rocblas_int nb = k - i + 1;
+            rocblas_int nrb = nv ? 2 * nb : 0;
+            S* r = rots + incW * i;
+            S* f = flags + t * n;
+            S* h = hist + t * incW * n;
+
+            iter += k - i;
+
+            if(t2b)
+                bdsqr_t2bQRstep<S, S>(0, nb, nv, nuc, 0, D + i, E + i, nullptr, 1, nullptr, 1,
+                                      nullptr, 1, smin, r, false);
+            else
+                bdsqr_b2tQRstep<S, S>(0, nb, nv, nuc, 0, D + i, E + i, nullptr, 1, nullptr, 1,
+                                      nullptr, 1, smin, r, false);
+
+            for(rocblas_int p = 0; p < nb - 1; p++)
+            {
+                f[i + p] = t2b ? 1 : -1;
+                if(nv)
+                {
+                    h[i + p] = r[p];
+                    h[i + p + n] = r[p + nb];
+                }
+                if(nuc)
+                {
+                    h[i + p + nr] = r[p + nrb];
+                    h[i + p + nr + n] = r[p + nrb + nb];
+                }
+            }
+            t++;
+        }
+
+        // update current block endpoints
+        while(k - 1 >= start && std::abs(E[k - 1]) < thresh)
+        {
+            defl += (E[k - 1] != 0);
+            E[k - 1] = 0;
+            k--;
+        }
+
+        for(i = k - 1; i >= start; i--)
+        {
+            if(std::abs(E[i]) < thresh)
+            {
+                defl += (E[i] != 0);
+                E[i] = 0;
+                break;
+            }
+        }
+        i++;
+    }
+
+    // save state of the diagonal block
+    state[0] = i;
+    state[1] = k;
+    state[2] = iter;
+    if(k > start && iter < maxiter)
+        atomicAdd(pending, 1);
+
+    // (t is the number of QR steps applied in this call)
+    if(diagA)
+        diagnostics_add(diagA + bid, t, defl);
+}
+
+/** BDSQR_BLOCKED_ROTATE kernel applies the rotations saved by bdsqr_blocked_chase to the
+    rows (if rows = true) or columns of the n-by-nvec (or nvec-by-n) matrix A. The rotations
+    of each sweep are applied in the direction of the corresponding QR step, keeping the running
+    element in a register. (Each thread works with a different column, or row, of A.) **/
+template <typename T, typename S, typename W>
+ROCSOLVER_KERNEL void bdsqr_blocked_rotate(const bool rows,
+                                           const rocblas_int n,
+                                           const rocblas_int nvec,
+                                           W AA,
+                                           const rocblas_int shiftA,
+                                           const rocblas_int lda,
+                                           const rocblas_stride strideA,
+                                           rocblas_int* info,
+                                           S* workA,
+                                           const rocblas_int offW,
+                                           const rocblas_int incW,
+                                           const rocblas_stride strideW,
+                                           const rocblas_int nsteps)
+{
+    rocblas_int j = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocblas_int bid = hipBlockIdx_y;
+
+    // if a NaN or Inf was detected in the input, return
+    if(info[bid] != 0 || j >= nvec)
+        return;
+
+    // select batch instance to work with
+    T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+    S* flags = workA + bid * strideW + 2 + incW * n;
+    S* hist = flags + nsteps * n + offW;
+
+    int64_t incp = rows ? 1 : lda;
+    T* a = A + j * (rows ? static_cast<int64_t>(lda) : 1);
+
+    S* f;
+    S *c, *s;
+    T x, y;
+    for(rocblas_int t = 0; t < nsteps; t++)
+    {
+        f = flags + t * n;
+        c = hist + t * incW * n;
+        s = c + n;
+
+        rocblas_int p = 0;
+        while(p < n - 1)
+        {
+            S dir = f[p];
+            if(dir == 0)
+            {
+                p++;
+                continue;
+            }
+
+            // find the run of rotations of the current block
+            rocblas_int e = p;
+            while(e + 1 < n - 1 && f[e + 1] == dir)
+                e++;
+
+            if(dir > 0)
+            {
+                // rotate in the forward direction
+                x = a[p * incp];
+                for(rocblas_int q = p; q <= e; q++)
+                {
+                    y = a[(q + 1) * incp];
+                    a[q * incp] = c[q] * x + s[q] * y;
+                    x = c[q] * y - s[q] * x;
+                }
+                a[(e + 1) * incp] = x;
+            }
+            else
+            {
+                // rotate in the backward direction
+                x = a[(e + 1) * incp];
+                for(rocblas_int q = e; q >= p; q--)
+                {
+                    y = a[q * incp];
+                    a[(q + 1) * incp] = c[q] * x - s[q] * y;
+                    x = c[q] * y + s[q] * x;
+                }
+                a[p * incp] = x;
+            }
+
+            p = e + 1;
+        }
+    }
 }
 
 /** BDSQR_LOWER2UPPER kernel transforms a lower bidiagonal matrix given by D and E
@@ -936,6 +1235,243 @@ ROCSOLVER_KERNEL void bdsqr_sort(const rocblas_int n,
 /****** Template function, workspace size and argument validation **********/
 /***************************************************************************/
 
+/** BDSQR_BLOCKED_ROTATIONS applies the rotations saved in the workspace by the last nsteps QR
+    steps to the requested singular vectors (see bdsqr_blocked_rotate) **/
+template <typename T, typename S, typename W1, typename W2, typename W3>
+void bdsqr_blocked_rotations(rocblas_handle handle,
+                             const rocblas_int n,
+                             const rocblas_int nv,
+                             const rocblas_int nu,
+                             const rocblas_int nc,
+                             W1 V,
+                             const rocblas_int shiftV,
+                             const rocblas_int ldv,
+                             const rocblas_stride strideV,
+                             W2 U,
+                             const rocblas_int shiftU,
+                             const rocblas_int ldu,
+                             const rocblas_stride strideU,
+                             W3 C,
+                             const rocblas_int shiftC,
+                             const rocblas_int ldc,
+                             const rocblas_stride strideC,
+                             rocblas_int* info,
+                             const rocblas_int batch_count,
+                             S* work,
+                             const rocblas_int incW,
+                             const rocblas_stride strideW,
+                             const rocblas_int nsteps)
+{
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int nrot = nv ? 2 * n : 0;
+    dim3 threadsR(BDSQR_BLOCKED_ROTATE_THDS, 1, 1);
+
+    if(nv)
+    {
+        dim3 gridR((nv - 1) / BDSQR_BLOCKED_ROTATE_THDS + 1, batch_count, 1);
+        ROCSOLVER_LAUNCH_KERNEL((bdsqr_blocked_rotate<T>), gridR, threadsR, 0, stream, true, n, nv,
+                                V, shiftV, ldv, strideV, info, work, 0, incW, strideW, nsteps);
+    }
+    if(nu)
+    {
+        dim3 gridR((nu - 1) / BDSQR_BLOCKED_ROTATE_THDS + 1, batch_count, 1);
+        ROCSOLVER_LAUNCH_KERNEL((bdsqr_blocked_rotate<T>), gridR, threadsR, 0, stream, false, n, nu,
+                                U, shiftU, ldu, strideU, info, work, nrot, incW, strideW, nsteps);
+    }
+    if(nc)
+    {
+        dim3 gridR((nc - 1) / BDSQR_BLOCKED_ROTATE_THDS + 1, batch_count, 1);
+        ROCSOLVER_LAUNCH_KERNEL((bdsqr_blocked_rotate<T>), gridR, threadsR, 0, stream, true, n, nc,
+                                C, shiftC, ldc, strideC, info, work, nrot, incW, strideW, nsteps);
+    }
+}
+
+/** BDSQR_HYBRID runs the main loop of the bdsqr algorithm on the host (hybrid mode). The
+    bidiagonal matrices are copied to pinned host memory, and their diagonal blocks are processed
+    in parallel by up to BDSQR_HYBRID_THREADS host threads. If singular vectors are required, the
+    rotations of every nsteps QR steps are sent to the device and applied by bdsqr_blocked_rotate,
+    while the host computes the next nsteps QR steps. The resulting D and E are copied back to
+    the device. Returns rocblas_status_continue, without modifying any data, if the host
+    resources could not be obtained. **/
+template <typename T, typename S, typename W1, typename W2, typename W3>
+rocblas_status bdsqr_hybrid(rocblas_handle handle,
+                            const rocblas_int n,
+                            const rocblas_int nv,
+                            const rocblas_int nu,
+                            const rocblas_int nc,
+                            S* D,
+                            const rocblas_stride strideD,
+                            S* E,
+                            const rocblas_stride strideE,
+                            W1 V,
+                            const rocblas_int shiftV,
+                            const rocblas_int ldv,
+                            const rocblas_stride strideV,
+                            W2 U,
+                            const rocblas_int shiftU,
+                            const rocblas_int ldu,
+                            const rocblas_stride strideU,
+                            W3 C,
+                            const rocblas_int shiftC,
+                            const rocblas_int ldc,
+                            const rocblas_stride strideC,
+                            rocblas_int* info,
+                            const rocblas_int batch_count,
+                            rocblas_int* splits_map,
+                            S* work,
+                            const rocblas_int incW,
+                            const rocblas_stride strideW,
+                            const rocblas_int nsteps,
+                            const rocblas_int maxiter,
+                            const S eps,
+                            const S tol,
+                            const S minshift)
+{
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    const bool vect = (nv || nu || nc);
+    const bool nuc = (nu || nc);
+
+    // pinned host buffers: copies of D and E, the convergence thresholds, two sets of saved
+    // rotations (so that one can be filled while the other is being copied to the device),
+    // the split indices and the info values
+    size_t sizeR = vect ? size_t(nsteps) * (1 + incW) * n : 0;
+    size_t sizeS = 2 * size_t(n) * batch_count + batch_count + 2 * sizeR * batch_count;
+    size_t sizeI = size_t(n) * batch_count + batch_count;
+
+    bdsqr_host_buffers hbuf;
+    if(hipHostMalloc(&hbuf.ptr, sizeof(S) * sizeS + sizeof(rocblas_int) * sizeI, 0) != hipSuccess)
+        return rocblas_status_continue;
+    for(hipEvent_t& e : hbuf.copied)
+    {
+        if(hipEventCreateWithFlags(&e, hipEventDisableTiming) != hipSuccess)
+            return rocblas_status_continue;
+    }
+
+    S* hD = (S*)hbuf.ptr;
+    S* hE = hD + size_t(n) * batch_count;
+    S* hthresh = hE + size_t(n) * batch_count;
+    S* hrots = hthresh + batch_count;
+    rocblas_int* hsplits = (rocblas_int*)(hrots + 2 * sizeR * batch_count);
+    rocblas_int* hinfo = hsplits + size_t(n) * batch_count;
+    std::fill(hrots, hrots + 2 * sizeR * batch_count, S(0));
+
+    // read the bidiagonal matrices, thresholds and diagonal blocks computed by bdsqr_init
+    size_t pitchD = sizeof(S) * std::max(strideD, rocblas_stride(n));
+    size_t pitchE = sizeof(S) * std::max(strideE, rocblas_stride(n - 1));
+    HIP_CHECK(hipMemcpy2DAsync(hD, sizeof(S) * n, D, pitchD, sizeof(S) * n, batch_count,
+                               hipMemcpyDeviceToHost, stream));
+    HIP_CHECK(hipMemcpy2DAsync(hE, sizeof(S) * n, E, pitchE, sizeof(S) * (n - 1), batch_count,
+                               hipMemcpyDeviceToHost, stream));
+    HIP_CHECK(hipMemcpy2DAsync(hthresh, sizeof(S), work + 1, sizeof(S) * strideW, sizeof(S),
+                               batch_count, hipMemcpyDeviceToHost, stream));
+    HIP_CHECK(hipMemcpyAsync(hsplits, splits_map, sizeof(rocblas_int) * n * batch_count,
+                             hipMemcpyDeviceToHost, stream));
+    HIP_CHECK(hipMemcpyAsync(hinfo, info, sizeof(rocblas_int) * batch_count,
+                             hipMemcpyDeviceToHost, stream));
+    rocsolver_stats_host_sync();
+    HIP_CHECK(hipStreamSynchronize(stream));
+
+    // list the diagonal blocks to be processed
+    // (as batch instance and block index pairs)
+    std::vector<std::pair<rocblas_int, rocblas_int>> blocks;
+    for(rocblas_int bid = 0; bid < batch_count; bid++)
+    {
+        // if a NaN or Inf was detected in the input, skip
+        if(hinfo[bid] != 0)
+            continue;
+        for(rocblas_int sid = 0; sid < n / 2; sid++)
+        {
+            if(hsplits[bid * n + 2 * sid + 1] != 0)
+                blocks.push_back({bid, sid});
+        }
+    }
+
+    rocblas_int nblocks = blocks.size();
+    rocblas_int nthreads = std::max(1u, std::thread::hardware_concurrency());
+    nthreads = std::max(1, std::min({nthreads, nblocks, rocblas_int(BDSQR_HYBRID_THREADS)}));
+
+    std::vector<rocblas_int> states(2 * size_t(n) * batch_count);
+    std::vector<S> rots(size_t(nthreads) * incW * n);
+    std::vector<char> pending(nblocks);
+
+    // apply (up to) nsteps QR steps to every diagonal block;
+    // returns true if any diagonal block has not yet converged
+    auto chase = [&](S* hr, const bool first) {
+        auto worker = [&](const rocblas_int w) {
+            for(rocblas_int b = w; b < nblocks; b += nthreads)
+            {
+                rocblas_int bid = blocks[b].first;
+                rocblas_int sid = blocks[b].second;
+                rocblas_int* splits = hsplits + bid * n;
+                S* flags = vect ? hr + bid * sizeR : nullptr;
+                S* hist = vect ? flags + nsteps * n : nullptr;
+                rocblas_int* state = states.data() + bid * 2 * n + 4 * sid;
+                pending[b] = bdsqr_host_chase<S>(
+                    n, nv, nuc, splits[2 * sid], splits[2 * sid + 1], hD + bid * n, hE + bid * n,
+                    maxiter, eps, tol, minshift, hthresh[bid], state, rots.data() + w * incW * n,
+                    incW, flags, hist, nsteps, first);
+            }
+        };
+
+        std::vector<std::thread> workers;
+        for(rocblas_int w = 1; w < nthreads; w++)
+            workers.emplace_back(worker, w);
+        worker(0);
+        for(std::thread& th : workers)
+            th.join();
+
+        return std::any_of(pending.begin(), pending.end(), [](char p) { return p != 0; });
+    };
+
+    if(!vect)
+    {
+        // without singular vectors, the diagonal blocks are processed until convergence
+        chase(nullptr, true);
+    }
+    else
+    {
+        S* dflags = work + 2 + incW * n;
+        for(rocblas_int r = 0, more = 1; more; r++)
+        {
+            // wait until the set of saved rotations used two rounds ago has been copied
+            S* hr = hrots + (r % 2) * sizeR * batch_count;
+            if(r >= 2)
+            {
+                rocsolver_stats_host_sync();
+                HIP_CHECK(hipEventSynchronize(hbuf.copied[r % 2]));
+            }
+
+            more = chase(hr, r == 0);
+
+            // update singular vectors on the device
+            // (the host does not wait, and continues with the next QR steps)
+            HIP_CHECK(hipMemcpy2DAsync(dflags, sizeof(S) * strideW, hr, sizeof(S) * sizeR,
+                                       sizeof(S) * sizeR, batch_count, hipMemcpyHostToDevice,
+                                       stream));
+            HIP_CHECK(hipEventRecord(hbuf.copied[r % 2], stream));
+
+            bdsqr_blocked_rotations<T>(handle, n, nv, nu, nc, V, shiftV, ldv, strideV, U, shiftU,
+                                       ldu, strideU, C, shiftC, ldc, strideC, info, batch_count,
+                                       work, incW, strideW, nsteps);
+        }
+    }
+
+    // write back the resulting bidiagonal matrices
+    // (the stream is synchronized before the pinned buffers are released)
+    HIP_CHECK(hipMemcpy2DAsync(D, pitchD, hD, sizeof(S) * n, sizeof(S) * n, batch_count,
+                               hipMemcpyHostToDevice, stream));
+    HIP_CHECK(hipMemcpy2DAsync(E, pitchE, hE, sizeof(S) * n, sizeof(S) * (n - 1), batch_count,
+                               hipMemcpyHostToDevice, stream));
+    rocsolver_stats_host_sync();
+    HIP_CHECK(hipStreamSynchronize(stream));
+
+    return rocblas_status_success;
+}
+
 template <typename T>
 void rocsolver_bdsqr_getMemorySize(const rocblas_int n,
                                    const rocblas_int nv,
@@ -943,7 +1479,8 @@ void rocsolver_bdsqr_getMemorySize(const rocblas_int n,
                                    const rocblas_int nc,
                                    const rocblas_int batch_count,
                                    size_t* size_splits_map,
-                                   size_t* size_work)
+                                   size_t* size_work,
+                                   const bool hybrid = false)
 {
     // if quick return, no workspace is needed
     if(n == 0 || batch_count == 0)
@@ -953,16 +1490,26 @@ void rocsolver_bdsqr_getMemorySize(const rocblas_int n,
         return;
     }
 
+    // the blocked algorithm (and the hybrid mode) apply the rotations of several QR steps at once
+    bool blocked = ((n >= BDSQR_BLOCKED_SWITCHSIZE || hybrid) && (nv || nu || nc));
+
     // size of split indices array
+    // (plus the state of each diagonal block and the pending counter, if blocked)
     *size_splits_map = sizeof(rocblas_int) * n * batch_count;
+    if(blocked)
+        *size_splits_map += sizeof(rocblas_int) * (2 * n * batch_count + 1);
 
     // size of workspace
+    // (plus the history of rotations, if blocked)
     rocblas_int incW = 0;
     if(nv)
         incW += 2;
     if(nu || nc)
         incW += 2;
-    *size_work = sizeof(T) * (2 + incW * n) * batch_count;
+    size_t strideW = 2 + incW * n;
+    if(blocked)
+        strideW += size_t(BDSQR_BLOCKED_STEPS) * (1 + incW) * n;
+    *size_work = sizeof(T) * strideW * batch_count;
 }
 
 template <typename S, typename W>
@@ -1032,11 +1579,12 @@ rocblas_status rocsolver_bdsqr_template(rocblas_handle handle,
                                         rocblas_int* info,
                                         const rocblas_int batch_count,
                                         rocblas_int* splits_map,
-                                        S* work)
+                                        S* work,
+                                        const bool hybrid = false)
 {
     ROCSOLVER_ENTER("bdsqr", "uplo:", uplo, "n:", n, "nv:", nv, "nu:", nu, "nc:", nc,
                     "shiftV:", shiftV, "ldv:", ldv, "shiftU:", shiftU, "ldu:", ldu,
-                    "shiftC:", shiftC, "ldc:", ldc, "bc:", batch_count);
+                    "shiftC:", shiftC, "ldc:", ldc, "bc:", batch_count, "hybrid:", hybrid);
 
     // quick return
     if(n == 0 || batch_count == 0)
@@ -1045,6 +1593,10 @@ rocblas_status rocsolver_bdsqr_template(rocblas_handle handle,
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
+    // diagnostics = 0
+    rocsolver_diagnostics* diag = get_diagnostics(handle, batch_count);
+    diagnostics_reset<T>(stream, diag, batch_count);
+
     // set tolerance and max number of iterations:
     // machine precision (considering rounding strategy)
     S eps = get_epsilon<S>() / 2;
@@ -1065,6 +1617,15 @@ rocblas_status rocsolver_bdsqr_template(rocblas_handle handle,
         incW += 2;
     rocblas_stride strideW = 2 + incW * n;
 
+    // the blocked algorithm and the hybrid mode need to check for convergence on the host, and
+    // thus they are not used while the stream is being captured into a graph
+    bool blocked = (n >= BDSQR_BLOCKED_SWITCHSIZE && (nv || nu || nc));
+    rocblas_int nsteps = BDSQR_BLOCKED_STEPS;
+    if((blocked || hybrid) && (nv || nu || nc))
+        strideW += rocblas_stride(nsteps) * (1 + incW) * n;
+    blocked = blocked && !stream_is_capturing(stream);
+    bool use_host = hybrid && !stream_is_capturing(stream);
+
     // grid dimensions
     rocblas_int nuc_max = std::max(nu, nc);
     rocblas_int nvuc_max = std::max(nv, nuc_max);
@@ -1076,6 +1637,7 @@ rocblas_status rocsolver_bdsqr_template(rocblas_handle handle,
     dim3 threads3((nv || nu || nc ? std::min(nvuc_max, BS1) : 1), 1, 1);
 
     // check for NaNs and Infs in input
+    diagnostics_mark<T>(stream, diag, batch_count, 0, true);
     ROCSOLVER_LAUNCH_KERNEL((bdsqr_init<T>), grid1, threads1, 0, stream, n, D, strideD, E, strideE,
                             info, maxiter, sfm, tol, splits_map, work, incW, strideW);
 
@@ -1088,18 +1650,84 @@ rocblas_status rocsolver_bdsqr_template(rocblas_handle handle,
                                     D, strideD, E, strideE, U, shiftU, ldu, strideU, C, shiftC, ldc,
                                     strideC, info, work, strideW);
         }
+        diagnostics_mark<T>(stream, diag, batch_count, 0, false);
+
+        diagnostics_mark<T>(stream, diag, batch_count, 1, true);
+
+        // main computation of SVD on the host (hybrid mode), if possible
+        rocblas_status hstatus = rocblas_status_continue;
+        if(use_host)
+            hstatus = bdsqr_hybrid<T>(handle, n, nv, nu, nc, D, strideD, E, strideE, V, shiftV,
+                                      ldv, strideV, U, shiftU, ldu, strideU, C, shiftC, ldc,
+                                      strideC, info, batch_count, splits_map, work, incW,
+                                      strideW, nsteps, maxiter, eps, tol, minshift);
 
-        // main computation of SVD
-        ROCSOLVER_LAUNCH_KERNEL((bdsqr_kernel<T>), grid2, threads3, 0, stream, n, nv, nu, nc, D,
-                                strideD, E, strideE, V, shiftV, ldv, strideV, U, shiftU, ldu,
-                                strideU, C, shiftC, ldc, strideC, info, maxiter, eps, sfm, tol,
-                                minshift, splits_map, work, incW, strideW);
+        if(hstatus != rocblas_status_continue)
+        {
+            if(hstatus != rocblas_status_success)
+                return hstatus;
+        }
+        else if(blocked)
+        {
+            // main computation of SVD (blocked algorithm):
+            // every diagonal block is processed by its own thread group and the rotations
+            // of nsteps QR steps are applied at once to the singular vectors by thread groups
+            // spanning all their columns (or rows)
+            rocblas_int h_pending = 1;
+            rocblas_int* states = splits_map + n * batch_count;
+            rocblas_int* pending = states + 2 * n * batch_count;
+            S* flags = work + 2 + incW * n;
+
+            dim3 gridF((nsteps * n - 1) / BS1 + 1, batch_count, 1);
+            dim3 gridC(1, n / 2, batch_count);
+            dim3 threadsF(BS1, 1, 1);
+
+            // clear the history of rotations
+            ROCSOLVER_LAUNCH_KERNEL(reset_batch_info<S>, gridF, threadsF, 0, stream, flags,
+                                    strideW, nsteps * n, 0);
+
+            for(bool first = true; h_pending > 0; first = false)
+            {
+                ROCSOLVER_LAUNCH_KERNEL(reset_info, dim3(1, 1, 1), dim3(1, 1, 1), 0, stream,
+                                        pending, 1, 0);
+
+                // apply nsteps QR steps to the diagonal blocks
+                ROCSOLVER_LAUNCH_KERNEL((bdsqr_blocked_chase<S>), gridC, threads1, 0, stream, n, nv,
+                                        (nu || nc), D, strideD, E, strideE, info, maxiter, eps,
+                                        tol, minshift, splits_map, states, pending, work, incW,
+                                        strideW, nsteps, first, diag);
+
+                // update singular vectors
+                bdsqr_blocked_rotations<T>(handle, n, nv, nu, nc, V, shiftV, ldv, strideV, U,
+                                           shiftU, ldu, strideU, C, shiftC, ldc, strideC, info,
+                                           batch_count, work, incW, strideW, nsteps);
+
+                // check if any diagonal block has not yet converged
+                HIP_CHECK(hipMemcpyAsync(&h_pending, pending, sizeof(rocblas_int),
+                                         hipMemcpyDeviceToHost, stream));
+                rocsolver_stats_host_sync();
+                HIP_CHECK(hipStreamSynchronize(stream));
+            }
+        }
+        else
+        {
+            // main computation of SVD
+            ROCSOLVER_LAUNCH_KERNEL((bdsqr_kernel<T>), grid2, threads3, 0, stream, n, nv, nu, nc,
+                                    D, strideD, E, strideE, V, shiftV, ldv, strideV, U, shiftU,
+                                    ldu, strideU, C, shiftC, ldc, strideC, info, maxiter, eps, sfm,
+                                    tol, minshift, splits_map, work, incW, strideW, diag);
+        }
+        diagnostics_mark<T>(stream, diag, batch_count, 1, false);
     }
+    else
+        diagnostics_mark<T>(stream, diag, batch_count, 0, false);
 
     // sort the singular values and vectors
+    diagnostics_mark<T>(stream, diag, batch_count, 2, true);
     ROCSOLVER_LAUNCH_KERNEL((bdsqr_sort<T>), grid1, threads3, 0, stream, n, nv, nu, nc, D, strideD,
                             E, strideE, V, shiftV, ldv, strideV, U, shiftU, ldu, strideU, C, shiftC,
                             ldc, strideC, info, splits_map);
+    diagnostics_mark<T>(stream, diag, batch_count, 2, false);
 
     return rocblas_status_success;
 }
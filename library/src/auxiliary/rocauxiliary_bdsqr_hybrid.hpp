@@ -0,0 +1,375 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+
+#include "rocblas.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/************** Host functions (hybrid mode) *******************/
+/***************************************************************/
+
+/** BDSQR_HOST_BUFFERS holds the pinned host memory and the events used by the hybrid mode,
+    and releases them when it goes out of scope **/
+struct bdsqr_host_buffers
+{
+    void* ptr = nullptr;
+    hipEvent_t copied[2] = {nullptr, nullptr};
+
+    ~bdsqr_host_buffers()
+    {
+        for(hipEvent_t e : copied)
+        {
+            if(e)
+                hipEventDestroy(e);
+        }
+        if(ptr)
+            hipHostFree(ptr);
+    }
+};
+
+/** BDSQR_HOST_LARTG computes the parameters of a Givens rotation on the host
+    (as the device function lartg) **/
+template <typename S>
+void bdsqr_host_lartg(const S f, const S g, S& c, S& s, S& r)
+{
+    if(g == 0)
+    {
+        c = 1;
+        s = 0;
+        r = f;
+    }
+    else if(f == 0)
+    {
+        c = 0;
+        s = 1;
+        r = -g;
+    }
+    else
+    {
+        S t;
+        if(std::abs(g) > std::abs(f))
+        {
+            t = -f / g;
+            s = 1 / std::sqrt(1 + t * t);
+            c = s * t;
+        }
+        else
+        {
+            t = -g / f;
+            c = 1 / std::sqrt(1 + t * t);
+            s = c * t;
+        }
+        r = c * f - s * g;
+    }
+}
+
+/** BDSQR_HOST_ESTIMATE computes on the host an estimate of the smallest singular value of the
+    n-by-n upper bidiagonal matrix given by D and E, and applies the convergence test
+    (as the device function bdsqr_estimate with conver = 1) **/
+template <typename S>
+S bdsqr_host_estimate(const rocblas_int n, S* D, S* E, const int t2b, const S tol)
+{
+    S smin = t2b ? std::abs(D[0]) : std::abs(D[n - 1]);
+    S t = smin;
+
+    rocblas_int je, jd;
+
+    for(rocblas_int i = 1; i < n; ++i)
+    {
+        jd = t2b ? i : n - 1 - i;
+        je = jd - t2b;
+        if(std::abs(E[je]) <= tol * t)
+        {
+            E[je] = 0;
+            smin = -1;
+            break;
+        }
+        t = std::abs(D[jd]) * t / (t + std::abs(E[je]));
+        smin = (t < smin) ? t : smin;
+    }
+
+    return smin;
+}
+
+/** BDSQR_HOST_QRSTEP applies on the host an implicit QR iteration to the n-by-n bidiagonal
+    matrix given by D and E, using shift = sh, from top to bottom (if t2b = 1) or from bottom to
+    top. The rotations are saved in rots with the same layout as in the device functions
+    bdsqr_t2bQRstep and bdsqr_b2tQRstep. **/
+template <typename S>
+void bdsqr_host_QRstep(const int t2b,
+                       const rocblas_int n,
+                       const bool nv,
+                       const bool nuc,
+                       S* D,
+                       S* E,
+                       const S sh,
+                       S* rots)
+{
+    S f, g, c, s, r;
+    rocblas_int nr = nv ? 2 * n : 0;
+
+    if(t2b)
+    {
+        int sgn = (S(0) < D[0]) - (D[0] < S(0));
+        if(D[0] == 0)
+            f = 0;
+        else
+            f = (std::abs(D[0]) - sh) * (S(sgn) + sh / D[0]);
+        g = E[0];
+
+        for(rocblas_int k = 0; k < n - 1; ++k)
+        {
+            // first apply rotation by columns
+            bdsqr_host_lartg(f, g, c, s, r);
+            if(k > 0)
+                E[k - 1] = r;
+            f = c * D[k] - s * E[k];
+            E[k] = c * E[k] + s * D[k];
+            g = -s * D[k + 1];
+            D[k + 1] = c * D[k + 1];
+            if(nv)
+            {
+                rots[k] = c;
+                rots[k + n] = -s;
+            }
+
+            // then apply rotation by rows
+            bdsqr_host_lartg(f, g, c, s, r);
+            D[k] = r;
+            f = c * E[k] - s * D[k + 1];
+            D[k + 1] = c * D[k + 1] + s * E[k];
+            if(k < n - 2)
+            {
+                g = -s * E[k + 1];
+                E[k + 1] = c * E[k + 1];
+            }
+            if(nuc)
+            {
+                rots[k + nr] = c;
+                rots[k + nr + n] = -s;
+            }
+        }
+        E[n - 2] = f;
+    }
+    else
+    {
+        int sgn = (S(0) < D[n - 1]) - (D[n - 1] < S(0));
+        if(D[n - 1] == 0)
+            f = 0;
+        else
+            f = (std::abs(D[n - 1]) - sh) * (S(sgn) + sh / D[n - 1]);
+        g = E[n - 2];
+
+        for(rocblas_int k = n - 1; k > 0; --k)
+        {
+            // first apply rotation by rows
+            bdsqr_host_lartg(f, g, c, s, r);
+            if(k < n - 1)
+                E[k] = r;
+            f = c * D[k] - s * E[k - 1];
+            E[k - 1] = c * E[k - 1] + s * D[k];
+            g = -s * D[k - 1];
+            D[k - 1] = c * D[k - 1];
+            if(nuc)
+            {
+                rots[(k - 1) + nr] = c;
+                rots[(k - 1) + nr + n] = s;
+            }
+
+            // then apply rotation by columns
+            bdsqr_host_lartg(f, g, c, s, r);
+            D[k] = r;
+            f = c * E[k - 1] - s * D[k - 1];
+            D[k - 1] = c * D[k - 1] + s * E[k - 1];
+            if(k > 1)
+            {
+                g = -s * E[k - 2];
+                E[k - 2] = c * E[k - 2];
+            }
+            if(nv)
+            {
+                rots[k - 1] = c;
+                rots[(k - 1) + n] = s;
+            }
+        }
+        E[0] = f;
+    }
+}
+
+/** BDSQR_HOST_CHASE runs on the host up to nsteps iterations of the main loop of the bdsqr
+    algorithm on the diagonal block of D and E that goes from start to last. It mirrors the
+    kernel bdsqr_blocked_chase: the rotations of every QR step are saved in flags and hist with
+    the same layout, and the state of the diagonal block is saved so that the next call can resume
+    from it. If flags = nullptr, no rotations are saved and the iterations continue until the
+    block converges. Returns true if the diagonal block has not yet converged. **/
+template <typename S>
+bool bdsqr_host_chase(const rocblas_int n,
+                      const bool nv,
+                      const bool nuc,
+                      const rocblas_int start,
+                      const rocblas_int last,
+                      S* D,
+                      S* E,
+                      const rocblas_int maxiter,
+                      const S eps,
+                      const S tol,
+                      const S minshift,
+                      const S thresh,
+                      rocblas_int* state,
+                      S* rots,
+                      const rocblas_int incW,
+                      S* flags,
+                      S* hist,
+                      const rocblas_int nsteps,
+                      const bool first)
+{
+    rocblas_int nr = nv ? 2 * n : 0;
+
+    // local variables
+    int t2b;
+    S smin, smax, sh;
+    rocblas_int i, k, iter;
+
+    // read diagonal block endpoints and number of iterations applied
+    // to current block
+    if(first)
+    {
+        i = start;
+        k = last;
+        iter = 0;
+    }
+    else
+    {
+        i = state[0];
+        k = state[1];
+        iter = state[2];
+    }
+
+    // clear the rotations saved in the previous call
+    if(flags)
+    {
+        for(rocblas_int t = 0; t < nsteps; t++)
+            std::fill(flags + start + t * n, flags + last + t * n, S(0));
+    }
+
+    // iterate while diagonal block has not converged
+    rocblas_int t = 0;
+    while(k > start && iter < maxiter && (!flags || t < nsteps))
+    {
+        // current block goes from i until k
+        // determine shift for the QR step
+        // (apply convergence test to find gaps)
+        if(std::abs(D[i]) >= std::abs(D[k]))
+        {
+            t2b = 1;
+            sh = std::abs(D[i]);
+        }
+        else
+        {
+            t2b = 0;
+            sh = std::abs(D[k]);
+        }
+
+        // shift
+        smin = bdsqr_host_estimate<S>(k - i + 1, D + i, E + i, t2b, tol);
+        // estimate of the largest singular value in the block
+        smax = std::abs(D[k]);
+        for(rocblas_int p = i; p < k; p++)
+            smax = std::max(smax, std::max(std::abs(D[p]), std::abs(E[p])));
+
+        // check for gaps, if none then apply QR step
+        if(smin >= 0)
+        {
+            if(smin / smax <= minshift)
+                smin = 0; // shift set to zero if less than accepted value
+            else if(sh > 0)
+            {
+                if(smin * smin / sh / sh < eps)
+                    smin = 0; // shift set to zero if negligible
+            }
+
+            // apply QR step and save its rotations with their global row/column indices
+            rocblas_int nb = k - i + 1;
+            rocblas_int nrb = nv ? 2 * nb : 0;
+
+            iter += k - i;
+            bdsqr_host_QRstep<S>(t2b, nb, nv, nuc, D + i, E + i, smin, rots);
+
+            if(flags)
+            {
+                S* f = flags + t * n;
+                S* h = hist + t * incW * n;
+                for(rocblas_int p = 0; p < nb - 1; p++)
+                {
+                    f[i + p] = t2b ? 1 : -1;
+                    if(nv)
+                    {
+                        h[i + p] = rots[p];
+                        h[i + p + n] = rots[p + nb];
+                    }
+                    if(nuc)
+                    {
+                        h[i + p + nr] = rots[p + nrb];
+                        h[i + p + nr + n] = rots[p + nrb + nb];
+                    }
+                }
+            }
+            t++;
+        }
+
+        // update current block endpoints
+        while(k - 1 >= start && std::abs(E[k - 1]) < thresh)
+        {
+            E[k - 1] = 0;
+            k--;
+        }
+
+        for(i = k - 1; i >= start; i--)
+        {
+            if(std::abs(E[i]) < thresh)
+            {
+                E[i] = 0;
+                break;
+            }
+        }
+        i++;
+    }
+
+    // save state of the diagonal block
+    state[0] = i;
+    state[1] = k;
+    state[2] = iter;
+
+    return (k > start && iter < maxiter);
+}
+
+ROCSOLVER_END_NAMESPACE
@@ -72,14 +72,14 @@ rocblas_status rocsolver_bdsvdx_impl(rocblas_handle handle,
     rocblas_int batch_count = 1;
 
     // memory workspace sizes:
-    // size of reusable workspaces (for calling STEBZ and STEIN)
+    // size of reusable workspaces (for calling STEBZ and STEIN, or STEDCX)
     size_t size_work1_iwork, size_work2_pivmin, size_Esqr, size_bounds, size_inter, size_ninter;
     // size for temporary arrays
     size_t size_nsplit, size_iblock, size_isplit_map, size_Dtgk, size_Etgk, size_Stmp;
-    rocsolver_bdsvdx_getMemorySize<T>(n, batch_count, &size_work1_iwork, &size_work2_pivmin,
-                                      &size_Esqr, &size_bounds, &size_inter, &size_ninter,
-                                      &size_nsplit, &size_iblock, &size_isplit_map, &size_Dtgk,
-                                      &size_Etgk, &size_Stmp);
+    rocsolver_bdsvdx_getMemorySize<T>(svect, srange, n, il, iu, batch_count, &size_work1_iwork,
+                                      &size_work2_pivmin, &size_Esqr, &size_bounds, &size_inter,
+                                      &size_ninter, &size_nsplit, &size_iblock, &size_isplit_map,
+                                      &size_Dtgk, &size_Etgk, &size_Stmp);
 
     if(rocblas_is_device_memory_size_query(handle))
         return rocblas_set_optimal_device_memory_size(
@@ -33,6 +33,7 @@
 #pragma once
 
 #include "auxiliary/rocauxiliary_stebz.hpp"
+#include "auxiliary/rocauxiliary_stedcx.hpp"
 #include "auxiliary/rocauxiliary_stein.hpp"
 #include "lapack/roclapack_syevx_heevx.hpp"
 #include "lapack_device_functions.hpp"
@@ -64,6 +65,38 @@ ROCSOLVER_KERNEL void bdsvdx_abs_eigs(const rocblas_int n,
         S[tid] = -Stmp[tid];
 }
 
+/** BDSVDX_COPY_VECT copies the first nsv eigenvectors computed by STEDCX into Z, and
+    sets ifail to zero (the divide and conquer method has no convergence failures per vector).
+        - Call this kernel with batch_count groups in z and enough groups of BS2 x BS2
+          threads to cover the 2n x n possible eigenvectors. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void bdsvdx_copy_vect(const rocblas_int n,
+                                       rocblas_int* nsvA,
+                                       T* VA,
+                                       U ZZ,
+                                       const rocblas_int shiftZ,
+                                       const rocblas_int ldz,
+                                       const rocblas_stride strideZ,
+                                       rocblas_int* ifailA,
+                                       const rocblas_stride strideF)
+{
+    // select batch instance
+    rocblas_int bid = hipBlockIdx_z;
+    rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocblas_int j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+
+    // local variables
+    rocblas_int nsv = std::min(nsvA[bid], n);
+    T* V = VA + (bid * 4 * n * n);
+    T* Z = load_ptr_batch<T>(ZZ, bid, shiftZ, strideZ);
+    rocblas_int* ifail = ifailA + (bid * strideF);
+
+    if(i < 2 * n && j < nsv)
+        Z[i + j * ldz] = V[i + j * 2 * n];
+    if(i == 0 && j < n)
+        ifail[j] = 0;
+}
+
 template <typename T, typename U>
 ROCSOLVER_KERNEL void bdsvdx_reorder_vect(const rocblas_fill uplo,
                                           const rocblas_int n,
@@ -127,9 +160,28 @@ ROCSOLVER_KERNEL void bdsvdx_reorder_vect(const rocblas_fill uplo,
     }
 }
 
+// Helper to decide if the eigenpairs of the TGK matrix are computed with STEDCX
+inline bool bdsvdx_use_dc(const rocblas_svect svect,
+                          const rocblas_srange srange,
+                          const rocblas_int n,
+                          const rocblas_int il,
+                          const rocblas_int iu)
+{
+    // (with srange = value, the number of singular values is not known)
+    if(svect == rocblas_svect_none || srange == rocblas_srange_value || n < BDSVDX_MIN_DC_SIZE)
+        return false;
+
+    rocblas_int nsv = (srange == rocblas_srange_index ? iu - il + 1 : n);
+    return int64_t(nsv) * BDSVDX_DC_DIVISOR > n;
+}
+
 // Helper to calculate workspace size requirements
 template <typename T>
-void rocsolver_bdsvdx_getMemorySize(const rocblas_int n,
+void rocsolver_bdsvdx_getMemorySize(const rocblas_svect svect,
+                                    const rocblas_srange srange,
+                                    const rocblas_int n,
+                                    const rocblas_int il,
+                                    const rocblas_int iu,
                                     const rocblas_int batch_count,
                                     size_t* size_work1_iwork,
                                     size_t* size_work2_pivmin,
@@ -185,6 +237,23 @@ void rocsolver_bdsvdx_getMemorySize(const rocblas_int n,
 
     // size of array for temporary singular values
     *size_Stmp = sizeof(T) * 2 * n * batch_count;
+
+    // extra requirements for computing the eigenvalues and eigenvectors (stedcx)
+    // (the workspace of stebz and stein is reused; the 2n x 2n eigenvectors go in iblock)
+    if(bdsvdx_use_dc(svect, srange, n, il, iu))
+    {
+        size_t c1, c2, c3, c4, c5, c6, unused;
+        rocsolver_stedcx_getMemorySize<false, T, T>(rocblas_evect_tridiagonal, 2 * n, batch_count,
+                                                    &c1, &c2, &c3, &c4, &c5, &c6, &unused);
+
+        *size_work2_pivmin = std::max(*size_work2_pivmin, c1);
+        *size_Esqr = std::max(*size_Esqr, c2);
+        *size_bounds = std::max(*size_bounds, c3);
+        *size_inter = std::max(*size_inter, c4);
+        *size_ninter = std::max(*size_ninter, c5);
+        *size_work1_iwork = std::max(*size_work1_iwork, c6);
+        *size_iblock = std::max(*size_iblock, sizeof(T) * 4 * n * n * batch_count);
+    }
 }
 
 // Helper to check argument correctnesss
@@ -327,6 +396,31 @@ rocblas_status rocsolver_bdsvdx_template(rocblas_handle handle,
     rocblas_int iltgk = (srange == rocblas_srange_index ? il : 1);
     rocblas_int iutgk = (srange == rocblas_srange_index ? iu : n);
 
+    if(bdsvdx_use_dc(svect, srange, n, il, iu))
+    {
+        // compute eigenvalues and eigenvectors of tridiagonal matrix with divide and conquer
+        // (the eigenvalues are returned in ascending order)
+        T* V = (T*)iblock;
+        rocsolver_stedcx_template<false, false, T>(
+            handle, rocblas_evect_tridiagonal, range, ntgk, vltgk, vutgk, iltgk, iutgk, Dtgk, ntgk,
+            Etgk, ntgk, nsv, Stmp, ntgk, V, 0, ntgk, ntgk * ntgk, info, batch_count, work2_pivmin,
+            Esqr, bounds, inter, (T*)ninter, work1_iwork, (T**)nullptr);
+
+        // copy the selected eigenvectors
+        rocblas_int blocksZ = (ntgk - 1) / BS2 + 1;
+        rocblas_int blocksV = (n - 1) / BS2 + 1;
+        ROCSOLVER_LAUNCH_KERNEL((bdsvdx_copy_vect<T>), dim3(blocksZ, blocksV, batch_count),
+                                dim3(BS2, BS2), 0, stream, n, nsv, V, Z, shiftZ, ldz, strideZ,
+                                ifail, strideF);
+
+        // take absolute value of eigenvalues, reorder and normalize eigenvector elements,
+        // and negate elements of V
+        ROCSOLVER_LAUNCH_KERNEL(bdsvdx_reorder_vect<T>, dim3(1, batch_count, 1), dim3(BS1, 1, 1), 0,
+                                stream, uplo, n, nsv, S, strideS, Z, shiftZ, ldz, strideZ, Stmp);
+
+        return rocblas_status_success;
+    }
+
     // compute eigenvalues of tridiagonal matrix
     rocsolver_stebz_template<T>(handle, range, order, ntgk, vltgk, vutgk, iltgk, iutgk, 0, Dtgk, 0,
                                 ntgk, Etgk, 0, ntgk, nsv, nsplit, Stmp, ntgk, iblock, ntgk,
@@ -0,0 +1,141 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "rocsolver/rocsolver.h"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/** In the tile layout, an m-by-n matrix is split into mt-by-nt tiles of size nb-by-nb, with
+    mt = ceil(m/nb) and nt = ceil(n/nb). Each tile is stored contiguously, in column-major
+    order with leading dimension nb, and the tiles are stored in column-major order, so that
+    the tile (ti,tj) starts at the position (ti + tj*mt)*nb*nb of the array. **/
+inline rocblas_int tile_count(const rocblas_int m, const rocblas_int nb)
+{
+    return (m - 1) / nb + 1;
+}
+
+__host__ __device__ inline rocblas_stride tile_index(const rocblas_int mt,
+                                                     const rocblas_int nb,
+                                                     const rocblas_int ti,
+                                                     const rocblas_int tj)
+{
+    return (ti + rocblas_stride(tj) * mt) * nb * nb;
+}
+
+/** GE2TILE_KERNEL copies the m-by-n matrix A into the tile array T, with one thread per
+    element of T. The padding of the tiles in the last tile row and column is set to the
+    identity, so that factorizing the padded matrix gives the factors of A padded with the
+    identity. **/
+template <typename T>
+ROCSOLVER_KERNEL void ge2tile_kernel(const rocblas_int m,
+                                     const rocblas_int n,
+                                     const rocblas_int nb,
+                                     const rocblas_int mt,
+                                     const rocblas_int nt,
+                                     const T* A,
+                                     const rocblas_int lda,
+                                     T* TT)
+{
+    const rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const rocblas_int j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+
+    if(i < mt * nb && j < nt * nb)
+    {
+        const rocblas_int ti = i / nb, r = i % nb;
+        const rocblas_int tj = j / nb, c = j % nb;
+
+        T a = (i == j) ? T(1) : T(0);
+        if(i < m && j < n)
+            a = A[i + j * rocblas_stride(lda)];
+        TT[tile_index(mt, nb, ti, tj) + r + c * nb] = a;
+    }
+}
+
+template <typename T>
+rocblas_status rocsolver_ge2tile_argCheck(rocblas_handle handle,
+                                          const rocblas_int m,
+                                          const rocblas_int n,
+                                          const rocblas_int nb,
+                                          const rocblas_int lda,
+                                          T A,
+                                          T TT)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    if(m < 0 || n < 0 || nb < 1 || lda < m)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((m && n && !A) || (m && n && !TT))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T>
+rocblas_status rocsolver_ge2tile_template(rocblas_handle handle,
+                                          const rocblas_int m,
+                                          const rocblas_int n,
+                                          const rocblas_int nb,
+                                          const T* A,
+                                          const rocblas_int lda,
+                                          T* TT)
+{
+    ROCSOLVER_ENTER("ge2tile", "m:", m, "n:", n, "nb:", nb, "lda:", lda);
+
+    // quick return
+    if(m == 0 || n == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    const rocblas_int mt = tile_count(m, nb);
+    const rocblas_int nt = tile_count(n, nb);
+    rocblas_int blocksx = (mt * nb - 1) / BS2 + 1;
+    rocblas_int blocksy = (nt * nb - 1) / BS2 + 1;
+    dim3 grid(blocksx, blocksy, 1);
+    dim3 threads(BS2, BS2, 1);
+
+    ROCSOLVER_LAUNCH_KERNEL(ge2tile_kernel<T>, grid, threads, 0, stream, m, n, nb, mt, nt, A,
+                            lda, TT);
+
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
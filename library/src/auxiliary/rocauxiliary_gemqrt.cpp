@@ -0,0 +1,177 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "rocauxiliary_gemqrt.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+template <typename T, bool COMPLEX = rocblas_is_complex<T>>
+rocblas_status rocsolver_gemqrt_impl(rocblas_handle handle,
+                                     const rocblas_side side,
+                                     const rocblas_operation trans,
+                                     const rocblas_int m,
+                                     const rocblas_int n,
+                                     const rocblas_int k,
+                                     const rocblas_int nb,
+                                     T* V,
+                                     const rocblas_int ldv,
+                                     T* Tf,
+                                     const rocblas_int ldt,
+                                     T* C,
+                                     const rocblas_int ldc)
+{
+    ROCSOLVER_ENTER_TOP("gemqrt", "--side", side, "--trans", trans, "-m", m, "-n", n, "-k", k,
+                        "--nb", nb, "--ldv", ldv, "--ldt", ldt, "--ldc", ldc);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_gemqrt_argCheck<COMPLEX>(handle, side, trans, m, n, k, nb, ldv,
+                                                           ldt, ldc, V, Tf, C);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_int shiftV = 0;
+    rocblas_int shiftC = 0;
+
+    // normal (non-batched non-strided) execution
+    rocblas_stride strideV = 0;
+    rocblas_stride strideT = 0;
+    rocblas_stride strideC = 0;
+    rocblas_int batch_count = 1;
+
+    // memory workspace sizes:
+    // extra requirements for calling LARFB
+    size_t size_tmptr;
+    // size of arrays of pointers (for batched cases)
+    size_t size_workArr;
+    rocsolver_gemqrt_getMemorySize<false, T>(side, m, n, k, nb, batch_count, &size_tmptr,
+                                             &size_workArr);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_tmptr, size_workArr);
+
+    // memory workspace allocation
+    void *tmptr, *workArr;
+    rocblas_device_malloc mem(handle, size_tmptr, size_workArr);
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    tmptr = mem[0];
+    workArr = mem[1];
+
+    // execution
+    return rocsolver_gemqrt_template<false, false, T>(
+        handle, side, trans, m, n, k, nb, V, shiftV, ldv, strideV, Tf, ldt, strideT, C, shiftC,
+        ldc, strideC, batch_count, (T*)tmptr, (T**)workArr);
+}
+
+ROCSOLVER_END_NAMESPACE
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sgemqrt(rocblas_handle handle,
+                                 const rocblas_side side,
+                                 const rocblas_operation trans,
+                                 const rocblas_int m,
+                                 const rocblas_int n,
+                                 const rocblas_int k,
+                                 const rocblas_int nb,
+                                 float* V,
+                                 const rocblas_int ldv,
+                                 float* T,
+                                 const rocblas_int ldt,
+                                 float* C,
+                                 const rocblas_int ldc)
+{
+    return rocsolver::rocsolver_gemqrt_impl<float>(handle, side, trans, m, n, k, nb, V, ldv, T, ldt,
+                                                   C, ldc);
+}
+
+rocblas_status rocsolver_dgemqrt(rocblas_handle handle,
+                                 const rocblas_side side,
+                                 const rocblas_operation trans,
+                                 const rocblas_int m,
+                                 const rocblas_int n,
+                                 const rocblas_int k,
+                                 const rocblas_int nb,
+                                 double* V,
+                                 const rocblas_int ldv,
+                                 double* T,
+                                 const rocblas_int ldt,
+                                 double* C,
+                                 const rocblas_int ldc)
+{
+    return rocsolver::rocsolver_gemqrt_impl<double>(handle, side, trans, m, n, k, nb, V, ldv, T,
+                                                    ldt, C, ldc);
+}
+
+rocblas_status rocsolver_cgemqrt(rocblas_handle handle,
+                                 const rocblas_side side,
+                                 const rocblas_operation trans,
+                                 const rocblas_int m,
+                                 const rocblas_int n,
+                                 const rocblas_int k,
+                                 const rocblas_int nb,
+                                 rocblas_float_complex* V,
+                                 const rocblas_int ldv,
+                                 rocblas_float_complex* T,
+                                 const rocblas_int ldt,
+                                 rocblas_float_complex* C,
+                                 const rocblas_int ldc)
+{
+    return rocsolver::rocsolver_gemqrt_impl<rocblas_float_complex>(handle, side, trans, m, n, k, nb,
+                                                                   V, ldv, T, ldt, C, ldc);
+}
+
+rocblas_status rocsolver_zgemqrt(rocblas_handle handle,
+                                 const rocblas_side side,
+                                 const rocblas_operation trans,
+                                 const rocblas_int m,
+                                 const rocblas_int n,
+                                 const rocblas_int k,
+                                 const rocblas_int nb,
+                                 rocblas_double_complex* V,
+                                 const rocblas_int ldv,
+                                 rocblas_double_complex* T,
+                                 const rocblas_int ldt,
+                                 rocblas_double_complex* C,
+                                 const rocblas_int ldc)
+{
+    return rocsolver::rocsolver_gemqrt_impl<rocblas_double_complex>(handle, side, trans, m, n, k,
+                                                                    nb, V, ldv, T, ldt, C, ldc);
+}
+
+} // extern C
@@ -0,0 +1,207 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "rocauxiliary_larfb.hpp"
+#include "rocblas.hpp"
+#include "rocsolver/rocsolver.h"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+template <bool BATCHED, typename T>
+void rocsolver_gemqrt_getMemorySize(const rocblas_side side,
+                                    const rocblas_int m,
+                                    const rocblas_int n,
+                                    const rocblas_int k,
+                                    const rocblas_int nb,
+                                    const rocblas_int batch_count,
+                                    size_t* size_tmptr,
+                                    size_t* size_workArr)
+{
+    // if quick return no workspace needed
+    if(m == 0 || n == 0 || k == 0 || batch_count == 0)
+    {
+        *size_tmptr = 0;
+        *size_workArr = 0;
+        return;
+    }
+
+    // requirements for calling LARFB
+    rocsolver_larfb_getMemorySize<BATCHED, T>(side, m, n, std::min(nb, k), batch_count, size_tmptr,
+                                              size_workArr);
+}
+
+template <bool COMPLEX, typename T>
+rocblas_status rocsolver_gemqrt_argCheck(rocblas_handle handle,
+                                         const rocblas_side side,
+                                         const rocblas_operation trans,
+                                         const rocblas_int m,
+                                         const rocblas_int n,
+                                         const rocblas_int k,
+                                         const rocblas_int nb,
+                                         const rocblas_int ldv,
+                                         const rocblas_int ldt,
+                                         const rocblas_int ldc,
+                                         T V,
+                                         T Tf,
+                                         T C)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(side != rocblas_side_left && side != rocblas_side_right)
+        return rocblas_status_invalid_value;
+    if(trans != rocblas_operation_none && trans != rocblas_operation_transpose
+       && trans != rocblas_operation_conjugate_transpose)
+        return rocblas_status_invalid_value;
+    if((COMPLEX && trans == rocblas_operation_transpose)
+       || (!COMPLEX && trans == rocblas_operation_conjugate_transpose))
+        return rocblas_status_invalid_value;
+    bool left = (side == rocblas_side_left);
+
+    // 2. invalid size
+    if(m < 0 || n < 0 || k < 0 || ldc < m || nb < 1 || ldt < nb)
+        return rocblas_status_invalid_size;
+    if(k > 0 && nb > k)
+        return rocblas_status_invalid_size;
+    if(left && (k > m || ldv < m))
+        return rocblas_status_invalid_size;
+    if(!left && (k > n || ldv < n))
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((m && n && !C) || (k && !Tf) || (left && m && k && !V) || (!left && n && k && !V))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename U>
+rocblas_status rocsolver_gemqrt_template(rocblas_handle handle,
+                                         const rocblas_side side,
+                                         const rocblas_operation trans,
+                                         const rocblas_int m,
+                                         const rocblas_int n,
+                                         const rocblas_int k,
+                                         const rocblas_int nb,
+                                         U V,
+                                         const rocblas_int shiftV,
+                                         const rocblas_int ldv,
+                                         const rocblas_stride strideV,
+                                         T* Tf,
+                                         const rocblas_int ldt,
+                                         const rocblas_stride strideT,
+                                         U C,
+                                         const rocblas_int shiftC,
+                                         const rocblas_int ldc,
+                                         const rocblas_stride strideC,
+                                         const rocblas_int batch_count,
+                                         T* tmptr,
+                                         T** workArr)
+{
+    ROCSOLVER_ENTER("gemqrt", "side:", side, "trans:", trans, "m:", m, "n:", n, "k:", k, "nb:", nb,
+                    "shiftV:", shiftV, "ldv:", ldv, "ldt:", ldt, "shiftC:", shiftC, "ldc:", ldc,
+                    "bc:", batch_count);
+
+    // quick return
+    if(!n || !m || !k || !batch_count)
+        return rocblas_status_success;
+
+    // determine limits and indices
+    // (the triangular factors of the block reflectors are given in T,
+    // there is no need to compute them with LARFT)
+    bool left = (side == rocblas_side_left);
+    bool transpose = (trans != rocblas_operation_none);
+    rocblas_int start, step, ncol, nrow, ic, jc;
+    if(left)
+    {
+        ncol = n;
+        jc = 0;
+        if(transpose)
+        {
+            start = 0;
+            step = 1;
+        }
+        else
+        {
+            start = (k - 1) / nb * nb;
+            step = -1;
+        }
+    }
+    else
+    {
+        nrow = m;
+        ic = 0;
+        if(transpose)
+        {
+            start = (k - 1) / nb * nb;
+            step = -1;
+        }
+        else
+        {
+            start = 0;
+            step = 1;
+        }
+    }
+
+    rocblas_int i, ib;
+    for(rocblas_int j = 0; j < k; j += nb)
+    {
+        i = start + step * j; // current householder block
+        ib = std::min(nb, k - i);
+        if(left)
+        {
+            nrow = m - i;
+            ic = i;
+        }
+        else
+        {
+            ncol = n - i;
+            jc = i;
+        }
+
+        // apply current block reflector
+        rocsolver_larfb_template<BATCHED, STRIDED, T>(
+            handle, side, trans, rocblas_forward_direction, rocblas_column_wise, nrow, ncol, ib, V,
+            shiftV + idx2D(i, i, ldv), ldv, strideV, Tf, idx2D(0, i, ldt), ldt, strideT, C,
+            shiftC + idx2D(ic, jc, ldc), ldc, strideC, batch_count, tmptr, workArr);
+    }
+
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
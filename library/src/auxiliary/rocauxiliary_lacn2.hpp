@@ -0,0 +1,380 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.9.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     November 2019
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "lapack_device_functions.hpp"
+#include "rocblas.hpp"
+#include "rocsolver/rocsolver.h"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/** LACN2 estimates the 1-norm of a square matrix B by Hager's method with Higham's
+    modifications, using only the products B*x and B'*x (B' being the conjugate transpose).
+    Here B is the inverse of a matrix given by its factors, so that the products are
+    triangular solves.
+
+    LAPACK's reverse communication is replaced by a fixed schedule of LACN2_ROUNDS rounds: each
+    round calls LACN2_KERNEL, which consumes the result of the previous product and prepares the
+    next vector in x, and then computes x = B*x (odd rounds, counting from 1) or x = B'*x (even
+    rounds) for all the problems in the batch. A problem that has converged, or that waits for a
+    product of the other kind, sets x to zero. All the control flow thus stays on the device. **/
+
+#define LACN2_ITMAX 5
+#define LACN2_ROUNDS 11
+#define LACN2_STATE_SIZE 4
+
+// values of the state (jump) of the estimation of every problem, following the labels of LAPACK
+#define LACN2_START 0 // x = (1/n,...,1/n)
+#define LACN2_SIGN1 1 // x holds B*(1/n,...,1/n)
+#define LACN2_MAXJ 2 // x holds B'*sign(x)
+#define LACN2_EJ 3 // x holds B*e_j
+#define LACN2_CYCLE 4 // x holds B'*sign(x)
+#define LACN2_ALT 5 // x holds B*(alternating vector)
+#define LACN2_WAIT 6 // the alternating vector is waiting for a product B*x
+#define LACN2_DONE 7 // the estimation has finished
+
+/** LACN2_ASUM returns the sum of the absolute values of x in all the threads of the group **/
+template <typename T, typename S>
+__device__ S lacn2_asum(const rocblas_int tid, const rocblas_int n, T* x, S* sval)
+{
+    S s = 0;
+    for(rocblas_int i = tid; i < n; i += BS1)
+        s += std::sqrt(std::norm(x[i]));
+    sval[tid] = s;
+    __syncthreads();
+
+    for(rocblas_int r = BS1 / 2; r > 0; r /= 2)
+    {
+        if(tid < r)
+            sval[tid] += sval[tid + r];
+        __syncthreads();
+    }
+
+    s = sval[0];
+    __syncthreads();
+    return s;
+}
+
+/** LACN2_AMAX returns the (0-based) index of the first element of x with the largest absolute
+    value in all the threads of the group **/
+template <typename T, typename S>
+__device__ rocblas_int
+    lacn2_amax(const rocblas_int tid, const rocblas_int n, T* x, S* sval, rocblas_int* sidx)
+{
+    S v = -1;
+    rocblas_int idx = 0;
+    for(rocblas_int i = tid; i < n; i += BS1)
+    {
+        S a = std::sqrt(std::norm(x[i]));
+        if(a > v)
+        {
+            v = a;
+            idx = i;
+        }
+    }
+    sval[tid] = v;
+    sidx[tid] = idx;
+    __syncthreads();
+
+    for(rocblas_int r = BS1 / 2; r > 0; r /= 2)
+    {
+        if(tid < r)
+        {
+            if(sval[tid + r] > sval[tid]
+               || (sval[tid + r] == sval[tid] && sidx[tid + r] < sidx[tid]))
+            {
+                sval[tid] = sval[tid + r];
+                sidx[tid] = sidx[tid + r];
+            }
+        }
+        __syncthreads();
+    }
+
+    idx = sidx[0];
+    __syncthreads();
+    return idx;
+}
+
+/** LACN2_SIGN returns the sign of x (x/|x| in the complex case) **/
+template <typename T, typename S, std::enable_if_t<!rocblas_is_complex<T>, int> = 0>
+__device__ T lacn2_sign(const T x)
+{
+    return (x >= 0) ? T(1) : T(-1);
+}
+
+template <typename T, typename S, std::enable_if_t<rocblas_is_complex<T>, int> = 0>
+__device__ T lacn2_sign(const T x)
+{
+    S a = std::sqrt(std::norm(x));
+    return (a > get_safemin<S>()) ? x / T(a) : T(1);
+}
+
+/** LACN2_INIT starts the estimation of every problem, unless the estimate is known beforehand:
+    if anorm is zero, or if the matrix A has a zero diagonal element (when check_diag is true), the
+    reciprocal condition number will be zero. Call this kernel with batch_count groups in x, and
+    BS1 threads in x. **/
+template <typename T, typename S, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) lacn2_init(const rocblas_int n,
+                                                        U AA,
+                                                        const rocblas_int shiftA,
+                                                        const rocblas_int lda,
+                                                        const rocblas_stride strideA,
+                                                        const bool check_diag,
+                                                        const S* anormA,
+                                                        S* estA,
+                                                        rocblas_int* stateA)
+{
+    const rocblas_int b = hipBlockIdx_x;
+    const rocblas_int tid = hipThreadIdx_x;
+
+    T* A = load_ptr_batch<T>(AA, b, shiftA, strideA);
+    const int64_t la = lda;
+
+    __shared__ rocblas_int singular;
+    if(tid == 0)
+        singular = 0;
+    __syncthreads();
+
+    if(check_diag)
+    {
+        for(rocblas_int i = tid; i < n; i += BS1)
+        {
+            if(A[i + i * la] == T(0))
+                singular = 1;
+        }
+    }
+    __syncthreads();
+
+    if(tid == 0)
+    {
+        rocblas_int* state = stateA + b * LACN2_STATE_SIZE;
+        if(singular || anormA[b] == 0)
+        {
+            state[0] = LACN2_DONE;
+            state[3] = 1;
+        }
+        else
+        {
+            state[0] = LACN2_START;
+            state[3] = 0;
+        }
+        state[1] = 0;
+        state[2] = 0;
+        estA[b] = 0;
+    }
+}
+
+/** LACN2_KERNEL executes one round of the estimation: it consumes the result of the previous
+    product (if any) and prepares in x the vector of the next product, of kind kase (1 for B*x,
+    2 for B'*x). The sign vector of the previous iteration is kept in xi (real case). Call this
+    kernel with batch_count groups in x, and BS1 threads in x. **/
+template <typename T, typename S>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) lacn2_kernel(const rocblas_int n,
+                                                          const rocblas_int kase,
+                                                          T* xA,
+                                                          T* xiA,
+                                                          const rocblas_stride strideX,
+                                                          S* estA,
+                                                          rocblas_int* stateA)
+{
+    const rocblas_int b = hipBlockIdx_x;
+    const rocblas_int tid = hipThreadIdx_x;
+
+    T* x = xA + b * strideX;
+    T* xi = xiA + b * strideX;
+    rocblas_int* state = stateA + b * LACN2_STATE_SIZE;
+
+    // shared mem for the reductions
+    __shared__ S sval[BS1];
+    __shared__ rocblas_int sidx[BS1];
+    __shared__ rocblas_int repeated;
+
+    rocblas_int jump = state[0];
+    rocblas_int iter = state[1];
+    rocblas_int j = state[2];
+    S est = estA[b];
+    __syncthreads();
+
+    if(jump == LACN2_START)
+    {
+        for(rocblas_int i = tid; i < n; i += BS1)
+            x[i] = T(S(1) / S(n));
+        jump = LACN2_SIGN1;
+    }
+    else if(jump == LACN2_SIGN1)
+    {
+        if(n == 1)
+        {
+            est = std::sqrt(std::norm(x[0]));
+            jump = LACN2_DONE;
+        }
+        else
+        {
+            est = lacn2_asum(tid, n, x, sval);
+            for(rocblas_int i = tid; i < n; i += BS1)
+            {
+                xi[i] = lacn2_sign<T, S>(x[i]);
+                x[i] = xi[i];
+            }
+            jump = LACN2_MAXJ;
+        }
+    }
+    else if(jump == LACN2_MAXJ)
+    {
+        j = lacn2_amax(tid, n, x, sval, sidx);
+        iter = 2;
+        for(rocblas_int i = tid; i < n; i += BS1)
+            x[i] = (i == j) ? T(1) : T(0);
+        jump = LACN2_EJ;
+    }
+    else if(jump == LACN2_EJ)
+    {
+        const S estold = est;
+        est = lacn2_asum(tid, n, x, sval);
+
+        // in the real case, a repeated sign vector means that the algorithm has converged
+        if(tid == 0)
+            repeated = rocblas_is_complex<T> ? 0 : 1;
+        __syncthreads();
+        if(!rocblas_is_complex<T>)
+        {
+            for(rocblas_int i = tid; i < n; i += BS1)
+            {
+                if(lacn2_sign<T, S>(x[i]) != xi[i])
+                    repeated = 0;
+            }
+        }
+        __syncthreads();
+
+        if(repeated || est <= estold)
+            jump = LACN2_WAIT;
+        else
+        {
+            for(rocblas_int i = tid; i < n; i += BS1)
+            {
+                xi[i] = lacn2_sign<T, S>(x[i]);
+                x[i] = xi[i];
+            }
+            jump = LACN2_CYCLE;
+        }
+    }
+    else if(jump == LACN2_CYCLE)
+    {
+        const rocblas_int jlast = j;
+        j = lacn2_amax(tid, n, x, sval, sidx);
+        const S xlast
+            = rocblas_is_complex<T> ? std::sqrt(std::norm(x[jlast])) : std::real(x[jlast]);
+        if(xlast != std::sqrt(std::norm(x[j])) && iter < LACN2_ITMAX)
+        {
+            iter++;
+            __syncthreads();
+            for(rocblas_int i = tid; i < n; i += BS1)
+                x[i] = (i == j) ? T(1) : T(0);
+            jump = LACN2_EJ;
+        }
+        else
+            jump = LACN2_WAIT;
+    }
+    else if(jump == LACN2_ALT)
+    {
+        const S temp = 2 * lacn2_asum(tid, n, x, sval) / S(3 * n);
+        if(temp > est)
+            est = temp;
+        jump = LACN2_DONE;
+    }
+
+    // the alternating vector requires a product B*x
+    if(jump == LACN2_WAIT && kase == 1)
+    {
+        for(rocblas_int i = tid; i < n; i += BS1)
+            x[i] = T((i % 2 == 0 ? 1 : -1) * (1 + S(i) / S(n - 1)));
+        jump = LACN2_ALT;
+    }
+
+    // problems that are not waiting for a product of this kind do not need x
+    if(jump == LACN2_WAIT || jump == LACN2_DONE)
+    {
+        for(rocblas_int i = tid; i < n; i += BS1)
+            x[i] = 0;
+    }
+
+    if(tid == 0)
+    {
+        state[0] = jump;
+        state[1] = iter;
+        state[2] = j;
+        estA[b] = est;
+    }
+}
+
+/** LACN2_RCOND computes the reciprocal condition numbers from the estimated norms of the
+    inverses: rcond = 1 / (anorm * est). Call this kernel with batch_count threads in x. **/
+template <typename S>
+ROCSOLVER_KERNEL void lacn2_rcond(const rocblas_int n,
+                                  const S* anormA,
+                                  S* estA,
+                                  rocblas_int* stateA,
+                                  S* rcondA,
+                                  const rocblas_int batch_count)
+{
+    const rocblas_int b = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    if(b >= batch_count)
+        return;
+
+    const S est = estA[b];
+    if(n == 0)
+        rcondA[b] = 1;
+    else if(stateA[b * LACN2_STATE_SIZE + 3] || est == 0)
+        rcondA[b] = 0;
+    else
+        rcondA[b] = (1 / est) / anormA[b];
+}
+
+template <typename T, typename S>
+void rocsolver_lacn2_getMemorySize(const rocblas_int n,
+                                   const rocblas_int batch_count,
+                                   size_t* size_x,
+                                   size_t* size_est,
+                                   size_t* size_state)
+{
+    // the vector x of the products and the sign vector xi
+    *size_x = sizeof(T) * 2 * n * batch_count;
+
+    // the estimates of the norms
+    *size_est = sizeof(S) * batch_count;
+
+    // the state of the estimation of every problem
+    *size_state = sizeof(rocblas_int) * LACN2_STATE_SIZE * batch_count;
+}
+
+ROCSOLVER_END_NAMESPACE
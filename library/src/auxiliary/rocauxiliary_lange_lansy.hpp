@@ -0,0 +1,263 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "rocsolver/rocsolver.h"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/** LANGE_MAX returns the largest of a and b, propagating NaNs so that a matrix with a NaN
+    entry has a NaN norm, as in LAPACK. **/
+template <typename S>
+__device__ __forceinline__ S lange_max(const S a, const S b)
+{
+    return (b > a || b != b) ? b : a;
+}
+
+/** LANGE_ABS returns the absolute value of the entry (i,j) of A. If uplo is not
+    rocblas_fill_full, A is hermitian and only the triangular part given by uplo is referenced;
+    the imaginary parts of the diagonal entries are assumed to be zero. **/
+template <typename S, typename T>
+__device__ __forceinline__ S lange_abs(const rocblas_fill uplo,
+                                       const rocblas_int i,
+                                       const rocblas_int j,
+                                       const T* A,
+                                       const rocblas_int lda)
+{
+    if(uplo == rocblas_fill_full)
+        return std::abs(A[i + j * rocblas_stride(lda)]);
+    if(i == j)
+        return std::abs(std::real(A[i + j * rocblas_stride(lda)]));
+
+    bool stored = (uplo == rocblas_fill_upper ? i < j : i > j);
+    return std::abs(stored ? A[i + j * rocblas_stride(lda)] : A[j + i * rocblas_stride(lda)]);
+}
+
+/** LANGE_REDUCE combines the values val of all the threads in the block, taking the maximum if
+    MAX is true or the sum otherwise. The result is returned to all the threads. **/
+template <int MAX_THDS, bool MAX, typename S>
+__device__ S lange_reduce(const rocblas_int tid, const S val, S* sval)
+{
+    sval[tid] = val;
+    __syncthreads();
+
+    for(rocblas_int i = MAX_THDS / 2; i > 0; i /= 2)
+    {
+        if(tid < i)
+            sval[tid] = MAX ? lange_max(sval[tid], sval[tid + i]) : sval[tid] + sval[tid + i];
+        __syncthreads();
+    }
+
+    S res = sval[0];
+    __syncthreads();
+    return res;
+}
+
+/** LANGE_KERNEL computes the norm of the m-by-n matrices A given by norm. If uplo is not
+    rocblas_fill_full, A is hermitian (m = n) and only the corresponding triangular part is
+    referenced. The Frobenius norm is accumulated scaled by the largest absolute value of the
+    entries, to avoid overflow. Each thread-block processes one matrix of the batch. **/
+template <int MAX_THDS, typename T, typename S, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(MAX_THDS) lange_kernel(const rocsolver_norm_type norm,
+                                                               const rocblas_fill uplo,
+                                                               const rocblas_int m,
+                                                               const rocblas_int n,
+                                                               U A,
+                                                               const rocblas_stride shiftA,
+                                                               const rocblas_int lda,
+                                                               const rocblas_stride strideA,
+                                                               S* anorm)
+{
+    const rocblas_int b = hipBlockIdx_y;
+    const rocblas_int tid = hipThreadIdx_x;
+
+    T* Ap = load_ptr_batch<T>(A, b, shiftA, strideA);
+
+    __shared__ S sval[MAX_THDS];
+
+    S val = 0;
+    if(norm == rocsolver_norm_one)
+    {
+        // each thread computes the sums of the columns it is assigned
+        for(rocblas_int j = tid; j < n; j += MAX_THDS)
+        {
+            S sum = 0;
+            for(rocblas_int i = 0; i < m; i++)
+                sum += lange_abs<S>(uplo, i, j, Ap, lda);
+            val = lange_max(val, sum);
+        }
+    }
+    else if(norm == rocsolver_norm_inf)
+    {
+        // each thread computes the sums of the rows it is assigned
+        for(rocblas_int i = tid; i < m; i += MAX_THDS)
+        {
+            S sum = 0;
+            for(rocblas_int j = 0; j < n; j++)
+                sum += lange_abs<S>(uplo, i, j, Ap, lda);
+            val = lange_max(val, sum);
+        }
+    }
+    else
+    {
+        // each thread finds the largest entry of the rows it is assigned
+        for(rocblas_int i = tid; i < m; i += MAX_THDS)
+            for(rocblas_int j = 0; j < n; j++)
+                val = lange_max(val, lange_abs<S>(uplo, i, j, Ap, lda));
+    }
+    val = lange_reduce<MAX_THDS, true>(tid, val, sval);
+
+    if(norm == rocsolver_norm_frobenius && val > 0 && val != std::numeric_limits<S>::infinity())
+    {
+        // sum of squares of the entries scaled by the largest one
+        S ssq = 0;
+        for(rocblas_int i = tid; i < m; i += MAX_THDS)
+        {
+            for(rocblas_int j = 0; j < n; j++)
+            {
+                S t = lange_abs<S>(uplo, i, j, Ap, lda) / val;
+                ssq += t * t;
+            }
+        }
+        val *= std::sqrt(lange_reduce<MAX_THDS, false>(tid, ssq, sval));
+    }
+
+    if(tid == 0)
+        anorm[b] = val;
+}
+
+template <typename T, typename U>
+rocblas_status rocsolver_lange_argCheck(rocblas_handle handle,
+                                        const rocsolver_norm_type norm,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        const rocblas_int lda,
+                                        T A,
+                                        U anorm,
+                                        const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(norm != rocsolver_norm_max && norm != rocsolver_norm_one && norm != rocsolver_norm_inf
+       && norm != rocsolver_norm_frobenius)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(m < 0 || n < 0 || lda < m || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((m && n && !A) || (batch_count && !anorm))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T, typename U>
+rocblas_status rocsolver_lansy_lanhe_argCheck(rocblas_handle handle,
+                                              const rocsolver_norm_type norm,
+                                              const rocblas_fill uplo,
+                                              const rocblas_int n,
+                                              const rocblas_int lda,
+                                              T A,
+                                              U anorm,
+                                              const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(norm != rocsolver_norm_max && norm != rocsolver_norm_one && norm != rocsolver_norm_inf
+       && norm != rocsolver_norm_frobenius)
+        return rocblas_status_invalid_value;
+    if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(n < 0 || lda < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !A) || (batch_count && !anorm))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+/** The general (uplo = rocblas_fill_full) and the symmetric/hermitian cases share this
+    template. The norms of empty matrices are zero. **/
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_lange_lansy_template(rocblas_handle handle,
+                                              const rocsolver_norm_type norm,
+                                              const rocblas_fill uplo,
+                                              const rocblas_int m,
+                                              const rocblas_int n,
+                                              U A,
+                                              const rocblas_stride shiftA,
+                                              const rocblas_int lda,
+                                              const rocblas_stride strideA,
+                                              S* anorm,
+                                              const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER("lange_lansy", "norm:", norm, "uplo:", uplo, "m:", m, "n:", n,
+                    "shiftA:", shiftA, "lda:", lda, "bc:", batch_count);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    dim3 threads(BS1, 1, 1);
+
+    // quick return with zero norms if the matrices are empty
+    if(m == 0 || n == 0)
+    {
+        rocblas_int blocks = (batch_count - 1) / BS1 + 1;
+        ROCSOLVER_LAUNCH_KERNEL(reset_info, dim3(blocks, 1, 1), threads, 0, stream, anorm,
+                                batch_count, 0);
+        return rocblas_status_success;
+    }
+
+    ROCSOLVER_LAUNCH_KERNEL((lange_kernel<BS1, T>), dim3(1, batch_count, 1), threads, 0, stream,
+                            norm, uplo, m, n, A, shiftA, lda, strideA, anorm);
+
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
@@ -0,0 +1,128 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "rocauxiliary_lange_lansy.hpp"
+#include "rocsolver_check_mode.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+template <typename T, typename S>
+rocblas_status rocsolver_lansy_lanhe_impl(rocblas_handle handle,
+                                          const rocsolver_norm_type norm,
+                                          const rocblas_fill uplo,
+                                          const rocblas_int n,
+                                          T* A,
+                                          const rocblas_int lda,
+                                          S* anorm)
+{
+    const char* name = (!rocblas_is_complex<T> ? "lansy" : "lanhe");
+    ROCSOLVER_ENTER_TOP(name, "--norm", norm, "--uplo", uplo, "-n", n, "--lda", lda);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking (unless disabled with rocsolver_set_check_mode)
+    if(!skip_arg_checks(handle))
+    {
+        rocblas_status st = rocsolver_lansy_lanhe_argCheck(handle, norm, uplo, n, lda, A, anorm);
+        if(st != rocblas_status_continue)
+            return st;
+    }
+
+    // this function does not require memory work space
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_size_unchanged;
+
+    // working with unshifted arrays
+    rocblas_stride shiftA = 0;
+
+    // normal (non-batched non-strided) execution
+    rocblas_stride strideA = 0;
+    rocblas_int batch_count = 1;
+
+    // execution
+    return rocsolver_lange_lansy_template<T>(handle, norm, uplo, n, n, A, shiftA, lda, strideA,
+                                             anorm, batch_count);
+}
+
+ROCSOLVER_END_NAMESPACE
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_slansy(rocblas_handle handle,
+                                const rocsolver_norm_type norm,
+                                const rocblas_fill uplo,
+                                const rocblas_int n,
+                                float* A,
+                                const rocblas_int lda,
+                                float* anorm)
+{
+    return rocsolver::rocsolver_lansy_lanhe_impl<float>(handle, norm, uplo, n, A, lda, anorm);
+}
+
+rocblas_status rocsolver_dlansy(rocblas_handle handle,
+                                const rocsolver_norm_type norm,
+                                const rocblas_fill uplo,
+                                const rocblas_int n,
+                                double* A,
+                                const rocblas_int lda,
+                                double* anorm)
+{
+    return rocsolver::rocsolver_lansy_lanhe_impl<double>(handle, norm, uplo, n, A, lda, anorm);
+}
+
+rocblas_status rocsolver_clanhe(rocblas_handle handle,
+                                const rocsolver_norm_type norm,
+                                const rocblas_fill uplo,
+                                const rocblas_int n,
+                                rocblas_float_complex* A,
+                                const rocblas_int lda,
+                                float* anorm)
+{
+    return rocsolver::rocsolver_lansy_lanhe_impl<rocblas_float_complex>(
+        handle, norm, uplo, n, A, lda, anorm);
+}
+
+rocblas_status rocsolver_zlanhe(rocblas_handle handle,
+                                const rocsolver_norm_type norm,
+                                const rocblas_fill uplo,
+                                const rocblas_int n,
+                                rocblas_double_complex* A,
+                                const rocblas_int lda,
+                                double* anorm)
+{
+    return rocsolver::rocsolver_lansy_lanhe_impl<rocblas_double_complex>(
+        handle, norm, uplo, n, A, lda, anorm);
+}
+
+} // extern C
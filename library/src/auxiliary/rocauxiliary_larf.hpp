@@ -37,6 +37,52 @@
 
 ROCSOLVER_BEGIN_NAMESPACE
 
+/** LARF_CONJ_COPY copies the conjugate of the vector x (of size n) to the contiguous array
+    xc **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void larf_conj_copy(const rocblas_int n,
+                                     U xx,
+                                     const rocblas_int shiftx,
+                                     const rocblas_int incx,
+                                     const rocblas_stride stridex,
+                                     T* xc)
+{
+    const auto b = hipBlockIdx_y;
+    const auto i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(i < n)
+    {
+        T* x = load_ptr_batch<T>(xx, b, shiftx, stridex);
+        xc[i + b * n] = conj(x[i * incx]);
+    }
+}
+
+/** LARF_CONJ_VECTOR returns the conjugated copies xc of the vectors in the same form as x
+    (i.e. as an array of pointers, stored in workArr, in the batched case) **/
+template <typename T>
+T* larf_conj_vector(T* x,
+                    T* xc,
+                    const rocblas_int n,
+                    T** workArr,
+                    const rocblas_int batch_count,
+                    hipStream_t stream)
+{
+    return xc;
+}
+template <typename T>
+T* const* larf_conj_vector(T* const* x,
+                           T* xc,
+                           const rocblas_int n,
+                           T** workArr,
+                           const rocblas_int batch_count,
+                           hipStream_t stream)
+{
+    rocblas_int blocks = (batch_count - 1) / 256 + 1;
+    ROCSOLVER_LAUNCH_KERNEL(get_array, dim3(blocks), dim3(256), 0, stream, workArr, xc,
+                            rocblas_stride(n), batch_count);
+    return workArr;
+}
+
 template <bool BATCHED, typename T>
 void rocsolver_larf_getMemorySize(const rocblas_side side,
                                   const rocblas_int m,
@@ -44,8 +90,12 @@ void rocsolver_larf_getMemorySize(const rocblas_side side,
                                   const rocblas_int batch_count,
                                   size_t* size_scalars,
                                   size_t* size_Abyx,
-                                  size_t* size_workArr)
+                                  size_t* size_workArr,
+                                  const bool conjx = false)
 {
+    // (a conjugated copy of x, and the array of pointers to it, is needed if conjx)
+    const bool cx = (rocblas_is_complex<T> && conjx);
+
     // if quick return no workspace needed
     if(n == 0 || m == 0 || !batch_count)
     {
@@ -59,7 +109,9 @@ void rocsolver_larf_getMemorySize(const rocblas_side side,
     *size_scalars = sizeof(T) * 3;
 
     // size of temporary result in Householder matrix generation
-    if(side == rocblas_side_left)
+    if(cx)
+        *size_Abyx = m + n;
+    else if(side == rocblas_side_left)
         *size_Abyx = n;
     else if(side == rocblas_side_right)
         *size_Abyx = m;
@@ -69,7 +121,7 @@ void rocsolver_larf_getMemorySize(const rocblas_side side,
 
     // size of array of pointers to workspace
     if(BATCHED)
-        *size_workArr = sizeof(T*) * batch_count;
+        *size_workArr = sizeof(T*) * batch_count * (cx ? 2 : 1);
     else
         *size_workArr = 0;
 }
@@ -125,7 +177,8 @@ rocblas_status rocsolver_larf_template(rocblas_handle handle,
                                        const rocblas_int batch_count,
                                        T* scalars,
                                        T* Abyx,
-                                       T** workArr)
+                                       T** workArr,
+                                       const bool conjx = false)
 {
     ROCSOLVER_ENTER("larf", "side:", side, "m:", m, "n:", n, "shiftX:", shiftx, "incx:", incx,
                     "shiftA:", shiftA, "lda:", lda, "bc:", batch_count);
@@ -152,6 +205,26 @@ rocblas_status rocsolver_larf_template(rocblas_handle handle,
         order = n;
     }
 
+    // if conjx, x holds the conjugate of the Householder vector (as the rows of the matrices in
+    // the LQ- and RQ-family routines). Instead of conjugating x in place before and after the
+    // update, the BLAS calls read a conjugated copy of it in the workspace
+    U xv = x;
+    rocblas_int shiftxv = shiftx;
+    rocblas_int incxv = incx;
+    rocblas_stride stridexv = stridex;
+    if(COMPLEX && conjx)
+    {
+        rocblas_int lx = leftside ? m : n;
+        T* xc = Abyx + size_t(order) * batch_count;
+        ROCSOLVER_LAUNCH_KERNEL(larf_conj_copy<T>, dim3((lx - 1) / BS1 + 1, batch_count), dim3(BS1),
+                                0, stream, lx, x, shiftx, incx, stridex, xc);
+
+        xv = larf_conj_vector<T>(x, xc, lx, workArr + batch_count, batch_count, stream);
+        shiftxv = 0;
+        incxv = 1;
+        stridexv = lx;
+    }
+
     // **** FOR NOW, IT DOES NOT DETERMINE "NON-ZERO" DIMENSIONS
     //      OF A AND X, AS THIS WOULD REQUIRE SYNCHRONIZATION WITH GPU.
     //      IT WILL WORK ON THE ENTIRE MATRIX/VECTOR REGARDLESS OF
@@ -159,19 +232,20 @@ rocblas_status rocsolver_larf_template(rocblas_handle handle,
 
     // compute the matrix vector product  (W=-A'*X or W=-A*X)
     rocblasCall_gemv<T>(handle, trans, m, n, cast2constType<T>(scalars), 0, A, shiftA, lda, stridea,
-                        x, shiftx, incx, stridex, cast2constType<T>(scalars + 1), 0, Abyx, 0, 1,
-                        order, batch_count, workArr);
+                        xv, shiftxv, incxv, stridexv, cast2constType<T>(scalars + 1), 0, Abyx, 0,
+                        1, order, batch_count, workArr);
 
     // compute the rank-1 update  (A + tau*X*W'  or A + tau*W*X')
     if(leftside)
     {
-        rocblasCall_ger<COMPLEX, T>(handle, m, n, alpha, stridep, x, shiftx, incx, stridex, Abyx, 0,
-                                    1, order, A, shiftA, lda, stridea, batch_count, workArr);
+        rocblasCall_ger<COMPLEX, T>(handle, m, n, alpha, stridep, xv, shiftxv, incxv, stridexv,
+                                    Abyx, 0, 1, order, A, shiftA, lda, stridea, batch_count,
+                                    workArr);
     }
     else
     {
-        rocblasCall_ger<COMPLEX, T>(handle, m, n, alpha, stridep, Abyx, 0, 1, order, x, shiftx,
-                                    incx, stridex, A, shiftA, lda, stridea, batch_count, workArr);
+        rocblasCall_ger<COMPLEX, T>(handle, m, n, alpha, stridep, Abyx, 0, 1, order, xv, shiftxv,
+                                    incxv, stridexv, A, shiftA, lda, stridea, batch_count, workArr);
     }
 
     rocblas_set_pointer_mode(handle, old_mode);
@@ -4,7 +4,7 @@
  *     Univ. of Tennessee, Univ. of California Berkeley,
  *     Univ. of Colorado Denver and NAG Ltd..
  *     June 2013
- * Copyright (C) 2019-2024 Advanced Micro Devices, Inc. All rights reserved.
+ * Copyright (C) 2019-2025 Advanced Micro Devices, Inc. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions
@@ -34,6 +34,7 @@
 
 #include "rocblas.hpp"
 #include "rocsolver/rocsolver.h"
+#include "rocsolver_run_specialized_kernels.hpp"
 
 ROCSOLVER_BEGIN_NAMESPACE
 
@@ -89,6 +90,200 @@ ROCSOLVER_KERNEL void addmatA1(const rocblas_int ldw,
     }
 }
 
+/** LARFB_GEMM computes the GEMMs of LARFB with rocBLAS, with the small-GEMM kernel for
+    the batches of small matrices (see rocsolver_use_gemm_small), or with the 3M method for the
+    large complex matrices if it is selected with rocsolver_set_gemm_mode **/
+template <typename T, typename U1, typename U2, typename U3>
+rocblas_status larfb_gemm(rocblas_handle handle,
+                          rocblas_operation transA,
+                          rocblas_operation transB,
+                          rocblas_int m,
+                          rocblas_int n,
+                          rocblas_int k,
+                          const T* alpha,
+                          U1 A,
+                          rocblas_stride shiftA,
+                          rocblas_int lda,
+                          rocblas_stride strideA,
+                          U2 B,
+                          rocblas_stride shiftB,
+                          rocblas_int ldb,
+                          rocblas_stride strideB,
+                          const T* beta,
+                          U3 C,
+                          rocblas_stride shiftC,
+                          rocblas_int ldc,
+                          rocblas_stride strideC,
+                          rocblas_int batch_count,
+                          T** work)
+{
+    if(rocsolver_use_gemm_small(m, n, k, batch_count))
+        return rocsolver_gemm_small<T>(handle, transA, transB, m, n, k, alpha, A, shiftA, lda,
+                                       strideA, B, shiftB, ldb, strideB, beta, C, shiftC, ldc,
+                                       strideC, batch_count);
+
+    if constexpr(rocblas_is_complex<T>)
+    {
+        if(rocsolver_use_gemm_3m<T>(handle, m, n, k, lda, ldb, ldc, batch_count)
+           && rocsolver_gemm_3m<T>(handle, transA, transB, m, n, k, alpha, A, shiftA, lda, strideA,
+                                   B, shiftB, ldb, strideB, beta, C, shiftC, ldc, strideC,
+                                   batch_count))
+            return rocblas_status_success;
+    }
+
+    return rocblasCall_gemm(handle, transA, transB, m, n, k, alpha, A, shiftA, lda, strideA, B,
+                            shiftB, ldb, strideB, beta, C, shiftC, ldc, strideC, batch_count, work);
+}
+
+/** Tile geometry of the fused LARFB kernel: each group of BS1 threads updates
+    LARFB_FUSED_COLS columns of A, traversing them in tiles of LARFB_FUSED_ROWS rows **/
+#define LARFB_FUSED_ROWS 64
+#define LARFB_FUSED_COLS (BS1 / LARFB_FUSED_ROWS)
+
+/** LARFB_FUSED_KERNEL applies the block reflector H = I - V * T * V' (or H') from the left to a
+    block of LARFB_FUSED_COLS columns of A, with V stored column-wise in the forward direction and
+    k <= LARFB_FUSED_ROWS. A first pass over the rows computes W = V' * A, one entry per thread
+    from tiles of V and A staged in LDS; then T is loaded into the buffer of V to get
+    W = trans(T) * W, and a second pass updates A = A - V * W. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) larfb_fused_kernel(const rocblas_operation trans,
+                                                                const rocblas_int m,
+                                                                const rocblas_int n,
+                                                                const rocblas_int k,
+                                                                U VV,
+                                                                const rocblas_int shiftV,
+                                                                const rocblas_int ldv,
+                                                                const rocblas_stride strideV,
+                                                                T* FF,
+                                                                const rocblas_int shiftF,
+                                                                const rocblas_int ldf,
+                                                                const rocblas_stride strideF,
+                                                                U AA,
+                                                                const rocblas_int shiftA,
+                                                                const rocblas_int lda,
+                                                                const rocblas_stride strideA)
+{
+    const rocblas_int bid = hipBlockIdx_z;
+    const rocblas_int tid = hipThreadIdx_x;
+    const rocblas_int j0 = hipBlockIdx_x * LARFB_FUSED_COLS;
+    const rocblas_int nc = std::min(n - j0, LARFB_FUSED_COLS);
+
+    // select batch instance
+    T* V = load_ptr_batch<T>(VV, bid, shiftV, strideV);
+    T* F = load_ptr_batch<T>(FF, bid, shiftF, strideF);
+    T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA) + j0 * lda;
+
+    // shared memory: a tile of V (padded to avoid bank conflicts) or T, and a tile of A or W
+    constexpr rocblas_int ldt = LARFB_FUSED_ROWS + 1;
+    extern __shared__ double lmem[];
+    T* sV = reinterpret_cast<T*>(lmem);
+    T* sW = sV + ldt * k;
+
+    // each thread computes the entry (l, j) of W
+    const rocblas_int l = tid % k;
+    const rocblas_int j = tid / k;
+    const bool active = (j < nc);
+    T acc = 0;
+
+    // W = V' * A
+    for(rocblas_int r0 = 0; r0 < m; r0 += LARFB_FUSED_ROWS)
+    {
+        for(rocblas_int p = tid; p < LARFB_FUSED_ROWS * k; p += BS1)
+        {
+            rocblas_int ii = p % LARFB_FUSED_ROWS;
+            rocblas_int ll = p / LARFB_FUSED_ROWS;
+            rocblas_int i = r0 + ii;
+            // the unit diagonal of V and the zeros above it are not stored
+            sV[ii + ll * ldt] = (i >= m || i < ll) ? T(0) : (i == ll ? T(1) : V[i + ll * ldv]);
+        }
+        {
+            rocblas_int ii = tid % LARFB_FUSED_ROWS;
+            rocblas_int jj = tid / LARFB_FUSED_ROWS;
+            rocblas_int i = r0 + ii;
+            sW[tid] = (i < m && jj < nc) ? A[i + jj * lda] : T(0);
+        }
+        __syncthreads();
+
+        if(active)
+        {
+            for(rocblas_int ii = 0; ii < LARFB_FUSED_ROWS; ++ii)
+                acc += conj(sV[ii + l * ldt]) * sW[ii + j * LARFB_FUSED_ROWS];
+        }
+        __syncthreads();
+    }
+
+    // W = trans(T) * W (only the upper triangular part of T is referenced)
+    for(rocblas_int p = tid; p < k * k; p += BS1)
+    {
+        rocblas_int ii = p % k;
+        rocblas_int jj = p / k;
+        sV[p] = (ii <= jj) ? F[ii + jj * ldf] : T(0);
+    }
+    if(active)
+        sW[l + j * k] = acc;
+    __syncthreads();
+
+    if(active)
+    {
+        acc = 0;
+        if(trans == rocblas_operation_none)
+        {
+            for(rocblas_int p = l; p < k; ++p)
+                acc += sV[l + p * k] * sW[p + j * k];
+        }
+        else
+        {
+            for(rocblas_int p = 0; p <= l; ++p)
+                acc += conj(sV[p + l * k]) * sW[p + j * k];
+        }
+    }
+    __syncthreads();
+    if(active)
+        sW[l + j * k] = acc;
+
+    // A = A - V * W
+    for(rocblas_int r0 = 0; r0 < m; r0 += LARFB_FUSED_ROWS)
+    {
+        __syncthreads();
+        for(rocblas_int p = tid; p < LARFB_FUSED_ROWS * k; p += BS1)
+        {
+            rocblas_int ii = p % LARFB_FUSED_ROWS;
+            rocblas_int ll = p / LARFB_FUSED_ROWS;
+            rocblas_int i = r0 + ii;
+            sV[ii + ll * ldt] = (i >= m || i < ll) ? T(0) : (i == ll ? T(1) : V[i + ll * ldv]);
+        }
+        __syncthreads();
+
+        rocblas_int ii = tid % LARFB_FUSED_ROWS;
+        rocblas_int jj = tid / LARFB_FUSED_ROWS;
+        rocblas_int i = r0 + ii;
+        if(i < m && jj < nc)
+        {
+            T s = 0;
+            for(rocblas_int ll = 0; ll < k; ++ll)
+                s += sV[ii + ll * ldt] * sW[ll + jj * k];
+            A[i + jj * lda] -= s;
+        }
+    }
+}
+
+/** LARFB_USE_FUSED returns true if the block reflector can be applied with larfb_fused_kernel,
+    and sets the required size of LDS **/
+template <typename T>
+bool larfb_use_fused(const rocblas_side side,
+                     const rocblas_direct direct,
+                     const rocblas_storev storev,
+                     const rocblas_int n,
+                     const rocblas_int k,
+                     size_t* lmemsize)
+{
+    *lmemsize = sizeof(T) * ((LARFB_FUSED_ROWS + 1) * k + LARFB_FUSED_ROWS * LARFB_FUSED_COLS);
+
+    return side == rocblas_side_left && direct == rocblas_forward_direction
+        && storev == rocblas_column_wise && k <= LARFB_FUSED_MAX_K && n <= LARFB_FUSED_MAX_N
+        && *lmemsize <= 64 * 1024;
+}
+
 template <bool BATCHED, typename T>
 void rocsolver_larfb_getMemorySize(const rocblas_side side,
                                    const rocblas_int m,
@@ -171,6 +366,9 @@ rocblas_status rocsolver_larfb_argCheck(rocblas_handle handle,
     return rocblas_status_continue;
 }
 
+/** If zeroA1 is true, the block A1 of A facing the triangular part V1 of V is known to be zero
+    on entry (as in the generation of Q by ORGQR/UNGQR), so that the products with A1 are
+    skipped. **/
 template <bool BATCHED, bool STRIDED, typename T, typename U>
 rocblas_status rocsolver_larfb_template(rocblas_handle handle,
                                         const rocblas_side side,
@@ -194,7 +392,8 @@ rocblas_status rocsolver_larfb_template(rocblas_handle handle,
                                         const rocblas_stride strideA,
                                         const rocblas_int batch_count,
                                         T* tmptr,
-                                        T** workArr)
+                                        T** workArr,
+                                        const bool zeroA1 = false)
 {
     ROCSOLVER_ENTER("larfb", "side:", side, "trans:", trans, "direct:", direct, "storev:", storev,
                     "m:", m, "n:", n, "k:", k, "shiftV:", shiftV, "ldv:", ldv, "shiftF:", shiftF,
@@ -208,6 +407,20 @@ rocblas_status rocsolver_larfb_template(rocblas_handle handle,
     rocblas_get_stream(handle, &stream);
     T *Vp, *Fp;
 
+    // few reflectors applied from the left: use the fused kernel
+    size_t lmemsize;
+    if(larfb_use_fused<T>(side, direct, storev, n, k, &lmemsize))
+    {
+        rocblas_operation transt = (trans == rocblas_operation_transpose)
+            ? rocblas_operation_conjugate_transpose
+            : trans;
+        rocblas_int blocks = (n - 1) / LARFB_FUSED_COLS + 1;
+        ROCSOLVER_LAUNCH_KERNEL((larfb_fused_kernel<T>), dim3(blocks, 1, batch_count), dim3(BS1),
+                                lmemsize, stream, transt, m, n, k, V, shiftV, ldv, strideV, F,
+                                shiftF, ldf, strideF, A, shiftA, lda, strideA);
+        return rocblas_status_success;
+    }
+
     // everything must be executed with scalars on the host
     rocblas_pointer_mode old_mode;
     rocblas_get_pointer_mode(handle, &old_mode);
@@ -311,29 +524,41 @@ rocblas_status rocsolver_larfb_template(rocblas_handle handle,
     rocblas_stride strideW = rocblas_stride(ldw) * order;
     uploT = (forward ? rocblas_fill_upper : rocblas_fill_lower);
 
-    // copy A1 to tmptr
+    // with A1 = 0 and no A2, A is left unchanged
+    if(zeroA1 && !trap)
+    {
+        rocblas_set_pointer_mode(handle, old_mode);
+        return rocblas_status_success;
+    }
+
     rocblas_int blocksx = (order - 1) / 32 + 1;
     rocblas_int blocksy = (ldw - 1) / 32 + 1;
-    ROCSOLVER_LAUNCH_KERNEL(copymatA1, dim3(blocksx, blocksy, batch_count), dim3(32, 32), 0, stream,
-                            ldw, order, A, offsetA1, lda, strideA, tmptr);
-
-    // compute: V1' * A1
-    //   or    A1 * V1
-    rocblasCall_trmm(handle, side, uploV, transp, rocblas_diagonal_unit, ldw, order, &one, 0, V,
-                     offsetV1, ldv, strideV, tmptr, 0, ldw, strideW, batch_count, workArr);
+    T beta = zeroA1 ? 0 : 1;
+    if(!zeroA1)
+    {
+        // copy A1 to tmptr
+        ROCSOLVER_LAUNCH_KERNEL(copymatA1, dim3(blocksx, blocksy, batch_count), dim3(32, 32), 0,
+                                stream, ldw, order, A, offsetA1, lda, strideA, tmptr);
+
+        // compute: V1' * A1
+        //   or    A1 * V1
+        rocblasCall_trmm(handle, side, uploV, transp, rocblas_diagonal_unit, ldw, order, &one, 0, V,
+                         offsetV1, ldv, strideV, tmptr, 0, ldw, strideW, batch_count, workArr);
+    }
 
     // compute: V1' * A1 + V2' * A2
     //    or    A1 * V1 + A2 * V2
+    // (when A1 = 0, the result is written directly to tmptr)
     if(trap)
     {
         if(leftside)
-            rocblasCall_gemm(handle, transp, rocblas_operation_none, ldw, order, m - k, &one, V,
-                             offsetV2, ldv, strideV, A, offsetA2, lda, strideA, &one, tmptr, 0, ldw,
-                             strideW, batch_count, workArr);
+            larfb_gemm<T>(handle, transp, rocblas_operation_none, ldw, order, m - k, &one, V,
+                          offsetV2, ldv, strideV, A, offsetA2, lda, strideA, &beta, tmptr, 0, ldw,
+                          strideW, batch_count, workArr);
         else
-            rocblasCall_gemm(handle, rocblas_operation_none, transp, ldw, order, n - k, &one, A,
-                             offsetA2, lda, strideA, V, offsetV2, ldv, strideV, &one, tmptr, 0, ldw,
-                             strideW, batch_count, workArr);
+            larfb_gemm<T>(handle, rocblas_operation_none, transp, ldw, order, n - k, &one, A,
+                          offsetA2, lda, strideA, V, offsetV2, ldv, strideV, &beta, tmptr, 0, ldw,
+                          strideW, batch_count, workArr);
     }
 
     // compute: trans(T) * (V1' * A1 + V2' * A2)
@@ -351,13 +576,13 @@ rocblas_status rocsolver_larfb_template(rocblas_handle handle,
     if(trap)
     {
         if(leftside)
-            rocblasCall_gemm(handle, transp, rocblas_operation_none, m - k, order, ldw, &minone, V,
-                             offsetV2, ldv, strideV, tmptr, 0, ldw, strideW, &one, A, offsetA2, lda,
-                             strideA, batch_count, workArr);
+            larfb_gemm<T>(handle, transp, rocblas_operation_none, m - k, order, ldw, &minone, V,
+                          offsetV2, ldv, strideV, tmptr, 0, ldw, strideW, &one, A, offsetA2, lda,
+                          strideA, batch_count, workArr);
         else
-            rocblasCall_gemm(handle, rocblas_operation_none, transp, ldw, n - k, order, &minone,
-                             tmptr, 0, ldw, strideW, V, offsetV2, ldv, strideV, &one, A, offsetA2,
-                             lda, strideA, batch_count, workArr);
+            larfb_gemm<T>(handle, rocblas_operation_none, transp, ldw, n - k, order, &minone,
+                          tmptr, 0, ldw, strideW, V, offsetV2, ldv, strideV, &one, A, offsetA2,
+                          lda, strideA, batch_count, workArr);
     }
 
     // compute: V1 * trans(T) * (V1' * A1 + V2' * A2)
@@ -43,7 +43,8 @@ ROCSOLVER_KERNEL void set_taubeta(T* tau,
                                   T* norms,
                                   U alpha,
                                   const rocblas_int shifta,
-                                  const rocblas_stride stride)
+                                  const rocblas_stride stride,
+                                  const bool conjx)
 {
     int b = hipBlockIdx_x;
 
@@ -77,7 +78,8 @@ ROCSOLVER_KERNEL void set_taubeta(T* tau,
                                   T* norms,
                                   U alpha,
                                   const rocblas_int shifta,
-                                  const rocblas_stride stride)
+                                  const rocblas_stride stride,
+                                  const bool conjx)
 {
     using S = decltype(std::real(T{}));
     int b = hipBlockIdx_x;
@@ -86,8 +88,9 @@ ROCSOLVER_KERNEL void set_taubeta(T* tau,
     T* a = load_ptr_batch<T>(alpha, b, shifta, stride);
     T* t = tau + b * strideP;
 
+    // if conjx, alpha and x hold the conjugates of the values that define the reflector
     ar = a[0].real();
-    ai = a[0].imag();
+    ai = conjx ? -a[0].imag() : a[0].imag();
     S m = ai * ai;
 
     if(norms[b].real() > 0 || m > 0)
@@ -101,7 +104,7 @@ ROCSOLVER_KERNEL void set_taubeta(T* tau,
         r = (ar - n) * (ar - n) + ai * ai;
         rr = (ar - n) / r;
         ri = -ai / r;
-        norms[b] = rocblas_complex_num<S>(rr, ri);
+        norms[b] = rocblas_complex_num<S>(rr, conjx ? -ri : ri);
 
         // tau:
         //t[0] = (n - a[0]) / n;
@@ -184,7 +187,8 @@ rocblas_status rocsolver_larfg_template(rocblas_handle handle,
                                         const rocblas_stride strideP,
                                         const rocblas_int batch_count,
                                         T* work,
-                                        T* norms)
+                                        T* norms,
+                                        const bool conjx = false)
 {
     // TODO: How to get alpha for trace logging
     ROCSOLVER_ENTER("larfg", "n:", n, "shiftA:", shifta, "shiftX:", shiftx, "incx:", incx,
@@ -219,9 +223,11 @@ rocblas_status rocsolver_larfg_template(rocblas_handle handle,
     // set value of tau and beta and scalling factor for vector x
     // alpha <- beta, norms <- scaling
     ROCSOLVER_LAUNCH_KERNEL(set_taubeta<T>, dim3(batch_count), dim3(1), 0, stream, tau, strideP,
-                            norms, alpha, shifta, stridex);
+                            norms, alpha, shifta, stridex, conjx);
 
     // compute vector v=x*norms
+    // (if conjx, the scaling factor is conjugated in set_taubeta, so that x is overwritten with
+    // the conjugate of v)
     rocblasCall_scal<T>(handle, n - 1, norms, 1, x, shiftx, incx, stridex, batch_count);
 
     rocblas_set_pointer_mode(handle, old_mode);
@@ -62,7 +62,7 @@ rocblas_status rocsolver_larft_impl(rocblas_handle handle,
     rocblas_int batch_count = 1;
 
     // memory workspace sizes:
-    // size for constants in rocblas calls
+    // constants in rocblas calls (only whether they are needed, see set_device_scalars)
     size_t size_scalars;
     // size of re-usable workspace
     size_t size_work;
@@ -72,11 +72,11 @@ rocblas_status rocsolver_larft_impl(rocblas_handle handle,
                                             &size_workArr);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work, size_workArr);
+        return rocblas_set_optimal_device_memory_size(handle, size_t(0), size_work, size_workArr);
 
     // memory workspace allocation
     void *scalars, *work, *workArr;
-    rocblas_device_malloc mem(handle, size_scalars, size_work, size_workArr);
+    rocblas_device_malloc mem(handle, size_t(0), size_work, size_workArr);
     if(!mem)
         return rocblas_status_memory_error;
 
@@ -84,7 +84,7 @@ rocblas_status rocsolver_larft_impl(rocblas_handle handle,
     work = mem[1];
     workArr = mem[2];
     if(size_scalars > 0)
-        init_scalars(handle, (T*)scalars);
+        ROCBLAS_CHECK(set_device_scalars<T>(scalars));
 
     // execution
     return rocsolver_larft_template<T>(handle, direct, storev, n, k, V, shiftV, ldv, stridev, tau,
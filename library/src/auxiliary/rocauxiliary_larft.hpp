@@ -161,6 +161,222 @@ ROCSOLVER_KERNEL void set_tau(const rocblas_int k, T* tau, const rocblas_stride
     }
 }
 
+/** LARFT_SMALL_KERNEL computes the triangular factor T of a block reflector of k <= BS2
+    Householder vectors with one thread-block per matrix. The Gram matrix G = V' * V is accumulated
+    over tiles of BS2 elements of the vectors staged in LDS, one entry per thread, and T is then
+    formed in LDS with the recurrence T(0:i-1, i) = -tau(i) * T(0:i-1, 0:i-1) * G(0:i-1, i) (or
+    T(i+1:k-1, i) = -tau(i) * T(i+1:k-1, i+1:k-1) * G(i+1:k-1, i) in the backward direction).
+    Only the first nrows elements of the vectors are read; if nrows < n (forward direction only),
+    F must contain, on entry, the contribution of the other elements to G. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS2 * BS2) larft_small_kernel(const rocblas_direct direct,
+                                                                     const rocblas_storev storev,
+                                                                     const rocblas_int n,
+                                                                     const rocblas_int k,
+                                                                     const rocblas_int nrows,
+                                                                     U VV,
+                                                                     const rocblas_int shiftV,
+                                                                     const rocblas_int ldv,
+                                                                     const rocblas_stride strideV,
+                                                                     T* tauA,
+                                                                     const rocblas_stride strideT,
+                                                                     T* FF,
+                                                                     const rocblas_int ldf,
+                                                                     const rocblas_stride strideF)
+{
+    const rocblas_int bid = hipBlockIdx_z;
+    const rocblas_int tx = hipThreadIdx_x;
+    const rocblas_int ty = hipThreadIdx_y;
+    const bool forward = (direct == rocblas_forward_direction);
+    const bool column = (storev == rocblas_column_wise);
+
+    // select batch instance
+    T* V = load_ptr_batch<T>(VV, bid, shiftV, strideV);
+    T* tau = tauA + bid * strideT;
+    T* F = FF + bid * strideF;
+
+    // shared memory: a tile of the vectors (padded to avoid bank conflicts), G and T
+    constexpr rocblas_int ldt = BS2 + 1;
+    __shared__ T sV[ldt * BS2];
+    __shared__ T sG[BS2 * BS2];
+    __shared__ T sT[BS2 * BS2];
+
+    // thread (tx, ty) computes the entry G(tx, ty) of the strictly upper (forward) or strictly
+    // lower (backward) triangular part
+    const bool active = (tx < k && ty < k && (forward ? tx < ty : tx > ty));
+    T acc = (active && nrows < n) ? F[tx + ty * ldf] : T(0);
+
+    // the i-th vector has a unit element at position p = i (or n - k + i in the backward
+    // direction) and zeros before (after) it, which are not stored
+    const rocblas_int p = forward ? ty : n - k + ty;
+    for(rocblas_int r0 = 0; r0 < nrows; r0 += BS2)
+    {
+        rocblas_int r = r0 + tx;
+        T v = 0;
+        if(r < nrows && ty < k)
+        {
+            if(r == p)
+                v = 1;
+            else if(forward ? r > p : r < p)
+                v = column ? V[r + ty * ldv] : conj(V[ty + r * ldv]);
+        }
+        sV[tx + ty * ldt] = v;
+        __syncthreads();
+
+        if(active)
+        {
+            for(rocblas_int rr = 0; rr < BS2; ++rr)
+                acc += conj(sV[rr + tx * ldt]) * sV[rr + ty * ldt];
+        }
+        __syncthreads();
+    }
+
+    sG[tx + ty * BS2] = acc;
+    sT[tx + ty * BS2] = (tx == ty && tx < k) ? tau[tx] : T(0);
+    __syncthreads();
+
+    // the columns of T are computed one at a time
+    if(forward)
+    {
+        for(rocblas_int i = 1; i < k; ++i)
+        {
+            if(ty == 0 && tx < i)
+            {
+                T s = 0;
+                for(rocblas_int l = tx; l < i; ++l)
+                    s += sT[tx + l * BS2] * sG[l + i * BS2];
+                sT[tx + i * BS2] = -tau[i] * s;
+            }
+            __syncthreads();
+        }
+    }
+    else
+    {
+        for(rocblas_int i = k - 2; i >= 0; --i)
+        {
+            if(ty == 0 && tx > i && tx < k)
+            {
+                T s = 0;
+                for(rocblas_int l = i + 1; l <= tx; ++l)
+                    s += sT[tx + l * BS2] * sG[l + i * BS2];
+                sT[tx + i * BS2] = -tau[i] * s;
+            }
+            __syncthreads();
+        }
+    }
+
+    // the not used triangular part of T is set to zero
+    if(tx < k && ty < k)
+        F[tx + ty * ldf] = sT[tx + ty * BS2];
+}
+
+/** LARFT_OFFDIAG_KERNEL sets the k1-by-k2 block T12 of the triangular factor to V21', where V21
+    is the k2-by-k1 block of V below the first k1 rows, and the block T21 to zero **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void larft_offdiag_kernel(const rocblas_int k1,
+                                           const rocblas_int k2,
+                                           U VV,
+                                           const rocblas_int shiftV,
+                                           const rocblas_int ldv,
+                                           const rocblas_stride strideV,
+                                           T* FF,
+                                           const rocblas_int ldf,
+                                           const rocblas_stride strideF)
+{
+    const auto b = hipBlockIdx_z;
+    const auto i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const auto j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+
+    if(i < k1 && j < k2)
+    {
+        T* V = load_ptr_batch<T>(VV, b, shiftV, strideV);
+        T* F = FF + b * strideF;
+
+        F[i + (k1 + j) * ldf] = conj(V[(k1 + j) + i * ldv]);
+        F[(k1 + j) + i * ldf] = 0;
+    }
+}
+
+/** LARFT_RECURSIVE computes the triangular factor of a block reflector stored column-wise in the
+    forward direction. The k vectors are split in two halves, their triangular factors T11 and T22
+    are computed recursively, and T12 = -T11 * (V1' * V2) * T22 is formed with TRMMs and a GEMM.
+    Blocks with less than LARFT_RECURSIVE_MIN_K vectors are computed with larft_small_kernel; if
+    n > LARFT_SMALL_MAX_N, the Gram matrix of the rows below the unit triangular part of V is
+    computed first with a GEMM. **/
+template <typename T, typename U>
+void rocsolver_larft_recursive(rocblas_handle handle,
+                               const rocblas_int n,
+                               const rocblas_int k,
+                               U V,
+                               const rocblas_int shiftV,
+                               const rocblas_int ldv,
+                               const rocblas_stride strideV,
+                               T* tau,
+                               const rocblas_stride strideT,
+                               T* F,
+                               const rocblas_int ldf,
+                               const rocblas_stride strideF,
+                               const rocblas_int batch_count,
+                               T* scalars,
+                               T** workArr)
+{
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    if(k < LARFT_RECURSIVE_MIN_K)
+    {
+        rocblas_int nrows = n;
+        if(n > LARFT_SMALL_MAX_N)
+        {
+            nrows = k;
+            rocblasCall_gemm<T>(handle, rocblas_operation_conjugate_transpose,
+                                rocblas_operation_none, k, k, n - k, scalars + 2, V,
+                                shiftV + idx2D(k, 0, ldv), ldv, strideV, V,
+                                shiftV + idx2D(k, 0, ldv), ldv, strideV, scalars + 1, F, 0, ldf,
+                                strideF, batch_count, workArr);
+        }
+
+        ROCSOLVER_LAUNCH_KERNEL((larft_small_kernel<T>), dim3(1, 1, batch_count), dim3(BS2, BS2),
+                                0, stream, rocblas_forward_direction, rocblas_column_wise, n, k,
+                                nrows, V, shiftV, ldv, strideV, tau, strideT, F, ldf, strideF);
+        return;
+    }
+
+    rocblas_int k1 = k / 2;
+    rocblas_int k2 = k - k1;
+
+    // T11 and T22
+    rocsolver_larft_recursive<T>(handle, n, k1, V, shiftV, ldv, strideV, tau, strideT, F, ldf,
+                                 strideF, batch_count, scalars, workArr);
+    rocsolver_larft_recursive<T>(handle, n - k1, k2, V, shiftV + idx2D(k1, k1, ldv), ldv, strideV,
+                                 tau + k1, strideT, F + idx2D(k1, k1, ldf), ldf, strideF,
+                                 batch_count, scalars, workArr);
+
+    // T12 = V21' * V22 + V31' * V32, where V22 is unit lower triangular
+    rocblas_int blocksx = (k1 - 1) / BS2 + 1;
+    rocblas_int blocksy = (k2 - 1) / BS2 + 1;
+    ROCSOLVER_LAUNCH_KERNEL((larft_offdiag_kernel<T>), dim3(blocksx, blocksy, batch_count),
+                            dim3(BS2, BS2), 0, stream, k1, k2, V, shiftV, ldv, strideV, F, ldf,
+                            strideF);
+    rocblasCall_trmm<T>(handle, rocblas_side_right, rocblas_fill_lower, rocblas_operation_none,
+                        rocblas_diagonal_unit, k1, k2, scalars + 2, 0, V,
+                        shiftV + idx2D(k1, k1, ldv), ldv, strideV, F, idx2D(0, k1, ldf), ldf,
+                        strideF, batch_count, workArr);
+    if(n > k)
+        rocblasCall_gemm<T>(handle, rocblas_operation_conjugate_transpose, rocblas_operation_none,
+                            k1, k2, n - k, scalars + 2, V, shiftV + idx2D(k, 0, ldv), ldv, strideV,
+                            V, shiftV + idx2D(k, k1, ldv), ldv, strideV, scalars + 2, F,
+                            idx2D(0, k1, ldf), ldf, strideF, batch_count, workArr);
+
+    // T12 = -T11 * T12 * T22
+    rocblasCall_trmm<T>(handle, rocblas_side_left, rocblas_fill_upper, rocblas_operation_none,
+                        rocblas_diagonal_non_unit, k1, k2, scalars, 0, F, 0, ldf, strideF, F,
+                        idx2D(0, k1, ldf), ldf, strideF, batch_count, workArr);
+    rocblasCall_trmm<T>(handle, rocblas_side_right, rocblas_fill_upper, rocblas_operation_none,
+                        rocblas_diagonal_non_unit, k1, k2, scalars + 2, 0, F, idx2D(k1, k1, ldf),
+                        ldf, strideF, F, idx2D(0, k1, ldf), ldf, strideF, batch_count, workArr);
+}
+
 template <bool BATCHED, typename T>
 void rocsolver_larft_getMemorySize(const rocblas_int n,
                                    const rocblas_int k,
@@ -264,6 +480,24 @@ rocblas_status rocsolver_larft_template(rocblas_handle handle,
     rocblas_get_pointer_mode(handle, &old_mode);
     rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device);
 
+    // small block reflectors are computed with a single kernel, and large ones stored column-wise
+    // in the forward direction (as in the QR-family routines) with the recursive algorithm
+    if(k <= BS2 && n <= LARFT_SMALL_MAX_N)
+    {
+        ROCSOLVER_LAUNCH_KERNEL((larft_small_kernel<T>), dim3(1, 1, batch_count), dim3(BS2, BS2),
+                                0, stream, direct, storev, n, k, n, V, shiftV, ldv, strideV, tau,
+                                strideT, F, ldf, strideF);
+        rocblas_set_pointer_mode(handle, old_mode);
+        return rocblas_status_success;
+    }
+    if(direct == rocblas_forward_direction && storev == rocblas_column_wise)
+    {
+        rocsolver_larft_recursive<T>(handle, n, k, V, shiftV, ldv, strideV, tau, strideT, F, ldf,
+                                     strideF, batch_count, scalars, workArr);
+        rocblas_set_pointer_mode(handle, old_mode);
+        return rocblas_status_success;
+    }
+
     rocblas_stride stridew = rocblas_stride(k);
     rocblas_diagonal diag = rocblas_diagonal_non_unit;
     rocblas_fill uplo;
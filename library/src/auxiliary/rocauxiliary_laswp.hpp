@@ -66,6 +66,102 @@ ROCSOLVER_KERNEL void laswp_kernel(const I n,
     }
 }
 
+/** LASWP_TILED_KERNEL applies the row interchanges k1 to k2 to a tile of LASWP_TILE_COLS
+    columns of a matrix with unit row increment. The rows k1 to k2 of the tile are loaded into
+    shared memory (with coalesced accesses) LASWP_TILE_ROWS rows at a time; then every thread
+    applies the interchanges of these rows to one column of the tile, reading and writing
+    global memory only for the rows outside the chunk. **/
+template <typename T, typename I, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(LASWP_TILE_COLS)
+    laswp_tiled_kernel(const I n,
+                       U AA,
+                       const rocblas_stride shiftA,
+                       const I lda,
+                       const rocblas_stride stride,
+                       const I k1,
+                       const I k2,
+                       const I* ipivA,
+                       const rocblas_stride shiftP,
+                       I incp,
+                       const rocblas_stride strideP)
+{
+    I id = hipBlockIdx_y;
+    I tid = hipThreadIdx_x;
+    I j0 = hipBlockIdx_x * static_cast<I>(LASWP_TILE_COLS);
+    I nc = std::min(I(LASWP_TILE_COLS), n - j0);
+
+    // batch instance
+    // shiftP must be used so that ipiv[k1] is the desired first index of ipiv
+    const I* ipiv = ipivA + id * strideP + shiftP;
+    T* A = load_ptr_batch(AA, id, shiftA + j0 * rocblas_stride(lda), stride);
+
+    // shared mem for the tile
+    extern __shared__ double lmem[];
+    T* tile = reinterpret_cast<T*>(lmem);
+
+    bool backward = (incp < 0);
+    if(backward)
+        incp = -incp;
+
+    // chunks are visited in the same order as the interchanges
+    I nchunks = (k2 - k1) / LASWP_TILE_ROWS + 1;
+    for(I c = 0; c < nchunks; c++)
+    {
+        // the chunk has rows r0 to r0 + nr - 1 (1-based)
+        I r0, nr;
+        if(backward)
+        {
+            r0 = std::max(k1, k2 - (c + 1) * LASWP_TILE_ROWS + 1);
+            nr = k2 - c * LASWP_TILE_ROWS - r0 + 1;
+        }
+        else
+        {
+            r0 = k1 + c * LASWP_TILE_ROWS;
+            nr = std::min(I(LASWP_TILE_ROWS), k2 - r0 + 1);
+        }
+
+        // load the chunk
+        for(I idx = tid; idx < nr * nc; idx += LASWP_TILE_COLS)
+        {
+            I r = idx % nr;
+            I j = idx / nr;
+            tile[r + j * LASWP_TILE_ROWS] = A[(r0 - 1 + r) + j * rocblas_stride(lda)];
+        }
+        __syncthreads();
+
+        // apply the interchanges of the chunk to column tid
+        if(tid < nc)
+        {
+            T* col = A + tid * rocblas_stride(lda);
+            T* tcol = tile + tid * LASWP_TILE_ROWS;
+            for(I t = 0; t < nr; t++)
+            {
+                I i = backward ? r0 + nr - 1 - t : r0 + t;
+                I exch = ipiv[k1 + (i - k1) * incp - 1];
+
+                // will exchange rows i and exch if they are not the same
+                if(exch != i)
+                {
+                    if(exch >= r0 && exch < r0 + nr)
+                        swap(tcol[i - r0], tcol[exch - r0]);
+                    else
+                        swap(tcol[i - r0], col[exch - 1]);
+                }
+            }
+        }
+        __syncthreads();
+
+        // store the chunk
+        for(I idx = tid; idx < nr * nc; idx += LASWP_TILE_COLS)
+        {
+            I r = idx % nr;
+            I j = idx / nr;
+            A[(r0 - 1 + r) + j * rocblas_stride(lda)] = tile[r + j * LASWP_TILE_ROWS];
+        }
+        __syncthreads();
+    }
+}
+
 template <typename T, typename I>
 rocblas_status rocsolver_laswp_argCheck(rocblas_handle handle,
                                         const I n,
@@ -122,13 +218,27 @@ rocblas_status rocsolver_laswp_template(rocblas_handle handle,
     if(n == 0 || batch_count == 0)
         return rocblas_status_success;
 
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // apply the interchanges by tiles when the rows are contiguous
+    if(inca == 1 && k2 - k1 + 1 >= LASWP_TILED_MIN_PIVOTS)
+    {
+        I blocks = (n - 1) / LASWP_TILE_COLS + 1;
+        dim3 grid(blocks, batch_count, 1);
+        dim3 threads(LASWP_TILE_COLS, 1, 1);
+        size_t lmemsize = sizeof(T) * LASWP_TILE_ROWS * LASWP_TILE_COLS;
+
+        ROCSOLVER_LAUNCH_KERNEL(laswp_tiled_kernel<T>, grid, threads, lmemsize, stream, n, A,
+                                shiftA, lda, strideA, k1, k2, ipiv, shiftP, incp, strideP);
+
+        return rocblas_status_success;
+    }
+
     I blocksPivot = (n - 1) / LASWP_THDS + 1;
     dim3 gridPivot(blocksPivot, batch_count, 1);
     dim3 threads(LASWP_THDS, 1, 1);
 
-    hipStream_t stream;
-    rocblas_get_stream(handle, &stream);
-
     ROCSOLVER_LAUNCH_KERNEL(laswp_kernel<T>, gridPivot, threads, 0, stream, n, A, shiftA, inca, lda,
                             strideA, k1, k2, ipiv, shiftP, incp, strideP);
 
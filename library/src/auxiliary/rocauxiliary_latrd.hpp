@@ -39,6 +39,254 @@
 
 ROCSOLVER_BEGIN_NAMESPACE
 
+/** LATRD_USE_FUSED returns true if the steps of LATRD are computed with the fused kernels
+    LATRD_SYMV_KERNEL and LATRD_UPDATE_KERNEL **/
+inline bool latrd_use_fused(const rocblas_int k)
+{
+    return k <= LATRD_FUSED_MAX_K;
+}
+
+/** LATRD_FUSED_STRIDE returns the size of the workspace required by a batch instance in the
+    fused kernels: the partial results of the symmetric product for every tile-column of the
+    trailing matrix, and the partial results of the GEMVs with the reduced columns **/
+inline rocblas_stride latrd_fused_stride(const rocblas_int n, const rocblas_int k)
+{
+    rocblas_int nt = (n - 1) / BS2 + 1;
+    return rocblas_stride(nt) * (n + 2 * k);
+}
+
+/** LATRD_SYMV_KERNEL computes, for one step of LATRD, the partial results of y = A * v, with A
+    the m-by-m Hermitian (symmetric) trailing matrix whose uplo triangle is stored, and of
+    W' * v and Ap' * v, with W and Ap the m-by-pc blocks of the already reduced columns. Each
+    thread-block works with one tile-column of the stored triangle (in the lower view), so that
+    every element of A is read once and contributes to both y(I) += A(I,J) * v(J) and
+    y(J) += A(I,J)' * v(I). The partial results are written to work and added together by
+    LATRD_UPDATE_KERNEL. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) latrd_symv_kernel(const rocblas_fill uplo,
+                                                               const rocblas_int m,
+                                                               const rocblas_int pc,
+                                                               U AA,
+                                                               const rocblas_int shiftA,
+                                                               const rocblas_int shiftV,
+                                                               const rocblas_int shiftAp,
+                                                               const rocblas_int lda,
+                                                               const rocblas_stride strideA,
+                                                               T* WW,
+                                                               const rocblas_int shiftWp,
+                                                               const rocblas_int ldw,
+                                                               const rocblas_stride strideW,
+                                                               T* work,
+                                                               const rocblas_stride strideWork)
+{
+    const rocblas_int bid = hipBlockIdx_y;
+    const rocblas_int tx = hipThreadIdx_x;
+    const rocblas_int ty = hipThreadIdx_y;
+    const rocblas_int dimy = hipBlockDim_y;
+    const rocblas_int tid = tx + ty * BS2;
+    const rocblas_int nthds = BS2 * dimy;
+    const rocblas_int nt = hipGridDim_x;
+    const rocblas_int jt = hipBlockIdx_x;
+    const rocblas_int j0 = jt * BS2;
+    const rocblas_int jb = std::min(BS2, m - j0);
+    const bool lower = (uplo == rocblas_fill_lower);
+    const int64_t la = lda;
+
+    // select batch instance
+    T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+    T* v = load_ptr_batch<T>(AA, bid, shiftV, strideA);
+    T* Ap = load_ptr_batch<T>(AA, bid, shiftAp, strideA);
+    T* Wp = load_ptr_batch<T>(WW, bid, shiftWp, strideW);
+    T* py = work + bid * strideWork + jt * int64_t(m);
+    T* pt = work + bid * strideWork + nt * int64_t(m) + jt * 2 * pc;
+
+    // shared memory setup
+    __shared__ T sA[BS2][BS2 + 1];
+    __shared__ T sred[BS1 / BS2][BS2 + 1];
+    __shared__ T sv[BS2];
+    __shared__ T sx[BS2];
+
+    if(tid < BS2)
+        sv[tid] = (tid < jb ? v[j0 + tid] : T(0));
+
+    // load the diagonal tile (as a full Hermitian tile)
+    for(rocblas_int e = tid; e < BS2 * BS2; e += nthds)
+    {
+        rocblas_int a = e % BS2;
+        rocblas_int b = e / BS2;
+        rocblas_int r = lower ? a : b;
+        rocblas_int c = lower ? b : a;
+        if(r >= c)
+        {
+            T val = 0;
+            if(r < jb)
+                val = lower ? A[(j0 + r) + (j0 + c) * la] : conj(A[(j0 + c) + (j0 + r) * la]);
+            if(r == c)
+                val = T(std::real(val));
+            sA[r][c] = val;
+            sA[c][r] = conj(val);
+        }
+    }
+    __syncthreads();
+
+    // y(J) = A(J,J) * v(J), the row being given by tx
+    T acc = 0;
+    for(rocblas_int c = ty; c < jb; c += dimy)
+        acc += sA[tx][c] * sv[c];
+
+    // tiles below the diagonal tile
+    for(rocblas_int it = jt + 1; it < nt; ++it)
+    {
+        const rocblas_int i0 = it * BS2;
+        const rocblas_int ib = std::min(BS2, m - i0);
+        __syncthreads();
+
+        if(tid < BS2)
+            sx[tid] = (tid < ib ? v[i0 + tid] : T(0));
+        for(rocblas_int e = tid; e < BS2 * BS2; e += nthds)
+        {
+            rocblas_int a = e % BS2;
+            rocblas_int b = e / BS2;
+            rocblas_int r = lower ? a : b;
+            rocblas_int c = lower ? b : a;
+            T val = 0;
+            if(r < ib && c < jb)
+                val = lower ? A[(i0 + r) + (j0 + c) * la] : conj(A[(j0 + c) + (i0 + r) * la]);
+            sA[r][c] = val;
+        }
+        __syncthreads();
+
+        // y(I) += A(I,J) * v(J), the row being given by tx
+        T s = 0;
+        for(rocblas_int c = ty; c < jb; c += dimy)
+            s += sA[tx][c] * sv[c];
+        sred[ty][tx] = s;
+
+        // y(J) += A(I,J)' * v(I), the column being given by tx
+        for(rocblas_int r = ty; r < ib; r += dimy)
+            acc += conj(sA[r][tx]) * sx[r];
+        __syncthreads();
+
+        if(ty == 0 && tx < ib)
+        {
+            s = 0;
+            for(rocblas_int t = 0; t < dimy; t++)
+                s += sred[t][tx];
+            py[i0 + tx] = s;
+        }
+    }
+    __syncthreads();
+
+    sred[ty][tx] = acc;
+    __syncthreads();
+
+    if(ty == 0 && tx < jb)
+    {
+        T s = 0;
+        for(rocblas_int t = 0; t < dimy; t++)
+            s += sred[t][tx];
+        py[j0 + tx] = s;
+    }
+
+    // W(J,:)' * v(J) and Ap(J,:)' * v(J)
+    for(rocblas_int c = tid; c < pc; c += nthds)
+    {
+        T s1 = 0, s2 = 0;
+        for(rocblas_int r = 0; r < jb; r++)
+        {
+            s1 += conj(Wp[(j0 + r) + c * int64_t(ldw)]) * sv[r];
+            s2 += conj(Ap[(j0 + r) + c * la]) * sv[r];
+        }
+        pt[c] = s1;
+        pt[pc + c] = s2;
+    }
+}
+
+/** LATRD_UPDATE_KERNEL adds together the partial results computed by LATRD_SYMV_KERNEL and
+    completes the step of LATRD: y = tau * (A * v - Ap * (W' * v) - W * (Ap' * v)). Ap' * v is
+    also written to t (i.e. to the unused part of the current column of W, as in LAPACK). Each
+    thread-block works with one tile of rows. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) latrd_update_kernel(const rocblas_int m,
+                                                                 const rocblas_int pc,
+                                                                 U AA,
+                                                                 const rocblas_int shiftAp,
+                                                                 const rocblas_int lda,
+                                                                 const rocblas_stride strideA,
+                                                                 T* tauA,
+                                                                 const rocblas_stride strideP,
+                                                                 T* WW,
+                                                                 const rocblas_int shiftWp,
+                                                                 const rocblas_int shiftY,
+                                                                 const rocblas_int shiftT,
+                                                                 const rocblas_int ldw,
+                                                                 const rocblas_stride strideW,
+                                                                 T* work,
+                                                                 const rocblas_stride strideWork)
+{
+    const rocblas_int bid = hipBlockIdx_y;
+    const rocblas_int tx = hipThreadIdx_x;
+    const rocblas_int ty = hipThreadIdx_y;
+    const rocblas_int dimy = hipBlockDim_y;
+    const rocblas_int tid = tx + ty * BS2;
+    const rocblas_int nthds = BS2 * dimy;
+    const rocblas_int nt = hipGridDim_x;
+    const rocblas_int it = hipBlockIdx_x;
+    const rocblas_int i = it * BS2 + tx;
+
+    // select batch instance
+    T* Ap = load_ptr_batch<T>(AA, bid, shiftAp, strideA);
+    T* Wp = WW + shiftWp + bid * strideW;
+    T* y = WW + shiftY + bid * strideW;
+    T* t = WW + shiftT + bid * strideW;
+    T* py = work + bid * strideWork;
+    T* pt = work + bid * strideWork + nt * int64_t(m);
+    const T tau = tauA[bid * strideP];
+
+    // shared memory setup
+    __shared__ T st1[LATRD_FUSED_MAX_K];
+    __shared__ T st2[LATRD_FUSED_MAX_K];
+    __shared__ T sred[BS1 / BS2][BS2 + 1];
+
+    // W' * v and Ap' * v
+    for(rocblas_int c = tid; c < pc; c += nthds)
+    {
+        T s1 = 0, s2 = 0;
+        for(rocblas_int jt = 0; jt < nt; jt++)
+        {
+            s1 += pt[jt * 2 * pc + c];
+            s2 += pt[jt * 2 * pc + pc + c];
+        }
+        st1[c] = s1;
+        st2[c] = s2;
+        if(it == 0)
+            t[c] = s2;
+    }
+    __syncthreads();
+
+    T s = 0;
+    if(i < m)
+    {
+        // A * v, from the tile-columns up to the diagonal tile
+        for(rocblas_int jt = ty; jt <= it; jt += dimy)
+            s += py[jt * int64_t(m) + i];
+
+        // - Ap * (W' * v) - W * (Ap' * v)
+        for(rocblas_int c = ty; c < pc; c += dimy)
+            s -= Ap[i + c * int64_t(lda)] * st1[c] + Wp[i + c * int64_t(ldw)] * st2[c];
+    }
+    sred[ty][tx] = s;
+    __syncthreads();
+
+    if(ty == 0 && i < m)
+    {
+        s = 0;
+        for(rocblas_int r = 0; r < dimy; r++)
+            s += sred[r][tx];
+        y[i] = tau * s;
+    }
+}
+
 template <bool BATCHED, typename T>
 void rocsolver_latrd_getMemorySize(const rocblas_int n,
                                    const rocblas_int k,
@@ -75,6 +323,13 @@ void rocsolver_latrd_getMemorySize(const rocblas_int n,
     // extra requirements for calling symv/hemv
     rocblasCall_symv_hemv_mem<BATCHED, T>(n, batch_count, &w_temp);
     *size_work = std::max(*size_work, w_temp);
+
+    // extra requirements for the fused kernels
+    if(latrd_use_fused(k))
+    {
+        w_temp = sizeof(T) * latrd_fused_stride(n, k) * batch_count;
+        *size_work = std::max(*size_work, w_temp);
+    }
 }
 
 template <typename T, typename S, typename U>
@@ -156,6 +411,12 @@ rocblas_status rocsolver_latrd_template(rocblas_handle handle,
     blocks = (n - 1) / BS1 + 1;
     dim3 grid_n(blocks, batch_count);
 
+    // with the fused kernels, the SYMV/HEMV, GEMVs and scaling of every step are computed
+    // with one traversal of the trailing matrix
+    const bool fused = latrd_use_fused(k);
+    const rocblas_stride strideWork = latrd_fused_stride(n, k);
+    dim3 threads_t(BS2, BS1 / BS2, 1);
+
     if(uplo == rocblas_fill_lower)
     {
         // reduce the first k columns of A
@@ -201,37 +462,65 @@ rocblas_status rocsolver_latrd_template(rocblas_handle handle,
                                     shiftA + idx2D(j + 1, j, lda), strideA, (E + j), strideE);
 
             // compute/update column j of W
-            rocblasCall_symv_hemv<T>(
-                handle, uplo, n - 1 - j, (scalars + 2), 0, A, shiftA + idx2D(j + 1, j + 1, lda),
-                lda, strideA, A, shiftA + idx2D(j + 1, j, lda), 1, strideA, (scalars + 1), 0, W,
-                shiftW + idx2D(j + 1, j, ldw), 1, strideW, batch_count, work, workArr);
-
-            rocblasCall_gemv<T>(handle, rocblas_operation_conjugate_transpose, n - j - 1, j,
-                                cast2constType<T>(scalars + 2), 0, W, shiftW + idx2D(j + 1, 0, ldw),
-                                ldw, strideW, A, shiftA + idx2D(j + 1, j, lda), 1, strideA,
-                                cast2constType<T>(scalars + 1), 0, W, shiftW + idx2D(0, j, ldw), 1,
-                                strideW, batch_count, workArr);
-
-            rocblasCall_gemv<T>(handle, rocblas_operation_none, n - j - 1, j,
-                                cast2constType<T>(scalars), 0, A, shiftA + idx2D(j + 1, 0, lda),
-                                lda, strideA, W, shiftW + idx2D(0, j, ldw), 1, strideW,
-                                cast2constType<T>(scalars + 2), 0, W, shiftW + idx2D(j + 1, j, ldw),
-                                1, strideW, batch_count, workArr);
-
-            rocblasCall_gemv<T>(handle, rocblas_operation_conjugate_transpose, n - j - 1, j,
-                                cast2constType<T>(scalars + 2), 0, A, shiftA + idx2D(j + 1, 0, lda),
-                                lda, strideA, A, shiftA + idx2D(j + 1, j, lda), 1, strideA,
-                                cast2constType<T>(scalars + 1), 0, W, shiftW + idx2D(0, j, ldw), 1,
-                                strideW, batch_count, workArr);
-
-            rocblasCall_gemv<T>(handle, rocblas_operation_none, n - j - 1, j,
-                                cast2constType<T>(scalars), 0, W, shiftW + idx2D(j + 1, 0, ldw),
-                                ldw, strideW, W, shiftW + idx2D(0, j, ldw), 1, strideW,
-                                cast2constType<T>(scalars + 2), 0, W, shiftW + idx2D(j + 1, j, ldw),
-                                1, strideW, batch_count, workArr);
-
-            rocblasCall_scal<T>(handle, n - j - 1, (tau + j), strideP, W,
-                                shiftW + idx2D(j + 1, j, ldw), 1, strideW, batch_count);
+            if(fused)
+            {
+                rocblas_int mm = n - 1 - j;
+                if(mm > 0)
+                {
+                    dim3 grid_t((mm - 1) / BS2 + 1, batch_count);
+                    ROCSOLVER_LAUNCH_KERNEL(latrd_symv_kernel<T>, grid_t, threads_t, 0, stream,
+                                            uplo, mm, j, A, shiftA + idx2D(j + 1, j + 1, lda),
+                                            shiftA + idx2D(j + 1, j, lda),
+                                            shiftA + idx2D(j + 1, 0, lda), lda, strideA, W,
+                                            shiftW + idx2D(j + 1, 0, ldw), ldw, strideW, work,
+                                            strideWork);
+                    ROCSOLVER_LAUNCH_KERNEL(latrd_update_kernel<T>, grid_t, threads_t, 0, stream,
+                                            mm, j, A, shiftA + idx2D(j + 1, 0, lda), lda, strideA,
+                                            tau + j, strideP, W, shiftW + idx2D(j + 1, 0, ldw),
+                                            shiftW + idx2D(j + 1, j, ldw),
+                                            shiftW + idx2D(0, j, ldw), ldw, strideW, work,
+                                            strideWork);
+                }
+            }
+            else
+            {
+                rocblasCall_symv_hemv<T>(handle, uplo, n - 1 - j, (scalars + 2), 0, A,
+                                         shiftA + idx2D(j + 1, j + 1, lda), lda, strideA, A,
+                                         shiftA + idx2D(j + 1, j, lda), 1, strideA, (scalars + 1),
+                                         0, W, shiftW + idx2D(j + 1, j, ldw), 1, strideW,
+                                         batch_count, work, workArr);
+
+                rocblasCall_gemv<T>(handle, rocblas_operation_conjugate_transpose, n - j - 1, j,
+                                    cast2constType<T>(scalars + 2), 0, W,
+                                    shiftW + idx2D(j + 1, 0, ldw), ldw, strideW, A,
+                                    shiftA + idx2D(j + 1, j, lda), 1, strideA,
+                                    cast2constType<T>(scalars + 1), 0, W, shiftW + idx2D(0, j, ldw),
+                                    1, strideW, batch_count, workArr);
+
+                rocblasCall_gemv<T>(handle, rocblas_operation_none, n - j - 1, j,
+                                    cast2constType<T>(scalars), 0, A, shiftA + idx2D(j + 1, 0, lda),
+                                    lda, strideA, W, shiftW + idx2D(0, j, ldw), 1, strideW,
+                                    cast2constType<T>(scalars + 2), 0, W,
+                                    shiftW + idx2D(j + 1, j, ldw), 1, strideW, batch_count,
+                                    workArr);
+
+                rocblasCall_gemv<T>(handle, rocblas_operation_conjugate_transpose, n - j - 1, j,
+                                    cast2constType<T>(scalars + 2), 0, A,
+                                    shiftA + idx2D(j + 1, 0, lda), lda, strideA, A,
+                                    shiftA + idx2D(j + 1, j, lda), 1, strideA,
+                                    cast2constType<T>(scalars + 1), 0, W, shiftW + idx2D(0, j, ldw),
+                                    1, strideW, batch_count, workArr);
+
+                rocblasCall_gemv<T>(handle, rocblas_operation_none, n - j - 1, j,
+                                    cast2constType<T>(scalars), 0, W, shiftW + idx2D(j + 1, 0, ldw),
+                                    ldw, strideW, W, shiftW + idx2D(0, j, ldw), 1, strideW,
+                                    cast2constType<T>(scalars + 2), 0, W,
+                                    shiftW + idx2D(j + 1, j, ldw), 1, strideW, batch_count,
+                                    workArr);
+
+                rocblasCall_scal<T>(handle, n - j - 1, (tau + j), strideP, W,
+                                    shiftW + idx2D(j + 1, j, ldw), 1, strideW, batch_count);
+            }
 
             rocblasCall_dot<COMPLEX, T>(handle, n - 1 - j, W, shiftW + idx2D(j + 1, j, ldw), 1,
                                         strideW, A, shiftA + idx2D(j + 1, j, lda), 1, strideA,
@@ -293,37 +582,65 @@ rocblas_status rocsolver_latrd_template(rocblas_handle handle,
                                     shiftA + idx2D(j - 1, j, lda), strideA, (E + j - 1), strideE);
 
             // compute/update column j of W
-            rocblasCall_symv_hemv<T>(handle, uplo, j, (scalars + 2), 0, A, shiftA, lda, strideA, A,
-                                     shiftA + idx2D(0, j, lda), 1, strideA, (scalars + 1), 0, W,
-                                     shiftW + idx2D(0, jw, ldw), 1, strideW, batch_count, work,
-                                     workArr);
-
-            rocblasCall_gemv<T>(handle, rocblas_operation_conjugate_transpose, j, n - 1 - j,
-                                cast2constType<T>(scalars + 2), 0, W, shiftW + idx2D(0, jw + 1, ldw),
-                                ldw, strideW, A, shiftA + idx2D(0, j, lda), 1, strideA,
-                                cast2constType<T>(scalars + 1), 0, W,
-                                shiftW + idx2D(j + 1, jw, ldw), 1, strideW, batch_count, workArr);
-
-            rocblasCall_gemv<T>(handle, rocblas_operation_none, j, n - 1 - j,
-                                cast2constType<T>(scalars), 0, A, shiftA + idx2D(0, j + 1, lda),
-                                lda, strideA, W, shiftW + idx2D(j + 1, jw, ldw), 1, strideW,
-                                cast2constType<T>(scalars + 2), 0, W, shiftW + idx2D(0, jw, ldw), 1,
-                                strideW, batch_count, workArr);
-
-            rocblasCall_gemv<T>(handle, rocblas_operation_conjugate_transpose, j, n - 1 - j,
-                                cast2constType<T>(scalars + 2), 0, A, shiftA + idx2D(0, j + 1, lda),
-                                lda, strideA, A, shiftA + idx2D(0, j, lda), 1, strideA,
-                                cast2constType<T>(scalars + 1), 0, W,
-                                shiftW + idx2D(j + 1, jw, ldw), 1, strideW, batch_count, workArr);
-
-            rocblasCall_gemv<T>(handle, rocblas_operation_none, j, n - 1 - j,
-                                cast2constType<T>(scalars), 0, W, shiftW + idx2D(0, jw + 1, ldw),
-                                ldw, strideW, W, shiftW + idx2D(j + 1, jw, ldw), 1, strideW,
-                                cast2constType<T>(scalars + 2), 0, W, shiftW + idx2D(0, jw, ldw), 1,
-                                strideW, batch_count, workArr);
-
-            rocblasCall_scal<T>(handle, j, (tau + j - 1), strideP, W, shiftW + idx2D(0, jw, ldw), 1,
-                                strideW, batch_count);
+            if(fused)
+            {
+                if(j > 0)
+                {
+                    dim3 grid_t((j - 1) / BS2 + 1, batch_count);
+                    ROCSOLVER_LAUNCH_KERNEL(latrd_symv_kernel<T>, grid_t, threads_t, 0, stream,
+                                            uplo, j, n - 1 - j, A, shiftA,
+                                            shiftA + idx2D(0, j, lda),
+                                            shiftA + idx2D(0, j + 1, lda), lda, strideA, W,
+                                            shiftW + idx2D(0, jw + 1, ldw), ldw, strideW, work,
+                                            strideWork);
+                    ROCSOLVER_LAUNCH_KERNEL(latrd_update_kernel<T>, grid_t, threads_t, 0, stream,
+                                            j, n - 1 - j, A, shiftA + idx2D(0, j + 1, lda), lda,
+                                            strideA, tau + j - 1, strideP, W,
+                                            shiftW + idx2D(0, jw + 1, ldw),
+                                            shiftW + idx2D(0, jw, ldw),
+                                            shiftW + idx2D(j + 1, jw, ldw), ldw, strideW, work,
+                                            strideWork);
+                }
+            }
+            else
+            {
+                rocblasCall_symv_hemv<T>(handle, uplo, j, (scalars + 2), 0, A, shiftA, lda, strideA,
+                                         A, shiftA + idx2D(0, j, lda), 1, strideA, (scalars + 1), 0,
+                                         W, shiftW + idx2D(0, jw, ldw), 1, strideW, batch_count,
+                                         work, workArr);
+
+                rocblasCall_gemv<T>(handle, rocblas_operation_conjugate_transpose, j, n - 1 - j,
+                                    cast2constType<T>(scalars + 2), 0, W,
+                                    shiftW + idx2D(0, jw + 1, ldw), ldw, strideW, A,
+                                    shiftA + idx2D(0, j, lda), 1, strideA,
+                                    cast2constType<T>(scalars + 1), 0, W,
+                                    shiftW + idx2D(j + 1, jw, ldw), 1, strideW, batch_count,
+                                    workArr);
+
+                rocblasCall_gemv<T>(handle, rocblas_operation_none, j, n - 1 - j,
+                                    cast2constType<T>(scalars), 0, A, shiftA + idx2D(0, j + 1, lda),
+                                    lda, strideA, W, shiftW + idx2D(j + 1, jw, ldw), 1, strideW,
+                                    cast2constType<T>(scalars + 2), 0, W,
+                                    shiftW + idx2D(0, jw, ldw), 1, strideW, batch_count, workArr);
+
+                rocblasCall_gemv<T>(handle, rocblas_operation_conjugate_transpose, j, n - 1 - j,
+                                    cast2constType<T>(scalars + 2), 0, A,
+                                    shiftA + idx2D(0, j + 1, lda), lda, strideA, A,
+                                    shiftA + idx2D(0, j, lda), 1, strideA,
+                                    cast2constType<T>(scalars + 1), 0, W,
+                                    shiftW + idx2D(j + 1, jw, ldw), 1, strideW, batch_count,
+                                    workArr);
+
+                rocblasCall_gemv<T>(handle, rocblas_operation_none, j, n - 1 - j,
+                                    cast2constType<T>(scalars), 0, W,
+                                    shiftW + idx2D(0, jw + 1, ldw), ldw, strideW, W,
+                                    shiftW + idx2D(j + 1, jw, ldw), 1, strideW,
+                                    cast2constType<T>(scalars + 2), 0, W,
+                                    shiftW + idx2D(0, jw, ldw), 1, strideW, batch_count, workArr);
+
+                rocblasCall_scal<T>(handle, j, (tau + j - 1), strideP, W,
+                                    shiftW + idx2D(0, jw, ldw), 1, strideW, batch_count);
+            }
 
             rocblasCall_dot<COMPLEX, T>(handle, j, W, shiftW + idx2D(0, jw, ldw), 1, strideW, A,
                                         shiftA + idx2D(0, j, lda), 1, strideA, batch_count, norms,
@@ -46,8 +46,99 @@ void rocsolver_lauum_getMemorySize(const rocblas_int n, const rocblas_int batch_
     if(n == 0 || batch_count == 0)
         return;
 
-    // size of workspace
-    *size_work = sizeof(T) * n * n * batch_count;
+    // size of workspace (only the diagonal blocks of the recursion are copied)
+    size_t nn = std::min(n, LAUUM_RECURSIVE_SWITCHSIZE);
+    *size_work = sizeof(T) * nn * nn * batch_count;
+}
+
+/** LAUUM_RECURSIVE computes U*U' or L'*L in place. If n > LAUUM_RECURSIVE_SWITCHSIZE the matrix is
+    split in halves; then, for the upper case, A11 = U11*U11' + U12*U12', A12 = U12*U22' and
+    A22 = U22*U22' (and similarly for the lower case), so that most of the work is done by a HERK
+    and a TRMM of size n/2. Otherwise, the factor is copied to work and multiplied by a single
+    TRMM. All the scalars must be on the host. **/
+template <bool BATCHED, typename T, typename U>
+void lauum_recursive(rocblas_handle handle,
+                     const rocblas_fill uplo,
+                     const rocblas_int n,
+                     U A,
+                     const rocblas_int shiftA,
+                     const rocblas_int lda,
+                     const rocblas_stride strideA,
+                     const rocblas_int batch_count,
+                     T* work)
+{
+    using S = decltype(std::real(T{}));
+    T one = 1;
+    S s_one = 1;
+
+    if(n <= LAUUM_RECURSIVE_SWITCHSIZE)
+    {
+        hipStream_t stream;
+        rocblas_get_stream(handle, &stream);
+
+        rocblas_int strideW = n * n;
+        rocblas_int blocks = (n - 1) / BS2 + 1;
+        dim3 grid(blocks, blocks, batch_count);
+        dim3 threads(BS2, BS2);
+
+        // put the triangular factor of interest in work
+        ROCSOLVER_LAUNCH_KERNEL(set_zero<T>, grid, threads, 0, stream, n, n, work, 0, n, strideW);
+        ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, grid, threads, 0, stream, n, n, A, shiftA, lda,
+                                strideA, (T*)work, 0, n, strideW, no_mask{}, uplo);
+
+        rocblas_side side = (uplo == rocblas_fill_upper) ? rocblas_side_right : rocblas_side_left;
+
+        // work = work * A' or work = A' * work
+        rocblasCall_trmm(handle, side, uplo, rocblas_operation_conjugate_transpose,
+                         rocblas_diagonal_non_unit, n, n, &one, 0, A, shiftA, lda, strideA, work,
+                         0, n, strideW, batch_count);
+
+        // copy the new factor into the relevant triangle of A leaving the rest untouched
+        ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, grid, threads, 0, stream, n, n, work, 0, n, strideW,
+                                A, shiftA, lda, strideA, no_mask{}, uplo);
+        return;
+    }
+
+    // split at a multiple of 64 close to n/2
+    rocblas_int n1 = ((n / 2 + 32) / 64) * 64;
+    rocblas_int n2 = n - n1;
+    rocblas_int shift11 = shiftA;
+    rocblas_int shift22 = shiftA + idx2D(n1, n1, lda);
+
+    // A11 = U11 * U11' or A11 = L11' * L11
+    lauum_recursive<BATCHED, T>(handle, uplo, n1, A, shift11, lda, strideA, batch_count, work);
+
+    if(uplo == rocblas_fill_upper)
+    {
+        rocblas_int shift12 = shiftA + idx2D(0, n1, lda);
+
+        // A11 = A11 + U12 * U12'
+        rocblasCall_syrk_herk<BATCHED, T>(handle, uplo, rocblas_operation_none, n1, n2, &s_one, A,
+                                          shift12, lda, strideA, &s_one, A, shift11, lda, strideA,
+                                          batch_count);
+
+        // A12 = U12 * U22'
+        rocblasCall_trmm(handle, rocblas_side_right, uplo, rocblas_operation_conjugate_transpose,
+                         rocblas_diagonal_non_unit, n1, n2, &one, 0, A, shift22, lda, strideA, A,
+                         shift12, lda, strideA, batch_count);
+    }
+    else
+    {
+        rocblas_int shift21 = shiftA + idx2D(n1, 0, lda);
+
+        // A11 = A11 + L21' * L21
+        rocblasCall_syrk_herk<BATCHED, T>(handle, uplo, rocblas_operation_conjugate_transpose, n1,
+                                          n2, &s_one, A, shift21, lda, strideA, &s_one, A, shift11,
+                                          lda, strideA, batch_count);
+
+        // A21 = L22' * L21
+        rocblasCall_trmm(handle, rocblas_side_left, uplo, rocblas_operation_conjugate_transpose,
+                         rocblas_diagonal_non_unit, n2, n1, &one, 0, A, shift22, lda, strideA, A,
+                         shift21, lda, strideA, batch_count);
+    }
+
+    // A22 = U22 * U22' or A22 = L22' * L22
+    lauum_recursive<BATCHED, T>(handle, uplo, n2, A, shift22, lda, strideA, batch_count, work);
 }
 
 template <typename T, typename U>
@@ -68,36 +159,12 @@ rocblas_status rocsolver_lauum_template(rocblas_handle handle,
     if(n == 0 || batch_count == 0)
         return rocblas_status_success;
 
-    hipStream_t stream;
-    rocblas_get_stream(handle, &stream);
-
     // everything must be executed with scalars on the host
     rocblas_pointer_mode old_mode;
     rocblas_get_pointer_mode(handle, &old_mode);
     rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
 
-    rocblas_int strideW = n * n;
-    rocblas_int blocks = (n - 1) / BS2 + 1;
-    dim3 grid(blocks, blocks, batch_count);
-    dim3 threads(BS2, BS2);
-    T one = 1;
-    T zero = 0;
-
-    // put the triangular factor of interest in work
-    ROCSOLVER_LAUNCH_KERNEL(set_zero<T>, grid, threads, 0, stream, n, n, work, 0, n, strideW);
-    ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, grid, threads, 0, stream, n, n, A, shiftA, lda, strideA,
-                            (T*)work, 0, n, strideW, no_mask{}, uplo);
-
-    rocblas_side side = (uplo == rocblas_fill_upper) ? rocblas_side_right : rocblas_side_left;
-
-    // work = work * A' or work = A' * work
-    rocblasCall_trmm(handle, side, uplo, rocblas_operation_conjugate_transpose,
-                     rocblas_diagonal_non_unit, n, n, &one, 0, A, shiftA, lda, strideA, work, 0, n,
-                     strideW, batch_count);
-
-    // copy the new factor into the relevant triangle of A leaving the rest untouched
-    ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, grid, threads, 0, stream, n, n, work, 0, n, strideW, A,
-                            shiftA, lda, strideA, no_mask{}, uplo);
+    lauum_recursive<false, T>(handle, uplo, n, A, shiftA, lda, strideA, batch_count, work);
 
     rocblas_set_pointer_mode(handle, old_mode);
     return rocblas_status_success;
@@ -58,7 +58,7 @@ rocblas_status rocsolver_org2l_ung2l_impl(rocblas_handle handle,
     rocblas_int batch_count = 1;
 
     // memory workspace sizes:
-    // size for constants in rocblas calls
+    // constants in rocblas calls (only whether they are needed, see set_device_scalars)
     size_t size_scalars;
     // size of arrays of pointers (for batched cases)
     size_t size_workArr;
@@ -68,11 +68,11 @@ rocblas_status rocsolver_org2l_ung2l_impl(rocblas_handle handle,
                                                   &size_workArr);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_Abyx, size_workArr);
+        return rocblas_set_optimal_device_memory_size(handle, size_t(0), size_Abyx, size_workArr);
 
     // memory workspace allocation
     void *scalars, *Abyx, *workArr;
-    rocblas_device_malloc mem(handle, size_scalars, size_Abyx, size_workArr);
+    rocblas_device_malloc mem(handle, size_t(0), size_Abyx, size_workArr);
     if(!mem)
         return rocblas_status_memory_error;
 
@@ -80,7 +80,7 @@ rocblas_status rocsolver_org2l_ung2l_impl(rocblas_handle handle,
     Abyx = mem[1];
     workArr = mem[2];
     if(size_scalars > 0)
-        init_scalars(handle, (T*)scalars);
+        ROCBLAS_CHECK(set_device_scalars<T>(scalars));
 
     // execution
     return rocsolver_org2l_ung2l_template<T>(handle, m, n, k, A, shiftA, lda, strideA, ipiv, strideP,
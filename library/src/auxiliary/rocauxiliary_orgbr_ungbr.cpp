@@ -70,12 +70,12 @@ rocblas_status rocsolver_orgbr_ungbr_impl(rocblas_handle handle,
                                                   &size_workArr);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work,
+        return rocblas_set_optimal_device_memory_size(handle, size_t(0), size_work,
                                                       size_Abyx_tmptr, size_trfact, size_workArr);
 
     // memory workspace allocation
     void *scalars, *work, *Abyx_tmptr, *trfact, *workArr;
-    rocblas_device_malloc mem(handle, size_scalars, size_work, size_Abyx_tmptr, size_trfact,
+    rocblas_device_malloc mem(handle, size_t(0), size_work, size_Abyx_tmptr, size_trfact,
                               size_workArr);
     if(!mem)
         return rocblas_status_memory_error;
@@ -86,7 +86,7 @@ rocblas_status rocsolver_orgbr_ungbr_impl(rocblas_handle handle,
     trfact = mem[3];
     workArr = mem[4];
     if(size_scalars > 0)
-        init_scalars(handle, (T*)scalars);
+        ROCBLAS_CHECK(set_device_scalars<T>(scalars));
 
     // execution
     return rocsolver_orgbr_ungbr_template<false, false, T>(
@@ -89,7 +89,7 @@ void rocsolver_orgl2_ungl2_getMemorySize(const rocblas_int m,
 
     // memory requirements to call larf
     rocsolver_larf_getMemorySize<BATCHED, T>(rocblas_side_right, m, n, batch_count, size_scalars,
-                                             size_Abyx, size_workArr);
+                                             size_Abyx, size_workArr, true);
 }
 
 template <typename T, typename U>
@@ -160,12 +160,10 @@ rocblas_status rocsolver_orgl2_ungl2_template(rocblas_handle handle,
 
     for(rocblas_int j = k - 1; j >= 0; --j)
     {
+        // the row of A holds the conjugate of the Householder vector, which is read as such by
+        // LARF and scaled by the conjugate of -tau, so that it is never conjugated in place
         if(COMPLEX)
-        {
             rocsolver_lacgv_template<T>(handle, 1, ipiv, j, 1, strideP, batch_count);
-            rocsolver_lacgv_template<T>(handle, n - j - 1, A, shiftA + idx2D(j, j + 1, lda), lda,
-                                        strideA, batch_count);
-        }
 
         // apply H(i) to Q(i:m,i:n) from the left
         if(j < m - 1)
@@ -173,24 +171,20 @@ rocblas_status rocsolver_orgl2_ungl2_template(rocblas_handle handle,
             rocsolver_larf_template<T>(handle, rocblas_side_right, m - j - 1, n - j, A,
                                        shiftA + idx2D(j, j, lda), lda, strideA, (ipiv + j), strideP,
                                        A, shiftA + idx2D(j + 1, j, lda), lda, strideA, batch_count,
-                                       scalars, Abyx, workArr);
+                                       scalars, Abyx, workArr, true);
         }
 
         // set the diagonal element and negative tau
         ROCSOLVER_LAUNCH_KERNEL(subtract_tau<T>, dim3(batch_count), dim3(1), 0, stream, j, j, A,
                                 shiftA, lda, strideA, ipiv + j, strideP);
 
-        if(COMPLEX)
-            rocsolver_lacgv_template<T>(handle, 1, ipiv, j, 1, strideP, batch_count);
-
         // update i-th row -corresponding to H(i)-
         if(j < n - 1)
             rocblasCall_scal<T>(handle, n - j - 1, ipiv + j, strideP, A,
                                 shiftA + idx2D(j, j + 1, lda), lda, strideA, batch_count);
 
         if(COMPLEX)
-            rocsolver_lacgv_template<T>(handle, n - j - 1, A, shiftA + idx2D(j, j + 1, lda), lda,
-                                        strideA, batch_count);
+            rocsolver_lacgv_template<T>(handle, 1, ipiv, j, 1, strideP, batch_count);
     }
 
     // restore values of tau
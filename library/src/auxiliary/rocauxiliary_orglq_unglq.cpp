@@ -58,7 +58,7 @@ rocblas_status rocsolver_orglq_unglq_impl(rocblas_handle handle,
     rocblas_int batch_count = 1;
 
     // memory workspace sizes:
-    // size for constants in rocblas calls
+    // constants in rocblas calls (only whether they are needed, see set_device_scalars)
     size_t size_scalars;
     // size of arrays of pointers (for batched cases)
     size_t size_workArr;
@@ -72,12 +72,12 @@ rocblas_status rocsolver_orglq_unglq_impl(rocblas_handle handle,
                                                   &size_Abyx_tmptr, &size_trfact, &size_workArr);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work,
+        return rocblas_set_optimal_device_memory_size(handle, size_t(0), size_work,
                                                       size_Abyx_tmptr, size_trfact, size_workArr);
 
     // memory workspace allocation
     void *scalars, *work, *Abyx_tmptr, *trfact, *workArr;
-    rocblas_device_malloc mem(handle, size_scalars, size_work, size_Abyx_tmptr, size_trfact,
+    rocblas_device_malloc mem(handle, size_t(0), size_work, size_Abyx_tmptr, size_trfact,
                               size_workArr);
     if(!mem)
         return rocblas_status_memory_error;
@@ -88,7 +88,7 @@ rocblas_status rocsolver_orglq_unglq_impl(rocblas_handle handle,
     trfact = mem[3];
     workArr = mem[4];
     if(size_scalars > 0)
-        init_scalars(handle, (T*)scalars);
+        ROCBLAS_CHECK(set_device_scalars<T>(scalars));
 
     // execution
     return rocsolver_orglq_unglq_template<false, false, T>(
@@ -4,7 +4,7 @@
  *     Univ. of Tennessee, Univ. of California Berkeley,
  *     Univ. of Colorado Denver and NAG Ltd..
  *     December 2016
- * Copyright (C) 2019-2024 Advanced Micro Devices, Inc. All rights reserved.
+ * Copyright (C) 2019-2025 Advanced Micro Devices, Inc. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions
@@ -155,6 +155,7 @@ rocblas_status rocsolver_orgqr_ungqr_template(rocblas_handle handle,
     {
         // first update the already computed part
         // applying the current block reflector using larft + larfb
+        // (the top jb rows of the computed part are still zero)
         if(j + jb < n)
         {
             rocsolver_larft_template<T>(handle, rocblas_forward_direction, rocblas_column_wise,
@@ -166,7 +167,7 @@ rocblas_status rocsolver_orgqr_ungqr_template(rocblas_handle handle,
                 handle, rocblas_side_left, rocblas_operation_none, rocblas_forward_direction,
                 rocblas_column_wise, m - j, n - j - jb, jb, A, shiftA + idx2D(j, j, lda), lda,
                 strideA, trfact, 0, ldw, strideW, A, shiftA + idx2D(j, j + jb, lda), lda, strideA,
-                batch_count, Abyx_tmptr, workArr);
+                batch_count, Abyx_tmptr, workArr, true);
         }
 
         // now compute the current block and set to zero
@@ -188,4 +189,168 @@ rocblas_status rocsolver_orgqr_ungqr_template(rocblas_handle handle,
     return rocblas_status_success;
 }
 
+template <typename T, typename U>
+rocblas_status rocsolver_orgqr_outofplace_argCheck(rocblas_handle handle,
+                                                   const rocblas_int m,
+                                                   const rocblas_int n,
+                                                   const rocblas_int k,
+                                                   const rocblas_int lda,
+                                                   const rocblas_int ldq,
+                                                   T A,
+                                                   U ipiv,
+                                                   T Q)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    if(m < 0 || n < 0 || n > m || k < 0 || k > n || lda < m || ldq < m)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((k && !ipiv) || (m && k && !A) || (m && n && !Q))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+/** ORGQR_UNGQR_OUTOFPLACE computes the same matrix Q as ORGQR/UNGQR, but writes it to Q while
+    keeping the Householder vectors in A. The block reflectors are formed and applied from A,
+    and each block of vectors is copied to Q right before it is expanded by ORG2R/UNG2R. The
+    workspace is the same as for ORGQR/UNGQR. **/
+template <bool BATCHED, bool STRIDED, typename T, typename U>
+rocblas_status rocsolver_orgqr_ungqr_outofplace_template(rocblas_handle handle,
+                                                         const rocblas_int m,
+                                                         const rocblas_int n,
+                                                         const rocblas_int k,
+                                                         U A,
+                                                         const rocblas_int shiftA,
+                                                         const rocblas_int lda,
+                                                         const rocblas_stride strideA,
+                                                         T* ipiv,
+                                                         const rocblas_stride strideP,
+                                                         U Q,
+                                                         const rocblas_int shiftQ,
+                                                         const rocblas_int ldq,
+                                                         const rocblas_stride strideQ,
+                                                         const rocblas_int batch_count,
+                                                         T* scalars,
+                                                         T* work,
+                                                         T* Abyx_tmptr,
+                                                         T* trfact,
+                                                         T** workArr)
+{
+    ROCSOLVER_ENTER("orgqr_ungqr_outofplace", "m:", m, "n:", n, "k:", k, "shiftA:", shiftA,
+                    "lda:", lda, "shiftQ:", shiftQ, "ldq:", ldq, "bc:", batch_count);
+
+    // quick return
+    if(!n || !m || !batch_count)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocksy, blocksx;
+
+    // if the matrix is small, use the unblocked variant of the algorithm
+    // on a copy of the Householder vectors
+    if(k <= xxGQx_xxGQx2_SWITCHSIZE)
+    {
+        if(k > 0)
+        {
+            blocksx = (m - 1) / 32 + 1;
+            blocksy = (k - 1) / 32 + 1;
+            ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, dim3(blocksx, blocksy, batch_count), dim3(32, 32),
+                                    0, stream, m, k, A, shiftA, lda, strideA, Q, shiftQ, ldq,
+                                    strideQ);
+        }
+
+        return rocsolver_org2r_ung2r_template<T>(handle, m, n, k, Q, shiftQ, ldq, strideQ, ipiv,
+                                                 strideP, batch_count, scalars, Abyx_tmptr,
+                                                 workArr);
+    }
+
+    rocblas_int ldw = xxGQx_BLOCKSIZE;
+    rocblas_stride strideW = rocblas_stride(ldw) * ldw;
+
+    // start of first blocked block
+    rocblas_int jb = ldw;
+    rocblas_int j = ((k - xxGQx_xxGQx2_SWITCHSIZE - 1) / jb) * jb;
+
+    // start of the unblocked block
+    rocblas_int kk = std::min(k, j + jb);
+
+    // compute the unblockled part and set to zero the
+    // corresponding top submatrix
+    if(kk < n)
+    {
+        blocksx = (kk - 1) / 32 + 1;
+        blocksy = (n - kk - 1) / 32 + 1;
+        ROCSOLVER_LAUNCH_KERNEL(set_zero<T>, dim3(blocksx, blocksy, batch_count), dim3(32, 32), 0,
+                                stream, kk, n - kk, Q, shiftQ + idx2D(0, kk, ldq), ldq, strideQ);
+
+        if(kk < k)
+        {
+            blocksx = (m - kk - 1) / 32 + 1;
+            blocksy = (k - kk - 1) / 32 + 1;
+            ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, dim3(blocksx, blocksy, batch_count), dim3(32, 32),
+                                    0, stream, m - kk, k - kk, A, shiftA + idx2D(kk, kk, lda), lda,
+                                    strideA, Q, shiftQ + idx2D(kk, kk, ldq), ldq, strideQ);
+        }
+
+        rocsolver_org2r_ung2r_template<T>(handle, m - kk, n - kk, k - kk, Q,
+                                          shiftQ + idx2D(kk, kk, ldq), ldq, strideQ, (ipiv + kk),
+                                          strideP, batch_count, scalars, Abyx_tmptr, workArr);
+    }
+
+    // compute the blocked part
+    while(j >= 0)
+    {
+        // first update the already computed part of Q
+        // applying the current block reflector stored in A using larft + larfb
+        // (the top jb rows of the computed part are still zero)
+        if(j + jb < n)
+        {
+            rocsolver_larft_template<T>(handle, rocblas_forward_direction, rocblas_column_wise,
+                                        m - j, jb, A, shiftA + idx2D(j, j, lda), lda, strideA,
+                                        (ipiv + j), strideP, trfact, ldw, strideW, batch_count,
+                                        scalars, work, workArr);
+
+            rocsolver_larfb_template<BATCHED, STRIDED, T>(
+                handle, rocblas_side_left, rocblas_operation_none, rocblas_forward_direction,
+                rocblas_column_wise, m - j, n - j - jb, jb, A, shiftA + idx2D(j, j, lda), lda,
+                strideA, trfact, 0, ldw, strideW, Q, shiftQ + idx2D(j, j + jb, ldq), ldq, strideQ,
+                batch_count, Abyx_tmptr, workArr, true);
+        }
+
+        // now copy the current block of vectors to Q, compute it, and set to zero
+        // the corresponding top submatrix
+        if(j > 0)
+        {
+            blocksx = (j - 1) / 32 + 1;
+            blocksy = (jb - 1) / 32 + 1;
+            ROCSOLVER_LAUNCH_KERNEL(set_zero<T>, dim3(blocksx, blocksy, batch_count), dim3(32, 32),
+                                    0, stream, j, jb, Q, shiftQ + idx2D(0, j, ldq), ldq, strideQ);
+        }
+        blocksx = (m - j - 1) / 32 + 1;
+        blocksy = (jb - 1) / 32 + 1;
+        ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, dim3(blocksx, blocksy, batch_count), dim3(32, 32), 0,
+                                stream, m - j, jb, A, shiftA + idx2D(j, j, lda), lda, strideA, Q,
+                                shiftQ + idx2D(j, j, ldq), ldq, strideQ);
+        rocsolver_org2r_ung2r_template<T>(handle, m - j, jb, jb, Q, shiftQ + idx2D(j, j, ldq), ldq,
+                                          strideQ, (ipiv + j), strideP, batch_count, scalars,
+                                          Abyx_tmptr, workArr);
+
+        j -= jb;
+    }
+
+    return rocblas_status_success;
+}
+
 ROCSOLVER_END_NAMESPACE
@@ -0,0 +1,169 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "rocauxiliary_orgqr_ungqr.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+template <typename T>
+rocblas_status rocsolver_orgqr_ungqr_outofplace_impl(rocblas_handle handle,
+                                                     const rocblas_int m,
+                                                     const rocblas_int n,
+                                                     const rocblas_int k,
+                                                     T* A,
+                                                     const rocblas_int lda,
+                                                     T* ipiv,
+                                                     T* Q,
+                                                     const rocblas_int ldq)
+{
+    const char* name = (!rocblas_is_complex<T> ? "orgqr_outofplace" : "ungqr_outofplace");
+    ROCSOLVER_ENTER_TOP(name, "-m", m, "-n", n, "-k", k, "--lda", lda, "--ldq", ldq);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_orgqr_outofplace_argCheck(handle, m, n, k, lda, ldq, A, ipiv, Q);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+    rocblas_int shiftQ = 0;
+
+    // normal (non-batched non-strided) execution
+    rocblas_stride strideA = 0;
+    rocblas_stride strideP = 0;
+    rocblas_stride strideQ = 0;
+    rocblas_int batch_count = 1;
+
+    // memory workspace sizes:
+    // constants in rocblas calls (only whether they are needed, see set_device_scalars)
+    size_t size_scalars;
+    // size of arrays of pointers (for batched cases)
+    size_t size_workArr;
+    // size of re-usable workspace
+    size_t size_work;
+    // extra requirements for calling ORG2R/UNG2R and LARFB
+    size_t size_Abyx_tmptr;
+    // size of temporary array for triangular factor
+    size_t size_trfact;
+    rocsolver_orgqr_ungqr_getMemorySize<false, T>(m, n, k, batch_count, &size_scalars, &size_work,
+                                                  &size_Abyx_tmptr, &size_trfact, &size_workArr);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_t(0), size_work,
+                                                      size_Abyx_tmptr, size_trfact, size_workArr);
+
+    // memory workspace allocation
+    void *scalars, *work, *Abyx_tmptr, *trfact, *workArr;
+    rocblas_device_malloc mem(handle, size_t(0), size_work, size_Abyx_tmptr, size_trfact,
+                              size_workArr);
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    scalars = mem[0];
+    work = mem[1];
+    Abyx_tmptr = mem[2];
+    trfact = mem[3];
+    workArr = mem[4];
+    if(size_scalars > 0)
+        ROCBLAS_CHECK(set_device_scalars<T>(scalars));
+
+    // execution
+    return rocsolver_orgqr_ungqr_outofplace_template<false, false, T>(
+        handle, m, n, k, A, shiftA, lda, strideA, ipiv, strideP, Q, shiftQ, ldq, strideQ,
+        batch_count, (T*)scalars, (T*)work, (T*)Abyx_tmptr, (T*)trfact, (T**)workArr);
+}
+
+ROCSOLVER_END_NAMESPACE
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sorgqr_outofplace(rocblas_handle handle,
+                                           const rocblas_int m,
+                                           const rocblas_int n,
+                                           const rocblas_int k,
+                                           float* A,
+                                           const rocblas_int lda,
+                                           float* ipiv,
+                                           float* Q,
+                                           const rocblas_int ldq)
+{
+    return rocsolver::rocsolver_orgqr_ungqr_outofplace_impl<float>(handle, m, n, k, A, lda, ipiv, Q,
+                                                                   ldq);
+}
+
+rocblas_status rocsolver_dorgqr_outofplace(rocblas_handle handle,
+                                           const rocblas_int m,
+                                           const rocblas_int n,
+                                           const rocblas_int k,
+                                           double* A,
+                                           const rocblas_int lda,
+                                           double* ipiv,
+                                           double* Q,
+                                           const rocblas_int ldq)
+{
+    return rocsolver::rocsolver_orgqr_ungqr_outofplace_impl<double>(handle, m, n, k, A, lda, ipiv,
+                                                                    Q, ldq);
+}
+
+rocblas_status rocsolver_cungqr_outofplace(rocblas_handle handle,
+                                           const rocblas_int m,
+                                           const rocblas_int n,
+                                           const rocblas_int k,
+                                           rocblas_float_complex* A,
+                                           const rocblas_int lda,
+                                           rocblas_float_complex* ipiv,
+                                           rocblas_float_complex* Q,
+                                           const rocblas_int ldq)
+{
+    return rocsolver::rocsolver_orgqr_ungqr_outofplace_impl<rocblas_float_complex>(
+        handle, m, n, k, A, lda, ipiv, Q, ldq);
+}
+
+rocblas_status rocsolver_zungqr_outofplace(rocblas_handle handle,
+                                           const rocblas_int m,
+                                           const rocblas_int n,
+                                           const rocblas_int k,
+                                           rocblas_double_complex* A,
+                                           const rocblas_int lda,
+                                           rocblas_double_complex* ipiv,
+                                           rocblas_double_complex* Q,
+                                           const rocblas_int ldq)
+{
+    return rocsolver::rocsolver_orgqr_ungqr_outofplace_impl<rocblas_double_complex>(
+        handle, m, n, k, A, lda, ipiv, Q, ldq);
+}
+
+} // extern C
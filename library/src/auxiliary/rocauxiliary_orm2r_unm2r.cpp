@@ -66,7 +66,7 @@ rocblas_status rocsolver_orm2r_unm2r_impl(rocblas_handle handle,
     rocblas_int batch_count = 1;
 
     // memory workspace sizes:
-    // size for constants in rocblas calls
+    // constants in rocblas calls (only whether they are needed, see set_device_scalars)
     size_t size_scalars;
     // extra requirements for calling LARF
     size_t size_Abyx;
@@ -78,12 +78,12 @@ rocblas_status rocsolver_orm2r_unm2r_impl(rocblas_handle handle,
                                                   &size_Abyx, &size_diag, &size_workArr);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_Abyx, size_diag,
+        return rocblas_set_optimal_device_memory_size(handle, size_t(0), size_Abyx, size_diag,
                                                       size_workArr);
 
     // memory workspace allocation
     void *scalars, *Abyx, *diag, *workArr;
-    rocblas_device_malloc mem(handle, size_scalars, size_Abyx, size_diag, size_workArr);
+    rocblas_device_malloc mem(handle, size_t(0), size_Abyx, size_diag, size_workArr);
     if(!mem)
         return rocblas_status_memory_error;
 
@@ -92,7 +92,7 @@ rocblas_status rocsolver_orm2r_unm2r_impl(rocblas_handle handle,
     diag = mem[2];
     workArr = mem[3];
     if(size_scalars > 0)
-        init_scalars(handle, (T*)scalars);
+        ROCBLAS_CHECK(set_device_scalars<T>(scalars));
 
     // execution
     return rocsolver_orm2r_unm2r_template<T>(handle, side, trans, m, n, k, A, shiftA, lda, strideA,
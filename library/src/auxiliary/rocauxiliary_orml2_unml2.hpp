@@ -65,7 +65,7 @@ void rocsolver_orml2_unml2_getMemorySize(const rocblas_side side,
 
     // memory requirements to call larf
     rocsolver_larf_getMemorySize<BATCHED, T>(side, m, n, batch_count, size_scalars, size_Abyx,
-                                             size_workArr);
+                                             size_workArr, true);
 }
 
 template <bool COMPLEX, typename T, typename U>
@@ -203,27 +203,20 @@ rocblas_status rocsolver_orml2_unml2_template(rocblas_handle handle,
             jc = i;
         }
 
-        if(COMPLEX && i < nq - 1)
-            rocsolver_lacgv_template<T>(handle, nq - i - 1, A, shiftA + idx2D(i, i + 1, lda), lda,
-                                        strideA, batch_count);
-
         // insert one in A(i,i), i.e. the i-th element along the main diagonal,
         // to build/apply the householder matrix
         ROCSOLVER_LAUNCH_KERNEL(set_diag<T>, dim3(batch_count, 1, 1), dim3(1, 1, 1), 0, stream,
                                 diag, 0, 1, A, shiftA + idx2D(i, i, lda), lda, strideA, 1, true);
 
         // Apply current Householder reflector
+        // (the row of A holds the conjugate of the Householder vector, which LARF reads as such)
         rocsolver_larf_template(handle, side, nrow, ncol, A, shiftA + idx2D(i, i, lda), lda,
                                 strideA, (ipiv + i), strideP, C, shiftC + idx2D(ic, jc, ldc), ldc,
-                                strideC, batch_count, scalars, Abyx, workArr);
+                                strideC, batch_count, scalars, Abyx, workArr, true);
 
         // restore original value of A(i,i)
         ROCSOLVER_LAUNCH_KERNEL(restore_diag<T>, dim3(batch_count, 1, 1), dim3(1, 1, 1), 0, stream,
                                 diag, 0, 1, A, shiftA + idx2D(i, i, lda), lda, strideA, 1);
-
-        if(COMPLEX && i < nq - 1)
-            rocsolver_lacgv_template<T>(handle, nq - i - 1, A, shiftA + idx2D(i, i + 1, lda), lda,
-                                        strideA, batch_count);
     }
 
     // restore tau
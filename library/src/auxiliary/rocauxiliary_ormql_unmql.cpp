@@ -66,7 +66,7 @@ rocblas_status rocsolver_ormql_unmql_impl(rocblas_handle handle,
     rocblas_int batch_count = 1;
 
     // memory workspace sizes:
-    // size for constants in rocblas calls
+    // constants in rocblas calls (only whether they are needed, see set_device_scalars)
     size_t size_scalars;
     // extra requirements for calling ORM2R/UNM2R or LARFT + LARFB
     size_t size_AbyxORwork, size_diagORtmptr;
@@ -79,12 +79,12 @@ rocblas_status rocsolver_ormql_unmql_impl(rocblas_handle handle,
                                                   &size_workArr);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_AbyxORwork,
+        return rocblas_set_optimal_device_memory_size(handle, size_t(0), size_AbyxORwork,
                                                       size_diagORtmptr, size_trfact, size_workArr);
 
     // memory workspace allocation
     void *scalars, *AbyxORwork, *diagORtmptr, *trfact, *workArr;
-    rocblas_device_malloc mem(handle, size_scalars, size_AbyxORwork, size_diagORtmptr, size_trfact,
+    rocblas_device_malloc mem(handle, size_t(0), size_AbyxORwork, size_diagORtmptr, size_trfact,
                               size_workArr);
     if(!mem)
         return rocblas_status_memory_error;
@@ -95,7 +95,7 @@ rocblas_status rocsolver_ormql_unmql_impl(rocblas_handle handle,
     trfact = mem[3];
     workArr = mem[4];
     if(size_scalars > 0)
-        init_scalars(handle, (T*)scalars);
+        ROCBLAS_CHECK(set_device_scalars<T>(scalars));
 
     // execution
     return rocsolver_ormql_unmql_template<false, false, T>(
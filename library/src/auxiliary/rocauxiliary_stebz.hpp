@@ -458,11 +458,14 @@ ROCSOLVER_KERNEL void __launch_bounds__(STEBZ_SPLIT_THDS)
                                           eps, sfmin);
 }
 
-/** STEBZ_BISECTION implements the iterative bisection.
+/** STEBZ_BISECTION implements the iterative bisection (multisection when there are fewer
+    intervals than threads).
     Call the kernel with DIM_BLKS blocks in X and batch_count blocks in Y.
     Each thread-block is working with as many split-off blocks as needed to cover the entire
-    matrix in the batch. Each blocks has DIM_THDS threads in X. Each thread works with as many
-    non-converged intervals as needed on each iteration. **/
+    matrix in the batch. Each blocks has DIM_THDS threads in X. On each iteration, the threads
+    are distributed evenly among the intervals, and each one evaluates the Sturm count at one
+    point of its interval. Intervals that already converged are kept without further Sturm
+    counts. **/
 template <int DIM_BLKS, int DIM_THDS, typename T>
 __device__ void run_stebz_bisection(const int sbid,
                                     const int tid,
@@ -503,13 +506,23 @@ __device__ void run_stebz_bisection(const int sbid,
     // lc_ite counts the number of iterations in the bisection
     // and lc_maxite is the maximum number of iterations allowed
     int lc_ite, lc_maxite;
+    // lc_converged = true indicates that all the intervals in the block have converged
+    bool lc_converged;
     // lc_nofi is the number of intervals in active block at current iteration
     int lc_nofi;
 
+    // lc_m is the number of threads (and points) per interval in the multisection,
+    // and lc_ipi is the number of intervals divided at the same time
+    int lc_m, lc_ipi;
+    // new intervals produced by a thread (at most two)
+    T lc_inter[4];
+    rocblas_int lc_ninter[4];
+
     // other local temporary (helper) variables
     T gl, gu, tmp, bnorm;
     rocblas_int offset, offin, offout, nl, nu, ntmp;
-    int iid;
+    int iid, ip, nout;
+    bool active, converged;
 
     /*********** loop over independent split blocks ***********/
     for(int b = sbid; b < nofb; b += DIM_BLKS)
@@ -612,7 +625,8 @@ __device__ void run_stebz_bisection(const int sbid,
             /************************************************/
             /*********** Main iterative loop: ***************/
             /************************************************/
-            while(sh_computed && !sh_converged && lc_ite < lc_maxite)
+            lc_converged = false;
+            while(sh_computed && !lc_converged && lc_ite < lc_maxite)
             {
                 // start next iteration.
                 // (the first 2n elements of inter/ninter are used as inputs in even iterations,
@@ -620,15 +634,29 @@ __device__ void run_stebz_bisection(const int sbid,
                 lc_ite++;
                 offin = (lc_ite % 2) ? 2 * n + offset : offset;
                 offout = (lc_ite % 2) ? offset : 2 * n + offset;
+
+                // distribute the threads evenly among the intervals; the lc_m threads
+                // of an interval evaluate the Sturm count at lc_m equispaced points,
+                // dividing it into lc_m + 1 sub-intervals (multisection). With as many
+                // intervals as threads, lc_m = 1 and this is the usual bisection
+                lc_m = std::max(1, DIM_THDS / lc_nofi);
+                lc_ipi = DIM_THDS / lc_m;
                 if(tid == 0)
+                {
                     sh_nofi = 0; // to start accumulation of new number of intervals
+                    sh_converged = true;
+                }
+                __syncthreads();
 
                 // work with all intervals in parallel
-                for(int i = 0; i < lc_nofi; i += DIM_THDS)
+                for(int i = 0; i < lc_nofi; i += lc_ipi)
                 {
-                    iid = tid + i; //position of the interval in the split block
+                    iid = i + tid / lc_m; //position of the interval in the split block
+                    ip = tid % lc_m; //position of the point in the interval
+                    active = (tid / lc_m < lc_ipi && iid < lc_nofi);
+                    nout = 0;
 
-                    if(iid < lc_nofi)
+                    if(active)
                     {
                         //get interval information
                         gl = inter[offin + 2 * iid];
@@ -636,93 +664,97 @@ __device__ void run_stebz_bisection(const int sbid,
                         gu = inter[offin + 2 * iid + 1];
                         nu = ninter[offin + 2 * iid + 1];
 
-                        // bisect interval
-                        tmp = (gl + gu) / 2;
+                        // intervals that already converged are not divided any further
+                        bnorm = std::max(std::abs(gl), std::abs(gu));
+                        converged = (gu - gl < std::max(lc_tol, 2 * eps * bnorm));
 
-                        // number of eigenvalues less than the middle point
-                        ntmp = sturm_count(lc_bdim, (D + lc_bin), (Esqr + lc_bin), pmin, tmp);
-                        ntmp = std::min(nu, std::max(ntmp, nl));
-
-                        // re-compute interval; share new interval if necessary
-                        if(ntmp == nl)
+                        // number of eigenvalues less than the point
+                        tmp = gu;
+                        ntmp = nu;
+                        if(!converged)
                         {
-                            // no eigenvalues in lower half; adjust interval
-                            sh_newi[tid] = 0;
-                            sh_inter[4 * tid] = tmp;
-                            sh_ninter[4 * tid] = ntmp;
-                            sh_inter[4 * tid + 1] = gu;
-                            sh_ninter[4 * tid + 1] = nu;
+                            tmp = gl + (ip + 1) * ((gu - gl) / (lc_m + 1));
+                            ntmp = sturm_count(lc_bdim, (D + lc_bin), (Esqr + lc_bin), pmin, tmp);
+                            ntmp = std::min(nu, std::max(ntmp, nl));
                         }
-                        else if(ntmp == nu)
+                        sh_inter[tid] = tmp;
+                        sh_ninter[tid] = ntmp;
+                    }
+                    __syncthreads();
+
+                    if(active)
+                    {
+                        if(converged)
                         {
-                            // no eigenvalues in upper half; adjust interval
-                            sh_newi[tid] = 0;
-                            sh_inter[4 * tid] = gl;
-                            sh_ninter[4 * tid] = nl;
-                            sh_inter[4 * tid + 1] = tmp;
-                            sh_ninter[4 * tid + 1] = ntmp;
+                            // keep the interval as it is
+                            if(ip == 0)
+                            {
+                                nout = 1;
+                                lc_inter[0] = gl;
+                                lc_ninter[0] = nl;
+                                lc_inter[1] = gu;
+                                lc_ninter[1] = nu;
+                            }
                         }
                         else
                         {
-                            // eigenvalues in both halves; split interval
-                            sh_newi[tid] = 1;
-                            sh_inter[4 * tid] = gl;
-                            sh_ninter[4 * tid] = nl;
-                            sh_inter[4 * tid + 1] = tmp;
-                            sh_ninter[4 * tid + 1] = ntmp;
-                            sh_inter[4 * tid + 2] = tmp;
-                            sh_ninter[4 * tid + 2] = ntmp;
-                            sh_inter[4 * tid + 3] = gu;
-                            sh_ninter[4 * tid + 3] = nu;
+                            // keep the sub-intervals that contain eigenvalues:
+                            // [previous point, point], and [point, gu] for the last point
+                            if(ip > 0)
+                            {
+                                gl = sh_inter[tid - 1];
+                                nl = sh_ninter[tid - 1];
+                            }
+                            if(ntmp > nl)
+                            {
+                                lc_inter[0] = gl;
+                                lc_ninter[0] = nl;
+                                lc_inter[1] = tmp;
+                                lc_ninter[1] = ntmp;
+                                nout++;
+                            }
+                            if(ip == lc_m - 1 && nu > ntmp)
+                            {
+                                lc_inter[2 * nout] = tmp;
+                                lc_ninter[2 * nout] = ntmp;
+                                lc_inter[2 * nout + 1] = gu;
+                                lc_ninter[2 * nout + 1] = nu;
+                                nout++;
+                            }
                         }
                     }
+                    sh_newi[tid] = nout;
                     __syncthreads();
 
-                    if(iid < lc_nofi)
+                    // update main array with new intervals
+                    // in preparation for next iteration
+                    ntmp = sh_nofi;
+                    for(int j = 0; j < tid; ++j)
+                        ntmp += sh_newi[j];
+                    for(int j = 0; j < nout; ++j)
                     {
-                        // update main array with new intervals
-                        // in preparation for next iteration
-                        nu = 0;
-                        for(int j = 0; j < tid; ++j)
-                            nu += sh_newi[j];
-                        ntmp = 2 * (tid + sh_nofi + nu);
-
-                        inter[offout + ntmp] = sh_inter[4 * tid];
-                        ninter[offout + ntmp] = sh_ninter[4 * tid];
-                        inter[offout + ntmp + 1] = sh_inter[4 * tid + 1];
-                        ninter[offout + ntmp + 1] = sh_ninter[4 * tid + 1];
-                        if(sh_newi[tid])
-                        {
-                            inter[offout + ntmp + 2] = sh_inter[4 * tid + 2];
-                            ninter[offout + ntmp + 2] = sh_ninter[4 * tid + 2];
-                            inter[offout + ntmp + 3] = sh_inter[4 * tid + 3];
-                            ninter[offout + ntmp + 3] = sh_ninter[4 * tid + 3];
-                        }
+                        inter[offout + 2 * (ntmp + j)] = gl = lc_inter[2 * j];
+                        ninter[offout + 2 * (ntmp + j)] = lc_ninter[2 * j];
+                        inter[offout + 2 * (ntmp + j) + 1] = gu = lc_inter[2 * j + 1];
+                        ninter[offout + 2 * (ntmp + j) + 1] = lc_ninter[2 * j + 1];
+
+                        // check the interval's width
+                        bnorm = std::max(std::abs(gl), std::abs(gu));
+                        if(gu - gl >= std::max(lc_tol, 2 * eps * bnorm))
+                            sh_converged = false;
                     }
                     __syncthreads();
 
                     // update new number of intervals
-                    nl = std::min(lc_nofi - i, DIM_THDS); //number of active threads
-                    if(tid == nl - 1)
-                        sh_nofi += (nl + nu + sh_newi[tid]);
+                    if(tid == DIM_THDS - 1)
+                        sh_nofi = ntmp + nout;
                     __syncthreads();
-                } // ((((loop bisected all intervals in split block))))
+                } // ((((loop divided all intervals in split block))))
 
                 // set new number of intervals for next iteration
+                // (and sync before sh_nofi and sh_converged are reset)
                 lc_nofi = sh_nofi;
-
-                // check intervals' width and stop if converged
-                if(tid == 0)
-                {
-                    gl = sh_inter[0];
-                    gu = sh_inter[1];
-                    tmp = gu - gl;
-                    bnorm = std::max(std::abs(gl), std::abs(gu));
-
-                    if(tmp < std::max(lc_tol, 2 * eps * bnorm))
-                        sh_converged = true;
-                }
-
+                lc_converged = sh_converged;
                 __syncthreads();
             } // (((main loop implemented iterative bisection of split block)))
 
@@ -811,12 +843,12 @@ ROCSOLVER_KERNEL void __launch_bounds__(IBISEC_THDS)
     rocblas_int* tmpnev = tmpnevA + bid * n;
 
     // Shared arrays (sh_name):
-    // after each iteration, a thread that found a new interval will activate this flag
+    // after each iteration, every thread will set here the number of new intervals it found
     __shared__ int sh_newi[IBISEC_THDS];
-    // threads will share the newfound interval bounds and numbers of
-    // eigenvalues in these arrays:
-    __shared__ T sh_inter[4 * IBISEC_THDS];
-    __shared__ int sh_ninter[4 * IBISEC_THDS];
+    // threads will share the points they evaluated and the numbers of
+    // eigenvalues less than them in these arrays:
+    __shared__ T sh_inter[IBISEC_THDS];
+    __shared__ int sh_ninter[IBISEC_THDS];
 
     run_stebz_bisection<IBISEC_BLKS, IBISEC_THDS>(sbid, tid, range, n, abstol, D, E, nofb, W, IB,
                                                   IS, info, tmpnev, pmin, Esqr, bounds, inter,
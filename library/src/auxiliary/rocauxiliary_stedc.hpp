@@ -4,7 +4,7 @@
  *     Univ. of Tennessee, Univ. of California Berkeley,
  *     Univ. of Colorado Denver and NAG Ltd..
  *     December 2016
- * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions
@@ -37,6 +37,9 @@
 #include "rocauxiliary_sterf.hpp"
 #include "rocblas.hpp"
 #include "rocsolver/rocsolver.h"
+#include "rocsolver_diagnostics.hpp"
+
+#include <rocprim/rocprim.hpp>
 
 #include <algorithm>
 
@@ -860,21 +863,23 @@ ROCSOLVER_KERNEL void __launch_bounds__(STEDC_BDIM) stedc_divide_kernel(const ro
    be analysed in parallel). If there are actually more split-blocks, some
    groups will work with more than one split-block sequentially. **/
 template <typename S>
-ROCSOLVER_KERNEL void __launch_bounds__(STEDC_BDIM) stedc_solve_kernel(const rocblas_int n,
-                                                                       S* DD,
-                                                                       const rocblas_stride strideD,
-                                                                       S* EE,
-                                                                       const rocblas_stride strideE,
-                                                                       S* CC,
-                                                                       const rocblas_int shiftC,
-                                                                       const rocblas_int ldc,
-                                                                       const rocblas_stride strideC,
-                                                                       rocblas_int* iinfo,
-                                                                       S* WA,
-                                                                       rocblas_int* splitsA,
-                                                                       const S eps,
-                                                                       const S ssfmin,
-                                                                       const S ssfmax)
+ROCSOLVER_KERNEL void __launch_bounds__(STEDC_BDIM)
+    stedc_solve_kernel(const rocblas_int n,
+                       S* DD,
+                       const rocblas_stride strideD,
+                       S* EE,
+                       const rocblas_stride strideE,
+                       S* CC,
+                       const rocblas_int shiftC,
+                       const rocblas_int ldc,
+                       const rocblas_stride strideC,
+                       rocblas_int* iinfo,
+                       S* WA,
+                       rocblas_int* splitsA,
+                       const S eps,
+                       const S ssfmin,
+                       const S ssfmax,
+                       rocsolver_diagnostics* diagA = nullptr)
 {
     // threads and groups indices
     /* --------------------------------------------------- */
@@ -896,6 +901,7 @@ ROCSOLVER_KERNEL void __launch_bounds__(STEDC_BDIM) stedc_solve_kernel(const roc
     S* D = DD + bid * strideD;
     S* E = EE + bid * strideE;
     rocblas_int* info = iinfo + bid;
+    rocsolver_diagnostics* diag = diagA ? diagA + bid : nullptr;
     /* --------------------------------------------------- */
 
     // temporary arrays in global memory
@@ -959,12 +965,94 @@ ROCSOLVER_KERNEL void __launch_bounds__(STEDC_BDIM) stedc_solve_kernel(const roc
             // with each sub-block does computations)
             if(tidb == 0)
                 run_steqr(sbs, D + p2, E + p2, C + p2 + p2 * ldc, ldc, info, W + p2 * 2, 30 * bs,
-                          eps, ssfmin, ssfmax, false);
+                          eps, ssfmin, ssfmax, false, diag);
             __syncthreads();
         }
     }
 }
 
+//--------------------------------------------------------------------------------------//
+/** STEDC_SOLVE_QUEUE_KERNEL implements the solver phase of the DC algorithm with a work queue.
+   Every position j of every matrix in the batch is a task; if j is the index of a sub-block
+   within its split-block, the task solves that sub-block, otherwise it is skipped.
+        - Call this kernel with any number of single-thread groups in x. Each group takes
+   the next task from the global counter queue (that must be initialized to zero) until
+   the batch_count*n tasks are exhausted, so that the groups that finish small sub-blocks
+   continue with the sub-blocks of other matrices in the batch. **/
+template <typename S>
+ROCSOLVER_KERNEL void __launch_bounds__(STEDC_BDIM)
+    stedc_solve_queue_kernel(const rocblas_int n,
+                             S* DD,
+                             const rocblas_stride strideD,
+                             S* EE,
+                             const rocblas_stride strideE,
+                             S* CC,
+                             const rocblas_int shiftC,
+                             const rocblas_int ldc,
+                             const rocblas_stride strideC,
+                             rocblas_int* iinfo,
+                             S* WA,
+                             rocblas_int* splitsA,
+                             const S eps,
+                             const S ssfmin,
+                             const S ssfmax,
+                             const rocblas_int batch_count,
+                             rocblas_int* queue,
+                             rocsolver_diagnostics* diagA = nullptr)
+{
+    const int64_t ntasks = int64_t(batch_count) * n;
+
+    while(true)
+    {
+        // take the next task from the queue
+        rocblas_int t = atomicAdd(queue, 1);
+        if(t >= ntasks)
+            break;
+        rocblas_int bid = t / n;
+        rocblas_int j = t % n;
+
+        // select batch instance to work with
+        /* --------------------------------------------------- */
+        S* C = load_ptr_batch<S>(CC, bid, shiftC, strideC);
+        S* D = DD + bid * strideD;
+        S* E = EE + bid * strideE;
+        rocblas_int* info = iinfo + bid;
+        rocsolver_diagnostics* diag = diagA ? diagA + bid : nullptr;
+        rocblas_int* splits = splitsA + bid * (5 * n + 2);
+        rocblas_int* nsA = splits + n + 2;
+        rocblas_int* psA = nsA + n;
+        S* W = WA + bid * (2 * n);
+        /* --------------------------------------------------- */
+
+        // find the split block that contains position j
+        rocblas_int lo = 0;
+        rocblas_int hi = splits[n + 1];
+        while(hi - lo > 1)
+        {
+            rocblas_int mid = (lo + hi) / 2;
+            if(splits[mid] <= j)
+                lo = mid;
+            else
+                hi = mid;
+        }
+        rocblas_int p1 = splits[lo];
+        rocblas_int bs = splits[lo + 1] - p1;
+
+        // skip the task if j is not the index of a sub-block
+        rocblas_int levs = stedc_num_levels<rocsolver_stedc_mode_qr>(bs);
+        rocblas_int tid = j - p1;
+        if(tid >= (1 << levs))
+            continue;
+
+        // 2. SOLVE PHASE
+        /* ----------------------------------------------------------------- */
+        rocblas_int sbs = nsA[p1 + tid];
+        rocblas_int p2 = psA[p1 + tid];
+        run_steqr(sbs, D + p2, E + p2, C + p2 + p2 * ldc, ldc, info, W + p2 * 2, 30 * bs, eps,
+                  ssfmin, ssfmax, false, diag);
+    }
+}
+
 //--------------------------------------------------------------------------------------//
 /** STEDC_MERGEPREPARE_KERNEL performs deflation and prepares the secular equation for
     every pair of sub-blocks that need to be merged in a split block. A matrix in the batch
@@ -994,7 +1082,8 @@ ROCSOLVER_KERNEL void __launch_bounds__(STEDC_BDIM)
                               rocblas_int* splitsA,
                               const S eps,
                               const S ssfmin,
-                              const S ssfmax)
+                              const S ssfmax,
+                              rocsolver_diagnostics* diagA = nullptr)
 {
     // threads and groups indices
     /* --------------------------------------------------- */
@@ -1311,13 +1400,17 @@ ROCSOLVER_KERNEL void __launch_bounds__(STEDC_BDIM)
                     dd++;
                 }
             }
+
+            // record the number of deflated eigenvalues
+            if(iam == 0 && diagA)
+                diagnostics_add(diagA + bid, 0, sz - dd);
             /* ----------------------------------------------------------------- */
         }
     }
 }
 
 //--------------------------------------------------------------------------------------//
-/** STEDC_MERGEVALUES_KERNEL solves the secular equation for
+/** STEDC_MERGEVALUES_KERNEL orders the poles and sets up the secular equation for
     every pair of sub-blocks that need to be merged in a split block. A matrix in the batch
     could have many split-blocks, and each split-block could be divided in a maximum of nn sub-blocks.
         - Call this kernel with batch_count groups in z, STEDC_NUM_SPLIT_BLKS groups in y,
@@ -1401,7 +1494,6 @@ ROCSOLVER_KERNEL void __launch_bounds__(STEDC_BDIM)
     rocblas_int levs;
     // other aux variables
     rocblas_int tn;
-    S p;
     rocblas_int *ns, *ps;
     /* --------------------------------------------------- */
 
@@ -1428,12 +1520,12 @@ ROCSOLVER_KERNEL void __launch_bounds__(STEDC_BDIM)
         // 3. MERGE PHASE
         /* ----------------------------------------------------------------- */
         // Work with merges on level k. A thread-group works with two leaves in the merge tree;
-        // all threads work together to solve the secular equation.
+        // all threads work together to set up the secular equation. (The roots themselves
+        // are found by stedc_mergeRoots_kernel, with all the merges of the level together).
         if(mid < tn)
         {
             rocblas_int iam, sz, bdm, dim;
-            S* ptz;
-            S valf, valg;
+            S valf;
             rocblas_int bd = 1 << k;
             bdm = bd << 1;
             dim = hipBlockDim_x / bdm;
@@ -1445,22 +1537,6 @@ ROCSOLVER_KERNEL void __launch_bounds__(STEDC_BDIM)
             tid = mid * bdm + iam;
             p2 = ps[tid];
 
-            // Find off-diagonal element of the merge
-            if(iam < bd && tid < blks)
-            {
-                sz = ns[tid];
-                for(int j = 1; j < bd - iam; ++j)
-                    sz += ns[tid + j];
-                p = 2 * E[p2 - 1 + sz];
-            }
-            else if(iam >= bd && tid < blks)
-            {
-                sz = 0;
-                for(int j = 0; j < iam - bd; ++j)
-                    sz += ns[tid - j - 1];
-                p = 2 * E[p2 - sz - 1];
-            }
-
             // 3d.2. Organize data with non-deflated values to prepare secular equation
             /* ----------------------------------------------------------------- */
             // determine boundaries of what would be the new merged sub-block
@@ -1559,67 +1635,221 @@ ROCSOLVER_KERNEL void __launch_bounds__(STEDC_BDIM)
             // by the new computed eigenvalues of the merged block
             for(int i = iam; i < sz; i += bdm)
                 ev[i] = diag[i];
-            __syncthreads();
             /* ----------------------------------------------------------------- */
+        }
+    }
+}
 
-            // 3e. Solve secular eqns, i.e. find the dd zeros
-            // corresponding to non-deflated new eigenvalues of the merged block
-            /* ----------------------------------------------------------------- */
-            // each thread will find a different zero in parallel
-            S a, b;
-            for(int j = iam; j < sz; j += bdm)
-            {
-                if(mask[j] == 1)
-                {
-                    // find position in the ordered array
-                    int cc = 0;
-                    valf = p < 0 ? -ev[j] : ev[j];
-                    for(int jj = 0; jj < dd; ++jj)
-                    {
-                        if(tmpd[jj + j * n] == valf)
-                            break;
-                        else
-                            cc++;
-                    }
+//--------------------------------------------------------------------------------------//
+/** STEDC_MERGE_LOCATE finds the merge of level k that contains position j of the matrix.
+    It returns false if the split-block of j has no merges at level k; otherwise 'in' and 'sz'
+    are the initial position and size of the merged sub-block, and p is the off-diagonal
+    element (times 2) of the rank-1 modification. **/
+template <rocsolver_stedc_mode MODE, typename S>
+__device__ bool stedc_merge_locate(const rocblas_int k,
+                                   const rocblas_int n,
+                                   const rocblas_int j,
+                                   S* E,
+                                   rocblas_int* splits,
+                                   rocblas_int& in,
+                                   rocblas_int& sz,
+                                   S& p)
+{
+    rocblas_int* ns = splits + n + 2;
+    rocblas_int* ps = ns + n;
 
-                    // computed zero will overwrite 'ev' at the corresponding position.
-                    // 'tmpd' will be updated with the distances D - lambda_i.
-                    // deflated values are not changed.
-                    rocblas_int linfo;
-                    if(cc == dd - 1)
-                        linfo = seq_solve_ext(dd, tmpd + j * n, zz, (p < 0 ? -p : p), ev + j, eps,
-                                              ssfmin, ssfmax);
-                    else
-                        linfo = seq_solve(dd, tmpd + j * n, zz, (p < 0 ? -p : p), cc, ev + j, eps,
-                                          ssfmin, ssfmax);
-                    if(p < 0)
-                        ev[j] *= -1;
-                }
-            }
-            __syncthreads();
+    // find the split block that contains position j
+    rocblas_int lo = 0;
+    rocblas_int hi = splits[n + 1];
+    while(hi - lo > 1)
+    {
+        rocblas_int mid = (lo + hi) / 2;
+        if(splits[mid] <= j)
+            lo = mid;
+        else
+            hi = mid;
+    }
+    rocblas_int p1 = splits[lo];
+    rocblas_int bs = splits[lo + 1] - p1;
+    rocblas_int levs = stedc_num_levels<MODE>(bs);
+    if(k >= levs)
+        return false;
+    ns += p1;
+    ps += p1;
+
+    // find the sub-block that contains position j
+    lo = 0;
+    hi = 1 << levs;
+    while(hi - lo > 1)
+    {
+        rocblas_int mid = (lo + hi) / 2;
+        if(ps[mid] <= j)
+            lo = mid;
+        else
+            hi = mid;
+    }
 
-            // Re-scale vector Z to avoid bad numerics when an eigenvalue
-            // is too close to a pole
-            for(int i = iam; i < dd; i += bdm)
-            {
-                valf = 1;
-                for(int j = 0; j < sz; ++j)
-                {
-                    if(mask[j] == 1)
-                    {
-                        valg = tmpd[i + j * n];
-                        if(p > 0)
-                            valf *= (per[i] == j) ? valg : valg / (diag[per[i]] - diag[j]);
-                        else
-                            valf *= (per[i] == j) ? valg : -valg / (diag[per[i]] - diag[j]);
-                    }
-                }
-                valf = sqrt(-valf);
-                zz[i] = zz[i] < 0 ? -valf : valf;
-            }
-            /* ----------------------------------------------------------------- */
+    // first sub-block of the merge, and the merge points
+    rocblas_int bd = 1 << k;
+    rocblas_int tid = lo - lo % (2 * bd);
+    in = ps[tid];
+    sz = 0;
+    for(int i = 0; i < 2 * bd; ++i)
+        sz += ns[tid + i];
+    p = 2 * E[ps[tid + bd] - 1];
+
+    return true;
+}
+
+//--------------------------------------------------------------------------------------//
+/** STEDC_MERGEROOTS_KERNEL solves the secular equations of all the merges of level k.
+    Every position of every matrix in the batch is a task; the i-th position of a merged
+    sub-block finds the root of its secular equation next to the i-th ordered pole, so that
+    the deflated values are compacted out and the working threads of a merge are contiguous.
+        - Call this kernel with batch_count groups in z, and as many groups in x as
+          necessary to cover the n positions. Groups are size BS1.
+        - It must be called after STEDC_MERGEVALUES_KERNEL, that orders the poles. **/
+template <rocsolver_stedc_mode MODE, typename S>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) stedc_mergeRoots_kernel(const rocblas_int k,
+                                                                     const rocblas_int n,
+                                                                     S* DD,
+                                                                     const rocblas_stride strideD,
+                                                                     S* EE,
+                                                                     const rocblas_stride strideE,
+                                                                     S* tmpzA,
+                                                                     S* vecsA,
+                                                                     rocblas_int* splitsA,
+                                                                     const S eps,
+                                                                     const S ssfmin,
+                                                                     const S ssfmax)
+{
+    rocblas_int bid = hipBlockIdx_z;
+    rocblas_int j = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    if(j >= n)
+        return;
+
+    // select batch instance to work with
+    /* --------------------------------------------------- */
+    S* E = EE + bid * strideE;
+    rocblas_int* splits = splitsA + bid * (5 * n + 2);
+    rocblas_int* idd = splits + n + 2 + 2 * n;
+    rocblas_int* pers = idd + n;
+    S* z = tmpzA + bid * (2 * n);
+    S* evs = z + n;
+    S* temps = vecsA + bid * 2 * (n * n) + (n * n);
+    /* --------------------------------------------------- */
+
+    rocblas_int in, sz;
+    S p;
+    if(!stedc_merge_locate<MODE>(k, n, j, E, splits, in, sz, p))
+        return;
+
+    // find degree of secular equation
+    rocblas_int* mask = idd + in;
+    rocblas_int dd = 0;
+    for(int i = 0; i < sz; ++i)
+    {
+        if(mask[i] == 1)
+            dd++;
+    }
+
+    // cc is the position of the pole in the ordered array,
+    // and jj the position of the corresponding root in the merged sub-block
+    rocblas_int cc = j - in;
+    if(cc >= dd)
+        return;
+    rocblas_int jj = pers[in + cc];
+
+    // 3e. Solve secular eqns, i.e. find the dd zeros
+    // corresponding to non-deflated new eigenvalues of the merged block
+    /* ----------------------------------------------------------------- */
+    // computed zero will overwrite 'ev' at the corresponding position.
+    // 'tmpd' will be updated with the distances D - lambda_i.
+    // deflated values are not changed.
+    S* tmpd = temps + (in + jj) * n;
+    S* ev = evs + in + jj;
+    S* zz = z + in;
+    rocblas_int linfo;
+    if(cc == dd - 1)
+        linfo = seq_solve_ext(dd, tmpd, zz, (p < 0 ? -p : p), ev, eps, ssfmin, ssfmax);
+    else
+        linfo = seq_solve(dd, tmpd, zz, (p < 0 ? -p : p), cc, ev, eps, ssfmin, ssfmax);
+    if(p < 0)
+        ev[0] *= -1;
+    /* ----------------------------------------------------------------- */
+}
+
+//--------------------------------------------------------------------------------------//
+/** STEDC_MERGERESCALE_KERNEL re-scales the rank-1 modification vectors of all the merges
+    of level k, to avoid bad numerics when an eigenvalue is too close to a pole.
+        - Call this kernel with batch_count groups in z, and as many groups in x as
+          necessary to cover the n positions. Groups are size BS1.
+        - It must be called after STEDC_MERGEROOTS_KERNEL. **/
+template <rocsolver_stedc_mode MODE, typename S>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) stedc_mergeRescale_kernel(const rocblas_int k,
+                                                                       const rocblas_int n,
+                                                                       S* DD,
+                                                                       const rocblas_stride strideD,
+                                                                       S* EE,
+                                                                       const rocblas_stride strideE,
+                                                                       S* tmpzA,
+                                                                       S* vecsA,
+                                                                       rocblas_int* splitsA)
+{
+    rocblas_int bid = hipBlockIdx_z;
+    rocblas_int j = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    if(j >= n)
+        return;
+
+    // select batch instance to work with
+    /* --------------------------------------------------- */
+    S* D = DD + bid * strideD;
+    S* E = EE + bid * strideE;
+    rocblas_int* splits = splitsA + bid * (5 * n + 2);
+    rocblas_int* idd = splits + n + 2 + 2 * n;
+    rocblas_int* pers = idd + n;
+    S* z = tmpzA + bid * (2 * n);
+    S* temps = vecsA + bid * 2 * (n * n) + (n * n);
+    /* --------------------------------------------------- */
+
+    rocblas_int in, sz;
+    S p;
+    if(!stedc_merge_locate<MODE>(k, n, j, E, splits, in, sz, p))
+        return;
+
+    // define shifted arrays
+    S* tmpd = temps + in * n;
+    S* diag = D + in;
+    rocblas_int* mask = idd + in;
+    S* zz = z + in;
+    rocblas_int* per = pers + in;
+
+    // find degree of secular equation
+    rocblas_int dd = 0;
+    for(int i = 0; i < sz; ++i)
+    {
+        if(mask[i] == 1)
+            dd++;
+    }
+
+    rocblas_int i = j - in;
+    if(i >= dd)
+        return;
+
+    S valf = 1, valg;
+    for(int jj = 0; jj < sz; ++jj)
+    {
+        if(mask[jj] == 1)
+        {
+            valg = tmpd[i + jj * n];
+            if(p > 0)
+                valf *= (per[i] == jj) ? valg : valg / (diag[per[i]] - diag[jj]);
+            else
+                valf *= (per[i] == jj) ? valg : -valg / (diag[per[i]] - diag[jj]);
         }
     }
+    valf = sqrt(-valf);
+    zz[i] = zz[i] < 0 ? -valf : valf;
 }
 
 //--------------------------------------------------------------------------------------//
@@ -2027,63 +2257,208 @@ ROCSOLVER_KERNEL void __launch_bounds__(STEDC_BDIM)
     }
 }
 
-/** STEDC_SORT sorts computed eigenvalues and eigenvectors in increasing order **/
+/** STEDC_COPY_VECTORS copies the real n-by-n matrix of eigenvectors B into C (real or complex).
+    It is used instead of C <- C*B when C is the identity (evect = tridiagonal). If map is
+    not null, the columns are permuted as given by stedc_sort_values (column j of C is
+    column map[j] of B).
+        - Call this kernel with batch_count groups in z, and enough groups in x and y to
+    cover the n-by-n matrix. **/
 template <typename T, typename S, typename U>
-ROCSOLVER_KERNEL void __launch_bounds__(BS1) stedc_sort(const rocblas_int n,
-                                                        S* DD,
-                                                        const rocblas_stride strideD,
-                                                        U CC,
-                                                        const rocblas_int shiftC,
-                                                        const rocblas_int ldc,
-                                                        const rocblas_stride strideC,
-                                                        const rocblas_int batch_count,
-                                                        rocblas_int* work,
-                                                        rocblas_int* nev = nullptr)
+ROCSOLVER_KERNEL void stedc_copy_vectors(const rocblas_int n,
+                                         S* BB,
+                                         const rocblas_int ldb,
+                                         const rocblas_stride strideB,
+                                         U CC,
+                                         const rocblas_int shiftC,
+                                         const rocblas_int ldc,
+                                         const rocblas_stride strideC,
+                                         const rocblas_int* map = nullptr)
 {
-    // -----------------------------------
-    // use z-grid dimension as batch index
-    // -----------------------------------
-    rocblas_int bid_start = hipBlockIdx_z;
-    rocblas_int bid_inc = hipGridDim_z;
+    const auto b = hipBlockIdx_z;
+    const auto j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+    const auto i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
 
-    int tid = hipThreadIdx_x;
+    if(i < n && j < n)
+    {
+        T* C = load_ptr_batch<T>(CC, b, shiftC, strideC);
+        S* B = BB + b * strideB;
+        const rocblas_int jj = map ? map[b * n + j] : j;
 
-    rocblas_int* const map = work + bid_start * ((int64_t)n);
+        C[i + j * ldc] = T(B[i + jj * ldb]);
+    }
+}
 
-    for(auto bid = bid_start; bid < batch_count; bid += bid_inc)
+/** STEDC_GATHER_VECTORS copies the real n-by-n matrix B into A (the real or imaginary part
+    of A if it is complex), permuting the columns as given by stedc_sort_values (column j of
+    A is column map[j] of B). It is used to sort the eigenvectors while overwriting
+    A with A*B.
+        - Call this kernel with batch_count groups in z, and enough groups in x and y to
+    cover the n-by-n matrix. **/
+template <typename T, typename S, bool REAL, typename U>
+ROCSOLVER_KERNEL void stedc_gather_vectors(const rocblas_int n,
+                                           U AA,
+                                           const rocblas_int shiftA,
+                                           const rocblas_int lda,
+                                           const rocblas_stride strideA,
+                                           S* BB,
+                                           const rocblas_int ldb,
+                                           const rocblas_stride strideB,
+                                           const rocblas_int* map)
+{
+    const auto b = hipBlockIdx_z;
+    const auto j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+    const auto i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(i < n && j < n)
     {
-        // ---------------------------------------------
-        // select batch instance to work with
-        // (avoiding arithmetics with possible nullptrs)
-        // ---------------------------------------------
-        T* C = nullptr;
-        if(CC)
-            C = load_ptr_batch<T>(CC, bid, shiftC, strideC);
-        S* D = DD + (bid * strideD);
-        rocblas_int nn;
-        if(nev)
-            nn = nev[bid];
+        T* A = load_ptr_batch<T>(AA, b, shiftA, strideA);
+        S* B = BB + b * strideB;
+        const rocblas_int jj = map ? map[b * n + j] : j;
+        const S v = B[i + jj * ldb];
+
+        if constexpr(!rocblas_is_complex<T>)
+            A[i + j * lda] = v;
+        else if(REAL)
+            A[i + j * lda] = rocblas_complex_num<S>(v, A[i + j * lda].imag());
         else
-            nn = n;
+            A[i + j * lda] = rocblas_complex_num<S>(A[i + j * lda].real(), v);
+    }
+}
 
-        bool constexpr use_shell_sort = true;
+/** STEDC_SORT_PREPARE copies the eigenvalues of every batch instance into the contiguous
+    sorting buffer keys, and initializes map with the identity permutation.
+        - Call this kernel with batch_count groups in z, and enough groups in x to cover the
+    n eigenvalues. **/
+template <typename S>
+ROCSOLVER_KERNEL void stedc_sort_prepare(const rocblas_int n,
+                                         S* DD,
+                                         const rocblas_stride strideD,
+                                         S* keys,
+                                         rocblas_int* map)
+{
+    const auto b = hipBlockIdx_z;
+    const auto i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
 
-        __syncthreads();
+    if(i < n)
+    {
+        keys[b * n + i] = DD[b * strideD + i];
+        map[b * n + i] = i;
+    }
+}
 
-        if(use_shell_sort)
-            shell_sort(nn, D, map);
-        else
-            selection_sort(nn, D, map);
-        __syncthreads();
+/** STEDC_SORT_FINISH copies the first nev[b] sorted eigenvalues (or all of them if nev is
+    null) back into D.
+        - Call this kernel with batch_count groups in z, and enough groups in x to cover the
+    n eigenvalues. **/
+template <typename S>
+ROCSOLVER_KERNEL void stedc_sort_finish(const rocblas_int n,
+                                        S* DD,
+                                        const rocblas_stride strideD,
+                                        const rocblas_int* nev,
+                                        S* keys)
+{
+    const auto b = hipBlockIdx_z;
+    const auto i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const rocblas_int nn = nev ? nev[b] : n;
 
-        permute_swap(n, C, ldc, map, nn);
-        __syncthreads();
-    }
+    if(i < nn)
+        DD[b * strideD + i] = keys[b * n + i];
 }
 
 /******************* Host functions *********************************************/
 /*******************************************************************************/
 
+//--------------------------------------------------------------------------------------//
+/** These functors give the segments of the sorting buffers (the first and one past the last
+    position of the eigenvalues of every batch instance), and the original index of every
+    sorted element, to the segmented sort of stedc_sort_values **/
+struct stedc_sort_offsets
+{
+    rocblas_int n;
+    const rocblas_int* nev;
+    bool end;
+
+    __host__ __device__ rocblas_int operator()(const rocblas_int b) const
+    {
+        return b * n + (end ? (nev ? nev[b] : n) : 0);
+    }
+};
+
+struct stedc_sort_index
+{
+    rocblas_int n;
+
+    __host__ __device__ rocblas_int operator()(const rocblas_int k) const
+    {
+        return k % n;
+    }
+};
+
+/** This helper calls (or queries the temporary storage of) the segmented radix sort
+    that sorts the eigenvalues of all the batch instances at once **/
+template <typename S>
+hipError_t stedc_segmented_sort(void* storage,
+                                size_t& storage_size,
+                                const rocblas_int n,
+                                const rocblas_int* nev,
+                                const rocblas_int batch_count,
+                                S* keys,
+                                rocblas_int* map,
+                                hipStream_t stream = 0)
+{
+    auto index = rocprim::make_transform_iterator(rocprim::make_counting_iterator<rocblas_int>(0),
+                                                  stedc_sort_index{n});
+    auto begin = rocprim::make_transform_iterator(rocprim::make_counting_iterator<rocblas_int>(0),
+                                                  stedc_sort_offsets{n, nev, false});
+    auto end = rocprim::make_transform_iterator(rocprim::make_counting_iterator<rocblas_int>(0),
+                                                stedc_sort_offsets{n, nev, true});
+
+    S* keys_out = keys ? keys + size_t(n) * batch_count : nullptr;
+    return rocprim::segmented_radix_sort_pairs(storage, storage_size, keys, keys_out, index, map,
+                                               n * batch_count, batch_count, begin, end, 0,
+                                               8 * sizeof(S), stream);
+}
+
+/** This helper returns the size of the temporary storage of stedc_sort_values **/
+template <typename S>
+size_t stedc_sort_values_storage(const rocblas_int n, const rocblas_int batch_count)
+{
+    size_t size = 0;
+    stedc_segmented_sort<S>(nullptr, size, n, nullptr, batch_count, nullptr, nullptr);
+    return size;
+}
+
+/** STEDC_SORT_VALUES sorts the eigenvalues of all the batch instances in increasing order
+    with a single segmented radix sort, and returns in map the permutation to apply to the
+    eigenvectors (the eigenvalue in position j of batch instance b was originally in position
+    map[b * n + j]). If nev is not null, only the first nev[b] eigenvalues are sorted.
+    The sorting buffers keys and map must have size 2 * n * batch_count and n * batch_count,
+    respectively. **/
+template <typename S>
+rocblas_status stedc_sort_values(hipStream_t stream,
+                                 const rocblas_int n,
+                                 S* D,
+                                 const rocblas_stride strideD,
+                                 const rocblas_int* nev,
+                                 const rocblas_int batch_count,
+                                 S* keys,
+                                 rocblas_int* map,
+                                 void* storage,
+                                 size_t storage_size)
+{
+    rocblas_int blocks = (n - 1) / BS1 + 1;
+    ROCSOLVER_LAUNCH_KERNEL(stedc_sort_prepare<S>, dim3(blocks, 1, batch_count), dim3(BS1), 0,
+                            stream, n, D, strideD, keys, map);
+
+    HIP_CHECK(stedc_segmented_sort<S>(storage, storage_size, n, nev, batch_count, keys, map,
+                                      stream));
+
+    ROCSOLVER_LAUNCH_KERNEL(stedc_sort_finish<S>, dim3(blocks, 1, batch_count), dim3(BS1), 0,
+                            stream, n, D, strideD, nev, keys + size_t(n) * batch_count);
+
+    return rocblas_status_success;
+}
+
 //--------------------------------------------------------------------------------------//
 /** This local gemm adapts rocblas_gemm to multiply complex*real, and
     overwrite result: A = A*B **/
@@ -2106,9 +2481,11 @@ void local_gemm(rocblas_handle handle,
                 const rocblas_int ldt,
                 const rocblas_stride strideT,
                 const rocblas_int batch_count,
-                S** workArr)
+                S** workArr,
+                const rocblas_int* map = nullptr)
 {
     // Execute A*B -> temp -> A
+    // (if map is not null, the columns are permuted when copying temp back into A)
 
     // everything must be executed with scalars on the host
     rocblas_pointer_mode old_mode;
@@ -2126,8 +2503,9 @@ void local_gemm(rocblas_handle handle,
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
     rocblas_int blocks = (n - 1) / BS2 + 1;
-    ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, dim3(blocks, blocks, batch_count), dim3(BS2, BS2), 0,
-                            stream, copymat_from_buffer, n, n, A, shiftA, lda, strideA, temp);
+    ROCSOLVER_LAUNCH_KERNEL((stedc_gather_vectors<T, S, true>), dim3(blocks, blocks, batch_count),
+                            dim3(BS2, BS2), 0, stream, n, A, shiftA, lda, strideA, temp + shiftT,
+                            ldt, strideT, map);
 
     rocblas_set_pointer_mode(handle, old_mode);
 }
@@ -2151,9 +2529,11 @@ void local_gemm(rocblas_handle handle,
                 const rocblas_int ldt,
                 const rocblas_stride strideT,
                 const rocblas_int batch_count,
-                S** workArr)
+                S** workArr,
+                const rocblas_int* map = nullptr)
 {
     // Execute A -> work; work*B -> temp -> A
+    // (if map is not null, the columns are permuted when copying temp back into A)
 
     // everything must be executed with scalars on the host
     rocblas_pointer_mode old_mode;
@@ -2176,9 +2556,9 @@ void local_gemm(rocblas_handle handle,
                      strideT, batch_count, workArr);
 
     // real(A) = temp
-    ROCSOLVER_LAUNCH_KERNEL((copy_mat<T, S, true>), dim3(blocks, blocks, batch_count),
-                            dim3(BS2, BS2), 0, stream, copymat_from_buffer, n, n, A, shiftA, lda,
-                            strideA, temp, rocblas_fill_full);
+    ROCSOLVER_LAUNCH_KERNEL((stedc_gather_vectors<T, S, true>), dim3(blocks, blocks, batch_count),
+                            dim3(BS2, BS2), 0, stream, n, A, shiftA, lda, strideA, temp + shiftT,
+                            ldt, strideT, map);
 
     // work = imag(A)
     ROCSOLVER_LAUNCH_KERNEL((copy_mat<T, S, false>), dim3(blocks, blocks, batch_count),
@@ -2191,9 +2571,9 @@ void local_gemm(rocblas_handle handle,
                      strideT, batch_count, workArr);
 
     // imag(A) = temp
-    ROCSOLVER_LAUNCH_KERNEL((copy_mat<T, S, false>), dim3(blocks, blocks, batch_count),
-                            dim3(BS2, BS2), 0, stream, copymat_from_buffer, n, n, A, shiftA, lda,
-                            strideA, temp, rocblas_fill_full);
+    ROCSOLVER_LAUNCH_KERNEL((stedc_gather_vectors<T, S, false>), dim3(blocks, blocks, batch_count),
+                            dim3(BS2, BS2), 0, stream, n, A, shiftA, lda, strideA, temp + shiftT,
+                            ldt, strideT, map);
 
     rocblas_set_pointer_mode(handle, old_mode);
 }
@@ -2250,14 +2630,16 @@ void rocsolver_stedc_getMemorySize(const rocblas_evect evect,
     // otherwise use divide and conquer algorithm:
     else
     {
-        size_t s1, s2;
+        size_t s1, s2, s3;
 
         // requirements for solver of small independent blocks
         rocsolver_steqr_getMemorySize<T, S>(evect, n, batch_count, &s1);
 
         // extra requirements for original eigenvectors of small independent blocks
         *size_tempvect = (n * n) * batch_count * sizeof(S);
-        *size_tempgemm = 2 * (n * n) * batch_count * sizeof(S);
+        // (the second half of tempgemm also holds the temporary storage of the final sort)
+        s3 = (n * n) * batch_count * sizeof(S) + stedc_sort_values_storage<S>(n, batch_count);
+        *size_tempgemm = std::max(2 * (n * n) * batch_count * sizeof(S), s3);
         if(COMPLEX)
             s2 = n * n * batch_count * sizeof(S);
         else
@@ -2269,7 +2651,8 @@ void rocsolver_stedc_getMemorySize(const rocblas_evect evect,
         *size_work_stack = std::max(s1, s2);
 
         // size for split blocks and sub-blocks positions
-        *size_splits_map = sizeof(rocblas_int) * (5 * n + 2) * batch_count;
+        // (plus the counter of the work queue of the solver phase)
+        *size_splits_map = sizeof(rocblas_int) * ((5 * n + 2) * batch_count + 1);
 
         // size for temporary diagonal and rank-1 modif vector
         *size_tmpz = sizeof(S) * (2 * n) * batch_count;
@@ -2356,6 +2739,11 @@ rocblas_status rocsolver_stedc_template(rocblas_handle handle,
     // info = 0
     ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, info, batch_count, 0);
 
+    // diagnostics = 0
+    // (when sterf or steqr are used, they record their own diagnostics)
+    rocsolver_diagnostics* diag = get_diagnostics(handle, batch_count);
+    diagnostics_reset<T>(stream, diag, batch_count);
+
     // quick return
     if(n == 1 && evect != rocblas_evect_none)
         ROCSOLVER_LAUNCH_KERNEL(reset_batch_info<T>, dim3(1, batch_count), dim3(1, 1), 0, stream, C,
@@ -2388,11 +2776,6 @@ rocblas_status rocsolver_stedc_template(rocblas_handle handle,
         ssfmax = sqrt(ssfmax) / S(3.0);
         rocblas_int blocksn = (n - 1) / BS2 + 1;
 
-        // initialize identity matrix in C if required
-        if(evect == rocblas_evect_tridiagonal)
-            ROCSOLVER_LAUNCH_KERNEL(init_ident<T>, dim3(blocksn, blocksn, batch_count),
-                                    dim3(BS2, BS2), 0, stream, n, n, C, shiftC, ldc, strideC);
-
         // initialize identity matrix in tempvect
         rocblas_int ldt = n;
         rocblas_stride strideT = n * n;
@@ -2404,6 +2787,7 @@ rocblas_status rocsolver_stedc_template(rocblas_handle handle,
         rocblas_int maxblks = 1 << maxlevs;
 
         // find independent split blocks in matrix
+        diagnostics_mark<T>(stream, diag, batch_count, 0, true);
         ROCSOLVER_LAUNCH_KERNEL(stedc_split, dim3(batch_count), dim3(1), 0, stream, n, D + shiftD,
                                 strideD, E + shiftE, strideE, splits_map, eps);
 
@@ -2415,16 +2799,32 @@ rocblas_status rocsolver_stedc_template(rocblas_handle handle,
 
         // 2. solve phase
         //-----------------------------
-        ROCSOLVER_LAUNCH_KERNEL((stedc_solve_kernel<S>),
-                                dim3(maxblks, STEDC_NUM_SPLIT_BLKS, batch_count), dim3(1), 0,
-                                stream, n, D + shiftD, strideD, E + shiftE, strideE, tempvect, 0,
-                                ldt, strideT, info, (S*)work_stack, splits, eps, ssfmin, ssfmax);
+        if(batch_count >= STEDC_QUEUE_MIN_BATCH)
+        {
+            // (sub-blocks are handed to the groups as they become free)
+            rocblas_int* queue = splits + size_t(5 * n + 2) * batch_count;
+            rocblas_int ngrps = std::min(int64_t(STEDC_QUEUE_GROUPS), int64_t(n) * batch_count);
+            HIP_CHECK(hipMemsetAsync(queue, 0, sizeof(rocblas_int), stream));
+            ROCSOLVER_LAUNCH_KERNEL((stedc_solve_queue_kernel<S>), dim3(ngrps), dim3(1), 0, stream,
+                                    n, D + shiftD, strideD, E + shiftE, strideE, tempvect, 0, ldt,
+                                    strideT, info, (S*)work_stack, splits, eps, ssfmin, ssfmax,
+                                    batch_count, queue, diag);
+        }
+        else
+            ROCSOLVER_LAUNCH_KERNEL((stedc_solve_kernel<S>),
+                                    dim3(maxblks, STEDC_NUM_SPLIT_BLKS, batch_count), dim3(1), 0,
+                                    stream, n, D + shiftD, strideD, E + shiftE, strideE, tempvect,
+                                    0, ldt, strideT, info, (S*)work_stack, splits, eps, ssfmin,
+                                    ssfmax, diag);
+        diagnostics_mark<T>(stream, diag, batch_count, 0, false);
 
         // 3. merge phase
         //----------------
+        diagnostics_mark<T>(stream, diag, batch_count, 1, true);
         size_t lmemsize1 = sizeof(S) * maxblks;
         size_t lmemsize3 = sizeof(S) * STEDC_BDIM;
         rocblas_int numgrps3 = ((n - 1) / maxblks + 1) * maxblks;
+        rocblas_int blocksr = (n - 1) / BS1 + 1;
 
         // launch merge for level k
         /** TODO: using max number of levels for now. Kernels return immediately when passing
@@ -2437,7 +2837,7 @@ rocblas_status rocsolver_stedc_template(rocblas_handle handle,
                                     dim3(1, STEDC_NUM_SPLIT_BLKS, batch_count), dim3(maxblks),
                                     lmemsize1, stream, k, n, D + shiftD, strideD, E + shiftE,
                                     strideE, tempvect, 0, ldt, strideT, tmpz, tempgemm, splits, eps,
-                                    ssfmin, ssfmax);
+                                    ssfmin, ssfmax, diag);
 
             // b. solve to find merged eigen values
             rocblas_int numgrps2 = 1 << (maxlevs - 1 - k);
@@ -2446,6 +2846,16 @@ rocblas_status rocsolver_stedc_template(rocblas_handle handle,
                                     dim3(STEDC_BDIM), 0, stream, k, n, D + shiftD, strideD,
                                     E + shiftE, strideE, tmpz, tempgemm, splits, eps, ssfmin, ssfmax);
 
+            // (the roots of all the merges of the level are scheduled together)
+            ROCSOLVER_LAUNCH_KERNEL((stedc_mergeRoots_kernel<rocsolver_stedc_mode_qr, S>),
+                                    dim3(blocksr, 1, batch_count), dim3(BS1), 0, stream, k, n,
+                                    D + shiftD, strideD, E + shiftE, strideE, tmpz, tempgemm,
+                                    splits, eps, ssfmin, ssfmax);
+            ROCSOLVER_LAUNCH_KERNEL((stedc_mergeRescale_kernel<rocsolver_stedc_mode_qr, S>),
+                                    dim3(blocksr, 1, batch_count), dim3(BS1), 0, stream, k, n,
+                                    D + shiftD, strideD, E + shiftE, strideE, tmpz, tempgemm,
+                                    splits);
+
             // c. find merged eigen vectors
             ROCSOLVER_LAUNCH_KERNEL((stedc_mergeVectors_kernel<rocsolver_stedc_mode_qr, S>),
                                     dim3(numgrps3, STEDC_NUM_SPLIT_BLKS, batch_count),
@@ -2460,19 +2870,29 @@ rocblas_status rocsolver_stedc_template(rocblas_handle handle,
                                     tempvect, 0, ldt, strideT, tmpz, tempgemm, splits, eps, ssfmin,
                                     ssfmax);
         }
+        diagnostics_mark<T>(stream, diag, batch_count, 1, false);
 
-        // 4. update and sort
+        // 4. sort and update
         //----------------------
-        // eigenvectors C <- C*tempvect
-        local_gemm<BATCHED, STRIDED, T>(handle, n, C, shiftC, ldc, strideC, tempvect, tempgemm,
-                                        static_cast<S*>(work_stack), 0, ldt, strideT, batch_count,
-                                        workArr);
-
-        // finally sort eigenvalues and eigenvectors
-        auto const nblocks = batch_count;
-        ROCSOLVER_LAUNCH_KERNEL((stedc_sort<T>), dim3(1, 1, nblocks), dim3(BS1), 0, stream, n,
-                                D + shiftD, strideD, C, shiftC, ldc, strideC, batch_count,
-                                splits_map);
+        diagnostics_mark<T>(stream, diag, batch_count, 2, true);
+        // sort eigenvalues
+        // (the merged vectors in tmpz are no longer needed, and the sort storage follows the
+        // part of tempgemm used by local_gemm)
+        size_t sizeT = size_t(n) * n * batch_count;
+        stedc_sort_values<S>(stream, n, D + shiftD, strideD, nullptr, batch_count, tmpz, splits_map,
+                             tempgemm + sizeT, sizeT * sizeof(S));
+
+        // eigenvectors C <- C*tempvect, sorted as the eigenvalues
+        // (if C would be the identity, the real eigenvectors are copied directly)
+        if(evect == rocblas_evect_tridiagonal)
+            ROCSOLVER_LAUNCH_KERNEL((stedc_copy_vectors<T>), dim3(blocksn, blocksn, batch_count),
+                                    dim3(BS2, BS2), 0, stream, n, tempvect, ldt, strideT, C,
+                                    shiftC, ldc, strideC, splits_map);
+        else
+            local_gemm<BATCHED, STRIDED, T>(handle, n, C, shiftC, ldc, strideC, tempvect,
+                                            tempgemm, static_cast<S*>(work_stack), 0, ldt,
+                                            strideT, batch_count, workArr, splits_map);
+        diagnostics_mark<T>(stream, diag, batch_count, 2, false);
     }
 
     return rocblas_status_success;
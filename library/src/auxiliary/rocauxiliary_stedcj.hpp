@@ -1,5 +1,5 @@
 /************************************************************************
- * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ * Copyright (C) 2024-2025 Advanced Micro Devices, Inc. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions
@@ -308,14 +308,16 @@ void rocsolver_stedcj_getMemorySize(const rocblas_evect evect,
         return;
     }
 
-    size_t s1, s2;
+    size_t s1, s2, s3;
 
     // requirements for solver of small independent blocks
     s1 = sizeof(S) * (n * n + 2) * batch_count;
 
     // extra requirements for original eigenvectors of small independent blocks
     *size_tempvect = (n * n) * batch_count * sizeof(S);
-    *size_tempgemm = 2 * (n * n) * batch_count * sizeof(S);
+    // (the second half of tempgemm also holds the temporary storage of the final sort)
+    s3 = (n * n) * batch_count * sizeof(S) + stedc_sort_values_storage<S>(n, batch_count);
+    *size_tempgemm = std::max(2 * (n * n) * batch_count * sizeof(S), s3);
     if(COMPLEX)
         s2 = n * n * batch_count * sizeof(S);
     else
@@ -429,6 +431,7 @@ rocblas_status rocsolver_stedcj_template(rocblas_handle handle,
     size_t lmemsize1 = sizeof(S) * maxblks;
     size_t lmemsize3 = sizeof(S) * STEDC_BDIM;
     rocblas_int numgrps3 = ((n - 1) / maxblks + 1) * maxblks;
+    rocblas_int blocksr = (n - 1) / BS1 + 1;
 
     // launch merge for level k
     /** TODO: using max number of levels for now. Kernels return immediately when passing
@@ -449,6 +452,15 @@ rocblas_status rocsolver_stedcj_template(rocblas_handle handle,
                                 0, stream, k, n, D, strideD, E, strideE, tmpz, tempgemm, splits_map,
                                 eps, ssfmin, ssfmax);
 
+        // (the roots of all the merges of the level are scheduled together)
+        ROCSOLVER_LAUNCH_KERNEL((stedc_mergeRoots_kernel<rocsolver_stedc_mode_jacobi, S>),
+                                dim3(blocksr, 1, batch_count), dim3(BS1), 0, stream, k, n, D,
+                                strideD, E, strideE, tmpz, tempgemm, splits_map, eps, ssfmin,
+                                ssfmax);
+        ROCSOLVER_LAUNCH_KERNEL((stedc_mergeRescale_kernel<rocsolver_stedc_mode_jacobi, S>),
+                                dim3(blocksr, 1, batch_count), dim3(BS1), 0, stream, k, n, D,
+                                strideD, E, strideE, tmpz, tempgemm, splits_map);
+
         // c. find merged eigen vectors
         ROCSOLVER_LAUNCH_KERNEL((stedc_mergeVectors_kernel<rocsolver_stedc_mode_jacobi, S>),
                                 dim3(numgrps3, STEDC_NUM_SPLIT_BLKS, batch_count), dim3(STEDC_BDIM),
@@ -462,15 +474,18 @@ rocblas_status rocsolver_stedcj_template(rocblas_handle handle,
                                 tmpz, tempgemm, splits_map, eps, ssfmin, ssfmax);
     }
 
-    // 4. update and sort
+    // 4. sort and update
     //----------------------
-    // eigenvectors C <- C*tempvect
+    // sort eigenvalues
+    // (the sort storage follows the part of tempgemm used by local_gemm)
+    size_t sizeT = size_t(n) * n * batch_count;
+    stedc_sort_values<S>(stream, n, D, strideD, nullptr, batch_count, tmpz, splits_map,
+                         tempgemm + sizeT, sizeT * sizeof(S));
+
+    // eigenvectors C <- C*tempvect, sorted as the eigenvalues
     local_gemm<BATCHED, STRIDED, T>(handle, n, C, shiftC, ldc, strideC, tempvect, tempgemm,
                                     static_cast<S*>(work_stack), 0, ldt, strideT, batch_count,
-                                    workArr);
-
-    ROCSOLVER_LAUNCH_KERNEL((stedc_sort<T>), dim3(1, 1, batch_count), dim3(BS1), 0, stream, n, D,
-                            strideD, C, shiftC, ldc, strideC, batch_count, splits_map);
+                                    workArr, splits_map);
 
     return rocblas_status_success;
 }
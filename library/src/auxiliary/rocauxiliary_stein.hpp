@@ -35,6 +35,7 @@
 #include "lapack_device_functions.hpp"
 #include "rocblas.hpp"
 #include "rocsolver/rocsolver.h"
+#include "rocsolver_diagnostics.hpp"
 
 ROCSOLVER_BEGIN_NAMESPACE
 
@@ -46,48 +47,203 @@ ROCSOLVER_BEGIN_NAMESPACE
 
 #define STEIN_MAX_NRMCHK 2
 
-template <typename T, typename S, std::enable_if_t<!rocblas_is_complex<T>, int> = 0>
-__device__ void stein_reorthogonalize(rocblas_int i,
+/** STEIN_REORTHOGONALIZE orthogonalizes the iterate in work against the eigenvectors gpind to
+    j-1 of the current cluster, already stored in Z, by classical Gram-Schmidt with one
+    reorthogonalization pass. The projections h = Z' * work are computed with one wavefront
+    per eigenvector, and the update work = work - Z * h with all the threads of the block.
+    h should be an array of size at least j - gpind. **/
+template <int MAX_THDS, typename T, typename S>
+__device__ void stein_reorthogonalize(const int tid,
+                                      const rocblas_int gpind,
                                       const rocblas_int j,
                                       const rocblas_int n,
                                       const rocblas_int b1,
                                       S* work,
                                       T* Z,
-                                      const rocblas_int ldz)
+                                      const rocblas_int ldz,
+                                      S* h)
 {
-    S ztr;
-    rocblas_int jr;
+    const rocblas_int k = j - gpind;
+    const int lane = tid % warpSize;
+    const int wid = tid / warpSize;
+    const int nwaves = MAX_THDS / warpSize;
+    T* Zc = Z + b1 + gpind * ldz;
 
-    for(; i <= j - 1; i++)
+    for(int pass = 0; pass < 2; pass++)
     {
-        ztr = 0;
-        for(jr = 0; jr < n; jr++)
-            ztr = ztr + work[jr] * Z[(b1 + jr) + i * ldz];
-        for(jr = 0; jr < n; jr++)
-            work[jr] = work[jr] - ztr * Z[(b1 + jr) + i * ldz];
+        // h = Z' * work
+        for(rocblas_int c = wid; c < k; c += nwaves)
+        {
+            S sum = 0;
+            for(rocblas_int jr = lane; jr < n; jr += warpSize)
+                sum += work[jr] * std::real(Zc[jr + c * ldz]);
+            for(int offset = warpSize / 2; offset > 0; offset /= 2)
+                sum += __shfl_down(sum, offset);
+            if(lane == 0)
+                h[c] = sum;
+        }
+        __syncthreads();
+
+        // work = work - Z * h
+        for(rocblas_int jr = tid; jr < n; jr += MAX_THDS)
+        {
+            S sum = 0;
+            for(rocblas_int c = 0; c < k; c++)
+                sum += std::real(Zc[jr + c * ldz]) * h[c];
+            work[jr] -= sum;
+        }
+        __syncthreads();
     }
 }
 
-template <typename T, typename S, std::enable_if_t<rocblas_is_complex<T>, int> = 0>
-__device__ void stein_reorthogonalize(rocblas_int i,
-                                      const rocblas_int j,
-                                      const rocblas_int n,
-                                      const rocblas_int b1,
-                                      S* work,
-                                      T* Z,
-                                      const rocblas_int ldz)
+/** STEIN_TWISTED_KERNEL computes, with one thread per eigenvalue, the eigenvectors of the
+    eigenvalues that are isolated in their block (i.e. those that would not be reorthogonalized
+    by inverse iteration). As in the MRRR algorithm, the eigenvector z is obtained from the
+    twisted factorization of T - lambda*I with the smallest twist element gamma_r, which
+    amounts to one step of inverse iteration with the best starting vector e_r. The vector is
+    kept only if its residual |gamma_r| / ||z|| is small; otherwise it is left to inverse
+    iteration. done[j] = 1 marks the computed eigenvectors. **/
+template <typename T, typename S, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) stein_twisted_kernel(const rocblas_int n,
+                                                                  S* DD,
+                                                                  const rocblas_stride strideD,
+                                                                  S* EE,
+                                                                  const rocblas_stride strideE,
+                                                                  rocblas_int* nevA,
+                                                                  S* WW,
+                                                                  const rocblas_stride strideW,
+                                                                  rocblas_int* iblockA,
+                                                                  const rocblas_stride strideIblock,
+                                                                  rocblas_int* isplitA,
+                                                                  const rocblas_stride strideIsplit,
+                                                                  U ZZ,
+                                                                  const rocblas_int shiftZ,
+                                                                  const rocblas_int ldz,
+                                                                  const rocblas_stride strideZ,
+                                                                  rocblas_int* iworkA,
+                                                                  S eps,
+                                                                  S ssfmin)
 {
-    S ztr;
-    rocblas_int jr;
+    rocblas_int bid = hipBlockIdx_y;
+    rocblas_int j = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocblas_int nev = nevA[bid];
+
+    if(j >= nev)
+        return;
+
+    S* D = DD + (bid * strideD);
+    S* E = EE + (bid * strideE);
+    S* W = WW + (bid * strideW);
+    rocblas_int* iblock = iblockA + (bid * strideIblock);
+    rocblas_int* isplit = isplitA + (bid * strideIsplit);
+    rocblas_int* done = iworkA + (bid * 2 * n) + n;
+    T* Z = load_ptr_batch<T>(ZZ, bid, shiftZ, strideZ);
+    T* z = Z + j * ldz;
+
+    done[j] = 0;
+
+    // start and end indices of the submatrix
+    rocblas_int nblk = iblock[j] - 1;
+    rocblas_int b1 = (nblk == 0 ? 0 : isplit[nblk - 1]);
+    rocblas_int bn = isplit[nblk] - 1;
+    rocblas_int blksize = bn - b1 + 1;
+    if(blksize == 1)
+        return;
+
+    // reorthogonalization criterion (as in run_stein) and pivot threshold
+    S onenrm = std::max(abs(D[b1]) + abs(E[b1]), abs(D[bn]) + abs(E[bn - 1]));
+    S pivmin = 1;
+    for(rocblas_int i = b1; i < bn; i++)
+    {
+        if(i > b1)
+            onenrm = std::max(onenrm, abs(D[i]) + abs(E[i - 1]) + abs(E[i]));
+        pivmin = std::max(pivmin, E[i] * E[i]);
+    }
+    S ortol = S(0.001) * onenrm;
+    pivmin *= ssfmin;
+
+    // only isolated eigenvalues are considered
+    S xj = W[j];
+    if(j > 0 && iblock[j - 1] - 1 == nblk && xj - W[j - 1] <= ortol)
+        return;
+    if(j < nev - 1 && iblock[j + 1] - 1 == nblk && W[j + 1] - xj <= ortol)
+        return;
 
-    for(; i <= j - 1; i++)
+    // pivots of the factorization T - xj*I = U * R * U' (bottom-up), stored in z
+    S r = D[bn] - xj;
+    if(abs(r) < pivmin)
+        r = -pivmin;
+    z[bn] = r;
+    for(rocblas_int i = bn - 1; i >= b1; i--)
     {
-        ztr = 0;
-        for(jr = 0; jr < n; jr++)
-            ztr = ztr + work[jr] * Z[(b1 + jr) + i * ldz].real();
-        for(jr = 0; jr < n; jr++)
-            work[jr] = work[jr] - ztr * Z[(b1 + jr) + i * ldz].real();
+        r = (D[i] - xj) - E[i] * E[i] / r;
+        if(abs(r) < pivmin)
+            r = -pivmin;
+        z[i] = r;
     }
+
+    // pivots of the factorization T - xj*I = L * D * L' (top-down), and
+    // twist index tw with the smallest gamma_k = d_k + r_k - (D_k - xj)
+    rocblas_int tw = b1;
+    S gmin = 0;
+    S d = D[b1] - xj;
+    for(rocblas_int k = b1; k <= bn; k++)
+    {
+        if(abs(d) < pivmin)
+            d = -pivmin;
+        S gamma = d + std::real(z[k]) - (D[k] - xj);
+        if(k == b1 || abs(gamma) < abs(gmin))
+        {
+            gmin = gamma;
+            tw = k;
+        }
+        if(k < bn)
+            d = (D[k + 1] - xj) - E[k] * E[k] / d;
+    }
+
+    // store the top-down pivots above the twist index
+    d = D[b1] - xj;
+    for(rocblas_int i = b1; i < tw; i++)
+    {
+        if(abs(d) < pivmin)
+            d = -pivmin;
+        z[i] = d;
+        d = (D[i + 1] - xj) - E[i] * E[i] / d;
+    }
+
+    // solve N_tw * z = e_tw, with z[tw] = 1
+    S v = 1;
+    for(rocblas_int i = tw; i < bn; i++)
+    {
+        v = -(E[i] / std::real(z[i + 1])) * v;
+        z[i + 1] = v;
+    }
+    v = 1;
+    for(rocblas_int i = tw - 1; i >= b1; i--)
+    {
+        v = -(E[i] / std::real(z[i])) * v;
+        z[i] = v;
+    }
+    z[tw] = 1;
+
+    // the residual of z is |gamma_tw|
+    S nrm = 0, zmax = 0;
+    for(rocblas_int i = b1; i <= bn; i++)
+    {
+        v = std::real(z[i]);
+        nrm += v * v;
+        if(abs(v) > abs(zmax))
+            zmax = v;
+    }
+    nrm = sqrt(nrm);
+    if(!(abs(gmin) <= blksize * eps * onenrm * nrm))
+        return;
+
+    // normalize so that the largest component is positive
+    S scl = (zmax >= 0 ? S(1) / nrm : S(-1) / nrm);
+    for(rocblas_int i = 0; i < n; i++)
+        z[i] = (i >= b1 && i <= bn ? T(std::real(z[i]) * scl) : T(0));
+    done[j] = 1;
 }
 
 template <int MAX_THDS, typename T, typename S>
@@ -105,14 +261,17 @@ __device__ void run_stein(const int tid,
                           rocblas_int* info,
                           S* work,
                           rocblas_int* iwork,
+                          rocblas_int* done,
                           S* sval1,
                           S* sval2,
                           rocblas_int* sidx,
                           S eps,
-                          S ssfmin)
+                          S ssfmin,
+                          rocsolver_diagnostics* diag)
 {
     __shared__ rocblas_int _info;
     rocblas_int i, j, j1 = 0, b1, bn, blksize, gpind;
+    rocblas_int total_iters = 0;
     S scl, onenrm, ortol, stpcrt, xj, xjm;
 
     // zero info and ifail
@@ -156,6 +315,13 @@ __device__ void run_stein(const int tid,
             jblk++;
             xj = W[j];
 
+            // skip the eigenvectors already computed by stein_twisted_kernel
+            if(blksize > 1 && done[j])
+            {
+                xjm = xj;
+                continue;
+            }
+
             if(blksize > 1)
             {
                 // if eigenvalues j and j-1 are too close, add a perturbation
@@ -212,11 +378,8 @@ __device__ void run_stein(const int tid,
                         if(abs(xj - xjm) > ortol)
                             gpind = j;
                         if(gpind != j)
-                        {
-                            if(tid == 0)
-                                stein_reorthogonalize<T>(gpind, j, blksize, b1, work, Z, ldz);
-                            __syncthreads();
-                        }
+                            stein_reorthogonalize<MAX_THDS>(tid, gpind, j, blksize, b1, work, Z,
+                                                            ldz, work + 5 * n);
                     }
 
                     // check the infinity norm of the iterate against stopping condition
@@ -227,6 +390,7 @@ __device__ void run_stein(const int tid,
 
                     iters++;
                 }
+                total_iters += iters;
 
                 if(ifail && tid == 0 && nrmchk < STEIN_MAX_NRMCHK)
                 {
@@ -258,7 +422,10 @@ __device__ void run_stein(const int tid,
     }
 
     if(tid == 0)
+    {
         *info = _info;
+        diagnostics_add(diag, total_iters, 0);
+    }
 }
 
 template <typename T, typename S, typename U>
@@ -285,13 +452,14 @@ ROCSOLVER_KERNEL void __launch_bounds__(STEIN_MAX_THDS)
                  S* work,
                  rocblas_int* iwork,
                  S eps,
-                 S ssfmin)
+                 S ssfmin,
+                 rocsolver_diagnostics* diagA)
 {
     // select batch instance
     rocblas_int bid = hipBlockIdx_y;
     rocblas_int tid = hipThreadIdx_x;
-    rocblas_stride stride_work = 5 * n;
-    rocblas_stride stride_iwork = n;
+    rocblas_stride stride_work = 6 * n;
+    rocblas_stride stride_iwork = 2 * n;
 
     if(nev[bid] <= 0)
         return;
@@ -300,6 +468,7 @@ ROCSOLVER_KERNEL void __launch_bounds__(STEIN_MAX_THDS)
     rocblas_int* ifail = nullptr;
     if(ifailA)
         ifail = ifailA + (bid * strideIfail);
+    rocsolver_diagnostics* diag = diagA ? diagA + bid : nullptr;
 
     // shared mem for temporary values
     extern __shared__ double lmem[];
@@ -311,7 +480,8 @@ ROCSOLVER_KERNEL void __launch_bounds__(STEIN_MAX_THDS)
     run_stein<STEIN_MAX_THDS, T>(
         tid, n, D + (bid * strideD), E + (bid * strideE), nev[bid], W + (bid * strideW),
         iblock + (bid * strideIblock), isplit + (bid * strideIsplit), Z, ldz, ifail, info + bid,
-        work + (bid * stride_work), iwork + (bid * stride_iwork), sval1, sval2, sidx, eps, ssfmin);
+        work + (bid * stride_work), iwork + (bid * stride_iwork), iwork + (bid * stride_iwork) + n,
+        sval1, sval2, sidx, eps, ssfmin, diag);
 }
 
 template <typename T, typename S>
@@ -329,10 +499,10 @@ void rocsolver_stein_getMemorySize(const rocblas_int n,
     }
 
     // size of workspace
-    *size_work = sizeof(S) * 5 * n * batch_count;
+    *size_work = sizeof(S) * 6 * n * batch_count;
 
     // size of integer workspace
-    *size_iwork = sizeof(rocblas_int) * n * batch_count;
+    *size_iwork = sizeof(rocblas_int) * 2 * n * batch_count;
 }
 
 template <typename T, typename S>
@@ -415,6 +585,10 @@ rocblas_status rocsolver_stein_template(rocblas_handle handle,
     // info = 0
     ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threadsReset, 0, stream, info, batch_count, 0);
 
+    // diagnostics = 0
+    rocsolver_diagnostics* diag = get_diagnostics(handle, batch_count);
+    diagnostics_reset<T>(stream, diag, batch_count);
+
     // quick return
     if(n == 0)
         return rocblas_status_success;
@@ -422,13 +596,23 @@ rocblas_status rocsolver_stein_template(rocblas_handle handle,
     S eps = get_epsilon<T>();
     S ssfmin = get_safemin<T>();
 
+    // compute the eigenvectors of isolated eigenvalues without inverse iteration
+    dim3 gridT((n - 1) / BS1 + 1, batch_count, 1);
+    dim3 threadsT(BS1, 1, 1);
+    ROCSOLVER_LAUNCH_KERNEL(stein_twisted_kernel<T>, gridT, threadsT, 0, stream, n, D + shiftD,
+                            strideD, E + shiftE, strideE, nev, W + shiftW, strideW, iblock,
+                            strideIblock, isplit, strideIsplit, Z, shiftZ, ldz, strideZ, iwork,
+                            eps, ssfmin);
+
     dim3 grid(1, batch_count, 1);
     dim3 threads(STEIN_MAX_THDS, 1, 1);
     size_t lmemsize = STEIN_MAX_THDS * (2 * sizeof(S) + sizeof(rocblas_int));
+    diagnostics_mark<T>(stream, diag, batch_count, 0, true);
     ROCSOLVER_LAUNCH_KERNEL(stein_kernel<T>, grid, threads, lmemsize, stream, n, D + shiftD,
                             strideD, E + shiftE, strideE, nev, W + shiftW, strideW, iblock,
                             strideIblock, isplit, strideIsplit, Z, shiftZ, ldz, strideZ, ifail,
-                            strideIfail, info, work, iwork, eps, ssfmin);
+                            strideIfail, info, work, iwork, eps, ssfmin, diag);
+    diagnostics_mark<T>(stream, diag, batch_count, 0, false);
 
     return rocblas_status_success;
 }
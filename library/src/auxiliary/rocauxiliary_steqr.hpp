@@ -36,6 +36,7 @@
 #include "rocauxiliary_sterf.hpp"
 #include "rocblas.hpp"
 #include "rocsolver/rocsolver.h"
+#include "rocsolver_diagnostics.hpp"
 
 ROCSOLVER_BEGIN_NAMESPACE
 
@@ -60,11 +61,13 @@ __device__ void run_steqr(const rocblas_int n,
                           const S eps,
                           const S ssfmin,
                           const S ssfmax,
-                          const bool ordered = true)
+                          const bool ordered = true,
+                          rocsolver_diagnostics* diag = nullptr)
 {
     rocblas_int m, l, lsv, lend, lendsv;
     rocblas_int l1 = 0;
     rocblas_int iters = 0;
+    rocblas_int defl = 0;
     S anorm, p;
 
     while(l1 < n && iters < max_iters)
@@ -77,6 +80,7 @@ __device__ void run_steqr(const rocblas_int n,
             if(abs(E[m]) <= sqrt(abs(D[m])) * sqrt(abs(D[m + 1])) * eps)
             {
                 E[m] = 0;
+                defl++;
                 break;
             }
         }
@@ -114,7 +118,10 @@ __device__ void run_steqr(const rocblas_int n,
                         break;
 
                 if(m < lend)
+                {
+                    defl += (E[m] != 0);
                     E[m] = 0;
+                }
                 p = D[l];
                 if(m == l)
                 {
@@ -197,7 +204,10 @@ __device__ void run_steqr(const rocblas_int n,
                         break;
 
                 if(m > lend)
+                {
+                    defl += (E[m - 1] != 0);
                     E[m - 1] = 0;
+                }
                 p = D[l];
                 if(m == l)
                 {
@@ -280,6 +290,7 @@ __device__ void run_steqr(const rocblas_int n,
     for(int i = 0; i < n - 1; i++)
         if(E[i] != 0)
             info[0]++;
+    diagnostics_add(diag, iters, defl);
 
     // Sort eigenvalues and eigenvectors by selection sort
     if(ordered)
@@ -322,7 +333,8 @@ ROCSOLVER_KERNEL void steqr_kernel(const rocblas_int n,
                                    const rocblas_int max_iters,
                                    const S eps,
                                    const S ssfmin,
-                                   const S ssfmax)
+                                   const S ssfmax,
+                                   rocsolver_diagnostics* diagA)
 {
     // select bacth instance
     rocblas_int bid = hipBlockIdx_x;
@@ -333,9 +345,395 @@ ROCSOLVER_KERNEL void steqr_kernel(const rocblas_int n,
     T* C = load_ptr_batch<T>(CC, bid, shiftC, strideC);
     S* work = WW + (bid * strideW);
     rocblas_int* info = iinfo + bid;
+    rocsolver_diagnostics* diag = diagA ? diagA + bid : nullptr;
 
     // execute
-    run_steqr(n, D, E, C, ldc, info, work, max_iters, eps, ssfmin, ssfmax);
+    run_steqr(n, D, E, C, ldc, info, work, max_iters, eps, ssfmin, ssfmax, true, diag);
+}
+
+/** STEQR_BLOCKED_STATE holds the position in the main loop of the QR algorithm between
+    calls to steqr_blocked_chase **/
+template <typename S>
+struct steqr_blocked_state
+{
+    rocblas_int l1, l, lend, lsv, lendsv;
+    rocblas_int iters, defl;
+    S anorm;
+    bool ql, active, done;
+};
+
+/** STEQR_BLOCKED_CHASE runs the main loop of the QR algorithm of STEQR on D and E (resuming
+    from the given state) until max_sweeps sweeps of rotations have been saved, or until the
+    algorithm ends. Sweep k has sizes[k] - 1 rotations that act on columns starts[k] to
+    starts[k] + sizes[k] - 1 of the eigenvectors in the direction dirs[k]. The cosines and
+    then the sines of the sweeps are saved one after the other in work. Returns the number
+    of saved sweeps. **/
+template <typename S>
+__device__ rocblas_int steqr_blocked_chase(const rocblas_int n,
+                                           S* D,
+                                           S* E,
+                                           steqr_blocked_state<S>& st,
+                                           S* work,
+                                           rocblas_int* starts,
+                                           rocblas_int* sizes,
+                                           rocblas_direct* dirs,
+                                           const rocblas_int max_sweeps,
+                                           const rocblas_int max_iters,
+                                           const S eps,
+                                           const S ssfmin,
+                                           const S ssfmax)
+{
+    rocblas_int& l = st.l;
+    rocblas_int& lend = st.lend;
+    rocblas_int m;
+    rocblas_int ns = 0;
+    rocblas_int off = 0;
+    S p;
+
+    auto save_sweep = [&](rocblas_int start, rocblas_int size, rocblas_direct dir) {
+        starts[ns] = start;
+        sizes[ns] = size;
+        dirs[ns] = dir;
+        off += 2 * (size - 1);
+        ns++;
+    };
+
+    while(ns < max_sweeps)
+    {
+        if(!st.active)
+        {
+            if(st.l1 >= n || st.iters >= max_iters)
+            {
+                st.done = true;
+                break;
+            }
+
+            // Determine submatrix indices
+            if(st.l1 > 0)
+                E[st.l1 - 1] = 0;
+            for(m = st.l1; m < n - 1; m++)
+            {
+                if(abs(E[m]) <= sqrt(abs(D[m])) * sqrt(abs(D[m + 1])) * eps)
+                {
+                    E[m] = 0;
+                    st.defl++;
+                    break;
+                }
+            }
+
+            st.lsv = l = st.l1;
+            st.lendsv = lend = m;
+            st.l1 = m + 1;
+            if(lend == l)
+                continue;
+
+            // Scale submatrix
+            st.anorm = find_max_tridiag(l, lend, D, E);
+            if(st.anorm == 0)
+                continue;
+            else if(st.anorm > ssfmax)
+                scale_tridiag(l, lend, D, E, st.anorm / ssfmax);
+            else if(st.anorm < ssfmin)
+                scale_tridiag(l, lend, D, E, st.anorm / ssfmin);
+
+            // Choose iteration type (QL or QR)
+            if(abs(D[lend]) < abs(D[l]))
+            {
+                lend = st.lsv;
+                l = st.lendsv;
+            }
+            st.ql = (lend >= l);
+            st.active = true;
+        }
+
+        if((st.ql && l > lend) || (!st.ql && l < lend) || st.iters >= max_iters)
+        {
+            // Undo scaling
+            if(st.anorm > ssfmax)
+                scale_tridiag(st.lsv, st.lendsv, D, E, ssfmax / st.anorm);
+            if(st.anorm < ssfmin)
+                scale_tridiag(st.lsv, st.lendsv, D, E, ssfmin / st.anorm);
+            st.active = false;
+            continue;
+        }
+
+        S* c = work + off;
+        if(st.ql)
+        {
+            // QL iteration
+            // Find small subdiagonal element
+            for(m = l; m <= lend - 1; m++)
+                if(abs(E[m] * E[m]) <= eps * eps * abs(D[m] * D[m + 1]))
+                    break;
+
+            if(m < lend)
+            {
+                st.defl += (E[m] != 0);
+                E[m] = 0;
+            }
+            p = D[l];
+            if(m == l)
+            {
+                l++;
+            }
+            else if(m == l + 1)
+            {
+                // Use laev2 to compute 2x2 eigenvalues and eigenvectors
+                S rt1, rt2;
+                laev2(D[l], E[l], D[l + 1], rt1, rt2, c[0], c[1]);
+                save_sweep(l, 2, rocblas_backward_direction);
+
+                D[l] = rt1;
+                D[l + 1] = rt2;
+                E[l] = 0;
+                l = l + 2;
+            }
+            else
+            {
+                st.iters++;
+
+                S f, g, cs, sn, b, r;
+                S* s = c + (m - l);
+
+                // Form shift
+                g = (D[l + 1] - p) / (2 * E[l]);
+                if(g >= 0)
+                    r = abs(sqrt(1 + g * g));
+                else
+                    r = -abs(sqrt(1 + g * g));
+                g = D[m] - p + (E[l] / (g + r));
+
+                cs = 1;
+                sn = 1;
+                p = 0;
+
+                for(int i = m - 1; i >= l; i--)
+                {
+                    f = sn * E[i];
+                    b = cs * E[i];
+                    lartg(g, f, cs, sn, r);
+                    sn = -sn; //get the transpose of the rotation
+                    if(i != m - 1)
+                        E[i + 1] = r;
+
+                    g = D[i + 1] - p;
+                    r = (D[i] - g) * sn + 2 * cs * b;
+                    p = sn * r;
+                    D[i + 1] = g + p;
+                    g = cs * r - b;
+
+                    // Save rotations
+                    c[i - l] = cs;
+                    s[i - l] = -sn;
+                }
+                save_sweep(l, m - l + 1, rocblas_backward_direction);
+
+                D[l] -= p;
+                E[l] = g;
+            }
+        }
+        else
+        {
+            // QR iteration
+            // Find small subdiagonal element
+            for(m = l; m >= lend + 1; m--)
+                if(abs(E[m - 1] * E[m - 1]) <= eps * eps * abs(D[m] * D[m - 1]))
+                    break;
+
+            if(m > lend)
+            {
+                st.defl += (E[m - 1] != 0);
+                E[m - 1] = 0;
+            }
+            p = D[l];
+            if(m == l)
+            {
+                l--;
+            }
+            else if(m == l - 1)
+            {
+                // Use laev2 to compute 2x2 eigenvalues and eigenvectors
+                S rt1, rt2;
+                laev2(D[l - 1], E[l - 1], D[l], rt1, rt2, c[0], c[1]);
+                save_sweep(l - 1, 2, rocblas_forward_direction);
+
+                D[l - 1] = rt1;
+                D[l] = rt2;
+                E[l - 1] = 0;
+                l = l - 2;
+            }
+            else
+            {
+                st.iters++;
+
+                S f, g, cs, sn, b, r;
+                S* s = c + (l - m);
+
+                // Form shift
+                g = (D[l - 1] - p) / (2 * E[l - 1]);
+                if(g >= 0)
+                    r = abs(sqrt(1 + g * g));
+                else
+                    r = -abs(sqrt(1 + g * g));
+                g = D[m] - p + (E[l - 1] / (g + r));
+
+                cs = 1;
+                sn = 1;
+                p = 0;
+
+                for(int i = m; i <= l - 1; i++)
+                {
+                    f = sn * E[i];
+                    b = cs * E[i];
+                    lartg(g, f, cs, sn, r);
+                    sn = -sn; //get the transpose of the rotation
+                    if(i != m)
+                        E[i - 1] = r;
+
+                    g = D[i] - p;
+                    r = (D[i + 1] - g) * sn + 2 * cs * b;
+                    p = sn * r;
+                    D[i] = g + p;
+                    g = cs * r - b;
+
+                    // Save rotations
+                    c[i - m] = cs;
+                    s[i - m] = sn;
+                }
+                save_sweep(m, l - m + 1, rocblas_forward_direction);
+
+                D[l] -= p;
+                E[l - 1] = g;
+            }
+        }
+    }
+
+    return ns;
+}
+
+/** STEQR_BLOCKED_KERNEL implements STEQR for n >= STEQR_BLOCKED_SWITCHSIZE. The first thread of
+    the group runs the QR iterations on D and E and saves the rotations of up to
+    STEQR_BLOCKED_STEPS sweeps, which are then applied to C by all the threads of the group,
+    each thread updating different rows. The eigenvalues are sorted at the end, swapping the
+    columns of C in the same way.
+    Call this kernel with batch_count groups in x, and BS1 threads. **/
+template <typename T, typename S, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) steqr_blocked_kernel(const rocblas_int n,
+                                                                  S* DD,
+                                                                  const rocblas_stride strideD,
+                                                                  S* EE,
+                                                                  const rocblas_stride strideE,
+                                                                  U CC,
+                                                                  const rocblas_int shiftC,
+                                                                  const rocblas_int ldc,
+                                                                  const rocblas_stride strideC,
+                                                                  rocblas_int* iinfo,
+                                                                  S* WW,
+                                                                  const rocblas_int max_iters,
+                                                                  const S eps,
+                                                                  const S ssfmin,
+                                                                  const S ssfmax,
+                                                                  rocsolver_diagnostics* diagA)
+{
+    // select batch instance
+    rocblas_int bid = hipBlockIdx_x;
+    rocblas_int tid = hipThreadIdx_x;
+    rocblas_stride strideW = 2 * n * STEQR_BLOCKED_STEPS;
+
+    S* D = DD + (bid * strideD);
+    S* E = EE + (bid * strideE);
+    T* C = load_ptr_batch<T>(CC, bid, shiftC, strideC);
+    S* work = WW + (bid * strideW);
+    rocblas_int* info = iinfo + bid;
+    rocsolver_diagnostics* diag = diagA ? diagA + bid : nullptr;
+
+    // shared memory setup
+    __shared__ steqr_blocked_state<S> st;
+    __shared__ rocblas_int starts[STEQR_BLOCKED_STEPS];
+    __shared__ rocblas_int sizes[STEQR_BLOCKED_STEPS];
+    __shared__ rocblas_direct dirs[STEQR_BLOCKED_STEPS];
+    __shared__ rocblas_int nsweeps;
+
+    if(tid == 0)
+    {
+        st.l1 = 0;
+        st.iters = 0;
+        st.defl = 0;
+        st.active = false;
+        st.done = false;
+    }
+
+    bool done = false;
+    while(!done)
+    {
+        // run the QR iterations until enough sweeps have been saved
+        if(tid == 0)
+            nsweeps = steqr_blocked_chase(n, D, E, st, work, starts, sizes, dirs,
+                                          STEQR_BLOCKED_STEPS, max_iters, eps, ssfmin, ssfmax);
+        __syncthreads();
+        done = st.done;
+
+        // apply the saved sweeps to the rows of C
+        for(rocblas_int i = tid; i < n; i += hipBlockDim_x)
+        {
+            rocblas_int off = 0;
+            for(rocblas_int k = 0; k < nsweeps; k++)
+            {
+                lasr(rocblas_side_right, dirs[k], 1, sizes[k], work + off,
+                     work + off + sizes[k] - 1, C + i + starts[k] * ldc, ldc);
+                off += 2 * (sizes[k] - 1);
+            }
+        }
+        __syncthreads();
+    }
+
+    // Check for convergence and sort eigenvalues by selection sort
+    // (the column swaps are saved in the workspace)
+    rocblas_int* perm = reinterpret_cast<rocblas_int*>(work);
+    if(tid == 0)
+    {
+        for(int i = 0; i < n - 1; i++)
+            if(E[i] != 0)
+                info[0]++;
+        diagnostics_add(diag, st.iters, st.defl);
+
+        for(int ii = 1; ii < n; ii++)
+        {
+            rocblas_int l = ii - 1;
+            rocblas_int m = l;
+            S p = D[l];
+            for(int j = ii; j < n; j++)
+            {
+                if(D[j] < p)
+                {
+                    m = j;
+                    p = D[j];
+                }
+            }
+            if(m != l)
+            {
+                D[m] = D[l];
+                D[l] = p;
+            }
+            perm[l] = m;
+        }
+    }
+    __syncthreads();
+
+    // swap the columns of C
+    for(rocblas_int i = tid; i < n; i += hipBlockDim_x)
+    {
+        for(rocblas_int l = 0; l < n - 1; l++)
+        {
+            rocblas_int m = perm[l];
+            if(m != l)
+            {
+                T temp = C[i + l * ldc];
+                C[i + l * ldc] = C[i + m * ldc];
+                C[i + m * ldc] = temp;
+            }
+        }
+    }
 }
 
 template <typename T, typename S>
@@ -354,6 +752,8 @@ void rocsolver_steqr_getMemorySize(const rocblas_evect evect,
     // size of stack (for lasrt)
     if(evect == rocblas_evect_none)
         *size_work_stack = sizeof(rocblas_int) * (2 * 32) * batch_count;
+    else if(n >= STEQR_BLOCKED_SWITCHSIZE)
+        *size_work_stack = sizeof(S) * (2 * n) * STEQR_BLOCKED_STEPS * batch_count;
     else
         *size_work_stack = sizeof(S) * (2 * n) * batch_count;
 }
@@ -427,6 +827,10 @@ rocblas_status rocsolver_steqr_template(rocblas_handle handle,
     // info = 0
     ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, info, batch_count, 0);
 
+    // diagnostics = 0
+    rocsolver_diagnostics* diag = get_diagnostics(handle, batch_count);
+    diagnostics_reset<T>(stream, diag, batch_count);
+
     // quick return
     if(n == 1 && evect != rocblas_evect_none)
         ROCSOLVER_LAUNCH_KERNEL(reset_batch_info<T>, dim3(1, batch_count), dim3(1, 1), 0, stream, C,
@@ -448,14 +852,20 @@ rocblas_status rocsolver_steqr_template(rocblas_handle handle,
     ssfmin = sqrt(ssfmin) / (eps * eps);
     ssfmax = sqrt(ssfmax) / S(3.0);
 
+    diagnostics_mark<T>(stream, diag, batch_count, 0, true);
     if(evect == rocblas_evect_none)
         ROCSOLVER_LAUNCH_KERNEL(sterf_kernel<S>, dim3(batch_count), dim3(1), 0, stream, n,
                                 D + shiftD, strideD, E + shiftE, strideE, info,
-                                (rocblas_int*)work_stack, 30 * n, eps, ssfmin, ssfmax);
+                                (rocblas_int*)work_stack, 30 * n, eps, ssfmin, ssfmax, diag);
+    else if(n >= STEQR_BLOCKED_SWITCHSIZE)
+        ROCSOLVER_LAUNCH_KERNEL((steqr_blocked_kernel<T>), dim3(batch_count), dim3(BS1), 0, stream,
+                                n, D + shiftD, strideD, E + shiftE, strideE, C, shiftC, ldc,
+                                strideC, info, (S*)work_stack, 30 * n, eps, ssfmin, ssfmax, diag);
     else
         ROCSOLVER_LAUNCH_KERNEL((steqr_kernel<T>), dim3(batch_count), dim3(1), 0, stream, n,
                                 D + shiftD, strideD, E + shiftE, strideE, C, shiftC, ldc, strideC,
-                                info, (S*)work_stack, 30 * n, eps, ssfmin, ssfmax);
+                                info, (S*)work_stack, 30 * n, eps, ssfmin, ssfmax, diag);
+    diagnostics_mark<T>(stream, diag, batch_count, 0, false);
 
     return rocblas_status_success;
 }
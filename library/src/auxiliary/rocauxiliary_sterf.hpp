@@ -33,8 +33,10 @@
 #pragma once
 
 #include "lapack_device_functions.hpp"
+#include "rocauxiliary_stebz.hpp"
 #include "rocblas.hpp"
 #include "rocsolver/rocsolver.h"
+#include "rocsolver_diagnostics.hpp"
 
 ROCSOLVER_BEGIN_NAMESPACE
 
@@ -42,6 +44,8 @@ ROCSOLVER_BEGIN_NAMESPACE
 (TODO:THIS IS BASIC IMPLEMENTATION. THE ONLY PARALLELISM INTRODUCED HERE IS
   FOR THE BATCHED VERSIONS (A DIFFERENT THREAD WORKS ON EACH INSTANCE OF THE
   BATCH).)
+  For n >= STERF_BISECTION_SWITCHSIZE the QR iteration is replaced by a
+  parallel bisection, where each thread computes a different eigenvalue.
 ***************************************************************************/
 
 /** STERF_SQ_E squares the elements of E **/
@@ -52,30 +56,24 @@ __device__ void sterf_sq_e(const rocblas_int start, const rocblas_int end, T* E)
         E[i] = E[i] * E[i];
 }
 
-/** STERF_KERNEL implements the main loop of the sterf algorithm
+/** STERF_KERNEL/RUN_STERF implements the main loop of the sterf algorithm
     to compute the eigenvalues of a symmetric tridiagonal matrix given by D
     and E **/
 template <typename T>
-ROCSOLVER_KERNEL void sterf_kernel(const rocblas_int n,
-                                   T* DD,
-                                   const rocblas_stride strideD,
-                                   T* EE,
-                                   const rocblas_stride strideE,
-                                   rocblas_int* info,
-                                   rocblas_int* stack,
-                                   const rocblas_int max_iters,
-                                   const T eps,
-                                   const T ssfmin,
-                                   const T ssfmax)
+__device__ void run_sterf(const rocblas_int n,
+                          T* D,
+                          T* E,
+                          rocblas_int* info,
+                          const rocblas_int max_iters,
+                          const T eps,
+                          const T ssfmin,
+                          const T ssfmax,
+                          rocsolver_diagnostics* diag = nullptr)
 {
-    rocblas_int bid = hipBlockIdx_x;
-
-    T* D = DD + (bid * strideD);
-    T* E = EE + (bid * strideE);
-
     rocblas_int m, l, lsv, lend, lendsv;
     rocblas_int l1 = 0;
     rocblas_int iters = 0;
+    rocblas_int defl = 0;
     T anorm, p;
 
     while(l1 < n && iters < max_iters)
@@ -88,6 +86,7 @@ ROCSOLVER_KERNEL void sterf_kernel(const rocblas_int n,
             if(abs(E[m]) <= sqrt(abs(D[m])) * sqrt(abs(D[m + 1])) * eps)
             {
                 E[m] = 0;
+                defl++;
                 break;
             }
         }
@@ -126,7 +125,10 @@ ROCSOLVER_KERNEL void sterf_kernel(const rocblas_int n,
                         break;
 
                 if(m < lend)
+                {
+                    defl += (E[m] != 0);
                     E[m] = 0;
+                }
                 p = D[l];
                 if(m == l)
                 {
@@ -202,7 +204,10 @@ ROCSOLVER_KERNEL void sterf_kernel(const rocblas_int n,
                         break;
 
                 if(m > lend)
+                {
+                    defl += (E[m - 1] != 0);
                     E[m - 1] = 0;
+                }
                 p = D[l];
                 if(m == l)
                 {
@@ -277,14 +282,15 @@ ROCSOLVER_KERNEL void sterf_kernel(const rocblas_int n,
     // Check for convergence
     for(int i = 0; i < n - 1; i++)
         if(E[i] != 0)
-            info[bid]++;
+            info[0]++;
+    diagnostics_add(diag, iters, defl);
 
     // Sort eigenvalues
     /** (TODO: the quick-sort method implemented in lasrt_increasing fails for some cases.
         Substituting it here with a simple sorting algorithm. If more performance is required in
         the future, lasrt_increasing should be debugged or another quick-sort method
         could be implemented) **/
-    //lasrt_increasing(n, D, stack + bid * (2 * 32));
+    //lasrt_increasing(n, D, stack);
 
     for(int ii = 1; ii < n; ii++)
     {
@@ -307,6 +313,134 @@ ROCSOLVER_KERNEL void sterf_kernel(const rocblas_int n,
     }
 }
 
+template <typename T>
+ROCSOLVER_KERNEL void sterf_kernel(const rocblas_int n,
+                                   T* DD,
+                                   const rocblas_stride strideD,
+                                   T* EE,
+                                   const rocblas_stride strideE,
+                                   rocblas_int* info,
+                                   rocblas_int* stack,
+                                   const rocblas_int max_iters,
+                                   const T eps,
+                                   const T ssfmin,
+                                   const T ssfmax,
+                                   rocsolver_diagnostics* diag)
+{
+    rocblas_int bid = hipBlockIdx_x;
+
+    T* D = DD + (bid * strideD);
+    T* E = EE + (bid * strideE);
+
+    // execute
+    run_sterf(n, D, E, info + bid, max_iters, eps, ssfmin, ssfmax, diag ? diag + bid : nullptr);
+}
+
+/** STERF_BISECTION_INIT_KERNEL squares the elements of E, and computes the Gershgorin
+    bounds of the spectrum, the minimum pivot for the Sturm counts and the tolerance.
+    Call this kernel with batch_count groups in x, and STEBZ_SPLIT_THDS threads. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(STEBZ_SPLIT_THDS)
+    sterf_bisection_init_kernel(const rocblas_int n,
+                                U DD,
+                                const rocblas_int shiftD,
+                                const rocblas_stride strideD,
+                                U EE,
+                                const rocblas_int shiftE,
+                                const rocblas_stride strideE,
+                                T* work,
+                                const T eps,
+                                const T sfmin)
+{
+    const rocblas_int tid = hipThreadIdx_x;
+    const rocblas_int bid = hipBlockIdx_x;
+
+    T* D = load_ptr_batch<T>(DD, bid, shiftD, strideD);
+    T* E = load_ptr_batch<T>(EE, bid, shiftE, strideE);
+    // work = [gl, gu, pmin, tol, Esqr(n - 1), W(n)]
+    T* bounds = work + bid * (2 * n + 3);
+    T* Esqr = bounds + 4;
+
+    __shared__ T sval[STEBZ_SPLIT_THDS];
+
+    T emax = 0;
+    for(rocblas_int i = tid; i < n - 1; i += STEBZ_SPLIT_THDS)
+    {
+        T e2 = E[i] * E[i];
+        Esqr[i] = e2;
+        emax = std::max(emax, e2);
+    }
+    sval[tid] = emax;
+    __syncthreads();
+
+    for(rocblas_int r = STEBZ_SPLIT_THDS / 2; r > 0; r /= 2)
+    {
+        if(tid < r)
+            sval[tid] = std::max(sval[tid], sval[tid + r]);
+        __syncthreads();
+    }
+
+    if(tid == 0)
+    {
+        T gl, gu;
+        gershgorin_bounds(n, D, E, &gl, &gu);
+        T pmin = sfmin * std::max(T(1), sval[0]);
+        T bnorm = std::max(std::abs(gl), std::abs(gu));
+        bounds[0] = gl - bnorm * eps * n - pmin;
+        bounds[1] = gu + bnorm * eps * n + pmin;
+        bounds[2] = pmin;
+        // absolute tolerance, as with abstol <= 0 in STEBZ
+        bounds[3] = std::max(eps * bnorm, pmin);
+    }
+}
+
+/** STERF_BISECTION_KERNEL computes the eigenvalues of the tridiagonal matrix by bisection.
+    Thread k finds the (k+1)-th smallest eigenvalue using Sturm counts; the results are stored
+    in ascending order in W.
+    Call this kernel with as many groups in x as needed to cover the n eigenvalues, and
+    batch_count groups in y. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1)
+    sterf_bisection_kernel(const rocblas_int n,
+                           U DD,
+                           const rocblas_int shiftD,
+                           const rocblas_stride strideD,
+                           T* work,
+                           const T eps)
+{
+    const rocblas_int k = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const rocblas_int bid = hipBlockIdx_y;
+
+    if(k < n)
+    {
+        T* D = load_ptr_batch<T>(DD, bid, shiftD, strideD);
+        T* bounds = work + bid * (2 * n + 3);
+        T* Esqr = bounds + 4;
+        T* W = Esqr + n - 1;
+
+        T gl = bounds[0];
+        T gu = bounds[1];
+        T pmin = bounds[2];
+        T tol = bounds[3];
+        int maxite = int((log(gu - gl + pmin) - log(pmin)) / log(2)) + 2;
+
+        // the (k+1)-th eigenvalue is always in (gl, gu]
+        for(int ite = 0; ite < maxite; ++ite)
+        {
+            if(gu - gl <= std::max(tol, 2 * eps * std::max(std::abs(gl), std::abs(gu))))
+                break;
+
+            T tmp = (gl + gu) / 2;
+            if(sturm_count(n, D, Esqr, pmin, tmp) > k)
+                gu = tmp;
+            else
+                gl = tmp;
+        }
+
+        W[k] = (gl + gu) / 2;
+    }
+}
+
 template <typename T>
 void rocsolver_sterf_getMemorySize(const rocblas_int n,
                                    const rocblas_int batch_count,
@@ -321,6 +455,10 @@ void rocsolver_sterf_getMemorySize(const rocblas_int n,
 
     // size of stack (for lasrt)
     *size_stack = sizeof(rocblas_int) * (2 * 32) * batch_count;
+
+    // size of the bounds, the squares of E and the eigenvalues (for bisection)
+    if(n >= STERF_BISECTION_SWITCHSIZE)
+        *size_stack = std::max(*size_stack, sizeof(T) * (2 * n + 3) * batch_count);
 }
 
 template <typename T>
@@ -375,6 +513,10 @@ rocblas_status rocsolver_sterf_template(rocblas_handle handle,
     // info = 0
     ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, info, batch_count, 0);
 
+    // diagnostics = 0
+    rocsolver_diagnostics* diag = get_diagnostics(handle, batch_count);
+    diagnostics_reset<T>(stream, diag, batch_count);
+
     // quick return
     if(n <= 1)
         return rocblas_status_success;
@@ -385,8 +527,32 @@ rocblas_status rocsolver_sterf_template(rocblas_handle handle,
     ssfmin = sqrt(ssfmin) / (eps * eps);
     ssfmax = sqrt(ssfmax) / T(3.0);
 
+    diagnostics_mark<T>(stream, diag, batch_count, 0, true);
+
+    if(n >= STERF_BISECTION_SWITCHSIZE)
+    {
+        T* work = reinterpret_cast<T*>(stack);
+        rocblas_int blocks = (n - 1) / BS1 + 1;
+
+        ROCSOLVER_LAUNCH_KERNEL((sterf_bisection_init_kernel<T>), dim3(batch_count),
+                                dim3(STEBZ_SPLIT_THDS), 0, stream, n, D, shiftD, strideD, E,
+                                shiftE, strideE, work, eps, get_safemin<T>());
+        ROCSOLVER_LAUNCH_KERNEL((sterf_bisection_kernel<T>), dim3(blocks, batch_count), dim3(BS1),
+                                0, stream, n, D, shiftD, strideD, work, eps);
+
+        // copy the eigenvalues back to D
+        ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, dim3(blocks, 1, batch_count), dim3(BS1), 0, stream, n,
+                                1, work + n + 3, 0, n, rocblas_stride(2 * n + 3), D, shiftD, n,
+                                strideD);
+
+        diagnostics_mark<T>(stream, diag, batch_count, 0, false);
+        return rocblas_status_success;
+    }
+
     ROCSOLVER_LAUNCH_KERNEL(sterf_kernel<T>, dim3(batch_count), dim3(1), 0, stream, n, D + shiftD,
-                            strideD, E + shiftE, strideE, info, stack, 30 * n, eps, ssfmin, ssfmax);
+                            strideD, E + shiftE, strideE, info, stack, 30 * n, eps, ssfmin, ssfmax,
+                            diag);
+    diagnostics_mark<T>(stream, diag, batch_count, 0, false);
 
     return rocblas_status_success;
 }
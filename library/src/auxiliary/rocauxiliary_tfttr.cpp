@@ -0,0 +1,127 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "rocauxiliary_tfttr.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+template <typename T, typename U>
+rocblas_status rocsolver_tfttr_impl(rocblas_handle handle,
+                                    const rocblas_operation transr,
+                                    const rocblas_fill uplo,
+                                    const rocblas_int n,
+                                    U ARF,
+                                    U A,
+                                    const rocblas_int lda)
+{
+    ROCSOLVER_ENTER_TOP("tfttr", "--transr", transr, "--uplo", uplo, "-n", n, "--lda", lda);
+
+    static constexpr bool COMPLEX = rocblas_is_complex<T>;
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_tfttr_argCheck<COMPLEX>(handle, transr, uplo, n, lda, ARF, A);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_stride shiftARF = 0;
+    rocblas_stride shiftA = 0;
+
+    // normal (non-batched non-strided) execution
+    rocblas_stride strideARF = 0;
+    rocblas_stride strideA = 0;
+    rocblas_int batch_count = 1;
+
+    // this function does not require memory work space
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_size_unchanged;
+
+    // execution
+    return rocsolver_tfttr_template<T>(handle, transr, uplo, n, ARF, shiftARF, strideARF, A, shiftA,
+                                       lda, strideA, batch_count);
+}
+
+ROCSOLVER_END_NAMESPACE
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_stfttr(rocblas_handle handle,
+                                const rocblas_operation transr,
+                                const rocblas_fill uplo,
+                                const rocblas_int n,
+                                float* ARF,
+                                float* A,
+                                const rocblas_int lda)
+{
+    return rocsolver::rocsolver_tfttr_impl<float>(handle, transr, uplo, n, ARF, A, lda);
+}
+
+rocblas_status rocsolver_dtfttr(rocblas_handle handle,
+                                const rocblas_operation transr,
+                                const rocblas_fill uplo,
+                                const rocblas_int n,
+                                double* ARF,
+                                double* A,
+                                const rocblas_int lda)
+{
+    return rocsolver::rocsolver_tfttr_impl<double>(handle, transr, uplo, n, ARF, A, lda);
+}
+
+rocblas_status rocsolver_ctfttr(rocblas_handle handle,
+                                const rocblas_operation transr,
+                                const rocblas_fill uplo,
+                                const rocblas_int n,
+                                rocblas_float_complex* ARF,
+                                rocblas_float_complex* A,
+                                const rocblas_int lda)
+{
+    return rocsolver::rocsolver_tfttr_impl<rocblas_float_complex>(handle, transr, uplo, n, ARF, A,
+                                                                  lda);
+}
+
+rocblas_status rocsolver_ztfttr(rocblas_handle handle,
+                                const rocblas_operation transr,
+                                const rocblas_fill uplo,
+                                const rocblas_int n,
+                                rocblas_double_complex* ARF,
+                                rocblas_double_complex* A,
+                                const rocblas_int lda)
+{
+    return rocsolver::rocsolver_tfttr_impl<rocblas_double_complex>(handle, transr, uplo, n, ARF, A,
+                                                                   lda);
+}
+
+} // extern C
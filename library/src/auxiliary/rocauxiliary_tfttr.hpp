@@ -0,0 +1,137 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "rocauxiliary_trttf.hpp"
+#include "rocblas.hpp"
+#include "rocsolver/rocsolver.h"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/** TFTTR_KERNEL copies the RFP array ARF into the uplo triangle of A, with one thread per element
+    of the full matrix. The other triangle of A is not referenced. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void tfttr_kernel(const rfp_layout L,
+                                   const rocblas_fill uplo,
+                                   const rocblas_int n,
+                                   U ARFA,
+                                   const rocblas_stride shiftARF,
+                                   const rocblas_stride strideARF,
+                                   U AA,
+                                   const rocblas_stride shiftA,
+                                   const rocblas_int lda,
+                                   const rocblas_stride strideA)
+{
+    const rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const rocblas_int j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+    const rocblas_int bid = hipBlockIdx_z;
+
+    if(i < n && j < n && (uplo == rocblas_fill_lower ? i >= j : i <= j))
+    {
+        T* ARF = load_ptr_batch<T>(ARFA, bid, shiftARF, strideARF);
+        T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+
+        bool cj;
+        const rocblas_stride idx = rfp_index(L, uplo, i, j, cj);
+        const T a = ARF[idx];
+        A[i + j * rocblas_stride(lda)] = cj ? conj(a) : a;
+    }
+}
+
+template <bool COMPLEX, typename T>
+rocblas_status rocsolver_tfttr_argCheck(rocblas_handle handle,
+                                        const rocblas_operation transr,
+                                        const rocblas_fill uplo,
+                                        const rocblas_int n,
+                                        const rocblas_int lda,
+                                        T ARF,
+                                        T A)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(transr != rocblas_operation_none && transr != rocblas_operation_transpose
+       && transr != rocblas_operation_conjugate_transpose)
+        return rocblas_status_invalid_value;
+    if((COMPLEX && transr == rocblas_operation_transpose)
+       || (!COMPLEX && transr == rocblas_operation_conjugate_transpose))
+        return rocblas_status_invalid_value;
+    if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(n < 0 || lda < n)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !ARF) || (n && !A))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T, typename U>
+rocblas_status rocsolver_tfttr_template(rocblas_handle handle,
+                                        const rocblas_operation transr,
+                                        const rocblas_fill uplo,
+                                        const rocblas_int n,
+                                        U ARF,
+                                        const rocblas_stride shiftARF,
+                                        const rocblas_stride strideARF,
+                                        U A,
+                                        const rocblas_stride shiftA,
+                                        const rocblas_int lda,
+                                        const rocblas_stride strideA,
+                                        const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER("tfttr", "transr:", transr, "uplo:", uplo, "n:", n, "shiftARF:", shiftARF,
+                    "shiftA:", shiftA, "lda:", lda, "bc:", batch_count);
+
+    // quick return
+    if(n == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocks = (n - 1) / BS2 + 1;
+    dim3 grid(blocks, blocks, batch_count);
+    dim3 threads(BS2, BS2, 1);
+
+    ROCSOLVER_LAUNCH_KERNEL(tfttr_kernel<T>, grid, threads, 0, stream,
+                            rfp_get_layout(transr, uplo, n), uplo, n, ARF, shiftARF, strideARF, A,
+                            shiftA, lda, strideA);
+
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
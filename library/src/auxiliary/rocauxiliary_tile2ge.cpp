@@ -0,0 +1,114 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "rocauxiliary_tile2ge.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+template <typename T>
+rocblas_status rocsolver_tile2ge_impl(rocblas_handle handle,
+                                      const rocblas_int m,
+                                      const rocblas_int n,
+                                      const rocblas_int nb,
+                                      T* TT,
+                                      T* A,
+                                      const rocblas_int lda)
+{
+    ROCSOLVER_ENTER_TOP("tile2ge", "-m", m, "-n", n, "--nb", nb, "--lda", lda);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    // (same requirements as GE2TILE)
+    rocblas_status st = rocsolver_ge2tile_argCheck(handle, m, n, nb, lda, A, TT);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // this function does not require memory work space
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_size_unchanged;
+
+    // execution
+    return rocsolver_tile2ge_template<T>(handle, m, n, nb, TT, A, lda);
+}
+
+ROCSOLVER_END_NAMESPACE
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_stile2ge(rocblas_handle handle,
+                                  const rocblas_int m,
+                                  const rocblas_int n,
+                                  const rocblas_int nb,
+                                  float* T,
+                                  float* A,
+                                  const rocblas_int lda)
+{
+    return rocsolver::rocsolver_tile2ge_impl<float>(handle, m, n, nb, T, A, lda);
+}
+
+rocblas_status rocsolver_dtile2ge(rocblas_handle handle,
+                                  const rocblas_int m,
+                                  const rocblas_int n,
+                                  const rocblas_int nb,
+                                  double* T,
+                                  double* A,
+                                  const rocblas_int lda)
+{
+    return rocsolver::rocsolver_tile2ge_impl<double>(handle, m, n, nb, T, A, lda);
+}
+
+rocblas_status rocsolver_ctile2ge(rocblas_handle handle,
+                                  const rocblas_int m,
+                                  const rocblas_int n,
+                                  const rocblas_int nb,
+                                  rocblas_float_complex* T,
+                                  rocblas_float_complex* A,
+                                  const rocblas_int lda)
+{
+    return rocsolver::rocsolver_tile2ge_impl<rocblas_float_complex>(handle, m, n, nb, T, A, lda);
+}
+
+rocblas_status rocsolver_ztile2ge(rocblas_handle handle,
+                                  const rocblas_int m,
+                                  const rocblas_int n,
+                                  const rocblas_int nb,
+                                  rocblas_double_complex* T,
+                                  rocblas_double_complex* A,
+                                  const rocblas_int lda)
+{
+    return rocsolver::rocsolver_tile2ge_impl<rocblas_double_complex>(handle, m, n, nb, T, A, lda);
+}
+
+} // extern C
@@ -0,0 +1,88 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "rocauxiliary_ge2tile.hpp"
+#include "rocblas.hpp"
+#include "rocsolver/rocsolver.h"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/** TILE2GE_KERNEL copies the tile array T into the m-by-n matrix A, with one thread per
+    element of A. The padding of the tiles is not referenced. **/
+template <typename T>
+ROCSOLVER_KERNEL void tile2ge_kernel(const rocblas_int m,
+                                     const rocblas_int n,
+                                     const rocblas_int nb,
+                                     const rocblas_int mt,
+                                     const T* TT,
+                                     T* A,
+                                     const rocblas_int lda)
+{
+    const rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const rocblas_int j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+
+    if(i < m && j < n)
+    {
+        const rocblas_int ti = i / nb, r = i % nb;
+        const rocblas_int tj = j / nb, c = j % nb;
+        A[i + j * rocblas_stride(lda)] = TT[tile_index(mt, nb, ti, tj) + r + c * nb];
+    }
+}
+
+template <typename T>
+rocblas_status rocsolver_tile2ge_template(rocblas_handle handle,
+                                          const rocblas_int m,
+                                          const rocblas_int n,
+                                          const rocblas_int nb,
+                                          const T* TT,
+                                          T* A,
+                                          const rocblas_int lda)
+{
+    ROCSOLVER_ENTER("tile2ge", "m:", m, "n:", n, "nb:", nb, "lda:", lda);
+
+    // quick return
+    if(m == 0 || n == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    const rocblas_int mt = tile_count(m, nb);
+    rocblas_int blocksx = (m - 1) / BS2 + 1;
+    rocblas_int blocksy = (n - 1) / BS2 + 1;
+    dim3 grid(blocksx, blocksy, 1);
+    dim3 threads(BS2, BS2, 1);
+
+    ROCSOLVER_LAUNCH_KERNEL(tile2ge_kernel<T>, grid, threads, 0, stream, m, n, nb, mt, TT, A,
+                            lda);
+
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
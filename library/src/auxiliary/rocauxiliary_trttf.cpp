@@ -0,0 +1,127 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "rocauxiliary_trttf.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+template <typename T, typename U>
+rocblas_status rocsolver_trttf_impl(rocblas_handle handle,
+                                    const rocblas_operation transr,
+                                    const rocblas_fill uplo,
+                                    const rocblas_int n,
+                                    U A,
+                                    const rocblas_int lda,
+                                    U ARF)
+{
+    ROCSOLVER_ENTER_TOP("trttf", "--transr", transr, "--uplo", uplo, "-n", n, "--lda", lda);
+
+    static constexpr bool COMPLEX = rocblas_is_complex<T>;
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_trttf_argCheck<COMPLEX>(handle, transr, uplo, n, lda, A, ARF);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_stride shiftA = 0;
+    rocblas_stride shiftARF = 0;
+
+    // normal (non-batched non-strided) execution
+    rocblas_stride strideA = 0;
+    rocblas_stride strideARF = 0;
+    rocblas_int batch_count = 1;
+
+    // this function does not require memory work space
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_size_unchanged;
+
+    // execution
+    return rocsolver_trttf_template<T>(handle, transr, uplo, n, A, shiftA, lda, strideA, ARF,
+                                       shiftARF, strideARF, batch_count);
+}
+
+ROCSOLVER_END_NAMESPACE
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_strttf(rocblas_handle handle,
+                                const rocblas_operation transr,
+                                const rocblas_fill uplo,
+                                const rocblas_int n,
+                                float* A,
+                                const rocblas_int lda,
+                                float* ARF)
+{
+    return rocsolver::rocsolver_trttf_impl<float>(handle, transr, uplo, n, A, lda, ARF);
+}
+
+rocblas_status rocsolver_dtrttf(rocblas_handle handle,
+                                const rocblas_operation transr,
+                                const rocblas_fill uplo,
+                                const rocblas_int n,
+                                double* A,
+                                const rocblas_int lda,
+                                double* ARF)
+{
+    return rocsolver::rocsolver_trttf_impl<double>(handle, transr, uplo, n, A, lda, ARF);
+}
+
+rocblas_status rocsolver_ctrttf(rocblas_handle handle,
+                                const rocblas_operation transr,
+                                const rocblas_fill uplo,
+                                const rocblas_int n,
+                                rocblas_float_complex* A,
+                                const rocblas_int lda,
+                                rocblas_float_complex* ARF)
+{
+    return rocsolver::rocsolver_trttf_impl<rocblas_float_complex>(handle, transr, uplo, n, A, lda,
+                                                                  ARF);
+}
+
+rocblas_status rocsolver_ztrttf(rocblas_handle handle,
+                                const rocblas_operation transr,
+                                const rocblas_fill uplo,
+                                const rocblas_int n,
+                                rocblas_double_complex* A,
+                                const rocblas_int lda,
+                                rocblas_double_complex* ARF)
+{
+    return rocsolver::rocsolver_trttf_impl<rocblas_double_complex>(handle, transr, uplo, n, A, lda,
+                                                                   ARF);
+}
+
+} // extern C
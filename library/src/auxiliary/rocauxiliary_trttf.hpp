@@ -0,0 +1,260 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "rocsolver/rocsolver.h"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/** RFP_LAYOUT describes the rectangular full packed (RFP) storage of a symmetric/Hermitian matrix
+    A of order n, split as A = [A11 A21'; A21 A22] with A11 of order n1 and A22 of order n2. The
+    RFP array is a full matrix with leading dimension ld that holds the fill11 triangle of A11 at
+    shift11, the fill22 triangle of A22 at shift22, and the off-diagonal block at shiftS; the
+    off-diagonal block is A21 (n2-by-n1) if below is true, and A12 = A21' (n1-by-n2) otherwise.
+    This is the same arrangement as in LAPACK, so that each block can be used directly by POTRF,
+    TRSM, SYRK/HERK and the other routines working on full storage. **/
+struct rfp_layout
+{
+    rocblas_int n1, n2, ld;
+    rocblas_stride shift11, shift22, shiftS;
+    rocblas_fill fill11, fill22;
+    bool below;
+};
+
+inline rfp_layout rfp_get_layout(const rocblas_operation transr,
+                                 const rocblas_fill uplo,
+                                 const rocblas_int n)
+{
+    rfp_layout L;
+    const bool lower = (uplo == rocblas_fill_lower);
+    const bool odd = (n % 2 == 1);
+    const rocblas_int k = n / 2;
+
+    if(odd && lower)
+    {
+        L.n1 = n - k;
+        L.n2 = k;
+    }
+    else
+    {
+        L.n1 = k;
+        L.n2 = n - k;
+    }
+
+    // positions in the non-transposed array, with n (or n+1) rows and (n+1)/2 (or n/2) columns
+    const rocblas_int ldN = odd ? n : n + 1;
+    const rocblas_int ldT = odd ? (n + 1) / 2 : k;
+    rocblas_stride s11, s22, sS;
+    if(lower)
+    {
+        s11 = odd ? 0 : 1;
+        sS = odd ? L.n1 : k + 1;
+        s22 = odd ? n : 0;
+    }
+    else
+    {
+        s11 = odd ? L.n2 : k + 1;
+        sS = 0;
+        s22 = odd ? L.n1 : k;
+    }
+
+    if(transr == rocblas_operation_none)
+    {
+        L.ld = ldN;
+        L.shift11 = s11;
+        L.shift22 = s22;
+        L.shiftS = sS;
+        L.fill11 = rocblas_fill_lower;
+        L.fill22 = rocblas_fill_upper;
+        L.below = lower;
+    }
+    else
+    {
+        // the transposed array is the (conjugate) transpose of the non-transposed one
+        L.ld = ldT;
+        L.shift11 = (s11 / ldN) + (s11 % ldN) * ldT;
+        L.shift22 = (s22 / ldN) + (s22 % ldN) * ldT;
+        L.shiftS = (sS / ldN) + (sS % ldN) * ldT;
+        L.fill11 = rocblas_fill_upper;
+        L.fill22 = rocblas_fill_lower;
+        L.below = !lower;
+    }
+
+    return L;
+}
+
+/** RFP_OP returns the operation that must be applied to the triangle stored with the given
+    fill in order to use the lower triangular block C of a factorization A = C * C' (if ctrans is
+    false) or the block C' (if ctrans is true). **/
+inline rocblas_operation rfp_op(const rocblas_fill fill, const bool ctrans)
+{
+    return ((fill == rocblas_fill_lower) == ctrans) ? rocblas_operation_conjugate_transpose
+                                                    : rocblas_operation_none;
+}
+
+/** RFP_INDEX returns the position in the RFP array of the element (i,j) in the uplo triangle of
+    the full matrix, and whether it is stored conjugated. **/
+__device__ inline rocblas_stride
+    rfp_index(const rfp_layout L, const rocblas_fill uplo, rocblas_int i, rocblas_int j, bool& cj)
+{
+    rocblas_stride shift;
+    rocblas_fill fill;
+    bool stored;
+
+    if(i < L.n1 && j < L.n1)
+    {
+        shift = L.shift11;
+        fill = L.fill11;
+        stored = (fill == uplo);
+    }
+    else if(i >= L.n1 && j >= L.n1)
+    {
+        i -= L.n1;
+        j -= L.n1;
+        shift = L.shift22;
+        fill = L.fill22;
+        stored = (fill == uplo);
+    }
+    else
+    {
+        // element of A21 if lower, or of A12 if upper
+        if(uplo == rocblas_fill_lower)
+            i -= L.n1;
+        else
+            j -= L.n1;
+        shift = L.shiftS;
+        stored = (L.below == (uplo == rocblas_fill_lower));
+    }
+
+    cj = !stored;
+    return stored ? shift + i + j * rocblas_stride(L.ld) : shift + j + i * rocblas_stride(L.ld);
+}
+
+/** TRTTF_KERNEL copies the uplo triangle of A into the RFP array ARF, with one thread per element
+    of the full matrix. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void trttf_kernel(const rfp_layout L,
+                                   const rocblas_fill uplo,
+                                   const rocblas_int n,
+                                   U AA,
+                                   const rocblas_stride shiftA,
+                                   const rocblas_int lda,
+                                   const rocblas_stride strideA,
+                                   U ARFA,
+                                   const rocblas_stride shiftARF,
+                                   const rocblas_stride strideARF)
+{
+    const rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const rocblas_int j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+    const rocblas_int bid = hipBlockIdx_z;
+
+    if(i < n && j < n && (uplo == rocblas_fill_lower ? i >= j : i <= j))
+    {
+        T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+        T* ARF = load_ptr_batch<T>(ARFA, bid, shiftARF, strideARF);
+
+        bool cj;
+        const rocblas_stride idx = rfp_index(L, uplo, i, j, cj);
+        const T a = A[i + j * rocblas_stride(lda)];
+        ARF[idx] = cj ? conj(a) : a;
+    }
+}
+
+template <bool COMPLEX, typename T>
+rocblas_status rocsolver_trttf_argCheck(rocblas_handle handle,
+                                        const rocblas_operation transr,
+                                        const rocblas_fill uplo,
+                                        const rocblas_int n,
+                                        const rocblas_int lda,
+                                        T A,
+                                        T ARF)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(transr != rocblas_operation_none && transr != rocblas_operation_transpose
+       && transr != rocblas_operation_conjugate_transpose)
+        return rocblas_status_invalid_value;
+    if((COMPLEX && transr == rocblas_operation_transpose)
+       || (!COMPLEX && transr == rocblas_operation_conjugate_transpose))
+        return rocblas_status_invalid_value;
+    if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(n < 0 || lda < n)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !A) || (n && !ARF))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T, typename U>
+rocblas_status rocsolver_trttf_template(rocblas_handle handle,
+                                        const rocblas_operation transr,
+                                        const rocblas_fill uplo,
+                                        const rocblas_int n,
+                                        U A,
+                                        const rocblas_stride shiftA,
+                                        const rocblas_int lda,
+                                        const rocblas_stride strideA,
+                                        U ARF,
+                                        const rocblas_stride shiftARF,
+                                        const rocblas_stride strideARF,
+                                        const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER("trttf", "transr:", transr, "uplo:", uplo, "n:", n, "shiftA:", shiftA,
+                    "lda:", lda, "shiftARF:", shiftARF, "bc:", batch_count);
+
+    // quick return
+    if(n == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocks = (n - 1) / BS2 + 1;
+    dim3 grid(blocks, blocks, batch_count);
+    dim3 threads(BS2, BS2, 1);
+
+    ROCSOLVER_LAUNCH_KERNEL(trttf_kernel<T>, grid, threads, 0, stream,
+                            rfp_get_layout(transr, uplo, n), uplo, n, A, shiftA, lda, strideA, ARF,
+                            shiftARF, strideARF);
+
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
@@ -0,0 +1,134 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include <map>
+#include <mutex>
+#include <utility>
+
+#include "rocsolver_alg_mode.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+// the selected algorithms, keyed by handle and function
+// (rocSOLVER does not own the handle, so the selections cannot be stored in it)
+static std::mutex alg_mode_mutex;
+static std::map<std::pair<rocblas_handle, rocsolver_function>, rocsolver_alg_mode> alg_modes;
+
+rocsolver_alg_mode get_alg_mode(rocblas_handle handle, const rocsolver_function func)
+{
+    std::lock_guard<std::mutex> lock(alg_mode_mutex);
+    auto it = alg_modes.find({handle, func});
+    return (it == alg_modes.end()) ? rocsolver_alg_mode_qr : it->second;
+}
+
+void release_alg_mode(rocblas_handle handle)
+{
+    std::lock_guard<std::mutex> lock(alg_mode_mutex);
+    for(auto it = alg_modes.begin(); it != alg_modes.end();)
+    {
+        if(it->first.first == handle)
+            it = alg_modes.erase(it);
+        else
+            ++it;
+    }
+}
+
+ROCSOLVER_END_NAMESPACE
+
+extern "C" rocblas_status rocsolver_set_alg_mode(rocblas_handle handle,
+                                                 const rocsolver_function func,
+                                                 const rocsolver_alg_mode mode)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    if(func == rocsolver_function_gesvd)
+    {
+        if(mode != rocsolver_alg_mode_qr && mode != rocsolver_alg_mode_dc
+           && mode != rocsolver_alg_mode_hybrid)
+            return rocblas_status_invalid_value;
+    }
+    else if(func == rocsolver_function_bdsqr)
+    {
+        if(mode != rocsolver_alg_mode_qr && mode != rocsolver_alg_mode_hybrid)
+            return rocblas_status_invalid_value;
+    }
+    else if(func == rocsolver_function_getrf)
+    {
+        if(mode != rocsolver_alg_mode_qr && mode != rocsolver_alg_mode_prefetch
+           && mode != rocsolver_alg_mode_tournament && mode != rocsolver_alg_mode_compact)
+            return rocblas_status_invalid_value;
+    }
+    else if(func == rocsolver_function_potrf)
+    {
+        if(mode != rocsolver_alg_mode_qr && mode != rocsolver_alg_mode_prefetch)
+            return rocblas_status_invalid_value;
+    }
+    else if(func == rocsolver_function_gesvdj)
+    {
+        if(mode != rocsolver_alg_mode_qr && mode != rocsolver_alg_mode_qr_precond
+           && mode != rocsolver_alg_mode_mixed)
+            return rocblas_status_invalid_value;
+    }
+    else if(func == rocsolver_function_syevj)
+    {
+        if(mode != rocsolver_alg_mode_qr && mode != rocsolver_alg_mode_mixed)
+            return rocblas_status_invalid_value;
+    }
+    else if(func == rocsolver_function_cholqr)
+    {
+        if(mode != rocsolver_alg_mode_qr && mode != rocsolver_alg_mode_shifted)
+            return rocblas_status_invalid_value;
+    }
+    else
+        return rocblas_status_invalid_value;
+
+    std::lock_guard<std::mutex> lock(rocsolver::alg_mode_mutex);
+    rocsolver::alg_modes[{handle, func}] = mode;
+
+    return rocblas_status_success;
+}
+
+extern "C" rocblas_status rocsolver_get_alg_mode(rocblas_handle handle,
+                                                 const rocsolver_function func,
+                                                 rocsolver_alg_mode* mode)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    if(func != rocsolver_function_gesvd && func != rocsolver_function_bdsqr
+       && func != rocsolver_function_getrf && func != rocsolver_function_potrf
+       && func != rocsolver_function_gesvdj && func != rocsolver_function_syevj
+       && func != rocsolver_function_cholqr)
+        return rocblas_status_invalid_value;
+    if(!mode)
+        return rocblas_status_invalid_pointer;
+
+    *mode = rocsolver::get_alg_mode(handle, func);
+
+    return rocblas_status_success;
+}
@@ -0,0 +1,225 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <mutex>
+#include <unordered_map>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/file.h>
+#include <unistd.h>
+#endif
+
+#include <fmt/format.h>
+#include <hip/hip_runtime.h>
+#include <rocblas/rocblas.h>
+
+#include "rocsolver/rocsolver.h"
+#include "rocsolver_cache.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+namespace fs = std::filesystem;
+
+/***************************************************************************
+ * Locks
+ ***************************************************************************/
+
+#ifndef _WIN32
+rocsolver_cache_lock::rocsolver_cache_lock(const std::string& path, const bool exclusive)
+{
+    fd = open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if(fd >= 0 && flock(fd, exclusive ? LOCK_EX : LOCK_SH) != 0)
+    {
+        close(fd);
+        fd = -1;
+    }
+}
+
+rocsolver_cache_lock::~rocsolver_cache_lock()
+{
+    // closing the file releases the lock
+    if(fd >= 0)
+        close(fd);
+}
+#else
+rocsolver_cache_lock::rocsolver_cache_lock(const std::string& path, const bool exclusive)
+    : fd(-1)
+{
+}
+
+rocsolver_cache_lock::~rocsolver_cache_lock() {}
+#endif
+
+/***************************************************************************
+ * Directories
+ ***************************************************************************/
+
+static fs::path cache_root()
+{
+#ifndef _WIN32
+    const char* path = std::getenv("ROCSOLVER_CACHE_PATH");
+    if(path)
+        return fs::path(path);
+
+    const char* xdg = std::getenv("XDG_CACHE_HOME");
+    if(xdg && *xdg)
+        return fs::path(xdg) / "rocsolver";
+
+    const char* home = std::getenv("HOME");
+    if(home && *home)
+        return fs::path(home) / ".cache" / "rocsolver";
+#endif
+
+    return fs::path();
+}
+
+// rocSOLVER, rocBLAS and HIP runtime versions
+static std::string cache_versions()
+{
+    char rocblas_version[128] = "";
+    rocblas_get_version_string(rocblas_version, sizeof(rocblas_version));
+    int hip_version = 0;
+    (void)hipRuntimeGetVersion(&hip_version);
+
+    std::string versions = fmt::format("rocsolver-{}.{}.{}-rocblas-{}-hip-{}",
+                                       ROCSOLVER_VERSION_MAJOR, ROCSOLVER_VERSION_MINOR,
+                                       ROCSOLVER_VERSION_PATCH, rocblas_version, hip_version);
+    for(char& c : versions)
+        if(c == ' ' || c == '/')
+            c = '_';
+    return versions;
+}
+
+std::string rocsolver_device_arch(const int device)
+{
+    static std::mutex mutex;
+    static std::unordered_map<int, std::string> archs;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = archs.find(device);
+    if(it != archs.end())
+        return it->second;
+
+    hipDeviceProp_t props;
+    std::string arch;
+    if(hipGetDeviceProperties(&props, device) == hipSuccess)
+        arch = props.gcnArchName;
+    archs[device] = arch;
+    return arch;
+}
+
+std::string rocsolver_cache_dir(const int device, const bool versioned)
+{
+    static const fs::path root = cache_root();
+    static const std::string versions = cache_versions();
+    if(root.empty())
+        return std::string();
+
+    std::string arch = rocsolver_device_arch(device);
+    if(arch.empty())
+        return std::string();
+    for(char& c : arch)
+        if(c == ':')
+            c = '_';
+
+    fs::path dir = root / arch;
+    if(versioned)
+        dir /= versions;
+
+    std::error_code ec;
+    fs::create_directories(dir, ec);
+    if(ec)
+        return std::string();
+    return dir.string();
+}
+
+/***************************************************************************
+ * Files
+ ***************************************************************************/
+
+bool rocsolver_cache_read(const std::string& path, std::vector<char>& data)
+{
+    std::ifstream in(path, std::ios::binary);
+    if(!in.good())
+        return false;
+    data.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    return !data.empty();
+}
+
+bool rocsolver_cache_write(const std::string& path, const std::vector<char>& data)
+{
+    // the temporary file is unique to the process and the call, so that concurrent
+    // writers do not interfere; the last rename wins
+    static std::atomic<int> count(0);
+#ifndef _WIN32
+    std::string tmp = fmt::format("{}.{}.{}.tmp", path, getpid(), count++);
+#else
+    std::string tmp = fmt::format("{}.{}.tmp", path, count++);
+#endif
+
+    std::error_code ec;
+    {
+        std::ofstream out(tmp, std::ios::binary);
+        if(!out.good())
+            return false;
+        out.write(data.data(), data.size());
+        if(!out.good())
+        {
+            out.close();
+            fs::remove(tmp, ec);
+            return false;
+        }
+    }
+
+    fs::rename(tmp, path, ec);
+    if(ec)
+    {
+        fs::remove(tmp, ec);
+        return false;
+    }
+    return true;
+}
+
+bool rocsolver_cache_append(const std::string& path, const std::string& line)
+{
+    rocsolver_cache_lock lock(path + ".lock", true);
+    if(!lock.locked())
+        return false;
+
+    std::ofstream out(path, std::ios::app);
+    out << line << '\n';
+    return out.good();
+}
+
+ROCSOLVER_END_NAMESPACE
@@ -0,0 +1,88 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include <mutex>
+#include <unordered_set>
+
+#include "rocsolver_check_mode.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+// the handles whose argument checks are disabled
+// (rocSOLVER does not own the handle, so the setting cannot be stored in it)
+static std::mutex check_mode_mutex;
+static std::unordered_set<rocblas_handle> unchecked_handles;
+
+std::atomic<int> num_unchecked_handles{0};
+
+bool get_check_mode_none(rocblas_handle handle)
+{
+    std::lock_guard<std::mutex> lock(check_mode_mutex);
+    return unchecked_handles.count(handle) > 0;
+}
+
+void release_check_mode(rocblas_handle handle)
+{
+    std::lock_guard<std::mutex> lock(check_mode_mutex);
+    unchecked_handles.erase(handle);
+    num_unchecked_handles.store(int(unchecked_handles.size()));
+}
+
+ROCSOLVER_END_NAMESPACE
+
+extern "C" rocblas_status rocsolver_set_check_mode(rocblas_handle handle,
+                                                   const rocsolver_check_mode mode)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    if(mode != rocsolver_check_mode_full && mode != rocsolver_check_mode_none)
+        return rocblas_status_invalid_value;
+
+    std::lock_guard<std::mutex> lock(rocsolver::check_mode_mutex);
+    if(mode == rocsolver_check_mode_none)
+        rocsolver::unchecked_handles.insert(handle);
+    else
+        rocsolver::unchecked_handles.erase(handle);
+    rocsolver::num_unchecked_handles.store(int(rocsolver::unchecked_handles.size()));
+
+    return rocblas_status_success;
+}
+
+extern "C" rocblas_status rocsolver_get_check_mode(rocblas_handle handle,
+                                                   rocsolver_check_mode* mode)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!mode)
+        return rocblas_status_invalid_pointer;
+
+    *mode = rocsolver::skip_arg_checks(handle) ? rocsolver_check_mode_none
+                                               : rocsolver_check_mode_full;
+
+    return rocblas_status_success;
+}
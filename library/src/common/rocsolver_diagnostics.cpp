@@ -0,0 +1,75 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+#include "rocsolver_diagnostics.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+// the registered diagnostics buffers and their sizes, keyed by handle
+// (rocSOLVER does not own the handle, so the buffers cannot be stored in it)
+static std::mutex diagnostics_mutex;
+static std::unordered_map<rocblas_handle, std::pair<rocsolver_diagnostics*, rocblas_int>>
+    diagnostics_buffers;
+
+rocsolver_diagnostics* get_diagnostics(rocblas_handle handle, const rocblas_int batch_count)
+{
+    std::lock_guard<std::mutex> lock(diagnostics_mutex);
+    auto it = diagnostics_buffers.find(handle);
+    if(it == diagnostics_buffers.end() || batch_count > it->second.second)
+        return nullptr;
+    return it->second.first;
+}
+
+void release_diagnostics(rocblas_handle handle)
+{
+    std::lock_guard<std::mutex> lock(diagnostics_mutex);
+    diagnostics_buffers.erase(handle);
+}
+
+ROCSOLVER_END_NAMESPACE
+
+extern "C" rocblas_status rocsolver_set_diagnostics(rocblas_handle handle,
+                                                    rocsolver_diagnostics* diag,
+                                                    const rocblas_int size)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    if(size < 0)
+        return rocblas_status_invalid_size;
+
+    std::lock_guard<std::mutex> lock(rocsolver::diagnostics_mutex);
+    if(diag)
+        rocsolver::diagnostics_buffers[handle] = {diag, size};
+    else
+        rocsolver::diagnostics_buffers.erase(handle);
+
+    return rocblas_status_success;
+}
@@ -0,0 +1,58 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "rocsolver/rocsolver.h"
+#include "rocsolver_alg_mode.hpp"
+#include "rocsolver_check_mode.hpp"
+#include "rocsolver_diagnostics.hpp"
+#include "rocsolver_gemm_mode.hpp"
+#include "rocsolver_info_summary.hpp"
+#include "rocsolver_stats.hpp"
+#include "rocsolver_streams.hpp"
+#include "rocsolver_thread_mode.hpp"
+
+// the settings of the handles are kept by rocSOLVER keyed by the handle (rocSOLVER does not own
+// it), so they must be dropped before the handle is destroyed; otherwise, a new handle created
+// at the same address would inherit them
+extern "C" rocblas_status rocsolver_release_handle(rocblas_handle handle)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    rocsolver::release_check_mode(handle);
+    rocsolver::release_alg_mode(handle);
+    rocsolver::release_gemm_mode(handle);
+    rocsolver::release_thread_mode(handle);
+    rocsolver::release_cu_mask(handle);
+    rocsolver::release_handle_streams(handle);
+    rocsolver::release_workspace_pool(handle);
+    rocsolver::release_diagnostics(handle);
+    rocsolver::release_info_summary(handle);
+    rocsolver::release_stats(handle);
+
+    return rocblas_status_success;
+}
@@ -0,0 +1,272 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#ifdef HAVE_HIPBLASLT
+
+#include <algorithm>
+#include <cstdlib>
+#include <mutex>
+#include <unordered_map>
+
+#include <hipblaslt/hipblaslt.h>
+
+#include "ideal_sizes.hpp"
+#include "rocsolver_hipblaslt.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+// returns true unless the environment variable ROCSOLVER_HIPBLASLT disables the backend
+// (it is only read once)
+static bool rocsolver_hipblaslt_enabled()
+{
+    static const bool enabled = [] {
+        const char* str = std::getenv("ROCSOLVER_HIPBLASLT");
+        return !str || std::strtol(str, nullptr, 0) != 0;
+    }();
+    return enabled;
+}
+
+// returns the hipBLASLt handle of the current device, or nullptr if it cannot be created
+// (rocSOLVER does not own the rocblas_handle, so the hipBLASLt handles are kept for the lifetime
+// of the process, one per device)
+static hipblasLtHandle_t rocsolver_hipblaslt_handle()
+{
+    static std::mutex mutex;
+    static std::unordered_map<int, hipblasLtHandle_t> handles;
+
+    int device;
+    if(hipGetDevice(&device) != hipSuccess)
+        return nullptr;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = handles.find(device);
+    if(it != handles.end())
+        return it->second;
+
+    hipblasLtHandle_t lt = nullptr;
+    if(hipblasLtCreate(&lt) != HIPBLAS_STATUS_SUCCESS)
+        lt = nullptr;
+    handles[device] = lt;
+    return lt;
+}
+
+static hipblasOperation_t rocsolver_hipblaslt_op(rocblas_operation trans)
+{
+    return (trans == rocblas_operation_none ? HIPBLAS_OP_N : HIPBLAS_OP_T);
+}
+
+// creates the layout of a (strided batched) column-major matrix
+static bool rocsolver_hipblaslt_layout(hipblasLtMatrixLayout_t* layout,
+                                       hipDataType type,
+                                       rocblas_int rows,
+                                       rocblas_int cols,
+                                       rocblas_int ld,
+                                       rocblas_stride stride,
+                                       rocblas_int batch_count)
+{
+    if(hipblasLtMatrixLayoutCreate(layout, type, rows, cols, ld) != HIPBLAS_STATUS_SUCCESS)
+        return false;
+
+    int32_t bc = batch_count;
+    int64_t st = stride;
+    if(hipblasLtMatrixLayoutSetAttribute(*layout, HIPBLASLT_MATRIX_LAYOUT_BATCH_COUNT, &bc,
+                                         sizeof(bc))
+           != HIPBLAS_STATUS_SUCCESS
+       || hipblasLtMatrixLayoutSetAttribute(*layout, HIPBLASLT_MATRIX_LAYOUT_STRIDED_BATCH_OFFSET,
+                                            &st, sizeof(st))
+           != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblasLtMatrixLayoutDestroy(*layout);
+        *layout = nullptr;
+        return false;
+    }
+    return true;
+}
+
+template <typename T>
+static bool rocsolver_hipblaslt_gemm_template(rocblas_handle handle,
+                                              hipDataType type,
+                                              hipblasComputeType_t compute_type,
+                                              rocblas_operation trans_a,
+                                              rocblas_operation trans_b,
+                                              rocblas_int m,
+                                              rocblas_int n,
+                                              rocblas_int k,
+                                              const T* alpha,
+                                              const T* A,
+                                              rocblas_int ld_a,
+                                              rocblas_stride stride_a,
+                                              const T* B,
+                                              rocblas_int ld_b,
+                                              rocblas_stride stride_b,
+                                              const T* beta,
+                                              T* C,
+                                              rocblas_int ld_c,
+                                              rocblas_stride stride_c,
+                                              rocblas_int batch_count)
+{
+    // only the skinny updates of the trailing matrix are computed with hipBLASLt
+    if(m <= 0 || n <= 0 || k <= 0 || batch_count <= 0 || k > HIPBLASLT_GEMM_MAX_K
+       || std::max(m, n) < HIPBLASLT_GEMM_MIN_RATIO * k)
+        return false;
+    if(rocblas_is_device_memory_size_query(handle) || !rocsolver_hipblaslt_enabled())
+        return false;
+
+    hipblasLtHandle_t lt = rocsolver_hipblaslt_handle();
+    if(!lt)
+        return false;
+
+    hipStream_t stream;
+    rocblas_pointer_mode pmode;
+    rocblas_get_stream(handle, &stream);
+    rocblas_get_pointer_mode(handle, &pmode);
+
+    hipblasOperation_t op_a = rocsolver_hipblaslt_op(trans_a);
+    hipblasOperation_t op_b = rocsolver_hipblaslt_op(trans_b);
+    hipblasLtPointerMode_t lt_pmode = (pmode == rocblas_pointer_mode_device
+                                           ? HIPBLASLT_POINTER_MODE_DEVICE
+                                           : HIPBLASLT_POINTER_MODE_HOST);
+    hipblasLtEpilogue_t epilogue = HIPBLASLT_EPILOGUE_DEFAULT;
+    uint64_t max_workspace = 0;
+
+    hipblasLtMatmulDesc_t desc = nullptr;
+    hipblasLtMatrixLayout_t layout_a = nullptr, layout_b = nullptr, layout_c = nullptr;
+    hipblasLtMatmulPreference_t pref = nullptr;
+    hipblasLtMatmulHeuristicResult_t result;
+    int returned = 0;
+
+    // the descriptors are destroyed below whether the GEMM is computed or not
+    auto run = [&]() -> bool {
+        if(hipblasLtMatmulDescCreate(&desc, compute_type, type) != HIPBLAS_STATUS_SUCCESS)
+            return false;
+        if(hipblasLtMatmulDescSetAttribute(desc, HIPBLASLT_MATMUL_DESC_TRANSA, &op_a, sizeof(op_a))
+               != HIPBLAS_STATUS_SUCCESS
+           || hipblasLtMatmulDescSetAttribute(desc, HIPBLASLT_MATMUL_DESC_TRANSB, &op_b,
+                                              sizeof(op_b))
+               != HIPBLAS_STATUS_SUCCESS
+           || hipblasLtMatmulDescSetAttribute(desc, HIPBLASLT_MATMUL_DESC_POINTER_MODE, &lt_pmode,
+                                              sizeof(lt_pmode))
+               != HIPBLAS_STATUS_SUCCESS
+           || hipblasLtMatmulDescSetAttribute(desc, HIPBLASLT_MATMUL_DESC_EPILOGUE, &epilogue,
+                                              sizeof(epilogue))
+               != HIPBLAS_STATUS_SUCCESS)
+            return false;
+
+        bool nota = (op_a == HIPBLAS_OP_N);
+        bool notb = (op_b == HIPBLAS_OP_N);
+        if(!rocsolver_hipblaslt_layout(&layout_a, type, (nota ? m : k), (nota ? k : m), ld_a,
+                                       stride_a, batch_count)
+           || !rocsolver_hipblaslt_layout(&layout_b, type, (notb ? k : n), (notb ? n : k), ld_b,
+                                          stride_b, batch_count)
+           || !rocsolver_hipblaslt_layout(&layout_c, type, m, n, ld_c, stride_c, batch_count))
+            return false;
+
+        // no workspace is given to hipBLASLt
+        if(hipblasLtMatmulPreferenceCreate(&pref) != HIPBLAS_STATUS_SUCCESS
+           || hipblasLtMatmulPreferenceSetAttribute(pref, HIPBLASLT_MATMUL_PREF_MAX_WORKSPACE_BYTES,
+                                                    &max_workspace, sizeof(max_workspace))
+               != HIPBLAS_STATUS_SUCCESS)
+            return false;
+
+        if(hipblasLtMatmulAlgoGetHeuristic(lt, desc, layout_a, layout_b, layout_c, layout_c, pref,
+                                           1, &result, &returned)
+               != HIPBLAS_STATUS_SUCCESS
+           || returned == 0)
+            return false;
+
+        return hipblasLtMatmul(lt, desc, alpha, A, layout_a, B, layout_b, beta, C, layout_c, C,
+                               layout_c, &result.algo, nullptr, 0, stream)
+            == HIPBLAS_STATUS_SUCCESS;
+    };
+    bool done = run();
+
+    if(pref)
+        hipblasLtMatmulPreferenceDestroy(pref);
+    if(layout_c)
+        hipblasLtMatrixLayoutDestroy(layout_c);
+    if(layout_b)
+        hipblasLtMatrixLayoutDestroy(layout_b);
+    if(layout_a)
+        hipblasLtMatrixLayoutDestroy(layout_a);
+    if(desc)
+        hipblasLtMatmulDescDestroy(desc);
+
+    // when no hipBLASLt solution is available, the GEMM is computed with rocBLAS
+    return done;
+}
+
+bool rocsolver_hipblaslt_gemm(rocblas_handle handle,
+                              rocblas_operation trans_a,
+                              rocblas_operation trans_b,
+                              rocblas_int m,
+                              rocblas_int n,
+                              rocblas_int k,
+                              const float* alpha,
+                              const float* A,
+                              rocblas_int ld_a,
+                              rocblas_stride stride_a,
+                              const float* B,
+                              rocblas_int ld_b,
+                              rocblas_stride stride_b,
+                              const float* beta,
+                              float* C,
+                              rocblas_int ld_c,
+                              rocblas_stride stride_c,
+                              rocblas_int batch_count)
+{
+    return rocsolver_hipblaslt_gemm_template(handle, HIP_R_32F, HIPBLAS_COMPUTE_32F, trans_a,
+                                             trans_b, m, n, k, alpha, A, ld_a, stride_a, B, ld_b,
+                                             stride_b, beta, C, ld_c, stride_c, batch_count);
+}
+
+bool rocsolver_hipblaslt_gemm(rocblas_handle handle,
+                              rocblas_operation trans_a,
+                              rocblas_operation trans_b,
+                              rocblas_int m,
+                              rocblas_int n,
+                              rocblas_int k,
+                              const double* alpha,
+                              const double* A,
+                              rocblas_int ld_a,
+                              rocblas_stride stride_a,
+                              const double* B,
+                              rocblas_int ld_b,
+                              rocblas_stride stride_b,
+                              const double* beta,
+                              double* C,
+                              rocblas_int ld_c,
+                              rocblas_stride stride_c,
+                              rocblas_int batch_count)
+{
+    return rocsolver_hipblaslt_gemm_template(handle, HIP_R_64F, HIPBLAS_COMPUTE_64F, trans_a,
+                                             trans_b, m, n, k, alpha, A, ld_a, stride_a, B, ld_b,
+                                             stride_b, beta, C, ld_c, stride_c, batch_count);
+}
+
+ROCSOLVER_END_NAMESPACE
+
+#endif
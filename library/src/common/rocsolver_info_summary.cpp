@@ -0,0 +1,239 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+
+#include "lib_device_helpers.hpp"
+#include "rocsolver_info_summary.hpp"
+#include "rocsolver_logger.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+// the registered summary buffers and callbacks, keyed by handle
+// (rocSOLVER does not own the handle, so the buffers cannot be stored in it; the counter
+// lets the functions skip the look-up when no buffer is registered)
+struct info_summary_entry
+{
+    rocsolver_info_summary* summary = nullptr;
+    rocsolver_info_callback callback = nullptr;
+    void* user_data = nullptr;
+    uint64_t sequence = 0;
+};
+
+static std::mutex info_summary_mutex;
+static std::unordered_map<rocblas_handle, info_summary_entry> info_summary_entries;
+static std::atomic<int> info_summary_count{0};
+
+/** INFO_SUMMARY_KERNEL counts the nonzero entries of info, and finds the first one. It also
+    finds the largest number of sweeps and residual, if given. The sequence number is written
+    last (after a system-wide fence), so that the host can poll it when the summary is in
+    pinned host memory. (A single thread-block reads the whole array) **/
+template <typename I, typename S>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) info_summary_kernel(const I* info,
+                                                                 const int64_t batch_count,
+                                                                 const rocblas_int* n_sweeps,
+                                                                 const S* residual,
+                                                                 const uint64_t sequence,
+                                                                 rocsolver_info_summary* summary)
+{
+    rocblas_int tid = hipThreadIdx_x;
+
+    __shared__ rocblas_int scount[BS1];
+    __shared__ int64_t sfirst[BS1];
+    __shared__ rocblas_int ssweeps[BS1];
+    __shared__ double sresidual[BS1];
+
+    rocblas_int count = 0;
+    int64_t first = batch_count;
+    rocblas_int sweeps = 0;
+    double res = 0;
+    for(int64_t b = tid; b < batch_count; b += BS1)
+    {
+        if(info[b] != 0)
+        {
+            count++;
+            first = (b < first ? b : first);
+        }
+        if(n_sweeps)
+            sweeps = max(sweeps, n_sweeps[b]);
+        if(residual)
+            res = fmax(res, double(residual[b]));
+    }
+    scount[tid] = count;
+    sfirst[tid] = first;
+    ssweeps[tid] = sweeps;
+    sresidual[tid] = res;
+    __syncthreads();
+
+    for(rocblas_int i = BS1 / 2; i > 0; i /= 2)
+    {
+        if(tid < i)
+        {
+            scount[tid] += scount[tid + i];
+            if(sfirst[tid + i] < sfirst[tid])
+                sfirst[tid] = sfirst[tid + i];
+            ssweeps[tid] = max(ssweeps[tid], ssweeps[tid + i]);
+            sresidual[tid] = fmax(sresidual[tid], sresidual[tid + i]);
+        }
+        __syncthreads();
+    }
+
+    if(tid == 0)
+    {
+        volatile rocsolver_info_summary* vsummary = summary;
+        vsummary->failures = scount[0];
+        vsummary->first = (sfirst[0] < batch_count ? rocblas_int(sfirst[0]) : -1);
+        vsummary->first_info = (sfirst[0] < batch_count ? int64_t(info[sfirst[0]]) : 0);
+        vsummary->max_sweeps = ssweeps[0];
+        vsummary->max_residual = sresidual[0];
+        __threadfence_system();
+        vsummary->sequence = sequence;
+    }
+}
+
+template <typename I>
+static void info_summary_launch(hipStream_t stream,
+                                const void* info,
+                                const int64_t batch_count,
+                                const rocblas_int* n_sweeps,
+                                const void* residual,
+                                const bool residual64,
+                                const uint64_t sequence,
+                                rocsolver_info_summary* summary)
+{
+    // (launched directly, so that the summary is not counted in the statistics of the call)
+    if(residual64)
+        hipLaunchKernelGGL((info_summary_kernel<I, double>), dim3(1), dim3(BS1), 0, stream,
+                           static_cast<const I*>(info), batch_count, n_sweeps,
+                           static_cast<const double*>(residual), sequence, summary);
+    else
+        hipLaunchKernelGGL((info_summary_kernel<I, float>), dim3(1), dim3(BS1), 0, stream,
+                           static_cast<const I*>(info), batch_count, n_sweeps,
+                           static_cast<const float*>(residual), sequence, summary);
+}
+
+// the host function queued after the summary kernel to call the user callback
+// (the data is a copy of the entry, released once the callback returns)
+static void info_callback_host_func(void* data)
+{
+    auto entry = static_cast<info_summary_entry*>(data);
+    entry->callback(entry->summary, entry->user_data);
+    delete entry;
+}
+
+void rocsolver_info_summarize(rocblas_handle handle,
+                              const void* info,
+                              const bool info64,
+                              const int64_t batch_count,
+                              const rocblas_int* n_sweeps,
+                              const void* residual,
+                              const bool residual64)
+{
+    if(info_summary_count.load(std::memory_order_relaxed) == 0
+       || rocblas_is_device_memory_size_query(handle))
+        return;
+
+    hipStream_t stream;
+    if(rocblas_get_stream(handle, &stream) != rocblas_status_success)
+        return;
+
+    // (the sequence number is only taken when the summary is actually written)
+    info_summary_entry entry;
+    {
+        std::lock_guard<std::mutex> lock(info_summary_mutex);
+        auto it = info_summary_entries.find(handle);
+        if(it == info_summary_entries.end() || !it->second.summary)
+            return;
+        entry = it->second;
+        entry.sequence = ++it->second.sequence;
+    }
+
+    if(info64)
+        info_summary_launch<int64_t>(stream, info, batch_count, n_sweeps, residual, residual64,
+                                     entry.sequence, entry.summary);
+    else
+        info_summary_launch<rocblas_int>(stream, info, batch_count, n_sweeps, residual,
+                                         residual64, entry.sequence, entry.summary);
+
+    // (the copy of the entry would be released after the first replay of a captured graph)
+    if(entry.callback && !stream_is_capturing(stream))
+    {
+        auto data = new info_summary_entry(entry);
+        if(hipLaunchHostFunc(stream, info_callback_host_func, data) != hipSuccess)
+            delete data;
+    }
+}
+
+// (the callbacks already queued hold a copy of the entry, and are not affected)
+void release_info_summary(rocblas_handle handle)
+{
+    std::lock_guard<std::mutex> lock(info_summary_mutex);
+    info_summary_entries.erase(handle);
+    info_summary_count.store(int(info_summary_entries.size()));
+}
+
+ROCSOLVER_END_NAMESPACE
+
+extern "C" rocblas_status rocsolver_set_info_summary(rocblas_handle handle,
+                                                     rocsolver_info_summary* summary)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    std::lock_guard<std::mutex> lock(rocsolver::info_summary_mutex);
+    if(summary)
+    {
+        auto& entry = rocsolver::info_summary_entries[handle];
+        entry.summary = summary;
+        entry.sequence = 0;
+    }
+    else
+        rocsolver::info_summary_entries.erase(handle);
+    rocsolver::info_summary_count.store(int(rocsolver::info_summary_entries.size()));
+
+    return rocblas_status_success;
+}
+
+extern "C" rocblas_status rocsolver_set_info_callback(rocblas_handle handle,
+                                                      rocsolver_info_callback callback,
+                                                      void* user_data)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    std::lock_guard<std::mutex> lock(rocsolver::info_summary_mutex);
+    auto it = rocsolver::info_summary_entries.find(handle);
+    if(it == rocsolver::info_summary_entries.end())
+        return callback ? rocblas_status_invalid_value : rocblas_status_success;
+
+    it->second.callback = callback;
+    it->second.user_data = user_data;
+
+    return rocblas_status_success;
+}
@@ -0,0 +1,516 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <tuple>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "rocblas.hpp"
+#include "rocsolver/rocsolver.h"
+#include "rocsolver_alg_mode.hpp"
+#include "rocsolver_cache.hpp"
+#include "rocsolver_initialize.hpp"
+#include "rocsolver_tuning.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/***************************************************************************
+ * Scratch problems
+ ***************************************************************************/
+
+/** WARMUP_MEMORY owns the device buffers of the scratch problems of a warm-up call. In query
+    mode, no memory is allocated and all the pointers are null (the functions do not access
+    their arguments when the handle is in device memory size query mode). **/
+class warmup_memory
+{
+private:
+    std::vector<void*> buffers;
+    bool query;
+
+public:
+    explicit warmup_memory(const bool query)
+        : query(query)
+    {
+    }
+    warmup_memory(const warmup_memory&) = delete;
+    warmup_memory& operator=(const warmup_memory&) = delete;
+
+    ~warmup_memory()
+    {
+        for(void* buffer : buffers)
+            (void)hipFree(buffer);
+    }
+
+    /** Allocates a device buffer of count elements and copies the given host values to it
+        (if any). **/
+    template <typename T>
+    rocblas_status alloc(T** ptr, const size_t count, const std::vector<T>& values = {})
+    {
+        *ptr = nullptr;
+        if(query)
+            return rocblas_status_success;
+
+        void* buffer = nullptr;
+        HIP_CHECK(hipMalloc(&buffer, std::max(count, size_t(1)) * sizeof(T)));
+        buffers.push_back(buffer);
+        if(!values.empty())
+            HIP_CHECK(hipMemcpy(buffer, values.data(), sizeof(T) * values.size(),
+                                hipMemcpyHostToDevice));
+        *ptr = static_cast<T*>(buffer);
+        return rocblas_status_success;
+    }
+};
+
+/** Returns batch_count copies of the m-by-n matrix with entries A[i,j] = 2^-|i-j|. The square
+    matrix is symmetric positive definite, well conditioned and has distinct eigenvalues, so
+    that the scratch problems follow the common path of the algorithms (no pivoting failures,
+    splittings or deflations). **/
+template <typename T, typename S>
+std::vector<T> warmup_matrix(const rocblas_int m,
+                             const rocblas_int n,
+                             const rocblas_int lda,
+                             const rocblas_int batch_count)
+{
+    const size_t stride = size_t(lda) * n;
+    std::vector<T> hA(stride * batch_count, T(0));
+    for(rocblas_int b = 0; b < batch_count; ++b)
+        for(rocblas_int j = 0; j < n; ++j)
+            for(rocblas_int i = 0; i < m; ++i)
+                hA[b * stride + i + j * size_t(lda)] = T(S(std::ldexp(1.0, -std::abs(i - j))));
+    return hA;
+}
+
+/** WARMUP executes the function of the given shape once on a scratch problem of the given
+    size. In query mode (the handle is in device memory size query mode), only the workspace
+    size of the function is computed. **/
+template <typename T>
+rocblas_status warmup(rocblas_handle handle, const rocsolver_problem_shape& shape, const bool query)
+{
+    using api = warmup_api<T>;
+    using S = typename api::real_t;
+
+    const rocsolver_function func = shape.function;
+    const bool rect = (func == rocsolver_function_getrf || func == rocsolver_function_geqrf
+                       || func == rocsolver_function_gesvd);
+    const bool rhs = (func == rocsolver_function_getrs || func == rocsolver_function_potrs
+                      || func == rocsolver_function_gesv || func == rocsolver_function_posv);
+    const bool batched = (shape.batch_count > 0 && func != rocsolver_function_bdsqr);
+
+    const rocblas_int n = shape.n;
+    const rocblas_int m = rect ? shape.m : n;
+    const rocblas_int nrhs = rhs ? shape.nrhs : 0;
+    const rocblas_int k = std::min(m, n);
+    const rocblas_int bc = batched ? shape.batch_count : 1;
+
+    const rocblas_int lda = (shape.lda > 0) ? shape.lda : std::max(m, 1);
+    const rocblas_int ldb = std::max(n, 1);
+    const rocblas_int ldu = std::max(m, 1);
+    const rocblas_int ldv = std::max(k, 1);
+    const rocblas_stride strideA = rocblas_stride(lda) * n;
+    const rocblas_stride strideB = rocblas_stride(ldb) * nrhs;
+    const rocblas_stride strideP = std::max(k, 1);
+    const rocblas_stride strideU = rocblas_stride(ldu) * k;
+    const rocblas_stride strideV = rocblas_stride(ldv) * n;
+
+    warmup_memory mem(query);
+    T *A, *B, *tau, *U, *V;
+    S *D, *E;
+    rocblas_int *ipiv, *info;
+    ROCBLAS_CHECK(
+        mem.alloc(&A, strideA * bc, query ? std::vector<T>{} : warmup_matrix<T, S>(m, n, lda, bc)));
+    ROCBLAS_CHECK(mem.alloc(&B, strideB * bc, std::vector<T>(query ? 0 : strideB * bc, T(1))));
+    ROCBLAS_CHECK(mem.alloc(&ipiv, strideP * bc));
+    ROCBLAS_CHECK(mem.alloc(&info, bc));
+
+    switch(func)
+    {
+    case rocsolver_function_getrf:
+        if(batched)
+            return api::getrf_sb(handle, m, n, A, lda, strideA, ipiv, strideP, info, bc);
+        return api::getrf(handle, m, n, A, lda, ipiv, info);
+
+    case rocsolver_function_getrs:
+        // GETRS is executed on the factorization computed by GETRF
+        if(batched)
+        {
+            if(!query)
+                ROCBLAS_CHECK(
+                    api::getrf_sb(handle, n, n, A, lda, strideA, ipiv, strideP, info, bc));
+            return api::getrs_sb(handle, rocblas_operation_none, n, nrhs, A, lda, strideA, ipiv,
+                                 strideP, B, ldb, strideB, bc);
+        }
+        if(!query)
+            ROCBLAS_CHECK(api::getrf(handle, n, n, A, lda, ipiv, info));
+        return api::getrs(handle, rocblas_operation_none, n, nrhs, A, lda, ipiv, B, ldb);
+
+    case rocsolver_function_gesv:
+        if(batched)
+            return api::gesv_sb(handle, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, strideB,
+                                info, bc);
+        return api::gesv(handle, n, nrhs, A, lda, ipiv, B, ldb, info);
+
+    case rocsolver_function_potrf:
+        if(batched)
+            return api::potrf_sb(handle, rocblas_fill_lower, n, A, lda, strideA, info, bc);
+        return api::potrf(handle, rocblas_fill_lower, n, A, lda, info);
+
+    case rocsolver_function_potrs:
+        // POTRS is executed on the factorization computed by POTRF
+        if(batched)
+        {
+            if(!query)
+                ROCBLAS_CHECK(
+                    api::potrf_sb(handle, rocblas_fill_lower, n, A, lda, strideA, info, bc));
+            return api::potrs_sb(handle, rocblas_fill_lower, n, nrhs, A, lda, strideA, B, ldb,
+                                 strideB, bc);
+        }
+        if(!query)
+            ROCBLAS_CHECK(api::potrf(handle, rocblas_fill_lower, n, A, lda, info));
+        return api::potrs(handle, rocblas_fill_lower, n, nrhs, A, lda, B, ldb);
+
+    case rocsolver_function_posv:
+        if(batched)
+            return api::posv_sb(handle, rocblas_fill_lower, n, nrhs, A, lda, strideA, B, ldb,
+                                strideB, info, bc);
+        return api::posv(handle, rocblas_fill_lower, n, nrhs, A, lda, B, ldb, info);
+
+    case rocsolver_function_geqrf:
+        ROCBLAS_CHECK(mem.alloc(&tau, strideP * bc));
+        if(batched)
+            return api::geqrf_sb(handle, m, n, A, lda, strideA, tau, strideP, bc);
+        return api::geqrf(handle, m, n, A, lda, tau);
+
+    case rocsolver_function_syevd:
+        ROCBLAS_CHECK(mem.alloc(&D, size_t(n) * bc));
+        ROCBLAS_CHECK(mem.alloc(&E, size_t(n) * bc));
+        if(batched)
+            return api::syevd_sb(handle, rocblas_evect_original, rocblas_fill_lower, n, A, lda,
+                                 strideA, D, n, E, n, info, bc);
+        return api::syevd(handle, rocblas_evect_original, rocblas_fill_lower, n, A, lda, D, E,
+                          info);
+
+    case rocsolver_function_gesvd:
+        ROCBLAS_CHECK(mem.alloc(&D, strideP * bc));
+        ROCBLAS_CHECK(mem.alloc(&E, strideP * bc));
+        ROCBLAS_CHECK(mem.alloc(&U, strideU * bc));
+        ROCBLAS_CHECK(mem.alloc(&V, strideV * bc));
+        if(batched)
+            return api::gesvd_sb(handle, rocblas_svect_singular, rocblas_svect_singular, m, n, A,
+                                 lda, strideA, D, strideP, U, ldu, strideU, V, ldv, strideV, E,
+                                 strideP, rocblas_outofplace, info, bc);
+        return api::gesvd(handle, rocblas_svect_singular, rocblas_svect_singular, m, n, A, lda, D,
+                          U, ldu, V, ldv, E, rocblas_outofplace, info);
+
+    case rocsolver_function_bdsqr:
+    {
+        // an upper bidiagonal matrix with distinct singular values, and identity matrices
+        // as initial singular vectors
+        const rocblas_int nv = query ? 0 : n;
+        std::vector<T> hI(size_t(ldb) * nv, T(0));
+        for(rocblas_int i = 0; i < nv; ++i)
+            hI[i + i * size_t(ldb)] = T(1);
+        ROCBLAS_CHECK(mem.alloc(&D, n, std::vector<S>(nv, S(2))));
+        ROCBLAS_CHECK(mem.alloc(&E, n, std::vector<S>(nv, S(1))));
+        ROCBLAS_CHECK(mem.alloc(&U, size_t(ldb) * n, hI));
+        ROCBLAS_CHECK(mem.alloc(&V, size_t(ldb) * n, hI));
+        return api::bdsqr(handle, rocblas_fill_upper, n, n, n, 0, D, E, V, ldb, U, ldb, nullptr,
+                          1, info);
+    }
+
+    default: return rocblas_status_invalid_value;
+    }
+}
+
+/** Returns true if the function and precision of the given shape can be warmed up. **/
+static bool warmup_supported(const rocsolver_problem_shape& shape)
+{
+    switch(shape.function)
+    {
+    case rocsolver_function_getrf:
+    case rocsolver_function_getrs:
+    case rocsolver_function_potrf:
+    case rocsolver_function_potrs:
+    case rocsolver_function_geqrf:
+    case rocsolver_function_gesv:
+    case rocsolver_function_posv:
+    case rocsolver_function_syevd:
+    case rocsolver_function_gesvd:
+    case rocsolver_function_bdsqr: break;
+    default: return false;
+    }
+
+    return shape.datatype == rocblas_datatype_f32_r || shape.datatype == rocblas_datatype_f64_r
+        || shape.datatype == rocblas_datatype_f32_c || shape.datatype == rocblas_datatype_f64_c;
+}
+
+static rocblas_status warmup_shape(rocblas_handle handle,
+                                   const rocsolver_problem_shape& shape,
+                                   const bool query = false)
+{
+    switch(shape.datatype)
+    {
+    case rocblas_datatype_f32_r: return warmup<float>(handle, shape, query);
+    case rocblas_datatype_f64_r: return warmup<double>(handle, shape, query);
+    case rocblas_datatype_f32_c: return warmup<rocblas_float_complex>(handle, shape, query);
+    case rocblas_datatype_f64_c: return warmup<rocblas_double_complex>(handle, shape, query);
+    default: return rocblas_status_invalid_value;
+    }
+}
+
+/** Returns the number of rows of the matrix of the given shape. **/
+static rocblas_int shape_rows(const rocsolver_problem_shape& shape)
+{
+    const rocsolver_function func = shape.function;
+    if(func == rocsolver_function_getrf || func == rocsolver_function_geqrf
+       || func == rocsolver_function_gesvd)
+        return shape.m;
+    return shape.n;
+}
+
+static rocblas_status check_shape(const rocsolver_problem_shape& shape)
+{
+    if(!warmup_supported(shape))
+        return rocblas_status_invalid_value;
+    if(shape.m < 0 || shape.n < 0 || shape.nrhs < 0 || shape.batch_count < 0 || shape.lda < 0)
+        return rocblas_status_invalid_size;
+    if(shape.lda > 0 && shape.function != rocsolver_function_bdsqr
+       && shape.lda < shape_rows(shape))
+        return rocblas_status_invalid_size;
+    return rocblas_status_continue;
+}
+
+rocblas_status rocsolver_initialize_impl(rocblas_handle handle,
+                                        const rocsolver_problem_shape* shapes,
+                                        const rocblas_int count)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    if(count < 0)
+        return rocblas_status_invalid_size;
+
+    if(count > 0 && !shapes)
+        return rocblas_status_invalid_pointer;
+
+    // check all the shapes before executing any function
+    for(rocblas_int i = 0; i < count; ++i)
+    {
+        rocblas_status st = check_shape(shapes[i]);
+        if(st != rocblas_status_continue)
+            return st;
+    }
+
+    hipStream_t stream;
+    ROCBLAS_CHECK(rocblas_get_stream(handle, &stream));
+    if(stream_is_capturing(stream))
+        return rocblas_status_invalid_value;
+
+    rocblas_initialize();
+    rocsolver_tuning::reload();
+
+    for(rocblas_int i = 0; i < count; ++i)
+        ROCBLAS_CHECK(warmup_shape(handle, shapes[i]));
+
+    HIP_CHECK(hipStreamSynchronize(stream));
+    return rocblas_status_success;
+}
+
+/***************************************************************************
+ * Workspace size queries
+ ***************************************************************************/
+
+/** The workspace sizes are memoized per device, function, precision, (normalized) problem size
+    and leading dimension, algorithm mode of the function, and signature of the run-time tuning
+    tables (which give the block sizes and the number of streams of the batched functions). **/
+using workspace_key = std::tuple<int,
+                                 rocsolver_function,
+                                 rocblas_datatype,
+                                 rocblas_int,
+                                 rocblas_int,
+                                 rocblas_int,
+                                 rocblas_int,
+                                 rocblas_int,
+                                 rocsolver_alg_mode,
+                                 uint64_t>;
+
+/** Returns the given shape with the sizes that are ignored by its function set to fixed values,
+    so that equivalent shapes share their memoized workspace size. **/
+static rocsolver_problem_shape normalize_shape(rocsolver_problem_shape shape)
+{
+    const rocsolver_function func = shape.function;
+    if(func != rocsolver_function_getrf && func != rocsolver_function_geqrf
+       && func != rocsolver_function_gesvd)
+        shape.m = shape.n;
+    if(func != rocsolver_function_getrs && func != rocsolver_function_potrs
+       && func != rocsolver_function_gesv && func != rocsolver_function_posv)
+        shape.nrhs = 0;
+    if(func == rocsolver_function_bdsqr)
+    {
+        shape.batch_count = 0;
+        shape.lda = 0;
+    }
+    else if(shape.lda == 0)
+        shape.lda = std::max(shape_rows(shape), 1);
+    return shape;
+}
+
+/** The memoized workspace sizes are also kept in the persistent cache (see rocsolver_cache.hpp),
+    with one line per size giving the fields of the key (except the device) and the size.
+    Returns the path of the file for the given device, or an empty string if the cache is
+    disabled. **/
+static std::string workspace_file(const int device)
+{
+    std::string dir = rocsolver_cache_dir(device, true);
+    return dir.empty() ? dir : dir + "/workspace";
+}
+
+static void load_workspace_sizes(const int device, std::map<workspace_key, size_t>& sizes)
+{
+    std::string path = workspace_file(device);
+    if(path.empty())
+        return;
+
+    rocsolver_cache_lock lock(path + ".lock", false);
+    std::ifstream file(path);
+    std::string line;
+    while(std::getline(file, line))
+    {
+        std::istringstream ss(line);
+        int func, type, mode;
+        rocblas_int m, n, nrhs, bc, lda;
+        uint64_t tuning;
+        size_t size;
+        if(ss >> func >> type >> m >> n >> nrhs >> bc >> lda >> mode >> tuning >> size)
+            sizes.emplace(workspace_key(device, rocsolver_function(func), rocblas_datatype(type), m,
+                                        n, nrhs, bc, lda, rocsolver_alg_mode(mode), tuning),
+                          size);
+    }
+}
+
+static void store_workspace_size(const workspace_key& key, const size_t size)
+{
+    std::string path = workspace_file(std::get<0>(key));
+    if(path.empty())
+        return;
+
+    rocsolver_cache_append(path,
+                           fmt::format("{} {} {} {} {} {} {} {} {} {}", int(std::get<1>(key)),
+                                       int(std::get<2>(key)), std::get<3>(key), std::get<4>(key),
+                                       std::get<5>(key), std::get<6>(key), std::get<7>(key),
+                                       int(std::get<8>(key)), std::get<9>(key), size));
+}
+
+rocblas_status rocsolver_get_workspace_size_impl(rocblas_handle handle,
+                                                 const rocsolver_problem_shape* shape,
+                                                 size_t* size)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    if(!shape || !size)
+        return rocblas_status_invalid_pointer;
+
+    rocblas_status st = check_shape(*shape);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // the workspace of a function cannot be computed while the handle is already
+    // collecting the workspace of other functions
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_invalid_value;
+
+    static std::mutex mutex;
+    static std::map<workspace_key, size_t> sizes;
+    // devices whose sizes have been read from the persistent cache
+    static std::set<int> loaded;
+
+    const rocsolver_problem_shape nshape = normalize_shape(*shape);
+    int device;
+    HIP_CHECK(hipGetDevice(&device));
+    const workspace_key key(device, nshape.function, nshape.datatype, nshape.m, nshape.n,
+                            nshape.nrhs, nshape.batch_count, nshape.lda,
+                            get_alg_mode(handle, nshape.function),
+                            rocsolver_tuning::instance().signature());
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if(loaded.insert(device).second)
+            load_workspace_sizes(device, sizes);
+        auto it = sizes.find(key);
+        if(it != sizes.end())
+        {
+            *size = it->second;
+            return rocblas_status_success;
+        }
+    }
+
+    // compute the size with the device memory size query of the function (no kernel is
+    // launched and no memory is allocated)
+    size_t wsize = 0;
+    ROCBLAS_CHECK(rocblas_start_device_memory_size_query(handle));
+    st = warmup_shape(handle, nshape, true);
+    rocblas_status stop = rocblas_stop_device_memory_size_query(handle, &wsize);
+    if(st != rocblas_status_size_increased && st != rocblas_status_size_unchanged
+       && st != rocblas_status_success)
+        return st;
+    if(stop != rocblas_status_success)
+        return stop;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if(sizes.emplace(key, wsize).second)
+            store_workspace_size(key, wsize);
+    }
+
+    *size = wsize;
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
+
+extern "C" rocblas_status rocsolver_initialize(rocblas_handle handle,
+                                               const rocsolver_problem_shape* shapes,
+                                               const rocblas_int count)
+{
+    return rocsolver::rocsolver_initialize_impl(handle, shapes, count);
+}
+
+extern "C" rocblas_status rocsolver_get_workspace_size(rocblas_handle handle,
+                                                       const rocsolver_problem_shape* shape,
+                                                       size_t* size)
+{
+    return rocsolver::rocsolver_get_workspace_size_impl(handle, shape, size);
+}
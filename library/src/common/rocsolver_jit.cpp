@@ -0,0 +1,198 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#ifdef ROCSOLVER_JIT
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <fmt/format.h>
+#include <hip/hiprtc.h>
+
+#include "rocsolver_cache.hpp"
+#include "rocsolver_jit.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/***************************************************************************
+ * Helpers
+ ***************************************************************************/
+
+// FNV-1a hash; unlike std::hash, it is the same in every process, so it can
+// be used to name the files of the disk cache
+static uint64_t hash_source(const std::string& str)
+{
+    uint64_t hash = 14695981039346656037ull;
+    for(unsigned char c : str)
+    {
+        hash ^= c;
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+static bool compile_code(const std::string& key,
+                         const char* name,
+                         const std::string& source,
+                         const std::string& arch,
+                         std::vector<char>& code)
+{
+    hiprtcProgram prog;
+    if(hiprtcCreateProgram(&prog, source.c_str(), (key + ".hip").c_str(), 0, nullptr, nullptr)
+       != HIPRTC_SUCCESS)
+        return false;
+
+    std::string arch_option = "--offload-arch=" + arch;
+    const char* options[] = {arch_option.c_str(), "-O3", "-std=c++17"};
+    hiprtcResult status = hiprtcCompileProgram(prog, 3, options);
+
+    if(status == HIPRTC_SUCCESS)
+    {
+        size_t size = 0;
+        status = hiprtcGetCodeSize(prog, &size);
+        if(status == HIPRTC_SUCCESS)
+        {
+            code.resize(size);
+            status = hiprtcGetCode(prog, code.data());
+        }
+    }
+    else
+    {
+        size_t size = 0;
+        std::string log;
+        if(hiprtcGetProgramLogSize(prog, &size) == HIPRTC_SUCCESS && size > 1)
+        {
+            log.resize(size);
+            hiprtcGetProgramLog(prog, &log[0]);
+        }
+        fmt::print(stderr, "rocSOLVER error: could not compile {} for {} ({})\n{}\n", name, arch,
+                   hiprtcGetErrorString(status), log);
+    }
+
+    hiprtcDestroyProgram(&prog);
+    return status == HIPRTC_SUCCESS && !code.empty();
+}
+
+/***************************************************************************
+ * Kernel cache
+ ***************************************************************************/
+
+bool rocsolver_jit_enabled()
+{
+    static const bool enabled = [] {
+        const char* env = std::getenv("ROCSOLVER_JIT");
+        return !env || std::atoi(env) != 0;
+    }();
+    return enabled;
+}
+
+hipFunction_t
+    rocsolver_jit_kernel(const std::string& key, const char* name, const std::string& source)
+{
+    int device;
+    if(hipGetDevice(&device) != hipSuccess)
+        return nullptr;
+
+    // kernels are loaded in the current device, so they are cached per device; failures are
+    // also recorded, so that they are not attempted again
+    static std::mutex mutex;
+    static std::unordered_map<std::string, hipFunction_t> kernels;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    std::string device_key = fmt::format("{}:{}", device, key);
+    auto it = kernels.find(device_key);
+    if(it != kernels.end())
+        return it->second;
+
+    hipFunction_t kernel = nullptr;
+    kernels[device_key] = nullptr;
+
+    std::string arch = rocsolver_device_arch(device);
+    if(arch.empty())
+        return nullptr;
+
+    // the code objects are cached in the versioned directory of the device (see
+    // rocsolver_cache.hpp); the file name identifies the source
+    std::string file;
+    std::string dir = rocsolver_cache_dir(device, true);
+    if(!dir.empty())
+    {
+        std::error_code ec;
+        std::filesystem::path jit_dir = std::filesystem::path(dir) / "jit";
+        std::filesystem::create_directories(jit_dir, ec);
+        if(!ec)
+            file = (jit_dir / fmt::format("{}-{:016x}.co", key, hash_source(source))).string();
+    }
+
+    std::vector<char> code;
+    hipModule_t module;
+    auto load_cached = [&] {
+        return !file.empty() && rocsolver_cache_read(file, code)
+            && hipModuleLoadData(&module, code.data()) == hipSuccess;
+    };
+
+    if(!load_cached())
+    {
+        // only one process compiles the kernel; the others wait for it and then load it
+        std::unique_ptr<rocsolver_cache_lock> file_lock;
+        if(!file.empty())
+            file_lock = std::make_unique<rocsolver_cache_lock>(file + ".lock", true);
+
+        if(!file_lock || !load_cached())
+        {
+            // not cached, or the cached file could not be loaded
+            code.clear();
+            if(!compile_code(key, name, source, arch, code))
+                return nullptr;
+            if(hipModuleLoadData(&module, code.data()) != hipSuccess)
+                return nullptr;
+            if(!file.empty())
+                rocsolver_cache_write(file, code);
+        }
+    }
+
+    if(hipModuleGetFunction(&kernel, module, name) != hipSuccess)
+    {
+        hipModuleUnload(module);
+        return nullptr;
+    }
+
+    // the module is not unloaded; the kernel is used until the process exits
+    kernels[device_key] = kernel;
+    return kernel;
+}
+
+ROCSOLVER_END_NAMESPACE
+
+#endif
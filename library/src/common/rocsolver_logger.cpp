@@ -25,6 +25,7 @@
  * SUCH DAMAGE.
  * *************************************************************************/
 
+#include <atomic>
 #include <cerrno>
 #include <climits>
 #include <cstdlib>
@@ -42,6 +43,10 @@ ROCSOLVER_BEGIN_NAMESPACE
 // initialize the static variable
 rocsolver_logger* rocsolver_logger::_instance = nullptr;
 std::mutex rocsolver_logger::_mutex;
+std::mutex rocsolver_logger::_output_mutex;
+
+// ids of the logging sessions (0 is never used)
+static std::atomic<uint64_t> last_session_id(0);
 
 static std::string rocblas_version()
 {
@@ -75,7 +80,7 @@ std::ostream* rocsolver_logger::open_log_stream(const char* environment_variable
         std::ostream& os = file_streams.front();
 
         // print version info only once per file
-        if(&os != trace_os && &os != bench_os && &os != profile_os)
+        if(&os != trace_os && &os != bench_os && &os != profile_os && &os != timeline_os)
         {
             fmt::print(os,
                        "ROCSOLVER LOG FILE\n"
@@ -89,19 +94,54 @@ std::ostream* rocsolver_logger::open_log_stream(const char* environment_variable
         return &std::cerr;
 }
 
+/***************************************************************************
+ * Per-thread logging data
+ ***************************************************************************/
+
+rocsolver_log_thread& rocsolver_logger::thread_data()
+{
+    // the data of the thread is registered with the logger the first time the thread logs
+    // a function call during the session; after that, it is found without any global lock
+    thread_local uint64_t cached_id = 0;
+    thread_local std::shared_ptr<rocsolver_log_thread> cached_data;
+
+    if(cached_id != session_id)
+    {
+        cached_data = std::make_shared<rocsolver_log_thread>();
+        cached_id = session_id;
+
+        std::lock_guard<std::mutex> lock(rocsolver_logger::_mutex);
+        threads.push_back(cached_data);
+    }
+
+    return *cached_data;
+}
+
+void rocsolver_logger::write_buffer(std::string& buffer, std::ostream* os)
+{
+    if(buffer.empty())
+        return;
+
+    std::lock_guard<std::mutex> lock(rocsolver_logger::_output_mutex);
+    *os << buffer;
+    os->flush();
+    buffer.clear();
+}
+
 /***************************************************************************
  * Call stack manipulation
  ***************************************************************************/
 
-rocsolver_log_entry& rocsolver_logger::push_log_entry(rocblas_handle handle, std::string&& name)
+rocsolver_log_entry& rocsolver_logger::push_log_entry(rocsolver_log_thread& data,
+                                                      rocblas_handle handle,
+                                                      std::string&& name)
 {
-    std::vector<rocsolver_log_entry>& stack = call_stack[handle];
+    std::vector<rocsolver_log_entry>& stack = data.call_stack[handle];
     stack.push_back(rocsolver_log_entry());
 
     rocsolver_log_entry& result = stack.back();
     result.name = std::move(name);
     result.level = stack.size() - 1;
-    result.start_time = get_time_us_no_sync();
 
     for(int i = 1; i < stack.size() - 1; i++)
         result.callers.push_back(stack[i].name);
@@ -109,25 +149,145 @@ rocsolver_log_entry& rocsolver_logger::push_log_entry(rocblas_handle handle, std
     return result;
 }
 
-rocsolver_log_entry& rocsolver_logger::peek_log_entry(rocblas_handle handle)
+rocsolver_log_entry& rocsolver_logger::peek_log_entry(rocsolver_log_thread& data,
+                                                      rocblas_handle handle)
 {
-    std::vector<rocsolver_log_entry>& stack = call_stack[handle];
+    std::vector<rocsolver_log_entry>& stack = data.call_stack[handle];
     rocsolver_log_entry& result = stack.back();
     return result;
 }
 
-rocsolver_log_entry rocsolver_logger::pop_log_entry(rocblas_handle handle)
+rocsolver_log_entry rocsolver_logger::pop_log_entry(rocsolver_log_thread& data,
+                                                    rocblas_handle handle)
 {
-    std::vector<rocsolver_log_entry>& stack = call_stack[handle];
+    std::vector<rocsolver_log_entry>& stack = data.call_stack[handle];
     rocsolver_log_entry result = stack.back();
     stack.pop_back();
 
     if(stack.empty())
-        call_stack.erase(handle);
+        data.call_stack.erase(handle);
 
     return result;
 }
 
+/***************************************************************************
+ * Profile and timeline events
+ ***************************************************************************/
+
+hipEvent_t rocsolver_logger::acquire_event(rocsolver_log_thread& data)
+{
+    hipEvent_t event;
+    if(data.free_events.empty())
+        hipEventCreate(&event);
+    else
+    {
+        event = data.free_events.back();
+        data.free_events.pop_back();
+    }
+    return event;
+}
+
+void rocsolver_logger::release_events(rocsolver_log_thread& data, rocsolver_log_entry& entry)
+{
+    if(entry.start_event)
+        data.free_events.push_back(entry.start_event);
+    if(entry.stop_event)
+        data.free_events.push_back(entry.stop_event);
+    entry.start_event = nullptr;
+    entry.stop_event = nullptr;
+}
+
+void rocsolver_logger::resolve_events(rocsolver_log_thread& data, size_t count)
+{
+    std::vector<rocsolver_log_entry>& pending_events = data.pending_events;
+    if(count == 0 || count > pending_events.size())
+        count = pending_events.size();
+    if(count == 0)
+        return;
+
+    for(size_t i = 0; i < count; i++)
+    {
+        rocsolver_log_entry& from_stack = pending_events[i];
+
+        float time_ms = 0;
+        hipEventSynchronize(from_stack.stop_event);
+        hipEventElapsedTime(&time_ms, from_stack.start_event, from_stack.stop_event);
+
+        if(timeline_enabled)
+        {
+            float start_ms = 0;
+            hipEventElapsedTime(&start_ms, timeline_origin, from_stack.start_event);
+            std::lock_guard<std::mutex> lock(rocsolver_logger::_output_mutex);
+            append_timeline(from_stack, start_ms, time_ms);
+        }
+        release_events(data, from_stack);
+
+        if(!from_stack.profiled)
+            continue;
+
+        rocsolver_profile_map* map = &data.profile;
+        for(const std::string& caller_name : from_stack.callers)
+        {
+            rocsolver_profile_entry& entry = (*map)[caller_name];
+            if(!entry.internal_calls)
+                entry.internal_calls = std::make_unique<rocsolver_profile_map>();
+            map = entry.internal_calls.get();
+        }
+
+        rocsolver_profile_entry& from_profile = (*map)[from_stack.name];
+        from_profile.name = from_stack.name;
+        from_profile.level = from_stack.level;
+        from_profile.calls++;
+        from_profile.time += double(time_ms) * 1e3;
+        from_profile.workspace = std::max(from_profile.workspace, from_stack.workspace);
+    }
+
+    pending_events.erase(pending_events.begin(), pending_events.begin() + count);
+    if(timeline_enabled)
+    {
+        std::lock_guard<std::mutex> lock(rocsolver_logger::_output_mutex);
+        timeline_os->flush();
+    }
+}
+
+void rocsolver_logger::destroy_events(rocsolver_log_thread& data)
+{
+    for(rocsolver_log_entry& entry : data.pending_events)
+        release_events(data, entry);
+    data.pending_events.clear();
+
+    for(hipEvent_t event : data.free_events)
+        hipEventDestroy(event);
+    data.free_events.clear();
+}
+
+/***************************************************************************
+ * Timeline printing
+ ***************************************************************************/
+
+void rocsolver_logger::append_timeline(const rocsolver_log_entry& entry,
+                                       float start_ms,
+                                       float time_ms)
+{
+    // every stream is shown as a separate thread of the same process
+    auto it = timeline_tids.find(entry.stream);
+    if(it == timeline_tids.end())
+    {
+        it = timeline_tids.emplace(entry.stream, int(timeline_tids.size())).first;
+        fmt::print(*timeline_os,
+                   "{}{{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 0, \"tid\": {}, "
+                   "\"args\": {{\"name\": \"stream {}\"}}}}",
+                   timeline_count++ ? ",\n" : "", it->second, static_cast<void*>(entry.stream));
+    }
+
+    // times are written in microseconds
+    fmt::print(*timeline_os,
+               "{}{{\"name\": \"{}\", \"cat\": \"{}\", \"ph\": \"X\", \"ts\": {:.3f}, "
+               "\"dur\": {:.3f}, \"pid\": 0, \"tid\": {}, \"args\": {{\"level\": {}}}}}",
+               timeline_count++ ? ",\n" : "", entry.name, entry.category,
+               double(start_ms) * 1e3, double(time_ms) * 1e3, it->second, entry.level);
+}
+
 /***************************************************************************
  * Profile log printing
  ***************************************************************************/
@@ -147,6 +307,11 @@ void rocsolver_logger::append_profile(std::string& str,
         str += fmt::format("{: <{}}{}: Calls: {}, Total Time: {:.3f} ms", "", indent, it->first,
                            entry.calls, entry.time * 1e-3);
 
+        // the workspace is allocated by the top-level functions, so it is only reported for the
+        // functions that they call
+        if(entry.level == 1 && entry.workspace > 0)
+            str += fmt::format(", Peak Workspace: {} bytes", entry.workspace);
+
         if(entry.internal_calls)
         {
             double internal_time = 0;
@@ -163,6 +328,53 @@ void rocsolver_logger::append_profile(std::string& str,
     }
 }
 
+// adds the profile logging data of a thread to the merged data
+static void merge_profile(rocsolver_profile_map& merged, const rocsolver_profile_map& profile)
+{
+    for(const auto& it : profile)
+    {
+        rocsolver_profile_entry& entry = merged[it.first];
+        entry.name = it.second.name;
+        entry.level = it.second.level;
+        entry.calls += it.second.calls;
+        entry.time += it.second.time;
+        entry.workspace = std::max(entry.workspace, it.second.workspace);
+
+        if(it.second.internal_calls)
+        {
+            if(!entry.internal_calls)
+                entry.internal_calls = std::make_unique<rocsolver_profile_map>();
+            merge_profile(*entry.internal_calls, *it.second.internal_calls);
+        }
+    }
+}
+
+void rocsolver_logger::write_profile(bool clear)
+{
+    rocsolver_profile_map profile;
+    for(auto& data : threads)
+    {
+        std::lock_guard<std::mutex> lock(data->mtx);
+        resolve_events(*data);
+        write_buffer(data->trace_buffer, trace_os);
+        write_buffer(data->bench_buffer, bench_os);
+
+        merge_profile(profile, data->profile);
+        if(clear)
+            data->profile.clear();
+    }
+
+    if(layer_mode & rocblas_layer_mode_log_profile && !profile.empty())
+    {
+        std::string profile_str;
+        append_profile(profile_str, profile.begin(), profile.end());
+
+        std::lock_guard<std::mutex> lock(rocsolver_logger::_output_mutex);
+        fmt::print(*profile_os, "------- PROFILE -------\n{}\n", profile_str);
+        profile_os->flush();
+    }
+}
+
 rocblas_status rocsolver_log_begin_impl()
 {
     const std::lock_guard<std::mutex> lock(rocsolver_logger::_mutex);
@@ -172,6 +384,7 @@ rocblas_status rocsolver_log_begin_impl()
         return rocblas_status_internal_error;
 
     auto logger = rocsolver_logger::_instance = new rocsolver_logger();
+    logger->session_id = ++last_session_id;
 
     // set layer_mode from environment variable ROCSOLVER_LAYER or to default
     if(const char* str_layer_mode = std::getenv("ROCSOLVER_LAYER"))
@@ -200,9 +413,26 @@ rocblas_status rocsolver_log_begin_impl()
         logger->max_levels = 1;
 
     // create output streams (specified by env variables or default to stderr)
+    logger->timeline_os = nullptr;
     logger->trace_os = logger->open_log_stream("ROCSOLVER_LOG_TRACE_PATH");
     logger->bench_os = logger->open_log_stream("ROCSOLVER_LOG_BENCH_PATH");
     logger->profile_os = logger->open_log_stream("ROCSOLVER_LOG_PROFILE_PATH");
+
+    // the timeline is written in Chrome trace format (JSON array of trace events) and it is
+    // only enabled if a file is given
+    logger->timeline_enabled = false;
+    logger->timeline_origin = nullptr;
+    logger->timeline_count = 0;
+    if(const char* timeline_file = std::getenv("ROCSOLVER_LOG_TIMELINE_PATH"))
+    {
+        logger->file_streams.emplace_front(timeline_file);
+        logger->timeline_os = &logger->file_streams.front();
+        if(!logger->timeline_os->good())
+            return rocblas_status_internal_error;
+        *logger->timeline_os << "[\n";
+        logger->timeline_enabled = true;
+    }
+
     if(logger->trace_os->good() && logger->bench_os->good() && logger->profile_os->good())
         return rocblas_status_success;
     else
@@ -220,16 +450,27 @@ rocblas_status rocsolver_log_end_impl()
     auto logger = rocsolver_logger::_instance;
 
     // if there are pending log_exit calls:
-    if(!rocsolver_logger::_instance->call_stack.empty())
-        return rocblas_status_internal_error;
+    for(auto& data : logger->threads)
+    {
+        std::lock_guard<std::mutex> thread_lock(data->mtx);
+        if(!data->call_stack.empty())
+            return rocblas_status_internal_error;
+    }
 
     // print profile logging results
-    if(logger->layer_mode & rocblas_layer_mode_log_profile && !logger->profile.empty())
+    // (the data of the threads is no longer used by any function call)
+    logger->write_profile(false);
+    for(auto& data : logger->threads)
+        logger->destroy_events(*data);
+    if(logger->timeline_origin)
+        hipEventDestroy(logger->timeline_origin);
+    logger->timeline_origin = nullptr;
+
+    // close the timeline
+    if(logger->timeline_enabled)
     {
-        std::string profile_str;
-        logger->append_profile(profile_str, logger->profile.begin(), logger->profile.end());
-        fmt::print(*logger->profile_os, "------- PROFILE -------\n{}\n", profile_str);
-        logger->profile_os->flush();
+        *logger->timeline_os << "\n]\n";
+        logger->timeline_os->flush();
     }
 
     // delete the logger
@@ -302,14 +543,8 @@ rocblas_status rocsolver_log_write_profile_impl()
 
     auto logger = rocsolver_logger::_instance;
 
-    // print profile logging results
-    if(logger->layer_mode & rocblas_layer_mode_log_profile && !logger->profile.empty())
-    {
-        std::string profile_str;
-        logger->append_profile(profile_str, logger->profile.begin(), logger->profile.end());
-        fmt::print(*logger->profile_os, "------- PROFILE -------\n{}\n", profile_str);
-        logger->profile_os->flush();
-    }
+    // print profile logging results (merged from all the threads)
+    logger->write_profile(false);
     return rocblas_status_success;
 }
 
@@ -323,16 +558,8 @@ rocblas_status rocsolver_log_flush_profile_impl()
 
     auto logger = rocsolver_logger::_instance;
 
-    // print and clear profile logging results
-    if(logger->layer_mode & rocblas_layer_mode_log_profile && !logger->profile.empty())
-    {
-        std::string profile_str;
-        logger->append_profile(profile_str, logger->profile.begin(), logger->profile.end());
-        fmt::print(*logger->profile_os, "------- PROFILE -------\n{}\n", profile_str);
-        logger->profile_os->flush();
-
-        logger->profile.clear();
-    }
+    // print and clear profile logging results (merged from all the threads)
+    logger->write_profile(true);
     return rocblas_status_success;
 }
 
@@ -0,0 +1,325 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include <new>
+
+#include "rocblas.hpp"
+#include "rocsolver/rocsolver.h"
+#include "rocsolver_initialize.hpp"
+
+/** The state of a plan. In graph mode, the graph of the last execution is kept with the
+    arguments that it was captured with, together with the workspace used by the graph. **/
+struct rocsolver_plan_
+{
+    rocblas_handle handle;
+    rocsolver_problem_shape shape;
+    rocsolver_plan_mode mode;
+    size_t workspace_size;
+
+    void* workspace = nullptr;
+    hipGraphExec_t graph = nullptr;
+    rocsolver_plan_args graph_args;
+};
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/** Returns true if the plans support the function and precision of the given shape. **/
+static bool plan_supported(const rocsolver_problem_shape& shape)
+{
+    switch(shape.function)
+    {
+    case rocsolver_function_getrf:
+    case rocsolver_function_getrs:
+    case rocsolver_function_potrf:
+    case rocsolver_function_potrs:
+    case rocsolver_function_geqrf:
+    case rocsolver_function_gesv:
+    case rocsolver_function_posv: break;
+    default: return false;
+    }
+
+    return shape.datatype == rocblas_datatype_f32_r || shape.datatype == rocblas_datatype_f64_r
+        || shape.datatype == rocblas_datatype_f32_c || shape.datatype == rocblas_datatype_f64_c;
+}
+
+static bool same_args(const rocsolver_plan_args& a, const rocsolver_plan_args& b)
+{
+    return a.A == b.A && a.lda == b.lda && a.strideA == b.strideA && a.ipiv == b.ipiv
+        && a.tau == b.tau && a.strideP == b.strideP && a.B == b.B && a.ldb == b.ldb
+        && a.strideB == b.strideB && a.info == b.info && a.uplo == b.uplo && a.trans == b.trans;
+}
+
+/** PLAN_CALL calls the function of the plan with the given arguments. **/
+template <typename T>
+static rocblas_status plan_call(rocsolver_plan plan, const rocsolver_plan_args& args)
+{
+    using api = warmup_api<T>;
+
+    const rocsolver_problem_shape& shape = plan->shape;
+    rocblas_handle handle = plan->handle;
+    const bool batched = (shape.batch_count > 0);
+    const rocblas_int m = shape.m;
+    const rocblas_int n = shape.n;
+    const rocblas_int nrhs = shape.nrhs;
+    const rocblas_int bc = shape.batch_count;
+
+    T* A = static_cast<T*>(args.A);
+    T* B = static_cast<T*>(args.B);
+    T* tau = static_cast<T*>(args.tau);
+
+    switch(shape.function)
+    {
+    case rocsolver_function_getrf:
+        if(batched)
+            return api::getrf_sb(handle, m, n, A, args.lda, args.strideA, args.ipiv, args.strideP,
+                                 args.info, bc);
+        return api::getrf(handle, m, n, A, args.lda, args.ipiv, args.info);
+
+    case rocsolver_function_getrs:
+        if(batched)
+            return api::getrs_sb(handle, args.trans, n, nrhs, A, args.lda, args.strideA, args.ipiv,
+                                 args.strideP, B, args.ldb, args.strideB, bc);
+        return api::getrs(handle, args.trans, n, nrhs, A, args.lda, args.ipiv, B, args.ldb);
+
+    case rocsolver_function_gesv:
+        if(batched)
+            return api::gesv_sb(handle, n, nrhs, A, args.lda, args.strideA, args.ipiv,
+                                args.strideP, B, args.ldb, args.strideB, args.info, bc);
+        return api::gesv(handle, n, nrhs, A, args.lda, args.ipiv, B, args.ldb, args.info);
+
+    case rocsolver_function_potrf:
+        if(batched)
+            return api::potrf_sb(handle, args.uplo, n, A, args.lda, args.strideA, args.info, bc);
+        return api::potrf(handle, args.uplo, n, A, args.lda, args.info);
+
+    case rocsolver_function_potrs:
+        if(batched)
+            return api::potrs_sb(handle, args.uplo, n, nrhs, A, args.lda, args.strideA, B,
+                                 args.ldb, args.strideB, bc);
+        return api::potrs(handle, args.uplo, n, nrhs, A, args.lda, B, args.ldb);
+
+    case rocsolver_function_posv:
+        if(batched)
+            return api::posv_sb(handle, args.uplo, n, nrhs, A, args.lda, args.strideA, B, args.ldb,
+                                args.strideB, args.info, bc);
+        return api::posv(handle, args.uplo, n, nrhs, A, args.lda, B, args.ldb, args.info);
+
+    case rocsolver_function_geqrf:
+        if(batched)
+            return api::geqrf_sb(handle, m, n, A, args.lda, args.strideA, tau, args.strideP, bc);
+        return api::geqrf(handle, m, n, A, args.lda, tau);
+
+    default: return rocblas_status_invalid_value;
+    }
+}
+
+static rocblas_status plan_call_type(rocsolver_plan plan, const rocsolver_plan_args& args)
+{
+    switch(plan->shape.datatype)
+    {
+    case rocblas_datatype_f32_r: return plan_call<float>(plan, args);
+    case rocblas_datatype_f64_r: return plan_call<double>(plan, args);
+    case rocblas_datatype_f32_c: return plan_call<rocblas_float_complex>(plan, args);
+    case rocblas_datatype_f64_c: return plan_call<rocblas_double_complex>(plan, args);
+    default: return rocblas_status_invalid_value;
+    }
+}
+
+/** PLAN_CAPTURE captures the call of the function with the given arguments into the graph of
+    the plan. When the device memory of the handle is managed by rocBLAS, the function uses the
+    workspace of the plan during the capture, so that the graph does not depend on memory that
+    rocBLAS could reallocate later. **/
+static rocblas_status
+    plan_capture(rocsolver_plan plan, const rocsolver_plan_args& args, hipStream_t stream)
+{
+    rocblas_handle handle = plan->handle;
+    const bool own_workspace
+        = (plan->workspace_size > 0 && !rocblas_is_user_managing_device_memory(handle));
+    if(own_workspace)
+    {
+        if(!plan->workspace)
+            HIP_CHECK(hipMalloc(&plan->workspace, plan->workspace_size));
+        ROCBLAS_CHECK(rocblas_set_workspace(handle, plan->workspace, plan->workspace_size));
+    }
+
+    hipGraph_t graph = nullptr;
+    rocblas_status st = rocblas_status_success;
+    hipError_t err = hipStreamBeginCapture(stream, hipStreamCaptureModeThreadLocal);
+    if(err == hipSuccess)
+    {
+        st = plan_call_type(plan, args);
+        err = hipStreamEndCapture(stream, &graph);
+    }
+
+    // give the device memory back to rocBLAS
+    if(own_workspace)
+        (void)rocblas_set_workspace(handle, nullptr, 0);
+
+    if(st == rocblas_status_success && err != hipSuccess)
+        st = get_rocblas_status_for_hip_status(err);
+    if(st != rocblas_status_success)
+    {
+        if(graph)
+            (void)hipGraphDestroy(graph);
+        return st;
+    }
+
+    // update the existing graph if possible, as it is cheaper than instantiating a new one
+    bool updated = false;
+    if(plan->graph)
+    {
+        hipGraphNode_t error_node;
+        hipGraphExecUpdateResult result;
+        updated = (hipGraphExecUpdate(plan->graph, graph, &error_node, &result) == hipSuccess);
+        if(!updated)
+        {
+            (void)hipGetLastError();
+            (void)hipGraphExecDestroy(plan->graph);
+            plan->graph = nullptr;
+        }
+    }
+    if(!updated)
+        err = hipGraphInstantiate(&plan->graph, graph, nullptr, nullptr, 0);
+    (void)hipGraphDestroy(graph);
+    if(err != hipSuccess)
+    {
+        plan->graph = nullptr;
+        return get_rocblas_status_for_hip_status(err);
+    }
+
+    plan->graph_args = args;
+    return rocblas_status_success;
+}
+
+rocblas_status rocsolver_create_plan_impl(rocsolver_plan* plan,
+                                          rocblas_handle handle,
+                                          const rocsolver_problem_shape* shape,
+                                          const rocsolver_plan_mode mode)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    if(!plan || !shape)
+        return rocblas_status_invalid_pointer;
+
+    if(!plan_supported(*shape)
+       || (mode != rocsolver_plan_mode_direct && mode != rocsolver_plan_mode_graph))
+        return rocblas_status_invalid_value;
+    if(shape->m < 0 || shape->n < 0 || shape->nrhs < 0 || shape->batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // the ignored sizes are normalized as in the workspace queries
+    rocsolver_problem_shape nshape = *shape;
+    if(nshape.function != rocsolver_function_getrf && nshape.function != rocsolver_function_geqrf)
+        nshape.m = nshape.n;
+    if(nshape.function == rocsolver_function_getrf || nshape.function == rocsolver_function_potrf
+       || nshape.function == rocsolver_function_geqrf)
+        nshape.nrhs = 0;
+
+    // the workspace size, the loading of the kernels and the growth of the device memory of the
+    // handle are resolved here, once for all the executions
+    size_t size;
+    ROCBLAS_CHECK(rocsolver_get_workspace_size_impl(handle, &nshape, &size));
+    ROCBLAS_CHECK(rocsolver_initialize_impl(handle, &nshape, 1));
+
+    rocsolver_plan p = new(std::nothrow) rocsolver_plan_;
+    if(!p)
+        return rocblas_status_memory_error;
+    p->handle = handle;
+    p->shape = nshape;
+    p->mode = mode;
+    p->workspace_size = size;
+
+    *plan = p;
+    return rocblas_status_success;
+}
+
+rocblas_status rocsolver_execute_plan_impl(rocsolver_plan plan, const rocsolver_plan_args* args)
+{
+    if(!plan)
+        return rocblas_status_invalid_pointer;
+    if(!args)
+        return rocblas_status_invalid_pointer;
+
+    if(plan->mode == rocsolver_plan_mode_direct)
+        return plan_call_type(plan, *args);
+
+    hipStream_t stream;
+    ROCBLAS_CHECK(rocblas_get_stream(plan->handle, &stream));
+
+    // within a capture of the application, the call becomes part of its graph
+    if(stream_is_capturing(stream))
+        return plan_call_type(plan, *args);
+
+    if(!plan->graph || !same_args(plan->graph_args, *args))
+        ROCBLAS_CHECK(plan_capture(plan, *args, stream));
+
+    HIP_CHECK(hipGraphLaunch(plan->graph, stream));
+    return rocblas_status_success;
+}
+
+rocblas_status rocsolver_destroy_plan_impl(rocsolver_plan plan)
+{
+    if(!plan)
+        return rocblas_status_invalid_pointer;
+
+    // the workspace can still be used by a launch of the graph in progress
+    if(plan->graph || plan->workspace)
+    {
+        hipStream_t stream;
+        ROCBLAS_CHECK(rocblas_get_stream(plan->handle, &stream));
+        HIP_CHECK(hipStreamSynchronize(stream));
+    }
+    if(plan->graph)
+        HIP_CHECK(hipGraphExecDestroy(plan->graph));
+    if(plan->workspace)
+        HIP_CHECK(hipFree(plan->workspace));
+
+    delete plan;
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
+
+extern "C" rocblas_status rocsolver_create_plan(rocsolver_plan* plan,
+                                                rocblas_handle handle,
+                                                const rocsolver_problem_shape* shape,
+                                                const rocsolver_plan_mode mode)
+{
+    return rocsolver::rocsolver_create_plan_impl(plan, handle, shape, mode);
+}
+
+extern "C" rocblas_status rocsolver_execute_plan(rocsolver_plan plan,
+                                                 const rocsolver_plan_args* args)
+{
+    return rocsolver::rocsolver_execute_plan_impl(plan, args);
+}
+
+extern "C" rocblas_status rocsolver_destroy_plan(rocsolver_plan plan)
+{
+    return rocsolver::rocsolver_destroy_plan_impl(plan);
+}
@@ -0,0 +1,89 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include <hip/hip_runtime.h>
+
+#include "init_scalars.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+// the constants are given their values statically, so that they are set when the device code
+// is loaded
+__device__ float scalars_s[3] = {-1, 0, 1};
+__device__ double scalars_d[3] = {-1, 0, 1};
+__device__ rocblas_float_complex scalars_c[3]
+    = {rocblas_float_complex(-1, 0), rocblas_float_complex(0, 0), rocblas_float_complex(1, 0)};
+__device__ rocblas_double_complex scalars_z[3]
+    = {rocblas_double_complex(-1, 0), rocblas_double_complex(0, 0), rocblas_double_complex(1, 0)};
+
+/** Returns the address of the given device symbol on the current device. The address of the
+    last device used by the host thread is cached, as the symbol is resolved by the runtime. **/
+template <typename T>
+static T* symbol_address(const void* symbol)
+{
+    thread_local int cached_device = -1;
+    thread_local T* cached_ptr = nullptr;
+
+    int device;
+    if(hipGetDevice(&device) != hipSuccess)
+        return nullptr;
+    if(device != cached_device)
+    {
+        void* ptr = nullptr;
+        if(hipGetSymbolAddress(&ptr, symbol) != hipSuccess)
+            return nullptr;
+        cached_ptr = static_cast<T*>(ptr);
+        cached_device = device;
+    }
+    return cached_ptr;
+}
+
+template <>
+float* device_scalars<float>()
+{
+    return symbol_address<float>(HIP_SYMBOL(scalars_s));
+}
+
+template <>
+double* device_scalars<double>()
+{
+    return symbol_address<double>(HIP_SYMBOL(scalars_d));
+}
+
+template <>
+rocblas_float_complex* device_scalars<rocblas_float_complex>()
+{
+    return symbol_address<rocblas_float_complex>(HIP_SYMBOL(scalars_c));
+}
+
+template <>
+rocblas_double_complex* device_scalars<rocblas_double_complex>()
+{
+    return symbol_address<rocblas_double_complex>(HIP_SYMBOL(scalars_z));
+}
+
+ROCSOLVER_END_NAMESPACE
@@ -0,0 +1,90 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#ifdef ROCSOLVER_LAZY_SPECIALIZED
+
+#include <dlfcn.h>
+#include <string>
+
+#include <fmt/format.h>
+
+#include "rocsolver_specialized_module.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+#define ROCSOLVER_SPECIALIZED_MODULE_NAME "librocsolver-specialized.so"
+
+using specialized_lookup_t = void* (*)(const char*);
+
+/***************************************************************************
+ * Loads librocsolver-specialized, looking for it first in the directory
+ * of librocsolver itself and then in the default library search path, and
+ * returns its lookup function.
+ ***************************************************************************/
+static specialized_lookup_t load_specialized_module()
+{
+    void* module = nullptr;
+
+    Dl_info info;
+    if(dladdr((void*)&rocsolver_specialized_symbol, &info) && info.dli_fname)
+    {
+        std::string path(info.dli_fname);
+        size_t pos = path.find_last_of('/');
+        if(pos != std::string::npos)
+        {
+            path = path.substr(0, pos + 1) + ROCSOLVER_SPECIALIZED_MODULE_NAME;
+            module = dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL);
+        }
+    }
+
+    if(!module)
+        module = dlopen(ROCSOLVER_SPECIALIZED_MODULE_NAME, RTLD_NOW | RTLD_LOCAL);
+
+    specialized_lookup_t lookup = nullptr;
+    if(module)
+        lookup = (specialized_lookup_t)dlsym(module, "rocsolver_specialized_lookup");
+
+    if(!lookup)
+    {
+        const char* error = dlerror();
+        fmt::print(stderr, "rocSOLVER error: could not load the specialized kernels ({})\n",
+                   error ? error : ROCSOLVER_SPECIALIZED_MODULE_NAME);
+    }
+
+    return lookup;
+}
+
+void* rocsolver_specialized_symbol(const char* name)
+{
+    // the module is loaded once, by the first launcher that needs it
+    static const specialized_lookup_t lookup = load_specialized_module();
+    return lookup ? lookup(name) : nullptr;
+}
+
+ROCSOLVER_END_NAMESPACE
+
+#endif
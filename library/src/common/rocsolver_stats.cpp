@@ -0,0 +1,96 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include <map>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+
+#include "rocsolver_stats.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+thread_local rocsolver_stats_record rocsolver_current_stats = {};
+
+// the statistics of the last call, keyed by handle
+// (rocSOLVER does not own the handle, so the statistics cannot be stored in it)
+static std::mutex stats_mutex;
+static std::unordered_map<rocblas_handle, rocsolver_call_stats> last_call_stats;
+
+// the statistics of the last call of each thread, for the handles shared by several threads
+// (not thread-local, so that they can be dropped when the handle is released)
+static std::map<std::pair<rocblas_handle, std::thread::id>, rocsolver_call_stats> thread_call_stats;
+
+void rocsolver_stats_publish(rocblas_handle handle, const rocsolver_call_stats& stats)
+{
+    const bool multi = multi_thread_enabled(handle);
+
+    std::lock_guard<std::mutex> lock(stats_mutex);
+    if(multi)
+        thread_call_stats[{handle, std::this_thread::get_id()}] = stats;
+    last_call_stats[handle] = stats;
+}
+
+void release_stats(rocblas_handle handle)
+{
+    std::lock_guard<std::mutex> lock(stats_mutex);
+    last_call_stats.erase(handle);
+    for(auto it = thread_call_stats.begin(); it != thread_call_stats.end();)
+    {
+        if(it->first.first == handle)
+            it = thread_call_stats.erase(it);
+        else
+            ++it;
+    }
+}
+
+ROCSOLVER_END_NAMESPACE
+
+extern "C" rocblas_status rocsolver_get_last_call_stats(rocblas_handle handle,
+                                                        rocsolver_call_stats* stats)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!stats)
+        return rocblas_status_invalid_pointer;
+
+    const bool multi = rocsolver::multi_thread_enabled(handle);
+
+    std::lock_guard<std::mutex> lock(rocsolver::stats_mutex);
+    if(multi)
+    {
+        auto it = rocsolver::thread_call_stats.find({handle, std::this_thread::get_id()});
+        *stats = (it == rocsolver::thread_call_stats.end()) ? rocsolver_call_stats{} : it->second;
+        return rocblas_status_success;
+    }
+
+    auto it = rocsolver::last_call_stats.find(handle);
+    *stats = (it == rocsolver::last_call_stats.end()) ? rocsolver_call_stats{} : it->second;
+
+    return rocblas_status_success;
+}
@@ -0,0 +1,393 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+
+#include <atomic>
+#include <hip/hip_ext.h>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "rocsolver/rocsolver.h"
+#include "rocsolver_streams.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+// the streams of a handle with a CU mask
+// (rocSOLVER does not own the handle, so the setting cannot be stored in it)
+struct cu_mask_state
+{
+    int device;
+    int cu_count;
+    std::vector<uint32_t> mask;
+    hipStream_t prev; // the stream of the handle before the first mask was set
+    hipStream_t stream; // the masked stream set in the handle
+    hipStream_t side = nullptr;
+    std::vector<hipStream_t> batch;
+};
+
+static std::mutex cu_mask_mutex;
+static std::unordered_map<rocblas_handle, cu_mask_state> cu_masks;
+
+// number of handles with a CU mask, so that the handles without one do not need to
+// look up their setting
+static std::atomic<int> num_masked_handles{0};
+
+// returns the state of the handle if it has a CU mask for the current device
+// (cu_mask_mutex must be locked)
+static cu_mask_state* find_cu_mask(rocblas_handle handle, const int dev)
+{
+    auto it = cu_masks.find(handle);
+    if(it == cu_masks.end() || it->second.device != dev)
+        return nullptr;
+    return &it->second;
+}
+
+static hipError_t create_stream(const cu_mask_state* state, hipStream_t* stream)
+{
+    if(state)
+        return hipExtStreamCreateWithCUMask(stream, state->mask.size(), state->mask.data());
+    return hipStreamCreateWithFlags(stream, hipStreamNonBlocking);
+}
+
+// waits for the work queued in the streams of the state and destroys them
+static void release_cu_mask(cu_mask_state& state)
+{
+    std::vector<hipStream_t> streams = state.batch;
+    streams.push_back(state.stream);
+    if(state.side)
+        streams.push_back(state.side);
+
+    for(hipStream_t s : streams)
+    {
+        (void)hipStreamSynchronize(s);
+        (void)hipStreamDestroy(s);
+    }
+}
+
+// the side and batch streams of the handles without a CU mask, per device; they are not shared
+// by the handles, so that the work of a handle on these streams is not queued behind the work of
+// other handles (or captured into the graph of another handle); the rocBLAS handle of the side
+// stream is kept here also for the handles with a CU mask
+struct handle_streams
+{
+    hipStream_t side = nullptr;
+    std::vector<hipStream_t> batch;
+    rocblas_handle blas = nullptr;
+};
+
+static std::mutex handle_streams_mutex;
+static std::map<std::pair<rocblas_handle, int>, handle_streams> streams_of_handles;
+
+hipError_t rocsolver_get_side_stream(rocblas_handle handle, hipStream_t* stream)
+{
+    int dev;
+    hipError_t status = hipGetDevice(&dev);
+    if(status != hipSuccess)
+        return status;
+
+    if(num_masked_handles.load(std::memory_order_relaxed) > 0)
+    {
+        // one stream per handle with a CU mask, created on demand
+        std::lock_guard<std::mutex> lock(cu_mask_mutex);
+        cu_mask_state* state = find_cu_mask(handle, dev);
+        if(state)
+        {
+            if(!state->side)
+            {
+                status = create_stream(state, &state->side);
+                if(status != hipSuccess)
+                {
+                    state->side = nullptr;
+                    return status;
+                }
+            }
+
+            *stream = state->side;
+            return hipSuccess;
+        }
+    }
+
+    // one stream per handle and device, created on demand
+    std::lock_guard<std::mutex> lock(handle_streams_mutex);
+    handle_streams& hs = streams_of_handles[std::make_pair(handle, dev)];
+    if(!hs.side)
+    {
+        status = create_stream(nullptr, &hs.side);
+        if(status != hipSuccess)
+        {
+            hs.side = nullptr;
+            return status;
+        }
+    }
+
+    *stream = hs.side;
+    return hipSuccess;
+}
+
+hipError_t rocsolver_get_side_blas_handle(rocblas_handle handle, rocblas_handle* blas)
+{
+    int dev;
+    hipError_t status = hipGetDevice(&dev);
+    if(status != hipSuccess)
+        return status;
+
+    hipStream_t stream, side;
+    rocblas_get_stream(handle, &stream);
+    if(stream_is_capturing(stream))
+        return hipErrorStreamCaptureUnsupported;
+
+    // (the side stream is obtained first, as it may need the lock of the CU masks)
+    status = rocsolver_get_side_stream(handle, &side);
+    if(status != hipSuccess)
+        return status;
+
+    // one rocBLAS handle per handle and device, created on demand
+    std::lock_guard<std::mutex> lock(handle_streams_mutex);
+    handle_streams& hs = streams_of_handles[std::make_pair(handle, dev)];
+    if(!hs.blas && rocblas_create_handle(&hs.blas) != rocblas_status_success)
+    {
+        hs.blas = nullptr;
+        return hipErrorOutOfMemory;
+    }
+
+    // the side stream changes when the CU mask of the handle does
+    rocblas_pointer_mode pmode;
+    rocblas_atomics_mode amode;
+    rocblas_get_pointer_mode(handle, &pmode);
+    rocblas_get_atomics_mode(handle, &amode);
+    if(rocblas_set_stream(hs.blas, side) != rocblas_status_success)
+        return hipErrorInvalidHandle;
+    rocblas_set_pointer_mode(hs.blas, pmode);
+    rocblas_set_atomics_mode(hs.blas, amode);
+
+    *blas = hs.blas;
+    return hipSuccess;
+}
+
+// the rocBLAS handle selected for a handle in the current thread (see rocsolver_side_blas_scope)
+static thread_local std::pair<rocblas_handle, rocblas_handle> selected_blas_handle;
+
+rocblas_handle rocsolver_blas_handle(rocblas_handle handle)
+{
+    if(!selected_blas_handle.second || selected_blas_handle.first != handle)
+        return handle;
+
+    // the internal routines may change the pointer mode of the handle
+    rocblas_pointer_mode pmode;
+    rocblas_get_pointer_mode(handle, &pmode);
+    rocblas_set_pointer_mode(selected_blas_handle.second, pmode);
+    return selected_blas_handle.second;
+}
+
+std::pair<rocblas_handle, rocblas_handle> rocsolver_set_blas_handle(rocblas_handle handle,
+                                                                    rocblas_handle blas)
+{
+    std::pair<rocblas_handle, rocblas_handle> prev = selected_blas_handle;
+    selected_blas_handle = std::make_pair(handle, blas);
+    return prev;
+}
+
+hipError_t rocsolver_get_batch_streams(rocblas_handle handle, const int count, hipStream_t* streams)
+{
+    if(count < 0 || count > ROCSOLVER_MAX_BATCH_STREAMS)
+        return hipErrorInvalidValue;
+
+    int dev;
+    hipError_t status = hipGetDevice(&dev);
+    if(status != hipSuccess)
+        return status;
+
+    // a pool of streams per handle and device, grown on demand
+    std::unique_lock<std::mutex> lock(handle_streams_mutex, std::defer_lock);
+    std::unique_lock<std::mutex> mask_lock(cu_mask_mutex, std::defer_lock);
+    std::vector<hipStream_t>* pool;
+    cu_mask_state* state = nullptr;
+
+    if(num_masked_handles.load(std::memory_order_relaxed) > 0)
+    {
+        mask_lock.lock();
+        state = find_cu_mask(handle, dev);
+        if(!state)
+            mask_lock.unlock();
+    }
+
+    if(state)
+        pool = &state->batch;
+    else
+    {
+        lock.lock();
+        pool = &streams_of_handles[std::make_pair(handle, dev)].batch;
+    }
+
+    while(pool->size() < count)
+    {
+        hipStream_t s;
+        status = create_stream(state, &s);
+        if(status != hipSuccess)
+            return status;
+        pool->push_back(s);
+    }
+
+    for(int k = 0; k < count; ++k)
+        streams[k] = (*pool)[k];
+    return hipSuccess;
+}
+
+hipError_t rocsolver_cu_count(rocblas_handle handle, int* count)
+{
+    int dev;
+    hipError_t status = hipGetDevice(&dev);
+    if(status != hipSuccess)
+        return status;
+
+    if(num_masked_handles.load(std::memory_order_relaxed) > 0)
+    {
+        std::lock_guard<std::mutex> lock(cu_mask_mutex);
+        cu_mask_state* state = find_cu_mask(handle, dev);
+        if(state)
+        {
+            *count = state->cu_count;
+            return hipSuccess;
+        }
+    }
+
+    return hipDeviceGetAttribute(count, hipDeviceAttributeMultiprocessorCount, dev);
+}
+
+void release_cu_mask(rocblas_handle handle)
+{
+    std::lock_guard<std::mutex> lock(cu_mask_mutex);
+    auto it = cu_masks.find(handle);
+    if(it == cu_masks.end())
+        return;
+
+    rocblas_set_stream(handle, it->second.prev);
+    release_cu_mask(it->second);
+    cu_masks.erase(it);
+    num_masked_handles.store(int(cu_masks.size()));
+}
+
+void release_handle_streams(rocblas_handle handle)
+{
+    std::lock_guard<std::mutex> lock(handle_streams_mutex);
+    auto it = streams_of_handles.lower_bound(std::make_pair(handle, 0));
+    while(it != streams_of_handles.end() && it->first.first == handle)
+    {
+        if(it->second.blas)
+            (void)rocblas_destroy_handle(it->second.blas);
+
+        std::vector<hipStream_t> streams = it->second.batch;
+        if(it->second.side)
+            streams.push_back(it->second.side);
+
+        for(hipStream_t s : streams)
+        {
+            (void)hipStreamSynchronize(s);
+            (void)hipStreamDestroy(s);
+        }
+        it = streams_of_handles.erase(it);
+    }
+}
+
+ROCSOLVER_END_NAMESPACE
+
+extern "C" rocblas_status rocsolver_set_cu_mask(rocblas_handle handle,
+                                                const rocblas_int mask_size,
+                                                const uint32_t* cu_mask)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    if(mask_size < 0)
+        return rocblas_status_invalid_size;
+    if(mask_size > 0 && !cu_mask)
+        return rocblas_status_invalid_pointer;
+
+    std::lock_guard<std::mutex> lock(rocsolver::cu_mask_mutex);
+    auto it = rocsolver::cu_masks.find(handle);
+
+    hipStream_t prev;
+    if(it != rocsolver::cu_masks.end())
+        prev = it->second.prev;
+    else if(rocblas_get_stream(handle, &prev) != rocblas_status_success)
+        return rocblas_status_internal_error;
+
+    rocsolver::cu_mask_state state;
+    if(mask_size > 0)
+    {
+        int dev, numcu;
+        if(hipGetDevice(&dev) != hipSuccess
+           || hipDeviceGetAttribute(&numcu, hipDeviceAttributeMultiprocessorCount, dev)
+               != hipSuccess)
+            return rocblas_status_internal_error;
+
+        // (the bits beyond the number of CUs of the device are ignored)
+        int count = 0;
+        for(int c = 0; c < numcu && c < 32 * mask_size; ++c)
+            count += (cu_mask[c / 32] >> (c % 32)) & 1;
+        if(count == 0)
+            return rocblas_status_invalid_value;
+
+        state.device = dev;
+        state.cu_count = count;
+        state.mask.assign(cu_mask, cu_mask + mask_size);
+        state.prev = prev;
+        if(rocsolver::create_stream(&state, &state.stream) != hipSuccess)
+            return rocblas_status_internal_error;
+    }
+
+    // release the previous masked streams once the handle does not use them anymore
+    rocblas_set_stream(handle, mask_size > 0 ? state.stream : prev);
+    if(it != rocsolver::cu_masks.end())
+    {
+        rocsolver::release_cu_mask(it->second);
+        rocsolver::cu_masks.erase(it);
+    }
+
+    if(mask_size > 0)
+        rocsolver::cu_masks.emplace(handle, std::move(state));
+    rocsolver::num_masked_handles.store(int(rocsolver::cu_masks.size()));
+
+    return rocblas_status_success;
+}
+
+extern "C" rocblas_status rocsolver_get_cu_count(rocblas_handle handle, rocblas_int* count)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!count)
+        return rocblas_status_invalid_pointer;
+
+    int c;
+    if(rocsolver::rocsolver_cu_count(handle, &c) != hipSuccess)
+        return rocblas_status_internal_error;
+
+    *count = c;
+    return rocblas_status_success;
+}
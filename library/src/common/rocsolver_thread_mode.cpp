@@ -0,0 +1,156 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include <map>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+
+#include "rocsolver_thread_mode.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+// the locks of the handles shared by several host threads
+// (rocSOLVER does not own the handle, so the setting cannot be stored in it)
+static std::mutex thread_mode_mutex;
+static std::unordered_map<rocblas_handle, std::shared_ptr<std::recursive_mutex>>
+    thread_mode_locks;
+
+std::atomic<int> num_multi_thread_handles{0};
+
+thread_local int rocsolver_thread_scope::depth = 0;
+
+// the streams set by each thread, keyed by handle and thread
+// (not thread-local, so that they can be dropped when the handle is released)
+static std::mutex thread_streams_mutex;
+static std::map<std::pair<rocblas_handle, std::thread::id>, hipStream_t> thread_streams;
+
+std::shared_ptr<std::recursive_mutex> get_thread_mode_lock(rocblas_handle handle)
+{
+    std::lock_guard<std::mutex> lock(thread_mode_mutex);
+    auto it = thread_mode_locks.find(handle);
+    return (it == thread_mode_locks.end()) ? nullptr : it->second;
+}
+
+bool get_thread_stream(rocblas_handle handle, hipStream_t* stream)
+{
+    std::lock_guard<std::mutex> lock(thread_streams_mutex);
+    auto it = thread_streams.find({handle, std::this_thread::get_id()});
+    if(it == thread_streams.end())
+        return false;
+    *stream = it->second;
+    return true;
+}
+
+void release_thread_mode(rocblas_handle handle)
+{
+    {
+        std::lock_guard<std::mutex> lock(thread_mode_mutex);
+        thread_mode_locks.erase(handle);
+        num_multi_thread_handles.store(int(thread_mode_locks.size()));
+    }
+
+    std::lock_guard<std::mutex> lock(thread_streams_mutex);
+    for(auto it = thread_streams.begin(); it != thread_streams.end();)
+    {
+        if(it->first.first == handle)
+            it = thread_streams.erase(it);
+        else
+            ++it;
+    }
+}
+
+ROCSOLVER_END_NAMESPACE
+
+extern "C" rocblas_status rocsolver_set_thread_mode(rocblas_handle handle,
+                                                    const rocsolver_thread_mode mode)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    if(mode != rocsolver_thread_mode_single && mode != rocsolver_thread_mode_multi)
+        return rocblas_status_invalid_value;
+
+    std::lock_guard<std::mutex> lock(rocsolver::thread_mode_mutex);
+    if(mode == rocsolver_thread_mode_multi)
+    {
+        auto& handle_lock = rocsolver::thread_mode_locks[handle];
+        if(!handle_lock)
+            handle_lock = std::make_shared<std::recursive_mutex>();
+    }
+    else
+        rocsolver::thread_mode_locks.erase(handle);
+    rocsolver::num_multi_thread_handles.store(int(rocsolver::thread_mode_locks.size()));
+
+    return rocblas_status_success;
+}
+
+extern "C" rocblas_status rocsolver_get_thread_mode(rocblas_handle handle,
+                                                    rocsolver_thread_mode* mode)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!mode)
+        return rocblas_status_invalid_pointer;
+
+    *mode = rocsolver::multi_thread_enabled(handle) ? rocsolver_thread_mode_multi
+                                                    : rocsolver_thread_mode_single;
+
+    return rocblas_status_success;
+}
+
+extern "C" rocblas_status rocsolver_set_thread_stream(rocblas_handle handle, hipStream_t stream)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    std::lock_guard<std::mutex> lock(rocsolver::thread_streams_mutex);
+    if(stream)
+        rocsolver::thread_streams[{handle, std::this_thread::get_id()}] = stream;
+    else
+        rocsolver::thread_streams.erase({handle, std::this_thread::get_id()});
+
+    return rocblas_status_success;
+}
+
+extern "C" rocblas_status rocsolver_get_thread_stream(rocblas_handle handle, hipStream_t* stream)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!stream)
+        return rocblas_status_invalid_pointer;
+
+    auto handle_lock = rocsolver::get_thread_mode_lock(handle);
+    if(handle_lock && rocsolver::get_thread_stream(handle, stream))
+        return rocblas_status_success;
+
+    // the stream of a shared handle is swapped during the calls of the other threads
+    std::unique_lock<std::recursive_mutex> lock;
+    if(handle_lock)
+        lock = std::unique_lock<std::recursive_mutex>(*handle_lock);
+    return rocblas_get_stream(handle, stream);
+}
@@ -0,0 +1,276 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include <atomic>
+#include <cerrno>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <unordered_set>
+
+#include <hip/hip_runtime.h>
+
+#include "rocblas_utility.hpp"
+#include "rocsolver_cache.hpp"
+#include "rocsolver_tuning.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/***************************************************************************
+ * Helpers to parse the tuning file
+ ***************************************************************************/
+
+static std::string trim(const std::string& str)
+{
+    size_t first = str.find_first_not_of(" \t\r");
+    if(first == std::string::npos)
+        return "";
+    size_t last = str.find_last_not_of(" \t\r");
+    return str.substr(first, last - first + 1);
+}
+
+static bool parse_values(const std::string& str, std::vector<int64_t>& values)
+{
+    std::stringstream ss(str);
+    std::string item;
+    while(std::getline(ss, item, ','))
+    {
+        item = trim(item);
+        if(item.empty())
+            return false;
+
+        char* end;
+        errno = 0;
+        long long value = strtoll(item.c_str(), &end, 0);
+        if(errno || *end != '\0')
+            return false;
+        values.push_back(value);
+    }
+    return !values.empty();
+}
+
+// the switch sizes must be positive and increasing
+static bool valid_intervals(const std::vector<int64_t>& intervals)
+{
+    for(size_t i = 0; i < intervals.size(); ++i)
+    {
+        if(intervals[i] <= 0 || (i > 0 && intervals[i] <= intervals[i - 1]))
+            return false;
+    }
+    return true;
+}
+
+/***************************************************************************
+ * Tuning tables
+ ***************************************************************************/
+
+/** The tuning file is a plain text file with lines of the form
+
+        name.intervals = i_1, i_2, ..., i_k
+        name.blksizes = b_0, b_1, ..., b_k
+
+    where name is the lower-case name of the constants in ideal_sizes.hpp without the
+    suffixes (e.g. getrf_batch_real for GETRF_BATCH_INTERVALS_REAL and GETRF_BATCH_BLKSIZES_REAL).
+    The two-dimensional tables are given instead by lines of the form
+
+        name.intervals_rows = i_1, i_2, ..., i_k
+        name.intervals_cols = j_1, j_2, ..., j_l
+        name.blksizes = b_00, b_01, ..., b_0l, b_10, ..., b_kl
+
+    with the block sizes stored by rows. Entries that follow a line of the form [gfxXXX] only
+    apply to devices of that architecture; entries before the first such line, or after a line
+    [*], apply to all devices (or only to devices of the architecture default_arch, if given).
+    Empty lines and lines starting with # are ignored. Incomplete or malformed tables (including
+    those whose switch sizes are not positive and increasing) are discarded, so that the
+    compile-time defaults apply. Tables already loaded from other files are replaced. **/
+void rocsolver_tuning::load_file(const std::string& path, const std::string& default_arch)
+{
+    std::ifstream file(path);
+    if(!file.good())
+        return;
+
+    std::unordered_map<std::string, std::vector<int64_t>> intervals, intervals_cols, blksizes;
+    std::string arch = default_arch;
+    std::string line;
+    while(std::getline(file, line))
+    {
+        line = trim(line.substr(0, line.find('#')));
+        if(line.empty())
+            continue;
+
+        if(line.front() == '[' && line.back() == ']')
+        {
+            arch = trim(line.substr(1, line.size() - 2));
+            if(arch == "*")
+                arch = default_arch;
+            continue;
+        }
+
+        size_t eq = line.find('=');
+        size_t dot = line.rfind('.', eq);
+        if(eq == std::string::npos || dot == std::string::npos)
+            continue;
+
+        std::string key = arch + ":" + trim(line.substr(0, dot));
+        std::string field = trim(line.substr(dot + 1, eq - dot - 1));
+        std::vector<int64_t> values;
+        if(!parse_values(line.substr(eq + 1), values))
+            continue;
+
+        if(field == "intervals" || field == "intervals_rows")
+            intervals[key] = std::move(values);
+        else if(field == "intervals_cols")
+            intervals_cols[key] = std::move(values);
+        else if(field == "blksizes")
+            blksizes[key] = std::move(values);
+    }
+
+    // keep only the complete and valid tables
+    for(auto& it : intervals)
+    {
+        auto bs = blksizes.find(it.first);
+        auto cols = intervals_cols.find(it.first);
+        const size_t ncols = (cols == intervals_cols.end()) ? 1 : cols->second.size() + 1;
+        if(bs == blksizes.end() || bs->second.size() != (it.second.size() + 1) * ncols)
+            continue;
+        if(!valid_intervals(it.second)
+           || (cols != intervals_cols.end() && !valid_intervals(cols->second)))
+            continue;
+
+        rocsolver_tuning_table& table = tables[it.first];
+        table.intervals = std::move(it.second);
+        table.intervals_cols
+            = (cols == intervals_cols.end()) ? std::vector<int64_t>{} : std::move(cols->second);
+        table.blksizes = std::move(bs->second);
+    }
+}
+
+rocsolver_tuning::rocsolver_tuning()
+{
+    // record the architecture of every device
+    int count = 0;
+    if(hipGetDeviceCount(&count) != hipSuccess)
+        count = 0;
+    device_arch.resize(count);
+    for(int dev = 0; dev < count; ++dev)
+    {
+        std::string name = rocsolver_device_arch(dev);
+        device_arch[dev] = name.substr(0, name.find(':'));
+    }
+
+    // the tables in the persistent cache apply to the architecture of their directory
+    // (see rocsolver_cache.hpp); the tables of the file given by ROCSOLVER_TUNING_PATH
+    // replace them
+    std::unordered_set<std::string> loaded;
+    for(int dev = 0; dev < count; ++dev)
+    {
+        std::string dir = rocsolver_cache_dir(dev, false);
+        if(!dir.empty() && !device_arch[dev].empty() && loaded.insert(dir).second)
+            load_file(dir + "/tuning", device_arch[dev]);
+    }
+
+    const char* path = std::getenv("ROCSOLVER_TUNING_PATH");
+    env_path = path ? path : "";
+    if(!env_path.empty())
+        load_file(env_path, "*");
+
+    // FNV-1a hash of the tables, in the order of their keys
+    if(!tables.empty())
+    {
+        std::map<std::string, const rocsolver_tuning_table*> sorted;
+        for(const auto& it : tables)
+            sorted.emplace(it.first, &it.second);
+
+        uint64_t h = 14695981039346656037ull;
+        auto mix = [&h](const void* data, size_t size) {
+            const unsigned char* bytes = static_cast<const unsigned char*>(data);
+            for(size_t i = 0; i < size; ++i)
+                h = (h ^ bytes[i]) * 1099511628211ull;
+        };
+        for(const auto& it : sorted)
+        {
+            mix(it.first.data(), it.first.size() + 1);
+            mix(it.second->intervals.data(), sizeof(int64_t) * it.second->intervals.size());
+            mix(it.second->intervals_cols.data(),
+                sizeof(int64_t) * it.second->intervals_cols.size());
+            mix(it.second->blksizes.data(), sizeof(int64_t) * it.second->blksizes.size());
+        }
+        tables_signature = (h == 0 ? 1 : h);
+    }
+}
+
+static std::atomic<const rocsolver_tuning*> current_tuning{nullptr};
+static std::mutex reload_mutex;
+
+const rocsolver_tuning& rocsolver_tuning::instance()
+{
+    const rocsolver_tuning* tuning = current_tuning.load(std::memory_order_acquire);
+    if(tuning)
+        return *tuning;
+
+    std::lock_guard<std::mutex> lock(reload_mutex);
+    tuning = current_tuning.load(std::memory_order_relaxed);
+    if(!tuning)
+    {
+        tuning = new rocsolver_tuning();
+        current_tuning.store(tuning, std::memory_order_release);
+    }
+    return *tuning;
+}
+
+void rocsolver_tuning::reload()
+{
+    const rocsolver_tuning& tuning = instance();
+    const char* path = std::getenv("ROCSOLVER_TUNING_PATH");
+    if(tuning.env_path == (path ? path : ""))
+        return;
+
+    std::lock_guard<std::mutex> lock(reload_mutex);
+    current_tuning.store(new rocsolver_tuning(), std::memory_order_release);
+}
+
+const rocsolver_tuning_table* rocsolver_tuning::get_table(const char* name) const
+{
+    if(tables.empty())
+        return nullptr;
+
+    int dev;
+    if(hipGetDevice(&dev) == hipSuccess && dev >= 0 && dev < device_arch.size())
+    {
+        auto it = tables.find(device_arch[dev] + ":" + name);
+        if(it != tables.end())
+            return &it->second;
+    }
+
+    auto it = tables.find(std::string("*:") + name);
+    return (it != tables.end() ? &it->second : nullptr);
+}
+
+ROCSOLVER_END_NAMESPACE
@@ -0,0 +1,95 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include <mutex>
+#include <unordered_map>
+
+#include "rocblas.hpp"
+#include "rocsolver_stats.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+// the memory pools of the workspace, keyed by handle
+// (rocSOLVER does not own the handle, so the pools cannot be stored in it)
+static std::mutex pool_mutex;
+static std::unordered_map<rocblas_handle, hipMemPool_t> workspace_pools;
+
+hipMemPool_t get_workspace_pool(rocblas_handle handle)
+{
+    std::lock_guard<std::mutex> lock(pool_mutex);
+    auto it = workspace_pools.find(handle);
+    return (it == workspace_pools.end()) ? nullptr : it->second;
+}
+
+void release_workspace_pool(rocblas_handle handle)
+{
+    std::lock_guard<std::mutex> lock(pool_mutex);
+    workspace_pools.erase(handle);
+}
+
+rocblas_status rocsolver_set_workspace_pool_impl(rocblas_handle handle,
+                                                 hipMemPool_t pool,
+                                                 const uint64_t release_threshold)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    if(pool)
+    {
+        uint64_t threshold = release_threshold;
+        HIP_CHECK(hipMemPoolSetAttribute(pool, hipMemPoolAttrReleaseThreshold, &threshold));
+    }
+
+    std::lock_guard<std::mutex> lock(pool_mutex);
+    if(pool)
+        workspace_pools[handle] = pool;
+    else
+        workspace_pools.erase(handle);
+
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
+
+extern "C" rocblas_status rocsolver_set_workspace_pool(rocblas_handle handle,
+                                                       hipMemPool_t pool,
+                                                       const uint64_t release_threshold)
+{
+    return rocsolver::rocsolver_set_workspace_pool_impl(handle, pool, release_threshold);
+}
+
+extern "C" rocblas_status rocsolver_get_workspace_pool(rocblas_handle handle, hipMemPool_t* pool)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!pool)
+        return rocblas_status_invalid_pointer;
+
+    *pool = rocsolver::get_workspace_pool(handle);
+
+    return rocblas_status_success;
+}
@@ -1,5 +1,5 @@
 /* **************************************************************************
- * Copyright (C) 2019-2024 Advanced Micro Devices, Inc. All rights reserved.
+ * Copyright (C) 2019-2025 Advanced Micro Devices, Inc. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions
@@ -29,8 +29,55 @@
 
 /*! \file
     \brief ideal_sizes.hpp gathers all constants that can be tuned for performance.
+
+    \details The interval tables used by GETRF, GETRI and TRTRI (*_INTERVALS and *_BLKSIZES),
+    as well as the 2-D tables of the GETRF inner blocking and of TRSM (*_INTERVALSROW,
+    *_INTERVALSCOL and *_BLKSIZES), can also be overridden at run time, per device architecture,
+    with the tuning file given by the environment variable ROCSOLVER_TUNING_PATH (see
+    rocsolver_tuning.hpp).
  *********************************************************************************/
 
+/******************************* larfb ****************************************
+*******************************************************************************/
+/*! \brief Determines the maximum number of reflectors for which LARFB applies a block reflector
+    with a single fused kernel.
+
+    \details When the block reflector is stored column-wise in the forward direction and applied
+    from the left, k <= LARFB_FUSED_MAX_K and n <= LARFB_FUSED_MAX_N, LARFB launches one kernel that
+    keeps tiles of V, and then T, in LDS, computes W = V' * C and trans(T) * W for a block of columns
+    of C, and updates C; instead of the sequence of copies, TRMMs and GEMMs. The fused kernel is
+    also skipped if the required LDS exceeds 64 KB. */
+#ifndef LARFB_FUSED_MAX_K
+#define LARFB_FUSED_MAX_K 64 //always <= 64
+#endif
+#ifndef LARFB_FUSED_MAX_N
+#define LARFB_FUSED_MAX_N 1024
+#endif
+
+/******************************* larft ****************************************
+*******************************************************************************/
+/*! \brief Determines the maximum order of a block reflector for which LARFT computes the
+    triangular factor with a single kernel.
+
+    \details When k <= 32 and n <= LARFT_SMALL_MAX_N, LARFT launches one thread-block per matrix
+    that accumulates V' * V in LDS and forms T from it, instead of calling a GEMV and a TRMV for
+    every Householder vector. */
+#ifndef LARFT_SMALL_MAX_N
+#define LARFT_SMALL_MAX_N 1024
+#endif
+
+/*! \brief Determines the minimum number of Householder vectors for LARFT to compute the triangular
+    factor of a block reflector with the recursive algorithm.
+
+    \details Block reflectors stored column-wise in the forward direction (as in the QR-family
+    routines) with k >= LARFT_RECURSIVE_MIN_K vectors are split in two halves, whose triangular
+    factors are computed recursively and combined with TRMMs and a GEMM. The smaller blocks are
+    computed with the single kernel (see LARFT_SMALL_MAX_N), after a GEMM for the rows of V below
+    their triangular part when n > LARFT_SMALL_MAX_N. */
+#ifndef LARFT_RECURSIVE_MIN_K
+#define LARFT_RECURSIVE_MIN_K 32 //always <= 32
+#endif
+
 /***************** geqr2/geqrf and geql2/geqlf ********************************
 *******************************************************************************/
 /*! \brief Determines the size of the block column factorized at each step
@@ -51,6 +98,66 @@
 #define GEQxF_GEQx2_SWITCHSIZE 128
 #endif
 
+/*! \brief Determines the minimum number of rows of a block panel for GEQRF to factorize it with
+    the recursive algorithm. It also applies to the corresponding batched and strided-batched routines.
+
+    \details Tall block panels (with at most 2*GEQxF_BLOCKSIZE columns) are split in two halves of
+    columns, that are factorized recursively; the block reflector of the left half is applied to the
+    right half in between. Panels with no more than GEQRF_RECURSIVE_LEAF_SIZE columns are factorized
+    with the unblocked algorithm (GEQR2). */
+#ifndef GEQRF_RECURSIVE_MIN_ROWS
+#define GEQRF_RECURSIVE_MIN_ROWS 4096
+#endif
+
+/*! \brief Determines the maximum number of columns of the leaf panels in the recursive
+    factorization of tall block panels in GEQRF (see GEQRF_RECURSIVE_MIN_ROWS). */
+#ifndef GEQRF_RECURSIVE_LEAF_SIZE
+#define GEQRF_RECURSIVE_LEAF_SIZE 16
+#endif
+
+/*! \brief Determines the maximum number of rows of a block panel for GEQRF to factorize it and
+    compute the triangular factor of its block reflector with a single kernel. It also applies to
+    the corresponding batched and strided-batched routines.
+
+    \details Block panels with at most GEQRF_PANEL_MAX_ROWS rows are processed by one thread-block
+    per matrix working directly in global memory, instead of calling GEQR2 and LARFT, which launch
+    several kernels for every column. As a single thread-block works on each panel, taller panels
+    are better served by the BLAS-based functions. */
+#ifndef GEQRF_PANEL_MAX_ROWS
+#define GEQRF_PANEL_MAX_ROWS 1024
+#endif
+
+/*! \brief Determines the maximum number of columns for which GEQR2 can use the small-size kernel.
+    It also applies to the corresponding batched and strided-batched routines, and to the
+    unblocked panels of GEQRF.
+
+    \details The small-size kernel factorizes each matrix of the batch in a single launch, keeping
+    it entirely within the LDS shared memory. It is used when n <= GEQR2_SPKER_MAX_N and
+    m*n <= GEQR2_SPKER_MAX_SIZE(T). */
+#ifndef GEQR2_SPKER_MAX_N
+#define GEQR2_SPKER_MAX_N 64
+#endif
+
+/*! \brief Determines the maximum number of elements (m*n) of a matrix for which GEQR2 can use the
+    small-size kernel (see GEQR2_SPKER_MAX_N).
+
+    \details The amount of LDS shared memory is assumed to be at least (64 * 1024) bytes. */
+#ifndef GEQR2_SPKER_MAX_SIZE
+#define GEQR2_SPKER_MAX_SIZE(T) ((sizeof(T) == 4) ? 14336 : (sizeof(T) == 8) ? 7168 : 3584)
+#endif
+
+/***************** geqp3 ******************************************************
+*******************************************************************************/
+/*! \brief Determines the size of the block column factorized at each step
+    in the blocked QR algorithm with column pivoting (GEQP3). It also applies to the
+    corresponding batched and strided-batched routines.
+
+    \details Each block column is factorized with LAQPS, which delays the update of the trailing
+    matrix so that it can be applied with a single matrix-matrix product at the end of the block.*/
+#ifndef GEQP3_BLOCKSIZE
+#define GEQP3_BLOCKSIZE 32
+#endif
+
 /***************** gerq2/gerqf and gelq2/gelqf ********************************
 *******************************************************************************/
 /*! \brief Determines the size of the block row factorized at each step
@@ -151,6 +258,58 @@
 #define GEBRD_GEBD2_SWITCHSIZE 64
 #endif
 
+/*! \brief Determines the maximum size at which rocSOLVER uses the fused small-size kernel when
+    executing GEBD2 (and GEBRD, which calls GEBD2 for small matrices). It also applies to the
+    corresponding batched and strided-batched routines.
+
+    \details If m <= GEBD2_SMALL_MAX_SIZE and n <= GEBD2_SMALL_MAX_SIZE, the matrix is reduced to
+    bidiagonal form with a single kernel call that keeps it in LDS, instead of launching LARFG and
+    LARF for every column and row. The matrix must fit within (64 * 1024) bytes of LDS
+    (so, with double complex precision, one of the dimensions must be smaller than 64).*/
+#ifndef GEBD2_SMALL_MAX_SIZE
+#define GEBD2_SMALL_MAX_SIZE 64
+#endif
+
+/*! \brief Determines the size at which GESVD switches from the one-stage to the two-stage
+    reduction to bidiagonal form when only the singular values are required. It also applies to
+    the corresponding batched and strided-batched routines.
+
+    \details If min(m,n) >= GEBRD_2STAGE_SWITCHSIZE, the matrix is first reduced to an upper band
+    matrix with GEBRD_2STAGE_BANDWIDTH super-diagonals using Level-3 BLAS operations, and the band
+    matrix is then reduced to bidiagonal form by bulge chasing.*/
+#ifndef GEBRD_2STAGE_SWITCHSIZE
+#define GEBRD_2STAGE_SWITCHSIZE 2048
+#endif
+
+/*! \brief Determines the number of super-diagonals of the intermediate band matrix in the
+    two-stage reduction to bidiagonal form.
+
+    \details A wider band makes the first stage richer in matrix-matrix products, at the cost of more
+    work in the bulge-chasing second stage. GEBRD_2STAGE_BANDWIDTH must not exceed 64.*/
+#ifndef GEBRD_2STAGE_BANDWIDTH
+#define GEBRD_2STAGE_BANDWIDTH 32
+#endif
+
+/**************************** gehd2/gehrd *************************************
+*******************************************************************************/
+/*! \brief Determines the size of the block column that is reduced to Hessenberg form at each step
+    when using the blocked algorithm (GEHRD). It also applies to the
+    corresponding batched and strided-batched routines.*/
+#ifndef GEHRD_BLOCKSIZE
+#define GEHRD_BLOCKSIZE 32
+#endif
+
+/*! \brief Determines the size at which rocSOLVER switches from
+    the unblocked to the blocked algorithm when executing GEHRD. It also applies to the
+    corresponding batched and strided-batched routines.
+
+    \details GEHRD will use LAHR2 to reduce blocks of GEHRD_BLOCKSIZE columns at a time until
+    the trailing submatrix has no more than GEHRD_GEHD2_SWITCHSIZE columns; at this point the last
+    block, if any, will be reduced with the unblocked algorithm (GEHD2).*/
+#ifndef GEHRD_GEHD2_SWITCHSIZE
+#define GEHRD_GEHD2_SWITCHSIZE 128
+#endif
+
 /******************************* bdsqr ****************************************
 *******************************************************************************/
 /*! \brief Determines the maximum number of split diagonal blocks that BDSQR can process in parallel.
@@ -162,6 +321,45 @@
 #define BDSQR_SPLIT_GROUPS 5
 #endif
 
+/*! \brief Determines the size at which BDSQR switches to the blocked algorithm when singular
+    vectors are requested.
+
+    \details If n >= BDSQR_BLOCKED_SWITCHSIZE, every diagonal block is processed by its own thread
+    group, and the rotations of several QR steps are saved and then applied at once to the singular
+    vectors. Otherwise, the rotations are applied after each QR step. (The blocked algorithm is not
+    used while the stream is being captured into a graph.) */
+#ifndef BDSQR_BLOCKED_SWITCHSIZE
+#define BDSQR_BLOCKED_SWITCHSIZE 512
+#endif
+
+/*! \brief Determines the number of QR steps whose rotations are saved before they are applied to
+    the singular vectors in the blocked algorithm of BDSQR. Must be at least 1.
+
+    \details A larger value means fewer kernel launches and convergence checks on the host, at the
+    cost of a larger workspace of size BDSQR_BLOCKED_STEPS*(1+incw)*n per batch instance, where
+    incw is 2 or 4 depending on the requested singular vectors. */
+#ifndef BDSQR_BLOCKED_STEPS
+#define BDSQR_BLOCKED_STEPS 32
+#endif
+
+/*! \brief Determines the number of threads per group used to apply the saved rotations to the
+    singular vectors in the blocked algorithm of BDSQR.
+
+    \details Each thread updates one column (or row) of the singular vectors, so smaller groups
+    spread the update over more compute units. */
+#ifndef BDSQR_BLOCKED_ROTATE_THDS
+#define BDSQR_BLOCKED_ROTATE_THDS 64
+#endif
+
+/*! \brief Determines the maximum number of host threads used by BDSQR in the hybrid mode.
+
+    \details In the hybrid mode (see rocsolver_alg_mode_hybrid), the diagonal blocks of the
+    bidiagonal matrices are processed on the host, each by a single thread. The number of threads
+    is also limited by the number of diagonal blocks and the number of cores of the host. */
+#ifndef BDSQR_HYBRID_THREADS
+#define BDSQR_HYBRID_THREADS 64
+#endif
+
 /******************************* gesvd ****************************************
 *******************************************************************************/
 /*! \brief Determines the factor by which one dimension of a matrix should exceed
@@ -174,6 +372,19 @@
 #define THIN_SVD_SWITCH 1.6
 #endif
 
+/******************************* gesvdj ***************************************
+*******************************************************************************/
+/*! \brief Determines the maximum size at which GESVDJ uses the small-size kernel. It also
+    applies to the corresponding batched and strided-batched routines.
+
+    \details If m <= GESVDJ_SMALL_SIZE and n <= GESVDJ_SMALL_SIZE, the SVD is computed with a
+    single kernel call that applies the one-sided Jacobi algorithm to each matrix within the LDS.
+    (Requests for the full set of left singular vectors when m > n, or of right singular vectors
+    when m < n, always use the general algorithm). Must be <= 32. */
+#ifndef GESVDJ_SMALL_SIZE
+#define GESVDJ_SMALL_SIZE 32
+#endif
+
 /******************* sytd2/sytrd and hetd2/hetrd *******************************
 *******************************************************************************/
 /*! \brief Determines the size of the leading block that is reduced to tridiagonal form at each step
@@ -194,6 +405,67 @@
 #define xxTRD_xxTD2_SWITCHSIZE 64
 #endif
 
+/*! \brief Determines the maximum size of a matrix for which SYTD2/HETD2 can use the small-size
+    kernel. It also applies to the corresponding batched and strided-batched routines, and to the
+    unblocked tail of SYTRD/HETRD (and therefore to SYEV/HEEV, SYEVD/HEEVD, etc.)
+
+    \details The small-size kernel reduces each matrix of the batch in a single launch, keeping it
+    entirely within the LDS shared memory. It is used when n <= SYTD2_SPKER_MAX_N and
+    n*n <= SYTD2_SPKER_MAX_SIZE(T). The amount of LDS shared memory is assumed to be at least
+    (64 * 1024) bytes. */
+#ifndef SYTD2_SPKER_MAX_N
+#define SYTD2_SPKER_MAX_N 128
+#endif
+#ifndef SYTD2_SPKER_MAX_SIZE
+#define SYTD2_SPKER_MAX_SIZE(T) ((sizeof(T) == 4) ? 14336 : (sizeof(T) == 8) ? 7168 : 3584)
+#endif
+
+/*! \brief Determines the maximum number of columns reduced by LATRD with the fused kernels.
+
+    \details When k <= LATRD_FUSED_MAX_K, each step of LATRD computes the SYMV/HEMV with the
+    trailing matrix, the GEMVs with the already reduced columns of A and W, and the scaling by tau
+    with two kernels instead of seven launches. The first kernel reads every element of the stored
+    triangle once, using it for both of the symmetric products it contributes to. (It also applies
+    to SYTRD/HETRD, with k = xxTRD_BLOCKSIZE) */
+#ifndef LATRD_FUSED_MAX_K
+#define LATRD_FUSED_MAX_K 64
+#endif
+
+/*! \brief Determines the size at which SYEVD/HEEVD switch from the one-stage to the two-stage
+    reduction to tridiagonal form. It also applies to the corresponding batched and strided-batched
+    routines.
+
+    \details If n >= xxTRD_2STAGE_SWITCHSIZE, the matrix is first reduced to a band matrix with
+    xxTRD_2STAGE_BANDWIDTH sub-diagonals using Level-3 BLAS operations, and the band matrix is then
+    reduced to tridiagonal form by bulge chasing.*/
+#ifndef xxTRD_2STAGE_SWITCHSIZE
+#define xxTRD_2STAGE_SWITCHSIZE 2048
+#endif
+
+/*! \brief Determines the number of sub-diagonals of the intermediate band matrix in the two-stage
+    reduction to tridiagonal form.
+
+    \details A wider band makes the first stage richer in matrix-matrix products, at the cost of more
+    work in the bulge-chasing second stage. xxTRD_2STAGE_BANDWIDTH must not exceed 64.*/
+#ifndef xxTRD_2STAGE_BANDWIDTH
+#define xxTRD_2STAGE_BANDWIDTH 32
+#endif
+
+/*! \brief Determines the range of sizes for which SYEVD/HEEVD pipeline the back-transformation of
+    the eigenvectors after the two-stage reduction. It only applies to the non-batched routines.
+
+    \details The eigenvectors are back-transformed by blocks of xxTRD_2STAGE_PIPELINE_COLS columns:
+    while the reflectors of the first stage are applied (ORMQR/ORMLQ) to a block, those of the
+    second stage (bulge chasing) are applied to the next block on a second stream. The pipeline is
+    used when more than xxTRD_2STAGE_PIPELINE_COLS eigenvectors are back-transformed and
+    n <= xxTRD_2STAGE_PIPELINE_MAX_SIZE; setting xxTRD_2STAGE_PIPELINE_MAX_SIZE to 0 disables it. */
+#ifndef xxTRD_2STAGE_PIPELINE_COLS
+#define xxTRD_2STAGE_PIPELINE_COLS 512
+#endif
+#ifndef xxTRD_2STAGE_PIPELINE_MAX_SIZE
+#define xxTRD_2STAGE_PIPELINE_MAX_SIZE 8192
+#endif
+
 /***************** sygs2/sygst and hegs2/hegst ********************************
 *******************************************************************************/
 /*! \brief Determines the size of the leading block that is reduced to standard form at each step
@@ -207,6 +479,81 @@
 #define xxGST_BLOCKSIZE 64
 #endif
 
+/*! \brief Determines the size at which SYGST/HEGST switches to the recursive algorithm when
+    itype = 1. It also applies to the corresponding batched and strided-batched routines.
+
+    \details If n > xxGST_RECURSIVE_SWITCHSIZE, the matrix is split in two halves; the leading
+    and trailing diagonal blocks are reduced recursively, and the off-diagonal block is updated with
+    TRSM, SYMM/HEMM and SYR2K/HER2K calls of size n/2. Blocks of size up to
+    xxGST_RECURSIVE_SWITCHSIZE are reduced with the blocked algorithm. Must be at least
+    2*xxGST_BLOCKSIZE. */
+#ifndef xxGST_RECURSIVE_SWITCHSIZE
+#define xxGST_RECURSIVE_SWITCHSIZE 1024
+#endif
+
+/*! \brief Determines the maximum size of a problem for which SYGS2/HEGS2 can use the small-size
+    kernel. It also applies to the corresponding batched and strided-batched routines, and to
+    SYGST/HEGST (and therefore to SYGV/HEGV, SYGVD/HEGVD, SYGVJ/HEGVJ, SYGVDX/HEGVDX, etc.)
+
+    \details The small-size kernel reduces each problem of the batch in a single launch, keeping
+    the triangles of A and B entirely within the LDS shared memory. It is used when
+    n <= SYGS2_SPKER_MAX_N and n*(n+2) <= SYGS2_SPKER_MAX_SIZE(T). SYGST/HEGST call it directly
+    when it applies to the whole problem; otherwise, the blocked algorithm uses it for the
+    diagonal blocks of size xxGST_BLOCKSIZE. The amount of LDS shared memory is assumed to be at
+    least (64 * 1024) bytes. */
+#ifndef SYGS2_SPKER_MAX_N
+#define SYGS2_SPKER_MAX_N 128
+#endif
+#ifndef SYGS2_SPKER_MAX_SIZE
+#define SYGS2_SPKER_MAX_SIZE(T) ((sizeof(T) == 4) ? 16320 : (sizeof(T) == 8) ? 8160 : 4080)
+#endif
+
+/****************************** sterf ******************************************
+*******************************************************************************/
+/*! \brief Determines the size at which STERF switches from the QR algorithm to bisection.
+
+    \details If n >= STERF_BISECTION_SWITCHSIZE, the eigenvalues are computed by bisection with
+    Sturm counts, using a different thread for each eigenvalue. Otherwise, a single thread
+    computes all the eigenvalues with the root-free QR algorithm. */
+#ifndef STERF_BISECTION_SWITCHSIZE
+#define STERF_BISECTION_SWITCHSIZE 256
+#endif
+
+/****************************** steqr ******************************************
+*******************************************************************************/
+/*! \brief Determines the size at which STEQR switches to the blocked algorithm.
+
+    \details If n >= STEQR_BLOCKED_SWITCHSIZE, the rotations of several QR sweeps are saved by a
+    single thread and then applied to the eigenvectors by all the threads of the group, each
+    thread updating different rows. Otherwise, a single thread applies the rotations after each
+    sweep. */
+#ifndef STEQR_BLOCKED_SWITCHSIZE
+#define STEQR_BLOCKED_SWITCHSIZE 8
+#endif
+
+/*! \brief Determines the maximum number of QR sweeps whose rotations are saved before they are
+    applied to the eigenvectors in the blocked algorithm of STEQR. Must be at least 1.
+
+    \details A larger value means fewer synchronizations between the threads of the group, at the
+    cost of a larger workspace of size STEQR_BLOCKED_STEPS*2*n per batch instance. */
+#ifndef STEQR_BLOCKED_STEPS
+#define STEQR_BLOCKED_STEPS 16
+#endif
+
+/************************** syev/heev and syevd/heevd *************************
+*******************************************************************************/
+/*! \brief Determines the maximum size at which rocSOLVER uses the fused small-size kernel when
+    executing SYEV/HEEV or SYEVD/HEEVD. It also applies to the corresponding batched and
+    strided-batched routines.
+
+    \details For n <= SYEV_SMALL_MAX_SIZE(T), the matrix is kept in LDS while it is reduced to
+    tridiagonal form, the orthogonal/unitary matrix is generated, and the QR iteration (as in
+    STEQR or STERF) is run, all in a single kernel call. The n-by-n matrix must fit within
+    (64 * 1024) bytes of LDS.*/
+#ifndef SYEV_SMALL_MAX_SIZE
+#define SYEV_SMALL_MAX_SIZE(T) ((sizeof(T) == 16) ? 48 : 64)
+#endif
+
 /****************************** stedc ******************************************
 *******************************************************************************/
 /*! \brief Determines the minimum size required for the eigenvectors of an independent block of
@@ -224,6 +571,23 @@
 #define STEDC_NUM_SPLIT_BLKS 8
 #endif
 
+/*! \brief Determines the minimum batch size for which the solver phase of the divide & conquer
+    method (STEDC) uses a work queue.
+
+    \details Instead of assigning the sub-blocks of every split block of every matrix in the batch to
+    a fixed group, STEDC_QUEUE_GROUPS persistent groups take the sub-blocks from a global queue (with
+    atomics) as they become free, so that a large sub-block of one matrix does not delay the
+    rest of the batch. */
+#ifndef STEDC_QUEUE_MIN_BATCH
+#define STEDC_QUEUE_MIN_BATCH 2
+#endif
+
+/*! \brief Determines the number of persistent groups used by the work queue of the solver phase
+    of STEDC (see STEDC_QUEUE_MIN_BATCH). */
+#ifndef STEDC_QUEUE_GROUPS
+#define STEDC_QUEUE_GROUPS 1024
+#endif
+
 /************************** potf2/potrf ***************************************
 *******************************************************************************/
 /*! \brief Determines the size of the leading block that is factorized at each step
@@ -244,6 +608,46 @@
 #define POTRF_POTF2_SWITCHSIZE(T) POTRF_BLOCKSIZE(T)
 #endif
 
+/*! \brief Determines the size at which POTRF switches from the blocked to the recursive
+    algorithm. It also applies to the corresponding batched and strided-batched routines.
+
+    \details If n > POTRF_RECURSIVE_SWITCHSIZE, the matrix is split in two halves (of a multiple
+    of POTRF_BLOCKSIZE columns); the leading half is factorized recursively, the off-diagonal block
+    is updated with a single TRSM and the trailing half with a single SYRK/HERK before it is also
+    factorized recursively. Matrices of at most POTRF_RECURSIVE_SWITCHSIZE columns are factorized
+    with the blocked algorithm. The recursive algorithm is not used with
+    rocsolver_alg_mode_prefetch, which streams the block columns in order.*/
+#ifndef POTRF_RECURSIVE_SWITCHSIZE
+#define POTRF_RECURSIVE_SWITCHSIZE 4096
+#endif
+
+/*! \brief Determines the minimum batch size at which the blocked algorithm of POTRF is
+    left-looking. It applies to the batched and strided-batched routines.
+
+    \details The left-looking algorithm updates each block column with the former ones (with a
+    SYRK/HERK on the diagonal block and a GEMM on the panel below it) right before factorizing it,
+    instead of updating the whole trailing matrix after every block column. A batch of matrices
+    then only writes the current block column at every step.*/
+#ifndef POTRF_LEFT_LOOKING_MIN_BATCH
+#define POTRF_LEFT_LOOKING_MIN_BATCH 16
+#endif
+
+/*! \brief Determines the number of internal streams among which the batched and strided-batched
+    routines of POTRF split the batch.
+
+    \details As in GETRF_BATCH_STREAMS. If n <= POTRF_BATCH_STREAMS_INTERVALS[0], the number of
+    streams is POTRF_BATCH_STREAMS[0], and so on; a value of 1 disables the split. (These values
+    can be overridden at run time with the tuning table potrf_batch_streams). */
+#ifndef POTRF_BATCH_STREAMS_NUM_INTERVALS
+#define POTRF_BATCH_STREAMS_NUM_INTERVALS 1
+#endif
+#ifndef POTRF_BATCH_STREAMS_INTERVALS
+#define POTRF_BATCH_STREAMS_INTERVALS 256
+#endif
+#ifndef POTRF_BATCH_STREAMS
+#define POTRF_BATCH_STREAMS 1, 4
+#endif
+
 /*! \brief Determines the maximum size at which rocSOLVER can use POTF2
     \details
     POTF2 will attempt to factorize a small symmetric matrix that can fit entirely
@@ -253,18 +657,153 @@
 #define POTF2_MAX_SMALL_SIZE(T) ((sizeof(T) == 4) ? 180 : (sizeof(T) == 8) ? 127 : 90)
 #endif
 
+/*! \brief Determines the maximum size at which rocSOLVER can use the run-time compiled POTF2 kernel
+    \details
+    When the library is built with ROCSOLVER_JIT_KERNELS, real matrices with n <= POTF2_JIT_MAX_SIZE
+    are factorized by a kernel compiled for the exact n, with one thread per row and the row kept
+    in registers. */
+#ifndef POTF2_JIT_MAX_SIZE
+#define POTF2_JIT_MAX_SIZE 64
+#endif
+
+/*! \brief Determines the maximum size at which rocSOLVER can use the fused small-size kernel
+    when executing POSV. It also applies to the corresponding batched and strided-batched routines.
+
+    \details For n <= POSV_SMALL_MAX_SIZE, the Cholesky factor is computed in LDS (as in POTF2) and
+    the two triangular solves are applied to blocks of columns of B in the same kernel, without
+    reading the factor back from global memory. The packed factor and a block of B must fit within
+    (64 * 1024) bytes of LDS.*/
+#ifndef POSV_SMALL_MAX_SIZE
+#define POSV_SMALL_MAX_SIZE 64
+#endif
+
+/*! \brief Determines the width of the block columns (or block rows) that are streamed to the
+    device when executing POTRF_OOC.
+
+    \details POTRF_OOC keeps three block columns of n rows on the device: the one being
+    factorized and two that are used to update it, alternately copied from the host. Wider
+    blocks reduce the host-device traffic (which is proportional to n^3/nb) but require more
+    device memory. For n <= POTRF_OOC_INTERVALS[0] the width is POTRF_OOC_BLKSIZES[0], and
+    so on.*/
+#ifndef POTRF_OOC_NUM_INTERVALS
+#define POTRF_OOC_NUM_INTERVALS 2
+#endif
+#ifndef POTRF_OOC_INTERVALS
+#define POTRF_OOC_INTERVALS 16384, 65536
+#endif
+#ifndef POTRF_OOC_BLKSIZES
+#define POTRF_OOC_BLKSIZES 1024, 2048, 4096
+#endif
+
+/*! \brief Determines the number of columns of the Cholesky factor that are processed at a time
+    when executing POTRF_UPDATE and POTRF_DOWNDATE. It also applies to the corresponding batched
+    and strided-batched routines.
+
+    \details The rotations of a block of POTRF_UPDATE_BLOCKSIZE columns are generated by a single
+    thread block (one thread per row of the diagonal block) and are then applied to the rows below
+    by as many thread blocks as needed, with one thread per row. Must not exceed 1024. */
+#ifndef POTRF_UPDATE_BLOCKSIZE
+#define POTRF_UPDATE_BLOCKSIZE 64
+#endif
+
 /************************** syevj/heevj ***************************************
 *******************************************************************************/
 /*! \brief Determines the size at which rocSOLVER switches from
     the small-size kernel to the blocked algorithm when executing SYEVJ. It also applies to the
-    corresponding batched and strided-batched routines. Must be <= 64.
+    corresponding batched and strided-batched routines.
 
     \details If the size of the matrix is not greater than SYEVJ_BLOCKED_SWITCH, the eigenvalues
-    and eigenvectors will be computed with a single kernel call. */
+    and eigenvectors will be computed with a single kernel call (see also
+    SYEVJ_LDS_BLOCKED_SWITCH). */
 #ifndef SYEVJ_BLOCKED_SWITCH
 #define SYEVJ_BLOCKED_SWITCH 58
 #endif
 
+/*! \brief Determines the largest size for which SYEVJ can still use the small-size kernel when
+    the working copy of the matrix fits in the LDS shared memory. It also applies to the
+    corresponding batched and strided-batched routines. Must be >= SYEVJ_BLOCKED_SWITCH.
+
+    \details For SYEVJ_BLOCKED_SWITCH < n <= SYEVJ_LDS_BLOCKED_SWITCH, the small-size kernel is
+    used if the n-by-n copy of the matrix, together with the other shared arrays of the kernel,
+    fits within (64 * 1024) bytes of LDS; otherwise the blocked algorithm is used. (With
+    double precision, this covers matrices up to n = 90.) */
+#ifndef SYEVJ_LDS_BLOCKED_SWITCH
+#define SYEVJ_LDS_BLOCKED_SWITCH 128
+#endif
+
+/*! \brief Determines the size at which rocSOLVER switches from the blocked algorithm with
+    element-wise rotations to the block Jacobi algorithm when executing SYEVJ. It also applies to
+    the corresponding batched and strided-batched routines.
+
+    \details For n > SYEVJ_GEMM_SWITCH, each pair of block rows/columns of size
+    SYEVJ_GEMM_BLOCKSIZE is diagonalized with the small-size kernel, and the resulting orthogonal
+    block rotations are applied to the matrix and the eigenvectors with matrix-matrix products. */
+#ifndef SYEVJ_GEMM_SWITCH
+#define SYEVJ_GEMM_SWITCH 1024
+#endif
+
+/*! \brief Determines the size of the blocks used by the block Jacobi algorithm of SYEVJ (see
+    SYEVJ_GEMM_SWITCH).
+
+    \details The block rotations are of size 2 * SYEVJ_GEMM_BLOCKSIZE, which is also the inner
+    dimension of the matrix-matrix products. The pair subproblems are solved in LDS whenever they
+    fit (for double precision, up to SYEVJ_GEMM_BLOCKSIZE = 45). */
+#ifndef SYEVJ_GEMM_BLOCKSIZE
+#define SYEVJ_GEMM_BLOCKSIZE 32
+#endif
+
+/*! \brief Determines how often (in number of sweeps) the blocked algorithm of SYEVJ checks on
+    the host whether all the problems in the batch have converged, by default.
+
+    \details Every SYEVJ_SWEEPS_PER_SYNC sweeps, the blocked algorithm copies the number of converged
+    problems back to the host and synchronizes the stream so that it can exit the sweep loop early.
+    The kernels of the sweep loop return early for converged problems, so no host check is needed
+    for correctness. A value of 0 disables the host check, so that max_sweeps sweeps are always
+    enqueued without any synchronization. When the stream is being captured into a HIP graph, the
+    host check is always skipped. */
+#ifndef SYEVJ_SWEEPS_PER_SYNC
+#define SYEVJ_SWEEPS_PER_SYNC 1
+#endif
+
+/*! \brief Determines the number of sweeps between the host checks of SYEVJ (see
+    SYEVJ_SWEEPS_PER_SYNC) depending on the batch size.
+
+    \details If batch_count <= SYEVJ_SYNC_INTERVALS[0], the host checks every SYEVJ_SYNC_SWEEPS[0]
+    sweeps, and so on; a value of 0 disables the host check. (These values can be overridden at run
+    time with the tuning table syevj_sync, e.g. to disable the host check for large batches of
+    small problems.) */
+#ifndef SYEVJ_SYNC_NUM_INTERVALS
+#define SYEVJ_SYNC_NUM_INTERVALS 1
+#endif
+#ifndef SYEVJ_SYNC_INTERVALS
+#define SYEVJ_SYNC_INTERVALS 1
+#endif
+#ifndef SYEVJ_SYNC_SWEEPS
+#define SYEVJ_SYNC_SWEEPS SYEVJ_SWEEPS_PER_SYNC, SYEVJ_SWEEPS_PER_SYNC
+#endif
+
+/*! \brief Determines the tolerance, in multiples of the single precision machine epsilon, at which
+    the mixed-precision algorithm of SYEVJ stops the single precision sweeps (see
+    rocsolver_alg_mode_mixed). It also applies to the corresponding batched and strided-batched
+    routines.
+
+    \details The double precision sweeps then start from a matrix whose off-diagonal part is
+    about SYEVJ_MIXED_TOL_FACTOR * FLT_EPSILON times its norm, so that only one or two of them
+    are needed to converge. */
+#ifndef SYEVJ_MIXED_TOL_FACTOR
+#define SYEVJ_MIXED_TOL_FACTOR 8
+#endif
+
+/*! \brief Determines the number of iterations used by the mixed-precision algorithm of SYEVJ to
+    orthogonalize, in double precision, the eigenvectors obtained in single precision. It also
+    applies to the corresponding batched and strided-batched routines.
+
+    \details Each (Newton-Schulz) iteration costs two matrix products and roughly squares the
+    loss of orthogonality, which is about n * FLT_EPSILON after the single precision sweeps. */
+#ifndef SYEVJ_MIXED_ORTH_ITERS
+#define SYEVJ_MIXED_ORTH_ITERS 2
+#endif
+
 /*************************** sytf2/sytrf **************************************
 *******************************************************************************/
 /*! \brief Determines the maximum size of the partial factorization executed at each step
@@ -295,6 +834,87 @@
 #define SYEVDJ_MIN_DC_SIZE 16
 #endif
 
+/****************************** syev_auto ***************************************
+*******************************************************************************/
+/*! \brief Determines the eigensolver executed by SYEV_AUTO/HEEV_AUTO (and SYGV_AUTO/HEGV_AUTO)
+    when the eigenvectors are required. It also applies to the corresponding batched and
+    strided-batched routines.
+
+    \details If n <= SYEV_AUTO_INTERVALS[0], the eigensolver is SYEV_AUTO_DRIVERS[0], and so on.
+    The eigensolvers are given by the values 0 (SYEV/HEEV, QR iteration), 1 (SYEVD/HEEVD,
+    divide and conquer), 2 (SYEVDJ/HEEVDJ, Jacobi divide and conquer) and 3 (SYEVJ/HEEVJ, Jacobi).
+    The tables SYEV_AUTO_BATCH_* apply instead when batch_count >= SYEV_AUTO_MIN_BATCH.
+    (These values can be overridden at run time with the tuning tables syev_auto_real,
+    syev_auto_batch_real and the corresponding _complex tables). */
+#ifndef SYEV_AUTO_NUM_INTERVALS_REAL
+#define SYEV_AUTO_NUM_INTERVALS_REAL 1
+#endif
+#ifndef SYEV_AUTO_INTERVALS_REAL
+#define SYEV_AUTO_INTERVALS_REAL 64
+#endif
+#ifndef SYEV_AUTO_DRIVERS_REAL
+#define SYEV_AUTO_DRIVERS_REAL 0, 1
+#endif
+
+#ifndef SYEV_AUTO_NUM_INTERVALS_COMPLEX
+#define SYEV_AUTO_NUM_INTERVALS_COMPLEX 1
+#endif
+#ifndef SYEV_AUTO_INTERVALS_COMPLEX
+#define SYEV_AUTO_INTERVALS_COMPLEX 48
+#endif
+#ifndef SYEV_AUTO_DRIVERS_COMPLEX
+#define SYEV_AUTO_DRIVERS_COMPLEX 0, 1
+#endif
+
+#ifndef SYEV_AUTO_BATCH_NUM_INTERVALS_REAL
+#define SYEV_AUTO_BATCH_NUM_INTERVALS_REAL 2
+#endif
+#ifndef SYEV_AUTO_BATCH_INTERVALS_REAL
+#define SYEV_AUTO_BATCH_INTERVALS_REAL 32, 64
+#endif
+#ifndef SYEV_AUTO_BATCH_DRIVERS_REAL
+#define SYEV_AUTO_BATCH_DRIVERS_REAL 3, 0, 1
+#endif
+
+#ifndef SYEV_AUTO_BATCH_NUM_INTERVALS_COMPLEX
+#define SYEV_AUTO_BATCH_NUM_INTERVALS_COMPLEX 2
+#endif
+#ifndef SYEV_AUTO_BATCH_INTERVALS_COMPLEX
+#define SYEV_AUTO_BATCH_INTERVALS_COMPLEX 24, 48
+#endif
+#ifndef SYEV_AUTO_BATCH_DRIVERS_COMPLEX
+#define SYEV_AUTO_BATCH_DRIVERS_COMPLEX 3, 0, 1
+#endif
+
+/*! \brief Determines the eigensolver executed by SYEV_AUTO/HEEV_AUTO (and SYGV_AUTO/HEGV_AUTO)
+    when only the eigenvalues are required.
+
+    \details As in SYEV_AUTO_DRIVERS. Without eigenvectors, SYEV/HEEV and SYEVD/HEEVD
+    execute the same algorithm (STERF). (These values can be overridden at run time with the
+    tuning table syev_auto_novect). */
+#ifndef SYEV_AUTO_NOVECT_NUM_INTERVALS
+#define SYEV_AUTO_NOVECT_NUM_INTERVALS 1
+#endif
+#ifndef SYEV_AUTO_NOVECT_INTERVALS
+#define SYEV_AUTO_NOVECT_INTERVALS 1
+#endif
+#ifndef SYEV_AUTO_NOVECT_DRIVERS
+#define SYEV_AUTO_NOVECT_DRIVERS 0, 0
+#endif
+
+/*! \brief Determines the minimum batch count for which SYEV_AUTO/HEEV_AUTO (and
+    SYGV_AUTO/HEGV_AUTO) select the eigensolver with the tables SYEV_AUTO_BATCH_*. */
+#ifndef SYEV_AUTO_MIN_BATCH
+#define SYEV_AUTO_MIN_BATCH 8
+#endif
+
+/*! \brief Determines the maximum number of sweeps executed by SYEV_AUTO/HEEV_AUTO (and
+    SYGV_AUTO/HEGV_AUTO) when the Jacobi eigensolver is selected. The Jacobi eigensolver uses the
+    default tolerance, so that its results are as accurate as those of the other eigensolvers. */
+#ifndef SYEV_AUTO_MAX_SWEEPS
+#define SYEV_AUTO_MAX_SWEEPS 100
+#endif
+
 /****************************** syevdx ******************************************
 *******************************************************************************/
 /*! \brief Determines the minimum size required for the Bisection divide and conquer to be used.
@@ -305,6 +925,72 @@
 #define SYEVDX_MIN_DC_SIZE 16
 #endif
 
+/*! \brief Determines the minimum size for which SYEVX/HEEVX and SYEVDX/HEEVDX read back the number
+    of computed eigenvalues before the back-transformation of the eigenvectors, when erange = value.
+    It also applies to the corresponding batched and strided-batched routines, and to GESVDX with
+    srange = value (with min(m,n) in place of the matrix size).
+
+    \details The unitary matrix of the tridiagonal reduction is then applied only to the first
+    max(nev) columns of Z (the maximum over the batch), instead of to all n columns, at the cost of
+    a synchronization with the host. The read back is skipped while the stream is being captured
+    into a HIP graph. */
+#ifndef SYEVX_READ_NEV_MIN_SIZE
+#define SYEVX_READ_NEV_MIN_SIZE 512
+#endif
+
+/*! \brief Determines when SYEVX/HEEVX (and SYGVX/HEGVX) apply the back-transformation of the
+    eigenvectors over the compacted list of (problem, vector) pairs, when the number of computed
+    eigenvalues has been read back (see SYEVX_READ_NEV_MIN_SIZE).
+
+    \details The compacted list holds only the sum(nev) eigenvectors that were actually found over
+    the batch. It is used when sum(nev) * SYEVX_COMPACT_RATIO <= batch_count * max(nev), i.e. when
+    the padded blocked update would waste most of its work. Each eigenvector is then updated with
+    one Householder reflector at a time, which is slower per vector than the blocked update of
+    ORMTR/UNMTR. */
+#ifndef SYEVX_COMPACT_RATIO
+#define SYEVX_COMPACT_RATIO 4
+#endif
+
+/****************************** syevs/heevs *************************************
+*******************************************************************************/
+/*! \brief Determines the degree of the Chebyshev polynomial used by SYEVS/HEEVS to filter the
+    subspace at every iteration.
+
+    \details Each iteration costs SYEVS_FILTER_DEGREE products of A with the n-by-k subspace.
+    Higher degrees dampen the unwanted part of the spectrum faster, so that fewer (host
+    synchronized) iterations are needed. */
+#ifndef SYEVS_FILTER_DEGREE
+#define SYEVS_FILTER_DEGREE 10
+#endif
+
+/*! \brief Determines the number of Lanczos steps used by SYEVS/HEEVS to estimate an upper bound
+    of the spectrum of A. */
+#ifndef SYEVS_LANCZOS_STEPS
+#define SYEVS_LANCZOS_STEPS 10
+#endif
+
+/****************************** bdsvdx ******************************************
+*******************************************************************************/
+/*! \brief Determines the minimum size required for the Bisection divide and conquer to be used in
+    BDSVDX (and GESVDX).
+
+    \details If the bidiagonal matrix is smaller than BDSVDX_MIN_DC_SIZE, the singular vectors are
+    always computed with the normal inverse iteration algorithm. */
+#ifndef BDSVDX_MIN_DC_SIZE
+#define BDSVDX_MIN_DC_SIZE 16
+#endif
+
+/*! \brief Determines the fraction of the singular values above which BDSVDX (and GESVDX) use the
+    Bisection divide and conquer.
+
+    \details If the singular vectors are required and the number of requested singular values nsv
+    satisfies nsv * BDSVDX_DC_DIVISOR > n, the eigenpairs of the Golub-Kahan tridiagonal matrix are
+    computed with STEDCX instead of STEBZ and STEIN. (When srange = value, nsv is not known
+    beforehand and inverse iteration is always used). */
+#ifndef BDSVDX_DC_DIVISOR
+#define BDSVDX_DC_DIVISOR 10
+#endif
+
 /**************************** getf2/getfr *************************************
 *******************************************************************************/
 #ifndef GETF2_SPKER_MAX_M
@@ -319,6 +1005,21 @@
 #ifndef GETF2_SSKER_MAX_N
 #define GETF2_SSKER_MAX_N 64 //always <= wavefront and <= GETF2_SPKER_MAX_N
 #endif
+
+/*! \brief Determines the maximum number of rows of the panels that GETF2 factorizes with the
+    cooperative panel kernel. It also applies to the corresponding batched and strided-batched
+    routines.
+
+    \details Panels with more than GETF2_SPKER_MAX_M rows (and no more than GETF2_SPKER_MAX_N
+    columns) are distributed over several workgroups of GETF2_COOP_THDS threads, that find each
+    pivot with a global reduction. When all the workgroups cannot be resident at the same time,
+    GETF2 falls back to the normal code. */
+#ifndef GETF2_COOP_MAX_M
+#define GETF2_COOP_MAX_M 32768
+#endif
+#ifndef GETF2_COOP_THDS
+#define GETF2_COOP_THDS 256 //always a power of 2 and <= 1024
+#endif
 #ifndef GETF2_OPTIM_NGRP
 #define GETF2_OPTIM_NGRP \
     16, 15, 8, 8, 8, 8, 8, 8, 6, 6, 4, 4, 4, 4, 4, 4, 3, 3, 3, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2
@@ -397,6 +1098,208 @@
 #define GETRF_NPVT_BATCH_BLKSIZES_COMPLEX 0, -16, -32, -48, 64, 128
 #endif
 
+/*! \brief Determines the range of sizes for which the blocked algorithm of GETRF (with partial
+    pivoting) uses look-ahead. It only applies to the non-batched routines.
+
+    \details With look-ahead, the columns of the next block panel are updated first, and the panel
+    is factorized on a second stream while the rest of the trailing matrix is updated. Look-ahead is
+    used when GETRF_LOOKAHEAD_MIN_SIZE <= min(m,n) <= GETRF_LOOKAHEAD_MAX_SIZE; setting
+    GETRF_LOOKAHEAD_MAX_SIZE to 0 disables it. */
+#ifndef GETRF_LOOKAHEAD_MIN_SIZE
+#define GETRF_LOOKAHEAD_MIN_SIZE 1024
+#endif
+#ifndef GETRF_LOOKAHEAD_MAX_SIZE
+#define GETRF_LOOKAHEAD_MAX_SIZE 8192
+#endif
+
+/*! \brief Determines the number of internal streams among which the batched and strided-batched
+    routines of GETRF split the batch.
+
+    \details The batch is split in contiguous sub-batches that are factorized concurrently on
+    different streams, so that the panel factorizations of some sub-batches overlap the trailing
+    matrix updates of the others. If min(m,n) <= GETRF_BATCH_STREAMS_INTERVALS[0], the number of
+    streams is GETRF_BATCH_STREAMS[0], and so on; a value of 1 disables the split. (These values
+    can be overridden at run time with the tuning table getrf_batch_streams). */
+#ifndef GETRF_BATCH_STREAMS_NUM_INTERVALS
+#define GETRF_BATCH_STREAMS_NUM_INTERVALS 1
+#endif
+#ifndef GETRF_BATCH_STREAMS_INTERVALS
+#define GETRF_BATCH_STREAMS_INTERVALS 256
+#endif
+#ifndef GETRF_BATCH_STREAMS
+#define GETRF_BATCH_STREAMS 1, 4
+#endif
+
+/*! \brief Determines the minimum number of problems of each sub-batch when a batched routine
+    splits the batch among internal streams (see GETRF_BATCH_STREAMS and POTRF_BATCH_STREAMS). */
+#ifndef BATCH_STREAMS_MIN_COUNT
+#define BATCH_STREAMS_MIN_COUNT 8
+#endif
+
+/*! \brief Determines the minimum number of rows of a block panel for GETRF (with partial pivoting)
+    to factorize it with the recursive algorithm. It also applies to the corresponding batched and
+    strided-batched routines.
+
+    \details Tall block panels (that do not fit in the specialized GETF2 kernels) are split in two
+    halves of columns, that are factorized recursively; the right half is updated with TRSM and GEMM
+    in between. Panels with no more than GETRF_RECURSIVE_LEAF_SIZE columns are factorized with
+    GETF2. */
+#ifndef GETRF_RECURSIVE_MIN_ROWS
+#define GETRF_RECURSIVE_MIN_ROWS GETF2_SPKER_MAX_M
+#endif
+
+/*! \brief Determines the maximum number of columns of the leaf panels in the recursive
+    factorization of tall block panels in GETRF (see GETRF_RECURSIVE_MIN_ROWS). */
+#ifndef GETRF_RECURSIVE_LEAF_SIZE
+#define GETRF_RECURSIVE_LEAF_SIZE 16
+#endif
+
+/*! \brief Determines the minimum number of rows of the leaf panels in the recursive factorization
+    of tall block panels in GETRF (see GETRF_RECURSIVE_MIN_ROWS) to select their pivots by
+    tournament, when rocsolver_alg_mode_tournament is set for the function.
+
+    \details The rows of the leaf panel are split in tiles of GETRF_TOURNAMENT_TILE rows. Every
+    tile selects as many candidate rows as columns with a local LU factorization with partial
+    pivoting, and the candidates are then reduced in rounds, merging the candidates of up to
+    GETRF_TOURNAMENT_TILE / GETRF_RECURSIVE_LEAF_SIZE tiles at a time, until only the pivot rows
+    remain. The leaf panel is then factorized without further pivoting. Shorter leaf panels are
+    factorized with GETF2. */
+#ifndef GETRF_TOURNAMENT_MIN_ROWS
+#define GETRF_TOURNAMENT_MIN_ROWS GETRF_RECURSIVE_MIN_ROWS
+#endif
+
+/*! \brief Determines the number of rows of the tiles in the tournament pivoting of GETRF (see
+    GETRF_TOURNAMENT_MIN_ROWS). It is also the size of the thread-blocks of the tournament
+    kernels. */
+#ifndef GETRF_TOURNAMENT_TILE
+#define GETRF_TOURNAMENT_TILE 128 //always a power of 2, >= 2*GETRF_RECURSIVE_LEAF_SIZE and <= 1024
+#endif
+
+/******************************** laswp ****************************************
+*******************************************************************************/
+/*! \brief Determines the minimum number of row interchanges for LASWP to apply them by tiles.
+    It also applies to the row interchanges in GETRF and GETRS, and the corresponding batched and
+    strided-batched routines.
+
+    \details If at least LASWP_TILED_MIN_PIVOTS interchanges are applied to a matrix with unit row
+    increment, the columns are processed in tiles of LASWP_TILE_COLS columns. The rows k1 to k2 of
+    each tile are loaded into shared memory LASWP_TILE_ROWS rows at a time, with coalesced accesses,
+    and the interchanges are applied there; only the rows they are exchanged with are accessed
+    in global memory. Otherwise, every thread applies all the interchanges to one column in global
+    memory. */
+#ifndef LASWP_TILED_MIN_PIVOTS
+#define LASWP_TILED_MIN_PIVOTS 64
+#endif
+
+/*! \brief Determines the number of columns of the tiles used by LASWP (see
+    LASWP_TILED_MIN_PIVOTS). It is also the size of the thread-blocks of the tiled kernel. */
+#ifndef LASWP_TILE_COLS
+#define LASWP_TILE_COLS 64
+#endif
+
+/*! \brief Determines the number of rows of the tiles used by LASWP (see LASWP_TILED_MIN_PIVOTS). */
+#ifndef LASWP_TILE_ROWS
+#define LASWP_TILE_ROWS 32
+#endif
+
+/******************************** gesv *****************************************
+*******************************************************************************/
+/*! \brief Determines the size at which GESV switches to a single fused kernel. It also applies
+    to the corresponding batched and strided-batched routines.
+
+    \details If n <= GESV_SMALL_MAX_SIZE, the LU factorization, the row interchanges and the
+    triangular solves are computed by a single kernel that keeps every row of A in registers
+    (one thread per row). */
+#ifndef GESV_SMALL_MAX_SIZE
+#define GESV_SMALL_MAX_SIZE 32 //always <= 32 (size of GETF2_OPTIM_NGRP)
+#endif
+
+/******************************** getrs ****************************************
+*******************************************************************************/
+/*! \brief Determines the size at which GETRS switches to a single fused kernel. It also applies
+    to the corresponding batched and strided-batched routines.
+
+    \details If n <= GETRS_SMALL_MAX_SIZE and nrhs <= GETRS_SMALL_MAX_NRHS, the row interchanges
+    and the triangular solves are computed by a single kernel that keeps every row of the factors
+    in registers (one thread per row), instead of LASWP and two TRSMs. */
+#ifndef GETRS_SMALL_MAX_SIZE
+#define GETRS_SMALL_MAX_SIZE 64 //always <= 64 and <= GETRS_SMALL_MAX_THDS
+#endif
+#ifndef GETRS_SMALL_MAX_NRHS
+#define GETRS_SMALL_MAX_NRHS 64
+#endif
+
+/*! \brief Determines the maximum number of threads per thread block, and the number of columns
+    of the right-hand sides that every thread keeps in registers, in the fused GETRS kernel (see
+    GETRS_SMALL_MAX_SIZE). */
+#ifndef GETRS_SMALL_MAX_THDS
+#define GETRS_SMALL_MAX_THDS 256
+#endif
+#ifndef GETRS_SMALL_NB
+#define GETRS_SMALL_NB 8
+#endif
+
+/*************************** gels_outofplace **********************************
+*******************************************************************************/
+/*! \brief Determines the maximum number of right-hand sides and the maximum size for which
+    GELS_OUTOFPLACE solves the factorized problem with a single fused kernel. It also applies to
+    the corresponding batched and strided-batched routines.
+
+    \details If nrhs <= GELS_FUSED_MAX_NRHS and max(m,n) <= GELS_FUSED_MAX_SIZE, each column of B
+    is read once into LDS, where the orthogonal transformations of the QR or LQ factorization
+    and the triangular solve are applied, and the result is written to X. B is never modified,
+    so it does not need to be saved and restored, and the intermediate copies and zero-fill
+    passes of the general algorithm are avoided. */
+#ifndef GELS_FUSED_MAX_NRHS
+#define GELS_FUSED_MAX_NRHS 64
+#endif
+#ifndef GELS_FUSED_MAX_SIZE
+#define GELS_FUSED_MAX_SIZE 256
+#endif
+
+/*************************** dsgesv/zcgesv ************************************
+*******************************************************************************/
+/*! \brief Determines the maximum number of iterative refinement steps performed by the
+    mixed-precision solvers DSGESV and ZCGESV. It also applies to the corresponding batched and
+    strided-batched routines.
+
+    \details If the solution of a system has not converged after GESV_MIXED_MAX_ITERS steps, the
+    system is solved again using a full precision factorization (as ITERMAX in LAPACK). */
+#ifndef GESV_MIXED_MAX_ITERS
+#define GESV_MIXED_MAX_ITERS 30
+#endif
+
+/********************** half and bfloat16 storage *****************************
+*******************************************************************************/
+/*! \brief Determines the size at which the half and bfloat16 versions of GETRF, GETRF_NPVT,
+    GETRS and POTRF switch to a single kernel per problem.
+
+    \details If m and n are <= LOWPREC_MAX_SMALL_SIZE, each matrix is read once into LDS, converted
+    to single precision, processed there and written back with the storage precision, so that no
+    workspace is needed. Otherwise, the matrices are converted to a single precision workspace and
+    the float routines are called. */
+#ifndef LOWPREC_MAX_SMALL_SIZE
+#define LOWPREC_MAX_SMALL_SIZE 64 //always <= 64 (the matrices are kept in LDS)
+#endif
+
+/************************* variable-size batches *****************************
+*******************************************************************************/
+/*! \brief Determines the size bins of the variable-size batched routines GETRF_VBATCHED,
+    POTRF_VBATCHED, GEQRF_VBATCHED, GETRS_VBATCHED and POTRS_VBATCHED.
+
+    \details The sizes of the problems are only known on the device, so one kernel is launched per
+    bin, and each thread block only processes its problem of the batch if it falls into that bin
+    (the other blocks return immediately). The bins are [1, VBATCHED_MIN_BIN], (VBATCHED_MIN_BIN,
+    2*VBATCHED_MIN_BIN], ..., (VBATCHED_MAX_BIN/2, inf), and the kernel of each bin is launched
+    with as many threads per block as the upper bound of the bin (VBATCHED_MAX_BIN for the last
+    one). */
+#ifndef VBATCHED_MIN_BIN
+#define VBATCHED_MIN_BIN 32
+#endif
+#ifndef VBATCHED_MAX_BIN
+#define VBATCHED_MAX_BIN 512 //always <= 1024
+#endif
+
 /****************************** getri *****************************************
 *******************************************************************************/
 #ifndef GETRI_MAX_COLS
@@ -427,6 +1330,66 @@
 #define GETRI_BATCH_BLKSIZES 32, 0, 256
 #endif
 
+/*! \brief Determines the size at which the batched and strided-batched GETRI stop using the
+    specialized kernel for medium-size matrices.
+
+    \details Matrices with GETRI_MAX_COLS < n <= GETRI_BATCH_MEDIUM_SIZE are inverted by a single
+    kernel launch that uses one group of n threads per matrix, instead of the blocked TRTRI and
+    TRSM/GEMM updates. */
+#ifndef GETRI_BATCH_MEDIUM_SIZE
+#define GETRI_BATCH_MEDIUM_SIZE 256 //always <= 1024
+#endif
+
+/*! \brief Determines the sizes for which the batched and strided-batched GETRI, GETRI_NPVT and
+    TRTRI use the blocked Gauss-Jordan kernel, and the width of its panels.
+
+    \details The blocked Gauss-Jordan kernel inverts each matrix of the batch in a single launch,
+    with one group of n threads per matrix and panels of nb columns kept in LDS. It is used for the
+    sizes in the intervals whose block size (panel width) is not zero; the block sizes are reduced
+    to GETRI_BATCH_GJ_MAX_BLKSIZE (and, for the larger sizes, as needed to fit the panels in the
+    LDS shared memory). The tables can be overridden at run time with the tuning tables
+    getri_batch_gj and trtri_batch_gj; in any case, the kernel is only used when
+    n <= GETRI_BATCH_GJ_MAX_SIZE. For GETRI, the kernel takes precedence over the medium-size
+    kernel (GETRI_BATCH_MEDIUM_SIZE) in the intervals where it is used. */
+#ifndef GETRI_BATCH_GJ_MAX_SIZE
+#define GETRI_BATCH_GJ_MAX_SIZE 512 //always <= 1024
+#endif
+#ifndef GETRI_BATCH_GJ_MAX_BLKSIZE
+#define GETRI_BATCH_GJ_MAX_BLKSIZE 16
+#endif
+#ifndef GETRI_BATCH_GJ_NUM_INTERVALS
+#define GETRI_BATCH_GJ_NUM_INTERVALS 2
+#endif
+#ifndef GETRI_BATCH_GJ_INTERVALS
+#define GETRI_BATCH_GJ_INTERVALS GETRI_BATCH_MEDIUM_SIZE, 512
+#endif
+#ifndef GETRI_BATCH_GJ_BLKSIZES
+#define GETRI_BATCH_GJ_BLKSIZES 0, 16, 0
+#endif
+#ifndef TRTRI_BATCH_GJ_NUM_INTERVALS
+#define TRTRI_BATCH_GJ_NUM_INTERVALS 2
+#endif
+#ifndef TRTRI_BATCH_GJ_INTERVALS
+#define TRTRI_BATCH_GJ_INTERVALS 64, 512
+#endif
+#ifndef TRTRI_BATCH_GJ_BLKSIZES
+#define TRTRI_BATCH_GJ_BLKSIZES 0, 16, 0
+#endif
+
+/***************************** trsm *******************************************
+*******************************************************************************/
+/*! \brief Determines the size at which the internal TRSM of GETRS and POTRS inverts the diagonal
+    blocks of the triangular factors.
+
+    \details When the number of right-hand sides is at least n > TRSM_INVDIAG_MIN_SIZE, the
+    diagonal blocks of TRTRI_MAX_COLS columns are inverted once by TRTI2, and every block of the
+    solution is computed with GEMM instead of the substitution kernels. This only applies to the
+    sizes that are solved by the substitution kernels (larger sizes are handled by rocBLAS TRSM,
+    which already works with inverted diagonal blocks). */
+#ifndef TRSM_INVDIAG_MIN_SIZE
+#define TRSM_INVDIAG_MIN_SIZE 64
+#endif
+
 /***************************** trtri ******************************************
 *******************************************************************************/
 #ifndef TRTRI_MAX_COLS
@@ -451,11 +1414,141 @@
 #define TRTRI_BATCH_BLKSIZES 0, 16, 32, 0
 #endif
 
-/************************** splitlu ***************************************
+/*! \brief Determines the size at which TRTRI switches to the recursive algorithm.
+
+    \details When n > TRTRI_RECURSIVE_SWITCHSIZE, TRTRI splits the matrix in halves, inverts the
+    diagonal blocks recursively and updates the off-diagonal block with two TRMMs. The recursion
+    stops at blocks of at most TRTRI_MAX_COLS columns, which are inverted by TRTI2. */
+#ifndef TRTRI_RECURSIVE_SWITCHSIZE
+#define TRTRI_RECURSIVE_SWITCHSIZE 2048
+#endif
+
+/***************************** lauum ******************************************
 *******************************************************************************/
-/*! \brief Determines the size at which rocSOLVER switches from
-    the kernel using a single thread block or using faster algorithm using rocPRIM */
+/*! \brief Determines the size at which LAUUM (and the product step of POTRI) switches to the
+    recursive algorithm.
+
+    \details When n > LAUUM_RECURSIVE_SWITCHSIZE, the product U*U' or L'*L is computed by
+    splitting the matrix in halves, with a HERK and a TRMM updating the off-diagonal and leading
+    blocks. The diagonal blocks of at most LAUUM_RECURSIVE_SWITCHSIZE columns are computed with a
+    single TRMM on a copy of the factor. */
+#ifndef LAUUM_RECURSIVE_SWITCHSIZE
+#define LAUUM_RECURSIVE_SWITCHSIZE 512
+#endif
+
+/************************** refactlu ***************************************
+*******************************************************************************/
+/*! \brief Determines the maximum number of columns of a supernode in the supernodal
+    re-factorizations of CSRRF_REFACTLU and CSRRF_REFACTCHOL.
+
+    \details Larger supernodes are split. In CSRRF_REFACTLU, the diagonal block of every
+    supernode is factorized by a single thread block. */
+
+#ifndef RF_SUPERNODE_MAX_WIDTH
+#define RF_SUPERNODE_MAX_WIDTH 128
+#endif
+
+/************************** csrrf_solve ***************************************
+*******************************************************************************/
+/*! \brief Determines the maximum number of iterative refinement steps of CSRRF_SOLVE in the
+    mixed-precision mode.
+
+    \details If the solutions have not converged after RF_REFINE_MAX_ITERS steps, the refined
+    solutions are returned as they are. */
+
+#ifndef RF_REFINE_MAX_ITERS
+#define RF_REFINE_MAX_ITERS 10
+#endif
+
+/************************** geblttrf/geblttrs *********************************
+*******************************************************************************/
+/*! \brief Determines the maximum block size for which GEBLTTRF_NPVT and GEBLTTRS_NPVT process
+    the whole chain of blocks with a single kernel launch.
+
+    \details When nb <= GEBLTTR_FUSED_MAX_NB, every batch instance is handled by one thread block
+    that keeps the current diagonal block in LDS and runs the block recurrence from the first to
+    the last block row, instead of launching GETRS, GEMM and GETRF for every block row. It must be
+    at most 32, as the factorization uses nb*nb threads. */
+#ifndef GEBLTTR_FUSED_MAX_NB
+#define GEBLTTR_FUSED_MAX_NB 32 //always <= 32
+#endif
+
+/*! \brief Determines the maximum block size for which GEBLTTRF_NPVT_INTERLEAVED_BATCHED
+    factorizes one batch instance per thread.
+
+    \details When nb <= GEBLTTRF_INTERLEAVED_MAX_NB, a single kernel runs the whole block
+    recurrence of every batch instance in one thread, working directly in global memory, so that
+    the accesses of a wavefront to the interleaved blocks are coalesced. */
+#ifndef GEBLTTRF_INTERLEAVED_MAX_NB
+#define GEBLTTRF_INTERLEAVED_MAX_NB 16
+#endif
+
+/******************************* gemm *****************************************
+*******************************************************************************/
+/*! \brief Determines the maximum size of the batched GEMMs computed with the internal
+    small-GEMM kernel.
+
+    \details When batch_count > 1 and m, n and k are all at most GEMM_SMALL_MAX_SIZE, the GEMMs
+    of the batched factorizations (e.g. the trailing updates in GETRF, POTRF and LARFB) are
+    computed by a register-tiled kernel with one thread block per tile of C and batch instance,
+    instead of the batched GEMM of rocBLAS, whose launch overhead dominates for these sizes. */
+#ifndef GEMM_SMALL_MAX_SIZE
+#define GEMM_SMALL_MAX_SIZE 256
+#endif
+
+/*! \brief Determines the complex GEMMs computed with the 3M method when it is selected with
+    rocsolver_set_gemm_mode.
+
+    \details A complex GEMM is computed with three real GEMMs on the split real and imaginary
+    parts of the matrices when m and n are at least GEMM_3M_MIN_SIZE and k is at least
+    GEMM_3M_MIN_K. For smaller GEMMs, splitting the matrices and combining the products costs
+    more than the saved multiplications. */
+#ifndef GEMM_3M_MIN_SIZE
+#define GEMM_3M_MIN_SIZE 1024
+#endif
+#ifndef GEMM_3M_MIN_K
+#define GEMM_3M_MIN_K 64
+#endif
+
+/******************************* hipBLASLt ************************************
+*******************************************************************************/
+/*! \brief Determines the GEMMs computed with hipBLASLt when the library is built with
+    BUILD_WITH_HIPBLASLT.
+
+    \details A non-batched or strided_batched real GEMM is computed with hipBLASLt when
+    k <= HIPBLASLT_GEMM_MAX_K and max(m, n) >= HIPBLASLT_GEMM_MIN_RATIO * k, i.e. for the skinny
+    updates of the trailing matrix after a panel factorization (see rocsolver_hipblaslt.hpp). */
+#ifndef HIPBLASLT_GEMM_MAX_K
+#define HIPBLASLT_GEMM_MAX_K 512
+#endif
+#ifndef HIPBLASLT_GEMM_MIN_RATIO
+#define HIPBLASLT_GEMM_MIN_RATIO 4
+#endif
+
+/******************************* megakernels **********************************
+*******************************************************************************/
+/*! \brief Determines the batched factorizations computed with a single megakernel launch.
+
+    \details When batch_count >= MEGAKERNEL_MIN_BATCH and m, n <= MEGAKERNEL_MAX_N, the batched
+    and strided_batched versions of GETRF, POTRF and GEQRF (when GEQR2 does not already use its
+    small-size kernel) factorize each matrix with one thread block that runs the whole blocked
+    algorithm in global memory, so that the sequence of panel, TRSM and GEMM launches per block
+    column is avoided. (MEGAKERNEL_MAX_N must not exceed 512, as the GEQRF megakernel keeps the
+    current Householder vector in LDS) */
+#ifndef MEGAKERNEL_MAX_N
+#define MEGAKERNEL_MAX_N 512
+#endif
+#ifndef MEGAKERNEL_MIN_BATCH
+#define MEGAKERNEL_MIN_BATCH 256
+#endif
+
+/*************************** memory primitives ********************************
+*******************************************************************************/
+/*! \brief Determines the maximum number of thread-blocks per matrix, in each of the row and
+    column directions, launched by the memory primitives (see lib_memory_primitives.hpp).
 
-#ifndef SPLITLU_SWITCH_SIZE
-#define SPLITLU_SWITCH_SIZE 64
+    \details Larger matrices are covered with grid-stride loops, so that every thread copies or
+    initializes several 128-bit chunks of the matrix instead of launching one thread per entry. */
+#ifndef MEMPRIM_MAX_BLOCKS
+#define MEMPRIM_MAX_BLOCKS 64
 #endif
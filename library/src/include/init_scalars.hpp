@@ -1,42 +1,37 @@
 /* ************************************************************************
- * Copyright (C) 2020-2024 Advanced Micro Devices, Inc.
+ * Copyright (C) 2020-2025 Advanced Micro Devices, Inc.
  * ************************************************************************/
 
 #pragma once
 
-#include <cassert>
-
 #include <hip/hip_runtime.h>
 #include <rocblas/rocblas.h>
 
 #include "lib_macros.hpp"
-#include "rocsolver_logger.hpp"
 
 ROCSOLVER_BEGIN_NAMESPACE
 
-#define IOTA_MAX_THDS 32
-
-// Fills the given range with sequentially increasing values.
-// The name and interface is based on std::iota
+// Returns the constants {-1, 0, 1} of type T (float, double, rocblas_float_complex or
+// rocblas_double_complex) in the memory of the current device, to be used as alpha and beta by
+// the rocBLAS calls in device pointer mode. The constants are resident device globals, so no
+// copy or kernel launch is needed at every call. Returns nullptr if the address of the constants
+// cannot be resolved (e.g. if there is no valid current device).
 template <typename T>
-ROCSOLVER_KERNEL void __launch_bounds__(IOTA_MAX_THDS) iota_n(T* first, uint32_t count, T value)
+T* device_scalars();
+
+// Sets the given workspace pointer to the constants returned by device_scalars<T>, or returns
+// rocblas_status_internal_error if their address cannot be resolved on the current device.
+// The getMemorySize functions still report a size_scalars for the constants, but the impls only
+// use it to know whether the constants are needed: they pass a size of 0 for that slot to
+// rocblas_device_malloc (and to the device memory size queries), so no memory is reserved.
+template <typename T, typename P>
+inline rocblas_status set_device_scalars(P& scalars)
 {
-    const auto idx = hipThreadIdx_x;
-    if(idx < count)
-    {
-        first[idx] = T(idx) + value;
-    }
-}
-
-// Initializes scalars on the device.
-template <typename T>
-void init_scalars(rocblas_handle handle, T* scalars)
-{
-    assert(scalars != nullptr);
-
-    hipStream_t stream;
-    rocblas_get_stream(handle, &stream);
-    ROCSOLVER_LAUNCH_KERNEL(iota_n<T>, dim3(1), dim3(IOTA_MAX_THDS), 0, stream, scalars, 3, -1);
+    T* ptr = device_scalars<T>();
+    if(!ptr)
+        return rocblas_status_internal_error;
+    scalars = ptr;
+    return rocblas_status_success;
 }
 
 ROCSOLVER_END_NAMESPACE
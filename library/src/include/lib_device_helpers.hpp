@@ -78,6 +78,16 @@ __device__ void swap(const rocblas_int n, T* a, const rocblas_int inca, T* b, co
         swap(a[inca * tid], b[incb * tid]);
 }
 
+/** HASH64 mixes the bits of x (splitmix64 finalizer). It is used as a counter-based random
+    number generator, so that the generated values do not depend on the launch configuration **/
+__device__ inline uint64_t hash64(uint64_t x)
+{
+    x += 0x9E3779B97F4A7C15ULL;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+}
+
 /** SWAPVECT device function swap vectors a and b of dimension n **/
 template <typename T>
 __device__ void
@@ -122,6 +132,30 @@ __device__ void scale_tridiag(const rocblas_int start, const rocblas_int end, T*
     }
 }
 
+/** LARFG_SET_TAUBETA computes the Householder scalar tau, the scaling factor of the Householder
+    vector, and the real value beta to which alpha is reduced (as in LARFG) **/
+template <typename T, typename S>
+__device__ void larfg_set_taubeta(const T alpha, const S xnorm2, T& tau, T& scal, S& beta)
+{
+    S anorm2 = std::norm(alpha);
+    S ar = std::real(alpha);
+
+    if(xnorm2 == 0 && anorm2 == ar * ar)
+    {
+        // H = I
+        tau = 0;
+        scal = 1;
+        beta = ar;
+    }
+    else
+    {
+        beta = sqrt(anorm2 + xnorm2);
+        beta = ar >= 0 ? -beta : beta;
+        tau = (T(beta) - alpha) / T(beta);
+        scal = T(1) / (alpha - T(beta));
+    }
+}
+
 // **********************************************************
 // GPU kernels that are used by many rocsolver functions
 // **********************************************************
@@ -30,9 +30,18 @@
 #include <cassert>
 #include <cstdlib>
 #include <cstring>
+#include <limits>
 #include <hip/hip_runtime.h>
 #include <rocblas/rocblas.h>
 
+// internal symbols of librocsolver that the lazily loaded specialized kernels module binds to
+// (see rocsolver_specialized_module.hpp) must be visible outside of the library
+#if defined(ROCSOLVER_LAZY_SPECIALIZED) || defined(ROCSOLVER_SPECIALIZED_MODULE)
+#define ROCSOLVER_MODULE_VISIBLE __attribute__((visibility("default")))
+#else
+#define ROCSOLVER_MODULE_VISIBLE
+#endif
+
 ROCSOLVER_BEGIN_NAMESPACE
 
 /*
@@ -91,6 +100,47 @@ I get_index(I* intervals, I max, I dim)
     return i;
 }
 
+/** Returns true if all the problems of a strided batch of linear systems share the same
+    coefficient matrix (strideA = 0), and their right-hand sides are the consecutive columns of a
+    single matrix with leading dimension *ldbc (strideB = ldb * nrhs, or any large enough strideB if
+    nrhs = 1). The batch can then be solved as one system with nrhs * batch_count right-hand sides,
+    reading the factorization once instead of once per problem. **/
+template <typename I>
+inline bool rhs_broadcast(const I n,
+                          const I nrhs,
+                          const I incb,
+                          const I ldb,
+                          const rocblas_stride strideA,
+                          const rocblas_stride strideB,
+                          const I batch_count,
+                          I* ldbc)
+{
+    if(strideA != 0 || batch_count < 2
+       || int64_t(nrhs) * batch_count > std::numeric_limits<I>::max())
+        return false;
+
+    if(strideB == rocblas_stride(ldb) * nrhs)
+        *ldbc = ldb;
+    else if(nrhs == 1 && strideB >= rocblas_stride(incb) * n
+            && strideB <= std::numeric_limits<I>::max())
+        *ldbc = I(strideB);
+    else
+        return false;
+
+    return true;
+}
+
+/** Returns true if the given stream is currently being captured into a HIP graph.
+    Operations that synchronize with the host (e.g. reading back device values to
+    decide the number of kernel launches) are not allowed while capturing. **/
+inline bool stream_is_capturing(hipStream_t stream)
+{
+    hipStreamCaptureStatus status = hipStreamCaptureStatusNone;
+    if(hipStreamIsCapturing(stream, &status) != hipSuccess)
+        return false;
+    return status == hipStreamCaptureStatusActive;
+}
+
 #ifdef ROCSOLVER_VERIFY_ASSUMPTIONS
 // Ensure __assert_fail is declared.
 #if !__is_identifier(__assert_fail)
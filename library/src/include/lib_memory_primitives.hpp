@@ -0,0 +1,432 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+
+#include "lib_device_helpers.hpp"
+#include "lib_host_helpers.hpp"
+#include "rocsolver_logger.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/*
+ * ===========================================================================
+ *    memory primitives that copy, transpose and initialize (batches of)
+ *    matrices at close to the peak bandwidth of the device. They reproduce
+ *    the semantics of the COPY_MAT, COPY_TRANS_MAT, SET_ZERO and INIT_IDENT
+ *    kernels in lib_device_helpers.hpp, and are called through the host
+ *    launchers at the end of this file:
+ *
+ *    - The columns of a matrix are processed in chunks of 16 bytes with a
+ *      single vector load or store, when the matrix (after the shift) and
+ *      its leading dimension are suitably aligned;
+ *    - Transpositions are staged through LDS, so that both the reads and the
+ *      writes are coalesced;
+ *    - The grids are capped (see MEMPRIM_MAX_BLOCKS) and the threads loop
+ *      over the rows, columns and matrices of the batch.
+ * ===========================================================================
+ */
+
+#define MEMPRIM_DIMX 64 // threads per block in the row direction
+#define MEMPRIM_DIMY 4 // threads per block in the column direction
+#define MEMPRIM_TRANS_ROWS 8 // rows of threads per block in the tiled transposition
+
+/** WIDE_VECTOR groups the entries of type T that fit in 16 bytes **/
+template <typename T>
+struct alignas(16) wide_vector
+{
+    static constexpr rocblas_int width = (sizeof(T) < 16) ? 16 / sizeof(T) : 1;
+    T v[width];
+};
+
+/** WIDE_ALIGNED returns true if all the chunks of wide_vector<T>::width entries starting at every
+    multiple of the width in the columns of A can be accessed with a single vector load or store **/
+template <typename T>
+__device__ __forceinline__ bool wide_aligned(const T* A, const rocblas_int lda)
+{
+    constexpr rocblas_int w = wide_vector<T>::width;
+    return sizeof(wide_vector<T>) == w * sizeof(T)
+        && reinterpret_cast<std::uintptr_t>(A) % sizeof(wide_vector<T>) == 0 && lda % w == 0;
+}
+
+/** IN_TRIANGLE returns true if entry (i, j) is in the triangular part of a matrix selected by
+    uplo and diag, following the convention of COPY_MAT **/
+__device__ __forceinline__ bool in_triangle(const rocblas_int i,
+                                            const rocblas_int j,
+                                            const rocblas_fill uplo,
+                                            const rocblas_diagonal diag)
+{
+    return uplo == rocblas_fill_full || (uplo == rocblas_fill_upper && j > i)
+        || (uplo == rocblas_fill_lower && i > j) || (diag == rocblas_diagonal_non_unit && i == j);
+}
+
+/** COPY_MAT_WIDE copies m-by-n array A into B, as COPY_MAT. Each thread copies chunks of
+    wide_vector<T>::width consecutive entries of a column (or single entries if A or B are not
+    aligned), and only the chunks that are crossed by the diagonal are copied entry by entry when
+    uplo is not full. **/
+template <typename T, typename U1, typename U2, typename Mask>
+ROCSOLVER_KERNEL void __launch_bounds__(MEMPRIM_DIMX* MEMPRIM_DIMY)
+    copy_mat_wide(const rocblas_int m,
+                  const rocblas_int n,
+                  U1 A,
+                  const rocblas_stride shiftA,
+                  const rocblas_int lda,
+                  const rocblas_stride strideA,
+                  U2 B,
+                  const rocblas_stride shiftB,
+                  const rocblas_int ldb,
+                  const rocblas_stride strideB,
+                  const rocblas_int batch_count,
+                  const Mask mask,
+                  const rocblas_fill uplo,
+                  const rocblas_diagonal diag)
+{
+    using V = wide_vector<T>;
+
+    for(rocblas_int b = hipBlockIdx_z; b < batch_count; b += hipGridDim_z)
+    {
+        if(!mask[b])
+            continue;
+
+        T* Ap = load_ptr_batch<T>(A, b, shiftA, strideA);
+        T* Bp = load_ptr_batch<T>(B, b, shiftB, strideB);
+
+        // the chunk width is uniform for all the threads working on matrix b
+        const rocblas_int w = (wide_aligned(Ap, lda) && wide_aligned(Bp, ldb)) ? V::width : 1;
+        const rocblas_int chunks = (m - 1) / w + 1;
+
+        for(rocblas_int j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y; j < n;
+            j += hipGridDim_y * hipBlockDim_y)
+        {
+            T* a = Ap + j * rocblas_stride(lda);
+            T* bb = Bp + j * rocblas_stride(ldb);
+
+            for(rocblas_int c = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x; c < chunks;
+                c += hipGridDim_x * hipBlockDim_x)
+            {
+                const rocblas_int i = c * w;
+                const rocblas_int cnt = std::min(w, m - i);
+
+                // (the triangular parts are intervals of each column, so the chunk is
+                // fully contained if its first and last entries are)
+                if(cnt == V::width && in_triangle(i, j, uplo, diag)
+                   && in_triangle(i + cnt - 1, j, uplo, diag))
+                {
+                    *reinterpret_cast<V*>(bb + i) = *reinterpret_cast<const V*>(a + i);
+                }
+                else
+                {
+                    for(rocblas_int k = 0; k < cnt; k++)
+                        if(in_triangle(i + k, j, uplo, diag))
+                            bb[i + k] = a[i + k];
+                }
+            }
+        }
+    }
+}
+
+/** SET_MAT_WIDE inserts zeros in the entries of the m-by-n matrix A, as SET_ZERO (i.e. the
+    triangular part selected by uplo, including the diagonal, is kept unchanged). If ident is true,
+    the matrix is set to the identity instead, as INIT_IDENT (uplo must be full). **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(MEMPRIM_DIMX* MEMPRIM_DIMY)
+    set_mat_wide(const rocblas_int m,
+                 const rocblas_int n,
+                 U A,
+                 const rocblas_stride shiftA,
+                 const rocblas_int lda,
+                 const rocblas_stride strideA,
+                 const rocblas_int batch_count,
+                 const rocblas_fill uplo,
+                 const bool ident)
+{
+    using V = wide_vector<T>;
+
+    // set_zero modifies the strictly triangular part opposite to uplo
+    const rocblas_fill tri = (uplo == rocblas_fill_lower) ? rocblas_fill_upper
+        : (uplo == rocblas_fill_upper)                    ? rocblas_fill_lower
+                                                          : rocblas_fill_full;
+
+    for(rocblas_int b = hipBlockIdx_z; b < batch_count; b += hipGridDim_z)
+    {
+        T* Ap = load_ptr_batch<T>(A, b, shiftA, strideA);
+
+        const rocblas_int w = wide_aligned(Ap, lda) ? V::width : 1;
+        const rocblas_int chunks = (m - 1) / w + 1;
+
+        for(rocblas_int j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y; j < n;
+            j += hipGridDim_y * hipBlockDim_y)
+        {
+            T* a = Ap + j * rocblas_stride(lda);
+
+            for(rocblas_int c = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x; c < chunks;
+                c += hipGridDim_x * hipBlockDim_x)
+            {
+                const rocblas_int i = c * w;
+                const rocblas_int cnt = std::min(w, m - i);
+
+                if(cnt == V::width && in_triangle(i, j, tri, rocblas_diagonal_unit)
+                   && in_triangle(i + cnt - 1, j, tri, rocblas_diagonal_unit))
+                {
+                    V v;
+                    for(rocblas_int k = 0; k < V::width; k++)
+                        v.v[k] = (ident && i + k == j) ? T(1) : T(0);
+                    *reinterpret_cast<V*>(a + i) = v;
+                }
+                else
+                {
+                    for(rocblas_int k = 0; k < cnt; k++)
+                        if(in_triangle(i + k, j, tri, rocblas_diagonal_unit))
+                            a[i + k] = (ident && i + k == j) ? T(1) : T(0);
+                }
+            }
+        }
+    }
+}
+
+/** COPY_TRANS_TILED copies the (conjugate) transpose of m-by-n array A into B, as COPY_TRANS_MAT
+    with trans != none. Every BS2-by-BS2 tile of A is read by columns into LDS, and written by
+    columns of B (i.e. rows of the tile). **/
+template <typename T1, typename T2, typename Mask>
+ROCSOLVER_KERNEL void __launch_bounds__(BS2* MEMPRIM_TRANS_ROWS)
+    copy_trans_tiled(const rocblas_operation trans,
+                     const rocblas_int m,
+                     const rocblas_int n,
+                     T1* A,
+                     const rocblas_stride shiftA,
+                     const rocblas_int lda,
+                     const rocblas_stride strideA,
+                     T2* B,
+                     const rocblas_stride shiftB,
+                     const rocblas_int ldb,
+                     const rocblas_stride strideB,
+                     const rocblas_int batch_count,
+                     const Mask mask,
+                     const rocblas_fill uplo,
+                     const rocblas_diagonal diag)
+{
+    // (the padding avoids bank conflicts when the tile is read by rows)
+    __shared__ T2 tile[BS2][BS2 + 1];
+
+    const rocblas_int tx = hipThreadIdx_x;
+    const rocblas_int ty = hipThreadIdx_y;
+    const rocblas_int tiles_m = (m - 1) / BS2 + 1;
+    const rocblas_int tiles_n = (n - 1) / BS2 + 1;
+    const bool cj = (trans == rocblas_operation_conjugate_transpose);
+
+    for(rocblas_int b = hipBlockIdx_z; b < batch_count; b += hipGridDim_z)
+    {
+        // (the mask is uniform in the thread-block, so no thread skips the barriers alone)
+        if(!mask[b])
+            continue;
+
+        T1* Ap = load_ptr_batch<T1>(A, b, shiftA, strideA);
+        T2* Bp = load_ptr_batch<T2>(B, b, shiftB, strideB);
+
+        for(rocblas_int tj = hipBlockIdx_y; tj < tiles_n; tj += hipGridDim_y)
+        {
+            for(rocblas_int ti = hipBlockIdx_x; ti < tiles_m; ti += hipGridDim_x)
+            {
+                const rocblas_int i0 = ti * BS2;
+                const rocblas_int j0 = tj * BS2;
+
+                for(rocblas_int k = ty; k < BS2; k += MEMPRIM_TRANS_ROWS)
+                {
+                    const rocblas_int i = i0 + tx;
+                    const rocblas_int j = j0 + k;
+                    if(i < m && j < n)
+                    {
+                        T1 a = Ap[i + j * rocblas_stride(lda)];
+                        tile[k][tx] = cj ? T2(conj(a)) : T2(a);
+                    }
+                }
+                __syncthreads();
+
+                for(rocblas_int k = ty; k < BS2; k += MEMPRIM_TRANS_ROWS)
+                {
+                    const rocblas_int i = i0 + k;
+                    const rocblas_int j = j0 + tx;
+                    if(i < m && j < n && in_triangle(i, j, uplo, diag))
+                        Bp[j + i * rocblas_stride(ldb)] = tile[tx][k];
+                }
+                __syncthreads();
+            }
+        }
+    }
+}
+
+/*************************************************************
+    Launchers of the memory primitives
+*************************************************************/
+
+/** MEMPRIM_GRID returns the capped grid for a batch of matrices with the given number of chunks
+    per column and columns, when every thread processes one chunk per iteration **/
+inline dim3
+    memprim_grid(const rocblas_int chunks, const rocblas_int n, const rocblas_int batch_count)
+{
+    const rocblas_int bx = std::min((chunks - 1) / MEMPRIM_DIMX + 1, MEMPRIM_MAX_BLOCKS);
+    const rocblas_int by = std::min((n - 1) / MEMPRIM_DIMY + 1, MEMPRIM_MAX_BLOCKS);
+    return dim3(bx, by, batch_count);
+}
+
+/** LAUNCH_COPY_MAT copies m-by-n array A into B, with the same optional mask, uplo and diag
+    arguments as the kernel COPY_MAT **/
+template <typename T, typename U1, typename U2, typename Mask = no_mask>
+void launch_copy_mat(rocblas_handle handle,
+                     const rocblas_int m,
+                     const rocblas_int n,
+                     U1 A,
+                     const rocblas_stride shiftA,
+                     const rocblas_int lda,
+                     const rocblas_stride strideA,
+                     U2 B,
+                     const rocblas_stride shiftB,
+                     const rocblas_int ldb,
+                     const rocblas_stride strideB,
+                     const rocblas_int batch_count,
+                     const Mask mask = no_mask{},
+                     const rocblas_fill uplo = rocblas_fill_full,
+                     const rocblas_diagonal diag = rocblas_diagonal_non_unit)
+{
+    if(m == 0 || n == 0 || batch_count == 0)
+        return;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    const rocblas_int chunks = (m - 1) / wide_vector<T>::width + 1;
+    ROCSOLVER_LAUNCH_KERNEL((copy_mat_wide<T>), memprim_grid(chunks, n, batch_count),
+                            dim3(MEMPRIM_DIMX, MEMPRIM_DIMY, 1), 0, stream, m, n, A, shiftA, lda,
+                            strideA, B, shiftB, ldb, strideB, batch_count, mask, uplo, diag);
+}
+
+/** LAUNCH_SET_ZERO inserts zeros in the m-by-n matrix A, keeping the triangular part selected by
+    uplo unchanged as the kernel SET_ZERO **/
+template <typename T, typename U>
+void launch_set_zero(rocblas_handle handle,
+                     const rocblas_int m,
+                     const rocblas_int n,
+                     U A,
+                     const rocblas_stride shiftA,
+                     const rocblas_int lda,
+                     const rocblas_stride strideA,
+                     const rocblas_int batch_count,
+                     const rocblas_fill uplo = rocblas_fill_full)
+{
+    if(m == 0 || n == 0 || batch_count == 0)
+        return;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    const rocblas_int chunks = (m - 1) / wide_vector<T>::width + 1;
+    ROCSOLVER_LAUNCH_KERNEL((set_mat_wide<T>), memprim_grid(chunks, n, batch_count),
+                            dim3(MEMPRIM_DIMX, MEMPRIM_DIMY, 1), 0, stream, m, n, A, shiftA, lda,
+                            strideA, batch_count, uplo, false);
+}
+
+/** LAUNCH_INIT_IDENT sets the m-by-n matrix A to the identity, as the kernel INIT_IDENT **/
+template <typename T, typename U>
+void launch_init_ident(rocblas_handle handle,
+                       const rocblas_int m,
+                       const rocblas_int n,
+                       U A,
+                       const rocblas_stride shiftA,
+                       const rocblas_int lda,
+                       const rocblas_stride strideA,
+                       const rocblas_int batch_count)
+{
+    if(m == 0 || n == 0 || batch_count == 0)
+        return;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    const rocblas_int chunks = (m - 1) / wide_vector<T>::width + 1;
+    ROCSOLVER_LAUNCH_KERNEL((set_mat_wide<T>), memprim_grid(chunks, n, batch_count),
+                            dim3(MEMPRIM_DIMX, MEMPRIM_DIMY, 1), 0, stream, m, n, A, shiftA, lda,
+                            strideA, batch_count, rocblas_fill_full, true);
+}
+
+/** LAUNCH_COPY_TRANS_MAT copies m-by-n array A into B, transposed or not depending on trans, with
+    the same optional mask, uplo and diag arguments as the kernel COPY_TRANS_MAT **/
+template <typename T1, typename T2, typename Mask = no_mask>
+void launch_copy_trans_mat(rocblas_handle handle,
+                           const rocblas_operation trans,
+                           const rocblas_int m,
+                           const rocblas_int n,
+                           T1* A,
+                           const rocblas_stride shiftA,
+                           const rocblas_int lda,
+                           const rocblas_stride strideA,
+                           T2* B,
+                           const rocblas_stride shiftB,
+                           const rocblas_int ldb,
+                           const rocblas_stride strideB,
+                           const rocblas_int batch_count,
+                           const Mask mask = no_mask{},
+                           const rocblas_fill uplo = rocblas_fill_full,
+                           const rocblas_diagonal diag = rocblas_diagonal_non_unit)
+{
+    using T = T2;
+
+    if(m == 0 || n == 0 || batch_count == 0)
+        return;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    if(trans == rocblas_operation_none && std::is_same<T1, T2>::value)
+    {
+        launch_copy_mat<T>(handle, m, n, A, shiftA, lda, strideA, B, shiftB, ldb, strideB,
+                           batch_count, mask, uplo, diag);
+    }
+    else if(trans == rocblas_operation_none)
+    {
+        // (conversions between types are rare, and are done by the generic kernel)
+        const rocblas_int blocksx = (m - 1) / BS2 + 1;
+        const rocblas_int blocksy = (n - 1) / BS2 + 1;
+        ROCSOLVER_LAUNCH_KERNEL((copy_trans_mat<T1, T2>), dim3(blocksx, blocksy, batch_count),
+                                dim3(BS2, BS2, 1), 0, stream, trans, m, n, A, shiftA, lda, strideA,
+                                B, shiftB, ldb, strideB, mask, uplo, diag);
+    }
+    else
+    {
+        const rocblas_int bx = std::min((m - 1) / BS2 + 1, MEMPRIM_MAX_BLOCKS);
+        const rocblas_int by = std::min((n - 1) / BS2 + 1, MEMPRIM_MAX_BLOCKS);
+        ROCSOLVER_LAUNCH_KERNEL((copy_trans_tiled<T1, T2>), dim3(bx, by, batch_count),
+                                dim3(BS2, MEMPRIM_TRANS_ROWS, 1), 0, stream, trans, m, n, A,
+                                shiftA, lda, strideA, B, shiftB, ldb, strideB, batch_count, mask,
+                                uplo, diag);
+    }
+}
+
+ROCSOLVER_END_NAMESPACE
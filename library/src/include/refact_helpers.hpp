@@ -84,4 +84,45 @@ ROCSOLVER_KERNEL void rf_ipvec_kernel(rocblas_int n, rocblas_int* pivQ, rocblas_
     }
 }
 
+/** RF_NORM_KERNEL computes the infinity norms of the n-by-n CSR matrices in valT (all with the
+    row pointers ptrT), multiplied by scale. Each thread-block processes one matrix of the
+    batch. **/
+template <typename T, typename S>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) rf_norm_kernel(const rocblas_int n,
+                                                            const rocblas_int* ptrT,
+                                                            T* valTA,
+                                                            const rocblas_stride strideT,
+                                                            const S scale,
+                                                            S* anorm)
+{
+    rocblas_int tid = hipThreadIdx_x;
+    rocblas_int bid = hipBlockIdx_y;
+    T* valT = valTA + bid * strideT;
+
+    __shared__ S sval[BS1];
+
+    // each thread computes the sums of the rows it is assigned
+    S val = 0;
+    for(rocblas_int i = tid; i < n; i += BS1)
+    {
+        S sum = 0;
+        for(rocblas_int k = ptrT[i]; k < ptrT[i + 1]; ++k)
+            sum += std::abs(valT[k]);
+        val = sum > val ? sum : val;
+    }
+    sval[tid] = val;
+    __syncthreads();
+
+    // reduce the partial maxima
+    for(rocblas_int i = BS1 / 2; i > 0; i /= 2)
+    {
+        if(tid < i && sval[tid + i] > sval[tid])
+            sval[tid] = sval[tid + i];
+        __syncthreads();
+    }
+
+    if(tid == 0)
+        anorm[bid] = scale * sval[0];
+}
+
 ROCSOLVER_END_NAMESPACE
@@ -35,7 +35,9 @@
 #include "lib_host_helpers.hpp"
 #include "rocblas/internal/rocblas-exported-proto.hpp"
 #include "rocblas/internal/rocblas_device_malloc.hpp"
+#include "rocsolver_hipblaslt.hpp"
 #include "rocsolver_logger.hpp"
+#include "rocsolver_streams.hpp"
 
 #ifndef HAVE_ROCBLAS_64
 #if ROCBLAS_VERSION_MAJOR > 4 || (ROCBLAS_VERSION_MAJOR == 4 && ROCBLAS_VERSION_MINOR >= 2)
@@ -309,8 +311,9 @@ rocblas_status rocblasCall_axpy(rocblas_handle handle,
     ROCBLAS_ENTER("axpy", "n:", n, "shiftX:", shiftx, "incx:", incx, "shiftY:", shifty,
                   "incy:", incy, "bc:", batch_count);
 
-    return rocblas_internal_axpy_template(handle, n, alpha, stride_alpha, x, shiftx, incx, stridex,
-                                          y, shifty, incy, stridey, batch_count);
+    return rocblas_internal_axpy_template(rocsolver_blas_handle(handle), n, alpha, stride_alpha, x,
+                                          shiftx, incx, stridex, y, shifty, incy, stridey,
+                                          batch_count);
 }
 
 // batched axpy
@@ -333,8 +336,9 @@ rocblas_status rocblasCall_axpy(rocblas_handle handle,
     ROCBLAS_ENTER("axpy", "n:", n, "shiftX:", shiftx, "incx:", incx, "shiftY:", shifty,
                   "incy:", incy, "bc:", batch_count);
 
-    return rocblas_internal_axpy_batched_template(handle, n, alpha, stride_alpha, x, shiftx, incx,
-                                                  stridex, y, shifty, incy, stridey, batch_count);
+    return rocblas_internal_axpy_batched_template(rocsolver_blas_handle(handle), n, alpha,
+                                                  stride_alpha, x, shiftx, incx, stridex, y, shifty,
+                                                  incy, stridey, batch_count);
 }
 
 // iamax
@@ -351,8 +355,8 @@ rocblas_status rocblasCall_iamax(rocblas_handle handle,
 {
     ROCBLAS_ENTER("iamax", "n:", n, "shiftX:", shiftx, "incx:", incx, "bc:", batch_count);
 
-    return rocblas_internal_iamax_template(handle, n, x, shiftx, incx, stridex, batch_count, result,
-                                           workspace);
+    return rocblas_internal_iamax_template(rocsolver_blas_handle(handle), n, x, shiftx, incx,
+                                           stridex, batch_count, result, workspace);
 }
 
 // batched iamax
@@ -369,8 +373,8 @@ rocblas_status rocblasCall_iamax(rocblas_handle handle,
 {
     ROCBLAS_ENTER("iamax", "n:", n, "shiftX:", shiftx, "incx:", incx, "bc:", batch_count);
 
-    return rocblas_internal_iamax_batched_template(handle, n, x, shiftx, incx, stridex, batch_count,
-                                                   result, workspace);
+    return rocblas_internal_iamax_batched_template(rocsolver_blas_handle(handle), n, x, shiftx,
+                                                   incx, stridex, batch_count, result, workspace);
 }
 
 // scal
@@ -389,11 +393,11 @@ rocblas_status rocblasCall_scal(rocblas_handle handle,
     ROCBLAS_ENTER("scal", "n:", n, "shiftX:", offsetx, "incx:", incx, "bc:", batch_count);
 
     if constexpr(std::is_same<I, int64_t>::value)
-        return rocblas_internal_scal_template_64(handle, n, alpha, stridea, x, offsetx, incx,
-                                                 stridex, batch_count);
+        return rocblas_internal_scal_template_64(rocsolver_blas_handle(handle), n, alpha, stridea,
+                                                 x, offsetx, incx, stridex, batch_count);
     else
-        return rocblas_internal_scal_template(handle, n, alpha, stridea, x, offsetx, incx, stridex,
-                                              batch_count);
+        return rocblas_internal_scal_template(rocsolver_blas_handle(handle), n, alpha, stridea, x,
+                                              offsetx, incx, stridex, batch_count);
 }
 
 // batched scal
@@ -412,11 +416,13 @@ rocblas_status rocblasCall_scal(rocblas_handle handle,
     ROCBLAS_ENTER("scal", "n:", n, "shiftX:", offsetx, "incx:", incx, "bc:", batch_count);
 
     if constexpr(std::is_same<I, int64_t>::value)
-        return rocblas_internal_scal_batched_template_64(handle, n, alpha, stridea, x, offsetx,
-                                                         incx, stridex, batch_count);
+        return rocblas_internal_scal_batched_template_64(rocsolver_blas_handle(handle), n, alpha,
+                                                         stridea, x, offsetx, incx, stridex,
+                                                         batch_count);
     else
-        return rocblas_internal_scal_batched_template(handle, n, alpha, stridea, x, offsetx, incx,
-                                                      stridex, batch_count);
+        return rocblas_internal_scal_batched_template(rocsolver_blas_handle(handle), n, alpha,
+                                                      stridea, x, offsetx, incx, stridex,
+                                                      batch_count);
 }
 
 // dot
@@ -440,11 +446,13 @@ rocblas_status rocblasCall_dot(rocblas_handle handle,
                   "incy:", incy, "bc:", batch_count);
 
     if constexpr(CONJ)
-        return rocblas_internal_dotc_template(handle, n, x, offsetx, incx, stridex, y, offsety,
-                                              incy, stridey, batch_count, results, workspace);
+        return rocblas_internal_dotc_template(rocsolver_blas_handle(handle), n, x, offsetx, incx,
+                                              stridex, y, offsety, incy, stridey, batch_count,
+                                              results, workspace);
     else
-        return rocblas_internal_dot_template(handle, n, x, offsetx, incx, stridex, y, offsety, incy,
-                                             stridey, batch_count, results, workspace);
+        return rocblas_internal_dot_template(rocsolver_blas_handle(handle), n, x, offsetx, incx,
+                                             stridex, y, offsety, incy, stridey, batch_count,
+                                             results, workspace);
 }
 
 // batched dot
@@ -468,12 +476,13 @@ rocblas_status rocblasCall_dot(rocblas_handle handle,
                   "incy:", incy, "bc:", batch_count);
 
     if constexpr(CONJ)
-        return rocblas_internal_dotc_batched_template(handle, n, x, offsetx, incx, stridex, y,
-                                                      offsety, incy, stridey, batch_count, results,
-                                                      workspace);
+        return rocblas_internal_dotc_batched_template(rocsolver_blas_handle(handle), n, x, offsetx,
+                                                      incx, stridex, y, offsety, incy, stridey,
+                                                      batch_count, results, workspace);
     else
-        return rocblas_internal_dot_batched_template(handle, n, x, offsetx, incx, stridex, y, offsety,
-                                                     incy, stridey, batch_count, results, workspace);
+        return rocblas_internal_dot_batched_template(rocsolver_blas_handle(handle), n, x, offsetx,
+                                                     incx, stridex, y, offsety, incy, stridey,
+                                                     batch_count, results, workspace);
 }
 
 // dot overload
@@ -504,13 +513,13 @@ rocblas_status rocblasCall_dot(rocblas_handle handle,
                             batch_count);
 
     if constexpr(CONJ)
-        return rocblas_internal_dotc_batched_template(handle, n, cast2constType<T>(work), offsetx,
-                                                      incx, stridex, y, offsety, incy, stridey,
-                                                      batch_count, results, workspace);
+        return rocblas_internal_dotc_batched_template(
+            rocsolver_blas_handle(handle), n, cast2constType<T>(work), offsetx, incx, stridex, y,
+            offsety, incy, stridey, batch_count, results, workspace);
     else
-        return rocblas_internal_dot_batched_template(handle, n, cast2constType<T>(work), offsetx,
-                                                     incx, stridex, y, offsety, incy, stridey,
-                                                     batch_count, results, workspace);
+        return rocblas_internal_dot_batched_template(
+            rocsolver_blas_handle(handle), n, cast2constType<T>(work), offsetx, incx, stridex, y,
+            offsety, incy, stridey, batch_count, results, workspace);
 }
 
 // ger - non batched
@@ -542,24 +551,24 @@ rocblas_status rocblasCall_ger(rocblas_handle handle,
     if constexpr(std::is_same<I, int64_t>::value)
     {
         if constexpr(CONJ)
-            return rocblas_internal_gerc_template_64(handle, m, n, alpha, stridea, x, offsetx, incx,
-                                                     stridex, y, offsety, incy, stridey, A, offsetA,
-                                                     lda, strideA, batch_count);
+            return rocblas_internal_gerc_template_64(
+                rocsolver_blas_handle(handle), m, n, alpha, stridea, x, offsetx, incx, stridex, y,
+                offsety, incy, stridey, A, offsetA, lda, strideA, batch_count);
         else
-            return rocblas_internal_ger_template_64(handle, m, n, alpha, stridea, x, offsetx, incx,
-                                                    stridex, y, offsety, incy, stridey, A, offsetA,
-                                                    lda, strideA, batch_count);
+            return rocblas_internal_ger_template_64(
+                rocsolver_blas_handle(handle), m, n, alpha, stridea, x, offsetx, incx, stridex, y,
+                offsety, incy, stridey, A, offsetA, lda, strideA, batch_count);
     }
     else
     {
         if constexpr(CONJ)
-            return rocblas_internal_gerc_template(handle, m, n, alpha, stridea, x, offsetx, incx,
-                                                  stridex, y, offsety, incy, stridey, A, offsetA,
-                                                  lda, strideA, batch_count);
+            return rocblas_internal_gerc_template(
+                rocsolver_blas_handle(handle), m, n, alpha, stridea, x, offsetx, incx, stridex, y,
+                offsety, incy, stridey, A, offsetA, lda, strideA, batch_count);
         else
-            return rocblas_internal_ger_template(handle, m, n, alpha, stridea, x, offsetx, incx,
-                                                 stridex, y, offsety, incy, stridey, A, offsetA,
-                                                 lda, strideA, batch_count);
+            return rocblas_internal_ger_template(
+                rocsolver_blas_handle(handle), m, n, alpha, stridea, x, offsetx, incx, stridex, y,
+                offsety, incy, stridey, A, offsetA, lda, strideA, batch_count);
     }
 }
 
@@ -593,23 +602,23 @@ rocblas_status rocblasCall_ger(rocblas_handle handle,
     {
         if constexpr(CONJ)
             return rocblas_internal_gerc_batched_template_64(
-                handle, m, n, alpha, stridea, x, offsetx, incx, stridex, y, offsety, incy, stridey,
-                A, offsetA, lda, strideA, batch_count);
+                rocsolver_blas_handle(handle), m, n, alpha, stridea, x, offsetx, incx, stridex, y,
+                offsety, incy, stridey, A, offsetA, lda, strideA, batch_count);
         else
-            return rocblas_internal_ger_batched_template_64(handle, m, n, alpha, stridea, x, offsetx,
-                                                            incx, stridex, y, offsety, incy, stridey,
-                                                            A, offsetA, lda, strideA, batch_count);
+            return rocblas_internal_ger_batched_template_64(
+                rocsolver_blas_handle(handle), m, n, alpha, stridea, x, offsetx, incx, stridex, y,
+                offsety, incy, stridey, A, offsetA, lda, strideA, batch_count);
     }
     else
     {
         if constexpr(CONJ)
-            return rocblas_internal_gerc_batched_template(handle, m, n, alpha, stridea, x, offsetx,
-                                                          incx, stridex, y, offsety, incy, stridey,
-                                                          A, offsetA, lda, strideA, batch_count);
+            return rocblas_internal_gerc_batched_template(
+                rocsolver_blas_handle(handle), m, n, alpha, stridea, x, offsetx, incx, stridex, y,
+                offsety, incy, stridey, A, offsetA, lda, strideA, batch_count);
         else
-            return rocblas_internal_ger_batched_template(handle, m, n, alpha, stridea, x, offsetx,
-                                                         incx, stridex, y, offsety, incy, stridey,
-                                                         A, offsetA, lda, strideA, batch_count);
+            return rocblas_internal_ger_batched_template(
+                rocsolver_blas_handle(handle), m, n, alpha, stridea, x, offsetx, incx, stridex, y,
+                offsety, incy, stridey, A, offsetA, lda, strideA, batch_count);
     }
 }
 
@@ -650,23 +659,27 @@ rocblas_status rocblasCall_ger(rocblas_handle handle,
     {
         if constexpr(CONJ)
             return rocblas_internal_gerc_batched_template_64(
-                handle, m, n, alpha, stridea, x, offsetx, incx, stridex, cast2constType<T>(work),
-                offsety, incy, stridey, A, offsetA, lda, strideA, batch_count);
+                rocsolver_blas_handle(handle), m, n, alpha, stridea, x, offsetx, incx, stridex,
+                cast2constType<T>(work), offsety, incy, stridey, A, offsetA, lda, strideA,
+                batch_count);
         else
             return rocblas_internal_ger_batched_template_64(
-                handle, m, n, alpha, stridea, x, offsetx, incx, stridex, cast2constType<T>(work),
-                offsety, incy, stridey, A, offsetA, lda, strideA, batch_count);
+                rocsolver_blas_handle(handle), m, n, alpha, stridea, x, offsetx, incx, stridex,
+                cast2constType<T>(work), offsety, incy, stridey, A, offsetA, lda, strideA,
+                batch_count);
     }
     else
     {
         if constexpr(CONJ)
             return rocblas_internal_gerc_batched_template(
-                handle, m, n, alpha, stridea, x, offsetx, incx, stridex, cast2constType<T>(work),
-                offsety, incy, stridey, A, offsetA, lda, strideA, batch_count);
+                rocsolver_blas_handle(handle), m, n, alpha, stridea, x, offsetx, incx, stridex,
+                cast2constType<T>(work), offsety, incy, stridey, A, offsetA, lda, strideA,
+                batch_count);
         else
             return rocblas_internal_ger_batched_template(
-                handle, m, n, alpha, stridea, x, offsetx, incx, stridex, cast2constType<T>(work),
-                offsety, incy, stridey, A, offsetA, lda, strideA, batch_count);
+                rocsolver_blas_handle(handle), m, n, alpha, stridea, x, offsetx, incx, stridex,
+                cast2constType<T>(work), offsety, incy, stridey, A, offsetA, lda, strideA,
+                batch_count);
     }
 }
 
@@ -707,23 +720,27 @@ rocblas_status rocblasCall_ger(rocblas_handle handle,
     {
         if constexpr(CONJ)
             return rocblas_internal_gerc_batched_template_64(
-                handle, m, n, alpha, stridea, cast2constType<T>(work), offsetx, incx, stridex, y,
-                offsety, incy, stridey, A, offsetA, lda, strideA, batch_count);
+                rocsolver_blas_handle(handle), m, n, alpha, stridea, cast2constType<T>(work),
+                offsetx, incx, stridex, y, offsety, incy, stridey, A, offsetA, lda, strideA,
+                batch_count);
         else
             return rocblas_internal_ger_batched_template_64(
-                handle, m, n, alpha, stridea, cast2constType<T>(work), offsetx, incx, stridex, y,
-                offsety, incy, stridey, A, offsetA, lda, strideA, batch_count);
+                rocsolver_blas_handle(handle), m, n, alpha, stridea, cast2constType<T>(work),
+                offsetx, incx, stridex, y, offsety, incy, stridey, A, offsetA, lda, strideA,
+                batch_count);
     }
     else
     {
         if constexpr(CONJ)
             return rocblas_internal_gerc_batched_template(
-                handle, m, n, alpha, stridea, cast2constType<T>(work), offsetx, incx, stridex, y,
-                offsety, incy, stridey, A, offsetA, lda, strideA, batch_count);
+                rocsolver_blas_handle(handle), m, n, alpha, stridea, cast2constType<T>(work),
+                offsetx, incx, stridex, y, offsety, incy, stridey, A, offsetA, lda, strideA,
+                batch_count);
         else
-            return rocblas_internal_ger_batched_template(
-                handle, m, n, alpha, stridea, cast2constType<T>(work), offsetx, incx, stridex, y,
-                offsety, incy, stridey, A, offsetA, lda, strideA, batch_count);
+            return rocblas_internal_ger_batched_template(rocsolver_blas_handle(handle), m, n, alpha,
+                                                         stridea, cast2constType<T>(work), offsetx,
+                                                         incx, stridex, y, offsety, incy, stridey,
+                                                         A, offsetA, lda, strideA, batch_count);
     }
 }
 
@@ -757,9 +774,9 @@ rocblas_status rocblasCall_gemv(rocblas_handle handle,
                   "shiftX:", offsetx, "incx:", incx, "shiftY:", offsety, "incy:", incy,
                   "bc:", batch_count);
 
-    return rocblas_internal_gemv_template(handle, transA, m, n, alpha, stride_alpha, A, offseta,
-                                          lda, strideA, x, offsetx, incx, stridex, beta,
-                                          stride_beta, y, offsety, incy, stridey, batch_count);
+    return rocblas_internal_gemv_template(
+        rocsolver_blas_handle(handle), transA, m, n, alpha, stride_alpha, A, offseta, lda, strideA,
+        x, offsetx, incx, stridex, beta, stride_beta, y, offsety, incy, stridey, batch_count);
 }
 
 // gemv - batched
@@ -793,8 +810,8 @@ rocblas_status rocblasCall_gemv(rocblas_handle handle,
                   "bc:", batch_count);
 
     return rocblas_internal_gemv_batched_template(
-        handle, transA, m, n, alpha, stride_alpha, A, offseta, lda, strideA, x, offsetx, incx,
-        stridex, beta, stride_beta, y, offsety, incy, stridey, batch_count);
+        rocsolver_blas_handle(handle), transA, m, n, alpha, stride_alpha, A, offseta, lda, strideA,
+        x, offsetx, incx, stridex, beta, stride_beta, y, offsety, incy, stridey, batch_count);
 }
 
 // gemv overload - batched with strided A
@@ -835,8 +852,9 @@ rocblas_status rocblasCall_gemv(rocblas_handle handle,
                             batch_count);
 
     return rocblas_internal_gemv_batched_template(
-        handle, transA, m, n, alpha, stride_alpha, cast2constType<T>(work), offseta, lda, strideA,
-        x, offsetx, incx, stridex, beta, stride_beta, y, offsety, incy, stridey, batch_count);
+        rocsolver_blas_handle(handle), transA, m, n, alpha, stride_alpha, cast2constType<T>(work),
+        offseta, lda, strideA, x, offsetx, incx, stridex, beta, stride_beta, y, offsety, incy,
+        stridey, batch_count);
 }
 
 // gemv overload - batched with strided x
@@ -876,10 +894,10 @@ rocblas_status rocblasCall_gemv(rocblas_handle handle,
     ROCSOLVER_LAUNCH_KERNEL(get_array, dim3(blocks), dim3(256), 0, stream, work, x, stridex,
                             batch_count);
 
-    return rocblas_internal_gemv_batched_template(handle, transA, m, n, alpha, stride_alpha, A,
-                                                  offseta, lda, strideA, cast2constType<T>(work),
-                                                  offsetx, incx, stridex, beta, stride_beta, y,
-                                                  offsety, incy, stridey, batch_count);
+    return rocblas_internal_gemv_batched_template(
+        rocsolver_blas_handle(handle), transA, m, n, alpha, stride_alpha, A, offseta, lda, strideA,
+        cast2constType<T>(work), offsetx, incx, stridex, beta, stride_beta, y, offsety, incy,
+        stridey, batch_count);
 }
 
 // gemv overload - batched with strided y
@@ -919,10 +937,10 @@ rocblas_status rocblasCall_gemv(rocblas_handle handle,
     ROCSOLVER_LAUNCH_KERNEL(get_array, dim3(blocks), dim3(256), 0, stream, work, y, stridey,
                             batch_count);
 
-    return rocblas_internal_gemv_batched_template(handle, transA, m, n, alpha, stride_alpha, A,
-                                                  offseta, lda, strideA, x, offsetx, incx, stridex,
-                                                  beta, stride_beta, cast2constPointer<T>(work),
-                                                  offsety, incy, stridey, batch_count);
+    return rocblas_internal_gemv_batched_template(
+        rocsolver_blas_handle(handle), transA, m, n, alpha, stride_alpha, A, offseta, lda, strideA,
+        x, offsetx, incx, stridex, beta, stride_beta, cast2constPointer<T>(work), offsety, incy,
+        stridey, batch_count);
 }
 
 // gemv overload - batched with strided x and y
@@ -965,7 +983,7 @@ rocblas_status rocblasCall_gemv(rocblas_handle handle,
                             stridey, batch_count);
 
     return rocblas_internal_gemv_batched_template(
-        handle, transA, m, n, alpha, stride_alpha, A, offseta, lda, strideA,
+        rocsolver_blas_handle(handle), transA, m, n, alpha, stride_alpha, A, offseta, lda, strideA,
         cast2constType<T>(work), offsetx, incx, stridex, beta, stride_beta,
         cast2constPointer<T>(work + batch_count), offsety, incy, stridey, batch_count);
 }
@@ -1010,9 +1028,9 @@ rocblas_status rocblasCall_gemv(rocblas_handle handle,
                             stridey, batch_count);
 
     return rocblas_internal_gemv_batched_template(
-        handle, transA, m, n, alpha, stride_alpha, cast2constType<T>(work), offseta, lda, strideA,
-        x, offsetx, incx, stridex, beta, stride_beta, cast2constPointer<T>(work + batch_count),
-        offsety, incy, stridey, batch_count);
+        rocsolver_blas_handle(handle), transA, m, n, alpha, stride_alpha, cast2constType<T>(work),
+        offseta, lda, strideA, x, offsetx, incx, stridex, beta, stride_beta,
+        cast2constPointer<T>(work + batch_count), offsety, incy, stridey, batch_count);
 }
 
 // trmv
@@ -1037,8 +1055,9 @@ rocblas_status rocblasCall_trmv(rocblas_handle handle,
     ROCBLAS_ENTER("trmv", "trans:", transa, "diag:", diag, "m:", m, "shiftA:", offseta, "lda:", lda,
                   "shiftX:", offsetx, "incx:", incx, "bc:", batch_count);
 
-    return rocblas_internal_trmv_template(handle, uplo, transa, diag, m, a, offseta, lda, stridea,
-                                          x, offsetx, incx, stridex, w, stridew, batch_count);
+    return rocblas_internal_trmv_template(rocsolver_blas_handle(handle), uplo, transa, diag, m, a,
+                                          offseta, lda, stridea, x, offsetx, incx, stridex, w,
+                                          stridew, batch_count);
 }
 
 template <typename T>
@@ -1062,9 +1081,9 @@ rocblas_status rocblasCall_trmv(rocblas_handle handle,
     ROCBLAS_ENTER("trmv", "trans:", transa, "diag:", diag, "m:", m, "shiftA:", offseta, "lda:", lda,
                   "shiftX:", offsetx, "incx:", incx, "bc:", batch_count);
 
-    return rocblas_internal_trmv_batched_template(handle, uplo, transa, diag, m, a, offseta, lda,
-                                                  stridea, x, offsetx, incx, stridex, w, stridew,
-                                                  batch_count);
+    return rocblas_internal_trmv_batched_template(rocsolver_blas_handle(handle), uplo, transa, diag,
+                                                  m, a, offseta, lda, stridea, x, offsetx, incx,
+                                                  stridex, w, stridew, batch_count);
 }
 
 // gemm - non batched
@@ -1097,9 +1116,16 @@ rocblas_status rocblasCall_gemm(rocblas_handle handle,
                   "shiftA:", offset_a, "lda:", ld_a, "shiftB:", offset_b, "ldb:", ld_b,
                   "shiftC:", offset_c, "ldc:", ld_c, "bc:", batch_count);
 
-    return rocblas_internal_gemm_template(handle, trans_a, trans_b, m, n, k, alpha, A, offset_a,
-                                          ld_a, stride_a, B, offset_b, ld_b, stride_b, beta, C,
-                                          offset_c, ld_c, stride_c, batch_count);
+    // the skinny trailing-matrix updates can be computed with hipBLASLt
+    // (see rocsolver_hipblaslt.hpp)
+    if(rocsolver_hipblaslt_gemm(handle, trans_a, trans_b, m, n, k, alpha, A + offset_a, ld_a,
+                                stride_a, B + offset_b, ld_b, stride_b, beta, C + offset_c, ld_c,
+                                stride_c, batch_count))
+        return rocblas_status_success;
+
+    return rocblas_internal_gemm_template(rocsolver_blas_handle(handle), trans_a, trans_b, m, n, k,
+                                          alpha, A, offset_a, ld_a, stride_a, B, offset_b, ld_b,
+                                          stride_b, beta, C, offset_c, ld_c, stride_c, batch_count);
 }
 
 // gemm - batched
@@ -1133,8 +1159,8 @@ rocblas_status rocblasCall_gemm(rocblas_handle handle,
                   "shiftC:", offset_c, "ldc:", ld_c, "bc:", batch_count);
 
     return rocblas_internal_gemm_batched_template(
-        handle, trans_a, trans_b, m, n, k, alpha, A, offset_a, ld_a, stride_a, B, offset_b, ld_b,
-        stride_b, beta, C, offset_c, ld_c, stride_c, batch_count);
+        rocsolver_blas_handle(handle), trans_a, trans_b, m, n, k, alpha, A, offset_a, ld_a,
+        stride_a, B, offset_b, ld_b, stride_b, beta, C, offset_c, ld_c, stride_c, batch_count);
 }
 
 // gemm overload - batched with strided A
@@ -1174,9 +1200,10 @@ rocblas_status rocblasCall_gemm(rocblas_handle handle,
     ROCSOLVER_LAUNCH_KERNEL(get_array, dim3(blocks), dim3(256), 0, stream, work, A, stride_a,
                             batch_count);
 
-    return rocblas_internal_gemm_batched_template(
-        handle, trans_a, trans_b, m, n, k, alpha, cast2constType<T>(work), offset_a, ld_a, stride_a,
-        B, offset_b, ld_b, stride_b, beta, C, offset_c, ld_c, stride_c, batch_count);
+    return rocblas_internal_gemm_batched_template(rocsolver_blas_handle(handle), trans_a, trans_b,
+                                                  m, n, k, alpha, cast2constType<T>(work), offset_a,
+                                                  ld_a, stride_a, B, offset_b, ld_b, stride_b, beta,
+                                                  C, offset_c, ld_c, stride_c, batch_count);
 }
 
 // gemm overload - batched with strided B
@@ -1216,10 +1243,10 @@ rocblas_status rocblasCall_gemm(rocblas_handle handle,
     ROCSOLVER_LAUNCH_KERNEL(get_array, dim3(blocks), dim3(256), 0, stream, work, B, stride_b,
                             batch_count);
 
-    return rocblas_internal_gemm_batched_template(handle, trans_a, trans_b, m, n, k, alpha, A,
-                                                  offset_a, ld_a, stride_a, cast2constType<T>(work),
-                                                  offset_b, ld_b, stride_b, beta, C, offset_c, ld_c,
-                                                  stride_c, batch_count);
+    return rocblas_internal_gemm_batched_template(rocsolver_blas_handle(handle), trans_a, trans_b,
+                                                  m, n, k, alpha, A, offset_a, ld_a, stride_a,
+                                                  cast2constType<T>(work), offset_b, ld_b, stride_b,
+                                                  beta, C, offset_c, ld_c, stride_c, batch_count);
 }
 
 // gemm overload - batched with strided C
@@ -1260,8 +1287,9 @@ rocblas_status rocblasCall_gemm(rocblas_handle handle,
                             batch_count);
 
     return rocblas_internal_gemm_batched_template(
-        handle, trans_a, trans_b, m, n, k, alpha, A, offset_a, ld_a, stride_a, B, offset_b, ld_b,
-        stride_b, beta, cast2constPointer(work), offset_c, ld_c, stride_c, batch_count);
+        rocsolver_blas_handle(handle), trans_a, trans_b, m, n, k, alpha, A, offset_a, ld_a,
+        stride_a, B, offset_b, ld_b, stride_b, beta, cast2constPointer(work), offset_c, ld_c,
+        stride_c, batch_count);
 }
 
 // gemm overload - batched with strided B and C
@@ -1304,8 +1332,8 @@ rocblas_status rocblasCall_gemm(rocblas_handle handle,
                             stride_c, batch_count);
 
     return rocblas_internal_gemm_batched_template(
-        handle, trans_a, trans_b, m, n, k, alpha, A, offset_a, ld_a, stride_a,
-        cast2constType<T>(work), offset_b, ld_b, stride_b, beta,
+        rocsolver_blas_handle(handle), trans_a, trans_b, m, n, k, alpha, A, offset_a, ld_a,
+        stride_a, cast2constType<T>(work), offset_b, ld_b, stride_b, beta,
         cast2constPointer(work + batch_count), offset_c, ld_c, stride_c, batch_count);
 }
 
@@ -1349,9 +1377,9 @@ rocblas_status rocblasCall_gemm(rocblas_handle handle,
                             stride_c, batch_count);
 
     return rocblas_internal_gemm_batched_template(
-        handle, trans_a, trans_b, m, n, k, alpha, cast2constType<T>(work), offset_a, ld_a, stride_a,
-        B, offset_b, ld_b, stride_b, beta, cast2constPointer(work + batch_count), offset_c, ld_c,
-        stride_c, batch_count);
+        rocsolver_blas_handle(handle), trans_a, trans_b, m, n, k, alpha, cast2constType<T>(work),
+        offset_a, ld_a, stride_a, B, offset_b, ld_b, stride_b, beta,
+        cast2constPointer(work + batch_count), offset_c, ld_c, stride_c, batch_count);
 }
 
 // gemm overload - batched with strided A and B
@@ -1394,9 +1422,9 @@ rocblas_status rocblasCall_gemm(rocblas_handle handle,
                             stride_b, batch_count);
 
     return rocblas_internal_gemm_batched_template(
-        handle, trans_a, trans_b, m, n, k, alpha, cast2constType<T>(work), offset_a, ld_a, stride_a,
-        cast2constType<T>(work + batch_count), offset_b, ld_b, stride_b, beta, C, offset_c, ld_c,
-        stride_c, batch_count);
+        rocsolver_blas_handle(handle), trans_a, trans_b, m, n, k, alpha, cast2constType<T>(work),
+        offset_a, ld_a, stride_a, cast2constType<T>(work + batch_count), offset_b, ld_b, stride_b,
+        beta, C, offset_c, ld_c, stride_c, batch_count);
 }
 
 // trmm
@@ -1426,9 +1454,10 @@ rocblas_status rocblasCall_trmm(rocblas_handle handle,
                   "n:", n, "shiftA:", offsetA, "lda:", lda, "shiftB:", offsetB, "ldb:", ldb,
                   "bc:", batch_count);
 
-    return rocblas_internal_trmm_template(handle, side, uplo, transA, diag, m, n, alpha, stride_alpha,
-                                          A, offsetA, lda, strideA, cast2constType<T>(B), offsetB,
-                                          ldb, strideB, B, offsetB, ldb, strideB, batch_count);
+    return rocblas_internal_trmm_template(rocsolver_blas_handle(handle), side, uplo, transA, diag,
+                                          m, n, alpha, stride_alpha, A, offsetA, lda, strideA,
+                                          cast2constType<T>(B), offsetB, ldb, strideB, B, offsetB,
+                                          ldb, strideB, batch_count);
 }
 
 template <typename T>
@@ -1457,9 +1486,10 @@ rocblas_status rocblasCall_trmm(rocblas_handle handle,
                   "n:", n, "shiftA:", offsetA, "lda:", lda, "shiftB:", offsetB, "ldb:", ldb,
                   "bc:", batch_count);
 
-    return rocblas_internal_trmm_batched_template(
-        handle, side, uplo, transA, diag, m, n, alpha, stride_alpha, A, offsetA, lda, strideA,
-        cast2constType<T>(B), offsetB, ldb, strideB, B, offsetB, ldb, strideB, batch_count);
+    return rocblas_internal_trmm_batched_template(rocsolver_blas_handle(handle), side, uplo, transA,
+                                                  diag, m, n, alpha, stride_alpha, A, offsetA, lda,
+                                                  strideA, cast2constType<T>(B), offsetB, ldb,
+                                                  strideB, B, offsetB, ldb, strideB, batch_count);
 }
 
 // trmm overload
@@ -1497,9 +1527,9 @@ rocblas_status rocblasCall_trmm(rocblas_handle handle,
                             batch_count);
 
     return rocblas_internal_trmm_batched_template(
-        handle, side, uplo, transA, diag, m, n, alpha, stride_alpha, A, offsetA, lda, strideA,
-        cast2constType<T>(workArr), offsetB, ldb, strideB, cast2constPointer<T>(workArr), offsetB,
-        ldb, strideB, batch_count);
+        rocsolver_blas_handle(handle), side, uplo, transA, diag, m, n, alpha, stride_alpha, A,
+        offsetA, lda, strideA, cast2constType<T>(workArr), offsetB, ldb, strideB,
+        cast2constPointer<T>(workArr), offsetB, ldb, strideB, batch_count);
 }
 
 // syr2/her2
@@ -1529,13 +1559,13 @@ rocblas_status rocblasCall_syr2_her2(rocblas_handle handle,
                   "incy:", incy, "shiftA:", offsetA, "lda:", lda, "bc:", batch_count);
 
     if constexpr(!rocblas_is_complex<T>)
-        return rocblas_internal_syr2_template(handle, uplo, n, alpha, x, offsetx, incx, stridex, y,
-                                              offsety, incy, stridey, A, lda, offsetA, strideA,
-                                              batch_count);
+        return rocblas_internal_syr2_template(rocsolver_blas_handle(handle), uplo, n, alpha, x,
+                                              offsetx, incx, stridex, y, offsety, incy, stridey, A,
+                                              lda, offsetA, strideA, batch_count);
     else
-        return rocblas_internal_her2_template(handle, uplo, n, alpha, x, offsetx, incx, stridex, y,
-                                              offsety, incy, stridey, A, lda, offsetA, strideA,
-                                              batch_count);
+        return rocblas_internal_her2_template(rocsolver_blas_handle(handle), uplo, n, alpha, x,
+                                              offsetx, incx, stridex, y, offsety, incy, stridey, A,
+                                              lda, offsetA, strideA, batch_count);
 }
 
 // syr2/her2 batched
@@ -1565,13 +1595,13 @@ rocblas_status rocblasCall_syr2_her2(rocblas_handle handle,
                   "incy:", incy, "shiftA:", offsetA, "lda:", lda, "bc:", batch_count);
 
     if constexpr(!rocblas_is_complex<T>)
-        return rocblas_internal_syr2_batched_template(handle, uplo, n, alpha, x, offsetx, incx,
-                                                      stridex, y, offsety, incy, stridey, A, lda,
-                                                      offsetA, strideA, batch_count);
+        return rocblas_internal_syr2_batched_template(
+            rocsolver_blas_handle(handle), uplo, n, alpha, x, offsetx, incx, stridex, y, offsety,
+            incy, stridey, A, lda, offsetA, strideA, batch_count);
     else
-        return rocblas_internal_her2_batched_template(handle, uplo, n, alpha, x, offsetx, incx,
-                                                      stridex, y, offsety, incy, stridey, A, lda,
-                                                      offsetA, strideA, batch_count);
+        return rocblas_internal_her2_batched_template(
+            rocsolver_blas_handle(handle), uplo, n, alpha, x, offsetx, incx, stridex, y, offsety,
+            incy, stridey, A, lda, offsetA, strideA, batch_count);
 }
 
 // syr2/her2 overload - complex with strided y
@@ -1608,13 +1638,13 @@ rocblas_status rocblasCall_syr2_her2(rocblas_handle handle,
                             batch_count);
 
     if constexpr(!rocblas_is_complex<T>)
-        return rocblas_internal_syr2_batched_template(handle, uplo, n, alpha, x, offsetx, incx,
-                                                      stridex, work, offsety, incy, stridey, A, lda,
-                                                      offsetA, strideA, batch_count);
+        return rocblas_internal_syr2_batched_template(
+            rocsolver_blas_handle(handle), uplo, n, alpha, x, offsetx, incx, stridex, work, offsety,
+            incy, stridey, A, lda, offsetA, strideA, batch_count);
     else
-        return rocblas_internal_her2_batched_template(handle, uplo, n, alpha, x, offsetx, incx,
-                                                      stridex, work, offsety, incy, stridey, A, lda,
-                                                      offsetA, strideA, batch_count);
+        return rocblas_internal_her2_batched_template(
+            rocsolver_blas_handle(handle), uplo, n, alpha, x, offsetx, incx, stridex, work, offsety,
+            incy, stridey, A, lda, offsetA, strideA, batch_count);
 }
 
 // syrk
@@ -1644,12 +1674,14 @@ rocblas_status rocblasCall_syrk_herk(rocblas_handle handle,
 
     if constexpr(BATCHED)
         return rocblas_internal_syrk_batched_template(
-            handle, uplo, transA, n, k, cast2constType<S>(alpha), cast2constType<T>(A), offsetA,
-            lda, strideA, cast2constType<S>(beta), C, offsetC, ldc, strideC, batch_count);
+            rocsolver_blas_handle(handle), uplo, transA, n, k, cast2constType<S>(alpha),
+            cast2constType<T>(A), offsetA, lda, strideA, cast2constType<S>(beta), C, offsetC, ldc,
+            strideC, batch_count);
     else
-        return rocblas_internal_syrk_template(
-            handle, uplo, transA, n, k, cast2constType<S>(alpha), cast2constType<T>(A), offsetA,
-            lda, strideA, cast2constType<S>(beta), C, offsetC, ldc, strideC, batch_count);
+        return rocblas_internal_syrk_template(rocsolver_blas_handle(handle), uplo, transA, n, k,
+                                              cast2constType<S>(alpha), cast2constType<T>(A),
+                                              offsetA, lda, strideA, cast2constType<S>(beta), C,
+                                              offsetC, ldc, strideC, batch_count);
 }
 
 // herk
@@ -1679,12 +1711,14 @@ rocblas_status rocblasCall_syrk_herk(rocblas_handle handle,
 
     if constexpr(BATCHED)
         return rocblas_internal_herk_batched_template(
-            handle, uplo, transA, n, k, cast2constType<S>(alpha), cast2constType<T>(A), offsetA,
-            lda, strideA, cast2constType<S>(beta), C, offsetC, ldc, strideC, batch_count);
+            rocsolver_blas_handle(handle), uplo, transA, n, k, cast2constType<S>(alpha),
+            cast2constType<T>(A), offsetA, lda, strideA, cast2constType<S>(beta), C, offsetC, ldc,
+            strideC, batch_count);
     else
-        return rocblas_internal_herk_template(
-            handle, uplo, transA, n, k, cast2constType<S>(alpha), cast2constType<T>(A), offsetA,
-            lda, strideA, cast2constType<S>(beta), C, offsetC, ldc, strideC, batch_count);
+        return rocblas_internal_herk_template(rocsolver_blas_handle(handle), uplo, transA, n, k,
+                                              cast2constType<S>(alpha), cast2constType<T>(A),
+                                              offsetA, lda, strideA, cast2constType<S>(beta), C,
+                                              offsetC, ldc, strideC, batch_count);
 }
 
 // syr2k
@@ -1723,14 +1757,14 @@ rocblas_status rocblasCall_syr2k_her2k(rocblas_handle handle,
 
     if constexpr(BATCHED)
         return rocblas_internal_syr2k_batched_template(
-            handle, uplo, trans, n, k, cast2constType<T>(alpha), cast2constType<T>(A), offsetA, lda,
-            strideA, cast2constType<T>(B), offsetB, ldb, strideB, cast2constType<T>(beta), C,
-            offsetC, ldc, strideC, batch_count);
+            rocsolver_blas_handle(handle), uplo, trans, n, k, cast2constType<T>(alpha),
+            cast2constType<T>(A), offsetA, lda, strideA, cast2constType<T>(B), offsetB, ldb,
+            strideB, cast2constType<T>(beta), C, offsetC, ldc, strideC, batch_count);
     else
         return rocblas_internal_syr2k_template(
-            handle, uplo, trans, n, k, cast2constType<T>(alpha), cast2constType<T>(A), offsetA, lda,
-            strideA, cast2constType<T>(B), offsetB, ldb, strideB, cast2constType<T>(beta), C,
-            offsetC, ldc, strideC, batch_count);
+            rocsolver_blas_handle(handle), uplo, trans, n, k, cast2constType<T>(alpha),
+            cast2constType<T>(A), offsetA, lda, strideA, cast2constType<T>(B), offsetB, ldb,
+            strideB, cast2constType<T>(beta), C, offsetC, ldc, strideC, batch_count);
 }
 
 // syr2k overload
@@ -1771,14 +1805,58 @@ rocblas_status rocblasCall_syr2k_her2k(rocblas_handle handle,
 
     if constexpr(BATCHED)
         return rocblas_internal_syr2k_batched_template(
-            handle, uplo, trans, n, k, cast2constType<T>(alpha), cast2constType<T>(A), offsetA, lda,
-            strideA, cast2constType<T>(work), offsetB, ldb, strideB, cast2constType<T>(beta), C,
-            offsetC, ldc, strideC, batch_count);
+            rocsolver_blas_handle(handle), uplo, trans, n, k, cast2constType<T>(alpha),
+            cast2constType<T>(A), offsetA, lda, strideA, cast2constType<T>(work), offsetB, ldb,
+            strideB, cast2constType<T>(beta), C, offsetC, ldc, strideC, batch_count);
     else
         return rocblas_internal_syr2k_template(
-            handle, uplo, trans, n, k, cast2constType<T>(alpha), cast2constType<T>(A), offsetA, lda,
-            strideA, cast2constType<T>(work), offsetB, ldb, strideB, cast2constType<T>(beta), C,
-            offsetC, ldc, strideC, batch_count);
+            rocsolver_blas_handle(handle), uplo, trans, n, k, cast2constType<T>(alpha),
+            cast2constType<T>(A), offsetA, lda, strideA, cast2constType<T>(work), offsetB, ldb,
+            strideB, cast2constType<T>(beta), C, offsetC, ldc, strideC, batch_count);
+}
+
+// syr2k overload - batched with strided A and B
+template <bool BATCHED, typename T, typename Ua, typename Ub, std::enable_if_t<!rocblas_is_complex<T>, int> = 0>
+rocblas_status rocblasCall_syr2k_her2k(rocblas_handle handle,
+                                       rocblas_fill uplo,
+                                       rocblas_operation trans,
+                                       rocblas_int n,
+                                       rocblas_int k,
+                                       Ua alpha,
+                                       T* A,
+                                       rocblas_stride offsetA,
+                                       rocblas_int lda,
+                                       rocblas_stride strideA,
+                                       T* B,
+                                       rocblas_stride offsetB,
+                                       rocblas_int ldb,
+                                       rocblas_stride strideB,
+                                       Ub beta,
+                                       T* const C[],
+                                       rocblas_stride offsetC,
+                                       rocblas_int ldc,
+                                       rocblas_stride strideC,
+                                       rocblas_int batch_count,
+                                       T** work = nullptr)
+{
+    // TODO: How to get alpha and beta for trace logging
+    ROCBLAS_ENTER("syr2k", "uplo:", uplo, "trans:", trans, "n:", n, "k:", k, "shiftA:", offsetA,
+                  "lda:", lda, "shiftB:", offsetB, "ldb:", ldb, "shiftC:", offsetC, "ldc:", ldc,
+                  "bc:", batch_count);
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocks = (batch_count - 1) / 256 + 1;
+    ROCSOLVER_LAUNCH_KERNEL(get_array, dim3(blocks), dim3(256), 0, stream, work, A, strideA,
+                            batch_count);
+    ROCSOLVER_LAUNCH_KERNEL(get_array, dim3(blocks), dim3(256), 0, stream, work + batch_count, B,
+                            strideB, batch_count);
+
+    return rocblas_internal_syr2k_batched_template(
+        rocsolver_blas_handle(handle), uplo, trans, n, k, cast2constType<T>(alpha),
+        cast2constType<T>(work), offsetA, lda, strideA, cast2constType<T>(work + batch_count),
+        offsetB, ldb, strideB, cast2constType<T>(beta), C, offsetC, ldc, strideC, batch_count);
 }
 
 // her2k
@@ -1819,14 +1897,14 @@ rocblas_status rocblasCall_syr2k_her2k(rocblas_handle handle,
 
     if constexpr(BATCHED)
         return rocblas_internal_her2k_batched_template(
-            handle, uplo, trans, n, k, cast2constType<T>(alpha), cast2constType<T>(A), offsetA, lda,
-            strideA, cast2constType<T>(B), offsetB, ldb, strideB, cast2constType<S>(beta), C,
-            offsetC, ldc, strideC, batch_count);
+            rocsolver_blas_handle(handle), uplo, trans, n, k, cast2constType<T>(alpha),
+            cast2constType<T>(A), offsetA, lda, strideA, cast2constType<T>(B), offsetB, ldb,
+            strideB, cast2constType<S>(beta), C, offsetC, ldc, strideC, batch_count);
     else
         return rocblas_internal_her2k_template(
-            handle, uplo, trans, n, k, cast2constType<T>(alpha), cast2constType<T>(A), offsetA, lda,
-            strideA, cast2constType<T>(B), offsetB, ldb, strideB, cast2constType<S>(beta), C,
-            offsetC, ldc, strideC, batch_count);
+            rocsolver_blas_handle(handle), uplo, trans, n, k, cast2constType<T>(alpha),
+            cast2constType<T>(A), offsetA, lda, strideA, cast2constType<T>(B), offsetB, ldb,
+            strideB, cast2constType<S>(beta), C, offsetC, ldc, strideC, batch_count);
 }
 
 // her2k overload
@@ -1869,14 +1947,60 @@ rocblas_status rocblasCall_syr2k_her2k(rocblas_handle handle,
 
     if constexpr(BATCHED)
         return rocblas_internal_her2k_batched_template(
-            handle, uplo, trans, n, k, cast2constType<T>(alpha), cast2constType<T>(A), offsetA, lda,
-            strideA, cast2constType<T>(work), offsetB, ldb, strideB, cast2constType<S>(beta), C,
-            offsetC, ldc, strideC, batch_count);
+            rocsolver_blas_handle(handle), uplo, trans, n, k, cast2constType<T>(alpha),
+            cast2constType<T>(A), offsetA, lda, strideA, cast2constType<T>(work), offsetB, ldb,
+            strideB, cast2constType<S>(beta), C, offsetC, ldc, strideC, batch_count);
     else
         return rocblas_internal_her2k_template(
-            handle, uplo, trans, n, k, cast2constType<T>(alpha), cast2constType<T>(A), offsetA, lda,
-            strideA, cast2constType<T>(work), offsetB, ldb, strideB, cast2constType<S>(beta), C,
-            offsetC, ldc, strideC, batch_count);
+            rocsolver_blas_handle(handle), uplo, trans, n, k, cast2constType<T>(alpha),
+            cast2constType<T>(A), offsetA, lda, strideA, cast2constType<T>(work), offsetB, ldb,
+            strideB, cast2constType<S>(beta), C, offsetC, ldc, strideC, batch_count);
+}
+
+// her2k overload - batched with strided A and B
+template <bool BATCHED, typename T, typename Ua, typename Ub, std::enable_if_t<rocblas_is_complex<T>, int> = 0>
+rocblas_status rocblasCall_syr2k_her2k(rocblas_handle handle,
+                                       rocblas_fill uplo,
+                                       rocblas_operation trans,
+                                       rocblas_int n,
+                                       rocblas_int k,
+                                       Ua alpha,
+                                       T* A,
+                                       rocblas_stride offsetA,
+                                       rocblas_int lda,
+                                       rocblas_stride strideA,
+                                       T* B,
+                                       rocblas_stride offsetB,
+                                       rocblas_int ldb,
+                                       rocblas_stride strideB,
+                                       Ub beta,
+                                       T* const C[],
+                                       rocblas_stride offsetC,
+                                       rocblas_int ldc,
+                                       rocblas_stride strideC,
+                                       rocblas_int batch_count,
+                                       T** work = nullptr)
+{
+    // TODO: How to get alpha and beta for trace logging
+    ROCBLAS_ENTER("her2k", "uplo:", uplo, "trans:", trans, "n:", n, "k:", k, "shiftA:", offsetA,
+                  "lda:", lda, "shiftB:", offsetB, "ldb:", ldb, "shiftC:", offsetC, "ldc:", ldc,
+                  "bc:", batch_count);
+
+    using S = decltype(std::real(T{}));
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocks = (batch_count - 1) / 256 + 1;
+    ROCSOLVER_LAUNCH_KERNEL(get_array, dim3(blocks), dim3(256), 0, stream, work, A, strideA,
+                            batch_count);
+    ROCSOLVER_LAUNCH_KERNEL(get_array, dim3(blocks), dim3(256), 0, stream, work + batch_count, B,
+                            strideB, batch_count);
+
+    return rocblas_internal_her2k_batched_template(
+        rocsolver_blas_handle(handle), uplo, trans, n, k, cast2constType<T>(alpha),
+        cast2constType<T>(work), offsetA, lda, strideA, cast2constType<T>(work + batch_count),
+        offsetB, ldb, strideB, cast2constType<S>(beta), C, offsetC, ldc, strideC, batch_count);
 }
 
 // symv/hemv memory sizes
@@ -1917,13 +2041,13 @@ rocblas_status rocblasCall_symv_hemv(rocblas_handle handle,
                   "incx:", incx, "shiftY:", offsety, "incy:", incy, "bc:", batch_count);
 
     if constexpr(!rocblas_is_complex<T>)
-        return rocblas_internal_symv_template(handle, uplo, n, alpha, stridea, A, offsetA, lda,
-                                              strideA, x, offsetx, incx, stridex, beta, strideb, y,
-                                              offsety, incy, stridey, batch_count, work);
+        return rocblas_internal_symv_template(
+            rocsolver_blas_handle(handle), uplo, n, alpha, stridea, A, offsetA, lda, strideA, x,
+            offsetx, incx, stridex, beta, strideb, y, offsety, incy, stridey, batch_count, work);
     else
-        return rocblas_internal_hemv_template(handle, uplo, n, alpha, stridea, A, offsetA, lda,
-                                              strideA, x, offsetx, incx, stridex, beta, strideb, y,
-                                              offsety, incy, stridey, batch_count, work);
+        return rocblas_internal_hemv_template(
+            rocsolver_blas_handle(handle), uplo, n, alpha, stridea, A, offsetA, lda, strideA, x,
+            offsetx, incx, stridex, beta, strideb, y, offsety, incy, stridey, batch_count, work);
 }
 
 // symv/hemv batched
@@ -1958,12 +2082,12 @@ rocblas_status rocblasCall_symv_hemv(rocblas_handle handle,
 
     if constexpr(!rocblas_is_complex<T>)
         return rocblas_internal_symv_batched_template(
-            handle, uplo, n, alpha, stridea, A, offsetA, lda, strideA, x, offsetx, incx, stridex,
-            beta, strideb, y, offsety, incy, stridey, batch_count, work);
+            rocsolver_blas_handle(handle), uplo, n, alpha, stridea, A, offsetA, lda, strideA, x,
+            offsetx, incx, stridex, beta, strideb, y, offsety, incy, stridey, batch_count, work);
     else
         return rocblas_internal_hemv_batched_template(
-            handle, uplo, n, alpha, stridea, A, offsetA, lda, strideA, x, offsetx, incx, stridex,
-            beta, strideb, y, offsety, incy, stridey, batch_count, work);
+            rocsolver_blas_handle(handle), uplo, n, alpha, stridea, A, offsetA, lda, strideA, x,
+            offsetx, incx, stridex, beta, strideb, y, offsety, incy, stridey, batch_count, work);
 }
 
 // symv/hemv overload - batched with strided y
@@ -2004,15 +2128,15 @@ rocblas_status rocblasCall_symv_hemv(rocblas_handle handle,
                             batch_count);
 
     if constexpr(!rocblas_is_complex<T>)
-        return rocblas_internal_symv_batched_template(handle, uplo, n, alpha, stridea, A, offsetA,
-                                                      lda, strideA, x, offsetx, incx, stridex, beta,
-                                                      strideb, cast2constPointer<T>(workArr),
-                                                      offsety, incy, stridey, batch_count, work);
+        return rocblas_internal_symv_batched_template(
+            rocsolver_blas_handle(handle), uplo, n, alpha, stridea, A, offsetA, lda, strideA, x,
+            offsetx, incx, stridex, beta, strideb, cast2constPointer<T>(workArr), offsety, incy,
+            stridey, batch_count, work);
     else
-        return rocblas_internal_hemv_batched_template(handle, uplo, n, alpha, stridea, A, offsetA,
-                                                      lda, strideA, x, offsetx, incx, stridex, beta,
-                                                      strideb, cast2constPointer<T>(workArr),
-                                                      offsety, incy, stridey, batch_count, work);
+        return rocblas_internal_hemv_batched_template(
+            rocsolver_blas_handle(handle), uplo, n, alpha, stridea, A, offsetA, lda, strideA, x,
+            offsetx, incx, stridex, beta, strideb, cast2constPointer<T>(workArr), offsety, incy,
+            stridey, batch_count, work);
 }
 
 // symm/hemm
@@ -2036,7 +2160,8 @@ rocblas_status rocblasCall_symm_hemm(rocblas_handle handle,
                                      rocblas_stride offsetC,
                                      rocblas_int ldc,
                                      rocblas_stride strideC,
-                                     rocblas_int batch_count)
+                                     rocblas_int batch_count,
+                                     T** work = nullptr)
 {
     constexpr auto name = rocblas_is_complex<T> ? "hemm" : "symm";
     // TODO: How to get alpha and beta for trace logging
@@ -2045,13 +2170,13 @@ rocblas_status rocblasCall_symm_hemm(rocblas_handle handle,
                   "bc:", batch_count);
 
     if constexpr(!rocblas_is_complex<T>)
-        return rocblas_internal_symm_template(handle, side, uplo, m, n, alpha, A, offsetA, lda,
-                                              strideA, B, offsetB, ldb, strideB, beta, C, offsetC,
-                                              ldc, strideC, batch_count);
+        return rocblas_internal_symm_template(rocsolver_blas_handle(handle), side, uplo, m, n,
+                                              alpha, A, offsetA, lda, strideA, B, offsetB, ldb,
+                                              strideB, beta, C, offsetC, ldc, strideC, batch_count);
     else
-        return rocblas_internal_hemm_template(handle, side, uplo, m, n, alpha, A, offsetA, lda,
-                                              strideA, B, offsetB, ldb, strideB, beta, C, offsetC,
-                                              ldc, strideC, batch_count);
+        return rocblas_internal_hemm_template(rocsolver_blas_handle(handle), side, uplo, m, n,
+                                              alpha, A, offsetA, lda, strideA, B, offsetB, ldb,
+                                              strideB, beta, C, offsetC, ldc, strideC, batch_count);
 }
 
 // symm/hemm batched
@@ -2075,7 +2200,48 @@ rocblas_status rocblasCall_symm_hemm(rocblas_handle handle,
                                      rocblas_stride offsetC,
                                      rocblas_int ldc,
                                      rocblas_stride strideC,
-                                     rocblas_int batch_count)
+                                     rocblas_int batch_count,
+                                     T** work = nullptr)
+{
+    constexpr auto name = rocblas_is_complex<T> ? "hemm" : "symm";
+    // TODO: How to get alpha and beta for trace logging
+    ROCBLAS_ENTER(name, "side:", side, "uplo:", uplo, "m:", m, "n:", n, "shiftA:", offsetA,
+                  "lda:", lda, "shiftB:", offsetB, "ldb:", ldb, "shiftC:", offsetC, "ldc:", ldc,
+                  "bc:", batch_count);
+
+    if constexpr(!rocblas_is_complex<T>)
+        return rocblas_internal_symm_batched_template(
+            rocsolver_blas_handle(handle), side, uplo, m, n, alpha, A, offsetA, lda, strideA, B,
+            offsetB, ldb, strideB, beta, C, offsetC, ldc, strideC, batch_count);
+    else
+        return rocblas_internal_hemm_batched_template(
+            rocsolver_blas_handle(handle), side, uplo, m, n, alpha, A, offsetA, lda, strideA, B,
+            offsetB, ldb, strideB, beta, C, offsetC, ldc, strideC, batch_count);
+}
+
+// symm/hemm overload - batched with strided B and C
+template <typename T>
+rocblas_status rocblasCall_symm_hemm(rocblas_handle handle,
+                                     rocblas_side side,
+                                     rocblas_fill uplo,
+                                     rocblas_int m,
+                                     rocblas_int n,
+                                     const T* alpha,
+                                     const T* const* A,
+                                     rocblas_stride offsetA,
+                                     rocblas_int lda,
+                                     rocblas_stride strideA,
+                                     T* B,
+                                     rocblas_stride offsetB,
+                                     rocblas_int ldb,
+                                     rocblas_stride strideB,
+                                     const T* beta,
+                                     T* C,
+                                     rocblas_stride offsetC,
+                                     rocblas_int ldc,
+                                     rocblas_stride strideC,
+                                     rocblas_int batch_count,
+                                     T** work)
 {
     constexpr auto name = rocblas_is_complex<T> ? "hemm" : "symm";
     // TODO: How to get alpha and beta for trace logging
@@ -2083,14 +2249,25 @@ rocblas_status rocblasCall_symm_hemm(rocblas_handle handle,
                   "lda:", lda, "shiftB:", offsetB, "ldb:", ldb, "shiftC:", offsetC, "ldc:", ldc,
                   "bc:", batch_count);
 
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocks = (batch_count - 1) / 256 + 1;
+    ROCSOLVER_LAUNCH_KERNEL(get_array, dim3(blocks), dim3(256), 0, stream, work, B, strideB,
+                            batch_count);
+    ROCSOLVER_LAUNCH_KERNEL(get_array, dim3(blocks), dim3(256), 0, stream, work + batch_count, C,
+                            strideC, batch_count);
+
     if constexpr(!rocblas_is_complex<T>)
-        return rocblas_internal_symm_batched_template(handle, side, uplo, m, n, alpha, A, offsetA,
-                                                      lda, strideA, B, offsetB, ldb, strideB, beta,
-                                                      C, offsetC, ldc, strideC, batch_count);
+        return rocblas_internal_symm_batched_template(
+            rocsolver_blas_handle(handle), side, uplo, m, n, alpha, A, offsetA, lda, strideA,
+            cast2constType<T>(work), offsetB, ldb, strideB, beta,
+            cast2constPointer(work + batch_count), offsetC, ldc, strideC, batch_count);
     else
-        return rocblas_internal_hemm_batched_template(handle, side, uplo, m, n, alpha, A, offsetA,
-                                                      lda, strideA, B, offsetB, ldb, strideB, beta,
-                                                      C, offsetC, ldc, strideC, batch_count);
+        return rocblas_internal_hemm_batched_template(
+            rocsolver_blas_handle(handle), side, uplo, m, n, alpha, A, offsetA, lda, strideA,
+            cast2constType<T>(work), offsetB, ldb, strideB, beta,
+            cast2constPointer(work + batch_count), offsetC, ldc, strideC, batch_count);
 }
 
 // trsv
@@ -2116,8 +2293,9 @@ rocblas_status rocblasCall_trsv(rocblas_handle handle,
                   "shiftA:", offset_A, "lda:", lda, "shiftx:", offset_x, "incx:", incx,
                   "bc:", batch_count);
 
-    return rocblas_internal_trsv_template(handle, uplo, transA, diag, m, A, offset_A, lda, stride_A,
-                                          x, offset_x, incx, stride_x, batch_count, w_completed_sec);
+    return rocblas_internal_trsv_template(rocsolver_blas_handle(handle), uplo, transA, diag, m, A,
+                                          offset_A, lda, stride_A, x, offset_x, incx, stride_x,
+                                          batch_count, w_completed_sec);
 }
 
 // batched trsv
@@ -2143,9 +2321,44 @@ rocblas_status rocblasCall_trsv(rocblas_handle handle,
                   "shiftA:", offset_A, "lda:", lda, "shiftx:", offset_x, "incx:", incx,
                   "bc:", batch_count);
 
-    return rocblas_internal_trsv_batched_template(handle, uplo, transA, diag, m, A, offset_A, lda,
-                                                  stride_A, x, offset_x, incx, stride_x,
-                                                  batch_count, w_completed_sec);
+    return rocblas_internal_trsv_batched_template(rocsolver_blas_handle(handle), uplo, transA, diag,
+                                                  m, A, offset_A, lda, stride_A, x, offset_x, incx,
+                                                  stride_x, batch_count, w_completed_sec);
+}
+
+// batched trsv with strided x
+template <typename T>
+rocblas_status rocblasCall_trsv(rocblas_handle handle,
+                                rocblas_fill uplo,
+                                rocblas_operation transA,
+                                rocblas_diagonal diag,
+                                rocblas_int m,
+                                const T* const* A,
+                                rocblas_stride offset_A,
+                                rocblas_int lda,
+                                rocblas_stride stride_A,
+                                T* x,
+                                rocblas_stride offset_x,
+                                rocblas_int incx,
+                                rocblas_stride stride_x,
+                                rocblas_int batch_count,
+                                rocblas_int* w_completed_sec,
+                                T** workArr)
+{
+    ROCBLAS_ENTER("trsv", "uplo:", uplo, "trans:", transA, "diag:", diag, "m:", m,
+                  "shiftA:", offset_A, "lda:", lda, "shiftx:", offset_x, "incx:", incx,
+                  "bc:", batch_count);
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocks = (batch_count - 1) / 256 + 1;
+    ROCSOLVER_LAUNCH_KERNEL(get_array, dim3(blocks), dim3(256), 0, stream, workArr, x, stride_x,
+                            batch_count);
+
+    return rocblas_internal_trsv_batched_template(
+        rocsolver_blas_handle(handle), uplo, transA, diag, m, A, offset_A, lda, stride_A,
+        cast2constPointer<T>(workArr), offset_x, incx, stride_x, batch_count, w_completed_sec);
 }
 
 // trsm memory sizes
@@ -2224,15 +2437,15 @@ rocblas_status rocblasCall_trsm(rocblas_handle handle,
 
     const T* supplied_invA = nullptr;
     if constexpr(std::is_same<I, int64_t>::value)
-        return rocblas_internal_trsm_template_64(handle, side, uplo, transA, diag, m, n, alpha, A,
-                                                 offset_A, lda, stride_A, B, offset_B, ldb,
-                                                 stride_B, batch_count, optimal_mem, x_temp,
-                                                 x_temp_arr, invA, invA_arr, supplied_invA, 0);
+        return rocblas_internal_trsm_template_64(
+            rocsolver_blas_handle(handle), side, uplo, transA, diag, m, n, alpha, A, offset_A, lda,
+            stride_A, B, offset_B, ldb, stride_B, batch_count, optimal_mem, x_temp, x_temp_arr,
+            invA, invA_arr, supplied_invA, 0);
     else
-        return rocblas_internal_trsm_template(handle, side, uplo, transA, diag, m, n, alpha, A,
-                                              offset_A, lda, stride_A, B, offset_B, ldb, stride_B,
-                                              batch_count, optimal_mem, x_temp, x_temp_arr, invA,
-                                              invA_arr, supplied_invA, 0);
+        return rocblas_internal_trsm_template(rocsolver_blas_handle(handle), side, uplo, transA,
+                                              diag, m, n, alpha, A, offset_A, lda, stride_A, B,
+                                              offset_B, ldb, stride_B, batch_count, optimal_mem,
+                                              x_temp, x_temp_arr, invA, invA_arr, supplied_invA, 0);
 }
 
 // batched trsm
@@ -2269,14 +2482,14 @@ rocblas_status rocblasCall_trsm(rocblas_handle handle,
     const T* const* supplied_invA = nullptr;
     if constexpr(std::is_same<I, int64_t>::value)
         return rocblas_internal_trsm_batched_template_64(
-            handle, side, uplo, transA, diag, m, n, alpha, A, offset_A, lda, stride_A, B, offset_B,
-            ldb, stride_B, batch_count, optimal_mem, x_temp, x_temp_arr, invA, invA_arr,
-            supplied_invA, 0);
+            rocsolver_blas_handle(handle), side, uplo, transA, diag, m, n, alpha, A, offset_A, lda,
+            stride_A, B, offset_B, ldb, stride_B, batch_count, optimal_mem, x_temp, x_temp_arr,
+            invA, invA_arr, supplied_invA, 0);
     else
-        return rocblas_internal_trsm_batched_template(handle, side, uplo, transA, diag, m, n, alpha,
-                                                      A, offset_A, lda, stride_A, B, offset_B, ldb,
-                                                      stride_B, batch_count, optimal_mem, x_temp,
-                                                      x_temp_arr, invA, invA_arr, supplied_invA, 0);
+        return rocblas_internal_trsm_batched_template(
+            rocsolver_blas_handle(handle), side, uplo, transA, diag, m, n, alpha, A, offset_A, lda,
+            stride_A, B, offset_B, ldb, stride_B, batch_count, optimal_mem, x_temp, x_temp_arr,
+            invA, invA_arr, supplied_invA, 0);
 }
 
 // trsm overload
@@ -2322,14 +2535,14 @@ rocblas_status rocblasCall_trsm(rocblas_handle handle,
     U supplied_invA = nullptr;
     if constexpr(std::is_same<I, int64_t>::value)
         return rocblas_internal_trsm_batched_template_64(
-            handle, side, uplo, transA, diag, m, n, alpha, cast2constType((U)workArr), offset_A,
-            lda, stride_A, B, offset_B, ldb, stride_B, batch_count, optimal_mem, x_temp, x_temp_arr,
-            invA, invA_arr, supplied_invA, 0);
+            rocsolver_blas_handle(handle), side, uplo, transA, diag, m, n, alpha,
+            cast2constType((U)workArr), offset_A, lda, stride_A, B, offset_B, ldb, stride_B,
+            batch_count, optimal_mem, x_temp, x_temp_arr, invA, invA_arr, supplied_invA, 0);
     else
         return rocblas_internal_trsm_batched_template(
-            handle, side, uplo, transA, diag, m, n, alpha, cast2constType((U)workArr), offset_A,
-            lda, stride_A, B, offset_B, ldb, stride_B, batch_count, optimal_mem, x_temp, x_temp_arr,
-            invA, invA_arr, supplied_invA, 0);
+            rocsolver_blas_handle(handle), side, uplo, transA, diag, m, n, alpha,
+            cast2constType((U)workArr), offset_A, lda, stride_A, B, offset_B, ldb, stride_B,
+            batch_count, optimal_mem, x_temp, x_temp_arr, invA, invA_arr, supplied_invA, 0);
 }
 
 // trtri memory sizes
@@ -2364,9 +2577,9 @@ rocblas_status rocblasCall_trtri(rocblas_handle handle,
     ROCBLAS_ENTER("trtri", "uplo:", uplo, "diag:", diag, "n:", n, "shiftA:", offset_A, "lda:", lda,
                   "shiftC:", offset_invA, "ldc:", ldinvA, "bc:", batch_count);
 
-    return rocblas_internal_trtri_template(handle, uplo, diag, n, A, offset_A, lda, stride_A, 0,
-                                           invA, offset_invA, ldinvA, stride_invA, 0, batch_count,
-                                           1, c_temp);
+    return rocblas_internal_trtri_template(rocsolver_blas_handle(handle), uplo, diag, n, A,
+                                           offset_A, lda, stride_A, 0, invA, offset_invA, ldinvA,
+                                           stride_invA, 0, batch_count, 1, c_temp);
 }
 
 // batched trtri
@@ -2391,9 +2604,9 @@ rocblas_status rocblasCall_trtri(rocblas_handle handle,
     ROCBLAS_ENTER("trtri", "uplo:", uplo, "diag:", diag, "n:", n, "shiftA:", offset_A, "lda:", lda,
                   "shiftC:", offset_invA, "ldc:", ldinvA, "bc:", batch_count);
 
-    return rocblas_internal_trtri_batched_template(handle, uplo, diag, n, A, offset_A, lda,
-                                                   stride_A, 0, invA, offset_invA, ldinvA,
-                                                   stride_invA, 0, batch_count, 1, c_temp);
+    return rocblas_internal_trtri_batched_template(rocsolver_blas_handle(handle), uplo, diag, n, A,
+                                                   offset_A, lda, stride_A, 0, invA, offset_invA,
+                                                   ldinvA, stride_invA, 0, batch_count, 1, c_temp);
 }
 
 // trtri overload
@@ -2427,9 +2640,9 @@ rocblas_status rocblasCall_trtri(rocblas_handle handle,
     ROCSOLVER_LAUNCH_KERNEL(get_array, dim3(blocks), dim3(256), 0, stream, c_temp_arr, c_temp,
                             c_temp_els, batch_count);
 
-    return rocblas_internal_trtri_template(handle, uplo, diag, n, A, offset_A, lda, stride_A, 0,
-                                           invA, offset_invA, ldinvA, stride_invA, 0, batch_count,
-                                           1, cast2constPointer(c_temp_arr));
+    return rocblas_internal_trtri_template(
+        rocsolver_blas_handle(handle), uplo, diag, n, A, offset_A, lda, stride_A, 0, invA,
+        offset_invA, ldinvA, stride_invA, 0, batch_count, 1, cast2constPointer(c_temp_arr));
 }
 
 // trtri overload
@@ -2466,8 +2679,9 @@ rocblas_status rocblasCall_trtri(rocblas_handle handle,
                             c_temp_els, batch_count);
 
     return rocblas_internal_trtri_batched_template(
-        handle, uplo, diag, n, A, offset_A, lda, stride_A, 0, cast2constPointer(workArr),
-        offset_invA, ldinvA, stride_invA, 0, batch_count, 1, cast2constPointer(c_temp_arr));
+        rocsolver_blas_handle(handle), uplo, diag, n, A, offset_A, lda, stride_A, 0,
+        cast2constPointer(workArr), offset_invA, ldinvA, stride_invA, 0, batch_count, 1,
+        cast2constPointer(c_temp_arr));
 }
 
 ROCSOLVER_END_NAMESPACE
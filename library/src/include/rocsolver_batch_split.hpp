@@ -0,0 +1,127 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <rocblas/rocblas.h>
+
+#include "ideal_sizes.hpp"
+#include "lib_host_helpers.hpp"
+#include "rocsolver_streams.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/** Returns the number of internal streams among which a batch of batch_count problems is split,
+    given the number of streams requested by the tuning of the routine. Every sub-batch has at
+    least BATCH_STREAMS_MIN_COUNT problems, and at most ROCSOLVER_MAX_BATCH_STREAMS are used. **/
+template <typename I>
+I rocsolver_batch_streams(const I requested, const I batch_count)
+{
+    I k = std::min(requested, batch_count / I(BATCH_STREAMS_MIN_COUNT));
+    k = std::min(k, I(ROCSOLVER_MAX_BATCH_STREAMS));
+    return std::max(k, I(1));
+}
+
+/** Returns the number of problems of each sub-batch (the last one can be smaller) **/
+template <typename I>
+I rocsolver_split_count(const I batch_count, const I nstreams)
+{
+    return (batch_count - 1) / nstreams + 1;
+}
+
+/** Rounds up the sizes of the workspace arrays of a sub-batch when the batch is split, so that
+    the region of every sub-batch is as aligned as the arrays given by rocblas_device_malloc **/
+template <typename I, typename... Sizes>
+void rocsolver_split_align(const I nstreams, Sizes&... sizes)
+{
+    constexpr size_t align = 256;
+    if(nstreams > 1)
+        ((sizes = (sizes + align - 1) / align * align), ...);
+}
+
+/** Executes a batch of batch_count problems as nstreams contiguous sub-batches of
+    rocsolver_split_count problems. sub(k, first, count) enqueues the work of the k-th sub-batch
+    (problems first to first + count - 1) on the stream of the handle; it must use its own region
+    of the workspace. The sub-batches are executed concurrently on internal streams that are forked
+    from and joined to the stream of the handle with events; if the streams or the events are not
+    available, they are executed one after the other on the stream of the handle. **/
+template <typename I, typename F>
+rocblas_status rocsolver_split_batch(rocblas_handle handle,
+                                     const I batch_count,
+                                     const I nstreams,
+                                     const F& sub)
+{
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // events to fork the internal streams from the stream of the handle (events[nstreams]),
+    // and to join them back (events[k])
+    // (NOTE: hipEventDestroy is deferred until the events have completed)
+    hipStream_t streams[ROCSOLVER_MAX_BATCH_STREAMS];
+    hipEvent_t events[ROCSOLVER_MAX_BATCH_STREAMS + 1];
+    I nevents = 0;
+    if(nstreams > 1 && rocsolver_get_batch_streams(handle, nstreams, streams) == hipSuccess)
+    {
+        while(nevents <= nstreams
+              && hipEventCreateWithFlags(&events[nevents], hipEventDisableTiming) == hipSuccess)
+            nevents++;
+    }
+    const bool concurrent = (nevents == nstreams + 1);
+
+    if(concurrent)
+        hipEventRecord(events[nstreams], stream);
+
+    rocblas_status status = rocblas_status_success;
+    const I count = rocsolver_split_count(batch_count, nstreams);
+    for(I k = 0, first = 0; first < batch_count; ++k, first += count)
+    {
+        if(concurrent)
+        {
+            hipStreamWaitEvent(streams[k], events[nstreams], 0);
+            rocblas_set_stream(handle, streams[k]);
+        }
+
+        rocblas_status st = sub(k, first, std::min(count, batch_count - first));
+        if(status == rocblas_status_success)
+            status = st;
+
+        if(concurrent)
+        {
+            hipEventRecord(events[k], streams[k]);
+            rocblas_set_stream(handle, stream);
+            hipStreamWaitEvent(stream, events[k], 0);
+        }
+    }
+
+    for(I e = 0; e < nevents; ++e)
+        hipEventDestroy(events[e]);
+
+    return status;
+}
+
+ROCSOLVER_END_NAMESPACE
@@ -0,0 +1,97 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "lib_host_helpers.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/***************************************************************************
+ * Persistent cache. The run-time compiled kernels, the tuning tables and the
+ * memoized workspace sizes can be kept on disk, so that later processes (or
+ * other processes running at the same time on the node) start with them
+ * instead of computing them again. The cache directory is given by the
+ * environment variable ROCSOLVER_CACHE_PATH (by default,
+ * $XDG_CACHE_HOME/rocsolver or $HOME/.cache/rocsolver); setting it to an
+ * empty string disables the cache. Its layout is:
+ *
+ *     <arch>/tuning                 tuning tables for the architecture, in the
+ *                                   format of ROCSOLVER_TUNING_PATH
+ *     <arch>/<versions>/jit/        code objects of the run-time compiled kernels
+ *     <arch>/<versions>/workspace   memoized workspace sizes
+ *
+ * where <arch> is the architecture of the device (e.g. gfx90a_xnack-), and
+ * <versions> identifies the versions of rocSOLVER, rocBLAS and the HIP runtime
+ * that produced the entries.
+ *
+ * Files are replaced atomically (they are written to a temporary file that is
+ * then renamed), and entries that are computed by more than one process are
+ * guarded with advisory file locks. The cache is not available on Windows.
+ ***************************************************************************/
+
+/** ROCSOLVER_CACHE_LOCK holds an advisory lock on the given file (which is created
+    if needed) for its lifetime. **/
+class rocsolver_cache_lock
+{
+private:
+    int fd;
+
+public:
+    rocsolver_cache_lock(const std::string& path, const bool exclusive);
+    ~rocsolver_cache_lock();
+
+    rocsolver_cache_lock(const rocsolver_cache_lock&) = delete;
+    rocsolver_cache_lock& operator=(const rocsolver_cache_lock&) = delete;
+
+    bool locked() const
+    {
+        return fd >= 0;
+    }
+};
+
+// returns the architecture of the given device (e.g. gfx90a:xnack-), or an empty string
+std::string rocsolver_device_arch(const int device);
+
+// returns the directory of the entries of the given device that do not depend on the
+// library versions (versioned = false) or that do (versioned = true), creating it if
+// needed; an empty string is returned if the cache is disabled
+std::string rocsolver_cache_dir(const int device, const bool versioned);
+
+// reads the whole file; returns false if it does not exist or is empty
+bool rocsolver_cache_read(const std::string& path, std::vector<char>& data);
+
+// replaces the file atomically with the given data
+bool rocsolver_cache_write(const std::string& path, const std::vector<char>& data);
+
+// appends a line to the file, under an exclusive lock
+bool rocsolver_cache_append(const std::string& path, const std::string& line);
+
+ROCSOLVER_END_NAMESPACE
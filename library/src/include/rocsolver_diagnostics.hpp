@@ -0,0 +1,116 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+#pragma once
+
+#include <rocblas/rocblas.h>
+
+#include "lib_device_helpers.hpp"
+#include "lib_host_helpers.hpp"
+#include "rocsolver/rocsolver.h"
+#include "rocsolver_logger.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/***************************************************************************
+ * Returns the diagnostics buffer registered with rocsolver_set_diagnostics
+ * for the given handle, or nullptr if there is none or if it cannot hold
+ * batch_count records.
+ ***************************************************************************/
+rocsolver_diagnostics* get_diagnostics(rocblas_handle handle, const rocblas_int batch_count);
+
+// drops the buffer registered for the handle (see rocsolver_release_handle)
+void release_diagnostics(rocblas_handle handle);
+
+/** DIAGNOSTICS_ADD adds the given number of iterations and deflations to the
+    record. (Several thread groups can work on the same problem, so the
+    counters are updated atomically) **/
+__device__ inline void diagnostics_add(rocsolver_diagnostics* diag,
+                                       const rocblas_int iterations,
+                                       const rocblas_int deflations)
+{
+    if(diag)
+    {
+        atomicAdd(&diag->iterations, iterations);
+        atomicAdd(&diag->deflations, deflations);
+    }
+}
+
+/** DIAGNOSTICS_RESET_KERNEL zeroes the records of the batch **/
+ROCSOLVER_KERNEL void diagnostics_reset_kernel(rocsolver_diagnostics* diag,
+                                               const rocblas_int batch_count)
+{
+    rocblas_int b = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(b < batch_count)
+        diag[b] = rocsolver_diagnostics{};
+}
+
+/** DIAGNOSTICS_MARK_KERNEL marks the beginning (or the end) of the given stage
+    by subtracting (or adding) the current device time from (to) the stage
+    time of the records of the batch. (The kernel is launched in stream order
+    between the kernels of the stages) **/
+ROCSOLVER_KERNEL void diagnostics_mark_kernel(rocsolver_diagnostics* diag,
+                                              const rocblas_int batch_count,
+                                              const rocblas_int stage,
+                                              const bool begin)
+{
+    rocblas_int b = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    int64_t ticks = wall_clock64();
+
+    if(b < batch_count)
+        diag[b].stage_ticks[stage] += begin ? -ticks : ticks;
+}
+
+template <typename T>
+void diagnostics_reset(hipStream_t stream,
+                       rocsolver_diagnostics* diag,
+                       const rocblas_int batch_count)
+{
+    if(diag)
+    {
+        rocblas_int blocks = (batch_count - 1) / BS1 + 1;
+        ROCSOLVER_LAUNCH_KERNEL(diagnostics_reset_kernel, dim3(blocks), dim3(BS1), 0, stream, diag,
+                                batch_count);
+    }
+}
+
+template <typename T>
+void diagnostics_mark(hipStream_t stream,
+                      rocsolver_diagnostics* diag,
+                      const rocblas_int batch_count,
+                      const rocblas_int stage,
+                      const bool begin)
+{
+    if(diag)
+    {
+        rocblas_int blocks = (batch_count - 1) / BS1 + 1;
+        ROCSOLVER_LAUNCH_KERNEL(diagnostics_mark_kernel, dim3(blocks), dim3(BS1), 0, stream, diag,
+                                batch_count, stage, begin);
+    }
+}
+
+ROCSOLVER_END_NAMESPACE
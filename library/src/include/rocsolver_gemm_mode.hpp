@@ -0,0 +1,60 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <rocblas/rocblas.h>
+
+#include "lib_host_helpers.hpp"
+#include "rocsolver/rocsolver.h"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+// number of handles whose complex GEMMs use the 3M method, so that the handles
+// with the default mode do not need to look up their setting
+extern std::atomic<int> num_gemm_3m_handles;
+
+bool get_gemm_mode_3m(rocblas_handle handle);
+
+// drops the setting of the handle (see rocsolver_release_handle)
+void release_gemm_mode(rocblas_handle handle);
+
+/***************************************************************************
+ * Returns true if the large complex GEMMs of the functions called with the
+ * given handle are computed with the 3M method, as selected with
+ * rocsolver_set_gemm_mode (see rocsolver_gemm_3m). The handle must not be
+ * null.
+ ***************************************************************************/
+inline bool gemm_3m_enabled(rocblas_handle handle)
+{
+    if(num_gemm_3m_handles.load(std::memory_order_relaxed) == 0)
+        return false;
+    return get_gemm_mode_3m(handle);
+}
+
+ROCSOLVER_END_NAMESPACE
@@ -0,0 +1,115 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include <rocblas/rocblas.h>
+
+#include "lib_host_helpers.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/***************************************************************************
+ * hipBLASLt backend for the trailing-matrix updates. When the library is
+ * built with BUILD_WITH_HIPBLASLT (which defines HAVE_HIPBLASLT), the
+ * non-batched and strided_batched real GEMMs with a small inner dimension
+ * and a large outer one (the updates of the trailing matrix after a panel,
+ * with k = block size, as in GETRF or LARFB) are computed with hipBLASLt,
+ * whose solution selection includes stream-K kernels for these skinny
+ * shapes. All the other GEMMs, and all of them if the environment variable
+ * ROCSOLVER_HIPBLASLT is set to 0, are computed with rocBLAS.
+ ***************************************************************************/
+
+// the complex precisions and the builds without hipBLASLt always use rocBLAS
+template <typename T>
+inline bool rocsolver_hipblaslt_gemm(rocblas_handle handle,
+                                     rocblas_operation trans_a,
+                                     rocblas_operation trans_b,
+                                     rocblas_int m,
+                                     rocblas_int n,
+                                     rocblas_int k,
+                                     const T* alpha,
+                                     const T* A,
+                                     rocblas_int ld_a,
+                                     rocblas_stride stride_a,
+                                     const T* B,
+                                     rocblas_int ld_b,
+                                     rocblas_stride stride_b,
+                                     const T* beta,
+                                     T* C,
+                                     rocblas_int ld_c,
+                                     rocblas_stride stride_c,
+                                     rocblas_int batch_count)
+{
+    return false;
+}
+
+#ifdef HAVE_HIPBLASLT
+
+// computes C = alpha * op(A) * op(B) + beta * C with hipBLASLt; returns false (without
+// doing anything) if the GEMM must be computed with rocBLAS instead
+ROCSOLVER_MODULE_VISIBLE bool rocsolver_hipblaslt_gemm(rocblas_handle handle,
+                                                       rocblas_operation trans_a,
+                                                       rocblas_operation trans_b,
+                                                       rocblas_int m,
+                                                       rocblas_int n,
+                                                       rocblas_int k,
+                                                       const float* alpha,
+                                                       const float* A,
+                                                       rocblas_int ld_a,
+                                                       rocblas_stride stride_a,
+                                                       const float* B,
+                                                       rocblas_int ld_b,
+                                                       rocblas_stride stride_b,
+                                                       const float* beta,
+                                                       float* C,
+                                                       rocblas_int ld_c,
+                                                       rocblas_stride stride_c,
+                                                       rocblas_int batch_count);
+
+ROCSOLVER_MODULE_VISIBLE bool rocsolver_hipblaslt_gemm(rocblas_handle handle,
+                                                       rocblas_operation trans_a,
+                                                       rocblas_operation trans_b,
+                                                       rocblas_int m,
+                                                       rocblas_int n,
+                                                       rocblas_int k,
+                                                       const double* alpha,
+                                                       const double* A,
+                                                       rocblas_int ld_a,
+                                                       rocblas_stride stride_a,
+                                                       const double* B,
+                                                       rocblas_int ld_b,
+                                                       rocblas_stride stride_b,
+                                                       const double* beta,
+                                                       double* C,
+                                                       rocblas_int ld_c,
+                                                       rocblas_stride stride_c,
+                                                       rocblas_int batch_count);
+
+#endif
+
+ROCSOLVER_END_NAMESPACE
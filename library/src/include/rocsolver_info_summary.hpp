@@ -0,0 +1,138 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <rocblas/rocblas.h>
+
+#include "rocsolver/rocsolver.h"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/***************************************************************************
+ * Writes the summary of the info array of a call (and of the number of
+ * sweeps and the residuals of the Jacobi functions, if given) to the buffer
+ * registered with rocsolver_set_info_summary for the handle (if any), and
+ * queues the callback set with rocsolver_set_info_callback after it.
+ ***************************************************************************/
+void rocsolver_info_summarize(rocblas_handle handle,
+                              const void* info,
+                              const bool info64,
+                              const int64_t batch_count,
+                              const rocblas_int* n_sweeps,
+                              const void* residual,
+                              const bool residual64);
+
+// drops the buffer and the callback registered for the handle (see rocsolver_release_handle)
+void release_info_summary(rocblas_handle handle);
+
+/***************************************************************************
+ * The rocsolver_info_summary_scope struct summarizes the info array of a
+ * top-level (i.e. impl) function upon exiting it, after all the work of the
+ * function has been enqueued in the stream of the handle. Only the calls
+ * whose execution succeeded are summarized: the impl functions return the
+ * status of their template through commit(), so that the summary (and the
+ * callback) are skipped on the argument-checking, memory-query and
+ * memory-error paths, where the info array has not been written.
+ ***************************************************************************/
+struct rocsolver_info_summary_scope
+{
+    rocblas_handle handle;
+    const void* info;
+    bool info64;
+    int64_t batch_count;
+    const rocblas_int* n_sweeps = nullptr;
+    const void* residual = nullptr;
+    bool residual64 = false;
+    bool armed = false;
+
+    rocsolver_info_summary_scope(rocblas_handle handle,
+                                 const rocblas_int* info,
+                                 int64_t batch_count)
+        : handle(handle)
+        , info(info)
+        , info64(false)
+        , batch_count(batch_count)
+    {
+    }
+
+    rocsolver_info_summary_scope(rocblas_handle handle,
+                                 const int64_t* info,
+                                 int64_t batch_count)
+        : handle(handle)
+        , info(info)
+        , info64(true)
+        , batch_count(batch_count)
+    {
+    }
+
+    // adds the number of sweeps and the residuals of the Jacobi functions to the summary
+    void set_sweeps(const rocblas_int* sweeps, const float* res)
+    {
+        n_sweeps = sweeps;
+        residual = res;
+        residual64 = false;
+    }
+
+    void set_sweeps(const rocblas_int* sweeps, const double* res)
+    {
+        n_sweeps = sweeps;
+        residual = res;
+        residual64 = true;
+    }
+
+    // arms the summary if the execution succeeded; returns the given status
+    rocblas_status commit(rocblas_status status)
+    {
+        armed = (status == rocblas_status_success);
+        return status;
+    }
+
+    // Copy constructor is deleted
+    rocsolver_info_summary_scope(const rocsolver_info_summary_scope&) = delete;
+
+    // Destructor
+    ~rocsolver_info_summary_scope()
+    {
+        if(armed && handle && info && batch_count > 0)
+            rocsolver_info_summarize(handle, info, info64, batch_count, n_sweeps, residual,
+                                     residual64);
+    }
+
+    // Assignment operator is deleted
+    rocsolver_info_summary_scope& operator=(const rocsolver_info_summary_scope&) = delete;
+};
+
+#define ROCSOLVER_INFO_SUMMARY(info, batch_count) \
+    rocsolver_info_summary_scope _info_summary_scope(handle, info, batch_count)
+
+#define ROCSOLVER_INFO_SUMMARY_SWEEPS(info, batch_count, n_sweeps, residual) \
+    ROCSOLVER_INFO_SUMMARY(info, batch_count);                              \
+    _info_summary_scope.set_sweeps(n_sweeps, residual)
+
+ROCSOLVER_END_NAMESPACE
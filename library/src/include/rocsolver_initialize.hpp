@@ -0,0 +1,86 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include <rocblas/rocblas.h>
+
+#include "lib_host_helpers.hpp"
+#include "rocsolver/rocsolver.h"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/***************************************************************************
+ * Public functions executed by the warm-up and the plans, for each precision
+ ***************************************************************************/
+
+template <typename T>
+struct warmup_api;
+
+#define WARMUP_API(T, S, t, syevd_name)                                                  \
+    template <>                                                                          \
+    struct warmup_api<T>                                                                 \
+    {                                                                                    \
+        using real_t = S;                                                                \
+        static constexpr auto getrf = rocsolver_##t##getrf;                              \
+        static constexpr auto getrf_sb = rocsolver_##t##getrf_strided_batched;           \
+        static constexpr auto getrs = rocsolver_##t##getrs;                              \
+        static constexpr auto getrs_sb = rocsolver_##t##getrs_strided_batched;           \
+        static constexpr auto potrf = rocsolver_##t##potrf;                              \
+        static constexpr auto potrf_sb = rocsolver_##t##potrf_strided_batched;           \
+        static constexpr auto potrs = rocsolver_##t##potrs;                              \
+        static constexpr auto potrs_sb = rocsolver_##t##potrs_strided_batched;           \
+        static constexpr auto geqrf = rocsolver_##t##geqrf;                              \
+        static constexpr auto geqrf_sb = rocsolver_##t##geqrf_strided_batched;           \
+        static constexpr auto gesv = rocsolver_##t##gesv;                                \
+        static constexpr auto gesv_sb = rocsolver_##t##gesv_strided_batched;             \
+        static constexpr auto posv = rocsolver_##t##posv;                                \
+        static constexpr auto posv_sb = rocsolver_##t##posv_strided_batched;             \
+        static constexpr auto syevd = rocsolver_##syevd_name;                            \
+        static constexpr auto syevd_sb = rocsolver_##syevd_name##_strided_batched;       \
+        static constexpr auto gesvd = rocsolver_##t##gesvd;                              \
+        static constexpr auto gesvd_sb = rocsolver_##t##gesvd_strided_batched;           \
+        static constexpr auto bdsqr = rocsolver_##t##bdsqr;                              \
+    }
+
+WARMUP_API(float, float, s, ssyevd);
+WARMUP_API(double, double, d, dsyevd);
+WARMUP_API(rocblas_float_complex, float, c, cheevd);
+WARMUP_API(rocblas_double_complex, double, z, zheevd);
+
+#undef WARMUP_API
+
+// implementations of rocsolver_initialize and rocsolver_get_workspace_size
+rocblas_status rocsolver_initialize_impl(rocblas_handle handle,
+                                        const rocsolver_problem_shape* shapes,
+                                        const rocblas_int count);
+
+rocblas_status rocsolver_get_workspace_size_impl(rocblas_handle handle,
+                                                 const rocsolver_problem_shape* shape,
+                                                 size_t* size);
+
+ROCSOLVER_END_NAMESPACE
@@ -0,0 +1,62 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include <string>
+
+#include <hip/hip_runtime.h>
+
+#include "lib_host_helpers.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/***************************************************************************
+ * Run-time compiled kernels. When the library is built with
+ * ROCSOLVER_JIT_KERNELS, some of the kernels for small sizes are also
+ * available as source code that is compiled with hipRTC, the first time it
+ * is needed, for the exact size in use. The size is then a compile-time
+ * constant, so that the loops can be fully unrolled and the tiles of the
+ * matrix kept in registers.
+ *
+ * The code objects are kept in memory for the lifetime of the process, and
+ * they are also kept in the persistent cache (see rocsolver_cache.hpp), so
+ * that later processes only need to load them. Setting ROCSOLVER_JIT to 0
+ * disables the run-time compiled kernels; the launchers then use the
+ * precompiled kernels.
+ ***************************************************************************/
+
+// returns true if the run-time compiled kernels can be used
+bool rocsolver_jit_enabled();
+
+// returns the kernel with the given (extern "C") name compiled from source for the
+// current device, compiling it on first use; key identifies the source for the
+// caches, and nullptr is returned if the kernel cannot be compiled or loaded
+hipFunction_t
+    rocsolver_jit_kernel(const std::string& key, const char* name, const std::string& source);
+
+ROCSOLVER_END_NAMESPACE
@@ -32,6 +32,7 @@
 #include <fmt/ranges.h>
 #include <forward_list>
 #include <fstream>
+#include <iterator>
 #include <memory>
 #include <mutex>
 #include <tuple>
@@ -42,15 +43,34 @@
 #include "lib_host_helpers.hpp"
 #include "rocsolver/rocsolver.h"
 #include "rocsolver_datatype2string.hpp"
+#include "rocsolver_info_summary.hpp"
 #include "rocsolver_logvalue.hpp"
+#include "rocsolver_roctx.hpp"
+#include "rocsolver_stats.hpp"
+#include "rocsolver_thread_mode.hpp"
 
 ROCSOLVER_BEGIN_NAMESPACE
 
+// maximum number of exited function calls whose profile or timeline events are kept in flight;
+// when it is reached, the oldest half of the events (most likely completed) is resolved
+#ifndef ROCSOLVER_LOG_MAX_PENDING_EVENTS
+#define ROCSOLVER_LOG_MAX_PENDING_EVENTS 4096
+#endif
+
+// size (in bytes) from which the trace and bench records buffered by a host thread are written
+// to the output streams
+#ifndef ROCSOLVER_LOG_BUFFER_SIZE
+#define ROCSOLVER_LOG_BUFFER_SIZE 65536
+#endif
+
 /***************************************************************************
  * rocSOLVER logging macros
  ***************************************************************************/
 
 #define ROCSOLVER_ENTER_TOP(name, ...)                                                      \
+    rocsolver_thread_scope _thread_scope(handle);                                           \
+    rocsolver_stats_scope _stats_scope(handle);                                             \
+    ROCSOLVER_ROCTX_RANGE("rocsolver", name, true);                                         \
     std::unique_ptr<rocsolver_logger::scope_guard<T>> _log_token;                           \
     do                                                                                      \
     {                                                                                       \
@@ -62,6 +82,7 @@ ROCSOLVER_BEGIN_NAMESPACE
         }                                                                                   \
     } while(0)
 #define ROCSOLVER_ENTER(name, ...)                                                              \
+    ROCSOLVER_ROCTX_RANGE("rocsolver", name, false);                                            \
     std::unique_ptr<rocsolver_logger::scope_guard<T>> _log_token;                               \
     do                                                                                          \
     {                                                                                           \
@@ -72,6 +93,8 @@ ROCSOLVER_BEGIN_NAMESPACE
         }                                                                                       \
     } while(0)
 #define ROCBLAS_ENTER(name, ...)                                                              \
+    rocsolver_stats_rocblas_call();                                                           \
+    ROCSOLVER_ROCTX_RANGE("rocblas", name, false);                                            \
     std::unique_ptr<rocsolver_logger::scope_guard<T>> _log_token;                             \
     do                                                                                        \
     {                                                                                         \
@@ -84,6 +107,7 @@ ROCSOLVER_BEGIN_NAMESPACE
 #define ROCSOLVER_LAUNCH_KERNEL(name, ...)                                                          \
     do                                                                                              \
     {                                                                                               \
+        rocsolver_stats_kernel_launch();                                                            \
         std::unique_ptr<rocsolver_logger::scope_guard<T>> _kernel_log_token;                        \
         if(rocsolver_logger::is_logging_enabled() && rocsolver_logger::is_kernel_logging_enabled()) \
         {                                                                                           \
@@ -92,21 +116,59 @@ ROCSOLVER_BEGIN_NAMESPACE
         }                                                                                           \
         hipLaunchKernelGGL((name), __VA_ARGS__);                                                    \
     } while(0)
+#define ROCSOLVER_LAUNCH_COOPERATIVE_KERNEL(status, name, ...)                                      \
+    do                                                                                              \
+    {                                                                                               \
+        rocsolver_stats_kernel_launch();                                                            \
+        std::unique_ptr<rocsolver_logger::scope_guard<T>> _kernel_log_token;                        \
+        if(rocsolver_logger::is_logging_enabled() && rocsolver_logger::is_kernel_logging_enabled()) \
+        {                                                                                           \
+            rocsolver_logger::instance()->log_enter<T>(handle, nullptr, #name);                     \
+            _kernel_log_token = std::make_unique<rocsolver_logger::scope_guard<T>>(false, handle);  \
+        }                                                                                           \
+        status = hipLaunchCooperativeKernel((name), __VA_ARGS__);                                   \
+    } while(0)
+#define ROCSOLVER_LAUNCH_MODULE_KERNEL(status, name, kernel, ...)                                  \
+    do                                                                                              \
+    {                                                                                               \
+        rocsolver_stats_kernel_launch();                                                            \
+        std::unique_ptr<rocsolver_logger::scope_guard<T>> _kernel_log_token;                        \
+        if(rocsolver_logger::is_logging_enabled() && rocsolver_logger::is_kernel_logging_enabled()) \
+        {                                                                                           \
+            rocsolver_logger::instance()->log_enter<T>(handle, nullptr, name);                      \
+            _kernel_log_token = std::make_unique<rocsolver_logger::scope_guard<T>>(false, handle);  \
+        }                                                                                           \
+        status = hipModuleLaunchKernel((kernel), __VA_ARGS__);                                      \
+    } while(0)
 
 /***************************************************************************
- * The rocsolver_log_entry struct records function data for trace and
- * profile logging purposes.
+ * The rocsolver_log_entry struct records function data for trace, profile
+ * and timeline logging purposes.
  ***************************************************************************/
 struct rocsolver_log_entry
 {
     std::vector<std::string> callers;
     std::string name;
     int level;
-    double start_time;
+    // events recorded on the handle's stream when profile or timeline logging is enabled
+    hipEvent_t start_event;
+    hipEvent_t stop_event;
+    hipStream_t stream;
+    // timeline category ("rocsolver", "rocblas" or "kernel")
+    const char* category;
+    // true if the elapsed time must be added to the profile
+    bool profiled;
+    // peak workspace of the enclosing top-level call when the function exited, in bytes
+    size_t workspace;
 
     rocsolver_log_entry()
         : level(0)
-        , start_time(0)
+        , start_event(nullptr)
+        , stop_event(nullptr)
+        , stream(nullptr)
+        , category("kernel")
+        , profiled(false)
+        , workspace(0)
     {
     }
 
@@ -130,12 +192,15 @@ struct rocsolver_profile_entry
     int level;
     int calls;
     double time;
+    // high-water mark of the workspace of the calls, in bytes
+    size_t workspace;
     std::unique_ptr<rocsolver_profile_map> internal_calls;
 
     rocsolver_profile_entry()
         : level(0)
         , calls(0)
         , time(0)
+        , workspace(0)
     {
     }
 
@@ -146,21 +211,56 @@ struct rocsolver_profile_entry
     rocsolver_profile_entry(const rocsolver_profile_entry&) = delete;
 };
 
+/***************************************************************************
+ * The rocsolver_log_thread struct holds the logging data of a host thread,
+ * so that the threads that call rocSOLVER do not contend for a global lock.
+ ***************************************************************************/
+struct rocsolver_log_thread
+{
+    // guards the data of the thread; it is only contended when the data of
+    // all the threads is collected (e.g. by rocsolver_log_write_profile)
+    std::mutex mtx;
+    // profile logging data keyed by function name
+    rocsolver_profile_map profile;
+    // function call stack keyed by handle
+    std::unordered_map<rocblas_handle, std::vector<rocsolver_log_entry>> call_stack;
+    // exited function calls whose events have not been resolved yet
+    std::vector<rocsolver_log_entry> pending_events;
+    // pool of hip events available for profile and timeline logging
+    std::vector<hipEvent_t> free_events;
+    // trace tree of the current top-level function call
+    std::string trace_str;
+    // trace and bench records not yet written to the output streams
+    std::string trace_buffer;
+    std::string bench_buffer;
+};
+
 /***************************************************************************
  * The rocsolver_logger class provides functions to be called upon entering
  * or exiting a function that will output multi-level logging information.
  ***************************************************************************/
-class rocsolver_logger
+class ROCSOLVER_MODULE_VISIBLE rocsolver_logger
 {
 private:
     // static singleton instance
     static rocsolver_logger* _instance;
-    // static mutex for multithreading
+    // static mutex for the set-up of the logger and the list of threads
     static std::mutex _mutex;
-    // profile logging data keyed by function name
-    rocsolver_profile_map profile;
-    // function call stack keyed by handle
-    std::unordered_map<rocblas_handle, std::vector<rocsolver_log_entry>> call_stack;
+    // static mutex for writing to the output streams
+    static std::mutex _output_mutex;
+    // unique id of the logging session
+    uint64_t session_id;
+    // logging data of every host thread that has called rocSOLVER during the session
+    std::vector<std::shared_ptr<rocsolver_log_thread>> threads;
+    // timeline logging is enabled for the whole session when ROCSOLVER_LOG_TIMELINE_PATH is set
+    bool timeline_enabled;
+    // event recorded before the first timeline span; timestamps are relative to it
+    hipEvent_t timeline_origin;
+    std::once_flag timeline_origin_flag;
+    // number of trace events written to the timeline stream
+    size_t timeline_count;
+    // timeline thread ids keyed by stream
+    std::unordered_map<hipStream_t, int> timeline_tids;
     // the maximum depth at which nested function calls will appear in the log
     int max_levels;
     // layer mode enum describing which logging facilities are enabled
@@ -169,22 +269,48 @@ private:
     std::ostream* trace_os;
     std::ostream* bench_os;
     std::ostream* profile_os;
+    std::ostream* timeline_os;
     std::forward_list<std::ofstream> file_streams;
-    std::string trace_str;
 
     // returns a unique_ptr to a file stream or a given default stream
     std::ostream* open_log_stream(const char* environment_variable);
 
+    // returns the logging data of the calling host thread
+    rocsolver_log_thread& thread_data();
+
     // returns a log entry on the call stack
-    rocsolver_log_entry& push_log_entry(rocblas_handle handle, std::string&& name);
-    rocsolver_log_entry& peek_log_entry(rocblas_handle handle);
-    rocsolver_log_entry pop_log_entry(rocblas_handle handle);
+    rocsolver_log_entry&
+        push_log_entry(rocsolver_log_thread& data, rocblas_handle handle, std::string&& name);
+    rocsolver_log_entry& peek_log_entry(rocsolver_log_thread& data, rocblas_handle handle);
+    rocsolver_log_entry pop_log_entry(rocsolver_log_thread& data, rocblas_handle handle);
+
+    // returns an event from the pool, or creates a new one if the pool is empty
+    hipEvent_t acquire_event(rocsolver_log_thread& data);
+    // returns the events of a log entry to the pool
+    void release_events(rocsolver_log_thread& data, rocsolver_log_entry& entry);
+    // waits for the first count pending events (or all of them if count = 0), adds their
+    // elapsed times to the profile and writes their spans to the timeline
+    void resolve_events(rocsolver_log_thread& data, size_t count = 0);
+    // destroys all the events in the pool
+    void destroy_events(rocsolver_log_thread& data);
+
+    // writes the buffered records to the given output stream
+    void write_buffer(std::string& buffer, std::ostream* os);
+
+    // writes a complete event (a span) in Chrome trace format to the timeline stream
+    // (must be called while holding the output lock)
+    void append_timeline(const rocsolver_log_entry& entry, float start_ms, float time_ms);
 
     // prints the results of profile logging
     void append_profile(std::string& str,
                         rocsolver_profile_map::iterator start,
                         rocsolver_profile_map::iterator end);
 
+    // resolves the events and writes the buffered records of all the threads, and prints the
+    // profile logging data merged from all the threads (clearing it if requested)
+    // (must be called while holding the global lock)
+    void write_profile(bool clear);
+
     // combines a function prefix and name into an std::string
     template <typename T>
     std::string get_func_name(const char* func_prefix, const char* func_name)
@@ -204,16 +330,25 @@ private:
 
     // outputs bench logging
     template <typename T, typename... Ts>
-    void log_bench(int level, const char* func_prefix, const char* func_name, Ts... args)
+    void log_bench(rocsolver_log_thread& data,
+                   int level,
+                   const char* func_prefix,
+                   const char* func_name,
+                   Ts... args)
     {
-        fmt::print(*bench_os, "./rocsolver-bench -f {} -r {} {}\n", func_name,
-                   rocblas2char_precision<T>, fmt::join(std::tie(args...), " "));
-        bench_os->flush();
+        fmt::format_to(std::back_inserter(data.bench_buffer), "./rocsolver-bench -f {} -r {} {}\n",
+                       func_name, rocblas2char_precision<T>, fmt::join(std::tie(args...), " "));
+        if(data.bench_buffer.size() >= ROCSOLVER_LOG_BUFFER_SIZE)
+            write_buffer(data.bench_buffer, bench_os);
     }
 
     // outputs trace logging
     template <typename T, typename... Ts>
-    void log_trace(int level, const char* func_prefix, const char* func_name, Ts... args)
+    void log_trace(rocsolver_log_thread& data,
+                   int level,
+                   const char* func_prefix,
+                   const char* func_name,
+                   Ts... args)
     {
         constexpr int shift_width = 4;
         int indent_level = level - 1;
@@ -224,45 +359,54 @@ private:
             std::string pairs;
             pairs_to_string(pairs, ", ", args...);
 
-            trace_str += fmt::format("{: <{}}{} ({})\n", "", indent,
-                                     get_template_name(func_prefix, func_name), pairs);
+            data.trace_str += fmt::format("{: <{}}{} ({})\n", "", indent,
+                                          get_template_name(func_prefix, func_name), pairs);
         }
         else
         {
-            trace_str
+            data.trace_str
                 += fmt::format("{: <{}}{}\n", "", indent, get_template_name(func_prefix, func_name));
         }
     }
 
-    // populates profile logging data with information from call_stack
-    template <typename T>
-    void log_profile(rocblas_handle handle, rocsolver_log_entry& from_stack)
+    // records the start event of a function call on the handle's stream
+    // (must be called while holding the lock of the thread)
+    void record_start(rocsolver_log_thread& data, rocblas_handle handle, rocsolver_log_entry& entry)
     {
-        hipStream_t stream;
-        rocblas_get_stream(handle, &stream);
-        double time = get_time_us_sync(stream) - from_stack.start_time;
-
-        const std::lock_guard<std::mutex> lock(rocsolver_logger::_mutex);
-
-        rocsolver_profile_map* map = &profile;
-        for(const std::string& caller_name : from_stack.callers)
+        rocblas_get_stream(handle, &entry.stream);
+        if(timeline_enabled)
         {
-            rocsolver_profile_entry& entry = (*map)[caller_name];
-            if(!entry.internal_calls)
-                entry.internal_calls = std::make_unique<rocsolver_profile_map>();
-            map = entry.internal_calls.get();
+            std::call_once(timeline_origin_flag, [&] {
+                hipEventCreate(&timeline_origin);
+                hipEventRecord(timeline_origin, entry.stream);
+            });
         }
-
-        rocsolver_profile_entry& from_profile = (*map)[from_stack.name];
-        from_profile.name = from_stack.name;
-        from_profile.level = from_stack.level;
-        from_profile.calls++;
-        from_profile.time += time;
+        entry.start_event = acquire_event(data);
+        hipEventRecord(entry.start_event, entry.stream);
     }
 
-    static std::unique_lock<std::mutex> acquire_lock()
+    // records the stop event of a function call and queues the entry; the elapsed time is
+    // added to the profile logging data (and the span is written to the timeline) once the
+    // events are resolved, so that the stream is never synchronized while the function calls
+    // are being logged (must be called while holding the lock of the thread)
+    void record_stop(rocsolver_log_thread& data, rocsolver_log_entry& entry, bool profile_enabled)
     {
-        return std::unique_lock<std::mutex>(rocsolver_logger::_mutex);
+        // profile logging could have been enabled after entering the function
+        entry.profiled = profile_enabled && entry.level > 0;
+        entry.workspace = rocsolver_current_stats.stats.workspace_size;
+        if(!entry.start_event || !(entry.profiled || timeline_enabled))
+        {
+            release_events(data, entry);
+            return;
+        }
+
+        entry.stop_event = acquire_event(data);
+        hipEventRecord(entry.stop_event, entry.stream);
+        data.pending_events.push_back(std::move(entry));
+
+        // bound the number of events in flight
+        if(data.pending_events.size() >= ROCSOLVER_LOG_MAX_PENDING_EVENTS)
+            resolve_events(data, ROCSOLVER_LOG_MAX_PENDING_EVENTS / 2);
     }
 
 public:
@@ -276,9 +420,10 @@ public:
     static __forceinline__ bool is_logging_enabled()
     {
         return (rocsolver_logger::_instance != nullptr)
-            && (rocsolver_logger::_instance->layer_mode
-                & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
-                   | rocblas_layer_mode_log_profile));
+            && ((rocsolver_logger::_instance->layer_mode
+                 & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
+                    | rocblas_layer_mode_log_profile))
+                || rocsolver_logger::_instance->timeline_enabled);
     }
 
     // returns true if logging facilities are enabled for kernels
@@ -295,36 +440,41 @@ public:
                              const char* func_name,
                              Ts... args)
     {
-        auto lock = acquire_lock();
-        auto entry = push_log_entry(handle, get_func_name<T>(func_prefix, func_name));
-        bool bench_enabled = layer_mode & rocblas_layer_mode_log_bench;
-        bool trace_enabled = layer_mode & rocblas_layer_mode_log_trace;
-        lock.unlock();
-        ROCSOLVER_ASSUME(entry.level == 0);
+        rocsolver_log_thread& data = thread_data();
+        std::lock_guard<std::mutex> lock(data.mtx);
+        auto& entry = push_log_entry(data, handle, get_func_name<T>(func_prefix, func_name));
+        int level = entry.level;
+        if(func_prefix)
+            entry.category = func_prefix;
+        if(timeline_enabled)
+            record_start(data, handle, entry);
+        ROCSOLVER_ASSUME(level == 0);
 
-        if(bench_enabled)
-            log_bench<T>(entry.level, func_prefix, func_name, rocsolver_make_logvalue(args)...);
+        if(layer_mode & rocblas_layer_mode_log_bench)
+            log_bench<T>(data, level, func_prefix, func_name, rocsolver_make_logvalue(args)...);
 
-        if(trace_enabled)
-            trace_str += fmt::format("------- ENTER {} trace tree -------\n", entry.name);
+        if(layer_mode & rocblas_layer_mode_log_trace)
+            data.trace_str += fmt::format("------- ENTER {} trace tree -------\n", entry.name);
     }
 
     // logging function to be called before exiting a top-level (i.e. impl) function
     template <typename T>
     void log_exit_top_level(rocblas_handle handle)
     {
-        auto lock = acquire_lock();
-        auto entry = pop_log_entry(handle);
-        bool trace_enabled = layer_mode & rocblas_layer_mode_log_trace;
-        lock.unlock();
+        rocsolver_log_thread& data = thread_data();
+        std::lock_guard<std::mutex> lock(data.mtx);
+        auto entry = pop_log_entry(data, handle);
+        std::string name = entry.name;
         ROCSOLVER_ASSUME(entry.level == 0);
+        record_stop(data, entry, false);
 
-        if(trace_enabled)
+        if(layer_mode & rocblas_layer_mode_log_trace)
         {
-            trace_str += fmt::format("------- EXIT {} trace tree -------\n\n", entry.name);
-            *trace_os << trace_str;
-            trace_str.clear();
-            trace_os->flush();
+            data.trace_str += fmt::format("------- EXIT {} trace tree -------\n\n", name);
+            data.trace_buffer += data.trace_str;
+            data.trace_str.clear();
+            if(data.trace_buffer.size() >= ROCSOLVER_LOG_BUFFER_SIZE)
+                write_buffer(data.trace_buffer, trace_os);
         }
     }
 
@@ -332,26 +482,27 @@ public:
     template <typename T, typename... Ts>
     void log_enter(rocblas_handle handle, const char* func_prefix, const char* func_name, Ts... args)
     {
-        auto lock = acquire_lock();
-        auto entry = push_log_entry(handle, get_template_name(func_prefix, func_name));
-        bool trace_enabled = layer_mode & rocblas_layer_mode_log_trace && entry.level <= max_levels;
-        lock.unlock();
+        rocsolver_log_thread& data = thread_data();
+        std::lock_guard<std::mutex> lock(data.mtx);
+        auto& entry = push_log_entry(data, handle, get_template_name(func_prefix, func_name));
+        int level = entry.level;
+        if(func_prefix)
+            entry.category = func_prefix;
+        if(layer_mode & rocblas_layer_mode_log_profile || timeline_enabled)
+            record_start(data, handle, entry);
 
-        if(trace_enabled)
-            log_trace<T>(entry.level, func_prefix, func_name, rocsolver_make_logvalue(args)...);
+        if(layer_mode & rocblas_layer_mode_log_trace && level <= max_levels)
+            log_trace<T>(data, level, func_prefix, func_name, rocsolver_make_logvalue(args)...);
     }
 
     // logging function to be called before exiting a sub-level (i.e. template) function
     template <typename T>
     void log_exit(rocblas_handle handle)
     {
-        auto lock = acquire_lock();
-        auto entry = pop_log_entry(handle);
-        bool profile_enabled = layer_mode & rocblas_layer_mode_log_profile;
-        lock.unlock();
-
-        if(profile_enabled)
-            log_profile<T>(handle, entry);
+        rocsolver_log_thread& data = thread_data();
+        std::lock_guard<std::mutex> lock(data.mtx);
+        auto entry = pop_log_entry(data, handle);
+        record_stop(data, entry, layer_mode & rocblas_layer_mode_log_profile);
     }
 
     /***************************************************************************
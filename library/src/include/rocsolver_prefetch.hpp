@@ -0,0 +1,147 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <hip/hip_runtime.h>
+#include <type_traits>
+
+#include "lib_host_helpers.hpp"
+#include "rocsolver_alg_mode.hpp"
+#include "rocsolver_streams.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/***************************************************************************
+ * The managed_prefetch class streams the block columns of a matrix in managed
+ * memory between the host and the device during the blocked factorizations,
+ * when rocsolver_alg_mode_prefetch is selected for the function. The
+ * prefetches are issued on the side stream, so that the next block column is
+ * migrated while the current one is being processed (instead of being paged
+ * in by faults), and the completed block columns are migrated back to the
+ * host once the stream of the handle has finished with them.
+ *
+ * It is only active for a single matrix (batch_count = 1) with unit row
+ * increment, allocated in managed memory, and outside stream capture;
+ * otherwise, all the methods do nothing.
+ ***************************************************************************/
+class managed_prefetch
+{
+private:
+    char* A = nullptr;
+    size_t col_bytes = 0;
+    size_t ncols = 0;
+    int device = 0;
+    hipStream_t stream = nullptr;
+    hipStream_t pstream = nullptr;
+    hipEvent_t done = nullptr;
+
+    size_t bytes(size_t j0, size_t j1) const
+    {
+        return (std::min(j1, ncols) - j0) * col_bytes;
+    }
+
+public:
+    template <typename I, typename U>
+    managed_prefetch(rocblas_handle handle,
+                     const rocsolver_function func,
+                     U AA,
+                     const rocblas_stride shiftA,
+                     const I inca,
+                     const I lda,
+                     const I n,
+                     const I batch_count)
+    {
+        // (the batched versions, with arrays of pointers, are not supported)
+        using T = std::remove_pointer_t<U>;
+        if constexpr(!std::is_pointer_v<T>)
+        {
+            if(batch_count != 1 || inca != 1 || n == 0
+               || get_alg_mode(handle, func) != rocsolver_alg_mode_prefetch)
+                return;
+
+            T* ptr = AA + shiftA;
+            hipPointerAttribute_t attr;
+            if(hipPointerGetAttributes(&attr, ptr) != hipSuccess)
+            {
+                // clear the error raised by unregistered pointers
+                (void)hipGetLastError();
+                return;
+            }
+            rocblas_get_stream(handle, &stream);
+            if(attr.type != hipMemoryTypeManaged || stream_is_capturing(stream))
+                return;
+
+            if(hipGetDevice(&device) != hipSuccess
+               || rocsolver_get_side_stream(handle, &pstream) != hipSuccess
+               || hipEventCreateWithFlags(&done, hipEventDisableTiming) != hipSuccess)
+                return;
+
+            A = reinterpret_cast<char*>(ptr);
+            col_bytes = sizeof(T) * size_t(lda);
+            ncols = n;
+        }
+    }
+
+    managed_prefetch(const managed_prefetch&) = delete;
+    managed_prefetch& operator=(const managed_prefetch&) = delete;
+
+    // (hipEventDestroy is deferred until the event has completed)
+    ~managed_prefetch()
+    {
+        if(done)
+            (void)hipEventDestroy(done);
+    }
+
+    explicit operator bool() const
+    {
+        return A != nullptr;
+    }
+
+    /** Migrates the columns j0 to j1-1 to the device ahead of their use. **/
+    void to_device(size_t j0, size_t j1)
+    {
+        if(!A || j0 >= ncols)
+            return;
+        (void)hipMemPrefetchAsync(A + j0 * col_bytes, bytes(j0, j1), device, pstream);
+    }
+
+    /** Migrates the columns j0 to j1-1 to the host after the work queued so far on the stream
+        of the handle (which must not access them anymore) has completed. **/
+    void to_host(size_t j0, size_t j1)
+    {
+        if(!A || j0 >= ncols)
+            return;
+        if(hipEventRecord(done, stream) != hipSuccess
+           || hipStreamWaitEvent(pstream, done, 0) != hipSuccess)
+            return;
+        (void)hipMemPrefetchAsync(A + j0 * col_bytes, bytes(j0, j1), hipCpuDeviceId, pstream);
+    }
+};
+
+ROCSOLVER_END_NAMESPACE
@@ -0,0 +1,108 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include <string>
+
+#include "lib_host_helpers.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/***************************************************************************
+ * roctx range instrumentation. When the library is built with
+ * BUILD_WITH_ROCTX (which defines HAVE_ROCTX), the logging hook points
+ * ROCSOLVER_ENTER_TOP, ROCSOLVER_ENTER and ROCBLAS_ENTER also push a roctx
+ * range for the duration of the function, so that the rocSOLVER call tree
+ * appears in rocprof and omnitrace timelines. The ranges are only pushed if
+ * the environment variable ROCSOLVER_ROCTX is set to a non-zero value;
+ * otherwise their cost is a single branch.
+ ***************************************************************************/
+#ifdef HAVE_ROCTX
+
+// returns true if the environment variable ROCSOLVER_ROCTX enables the ranges
+// (it is only read once)
+ROCSOLVER_MODULE_VISIBLE bool rocsolver_roctx_enabled();
+
+ROCSOLVER_MODULE_VISIBLE void rocsolver_roctx_push(const std::string& message);
+ROCSOLVER_MODULE_VISIBLE void rocsolver_roctx_pop();
+
+struct rocsolver_roctx_range
+{
+    bool active;
+
+    // range names follow the function names of the logger (e.g. rocsolver_dgetrf for
+    // top-level functions and rocsolver_getf2_template for sub-level functions)
+    rocsolver_roctx_range(const char* func_prefix,
+                          char precision,
+                          const char* func_name,
+                          bool top_level)
+        : active(rocsolver_roctx_enabled())
+    {
+        if(!active)
+            return;
+
+        std::string message(func_prefix);
+        message += '_';
+        if(top_level)
+        {
+            if(precision)
+                message += precision;
+            message += func_name;
+        }
+        else
+        {
+            message += func_name;
+            message += "_template";
+        }
+        rocsolver_roctx_push(message);
+    }
+
+    // Copy constructor is deleted
+    rocsolver_roctx_range(const rocsolver_roctx_range&) = delete;
+
+    // Destructor
+    ~rocsolver_roctx_range()
+    {
+        if(active)
+            rocsolver_roctx_pop();
+    }
+
+    // Assignment operator is deleted
+    rocsolver_roctx_range& operator=(const rocsolver_roctx_range&) = delete;
+};
+
+#define ROCSOLVER_ROCTX_RANGE(prefix, name, top_level) \
+    rocsolver_roctx_range _roctx_range(prefix, rocblas2char_precision<T>, name, top_level)
+
+#else
+
+#define ROCSOLVER_ROCTX_RANGE(prefix, name, top_level)
+
+#endif
+
+ROCSOLVER_END_NAMESPACE
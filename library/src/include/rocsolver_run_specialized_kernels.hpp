@@ -1,5 +1,5 @@
 /* **************************************************************************
- * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions
@@ -27,8 +27,11 @@
 
 #pragma once
 
+#include <limits>
+
 #include "rocblas.hpp"
 #include "rocsolver/rocsolver.h"
+#include "rocsolver_gemm_mode.hpp"
 
 ROCSOLVER_BEGIN_NAMESPACE
 
@@ -150,6 +153,45 @@ rocblas_status rocsolver_trsm_upper(rocblas_handle handle,
                                     void* work3,
                                     void* work4);
 
+template <bool BATCHED, bool STRIDED, typename T, typename I>
+rocblas_status rocsolver_trsm_left_invdiag_mem(const rocblas_operation trans,
+                                               const I m,
+                                               const I n,
+                                               const I batch_count,
+                                               size_t* size_work1,
+                                               size_t* size_work2,
+                                               size_t* size_work3,
+                                               size_t* size_work4,
+                                               bool* optim_mem,
+                                               const I lda = 1,
+                                               const I ldb = 1,
+                                               const I inca = 1,
+                                               const I incb = 1);
+
+template <bool BATCHED, bool STRIDED, typename T, typename I, typename U>
+rocblas_status rocsolver_trsm_left_invdiag(rocblas_handle handle,
+                                           const rocblas_fill uplo,
+                                           const rocblas_operation trans,
+                                           const rocblas_diagonal diag,
+                                           const I m,
+                                           const I n,
+                                           U A,
+                                           const rocblas_stride shiftA,
+                                           const I inca,
+                                           const I lda,
+                                           const rocblas_stride strideA,
+                                           U B,
+                                           const rocblas_stride shiftB,
+                                           const I incb,
+                                           const I ldb,
+                                           const rocblas_stride strideB,
+                                           const I batch_count,
+                                           const bool optim_mem,
+                                           void* work1,
+                                           void* work2,
+                                           void* work3,
+                                           void* work4);
+
 // gemm
 template <bool BATCHED, bool STRIDED, typename T, typename I, typename U>
 rocblas_status rocsolver_gemm(rocblas_handle handle,
@@ -202,6 +244,111 @@ rocblas_status rocsolver_gemm(rocblas_handle handle,
                               I batch_count,
                               T** work);
 
+// small batched gemm
+template <typename T, typename I, typename U1, typename U2, typename U3>
+rocblas_status rocsolver_gemm_small(rocblas_handle handle,
+                                    rocblas_operation transA,
+                                    rocblas_operation transB,
+                                    I m,
+                                    I n,
+                                    I k,
+                                    const T* alpha,
+                                    U1 A,
+                                    rocblas_stride shiftA,
+                                    I lda,
+                                    rocblas_stride strideA,
+                                    U2 B,
+                                    rocblas_stride shiftB,
+                                    I ldb,
+                                    rocblas_stride strideB,
+                                    const T* beta,
+                                    U3 C,
+                                    rocblas_stride shiftC,
+                                    I ldc,
+                                    rocblas_stride strideC,
+                                    I batch_count);
+
+// returns true if a GEMM is computed with rocsolver_gemm_small
+template <typename I>
+inline bool rocsolver_use_gemm_small(I m, I n, I k, I batch_count)
+{
+    return batch_count > 1 && m <= GEMM_SMALL_MAX_SIZE && n <= GEMM_SMALL_MAX_SIZE
+        && k <= GEMM_SMALL_MAX_SIZE;
+}
+
+// complex gemm with the 3M method
+template <typename T, typename U1, typename U2, typename U3>
+bool rocsolver_gemm_3m(rocblas_handle handle,
+                       rocblas_operation transA,
+                       rocblas_operation transB,
+                       rocblas_int m,
+                       rocblas_int n,
+                       rocblas_int k,
+                       const T* alpha,
+                       U1 A,
+                       rocblas_stride shiftA,
+                       rocblas_int lda,
+                       rocblas_stride strideA,
+                       U2 B,
+                       rocblas_stride shiftB,
+                       rocblas_int ldb,
+                       rocblas_stride strideB,
+                       const T* beta,
+                       U3 C,
+                       rocblas_stride shiftC,
+                       rocblas_int ldc,
+                       rocblas_stride strideC,
+                       rocblas_int batch_count);
+
+// returns true if a complex GEMM should be computed with rocsolver_gemm_3m
+// (with the 64-bit API, only if all the sizes fit in rocblas_int, as rocsolver_gemm_3m and its
+// real GEMMs use the 32-bit API)
+template <typename T, typename I>
+inline bool rocsolver_use_gemm_3m(rocblas_handle handle,
+                                  I m,
+                                  I n,
+                                  I k,
+                                  I lda,
+                                  I ldb,
+                                  I ldc,
+                                  I batch_count)
+{
+    if constexpr(rocblas_is_complex<T>)
+    {
+        if constexpr(!std::is_same<I, rocblas_int>::value)
+        {
+            constexpr I max = std::numeric_limits<rocblas_int>::max();
+            if(m > max || n > max || k > max || lda > max || ldb > max || ldc > max
+               || batch_count > max)
+                return false;
+        }
+
+        return m >= GEMM_3M_MIN_SIZE && n >= GEMM_3M_MIN_SIZE && k >= GEMM_3M_MIN_K
+            && !rocblas_is_device_memory_size_query(handle) && gemm_3m_enabled(handle);
+    }
+    else
+        return false;
+}
+
+// syrk/herk
+template <bool BATCHED, bool STRIDED, typename T, typename I, typename S, typename U>
+rocblas_status rocsolver_syrk_herk(rocblas_handle handle,
+                                   rocblas_fill uplo,
+                                   rocblas_operation transA,
+                                   I n,
+                                   I k,
+                                   const S* alpha,
+                                   U A,
+                                   rocblas_stride shiftA,
+                                   I lda,
+                                   rocblas_stride strideA,
+                                   const S* beta,
+                                   U C,
+                                   rocblas_stride shiftC,
+                                   I ldc,
+                                   rocblas_stride strideC,
+                                   I batch_count);
+
 // ger
 template <bool CONJ, typename T, typename I, typename U>
 rocblas_status rocsolver_ger(rocblas_handle handle,
@@ -247,17 +394,128 @@ rocblas_status rocsolver_ger(rocblas_handle handle,
                              T** work);
 
 // potf2
-template <typename T, typename U>
+template <typename T, typename I, typename U>
 rocblas_status potf2_run_small(rocblas_handle handle,
                                const rocblas_fill uplo,
-                               const rocblas_int n,
+                               const I n,
                                U AA,
+                               const rocblas_stride shiftA,
+                               const I lda,
+                               const rocblas_stride strideA,
+                               I* info,
+                               const I batch_count,
+                               const I offset = 0);
+
+// posv
+template <typename T, typename U>
+rocblas_status posv_run_small(rocblas_handle handle,
+                              const rocblas_fill uplo,
+                              const rocblas_int n,
+                              const rocblas_int nrhs,
+                              U A,
+                              const rocblas_int shiftA,
+                              const rocblas_int lda,
+                              const rocblas_stride strideA,
+                              U B,
+                              const rocblas_int shiftB,
+                              const rocblas_int ldb,
+                              const rocblas_stride strideB,
+                              rocblas_int* info,
+                              const rocblas_int batch_count);
+
+// geqr2
+template <typename T, typename U, typename V>
+rocblas_status geqr2_run_small(rocblas_handle handle,
+                               const rocblas_int m,
+                               const rocblas_int n,
+                               U A,
                                const rocblas_int shiftA,
                                const rocblas_int lda,
                                const rocblas_stride strideA,
-                               rocblas_int* info,
+                               V ipiv,
+                               const rocblas_stride strideP,
+                               const rocblas_int batch_count);
+
+// sytd2
+template <typename T, typename S, typename U>
+rocblas_status sytd2_run_small(rocblas_handle handle,
+                               const rocblas_fill uplo,
+                               const rocblas_int n,
+                               U A,
+                               const rocblas_int shiftA,
+                               const rocblas_int lda,
+                               const rocblas_stride strideA,
+                               S* D,
+                               const rocblas_stride strideD,
+                               S* E,
+                               const rocblas_stride strideE,
+                               T* tau,
+                               const rocblas_stride strideP,
+                               const rocblas_int batch_count);
+
+// sygs2
+template <typename T, typename U>
+rocblas_status sygs2_run_small(rocblas_handle handle,
+                               const rocblas_eform itype,
+                               const rocblas_fill uplo,
+                               const rocblas_int n,
+                               U A,
+                               const rocblas_int shiftA,
+                               const rocblas_int lda,
+                               const rocblas_stride strideA,
+                               U B,
+                               const rocblas_int shiftB,
+                               const rocblas_int ldb,
+                               const rocblas_stride strideB,
                                const rocblas_int batch_count);
 
+// megakernels
+template <typename T, typename U>
+rocblas_status potrf_run_megakernel(rocblas_handle handle,
+                                    const rocblas_fill uplo,
+                                    const rocblas_int n,
+                                    U A,
+                                    const rocblas_stride shiftA,
+                                    const rocblas_int lda,
+                                    const rocblas_stride strideA,
+                                    rocblas_int* info,
+                                    const rocblas_int batch_count);
+
+template <typename T, typename U>
+rocblas_status getrf_run_megakernel(rocblas_handle handle,
+                                    const rocblas_int m,
+                                    const rocblas_int n,
+                                    U A,
+                                    const rocblas_stride shiftA,
+                                    const rocblas_int lda,
+                                    const rocblas_stride strideA,
+                                    rocblas_int* ipiv,
+                                    const rocblas_stride shiftP,
+                                    const rocblas_stride strideP,
+                                    rocblas_int* info,
+                                    const rocblas_int batch_count,
+                                    const bool pivot);
+
+template <typename T, typename U, typename V>
+rocblas_status geqrf_run_megakernel(rocblas_handle handle,
+                                    const rocblas_int m,
+                                    const rocblas_int n,
+                                    U A,
+                                    const rocblas_stride shiftA,
+                                    const rocblas_int lda,
+                                    const rocblas_stride strideA,
+                                    V ipiv,
+                                    const rocblas_stride strideP,
+                                    const rocblas_int batch_count);
+
+// returns true if a batched factorization is computed with a megakernel
+template <bool ISBATCHED, typename I>
+inline bool rocsolver_use_megakernel(I m, I n, I batch_count)
+{
+    return ISBATCHED && batch_count >= MEGAKERNEL_MIN_BATCH && m <= MEGAKERNEL_MAX_N
+        && n <= MEGAKERNEL_MAX_N;
+}
+
 #ifdef OPTIMAL
 
 template <typename T, typename I, typename INFO, typename U>
@@ -278,6 +536,26 @@ rocblas_status getf2_run_panel(rocblas_handle handle,
                                I* permut_idx,
                                const rocblas_stride stride);
 
+template <typename T, typename I, typename INFO, typename U>
+rocblas_status getf2_run_coop_panel(rocblas_handle handle,
+                                    const I m,
+                                    const I n,
+                                    U A,
+                                    const rocblas_stride shiftA,
+                                    const I lda,
+                                    const rocblas_stride strideA,
+                                    I* ipiv,
+                                    const rocblas_stride shiftP,
+                                    const rocblas_stride strideP,
+                                    INFO* info,
+                                    const I batch_count,
+                                    const bool pivot,
+                                    const I offset,
+                                    I* permut_idx,
+                                    const rocblas_stride stride,
+                                    T* pivotval,
+                                    I* pivotidx);
+
 template <typename T, typename I, typename U>
 void getf2_run_scale_update(rocblas_handle handle,
                             const I m,
@@ -309,6 +587,41 @@ rocblas_status getf2_run_small(rocblas_handle handle,
                                I* permut_idx,
                                const rocblas_stride stride);
 
+template <typename T, typename U>
+rocblas_status gesv_run_small(rocblas_handle handle,
+                              const rocblas_int n,
+                              const rocblas_int nrhs,
+                              U A,
+                              const rocblas_int shiftA,
+                              const rocblas_int lda,
+                              const rocblas_stride strideA,
+                              rocblas_int* ipiv,
+                              const rocblas_stride strideP,
+                              U B,
+                              const rocblas_int shiftB,
+                              const rocblas_int ldb,
+                              const rocblas_stride strideB,
+                              rocblas_int* info,
+                              const rocblas_int batch_count);
+
+template <typename T, typename U>
+rocblas_status getrs_run_small(rocblas_handle handle,
+                               const rocblas_operation trans,
+                               const rocblas_int n,
+                               const rocblas_int nrhs,
+                               U A,
+                               const rocblas_stride shiftA,
+                               const rocblas_int lda,
+                               const rocblas_stride strideA,
+                               const rocblas_int* ipiv,
+                               const rocblas_stride strideP,
+                               U B,
+                               const rocblas_stride shiftB,
+                               const rocblas_int ldb,
+                               const rocblas_stride strideB,
+                               const rocblas_int batch_count,
+                               const bool pivot);
+
 template <typename T, typename U>
 rocblas_status getri_run_small(rocblas_handle handle,
                                const rocblas_int n,
@@ -324,6 +637,38 @@ rocblas_status getri_run_small(rocblas_handle handle,
                                const bool complete,
                                const bool pivot);
 
+template <typename T, typename U>
+rocblas_status getri_run_medium(rocblas_handle handle,
+                                const rocblas_int n,
+                                U A,
+                                const rocblas_int shiftA,
+                                const rocblas_int lda,
+                                const rocblas_stride strideA,
+                                rocblas_int* ipiv,
+                                const rocblas_int shiftP,
+                                const rocblas_stride strideP,
+                                rocblas_int* info,
+                                const rocblas_int batch_count,
+                                const bool pivot);
+
+template <typename T, typename U>
+rocblas_status getri_run_gj(rocblas_handle handle,
+                            const rocblas_fill uplo,
+                            const rocblas_diagonal diag,
+                            const rocblas_int n,
+                            const rocblas_int blk,
+                            U A,
+                            const rocblas_int shiftA,
+                            const rocblas_int lda,
+                            const rocblas_stride strideA,
+                            rocblas_int* ipiv,
+                            const rocblas_int shiftP,
+                            const rocblas_stride strideP,
+                            rocblas_int* info,
+                            const rocblas_int batch_count,
+                            const bool trtri_only,
+                            const bool pivot);
+
 // trti2
 template <typename T, typename U>
 void trti2_run_small(rocblas_handle handle,
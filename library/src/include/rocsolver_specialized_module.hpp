@@ -0,0 +1,98 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "lib_host_helpers.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/***************************************************************************
+ * Lazily loaded specialized kernels. When the library is built with
+ * ROCSOLVER_LAZY_SPECIALIZED_KERNELS, the launchers of the small-size kernels
+ * that are only built with OPTIMAL (getf2, gesv, getrs, getri and trti2) are
+ * compiled into a separate module, librocsolver-specialized, which is installed
+ * next to librocsolver. The library itself only keeps forwarding stubs for them,
+ * and the module (with its code objects) is loaded by the first stub that is
+ * called. Processes that never reach these code paths do not pay for loading
+ * and registering the kernels.
+ *
+ * The INSTANTIATE macros of these families use ROCSOLVER_INSTANTIATE_SPECIALIZED
+ * so that the same source files produce, depending on the build:
+ * - ordinary explicit instantiations (default),
+ * - explicit instantiations that register themselves by name in the module
+ *   (ROCSOLVER_SPECIALIZED_MODULE), or
+ * - explicit specializations that forward to the registered launcher
+ *   (ROCSOLVER_LAZY_SPECIALIZED).
+ ***************************************************************************/
+
+// returns the launcher registered under the given name in the specialized
+// module, loading the module on first use (nullptr if it could not be loaded)
+void* rocsolver_specialized_symbol(const char* name);
+
+// registers a launcher in the specialized module
+bool rocsolver_specialized_register(const char* name, void* launcher);
+
+// value returned by a forwarding stub when the module could not be loaded
+template <typename R>
+inline R rocsolver_specialized_unavailable()
+{
+    return rocblas_status_internal_error;
+}
+
+template <>
+inline void rocsolver_specialized_unavailable<void>()
+{
+}
+
+#define ROCSOLVER_UNPAREN(...) __VA_ARGS__
+
+// RET FN<TARGS>(PARAMS) is the launcher to instantiate, and ARGS are the names of its parameters;
+// TARGS, PARAMS and ARGS are parenthesized lists
+#if defined(ROCSOLVER_SPECIALIZED_MODULE)
+#define ROCSOLVER_INSTANTIATE_SPECIALIZED(RET, FN, TARGS, PARAMS, ARGS)       \
+    template RET FN<ROCSOLVER_UNPAREN TARGS>(ROCSOLVER_UNPAREN PARAMS);       \
+    static const bool ROCSOLVER_CONCAT2(FN##_registered_, __LINE__)           \
+        = rocsolver_specialized_register(#FN #TARGS, (void*)&FN<ROCSOLVER_UNPAREN TARGS>)
+#elif defined(ROCSOLVER_LAZY_SPECIALIZED)
+#define ROCSOLVER_INSTANTIATE_SPECIALIZED(RET, FN, TARGS, PARAMS, ARGS)           \
+    template <>                                                                   \
+    RET FN<ROCSOLVER_UNPAREN TARGS>(ROCSOLVER_UNPAREN PARAMS)                     \
+    {                                                                             \
+        using launcher_t = RET (*)(ROCSOLVER_UNPAREN PARAMS);                     \
+        static const launcher_t launcher                                          \
+            = (launcher_t)rocsolver_specialized_symbol(#FN #TARGS);               \
+        if(!launcher)                                                             \
+            return rocsolver_specialized_unavailable<RET>();                      \
+        return launcher(ROCSOLVER_UNPAREN ARGS);                                  \
+    }
+#else
+#define ROCSOLVER_INSTANTIATE_SPECIALIZED(RET, FN, TARGS, PARAMS, ARGS) \
+    template RET FN<ROCSOLVER_UNPAREN TARGS>(ROCSOLVER_UNPAREN PARAMS)
+#endif
+
+ROCSOLVER_END_NAMESPACE
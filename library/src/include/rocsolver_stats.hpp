@@ -0,0 +1,371 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <vector>
+#include <rocblas/rocblas.h>
+
+#include "lib_host_helpers.hpp"
+#include "rocblas/internal/rocblas_device_malloc.hpp"
+#include "rocblas_utility.hpp"
+#include "rocsolver/rocsolver.h"
+#include "rocsolver_thread_mode.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/***************************************************************************
+ * Statistics of the rocSOLVER function calls (see rocsolver_get_last_call_stats).
+ * The statistics of the call in progress are accumulated in a thread-local
+ * record (the handle is assumed to be used by one host thread at a time), and
+ * they are published for the handle when the top-level function returns, so
+ * that the hot paths (kernel launches, rocBLAS calls) only increment a counter.
+ ***************************************************************************/
+struct rocsolver_stats_record
+{
+    rocsolver_call_stats stats;
+    // depth of nested top-level function calls
+    int depth;
+};
+
+extern ROCSOLVER_MODULE_VISIBLE thread_local rocsolver_stats_record rocsolver_current_stats;
+
+// stores the statistics of the last call made with the handle
+void rocsolver_stats_publish(rocblas_handle handle, const rocsolver_call_stats& stats);
+
+// drops the statistics of the handle, for all the threads (see rocsolver_release_handle)
+void release_stats(rocblas_handle handle);
+
+inline void rocsolver_stats_kernel_launch()
+{
+    rocsolver_current_stats.stats.kernel_launches++;
+}
+
+inline void rocsolver_stats_rocblas_call()
+{
+    rocsolver_current_stats.stats.rocblas_calls++;
+}
+
+inline void rocsolver_stats_host_sync()
+{
+    rocsolver_current_stats.stats.host_syncs++;
+}
+
+inline void rocsolver_stats_workspace(size_t size)
+{
+    size_t& peak = rocsolver_current_stats.stats.workspace_size;
+    peak = std::max(peak, size);
+}
+
+inline void rocsolver_stats_flops(double flops)
+{
+    rocsolver_current_stats.stats.flops = flops;
+}
+
+inline void rocsolver_stats_workmode(rocblas_workmode mode)
+{
+    rocsolver_current_stats.stats.workmode = mode;
+}
+
+/***************************************************************************
+ * The rocsolver_stats_scope struct resets the statistics upon entering a
+ * top-level (i.e. impl) function, and publishes them upon exiting it.
+ ***************************************************************************/
+struct rocsolver_stats_scope
+{
+    rocblas_handle handle;
+
+    explicit rocsolver_stats_scope(rocblas_handle handle)
+        : handle(handle)
+    {
+        if(rocsolver_current_stats.depth++ == 0)
+            rocsolver_current_stats.stats = rocsolver_call_stats{};
+    }
+
+    // Copy constructor is deleted
+    rocsolver_stats_scope(const rocsolver_stats_scope&) = delete;
+
+    // Destructor
+    ~rocsolver_stats_scope()
+    {
+        if(--rocsolver_current_stats.depth == 0 && handle)
+            rocsolver_stats_publish(handle, rocsolver_current_stats.stats);
+    }
+
+    // Assignment operator is deleted
+    rocsolver_stats_scope& operator=(const rocsolver_stats_scope&) = delete;
+};
+
+// returns the memory pool set with rocsolver_set_workspace_pool for the handle (or null)
+hipMemPool_t get_workspace_pool(rocblas_handle handle);
+
+// drops the memory pool set for the handle (see rocsolver_release_handle)
+void release_workspace_pool(rocblas_handle handle);
+
+/** The source of the workspace of a rocSOLVER function: the device memory of the handle, the
+    memory pool of the handle, or none. **/
+enum class workspace_source
+{
+    handle,
+    pool,
+    none
+};
+
+/** Returns the memory pool from which a workspace with source workspace_source::pool is
+    allocated: the pool of the handle or, for a handle shared by several host threads without a
+    pool, the default memory pool of the current device. **/
+inline hipMemPool_t get_workspace_source_pool(rocblas_handle handle)
+{
+    hipMemPool_t pool = get_workspace_pool(handle);
+    int device;
+    if(!pool
+       && (hipGetDevice(&device) != hipSuccess
+           || hipDeviceGetDefaultMemPool(&pool, device) != hipSuccess))
+        pool = nullptr;
+    return pool;
+}
+
+/** Returns the source of a workspace of the given size. When the device memory managed by
+    rocBLAS would need to grow (which synchronizes the device), the workspace is allocated in
+    stream order from the memory pool of the handle, if any. Otherwise, the workspace cannot be
+    allocated safely while the stream of the handle is being captured into a graph (the
+    memory of the handle would be reallocated while previously captured operations still use
+    it); it should then be preallocated, e.g. with rocsolver_initialize or
+    rocblas_set_device_memory_size. The workspace of a handle shared by several host threads is
+    always allocated from a pool, as the calls of the different threads can run concurrently
+    on different streams (see rocsolver_thread_scope). **/
+inline workspace_source get_workspace_source(rocblas_handle handle, size_t size)
+{
+    if(size == 0 || rocblas_is_device_memory_size_query(handle))
+        return workspace_source::handle;
+
+    if(multi_thread_enabled(handle))
+        return workspace_source::pool;
+
+    if(!rocblas_is_managing_device_memory(handle))
+        return workspace_source::handle;
+
+    size_t current = 0;
+    rocblas_get_device_memory_size(handle, &current);
+    if(size <= current)
+        return workspace_source::handle;
+
+    if(get_workspace_pool(handle))
+        return workspace_source::pool;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+    return stream_is_capturing(stream) ? workspace_source::none : workspace_source::handle;
+}
+
+/** Resolves the work mode of a function that can run out-of-place, with a workspace of the given
+    size, or in-place. With rocblas_auto, the out-of-place variant is selected if its workspace
+    fits in the device memory of the handle, or, when the handle manages its memory, if the
+    memory can be obtained from the pool of the handle or from the free device memory (and it
+    is not being captured into a graph). Size queries always select the out-of-place variant, so
+    that the largest workspace is reported. The choice is recorded in the call statistics. **/
+inline rocblas_workmode select_workmode(rocblas_handle handle, rocblas_workmode mode, size_t size)
+{
+    if(mode == rocblas_auto)
+    {
+        mode = rocblas_outofplace;
+
+        size_t current = 0;
+        rocblas_get_device_memory_size(handle, &current);
+        if(!rocblas_is_device_memory_size_query(handle) && size > current)
+        {
+            // the workspace is taken from the pool, or the memory of the handle has to grow
+            workspace_source source = get_workspace_source(handle, size);
+            size_t needed = (source == workspace_source::handle ? size - current : size);
+            size_t free_mem = 0, total_mem = 0;
+            if(source == workspace_source::none
+               || (source == workspace_source::handle && !rocblas_is_managing_device_memory(handle))
+               || hipMemGetInfo(&free_mem, &total_mem) != hipSuccess || needed > free_mem)
+                mode = rocblas_inplace;
+        }
+    }
+    else if(mode != rocblas_outofplace)
+        mode = rocblas_inplace;
+
+    rocsolver_stats_workmode(mode);
+    return mode;
+}
+
+/***************************************************************************
+ * Within the rocsolver namespace, rocblas_device_malloc refers to this thin
+ * wrapper of the rocBLAS class, which also records the size of the requested
+ * workspace, allocates it from the memory pool of the handle instead of
+ * growing the device memory of the handle (see get_workspace_source), and
+ * fails (as if the allocation failed) when the workspace cannot be allocated
+ * during stream capture. It is used exactly as the rocBLAS class.
+ ***************************************************************************/
+class rocblas_device_malloc : public ::rocblas_device_malloc
+{
+private:
+    static constexpr size_t pool_alignment = 256;
+
+    workspace_source source;
+    hipStream_t stream = nullptr;
+    void* pool_memory = nullptr;
+    std::vector<void*> pool_ptrs;
+
+    template <typename... Ss>
+    rocblas_device_malloc(workspace_source source, rocblas_handle handle, Ss... sizes)
+        : ::rocblas_device_malloc(
+            handle, (source == workspace_source::handle ? size_t(sizes) : size_t(0))...)
+        , source(source)
+    {
+        rocsolver_stats_workspace((size_t(0) + ... + size_t(sizes)));
+
+        if(source == workspace_source::pool)
+        {
+            // sub-allocate every requested size from a single pool allocation
+            const size_t sizes_list[] = {size_t(sizes)...};
+            auto aligned = [](size_t size) {
+                return (size + pool_alignment - 1) / pool_alignment * pool_alignment;
+            };
+
+            size_t total = 0;
+            for(size_t size : sizes_list)
+                total += aligned(size);
+
+            rocblas_get_stream(handle, &stream);
+            hipMemPool_t pool = get_workspace_source_pool(handle);
+            if(!pool || hipMallocFromPoolAsync(&pool_memory, total, pool, stream) != hipSuccess)
+                pool_memory = nullptr;
+
+            size_t offset = 0;
+            for(size_t size : sizes_list)
+            {
+                char* ptr = static_cast<char*>(pool_memory);
+                pool_ptrs.push_back(ptr ? ptr + offset : nullptr);
+                offset += aligned(size);
+            }
+        }
+    }
+
+public:
+    template <typename... Ss>
+    explicit rocblas_device_malloc(rocblas_handle handle, Ss... sizes)
+        : rocblas_device_malloc(
+            get_workspace_source(handle, (size_t(0) + ... + size_t(sizes))), handle, sizes...)
+    {
+    }
+
+    rocblas_device_malloc(const rocblas_device_malloc&) = delete;
+    rocblas_device_malloc& operator=(const rocblas_device_malloc&) = delete;
+
+    // the pool memory is released in stream order, after the work of the function
+    ~rocblas_device_malloc()
+    {
+        if(pool_memory)
+            (void)hipFreeAsync(pool_memory, stream);
+    }
+
+    void* operator[](size_t index) const
+    {
+        if(source == workspace_source::pool)
+            return pool_ptrs[index];
+        return ::rocblas_device_malloc::operator[](index);
+    }
+
+    explicit operator bool() const
+    {
+        if(source == workspace_source::pool)
+            return pool_memory != nullptr;
+        return source == workspace_source::handle && ::rocblas_device_malloc::operator bool();
+    }
+};
+
+/***************************************************************************
+ * Nominal flop counts (following LAPACK Working Note 41). For complex types,
+ * a multiplication counts as 6 flops and an addition as 2 flops.
+ ***************************************************************************/
+template <typename T>
+double rocsolver_flops(double fmuls, double fadds)
+{
+    if constexpr(rocblas_is_complex<T>)
+        return 6 * fmuls + 2 * fadds;
+    else
+        return fmuls + fadds;
+}
+
+template <typename T>
+double rocsolver_getrf_flops(double m, double n)
+{
+    double k = std::min(m, n);
+    double l = std::max(m, n);
+    double fmuls = 0.5 * k * (k * (l - k / 3 - 1) + l) + 2 * k / 3;
+    double fadds = 0.5 * k * (k * (l - k / 3) - l) + k / 6;
+    return rocsolver_flops<T>(fmuls, fadds);
+}
+
+template <typename T>
+double rocsolver_getrs_flops(double n, double nrhs)
+{
+    return rocsolver_flops<T>(nrhs * n * n, nrhs * n * (n - 1));
+}
+
+template <typename T>
+double rocsolver_potrf_flops(double n)
+{
+    double fmuls = n * ((n / 6 + 0.5) * n + 1. / 3);
+    double fadds = n * (n * n / 6 - 1. / 6);
+    return rocsolver_flops<T>(fmuls, fadds);
+}
+
+template <typename T>
+double rocsolver_potrs_flops(double n, double nrhs)
+{
+    return rocsolver_flops<T>(nrhs * n * (n + 1), nrhs * n * (n - 1));
+}
+
+template <typename T>
+double rocsolver_sytrs_flops(double n, double nrhs)
+{
+    return rocsolver_flops<T>(nrhs * n * n, nrhs * n * (n - 1));
+}
+
+template <typename T>
+double rocsolver_geqrf_flops(double m, double n)
+{
+    double fmuls, fadds;
+    if(m > n)
+    {
+        fmuls = n * (n * (0.5 - n / 3 + m) + m + 23. / 6);
+        fadds = n * (n * (0.5 - n / 3 + m) + 5. / 6);
+    }
+    else
+    {
+        fmuls = m * (m * (-0.5 - m / 3 + n) + 2 * n + 23. / 6);
+        fadds = m * (m * (-0.5 - m / 3 + n) + n + 5. / 6);
+    }
+    return rocsolver_flops<T>(fmuls, fadds);
+}
+
+ROCSOLVER_END_NAMESPACE
@@ -0,0 +1,135 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include <hip/hip_runtime.h>
+#include <utility>
+
+#include "lib_host_helpers.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/***************************************************************************
+ * Returns a non-blocking stream of the current device that internal
+ * routines can use to execute work concurrently with the stream of the
+ * handle (e.g. the look-ahead panel factorizations in GETRF). Dependencies
+ * with the stream of the handle must be enforced with events.
+ *
+ * The stream belongs to the handle; it is created the first time it is
+ * requested for each device and kept until the handle is released (see
+ * rocsolver_release_handle), as creating streams is too expensive to be done
+ * at every call. If the handle has a CU mask (see rocsolver_set_cu_mask), the
+ * stream is restricted to the same compute units, and is kept until the
+ * mask of the handle changes. Returns hipSuccess if the stream is available.
+ ***************************************************************************/
+hipError_t rocsolver_get_side_stream(rocblas_handle handle, hipStream_t* stream);
+
+/***************************************************************************
+ * Returns count (at most ROCSOLVER_MAX_BATCH_STREAMS) non-blocking streams
+ * of the current device, among which batched routines can split the
+ * problems of the batch (see rocsolver_split_batch). These streams are
+ * different from the side stream.
+ *
+ * As with the side stream, the streams belong to the handle, are created the
+ * first time they are requested, inherit the CU mask of the handle, and are
+ * only destroyed when this mask changes or the handle is released. Returns
+ * hipSuccess if all the streams are available.
+ ***************************************************************************/
+#define ROCSOLVER_MAX_BATCH_STREAMS 8
+
+hipError_t
+    rocsolver_get_batch_streams(rocblas_handle handle, const int count, hipStream_t* streams);
+
+/***************************************************************************
+ * Returns in count the number of compute units of the current device that
+ * the kernels launched with the given handle can use, i.e. the number of
+ * CUs selected by its CU mask or, if it has none, all the CUs of the
+ * device. Grids that are sized to fill the device (e.g. those of the
+ * cooperative kernels, which require all their thread-blocks to be
+ * resident) must use this count.
+ ***************************************************************************/
+ROCSOLVER_MODULE_VISIBLE hipError_t rocsolver_cu_count(rocblas_handle handle, int* count);
+
+/***************************************************************************
+ * Returns a rocBLAS handle, owned by rocSOLVER, that is bound to the side
+ * stream of the given handle (see rocsolver_get_side_stream) and uses the
+ * same pointer mode. The rocBLAS functions queued on the side stream while
+ * other work of the handle runs on its stream must be called with it, as
+ * rocBLAS may use the workspace of the handle (e.g. in the Tensile GEMMs),
+ * and both streams would then use the same workspace concurrently. See
+ * rocsolver_side_blas_scope.
+ *
+ * As with the side stream, it is created the first time it is requested
+ * for each device and kept until the handle is released. It is not created
+ * while the stream of the handle is being captured into a graph. Returns
+ * hipSuccess if the rocBLAS handle is available.
+ ***************************************************************************/
+hipError_t rocsolver_get_side_blas_handle(rocblas_handle handle, rocblas_handle* blas);
+
+// returns the rocBLAS handle that the internal rocBLAS calls made with the given handle by the
+// current thread must use (the one selected by a rocsolver_side_blas_scope, with the current
+// pointer mode of the handle, or the handle itself)
+ROCSOLVER_MODULE_VISIBLE rocblas_handle rocsolver_blas_handle(rocblas_handle handle);
+
+// selects the rocBLAS handle used by rocsolver_blas_handle for the given handle in the current
+// thread (nullptr to stop), and returns the previous selection
+ROCSOLVER_MODULE_VISIBLE std::pair<rocblas_handle, rocblas_handle>
+    rocsolver_set_blas_handle(rocblas_handle handle, rocblas_handle blas);
+
+/** ROCSOLVER_SIDE_BLAS_SCOPE makes the internal rocBLAS calls made with the handle (see
+    rocblas.hpp) use the given rocBLAS handle while it is in scope, e.g. while the work of an
+    internal routine is queued on the side stream of the handle. **/
+class rocsolver_side_blas_scope
+{
+    std::pair<rocblas_handle, rocblas_handle> prev;
+
+public:
+    rocsolver_side_blas_scope(rocblas_handle handle, rocblas_handle blas)
+        : prev(rocsolver_set_blas_handle(handle, blas))
+    {
+    }
+
+    rocsolver_side_blas_scope(const rocsolver_side_blas_scope&) = delete;
+    rocsolver_side_blas_scope& operator=(const rocsolver_side_blas_scope&) = delete;
+
+    ~rocsolver_side_blas_scope()
+    {
+        rocsolver_set_blas_handle(prev.first, prev.second);
+    }
+};
+
+// removes the CU mask of the handle, restoring its previous stream and destroying the
+// masked streams (see rocsolver_release_handle)
+void release_cu_mask(rocblas_handle handle);
+
+// waits for the work queued in the side and batch streams of the handle without a CU mask and
+// destroys them, together with the rocBLAS handle of the side stream (see
+// rocsolver_release_handle)
+void release_handle_streams(rocblas_handle handle);
+
+ROCSOLVER_END_NAMESPACE
@@ -0,0 +1,127 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <rocblas/rocblas.h>
+
+#include "lib_host_helpers.hpp"
+#include "rocsolver/rocsolver.h"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+// number of handles shared by several host threads, so that the handles with
+// the default mode do not need to look up their setting
+extern std::atomic<int> num_multi_thread_handles;
+
+// returns the lock of a handle in rocsolver_thread_mode_multi (or null)
+std::shared_ptr<std::recursive_mutex> get_thread_mode_lock(rocblas_handle handle);
+
+// returns true and the stream set with rocsolver_set_thread_stream by the
+// calling thread for the handle, if any
+bool get_thread_stream(rocblas_handle handle, hipStream_t* stream);
+
+// drops the setting and the streams of the handle, for all the threads
+// (see rocsolver_release_handle)
+void release_thread_mode(rocblas_handle handle);
+
+/***************************************************************************
+ * Returns true if the handle can be shared by several host threads, as
+ * selected with rocsolver_set_thread_mode. The handle must not be null.
+ ***************************************************************************/
+inline bool multi_thread_enabled(rocblas_handle handle)
+{
+    if(num_multi_thread_handles.load(std::memory_order_relaxed) == 0)
+        return false;
+    return get_thread_mode_lock(handle) != nullptr;
+}
+
+/***************************************************************************
+ * The thread scope of a top-level rocSOLVER function. When the handle is in
+ * rocsolver_thread_mode_multi, the scope serializes the calls made with the
+ * handle on different host threads (only the host-side work; the device
+ * work is queued asynchronously), and, for the outermost level, runs the call
+ * on the stream that the calling thread set for the handle, restoring the
+ * stream of the handle on exit. The workspace of these calls is allocated in
+ * stream order from a memory pool (see get_workspace_source), so that the
+ * calls running concurrently on different streams use different memory.
+ ***************************************************************************/
+class rocsolver_thread_scope
+{
+private:
+    static thread_local int depth;
+
+    rocblas_handle handle;
+    std::shared_ptr<std::recursive_mutex> lock;
+    hipStream_t handle_stream = nullptr;
+    bool swapped = false;
+
+public:
+    explicit rocsolver_thread_scope(rocblas_handle handle)
+        : handle(handle)
+    {
+        if(!handle || num_multi_thread_handles.load(std::memory_order_relaxed) == 0)
+            return;
+
+        lock = get_thread_mode_lock(handle);
+        if(!lock)
+            return;
+
+        lock->lock();
+        hipStream_t stream;
+        if(depth++ == 0 && get_thread_stream(handle, &stream))
+        {
+            rocblas_get_stream(handle, &handle_stream);
+            swapped = (stream != handle_stream);
+            if(swapped)
+                rocblas_set_stream(handle, stream);
+        }
+    }
+
+    // Copy constructor is deleted
+    rocsolver_thread_scope(const rocsolver_thread_scope&) = delete;
+
+    // Destructor
+    ~rocsolver_thread_scope()
+    {
+        if(!lock)
+            return;
+
+        --depth;
+        if(swapped)
+            rocblas_set_stream(handle, handle_stream);
+        lock->unlock();
+    }
+
+    // Assignment operator is deleted
+    rocsolver_thread_scope& operator=(const rocsolver_thread_scope&) = delete;
+};
+
+ROCSOLVER_END_NAMESPACE
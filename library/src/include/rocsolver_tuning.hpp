@@ -0,0 +1,163 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <rocblas/rocblas.h>
+
+#include "lib_host_helpers.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/***************************************************************************
+ * The rocsolver_tuning_table struct holds a set of switch sizes (intervals)
+ * and the block sizes to be used in each interval, equivalent to the
+ * *_INTERVALS and *_BLKSIZES constants defined in ideal_sizes.hpp.
+ *
+ * The two-dimensional tables (equivalent to the *_INTERVALSROW,
+ * *_INTERVALSCOL and *_BLKSIZES constants) also hold the switch sizes of
+ * the number of columns (intervals_cols), and the block sizes of all the
+ * intervals of rows and columns, stored by rows.
+ ***************************************************************************/
+struct rocsolver_tuning_table
+{
+    std::vector<int64_t> intervals;
+    std::vector<int64_t> intervals_cols;
+    std::vector<int64_t> blksizes;
+};
+
+/***************************************************************************
+ * The rocsolver_tuning class holds the tuning tables that override, at
+ * run time, the compile-time constants defined in ideal_sizes.hpp.
+ *
+ * The tables are read once, the first time they are needed, from the tuning
+ * files of the devices in the persistent cache (see rocsolver_cache.hpp) and
+ * from the file given by the environment variable ROCSOLVER_TUNING_PATH.
+ * Entries in the files are keyed by the architecture of the device (e.g.
+ * gfx90a), so that a single binary can be tuned for different devices. If no
+ * table is available for the current device, the compile-time defaults apply.
+ ***************************************************************************/
+class rocsolver_tuning
+{
+private:
+    // tables keyed by "arch:name"; entries for all architectures use arch "*"
+    std::unordered_map<std::string, rocsolver_tuning_table> tables;
+    // architecture name of each device, indexed by device id
+    std::vector<std::string> device_arch;
+    // hash of all the loaded tables
+    uint64_t tables_signature = 0;
+    // value of ROCSOLVER_TUNING_PATH when the tables were loaded
+    std::string env_path;
+
+    rocsolver_tuning();
+
+    void load_file(const std::string& path, const std::string& default_arch);
+
+public:
+    rocsolver_tuning(const rocsolver_tuning&) = delete;
+    rocsolver_tuning& operator=(const rocsolver_tuning&) = delete;
+
+    static const rocsolver_tuning& instance();
+
+    /** Loads the tables again if ROCSOLVER_TUNING_PATH has changed since they were loaded.
+        (The previous tables are never released, as other threads could be using them.) **/
+    static void reload();
+
+    /** Returns the table with the given name (e.g. "getrf_batch_real") for the
+        current device, or nullptr if no table has been defined at run time. **/
+    const rocsolver_tuning_table* get_table(const char* name) const;
+
+    /** Returns a hash of all the tables defined at run time (0 if there are none), so that
+        the values derived from the block sizes (e.g. the memoized workspace sizes) can be
+        invalidated when the tables change. **/
+    uint64_t signature() const
+    {
+        return tables_signature;
+    }
+};
+
+/** Returns the block size for the given dimension. The run-time tuning table with the given
+    name is used if available; otherwise, the compile-time sizes and intervals are used
+    (as in get_index). **/
+template <typename I>
+I get_tuned_blksize(const char* name, I* sizes, I* intervals, I max, I dim)
+{
+    const rocsolver_tuning_table* table = rocsolver_tuning::instance().get_table(name);
+    if(table && table->intervals_cols.empty())
+    {
+        size_t i;
+        for(i = 0; i < table->intervals.size(); ++i)
+        {
+            if(dim <= table->intervals[i])
+                break;
+        }
+        return static_cast<I>(table->blksizes[i]);
+    }
+
+    return sizes[get_index(intervals, max, dim)];
+}
+
+/** Returns the block size for the given numbers of rows and columns, from the two-dimensional
+    run-time tuning table with the given name if available, or from the compile-time sizes
+    (stored by rows, with ncols columns) and intervals otherwise. **/
+template <typename I>
+I get_tuned_blksize(const char* name,
+                    const I* sizes,
+                    const I ncols,
+                    I* intervalsM,
+                    I maxM,
+                    I* intervalsN,
+                    I maxN,
+                    I m,
+                    I n)
+{
+    const rocsolver_tuning_table* table = rocsolver_tuning::instance().get_table(name);
+    if(table && !table->intervals_cols.empty())
+    {
+        size_t i, j;
+        for(i = 0; i < table->intervals.size(); ++i)
+        {
+            if(m <= table->intervals[i])
+                break;
+        }
+        for(j = 0; j < table->intervals_cols.size(); ++j)
+        {
+            if(n <= table->intervals_cols[j])
+                break;
+        }
+        return static_cast<I>(table->blksizes[i * (table->intervals_cols.size() + 1) + j]);
+    }
+
+    return sizes[get_index(intervalsM, maxM, m) * ncols + get_index(intervalsN, maxN, n)];
+}
+
+ROCSOLVER_END_NAMESPACE
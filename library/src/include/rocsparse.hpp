@@ -202,6 +202,25 @@ inline rocsparse_status rocsparseCall_csric0_analysis(rocsparse_handle sphandle,
                                       buffer);
 }
 
+// csrilu0 numeric boost
+inline rocsparse_status rocsparseCall_csrilu0_numeric_boost(rocsparse_handle sphandle,
+                                                            rocsparse_mat_info info,
+                                                            int enable_boost,
+                                                            const float* boost_tol,
+                                                            const float* boost_val)
+{
+    return rocsparse_scsrilu0_numeric_boost(sphandle, info, enable_boost, boost_tol, boost_val);
+}
+
+inline rocsparse_status rocsparseCall_csrilu0_numeric_boost(rocsparse_handle sphandle,
+                                                            rocsparse_mat_info info,
+                                                            int enable_boost,
+                                                            const double* boost_tol,
+                                                            const double* boost_val)
+{
+    return rocsparse_dcsrilu0_numeric_boost(sphandle, info, enable_boost, boost_tol, boost_val);
+}
+
 // csrilu0
 inline rocsparse_status rocsparseCall_csrilu0(rocsparse_handle sphandle,
                                               rocblas_int n,
@@ -0,0 +1,171 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "roclapack_cholqr.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+template <typename T, typename U>
+rocblas_status rocsolver_cholqr_impl(rocblas_handle handle,
+                                     const rocblas_int m,
+                                     const rocblas_int n,
+                                     U A,
+                                     const rocblas_int lda,
+                                     T* R,
+                                     const rocblas_int ldr,
+                                     rocblas_int* info)
+{
+    ROCSOLVER_ENTER_TOP("cholqr", "-m", m, "-n", n, "--lda", lda, "--ldr", ldr);
+    ROCSOLVER_INFO_SUMMARY(info, 1);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_cholqr_argCheck(handle, m, n, lda, ldr, A, R, info);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+    rocblas_int shiftR = 0;
+
+    // normal (non-batched non-strided) execution
+    rocblas_stride strideA = 0;
+    rocblas_stride strideR = 0;
+    rocblas_int batch_count = 1;
+
+    // memory workspace sizes:
+    // constants in rocblas calls (only whether they are needed, see set_device_scalars)
+    size_t size_scalars;
+    // size of reusable workspaces (and for calling POTRF and TRSM)
+    size_t size_work1, size_work2, size_work3, size_work4;
+    // extra requirements for calling POTRF
+    size_t size_pivots, size_iinfo;
+    // size for the Gram matrices, the arrays of pointers to them, and the info of their
+    // Cholesky factorizations
+    size_t size_G, size_Garr, size_pinfo;
+    bool optim_mem;
+    rocsolver_cholqr_getMemorySize<false, false, T>(m, n, batch_count, &size_scalars, &size_work1,
+                                                    &size_work2, &size_work3, &size_work4,
+                                                    &size_pivots, &size_iinfo, &size_G, &size_Garr,
+                                                    &size_pinfo, &optim_mem);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_t(0), size_work1, size_work2,
+                                                      size_work3, size_work4, size_pivots,
+                                                      size_iinfo, size_G, size_Garr, size_pinfo);
+
+    // memory workspace allocation
+    void *scalars, *work1, *work2, *work3, *work4, *pivots, *iinfo, *G, *Garr, *pinfo;
+    rocblas_device_malloc mem(handle, size_t(0), size_work1, size_work2, size_work3, size_work4,
+                              size_pivots, size_iinfo, size_G, size_Garr, size_pinfo);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    scalars = mem[0];
+    work1 = mem[1];
+    work2 = mem[2];
+    work3 = mem[3];
+    work4 = mem[4];
+    pivots = mem[5];
+    iinfo = mem[6];
+    G = mem[7];
+    Garr = mem[8];
+    pinfo = mem[9];
+    if(size_scalars > 0)
+        ROCBLAS_CHECK(set_device_scalars<T>(scalars));
+
+    // execution
+    return _info_summary_scope.commit(rocsolver_cholqr_template<false, false, T>(
+        handle, m, n, A, shiftA, lda, strideA, R, shiftR, ldr, strideR, info, batch_count,
+        (T*)scalars, work1, work2, work3, work4, (T*)pivots, (rocblas_int*)iinfo, (T*)G, (T**)Garr,
+        (rocblas_int*)pinfo, optim_mem));
+}
+
+ROCSOLVER_END_NAMESPACE
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_scholqr(rocblas_handle handle,
+                                 const rocblas_int m,
+                                 const rocblas_int n,
+                                 float* A,
+                                 const rocblas_int lda,
+                                 float* R,
+                                 const rocblas_int ldr,
+                                 rocblas_int* info)
+{
+    return rocsolver::rocsolver_cholqr_impl<float>(handle, m, n, A, lda, R, ldr, info);
+}
+
+rocblas_status rocsolver_dcholqr(rocblas_handle handle,
+                                 const rocblas_int m,
+                                 const rocblas_int n,
+                                 double* A,
+                                 const rocblas_int lda,
+                                 double* R,
+                                 const rocblas_int ldr,
+                                 rocblas_int* info)
+{
+    return rocsolver::rocsolver_cholqr_impl<double>(handle, m, n, A, lda, R, ldr, info);
+}
+
+rocblas_status rocsolver_ccholqr(rocblas_handle handle,
+                                 const rocblas_int m,
+                                 const rocblas_int n,
+                                 rocblas_float_complex* A,
+                                 const rocblas_int lda,
+                                 rocblas_float_complex* R,
+                                 const rocblas_int ldr,
+                                 rocblas_int* info)
+{
+    return rocsolver::rocsolver_cholqr_impl<rocblas_float_complex>(handle, m, n, A, lda, R, ldr,
+                                                                   info);
+}
+
+rocblas_status rocsolver_zcholqr(rocblas_handle handle,
+                                 const rocblas_int m,
+                                 const rocblas_int n,
+                                 rocblas_double_complex* A,
+                                 const rocblas_int lda,
+                                 rocblas_double_complex* R,
+                                 const rocblas_int ldr,
+                                 rocblas_int* info)
+{
+    return rocsolver::rocsolver_cholqr_impl<rocblas_double_complex>(handle, m, n, A, lda, R, ldr,
+                                                                    info);
+}
+
+} // extern C
@@ -0,0 +1,332 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "roclapack_potrf.hpp"
+#include "rocsolver/rocsolver.h"
+#include "rocsolver_alg_mode.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/** CHOLQR_SHIFT adds the shift s = cte * ||A||_F^2 to the diagonal of the Gram matrix
+    G = A' * A, where ||A||_F^2 is the trace of G (as in shifted CholeskyQR). **/
+template <typename T, typename S>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) cholqr_shift(const rocblas_int n,
+                                                          T* GG,
+                                                          const rocblas_stride strideG,
+                                                          const S cte)
+{
+    const rocblas_int bid = hipBlockIdx_z;
+    const rocblas_int tid = hipThreadIdx_x;
+
+    T* G = GG + bid * strideG;
+
+    __shared__ S sval[BS1];
+
+    // each thread adds the diagonal elements it is assigned
+    S val = 0;
+    for(rocblas_int i = tid; i < n; i += BS1)
+        val += std::real(G[i + i * n]);
+    sval[tid] = val;
+    __syncthreads();
+
+    // reduce the partial sums
+    for(rocblas_int i = BS1 / 2; i > 0; i /= 2)
+    {
+        if(tid < i)
+            sval[tid] += sval[tid + i];
+        __syncthreads();
+    }
+
+    const S shift = cte * sval[0];
+    for(rocblas_int i = tid; i < n; i += BS1)
+        G[i + i * n] += shift;
+}
+
+/** CHOLQR_SET_R copies the upper triangular factor stored in G to R, and sets to zero
+    the strictly lower triangular part of R. **/
+template <typename T>
+ROCSOLVER_KERNEL void cholqr_set_r(const rocblas_int n,
+                                   T* GG,
+                                   const rocblas_stride strideG,
+                                   T* RR,
+                                   const rocblas_int shiftR,
+                                   const rocblas_int ldr,
+                                   const rocblas_stride strideR)
+{
+    const auto b = hipBlockIdx_z;
+    const auto i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const auto j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+
+    if(i < n && j < n)
+    {
+        T* G = GG + b * strideG;
+        T* R = RR + shiftR + b * strideR;
+
+        R[i + j * ldr] = (i <= j) ? G[i + j * n] : T(0);
+    }
+}
+
+/** CHOLQR_UPDATE_INFO keeps in info the first failed Cholesky factorization of each problem **/
+ROCSOLVER_KERNEL void cholqr_update_info(const rocblas_int batch_count,
+                                         rocblas_int* info,
+                                         const rocblas_int* pinfo)
+{
+    const rocblas_int b = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(b < batch_count && info[b] == 0)
+        info[b] = pinfo[b];
+}
+
+/** Returns true if the shifted CholeskyQR3 algorithm has been selected for the handle **/
+inline bool cholqr_use_shift(rocblas_handle handle)
+{
+    return get_alg_mode(handle, rocsolver_function_cholqr) == rocsolver_alg_mode_shifted;
+}
+
+template <typename T, typename U>
+rocblas_status rocsolver_cholqr_argCheck(rocblas_handle handle,
+                                         const rocblas_int m,
+                                         const rocblas_int n,
+                                         const rocblas_int lda,
+                                         const rocblas_int ldr,
+                                         T A,
+                                         U R,
+                                         rocblas_int* info,
+                                         const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    if(m < 0 || n < 0 || n > m || lda < m || ldr < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !A) || (n && !R) || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void rocsolver_cholqr_getMemorySize(const rocblas_int m,
+                                    const rocblas_int n,
+                                    const rocblas_int batch_count,
+                                    size_t* size_scalars,
+                                    size_t* size_work1,
+                                    size_t* size_work2,
+                                    size_t* size_work3,
+                                    size_t* size_work4,
+                                    size_t* size_pivots,
+                                    size_t* size_iinfo,
+                                    size_t* size_G,
+                                    size_t* size_Garr,
+                                    size_t* size_pinfo,
+                                    bool* optim_mem)
+{
+    // if quick return, no workspace is needed
+    if(n == 0 || batch_count == 0)
+    {
+        *size_scalars = 0;
+        *size_work1 = 0;
+        *size_work2 = 0;
+        *size_work3 = 0;
+        *size_work4 = 0;
+        *size_pivots = 0;
+        *size_iinfo = 0;
+        *size_G = 0;
+        *size_Garr = 0;
+        *size_pinfo = 0;
+        *optim_mem = true;
+        return;
+    }
+
+    bool opt1, opt2;
+    size_t w1, w2, w3, w4;
+
+    // requirements for calling POTRF on the Gram matrices
+    // (which are always strided)
+    rocsolver_potrf_getMemorySize<false, true, T>(n, rocblas_fill_upper, batch_count, size_scalars,
+                                                  size_work1, size_work2, size_work3, size_work4,
+                                                  size_pivots, size_iinfo, &opt1);
+
+    // requirements for calling TRSM to compute A * inv(R)
+    rocsolver_trsm_mem<BATCHED, STRIDED, T>(rocblas_side_right, rocblas_operation_none, m, n,
+                                            batch_count, &w1, &w2, &w3, &w4, &opt2);
+
+    *size_work1 = std::max(*size_work1, w1);
+    *size_work2 = std::max(*size_work2, w2);
+    *size_work3 = std::max(*size_work3, w3);
+    *size_work4 = std::max(*size_work4, w4);
+    *optim_mem = opt1 && opt2;
+
+    // the Gram matrices, and the array of pointers to access them as the user matrices
+    // (the same array is used for the products with R)
+    *size_G = sizeof(T) * n * n * batch_count;
+    *size_Garr = BATCHED ? 2 * sizeof(T*) * batch_count : 0;
+
+    // info of the Cholesky factorizations after the first one
+    *size_pinfo = sizeof(rocblas_int) * batch_count;
+}
+
+/** CHOLQR computes A = QR with CholeskyQR2: the Gram matrix G = A' * A is factorized
+    with POTRF as G = R' * R and A is overwritten with A * inv(R); this is done twice, and
+    the factor R is the product of both triangular factors. With the shifted algorithm
+    (rocsolver_alg_mode_shifted), a first pass on the shifted Gram matrix G + s * I makes the
+    matrix well conditioned enough for the following two passes (CholeskyQR3). Each pass reads
+    A twice (in SYRK and TRSM), independently of the number of columns. **/
+template <bool BATCHED, bool STRIDED, typename T, typename U>
+rocblas_status rocsolver_cholqr_template(rocblas_handle handle,
+                                         const rocblas_int m,
+                                         const rocblas_int n,
+                                         U A,
+                                         const rocblas_int shiftA,
+                                         const rocblas_int lda,
+                                         const rocblas_stride strideA,
+                                         T* R,
+                                         const rocblas_int shiftR,
+                                         const rocblas_int ldr,
+                                         const rocblas_stride strideR,
+                                         rocblas_int* info,
+                                         const rocblas_int batch_count,
+                                         T* scalars,
+                                         void* work1,
+                                         void* work2,
+                                         void* work3,
+                                         void* work4,
+                                         T* pivots,
+                                         rocblas_int* iinfo,
+                                         T* Gbuf,
+                                         T** Garr,
+                                         rocblas_int* pinfo,
+                                         bool optim_mem)
+{
+    ROCSOLVER_ENTER("cholqr", "m:", m, "n:", n, "shiftA:", shiftA, "lda:", lda, "shiftR:", shiftR,
+                    "ldr:", ldr, "bc:", batch_count);
+
+    using S = decltype(std::real(T{}));
+
+    // quick return if zero instances in batch
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocksReset = (batch_count - 1) / BS1 + 1;
+    dim3 gridReset(blocksReset, 1, 1);
+    dim3 threads(BS1, 1, 1);
+
+    // info=0 (starting with a full rank matrix)
+    ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, info, batch_count, 0);
+
+    // quick return if no dimensions
+    if(n == 0)
+        return rocblas_status_success;
+
+    // everything must be executed with scalars on the host
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+    T one = 1;
+    S s_one = 1;
+    S s_zero = 0;
+
+    const rocblas_stride strideG = rocblas_stride(n) * n;
+    const rocblas_int blocks = (n - 1) / 32 + 1;
+    const bool shifted = cholqr_use_shift(handle);
+    const rocblas_int passes = shifted ? 3 : 2;
+
+    // the Gram matrices are accessed in the same way as the user matrices
+    U G;
+    T** workArr = nullptr;
+    if constexpr(BATCHED)
+    {
+        ROCSOLVER_LAUNCH_KERNEL(get_array, gridReset, threads, 0, stream, Garr, Gbuf, strideG,
+                                batch_count);
+        G = Garr;
+        workArr = Garr + batch_count;
+    }
+    else
+        G = Gbuf;
+
+    for(rocblas_int pass = 0; pass < passes; ++pass)
+    {
+        // compute the Gram matrix G = A' * A (upper triangular part)
+        rocblasCall_syrk_herk<BATCHED, T>(handle, rocblas_fill_upper,
+                                          rocblas_operation_conjugate_transpose, n, m, &s_one, A,
+                                          shiftA, lda, strideA, &s_zero, G, 0, n, strideG,
+                                          batch_count);
+
+        // shift the first Gram matrix as in Fukaya et al. (2020):
+        // s = 11 * (m * n + n * (n + 1)) * eps * ||A||_F^2
+        if(shifted && pass == 0)
+        {
+            const S cte = 11 * (S(m) * n + S(n) * (n + 1)) * get_epsilon<S>();
+            ROCSOLVER_LAUNCH_KERNEL((cholqr_shift<T, S>), dim3(1, 1, batch_count), threads, 0,
+                                    stream, n, Gbuf, strideG, cte);
+        }
+
+        // factorize G = R' * R
+        rocsolver_potrf_template<false, true, T, S>(
+            handle, rocblas_fill_upper, n, Gbuf, 0, n, strideG, (pass == 0 ? info : pinfo),
+            batch_count, scalars, work1, work2, work3, work4, pivots, iinfo, optim_mem);
+        if(pass > 0)
+            ROCSOLVER_LAUNCH_KERNEL(cholqr_update_info, gridReset, threads, 0, stream, batch_count,
+                                    info, pinfo);
+
+        // update A = A * inv(R)
+        rocsolver_trsm_upper<BATCHED, STRIDED, T>(
+            handle, rocblas_side_right, rocblas_operation_none, rocblas_diagonal_non_unit, m, n, G,
+            0, 1, n, strideG, A, shiftA, 1, lda, strideA, batch_count, optim_mem, work1, work2,
+            work3, work4);
+
+        // accumulate the triangular factor
+        if(pass == 0)
+            ROCSOLVER_LAUNCH_KERNEL(cholqr_set_r<T>, dim3(blocks, blocks, batch_count),
+                                    dim3(32, 32), 0, stream, n, Gbuf, strideG, R, shiftR, ldr,
+                                    strideR);
+        else
+            rocblasCall_trmm(handle, rocblas_side_left, rocblas_fill_upper, rocblas_operation_none,
+                             rocblas_diagonal_non_unit, n, n, &one, 0, G, 0, n, strideG, R,
+                             shiftR, ldr, strideR, batch_count, workArr);
+    }
+
+    rocblas_set_pointer_mode(handle, old_mode);
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
@@ -0,0 +1,217 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "rocsolver/rocsolver.h"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/** GBTRF_KERNEL computes the LU factorization with partial pivoting of one banded matrix of the
+    batch per thread block, with the matrix in LAPACK band storage (kl extra rows on top hold the
+    fill-in of U produced by the row interchanges). The columns are processed in order as in
+    LAPACK's GBTF2; the row interchange, the scaling of the multipliers and the rank-1 update of
+    the kl-by-(kl+ku) window at each step are shared by the threads of the block. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) gbtrf_kernel(const rocblas_int m,
+                                                          const rocblas_int n,
+                                                          const rocblas_int kl,
+                                                          const rocblas_int ku,
+                                                          U AA,
+                                                          const rocblas_stride shiftA,
+                                                          const rocblas_int lda,
+                                                          const rocblas_stride strideA,
+                                                          rocblas_int* ipivA,
+                                                          const rocblas_stride strideP,
+                                                          rocblas_int* info)
+{
+    using S = decltype(std::real(T{}));
+
+    const rocblas_int bid = hipBlockIdx_y;
+    const rocblas_int tid = hipThreadIdx_x;
+
+    T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+    rocblas_int* ipiv = ipivA + bid * strideP;
+    const int64_t ld = lda;
+
+    // row of the diagonal in the band storage
+    const rocblas_int kv = kl + ku;
+
+    __shared__ rocblas_int s_jp;
+
+    // zero the fill-in rows
+    for(int64_t idx = tid; idx < int64_t(kl) * n; idx += BS1)
+        A[(idx % kl) + (idx / kl) * ld] = 0;
+    __syncthreads();
+
+    rocblas_int ju = 0;
+    rocblas_int linfo = 0;
+    const rocblas_int dim = std::min(m, n);
+
+    for(rocblas_int j = 0; j < dim; ++j)
+    {
+        T* Aj = A + kv + j * ld;
+        const rocblas_int km = std::min(kl, m - 1 - j);
+
+        // find the pivot
+        if(tid == 0)
+        {
+            rocblas_int jp = 0;
+            S pmax = aabs<S>(Aj[0]);
+            for(rocblas_int t = 1; t <= km; ++t)
+            {
+                S v = aabs<S>(Aj[t]);
+                if(v > pmax)
+                {
+                    pmax = v;
+                    jp = t;
+                }
+            }
+            s_jp = jp;
+            ipiv[j] = j + jp + 1;
+        }
+        __syncthreads();
+
+        const rocblas_int jp = s_jp;
+        const T piv = Aj[jp];
+        __syncthreads();
+
+        if(piv != T(0))
+        {
+            ju = std::max(ju, std::min(j + ku + jp, n - 1));
+
+            // interchange rows j and j+jp over columns j:ju
+            if(jp != 0)
+            {
+                for(rocblas_int c = tid; c <= ju - j; c += BS1)
+                {
+                    T* Ac = A + kv - c + (j + c) * ld;
+                    T temp = Ac[0];
+                    Ac[0] = Ac[jp];
+                    Ac[jp] = temp;
+                }
+            }
+            __syncthreads();
+
+            // compute the multipliers
+            for(rocblas_int t = tid; t < km; t += BS1)
+                Aj[1 + t] /= piv;
+            __syncthreads();
+
+            // update the trailing window A(j+1:j+km,j+1:ju)
+            const rocblas_int kn = ju - j;
+            for(rocblas_int idx = tid; idx < km * kn; idx += BS1)
+            {
+                const rocblas_int r = idx % km;
+                const rocblas_int c = idx / km;
+                T* Ac = A + kv - 1 - c + (j + 1 + c) * ld;
+                Ac[1 + r] -= Aj[1 + r] * Ac[0];
+            }
+            __syncthreads();
+        }
+        else if(linfo == 0)
+            linfo = j + 1;
+    }
+
+    if(tid == 0)
+        info[bid] = linfo;
+}
+
+template <typename T>
+rocblas_status rocsolver_gbtrf_argCheck(rocblas_handle handle,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        const rocblas_int kl,
+                                        const rocblas_int ku,
+                                        const rocblas_int ldab,
+                                        T AB,
+                                        rocblas_int* ipiv,
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    if(m < 0 || n < 0 || kl < 0 || ku < 0 || ldab < 2 * kl + ku + 1 || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((m && n && !AB) || (m && n && !ipiv) || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T, typename U>
+rocblas_status rocsolver_gbtrf_template(rocblas_handle handle,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        const rocblas_int kl,
+                                        const rocblas_int ku,
+                                        U AB,
+                                        const rocblas_stride shiftA,
+                                        const rocblas_int ldab,
+                                        const rocblas_stride strideA,
+                                        rocblas_int* ipiv,
+                                        const rocblas_stride strideP,
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER("gbtrf", "m:", m, "n:", n, "kl:", kl, "ku:", ku, "shiftA:", shiftA,
+                    "ldab:", ldab, "bc:", batch_count);
+
+    // quick return if zero instances in batch
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // quick return if no dimensions
+    if(m == 0 || n == 0)
+    {
+        rocblas_int blocks = (batch_count - 1) / BS1 + 1;
+        ROCSOLVER_LAUNCH_KERNEL(reset_info, dim3(blocks, 1, 1), dim3(BS1, 1, 1), 0, stream, info,
+                                batch_count, 0);
+        return rocblas_status_success;
+    }
+
+    ROCSOLVER_LAUNCH_KERNEL((gbtrf_kernel<T, U>), dim3(1, batch_count, 1), dim3(BS1, 1, 1), 0,
+                            stream, m, n, kl, ku, AB, shiftA, ldab, strideA, ipiv, strideP, info);
+
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
@@ -0,0 +1,150 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "roclapack_gbtrs.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+template <typename T, typename U>
+rocblas_status rocsolver_gbtrs_impl(rocblas_handle handle,
+                                    const rocblas_operation trans,
+                                    const rocblas_int n,
+                                    const rocblas_int kl,
+                                    const rocblas_int ku,
+                                    const rocblas_int nrhs,
+                                    U AB,
+                                    const rocblas_int ldab,
+                                    const rocblas_int* ipiv,
+                                    U B,
+                                    const rocblas_int ldb)
+{
+    ROCSOLVER_ENTER_TOP("gbtrs", "--trans", trans, "-n", n, "--kl", kl, "--ku", ku, "--nrhs", nrhs,
+                        "--ldab", ldab, "--ldb", ldb);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_gbtrs_argCheck(handle, trans, n, kl, ku, nrhs, ldab, ldb, AB, B,
+                                                 ipiv);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_stride shiftA = 0;
+    rocblas_stride shiftB = 0;
+
+    // normal (non-batched non-strided) execution
+    rocblas_stride strideA = 0;
+    rocblas_stride strideP = 0;
+    rocblas_stride strideB = 0;
+    rocblas_int batch_count = 1;
+
+    // this function does not require memory work space
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_size_unchanged;
+
+    // execution
+    return rocsolver_gbtrs_template<T>(handle, trans, n, kl, ku, nrhs, AB, shiftA, ldab, strideA,
+                                       ipiv, strideP, B, shiftB, ldb, strideB, batch_count);
+}
+
+ROCSOLVER_END_NAMESPACE
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sgbtrs(rocblas_handle handle,
+                                const rocblas_operation trans,
+                                const rocblas_int n,
+                                const rocblas_int kl,
+                                const rocblas_int ku,
+                                const rocblas_int nrhs,
+                                float* AB,
+                                const rocblas_int ldab,
+                                const rocblas_int* ipiv,
+                                float* B,
+                                const rocblas_int ldb)
+{
+    return rocsolver::rocsolver_gbtrs_impl<float>(handle, trans, n, kl, ku, nrhs, AB, ldab, ipiv, B,
+                                                  ldb);
+}
+
+rocblas_status rocsolver_dgbtrs(rocblas_handle handle,
+                                const rocblas_operation trans,
+                                const rocblas_int n,
+                                const rocblas_int kl,
+                                const rocblas_int ku,
+                                const rocblas_int nrhs,
+                                double* AB,
+                                const rocblas_int ldab,
+                                const rocblas_int* ipiv,
+                                double* B,
+                                const rocblas_int ldb)
+{
+    return rocsolver::rocsolver_gbtrs_impl<double>(handle, trans, n, kl, ku, nrhs, AB, ldab, ipiv,
+                                                   B, ldb);
+}
+
+rocblas_status rocsolver_cgbtrs(rocblas_handle handle,
+                                const rocblas_operation trans,
+                                const rocblas_int n,
+                                const rocblas_int kl,
+                                const rocblas_int ku,
+                                const rocblas_int nrhs,
+                                rocblas_float_complex* AB,
+                                const rocblas_int ldab,
+                                const rocblas_int* ipiv,
+                                rocblas_float_complex* B,
+                                const rocblas_int ldb)
+{
+    return rocsolver::rocsolver_gbtrs_impl<rocblas_float_complex>(handle, trans, n, kl, ku, nrhs,
+                                                                  AB, ldab, ipiv, B, ldb);
+}
+
+rocblas_status rocsolver_zgbtrs(rocblas_handle handle,
+                                const rocblas_operation trans,
+                                const rocblas_int n,
+                                const rocblas_int kl,
+                                const rocblas_int ku,
+                                const rocblas_int nrhs,
+                                rocblas_double_complex* AB,
+                                const rocblas_int ldab,
+                                const rocblas_int* ipiv,
+                                rocblas_double_complex* B,
+                                const rocblas_int ldb)
+{
+    return rocsolver::rocsolver_gbtrs_impl<rocblas_double_complex>(handle, trans, n, kl, ku, nrhs,
+                                                                   AB, ldab, ipiv, B, ldb);
+}
+
+} // extern C
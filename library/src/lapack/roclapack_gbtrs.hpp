@@ -0,0 +1,225 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "rocsolver/rocsolver.h"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/** GBTRS_KERNEL solves A * X = B, A' * X = B or A^H * X = B for one column of B per thread block,
+    using the banded LU factorization in LAPACK band storage returned by GBTRF. As in LAPACK's
+    GBTRS, the unit lower triangular factor is applied one column at a time together with the
+    row interchanges, and U is solved as a triangular band matrix with kl+ku superdiagonals. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS2) gbtrs_kernel(const rocblas_operation trans,
+                                                          const rocblas_int n,
+                                                          const rocblas_int kl,
+                                                          const rocblas_int ku,
+                                                          U AA,
+                                                          const rocblas_stride shiftA,
+                                                          const rocblas_int lda,
+                                                          const rocblas_stride strideA,
+                                                          const rocblas_int* ipivA,
+                                                          const rocblas_stride strideP,
+                                                          U BB,
+                                                          const rocblas_stride shiftB,
+                                                          const rocblas_int ldb,
+                                                          const rocblas_stride strideB)
+{
+    const rocblas_int bid = hipBlockIdx_z;
+    const rocblas_int tid = hipThreadIdx_x;
+
+    T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+    T* x = load_ptr_batch<T>(BB, bid, shiftB, strideB) + hipBlockIdx_x * int64_t(ldb);
+    const rocblas_int* ipiv = ipivA + bid * strideP;
+    const int64_t ld = lda;
+
+    // row of the diagonal in the band storage
+    const rocblas_int kv = kl + ku;
+
+    if(trans == rocblas_operation_none)
+    {
+        // solve L * Y = P * B
+        for(rocblas_int j = 0; j < n - 1; ++j)
+        {
+            const rocblas_int km = std::min(kl, n - 1 - j);
+            if(tid == 0)
+            {
+                const rocblas_int p = ipiv[j] - 1;
+                if(p != j)
+                {
+                    T temp = x[j];
+                    x[j] = x[p];
+                    x[p] = temp;
+                }
+            }
+            __syncthreads();
+
+            const T xj = x[j];
+            for(rocblas_int t = tid; t < km; t += BS2)
+                x[j + 1 + t] -= A[kv + 1 + t + j * ld] * xj;
+            __syncthreads();
+        }
+
+        // solve U * X = Y
+        for(rocblas_int j = n - 1; j >= 0; --j)
+        {
+            const T xj = x[j] / A[kv + j * ld];
+            const rocblas_int kn = std::min(kv, j);
+            __syncthreads();
+
+            if(tid == 0)
+                x[j] = xj;
+            for(rocblas_int t = tid; t < kn; t += BS2)
+                x[j - 1 - t] -= A[kv - 1 - t + j * ld] * xj;
+            __syncthreads();
+        }
+    }
+    else
+    {
+        const bool cplx = (trans == rocblas_operation_conjugate_transpose);
+
+        // solve U' * Y = B
+        for(rocblas_int j = 0; j < n; ++j)
+        {
+            const T ujj = A[kv + j * ld];
+            const T xj = x[j] / (cplx ? conj(ujj) : ujj);
+            const rocblas_int kn = std::min(kv, n - 1 - j);
+            __syncthreads();
+
+            if(tid == 0)
+                x[j] = xj;
+            for(rocblas_int t = tid; t < kn; t += BS2)
+            {
+                const T u = A[kv - 1 - t + (j + 1 + t) * ld];
+                x[j + 1 + t] -= (cplx ? conj(u) : u) * xj;
+            }
+            __syncthreads();
+        }
+
+        // solve L' * X = Y and apply the row interchanges
+        if(tid == 0)
+        {
+            for(rocblas_int j = n - 2; j >= 0; --j)
+            {
+                const rocblas_int km = std::min(kl, n - 1 - j);
+                T temp = x[j];
+                for(rocblas_int t = 0; t < km; ++t)
+                {
+                    const T l = A[kv + 1 + t + j * ld];
+                    temp -= (cplx ? conj(l) : l) * x[j + 1 + t];
+                }
+                x[j] = temp;
+
+                const rocblas_int p = ipiv[j] - 1;
+                if(p != j)
+                {
+                    x[j] = x[p];
+                    x[p] = temp;
+                }
+            }
+        }
+    }
+}
+
+template <typename T>
+rocblas_status rocsolver_gbtrs_argCheck(rocblas_handle handle,
+                                        const rocblas_operation trans,
+                                        const rocblas_int n,
+                                        const rocblas_int kl,
+                                        const rocblas_int ku,
+                                        const rocblas_int nrhs,
+                                        const rocblas_int ldab,
+                                        const rocblas_int ldb,
+                                        T AB,
+                                        T B,
+                                        const rocblas_int* ipiv,
+                                        const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(trans != rocblas_operation_none && trans != rocblas_operation_transpose
+       && trans != rocblas_operation_conjugate_transpose)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(n < 0 || kl < 0 || ku < 0 || nrhs < 0 || ldab < 2 * kl + ku + 1 || ldb < n
+       || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !AB) || (n && !ipiv) || (n && nrhs && !B))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T, typename U>
+rocblas_status rocsolver_gbtrs_template(rocblas_handle handle,
+                                        const rocblas_operation trans,
+                                        const rocblas_int n,
+                                        const rocblas_int kl,
+                                        const rocblas_int ku,
+                                        const rocblas_int nrhs,
+                                        U AB,
+                                        const rocblas_stride shiftA,
+                                        const rocblas_int ldab,
+                                        const rocblas_stride strideA,
+                                        const rocblas_int* ipiv,
+                                        const rocblas_stride strideP,
+                                        U B,
+                                        const rocblas_stride shiftB,
+                                        const rocblas_int ldb,
+                                        const rocblas_stride strideB,
+                                        const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER("gbtrs", "trans:", trans, "n:", n, "kl:", kl, "ku:", ku, "nrhs:", nrhs,
+                    "shiftA:", shiftA, "ldab:", ldab, "shiftB:", shiftB, "ldb:", ldb,
+                    "bc:", batch_count);
+
+    // quick return
+    if(n == 0 || nrhs == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    ROCSOLVER_LAUNCH_KERNEL((gbtrs_kernel<T, U>), dim3(nrhs, 1, batch_count), dim3(BS2, 1, 1), 0,
+                            stream, trans, n, kl, ku, AB, shiftA, ldab, strideA, ipiv, strideP, B,
+                            shiftB, ldb, strideB);
+
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
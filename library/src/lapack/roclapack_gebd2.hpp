@@ -4,7 +4,7 @@
  *     Univ. of Tennessee, Univ. of California Berkeley,
  *     Univ. of Colorado Denver and NAG Ltd..
  *     June 2017
- * Copyright (C) 2019-2024 Advanced Micro Devices, Inc. All rights reserved.
+ * Copyright (C) 2019-2025 Advanced Micro Devices, Inc. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions
@@ -40,6 +40,235 @@
 
 ROCSOLVER_BEGIN_NAMESPACE
 
+/************** Kernel and device functions for small sizes ******************/
+
+/** GEBD2_SMALL_LARFG generates the Householder reflector of the vector x of size k (with
+    increment incx) stored in LDS, as in LARFG. On exit, x(0) = 1, and the scalar of the reflector
+    and the value beta to which x(0) is reduced are stored in tau and beta. (All the threads of the
+    group must call this function) **/
+template <typename T, typename S>
+__device__ void gebd2_small_larfg(const rocblas_int tid,
+                                  const rocblas_int k,
+                                  T* x,
+                                  const rocblas_int incx,
+                                  T* tau,
+                                  S* beta,
+                                  T* scal)
+{
+    if(tid == 0)
+    {
+        S xnorm2 = 0;
+        for(rocblas_int i = 1; i < k; i++)
+            xnorm2 += std::norm(x[i * incx]);
+
+        larfg_set_taubeta(x[0], xnorm2, *tau, *scal, *beta);
+        x[0] = 1;
+    }
+    __syncthreads();
+
+    for(rocblas_int i = tid + 1; i < k; i += hipBlockDim_x)
+        x[i * incx] *= *scal;
+    __syncthreads();
+}
+
+/** GEBD2_SMALL_LARF applies the Householder reflector H = I - tau * v * v' to the r-by-c matrix C
+    stored in LDS, from the left (H * C, with v of size r and increment 1) or from the right
+    (C * H, with v of size c and increment incv). (All the threads of the group must call this
+    function) **/
+template <typename T>
+__device__ void gebd2_small_larf(const rocblas_int tid,
+                                 const rocblas_side side,
+                                 const rocblas_int r,
+                                 const rocblas_int c,
+                                 T* v,
+                                 const rocblas_int incv,
+                                 const T tau,
+                                 T* C,
+                                 const rocblas_int ldc)
+{
+    if(side == rocblas_side_left)
+    {
+        // each thread updates a different column
+        for(rocblas_int j = tid; j < c; j += hipBlockDim_x)
+        {
+            T w = 0;
+            for(rocblas_int i = 0; i < r; i++)
+                w += conj(v[i]) * C[i + j * ldc];
+            w *= tau;
+            for(rocblas_int i = 0; i < r; i++)
+                C[i + j * ldc] -= v[i] * w;
+        }
+    }
+    else
+    {
+        // each thread updates a different row
+        for(rocblas_int i = tid; i < r; i += hipBlockDim_x)
+        {
+            T w = 0;
+            for(rocblas_int j = 0; j < c; j++)
+                w += C[i + j * ldc] * v[j * incv];
+            w *= tau;
+            for(rocblas_int j = 0; j < c; j++)
+                C[i + j * ldc] -= w * conj(v[j * incv]);
+        }
+    }
+    __syncthreads();
+}
+
+/** GEBD2_SMALL_LACGV conjugates the vector x of size k (with increment incx) stored in LDS.
+    (All the threads of the group must call this function) **/
+template <typename T>
+__device__ void gebd2_small_lacgv(const rocblas_int tid,
+                                  const rocblas_int k,
+                                  T* x,
+                                  const rocblas_int incx)
+{
+    if(rocblas_is_complex<T>)
+    {
+        for(rocblas_int i = tid; i < k; i += hipBlockDim_x)
+            x[i * incx] = conj(x[i * incx]);
+        __syncthreads();
+    }
+}
+
+/** GEBD2_SMALL_KERNEL reduces matrices with m, n <= GEBD2_SMALL_MAX_SIZE to bidiagonal form with
+    a single kernel call. The matrix is kept in the LDS shared memory, and the Householder
+    reflectors are generated and applied as in GEBD2.
+    Call this kernel with batch_count groups in z, and BS1 threads in x. **/
+template <typename T, typename S, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) gebd2_small_kernel(const rocblas_int m,
+                                                                const rocblas_int n,
+                                                                U AA,
+                                                                const rocblas_int shiftA,
+                                                                const rocblas_int lda,
+                                                                const rocblas_stride strideA,
+                                                                S* DD,
+                                                                const rocblas_stride strideD,
+                                                                S* EE,
+                                                                const rocblas_stride strideE,
+                                                                T* tauqA,
+                                                                const rocblas_stride strideQ,
+                                                                T* taupA,
+                                                                const rocblas_stride strideP)
+{
+    const rocblas_int tid = hipThreadIdx_x;
+    const rocblas_int bid = hipBlockIdx_z;
+    const rocblas_int mn = m * n;
+
+    T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+    S* D = DD + bid * strideD;
+    S* E = EE + bid * strideE;
+    T* tauq = tauqA + bid * strideQ;
+    T* taup = taupA + bid * strideP;
+
+    // shared memory setup:
+    // sA holds the matrix with leading dimension m
+    extern __shared__ double lmem[];
+    T* sA = reinterpret_cast<T*>(lmem);
+    __shared__ T tau, scal;
+    __shared__ S beta;
+
+    // load the matrix
+    for(rocblas_int k = tid; k < mn; k += hipBlockDim_x)
+        sA[k] = A[(k % m) + (k / m) * lda];
+    __syncthreads();
+
+    if(m >= n)
+    {
+        // generate upper bidiagonal form
+        for(rocblas_int j = 0; j < n; j++)
+        {
+            // generate and apply Householder reflector H(j)
+            T* x = sA + j + j * m;
+            gebd2_small_larfg(tid, m - j, x, 1, &tau, &beta, &scal);
+            if(tid == 0)
+            {
+                tauq[j] = tau;
+                D[j] = beta;
+            }
+            if(j < n - 1)
+                gebd2_small_larf(tid, rocblas_side_left, m - j, n - j - 1, x, 1, conj(tau),
+                                 x + m, m);
+            if(tid == 0)
+                x[0] = beta;
+
+            if(j < n - 1)
+            {
+                // generate and apply Householder reflector G(j)
+                T* y = sA + j + (j + 1) * m;
+                gebd2_small_lacgv(tid, n - j - 1, y, m);
+                gebd2_small_larfg(tid, n - j - 1, y, m, &tau, &beta, &scal);
+                if(tid == 0)
+                {
+                    taup[j] = tau;
+                    E[j] = beta;
+                }
+                gebd2_small_larf(tid, rocblas_side_right, m - j - 1, n - j - 1, y, m, tau, y + 1,
+                                 m);
+                gebd2_small_lacgv(tid, n - j - 1, y, m);
+                if(tid == 0)
+                    y[0] = beta;
+            }
+            else if(tid == 0)
+                taup[j] = 0;
+        }
+    }
+    else
+    {
+        // generate lower bidiagonal form
+        for(rocblas_int j = 0; j < m; j++)
+        {
+            // generate and apply Householder reflector G(j)
+            T* y = sA + j + j * m;
+            gebd2_small_lacgv(tid, n - j, y, m);
+            gebd2_small_larfg(tid, n - j, y, m, &tau, &beta, &scal);
+            if(tid == 0)
+            {
+                taup[j] = tau;
+                D[j] = beta;
+            }
+            if(j < m - 1)
+                gebd2_small_larf(tid, rocblas_side_right, m - j - 1, n - j, y, m, tau, y + 1, m);
+            gebd2_small_lacgv(tid, n - j, y, m);
+            if(tid == 0)
+                y[0] = beta;
+
+            if(j < m - 1)
+            {
+                // generate and apply Householder reflector H(j)
+                T* x = sA + (j + 1) + j * m;
+                gebd2_small_larfg(tid, m - j - 1, x, 1, &tau, &beta, &scal);
+                if(tid == 0)
+                {
+                    tauq[j] = tau;
+                    E[j] = beta;
+                }
+                gebd2_small_larf(tid, rocblas_side_left, m - j - 1, n - j - 1, x, 1, conj(tau),
+                                 x + m, m);
+                if(tid == 0)
+                    x[0] = beta;
+            }
+            else if(tid == 0)
+                tauq[j] = 0;
+        }
+    }
+    __syncthreads();
+
+    // write the results back to global memory
+    for(rocblas_int k = tid; k < mn; k += hipBlockDim_x)
+        A[(k % m) + (k / m) * lda] = sA[k];
+}
+
+/** GEBD2_USE_SMALL_KERNEL returns true if the m-by-n matrix is reduced with gebd2_small_kernel
+    (the matrix must fit within (64 * 1024) bytes of LDS, together with the few shared scalars of
+    the kernel) **/
+template <typename T>
+bool gebd2_use_small_kernel(const rocblas_int m, const rocblas_int n)
+{
+    return m <= GEBD2_SMALL_MAX_SIZE && n <= GEBD2_SMALL_MAX_SIZE
+        && sizeof(T) * (m * n + 4) <= 64 * 1024;
+}
+
 template <bool BATCHED, typename T>
 void rocsolver_gebd2_getMemorySize(const rocblas_int m,
                                    const rocblas_int n,
@@ -57,11 +286,20 @@ void rocsolver_gebd2_getMemorySize(const rocblas_int m,
         return;
     }
 
+    // no workspace needed by the small-size kernel
+    if(gebd2_use_small_kernel<T>(m, n))
+    {
+        *size_scalars = 0;
+        *size_work_workArr = 0;
+        *size_Abyx_norms = 0;
+        return;
+    }
+
     // size of Abyx_norms is maximum of what is needed by larf and larfg
     // size_work_workArr is maximum of re-usable work space and array of pointers to workspace
     size_t s1, s2, w1, w2;
     rocsolver_larf_getMemorySize<BATCHED, T>(rocblas_side_both, m, n, batch_count, size_scalars,
-                                             &s1, &w1);
+                                             &s1, &w1, true);
     rocsolver_larfg_getMemorySize<T>(std::max(m, n), batch_count, &w2, &s2);
     *size_work_workArr = std::max(w1, w2);
     *size_Abyx_norms = std::max(s1, s2);
@@ -129,6 +367,16 @@ rocblas_status rocsolver_gebd2_template(rocblas_handle handle,
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
+    // small-size case (single kernel call)
+    if(gebd2_use_small_kernel<T>(m, n))
+    {
+        size_t lmemsize = sizeof(T) * m * n;
+        ROCSOLVER_LAUNCH_KERNEL((gebd2_small_kernel<T>), dim3(1, 1, batch_count), dim3(BS1),
+                                lmemsize, stream, m, n, A, shiftA, lda, strideA, D, strideD, E,
+                                strideE, tauq, strideQ, taup, strideP);
+        return rocblas_status_success;
+    }
+
     rocblas_int dim = std::min(m, n); // total number of pivots
 
     if(m >= n)
@@ -169,15 +417,13 @@ rocblas_status rocsolver_gebd2_template(rocblas_handle handle,
 
             if(j < n - 1)
             {
-                if(COMPLEX)
-                    rocsolver_lacgv_template<T>(handle, n - j - 1, A, shiftA + idx2D(j, j + 1, lda),
-                                                lda, strideA, batch_count);
-
                 // generate Householder reflector G(j)
+                // (the row holds the conjugate of the Householder vector, which is read and
+                // written as such by LARFG and LARF)
                 rocsolver_larfg_template(handle, n - j - 1, A, shiftA + idx2D(j, j + 1, lda), A,
                                          shiftA + idx2D(j, std::min(j + 2, n - 1), lda), lda,
                                          strideA, (taup + j), strideP, batch_count,
-                                         (T*)work_workArr, Abyx_norms);
+                                         (T*)work_workArr, Abyx_norms, true);
 
                 // copy A(j,j+1) to E and insert one to build/apply the householder
                 // matrix
@@ -189,11 +435,7 @@ rocblas_status rocsolver_gebd2_template(rocblas_handle handle,
                 rocsolver_larf_template(handle, rocblas_side_right, m - j - 1, n - j - 1, A,
                                         shiftA + idx2D(j, j + 1, lda), lda, strideA, (taup + j),
                                         strideP, A, shiftA + idx2D(j + 1, j + 1, lda), lda, strideA,
-                                        batch_count, scalars, Abyx_norms, (T**)work_workArr);
-
-                if(COMPLEX)
-                    rocsolver_lacgv_template<T>(handle, n - j - 1, A, shiftA + idx2D(j, j + 1, lda),
-                                                lda, strideA, batch_count);
+                                        batch_count, scalars, Abyx_norms, (T**)work_workArr, true);
 
                 // restore original value of A(j,j+1)
                 ROCSOLVER_LAUNCH_KERNEL(restore_diag<T>, dim3(batch_count, 1, 1), dim3(1, 1, 1), 0,
@@ -213,14 +455,13 @@ rocblas_status rocsolver_gebd2_template(rocblas_handle handle,
         // generate lower bidiagonal form
         for(rocblas_int j = 0; j < m; j++)
         {
-            if(COMPLEX)
-                rocsolver_lacgv_template<T>(handle, n - j, A, shiftA + idx2D(j, j, lda), lda,
-                                            strideA, batch_count);
-
             // generate Householder reflector G(j)
+            // (the row holds the conjugate of the Householder vector, which is read and written
+            // as such by LARFG and LARF)
             rocsolver_larfg_template(handle, n - j, A, shiftA + idx2D(j, j, lda), A,
                                      shiftA + idx2D(j, std::min(j + 1, n - 1), lda), lda, strideA,
-                                     (taup + j), strideP, batch_count, (T*)work_workArr, Abyx_norms);
+                                     (taup + j), strideP, batch_count, (T*)work_workArr, Abyx_norms,
+                                     true);
 
             // copy A(j,j) to D and insert one to build/apply the householder matrix
             ROCSOLVER_LAUNCH_KERNEL(set_diag<T>, dim3(batch_count, 1, 1), dim3(1, 1, 1), 0, stream, D,
@@ -232,13 +473,9 @@ rocblas_status rocsolver_gebd2_template(rocblas_handle handle,
                 rocsolver_larf_template(handle, rocblas_side_right, m - j - 1, n - j, A,
                                         shiftA + idx2D(j, j, lda), lda, strideA, (taup + j),
                                         strideP, A, shiftA + idx2D(j + 1, j, lda), lda, strideA,
-                                        batch_count, scalars, Abyx_norms, (T**)work_workArr);
+                                        batch_count, scalars, Abyx_norms, (T**)work_workArr, true);
             }
 
-            if(COMPLEX)
-                rocsolver_lacgv_template<T>(handle, n - j, A, shiftA + idx2D(j, j, lda), lda,
-                                            strideA, batch_count);
-
             // restore original value of A(j,j)
             ROCSOLVER_LAUNCH_KERNEL(restore_diag<T>, dim3(batch_count, 1, 1), dim3(1, 1, 1), 0,
                                     stream, D, j, strideD, A, shiftA + idx2D(j, j, lda), lda,
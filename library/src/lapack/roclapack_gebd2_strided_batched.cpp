@@ -63,7 +63,7 @@ rocblas_status rocsolver_gebd2_strided_batched_impl(rocblas_handle handle,
     rocblas_int shiftA = 0;
 
     // memory workspace sizes:
-    // size for constants in rocblas calls
+    // constants in rocblas calls (only whether they are needed, see set_device_scalars)
     size_t size_scalars;
     // size of arrays of pointers (for batched cases) and re-usable workspace
     size_t size_work_workArr;
@@ -73,12 +73,12 @@ rocblas_status rocsolver_gebd2_strided_batched_impl(rocblas_handle handle,
                                             &size_Abyx_norms);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work_workArr,
+        return rocblas_set_optimal_device_memory_size(handle, size_t(0), size_work_workArr,
                                                       size_Abyx_norms);
 
     // memory workspace allocation
     void *scalars, *work_workArr, *Abyx_norms;
-    rocblas_device_malloc mem(handle, size_scalars, size_work_workArr, size_Abyx_norms);
+    rocblas_device_malloc mem(handle, size_t(0), size_work_workArr, size_Abyx_norms);
 
     if(!mem)
         return rocblas_status_memory_error;
@@ -87,7 +87,7 @@ rocblas_status rocsolver_gebd2_strided_batched_impl(rocblas_handle handle,
     work_workArr = mem[1];
     Abyx_norms = mem[2];
     if(size_scalars > 0)
-        init_scalars(handle, (T*)scalars);
+        ROCBLAS_CHECK(set_device_scalars<T>(scalars));
 
     // execution
     return rocsolver_gebd2_template<T>(handle, m, n, A, shiftA, lda, strideA, D, strideD, E,
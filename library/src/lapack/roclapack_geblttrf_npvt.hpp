@@ -28,6 +28,7 @@
 #pragma once
 
 #include "rocblas.hpp"
+#include "roclapack_geblttrs_npvt.hpp"
 #include "roclapack_getrf.hpp"
 #include "roclapack_getrs.hpp"
 #include "rocsolver/rocsolver.h"
@@ -48,6 +49,231 @@ ROCSOLVER_KERNEL void
     }
 }
 
+/** GEBLTTRF_LU computes the LU factorization without pivoting of the nb-by-nb block sB in LDS,
+    with one thread per entry (i, j). The index of the first zero pivot, shifted by offset, is
+    recorded in info if info is zero. **/
+template <typename T>
+__device__ void geblttrf_lu(const rocblas_int nb,
+                            const rocblas_int i,
+                            const rocblas_int j,
+                            T* sB,
+                            rocblas_int& info,
+                            const rocblas_int offset)
+{
+    using S = decltype(std::real(T{}));
+
+    for(rocblas_int k = 0; k < nb; k++)
+    {
+        T pivot = sB[k + k * nb];
+        T inv = (pivot != T(0)) ? T(S(1) / pivot) : T(0);
+
+        // check singularity
+        if(pivot == T(0) && info == 0)
+            info = k + 1 + offset;
+
+        // scale current column and update trailing matrix
+        T l = 0, u = 0;
+        if(i > k && j >= k)
+        {
+            l = sB[i + k * nb] * inv;
+            u = sB[k + j * nb];
+        }
+        __syncthreads();
+
+        if(i > k && j == k)
+            sB[i + k * nb] = l;
+        else if(i > k && j > k)
+            sB[i + j * nb] -= l * u;
+        __syncthreads();
+    }
+}
+
+/** GEBLTTRF_NPVT_FUSED_KERNEL runs the whole block recurrence of GEBLTTRF_NPVT with a single
+    launch. Each thread block takes care of one batch instance, with one thread per entry of a
+    block. The current diagonal block is kept in LDS. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void geblttrf_npvt_fused_kernel(const rocblas_int nb,
+                                                 const rocblas_int nblocks,
+                                                 U AA,
+                                                 const rocblas_int shiftA,
+                                                 const rocblas_int inca,
+                                                 const rocblas_int lda,
+                                                 const rocblas_stride strideA,
+                                                 U BB,
+                                                 const rocblas_int shiftB,
+                                                 const rocblas_int incb,
+                                                 const rocblas_int ldb,
+                                                 const rocblas_stride strideB,
+                                                 U CC,
+                                                 const rocblas_int shiftC,
+                                                 const rocblas_int incc,
+                                                 const rocblas_int ldc,
+                                                 const rocblas_stride strideC,
+                                                 rocblas_int* infoA)
+{
+    const rocblas_int i = hipThreadIdx_x;
+    const rocblas_int j = hipThreadIdx_y;
+    const rocblas_int bid = hipBlockIdx_y;
+
+    // batch instance
+    T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+    T* B = load_ptr_batch<T>(BB, bid, shiftB, strideB);
+    T* C = load_ptr_batch<T>(CC, bid, shiftC, strideC);
+
+    // block strides
+    const rocblas_stride bsa = rocblas_stride(lda) * nb;
+    const rocblas_stride bsb = rocblas_stride(ldb) * nb;
+    const rocblas_stride bsc = rocblas_stride(ldc) * nb;
+
+    // shared memory
+    extern __shared__ double lmem[];
+    T* sB = reinterpret_cast<T*>(lmem);
+    T* sC = sB + nb * nb;
+
+    rocblas_int info = 0;
+
+    // factorize the first diagonal block
+    sB[i + j * nb] = B[i * incb + j * ldb];
+    __syncthreads();
+
+    geblttrf_lu<T>(nb, i, j, sB, info, 0);
+    B[i * incb + j * ldb] = sB[i + j * nb];
+
+    for(rocblas_int k = 0; k < nblocks - 1; k++)
+    {
+        // C_k = inv(B_k) * C_k
+        T x = C[k * bsc + i * incc + j * ldc];
+        geblttr_lu_solve<T>(nb, i, j, sB, sC, x);
+        C[k * bsc + i * incc + j * ldc] = x;
+
+        // B_{k+1} = B_{k+1} - A_k * C_k
+        T b = B[(k + 1) * bsb + i * incb + j * ldb];
+        for(rocblas_int p = 0; p < nb; p++)
+            b -= A[k * bsa + i * inca + p * lda] * sC[p + j * nb];
+        sB[i + j * nb] = b;
+        __syncthreads();
+
+        // factorize the next diagonal block
+        geblttrf_lu<T>(nb, i, j, sB, info, (k + 1) * nb);
+        B[(k + 1) * bsb + i * incb + j * ldb] = sB[i + j * nb];
+    }
+
+    if(i == 0 && j == 0)
+        infoA[bid] = info;
+}
+
+/** GEBLTTRF_NPVT_INTERLEAVED_KERNEL runs the whole block recurrence of GEBLTTRF_NPVT for one
+    batch instance per thread, working directly in global memory. It is meant for interleaved
+    batches (inca = incb = incc = batch_count and strideA = strideB = strideC = 1), where the
+    element (i,j) of consecutive instances is contiguous in memory and all the accesses of a
+    wavefront are coalesced. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void geblttrf_npvt_interleaved_kernel(const rocblas_int nb,
+                                                       const rocblas_int nblocks,
+                                                       U AA,
+                                                       const rocblas_int shiftA,
+                                                       const rocblas_int inca,
+                                                       const rocblas_int lda,
+                                                       const rocblas_stride strideA,
+                                                       U BB,
+                                                       const rocblas_int shiftB,
+                                                       const rocblas_int incb,
+                                                       const rocblas_int ldb,
+                                                       const rocblas_stride strideB,
+                                                       U CC,
+                                                       const rocblas_int shiftC,
+                                                       const rocblas_int incc,
+                                                       const rocblas_int ldc,
+                                                       const rocblas_stride strideC,
+                                                       rocblas_int* infoA,
+                                                       const rocblas_int batch_count)
+{
+    using S = decltype(std::real(T{}));
+
+    rocblas_int bid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    if(bid >= batch_count)
+        return;
+
+    // batch instance
+    T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+    T* B = load_ptr_batch<T>(BB, bid, shiftB, strideB);
+    T* C = load_ptr_batch<T>(CC, bid, shiftC, strideC);
+
+    const int64_t ia = inca;
+    const int64_t la = lda;
+    const int64_t ib = incb;
+    const int64_t lb = ldb;
+    const int64_t ic = incc;
+    const int64_t lc = ldc;
+    rocblas_int info = 0;
+
+    for(rocblas_int k = 0; k < nblocks; k++)
+    {
+        T* Bk = B + k * nb * lb;
+
+        // B_k = B_k - A_{k-1} * C_{k-1}
+        if(k > 0)
+        {
+            const T* Ak = A + (k - 1) * nb * la;
+            const T* Ck = C + (k - 1) * nb * lc;
+            for(rocblas_int j = 0; j < nb; j++)
+            {
+                for(rocblas_int p = 0; p < nb; p++)
+                {
+                    const T cpj = Ck[p * ic + j * lc];
+                    for(rocblas_int i = 0; i < nb; i++)
+                        Bk[i * ib + j * lb] -= Ak[i * ia + p * la] * cpj;
+                }
+            }
+        }
+
+        // factorize B_k
+        for(rocblas_int q = 0; q < nb; q++)
+        {
+            T pivot_value = Bk[q * ib + q * lb];
+            if(pivot_value == T(0) && info == 0)
+                info = q + 1 + k * nb;
+
+            // scale current column and update trailing matrix
+            pivot_value = (pivot_value != T(0)) ? T(S(1) / pivot_value) : T(0);
+            for(rocblas_int i = q + 1; i < nb; i++)
+                Bk[i * ib + q * lb] *= pivot_value;
+
+            for(rocblas_int j = q + 1; j < nb; j++)
+            {
+                const T bqj = Bk[q * ib + j * lb];
+                for(rocblas_int i = q + 1; i < nb; i++)
+                    Bk[i * ib + j * lb] -= Bk[i * ib + q * lb] * bqj;
+            }
+        }
+
+        // C_k = inv(B_k) * C_k
+        if(k < nblocks - 1)
+        {
+            T* Ck = C + k * nb * lc;
+            for(rocblas_int j = 0; j < nb; j++)
+            {
+                for(rocblas_int p = 0; p < nb; p++)
+                {
+                    const T cpj = Ck[p * ic + j * lc];
+                    for(rocblas_int i = p + 1; i < nb; i++)
+                        Ck[i * ic + j * lc] -= Bk[i * ib + p * lb] * cpj;
+                }
+
+                for(rocblas_int p = nb - 1; p >= 0; p--)
+                {
+                    const T cpj = Ck[p * ic + j * lc] / Bk[p * ib + p * lb];
+                    Ck[p * ic + j * lc] = cpj;
+                    for(rocblas_int i = 0; i < p; i++)
+                        Ck[i * ic + j * lc] -= Bk[i * ib + p * lb] * cpj;
+                }
+            }
+        }
+    }
+
+    infoA[bid] = info;
+}
+
 template <bool BATCHED, bool STRIDED, typename T>
 void rocsolver_geblttrf_npvt_getMemorySize(const rocblas_int nb,
                                            const rocblas_int nblocks,
@@ -84,6 +310,23 @@ void rocsolver_geblttrf_npvt_getMemorySize(const rocblas_int nb,
         return;
     }
 
+    // the fused kernel needs no workspace
+    if(nb <= GEBLTTR_FUSED_MAX_NB)
+    {
+        *size_scalars = 0;
+        *size_work1 = 0;
+        *size_work2 = 0;
+        *size_work3 = 0;
+        *size_work4 = 0;
+        *size_pivotval = 0;
+        *size_pivotidx = 0;
+        *size_iipiv = 0;
+        *size_iinfo1 = 0;
+        *size_iinfo2 = 0;
+        *optim_mem = true;
+        return;
+    }
+
     bool unused;
     size_t a1 = 0, a2 = 0;
     size_t b1 = 0, b2 = 0;
@@ -109,6 +352,51 @@ void rocsolver_geblttrf_npvt_getMemorySize(const rocblas_int nb,
     *size_iinfo2 = sizeof(rocblas_int) * batch_count;
 }
 
+/** Interleaved batches with small blocks: one instance per thread (no workspace is needed) **/
+template <typename T, typename U>
+rocblas_status rocsolver_geblttrf_npvt_interleaved_template(rocblas_handle handle,
+                                                            const rocblas_int nb,
+                                                            const rocblas_int nblocks,
+                                                            U A,
+                                                            const rocblas_int shiftA,
+                                                            const rocblas_int inca,
+                                                            const rocblas_int lda,
+                                                            const rocblas_stride strideA,
+                                                            U B,
+                                                            const rocblas_int shiftB,
+                                                            const rocblas_int incb,
+                                                            const rocblas_int ldb,
+                                                            const rocblas_stride strideB,
+                                                            U C,
+                                                            const rocblas_int shiftC,
+                                                            const rocblas_int incc,
+                                                            const rocblas_int ldc,
+                                                            const rocblas_stride strideC,
+                                                            rocblas_int* info,
+                                                            const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER("geblttrf_npvt_interleaved", "nb:", nb, "nblocks:", nblocks, "shiftA:", shiftA,
+                    "inca:", inca, "lda:", lda, "shiftB:", shiftB, "incb:", incb, "ldb:", ldb,
+                    "shiftC:", shiftC, "incc:", incc, "ldc:", ldc, "bc:", batch_count);
+
+    // quick return
+    if(nb == 0 || nblocks == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocks = (batch_count - 1) / BS1 + 1;
+    dim3 grid(blocks, 1, 1);
+    dim3 threads(BS1, 1, 1);
+
+    ROCSOLVER_LAUNCH_KERNEL((geblttrf_npvt_interleaved_kernel<T, U>), grid, threads, 0, stream, nb,
+                            nblocks, A, shiftA, inca, lda, strideA, B, shiftB, incb, ldb, strideB,
+                            C, shiftC, incc, ldc, strideC, info, batch_count);
+
+    return rocblas_status_success;
+}
+
 template <typename T>
 rocblas_status rocsolver_geblttrf_npvt_argCheck(rocblas_handle handle,
                                                 const rocblas_int nb,
@@ -199,6 +487,20 @@ rocblas_status rocsolver_geblttrf_npvt_template(rocblas_handle handle,
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
+    // small blocks: factorize with a single kernel launch
+    if(nb <= GEBLTTR_FUSED_MAX_NB)
+    {
+        dim3 grid(1, batch_count, 1);
+        dim3 threads(nb, nb, 1);
+        size_t lmemsize = sizeof(T) * 2 * nb * nb;
+
+        ROCSOLVER_LAUNCH_KERNEL(geblttrf_npvt_fused_kernel<T>, grid, threads, lmemsize, stream, nb,
+                                nblocks, A, shiftA, inca, lda, strideA, B, shiftB, incb, ldb,
+                                strideB, C, shiftC, incc, ldc, strideC, info);
+
+        return rocblas_status_success;
+    }
+
     rocblas_int blocksReset = (batch_count - 1) / BS1 + 1;
     dim3 gridReset(blocksReset, 1, 1);
     dim3 threads(BS1, 1, 1);
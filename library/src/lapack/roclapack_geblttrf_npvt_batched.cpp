@@ -44,6 +44,7 @@ rocblas_status rocsolver_geblttrf_npvt_batched_impl(rocblas_handle handle,
 {
     ROCSOLVER_ENTER_TOP("geblttrf_npvt_batched", "--nb", nb, "--nblocks", nblocks, "--lda", lda,
                         "--ldb", ldb, "--ldc", ldc, "--batch_count", batch_count);
+    ROCSOLVER_INFO_SUMMARY(info, batch_count);
 
     if(!handle)
         return rocblas_status_invalid_handle;
@@ -81,12 +82,12 @@ rocblas_status rocsolver_geblttrf_npvt_batched_impl(rocblas_handle handle,
 
     if(rocblas_is_device_memory_size_query(handle))
         return rocblas_set_optimal_device_memory_size(
-            handle, size_scalars, size_work1, size_work2, size_work3, size_work4, size_pivotval,
+            handle, size_t(0), size_work1, size_work2, size_work3, size_work4, size_pivotval,
             size_pivotidx, size_iipiv, size_iinfo1, size_iinfo2);
 
     // memory workspace allocation
     void *scalars, *work1, *work2, *work3, *work4, *pivotval, *pivotidx, *iipiv, *iinfo1, *iinfo2;
-    rocblas_device_malloc mem(handle, size_scalars, size_work1, size_work2, size_work3, size_work4,
+    rocblas_device_malloc mem(handle, size_t(0), size_work1, size_work2, size_work3, size_work4,
                               size_pivotval, size_pivotidx, size_iipiv, size_iinfo1, size_iinfo2);
 
     if(!mem)
@@ -103,14 +104,14 @@ rocblas_status rocsolver_geblttrf_npvt_batched_impl(rocblas_handle handle,
     iinfo1 = mem[8];
     iinfo2 = mem[9];
     if(size_scalars > 0)
-        init_scalars(handle, (T*)scalars);
+        ROCBLAS_CHECK(set_device_scalars<T>(scalars));
 
     // Execution
-    return rocsolver_geblttrf_npvt_template<true, false, T>(
+    return _info_summary_scope.commit(rocsolver_geblttrf_npvt_template<true, false, T>(
         handle, nb, nblocks, A, shiftA, inca, lda, strideA, B, shiftB, incb, ldb, strideB, C,
         shiftC, incc, ldc, strideC, info, batch_count, (T*)scalars, work1, work2, work3, work4,
         (T*)pivotval, (rocblas_int*)pivotidx, (rocblas_int*)iipiv, (rocblas_int*)iinfo1,
-        (rocblas_int*)iinfo2, optim_mem);
+        (rocblas_int*)iinfo2, optim_mem));
 }
 
 ROCSOLVER_END_NAMESPACE
@@ -34,6 +34,137 @@
 
 ROCSOLVER_BEGIN_NAMESPACE
 
+/** GEBLTTR_LU_SOLVE overwrites the entry x, held by the thread in row i and LDS column jj, with
+    the corresponding entry of inv(U) * inv(L) * X, where L and U are the factors of the nb-by-nb
+    block sB as returned by GETRF_NPVT. The column jj of sX is used for communication, and
+    contains the solution on exit. **/
+template <typename T>
+__device__ void geblttr_lu_solve(const rocblas_int nb,
+                                 const rocblas_int i,
+                                 const rocblas_int jj,
+                                 const T* sB,
+                                 T* sX,
+                                 T& x)
+{
+    // forward substitution with the unit lower triangular factor
+    for(rocblas_int p = 0; p < nb; p++)
+    {
+        if(i == p)
+            sX[p + jj * nb] = x;
+        __syncthreads();
+
+        if(i > p)
+            x -= sB[i + p * nb] * sX[p + jj * nb];
+    }
+    __syncthreads();
+
+    // backward substitution with the upper triangular factor
+    for(rocblas_int p = nb - 1; p >= 0; p--)
+    {
+        if(i == p)
+        {
+            x = x / sB[p + p * nb];
+            sX[p + jj * nb] = x;
+        }
+        __syncthreads();
+
+        if(i < p)
+            x -= sB[i + p * nb] * sX[p + jj * nb];
+    }
+}
+
+/** GEBLTTRS_NPVT_FUSED_KERNEL runs the forward and backward block sweeps of GEBLTTRS_NPVT with
+    a single launch. Each thread block takes care of one batch instance and hipBlockDim_y columns
+    of X, with one thread per entry of the current block row. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void geblttrs_npvt_fused_kernel(const rocblas_int nb,
+                                                 const rocblas_int nblocks,
+                                                 const rocblas_int nrhs,
+                                                 U AA,
+                                                 const rocblas_int shiftA,
+                                                 const rocblas_int inca,
+                                                 const rocblas_int lda,
+                                                 const rocblas_stride strideA,
+                                                 U BB,
+                                                 const rocblas_int shiftB,
+                                                 const rocblas_int incb,
+                                                 const rocblas_int ldb,
+                                                 const rocblas_stride strideB,
+                                                 U CC,
+                                                 const rocblas_int shiftC,
+                                                 const rocblas_int incc,
+                                                 const rocblas_int ldc,
+                                                 const rocblas_stride strideC,
+                                                 U XX,
+                                                 const rocblas_int shiftX,
+                                                 const rocblas_int incx,
+                                                 const rocblas_int ldx,
+                                                 const rocblas_stride strideX)
+{
+    const rocblas_int i = hipThreadIdx_x;
+    const rocblas_int jj = hipThreadIdx_y;
+    const rocblas_int j = hipBlockIdx_x * hipBlockDim_y + jj;
+    const rocblas_int bid = hipBlockIdx_y;
+    const bool active = (j < nrhs);
+
+    // batch instance
+    T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+    T* B = load_ptr_batch<T>(BB, bid, shiftB, strideB);
+    T* C = load_ptr_batch<T>(CC, bid, shiftC, strideC);
+    T* X = load_ptr_batch<T>(XX, bid, shiftX, strideX);
+
+    // block strides
+    const rocblas_stride bsa = rocblas_stride(lda) * nb;
+    const rocblas_stride bsb = rocblas_stride(ldb) * nb;
+    const rocblas_stride bsc = rocblas_stride(ldc) * nb;
+    const rocblas_stride bsx = rocblas_stride(ldx) * nrhs;
+
+    // shared memory
+    extern __shared__ double lmem[];
+    T* sB = reinterpret_cast<T*>(lmem);
+    T* sX = sB + nb * nb;
+
+    T x = 0;
+
+    // forward solve
+    for(rocblas_int k = 0; k < nblocks; k++)
+    {
+        if(active)
+            x = X[k * bsx + i * incx + j * ldx];
+        if(k > 0)
+        {
+            for(rocblas_int p = 0; p < nb; p++)
+                x -= A[(k - 1) * bsa + i * inca + p * lda] * sX[p + jj * nb];
+        }
+        __syncthreads();
+
+        for(rocblas_int c = jj; c < nb; c += hipBlockDim_y)
+            sB[i + c * nb] = B[k * bsb + i * incb + c * ldb];
+        __syncthreads();
+
+        geblttr_lu_solve<T>(nb, i, jj, sB, sX, x);
+
+        if(active)
+            X[k * bsx + i * incx + j * ldx] = x;
+    }
+
+    // backward solve
+    for(rocblas_int k = nblocks - 2; k >= 0; k--)
+    {
+        if(active)
+            x = X[k * bsx + i * incx + j * ldx];
+        for(rocblas_int p = 0; p < nb; p++)
+            x -= C[k * bsc + i * incc + p * ldc] * sX[p + jj * nb];
+        __syncthreads();
+
+        sX[i + jj * nb] = x;
+        __syncthreads();
+
+        if(active)
+            X[k * bsx + i * incx + j * ldx] = x;
+    }
+}
+
 template <bool BATCHED, bool STRIDED, typename T>
 void rocsolver_geblttrs_npvt_getMemorySize(const rocblas_int nb,
                                            const rocblas_int nblocks,
@@ -59,6 +190,17 @@ void rocsolver_geblttrs_npvt_getMemorySize(const rocblas_int nb,
         return;
     }
 
+    // the fused kernel needs no workspace
+    if(nb <= GEBLTTR_FUSED_MAX_NB)
+    {
+        *size_work1 = 0;
+        *size_work2 = 0;
+        *size_work3 = 0;
+        *size_work4 = 0;
+        *optim_mem = true;
+        return;
+    }
+
     // size requirements for getrs
     rocsolver_getrs_getMemorySize<BATCHED, STRIDED, T>(rocblas_operation_none, nb, nrhs, batch_count,
                                                        size_work1, size_work2, size_work3,
@@ -157,6 +299,25 @@ rocblas_status rocsolver_geblttrs_npvt_template(rocblas_handle handle,
     if(nb == 0 || nblocks == 0 || nrhs == 0 || batch_count == 0)
         return rocblas_status_success;
 
+    // small blocks: solve with a single kernel launch
+    if(nb <= GEBLTTR_FUSED_MAX_NB)
+    {
+        hipStream_t stream;
+        rocblas_get_stream(handle, &stream);
+
+        rocblas_int ncols = std::min(nrhs, BS1 / nb);
+        dim3 grid((nrhs - 1) / ncols + 1, batch_count, 1);
+        dim3 threads(nb, ncols, 1);
+        size_t lmemsize = sizeof(T) * nb * (nb + ncols);
+
+        ROCSOLVER_LAUNCH_KERNEL(geblttrs_npvt_fused_kernel<T>, grid, threads, lmemsize, stream, nb,
+                                nblocks, nrhs, A, shiftA, inca, lda, strideA, B, shiftB, incb, ldb,
+                                strideB, C, shiftC, incc, ldc, strideC, X, shiftX, incx, ldx,
+                                strideX);
+
+        return rocblas_status_success;
+    }
+
     T one = T(1);
     T minone = T(-1);
 
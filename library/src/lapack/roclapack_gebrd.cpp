@@ -66,7 +66,7 @@ rocblas_status rocsolver_gebrd_impl(rocblas_handle handle,
     rocblas_int batch_count = 1;
 
     // memory workspace sizes:
-    // size for constants in rocblas calls
+    // constants in rocblas calls (only whether they are needed, see set_device_scalars)
     size_t size_scalars;
     // size of arrays of pointers (for batched cases) and re-usable workspace
     size_t size_work_workArr;
@@ -79,12 +79,12 @@ rocblas_status rocsolver_gebrd_impl(rocblas_handle handle,
                                             &size_Abyx_norms, &size_X, &size_Y);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work_workArr,
+        return rocblas_set_optimal_device_memory_size(handle, size_t(0), size_work_workArr,
                                                       size_Abyx_norms, size_X, size_Y);
 
     // memory workspace allocation
     void *scalars, *work_workArr, *Abyx_norms, *X, *Y;
-    rocblas_device_malloc mem(handle, size_scalars, size_work_workArr, size_Abyx_norms, size_X,
+    rocblas_device_malloc mem(handle, size_t(0), size_work_workArr, size_Abyx_norms, size_X,
                               size_Y);
 
     if(!mem)
@@ -96,7 +96,7 @@ rocblas_status rocsolver_gebrd_impl(rocblas_handle handle,
     X = mem[3];
     Y = mem[4];
     if(size_scalars > 0)
-        init_scalars(handle, (T*)scalars);
+        ROCBLAS_CHECK(set_device_scalars<T>(scalars));
 
     // execution
     return rocsolver_gebrd_template<false, false, T>(
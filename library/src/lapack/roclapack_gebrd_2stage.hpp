@@ -0,0 +1,412 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "auxiliary/rocauxiliary_larfb.hpp"
+#include "auxiliary/rocauxiliary_larft.hpp"
+#include "rocblas.hpp"
+#include "roclapack_gelqf.hpp"
+#include "roclapack_geqrf.hpp"
+#include "roclapack_sytrd_hetrd_2stage.hpp"
+#include "rocsolver/rocsolver.h"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/*
+ * ===========================================================================
+ *    The two-stage reduction to bidiagonal form first reduces the m-by-n matrix A
+ *    (m >= n) to an upper band matrix B with nb super-diagonals (A = Q1 * B * P1'),
+ *    alternating QR factorizations of column panels and LQ factorizations of row
+ *    panels whose block reflectors are applied with matrix-matrix products.
+ *    B is then reduced to upper bidiagonal form by bulge chasing.
+ *
+ *    Sweep s of the bulge chasing annihilates row s of B beyond its super-diagonal.
+ *    Step k of the sweep acts on the block of rows and columns p = s+1+k*nb : p+nb-1.
+ *    It generates a right reflector that annihilates the row above the block (row s
+ *    if k = 0, or the first row of the previous block otherwise), which creates a bulge
+ *    under the diagonal of the block, and then a left reflector that annihilates the
+ *    first column of the bulge, which creates fill to the right of the band. As in
+ *    the tridiagonal case, sweep s can execute its step k at time t = 2s + k,
+ *    concurrently with the other sweeps.
+ * ===========================================================================
+ */
+
+/** Element (i,j) of an upper band matrix stored in AB with room for the bulges
+    (-2*nb < j-i < nb) **/
+template <typename T>
+__device__ inline T& gb2bd_band(T* AB,
+                                const rocblas_int nb,
+                                const rocblas_int ldab,
+                                const rocblas_int i,
+                                const rocblas_int j)
+{
+    return AB[(i - j + 2 * nb) + j * static_cast<int64_t>(ldab)];
+}
+
+/** GE2GB_COPY_BAND copies the upper band of A with nb super-diagonals into AB, and zeroes
+    the rest of AB, where the bulges will be created **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void ge2gb_copy_band(const rocblas_int n,
+                                      const rocblas_int nb,
+                                      U AA,
+                                      const rocblas_int shiftA,
+                                      const rocblas_int lda,
+                                      const rocblas_stride strideA,
+                                      T* ABB,
+                                      const rocblas_int ldab,
+                                      const rocblas_stride strideAB)
+{
+    rocblas_int d = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocblas_int j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+    rocblas_int b = hipBlockIdx_z;
+
+    if(d < ldab && j < n)
+    {
+        T* A = load_ptr_batch<T>(AA, b, shiftA, strideA);
+        T* AB = ABB + b * strideAB;
+        rocblas_int i = j + d - 2 * nb;
+        T val = 0;
+
+        if(i >= 0 && i <= j && j - i <= nb)
+            val = A[i + j * static_cast<int64_t>(lda)];
+
+        AB[d + j * static_cast<int64_t>(ldab)] = val;
+    }
+}
+
+/** GB2BD_KERNEL reduces the n-by-n upper band matrix in AB (with nb super-diagonals) to upper
+    bidiagonal form by bulge chasing. It uses one thread-block per matrix; each task (step of a
+    sweep) is executed by a group of nb threads, and the active sweeps of every time step
+    are distributed among the groups. The diagonal and off-diagonal elements are returned in
+    D and E **/
+template <typename T, typename S>
+ROCSOLVER_KERNEL void __launch_bounds__(SB2ST_MAX_THDS) gb2bd_kernel(const rocblas_int n,
+                                                                     const rocblas_int nb,
+                                                                     T* ABB,
+                                                                     const rocblas_int ldab,
+                                                                     const rocblas_stride strideAB,
+                                                                     S* DD,
+                                                                     const rocblas_stride strideD,
+                                                                     S* EE,
+                                                                     const rocblas_stride strideE)
+{
+    rocblas_int bid = hipBlockIdx_y;
+    rocblas_int tid = hipThreadIdx_x;
+    rocblas_int ngroups = hipBlockDim_x / nb;
+    rocblas_int q = tid / nb; // group of the thread
+    rocblas_int g = tid % nb; // index of the thread within its group
+
+    T* AB = ABB + bid * strideAB;
+    S* D = DD + bid * strideD;
+    S* E = EE + bid * strideE;
+
+    // shared memory for the vector to be annihilated, and the right and left Householder
+    // vectors of each group
+    extern __shared__ double lmem[];
+    T* xs = reinterpret_cast<T*>(lmem) + q * 3 * nb;
+    T* vr = xs + nb;
+    T* vl = vr + nb;
+
+    rocblas_int ntimes = sb2st_ntimes(n);
+    for(rocblas_int t = 0; t < ntimes; t++)
+    {
+        rocblas_int smin;
+        rocblas_int nact = sb2st_active_sweeps(n, nb, t, smin);
+
+        for(rocblas_int r0 = 0; r0 < nact; r0 += ngroups)
+        {
+            // the task of this group is step k of sweep s, acting on the block that starts at p
+            bool active = (r0 + q < nact);
+            rocblas_int s = smin + r0 + q;
+            rocblas_int k = t - 2 * s;
+            rocblas_int p = s + 1 + k * nb;
+            rocblas_int len = active ? std::min(nb, n - p) : 0;
+            rocblas_int rho = (k == 0) ? s : p - nb; // row to be annihilated
+
+            T tauR = 0, tauL = 0, scal;
+            S beta;
+
+            // 1. load the row to be annihilated (conjugated)
+            if(g < len)
+                xs[g] = conj(gb2bd_band(AB, nb, ldab, rho, p + g));
+            __syncthreads();
+
+            // 2. generate the right reflector
+            if(active)
+            {
+                S xnorm2 = 0;
+                for(rocblas_int i = 1; i < len; i++)
+                    xnorm2 += std::norm(xs[i]);
+                larfg_set_taubeta(xs[0], xnorm2, tauR, scal, beta);
+
+                if(g < len)
+                {
+                    vr[g] = (g == 0) ? T(1) : xs[g] * scal;
+                    gb2bd_band(AB, nb, ldab, rho, p + g) = (g == 0) ? T(beta) : T(0);
+                }
+                if(g == 0 && k == 0)
+                    E[s] = beta;
+            }
+            __syncthreads();
+
+            // 3. apply the right reflector to the rows below
+            if(active)
+            {
+                for(rocblas_int i = rho + 1 + g; i < p + len; i += nb)
+                {
+                    T z = 0;
+                    for(rocblas_int j = 0; j < len; j++)
+                        z += gb2bd_band(AB, nb, ldab, i, p + j) * vr[j];
+                    z *= tauR;
+                    for(rocblas_int j = 0; j < len; j++)
+                        gb2bd_band(AB, nb, ldab, i, p + j) -= z * conj(vr[j]);
+                }
+            }
+            __syncthreads();
+
+            // 4. load the first column of the bulge
+            if(g < len)
+                xs[g] = gb2bd_band(AB, nb, ldab, p + g, p);
+            __syncthreads();
+
+            // 5. generate the left reflector
+            if(active)
+            {
+                S xnorm2 = 0;
+                for(rocblas_int i = 1; i < len; i++)
+                    xnorm2 += std::norm(xs[i]);
+                larfg_set_taubeta(xs[0], xnorm2, tauL, scal, beta);
+
+                if(g < len)
+                {
+                    vl[g] = (g == 0) ? T(1) : xs[g] * scal;
+                    gb2bd_band(AB, nb, ldab, p + g, p) = (g == 0) ? T(beta) : T(0);
+                }
+            }
+            __syncthreads();
+
+            // 6. apply the left reflector to the columns to the right
+            if(active)
+            {
+                rocblas_int cmax = std::min(n, p + len + nb);
+                for(rocblas_int c = p + 1 + g; c < cmax; c += nb)
+                {
+                    T w = 0;
+                    for(rocblas_int i = 0; i < len; i++)
+                        w += conj(vl[i]) * gb2bd_band(AB, nb, ldab, p + i, c);
+                    w *= conj(tauL);
+                    for(rocblas_int i = 0; i < len; i++)
+                        gb2bd_band(AB, nb, ldab, p + i, c) -= vl[i] * w;
+                }
+            }
+            __syncthreads();
+        }
+    }
+
+    // copy the diagonal
+    for(rocblas_int i = tid; i < n; i += hipBlockDim_x)
+        D[i] = std::real(gb2bd_band(AB, nb, ldab, i, i));
+}
+
+/** Helper to calculate workspace sizes **/
+template <bool BATCHED, typename T>
+void rocsolver_gebrd_2stage_getMemorySize(const rocblas_int m,
+                                          const rocblas_int n,
+                                          const rocblas_int batch_count,
+                                          size_t* size_scalars,
+                                          size_t* size_work_workArr,
+                                          size_t* size_Abyx_norms_trfact,
+                                          size_t* size_diag_tmptr,
+                                          size_t* size_workArr,
+                                          size_t* size_band)
+{
+    // if quick return no workspace needed
+    if(m == 0 || n == 0 || batch_count == 0)
+    {
+        *size_scalars = 0;
+        *size_work_workArr = 0;
+        *size_Abyx_norms_trfact = 0;
+        *size_diag_tmptr = 0;
+        *size_workArr = 0;
+        *size_band = 0;
+        return;
+    }
+
+    const rocblas_int nb = GEBRD_2STAGE_BANDWIDTH;
+    const rocblas_int jb = std::min(nb, n);
+    const rocblas_int nn = std::max(n - jb, 0);
+    size_t unused;
+    size_t w[4] = {0, 0, 0, 0};
+    size_t x[3] = {0, 0, 0};
+    size_t y[4] = {0, 0, 0, 0};
+    size_t a[4] = {0, 0, 0, 0};
+
+    // requirements for the QR and LQ factorizations of the panels
+    rocsolver_geqrf_getMemorySize<BATCHED, T>(m, jb, batch_count, size_scalars, &w[0], &x[0], &y[0],
+                                              &a[0]);
+    rocsolver_gelqf_getMemorySize<BATCHED, T>(jb, nn, batch_count, &unused, &w[1], &x[1], &y[1],
+                                              &a[1]);
+
+    // requirements for computing and applying the block reflectors
+    rocsolver_larft_getMemorySize<BATCHED, T>(m, jb, batch_count, &unused, &w[2], &a[2]);
+    rocsolver_larft_getMemorySize<BATCHED, T>(nn, jb, batch_count, &unused, &w[3], &a[3]);
+    rocsolver_larfb_getMemorySize<BATCHED, T>(rocblas_side_left, m, nn, jb, batch_count, &y[2],
+                                              &unused);
+    rocsolver_larfb_getMemorySize<BATCHED, T>(rocblas_side_right, m - jb, nn, jb, batch_count,
+                                              &y[3], &unused);
+
+    // size of the triangular factor of the block reflectors
+    x[2] = sizeof(T) * nb * nb * batch_count;
+
+    *size_work_workArr = *std::max_element(std::begin(w), std::end(w));
+    *size_Abyx_norms_trfact = *std::max_element(std::begin(x), std::end(x));
+    *size_diag_tmptr = *std::max_element(std::begin(y), std::end(y));
+
+    // size of array of pointers (the LARFB's TRMM calls need twice the batch count in the
+    // batched case)
+    *size_workArr = *std::max_element(std::begin(a), std::end(a));
+    if(BATCHED)
+        *size_workArr = std::max(*size_workArr, 2 * sizeof(T*) * batch_count);
+
+    // size of the band matrix with room for the bulges
+    *size_band = sizeof(T) * 3 * nb * n * batch_count;
+}
+
+/** GEBRD_2STAGE reduces the m-by-n matrix A (m >= n) to upper bidiagonal form in two stages.
+    On exit, D and E contain the bidiagonal matrix, and A, tauq and taup are overwritten
+    with the Householder vectors and scalars of the first stage. The Householder vectors
+    of the second stage are not kept **/
+template <bool BATCHED, bool STRIDED, typename T, typename S, typename U>
+rocblas_status rocsolver_gebrd_2stage_template(rocblas_handle handle,
+                                               const rocblas_int m,
+                                               const rocblas_int n,
+                                               U A,
+                                               const rocblas_int shiftA,
+                                               const rocblas_int lda,
+                                               const rocblas_stride strideA,
+                                               S* D,
+                                               const rocblas_stride strideD,
+                                               S* E,
+                                               const rocblas_stride strideE,
+                                               T* tauq,
+                                               const rocblas_stride strideQ,
+                                               T* taup,
+                                               const rocblas_stride strideP,
+                                               const rocblas_int batch_count,
+                                               T* scalars,
+                                               void* work_workArr,
+                                               T* Abyx_norms_trfact,
+                                               T* diag_tmptr,
+                                               T** workArr,
+                                               T* band)
+{
+    ROCSOLVER_ENTER("gebrd_2stage", "m:", m, "n:", n, "shiftA:", shiftA, "lda:", lda,
+                    "bc:", batch_count);
+
+    // quick return
+    if(m == 0 || n == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    const rocblas_int nb = GEBRD_2STAGE_BANDWIDTH;
+    const rocblas_int ldt = nb;
+    const rocblas_stride strideT = nb * nb;
+    T* Tf = Abyx_norms_trfact;
+
+    // 1. reduce A to upper band form
+    for(rocblas_int j = 0; j < n; j += nb)
+    {
+        rocblas_int jb = std::min(nb, n - j);
+
+        // QR factorization of the column panel
+        rocsolver_geqrf_template<BATCHED, STRIDED>(
+            handle, m - j, jb, A, shiftA + idx2D(j, j, lda), lda, strideA, (tauq + j), strideQ,
+            batch_count, scalars, work_workArr, Abyx_norms_trfact, diag_tmptr, workArr);
+
+        if(j + jb < n)
+        {
+            // apply the block reflector from the left to the rest of the matrix
+            rocsolver_larft_template<T>(handle, rocblas_forward_direction, rocblas_column_wise,
+                                        m - j, jb, A, shiftA + idx2D(j, j, lda), lda, strideA,
+                                        (tauq + j), strideQ, Tf, ldt, strideT, batch_count,
+                                        scalars, (T*)work_workArr, workArr);
+
+            rocsolver_larfb_template<BATCHED, STRIDED, T>(
+                handle, rocblas_side_left, rocblas_operation_conjugate_transpose,
+                rocblas_forward_direction, rocblas_column_wise, m - j, n - j - jb, jb, A,
+                shiftA + idx2D(j, j, lda), lda, strideA, Tf, 0, ldt, strideT, A,
+                shiftA + idx2D(j, j + jb, lda), lda, strideA, batch_count, diag_tmptr, workArr);
+
+            // LQ factorization of the row panel
+            rocsolver_gelqf_template<BATCHED, STRIDED>(
+                handle, jb, n - j - jb, A, shiftA + idx2D(j, j + jb, lda), lda, strideA,
+                (taup + j), strideP, batch_count, scalars, work_workArr, Abyx_norms_trfact,
+                diag_tmptr, workArr);
+
+            // apply the block reflector from the right to the trailing matrix
+            if(j + jb < m)
+            {
+                rocsolver_larft_template<T>(handle, rocblas_forward_direction, rocblas_row_wise,
+                                            n - j - jb, jb, A, shiftA + idx2D(j, j + jb, lda), lda,
+                                            strideA, (taup + j), strideP, Tf, ldt, strideT,
+                                            batch_count, scalars, (T*)work_workArr, workArr);
+
+                rocsolver_larfb_template<BATCHED, STRIDED, T>(
+                    handle, rocblas_side_right, rocblas_operation_none, rocblas_forward_direction,
+                    rocblas_row_wise, m - j - jb, n - j - jb, jb, A, shiftA + idx2D(j, j + jb, lda),
+                    lda, strideA, Tf, 0, ldt, strideT, A, shiftA + idx2D(j + jb, j + jb, lda), lda,
+                    strideA, batch_count, diag_tmptr, workArr);
+            }
+        }
+    }
+
+    // 2. reduce the band matrix to bidiagonal form
+    const rocblas_int ldab = 3 * nb;
+    const rocblas_stride strideB = ldab * n;
+    rocblas_int blocksx = (ldab - 1) / BS2 + 1;
+    rocblas_int blocksy = (n - 1) / BS2 + 1;
+    ROCSOLVER_LAUNCH_KERNEL(ge2gb_copy_band<T>, dim3(blocksx, blocksy, batch_count),
+                            dim3(BS2, BS2), 0, stream, n, nb, A, shiftA, lda, strideA, band, ldab,
+                            strideB);
+
+    rocblas_int ngroups = SB2ST_MAX_THDS / nb;
+    size_t lmemsize = sizeof(T) * 3 * nb * ngroups;
+    ROCSOLVER_LAUNCH_KERNEL(gb2bd_kernel<T>, dim3(1, batch_count), dim3(nb * ngroups), lmemsize,
+                            stream, n, nb, band, ldab, strideB, D, strideD, E, strideE);
+
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
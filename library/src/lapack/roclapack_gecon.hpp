@@ -0,0 +1,189 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.9.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     November 2019
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "auxiliary/rocauxiliary_lacn2.hpp"
+#include "rocblas.hpp"
+#include "rocsolver/rocsolver.h"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+template <bool BATCHED, typename T, typename S>
+void rocsolver_gecon_getMemorySize(const rocblas_int n,
+                                   const rocblas_int batch_count,
+                                   size_t* size_x,
+                                   size_t* size_est,
+                                   size_t* size_state,
+                                   size_t* size_iwork,
+                                   size_t* size_workArr)
+{
+    // if quick return no workspace needed
+    if(n == 0 || batch_count == 0)
+    {
+        *size_x = 0;
+        *size_est = 0;
+        *size_state = 0;
+        *size_iwork = 0;
+        *size_workArr = 0;
+        return;
+    }
+
+    // requirements for the norm estimation
+    rocsolver_lacn2_getMemorySize<T, S>(n, batch_count, size_x, size_est, size_state);
+
+    // extra workspace (for calling TRSV)
+    *size_iwork = sizeof(rocblas_int) * batch_count;
+
+    // size of array of pointers (batched cases)
+    if(BATCHED)
+        *size_workArr = sizeof(T*) * batch_count;
+    else
+        *size_workArr = 0;
+}
+
+template <typename T, typename S>
+rocblas_status rocsolver_gecon_argCheck(rocblas_handle handle,
+                                        const rocblas_int n,
+                                        const rocblas_int lda,
+                                        T A,
+                                        const S* anorm,
+                                        S* rcond,
+                                        const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    if(n < 0 || lda < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !A) || (n && batch_count && !anorm) || (batch_count && !rcond))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_gecon_template(rocblas_handle handle,
+                                        const rocblas_int n,
+                                        U A,
+                                        const rocblas_int shiftA,
+                                        const rocblas_int lda,
+                                        const rocblas_stride strideA,
+                                        const S* anorm,
+                                        S* rcond,
+                                        const rocblas_int batch_count,
+                                        T* x,
+                                        S* est,
+                                        rocblas_int* state,
+                                        rocblas_int* iwork,
+                                        T** workArr)
+{
+    ROCSOLVER_ENTER("gecon", "n:", n, "shiftA:", shiftA, "lda:", lda, "bc:", batch_count);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocksReset = (batch_count - 1) / BS1 + 1;
+    dim3 gridReset(blocksReset, 1, 1);
+    dim3 threads(BS1, 1, 1);
+
+    // quick return with rcond = 1
+    if(n == 0)
+    {
+        ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, rcond, batch_count, 1);
+        return rocblas_status_success;
+    }
+
+    // the estimations of the different problems run in separate groups
+    dim3 grid(batch_count, 1, 1);
+    rocblas_stride strideX = n;
+    T* xi = x + strideX * batch_count;
+
+    // the reciprocal condition number is zero if U is exactly singular
+    ROCSOLVER_LAUNCH_KERNEL(lacn2_init<T>, grid, threads, 0, stream, n, A, shiftA, lda, strideA,
+                            true, anorm, est, state);
+
+    // estimate the 1-norm of inv(A) = inv(U) * inv(L) * P', where the permutation P does not
+    // change the 1-norm
+    for(rocblas_int r = 0; r < LACN2_ROUNDS; ++r)
+    {
+        rocblas_int kase = (r % 2 == 0) ? 1 : 2;
+        ROCSOLVER_LAUNCH_KERNEL(lacn2_kernel<T>, grid, threads, 0, stream, n, kase, x, xi, strideX,
+                                est, state);
+
+        if(kase == 1)
+        {
+            // x = inv(U) * inv(L) * x
+            rocblasCall_trsv(handle, rocblas_fill_lower, rocblas_operation_none,
+                             rocblas_diagonal_unit, n, A, shiftA, lda, strideA, x, 0, 1, strideX,
+                             batch_count, iwork, workArr);
+            rocblasCall_trsv(handle, rocblas_fill_upper, rocblas_operation_none,
+                             rocblas_diagonal_non_unit, n, A, shiftA, lda, strideA, x, 0, 1,
+                             strideX, batch_count, iwork, workArr);
+        }
+        else
+        {
+            // x = inv(L)' * inv(U)' * x
+            rocblasCall_trsv(handle, rocblas_fill_upper, rocblas_operation_conjugate_transpose,
+                             rocblas_diagonal_non_unit, n, A, shiftA, lda, strideA, x, 0, 1,
+                             strideX, batch_count, iwork, workArr);
+            rocblasCall_trsv(handle, rocblas_fill_lower, rocblas_operation_conjugate_transpose,
+                             rocblas_diagonal_unit, n, A, shiftA, lda, strideA, x, 0, 1, strideX,
+                             batch_count, iwork, workArr);
+        }
+    }
+
+    // consume the result of the last product (no product follows)
+    ROCSOLVER_LAUNCH_KERNEL(lacn2_kernel<T>, grid, threads, 0, stream, n, 0, x, xi, strideX, est,
+                            state);
+
+    // rcond = 1 / (norm(A) * norm(inv(A)))
+    ROCSOLVER_LAUNCH_KERNEL(lacn2_rcond<S>, gridReset, threads, 0, stream, n, anorm, est, state,
+                            rcond, batch_count);
+
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
@@ -0,0 +1,168 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "auxiliary/rocauxiliary_lacgv.hpp"
+#include "auxiliary/rocauxiliary_larf.hpp"
+#include "auxiliary/rocauxiliary_larfg.hpp"
+#include "rocblas.hpp"
+#include "rocsolver/rocsolver.h"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+template <bool BATCHED, typename T>
+void rocsolver_gehd2_getMemorySize(const rocblas_int n,
+                                   const rocblas_int batch_count,
+                                   size_t* size_scalars,
+                                   size_t* size_work_workArr,
+                                   size_t* size_Abyx_norms,
+                                   size_t* size_diag)
+{
+    // if quick return no workspace needed
+    if(n <= 1 || batch_count == 0)
+    {
+        *size_scalars = 0;
+        *size_work_workArr = 0;
+        *size_Abyx_norms = 0;
+        *size_diag = 0;
+        return;
+    }
+
+    // size of Abyx_norms is maximum of what is needed by larf and larfg
+    // size_work_workArr is maximum of re-usable work space and array of pointers to workspace
+    size_t s1, s2, s3, w1, w2, w3;
+    rocsolver_larf_getMemorySize<BATCHED, T>(rocblas_side_right, n, n - 1, batch_count,
+                                             size_scalars, &s1, &w1);
+    rocsolver_larf_getMemorySize<BATCHED, T>(rocblas_side_left, n - 1, n - 1, batch_count,
+                                             size_scalars, &s2, &w2);
+    rocsolver_larfg_getMemorySize<T>(n - 1, batch_count, &w3, &s3);
+    *size_work_workArr = std::max({w1, w2, w3});
+    *size_Abyx_norms = std::max({s1, s2, s3});
+
+    // size of array to store temporary subdiagonal values
+    *size_diag = sizeof(T) * batch_count;
+}
+
+template <typename T, typename U>
+rocblas_status rocsolver_gehd2_gehrd_argCheck(rocblas_handle handle,
+                                              const rocblas_int n,
+                                              const rocblas_int lda,
+                                              T A,
+                                              U tau,
+                                              const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    if(n < 0 || lda < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !A) || (n > 1 && !tau))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+/** GEHD2 reduces the columns ilo to n-2 of A (0-based) to upper Hessenberg form, applying each
+    reflector from the right to all the rows of A. The first ilo columns are assumed to be already
+    reduced (GEHRD calls GEHD2 with ilo > 0 to reduce the last block). **/
+template <typename T, typename U, bool COMPLEX = rocblas_is_complex<T>>
+rocblas_status rocsolver_gehd2_template(rocblas_handle handle,
+                                        const rocblas_int n,
+                                        U A,
+                                        const rocblas_int shiftA,
+                                        const rocblas_int lda,
+                                        const rocblas_stride strideA,
+                                        T* tau,
+                                        const rocblas_stride strideP,
+                                        const rocblas_int batch_count,
+                                        T* scalars,
+                                        void* work_workArr,
+                                        T* Abyx_norms,
+                                        T* diag,
+                                        const rocblas_int ilo = 0)
+{
+    ROCSOLVER_ENTER("gehd2", "n:", n, "shiftA:", shiftA, "lda:", lda, "ilo:", ilo,
+                    "bc:", batch_count);
+
+    // quick return
+    if(n <= 1 || batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    for(rocblas_int j = ilo; j < n - 1; ++j)
+    {
+        // generate Householder reflector to annihilate A(j+2:n-1,j)
+        rocsolver_larfg_template(handle, n - j - 1, A, shiftA + idx2D(j + 1, j, lda), A,
+                                 shiftA + idx2D(std::min(j + 2, n - 1), j, lda), 1, strideA,
+                                 (tau + j), strideP, batch_count, (T*)work_workArr, Abyx_norms);
+
+        // insert one in A(j+1,j) to build/apply the householder matrix
+        ROCSOLVER_LAUNCH_KERNEL(set_diag<T>, dim3(batch_count, 1, 1), dim3(1, 1, 1), 0, stream,
+                                diag, 0, 1, A, shiftA + idx2D(j + 1, j, lda), lda, strideA, 1,
+                                true);
+
+        // apply Householder reflector to the columns j+1:n-1 from the right
+        rocsolver_larf_template(handle, rocblas_side_right, n, n - j - 1, A,
+                                shiftA + idx2D(j + 1, j, lda), 1, strideA, (tau + j), strideP, A,
+                                shiftA + idx2D(0, j + 1, lda), lda, strideA, batch_count, scalars,
+                                Abyx_norms, (T**)work_workArr);
+
+        // conjugate tau
+        if(COMPLEX)
+            rocsolver_lacgv_template<T>(handle, 1, tau, j, 1, strideP, batch_count);
+
+        // apply the adjoint of the Householder reflector to the rows j+1:n-1 from the left
+        rocsolver_larf_template(handle, rocblas_side_left, n - j - 1, n - j - 1, A,
+                                shiftA + idx2D(j + 1, j, lda), 1, strideA, (tau + j), strideP, A,
+                                shiftA + idx2D(j + 1, j + 1, lda), lda, strideA, batch_count,
+                                scalars, Abyx_norms, (T**)work_workArr);
+
+        // restore original value of A(j+1,j)
+        ROCSOLVER_LAUNCH_KERNEL(restore_diag<T>, dim3(batch_count, 1, 1), dim3(1, 1, 1), 0, stream,
+                                diag, 0, 1, A, shiftA + idx2D(j + 1, j, lda), lda, strideA, 1);
+
+        // restore tau
+        if(COMPLEX)
+            rocsolver_lacgv_template<T>(handle, 1, tau, j, 1, strideP, batch_count);
+    }
+
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
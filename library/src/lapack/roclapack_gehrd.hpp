@@ -0,0 +1,369 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "auxiliary/rocauxiliary_lacgv.hpp"
+#include "auxiliary/rocauxiliary_larfb.hpp"
+#include "auxiliary/rocauxiliary_larfg.hpp"
+#include "rocblas.hpp"
+#include "roclapack_gehd2.hpp"
+#include "rocsolver/rocsolver.h"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/** GEHRD_SET_V copies the j-th reflector of the panel P into the j-th column of V, with
+    explicit zeros above the diagonal and a one on the diagonal, so that the reflectors
+    can be used by GEMV and GEMM without special handling of their triangular part. **/
+template <typename T>
+ROCSOLVER_KERNEL void gehrd_set_v(const rocblas_int r,
+                                  const rocblas_int j,
+                                  T* PP,
+                                  T* VV,
+                                  const rocblas_int ldw,
+                                  const rocblas_stride strideW)
+{
+    const rocblas_int bid = hipBlockIdx_z;
+    const rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(i < r)
+    {
+        T* P = PP + bid * strideW;
+        T* V = VV + bid * strideW;
+
+        V[i + j * ldw] = (i < j) ? T(0) : (i == j ? T(1) : P[i + j * ldw]);
+    }
+}
+
+/** GEHRD_SET_TCOL completes the j-th column of the triangular factor T of the block
+    reflector: T(0:j-1,j) = -tau(j) * T(0:j-1,j) and T(j,j) = tau(j). **/
+template <typename T>
+ROCSOLVER_KERNEL void gehrd_set_tcol(const rocblas_int j,
+                                     T* tau,
+                                     const rocblas_stride strideP,
+                                     T* TT,
+                                     const rocblas_int ldt,
+                                     const rocblas_stride strideT)
+{
+    const rocblas_int bid = hipBlockIdx_z;
+    const rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    T* Tf = TT + bid * strideT;
+    const T t = tau[bid * strideP + j];
+
+    if(i < j)
+        Tf[i + j * ldt] *= -t;
+    else if(i == j)
+        Tf[i + j * ldt] = t;
+}
+
+template <bool BATCHED, typename T>
+void rocsolver_gehrd_getMemorySize(const rocblas_int n,
+                                   const rocblas_int batch_count,
+                                   size_t* size_scalars,
+                                   size_t* size_work_workArr,
+                                   size_t* size_Abyx_norms,
+                                   size_t* size_diag_tmptr,
+                                   size_t* size_workArr,
+                                   size_t* size_YVP,
+                                   size_t* size_Tw)
+{
+    // if quick return no workspace needed
+    if(n <= 1 || batch_count == 0)
+    {
+        *size_scalars = 0;
+        *size_work_workArr = 0;
+        *size_Abyx_norms = 0;
+        *size_diag_tmptr = 0;
+        *size_workArr = 0;
+        *size_YVP = 0;
+        *size_Tw = 0;
+        return;
+    }
+
+    // requirements for calling GEHD2 (with the whole matrix, or with the last block)
+    rocsolver_gehd2_getMemorySize<BATCHED, T>(n, batch_count, size_scalars, size_work_workArr,
+                                              size_Abyx_norms, size_diag_tmptr);
+
+    if(n - 1 <= GEHRD_GEHD2_SWITCHSIZE)
+    {
+        *size_workArr = 0;
+        *size_YVP = 0;
+        *size_Tw = 0;
+        return;
+    }
+
+    size_t w, s, unused;
+    rocblas_int nb = GEHRD_BLOCKSIZE;
+
+    // requirements for calling LARFG with the panels
+    rocsolver_larfg_getMemorySize<T>(n - 1, batch_count, &w, &s);
+    *size_work_workArr = std::max(*size_work_workArr, w);
+    *size_Abyx_norms = std::max(*size_Abyx_norms, s);
+
+    // requirements for calling LARFB
+    rocsolver_larfb_getMemorySize<BATCHED, T>(rocblas_side_left, n - 1, n - nb, nb, batch_count,
+                                              &s, &unused);
+    *size_diag_tmptr = std::max(*size_diag_tmptr, s);
+
+    // size of the arrays of pointers for the mixed (batched and strided) BLAS calls
+    if(BATCHED)
+        *size_workArr = 2 * sizeof(T*) * batch_count;
+    else
+        *size_workArr = 0;
+
+    // size of the matrix Y = A * V * T, and of the panel P and its reflectors V
+    *size_YVP = sizeof(T) * 3 * n * nb * batch_count;
+
+    // size of the triangular factor T and of two temporary vectors
+    *size_Tw = sizeof(T) * (nb + 2) * nb * batch_count;
+}
+
+/** GEHRD_LAHR2 reduces the nb columns of A starting at column k-1 so that the elements below the
+    k-th subdiagonal are zero (as LAHR2 in LAPACK). On exit, the reflectors are stored in A
+    below the k-th subdiagonal, T is the nb-by-nb upper triangular factor of the block reflector
+    and Y = A * V * T, where V is the n-k-by-nb matrix of reflectors.
+
+    The trailing columns of A are only read. The panel is reduced in the workspace P, and the
+    reflectors are also copied to V with their zeros and ones made explicit, so that all the
+    updates are single GEMV calls; P is copied back to A at the end. **/
+template <bool BATCHED, typename T, typename U, bool COMPLEX = rocblas_is_complex<T>>
+void gehrd_lahr2(rocblas_handle handle,
+                 const rocblas_int n,
+                 const rocblas_int k,
+                 const rocblas_int nb,
+                 U A,
+                 const rocblas_int shiftA,
+                 const rocblas_int lda,
+                 const rocblas_stride strideA,
+                 T* tau,
+                 const rocblas_stride strideP,
+                 T* Y,
+                 T* V,
+                 T* P,
+                 T* Tf,
+                 T* w,
+                 T* tmp,
+                 const rocblas_int batch_count,
+                 T* scalars,
+                 T* work,
+                 T* norms,
+                 T** workArr)
+{
+    ROCSOLVER_ENTER("lahr2", "n:", n, "k:", k, "nb:", nb, "shiftA:", shiftA, "lda:", lda,
+                    "bc:", batch_count);
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    const rocblas_int c0 = k - 1; // first column of the panel
+    const rocblas_int r = n - k; // number of rows of the panel
+    const rocblas_int ldw = n;
+    const rocblas_stride strideW = rocblas_stride(ldw) * nb;
+    const rocblas_int ldt = nb;
+    const rocblas_stride strideT = rocblas_stride(ldt) * nb;
+
+    rocblas_int blocks = (r - 1) / BS2 + 1;
+    rocblas_int blocksb = (nb - 1) / BS2 + 1;
+
+    // copy the panel A(k:n-1,c0:c0+nb-1) to P
+    ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, dim3(blocks, blocksb, batch_count), dim3(BS2, BS2, 1), 0,
+                            stream, r, nb, A, shiftA + idx2D(k, c0, lda), lda, strideA, P, 0, ldw,
+                            strideW);
+
+    for(rocblas_int j = 0; j < nb; ++j)
+    {
+        if(j > 0)
+        {
+            // update column j of the panel: P(:,j) = P(:,j) - Y(k:n-1,0:j-1) * V(j-1,0:j-1)'
+            if(COMPLEX)
+                rocsolver_lacgv_template<T>(handle, j, V, idx2D(j - 1, 0, ldw), ldw, strideW,
+                                            batch_count);
+
+            rocblasCall_gemv<T>(handle, rocblas_operation_none, r, j, cast2constType<T>(scalars),
+                                0, Y, idx2D(k, 0, ldw), ldw, strideW, V, idx2D(j - 1, 0, ldw), ldw,
+                                strideW, cast2constType<T>(scalars + 2), 0, P, idx2D(0, j, ldw), 1,
+                                strideW, batch_count, workArr);
+
+            if(COMPLEX)
+                rocsolver_lacgv_template<T>(handle, j, V, idx2D(j - 1, 0, ldw), ldw, strideW,
+                                            batch_count);
+
+            // apply the block reflector of the previous columns from the left:
+            // P(:,j) = P(:,j) - V * T' * V' * P(:,j)
+            rocblasCall_gemv<T>(handle, rocblas_operation_conjugate_transpose, r, j,
+                                cast2constType<T>(scalars + 2), 0, V, 0, ldw, strideW, P,
+                                idx2D(0, j, ldw), 1, strideW, cast2constType<T>(scalars + 1), 0, w,
+                                0, 1, nb, batch_count, workArr);
+            rocblasCall_trmv<T>(handle, rocblas_fill_upper, rocblas_operation_conjugate_transpose,
+                                rocblas_diagonal_non_unit, j, Tf, 0, ldt, strideT, w, 0, 1, nb, tmp,
+                                nb, batch_count);
+            rocblasCall_gemv<T>(handle, rocblas_operation_none, r, j, cast2constType<T>(scalars),
+                                0, V, 0, ldw, strideW, w, 0, 1, nb, cast2constType<T>(scalars + 2),
+                                0, P, idx2D(0, j, ldw), 1, strideW, batch_count, workArr);
+        }
+
+        // generate Householder reflector to annihilate P(j+1:r-1,j)
+        rocsolver_larfg_template(handle, r - j, P, idx2D(j, j, ldw), P,
+                                 idx2D(std::min(j + 1, r - 1), j, ldw), 1, strideW, (tau + j),
+                                 strideP, batch_count, work, norms);
+
+        rocblas_int blocksv = (r - 1) / BS1 + 1;
+        ROCSOLVER_LAUNCH_KERNEL(gehrd_set_v<T>, dim3(blocksv, 1, batch_count), dim3(BS1, 1, 1), 0,
+                                stream, r, j, P, V, ldw, strideW);
+
+        // compute column j of Y: Y(k:n-1,j) = tau(j) * (A(k:n-1,c0+j+1:n-1) * V(j:r-1,j)
+        //                                     - Y(k:n-1,0:j-1) * V' * V(:,j))
+        rocblasCall_gemv<T>(handle, rocblas_operation_none, r, r - j,
+                            cast2constType<T>(scalars + 2), 0, A,
+                            shiftA + idx2D(k, c0 + j + 1, lda), lda, strideA, V, idx2D(j, j, ldw),
+                            1, strideW, cast2constType<T>(scalars + 1), 0, Y, idx2D(k, j, ldw), 1,
+                            strideW, batch_count, workArr);
+        rocblasCall_gemv<T>(handle, rocblas_operation_conjugate_transpose, r, j,
+                            cast2constType<T>(scalars + 2), 0, V, 0, ldw, strideW, V,
+                            idx2D(0, j, ldw), 1, strideW, cast2constType<T>(scalars + 1), 0, Tf,
+                            idx2D(0, j, ldt), 1, strideT, batch_count, workArr);
+        rocblasCall_gemv<T>(handle, rocblas_operation_none, r, j, cast2constType<T>(scalars), 0, Y,
+                            idx2D(k, 0, ldw), ldw, strideW, Tf, idx2D(0, j, ldt), 1, strideT,
+                            cast2constType<T>(scalars + 2), 0, Y, idx2D(k, j, ldw), 1, strideW,
+                            batch_count, workArr);
+        rocblasCall_scal<T>(handle, r, (tau + j), strideP, Y, idx2D(k, j, ldw), 1, strideW,
+                            batch_count);
+
+        // compute column j of T: T(0:j-1,j) = -tau(j) * T(0:j-1,0:j-1) * V' * V(:,j)
+        rocblasCall_trmv<T>(handle, rocblas_fill_upper, rocblas_operation_none,
+                            rocblas_diagonal_non_unit, j, Tf, 0, ldt, strideT, Tf,
+                            idx2D(0, j, ldt), 1, strideT, tmp, nb, batch_count);
+        ROCSOLVER_LAUNCH_KERNEL(gehrd_set_tcol<T>, dim3(1, 1, batch_count), dim3(BS1, 1, 1), 0,
+                                stream, j, tau, strideP, Tf, ldt, strideT);
+    }
+
+    // copy the reduced panel back to A
+    ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, dim3(blocks, blocksb, batch_count), dim3(BS2, BS2, 1), 0,
+                            stream, r, nb, P, 0, ldw, strideW, A, shiftA + idx2D(k, c0, lda), lda,
+                            strideA);
+
+    // compute the first k rows of Y: Y(0:k-1,:) = A(0:k-1,c0+1:n-1) * V * T
+    rocblasCall_gemm(handle, rocblas_operation_none, rocblas_operation_none, k, nb, r,
+                     cast2constType<T>(scalars + 2), A, shiftA + idx2D(0, c0 + 1, lda), lda,
+                     strideA, V, 0, ldw, strideW, cast2constType<T>(scalars + 1), Y, 0, ldw,
+                     strideW, batch_count, workArr);
+    rocblasCall_trmm(handle, rocblas_side_right, rocblas_fill_upper, rocblas_operation_none,
+                     rocblas_diagonal_non_unit, k, nb, cast2constType<T>(scalars + 2), 0, Tf, 0,
+                     ldt, strideT, Y, 0, ldw, strideW, batch_count);
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename U>
+rocblas_status rocsolver_gehrd_template(rocblas_handle handle,
+                                        const rocblas_int n,
+                                        U A,
+                                        const rocblas_int shiftA,
+                                        const rocblas_int lda,
+                                        const rocblas_stride strideA,
+                                        T* tau,
+                                        const rocblas_stride strideP,
+                                        const rocblas_int batch_count,
+                                        T* scalars,
+                                        void* work_workArr,
+                                        T* Abyx_norms,
+                                        T* diag_tmptr,
+                                        T** workArr,
+                                        T* YVP,
+                                        T* Tw)
+{
+    ROCSOLVER_ENTER("gehrd", "n:", n, "shiftA:", shiftA, "lda:", lda, "bc:", batch_count);
+
+    // quick return
+    if(n <= 1 || batch_count == 0)
+        return rocblas_status_success;
+
+    // if the matrix is small, use the unblocked variant of the algorithm
+    if(n - 1 <= GEHRD_GEHD2_SWITCHSIZE)
+        return rocsolver_gehd2_template<T>(handle, n, A, shiftA, lda, strideA, tau, strideP,
+                                           batch_count, scalars, work_workArr, Abyx_norms,
+                                           diag_tmptr);
+
+    // everything must be executed with scalars on the device
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device);
+
+    const rocblas_int nb = GEHRD_BLOCKSIZE;
+    const rocblas_int ldw = n;
+    const rocblas_stride strideW = rocblas_stride(ldw) * nb;
+    const rocblas_int ldt = nb;
+    const rocblas_stride strideT = rocblas_stride(ldt) * nb;
+
+    // workspace for Y, V, P (each n-by-nb), T (nb-by-nb) and two vectors of size nb
+    T* Y = YVP;
+    T* V = YVP + strideW * batch_count;
+    T* P = YVP + 2 * strideW * batch_count;
+    T* Tf = Tw;
+    T* w = Tw + strideT * batch_count;
+    T* tmp = w + nb * batch_count;
+
+    rocblas_int j = 0;
+    while(j < n - 1 - GEHRD_GEHD2_SWITCHSIZE)
+    {
+        // reduce columns j:j+nb-1 and compute the block reflector and Y = A * V * T
+        gehrd_lahr2<BATCHED, T>(handle, n, j + 1, nb, A, shiftA, lda, strideA, (tau + j), strideP,
+                                Y, V, P, Tf, w, tmp, batch_count, scalars, (T*)work_workArr,
+                                Abyx_norms, workArr);
+
+        // apply the block reflector from the right to the columns j+nb:n-1:
+        // A(:,j+nb:n-1) = A(:,j+nb:n-1) - Y * V(nb-1:n-j-2,:)'
+        rocblasCall_gemm(handle, rocblas_operation_none, rocblas_operation_conjugate_transpose, n,
+                         n - j - nb, nb, cast2constType<T>(scalars), Y, 0, ldw, strideW, V,
+                         idx2D(nb - 1, 0, ldw), ldw, strideW, cast2constType<T>(scalars + 2), A,
+                         shiftA + idx2D(0, j + nb, lda), lda, strideA, batch_count, workArr);
+
+        // and to the first j+1 rows of the columns j+1:j+nb-1
+        rocblasCall_gemm(handle, rocblas_operation_none, rocblas_operation_conjugate_transpose,
+                         j + 1, nb - 1, nb, cast2constType<T>(scalars), Y, 0, ldw, strideW, V, 0,
+                         ldw, strideW, cast2constType<T>(scalars + 2), A,
+                         shiftA + idx2D(0, j + 1, lda), lda, strideA, batch_count, workArr);
+
+        // apply the adjoint of the block reflector from the left to the columns j+nb:n-1
+        rocsolver_larfb_template<BATCHED, STRIDED, T>(
+            handle, rocblas_side_left, rocblas_operation_conjugate_transpose,
+            rocblas_forward_direction, rocblas_column_wise, n - j - 1, n - j - nb, nb, A,
+            shiftA + idx2D(j + 1, j, lda), lda, strideA, Tf, 0, ldt, strideT, A,
+            shiftA + idx2D(j + 1, j + nb, lda), lda, strideA, batch_count, diag_tmptr, workArr);
+
+        j += nb;
+    }
+
+    rocblas_set_pointer_mode(handle, old_mode);
+
+    // reduce the last block
+    rocsolver_gehd2_template<T>(handle, n, A, shiftA, lda, strideA, tau, strideP, batch_count,
+                                scalars, work_workArr, Abyx_norms, diag_tmptr, j);
+
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
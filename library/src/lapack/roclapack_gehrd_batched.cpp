@@ -0,0 +1,159 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "roclapack_gehrd.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+template <typename T, typename U>
+rocblas_status rocsolver_gehrd_batched_impl(rocblas_handle handle,
+                                            const rocblas_int n,
+                                            U A,
+                                            const rocblas_int lda,
+                                            T* tau,
+                                            const rocblas_stride strideP,
+                                            const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER_TOP("gehrd_batched", "-n", n, "--lda", lda, "--strideP", strideP,
+                        "--batch_count", batch_count);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_gehd2_gehrd_argCheck(handle, n, lda, A, tau, batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+
+    // batched execution
+    rocblas_stride strideA = 0;
+
+    // memory workspace sizes:
+    // constants in rocblas calls (only whether they are needed, see set_device_scalars)
+    size_t size_scalars;
+    // size of arrays of pointers (for batched cases) and re-usable workspace
+    size_t size_work_workArr, size_workArr;
+    // extra requirements for calling GEHD2, LARFG and LARFB
+    size_t size_Abyx_norms, size_diag_tmptr;
+    // size of the temporary matrices Y, V and P, and of the triangular factor and vectors
+    size_t size_YVP, size_Tw;
+    rocsolver_gehrd_getMemorySize<true, T>(n, batch_count, &size_scalars, &size_work_workArr,
+                                           &size_Abyx_norms, &size_diag_tmptr, &size_workArr,
+                                           &size_YVP, &size_Tw);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_t(0), size_work_workArr,
+                                                      size_Abyx_norms, size_diag_tmptr,
+                                                      size_workArr, size_YVP, size_Tw);
+
+    // memory workspace allocation
+    void *scalars, *work_workArr, *Abyx_norms, *diag_tmptr, *workArr, *YVP, *Tw;
+    rocblas_device_malloc mem(handle, size_t(0), size_work_workArr, size_Abyx_norms,
+                              size_diag_tmptr, size_workArr, size_YVP, size_Tw);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    scalars = mem[0];
+    work_workArr = mem[1];
+    Abyx_norms = mem[2];
+    diag_tmptr = mem[3];
+    workArr = mem[4];
+    YVP = mem[5];
+    Tw = mem[6];
+    if(size_scalars > 0)
+        ROCBLAS_CHECK(set_device_scalars<T>(scalars));
+
+    // execution
+    return rocsolver_gehrd_template<true, false, T>(handle, n, A, shiftA, lda, strideA, tau,
+                                                    strideP, batch_count, (T*)scalars, work_workArr,
+                                                    (T*)Abyx_norms, (T*)diag_tmptr, (T**)workArr,
+                                                    (T*)YVP, (T*)Tw);
+}
+
+ROCSOLVER_END_NAMESPACE
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sgehrd_batched(rocblas_handle handle,
+                                        const rocblas_int n,
+                                        float* const A[],
+                                        const rocblas_int lda,
+                                        float* tau,
+                                        const rocblas_stride strideP,
+                                        const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_gehrd_batched_impl<float>(handle, n, A, lda, tau, strideP,
+                                                          batch_count);
+}
+
+rocblas_status rocsolver_dgehrd_batched(rocblas_handle handle,
+                                        const rocblas_int n,
+                                        double* const A[],
+                                        const rocblas_int lda,
+                                        double* tau,
+                                        const rocblas_stride strideP,
+                                        const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_gehrd_batched_impl<double>(handle, n, A, lda, tau, strideP,
+                                                           batch_count);
+}
+
+rocblas_status rocsolver_cgehrd_batched(rocblas_handle handle,
+                                        const rocblas_int n,
+                                        rocblas_float_complex* const A[],
+                                        const rocblas_int lda,
+                                        rocblas_float_complex* tau,
+                                        const rocblas_stride strideP,
+                                        const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_gehrd_batched_impl<rocblas_float_complex>(handle, n, A, lda, tau,
+                                                                          strideP, batch_count);
+}
+
+rocblas_status rocsolver_zgehrd_batched(rocblas_handle handle,
+                                        const rocblas_int n,
+                                        rocblas_double_complex* const A[],
+                                        const rocblas_int lda,
+                                        rocblas_double_complex* tau,
+                                        const rocblas_stride strideP,
+                                        const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_gehrd_batched_impl<rocblas_double_complex>(handle, n, A, lda, tau,
+                                                                           strideP, batch_count);
+}
+
+} // extern C
@@ -32,7 +32,6 @@
 
 #pragma once
 
-#include "auxiliary/rocauxiliary_lacgv.hpp"
 #include "auxiliary/rocauxiliary_larf.hpp"
 #include "auxiliary/rocauxiliary_larfg.hpp"
 #include "rocblas.hpp"
@@ -63,7 +62,7 @@ void rocsolver_gelq2_getMemorySize(const rocblas_int m,
     // size_work_workArr is maximum of re-usable work space and array of pointers to workspace
     size_t s1, s2, w1, w2;
     rocsolver_larf_getMemorySize<BATCHED, T>(rocblas_side_right, m, n, batch_count, size_scalars,
-                                             &s1, &w1);
+                                             &s1, &w1, true);
     rocsolver_larfg_getMemorySize<T>(n, batch_count, &w2, &s2);
     *size_work_workArr = std::max(w1, w2);
     *size_Abyx_norms = std::max(s1, s2);
@@ -130,15 +129,13 @@ rocblas_status rocsolver_gelq2_template(rocblas_handle handle,
 
     for(rocblas_int j = 0; j < dim; ++j)
     {
-        // conjugate the jth row of A
-        if(COMPLEX)
-            rocsolver_lacgv_template<T>(handle, n - j, A, shiftA + idx2D(j, j, lda), lda, strideA,
-                                        batch_count);
-
         // generate Householder reflector to work on row j
+        // (the row holds the conjugate of the Householder vector, which is read and written as
+        // such by LARFG and LARF, so that it does not have to be conjugated in place)
         rocsolver_larfg_template(handle, n - j, A, shiftA + idx2D(j, j, lda), A,
                                  shiftA + idx2D(j, std::min(j + 1, n - 1), lda), lda, strideA,
-                                 (ipiv + j), strideP, batch_count, (T*)work_workArr, Abyx_norms);
+                                 (ipiv + j), strideP, batch_count, (T*)work_workArr, Abyx_norms,
+                                 true);
 
         // insert one in A(j,j) tobuild/apply the householder matrix
         ROCSOLVER_LAUNCH_KERNEL(set_diag<T>, dim3(batch_count, 1, 1), dim3(1, 1, 1), 0, stream,
@@ -150,17 +147,12 @@ rocblas_status rocsolver_gelq2_template(rocblas_handle handle,
             rocsolver_larf_template(handle, rocblas_side_right, m - j - 1, n - j, A,
                                     shiftA + idx2D(j, j, lda), lda, strideA, (ipiv + j), strideP, A,
                                     shiftA + idx2D(j + 1, j, lda), lda, strideA, batch_count,
-                                    scalars, Abyx_norms, (T**)work_workArr);
+                                    scalars, Abyx_norms, (T**)work_workArr, true);
         }
 
         // restore original value of A(j,j)
         ROCSOLVER_LAUNCH_KERNEL(restore_diag<T>, dim3(batch_count, 1, 1), dim3(1, 1, 1), 0, stream,
                                 diag, 0, 1, A, shiftA + idx2D(j, j, lda), lda, strideA, 1);
-
-        // restore the jth row of A
-        if(COMPLEX)
-            rocsolver_lacgv_template<T>(handle, n - j, A, shiftA + idx2D(j, j, lda), lda, strideA,
-                                        batch_count);
     }
 
     return rocblas_status_success;
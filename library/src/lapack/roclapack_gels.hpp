@@ -34,6 +34,7 @@
 
 #include "auxiliary/rocauxiliary_ormlq_unmlq.hpp"
 #include "auxiliary/rocauxiliary_ormqr_unmqr.hpp"
+#include "lib_memory_primitives.hpp"
 #include "rocblas.hpp"
 #include "roclapack_gelqf.hpp"
 #include "roclapack_geqrf.hpp"
@@ -212,21 +213,17 @@ rocblas_status rocsolver_gels_template(rocblas_handle handle,
     dim3 gridReset(blocksReset, 1, 1);
     dim3 threads(BS1, 1, 1);
 
-    // info=0 (starting with a nonsingular matrix)
-    ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, info, batch_count, 0);
-
-    // quick return if B is empty
-    if(nrhs == 0)
-        return rocblas_status_success;
-
-    // quick return if A is empty
-    if(m == 0 || n == 0)
+    // quick return if B is empty or A is empty
+    // (otherwise, info is set by the singularity check of the triangular factor)
+    if(nrhs == 0 || m == 0 || n == 0)
     {
+        // info=0 (starting with a nonsingular matrix)
+        ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, info, batch_count, 0);
+        if(nrhs == 0)
+            return rocblas_status_success;
+
         rocblas_int rowsB = std::max(m, n);
-        rocblas_int blocksx = (rowsB - 1) / 32 + 1;
-        rocblas_int blocksy = (nrhs - 1) / 32 + 1;
-        ROCSOLVER_LAUNCH_KERNEL(set_zero<T>, dim3(blocksx, blocksy, batch_count), dim3(32, 32), 0,
-                                stream, rowsB, nrhs, B, shiftB, ldb, strideB);
+        launch_set_zero<T>(handle, rowsB, nrhs, B, shiftB, ldb, strideB, batch_count);
 
         return rocblas_status_success;
     }
@@ -239,8 +236,6 @@ rocblas_status rocsolver_gels_template(rocblas_handle handle,
     // constants in host memory
     const rocblas_stride strideP = std::min(m, n);
     const rocblas_int check_threads = std::min(((std::min(m, n) - 1) / 64 + 1) * 64, BS1);
-    const rocblas_int copyblocksmin = (std::min(m, n) - 1) / 32 + 1;
-    const rocblas_int copyblocksmax = (std::max(m, n) - 1) / 32 + 1;
     const rocblas_int copyblocksy = (nrhs - 1) / 32 + 1;
 
     // TODO: apply scaling to improve accuracy over a larger range of values
@@ -266,9 +261,8 @@ rocblas_status rocsolver_gels_template(rocblas_handle handle,
                                     strideA, info);
 
             // save elements of B that will be overwritten in cases where info is nonzero
-            ROCSOLVER_LAUNCH_KERNEL((copy_mat<T, U>), dim3(copyblocksmin, copyblocksy, batch_count),
-                                    dim3(32, 32), 0, stream, copymat_to_buffer, n, nrhs, B, shiftB,
-                                    ldb, strideB, ipiv_savedB, info_mask(info));
+            launch_copy_mat<T>(handle, n, nrhs, B, shiftB, ldb, strideB, ipiv_savedB, 0, n,
+                               rocblas_stride(n) * nrhs, batch_count, info_mask(info));
 
             // solve RX = Q'B, overwriting B with X
             rocsolver_trsm_upper<BATCHED, STRIDED, T>(
@@ -277,9 +271,8 @@ rocblas_status rocsolver_gels_template(rocblas_handle handle,
                 work_x_temp, workArr_temp_arr, diag_trfac_invA, trfact_workTrmm_invA_arr);
 
             // restore elements of B that were overwritten in cases where info is nonzero
-            ROCSOLVER_LAUNCH_KERNEL((copy_mat<T, U>), dim3(copyblocksmin, copyblocksy, batch_count),
-                                    dim3(32, 32), 0, stream, copymat_from_buffer, n, nrhs, B,
-                                    shiftB, ldb, strideB, ipiv_savedB, info_mask(info));
+            launch_copy_mat<T>(handle, n, nrhs, ipiv_savedB, 0, n, rocblas_stride(n) * nrhs, B,
+                               shiftB, ldb, strideB, batch_count, info_mask(info));
         }
         else
         {
@@ -289,9 +282,8 @@ rocblas_status rocsolver_gels_template(rocblas_handle handle,
                                     strideA, info);
 
             // save elements of B that will be overwritten in cases where info is nonzero
-            ROCSOLVER_LAUNCH_KERNEL((copy_mat<T, U>), dim3(copyblocksmax, copyblocksy, batch_count),
-                                    dim3(32, 32), 0, stream, copymat_to_buffer, m, nrhs, B, shiftB,
-                                    ldb, strideB, ipiv_savedB, info_mask(info));
+            launch_copy_mat<T>(handle, m, nrhs, B, shiftB, ldb, strideB, ipiv_savedB, 0, m,
+                               rocblas_stride(m) * nrhs, batch_count, info_mask(info));
 
             // solve R'Y = B overwriting B with Y (here Y = Q'X)
             rocsolver_trsm_upper<BATCHED, STRIDED, T>(
@@ -313,9 +305,8 @@ rocblas_status rocsolver_gels_template(rocblas_handle handle,
                 (T**)trfact_workTrmm_invA_arr);
 
             // restore elements of B that were overwritten in cases where info is nonzero
-            ROCSOLVER_LAUNCH_KERNEL((copy_mat<T, U>), dim3(copyblocksmax, copyblocksy, batch_count),
-                                    dim3(32, 32), 0, stream, copymat_from_buffer, m, nrhs, B,
-                                    shiftB, ldb, strideB, ipiv_savedB, info_mask(info));
+            launch_copy_mat<T>(handle, m, nrhs, ipiv_savedB, 0, m, rocblas_stride(m) * nrhs, B,
+                               shiftB, ldb, strideB, batch_count, info_mask(info));
         }
     }
     else
@@ -333,9 +324,8 @@ rocblas_status rocsolver_gels_template(rocblas_handle handle,
                                     strideA, info);
 
             // save elements of B that will be overwritten in cases where info is nonzero
-            ROCSOLVER_LAUNCH_KERNEL((copy_mat<T, U>), dim3(copyblocksmax, copyblocksy, batch_count),
-                                    dim3(32, 32), 0, stream, copymat_to_buffer, n, nrhs, B, shiftB,
-                                    ldb, strideB, ipiv_savedB, info_mask(info));
+            launch_copy_mat<T>(handle, n, nrhs, B, shiftB, ldb, strideB, ipiv_savedB, 0, n,
+                               rocblas_stride(n) * nrhs, batch_count, info_mask(info));
 
             // solve LY = B overwriting B with Y (here Y = QX)
             rocsolver_trsm_lower<BATCHED, STRIDED, T>(
@@ -356,9 +346,8 @@ rocblas_status rocsolver_gels_template(rocblas_handle handle,
                 (T**)trfact_workTrmm_invA_arr);
 
             // restore elements of B that were overwritten in cases where info is nonzero
-            ROCSOLVER_LAUNCH_KERNEL((copy_mat<T, U>), dim3(copyblocksmax, copyblocksy, batch_count),
-                                    dim3(32, 32), 0, stream, copymat_from_buffer, n, nrhs, B,
-                                    shiftB, ldb, strideB, ipiv_savedB, info_mask(info));
+            launch_copy_mat<T>(handle, n, nrhs, ipiv_savedB, 0, n, rocblas_stride(n) * nrhs, B,
+                               shiftB, ldb, strideB, batch_count, info_mask(info));
         }
         else
         {
@@ -374,9 +363,8 @@ rocblas_status rocsolver_gels_template(rocblas_handle handle,
                                     strideA, info);
 
             // save elements of B that will be overwritten in cases where info is nonzero
-            ROCSOLVER_LAUNCH_KERNEL((copy_mat<T, U>), dim3(copyblocksmin, copyblocksy, batch_count),
-                                    dim3(32, 32), 0, stream, copymat_to_buffer, m, nrhs, B, shiftB,
-                                    ldb, strideB, ipiv_savedB, info_mask(info));
+            launch_copy_mat<T>(handle, m, nrhs, B, shiftB, ldb, strideB, ipiv_savedB, 0, m,
+                               rocblas_stride(m) * nrhs, batch_count, info_mask(info));
 
             // solve L'X = QB, overwriting B with X
             rocsolver_trsm_lower<BATCHED, STRIDED, T>(
@@ -386,9 +374,8 @@ rocblas_status rocsolver_gels_template(rocblas_handle handle,
                 trfact_workTrmm_invA_arr);
 
             // restore elements of B that were overwritten in cases where info is nonzero
-            ROCSOLVER_LAUNCH_KERNEL((copy_mat<T, U>), dim3(copyblocksmin, copyblocksy, batch_count),
-                                    dim3(32, 32), 0, stream, copymat_from_buffer, m, nrhs, B,
-                                    shiftB, ldb, strideB, ipiv_savedB, info_mask(info));
+            launch_copy_mat<T>(handle, m, nrhs, ipiv_savedB, 0, m, rocblas_stride(m) * nrhs, B,
+                               shiftB, ldb, strideB, batch_count, info_mask(info));
         }
     }
 
@@ -44,6 +44,7 @@ rocblas_status rocsolver_gels_batched_impl(rocblas_handle handle,
 {
     ROCSOLVER_ENTER_TOP("gels_batched", "--trans", trans, "-m", m, "-n", n, "--nrhs", nrhs, "--lda",
                         lda, "--ldb", ldb, "--batch_count", batch_count);
+    ROCSOLVER_INFO_SUMMARY(info, batch_count);
 
     if(!handle)
         return rocblas_status_invalid_handle;
@@ -63,7 +64,7 @@ rocblas_status rocsolver_gels_batched_impl(rocblas_handle handle,
     const rocblas_stride strideB = 0;
 
     // memory workspace sizes:
-    // size for constants in rocblas calls
+    // constants in rocblas calls (only whether they are needed, see set_device_scalars)
     size_t size_scalars;
     // size of workspace (for calling GEQRF/GELQF, ORMQR/ORMLQ, and TRSM)
     bool optim_mem;
@@ -77,13 +78,13 @@ rocblas_status rocsolver_gels_batched_impl(rocblas_handle handle,
 
     if(rocblas_is_device_memory_size_query(handle))
         return rocblas_set_optimal_device_memory_size(
-            handle, size_scalars, size_work_x_temp, size_workArr_temp_arr, size_diag_trfac_invA,
+            handle, size_t(0), size_work_x_temp, size_workArr_temp_arr, size_diag_trfac_invA,
             size_trfact_workTrmm_invA_arr, size_ipiv_savedB);
 
     // memory workspace allocation
     void *scalars, *work_x_temp, *workArr_temp_arr, *diag_trfac_invA, *trfact_workTrmm_invA_arr,
         *ipiv_savedB;
-    rocblas_device_malloc mem(handle, size_scalars, size_work_x_temp, size_workArr_temp_arr,
+    rocblas_device_malloc mem(handle, size_t(0), size_work_x_temp, size_workArr_temp_arr,
                               size_diag_trfac_invA, size_trfact_workTrmm_invA_arr, size_ipiv_savedB);
 
     if(!mem)
@@ -96,13 +97,13 @@ rocblas_status rocsolver_gels_batched_impl(rocblas_handle handle,
     trfact_workTrmm_invA_arr = mem[4];
     ipiv_savedB = mem[5];
     if(size_scalars > 0)
-        init_scalars(handle, (T*)scalars);
+        ROCBLAS_CHECK(set_device_scalars<T>(scalars));
 
     // execution
-    return rocsolver_gels_template<true, false, T>(
+    return _info_summary_scope.commit(rocsolver_gels_template<true, false, T>(
         handle, trans, m, n, nrhs, A, shiftA, lda, strideA, B, shiftB, ldb, strideB, info,
         batch_count, (T*)scalars, (T*)work_x_temp, (T*)workArr_temp_arr, (T*)diag_trfac_invA,
-        (T**)trfact_workTrmm_invA_arr, (T*)ipiv_savedB, optim_mem);
+        (T**)trfact_workTrmm_invA_arr, (T*)ipiv_savedB, optim_mem));
 }
 
 ROCSOLVER_END_NAMESPACE
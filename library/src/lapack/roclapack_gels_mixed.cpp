@@ -0,0 +1,178 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "roclapack_gels_mixed.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+template <typename T>
+rocblas_status rocsolver_gels_mixed_impl(rocblas_handle handle,
+                                         const rocblas_int m,
+                                         const rocblas_int n,
+                                         const rocblas_int nrhs,
+                                         T* A,
+                                         const rocblas_int lda,
+                                         T* B,
+                                         const rocblas_int ldb,
+                                         T* X,
+                                         const rocblas_int ldx,
+                                         rocblas_int* iter,
+                                         rocblas_int* info)
+{
+    ROCSOLVER_ENTER_TOP("gels_mixed", "-m", m, "-n", n, "--nrhs", nrhs, "--lda", lda, "--ldb", ldb,
+                        "--ldx", ldx);
+    ROCSOLVER_INFO_SUMMARY(info, 1);
+
+    using Tl = gesv_mixed_low_t<T>;
+    using S = decltype(std::real(T{}));
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_gels_mixed_argCheck(handle, m, n, nrhs, lda, ldb, ldx, A, B, X,
+                                                      iter, info);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+    rocblas_int shiftB = 0;
+    rocblas_int shiftX = 0;
+
+    // normal (non-batched non-strided) execution
+    rocblas_stride strideA = 0;
+    rocblas_stride strideB = 0;
+    rocblas_stride strideX = 0;
+    rocblas_int batch_count = 1;
+
+    // memory workspace sizes:
+    // constants in rocblas calls, in full and lower precision (only whether they are needed,
+    // see set_device_scalars)
+    size_t size_scalars, size_scalars_low;
+    // size of reusable workspace for calling GEQRF, ORMQR/UNMQR and TRSM
+    bool optim_mem;
+    size_t size_work_x_temp, size_workArr_temp_arr, size_diag_trfac_invA,
+        size_trfact_workTrmm_invA_arr;
+    // extra requirements for calling GELS in full precision
+    size_t size_ipiv_savedB;
+    // size of the lower precision factorization, the residuals and the convergence data
+    size_t size_tau_low, size_Alow, size_Xlow, size_R, size_G, size_Rarr, size_anorm, size_state;
+    rocsolver_gels_mixed_getMemorySize<false, false, T>(
+        m, n, nrhs, batch_count, &size_scalars, &size_scalars_low, &size_work_x_temp,
+        &size_workArr_temp_arr, &size_diag_trfac_invA, &size_trfact_workTrmm_invA_arr,
+        &size_ipiv_savedB, &size_tau_low, &size_Alow, &size_Xlow, &size_R, &size_G, &size_Rarr,
+        &size_anorm, &size_state, &optim_mem);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(
+            handle, size_t(0), size_t(0), size_work_x_temp, size_workArr_temp_arr,
+            size_diag_trfac_invA, size_trfact_workTrmm_invA_arr, size_ipiv_savedB, size_tau_low,
+            size_Alow, size_Xlow, size_R, size_G, size_Rarr, size_anorm, size_state);
+
+    // memory workspace allocation
+    void *scalars, *scalars_low, *work_x_temp, *workArr_temp_arr, *diag_trfac_invA,
+        *trfact_workTrmm_invA_arr, *ipiv_savedB, *tau_low, *Alow, *Xlow, *R, *G, *Rarr, *anorm,
+        *state;
+    rocblas_device_malloc mem(handle, size_t(0), size_t(0), size_work_x_temp,
+                              size_workArr_temp_arr, size_diag_trfac_invA,
+                              size_trfact_workTrmm_invA_arr, size_ipiv_savedB, size_tau_low,
+                              size_Alow, size_Xlow, size_R, size_G, size_Rarr, size_anorm,
+                              size_state);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    scalars = mem[0];
+    scalars_low = mem[1];
+    work_x_temp = mem[2];
+    workArr_temp_arr = mem[3];
+    diag_trfac_invA = mem[4];
+    trfact_workTrmm_invA_arr = mem[5];
+    ipiv_savedB = mem[6];
+    tau_low = mem[7];
+    Alow = mem[8];
+    Xlow = mem[9];
+    R = mem[10];
+    G = mem[11];
+    Rarr = mem[12];
+    anorm = mem[13];
+    state = mem[14];
+    if(size_scalars > 0)
+        ROCBLAS_CHECK(set_device_scalars<T>(scalars));
+    if(size_scalars_low > 0)
+        ROCBLAS_CHECK(set_device_scalars<Tl>(scalars_low));
+
+    // execution
+    return _info_summary_scope.commit(rocsolver_gels_mixed_template<false, false, T>(
+        handle, m, n, nrhs, A, shiftA, lda, strideA, B, shiftB, ldb, strideB, X, shiftX, ldx,
+        strideX, iter, info, batch_count, (T*)scalars, (Tl*)scalars_low, work_x_temp,
+        workArr_temp_arr, diag_trfac_invA, trfact_workTrmm_invA_arr, (T*)ipiv_savedB, (Tl*)tau_low,
+        (Tl*)Alow, (Tl*)Xlow, (T*)R, (T*)G, (T**)Rarr, (S*)anorm, (rocblas_int*)state, optim_mem));
+}
+
+ROCSOLVER_END_NAMESPACE
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocblas_status rocsolver_dsgels(rocblas_handle handle,
+                                           const rocblas_int m,
+                                           const rocblas_int n,
+                                           const rocblas_int nrhs,
+                                           double* A,
+                                           const rocblas_int lda,
+                                           double* B,
+                                           const rocblas_int ldb,
+                                           double* X,
+                                           const rocblas_int ldx,
+                                           rocblas_int* iter,
+                                           rocblas_int* info)
+{
+    return rocsolver::rocsolver_gels_mixed_impl<double>(
+        handle, m, n, nrhs, A, lda, B, ldb, X, ldx, iter, info);
+}
+
+extern "C" rocblas_status rocsolver_zcgels(rocblas_handle handle,
+                                           const rocblas_int m,
+                                           const rocblas_int n,
+                                           const rocblas_int nrhs,
+                                           rocblas_double_complex* A,
+                                           const rocblas_int lda,
+                                           rocblas_double_complex* B,
+                                           const rocblas_int ldb,
+                                           rocblas_double_complex* X,
+                                           const rocblas_int ldx,
+                                           rocblas_int* iter,
+                                           rocblas_int* info)
+{
+    return rocsolver::rocsolver_gels_mixed_impl<rocblas_double_complex>(
+        handle, m, n, nrhs, A, lda, B, ldb, X, ldx, iter, info);
+}
@@ -0,0 +1,477 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "rocauxiliary_lange_lansy.hpp"
+#include "rocblas.hpp"
+#include "roclapack_gels.hpp"
+#include "roclapack_gesv_mixed.hpp"
+#include "rocsolver/rocsolver.h"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/** GELS_MIXED_CHECK checks the convergence of the least squares problems that are still being
+    refined, i.e. whether the residual of the normal equations G = A' * R is negligible:
+    ||G_j||_inf <= ||A||_1 * (||A||_inf * ||X_j||_inf + ||R_j||_inf) * cte for all the columns j.
+    It updates state, iter and the counters as GESV_MIXED_CHECK does. Each thread-block processes
+    one problem. **/
+template <int MAX_THDS, typename T, typename S, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(MAX_THDS) gels_mixed_check(const rocblas_int m,
+                                                                   const rocblas_int n,
+                                                                   const rocblas_int nrhs,
+                                                                   U X,
+                                                                   const rocblas_int shiftX,
+                                                                   const rocblas_int ldx,
+                                                                   const rocblas_stride strideX,
+                                                                   U R,
+                                                                   const rocblas_int ldr,
+                                                                   const rocblas_stride strideR,
+                                                                   U G,
+                                                                   const rocblas_int ldg,
+                                                                   const rocblas_stride strideG,
+                                                                   const S* anorm_inf,
+                                                                   const S* anorm_one,
+                                                                   const S cte,
+                                                                   const rocblas_int iiter,
+                                                                   rocblas_int* state,
+                                                                   rocblas_int* iter,
+                                                                   rocblas_int* counters)
+{
+    const rocblas_int b = hipBlockIdx_y;
+    const rocblas_int tid = hipThreadIdx_x;
+
+    __shared__ S sval[MAX_THDS];
+    __shared__ rocblas_int sidx[MAX_THDS];
+
+    if(state[b] == GESV_MIXED_REFINING)
+    {
+        T* Xp = load_ptr_batch<T>(X, b, shiftX, strideX);
+        T* Rp = load_ptr_batch<T>(R, b, 0, strideR);
+        T* Gp = load_ptr_batch<T>(G, b, 0, strideG);
+
+        bool converged = true;
+        for(rocblas_int j = 0; j < nrhs && converged; j++)
+        {
+            iamax<MAX_THDS>(tid, n, Xp + j * ldx, 1, sval, sidx);
+            __syncthreads();
+            S xnrm = sval[0];
+            __syncthreads();
+
+            iamax<MAX_THDS>(tid, m, Rp + j * ldr, 1, sval, sidx);
+            __syncthreads();
+            S rnrm = sval[0];
+            __syncthreads();
+
+            iamax<MAX_THDS>(tid, n, Gp + j * ldg, 1, sval, sidx);
+            __syncthreads();
+            S gnrm = sval[0];
+            __syncthreads();
+
+            // (a NaN in the residual is not considered converged)
+            converged = (gnrm <= anorm_one[b] * (anorm_inf[b] * xnrm + rnrm) * cte);
+        }
+
+        if(tid == 0)
+        {
+            if(converged)
+            {
+                state[b] = GESV_MIXED_CONVERGED;
+                iter[b] = iiter;
+            }
+            else if(iiter == GESV_MIXED_MAX_ITERS)
+                state[b] = -GESV_MIXED_MAX_ITERS - 1;
+        }
+    }
+
+    if(tid == 0)
+    {
+        rocblas_int s = state[b];
+        if(s == GESV_MIXED_REFINING)
+            atomicAdd(counters, 1);
+        else if(s < 0)
+        {
+            iter[b] = s;
+            atomicAdd(counters + 1, 1);
+        }
+    }
+}
+
+template <typename T>
+rocblas_status rocsolver_gels_mixed_argCheck(rocblas_handle handle,
+                                             const rocblas_int m,
+                                             const rocblas_int n,
+                                             const rocblas_int nrhs,
+                                             const rocblas_int lda,
+                                             const rocblas_int ldb,
+                                             const rocblas_int ldx,
+                                             T A,
+                                             T B,
+                                             T X,
+                                             const rocblas_int* iter,
+                                             const rocblas_int* info,
+                                             const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    // (only overdetermined or square systems are supported)
+    if(m < 0 || n < 0 || nrhs < 0 || m < n || lda < m || ldb < m || ldx < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((m * n && !A) || (m * nrhs && !B) || (n * nrhs && !X) || (batch_count && !iter)
+       || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void rocsolver_gels_mixed_getMemorySize(const rocblas_int m,
+                                        const rocblas_int n,
+                                        const rocblas_int nrhs,
+                                        const rocblas_int batch_count,
+                                        size_t* size_scalars,
+                                        size_t* size_scalars_low,
+                                        size_t* size_work_x_temp,
+                                        size_t* size_workArr_temp_arr,
+                                        size_t* size_diag_trfac_invA,
+                                        size_t* size_trfact_workTrmm_invA_arr,
+                                        size_t* size_ipiv_savedB,
+                                        size_t* size_tau_low,
+                                        size_t* size_Alow,
+                                        size_t* size_Xlow,
+                                        size_t* size_R,
+                                        size_t* size_G,
+                                        size_t* size_Rarr,
+                                        size_t* size_anorm,
+                                        size_t* size_state,
+                                        bool* optim_mem)
+{
+    using Tl = gesv_mixed_low_t<T>;
+    using S = decltype(std::real(T{}));
+
+    // if quick return, no workspace is needed
+    if(n == 0 || nrhs == 0 || batch_count == 0)
+    {
+        *size_scalars = 0;
+        *size_scalars_low = 0;
+        *size_work_x_temp = 0;
+        *size_workArr_temp_arr = 0;
+        *size_diag_trfac_invA = 0;
+        *size_trfact_workTrmm_invA_arr = 0;
+        *size_ipiv_savedB = 0;
+        *size_tau_low = 0;
+        *size_Alow = 0;
+        *size_Xlow = 0;
+        *size_R = 0;
+        *size_G = 0;
+        *size_Rarr = 0;
+        *size_anorm = 0;
+        *size_state = 0;
+        *optim_mem = true;
+        return;
+    }
+
+    bool opt1, opt2, opt3;
+    size_t w1, w2, w3, w4, w5;
+
+    // workspace required for calling GELS in full precision
+    // (for the problems that need to be solved again)
+    rocsolver_gels_getMemorySize<BATCHED, STRIDED, T>(
+        rocblas_operation_none, m, n, nrhs, batch_count, size_scalars, size_work_x_temp,
+        size_workArr_temp_arr, size_diag_trfac_invA, size_trfact_workTrmm_invA_arr,
+        size_ipiv_savedB, &opt1);
+
+    // workspace required for computing the QR factorization, the first solution and the
+    // corrections in lower precision (the lower precision copies are always strided)
+    rocsolver_gels_getMemorySize<false, true, Tl>(rocblas_operation_none, m, n, nrhs, batch_count,
+                                                  size_scalars_low, &w1, &w2, &w3, &w4, &w5, &opt2);
+
+    *size_work_x_temp = std::max(*size_work_x_temp, w1);
+    *size_workArr_temp_arr = std::max(*size_workArr_temp_arr, w2);
+    *size_diag_trfac_invA = std::max(*size_diag_trfac_invA, w3);
+    *size_trfact_workTrmm_invA_arr = std::max(*size_trfact_workTrmm_invA_arr, w4);
+
+    rocsolver_trsm_mem<false, true, Tl>(rocblas_side_left, rocblas_operation_conjugate_transpose, n,
+                                        nrhs, batch_count, &w1, &w2, &w3, &w4, &opt3);
+
+    *size_work_x_temp = std::max(*size_work_x_temp, w1);
+    *size_workArr_temp_arr = std::max(*size_workArr_temp_arr, w2);
+    *size_diag_trfac_invA = std::max(*size_diag_trfac_invA, w3);
+    *size_trfact_workTrmm_invA_arr = std::max(*size_trfact_workTrmm_invA_arr, w4);
+    *optim_mem = opt1 && opt2 && opt3;
+
+    // Householder scalars of the lower precision factorization
+    *size_tau_low = sizeof(Tl) * n * batch_count;
+
+    // lower precision copies of A and of the right hand sides/corrections
+    *size_Alow = sizeof(Tl) * m * n * batch_count;
+    *size_Xlow = sizeof(Tl) * m * nrhs * batch_count;
+
+    // residuals of the system and of the normal equations in full precision
+    *size_R = sizeof(T) * m * nrhs * batch_count;
+    *size_G = sizeof(T) * n * nrhs * batch_count;
+    *size_Rarr = BATCHED ? sizeof(T*) * 2 * batch_count : 0;
+
+    // infinity and one norms of A, status of each problem, info of the lower precision
+    // factorization, and counters of pending/failed problems
+    *size_anorm = sizeof(S) * 2 * batch_count;
+    *size_state = sizeof(rocblas_int) * (2 * batch_count + 2);
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename U>
+rocblas_status rocsolver_gels_mixed_template(rocblas_handle handle,
+                                             const rocblas_int m,
+                                             const rocblas_int n,
+                                             const rocblas_int nrhs,
+                                             U A,
+                                             const rocblas_int shiftA,
+                                             const rocblas_int lda,
+                                             const rocblas_stride strideA,
+                                             U B,
+                                             const rocblas_int shiftB,
+                                             const rocblas_int ldb,
+                                             const rocblas_stride strideB,
+                                             U X,
+                                             const rocblas_int shiftX,
+                                             const rocblas_int ldx,
+                                             const rocblas_stride strideX,
+                                             rocblas_int* iter,
+                                             rocblas_int* info,
+                                             const rocblas_int batch_count,
+                                             T* scalars,
+                                             gesv_mixed_low_t<T>* scalars_low,
+                                             void* work_x_temp,
+                                             void* workArr_temp_arr,
+                                             void* diag_trfac_invA,
+                                             void* trfact_workTrmm_invA_arr,
+                                             T* ipiv_savedB,
+                                             gesv_mixed_low_t<T>* tau_low,
+                                             gesv_mixed_low_t<T>* Alow,
+                                             gesv_mixed_low_t<T>* Xlow,
+                                             T* Rbuf,
+                                             T* Gbuf,
+                                             T** Rarr,
+                                             decltype(std::real(T{}))* anorm,
+                                             rocblas_int* state,
+                                             bool optim_mem)
+{
+    ROCSOLVER_ENTER("gels_mixed", "m:", m, "n:", n, "nrhs:", nrhs, "shiftA:", shiftA, "lda:", lda,
+                    "shiftB:", shiftB, "ldb:", ldb, "shiftX:", shiftX, "ldx:", ldx,
+                    "bc:", batch_count);
+
+    using Tl = gesv_mixed_low_t<T>;
+    using S = decltype(std::real(T{}));
+
+    // quick return if zero instances in batch
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocksReset = (batch_count - 1) / BS1 + 1;
+    dim3 gridReset(blocksReset, 1, 1);
+    dim3 threads(BS1, 1, 1);
+
+    // info=0 (starting with a full rank matrix) and iter=0
+    ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, info, batch_count, 0);
+    ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, iter, batch_count, 0);
+
+    // quick return if A or B are empty
+    if(n == 0 || nrhs == 0)
+        return rocblas_status_success;
+
+    // everything must be executed with scalars on the host
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+    T one = 1;
+    T zero = 0;
+    T minone = -1;
+
+    // constants in host memory
+    const rocblas_int blocksx = (m - 1) / 32 + 1;
+    const rocblas_int blocksn = (n - 1) / 32 + 1;
+    const rocblas_int blocksy = (nrhs - 1) / 32 + 1;
+    const dim3 gridA(blocksx, blocksn, batch_count);
+    const dim3 gridB(blocksx, blocksy, batch_count);
+    const dim3 gridX(blocksn, blocksy, batch_count);
+    const dim3 threads2(32, 32, 1);
+    const dim3 gridBatch(1, batch_count, 1);
+    const rocblas_int check_threads = std::min(((n - 1) / 64 + 1) * 64, BS1);
+    const rocblas_stride strideAl = rocblas_stride(m) * n;
+    const rocblas_stride strideXl = rocblas_stride(m) * nrhs;
+    const rocblas_stride strideR = rocblas_stride(m) * nrhs;
+    const rocblas_stride strideG = rocblas_stride(n) * nrhs;
+    const S cte = get_epsilon<T>() * std::sqrt(S(m));
+
+    rocblas_int* linfo = state + batch_count;
+    rocblas_int* counters = state + 2 * batch_count;
+    info_mask refining(state, info_mask::negate);
+
+    // the residuals are accessed in the same way as the user matrices
+    U R, G;
+    if constexpr(BATCHED)
+    {
+        ROCSOLVER_LAUNCH_KERNEL(get_array, gridReset, threads, 0, stream, Rarr, Rbuf, strideR,
+                                batch_count);
+        ROCSOLVER_LAUNCH_KERNEL(get_array, gridReset, threads, 0, stream, Rarr + batch_count, Gbuf,
+                                strideG, batch_count);
+        R = Rarr;
+        G = Rarr + batch_count;
+    }
+    else
+    {
+        R = Rbuf;
+        G = Gbuf;
+    }
+
+    // the iterative refinement needs to check for convergence on the host, and thus it is not
+    // used while the stream is being captured into a graph; in that case, the problems are
+    // solved directly in full precision (with iter = -1)
+    rocblas_int h_counters[2] = {0, 1};
+    if(stream_is_capturing(stream))
+        ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, iter, batch_count, -1);
+    else
+    {
+        // convert A and B to the lower precision, and compute the norms of A
+        ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, state, batch_count,
+                                GESV_MIXED_REFINING);
+        ROCSOLVER_LAUNCH_KERNEL((gesv_mixed_demote<T, Tl>), gridA, threads2, 0, stream,
+                                rocblas_fill_full, m, n, A, shiftA, lda, strideA, Alow, m, strideAl,
+                                state);
+        ROCSOLVER_LAUNCH_KERNEL((gesv_mixed_demote<T, Tl>), gridB, threads2, 0, stream,
+                                rocblas_fill_full, m, nrhs, B, shiftB, ldb, strideB, Xlow, m,
+                                strideXl, state);
+        rocsolver_lange_lansy_template<T>(handle, rocsolver_norm_inf, rocblas_fill_full, m, n, A,
+                                          shiftA, lda, strideA, anorm, batch_count);
+        rocsolver_lange_lansy_template<T>(handle, rocsolver_norm_one, rocblas_fill_full, m, n, A,
+                                          shiftA, lda, strideA, anorm + batch_count, batch_count);
+
+        // compute the QR factorization in lower precision and the first solution
+        // X = R \ (Q' * B)
+        rocsolver_geqrf_template<false, true>(handle, m, n, Alow, 0, m, strideAl, tau_low, n,
+                                              batch_count, scalars_low, work_x_temp,
+                                              (Tl*)workArr_temp_arr, (Tl*)diag_trfac_invA,
+                                              (Tl**)trfact_workTrmm_invA_arr);
+        ROCSOLVER_LAUNCH_KERNEL(check_singularity<Tl>, dim3(batch_count, 1, 1),
+                                dim3(1, check_threads, 1), 0, stream, n, Alow, 0, m, strideAl,
+                                linfo);
+        ROCSOLVER_LAUNCH_KERNEL(gesv_mixed_factor_check, gridReset, threads, 0, stream, batch_count,
+                                linfo, state);
+
+        rocsolver_ormqr_unmqr_template<false, true>(
+            handle, rocblas_side_left, rocblas_operation_conjugate_transpose, m, nrhs, n, Alow, 0,
+            m, strideAl, tau_low, n, Xlow, 0, m, strideXl, batch_count, scalars_low,
+            (Tl*)work_x_temp, (Tl*)workArr_temp_arr, (Tl*)diag_trfac_invA,
+            (Tl**)trfact_workTrmm_invA_arr);
+        rocsolver_trsm_upper<false, true, Tl>(
+            handle, rocblas_side_left, rocblas_operation_none, rocblas_diagonal_non_unit, n, nrhs,
+            Alow, 0, m, strideAl, Xlow, 0, m, strideXl, batch_count, optim_mem, work_x_temp,
+            workArr_temp_arr, diag_trfac_invA, trfact_workTrmm_invA_arr);
+        ROCSOLVER_LAUNCH_KERNEL((gesv_mixed_promote<false, T, Tl>), gridX, threads2, 0, stream, n,
+                                nrhs, Xlow, m, strideXl, X, shiftX, ldx, strideX, refining);
+
+        // iterative refinement with the semi-normal equations
+        for(rocblas_int iiter = 0;; iiter++)
+        {
+            if(iiter > 0)
+            {
+                // solve R' * R * C = G in lower precision and update X = X + C
+                ROCSOLVER_LAUNCH_KERNEL((gesv_mixed_demote<T, Tl>), gridX, threads2, 0, stream,
+                                        rocblas_fill_full, n, nrhs, G, 0, n, strideG, Xlow, n,
+                                        strideXl, state, refining);
+                rocsolver_trsm_upper<false, true, Tl>(
+                    handle, rocblas_side_left, rocblas_operation_conjugate_transpose,
+                    rocblas_diagonal_non_unit, n, nrhs, Alow, 0, m, strideAl, Xlow, 0, n, strideXl,
+                    batch_count, optim_mem, work_x_temp, workArr_temp_arr, diag_trfac_invA,
+                    trfact_workTrmm_invA_arr);
+                rocsolver_trsm_upper<false, true, Tl>(
+                    handle, rocblas_side_left, rocblas_operation_none, rocblas_diagonal_non_unit, n,
+                    nrhs, Alow, 0, m, strideAl, Xlow, 0, n, strideXl, batch_count, optim_mem,
+                    work_x_temp, workArr_temp_arr, diag_trfac_invA, trfact_workTrmm_invA_arr);
+                ROCSOLVER_LAUNCH_KERNEL((gesv_mixed_promote<true, T, Tl>), gridX, threads2, 0,
+                                        stream, n, nrhs, Xlow, n, strideXl, X, shiftX, ldx, strideX,
+                                        refining);
+            }
+
+            // compute the residuals R = B - A * X and G = A' * R in full precision
+            ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, gridB, threads2, 0, stream, m, nrhs, B, shiftB,
+                                    ldb, strideB, R, 0, m, strideR);
+            rocblasCall_gemm(handle, rocblas_operation_none, rocblas_operation_none, m, nrhs, n,
+                             &minone, A, shiftA, lda, strideA, X, shiftX, ldx, strideX, &one, R, 0,
+                             m, strideR, batch_count, (T**)nullptr);
+            rocblasCall_gemm(handle, rocblas_operation_conjugate_transpose, rocblas_operation_none,
+                             n, nrhs, m, &one, A, shiftA, lda, strideA, R, 0, m, strideR, &zero, G,
+                             0, n, strideG, batch_count, (T**)nullptr);
+
+            // check convergence; the host needs to know whether all the problems are done
+            HIP_CHECK(hipMemsetAsync(counters, 0, sizeof(rocblas_int) * 2, stream));
+            ROCSOLVER_LAUNCH_KERNEL((gels_mixed_check<BS1, T>), gridBatch, threads, 0, stream, m,
+                                    n, nrhs, X, shiftX, ldx, strideX, R, m, strideR, G, n, strideG,
+                                    anorm, anorm + batch_count, cte, iiter, state, iter, counters);
+            HIP_CHECK(hipMemcpyAsync(h_counters, counters, sizeof(rocblas_int) * 2,
+                                     hipMemcpyDeviceToHost, stream));
+            rocsolver_stats_host_sync();
+            HIP_CHECK(hipStreamSynchronize(stream));
+
+            if(h_counters[0] == 0)
+                break;
+        }
+    }
+
+    // if the refinement failed for any problem (or was not used), solve the whole batch in
+    // full precision with GELS on a copy of B
+    if(h_counters[1] > 0)
+    {
+        ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, gridB, threads2, 0, stream, m, nrhs, B, shiftB, ldb,
+                                strideB, R, 0, m, strideR);
+        rocsolver_gels_template<BATCHED, STRIDED, T>(
+            handle, rocblas_operation_none, m, n, nrhs, A, shiftA, lda, strideA, R, 0, m, strideR,
+            info, batch_count, scalars, (T*)work_x_temp, (T*)workArr_temp_arr,
+            (T*)diag_trfac_invA, (T**)trfact_workTrmm_invA_arr, ipiv_savedB, optim_mem);
+
+        // (X is not modified for the rank deficient problems)
+        launch_copy_mat<T>(handle, n, nrhs, R, 0, m, strideR, X, shiftX, ldx, strideX, batch_count,
+                           info_mask(info, info_mask::negate));
+    }
+
+    rocblas_set_pointer_mode(handle, old_mode);
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
@@ -34,6 +34,7 @@
 
 #include "auxiliary/rocauxiliary_ormlq_unmlq.hpp"
 #include "auxiliary/rocauxiliary_ormqr_unmqr.hpp"
+#include "lib_memory_primitives.hpp"
 #include "rocblas.hpp"
 #include "roclapack_gelqf.hpp"
 #include "roclapack_gels.hpp"
@@ -42,6 +43,181 @@
 
 ROCSOLVER_BEGIN_NAMESPACE
 
+/** GELS_OUTOFPLACE_USE_FUSED returns true if the factorized problem can be solved with
+    gels_outofplace_fused_kernel, and sets the required size of LDS **/
+template <typename T>
+bool gels_outofplace_use_fused(const rocblas_int m,
+                               const rocblas_int n,
+                               const rocblas_int nrhs,
+                               size_t* lmemsize)
+{
+    *lmemsize = sizeof(T) * (std::max(m, n) + BS1);
+
+    return nrhs <= GELS_FUSED_MAX_NRHS && std::max(m, n) <= GELS_FUSED_MAX_SIZE;
+}
+
+/** GELS_BLOCK_SUM returns, to all the BS1 threads of the group, the sum of their values of val.
+    sred is a shared array of size BS1. **/
+template <typename T>
+__device__ T gels_block_sum(const rocblas_int tid, const T val, T* sred)
+{
+    sred[tid] = val;
+    __syncthreads();
+    for(rocblas_int i = BS1 / 2; i > 0; i /= 2)
+    {
+        if(tid < i)
+            sred[tid] += sred[tid + i];
+        __syncthreads();
+    }
+    T sum = sred[0];
+    __syncthreads();
+    return sum;
+}
+
+/** GELS_OUTOFPLACE_FUSED_KERNEL solves the least-squares (or minimum norm) problem for one column
+    of B per group of BS1 threads, once A has been factorized with GEQRF (m >= n) or GELQF (m < n).
+    The column of B is read into LDS, where the reflectors of the factorization and the
+    triangular solve are applied, and only the solution is written to X; B is left unchanged.
+    Each group also checks the diagonal of the triangular factor; the first group of every batch
+    instance sets info, and no solution is written if the factor is singular. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1)
+    gels_outofplace_fused_kernel(const rocblas_operation trans,
+                                 const rocblas_int m,
+                                 const rocblas_int n,
+                                 U AA,
+                                 const rocblas_int shiftA,
+                                 const rocblas_int lda,
+                                 const rocblas_stride strideA,
+                                 T* ipivA,
+                                 const rocblas_stride strideP,
+                                 U BB,
+                                 const rocblas_int shiftB,
+                                 const rocblas_int ldb,
+                                 const rocblas_stride strideB,
+                                 U XX,
+                                 const rocblas_int shiftX,
+                                 const rocblas_int ldx,
+                                 const rocblas_stride strideX,
+                                 rocblas_int* info)
+{
+    const rocblas_int bid = hipBlockIdx_z;
+    const rocblas_int j = hipBlockIdx_x;
+    const rocblas_int tid = hipThreadIdx_x;
+    const rocblas_int k = std::min(m, n);
+    const bool qr = (m >= n);
+    const bool notrans = (trans == rocblas_operation_none);
+    const rocblas_int rowsB = notrans ? m : n;
+    const rocblas_int rowsX = notrans ? n : m;
+
+    // select batch instance
+    T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+    T* B = load_ptr_batch<T>(BB, bid, shiftB, strideB) + j * ldb;
+    T* X = load_ptr_batch<T>(XX, bid, shiftX, strideX) + j * ldx;
+    T* tau = ipivA + bid * strideP;
+
+    // shared memory: the working column and the buffer for the reductions
+    extern __shared__ double lmem[];
+    T* c = reinterpret_cast<T*>(lmem);
+    T* sred = c + std::max(m, n);
+    __shared__ rocblas_int sinfo;
+
+    // look for the first zero in the diagonal of the triangular factor
+    if(tid == 0)
+        sinfo = k + 1;
+    __syncthreads();
+    for(rocblas_int i = tid; i < k; i += BS1)
+    {
+        if(A[i + i * lda] == 0)
+            atomicMin(&sinfo, i + 1);
+    }
+    __syncthreads();
+    const rocblas_int sing = (sinfo <= k) ? sinfo : 0;
+    if(j == 0 && tid == 0)
+        info[bid] = sing;
+    if(sing)
+        return;
+
+    // c = B(:,j), padded with zeros up to max(m,n) rows
+    for(rocblas_int i = tid; i < std::max(m, n); i += BS1)
+        c[i] = (i < rowsB) ? B[i] : T(0);
+    __syncthreads();
+
+    // c = H_l * c (or H_l' * c) for the reflectors l in the order given by the factorization
+    // and the operation; when stored row-wise, the reflectors are conjugated
+    auto apply_reflectors = [&](const bool forward, const bool conjtau) {
+        const rocblas_int len = qr ? m : n;
+        for(rocblas_int p = 0; p < k; ++p)
+        {
+            const rocblas_int l = forward ? p : k - 1 - p;
+
+            T partial = 0;
+            for(rocblas_int i = l + tid; i < len; i += BS1)
+            {
+                T v = (i == l) ? T(1) : (qr ? A[i + l * lda] : conj(A[l + i * lda]));
+                partial += conj(v) * c[i];
+            }
+            T w = gels_block_sum(tid, partial, sred) * (conjtau ? conj(tau[l]) : tau[l]);
+
+            for(rocblas_int i = l + tid; i < len; i += BS1)
+            {
+                T v = (i == l) ? T(1) : (qr ? A[i + l * lda] : conj(A[l + i * lda]));
+                c[i] -= w * v;
+            }
+            __syncthreads();
+        }
+    };
+
+    // solve the triangular system with the k-by-k factor and right-hand side c
+    // (backward substitution if the effective matrix is upper triangular)
+    auto solve_triangular = [&](const bool upper, const bool conjA) {
+        for(rocblas_int p = 0; p < k; ++p)
+        {
+            const rocblas_int i = upper ? k - 1 - p : p;
+            const T d = conjA ? conj(A[i + i * lda]) : A[i + i * lda];
+            const T ci = c[i] / d;
+            __syncthreads();
+            if(tid == 0)
+                c[i] = ci;
+
+            const rocblas_int r0 = upper ? 0 : i + 1;
+            const rocblas_int r1 = upper ? i : k;
+            for(rocblas_int r = r0 + tid; r < r1; r += BS1)
+                c[r] -= (conjA ? conj(A[i + r * lda]) : A[r + i * lda]) * ci;
+            __syncthreads();
+        }
+    };
+
+    if(qr && notrans)
+    {
+        // solve R * X = Q' * B
+        apply_reflectors(true, true);
+        solve_triangular(true, false);
+    }
+    else if(qr)
+    {
+        // solve R' * Y = B, then X = Q * Y
+        solve_triangular(false, true);
+        apply_reflectors(false, false);
+    }
+    else if(notrans)
+    {
+        // solve L * Y = B, then X = Q' * Y
+        solve_triangular(false, false);
+        apply_reflectors(false, false);
+    }
+    else
+    {
+        // solve L' * X = Q * B
+        apply_reflectors(true, true);
+        solve_triangular(true, true);
+    }
+
+    // write the solution
+    for(rocblas_int i = tid; i < rowsX; i += BS1)
+        X[i] = c[i];
+}
+
 template <bool BATCHED, bool STRIDED, typename T>
 void rocsolver_gels_outofplace_getMemorySize(const rocblas_operation trans,
                                              const rocblas_int m,
@@ -79,7 +255,12 @@ void rocsolver_gels_outofplace_getMemorySize(const rocblas_operation trans,
 
     *size_ipiv = sizeof(T) * std::min(m, n) * batch_count;
 
-    if((trans == rocblas_operation_none && m >= n) || (trans != rocblas_operation_none && m < n))
+    // the fused kernel leaves B unchanged
+    size_t lmemsize;
+    if(gels_outofplace_use_fused<T>(m, n, nrhs, &lmemsize))
+        *size_savedB = 0;
+    else if((trans == rocblas_operation_none && m >= n)
+            || (trans != rocblas_operation_none && m < n))
         *size_savedB = sizeof(T) * std::max(m, n) * nrhs * batch_count;
     else
         *size_savedB = 0;
@@ -175,21 +356,17 @@ rocblas_status rocsolver_gels_outofplace_template(rocblas_handle handle,
     dim3 gridReset(blocksReset, 1, 1);
     dim3 threads(BS1, 1, 1);
 
-    // info=0 (starting with a nonsingular matrix)
-    ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, info, batch_count, 0);
-
-    // quick return if B and X are empty
-    if(nrhs == 0)
-        return rocblas_status_success;
-
-    // quick return if A is empty
-    if(m == 0 || n == 0)
+    // quick return if B and X are empty or A is empty
+    // (otherwise, info is set by the singularity check of the triangular factor)
+    if(nrhs == 0 || m == 0 || n == 0)
     {
+        // info=0 (starting with a nonsingular matrix)
+        ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, info, batch_count, 0);
+        if(nrhs == 0)
+            return rocblas_status_success;
+
         rocblas_int rowsX = (trans == rocblas_operation_none ? n : m);
-        rocblas_int blocksx = (rowsX - 1) / 32 + 1;
-        rocblas_int blocksy = (nrhs - 1) / 32 + 1;
-        ROCSOLVER_LAUNCH_KERNEL(set_zero<T>, dim3(blocksx, blocksy, batch_count), dim3(32, 32), 0,
-                                stream, rowsX, nrhs, X, shiftX, ldx, strideX);
+        launch_set_zero<T>(handle, rowsX, nrhs, X, shiftX, ldx, strideX, batch_count);
 
         return rocblas_status_success;
     }
@@ -202,12 +379,32 @@ rocblas_status rocsolver_gels_outofplace_template(rocblas_handle handle,
     // constants in host memory
     const rocblas_stride strideP = std::min(m, n);
     const rocblas_int check_threads = std::min(((std::min(m, n) - 1) / 64 + 1) * 64, BS1);
-    const rocblas_int copyblocksmin = (std::min(m, n) - 1) / 32 + 1;
-    const rocblas_int copyblocksmax = (std::max(m, n) - 1) / 32 + 1;
     const rocblas_int copyblocksy = (nrhs - 1) / 32 + 1;
 
     // TODO: apply scaling to improve accuracy over a larger range of values
 
+    // for a small number of right-hand sides, read B once and write only X
+    size_t lmemsize;
+    if(gels_outofplace_use_fused<T>(m, n, nrhs, &lmemsize))
+    {
+        if(m >= n)
+            rocsolver_geqrf_template<BATCHED, STRIDED>(
+                handle, m, n, A, shiftA, lda, strideA, ipiv, strideP, batch_count, scalars,
+                work_x_temp, workArr_temp_arr, diag_trfac_invA, trfact_workTrmm_invA_arr);
+        else
+            rocsolver_gelqf_template<BATCHED, STRIDED>(
+                handle, m, n, A, shiftA, lda, strideA, ipiv, strideP, batch_count, scalars,
+                work_x_temp, workArr_temp_arr, diag_trfac_invA, trfact_workTrmm_invA_arr);
+
+        ROCSOLVER_LAUNCH_KERNEL((gels_outofplace_fused_kernel<T>), dim3(nrhs, 1, batch_count),
+                                dim3(BS1), lmemsize, stream, trans, m, n, A, shiftA, lda, strideA,
+                                ipiv, strideP, B, shiftB, ldb, strideB, X, shiftX, ldx, strideX,
+                                info);
+
+        rocblas_set_pointer_mode(handle, old_mode);
+        return rocblas_status_success;
+    }
+
     // If rows(B) < rows(X), then copy B to X and compute result in X.
     // If rows(B) > rows(X), then copy B to savedB, compute result in B, copy result from B to X, and restore B from savedB.
 
@@ -221,9 +418,8 @@ rocblas_status rocsolver_gels_outofplace_template(rocblas_handle handle,
         if(trans == rocblas_operation_none)
         {
             // save B in savedB
-            ROCSOLVER_LAUNCH_KERNEL((copy_mat<T, U>), dim3(copyblocksmax, copyblocksy, batch_count),
-                                    dim3(32, 32), 0, stream, copymat_to_buffer, m, nrhs, B, shiftB,
-                                    ldb, strideB, savedB);
+            launch_copy_mat<T>(handle, m, nrhs, B, shiftB, ldb, strideB, savedB, 0, m,
+                               rocblas_stride(m) * nrhs, batch_count);
 
             rocsolver_ormqr_unmqr_template<BATCHED, STRIDED>(
                 handle, rocblas_side_left, rocblas_operation_conjugate_transpose, m, nrhs, n, A,
@@ -241,14 +437,12 @@ rocblas_status rocsolver_gels_outofplace_template(rocblas_handle handle,
                 work_x_temp, workArr_temp_arr, diag_trfac_invA, trfact_workTrmm_invA_arr);
 
             // copy result to X
-            ROCSOLVER_LAUNCH_KERNEL((copy_mat<T, U>), dim3(copyblocksmin, copyblocksy, batch_count),
-                                    dim3(32, 32), 0, stream, n, nrhs, B, shiftB, ldb, strideB, X,
-                                    shiftX, ldx, strideX);
+            launch_copy_mat<T>(handle, n, nrhs, B, shiftB, ldb, strideB, X, shiftX, ldx, strideX,
+                               batch_count);
 
             // restore B from savedB
-            ROCSOLVER_LAUNCH_KERNEL((copy_mat<T, U>), dim3(copyblocksmax, copyblocksy, batch_count),
-                                    dim3(32, 32), 0, stream, copymat_from_buffer, m, nrhs, B,
-                                    shiftB, ldb, strideB, savedB);
+            launch_copy_mat<T>(handle, m, nrhs, savedB, 0, m, rocblas_stride(m) * nrhs, B, shiftB,
+                               ldb, strideB, batch_count);
         }
         else
         {
@@ -257,9 +451,8 @@ rocblas_status rocsolver_gels_outofplace_template(rocblas_handle handle,
                                     strideA, info);
 
             // copy B to X
-            ROCSOLVER_LAUNCH_KERNEL((copy_mat<T, U>), dim3(copyblocksmin, copyblocksy, batch_count),
-                                    dim3(32, 32), 0, stream, n, nrhs, B, shiftB, ldb, strideB, X,
-                                    shiftX, ldx, strideX);
+            launch_copy_mat<T>(handle, n, nrhs, B, shiftB, ldb, strideB, X, shiftX, ldx, strideX,
+                               batch_count);
 
             // solve R'Y = B (here Y = Q'X)
             rocsolver_trsm_upper<BATCHED, STRIDED, T>(
@@ -294,9 +487,8 @@ rocblas_status rocsolver_gels_outofplace_template(rocblas_handle handle,
                                     strideA, info);
 
             // copy B to X
-            ROCSOLVER_LAUNCH_KERNEL((copy_mat<T, U>), dim3(copyblocksmin, copyblocksy, batch_count),
-                                    dim3(32, 32), 0, stream, m, nrhs, B, shiftB, ldb, strideB, X,
-                                    shiftX, ldx, strideX);
+            launch_copy_mat<T>(handle, m, nrhs, B, shiftB, ldb, strideB, X, shiftX, ldx, strideX,
+                               batch_count);
 
             // solve LY = B (here Y = QX)
             rocsolver_trsm_lower<BATCHED, STRIDED, T>(
@@ -318,9 +510,8 @@ rocblas_status rocsolver_gels_outofplace_template(rocblas_handle handle,
         else
         {
             // save B in savedB
-            ROCSOLVER_LAUNCH_KERNEL((copy_mat<T, U>), dim3(copyblocksmax, copyblocksy, batch_count),
-                                    dim3(32, 32), 0, stream, copymat_to_buffer, n, nrhs, B, shiftB,
-                                    ldb, strideB, savedB);
+            launch_copy_mat<T>(handle, n, nrhs, B, shiftB, ldb, strideB, savedB, 0, n,
+                               rocblas_stride(n) * nrhs, batch_count);
 
             rocsolver_ormlq_unmlq_template<BATCHED, STRIDED>(
                 handle, rocblas_side_left, rocblas_operation_none, n, nrhs, m, A, shiftA, lda,
@@ -339,14 +530,12 @@ rocblas_status rocsolver_gels_outofplace_template(rocblas_handle handle,
                 trfact_workTrmm_invA_arr);
 
             // copy result to X
-            ROCSOLVER_LAUNCH_KERNEL((copy_mat<T, U>), dim3(copyblocksmin, copyblocksy, batch_count),
-                                    dim3(32, 32), 0, stream, m, nrhs, B, shiftB, ldb, strideB, X,
-                                    shiftX, ldx, strideX);
+            launch_copy_mat<T>(handle, m, nrhs, B, shiftB, ldb, strideB, X, shiftX, ldx, strideX,
+                               batch_count);
 
             // restore B from savedB
-            ROCSOLVER_LAUNCH_KERNEL((copy_mat<T, U>), dim3(copyblocksmax, copyblocksy, batch_count),
-                                    dim3(32, 32), 0, stream, copymat_from_buffer, n, nrhs, B,
-                                    shiftB, ldb, strideB, savedB);
+            launch_copy_mat<T>(handle, n, nrhs, savedB, 0, n, rocblas_stride(n) * nrhs, B, shiftB,
+                               ldb, strideB, batch_count);
         }
     }
 
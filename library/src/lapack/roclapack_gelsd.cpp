@@ -0,0 +1,199 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "roclapack_gelsd.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_gelsd_impl(rocblas_handle handle,
+                                    const rocblas_int m,
+                                    const rocblas_int n,
+                                    const rocblas_int nrhs,
+                                    U A,
+                                    const rocblas_int lda,
+                                    U B,
+                                    const rocblas_int ldb,
+                                    S* sval,
+                                    const S rcond,
+                                    rocblas_int* rank,
+                                    rocblas_int* info)
+{
+    ROCSOLVER_ENTER_TOP("gelsd", "-m", m, "-n", n, "--nrhs", nrhs, "--lda", lda, "--ldb", ldb,
+                        "--rcond", rcond);
+    ROCSOLVER_INFO_SUMMARY(info, 1);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st
+        = rocsolver_gelsd_argCheck(handle, m, n, nrhs, A, lda, B, ldb, sval, rank, info);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    const rocblas_int shiftA = 0;
+    const rocblas_int shiftB = 0;
+
+    // normal (non-batched non-strided) execution
+    const rocblas_stride strideA = 0;
+    const rocblas_stride strideB = 0;
+    const rocblas_stride strideS = 0;
+    const rocblas_int batch_count = 1;
+
+    // memory workspace sizes:
+    // constants in rocblas calls (only whether they are needed, see set_device_scalars)
+    size_t size_scalars;
+    // size of reusable workspaces (for calling GEBRD and ORMBR/UNMBR)
+    size_t size_work_workArr, size_Abyx_norms_tmptr, size_X_trfact, size_Y_workArr;
+    // size of the off-diagonal of the bidiagonal form and of the Householder scalars
+    size_t size_E, size_tau;
+    // extra requirements for calling BDSDC
+    size_t size_splits, size_work;
+    // size of the right singular vectors of the bidiagonal form and of the temporary array
+    size_t size_V_tmp;
+    rocsolver_gelsd_getMemorySize<false, T, S>(m, n, nrhs, batch_count, &size_scalars,
+                                               &size_work_workArr, &size_Abyx_norms_tmptr,
+                                               &size_X_trfact, &size_Y_workArr, &size_E, &size_tau,
+                                               &size_splits, &size_work, &size_V_tmp);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_t(0), size_work_workArr,
+                                                      size_Abyx_norms_tmptr, size_X_trfact,
+                                                      size_Y_workArr, size_E, size_tau, size_splits,
+                                                      size_work, size_V_tmp);
+
+    // memory workspace allocation
+    void *scalars, *work_workArr, *Abyx_norms_tmptr, *X_trfact, *Y_workArr, *E, *tau, *splits,
+        *work, *V_tmp;
+    rocblas_device_malloc mem(handle, size_t(0), size_work_workArr, size_Abyx_norms_tmptr,
+                              size_X_trfact, size_Y_workArr, size_E, size_tau, size_splits,
+                              size_work, size_V_tmp);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    scalars = mem[0];
+    work_workArr = mem[1];
+    Abyx_norms_tmptr = mem[2];
+    X_trfact = mem[3];
+    Y_workArr = mem[4];
+    E = mem[5];
+    tau = mem[6];
+    splits = mem[7];
+    work = mem[8];
+    V_tmp = mem[9];
+    if(size_scalars > 0)
+        ROCBLAS_CHECK(set_device_scalars<T>(scalars));
+
+    // execution
+    return _info_summary_scope.commit(rocsolver_gelsd_template<false, false, T>(
+        handle, m, n, nrhs, A, shiftA, lda, strideA, B, shiftB, ldb, strideB, sval, strideS, rcond,
+        rank, info, batch_count, (T*)scalars, work_workArr, (T*)Abyx_norms_tmptr, (T*)X_trfact,
+        (T**)Y_workArr, (S*)E, (T*)tau, (rocblas_int*)splits, (S*)work, (T*)V_tmp));
+}
+
+ROCSOLVER_END_NAMESPACE
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sgelsd(rocblas_handle handle,
+                                const rocblas_int m,
+                                const rocblas_int n,
+                                const rocblas_int nrhs,
+                                float* A,
+                                const rocblas_int lda,
+                                float* B,
+                                const rocblas_int ldb,
+                                float* S,
+                                const float rcond,
+                                rocblas_int* rank,
+                                rocblas_int* info)
+{
+    return rocsolver::rocsolver_gelsd_impl<float>(handle, m, n, nrhs, A, lda, B, ldb, S, rcond,
+                                                  rank, info);
+}
+
+rocblas_status rocsolver_dgelsd(rocblas_handle handle,
+                                const rocblas_int m,
+                                const rocblas_int n,
+                                const rocblas_int nrhs,
+                                double* A,
+                                const rocblas_int lda,
+                                double* B,
+                                const rocblas_int ldb,
+                                double* S,
+                                const double rcond,
+                                rocblas_int* rank,
+                                rocblas_int* info)
+{
+    return rocsolver::rocsolver_gelsd_impl<double>(handle, m, n, nrhs, A, lda, B, ldb, S, rcond,
+                                                   rank, info);
+}
+
+rocblas_status rocsolver_cgelsd(rocblas_handle handle,
+                                const rocblas_int m,
+                                const rocblas_int n,
+                                const rocblas_int nrhs,
+                                rocblas_float_complex* A,
+                                const rocblas_int lda,
+                                rocblas_float_complex* B,
+                                const rocblas_int ldb,
+                                float* S,
+                                const float rcond,
+                                rocblas_int* rank,
+                                rocblas_int* info)
+{
+    return rocsolver::rocsolver_gelsd_impl<rocblas_float_complex>(handle, m, n, nrhs, A, lda, B,
+                                                                  ldb, S, rcond, rank, info);
+}
+
+rocblas_status rocsolver_zgelsd(rocblas_handle handle,
+                                const rocblas_int m,
+                                const rocblas_int n,
+                                const rocblas_int nrhs,
+                                rocblas_double_complex* A,
+                                const rocblas_int lda,
+                                rocblas_double_complex* B,
+                                const rocblas_int ldb,
+                                double* S,
+                                const double rcond,
+                                rocblas_int* rank,
+                                rocblas_int* info)
+{
+    return rocsolver::rocsolver_gelsd_impl<rocblas_double_complex>(handle, m, n, nrhs, A, lda, B,
+                                                                   ldb, S, rcond, rank, info);
+}
+
+} // extern C
@@ -0,0 +1,360 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.9.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     November 2019
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "auxiliary/rocauxiliary_bdsdc.hpp"
+#include "auxiliary/rocauxiliary_ormbr_unmbr.hpp"
+#include "rocblas.hpp"
+#include "roclapack_gebrd.hpp"
+#include "rocsolver/rocsolver.h"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/** GELSD_RANK kernel determines the effective rank of each matrix in the batch as the number
+    of singular values (sorted in decreasing order) that are greater than rcond times the
+    largest one. A negative rcond is replaced by the machine precision. **/
+template <typename S>
+ROCSOLVER_KERNEL void gelsd_rank(const rocblas_int k,
+                                 S* SS,
+                                 const rocblas_stride strideS,
+                                 const S rcond,
+                                 rocblas_int* rank,
+                                 const rocblas_int batch_count)
+{
+    const auto b = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(b < batch_count)
+    {
+        S* Sp = SS + b * strideS;
+        const S thresh = std::max((rcond < 0 ? get_epsilon<S>() : rcond) * Sp[0], get_safemin<S>());
+
+        rocblas_int r = 0;
+        while(r < k && Sp[r] > thresh)
+            r++;
+
+        rank[b] = r;
+    }
+}
+
+/** GELSD_SCALE kernel multiplies the leading k rows of B by the pseudo-inverse of the
+    diagonal matrix of singular values, truncated to the effective rank **/
+template <typename T, typename S, typename U>
+ROCSOLVER_KERNEL void gelsd_scale(const rocblas_int k,
+                                  const rocblas_int nrhs,
+                                  S* SS,
+                                  const rocblas_stride strideS,
+                                  const rocblas_int* rank,
+                                  U B,
+                                  const rocblas_int shiftB,
+                                  const rocblas_int ldb,
+                                  const rocblas_stride strideB)
+{
+    const auto b = hipBlockIdx_z;
+    const auto j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+    const auto i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(i < k && j < nrhs)
+    {
+        T* Bp = load_ptr_batch<T>(B, b, shiftB, strideB);
+
+        if(i < rank[b])
+            Bp[i + j * ldb] *= T(1 / SS[i + b * strideS]);
+        else
+            Bp[i + j * ldb] = 0;
+    }
+}
+
+template <bool BATCHED, typename T, typename S>
+void rocsolver_gelsd_getMemorySize(const rocblas_int m,
+                                   const rocblas_int n,
+                                   const rocblas_int nrhs,
+                                   const rocblas_int batch_count,
+                                   size_t* size_scalars,
+                                   size_t* size_work_workArr,
+                                   size_t* size_Abyx_norms_tmptr,
+                                   size_t* size_X_trfact,
+                                   size_t* size_Y_workArr,
+                                   size_t* size_E,
+                                   size_t* size_tau,
+                                   size_t* size_splits,
+                                   size_t* size_work,
+                                   size_t* size_V_tmp)
+{
+    // if quick return no workspace needed
+    if(m == 0 || n == 0 || batch_count == 0)
+    {
+        *size_scalars = 0;
+        *size_work_workArr = 0;
+        *size_Abyx_norms_tmptr = 0;
+        *size_X_trfact = 0;
+        *size_Y_workArr = 0;
+        *size_E = 0;
+        *size_tau = 0;
+        *size_splits = 0;
+        *size_work = 0;
+        *size_V_tmp = 0;
+        return;
+    }
+
+    const rocblas_int k = std::min(m, n);
+    const rocblas_int nv = nrhs ? k : 0;
+    size_t s1, s2, s3, s4, unused;
+
+    // requirements for calling GEBRD
+    rocsolver_gebrd_getMemorySize<BATCHED, T>(m, n, batch_count, size_scalars, size_work_workArr,
+                                              size_Abyx_norms_tmptr, size_X_trfact, size_Y_workArr);
+
+    // requirements for applying Q' and P with ORMBR
+    rocsolver_ormbr_unmbr_getMemorySize<BATCHED, T>(rocblas_column_wise, rocblas_side_left, m, nrhs,
+                                                    n, batch_count, &unused, &s1, &s2, &s3, &s4);
+    *size_work_workArr = std::max(*size_work_workArr, s1);
+    *size_Abyx_norms_tmptr = std::max(*size_Abyx_norms_tmptr, s2);
+    *size_X_trfact = std::max(*size_X_trfact, s3);
+    *size_Y_workArr = std::max(*size_Y_workArr, s4);
+
+    rocsolver_ormbr_unmbr_getMemorySize<BATCHED, T>(rocblas_row_wise, rocblas_side_left, n, nrhs, m,
+                                                    batch_count, &unused, &s1, &s2, &s3, &s4);
+    *size_work_workArr = std::max(*size_work_workArr, s1);
+    *size_Abyx_norms_tmptr = std::max(*size_Abyx_norms_tmptr, s2);
+    *size_X_trfact = std::max(*size_X_trfact, s3);
+    *size_Y_workArr = std::max(*size_Y_workArr, s4);
+
+    // array of pointers for the (batched) gemm with the right singular vectors
+    if(BATCHED)
+        *size_Y_workArr = std::max(*size_Y_workArr, sizeof(T*) * 2 * batch_count);
+
+    // size of the off-diagonal of the bidiagonal form and of the Householder scalars
+    *size_E = sizeof(S) * k * batch_count;
+    *size_tau = sizeof(T) * 2 * k * batch_count;
+
+    // requirements for calling BDSDC
+    rocsolver_bdsdc_getMemorySize<T, S>(k, nv, 0, nrhs, batch_count, size_splits, size_work);
+
+    // size of the right singular vectors of the bidiagonal form and of the temporary
+    // array for the product with V (only needed when there are right-hand sides)
+    *size_V_tmp = sizeof(T) * k * (nv + nrhs);
+    *size_V_tmp *= batch_count;
+}
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_gelsd_argCheck(rocblas_handle handle,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        const rocblas_int nrhs,
+                                        U A,
+                                        const rocblas_int lda,
+                                        U B,
+                                        const rocblas_int ldb,
+                                        S* sval,
+                                        rocblas_int* rank,
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    if(m < 0 || n < 0 || nrhs < 0 || lda < m || ldb < m || ldb < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((m && n && !A) || (((m && nrhs) || (n && nrhs)) && !B) || (m && n && !sval)
+       || (batch_count && !rank) || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename S, typename U>
+rocblas_status rocsolver_gelsd_template(rocblas_handle handle,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        const rocblas_int nrhs,
+                                        U A,
+                                        const rocblas_int shiftA,
+                                        const rocblas_int lda,
+                                        const rocblas_stride strideA,
+                                        U B,
+                                        const rocblas_int shiftB,
+                                        const rocblas_int ldb,
+                                        const rocblas_stride strideB,
+                                        S* sval,
+                                        const rocblas_stride strideS,
+                                        const S rcond,
+                                        rocblas_int* rank,
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count,
+                                        T* scalars,
+                                        void* work_workArr,
+                                        T* Abyx_norms_tmptr,
+                                        T* X_trfact,
+                                        T** Y_workArr,
+                                        S* E,
+                                        T* tau,
+                                        rocblas_int* splits,
+                                        S* work,
+                                        T* V_tmp)
+{
+    ROCSOLVER_ENTER("gelsd", "m:", m, "n:", n, "nrhs:", nrhs, "shiftA:", shiftA, "lda:", lda,
+                    "shiftB:", shiftB, "ldb:", ldb, "rcond:", rcond, "bc:", batch_count);
+
+    // quick return if zero instances in batch
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocksReset = (batch_count - 1) / BS1 + 1;
+    dim3 gridReset(blocksReset, 1, 1);
+    dim3 threads(BS1, 1, 1);
+
+    // info=0 (starting with no convergence failures)
+    ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, info, batch_count, 0);
+
+    // quick return if A is empty
+    if(m == 0 || n == 0)
+    {
+        ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, rank, batch_count, 0);
+
+        rocblas_int rowsB = std::max(m, n);
+        if(nrhs > 0 && rowsB > 0)
+        {
+            rocblas_int blocksx = (rowsB - 1) / 32 + 1;
+            rocblas_int blocksy = (nrhs - 1) / 32 + 1;
+            ROCSOLVER_LAUNCH_KERNEL(set_zero<T>, dim3(blocksx, blocksy, batch_count), dim3(32, 32),
+                                    0, stream, rowsB, nrhs, B, shiftB, ldb, strideB);
+        }
+
+        return rocblas_status_success;
+    }
+
+    // everything must be executed with scalars on the host
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+
+    T one = 1;
+    T zero = 0;
+
+    // constants in host memory
+    const rocblas_int k = std::min(m, n);
+    const rocblas_int nv = nrhs ? k : 0;
+    const rocblas_fill uplo = (m >= n) ? rocblas_fill_upper : rocblas_fill_lower;
+    const rocblas_stride strideE = k;
+    const rocblas_stride strideT = k;
+    const rocblas_int ldx = m;
+    const rocblas_int ldy = n;
+    const rocblas_stride strideX = ldx * GEBRD_GEBD2_SWITCHSIZE;
+    const rocblas_stride strideY = ldy * GEBRD_GEBD2_SWITCHSIZE;
+    const rocblas_stride strideV = k * nv;
+    const rocblas_stride strideTmp = k * nrhs;
+    T* tauq = tau;
+    T* taup = tau + k * batch_count;
+    T* V = V_tmp;
+    T* tmp = V_tmp + strideV * batch_count;
+
+    const rocblas_int blocksk = (k - 1) / 32 + 1;
+    const rocblas_int blocksy = (nrhs - 1) / 32 + 1;
+
+    // TODO: apply scaling to improve accuracy over a larger range of values
+
+    // reduce A to bidiagonal form A = Q * BD * P'; the diagonal of BD is written to sval
+    rocsolver_gebrd_template<BATCHED, STRIDED>(
+        handle, m, n, A, shiftA, lda, strideA, sval, strideS, E, strideE, tauq, strideT, taup,
+        strideT, X_trfact, 0, ldx, strideX, (T*)Y_workArr, 0, ldy, strideY, batch_count, scalars,
+        work_workArr, Abyx_norms_tmptr);
+
+    // B = Q' * B (Q is never formed explicitly)
+    if(nrhs > 0)
+        rocsolver_ormbr_unmbr_template<BATCHED, STRIDED>(
+            handle, rocblas_column_wise, rocblas_side_left, rocblas_operation_conjugate_transpose,
+            m, nrhs, n, A, shiftA, lda, strideA, tauq, strideT, B, shiftB, ldb, strideB,
+            batch_count, scalars, (T*)work_workArr, Abyx_norms_tmptr, X_trfact, Y_workArr);
+
+    // compute the SVD of the bidiagonal form BD = W * S * Z' by divide and conquer,
+    // with V = Z' and B = W' * B
+    if(nv > 0)
+        ROCSOLVER_LAUNCH_KERNEL(init_ident<T>, dim3(blocksk, blocksk, batch_count), dim3(32, 32), 0,
+                                stream, k, k, V, 0, k, strideV);
+
+    rocsolver_bdsdc_template<T>(handle, uplo, k, nv, 0, nrhs, sval, strideS, E, strideE, V, 0, k,
+                                strideV, (T*)nullptr, 0, 1, 1, B, shiftB, ldb, strideB, info,
+                                batch_count, splits, work);
+
+    // determine the effective rank
+    ROCSOLVER_LAUNCH_KERNEL(gelsd_rank<S>, gridReset, threads, 0, stream, k, sval, strideS, rcond,
+                            rank, batch_count);
+
+    if(nrhs > 0)
+    {
+        // B = S^+ * B
+        ROCSOLVER_LAUNCH_KERNEL((gelsd_scale<T, S, U>), dim3(blocksk, blocksy, batch_count),
+                                dim3(32, 32), 0, stream, k, nrhs, sval, strideS, rank, B, shiftB,
+                                ldb, strideB);
+
+        // B = Z * B
+        rocblasCall_gemm(handle, rocblas_operation_conjugate_transpose, rocblas_operation_none, k,
+                         nrhs, k, &one, V, 0, k, strideV, B, shiftB, ldb, strideB, &zero, tmp, 0,
+                         k, strideTmp, batch_count, Y_workArr);
+
+        ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, dim3(blocksk, blocksy, batch_count), dim3(32, 32), 0,
+                                stream, k, nrhs, tmp, 0, k, strideTmp, B, shiftB, ldb, strideB);
+
+        // zero rows m to n-1 of B when A has more columns than rows
+        if(n > k)
+        {
+            const rocblas_int zeroblocksx = (n - k - 1) / 32 + 1;
+            ROCSOLVER_LAUNCH_KERNEL(set_zero<T>, dim3(zeroblocksx, blocksy, batch_count),
+                                    dim3(32, 32), 0, stream, n - k, nrhs, B, shiftB + k, ldb,
+                                    strideB);
+        }
+
+        // B = P * B (P is never formed explicitly)
+        rocsolver_ormbr_unmbr_template<BATCHED, STRIDED>(
+            handle, rocblas_row_wise, rocblas_side_left, rocblas_operation_none, n, nrhs, m, A,
+            shiftA, lda, strideA, taup, strideT, B, shiftB, ldb, strideB, batch_count, scalars,
+            (T*)work_workArr, Abyx_norms_tmptr, X_trfact, Y_workArr);
+    }
+
+    rocblas_set_pointer_mode(handle, old_mode);
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
@@ -0,0 +1,187 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "roclapack_gelsy.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_gelsy_impl(rocblas_handle handle,
+                                    const rocblas_int m,
+                                    const rocblas_int n,
+                                    const rocblas_int nrhs,
+                                    U A,
+                                    const rocblas_int lda,
+                                    U B,
+                                    const rocblas_int ldb,
+                                    rocblas_int* jpvt,
+                                    const S rcond,
+                                    rocblas_int* rank)
+{
+    ROCSOLVER_ENTER_TOP("gelsy", "-m", m, "-n", n, "--nrhs", nrhs, "--lda", lda, "--ldb", ldb,
+                        "--rcond", rcond);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_gelsy_argCheck(handle, m, n, nrhs, A, lda, B, ldb, jpvt, rank);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    const rocblas_int shiftA = 0;
+    const rocblas_int shiftB = 0;
+
+    // normal (non-batched non-strided) execution
+    const rocblas_stride strideA = 0;
+    const rocblas_stride strideB = 0;
+    const rocblas_stride strideJ = 0;
+    const rocblas_int batch_count = 1;
+
+    // memory workspace sizes:
+    // constants in rocblas calls (only whether they are needed, see set_device_scalars)
+    size_t size_scalars;
+    // size of reusable workspaces (for calling GEQP3, GEQRF, ORMQR/UNMQR, and TRSM)
+    bool optim_mem;
+    size_t size_work1, size_work2, size_work3, size_work4;
+    // size of the arrays of partial column norms
+    size_t size_norms;
+    // size of the Householder scalars
+    size_t size_tau;
+    // size of the matrix W and of the temporary copy of the right-hand sides
+    size_t size_W_C;
+    rocsolver_gelsy_getMemorySize<false, T, S>(m, n, nrhs, batch_count, &size_scalars, &size_work1,
+                                               &size_work2, &size_work3, &size_work4, &size_norms,
+                                               &size_tau, &size_W_C, &optim_mem);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_t(0), size_work1, size_work2,
+                                                      size_work3, size_work4, size_norms, size_tau,
+                                                      size_W_C);
+
+    // memory workspace allocation
+    void *scalars, *work1, *work2, *work3, *work4, *norms, *tau, *W_C;
+    rocblas_device_malloc mem(handle, size_t(0), size_work1, size_work2, size_work3, size_work4,
+                              size_norms, size_tau, size_W_C);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    scalars = mem[0];
+    work1 = mem[1];
+    work2 = mem[2];
+    work3 = mem[3];
+    work4 = mem[4];
+    norms = mem[5];
+    tau = mem[6];
+    W_C = mem[7];
+    if(size_scalars > 0)
+        ROCBLAS_CHECK(set_device_scalars<T>(scalars));
+
+    // execution
+    return rocsolver_gelsy_template<false, false, T>(
+        handle, m, n, nrhs, A, shiftA, lda, strideA, B, shiftB, ldb, strideB, jpvt, strideJ, rcond,
+        rank, batch_count, (T*)scalars, work1, work2, work3, work4, (S*)norms, (T*)tau, (T*)W_C,
+        optim_mem);
+}
+
+ROCSOLVER_END_NAMESPACE
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sgelsy(rocblas_handle handle,
+                                const rocblas_int m,
+                                const rocblas_int n,
+                                const rocblas_int nrhs,
+                                float* A,
+                                const rocblas_int lda,
+                                float* B,
+                                const rocblas_int ldb,
+                                rocblas_int* jpvt,
+                                const float rcond,
+                                rocblas_int* rank)
+{
+    return rocsolver::rocsolver_gelsy_impl<float>(handle, m, n, nrhs, A, lda, B, ldb, jpvt, rcond,
+                                                  rank);
+}
+
+rocblas_status rocsolver_dgelsy(rocblas_handle handle,
+                                const rocblas_int m,
+                                const rocblas_int n,
+                                const rocblas_int nrhs,
+                                double* A,
+                                const rocblas_int lda,
+                                double* B,
+                                const rocblas_int ldb,
+                                rocblas_int* jpvt,
+                                const double rcond,
+                                rocblas_int* rank)
+{
+    return rocsolver::rocsolver_gelsy_impl<double>(handle, m, n, nrhs, A, lda, B, ldb, jpvt, rcond,
+                                                   rank);
+}
+
+rocblas_status rocsolver_cgelsy(rocblas_handle handle,
+                                const rocblas_int m,
+                                const rocblas_int n,
+                                const rocblas_int nrhs,
+                                rocblas_float_complex* A,
+                                const rocblas_int lda,
+                                rocblas_float_complex* B,
+                                const rocblas_int ldb,
+                                rocblas_int* jpvt,
+                                const float rcond,
+                                rocblas_int* rank)
+{
+    return rocsolver::rocsolver_gelsy_impl<rocblas_float_complex>(handle, m, n, nrhs, A, lda, B,
+                                                                  ldb, jpvt, rcond, rank);
+}
+
+rocblas_status rocsolver_zgelsy(rocblas_handle handle,
+                                const rocblas_int m,
+                                const rocblas_int n,
+                                const rocblas_int nrhs,
+                                rocblas_double_complex* A,
+                                const rocblas_int lda,
+                                rocblas_double_complex* B,
+                                const rocblas_int ldb,
+                                rocblas_int* jpvt,
+                                const double rcond,
+                                rocblas_int* rank)
+{
+    return rocsolver::rocsolver_gelsy_impl<rocblas_double_complex>(handle, m, n, nrhs, A, lda, B,
+                                                                   ldb, jpvt, rcond, rank);
+}
+
+} // extern C
@@ -0,0 +1,405 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.9.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     November 2019
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "auxiliary/rocauxiliary_ormqr_unmqr.hpp"
+#include "rocblas.hpp"
+#include "roclapack_geqp3.hpp"
+#include "roclapack_geqrf.hpp"
+#include "rocsolver/rocsolver.h"
+#include "rocsolver_run_specialized_kernels.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/** GELSY_RANK kernel determines the effective rank of each matrix in the batch from the
+    diagonal of the triangular factor R of its QR factorization with column pivoting, as the
+    number of leading diagonal elements with absolute value greater than rcond times the
+    largest one. A negative rcond is replaced by the machine precision. **/
+template <typename T, typename S, typename U>
+ROCSOLVER_KERNEL void gelsy_rank(const rocblas_int k,
+                                 U A,
+                                 const rocblas_int shiftA,
+                                 const rocblas_int lda,
+                                 const rocblas_stride strideA,
+                                 const S rcond,
+                                 rocblas_int* rank,
+                                 const rocblas_int batch_count)
+{
+    const auto b = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(b < batch_count)
+    {
+        T* Ap = load_ptr_batch<T>(A, b, shiftA, strideA);
+        const S thresh = (rcond < 0 ? get_epsilon<S>() : rcond) * std::abs(Ap[0]);
+
+        rocblas_int r = 0;
+        while(r < k && std::abs(Ap[r + r * lda]) > thresh)
+            r++;
+
+        rank[b] = r;
+    }
+}
+
+/** GELSY_INIT_W kernel writes in the n-by-k matrix W the conjugate transpose of the
+    k-by-n upper trapezoidal factor R, with rows rank to k-1 set to zero **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void gelsy_init_w(const rocblas_int n,
+                                   const rocblas_int k,
+                                   U A,
+                                   const rocblas_int shiftA,
+                                   const rocblas_int lda,
+                                   const rocblas_stride strideA,
+                                   const rocblas_int* rank,
+                                   T* W,
+                                   const rocblas_stride strideW)
+{
+    const auto b = hipBlockIdx_z;
+    const auto j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+    const auto i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(i < n && j < k)
+    {
+        T* Ap = load_ptr_batch<T>(A, b, shiftA, strideA);
+        T* Wp = W + b * strideW;
+
+        Wp[i + j * n] = (j < rank[b] && i >= j) ? conj(Ap[j + i * lda]) : T(0);
+    }
+}
+
+/** GELSY_INIT_C kernel copies the leading rank rows of B in the n-by-nrhs matrix C
+    and sets the remaining rows to zero **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void gelsy_init_c(const rocblas_int n,
+                                   const rocblas_int nrhs,
+                                   U B,
+                                   const rocblas_int shiftB,
+                                   const rocblas_int ldb,
+                                   const rocblas_stride strideB,
+                                   const rocblas_int* rank,
+                                   T* C,
+                                   const rocblas_stride strideC)
+{
+    const auto b = hipBlockIdx_z;
+    const auto j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+    const auto i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(i < n && j < nrhs)
+    {
+        T* Bp = load_ptr_batch<T>(B, b, shiftB, strideB);
+        T* Cp = C + b * strideC;
+
+        Cp[i + j * n] = (i < rank[b]) ? Bp[i + j * ldb] : T(0);
+    }
+}
+
+/** GELSY_SET_DIAG kernel sets to one the diagonal elements rank to k-1 of the triangular
+    factor of W, so that the corresponding components of the solution are zero **/
+template <typename T>
+ROCSOLVER_KERNEL void gelsy_set_diag(const rocblas_int n,
+                                     const rocblas_int k,
+                                     const rocblas_int* rank,
+                                     T* W,
+                                     const rocblas_stride strideW)
+{
+    const auto b = hipBlockIdx_y;
+    const auto j = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(j < k && j >= rank[b])
+        W[j + j * n + b * strideW] = 1;
+}
+
+/** GELSY_PERMUTE kernel writes the rows of C in B, undoing the column permutation
+    given by jpvt **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void gelsy_permute(const rocblas_int n,
+                                    const rocblas_int nrhs,
+                                    T* C,
+                                    const rocblas_stride strideC,
+                                    const rocblas_int* jpvt,
+                                    const rocblas_stride strideJ,
+                                    U B,
+                                    const rocblas_int shiftB,
+                                    const rocblas_int ldb,
+                                    const rocblas_stride strideB)
+{
+    const auto b = hipBlockIdx_z;
+    const auto j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+    const auto i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(i < n && j < nrhs)
+    {
+        T* Bp = load_ptr_batch<T>(B, b, shiftB, strideB);
+        const rocblas_int p = jpvt[i + b * strideJ] - 1;
+
+        Bp[p + j * ldb] = C[i + j * n + b * strideC];
+    }
+}
+
+template <bool BATCHED, typename T, typename S>
+void rocsolver_gelsy_getMemorySize(const rocblas_int m,
+                                   const rocblas_int n,
+                                   const rocblas_int nrhs,
+                                   const rocblas_int batch_count,
+                                   size_t* size_scalars,
+                                   size_t* size_work1,
+                                   size_t* size_work2,
+                                   size_t* size_work3,
+                                   size_t* size_work4,
+                                   size_t* size_norms,
+                                   size_t* size_tau,
+                                   size_t* size_W_C,
+                                   bool* optim_mem)
+{
+    // if quick return no workspace needed
+    if(m == 0 || n == 0 || nrhs == 0 || batch_count == 0)
+    {
+        *size_scalars = 0;
+        *size_work1 = 0;
+        *size_work2 = 0;
+        *size_work3 = 0;
+        *size_work4 = 0;
+        *size_norms = 0;
+        *size_tau = 0;
+        *size_W_C = 0;
+        *optim_mem = true;
+        return;
+    }
+
+    const rocblas_int k = std::min(m, n);
+    size_t geqp3_work, geqp3_Abyx, geqp3_diag, geqp3_F;
+    size_t geqrf_work, geqrf_Abyx, geqrf_diag, geqrf_workArr;
+    size_t ormqr_work1, ormqr_tmptr1, ormqr_trfact1, ormqr_workArr1;
+    size_t ormqr_work2, ormqr_tmptr2, ormqr_trfact2, ormqr_workArr2;
+    size_t trsm_x_temp, trsm_x_temp_arr, trsm_invA, trsm_invA_arr, unused;
+
+    // requirements for the QR factorization with column pivoting of A, and for applying Q'
+    rocsolver_geqp3_getMemorySize<BATCHED, T, S>(m, n, batch_count, size_scalars, &geqp3_work,
+                                                 &geqp3_Abyx, &geqp3_diag, size_norms, &geqp3_F);
+    rocsolver_ormqr_unmqr_getMemorySize<BATCHED, T>(rocblas_side_left, m, nrhs, k, batch_count,
+                                                    &unused, &ormqr_work1, &ormqr_tmptr1,
+                                                    &ormqr_trfact1, &ormqr_workArr1);
+
+    // requirements for the QR factorization of the n-by-k matrix W, for applying Z,
+    // and for solving with the triangular factor
+    rocsolver_geqrf_getMemorySize<false, T>(n, k, batch_count, &unused, &geqrf_work, &geqrf_Abyx,
+                                            &geqrf_diag, &geqrf_workArr);
+    rocsolver_ormqr_unmqr_getMemorySize<false, T>(rocblas_side_left, n, nrhs, k, batch_count,
+                                                  &unused, &ormqr_work2, &ormqr_tmptr2,
+                                                  &ormqr_trfact2, &ormqr_workArr2);
+    rocsolver_trsm_mem<false, true, T>(rocblas_side_left, rocblas_operation_conjugate_transpose, k,
+                                       nrhs, batch_count, &trsm_x_temp, &trsm_x_temp_arr,
+                                       &trsm_invA, &trsm_invA_arr, optim_mem);
+
+    *size_work1 = std::max({geqp3_work, ormqr_work1, geqrf_work, ormqr_work2, trsm_x_temp});
+    *size_work2 = std::max({geqp3_Abyx, ormqr_tmptr1, geqrf_Abyx, ormqr_tmptr2, trsm_x_temp_arr});
+    *size_work3 = std::max({geqp3_diag, ormqr_trfact1, geqrf_diag, ormqr_trfact2, trsm_invA});
+    *size_work4 = std::max({geqp3_F, ormqr_workArr1, geqrf_workArr, ormqr_workArr2, trsm_invA_arr});
+
+    // size of the Householder scalars of both QR factorizations
+    *size_tau = sizeof(T) * 2 * k * batch_count;
+
+    // size of the matrix W and of the temporary copy C of the right-hand sides
+    *size_W_C = sizeof(T) * n * (k + nrhs);
+    *size_W_C *= batch_count;
+}
+
+template <typename T, typename U>
+rocblas_status rocsolver_gelsy_argCheck(rocblas_handle handle,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        const rocblas_int nrhs,
+                                        U A,
+                                        const rocblas_int lda,
+                                        U B,
+                                        const rocblas_int ldb,
+                                        rocblas_int* jpvt,
+                                        rocblas_int* rank,
+                                        const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    if(m < 0 || n < 0 || nrhs < 0 || lda < m || ldb < m || ldb < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((m && n && !A) || (((m && nrhs) || (n && nrhs)) && !B) || (n && !jpvt)
+       || (batch_count && !rank))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename S, typename U>
+rocblas_status rocsolver_gelsy_template(rocblas_handle handle,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        const rocblas_int nrhs,
+                                        U A,
+                                        const rocblas_int shiftA,
+                                        const rocblas_int lda,
+                                        const rocblas_stride strideA,
+                                        U B,
+                                        const rocblas_int shiftB,
+                                        const rocblas_int ldb,
+                                        const rocblas_stride strideB,
+                                        rocblas_int* jpvt,
+                                        const rocblas_stride strideJ,
+                                        const S rcond,
+                                        rocblas_int* rank,
+                                        const rocblas_int batch_count,
+                                        T* scalars,
+                                        void* work1,
+                                        void* work2,
+                                        void* work3,
+                                        void* work4,
+                                        S* norms,
+                                        T* tau,
+                                        T* W_C,
+                                        bool optim_mem)
+{
+    ROCSOLVER_ENTER("gelsy", "m:", m, "n:", n, "nrhs:", nrhs, "shiftA:", shiftA, "lda:", lda,
+                    "shiftB:", shiftB, "ldb:", ldb, "rcond:", rcond, "bc:", batch_count);
+
+    // quick return if zero instances in batch
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocksReset = (batch_count - 1) / BS1 + 1;
+    dim3 gridReset(blocksReset, 1, 1);
+    dim3 threads(BS1, 1, 1);
+
+    // quick return if A or B are empty (as in LAPACK, the rank is set to zero)
+    if(m == 0 || n == 0 || nrhs == 0)
+    {
+        ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, rank, batch_count, 0);
+
+        rocblas_int rowsB = std::max(m, n);
+        if(nrhs > 0 && rowsB > 0)
+        {
+            rocblas_int blocksx = (rowsB - 1) / 32 + 1;
+            rocblas_int blocksy = (nrhs - 1) / 32 + 1;
+            ROCSOLVER_LAUNCH_KERNEL(set_zero<T>, dim3(blocksx, blocksy, batch_count), dim3(32, 32),
+                                    0, stream, rowsB, nrhs, B, shiftB, ldb, strideB);
+        }
+
+        return rocblas_status_success;
+    }
+
+    // everything must be executed with scalars on the host
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+
+    // constants in host memory
+    const rocblas_int k = std::min(m, n);
+    const rocblas_stride strideT = k;
+    const rocblas_stride strideW = n * k;
+    const rocblas_stride strideC = n * nrhs;
+    T* tauA = tau;
+    T* tauW = tau + k * batch_count;
+    T* W = W_C;
+    T* C = W_C + strideW * batch_count;
+
+    const rocblas_int blocksn = (n - 1) / 32 + 1;
+    const rocblas_int blocksk = (k - 1) / 32 + 1;
+    const rocblas_int blocksy = (nrhs - 1) / 32 + 1;
+
+    // compute the QR factorization with column pivoting A * P = Q * R
+    rocsolver_geqp3_template<T>(handle, m, n, A, shiftA, lda, strideA, jpvt, strideJ, tauA,
+                                strideT, batch_count, scalars, work1, (T*)work2, (T*)work3, norms,
+                                (T*)work4);
+
+    // B = Q' * B (Q is never formed explicitly)
+    rocsolver_ormqr_unmqr_template<BATCHED, STRIDED>(
+        handle, rocblas_side_left, rocblas_operation_conjugate_transpose, m, nrhs, k, A, shiftA,
+        lda, strideA, tauA, strideT, B, shiftB, ldb, strideB, batch_count, scalars, (T*)work1,
+        (T*)work2, (T*)work3, (T**)work4);
+
+    // determine the effective rank
+    ROCSOLVER_LAUNCH_KERNEL((gelsy_rank<T, S, U>), gridReset, threads, 0, stream, k, A, shiftA,
+                            lda, strideA, rcond, rank, batch_count);
+
+    /** The rows rank to k-1 of R are neglected, and the minimum norm solution of the
+        resulting underdetermined triangular system is found through the QR factorization
+        of its conjugate transpose, W = Z * T. (This takes the place of the RZ factorization
+        used by LAPACK, and keeps the batch instances independent of their ranks.) **/
+
+    // W = R', and C = leading rows of B
+    ROCSOLVER_LAUNCH_KERNEL((gelsy_init_w<T, U>), dim3(blocksn, blocksk, batch_count),
+                            dim3(32, 32), 0, stream, n, k, A, shiftA, lda, strideA, rank, W,
+                            strideW);
+    ROCSOLVER_LAUNCH_KERNEL((gelsy_init_c<T, U>), dim3(blocksn, blocksy, batch_count),
+                            dim3(32, 32), 0, stream, n, nrhs, B, shiftB, ldb, strideB, rank, C,
+                            strideC);
+
+    // compute the QR factorization W = Z * T
+    rocsolver_geqrf_template<false, true>(handle, n, k, W, 0, n, strideW, tauW, strideT,
+                                          batch_count, scalars, work1, (T*)work2, (T*)work3,
+                                          (T**)work4);
+
+    ROCSOLVER_LAUNCH_KERNEL(gelsy_set_diag<T>, dim3(blocksk, batch_count, 1), dim3(32, 1, 1), 0,
+                            stream, n, k, rank, W, strideW);
+
+    // solve T' * Y = C, overwriting C with Y
+    rocsolver_trsm_upper<false, true, T>(
+        handle, rocblas_side_left, rocblas_operation_conjugate_transpose, rocblas_diagonal_non_unit,
+        k, nrhs, W, 0, n, strideW, C, 0, n, strideC, batch_count, optim_mem, work1, work2, work3,
+        work4);
+
+    // C = Z * C (Z is never formed explicitly)
+    rocsolver_ormqr_unmqr_template<false, true>(
+        handle, rocblas_side_left, rocblas_operation_none, n, nrhs, k, W, 0, n, strideW, tauW,
+        strideT, C, 0, n, strideC, batch_count, scalars, (T*)work1, (T*)work2, (T*)work3,
+        (T**)work4);
+
+    // B = P * C
+    ROCSOLVER_LAUNCH_KERNEL((gelsy_permute<T, U>), dim3(blocksn, blocksy, batch_count),
+                            dim3(32, 32), 0, stream, n, nrhs, C, strideC, jpvt, strideJ, B, shiftB,
+                            ldb, strideB);
+
+    rocblas_set_pointer_mode(handle, old_mode);
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
@@ -0,0 +1,175 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "roclapack_gepolar.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+template <typename T, typename U>
+rocblas_status rocsolver_gepolar_impl(rocblas_handle handle,
+                                      const rocblas_int m,
+                                      const rocblas_int n,
+                                      U A,
+                                      const rocblas_int lda,
+                                      T* H,
+                                      const rocblas_int ldh,
+                                      rocblas_int* info)
+{
+    ROCSOLVER_ENTER_TOP("gepolar", "-m", m, "-n", n, "--lda", lda, "--ldh", ldh);
+    ROCSOLVER_INFO_SUMMARY(info, 1);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_gepolar_argCheck(handle, m, n, lda, ldh, A, H, info);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+    rocblas_int shiftH = 0;
+
+    // normal (non-batched non-strided) execution
+    rocblas_stride strideA = 0;
+    rocblas_stride strideH = 0;
+    rocblas_int batch_count = 1;
+
+    // memory workspace sizes:
+    // constants in rocblas calls (only whether they are needed, see set_device_scalars)
+    size_t size_scalars;
+    // size of reusable workspaces (and for calling POTRF, TRSM, GEQRF and ORGQR/UNGQR)
+    size_t size_work1, size_work2, size_work3, size_work4;
+    // extra requirements for calling POTRF
+    size_t size_pivots, size_iinfo;
+    // size for the Householder scalars, the stacked matrices, the updates of the iterates,
+    // the copies of the original matrices, and the info of the Cholesky factorizations
+    size_t size_tau, size_W, size_Y, size_A0, size_pinfo;
+    bool optim_mem;
+    rocsolver_gepolar_getMemorySize<T>(m, n, batch_count, &size_scalars, &size_work1, &size_work2,
+                                       &size_work3, &size_work4, &size_pivots, &size_iinfo,
+                                       &size_tau, &size_W, &size_Y, &size_A0, &size_pinfo,
+                                       &optim_mem);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_t(0), size_work1, size_work2,
+                                                      size_work3, size_work4, size_pivots,
+                                                      size_iinfo, size_tau, size_W, size_Y,
+                                                      size_A0, size_pinfo);
+
+    // memory workspace allocation
+    void *scalars, *work1, *work2, *work3, *work4, *pivots, *iinfo, *tau, *W, *Y, *A0, *pinfo;
+    rocblas_device_malloc mem(handle, size_t(0), size_work1, size_work2, size_work3, size_work4,
+                              size_pivots, size_iinfo, size_tau, size_W, size_Y, size_A0,
+                              size_pinfo);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    scalars = mem[0];
+    work1 = mem[1];
+    work2 = mem[2];
+    work3 = mem[3];
+    work4 = mem[4];
+    pivots = mem[5];
+    iinfo = mem[6];
+    tau = mem[7];
+    W = mem[8];
+    Y = mem[9];
+    A0 = mem[10];
+    pinfo = mem[11];
+    if(size_scalars > 0)
+        ROCBLAS_CHECK(set_device_scalars<T>(scalars));
+
+    // execution
+    return _info_summary_scope.commit(rocsolver_gepolar_template<false, false, T>(
+        handle, m, n, A, shiftA, lda, strideA, H, shiftH, ldh, strideH, info, batch_count,
+        (T*)scalars, work1, work2, work3, work4, (T*)pivots, (rocblas_int*)iinfo, (T*)tau, (T*)W,
+        (T*)Y, (T*)A0, (rocblas_int*)pinfo, optim_mem));
+}
+
+ROCSOLVER_END_NAMESPACE
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sgepolar(rocblas_handle handle,
+                                  const rocblas_int m,
+                                  const rocblas_int n,
+                                  float* A,
+                                  const rocblas_int lda,
+                                  float* H,
+                                  const rocblas_int ldh,
+                                  rocblas_int* info)
+{
+    return rocsolver::rocsolver_gepolar_impl<float>(handle, m, n, A, lda, H, ldh, info);
+}
+
+rocblas_status rocsolver_dgepolar(rocblas_handle handle,
+                                  const rocblas_int m,
+                                  const rocblas_int n,
+                                  double* A,
+                                  const rocblas_int lda,
+                                  double* H,
+                                  const rocblas_int ldh,
+                                  rocblas_int* info)
+{
+    return rocsolver::rocsolver_gepolar_impl<double>(handle, m, n, A, lda, H, ldh, info);
+}
+
+rocblas_status rocsolver_cgepolar(rocblas_handle handle,
+                                  const rocblas_int m,
+                                  const rocblas_int n,
+                                  rocblas_float_complex* A,
+                                  const rocblas_int lda,
+                                  rocblas_float_complex* H,
+                                  const rocblas_int ldh,
+                                  rocblas_int* info)
+{
+    return rocsolver::rocsolver_gepolar_impl<rocblas_float_complex>(handle, m, n, A, lda, H, ldh,
+                                                                    info);
+}
+
+rocblas_status rocsolver_zgepolar(rocblas_handle handle,
+                                  const rocblas_int m,
+                                  const rocblas_int n,
+                                  rocblas_double_complex* A,
+                                  const rocblas_int lda,
+                                  rocblas_double_complex* H,
+                                  const rocblas_int ldh,
+                                  rocblas_int* info)
+{
+    return rocsolver::rocsolver_gepolar_impl<rocblas_double_complex>(handle, m, n, A, lda, H, ldh,
+                                                                     info);
+}
+
+} // extern C
@@ -0,0 +1,494 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "auxiliary/rocauxiliary_orgqr_ungqr.hpp"
+#include "rocblas.hpp"
+#include "roclapack_geqrf.hpp"
+#include "roclapack_potrf.hpp"
+#include "rocsolver/rocsolver.h"
+#include "rocsolver_run_specialized_kernels.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/** GEPOLAR_SCALE copies A to A0 and scales A by 1 / ||A||_F, so that all the singular values of
+    the scaled matrix are in (0, 1]. **/
+template <typename T, typename S, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) gepolar_scale(const rocblas_int m,
+                                                           const rocblas_int n,
+                                                           U AA,
+                                                           const rocblas_int shiftA,
+                                                           const rocblas_int lda,
+                                                           const rocblas_stride strideA,
+                                                           T* A0A,
+                                                           const rocblas_stride strideA0)
+{
+    const rocblas_int bid = hipBlockIdx_z;
+    const rocblas_int tid = hipThreadIdx_x;
+
+    T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+    T* A0 = A0A + bid * strideA0;
+
+    __shared__ S sval[BS1];
+
+    // each thread copies the elements it is assigned and adds their squares
+    S val = 0;
+    for(rocblas_int k = tid; k < m * n; k += BS1)
+    {
+        rocblas_int i = k % m;
+        rocblas_int j = k / m;
+        T a = A[i + j * lda];
+        A0[k] = a;
+        val += std::norm(a);
+    }
+    sval[tid] = val;
+    __syncthreads();
+
+    // reduce the partial sums
+    for(rocblas_int i = BS1 / 2; i > 0; i /= 2)
+    {
+        if(tid < i)
+            sval[tid] += sval[tid + i];
+        __syncthreads();
+    }
+
+    // (a zero matrix is not scaled)
+    const S nrm = std::sqrt(sval[0]);
+    if(nrm > 0)
+    {
+        const S scal = S(1) / nrm;
+        for(rocblas_int k = tid; k < m * n; k += BS1)
+            A[(k % m) + (k / m) * lda] *= T(scal);
+    }
+}
+
+/** GEPOLAR_STACK sets W = [sqrt(c) * A; I], where W is (m+n)-by-n. **/
+template <typename T, typename S, typename U>
+ROCSOLVER_KERNEL void gepolar_stack(const rocblas_int m,
+                                    const rocblas_int n,
+                                    const S sqc,
+                                    U AA,
+                                    const rocblas_int shiftA,
+                                    const rocblas_int lda,
+                                    const rocblas_stride strideA,
+                                    T* WW,
+                                    const rocblas_stride strideW)
+{
+    const auto b = hipBlockIdx_z;
+    const auto i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const auto j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+
+    if(i < m + n && j < n)
+    {
+        T* A = load_ptr_batch<T>(AA, b, shiftA, strideA);
+        T* W = WW + b * strideW;
+
+        if(i < m)
+            W[i + j * (m + n)] = T(sqc) * A[i + j * lda];
+        else
+            W[i + j * (m + n)] = (i - m == j) ? T(1) : T(0);
+    }
+}
+
+/** GEPOLAR_UPDATE sets A = beta * A + gamma * Y. At the last iteration, info is set to 1 if the
+    Frobenius norm of the change in A is larger than tol (i.e. the iteration has not converged). **/
+template <typename T, typename S, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) gepolar_update(const rocblas_int m,
+                                                            const rocblas_int n,
+                                                            const S beta,
+                                                            const S gamma,
+                                                            U AA,
+                                                            const rocblas_int shiftA,
+                                                            const rocblas_int lda,
+                                                            const rocblas_stride strideA,
+                                                            T* YY,
+                                                            const rocblas_stride strideY,
+                                                            rocblas_int* info,
+                                                            const S tol,
+                                                            const bool last)
+{
+    const rocblas_int bid = hipBlockIdx_z;
+    const rocblas_int tid = hipThreadIdx_x;
+
+    T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+    T* Y = YY + bid * strideY;
+
+    __shared__ S sval[BS1];
+
+    // each thread updates the elements it is assigned and adds the squares of their changes
+    S val = 0;
+    for(rocblas_int k = tid; k < m * n; k += BS1)
+    {
+        rocblas_int i = k % m;
+        rocblas_int j = k / m;
+        T a = A[i + j * lda];
+        T anew = T(beta) * a + T(gamma) * Y[k];
+        A[i + j * lda] = anew;
+        val += std::norm(anew - a);
+    }
+
+    if(last)
+    {
+        sval[tid] = val;
+        __syncthreads();
+
+        // reduce the partial sums
+        for(rocblas_int i = BS1 / 2; i > 0; i /= 2)
+        {
+            if(tid < i)
+                sval[tid] += sval[tid + i];
+            __syncthreads();
+        }
+
+        if(tid == 0)
+            info[bid] = (std::sqrt(sval[0]) > tol) ? 1 : 0;
+    }
+}
+
+/** GEPOLAR_SYMMETRIZE sets H = (H + H') / 2. **/
+template <typename T>
+ROCSOLVER_KERNEL void gepolar_symmetrize(const rocblas_int n,
+                                         T* HH,
+                                         const rocblas_int shiftH,
+                                         const rocblas_int ldh,
+                                         const rocblas_stride strideH)
+{
+    const auto b = hipBlockIdx_z;
+    const auto i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const auto j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+
+    if(i < n && j <= i)
+    {
+        T* H = HH + shiftH + b * strideH;
+
+        T h = T(0.5) * (H[i + j * ldh] + conj(H[j + i * ldh]));
+        if(i == j)
+            H[i + i * ldh] = std::real(h);
+        else
+        {
+            H[i + j * ldh] = h;
+            H[j + i * ldh] = conj(h);
+        }
+    }
+}
+
+/** GEPOLAR_PARAMS computes the weights a, b and c of the dynamically weighted Halley
+    iteration, and updates the lower bound l of the smallest singular value of the iterate. **/
+inline void gepolar_params(double& l, double& a, double& b, double& c)
+{
+    double l2 = l * l;
+    double d = std::cbrt(4 * (1 - l2) / (l2 * l2));
+    double sd = std::sqrt(1 + d);
+    a = sd + 0.5 * std::sqrt(8 - 4 * d + 8 * (2 - l2) / (l2 * sd));
+    b = (a - 1) * (a - 1) / 4;
+    c = a + b - 1;
+    l = std::min(1.0, l * (a + b * l2) / (1 + c * l2));
+}
+
+template <typename T, typename U>
+rocblas_status rocsolver_gepolar_argCheck(rocblas_handle handle,
+                                          const rocblas_int m,
+                                          const rocblas_int n,
+                                          const rocblas_int lda,
+                                          const rocblas_int ldh,
+                                          T A,
+                                          U H,
+                                          rocblas_int* info,
+                                          const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    if(m < 0 || n < 0 || n > m || lda < m || ldh < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !A) || (n && !H) || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T>
+void rocsolver_gepolar_getMemorySize(const rocblas_int m,
+                                     const rocblas_int n,
+                                     const rocblas_int batch_count,
+                                     size_t* size_scalars,
+                                     size_t* size_work1,
+                                     size_t* size_work2,
+                                     size_t* size_work3,
+                                     size_t* size_work4,
+                                     size_t* size_pivots,
+                                     size_t* size_iinfo,
+                                     size_t* size_tau,
+                                     size_t* size_W,
+                                     size_t* size_Y,
+                                     size_t* size_A0,
+                                     size_t* size_pinfo,
+                                     bool* optim_mem)
+{
+    // if quick return, no workspace is needed
+    if(n == 0 || batch_count == 0)
+    {
+        *size_scalars = 0;
+        *size_work1 = 0;
+        *size_work2 = 0;
+        *size_work3 = 0;
+        *size_work4 = 0;
+        *size_pivots = 0;
+        *size_iinfo = 0;
+        *size_tau = 0;
+        *size_W = 0;
+        *size_Y = 0;
+        *size_A0 = 0;
+        *size_pinfo = 0;
+        *optim_mem = true;
+        return;
+    }
+
+    bool opt1, opt2, opt3;
+    size_t s1, w1, w2, w3, w4;
+
+    // requirements for calling POTRF on the n-by-n matrices I + c * X' * X
+    // (all the internal matrices are strided)
+    rocsolver_potrf_getMemorySize<false, true, T>(n, rocblas_fill_upper, batch_count, size_scalars,
+                                                  size_work1, size_work2, size_work3, size_work4,
+                                                  size_pivots, size_iinfo, &opt1);
+
+    // requirements for calling TRSM to compute X * inv(R) * inv(R')
+    rocsolver_trsm_mem<false, true, T>(rocblas_side_right, rocblas_operation_none, m, n,
+                                       batch_count, &w1, &w2, &w3, &w4, &opt2);
+    *size_work1 = std::max(*size_work1, w1);
+    *size_work2 = std::max(*size_work2, w2);
+    *size_work3 = std::max(*size_work3, w3);
+    *size_work4 = std::max(*size_work4, w4);
+    rocsolver_trsm_mem<false, true, T>(rocblas_side_right, rocblas_operation_conjugate_transpose,
+                                       m, n, batch_count, &w1, &w2, &w3, &w4, &opt3);
+    *size_work1 = std::max(*size_work1, w1);
+    *size_work2 = std::max(*size_work2, w2);
+    *size_work3 = std::max(*size_work3, w3);
+    *size_work4 = std::max(*size_work4, w4);
+    *optim_mem = opt1 && opt2 && opt3;
+
+    // requirements for calling GEQRF and ORGQR/UNGQR on the (m+n)-by-n matrices [sqrt(c) * X; I]
+    rocsolver_geqrf_getMemorySize<false, T>(m + n, n, batch_count, &s1, &w1, &w2, &w3, &w4);
+    *size_scalars = std::max(*size_scalars, s1);
+    *size_work1 = std::max(*size_work1, w1);
+    *size_work2 = std::max(*size_work2, w2);
+    *size_work3 = std::max(*size_work3, w3);
+    *size_work4 = std::max(*size_work4, w4);
+    rocsolver_orgqr_ungqr_getMemorySize<false, T>(m + n, n, n, batch_count, &s1, &w1, &w2, &w3,
+                                                  &w4);
+    *size_scalars = std::max(*size_scalars, s1);
+    *size_work1 = std::max(*size_work1, w1);
+    *size_work2 = std::max(*size_work2, w2);
+    *size_work3 = std::max(*size_work3, w3);
+    *size_work4 = std::max(*size_work4, w4);
+
+    // the Householder scalars, the stacked matrices, the updates of the iterates, the original
+    // matrices, and the info of the Cholesky factorizations
+    *size_tau = sizeof(T) * n * batch_count;
+    *size_W = sizeof(T) * (m + n) * n * batch_count;
+    *size_Y = sizeof(T) * m * n * batch_count;
+    *size_A0 = sizeof(T) * m * n * batch_count;
+    *size_pinfo = sizeof(rocblas_int) * batch_count;
+}
+
+/** GEPOLAR computes the polar decomposition A = U * H with the QR-based dynamically weighted
+    Halley (QDWH) iteration. The iterate X, initially A / ||A||_F, is updated as
+
+        X = (b/c) * X + (a - b/c) / sqrt(c) * Q1 * Q2',   with [sqrt(c) * X; I] = [Q1; Q2] * R,
+
+    while the weight c is large, and as
+
+        X = (b/c) * X + (a - b/c) * X * inv(Z),   with Z = I + c * X' * X = R' * R,
+
+    once c is small enough for Z to be well conditioned. The weights only depend on a lower
+    bound of the smallest singular value of the initial X, which is taken as the machine
+    precision. This way, the number of iterations is the same for all the problems in the batch
+    (7 in double precision, the last one to check the convergence), and all the work is done by
+    GEQRF, ORGQR/UNGQR, POTRF, TRSM and GEMM. Finally, H = U' * A is computed and symmetrized. **/
+template <bool BATCHED, bool STRIDED, typename T, typename U>
+rocblas_status rocsolver_gepolar_template(rocblas_handle handle,
+                                          const rocblas_int m,
+                                          const rocblas_int n,
+                                          U A,
+                                          const rocblas_int shiftA,
+                                          const rocblas_int lda,
+                                          const rocblas_stride strideA,
+                                          T* H,
+                                          const rocblas_int shiftH,
+                                          const rocblas_int ldh,
+                                          const rocblas_stride strideH,
+                                          rocblas_int* info,
+                                          const rocblas_int batch_count,
+                                          T* scalars,
+                                          void* work1,
+                                          void* work2,
+                                          void* work3,
+                                          void* work4,
+                                          T* pivots,
+                                          rocblas_int* iinfo,
+                                          T* tau,
+                                          T* W,
+                                          T* Y,
+                                          T* A0,
+                                          rocblas_int* pinfo,
+                                          bool optim_mem)
+{
+    ROCSOLVER_ENTER("gepolar", "m:", m, "n:", n, "shiftA:", shiftA, "lda:", lda, "shiftH:", shiftH,
+                    "ldh:", ldh, "bc:", batch_count);
+
+    using S = decltype(std::real(T{}));
+
+    // quick return if zero instances in batch
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocksReset = (batch_count - 1) / BS1 + 1;
+    dim3 gridReset(blocksReset, 1, 1);
+    dim3 threads(BS1, 1, 1);
+
+    // info=0 (starting with a converged iteration)
+    ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, info, batch_count, 0);
+
+    // quick return if no dimensions
+    if(n == 0)
+        return rocblas_status_success;
+
+    // everything must be executed with scalars on the host
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+    T one = 1;
+    T zero = 0;
+
+    const rocblas_int ldw = m + n;
+    const rocblas_stride strideW = rocblas_stride(ldw) * n;
+    const rocblas_stride strideY = rocblas_stride(m) * n;
+    const rocblas_int blocksm = (m + n - 1) / 32 + 1;
+    const rocblas_int blocksn = (n - 1) / 32 + 1;
+    const double eps = get_epsilon<S>();
+    const S tol = S(std::cbrt(5 * eps));
+
+    // X = A / ||A||_F (keeping a copy of A)
+    ROCSOLVER_LAUNCH_KERNEL((gepolar_scale<T, S>), dim3(1, 1, batch_count), threads, 0, stream, m,
+                            n, A, shiftA, lda, strideA, A0, strideY);
+
+    double l = eps;
+    double a, b, c;
+    bool last = false;
+    for(rocblas_int iter = 0; iter < 20 && !last; ++iter)
+    {
+        // once the bound has converged, a last iteration checks the convergence of the iterates
+        last = (1 - l <= 5 * eps);
+        gepolar_params(l, a, b, c);
+
+        if(c > 100)
+        {
+            // QR-based iteration: [sqrt(c) * X; I] = [Q1; Q2] * R, Y = Q1 * Q2'
+            ROCSOLVER_LAUNCH_KERNEL((gepolar_stack<T, S>), dim3(blocksm, blocksn, batch_count),
+                                    dim3(32, 32), 0, stream, m, n, S(std::sqrt(c)), A, shiftA, lda,
+                                    strideA, W, strideW);
+
+            rocsolver_geqrf_template<false, true, T>(handle, ldw, n, W, 0, ldw, strideW, tau, n,
+                                                     batch_count, scalars, work1, (T*)work2,
+                                                     (T*)work3, (T**)work4);
+            rocsolver_orgqr_ungqr_template<false, true, T>(handle, ldw, n, n, W, 0, ldw, strideW,
+                                                           tau, n, batch_count, scalars, (T*)work1,
+                                                           (T*)work2, (T*)work3, (T**)work4);
+
+            rocsolver_gemm<false, true, T>(handle, rocblas_operation_none,
+                                           rocblas_operation_conjugate_transpose, m, n, n, &one, W,
+                                           0, ldw, strideW, W, m, ldw, strideW, &zero, Y, 0, m,
+                                           strideY, batch_count, (T**)nullptr);
+
+            ROCSOLVER_LAUNCH_KERNEL((gepolar_update<T, S>), dim3(1, 1, batch_count), threads, 0,
+                                    stream, m, n, S(b / c), S((a - b / c) / std::sqrt(c)), A,
+                                    shiftA, lda, strideA, Y, strideY, info, tol, last);
+        }
+        else
+        {
+            // Cholesky-based iteration: Z = I + c * X' * X = R' * R, Y = X * inv(R) * inv(R')
+            // (Z is stored in H)
+            S s_c = c;
+            S s_one = 1;
+            ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, dim3(blocksm, blocksn, batch_count), dim3(32, 32),
+                                    0, stream, m, n, A, shiftA, lda, strideA, Y, 0, m, strideY);
+            ROCSOLVER_LAUNCH_KERNEL(init_ident<T>, dim3(blocksn, blocksn, batch_count),
+                                    dim3(32, 32), 0, stream, n, n, H, shiftH, ldh, strideH);
+            rocblasCall_syrk_herk<false, T>(handle, rocblas_fill_upper,
+                                            rocblas_operation_conjugate_transpose, n, m, &s_c, Y, 0,
+                                            m, strideY, &s_one, H, shiftH, ldh, strideH,
+                                            batch_count);
+
+            rocsolver_potrf_template<false, true, T, S>(handle, rocblas_fill_upper, n, H, shiftH,
+                                                        ldh, strideH, pinfo, batch_count, scalars,
+                                                        work1, work2, work3, work4, pivots, iinfo,
+                                                        optim_mem);
+
+            rocsolver_trsm_upper<false, true, T>(
+                handle, rocblas_side_right, rocblas_operation_none, rocblas_diagonal_non_unit, m, n,
+                H, shiftH, 1, ldh, strideH, Y, 0, 1, m, strideY, batch_count, optim_mem, work1,
+                work2, work3, work4);
+            rocsolver_trsm_upper<false, true, T>(
+                handle, rocblas_side_right, rocblas_operation_conjugate_transpose,
+                rocblas_diagonal_non_unit, m, n, H, shiftH, 1, ldh, strideH, Y, 0, 1, m, strideY,
+                batch_count, optim_mem, work1, work2, work3, work4);
+
+            ROCSOLVER_LAUNCH_KERNEL((gepolar_update<T, S>), dim3(1, 1, batch_count), threads, 0,
+                                    stream, m, n, S(b / c), S(a - b / c), A, shiftA, lda, strideA,
+                                    Y, strideY, info, tol, last);
+        }
+    }
+
+    // H = U' * A (symmetrized)
+    ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, dim3(blocksm, blocksn, batch_count), dim3(32, 32), 0,
+                            stream, m, n, A, shiftA, lda, strideA, Y, 0, m, strideY);
+    rocsolver_gemm<false, true, T>(handle, rocblas_operation_conjugate_transpose,
+                                   rocblas_operation_none, n, n, m, &one, Y, 0, m, strideY, A0, 0,
+                                   m, strideY, &zero, H, shiftH, ldh, strideH, batch_count,
+                                   (T**)nullptr);
+    ROCSOLVER_LAUNCH_KERNEL(gepolar_symmetrize<T>, dim3(blocksn, blocksn, batch_count),
+                            dim3(32, 32), 0, stream, n, H, shiftH, ldh, strideH);
+
+    rocblas_set_pointer_mode(handle, old_mode);
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
@@ -0,0 +1,161 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "roclapack_geqp3.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+template <typename T, typename U>
+rocblas_status rocsolver_geqp3_impl(rocblas_handle handle,
+                                    const rocblas_int m,
+                                    const rocblas_int n,
+                                    U A,
+                                    const rocblas_int lda,
+                                    rocblas_int* jpvt,
+                                    T* ipiv)
+{
+    ROCSOLVER_ENTER_TOP("geqp3", "-m", m, "-n", n, "--lda", lda);
+
+    using S = decltype(std::real(T{}));
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_geqp3_argCheck(handle, m, n, lda, A, jpvt, ipiv);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+
+    // normal (non-batched non-strided) execution
+    rocblas_stride strideA = 0;
+    rocblas_stride strideJ = 0;
+    rocblas_stride strideP = 0;
+    rocblas_int batch_count = 1;
+
+    // memory workspace sizes:
+    // constants in rocblas calls (only whether they are needed, see set_device_scalars)
+    size_t size_scalars;
+    // size of arrays of pointers (for batched cases) and re-usable workspace
+    size_t size_work_workArr;
+    // extra requirements for calling LARFG
+    size_t size_Abyx_norms;
+    // size of temporary array to store diagonal elements
+    size_t size_diag;
+    // size of the arrays of partial column norms
+    size_t size_norms;
+    // size of the matrix of delayed updates
+    size_t size_F;
+    rocsolver_geqp3_getMemorySize<false, T, S>(m, n, batch_count, &size_scalars, &size_work_workArr,
+                                               &size_Abyx_norms, &size_diag, &size_norms, &size_F);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_t(0), size_work_workArr,
+                                                      size_Abyx_norms, size_diag, size_norms,
+                                                      size_F);
+
+    // memory workspace allocation
+    void *scalars, *work_workArr, *Abyx_norms, *diag, *norms, *F;
+    rocblas_device_malloc mem(handle, size_t(0), size_work_workArr, size_Abyx_norms, size_diag,
+                              size_norms, size_F);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    scalars = mem[0];
+    work_workArr = mem[1];
+    Abyx_norms = mem[2];
+    diag = mem[3];
+    norms = mem[4];
+    F = mem[5];
+    if(size_scalars > 0)
+        ROCBLAS_CHECK(set_device_scalars<T>(scalars));
+
+    // execution
+    return rocsolver_geqp3_template<T>(handle, m, n, A, shiftA, lda, strideA, jpvt, strideJ, ipiv,
+                                       strideP, batch_count, (T*)scalars, work_workArr,
+                                       (T*)Abyx_norms, (T*)diag, (S*)norms, (T*)F);
+}
+
+ROCSOLVER_END_NAMESPACE
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sgeqp3(rocblas_handle handle,
+                                const rocblas_int m,
+                                const rocblas_int n,
+                                float* A,
+                                const rocblas_int lda,
+                                rocblas_int* jpvt,
+                                float* ipiv)
+{
+    return rocsolver::rocsolver_geqp3_impl<float>(handle, m, n, A, lda, jpvt, ipiv);
+}
+
+rocblas_status rocsolver_dgeqp3(rocblas_handle handle,
+                                const rocblas_int m,
+                                const rocblas_int n,
+                                double* A,
+                                const rocblas_int lda,
+                                rocblas_int* jpvt,
+                                double* ipiv)
+{
+    return rocsolver::rocsolver_geqp3_impl<double>(handle, m, n, A, lda, jpvt, ipiv);
+}
+
+rocblas_status rocsolver_cgeqp3(rocblas_handle handle,
+                                const rocblas_int m,
+                                const rocblas_int n,
+                                rocblas_float_complex* A,
+                                const rocblas_int lda,
+                                rocblas_int* jpvt,
+                                rocblas_float_complex* ipiv)
+{
+    return rocsolver::rocsolver_geqp3_impl<rocblas_float_complex>(handle, m, n, A, lda, jpvt, ipiv);
+}
+
+rocblas_status rocsolver_zgeqp3(rocblas_handle handle,
+                                const rocblas_int m,
+                                const rocblas_int n,
+                                rocblas_double_complex* A,
+                                const rocblas_int lda,
+                                rocblas_int* jpvt,
+                                rocblas_double_complex* ipiv)
+{
+    return rocsolver::rocsolver_geqp3_impl<rocblas_double_complex>(handle, m, n, A, lda, jpvt,
+                                                                   ipiv);
+}
+
+} // extern C
@@ -0,0 +1,520 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.9.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     November 2019
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "auxiliary/rocauxiliary_lacgv.hpp"
+#include "auxiliary/rocauxiliary_larfg.hpp"
+#include "lapack_device_functions.hpp"
+#include "rocblas.hpp"
+#include "rocsolver/rocsolver.h"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/** GEQP3_INIT_NORMS computes the norms of the columns of A, stores them in vn1 and vn2, and
+    initializes the permutation jpvt. Call this kernel with batch_count groups in x, n groups in y,
+    and BS1 threads in x. **/
+template <typename T, typename S, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) geqp3_init_norms(const rocblas_int m,
+                                                              U AA,
+                                                              const rocblas_int shiftA,
+                                                              const rocblas_int lda,
+                                                              const rocblas_stride strideA,
+                                                              rocblas_int* jpvtA,
+                                                              const rocblas_stride strideJ,
+                                                              S* vn1A,
+                                                              S* vn2A,
+                                                              const rocblas_stride strideV)
+{
+    const rocblas_int b = hipBlockIdx_x;
+    const rocblas_int j = hipBlockIdx_y;
+    const rocblas_int tid = hipThreadIdx_x;
+
+    T* A = load_ptr_batch<T>(AA, b, shiftA, strideA);
+    const int64_t la = lda;
+
+    // shared mem for the reduction
+    __shared__ S sval[BS1];
+
+    S xnorm2 = 0;
+    for(rocblas_int i = tid; i < m; i += BS1)
+        xnorm2 += std::norm(A[i + j * la]);
+    sval[tid] = xnorm2;
+    __syncthreads();
+
+    for(rocblas_int r = BS1 / 2; r > 0; r /= 2)
+    {
+        if(tid < r)
+            sval[tid] += sval[tid + r];
+        __syncthreads();
+    }
+
+    if(tid == 0)
+    {
+        const S xnorm = std::sqrt(sval[0]);
+        vn1A[j + b * strideV] = xnorm;
+        vn2A[j + b * strideV] = xnorm;
+        jpvtA[j + b * strideJ] = j + 1;
+    }
+}
+
+/** GEQP3_PIVOT selects the column, among columns k to n-1 of the current block, with the largest
+    partial norm, and exchanges it with column k (including the corresponding rows of the matrix
+    F of the delayed updates). Call this kernel with batch_count groups in x, and BS1 threads in x.
+    **/
+template <typename T, typename S, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) geqp3_pivot(const rocblas_int m,
+                                                         const rocblas_int n,
+                                                         const rocblas_int k,
+                                                         U AA,
+                                                         const rocblas_int shiftA,
+                                                         const rocblas_int lda,
+                                                         const rocblas_stride strideA,
+                                                         T* FA,
+                                                         const rocblas_int ldf,
+                                                         const rocblas_stride strideF,
+                                                         rocblas_int* jpvtA,
+                                                         const rocblas_stride strideJ,
+                                                         S* vn1A,
+                                                         S* vn2A,
+                                                         const rocblas_stride strideV)
+{
+    const rocblas_int b = hipBlockIdx_x;
+    const rocblas_int tid = hipThreadIdx_x;
+
+    T* A = load_ptr_batch<T>(AA, b, shiftA, strideA);
+    T* F = FA + b * strideF;
+    rocblas_int* jpvt = jpvtA + b * strideJ;
+    S* vn1 = vn1A + b * strideV;
+    S* vn2 = vn2A + b * strideV;
+    const int64_t la = lda;
+    const int64_t lf = ldf;
+
+    // shared mem for the reduction
+    __shared__ S sval[BS1];
+    __shared__ rocblas_int sidx[BS1];
+
+    iamax<BS1>(tid, n - k, vn1 + k, 1, sval, sidx);
+    __syncthreads();
+    const rocblas_int p = k + sidx[0] - 1;
+
+    if(p != k)
+    {
+        for(rocblas_int i = tid; i < m; i += BS1)
+            swap(A[i + p * la], A[i + k * la]);
+        for(rocblas_int i = tid; i < k; i += BS1)
+            swap(F[p + i * lf], F[k + i * lf]);
+
+        if(tid == 0)
+        {
+            swap(jpvt[p], jpvt[k]);
+            vn1[p] = vn1[k];
+            vn2[p] = vn2[k];
+        }
+    }
+}
+
+/** GEQP3_UPDATE_NORMS downdates the partial norms of columns k+1 to n-1 of the current block
+    after the row rk = offset + k has been updated. When the downdating formula is not reliable
+    due to cancellation, the norm is recomputed from the current values of the column, applying
+    on the fly the updates that are still pending in F. (Unlike LAQPS, this does not require
+    ending the block early).
+    Call this kernel with batch_count groups in x, n-k-1 groups in y, and BS1 threads in x. **/
+template <typename T, typename S, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) geqp3_update_norms(const rocblas_int m,
+                                                                const rocblas_int offset,
+                                                                const rocblas_int k,
+                                                                U AA,
+                                                                const rocblas_int shiftA,
+                                                                const rocblas_int lda,
+                                                                const rocblas_stride strideA,
+                                                                T* FA,
+                                                                const rocblas_int ldf,
+                                                                const rocblas_stride strideF,
+                                                                S* vn1A,
+                                                                S* vn2A,
+                                                                const rocblas_stride strideV,
+                                                                const S tol3z)
+{
+    const rocblas_int b = hipBlockIdx_x;
+    const rocblas_int j = k + 1 + hipBlockIdx_y;
+    const rocblas_int tid = hipThreadIdx_x;
+    const rocblas_int rk = offset + k;
+
+    T* A = load_ptr_batch<T>(AA, b, shiftA, strideA);
+    T* F = FA + b * strideF;
+    S* vn1 = vn1A + b * strideV;
+    S* vn2 = vn2A + b * strideV;
+    const int64_t la = lda;
+    const int64_t lf = ldf;
+
+    // shared mem for the reduction
+    __shared__ S sval[BS1];
+
+    const S v1 = vn1[j];
+    const S v2 = vn2[j];
+    if(v1 == 0)
+        return;
+
+    S temp = std::sqrt(std::norm(A[rk + j * la])) / v1;
+    temp = std::max(S(0), (1 + temp) * (1 - temp));
+    const S temp2 = temp * (v1 / v2) * (v1 / v2);
+    __syncthreads();
+
+    if(temp2 > tol3z)
+    {
+        if(tid == 0)
+            vn1[j] = v1 * std::sqrt(temp);
+        return;
+    }
+
+    // recompute the norm of A(rk+1:m-1,j) - A(rk+1:m-1,0:k) * F(j,0:k)'
+    S xnorm2 = 0;
+    for(rocblas_int i = rk + 1 + tid; i < m; i += BS1)
+    {
+        T aij = A[i + j * la];
+        for(rocblas_int l = 0; l <= k; ++l)
+            aij -= A[i + l * la] * conj(F[j + l * lf]);
+        xnorm2 += std::norm(aij);
+    }
+    sval[tid] = xnorm2;
+    __syncthreads();
+
+    for(rocblas_int r = BS1 / 2; r > 0; r /= 2)
+    {
+        if(tid < r)
+            sval[tid] += sval[tid + r];
+        __syncthreads();
+    }
+
+    if(tid == 0)
+    {
+        const S xnorm = std::sqrt(sval[0]);
+        vn1[j] = xnorm;
+        vn2[j] = xnorm;
+    }
+}
+
+template <bool BATCHED, typename T, typename S>
+void rocsolver_geqp3_getMemorySize(const rocblas_int m,
+                                   const rocblas_int n,
+                                   const rocblas_int batch_count,
+                                   size_t* size_scalars,
+                                   size_t* size_work_workArr,
+                                   size_t* size_Abyx_norms,
+                                   size_t* size_diag,
+                                   size_t* size_norms,
+                                   size_t* size_F)
+{
+    // if quick return no workspace needed
+    if(n == 0 || batch_count == 0)
+    {
+        *size_scalars = 0;
+        *size_work_workArr = 0;
+        *size_Abyx_norms = 0;
+        *size_diag = 0;
+        *size_norms = 0;
+        *size_F = 0;
+        return;
+    }
+
+    // size of the arrays with the partial column norms (vn1 and vn2)
+    *size_norms = sizeof(S) * 2 * n * batch_count;
+
+    if(m == 0)
+    {
+        *size_scalars = 0;
+        *size_work_workArr = 0;
+        *size_Abyx_norms = 0;
+        *size_diag = 0;
+        *size_F = 0;
+        return;
+    }
+
+    // size of scalars (constants) for rocblas calls
+    *size_scalars = sizeof(T) * 3;
+
+    // size of array of pointers (batched cases)
+    size_t s1 = BATCHED ? sizeof(T*) * batch_count : 0;
+
+    // extra requirements for calling larfg
+    size_t s2;
+    rocsolver_larfg_getMemorySize<T>(m, batch_count, &s2, size_Abyx_norms);
+
+    // size_work_workArr is maximum of re-usable work space and array of pointers to workspace
+    *size_work_workArr = std::max(s1, s2);
+
+    // size of array to store temporary diagonal values
+    *size_diag = sizeof(T) * batch_count;
+
+    // size of the matrix F of the delayed updates and the auxiliary vector auxv
+    rocblas_int nb = std::min(std::min(m, n), GEQP3_BLOCKSIZE);
+    *size_F = sizeof(T) * (size_t(n) + 1) * nb * batch_count;
+}
+
+template <typename T, typename U>
+rocblas_status rocsolver_geqp3_argCheck(rocblas_handle handle,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        const rocblas_int lda,
+                                        T A,
+                                        rocblas_int* jpvt,
+                                        U ipiv,
+                                        const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    if(m < 0 || n < 0 || lda < m || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((m && n && !A) || (n && !jpvt) || (m && n && !ipiv))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+/** LAQPS factorizes the nb leading columns of the matrix A(offset:m-1,0:n-1) with column pivoting,
+    and applies the resulting block reflector to the trailing matrix with a single GEMM. The
+    updates of the columns in the block are delayed using the matrix F, as in LAPACK. **/
+template <typename T, typename S, typename U, bool COMPLEX = rocblas_is_complex<T>>
+rocblas_status rocsolver_laqps_template(rocblas_handle handle,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        const rocblas_int offset,
+                                        const rocblas_int nb,
+                                        U A,
+                                        const rocblas_int shiftA,
+                                        const rocblas_int lda,
+                                        const rocblas_stride strideA,
+                                        rocblas_int* jpvt,
+                                        const rocblas_stride strideJ,
+                                        T* ipiv,
+                                        const rocblas_stride strideP,
+                                        S* vn1,
+                                        S* vn2,
+                                        const rocblas_stride strideV,
+                                        T* F,
+                                        const rocblas_int ldf,
+                                        const rocblas_stride strideF,
+                                        T* auxv,
+                                        const rocblas_stride strideX,
+                                        const rocblas_int batch_count,
+                                        T* scalars,
+                                        void* work_workArr,
+                                        T* Abyx_norms,
+                                        T* diag)
+{
+    ROCSOLVER_ENTER("laqps", "m:", m, "n:", n, "offset:", offset, "nb:", nb, "shiftA:", shiftA,
+                    "lda:", lda, "bc:", batch_count);
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    const S tol3z = std::sqrt(S(get_epsilon<S>()));
+
+    // the rows of F (and the columns of its upper triangular part, which are not computed
+    // explicitly) must start from zero
+    HIP_CHECK(hipMemsetAsync(F, 0, sizeof(T) * strideF * batch_count, stream));
+
+    for(rocblas_int k = 0; k < nb; ++k)
+    {
+        rocblas_int rk = offset + k;
+
+        // determine the pivot column and swap it into position k
+        ROCSOLVER_LAUNCH_KERNEL((geqp3_pivot<T>), dim3(batch_count, 1, 1), dim3(BS1, 1, 1), 0,
+                                stream, m, n, k, A, shiftA, lda, strideA, F, ldf, strideF, jpvt,
+                                strideJ, vn1, vn2, strideV);
+
+        // apply the previous reflectors of the block to column k:
+        // A(rk:m-1,k) = A(rk:m-1,k) - A(rk:m-1,0:k-1) * F(k,0:k-1)'
+        if(k > 0)
+        {
+            if(COMPLEX)
+                rocsolver_lacgv_template<T>(handle, k, F, idx2D(k, 0, ldf), ldf, strideF,
+                                            batch_count);
+
+            rocblasCall_gemv<T>(handle, rocblas_operation_none, m - rk, k,
+                                cast2constType<T>(scalars), 0, A, shiftA + idx2D(rk, 0, lda), lda,
+                                strideA, F, idx2D(k, 0, ldf), ldf, strideF,
+                                cast2constType<T>(scalars + 2), 0, A, shiftA + idx2D(rk, k, lda), 1,
+                                strideA, batch_count, (T**)work_workArr);
+
+            if(COMPLEX)
+                rocsolver_lacgv_template<T>(handle, k, F, idx2D(k, 0, ldf), ldf, strideF,
+                                            batch_count);
+        }
+
+        // generate Householder reflector to work on column k
+        rocsolver_larfg_template(handle, m - rk, A, shiftA + idx2D(rk, k, lda), A,
+                                 shiftA + idx2D(std::min(rk + 1, m - 1), k, lda), 1, strideA,
+                                 (ipiv + k), strideP, batch_count, (T*)work_workArr, Abyx_norms);
+
+        // insert one in A(rk,k) to build the reflector
+        ROCSOLVER_LAUNCH_KERNEL(set_diag<T>, dim3(batch_count, 1, 1), dim3(1, 1, 1), 0, stream,
+                                diag, 0, 1, A, shiftA + idx2D(rk, k, lda), lda, strideA, 1, true);
+
+        // compute column k of F:
+        // F(k+1:n-1,k) = tau(k) * A(rk:m-1,k+1:n-1)' * A(rk:m-1,k)
+        if(k < n - 1)
+            rocblasCall_gemv<T>(handle, rocblas_operation_conjugate_transpose, m - rk, n - k - 1,
+                                (ipiv + k), strideP, A, shiftA + idx2D(rk, k + 1, lda), lda,
+                                strideA, A, shiftA + idx2D(rk, k, lda), 1, strideA,
+                                cast2constType<T>(scalars + 1), 0, F, idx2D(k + 1, k, ldf), 1,
+                                strideF, batch_count, (T**)work_workArr);
+
+        // incremental update of F:
+        // F(0:n-1,k) = F(0:n-1,k) - tau(k) * F(0:n-1,0:k-1) * A(rk:m-1,0:k-1)' * A(rk:m-1,k)
+        if(k > 0)
+        {
+            rocblasCall_gemv<T>(handle, rocblas_operation_conjugate_transpose, m - rk, k,
+                                (ipiv + k), strideP, A, shiftA + idx2D(rk, 0, lda), lda, strideA, A,
+                                shiftA + idx2D(rk, k, lda), 1, strideA,
+                                cast2constType<T>(scalars + 1), 0, auxv, 0, 1, strideX,
+                                batch_count, (T**)work_workArr);
+
+            rocblasCall_gemv<T>(handle, rocblas_operation_none, n, k, cast2constType<T>(scalars), 0,
+                                F, 0, ldf, strideF, auxv, 0, 1, strideX,
+                                cast2constType<T>(scalars + 2), 0, F, idx2D(0, k, ldf), 1, strideF,
+                                batch_count, (T**)work_workArr);
+        }
+
+        // update the current row of A:
+        // A(rk,k+1:n-1) = A(rk,k+1:n-1) - A(rk,0:k) * F(k+1:n-1,0:k)'
+        if(k < n - 1)
+        {
+            rocblasCall_gemm(handle, rocblas_operation_none, rocblas_operation_conjugate_transpose,
+                             1, n - k - 1, k + 1, cast2constType<T>(scalars), A,
+                             shiftA + idx2D(rk, 0, lda), lda, strideA, F, idx2D(k + 1, 0, ldf), ldf,
+                             strideF, cast2constType<T>(scalars + 2), A,
+                             shiftA + idx2D(rk, k + 1, lda), lda, strideA, batch_count,
+                             (T**)work_workArr);
+
+            // update the partial column norms
+            ROCSOLVER_LAUNCH_KERNEL((geqp3_update_norms<T>), dim3(batch_count, n - k - 1, 1),
+                                    dim3(BS1, 1, 1), 0, stream, m, offset, k, A, shiftA, lda,
+                                    strideA, F, ldf, strideF, vn1, vn2, strideV, tol3z);
+        }
+
+        // restore original value of A(rk,k)
+        ROCSOLVER_LAUNCH_KERNEL(restore_diag<T>, dim3(batch_count, 1, 1), dim3(1, 1, 1), 0, stream,
+                                diag, 0, 1, A, shiftA + idx2D(rk, k, lda), lda, strideA, 1);
+    }
+
+    // apply the block reflector to the trailing matrix:
+    // A(rk+1:m-1,nb:n-1) = A(rk+1:m-1,nb:n-1) - A(rk+1:m-1,0:nb-1) * F(nb:n-1,0:nb-1)'
+    rocblas_int rk = offset + nb;
+    if(rk < m && nb < n)
+        rocblasCall_gemm(handle, rocblas_operation_none, rocblas_operation_conjugate_transpose,
+                         m - rk, n - nb, nb, cast2constType<T>(scalars), A,
+                         shiftA + idx2D(rk, 0, lda), lda, strideA, F, idx2D(nb, 0, ldf), ldf,
+                         strideF, cast2constType<T>(scalars + 2), A, shiftA + idx2D(rk, nb, lda),
+                         lda, strideA, batch_count, (T**)work_workArr);
+
+    return rocblas_status_success;
+}
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_geqp3_template(rocblas_handle handle,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        U A,
+                                        const rocblas_int shiftA,
+                                        const rocblas_int lda,
+                                        const rocblas_stride strideA,
+                                        rocblas_int* jpvt,
+                                        const rocblas_stride strideJ,
+                                        T* ipiv,
+                                        const rocblas_stride strideP,
+                                        const rocblas_int batch_count,
+                                        T* scalars,
+                                        void* work_workArr,
+                                        T* Abyx_norms,
+                                        T* diag,
+                                        S* norms,
+                                        T* F)
+{
+    ROCSOLVER_ENTER("geqp3", "m:", m, "n:", n, "shiftA:", shiftA, "lda:", lda, "bc:", batch_count);
+
+    // quick return
+    if(n == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // the initial partial norms are the norms of the columns
+    S* vn1 = norms;
+    S* vn2 = norms + n * batch_count;
+    rocblas_stride strideV = n;
+    ROCSOLVER_LAUNCH_KERNEL((geqp3_init_norms<T>), dim3(batch_count, n, 1), dim3(BS1, 1, 1), 0,
+                            stream, m, A, shiftA, lda, strideA, jpvt, strideJ, vn1, vn2, strideV);
+
+    // quick return
+    if(m == 0)
+        return rocblas_status_success;
+
+    // everything must be executed with scalars on the device
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device);
+
+    rocblas_int dim = std::min(m, n); // total number of pivots
+    rocblas_int nb = std::min(dim, GEQP3_BLOCKSIZE);
+    rocblas_int ldf = n;
+    rocblas_stride strideF = rocblas_stride(n) * nb;
+    T* auxv = F + strideF * batch_count;
+    rocblas_stride strideX = nb;
+
+    for(rocblas_int j = 0; j < dim; j += nb)
+    {
+        // factorize the block columns j to j+jb-1 and update the trailing matrix
+        rocblas_int jb = std::min(dim - j, nb);
+        rocsolver_laqps_template<T>(handle, m, n - j, j, jb, A, shiftA + idx2D(0, j, lda), lda,
+                                    strideA, (jpvt + j), strideJ, (ipiv + j), strideP, (vn1 + j),
+                                    (vn2 + j), strideV, F, ldf, strideF, auxv, strideX,
+                                    batch_count, scalars, work_workArr, Abyx_norms, diag);
+    }
+
+    rocblas_set_pointer_mode(handle, old_mode);
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
@@ -37,6 +37,7 @@
 #include "auxiliary/rocauxiliary_larfg.hpp"
 #include "rocblas.hpp"
 #include "rocsolver/rocsolver.h"
+#include "rocsolver_run_specialized_kernels.hpp"
 
 ROCSOLVER_BEGIN_NAMESPACE
 
@@ -101,6 +102,14 @@ rocblas_status rocsolver_geqr2_geqrf_argCheck(rocblas_handle handle,
     return rocblas_status_continue;
 }
 
+/** This function determines whether the matrix is factorized by a single launch of the
+    small-size kernel **/
+template <typename T>
+inline bool geqr2_use_small(const rocblas_int m, const rocblas_int n)
+{
+    return n <= GEQR2_SPKER_MAX_N && int64_t(m) * n <= GEQR2_SPKER_MAX_SIZE(T);
+}
+
 template <typename T, typename U, bool COMPLEX = rocblas_is_complex<T>>
 rocblas_status rocsolver_geqr2_template(rocblas_handle handle,
                                         const rocblas_int m,
@@ -126,6 +135,11 @@ rocblas_status rocsolver_geqr2_template(rocblas_handle handle,
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
+    // use specialized kernel for small matrices
+    if(geqr2_use_small<T>(m, n))
+        return geqr2_run_small<T>(handle, m, n, A, shiftA, lda, strideA, ipiv, strideP,
+                                  batch_count);
+
     rocblas_int dim = std::min(m, n); // total number of pivots
 
     for(rocblas_int j = 0; j < dim; ++j)
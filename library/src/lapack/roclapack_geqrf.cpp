@@ -26,6 +26,7 @@
  * *************************************************************************/
 
 #include "roclapack_geqrf.hpp"
+#include "rocsolver_check_mode.hpp"
 
 ROCSOLVER_BEGIN_NAMESPACE
 
@@ -42,10 +43,16 @@ rocblas_status rocsolver_geqrf_impl(rocblas_handle handle,
     if(!handle)
         return rocblas_status_invalid_handle;
 
-    // argument checking
-    rocblas_status st = rocsolver_geqr2_geqrf_argCheck(handle, m, n, lda, A, ipiv);
-    if(st != rocblas_status_continue)
-        return st;
+    // argument checking (unless disabled with rocsolver_set_check_mode)
+    if(!skip_arg_checks(handle))
+    {
+        rocblas_status st = rocsolver_geqr2_geqrf_argCheck(handle, m, n, lda, A, ipiv);
+        if(st != rocblas_status_continue)
+            return st;
+    }
+
+    // nominal flop count for the call statistics
+    rocsolver_stats_flops(rocsolver_geqrf_flops<T>(m, n));
 
     // working with unshifted arrays
     rocblas_int shiftA = 0;
@@ -56,7 +63,7 @@ rocblas_status rocsolver_geqrf_impl(rocblas_handle handle,
     rocblas_int batch_count = 1;
 
     // memory workspace sizes:
-    // size for constants in rocblas calls
+    // constants in rocblas calls (only whether they are needed, see set_device_scalars)
     size_t size_scalars;
     // size of arrays of pointers (for batched cases) and re-usable workspace
     size_t size_work_workArr, size_workArr;
@@ -68,13 +75,13 @@ rocblas_status rocsolver_geqrf_impl(rocblas_handle handle,
                                             &size_Abyx_norms_trfact, &size_diag_tmptr, &size_workArr);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work_workArr,
+        return rocblas_set_optimal_device_memory_size(handle, size_t(0), size_work_workArr,
                                                       size_Abyx_norms_trfact, size_diag_tmptr,
                                                       size_workArr);
 
     // memory workspace allocation
     void *scalars, *work_workArr, *Abyx_norms_trfact, *diag_tmptr, *workArr;
-    rocblas_device_malloc mem(handle, size_scalars, size_work_workArr, size_Abyx_norms_trfact,
+    rocblas_device_malloc mem(handle, size_t(0), size_work_workArr, size_Abyx_norms_trfact,
                               size_diag_tmptr, size_workArr);
 
     if(!mem)
@@ -86,7 +93,7 @@ rocblas_status rocsolver_geqrf_impl(rocblas_handle handle,
     diag_tmptr = mem[3];
     workArr = mem[4];
     if(size_scalars > 0)
-        init_scalars(handle, (T*)scalars);
+        ROCBLAS_CHECK(set_device_scalars<T>(scalars));
 
     // execution
     return rocsolver_geqrf_template<false, false, T>(
@@ -4,7 +4,7 @@
  *     Univ. of Tennessee, Univ. of California Berkeley,
  *     Univ. of Colorado Denver and NAG Ltd..
  *     November 2019
- * Copyright (C) 2019-2024 Advanced Micro Devices, Inc. All rights reserved.
+ * Copyright (C) 2019-2025 Advanced Micro Devices, Inc. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions
@@ -40,6 +40,258 @@
 
 ROCSOLVER_BEGIN_NAMESPACE
 
+/** This function determines whether a block panel is factorized with the recursive algorithm **/
+inline bool geqrf_use_recursive(const rocblas_int m, const rocblas_int n)
+{
+    return m >= GEQRF_RECURSIVE_MIN_ROWS && n > GEQRF_RECURSIVE_LEAF_SIZE
+        && n <= 2 * GEQxF_BLOCKSIZE;
+}
+
+/** This function determines whether the matrix is factorized by a single launch of the
+    GEQR2 small-size kernel **/
+template <typename T>
+inline bool geqrf_use_small(const rocblas_int m, const rocblas_int n)
+{
+    return (m <= GEQxF_GEQx2_SWITCHSIZE || n <= GEQxF_GEQx2_SWITCHSIZE)
+        && !geqrf_use_recursive(m, n) && geqr2_use_small<T>(m, n);
+}
+
+/** This is the implementation of the recursive factorization of tall block panels.
+    The block panel is split in two halves of columns; the block reflector obtained from the
+    factorization of the left half is applied to the right half before factorizing it.
+    (The triangular factor of the block reflectors has at most GEQxF_BLOCKSIZE columns) **/
+template <bool BATCHED, bool STRIDED, typename T, typename U>
+rocblas_status geqrf_recursiveQR(rocblas_handle handle,
+                                 const rocblas_int m,
+                                 const rocblas_int n,
+                                 U A,
+                                 const rocblas_int shiftA,
+                                 const rocblas_int lda,
+                                 const rocblas_stride strideA,
+                                 T* ipiv,
+                                 const rocblas_stride strideP,
+                                 const rocblas_int batch_count,
+                                 T* scalars,
+                                 void* work_workArr,
+                                 T* Abyx_norms_trfact,
+                                 T* diag_tmptr,
+                                 T** workArr)
+{
+    // factorize leaf panel
+    if(n <= GEQRF_RECURSIVE_LEAF_SIZE)
+        return rocsolver_geqr2_template<T>(handle, m, n, A, shiftA, lda, strideA, ipiv, strideP,
+                                           batch_count, scalars, work_workArr, Abyx_norms_trfact,
+                                           diag_tmptr);
+
+    rocblas_int n1 = n / 2;
+    rocblas_int n2 = n - n1;
+
+    rocblas_int ldw = GEQxF_BLOCKSIZE;
+    rocblas_stride strideW = rocblas_stride(ldw) * ldw;
+
+    // factorize left half
+    geqrf_recursiveQR<BATCHED, STRIDED, T>(handle, m, n1, A, shiftA, lda, strideA, ipiv, strideP,
+                                           batch_count, scalars, work_workArr, Abyx_norms_trfact,
+                                           diag_tmptr, workArr);
+
+    // compute block reflector
+    rocsolver_larft_template<T>(handle, rocblas_forward_direction, rocblas_column_wise, m, n1, A,
+                                shiftA, lda, strideA, ipiv, strideP, Abyx_norms_trfact, ldw,
+                                strideW, batch_count, scalars, (T*)work_workArr, workArr);
+
+    // apply the block reflector to right half
+    rocsolver_larfb_template<BATCHED, STRIDED, T>(
+        handle, rocblas_side_left, rocblas_operation_conjugate_transpose, rocblas_forward_direction,
+        rocblas_column_wise, m, n2, n1, A, shiftA, lda, strideA, Abyx_norms_trfact, 0, ldw, strideW,
+        A, shiftA + idx2D(0, n1, lda), lda, strideA, batch_count, diag_tmptr, workArr);
+
+    // factorize right half
+    geqrf_recursiveQR<BATCHED, STRIDED, T>(handle, m - n1, n2, A, shiftA + idx2D(n1, n1, lda), lda,
+                                           strideA, (ipiv + n1), strideP, batch_count, scalars,
+                                           work_workArr, Abyx_norms_trfact, diag_tmptr, workArr);
+
+    return rocblas_status_success;
+}
+
+/** GEQRF_PANEL_KERNEL computes the QR factorization of an m-by-jb block panel
+    (jb <= GEQxF_BLOCKSIZE) and the triangular factor F of the associated block reflector (as in
+    LARFT with forward direction and column-wise storage) in a single launch. Each thread-block
+    works with the panel of one matrix of the batch, directly in global memory. The x-dimension of
+    the thread-block runs over the rows, and the y-dimension over the columns of the panel. When
+    H(j) is applied to the columns to its right, the products V(:,0:j-1)' * v(j) needed by F are
+    computed in the same pass over the columns to its left.
+    (the number of threads in the x-dimension and the total number of threads must be
+    powers of 2) **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) geqrf_panel_kernel(const rocblas_int m,
+                                                                const rocblas_int jb,
+                                                                U AA,
+                                                                const rocblas_int shiftA,
+                                                                const rocblas_int lda,
+                                                                const rocblas_stride strideA,
+                                                                T* ipivA,
+                                                                const rocblas_stride strideP,
+                                                                T* FF,
+                                                                const rocblas_int ldf,
+                                                                const rocblas_stride strideF)
+{
+    using S = decltype(std::real(T{}));
+
+    const rocblas_int bid = hipBlockIdx_z;
+    const rocblas_int tx = hipThreadIdx_x;
+    const rocblas_int ty = hipThreadIdx_y;
+    const rocblas_int dimx = hipBlockDim_x;
+    const rocblas_int dimy = hipBlockDim_y;
+    const rocblas_int tid = tx + ty * dimx;
+    const rocblas_int nthds = dimx * dimy;
+
+    // select batch instance
+    T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+    T* tau = ipivA + bid * strideP;
+    T* F = FF + bid * strideF;
+    const int64_t la = lda;
+
+    // shared memory setup: the workspace for the reductions, followed by the products
+    // V(:,0:j-1)' * v(j)
+    extern __shared__ double lmem[];
+    T* sred = reinterpret_cast<T*>(lmem);
+    T* z = sred + nthds;
+    __shared__ T stau, sscal;
+
+    for(rocblas_int j = 0; j < jb; ++j)
+    {
+        // column j from the diagonal
+        T* v = A + j + j * la;
+        const rocblas_int mm = m - j;
+
+        // compute squared norm of v(1:mm-1)
+        T sum = 0;
+        for(rocblas_int i = tid + 1; i < mm; i += nthds)
+            sum += v[i] * conj(v[i]);
+        sred[tid] = sum;
+        __syncthreads();
+
+        for(rocblas_int s = nthds / 2; s > 0; s /= 2)
+        {
+            if(tid < s)
+                sred[tid] += sred[tid + s];
+            __syncthreads();
+        }
+
+        // generate Householder reflector H(j)
+        if(tid == 0)
+        {
+            S beta;
+            larfg_set_taubeta(v[0], std::real(sred[0]), stau, sscal, beta);
+            tau[j] = stau;
+            v[0] = beta;
+        }
+        __syncthreads();
+
+        const T scal = sscal;
+        for(rocblas_int i = tid + 1; i < mm; i += nthds)
+            v[i] *= scal;
+        __syncthreads();
+
+        // apply H(j)' to the columns to the right, and compute V(:,0:j-1)' * v(j) with
+        // the columns to the left (v(0) = 1 is implicit)
+        const T ctau = conj(stau);
+        for(rocblas_int c0 = 0; c0 < jb; c0 += dimy)
+        {
+            const rocblas_int c = c0 + ty;
+            T* a = A + j + c * la;
+
+            sum = 0;
+            if(c < jb && c > j)
+            {
+                for(rocblas_int i = tx; i < mm; i += dimx)
+                    sum += (i == 0 ? a[0] : conj(v[i]) * a[i]);
+            }
+            else if(c < j)
+            {
+                for(rocblas_int i = tx; i < mm; i += dimx)
+                    sum += (i == 0 ? conj(a[0]) : conj(a[i]) * v[i]);
+            }
+            sred[tid] = sum;
+            __syncthreads();
+
+            for(rocblas_int s = dimx / 2; s > 0; s /= 2)
+            {
+                if(tx < s)
+                    sred[tid] += sred[tid + s];
+                __syncthreads();
+            }
+
+            if(c < jb && c > j)
+            {
+                const T w = ctau * sred[ty * dimx];
+                for(rocblas_int i = tx; i < mm; i += dimx)
+                    a[i] -= (i == 0 ? w : v[i] * w);
+            }
+            else if(c < j && tx == 0)
+                z[c] = sred[ty * dimx];
+            __syncthreads();
+        }
+
+        // column j of the triangular factor:
+        // F(0:j-1,j) = -tau(j) * F(0:j-1,0:j-1) * V(:,0:j-1)' * v(j), F(j,j) = tau(j)
+        for(rocblas_int k = tid; k < jb; k += nthds)
+        {
+            T f = 0;
+            if(k < j)
+            {
+                for(rocblas_int l = k; l < j; ++l)
+                    f += F[k + l * ldf] * z[l];
+                f *= -stau;
+            }
+            else if(k == j)
+                f = stau;
+            F[k + j * ldf] = f;
+        }
+        __syncthreads();
+    }
+}
+
+/** This function determines whether a block panel of GEQRF and its triangular factor are
+    computed by a single launch of geqrf_panel_kernel **/
+inline bool geqrf_use_panel_kernel(const rocblas_int m, const rocblas_int jb)
+{
+    return m <= GEQRF_PANEL_MAX_ROWS && jb <= GEQxF_BLOCKSIZE && !geqrf_use_recursive(m, jb);
+}
+
+/** GEQRF_RUN_PANEL launches geqrf_panel_kernel **/
+template <typename T, typename U>
+void geqrf_run_panel(rocblas_handle handle,
+                     const rocblas_int m,
+                     const rocblas_int jb,
+                     U A,
+                     const rocblas_int shiftA,
+                     const rocblas_int lda,
+                     const rocblas_stride strideA,
+                     T* ipiv,
+                     const rocblas_stride strideP,
+                     T* F,
+                     const rocblas_int ldf,
+                     const rocblas_stride strideF,
+                     const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER("geqrf_panel", "m:", m, "jb:", jb, "shiftA:", shiftA, "lda:", lda,
+                    "bc:", batch_count);
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // the thread-block has BS1 threads; use a full wavefront for the rows
+    // unless the panel is very short
+    rocblas_int dimx = (m <= 32) ? 32 : 64;
+    rocblas_int dimy = BS1 / dimx;
+    size_t lmemsize = sizeof(T) * (BS1 + GEQxF_BLOCKSIZE);
+
+    ROCSOLVER_LAUNCH_KERNEL((geqrf_panel_kernel<T>), dim3(1, 1, batch_count), dim3(dimx, dimy, 1),
+                            lmemsize, stream, m, jb, A, shiftA, lda, strideA, ipiv, strideP, F, ldf,
+                            strideF);
+}
+
 template <bool BATCHED, typename T>
 void rocsolver_geqrf_getMemorySize(const rocblas_int m,
                                    const rocblas_int n,
@@ -61,7 +313,8 @@ void rocsolver_geqrf_getMemorySize(const rocblas_int m,
         return;
     }
 
-    if(m <= GEQxF_GEQx2_SWITCHSIZE || n <= GEQxF_GEQx2_SWITCHSIZE)
+    if((m <= GEQxF_GEQx2_SWITCHSIZE || n <= GEQxF_GEQx2_SWITCHSIZE)
+       && !geqrf_use_recursive(m, n))
     {
         // requirements for a single GEQR2 call
         rocsolver_geqr2_getMemorySize<BATCHED, T>(m, n, batch_count, size_scalars, size_work_workArr,
@@ -84,8 +337,9 @@ void rocsolver_geqrf_getMemorySize(const rocblas_int m,
         rocsolver_larft_getMemorySize<BATCHED, T>(m, jb, batch_count, &unused, &w2, size_workArr);
 
         // requirements for calling LARFB
-        rocsolver_larfb_getMemorySize<BATCHED, T>(rocblas_side_left, m, n - jb, jb, batch_count,
-                                                  &s2, &unused);
+        // (the right half of a recursive block panel can have up to jb columns)
+        rocsolver_larfb_getMemorySize<BATCHED, T>(rocblas_side_left, m, std::max(n - jb, jb), jb,
+                                                  batch_count, &s2, &unused);
 
         *size_work_workArr = std::max(w1, w2);
         *size_diag_tmptr = std::max(s1, s2);
@@ -127,11 +381,27 @@ rocblas_status rocsolver_geqrf_template(rocblas_handle handle,
     // algorithm
     if(m <= GEQxF_GEQx2_SWITCHSIZE || n <= GEQxF_GEQx2_SWITCHSIZE)
     {
+        // (unless the matrix is tall-skinny, in which case it is factorized recursively)
+        if(geqrf_use_recursive(m, n))
+            return geqrf_recursiveQR<BATCHED, STRIDED, T>(
+                handle, m, n, A, shiftA, lda, strideA, ipiv, strideP, batch_count, scalars,
+                work_workArr, Abyx_norms_trfact, diag_tmptr, workArr);
+
         rocsolver_geqr2_template<T>(handle, m, n, A, shiftA, lda, strideA, ipiv, strideP, batch_count,
                                     scalars, work_workArr, Abyx_norms_trfact, diag_tmptr);
         return rocblas_status_success;
     }
 
+    // if there are many mid-size matrices, factorize each one with a single thread block
+    // (megakernel) instead of launching the kernels of every block column
+    if constexpr(std::is_same_v<U, T*> || std::is_same_v<U, T* const*>)
+    {
+        if(rocsolver_use_megakernel<(BATCHED || STRIDED)>(m, n, batch_count)
+           && !geqr2_use_small<T>(m, n))
+            return geqrf_run_megakernel<T>(handle, m, n, A, rocblas_stride(shiftA), lda, strideA,
+                                           ipiv, strideP, batch_count);
+    }
+
     rocblas_int dim = std::min(m, n); // total number of pivots
     rocblas_int jb, j = 0;
 
@@ -143,9 +413,33 @@ rocblas_status rocsolver_geqrf_template(rocblas_handle handle,
     {
         // Factor diagonal and subdiagonal blocks
         jb = std::min(dim - j, nb); // number of columns in the block
-        rocsolver_geqr2_template<T>(handle, m - j, jb, A, shiftA + idx2D(j, j, lda), lda, strideA,
-                                    (ipiv + j), strideP, batch_count, scalars, work_workArr,
-                                    Abyx_norms_trfact, diag_tmptr);
+
+        // (if the block panel is not too tall, factorize it and compute its block reflector
+        // with a single kernel)
+        if(j + jb < n && geqrf_use_panel_kernel(m - j, jb))
+        {
+            geqrf_run_panel<T>(handle, m - j, jb, A, shiftA + idx2D(j, j, lda), lda, strideA,
+                               (ipiv + j), strideP, Abyx_norms_trfact, ldw, strideW, batch_count);
+
+            // apply the block reflector
+            rocsolver_larfb_template<BATCHED, STRIDED, T>(
+                handle, rocblas_side_left, rocblas_operation_conjugate_transpose,
+                rocblas_forward_direction, rocblas_column_wise, m - j, n - j - jb, jb, A,
+                shiftA + idx2D(j, j, lda), lda, strideA, Abyx_norms_trfact, 0, ldw, strideW, A,
+                shiftA + idx2D(j, j + jb, lda), lda, strideA, batch_count, diag_tmptr, workArr);
+
+            j += nb;
+            continue;
+        }
+
+        if(geqrf_use_recursive(m - j, jb))
+            geqrf_recursiveQR<BATCHED, STRIDED, T>(
+                handle, m - j, jb, A, shiftA + idx2D(j, j, lda), lda, strideA, (ipiv + j), strideP,
+                batch_count, scalars, work_workArr, Abyx_norms_trfact, diag_tmptr, workArr);
+        else
+            rocsolver_geqr2_template<T>(handle, m - j, jb, A, shiftA + idx2D(j, j, lda), lda,
+                                        strideA, (ipiv + j), strideP, batch_count, scalars,
+                                        work_workArr, Abyx_norms_trfact, diag_tmptr);
 
         // apply transformation to the rest of the matrix
         if(j + jb < n)
@@ -168,9 +462,172 @@ rocblas_status rocsolver_geqrf_template(rocblas_handle handle,
 
     // factor last block
     if(j < dim)
-        rocsolver_geqr2_template<T>(handle, m - j, n - j, A, shiftA + idx2D(j, j, lda), lda,
-                                    strideA, (ipiv + j), strideP, batch_count, scalars,
-                                    work_workArr, Abyx_norms_trfact, diag_tmptr);
+    {
+        if(geqrf_use_recursive(m - j, n - j))
+            geqrf_recursiveQR<BATCHED, STRIDED, T>(
+                handle, m - j, n - j, A, shiftA + idx2D(j, j, lda), lda, strideA, (ipiv + j),
+                strideP, batch_count, scalars, work_workArr, Abyx_norms_trfact, diag_tmptr,
+                workArr);
+        else
+            rocsolver_geqr2_template<T>(handle, m - j, n - j, A, shiftA + idx2D(j, j, lda), lda,
+                                        strideA, (ipiv + j), strideP, batch_count, scalars,
+                                        work_workArr, Abyx_norms_trfact, diag_tmptr);
+    }
+
+    return rocblas_status_success;
+}
+
+/** GEQRF_VBATCHED_KERNEL factorizes the matrices of a variable-size batch whose size
+    max(m,n) is in (lo, hi]. Each matrix is processed by a thread block working directly
+    in global memory. The Householder vectors are generated with every thread in charge of
+    the rows i = tid + k * hipBlockDim_x, and applied with every thread in charge of the
+    columns j = tid + k * hipBlockDim_x. The other thread blocks return immediately. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(VBATCHED_MAX_BIN)
+    geqrf_vbatched_kernel(const rocblas_int* mm,
+                          const rocblas_int* nn,
+                          U AA,
+                          const rocblas_int* ldaa,
+                          T* ipivA,
+                          const rocblas_stride strideP,
+                          const rocblas_int lo,
+                          const rocblas_int hi)
+{
+    using S = decltype(std::real(T{}));
+
+    const rocblas_int b = hipBlockIdx_x;
+    const rocblas_int tid = hipThreadIdx_x;
+    const rocblas_int nthds = hipBlockDim_x;
+
+    const rocblas_int m = mm[b];
+    const rocblas_int n = nn[b];
+    const rocblas_int lda = ldaa[b];
+    const rocblas_int size = std::max(std::max(m, n), 1);
+    if(size <= lo || size > hi)
+        return;
+
+    // empty or invalid instances are quick returns
+    if(m <= 0 || n <= 0 || lda < m)
+        return;
+
+    T* A = load_ptr_batch<T>(AA, b, 0, 0);
+    T* tau = ipivA + b * strideP;
+    const int64_t la = lda;
+    const rocblas_int dim = std::min(m, n);
+
+    // shared mem for the norms
+    extern __shared__ double lmem[];
+    S* sval = reinterpret_cast<S*>(lmem);
+
+    for(rocblas_int k = 0; k < dim; ++k)
+    {
+        // generate the Householder reflector H(k) that annihilates A(k+1:m-1,k)
+        S xnorm2 = 0;
+        for(rocblas_int i = k + 1 + tid; i < m; i += nthds)
+            xnorm2 += std::norm(A[i + k * la]);
+        sval[tid] = xnorm2;
+        __syncthreads();
+
+        for(rocblas_int r = nthds / 2; r > 0; r /= 2)
+        {
+            if(tid < r)
+                sval[tid] += sval[tid + r];
+            __syncthreads();
+        }
+
+        T tk, scal;
+        S beta;
+        larfg_set_taubeta(A[k + k * la], sval[0], tk, scal, beta);
+        for(rocblas_int i = k + 1 + tid; i < m; i += nthds)
+            A[i + k * la] *= scal;
+        __syncthreads();
+
+        if(tid == 0)
+        {
+            A[k + k * la] = beta;
+            tau[k] = tk;
+        }
+
+        // apply H(k)' = I - conj(tau) * v * v' to A(k:m-1,k+1:n-1) from the left,
+        // with v = [1; A(k+1:m-1,k)]
+        const T ctau = conj(tk);
+        for(rocblas_int j = k + 1 + tid; j < n; j += nthds)
+        {
+            T w = A[k + j * la];
+            for(rocblas_int i = k + 1; i < m; ++i)
+                w += conj(A[i + k * la]) * A[i + j * la];
+            w *= ctau;
+
+            A[k + j * la] -= w;
+            for(rocblas_int i = k + 1; i < m; ++i)
+                A[i + j * la] -= A[i + k * la] * w;
+        }
+        __syncthreads();
+    }
+}
+
+template <typename T, typename U>
+rocblas_status rocsolver_geqrf_vbatched_argCheck(rocblas_handle handle,
+                                                 const rocblas_int* m,
+                                                 const rocblas_int* n,
+                                                 U A,
+                                                 const rocblas_int* lda,
+                                                 T* ipiv,
+                                                 const rocblas_int batch_count)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    // (the sizes of the instances are only known on the device)
+    if(batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if(batch_count && (!m || !n || !A || !lda || !ipiv))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T, typename U>
+rocblas_status rocsolver_geqrf_vbatched_template(rocblas_handle handle,
+                                                 const rocblas_int* m,
+                                                 const rocblas_int* n,
+                                                 U A,
+                                                 const rocblas_int* lda,
+                                                 T* ipiv,
+                                                 const rocblas_stride strideP,
+                                                 const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER("geqrf_vbatched", "bc:", batch_count);
+
+    // quick return if zero instances in batch
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    using S = decltype(std::real(T{}));
+    dim3 grid(batch_count, 1, 1);
+
+    // one launch per size bin
+    for(rocblas_int bin = VBATCHED_MIN_BIN; bin <= VBATCHED_MAX_BIN; bin *= 2)
+    {
+        rocblas_int lo = (bin == VBATCHED_MIN_BIN) ? 0 : bin / 2;
+        rocblas_int hi = (bin == VBATCHED_MAX_BIN) ? INT_MAX : bin;
+        size_t lmemsize = sizeof(S) * bin;
+
+        ROCSOLVER_LAUNCH_KERNEL((geqrf_vbatched_kernel<T, U>), grid, dim3(bin, 1, 1), lmemsize,
+                                stream, m, n, A, lda, ipiv, strideP, lo, hi);
+    }
 
     return rocblas_status_success;
 }
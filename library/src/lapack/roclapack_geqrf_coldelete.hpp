@@ -0,0 +1,177 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "rocsolver/rocsolver.h"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/** GEQRF_COLDELETE_KERNEL removes column col of the m-by-n upper trapezoidal factor R of one
+    matrix of the batch per thread block. Without the column, R is upper Hessenberg from column col
+    on; the sub-diagonal is annihilated by Givens rotations on consecutive rows, each one applied
+    to the rest of the two rows by the threads of the block. The rotations are computed before the
+    columns are shifted left (on the diagonal of the next column), so that the strictly lower part
+    of the array, which can hold the Householder vectors of GEQRF, is never written. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) geqrf_coldelete_kernel(const rocblas_int m,
+                                                                    const rocblas_int n,
+                                                                    const rocblas_int col,
+                                                                    U AA,
+                                                                    const rocblas_stride shiftA,
+                                                                    const rocblas_int lda,
+                                                                    const rocblas_stride strideA)
+{
+    using S = decltype(std::real(T{}));
+
+    const rocblas_int bid = hipBlockIdx_z;
+    const rocblas_int tid = hipThreadIdx_x;
+
+    T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+    const int64_t ld = lda;
+
+    __shared__ S sc;
+    __shared__ T ss;
+
+    // rotations on rows i and i+1, for the columns i+1 to n-1 of the original array
+    const rocblas_int nrot = std::min(m - 1, n - 1);
+    for(rocblas_int i = col - 1; i < nrot; ++i)
+    {
+        if(tid == 0)
+        {
+            const T f = A[i + (i + 1) * ld];
+            const T g = A[(i + 1) + (i + 1) * ld];
+            const S af = std::abs(f);
+            const S ag = std::abs(g);
+            S c = 1;
+            T s = 0;
+            T r = f;
+
+            if(ag != 0)
+            {
+                if(af == 0)
+                {
+                    c = 0;
+                    s = conj(g) / ag;
+                    r = T(ag);
+                }
+                else
+                {
+                    const S nrm = std::hypot(af, ag);
+                    const T alpha = f / af;
+                    c = af / nrm;
+                    s = alpha * conj(g) / nrm;
+                    r = alpha * nrm;
+                }
+            }
+
+            A[i + (i + 1) * ld] = r;
+            A[(i + 1) + (i + 1) * ld] = 0;
+            sc = c;
+            ss = s;
+        }
+        __syncthreads();
+
+        for(rocblas_int j = i + 2 + tid; j < n; j += BS1)
+        {
+            const T x = A[i + j * ld];
+            const T y = A[(i + 1) + j * ld];
+            A[i + j * ld] = sc * x + ss * y;
+            A[(i + 1) + j * ld] = sc * y - conj(ss) * x;
+        }
+        __syncthreads();
+    }
+
+    // shift the columns col to n-1 one position left; each thread moves its own rows, and
+    // only the upper trapezoidal part is copied
+    const rocblas_int nrows = std::min(m, n);
+    for(rocblas_int r = tid; r < nrows; r += BS1)
+    {
+        for(rocblas_int j = std::max(col - 1, r); j < n - 1; ++j)
+            A[r + j * ld] = A[r + (j + 1) * ld];
+        A[r + (n - 1) * ld] = 0;
+    }
+}
+
+template <typename T>
+rocblas_status rocsolver_geqrf_coldelete_argCheck(rocblas_handle handle,
+                                                  const rocblas_int m,
+                                                  const rocblas_int n,
+                                                  const rocblas_int col,
+                                                  const rocblas_int lda,
+                                                  T A,
+                                                  const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    if(m < 0 || n < 1 || lda < m || col < 1 || col > n || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if(m && !A)
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T, typename U>
+rocblas_status rocsolver_geqrf_coldelete_template(rocblas_handle handle,
+                                                  const rocblas_int m,
+                                                  const rocblas_int n,
+                                                  const rocblas_int col,
+                                                  U A,
+                                                  const rocblas_stride shiftA,
+                                                  const rocblas_int lda,
+                                                  const rocblas_stride strideA,
+                                                  const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER("geqrf_coldelete", "m:", m, "n:", n, "col:", col, "shiftA:", shiftA,
+                    "lda:", lda, "bc:", batch_count);
+
+    // quick return
+    if(m == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    ROCSOLVER_LAUNCH_KERNEL((geqrf_coldelete_kernel<T>), dim3(1, 1, batch_count), dim3(BS1, 1, 1),
+                            0, stream, m, n, col, A, shiftA, lda, strideA);
+
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
@@ -0,0 +1,124 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "roclapack_geqrf_coldelete.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+template <typename T, typename U>
+rocblas_status rocsolver_geqrf_coldelete_batched_impl(rocblas_handle handle,
+                                                      const rocblas_int m,
+                                                      const rocblas_int n,
+                                                      const rocblas_int col,
+                                                      U A,
+                                                      const rocblas_int lda,
+                                                      const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER_TOP("geqrf_coldelete_batched", "-m", m, "-n", n, "--col", col, "--lda", lda,
+                        "--batch_count", batch_count);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_geqrf_coldelete_argCheck(handle, m, n, col, lda, A, batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_stride shiftA = 0;
+
+    // batched execution
+    rocblas_stride strideA = 0;
+
+    // this function does not require memory work space
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_size_unchanged;
+
+    // execution
+    return rocsolver_geqrf_coldelete_template<T>(handle, m, n, col, A, shiftA, lda, strideA,
+                                                 batch_count);
+}
+
+ROCSOLVER_END_NAMESPACE
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sgeqrf_coldelete_batched(rocblas_handle handle,
+                                                  const rocblas_int m,
+                                                  const rocblas_int n,
+                                                  const rocblas_int col,
+                                                  float* const A[],
+                                                  const rocblas_int lda,
+                                                  const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_geqrf_coldelete_batched_impl<float>(
+        handle, m, n, col, A, lda, batch_count);
+}
+
+rocblas_status rocsolver_dgeqrf_coldelete_batched(rocblas_handle handle,
+                                                  const rocblas_int m,
+                                                  const rocblas_int n,
+                                                  const rocblas_int col,
+                                                  double* const A[],
+                                                  const rocblas_int lda,
+                                                  const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_geqrf_coldelete_batched_impl<double>(
+        handle, m, n, col, A, lda, batch_count);
+}
+
+rocblas_status rocsolver_cgeqrf_coldelete_batched(rocblas_handle handle,
+                                                  const rocblas_int m,
+                                                  const rocblas_int n,
+                                                  const rocblas_int col,
+                                                  rocblas_float_complex* const A[],
+                                                  const rocblas_int lda,
+                                                  const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_geqrf_coldelete_batched_impl<rocblas_float_complex>(
+        handle, m, n, col, A, lda, batch_count);
+}
+
+rocblas_status rocsolver_zgeqrf_coldelete_batched(rocblas_handle handle,
+                                                  const rocblas_int m,
+                                                  const rocblas_int n,
+                                                  const rocblas_int col,
+                                                  rocblas_double_complex* const A[],
+                                                  const rocblas_int lda,
+                                                  const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_geqrf_coldelete_batched_impl<rocblas_double_complex>(
+        handle, m, n, col, A, lda, batch_count);
+}
+} // extern C
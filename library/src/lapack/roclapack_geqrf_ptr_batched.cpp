@@ -67,6 +67,9 @@ rocblas_status rocsolver_geqrf_ptr_batched_impl(rocblas_handle handle,
     if(st != rocblas_status_continue)
         return st;
 
+    // nominal flop count for the call statistics
+    rocsolver_stats_flops(batch_count * rocsolver_geqrf_flops<T>(m, n));
+
     // working with unshifted arrays
     rocblas_int shiftA = 0;
 
@@ -74,8 +77,24 @@ rocblas_status rocsolver_geqrf_ptr_batched_impl(rocblas_handle handle,
     rocblas_stride strideA = 0;
     rocblas_stride strideP = min(m, n);
 
+    // small matrices are factorized by a single kernel that writes tau directly through the
+    // array of pointers; otherwise, tau is staged in a contiguous array, as the rocblas calls
+    // of the reflector updates require the scalars to be strided
+    if(geqrf_use_small<T>(m, n))
+    {
+        // this path does not require memory work space
+        if(rocblas_is_device_memory_size_query(handle))
+            return rocblas_status_size_unchanged;
+
+        if(m == 0 || n == 0 || batch_count == 0)
+            return rocblas_status_success;
+
+        return geqr2_run_small<T>(handle, m, n, A, shiftA, lda, strideA, tau, rocblas_stride(0),
+                                  batch_count);
+    }
+
     // memory workspace sizes:
-    // size for constants in rocblas calls
+    // constants in rocblas calls (only whether they are needed, see set_device_scalars)
     size_t size_scalars;
     // size of arrays of pointers (for batched cases) and re-usable workspace
     size_t size_work_workArr, size_workArr;
@@ -90,13 +109,13 @@ rocblas_status rocsolver_geqrf_ptr_batched_impl(rocblas_handle handle,
     size_t size_ipiv = sizeof(T) * strideP * batch_count;
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work_workArr,
+        return rocblas_set_optimal_device_memory_size(handle, size_t(0), size_work_workArr,
                                                       size_Abyx_norms_trfact, size_diag_tmptr,
                                                       size_workArr, size_ipiv);
 
     // memory workspace allocation
     void *scalars, *work_workArr, *Abyx_norms_trfact, *diag_tmptr, *workArr, *ipiv;
-    rocblas_device_malloc mem(handle, size_scalars, size_work_workArr, size_Abyx_norms_trfact,
+    rocblas_device_malloc mem(handle, size_t(0), size_work_workArr, size_Abyx_norms_trfact,
                               size_diag_tmptr, size_workArr, size_ipiv);
 
     if(!mem)
@@ -109,7 +128,7 @@ rocblas_status rocsolver_geqrf_ptr_batched_impl(rocblas_handle handle,
     workArr = mem[4];
     ipiv = mem[5];
     if(size_scalars > 0)
-        init_scalars(handle, (T*)scalars);
+        ROCBLAS_CHECK(set_device_scalars<T>(scalars));
 
     // execution
     rocblas_status status = rocsolver_geqrf_template<true, false, T>(
@@ -0,0 +1,167 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "auxiliary/rocauxiliary_lacgv.hpp"
+#include "roclapack_gelqf.hpp"
+#include "rocsolver_check_mode.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/** GEQRF_ROWMAJOR factorizes a matrix stored by rows. Seen as a column-major matrix, the array
+    holds the n-by-m matrix transpose(A), and if its LQ factorization is L*Q, then A = Q'*L' is
+    the QR factorization of A: R = transpose(L) and the Householder vectors of the rows of the
+    LQ factorization are the vectors of the columns of the QR factorization. Only the scalars
+    tau of the complex case must be conjugated. **/
+template <typename T, typename U>
+rocblas_status rocsolver_geqrf_rowmajor_impl(rocblas_handle handle,
+                                             const rocblas_int m,
+                                             const rocblas_int n,
+                                             U A,
+                                             const rocblas_int lda,
+                                             T* ipiv)
+{
+    ROCSOLVER_ENTER_TOP("geqrf_rowmajor", "-m", m, "-n", n, "--lda", lda);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking (unless disabled with rocsolver_set_check_mode)
+    // (the leading dimension of a matrix stored by rows must be at least n)
+    if(!skip_arg_checks(handle))
+    {
+        rocblas_status st = rocsolver_gelq2_gelqf_argCheck(handle, n, m, lda, A, ipiv);
+        if(st != rocblas_status_continue)
+            return st;
+    }
+
+    // nominal flop count for the call statistics
+    rocsolver_stats_flops(rocsolver_geqrf_flops<T>(m, n));
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+
+    // normal (non-batched non-strided) execution
+    rocblas_stride strideA = 0;
+    rocblas_stride stridep = 0;
+    rocblas_int batch_count = 1;
+
+    // memory workspace sizes:
+    // constants in rocblas calls (only whether they are needed, see set_device_scalars)
+    size_t size_scalars;
+    // size of arrays of pointers (for batched cases) and re-usable workspace
+    size_t size_work_workArr, size_workArr;
+    // extra requirements for calling GELQ2 and to store temporary triangular factor
+    size_t size_Abyx_norms_trfact;
+    // extra requirements for calling GELQ2 and LARFB
+    size_t size_diag_tmptr;
+    rocsolver_gelqf_getMemorySize<false, T>(n, m, batch_count, &size_scalars, &size_work_workArr,
+                                            &size_Abyx_norms_trfact, &size_diag_tmptr,
+                                            &size_workArr);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_t(0), size_work_workArr,
+                                                      size_Abyx_norms_trfact, size_diag_tmptr,
+                                                      size_workArr);
+
+    // memory workspace allocation
+    void *scalars, *work_workArr, *Abyx_norms_trfact, *diag_tmptr, *workArr;
+    rocblas_device_malloc mem(handle, size_t(0), size_work_workArr, size_Abyx_norms_trfact,
+                              size_diag_tmptr, size_workArr);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    scalars = mem[0];
+    work_workArr = mem[1];
+    Abyx_norms_trfact = mem[2];
+    diag_tmptr = mem[3];
+    workArr = mem[4];
+    if(size_scalars > 0)
+        ROCBLAS_CHECK(set_device_scalars<T>(scalars));
+
+    // execution
+    rocsolver_gelqf_template<false, false, T>(handle, n, m, A, shiftA, lda, strideA, ipiv, stridep,
+                                              batch_count, (T*)scalars, work_workArr,
+                                              (T*)Abyx_norms_trfact, (T*)diag_tmptr, (T**)workArr);
+
+    // tau of the QR factorization is the conjugate of tau of the LQ factorization
+    return rocsolver_lacgv_template<T>(handle, std::min(m, n), ipiv, 0, 1, stridep, batch_count);
+}
+
+ROCSOLVER_END_NAMESPACE
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sgeqrf_rowmajor(rocblas_handle handle,
+                                         const rocblas_int m,
+                                         const rocblas_int n,
+                                         float* A,
+                                         const rocblas_int lda,
+                                         float* ipiv)
+{
+    return rocsolver::rocsolver_geqrf_rowmajor_impl<float>(handle, m, n, A, lda, ipiv);
+}
+
+rocblas_status rocsolver_dgeqrf_rowmajor(rocblas_handle handle,
+                                         const rocblas_int m,
+                                         const rocblas_int n,
+                                         double* A,
+                                         const rocblas_int lda,
+                                         double* ipiv)
+{
+    return rocsolver::rocsolver_geqrf_rowmajor_impl<double>(handle, m, n, A, lda, ipiv);
+}
+
+rocblas_status rocsolver_cgeqrf_rowmajor(rocblas_handle handle,
+                                         const rocblas_int m,
+                                         const rocblas_int n,
+                                         rocblas_float_complex* A,
+                                         const rocblas_int lda,
+                                         rocblas_float_complex* ipiv)
+{
+    return rocsolver::rocsolver_geqrf_rowmajor_impl<rocblas_float_complex>(handle, m, n, A, lda,
+                                                                           ipiv);
+}
+
+rocblas_status rocsolver_zgeqrf_rowmajor(rocblas_handle handle,
+                                         const rocblas_int m,
+                                         const rocblas_int n,
+                                         rocblas_double_complex* A,
+                                         const rocblas_int lda,
+                                         rocblas_double_complex* ipiv)
+{
+    return rocsolver::rocsolver_geqrf_rowmajor_impl<rocblas_double_complex>(handle, m, n, A, lda,
+                                                                            ipiv);
+}
+
+} // extern C
@@ -0,0 +1,170 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "roclapack_potrf_update.hpp"
+#include "rocsolver/rocsolver.h"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/** GEQRF_ROWUPDATE_TRANSW copies the conjugate transpose of the k-by-n matrix W into the n-by-k
+    workspace X, as the vectors of the rank-k update are the rows of W. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void geqrf_rowupdate_transw(const rocblas_int n,
+                                             const rocblas_int k,
+                                             U WW,
+                                             const rocblas_stride shiftW,
+                                             const rocblas_int ldw,
+                                             const rocblas_stride strideW,
+                                             T* XX)
+{
+    const rocblas_int bid = hipBlockIdx_z;
+    const rocblas_int p = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const rocblas_int i = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+
+    if(p < k && i < n)
+    {
+        T* W = load_ptr_batch<T>(WW, bid, shiftW, strideW);
+        T* X = XX + bid * rocblas_stride(n) * k;
+        X[i + p * int64_t(n)] = conj(W[p + i * int64_t(ldw)]);
+    }
+}
+
+template <typename T, typename S>
+void rocsolver_geqrf_rowupdate_getMemorySize(const rocblas_int n,
+                                             const rocblas_int k,
+                                             const rocblas_int batch_count,
+                                             size_t* size_X,
+                                             size_t* size_rotc,
+                                             size_t* size_rots)
+{
+    // if quick return no workspace needed
+    if(n == 0 || k == 0 || batch_count == 0)
+    {
+        *size_X = 0;
+        *size_rotc = 0;
+        *size_rots = 0;
+        return;
+    }
+
+    // size of the n-by-k matrix W'
+    *size_X = sizeof(T) * n * k * batch_count;
+
+    // requirements for the update of the triangular factor
+    rocsolver_potrf_update_getMemorySize<T, S>(n, k, batch_count, size_rotc, size_rots);
+}
+
+template <typename T>
+rocblas_status rocsolver_geqrf_rowupdate_argCheck(rocblas_handle handle,
+                                                  const rocblas_int n,
+                                                  const rocblas_int k,
+                                                  const rocblas_int lda,
+                                                  const rocblas_int ldw,
+                                                  T A,
+                                                  T W,
+                                                  rocblas_int* info,
+                                                  const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    if(n < 0 || k < 0 || lda < n || ldw < k || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !A) || (n && k && !W) || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+/** GEQRF_ROWUPDATE (and GEQRF_ROWDOWNDATE) computes the triangular factor R' of the QR
+    factorization of A with k rows appended (or removed) from the factor R of A. As
+    R'^H R' = R^H R + W^H W (or R^H R - W^H W), this is the rank-k update (or downdate) of the
+    upper Cholesky factor R with X = W^H, so the rotations of POTRF_UPDATE are reused on a
+    transposed copy of W. **/
+template <bool DOWNDATE, typename T, typename S, typename U>
+rocblas_status rocsolver_geqrf_rowupdate_template(rocblas_handle handle,
+                                                  const rocblas_int n,
+                                                  const rocblas_int k,
+                                                  U A,
+                                                  const rocblas_stride shiftA,
+                                                  const rocblas_int lda,
+                                                  const rocblas_stride strideA,
+                                                  U W,
+                                                  const rocblas_stride shiftW,
+                                                  const rocblas_int ldw,
+                                                  const rocblas_stride strideW,
+                                                  rocblas_int* info,
+                                                  const rocblas_int batch_count,
+                                                  T* X,
+                                                  S* rotc,
+                                                  T* rots)
+{
+    const char* name = (DOWNDATE ? "geqrf_rowdowndate" : "geqrf_rowupdate");
+    ROCSOLVER_ENTER(name, "n:", n, "k:", k, "shiftA:", shiftA, "lda:", lda, "shiftW:", shiftW,
+                    "ldw:", ldw, "bc:", batch_count);
+
+    // quick return if zero instances in batch
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // quick return if no dimensions
+    if(n == 0 || k == 0)
+    {
+        rocblas_int blocks = (batch_count - 1) / BS1 + 1;
+        ROCSOLVER_LAUNCH_KERNEL(reset_info, dim3(blocks, 1, 1), dim3(BS1, 1, 1), 0, stream, info,
+                                batch_count, 0);
+        return rocblas_status_success;
+    }
+
+    // X = W' (W is preserved)
+    const rocblas_stride strideX = rocblas_stride(n) * k;
+    rocblas_int blocks_k = (k - 1) / BS2 + 1;
+    rocblas_int blocks_n = (n - 1) / BS2 + 1;
+    ROCSOLVER_LAUNCH_KERNEL((geqrf_rowupdate_transw<T>), dim3(blocks_k, blocks_n, batch_count),
+                            dim3(BS2, BS2, 1), 0, stream, n, k, W, shiftW, ldw, strideW, X);
+
+    // update the factor R in the upper triangular part of A
+    return rocsolver_potrf_update_template<DOWNDATE, T>(handle, rocblas_fill_upper, n, k, A, shiftA,
+                                                        lda, strideA, X, 0, n, strideX, info,
+                                                        batch_count, rotc, rots);
+}
+
+ROCSOLVER_END_NAMESPACE
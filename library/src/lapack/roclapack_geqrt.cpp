@@ -0,0 +1,162 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "roclapack_geqrt.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+template <typename T, typename U>
+rocblas_status rocsolver_geqrt_impl(rocblas_handle handle,
+                                    const rocblas_int m,
+                                    const rocblas_int n,
+                                    const rocblas_int nb,
+                                    U A,
+                                    const rocblas_int lda,
+                                    T* Tf,
+                                    const rocblas_int ldt)
+{
+    ROCSOLVER_ENTER_TOP("geqrt", "-m", m, "-n", n, "--nb", nb, "--lda", lda, "--ldt", ldt);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_geqrt_argCheck(handle, m, n, nb, lda, ldt, A, Tf);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+
+    // normal (non-batched non-strided) execution
+    rocblas_stride strideA = 0;
+    rocblas_stride strideT = 0;
+    rocblas_int batch_count = 1;
+
+    // memory workspace sizes:
+    // constants in rocblas calls (only whether they are needed, see set_device_scalars)
+    size_t size_scalars;
+    // size of arrays of pointers (for batched cases) and re-usable workspace
+    size_t size_work_workArr, size_workArr;
+    // extra requirements for calling GEQRF
+    size_t size_Abyx_norms_trfact;
+    // extra requirements for calling GEQRF and LARFB
+    size_t size_diag_tmptr;
+    // size of temporary array for the Householder scalars
+    size_t size_tau;
+    rocsolver_geqrt_getMemorySize<false, T>(m, n, nb, batch_count, &size_scalars,
+                                            &size_work_workArr, &size_Abyx_norms_trfact,
+                                            &size_diag_tmptr, &size_workArr, &size_tau);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_t(0), size_work_workArr,
+                                                      size_Abyx_norms_trfact, size_diag_tmptr,
+                                                      size_workArr, size_tau);
+
+    // memory workspace allocation
+    void *scalars, *work_workArr, *Abyx_norms_trfact, *diag_tmptr, *workArr, *tau;
+    rocblas_device_malloc mem(handle, size_t(0), size_work_workArr, size_Abyx_norms_trfact,
+                              size_diag_tmptr, size_workArr, size_tau);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    scalars = mem[0];
+    work_workArr = mem[1];
+    Abyx_norms_trfact = mem[2];
+    diag_tmptr = mem[3];
+    workArr = mem[4];
+    tau = mem[5];
+    if(size_scalars > 0)
+        ROCBLAS_CHECK(set_device_scalars<T>(scalars));
+
+    // execution
+    return rocsolver_geqrt_template<false, false, T>(
+        handle, m, n, nb, A, shiftA, lda, strideA, Tf, ldt, strideT, batch_count, (T*)scalars,
+        work_workArr, (T*)Abyx_norms_trfact, (T*)diag_tmptr, (T**)workArr, (T*)tau);
+}
+
+ROCSOLVER_END_NAMESPACE
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sgeqrt(rocblas_handle handle,
+                                const rocblas_int m,
+                                const rocblas_int n,
+                                const rocblas_int nb,
+                                float* A,
+                                const rocblas_int lda,
+                                float* T,
+                                const rocblas_int ldt)
+{
+    return rocsolver::rocsolver_geqrt_impl<float>(handle, m, n, nb, A, lda, T, ldt);
+}
+
+rocblas_status rocsolver_dgeqrt(rocblas_handle handle,
+                                const rocblas_int m,
+                                const rocblas_int n,
+                                const rocblas_int nb,
+                                double* A,
+                                const rocblas_int lda,
+                                double* T,
+                                const rocblas_int ldt)
+{
+    return rocsolver::rocsolver_geqrt_impl<double>(handle, m, n, nb, A, lda, T, ldt);
+}
+
+rocblas_status rocsolver_cgeqrt(rocblas_handle handle,
+                                const rocblas_int m,
+                                const rocblas_int n,
+                                const rocblas_int nb,
+                                rocblas_float_complex* A,
+                                const rocblas_int lda,
+                                rocblas_float_complex* T,
+                                const rocblas_int ldt)
+{
+    return rocsolver::rocsolver_geqrt_impl<rocblas_float_complex>(handle, m, n, nb, A, lda, T, ldt);
+}
+
+rocblas_status rocsolver_zgeqrt(rocblas_handle handle,
+                                const rocblas_int m,
+                                const rocblas_int n,
+                                const rocblas_int nb,
+                                rocblas_double_complex* A,
+                                const rocblas_int lda,
+                                rocblas_double_complex* T,
+                                const rocblas_int ldt)
+{
+    return rocsolver::rocsolver_geqrt_impl<rocblas_double_complex>(handle, m, n, nb, A, lda, T,
+                                                                   ldt);
+}
+
+} // extern C
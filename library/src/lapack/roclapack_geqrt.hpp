@@ -0,0 +1,179 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "auxiliary/rocauxiliary_larfb.hpp"
+#include "auxiliary/rocauxiliary_larft.hpp"
+#include "rocblas.hpp"
+#include "roclapack_geqrf.hpp"
+#include "rocsolver/rocsolver.h"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+template <bool BATCHED, typename T>
+void rocsolver_geqrt_getMemorySize(const rocblas_int m,
+                                   const rocblas_int n,
+                                   const rocblas_int nb,
+                                   const rocblas_int batch_count,
+                                   size_t* size_scalars,
+                                   size_t* size_work_workArr,
+                                   size_t* size_Abyx_norms_trfact,
+                                   size_t* size_diag_tmptr,
+                                   size_t* size_workArr,
+                                   size_t* size_tau)
+{
+    // if quick return no workspace needed
+    if(m == 0 || n == 0 || batch_count == 0)
+    {
+        *size_scalars = 0;
+        *size_work_workArr = 0;
+        *size_Abyx_norms_trfact = 0;
+        *size_diag_tmptr = 0;
+        *size_workArr = 0;
+        *size_tau = 0;
+        return;
+    }
+
+    rocblas_int dim = std::min(m, n);
+    rocblas_int jb = std::min(dim, nb);
+    size_t w, s, unused;
+
+    // requirements for calling GEQRF on the block panels
+    rocsolver_geqrf_getMemorySize<BATCHED, T>(m, jb, batch_count, size_scalars,
+                                              size_work_workArr, size_Abyx_norms_trfact,
+                                              size_diag_tmptr, size_workArr);
+
+    // requirements for calling LARFT
+    rocsolver_larft_getMemorySize<BATCHED, T>(m, jb, batch_count, &unused, &w, &unused);
+    *size_work_workArr = std::max(*size_work_workArr, w);
+
+    // requirements for calling LARFB
+    rocsolver_larfb_getMemorySize<BATCHED, T>(rocblas_side_left, m, n - jb, jb, batch_count, &s,
+                                              &unused);
+    *size_diag_tmptr = std::max(*size_diag_tmptr, s);
+
+    // size of temporary array for the Householder scalars
+    *size_tau = sizeof(T) * dim * batch_count;
+}
+
+template <typename T, typename U>
+rocblas_status rocsolver_geqrt_argCheck(rocblas_handle handle,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        const rocblas_int nb,
+                                        const rocblas_int lda,
+                                        const rocblas_int ldt,
+                                        T A,
+                                        U Tf,
+                                        const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    if(m < 0 || n < 0 || lda < m || nb < 1 || ldt < nb || batch_count < 0)
+        return rocblas_status_invalid_size;
+    if(std::min(m, n) > 0 && nb > std::min(m, n))
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((m && n && !A) || (m && n && !Tf))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename U>
+rocblas_status rocsolver_geqrt_template(rocblas_handle handle,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        const rocblas_int nb,
+                                        U A,
+                                        const rocblas_int shiftA,
+                                        const rocblas_int lda,
+                                        const rocblas_stride strideA,
+                                        T* Tf,
+                                        const rocblas_int ldt,
+                                        const rocblas_stride strideT,
+                                        const rocblas_int batch_count,
+                                        T* scalars,
+                                        void* work_workArr,
+                                        T* Abyx_norms_trfact,
+                                        T* diag_tmptr,
+                                        T** workArr,
+                                        T* tau)
+{
+    ROCSOLVER_ENTER("geqrt", "m:", m, "n:", n, "nb:", nb, "shiftA:", shiftA, "lda:", lda,
+                    "ldt:", ldt, "bc:", batch_count);
+
+    // quick return
+    if(m == 0 || n == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    rocblas_int dim = std::min(m, n); // total number of pivots
+    rocblas_stride strideP = dim;
+    rocblas_int jb;
+
+    for(rocblas_int j = 0; j < dim; j += nb)
+    {
+        // factor diagonal and subdiagonal blocks
+        jb = std::min(dim - j, nb); // number of columns in the block
+        rocsolver_geqrf_template<BATCHED, STRIDED, T>(
+            handle, m - j, jb, A, shiftA + idx2D(j, j, lda), lda, strideA, (tau + j), strideP,
+            batch_count, scalars, work_workArr, Abyx_norms_trfact, diag_tmptr, workArr);
+
+        // compute block reflector into the corresponding block of T
+        rocsolver_larft_template<T>(handle, rocblas_forward_direction, rocblas_column_wise, m - j,
+                                    jb, A, shiftA + idx2D(j, j, lda), lda, strideA, (tau + j),
+                                    strideP, (Tf + idx2D(0, j, ldt)), ldt, strideT, batch_count,
+                                    scalars, (T*)work_workArr, workArr);
+
+        // apply the block reflector to the rest of the matrix
+        if(j + jb < n)
+            rocsolver_larfb_template<BATCHED, STRIDED, T>(
+                handle, rocblas_side_left, rocblas_operation_conjugate_transpose,
+                rocblas_forward_direction, rocblas_column_wise, m - j, n - j - jb, jb, A,
+                shiftA + idx2D(j, j, lda), lda, strideA, Tf, idx2D(0, j, ldt), ldt, strideT, A,
+                shiftA + idx2D(j, j + jb, lda), lda, strideA, batch_count, diag_tmptr, workArr);
+    }
+
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
@@ -0,0 +1,158 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "roclapack_geres.hpp"
+#include "rocsolver_check_mode.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+template <typename T, typename S>
+rocblas_status rocsolver_geres_impl(rocblas_handle handle,
+                                    const rocblas_int m,
+                                    const rocblas_int n,
+                                    const rocblas_int nrhs,
+                                    T* A,
+                                    const rocblas_int lda,
+                                    T* X,
+                                    const rocblas_int ldx,
+                                    T* B,
+                                    const rocblas_int ldb,
+                                    S* rnorm)
+{
+    ROCSOLVER_ENTER_TOP("geres", "-m", m, "-n", n, "--nrhs", nrhs, "--lda", lda, "--ldx", ldx,
+                        "--ldb", ldb);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking (unless disabled with rocsolver_set_check_mode)
+    if(!skip_arg_checks(handle))
+    {
+        rocblas_status st
+            = rocsolver_geres_argCheck(handle, m, n, nrhs, lda, ldx, ldb, A, X, B, rnorm);
+        if(st != rocblas_status_continue)
+            return st;
+    }
+
+    // nominal flop count for the call statistics
+    rocsolver_stats_flops(rocsolver_flops<T>(double(m) * n * nrhs, double(m) * n * nrhs));
+
+    // this function does not require memory work space
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_size_unchanged;
+
+    // working with unshifted arrays
+    rocblas_stride shiftA = 0;
+    rocblas_stride shiftX = 0;
+    rocblas_stride shiftB = 0;
+
+    // normal (non-batched non-strided) execution
+    rocblas_stride strideA = 0;
+    rocblas_stride strideX = 0;
+    rocblas_stride strideB = 0;
+    rocblas_int batch_count = 1;
+
+    // execution
+    return rocsolver_geres_template<T>(handle, m, n, nrhs, A, shiftA, lda, strideA, X, shiftX, ldx,
+                                       strideX, B, shiftB, ldb, strideB, rnorm, batch_count);
+}
+
+ROCSOLVER_END_NAMESPACE
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sgeres(rocblas_handle handle,
+                                const rocblas_int m,
+                                const rocblas_int n,
+                                const rocblas_int nrhs,
+                                float* A,
+                                const rocblas_int lda,
+                                float* X,
+                                const rocblas_int ldx,
+                                float* B,
+                                const rocblas_int ldb,
+                                float* rnorm)
+{
+    return rocsolver::rocsolver_geres_impl<float>(handle, m, n, nrhs, A, lda, X, ldx, B, ldb,
+                                                  rnorm);
+}
+
+rocblas_status rocsolver_dgeres(rocblas_handle handle,
+                                const rocblas_int m,
+                                const rocblas_int n,
+                                const rocblas_int nrhs,
+                                double* A,
+                                const rocblas_int lda,
+                                double* X,
+                                const rocblas_int ldx,
+                                double* B,
+                                const rocblas_int ldb,
+                                double* rnorm)
+{
+    return rocsolver::rocsolver_geres_impl<double>(handle, m, n, nrhs, A, lda, X, ldx, B, ldb,
+                                                   rnorm);
+}
+
+rocblas_status rocsolver_cgeres(rocblas_handle handle,
+                                const rocblas_int m,
+                                const rocblas_int n,
+                                const rocblas_int nrhs,
+                                rocblas_float_complex* A,
+                                const rocblas_int lda,
+                                rocblas_float_complex* X,
+                                const rocblas_int ldx,
+                                rocblas_float_complex* B,
+                                const rocblas_int ldb,
+                                float* rnorm)
+{
+    return rocsolver::rocsolver_geres_impl<rocblas_float_complex>(
+        handle, m, n, nrhs, A, lda, X, ldx, B, ldb, rnorm);
+}
+
+rocblas_status rocsolver_zgeres(rocblas_handle handle,
+                                const rocblas_int m,
+                                const rocblas_int n,
+                                const rocblas_int nrhs,
+                                rocblas_double_complex* A,
+                                const rocblas_int lda,
+                                rocblas_double_complex* X,
+                                const rocblas_int ldx,
+                                rocblas_double_complex* B,
+                                const rocblas_int ldb,
+                                double* rnorm)
+{
+    return rocsolver::rocsolver_geres_impl<rocblas_double_complex>(
+        handle, m, n, nrhs, A, lda, X, ldx, B, ldb, rnorm);
+}
+
+} // extern C
@@ -0,0 +1,171 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "rocauxiliary_lange_lansy.hpp"
+#include "rocblas.hpp"
+#include "rocsolver/rocsolver.h"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/** GERES_KERNEL overwrites the m-by-nrhs matrices B with the residuals R = B - A * X, where A is
+    m-by-n and X is n-by-nrhs, and computes the largest absolute value of the entries of R (i.e.
+    the largest infinity norm of the columns of R). Each thread-block processes one problem of
+    the batch, and each thread computes the rows of R it is assigned, so that the residual and
+    its norm are obtained in a single pass. **/
+template <int MAX_THDS, typename T, typename S, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(MAX_THDS) geres_kernel(const rocblas_int m,
+                                                               const rocblas_int n,
+                                                               const rocblas_int nrhs,
+                                                               U A,
+                                                               const rocblas_stride shiftA,
+                                                               const rocblas_int lda,
+                                                               const rocblas_stride strideA,
+                                                               U X,
+                                                               const rocblas_stride shiftX,
+                                                               const rocblas_int ldx,
+                                                               const rocblas_stride strideX,
+                                                               U B,
+                                                               const rocblas_stride shiftB,
+                                                               const rocblas_int ldb,
+                                                               const rocblas_stride strideB,
+                                                               S* rnorm)
+{
+    const rocblas_int b = hipBlockIdx_y;
+    const rocblas_int tid = hipThreadIdx_x;
+
+    // A and X are not referenced (and could be null) if n = 0
+    T* Ap = (n > 0 ? load_ptr_batch<T>(A, b, shiftA, strideA) : nullptr);
+    T* Xp = (n > 0 ? load_ptr_batch<T>(X, b, shiftX, strideX) : nullptr);
+    T* Bp = load_ptr_batch<T>(B, b, shiftB, strideB);
+
+    __shared__ S sval[MAX_THDS];
+
+    S val = 0;
+    for(rocblas_int j = 0; j < nrhs; j++)
+    {
+        for(rocblas_int i = tid; i < m; i += MAX_THDS)
+        {
+            T r = Bp[i + j * rocblas_stride(ldb)];
+            for(rocblas_int k = 0; k < n; k++)
+                r -= Ap[i + k * rocblas_stride(lda)] * Xp[k + j * rocblas_stride(ldx)];
+
+            Bp[i + j * rocblas_stride(ldb)] = r;
+            val = lange_max(val, S(std::abs(r)));
+        }
+    }
+    val = lange_reduce<MAX_THDS, true>(tid, val, sval);
+
+    if(tid == 0)
+        rnorm[b] = val;
+}
+
+template <typename T, typename U>
+rocblas_status rocsolver_geres_argCheck(rocblas_handle handle,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        const rocblas_int nrhs,
+                                        const rocblas_int lda,
+                                        const rocblas_int ldx,
+                                        const rocblas_int ldb,
+                                        T A,
+                                        T X,
+                                        T B,
+                                        U rnorm,
+                                        const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    if(m < 0 || n < 0 || nrhs < 0 || lda < m || ldx < n || ldb < m || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((m && n && !A) || (n && nrhs && !X) || (m && nrhs && !B) || (batch_count && !rnorm))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_geres_template(rocblas_handle handle,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        const rocblas_int nrhs,
+                                        U A,
+                                        const rocblas_stride shiftA,
+                                        const rocblas_int lda,
+                                        const rocblas_stride strideA,
+                                        U X,
+                                        const rocblas_stride shiftX,
+                                        const rocblas_int ldx,
+                                        const rocblas_stride strideX,
+                                        U B,
+                                        const rocblas_stride shiftB,
+                                        const rocblas_int ldb,
+                                        const rocblas_stride strideB,
+                                        S* rnorm,
+                                        const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER("geres", "m:", m, "n:", n, "nrhs:", nrhs, "shiftA:", shiftA, "lda:", lda,
+                    "shiftX:", shiftX, "ldx:", ldx, "shiftB:", shiftB, "ldb:", ldb,
+                    "bc:", batch_count);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    dim3 threads(BS1, 1, 1);
+
+    // quick return with zero norms if the residuals are empty
+    if(m == 0 || nrhs == 0)
+    {
+        rocblas_int blocks = (batch_count - 1) / BS1 + 1;
+        ROCSOLVER_LAUNCH_KERNEL(reset_info, dim3(blocks, 1, 1), threads, 0, stream, rnorm,
+                                batch_count, 0);
+        return rocblas_status_success;
+    }
+
+    ROCSOLVER_LAUNCH_KERNEL((geres_kernel<BS1, T>), dim3(1, batch_count, 1), threads, 0, stream, m,
+                            n, nrhs, A, shiftA, lda, strideA, X, shiftX, ldx, strideX, B, shiftB,
+                            ldb, strideB, rnorm);
+
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
@@ -26,6 +26,7 @@
  * *************************************************************************/
 
 #include "roclapack_gesv.hpp"
+#include "rocsolver_check_mode.hpp"
 
 ROCSOLVER_BEGIN_NAMESPACE
 
@@ -41,16 +42,20 @@ rocblas_status rocsolver_gesv_impl(rocblas_handle handle,
                                    rocblas_int* info)
 {
     ROCSOLVER_ENTER_TOP("gesv", "-n", n, "--nrhs", nrhs, "--lda", lda, "--ldb", ldb);
+    ROCSOLVER_INFO_SUMMARY(info, 1);
 
     using S = decltype(std::real(T{}));
 
     if(!handle)
         return rocblas_status_invalid_handle;
 
-    // argument checking
-    rocblas_status st = rocsolver_gesv_argCheck(handle, n, nrhs, lda, ldb, A, B, ipiv, info);
-    if(st != rocblas_status_continue)
-        return st;
+    // argument checking (unless disabled with rocsolver_set_check_mode)
+    if(!skip_arg_checks(handle))
+    {
+        rocblas_status st = rocsolver_gesv_argCheck(handle, n, nrhs, lda, ldb, A, B, ipiv, info);
+        if(st != rocblas_status_continue)
+            return st;
+    }
 
     // working with unshifted arrays
     rocblas_int shiftA = 0;
@@ -63,7 +68,7 @@ rocblas_status rocsolver_gesv_impl(rocblas_handle handle,
     rocblas_int batch_count = 1;
 
     // memory workspace sizes:
-    // size for constants in rocblas calls
+    // constants in rocblas calls (only whether they are needed, see set_device_scalars)
     size_t size_scalars;
     // size of reusable workspace (and for calling GETRF and GETRS)
     bool optim_mem;
@@ -76,12 +81,12 @@ rocblas_status rocsolver_gesv_impl(rocblas_handle handle,
 
     if(rocblas_is_device_memory_size_query(handle))
         return rocblas_set_optimal_device_memory_size(
-            handle, size_scalars, size_work, size_work1, size_work2, size_work3, size_work4,
+            handle, size_t(0), size_work, size_work1, size_work2, size_work3, size_work4,
             size_pivotval, size_pivotidx, size_iipiv, size_iinfo);
 
     // memory workspace allocation
     void *scalars, *work, *work1, *work2, *work3, *work4, *pivotval, *pivotidx, *iinfo, *iipiv;
-    rocblas_device_malloc mem(handle, size_scalars, size_work, size_work1, size_work2, size_work3,
+    rocblas_device_malloc mem(handle, size_t(0), size_work, size_work1, size_work2, size_work3,
                               size_work4, size_pivotval, size_pivotidx, size_iipiv, size_iinfo);
 
     if(!mem)
@@ -98,13 +103,13 @@ rocblas_status rocsolver_gesv_impl(rocblas_handle handle,
     iipiv = mem[8];
     iinfo = mem[9];
     if(size_scalars > 0)
-        init_scalars(handle, (T*)scalars);
+        ROCBLAS_CHECK(set_device_scalars<T>(scalars));
 
     // execution
-    return rocsolver_gesv_template<false, false, T>(
+    return _info_summary_scope.commit(rocsolver_gesv_template<false, false, T>(
         handle, n, nrhs, A, shiftA, lda, strideA, ipiv, strideP, B, shiftB, ldb, strideB, info,
         batch_count, (T*)scalars, (T*)work, work1, work2, work3, work4, (T*)pivotval,
-        (rocblas_int*)pivotidx, (rocblas_int*)iipiv, (rocblas_int*)iinfo, optim_mem);
+        (rocblas_int*)pivotidx, (rocblas_int*)iipiv, (rocblas_int*)iinfo, optim_mem));
 }
 
 ROCSOLVER_END_NAMESPACE
@@ -104,6 +104,25 @@ void rocsolver_gesv_getMemorySize(const rocblas_int n,
         return;
     }
 
+#ifdef OPTIMAL
+    // if tiny size, the fused kernel needs no workspace
+    if(n <= GESV_SMALL_MAX_SIZE)
+    {
+        *size_scalars = 0;
+        *size_work = 0;
+        *size_work1 = 0;
+        *size_work2 = 0;
+        *size_work3 = 0;
+        *size_work4 = 0;
+        *size_pivotval = 0;
+        *size_pivotidx = 0;
+        *size_iipiv = 0;
+        *size_iinfo = 0;
+        *optim_mem = true;
+        return;
+    }
+#endif
+
     bool opt1, opt2;
     size_t w1, w2, w3, w4;
 
@@ -175,6 +194,14 @@ rocblas_status rocsolver_gesv_template(rocblas_handle handle,
     if(n == 0 || nrhs == 0)
         return rocblas_status_success;
 
+#ifdef OPTIMAL
+    // if tiny size, factorize and solve with a single kernel
+    // (info is set by the kernel, and B is not overwritten if A is singular)
+    if(n <= GESV_SMALL_MAX_SIZE)
+        return gesv_run_small<T>(handle, n, nrhs, A, shiftA, lda, strideA, ipiv, strideP, B,
+                                 shiftB, ldb, strideB, info, batch_count);
+#endif
+
     // constants in host memory
     const rocblas_int copyblocksx = (n - 1) / 32 + 1;
     const rocblas_int copyblocksy = (nrhs - 1) / 32 + 1;
@@ -0,0 +1,611 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "rocauxiliary_lange_lansy.hpp"
+#include "rocblas.hpp"
+#include "roclapack_getrf.hpp"
+#include "roclapack_getrs.hpp"
+#include "rocsolver/rocsolver.h"
+
+#include <vector>
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/** The lower precision type used to factorize the matrices in DSGESV/ZCGESV **/
+template <typename T>
+using gesv_mixed_low_t = std::conditional_t<rocblas_is_complex<T>, rocblas_float_complex, float>;
+
+/** Status codes of the problems in the batch while refining
+    (negative values are the iter codes returned on failure, see LAPACK's DSGESV) **/
+#define GESV_MIXED_REFINING 0
+#define GESV_MIXED_CONVERGED 1
+#define GESV_MIXED_OVERFLOW -2
+#define GESV_MIXED_SINGULAR -3
+
+__device__ inline float gesv_mixed_to_low(double a)
+{
+    return float(a);
+}
+
+__device__ inline rocblas_float_complex gesv_mixed_to_low(rocblas_double_complex a)
+{
+    return rocblas_float_complex(float(a.real()), float(a.imag()));
+}
+
+__device__ inline double gesv_mixed_to_high(float a)
+{
+    return double(a);
+}
+
+__device__ inline rocblas_double_complex gesv_mixed_to_high(rocblas_float_complex a)
+{
+    return rocblas_double_complex(double(a.real()), double(a.imag()));
+}
+
+__device__ inline bool gesv_mixed_overflow(double a)
+{
+    return std::abs(a) > std::numeric_limits<float>::max();
+}
+
+__device__ inline bool gesv_mixed_overflow(rocblas_double_complex a)
+{
+    return std::abs(a.real()) > std::numeric_limits<float>::max()
+        || std::abs(a.imag()) > std::numeric_limits<float>::max();
+}
+
+/** GESV_MIXED_DEMOTE copies the m-by-n matrices A into W converting them to the lower precision.
+    If uplo is not rocblas_fill_full, only the corresponding triangular part is copied.
+    Only the problems selected by the mask are processed; the ones with an entry that overflows in
+    the lower precision are flagged in state. **/
+template <typename T, typename Tl, typename U, typename Mask = no_mask>
+ROCSOLVER_KERNEL void gesv_mixed_demote(const rocblas_fill uplo,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        U A,
+                                        const rocblas_int shiftA,
+                                        const rocblas_int lda,
+                                        const rocblas_stride strideA,
+                                        Tl* W,
+                                        const rocblas_int ldw,
+                                        const rocblas_stride strideW,
+                                        rocblas_int* state,
+                                        const Mask mask = no_mask{})
+{
+    const auto b = hipBlockIdx_z;
+    const auto j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+    const auto i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    const bool in_tri
+        = (uplo == rocblas_fill_full) || (uplo == rocblas_fill_upper ? i <= j : i >= j);
+
+    if(i < m && j < n && in_tri && mask[b])
+    {
+        T* Ap = load_ptr_batch<T>(A, b, shiftA, strideA);
+        T a = Ap[i + j * lda];
+
+        if(gesv_mixed_overflow(a))
+            state[b] = GESV_MIXED_OVERFLOW;
+        W[b * strideW + i + j * ldw] = gesv_mixed_to_low(a);
+    }
+}
+
+/** GESV_MIXED_PROMOTE overwrites (if !ADD) or updates (if ADD) the m-by-n matrices X with the
+    lower precision matrices in W. Only the problems selected by the mask are processed. **/
+template <bool ADD, typename T, typename Tl, typename U, typename Mask = no_mask>
+ROCSOLVER_KERNEL void gesv_mixed_promote(const rocblas_int m,
+                                         const rocblas_int n,
+                                         Tl* W,
+                                         const rocblas_int ldw,
+                                         const rocblas_stride strideW,
+                                         U X,
+                                         const rocblas_int shiftX,
+                                         const rocblas_int ldx,
+                                         const rocblas_stride strideX,
+                                         const Mask mask = no_mask{})
+{
+    const auto b = hipBlockIdx_z;
+    const auto j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+    const auto i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(i < m && j < n && mask[b])
+    {
+        T* Xp = load_ptr_batch<T>(X, b, shiftX, strideX);
+        T w = gesv_mixed_to_high(W[b * strideW + i + j * ldw]);
+
+        if(ADD)
+            Xp[i + j * ldx] += w;
+        else
+            Xp[i + j * ldx] = w;
+    }
+}
+
+/** GESV_MIXED_FACTOR_CHECK flags the problems whose lower precision factorization failed **/
+template <typename I>
+ROCSOLVER_KERNEL void gesv_mixed_factor_check(const I batch_count, I* linfo, I* state)
+{
+    I b = hipBlockIdx_x * static_cast<I>(hipBlockDim_x) + hipThreadIdx_x;
+
+    if(b < batch_count && state[b] == GESV_MIXED_REFINING && linfo[b] > 0)
+        state[b] = GESV_MIXED_SINGULAR;
+}
+
+/** GESV_MIXED_CHECK checks the convergence of the problems that are still being refined, i.e.
+    whether ||R_j||_inf <= ||X_j||_inf * ||A||_inf * cte for all the columns j, and updates state
+    and iter. It also counts, in counters[0] and counters[1], the problems that remain to be
+    refined and the problems whose refinement failed. Each thread-block processes one problem. **/
+template <int MAX_THDS, typename T, typename S, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(MAX_THDS) gesv_mixed_check(const rocblas_int n,
+                                                                   const rocblas_int nrhs,
+                                                                   U X,
+                                                                   const rocblas_int shiftX,
+                                                                   const rocblas_int ldx,
+                                                                   const rocblas_stride strideX,
+                                                                   U R,
+                                                                   const rocblas_int ldr,
+                                                                   const rocblas_stride strideR,
+                                                                   const S* anorm,
+                                                                   const S cte,
+                                                                   const rocblas_int iiter,
+                                                                   rocblas_int* state,
+                                                                   rocblas_int* iter,
+                                                                   rocblas_int* counters)
+{
+    const rocblas_int b = hipBlockIdx_y;
+    const rocblas_int tid = hipThreadIdx_x;
+
+    __shared__ S sval[MAX_THDS];
+    __shared__ rocblas_int sidx[MAX_THDS];
+
+    if(state[b] == GESV_MIXED_REFINING)
+    {
+        T* Xp = load_ptr_batch<T>(X, b, shiftX, strideX);
+        T* Rp = load_ptr_batch<T>(R, b, 0, strideR);
+        const S bound = anorm[b] * cte;
+
+        bool converged = true;
+        for(rocblas_int j = 0; j < nrhs && converged; j++)
+        {
+            iamax<MAX_THDS>(tid, n, Xp + j * ldx, 1, sval, sidx);
+            __syncthreads();
+            S xnrm = sval[0];
+            __syncthreads();
+
+            iamax<MAX_THDS>(tid, n, Rp + j * ldr, 1, sval, sidx);
+            __syncthreads();
+            S rnrm = sval[0];
+            __syncthreads();
+
+            // (a NaN in the residual is not considered converged)
+            converged = (rnrm <= xnrm * bound);
+        }
+
+        if(tid == 0)
+        {
+            if(converged)
+            {
+                state[b] = GESV_MIXED_CONVERGED;
+                iter[b] = iiter;
+            }
+            else if(iiter == GESV_MIXED_MAX_ITERS)
+                state[b] = -GESV_MIXED_MAX_ITERS - 1;
+        }
+    }
+
+    if(tid == 0)
+    {
+        rocblas_int s = state[b];
+        if(s == GESV_MIXED_REFINING)
+            atomicAdd(counters, 1);
+        else if(s < 0)
+        {
+            iter[b] = s;
+            atomicAdd(counters + 1, 1);
+        }
+    }
+}
+
+template <typename T>
+rocblas_status rocsolver_gesv_mixed_argCheck(rocblas_handle handle,
+                                             const rocblas_int n,
+                                             const rocblas_int nrhs,
+                                             const rocblas_int lda,
+                                             const rocblas_int ldb,
+                                             const rocblas_int ldx,
+                                             T A,
+                                             T B,
+                                             T X,
+                                             const rocblas_int* ipiv,
+                                             const rocblas_int* iter,
+                                             const rocblas_int* info,
+                                             const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    if(n < 0 || nrhs < 0 || lda < n || ldb < n || ldx < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !A) || (n && !ipiv) || (nrhs * n && !B) || (nrhs * n && !X)
+       || (batch_count && !iter) || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void rocsolver_gesv_mixed_getMemorySize(const rocblas_int n,
+                                        const rocblas_int nrhs,
+                                        const rocblas_int batch_count,
+                                        size_t* size_scalars,
+                                        size_t* size_scalars_low,
+                                        size_t* size_work1,
+                                        size_t* size_work2,
+                                        size_t* size_work3,
+                                        size_t* size_work4,
+                                        size_t* size_pivotval,
+                                        size_t* size_pivotidx,
+                                        size_t* size_iipiv,
+                                        size_t* size_iinfo,
+                                        size_t* size_Alow,
+                                        size_t* size_Xlow,
+                                        size_t* size_R,
+                                        size_t* size_Rarr,
+                                        size_t* size_anorm,
+                                        size_t* size_state,
+                                        bool* optim_mem)
+{
+    using Tl = gesv_mixed_low_t<T>;
+    using S = decltype(std::real(T{}));
+
+    // if quick return, no workspace is needed
+    if(n == 0 || nrhs == 0 || batch_count == 0)
+    {
+        *size_scalars = 0;
+        *size_scalars_low = 0;
+        *size_work1 = 0;
+        *size_work2 = 0;
+        *size_work3 = 0;
+        *size_work4 = 0;
+        *size_pivotval = 0;
+        *size_pivotidx = 0;
+        *size_iipiv = 0;
+        *size_iinfo = 0;
+        *size_Alow = 0;
+        *size_Xlow = 0;
+        *size_R = 0;
+        *size_Rarr = 0;
+        *size_anorm = 0;
+        *size_state = 0;
+        *optim_mem = true;
+        return;
+    }
+
+    bool opt1, opt2, opt3, opt4;
+    size_t w1, w2, w3, w4, w5, w6, w7, w8;
+
+    // workspace required for calling GETRF and GETRS in full precision
+    // (for the problems that need to be solved again)
+    rocsolver_getrf_getMemorySize<BATCHED, STRIDED, T>(
+        n, n, true, batch_count, size_scalars, size_work1, size_work2, size_work3, size_work4,
+        size_pivotval, size_pivotidx, size_iipiv, size_iinfo, &opt1);
+
+    rocsolver_getrs_getMemorySize<BATCHED, STRIDED, T>(rocblas_operation_none, n, nrhs, batch_count,
+                                                       &w1, &w2, &w3, &w4, &opt2);
+
+    *size_work1 = std::max(*size_work1, w1);
+    *size_work2 = std::max(*size_work2, w2);
+    *size_work3 = std::max(*size_work3, w3);
+    *size_work4 = std::max(*size_work4, w4);
+
+    // workspace required for calling GETRF and GETRS in lower precision
+    // (the lower precision copies are always strided)
+    rocsolver_getrf_getMemorySize<false, true, Tl>(n, n, true, batch_count, size_scalars_low, &w1,
+                                                   &w2, &w3, &w4, &w5, &w6, &w7, &w8, &opt3);
+
+    *size_work1 = std::max(*size_work1, w1);
+    *size_work2 = std::max(*size_work2, w2);
+    *size_work3 = std::max(*size_work3, w3);
+    *size_work4 = std::max(*size_work4, w4);
+    *size_pivotval = std::max(*size_pivotval, w5);
+    *size_pivotidx = std::max(*size_pivotidx, w6);
+    *size_iipiv = std::max(*size_iipiv, w7);
+    *size_iinfo = std::max(*size_iinfo, w8);
+
+    rocsolver_getrs_getMemorySize<false, true, Tl>(rocblas_operation_none, n, nrhs, batch_count,
+                                                   &w1, &w2, &w3, &w4, &opt4);
+
+    *size_work1 = std::max(*size_work1, w1);
+    *size_work2 = std::max(*size_work2, w2);
+    *size_work3 = std::max(*size_work3, w3);
+    *size_work4 = std::max(*size_work4, w4);
+    *optim_mem = opt1 && opt2 && opt3 && opt4;
+
+    // lower precision copies of A and of the solution/correction
+    *size_Alow = sizeof(Tl) * n * n * batch_count;
+    *size_Xlow = sizeof(Tl) * n * nrhs * batch_count;
+
+    // residual in full precision
+    *size_R = sizeof(T) * n * nrhs * batch_count;
+    *size_Rarr = BATCHED ? sizeof(T*) * batch_count : 0;
+
+    // norms of A, status of each problem, info of the lower precision factorization,
+    // and counters of pending/failed problems
+    *size_anorm = sizeof(S) * batch_count;
+    *size_state = sizeof(rocblas_int) * (2 * batch_count + 2);
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename U>
+rocblas_status rocsolver_gesv_mixed_template(rocblas_handle handle,
+                                             const rocblas_int n,
+                                             const rocblas_int nrhs,
+                                             U A,
+                                             const rocblas_int shiftA,
+                                             const rocblas_int lda,
+                                             const rocblas_stride strideA,
+                                             rocblas_int* ipiv,
+                                             const rocblas_stride strideP,
+                                             U B,
+                                             const rocblas_int shiftB,
+                                             const rocblas_int ldb,
+                                             const rocblas_stride strideB,
+                                             U X,
+                                             const rocblas_int shiftX,
+                                             const rocblas_int ldx,
+                                             const rocblas_stride strideX,
+                                             rocblas_int* iter,
+                                             rocblas_int* info,
+                                             const rocblas_int batch_count,
+                                             T* scalars,
+                                             gesv_mixed_low_t<T>* scalars_low,
+                                             void* work1,
+                                             void* work2,
+                                             void* work3,
+                                             void* work4,
+                                             void* pivotval,
+                                             rocblas_int* pivotidx,
+                                             rocblas_int* iipiv,
+                                             rocblas_int* iinfo,
+                                             gesv_mixed_low_t<T>* Alow,
+                                             gesv_mixed_low_t<T>* Xlow,
+                                             T* Rbuf,
+                                             T** Rarr,
+                                             decltype(std::real(T{}))* anorm,
+                                             rocblas_int* state,
+                                             bool optim_mem)
+{
+    ROCSOLVER_ENTER("gesv_mixed", "n:", n, "nrhs:", nrhs, "shiftA:", shiftA, "lda:", lda,
+                    "shiftB:", shiftB, "ldb:", ldb, "shiftX:", shiftX, "ldx:", ldx,
+                    "bc:", batch_count);
+
+    using Tl = gesv_mixed_low_t<T>;
+    using S = decltype(std::real(T{}));
+
+    // quick return if zero instances in batch
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocksReset = (batch_count - 1) / BS1 + 1;
+    dim3 gridReset(blocksReset, 1, 1);
+    dim3 threads(BS1, 1, 1);
+
+    // info=0 (starting with a nonsingular matrix) and iter=0
+    ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, info, batch_count, 0);
+    ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, iter, batch_count, 0);
+
+    // quick return if A or B are empty
+    if(n == 0 || nrhs == 0)
+        return rocblas_status_success;
+
+    // everything must be executed with scalars on the host
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+    T one = 1;
+    T minone = -1;
+
+    // constants in host memory
+    const rocblas_int blocksx = (n - 1) / 32 + 1;
+    const rocblas_int blocksy = (nrhs - 1) / 32 + 1;
+    const dim3 gridA(blocksx, blocksx, batch_count);
+    const dim3 gridB(blocksx, blocksy, batch_count);
+    const dim3 threads2(32, 32, 1);
+    const dim3 gridBatch(1, batch_count, 1);
+    const rocblas_stride strideAl = rocblas_stride(n) * n;
+    const rocblas_stride strideXl = rocblas_stride(n) * nrhs;
+    const rocblas_stride strideR = rocblas_stride(n) * nrhs;
+    const S cte = get_epsilon<T>() * std::sqrt(S(n));
+
+    rocblas_int* linfo = state + batch_count;
+    rocblas_int* counters = state + 2 * batch_count;
+    info_mask refining(state, info_mask::negate);
+
+    // the iterative refinement needs to check for convergence on the host, and thus it is not
+    // used while the stream is being captured into a graph; in that case, the systems are
+    // solved directly in full precision (with iter = -1)
+    const bool capturing = stream_is_capturing(stream);
+    rocblas_int h_counters[2] = {0, 1};
+    if(capturing)
+        ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, iter, batch_count, -1);
+    else
+    {
+        // the residuals are accessed in the same way as the user matrices
+        U R;
+        if constexpr(BATCHED)
+        {
+            ROCSOLVER_LAUNCH_KERNEL(get_array, gridReset, threads, 0, stream, Rarr, Rbuf, strideR,
+                                    batch_count);
+            R = Rarr;
+        }
+        else
+            R = Rbuf;
+
+        // convert A and B to the lower precision, and compute the norms of A
+        ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, state, batch_count,
+                                GESV_MIXED_REFINING);
+        ROCSOLVER_LAUNCH_KERNEL((gesv_mixed_demote<T, Tl>), gridA, threads2, 0, stream,
+                                rocblas_fill_full, n, n, A, shiftA, lda, strideA, Alow, n, strideAl,
+                                state);
+        ROCSOLVER_LAUNCH_KERNEL((gesv_mixed_demote<T, Tl>), gridB, threads2, 0, stream,
+                                rocblas_fill_full, n, nrhs, B, shiftB, ldb, strideB, Xlow, n,
+                                strideXl, state);
+        rocsolver_lange_lansy_template<T>(handle, rocsolver_norm_inf, rocblas_fill_full, n, n, A,
+                                          shiftA, lda, strideA, anorm, batch_count);
+
+        // compute the LU factorization in lower precision and the first solution
+        rocsolver_getrf_template<false, true, Tl>(handle, n, n, Alow, 0, 1, n, strideAl, ipiv, 0,
+                                                  strideP, linfo, batch_count, scalars_low, work1,
+                                                  work2, work3, work4, (Tl*)pivotval, pivotidx,
+                                                  iipiv, iinfo, optim_mem, true);
+        ROCSOLVER_LAUNCH_KERNEL(gesv_mixed_factor_check, gridReset, threads, 0, stream, batch_count,
+                                linfo, state);
+
+        rocsolver_getrs_template<false, true, Tl>(handle, rocblas_operation_none, n, nrhs, Alow, 0,
+                                                  1, n, strideAl, ipiv, strideP, Xlow, 0, 1, n,
+                                                  strideXl, batch_count, work1, work2, work3, work4,
+                                                  optim_mem, true);
+        ROCSOLVER_LAUNCH_KERNEL((gesv_mixed_promote<false, T, Tl>), gridB, threads2, 0, stream, n,
+                                nrhs, Xlow, n, strideXl, X, shiftX, ldx, strideX);
+
+        // iterative refinement
+        for(rocblas_int iiter = 0;; iiter++)
+        {
+            if(iiter > 0)
+            {
+                // solve A * C = R in lower precision and update X = X + C
+                ROCSOLVER_LAUNCH_KERNEL((gesv_mixed_demote<T, Tl>), gridB, threads2, 0, stream,
+                                        rocblas_fill_full, n, nrhs, R, 0, n, strideR, Xlow, n,
+                                        strideXl, state, refining);
+                rocsolver_getrs_template<false, true, Tl>(handle, rocblas_operation_none, n, nrhs,
+                                                          Alow, 0, 1, n, strideAl, ipiv, strideP,
+                                                          Xlow, 0, 1, n, strideXl, batch_count,
+                                                          work1, work2, work3, work4, optim_mem,
+                                                          true);
+                ROCSOLVER_LAUNCH_KERNEL((gesv_mixed_promote<true, T, Tl>), gridB, threads2, 0,
+                                        stream, n, nrhs, Xlow, n, strideXl, X, shiftX, ldx, strideX,
+                                        refining);
+            }
+
+            // compute the residuals R = B - A * X in full precision
+            ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, gridB, threads2, 0, stream, n, nrhs, B, shiftB,
+                                    ldb, strideB, R, 0, n, strideR);
+            rocblasCall_gemm(handle, rocblas_operation_none, rocblas_operation_none, n, nrhs, n,
+                             &minone, A, shiftA, lda, strideA, X, shiftX, ldx, strideX, &one, R, 0,
+                             n, strideR, batch_count, (T**)nullptr);
+
+            // check convergence; the host needs to know whether all the problems are done
+            HIP_CHECK(hipMemsetAsync(counters, 0, sizeof(rocblas_int) * 2, stream));
+            ROCSOLVER_LAUNCH_KERNEL((gesv_mixed_check<BS1, T>), gridBatch, threads, 0, stream, n,
+                                    nrhs, X, shiftX, ldx, strideX, R, n, strideR, anorm, cte, iiter,
+                                    state, iter, counters);
+            HIP_CHECK(hipMemcpyAsync(h_counters, counters, sizeof(rocblas_int) * 2,
+                                     hipMemcpyDeviceToHost, stream));
+            rocsolver_stats_host_sync();
+            HIP_CHECK(hipStreamSynchronize(stream));
+
+            if(h_counters[0] == 0)
+                break;
+        }
+    }
+
+    // if the refinement failed for some problems (or was not used), solve those problems again
+    // in full precision; the problems that converged keep their matrices, solutions and iter
+    if(h_counters[1] > 0)
+    {
+        std::vector<rocblas_int> h_state(batch_count, GESV_MIXED_SINGULAR);
+        if(!capturing && h_counters[1] < batch_count)
+        {
+            HIP_CHECK(hipMemcpyAsync(h_state.data(), state, sizeof(rocblas_int) * batch_count,
+                                     hipMemcpyDeviceToHost, stream));
+            rocsolver_stats_host_sync();
+            HIP_CHECK(hipStreamSynchronize(stream));
+        }
+
+        auto batch_ptr = [](U M, const rocblas_stride strideM, const rocblas_int b) -> U {
+            if constexpr(BATCHED)
+                return M + b;
+            else
+                return M + b * strideM;
+        };
+
+        // (consecutive failed problems are solved together)
+        for(rocblas_int b = 0; b < batch_count;)
+        {
+            if(h_state[b] >= 0)
+            {
+                b++;
+                continue;
+            }
+
+            rocblas_int bc = 1;
+            while(b + bc < batch_count && h_state[b + bc] < 0)
+                bc++;
+
+            U Ab = batch_ptr(A, strideA, b);
+            U Bb = batch_ptr(B, strideB, b);
+            U Xb = batch_ptr(X, strideX, b);
+            rocblas_int* ipivb = ipiv + b * strideP;
+            const dim3 gridBb(blocksx, blocksy, bc);
+
+            rocsolver_getrf_template<BATCHED, STRIDED, T>(
+                handle, n, n, Ab, shiftA, 1, lda, strideA, ipivb, 0, strideP, info + b, bc,
+                scalars, work1, work2, work3, work4, (T*)pivotval, pivotidx, iipiv, iinfo,
+                optim_mem, true);
+
+            ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, gridBb, threads2, 0, stream, n, nrhs, Bb, shiftB,
+                                    ldb, strideB, Xb, shiftX, ldx, strideX);
+            rocsolver_getrs_template<BATCHED, STRIDED, T>(
+                handle, rocblas_operation_none, n, nrhs, Ab, shiftA, 1, lda, strideA, ipivb,
+                strideP, Xb, shiftX, 1, ldx, strideX, bc, work1, work2, work3, work4, optim_mem,
+                true);
+
+            b += bc;
+        }
+    }
+
+    rocblas_set_pointer_mode(handle, old_mode);
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
@@ -52,6 +52,7 @@ rocblas_status rocsolver_gesv_outofplace_impl(rocblas_handle handle,
 {
     ROCSOLVER_ENTER_TOP("gesv_outofplace", "-n", n, "--nrhs", nrhs, "--lda", lda, "--ldb", ldb,
                         "--ldx", ldx);
+    ROCSOLVER_INFO_SUMMARY(info, 1);
 
     using S = decltype(std::real(T{}));
 
@@ -77,7 +78,7 @@ rocblas_status rocsolver_gesv_outofplace_impl(rocblas_handle handle,
     rocblas_int batch_count = 1;
 
     // memory workspace sizes:
-    // size for constants in rocblas calls
+    // constants in rocblas calls (only whether they are needed, see set_device_scalars)
     size_t size_scalars;
     // size of reusable workspace for calling GETRF and GETRS
     bool optim_mem;
@@ -89,13 +90,13 @@ rocblas_status rocsolver_gesv_outofplace_impl(rocblas_handle handle,
         &size_pivotval, &size_pivotidx, &size_iipiv, &size_iinfo, &optim_mem);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work1, size_work2,
+        return rocblas_set_optimal_device_memory_size(handle, size_t(0), size_work1, size_work2,
                                                       size_work3, size_work4, size_pivotval,
                                                       size_pivotidx, size_iipiv, size_iinfo);
 
     // memory workspace allocation
     void *scalars, *work1, *work2, *work3, *work4, *pivotval, *pivotidx, *iinfo, *iipiv;
-    rocblas_device_malloc mem(handle, size_scalars, size_work1, size_work2, size_work3, size_work4,
+    rocblas_device_malloc mem(handle, size_t(0), size_work1, size_work2, size_work3, size_work4,
                               size_pivotval, size_pivotidx, size_iipiv, size_iinfo);
 
     if(!mem)
@@ -111,13 +112,13 @@ rocblas_status rocsolver_gesv_outofplace_impl(rocblas_handle handle,
     iipiv = mem[7];
     iinfo = mem[8];
     if(size_scalars > 0)
-        init_scalars(handle, (T*)scalars);
+        ROCBLAS_CHECK(set_device_scalars<T>(scalars));
 
     // execution
-    return rocsolver_gesv_outofplace_template<false, false, T>(
+    return _info_summary_scope.commit(rocsolver_gesv_outofplace_template<false, false, T>(
         handle, n, nrhs, A, shiftA, lda, strideA, ipiv, strideP, B, shiftB, ldb, strideB, X, shiftX,
         ldx, strideX, info, batch_count, (T*)scalars, work1, work2, work3, work4, (T*)pivotval,
-        (rocblas_int*)pivotidx, (rocblas_int*)iipiv, (rocblas_int*)iinfo, optim_mem);
+        (rocblas_int*)pivotidx, (rocblas_int*)iipiv, (rocblas_int*)iinfo, optim_mem));
 }
 
 ROCSOLVER_END_NAMESPACE
@@ -32,6 +32,7 @@
 
 #pragma once
 
+#include "lib_memory_primitives.hpp"
 #include "rocblas.hpp"
 #include "roclapack_getrf.hpp"
 #include "roclapack_getrs.hpp"
@@ -176,8 +177,6 @@ rocblas_status rocsolver_gesv_outofplace_template(rocblas_handle handle,
         return rocblas_status_success;
 
     // constants in host memory
-    const rocblas_int copyblocksx = (n - 1) / 32 + 1;
-    const rocblas_int copyblocksy = (nrhs - 1) / 32 + 1;
 
     // compute LU factorization of A
     rocsolver_getrf_template<BATCHED, STRIDED, T>(
@@ -185,8 +184,8 @@ rocblas_status rocsolver_gesv_outofplace_template(rocblas_handle handle,
         work1, work2, work3, work4, pivotval, pivotidx, iipiv, iinfo, optim_mem, true);
 
     // copy B to X
-    ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, dim3(copyblocksx, copyblocksy, batch_count), dim3(32, 32),
-                            0, stream, n, nrhs, B, shiftB, ldb, strideB, X, shiftX, ldx, strideX);
+    launch_copy_mat<T>(handle, n, nrhs, B, shiftB, ldb, strideB, X, shiftX, ldx, strideX,
+                       batch_count);
 
     // solve AX = B
     rocsolver_getrs_template<BATCHED, STRIDED, T>(
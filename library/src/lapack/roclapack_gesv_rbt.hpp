@@ -0,0 +1,455 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "roclapack_getrf.hpp"
+#include "roclapack_getrs.hpp"
+#include "rocsolver/rocsolver.h"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/** GESV_RBT_SEED is the seed used to generate the random butterflies **/
+#define GESV_RBT_SEED 0x2545F4914F6CDD1DULL
+
+/** The butterfly transforms have depth 2, so the matrices are (virtually) extended with the
+    identity up to the next multiple of 4 **/
+inline rocblas_int gesv_rbt_size(const rocblas_int n)
+{
+    return ((n - 1) / 4 + 1) * 4;
+}
+
+/** GESV_RBT_DIAG returns the entry i of the diagonal that defines the butterfly of the given
+    level (0 is the outer one) of U (side = 0) or V (side = 1). The entries are exp(r/10), with r
+    uniform in [-1/2, 1/2), and are the same for all the problems in the batch **/
+template <typename S>
+__device__ S gesv_rbt_diag(const int side, const int level, const rocblas_int i)
+{
+    uint64_t r = hash64(GESV_RBT_SEED + (static_cast<uint64_t>(2 * side + level) << 32) + i);
+    double u = (r >> 11) / 9007199254740992.0;
+    return S(exp((u - 0.5) / 10.0));
+}
+
+/** GESV_RBT_PAIR applies a butterfly B = [R0 R1; R0 -R1] / sqrt(2) to the entries x and y at
+    positions p and p + h of a vector, where d0 and d1 are the entries p and p + h of the diagonal
+    of B. If !BACKWARD, it computes B' * [x; y] (which is also the update of the entries p and
+    p + h of a row multiplied by B); otherwise it computes B * [x; y] **/
+template <bool BACKWARD, typename T, typename S>
+__device__ void gesv_rbt_pair(T& x, T& y, const S d0, const S d1)
+{
+    const S c = S(0.70710678118654752440);
+
+    if(BACKWARD)
+    {
+        T a = x * T(d0 * c);
+        T b = y * T(d1 * c);
+        x = a + b;
+        y = a - b;
+    }
+    else
+    {
+        T a = x + y;
+        T b = x - y;
+        x = a * T(d0 * c);
+        y = b * T(d1 * c);
+    }
+}
+
+/** GESV_RBT_APPLY4 applies the recursive butterfly of depth 2 of the given side to the entries
+    i, i + q, i + 2q and i + 3q of a vector of size 4q. If !BACKWARD, the outer level is applied
+    before the inner one (transposed butterfly); otherwise, the inner level is applied first **/
+template <bool BACKWARD, typename T, typename S>
+__device__ void gesv_rbt_apply4(T& v0,
+                                T& v1,
+                                T& v2,
+                                T& v3,
+                                const int side,
+                                const rocblas_int i,
+                                const rocblas_int q)
+{
+    const S o0 = gesv_rbt_diag<S>(side, 0, i);
+    const S o1 = gesv_rbt_diag<S>(side, 0, i + q);
+    const S o2 = gesv_rbt_diag<S>(side, 0, i + 2 * q);
+    const S o3 = gesv_rbt_diag<S>(side, 0, i + 3 * q);
+    const S n0 = gesv_rbt_diag<S>(side, 1, i);
+    const S n1 = gesv_rbt_diag<S>(side, 1, i + q);
+    const S n2 = gesv_rbt_diag<S>(side, 1, i + 2 * q);
+    const S n3 = gesv_rbt_diag<S>(side, 1, i + 3 * q);
+
+    if(!BACKWARD)
+    {
+        gesv_rbt_pair<false>(v0, v2, o0, o2);
+        gesv_rbt_pair<false>(v1, v3, o1, o3);
+        gesv_rbt_pair<false>(v0, v1, n0, n1);
+        gesv_rbt_pair<false>(v2, v3, n2, n3);
+    }
+    else
+    {
+        gesv_rbt_pair<true>(v0, v1, n0, n1);
+        gesv_rbt_pair<true>(v2, v3, n2, n3);
+        gesv_rbt_pair<true>(v0, v2, o0, o2);
+        gesv_rbt_pair<true>(v1, v3, o1, o3);
+    }
+}
+
+/** GESV_RBT_MATRIX computes W = U' * A * V, where the n-by-n matrices A are extended with the
+    identity to size nn = 4q. Each thread reads once and writes once the 16 entries of rows
+    {i, i + q, i + 2q, i + 3q} and columns {j, j + q, j + 2q, j + 3q}, applying both levels of
+    both butterflies in registers **/
+template <typename T, typename S, typename U>
+ROCSOLVER_KERNEL void gesv_rbt_matrix(const rocblas_int n,
+                                      const rocblas_int nn,
+                                      U A,
+                                      const rocblas_int shiftA,
+                                      const rocblas_int lda,
+                                      const rocblas_stride strideA,
+                                      T* W,
+                                      const rocblas_int ldw,
+                                      const rocblas_stride strideW)
+{
+    const auto b = hipBlockIdx_z;
+    const rocblas_int j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+    const rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const rocblas_int q = nn / 4;
+
+    if(i < q && j < q)
+    {
+        T* Ap = load_ptr_batch<T>(A, b, shiftA, strideA);
+        T* Wp = W + b * strideW;
+        T a[4][4];
+
+        for(int k = 0; k < 4; k++)
+        {
+            for(int l = 0; l < 4; l++)
+            {
+                rocblas_int r = i + k * q;
+                rocblas_int c = j + l * q;
+                if(r < n && c < n)
+                    a[k][l] = Ap[r + c * int64_t(lda)];
+                else
+                    a[k][l] = (r == c ? T(1) : T(0));
+            }
+        }
+
+        // rows (U') and columns (V)
+        for(int l = 0; l < 4; l++)
+            gesv_rbt_apply4<false, T, S>(a[0][l], a[1][l], a[2][l], a[3][l], 0, i, q);
+        for(int k = 0; k < 4; k++)
+            gesv_rbt_apply4<false, T, S>(a[k][0], a[k][1], a[k][2], a[k][3], 1, j, q);
+
+        for(int k = 0; k < 4; k++)
+            for(int l = 0; l < 4; l++)
+                Wp[(i + k * q) + (j + l * q) * int64_t(ldw)] = a[k][l];
+    }
+}
+
+/** GESV_RBT_LEFT computes Y = U' * B, where the n-by-nrhs matrices B are extended with zeros to
+    nn = 4q rows **/
+template <typename T, typename S, typename U>
+ROCSOLVER_KERNEL void gesv_rbt_left(const rocblas_int n,
+                                    const rocblas_int nn,
+                                    const rocblas_int nrhs,
+                                    U B,
+                                    const rocblas_int shiftB,
+                                    const rocblas_int ldb,
+                                    const rocblas_stride strideB,
+                                    T* Y,
+                                    const rocblas_int ldy,
+                                    const rocblas_stride strideY)
+{
+    const auto b = hipBlockIdx_z;
+    const rocblas_int j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+    const rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const rocblas_int q = nn / 4;
+
+    if(i < q && j < nrhs)
+    {
+        T* Bp = load_ptr_batch<T>(B, b, shiftB, strideB) + j * int64_t(ldb);
+        T* Yp = Y + b * strideY + j * int64_t(ldy);
+        T v[4];
+
+        for(int k = 0; k < 4; k++)
+            v[k] = (i + k * q < n) ? Bp[i + k * q] : T(0);
+
+        gesv_rbt_apply4<false, T, S>(v[0], v[1], v[2], v[3], 0, i, q);
+
+        for(int k = 0; k < 4; k++)
+            Yp[i + k * q] = v[k];
+    }
+}
+
+/** GESV_RBT_RIGHT computes the first n rows of V * Y and writes them in X (if !ADD) or adds
+    them to W, which has the same layout as Y, and writes the result in X (if ADD). X can be the
+    same array as Y **/
+template <bool ADD, typename T, typename S, typename U>
+ROCSOLVER_KERNEL void gesv_rbt_right(const rocblas_int n,
+                                     const rocblas_int nn,
+                                     const rocblas_int nrhs,
+                                     T* Y,
+                                     const rocblas_int ldy,
+                                     const rocblas_stride strideY,
+                                     T* W,
+                                     U X,
+                                     const rocblas_int shiftX,
+                                     const rocblas_int ldx,
+                                     const rocblas_stride strideX)
+{
+    const auto b = hipBlockIdx_z;
+    const rocblas_int j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+    const rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const rocblas_int q = nn / 4;
+
+    if(i < q && j < nrhs)
+    {
+        T* Yp = Y + b * strideY + j * int64_t(ldy);
+        T* Xp = load_ptr_batch<T>(X, b, shiftX, strideX) + j * int64_t(ldx);
+        T v[4];
+
+        for(int k = 0; k < 4; k++)
+            v[k] = Yp[i + k * q];
+
+        gesv_rbt_apply4<true, T, S>(v[0], v[1], v[2], v[3], 1, i, q);
+
+        for(int k = 0; k < 4; k++)
+        {
+            if(i + k * q < n)
+            {
+                if(ADD)
+                    v[k] += W[b * strideY + j * int64_t(ldy) + i + k * q];
+                Xp[i + k * q] = v[k];
+            }
+        }
+    }
+}
+
+template <typename T>
+rocblas_status rocsolver_gesv_rbt_argCheck(rocblas_handle handle,
+                                           const rocblas_int n,
+                                           const rocblas_int nrhs,
+                                           const rocblas_int lda,
+                                           const rocblas_int ldb,
+                                           T A,
+                                           T B,
+                                           const rocblas_int* info,
+                                           const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    if(n < 0 || nrhs < 0 || lda < n || ldb < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !A) || (nrhs * n && !B) || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void rocsolver_gesv_rbt_getMemorySize(const rocblas_int n,
+                                      const rocblas_int nrhs,
+                                      const rocblas_int batch_count,
+                                      size_t* size_scalars,
+                                      size_t* size_work1,
+                                      size_t* size_work2,
+                                      size_t* size_work3,
+                                      size_t* size_work4,
+                                      size_t* size_pivotval,
+                                      size_t* size_pivotidx,
+                                      size_t* size_iipiv,
+                                      size_t* size_iinfo,
+                                      size_t* size_W,
+                                      size_t* size_Y,
+                                      size_t* size_workArr,
+                                      bool* optim_mem)
+{
+    // if quick return, no workspace is needed
+    if(n == 0 || nrhs == 0 || batch_count == 0)
+    {
+        *size_scalars = 0;
+        *size_work1 = 0;
+        *size_work2 = 0;
+        *size_work3 = 0;
+        *size_work4 = 0;
+        *size_pivotval = 0;
+        *size_pivotidx = 0;
+        *size_iipiv = 0;
+        *size_iinfo = 0;
+        *size_W = 0;
+        *size_Y = 0;
+        *size_workArr = 0;
+        *optim_mem = true;
+        return;
+    }
+
+    const rocblas_int nn = gesv_rbt_size(n);
+    bool opt1, opt2;
+    size_t w1, w2, w3, w4;
+
+    // workspace required for calling GETRF_NPVT and GETRS on the transformed matrices
+    // (which are always strided)
+    rocsolver_getrf_getMemorySize<false, true, T>(nn, nn, false, batch_count, size_scalars,
+                                                  size_work1, size_work2, size_work3, size_work4,
+                                                  size_pivotval, size_pivotidx, size_iipiv,
+                                                  size_iinfo, &opt1);
+
+    rocsolver_getrs_getMemorySize<false, true, T>(rocblas_operation_none, nn, nrhs, batch_count,
+                                                  &w1, &w2, &w3, &w4, &opt2);
+
+    *size_work1 = std::max(*size_work1, w1);
+    *size_work2 = std::max(*size_work2, w2);
+    *size_work3 = std::max(*size_work3, w3);
+    *size_work4 = std::max(*size_work4, w4);
+    *optim_mem = opt1 && opt2;
+
+    // transformed matrices, and transformed right-hand sides of the system and of the
+    // refinement step
+    *size_W = sizeof(T) * nn * nn * batch_count;
+    *size_Y = sizeof(T) * nn * nrhs * batch_count * 2;
+
+    // array of pointers to compute the residuals with the batched matrices
+    *size_workArr = BATCHED ? sizeof(T*) * batch_count : 0;
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename U>
+rocblas_status rocsolver_gesv_rbt_template(rocblas_handle handle,
+                                           const rocblas_int n,
+                                           const rocblas_int nrhs,
+                                           U A,
+                                           const rocblas_int shiftA,
+                                           const rocblas_int lda,
+                                           const rocblas_stride strideA,
+                                           U B,
+                                           const rocblas_int shiftB,
+                                           const rocblas_int ldb,
+                                           const rocblas_stride strideB,
+                                           rocblas_int* info,
+                                           const rocblas_int batch_count,
+                                           T* scalars,
+                                           void* work1,
+                                           void* work2,
+                                           void* work3,
+                                           void* work4,
+                                           T* pivotval,
+                                           rocblas_int* pivotidx,
+                                           rocblas_int* iipiv,
+                                           rocblas_int* iinfo,
+                                           T* W,
+                                           T* Y,
+                                           T** workArr,
+                                           bool optim_mem)
+{
+    ROCSOLVER_ENTER("gesv_rbt", "n:", n, "nrhs:", nrhs, "shiftA:", shiftA, "lda:", lda,
+                    "shiftB:", shiftB, "ldb:", ldb, "bc:", batch_count);
+
+    using S = decltype(std::real(T{}));
+
+    // quick return if zero instances in batch
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocksReset = (batch_count - 1) / BS1 + 1;
+    dim3 gridReset(blocksReset, 1, 1);
+    dim3 threads(BS1, 1, 1);
+
+    // info=0 (starting with a nonsingular matrix)
+    ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, info, batch_count, 0);
+
+    // quick return if A or B are empty
+    if(n == 0 || nrhs == 0)
+        return rocblas_status_success;
+
+    // everything must be executed with scalars on the host
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+    T one = 1;
+    T minone = -1;
+
+    const rocblas_int nn = gesv_rbt_size(n);
+    const rocblas_int q = nn / 4;
+    const rocblas_stride strideW = rocblas_stride(nn) * nn;
+    const rocblas_stride strideY = rocblas_stride(nn) * nrhs;
+    T* Z = Y + strideY * batch_count;
+
+    const rocblas_int blocksx = (q - 1) / BS2 + 1;
+    const rocblas_int blocksy = (q - 1) / (BS2 / 4) + 1;
+    const rocblas_int blocksb = (nrhs - 1) / (BS2 / 4) + 1;
+    const dim3 gridA(blocksx, blocksy, batch_count);
+    const dim3 gridB(blocksx, blocksb, batch_count);
+    const dim3 threads2(BS2, BS2 / 4, 1);
+
+    // transform and factorize the matrices without pivoting
+    ROCSOLVER_LAUNCH_KERNEL((gesv_rbt_matrix<T, S>), gridA, threads2, 0, stream, n, nn, A, shiftA,
+                            lda, strideA, W, nn, strideW);
+    rocsolver_getrf_template<false, true, T>(handle, nn, nn, W, 0, 1, nn, strideW,
+                                             (rocblas_int*)nullptr, 0, 0, info, batch_count,
+                                             scalars, work1, work2, work3, work4, pivotval,
+                                             pivotidx, iipiv, iinfo, optim_mem, false);
+
+    // first solution X = V * inv(U' * A * V) * U' * B (kept in Y)
+    ROCSOLVER_LAUNCH_KERNEL((gesv_rbt_left<T, S>), gridB, threads2, 0, stream, n, nn, nrhs, B,
+                            shiftB, ldb, strideB, Y, nn, strideY);
+    rocsolver_getrs_template<false, true, T>(handle, rocblas_operation_none, nn, nrhs, W, 0, 1, nn,
+                                             strideW, (rocblas_int*)nullptr, 0, Y, 0, 1, nn,
+                                             strideY, batch_count, work1, work2, work3, work4,
+                                             optim_mem, false);
+    ROCSOLVER_LAUNCH_KERNEL((gesv_rbt_right<false, T, S>), gridB, threads2, 0, stream, n, nn, nrhs,
+                            Y, nn, strideY, (T*)nullptr, Y, 0, nn, strideY);
+
+    // one step of iterative refinement: compute the residuals R = B - A * X (overwriting B),
+    // solve the transformed system for the correction C, and set B = X + C
+    rocblasCall_gemm(handle, rocblas_operation_none, rocblas_operation_none, n, nrhs, n, &minone,
+                     A, shiftA, lda, strideA, Y, 0, nn, strideY, &one, B, shiftB, ldb, strideB,
+                     batch_count, workArr);
+
+    ROCSOLVER_LAUNCH_KERNEL((gesv_rbt_left<T, S>), gridB, threads2, 0, stream, n, nn, nrhs, B,
+                            shiftB, ldb, strideB, Z, nn, strideY);
+    rocsolver_getrs_template<false, true, T>(handle, rocblas_operation_none, nn, nrhs, W, 0, 1, nn,
+                                             strideW, (rocblas_int*)nullptr, 0, Z, 0, 1, nn,
+                                             strideY, batch_count, work1, work2, work3, work4,
+                                             optim_mem, false);
+    ROCSOLVER_LAUNCH_KERNEL((gesv_rbt_right<true, T, S>), gridB, threads2, 0, stream, n, nn, nrhs,
+                            Z, nn, strideY, Y, B, shiftB, ldb, strideB);
+
+    rocblas_set_pointer_mode(handle, old_mode);
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
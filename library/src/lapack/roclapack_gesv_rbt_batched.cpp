@@ -0,0 +1,184 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "roclapack_gesv_rbt.hpp"
+#include "rocsolver_check_mode.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+template <typename T, typename U>
+rocblas_status rocsolver_gesv_rbt_batched_impl(rocblas_handle handle,
+                                               const rocblas_int n,
+                                               const rocblas_int nrhs,
+                                               U A,
+                                               const rocblas_int lda,
+                                               U B,
+                                               const rocblas_int ldb,
+                                               rocblas_int* info,
+                                               const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER_TOP("gesv_rbt_batched", "-n", n, "--nrhs", nrhs, "--lda", lda, "--ldb", ldb,
+                        "--batch_count", batch_count);
+    ROCSOLVER_INFO_SUMMARY(info, batch_count);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking (unless disabled with rocsolver_set_check_mode)
+    if(!skip_arg_checks(handle))
+    {
+        rocblas_status st = rocsolver_gesv_rbt_argCheck(handle, n, nrhs, lda, ldb, A, B, info,
+                                                        batch_count);
+        if(st != rocblas_status_continue)
+            return st;
+    }
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+    rocblas_int shiftB = 0;
+
+    // batched execution
+    rocblas_stride strideA = 0;
+    rocblas_stride strideB = 0;
+
+    // memory workspace sizes:
+    // constants in rocblas calls (only whether they are needed, see set_device_scalars)
+    size_t size_scalars;
+    // size of reusable workspace (and for calling GETRF and GETRS)
+    bool optim_mem;
+    size_t size_work1, size_work2, size_work3, size_work4;
+    // extra requirements for calling GETRF
+    size_t size_pivotval, size_pivotidx, size_iipiv, size_iinfo;
+    // size of the transformed matrices and right-hand sides
+    size_t size_W, size_Y;
+    // size of array of pointers (only for batched case)
+    size_t size_workArr;
+    rocsolver_gesv_rbt_getMemorySize<true, false, T>(
+        n, nrhs, batch_count, &size_scalars, &size_work1, &size_work2, &size_work3, &size_work4,
+        &size_pivotval, &size_pivotidx, &size_iipiv, &size_iinfo, &size_W, &size_Y, &size_workArr,
+        &optim_mem);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(
+            handle, size_t(0), size_work1, size_work2, size_work3, size_work4, size_pivotval,
+            size_pivotidx, size_iipiv, size_iinfo, size_W, size_Y, size_workArr);
+
+    // memory workspace allocation
+    void *scalars, *work1, *work2, *work3, *work4, *pivotval, *pivotidx, *iipiv, *iinfo, *W, *Y,
+        *workArr;
+    rocblas_device_malloc mem(
+        handle, size_t(0), size_work1, size_work2, size_work3, size_work4, size_pivotval,
+        size_pivotidx, size_iipiv, size_iinfo, size_W, size_Y, size_workArr);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    scalars = mem[0];
+    work1 = mem[1];
+    work2 = mem[2];
+    work3 = mem[3];
+    work4 = mem[4];
+    pivotval = mem[5];
+    pivotidx = mem[6];
+    iipiv = mem[7];
+    iinfo = mem[8];
+    W = mem[9];
+    Y = mem[10];
+    workArr = mem[11];
+    if(size_scalars > 0)
+        ROCBLAS_CHECK(set_device_scalars<T>(scalars));
+
+    // execution
+    return _info_summary_scope.commit(rocsolver_gesv_rbt_template<true, false, T>(
+        handle, n, nrhs, A, shiftA, lda, strideA, B, shiftB, ldb, strideB, info, batch_count,
+        (T*)scalars, work1, work2, work3, work4, (T*)pivotval, (rocblas_int*)pivotidx,
+        (rocblas_int*)iipiv, (rocblas_int*)iinfo, (T*)W, (T*)Y, (T**)workArr, optim_mem));
+}
+
+ROCSOLVER_END_NAMESPACE
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocblas_status rocsolver_sgesv_rbt_batched(rocblas_handle handle,
+                                                      const rocblas_int n,
+                                                      const rocblas_int nrhs,
+                                                      float* const A[],
+                                                      const rocblas_int lda,
+                                                      float* const B[],
+                                                      const rocblas_int ldb,
+                                                      rocblas_int* info,
+                                                      const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_gesv_rbt_batched_impl<float>(handle, n, nrhs, A, lda, B, ldb, info,
+                                                             batch_count);
+}
+
+extern "C" rocblas_status rocsolver_dgesv_rbt_batched(rocblas_handle handle,
+                                                      const rocblas_int n,
+                                                      const rocblas_int nrhs,
+                                                      double* const A[],
+                                                      const rocblas_int lda,
+                                                      double* const B[],
+                                                      const rocblas_int ldb,
+                                                      rocblas_int* info,
+                                                      const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_gesv_rbt_batched_impl<double>(handle, n, nrhs, A, lda, B, ldb, info,
+                                                              batch_count);
+}
+
+extern "C" rocblas_status rocsolver_cgesv_rbt_batched(rocblas_handle handle,
+                                                      const rocblas_int n,
+                                                      const rocblas_int nrhs,
+                                                      rocblas_float_complex* const A[],
+                                                      const rocblas_int lda,
+                                                      rocblas_float_complex* const B[],
+                                                      const rocblas_int ldb,
+                                                      rocblas_int* info,
+                                                      const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_gesv_rbt_batched_impl<rocblas_float_complex>(
+        handle, n, nrhs, A, lda, B, ldb, info, batch_count);
+}
+
+extern "C" rocblas_status rocsolver_zgesv_rbt_batched(rocblas_handle handle,
+                                                      const rocblas_int n,
+                                                      const rocblas_int nrhs,
+                                                      rocblas_double_complex* const A[],
+                                                      const rocblas_int lda,
+                                                      rocblas_double_complex* const B[],
+                                                      const rocblas_int ldb,
+                                                      rocblas_int* info,
+                                                      const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_gesv_rbt_batched_impl<rocblas_double_complex>(
+        handle, n, nrhs, A, lda, B, ldb, info, batch_count);
+}
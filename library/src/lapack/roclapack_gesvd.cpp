@@ -48,6 +48,7 @@ rocblas_status rocsolver_gesvd_impl(rocblas_handle handle,
 {
     ROCSOLVER_ENTER_TOP("gesvd", "--left_svect", left_svect, "--right_svect", right_svect, "-m", m,
                         "-n", n, "--lda", lda, "--ldu", ldu, "--ldv", ldv, "--fast_alg", fast_alg);
+    ROCSOLVER_INFO_SUMMARY(info, 1);
 
     if(!handle)
         return rocblas_status_invalid_handle;
@@ -69,8 +70,15 @@ rocblas_status rocsolver_gesvd_impl(rocblas_handle handle,
     rocblas_stride strideE = 0;
     rocblas_int batch_count = 1;
 
+    // algorithm used for the SVD of the bidiagonal form
+    rocsolver_alg_mode alg_mode = get_alg_mode(handle, rocsolver_function_gesvd);
+
+    // work mode (rocblas_auto is resolved with the memory available to the handle)
+    const rocblas_workmode workmode = rocsolver_gesvd_workmode<false, T, TT>(
+        handle, left_svect, right_svect, m, n, batch_count, fast_alg, alg_mode);
+
     // memory workspace sizes:
-    // size for constants in rocblas calls
+    // constants in rocblas calls (only whether they are needed, see set_device_scalars)
     size_t size_scalars;
     // size of reusable workspace and array of pointers (batched case)
     size_t size_work_workArr;
@@ -84,19 +92,19 @@ rocblas_status rocsolver_gesvd_impl(rocblas_handle handle,
     size_t size_workArr;
 
     rocsolver_gesvd_getMemorySize<false, T, TT>(
-        left_svect, right_svect, m, n, batch_count, fast_alg, &size_scalars, &size_work_workArr,
-        &size_Abyx_norms_tmptr, &size_Abyx_norms_trfact_X, &size_diag_tmptr_Y, &size_tau_splits,
-        &size_tempArrayT, &size_tempArrayC, &size_workArr);
+        left_svect, right_svect, m, n, batch_count, workmode, alg_mode, &size_scalars,
+        &size_work_workArr, &size_Abyx_norms_tmptr, &size_Abyx_norms_trfact_X, &size_diag_tmptr_Y,
+        &size_tau_splits, &size_tempArrayT, &size_tempArrayC, &size_workArr);
 
     if(rocblas_is_device_memory_size_query(handle))
         return rocblas_set_optimal_device_memory_size(
-            handle, size_scalars, size_work_workArr, size_Abyx_norms_tmptr, size_Abyx_norms_trfact_X,
+            handle, size_t(0), size_work_workArr, size_Abyx_norms_tmptr, size_Abyx_norms_trfact_X,
             size_diag_tmptr_Y, size_tau_splits, size_tempArrayT, size_tempArrayC, size_workArr);
 
     // memory workspace allocation
     void *scalars, *work_workArr, *Abyx_norms_tmptr, *Abyx_norms_trfact_X, *diag_tmptr_Y, *tau_splits;
     void *tempArrayT, *tempArrayC, *workArr;
-    rocblas_device_malloc mem(handle, size_scalars, size_work_workArr, size_Abyx_norms_tmptr,
+    rocblas_device_malloc mem(handle, size_t(0), size_work_workArr, size_Abyx_norms_tmptr,
                               size_Abyx_norms_trfact_X, size_diag_tmptr_Y, size_tau_splits,
                               size_tempArrayT, size_tempArrayC, size_workArr);
 
@@ -113,14 +121,14 @@ rocblas_status rocsolver_gesvd_impl(rocblas_handle handle,
     tempArrayC = mem[7];
     workArr = mem[8];
     if(size_scalars > 0)
-        init_scalars(handle, (T*)scalars);
+        ROCBLAS_CHECK(set_device_scalars<T>(scalars));
 
     // execution
-    return rocsolver_gesvd_template<false, false, T>(
+    return _info_summary_scope.commit(rocsolver_gesvd_template<false, false, T>(
         handle, left_svect, right_svect, m, n, A, shiftA, lda, strideA, S, strideS, U, ldu, strideU,
-        V, ldv, strideV, E, strideE, fast_alg, info, batch_count, (T*)scalars, work_workArr,
-        (T*)Abyx_norms_tmptr, (T*)Abyx_norms_trfact_X, (T*)diag_tmptr_Y, (T*)tau_splits,
-        (T*)tempArrayT, (T*)tempArrayC, (T**)workArr);
+        V, ldv, strideV, E, strideE, workmode, alg_mode, info, batch_count, (T*)scalars,
+        work_workArr, (T*)Abyx_norms_tmptr, (T*)Abyx_norms_trfact_X, (T*)diag_tmptr_Y,
+        (T*)tau_splits, (T*)tempArrayT, (T*)tempArrayC, (T**)workArr));
 }
 
 ROCSOLVER_END_NAMESPACE
@@ -32,14 +32,18 @@
 
 #pragma once
 
+#include "auxiliary/rocauxiliary_bdsdc.hpp"
 #include "auxiliary/rocauxiliary_bdsqr.hpp"
 #include "auxiliary/rocauxiliary_orgbr_ungbr.hpp"
 #include "auxiliary/rocauxiliary_ormbr_unmbr.hpp"
+#include "lib_memory_primitives.hpp"
 #include "rocblas.hpp"
 #include "roclapack_gebrd.hpp"
+#include "roclapack_gebrd_2stage.hpp"
 #include "roclapack_gelqf.hpp"
 #include "roclapack_geqrf.hpp"
 #include "rocsolver/rocsolver.h"
+#include "rocsolver_alg_mode.hpp"
 
 ROCSOLVER_BEGIN_NAMESPACE
 
@@ -104,6 +108,47 @@ void local_geqrlq_template(rocblas_handle handle,
 }
 
 /** Argument checking **/
+/** wrapper to BDSQR/BDSDC_TEMPLATE **/
+template <typename T, typename S, typename W1, typename W2, typename W3>
+void local_bdsvd_template(rocblas_handle handle,
+                          const bool dc,
+                          const bool hybrid,
+                          const rocblas_fill uplo,
+                          const rocblas_int n,
+                          const rocblas_int nv,
+                          const rocblas_int nu,
+                          const rocblas_int nc,
+                          S* D,
+                          const rocblas_stride strideD,
+                          S* E,
+                          const rocblas_stride strideE,
+                          W1 V,
+                          const rocblas_int shiftV,
+                          const rocblas_int ldv,
+                          const rocblas_stride strideV,
+                          W2 U,
+                          const rocblas_int shiftU,
+                          const rocblas_int ldu,
+                          const rocblas_stride strideU,
+                          W3 C,
+                          const rocblas_int shiftC,
+                          const rocblas_int ldc,
+                          const rocblas_stride strideC,
+                          rocblas_int* info,
+                          const rocblas_int batch_count,
+                          rocblas_int* splits_map,
+                          S* work)
+{
+    if(dc)
+        rocsolver_bdsdc_template<T>(handle, uplo, n, nv, nu, nc, D, strideD, E, strideE, V, shiftV,
+                                    ldv, strideV, U, shiftU, ldu, strideU, C, shiftC, ldc, strideC,
+                                    info, batch_count, splits_map, work);
+    else
+        rocsolver_bdsqr_template<T>(handle, uplo, n, nv, nu, nc, D, strideD, E, strideE, V, shiftV,
+                                    ldv, strideV, U, shiftU, ldu, strideU, C, shiftC, ldc, strideC,
+                                    info, batch_count, splits_map, work, hybrid);
+}
+
 template <typename T, typename TT, typename W>
 rocblas_status rocsolver_gesvd_argCheck(rocblas_handle handle,
                                         const rocblas_svect left_svect,
@@ -165,6 +210,7 @@ void rocsolver_gesvd_getMemorySize(const rocblas_svect left_svect,
                                    const rocblas_int n,
                                    const rocblas_int batch_count,
                                    const rocblas_workmode fast_alg,
+                                   const rocsolver_alg_mode alg_mode,
                                    size_t* size_scalars,
                                    size_t* size_work_workArr,
                                    size_t* size_Abyx_norms_tmptr,
@@ -216,6 +262,10 @@ void rocsolver_gesvd_getMemorySize(const rocblas_svect left_svect,
     const bool othervN = !row ? leftvN : rightvN;
     const bool thinSVD = (m >= THIN_SVD_SWITCH * n || n >= THIN_SVD_SWITCH * m);
     const bool fast_thinSVD = (thinSVD && fast_alg == rocblas_outofplace);
+    const bool dc = (alg_mode == rocsolver_alg_mode_dc);
+    const bool hybrid = (alg_mode == rocsolver_alg_mode_hybrid);
+    const bool twostage = (leftvN && rightvN && std::min(m, n) >= GEBRD_2STAGE_SWITCHSIZE
+                           && (thinSVD || row));
 
     // auxiliary sizes and variables
     const rocblas_int k = std::min(m, n);
@@ -240,7 +290,15 @@ void rocsolver_gesvd_getMemorySize(const rocblas_svect left_svect,
         = (fast_thinSVD && (othervN || othervO || leadvO)) ? sizeof(T) * m * n * batch_count : 0;
 
     // workspace required for the bidiagonalization
-    if(thinSVD)
+    if(twostage)
+    {
+        size_t wa;
+        rocsolver_gebrd_2stage_getMemorySize<BATCHED, T>(thinSVD ? k : m, thinSVD ? k : n,
+                                                         batch_count, size_scalars, &w[0], &x[0],
+                                                         &y[0], &wa, &a[0]);
+        *size_workArr = std::max(*size_workArr, wa);
+    }
+    else if(thinSVD)
         rocsolver_gebrd_getMemorySize<BATCHED, T>(k, k, batch_count, size_scalars, &w[0], &a[0],
                                                   &x[0], &y[0]);
     else
@@ -248,7 +306,11 @@ void rocsolver_gesvd_getMemorySize(const rocblas_svect left_svect,
                                                   &x[0], &y[0]);
 
     // workspace required for the SVD of the bidiagonal form
-    rocsolver_bdsqr_getMemorySize<S>(k, nv, nu, 0, batch_count, size_tau_splits, &w[1]);
+    if(dc)
+        rocsolver_bdsdc_getMemorySize<T, S>(k, nv, nu, 0, batch_count, size_tau_splits, &w[1]);
+    else
+        rocsolver_bdsqr_getMemorySize<S>(k, nv, nu, 0, batch_count, size_tau_splits, &w[1],
+                                         hybrid);
 
     // size of array tau to store householder scalars on intermediate
     // orthonormal/unitary matrices
@@ -329,6 +391,31 @@ void rocsolver_gesvd_getMemorySize(const rocblas_svect left_svect,
     *size_diag_tmptr_Y = *std::max_element(std::begin(y), std::end(y));
 }
 
+/** Resolves the work mode fast_alg of GESVD (see select_workmode); with rocblas_auto, the
+    fast thin-SVD is used if the workspace it requires can be obtained. **/
+template <bool BATCHED, typename T, typename S>
+rocblas_workmode rocsolver_gesvd_workmode(rocblas_handle handle,
+                                          const rocblas_svect left_svect,
+                                          const rocblas_svect right_svect,
+                                          const rocblas_int m,
+                                          const rocblas_int n,
+                                          const rocblas_int batch_count,
+                                          const rocblas_workmode fast_alg,
+                                          const rocsolver_alg_mode alg_mode)
+{
+    size_t sizes[9] = {0, 0, 0, 0, 0, 0, 0, 0, 0};
+    if(fast_alg == rocblas_auto)
+        rocsolver_gesvd_getMemorySize<BATCHED, T, S>(
+            left_svect, right_svect, m, n, batch_count, rocblas_outofplace, alg_mode, &sizes[0],
+            &sizes[1], &sizes[2], &sizes[3], &sizes[4], &sizes[5], &sizes[6], &sizes[7], &sizes[8]);
+
+    size_t size = 0;
+    for(size_t sz : sizes)
+        size += sz;
+
+    return select_workmode(handle, fast_alg, size);
+}
+
 template <bool BATCHED, bool STRIDED, typename T, typename TT, typename W>
 rocblas_status rocsolver_gesvd_template(rocblas_handle handle,
                                         const rocblas_svect left_svect,
@@ -350,6 +437,7 @@ rocblas_status rocsolver_gesvd_template(rocblas_handle handle,
                                         TT* E,
                                         const rocblas_stride strideE,
                                         const rocblas_workmode fast_alg,
+                                        const rocsolver_alg_mode alg_mode,
                                         rocblas_int* info,
                                         const rocblas_int batch_count,
                                         T* scalars,
@@ -372,9 +460,6 @@ rocblas_status rocsolver_gesvd_template(rocblas_handle handle,
     if(n == 0 || m == 0 || batch_count == 0)
         return rocblas_status_success;
 
-    hipStream_t stream;
-    rocblas_get_stream(handle, &stream);
-
     // everything must be executed with scalars on the host
     rocblas_pointer_mode old_mode;
     rocblas_get_pointer_mode(handle, &old_mode);
@@ -404,6 +489,10 @@ rocblas_status rocsolver_gesvd_template(rocblas_handle handle,
     const bool othervN = !row ? leftvN : rightvN;
     const bool thinSVD = (m >= THIN_SVD_SWITCH * n || n >= THIN_SVD_SWITCH * m);
     const bool fast_thinSVD = (thinSVD && fast_alg == rocblas_outofplace);
+    const bool dc = (alg_mode == rocsolver_alg_mode_dc);
+    const bool hybrid = (alg_mode == rocsolver_alg_mode_hybrid);
+    const bool twostage = (leftvN && rightvN && std::min(m, n) >= GEBRD_2STAGE_SWITCHSIZE
+                           && (thinSVD || row));
 
     // auxiliary sizes and variables
     const rocblas_int k = std::min(m, n);
@@ -488,12 +577,6 @@ rocblas_status rocsolver_gesvd_template(rocblas_handle handle,
         trans = COMPLEX ? rocblas_operation_conjugate_transpose : rocblas_operation_transpose;
     }
 
-    // common block sizes and number of threads for internal kernels
-    constexpr rocblas_int thread_count = 32;
-    const rocblas_int blocks_m = (m - 1) / thread_count + 1;
-    const rocblas_int blocks_n = (n - 1) / thread_count + 1;
-    const rocblas_int blocks_k = (k - 1) / thread_count + 1;
-
     /** A thin SVD could be computed for matrices with sufficiently more rows than
         columns (or columns than rows) by starting with a QR factorization (or LQ
         factorization) and working with the triangular factor afterwards. When
@@ -522,15 +605,19 @@ rocblas_status rocsolver_gesvd_template(rocblas_handle handle,
 
             //*** STAGE 3: Bidiagonalization ***//
             // clean triangular factor
-            ROCSOLVER_LAUNCH_KERNEL(set_zero<T>, dim3(blocks_k, blocks_k, batch_count),
-                                    dim3(thread_count, thread_count, 1), 0, stream, k, k, A, shiftA,
-                                    lda, strideA, uplo);
+            launch_set_zero<T>(handle, k, k, A, shiftA, lda, strideA, batch_count, uplo);
 
-            rocsolver_gebrd_template<BATCHED, STRIDED>(
-                handle, k, k, A, shiftA, lda, strideA, S, strideS, E, strideE, tau_splits, k,
-                (tau_splits + k * batch_count), k, Abyx_norms_trfact_X, shiftX, ldx, strideX,
-                diag_tmptr_Y, shiftY, ldy, strideY, batch_count, scalars, work_workArr,
-                Abyx_norms_tmptr);
+            if(twostage)
+                rocsolver_gebrd_2stage_template<BATCHED, STRIDED>(
+                    handle, k, k, A, shiftA, lda, strideA, S, strideS, E, strideE, tau_splits, k,
+                    (tau_splits + k * batch_count), k, batch_count, scalars, work_workArr,
+                    Abyx_norms_trfact_X, diag_tmptr_Y, workArr, Abyx_norms_tmptr);
+            else
+                rocsolver_gebrd_template<BATCHED, STRIDED>(
+                    handle, k, k, A, shiftA, lda, strideA, S, strideS, E, strideE, tau_splits, k,
+                    (tau_splits + k * batch_count), k, Abyx_norms_trfact_X, shiftX, ldx, strideX,
+                    diag_tmptr_Y, shiftY, ldy, strideY, batch_count, scalars, work_workArr,
+                    Abyx_norms_tmptr);
 
             //*** STAGE 4: generate orthonormal/unitary matrices from bidiagonalization ***//
             if(!othervN)
@@ -541,23 +628,22 @@ rocblas_status rocsolver_gesvd_template(rocblas_handle handle,
 
             //*** STAGE 5: Compute singular values and vectors from the bidiagonal form ***//
             if(row)
-                rocsolver_bdsqr_template<T>(handle, rocblas_fill_upper, k, nv, nu, 0, S, strideS, E,
-                                            strideE, A, shiftA, lda, strideA, U, shiftU, ldu,
-                                            strideU, (W) nullptr, 0, 1, 1, info, batch_count,
-                                            (rocblas_int*)tau_splits, (TT*)work_workArr);
+                local_bdsvd_template<T>(handle, dc, hybrid, rocblas_fill_upper, k, nv, nu, 0, S,
+                                        strideS, E, strideE, A, shiftA, lda, strideA, U, shiftU,
+                                        ldu, strideU, (W) nullptr, 0, 1, 1, info, batch_count,
+                                        (rocblas_int*)tau_splits, (TT*)work_workArr);
             else
-                rocsolver_bdsqr_template<T>(handle, rocblas_fill_upper, k, nv, nu, 0, S, strideS, E,
-                                            strideE, V, shiftV, ldv, strideV, A, shiftA, lda,
-                                            strideA, (W) nullptr, 0, 1, 1, info, batch_count,
-                                            (rocblas_int*)tau_splits, (TT*)work_workArr);
+                local_bdsvd_template<T>(handle, dc, hybrid, rocblas_fill_upper, k, nv, nu, 0, S,
+                                        strideS, E, strideE, V, shiftV, ldv, strideV, A, shiftA,
+                                        lda, strideA, (W) nullptr, 0, 1, 1, info, batch_count,
+                                        (rocblas_int*)tau_splits, (TT*)work_workArr);
 
             //*** STAGE 6: update vectors with orthonormal/unitary matrices ***//
             if(othervS || othervA)
             {
                 mn = row ? n : m;
-                ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, dim3(blocks_m, blocks_n, batch_count),
-                                        dim3(thread_count, thread_count, 1), 0, stream, mn, mn, A,
-                                        shiftA, lda, strideA, bufferC, shiftC, ldc, strideC);
+                launch_copy_mat<T>(handle, mn, mn, A, shiftA, lda, strideA, bufferC, shiftC, ldc,
+                                   strideC, batch_count);
             }
         }
 
@@ -575,14 +661,12 @@ rocblas_status rocsolver_gesvd_template(rocblas_handle handle,
 
             if(leadvA)
                 // copy factorization to U or V when needed
-                ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, dim3(blocks_m, blocks_n, batch_count),
-                                        dim3(thread_count, thread_count, 1), 0, stream, m, n, A,
-                                        shiftA, lda, strideA, UV, shiftUV, lduv, strideUV);
+                launch_copy_mat<T>(handle, m, n, A, shiftA, lda, strideA, UV, shiftUV, lduv,
+                                   strideUV, batch_count);
 
             // copy the triangular part to be used in the bidiagonalization
-            ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, dim3(blocks_k, blocks_k, batch_count),
-                                    dim3(thread_count, thread_count, 1), 0, stream, k, k, A, shiftA,
-                                    lda, strideA, bufferT, shiftT, ldt, strideT, no_mask{}, uplo);
+            launch_copy_mat<T>(handle, k, k, A, shiftA, lda, strideA, bufferT, shiftT, ldt, strideT,
+                               batch_count, no_mask{}, uplo);
 
             //*** STAGE 2: generate orthonormal/unitary matrix from row/column compression ***//
             if(leadvA)
@@ -596,9 +680,7 @@ rocblas_status rocsolver_gesvd_template(rocblas_handle handle,
 
             //*** STAGE 3: Bidiagonalization ***//
             // clean triangular factor
-            ROCSOLVER_LAUNCH_KERNEL(set_zero<T>, dim3(blocks_k, blocks_k, batch_count),
-                                    dim3(thread_count, thread_count, 1), 0, stream, k, k, bufferT,
-                                    shiftT, ldt, strideT, uplo);
+            launch_set_zero<T>(handle, k, k, bufferT, shiftT, ldt, strideT, batch_count, uplo);
 
             rocsolver_gebrd_template<false, STRIDED>(
                 handle, k, k, bufferT, shiftT, ldt, strideT, S, strideS, E, strideE, tau_splits, k,
@@ -608,9 +690,8 @@ rocblas_status rocsolver_gesvd_template(rocblas_handle handle,
 
             if(!othervN)
                 // copy results to generate non-lead vectors if required
-                ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, dim3(blocks_k, blocks_k, batch_count),
-                                        dim3(thread_count, thread_count, 1), 0, stream, k, k,
-                                        bufferT, shiftT, ldt, strideT, bufferC, shiftC, ldc, strideC);
+                launch_copy_mat<T>(handle, k, k, bufferT, shiftT, ldt, strideT, bufferC, shiftC,
+                                   ldc, strideC, batch_count);
 
             //*** STAGE 4: generate orthonormal/unitary matrices from bidiagonalization ***//
             // for lead-dimension vectors
@@ -628,15 +709,15 @@ rocblas_status rocsolver_gesvd_template(rocblas_handle handle,
 
             //*** STAGE 5: Compute singular values and vectors from the bidiagonal form ***//
             if(row)
-                rocsolver_bdsqr_template<T>(handle, rocblas_fill_upper, k, nv, nu, 0, S, strideS, E,
-                                            strideE, bufferC, shiftC, ldc, strideC, bufferT, shiftT,
-                                            ldt, strideT, (T*)nullptr, 0, 1, 1, info, batch_count,
-                                            (rocblas_int*)tau_splits, (TT*)work_workArr);
+                local_bdsvd_template<T>(handle, dc, hybrid, rocblas_fill_upper, k, nv, nu, 0, S,
+                                        strideS, E, strideE, bufferC, shiftC, ldc, strideC, bufferT,
+                                        shiftT, ldt, strideT, (T*)nullptr, 0, 1, 1, info,
+                                        batch_count, (rocblas_int*)tau_splits, (TT*)work_workArr);
             else
-                rocsolver_bdsqr_template<T>(handle, rocblas_fill_upper, k, nv, nu, 0, S, strideS, E,
-                                            strideE, bufferT, shiftT, ldt, strideT, bufferC, shiftC,
-                                            ldc, strideC, (T*)nullptr, 0, 1, 1, info, batch_count,
-                                            (rocblas_int*)tau_splits, (TT*)work_workArr);
+                local_bdsvd_template<T>(handle, dc, hybrid, rocblas_fill_upper, k, nv, nu, 0, S,
+                                        strideS, E, strideE, bufferT, shiftT, ldt, strideT, bufferC,
+                                        shiftC, ldc, strideC, (T*)nullptr, 0, 1, 1, info,
+                                        batch_count, (rocblas_int*)tau_splits, (TT*)work_workArr);
 
             //*** STAGE 6: update vectors with orthonormal/unitary matrices ***//
             if(leadvO)
@@ -656,9 +737,8 @@ rocblas_status rocsolver_gesvd_template(rocblas_handle handle,
                                      &zero, bufferC, shiftC, ldc, strideC, batch_count, workArr);
 
                 // copy to overwrite A
-                ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, dim3(blocks_m, blocks_n, batch_count),
-                                        dim3(thread_count, thread_count, 1), 0, stream, m, n,
-                                        bufferC, shiftC, ldc, strideC, A, shiftA, lda, strideA);
+                launch_copy_mat<T>(handle, m, n, bufferC, shiftC, ldc, strideC, A, shiftA, lda,
+                                   strideA, batch_count);
             }
             else if(leadvS)
             {
@@ -674,9 +754,8 @@ rocblas_status rocsolver_gesvd_template(rocblas_handle handle,
 
                 // overwrite A if required
                 if(othervO)
-                    ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, dim3(blocks_k, blocks_k, batch_count),
-                                            dim3(thread_count, thread_count, 1), 0, stream, k, k,
-                                            bufferC, shiftC, ldc, strideC, A, shiftA, lda, strideA);
+                    launch_copy_mat<T>(handle, k, k, bufferC, shiftC, ldc, strideC, A, shiftA, lda,
+                                       strideA, batch_count);
             }
             else
             {
@@ -691,15 +770,13 @@ rocblas_status rocsolver_gesvd_template(rocblas_handle handle,
                                      strideUV, &zero, A, shiftA, lda, strideA, batch_count, workArr);
 
                 // copy back to U/V
-                ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, dim3(blocks_m, blocks_n, batch_count),
-                                        dim3(thread_count, thread_count, 1), 0, stream, m, n, A,
-                                        shiftA, lda, strideA, UV, shiftUV, lduv, strideUV);
+                launch_copy_mat<T>(handle, m, n, A, shiftA, lda, strideA, UV, shiftUV, lduv,
+                                   strideUV, batch_count);
 
                 // overwrite A if required
                 if(othervO)
-                    ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, dim3(blocks_k, blocks_k, batch_count),
-                                            dim3(thread_count, thread_count, 1), 0, stream, k, k,
-                                            bufferC, shiftC, ldc, strideC, A, shiftA, lda, strideA);
+                    launch_copy_mat<T>(handle, k, k, bufferC, shiftC, ldc, strideC, A, shiftA, lda,
+                                       strideA, batch_count);
             }
         }
 
@@ -718,16 +795,13 @@ rocblas_status rocsolver_gesvd_template(rocblas_handle handle,
 
             if(!leadvO)
                 // copy factorization to U or V when needed
-                ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, dim3(blocks_m, blocks_n, batch_count),
-                                        dim3(thread_count, thread_count, 1), 0, stream, m, n, A,
-                                        shiftA, lda, strideA, UV, shiftUV, lduv, strideUV);
+                launch_copy_mat<T>(handle, m, n, A, shiftA, lda, strideA, UV, shiftUV, lduv,
+                                   strideUV, batch_count);
 
             if(othervS || othervA || (leadvO && othervN))
                 // copy the triangular part
-                ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, dim3(blocks_k, blocks_k, batch_count),
-                                        dim3(thread_count, thread_count, 1), 0, stream, k, k, A,
-                                        shiftA, lda, strideA, bufferT, shiftT, ldt, strideT,
-                                        no_mask{}, uplo);
+                launch_copy_mat<T>(handle, k, k, A, shiftA, lda, strideA, bufferT, shiftT, ldt,
+                                   strideT, batch_count, no_mask{}, uplo);
 
             //*** STAGE 2: generate orthonormal/unitary matrix from row/column compression ***//
             if(leadvO)
@@ -747,9 +821,7 @@ rocblas_status rocsolver_gesvd_template(rocblas_handle handle,
             if(othervS || othervA || (leadvO && othervN))
             {
                 // clean triangular factor
-                ROCSOLVER_LAUNCH_KERNEL(set_zero<T>, dim3(blocks_k, blocks_k, batch_count),
-                                        dim3(thread_count, thread_count, 1), 0, stream, k, k,
-                                        bufferT, shiftT, ldt, strideT, uplo);
+                launch_set_zero<T>(handle, k, k, bufferT, shiftT, ldt, strideT, batch_count, uplo);
 
                 rocsolver_gebrd_template<false, STRIDED>(
                     handle, k, k, bufferT, shiftT, ldt, strideT, S, strideS, E, strideE, tau_splits,
@@ -762,9 +834,7 @@ rocblas_status rocsolver_gesvd_template(rocblas_handle handle,
             else
             {
                 // clean triangular factor
-                ROCSOLVER_LAUNCH_KERNEL(set_zero<T>, dim3(blocks_k, blocks_k, batch_count),
-                                        dim3(thread_count, thread_count, 1), 0, stream, k, k, A,
-                                        shiftA, lda, strideA, uplo);
+                launch_set_zero<T>(handle, k, k, A, shiftA, lda, strideA, batch_count, uplo);
 
                 rocsolver_gebrd_template<BATCHED, STRIDED>(
                     handle, k, k, A, shiftA, lda, strideA, S, strideS, E, strideE, tau_splits, k,
@@ -812,24 +882,24 @@ rocblas_status rocsolver_gesvd_template(rocblas_handle handle,
             uplo = rocblas_fill_upper;
             if(!leftvO && !rightvO)
             {
-                rocsolver_bdsqr_template<T>(handle, uplo, k, nv, nu, 0, S, strideS, E, strideE, V,
-                                            shiftV, ldv, strideV, U, shiftU, ldu, strideU,
-                                            (T*)nullptr, 0, 1, 1, info, batch_count,
-                                            (rocblas_int*)tau_splits, (TT*)work_workArr);
+                local_bdsvd_template<T>(handle, dc, hybrid, uplo, k, nv, nu, 0, S, strideS, E,
+                                        strideE, V, shiftV, ldv, strideV, U, shiftU, ldu, strideU,
+                                        (T*)nullptr, 0, 1, 1, info, batch_count,
+                                        (rocblas_int*)tau_splits, (TT*)work_workArr);
             }
             else if(leftvO && !rightvO)
             {
-                rocsolver_bdsqr_template<T>(handle, uplo, k, nv, nu, 0, S, strideS, E, strideE, V,
-                                            shiftV, ldv, strideV, A, shiftA, lda, strideA,
-                                            (W) nullptr, 0, 1, 1, info, batch_count,
-                                            (rocblas_int*)tau_splits, (TT*)work_workArr);
+                local_bdsvd_template<T>(handle, dc, hybrid, uplo, k, nv, nu, 0, S, strideS, E,
+                                        strideE, V, shiftV, ldv, strideV, A, shiftA, lda, strideA,
+                                        (W) nullptr, 0, 1, 1, info, batch_count,
+                                        (rocblas_int*)tau_splits, (TT*)work_workArr);
             }
             else
             {
-                rocsolver_bdsqr_template<T>(handle, uplo, k, nv, nu, 0, S, strideS, E, strideE, A,
-                                            shiftA, lda, strideA, U, shiftU, ldu, strideU,
-                                            (W) nullptr, 0, 1, 1, info, batch_count,
-                                            (rocblas_int*)tau_splits, (TT*)work_workArr);
+                local_bdsvd_template<T>(handle, dc, hybrid, uplo, k, nv, nu, 0, S, strideS, E,
+                                        strideE, A, shiftA, lda, strideA, U, shiftU, ldu, strideU,
+                                        (W) nullptr, 0, 1, 1, info, batch_count,
+                                        (rocblas_int*)tau_splits, (TT*)work_workArr);
             }
 
             //*** STAGE 6: update vectors with orthonormal/unitary matrices ***//
@@ -849,19 +919,25 @@ rocblas_status rocsolver_gesvd_template(rocblas_handle handle,
         // N/A
 
         //*** STAGE 3: Bidiagonalization ***//
-        rocsolver_gebrd_template<BATCHED, STRIDED>(
-            handle, m, n, A, shiftA, lda, strideA, S, strideS, E, strideE, tau_splits, k,
-            (tau_splits + k * batch_count), k, Abyx_norms_trfact_X, shiftX, ldx, strideX,
-            diag_tmptr_Y, shiftY, ldy, strideY, batch_count, scalars, work_workArr, Abyx_norms_tmptr);
+        if(twostage)
+            rocsolver_gebrd_2stage_template<BATCHED, STRIDED>(
+                handle, m, n, A, shiftA, lda, strideA, S, strideS, E, strideE, tau_splits, k,
+                (tau_splits + k * batch_count), k, batch_count, scalars, work_workArr,
+                Abyx_norms_trfact_X, diag_tmptr_Y, workArr, Abyx_norms_tmptr);
+        else
+            rocsolver_gebrd_template<BATCHED, STRIDED>(
+                handle, m, n, A, shiftA, lda, strideA, S, strideS, E, strideE, tau_splits, k,
+                (tau_splits + k * batch_count), k, Abyx_norms_trfact_X, shiftX, ldx, strideX,
+                diag_tmptr_Y, shiftY, ldy, strideY, batch_count, scalars, work_workArr,
+                Abyx_norms_tmptr);
 
         //*** STAGE 4: generate orthonormal/unitary matrices from bidiagonalization ***//
         if(leftvS || leftvA)
         {
             // copy data to matrix U where orthogonal matrix will be generated
             mn = (row && leftvS) ? n : m;
-            ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, dim3(blocks_m, blocks_k, batch_count),
-                                    dim3(thread_count, thread_count, 1), 0, stream, m, k, A, shiftA,
-                                    lda, strideA, U, shiftU, ldu, strideU);
+            launch_copy_mat<T>(handle, m, k, A, shiftA, lda, strideA, U, shiftU, ldu, strideU,
+                               batch_count);
 
             rocsolver_orgbr_ungbr_template<false, STRIDED>(
                 handle, rocblas_column_wise, m, mn, n, U, shiftU, ldu, strideU, tau_splits, k,
@@ -873,9 +949,8 @@ rocblas_status rocsolver_gesvd_template(rocblas_handle handle,
         {
             // copy data to matrix V where othogonal matrix will be generated
             mn = (!row && rightvS) ? m : n;
-            ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, dim3(blocks_k, blocks_n, batch_count),
-                                    dim3(thread_count, thread_count, 1), 0, stream, k, n, A, shiftA,
-                                    lda, strideA, V, shiftV, ldv, strideV);
+            launch_copy_mat<T>(handle, k, n, A, shiftA, lda, strideA, V, shiftV, ldv, strideV,
+                               batch_count);
 
             rocsolver_orgbr_ungbr_template<false, STRIDED>(
                 handle, rocblas_row_wise, mn, n, m, V, shiftV, ldv, strideV,
@@ -902,26 +977,26 @@ rocblas_status rocsolver_gesvd_template(rocblas_handle handle,
         //*** STAGE 5: Compute singular values and vectors from the bidiagonal form ***//
         if(!leftvO && !rightvO)
         {
-            rocsolver_bdsqr_template<T>(handle, uplo, k, nv, nu, 0, S, strideS, E, strideE, V,
-                                        shiftV, ldv, strideV, U, shiftU, ldu, strideU, (T*)nullptr,
-                                        0, 1, 1, info, batch_count, (rocblas_int*)tau_splits,
-                                        (TT*)work_workArr);
+            local_bdsvd_template<T>(handle, dc, hybrid, uplo, k, nv, nu, 0, S, strideS, E, strideE,
+                                    V, shiftV, ldv, strideV, U, shiftU, ldu, strideU, (T*)nullptr,
+                                    0, 1, 1, info, batch_count, (rocblas_int*)tau_splits,
+                                    (TT*)work_workArr);
         }
 
         else if(leftvO && !rightvO)
         {
-            rocsolver_bdsqr_template<T>(handle, uplo, k, nv, nu, 0, S, strideS, E, strideE, V,
-                                        shiftV, ldv, strideV, A, shiftA, lda, strideA, (W) nullptr,
-                                        0, 1, 1, info, batch_count, (rocblas_int*)tau_splits,
-                                        (TT*)work_workArr);
+            local_bdsvd_template<T>(handle, dc, hybrid, uplo, k, nv, nu, 0, S, strideS, E, strideE,
+                                    V, shiftV, ldv, strideV, A, shiftA, lda, strideA, (W) nullptr,
+                                    0, 1, 1, info, batch_count, (rocblas_int*)tau_splits,
+                                    (TT*)work_workArr);
         }
 
         else
         {
-            rocsolver_bdsqr_template<T>(handle, uplo, k, nv, nu, 0, S, strideS, E, strideE, A,
-                                        shiftA, lda, strideA, U, shiftU, ldu, strideU, (W) nullptr,
-                                        0, 1, 1, info, batch_count, (rocblas_int*)tau_splits,
-                                        (TT*)work_workArr);
+            local_bdsvd_template<T>(handle, dc, hybrid, uplo, k, nv, nu, 0, S, strideS, E, strideE,
+                                    A, shiftA, lda, strideA, U, shiftU, ldu, strideU, (W) nullptr,
+                                    0, 1, 1, info, batch_count, (rocblas_int*)tau_splits,
+                                    (TT*)work_workArr);
         }
 
         //*** STAGE 6: update vectors with orthonormal/unitary matrices ***//
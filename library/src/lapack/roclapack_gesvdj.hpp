@@ -39,9 +39,397 @@
 #include "roclapack_geqrf.hpp"
 #include "roclapack_syevj_heevj.hpp"
 #include "rocsolver/rocsolver.h"
+#include "rocsolver_alg_mode.hpp"
 
 ROCSOLVER_BEGIN_NAMESPACE
 
+/************** Kernels and device functions for small size*******************/
+/*****************************************************************************/
+
+#define GESVDJ_SMALL_BDIM 64 // Max number of threads per thread-block used in gesvdj_small kernel
+
+/** GESVDJ_USE_SMALL_KERNEL returns true if the SVD of the m-by-n matrices can be computed with
+    gesvdj_small_kernel. (The one-sided algorithm only produces min(m,n) singular vectors at each
+    side, so a full set of left singular vectors when m > n, or right singular vectors when
+    m < n, must be computed with the general algorithm). **/
+inline bool gesvdj_use_small_kernel(const rocblas_svect left_svect,
+                                    const rocblas_svect right_svect,
+                                    const rocblas_int m,
+                                    const rocblas_int n)
+{
+    if(m > n && left_svect == rocblas_svect_all)
+        return false;
+    if(m < n && right_svect == rocblas_svect_all)
+        return false;
+
+    return m <= GESVDJ_SMALL_SIZE && n <= GESVDJ_SMALL_SIZE;
+}
+
+/** GESVDJ_SMALL_LMEMSIZE returns the size (in bytes) of the LDS shared memory used by
+    gesvdj_small_kernel for each matrix in the thread-block. This includes the p-by-q working
+    matrix W, the q-by-q matrix of accumulated rotations (if vw is true), 2*ceil(q/2) partial
+    sums, and q pivot indices. **/
+template <typename T, typename SS>
+__host__ __device__ inline size_t
+    gesvdj_small_lmemsize(const rocblas_int p, const rocblas_int q, const bool vw)
+{
+    rocblas_int nt = (q + 1) / 2;
+    size_t size = sizeof(T) * (p * q + (vw ? q * q : 0)) + sizeof(SS) * 2 * nt
+        + sizeof(rocblas_int) * q;
+
+    // (keep the workspace of every matrix aligned to 16 bytes)
+    return ((size - 1) / 16 + 1) * 16;
+}
+
+/** GESVDJ_SMALL_KERNEL computes the SVD of matrices of size m, n <= GESVDJ_SMALL_SIZE with the
+    one-sided (Hestenes) Jacobi algorithm, entirely within the LDS. The working matrix W is A if
+    m >= n, or A' otherwise, and it is p-by-q with p >= q. Each sweep applies Jacobi rotations to
+    all the pairs of columns (i,j) of W so that they become orthogonal, and accumulates the
+    rotations in Vw if needed. The pairs are visited in round-robin order, so that the
+    ceil(q/2) rotations of every round do not conflict and can be computed in parallel. At
+    convergence, W = U*S and A = U*S*Vw' (or A = Vw*S*U' if m < n).
+
+    Call this kernel with ceil(q/2) threads in x, one per pair of columns, and mpb threads in y,
+    one per matrix in the thread-block. The dynamic shared memory must be of
+    mpb * gesvdj_small_lmemsize + sizeof(rocblas_int) bytes. **/
+template <typename T, typename SS, typename W>
+ROCSOLVER_KERNEL void __launch_bounds__(GESVDJ_SMALL_BDIM)
+    gesvdj_small_kernel(const rocblas_svect left_svect,
+                        const rocblas_svect right_svect,
+                        const rocblas_int m,
+                        const rocblas_int n,
+                        W AA,
+                        const rocblas_int shiftA,
+                        const rocblas_int lda,
+                        const rocblas_stride strideA,
+                        const SS abstol,
+                        const SS eps,
+                        SS* residualA,
+                        const rocblas_int max_sweeps,
+                        rocblas_int* n_sweepsA,
+                        SS* SA,
+                        const rocblas_stride strideS,
+                        T* UA,
+                        const rocblas_int ldu,
+                        const rocblas_stride strideU,
+                        T* VA,
+                        const rocblas_int ldv,
+                        const rocblas_stride strideV,
+                        rocblas_int* infoA,
+                        const rocblas_int batch_count)
+{
+    rocblas_int tix = hipThreadIdx_x;
+    rocblas_int tiy = hipThreadIdx_y;
+    rocblas_int nt = hipBlockDim_x;
+    rocblas_int mpb = hipBlockDim_y;
+    rocblas_int bid = hipBlockIdx_x * mpb + tiy;
+    bool active = (bid < batch_count);
+
+    // dimensions of the working matrix
+    bool trans = (m < n);
+    rocblas_int p = trans ? n : m;
+    rocblas_int q = trans ? m : n;
+    bool leftv = (left_svect != rocblas_svect_none);
+    bool rightv = (right_svect != rocblas_svect_none);
+    bool vw = trans ? leftv : rightv;
+    bool uw = trans ? rightv : leftv;
+    rocblas_int even_q = q + q % 2;
+
+    // shared memory
+    size_t lsize = gesvdj_small_lmemsize<T, SS>(p, q, vw);
+    extern __shared__ double lmem[];
+    char* lbase = reinterpret_cast<char*>(lmem);
+    T* Wm = reinterpret_cast<T*>(lbase + tiy * lsize);
+    T* Vw = Wm + p * q;
+    SS* offs = reinterpret_cast<SS*>(Vw + (vw ? q * q : 0));
+    SS* diags = offs + nt;
+    SS* sval = offs;
+    rocblas_int* perm = reinterpret_cast<rocblas_int*>(diags + nt);
+    rocblas_int* nbusy = reinterpret_cast<rocblas_int*>(lbase + mpb * lsize);
+
+    // local variables
+    rocblas_int i, j, k;
+    T* A;
+
+    // load W and initialize Vw to the identity
+    if(active)
+    {
+        A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+
+        for(k = tix; k < p * q; k += nt)
+        {
+            i = k % p;
+            j = k / p;
+            Wm[k] = trans ? conj(A[j + i * lda]) : A[i + j * lda];
+        }
+
+        if(vw)
+        {
+            for(k = tix; k < q * q; k += nt)
+                Vw[k] = (k % q == k / q) ? T(1) : T(0);
+        }
+    }
+    __syncthreads();
+
+    // execute sweeps
+    SS small_num = get_safemin<SS>() / eps;
+    SS off = 0, diag = 0;
+    rocblas_int sweeps = 0;
+    bool converged = false;
+    bool done = !active;
+    while(true)
+    {
+        // compute the squared Frobenius norms of the off-diagonal and diagonal parts of W'W
+        if(!done)
+        {
+            SS local_off = 0, local_diag = 0;
+            for(j = tix; j < q; j += nt)
+            {
+                T* wj = Wm + j * p;
+                SS alpha = 0;
+                for(k = 0; k < p; k++)
+                    alpha += std::norm(wj[k]);
+                local_diag += alpha * alpha;
+
+                for(i = 0; i < j; i++)
+                {
+                    T* wi = Wm + i * p;
+                    T gamma = 0;
+                    for(k = 0; k < p; k++)
+                        gamma += conj(wi[k]) * wj[k];
+                    local_off += 2 * std::norm(gamma);
+                }
+            }
+            offs[tix] = local_off;
+            diags[tix] = local_diag;
+        }
+        if(tix == 0 && tiy == 0)
+            *nbusy = 0;
+        __syncthreads();
+
+        // check convergence
+        if(!done)
+        {
+            off = 0;
+            diag = 0;
+            for(i = 0; i < nt; i++)
+            {
+                off += offs[i];
+                diag += diags[i];
+            }
+
+            converged = (off <= (off + diag) * abstol * abstol);
+            done = converged || sweeps >= max_sweeps;
+            if(!done && tix == 0)
+                atomicAdd(nbusy, 1);
+        }
+        __syncthreads();
+
+        // exit when all the matrices in the thread-block are done
+        if(*nbusy == 0)
+            break;
+
+        if(!done)
+            sweeps++;
+
+        // for each round of the round-robin ordering, orthogonalize every pair of columns (i,j)
+        for(rocblas_int r = 0; r < even_q - 1; r++)
+        {
+            if(!done)
+            {
+                // get the current pair
+                if(tix == 0)
+                {
+                    i = 0;
+                    j = r + 1;
+                }
+                else
+                {
+                    i = (r + tix) % (even_q - 1) + 1;
+                    j = (r - tix + even_q - 1) % (even_q - 1) + 1;
+                }
+
+                if(i < q && j < q)
+                {
+                    T* wi = Wm + i * p;
+                    T* wj = Wm + j * p;
+                    SS alpha = 0, beta = 0;
+                    T gamma = 0;
+                    for(k = 0; k < p; k++)
+                    {
+                        alpha += std::norm(wi[k]);
+                        beta += std::norm(wj[k]);
+                        gamma += conj(wi[k]) * wj[k];
+                    }
+                    SS mag = std::abs(gamma);
+
+                    if(mag * mag >= small_num)
+                    {
+                        // calculate the rotation [c, s*e; -s*conj(e), c] with e = gamma/|gamma|
+                        SS zeta = (beta - alpha) / (2 * mag);
+                        SS t = (zeta >= 0 ? 1 : -1) / (std::abs(zeta) + std::hypot(SS(1), zeta));
+                        SS c = 1 / std::hypot(SS(1), t);
+                        T se = (c * t) * (gamma / mag);
+                        T sc = conj(se);
+
+                        // apply it to W and Vw
+                        T x, y;
+                        for(k = 0; k < p; k++)
+                        {
+                            x = wi[k];
+                            y = wj[k];
+                            wi[k] = c * x - sc * y;
+                            wj[k] = se * x + c * y;
+                        }
+
+                        if(vw)
+                        {
+                            T* vi = Vw + i * q;
+                            T* vj = Vw + j * q;
+                            for(k = 0; k < q; k++)
+                            {
+                                x = vi[k];
+                                y = vj[k];
+                                vi[k] = c * x - sc * y;
+                                vj[k] = se * x + c * y;
+                            }
+                        }
+                    }
+                }
+            }
+            __syncthreads();
+        }
+    }
+
+    if(active)
+    {
+        // compute the singular values and normalize the columns of W
+        for(j = tix; j < q; j += nt)
+        {
+            T* wj = Wm + j * p;
+            SS sigma = 0;
+            for(k = 0; k < p; k++)
+                sigma += std::norm(wj[k]);
+            sigma = std::sqrt(sigma);
+
+            sval[j] = sigma;
+            if(sigma > 0)
+            {
+                for(k = 0; k < p; k++)
+                    wj[k] = wj[k] / sigma;
+            }
+        }
+
+        if(tix == 0)
+        {
+            residualA[bid] = std::sqrt(off);
+            n_sweepsA[bid] = sweeps;
+            infoA[bid] = converged ? 0 : 1;
+        }
+    }
+    __syncthreads();
+
+    if(active)
+    {
+        // sort the singular values in decreasing order
+        if(tix == 0)
+        {
+            for(j = 0; j < q; j++)
+                perm[j] = j;
+
+            for(j = 0; j < q - 1; j++)
+            {
+                rocblas_int mx = j;
+                for(i = j + 1; i < q; i++)
+                {
+                    if(sval[perm[i]] > sval[perm[mx]])
+                        mx = i;
+                }
+                swap(perm[j], perm[mx]);
+            }
+
+            // columns of W associated with negligible singular values are replaced by
+            // an orthonormal completion of the others (Gram-Schmidt on the most independent e_r)
+            if(uw)
+            {
+                SS thresh = sval[perm[0]] * eps;
+                for(rocblas_int jj = 0; jj < q; jj++)
+                {
+                    j = perm[jj];
+                    if(sval[j] > thresh)
+                        continue;
+
+                    rocblas_int rbest = 0;
+                    SS best = -1;
+                    for(rocblas_int r = 0; r < p; r++)
+                    {
+                        SS res = 1;
+                        for(rocblas_int ll = 0; ll < jj; ll++)
+                            res -= std::norm(Wm[r + perm[ll] * p]);
+                        if(res > best)
+                        {
+                            best = res;
+                            rbest = r;
+                        }
+                    }
+
+                    T* wj = Wm + j * p;
+                    for(k = 0; k < p; k++)
+                        wj[k] = (k == rbest) ? T(1) : T(0);
+                    for(rocblas_int ll = 0; ll < jj; ll++)
+                    {
+                        T* wl = Wm + perm[ll] * p;
+                        T d = conj(wl[rbest]);
+                        for(k = 0; k < p; k++)
+                            wj[k] -= d * wl[k];
+                    }
+
+                    SS nrm = 0;
+                    for(k = 0; k < p; k++)
+                        nrm += std::norm(wj[k]);
+                    nrm = std::sqrt(nrm);
+                    for(k = 0; k < p; k++)
+                        wj[k] = wj[k] / nrm;
+                }
+            }
+        }
+    }
+    __syncthreads();
+
+    if(!active)
+        return;
+
+    // write the outputs
+    SS* S = SA + bid * strideS;
+    T* U = UA + bid * strideU;
+    T* V = VA + bid * strideV;
+
+    for(k = tix; k < q; k += nt)
+        S[k] = sval[perm[k]];
+
+    if(leftv)
+    {
+        // (U = W if m >= n, or U = Vw otherwise)
+        for(k = tix; k < m * q; k += nt)
+        {
+            i = k % m;
+            j = k / m;
+            U[i + j * ldu] = trans ? Vw[i + perm[j] * q] : Wm[i + perm[j] * p];
+        }
+    }
+
+    if(rightv)
+    {
+        // (V' = Vw' if m >= n, or V' = W' otherwise)
+        for(k = tix; k < q * n; k += nt)
+        {
+            i = k % q;
+            j = k / q;
+            V[i + j * ldv] = conj(trans ? Wm[j + perm[i] * p] : Vw[j + perm[i] * q]);
+        }
+    }
+}
+
 template <typename T, typename SS>
 ROCSOLVER_KERNEL void gesvdj_finalize(const rocblas_int n,
                                       SS* SA,
@@ -80,6 +468,203 @@ ROCSOLVER_KERNEL void gesvdj_finalize(const rocblas_int n,
     }
 }
 
+/************** Host functions for the Jacobi eigensolver ********************/
+/*****************************************************************************/
+
+/** Helper to calculate the workspace sizes of the Jacobi eigensolver applied to the n-by-n
+    Gram matrix. With the mixed-precision algorithm (see rocsolver_alg_mode_mixed), its extra
+    workspace is stored at the beginning of work5_ipiv, ahead of the array bottom. **/
+template <bool BATCHED, typename T, typename SS>
+void gesvdj_syevj_getMemorySize(const rocsolver_alg_mode alg_mode,
+                                const rocblas_int n,
+                                const rocblas_int batch_count,
+                                size_t* size_work1,
+                                size_t* size_work2,
+                                size_t* size_work3,
+                                size_t* size_work4,
+                                size_t* size_work5,
+                                size_t* size_work6)
+{
+    size_t size_mixed;
+    rocsolver_syevj_heevj_mixed_getMemorySize<BATCHED, T, SS>(
+        syevj_use_mixed<T>(alg_mode), rocblas_evect_original, rocblas_fill_upper, n, batch_count,
+        size_work1, size_work2, size_work3, size_work4, size_work5, size_work6, &size_mixed);
+    *size_work5 += size_mixed;
+}
+
+/** GESVDJ_SYEVJ computes the eigenvalues and eigenvectors of the n-by-n Gram matrices V with
+    the Jacobi eigensolver, in ascending order **/
+template <bool STRIDED, typename T, typename SS>
+rocblas_status gesvdj_syevj(rocblas_handle handle,
+                            const rocsolver_alg_mode alg_mode,
+                            const rocblas_int n,
+                            T* V,
+                            const rocblas_int ldv,
+                            const rocblas_stride strideV,
+                            const SS abstol,
+                            SS* residual,
+                            const rocblas_int max_sweeps,
+                            rocblas_int* n_sweeps,
+                            SS* S,
+                            const rocblas_stride strideS,
+                            rocblas_int* info,
+                            const rocblas_int batch_count,
+                            void* work1,
+                            void* work2,
+                            void* work3,
+                            void* work4,
+                            void* work5,
+                            void* work6)
+{
+    if(syevj_use_mixed<T>(alg_mode))
+    {
+        void* mixed = work5;
+        rocblas_int* bottom = (rocblas_int*)((char*)work5 + syevj_mixed_size<T>(n, batch_count));
+        return rocsolver_syevj_heevj_mixed_template<false, STRIDED, T>(
+            handle, rocblas_esort_ascending, rocblas_evect_original, rocblas_fill_upper, n, V, 0,
+            ldv, strideV, abstol, residual, max_sweeps, n_sweeps, S, strideS, info, batch_count,
+            (T*)work1, (T*)work2, (SS*)work3, (rocblas_int*)work4, bottom, (rocblas_int*)work6,
+            mixed);
+    }
+
+    return rocsolver_syevj_heevj_template<false, STRIDED, T>(
+        handle, rocblas_esort_ascending, rocblas_evect_original, rocblas_fill_upper, n, V, 0, ldv,
+        strideV, abstol, residual, max_sweeps, n_sweeps, S, strideS, info, batch_count, (T*)work1,
+        (T*)work2, (SS*)work3, (rocblas_int*)work4, (rocblas_int*)work5, (rocblas_int*)work6);
+}
+
+/************** Host functions for the QR preconditioning *******************/
+/*****************************************************************************/
+
+/** GESVDJ_USE_QR_PRECOND returns true if the Jacobi method is applied to the n-by-n triangular
+    factor R of the QR factorization of A (see rocsolver_alg_mode_qr_precond). The full matrix U
+    would require the m-by-m matrix Q, so it is computed with the general algorithm. **/
+inline bool gesvdj_use_qr_precond(const rocsolver_alg_mode alg_mode,
+                                  const rocblas_svect left_svect,
+                                  const rocblas_int m,
+                                  const rocblas_int n)
+{
+    return alg_mode == rocsolver_alg_mode_qr_precond && m > n && left_svect != rocblas_svect_all;
+}
+
+/** Helper to calculate the workspace sizes of the QR preconditioning, besides those needed by
+    the Jacobi method on R. The triangular factor R (and the left singular vectors of R, if
+    required) and the Householder scalars are stored at the beginning of work5_ipiv, in
+    size_R bytes. **/
+template <bool BATCHED, typename T>
+void gesvdj_qr_precond_getMemorySize(const rocblas_svect left_svect,
+                                     const rocblas_int m,
+                                     const rocblas_int n,
+                                     const rocblas_int batch_count,
+                                     size_t* size_scalars,
+                                     size_t* size_work2,
+                                     size_t* size_work3,
+                                     size_t* size_work4,
+                                     size_t* size_workArr,
+                                     size_t* size_R)
+{
+    size_t b1 = 0, b2 = 0;
+    size_t c1 = 0, c2 = 0;
+    size_t d1 = 0, d2 = 0;
+    size_t f1 = 0, f2 = 0, f3 = 0;
+    size_t unused;
+    bool leftv = left_svect != rocblas_svect_none;
+
+    // requirements for QR factorization
+    rocsolver_geqrf_getMemorySize<BATCHED, T>(m, n, batch_count, size_scalars, &b1, &c1, &d1, &f1);
+
+    // requirements for generating Q and computing U = Q * U_R
+    if(leftv)
+    {
+        rocsolver_orgqr_ungqr_getMemorySize<BATCHED, T>(m, n, n, batch_count, &unused, &b2, &c2,
+                                                        &d2, &f2);
+        if(BATCHED)
+            f3 = sizeof(T*) * 2 * batch_count;
+    }
+
+    *size_work2 = std::max(b1, b2);
+    *size_work3 = std::max(c1, c2);
+    *size_work4 = std::max(d1, d2);
+    *size_workArr = std::max({f1, f2, f3});
+    *size_R = sizeof(T) * (n + (leftv ? 2 : 1) * n * n) * batch_count;
+}
+
+/** GESVDJ_QR_PRECOND_FACTOR computes the QR factorization of A, and copies the triangular factor
+    (with zeros below the diagonal) to the n-by-n matrices R, stored after the Householder
+    scalars tau at the beginning of work5_ipiv. **/
+template <bool BATCHED, bool STRIDED, typename T, typename W>
+rocblas_status gesvdj_qr_precond_factor(rocblas_handle handle,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        W A,
+                                        const rocblas_int shiftA,
+                                        const rocblas_int lda,
+                                        const rocblas_stride strideA,
+                                        const rocblas_int batch_count,
+                                        T* scalars,
+                                        void* work2,
+                                        void* work3,
+                                        void* work4,
+                                        T* tau,
+                                        T* R,
+                                        void* workArr)
+{
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+    rocblas_stride strideR = rocblas_stride(n) * n;
+
+    // A = QR
+    rocsolver_geqrf_template<BATCHED, STRIDED, T>(handle, m, n, A, shiftA, lda, strideA, tau, n,
+                                                  batch_count, scalars, work2, (T*)work3,
+                                                  (T*)work4, (T**)workArr);
+
+    // copy R
+    HIP_CHECK(hipMemsetAsync(R, 0, sizeof(T) * strideR * batch_count, stream));
+    rocblas_int blocks_n = (n - 1) / BS2 + 1;
+    ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, dim3(blocks_n, blocks_n, batch_count), dim3(BS2, BS2, 1),
+                            0, stream, n, n, A, shiftA, lda, strideA, R, 0, n, strideR, no_mask{},
+                            rocblas_fill_upper);
+
+    return rocblas_status_success;
+}
+
+/** GESVDJ_QR_PRECOND_VECTORS computes the left singular vectors of A as U = Q * U_R,
+    where U_R are the left singular vectors of the triangular factor R (called with scalars
+    on the host). **/
+template <bool BATCHED, bool STRIDED, typename T, typename W>
+void gesvdj_qr_precond_vectors(rocblas_handle handle,
+                               const rocblas_int m,
+                               const rocblas_int n,
+                               W A,
+                               const rocblas_int shiftA,
+                               const rocblas_int lda,
+                               const rocblas_stride strideA,
+                               T* U,
+                               const rocblas_int ldu,
+                               const rocblas_stride strideU,
+                               const rocblas_int batch_count,
+                               T* scalars,
+                               void* work2,
+                               void* work3,
+                               void* work4,
+                               T* tau,
+                               T* UR,
+                               void* workArr)
+{
+    T one = T(1);
+    T zero = T(0);
+
+    // A = Q
+    rocsolver_orgqr_ungqr_template<BATCHED, STRIDED, T>(handle, m, n, n, A, shiftA, lda, strideA,
+                                                        tau, n, batch_count, scalars, (T*)work2,
+                                                        (T*)work3, (T*)work4, (T**)workArr);
+
+    // U = Q * U_R
+    rocblasCall_gemm(handle, rocblas_operation_none, rocblas_operation_none, m, n, n, &one, A,
+                     shiftA, lda, strideA, UR, 0, n, rocblas_stride(n) * n, &zero, U, 0, ldu,
+                     strideU, batch_count, (T**)workArr);
+}
+
 /** Argument checking **/
 template <typename T, typename SS, typename W>
 rocblas_status rocsolver_gesvdj_argCheck(rocblas_handle handle,
@@ -144,6 +729,7 @@ void rocsolver_gesvdj_getMemorySize(const rocblas_svect left_svect,
                                     const rocblas_int m,
                                     const rocblas_int n,
                                     const rocblas_int batch_count,
+                                    const rocsolver_alg_mode alg_mode,
                                     size_t* size_scalars,
                                     size_t* size_VUtmp,
                                     size_t* size_work1_UVtmp,
@@ -167,6 +753,38 @@ void rocsolver_gesvdj_getMemorySize(const rocblas_svect left_svect,
         return;
     }
 
+    // if the small-size kernel is used, no workspace is needed
+    if(gesvdj_use_small_kernel(left_svect, right_svect, m, n))
+    {
+        *size_scalars = 0;
+        *size_VUtmp = 0;
+        *size_work1_UVtmp = 0;
+        *size_work2 = 0;
+        *size_work3 = 0;
+        *size_work4 = 0;
+        *size_work5_ipiv = 0;
+        *size_work6_workArr = 0;
+        return;
+    }
+
+    // if QR preconditioning, the workspace of the Jacobi method on R is extended
+    if(gesvdj_use_qr_precond(alg_mode, left_svect, m, n))
+    {
+        size_t w2, w3, w4, w6, wR;
+        rocsolver_gesvdj_getMemorySize<false, T, SS>(
+            left_svect, right_svect, n, n, batch_count, rocsolver_alg_mode_qr, size_scalars,
+            size_VUtmp, size_work1_UVtmp, size_work2, size_work3, size_work4, size_work5_ipiv,
+            size_work6_workArr);
+        gesvdj_qr_precond_getMemorySize<BATCHED, T>(left_svect, m, n, batch_count, size_scalars,
+                                                    &w2, &w3, &w4, &w6, &wR);
+        *size_work2 = std::max(*size_work2, w2);
+        *size_work3 = std::max(*size_work3, w3);
+        *size_work4 = std::max(*size_work4, w4);
+        *size_work5_ipiv += wR;
+        *size_work6_workArr = std::max(*size_work6_workArr, w6);
+        return;
+    }
+
     bool leftv = left_svect != rocblas_svect_none;
     bool rightv = right_svect != rocblas_svect_none;
     bool left_full = left_svect == rocblas_svect_all;
@@ -184,9 +802,8 @@ void rocsolver_gesvdj_getMemorySize(const rocblas_svect left_svect,
     if(m >= n)
     {
         // requirements for Jacobi eigensolver
-        rocsolver_syevj_heevj_getMemorySize<BATCHED, T, SS>(rocblas_evect_original,
-                                                            rocblas_fill_upper, n, batch_count, &a1,
-                                                            &b1, &c1, &d1, &e1, &f1);
+        gesvdj_syevj_getMemorySize<BATCHED, T, SS>(alg_mode, n, batch_count, &a1, &b1, &c1,
+                                                   &d1, &e1, &f1);
 
         // requirements for QR factorization
         rocsolver_geqrf_getMemorySize<BATCHED, T>(m, n, batch_count, size_scalars, &b2, &c2, &d2,
@@ -203,9 +820,8 @@ void rocsolver_gesvdj_getMemorySize(const rocblas_svect left_svect,
     else
     {
         // requirements for Jacobi eigensolver
-        rocsolver_syevj_heevj_getMemorySize<BATCHED, T, SS>(rocblas_evect_original,
-                                                            rocblas_fill_upper, m, batch_count, &a1,
-                                                            &b1, &c1, &d1, &e1, &f1);
+        gesvdj_syevj_getMemorySize<BATCHED, T, SS>(alg_mode, m, batch_count, &a1, &b1, &c1,
+                                                   &d1, &e1, &f1);
 
         // requirements for LQ factorization
         rocsolver_gelqf_getMemorySize<BATCHED, T>(m, n, batch_count, size_scalars, &b2, &c2, &d2,
@@ -260,6 +876,7 @@ rocblas_status rocsolver_gesvdj_template(rocblas_handle handle,
                                          const rocblas_stride strideV,
                                          rocblas_int* info,
                                          const rocblas_int batch_count,
+                                         const rocsolver_alg_mode alg_mode,
                                          T* scalars,
                                          T* VUtmp,
                                          void* work1_UVtmp,
@@ -296,11 +913,66 @@ rocblas_status rocsolver_gesvdj_template(rocblas_handle handle,
         return rocblas_status_success;
     }
 
+    if(gesvdj_use_small_kernel(left_svect, right_svect, m, n))
+    {
+        // *** USE SINGLE SMALL-SIZE KERNEL ***
+        // (several small matrices share a thread-block, as long as their workspaces fit in LDS)
+
+        SS eps = get_epsilon<SS>();
+        SS atol = (abstol <= 0 ? eps : abstol);
+        rocblas_int p = std::max(m, n);
+        rocblas_int q = std::min(m, n);
+        bool vw = (m >= n ? right_svect : left_svect) != rocblas_svect_none;
+        size_t lsize = gesvdj_small_lmemsize<T, SS>(p, q, vw);
+
+        rocblas_int nt = (q + 1) / 2;
+        rocblas_int mpb = std::max(GESVDJ_SMALL_BDIM / nt, 1);
+        mpb = std::max(std::min<rocblas_int>(mpb, (64 * 1024 - sizeof(rocblas_int)) / lsize), 1);
+        rocblas_int blocks = (batch_count - 1) / mpb + 1;
+        size_t lmemsize = mpb * lsize + sizeof(rocblas_int);
+
+        ROCSOLVER_LAUNCH_KERNEL((gesvdj_small_kernel<T, SS>), dim3(blocks, 1, 1), dim3(nt, mpb, 1),
+                                lmemsize, stream, left_svect, right_svect, m, n, A, shiftA, lda,
+                                strideA, atol, eps, residual, max_sweeps, n_sweeps, S, strideS, U,
+                                ldu, strideU, V, ldv, strideV, info, batch_count);
+
+        return rocblas_status_success;
+    }
+
     // everything must be executed with scalars on the host
     rocblas_pointer_mode old_mode;
     rocblas_get_pointer_mode(handle, &old_mode);
     rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
 
+    if(gesvdj_use_qr_precond(alg_mode, left_svect, m, n))
+    {
+        // *** APPLY THE JACOBI METHOD TO THE TRIANGULAR FACTOR OF A = QR ***
+        bool leftv = left_svect != rocblas_svect_none;
+        rocblas_stride strideR = rocblas_stride(n) * n;
+        T* tau = (T*)work5_ipiv;
+        T* R = tau + n * batch_count;
+        T* UR = R + strideR * batch_count;
+        void* work5 = UR + (leftv ? strideR * batch_count : 0);
+
+        ROCBLAS_CHECK(gesvdj_qr_precond_factor<BATCHED, STRIDED, T>(
+            handle, m, n, A, shiftA, lda, strideA, batch_count, scalars, work2, work3, work4, tau,
+            R, work6_workArr));
+
+        ROCBLAS_CHECK(rocsolver_gesvdj_template<false, true, T>(
+            handle, left_svect, right_svect, n, n, R, 0, n, strideR, abstol, residual, max_sweeps,
+            n_sweeps, S, strideS, UR, n, strideR, V, ldv, strideV, info, batch_count,
+            rocsolver_alg_mode_qr, scalars, VUtmp, work1_UVtmp, work2, work3, work4, work5,
+            work6_workArr));
+
+        if(leftv)
+            gesvdj_qr_precond_vectors<BATCHED, STRIDED, T>(
+                handle, m, n, A, shiftA, lda, strideA, U, ldu, strideU, batch_count, scalars,
+                work2, work3, work4, tau, UR, work6_workArr);
+
+        rocblas_set_pointer_mode(handle, old_mode);
+        return rocblas_status_success;
+    }
+
     bool leftv = left_svect != rocblas_svect_none;
     bool rightv = right_svect != rocblas_svect_none;
     bool left_full = left_svect == rocblas_svect_all;
@@ -321,11 +993,9 @@ rocblas_status rocsolver_gesvdj_template(rocblas_handle handle,
                          V_gemm, 0, ldv_gemm, strideV_gemm, batch_count, (T**)work6_workArr);
 
         // apply eigenvalue decomposition to -A'A, obtaining V as eigenvectors
-        rocsolver_syevj_heevj_template<false, STRIDED, T>(
-            handle, rocblas_esort_ascending, rocblas_evect_original, rocblas_fill_upper, n, V_gemm,
-            0, ldv_gemm, strideV_gemm, abstol, residual, max_sweeps, n_sweeps, S, strideS, info,
-            batch_count, (T*)work1_UVtmp, (T*)work2, (SS*)work3, (rocblas_int*)work4,
-            (rocblas_int*)work5_ipiv, (rocblas_int*)work6_workArr);
+        gesvdj_syevj<STRIDED, T>(handle, alg_mode, n, V_gemm, ldv_gemm, strideV_gemm, abstol,
+                                 residual, max_sweeps, n_sweeps, S, strideS, info, batch_count,
+                                 work1_UVtmp, work2, work3, work4, work5_ipiv, work6_workArr);
 
         // compute AV
         T* U_gemm = (leftv ? U : (T*)work1_UVtmp);
@@ -373,11 +1043,9 @@ rocblas_status rocsolver_gesvdj_template(rocblas_handle handle,
                          U_gemm, 0, ldu_gemm, strideU_gemm, batch_count, (T**)work6_workArr);
 
         // apply eigenvalue decomposition to -AA', obtaining U as eigenvectors
-        rocsolver_syevj_heevj_template<false, STRIDED, T>(
-            handle, rocblas_esort_ascending, rocblas_evect_original, rocblas_fill_upper, m, U_gemm,
-            0, ldu_gemm, strideU_gemm, abstol, residual, max_sweeps, n_sweeps, S, strideS, info,
-            batch_count, (T*)work1_UVtmp, (T*)work2, (SS*)work3, (rocblas_int*)work4,
-            (rocblas_int*)work5_ipiv, (rocblas_int*)work6_workArr);
+        gesvdj_syevj<STRIDED, T>(handle, alg_mode, m, U_gemm, ldu_gemm, strideU_gemm, abstol,
+                                 residual, max_sweeps, n_sweeps, S, strideS, info, batch_count,
+                                 work1_UVtmp, work2, work3, work4, work5_ipiv, work6_workArr);
 
         // compute U'A
         T* V_gemm = (rightv ? V : (T*)work1_UVtmp);
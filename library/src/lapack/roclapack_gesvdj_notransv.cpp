@@ -59,6 +59,7 @@ rocblas_status rocsolver_gesvdj_notransv_impl(rocblas_handle handle,
     ROCSOLVER_ENTER_TOP("gesvdj_notransv", "--left_svect", left_svect, "--right_svect", right_svect,
                         "-m", m, "-n", n, "--lda", lda, "--abstol", abstol, "--max_sweeps",
                         max_sweeps, "--ldu", ldu, "--ldv", ldv);
+    ROCSOLVER_INFO_SUMMARY_SWEEPS(info, 1, n_sweeps, residual);
 
     if(!handle)
         return rocblas_status_invalid_handle;
@@ -80,8 +81,11 @@ rocblas_status rocsolver_gesvdj_notransv_impl(rocblas_handle handle,
     rocblas_stride strideV = 0;
     rocblas_int batch_count = 1;
 
+    // algorithm used for the preconditioning
+    rocsolver_alg_mode alg_mode = get_alg_mode(handle, rocsolver_function_gesvdj);
+
     // memory workspace sizes:
-    // size for constants in rocblas calls
+    // constants in rocblas calls (only whether they are needed, see set_device_scalars)
     size_t size_scalars;
     // size for temporary matrix storage
     size_t size_VUtmp;
@@ -89,17 +93,18 @@ rocblas_status rocsolver_gesvdj_notransv_impl(rocblas_handle handle,
     size_t size_work1_UVtmp, size_work2, size_work3, size_work4, size_work5_ipiv, size_work6_workArr;
 
     rocsolver_gesvdj_notransv_getMemorySize<false, T, SS>(
-        left_svect, right_svect, m, n, batch_count, &size_scalars, &size_VUtmp, &size_work1_UVtmp,
-        &size_work2, &size_work3, &size_work4, &size_work5_ipiv, &size_work6_workArr);
+        left_svect, right_svect, m, n, batch_count, alg_mode, &size_scalars, &size_VUtmp,
+        &size_work1_UVtmp, &size_work2, &size_work3, &size_work4, &size_work5_ipiv,
+        &size_work6_workArr);
 
     if(rocblas_is_device_memory_size_query(handle))
         return rocblas_set_optimal_device_memory_size(
-            handle, size_scalars, size_VUtmp, size_work1_UVtmp, size_work2, size_work3, size_work4,
+            handle, size_t(0), size_VUtmp, size_work1_UVtmp, size_work2, size_work3, size_work4,
             size_work5_ipiv, size_work6_workArr);
 
     // memory workspace allocation
     void *scalars, *VUtmp, *work1_UVtmp, *work2, *work3, *work4, *work5_ipiv, *work6_workArr;
-    rocblas_device_malloc mem(handle, size_scalars, size_VUtmp, size_work1_UVtmp, size_work2,
+    rocblas_device_malloc mem(handle, size_t(0), size_VUtmp, size_work1_UVtmp, size_work2,
                               size_work3, size_work4, size_work5_ipiv, size_work6_workArr);
 
     if(!mem)
@@ -114,13 +119,14 @@ rocblas_status rocsolver_gesvdj_notransv_impl(rocblas_handle handle,
     work5_ipiv = mem[6];
     work6_workArr = mem[7];
     if(size_scalars > 0)
-        init_scalars(handle, (T*)scalars);
+        ROCBLAS_CHECK(set_device_scalars<T>(scalars));
 
     // execution
-    return rocsolver_gesvdj_notransv_template<false, false, T>(
+    return _info_summary_scope.commit(rocsolver_gesvdj_notransv_template<false, false, T>(
         handle, left_svect, right_svect, m, n, A, shiftA, lda, strideA, abstol, residual,
         max_sweeps, n_sweeps, S, strideS, U, ldu, strideU, V, ldv, strideV, info, batch_count,
-        (T*)scalars, (T*)VUtmp, work1_UVtmp, work2, work3, work4, work5_ipiv, work6_workArr);
+        alg_mode, (T*)scalars, (T*)VUtmp, work1_UVtmp, work2, work3, work4, work5_ipiv,
+        work6_workArr));
 }
 
 ROCSOLVER_END_NAMESPACE
@@ -106,6 +106,7 @@ void rocsolver_gesvdj_notransv_getMemorySize(const rocblas_svect left_svect,
                                              const rocblas_int m,
                                              const rocblas_int n,
                                              const rocblas_int batch_count,
+                                             const rocsolver_alg_mode alg_mode,
                                              size_t* size_scalars,
                                              size_t* size_VUtmp,
                                              size_t* size_work1_UVtmp,
@@ -129,6 +130,24 @@ void rocsolver_gesvdj_notransv_getMemorySize(const rocblas_svect left_svect,
         return;
     }
 
+    // if QR preconditioning, the workspace of the Jacobi method on R is extended
+    if(gesvdj_use_qr_precond(alg_mode, left_svect, m, n))
+    {
+        size_t w2, w3, w4, w6, wR;
+        rocsolver_gesvdj_notransv_getMemorySize<false, T, SS>(
+            left_svect, right_svect, n, n, batch_count, rocsolver_alg_mode_qr, size_scalars,
+            size_VUtmp, size_work1_UVtmp, size_work2, size_work3, size_work4, size_work5_ipiv,
+            size_work6_workArr);
+        gesvdj_qr_precond_getMemorySize<BATCHED, T>(left_svect, m, n, batch_count, size_scalars,
+                                                    &w2, &w3, &w4, &w6, &wR);
+        *size_work2 = std::max(*size_work2, w2);
+        *size_work3 = std::max(*size_work3, w3);
+        *size_work4 = std::max(*size_work4, w4);
+        *size_work5_ipiv += wR;
+        *size_work6_workArr = std::max(*size_work6_workArr, w6);
+        return;
+    }
+
     bool leftv = left_svect != rocblas_svect_none;
     bool rightv = right_svect != rocblas_svect_none;
     bool left_full = left_svect == rocblas_svect_all;
@@ -146,9 +165,8 @@ void rocsolver_gesvdj_notransv_getMemorySize(const rocblas_svect left_svect,
     if(m >= n)
     {
         // requirements for Jacobi eigensolver
-        rocsolver_syevj_heevj_getMemorySize<BATCHED, T, SS>(rocblas_evect_original,
-                                                            rocblas_fill_upper, n, batch_count, &a1,
-                                                            &b1, &c1, &d1, &e1, &f1);
+        gesvdj_syevj_getMemorySize<BATCHED, T, SS>(alg_mode, n, batch_count, &a1, &b1, &c1,
+                                                   &d1, &e1, &f1);
 
         // requirements for QR factorization
         rocsolver_geqrf_getMemorySize<BATCHED, T>(m, n, batch_count, size_scalars, &b2, &c2, &d2,
@@ -166,9 +184,8 @@ void rocsolver_gesvdj_notransv_getMemorySize(const rocblas_svect left_svect,
     else
     {
         // requirements for Jacobi eigensolver
-        rocsolver_syevj_heevj_getMemorySize<BATCHED, T, SS>(rocblas_evect_original,
-                                                            rocblas_fill_upper, m, batch_count, &a1,
-                                                            &b1, &c1, &d1, &e1, &f1);
+        gesvdj_syevj_getMemorySize<BATCHED, T, SS>(alg_mode, m, batch_count, &a1, &b1, &c1,
+                                                   &d1, &e1, &f1);
 
         // requirements for QR factorization
         rocsolver_geqrf_getMemorySize<BATCHED, T>(n, m, batch_count, size_scalars, &b2, &c2, &d2,
@@ -223,6 +240,7 @@ rocblas_status rocsolver_gesvdj_notransv_template(rocblas_handle handle,
                                                   const rocblas_stride strideV,
                                                   rocblas_int* info,
                                                   const rocblas_int batch_count,
+                                                  const rocsolver_alg_mode alg_mode,
                                                   T* scalars,
                                                   T* VUtmp,
                                                   void* work1_UVtmp,
@@ -264,6 +282,35 @@ rocblas_status rocsolver_gesvdj_notransv_template(rocblas_handle handle,
     rocblas_get_pointer_mode(handle, &old_mode);
     rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
 
+    if(gesvdj_use_qr_precond(alg_mode, left_svect, m, n))
+    {
+        // *** APPLY THE JACOBI METHOD TO THE TRIANGULAR FACTOR OF A = QR ***
+        bool leftv = left_svect != rocblas_svect_none;
+        rocblas_stride strideR = rocblas_stride(n) * n;
+        T* tau = (T*)work5_ipiv;
+        T* R = tau + n * batch_count;
+        T* UR = R + strideR * batch_count;
+        void* work5 = UR + (leftv ? strideR * batch_count : 0);
+
+        ROCBLAS_CHECK(gesvdj_qr_precond_factor<BATCHED, STRIDED, T>(
+            handle, m, n, A, shiftA, lda, strideA, batch_count, scalars, work2, work3, work4, tau,
+            R, work6_workArr));
+
+        ROCBLAS_CHECK(rocsolver_gesvdj_notransv_template<false, true, T>(
+            handle, left_svect, right_svect, n, n, R, 0, n, strideR, abstol, residual, max_sweeps,
+            n_sweeps, S, strideS, UR, n, strideR, V, ldv, strideV, info, batch_count,
+            rocsolver_alg_mode_qr, scalars, VUtmp, work1_UVtmp, work2, work3, work4, work5,
+            work6_workArr));
+
+        if(leftv)
+            gesvdj_qr_precond_vectors<BATCHED, STRIDED, T>(
+                handle, m, n, A, shiftA, lda, strideA, U, ldu, strideU, batch_count, scalars,
+                work2, work3, work4, tau, UR, work6_workArr);
+
+        rocblas_set_pointer_mode(handle, old_mode);
+        return rocblas_status_success;
+    }
+
     bool leftv = left_svect != rocblas_svect_none;
     bool rightv = right_svect != rocblas_svect_none;
     bool left_full = left_svect == rocblas_svect_all;
@@ -284,11 +331,9 @@ rocblas_status rocsolver_gesvdj_notransv_template(rocblas_handle handle,
                          V_gemm, 0, ldv_gemm, strideV_gemm, batch_count, (T**)work6_workArr);
 
         // apply eigenvalue decomposition to -A'A, obtaining V as eigenvectors
-        rocsolver_syevj_heevj_template<false, STRIDED, T>(
-            handle, rocblas_esort_ascending, rocblas_evect_original, rocblas_fill_upper, n, V_gemm,
-            0, ldv_gemm, strideV_gemm, abstol, residual, max_sweeps, n_sweeps, S, strideS, info,
-            batch_count, (T*)work1_UVtmp, (T*)work2, (SS*)work3, (rocblas_int*)work4,
-            (rocblas_int*)work5_ipiv, (rocblas_int*)work6_workArr);
+        gesvdj_syevj<STRIDED, T>(handle, alg_mode, n, V_gemm, ldv_gemm, strideV_gemm, abstol,
+                                 residual, max_sweeps, n_sweeps, S, strideS, info, batch_count,
+                                 work1_UVtmp, work2, work3, work4, work5_ipiv, work6_workArr);
 
         // compute AV
         T* U_gemm = (leftv ? U : (T*)work1_UVtmp);
@@ -326,11 +371,9 @@ rocblas_status rocsolver_gesvdj_notransv_template(rocblas_handle handle,
                          U_gemm, 0, ldu_gemm, strideU_gemm, batch_count, (T**)work6_workArr);
 
         // apply eigenvalue decomposition to -AA', obtaining U as eigenvectors
-        rocsolver_syevj_heevj_template<false, STRIDED, T>(
-            handle, rocblas_esort_ascending, rocblas_evect_original, rocblas_fill_upper, m, U_gemm,
-            0, ldu_gemm, strideU_gemm, abstol, residual, max_sweeps, n_sweeps, S, strideS, info,
-            batch_count, (T*)work1_UVtmp, (T*)work2, (SS*)work3, (rocblas_int*)work4,
-            (rocblas_int*)work5_ipiv, (rocblas_int*)work6_workArr);
+        gesvdj_syevj<STRIDED, T>(handle, alg_mode, m, U_gemm, ldu_gemm, strideU_gemm, abstol,
+                                 residual, max_sweeps, n_sweeps, S, strideS, info, batch_count,
+                                 work1_UVtmp, work2, work3, work4, work5_ipiv, work6_workArr);
 
         // compute A'U
         T* V_gemm = (rightv ? V : (T*)work1_UVtmp);
@@ -0,0 +1,231 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "roclapack_gesvdr.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+template <typename T, typename SS, typename W>
+rocblas_status rocsolver_gesvdr_impl(rocblas_handle handle,
+                                     const rocblas_svect left_svect,
+                                     const rocblas_svect right_svect,
+                                     const rocblas_int m,
+                                     const rocblas_int n,
+                                     W A,
+                                     const rocblas_int lda,
+                                     const rocblas_int k,
+                                     const rocblas_int oversample,
+                                     const rocblas_int niter,
+                                     SS* S,
+                                     T* U,
+                                     const rocblas_int ldu,
+                                     T* V,
+                                     const rocblas_int ldv,
+                                     rocblas_int* info)
+{
+    ROCSOLVER_ENTER_TOP("gesvdr", "--left_svect", left_svect, "--right_svect", right_svect, "-m", m,
+                        "-n", n, "--lda", lda, "-k", k, "--oversample", oversample, "--niter",
+                        niter, "--ldu", ldu, "--ldv", ldv);
+    ROCSOLVER_INFO_SUMMARY(info, 1);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st
+        = rocsolver_gesvdr_argCheck(handle, left_svect, right_svect, m, n, A, lda, k, oversample,
+                                    niter, S, U, ldu, V, ldv, info);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+
+    // normal (non-batched non-strided) execution
+    rocblas_stride strideA = 0;
+    rocblas_stride strideS = 0;
+    rocblas_stride strideU = 0;
+    rocblas_stride strideV = 0;
+    rocblas_int batch_count = 1;
+
+    // memory workspace sizes:
+    // constants in rocblas calls (only whether they are needed, see set_device_scalars)
+    size_t size_scalars;
+    // size for temporary matrix storage
+    size_t size_VUtmp;
+    // extra requirements for calling GESVDJ, GEQRF, ORGQR/UNGQR
+    size_t size_work1_UVtmp, size_work2, size_work3, size_work4, size_work5_ipiv, size_work6_workArr;
+    // size for the sampled bases and the SVD of the projected matrix
+    size_t size_Y, size_Z, size_UB, size_VB, size_Stmp, size_residual, size_sweeps;
+
+    rocsolver_gesvdr_getMemorySize<false, T, SS>(
+        left_svect, right_svect, m, n, k, oversample, batch_count, &size_scalars, &size_VUtmp,
+        &size_work1_UVtmp, &size_work2, &size_work3, &size_work4, &size_work5_ipiv,
+        &size_work6_workArr, &size_Y, &size_Z, &size_UB, &size_VB, &size_Stmp, &size_residual,
+        &size_sweeps);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(
+            handle, size_t(0), size_VUtmp, size_work1_UVtmp, size_work2, size_work3, size_work4,
+            size_work5_ipiv, size_work6_workArr, size_Y, size_Z, size_UB, size_VB, size_Stmp,
+            size_residual, size_sweeps);
+
+    // memory workspace allocation
+    void *scalars, *VUtmp, *work1_UVtmp, *work2, *work3, *work4, *work5_ipiv, *work6_workArr;
+    void *Y, *Z, *UB, *VB, *Stmp, *residual, *sweeps;
+    rocblas_device_malloc mem(handle, size_t(0), size_VUtmp, size_work1_UVtmp, size_work2,
+                              size_work3, size_work4, size_work5_ipiv, size_work6_workArr, size_Y,
+                              size_Z, size_UB, size_VB, size_Stmp, size_residual, size_sweeps);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    scalars = mem[0];
+    VUtmp = mem[1];
+    work1_UVtmp = mem[2];
+    work2 = mem[3];
+    work3 = mem[4];
+    work4 = mem[5];
+    work5_ipiv = mem[6];
+    work6_workArr = mem[7];
+    Y = mem[8];
+    Z = mem[9];
+    UB = mem[10];
+    VB = mem[11];
+    Stmp = mem[12];
+    residual = mem[13];
+    sweeps = mem[14];
+    if(size_scalars > 0)
+        ROCBLAS_CHECK(set_device_scalars<T>(scalars));
+
+    // execution
+    return _info_summary_scope.commit(rocsolver_gesvdr_template<false, false, T>(
+        handle, left_svect, right_svect, m, n, A, shiftA, lda, strideA, k, oversample, niter, S,
+        strideS, U, ldu, strideU, V, ldv, strideV, info, batch_count, (T*)scalars, (T*)VUtmp,
+        work1_UVtmp, work2, work3, work4, work5_ipiv, work6_workArr, (T*)Y, (T*)Z, (T*)UB, (T*)VB,
+        (SS*)Stmp, (SS*)residual, (rocblas_int*)sweeps));
+}
+
+ROCSOLVER_END_NAMESPACE
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sgesvdr(rocblas_handle handle,
+                                 const rocblas_svect left_svect,
+                                 const rocblas_svect right_svect,
+                                 const rocblas_int m,
+                                 const rocblas_int n,
+                                 float* A,
+                                 const rocblas_int lda,
+                                 const rocblas_int k,
+                                 const rocblas_int oversample,
+                                 const rocblas_int niter,
+                                 float* S,
+                                 float* U,
+                                 const rocblas_int ldu,
+                                 float* V,
+                                 const rocblas_int ldv,
+                                 rocblas_int* info)
+{
+    return rocsolver::rocsolver_gesvdr_impl<float>(
+        handle, left_svect, right_svect, m, n, A, lda, k, oversample, niter, S, U, ldu, V, ldv,
+        info);
+}
+
+rocblas_status rocsolver_dgesvdr(rocblas_handle handle,
+                                 const rocblas_svect left_svect,
+                                 const rocblas_svect right_svect,
+                                 const rocblas_int m,
+                                 const rocblas_int n,
+                                 double* A,
+                                 const rocblas_int lda,
+                                 const rocblas_int k,
+                                 const rocblas_int oversample,
+                                 const rocblas_int niter,
+                                 double* S,
+                                 double* U,
+                                 const rocblas_int ldu,
+                                 double* V,
+                                 const rocblas_int ldv,
+                                 rocblas_int* info)
+{
+    return rocsolver::rocsolver_gesvdr_impl<double>(
+        handle, left_svect, right_svect, m, n, A, lda, k, oversample, niter, S, U, ldu, V, ldv,
+        info);
+}
+
+rocblas_status rocsolver_cgesvdr(rocblas_handle handle,
+                                 const rocblas_svect left_svect,
+                                 const rocblas_svect right_svect,
+                                 const rocblas_int m,
+                                 const rocblas_int n,
+                                 rocblas_float_complex* A,
+                                 const rocblas_int lda,
+                                 const rocblas_int k,
+                                 const rocblas_int oversample,
+                                 const rocblas_int niter,
+                                 float* S,
+                                 rocblas_float_complex* U,
+                                 const rocblas_int ldu,
+                                 rocblas_float_complex* V,
+                                 const rocblas_int ldv,
+                                 rocblas_int* info)
+{
+    return rocsolver::rocsolver_gesvdr_impl<rocblas_float_complex>(
+        handle, left_svect, right_svect, m, n, A, lda, k, oversample, niter, S, U, ldu, V, ldv,
+        info);
+}
+
+rocblas_status rocsolver_zgesvdr(rocblas_handle handle,
+                                 const rocblas_svect left_svect,
+                                 const rocblas_svect right_svect,
+                                 const rocblas_int m,
+                                 const rocblas_int n,
+                                 rocblas_double_complex* A,
+                                 const rocblas_int lda,
+                                 const rocblas_int k,
+                                 const rocblas_int oversample,
+                                 const rocblas_int niter,
+                                 double* S,
+                                 rocblas_double_complex* U,
+                                 const rocblas_int ldu,
+                                 rocblas_double_complex* V,
+                                 const rocblas_int ldv,
+                                 rocblas_int* info)
+{
+    return rocsolver::rocsolver_gesvdr_impl<rocblas_double_complex>(
+        handle, left_svect, right_svect, m, n, A, lda, k, oversample, niter, S, U, ldu, V, ldv,
+        info);
+}
+
+} // extern C
@@ -0,0 +1,403 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "auxiliary/rocauxiliary_orgqr_ungqr.hpp"
+#include "rocblas.hpp"
+#include "roclapack_geqrf.hpp"
+#include "roclapack_gesvdj.hpp"
+#include "rocsolver/rocsolver.h"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/** GESVDR_MAX_SWEEPS is the maximum number of Jacobi sweeps used to compute the SVD of the
+    projected matrix **/
+#define GESVDR_MAX_SWEEPS 100
+
+/** GESVDR_SEED is the seed used to generate the Gaussian test matrix **/
+#define GESVDR_SEED 0x5DEECE66DULL
+
+/** GESVDR_GAUSSIAN fills the m-by-n matrix A with samples of the standard normal distribution
+    (Box-Muller transform). For complex types, real and imaginary parts are independent **/
+template <typename T>
+ROCSOLVER_KERNEL void gesvdr_gaussian(const rocblas_int m,
+                                      const rocblas_int n,
+                                      T* AA,
+                                      const rocblas_int lda,
+                                      const rocblas_stride strideA)
+{
+    const auto b = hipBlockIdx_z;
+    const auto j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+    const auto i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(i < m && j < n)
+    {
+        T* A = AA + b * strideA;
+
+        uint64_t key = hash64(GESVDR_SEED + b);
+        uint64_t r1 = hash64(key ^ (i + j * static_cast<uint64_t>(m)));
+        uint64_t r2 = hash64(r1);
+
+        // uniform samples in (0,1] and [0,1)
+        double u1 = ((r1 >> 11) + 1) / 9007199254740992.0;
+        double u2 = (r2 >> 11) / 9007199254740992.0;
+
+        double rad = sqrt(-2.0 * log(u1));
+        double theta = 6.283185307179586 * u2;
+
+        if constexpr(rocblas_is_complex<T>)
+            A[i + j * static_cast<int64_t>(lda)] = T(rad * cos(theta), rad * sin(theta));
+        else
+            A[i + j * static_cast<int64_t>(lda)] = T(rad * cos(theta));
+    }
+}
+
+/** Argument checking **/
+template <typename T, typename SS, typename W>
+rocblas_status rocsolver_gesvdr_argCheck(rocblas_handle handle,
+                                         const rocblas_svect left_svect,
+                                         const rocblas_svect right_svect,
+                                         const rocblas_int m,
+                                         const rocblas_int n,
+                                         W A,
+                                         const rocblas_int lda,
+                                         const rocblas_int k,
+                                         const rocblas_int oversample,
+                                         const rocblas_int niter,
+                                         SS* S,
+                                         T* U,
+                                         const rocblas_int ldu,
+                                         T* V,
+                                         const rocblas_int ldv,
+                                         rocblas_int* info,
+                                         const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(left_svect != rocblas_svect_singular && left_svect != rocblas_svect_none)
+        return rocblas_status_invalid_value;
+    if(right_svect != rocblas_svect_singular && right_svect != rocblas_svect_none)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(n < 0 || m < 0 || lda < m || k < 0 || k > min(m, n) || oversample < 0 || niter < 0
+       || ldu < 1 || ldv < 1 || batch_count < 0)
+        return rocblas_status_invalid_size;
+    if(left_svect == rocblas_svect_singular && ldu < m)
+        return rocblas_status_invalid_size;
+    if(right_svect == rocblas_svect_singular && ldv < k)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n * m && !A) || (k && !S) || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+    if(left_svect == rocblas_svect_singular && m * k && !U)
+        return rocblas_status_invalid_pointer;
+    if(right_svect == rocblas_svect_singular && n * k && !V)
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+/** Helper to calculate workspace sizes **/
+template <bool BATCHED, typename T, typename SS>
+void rocsolver_gesvdr_getMemorySize(const rocblas_svect left_svect,
+                                    const rocblas_svect right_svect,
+                                    const rocblas_int m,
+                                    const rocblas_int n,
+                                    const rocblas_int k,
+                                    const rocblas_int oversample,
+                                    const rocblas_int batch_count,
+                                    size_t* size_scalars,
+                                    size_t* size_VUtmp,
+                                    size_t* size_work1_UVtmp,
+                                    size_t* size_work2,
+                                    size_t* size_work3,
+                                    size_t* size_work4,
+                                    size_t* size_work5_ipiv,
+                                    size_t* size_work6_workArr,
+                                    size_t* size_Y,
+                                    size_t* size_Z,
+                                    size_t* size_UB,
+                                    size_t* size_VB,
+                                    size_t* size_Stmp,
+                                    size_t* size_residual,
+                                    size_t* size_sweeps)
+{
+    // if quick return, set workspace to zero
+    if(n == 0 || m == 0 || k == 0 || batch_count == 0)
+    {
+        *size_scalars = 0;
+        *size_VUtmp = 0;
+        *size_work1_UVtmp = 0;
+        *size_work2 = 0;
+        *size_work3 = 0;
+        *size_work4 = 0;
+        *size_work5_ipiv = 0;
+        *size_work6_workArr = 0;
+        *size_Y = 0;
+        *size_Z = 0;
+        *size_UB = 0;
+        *size_VB = 0;
+        *size_Stmp = 0;
+        *size_residual = 0;
+        *size_sweeps = 0;
+        return;
+    }
+
+    // size of the sampled subspace
+    rocblas_int l = min(k + min(oversample, min(m, n)), min(m, n));
+
+    size_t b1, b2, b3, b4, b5;
+    size_t c1, c2, c3, c4, c5;
+    size_t d1, d2, d3, d4, d5;
+    size_t e1, e2;
+    size_t f1, f2, f3, f4, f5, f6 = 0;
+    size_t unused;
+
+    // requirements for the SVD of the projected matrix
+    rocsolver_gesvdj_getMemorySize<false, T, SS>(left_svect, right_svect, l, n, batch_count,
+                                                 rocsolver_alg_mode_qr, size_scalars, size_VUtmp,
+                                                 size_work1_UVtmp, &b1, &c1, &d1, &e1, &f1);
+
+    // requirements for the orthonormalization of the sampled bases
+    rocsolver_geqrf_getMemorySize<false, T>(m, l, batch_count, &unused, &b2, &c2, &d2, &f2);
+    rocsolver_orgqr_ungqr_getMemorySize<false, T>(m, l, l, batch_count, &unused, &b3, &c3, &d3,
+                                                  &f3);
+    rocsolver_geqrf_getMemorySize<false, T>(n, l, batch_count, &unused, &b4, &c4, &d4, &f4);
+    rocsolver_orgqr_ungqr_getMemorySize<false, T>(n, l, l, batch_count, &unused, &b5, &c5, &d5,
+                                                  &f5);
+
+    // extra requirements for temporary Householder scalars
+    e2 = sizeof(T) * l * batch_count;
+
+    // size of array of pointers (batched cases)
+    if(BATCHED)
+        f6 = sizeof(T*) * 2 * batch_count;
+
+    *size_work2 = std::max({b1, b2, b3, b4, b5});
+    *size_work3 = std::max({c1, c2, c3, c4, c5});
+    *size_work4 = std::max({d1, d2, d3, d4, d5});
+    *size_work5_ipiv = std::max({e1, e2});
+    *size_work6_workArr = std::max({f1, f2, f3, f4, f5, f6});
+
+    // extra requirements for the sampled bases and the SVD of the projected matrix
+    *size_Y = sizeof(T) * m * l * batch_count;
+    *size_Z = sizeof(T) * n * l * batch_count;
+    *size_UB = (left_svect == rocblas_svect_singular) ? sizeof(T) * l * l * batch_count : 0;
+    *size_VB = (right_svect == rocblas_svect_singular) ? sizeof(T) * l * n * batch_count : 0;
+    *size_Stmp = sizeof(SS) * l * batch_count;
+    *size_residual = sizeof(SS) * batch_count;
+    *size_sweeps = sizeof(rocblas_int) * batch_count;
+}
+
+/** Helper to replace the m-by-n matrix A with an orthonormal basis of its column space **/
+template <typename T>
+void rocsolver_gesvdr_orthonormalize(rocblas_handle handle,
+                                     const rocblas_int m,
+                                     const rocblas_int n,
+                                     T* A,
+                                     const rocblas_int lda,
+                                     const rocblas_stride strideA,
+                                     const rocblas_int batch_count,
+                                     T* scalars,
+                                     void* work2,
+                                     void* work3,
+                                     void* work4,
+                                     void* work5_ipiv,
+                                     void* work6_workArr)
+{
+    rocsolver_geqrf_template<false, true, T>(handle, m, n, A, 0, lda, strideA, (T*)work5_ipiv, n,
+                                             batch_count, scalars, work2, (T*)work3, (T*)work4,
+                                             (T**)work6_workArr);
+    rocsolver_orgqr_ungqr_template<false, true, T>(handle, m, n, n, A, 0, lda, strideA,
+                                                   (T*)work5_ipiv, n, batch_count, scalars,
+                                                   (T*)work2, (T*)work3, (T*)work4,
+                                                   (T**)work6_workArr);
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename SS, typename W>
+rocblas_status rocsolver_gesvdr_template(rocblas_handle handle,
+                                         const rocblas_svect left_svect,
+                                         const rocblas_svect right_svect,
+                                         const rocblas_int m,
+                                         const rocblas_int n,
+                                         W A,
+                                         const rocblas_int shiftA,
+                                         const rocblas_int lda,
+                                         const rocblas_stride strideA,
+                                         const rocblas_int k,
+                                         const rocblas_int oversample,
+                                         const rocblas_int niter,
+                                         SS* S,
+                                         const rocblas_stride strideS,
+                                         T* U,
+                                         const rocblas_int ldu,
+                                         const rocblas_stride strideU,
+                                         T* V,
+                                         const rocblas_int ldv,
+                                         const rocblas_stride strideV,
+                                         rocblas_int* info,
+                                         const rocblas_int batch_count,
+                                         T* scalars,
+                                         T* VUtmp,
+                                         void* work1_UVtmp,
+                                         void* work2,
+                                         void* work3,
+                                         void* work4,
+                                         void* work5_ipiv,
+                                         void* work6_workArr,
+                                         T* Y,
+                                         T* Z,
+                                         T* UB,
+                                         T* VB,
+                                         SS* Stmp,
+                                         SS* residual,
+                                         rocblas_int* sweeps)
+{
+    ROCSOLVER_ENTER("gesvdr", "leftsv:", left_svect, "rightsv:", right_svect, "m:", m, "n:", n,
+                    "shiftA:", shiftA, "lda:", lda, "k:", k, "oversample:", oversample,
+                    "niter:", niter, "ldu:", ldu, "ldv:", ldv, "bc:", batch_count);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // quick return
+    if(m == 0 || n == 0 || k == 0)
+    {
+        rocblas_int blocksReset = (batch_count - 1) / BS1 + 1;
+        dim3 gridReset(blocksReset, 1, 1);
+        dim3 threadsReset(BS1, 1, 1);
+
+        ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threadsReset, 0, stream, info, batch_count, 0);
+
+        return rocblas_status_success;
+    }
+
+    // everything must be executed with scalars on the host
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+
+    bool leftv = left_svect == rocblas_svect_singular;
+    bool rightv = right_svect == rocblas_svect_singular;
+    T one = T(1);
+    T zero = T(0);
+
+    // size of the sampled subspace
+    rocblas_int l = min(k + min(oversample, min(m, n)), min(m, n));
+
+    // Y is m-by-l and Z is n-by-l (Z also holds the l-by-n projected matrix)
+    rocblas_int ldy = m;
+    rocblas_stride strideY = m * l;
+    rocblas_int ldz = n;
+    rocblas_stride strideZ = n * l;
+
+    // draw the Gaussian test matrix and sample the range of A
+    rocblas_int blocks_n = (n - 1) / BS2 + 1;
+    rocblas_int blocks_l = (l - 1) / BS2 + 1;
+    ROCSOLVER_LAUNCH_KERNEL(gesvdr_gaussian<T>, dim3(blocks_n, blocks_l, batch_count),
+                            dim3(BS2, BS2, 1), 0, stream, n, l, Z, ldz, strideZ);
+
+    rocblasCall_gemm(handle, rocblas_operation_none, rocblas_operation_none, m, l, n, &one, A,
+                     shiftA, lda, strideA, Z, 0, ldz, strideZ, &zero, Y, 0, ldy, strideY,
+                     batch_count, (T**)work6_workArr);
+
+    // power iterations, re-orthonormalizing the samples at every product to preserve the
+    // information associated with the smaller singular values
+    for(rocblas_int it = 0; it < niter; it++)
+    {
+        rocsolver_gesvdr_orthonormalize<T>(handle, m, l, Y, ldy, strideY, batch_count, scalars,
+                                           work2, work3, work4, work5_ipiv, work6_workArr);
+
+        rocblasCall_gemm(handle, rocblas_operation_conjugate_transpose, rocblas_operation_none, n,
+                         l, m, &one, A, shiftA, lda, strideA, Y, 0, ldy, strideY, &zero, Z, 0, ldz,
+                         strideZ, batch_count, (T**)work6_workArr);
+
+        rocsolver_gesvdr_orthonormalize<T>(handle, n, l, Z, ldz, strideZ, batch_count, scalars,
+                                           work2, work3, work4, work5_ipiv, work6_workArr);
+
+        rocblasCall_gemm(handle, rocblas_operation_none, rocblas_operation_none, m, l, n, &one, A,
+                         shiftA, lda, strideA, Z, 0, ldz, strideZ, &zero, Y, 0, ldy, strideY,
+                         batch_count, (T**)work6_workArr);
+    }
+
+    // Q = orthonormal basis of the sampled range
+    rocsolver_gesvdr_orthonormalize<T>(handle, m, l, Y, ldy, strideY, batch_count, scalars, work2,
+                                       work3, work4, work5_ipiv, work6_workArr);
+
+    // project A onto the subspace: B = Q'A (stored in Z)
+    rocblas_int ldb = l;
+    rocblas_stride strideB = l * n;
+
+    rocblasCall_gemm(handle, rocblas_operation_conjugate_transpose, rocblas_operation_none, l, n,
+                     m, &one, Y, 0, ldy, strideY, A, shiftA, lda, strideA, &zero, Z, 0, ldb,
+                     strideB, batch_count, (T**)work6_workArr);
+
+    // SVD of the small projected matrix
+    rocblas_int ldub = l;
+    rocblas_stride strideUB = l * l;
+    rocblas_int ldvb = l;
+    rocblas_stride strideVB = l * n;
+
+    rocsolver_gesvdj_template<false, true, T>(
+        handle, left_svect, right_svect, l, n, Z, 0, ldb, strideB, SS(0), residual,
+        GESVDR_MAX_SWEEPS, sweeps, Stmp, l, UB, ldub, strideUB, VB, ldvb, strideVB, info,
+        batch_count, rocsolver_alg_mode_qr, scalars, VUtmp, work1_UVtmp, work2, work3, work4,
+        work5_ipiv, work6_workArr);
+
+    // keep the leading k singular triplets
+    rocblas_int blocks_k = (k - 1) / BS2 + 1;
+    ROCSOLVER_LAUNCH_KERNEL(copy_mat<SS>, dim3(1, blocks_k, batch_count), dim3(BS2, BS2, 1), 0,
+                            stream, 1, k, Stmp, 0, 1, l, S, 0, 1, strideS);
+
+    // U = Q * U_B
+    if(leftv)
+        rocblasCall_gemm(handle, rocblas_operation_none, rocblas_operation_none, m, k, l, &one, Y,
+                         0, ldy, strideY, UB, 0, ldub, strideUB, &zero, U, 0, ldu, strideU,
+                         batch_count, (T**)work6_workArr);
+
+    if(rightv)
+        ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, dim3(blocks_k, blocks_n, batch_count),
+                                dim3(BS2, BS2, 1), 0, stream, k, n, VB, 0, ldvb, strideVB, V, 0,
+                                ldv, strideV);
+
+    rocblas_set_pointer_mode(handle, old_mode);
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
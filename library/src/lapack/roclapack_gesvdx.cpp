@@ -54,6 +54,7 @@ rocblas_status rocsolver_gesvdx_impl(rocblas_handle handle,
     ROCSOLVER_ENTER_TOP("gesvdx", "--left_svect", left_svect, "--right_svect", right_svect,
                         "--srange", srange, "-m", m, "-n", n, "--lda", lda, "--vl", vl, "--vu", vu,
                         "--il", il, "--iu", iu, "--ldu", ldu, "--ldv", ldv);
+    ROCSOLVER_INFO_SUMMARY(info, 1);
 
     if(!handle)
         return rocblas_status_invalid_handle;
@@ -111,7 +112,7 @@ rocblas_status rocsolver_gesvdx_impl(rocblas_handle handle,
 
     if(rocblas_is_device_memory_size_query(handle))
         return rocblas_set_optimal_device_memory_size(
-            handle, size_scalars, size_WS_svdx1, size_WS_svdx2_lqrf1_brd1, size_WS_svdx3_lqrf2_brd2,
+            handle, size_t(0), size_WS_svdx1, size_WS_svdx2_lqrf1_brd1, size_WS_svdx3_lqrf2_brd2,
             size_WS_svdx4_lqrf3_brd3, size_WS_svdx5_brd4, size_WS_svdx6, size_WS_svdx7,
             size_WS_svdx8, size_WS_svdx9, size_WS_svdx10_mlqr1_mbr1, size_WS_svdx11_mlqr2_mbr2,
             size_WS_svdx12_mlqr3_mbr3, size_tmpDE, size_tauqp, size_tmpZ, size_tau, size_tmpT,
@@ -139,7 +140,7 @@ rocblas_status rocsolver_gesvdx_impl(rocblas_handle handle,
     void* workArr;
     void* workArr2;
 
-    rocblas_device_malloc mem(handle, size_scalars, size_WS_svdx1, size_WS_svdx2_lqrf1_brd1,
+    rocblas_device_malloc mem(handle, size_t(0), size_WS_svdx1, size_WS_svdx2_lqrf1_brd1,
                               size_WS_svdx3_lqrf2_brd2, size_WS_svdx4_lqrf3_brd3,
                               size_WS_svdx5_brd4, size_WS_svdx6, size_WS_svdx7, size_WS_svdx8,
                               size_WS_svdx9, size_WS_svdx10_mlqr1_mbr1, size_WS_svdx11_mlqr2_mbr2,
@@ -170,16 +171,17 @@ rocblas_status rocsolver_gesvdx_impl(rocblas_handle handle,
     workArr = mem[18];
     workArr2 = mem[19];
     if(size_scalars > 0)
-        init_scalars(handle, (T*)scalars);
+        ROCBLAS_CHECK(set_device_scalars<T>(scalars));
 
     // execution
-    return rocsolver_gesvdx_template<false, false, T>(
+    return _info_summary_scope.commit(rocsolver_gesvdx_template<false, false, T>(
         handle, left_svect, right_svect, srange, m, n, A, shiftA, lda, strideA, vl, vu, il, iu, nsv,
-        S, strideS, U, ldu, strideU, V, ldv, strideV, ifail, strideF, info, batch_count, (T*)scalars,
-        (rocblas_int*)WS_svdx1, WS_svdx2_lqrf1_brd1, WS_svdx3_lqrf2_brd2, WS_svdx4_lqrf3_brd3,
-        WS_svdx5_brd4, (rocblas_int*)WS_svdx6, (rocblas_int*)WS_svdx7, (rocblas_int*)WS_svdx8,
-        (rocblas_int*)WS_svdx9, WS_svdx10_mlqr1_mbr1, WS_svdx11_mlqr2_mbr2, WS_svdx12_mlqr3_mbr3,
-        (TT*)tmpDE, (T*)tauqp, (TT*)tmpZ, (T*)tau, (T*)tmpT, (T**)workArr, (T**)workArr2);
+        S, strideS, U, ldu, strideU, V, ldv, strideV, ifail, strideF, info, batch_count,
+        (T*)scalars, (rocblas_int*)WS_svdx1, WS_svdx2_lqrf1_brd1, WS_svdx3_lqrf2_brd2,
+        WS_svdx4_lqrf3_brd3, WS_svdx5_brd4, (rocblas_int*)WS_svdx6, (rocblas_int*)WS_svdx7,
+        (rocblas_int*)WS_svdx8, (rocblas_int*)WS_svdx9, WS_svdx10_mlqr1_mbr1, WS_svdx11_mlqr2_mbr2,
+        WS_svdx12_mlqr3_mbr3, (TT*)tmpDE, (T*)tauqp, (TT*)tmpZ, (T*)tau, (T*)tmpT, (T**)workArr,
+        (T**)workArr2));
 }
 
 ROCSOLVER_END_NAMESPACE
@@ -45,6 +45,38 @@
 
 ROCSOLVER_BEGIN_NAMESPACE
 
+/** GESVDX_NSV_NCOLS determines the number of singular vectors that must be copied from the
+    bidiagonal solver and back-transformed. With srange = value, the number of singular values
+    found is only known on the device; for large enough matrices it is read back (with the same
+    threshold as SYEVX_READ_NEV_MIN_SIZE), so that the later stages work on max(nsv) vectors of
+    every problem in the batch rather than on min(m,n). **/
+inline rocblas_status gesvdx_nsv_ncols(rocblas_handle handle,
+                                       const rocblas_srange srange,
+                                       const rocblas_int k,
+                                       const rocblas_int nsv_max,
+                                       rocblas_int* nsv,
+                                       const rocblas_int batch_count,
+                                       rocblas_int* ncols)
+{
+    *ncols = nsv_max;
+    if(srange != rocblas_srange_value || k < SYEVX_READ_NEV_MIN_SIZE || batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+    if(stream_is_capturing(stream))
+        return rocblas_status_success;
+
+    std::vector<rocblas_int> hnsv(batch_count);
+    HIP_CHECK(hipMemcpyAsync(hnsv.data(), nsv, sizeof(rocblas_int) * batch_count,
+                             hipMemcpyDeviceToHost, stream));
+    rocsolver_stats_host_sync();
+    HIP_CHECK(hipStreamSynchronize(stream));
+    *ncols = std::min(nsv_max, *std::max_element(hnsv.begin(), hnsv.end()));
+
+    return rocblas_status_success;
+}
+
 /** Argument checking **/
 template <typename T, typename TT, typename W>
 rocblas_status rocsolver_gesvdx_argCheck(rocblas_handle handle,
@@ -189,10 +221,12 @@ void rocsolver_gesvdx_getMemorySize(const rocblas_svect left_svect,
     // general requirements for bdsvdx and gebrd
     *size_tmpDE = 2 * k * sizeof(S) * bc;
     *size_tauqp = 2 * k * sizeof(T) * bc;
-    *size_tmpZ = 2 * k * nsv_max * sizeof(S) * bc;
-    rocsolver_bdsvdx_getMemorySize<S>(k, bc, size_WS_svdx1, &a[0], &b[0], &c[0], &d[0],
-                                      size_WS_svdx6, size_WS_svdx7, size_WS_svdx8, size_WS_svdx9,
-                                      &e[0], &f[0], &g[0]);
+    const rocblas_svect svect = (leftvS || rightvS) ? rocblas_svect_singular : rocblas_svect_none;
+    // (the singular vectors of the bidiagonal matrix are only needed if U or V are requested)
+    *size_tmpZ = (svect == rocblas_svect_none) ? 0 : 2 * k * nsv_max * sizeof(S) * bc;
+    rocsolver_bdsvdx_getMemorySize<S>(svect, srange, k, il, iu, bc, size_WS_svdx1, &a[0], &b[0],
+                                      &c[0], &d[0], size_WS_svdx6, size_WS_svdx7, size_WS_svdx8,
+                                      size_WS_svdx9, &e[0], &f[0], &g[0]);
 
     if(thinSVD)
     {
@@ -438,30 +472,32 @@ rocblas_status rocsolver_gesvdx_template(rocblas_handle handle,
         (TT*)WS_svdx5_brd4, WS_svdx6, WS_svdx7, WS_svdx8, WS_svdx9, (TT*)WS_svdx10_mlqr1_mbr1,
         (TT*)WS_svdx11_mlqr2_mbr2, (TT*)WS_svdx12_mlqr3_mbr3);
 
+    // number of vectors to copy and update (at most nsv_max, or max(nsv) if it was read back)
+    rocblas_int nsv_cols = nsv_max;
+    if(leftvS || rightvS)
+        ROCBLAS_CHECK(gesvdx_nsv_ncols(handle, srange, k, nsv_max, nsv, batch_count, &nsv_cols));
+    const rocblas_int blocks_cols = (nsv_cols - 1) / thread_count + 1;
+
     /***** 3. compute/update left vectors *****/
     /******************************************/
     if(leftvS)
     {
-        // For now we work with the nsv_max columns in tmpZ, i.e. nsv_max vectors
-        // (TODO: explore other options like transfering nsv to the host, or having
-        //  template functions accepting dimensions as pointers)
-
         // initialize matrix U
         ROCSOLVER_LAUNCH_KERNEL(set_zero<T>, dim3(blocks_m, blocks_nsv, batch_count),
                                 dim3(thread_count, thread_count, 1), 0, stream, m, nsv_max, U, 0,
                                 ldu, strideU);
 
         // copy left vectors to matrix U
-        ROCSOLVER_LAUNCH_KERNEL(copy_trans_mat, dim3(blocks_k, blocks_nsv, batch_count),
+        ROCSOLVER_LAUNCH_KERNEL(copy_trans_mat, dim3(blocks_k, blocks_cols, batch_count),
                                 dim3(thread_count, thread_count, 1), 0, stream,
-                                rocblas_operation_none, k, nsv_max, tmpZ, 0, ldz, strideZ, U, 0,
+                                rocblas_operation_none, k, nsv_cols, tmpZ, 0, ldz, strideZ, U, 0,
                                 ldu, strideU);
 
         if(thinSVD)
         {
             // apply ormbr (update with tranformation from bidiagonalization)
             rocsolver_ormbr_unmbr_template<false, STRIDED>(
-                handle, rocblas_column_wise, rocblas_side_left, rocblas_operation_none, k, nsv_max,
+                handle, rocblas_column_wise, rocblas_side_left, rocblas_operation_none, k, nsv_cols,
                 k, tmpT, 0, ldt, strideT, tauqp, k, U, 0, ldu, strideU, batch_count, scalars,
                 (T*)WS_svdx10_mlqr1_mbr1, (T*)WS_svdx11_mlqr2_mbr2, (T*)WS_svdx12_mlqr3_mbr3,
                 workArr);
@@ -470,7 +506,7 @@ rocblas_status rocsolver_gesvdx_template(rocblas_handle handle,
             {
                 // apply ormqr (update with transformation from row compression)
                 rocsolver_ormqr_unmqr_template<BATCHED, STRIDED>(
-                    handle, rocblas_side_left, rocblas_operation_none, m, nsv_max, k, A, shiftA,
+                    handle, rocblas_side_left, rocblas_operation_none, m, nsv_cols, k, A, shiftA,
                     lda, strideA, tau, k, U, 0, ldu, strideU, batch_count, scalars,
                     (T*)WS_svdx10_mlqr1_mbr1, (T*)WS_svdx11_mlqr2_mbr2, (T*)WS_svdx12_mlqr3_mbr3,
                     workArr, workArr2);
@@ -482,10 +518,10 @@ rocblas_status rocsolver_gesvdx_template(rocblas_handle handle,
             rocblas_int mm = row ? m : k;
             rocblas_int kk = row ? k : n;
             rocsolver_ormbr_unmbr_template<BATCHED, STRIDED>(
-                handle, rocblas_column_wise, rocblas_side_left, rocblas_operation_none, mm, nsv_max,
-                kk, A, shiftA, lda, strideA, tauqp, k, U, 0, ldu, strideU, batch_count, scalars,
-                (T*)WS_svdx10_mlqr1_mbr1, (T*)WS_svdx11_mlqr2_mbr2, (T*)WS_svdx12_mlqr3_mbr3,
-                workArr);
+                handle, rocblas_column_wise, rocblas_side_left, rocblas_operation_none, mm,
+                nsv_cols, kk, A, shiftA, lda, strideA, tauqp, k, U, 0, ldu, strideU, batch_count,
+                scalars, (T*)WS_svdx10_mlqr1_mbr1, (T*)WS_svdx11_mlqr2_mbr2,
+                (T*)WS_svdx12_mlqr3_mbr3, workArr);
         }
     }
 
@@ -493,26 +529,22 @@ rocblas_status rocsolver_gesvdx_template(rocblas_handle handle,
     /**********************************************/
     if(rightvS)
     {
-        // For now we work with the k columns in tmpZ, i.e. k vectors
-        // (TODO: explore other options like transfering nsv to the host, or having
-        //  template functions accepting dimensions as pointers)
-
         // initialize matrix V
         ROCSOLVER_LAUNCH_KERNEL(set_zero<T>, dim3(blocks_nsv, blocks_n, batch_count),
                                 dim3(thread_count, thread_count, 1), 0, stream, nsv_max, n, V, 0,
                                 ldv, strideV);
 
         // copy right vectors to matrix V
-        ROCSOLVER_LAUNCH_KERNEL(copy_trans_mat, dim3(blocks_k, blocks_nsv, batch_count),
+        ROCSOLVER_LAUNCH_KERNEL(copy_trans_mat, dim3(blocks_k, blocks_cols, batch_count),
                                 dim3(thread_count, thread_count, 1), 0, stream,
-                                rocblas_operation_transpose, k, nsv_max, tmpZ, k, ldz, strideZ, V,
+                                rocblas_operation_transpose, k, nsv_cols, tmpZ, k, ldz, strideZ, V,
                                 0, ldv, strideV);
 
         if(thinSVD)
         {
             // apply ormbr (update with tranformation from bidiagonalization)
             rocsolver_ormbr_unmbr_template<false, STRIDED>(
-                handle, rocblas_row_wise, rocblas_side_right, rocblas_operation_transpose, nsv_max,
+                handle, rocblas_row_wise, rocblas_side_right, rocblas_operation_transpose, nsv_cols,
                 k, k, tmpT, 0, ldt, strideT, (tauqp + k * batch_count), k, V, 0, ldv, strideV,
                 batch_count, scalars, (T*)WS_svdx10_mlqr1_mbr1, (T*)WS_svdx11_mlqr2_mbr2,
                 (T*)WS_svdx12_mlqr3_mbr3, workArr);
@@ -521,7 +553,7 @@ rocblas_status rocsolver_gesvdx_template(rocblas_handle handle,
             {
                 // apply ormlq (update with transformation from column compression)
                 rocsolver_ormlq_unmlq_template<BATCHED, STRIDED>(
-                    handle, rocblas_side_right, rocblas_operation_none, nsv_max, n, k, A, shiftA,
+                    handle, rocblas_side_right, rocblas_operation_none, nsv_cols, n, k, A, shiftA,
                     lda, strideA, tau, k, V, 0, ldv, strideV, batch_count, scalars,
                     (T*)WS_svdx10_mlqr1_mbr1, (T*)WS_svdx11_mlqr2_mbr2, (T*)WS_svdx12_mlqr3_mbr3,
                     workArr, workArr2);
@@ -533,7 +565,7 @@ rocblas_status rocsolver_gesvdx_template(rocblas_handle handle,
             rocblas_int nn = row ? k : n;
             rocblas_int kk = row ? m : k;
             rocsolver_ormbr_unmbr_template<BATCHED, STRIDED>(
-                handle, rocblas_row_wise, rocblas_side_right, rocblas_operation_transpose, nsv_max,
+                handle, rocblas_row_wise, rocblas_side_right, rocblas_operation_transpose, nsv_cols,
                 nn, kk, A, shiftA, lda, strideA, (tauqp + k * batch_count), k, V, 0, ldv, strideV,
                 batch_count, scalars, (T*)WS_svdx10_mlqr1_mbr1, (T*)WS_svdx11_mlqr2_mbr2,
                 (T*)WS_svdx12_mlqr3_mbr3, workArr);
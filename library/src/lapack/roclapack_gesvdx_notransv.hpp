@@ -190,9 +190,10 @@ void rocsolver_gesvdx_notransv_getMemorySize(const rocblas_svect left_svect,
     *size_tmpDE = 2 * k * sizeof(S) * bc;
     *size_tauqp = 2 * k * sizeof(T) * bc;
     *size_tmpZ = 2 * k * nsv_max * sizeof(S) * bc;
-    rocsolver_bdsvdx_getMemorySize<S>(k, bc, size_WS_svdx1, &a[0], &b[0], &c[0], &d[0],
-                                      size_WS_svdx6, size_WS_svdx7, size_WS_svdx8, size_WS_svdx9,
-                                      &e[0], &f[0], &g[0]);
+    const rocblas_svect svect = (leftvS || rightvS) ? rocblas_svect_singular : rocblas_svect_none;
+    rocsolver_bdsvdx_getMemorySize<S>(svect, srange, k, il, iu, bc, size_WS_svdx1, &a[0], &b[0],
+                                      &c[0], &d[0], size_WS_svdx6, size_WS_svdx7, size_WS_svdx8,
+                                      size_WS_svdx9, &e[0], &f[0], &g[0]);
 
     if(thinSVD)
     {
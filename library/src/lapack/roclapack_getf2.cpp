@@ -41,6 +41,7 @@ rocblas_status rocsolver_getf2_impl(rocblas_handle handle,
 {
     const char* name = (pivot ? "getf2" : "getf2_npvt");
     ROCSOLVER_ENTER_TOP(name, "-m", m, "-n", n, "--lda", lda);
+    ROCSOLVER_INFO_SUMMARY(info, 1);
 
     using S = decltype(std::real(T{}));
 
@@ -63,7 +64,7 @@ rocblas_status rocsolver_getf2_impl(rocblas_handle handle,
     I batch_count = 1;
 
     // memory workspace sizes:
-    // size for constants in rocblas calls
+    // constants in rocblas calls (only whether they are needed, see set_device_scalars)
     size_t size_scalars;
     // sizes to store pivots in intermediate computations
     size_t size_pivotval;
@@ -72,12 +73,12 @@ rocblas_status rocsolver_getf2_impl(rocblas_handle handle,
                                             &size_pivotidx);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_pivotval,
+        return rocblas_set_optimal_device_memory_size(handle, size_t(0), size_pivotval,
                                                       size_pivotidx);
 
     // memory workspace allocation
     void *scalars, *pivotidx, *pivotval;
-    rocblas_device_malloc mem(handle, size_scalars, size_pivotval, size_pivotidx);
+    rocblas_device_malloc mem(handle, size_t(0), size_pivotval, size_pivotidx);
 
     if(!mem)
         return rocblas_status_memory_error;
@@ -86,12 +87,12 @@ rocblas_status rocsolver_getf2_impl(rocblas_handle handle,
     pivotval = mem[1];
     pivotidx = mem[2];
     if(size_scalars > 0)
-        init_scalars(handle, (T*)scalars);
+        ROCBLAS_CHECK(set_device_scalars<T>(scalars));
 
     // execution
-    return rocsolver_getf2_template<false, T>(handle, m, n, A, shiftA, inca, lda, strideA, ipiv,
-                                              shiftP, strideP, info, batch_count, (T*)scalars,
-                                              (T*)pivotval, (I*)pivotidx, pivot);
+    return _info_summary_scope.commit(rocsolver_getf2_template<false, T>(
+        handle, m, n, A, shiftA, inca, lda, strideA, ipiv, shiftP, strideP, info, batch_count,
+        (T*)scalars, (T*)pivotval, (I*)pivotidx, pivot));
 }
 
 ROCSOLVER_END_NAMESPACE
@@ -110,14 +110,19 @@ ROCSOLVER_KERNEL void getf2_check_singularity(const I n,
             }
 
             // update info (check singularity)
+            // (the first column of the matrix initializes info)
             if(A[j * inca + j * lda] == 0)
             {
                 pivot_val[id] = 1;
-                if(info[id] == 0)
+                if(info[id] == 0 || j + offset == 0)
                     info[id] = static_cast<INFO>(j + 1 + offset); // use Fortran 1-based indexing
             }
             else
+            {
                 pivot_val[id] = S(1) / A[j * inca + j * lda];
+                if(j + offset == 0)
+                    info[id] = 0;
+            }
         }
     }
 }
@@ -142,14 +147,19 @@ ROCSOLVER_KERNEL void getf2_npvt_check_singularity(const I j,
     T* A = load_ptr_batch<T>(AA, id, shiftA, strideA);
 
     // update info (check singularity)
+    // (the first column of the matrix initializes info)
     if(A[j * inca + j * lda] == 0)
     {
         pivot_val[id] = 1;
-        if(info[id] == 0)
+        if(info[id] == 0 || j + offset == 0)
             info[id] = static_cast<INFO>(j + 1 + offset); // use Fortran 1-based indexing
     }
     else
+    {
         pivot_val[id] = S(1) / A[j * inca + j * lda];
+        if(j + offset == 0)
+            info[id] = 0;
+    }
 }
 
 /** This kernel executes an optimized reduction to find the index of the
@@ -204,12 +214,17 @@ inline I getf2_get_checksingularity_blksize(const I n)
 /** This function tests if one of the specialized kernels should be used.
     Returns 1 when the use of the small kernel will give better performance,
     Returns 2 when the use of the panel kernel will give better performance,
+    Returns 3 when the panel is too tall for the panel kernel, and the cooperative version
+    should be used,
     Returns 0 when it would be better to use the normal code. **/
 template <bool ISBATCHED, typename T, typename I, std::enable_if_t<!rocblas_is_complex<T>, int> = 0>
 int select_spkernel(const I m, const I n, const I inca, const bool pivot)
 {
     int ker = 0;
 
+    if(m > GETF2_SPKER_MAX_M && m <= GETF2_COOP_MAX_M && n <= GETF2_SPKER_MAX_N && inca == 1)
+        return 3;
+
     if(m > GETF2_SPKER_MAX_M || n > GETF2_SPKER_MAX_N || inca != 1)
         return ker;
 
@@ -311,6 +326,9 @@ int select_spkernel(const I m, const I n, const I inca, const bool pivot)
 {
     int ker = 0;
 
+    if(m > GETF2_SPKER_MAX_M && m <= GETF2_COOP_MAX_M && n <= GETF2_SPKER_MAX_N && inca == 1)
+        return 3;
+
     if(m > GETF2_SPKER_MAX_M || n > GETF2_SPKER_MAX_N || inca != 1)
         return ker;
 
@@ -489,8 +507,8 @@ void rocsolver_getf2_getMemorySize(const I m,
     }
 
 #ifdef OPTIMAL
-    bool nomem = (!std::is_same<I, int64_t>::value
-                  && select_spkernel<ISBATCHED, T>(m, n, inca, pivot) && !inblocked);
+    int spker = select_spkernel<ISBATCHED, T>(m, n, inca, pivot);
+    bool nomem = (!std::is_same<I, int64_t>::value && (spker == 1 || spker == 2) && !inblocked);
 
     // no workspace needed if using optimized kernel for small sizes
     if(nomem)
@@ -512,6 +530,20 @@ void rocsolver_getf2_getMemorySize(const I m,
 
     // for pivot indices
     *size_pivotidx = pivot ? sizeof(I) * batch_count : 0;
+
+#ifdef OPTIMAL
+    // the cooperative panel kernel needs the partial maxima of all the groups
+    // (at most one group per GETF2_COOP_THDS rows; when inblocked, the sub blocks
+    //  can be narrower and shorter than the whole matrix)
+    bool coop = (m > GETF2_SPKER_MAX_M)
+        && (inblocked || (m <= GETF2_COOP_MAX_M && n <= GETF2_SPKER_MAX_N));
+    if(pivot && coop && inca == 1)
+    {
+        size_t nblk = (std::min(m, I(GETF2_COOP_MAX_M)) - 1) / GETF2_COOP_THDS + 1;
+        *size_pivotval = sizeof(T) * batch_count * nblk;
+        *size_pivotidx = sizeof(I) * batch_count * nblk;
+    }
+#endif
 }
 
 /** argument checking **/
@@ -524,7 +556,8 @@ rocblas_status rocsolver_getf2_getrf_argCheck(rocblas_handle handle,
                                               I* ipiv,
                                               INFO* info,
                                               const bool pivot,
-                                              const I batch_count = 1)
+                                              const I batch_count = 1,
+                                              const I inca = 1)
 {
     // order is important for unit tests:
 
@@ -532,7 +565,7 @@ rocblas_status rocsolver_getf2_getrf_argCheck(rocblas_handle handle,
     // N/A
 
     // 2. invalid size
-    if(m < 0 || n < 0 || lda < m || batch_count < 0)
+    if(m < 0 || n < 0 || inca < 1 || lda < inca * m || batch_count < 0)
         return rocblas_status_invalid_size;
 
     // skip pointer check if querying memory size
@@ -583,13 +616,15 @@ rocblas_status rocsolver_getf2_template(rocblas_handle handle,
     dim3 threads(256, 1, 1);
     I dim = std::min(m, n); // total number of pivots
 
-    // info=0 (starting with a nonsingular matrix)
-    if(offset == 0)
-        ROCSOLVER_LAUNCH_KERNEL(reset_info, grid, threads, 0, stream, info, batch_count, 0);
-
     // quick return if no dimensions
+    // (otherwise, info is initialized by the kernel that factorizes the first column)
     if(m == 0 || n == 0)
+    {
+        // info=0 (starting with a nonsingular matrix)
+        if(offset == 0)
+            ROCSOLVER_LAUNCH_KERNEL(reset_info, grid, threads, 0, stream, info, batch_count, 0);
         return rocblas_status_success;
+    }
 
     // initialize permutation array if needed
     if(permut_idx)
@@ -618,6 +653,15 @@ rocblas_status rocsolver_getf2_template(rocblas_handle handle,
             return getf2_run_panel<T>(handle, m, n, A, shiftA, lda, strideA, ipiv, shiftP, strideP,
                                       info, batch_count, pivot, offset, permut_idx, stridePI);
         }
+
+        // use the cooperative panel kernel for tall skinny matrices
+        // (if it cannot be launched, continue with the normal code)
+        if(spker == 3
+           && getf2_run_coop_panel<T>(handle, m, n, A, shiftA, lda, strideA, ipiv, shiftP,
+                                      strideP, info, batch_count, pivot, offset, permut_idx,
+                                      stridePI, pivotval, pivotidx)
+               == rocblas_status_success)
+            return rocblas_status_success;
     }
 #endif
 
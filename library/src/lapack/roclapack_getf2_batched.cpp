@@ -44,6 +44,7 @@ rocblas_status rocsolver_getf2_batched_impl(rocblas_handle handle,
     const char* name = (pivot ? "getf2_batched" : "getf2_npvt_batched");
     ROCSOLVER_ENTER_TOP(name, "-m", m, "-n", n, "--lda", lda, "--strideP", strideP, "--batch_count",
                         batch_count);
+    ROCSOLVER_INFO_SUMMARY(info, batch_count);
 
     using S = decltype(std::real(T{}));
 
@@ -65,7 +66,7 @@ rocblas_status rocsolver_getf2_batched_impl(rocblas_handle handle,
     rocblas_stride strideA = 0;
 
     // memory workspace sizes:
-    // size for constants in rocblas calls
+    // constants in rocblas calls (only whether they are needed, see set_device_scalars)
     size_t size_scalars;
     // sizes to store pivots in intermediate computations
     size_t size_pivotval;
@@ -74,12 +75,12 @@ rocblas_status rocsolver_getf2_batched_impl(rocblas_handle handle,
                                            &size_pivotidx);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_pivotval,
+        return rocblas_set_optimal_device_memory_size(handle, size_t(0), size_pivotval,
                                                       size_pivotidx);
 
     // memory workspace allocation
     void *scalars, *pivotidx, *pivotval;
-    rocblas_device_malloc mem(handle, size_scalars, size_pivotval, size_pivotidx);
+    rocblas_device_malloc mem(handle, size_t(0), size_pivotval, size_pivotidx);
 
     if(!mem)
         return rocblas_status_memory_error;
@@ -88,12 +89,12 @@ rocblas_status rocsolver_getf2_batched_impl(rocblas_handle handle,
     pivotval = mem[1];
     pivotidx = mem[2];
     if(size_scalars > 0)
-        init_scalars(handle, (T*)scalars);
+        ROCBLAS_CHECK(set_device_scalars<T>(scalars));
 
     // execution
-    return rocsolver_getf2_template<true, T>(handle, m, n, A, shiftA, inca, lda, strideA, ipiv,
-                                             shiftP, strideP, info, batch_count, (T*)scalars,
-                                             (T*)pivotval, (I*)pivotidx, pivot);
+    return _info_summary_scope.commit(rocsolver_getf2_template<true, T>(
+        handle, m, n, A, shiftA, inca, lda, strideA, ipiv, shiftP, strideP, info, batch_count,
+        (T*)scalars, (T*)pivotval, (I*)pivotidx, pivot));
 }
 
 ROCSOLVER_END_NAMESPACE
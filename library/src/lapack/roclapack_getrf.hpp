@@ -32,10 +32,16 @@
 
 #pragma once
 
+#include "auxiliary/rocauxiliary_laswp.hpp"
 #include "rocblas.hpp"
 #include "roclapack_getf2.hpp"
 #include "rocsolver/rocsolver.h"
+#include "rocsolver_alg_mode.hpp"
+#include "rocsolver_batch_split.hpp"
+#include "rocsolver_prefetch.hpp"
 #include "rocsolver_run_specialized_kernels.hpp"
+#include "rocsolver_streams.hpp"
+#include "rocsolver_tuning.hpp"
 
 ROCSOLVER_BEGIN_NAMESPACE
 
@@ -235,6 +241,288 @@ ROCSOLVER_KERNEL void getrf_row_permutate(const I n,
     }
 }
 
+/** Execute one round of the tournament pivoting of a leaf panel with mm rows and nn columns.
+    Every thread-block selects nn candidate rows with a local LU factorization with partial
+    pivoting of its rows. In the first round (candin = nullptr) the rows of the thread-block
+    are a tile of GETRF_TOURNAMENT_TILE rows of the panel; in the next rounds they are the
+    candidates of up to fan sets of the previous round. The original rows are always used.
+    Empty candidate slots are marked with -1. **/
+template <typename T, typename I, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(GETRF_TOURNAMENT_TILE)
+    getrf_tournament_select(const I mm,
+                            const I nn,
+                            const I nsets,
+                            const I fan,
+                            U AA,
+                            const rocblas_stride shiftA,
+                            const I inca,
+                            const I lda,
+                            const rocblas_stride strideA,
+                            const I* candin,
+                            I* candout,
+                            const rocblas_stride strideC)
+{
+    using S = decltype(std::real(T{}));
+
+    const I id = hipBlockIdx_z;
+    const I bid = hipBlockIdx_x;
+    const I tx = hipThreadIdx_x;
+    const I tile = GETRF_TOURNAMENT_TILE;
+
+    // batch instance
+    T* A = load_ptr_batch<T>(AA, id, shiftA, strideA);
+    I* sel = candout + id * strideC + bid * nn;
+
+    // shared mem for the rows of the thread-block and the reductions
+    extern __shared__ double lmem[];
+    T* v = reinterpret_cast<T*>(lmem);
+    S* sval = reinterpret_cast<S*>(v + tile * nn);
+    I* sidx = reinterpret_cast<I*>(sval + tile);
+
+    // identify the row of each thread
+    I row = -1;
+    if(!candin)
+    {
+        if(bid * tile + tx < mm)
+            row = bid * tile + tx;
+    }
+    else
+    {
+        I s = bid * fan + tx / nn;
+        if(tx < fan * nn && s < nsets)
+            row = candin[id * strideC + s * nn + tx % nn];
+    }
+    bool active = (row >= 0);
+
+    // load rows into shared mem
+    for(I j = 0; j < nn; ++j)
+        v[tx + j * tile] = active ? A[row * inca + j * lda] : T(0);
+    if(tx < nn)
+        sel[tx] = -1;
+    __syncthreads();
+
+    for(I k = 0; k < nn; ++k)
+    {
+        // find pivot among the rows that have not been selected yet
+        sval[tx] = active ? aabs<S>(v[tx + k * tile]) : S(-1);
+        sidx[tx] = tx;
+        __syncthreads();
+
+        for(I s = tile / 2; s > 0; s /= 2)
+        {
+            if(tx < s && sval[tx + s] > sval[tx])
+            {
+                sval[tx] = sval[tx + s];
+                sidx[tx] = sidx[tx + s];
+            }
+            __syncthreads();
+        }
+
+        S pmax = sval[0];
+        I p = sidx[0];
+        __syncthreads();
+
+        // no rows left
+        if(pmax < 0)
+            break;
+
+        if(tx == p)
+        {
+            sel[k] = row;
+            active = false;
+        }
+
+        // eliminate the selected row from the remaining rows
+        if(active && pmax > 0)
+        {
+            T l = v[tx + k * tile] / v[p + k * tile];
+            for(I j = k + 1; j < nn; ++j)
+                v[tx + j * tile] -= l * v[p + j * tile];
+        }
+        __syncthreads();
+    }
+}
+
+/** Apply the row interchanges given by the nn pivot rows selected by the tournament
+    to the columns of the leaf panel, and factorize the nn-by-nn diagonal block
+    without further pivoting. The interchanges are stored in ipiv following LAPACK
+    (as sequential row swaps). **/
+template <typename T, typename I, typename INFO, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(GETRF_TOURNAMENT_TILE)
+    getrf_tournament_apply(const I nn,
+                           U AA,
+                           const rocblas_stride shiftA,
+                           const I inca,
+                           const I lda,
+                           const rocblas_stride strideA,
+                           I* ipivA,
+                           const rocblas_stride shiftP,
+                           const rocblas_stride strideP,
+                           INFO* info,
+                           const I offset,
+                           const I* cand,
+                           const rocblas_stride strideC)
+{
+    const I id = hipBlockIdx_z;
+    const I tx = hipThreadIdx_x;
+    const I bdx = hipBlockDim_x;
+
+    // batch instance
+    T* A = load_ptr_batch<T>(AA, id, shiftA, strideA);
+    I* ipiv = ipivA + id * strideP + shiftP;
+    const I* sel = cand + id * strideC;
+
+    // shared mem for the diagonal block, the row swaps and the positions of the moved rows
+    extern __shared__ double lmem[];
+    T* u = reinterpret_cast<T*>(lmem);
+    I* swp = reinterpret_cast<I*>(u + nn * nn);
+    I* who = swp + nn;
+    I* dorig = who + nn;
+    I* dpos = dorig + nn;
+
+    // get the equivalent sequence of row swaps
+    if(tx == 0)
+    {
+        I nd = 0;
+        for(I k = 0; k < nn; ++k)
+            who[k] = k;
+
+        for(I k = 0; k < nn; ++k)
+        {
+            I r = sel[k];
+            I q = r;
+            I t = -1;
+            for(I i = k; i < nn; ++i)
+                if(who[i] == r)
+                    q = i;
+            for(I i = 0; i < nd; ++i)
+                if(dorig[i] == r)
+                {
+                    q = dpos[i];
+                    t = i;
+                }
+
+            // the row at position k is moved to position q
+            if(q < nn)
+                who[q] = who[k];
+            else
+            {
+                if(t < 0)
+                    t = nd++;
+                dorig[t] = who[k];
+                dpos[t] = q;
+            }
+            who[k] = r;
+            swp[k] = q;
+            ipiv[k] = q + 1 + offset; // use Fortran 1-based indexing
+        }
+    }
+    __syncthreads();
+
+    // swap rows (each tx swaps one column)
+    if(tx < nn)
+    {
+        for(I k = 0; k < nn; ++k)
+        {
+            I q = swp[k];
+            if(q != k)
+                swap(A[k * inca + tx * lda], A[q * inca + tx * lda]);
+        }
+    }
+    __syncthreads();
+
+    // factorize the diagonal block
+    for(I i = tx; i < nn * nn; i += bdx)
+        u[i] = A[(i % nn) * inca + (i / nn) * lda];
+    __syncthreads();
+
+    for(I k = 0; k < nn; ++k)
+    {
+        T piv = u[k + k * nn];
+        T inv = (piv != T(0)) ? T(1) / piv : T(1);
+        for(I i = k + 1 + tx; i < nn; i += bdx)
+            u[i + k * nn] *= inv;
+        __syncthreads();
+
+        for(I i = tx; i < (nn - k - 1) * (nn - k - 1); i += bdx)
+        {
+            I r = k + 1 + i % (nn - k - 1);
+            I c = k + 1 + i / (nn - k - 1);
+            u[r + c * nn] -= u[r + k * nn] * u[k + c * nn];
+        }
+        __syncthreads();
+    }
+
+    for(I i = tx; i < nn * nn; i += bdx)
+        A[(i % nn) * inca + (i / nn) * lda] = u[i];
+
+    // update info (check singularity)
+    // (the first column of the matrix initializes info)
+    if(tx == 0)
+    {
+        INFO myinfo = 0;
+        for(I k = 0; k < nn; ++k)
+        {
+            if(u[k + k * nn] == T(0))
+            {
+                myinfo = static_cast<INFO>(k + 1);
+                break;
+            }
+        }
+        if(offset == 0 || (info[id] == 0 && myinfo > 0))
+            info[id] = (myinfo > 0) ? static_cast<INFO>(myinfo + offset) : 0;
+    }
+}
+
+/** Compute the rows nn to mm-1 of the factor L of a leaf panel once its diagonal block
+    has been factorized (each thread computes one row) **/
+template <typename T, typename I, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(GETRF_TOURNAMENT_TILE)
+    getrf_tournament_lower(const I mm,
+                           const I nn,
+                           U AA,
+                           const rocblas_stride shiftA,
+                           const I inca,
+                           const I lda,
+                           const rocblas_stride strideA)
+{
+    const I id = hipBlockIdx_z;
+    const I tx = hipThreadIdx_x;
+    const I row = nn + hipBlockIdx_x * static_cast<I>(hipBlockDim_x) + tx;
+
+    // batch instance
+    T* A = load_ptr_batch<T>(AA, id, shiftA, strideA);
+
+    // shared mem for the diagonal block and the inverses of the pivots
+    extern __shared__ double lmem[];
+    T* u = reinterpret_cast<T*>(lmem);
+    T* dinv = u + nn * nn;
+
+    for(I i = tx; i < nn * nn; i += hipBlockDim_x)
+        u[i] = A[(i % nn) * inca + (i / nn) * lda];
+    __syncthreads();
+    if(tx < nn)
+        dinv[tx] = (u[tx + tx * nn] != T(0)) ? T(1) / u[tx + tx * nn] : T(1);
+    __syncthreads();
+
+    if(row < mm)
+    {
+        T x[GETRF_RECURSIVE_LEAF_SIZE];
+        for(I j = 0; j < nn; ++j)
+            x[j] = A[row * inca + j * lda];
+
+        for(I k = 0; k < nn; ++k)
+        {
+            x[k] *= dinv[k];
+            for(I j = k + 1; j < nn; ++j)
+                x[j] -= x[k] * u[k + j * nn];
+        }
+
+        for(I j = 0; j < nn; ++j)
+            A[row * inca + j * lda] = x[j];
+    }
+}
+
 /** This function returns the outer block size based on defined variables
     tunable by the user (defined in ideal_sizes.hpp) **/
 template <bool ISBATCHED, typename T, typename I, std::enable_if_t<!rocblas_is_complex<T>, int> = 0>
@@ -249,14 +537,14 @@ I getrf_get_blksize(I dim, const bool pivot)
             I size[] = {GETRF_BATCH_BLKSIZES_REAL};
             I intervals[] = {GETRF_BATCH_INTERVALS_REAL};
             I max = GETRF_BATCH_NUM_INTERVALS_REAL;
-            blk = size[get_index(intervals, max, dim)];
+            blk = get_tuned_blksize("getrf_batch_real", size, intervals, max, dim);
         }
         else
         {
             I size[] = {GETRF_NPVT_BATCH_BLKSIZES_REAL};
             I intervals[] = {GETRF_NPVT_BATCH_INTERVALS_REAL};
             I max = GETRF_NPVT_BATCH_NUM_INTERVALS_REAL;
-            blk = size[get_index(intervals, max, dim)];
+            blk = get_tuned_blksize("getrf_npvt_batch_real", size, intervals, max, dim);
         }
     }
     else
@@ -266,14 +554,14 @@ I getrf_get_blksize(I dim, const bool pivot)
             I size[] = {GETRF_BLKSIZES_REAL};
             I intervals[] = {GETRF_INTERVALS_REAL};
             I max = GETRF_NUM_INTERVALS_REAL;
-            blk = size[get_index(intervals, max, dim)];
+            blk = get_tuned_blksize("getrf_real", size, intervals, max, dim);
         }
         else
         {
             I size[] = {GETRF_NPVT_BLKSIZES_REAL};
             I intervals[] = {GETRF_NPVT_INTERVALS_REAL};
             I max = GETRF_NPVT_NUM_INTERVALS_REAL;
-            blk = size[get_index(intervals, max, dim)];
+            blk = get_tuned_blksize("getrf_npvt_real", size, intervals, max, dim);
         }
     }
 
@@ -296,14 +584,14 @@ I getrf_get_blksize(I dim, const bool pivot)
             I size[] = {GETRF_BATCH_BLKSIZES_COMPLEX};
             I intervals[] = {GETRF_BATCH_INTERVALS_COMPLEX};
             I max = GETRF_BATCH_NUM_INTERVALS_COMPLEX;
-            blk = size[get_index(intervals, max, dim)];
+            blk = get_tuned_blksize("getrf_batch_complex", size, intervals, max, dim);
         }
         else
         {
             I size[] = {GETRF_NPVT_BATCH_BLKSIZES_COMPLEX};
             I intervals[] = {GETRF_NPVT_BATCH_INTERVALS_COMPLEX};
             I max = GETRF_NPVT_BATCH_NUM_INTERVALS_COMPLEX;
-            blk = size[get_index(intervals, max, dim)];
+            blk = get_tuned_blksize("getrf_npvt_batch_complex", size, intervals, max, dim);
         }
     }
     else
@@ -313,14 +601,14 @@ I getrf_get_blksize(I dim, const bool pivot)
             I size[] = {GETRF_BLKSIZES_COMPLEX};
             I intervals[] = {GETRF_INTERVALS_COMPLEX};
             I max = GETRF_NUM_INTERVALS_COMPLEX;
-            blk = size[get_index(intervals, max, dim)];
+            blk = get_tuned_blksize("getrf_complex", size, intervals, max, dim);
         }
         else
         {
             I size[] = {GETRF_NPVT_BLKSIZES_COMPLEX};
             I intervals[] = {GETRF_NPVT_INTERVALS_COMPLEX};
             I max = GETRF_NPVT_NUM_INTERVALS_COMPLEX;
-            blk = size[get_index(intervals, max, dim)];
+            blk = get_tuned_blksize("getrf_npvt_complex", size, intervals, max, dim);
         }
     }
 
@@ -332,7 +620,7 @@ I getrf_get_blksize(I dim, const bool pivot)
 
 /** This function returns the inner block size. This has been tuned based on
     experiments with panel matrices; it is not expected to change a lot.
-    (not tunable by the user for now) **/
+    (the 2-D tables can be overridden with the getrf_*inner_* entries of the tuning file) **/
 template <bool ISBATCHED, typename T, typename I, std::enable_if_t<!rocblas_is_complex<T>, int> = 0>
 I getrf_get_innerBlkSize(I m, I n, const bool pivot)
 {
@@ -347,7 +635,9 @@ I getrf_get_innerBlkSize(I m, I n, const bool pivot)
             I intervalsM[] = {GETRF_BATCH_INTERVALSROW_REAL};
             I intervalsN[] = {GETRF_BATCH_INTERVALSCOL_REAL};
             I size[][GETRF_BATCH_NUMCOLS_REAL] = {GETRF_BATCH_INNBLKSIZES_REAL};
-            blk = size[get_index(intervalsM, M, m)][get_index(intervalsN, N, n)];
+            blk = get_tuned_blksize("getrf_batch_inner_real", &size[0][0],
+                                    I(GETRF_BATCH_NUMCOLS_REAL), intervalsM, M, intervalsN, N, m,
+                                    n);
         }
         else
         {
@@ -356,7 +646,9 @@ I getrf_get_innerBlkSize(I m, I n, const bool pivot)
             I intervalsM[] = {GETRF_NPVT_BATCH_INTERVALSROW_REAL};
             I intervalsN[] = {GETRF_NPVT_BATCH_INTERVALSCOL_REAL};
             I size[][GETRF_NPVT_BATCH_NUMCOLS_REAL] = {GETRF_NPVT_BATCH_INNBLKSIZES_REAL};
-            blk = size[get_index(intervalsM, M, m)][get_index(intervalsN, N, n)];
+            blk = get_tuned_blksize("getrf_npvt_batch_inner_real", &size[0][0],
+                                    I(GETRF_NPVT_BATCH_NUMCOLS_REAL), intervalsM, M, intervalsN, N,
+                                    m, n);
         }
     }
     else
@@ -368,7 +660,8 @@ I getrf_get_innerBlkSize(I m, I n, const bool pivot)
             I intervalsM[] = {GETRF_INTERVALSROW_REAL};
             I intervalsN[] = {GETRF_INTERVALSCOL_REAL};
             I size[][GETRF_NUMCOLS_REAL] = {GETRF_INNBLKSIZES_REAL};
-            blk = size[get_index(intervalsM, M, m)][get_index(intervalsN, N, n)];
+            blk = get_tuned_blksize("getrf_inner_real", &size[0][0], I(GETRF_NUMCOLS_REAL),
+                                    intervalsM, M, intervalsN, N, m, n);
         }
         else
         {
@@ -377,7 +670,8 @@ I getrf_get_innerBlkSize(I m, I n, const bool pivot)
             I intervalsM[] = {GETRF_NPVT_INTERVALSROW_REAL};
             I intervalsN[] = {GETRF_NPVT_INTERVALSCOL_REAL};
             I size[][GETRF_NPVT_NUMCOLS_REAL] = {GETRF_NPVT_INNBLKSIZES_REAL};
-            blk = size[get_index(intervalsM, M, m)][get_index(intervalsN, N, n)];
+            blk = get_tuned_blksize("getrf_npvt_inner_real", &size[0][0],
+                                    I(GETRF_NPVT_NUMCOLS_REAL), intervalsM, M, intervalsN, N, m, n);
         }
     }
 
@@ -402,7 +696,9 @@ I getrf_get_innerBlkSize(I m, I n, const bool pivot)
             I intervalsM[] = {GETRF_BATCH_INTERVALSROW_COMPLEX};
             I intervalsN[] = {GETRF_BATCH_INTERVALSCOL_COMPLEX};
             I size[][GETRF_BATCH_NUMCOLS_COMPLEX] = {GETRF_BATCH_INNBLKSIZES_COMPLEX};
-            blk = size[get_index(intervalsM, M, m)][get_index(intervalsN, N, n)];
+            blk = get_tuned_blksize("getrf_batch_inner_complex", &size[0][0],
+                                    I(GETRF_BATCH_NUMCOLS_COMPLEX), intervalsM, M, intervalsN, N, m,
+                                    n);
         }
         else
         {
@@ -411,7 +707,9 @@ I getrf_get_innerBlkSize(I m, I n, const bool pivot)
             I intervalsM[] = {GETRF_NPVT_BATCH_INTERVALSROW_COMPLEX};
             I intervalsN[] = {GETRF_NPVT_BATCH_INTERVALSCOL_COMPLEX};
             I size[][GETRF_NPVT_BATCH_NUMCOLS_COMPLEX] = {GETRF_NPVT_BATCH_INNBLKSIZES_COMPLEX};
-            blk = size[get_index(intervalsM, M, m)][get_index(intervalsN, N, n)];
+            blk = get_tuned_blksize("getrf_npvt_batch_inner_complex", &size[0][0],
+                                    I(GETRF_NPVT_BATCH_NUMCOLS_COMPLEX), intervalsM, M, intervalsN,
+                                    N, m, n);
         }
     }
     else
@@ -423,7 +721,8 @@ I getrf_get_innerBlkSize(I m, I n, const bool pivot)
             I intervalsM[] = {GETRF_INTERVALSROW_COMPLEX};
             I intervalsN[] = {GETRF_INTERVALSCOL_COMPLEX};
             I size[][GETRF_NUMCOLS_COMPLEX] = {GETRF_INNBLKSIZES_COMPLEX};
-            blk = size[get_index(intervalsM, M, m)][get_index(intervalsN, N, n)];
+            blk = get_tuned_blksize("getrf_inner_complex", &size[0][0], I(GETRF_NUMCOLS_COMPLEX),
+                                    intervalsM, M, intervalsN, N, m, n);
         }
         else
         {
@@ -432,7 +731,9 @@ I getrf_get_innerBlkSize(I m, I n, const bool pivot)
             I intervalsM[] = {GETRF_NPVT_INTERVALSROW_COMPLEX};
             I intervalsN[] = {GETRF_NPVT_INTERVALSCOL_COMPLEX};
             I size[][GETRF_NPVT_NUMCOLS_COMPLEX] = {GETRF_NPVT_INNBLKSIZES_COMPLEX};
-            blk = size[get_index(intervalsM, M, m)][get_index(intervalsN, N, n)];
+            blk = get_tuned_blksize("getrf_npvt_inner_complex", &size[0][0],
+                                    I(GETRF_NPVT_NUMCOLS_COMPLEX), intervalsM, M, intervalsN, N, m,
+                                    n);
         }
     }
 
@@ -442,6 +743,169 @@ I getrf_get_innerBlkSize(I m, I n, const bool pivot)
     return blk;
 }
 
+/** Return true if the pivots of the leaf panels of the recursive factorization
+    are to be selected by tournament **/
+inline bool getrf_use_tournament(rocblas_handle handle)
+{
+    return get_alg_mode(handle, rocsolver_function_getrf) == rocsolver_alg_mode_tournament;
+}
+
+/** This is the implementation of the factorization of a leaf panel with tournament pivoting.
+    The leaf panel of mm rows and nn columns starts at the diagonal position d of the matrix;
+    A and ipiv are given at the beginning of the matrix and the pivots array, respectively.
+    The row interchanges are only applied to the columns of the leaf panel.
+    cand is a workspace of 2 * batch_count * ceil(mm / GETRF_TOURNAMENT_TILE) * nn integers. **/
+template <typename T, typename I, typename INFO, typename U>
+rocblas_status getrf_tournamentLU(rocblas_handle handle,
+                                  const I mm,
+                                  const I nn,
+                                  const I d,
+                                  U A,
+                                  const rocblas_stride shiftA,
+                                  const I inca,
+                                  const I lda,
+                                  const rocblas_stride strideA,
+                                  I* ipiv,
+                                  const rocblas_stride shiftP,
+                                  const rocblas_stride strideP,
+                                  INFO* info,
+                                  const I batch_count,
+                                  I* cand)
+{
+    using S = decltype(std::real(T{}));
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    const I tile = GETRF_TOURNAMENT_TILE;
+    const rocblas_stride shiftL = shiftA + idx2D(d, d, inca, lda);
+
+    // the candidates of consecutive rounds are stored alternately in two regions
+    I nsets = (mm - 1) / tile + 1;
+    I fan = tile / nn;
+    rocblas_stride strideC = nsets * nn;
+    I* candin = cand;
+    I* candout = cand + batch_count * strideC;
+
+    dim3 threads(tile, 1, 1);
+    size_t lmemsize = tile * (nn * sizeof(T) + sizeof(S) + sizeof(I));
+
+    // first round: select the candidates of every tile of rows
+    ROCSOLVER_LAUNCH_KERNEL(getrf_tournament_select<T>, dim3(nsets, 1, batch_count), threads,
+                            lmemsize, stream, mm, nn, nsets, fan, A, shiftL, inca, lda, strideA,
+                            (I*)nullptr, candin, strideC);
+
+    // next rounds: reduce the candidates until only the pivot rows remain
+    while(nsets > 1)
+    {
+        I nout = (nsets - 1) / fan + 1;
+        ROCSOLVER_LAUNCH_KERNEL(getrf_tournament_select<T>, dim3(nout, 1, batch_count), threads,
+                                lmemsize, stream, mm, nn, nsets, fan, A, shiftL, inca, lda,
+                                strideA, candin, candout, strideC);
+        std::swap(candin, candout);
+        nsets = nout;
+    }
+
+    // apply row interchanges and factorize diagonal block
+    lmemsize = nn * nn * sizeof(T) + 4 * nn * sizeof(I);
+    ROCSOLVER_LAUNCH_KERNEL(getrf_tournament_apply<T>, dim3(1, 1, batch_count), threads, lmemsize,
+                            stream, nn, A, shiftL, inca, lda, strideA, ipiv, shiftP + d, strideP,
+                            info, d, candin, strideC);
+
+    // compute the rest of the factor L
+    if(mm > nn)
+    {
+        I blocks = (mm - nn - 1) / tile + 1;
+        lmemsize = (nn * nn + nn) * sizeof(T);
+        ROCSOLVER_LAUNCH_KERNEL(getrf_tournament_lower<T>, dim3(blocks, 1, batch_count), threads,
+                                lmemsize, stream, mm, nn, A, shiftL, inca, lda, strideA);
+    }
+
+    return rocblas_status_success;
+}
+
+/** This is the implementation of the recursive factorization of tall block panels.
+    The block panel of mm rows and nn columns starts at the diagonal position d of the matrix;
+    A and ipiv are given at the beginning of the matrix and the pivots array, respectively.
+    The row interchanges are only applied to the columns of the block panel. **/
+template <bool BATCHED, bool STRIDED, typename T, typename I, typename INFO, typename U>
+rocblas_status getrf_recursiveLU(rocblas_handle handle,
+                                 const I mm,
+                                 const I nn,
+                                 const I d,
+                                 U A,
+                                 const rocblas_stride shiftA,
+                                 const I inca,
+                                 const I lda,
+                                 const rocblas_stride strideA,
+                                 I* ipiv,
+                                 const rocblas_stride shiftP,
+                                 const rocblas_stride strideP,
+                                 INFO* info,
+                                 const I batch_count,
+                                 T* scalars,
+                                 void* work1,
+                                 void* work2,
+                                 void* work3,
+                                 void* work4,
+                                 const bool optim_mem,
+                                 T* pivotval,
+                                 I* pivotidx,
+                                 const bool tournament = false)
+{
+    static constexpr bool ISBATCHED = BATCHED || STRIDED;
+
+    // factorize leaf panel
+    if(nn <= GETRF_RECURSIVE_LEAF_SIZE && tournament && mm > GETRF_TOURNAMENT_MIN_ROWS)
+        return getrf_tournamentLU<T>(handle, mm, nn, d, A, shiftA, inca, lda, strideA, ipiv,
+                                     shiftP, strideP, info, batch_count, pivotidx);
+    if(nn <= GETRF_RECURSIVE_LEAF_SIZE)
+        return rocsolver_getf2_template<ISBATCHED, T>(
+            handle, mm, nn, A, shiftA + idx2D(d, d, inca, lda), inca, lda, strideA, ipiv,
+            shiftP + d, strideP, info, batch_count, scalars, pivotval, pivotidx, true, d);
+
+    // constants to use when calling rocablas functions
+    T one = 1; // constant 1 in host
+    T minone = -1; // constant -1 in host
+
+    I n1 = nn / 2;
+    I n2 = nn - n1;
+
+    // factorize left half
+    getrf_recursiveLU<BATCHED, STRIDED, T>(handle, mm, n1, d, A, shiftA, inca, lda, strideA, ipiv,
+                                           shiftP, strideP, info, batch_count, scalars, work1,
+                                           work2, work3, work4, optim_mem, pivotval, pivotidx,
+                                           tournament);
+
+    // apply row interchanges and update right half
+    rocsolver_laswp_template<T>(handle, n2, A, shiftA + idx2D(0, d + n1, inca, lda), inca, lda,
+                                strideA, d + 1, d + n1, ipiv, shiftP, I(1), strideP, batch_count);
+
+    rocsolver_trsm_lower<BATCHED, STRIDED, T>(
+        handle, rocblas_side_left, rocblas_operation_none, rocblas_diagonal_unit, n1, n2, A,
+        shiftA + idx2D(d, d, inca, lda), inca, lda, strideA, A,
+        shiftA + idx2D(d, d + n1, inca, lda), inca, lda, strideA, batch_count, optim_mem, work1,
+        work2, work3, work4);
+
+    rocsolver_gemm<BATCHED, STRIDED, T>(
+        handle, rocblas_operation_none, rocblas_operation_none, mm - n1, n2, n1, &minone, A,
+        shiftA + idx2D(d + n1, d, inca, lda), inca, lda, strideA, A,
+        shiftA + idx2D(d, d + n1, inca, lda), inca, lda, strideA, &one, A,
+        shiftA + idx2D(d + n1, d + n1, inca, lda), inca, lda, strideA, batch_count, (T**)nullptr);
+
+    // factorize right half
+    getrf_recursiveLU<BATCHED, STRIDED, T>(handle, mm - n1, n2, d + n1, A, shiftA, inca, lda,
+                                           strideA, ipiv, shiftP, strideP, info, batch_count,
+                                           scalars, work1, work2, work3, work4, optim_mem,
+                                           pivotval, pivotidx, tournament);
+
+    // apply row interchanges to left half
+    rocsolver_laswp_template<T>(handle, n1, A, shiftA + idx2D(0, d, inca, lda), inca, lda, strideA,
+                                d + n1 + 1, d + nn, ipiv, shiftP, I(1), strideP, batch_count);
+
+    return rocblas_status_success;
+}
+
 /** This is the implementation of the factorization of the
     panel blocks in getrf **/
 template <bool BATCHED, bool STRIDED, typename T, typename I, typename INFO, typename U>
@@ -470,7 +934,8 @@ rocblas_status getrf_panelLU(rocblas_handle handle,
                              I* pivotidx,
                              const I offset,
                              I* permut_idx,
-                             const rocblas_stride stridePI)
+                             const rocblas_stride stridePI,
+                             const bool swap_panel_only = false)
 {
     static constexpr bool ISBATCHED = BATCHED || STRIDED;
 
@@ -491,6 +956,37 @@ rocblas_status getrf_panelLU(rocblas_handle handle,
     dim3 grid, threads;
     size_t lmemsize;
 
+    // use the recursive algorithm for tall block panels
+    // (also for narrow panels if their pivots are selected by tournament)
+    const bool tournament = pivot && getrf_use_tournament(handle);
+    if(pivot && mm > GETRF_RECURSIVE_MIN_ROWS && (nn > GETRF_RECURSIVE_LEAF_SIZE || tournament))
+    {
+        // the block panel starts at the diagonal position offset
+        rocblas_stride shiftA0 = r_shiftA - offset * inca;
+        rocblas_stride shiftP0 = shiftP - offset;
+
+        getrf_recursiveLU<BATCHED, STRIDED, T>(handle, mm, nn, offset, A, shiftA0, inca, lda,
+                                               strideA, ipiv, shiftP0, strideP, info, batch_count,
+                                               scalars, work1, work2, work3, work4, optim_mem,
+                                               pivotval, pivotidx, tournament);
+
+        // apply row interchanges to the rest of the matrix
+        if(!swap_panel_only)
+        {
+            if(offset > 0)
+                rocsolver_laswp_template<T>(handle, offset, A, shiftA0, inca, lda, strideA,
+                                            offset + 1, offset + nn, ipiv, shiftP0, I(1), strideP,
+                                            batch_count);
+            if(offset + nn < n)
+                rocsolver_laswp_template<T>(handle, n - offset - nn, A,
+                                            shiftA0 + idx2D(0, offset + nn, inca, lda), inca, lda,
+                                            strideA, offset + 1, offset + nn, ipiv, shiftP0, I(1),
+                                            strideP, batch_count);
+        }
+
+        return rocblas_status_success;
+    }
+
     // Main loop
     for(I k = 0; k < nn; k += blk)
     {
@@ -503,17 +999,23 @@ rocblas_status getrf_panelLU(rocblas_handle handle,
                                                offset + k, permut_idx, stridePI);
         if(pivot)
         {
+            // if swap_panel_only, the rows are only swapped in the columns of the block panel
+            // (the caller applies the interchanges to the rest of the matrix)
+            I ncols = swap_panel_only ? nn : n;
+            I coffset = swap_panel_only ? 0 : offset;
+            rocblas_stride cshift = swap_panel_only ? idx2D(0, offset, inca, lda) : 0;
+
             dimx = jb;
             dimy = I(1024) / dimx;
-            blocks = (n - jb - 1) / dimy + 1;
+            blocks = (ncols - jb - 1) / dimy + 1;
             grid = dim3(1, blocks, batch_count);
             threads = dim3(dimx, dimy, 1);
             lmemsize = dimx * dimy * sizeof(T);
 
             // swap rows
-            ROCSOLVER_LAUNCH_KERNEL(getrf_row_permutate<T>, grid, threads, lmemsize, stream, n,
-                                    offset + k, jb, A, r_shiftA + k * inca, inca, lda, strideA,
-                                    permut_idx, stridePI);
+            ROCSOLVER_LAUNCH_KERNEL(getrf_row_permutate<T>, grid, threads, lmemsize, stream, ncols,
+                                    coffset + k, jb, A, r_shiftA + k * inca + cshift, inca, lda,
+                                    strideA, permut_idx, stridePI);
         }
 
         // update trailing sub-block
@@ -538,6 +1040,312 @@ rocblas_status getrf_panelLU(rocblas_handle handle,
     return rocblas_status_success;
 }
 
+/** This function determines whether the blocked algorithm uses look-ahead **/
+template <bool ISBATCHED, typename I>
+bool getrf_use_lookahead(const I m, const I n, const I blk, const bool pivot)
+{
+    I dim = std::min(m, n);
+    return !ISBATCHED && pivot && blk > 0 && blk < dim && dim >= GETRF_LOOKAHEAD_MIN_SIZE
+        && dim <= GETRF_LOOKAHEAD_MAX_SIZE;
+}
+
+/** This function returns the number of internal streams among which the batched and
+    strided-batched routines split the batch (tunable by the user, defined in ideal_sizes.hpp) **/
+template <typename I>
+I getrf_batch_streams(const I m, const I n, const I batch_count)
+{
+    I size[] = {GETRF_BATCH_STREAMS};
+    I intervals[] = {GETRF_BATCH_STREAMS_INTERVALS};
+    I max = GETRF_BATCH_STREAMS_NUM_INTERVALS;
+    I k = get_tuned_blksize("getrf_batch_streams", size, intervals, max, std::min(m, n));
+    return rocsolver_batch_streams(k, batch_count);
+}
+
+/** Return the size of the workspace used by the TRSMs of the panel factorizations
+    when using look-ahead. (This workspace must be independent from the one used by
+    the trailing matrix updates, as they are executed concurrently) **/
+template <bool BATCHED, bool STRIDED, typename T, typename I>
+void getrf_lookahead_getMemorySize(const I blk,
+                                   const I batch_count,
+                                   size_t* size_work1,
+                                   size_t* size_work2,
+                                   size_t* size_work3,
+                                   size_t* size_work4)
+{
+    bool optim_mem;
+    rocsolver_trsm_mem<BATCHED, STRIDED, T>(rocblas_side_left, rocblas_operation_none, blk, blk,
+                                            batch_count, size_work1, size_work2, size_work3,
+                                            size_work4, &optim_mem, true);
+}
+
+/** This is the implementation of the blocked algorithm with look-ahead.
+    At every step, the columns of the next block panel are updated first, so that
+    the panel can be factorized on a side stream while the rest of the trailing matrix
+    is updated on the stream of the handle. The row interchanges of each block panel are
+    applied to the rest of the matrix once the panel has been factorized. The rocBLAS functions
+    called on the side stream use a separate rocBLAS handle, as they could otherwise use the
+    workspace of the handle concurrently with the trailing matrix update.
+
+    Returns rocblas_status_continue (without doing any work) if the side stream or its rocBLAS
+    handle cannot be used. **/
+template <bool BATCHED, bool STRIDED, typename T, typename I, typename INFO, typename U>
+rocblas_status getrf_lookaheadLU(rocblas_handle handle,
+                                 const I m,
+                                 const I n,
+                                 U A,
+                                 const rocblas_stride shiftA,
+                                 const I inca,
+                                 const I lda,
+                                 const rocblas_stride strideA,
+                                 I* ipiv,
+                                 const rocblas_stride shiftP,
+                                 const rocblas_stride strideP,
+                                 INFO* info,
+                                 const I batch_count,
+                                 const I blk,
+                                 T* scalars,
+                                 void* work1,
+                                 void* work2,
+                                 void* work3,
+                                 void* work4,
+                                 const bool optim_mem,
+                                 T* pivotval,
+                                 I* pivotidx,
+                                 I* iipiv)
+{
+    hipStream_t stream, pstream;
+    rocblas_get_stream(handle, &stream);
+
+    // events to synchronize the side stream with the stream of the handle
+    // (NOTE: hipEventDestroy is deferred until the events have completed)
+    hipEvent_t updated, factorized;
+    rocblas_handle phandle;
+    if(rocsolver_get_side_stream(handle, &pstream) != hipSuccess)
+        return rocblas_status_continue;
+    if(rocsolver_get_side_blas_handle(handle, &phandle) != hipSuccess)
+        return rocblas_status_continue;
+    if(hipEventCreateWithFlags(&updated, hipEventDisableTiming) != hipSuccess)
+        return rocblas_status_continue;
+    if(hipEventCreateWithFlags(&factorized, hipEventDisableTiming) != hipSuccess)
+    {
+        hipEventDestroy(updated);
+        return rocblas_status_continue;
+    }
+
+    // constants to use when calling rocablas functions
+    T one = 1; // constant 1 in host
+    T minone = -1; // constant -1 in host
+
+    // the panel factorizations use the beginning of the workspace,
+    // the trailing matrix updates use the rest
+    size_t w1, w2, w3, w4;
+    getrf_lookahead_getMemorySize<BATCHED, STRIDED, T>(blk, batch_count, &w1, &w2, &w3, &w4);
+    void* twork1 = (char*)work1 + w1;
+    void* twork2 = (char*)work2 + w2;
+    void* twork3 = (char*)work3 + w3;
+    void* twork4 = (char*)work4 + w4;
+
+    I dim = std::min(m, n);
+    I jb, jbn, nextpiv, mm, nn;
+
+    // factorize first block panel
+    jb = std::min(dim, blk);
+    getrf_panelLU<BATCHED, STRIDED, T>(handle, m, jb, n, A, shiftA, inca, lda, strideA, ipiv,
+                                       shiftP, strideP, info, batch_count, true, scalars, work1,
+                                       work2, work3, work4, optim_mem, pivotval, pivotidx, 0,
+                                       iipiv, m, true);
+
+    // MAIN LOOP
+    for(I j = 0; j < dim; j += blk)
+    {
+        jb = std::min(dim - j, blk);
+        nextpiv = j + jb; //position for the matrix update
+        mm = m - nextpiv; //size for the matrix update
+        nn = n - nextpiv; //size for the matrix update
+        jbn = (nextpiv < dim) ? std::min(dim - nextpiv, blk) : 0; //size of the next block panel
+
+        // apply row interchanges of current block panel to the rest of the matrix
+        if(j > 0)
+            rocsolver_laswp_template<T>(handle, j, A, shiftA, inca, lda, strideA, j + 1, nextpiv,
+                                        ipiv, shiftP, I(1), strideP, batch_count);
+        if(nn > 0)
+            rocsolver_laswp_template<T>(handle, nn, A, shiftA + idx2D(0, nextpiv, inca, lda), inca,
+                                        lda, strideA, j + 1, nextpiv, ipiv, shiftP, I(1), strideP,
+                                        batch_count);
+
+        if(jbn > 0)
+        {
+            // update next block panel
+            rocsolver_trsm_lower<BATCHED, STRIDED, T>(
+                handle, rocblas_side_left, rocblas_operation_none, rocblas_diagonal_unit, jb, jbn,
+                A, shiftA + idx2D(j, j, inca, lda), inca, lda, strideA, A,
+                shiftA + idx2D(j, nextpiv, inca, lda), inca, lda, strideA, batch_count, optim_mem,
+                twork1, twork2, twork3, twork4);
+
+            rocsolver_gemm<BATCHED, STRIDED, T>(
+                handle, rocblas_operation_none, rocblas_operation_none, mm, jbn, jb, &minone, A,
+                shiftA + idx2D(nextpiv, j, inca, lda), inca, lda, strideA, A,
+                shiftA + idx2D(j, nextpiv, inca, lda), inca, lda, strideA, &one, A,
+                shiftA + idx2D(nextpiv, nextpiv, inca, lda), inca, lda, strideA, batch_count,
+                (T**)nullptr);
+
+            // factorize next block panel on the side stream
+            // (the stream of the handle is restored before checking the status)
+            hipEventRecord(updated, stream);
+            hipStreamWaitEvent(pstream, updated, 0);
+            rocblas_set_stream(handle, pstream);
+
+            rocblas_status status;
+            {
+                rocsolver_side_blas_scope side_blas(handle, phandle);
+                status = getrf_panelLU<BATCHED, STRIDED, T>(
+                    handle, mm, jbn, n, A, shiftA + nextpiv * inca, inca, lda, strideA, ipiv,
+                    shiftP + nextpiv, strideP, info, batch_count, true, scalars, work1, work2,
+                    work3, work4, optim_mem, pivotval, pivotidx, nextpiv, iipiv, m, true);
+            }
+
+            hipEventRecord(factorized, pstream);
+            rocblas_set_stream(handle, stream);
+            if(status != rocblas_status_success)
+            {
+                hipStreamWaitEvent(stream, factorized, 0);
+                hipEventDestroy(updated);
+                hipEventDestroy(factorized);
+                return status;
+            }
+        }
+
+        // update rest of trailing matrix
+        if(nn > jbn)
+        {
+            rocsolver_trsm_lower<BATCHED, STRIDED, T>(
+                handle, rocblas_side_left, rocblas_operation_none, rocblas_diagonal_unit, jb,
+                nn - jbn, A, shiftA + idx2D(j, j, inca, lda), inca, lda, strideA, A,
+                shiftA + idx2D(j, nextpiv + jbn, inca, lda), inca, lda, strideA, batch_count,
+                optim_mem, twork1, twork2, twork3, twork4);
+
+            if(mm > 0)
+                rocsolver_gemm<BATCHED, STRIDED, T>(
+                    handle, rocblas_operation_none, rocblas_operation_none, mm, nn - jbn, jb,
+                    &minone, A, shiftA + idx2D(nextpiv, j, inca, lda), inca, lda, strideA, A,
+                    shiftA + idx2D(j, nextpiv + jbn, inca, lda), inca, lda, strideA, &one, A,
+                    shiftA + idx2D(nextpiv, nextpiv + jbn, inca, lda), inca, lda, strideA,
+                    batch_count, (T**)nullptr);
+        }
+
+        // wait for the factorization of the next block panel
+        if(jbn > 0)
+            hipStreamWaitEvent(stream, factorized, 0);
+    }
+
+    hipEventDestroy(updated);
+    hipEventDestroy(factorized);
+
+    return rocblas_status_success;
+}
+
+/** Return true if the matrices of a batch that are found to be singular are removed from the
+    trailing-matrix updates of the following block columns **/
+inline bool getrf_use_compact(rocblas_handle handle)
+{
+    return get_alg_mode(handle, rocsolver_function_getrf) == rocsolver_alg_mode_compact;
+}
+
+/** GETRF_COMPACT_KERNEL collects the pointers to the matrices of the batch that are not
+    (yet) known to be singular, i.e. with info = 0, in the first nlive entries of live.
+    nlive must be initialized to zero.
+        - Call this kernel with enough groups of BS1 threads in x to cover the batch. **/
+template <typename T, typename I, typename INFO, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) getrf_compact_kernel(U A,
+                                                                  const rocblas_stride strideA,
+                                                                  INFO* info,
+                                                                  const I batch_count,
+                                                                  T** live,
+                                                                  rocblas_int* nlive)
+{
+    I b = hipBlockIdx_x * static_cast<I>(hipBlockDim_x) + hipThreadIdx_x;
+
+    if(b < batch_count && info[b] == 0)
+        live[atomicAdd(nlive, 1)] = load_ptr_batch<T>(A, b, 0, strideA);
+}
+
+/** Find the matrices of the batch that are still non-singular. Returns their number in
+    h_nlive; if it is smaller than batch_count, the pointers to the matrices are in live.
+    (The compaction is not done while the stream is being captured into a graph, as the
+    number of live matrices must be read back to the host) **/
+template <typename T, typename I, typename INFO, typename U>
+rocblas_status getrf_compact_batch(rocblas_handle handle,
+                                   U A,
+                                   const rocblas_stride strideA,
+                                   INFO* info,
+                                   const I batch_count,
+                                   T** live,
+                                   I* h_nlive)
+{
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    *h_nlive = batch_count;
+    if(stream_is_capturing(stream))
+        return rocblas_status_success;
+
+    rocblas_int* nlive = reinterpret_cast<rocblas_int*>(live + batch_count);
+    HIP_CHECK(hipMemsetAsync(nlive, 0, sizeof(rocblas_int), stream));
+    I blocks = (batch_count - 1) / BS1 + 1;
+    ROCSOLVER_LAUNCH_KERNEL((getrf_compact_kernel<T>), dim3(blocks, 1, 1), dim3(BS1, 1, 1), 0,
+                            stream, A, strideA, info, batch_count, live, nlive);
+
+    rocblas_int count;
+    HIP_CHECK(hipMemcpyAsync(&count, nlive, sizeof(rocblas_int), hipMemcpyDeviceToHost, stream));
+    rocsolver_stats_host_sync();
+    HIP_CHECK(hipStreamSynchronize(stream));
+    *h_nlive = count;
+
+    return rocblas_status_success;
+}
+
+/** Update the trailing matrix after the factorization of the block column j of size jb **/
+template <bool BATCHED, bool STRIDED, typename T, typename I, typename U>
+void getrf_trailing_update(rocblas_handle handle,
+                           const I m,
+                           const I n,
+                           const I j,
+                           const I jb,
+                           U A,
+                           const rocblas_stride shiftA,
+                           const I inca,
+                           const I lda,
+                           const rocblas_stride strideA,
+                           const I batch_count,
+                           const bool optim_mem,
+                           void* work1,
+                           void* work2,
+                           void* work3,
+                           void* work4)
+{
+    T one = 1;
+    T minone = -1;
+    I nextpiv = j + jb; //position for the matrix update
+    I mm = m - nextpiv; //size for the matrix update
+    I nn = n - nextpiv; //size for the matrix update
+
+    rocsolver_trsm_lower<BATCHED, STRIDED, T>(
+        handle, rocblas_side_left, rocblas_operation_none, rocblas_diagonal_unit, jb, nn, A,
+        shiftA + idx2D(j, j, inca, lda), inca, lda, strideA, A,
+        shiftA + idx2D(j, nextpiv, inca, lda), inca, lda, strideA, batch_count, optim_mem, work1,
+        work2, work3, work4);
+
+    if(nextpiv < m)
+    {
+        rocsolver_gemm<BATCHED, STRIDED, T>(
+            handle, rocblas_operation_none, rocblas_operation_none, mm, nn, jb, &minone, A,
+            shiftA + idx2D(nextpiv, j, inca, lda), inca, lda, strideA, A,
+            shiftA + idx2D(j, nextpiv, inca, lda), inca, lda, strideA, &one, A,
+            shiftA + idx2D(nextpiv, nextpiv, inca, lda), inca, lda, strideA, batch_count,
+            (T**)nullptr);
+    }
+}
+
 /** Return the sizes of the different workspace arrays **/
 template <bool BATCHED, bool STRIDED, typename T, typename I>
 void rocsolver_getrf_getMemorySize(const I m,
@@ -601,10 +1409,23 @@ void rocsolver_getrf_getMemorySize(const I m,
         rocsolver_getf2_getMemorySize<ISBATCHED, T>(m, dim, pivot, batch_count, size_scalars,
                                                     size_pivotval, size_pivotidx, true, inca);
 
+        // extra workspace for the candidates of the tournament pivoting
+        if(pivot && m > GETRF_TOURNAMENT_MIN_ROWS)
+        {
+            size_t ntiles = (m - 1) / GETRF_TOURNAMENT_TILE + 1;
+            *size_pivotidx = std::max(*size_pivotidx, sizeof(I) * 2 * batch_count * ntiles
+                                                          * GETRF_RECURSIVE_LEAF_SIZE);
+        }
+
         // extra workspace to store info about singularity and pivots of sub blocks
         *size_iinfo = sizeof(I) * batch_count;
         *size_iipiv = pivot ? m * sizeof(I) * batch_count : 0;
 
+        // with batch compaction, iinfo holds the pointers to the non-singular matrices
+        // and their number
+        if(ISBATCHED)
+            *size_iinfo = sizeof(T*) * batch_count + sizeof(rocblas_int);
+
         // extra workspace for calling largest possible TRSM
         rocsolver_trsm_mem<BATCHED, STRIDED, T>(rocblas_side_left, rocblas_operation_none, dim, n,
                                                 batch_count, size_work1, size_work2, size_work3,
@@ -620,6 +1441,32 @@ void rocsolver_getrf_getMemorySize(const I m,
             *size_work3 = std::max(*size_work3, w3);
             *size_work4 = std::max(*size_work4, w4);
         }
+
+        // (the trailing updates of the non-singular matrices of a strided batch use the
+        //  batched TRSM)
+        if(ISBATCHED && !BATCHED)
+        {
+            size_t w1, w2, w3, w4;
+            rocsolver_trsm_mem<true, false, T>(rocblas_side_left, rocblas_operation_none, dim, n,
+                                               batch_count, &w1, &w2, &w3, &w4, optim_mem, true,
+                                               lda, lda, inca, inca);
+            *size_work1 = std::max(*size_work1, w1);
+            *size_work2 = std::max(*size_work2, w2);
+            *size_work3 = std::max(*size_work3, w3);
+            *size_work4 = std::max(*size_work4, w4);
+        }
+
+        // extra workspace for the panel factorizations if using look-ahead
+        if(getrf_use_lookahead<ISBATCHED>(m, n, blk, pivot))
+        {
+            size_t w1, w2, w3, w4;
+            getrf_lookahead_getMemorySize<BATCHED, STRIDED, T>(blk, batch_count, &w1, &w2, &w3,
+                                                               &w4);
+            *size_work1 += w1;
+            *size_work2 += w2;
+            *size_work3 += w3;
+            *size_work4 += w4;
+        }
     }
 }
 
@@ -681,15 +1528,24 @@ rocblas_status rocsolver_getrf_template(rocblas_handle handle,
                                                       ipiv, shiftP, strideP, info, batch_count,
                                                       scalars, pivotval, pivotidx, pivot);
 
+    // if there are many mid-size matrices, factorize each one with a single thread block
+    // (megakernel) instead of launching the kernels of every block column
+    // (the compaction and tournament pivoting modes keep the blocked algorithm)
+    if constexpr(std::is_same_v<I, rocblas_int> && std::is_same_v<INFO, rocblas_int>
+                 && (std::is_same_v<U, T*> || std::is_same_v<U, T* const*>))
+    {
+        if(inca == 1 && rocsolver_use_megakernel<ISBATCHED>(m, n, batch_count)
+           && !getrf_use_compact(handle) && !getrf_use_tournament(handle))
+            return getrf_run_megakernel<T>(handle, m, n, A, shiftA, lda, strideA, ipiv, shiftP,
+                                           strideP, info, batch_count, pivot);
+    }
+
     // everything must be executed with scalars on the host
     rocblas_pointer_mode old_mode;
     rocblas_get_pointer_mode(handle, &old_mode);
     rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
-    T one = 1;
-    T minone = -1;
 
     I jb, dimx, dimy;
-    I nextpiv, mm, nn;
     size_t lmemsize;
     I j = 0;
 
@@ -702,10 +1558,38 @@ rocblas_status rocsolver_getrf_template(rocblas_handle handle,
         blk = -blk;
     }
 
+    // with the prefetch mode, the block columns of a matrix in managed memory are migrated
+    // to the device ahead of their use (on the side stream, so look-ahead is not used)
+    managed_prefetch prefetch(handle, rocsolver_function_getrf, A, shiftA, inca, lda, n,
+                              batch_count);
+
+    // with batch compaction, the matrices found to be singular are removed from the trailing
+    // updates (look-ahead is not used)
+    const bool compact = ISBATCHED && getrf_use_compact(handle);
+    T** live = reinterpret_cast<T**>(iinfo);
+    I nlive = batch_count;
+
+    // use look-ahead for mid-size matrices
+    if(!prefetch && !compact && getrf_use_lookahead<ISBATCHED>(m, n, blk, pivot))
+    {
+        rocblas_status status = getrf_lookaheadLU<BATCHED, STRIDED, T>(
+            handle, m, n, A, shiftA, inca, lda, strideA, ipiv, shiftP, strideP, info, batch_count,
+            blk, scalars, work1, work2, work3, work4, optim_mem, pivotval, pivotidx, iipiv);
+
+        // (if the side stream is not available, continue with the regular algorithm)
+        if(status != rocblas_status_continue)
+        {
+            rocblas_set_pointer_mode(handle, old_mode);
+            return status;
+        }
+    }
+
     // MAIN LOOP
+    prefetch.to_device(0, blk);
     for(I j = 0; j < dim; j += blk)
     {
         jb = std::min(dim - j, blk);
+        prefetch.to_device(j + jb, j + jb + blk);
 
         if(pivot || panel)
         {
@@ -732,30 +1616,345 @@ rocblas_status rocsolver_getrf_template(rocblas_handle handle,
         }
 
         // update trailing matrix
-        nextpiv = j + jb; //position for the matrix update
-        mm = m - nextpiv; //size for the matrix update
-        nn = n - nextpiv; //size for the matrix update
-        if(nextpiv < n)
+        // (with batch compaction, only the matrices that are still non-singular are updated;
+        //  the panels of the others are still factorized, so that all the pivots are valid)
+        if(j + jb < n)
         {
-            rocsolver_trsm_lower<BATCHED, STRIDED, T>(
-                handle, rocblas_side_left, rocblas_operation_none, rocblas_diagonal_unit, jb, nn, A,
-                shiftA + idx2D(j, j, inca, lda), inca, lda, strideA, A,
-                shiftA + idx2D(j, nextpiv, inca, lda), inca, lda, strideA, batch_count, optim_mem,
-                work1, work2, work3, work4);
+            if(compact && nlive > 0)
+                ROCBLAS_CHECK(getrf_compact_batch(handle, A, strideA, info, batch_count, live,
+                                                  &nlive));
+
+            if(nlive == batch_count)
+                getrf_trailing_update<BATCHED, STRIDED, T>(handle, m, n, j, jb, A, shiftA, inca,
+                                                           lda, strideA, batch_count, optim_mem,
+                                                           work1, work2, work3, work4);
+            else if(nlive > 0)
+                getrf_trailing_update<true, false, T>(handle, m, n, j, jb, (T* const*)live,
+                                                      shiftA, inca, lda, rocblas_stride(0), nlive,
+                                                      optim_mem, work1, work2, work3, work4);
+        }
+
+        // without pivoting, the block column is completed (otherwise, the row interchanges
+        // of the following block columns are still applied to it)
+        if(!pivot)
+            prefetch.to_host(j, j + jb);
+    }
 
-            if(nextpiv < m)
+    rocblas_set_pointer_mode(handle, old_mode);
+    return rocblas_status_success;
+}
+
+/** GETRF_INTERLEAVED_KERNEL factorizes one matrix of the batch per thread, working
+    directly in global memory. It is meant for interleaved batches (inca = batch_count
+    and strideA = 1), where the element (i,j) of consecutive matrices is contiguous in
+    memory and all the accesses of a wavefront are coalesced. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void getrf_interleaved_kernel(const rocblas_int m,
+                                               const rocblas_int n,
+                                               U AA,
+                                               const rocblas_stride shiftA,
+                                               const rocblas_int inca,
+                                               const rocblas_int lda,
+                                               const rocblas_stride strideA,
+                                               rocblas_int* ipivA,
+                                               const rocblas_stride strideP,
+                                               rocblas_int* infoA,
+                                               const bool pivot,
+                                               const rocblas_int batch_count)
+{
+    using S = decltype(std::real(T{}));
+
+    rocblas_int b = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    if(b >= batch_count)
+        return;
+
+    T* A = load_ptr_batch<T>(AA, b, shiftA, strideA);
+    const int64_t ia = inca;
+    const int64_t la = lda;
+    const rocblas_int dim = std::min(m, n);
+    rocblas_int info = 0;
+
+    for(rocblas_int k = 0; k < dim; ++k)
+    {
+        if(pivot)
+        {
+            // find pivot and swap rows
+            rocblas_int p = k;
+            S pmax = aabs<S>(A[k * ia + k * la]);
+            for(rocblas_int i = k + 1; i < m; ++i)
             {
-                rocsolver_gemm<BATCHED, STRIDED, T>(
-                    handle, rocblas_operation_none, rocblas_operation_none, mm, nn, jb, &minone, A,
-                    shiftA + idx2D(nextpiv, j, inca, lda), inca, lda, strideA, A,
-                    shiftA + idx2D(j, nextpiv, inca, lda), inca, lda, strideA, &one, A,
-                    shiftA + idx2D(nextpiv, nextpiv, inca, lda), inca, lda, strideA, batch_count,
-                    (T**)nullptr);
+                S v = aabs<S>(A[i * ia + k * la]);
+                if(v > pmax)
+                {
+                    pmax = v;
+                    p = i;
+                }
+            }
+
+            ipivA[b * strideP + k] = p + 1;
+            if(p != k)
+            {
+                for(rocblas_int j = 0; j < n; ++j)
+                    swap(A[k * ia + j * la], A[p * ia + j * la]);
             }
         }
+
+        // a zero pivot leaves the current column as it is
+        T pivot_value = A[k * ia + k * la];
+        if(pivot_value == T(0))
+        {
+            if(info == 0)
+                info = k + 1;
+            continue;
+        }
+
+        // scale current column and update trailing matrix
+        pivot_value = T(1) / pivot_value;
+        for(rocblas_int i = k + 1; i < m; ++i)
+            A[i * ia + k * la] *= pivot_value;
+
+        for(rocblas_int j = k + 1; j < n; ++j)
+        {
+            const T akj = A[k * ia + j * la];
+            for(rocblas_int i = k + 1; i < m; ++i)
+                A[i * ia + j * la] -= A[i * ia + k * la] * akj;
+        }
+    }
+
+    infoA[b] = info;
+}
+
+template <typename T, typename U>
+rocblas_status rocsolver_getrf_interleaved_template(rocblas_handle handle,
+                                                    const rocblas_int m,
+                                                    const rocblas_int n,
+                                                    U A,
+                                                    const rocblas_stride shiftA,
+                                                    const rocblas_int inca,
+                                                    const rocblas_int lda,
+                                                    const rocblas_stride strideA,
+                                                    rocblas_int* ipiv,
+                                                    const rocblas_stride strideP,
+                                                    rocblas_int* info,
+                                                    const rocblas_int batch_count,
+                                                    const bool pivot)
+{
+    ROCSOLVER_ENTER("getrf_interleaved", "m:", m, "n:", n, "shiftA:", shiftA, "inca:", inca,
+                    "lda:", lda, "bc:", batch_count);
+
+    // quick return if zero instances in batch
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocks = (batch_count - 1) / BS1 + 1;
+    dim3 grid(blocks, 1, 1);
+    dim3 threads(BS1, 1, 1);
+
+    // quick return if no dimensions
+    if(m == 0 || n == 0)
+    {
+        ROCSOLVER_LAUNCH_KERNEL(reset_info, grid, threads, 0, stream, info, batch_count, 0);
+        return rocblas_status_success;
+    }
+
+    ROCSOLVER_LAUNCH_KERNEL((getrf_interleaved_kernel<T, U>), grid, threads, 0, stream, m, n, A,
+                            shiftA, inca, lda, strideA, ipiv, strideP, info, pivot, batch_count);
+
+    return rocblas_status_success;
+}
+
+/** GETRF_VBATCHED_KERNEL factorizes the matrices of a variable-size batch whose size
+    max(m,n) is in (lo, hi]. Each matrix is processed by a thread block working directly
+    in global memory, with every thread in charge of the rows i = tid + k * hipBlockDim_x.
+    The other thread blocks return immediately. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(VBATCHED_MAX_BIN)
+    getrf_vbatched_kernel(const rocblas_int* mm,
+                          const rocblas_int* nn,
+                          U AA,
+                          const rocblas_int* ldaa,
+                          rocblas_int* ipivA,
+                          const rocblas_stride strideP,
+                          rocblas_int* infoA,
+                          const bool pivot,
+                          const rocblas_int lo,
+                          const rocblas_int hi)
+{
+    using S = decltype(std::real(T{}));
+
+    const rocblas_int b = hipBlockIdx_x;
+    const rocblas_int tid = hipThreadIdx_x;
+    const rocblas_int nthds = hipBlockDim_x;
+
+    const rocblas_int m = mm[b];
+    const rocblas_int n = nn[b];
+    const rocblas_int lda = ldaa[b];
+    const rocblas_int size = std::max(std::max(m, n), 1);
+    if(size <= lo || size > hi)
+        return;
+
+    // empty or invalid instances are quick returns
+    if(m <= 0 || n <= 0 || lda < m)
+    {
+        if(tid == 0)
+            infoA[b] = 0;
+        return;
+    }
+
+    T* A = load_ptr_batch<T>(AA, b, 0, 0);
+    rocblas_int* ipiv = ipivA + b * strideP;
+    const int64_t la = lda;
+    const rocblas_int dim = std::min(m, n);
+    rocblas_int info = 0;
+
+    // shared mem for the pivot search
+    extern __shared__ double lmem[];
+    S* sval = reinterpret_cast<S*>(lmem);
+    rocblas_int* sidx = reinterpret_cast<rocblas_int*>(sval + nthds);
+
+    for(rocblas_int k = 0; k < dim; ++k)
+    {
+        if(pivot)
+        {
+            // find pivot (the first element with largest magnitude)
+            S val1 = -1;
+            rocblas_int idx1 = -1;
+            for(rocblas_int i = k + tid; i < m; i += nthds)
+            {
+                S val2 = aabs<S>(A[i + k * la]);
+                if(val2 > val1)
+                {
+                    val1 = val2;
+                    idx1 = i;
+                }
+            }
+            sval[tid] = val1;
+            sidx[tid] = idx1;
+            __syncthreads();
+
+            for(rocblas_int r = nthds / 2; r > 0; r /= 2)
+            {
+                if(tid < r)
+                {
+                    S val2 = sval[tid + r];
+                    rocblas_int idx2 = sidx[tid + r];
+                    if(val2 > val1 || (val2 == val1 && idx2 < idx1))
+                    {
+                        sval[tid] = val1 = val2;
+                        sidx[tid] = idx1 = idx2;
+                    }
+                }
+                __syncthreads();
+            }
+
+            // swap rows
+            const rocblas_int p = sidx[0];
+            if(tid == 0)
+                ipiv[k] = p + 1;
+            if(p != k)
+            {
+                for(rocblas_int j = tid; j < n; j += nthds)
+                    swap(A[k + j * la], A[p + j * la]);
+            }
+            __syncthreads();
+        }
+
+        // a zero pivot leaves the current column as it is
+        T pivot_value = A[k + k * la];
+        if(pivot_value == T(0))
+        {
+            if(info == 0)
+                info = k + 1;
+            continue;
+        }
+
+        // scale current column and update trailing matrix
+        // (every thread only updates its own rows)
+        pivot_value = T(1) / pivot_value;
+        for(rocblas_int i = k + 1 + tid; i < m; i += nthds)
+        {
+            const T aik = A[i + k * la] * pivot_value;
+            A[i + k * la] = aik;
+            for(rocblas_int j = k + 1; j < n; ++j)
+                A[i + j * la] -= aik * A[k + j * la];
+        }
+        __syncthreads();
+    }
+
+    if(tid == 0)
+        infoA[b] = info;
+}
+
+template <typename T, typename U>
+rocblas_status rocsolver_getrf_vbatched_argCheck(rocblas_handle handle,
+                                                 const rocblas_int* m,
+                                                 const rocblas_int* n,
+                                                 U A,
+                                                 const rocblas_int* lda,
+                                                 rocblas_int* ipiv,
+                                                 rocblas_int* info,
+                                                 const bool pivot,
+                                                 const rocblas_int batch_count)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    // (the sizes of the instances are only known on the device)
+    if(batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if(batch_count && (!m || !n || !A || !lda || (pivot && !ipiv) || !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T, typename U>
+rocblas_status rocsolver_getrf_vbatched_template(rocblas_handle handle,
+                                                 const rocblas_int* m,
+                                                 const rocblas_int* n,
+                                                 U A,
+                                                 const rocblas_int* lda,
+                                                 rocblas_int* ipiv,
+                                                 const rocblas_stride strideP,
+                                                 rocblas_int* info,
+                                                 const rocblas_int batch_count,
+                                                 const bool pivot)
+{
+    ROCSOLVER_ENTER("getrf_vbatched", "bc:", batch_count);
+
+    // quick return if zero instances in batch
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    using S = decltype(std::real(T{}));
+    dim3 grid(batch_count, 1, 1);
+
+    // one launch per size bin
+    for(rocblas_int bin = VBATCHED_MIN_BIN; bin <= VBATCHED_MAX_BIN; bin *= 2)
+    {
+        rocblas_int lo = (bin == VBATCHED_MIN_BIN) ? 0 : bin / 2;
+        rocblas_int hi = (bin == VBATCHED_MAX_BIN) ? INT_MAX : bin;
+        size_t lmemsize = (sizeof(S) + sizeof(rocblas_int)) * bin;
+
+        ROCSOLVER_LAUNCH_KERNEL((getrf_vbatched_kernel<T, U>), grid, dim3(bin, 1, 1), lmemsize,
+                                stream, m, n, A, lda, ipiv, strideP, info, pivot, lo, hi);
     }
 
-    rocblas_set_pointer_mode(handle, old_mode);
     return rocblas_status_success;
 }
 
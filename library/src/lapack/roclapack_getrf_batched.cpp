@@ -26,6 +26,7 @@
  * *************************************************************************/
 
 #include "roclapack_getrf.hpp"
+#include "rocsolver_check_mode.hpp"
 
 ROCSOLVER_BEGIN_NAMESPACE
 
@@ -44,17 +45,24 @@ rocblas_status rocsolver_getrf_batched_impl(rocblas_handle handle,
     const char* name = (pivot ? "getrf_batched" : "getrf_npvt_batched");
     ROCSOLVER_ENTER_TOP(name, "-m", m, "-n", n, "--lda", lda, "--strideP", strideP, "--batch_count",
                         batch_count);
+    ROCSOLVER_INFO_SUMMARY(info, batch_count);
 
     using S = decltype(std::real(T{}));
 
     if(!handle)
         return rocblas_status_invalid_handle;
 
-    // argument checking
-    rocblas_status st
-        = rocsolver_getf2_getrf_argCheck(handle, m, n, lda, A, ipiv, info, pivot, batch_count);
-    if(st != rocblas_status_continue)
-        return st;
+    // argument checking (unless disabled with rocsolver_set_check_mode)
+    if(!skip_arg_checks(handle))
+    {
+        rocblas_status st
+            = rocsolver_getf2_getrf_argCheck(handle, m, n, lda, A, ipiv, info, pivot, batch_count);
+        if(st != rocblas_status_continue)
+            return st;
+    }
+
+    // nominal flop count for the call statistics
+    rocsolver_stats_flops(batch_count * rocsolver_getrf_flops<T>(m, n));
 
     // working with unshifted arrays
     rocblas_stride shiftA = 0;
@@ -65,7 +73,7 @@ rocblas_status rocsolver_getrf_batched_impl(rocblas_handle handle,
     rocblas_stride strideA = 0;
 
     // memory workspace sizes:
-    // size for constants in rocblas calls
+    // constants in rocblas calls (only whether they are needed, see set_device_scalars)
     size_t size_scalars;
     // size of reusable workspace (and for calling TRSM)
     bool optim_mem;
@@ -75,19 +83,29 @@ rocblas_status rocsolver_getrf_batched_impl(rocblas_handle handle,
     // size to store info about singularity of each subblock
     size_t size_iinfo, size_iipiv;
 
+    // the batch is split among nstreams internal streams; every sub-batch
+    // uses its own region of the workspace
+    I nstreams = getrf_batch_streams(m, n, batch_count);
+    I count = rocsolver_split_count(batch_count, nstreams);
+
     rocsolver_getrf_getMemorySize<true, false, T>(
-        m, n, pivot, batch_count, &size_scalars, &size_work1, &size_work2, &size_work3, &size_work4,
+        m, n, pivot, count, &size_scalars, &size_work1, &size_work2, &size_work3, &size_work4,
         &size_pivotval, &size_pivotidx, &size_iipiv, &size_iinfo, &optim_mem, lda);
+    rocsolver_split_align(nstreams, size_work1, size_work2, size_work3, size_work4, size_pivotval,
+                          size_pivotidx, size_iipiv, size_iinfo);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work1, size_work2,
-                                                      size_work3, size_work4, size_pivotval,
-                                                      size_pivotidx, size_iipiv, size_iinfo);
+        return rocblas_set_optimal_device_memory_size(
+            handle, size_t(0), nstreams * size_work1, nstreams * size_work2,
+            nstreams * size_work3, nstreams * size_work4, nstreams * size_pivotval,
+            nstreams * size_pivotidx, nstreams * size_iipiv, nstreams * size_iinfo);
 
     // memory workspace allocation
     void *scalars, *work1, *work2, *work3, *work4, *pivotval, *pivotidx, *iinfo, *iipiv;
-    rocblas_device_malloc mem(handle, size_scalars, size_work1, size_work2, size_work3, size_work4,
-                              size_pivotval, size_pivotidx, size_iipiv, size_iinfo);
+    rocblas_device_malloc mem(handle, size_t(0), nstreams * size_work1, nstreams * size_work2,
+                              nstreams * size_work3, nstreams * size_work4,
+                              nstreams * size_pivotval, nstreams * size_pivotidx,
+                              nstreams * size_iipiv, nstreams * size_iinfo);
 
     if(!mem)
         return rocblas_status_memory_error;
@@ -102,13 +120,19 @@ rocblas_status rocsolver_getrf_batched_impl(rocblas_handle handle,
     iipiv = mem[7];
     iinfo = mem[8];
     if(size_scalars > 0)
-        init_scalars(handle, (T*)scalars);
+        ROCBLAS_CHECK(set_device_scalars<T>(scalars));
 
     // execution
-    return rocsolver_getrf_template<true, false, T>(
-        handle, m, n, A, shiftA, inca, lda, strideA, ipiv, shiftP, strideP, info, batch_count,
-        (T*)scalars, work1, work2, work3, work4, (T*)pivotval, (I*)pivotidx, (I*)iipiv, (I*)iinfo,
-        optim_mem, pivot);
+    auto run = [&](I k, I first, I bc) {
+        return rocsolver_getrf_template<true, false, T>(
+            handle, m, n, A + first, shiftA, inca, lda, strideA, ipiv + first * strideP, shiftP,
+            strideP, info + first, bc, (T*)scalars, (char*)work1 + k * size_work1,
+            (char*)work2 + k * size_work2, (char*)work3 + k * size_work3,
+            (char*)work4 + k * size_work4, (T*)((char*)pivotval + k * size_pivotval),
+            (I*)((char*)pivotidx + k * size_pivotidx), (I*)((char*)iipiv + k * size_iipiv),
+            (I*)((char*)iinfo + k * size_iinfo), optim_mem, pivot);
+    };
+    return _info_summary_scope.commit(rocsolver_split_batch(handle, batch_count, nstreams, run));
 }
 
 ROCSOLVER_END_NAMESPACE
@@ -49,6 +49,7 @@ rocblas_status rocsolver_getrf_info32_impl(rocblas_handle handle,
 {
     const char* name = (pivot ? "getrf" : "getrf_npvt");
     ROCSOLVER_ENTER_TOP(name, "-m", m, "-n", n, "--lda", lda);
+    ROCSOLVER_INFO_SUMMARY(info, 1);
 
     using S = decltype(std::real(T{}));
 
@@ -71,7 +72,7 @@ rocblas_status rocsolver_getrf_info32_impl(rocblas_handle handle,
     int64_t batch_count = 1;
 
     // memory workspace sizes:
-    // size for constants in rocblas calls
+    // constants in rocblas calls (only whether they are needed, see set_device_scalars)
     size_t size_scalars;
     // size of reusable workspace (and for calling TRSM)
     bool optim_mem;
@@ -86,13 +87,13 @@ rocblas_status rocsolver_getrf_info32_impl(rocblas_handle handle,
         &size_pivotval, &size_pivotidx, &size_iipiv, &size_iinfo, &optim_mem, lda);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work1, size_work2,
+        return rocblas_set_optimal_device_memory_size(handle, size_t(0), size_work1, size_work2,
                                                       size_work3, size_work4, size_pivotval,
                                                       size_pivotidx, size_iipiv, size_iinfo);
 
     // memory workspace allocation
     void *scalars, *work1, *work2, *work3, *work4, *pivotval, *pivotidx, *iinfo, *iipiv;
-    rocblas_device_malloc mem(handle, size_scalars, size_work1, size_work2, size_work3, size_work4,
+    rocblas_device_malloc mem(handle, size_t(0), size_work1, size_work2, size_work3, size_work4,
                               size_pivotval, size_pivotidx, size_iipiv, size_iinfo);
 
     if(!mem)
@@ -108,13 +109,13 @@ rocblas_status rocsolver_getrf_info32_impl(rocblas_handle handle,
     iipiv = mem[7];
     iinfo = mem[8];
     if(size_scalars > 0)
-        init_scalars(handle, (T*)scalars);
+        ROCBLAS_CHECK(set_device_scalars<T>(scalars));
 
     // execution
-    return rocsolver_getrf_template<false, false, T>(
+    return _info_summary_scope.commit(rocsolver_getrf_template<false, false, T>(
         handle, m, n, A, shiftA, inca, lda, strideA, ipiv, shiftP, strideP, info, batch_count,
         (T*)scalars, work1, work2, work3, work4, (T*)pivotval, (int64_t*)pivotidx, (int64_t*)iipiv,
-        (rocblas_int*)iinfo, optim_mem, pivot);
+        (rocblas_int*)iinfo, optim_mem, pivot));
 }
 
 ROCSOLVER_END_NAMESPACE
@@ -0,0 +1,306 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "roclapack_getrf.hpp"
+#include "rocsolver/rocsolver.h"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/** The routines with half or bfloat16 storage (rocblas_half and rocblas_bfloat16) read and write
+    the matrices in the storage precision, but all the computations are done in single precision **/
+template <typename T>
+__device__ inline float lowprec_to_float(T a)
+{
+    return static_cast<float>(a);
+}
+
+template <typename T>
+__device__ inline T lowprec_from_float(float a)
+{
+    return static_cast<T>(a);
+}
+
+/** LOWPREC_COPY copies the m-by-n matrices A into B converting their entries from type Ta to type
+    Tb (one of them being float). If uplo is not rocblas_fill_full, only the corresponding
+    triangular part is copied. **/
+template <typename Tb, typename Ta>
+ROCSOLVER_KERNEL void lowprec_copy(const rocblas_fill uplo,
+                                   const rocblas_int m,
+                                   const rocblas_int n,
+                                   Ta* A,
+                                   const rocblas_int lda,
+                                   const rocblas_stride strideA,
+                                   Tb* B,
+                                   const rocblas_int ldb,
+                                   const rocblas_stride strideB)
+{
+    const auto b = hipBlockIdx_z;
+    const auto j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+    const auto i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    const bool in_tri
+        = (uplo == rocblas_fill_full) || (uplo == rocblas_fill_upper ? i <= j : i >= j);
+
+    if(i < m && j < n && in_tri)
+        B[b * strideB + i + j * ldb]
+            = static_cast<Tb>(lowprec_to_float(A[b * strideA + i + j * lda]));
+}
+
+/** LOWPREC_RUN_COPY launches LOWPREC_COPY for the whole batch **/
+template <typename Tb, typename Ta>
+void lowprec_run_copy(hipStream_t stream,
+                      const rocblas_fill uplo,
+                      const rocblas_int m,
+                      const rocblas_int n,
+                      Ta* A,
+                      const rocblas_int lda,
+                      const rocblas_stride strideA,
+                      Tb* B,
+                      const rocblas_int ldb,
+                      const rocblas_stride strideB,
+                      const rocblas_int batch_count)
+{
+    rocblas_int blocksx = (m - 1) / BS2 + 1;
+    rocblas_int blocksy = (n - 1) / BS2 + 1;
+    dim3 grid(blocksx, blocksy, batch_count);
+    dim3 threads(BS2, BS2, 1);
+
+    ROCSOLVER_LAUNCH_KERNEL((lowprec_copy<Tb, Ta>), grid, threads, 0, stream, uplo, m, n, A, lda,
+                            strideA, B, ldb, strideB);
+}
+
+/** GETRF_LOWPREC_SMALL_KERNEL computes the LU factorization of the m-by-n matrices A, with
+    m, n <= DIM. Each thread-block factorizes one matrix in LDS with single precision arithmetic;
+    thread i updates row i of the trailing matrix, and thread 0 finds the pivots. **/
+template <int DIM, typename T>
+ROCSOLVER_KERNEL void __launch_bounds__(DIM)
+    getrf_lowprec_small_kernel(const rocblas_int m,
+                               const rocblas_int n,
+                               T* A,
+                               const rocblas_int lda,
+                               const rocblas_stride strideA,
+                               rocblas_int* ipiv,
+                               const rocblas_stride strideP,
+                               rocblas_int* info,
+                               const bool pivot)
+{
+    // the leading dimension in LDS is padded to avoid bank conflicts when accessing rows
+    constexpr rocblas_int lds = DIM + 1;
+
+    const rocblas_int b = hipBlockIdx_x;
+    const rocblas_int tid = hipThreadIdx_x;
+    const rocblas_int dim = std::min(m, n);
+
+    T* Ap = A + b * strideA;
+
+    __shared__ float sA[lds * DIM];
+    __shared__ rocblas_int spiv;
+
+    // read the matrix in single precision
+    if(tid < m)
+    {
+        for(rocblas_int j = 0; j < n; j++)
+            sA[tid + j * lds] = lowprec_to_float(Ap[tid + j * lda]);
+    }
+    __syncthreads();
+
+    rocblas_int myinfo = 0;
+    for(rocblas_int k = 0; k < dim; k++)
+    {
+        // find the pivot (the first entry of largest magnitude, as IAMAX)
+        if(tid == 0)
+        {
+            rocblas_int p = k;
+            if(pivot)
+            {
+                float pmax = std::abs(sA[k + k * lds]);
+                for(rocblas_int i = k + 1; i < m; i++)
+                {
+                    float v = std::abs(sA[i + k * lds]);
+                    if(v > pmax)
+                    {
+                        pmax = v;
+                        p = i;
+                    }
+                }
+                ipiv[b * strideP + k] = p + 1;
+            }
+
+            if(sA[p + k * lds] == 0 && myinfo == 0)
+                myinfo = k + 1;
+            spiv = p;
+        }
+        __syncthreads();
+
+        // interchange rows k and p (thread j swaps the entries in column j)
+        const rocblas_int p = spiv;
+        if(p != k && tid < n)
+        {
+            float temp = sA[k + tid * lds];
+            sA[k + tid * lds] = sA[p + tid * lds];
+            sA[p + tid * lds] = temp;
+        }
+        __syncthreads();
+
+        // compute the multipliers and update the trailing matrix
+        const float pv = sA[k + k * lds];
+        if(tid > k && tid < m && pv != 0)
+        {
+            const float l = sA[tid + k * lds] / pv;
+            sA[tid + k * lds] = l;
+            for(rocblas_int j = k + 1; j < n; j++)
+                sA[tid + j * lds] -= l * sA[k + j * lds];
+        }
+        __syncthreads();
+    }
+
+    // write the factors back in the storage precision
+    if(tid < m)
+    {
+        for(rocblas_int j = 0; j < n; j++)
+            Ap[tid + j * lda] = lowprec_from_float<T>(sA[tid + j * lds]);
+    }
+
+    if(tid == 0)
+        info[b] = myinfo;
+}
+
+/** Return the sizes of the different workspace arrays **/
+template <typename T>
+void rocsolver_getrf_lowprec_getMemorySize(const rocblas_int m,
+                                           const rocblas_int n,
+                                           const bool pivot,
+                                           const rocblas_int batch_count,
+                                           size_t* size_scalars,
+                                           size_t* size_work1,
+                                           size_t* size_work2,
+                                           size_t* size_work3,
+                                           size_t* size_work4,
+                                           size_t* size_pivotval,
+                                           size_t* size_pivotidx,
+                                           size_t* size_iipiv,
+                                           size_t* size_iinfo,
+                                           size_t* size_Awork,
+                                           bool* optim_mem)
+{
+    // if quick return, or if the small kernel is used, no workspace is needed
+    if(m == 0 || n == 0 || batch_count == 0
+       || (m <= LOWPREC_MAX_SMALL_SIZE && n <= LOWPREC_MAX_SMALL_SIZE))
+    {
+        *size_scalars = 0;
+        *size_work1 = 0;
+        *size_work2 = 0;
+        *size_work3 = 0;
+        *size_work4 = 0;
+        *size_pivotval = 0;
+        *size_pivotidx = 0;
+        *size_iipiv = 0;
+        *size_iinfo = 0;
+        *size_Awork = 0;
+        *optim_mem = true;
+        return;
+    }
+
+    // requirements for calling GETRF in single precision
+    rocsolver_getrf_getMemorySize<false, true, float>(
+        m, n, pivot, batch_count, size_scalars, size_work1, size_work2, size_work3, size_work4,
+        size_pivotval, size_pivotidx, size_iipiv, size_iinfo, optim_mem, m);
+
+    // size of the single precision copy of A
+    *size_Awork = sizeof(float) * m * n * batch_count;
+}
+
+template <typename T>
+rocblas_status rocsolver_getrf_lowprec_template(rocblas_handle handle,
+                                                const rocblas_int m,
+                                                const rocblas_int n,
+                                                T* A,
+                                                const rocblas_int lda,
+                                                const rocblas_stride strideA,
+                                                rocblas_int* ipiv,
+                                                const rocblas_stride strideP,
+                                                rocblas_int* info,
+                                                const rocblas_int batch_count,
+                                                float* scalars,
+                                                void* work1,
+                                                void* work2,
+                                                void* work3,
+                                                void* work4,
+                                                float* pivotval,
+                                                rocblas_int* pivotidx,
+                                                rocblas_int* iipiv,
+                                                rocblas_int* iinfo,
+                                                float* Awork,
+                                                const bool optim_mem,
+                                                const bool pivot)
+{
+    ROCSOLVER_ENTER("getrf_lowprec", "m:", m, "n:", n, "lda:", lda, "bc:", batch_count);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // quick return if no dimensions
+    if(m == 0 || n == 0)
+    {
+        rocblas_int blocks = (batch_count - 1) / BS1 + 1;
+        ROCSOLVER_LAUNCH_KERNEL(reset_info, dim3(blocks, 1, 1), dim3(BS1, 1, 1), 0, stream, info,
+                                batch_count, 0);
+        return rocblas_status_success;
+    }
+
+    // small matrices are factorized in LDS by a single kernel
+    if(m <= LOWPREC_MAX_SMALL_SIZE && n <= LOWPREC_MAX_SMALL_SIZE)
+    {
+        ROCSOLVER_LAUNCH_KERNEL((getrf_lowprec_small_kernel<LOWPREC_MAX_SMALL_SIZE, T>),
+                                dim3(batch_count, 1, 1), dim3(LOWPREC_MAX_SMALL_SIZE, 1, 1), 0,
+                                stream, m, n, A, lda, strideA, ipiv, strideP, info, pivot);
+        return rocblas_status_success;
+    }
+
+    // otherwise, factorize a single precision copy of the matrices
+    rocblas_stride strideW = rocblas_stride(m) * n;
+    lowprec_run_copy(stream, rocblas_fill_full, m, n, A, lda, strideA, Awork, m, strideW,
+                     batch_count);
+
+    rocsolver_getrf_template<false, true, float>(
+        handle, m, n, Awork, 0, 1, m, strideW, ipiv, 0, strideP, info, batch_count, scalars, work1,
+        work2, work3, work4, pivotval, pivotidx, iipiv, iinfo, optim_mem, pivot);
+
+    lowprec_run_copy(stream, rocblas_fill_full, m, n, Awork, m, strideW, A, lda, strideA,
+                     batch_count);
+
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
@@ -0,0 +1,180 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "roclapack_getrf_lowprec.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+template <typename T>
+rocblas_status rocsolver_getrf_lowprec_strided_batched_impl(rocblas_handle handle,
+                                                            const rocblas_int m,
+                                                            const rocblas_int n,
+                                                            T* A,
+                                                            const rocblas_int lda,
+                                                            const rocblas_stride strideA,
+                                                            rocblas_int* ipiv,
+                                                            const rocblas_stride strideP,
+                                                            rocblas_int* info,
+                                                            const bool pivot,
+                                                            const rocblas_int batch_count)
+{
+    const char* name
+        = (pivot ? "getrf_lowprec_strided_batched" : "getrf_npvt_lowprec_strided_batched");
+    ROCSOLVER_ENTER_TOP(name, "-m", m, "-n", n, "--lda", lda, "--strideA", strideA, "--strideP",
+                        strideP, "--batch_count", batch_count);
+    ROCSOLVER_INFO_SUMMARY(info, batch_count);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st
+        = rocsolver_getf2_getrf_argCheck(handle, m, n, lda, A, ipiv, info, pivot, batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // memory workspace sizes:
+    // constants in rocblas calls (only whether they are needed, see set_device_scalars)
+    size_t size_scalars;
+    // size of reusable workspace (and for calling TRSM)
+    bool optim_mem;
+    size_t size_work1, size_work2, size_work3, size_work4;
+    // extra requirements for calling GETF2
+    size_t size_pivotval, size_pivotidx;
+    // size to store info about singularity of each subblock
+    size_t size_iinfo, size_iipiv;
+    // size of the single precision copy of A
+    size_t size_Awork;
+
+    rocsolver_getrf_lowprec_getMemorySize<T>(m, n, pivot, batch_count, &size_scalars, &size_work1,
+                                             &size_work2, &size_work3, &size_work4, &size_pivotval,
+                                             &size_pivotidx, &size_iipiv, &size_iinfo, &size_Awork,
+                                             &optim_mem);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_t(0), size_work1, size_work2,
+                                                      size_work3, size_work4, size_pivotval,
+                                                      size_pivotidx, size_iipiv, size_iinfo,
+                                                      size_Awork);
+
+    // memory workspace allocation
+    void *scalars, *work1, *work2, *work3, *work4, *pivotval, *pivotidx, *iinfo, *iipiv, *Awork;
+    rocblas_device_malloc mem(handle, size_t(0), size_work1, size_work2, size_work3, size_work4,
+                              size_pivotval, size_pivotidx, size_iipiv, size_iinfo, size_Awork);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    scalars = mem[0];
+    work1 = mem[1];
+    work2 = mem[2];
+    work3 = mem[3];
+    work4 = mem[4];
+    pivotval = mem[5];
+    pivotidx = mem[6];
+    iipiv = mem[7];
+    iinfo = mem[8];
+    Awork = mem[9];
+    if(size_scalars > 0)
+        ROCBLAS_CHECK(set_device_scalars<float>(scalars));
+
+    // execution
+    return _info_summary_scope.commit(rocsolver_getrf_lowprec_template<T>(
+        handle, m, n, A, lda, strideA, ipiv, strideP, info, batch_count, (float*)scalars, work1,
+        work2, work3, work4, (float*)pivotval, (rocblas_int*)pivotidx, (rocblas_int*)iipiv,
+        (rocblas_int*)iinfo, (float*)Awork, optim_mem, pivot));
+}
+
+ROCSOLVER_END_NAMESPACE
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_hsgetrf_strided_batched(rocblas_handle handle,
+                                                 const rocblas_int m,
+                                                 const rocblas_int n,
+                                                 rocblas_half* A,
+                                                 const rocblas_int lda,
+                                                 const rocblas_stride strideA,
+                                                 rocblas_int* ipiv,
+                                                 const rocblas_stride strideP,
+                                                 rocblas_int* info,
+                                                 const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_getrf_lowprec_strided_batched_impl<rocblas_half>(
+        handle, m, n, A, lda, strideA, ipiv, strideP, info, true, batch_count);
+}
+
+rocblas_status rocsolver_bsgetrf_strided_batched(rocblas_handle handle,
+                                                 const rocblas_int m,
+                                                 const rocblas_int n,
+                                                 rocblas_bfloat16* A,
+                                                 const rocblas_int lda,
+                                                 const rocblas_stride strideA,
+                                                 rocblas_int* ipiv,
+                                                 const rocblas_stride strideP,
+                                                 rocblas_int* info,
+                                                 const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_getrf_lowprec_strided_batched_impl<rocblas_bfloat16>(
+        handle, m, n, A, lda, strideA, ipiv, strideP, info, true, batch_count);
+}
+
+rocblas_status rocsolver_hsgetrf_npvt_strided_batched(rocblas_handle handle,
+                                                      const rocblas_int m,
+                                                      const rocblas_int n,
+                                                      rocblas_half* A,
+                                                      const rocblas_int lda,
+                                                      const rocblas_stride strideA,
+                                                      rocblas_int* info,
+                                                      const rocblas_int batch_count)
+{
+    rocblas_int* ipiv = nullptr;
+    return rocsolver::rocsolver_getrf_lowprec_strided_batched_impl<rocblas_half>(
+        handle, m, n, A, lda, strideA, ipiv, 0, info, false, batch_count);
+}
+
+rocblas_status rocsolver_bsgetrf_npvt_strided_batched(rocblas_handle handle,
+                                                      const rocblas_int m,
+                                                      const rocblas_int n,
+                                                      rocblas_bfloat16* A,
+                                                      const rocblas_int lda,
+                                                      const rocblas_stride strideA,
+                                                      rocblas_int* info,
+                                                      const rocblas_int batch_count)
+{
+    rocblas_int* ipiv = nullptr;
+    return rocsolver::rocsolver_getrf_lowprec_strided_batched_impl<rocblas_bfloat16>(
+        handle, m, n, A, lda, strideA, ipiv, 0, info, false, batch_count);
+}
+
+} // extern C
@@ -40,6 +40,7 @@ rocblas_status rocsolver_getri_impl(rocblas_handle handle,
 {
     const char* name = (pivot ? "getri" : "getri_npvt");
     ROCSOLVER_ENTER_TOP(name, "-n", n, "--lda", lda);
+    ROCSOLVER_INFO_SUMMARY(info, 1);
 
     if(!handle)
         return rocblas_status_invalid_handle;
@@ -90,9 +91,9 @@ rocblas_status rocsolver_getri_impl(rocblas_handle handle,
     workArr = mem[5];
 
     // execution
-    return rocsolver_getri_template<false, false, T>(
+    return _info_summary_scope.commit(rocsolver_getri_template<false, false, T>(
         handle, n, A, shiftA, lda, strideA, ipiv, shiftP, strideP, info, batch_count, work1, work2,
-        work3, work4, (T*)tmpcopy, (T**)workArr, optim_mem, pivot);
+        work3, work4, (T*)tmpcopy, (T**)workArr, optim_mem, pivot));
 }
 
 ROCSOLVER_END_NAMESPACE
@@ -37,6 +37,7 @@
 #include "roclapack_trtri.hpp"
 #include "rocsolver/rocsolver.h"
 #include "rocsolver_run_specialized_kernels.hpp"
+#include "rocsolver_tuning.hpp"
 
 ROCSOLVER_BEGIN_NAMESPACE
 
@@ -152,19 +153,39 @@ rocblas_int getri_get_blksize(const rocblas_int dim)
         rocblas_int size[] = {GETRI_BATCH_BLKSIZES};
         rocblas_int intervals[] = {GETRI_BATCH_INTERVALS};
         rocblas_int max = GETRI_BATCH_NUM_INTERVALS;
-        blk = size[get_index(intervals, max, dim)];
+        blk = get_tuned_blksize("getri_batch", size, intervals, max, dim);
     }
     else
     {
         rocblas_int size[] = {GETRI_BLKSIZES};
         rocblas_int intervals[] = {GETRI_INTERVALS};
         rocblas_int max = GETRI_NUM_INTERVALS;
-        blk = size[get_index(intervals, max, dim)];
+        blk = get_tuned_blksize("getri", size, intervals, max, dim);
     }
 
     return blk;
 }
 
+/** Returns the panel width of the blocked Gauss-Jordan kernel for the given size (batched cases
+    only), or 0 if the kernel is not used **/
+template <bool ISBATCHED>
+rocblas_int getri_gj_get_blksize(const rocblas_int dim)
+{
+    rocblas_int blk = 0;
+
+#ifdef OPTIMAL
+    if(ISBATCHED && dim <= GETRI_BATCH_GJ_MAX_SIZE)
+    {
+        rocblas_int size[] = {GETRI_BATCH_GJ_BLKSIZES};
+        rocblas_int intervals[] = {GETRI_BATCH_GJ_INTERVALS};
+        rocblas_int max = GETRI_BATCH_GJ_NUM_INTERVALS;
+        blk = std::max(0, get_tuned_blksize("getri_batch_gj", size, intervals, max, dim));
+    }
+#endif
+
+    return blk;
+}
+
 template <bool BATCHED, bool STRIDED, typename T>
 void rocsolver_getri_getMemorySize(const rocblas_int n,
                                    const rocblas_int batch_count,
@@ -192,8 +213,10 @@ void rocsolver_getri_getMemorySize(const rocblas_int n,
     static constexpr bool ISBATCHED = BATCHED || STRIDED;
 
 #ifdef OPTIMAL
-    // if tiny size, no workspace needed
-    if((n <= GETRI_TINY_SIZE && !ISBATCHED) || (n <= GETRI_BATCH_TINY_SIZE && ISBATCHED))
+    // if tiny (or medium-size batched) case, no workspace needed
+    if((n <= GETRI_TINY_SIZE && !ISBATCHED) || (n <= GETRI_BATCH_TINY_SIZE && ISBATCHED)
+       || (n > GETRI_MAX_COLS && n <= GETRI_BATCH_MEDIUM_SIZE && ISBATCHED)
+       || getri_gj_get_blksize<ISBATCHED>(n) > 0)
     {
         *size_work1 = 0;
         *size_work2 = 0;
@@ -335,6 +358,22 @@ rocblas_status rocsolver_getri_template(rocblas_handle handle,
         return getri_run_small<T>(handle, n, A, shiftA, lda, strideA, ipiv, shiftP, strideP, info,
                                   batch_count, true, pivot);
     }
+
+    // if the blocked Gauss-Jordan kernel is selected (batched cases), use it for all the stages
+    rocblas_int gj_blk = getri_gj_get_blksize<ISBATCHED>(n);
+    if(gj_blk > 0)
+    {
+        return getri_run_gj<T>(handle, rocblas_fill_upper, rocblas_diagonal_non_unit, n, gj_blk, A,
+                               shiftA, lda, strideA, ipiv, shiftP, strideP, info, batch_count,
+                               false, pivot);
+    }
+
+    // if medium size (batched cases), use the optimized kernel for all the stages
+    if(n > GETRI_MAX_COLS && n <= GETRI_BATCH_MEDIUM_SIZE && ISBATCHED)
+    {
+        return getri_run_medium<T>(handle, n, A, shiftA, lda, strideA, ipiv, shiftP, strideP,
+                                   info, batch_count, pivot);
+    }
 #endif
 
     // compute inverse of U (also check singularity and update info)
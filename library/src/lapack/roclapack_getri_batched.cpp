@@ -43,6 +43,7 @@ rocblas_status rocsolver_getri_batched_impl(rocblas_handle handle,
     const char* name = (pivot ? "getri_batched" : "getri_npvt_batched");
     ROCSOLVER_ENTER_TOP(name, "-n", n, "--lda", lda, "--strideP", strideP, "--batch_count",
                         batch_count);
+    ROCSOLVER_INFO_SUMMARY(info, batch_count);
 
     if(!handle)
         return rocblas_status_invalid_handle;
@@ -91,9 +92,9 @@ rocblas_status rocsolver_getri_batched_impl(rocblas_handle handle,
     workArr = mem[5];
 
     // execution
-    return rocsolver_getri_template<true, false, T>(
+    return _info_summary_scope.commit(rocsolver_getri_template<true, false, T>(
         handle, n, A, shiftA, lda, strideA, ipiv, shiftP, strideP, info, batch_count, work1, work2,
-        work3, work4, (T*)tmpcopy, (T**)workArr, optim_mem, pivot);
+        work3, work4, (T*)tmpcopy, (T**)workArr, optim_mem, pivot));
 }
 
 ROCSOLVER_END_NAMESPACE
@@ -42,6 +42,7 @@ rocblas_status rocsolver_getri_outofplace_impl(rocblas_handle handle,
 {
     const char* name = (pivot ? "getri_outofplace" : "getri_npvt_outofplace");
     ROCSOLVER_ENTER_TOP(name, "-n", n, "--lda", lda, "--ldc", ldc);
+    ROCSOLVER_INFO_SUMMARY(info, 1);
 
     if(!handle)
         return rocblas_status_invalid_handle;
@@ -87,9 +88,9 @@ rocblas_status rocsolver_getri_outofplace_impl(rocblas_handle handle,
     work4 = mem[3];
 
     // Execution
-    return rocsolver_getri_outofplace_template<false, false, T>(
+    return _info_summary_scope.commit(rocsolver_getri_outofplace_template<false, false, T>(
         handle, n, A, shiftA, lda, strideA, ipiv, shiftP, strideP, C, shiftC, ldc, strideC, info,
-        batch_count, work1, work2, work3, work4, optim_mem, pivot);
+        batch_count, work1, work2, work3, work4, optim_mem, pivot));
 }
 
 ROCSOLVER_END_NAMESPACE
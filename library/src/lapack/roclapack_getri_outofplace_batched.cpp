@@ -45,6 +45,7 @@ rocblas_status rocsolver_getri_outofplace_batched_impl(rocblas_handle handle,
     const char* name = (pivot ? "getri_outofplace_batched" : "getri_npvt_outofplace_batched");
     ROCSOLVER_ENTER_TOP(name, "-n", n, "--lda", lda, "--strideP", strideP, "--ldc", ldc,
                         "--batch_count", batch_count);
+    ROCSOLVER_INFO_SUMMARY(info, batch_count);
 
     if(!handle)
         return rocblas_status_invalid_handle;
@@ -88,9 +89,9 @@ rocblas_status rocsolver_getri_outofplace_batched_impl(rocblas_handle handle,
     work4 = mem[3];
 
     // Execution
-    return rocsolver_getri_outofplace_template<true, false, T>(
+    return _info_summary_scope.commit(rocsolver_getri_outofplace_template<true, false, T>(
         handle, n, A, shiftA, lda, strideA, ipiv, shiftP, strideP, C, shiftC, ldc, strideC, info,
-        batch_count, work1, work2, work3, work4, optim_mem, pivot);
+        batch_count, work1, work2, work3, work4, optim_mem, pivot));
 }
 
 ROCSOLVER_END_NAMESPACE
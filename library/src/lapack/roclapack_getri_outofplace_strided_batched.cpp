@@ -48,6 +48,7 @@ rocblas_status rocsolver_getri_outofplace_strided_batched_impl(rocblas_handle ha
         = (pivot ? "getri_outofplace_strided_batched" : "getri_npvt_outofplace_strided_batched");
     ROCSOLVER_ENTER_TOP(name, "-n", n, "--lda", lda, "--strideA", strideA, "--strideP", strideP,
                         "--ldc", ldc, "--strideC", strideC, "--batch_count", batch_count);
+    ROCSOLVER_INFO_SUMMARY(info, batch_count);
 
     if(!handle)
         return rocblas_status_invalid_handle;
@@ -87,9 +88,9 @@ rocblas_status rocsolver_getri_outofplace_strided_batched_impl(rocblas_handle ha
     work4 = mem[3];
 
     // Execution
-    return rocsolver_getri_outofplace_template<false, true, T>(
+    return _info_summary_scope.commit(rocsolver_getri_outofplace_template<false, true, T>(
         handle, n, A, shiftA, lda, strideA, ipiv, shiftP, strideP, C, shiftC, ldc, strideC, info,
-        batch_count, work1, work2, work3, work4, optim_mem, pivot);
+        batch_count, work1, work2, work3, work4, optim_mem, pivot));
 }
 
 ROCSOLVER_END_NAMESPACE
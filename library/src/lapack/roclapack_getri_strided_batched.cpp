@@ -44,6 +44,7 @@ rocblas_status rocsolver_getri_strided_batched_impl(rocblas_handle handle,
     const char* name = (pivot ? "getri_strided_batched" : "getri_npvt_strided_batched");
     ROCSOLVER_ENTER_TOP(name, "-n", n, "--lda", lda, "--strideA", strideA, "--strideP", strideP,
                         "--batch_count", batch_count);
+    ROCSOLVER_INFO_SUMMARY(info, batch_count);
 
     if(!handle)
         return rocblas_status_invalid_handle;
@@ -89,9 +90,9 @@ rocblas_status rocsolver_getri_strided_batched_impl(rocblas_handle handle,
     workArr = mem[5];
 
     // execution
-    return rocsolver_getri_template<false, true, T>(
+    return _info_summary_scope.commit(rocsolver_getri_template<false, true, T>(
         handle, n, A, shiftA, lda, strideA, ipiv, shiftP, strideP, info, batch_count, work1, work2,
-        work3, work4, (T*)tmpcopy, (T**)workArr, optim_mem, pivot);
+        work3, work4, (T*)tmpcopy, (T**)workArr, optim_mem, pivot));
 }
 
 ROCSOLVER_END_NAMESPACE
@@ -4,7 +4,7 @@
  *     Univ. of Tennessee, Univ. of California Berkeley,
  *     Univ. of Colorado Denver and NAG Ltd..
  *     December 2016
- * Copyright (C) 2019-2024 Advanced Micro Devices, Inc. All rights reserved.
+ * Copyright (C) 2019-2025 Advanced Micro Devices, Inc. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions
@@ -49,7 +49,9 @@ rocblas_status rocsolver_getrs_argCheck(rocblas_handle handle,
                                         T A,
                                         T B,
                                         const I* ipiv,
-                                        const I batch_count = 1)
+                                        const I batch_count = 1,
+                                        const I inca = 1,
+                                        const I incb = 1)
 {
     // order is important for unit tests:
 
@@ -59,7 +61,8 @@ rocblas_status rocsolver_getrs_argCheck(rocblas_handle handle,
         return rocblas_status_invalid_value;
 
     // 2. invalid size
-    if(n < 0 || nrhs < 0 || lda < n || ldb < n || batch_count < 0)
+    if(n < 0 || nrhs < 0 || inca < 1 || lda < inca * n || incb < 1 || ldb < incb * n
+       || batch_count < 0)
         return rocblas_status_invalid_size;
 
     // skip pointer check if querying memory size
@@ -73,6 +76,15 @@ rocblas_status rocsolver_getrs_argCheck(rocblas_handle handle,
     return rocblas_status_continue;
 }
 
+/** This function returns true if the systems can be solved by the fused kernel for tiny
+    sizes (the factors and all the right-hand sides must be contiguous in memory) **/
+template <typename I>
+inline bool rocsolver_getrs_use_small(const I n, const I nrhs, const I inca, const I incb)
+{
+    return std::is_same_v<I, rocblas_int> && n <= GETRS_SMALL_MAX_SIZE
+        && nrhs <= GETRS_SMALL_MAX_NRHS && inca == 1 && incb == 1;
+}
+
 template <bool BATCHED, bool STRIDED, typename T, typename I>
 void rocsolver_getrs_getMemorySize(rocblas_operation trans,
                                    const I n,
@@ -99,10 +111,23 @@ void rocsolver_getrs_getMemorySize(rocblas_operation trans,
         return;
     }
 
+#ifdef OPTIMAL
+    // no workspace needed when using the fused kernel for tiny sizes
+    if(rocsolver_getrs_use_small<I>(n, nrhs, inca, incb))
+    {
+        *size_work1 = 0;
+        *size_work2 = 0;
+        *size_work3 = 0;
+        *size_work4 = 0;
+        *optim_mem = true;
+        return;
+    }
+#endif
+
     // workspace required for calling TRSM
-    rocsolver_trsm_mem<BATCHED, STRIDED, T>(rocblas_side_left, trans, n, nrhs, batch_count,
-                                            size_work1, size_work2, size_work3, size_work4,
-                                            optim_mem, lda, ldb, inca, incb);
+    rocsolver_trsm_left_invdiag_mem<BATCHED, STRIDED, T>(trans, n, nrhs, batch_count, size_work1,
+                                                         size_work2, size_work3, size_work4,
+                                                         optim_mem, lda, ldb, inca, incb);
 }
 
 template <bool BATCHED, bool STRIDED, typename T, typename I, typename U>
@@ -138,6 +163,16 @@ rocblas_status rocsolver_getrs_template(rocblas_handle handle,
     if(n == 0 || nrhs == 0 || batch_count == 0)
         return rocblas_status_success;
 
+#ifdef OPTIMAL
+    // if tiny size, apply the row interchanges and solve with a single kernel
+    if constexpr(std::is_same_v<I, rocblas_int>)
+    {
+        if(rocsolver_getrs_use_small<I>(n, nrhs, inca, incb))
+            return getrs_run_small<T>(handle, trans, n, nrhs, A, shiftA, lda, strideA, ipiv,
+                                      strideP, B, shiftB, ldb, strideB, batch_count, pivot);
+    }
+#endif
+
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
@@ -154,30 +189,30 @@ rocblas_status rocsolver_getrs_template(rocblas_handle handle,
                                            0, 1, strideP, batch_count);
 
         // solve L*X = B, overwriting B with X
-        rocsolver_trsm_lower<BATCHED, STRIDED, T>(handle, rocblas_side_left, trans,
-                                                  rocblas_diagonal_unit, n, nrhs, A, shiftA, inca,
-                                                  lda, strideA, B, shiftB, incb, ldb, strideB,
-                                                  batch_count, optim_mem, work1, work2, work3, work4);
+        rocsolver_trsm_left_invdiag<BATCHED, STRIDED, T>(
+            handle, rocblas_fill_lower, trans, rocblas_diagonal_unit, n, nrhs, A, shiftA, inca, lda,
+            strideA, B, shiftB, incb, ldb, strideB, batch_count, optim_mem, work1, work2, work3,
+            work4);
 
         // solve U*X = B, overwriting B with X
-        rocsolver_trsm_upper<BATCHED, STRIDED, T>(handle, rocblas_side_left, trans,
-                                                  rocblas_diagonal_non_unit, n, nrhs, A, shiftA,
-                                                  inca, lda, strideA, B, shiftB, incb, ldb, strideB,
-                                                  batch_count, optim_mem, work1, work2, work3, work4);
+        rocsolver_trsm_left_invdiag<BATCHED, STRIDED, T>(
+            handle, rocblas_fill_upper, trans, rocblas_diagonal_non_unit, n, nrhs, A, shiftA, inca,
+            lda, strideA, B, shiftB, incb, ldb, strideB, batch_count, optim_mem, work1, work2,
+            work3, work4);
     }
     else
     {
         // solve U'*X = B or U**H *X = B, overwriting B with X
-        rocsolver_trsm_upper<BATCHED, STRIDED, T>(handle, rocblas_side_left, trans,
-                                                  rocblas_diagonal_non_unit, n, nrhs, A, shiftA,
-                                                  inca, lda, strideA, B, shiftB, incb, ldb, strideB,
-                                                  batch_count, optim_mem, work1, work2, work3, work4);
+        rocsolver_trsm_left_invdiag<BATCHED, STRIDED, T>(
+            handle, rocblas_fill_upper, trans, rocblas_diagonal_non_unit, n, nrhs, A, shiftA, inca,
+            lda, strideA, B, shiftB, incb, ldb, strideB, batch_count, optim_mem, work1, work2,
+            work3, work4);
 
         // solve L'*X = B, or L**H *X = B overwriting B with X
-        rocsolver_trsm_lower<BATCHED, STRIDED, T>(handle, rocblas_side_left, trans,
-                                                  rocblas_diagonal_unit, n, nrhs, A, shiftA, inca,
-                                                  lda, strideA, B, shiftB, incb, ldb, strideB,
-                                                  batch_count, optim_mem, work1, work2, work3, work4);
+        rocsolver_trsm_left_invdiag<BATCHED, STRIDED, T>(
+            handle, rocblas_fill_lower, trans, rocblas_diagonal_unit, n, nrhs, A, shiftA, inca, lda,
+            strideA, B, shiftB, incb, ldb, strideB, batch_count, optim_mem, work1, work2, work3,
+            work4);
 
         // then apply row interchanges to the solution vectors
         if(pivot)
@@ -189,4 +224,360 @@ rocblas_status rocsolver_getrs_template(rocblas_handle handle,
     return rocblas_status_success;
 }
 
+/** GETRS_INTERLEAVED_KERNEL solves the system of one matrix of the batch per thread,
+    working directly in global memory. It is meant for interleaved batches (inca = incb =
+    batch_count and strideA = strideB = 1), where all the accesses of a wavefront are
+    coalesced. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void getrs_interleaved_kernel(const rocblas_operation trans,
+                                               const rocblas_int n,
+                                               const rocblas_int nrhs,
+                                               U AA,
+                                               const rocblas_stride shiftA,
+                                               const rocblas_int inca,
+                                               const rocblas_int lda,
+                                               const rocblas_stride strideA,
+                                               const rocblas_int* ipivA,
+                                               const rocblas_stride strideP,
+                                               U BB,
+                                               const rocblas_stride shiftB,
+                                               const rocblas_int incb,
+                                               const rocblas_int ldb,
+                                               const rocblas_stride strideB,
+                                               const rocblas_int batch_count)
+{
+    rocblas_int b = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    if(b >= batch_count)
+        return;
+
+    T* A = load_ptr_batch<T>(AA, b, shiftA, strideA);
+    T* B = load_ptr_batch<T>(BB, b, shiftB, strideB);
+    const rocblas_int* ipiv = ipivA + b * strideP;
+    const int64_t ia = inca;
+    const int64_t la = lda;
+    const int64_t ib = incb;
+    const int64_t lb = ldb;
+
+    if(trans == rocblas_operation_none)
+    {
+        // apply row interchanges
+        for(rocblas_int k = 0; k < n; ++k)
+        {
+            rocblas_int p = ipiv[k] - 1;
+            if(p != k)
+            {
+                for(rocblas_int c = 0; c < nrhs; ++c)
+                    swap(B[k * ib + c * lb], B[p * ib + c * lb]);
+            }
+        }
+
+        for(rocblas_int c = 0; c < nrhs; ++c)
+        {
+            // forward substitution with L (unit diagonal)
+            for(rocblas_int k = 0; k < n; ++k)
+            {
+                const T bk = B[k * ib + c * lb];
+                for(rocblas_int i = k + 1; i < n; ++i)
+                    B[i * ib + c * lb] -= A[i * ia + k * la] * bk;
+            }
+
+            // backward substitution with U
+            for(rocblas_int k = n - 1; k >= 0; --k)
+            {
+                const T bk = B[k * ib + c * lb] / A[k * ia + k * la];
+                B[k * ib + c * lb] = bk;
+                for(rocblas_int i = 0; i < k; ++i)
+                    B[i * ib + c * lb] -= A[i * ia + k * la] * bk;
+            }
+        }
+    }
+    else
+    {
+        const bool cnj = (trans == rocblas_operation_conjugate_transpose);
+
+        for(rocblas_int c = 0; c < nrhs; ++c)
+        {
+            // forward substitution with U' (or U^T)
+            for(rocblas_int k = 0; k < n; ++k)
+            {
+                const T akk = A[k * ia + k * la];
+                const T bk = B[k * ib + c * lb] / (cnj ? conj(akk) : akk);
+                B[k * ib + c * lb] = bk;
+                for(rocblas_int i = k + 1; i < n; ++i)
+                {
+                    const T aki = A[k * ia + i * la];
+                    B[i * ib + c * lb] -= (cnj ? conj(aki) : aki) * bk;
+                }
+            }
+
+            // backward substitution with L' (or L^T, unit diagonal)
+            for(rocblas_int k = n - 1; k >= 0; --k)
+            {
+                const T bk = B[k * ib + c * lb];
+                for(rocblas_int i = 0; i < k; ++i)
+                {
+                    const T aki = A[k * ia + i * la];
+                    B[i * ib + c * lb] -= (cnj ? conj(aki) : aki) * bk;
+                }
+            }
+        }
+
+        // apply row interchanges in reverse order
+        for(rocblas_int k = n - 1; k >= 0; --k)
+        {
+            rocblas_int p = ipiv[k] - 1;
+            if(p != k)
+            {
+                for(rocblas_int c = 0; c < nrhs; ++c)
+                    swap(B[k * ib + c * lb], B[p * ib + c * lb]);
+            }
+        }
+    }
+}
+
+template <typename T, typename U>
+rocblas_status rocsolver_getrs_interleaved_template(rocblas_handle handle,
+                                                    const rocblas_operation trans,
+                                                    const rocblas_int n,
+                                                    const rocblas_int nrhs,
+                                                    U A,
+                                                    const rocblas_stride shiftA,
+                                                    const rocblas_int inca,
+                                                    const rocblas_int lda,
+                                                    const rocblas_stride strideA,
+                                                    const rocblas_int* ipiv,
+                                                    const rocblas_stride strideP,
+                                                    U B,
+                                                    const rocblas_stride shiftB,
+                                                    const rocblas_int incb,
+                                                    const rocblas_int ldb,
+                                                    const rocblas_stride strideB,
+                                                    const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER("getrs_interleaved", "trans:", trans, "n:", n, "nrhs:", nrhs, "shiftA:", shiftA,
+                    "inca:", inca, "lda:", lda, "shiftB:", shiftB, "incb:", incb, "ldb:", ldb,
+                    "bc:", batch_count);
+
+    // quick return
+    if(n == 0 || nrhs == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocks = (batch_count - 1) / BS1 + 1;
+    ROCSOLVER_LAUNCH_KERNEL((getrs_interleaved_kernel<T, U>), dim3(blocks, 1, 1), dim3(BS1, 1, 1),
+                            0, stream, trans, n, nrhs, A, shiftA, inca, lda, strideA, ipiv,
+                            strideP, B, shiftB, incb, ldb, strideB, batch_count);
+
+    return rocblas_status_success;
+}
+
+/** GETRS_VBATCHED_KERNEL solves the systems of a variable-size batch whose size n is in
+    (lo, hi]. Each system is processed by a thread block working directly in global memory,
+    with every thread in charge of the rows i = tid + k * hipBlockDim_x of B for the
+    substitutions, and of the columns c = tid + k * hipBlockDim_x for the row interchanges.
+    The other thread blocks return immediately. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(VBATCHED_MAX_BIN)
+    getrs_vbatched_kernel(const rocblas_operation trans,
+                          const rocblas_int* nn,
+                          const rocblas_int* nnrhs,
+                          U AA,
+                          const rocblas_int* ldaa,
+                          const rocblas_int* ipivA,
+                          const rocblas_stride strideP,
+                          U BB,
+                          const rocblas_int* ldbb,
+                          const rocblas_int lo,
+                          const rocblas_int hi)
+{
+    const rocblas_int b = hipBlockIdx_x;
+    const rocblas_int tid = hipThreadIdx_x;
+    const rocblas_int nthds = hipBlockDim_x;
+
+    const rocblas_int n = nn[b];
+    const rocblas_int nrhs = nnrhs[b];
+    const rocblas_int lda = ldaa[b];
+    const rocblas_int ldb = ldbb[b];
+    const rocblas_int size = std::max(n, 1);
+    if(size <= lo || size > hi)
+        return;
+
+    // empty or invalid instances are quick returns
+    if(n <= 0 || nrhs <= 0 || lda < n || ldb < n)
+        return;
+
+    T* A = load_ptr_batch<T>(AA, b, 0, 0);
+    T* B = load_ptr_batch<T>(BB, b, 0, 0);
+    const rocblas_int* ipiv = ipivA + b * strideP;
+    const int64_t la = lda;
+    const int64_t lb = ldb;
+
+    if(trans == rocblas_operation_none)
+    {
+        // apply row interchanges
+        for(rocblas_int c = tid; c < nrhs; c += nthds)
+        {
+            for(rocblas_int k = 0; k < n; ++k)
+            {
+                rocblas_int p = ipiv[k] - 1;
+                if(p != k)
+                    swap(B[k + c * lb], B[p + c * lb]);
+            }
+        }
+        __syncthreads();
+
+        // forward substitution with L (unit diagonal)
+        for(rocblas_int k = 0; k < n; ++k)
+        {
+            for(rocblas_int i = k + 1 + tid; i < n; i += nthds)
+            {
+                const T aik = A[i + k * la];
+                for(rocblas_int c = 0; c < nrhs; ++c)
+                    B[i + c * lb] -= aik * B[k + c * lb];
+            }
+            __syncthreads();
+        }
+
+        // backward substitution with U
+        for(rocblas_int k = n - 1; k >= 0; --k)
+        {
+            if(k % nthds == tid)
+            {
+                const T akk = A[k + k * la];
+                for(rocblas_int c = 0; c < nrhs; ++c)
+                    B[k + c * lb] = B[k + c * lb] / akk;
+            }
+            __syncthreads();
+
+            for(rocblas_int i = tid; i < k; i += nthds)
+            {
+                const T aik = A[i + k * la];
+                for(rocblas_int c = 0; c < nrhs; ++c)
+                    B[i + c * lb] -= aik * B[k + c * lb];
+            }
+        }
+    }
+    else
+    {
+        const bool cnj = (trans == rocblas_operation_conjugate_transpose);
+
+        // forward substitution with U' (or U^T)
+        for(rocblas_int k = 0; k < n; ++k)
+        {
+            if(k % nthds == tid)
+            {
+                const T akk = A[k + k * la];
+                for(rocblas_int c = 0; c < nrhs; ++c)
+                    B[k + c * lb] = B[k + c * lb] / (cnj ? conj(akk) : akk);
+            }
+            __syncthreads();
+
+            for(rocblas_int i = k + 1 + tid; i < n; i += nthds)
+            {
+                const T aki = A[k + i * la];
+                for(rocblas_int c = 0; c < nrhs; ++c)
+                    B[i + c * lb] -= (cnj ? conj(aki) : aki) * B[k + c * lb];
+            }
+        }
+
+        // backward substitution with L' (or L^T, unit diagonal)
+        for(rocblas_int k = n - 1; k >= 0; --k)
+        {
+            __syncthreads();
+            for(rocblas_int i = tid; i < k; i += nthds)
+            {
+                const T aki = A[k + i * la];
+                for(rocblas_int c = 0; c < nrhs; ++c)
+                    B[i + c * lb] -= (cnj ? conj(aki) : aki) * B[k + c * lb];
+            }
+        }
+        __syncthreads();
+
+        // apply row interchanges in reverse order
+        for(rocblas_int c = tid; c < nrhs; c += nthds)
+        {
+            for(rocblas_int k = n - 1; k >= 0; --k)
+            {
+                rocblas_int p = ipiv[k] - 1;
+                if(p != k)
+                    swap(B[k + c * lb], B[p + c * lb]);
+            }
+        }
+    }
+}
+
+template <typename T, typename U>
+rocblas_status rocsolver_getrs_vbatched_argCheck(rocblas_handle handle,
+                                                 const rocblas_operation trans,
+                                                 const rocblas_int* n,
+                                                 const rocblas_int* nrhs,
+                                                 U A,
+                                                 const rocblas_int* lda,
+                                                 const rocblas_int* ipiv,
+                                                 U B,
+                                                 const rocblas_int* ldb,
+                                                 const rocblas_int batch_count)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(trans != rocblas_operation_none && trans != rocblas_operation_transpose
+       && trans != rocblas_operation_conjugate_transpose)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    // (the sizes of the instances are only known on the device)
+    if(batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if(batch_count && (!n || !nrhs || !A || !lda || !ipiv || !B || !ldb))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T, typename U>
+rocblas_status rocsolver_getrs_vbatched_template(rocblas_handle handle,
+                                                 const rocblas_operation trans,
+                                                 const rocblas_int* n,
+                                                 const rocblas_int* nrhs,
+                                                 U A,
+                                                 const rocblas_int* lda,
+                                                 const rocblas_int* ipiv,
+                                                 const rocblas_stride strideP,
+                                                 U B,
+                                                 const rocblas_int* ldb,
+                                                 const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER("getrs_vbatched", "trans:", trans, "bc:", batch_count);
+
+    // quick return if zero instances in batch
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    dim3 grid(batch_count, 1, 1);
+
+    // one launch per size bin
+    for(rocblas_int bin = VBATCHED_MIN_BIN; bin <= VBATCHED_MAX_BIN; bin *= 2)
+    {
+        rocblas_int lo = (bin == VBATCHED_MIN_BIN) ? 0 : bin / 2;
+        rocblas_int hi = (bin == VBATCHED_MAX_BIN) ? INT_MAX : bin;
+
+        ROCSOLVER_LAUNCH_KERNEL((getrs_vbatched_kernel<T, U>), grid, dim3(bin, 1, 1), 0, stream,
+                                trans, n, nrhs, A, lda, ipiv, strideP, B, ldb, lo, hi);
+    }
+
+    return rocblas_status_success;
+}
+
 ROCSOLVER_END_NAMESPACE
@@ -0,0 +1,269 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "roclapack_getrf_lowprec.hpp"
+#include "roclapack_getrs.hpp"
+#include "rocsolver/rocsolver.h"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/** GETRS_LOWPREC_SMALL_KERNEL solves the systems A*X = B or A^T*X = B using the LU factors of the
+    n-by-n matrices A, with n <= DIM. Each thread-block processes one problem in LDS with single
+    precision arithmetic, DIM right-hand sides at a time; thread c solves for column c. **/
+template <int DIM, typename T>
+ROCSOLVER_KERNEL void __launch_bounds__(DIM)
+    getrs_lowprec_small_kernel(const rocblas_operation trans,
+                               const rocblas_int n,
+                               const rocblas_int nrhs,
+                               T* A,
+                               const rocblas_int lda,
+                               const rocblas_stride strideA,
+                               const rocblas_int* ipiv,
+                               const rocblas_stride strideP,
+                               T* B,
+                               const rocblas_int ldb,
+                               const rocblas_stride strideB)
+{
+    // the leading dimension in LDS is padded to avoid bank conflicts when each thread works on
+    // a different column
+    constexpr rocblas_int lds = DIM + 1;
+
+    const rocblas_int b = hipBlockIdx_x;
+    const rocblas_int tid = hipThreadIdx_x;
+
+    T* Ap = A + b * strideA;
+    T* Bp = B + b * strideB;
+    const rocblas_int* ipivp = ipiv + b * strideP;
+
+    __shared__ float sA[lds * DIM];
+    __shared__ float sB[lds * DIM];
+    __shared__ rocblas_int sP[DIM];
+
+    // read the factors in single precision
+    if(tid < n)
+    {
+        for(rocblas_int j = 0; j < n; j++)
+            sA[tid + j * lds] = lowprec_to_float(Ap[tid + j * lda]);
+        sP[tid] = ipivp[tid] - 1;
+    }
+    __syncthreads();
+
+    for(rocblas_int c0 = 0; c0 < nrhs; c0 += DIM)
+    {
+        const rocblas_int nb = std::min(DIM, nrhs - c0);
+
+        // read the next block of right-hand sides
+        if(tid < n)
+        {
+            for(rocblas_int c = 0; c < nb; c++)
+                sB[tid + c * lds] = lowprec_to_float(Bp[tid + (c0 + c) * ldb]);
+        }
+        __syncthreads();
+
+        if(tid < nb)
+        {
+            float* x = sB + tid * lds;
+            float temp;
+
+            if(trans == rocblas_operation_none)
+            {
+                // apply the row interchanges
+                for(rocblas_int i = 0; i < n; i++)
+                {
+                    rocblas_int p = sP[i];
+                    if(p != i)
+                    {
+                        temp = x[i];
+                        x[i] = x[p];
+                        x[p] = temp;
+                    }
+                }
+
+                // solve L*y = P*b
+                for(rocblas_int j = 0; j < n; j++)
+                {
+                    temp = x[j];
+                    for(rocblas_int i = j + 1; i < n; i++)
+                        x[i] -= sA[i + j * lds] * temp;
+                }
+
+                // solve U*x = y
+                for(rocblas_int j = n - 1; j >= 0; j--)
+                {
+                    x[j] /= sA[j + j * lds];
+                    temp = x[j];
+                    for(rocblas_int i = 0; i < j; i++)
+                        x[i] -= sA[i + j * lds] * temp;
+                }
+            }
+            else
+            {
+                // solve U^T*y = b
+                for(rocblas_int i = 0; i < n; i++)
+                {
+                    temp = x[i];
+                    for(rocblas_int j = 0; j < i; j++)
+                        temp -= sA[j + i * lds] * x[j];
+                    x[i] = temp / sA[i + i * lds];
+                }
+
+                // solve L^T*z = y
+                for(rocblas_int i = n - 1; i >= 0; i--)
+                {
+                    temp = x[i];
+                    for(rocblas_int j = i + 1; j < n; j++)
+                        temp -= sA[j + i * lds] * x[j];
+                    x[i] = temp;
+                }
+
+                // apply the row interchanges in reverse order
+                for(rocblas_int i = n - 1; i >= 0; i--)
+                {
+                    rocblas_int p = sP[i];
+                    if(p != i)
+                    {
+                        temp = x[i];
+                        x[i] = x[p];
+                        x[p] = temp;
+                    }
+                }
+            }
+        }
+        __syncthreads();
+
+        // write the solutions back in the storage precision
+        if(tid < n)
+        {
+            for(rocblas_int c = 0; c < nb; c++)
+                Bp[tid + (c0 + c) * ldb] = lowprec_from_float<T>(sB[tid + c * lds]);
+        }
+        __syncthreads();
+    }
+}
+
+/** Return the sizes of the different workspace arrays **/
+template <typename T>
+void rocsolver_getrs_lowprec_getMemorySize(const rocblas_operation trans,
+                                           const rocblas_int n,
+                                           const rocblas_int nrhs,
+                                           const rocblas_int batch_count,
+                                           size_t* size_work1,
+                                           size_t* size_work2,
+                                           size_t* size_work3,
+                                           size_t* size_work4,
+                                           size_t* size_Awork,
+                                           size_t* size_Bwork,
+                                           bool* optim_mem)
+{
+    // if quick return, or if the small kernel is used, no workspace is needed
+    if(n == 0 || nrhs == 0 || batch_count == 0 || n <= LOWPREC_MAX_SMALL_SIZE)
+    {
+        *size_work1 = 0;
+        *size_work2 = 0;
+        *size_work3 = 0;
+        *size_work4 = 0;
+        *size_Awork = 0;
+        *size_Bwork = 0;
+        *optim_mem = true;
+        return;
+    }
+
+    // requirements for calling GETRS in single precision
+    rocsolver_getrs_getMemorySize<false, true, float>(trans, n, nrhs, batch_count, size_work1,
+                                                      size_work2, size_work3, size_work4,
+                                                      optim_mem, n, n);
+
+    // size of the single precision copies of A and B
+    *size_Awork = sizeof(float) * n * n * batch_count;
+    *size_Bwork = sizeof(float) * n * nrhs * batch_count;
+}
+
+template <typename T>
+rocblas_status rocsolver_getrs_lowprec_template(rocblas_handle handle,
+                                                const rocblas_operation trans,
+                                                const rocblas_int n,
+                                                const rocblas_int nrhs,
+                                                T* A,
+                                                const rocblas_int lda,
+                                                const rocblas_stride strideA,
+                                                const rocblas_int* ipiv,
+                                                const rocblas_stride strideP,
+                                                T* B,
+                                                const rocblas_int ldb,
+                                                const rocblas_stride strideB,
+                                                const rocblas_int batch_count,
+                                                void* work1,
+                                                void* work2,
+                                                void* work3,
+                                                void* work4,
+                                                float* Awork,
+                                                float* Bwork,
+                                                const bool optim_mem)
+{
+    ROCSOLVER_ENTER("getrs_lowprec", "trans:", trans, "n:", n, "nrhs:", nrhs, "lda:", lda,
+                    "ldb:", ldb, "bc:", batch_count);
+
+    // quick return
+    if(n == 0 || nrhs == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // small systems are solved in LDS by a single kernel
+    if(n <= LOWPREC_MAX_SMALL_SIZE)
+    {
+        ROCSOLVER_LAUNCH_KERNEL((getrs_lowprec_small_kernel<LOWPREC_MAX_SMALL_SIZE, T>),
+                                dim3(batch_count, 1, 1), dim3(LOWPREC_MAX_SMALL_SIZE, 1, 1), 0,
+                                stream, trans, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb,
+                                strideB);
+        return rocblas_status_success;
+    }
+
+    // otherwise, solve with single precision copies of the matrices
+    rocblas_stride strideWA = rocblas_stride(n) * n;
+    rocblas_stride strideWB = rocblas_stride(n) * nrhs;
+    lowprec_run_copy(stream, rocblas_fill_full, n, n, A, lda, strideA, Awork, n, strideWA,
+                     batch_count);
+    lowprec_run_copy(stream, rocblas_fill_full, n, nrhs, B, ldb, strideB, Bwork, n, strideWB,
+                     batch_count);
+
+    rocsolver_getrs_template<false, true, float>(handle, trans, n, nrhs, Awork, 0, 1, n, strideWA,
+                                                 ipiv, strideP, Bwork, 0, 1, n, strideWB,
+                                                 batch_count, work1, work2, work3, work4,
+                                                 optim_mem, true);
+
+    lowprec_run_copy(stream, rocblas_fill_full, n, nrhs, Bwork, n, strideWB, B, ldb, strideB,
+                     batch_count);
+
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
@@ -0,0 +1,142 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "roclapack_getrs_lowprec.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+template <typename T>
+rocblas_status rocsolver_getrs_lowprec_strided_batched_impl(rocblas_handle handle,
+                                                            const rocblas_operation trans,
+                                                            const rocblas_int n,
+                                                            const rocblas_int nrhs,
+                                                            T* A,
+                                                            const rocblas_int lda,
+                                                            const rocblas_stride strideA,
+                                                            const rocblas_int* ipiv,
+                                                            const rocblas_stride strideP,
+                                                            T* B,
+                                                            const rocblas_int ldb,
+                                                            const rocblas_stride strideB,
+                                                            const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER_TOP("getrs_lowprec_strided_batched", "--trans", trans, "-n", n, "--nrhs", nrhs,
+                        "--lda", lda, "--strideA", strideA, "--strideP", strideP, "--ldb", ldb,
+                        "--strideB", strideB, "--batch_count", batch_count);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st
+        = rocsolver_getrs_argCheck(handle, trans, n, nrhs, lda, ldb, A, B, ipiv, batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // memory workspace sizes:
+    // size of workspace (for calling TRSM)
+    bool optim_mem;
+    size_t size_work1, size_work2, size_work3, size_work4;
+    // size of the single precision copies of A and B
+    size_t size_Awork, size_Bwork;
+    rocsolver_getrs_lowprec_getMemorySize<T>(trans, n, nrhs, batch_count, &size_work1,
+                                             &size_work2, &size_work3, &size_work4, &size_Awork,
+                                             &size_Bwork, &optim_mem);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_work1, size_work2, size_work3,
+                                                      size_work4, size_Awork, size_Bwork);
+
+    // memory workspace allocation
+    void *work1, *work2, *work3, *work4, *Awork, *Bwork;
+    rocblas_device_malloc mem(handle, size_work1, size_work2, size_work3, size_work4, size_Awork,
+                              size_Bwork);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    work1 = mem[0];
+    work2 = mem[1];
+    work3 = mem[2];
+    work4 = mem[3];
+    Awork = mem[4];
+    Bwork = mem[5];
+
+    // execution
+    return rocsolver_getrs_lowprec_template<T>(handle, trans, n, nrhs, A, lda, strideA, ipiv,
+                                               strideP, B, ldb, strideB, batch_count, work1, work2,
+                                               work3, work4, (float*)Awork, (float*)Bwork,
+                                               optim_mem);
+}
+
+ROCSOLVER_END_NAMESPACE
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_hsgetrs_strided_batched(rocblas_handle handle,
+                                                 const rocblas_operation trans,
+                                                 const rocblas_int n,
+                                                 const rocblas_int nrhs,
+                                                 rocblas_half* A,
+                                                 const rocblas_int lda,
+                                                 const rocblas_stride strideA,
+                                                 const rocblas_int* ipiv,
+                                                 const rocblas_stride strideP,
+                                                 rocblas_half* B,
+                                                 const rocblas_int ldb,
+                                                 const rocblas_stride strideB,
+                                                 const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_getrs_lowprec_strided_batched_impl<rocblas_half>(
+        handle, trans, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, strideB, batch_count);
+}
+
+rocblas_status rocsolver_bsgetrs_strided_batched(rocblas_handle handle,
+                                                 const rocblas_operation trans,
+                                                 const rocblas_int n,
+                                                 const rocblas_int nrhs,
+                                                 rocblas_bfloat16* A,
+                                                 const rocblas_int lda,
+                                                 const rocblas_stride strideA,
+                                                 const rocblas_int* ipiv,
+                                                 const rocblas_stride strideP,
+                                                 rocblas_bfloat16* B,
+                                                 const rocblas_int ldb,
+                                                 const rocblas_stride strideB,
+                                                 const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_getrs_lowprec_strided_batched_impl<rocblas_bfloat16>(
+        handle, trans, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, strideB, batch_count);
+}
+
+} // extern C
@@ -26,6 +26,7 @@
  * *************************************************************************/
 
 #include "roclapack_getrs.hpp"
+#include "rocsolver_check_mode.hpp"
 
 ROCSOLVER_BEGIN_NAMESPACE
 
@@ -51,11 +52,17 @@ rocblas_status rocsolver_getrs_strided_batched_impl(rocblas_handle handle,
     if(!handle)
         return rocblas_status_invalid_handle;
 
-    // argument checking
-    rocblas_status st
-        = rocsolver_getrs_argCheck(handle, trans, n, nrhs, lda, ldb, A, B, ipiv, batch_count);
-    if(st != rocblas_status_continue)
-        return st;
+    // argument checking (unless disabled with rocsolver_set_check_mode)
+    if(!skip_arg_checks(handle))
+    {
+        rocblas_status st
+            = rocsolver_getrs_argCheck(handle, trans, n, nrhs, lda, ldb, A, B, ipiv, batch_count);
+        if(st != rocblas_status_continue)
+            return st;
+    }
+
+    // nominal flop count for the call statistics
+    rocsolver_stats_flops(batch_count * rocsolver_getrs_flops<T>(n, nrhs));
 
     // working with unshifted arrays
     rocblas_stride shiftA = 0;
@@ -65,13 +72,24 @@ rocblas_status rocsolver_getrs_strided_batched_impl(rocblas_handle handle,
     I inca = 1;
     I incb = 1;
 
+    // when all the problems share the same factorization, solve them as a single system with
+    // nrhs * batch_count right-hand sides
+    I ldbc;
+    const bool bcast = strideP == 0
+        && rhs_broadcast(n, nrhs, incb, ldb, strideA, strideB, batch_count, &ldbc);
+
     // memory workspace sizes:
     // size of workspace (for calling TRSM)
     bool optim_mem;
     size_t size_work1, size_work2, size_work3, size_work4;
-    rocsolver_getrs_getMemorySize<false, true, T>(trans, n, nrhs, batch_count, &size_work1,
-                                                  &size_work2, &size_work3, &size_work4, &optim_mem,
-                                                  lda, ldb);
+    if(bcast)
+        rocsolver_getrs_getMemorySize<false, false, T>(trans, n, nrhs * batch_count, I(1),
+                                                       &size_work1, &size_work2, &size_work3,
+                                                       &size_work4, &optim_mem, lda, ldbc);
+    else
+        rocsolver_getrs_getMemorySize<false, true, T>(trans, n, nrhs, batch_count, &size_work1,
+                                                      &size_work2, &size_work3, &size_work4,
+                                                      &optim_mem, lda, ldb);
 
     if(rocblas_is_device_memory_size_query(handle))
         return rocblas_set_optimal_device_memory_size(handle, size_work1, size_work2, size_work3,
@@ -90,6 +108,12 @@ rocblas_status rocsolver_getrs_strided_batched_impl(rocblas_handle handle,
     work4 = mem[3];
 
     // execution
+    if(bcast)
+        return rocsolver_getrs_template<false, false, T>(
+            handle, trans, n, nrhs * batch_count, A, shiftA, inca, lda, strideA, ipiv, strideP, B,
+            shiftB, incb, ldbc, rocblas_stride(0), I(1), work1, work2, work3, work4, optim_mem,
+            true);
+
     return rocsolver_getrs_template<false, true, T>(
         handle, trans, n, nrhs, A, shiftA, inca, lda, strideA, ipiv, strideP, B, shiftB, incb, ldb,
         strideB, batch_count, work1, work2, work3, work4, optim_mem, true);
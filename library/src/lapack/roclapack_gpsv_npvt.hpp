@@ -0,0 +1,237 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "rocsolver/rocsolver.h"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/** GPSV_NPVT_KERNEL solves one pentadiagonal system of the batch per thread by Gaussian
+    elimination without pivoting, working directly in global memory. It is meant for
+    interleaved batches (incd = incb = batch_count and strideD = strideB = 1), where the
+    element i of consecutive systems is contiguous in memory and all the accesses of a
+    wavefront are coalesced. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) gpsv_npvt_kernel(const rocblas_int n,
+                                                              const rocblas_int nrhs,
+                                                              U DSA,
+                                                              U DLA,
+                                                              U DA,
+                                                              U DUA,
+                                                              U DWA,
+                                                              const rocblas_stride shiftD,
+                                                              const rocblas_int incd,
+                                                              const rocblas_stride strideD,
+                                                              U BA,
+                                                              const rocblas_stride shiftB,
+                                                              const rocblas_int incb,
+                                                              const rocblas_int ldb,
+                                                              const rocblas_stride strideB,
+                                                              rocblas_int* infoA,
+                                                              const rocblas_int batch_count)
+{
+    rocblas_int b = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    if(b >= batch_count)
+        return;
+
+    T* DS = load_ptr_batch<T>(DSA, b, shiftD, strideD);
+    T* DL = load_ptr_batch<T>(DLA, b, shiftD, strideD);
+    T* D = load_ptr_batch<T>(DA, b, shiftD, strideD);
+    T* DU = load_ptr_batch<T>(DUA, b, shiftD, strideD);
+    T* DW = load_ptr_batch<T>(DWA, b, shiftD, strideD);
+    T* B = load_ptr_batch<T>(BA, b, shiftB, strideB);
+    const int64_t id = incd;
+    const int64_t ib = incb;
+    const int64_t lb = ldb;
+
+    // factorize A = L * U, where L is unit lower triangular with two sub-diagonals, and U is
+    // upper triangular with two super-diagonals. The multipliers overwrite DS and DL, the
+    // diagonal and first super-diagonal of U overwrite D and DU, and the second super-diagonal
+    // of U is DW. (gamma1, mu1 and gamma2, mu2 hold the entries of the previous two rows of U)
+    T gamma1 = D[0];
+    T mu1 = (n > 1) ? DU[0] : T(0);
+    T gamma2 = T(0), mu2 = T(0);
+    rocblas_int info = (gamma1 == T(0)) ? 1 : 0;
+    for(rocblas_int i = 1; i < n && info == 0; ++i)
+    {
+        T alpha = T(0), beta = DL[(i - 1) * id];
+        T gamma = D[i * id];
+        if(i > 1)
+        {
+            alpha = DS[(i - 2) * id] / gamma2;
+            beta -= alpha * mu2;
+            gamma -= alpha * DW[(i - 2) * id];
+            DS[(i - 2) * id] = alpha;
+        }
+        beta = beta / gamma1;
+        gamma -= beta * mu1;
+        DL[(i - 1) * id] = beta;
+        D[i * id] = gamma;
+
+        gamma2 = gamma1;
+        mu2 = mu1;
+        gamma1 = gamma;
+        if(i < n - 1)
+        {
+            mu1 = DU[i * id] - beta * DW[(i - 1) * id];
+            DU[i * id] = mu1;
+        }
+
+        if(gamma == T(0))
+            info = i + 1;
+    }
+
+    infoA[b] = info;
+    if(info != 0)
+        return;
+
+    // solve L * U * X = B
+    for(rocblas_int j = 0; j < nrhs; ++j)
+    {
+        T* x = B + j * lb;
+
+        // forward substitution
+        T y1 = x[0], y2 = T(0);
+        for(rocblas_int i = 1; i < n; ++i)
+        {
+            T y = x[i * ib] - DL[(i - 1) * id] * y1;
+            if(i > 1)
+                y -= DS[(i - 2) * id] * y2;
+            x[i * ib] = y;
+            y2 = y1;
+            y1 = y;
+        }
+
+        // backward substitution
+        y1 = y1 / D[(n - 1) * id];
+        x[(n - 1) * ib] = y1;
+        if(n > 1)
+        {
+            y2 = y1;
+            y1 = (x[(n - 2) * ib] - DU[(n - 2) * id] * y2) / D[(n - 2) * id];
+            x[(n - 2) * ib] = y1;
+        }
+        for(rocblas_int i = n - 3; i >= 0; --i)
+        {
+            const T y = (x[i * ib] - DU[i * id] * y1 - DW[i * id] * y2) / D[i * id];
+            x[i * ib] = y;
+            y2 = y1;
+            y1 = y;
+        }
+    }
+}
+
+template <typename T>
+rocblas_status rocsolver_gpsv_npvt_argCheck(rocblas_handle handle,
+                                            const rocblas_int n,
+                                            const rocblas_int nrhs,
+                                            const rocblas_int incd,
+                                            const rocblas_int incb,
+                                            const rocblas_int ldb,
+                                            T DS,
+                                            T DL,
+                                            T D,
+                                            T DU,
+                                            T DW,
+                                            T B,
+                                            rocblas_int* info,
+                                            const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    if(n < 0 || nrhs < 0 || batch_count < 0)
+        return rocblas_status_invalid_size;
+    if(incd < 1 || incb < 1 || ldb < incb * n)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n > 2 && !DS) || (n > 1 && !DL) || (n && !D) || (n > 1 && !DU) || (n > 2 && !DW)
+       || (n && nrhs && !B) || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T, typename U>
+rocblas_status rocsolver_gpsv_npvt_template(rocblas_handle handle,
+                                            const rocblas_int n,
+                                            const rocblas_int nrhs,
+                                            U DS,
+                                            U DL,
+                                            U D,
+                                            U DU,
+                                            U DW,
+                                            const rocblas_stride shiftD,
+                                            const rocblas_int incd,
+                                            const rocblas_stride strideD,
+                                            U B,
+                                            const rocblas_stride shiftB,
+                                            const rocblas_int incb,
+                                            const rocblas_int ldb,
+                                            const rocblas_stride strideB,
+                                            rocblas_int* info,
+                                            const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER("gpsv_npvt", "n:", n, "nrhs:", nrhs, "shiftD:", shiftD, "incd:", incd,
+                    "shiftB:", shiftB, "incb:", incb, "ldb:", ldb, "bc:", batch_count);
+
+    // quick return if zero instances in batch
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocks = (batch_count - 1) / BS1 + 1;
+    dim3 grid(blocks, 1, 1);
+    dim3 threads(BS1, 1, 1);
+
+    // quick return if no dimensions
+    if(n == 0)
+    {
+        ROCSOLVER_LAUNCH_KERNEL(reset_info, grid, threads, 0, stream, info, batch_count, 0);
+        return rocblas_status_success;
+    }
+
+    ROCSOLVER_LAUNCH_KERNEL((gpsv_npvt_kernel<T, U>), grid, threads, 0, stream, n, nrhs, DS, DL, D,
+                            DU, DW, shiftD, incd, strideD, B, shiftB, incb, ldb, strideB, info,
+                            batch_count);
+
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
@@ -0,0 +1,172 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "roclapack_gpsv_npvt.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+template <typename T, typename U>
+rocblas_status rocsolver_gpsv_npvt_interleaved_batched_impl(rocblas_handle handle,
+                                                            const rocblas_int n,
+                                                            const rocblas_int nrhs,
+                                                            U DS,
+                                                            U DL,
+                                                            U D,
+                                                            U DU,
+                                                            U DW,
+                                                            const rocblas_int incd,
+                                                            const rocblas_stride strideD,
+                                                            U B,
+                                                            const rocblas_int incb,
+                                                            const rocblas_int ldb,
+                                                            const rocblas_stride strideB,
+                                                            rocblas_int* info,
+                                                            const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER_TOP("gpsv_npvt_interleaved_batched", "-n", n, "--nrhs", nrhs, "--incd", incd,
+                        "--strideD", strideD, "--incb", incb, "--ldb", ldb, "--strideB", strideB,
+                        "--batch_count", batch_count);
+    ROCSOLVER_INFO_SUMMARY(info, batch_count);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_gpsv_npvt_argCheck(handle, n, nrhs, incd, incb, ldb, DS, DL, D,
+                                                     DU, DW, B, info, batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_stride shiftD = 0;
+    rocblas_stride shiftB = 0;
+
+    // this function does not require memory work space
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_size_unchanged;
+
+    // execution
+    return _info_summary_scope.commit(rocsolver_gpsv_npvt_template<T>(
+        handle, n, nrhs, DS, DL, D, DU, DW, shiftD, incd, strideD, B, shiftB, incb, ldb, strideB,
+        info, batch_count));
+}
+
+ROCSOLVER_END_NAMESPACE
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sgpsv_npvt_interleaved_batched(rocblas_handle handle,
+                                                        const rocblas_int n,
+                                                        const rocblas_int nrhs,
+                                                        float* DS,
+                                                        float* DL,
+                                                        float* D,
+                                                        float* DU,
+                                                        float* DW,
+                                                        const rocblas_int incd,
+                                                        const rocblas_stride strideD,
+                                                        float* B,
+                                                        const rocblas_int incb,
+                                                        const rocblas_int ldb,
+                                                        const rocblas_stride strideB,
+                                                        rocblas_int* info,
+                                                        const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_gpsv_npvt_interleaved_batched_impl<float>(handle, n, nrhs, DS, DL,
+        D, DU, DW, incd, strideD, B, incb, ldb, strideB, info, batch_count);
+}
+
+rocblas_status rocsolver_dgpsv_npvt_interleaved_batched(rocblas_handle handle,
+                                                        const rocblas_int n,
+                                                        const rocblas_int nrhs,
+                                                        double* DS,
+                                                        double* DL,
+                                                        double* D,
+                                                        double* DU,
+                                                        double* DW,
+                                                        const rocblas_int incd,
+                                                        const rocblas_stride strideD,
+                                                        double* B,
+                                                        const rocblas_int incb,
+                                                        const rocblas_int ldb,
+                                                        const rocblas_stride strideB,
+                                                        rocblas_int* info,
+                                                        const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_gpsv_npvt_interleaved_batched_impl<double>(handle, n, nrhs, DS, DL,
+        D, DU, DW, incd, strideD, B, incb, ldb, strideB, info, batch_count);
+}
+
+rocblas_status rocsolver_cgpsv_npvt_interleaved_batched(rocblas_handle handle,
+                                                        const rocblas_int n,
+                                                        const rocblas_int nrhs,
+                                                        rocblas_float_complex* DS,
+                                                        rocblas_float_complex* DL,
+                                                        rocblas_float_complex* D,
+                                                        rocblas_float_complex* DU,
+                                                        rocblas_float_complex* DW,
+                                                        const rocblas_int incd,
+                                                        const rocblas_stride strideD,
+                                                        rocblas_float_complex* B,
+                                                        const rocblas_int incb,
+                                                        const rocblas_int ldb,
+                                                        const rocblas_stride strideB,
+                                                        rocblas_int* info,
+                                                        const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_gpsv_npvt_interleaved_batched_impl<rocblas_float_complex>(handle, n,
+        nrhs, DS, DL, D, DU, DW, incd, strideD, B, incb, ldb, strideB, info, batch_count);
+}
+
+rocblas_status rocsolver_zgpsv_npvt_interleaved_batched(rocblas_handle handle,
+                                                        const rocblas_int n,
+                                                        const rocblas_int nrhs,
+                                                        rocblas_double_complex* DS,
+                                                        rocblas_double_complex* DL,
+                                                        rocblas_double_complex* D,
+                                                        rocblas_double_complex* DU,
+                                                        rocblas_double_complex* DW,
+                                                        const rocblas_int incd,
+                                                        const rocblas_stride strideD,
+                                                        rocblas_double_complex* B,
+                                                        const rocblas_int incb,
+                                                        const rocblas_int ldb,
+                                                        const rocblas_stride strideB,
+                                                        rocblas_int* info,
+                                                        const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_gpsv_npvt_interleaved_batched_impl<rocblas_double_complex>(handle,
+        n, nrhs, DS, DL, D, DU, DW, incd, strideD, B, incb, ldb, strideB, info, batch_count);
+}
+
+} // extern C
@@ -0,0 +1,194 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "rocsolver/rocsolver.h"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/** GTSV_NPVT_KERNEL solves one tridiagonal system of the batch per thread with the
+    Thomas algorithm (Gaussian elimination without pivoting), working directly in global
+    memory. It is meant for interleaved batches (incd = incb = batch_count and strideD =
+    strideB = 1), where the element i of consecutive systems is contiguous in memory and
+    all the accesses of a wavefront are coalesced. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) gtsv_npvt_kernel(const rocblas_int n,
+                                                              const rocblas_int nrhs,
+                                                              U DLA,
+                                                              U DA,
+                                                              U DUA,
+                                                              const rocblas_stride shiftD,
+                                                              const rocblas_int incd,
+                                                              const rocblas_stride strideD,
+                                                              U BA,
+                                                              const rocblas_stride shiftB,
+                                                              const rocblas_int incb,
+                                                              const rocblas_int ldb,
+                                                              const rocblas_stride strideB,
+                                                              rocblas_int* infoA,
+                                                              const rocblas_int batch_count)
+{
+    rocblas_int b = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    if(b >= batch_count)
+        return;
+
+    T* DL = load_ptr_batch<T>(DLA, b, shiftD, strideD);
+    T* D = load_ptr_batch<T>(DA, b, shiftD, strideD);
+    T* DU = load_ptr_batch<T>(DUA, b, shiftD, strideD);
+    T* B = load_ptr_batch<T>(BA, b, shiftB, strideB);
+    const int64_t id = incd;
+    const int64_t ib = incb;
+    const int64_t lb = ldb;
+
+    // factorize A = L * U, where L is unit lower bidiagonal and U is upper bidiagonal
+    // (the multipliers overwrite DL and the diagonal of U overwrites D)
+    T gamma = D[0];
+    rocblas_int info = (gamma == T(0)) ? 1 : 0;
+    for(rocblas_int i = 1; i < n && info == 0; ++i)
+    {
+        const T beta = DL[(i - 1) * id] / gamma;
+        gamma = D[i * id] - beta * DU[(i - 1) * id];
+        DL[(i - 1) * id] = beta;
+        D[i * id] = gamma;
+        if(gamma == T(0))
+            info = i + 1;
+    }
+
+    infoA[b] = info;
+    if(info != 0)
+        return;
+
+    // solve L * U * X = B
+    for(rocblas_int j = 0; j < nrhs; ++j)
+    {
+        T* x = B + j * lb;
+
+        // forward substitution
+        T y = x[0];
+        for(rocblas_int i = 1; i < n; ++i)
+        {
+            y = x[i * ib] - DL[(i - 1) * id] * y;
+            x[i * ib] = y;
+        }
+
+        // backward substitution
+        y = y / D[(n - 1) * id];
+        x[(n - 1) * ib] = y;
+        for(rocblas_int i = n - 2; i >= 0; --i)
+        {
+            y = (x[i * ib] - DU[i * id] * y) / D[i * id];
+            x[i * ib] = y;
+        }
+    }
+}
+
+template <typename T>
+rocblas_status rocsolver_gtsv_npvt_argCheck(rocblas_handle handle,
+                                            const rocblas_int n,
+                                            const rocblas_int nrhs,
+                                            const rocblas_int incd,
+                                            const rocblas_int incb,
+                                            const rocblas_int ldb,
+                                            T DL,
+                                            T D,
+                                            T DU,
+                                            T B,
+                                            rocblas_int* info,
+                                            const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    if(n < 0 || nrhs < 0 || batch_count < 0)
+        return rocblas_status_invalid_size;
+    if(incd < 1 || incb < 1 || ldb < incb * n)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n > 1 && !DL) || (n && !D) || (n > 1 && !DU) || (n && nrhs && !B)
+       || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T, typename U>
+rocblas_status rocsolver_gtsv_npvt_template(rocblas_handle handle,
+                                            const rocblas_int n,
+                                            const rocblas_int nrhs,
+                                            U DL,
+                                            U D,
+                                            U DU,
+                                            const rocblas_stride shiftD,
+                                            const rocblas_int incd,
+                                            const rocblas_stride strideD,
+                                            U B,
+                                            const rocblas_stride shiftB,
+                                            const rocblas_int incb,
+                                            const rocblas_int ldb,
+                                            const rocblas_stride strideB,
+                                            rocblas_int* info,
+                                            const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER("gtsv_npvt", "n:", n, "nrhs:", nrhs, "shiftD:", shiftD, "incd:", incd,
+                    "shiftB:", shiftB, "incb:", incb, "ldb:", ldb, "bc:", batch_count);
+
+    // quick return if zero instances in batch
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocks = (batch_count - 1) / BS1 + 1;
+    dim3 grid(blocks, 1, 1);
+    dim3 threads(BS1, 1, 1);
+
+    // quick return if no dimensions
+    if(n == 0)
+    {
+        ROCSOLVER_LAUNCH_KERNEL(reset_info, grid, threads, 0, stream, info, batch_count, 0);
+        return rocblas_status_success;
+    }
+
+    ROCSOLVER_LAUNCH_KERNEL((gtsv_npvt_kernel<T, U>), grid, threads, 0, stream, n, nrhs, DL, D, DU,
+                            shiftD, incd, strideD, B, shiftB, incb, ldb, strideB, info,
+                            batch_count);
+
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
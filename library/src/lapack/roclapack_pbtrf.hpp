@@ -0,0 +1,179 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "rocsolver/rocsolver.h"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/** PBTRF_KERNEL computes the Cholesky factorization of one banded matrix of the batch per
+    thread block, with the matrix in LAPACK band storage. The columns are processed in order,
+    and the update of the kd-by-kd trailing window at each step is shared by the threads of the
+    block. This keeps the whole factorization in a single kernel launch: for the usual
+    bandwidths, the windows are too small for the updates to pay off as separate BLAS calls. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) pbtrf_kernel(const rocblas_fill uplo,
+                                                          const rocblas_int n,
+                                                          const rocblas_int kd,
+                                                          U AA,
+                                                          const rocblas_stride shiftA,
+                                                          const rocblas_int lda,
+                                                          const rocblas_stride strideA,
+                                                          rocblas_int* info)
+{
+    using S = decltype(std::real(T{}));
+
+    const rocblas_int bid = hipBlockIdx_y;
+    const rocblas_int tid = hipThreadIdx_x;
+    const bool lower = (uplo == rocblas_fill_lower);
+
+    T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+    const int64_t ld = lda;
+
+    // position of the diagonal in the band storage
+    const rocblas_int dg = lower ? 0 : kd;
+
+    for(rocblas_int j = 0; j < n; ++j)
+    {
+        T* Aj = A + j * ld;
+        S ajj = std::real(Aj[dg]);
+
+        // all the threads read the same value, so they all leave together
+        if(ajj <= 0)
+        {
+            if(tid == 0)
+                info[bid] = j + 1;
+            return;
+        }
+
+        ajj = sqrt(ajj);
+        const rocblas_int kn = std::min(kd, n - 1 - j);
+        __syncthreads();
+
+        // compute column j of L (or row j of U)
+        if(tid == 0)
+            Aj[dg] = ajj;
+        for(rocblas_int t = tid; t < kn; t += BS1)
+        {
+            if(lower)
+                Aj[t + 1] /= ajj;
+            else
+                A[(dg - 1 - t) + (j + 1 + t) * ld] /= ajj;
+        }
+        __syncthreads();
+
+        // update the trailing window A(j+1:j+kn,j+1:j+kn)
+        for(rocblas_int idx = tid; idx < kn * kn; idx += BS1)
+        {
+            const rocblas_int r = idx % kn;
+            const rocblas_int c = idx / kn;
+            T* Ac = A + (j + 1 + c) * ld;
+
+            if(lower && r >= c)
+                Ac[r - c] -= Aj[1 + r] * conj(Aj[1 + c]);
+            else if(!lower && r <= c)
+                Ac[dg + r - c] -= conj(A[(dg - 1 - r) + (j + 1 + r) * ld])
+                    * A[(dg - 1 - c) + (j + 1 + c) * ld];
+        }
+        __syncthreads();
+    }
+
+    if(tid == 0)
+        info[bid] = 0;
+}
+
+template <typename T>
+rocblas_status rocsolver_pbtrf_argCheck(rocblas_handle handle,
+                                        const rocblas_fill uplo,
+                                        const rocblas_int n,
+                                        const rocblas_int kd,
+                                        const rocblas_int ldab,
+                                        T AB,
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(n < 0 || kd < 0 || ldab < kd + 1 || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !AB) || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T, typename U>
+rocblas_status rocsolver_pbtrf_template(rocblas_handle handle,
+                                        const rocblas_fill uplo,
+                                        const rocblas_int n,
+                                        const rocblas_int kd,
+                                        U AB,
+                                        const rocblas_stride shiftA,
+                                        const rocblas_int ldab,
+                                        const rocblas_stride strideA,
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER("pbtrf", "uplo:", uplo, "n:", n, "kd:", kd, "shiftA:", shiftA, "ldab:", ldab,
+                    "bc:", batch_count);
+
+    // quick return if zero instances in batch
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // quick return if no dimensions
+    if(n == 0)
+    {
+        rocblas_int blocks = (batch_count - 1) / BS1 + 1;
+        ROCSOLVER_LAUNCH_KERNEL(reset_info, dim3(blocks, 1, 1), dim3(BS1, 1, 1), 0, stream, info,
+                                batch_count, 0);
+        return rocblas_status_success;
+    }
+
+    ROCSOLVER_LAUNCH_KERNEL((pbtrf_kernel<T, U>), dim3(1, batch_count, 1), dim3(BS1, 1, 1), 0,
+                            stream, uplo, n, kd, AB, shiftA, ldab, strideA, info);
+
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
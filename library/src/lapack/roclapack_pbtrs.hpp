@@ -0,0 +1,168 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "rocsolver/rocsolver.h"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/** PBTRS_KERNEL solves L * L' * X = B (or U' * U * X = B) for one column of B per thread
+    block, where the Cholesky factor is stored in LAPACK band storage as returned by PBTRF.
+    At each step of the forward and backward substitutions, the solved element of X is used to
+    update the next (or previous) kd elements, shared by the threads of the block. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS2) pbtrs_kernel(const rocblas_fill uplo,
+                                                          const rocblas_int n,
+                                                          const rocblas_int kd,
+                                                          U AA,
+                                                          const rocblas_stride shiftA,
+                                                          const rocblas_int lda,
+                                                          const rocblas_stride strideA,
+                                                          U BB,
+                                                          const rocblas_stride shiftB,
+                                                          const rocblas_int ldb,
+                                                          const rocblas_stride strideB)
+{
+    const rocblas_int bid = hipBlockIdx_z;
+    const rocblas_int tid = hipThreadIdx_x;
+    const bool lower = (uplo == rocblas_fill_lower);
+
+    T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+    T* x = load_ptr_batch<T>(BB, bid, shiftB, strideB) + hipBlockIdx_x * int64_t(ldb);
+    const int64_t ld = lda;
+
+    // position of the diagonal in the band storage
+    const rocblas_int dg = lower ? 0 : kd;
+
+    // forward substitution with L (or U')
+    for(rocblas_int j = 0; j < n; ++j)
+    {
+        const T xj = x[j] / A[dg + j * ld];
+        const rocblas_int kn = std::min(kd, n - 1 - j);
+        __syncthreads();
+
+        if(tid == 0)
+            x[j] = xj;
+        for(rocblas_int t = tid; t < kn; t += BS2)
+        {
+            if(lower)
+                x[j + 1 + t] -= A[(t + 1) + j * ld] * xj;
+            else
+                x[j + 1 + t] -= conj(A[(dg - 1 - t) + (j + 1 + t) * ld]) * xj;
+        }
+        __syncthreads();
+    }
+
+    // backward substitution with L' (or U)
+    for(rocblas_int j = n - 1; j >= 0; --j)
+    {
+        const T xj = x[j] / A[dg + j * ld];
+        const rocblas_int kn = std::min(kd, j);
+        __syncthreads();
+
+        if(tid == 0)
+            x[j] = xj;
+        for(rocblas_int t = tid; t < kn; t += BS2)
+        {
+            if(lower)
+                x[j - 1 - t] -= conj(A[(t + 1) + (j - 1 - t) * ld]) * xj;
+            else
+                x[j - 1 - t] -= A[(dg - 1 - t) + j * ld] * xj;
+        }
+        __syncthreads();
+    }
+}
+
+template <typename T>
+rocblas_status rocsolver_pbtrs_argCheck(rocblas_handle handle,
+                                        const rocblas_fill uplo,
+                                        const rocblas_int n,
+                                        const rocblas_int kd,
+                                        const rocblas_int nrhs,
+                                        const rocblas_int ldab,
+                                        const rocblas_int ldb,
+                                        T AB,
+                                        T B,
+                                        const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(n < 0 || kd < 0 || nrhs < 0 || ldab < kd + 1 || ldb < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !AB) || (n && nrhs && !B))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T, typename U>
+rocblas_status rocsolver_pbtrs_template(rocblas_handle handle,
+                                        const rocblas_fill uplo,
+                                        const rocblas_int n,
+                                        const rocblas_int kd,
+                                        const rocblas_int nrhs,
+                                        U AB,
+                                        const rocblas_stride shiftA,
+                                        const rocblas_int ldab,
+                                        const rocblas_stride strideA,
+                                        U B,
+                                        const rocblas_stride shiftB,
+                                        const rocblas_int ldb,
+                                        const rocblas_stride strideB,
+                                        const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER("pbtrs", "uplo:", uplo, "n:", n, "kd:", kd, "nrhs:", nrhs, "shiftA:", shiftA,
+                    "ldab:", ldab, "shiftB:", shiftB, "ldb:", ldb, "bc:", batch_count);
+
+    // quick return
+    if(n == 0 || nrhs == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    ROCSOLVER_LAUNCH_KERNEL((pbtrs_kernel<T, U>), dim3(nrhs, 1, batch_count), dim3(BS2, 1, 1), 0,
+                            stream, uplo, n, kd, AB, shiftA, ldab, strideA, B, shiftB, ldb,
+                            strideB);
+
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
@@ -0,0 +1,237 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "auxiliary/rocauxiliary_trttf.hpp"
+#include "rocblas.hpp"
+#include "roclapack_potrf.hpp"
+#include "rocsolver/rocsolver.h"
+#include "rocsolver_run_specialized_kernels.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+template <bool BATCHED, bool STRIDED, typename T>
+void rocsolver_pftrf_getMemorySize(const rocblas_operation transr,
+                                   const rocblas_fill uplo,
+                                   const rocblas_int n,
+                                   const rocblas_int batch_count,
+                                   size_t* size_scalars,
+                                   size_t* size_work1,
+                                   size_t* size_work2,
+                                   size_t* size_work3,
+                                   size_t* size_work4,
+                                   size_t* size_pivots,
+                                   size_t* size_iinfo,
+                                   bool* optim_mem)
+{
+    // if quick return no need of workspace
+    if(n == 0 || batch_count == 0)
+    {
+        *size_scalars = 0;
+        *size_work1 = 0;
+        *size_work2 = 0;
+        *size_work3 = 0;
+        *size_work4 = 0;
+        *size_pivots = 0;
+        *size_iinfo = 0;
+        *optim_mem = true;
+        return;
+    }
+
+    rfp_layout L = rfp_get_layout(transr, uplo, n);
+    size_t s1, w1, w2, w3, w4, p, s2;
+    bool opt;
+
+    // requirements for calling POTRF on the diagonal blocks
+    rocsolver_potrf_getMemorySize<BATCHED, STRIDED, T>(L.n1, L.fill11, batch_count, size_scalars,
+                                                       size_work1, size_work2, size_work3,
+                                                       size_work4, size_pivots, size_iinfo,
+                                                       optim_mem);
+    rocsolver_potrf_getMemorySize<BATCHED, STRIDED, T>(L.n2, L.fill22, batch_count, &s1, &w1, &w2,
+                                                       &w3, &w4, &p, &s2, &opt);
+    *size_scalars = std::max(*size_scalars, s1);
+    *size_work1 = std::max(*size_work1, w1);
+    *size_work2 = std::max(*size_work2, w2);
+    *size_work3 = std::max(*size_work3, w3);
+    *size_work4 = std::max(*size_work4, w4);
+    *size_pivots = std::max(*size_pivots, p);
+    *size_iinfo = std::max(*size_iinfo, s2);
+    *optim_mem = *optim_mem && opt;
+
+    // extra requirements for calling TRSM on the off-diagonal block
+    if(L.n1 > 0 && L.n2 > 0)
+    {
+        if(L.below)
+            rocsolver_trsm_mem<BATCHED, STRIDED, T>(rocblas_side_right, rfp_op(L.fill11, true),
+                                                    L.n2, L.n1, batch_count, &w1, &w2, &w3, &w4,
+                                                    &opt);
+        else
+            rocsolver_trsm_mem<BATCHED, STRIDED, T>(rocblas_side_left, rfp_op(L.fill11, false),
+                                                    L.n1, L.n2, batch_count, &w1, &w2, &w3, &w4,
+                                                    &opt);
+        *size_work1 = std::max(*size_work1, w1);
+        *size_work2 = std::max(*size_work2, w2);
+        *size_work3 = std::max(*size_work3, w3);
+        *size_work4 = std::max(*size_work4, w4);
+        *optim_mem = *optim_mem && opt;
+    }
+}
+
+template <bool COMPLEX, typename T>
+rocblas_status rocsolver_pftrf_argCheck(rocblas_handle handle,
+                                        const rocblas_operation transr,
+                                        const rocblas_fill uplo,
+                                        const rocblas_int n,
+                                        T A,
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(transr != rocblas_operation_none && transr != rocblas_operation_transpose
+       && transr != rocblas_operation_conjugate_transpose)
+        return rocblas_status_invalid_value;
+    if((COMPLEX && transr == rocblas_operation_transpose)
+       || (!COMPLEX && transr == rocblas_operation_conjugate_transpose))
+        return rocblas_status_invalid_value;
+    if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(n < 0 || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !A) || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+/** PFTRF computes the Cholesky factorization of a matrix in RFP format. The diagonal blocks are
+    factorized with POTRF, and the off-diagonal block and the trailing diagonal block are updated
+    with TRSM and SYRK/HERK, all working directly on the blocks of the RFP array (see
+    rfp_layout). **/
+template <bool BATCHED, bool STRIDED, typename T, typename S, typename U>
+rocblas_status rocsolver_pftrf_template(rocblas_handle handle,
+                                        const rocblas_operation transr,
+                                        const rocblas_fill uplo,
+                                        const rocblas_int n,
+                                        U A,
+                                        const rocblas_stride shiftA,
+                                        const rocblas_stride strideA,
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count,
+                                        T* scalars,
+                                        void* work1,
+                                        void* work2,
+                                        void* work3,
+                                        void* work4,
+                                        T* pivots,
+                                        rocblas_int* iinfo,
+                                        bool optim_mem)
+{
+    ROCSOLVER_ENTER("pftrf", "transr:", transr, "uplo:", uplo, "n:", n, "shiftA:", shiftA,
+                    "bc:", batch_count);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // quick return
+    if(n == 0)
+    {
+        rocblas_int blocks = (batch_count - 1) / BS1 + 1;
+        ROCSOLVER_LAUNCH_KERNEL(reset_info, dim3(blocks, 1, 1), dim3(BS1, 1, 1), 0, stream, info,
+                                batch_count, 0);
+        return rocblas_status_success;
+    }
+
+    rfp_layout L = rfp_get_layout(transr, uplo, n);
+    const rocblas_stride shift11 = shiftA + L.shift11;
+    const rocblas_stride shift22 = shiftA + L.shift22;
+    const rocblas_stride shiftS = shiftA + L.shiftS;
+
+    // factorize the leading diagonal block (this also initializes info)
+    rocsolver_potrf_template<BATCHED, STRIDED, T, S>(
+        handle, L.fill11, L.n1, A, shift11, L.ld, strideA, info, batch_count, scalars, work1, work2,
+        work3, work4, pivots, iinfo, optim_mem);
+
+    if(L.n1 > 0 && L.n2 > 0)
+    {
+        // everything must be executed with scalars on the host
+        rocblas_pointer_mode old_mode;
+        rocblas_get_pointer_mode(handle, &old_mode);
+        rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+
+        // constants for rocblas functions calls
+        S s_one = 1;
+        S s_minone = -1;
+
+        // compute the off-diagonal block of the factor:
+        // L21 = A21 * inv(L11') or U12 = inv(U11') * A12
+        rocblas_side side = L.below ? rocblas_side_right : rocblas_side_left;
+        rocblas_operation trans = rfp_op(L.fill11, L.below);
+        rocblas_int m = L.below ? L.n2 : L.n1;
+        rocblas_int nn = L.below ? L.n1 : L.n2;
+        if(L.fill11 == rocblas_fill_lower)
+            rocsolver_trsm_lower<BATCHED, STRIDED, T>(
+                handle, side, trans, rocblas_diagonal_non_unit, m, nn, A, shift11, L.ld, strideA, A,
+                shiftS, L.ld, strideA, batch_count, optim_mem, work1, work2, work3, work4);
+        else
+            rocsolver_trsm_upper<BATCHED, STRIDED, T>(
+                handle, side, trans, rocblas_diagonal_non_unit, m, nn, A, shift11, L.ld, strideA, A,
+                shiftS, L.ld, strideA, batch_count, optim_mem, work1, work2, work3, work4);
+
+        // update the trailing diagonal block: A22 = A22 - L21 * L21' or A22 = A22 - U12' * U12
+        rocsolver_syrk_herk<BATCHED, STRIDED, T>(
+            handle, L.fill22,
+            L.below ? rocblas_operation_none : rocblas_operation_conjugate_transpose, L.n2, L.n1,
+            &s_minone, A, shiftS, L.ld, strideA, &s_one, A, shift22, L.ld, strideA, batch_count);
+
+        rocblas_set_pointer_mode(handle, old_mode);
+    }
+
+    // factorize the trailing diagonal block
+    // (info is only updated, with offset n1, if the leading block is positive definite)
+    rocsolver_potrf_template<BATCHED, STRIDED, T, S>(
+        handle, L.fill22, L.n2, A, shift22, L.ld, strideA, info, batch_count, scalars, work1, work2,
+        work3, work4, pivots, iinfo, optim_mem, L.n1);
+
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
@@ -0,0 +1,151 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "roclapack_pftri.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+template <typename T, typename U>
+rocblas_status rocsolver_pftri_impl(rocblas_handle handle,
+                                    const rocblas_operation transr,
+                                    const rocblas_fill uplo,
+                                    const rocblas_int n,
+                                    U A,
+                                    rocblas_int* info)
+{
+    ROCSOLVER_ENTER_TOP("pftri", "--transr", transr, "--uplo", uplo, "-n", n);
+    ROCSOLVER_INFO_SUMMARY(info, 1);
+
+    static constexpr bool COMPLEX = rocblas_is_complex<T>;
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_pftri_argCheck<COMPLEX>(handle, transr, uplo, n, A, info);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_stride shiftA = 0;
+
+    // normal (non-batched non-strided) execution
+    rocblas_stride strideA = 0;
+    rocblas_int batch_count = 1;
+
+    // memory workspace sizes:
+    // size of workspace (for calling TRTRI)
+    bool optim_mem;
+    size_t size_work1, size_work2, size_work3, size_work4, size_tmpcopy;
+    // size of arrays of pointers (for batched cases)
+    size_t size_workArr;
+    // size to store the singularities of the trailing diagonal block
+    size_t size_iinfo;
+    rocsolver_pftri_getMemorySize<false, false, T>(transr, uplo, n, batch_count, &size_work1,
+                                                   &size_work2, &size_work3, &size_work4,
+                                                   &size_tmpcopy, &size_workArr, &size_iinfo,
+                                                   &optim_mem);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_work1, size_work2, size_work3,
+                                                      size_work4, size_tmpcopy, size_workArr,
+                                                      size_iinfo);
+
+    // memory workspace allocation
+    void *work1, *work2, *work3, *work4, *tmpcopy, *workArr, *iinfo;
+    rocblas_device_malloc mem(handle, size_work1, size_work2, size_work3, size_work4, size_tmpcopy,
+                              size_workArr, size_iinfo);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    work1 = mem[0];
+    work2 = mem[1];
+    work3 = mem[2];
+    work4 = mem[3];
+    tmpcopy = mem[4];
+    workArr = mem[5];
+    iinfo = mem[6];
+
+    // execution
+    return _info_summary_scope.commit(rocsolver_pftri_template<false, false, T>(
+        handle, transr, uplo, n, A, shiftA, strideA, info, batch_count, work1, work2, work3, work4,
+        (T*)tmpcopy, (T**)workArr, (rocblas_int*)iinfo, optim_mem));
+}
+
+ROCSOLVER_END_NAMESPACE
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_spftri(rocblas_handle handle,
+                                const rocblas_operation transr,
+                                const rocblas_fill uplo,
+                                const rocblas_int n,
+                                float* A,
+                                rocblas_int* info)
+{
+    return rocsolver::rocsolver_pftri_impl<float>(handle, transr, uplo, n, A, info);
+}
+
+rocblas_status rocsolver_dpftri(rocblas_handle handle,
+                                const rocblas_operation transr,
+                                const rocblas_fill uplo,
+                                const rocblas_int n,
+                                double* A,
+                                rocblas_int* info)
+{
+    return rocsolver::rocsolver_pftri_impl<double>(handle, transr, uplo, n, A, info);
+}
+
+rocblas_status rocsolver_cpftri(rocblas_handle handle,
+                                const rocblas_operation transr,
+                                const rocblas_fill uplo,
+                                const rocblas_int n,
+                                rocblas_float_complex* A,
+                                rocblas_int* info)
+{
+    return rocsolver::rocsolver_pftri_impl<rocblas_float_complex>(handle, transr, uplo, n, A, info);
+}
+
+rocblas_status rocsolver_zpftri(rocblas_handle handle,
+                                const rocblas_operation transr,
+                                const rocblas_fill uplo,
+                                const rocblas_int n,
+                                rocblas_double_complex* A,
+                                rocblas_int* info)
+{
+    return rocsolver::rocsolver_pftri_impl<rocblas_double_complex>(handle, transr, uplo, n, A,
+                                                                   info);
+}
+
+} // extern C
@@ -0,0 +1,322 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "auxiliary/rocauxiliary_lauum.hpp"
+#include "auxiliary/rocauxiliary_trttf.hpp"
+#include "rocblas.hpp"
+#include "roclapack_trtri.hpp"
+#include "rocsolver/rocsolver.h"
+#include "rocsolver_run_specialized_kernels.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/** PFTRI_UPDATE_INFO keeps in info the first singularity found, with the singularities of the
+    trailing diagonal block (in iinfo) shifted by n1 **/
+ROCSOLVER_KERNEL void pftri_update_info(const rocblas_int batch_count,
+                                        const rocblas_int n1,
+                                        rocblas_int* info,
+                                        const rocblas_int* iinfo)
+{
+    const rocblas_int b = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(b < batch_count && info[b] == 0 && iinfo[b] != 0)
+        info[b] = iinfo[b] + n1;
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void rocsolver_pftri_getMemorySize(const rocblas_operation transr,
+                                   const rocblas_fill uplo,
+                                   const rocblas_int n,
+                                   const rocblas_int batch_count,
+                                   size_t* size_work1,
+                                   size_t* size_work2,
+                                   size_t* size_work3,
+                                   size_t* size_work4,
+                                   size_t* size_tmpcopy,
+                                   size_t* size_workArr,
+                                   size_t* size_iinfo,
+                                   bool* optim_mem)
+{
+    *size_work1 = 0;
+    *size_work2 = 0;
+    *size_work3 = 0;
+    *size_work4 = 0;
+    *size_tmpcopy = 0;
+    *size_workArr = 0;
+    *size_iinfo = 0;
+    *optim_mem = true;
+
+    // if quick return no need of workspace
+    if(n == 0 || batch_count == 0)
+        return;
+
+    rfp_layout L = rfp_get_layout(transr, uplo, n);
+    size_t w1, w2, w3, w4, t, a;
+    bool opt;
+    for(rocblas_int m : {L.n1, L.n2})
+    {
+        if(m == 0)
+            continue;
+
+        // requirements for calling TRTRI with the diagonal blocks
+        rocsolver_trtri_getMemorySize<BATCHED, STRIDED, T>(rocblas_diagonal_non_unit, m,
+                                                           batch_count, &w1, &w2, &w3, &w4, &t,
+                                                           &a, &opt);
+        *size_work1 = std::max(*size_work1, w1);
+        *size_work2 = std::max(*size_work2, w2);
+        *size_work3 = std::max(*size_work3, w3);
+        *size_work4 = std::max(*size_work4, w4);
+        *size_tmpcopy = std::max(*size_tmpcopy, t);
+        *size_workArr = std::max(*size_workArr, a);
+        *optim_mem = *optim_mem && opt;
+
+        // required space to copy the diagonal blocks
+        *size_tmpcopy = std::max(*size_tmpcopy, sizeof(T) * m * m * batch_count);
+
+        // requirements for the recursive product
+        if(m > LAUUM_RECURSIVE_SWITCHSIZE)
+        {
+            rocsolver_lauum_getMemorySize<T>(m, batch_count, &w1);
+            *size_work1 = std::max(*size_work1, w1);
+        }
+    }
+
+    // size to store the singularities of the trailing diagonal block
+    *size_iinfo = sizeof(rocblas_int) * batch_count;
+}
+
+template <bool COMPLEX, typename T>
+rocblas_status rocsolver_pftri_argCheck(rocblas_handle handle,
+                                        const rocblas_operation transr,
+                                        const rocblas_fill uplo,
+                                        const rocblas_int n,
+                                        T A,
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(transr != rocblas_operation_none && transr != rocblas_operation_transpose
+       && transr != rocblas_operation_conjugate_transpose)
+        return rocblas_status_invalid_value;
+    if((COMPLEX && transr == rocblas_operation_transpose)
+       || (!COMPLEX && transr == rocblas_operation_conjugate_transpose))
+        return rocblas_status_invalid_value;
+    if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(n < 0 || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !A) || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+/** PFTRI_LAUUM computes W' * W in the stored triangle of a diagonal block, given the triangle of
+    W (or W') stored with the given fill, as in POTRI. The product is computed in tmpcopy and only
+    copied back for the matrices with info = 0. **/
+template <typename T, typename U>
+void pftri_lauum(rocblas_handle handle,
+                 const rocblas_fill fill,
+                 const rocblas_int m,
+                 U A,
+                 const rocblas_stride shiftA,
+                 const rocblas_int lda,
+                 const rocblas_stride strideA,
+                 rocblas_int* info,
+                 const rocblas_int batch_count,
+                 void* work1,
+                 T* tmpcopy,
+                 T** workArr)
+{
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    const rocblas_int copyblocks = (m - 1) / 32 + 1;
+    T one = 1;
+
+    // copy elements of A to serve as B matrix for TRMM
+    ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, dim3(copyblocks, copyblocks, batch_count), dim3(32, 32), 0,
+                            stream, copymat_to_buffer, m, m, A, shiftA, lda, strideA, tmpcopy,
+                            no_mask{}, fill);
+
+    // compute inv(U) * inv(U)' or inv(L)' * inv(L) and store in tmpcopy
+    if(m > LAUUM_RECURSIVE_SWITCHSIZE)
+    {
+        lauum_recursive<false, T>(handle, fill, m, tmpcopy, 0, m, m * m, batch_count, (T*)work1);
+    }
+    else
+    {
+        rocblas_side side = (fill == rocblas_fill_upper ? rocblas_side_right : rocblas_side_left);
+        rocblasCall_trmm(handle, side, fill, rocblas_operation_conjugate_transpose,
+                         rocblas_diagonal_non_unit, m, m, &one, 0, A, shiftA, lda, strideA, tmpcopy,
+                         0, m, m * m, batch_count, workArr);
+    }
+
+    // copy elements of tmpcopy into A in cases where info is zero
+    ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, dim3(copyblocks, copyblocks, batch_count), dim3(32, 32), 0,
+                            stream, copymat_from_buffer, m, m, A, shiftA, lda, strideA, tmpcopy,
+                            info_mask(info, info_mask::negate), fill, rocblas_diagonal_non_unit);
+}
+
+/** PFTRI computes the inverse of A from its Cholesky factor in RFP format. Writing the factor as
+    A = C * C', with C = [C11 0; C21 C22] lower triangular and W = inv(C), the diagonal blocks of W
+    are computed with TRTRI and W21 = -W22 * C21 * W11 with TRMM; then inv(A) = W' * W is formed by
+    blocks with LAUUM, HERK and TRMM, working directly on the blocks of the RFP array (see
+    rfp_layout). **/
+template <bool BATCHED, bool STRIDED, typename T, typename U>
+rocblas_status rocsolver_pftri_template(rocblas_handle handle,
+                                        const rocblas_operation transr,
+                                        const rocblas_fill uplo,
+                                        const rocblas_int n,
+                                        U A,
+                                        const rocblas_stride shiftA,
+                                        const rocblas_stride strideA,
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count,
+                                        void* work1,
+                                        void* work2,
+                                        void* work3,
+                                        void* work4,
+                                        T* tmpcopy,
+                                        T** workArr,
+                                        rocblas_int* iinfo,
+                                        const bool optim_mem)
+{
+    ROCSOLVER_ENTER("pftri", "transr:", transr, "uplo:", uplo, "n:", n, "shiftA:", shiftA,
+                    "bc:", batch_count);
+
+    using S = decltype(std::real(T{}));
+
+    // quick return if zero instances in batch
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocks = (batch_count - 1) / 32 + 1;
+
+    // quick return if no dimensions
+    if(n == 0)
+    {
+        ROCSOLVER_LAUNCH_KERNEL(reset_info, dim3(blocks, 1, 1), dim3(32, 1, 1), 0, stream, info,
+                                batch_count, 0);
+        return rocblas_status_success;
+    }
+
+    rfp_layout L = rfp_get_layout(transr, uplo, n);
+    const rocblas_stride shift11 = shiftA + L.shift11;
+    const rocblas_stride shift22 = shiftA + L.shift22;
+    const rocblas_stride shiftS = shiftA + L.shiftS;
+
+    // compute the inverses of the diagonal blocks W11 and W22 (also check singularity and
+    // update info)
+    rocsolver_trtri_template<BATCHED, STRIDED, T>(
+        handle, L.fill11, rocblas_diagonal_non_unit, L.n1, A, shift11, L.ld, strideA, info,
+        batch_count, work1, work2, work3, work4, tmpcopy, workArr, optim_mem);
+    rocsolver_trtri_template<BATCHED, STRIDED, T>(
+        handle, L.fill22, rocblas_diagonal_non_unit, L.n2, A, shift22, L.ld, strideA, iinfo,
+        batch_count, work1, work2, work3, work4, tmpcopy, workArr, optim_mem);
+    ROCSOLVER_LAUNCH_KERNEL(pftri_update_info, dim3(blocks, 1, 1), dim3(32, 1, 1), 0, stream,
+                            batch_count, L.n1, info, iinfo);
+
+    // everything must be executed with scalars on the host
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+
+    // constants for rocblas functions calls
+    T one = 1;
+    T minone = -1;
+    S s_one = 1;
+
+    if(L.n1 > 0 && L.n2 > 0)
+    {
+        // compute the off-diagonal block W21 = -W22 * C21 * W11 (or its conjugate transpose)
+        if(L.below)
+        {
+            rocblasCall_trmm(handle, rocblas_side_right, L.fill11, rfp_op(L.fill11, false),
+                             rocblas_diagonal_non_unit, L.n2, L.n1, &minone, 0, A, shift11, L.ld,
+                             strideA, A, shiftS, L.ld, strideA, batch_count);
+            rocblasCall_trmm(handle, rocblas_side_left, L.fill22, rfp_op(L.fill22, false),
+                             rocblas_diagonal_non_unit, L.n2, L.n1, &one, 0, A, shift22, L.ld,
+                             strideA, A, shiftS, L.ld, strideA, batch_count);
+        }
+        else
+        {
+            rocblasCall_trmm(handle, rocblas_side_left, L.fill11, rfp_op(L.fill11, true),
+                             rocblas_diagonal_non_unit, L.n1, L.n2, &minone, 0, A, shift11, L.ld,
+                             strideA, A, shiftS, L.ld, strideA, batch_count);
+            rocblasCall_trmm(handle, rocblas_side_right, L.fill22, rfp_op(L.fill22, true),
+                             rocblas_diagonal_non_unit, L.n1, L.n2, &one, 0, A, shift22, L.ld,
+                             strideA, A, shiftS, L.ld, strideA, batch_count);
+        }
+    }
+
+    // leading diagonal block of inv(A): W11' * W11 + W21' * W21
+    pftri_lauum<T>(handle, L.fill11, L.n1, A, shift11, L.ld, strideA, info, batch_count, work1,
+                   tmpcopy, workArr);
+
+    if(L.n1 > 0 && L.n2 > 0)
+    {
+        rocsolver_syrk_herk<BATCHED, STRIDED, T>(
+            handle, L.fill11,
+            L.below ? rocblas_operation_conjugate_transpose : rocblas_operation_none, L.n1, L.n2,
+            &s_one, A, shiftS, L.ld, strideA, &s_one, A, shift11, L.ld, strideA, batch_count);
+
+        // off-diagonal block of inv(A): W22' * W21 (or its conjugate transpose)
+        if(L.below)
+            rocblasCall_trmm(handle, rocblas_side_left, L.fill22, rfp_op(L.fill22, true),
+                             rocblas_diagonal_non_unit, L.n2, L.n1, &one, 0, A, shift22, L.ld,
+                             strideA, A, shiftS, L.ld, strideA, batch_count);
+        else
+            rocblasCall_trmm(handle, rocblas_side_right, L.fill22, rfp_op(L.fill22, false),
+                             rocblas_diagonal_non_unit, L.n1, L.n2, &one, 0, A, shift22, L.ld,
+                             strideA, A, shiftS, L.ld, strideA, batch_count);
+    }
+
+    // trailing diagonal block of inv(A): W22' * W22
+    pftri_lauum<T>(handle, L.fill22, L.n2, A, shift22, L.ld, strideA, info, batch_count, work1,
+                   tmpcopy, workArr);
+
+    rocblas_set_pointer_mode(handle, old_mode);
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
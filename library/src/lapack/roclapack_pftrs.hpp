@@ -0,0 +1,242 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "auxiliary/rocauxiliary_trttf.hpp"
+#include "rocblas.hpp"
+#include "rocsolver/rocsolver.h"
+#include "rocsolver_run_specialized_kernels.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+template <bool COMPLEX, typename T>
+rocblas_status rocsolver_pftrs_argCheck(rocblas_handle handle,
+                                        const rocblas_operation transr,
+                                        const rocblas_fill uplo,
+                                        const rocblas_int n,
+                                        const rocblas_int nrhs,
+                                        const rocblas_int ldb,
+                                        T A,
+                                        T B,
+                                        const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(transr != rocblas_operation_none && transr != rocblas_operation_transpose
+       && transr != rocblas_operation_conjugate_transpose)
+        return rocblas_status_invalid_value;
+    if((COMPLEX && transr == rocblas_operation_transpose)
+       || (!COMPLEX && transr == rocblas_operation_conjugate_transpose))
+        return rocblas_status_invalid_value;
+    if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(n < 0 || nrhs < 0 || ldb < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !A) || (nrhs && n && !B))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void rocsolver_pftrs_getMemorySize(const rocblas_operation transr,
+                                   const rocblas_fill uplo,
+                                   const rocblas_int n,
+                                   const rocblas_int nrhs,
+                                   const rocblas_int batch_count,
+                                   size_t* size_work1,
+                                   size_t* size_work2,
+                                   size_t* size_work3,
+                                   size_t* size_work4,
+                                   bool* optim_mem)
+{
+    *size_work1 = 0;
+    *size_work2 = 0;
+    *size_work3 = 0;
+    *size_work4 = 0;
+    *optim_mem = true;
+
+    // if quick return, no workspace is needed
+    if(n == 0 || nrhs == 0 || batch_count == 0)
+        return;
+
+    // workspace required for calling TRSM with the diagonal blocks
+    // (call with both rocblas_operation_none and rocblas_operation_conjugate_transpose and take
+    // maximum memory)
+    rfp_layout L = rfp_get_layout(transr, uplo, n);
+    size_t w1, w2, w3, w4;
+    bool opt;
+    for(rocblas_int m : {L.n1, L.n2})
+    {
+        if(m == 0)
+            continue;
+
+        for(rocblas_operation trans :
+            {rocblas_operation_none, rocblas_operation_conjugate_transpose})
+        {
+            rocsolver_trsm_mem<BATCHED, STRIDED, T>(rocblas_side_left, trans, m, nrhs, batch_count,
+                                                    &w1, &w2, &w3, &w4, &opt);
+            *size_work1 = std::max(*size_work1, w1);
+            *size_work2 = std::max(*size_work2, w2);
+            *size_work3 = std::max(*size_work3, w3);
+            *size_work4 = std::max(*size_work4, w4);
+            *optim_mem = *optim_mem && opt;
+        }
+    }
+}
+
+/** PFTRS_TRSM solves with the lower triangular diagonal block C of the factorization A = C * C'
+    (if ctrans is false), or with C' (if ctrans is true), given the triangle stored with the given
+    fill in the RFP array. **/
+template <bool BATCHED, bool STRIDED, typename T, typename U>
+void pftrs_trsm(rocblas_handle handle,
+                const rocblas_fill fill,
+                const bool ctrans,
+                const rocblas_int m,
+                const rocblas_int nrhs,
+                U A,
+                const rocblas_stride shiftA,
+                const rocblas_int lda,
+                const rocblas_stride strideA,
+                U B,
+                const rocblas_stride shiftB,
+                const rocblas_int ldb,
+                const rocblas_stride strideB,
+                const rocblas_int batch_count,
+                void* work1,
+                void* work2,
+                void* work3,
+                void* work4,
+                bool optim_mem)
+{
+    if(m == 0)
+        return;
+
+    rocblas_operation trans = rfp_op(fill, ctrans);
+    if(fill == rocblas_fill_lower)
+        rocsolver_trsm_lower<BATCHED, STRIDED, T>(
+            handle, rocblas_side_left, trans, rocblas_diagonal_non_unit, m, nrhs, A, shiftA, lda,
+            strideA, B, shiftB, ldb, strideB, batch_count, optim_mem, work1, work2, work3, work4);
+    else
+        rocsolver_trsm_upper<BATCHED, STRIDED, T>(
+            handle, rocblas_side_left, trans, rocblas_diagonal_non_unit, m, nrhs, A, shiftA, lda,
+            strideA, B, shiftB, ldb, strideB, batch_count, optim_mem, work1, work2, work3, work4);
+}
+
+/** PFTRS solves A * X = B with the Cholesky factor of A in RFP format. Writing the factor as
+    A = C * C', with C = [C11 0; C21 C22] lower triangular, the system is solved by block
+    substitutions with the diagonal blocks (TRSM) and updates with the off-diagonal block (GEMM),
+    working directly on the blocks of the RFP array (see rfp_layout). **/
+template <bool BATCHED, bool STRIDED, typename T, typename U>
+rocblas_status rocsolver_pftrs_template(rocblas_handle handle,
+                                        const rocblas_operation transr,
+                                        const rocblas_fill uplo,
+                                        const rocblas_int n,
+                                        const rocblas_int nrhs,
+                                        U A,
+                                        const rocblas_stride shiftA,
+                                        const rocblas_stride strideA,
+                                        U B,
+                                        const rocblas_stride shiftB,
+                                        const rocblas_int ldb,
+                                        const rocblas_stride strideB,
+                                        const rocblas_int batch_count,
+                                        void* work1,
+                                        void* work2,
+                                        void* work3,
+                                        void* work4,
+                                        bool optim_mem)
+{
+    ROCSOLVER_ENTER("pftrs", "transr:", transr, "uplo:", uplo, "n:", n, "nrhs:", nrhs,
+                    "shiftA:", shiftA, "shiftB:", shiftB, "ldb:", ldb, "bc:", batch_count);
+
+    // quick return
+    if(n == 0 || nrhs == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    // everything must be executed with scalars on the host
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+
+    // constants for rocblas functions calls
+    T one = 1;
+    T minone = -1;
+
+    rfp_layout L = rfp_get_layout(transr, uplo, n);
+    const rocblas_stride shift11 = shiftA + L.shift11;
+    const rocblas_stride shift22 = shiftA + L.shift22;
+    const rocblas_stride shiftS = shiftA + L.shiftS;
+    const rocblas_stride shiftB2 = shiftB + L.n1;
+
+    // the off-diagonal block is C21 if stored below the diagonal, or C21' otherwise
+    rocblas_operation transS
+        = L.below ? rocblas_operation_none : rocblas_operation_conjugate_transpose;
+    rocblas_operation transSt
+        = L.below ? rocblas_operation_conjugate_transpose : rocblas_operation_none;
+
+    // solve C * Y = B
+    pftrs_trsm<BATCHED, STRIDED, T>(handle, L.fill11, false, L.n1, nrhs, A, shift11, L.ld, strideA,
+                                    B, shiftB, ldb, strideB, batch_count, work1, work2, work3,
+                                    work4, optim_mem);
+    if(L.n1 > 0 && L.n2 > 0)
+        rocsolver_gemm<BATCHED, STRIDED, T>(handle, transS, rocblas_operation_none, L.n2, nrhs,
+                                            L.n1, &minone, A, shiftS, L.ld, strideA, B, shiftB,
+                                            ldb, strideB, &one, B, shiftB2, ldb, strideB,
+                                            batch_count, (T**)nullptr);
+    pftrs_trsm<BATCHED, STRIDED, T>(handle, L.fill22, false, L.n2, nrhs, A, shift22, L.ld, strideA,
+                                    B, shiftB2, ldb, strideB, batch_count, work1, work2, work3,
+                                    work4, optim_mem);
+
+    // solve C' * X = Y
+    pftrs_trsm<BATCHED, STRIDED, T>(handle, L.fill22, true, L.n2, nrhs, A, shift22, L.ld, strideA,
+                                    B, shiftB2, ldb, strideB, batch_count, work1, work2, work3,
+                                    work4, optim_mem);
+    if(L.n1 > 0 && L.n2 > 0)
+        rocsolver_gemm<BATCHED, STRIDED, T>(handle, transSt, rocblas_operation_none, L.n1, nrhs,
+                                            L.n2, &minone, A, shiftS, L.ld, strideA, B, shiftB2,
+                                            ldb, strideB, &one, B, shiftB, ldb, strideB,
+                                            batch_count, (T**)nullptr);
+    pftrs_trsm<BATCHED, STRIDED, T>(handle, L.fill11, true, L.n1, nrhs, A, shift11, L.ld, strideA,
+                                    B, shiftB, ldb, strideB, batch_count, work1, work2, work3,
+                                    work4, optim_mem);
+
+    rocblas_set_pointer_mode(handle, old_mode);
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
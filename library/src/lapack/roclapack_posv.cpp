@@ -26,6 +26,7 @@
  * *************************************************************************/
 
 #include "roclapack_posv.hpp"
+#include "rocsolver_check_mode.hpp"
 
 ROCSOLVER_BEGIN_NAMESPACE
 
@@ -41,16 +42,20 @@ rocblas_status rocsolver_posv_impl(rocblas_handle handle,
                                    rocblas_int* info)
 {
     ROCSOLVER_ENTER_TOP("posv", "--uplo", uplo, "-n", n, "--nrhs", nrhs, "--lda", lda, "--ldb", ldb);
+    ROCSOLVER_INFO_SUMMARY(info, 1);
 
     using S = decltype(std::real(T{}));
 
     if(!handle)
         return rocblas_status_invalid_handle;
 
-    // argument checking
-    rocblas_status st = rocsolver_posv_argCheck(handle, uplo, n, nrhs, lda, ldb, A, B, info);
-    if(st != rocblas_status_continue)
-        return st;
+    // argument checking (unless disabled with rocsolver_set_check_mode)
+    if(!skip_arg_checks(handle))
+    {
+        rocblas_status st = rocsolver_posv_argCheck(handle, uplo, n, nrhs, lda, ldb, A, B, info);
+        if(st != rocblas_status_continue)
+            return st;
+    }
 
     // working with unshifted arrays
     rocblas_int shiftA = 0;
@@ -62,7 +67,7 @@ rocblas_status rocsolver_posv_impl(rocblas_handle handle,
     rocblas_int batch_count = 1;
 
     // memory workspace sizes:
-    // size for constants in rocblas calls
+    // constants in rocblas calls (only whether they are needed, see set_device_scalars)
     size_t size_scalars;
     // size of workspace (for calling POTRF and POTRS)
     bool optim_mem;
@@ -74,13 +79,13 @@ rocblas_status rocsolver_posv_impl(rocblas_handle handle,
                                                   &size_pivots_savedB, &size_iinfo, &optim_mem);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work1, size_work2,
+        return rocblas_set_optimal_device_memory_size(handle, size_t(0), size_work1, size_work2,
                                                       size_work3, size_work4, size_pivots_savedB,
                                                       size_iinfo);
 
     // memory workspace allocation
     void *scalars, *work1, *work2, *work3, *work4, *pivots_savedB, *iinfo;
-    rocblas_device_malloc mem(handle, size_scalars, size_work1, size_work2, size_work3, size_work4,
+    rocblas_device_malloc mem(handle, size_t(0), size_work1, size_work2, size_work3, size_work4,
                               size_pivots_savedB, size_iinfo);
 
     if(!mem)
@@ -94,12 +99,13 @@ rocblas_status rocsolver_posv_impl(rocblas_handle handle,
     pivots_savedB = mem[5];
     iinfo = mem[6];
     if(size_scalars > 0)
-        init_scalars(handle, (T*)scalars);
+        ROCBLAS_CHECK(set_device_scalars<T>(scalars));
 
     // execution
-    return rocsolver_posv_template<false, false, T, S>(
+    return _info_summary_scope.commit(rocsolver_posv_template<false, false, T, S>(
         handle, uplo, n, nrhs, A, shiftA, lda, strideA, B, shiftB, ldb, strideB, info, batch_count,
-        (T*)scalars, work1, work2, work3, work4, (T*)pivots_savedB, (rocblas_int*)iinfo, optim_mem);
+        (T*)scalars, work1, work2, work3, work4, (T*)pivots_savedB, (rocblas_int*)iinfo,
+        optim_mem));
 }
 
 ROCSOLVER_END_NAMESPACE
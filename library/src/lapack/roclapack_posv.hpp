@@ -35,6 +35,7 @@
 #include "roclapack_potrf.hpp"
 #include "roclapack_potrs.hpp"
 #include "rocsolver/rocsolver.h"
+#include "rocsolver_run_specialized_kernels.hpp"
 
 ROCSOLVER_BEGIN_NAMESPACE
 
@@ -99,6 +100,20 @@ void rocsolver_posv_getMemorySize(const rocblas_int n,
         return;
     }
 
+    // if small size, the fused kernel needs no workspace
+    if(n <= POSV_SMALL_MAX_SIZE)
+    {
+        *size_scalars = 0;
+        *size_work1 = 0;
+        *size_work2 = 0;
+        *size_work3 = 0;
+        *size_work4 = 0;
+        *size_pivots_savedB = 0;
+        *size_iinfo = 0;
+        *optim_mem = true;
+        return;
+    }
+
     bool opt1, opt2;
     size_t w1, w2, w3, w4;
 
@@ -166,6 +181,12 @@ rocblas_status rocsolver_posv_template(rocblas_handle handle,
     if(n == 0 || nrhs == 0)
         return rocblas_status_success;
 
+    // if small size, factorize and solve with a single kernel
+    // (info is set by the kernel, and B is not overwritten if A is not positive definite)
+    if(n <= POSV_SMALL_MAX_SIZE)
+        return posv_run_small<T>(handle, uplo, n, nrhs, A, shiftA, lda, strideA, B, shiftB, ldb,
+                                 strideB, info, batch_count);
+
     // constants in host memory
     const rocblas_int copyblocksx = (n - 1) / 32 + 1;
     const rocblas_int copyblocksy = (nrhs - 1) / 32 + 1;
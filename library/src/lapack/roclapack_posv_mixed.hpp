@@ -0,0 +1,365 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "roclapack_gesv_mixed.hpp"
+#include "roclapack_potrf.hpp"
+#include "roclapack_potrs.hpp"
+#include "rocsolver/rocsolver.h"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+template <typename T>
+rocblas_status rocsolver_posv_mixed_argCheck(rocblas_handle handle,
+                                             const rocblas_fill uplo,
+                                             const rocblas_int n,
+                                             const rocblas_int nrhs,
+                                             const rocblas_int lda,
+                                             const rocblas_int ldb,
+                                             const rocblas_int ldx,
+                                             T A,
+                                             T B,
+                                             T X,
+                                             const rocblas_int* iter,
+                                             const rocblas_int* info,
+                                             const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(n < 0 || nrhs < 0 || lda < n || ldb < n || ldx < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !A) || (nrhs * n && !B) || (nrhs * n && !X) || (batch_count && !iter)
+       || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void rocsolver_posv_mixed_getMemorySize(const rocblas_int n,
+                                        const rocblas_int nrhs,
+                                        const rocblas_fill uplo,
+                                        const rocblas_int batch_count,
+                                        size_t* size_scalars,
+                                        size_t* size_scalars_low,
+                                        size_t* size_work1,
+                                        size_t* size_work2,
+                                        size_t* size_work3,
+                                        size_t* size_work4,
+                                        size_t* size_pivots,
+                                        size_t* size_iinfo,
+                                        size_t* size_Alow,
+                                        size_t* size_Xlow,
+                                        size_t* size_R,
+                                        size_t* size_Rarr,
+                                        size_t* size_anorm,
+                                        size_t* size_state,
+                                        bool* optim_mem)
+{
+    using Tl = gesv_mixed_low_t<T>;
+    using S = decltype(std::real(T{}));
+
+    // if quick return, no workspace is needed
+    if(n == 0 || nrhs == 0 || batch_count == 0)
+    {
+        *size_scalars = 0;
+        *size_scalars_low = 0;
+        *size_work1 = 0;
+        *size_work2 = 0;
+        *size_work3 = 0;
+        *size_work4 = 0;
+        *size_pivots = 0;
+        *size_iinfo = 0;
+        *size_Alow = 0;
+        *size_Xlow = 0;
+        *size_R = 0;
+        *size_Rarr = 0;
+        *size_anorm = 0;
+        *size_state = 0;
+        *optim_mem = true;
+        return;
+    }
+
+    bool opt1, opt2, opt3, opt4;
+    size_t w1, w2, w3, w4, w5, w6;
+
+    // workspace required for calling POTRF and POTRS in full precision
+    // (for the problems that need to be solved again)
+    rocsolver_potrf_getMemorySize<BATCHED, STRIDED, T>(n, uplo, batch_count, size_scalars,
+                                                       size_work1, size_work2, size_work3,
+                                                       size_work4, size_pivots, size_iinfo, &opt1);
+
+    rocsolver_potrs_getMemorySize<BATCHED, STRIDED, T>(n, nrhs, batch_count, &w1, &w2, &w3, &w4,
+                                                       &opt2);
+
+    *size_work1 = std::max(*size_work1, w1);
+    *size_work2 = std::max(*size_work2, w2);
+    *size_work3 = std::max(*size_work3, w3);
+    *size_work4 = std::max(*size_work4, w4);
+
+    // workspace required for calling POTRF and POTRS in lower precision
+    // (the lower precision copies are always strided)
+    rocsolver_potrf_getMemorySize<false, true, Tl>(n, uplo, batch_count, size_scalars_low, &w1, &w2,
+                                                   &w3, &w4, &w5, &w6, &opt3);
+
+    *size_work1 = std::max(*size_work1, w1);
+    *size_work2 = std::max(*size_work2, w2);
+    *size_work3 = std::max(*size_work3, w3);
+    *size_work4 = std::max(*size_work4, w4);
+    *size_pivots = std::max(*size_pivots, w5);
+    *size_iinfo = std::max(*size_iinfo, w6);
+
+    rocsolver_potrs_getMemorySize<false, true, Tl>(n, nrhs, batch_count, &w1, &w2, &w3, &w4, &opt4);
+
+    *size_work1 = std::max(*size_work1, w1);
+    *size_work2 = std::max(*size_work2, w2);
+    *size_work3 = std::max(*size_work3, w3);
+    *size_work4 = std::max(*size_work4, w4);
+    *optim_mem = opt1 && opt2 && opt3 && opt4;
+
+    // lower precision copies of A and of the solution/correction
+    *size_Alow = sizeof(Tl) * n * n * batch_count;
+    *size_Xlow = sizeof(Tl) * n * nrhs * batch_count;
+
+    // residual in full precision
+    *size_R = sizeof(T) * n * nrhs * batch_count;
+    *size_Rarr = BATCHED ? sizeof(T*) * batch_count : 0;
+
+    // norms of A, status of each problem, info of the lower precision factorization,
+    // and counters of pending/failed problems
+    *size_anorm = sizeof(S) * batch_count;
+    *size_state = sizeof(rocblas_int) * (2 * batch_count + 2);
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename U>
+rocblas_status rocsolver_posv_mixed_template(rocblas_handle handle,
+                                             const rocblas_fill uplo,
+                                             const rocblas_int n,
+                                             const rocblas_int nrhs,
+                                             U A,
+                                             const rocblas_int shiftA,
+                                             const rocblas_int lda,
+                                             const rocblas_stride strideA,
+                                             U B,
+                                             const rocblas_int shiftB,
+                                             const rocblas_int ldb,
+                                             const rocblas_stride strideB,
+                                             U X,
+                                             const rocblas_int shiftX,
+                                             const rocblas_int ldx,
+                                             const rocblas_stride strideX,
+                                             rocblas_int* iter,
+                                             rocblas_int* info,
+                                             const rocblas_int batch_count,
+                                             T* scalars,
+                                             gesv_mixed_low_t<T>* scalars_low,
+                                             void* work1,
+                                             void* work2,
+                                             void* work3,
+                                             void* work4,
+                                             void* pivots,
+                                             rocblas_int* iinfo,
+                                             gesv_mixed_low_t<T>* Alow,
+                                             gesv_mixed_low_t<T>* Xlow,
+                                             T* Rbuf,
+                                             T** Rarr,
+                                             decltype(std::real(T{}))* anorm,
+                                             rocblas_int* state,
+                                             bool optim_mem)
+{
+    ROCSOLVER_ENTER("posv_mixed", "uplo:", uplo, "n:", n, "nrhs:", nrhs, "shiftA:", shiftA,
+                    "lda:", lda, "shiftB:", shiftB, "ldb:", ldb, "shiftX:", shiftX, "ldx:", ldx,
+                    "bc:", batch_count);
+
+    using Tl = gesv_mixed_low_t<T>;
+    using S = decltype(std::real(T{}));
+    using Sl = decltype(std::real(Tl{}));
+
+    // quick return if zero instances in batch
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocksReset = (batch_count - 1) / BS1 + 1;
+    dim3 gridReset(blocksReset, 1, 1);
+    dim3 threads(BS1, 1, 1);
+
+    // info=0 (starting with a positive definite matrix) and iter=0
+    ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, info, batch_count, 0);
+    ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, iter, batch_count, 0);
+
+    // quick return if A or B are empty
+    if(n == 0 || nrhs == 0)
+        return rocblas_status_success;
+
+    // everything must be executed with scalars on the host
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+    T one = 1;
+    T minone = -1;
+
+    // constants in host memory
+    const rocblas_int blocksx = (n - 1) / 32 + 1;
+    const rocblas_int blocksy = (nrhs - 1) / 32 + 1;
+    const dim3 gridA(blocksx, blocksx, batch_count);
+    const dim3 gridB(blocksx, blocksy, batch_count);
+    const dim3 threads2(32, 32, 1);
+    const dim3 gridBatch(1, batch_count, 1);
+    const rocblas_stride strideAl = rocblas_stride(n) * n;
+    const rocblas_stride strideXl = rocblas_stride(n) * nrhs;
+    const rocblas_stride strideR = rocblas_stride(n) * nrhs;
+    const S cte = get_epsilon<T>() * std::sqrt(S(n));
+
+    rocblas_int* linfo = state + batch_count;
+    rocblas_int* counters = state + 2 * batch_count;
+    info_mask refining(state, info_mask::negate);
+
+    // the iterative refinement needs to check for convergence on the host, and thus it is not
+    // used while the stream is being captured into a graph; in that case, the systems are
+    // solved directly in full precision (with iter = -1)
+    rocblas_int h_counters[2] = {0, 1};
+    if(stream_is_capturing(stream))
+        ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, iter, batch_count, -1);
+    else
+    {
+        // the residuals are accessed in the same way as the user matrices
+        U R;
+        if constexpr(BATCHED)
+        {
+            ROCSOLVER_LAUNCH_KERNEL(get_array, gridReset, threads, 0, stream, Rarr, Rbuf, strideR,
+                                    batch_count);
+            R = Rarr;
+        }
+        else
+            R = Rbuf;
+
+        // convert A and B to the lower precision, and compute the norms of A
+        // (only the triangular part of A given by uplo is referenced)
+        ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, state, batch_count,
+                                GESV_MIXED_REFINING);
+        ROCSOLVER_LAUNCH_KERNEL((gesv_mixed_demote<T, Tl>), gridA, threads2, 0, stream, uplo, n, n,
+                                A, shiftA, lda, strideA, Alow, n, strideAl, state);
+        ROCSOLVER_LAUNCH_KERNEL((gesv_mixed_demote<T, Tl>), gridB, threads2, 0, stream,
+                                rocblas_fill_full, n, nrhs, B, shiftB, ldb, strideB, Xlow, n,
+                                strideXl, state);
+        rocsolver_lange_lansy_template<T>(handle, rocsolver_norm_inf, uplo, n, n, A, shiftA, lda,
+                                          strideA, anorm, batch_count);
+
+        // compute the Cholesky factorization in lower precision and the first solution
+        rocsolver_potrf_template<false, true, Tl, Sl>(handle, uplo, n, Alow, 0, n, strideAl, linfo,
+                                                      batch_count, scalars_low, work1, work2, work3,
+                                                      work4, (Tl*)pivots, iinfo, optim_mem);
+        ROCSOLVER_LAUNCH_KERNEL(gesv_mixed_factor_check, gridReset, threads, 0, stream, batch_count,
+                                linfo, state);
+
+        rocsolver_potrs_template<false, true, Tl>(handle, uplo, n, nrhs, Alow, 0, n, strideAl, Xlow,
+                                                  0, n, strideXl, batch_count, work1, work2, work3,
+                                                  work4, optim_mem);
+        ROCSOLVER_LAUNCH_KERNEL((gesv_mixed_promote<false, T, Tl>), gridB, threads2, 0, stream, n,
+                                nrhs, Xlow, n, strideXl, X, shiftX, ldx, strideX);
+
+        // iterative refinement
+        for(rocblas_int iiter = 0;; iiter++)
+        {
+            if(iiter > 0)
+            {
+                // solve A * C = R in lower precision and update X = X + C
+                ROCSOLVER_LAUNCH_KERNEL((gesv_mixed_demote<T, Tl>), gridB, threads2, 0, stream,
+                                        rocblas_fill_full, n, nrhs, R, 0, n, strideR, Xlow, n,
+                                        strideXl, state, refining);
+                rocsolver_potrs_template<false, true, Tl>(handle, uplo, n, nrhs, Alow, 0, n,
+                                                          strideAl, Xlow, 0, n, strideXl,
+                                                          batch_count, work1, work2, work3, work4,
+                                                          optim_mem);
+                ROCSOLVER_LAUNCH_KERNEL((gesv_mixed_promote<true, T, Tl>), gridB, threads2, 0,
+                                        stream, n, nrhs, Xlow, n, strideXl, X, shiftX, ldx, strideX,
+                                        refining);
+            }
+
+            // compute the residuals R = B - A * X in full precision
+            ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, gridB, threads2, 0, stream, n, nrhs, B, shiftB,
+                                    ldb, strideB, R, 0, n, strideR);
+            rocblasCall_symm_hemm(handle, rocblas_side_left, uplo, n, nrhs, &minone, A, shiftA, lda,
+                                  strideA, X, shiftX, ldx, strideX, &one, R, 0, n, strideR,
+                                  batch_count);
+
+            // check convergence; the host needs to know whether all the problems are done
+            HIP_CHECK(hipMemsetAsync(counters, 0, sizeof(rocblas_int) * 2, stream));
+            ROCSOLVER_LAUNCH_KERNEL((gesv_mixed_check<BS1, T>), gridBatch, threads, 0, stream, n,
+                                    nrhs, X, shiftX, ldx, strideX, R, n, strideR, anorm, cte, iiter,
+                                    state, iter, counters);
+            HIP_CHECK(hipMemcpyAsync(h_counters, counters, sizeof(rocblas_int) * 2,
+                                     hipMemcpyDeviceToHost, stream));
+            rocsolver_stats_host_sync();
+            HIP_CHECK(hipStreamSynchronize(stream));
+
+            if(h_counters[0] == 0)
+                break;
+        }
+    }
+
+    // if the refinement failed for any problem (or was not used), solve the whole batch in
+    // full precision
+    if(h_counters[1] > 0)
+    {
+        rocsolver_potrf_template<BATCHED, STRIDED, T, S>(
+            handle, uplo, n, A, shiftA, lda, strideA, info, batch_count, scalars, work1, work2,
+            work3, work4, (T*)pivots, iinfo, optim_mem);
+
+        ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, gridB, threads2, 0, stream, n, nrhs, B, shiftB, ldb,
+                                strideB, X, shiftX, ldx, strideX);
+        rocsolver_potrs_template<BATCHED, STRIDED, T>(handle, uplo, n, nrhs, A, shiftA, lda,
+                                                      strideA, X, shiftX, ldx, strideX, batch_count,
+                                                      work1, work2, work3, work4, optim_mem);
+    }
+
+    rocblas_set_pointer_mode(handle, old_mode);
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
@@ -0,0 +1,174 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "roclapack_posv_mixed.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+template <typename T, typename U>
+rocblas_status rocsolver_posv_mixed_batched_impl(rocblas_handle handle,
+                                                 const rocblas_fill uplo,
+                                                 const rocblas_int n,
+                                                 const rocblas_int nrhs,
+                                                 U A,
+                                                 const rocblas_int lda,
+                                                 U B,
+                                                 const rocblas_int ldb,
+                                                 U X,
+                                                 const rocblas_int ldx,
+                                                 rocblas_int* iter,
+                                                 rocblas_int* info,
+                                                 const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER_TOP("posv_mixed_batched", "--uplo", uplo, "-n", n, "--nrhs", nrhs, "--lda", lda,
+                        "--ldb", ldb, "--ldx", ldx, "--batch_count", batch_count);
+    ROCSOLVER_INFO_SUMMARY(info, batch_count);
+
+    using Tl = gesv_mixed_low_t<T>;
+    using S = decltype(std::real(T{}));
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_posv_mixed_argCheck(handle, uplo, n, nrhs, lda, ldb, ldx, A, B, X,
+                                                      iter, info, batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+    rocblas_int shiftB = 0;
+    rocblas_int shiftX = 0;
+
+    // batched execution
+    rocblas_stride strideA = 0;
+    rocblas_stride strideB = 0;
+    rocblas_stride strideX = 0;
+
+    // memory workspace sizes:
+    // constants in rocblas calls, in full and lower precision (only whether they are needed,
+    // see set_device_scalars)
+    size_t size_scalars, size_scalars_low;
+    // size of reusable workspace for calling POTRF and POTRS
+    bool optim_mem;
+    size_t size_work1, size_work2, size_work3, size_work4;
+    // extra requirements for calling POTRF
+    size_t size_pivots, size_iinfo;
+    // size of the lower precision copies, the residuals and the convergence data
+    size_t size_Alow, size_Xlow, size_R, size_Rarr, size_anorm, size_state;
+    rocsolver_posv_mixed_getMemorySize<true, false, T>(
+        n, nrhs, uplo, batch_count, &size_scalars, &size_scalars_low, &size_work1, &size_work2,
+        &size_work3, &size_work4, &size_pivots, &size_iinfo, &size_Alow, &size_Xlow, &size_R,
+        &size_Rarr, &size_anorm, &size_state, &optim_mem);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(
+            handle, size_t(0), size_t(0), size_work1, size_work2, size_work3, size_work4,
+            size_pivots, size_iinfo, size_Alow, size_Xlow, size_R, size_Rarr, size_anorm,
+            size_state);
+
+    // memory workspace allocation
+    void *scalars, *scalars_low, *work1, *work2, *work3, *work4, *pivots, *iinfo, *Alow, *Xlow,
+        *R, *Rarr, *anorm, *state;
+    rocblas_device_malloc mem(handle, size_t(0), size_t(0), size_work1, size_work2,
+                              size_work3, size_work4, size_pivots, size_iinfo, size_Alow, size_Xlow,
+                              size_R, size_Rarr, size_anorm, size_state);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    scalars = mem[0];
+    scalars_low = mem[1];
+    work1 = mem[2];
+    work2 = mem[3];
+    work3 = mem[4];
+    work4 = mem[5];
+    pivots = mem[6];
+    iinfo = mem[7];
+    Alow = mem[8];
+    Xlow = mem[9];
+    R = mem[10];
+    Rarr = mem[11];
+    anorm = mem[12];
+    state = mem[13];
+    if(size_scalars > 0)
+        ROCBLAS_CHECK(set_device_scalars<T>(scalars));
+    if(size_scalars_low > 0)
+        ROCBLAS_CHECK(set_device_scalars<Tl>(scalars_low));
+
+    // execution
+    return _info_summary_scope.commit(rocsolver_posv_mixed_template<true, false, T>(
+        handle, uplo, n, nrhs, A, shiftA, lda, strideA, B, shiftB, ldb, strideB, X, shiftX, ldx,
+        strideX, iter, info, batch_count, (T*)scalars, (Tl*)scalars_low, work1, work2, work3, work4,
+        pivots, (rocblas_int*)iinfo, (Tl*)Alow, (Tl*)Xlow, (T*)R, (T**)Rarr, (S*)anorm,
+        (rocblas_int*)state, optim_mem));
+}
+
+ROCSOLVER_END_NAMESPACE
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocblas_status rocsolver_dsposv_batched(rocblas_handle handle,
+                                                   const rocblas_fill uplo,
+                                                   const rocblas_int n,
+                                                   const rocblas_int nrhs,
+                                                   double* const A[],
+                                                   const rocblas_int lda,
+                                                   double* const B[],
+                                                   const rocblas_int ldb,
+                                                   double* const X[],
+                                                   const rocblas_int ldx,
+                                                   rocblas_int* iter,
+                                                   rocblas_int* info,
+                                                   const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_posv_mixed_batched_impl<double>(
+        handle, uplo, n, nrhs, A, lda, B, ldb, X, ldx, iter, info, batch_count);
+}
+
+extern "C" rocblas_status rocsolver_zcposv_batched(rocblas_handle handle,
+                                                   const rocblas_fill uplo,
+                                                   const rocblas_int n,
+                                                   const rocblas_int nrhs,
+                                                   rocblas_double_complex* const A[],
+                                                   const rocblas_int lda,
+                                                   rocblas_double_complex* const B[],
+                                                   const rocblas_int ldb,
+                                                   rocblas_double_complex* const X[],
+                                                   const rocblas_int ldx,
+                                                   rocblas_int* iter,
+                                                   rocblas_int* info,
+                                                   const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_posv_mixed_batched_impl<rocblas_double_complex>(
+        handle, uplo, n, nrhs, A, lda, B, ldb, X, ldx, iter, info, batch_count);
+}
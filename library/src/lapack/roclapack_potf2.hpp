@@ -39,14 +39,14 @@
 
 ROCSOLVER_BEGIN_NAMESPACE
 
-template <typename T, typename U, std::enable_if_t<!rocblas_is_complex<T>, int> = 0>
+template <typename T, typename I, typename U, std::enable_if_t<!rocblas_is_complex<T>, int> = 0>
 ROCSOLVER_KERNEL void sqrtDiagOnward(U A,
-                                     const rocblas_int shiftA,
-                                     const rocblas_int strideA,
+                                     const rocblas_stride shiftA,
+                                     const rocblas_stride strideA,
                                      const size_t loc,
-                                     const rocblas_int j,
+                                     const I j,
                                      T* res,
-                                     rocblas_int* info)
+                                     I* info)
 {
     int id = hipBlockIdx_x;
 
@@ -70,14 +70,14 @@ ROCSOLVER_KERNEL void sqrtDiagOnward(U A,
     }
 }
 
-template <typename T, typename U, std::enable_if_t<rocblas_is_complex<T>, int> = 0>
+template <typename T, typename I, typename U, std::enable_if_t<rocblas_is_complex<T>, int> = 0>
 ROCSOLVER_KERNEL void sqrtDiagOnward(U A,
-                                     const rocblas_int shiftA,
-                                     const rocblas_int strideA,
+                                     const rocblas_stride shiftA,
+                                     const rocblas_stride strideA,
                                      const size_t loc,
-                                     const rocblas_int j,
+                                     const I j,
                                      T* res,
-                                     rocblas_int* info)
+                                     I* info)
 {
     int id = hipBlockIdx_x;
 
@@ -101,9 +101,9 @@ ROCSOLVER_KERNEL void sqrtDiagOnward(U A,
     }
 }
 
-template <typename T>
-void rocsolver_potf2_getMemorySize(const rocblas_int n,
-                                   const rocblas_int batch_count,
+template <typename T, typename I>
+void rocsolver_potf2_getMemorySize(const I n,
+                                   const I batch_count,
                                    size_t* size_scalars,
                                    size_t* size_work,
                                    size_t* size_pivots)
@@ -136,14 +136,15 @@ void rocsolver_potf2_getMemorySize(const rocblas_int n,
     *size_pivots = sizeof(T) * batch_count;
 }
 
-template <typename T>
+template <typename T, typename I>
 rocblas_status rocsolver_potf2_potrf_argCheck(rocblas_handle handle,
                                               const rocblas_fill uplo,
-                                              const rocblas_int n,
-                                              const rocblas_int lda,
+                                              const I n,
+                                              const I lda,
                                               T A,
-                                              rocblas_int* info,
-                                              const rocblas_int batch_count = 1)
+                                              I* info,
+                                              const I batch_count = 1,
+                                              const I inca = 1)
 {
     // order is important for unit tests:
 
@@ -152,7 +153,7 @@ rocblas_status rocsolver_potf2_potrf_argCheck(rocblas_handle handle,
         return rocblas_status_invalid_value;
 
     // 2. invalid size
-    if(n < 0 || lda < n || batch_count < 0)
+    if(n < 0 || inca < 1 || lda < inca * n || batch_count < 0)
         return rocblas_status_invalid_size;
 
     // skip pointer check if querying memory size
@@ -166,19 +167,20 @@ rocblas_status rocsolver_potf2_potrf_argCheck(rocblas_handle handle,
     return rocblas_status_continue;
 }
 
-template <typename T, typename U, bool COMPLEX = rocblas_is_complex<T>>
+template <typename T, typename I, typename U, bool COMPLEX = rocblas_is_complex<T>>
 rocblas_status rocsolver_potf2_template(rocblas_handle handle,
                                         const rocblas_fill uplo,
-                                        const rocblas_int n,
+                                        const I n,
                                         U A,
-                                        const rocblas_int shiftA,
-                                        const rocblas_int lda,
+                                        const rocblas_stride shiftA,
+                                        const I lda,
                                         const rocblas_stride strideA,
-                                        rocblas_int* info,
-                                        const rocblas_int batch_count,
+                                        I* info,
+                                        const I batch_count,
                                         T* scalars,
                                         T* work,
-                                        T* pivots)
+                                        T* pivots,
+                                        const I offset = 0)
 {
     ROCSOLVER_ENTER("potf2", "uplo:", uplo, "n:", n, "shiftA:", shiftA, "lda:", lda,
                     "bc:", batch_count);
@@ -190,12 +192,15 @@ rocblas_status rocsolver_potf2_template(rocblas_handle handle,
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
-    rocblas_int blocksReset = (batch_count - 1) / BS1 + 1;
+    I blocksReset = (batch_count - 1) / BS1 + 1;
     dim3 gridReset(blocksReset, 1, 1);
     dim3 threads(BS1, 1, 1);
 
     // info=0 (starting with a positive definite matrix)
-    ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, info, batch_count, 0);
+    // (when factorizing a diagonal block of a larger matrix, i.e. offset > 0, the first
+    // non-positive minor is added to the info of the former blocks)
+    if(offset == 0)
+        ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, info, batch_count, 0);
 
     // quick return if no dimensions
     if(n == 0)
@@ -211,7 +216,7 @@ rocblas_status rocsolver_potf2_template(rocblas_handle handle,
         // ----------------------
         // use specialized kernel
         // ----------------------
-        potf2_run_small<T>(handle, uplo, n, A, shiftA, lda, strideA, info, batch_count);
+        potf2_run_small<T>(handle, uplo, n, A, shiftA, lda, strideA, info, batch_count, offset);
     }
     else
     {
@@ -222,7 +227,7 @@ rocblas_status rocsolver_potf2_template(rocblas_handle handle,
         if(uplo == rocblas_fill_upper)
         {
             // Compute the Cholesky factorization A = U'*U.
-            for(rocblas_int j = 0; j < n; ++j)
+            for(I j = 0; j < n; ++j)
             {
                 // Compute U(J,J) and test for non-positive-definiteness.
                 rocblasCall_dot<COMPLEX, T>(handle, j, A, shiftA + idx2D(0, j, lda), 1, strideA, A,
@@ -230,7 +235,8 @@ rocblas_status rocsolver_potf2_template(rocblas_handle handle,
                                             pivots, work);
 
                 ROCSOLVER_LAUNCH_KERNEL(sqrtDiagOnward<T>, dim3(batch_count), dim3(1), 0, stream, A,
-                                        shiftA, strideA, idx2D(j, j, lda), j, pivots, info);
+                                        shiftA, strideA, idx2D(j, j, lda), j + offset, pivots,
+                                        info);
 
                 // Compute elements J+1:N of row J
                 if(j < n - 1)
@@ -257,7 +263,7 @@ rocblas_status rocsolver_potf2_template(rocblas_handle handle,
         else
         {
             // Compute the Cholesky factorization A = L'*L.
-            for(rocblas_int j = 0; j < n; ++j)
+            for(I j = 0; j < n; ++j)
             {
                 // Compute L(J,J) and test for non-positive-definiteness.
                 rocblasCall_dot<COMPLEX, T>(handle, j, A, shiftA + idx2D(j, 0, lda), lda, strideA,
@@ -265,7 +271,8 @@ rocblas_status rocsolver_potf2_template(rocblas_handle handle,
                                             pivots, work);
 
                 ROCSOLVER_LAUNCH_KERNEL(sqrtDiagOnward<T>, dim3(batch_count), dim3(1), 0, stream, A,
-                                        shiftA, strideA, idx2D(j, j, lda), j, pivots, info);
+                                        shiftA, strideA, idx2D(j, j, lda), j + offset, pivots,
+                                        info);
 
                 // Compute elements J+1:N of column J
                 if(j < n - 1)
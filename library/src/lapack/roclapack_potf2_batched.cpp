@@ -40,6 +40,7 @@ rocblas_status rocsolver_potf2_batched_impl(rocblas_handle handle,
 {
     ROCSOLVER_ENTER_TOP("potf2_batched", "--uplo", uplo, "-n", n, "--lda", lda, "--batch_count",
                         batch_count);
+    ROCSOLVER_INFO_SUMMARY(info, batch_count);
 
     if(!handle)
         return rocblas_status_invalid_handle;
@@ -56,7 +57,7 @@ rocblas_status rocsolver_potf2_batched_impl(rocblas_handle handle,
     rocblas_stride strideA = 0;
 
     // memory workspace sizes:
-    // size for constants in rocblas calls
+    // constants in rocblas calls (only whether they are needed, see set_device_scalars)
     size_t size_scalars;
     // size of reusable workspace
     size_t size_work;
@@ -65,11 +66,11 @@ rocblas_status rocsolver_potf2_batched_impl(rocblas_handle handle,
     rocsolver_potf2_getMemorySize<T>(n, batch_count, &size_scalars, &size_work, &size_pivots);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work, size_pivots);
+        return rocblas_set_optimal_device_memory_size(handle, size_t(0), size_work, size_pivots);
 
     // memory workspace allocation
     void *scalars, *work, *pivots;
-    rocblas_device_malloc mem(handle, size_scalars, size_work, size_pivots);
+    rocblas_device_malloc mem(handle, size_t(0), size_work, size_pivots);
 
     if(!mem)
         return rocblas_status_memory_error;
@@ -78,11 +79,12 @@ rocblas_status rocsolver_potf2_batched_impl(rocblas_handle handle,
     work = mem[1];
     pivots = mem[2];
     if(size_scalars > 0)
-        init_scalars(handle, (T*)scalars);
+        ROCBLAS_CHECK(set_device_scalars<T>(scalars));
 
     // execution
-    return rocsolver_potf2_template<T>(handle, uplo, n, A, shiftA, lda, strideA, info, batch_count,
-                                       (T*)scalars, (T*)work, (T*)pivots);
+    return _info_summary_scope.commit(rocsolver_potf2_template<T>(
+        handle, uplo, n, A, shiftA, lda, strideA, info, batch_count, (T*)scalars, (T*)work,
+        (T*)pivots));
 }
 
 ROCSOLVER_END_NAMESPACE
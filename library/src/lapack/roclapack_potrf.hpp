@@ -35,7 +35,10 @@
 #include "rocblas.hpp"
 #include "roclapack_potf2.hpp"
 #include "rocsolver/rocsolver.h"
+#include "rocsolver_batch_split.hpp"
+#include "rocsolver_prefetch.hpp"
 #include "rocsolver_run_specialized_kernels.hpp"
+#include "rocsolver_tuning.hpp"
 
 ROCSOLVER_BEGIN_NAMESPACE
 
@@ -60,20 +63,10 @@ static rocblas_int get_lds_size()
     return (lds_size);
 }
 
-template <typename U>
-ROCSOLVER_KERNEL void
-    chk_positive(rocblas_int* iinfo, rocblas_int* info, int j, rocblas_int batch_count)
-{
-    int id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
-
-    if(id < batch_count && info[id] == 0 && iinfo[id] > 0)
-        info[id] = iinfo[id] + j;
-}
-
-template <bool BATCHED, bool STRIDED, typename T>
-void rocsolver_potrf_getMemorySize(const rocblas_int n,
+template <bool BATCHED, bool STRIDED, typename T, typename I>
+void rocsolver_potrf_getMemorySize(const I n,
                                    const rocblas_fill uplo,
-                                   const rocblas_int batch_count,
+                                   const I batch_count,
                                    size_t* size_scalars,
                                    size_t* size_work1,
                                    size_t* size_work2,
@@ -97,7 +90,7 @@ void rocsolver_potrf_getMemorySize(const rocblas_int n,
         return;
     }
 
-    rocblas_int nb = POTRF_BLOCKSIZE(T);
+    I nb = POTRF_BLOCKSIZE(T);
     if(n <= POTRF_POTF2_SWITCHSIZE(T))
     {
         // requirements for calling a single POTF2
@@ -110,11 +103,11 @@ void rocsolver_potrf_getMemorySize(const rocblas_int n,
     }
     else
     {
-        rocblas_int jb = nb;
+        I jb = nb;
         size_t s1, s2;
 
-        // size to store info about positiveness of each subblock
-        *size_iinfo = sizeof(rocblas_int) * batch_count;
+        // (POTF2 reports the positiveness of each subblock directly in info)
+        *size_iinfo = 0;
 
         // requirements for calling POTF2 for the subblocks
         rocsolver_potf2_getMemorySize<T>(jb, batch_count, size_scalars, &s1, size_pivots);
@@ -134,67 +127,85 @@ void rocsolver_potrf_getMemorySize(const rocblas_int n,
         }
 
         *size_work1 = std::max(s1, s2);
+
+        // extra requirements for calling the TRSM of the recursive algorithm
+        // (the largest one is at the top level)
+        if(n > POTRF_RECURSIVE_SWITCHSIZE)
+        {
+            I n1 = std::max(nb, (n / 2) / nb * nb);
+            size_t w1, w2, w3, w4;
+            bool opt;
+            if(uplo == rocblas_fill_upper)
+                rocsolver_trsm_mem<BATCHED, STRIDED, T>(
+                    rocblas_side_left, rocblas_operation_conjugate_transpose, n1, n - n1,
+                    batch_count, &w1, &w2, &w3, &w4, &opt);
+            else
+                rocsolver_trsm_mem<BATCHED, STRIDED, T>(
+                    rocblas_side_right, rocblas_operation_conjugate_transpose, n - n1, n1,
+                    batch_count, &w1, &w2, &w3, &w4, &opt);
+
+            *size_work1 = std::max(*size_work1, w1);
+            *size_work2 = std::max(*size_work2, w2);
+            *size_work3 = std::max(*size_work3, w3);
+            *size_work4 = std::max(*size_work4, w4);
+            *optim_mem = *optim_mem && opt;
+        }
     }
 }
 
-template <bool BATCHED, bool STRIDED, typename T, typename S, typename U>
-rocblas_status rocsolver_potrf_template(rocblas_handle handle,
-                                        const rocblas_fill uplo,
-                                        const rocblas_int n,
-                                        U A,
-                                        const rocblas_int shiftA,
-                                        const rocblas_int lda,
-                                        const rocblas_stride strideA,
-                                        rocblas_int* info,
-                                        const rocblas_int batch_count,
-                                        T* scalars,
-                                        void* work1,
-                                        void* work2,
-                                        void* work3,
-                                        void* work4,
-                                        T* pivots,
-                                        rocblas_int* iinfo,
-                                        bool optim_mem)
+/** POTRF_USE_LEFT_LOOKING returns true if the blocked factorization of a batch
+    of matrices is left-looking. **/
+template <bool ISBATCHED, typename I>
+inline bool potrf_use_left_looking(const I batch_count)
 {
-    ROCSOLVER_ENTER("potrf", "uplo:", uplo, "n:", n, "shiftA:", shiftA, "lda:", lda,
-                    "bc:", batch_count);
-
-    // quick return
-    if(batch_count == 0)
-        return rocblas_status_success;
-
-    hipStream_t stream;
-    rocblas_get_stream(handle, &stream);
-
-    rocblas_int blocksReset = (batch_count - 1) / BS1 + 1;
-    dim3 gridReset(blocksReset, 1, 1);
-    dim3 threads(BS1, 1, 1);
-
-    // info=0 (starting with a positive definite matrix)
-    ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, info, batch_count, 0);
-
-    // quick return
-    if(n == 0)
-        return rocblas_status_success;
-
-    // everything must be executed with scalars on the host
-    rocblas_pointer_mode old_mode;
-    rocblas_get_pointer_mode(handle, &old_mode);
-    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+    return ISBATCHED && batch_count >= POTRF_LEFT_LOOKING_MIN_BATCH;
+}
 
-    // if the matrix is small, use the unblocked (BLAS-levelII) variant of the
-    // algorithm
-    rocblas_int nb = POTRF_BLOCKSIZE(T);
-    if(n <= POTRF_POTF2_SWITCHSIZE(T))
-        return rocsolver_potf2_template<T>(handle, uplo, n, A, shiftA, lda, strideA, info,
-                                           batch_count, scalars, (T*)work1, pivots);
+/** POTRF_BATCH_STREAMS returns the number of internal streams among which the
+    batched and strided-batched routines split the batch (tunable by the user,
+    defined in ideal_sizes.hpp) **/
+template <typename I>
+I potrf_batch_streams(const I n, const I batch_count)
+{
+    I size[] = {POTRF_BATCH_STREAMS};
+    I intervals[] = {POTRF_BATCH_STREAMS_INTERVALS};
+    I max = POTRF_BATCH_STREAMS_NUM_INTERVALS;
+    I k = get_tuned_blksize("potrf_batch_streams", size, intervals, max, n);
+    return rocsolver_batch_streams(k, batch_count);
+}
 
+/** This is the right-looking blocked factorization of the diagonal block of order n
+    that starts at the diagonal position offset of the matrix (A and shiftA point to
+    the diagonal block). At every step, the block column is factorized and the whole
+    trailing matrix is updated with a SYRK/HERK. **/
+template <bool BATCHED, bool STRIDED, typename T, typename S, typename I, typename U>
+rocblas_status potrf_rightLooking(rocblas_handle handle,
+                                  const rocblas_fill uplo,
+                                  const I n,
+                                  U A,
+                                  const rocblas_stride shiftA,
+                                  const I lda,
+                                  const rocblas_stride strideA,
+                                  I* info,
+                                  const I offset,
+                                  const I batch_count,
+                                  T* scalars,
+                                  void* work1,
+                                  void* work2,
+                                  void* work3,
+                                  void* work4,
+                                  T* pivots,
+                                  bool optim_mem,
+                                  managed_prefetch& prefetch)
+{
     // constants for rocblas functions calls
-    T t_one = 1;
     S s_one = 1;
     S s_minone = -1;
 
-    rocblas_int jb, j = 0;
+    I nb = POTRF_BLOCKSIZE(T);
+    I jb, j = 0;
+
+    prefetch.to_device(0, nb);
 
     // (TODO: When the matrix is detected to be non positive definite, we need to
     //  prevent TRSM and HERK to modify further the input matrix; ideally with no
@@ -206,14 +217,12 @@ rocblas_status rocsolver_potrf_template(rocblas_handle handle,
         while(j < n - POTRF_POTF2_SWITCHSIZE(T))
         {
             // Factor diagonal and subdiagonal blocks
+            // (test for non-positive-definiteness is done by POTF2)
             jb = std::min(n - j, nb); // number of columns in the block
-            ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, iinfo, batch_count, 0);
+            prefetch.to_device(j + jb, j + jb + nb);
             rocsolver_potf2_template<T>(handle, uplo, jb, A, shiftA + idx2D(j, j, lda), lda,
-                                        strideA, iinfo, batch_count, scalars, (T*)work1, pivots);
-
-            // test for non-positive-definiteness.
-            ROCSOLVER_LAUNCH_KERNEL(chk_positive<U>, gridReset, threads, 0, stream, iinfo, info, j,
-                                    batch_count);
+                                        strideA, info, batch_count, scalars, (T*)work1, pivots,
+                                        offset + j);
 
             if(j + jb < n)
             {
@@ -224,11 +233,14 @@ rocblas_status rocsolver_potrf_template(rocblas_handle handle,
                     strideA, A, shiftA + idx2D(j, j + jb, lda), lda, strideA, batch_count,
                     optim_mem, work1, work2, work3, work4);
 
-                rocblasCall_syrk_herk<BATCHED, T>(
+                rocsolver_syrk_herk<BATCHED, STRIDED, T>(
                     handle, uplo, rocblas_operation_conjugate_transpose, n - j - jb, jb, &s_minone,
                     A, shiftA + idx2D(j, j + jb, lda), lda, strideA, &s_one, A,
                     shiftA + idx2D(j + jb, j + jb, lda), lda, strideA, batch_count);
             }
+
+            // the block column is completed
+            prefetch.to_host(j, j + jb);
             j += nb;
         }
     }
@@ -238,14 +250,12 @@ rocblas_status rocsolver_potrf_template(rocblas_handle handle,
         while(j < n - POTRF_POTF2_SWITCHSIZE(T))
         {
             // Factor diagonal and subdiagonal blocks
+            // (test for non-positive-definiteness is done by POTF2)
             jb = std::min(n - j, nb); // number of columns in the block
-            ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, iinfo, batch_count, 0);
+            prefetch.to_device(j + jb, j + jb + nb);
             rocsolver_potf2_template<T>(handle, uplo, jb, A, shiftA + idx2D(j, j, lda), lda,
-                                        strideA, iinfo, batch_count, scalars, (T*)work1, pivots);
-
-            // test for non-positive-definiteness.
-            ROCSOLVER_LAUNCH_KERNEL(chk_positive<U>, gridReset, threads, 0, stream, iinfo, info, j,
-                                    batch_count);
+                                        strideA, info, batch_count, scalars, (T*)work1, pivots,
+                                        offset + j);
 
             if(j + jb < n)
             {
@@ -256,26 +266,575 @@ rocblas_status rocsolver_potrf_template(rocblas_handle handle,
                     strideA, A, shiftA + idx2D(j + jb, j, lda), lda, strideA, batch_count,
                     optim_mem, work1, work2, work3, work4);
 
-                rocblasCall_syrk_herk<BATCHED, T>(
+                rocsolver_syrk_herk<BATCHED, STRIDED, T>(
                     handle, uplo, rocblas_operation_none, n - j - jb, jb, &s_minone, A,
                     shiftA + idx2D(j + jb, j, lda), lda, strideA, &s_one, A,
                     shiftA + idx2D(j + jb, j + jb, lda), lda, strideA, batch_count);
             }
+
+            // the block column is completed
+            prefetch.to_host(j, j + jb);
             j += nb;
         }
     }
 
     // factor last block
     if(j < n)
-    {
         rocsolver_potf2_template<T>(handle, uplo, n - j, A, shiftA + idx2D(j, j, lda), lda, strideA,
-                                    iinfo, batch_count, scalars, (T*)work1, pivots);
-        ROCSOLVER_LAUNCH_KERNEL(chk_positive<U>, gridReset, threads, 0, stream, iinfo, info, j,
-                                batch_count);
+                                    info, batch_count, scalars, (T*)work1, pivots, offset + j);
+
+    return rocblas_status_success;
+}
+
+/** This is the left-looking blocked factorization of the diagonal block of order n
+    that starts at the diagonal position offset of the matrix (A and shiftA point to
+    the diagonal block). At every step, the block column is first updated with the
+    former block columns, and then factorized; so the trailing matrix is only read. **/
+template <bool BATCHED, bool STRIDED, typename T, typename S, typename I, typename U>
+rocblas_status potrf_leftLooking(rocblas_handle handle,
+                                 const rocblas_fill uplo,
+                                 const I n,
+                                 U A,
+                                 const rocblas_stride shiftA,
+                                 const I lda,
+                                 const rocblas_stride strideA,
+                                 I* info,
+                                 const I offset,
+                                 const I batch_count,
+                                 T* scalars,
+                                 void* work1,
+                                 void* work2,
+                                 void* work3,
+                                 void* work4,
+                                 T* pivots,
+                                 bool optim_mem)
+{
+    // constants for rocblas functions calls
+    T t_one = 1;
+    T t_minone = -1;
+    S s_one = 1;
+    S s_minone = -1;
+
+    I nb = POTRF_BLOCKSIZE(T);
+
+    for(I j = 0; j < n; j += nb)
+    {
+        I jb = std::min(n - j, nb); // number of columns in the block
+
+        if(uplo == rocblas_fill_upper)
+        {
+            // update the diagonal block and the block row to its right
+            if(j > 0)
+            {
+                rocsolver_syrk_herk<BATCHED, STRIDED, T>(
+                    handle, uplo, rocblas_operation_conjugate_transpose, jb, j, &s_minone, A,
+                    shiftA + idx2D(0, j, lda), lda, strideA, &s_one, A,
+                    shiftA + idx2D(j, j, lda), lda, strideA, batch_count);
+
+                if(j + jb < n)
+                    rocsolver_gemm<BATCHED, STRIDED, T>(
+                        handle, rocblas_operation_conjugate_transpose, rocblas_operation_none, jb,
+                        n - j - jb, j, &t_minone, A, shiftA + idx2D(0, j, lda), lda, strideA, A,
+                        shiftA + idx2D(0, j + jb, lda), lda, strideA, &t_one, A,
+                        shiftA + idx2D(j, j + jb, lda), lda, strideA, batch_count, (T**)nullptr);
+            }
+
+            // factor the diagonal block and solve for the block row
+            rocsolver_potf2_template<T>(handle, uplo, jb, A, shiftA + idx2D(j, j, lda), lda,
+                                        strideA, info, batch_count, scalars, (T*)work1, pivots,
+                                        offset + j);
+
+            if(j + jb < n)
+                rocsolver_trsm_upper<BATCHED, STRIDED, T>(
+                    handle, rocblas_side_left, rocblas_operation_conjugate_transpose,
+                    rocblas_diagonal_non_unit, jb, (n - j - jb), A, shiftA + idx2D(j, j, lda), lda,
+                    strideA, A, shiftA + idx2D(j, j + jb, lda), lda, strideA, batch_count,
+                    optim_mem, work1, work2, work3, work4);
+        }
+        else
+        {
+            // update the diagonal block and the panel below it
+            if(j > 0)
+            {
+                rocsolver_syrk_herk<BATCHED, STRIDED, T>(
+                    handle, uplo, rocblas_operation_none, jb, j, &s_minone, A,
+                    shiftA + idx2D(j, 0, lda), lda, strideA, &s_one, A,
+                    shiftA + idx2D(j, j, lda), lda, strideA, batch_count);
+
+                if(j + jb < n)
+                    rocsolver_gemm<BATCHED, STRIDED, T>(
+                        handle, rocblas_operation_none, rocblas_operation_conjugate_transpose,
+                        n - j - jb, jb, j, &t_minone, A, shiftA + idx2D(j + jb, 0, lda), lda,
+                        strideA, A, shiftA + idx2D(j, 0, lda), lda, strideA, &t_one, A,
+                        shiftA + idx2D(j + jb, j, lda), lda, strideA, batch_count, (T**)nullptr);
+            }
+
+            // factor the diagonal block and solve for the panel
+            rocsolver_potf2_template<T>(handle, uplo, jb, A, shiftA + idx2D(j, j, lda), lda,
+                                        strideA, info, batch_count, scalars, (T*)work1, pivots,
+                                        offset + j);
+
+            if(j + jb < n)
+                rocsolver_trsm_lower<BATCHED, STRIDED, T>(
+                    handle, rocblas_side_right, rocblas_operation_conjugate_transpose,
+                    rocblas_diagonal_non_unit, (n - j - jb), jb, A, shiftA + idx2D(j, j, lda), lda,
+                    strideA, A, shiftA + idx2D(j + jb, j, lda), lda, strideA, batch_count,
+                    optim_mem, work1, work2, work3, work4);
+        }
     }
 
+    return rocblas_status_success;
+}
+
+/** This is the recursive factorization of the diagonal block of order n that starts
+    at the diagonal position offset of the matrix (A and shiftA point to the diagonal
+    block). Blocks of at most POTRF_RECURSIVE_SWITCHSIZE columns are factorized with
+    the blocked algorithm. **/
+template <bool BATCHED, bool STRIDED, typename T, typename S, typename I, typename U>
+rocblas_status potrf_recursive(rocblas_handle handle,
+                               const rocblas_fill uplo,
+                               const I n,
+                               U A,
+                               const rocblas_stride shiftA,
+                               const I lda,
+                               const rocblas_stride strideA,
+                               I* info,
+                               const I offset,
+                               const I batch_count,
+                               T* scalars,
+                               void* work1,
+                               void* work2,
+                               void* work3,
+                               void* work4,
+                               T* pivots,
+                               bool optim_mem,
+                               managed_prefetch& prefetch)
+{
+    static constexpr bool ISBATCHED = BATCHED || STRIDED;
+
+    // factorize leaf block
+    if(n <= POTRF_RECURSIVE_SWITCHSIZE)
+    {
+        if(potrf_use_left_looking<ISBATCHED>(batch_count))
+            return potrf_leftLooking<BATCHED, STRIDED, T, S>(
+                handle, uplo, n, A, shiftA, lda, strideA, info, offset, batch_count, scalars,
+                work1, work2, work3, work4, pivots, optim_mem);
+        else
+            return potrf_rightLooking<BATCHED, STRIDED, T, S>(
+                handle, uplo, n, A, shiftA, lda, strideA, info, offset, batch_count, scalars,
+                work1, work2, work3, work4, pivots, optim_mem, prefetch);
+    }
+
+    // constants for rocblas functions calls
+    S s_one = 1;
+    S s_minone = -1;
+
+    // the leading half has a multiple of POTRF_BLOCKSIZE columns
+    I nb = POTRF_BLOCKSIZE(T);
+    I n1 = std::max(nb, (n / 2) / nb * nb);
+    I n2 = n - n1;
+
+    // factorize leading half
+    potrf_recursive<BATCHED, STRIDED, T, S>(handle, uplo, n1, A, shiftA, lda, strideA, info,
+                                            offset, batch_count, scalars, work1, work2, work3,
+                                            work4, pivots, optim_mem, prefetch);
+
+    // update off-diagonal block and trailing half
+    if(uplo == rocblas_fill_upper)
+    {
+        rocsolver_trsm_upper<BATCHED, STRIDED, T>(
+            handle, rocblas_side_left, rocblas_operation_conjugate_transpose,
+            rocblas_diagonal_non_unit, n1, n2, A, shiftA, lda, strideA, A,
+            shiftA + idx2D(0, n1, lda), lda, strideA, batch_count, optim_mem, work1, work2, work3,
+            work4);
+
+        rocsolver_syrk_herk<BATCHED, STRIDED, T>(
+            handle, uplo, rocblas_operation_conjugate_transpose, n2, n1, &s_minone, A,
+            shiftA + idx2D(0, n1, lda), lda, strideA, &s_one, A, shiftA + idx2D(n1, n1, lda), lda,
+            strideA, batch_count);
+    }
+    else
+    {
+        rocsolver_trsm_lower<BATCHED, STRIDED, T>(
+            handle, rocblas_side_right, rocblas_operation_conjugate_transpose,
+            rocblas_diagonal_non_unit, n2, n1, A, shiftA, lda, strideA, A,
+            shiftA + idx2D(n1, 0, lda), lda, strideA, batch_count, optim_mem, work1, work2, work3,
+            work4);
+
+        rocsolver_syrk_herk<BATCHED, STRIDED, T>(
+            handle, uplo, rocblas_operation_none, n2, n1, &s_minone, A, shiftA + idx2D(n1, 0, lda),
+            lda, strideA, &s_one, A, shiftA + idx2D(n1, n1, lda), lda, strideA, batch_count);
+    }
+
+    // factorize trailing half
+    potrf_recursive<BATCHED, STRIDED, T, S>(handle, uplo, n2, A, shiftA + idx2D(n1, n1, lda), lda,
+                                            strideA, info, offset + n1, batch_count, scalars,
+                                            work1, work2, work3, work4, pivots, optim_mem,
+                                            prefetch);
+
+    return rocblas_status_success;
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename S, typename I, typename U>
+rocblas_status rocsolver_potrf_template(rocblas_handle handle,
+                                        const rocblas_fill uplo,
+                                        const I n,
+                                        U A,
+                                        const rocblas_stride shiftA,
+                                        const I lda,
+                                        const rocblas_stride strideA,
+                                        I* info,
+                                        const I batch_count,
+                                        T* scalars,
+                                        void* work1,
+                                        void* work2,
+                                        void* work3,
+                                        void* work4,
+                                        T* pivots,
+                                        I* iinfo,
+                                        bool optim_mem,
+                                        const I offset = 0)
+{
+    ROCSOLVER_ENTER("potrf", "uplo:", uplo, "n:", n, "shiftA:", shiftA, "lda:", lda,
+                    "bc:", batch_count);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    I blocksReset = (batch_count - 1) / BS1 + 1;
+    dim3 gridReset(blocksReset, 1, 1);
+    dim3 threads(BS1, 1, 1);
+
+    // quick return
+    // (otherwise, info is initialized by the first call to POTF2; with offset > 0, the
+    // matrix is a trailing block of a larger one, and info is only updated)
+    if(n == 0)
+    {
+        if(offset == 0)
+            ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, info, batch_count,
+                                    0);
+        return rocblas_status_success;
+    }
+
+    // if the matrix is small, use the unblocked (BLAS-levelII) variant of the
+    // algorithm
+    if(n <= POTRF_POTF2_SWITCHSIZE(T))
+        return rocsolver_potf2_template<T>(handle, uplo, n, A, shiftA, lda, strideA, info,
+                                           batch_count, scalars, (T*)work1, pivots, offset);
+
+    // if there are many mid-size matrices, factorize each one with a single thread block
+    // (megakernel) instead of launching the kernels of every block column
+    if constexpr(std::is_same_v<I, rocblas_int>
+                 && (std::is_same_v<U, T*> || std::is_same_v<U, T* const*>))
+    {
+        if(offset == 0 && rocsolver_use_megakernel<(BATCHED || STRIDED)>(n, n, batch_count))
+            return potrf_run_megakernel<T>(handle, uplo, n, A, shiftA, lda, strideA, info,
+                                           batch_count);
+    }
+
+    // everything must be executed with scalars on the host
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+
+    // with the prefetch mode, the block columns of a matrix in managed memory are
+    // migrated to the device ahead of their use, and back to the host when completed
+    // (in order, so the recursive algorithm is not used)
+    managed_prefetch prefetch(handle, rocsolver_function_potrf, A, shiftA, I(1), lda, n,
+                              batch_count);
+
+    if(prefetch)
+        potrf_rightLooking<BATCHED, STRIDED, T, S>(handle, uplo, n, A, shiftA, lda, strideA, info,
+                                                   offset, batch_count, scalars, work1, work2,
+                                                   work3, work4, pivots, optim_mem, prefetch);
+    else
+        potrf_recursive<BATCHED, STRIDED, T, S>(handle, uplo, n, A, shiftA, lda, strideA, info,
+                                                offset, batch_count, scalars, work1, work2, work3,
+                                                work4, pivots, optim_mem, prefetch);
+
     rocblas_set_pointer_mode(handle, old_mode);
     return rocblas_status_success;
 }
 
+/** POTRF_INTERLEAVED_KERNEL factorizes one matrix of the batch per thread, working
+    directly in global memory. It is meant for interleaved batches (inca = batch_count
+    and strideA = 1), where the element (i,j) of consecutive matrices is contiguous in
+    memory and all the accesses of a wavefront are coalesced. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void potrf_interleaved_kernel(const rocblas_fill uplo,
+                                               const rocblas_int n,
+                                               U AA,
+                                               const rocblas_stride shiftA,
+                                               const rocblas_int inca,
+                                               const rocblas_int lda,
+                                               const rocblas_stride strideA,
+                                               rocblas_int* infoA,
+                                               const rocblas_int batch_count)
+{
+    using S = decltype(std::real(T{}));
+
+    rocblas_int b = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    if(b >= batch_count)
+        return;
+
+    T* A = load_ptr_batch<T>(AA, b, shiftA, strideA);
+    const int64_t ia = inca;
+    const int64_t la = lda;
+    rocblas_int info = 0;
+
+    if(uplo == rocblas_fill_lower)
+    {
+        // compute A = L * L'
+        for(rocblas_int k = 0; k < n; ++k)
+        {
+            const S akk = std::real(A[k * ia + k * la]);
+            if(akk <= 0 || !std::isfinite(akk))
+            {
+                // error for non-positive definiteness
+                A[k * ia + k * la] = akk;
+                info = k + 1;
+                break;
+            }
+
+            const S lkk = std::sqrt(akk);
+            A[k * ia + k * la] = lkk;
+            for(rocblas_int i = k + 1; i < n; ++i)
+                A[i * ia + k * la] = A[i * ia + k * la] / lkk;
+
+            for(rocblas_int j = k + 1; j < n; ++j)
+            {
+                const T ljk = conj(A[j * ia + k * la]);
+                for(rocblas_int i = j; i < n; ++i)
+                    A[i * ia + j * la] -= A[i * ia + k * la] * ljk;
+            }
+        }
+    }
+    else
+    {
+        // compute A = U' * U
+        for(rocblas_int k = 0; k < n; ++k)
+        {
+            const S akk = std::real(A[k * ia + k * la]);
+            if(akk <= 0 || !std::isfinite(akk))
+            {
+                // error for non-positive definiteness
+                A[k * ia + k * la] = akk;
+                info = k + 1;
+                break;
+            }
+
+            const S ukk = std::sqrt(akk);
+            A[k * ia + k * la] = ukk;
+            for(rocblas_int j = k + 1; j < n; ++j)
+                A[k * ia + j * la] = A[k * ia + j * la] / ukk;
+
+            for(rocblas_int j = k + 1; j < n; ++j)
+            {
+                const T ukj = A[k * ia + j * la];
+                for(rocblas_int i = k + 1; i <= j; ++i)
+                    A[i * ia + j * la] -= conj(A[k * ia + i * la]) * ukj;
+            }
+        }
+    }
+
+    infoA[b] = info;
+}
+
+template <typename T, typename U>
+rocblas_status rocsolver_potrf_interleaved_template(rocblas_handle handle,
+                                                    const rocblas_fill uplo,
+                                                    const rocblas_int n,
+                                                    U A,
+                                                    const rocblas_stride shiftA,
+                                                    const rocblas_int inca,
+                                                    const rocblas_int lda,
+                                                    const rocblas_stride strideA,
+                                                    rocblas_int* info,
+                                                    const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER("potrf_interleaved", "uplo:", uplo, "n:", n, "shiftA:", shiftA, "inca:", inca,
+                    "lda:", lda, "bc:", batch_count);
+
+    // quick return if zero instances in batch
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocks = (batch_count - 1) / BS1 + 1;
+    dim3 grid(blocks, 1, 1);
+    dim3 threads(BS1, 1, 1);
+
+    // quick return if no dimensions
+    if(n == 0)
+    {
+        ROCSOLVER_LAUNCH_KERNEL(reset_info, grid, threads, 0, stream, info, batch_count, 0);
+        return rocblas_status_success;
+    }
+
+    ROCSOLVER_LAUNCH_KERNEL((potrf_interleaved_kernel<T, U>), grid, threads, 0, stream, uplo, n,
+                            A, shiftA, inca, lda, strideA, info, batch_count);
+
+    return rocblas_status_success;
+}
+
+/** POTRF_VBATCHED_KERNEL factorizes the matrices of a variable-size batch whose size
+    n is in (lo, hi]. Each matrix is processed by a thread block working directly in
+    global memory, with every thread in charge of the rows i = tid + k * hipBlockDim_x.
+    The other thread blocks return immediately. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(VBATCHED_MAX_BIN)
+    potrf_vbatched_kernel(const rocblas_fill uplo,
+                          const rocblas_int* nn,
+                          U AA,
+                          const rocblas_int* ldaa,
+                          rocblas_int* infoA,
+                          const rocblas_int lo,
+                          const rocblas_int hi)
+{
+    using S = decltype(std::real(T{}));
+
+    const rocblas_int b = hipBlockIdx_x;
+    const rocblas_int tid = hipThreadIdx_x;
+    const rocblas_int nthds = hipBlockDim_x;
+
+    const rocblas_int n = nn[b];
+    const rocblas_int lda = ldaa[b];
+    const rocblas_int size = std::max(n, 1);
+    if(size <= lo || size > hi)
+        return;
+
+    // empty or invalid instances are quick returns
+    if(n <= 0 || lda < n)
+    {
+        if(tid == 0)
+            infoA[b] = 0;
+        return;
+    }
+
+    T* A = load_ptr_batch<T>(AA, b, 0, 0);
+    const int64_t la = lda;
+    rocblas_int info = 0;
+
+    for(rocblas_int k = 0; k < n; ++k)
+    {
+        const S akk = std::real(A[k + k * la]);
+        if(akk <= 0 || !std::isfinite(akk))
+        {
+            // error for non-positive definiteness
+            if(tid == 0)
+                A[k + k * la] = akk;
+            info = k + 1;
+            break;
+        }
+
+        const S dkk = std::sqrt(akk);
+        if(uplo == rocblas_fill_lower)
+        {
+            // compute A = L * L'
+            for(rocblas_int i = k + 1 + tid; i < n; i += nthds)
+                A[i + k * la] = A[i + k * la] / dkk;
+            __syncthreads();
+
+            if(tid == 0)
+                A[k + k * la] = dkk;
+            for(rocblas_int i = k + 1 + tid; i < n; i += nthds)
+            {
+                const T lik = A[i + k * la];
+                for(rocblas_int j = k + 1; j <= i; ++j)
+                    A[i + j * la] -= lik * conj(A[j + k * la]);
+            }
+        }
+        else
+        {
+            // compute A = U' * U
+            for(rocblas_int j = k + 1 + tid; j < n; j += nthds)
+                A[k + j * la] = A[k + j * la] / dkk;
+            __syncthreads();
+
+            if(tid == 0)
+                A[k + k * la] = dkk;
+            for(rocblas_int i = k + 1 + tid; i < n; i += nthds)
+            {
+                const T uki = conj(A[k + i * la]);
+                for(rocblas_int j = i; j < n; ++j)
+                    A[i + j * la] -= uki * A[k + j * la];
+            }
+        }
+        __syncthreads();
+    }
+
+    if(tid == 0)
+        infoA[b] = info;
+}
+
+template <typename T, typename U>
+rocblas_status rocsolver_potrf_vbatched_argCheck(rocblas_handle handle,
+                                                 const rocblas_fill uplo,
+                                                 const rocblas_int* n,
+                                                 U A,
+                                                 const rocblas_int* lda,
+                                                 rocblas_int* info,
+                                                 const rocblas_int batch_count)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    // (the sizes of the instances are only known on the device)
+    if(batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if(batch_count && (!n || !A || !lda || !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T, typename U>
+rocblas_status rocsolver_potrf_vbatched_template(rocblas_handle handle,
+                                                 const rocblas_fill uplo,
+                                                 const rocblas_int* n,
+                                                 U A,
+                                                 const rocblas_int* lda,
+                                                 rocblas_int* info,
+                                                 const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER("potrf_vbatched", "uplo:", uplo, "bc:", batch_count);
+
+    // quick return if zero instances in batch
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    dim3 grid(batch_count, 1, 1);
+
+    // one launch per size bin
+    for(rocblas_int bin = VBATCHED_MIN_BIN; bin <= VBATCHED_MAX_BIN; bin *= 2)
+    {
+        rocblas_int lo = (bin == VBATCHED_MIN_BIN) ? 0 : bin / 2;
+        rocblas_int hi = (bin == VBATCHED_MAX_BIN) ? INT_MAX : bin;
+
+        ROCSOLVER_LAUNCH_KERNEL((potrf_vbatched_kernel<T, U>), grid, dim3(bin, 1, 1), 0, stream,
+                                uplo, n, A, lda, info, lo, hi);
+    }
+
+    return rocblas_status_success;
+}
+
 ROCSOLVER_END_NAMESPACE
@@ -26,39 +26,48 @@
  * *************************************************************************/
 
 #include "roclapack_potrf.hpp"
+#include "rocsolver_check_mode.hpp"
 
 ROCSOLVER_BEGIN_NAMESPACE
 
-template <typename T, typename U>
+template <typename T, typename I, typename U>
 rocblas_status rocsolver_potrf_batched_impl(rocblas_handle handle,
                                             const rocblas_fill uplo,
-                                            const rocblas_int n,
+                                            const I n,
                                             U A,
-                                            const rocblas_int lda,
-                                            rocblas_int* info,
-                                            const rocblas_int batch_count)
+                                            const I lda,
+                                            I* info,
+                                            const I batch_count)
 {
     ROCSOLVER_ENTER_TOP("potrf_batched", "--uplo", uplo, "-n", n, "--lda", lda, "--batch_count",
                         batch_count);
+    ROCSOLVER_INFO_SUMMARY(info, batch_count);
 
     using S = decltype(std::real(T{}));
 
     if(!handle)
         return rocblas_status_invalid_handle;
 
-    // argument checking
-    rocblas_status st = rocsolver_potf2_potrf_argCheck(handle, uplo, n, lda, A, info, batch_count);
-    if(st != rocblas_status_continue)
-        return st;
+    // argument checking (unless disabled with rocsolver_set_check_mode)
+    if(!skip_arg_checks(handle))
+    {
+        rocblas_status st
+            = rocsolver_potf2_potrf_argCheck(handle, uplo, n, lda, A, info, batch_count);
+        if(st != rocblas_status_continue)
+            return st;
+    }
+
+    // nominal flop count for the call statistics
+    rocsolver_stats_flops(batch_count * rocsolver_potrf_flops<T>(n));
 
     // working with unshifted arrays
-    rocblas_int shiftA = 0;
+    rocblas_stride shiftA = 0;
 
     // batched execution
     rocblas_stride strideA = 0;
 
     // memory workspace sizes:
-    // size for constants in rocblas calls
+    // constants in rocblas calls (only whether they are needed, see set_device_scalars)
     size_t size_scalars;
     // size of reusable workspace (and for calling TRSM)
     bool optim_mem;
@@ -67,19 +76,29 @@ rocblas_status rocsolver_potrf_batched_impl(rocblas_handle handle,
     size_t size_pivots;
     // size to store info about positiveness of each subblock
     size_t size_iinfo;
-    rocsolver_potrf_getMemorySize<true, false, T>(n, uplo, batch_count, &size_scalars, &size_work1,
+
+    // the batch is split among nstreams internal streams; every sub-batch
+    // uses its own region of the workspace
+    I nstreams = potrf_batch_streams(n, batch_count);
+    I count = rocsolver_split_count(batch_count, nstreams);
+
+    rocsolver_potrf_getMemorySize<true, false, T>(n, uplo, count, &size_scalars, &size_work1,
                                                   &size_work2, &size_work3, &size_work4,
                                                   &size_pivots, &size_iinfo, &optim_mem);
+    rocsolver_split_align(nstreams, size_work1, size_work2, size_work3, size_work4, size_pivots,
+                          size_iinfo);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work1, size_work2,
-                                                      size_work3, size_work4, size_pivots,
-                                                      size_iinfo);
+        return rocblas_set_optimal_device_memory_size(
+            handle, size_t(0), nstreams * size_work1, nstreams * size_work2,
+            nstreams * size_work3, nstreams * size_work4, nstreams * size_pivots,
+            nstreams * size_iinfo);
 
     // memory workspace allocation
     void *scalars, *work1, *work2, *work3, *work4, *pivots, *iinfo;
-    rocblas_device_malloc mem(handle, size_scalars, size_work1, size_work2, size_work3, size_work4,
-                              size_pivots, size_iinfo);
+    rocblas_device_malloc mem(handle, size_t(0), nstreams * size_work1, nstreams * size_work2,
+                              nstreams * size_work3, nstreams * size_work4, nstreams * size_pivots,
+                              nstreams * size_iinfo);
 
     if(!mem)
         return rocblas_status_memory_error;
@@ -92,12 +111,17 @@ rocblas_status rocsolver_potrf_batched_impl(rocblas_handle handle,
     pivots = mem[5];
     iinfo = mem[6];
     if(size_scalars > 0)
-        init_scalars(handle, (T*)scalars);
+        ROCBLAS_CHECK(set_device_scalars<T>(scalars));
 
     // execution
-    return rocsolver_potrf_template<true, false, T, S>(
-        handle, uplo, n, A, shiftA, lda, strideA, info, batch_count, (T*)scalars, work1, work2,
-        work3, work4, (T*)pivots, (rocblas_int*)iinfo, optim_mem);
+    auto run = [&](I k, I first, I bc) {
+        return rocsolver_potrf_template<true, false, T, S>(
+            handle, uplo, n, A + first, shiftA, lda, strideA, info + first, bc, (T*)scalars,
+            (char*)work1 + k * size_work1, (char*)work2 + k * size_work2,
+            (char*)work3 + k * size_work3, (char*)work4 + k * size_work4,
+            (T*)((char*)pivots + k * size_pivots), (I*)((char*)iinfo + k * size_iinfo), optim_mem);
+    };
+    return _info_summary_scope.commit(rocsolver_split_batch(handle, batch_count, nstreams, run));
 }
 
 ROCSOLVER_END_NAMESPACE
@@ -156,4 +180,68 @@ rocblas_status rocsolver_zpotrf_batched(rocblas_handle handle,
     return rocsolver::rocsolver_potrf_batched_impl<rocblas_double_complex>(handle, uplo, n, A, lda,
                                                                            info, batch_count);
 }
+
+rocblas_status rocsolver_spotrf_batched_64(rocblas_handle handle,
+                                           const rocblas_fill uplo,
+                                           const int64_t n,
+                                           float* const A[],
+                                           const int64_t lda,
+                                           int64_t* info,
+                                           const int64_t batch_count)
+{
+#ifdef HAVE_ROCBLAS_64
+    return rocsolver::rocsolver_potrf_batched_impl<float>(handle, uplo, n, A, lda, info,
+                                                          batch_count);
+#else
+    return rocblas_status_not_implemented;
+#endif
+}
+
+rocblas_status rocsolver_dpotrf_batched_64(rocblas_handle handle,
+                                           const rocblas_fill uplo,
+                                           const int64_t n,
+                                           double* const A[],
+                                           const int64_t lda,
+                                           int64_t* info,
+                                           const int64_t batch_count)
+{
+#ifdef HAVE_ROCBLAS_64
+    return rocsolver::rocsolver_potrf_batched_impl<double>(handle, uplo, n, A, lda, info,
+                                                           batch_count);
+#else
+    return rocblas_status_not_implemented;
+#endif
+}
+
+rocblas_status rocsolver_cpotrf_batched_64(rocblas_handle handle,
+                                           const rocblas_fill uplo,
+                                           const int64_t n,
+                                           rocblas_float_complex* const A[],
+                                           const int64_t lda,
+                                           int64_t* info,
+                                           const int64_t batch_count)
+{
+#ifdef HAVE_ROCBLAS_64
+    return rocsolver::rocsolver_potrf_batched_impl<rocblas_float_complex>(handle, uplo, n, A, lda,
+                                                                          info, batch_count);
+#else
+    return rocblas_status_not_implemented;
+#endif
+}
+
+rocblas_status rocsolver_zpotrf_batched_64(rocblas_handle handle,
+                                           const rocblas_fill uplo,
+                                           const int64_t n,
+                                           rocblas_double_complex* const A[],
+                                           const int64_t lda,
+                                           int64_t* info,
+                                           const int64_t batch_count)
+{
+#ifdef HAVE_ROCBLAS_64
+    return rocsolver::rocsolver_potrf_batched_impl<rocblas_double_complex>(handle, uplo, n, A, lda,
+                                                                           info, batch_count);
+#else
+    return rocblas_status_not_implemented;
+#endif
+}
 }
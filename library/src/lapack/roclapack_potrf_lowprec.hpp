@@ -0,0 +1,223 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "roclapack_getrf_lowprec.hpp"
+#include "roclapack_potrf.hpp"
+#include "rocsolver/rocsolver.h"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/** POTRF_LOWPREC_SMALL_KERNEL computes the Cholesky factorization of the n-by-n matrices A, with
+    n <= DIM. Each thread-block factorizes one matrix in LDS with single precision arithmetic; the
+    upper triangular case is processed as the transposed lower triangular case, and thread i
+    updates row i of the trailing matrix. **/
+template <int DIM, typename T>
+ROCSOLVER_KERNEL void __launch_bounds__(DIM)
+    potrf_lowprec_small_kernel(const rocblas_fill uplo,
+                               const rocblas_int n,
+                               T* A,
+                               const rocblas_int lda,
+                               const rocblas_stride strideA,
+                               rocblas_int* info)
+{
+    // the leading dimension in LDS is padded to avoid bank conflicts when accessing rows
+    constexpr rocblas_int lds = DIM + 1;
+
+    const rocblas_int b = hipBlockIdx_x;
+    const rocblas_int tid = hipThreadIdx_x;
+    const bool upper = (uplo == rocblas_fill_upper);
+
+    T* Ap = A + b * strideA;
+
+    __shared__ float sA[lds * DIM];
+    __shared__ rocblas_int sinfo;
+
+    // read the triangular part in single precision (as a lower triangular matrix)
+    if(tid < n)
+    {
+        for(rocblas_int j = 0; j < n; j++)
+        {
+            if(upper && tid <= j)
+                sA[j + tid * lds] = lowprec_to_float(Ap[tid + j * lda]);
+            if(!upper && tid >= j)
+                sA[tid + j * lds] = lowprec_to_float(Ap[tid + j * lda]);
+        }
+    }
+    if(tid == 0)
+        sinfo = 0;
+    __syncthreads();
+
+    for(rocblas_int k = 0; k < n; k++)
+    {
+        // check that the matrix is positive definite
+        if(tid == 0)
+        {
+            float d = sA[k + k * lds];
+            if(d > 0)
+                sA[k + k * lds] = std::sqrt(d);
+            else
+                sinfo = k + 1;
+        }
+        __syncthreads();
+
+        if(sinfo != 0)
+            break;
+
+        // scale the column
+        if(tid > k && tid < n)
+            sA[tid + k * lds] /= sA[k + k * lds];
+        __syncthreads();
+
+        // update the trailing matrix
+        if(tid > k && tid < n)
+        {
+            const float l = sA[tid + k * lds];
+            for(rocblas_int j = k + 1; j <= tid; j++)
+                sA[tid + j * lds] -= l * sA[j + k * lds];
+        }
+        __syncthreads();
+    }
+
+    // write the factor back in the storage precision
+    if(tid < n)
+    {
+        for(rocblas_int j = 0; j < n; j++)
+        {
+            if(upper && tid <= j)
+                Ap[tid + j * lda] = lowprec_from_float<T>(sA[j + tid * lds]);
+            if(!upper && tid >= j)
+                Ap[tid + j * lda] = lowprec_from_float<T>(sA[tid + j * lds]);
+        }
+    }
+
+    if(tid == 0)
+        info[b] = sinfo;
+}
+
+/** Return the sizes of the different workspace arrays **/
+template <typename T>
+void rocsolver_potrf_lowprec_getMemorySize(const rocblas_int n,
+                                           const rocblas_fill uplo,
+                                           const rocblas_int batch_count,
+                                           size_t* size_scalars,
+                                           size_t* size_work1,
+                                           size_t* size_work2,
+                                           size_t* size_work3,
+                                           size_t* size_work4,
+                                           size_t* size_pivots,
+                                           size_t* size_iinfo,
+                                           size_t* size_Awork,
+                                           bool* optim_mem)
+{
+    // if quick return, or if the small kernel is used, no workspace is needed
+    if(n == 0 || batch_count == 0 || n <= LOWPREC_MAX_SMALL_SIZE)
+    {
+        *size_scalars = 0;
+        *size_work1 = 0;
+        *size_work2 = 0;
+        *size_work3 = 0;
+        *size_work4 = 0;
+        *size_pivots = 0;
+        *size_iinfo = 0;
+        *size_Awork = 0;
+        *optim_mem = true;
+        return;
+    }
+
+    // requirements for calling POTRF in single precision
+    rocsolver_potrf_getMemorySize<false, true, float>(n, uplo, batch_count, size_scalars,
+                                                      size_work1, size_work2, size_work3,
+                                                      size_work4, size_pivots, size_iinfo,
+                                                      optim_mem);
+
+    // size of the single precision copy of A
+    *size_Awork = sizeof(float) * n * n * batch_count;
+}
+
+template <typename T>
+rocblas_status rocsolver_potrf_lowprec_template(rocblas_handle handle,
+                                                const rocblas_fill uplo,
+                                                const rocblas_int n,
+                                                T* A,
+                                                const rocblas_int lda,
+                                                const rocblas_stride strideA,
+                                                rocblas_int* info,
+                                                const rocblas_int batch_count,
+                                                float* scalars,
+                                                void* work1,
+                                                void* work2,
+                                                void* work3,
+                                                void* work4,
+                                                float* pivots,
+                                                rocblas_int* iinfo,
+                                                float* Awork,
+                                                const bool optim_mem)
+{
+    ROCSOLVER_ENTER("potrf_lowprec", "uplo:", uplo, "n:", n, "lda:", lda, "bc:", batch_count);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // quick return if no dimensions
+    if(n == 0)
+    {
+        rocblas_int blocks = (batch_count - 1) / BS1 + 1;
+        ROCSOLVER_LAUNCH_KERNEL(reset_info, dim3(blocks, 1, 1), dim3(BS1, 1, 1), 0, stream, info,
+                                batch_count, 0);
+        return rocblas_status_success;
+    }
+
+    // small matrices are factorized in LDS by a single kernel
+    if(n <= LOWPREC_MAX_SMALL_SIZE)
+    {
+        ROCSOLVER_LAUNCH_KERNEL((potrf_lowprec_small_kernel<LOWPREC_MAX_SMALL_SIZE, T>),
+                                dim3(batch_count, 1, 1), dim3(LOWPREC_MAX_SMALL_SIZE, 1, 1), 0,
+                                stream, uplo, n, A, lda, strideA, info);
+        return rocblas_status_success;
+    }
+
+    // otherwise, factorize a single precision copy of the triangular part of the matrices
+    rocblas_stride strideW = rocblas_stride(n) * n;
+    lowprec_run_copy(stream, uplo, n, n, A, lda, strideA, Awork, n, strideW, batch_count);
+
+    rocsolver_potrf_template<false, true, float, float>(handle, uplo, n, Awork, 0, n, strideW, info,
+                                                        batch_count, scalars, work1, work2, work3,
+                                                        work4, pivots, iinfo, optim_mem);
+
+    lowprec_run_copy(stream, uplo, n, n, Awork, n, strideW, A, lda, strideA, batch_count);
+
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
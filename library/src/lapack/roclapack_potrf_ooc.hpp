@@ -0,0 +1,312 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "roclapack_potrf.hpp"
+#include "rocsolver/rocsolver.h"
+#include "rocsolver_streams.hpp"
+#include "rocsolver_tuning.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/** Returns the width of the block columns (or block rows) streamed by POTRF_OOC. **/
+template <typename I>
+I potrf_ooc_get_blksize(const I n)
+{
+    I size[] = {POTRF_OOC_BLKSIZES};
+    I intervals[] = {POTRF_OOC_INTERVALS};
+    I max = POTRF_OOC_NUM_INTERVALS;
+    return std::min(n, get_tuned_blksize("potrf_ooc", size, intervals, max, n));
+}
+
+/** Copies a rows-by-cols block between the host matrix and a tile on the device. **/
+template <typename T, typename I>
+hipError_t potrf_ooc_copy(T* dst,
+                          const size_t ldd,
+                          const T* src,
+                          const size_t lds,
+                          const I rows,
+                          const I cols,
+                          const hipMemcpyKind kind,
+                          hipStream_t stream)
+{
+    return hipMemcpy2DAsync(dst, sizeof(T) * ldd, src, sizeof(T) * lds, sizeof(T) * rows, cols,
+                            kind, stream);
+}
+
+/** Events that synchronize the copy stream with the stream of the handle. They are
+    destroyed when leaving the template (hipEventDestroy is deferred until the events
+    have completed). **/
+struct potrf_ooc_events
+{
+    // loaded[0:2]: a buffer has been copied to the device; consumed[0:2]: the update that
+    // used a buffer has been executed; panel: the block column has been copied to the
+    // device; factorized: the block column is ready to be copied back; stored: the last
+    // block column has been copied back
+    enum
+    {
+        loaded = 0,
+        consumed = 2,
+        panel = 4,
+        factorized = 5,
+        stored = 6,
+        count = 7
+    };
+    hipEvent_t e[count] = {};
+    bool ok = true;
+
+    potrf_ooc_events()
+    {
+        for(int i = 0; i < count; ++i)
+            ok = ok && hipEventCreateWithFlags(&e[i], hipEventDisableTiming) == hipSuccess;
+    }
+    ~potrf_ooc_events()
+    {
+        for(int i = 0; i < count; ++i)
+            if(e[i])
+                hipEventDestroy(e[i]);
+    }
+};
+
+template <typename T, typename I>
+void rocsolver_potrf_ooc_getMemorySize(const I n,
+                                       const rocblas_fill uplo,
+                                       size_t* size_scalars,
+                                       size_t* size_work1,
+                                       size_t* size_work2,
+                                       size_t* size_work3,
+                                       size_t* size_work4,
+                                       size_t* size_pivots,
+                                       size_t* size_iinfo,
+                                       size_t* size_tiles,
+                                       bool* optim_mem)
+{
+    // if quick return no need of workspace
+    if(n == 0)
+    {
+        *size_scalars = 0;
+        *size_work1 = 0;
+        *size_work2 = 0;
+        *size_work3 = 0;
+        *size_work4 = 0;
+        *size_pivots = 0;
+        *size_iinfo = 0;
+        *size_tiles = 0;
+        *optim_mem = true;
+        return;
+    }
+
+    const I nb = potrf_ooc_get_blksize(n);
+
+    // requirements for calling POTRF on the diagonal blocks
+    rocsolver_potrf_getMemorySize<false, false, T>(nb, uplo, I(1), size_scalars, size_work1,
+                                                   size_work2, size_work3, size_work4,
+                                                   size_pivots, size_iinfo, optim_mem);
+
+    // extra requirements for calling TRSM on the off-diagonal blocks
+    if(n > nb)
+    {
+        size_t w1, w2, w3, w4;
+        bool opt;
+        if(uplo == rocblas_fill_upper)
+            rocsolver_trsm_mem<false, false, T>(rocblas_side_left,
+                                                rocblas_operation_conjugate_transpose, nb, n - nb,
+                                                I(1), &w1, &w2, &w3, &w4, &opt);
+        else
+            rocsolver_trsm_mem<false, false, T>(rocblas_side_right,
+                                                rocblas_operation_conjugate_transpose, n - nb, nb,
+                                                I(1), &w1, &w2, &w3, &w4, &opt);
+
+        *size_work1 = std::max(*size_work1, w1);
+        *size_work2 = std::max(*size_work2, w2);
+        *size_work3 = std::max(*size_work3, w3);
+        *size_work4 = std::max(*size_work4, w4);
+        *optim_mem = *optim_mem && opt;
+    }
+
+    // the block column being factorized, and two buffers for the block columns that update it
+    *size_tiles = sizeof(T) * size_t(n) * nb * 3;
+}
+
+/** POTRF_OOC computes the Cholesky factorization of a matrix in host memory that does not
+    need to fit in device memory. It is a left-looking blocked algorithm: the block column j
+    (or block row, if uplo is upper) is copied to the device, updated with all the previous
+    (already factorized) block columns, which are streamed from the host through two
+    alternating buffers, and factorized; then it is copied back to the host. The copies are
+    executed on a side stream to overlap with the updates. **/
+template <typename T, typename S, typename I>
+rocblas_status rocsolver_potrf_ooc_template(rocblas_handle handle,
+                                            const rocblas_fill uplo,
+                                            const I n,
+                                            T* A,
+                                            const I lda,
+                                            I* info,
+                                            T* scalars,
+                                            void* work1,
+                                            void* work2,
+                                            void* work3,
+                                            void* work4,
+                                            T* pivots,
+                                            I* iinfo,
+                                            T* tiles,
+                                            bool optim_mem)
+{
+    ROCSOLVER_ENTER("potrf_ooc", "uplo:", uplo, "n:", n, "lda:", lda);
+
+    hipStream_t stream, cstream;
+    rocblas_get_stream(handle, &stream);
+
+    dim3 gridReset(1, 1, 1);
+    dim3 threads(BS1, 1, 1);
+
+    // quick return
+    // (otherwise, info is initialized by the factorization of the first diagonal block)
+    if(n == 0)
+    {
+        // info=0 (starting with a positive definite matrix)
+        ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, info, I(1), 0);
+        return rocblas_status_success;
+    }
+
+    // the copies are executed on the side stream if available; otherwise, they are
+    // serialized with the computations on the stream of the handle
+    if(rocsolver_get_side_stream(handle, &cstream) != hipSuccess)
+        cstream = stream;
+    potrf_ooc_events ev;
+    if(!ev.ok)
+        return rocblas_status_internal_error;
+
+    // everything must be executed with scalars on the host
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+
+    // constants for rocblas functions calls
+    T t_one = 1;
+    T t_minone = -1;
+    S s_one = 1;
+    S s_minone = -1;
+
+    // the block column j is P, with leading dimension n (or the block row j, with leading
+    // dimension nb); Q[0] and Q[1] hold the previous block columns (or rows)
+    const bool upper = (uplo == rocblas_fill_upper);
+    const I nb = potrf_ooc_get_blksize(n);
+    const I ldt = upper ? nb : n;
+    const size_t ld = lda;
+    T* P = tiles;
+    T* Q[2] = {tiles + size_t(n) * nb, tiles + size_t(n) * nb * 2};
+
+    for(I j = 0; j < n; j += nb)
+    {
+        const I jb = std::min(n - j, nb);
+        const I mj = n - j; // length of the block column (or row)
+        const I rows = upper ? jb : mj;
+        const I cols = upper ? mj : jb;
+
+        // copy the block column to the device (after the previous one has been copied back)
+        HIP_CHECK(potrf_ooc_copy(P, ldt, A + j + j * ld, ld, rows, cols, hipMemcpyHostToDevice,
+                                 cstream));
+        HIP_CHECK(hipEventRecord(ev.e[ev.panel], cstream));
+        HIP_CHECK(hipStreamWaitEvent(stream, ev.e[ev.panel], 0));
+
+        // update it with the previous block columns; the copy of the next one overlaps with
+        // the update using the current one
+        for(I k = 0, b = 0; k < j; k += nb, b = 1 - b)
+        {
+            const T* Ak = upper ? A + k + j * ld : A + j + k * ld;
+            HIP_CHECK(hipStreamWaitEvent(cstream, ev.e[ev.consumed + b], 0));
+            HIP_CHECK(potrf_ooc_copy(Q[b], ldt, Ak, ld, upper ? nb : mj, upper ? mj : nb,
+                                     hipMemcpyHostToDevice, cstream));
+            HIP_CHECK(hipEventRecord(ev.e[ev.loaded + b], cstream));
+            HIP_CHECK(hipStreamWaitEvent(stream, ev.e[ev.loaded + b], 0));
+
+            if(upper)
+            {
+                // A(j:j+jb, j:n) -= U(k:k+nb, j:j+jb)' * U(k:k+nb, j:n)
+                rocsolver_syrk_herk<false, false, T>(
+                    handle, uplo, rocblas_operation_conjugate_transpose, jb, nb, &s_minone, Q[b], 0,
+                    ldt, 0, &s_one, P, 0, ldt, 0, I(1));
+                if(mj > jb)
+                    rocsolver_gemm<false, false, T>(
+                        handle, rocblas_operation_conjugate_transpose, rocblas_operation_none, jb,
+                        mj - jb, nb, &t_minone, Q[b], 0, ldt, 0, Q[b], idx2D(0, jb, ldt), ldt, 0,
+                        &t_one, P, idx2D(0, jb, ldt), ldt, 0, I(1), (T**)nullptr);
+            }
+            else
+            {
+                // A(j:n, j:j+jb) -= L(j:n, k:k+nb) * L(j:j+jb, k:k+nb)'
+                rocsolver_syrk_herk<false, false, T>(handle, uplo, rocblas_operation_none, jb, nb,
+                                                     &s_minone, Q[b], 0, ldt, 0, &s_one, P, 0,
+                                                     ldt, 0, I(1));
+                if(mj > jb)
+                    rocsolver_gemm<false, false, T>(
+                        handle, rocblas_operation_none, rocblas_operation_conjugate_transpose,
+                        mj - jb, jb, nb, &t_minone, Q[b], jb, ldt, 0, Q[b], 0, ldt, 0, &t_one, P,
+                        jb, ldt, 0, I(1), (T**)nullptr);
+            }
+            HIP_CHECK(hipEventRecord(ev.e[ev.consumed + b], stream));
+        }
+
+        // factorize the diagonal block and test for non-positive-definiteness
+        // (the order of the first non-positive minor is shifted by j)
+        rocsolver_potrf_template<false, false, T, S>(handle, uplo, jb, P, 0, ldt, 0, info, I(1),
+                                                     scalars, work1, work2, work3, work4, pivots,
+                                                     iinfo, optim_mem, j);
+
+        // solve for the off-diagonal block
+        if(mj > jb)
+        {
+            if(upper)
+                rocsolver_trsm_upper<false, false, T>(
+                    handle, rocblas_side_left, rocblas_operation_conjugate_transpose,
+                    rocblas_diagonal_non_unit, jb, mj - jb, P, 0, ldt, 0, P, idx2D(0, jb, ldt), ldt,
+                    0, I(1), optim_mem, work1, work2, work3, work4);
+            else
+                rocsolver_trsm_lower<false, false, T>(
+                    handle, rocblas_side_right, rocblas_operation_conjugate_transpose,
+                    rocblas_diagonal_non_unit, mj - jb, jb, P, 0, ldt, 0, P, jb, ldt, 0, I(1),
+                    optim_mem, work1, work2, work3, work4);
+        }
+
+        // copy the factorized block column back to the host
+        HIP_CHECK(hipEventRecord(ev.e[ev.factorized], stream));
+        HIP_CHECK(hipStreamWaitEvent(cstream, ev.e[ev.factorized], 0));
+        HIP_CHECK(potrf_ooc_copy(A + j + j * ld, ld, (const T*)P, ldt, rows, cols,
+                                 hipMemcpyDeviceToHost, cstream));
+    }
+
+    // the work on the stream of the handle completes after the last copy
+    HIP_CHECK(hipEventRecord(ev.e[ev.stored], cstream));
+    HIP_CHECK(hipStreamWaitEvent(stream, ev.e[ev.stored], 0));
+
+    rocblas_set_pointer_mode(handle, old_mode);
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
@@ -0,0 +1,149 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "roclapack_potrf_tile.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+template <typename T>
+rocblas_status rocsolver_potrf_tile_impl(rocblas_handle handle,
+                                         const rocblas_fill uplo,
+                                         const rocblas_int n,
+                                         const rocblas_int nb,
+                                         T* A,
+                                         rocblas_int* info)
+{
+    ROCSOLVER_ENTER_TOP("potrf_tile", "--uplo", uplo, "-n", n, "--nb", nb);
+    ROCSOLVER_INFO_SUMMARY(info, 1);
+
+    using S = decltype(std::real(T{}));
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_potrf_tile_argCheck(handle, uplo, n, nb, A, info);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // nominal flop count for the call statistics
+    rocsolver_stats_flops(rocsolver_potrf_flops<T>(n));
+
+    // memory workspace sizes:
+    // constants in rocblas calls (only whether they are needed, see set_device_scalars)
+    size_t size_scalars;
+    // size of reusable workspace (and for calling TRSM)
+    bool optim_mem;
+    size_t size_work1, size_work2, size_work3, size_work4;
+    // extra requirements for calling POTF2
+    size_t size_pivots;
+    // size to store info about positiveness of each subblock
+    size_t size_iinfo;
+    rocsolver_potrf_tile_getMemorySize<T>(n, nb, uplo, &size_scalars, &size_work1, &size_work2,
+                                          &size_work3, &size_work4, &size_pivots, &size_iinfo,
+                                          &optim_mem);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_t(0), size_work1, size_work2,
+                                                      size_work3, size_work4, size_pivots,
+                                                      size_iinfo);
+
+    // memory workspace allocation
+    void *scalars, *work1, *work2, *work3, *work4, *pivots, *iinfo;
+    rocblas_device_malloc mem(handle, size_t(0), size_work1, size_work2, size_work3, size_work4,
+                              size_pivots, size_iinfo);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    scalars = mem[0];
+    work1 = mem[1];
+    work2 = mem[2];
+    work3 = mem[3];
+    work4 = mem[4];
+    pivots = mem[5];
+    iinfo = mem[6];
+    if(size_scalars > 0)
+        ROCBLAS_CHECK(set_device_scalars<T>(scalars));
+
+    // execution
+    return _info_summary_scope.commit(rocsolver_potrf_tile_template<T, S>(
+        handle, uplo, n, nb, A, info, (T*)scalars, work1, work2, work3, work4, (T*)pivots,
+        (rocblas_int*)iinfo, optim_mem));
+}
+
+ROCSOLVER_END_NAMESPACE
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+rocblas_status rocsolver_spotrf_tile(rocblas_handle handle,
+                                     const rocblas_fill uplo,
+                                     const rocblas_int n,
+                                     const rocblas_int nb,
+                                     float* A,
+                                     rocblas_int* info)
+{
+    return rocsolver::rocsolver_potrf_tile_impl<float>(handle, uplo, n, nb, A, info);
+}
+
+rocblas_status rocsolver_dpotrf_tile(rocblas_handle handle,
+                                     const rocblas_fill uplo,
+                                     const rocblas_int n,
+                                     const rocblas_int nb,
+                                     double* A,
+                                     rocblas_int* info)
+{
+    return rocsolver::rocsolver_potrf_tile_impl<double>(handle, uplo, n, nb, A, info);
+}
+
+rocblas_status rocsolver_cpotrf_tile(rocblas_handle handle,
+                                     const rocblas_fill uplo,
+                                     const rocblas_int n,
+                                     const rocblas_int nb,
+                                     rocblas_float_complex* A,
+                                     rocblas_int* info)
+{
+    return rocsolver::rocsolver_potrf_tile_impl<rocblas_float_complex>(handle, uplo, n, nb, A,
+                                                                      info);
+}
+
+rocblas_status rocsolver_zpotrf_tile(rocblas_handle handle,
+                                     const rocblas_fill uplo,
+                                     const rocblas_int n,
+                                     const rocblas_int nb,
+                                     rocblas_double_complex* A,
+                                     rocblas_int* info)
+{
+    return rocsolver::rocsolver_potrf_tile_impl<rocblas_double_complex>(handle, uplo, n, nb, A,
+                                                                       info);
+}
+}
@@ -0,0 +1,241 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "auxiliary/rocauxiliary_ge2tile.hpp"
+#include "rocblas.hpp"
+#include "roclapack_potrf.hpp"
+#include "rocsolver/rocsolver.h"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+template <typename T>
+rocblas_status rocsolver_potrf_tile_argCheck(rocblas_handle handle,
+                                             const rocblas_fill uplo,
+                                             const rocblas_int n,
+                                             const rocblas_int nb,
+                                             T A,
+                                             rocblas_int* info)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(n < 0 || nb < 1)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !A) || !info)
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T>
+void rocsolver_potrf_tile_getMemorySize(const rocblas_int n,
+                                        const rocblas_int nb,
+                                        const rocblas_fill uplo,
+                                        size_t* size_scalars,
+                                        size_t* size_work1,
+                                        size_t* size_work2,
+                                        size_t* size_work3,
+                                        size_t* size_work4,
+                                        size_t* size_pivots,
+                                        size_t* size_iinfo,
+                                        bool* optim_mem)
+{
+    // if quick return no need of workspace
+    if(n == 0)
+    {
+        *size_scalars = 0;
+        *size_work1 = 0;
+        *size_work2 = 0;
+        *size_work3 = 0;
+        *size_work4 = 0;
+        *size_pivots = 0;
+        *size_iinfo = 0;
+        *optim_mem = true;
+        return;
+    }
+
+    const rocblas_int nt = tile_count(n, nb);
+
+    // requirements for calling POTRF on the diagonal tiles
+    rocsolver_potrf_getMemorySize<false, false, T>(nb, uplo, 1, size_scalars, size_work1,
+                                                   size_work2, size_work3, size_work4,
+                                                   size_pivots, size_iinfo, optim_mem);
+
+    // extra requirements for calling TRSM on the tiles of the first tile column (or row)
+    if(nt > 1)
+    {
+        size_t w1, w2, w3, w4;
+        bool opt;
+        rocsolver_trsm_mem<false, true, T>(
+            uplo == rocblas_fill_upper ? rocblas_side_left : rocblas_side_right,
+            rocblas_operation_conjugate_transpose, nb, nb, nt - 1, &w1, &w2, &w3, &w4, &opt);
+
+        *size_work1 = std::max(*size_work1, w1);
+        *size_work2 = std::max(*size_work2, w2);
+        *size_work3 = std::max(*size_work3, w3);
+        *size_work4 = std::max(*size_work4, w4);
+        *optim_mem = *optim_mem && opt;
+    }
+}
+
+/** POTRF_TILE computes the Cholesky factorization of a matrix in the tile layout. It is a
+    right-looking tile algorithm: at step k, the diagonal tile (k,k) is factorized, the tiles
+    below it (or to its right, if uplo is upper) are solved, and the trailing tiles are
+    updated. As the tiles are contiguous and equally spaced, all the independent tasks of a
+    stage of the task graph are executed by a single strided batched call: one TRSM for the
+    tile column, one SYRK/HERK for all the trailing diagonal tiles, and one GEMM per trailing
+    tile column. **/
+template <typename T, typename S>
+rocblas_status rocsolver_potrf_tile_template(rocblas_handle handle,
+                                             const rocblas_fill uplo,
+                                             const rocblas_int n,
+                                             const rocblas_int nb,
+                                             T* A,
+                                             rocblas_int* info,
+                                             T* scalars,
+                                             void* work1,
+                                             void* work2,
+                                             void* work3,
+                                             void* work4,
+                                             T* pivots,
+                                             rocblas_int* iinfo,
+                                             bool optim_mem)
+{
+    ROCSOLVER_ENTER("potrf_tile", "uplo:", uplo, "n:", n, "nb:", nb);
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    dim3 gridReset(1, 1, 1);
+    dim3 threads(BS1, 1, 1);
+
+    // quick return
+    // (otherwise, info is initialized by the factorization of the first diagonal tile)
+    if(n == 0)
+    {
+        // info=0 (starting with a positive definite matrix)
+        ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, info, 1, 0);
+        return rocblas_status_success;
+    }
+
+    // everything must be executed with scalars on the host
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+
+    // constants for rocblas functions calls
+    T t_one = 1;
+    T t_minone = -1;
+    S s_one = 1;
+    S s_minone = -1;
+
+    // consecutive tiles of a tile column are nt2 elements apart, and consecutive tiles of a
+    // tile row are nt*nt2 elements apart
+    const bool upper = (uplo == rocblas_fill_upper);
+    const rocblas_int nt = tile_count(n, nb);
+    const rocblas_stride nt2 = rocblas_stride(nb) * nb;
+    const rocblas_stride strideT = upper ? nt * nt2 : nt2;
+    const rocblas_stride strideD = (nt + 1) * nt2;
+
+    for(rocblas_int k = 0; k < nt; ++k)
+    {
+        // factorize the diagonal tile and test for non-positive-definiteness
+        // (the order of the first non-positive minor is shifted by k*nb; the padding of
+        // the last tile is the identity, so it is never reported)
+        rocsolver_potrf_template<false, false, T, S>(
+            handle, uplo, nb, A, tile_index(nt, nb, k, k), nb, 0, info, 1, scalars, work1, work2,
+            work3, work4, pivots, iinfo, optim_mem, k * nb);
+
+        const rocblas_int nr = nt - k - 1;
+        if(nr == 0)
+            break;
+
+        if(upper)
+        {
+            // A(k, k+1:nt) = U(k,k)' \ A(k, k+1:nt)
+            rocsolver_trsm_upper<false, true, T>(
+                handle, rocblas_side_left, rocblas_operation_conjugate_transpose,
+                rocblas_diagonal_non_unit, nb, nb, A, tile_index(nt, nb, k, k), nb, 0, A,
+                tile_index(nt, nb, k, k + 1), nb, strideT, nr, optim_mem, work1, work2, work3,
+                work4);
+
+            // A(j,j) -= U(k,j)' * U(k,j) for j = k+1:nt
+            rocsolver_syrk_herk<false, true, T>(
+                handle, uplo, rocblas_operation_conjugate_transpose, nb, nb, &s_minone, A,
+                tile_index(nt, nb, k, k + 1), nb, strideT, &s_one, A,
+                tile_index(nt, nb, k + 1, k + 1), nb, strideD, nr);
+
+            // A(j, j+1:nt) -= U(k,j)' * U(k, j+1:nt) for j = k+1:nt-1
+            for(rocblas_int j = k + 1; j < nt - 1; ++j)
+                rocsolver_gemm<false, true, T>(
+                    handle, rocblas_operation_conjugate_transpose, rocblas_operation_none, nb, nb,
+                    nb, &t_minone, A, tile_index(nt, nb, k, j), nb, 0, A,
+                    tile_index(nt, nb, k, j + 1), nb, strideT, &t_one, A,
+                    tile_index(nt, nb, j, j + 1), nb, strideT, nt - j - 1, (T**)nullptr);
+        }
+        else
+        {
+            // A(k+1:nt, k) = A(k+1:nt, k) / L(k,k)'
+            rocsolver_trsm_lower<false, true, T>(
+                handle, rocblas_side_right, rocblas_operation_conjugate_transpose,
+                rocblas_diagonal_non_unit, nb, nb, A, tile_index(nt, nb, k, k), nb, 0, A,
+                tile_index(nt, nb, k + 1, k), nb, strideT, nr, optim_mem, work1, work2, work3,
+                work4);
+
+            // A(j,j) -= L(j,k) * L(j,k)' for j = k+1:nt
+            rocsolver_syrk_herk<false, true, T>(
+                handle, uplo, rocblas_operation_none, nb, nb, &s_minone, A,
+                tile_index(nt, nb, k + 1, k), nb, strideT, &s_one, A,
+                tile_index(nt, nb, k + 1, k + 1), nb, strideD, nr);
+
+            // A(j+1:nt, j) -= L(j+1:nt, k) * L(j,k)' for j = k+1:nt-1
+            for(rocblas_int j = k + 1; j < nt - 1; ++j)
+                rocsolver_gemm<false, true, T>(
+                    handle, rocblas_operation_none, rocblas_operation_conjugate_transpose, nb, nb,
+                    nb, &t_minone, A, tile_index(nt, nb, j + 1, k), nb, strideT, A,
+                    tile_index(nt, nb, j, k), nb, 0, &t_one, A, tile_index(nt, nb, j + 1, j), nb,
+                    strideT, nt - j - 1, (T**)nullptr);
+        }
+    }
+
+    rocblas_set_pointer_mode(handle, old_mode);
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
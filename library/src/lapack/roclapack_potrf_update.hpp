@@ -0,0 +1,345 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "rocsolver/rocsolver.h"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/** POTRF_UPDATE_ROTATIONS_KERNEL generates the rotations that eliminate the vectors in X
+    against the jb columns of the Cholesky factor starting at column j0, and applies them to the
+    rows of the diagonal block (one row per thread). For an update, the rotations are unitary Givens
+    rotations; for a downdate, they are hyperbolic rotations applied in the mixed form
+    (the new column of the factor is used to update X), which is the stable variant.
+    The rotation for column j and vector p is stored in rotc/rots at position (j - j0) + p * nb.
+    If a downdate fails, info is set to the failing column and the next kernels return early. **/
+template <bool DOWNDATE, typename T, typename S, typename U, typename V>
+ROCSOLVER_KERNEL void __launch_bounds__(POTRF_UPDATE_BLOCKSIZE)
+    potrf_update_rotations_kernel(const rocblas_fill uplo,
+                                  const rocblas_int n,
+                                  const rocblas_int k,
+                                  const rocblas_int j0,
+                                  const rocblas_int jb,
+                                  U AA,
+                                  const rocblas_stride shiftA,
+                                  const rocblas_int lda,
+                                  const rocblas_stride strideA,
+                                  V XX,
+                                  const rocblas_stride shiftX,
+                                  const rocblas_int ldx,
+                                  const rocblas_stride strideX,
+                                  rocblas_int* info,
+                                  S* rotcA,
+                                  T* rotsA)
+{
+    const rocblas_int bid = hipBlockIdx_z;
+    const rocblas_int tid = hipThreadIdx_x;
+    const bool lower = (uplo == rocblas_fill_lower);
+    const rocblas_int nb = POTRF_UPDATE_BLOCKSIZE;
+
+    // all the threads read the same value, so they all leave together
+    if(info[bid] != 0)
+        return;
+
+    T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+    T* X = load_ptr_batch<T>(XX, bid, shiftX, strideX);
+    S* rotc = rotcA + bid * int64_t(nb) * k;
+    T* rots = rotsA + bid * int64_t(nb) * k;
+    const int64_t ld = lda;
+
+    __shared__ S sc;
+    __shared__ T ss;
+    __shared__ bool failed;
+
+    // row of the diagonal block handled by this thread
+    const rocblas_int i = j0 + tid;
+
+    for(rocblas_int jj = 0; jj < jb; ++jj)
+    {
+        const rocblas_int j = j0 + jj;
+        T* Ljj = A + j + j * ld;
+        T* Lij = lower ? A + i + j * ld : A + j + i * ld;
+
+        for(rocblas_int p = 0; p < k; ++p)
+        {
+            T* Xp = X + p * int64_t(ldx);
+
+            if(tid == jj)
+            {
+                // (the diagonal can be negative when the factor is the R of a QR
+                // factorization; the new diagonal is always positive)
+                const S d = std::real(*Ljj);
+                const S ad = std::abs(d);
+                const T xj = Xp[j];
+                const S a = std::abs(xj);
+                S c = 0;
+                T s = 0;
+                failed = false;
+
+                if(DOWNDATE)
+                {
+                    // the downdated matrix is not positive definite
+                    if(!(a < ad))
+                    {
+                        info[bid] = j + 1;
+                        failed = true;
+                    }
+                    else
+                    {
+                        const S r = sqrt((ad - a) * (ad + a));
+                        c = r / d;
+                        s = conj(xj) / d;
+                        *Ljj = T(r);
+                    }
+                }
+                else
+                {
+                    const S r = std::hypot(d, a);
+                    c = d / r;
+                    s = conj(xj) / r;
+                    *Ljj = T(r);
+                }
+
+                if(!failed)
+                {
+                    Xp[j] = 0;
+                    rotc[jj + p * nb] = c;
+                    rots[jj + p * nb] = s;
+                }
+                sc = c;
+                ss = s;
+            }
+            __syncthreads();
+
+            if(failed)
+                return;
+
+            // apply the rotation to row i of the diagonal block
+            if(tid > jj && tid < jb)
+            {
+                const T l = lower ? *Lij : conj(*Lij);
+                const T x = Xp[i];
+                T lnew;
+                if(DOWNDATE)
+                {
+                    lnew = (l - ss * x) / sc;
+                    Xp[i] = sc * x - conj(ss) * lnew;
+                }
+                else
+                {
+                    lnew = sc * l + ss * x;
+                    Xp[i] = sc * x - conj(ss) * l;
+                }
+                *Lij = lower ? lnew : conj(lnew);
+            }
+            __syncthreads();
+        }
+    }
+}
+
+/** POTRF_UPDATE_APPLY_KERNEL applies the rotations generated by POTRF_UPDATE_ROTATIONS_KERNEL
+    for the jb columns starting at column j0 to the rows of the factor and of X below the diagonal
+    block. The rows are independent, so each thread applies all the rotations to its own row. **/
+template <bool DOWNDATE, typename T, typename S, typename U, typename V>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) potrf_update_apply_kernel(const rocblas_fill uplo,
+                                                                       const rocblas_int n,
+                                                                       const rocblas_int k,
+                                                                       const rocblas_int j0,
+                                                                       const rocblas_int jb,
+                                                                       U AA,
+                                                                       const rocblas_stride shiftA,
+                                                                       const rocblas_int lda,
+                                                                       const rocblas_stride strideA,
+                                                                       V XX,
+                                                                       const rocblas_stride shiftX,
+                                                                       const rocblas_int ldx,
+                                                                       const rocblas_stride strideX,
+                                                                       rocblas_int* info,
+                                                                       S* rotcA,
+                                                                       T* rotsA)
+{
+    const rocblas_int bid = hipBlockIdx_z;
+    const rocblas_int i = j0 + jb + hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const bool lower = (uplo == rocblas_fill_lower);
+    const rocblas_int nb = POTRF_UPDATE_BLOCKSIZE;
+
+    if(i >= n || info[bid] != 0)
+        return;
+
+    T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+    T* X = load_ptr_batch<T>(XX, bid, shiftX, strideX);
+    S* rotc = rotcA + bid * int64_t(nb) * k;
+    T* rots = rotsA + bid * int64_t(nb) * k;
+    const int64_t ld = lda;
+
+    for(rocblas_int jj = 0; jj < jb; ++jj)
+    {
+        const rocblas_int j = j0 + jj;
+        T* Lij = lower ? A + i + j * ld : A + j + i * ld;
+        T l = lower ? *Lij : conj(*Lij);
+
+        for(rocblas_int p = 0; p < k; ++p)
+        {
+            const S c = rotc[jj + p * nb];
+            const T s = rots[jj + p * nb];
+            T* x = X + i + p * int64_t(ldx);
+
+            if(DOWNDATE)
+            {
+                l = (l - s * (*x)) / c;
+                *x = c * (*x) - conj(s) * l;
+            }
+            else
+            {
+                const T lnew = c * l + s * (*x);
+                *x = c * (*x) - conj(s) * l;
+                l = lnew;
+            }
+        }
+
+        *Lij = lower ? l : conj(l);
+    }
+}
+
+template <typename T, typename S>
+void rocsolver_potrf_update_getMemorySize(const rocblas_int n,
+                                          const rocblas_int k,
+                                          const rocblas_int batch_count,
+                                          size_t* size_rotc,
+                                          size_t* size_rots)
+{
+    // if quick return no workspace needed
+    if(n == 0 || k == 0 || batch_count == 0)
+    {
+        *size_rotc = 0;
+        *size_rots = 0;
+        return;
+    }
+
+    // rotations of one block of columns of the factor
+    *size_rotc = sizeof(S) * POTRF_UPDATE_BLOCKSIZE * k * batch_count;
+    *size_rots = sizeof(T) * POTRF_UPDATE_BLOCKSIZE * k * batch_count;
+}
+
+template <typename T>
+rocblas_status rocsolver_potrf_update_argCheck(rocblas_handle handle,
+                                               const rocblas_fill uplo,
+                                               const rocblas_int n,
+                                               const rocblas_int k,
+                                               const rocblas_int lda,
+                                               const rocblas_int ldx,
+                                               T A,
+                                               T X,
+                                               rocblas_int* info,
+                                               const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(n < 0 || k < 0 || lda < n || ldx < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !A) || (n && k && !X) || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <bool DOWNDATE, typename T, typename S, typename U, typename V>
+rocblas_status rocsolver_potrf_update_template(rocblas_handle handle,
+                                               const rocblas_fill uplo,
+                                               const rocblas_int n,
+                                               const rocblas_int k,
+                                               U A,
+                                               const rocblas_stride shiftA,
+                                               const rocblas_int lda,
+                                               const rocblas_stride strideA,
+                                               V X,
+                                               const rocblas_stride shiftX,
+                                               const rocblas_int ldx,
+                                               const rocblas_stride strideX,
+                                               rocblas_int* info,
+                                               const rocblas_int batch_count,
+                                               S* rotc,
+                                               T* rots)
+{
+    const char* name = (DOWNDATE ? "potrf_downdate" : "potrf_update");
+    ROCSOLVER_ENTER(name, "uplo:", uplo, "n:", n, "k:", k, "shiftA:", shiftA, "lda:", lda,
+                    "shiftX:", shiftX, "ldx:", ldx, "bc:", batch_count);
+
+    // quick return if zero instances in batch
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // info = 0 unless a downdate fails
+    rocblas_int blocks = (batch_count - 1) / BS1 + 1;
+    ROCSOLVER_LAUNCH_KERNEL(reset_info, dim3(blocks, 1, 1), dim3(BS1, 1, 1), 0, stream, info,
+                            batch_count, 0);
+
+    // quick return if no dimensions
+    if(n == 0 || k == 0)
+        return rocblas_status_success;
+
+    const rocblas_int nb = POTRF_UPDATE_BLOCKSIZE;
+    for(rocblas_int j0 = 0; j0 < n; j0 += nb)
+    {
+        const rocblas_int jb = std::min(nb, n - j0);
+
+        ROCSOLVER_LAUNCH_KERNEL((potrf_update_rotations_kernel<DOWNDATE, T>),
+                                dim3(1, 1, batch_count), dim3(nb, 1, 1), 0, stream, uplo, n, k, j0,
+                                jb, A, shiftA, lda, strideA, X, shiftX, ldx, strideX, info, rotc,
+                                rots);
+
+        const rocblas_int nrows = n - j0 - jb;
+        if(nrows > 0)
+        {
+            blocks = (nrows - 1) / BS1 + 1;
+            ROCSOLVER_LAUNCH_KERNEL((potrf_update_apply_kernel<DOWNDATE, T>),
+                                    dim3(blocks, 1, batch_count), dim3(BS1, 1, 1), 0, stream, uplo,
+                                    n, k, j0, jb, A, shiftA, lda, strideA, X, shiftX, ldx, strideX,
+                                    info, rotc, rots);
+        }
+    }
+
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
@@ -0,0 +1,236 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "roclapack_potrf_update.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+template <bool DOWNDATE, typename T, typename U>
+rocblas_status rocsolver_potrf_update_strided_batched_impl(rocblas_handle handle,
+                                                           const rocblas_fill uplo,
+                                                           const rocblas_int n,
+                                                           const rocblas_int k,
+                                                           U A,
+                                                           const rocblas_int lda,
+                                                           const rocblas_stride strideA,
+                                                           U X,
+                                                           const rocblas_int ldx,
+                                                           const rocblas_stride strideX,
+                                                           rocblas_int* info,
+                                                           const rocblas_int batch_count)
+{
+    const char* name
+        = (DOWNDATE ? "potrf_downdate_strided_batched" : "potrf_update_strided_batched");
+    ROCSOLVER_ENTER_TOP(name, "--uplo", uplo, "-n", n, "-k", k, "--lda", lda, "--strideA", strideA,
+                        "--ldx", ldx, "--strideX", strideX, "--batch_count", batch_count);
+    ROCSOLVER_INFO_SUMMARY(info, batch_count);
+
+    using S = decltype(std::real(T{}));
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_potrf_update_argCheck(handle, uplo, n, k, lda, ldx, A, X, info,
+                                                        batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_stride shiftA = 0;
+    rocblas_stride shiftX = 0;
+
+    // memory workspace sizes:
+    // size of the rotations generated for one block of columns
+    size_t size_rotc, size_rots;
+    rocsolver_potrf_update_getMemorySize<T, S>(n, k, batch_count, &size_rotc, &size_rots);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_rotc, size_rots);
+
+    // memory workspace allocation
+    void *rotc, *rots;
+    rocblas_device_malloc mem(handle, size_rotc, size_rots);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    rotc = mem[0];
+    rots = mem[1];
+
+    // execution
+    return _info_summary_scope.commit(rocsolver_potrf_update_template<DOWNDATE, T>(
+        handle, uplo, n, k, A, shiftA, lda, strideA, X, shiftX, ldx, strideX, info, batch_count,
+        (S*)rotc, (T*)rots));
+}
+
+ROCSOLVER_END_NAMESPACE
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_spotrf_update_strided_batched(rocblas_handle handle,
+                                                       const rocblas_fill uplo,
+                                                       const rocblas_int n,
+                                                       const rocblas_int k,
+                                                       float* A,
+                                                       const rocblas_int lda,
+                                                       const rocblas_stride strideA,
+                                                       float* X,
+                                                       const rocblas_int ldx,
+                                                       const rocblas_stride strideX,
+                                                       rocblas_int* info,
+                                                       const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_potrf_update_strided_batched_impl<false, float>(
+        handle, uplo, n, k, A, lda, strideA, X, ldx, strideX, info, batch_count);
+}
+
+rocblas_status rocsolver_dpotrf_update_strided_batched(rocblas_handle handle,
+                                                       const rocblas_fill uplo,
+                                                       const rocblas_int n,
+                                                       const rocblas_int k,
+                                                       double* A,
+                                                       const rocblas_int lda,
+                                                       const rocblas_stride strideA,
+                                                       double* X,
+                                                       const rocblas_int ldx,
+                                                       const rocblas_stride strideX,
+                                                       rocblas_int* info,
+                                                       const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_potrf_update_strided_batched_impl<false, double>(
+        handle, uplo, n, k, A, lda, strideA, X, ldx, strideX, info, batch_count);
+}
+
+rocblas_status rocsolver_cpotrf_update_strided_batched(rocblas_handle handle,
+                                                       const rocblas_fill uplo,
+                                                       const rocblas_int n,
+                                                       const rocblas_int k,
+                                                       rocblas_float_complex* A,
+                                                       const rocblas_int lda,
+                                                       const rocblas_stride strideA,
+                                                       rocblas_float_complex* X,
+                                                       const rocblas_int ldx,
+                                                       const rocblas_stride strideX,
+                                                       rocblas_int* info,
+                                                       const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_potrf_update_strided_batched_impl<false, rocblas_float_complex>(
+        handle, uplo, n, k, A, lda, strideA, X, ldx, strideX, info, batch_count);
+}
+
+rocblas_status rocsolver_zpotrf_update_strided_batched(rocblas_handle handle,
+                                                       const rocblas_fill uplo,
+                                                       const rocblas_int n,
+                                                       const rocblas_int k,
+                                                       rocblas_double_complex* A,
+                                                       const rocblas_int lda,
+                                                       const rocblas_stride strideA,
+                                                       rocblas_double_complex* X,
+                                                       const rocblas_int ldx,
+                                                       const rocblas_stride strideX,
+                                                       rocblas_int* info,
+                                                       const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_potrf_update_strided_batched_impl<false, rocblas_double_complex>(
+        handle, uplo, n, k, A, lda, strideA, X, ldx, strideX, info, batch_count);
+}
+
+rocblas_status rocsolver_spotrf_downdate_strided_batched(rocblas_handle handle,
+                                                         const rocblas_fill uplo,
+                                                         const rocblas_int n,
+                                                         const rocblas_int k,
+                                                         float* A,
+                                                         const rocblas_int lda,
+                                                         const rocblas_stride strideA,
+                                                         float* X,
+                                                         const rocblas_int ldx,
+                                                         const rocblas_stride strideX,
+                                                         rocblas_int* info,
+                                                         const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_potrf_update_strided_batched_impl<true, float>(
+        handle, uplo, n, k, A, lda, strideA, X, ldx, strideX, info, batch_count);
+}
+
+rocblas_status rocsolver_dpotrf_downdate_strided_batched(rocblas_handle handle,
+                                                         const rocblas_fill uplo,
+                                                         const rocblas_int n,
+                                                         const rocblas_int k,
+                                                         double* A,
+                                                         const rocblas_int lda,
+                                                         const rocblas_stride strideA,
+                                                         double* X,
+                                                         const rocblas_int ldx,
+                                                         const rocblas_stride strideX,
+                                                         rocblas_int* info,
+                                                         const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_potrf_update_strided_batched_impl<true, double>(
+        handle, uplo, n, k, A, lda, strideA, X, ldx, strideX, info, batch_count);
+}
+
+rocblas_status rocsolver_cpotrf_downdate_strided_batched(rocblas_handle handle,
+                                                         const rocblas_fill uplo,
+                                                         const rocblas_int n,
+                                                         const rocblas_int k,
+                                                         rocblas_float_complex* A,
+                                                         const rocblas_int lda,
+                                                         const rocblas_stride strideA,
+                                                         rocblas_float_complex* X,
+                                                         const rocblas_int ldx,
+                                                         const rocblas_stride strideX,
+                                                         rocblas_int* info,
+                                                         const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_potrf_update_strided_batched_impl<true, rocblas_float_complex>(
+        handle, uplo, n, k, A, lda, strideA, X, ldx, strideX, info, batch_count);
+}
+
+rocblas_status rocsolver_zpotrf_downdate_strided_batched(rocblas_handle handle,
+                                                         const rocblas_fill uplo,
+                                                         const rocblas_int n,
+                                                         const rocblas_int k,
+                                                         rocblas_double_complex* A,
+                                                         const rocblas_int lda,
+                                                         const rocblas_stride strideA,
+                                                         rocblas_double_complex* X,
+                                                         const rocblas_int ldx,
+                                                         const rocblas_stride strideX,
+                                                         rocblas_int* info,
+                                                         const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_potrf_update_strided_batched_impl<true, rocblas_double_complex>(
+        handle, uplo, n, k, A, lda, strideA, X, ldx, strideX, info, batch_count);
+}
+} // extern C
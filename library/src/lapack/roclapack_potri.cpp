@@ -38,6 +38,7 @@ rocblas_status rocsolver_potri_impl(rocblas_handle handle,
                                     rocblas_int* info)
 {
     ROCSOLVER_ENTER_TOP("potri", "--uplo", uplo, "-n", n, "--lda", lda);
+    ROCSOLVER_INFO_SUMMARY(info, 1);
 
     if(!handle)
         return rocblas_status_invalid_handle;
@@ -84,9 +85,9 @@ rocblas_status rocsolver_potri_impl(rocblas_handle handle,
     workArr = mem[5];
 
     // execution
-    return rocsolver_potri_template<false, false, T>(handle, uplo, n, A, shiftA, lda, strideA, info,
-                                                     batch_count, work1, work2, work3, work4,
-                                                     (T*)tmpcopy, (T**)workArr, optim_mem);
+    return _info_summary_scope.commit(rocsolver_potri_template<false, false, T>(
+        handle, uplo, n, A, shiftA, lda, strideA, info, batch_count, work1, work2, work3, work4,
+        (T*)tmpcopy, (T**)workArr, optim_mem));
 }
 
 ROCSOLVER_END_NAMESPACE
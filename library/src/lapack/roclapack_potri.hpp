@@ -32,6 +32,7 @@
 
 #pragma once
 
+#include "auxiliary/rocauxiliary_lauum.hpp"
 #include "rocblas.hpp"
 #include "roclapack_trtri.hpp"
 #include "rocsolver/rocsolver.h"
@@ -69,6 +70,14 @@ void rocsolver_potri_getMemorySize(const rocblas_int n,
 
     // required space to copy A
     *size_tmpcopy = std::max(*size_tmpcopy, sizeof(T) * n * n * batch_count);
+
+    // requirements for the recursive product
+    if(n > LAUUM_RECURSIVE_SWITCHSIZE)
+    {
+        size_t w;
+        rocsolver_lauum_getMemorySize<T>(n, batch_count, &w);
+        *size_work1 = std::max(*size_work1, w);
+    }
 }
 
 template <typename T>
@@ -158,10 +167,18 @@ rocblas_status rocsolver_potri_template(rocblas_handle handle,
                             no_mask{}, uplo);
 
     // compute inv(U) * inv(U)' or inv(L)' * inv(L) and store in tmpcopy
-    rocblas_side side = (uplo == rocblas_fill_upper ? rocblas_side_right : rocblas_side_left);
-    rocblasCall_trmm(handle, side, uplo, rocblas_operation_conjugate_transpose,
-                     rocblas_diagonal_non_unit, n, n, &one, 0, A, shiftA, lda, strideA, tmpcopy, 0,
-                     n, n * n, batch_count, workArr);
+    if(n > LAUUM_RECURSIVE_SWITCHSIZE)
+    {
+        // large sizes: recursive product on the copy, dominated by HERK and TRMM
+        lauum_recursive<false, T>(handle, uplo, n, tmpcopy, 0, n, n * n, batch_count, (T*)work1);
+    }
+    else
+    {
+        rocblas_side side = (uplo == rocblas_fill_upper ? rocblas_side_right : rocblas_side_left);
+        rocblasCall_trmm(handle, side, uplo, rocblas_operation_conjugate_transpose,
+                         rocblas_diagonal_non_unit, n, n, &one, 0, A, shiftA, lda, strideA, tmpcopy,
+                         0, n, n * n, batch_count, workArr);
+    }
 
     // copy elements of tmpcopy into A in cases where info is zero
     ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, dim3(copyblocks, copyblocks, batch_count), dim3(32, 32), 0,
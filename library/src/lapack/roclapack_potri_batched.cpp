@@ -40,6 +40,7 @@ rocblas_status rocsolver_potri_batched_impl(rocblas_handle handle,
 {
     ROCSOLVER_ENTER_TOP("potri_batched", "--uplo", uplo, "-n", n, "--lda", lda, "--batch_count",
                         batch_count);
+    ROCSOLVER_INFO_SUMMARY(info, batch_count);
 
     if(!handle)
         return rocblas_status_invalid_handle;
@@ -85,9 +86,9 @@ rocblas_status rocsolver_potri_batched_impl(rocblas_handle handle,
     workArr = mem[5];
 
     // execution
-    return rocsolver_potri_template<true, false, T>(handle, uplo, n, A, shiftA, lda, strideA, info,
-                                                    batch_count, work1, work2, work3, work4,
-                                                    (T*)tmpcopy, (T**)workArr, optim_mem);
+    return _info_summary_scope.commit(rocsolver_potri_template<true, false, T>(
+        handle, uplo, n, A, shiftA, lda, strideA, info, batch_count, work1, work2, work3, work4,
+        (T*)tmpcopy, (T**)workArr, optim_mem));
 }
 
 ROCSOLVER_END_NAMESPACE
@@ -41,6 +41,7 @@ rocblas_status rocsolver_potri_strided_batched_impl(rocblas_handle handle,
 {
     ROCSOLVER_ENTER_TOP("potri_strided_batched", "--uplo", uplo, "-n", n, "--lda", lda, "--strideA",
                         strideA, "--batch_count", batch_count);
+    ROCSOLVER_INFO_SUMMARY(info, batch_count);
 
     if(!handle)
         return rocblas_status_invalid_handle;
@@ -83,9 +84,9 @@ rocblas_status rocsolver_potri_strided_batched_impl(rocblas_handle handle,
     workArr = mem[5];
 
     // execution
-    return rocsolver_potri_template<false, true, T>(handle, uplo, n, A, shiftA, lda, strideA, info,
-                                                    batch_count, work1, work2, work3, work4,
-                                                    (T*)tmpcopy, (T**)workArr, optim_mem);
+    return _info_summary_scope.commit(rocsolver_potri_template<false, true, T>(
+        handle, uplo, n, A, shiftA, lda, strideA, info, batch_count, work1, work2, work3, work4,
+        (T*)tmpcopy, (T**)workArr, optim_mem));
 }
 
 ROCSOLVER_END_NAMESPACE
@@ -26,37 +26,44 @@
  * *************************************************************************/
 
 #include "roclapack_potrs.hpp"
+#include "rocsolver_check_mode.hpp"
 
 ROCSOLVER_BEGIN_NAMESPACE
 
-template <typename T>
+template <typename T, typename I>
 rocblas_status rocsolver_potrs_impl(rocblas_handle handle,
                                     const rocblas_fill uplo,
-                                    const rocblas_int n,
-                                    const rocblas_int nrhs,
+                                    const I n,
+                                    const I nrhs,
                                     T* A,
-                                    const rocblas_int lda,
+                                    const I lda,
                                     T* B,
-                                    const rocblas_int ldb)
+                                    const I ldb)
 {
     ROCSOLVER_ENTER_TOP("potrs", "--uplo", uplo, "-n", n, "--nrhs", nrhs, "--lda", lda, "--ldb", ldb);
 
     if(!handle)
         return rocblas_status_invalid_handle;
 
-    // argument checking
-    rocblas_status st = rocsolver_potrs_argCheck(handle, uplo, n, nrhs, lda, ldb, A, B);
-    if(st != rocblas_status_continue)
-        return st;
+    // argument checking (unless disabled with rocsolver_set_check_mode)
+    if(!skip_arg_checks(handle))
+    {
+        rocblas_status st = rocsolver_potrs_argCheck(handle, uplo, n, nrhs, lda, ldb, A, B);
+        if(st != rocblas_status_continue)
+            return st;
+    }
+
+    // nominal flop count for the call statistics
+    rocsolver_stats_flops(rocsolver_potrs_flops<T>(n, nrhs));
 
     // working with unshifted arrays
-    rocblas_int shiftA = 0;
-    rocblas_int shiftB = 0;
+    rocblas_stride shiftA = 0;
+    rocblas_stride shiftB = 0;
 
     // normal (non-batched non-strided) execution
     rocblas_stride strideA = 0;
     rocblas_stride strideB = 0;
-    rocblas_int batch_count = 1;
+    I batch_count = 1;
 
     // memory workspace sizes:
     // size of workspace (for calling TRSM)
@@ -144,3 +151,69 @@ extern "C" rocblas_status rocsolver_zpotrs(rocblas_handle handle,
     return rocsolver::rocsolver_potrs_impl<rocblas_double_complex>(handle, uplo, n, nrhs, A, lda, B,
                                                                    ldb);
 }
+
+extern "C" rocblas_status rocsolver_spotrs_64(rocblas_handle handle,
+                                              const rocblas_fill uplo,
+                                              const int64_t n,
+                                              const int64_t nrhs,
+                                              float* A,
+                                              const int64_t lda,
+                                              float* B,
+                                              const int64_t ldb)
+{
+#ifdef HAVE_ROCBLAS_64
+    return rocsolver::rocsolver_potrs_impl<float>(handle, uplo, n, nrhs, A, lda, B, ldb);
+#else
+    return rocblas_status_not_implemented;
+#endif
+}
+
+extern "C" rocblas_status rocsolver_dpotrs_64(rocblas_handle handle,
+                                              const rocblas_fill uplo,
+                                              const int64_t n,
+                                              const int64_t nrhs,
+                                              double* A,
+                                              const int64_t lda,
+                                              double* B,
+                                              const int64_t ldb)
+{
+#ifdef HAVE_ROCBLAS_64
+    return rocsolver::rocsolver_potrs_impl<double>(handle, uplo, n, nrhs, A, lda, B, ldb);
+#else
+    return rocblas_status_not_implemented;
+#endif
+}
+
+extern "C" rocblas_status rocsolver_cpotrs_64(rocblas_handle handle,
+                                              const rocblas_fill uplo,
+                                              const int64_t n,
+                                              const int64_t nrhs,
+                                              rocblas_float_complex* A,
+                                              const int64_t lda,
+                                              rocblas_float_complex* B,
+                                              const int64_t ldb)
+{
+#ifdef HAVE_ROCBLAS_64
+    return rocsolver::rocsolver_potrs_impl<rocblas_float_complex>(handle, uplo, n, nrhs, A, lda, B,
+                                                                  ldb);
+#else
+    return rocblas_status_not_implemented;
+#endif
+}
+
+extern "C" rocblas_status rocsolver_zpotrs_64(rocblas_handle handle,
+                                              const rocblas_fill uplo,
+                                              const int64_t n,
+                                              const int64_t nrhs,
+                                              rocblas_double_complex* A,
+                                              const int64_t lda,
+                                              rocblas_double_complex* B,
+                                              const int64_t ldb)
+{
+#ifdef HAVE_ROCBLAS_64
+    return rocsolver::rocsolver_potrs_impl<rocblas_double_complex>(handle, uplo, n, nrhs, A, lda, B,
+                                                                   ldb);
+#else
+    return rocblas_status_not_implemented;
+#endif
+}
@@ -4,7 +4,7 @@
  *     Univ. of Tennessee, Univ. of California Berkeley,
  *     Univ. of Colorado Denver and NAG Ltd..
  *     December 2016
- * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions
@@ -38,16 +38,18 @@
 
 ROCSOLVER_BEGIN_NAMESPACE
 
-template <typename T>
+template <typename T, typename I>
 rocblas_status rocsolver_potrs_argCheck(rocblas_handle handle,
                                         const rocblas_fill uplo,
-                                        const rocblas_int n,
-                                        const rocblas_int nrhs,
-                                        const rocblas_int lda,
-                                        const rocblas_int ldb,
+                                        const I n,
+                                        const I nrhs,
+                                        const I lda,
+                                        const I ldb,
                                         T A,
                                         T B,
-                                        const rocblas_int batch_count = 1)
+                                        const I batch_count = 1,
+                                        const I inca = 1,
+                                        const I incb = 1)
 {
     // order is important for unit tests:
 
@@ -56,7 +58,8 @@ rocblas_status rocsolver_potrs_argCheck(rocblas_handle handle,
         return rocblas_status_invalid_value;
 
     // 2. invalid size
-    if(n < 0 || nrhs < 0 || lda < n || ldb < n || batch_count < 0)
+    if(n < 0 || nrhs < 0 || inca < 1 || lda < inca * n || incb < 1 || ldb < incb * n
+       || batch_count < 0)
         return rocblas_status_invalid_size;
 
     // skip pointer check if querying memory size
@@ -70,10 +73,10 @@ rocblas_status rocsolver_potrs_argCheck(rocblas_handle handle,
     return rocblas_status_continue;
 }
 
-template <bool BATCHED, bool STRIDED, typename T>
-void rocsolver_potrs_getMemorySize(const rocblas_int n,
-                                   const rocblas_int nrhs,
-                                   const rocblas_int batch_count,
+template <bool BATCHED, bool STRIDED, typename T, typename I>
+void rocsolver_potrs_getMemorySize(const I n,
+                                   const I nrhs,
+                                   const I batch_count,
                                    size_t* size_work1,
                                    size_t* size_work2,
                                    size_t* size_work3,
@@ -95,12 +98,12 @@ void rocsolver_potrs_getMemorySize(const rocblas_int n,
     // call with both rocblas_operation_none and rocblas_operation_conjugate_transpose and take maximum memory
     size_t size_work1_temp1, size_work1_temp2, size_work2_temp1, size_work2_temp2, size_work3_temp1,
         size_work3_temp2, size_work4_temp1, size_work4_temp2;
-    rocsolver_trsm_mem<BATCHED, STRIDED, T>(rocblas_side_left, rocblas_operation_none, n, nrhs,
-                                            batch_count, &size_work1_temp1, &size_work2_temp1,
-                                            &size_work3_temp1, &size_work4_temp1, optim_mem);
-    rocsolver_trsm_mem<BATCHED, STRIDED, T>(
-        rocblas_side_left, rocblas_operation_conjugate_transpose, n, nrhs, batch_count,
-        &size_work1_temp2, &size_work2_temp2, &size_work3_temp2, &size_work4_temp2, optim_mem);
+    rocsolver_trsm_left_invdiag_mem<BATCHED, STRIDED, T>(
+        rocblas_operation_none, n, nrhs, batch_count, &size_work1_temp1, &size_work2_temp1,
+        &size_work3_temp1, &size_work4_temp1, optim_mem);
+    rocsolver_trsm_left_invdiag_mem<BATCHED, STRIDED, T>(
+        rocblas_operation_conjugate_transpose, n, nrhs, batch_count, &size_work1_temp2,
+        &size_work2_temp2, &size_work3_temp2, &size_work4_temp2, optim_mem);
 
     *size_work1 = std::max(size_work1_temp1, size_work1_temp2);
     *size_work2 = std::max(size_work2_temp1, size_work2_temp2);
@@ -108,20 +111,20 @@ void rocsolver_potrs_getMemorySize(const rocblas_int n,
     *size_work4 = std::max(size_work4_temp1, size_work4_temp2);
 }
 
-template <bool BATCHED, bool STRIDED, typename T, typename U>
+template <bool BATCHED, bool STRIDED, typename T, typename I, typename U>
 rocblas_status rocsolver_potrs_template(rocblas_handle handle,
                                         const rocblas_fill uplo,
-                                        const rocblas_int n,
-                                        const rocblas_int nrhs,
+                                        const I n,
+                                        const I nrhs,
                                         U A,
-                                        const rocblas_int shiftA,
-                                        const rocblas_int lda,
+                                        const rocblas_stride shiftA,
+                                        const I lda,
                                         const rocblas_stride strideA,
                                         U B,
-                                        const rocblas_int shiftB,
-                                        const rocblas_int ldb,
+                                        const rocblas_stride shiftB,
+                                        const I ldb,
                                         const rocblas_stride strideB,
-                                        const rocblas_int batch_count,
+                                        const I batch_count,
                                         void* work1,
                                         void* work2,
                                         void* work3,
@@ -146,34 +149,281 @@ rocblas_status rocsolver_potrs_template(rocblas_handle handle,
     if(uplo == rocblas_fill_upper)
     {
         // solve U'*X = B, overwriting B with X
-        rocsolver_trsm_upper<BATCHED, STRIDED, T>(
-            handle, rocblas_side_left, rocblas_operation_conjugate_transpose,
-            rocblas_diagonal_non_unit, n, nrhs, A, shiftA, lda, strideA, B, shiftB, ldb, strideB,
-            batch_count, optim_mem, work1, work2, work3, work4);
+        rocsolver_trsm_left_invdiag<BATCHED, STRIDED, T, I>(
+            handle, uplo, rocblas_operation_conjugate_transpose, rocblas_diagonal_non_unit, n, nrhs,
+            A, shiftA, 1, lda, strideA, B, shiftB, 1, ldb, strideB, batch_count, optim_mem, work1,
+            work2, work3, work4);
 
         // solve U*X = B, overwriting B with X
-        rocsolver_trsm_upper<BATCHED, STRIDED, T>(handle, rocblas_side_left, rocblas_operation_none,
-                                                  rocblas_diagonal_non_unit, n, nrhs, A, shiftA,
-                                                  lda, strideA, B, shiftB, ldb, strideB, batch_count,
-                                                  optim_mem, work1, work2, work3, work4);
+        rocsolver_trsm_left_invdiag<BATCHED, STRIDED, T, I>(
+            handle, uplo, rocblas_operation_none, rocblas_diagonal_non_unit, n, nrhs, A, shiftA, 1,
+            lda, strideA, B, shiftB, 1, ldb, strideB, batch_count, optim_mem, work1, work2, work3,
+            work4);
     }
     else
     {
         // solve L*X = B, overwriting B with X
-        rocsolver_trsm_lower<BATCHED, STRIDED, T>(handle, rocblas_side_left, rocblas_operation_none,
-                                                  rocblas_diagonal_non_unit, n, nrhs, A, shiftA,
-                                                  lda, strideA, B, shiftB, ldb, strideB, batch_count,
-                                                  optim_mem, work1, work2, work3, work4);
+        rocsolver_trsm_left_invdiag<BATCHED, STRIDED, T, I>(
+            handle, uplo, rocblas_operation_none, rocblas_diagonal_non_unit, n, nrhs, A, shiftA, 1,
+            lda, strideA, B, shiftB, 1, ldb, strideB, batch_count, optim_mem, work1, work2, work3,
+            work4);
 
         // solve L'*X = B, overwriting B with X
-        rocsolver_trsm_lower<BATCHED, STRIDED, T>(
-            handle, rocblas_side_left, rocblas_operation_conjugate_transpose,
-            rocblas_diagonal_non_unit, n, nrhs, A, shiftA, lda, strideA, B, shiftB, ldb, strideB,
-            batch_count, optim_mem, work1, work2, work3, work4);
+        rocsolver_trsm_left_invdiag<BATCHED, STRIDED, T, I>(
+            handle, uplo, rocblas_operation_conjugate_transpose, rocblas_diagonal_non_unit, n, nrhs,
+            A, shiftA, 1, lda, strideA, B, shiftB, 1, ldb, strideB, batch_count, optim_mem, work1,
+            work2, work3, work4);
     }
 
     rocblas_set_pointer_mode(handle, old_mode);
     return rocblas_status_success;
 }
 
+/** POTRS_INTERLEAVED_KERNEL solves the system of one matrix of the batch per thread,
+    working directly in global memory. It is meant for interleaved batches (inca = incb =
+    batch_count and strideA = strideB = 1), where all the accesses of a wavefront are
+    coalesced. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void potrs_interleaved_kernel(const rocblas_fill uplo,
+                                               const rocblas_int n,
+                                               const rocblas_int nrhs,
+                                               U AA,
+                                               const rocblas_stride shiftA,
+                                               const rocblas_int inca,
+                                               const rocblas_int lda,
+                                               const rocblas_stride strideA,
+                                               U BB,
+                                               const rocblas_stride shiftB,
+                                               const rocblas_int incb,
+                                               const rocblas_int ldb,
+                                               const rocblas_stride strideB,
+                                               const rocblas_int batch_count)
+{
+    rocblas_int b = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    if(b >= batch_count)
+        return;
+
+    T* A = load_ptr_batch<T>(AA, b, shiftA, strideA);
+    T* B = load_ptr_batch<T>(BB, b, shiftB, strideB);
+    const int64_t ia = inca;
+    const int64_t la = lda;
+    const int64_t ib = incb;
+    const int64_t lb = ldb;
+
+    // the factor is L = U' when uplo is upper; element (i,j) of L is
+    // A(i,j) if uplo is lower, or conj(A(j,i)) if uplo is upper
+    const bool lower = (uplo == rocblas_fill_lower);
+
+    for(rocblas_int c = 0; c < nrhs; ++c)
+    {
+        // forward substitution with L
+        for(rocblas_int k = 0; k < n; ++k)
+        {
+            const T bk = B[k * ib + c * lb] / std::real(A[k * ia + k * la]);
+            B[k * ib + c * lb] = bk;
+            for(rocblas_int i = k + 1; i < n; ++i)
+            {
+                const T lik = lower ? A[i * ia + k * la] : conj(A[k * ia + i * la]);
+                B[i * ib + c * lb] -= lik * bk;
+            }
+        }
+
+        // backward substitution with L'
+        for(rocblas_int k = n - 1; k >= 0; --k)
+        {
+            const T bk = B[k * ib + c * lb] / std::real(A[k * ia + k * la]);
+            B[k * ib + c * lb] = bk;
+            for(rocblas_int i = 0; i < k; ++i)
+            {
+                const T lki = lower ? A[k * ia + i * la] : conj(A[i * ia + k * la]);
+                B[i * ib + c * lb] -= conj(lki) * bk;
+            }
+        }
+    }
+}
+
+template <typename T, typename U>
+rocblas_status rocsolver_potrs_interleaved_template(rocblas_handle handle,
+                                                    const rocblas_fill uplo,
+                                                    const rocblas_int n,
+                                                    const rocblas_int nrhs,
+                                                    U A,
+                                                    const rocblas_stride shiftA,
+                                                    const rocblas_int inca,
+                                                    const rocblas_int lda,
+                                                    const rocblas_stride strideA,
+                                                    U B,
+                                                    const rocblas_stride shiftB,
+                                                    const rocblas_int incb,
+                                                    const rocblas_int ldb,
+                                                    const rocblas_stride strideB,
+                                                    const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER("potrs_interleaved", "uplo:", uplo, "n:", n, "nrhs:", nrhs, "shiftA:", shiftA,
+                    "inca:", inca, "lda:", lda, "shiftB:", shiftB, "incb:", incb, "ldb:", ldb,
+                    "bc:", batch_count);
+
+    // quick return
+    if(n == 0 || nrhs == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocks = (batch_count - 1) / BS1 + 1;
+    ROCSOLVER_LAUNCH_KERNEL((potrs_interleaved_kernel<T, U>), dim3(blocks, 1, 1), dim3(BS1, 1, 1),
+                            0, stream, uplo, n, nrhs, A, shiftA, inca, lda, strideA, B, shiftB,
+                            incb, ldb, strideB, batch_count);
+
+    return rocblas_status_success;
+}
+
+/** POTRS_VBATCHED_KERNEL solves the systems of a variable-size batch whose size n is in
+    (lo, hi]. Each system is processed by a thread block working directly in global memory,
+    with every thread in charge of the rows i = tid + k * hipBlockDim_x of B. The other
+    thread blocks return immediately. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(VBATCHED_MAX_BIN)
+    potrs_vbatched_kernel(const rocblas_fill uplo,
+                          const rocblas_int* nn,
+                          const rocblas_int* nnrhs,
+                          U AA,
+                          const rocblas_int* ldaa,
+                          U BB,
+                          const rocblas_int* ldbb,
+                          const rocblas_int lo,
+                          const rocblas_int hi)
+{
+    const rocblas_int b = hipBlockIdx_x;
+    const rocblas_int tid = hipThreadIdx_x;
+    const rocblas_int nthds = hipBlockDim_x;
+
+    const rocblas_int n = nn[b];
+    const rocblas_int nrhs = nnrhs[b];
+    const rocblas_int lda = ldaa[b];
+    const rocblas_int ldb = ldbb[b];
+    const rocblas_int size = std::max(n, 1);
+    if(size <= lo || size > hi)
+        return;
+
+    // empty or invalid instances are quick returns
+    if(n <= 0 || nrhs <= 0 || lda < n || ldb < n)
+        return;
+
+    T* A = load_ptr_batch<T>(AA, b, 0, 0);
+    T* B = load_ptr_batch<T>(BB, b, 0, 0);
+    const int64_t la = lda;
+    const int64_t lb = ldb;
+
+    // the factor is L = U' when uplo is upper; element (i,j) of L is
+    // A(i,j) if uplo is lower, or conj(A(j,i)) if uplo is upper
+    const bool lower = (uplo == rocblas_fill_lower);
+
+    // forward substitution with L
+    for(rocblas_int k = 0; k < n; ++k)
+    {
+        if(k % nthds == tid)
+        {
+            const auto akk = std::real(A[k + k * la]);
+            for(rocblas_int c = 0; c < nrhs; ++c)
+                B[k + c * lb] = B[k + c * lb] / akk;
+        }
+        __syncthreads();
+
+        for(rocblas_int i = k + 1 + tid; i < n; i += nthds)
+        {
+            const T lik = lower ? A[i + k * la] : conj(A[k + i * la]);
+            for(rocblas_int c = 0; c < nrhs; ++c)
+                B[i + c * lb] -= lik * B[k + c * lb];
+        }
+    }
+
+    // backward substitution with L'
+    for(rocblas_int k = n - 1; k >= 0; --k)
+    {
+        if(k % nthds == tid)
+        {
+            const auto akk = std::real(A[k + k * la]);
+            for(rocblas_int c = 0; c < nrhs; ++c)
+                B[k + c * lb] = B[k + c * lb] / akk;
+        }
+        __syncthreads();
+
+        for(rocblas_int i = tid; i < k; i += nthds)
+        {
+            const T lki = lower ? A[k + i * la] : conj(A[i + k * la]);
+            for(rocblas_int c = 0; c < nrhs; ++c)
+                B[i + c * lb] -= conj(lki) * B[k + c * lb];
+        }
+    }
+}
+
+template <typename T, typename U>
+rocblas_status rocsolver_potrs_vbatched_argCheck(rocblas_handle handle,
+                                                 const rocblas_fill uplo,
+                                                 const rocblas_int* n,
+                                                 const rocblas_int* nrhs,
+                                                 U A,
+                                                 const rocblas_int* lda,
+                                                 U B,
+                                                 const rocblas_int* ldb,
+                                                 const rocblas_int batch_count)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    // (the sizes of the instances are only known on the device)
+    if(batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if(batch_count && (!n || !nrhs || !A || !lda || !B || !ldb))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T, typename U>
+rocblas_status rocsolver_potrs_vbatched_template(rocblas_handle handle,
+                                                 const rocblas_fill uplo,
+                                                 const rocblas_int* n,
+                                                 const rocblas_int* nrhs,
+                                                 U A,
+                                                 const rocblas_int* lda,
+                                                 U B,
+                                                 const rocblas_int* ldb,
+                                                 const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER("potrs_vbatched", "uplo:", uplo, "bc:", batch_count);
+
+    // quick return if zero instances in batch
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    dim3 grid(batch_count, 1, 1);
+
+    // one launch per size bin
+    for(rocblas_int bin = VBATCHED_MIN_BIN; bin <= VBATCHED_MAX_BIN; bin *= 2)
+    {
+        rocblas_int lo = (bin == VBATCHED_MIN_BIN) ? 0 : bin / 2;
+        rocblas_int hi = (bin == VBATCHED_MAX_BIN) ? INT_MAX : bin;
+
+        ROCSOLVER_LAUNCH_KERNEL((potrs_vbatched_kernel<T, U>), grid, dim3(bin, 1, 1), 0, stream,
+                                uplo, n, nrhs, A, lda, B, ldb, lo, hi);
+    }
+
+    return rocblas_status_success;
+}
+
 ROCSOLVER_END_NAMESPACE
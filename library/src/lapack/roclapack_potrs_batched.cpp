@@ -26,19 +26,20 @@
  * *************************************************************************/
 
 #include "roclapack_potrs.hpp"
+#include "rocsolver_check_mode.hpp"
 
 ROCSOLVER_BEGIN_NAMESPACE
 
-template <typename T, typename U>
+template <typename T, typename I, typename U>
 rocblas_status rocsolver_potrs_batched_impl(rocblas_handle handle,
                                             const rocblas_fill uplo,
-                                            const rocblas_int n,
-                                            const rocblas_int nrhs,
+                                            const I n,
+                                            const I nrhs,
                                             U A,
-                                            const rocblas_int lda,
+                                            const I lda,
                                             U B,
-                                            const rocblas_int ldb,
-                                            const rocblas_int batch_count)
+                                            const I ldb,
+                                            const I batch_count)
 {
     ROCSOLVER_ENTER_TOP("potrs_batched", "--uplo", uplo, "-n", n, "--nrhs", nrhs, "--lda", lda,
                         "--ldb", ldb, "--batch_count", batch_count);
@@ -46,14 +47,21 @@ rocblas_status rocsolver_potrs_batched_impl(rocblas_handle handle,
     if(!handle)
         return rocblas_status_invalid_handle;
 
-    // argument checking
-    rocblas_status st = rocsolver_potrs_argCheck(handle, uplo, n, nrhs, lda, ldb, A, B, batch_count);
-    if(st != rocblas_status_continue)
-        return st;
+    // argument checking (unless disabled with rocsolver_set_check_mode)
+    if(!skip_arg_checks(handle))
+    {
+        rocblas_status st
+            = rocsolver_potrs_argCheck(handle, uplo, n, nrhs, lda, ldb, A, B, batch_count);
+        if(st != rocblas_status_continue)
+            return st;
+    }
+
+    // nominal flop count for the call statistics
+    rocsolver_stats_flops(batch_count * rocsolver_potrs_flops<T>(n, nrhs));
 
     // working with unshifted arrays
-    rocblas_int shiftA = 0;
-    rocblas_int shiftB = 0;
+    rocblas_stride shiftA = 0;
+    rocblas_stride shiftB = 0;
 
     // batched execution
     rocblas_stride strideA = 0;
@@ -151,3 +159,75 @@ extern "C" rocblas_status rocsolver_zpotrs_batched(rocblas_handle handle,
     return rocsolver::rocsolver_potrs_batched_impl<rocblas_double_complex>(handle, uplo, n, nrhs, A,
                                                                            lda, B, ldb, batch_count);
 }
+
+extern "C" rocblas_status rocsolver_spotrs_batched_64(rocblas_handle handle,
+                                                      const rocblas_fill uplo,
+                                                      const int64_t n,
+                                                      const int64_t nrhs,
+                                                      float* const A[],
+                                                      const int64_t lda,
+                                                      float* const B[],
+                                                      const int64_t ldb,
+                                                      const int64_t batch_count)
+{
+#ifdef HAVE_ROCBLAS_64
+    return rocsolver::rocsolver_potrs_batched_impl<float>(handle, uplo, n, nrhs, A, lda, B, ldb,
+                                                          batch_count);
+#else
+    return rocblas_status_not_implemented;
+#endif
+}
+
+extern "C" rocblas_status rocsolver_dpotrs_batched_64(rocblas_handle handle,
+                                                      const rocblas_fill uplo,
+                                                      const int64_t n,
+                                                      const int64_t nrhs,
+                                                      double* const A[],
+                                                      const int64_t lda,
+                                                      double* const B[],
+                                                      const int64_t ldb,
+                                                      const int64_t batch_count)
+{
+#ifdef HAVE_ROCBLAS_64
+    return rocsolver::rocsolver_potrs_batched_impl<double>(handle, uplo, n, nrhs, A, lda, B, ldb,
+                                                           batch_count);
+#else
+    return rocblas_status_not_implemented;
+#endif
+}
+
+extern "C" rocblas_status rocsolver_cpotrs_batched_64(rocblas_handle handle,
+                                                      const rocblas_fill uplo,
+                                                      const int64_t n,
+                                                      const int64_t nrhs,
+                                                      rocblas_float_complex* const A[],
+                                                      const int64_t lda,
+                                                      rocblas_float_complex* const B[],
+                                                      const int64_t ldb,
+                                                      const int64_t batch_count)
+{
+#ifdef HAVE_ROCBLAS_64
+    return rocsolver::rocsolver_potrs_batched_impl<rocblas_float_complex>(handle, uplo, n, nrhs, A,
+                                                                          lda, B, ldb, batch_count);
+#else
+    return rocblas_status_not_implemented;
+#endif
+}
+
+extern "C" rocblas_status rocsolver_zpotrs_batched_64(rocblas_handle handle,
+                                                      const rocblas_fill uplo,
+                                                      const int64_t n,
+                                                      const int64_t nrhs,
+                                                      rocblas_double_complex* const A[],
+                                                      const int64_t lda,
+                                                      rocblas_double_complex* const B[],
+                                                      const int64_t ldb,
+                                                      const int64_t batch_count)
+{
+#ifdef HAVE_ROCBLAS_64
+    return rocsolver::rocsolver_potrs_batched_impl<rocblas_double_complex>(
+        handle, uplo, n, nrhs, A, lda, B, ldb, batch_count);
+#else
+    return rocblas_status_not_implemented;
+#endif
+}
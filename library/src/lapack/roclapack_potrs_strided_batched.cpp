@@ -26,21 +26,22 @@
  * *************************************************************************/
 
 #include "roclapack_potrs.hpp"
+#include "rocsolver_check_mode.hpp"
 
 ROCSOLVER_BEGIN_NAMESPACE
 
-template <typename T, typename U>
+template <typename T, typename I, typename U>
 rocblas_status rocsolver_potrs_strided_batched_impl(rocblas_handle handle,
                                                     const rocblas_fill uplo,
-                                                    const rocblas_int n,
-                                                    const rocblas_int nrhs,
+                                                    const I n,
+                                                    const I nrhs,
                                                     U A,
-                                                    const rocblas_int lda,
+                                                    const I lda,
                                                     const rocblas_stride strideA,
                                                     U B,
-                                                    const rocblas_int ldb,
+                                                    const I ldb,
                                                     const rocblas_stride strideB,
-                                                    const rocblas_int batch_count)
+                                                    const I batch_count)
 {
     ROCSOLVER_ENTER_TOP("potrs_strided_batched", "--uplo", uplo, "-n", n, "--nrhs", nrhs, "--lda",
                         lda, "--strideA", strideA, "--ldb", ldb, "--strideB", strideB,
@@ -49,21 +50,39 @@ rocblas_status rocsolver_potrs_strided_batched_impl(rocblas_handle handle,
     if(!handle)
         return rocblas_status_invalid_handle;
 
-    // argument checking
-    rocblas_status st = rocsolver_potrs_argCheck(handle, uplo, n, nrhs, lda, ldb, A, B, batch_count);
-    if(st != rocblas_status_continue)
-        return st;
+    // argument checking (unless disabled with rocsolver_set_check_mode)
+    if(!skip_arg_checks(handle))
+    {
+        rocblas_status st
+            = rocsolver_potrs_argCheck(handle, uplo, n, nrhs, lda, ldb, A, B, batch_count);
+        if(st != rocblas_status_continue)
+            return st;
+    }
+
+    // nominal flop count for the call statistics
+    rocsolver_stats_flops(batch_count * rocsolver_potrs_flops<T>(n, nrhs));
 
     // working with unshifted arrays
-    rocblas_int shiftA = 0;
-    rocblas_int shiftB = 0;
+    rocblas_stride shiftA = 0;
+    rocblas_stride shiftB = 0;
+
+    // when all the problems share the same factorization, solve them as a single system with
+    // nrhs * batch_count right-hand sides
+    I ldbc;
+    const bool bcast = rhs_broadcast(n, nrhs, I(1), ldb, strideA, strideB, batch_count, &ldbc);
 
     // memory workspace sizes:
     // size of workspace (for calling TRSM)
     bool optim_mem;
     size_t size_work1, size_work2, size_work3, size_work4;
-    rocsolver_potrs_getMemorySize<false, true, T>(n, nrhs, batch_count, &size_work1, &size_work2,
-                                                  &size_work3, &size_work4, &optim_mem);
+    if(bcast)
+        rocsolver_potrs_getMemorySize<false, false, T>(n, nrhs * batch_count, I(1), &size_work1,
+                                                       &size_work2, &size_work3, &size_work4,
+                                                       &optim_mem);
+    else
+        rocsolver_potrs_getMemorySize<false, true, T>(n, nrhs, batch_count, &size_work1,
+                                                      &size_work2, &size_work3, &size_work4,
+                                                      &optim_mem);
 
     if(rocblas_is_device_memory_size_query(handle))
         return rocblas_set_optimal_device_memory_size(handle, size_work1, size_work2, size_work3,
@@ -82,6 +101,11 @@ rocblas_status rocsolver_potrs_strided_batched_impl(rocblas_handle handle,
     work4 = mem[3];
 
     // execution
+    if(bcast)
+        return rocsolver_potrs_template<false, false, T>(
+            handle, uplo, n, nrhs * batch_count, A, shiftA, lda, strideA, B, shiftB, ldbc,
+            rocblas_stride(0), I(1), work1, work2, work3, work4, optim_mem);
+
     return rocsolver_potrs_template<false, true, T>(handle, uplo, n, nrhs, A, shiftA, lda, strideA,
                                                     B, shiftB, ldb, strideB, batch_count, work1,
                                                     work2, work3, work4, optim_mem);
@@ -158,3 +182,83 @@ extern "C" rocblas_status rocsolver_zpotrs_strided_batched(rocblas_handle handle
     return rocsolver::rocsolver_potrs_strided_batched_impl<rocblas_double_complex>(
         handle, uplo, n, nrhs, A, lda, strideA, B, ldb, strideB, batch_count);
 }
+
+extern "C" rocblas_status rocsolver_spotrs_strided_batched_64(rocblas_handle handle,
+                                                              const rocblas_fill uplo,
+                                                              const int64_t n,
+                                                              const int64_t nrhs,
+                                                              float* A,
+                                                              const int64_t lda,
+                                                              const rocblas_stride strideA,
+                                                              float* B,
+                                                              const int64_t ldb,
+                                                              const rocblas_stride strideB,
+                                                              const int64_t batch_count)
+{
+#ifdef HAVE_ROCBLAS_64
+    return rocsolver::rocsolver_potrs_strided_batched_impl<float>(
+        handle, uplo, n, nrhs, A, lda, strideA, B, ldb, strideB, batch_count);
+#else
+    return rocblas_status_not_implemented;
+#endif
+}
+
+extern "C" rocblas_status rocsolver_dpotrs_strided_batched_64(rocblas_handle handle,
+                                                              const rocblas_fill uplo,
+                                                              const int64_t n,
+                                                              const int64_t nrhs,
+                                                              double* A,
+                                                              const int64_t lda,
+                                                              const rocblas_stride strideA,
+                                                              double* B,
+                                                              const int64_t ldb,
+                                                              const rocblas_stride strideB,
+                                                              const int64_t batch_count)
+{
+#ifdef HAVE_ROCBLAS_64
+    return rocsolver::rocsolver_potrs_strided_batched_impl<double>(
+        handle, uplo, n, nrhs, A, lda, strideA, B, ldb, strideB, batch_count);
+#else
+    return rocblas_status_not_implemented;
+#endif
+}
+
+extern "C" rocblas_status rocsolver_cpotrs_strided_batched_64(rocblas_handle handle,
+                                                              const rocblas_fill uplo,
+                                                              const int64_t n,
+                                                              const int64_t nrhs,
+                                                              rocblas_float_complex* A,
+                                                              const int64_t lda,
+                                                              const rocblas_stride strideA,
+                                                              rocblas_float_complex* B,
+                                                              const int64_t ldb,
+                                                              const rocblas_stride strideB,
+                                                              const int64_t batch_count)
+{
+#ifdef HAVE_ROCBLAS_64
+    return rocsolver::rocsolver_potrs_strided_batched_impl<rocblas_float_complex>(
+        handle, uplo, n, nrhs, A, lda, strideA, B, ldb, strideB, batch_count);
+#else
+    return rocblas_status_not_implemented;
+#endif
+}
+
+extern "C" rocblas_status rocsolver_zpotrs_strided_batched_64(rocblas_handle handle,
+                                                              const rocblas_fill uplo,
+                                                              const int64_t n,
+                                                              const int64_t nrhs,
+                                                              rocblas_double_complex* A,
+                                                              const int64_t lda,
+                                                              const rocblas_stride strideA,
+                                                              rocblas_double_complex* B,
+                                                              const int64_t ldb,
+                                                              const rocblas_stride strideB,
+                                                              const int64_t batch_count)
+{
+#ifdef HAVE_ROCBLAS_64
+    return rocsolver::rocsolver_potrs_strided_batched_impl<rocblas_double_complex>(
+        handle, uplo, n, nrhs, A, lda, strideA, B, ldb, strideB, batch_count);
+#else
+    return rocblas_status_not_implemented;
+#endif
+}
@@ -4,7 +4,7 @@
  *     Univ. of Tennessee, Univ. of California Berkeley,
  *     Univ. of Colorado Denver and NAG Ltd..
  *     December 2016
- * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions
@@ -84,6 +84,265 @@ ROCSOLVER_KERNEL void scalar_case(const rocblas_evect evect,
     }
 }
 
+/** SYEV_SMALL_KERNEL computes the eigenvalues (and the eigenvectors if evect = original) of
+    matrices of size n <= SYEV_SMALL_MAX_SIZE(T) with a single kernel call. The matrix is kept in
+    the LDS shared memory: it is reduced to tridiagonal form (as in SYTD2/HETD2 with uplo = lower),
+    the orthogonal/unitary matrix is generated in place (as in ORGTR/UNGTR), and the tridiagonal
+    eigenproblem is solved as in STEQR (or STERF if only the eigenvalues are required).
+    Call this kernel with batch_count groups in z, and BS1 threads in x. **/
+template <typename T, typename S, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) syev_small_kernel(const rocblas_evect evect,
+                                                               const rocblas_fill uplo,
+                                                               const rocblas_int n,
+                                                               U AA,
+                                                               const rocblas_int shiftA,
+                                                               const rocblas_int lda,
+                                                               const rocblas_stride strideA,
+                                                               S* DD,
+                                                               const rocblas_stride strideD,
+                                                               S* EE,
+                                                               const rocblas_stride strideE,
+                                                               rocblas_int* infoA,
+                                                               const rocblas_int max_iters,
+                                                               const S eps,
+                                                               const S ssfmin,
+                                                               const S ssfmax,
+                                                               rocsolver_diagnostics* diagA)
+{
+    const rocblas_int tid = hipThreadIdx_x;
+    const rocblas_int bid = hipBlockIdx_z;
+    const rocblas_int nn = n * n;
+
+    T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+    S* D = DD + bid * strideD;
+    S* E = EE + bid * strideE;
+    rocblas_int* info = infoA + bid;
+    rocsolver_diagnostics* diag = diagA ? diagA + bid : nullptr;
+
+    // shared memory setup:
+    // sA holds the full matrix (and then the eigenvectors) with leading dimension n, x and tau
+    // are used by the tridiagonalization, and W is the workspace of steqr
+    extern __shared__ double lmem[];
+    T* sA = reinterpret_cast<T*>(lmem);
+    T* x = sA + nn;
+    T* tau = x + n;
+    S* sD = reinterpret_cast<S*>(tau + n);
+    S* sE = sD + n;
+    S* W = sE + n;
+    __shared__ T sval[2];
+
+    // load the matrix, filling in the triangle that is not referenced
+    for(rocblas_int k = tid; k < nn; k += hipBlockDim_x)
+    {
+        rocblas_int i = k % n;
+        rocblas_int j = k / n;
+        bool stored = (uplo == rocblas_fill_lower) ? (i >= j) : (i <= j);
+
+        if(i == j)
+            sA[k] = std::real(A[i + j * lda]);
+        else
+            sA[k] = stored ? A[i + j * lda] : conj(A[j + i * lda]);
+    }
+    __syncthreads();
+
+    // reduce the matrix to tridiagonal form
+    for(rocblas_int j = 0; j < n - 1; j++)
+    {
+        const rocblas_int m = n - 1 - j;
+        T* v = sA + (j + 1) + j * n;
+        T* A22 = sA + (j + 1) + (j + 1) * n;
+
+        // generate the householder reflector H(j)
+        if(tid == 0)
+        {
+            S xnorm2 = 0;
+            for(rocblas_int i = 1; i < m; i++)
+                xnorm2 += std::norm(v[i]);
+
+            T scal;
+            larfg_set_taubeta(v[0], xnorm2, tau[j], scal, sE[j]);
+            sD[j] = std::real(sA[j + j * n]);
+            sval[0] = scal;
+            v[0] = 1;
+        }
+        __syncthreads();
+        for(rocblas_int i = tid + 1; i < m; i += hipBlockDim_x)
+            v[i] *= sval[0];
+        __syncthreads();
+
+        // apply H(j) from both sides to the trailing submatrix
+        const T t = tau[j];
+        if(t != T(0))
+        {
+            // x = tau * A22 * v
+            for(rocblas_int i = tid; i < m; i += hipBlockDim_x)
+            {
+                T temp = 0;
+                for(rocblas_int k = 0; k < m; k++)
+                    temp += A22[i + k * n] * v[k];
+                x[i] = t * temp;
+            }
+            __syncthreads();
+
+            // x = x - (1/2) * tau * (x' * v) * v
+            if(tid == 0)
+            {
+                T temp = 0;
+                for(rocblas_int k = 0; k < m; k++)
+                    temp += conj(x[k]) * v[k];
+                sval[1] = T(-0.5) * t * temp;
+            }
+            __syncthreads();
+            for(rocblas_int i = tid; i < m; i += hipBlockDim_x)
+                x[i] += sval[1] * v[i];
+            __syncthreads();
+
+            // A22 = A22 - v * x' - x * v'
+            for(rocblas_int k = tid; k < m * m; k += hipBlockDim_x)
+            {
+                rocblas_int r = k % m;
+                rocblas_int c = k / m;
+                A22[r + c * n] -= v[r] * conj(x[c]) + x[r] * conj(v[c]);
+            }
+            __syncthreads();
+        }
+    }
+    if(tid == 0)
+        sD[n - 1] = std::real(sA[(n - 1) + (n - 1) * n]);
+
+    if(evect != rocblas_evect_original)
+    {
+        // only compute eigenvalues
+        if(tid == 0)
+            run_sterf(n, sD, sE, info, max_iters, eps, ssfmin, ssfmax, diag);
+        __syncthreads();
+    }
+    else
+    {
+        // shift the householder vectors one column to the right, and set the first row and
+        // column to those of the identity matrix
+        for(rocblas_int i = tid; i < n; i += hipBlockDim_x)
+        {
+            for(rocblas_int j = i - 1; j > 0; j--)
+                sA[i + j * n] = sA[i + (j - 1) * n];
+            sA[i] = (i == 0) ? T(1) : T(0);
+        }
+        for(rocblas_int j = tid + 1; j < n; j += hipBlockDim_x)
+            sA[j * n] = 0;
+        __syncthreads();
+
+        // generate the orthogonal/unitary matrix of the trailing block (as in ORG2R/UNG2R)
+        const rocblas_int m = n - 1;
+        T* Q = sA + 1 + n;
+        for(rocblas_int i = m - 1; i >= 0; i--)
+        {
+            T* v = Q + i + i * n;
+            const T t = tau[i];
+
+            if(i < m - 1)
+            {
+                // apply H(i) to Q(i:m-1, i+1:m-1) from the left
+                if(tid == 0)
+                    v[0] = 1;
+                __syncthreads();
+                for(rocblas_int c = i + 1 + tid; c < m; c += hipBlockDim_x)
+                {
+                    T* q = Q + i + c * n;
+                    T temp = 0;
+                    for(rocblas_int k = 0; k < m - i; k++)
+                        temp += conj(v[k]) * q[k];
+                    temp *= t;
+                    for(rocblas_int k = 0; k < m - i; k++)
+                        q[k] -= v[k] * temp;
+                }
+                __syncthreads();
+            }
+
+            // complete column i
+            for(rocblas_int k = tid; k < m; k += hipBlockDim_x)
+            {
+                if(k < i)
+                    Q[k + i * n] = 0;
+                else if(k == i)
+                    Q[k + i * n] = T(1) - t;
+                else
+                    Q[k + i * n] *= -t;
+            }
+            __syncthreads();
+        }
+
+        // compute eigenvalues and eigenvectors
+        if(tid == 0)
+            run_steqr(n, sD, sE, sA, n, info, W, max_iters, eps, ssfmin, ssfmax, true, diag);
+        __syncthreads();
+
+        // write the eigenvectors back to global memory
+        for(rocblas_int k = tid; k < nn; k += hipBlockDim_x)
+            A[(k % n) + (k / n) * lda] = sA[k];
+    }
+
+    // write the results back to global memory
+    for(rocblas_int i = tid; i < n; i += hipBlockDim_x)
+    {
+        D[i] = sD[i];
+        if(i < n - 1)
+            E[i] = sE[i];
+    }
+}
+
+/** SYEV_SMALL_LMEMSIZE returns the size of the LDS shared memory required by syev_small_kernel **/
+template <typename T, typename S>
+size_t syev_small_lmemsize(const rocblas_int n)
+{
+    return sizeof(T) * (n * n + 2 * n) + sizeof(S) * (4 * n);
+}
+
+/** SYEV_USE_SMALL_KERNEL returns true if the eigenproblem of size n > 1 is solved with
+    syev_small_kernel **/
+template <typename T>
+bool syev_use_small_kernel(const rocblas_int n)
+{
+    return n <= SYEV_SMALL_MAX_SIZE(T);
+}
+
+/** SYEV_SMALL_TEMPLATE launches syev_small_kernel (the info array must already be reset) **/
+template <typename T, typename S, typename U>
+void rocsolver_syev_small_template(rocblas_handle handle,
+                                   const rocblas_evect evect,
+                                   const rocblas_fill uplo,
+                                   const rocblas_int n,
+                                   U A,
+                                   const rocblas_int shiftA,
+                                   const rocblas_int lda,
+                                   const rocblas_stride strideA,
+                                   S* D,
+                                   const rocblas_stride strideD,
+                                   S* E,
+                                   const rocblas_stride strideE,
+                                   rocblas_int* info,
+                                   const rocblas_int batch_count)
+{
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // diagnostics = 0
+    rocsolver_diagnostics* diag = get_diagnostics(handle, batch_count);
+    diagnostics_reset<T>(stream, diag, batch_count);
+
+    S eps = get_epsilon<S>();
+    S ssfmin = get_safemin<S>();
+    S ssfmax = S(1.0) / ssfmin;
+    ssfmin = sqrt(ssfmin) / (eps * eps);
+    ssfmax = sqrt(ssfmax) / S(3.0);
+
+    size_t lmemsize = syev_small_lmemsize<T, S>(n);
+    diagnostics_mark<T>(stream, diag, batch_count, 0, true);
+    ROCSOLVER_LAUNCH_KERNEL((syev_small_kernel<T>), dim3(1, 1, batch_count), dim3(BS1), lmemsize,
+                            stream, evect, uplo, n, A, shiftA, lda, strideA, D, strideD, E,
+                            strideE, info, 30 * n, eps, ssfmin, ssfmax, diag);
+    diagnostics_mark<T>(stream, diag, batch_count, 0, false);
+}
+
 /** Helper to calculate workspace sizes **/
 template <bool BATCHED, typename T, typename S>
 void rocsolver_syev_heev_getMemorySize(const rocblas_evect evect,
@@ -109,6 +368,18 @@ void rocsolver_syev_heev_getMemorySize(const rocblas_evect evect,
         return;
     }
 
+    // no workspace needed by the small-size kernel
+    if(syev_use_small_kernel<T>(n))
+    {
+        *size_scalars = 0;
+        *size_work_stack = 0;
+        *size_Abyx_norms_tmptr = 0;
+        *size_tmptau_trfact = 0;
+        *size_tau = 0;
+        *size_workArr = 0;
+        return;
+    }
+
     size_t unused;
     size_t w1 = 0, w2 = 0, w3 = 0;
     size_t a1 = 0, a2 = 0;
@@ -130,7 +401,7 @@ void rocsolver_syev_heev_getMemorySize(const rocblas_evect evect,
     else
     {
         // extra requirements for computing only the eigenvalues (sterf)
-        rocsolver_sterf_getMemorySize<T>(n, batch_count, &w2);
+        rocsolver_sterf_getMemorySize<S>(n, batch_count, &w2);
     }
 
     // get max values
@@ -228,6 +499,14 @@ rocblas_status rocsolver_syev_heev_template(rocblas_handle handle,
         return rocblas_status_success;
     }
 
+    // small-size case (single kernel call)
+    if(syev_use_small_kernel<T>(n))
+    {
+        rocsolver_syev_small_template<T>(handle, evect, uplo, n, A, shiftA, lda, strideA, D,
+                                         strideD, E, strideE, info, batch_count);
+        return rocblas_status_success;
+    }
+
     // reduce A to tridiagonal form
     rocsolver_sytrd_hetrd_template<BATCHED>(handle, uplo, n, A, shiftA, lda, strideA, D, strideD, E,
                                             strideE, tau, n, batch_count, scalars, (T*)work_stack,
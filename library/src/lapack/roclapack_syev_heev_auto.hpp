@@ -0,0 +1,206 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "rocsolver/rocsolver.h"
+#include "rocsolver_tuning.hpp"
+#include "roclapack_syev_heev.hpp"
+#include "roclapack_syevd_heevd.hpp"
+#include "roclapack_syevdj_heevdj.hpp"
+#include "roclapack_syevj_heevj.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/** The eigensolvers among which SYEV_AUTO chooses (see SYEV_AUTO_DRIVERS in ideal_sizes.hpp) **/
+enum rocsolver_syev_driver
+{
+    syev_driver_qr = 0,
+    syev_driver_dc = 1,
+    syev_driver_dcj = 2,
+    syev_driver_jacobi = 3,
+};
+
+/** Number of workspace buffers of SYEV_AUTO. The first one always holds the scalars for the
+    rocblas calls; the others are given to the selected eigensolver in the order of its
+    template arguments. **/
+#define SYEV_AUTO_NUM_WORKSPACES 10
+
+/** Returns the eigensolver that SYEV_AUTO uses for the given problem **/
+template <typename T>
+rocsolver_syev_driver
+    rocsolver_syev_auto_driver(const rocblas_evect evect, const rocblas_int n, const rocblas_int bc)
+{
+    rocblas_int drv;
+    if(evect != rocblas_evect_original)
+    {
+        rocblas_int drivers[] = {SYEV_AUTO_NOVECT_DRIVERS};
+        rocblas_int intervals[] = {SYEV_AUTO_NOVECT_INTERVALS};
+        rocblas_int max = SYEV_AUTO_NOVECT_NUM_INTERVALS;
+        drv = get_tuned_blksize("syev_auto_novect", drivers, intervals, max, n);
+    }
+    else if(bc >= SYEV_AUTO_MIN_BATCH)
+    {
+        if constexpr(!rocblas_is_complex<T>)
+        {
+            rocblas_int drivers[] = {SYEV_AUTO_BATCH_DRIVERS_REAL};
+            rocblas_int intervals[] = {SYEV_AUTO_BATCH_INTERVALS_REAL};
+            rocblas_int max = SYEV_AUTO_BATCH_NUM_INTERVALS_REAL;
+            drv = get_tuned_blksize("syev_auto_batch_real", drivers, intervals, max, n);
+        }
+        else
+        {
+            rocblas_int drivers[] = {SYEV_AUTO_BATCH_DRIVERS_COMPLEX};
+            rocblas_int intervals[] = {SYEV_AUTO_BATCH_INTERVALS_COMPLEX};
+            rocblas_int max = SYEV_AUTO_BATCH_NUM_INTERVALS_COMPLEX;
+            drv = get_tuned_blksize("syev_auto_batch_complex", drivers, intervals, max, n);
+        }
+    }
+    else
+    {
+        if constexpr(!rocblas_is_complex<T>)
+        {
+            rocblas_int drivers[] = {SYEV_AUTO_DRIVERS_REAL};
+            rocblas_int intervals[] = {SYEV_AUTO_INTERVALS_REAL};
+            rocblas_int max = SYEV_AUTO_NUM_INTERVALS_REAL;
+            drv = get_tuned_blksize("syev_auto_real", drivers, intervals, max, n);
+        }
+        else
+        {
+            rocblas_int drivers[] = {SYEV_AUTO_DRIVERS_COMPLEX};
+            rocblas_int intervals[] = {SYEV_AUTO_INTERVALS_COMPLEX};
+            rocblas_int max = SYEV_AUTO_NUM_INTERVALS_COMPLEX;
+            drv = get_tuned_blksize("syev_auto_complex", drivers, intervals, max, n);
+        }
+    }
+
+    // unknown values in a tuning table fall back to the divide and conquer eigensolver
+    if(drv < syev_driver_qr || drv > syev_driver_jacobi)
+        drv = syev_driver_dc;
+
+    return static_cast<rocsolver_syev_driver>(drv);
+}
+
+/** Helper to calculate workspace sizes **/
+template <bool BATCHED, typename T, typename S>
+void rocsolver_syev_heev_auto_getMemorySize(const rocblas_evect evect,
+                                            const rocblas_fill uplo,
+                                            const rocblas_int n,
+                                            const rocblas_int batch_count,
+                                            size_t* size_work)
+{
+    for(int i = 0; i < SYEV_AUTO_NUM_WORKSPACES; ++i)
+        size_work[i] = 0;
+
+    // if quick return, no workspace needed
+    if(n <= 1 || batch_count == 0)
+        return;
+
+    size_t* w = size_work;
+    switch(rocsolver_syev_auto_driver<T>(evect, n, batch_count))
+    {
+    case syev_driver_qr:
+        rocsolver_syev_heev_getMemorySize<BATCHED, T, S>(evect, uplo, n, batch_count, w, w + 1,
+                                                         w + 2, w + 3, w + 4, w + 5);
+        break;
+    case syev_driver_dc:
+        rocsolver_syevd_heevd_getMemorySize<BATCHED, T, S>(evect, uplo, n, batch_count, w, w + 1,
+                                                           w + 2, w + 3, w + 4, w + 5, w + 6,
+                                                           w + 7, w + 8);
+        break;
+    case syev_driver_dcj:
+        rocsolver_syevdj_heevdj_getMemorySize<BATCHED, T, S>(evect, uplo, n, batch_count, w,
+                                                             w + 1, w + 2, w + 3, w + 4, w + 5,
+                                                             w + 6, w + 7, w + 8, w + 9);
+        break;
+    case syev_driver_jacobi:
+        // space to store the residual and the number of sweeps
+        w[1] = sizeof(S) * batch_count;
+        w[2] = sizeof(rocblas_int) * batch_count;
+
+        rocsolver_syevj_heevj_getMemorySize<BATCHED, T, S>(evect, uplo, n, batch_count, w + 3,
+                                                           w + 4, w + 5, w + 6, w + 7, w + 8);
+        break;
+    }
+}
+
+/** SYEV_HEEV_AUTO computes the eigenvalues (and eigenvectors) with the eigensolver given by
+    rocsolver_syev_auto_driver. The workspace must be the one given by
+    rocsolver_syev_heev_auto_getMemorySize for the same arguments (work[0] holds the scalars). **/
+template <bool BATCHED, bool STRIDED, typename T, typename S, typename W>
+rocblas_status rocsolver_syev_heev_auto_template(rocblas_handle handle,
+                                                 const rocblas_evect evect,
+                                                 const rocblas_fill uplo,
+                                                 const rocblas_int n,
+                                                 W A,
+                                                 const rocblas_int shiftA,
+                                                 const rocblas_int lda,
+                                                 const rocblas_stride strideA,
+                                                 S* D,
+                                                 const rocblas_stride strideD,
+                                                 S* E,
+                                                 const rocblas_stride strideE,
+                                                 rocblas_int* info,
+                                                 const rocblas_int batch_count,
+                                                 void** work)
+{
+    rocsolver_syev_driver driver = rocsolver_syev_auto_driver<T>(evect, n, batch_count);
+
+    ROCSOLVER_ENTER("syev_heev_auto", "evect:", evect, "uplo:", uplo, "n:", n, "shiftA:", shiftA,
+                    "lda:", lda, "driver:", static_cast<rocblas_int>(driver), "bc:", batch_count);
+
+    T* scalars = (T*)work[0];
+
+    switch(driver)
+    {
+    case syev_driver_qr:
+        return rocsolver_syev_heev_template<BATCHED, STRIDED, T>(
+            handle, evect, uplo, n, A, shiftA, lda, strideA, D, strideD, E, strideE, info,
+            batch_count, scalars, work[1], (T*)work[2], (T*)work[3], (T*)work[4], (T**)work[5]);
+    case syev_driver_dc:
+        return rocsolver_syevd_heevd_template<BATCHED, STRIDED, T>(
+            handle, evect, uplo, n, A, shiftA, lda, strideA, D, strideD, E, strideE, info,
+            batch_count, scalars, work[1], work[2], work[3], (S*)work[4], (rocblas_int*)work[5],
+            (T*)work[6], (T*)work[7], (T**)work[8]);
+    case syev_driver_dcj:
+        return rocsolver_syevdj_heevdj_template<BATCHED, STRIDED, T>(
+            handle, evect, uplo, n, A, shiftA, lda, strideA, D, strideD, info, batch_count,
+            scalars, (S*)work[1], (T*)work[2], (T*)work[3], (rocblas_int*)work[4], work[5],
+            work[6], work[7], work[8], work[9]);
+    case syev_driver_jacobi:
+        return rocsolver_syevj_heevj_template<BATCHED, STRIDED, T>(
+            handle, rocblas_esort_ascending, evect, uplo, n, A, shiftA, lda, strideA, (S)0,
+            (S*)work[1], SYEV_AUTO_MAX_SWEEPS, (rocblas_int*)work[2], D, strideD, info,
+            batch_count, (T*)work[3], (T*)work[4], (S*)work[5], (rocblas_int*)work[6],
+            (rocblas_int*)work[7], (rocblas_int*)work[8]);
+    }
+
+    return rocblas_status_internal_error;
+}
+
+ROCSOLVER_END_NAMESPACE
@@ -0,0 +1,191 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "roclapack_syev_heev_refine.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_syev_heev_refine_impl(rocblas_handle handle,
+                                               const rocblas_fill uplo,
+                                               const rocblas_int n,
+                                               U A,
+                                               const rocblas_int lda,
+                                               U X,
+                                               const rocblas_int ldx,
+                                               const S abstol,
+                                               S* residual,
+                                               const rocblas_int max_iters,
+                                               rocblas_int* n_iters,
+                                               S* W,
+                                               rocblas_int* info)
+{
+    const char* name = (!rocblas_is_complex<T> ? "syev_refine" : "heev_refine");
+    ROCSOLVER_ENTER_TOP(name, "--uplo", uplo, "-n", n, "--lda", lda, "--ldx", ldx, "--abstol",
+                        abstol, "--max_iters", max_iters);
+    ROCSOLVER_INFO_SUMMARY(info, 1);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_syev_heev_refine_argCheck(
+        handle, uplo, n, A, lda, X, ldx, residual, max_iters, n_iters, W, info);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+    rocblas_int shiftX = 0;
+
+    // normal (non-batched non-strided) execution
+    rocblas_stride strideA = 0;
+    rocblas_stride strideX = 0;
+    rocblas_stride strideW = 0;
+    rocblas_int batch_count = 1;
+
+    // memory workspace sizes:
+    // size of the working copy of the eigenvectors
+    size_t size_Xcpy;
+    // size of temporary workspace for A*X, X'X and X'AX
+    size_t size_AX, size_gram, size_proj;
+    // size of the convergence flags and array of pointers (batched cases)
+    size_t size_completed, size_workArr;
+
+    rocsolver_syev_heev_refine_getMemorySize<false, T>(n, batch_count, &size_Xcpy, &size_AX,
+                                                       &size_gram, &size_proj, &size_completed,
+                                                       &size_workArr);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_Xcpy, size_AX, size_gram,
+                                                      size_proj, size_completed, size_workArr);
+
+    // memory workspace allocation
+    void *Xcpy, *AX, *gram, *proj, *completed, *workArr;
+    rocblas_device_malloc mem(handle, size_Xcpy, size_AX, size_gram, size_proj, size_completed,
+                              size_workArr);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    Xcpy = mem[0];
+    AX = mem[1];
+    gram = mem[2];
+    proj = mem[3];
+    completed = mem[4];
+    workArr = mem[5];
+
+    // execution
+    return _info_summary_scope.commit(rocsolver_syev_heev_refine_template<false, false, T>(
+        handle, uplo, n, A, shiftA, lda, strideA, X, shiftX, ldx, strideX, abstol, residual,
+        max_iters, n_iters, W, strideW, info, batch_count, (T*)Xcpy, (T*)AX, (T*)gram, (T*)proj,
+        (rocblas_int*)completed, (T**)workArr));
+}
+
+ROCSOLVER_END_NAMESPACE
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_ssyev_refine(rocblas_handle handle,
+                                      const rocblas_fill uplo,
+                                      const rocblas_int n,
+                                      float* A,
+                                      const rocblas_int lda,
+                                      float* X,
+                                      const rocblas_int ldx,
+                                      const float abstol,
+                                      float* residual,
+                                      const rocblas_int max_iters,
+                                      rocblas_int* n_iters,
+                                      float* W,
+                                      rocblas_int* info)
+{
+    return rocsolver::rocsolver_syev_heev_refine_impl<float>(
+        handle, uplo, n, A, lda, X, ldx, abstol, residual, max_iters, n_iters, W, info);
+}
+
+rocblas_status rocsolver_dsyev_refine(rocblas_handle handle,
+                                      const rocblas_fill uplo,
+                                      const rocblas_int n,
+                                      double* A,
+                                      const rocblas_int lda,
+                                      double* X,
+                                      const rocblas_int ldx,
+                                      const double abstol,
+                                      double* residual,
+                                      const rocblas_int max_iters,
+                                      rocblas_int* n_iters,
+                                      double* W,
+                                      rocblas_int* info)
+{
+    return rocsolver::rocsolver_syev_heev_refine_impl<double>(
+        handle, uplo, n, A, lda, X, ldx, abstol, residual, max_iters, n_iters, W, info);
+}
+
+rocblas_status rocsolver_cheev_refine(rocblas_handle handle,
+                                      const rocblas_fill uplo,
+                                      const rocblas_int n,
+                                      rocblas_float_complex* A,
+                                      const rocblas_int lda,
+                                      rocblas_float_complex* X,
+                                      const rocblas_int ldx,
+                                      const float abstol,
+                                      float* residual,
+                                      const rocblas_int max_iters,
+                                      rocblas_int* n_iters,
+                                      float* W,
+                                      rocblas_int* info)
+{
+    return rocsolver::rocsolver_syev_heev_refine_impl<rocblas_float_complex>(
+        handle, uplo, n, A, lda, X, ldx, abstol, residual, max_iters, n_iters, W, info);
+}
+
+rocblas_status rocsolver_zheev_refine(rocblas_handle handle,
+                                      const rocblas_fill uplo,
+                                      const rocblas_int n,
+                                      rocblas_double_complex* A,
+                                      const rocblas_int lda,
+                                      rocblas_double_complex* X,
+                                      const rocblas_int ldx,
+                                      const double abstol,
+                                      double* residual,
+                                      const rocblas_int max_iters,
+                                      rocblas_int* n_iters,
+                                      double* W,
+                                      rocblas_int* info)
+{
+    return rocsolver::rocsolver_syev_heev_refine_impl<rocblas_double_complex>(
+        handle, uplo, n, A, lda, X, ldx, abstol, residual, max_iters, n_iters, W, info);
+}
+
+} // extern C
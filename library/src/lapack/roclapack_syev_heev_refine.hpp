@@ -0,0 +1,353 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "rocsolver/rocsolver.h"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/** SYEV_REFINE_UPDATE computes, for the approximate eigenvectors X, the Ogita-Aishima correction
+    E from the Gram matrix G = X'X and the projected matrix H = X'AX, and overwrites G with I + E
+    so that the refined eigenvectors are X * G. The approximate eigenvalues (the Rayleigh
+    quotients of the columns of X) are returned in W. Problems that have already converged get
+    G = I. Call this kernel with batch_count groups in x, and BS1 threads in x. **/
+template <typename T, typename S>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) syev_refine_update(const rocblas_int n,
+                                                                T* GG,
+                                                                T* HH,
+                                                                S* WW,
+                                                                const rocblas_stride strideW,
+                                                                const S tol,
+                                                                S* residual,
+                                                                const rocblas_int iter,
+                                                                rocblas_int* n_iters,
+                                                                rocblas_int* info,
+                                                                rocblas_int* completed)
+{
+    const rocblas_int b = hipBlockIdx_x;
+    const rocblas_int tid = hipThreadIdx_x;
+
+    const int64_t ld = n;
+    const int64_t nn = ld * n;
+    T* G = GG + b * nn;
+    T* H = HH + b * nn;
+    S* W = WW + b * strideW;
+
+    // converged problems keep their eigenvectors
+    if(completed[b + 1])
+    {
+        for(int64_t k = tid; k < nn; k += BS1)
+            G[k] = (k % (ld + 1) == 0) ? T(1) : T(0);
+        return;
+    }
+
+    // shared mem for the reductions
+    __shared__ S sres[BS1];
+    __shared__ S sorth[BS1];
+    __shared__ S snorm[BS1];
+
+    // approximate eigenvalues
+    S anorm = 0;
+    for(rocblas_int i = tid; i < n; i += BS1)
+    {
+        const S lambda = std::real(H[i + i * ld]) / std::real(G[i + i * ld]);
+        W[i] = lambda;
+        anorm = std::max(anorm, std::abs(lambda));
+    }
+    __syncthreads();
+
+    // Frobenius norms of H - diag(W) and I - G; max(|W|) estimates the 2-norm of A
+    S res = 0;
+    S orth = 0;
+    for(int64_t k = tid; k < nn; k += BS1)
+    {
+        const rocblas_int i = k % ld;
+        const rocblas_int j = k / ld;
+        T h = H[k];
+        T r = -G[k];
+        if(i == j)
+        {
+            h -= T(W[i]);
+            r += T(1);
+        }
+        res += std::norm(h);
+        orth += std::norm(r);
+    }
+    sres[tid] = res;
+    sorth[tid] = orth;
+    snorm[tid] = anorm;
+    __syncthreads();
+
+    for(rocblas_int r = BS1 / 2; r > 0; r /= 2)
+    {
+        if(tid < r)
+        {
+            sres[tid] += sres[tid + r];
+            sorth[tid] += sorth[tid + r];
+            snorm[tid] = std::max(snorm[tid], snorm[tid + r]);
+        }
+        __syncthreads();
+    }
+
+    // eigenvalues closer than delta are treated as a cluster
+    const S delta = 2 * (std::sqrt(sres[0]) + snorm[0] * std::sqrt(sorth[0]));
+    __syncthreads();
+
+    // corrections
+    S enorm = 0;
+    for(int64_t k = tid; k < nn; k += BS1)
+    {
+        const rocblas_int i = k % ld;
+        const rocblas_int j = k / ld;
+        const T r = (i == j ? T(1) : T(0)) - G[k];
+        const S gap = W[j] - W[i];
+        const T e = (i != j && std::abs(gap) > delta) ? (H[k] + W[j] * r) / gap : r / S(2);
+        enorm += std::norm(e);
+        G[k] = (i == j) ? T(1) + e : e;
+    }
+    sres[tid] = enorm;
+    __syncthreads();
+
+    for(rocblas_int r = BS1 / 2; r > 0; r /= 2)
+    {
+        if(tid < r)
+            sres[tid] += sres[tid + r];
+        __syncthreads();
+    }
+
+    // the convergence is quadratic, so the refined eigenvectors have an error of about |E|^2
+    if(tid == 0)
+    {
+        const bool converged = sres[0] <= tol;
+        residual[b] = std::sqrt(sres[0]);
+        n_iters[b] = iter + 1;
+        info[b] = converged ? 0 : 1;
+        if(converged)
+        {
+            completed[b + 1] = 1;
+            atomicAdd(completed, 1);
+        }
+    }
+}
+
+/** Argument checking **/
+template <typename T, typename S>
+rocblas_status rocsolver_syev_heev_refine_argCheck(rocblas_handle handle,
+                                                   const rocblas_fill uplo,
+                                                   const rocblas_int n,
+                                                   T A,
+                                                   const rocblas_int lda,
+                                                   T X,
+                                                   const rocblas_int ldx,
+                                                   S* residual,
+                                                   const rocblas_int max_iters,
+                                                   rocblas_int* n_iters,
+                                                   S* W,
+                                                   rocblas_int* info,
+                                                   const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(uplo != rocblas_fill_lower && uplo != rocblas_fill_upper)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(n < 0 || lda < n || ldx < n || max_iters <= 0 || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !A) || (n && !X) || (n && !W) || (batch_count && !residual)
+       || (batch_count && !n_iters) || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+/** Helper to calculate workspace sizes **/
+template <bool BATCHED, typename T>
+void rocsolver_syev_heev_refine_getMemorySize(const rocblas_int n,
+                                              const rocblas_int batch_count,
+                                              size_t* size_Xcpy,
+                                              size_t* size_AX,
+                                              size_t* size_gram,
+                                              size_t* size_proj,
+                                              size_t* size_completed,
+                                              size_t* size_workArr)
+{
+    // if quick return, set workspace to zero
+    if(n == 0 || batch_count == 0)
+    {
+        *size_Xcpy = 0;
+        *size_AX = 0;
+        *size_gram = 0;
+        *size_proj = 0;
+        *size_completed = 0;
+        *size_workArr = 0;
+        return;
+    }
+
+    // size of the working copy of the eigenvectors, and of A*X, X'X and X'AX
+    *size_Xcpy = sizeof(T) * n * n * batch_count;
+    *size_AX = sizeof(T) * n * n * batch_count;
+    *size_gram = sizeof(T) * n * n * batch_count;
+    *size_proj = sizeof(T) * n * n * batch_count;
+
+    // size of the convergence flags
+    *size_completed = sizeof(rocblas_int) * (batch_count + 1);
+
+    // size of array of pointers (batched cases)
+    if(BATCHED)
+        *size_workArr = sizeof(T*) * 2 * batch_count;
+    else
+        *size_workArr = 0;
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename S, typename U>
+rocblas_status rocsolver_syev_heev_refine_template(rocblas_handle handle,
+                                                   const rocblas_fill uplo,
+                                                   const rocblas_int n,
+                                                   U A,
+                                                   const rocblas_int shiftA,
+                                                   const rocblas_int lda,
+                                                   const rocblas_stride strideA,
+                                                   U X,
+                                                   const rocblas_int shiftX,
+                                                   const rocblas_int ldx,
+                                                   const rocblas_stride strideX,
+                                                   const S abstol,
+                                                   S* residual,
+                                                   const rocblas_int max_iters,
+                                                   rocblas_int* n_iters,
+                                                   S* W,
+                                                   const rocblas_stride strideW,
+                                                   rocblas_int* info,
+                                                   const rocblas_int batch_count,
+                                                   T* Xcpy,
+                                                   T* AX,
+                                                   T* gram,
+                                                   T* proj,
+                                                   rocblas_int* completed,
+                                                   T** workArr)
+{
+    ROCSOLVER_ENTER("syev_heev_refine", "uplo:", uplo, "n:", n, "shiftA:", shiftA, "lda:", lda,
+                    "shiftX:", shiftX, "ldx:", ldx, "abstol:", abstol, "max_iters:", max_iters,
+                    "bc:", batch_count);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocksReset = (batch_count - 1) / BS1 + 1;
+    dim3 gridReset(blocksReset, 1, 1);
+    dim3 threadsReset(BS1, 1, 1);
+
+    // quick return
+    if(n == 0)
+    {
+        ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threadsReset, 0, stream, residual,
+                                batch_count, 0);
+        ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threadsReset, 0, stream, n_iters,
+                                batch_count, 0);
+        ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threadsReset, 0, stream, info, batch_count, 0);
+
+        return rocblas_status_success;
+    }
+
+    // everything must be executed with scalars on the host
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+
+    T one = T(1);
+    T zero = T(0);
+
+    // tolerance on the squared norm of the corrections
+    S tol = (abstol <= 0 ? get_epsilon<S>() : abstol);
+
+    rocblas_int ldw = n;
+    rocblas_stride strideWk = n * n;
+    rocblas_int blocks = (n - 1) / BS2 + 1;
+    dim3 grid(blocks, blocks, batch_count);
+    dim3 threads(BS2, BS2, 1);
+
+    // work with a copy of the eigenvectors
+    ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, grid, threads, 0, stream, n, n, X, shiftX, ldx, strideX,
+                            Xcpy, 0, ldw, strideWk);
+    HIP_CHECK(hipMemsetAsync(completed, 0, sizeof(rocblas_int) * (batch_count + 1), stream));
+
+    rocblas_int h_completed = 0;
+    for(rocblas_int iter = 0; iter < max_iters; iter++)
+    {
+        // G = X'X and H = X'AX
+        rocblasCall_symm_hemm(handle, rocblas_side_left, uplo, n, n, &one, A, shiftA, lda, strideA,
+                              Xcpy, 0, ldw, strideWk, &zero, AX, 0, ldw, strideWk, batch_count,
+                              workArr);
+        rocblasCall_gemm(handle, rocblas_operation_conjugate_transpose, rocblas_operation_none, n,
+                         n, n, &one, Xcpy, 0, ldw, strideWk, Xcpy, 0, ldw, strideWk, &zero, gram, 0,
+                         ldw, strideWk, batch_count, (T**)nullptr);
+        rocblasCall_gemm(handle, rocblas_operation_conjugate_transpose, rocblas_operation_none, n,
+                         n, n, &one, Xcpy, 0, ldw, strideWk, AX, 0, ldw, strideWk, &zero, proj, 0,
+                         ldw, strideWk, batch_count, (T**)nullptr);
+
+        // G = I + E, and X = X * G
+        ROCSOLVER_LAUNCH_KERNEL((syev_refine_update<T, S>), dim3(batch_count, 1, 1),
+                                dim3(BS1, 1, 1), 0, stream, n, gram, proj, W, strideW, tol,
+                                residual, iter, n_iters, info, completed);
+        rocblasCall_gemm(handle, rocblas_operation_none, rocblas_operation_none, n, n, n, &one,
+                         Xcpy, 0, ldw, strideWk, gram, 0, ldw, strideWk, &zero, AX, 0, ldw,
+                         strideWk, batch_count, (T**)nullptr);
+        std::swap(Xcpy, AX);
+
+        // the host needs to know whether all the problems have converged
+        HIP_CHECK(hipMemcpyAsync(&h_completed, completed, sizeof(rocblas_int),
+                                 hipMemcpyDeviceToHost, stream));
+        rocsolver_stats_host_sync();
+        HIP_CHECK(hipStreamSynchronize(stream));
+
+        if(h_completed == batch_count)
+            break;
+    }
+
+    // copy the refined eigenvectors back
+    ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, grid, threads, 0, stream, n, n, Xcpy, 0, ldw, strideWk,
+                            X, shiftX, ldx, strideX);
+
+    rocblas_set_pointer_mode(handle, old_mode);
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
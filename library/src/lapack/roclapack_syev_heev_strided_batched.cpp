@@ -48,6 +48,7 @@ rocblas_status rocsolver_syev_heev_strided_batched_impl(rocblas_handle handle,
     ROCSOLVER_ENTER_TOP(name, "--evect", evect, "--uplo", uplo, "-n", n, "--lda", lda, "--strideA",
                         strideA, "--strideD", strideD, "--strideE", strideE, "--batch_count",
                         batch_count);
+    ROCSOLVER_INFO_SUMMARY(info, batch_count);
 
     if(!handle)
         return rocblas_status_invalid_handle;
@@ -62,7 +63,7 @@ rocblas_status rocsolver_syev_heev_strided_batched_impl(rocblas_handle handle,
     rocblas_int shiftA = 0;
 
     // memory workspace sizes:
-    // size for constants in rocblas calls
+    // constants in rocblas calls (only whether they are needed, see set_device_scalars)
     size_t size_scalars;
     // size of reusable workspace and stack
     size_t size_work_stack;
@@ -78,13 +79,13 @@ rocblas_status rocsolver_syev_heev_strided_batched_impl(rocblas_handle handle,
                                                    &size_tmptau_trfact, &size_tau, &size_workArr);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work_stack,
+        return rocblas_set_optimal_device_memory_size(handle, size_t(0), size_work_stack,
                                                       size_Abyx_norms_tmptr, size_tmptau_trfact,
                                                       size_tau, size_workArr);
 
     // memory workspace allocation
     void *scalars, *work_stack, *Abyx_norms_tmptr, *tmptau_trfact, *tau, *workArr;
-    rocblas_device_malloc mem(handle, size_scalars, size_work_stack, size_Abyx_norms_tmptr,
+    rocblas_device_malloc mem(handle, size_t(0), size_work_stack, size_Abyx_norms_tmptr,
                               size_tmptau_trfact, size_tau, size_workArr);
 
     if(!mem)
@@ -97,12 +98,12 @@ rocblas_status rocsolver_syev_heev_strided_batched_impl(rocblas_handle handle,
     tau = mem[4];
     workArr = mem[5];
     if(size_scalars > 0)
-        init_scalars(handle, (T*)scalars);
+        ROCBLAS_CHECK(set_device_scalars<T>(scalars));
 
     // execution
-    return rocsolver_syev_heev_template<false, true, T>(
+    return _info_summary_scope.commit(rocsolver_syev_heev_template<false, true, T>(
         handle, evect, uplo, n, A, shiftA, lda, strideA, D, strideD, E, strideE, info, batch_count,
-        (T*)scalars, work_stack, (T*)Abyx_norms_tmptr, (T*)tmptau_trfact, (T*)tau, (T**)workArr);
+        (T*)scalars, work_stack, (T*)Abyx_norms_tmptr, (T*)tmptau_trfact, (T*)tau, (T**)workArr));
 }
 
 ROCSOLVER_END_NAMESPACE
@@ -19,6 +19,7 @@ rocblas_status rocsolver_syevd_heevd_impl(rocblas_handle handle,
 {
     const char* name = (!rocblas_is_complex<T> ? "syevd" : "heevd");
     ROCSOLVER_ENTER_TOP(name, "--evect", evect, "--uplo", uplo, "-n", n, "--lda", lda);
+    ROCSOLVER_INFO_SUMMARY(info, 1);
 
     if(!handle)
         return rocblas_status_invalid_handle;
@@ -38,7 +39,7 @@ rocblas_status rocsolver_syevd_heevd_impl(rocblas_handle handle,
     rocblas_int batch_count = 1;
 
     // memory workspace sizes:
-    // size for constants in rocblas calls
+    // constants in rocblas calls (only whether they are needed, see set_device_scalars)
     size_t size_scalars;
     // size of reusable workspaces
     size_t size_work1;
@@ -57,13 +58,13 @@ rocblas_status rocsolver_syevd_heevd_impl(rocblas_handle handle,
         &size_tmpz, &size_splits, &size_tmptau_W, &size_tau, &size_workArr);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work1, size_work2,
+        return rocblas_set_optimal_device_memory_size(handle, size_t(0), size_work1, size_work2,
                                                       size_work3, size_tmpz, size_splits,
                                                       size_tmptau_W, size_tau, size_workArr);
 
     // memory workspace allocation
     void *scalars, *work1, *work2, *work3, *tmpz, *splits, *tmptau_W, *tau, *workArr;
-    rocblas_device_malloc mem(handle, size_scalars, size_work1, size_work2, size_work3, size_tmpz,
+    rocblas_device_malloc mem(handle, size_t(0), size_work1, size_work2, size_work3, size_tmpz,
                               size_splits, size_tmptau_W, size_tau, size_workArr);
 
     if(!mem)
@@ -79,13 +80,13 @@ rocblas_status rocsolver_syevd_heevd_impl(rocblas_handle handle,
     tau = mem[7];
     workArr = mem[8];
     if(size_scalars > 0)
-        init_scalars(handle, (T*)scalars);
+        ROCBLAS_CHECK(set_device_scalars<T>(scalars));
 
     // execution
-    return rocsolver_syevd_heevd_template<false, false, T>(
+    return _info_summary_scope.commit(rocsolver_syevd_heevd_template<false, false, T>(
         handle, evect, uplo, n, A, shiftA, lda, strideA, D, strideD, E, strideE, info, batch_count,
         (T*)scalars, work1, work2, work3, (S*)tmpz, (rocblas_int*)splits, (T*)tmptau_W, (T*)tau,
-        (T**)workArr);
+        (T**)workArr));
 }
 
 ROCSOLVER_END_NAMESPACE
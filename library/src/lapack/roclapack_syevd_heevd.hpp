@@ -4,7 +4,7 @@
  *     Univ. of Tennessee, Univ. of California Berkeley,
  *     Univ. of Colorado Denver and NAG Ltd..
  *     December 2016
- * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ * Copyright (C) 2021-2025 Advanced Micro Devices, Inc. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions
@@ -38,6 +38,7 @@
 #include "rocblas.hpp"
 #include "roclapack_syev_heev.hpp"
 #include "roclapack_sytrd_hetrd.hpp"
+#include "roclapack_sytrd_hetrd_2stage.hpp"
 #include "rocsolver/rocsolver.h"
 
 ROCSOLVER_BEGIN_NAMESPACE
@@ -73,15 +74,38 @@ void rocsolver_syevd_heevd_getMemorySize(const rocblas_evect evect,
         return;
     }
 
+    // no workspace needed by the small-size kernel
+    if(syev_use_small_kernel<T>(n))
+    {
+        *size_scalars = 0;
+        *size_work1 = 0;
+        *size_work2 = 0;
+        *size_work3 = 0;
+        *size_tmptau_W = 0;
+        *size_tau = 0;
+        *size_workArr = 0;
+        *size_splits = 0;
+        *size_tmpz = 0;
+        return;
+    }
+
     size_t unused;
     size_t w11 = 0, w12 = 0, w13 = 0;
     size_t w21 = 0, w22 = 0, w23 = 0;
     size_t w31 = 0, w32 = 0;
+    size_t w33 = 0;
     size_t t1 = 0, t2 = 0;
+    size_t a1 = 0, a2 = 0;
+    const bool twostage = (n >= xxTRD_2STAGE_SWITCHSIZE);
 
     // requirements for tridiagonalization (sytrd/hetrd)
-    rocsolver_sytrd_hetrd_getMemorySize<BATCHED, T>(n, batch_count, size_scalars, &w11, &w21, &t1,
-                                                    &unused);
+    if(twostage)
+        rocsolver_sytrd_hetrd_2stage_getMemorySize<BATCHED, T>(evect, uplo, n, batch_count,
+                                                               size_scalars, &w11, &w21, &w33,
+                                                               &a1, &t1, size_tau);
+    else
+        rocsolver_sytrd_hetrd_getMemorySize<BATCHED, T>(n, batch_count, size_scalars, &w11, &w21,
+                                                        &t1, &unused);
 
     if(evect == rocblas_evect_original)
     {
@@ -90,37 +114,45 @@ void rocsolver_syevd_heevd_getMemorySize(const rocblas_evect evect,
                                                      &w22, &w31, size_tmpz, size_splits, &unused);
 
         // extra requirements for ormtr/unmtr
-        rocsolver_ormtr_unmtr_getMemorySize<BATCHED, T>(rocblas_side_left, uplo, n, n, batch_count,
-                                                        &unused, &w13, &w23, &w32, &unused);
+        if(twostage)
+            rocsolver_ormtr_unmtr_2stage_getMemorySize<BATCHED, T>(uplo, n, n, batch_count, &unused,
+                                                                   &w13, &w23, &w32, &a2);
+        else
+            rocsolver_ormtr_unmtr_getMemorySize<BATCHED, T>(rocblas_side_left, uplo, n, n,
+                                                            batch_count, &unused, &w13, &w23, &w32,
+                                                            &unused);
 
-        *size_work3 = std::max(w31, w32);
+        *size_work3 = std::max({w31, w32, w33});
+
+        // size of array for temporary matrix products
+        t2 = sizeof(T) * n * n * batch_count;
     }
     else
     {
         // extra requirements for computing only the eigenvalues (sterf)
-        rocsolver_sterf_getMemorySize<T>(n, batch_count, &w12);
+        rocsolver_sterf_getMemorySize<S>(n, batch_count, &w12);
 
-        *size_work3 = 0;
+        *size_work3 = w33;
         *size_tmpz = 0;
         *size_splits = 0;
     }
 
-    // size of array for temporary matrix products
-    t2 = sizeof(T) * n * n * batch_count;
-
     // get max values
     *size_work1 = std::max({w11, w12, w13});
     *size_work2 = std::max({w21, w22, w23});
     *size_tmptau_W = std::max(t1, t2);
 
     // size of array for temporary householder scalars
-    *size_tau = sizeof(T) * n * batch_count;
+    // (with the two-stage reduction, it also holds the householder vectors of the second stage)
+    if(!twostage)
+        *size_tau = sizeof(T) * n * batch_count;
 
     // size of array of pointers to workspace
     if(BATCHED)
         *size_workArr = 2 * sizeof(T*) * batch_count;
     else
         *size_workArr = 0;
+    *size_workArr = std::max({*size_workArr, a1, a2});
 }
 
 template <bool BATCHED, bool STRIDED, typename T, typename S, typename W>
@@ -177,12 +209,27 @@ rocblas_status rocsolver_syevd_heevd_template(rocblas_handle handle,
         return rocblas_status_success;
     }
 
+    // small-size case (single kernel call, as in SYEV/HEEV)
+    if(syev_use_small_kernel<T>(n))
+    {
+        rocsolver_syev_small_template<T>(handle, evect, uplo, n, A, shiftA, lda, strideA, D,
+                                         strideD, E, strideE, info, batch_count);
+        return rocblas_status_success;
+    }
+
     // TODO: Scale the matrix
 
     // reduce A to tridiagonal form
-    rocsolver_sytrd_hetrd_template<BATCHED>(handle, uplo, n, A, shiftA, lda, strideA, D, strideD, E,
-                                            strideE, tau, n, batch_count, scalars, (T*)work1,
-                                            (T*)work2, tmptau_W, workArr);
+    // (in two stages for large sizes, so that most of the work is done by matrix-matrix products)
+    const bool twostage = (n >= xxTRD_2STAGE_SWITCHSIZE);
+    if(twostage)
+        rocsolver_sytrd_hetrd_2stage_template<BATCHED, STRIDED>(
+            handle, evect, uplo, n, A, shiftA, lda, strideA, D, strideD, E, strideE, batch_count,
+            scalars, work1, (T*)work2, (T*)work3, workArr, tmptau_W, tau);
+    else
+        rocsolver_sytrd_hetrd_template<BATCHED>(handle, uplo, n, A, shiftA, lda, strideA, D,
+                                                strideD, E, strideE, tau, n, batch_count, scalars,
+                                                (T*)work1, (T*)work2, tmptau_W, workArr);
 
     if(evect != rocblas_evect_original)
     {
@@ -200,10 +247,15 @@ rocblas_status rocsolver_syevd_heevd_template(rocblas_handle handle,
             handle, rocblas_evect_tridiagonal, n, D, 0, strideD, E, 0, strideE, tmptau_W, 0, ldw,
             strideW, info, batch_count, work1, (S*)work2, (S*)work3, tmpz, splits, (S**)workArr);
 
-        rocsolver_ormtr_unmtr_template<BATCHED, STRIDED>(
-            handle, rocblas_side_left, uplo, rocblas_operation_none, n, n, A, shiftA, lda, strideA,
-            tau, n, tmptau_W, 0, ldw, strideW, batch_count, scalars, (T*)work1, (T*)work2,
-            (T*)work3, workArr);
+        if(twostage)
+            rocsolver_ormtr_unmtr_2stage_template<BATCHED, STRIDED>(
+                handle, uplo, n, n, A, shiftA, lda, strideA, tau, tmptau_W, 0, ldw, strideW,
+                batch_count, scalars, (T*)work1, (T*)work2, (T*)work3, workArr);
+        else
+            rocsolver_ormtr_unmtr_template<BATCHED, STRIDED>(
+                handle, rocblas_side_left, uplo, rocblas_operation_none, n, n, A, shiftA, lda,
+                strideA, tau, n, tmptau_W, 0, ldw, strideW, batch_count, scalars, (T*)work1,
+                (T*)work2, (T*)work3, workArr);
 
         // copy matrix product into A
         const rocblas_int copyblocks = (n - 1) / BS2 + 1;
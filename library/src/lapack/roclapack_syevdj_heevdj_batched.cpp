@@ -44,6 +44,7 @@ rocblas_status rocsolver_syevdj_heevdj_batched_impl(rocblas_handle handle,
     const char* name = (!rocblas_is_complex<T> ? "syevdj_batched" : "heevdj_batched");
     ROCSOLVER_ENTER_TOP(name, "--evect", evect, "--uplo", uplo, "-n", n, "--lda", lda, "--strideD",
                         strideD, "--batch_count", batch_count);
+    ROCSOLVER_INFO_SUMMARY(info, batch_count);
 
     if(!handle)
         return rocblas_status_invalid_handle;
@@ -61,7 +62,7 @@ rocblas_status rocsolver_syevdj_heevdj_batched_impl(rocblas_handle handle,
     rocblas_stride strideA = 0;
 
     // memory workspace sizes:
-    // size for constants in rocblas calls
+    // constants in rocblas calls (only whether they are needed, see set_device_scalars)
     size_t size_scalars;
     // size of reusable workspaces
     size_t size_work1;
@@ -84,12 +85,12 @@ rocblas_status rocsolver_syevdj_heevdj_batched_impl(rocblas_handle handle,
 
     if(rocblas_is_device_memory_size_query(handle))
         return rocblas_set_optimal_device_memory_size(
-            handle, size_scalars, size_workE, size_workTau, size_workVec, size_workSplits,
+            handle, size_t(0), size_workE, size_workTau, size_workVec, size_workSplits,
             size_work1, size_work2, size_work3, size_work4, size_workArr);
 
     // memory workspace allocation
     void *scalars, *work1, *work2, *work3, *work4, *workE, *workVec, *workSplits, *workTau, *workArr;
-    rocblas_device_malloc mem(handle, size_scalars, size_workE, size_workTau, size_workVec,
+    rocblas_device_malloc mem(handle, size_t(0), size_workE, size_workTau, size_workVec,
                               size_workSplits, size_work1, size_work2, size_work3, size_work4,
                               size_workArr);
 
@@ -107,13 +108,13 @@ rocblas_status rocsolver_syevdj_heevdj_batched_impl(rocblas_handle handle,
     work4 = mem[8];
     workArr = mem[9];
     if(size_scalars > 0)
-        init_scalars(handle, (T*)scalars);
+        ROCBLAS_CHECK(set_device_scalars<T>(scalars));
 
     // execution
-    return rocsolver_syevdj_heevdj_template<true, false, T>(
+    return _info_summary_scope.commit(rocsolver_syevdj_heevdj_template<true, false, T>(
         handle, evect, uplo, n, A, shiftA, lda, strideA, D, strideD, info, batch_count, (T*)scalars,
         (S*)workE, (T*)workTau, (T*)workVec, (rocblas_int*)workSplits, work1, work2, work3, work4,
-        workArr);
+        workArr));
 }
 
 ROCSOLVER_END_NAMESPACE
@@ -50,6 +50,7 @@ rocblas_status rocsolver_syevdx_heevdx_impl(rocblas_handle handle,
     const char* name = (!rocblas_is_complex<T> ? "syevdx" : "heevdx");
     ROCSOLVER_ENTER_TOP(name, "--evect", evect, "--erange", erange, "--uplo", uplo, "-n", n,
                         "--lda", lda, "--vl", vl, "--vu", vu, "--il", il, "--iu", iu, "--ldz", ldz);
+    ROCSOLVER_INFO_SUMMARY(info, 1);
 
     if(!handle)
         return rocblas_status_invalid_handle;
@@ -71,7 +72,7 @@ rocblas_status rocsolver_syevdx_heevdx_impl(rocblas_handle handle,
     rocblas_int batch_count = 1;
 
     // memory workspace sizes:
-    // size for constants in rocblas calls
+    // constants in rocblas calls (only whether they are needed, see set_device_scalars)
     size_t size_scalars;
     // size of reusable workspaces (for calling SYTRD/HETRD, STEBZ, STEIN, and ORMTR/UNMTR)
     size_t size_work1, size_work2, size_work3, size_work4, size_work5, size_work6_ifail;
@@ -84,7 +85,7 @@ rocblas_status rocsolver_syevdx_heevdx_impl(rocblas_handle handle,
         &size_tau, &size_nsplit_workArr);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work1, size_work2,
+        return rocblas_set_optimal_device_memory_size(handle, size_t(0), size_work1, size_work2,
                                                       size_work3, size_work4, size_work5,
                                                       size_work6_ifail, size_D, size_E, size_iblock,
                                                       size_isplit, size_tau, size_nsplit_workArr);
@@ -92,7 +93,7 @@ rocblas_status rocsolver_syevdx_heevdx_impl(rocblas_handle handle,
     // memory workspace allocation
     void *scalars, *work1, *work2, *work3, *work4, *work5, *work6_ifail, *D, *E, *iblock, *isplit,
         *tau, *nsplit_workArr;
-    rocblas_device_malloc mem(handle, size_scalars, size_work1, size_work2, size_work3, size_work4,
+    rocblas_device_malloc mem(handle, size_t(0), size_work1, size_work2, size_work3, size_work4,
                               size_work5, size_work6_ifail, size_D, size_E, size_iblock,
                               size_isplit, size_tau, size_nsplit_workArr);
 
@@ -113,14 +114,14 @@ rocblas_status rocsolver_syevdx_heevdx_impl(rocblas_handle handle,
     tau = mem[11];
     nsplit_workArr = mem[12];
     if(size_scalars > 0)
-        init_scalars(handle, (T*)scalars);
+        ROCBLAS_CHECK(set_device_scalars<T>(scalars));
 
     // execution
-    return rocsolver_syevdx_heevdx_template<false, false, T>(
+    return _info_summary_scope.commit(rocsolver_syevdx_heevdx_template<false, false, T>(
         handle, evect, erange, uplo, n, A, shiftA, lda, strideA, vl, vu, il, iu, nev, W, strideW, Z,
         shiftZ, ldz, strideZ, info, batch_count, (T*)scalars, work1, work2, work3, work4, work5,
         (rocblas_int*)work6_ifail, (S*)D, (S*)E, (rocblas_int*)iblock, (rocblas_int*)isplit,
-        (T*)tau, nsplit_workArr);
+        (T*)tau, nsplit_workArr));
 }
 
 ROCSOLVER_END_NAMESPACE
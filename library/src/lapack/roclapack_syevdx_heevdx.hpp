@@ -138,8 +138,10 @@ void rocsolver_syevdx_heevdx_getMemorySize(const rocblas_evect evect,
     rocsolver_sytrd_hetrd_getMemorySize<BATCHED, T>(n, batch_count, size_scalars, &a1, &b1, &c1,
                                                     size_nsplit_workArr);
     // requirements for ormtr/unmtr
-    rocsolver_ormtr_unmtr_getMemorySize<BATCHED, T>(rocblas_side_left, uplo, n, n, batch_count,
-                                                    &unused, &a2, &b2, &c2, &unused);
+    if(evect == rocblas_evect_original)
+        rocsolver_ormtr_unmtr_getMemorySize<BATCHED, T>(rocblas_side_left, uplo, n, n,
+                                                        batch_count, &unused, &a2, &b2, &c2,
+                                                        &unused);
 
     // size of array for temporary householder scalars
     *size_tau = sizeof(T) * n * batch_count;
@@ -277,7 +279,9 @@ rocblas_status rocsolver_syevdx_heevdx_template(rocblas_handle handle,
                                         (rocblas_int*)work2);
 
             // apply unitary matrix to eigenvectors
-            rocblas_int h_nev = (erange == rocblas_erange_index ? iu - il + 1 : n);
+            rocblas_int h_nev;
+            ROCBLAS_CHECK(
+                syevx_backtransform_ncols(handle, erange, n, il, iu, nev, batch_count, &h_nev));
             rocsolver_ormtr_unmtr_template<BATCHED, STRIDED>(
                 handle, rocblas_side_left, uplo, rocblas_operation_none, n, h_nev, A, shiftA, lda,
                 strideA, tau, stride, Z, shiftZ, ldz, strideZ, batch_count, scalars, (T*)work1,
@@ -300,7 +304,9 @@ rocblas_status rocsolver_syevdx_heevdx_template(rocblas_handle handle,
             W, strideW, Z, shiftZ, ldz, strideZ, info, batch_count, (S*)work1, (S*)work2, (S*)work3,
             (S*)work4, (S*)work5, work6_ifail, (S**)nsplit_workArr);
 
-        rocblas_int h_nev = (erange == rocblas_erange_index ? iu - il + 1 : n);
+        rocblas_int h_nev;
+        ROCBLAS_CHECK(
+            syevx_backtransform_ncols(handle, erange, n, il, iu, nev, batch_count, &h_nev));
         rocsolver_ormtr_unmtr_template<BATCHED, STRIDED>(
             handle, rocblas_side_left, uplo, rocblas_operation_none, n, h_nev, A, shiftA, lda,
             strideA, tau, n, Z, shiftZ, ldz, strideZ, batch_count, scalars, (T*)work1, (T*)work2,
@@ -35,6 +35,12 @@ ROCSOLVER_BEGIN_NAMESPACE
  *    exists to provide a syevdx/heevdx method with a signature identical to
  *    the cuSOLVER implementation, for use exclusively in hipSOLVER.
  *
+ *    The number of eigenvalues is copied to h_nev, on the host, and the stream
+ *    is synchronized before returning, so h_nev can be read right away. The
+ *    _async versions leave the copy in the stream instead (h_nev should then be
+ *    pinned memory, and the stream must be synchronized before reading it), so
+ *    that they can overlap with other work and be captured into a HIP graph.
+ *
  *    TODO: The current implementation is based on syevx. It will need to be
  *    updated to syevdx at a later date.
  * ===========================================================================
@@ -55,11 +61,13 @@ rocblas_status rocsolver_syevdx_heevdx_inplace_impl(rocblas_handle handle,
                                                     const S abstol,
                                                     rocblas_int* h_nev,
                                                     S* W,
-                                                    rocblas_int* info)
+                                                    rocblas_int* info,
+                                                    const bool async_nev = false)
 {
     const char* name = (!rocblas_is_complex<T> ? "syevdx_inplace" : "heevdx_inplace");
     ROCSOLVER_ENTER_TOP(name, "--evect", evect, "--erange", erange, "--uplo", uplo, "-n", n, "--lda",
                         lda, "--vl", vl, "--vu", vu, "--il", il, "--iu", iu, "--abstol", abstol);
+    ROCSOLVER_INFO_SUMMARY(info, 1);
 
     if(!handle)
         return rocblas_status_invalid_handle;
@@ -79,7 +87,7 @@ rocblas_status rocsolver_syevdx_heevdx_inplace_impl(rocblas_handle handle,
     rocblas_int batch_count = 1;
 
     // memory workspace sizes:
-    // size for constants in rocblas calls
+    // constants in rocblas calls (only whether they are needed, see set_device_scalars)
     size_t size_scalars;
     // size of reusable workspaces (for calling SYTRD/HETRD, STEBZ, STEIN, and ORMTR/UNMTR)
     size_t size_work1, size_work2, size_work3, size_work4, size_work5, size_work6_ifail;
@@ -93,14 +101,14 @@ rocblas_status rocsolver_syevdx_heevdx_inplace_impl(rocblas_handle handle,
 
     if(rocblas_is_device_memory_size_query(handle))
         return rocblas_set_optimal_device_memory_size(
-            handle, size_scalars, size_work1, size_work2, size_work3, size_work4, size_work5,
+            handle, size_t(0), size_work1, size_work2, size_work3, size_work4, size_work5,
             size_work6_ifail, size_D, size_E, size_iblock, size_isplit_map, size_tau, size_nev,
             size_nsplit_workArr);
 
     // memory workspace allocation
     void *scalars, *work1, *work2, *work3, *work4, *work5, *work6_ifail, *D, *E, *iblock,
         *isplit_map, *tau, *d_nev, *nsplit_workArr;
-    rocblas_device_malloc mem(handle, size_scalars, size_work1, size_work2, size_work3, size_work4,
+    rocblas_device_malloc mem(handle, size_t(0), size_work1, size_work2, size_work3, size_work4,
                               size_work5, size_work6_ifail, size_D, size_E, size_iblock,
                               size_isplit_map, size_tau, size_nev, size_nsplit_workArr);
 
@@ -122,14 +130,14 @@ rocblas_status rocsolver_syevdx_heevdx_inplace_impl(rocblas_handle handle,
     d_nev = mem[12];
     nsplit_workArr = mem[13];
     if(size_scalars > 0)
-        init_scalars(handle, (T*)scalars);
+        ROCBLAS_CHECK(set_device_scalars<T>(scalars));
 
     // execution
-    return rocsolver_syevdx_heevdx_inplace_template<false, false, T>(
+    return _info_summary_scope.commit(rocsolver_syevdx_heevdx_inplace_template<false, false, T>(
         handle, evect, erange, uplo, n, A, shiftA, lda, strideA, vl, vu, il, iu, abstol, h_nev, W,
         strideW, info, batch_count, (T*)scalars, work1, work2, work3, work4, work5,
         (rocblas_int*)work6_ifail, (S*)D, (S*)E, (rocblas_int*)iblock, (rocblas_int*)isplit_map,
-        (T*)tau, (rocblas_int*)d_nev, nsplit_workArr);
+        (T*)tau, (rocblas_int*)d_nev, nsplit_workArr, async_nev));
 }
 
 ROCSOLVER_END_NAMESPACE
@@ -222,4 +230,84 @@ ROCSOLVER_EXPORT rocblas_status rocsolver_zheevdx_inplace(rocblas_handle handle,
         handle, evect, erange, uplo, n, A, lda, vl, vu, il, iu, abstol, h_nev, W, info);
 }
 
+ROCSOLVER_EXPORT rocblas_status rocsolver_ssyevdx_inplace_async(rocblas_handle handle,
+                                                                const rocblas_evect evect,
+                                                                const rocblas_erange erange,
+                                                                const rocblas_fill uplo,
+                                                                const rocblas_int n,
+                                                                float* A,
+                                                                const rocblas_int lda,
+                                                                const float vl,
+                                                                const float vu,
+                                                                const rocblas_int il,
+                                                                const rocblas_int iu,
+                                                                const float abstol,
+                                                                rocblas_int* h_nev,
+                                                                float* W,
+                                                                rocblas_int* info)
+{
+    return rocsolver::rocsolver_syevdx_heevdx_inplace_impl<float>(
+        handle, evect, erange, uplo, n, A, lda, vl, vu, il, iu, abstol, h_nev, W, info, true);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dsyevdx_inplace_async(rocblas_handle handle,
+                                                                const rocblas_evect evect,
+                                                                const rocblas_erange erange,
+                                                                const rocblas_fill uplo,
+                                                                const rocblas_int n,
+                                                                double* A,
+                                                                const rocblas_int lda,
+                                                                const double vl,
+                                                                const double vu,
+                                                                const rocblas_int il,
+                                                                const rocblas_int iu,
+                                                                const double abstol,
+                                                                rocblas_int* h_nev,
+                                                                double* W,
+                                                                rocblas_int* info)
+{
+    return rocsolver::rocsolver_syevdx_heevdx_inplace_impl<double>(
+        handle, evect, erange, uplo, n, A, lda, vl, vu, il, iu, abstol, h_nev, W, info, true);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cheevdx_inplace_async(rocblas_handle handle,
+                                                                const rocblas_evect evect,
+                                                                const rocblas_erange erange,
+                                                                const rocblas_fill uplo,
+                                                                const rocblas_int n,
+                                                                rocblas_float_complex* A,
+                                                                const rocblas_int lda,
+                                                                const float vl,
+                                                                const float vu,
+                                                                const rocblas_int il,
+                                                                const rocblas_int iu,
+                                                                const float abstol,
+                                                                rocblas_int* h_nev,
+                                                                float* W,
+                                                                rocblas_int* info)
+{
+    return rocsolver::rocsolver_syevdx_heevdx_inplace_impl<rocblas_float_complex>(
+        handle, evect, erange, uplo, n, A, lda, vl, vu, il, iu, abstol, h_nev, W, info, true);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zheevdx_inplace_async(rocblas_handle handle,
+                                                                const rocblas_evect evect,
+                                                                const rocblas_erange erange,
+                                                                const rocblas_fill uplo,
+                                                                const rocblas_int n,
+                                                                rocblas_double_complex* A,
+                                                                const rocblas_int lda,
+                                                                const double vl,
+                                                                const double vu,
+                                                                const rocblas_int il,
+                                                                const rocblas_int iu,
+                                                                const double abstol,
+                                                                rocblas_int* h_nev,
+                                                                double* W,
+                                                                rocblas_int* info)
+{
+    return rocsolver::rocsolver_syevdx_heevdx_inplace_impl<rocblas_double_complex>(
+        handle, evect, erange, uplo, n, A, lda, vl, vu, il, iu, abstol, h_nev, W, info, true);
+}
+
 } // extern C
@@ -229,7 +229,8 @@ rocblas_status rocsolver_syevdx_heevdx_inplace_template(rocblas_handle handle,
                                                         rocblas_int* isplit_map,
                                                         T* tau,
                                                         rocblas_int* d_nev,
-                                                        void* nsplit_workArr)
+                                                        void* nsplit_workArr,
+                                                        const bool async_nev = false)
 {
     ROCSOLVER_ENTER("syevdx_heevdx_inplace", "evect:", evect, "erange:", erange, "uplo:", uplo,
                     "n:", n, "shiftA:", shiftA, "lda:", lda, "vl:", vl, "vu:", vu, "il:", il,
@@ -296,7 +297,9 @@ rocblas_status rocsolver_syevdx_heevdx_inplace_template(rocblas_handle handle,
                                         (rocblas_int*)work2);
 
             // apply unitary matrix to eigenvectors
-            rocblas_int temp_nev = (erange == rocblas_erange_index ? iu - il + 1 : n);
+            rocblas_int temp_nev;
+            ROCBLAS_CHECK(syevx_backtransform_ncols(handle, erange, n, il, iu, d_nev, batch_count,
+                                                    &temp_nev));
             rocsolver_ormtr_unmtr_template<BATCHED, STRIDED>(
                 handle, rocblas_side_left, uplo, rocblas_operation_none, n, temp_nev, (T*)work4, 0,
                 n, n * n, tau, stride, A, shiftA, lda, strideA, batch_count, scalars, (T*)work1,
@@ -323,7 +326,9 @@ rocblas_status rocsolver_syevdx_heevdx_inplace_template(rocblas_handle handle,
             d_nev, W, strideW, A, shiftA, lda, strideA, info, batch_count, (S*)work1, (S*)work2,
             (S*)work3, (S*)work4, (S*)work5, work6_ifail, (S**)nsplit_workArr);
 
-        rocblas_int h_nev = (erange == rocblas_erange_index ? iu - il + 1 : n);
+        rocblas_int h_nev;
+        ROCBLAS_CHECK(
+            syevx_backtransform_ncols(handle, erange, n, il, iu, d_nev, batch_count, &h_nev));
         rocsolver_ormtr_unmtr_template<BATCHED, STRIDED>(
             handle, rocblas_side_left, uplo, rocblas_operation_none, n, h_nev, (T*)iblock, 0, n,
             n * n, tau, n, A, shiftA, lda, strideA, batch_count, scalars, (T*)work1, (T*)work2,
@@ -331,11 +336,17 @@ rocblas_status rocsolver_syevdx_heevdx_inplace_template(rocblas_handle handle,
     }
 
     // copy nev from device to host
+    // (with async_nev, the copy is left in the stream and the caller must synchronize the stream
+    // before reading h_nev)
     if(h_nev)
     {
         HIP_CHECK(hipMemcpyAsync(h_nev, d_nev, sizeof(rocblas_int) * batch_count,
                                  hipMemcpyDeviceToHost, stream));
-        HIP_CHECK(hipStreamSynchronize(stream));
+        if(!async_nev)
+        {
+            rocsolver_stats_host_sync();
+            HIP_CHECK(hipStreamSynchronize(stream));
+        }
     }
 
     return rocblas_status_success;
@@ -35,9 +35,12 @@
 #pragma once
 
 #include "lapack_device_functions.hpp"
+#include "lib_memory_primitives.hpp"
 #include "rocblas.hpp"
 #include "roclapack_syev_heev.hpp"
 #include "rocsolver/rocsolver.h"
+#include "rocsolver_alg_mode.hpp"
+#include "rocsolver_tuning.hpp"
 
 ROCSOLVER_BEGIN_NAMESPACE
 
@@ -47,8 +50,9 @@ ROCSOLVER_BEGIN_NAMESPACE
 #define SYEVJ_BDIM 1024 // Max number of threads per thread-block used in syevj_small kernel
 
 /** SYEVJ_SMALL_KERNEL/RUN_SYEVJ applies the Jacobi eigenvalue algorithm to matrices of size
-    n <= SYEVJ_BLOCKED_SWITCH. For each off-diagonal element A[i,j], a Jacobi rotation J is
-    calculated so that (J'AJ)[i,j] = 0. J only affects rows i and j, and J' only affects
+    n <= SYEVJ_BLOCKED_SWITCH (or n <= SYEVJ_LDS_BLOCKED_SWITCH, see syevj_use_small_kernel).
+    For each off-diagonal element A[i,j], a Jacobi rotation J is calculated so that
+    (J'AJ)[i,j] = 0. J only affects rows i and j, and J' only affects
     columns i and j. Therefore, ceil(n / 2) rotations can be computed and applied
     in parallel, so long as the rotations do not conflict between threads. We use top/bottom pairs
     to obtain i's and j's that do not conflict, and cycle them to cover all off-diagonal indices.
@@ -399,6 +403,34 @@ __host__ __device__ inline void
     *ddy = y;
 }
 
+/** SYEVJ_SMALL_LMEMSIZE returns the size of the LDS shared memory required by syevj_small_kernel.
+    If the working copy of the matrix fits in the LDS together with the other shared arrays
+    (the amount of LDS is assumed to be at least 64 * 1024 bytes), lds_copy is set to true and
+    the copy is kept in LDS; otherwise, the copy is kept in the global workspace Acpy. **/
+template <typename T, typename S>
+size_t syevj_small_lmemsize(const rocblas_int n, bool* lds_copy)
+{
+    rocblas_int even_n = n + n % 2;
+    rocblas_int half_n = even_n / 2;
+    rocblas_int ddx, ddy;
+    syevj_get_dims(n, SYEVJ_BDIM, &ddx, &ddy);
+
+    size_t lmemsize = (sizeof(S) + sizeof(T)) * ddx + 2 * sizeof(rocblas_int) * half_n;
+    size_t size_copy = sizeof(T) * n * n;
+
+    *lds_copy = (lmemsize + size_copy <= 64 * 1024);
+    return *lds_copy ? lmemsize + size_copy : lmemsize;
+}
+
+/** SYEVJ_USE_SMALL_KERNEL returns true if the eigenproblem of size n is solved with
+    syevj_small_kernel, and false if the blocked algorithm is used **/
+template <typename T, typename S>
+bool syevj_use_small_kernel(const rocblas_int n, bool* lds_copy)
+{
+    syevj_small_lmemsize<T, S>(n, lds_copy);
+    return n <= SYEVJ_BLOCKED_SWITCH || (n <= SYEVJ_LDS_BLOCKED_SWITCH && *lds_copy);
+}
+
 template <typename T, typename S, typename U>
 ROCSOLVER_KERNEL void __launch_bounds__(SYEVJ_BDIM) syevj_small_kernel(const rocblas_esort esort,
                                                                        const rocblas_evect evect,
@@ -416,7 +448,8 @@ ROCSOLVER_KERNEL void __launch_bounds__(SYEVJ_BDIM) syevj_small_kernel(const roc
                                                                        S* WW,
                                                                        const rocblas_stride strideW,
                                                                        rocblas_int* infoA,
-                                                                       T* AcpyA)
+                                                                       T* AcpyA,
+                                                                       const bool lds_copy)
 {
     rocblas_int tid = hipThreadIdx_x;
     rocblas_int bid = hipBlockIdx_z;
@@ -425,7 +458,6 @@ ROCSOLVER_KERNEL void __launch_bounds__(SYEVJ_BDIM) syevj_small_kernel(const roc
 
     // array pointers
     T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
-    T* Acpy = AcpyA + bid * n * n;
     S* W = WW + bid * strideW;
     S* residual = residualA + bid;
     rocblas_int* n_sweeps = n_sweepsA + bid;
@@ -436,8 +468,10 @@ ROCSOLVER_KERNEL void __launch_bounds__(SYEVJ_BDIM) syevj_small_kernel(const roc
     syevj_get_dims(n, SYEVJ_BDIM, &ddx, &ddy);
 
     // shared memory
+    // (the working copy of A goes first, if it is kept in LDS)
     extern __shared__ double lmem[];
-    S* cosines_res = reinterpret_cast<S*>(lmem);
+    T* Acpy = lds_copy ? reinterpret_cast<T*>(lmem) : AcpyA + bid * n * n;
+    S* cosines_res = lds_copy ? reinterpret_cast<S*>(Acpy + n * n) : reinterpret_cast<S*>(lmem);
     T* sines_diag = reinterpret_cast<T*>(cosines_res + ddx);
     rocblas_int* top = reinterpret_cast<rocblas_int*>(sines_diag + ddx);
     rocblas_int* bottom = top + half_n;
@@ -1298,6 +1332,127 @@ ROCSOLVER_KERNEL void syevj_finalize(const rocblas_esort esort,
     }
 }
 
+/************** Kernels and device functions for block Jacobi *****************/
+/*****************************************************************************/
+
+/** SYEVJ_USE_GEMM returns true if the eigenproblem of size n is solved with the block Jacobi
+    algorithm, which applies the block rotations with GEMM **/
+inline bool syevj_use_gemm(const rocblas_int n)
+{
+    return n > SYEVJ_GEMM_SWITCH;
+}
+
+/** SYEVJ_SWEEPS_PER_SYNC returns the number of sweeps between the host checks of convergence of
+    the blocked algorithms, or 0 if the host does not check (tunable by the user, defined in
+    ideal_sizes.hpp) **/
+inline rocblas_int syevj_sweeps_per_sync(const rocblas_int batch_count)
+{
+    rocblas_int size[] = {SYEVJ_SYNC_SWEEPS};
+    rocblas_int intervals[] = {SYEVJ_SYNC_INTERVALS};
+    rocblas_int max = SYEVJ_SYNC_NUM_INTERVALS;
+    return get_tuned_blksize("syevj_sync", size, intervals, max, batch_count);
+}
+
+/** SYEVJ_GEMM_INDEX returns the row (or column) of the original matrix that corresponds to row
+    (or column) k of the permuted matrix. In the permuted matrix, the two blocks of size nb given by
+    the p-th top/bottom pair are contiguous, starting at row (or column) 2 * nb * p. The returned
+    index is >= n for the padding. **/
+__device__ inline rocblas_int syevj_gemm_index(const rocblas_int k,
+                                              const rocblas_int nb,
+                                              rocblas_int* top,
+                                              rocblas_int* bottom)
+{
+    rocblas_int p = k / (2 * nb);
+    rocblas_int r = k % (2 * nb);
+    rocblas_int blk = (r < nb ? top[p] : bottom[p]);
+    return blk * nb + r % nb;
+}
+
+/** SYEVJ_GEMM_GATHER copies the m-by-n matrix A into the m_p-by-n_p matrix Ap (with leading
+    dimension m_p), permuting its columns (and also its rows if PERM_ROWS) so that the blocks of
+    each top/bottom pair are contiguous, and padding with zeros. If Q is not null, the diagonal
+    2nb-by-2nb blocks of Ap (the pair subproblems) are also copied into Q.
+
+    Call this kernel with batch_count groups in z, and an array of threads covering Ap in x
+    and y **/
+template <bool PERM_ROWS, typename T, typename U>
+ROCSOLVER_KERNEL void syevj_gemm_gather(const rocblas_int m,
+                                        const rocblas_int n,
+                                        const rocblas_int nb,
+                                        const rocblas_int m_p,
+                                        const rocblas_int n_p,
+                                        U AA,
+                                        const rocblas_int shiftA,
+                                        const rocblas_int lda,
+                                        const rocblas_stride strideA,
+                                        T* ApA,
+                                        T* QA,
+                                        rocblas_int* top,
+                                        rocblas_int* bottom)
+{
+    const auto b = hipBlockIdx_z;
+    const auto j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+    const auto i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(i < m_p && j < n_p)
+    {
+        rocblas_int si = (PERM_ROWS ? syevj_gemm_index(i, nb, top, bottom) : i);
+        rocblas_int sj = syevj_gemm_index(j, nb, top, bottom);
+
+        T* A = load_ptr_batch<T>(AA, b, shiftA, strideA);
+        T a = (si < m && sj < n ? A[si + sj * lda] : T(0));
+        ApA[b * rocblas_stride(m_p) * n_p + i + j * rocblas_stride(m_p)] = a;
+
+        rocblas_int nb2 = 2 * nb;
+        if(QA && i / nb2 == j / nb2)
+        {
+            rocblas_int half_blocks = n_p / nb2;
+            rocblas_stride q = rocblas_stride(b) * half_blocks + j / nb2;
+            QA[q * nb2 * nb2 + (i % nb2) + (j % nb2) * nb2] = a;
+        }
+    }
+}
+
+/** SYEVJ_GEMM_SCATTER copies the permuted matrix Ap back into A, undoing the permutation applied
+    by SYEVJ_GEMM_GATHER. Converged problems are left unchanged.
+
+    Call this kernel with batch_count groups in z, and an array of threads covering Ap in x
+    and y **/
+template <bool PERM_ROWS, typename T, typename U>
+ROCSOLVER_KERNEL void syevj_gemm_scatter(const rocblas_int m,
+                                         const rocblas_int n,
+                                         const rocblas_int nb,
+                                         const rocblas_int m_p,
+                                         const rocblas_int n_p,
+                                         T* ApA,
+                                         U AA,
+                                         const rocblas_int shiftA,
+                                         const rocblas_int lda,
+                                         const rocblas_stride strideA,
+                                         rocblas_int* top,
+                                         rocblas_int* bottom,
+                                         rocblas_int* completed)
+{
+    const auto b = hipBlockIdx_z;
+    const auto j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+    const auto i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(completed[b + 1])
+        return;
+
+    if(i < m_p && j < n_p)
+    {
+        rocblas_int si = (PERM_ROWS ? syevj_gemm_index(i, nb, top, bottom) : i);
+        rocblas_int sj = syevj_gemm_index(j, nb, top, bottom);
+
+        if(si < m && sj < n)
+        {
+            T* A = load_ptr_batch<T>(AA, b, shiftA, strideA);
+            A[si + sj * lda] = ApA[b * rocblas_stride(m_p) * n_p + i + j * rocblas_stride(m_p)];
+        }
+    }
+}
+
 /****** Template function, workspace size and argument validation **********/
 /***************************************************************************/
 
@@ -1327,9 +1482,12 @@ void rocsolver_syevj_heevj_getMemorySize(const rocblas_evect evect,
     }
 
     // size of temporary workspace for copying A
-    *size_Acpy = sizeof(T) * n * n * batch_count;
+    // (not needed if the small-size kernel keeps the copy in LDS)
+    bool lds_copy;
+    bool small = syevj_use_small_kernel<T, S>(n, &lds_copy);
+    *size_Acpy = (small && lds_copy) ? 0 : sizeof(T) * n * n * batch_count;
 
-    if(n <= SYEVJ_BLOCKED_SWITCH)
+    if(small)
     {
         *size_J = 0;
         *size_norms = 0;
@@ -1339,6 +1497,35 @@ void rocsolver_syevj_heevj_getMemorySize(const rocblas_evect evect,
         return;
     }
 
+    if(syevj_use_gemm(n))
+    {
+        rocblas_int nb = SYEVJ_GEMM_BLOCKSIZE;
+        rocblas_int blocks = (n - 1) / nb + 1;
+        rocblas_int half_blocks = (blocks - 1) / 2 + 1;
+        size_t n_p = size_t(2 * nb) * half_blocks;
+        size_t subs = size_t(half_blocks) * batch_count;
+
+        // size of temporary workspace to store the permuted matrix, the result of the products,
+        // and the block rotations (and the working copies of the pair subproblems, if they do not
+        // fit in LDS)
+        bool sub_lds;
+        syevj_small_lmemsize<T, S>(2 * nb, &sub_lds);
+        *size_J = sizeof(T) * (2 * n_p * n_p + (sub_lds ? 1 : 2) * n_p * 2 * nb) * batch_count;
+
+        // size of temporary workspace to store the full matrix norm, and the residuals and
+        // eigenvalues of the pair subproblems
+        *size_norms = sizeof(S) * (batch_count + subs + n_p * batch_count);
+
+        // size of arrays for temporary top/bottom pairs
+        *size_top = sizeof(rocblas_int) * half_blocks * batch_count;
+        *size_bottom = sizeof(rocblas_int) * half_blocks * batch_count;
+
+        // size of temporary workspace to indicate problem completion, and the number of sweeps
+        // and info of the pair subproblems
+        *size_completed = sizeof(rocblas_int) * (batch_count + 1 + 2 * subs);
+        return;
+    }
+
     rocblas_int half_n = (n - 1) / 2 + 1;
     rocblas_int blocks = (n - 1) / BS2 + 1;
     rocblas_int half_blocks = (blocks - 1) / 2 + 1;
@@ -1463,23 +1650,172 @@ rocblas_status rocsolver_syevj_heevj_template(rocblas_handle handle,
     S atol = (abstol <= 0 ? eps : abstol);
 
     // local variables
-    rocblas_int even_n = n + n % 2;
-    rocblas_int half_n = even_n / 2;
-
-    if(n <= SYEVJ_BLOCKED_SWITCH)
+    bool lds_copy;
+    if(syevj_use_small_kernel<T, S>(n, &lds_copy))
     {
         // *** USE SINGLE SMALL-SIZE KERNEL ***
-        // (TODO: SYEVJ_BLOCKED_SWITCH may need re-tuning as it could be larger than 64 now).
+        // (the sweeps run on all the wavefronts of the block, with the working copy of A kept in
+        // LDS whenever it fits)
 
         rocblas_int ddx, ddy;
         syevj_get_dims(n, SYEVJ_BDIM, &ddx, &ddy);
         dim3 grid(1, 1, batch_count);
         dim3 threads(ddx * ddy, 1, 1);
-        size_t lmemsize = (sizeof(S) + sizeof(T)) * ddx + 2 * sizeof(rocblas_int) * half_n;
+        size_t lmemsize = syevj_small_lmemsize<T, S>(n, &lds_copy);
 
         ROCSOLVER_LAUNCH_KERNEL(syevj_small_kernel<T>, grid, threads, lmemsize, stream, esort,
                                 evect, uplo, n, A, shiftA, lda, strideA, atol, eps, residual,
-                                max_sweeps, n_sweeps, W, strideW, info, Acpy);
+                                max_sweeps, n_sweeps, W, strideW, info, Acpy, lds_copy);
+    }
+    else if(syevj_use_gemm(n))
+    {
+        // *** USE BLOCK JACOBI ***
+        // (in each step of a sweep, the pair subproblems given by the top/bottom pairs of blocks
+        // are diagonalized with the small-size kernel, and the resulting block rotations Q are
+        // applied as A <- Q'AQ and V <- VQ with GEMM on the permuted matrices, where the
+        // blocks of each pair are contiguous)
+
+        rocblas_int nb = SYEVJ_GEMM_BLOCKSIZE;
+        rocblas_int nb2 = 2 * nb;
+        rocblas_int blocks = (n - 1) / nb + 1;
+        rocblas_int even_blocks = blocks + blocks % 2;
+        rocblas_int half_blocks = even_blocks / 2;
+        rocblas_int n_p = nb * even_blocks;
+        rocblas_int subs = half_blocks * batch_count;
+        rocblas_stride strideP = rocblas_stride(n_p) * n_p;
+
+        // workspace
+        T* Ap = J;
+        T* Tp = Ap + strideP * batch_count;
+        T* Q = Tp + strideP * batch_count;
+        T* Qcpy = Q + rocblas_stride(n_p) * nb2 * batch_count;
+        S* sub_residual = norms + batch_count;
+        S* sub_W = sub_residual + subs;
+        rocblas_int* sub_sweeps = completed + batch_count + 1;
+        rocblas_int* sub_info = sub_sweeps + subs;
+
+        // kernel dimensions
+        rocblas_int blocksReset = batch_count / BS1 + 1;
+        rocblas_int blocksP = (n_p - 1) / BS2 + 1;
+        rocblas_int blocksV = (n - 1) / BS2 + 1;
+        rocblas_int ddx, ddy;
+        syevj_get_dims(nb2, SYEVJ_BDIM, &ddx, &ddy);
+        bool sub_lds;
+        size_t lmemsizeSub = syevj_small_lmemsize<T, S>(nb2, &sub_lds);
+
+        dim3 gridReset(blocksReset, 1, 1);
+        dim3 grid(1, batch_count, 1);
+        dim3 gridP(blocksP, blocksP, batch_count);
+        dim3 gridV(blocksV, blocksP, batch_count);
+        dim3 gridSub(1, 1, subs);
+        dim3 gridPairs(1, 1, 1);
+        dim3 threadsReset(BS1, 1, 1);
+        dim3 threads(BS1, 1, 1);
+        dim3 threadsP(BS2, BS2, 1);
+        dim3 threadsSub(ddx * ddy, 1, 1);
+
+        size_t lmemsizeInit = 2 * sizeof(S) * BS1;
+        size_t lmemsizePairs = (half_blocks > BS1 ? 2 * sizeof(rocblas_int) * half_blocks : 0);
+
+        bool ev = (evect != rocblas_evect_none);
+        rocblas_int h_sweeps = 0;
+        rocblas_int h_completed = 0;
+        rocblas_int sweeps_per_sync
+            = stream_is_capturing(stream) ? 0 : syevj_sweeps_per_sync(batch_count);
+
+        // everything must be executed with scalars on the host
+        rocblas_pointer_mode old_mode;
+        rocblas_get_pointer_mode(handle, &old_mode);
+        rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+        T one = 1;
+        T zero = 0;
+
+        // set completed = 0
+        ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threadsReset, 0, stream, completed,
+                                batch_count + 1, 0);
+
+        // copy A to Acpy, set A to identity (if applicable), compute initial residual, and
+        // initialize top/bottom pairs
+        ROCSOLVER_LAUNCH_KERNEL(syevj_init<T>, grid, threads, lmemsizeInit, stream, evect, uplo,
+                                half_blocks, n, A, shiftA, lda, strideA, atol, residual, Acpy,
+                                norms, top, bottom, completed);
+
+        while(h_sweeps < max_sweeps)
+        {
+            // if all instances in the batch have finished, exit the loop
+            if(sweeps_per_sync > 0 && h_sweeps % sweeps_per_sync == 0)
+            {
+                HIP_CHECK(hipMemcpyAsync(&h_completed, completed, sizeof(rocblas_int),
+                                         hipMemcpyDeviceToHost, stream));
+                rocsolver_stats_host_sync();
+                HIP_CHECK(hipStreamSynchronize(stream));
+
+                if(h_completed == batch_count)
+                    break;
+            }
+
+            for(rocblas_int b = 0; b < even_blocks - 1; b++)
+            {
+                // permute Acpy and extract the pair subproblems
+                ROCSOLVER_LAUNCH_KERNEL((syevj_gemm_gather<true, T>), gridP, threadsP, 0, stream,
+                                        n, n, nb, n_p, n_p, Acpy, 0, n, rocblas_stride(n) * n, Ap,
+                                        Q, top, bottom);
+
+                // diagonalize the pair subproblems; Q is overwritten by the block rotations
+                ROCSOLVER_LAUNCH_KERNEL(syevj_small_kernel<T>, gridSub, threadsSub, lmemsizeSub,
+                                        stream, rocblas_esort_none, rocblas_evect_original,
+                                        rocblas_fill_lower, nb2, Q, 0, nb2,
+                                        rocblas_stride(nb2) * nb2, atol, eps, sub_residual,
+                                        max_sweeps, sub_sweeps, sub_W, rocblas_stride(nb2),
+                                        sub_info, Qcpy, sub_lds);
+
+                // Ap <- Q'ApQ, computed as (ApQ)'Q as Ap is hermitian
+                rocblasCall_gemm(handle, rocblas_operation_none, rocblas_operation_none, n_p, nb2,
+                                 nb2, &one, Ap, 0, n_p, rocblas_stride(n_p) * nb2, Q, 0, nb2,
+                                 rocblas_stride(nb2) * nb2, &zero, Tp, 0, n_p,
+                                 rocblas_stride(n_p) * nb2, subs, (T**)nullptr);
+                launch_copy_trans_mat(handle, rocblas_operation_conjugate_transpose, n_p, n_p, Tp,
+                                      0, n_p, strideP, Ap, 0, n_p, strideP, batch_count);
+                rocblasCall_gemm(handle, rocblas_operation_none, rocblas_operation_none, n_p, nb2,
+                                 nb2, &one, Ap, 0, n_p, rocblas_stride(n_p) * nb2, Q, 0, nb2,
+                                 rocblas_stride(nb2) * nb2, &zero, Tp, 0, n_p,
+                                 rocblas_stride(n_p) * nb2, subs, (T**)nullptr);
+                ROCSOLVER_LAUNCH_KERNEL((syevj_gemm_scatter<true, T>), gridP, threadsP, 0, stream,
+                                        n, n, nb, n_p, n_p, Tp, Acpy, 0, n, rocblas_stride(n) * n,
+                                        top, bottom, completed);
+
+                // update eigenvectors, V <- VQ
+                if(ev)
+                {
+                    ROCSOLVER_LAUNCH_KERNEL((syevj_gemm_gather<false, T>), gridV, threadsP, 0,
+                                            stream, n, n, nb, n, n_p, A, shiftA, lda, strideA, Ap,
+                                            (T*)nullptr, top, bottom);
+                    rocblasCall_gemm(handle, rocblas_operation_none, rocblas_operation_none, n,
+                                     nb2, nb2, &one, Ap, 0, n, rocblas_stride(n) * nb2, Q, 0, nb2,
+                                     rocblas_stride(nb2) * nb2, &zero, Tp, 0, n,
+                                     rocblas_stride(n) * nb2, subs, (T**)nullptr);
+                    ROCSOLVER_LAUNCH_KERNEL((syevj_gemm_scatter<false, T>), gridV, threadsP, 0,
+                                            stream, n, n, nb, n, n_p, Tp, A, shiftA, lda, strideA,
+                                            top, bottom, completed);
+                }
+
+                // cycle top/bottom pairs
+                ROCSOLVER_LAUNCH_KERNEL(syevj_cycle_pairs<T>, gridPairs, threads, lmemsizePairs,
+                                        stream, half_blocks, top, bottom);
+            }
+
+            // compute new residual
+            h_sweeps++;
+            ROCSOLVER_LAUNCH_KERNEL(syevj_calc_norm<T>, grid, threads, lmemsizeInit, stream, n,
+                                    h_sweeps, residual, Acpy, norms, completed);
+        }
+
+        // set outputs and sort eigenvalues & vectors
+        ROCSOLVER_LAUNCH_KERNEL(syevj_finalize<T>, grid, threads, 0, stream, esort, evect, n, A,
+                                shiftA, lda, strideA, residual, max_sweeps, n_sweeps, W, strideW,
+                                info, Acpy, completed);
+
+        rocblas_set_pointer_mode(handle, old_mode);
     }
     else
     {
@@ -1516,6 +1852,12 @@ rocblas_status rocsolver_syevj_heevj_template(rocblas_handle handle,
         rocblas_int h_sweeps = 0;
         rocblas_int h_completed = 0;
 
+        // the sweep loop is controlled on the device (kernels return early for converged
+        // problems); host checks are only an early-exit optimization, and are not allowed
+        // while the stream is being captured into a graph
+        rocblas_int sweeps_per_sync
+            = stream_is_capturing(stream) ? 0 : syevj_sweeps_per_sync(batch_count);
+
         // set completed = 0
         ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threadsReset, 0, stream, completed,
                                 batch_count + 1, 0);
@@ -1529,12 +1871,16 @@ rocblas_status rocsolver_syevj_heevj_template(rocblas_handle handle,
         while(h_sweeps < max_sweeps)
         {
             // if all instances in the batch have finished, exit the loop
-            HIP_CHECK(hipMemcpyAsync(&h_completed, completed, sizeof(rocblas_int),
-                                     hipMemcpyDeviceToHost, stream));
-            HIP_CHECK(hipStreamSynchronize(stream));
+            if(sweeps_per_sync > 0 && h_sweeps % sweeps_per_sync == 0)
+            {
+                HIP_CHECK(hipMemcpyAsync(&h_completed, completed, sizeof(rocblas_int),
+                                         hipMemcpyDeviceToHost, stream));
+                rocsolver_stats_host_sync();
+                HIP_CHECK(hipStreamSynchronize(stream));
 
-            if(h_completed == batch_count)
-                break;
+                if(h_completed == batch_count)
+                    break;
+            }
 
             // decompose diagonal blocks
             ROCSOLVER_LAUNCH_KERNEL(syevj_diag_kernel<T>, gridDK, threadsDK, lmemsizeDK, stream, n,
@@ -1609,4 +1955,285 @@ rocblas_status rocsolver_syevj_heevj_template(rocblas_handle handle,
     return rocblas_status_success;
 }
 
+/************** Mixed-precision algorithm (double precision only) ************/
+/*****************************************************************************/
+
+/** The lower precision type used by the mixed-precision algorithm **/
+template <typename T>
+using syevj_mixed_low_t = std::conditional_t<rocblas_is_complex<T>, rocblas_float_complex, float>;
+
+/** SYEVJ_USE_MIXED determines whether the mixed-precision algorithm is used (only selected
+    with rocsolver_alg_mode_mixed for double precision types) **/
+template <typename T>
+inline bool syevj_use_mixed(const rocsolver_alg_mode alg_mode)
+{
+    return alg_mode == rocsolver_alg_mode_mixed
+        && std::is_same<decltype(std::real(T{})), double>::value;
+}
+
+template <typename Tl, typename T, std::enable_if_t<!rocblas_is_complex<T>, int> = 0>
+__device__ Tl syevj_mixed_cast(const T a)
+{
+    return Tl(a);
+}
+
+template <typename Tl, typename T, std::enable_if_t<rocblas_is_complex<T>, int> = 0>
+__device__ Tl syevj_mixed_cast(const T a)
+{
+    using Sl = decltype(std::real(Tl{}));
+    return Tl(Sl(a.real()), Sl(a.imag()));
+}
+
+/** SYEVJ_MIXED_DEMOTE copies the triangular part uplo of the hermitian matrices A into the
+    full matrices Ad (in the original precision) and into the triangular part of Al (in the
+    lower precision). The problems with an entry that overflows in the lower precision are
+    flagged in state, which must be zero on entry.
+
+    Call this kernel with batch_count groups in z, and an array of threads covering A in x and y **/
+template <typename T, typename Tl, typename U>
+ROCSOLVER_KERNEL void syevj_mixed_demote(const rocblas_fill uplo,
+                                         const rocblas_int n,
+                                         U AA,
+                                         const rocblas_int shiftA,
+                                         const rocblas_int lda,
+                                         const rocblas_stride strideA,
+                                         T* Ad,
+                                         Tl* Al,
+                                         rocblas_int* state)
+{
+    using S = decltype(std::real(T{}));
+
+    const auto b = hipBlockIdx_z;
+    const auto j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+    const auto i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const rocblas_stride strideD = rocblas_stride(n) * n;
+
+    if(i < n && j < n && (uplo == rocblas_fill_upper ? i <= j : i >= j))
+    {
+        T* A = load_ptr_batch<T>(AA, b, shiftA, strideA);
+        T a = A[i + j * lda];
+
+        Ad[b * strideD + i + j * n] = a;
+        if(i != j)
+            Ad[b * strideD + j + i * n] = conj(a);
+        Al[b * strideD + i + j * n] = syevj_mixed_cast<Tl>(a);
+
+        if(std::abs(a) > S(std::numeric_limits<float>::max()))
+            state[b] = 1;
+    }
+}
+
+/** SYEVJ_MIXED_PROMOTE copies the eigenvectors Al obtained in the lower precision into V (in the
+    original precision). V is set to the identity for the problems flagged in state, which are
+    then solved in the original precision from the start.
+
+    Call this kernel with batch_count groups in z, and an array of threads covering V in x and y **/
+template <typename T, typename Tl>
+ROCSOLVER_KERNEL void syevj_mixed_promote(const rocblas_int n, Tl* Al, T* V, rocblas_int* state)
+{
+    const auto b = hipBlockIdx_z;
+    const auto j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+    const auto i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const rocblas_stride strideV = rocblas_stride(n) * n;
+
+    if(i < n && j < n)
+    {
+        if(state[b])
+            V[b * strideV + i + j * n] = (i == j ? T(1) : T(0));
+        else
+            V[b * strideV + i + j * n] = syevj_mixed_cast<T>(Al[b * strideV + i + j * n]);
+    }
+}
+
+/** Size of the extra workspace used by the mixed-precision algorithm: four n-by-n matrices in
+    the original precision, one n-by-n matrix and the eigenvalues and residual in the lower
+    precision, and the number of sweeps, info and overflow flags of the lower precision stage **/
+template <typename T>
+size_t syevj_mixed_size(const rocblas_int n, const rocblas_int batch_count)
+{
+    using Tl = syevj_mixed_low_t<T>;
+    using Sl = decltype(std::real(Tl{}));
+
+    if(n <= 1 || batch_count == 0)
+        return 0;
+
+    size_t nn = size_t(n) * n;
+    return (sizeof(T) * 4 * nn + sizeof(Tl) * nn + sizeof(Sl) * (n + 1) + sizeof(rocblas_int) * 3)
+        * batch_count;
+}
+
+/** Workspace of the mixed-precision algorithm. The arrays shared with the default algorithm take
+    the largest size required by either precision, and the extra workspace size_mixed is computed
+    by syevj_mixed_size. If !mixed, the sizes of the default algorithm are returned. **/
+template <bool BATCHED, typename T, typename S>
+void rocsolver_syevj_heevj_mixed_getMemorySize(const bool mixed,
+                                               const rocblas_evect evect,
+                                               const rocblas_fill uplo,
+                                               const rocblas_int n,
+                                               const rocblas_int batch_count,
+                                               size_t* size_Acpy,
+                                               size_t* size_J,
+                                               size_t* size_norms,
+                                               size_t* size_top,
+                                               size_t* size_bottom,
+                                               size_t* size_completed,
+                                               size_t* size_mixed)
+{
+    using Tl = syevj_mixed_low_t<T>;
+    using Sl = decltype(std::real(Tl{}));
+
+    rocsolver_syevj_heevj_getMemorySize<BATCHED, T, S>(evect, uplo, n, batch_count, size_Acpy,
+                                                       size_J, size_norms, size_top, size_bottom,
+                                                       size_completed);
+    *size_mixed = 0;
+    if(!mixed)
+        return;
+
+    // requirements of the lower precision stage (which always computes the eigenvectors)
+    size_t w1, w2, w3, w4, w5, w6;
+    rocsolver_syevj_heevj_getMemorySize<false, Tl, Sl>(rocblas_evect_original, uplo, n,
+                                                        batch_count, &w1, &w2, &w3, &w4, &w5, &w6);
+    *size_Acpy = std::max(*size_Acpy, w1);
+    *size_J = std::max(*size_J, w2);
+    *size_norms = std::max(*size_norms, w3);
+    *size_top = std::max(*size_top, w4);
+    *size_bottom = std::max(*size_bottom, w5);
+    *size_completed = std::max(*size_completed, w6);
+
+    *size_mixed = syevj_mixed_size<T>(n, batch_count);
+}
+
+/** The mixed-precision algorithm first applies the Jacobi method in single precision to a copy
+    of A, until the off-diagonal part is about SYEVJ_MIXED_TOL_FACTOR * FLT_EPSILON times the norm
+    of the matrix. The resulting eigenvectors V are orthogonalized in double precision with
+    SYEVJ_MIXED_ORTH_ITERS Newton-Schulz iterations, and the Jacobi method is applied in double
+    precision to the (nearly diagonal) matrix V'AV, which converges in one or two sweeps. The
+    eigenvectors of A are then obtained as V times those of V'AV.
+
+    residual, n_sweeps and info refer to the double precision sweeps. (Workspace as given by
+    rocsolver_syevj_heevj_mixed_getMemorySize) **/
+template <bool BATCHED, bool STRIDED, typename T, typename S, typename U>
+rocblas_status rocsolver_syevj_heevj_mixed_template(rocblas_handle handle,
+                                                    const rocblas_esort esort,
+                                                    const rocblas_evect evect,
+                                                    const rocblas_fill uplo,
+                                                    const rocblas_int n,
+                                                    U A,
+                                                    const rocblas_int shiftA,
+                                                    const rocblas_int lda,
+                                                    const rocblas_stride strideA,
+                                                    const S abstol,
+                                                    S* residual,
+                                                    const rocblas_int max_sweeps,
+                                                    rocblas_int* n_sweeps,
+                                                    S* W,
+                                                    const rocblas_stride strideW,
+                                                    rocblas_int* info,
+                                                    const rocblas_int batch_count,
+                                                    T* Acpy,
+                                                    T* J,
+                                                    S* norms,
+                                                    rocblas_int* top,
+                                                    rocblas_int* bottom,
+                                                    rocblas_int* completed,
+                                                    void* mixed)
+{
+    using Tl = syevj_mixed_low_t<T>;
+    using Sl = decltype(std::real(Tl{}));
+
+    ROCSOLVER_ENTER("syevj_heevj_mixed", "esort:", esort, "evect:", evect, "uplo:", uplo, "n:", n,
+                    "shiftA:", shiftA, "lda:", lda, "abstol:", abstol, "max_sweeps:", max_sweeps,
+                    "bc:", batch_count);
+
+    // quick return (handled by the default algorithm)
+    if(n <= 1 || batch_count == 0)
+        return rocsolver_syevj_heevj_template<BATCHED, STRIDED, T>(
+            handle, esort, evect, uplo, n, A, shiftA, lda, strideA, abstol, residual, max_sweeps,
+            n_sweeps, W, strideW, info, batch_count, Acpy, J, norms, top, bottom, completed);
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // everything must be executed with scalars on the host
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+    T one = 1;
+    T zero = 0;
+    T minhalf = -0.5;
+    T threehalves = 1.5;
+
+    // extra workspace
+    const rocblas_stride strideD = rocblas_stride(n) * n;
+    T* Ad = (T*)mixed;
+    T* V = Ad + strideD * batch_count;
+    T* Td = V + strideD * batch_count;
+    T* X = Td + strideD * batch_count;
+    Tl* Al = (Tl*)(X + strideD * batch_count);
+    Sl* Wl = (Sl*)(Al + strideD * batch_count);
+    Sl* residual_l = Wl + n * batch_count;
+    rocblas_int* n_sweeps_l = (rocblas_int*)(residual_l + batch_count);
+    rocblas_int* info_l = n_sweeps_l + batch_count;
+    rocblas_int* state = info_l + batch_count;
+
+    rocblas_int blocksReset = (batch_count - 1) / BS1 + 1;
+    rocblas_int blocks = (n - 1) / BS2 + 1;
+    dim3 gridReset(blocksReset, 1, 1);
+    dim3 grid(blocks, blocks, batch_count);
+    dim3 threadsReset(BS1, 1, 1);
+    dim3 threads(BS2, BS2, 1);
+
+    // copy A to Ad and Al
+    ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threadsReset, 0, stream, state, batch_count, 0);
+    ROCSOLVER_LAUNCH_KERNEL((syevj_mixed_demote<T, Tl>), grid, threads, 0, stream, uplo, n, A,
+                            shiftA, lda, strideA, Ad, Al, state);
+
+    // lower precision sweeps, computing the eigenvectors in Al
+    Sl atol_l = std::max(Sl(abstol), SYEVJ_MIXED_TOL_FACTOR * std::numeric_limits<Sl>::epsilon());
+    ROCBLAS_CHECK((rocsolver_syevj_heevj_template<false, true, Tl>(
+        handle, rocblas_esort_none, rocblas_evect_original, uplo, n, Al, 0, n, strideD, atol_l,
+        residual_l, max_sweeps, n_sweeps_l, Wl, rocblas_stride(n), info_l, batch_count, (Tl*)Acpy,
+        (Tl*)J, (Sl*)norms, top, bottom, completed)));
+    ROCSOLVER_LAUNCH_KERNEL((syevj_mixed_promote<T, Tl>), grid, threads, 0, stream, n, Al, V,
+                            state);
+
+    // orthogonalize V, as V <- V(3I - V'V)/2
+    for(rocblas_int k = 0; k < SYEVJ_MIXED_ORTH_ITERS; ++k)
+    {
+        launch_init_ident<T>(handle, n, n, Td, 0, n, strideD, batch_count);
+        rocblasCall_gemm(handle, rocblas_operation_conjugate_transpose, rocblas_operation_none, n,
+                         n, n, &minhalf, V, 0, n, strideD, V, 0, n, strideD, &threehalves, Td, 0,
+                         n, strideD, batch_count, (T**)nullptr);
+        rocblasCall_gemm(handle, rocblas_operation_none, rocblas_operation_none, n, n, n, &one, V,
+                         0, n, strideD, Td, 0, n, strideD, &zero, X, 0, n, strideD, batch_count,
+                         (T**)nullptr);
+        std::swap(V, X);
+    }
+
+    // Ad <- V'AV
+    rocblasCall_gemm(handle, rocblas_operation_none, rocblas_operation_none, n, n, n, &one, Ad, 0,
+                     n, strideD, V, 0, n, strideD, &zero, Td, 0, n, strideD, batch_count,
+                     (T**)nullptr);
+    rocblasCall_gemm(handle, rocblas_operation_conjugate_transpose, rocblas_operation_none, n, n,
+                     n, &one, V, 0, n, strideD, Td, 0, n, strideD, &zero, Ad, 0, n, strideD,
+                     batch_count, (T**)nullptr);
+
+    // double precision sweeps
+    ROCBLAS_CHECK((rocsolver_syevj_heevj_template<false, true, T>(
+        handle, esort, evect, uplo, n, Ad, 0, n, strideD, abstol, residual, max_sweeps, n_sweeps,
+        W, strideW, info, batch_count, Acpy, J, norms, top, bottom, completed)));
+
+    // eigenvectors of A
+    if(evect == rocblas_evect_original)
+    {
+        rocblasCall_gemm(handle, rocblas_operation_none, rocblas_operation_none, n, n, n, &one, V,
+                         0, n, strideD, Ad, 0, n, strideD, &zero, Td, 0, n, strideD, batch_count,
+                         (T**)nullptr);
+        launch_copy_mat<T>(handle, n, n, Td, 0, n, strideD, A, shiftA, lda, strideA, batch_count);
+    }
+
+    rocblas_set_pointer_mode(handle, old_mode);
+    return rocblas_status_success;
+}
+
 ROCSOLVER_END_NAMESPACE
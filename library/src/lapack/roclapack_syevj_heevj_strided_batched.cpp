@@ -51,6 +51,7 @@ rocblas_status rocsolver_syevj_heevj_strided_batched_impl(rocblas_handle handle,
     ROCSOLVER_ENTER_TOP(name, "--esort", esort, "--evect", evect, "--uplo", uplo, "-n", n, "--lda",
                         lda, "--strideA", strideA, "--abstol", abstol, "--max_sweeps", max_sweeps,
                         "--strideW", strideW, "--batch_count", batch_count);
+    ROCSOLVER_INFO_SUMMARY_SWEEPS(info, batch_count, n_sweeps, residual);
 
     if(!handle)
         return rocblas_status_invalid_handle;
@@ -64,22 +65,29 @@ rocblas_status rocsolver_syevj_heevj_strided_batched_impl(rocblas_handle handle,
     // working with unshifted arrays
     rocblas_int shiftA = 0;
 
+    // algorithm used for the eigenvalue decomposition
+    bool mixed = syevj_use_mixed<T>(get_alg_mode(handle, rocsolver_function_syevj));
+
     // memory workspace sizes:
     // size of temporary workspace
     size_t size_Acpy, size_J, size_norms, size_top, size_bottom, size_completed;
+    // extra requirements for the mixed-precision algorithm
+    size_t size_mixed;
 
-    rocsolver_syevj_heevj_getMemorySize<false, T, S>(evect, uplo, n, batch_count, &size_Acpy,
-                                                     &size_J, &size_norms, &size_top, &size_bottom,
-                                                     &size_completed);
+    rocsolver_syevj_heevj_mixed_getMemorySize<false, T, S>(mixed, evect, uplo, n, batch_count,
+                                                           &size_Acpy, &size_J, &size_norms,
+                                                           &size_top, &size_bottom,
+                                                           &size_completed, &size_mixed);
 
     if(rocblas_is_device_memory_size_query(handle))
         return rocblas_set_optimal_device_memory_size(handle, size_Acpy, size_J, size_norms,
-                                                      size_top, size_bottom, size_completed);
+                                                      size_top, size_bottom, size_completed,
+                                                      size_mixed);
 
     // memory workspace allocation
-    void *Acpy, *J, *norms, *top, *bottom, *completed;
+    void *Acpy, *J, *norms, *top, *bottom, *completed, *work_mixed;
     rocblas_device_malloc mem(handle, size_Acpy, size_J, size_norms, size_top, size_bottom,
-                              size_completed);
+                              size_completed, size_mixed);
 
     if(!mem)
         return rocblas_status_memory_error;
@@ -90,12 +98,19 @@ rocblas_status rocsolver_syevj_heevj_strided_batched_impl(rocblas_handle handle,
     top = mem[3];
     bottom = mem[4];
     completed = mem[5];
+    work_mixed = mem[6];
 
     // execution
-    return rocsolver_syevj_heevj_template<false, true, T>(
+    if(mixed)
+        return _info_summary_scope.commit(rocsolver_syevj_heevj_mixed_template<false, true, T>(
+            handle, esort, evect, uplo, n, A, shiftA, lda, strideA, abstol, residual, max_sweeps,
+            n_sweeps, W, strideW, info, batch_count, (T*)Acpy, (T*)J, (S*)norms, (rocblas_int*)top,
+            (rocblas_int*)bottom, (rocblas_int*)completed, work_mixed));
+
+    return _info_summary_scope.commit(rocsolver_syevj_heevj_template<false, true, T>(
         handle, esort, evect, uplo, n, A, shiftA, lda, strideA, abstol, residual, max_sweeps,
         n_sweeps, W, strideW, info, batch_count, (T*)Acpy, (T*)J, (S*)norms, (rocblas_int*)top,
-        (rocblas_int*)bottom, (rocblas_int*)completed);
+        (rocblas_int*)bottom, (rocblas_int*)completed));
 }
 
 ROCSOLVER_END_NAMESPACE
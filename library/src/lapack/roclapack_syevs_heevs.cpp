@@ -0,0 +1,208 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "roclapack_syevs_heevs.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+template <typename T, typename S>
+rocblas_status rocsolver_syevs_heevs_impl(rocblas_handle handle,
+                                          const rocblas_fill uplo,
+                                          const rocblas_int n,
+                                          T* A,
+                                          const rocblas_int lda,
+                                          const rocblas_int nev,
+                                          const rocblas_int k,
+                                          T* X,
+                                          const rocblas_int ldx,
+                                          const S tol,
+                                          const rocblas_int max_iter,
+                                          rocblas_int* n_iter,
+                                          S* W,
+                                          rocblas_int* info)
+{
+    const char* name = (!rocblas_is_complex<T> ? "syevs" : "heevs");
+    ROCSOLVER_ENTER_TOP(name, "--uplo", uplo, "-n", n, "--lda", lda, "--nev", nev, "-k", k,
+                        "--ldx", ldx, "--tol", tol, "--max_iter", max_iter);
+    ROCSOLVER_INFO_SUMMARY(info, 1);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_syevs_heevs_argCheck(handle, uplo, n, A, lda, nev, k, X, ldx,
+                                                       max_iter, n_iter, W, info);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+    rocblas_int shiftX = 0;
+
+    // memory workspace sizes:
+    // constants in rocblas calls (only whether they are needed, see set_device_scalars)
+    size_t size_scalars;
+    // extra requirements for calling SYEVJ/HEEVJ, GEQRF and ORGQR/UNGQR
+    size_t size_work1_Acpy, size_work2_J, size_work3_norms, size_top, size_bottom, size_completed;
+    size_t size_workArr, size_tau;
+    // size for the subspaces, the projected matrix and the Lanczos process
+    size_t size_basis, size_H, size_lanczos, size_coefs, size_iwork;
+
+    rocsolver_syevs_heevs_getMemorySize<T, S>(
+        n, k, &size_scalars, &size_work1_Acpy, &size_work2_J, &size_work3_norms, &size_top,
+        &size_bottom, &size_completed, &size_workArr, &size_tau, &size_basis, &size_H,
+        &size_lanczos, &size_coefs, &size_iwork);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(
+            handle, size_t(0), size_work1_Acpy, size_work2_J, size_work3_norms, size_top,
+            size_bottom, size_completed, size_workArr, size_tau, size_basis, size_H, size_lanczos,
+            size_coefs, size_iwork);
+
+    // memory workspace allocation
+    void *scalars, *work1_Acpy, *work2_J, *work3_norms, *top, *bottom, *completed, *workArr;
+    void *tau, *basis, *H, *lanczos, *coefs, *iwork;
+    rocblas_device_malloc mem(handle, size_t(0), size_work1_Acpy, size_work2_J,
+                              size_work3_norms, size_top, size_bottom, size_completed,
+                              size_workArr, size_tau, size_basis, size_H, size_lanczos, size_coefs,
+                              size_iwork);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    scalars = mem[0];
+    work1_Acpy = mem[1];
+    work2_J = mem[2];
+    work3_norms = mem[3];
+    top = mem[4];
+    bottom = mem[5];
+    completed = mem[6];
+    workArr = mem[7];
+    tau = mem[8];
+    basis = mem[9];
+    H = mem[10];
+    lanczos = mem[11];
+    coefs = mem[12];
+    iwork = mem[13];
+    if(size_scalars > 0)
+        ROCBLAS_CHECK(set_device_scalars<T>(scalars));
+
+    // execution
+    return _info_summary_scope.commit(rocsolver_syevs_heevs_template<T>(
+        handle, uplo, n, A, shiftA, lda, nev, k, X, shiftX, ldx, tol, max_iter, n_iter, W, info,
+        (T*)scalars, work1_Acpy, work2_J, work3_norms, (rocblas_int*)top, (rocblas_int*)bottom,
+        (rocblas_int*)completed, workArr, (T*)tau, (T*)basis, (T*)H, (T*)lanczos, (S*)coefs,
+        (rocblas_int*)iwork));
+}
+
+ROCSOLVER_END_NAMESPACE
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_ssyevs(rocblas_handle handle,
+                                const rocblas_fill uplo,
+                                const rocblas_int n,
+                                float* A,
+                                const rocblas_int lda,
+                                const rocblas_int nev,
+                                const rocblas_int k,
+                                float* X,
+                                const rocblas_int ldx,
+                                const float tol,
+                                const rocblas_int max_iter,
+                                rocblas_int* n_iter,
+                                float* W,
+                                rocblas_int* info)
+{
+    return rocsolver::rocsolver_syevs_heevs_impl<float>(handle, uplo, n, A, lda, nev, k, X, ldx,
+                                                        tol, max_iter, n_iter, W, info);
+}
+
+rocblas_status rocsolver_dsyevs(rocblas_handle handle,
+                                const rocblas_fill uplo,
+                                const rocblas_int n,
+                                double* A,
+                                const rocblas_int lda,
+                                const rocblas_int nev,
+                                const rocblas_int k,
+                                double* X,
+                                const rocblas_int ldx,
+                                const double tol,
+                                const rocblas_int max_iter,
+                                rocblas_int* n_iter,
+                                double* W,
+                                rocblas_int* info)
+{
+    return rocsolver::rocsolver_syevs_heevs_impl<double>(handle, uplo, n, A, lda, nev, k, X, ldx,
+                                                         tol, max_iter, n_iter, W, info);
+}
+
+rocblas_status rocsolver_cheevs(rocblas_handle handle,
+                                const rocblas_fill uplo,
+                                const rocblas_int n,
+                                rocblas_float_complex* A,
+                                const rocblas_int lda,
+                                const rocblas_int nev,
+                                const rocblas_int k,
+                                rocblas_float_complex* X,
+                                const rocblas_int ldx,
+                                const float tol,
+                                const rocblas_int max_iter,
+                                rocblas_int* n_iter,
+                                float* W,
+                                rocblas_int* info)
+{
+    return rocsolver::rocsolver_syevs_heevs_impl<rocblas_float_complex>(
+        handle, uplo, n, A, lda, nev, k, X, ldx, tol, max_iter, n_iter, W, info);
+}
+
+rocblas_status rocsolver_zheevs(rocblas_handle handle,
+                                const rocblas_fill uplo,
+                                const rocblas_int n,
+                                rocblas_double_complex* A,
+                                const rocblas_int lda,
+                                const rocblas_int nev,
+                                const rocblas_int k,
+                                rocblas_double_complex* X,
+                                const rocblas_int ldx,
+                                const double tol,
+                                const rocblas_int max_iter,
+                                rocblas_int* n_iter,
+                                double* W,
+                                rocblas_int* info)
+{
+    return rocsolver::rocsolver_syevs_heevs_impl<rocblas_double_complex>(
+        handle, uplo, n, A, lda, nev, k, X, ldx, tol, max_iter, n_iter, W, info);
+}
+
+} // extern C
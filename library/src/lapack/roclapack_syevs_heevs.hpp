@@ -0,0 +1,480 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "auxiliary/rocauxiliary_orgqr_ungqr.hpp"
+#include "auxiliary/rocauxiliary_lange_lansy.hpp"
+#include "rocblas.hpp"
+#include "roclapack_geqrf.hpp"
+#include "roclapack_syevj_heevj.hpp"
+#include "rocsolver/rocsolver.h"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/** SYEVS_MAX_SWEEPS is the maximum number of Jacobi sweeps used to solve the projected
+    eigenvalue problems **/
+#define SYEVS_MAX_SWEEPS 100
+
+/** SYEVS_LANCZOS_STEP carries out the j-th step of the Lanczos process. On entry, w = A * v,
+    where v is the current (unit) Lanczos vector and vprev the previous one. On exit, vprev is
+    replaced by v, v by the next Lanczos vector, and alphas[j] and betas[j] hold the entries of
+    the tridiagonal Lanczos matrix. The kernel is launched with a single thread-block. **/
+template <int MAX_THDS, typename T, typename S>
+ROCSOLVER_KERNEL void __launch_bounds__(MAX_THDS) syevs_lanczos_step(const rocblas_int n,
+                                                                     const rocblas_int j,
+                                                                     T* v,
+                                                                     T* vprev,
+                                                                     T* w,
+                                                                     S* alphas,
+                                                                     S* betas)
+{
+    const rocblas_int tid = hipThreadIdx_x;
+
+    __shared__ S sval[MAX_THDS];
+
+    // alpha = v' * w
+    S val = 0;
+    for(rocblas_int i = tid; i < n; i += MAX_THDS)
+        val += std::real(conj(v[i]) * w[i]);
+    const S alpha = lange_reduce<MAX_THDS, false>(tid, val, sval);
+    const S betap = (j > 0 ? betas[j - 1] : S(0));
+
+    // w = w - alpha * v - beta_{j-1} * vprev and beta = norm(w)
+    val = 0;
+    for(rocblas_int i = tid; i < n; i += MAX_THDS)
+    {
+        T wi = w[i] - alpha * v[i];
+        if(j > 0)
+            wi -= betap * vprev[i];
+        w[i] = wi;
+        val += std::norm(wi);
+    }
+    const S beta = sqrt(lange_reduce<MAX_THDS, false>(tid, val, sval));
+
+    // next Lanczos vector (if w vanishes, v is kept and the bound is already exact)
+    for(rocblas_int i = tid; i < n; i += MAX_THDS)
+    {
+        vprev[i] = v[i];
+        if(beta > 0)
+            v[i] = w[i] / beta;
+    }
+
+    if(tid == 0)
+    {
+        alphas[j] = alpha;
+        betas[j] = beta;
+    }
+}
+
+/** SYEVS_RESIDUAL counts the Ritz pairs (W[j], V[:,j]), j < nev, whose residuals
+    norm(AV[:,j] - W[j] * V[:,j]) are at most tol times the estimated norm of A, i.e. the largest
+    of |W[0]| and |bound|. AV and V are n-by-nev with leading dimension n. Each thread-block
+    processes one Ritz pair. **/
+template <int MAX_THDS, typename T, typename S>
+ROCSOLVER_KERNEL void __launch_bounds__(MAX_THDS) syevs_residual(const rocblas_int n,
+                                                                 T* AV,
+                                                                 T* V,
+                                                                 S* W,
+                                                                 const S tol,
+                                                                 const S bound,
+                                                                 rocblas_int* nconv)
+{
+    const rocblas_int j = hipBlockIdx_x;
+    const rocblas_int tid = hipThreadIdx_x;
+
+    T* av = AV + j * rocblas_stride(n);
+    T* v = V + j * rocblas_stride(n);
+    const S theta = W[j];
+
+    __shared__ S sval[MAX_THDS];
+
+    S val = 0;
+    for(rocblas_int i = tid; i < n; i += MAX_THDS)
+        val += std::norm(av[i] - theta * v[i]);
+    val = lange_reduce<MAX_THDS, false>(tid, val, sval);
+
+    if(tid == 0)
+    {
+        const S anorm = std::max(std::abs(W[0]), std::abs(bound));
+        if(sqrt(val) <= tol * anorm)
+            atomicAdd(nconv, 1);
+    }
+}
+
+/** SYEVS_AXPBY computes Y = alpha * X + beta * Y, where X and Y are n-by-k with leading
+    dimension n **/
+template <typename T, typename S>
+ROCSOLVER_KERNEL void syevs_axpby(const rocblas_int n,
+                                  const rocblas_int k,
+                                  const S alpha,
+                                  T* X,
+                                  const S beta,
+                                  T* Y)
+{
+    const auto j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+    const auto i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(i < n && j < k)
+    {
+        const rocblas_stride idx = i + j * rocblas_stride(n);
+        Y[idx] = alpha * X[idx] + beta * Y[idx];
+    }
+}
+
+/** Argument checking **/
+template <typename T, typename S>
+rocblas_status rocsolver_syevs_heevs_argCheck(rocblas_handle handle,
+                                              const rocblas_fill uplo,
+                                              const rocblas_int n,
+                                              T* A,
+                                              const rocblas_int lda,
+                                              const rocblas_int nev,
+                                              const rocblas_int k,
+                                              T* X,
+                                              const rocblas_int ldx,
+                                              const rocblas_int max_iter,
+                                              rocblas_int* n_iter,
+                                              S* W,
+                                              rocblas_int* info)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(n < 0 || lda < n || nev < 0 || k < nev || k > n || ldx < n || max_iter < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !A) || (n * k && !X) || (k && !W) || !n_iter || !info)
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+/** Helper to calculate workspace sizes **/
+template <typename T, typename S>
+void rocsolver_syevs_heevs_getMemorySize(const rocblas_int n,
+                                         const rocblas_int k,
+                                         size_t* size_scalars,
+                                         size_t* size_work1_Acpy,
+                                         size_t* size_work2_J,
+                                         size_t* size_work3_norms,
+                                         size_t* size_top,
+                                         size_t* size_bottom,
+                                         size_t* size_completed,
+                                         size_t* size_workArr,
+                                         size_t* size_tau,
+                                         size_t* size_basis,
+                                         size_t* size_H,
+                                         size_t* size_lanczos,
+                                         size_t* size_coefs,
+                                         size_t* size_iwork)
+{
+    // if quick return, set workspace to zero
+    if(n == 0 || k == 0)
+    {
+        *size_scalars = 0;
+        *size_work1_Acpy = 0;
+        *size_work2_J = 0;
+        *size_work3_norms = 0;
+        *size_top = 0;
+        *size_bottom = 0;
+        *size_completed = 0;
+        *size_workArr = 0;
+        *size_tau = 0;
+        *size_basis = 0;
+        *size_H = 0;
+        *size_lanczos = 0;
+        *size_coefs = 0;
+        *size_iwork = 0;
+        return;
+    }
+
+    size_t b1, b2, b3;
+    size_t c1, c2, c3;
+    size_t d1, d2, d3;
+    size_t f2, f3;
+    size_t unused;
+
+    // requirements for the projected eigenvalue problems
+    rocsolver_syevj_heevj_getMemorySize<false, T, S>(rocblas_evect_original, rocblas_fill_upper,
+                                                     k, 1, &b1, &c1, &d1, size_top,
+                                                     size_bottom, size_completed);
+
+    // requirements for the orthonormalization of the subspace
+    rocsolver_geqrf_getMemorySize<false, T>(n, k, 1, size_scalars, &b2, &c2, &d2, &f2);
+    rocsolver_orgqr_ungqr_getMemorySize<false, T>(n, k, k, 1, &unused, &b3, &c3, &d3, &f3);
+
+    *size_work1_Acpy = std::max({b1, b2, b3});
+    *size_work2_J = std::max({c1, c2, c3});
+    *size_work3_norms = std::max({d1, d2, d3});
+    *size_workArr = std::max(f2, f3);
+    *size_tau = sizeof(T) * k;
+
+    // the subspace, its product with A and the Ritz vectors, and the projected matrix
+    *size_basis = sizeof(T) * n * k * 3;
+    *size_H = sizeof(T) * k * k;
+
+    // the Lanczos vectors and coefficients (plus the residual of the Jacobi method), and the
+    // number of converged pairs (plus the number of sweeps and info of the Jacobi method)
+    rocblas_int steps = std::min(n, SYEVS_LANCZOS_STEPS);
+    *size_lanczos = sizeof(T) * n * 3;
+    *size_coefs = sizeof(S) * (2 * steps + 1);
+    *size_iwork = sizeof(rocblas_int) * 3;
+}
+
+/** Helper to replace the n-by-k matrix Q with an orthonormal basis of its column space **/
+template <typename T>
+void rocsolver_syevs_orthonormalize(rocblas_handle handle,
+                                    const rocblas_int n,
+                                    const rocblas_int k,
+                                    T* Q,
+                                    T* scalars,
+                                    void* work1,
+                                    void* work2,
+                                    void* work3,
+                                    void* workArr,
+                                    T* tau)
+{
+    rocsolver_geqrf_template<false, true, T>(handle, n, k, Q, 0, n, n * k, tau, k, 1, scalars,
+                                             work1, (T*)work2, (T*)work3, (T**)workArr);
+    rocsolver_orgqr_ungqr_template<false, true, T>(handle, n, k, k, Q, 0, n, n * k, tau, k, 1,
+                                                   scalars, (T*)work1, (T*)work2, (T*)work3,
+                                                   (T**)workArr);
+}
+
+template <typename T, typename S>
+rocblas_status rocsolver_syevs_heevs_template(rocblas_handle handle,
+                                              const rocblas_fill uplo,
+                                              const rocblas_int n,
+                                              T* A,
+                                              const rocblas_int shiftA,
+                                              const rocblas_int lda,
+                                              const rocblas_int nev,
+                                              const rocblas_int k,
+                                              T* X,
+                                              const rocblas_int shiftX,
+                                              const rocblas_int ldx,
+                                              const S tol,
+                                              const rocblas_int max_iter,
+                                              rocblas_int* n_iter,
+                                              S* W,
+                                              rocblas_int* info,
+                                              T* scalars,
+                                              void* work1_Acpy,
+                                              void* work2_J,
+                                              void* work3_norms,
+                                              rocblas_int* top,
+                                              rocblas_int* bottom,
+                                              rocblas_int* completed,
+                                              void* workArr,
+                                              T* tau,
+                                              T* basis,
+                                              T* H,
+                                              T* lanczos,
+                                              S* coefs,
+                                              rocblas_int* iwork)
+{
+    ROCSOLVER_ENTER("syevs_heevs", "uplo:", uplo, "n:", n, "shiftA:", shiftA, "lda:", lda,
+                    "nev:", nev, "k:", k, "shiftX:", shiftX, "ldx:", ldx, "tol:", tol,
+                    "max_iter:", max_iter);
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // quick return
+    if(n == 0 || k == 0)
+    {
+        ROCSOLVER_LAUNCH_KERNEL(reset_info, dim3(1, 1, 1), dim3(1, 1, 1), 0, stream, n_iter, 1, 0);
+        ROCSOLVER_LAUNCH_KERNEL(reset_info, dim3(1, 1, 1), dim3(1, 1, 1), 0, stream, info, 1, 0);
+        return rocblas_status_success;
+    }
+
+    // everything must be executed with scalars on the host
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+
+    T one = T(1);
+    T zero = T(0);
+    const S rtol = (tol > 0 ? tol : std::sqrt(get_epsilon<S>()));
+
+    // all the n-by-k blocks have leading dimension n
+    rocblas_int blocks_n = (n - 1) / BS2 + 1;
+    rocblas_int blocks_k = (k - 1) / BS2 + 1;
+    dim3 gridBlk(blocks_n, blocks_k, 1);
+    dim3 threadsBlk(BS2, BS2, 1);
+    rocblas_stride strideQ = rocblas_stride(n) * k;
+
+    // Q holds the current subspace, AQ its product with A, and V the Ritz vectors
+    T* Q = basis;
+    T* AQ = basis + strideQ;
+    T* V = basis + 2 * strideQ;
+
+    // outputs of the Jacobi method and number of converged pairs
+    rocblas_int steps = std::min(n, SYEVS_LANCZOS_STEPS);
+    S* alphas = coefs;
+    S* betas = coefs + steps;
+    S* residual = coefs + 2 * steps;
+    rocblas_int* nconv = iwork;
+    rocblas_int* sweeps = iwork + 1;
+    rocblas_int* jinfo = iwork + 2;
+
+    // initial subspace
+    ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, gridBlk, threadsBlk, 0, stream, n, k, X, shiftX, ldx, 0,
+                            Q, 0, n, 0);
+    rocsolver_syevs_orthonormalize<T>(handle, n, k, Q, scalars, work1_Acpy, work2_J, work3_norms,
+                                      workArr, tau);
+
+    // estimate an upper bound of the spectrum with a few Lanczos steps started from the first
+    // basis vector (Gershgorin bound of the Lanczos matrix, including the last residual)
+    T* v = lanczos;
+    T* vprev = lanczos + n;
+    T* w = lanczos + 2 * n;
+    HIP_CHECK(hipMemcpyAsync(v, Q, sizeof(T) * n, hipMemcpyDeviceToDevice, stream));
+    for(rocblas_int j = 0; j < steps; j++)
+    {
+        rocblasCall_symm_hemm(handle, rocblas_side_left, uplo, n, 1, &one, A, shiftA, lda, 0, v, 0,
+                              n, 0, &zero, w, 0, n, 0, 1);
+        ROCSOLVER_LAUNCH_KERNEL((syevs_lanczos_step<BS1, T>), dim3(1, 1, 1), dim3(BS1, 1, 1), 0,
+                                stream, n, j, v, vprev, w, alphas, betas);
+    }
+
+    std::vector<S> hcoefs(2 * steps);
+    HIP_CHECK(hipMemcpyAsync(hcoefs.data(), coefs, sizeof(S) * 2 * steps, hipMemcpyDeviceToHost,
+                             stream));
+    rocsolver_stats_host_sync();
+    HIP_CHECK(hipStreamSynchronize(stream));
+
+    S bound = -std::numeric_limits<S>::max();
+    for(rocblas_int j = 0; j < steps; j++)
+    {
+        S radius = hcoefs[steps + j] + (j > 0 ? hcoefs[steps + j - 1] : S(0));
+        bound = std::max(bound, hcoefs[j] + radius);
+    }
+
+    rocblas_int hnconv = 0;
+    rocblas_int it = 0;
+    while(true)
+    {
+        // Rayleigh-Ritz projection onto the (orthonormal) subspace: H = Q' * A * Q
+        rocblasCall_symm_hemm(handle, rocblas_side_left, uplo, n, k, &one, A, shiftA, lda, 0, Q,
+                              0, n, strideQ, &zero, AQ, 0, n, strideQ, 1);
+        rocblasCall_gemm(handle, rocblas_operation_conjugate_transpose, rocblas_operation_none, k,
+                         k, n, &one, Q, 0, n, strideQ, AQ, 0, n, strideQ, &zero, H, 0, k, k * k,
+                         1, (T**)workArr);
+
+        rocsolver_syevj_heevj_template<false, false, T>(
+            handle, rocblas_esort_ascending, rocblas_evect_original, rocblas_fill_upper, k, H, 0,
+            k, k * k, S(0), residual, SYEVS_MAX_SWEEPS, sweeps, W, k, jinfo, 1, (T*)work1_Acpy,
+            (T*)work2_J, (S*)work3_norms, top, bottom, completed);
+
+        // Ritz vectors V = Q * H and their products with A (stored in Q)
+        rocblasCall_gemm(handle, rocblas_operation_none, rocblas_operation_none, n, k, k, &one, Q,
+                         0, n, strideQ, H, 0, k, k * k, &zero, V, 0, n, strideQ, 1, (T**)workArr);
+        rocblasCall_gemm(handle, rocblas_operation_none, rocblas_operation_none, n, k, k, &one,
+                         AQ, 0, n, strideQ, H, 0, k, k * k, &zero, Q, 0, n, strideQ, 1,
+                         (T**)workArr);
+
+        // count the converged wanted pairs
+        S hW[2] = {0, 0};
+        ROCSOLVER_LAUNCH_KERNEL(reset_info, dim3(1, 1, 1), dim3(1, 1, 1), 0, stream, nconv, 1, 0);
+        if(nev > 0)
+            ROCSOLVER_LAUNCH_KERNEL((syevs_residual<BS1, T>), dim3(nev, 1, 1), dim3(BS1, 1, 1), 0,
+                                    stream, n, Q, V, W, rtol, bound, nconv);
+
+        HIP_CHECK(hipMemcpyAsync(&hnconv, nconv, sizeof(rocblas_int), hipMemcpyDeviceToHost,
+                                 stream));
+        HIP_CHECK(hipMemcpyAsync(hW, W, sizeof(S), hipMemcpyDeviceToHost, stream));
+        HIP_CHECK(hipMemcpyAsync(hW + 1, W + k - 1, sizeof(S), hipMemcpyDeviceToHost, stream));
+        rocsolver_stats_host_sync();
+        HIP_CHECK(hipStreamSynchronize(stream));
+
+        if(hnconv >= nev || it >= max_iter)
+            break;
+
+        // the Ritz values bound the part of the spectrum that is not damped by the filter
+        S a0 = hW[0];
+        S a = hW[1];
+        S b = std::max(bound, a);
+        if(!(b > a))
+            break;
+
+        // Chebyshev filter of degree SYEVS_FILTER_DEGREE mapping [a, b] onto [-1, 1], scaled so
+        // that the component along the lowest Ritz value stays close to 1. The three-term
+        // recurrence is carried out in place on V (previous term) and Q (current term).
+        S e = (b - a) / 2;
+        S c = (b + a) / 2;
+        S sigma = e / (a0 - c);
+        S tau2 = 2 / sigma;
+
+        T* P0 = V;
+        T* P1 = Q;
+        ROCSOLVER_LAUNCH_KERNEL((syevs_axpby<T, S>), gridBlk, threadsBlk, 0, stream, n, k,
+                                -sigma * c / e, P0, sigma / e, P1);
+        for(rocblas_int d = 1; d < SYEVS_FILTER_DEGREE; d++)
+        {
+            S sigma_new = 1 / (tau2 - sigma);
+            T alpha = T(2 * sigma_new / e);
+            T beta = T(-sigma * sigma_new);
+
+            rocblasCall_symm_hemm(handle, rocblas_side_left, uplo, n, k, &alpha, A, shiftA, lda,
+                                  0, P1, 0, n, strideQ, &beta, P0, 0, n, strideQ, 1);
+            ROCSOLVER_LAUNCH_KERNEL((syevs_axpby<T, S>), gridBlk, threadsBlk, 0, stream, n, k,
+                                    -2 * sigma_new * c / e, P1, S(1), P0);
+
+            std::swap(P0, P1);
+            sigma = sigma_new;
+        }
+        Q = P1;
+        V = P0;
+
+        rocsolver_syevs_orthonormalize<T>(handle, n, k, Q, scalars, work1_Acpy, work2_J,
+                                          work3_norms, workArr, tau);
+        it++;
+    }
+
+    // return the Ritz vectors, the number of iterations and the number of unconverged pairs
+    ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, gridBlk, threadsBlk, 0, stream, n, k, V, 0, n, 0, X,
+                            shiftX, ldx, 0);
+    ROCSOLVER_LAUNCH_KERNEL(reset_info, dim3(1, 1, 1), dim3(1, 1, 1), 0, stream, n_iter, 1, it);
+    ROCSOLVER_LAUNCH_KERNEL(reset_info, dim3(1, 1, 1), dim3(1, 1, 1), 0, stream, info, 1,
+                            std::max(nev - hnconv, 0));
+
+    rocblas_set_pointer_mode(handle, old_mode);
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
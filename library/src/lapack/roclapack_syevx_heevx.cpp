@@ -53,6 +53,7 @@ rocblas_status rocsolver_syevx_heevx_impl(rocblas_handle handle,
     ROCSOLVER_ENTER_TOP(name, "--evect", evect, "--erange", erange, "--uplo", uplo, "-n", n,
                         "--lda", lda, "--vl", vl, "--vu", vu, "--il", il, "--iu", iu, "--abstol",
                         abstol, "--ldz", ldz);
+    ROCSOLVER_INFO_SUMMARY(info, 1);
 
     if(!handle)
         return rocblas_status_invalid_handle;
@@ -75,7 +76,7 @@ rocblas_status rocsolver_syevx_heevx_impl(rocblas_handle handle,
     rocblas_int batch_count = 1;
 
     // memory workspace sizes:
-    // size for constants in rocblas calls
+    // constants in rocblas calls (only whether they are needed, see set_device_scalars)
     size_t size_scalars;
     // size of reusable workspaces (for calling SYTRD/HETRD, STEBZ, STEIN, and ORMTR/UNMTR)
     size_t size_work1, size_work2, size_work3, size_work4, size_work5, size_work6;
@@ -89,13 +90,13 @@ rocblas_status rocsolver_syevx_heevx_impl(rocblas_handle handle,
 
     if(rocblas_is_device_memory_size_query(handle))
         return rocblas_set_optimal_device_memory_size(
-            handle, size_scalars, size_work1, size_work2, size_work3, size_work4, size_work5,
+            handle, size_t(0), size_work1, size_work2, size_work3, size_work4, size_work5,
             size_work6, size_D, size_E, size_iblock, size_isplit_map, size_tau, size_nsplit_workArr);
 
     // memory workspace allocation
     void *scalars, *work1, *work2, *work3, *work4, *work5, *work6, *D, *E, *iblock, *isplit_map,
         *tau, *nsplit_workArr;
-    rocblas_device_malloc mem(handle, size_scalars, size_work1, size_work2, size_work3, size_work4,
+    rocblas_device_malloc mem(handle, size_t(0), size_work1, size_work2, size_work3, size_work4,
                               size_work5, size_work6, size_D, size_E, size_iblock, size_isplit_map,
                               size_tau, size_nsplit_workArr);
 
@@ -116,14 +117,14 @@ rocblas_status rocsolver_syevx_heevx_impl(rocblas_handle handle,
     tau = mem[11];
     nsplit_workArr = mem[12];
     if(size_scalars > 0)
-        init_scalars(handle, (T*)scalars);
+        ROCBLAS_CHECK(set_device_scalars<T>(scalars));
 
     // execution
-    return rocsolver_syevx_heevx_template<false, false, T>(
+    return _info_summary_scope.commit(rocsolver_syevx_heevx_template<false, false, T>(
         handle, evect, erange, uplo, n, A, shiftA, lda, strideA, vl, vu, il, iu, abstol, nev, W,
         strideW, Z, shiftZ, ldz, strideZ, ifail, strideF, info, batch_count, (T*)scalars, work1,
         work2, work3, work4, work5, work6, (S*)D, (S*)E, (rocblas_int*)iblock,
-        (rocblas_int*)isplit_map, (T*)tau, nsplit_workArr);
+        (rocblas_int*)isplit_map, (T*)tau, nsplit_workArr));
 }
 
 ROCSOLVER_END_NAMESPACE
@@ -39,6 +39,8 @@
 #include "roclapack_sytrd_hetrd.hpp"
 #include "rocsolver/rocsolver.h"
 
+#include <numeric>
+
 ROCSOLVER_BEGIN_NAMESPACE
 
 template <typename T>
@@ -176,7 +178,180 @@ ROCSOLVER_KERNEL void __launch_bounds__(BS1) syevx_sort_eigs(const rocblas_int n
     __syncthreads();
 }
 
+/** SYEVX_NEV_OFFSETS computes the exclusive prefix sum of nev over the batch. The result is the
+    compacted list of (problem, vector) pairs in compressed form: the eigenvectors of problem bid
+    take the positions offsets[bid] to offsets[bid] + nev[bid] - 1 of the list.
+    Call this kernel with a single group of BS1 threads. **/
+ROCSOLVER_KERNEL void __launch_bounds__(BS1)
+    syevx_nev_offsets(const rocblas_int* nev, rocblas_int* offsets, const rocblas_int batch_count)
+{
+    __shared__ rocblas_int sval[BS1];
+    const rocblas_int tid = hipThreadIdx_x;
+    rocblas_int carry = 0;
+
+    for(rocblas_int base = 0; base < batch_count; base += BS1)
+    {
+        const rocblas_int bid = base + tid;
+        const rocblas_int v = (bid < batch_count) ? nev[bid] : 0;
+        sval[tid] = v;
+        __syncthreads();
+
+        // inclusive scan of the current chunk
+        for(rocblas_int s = 1; s < BS1; s *= 2)
+        {
+            rocblas_int t = (tid >= s) ? sval[tid - s] : 0;
+            __syncthreads();
+            sval[tid] += t;
+            __syncthreads();
+        }
+
+        if(bid < batch_count)
+            offsets[bid] = carry + sval[tid] - v;
+        carry += sval[BS1 - 1];
+        __syncthreads();
+    }
+}
+
+/** SYEVX_APPLY_Q_COMPACT applies the unitary matrix Q of the tridiagonal reduction (as returned
+    by sytrd/hetrd) to the eigenvectors in the compacted list of (problem, vector) pairs given by
+    offsets (see syevx_nev_offsets). Each thread group updates one eigenvector, one Householder
+    reflector at a time, so that the total work is proportional to the sum of nev over the batch.
+    Call this kernel with one group of BS1 threads per element of the list. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) syevx_apply_q_compact(const rocblas_fill uplo,
+                                                                   const rocblas_int n,
+                                                                   U AA,
+                                                                   const rocblas_int shiftA,
+                                                                   const rocblas_int lda,
+                                                                   const rocblas_stride strideA,
+                                                                   T* tauA,
+                                                                   const rocblas_stride strideP,
+                                                                   U ZZ,
+                                                                   const rocblas_int shiftZ,
+                                                                   const rocblas_int ldz,
+                                                                   const rocblas_stride strideZ,
+                                                                   const rocblas_int* offsets,
+                                                                   const rocblas_int batch_count)
+{
+    __shared__ T sval[BS1];
+    __shared__ rocblas_int sbid;
+    const rocblas_int tid = hipThreadIdx_x;
+    const rocblas_int pos = hipBlockIdx_x;
+
+    // find the problem owning this position of the list
+    // (the last one with offsets[bid] <= pos, as problems with nev = 0 share their offset)
+    if(tid == 0)
+    {
+        rocblas_int lo = 0, hi = batch_count - 1;
+        while(lo < hi)
+        {
+            rocblas_int mid = (lo + hi + 1) / 2;
+            if(offsets[mid] <= pos)
+                lo = mid;
+            else
+                hi = mid - 1;
+        }
+        sbid = lo;
+    }
+    __syncthreads();
+
+    const rocblas_int bid = sbid;
+    const rocblas_int j = pos - offsets[bid];
+    T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+    T* tau = tauA + bid * strideP;
+    T* z = load_ptr_batch<T>(ZZ, bid, shiftZ, strideZ) + j * ldz;
+
+    const bool lower = (uplo == rocblas_fill_lower);
+    for(rocblas_int k = 0; k < n - 1; k++)
+    {
+        // with uplo = lower, Q = H(0)*...*H(n-2) and v(i) is stored below the subdiagonal;
+        // with uplo = upper, Q = H(n-2)*...*H(0) and v(i) is stored above the superdiagonal
+        const rocblas_int i = lower ? n - 2 - k : k;
+        const rocblas_int r1 = lower ? i + 1 : 0;
+        const rocblas_int r2 = lower ? n - 1 : i;
+        const rocblas_int rone = lower ? i + 1 : i;
+        const T* v = A + (lower ? i : i + 1) * lda;
+
+        // d = v' * z
+        T d = 0;
+        for(rocblas_int r = r1 + tid; r <= r2; r += BS1)
+            d += (r == rone ? z[r] : conj(v[r]) * z[r]);
+        sval[tid] = d;
+        __syncthreads();
+        for(rocblas_int s = BS1 / 2; s > 0; s /= 2)
+        {
+            if(tid < s)
+                sval[tid] += sval[tid + s];
+            __syncthreads();
+        }
+        d = tau[i] * sval[0];
+        __syncthreads();
+
+        // z = z - tau * v * d
+        for(rocblas_int r = r1 + tid; r <= r2; r += BS1)
+            z[r] -= (r == rone ? d : v[r] * d);
+        __syncthreads();
+    }
+}
+
+/** SYEVX_USE_COMPACTION decides whether the back-transformation of the eigenvectors is done over
+    the compacted list of (problem, vector) pairs, instead of over the first ncols columns of Z of
+    every problem in the batch. nev_sum < 0 means that the sum of nev is not known on the host. **/
+inline bool syevx_use_compaction(const rocblas_int batch_count,
+                                 const rocblas_int ncols,
+                                 const rocblas_int nev_sum)
+{
+    return batch_count > 1 && nev_sum >= 0
+        && int64_t(nev_sum) * SYEVX_COMPACT_RATIO <= int64_t(batch_count) * ncols;
+}
+
+/** SYEVX_BACKTRANSFORM_NCOLS determines the number of columns of Z to which the unitary matrix
+    of the tridiagonal reduction must be applied. With erange = value, the number of eigenvalues
+    found is only known on the device; for large enough matrices it is read back, so that the
+    cost of the back-transformation scales with nev rather than with n. If requested, nev_sum
+    returns the sum of nev over the batch, or -1 when it is not known on the host. **/
+inline rocblas_status syevx_backtransform_ncols(rocblas_handle handle,
+                                                const rocblas_erange erange,
+                                                const rocblas_int n,
+                                                const rocblas_int il,
+                                                const rocblas_int iu,
+                                                rocblas_int* nev,
+                                                const rocblas_int batch_count,
+                                                rocblas_int* ncols,
+                                                rocblas_int* nev_sum = nullptr)
+{
+    if(nev_sum)
+        *nev_sum = -1;
+
+    if(erange == rocblas_erange_index)
+    {
+        *ncols = iu - il + 1;
+        return rocblas_status_success;
+    }
+
+    *ncols = n;
+    if(erange != rocblas_erange_value || n < SYEVX_READ_NEV_MIN_SIZE || batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+    if(stream_is_capturing(stream))
+        return rocblas_status_success;
+
+    std::vector<rocblas_int> hnev(batch_count);
+    HIP_CHECK(hipMemcpyAsync(hnev.data(), nev, sizeof(rocblas_int) * batch_count,
+                             hipMemcpyDeviceToHost, stream));
+    rocsolver_stats_host_sync();
+    HIP_CHECK(hipStreamSynchronize(stream));
+    *ncols = *std::max_element(hnev.begin(), hnev.end());
+    if(nev_sum)
+        *nev_sum = std::accumulate(hnev.begin(), hnev.end(), rocblas_int(0));
+
+    return rocblas_status_success;
+}
+
 /** Argument checking **/
+
 template <typename T, typename S>
 rocblas_status rocsolver_syevx_heevx_argCheck(rocblas_handle handle,
                                               const rocblas_evect evect,
@@ -401,11 +576,26 @@ rocblas_status rocsolver_syevx_heevx_template(rocblas_handle handle,
                                     strideF, info, batch_count, (S*)work1, (rocblas_int*)work2);
 
         // apply unitary matrix to eigenvectors
-        rocblas_int h_nev = (erange == rocblas_erange_index ? iu - il + 1 : n);
-        rocsolver_ormtr_unmtr_template<BATCHED, STRIDED>(
-            handle, rocblas_side_left, uplo, rocblas_operation_none, n, h_nev, A, shiftA, lda,
-            strideA, tau, stride, Z, shiftZ, ldz, strideZ, batch_count, scalars, (T*)work1,
-            (T*)work2, (T*)work3, (T**)nsplit_workArr);
+        rocblas_int h_nev, nev_sum;
+        ROCBLAS_CHECK(syevx_backtransform_ncols(handle, erange, n, il, iu, nev, batch_count,
+                                                &h_nev, &nev_sum));
+        if(syevx_use_compaction(batch_count, h_nev, nev_sum))
+        {
+            // skewed batch: work over the (problem, vector) pairs that actually exist
+            // (iblock is no longer needed and holds the offsets of the list)
+            ROCSOLVER_LAUNCH_KERNEL(syevx_nev_offsets, dim3(1, 1, 1), dim3(BS1, 1, 1), 0, stream,
+                                    nev, iblock, batch_count);
+            if(nev_sum > 0)
+                ROCSOLVER_LAUNCH_KERNEL(syevx_apply_q_compact<T>, dim3(nev_sum, 1, 1),
+                                        dim3(BS1, 1, 1), 0, stream, uplo, n, A, shiftA, lda,
+                                        strideA, tau, stride, Z, shiftZ, ldz, strideZ, iblock,
+                                        batch_count);
+        }
+        else
+            rocsolver_ormtr_unmtr_template<BATCHED, STRIDED>(
+                handle, rocblas_side_left, uplo, rocblas_operation_none, n, h_nev, A, shiftA, lda,
+                strideA, tau, stride, Z, shiftZ, ldz, strideZ, batch_count, scalars, (T*)work1,
+                (T*)work2, (T*)work3, (T**)nsplit_workArr);
 
         // sort eigenvalues and eigenvectors
         dim3 grid(1, batch_count, 1);
@@ -36,6 +36,7 @@
 #include "lapack_device_functions.hpp"
 #include "rocblas.hpp"
 #include "rocsolver/rocsolver.h"
+#include "rocsolver_run_specialized_kernels.hpp"
 
 ROCSOLVER_BEGIN_NAMESPACE
 
@@ -124,6 +125,14 @@ ROCSOLVER_KERNEL void sygs2_set_diag3(const rocblas_int k,
     }
 }
 
+/** This function determines whether the problem is reduced by a single launch of the
+    small-size kernel **/
+template <typename T>
+inline bool sygs2_use_small(const rocblas_int n)
+{
+    return n <= SYGS2_SPKER_MAX_N && n * (n + 2) <= SYGS2_SPKER_MAX_SIZE(T);
+}
+
 template <bool BATCHED, typename T>
 void rocsolver_sygs2_hegs2_getMemorySize(const rocblas_eform itype,
                                          const rocblas_int n,
@@ -228,6 +237,10 @@ rocblas_status rocsolver_sygs2_hegs2_template(rocblas_handle handle,
     if(n == 0 || batch_count == 0)
         return rocblas_status_success;
 
+    if(sygs2_use_small<T>(n))
+        return sygs2_run_small<T>(handle, itype, uplo, n, A, shiftA, lda, strideA, B, shiftB, ldb,
+                                  strideB, batch_count);
+
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
@@ -62,7 +62,7 @@ rocblas_status rocsolver_sygs2_hegs2_batched_impl(rocblas_handle handle,
     rocblas_stride strideB = 0;
 
     // memory workspace sizes:
-    // size for constants in rocblas calls
+    // constants in rocblas calls (only whether they are needed, see set_device_scalars)
     size_t size_scalars;
     // size of reusable workspace (and for calling TRSV or TRMV)
     size_t size_work, size_store_wcs;
@@ -72,12 +72,12 @@ rocblas_status rocsolver_sygs2_hegs2_batched_impl(rocblas_handle handle,
                                                  &size_store_wcs, &size_workArr);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work,
+        return rocblas_set_optimal_device_memory_size(handle, size_t(0), size_work,
                                                       size_store_wcs, size_workArr);
 
     // memory workspace allocation
     void *scalars, *work, *store_wcs, *workArr;
-    rocblas_device_malloc mem(handle, size_scalars, size_work, size_store_wcs, size_workArr);
+    rocblas_device_malloc mem(handle, size_t(0), size_work, size_store_wcs, size_workArr);
 
     if(!mem)
         return rocblas_status_memory_error;
@@ -87,7 +87,7 @@ rocblas_status rocsolver_sygs2_hegs2_batched_impl(rocblas_handle handle,
     store_wcs = mem[2];
     workArr = mem[3];
     if(size_scalars > 0)
-        init_scalars(handle, (T*)scalars);
+        ROCBLAS_CHECK(set_device_scalars<T>(scalars));
 
     // execution
     return rocsolver_sygs2_hegs2_template<true, T>(handle, itype, uplo, n, A, shiftA, lda, strideA,
@@ -39,6 +39,14 @@
 
 ROCSOLVER_BEGIN_NAMESPACE
 
+/** SYGST_HEGST_SPLIT returns the size of the leading diagonal block used by the recursive
+    algorithm: the multiple of xxGST_BLOCKSIZE closest to n/2 **/
+inline rocblas_int sygst_hegst_split(const rocblas_int n)
+{
+    rocblas_int nb = xxGST_BLOCKSIZE;
+    return std::max(nb, ((n / 2 + nb / 2) / nb) * nb);
+}
+
 template <bool BATCHED, bool STRIDED, typename T>
 void rocsolver_sygst_hegst_getMemorySize(const rocblas_fill uplo,
                                          const rocblas_eform itype,
@@ -63,7 +71,7 @@ void rocsolver_sygst_hegst_getMemorySize(const rocblas_fill uplo,
         return;
     }
 
-    if(n < xxGST_BLOCKSIZE)
+    if(n < xxGST_BLOCKSIZE || sygs2_use_small<T>(n))
     {
         // requirements for calling a single SYGS2/HEGS2
         rocsolver_sygs2_hegs2_getMemorySize<BATCHED, T>(itype, n, batch_count, size_scalars,
@@ -110,11 +118,266 @@ void rocsolver_sygst_hegst_getMemorySize(const rocblas_fill uplo,
             *size_store_wcs_invA = std::max(*size_store_wcs_invA, std::max(temp3, temp7));
             *size_invA_arr = std::max(*size_invA_arr, std::max(temp4, temp8));
         }
+
+        if(itype == rocblas_eform_ax && n > xxGST_RECURSIVE_SWITCHSIZE)
+        {
+            // extra requirements for calling TRSM in the first level of the recursive algorithm
+            rocblas_int n1 = sygst_hegst_split(n);
+            rocblas_int mm = (uplo == rocblas_fill_upper) ? n1 : n - n1;
+            rocblas_int nn = n - mm;
+            rocblas_operation transL = (uplo == rocblas_fill_upper)
+                ? rocblas_operation_conjugate_transpose
+                : rocblas_operation_none;
+            rocblas_operation transR = (uplo == rocblas_fill_upper)
+                ? rocblas_operation_none
+                : rocblas_operation_conjugate_transpose;
+
+            rocsolver_trsm_mem<BATCHED, STRIDED, T>(rocblas_side_left, transL, mm, nn, batch_count,
+                                                    &temp1, &temp2, &temp3, &temp4, optim_mem);
+            rocsolver_trsm_mem<BATCHED, STRIDED, T>(rocblas_side_right, transR, mm, nn, batch_count,
+                                                    &temp5, &temp6, &temp7, &temp8, optim_mem);
+
+            *size_work_x_temp = std::max(*size_work_x_temp, std::max(temp1, temp5));
+            *size_workArr_temp_arr = std::max(*size_workArr_temp_arr, std::max(temp2, temp6));
+            *size_store_wcs_invA = std::max(*size_store_wcs_invA, std::max(temp3, temp7));
+            *size_invA_arr = std::max(*size_invA_arr, std::max(temp4, temp8));
+        }
         else
             *optim_mem = true;
     }
 }
 
+/** SYGST_HEGST_AX_BLOCKED computes inv(U')*A*inv(U) or inv(L)*A*inv(L') (itype = 1) with the
+    blocked algorithm of LAPACK. (Scalars must be on the host.) **/
+template <bool BATCHED, bool STRIDED, typename T, typename S, typename U>
+void sygst_hegst_ax_blocked(rocblas_handle handle,
+                            const rocblas_fill uplo,
+                            const rocblas_int n,
+                            U A,
+                            const rocblas_int shiftA,
+                            const rocblas_int lda,
+                            const rocblas_stride strideA,
+                            U B,
+                            const rocblas_int shiftB,
+                            const rocblas_int ldb,
+                            const rocblas_stride strideB,
+                            const rocblas_int batch_count,
+                            T* scalars,
+                            void* work_x_temp,
+                            void* workArr_temp_arr,
+                            void* store_wcs_invA,
+                            void* invA_arr,
+                            bool optim_mem)
+{
+    const rocblas_eform itype = rocblas_eform_ax;
+    const rocblas_int nb = xxGST_BLOCKSIZE;
+
+    S s_one = 1;
+    T t_one = 1;
+    T t_minone = -1;
+    T t_minhalf = -0.5;
+
+    if(uplo == rocblas_fill_upper)
+    {
+        // Compute inv(U')*A*inv(U)
+        for(rocblas_int k = 0; k < n; k += nb)
+        {
+            rocblas_int kb = std::min(n - k, nb);
+
+            rocsolver_sygs2_hegs2_template<BATCHED, T>(
+                handle, itype, uplo, kb, A, shiftA + idx2D(k, k, lda), lda, strideA, B,
+                shiftB + idx2D(k, k, ldb), ldb, strideB, batch_count, scalars, work_x_temp,
+                store_wcs_invA, (T**)workArr_temp_arr);
+
+            if(k + kb < n)
+            {
+                rocsolver_trsm_upper<BATCHED, STRIDED, T>(
+                    handle, rocblas_side_left, rocblas_operation_conjugate_transpose,
+                    rocblas_diagonal_non_unit, kb, n - k - kb, B, shiftB + idx2D(k, k, ldb), ldb,
+                    strideB, A, shiftA + idx2D(k, k + kb, lda), lda, strideA, batch_count,
+                    optim_mem, work_x_temp, workArr_temp_arr, store_wcs_invA, invA_arr);
+
+                rocblasCall_symm_hemm(handle, rocblas_side_left, uplo, kb, n - k - kb, &t_minhalf,
+                                      A, shiftA + idx2D(k, k, lda), lda, strideA, B,
+                                      shiftB + idx2D(k, k + kb, ldb), ldb, strideB, &t_one, A,
+                                      shiftA + idx2D(k, k + kb, lda), lda, strideA, batch_count);
+
+                rocblasCall_syr2k_her2k<BATCHED, T>(
+                    handle, uplo, rocblas_operation_conjugate_transpose, n - k - kb, kb, &t_minone,
+                    A, shiftA + idx2D(k, k + kb, lda), lda, strideA, B,
+                    shiftB + idx2D(k, k + kb, ldb), ldb, strideB, &s_one, A,
+                    shiftA + idx2D(k + kb, k + kb, lda), lda, strideA, batch_count);
+
+                rocblasCall_symm_hemm(handle, rocblas_side_left, uplo, kb, n - k - kb, &t_minhalf,
+                                      A, shiftA + idx2D(k, k, lda), lda, strideA, B,
+                                      shiftB + idx2D(k, k + kb, ldb), ldb, strideB, &t_one, A,
+                                      shiftA + idx2D(k, k + kb, lda), lda, strideA, batch_count);
+
+                rocsolver_trsm_upper<BATCHED, STRIDED, T>(
+                    handle, rocblas_side_right, rocblas_operation_none, rocblas_diagonal_non_unit,
+                    kb, n - k - kb, B, shiftB + idx2D(k + kb, k + kb, ldb), ldb, strideB, A,
+                    shiftA + idx2D(k, k + kb, lda), lda, strideA, batch_count, optim_mem,
+                    work_x_temp, workArr_temp_arr, store_wcs_invA, invA_arr);
+            }
+        }
+    }
+    else
+    {
+        // Compute inv(L)*A*inv(L')
+        for(rocblas_int k = 0; k < n; k += nb)
+        {
+            rocblas_int kb = std::min(n - k, nb);
+
+            rocsolver_sygs2_hegs2_template<BATCHED, T>(
+                handle, itype, uplo, kb, A, shiftA + idx2D(k, k, lda), lda, strideA, B,
+                shiftB + idx2D(k, k, ldb), ldb, strideB, batch_count, scalars, work_x_temp,
+                store_wcs_invA, (T**)workArr_temp_arr);
+
+            if(k + kb < n)
+            {
+                rocsolver_trsm_lower<BATCHED, STRIDED, T>(
+                    handle, rocblas_side_right, rocblas_operation_conjugate_transpose,
+                    rocblas_diagonal_non_unit, n - k - kb, kb, B, shiftB + idx2D(k, k, ldb), ldb,
+                    strideB, A, shiftA + idx2D(k + kb, k, lda), lda, strideA, batch_count,
+                    optim_mem, work_x_temp, workArr_temp_arr, store_wcs_invA, invA_arr);
+
+                rocblasCall_symm_hemm(handle, rocblas_side_right, uplo, n - k - kb, kb, &t_minhalf,
+                                      A, shiftA + idx2D(k, k, lda), lda, strideA, B,
+                                      shiftB + idx2D(k + kb, k, ldb), ldb, strideB, &t_one, A,
+                                      shiftA + idx2D(k + kb, k, lda), lda, strideA, batch_count);
+
+                rocblasCall_syr2k_her2k<BATCHED, T>(
+                    handle, uplo, rocblas_operation_none, n - k - kb, kb, &t_minone, A,
+                    shiftA + idx2D(k + kb, k, lda), lda, strideA, B, shiftB + idx2D(k + kb, k, ldb),
+                    ldb, strideB, &s_one, A, shiftA + idx2D(k + kb, k + kb, lda), lda, strideA,
+                    batch_count);
+
+                rocblasCall_symm_hemm(handle, rocblas_side_right, uplo, n - k - kb, kb, &t_minhalf,
+                                      A, shiftA + idx2D(k, k, lda), lda, strideA, B,
+                                      shiftB + idx2D(k + kb, k, ldb), ldb, strideB, &t_one, A,
+                                      shiftA + idx2D(k + kb, k, lda), lda, strideA, batch_count);
+
+                rocsolver_trsm_lower<BATCHED, STRIDED, T>(
+                    handle, rocblas_side_left, rocblas_operation_none, rocblas_diagonal_non_unit,
+                    n - k - kb, kb, B, shiftB + idx2D(k + kb, k + kb, ldb), ldb, strideB, A,
+                    shiftA + idx2D(k + kb, k, lda), lda, strideA, batch_count, optim_mem,
+                    work_x_temp, workArr_temp_arr, store_wcs_invA, invA_arr);
+            }
+        }
+    }
+}
+
+/** SYGST_HEGST_AX_RECURSIVE computes inv(U')*A*inv(U) or inv(L)*A*inv(L') (itype = 1) by
+    splitting the matrix in two halves. The leading diagonal block is reduced first, then the
+    off-diagonal block and the trailing diagonal block are updated, and finally the trailing
+    diagonal block is reduced. This is the same schema of the blocked algorithm with a block
+    of size n/2, so that the updates are done with large TRSM, SYMM/HEMM and SYR2K/HER2K calls.
+    (Scalars must be on the host.) **/
+template <bool BATCHED, bool STRIDED, typename T, typename S, typename U>
+void sygst_hegst_ax_recursive(rocblas_handle handle,
+                              const rocblas_fill uplo,
+                              const rocblas_int n,
+                              U A,
+                              const rocblas_int shiftA,
+                              const rocblas_int lda,
+                              const rocblas_stride strideA,
+                              U B,
+                              const rocblas_int shiftB,
+                              const rocblas_int ldb,
+                              const rocblas_stride strideB,
+                              const rocblas_int batch_count,
+                              T* scalars,
+                              void* work_x_temp,
+                              void* workArr_temp_arr,
+                              void* store_wcs_invA,
+                              void* invA_arr,
+                              bool optim_mem)
+{
+    if(n <= xxGST_RECURSIVE_SWITCHSIZE)
+    {
+        sygst_hegst_ax_blocked<BATCHED, STRIDED, T, S>(
+            handle, uplo, n, A, shiftA, lda, strideA, B, shiftB, ldb, strideB, batch_count, scalars,
+            work_x_temp, workArr_temp_arr, store_wcs_invA, invA_arr, optim_mem);
+        return;
+    }
+
+    S s_one = 1;
+    T t_one = 1;
+    T t_minone = -1;
+    T t_minhalf = -0.5;
+
+    // size of the leading diagonal block (a multiple of xxGST_BLOCKSIZE)
+    rocblas_int n1 = sygst_hegst_split(n);
+    rocblas_int n2 = n - n1;
+
+    // reduce the leading diagonal block
+    sygst_hegst_ax_recursive<BATCHED, STRIDED, T, S>(
+        handle, uplo, n1, A, shiftA, lda, strideA, B, shiftB, ldb, strideB, batch_count, scalars,
+        work_x_temp, workArr_temp_arr, store_wcs_invA, invA_arr, optim_mem);
+
+    if(uplo == rocblas_fill_upper)
+    {
+        // update A12 and A22
+        rocsolver_trsm_upper<BATCHED, STRIDED, T>(
+            handle, rocblas_side_left, rocblas_operation_conjugate_transpose,
+            rocblas_diagonal_non_unit, n1, n2, B, shiftB, ldb, strideB, A,
+            shiftA + idx2D(0, n1, lda), lda, strideA, batch_count, optim_mem, work_x_temp,
+            workArr_temp_arr, store_wcs_invA, invA_arr);
+
+        rocblasCall_symm_hemm(handle, rocblas_side_left, uplo, n1, n2, &t_minhalf, A, shiftA, lda,
+                              strideA, B, shiftB + idx2D(0, n1, ldb), ldb, strideB, &t_one, A,
+                              shiftA + idx2D(0, n1, lda), lda, strideA, batch_count);
+
+        rocblasCall_syr2k_her2k<BATCHED, T>(
+            handle, uplo, rocblas_operation_conjugate_transpose, n2, n1, &t_minone, A,
+            shiftA + idx2D(0, n1, lda), lda, strideA, B, shiftB + idx2D(0, n1, ldb), ldb, strideB,
+            &s_one, A, shiftA + idx2D(n1, n1, lda), lda, strideA, batch_count);
+
+        rocblasCall_symm_hemm(handle, rocblas_side_left, uplo, n1, n2, &t_minhalf, A, shiftA, lda,
+                              strideA, B, shiftB + idx2D(0, n1, ldb), ldb, strideB, &t_one, A,
+                              shiftA + idx2D(0, n1, lda), lda, strideA, batch_count);
+
+        rocsolver_trsm_upper<BATCHED, STRIDED, T>(
+            handle, rocblas_side_right, rocblas_operation_none, rocblas_diagonal_non_unit, n1, n2,
+            B, shiftB + idx2D(n1, n1, ldb), ldb, strideB, A, shiftA + idx2D(0, n1, lda), lda,
+            strideA, batch_count, optim_mem, work_x_temp, workArr_temp_arr, store_wcs_invA,
+            invA_arr);
+    }
+    else
+    {
+        // update A21 and A22
+        rocsolver_trsm_lower<BATCHED, STRIDED, T>(
+            handle, rocblas_side_right, rocblas_operation_conjugate_transpose,
+            rocblas_diagonal_non_unit, n2, n1, B, shiftB, ldb, strideB, A,
+            shiftA + idx2D(n1, 0, lda), lda, strideA, batch_count, optim_mem, work_x_temp,
+            workArr_temp_arr, store_wcs_invA, invA_arr);
+
+        rocblasCall_symm_hemm(handle, rocblas_side_right, uplo, n2, n1, &t_minhalf, A, shiftA, lda,
+                              strideA, B, shiftB + idx2D(n1, 0, ldb), ldb, strideB, &t_one, A,
+                              shiftA + idx2D(n1, 0, lda), lda, strideA, batch_count);
+
+        rocblasCall_syr2k_her2k<BATCHED, T>(
+            handle, uplo, rocblas_operation_none, n2, n1, &t_minone, A, shiftA + idx2D(n1, 0, lda),
+            lda, strideA, B, shiftB + idx2D(n1, 0, ldb), ldb, strideB, &s_one, A,
+            shiftA + idx2D(n1, n1, lda), lda, strideA, batch_count);
+
+        rocblasCall_symm_hemm(handle, rocblas_side_right, uplo, n2, n1, &t_minhalf, A, shiftA, lda,
+                              strideA, B, shiftB + idx2D(n1, 0, ldb), ldb, strideB, &t_one, A,
+                              shiftA + idx2D(n1, 0, lda), lda, strideA, batch_count);
+
+        rocsolver_trsm_lower<BATCHED, STRIDED, T>(
+            handle, rocblas_side_left, rocblas_operation_none, rocblas_diagonal_non_unit, n2, n1, B,
+            shiftB + idx2D(n1, n1, ldb), ldb, strideB, A, shiftA + idx2D(n1, 0, lda), lda, strideA,
+            batch_count, optim_mem, work_x_temp, workArr_temp_arr, store_wcs_invA, invA_arr);
+    }
+
+    // reduce the trailing diagonal block
+    sygst_hegst_ax_recursive<BATCHED, STRIDED, T, S>(
+        handle, uplo, n2, A, shiftA + idx2D(n1, n1, lda), lda, strideA, B,
+        shiftB + idx2D(n1, n1, ldb), ldb, strideB, batch_count, scalars, work_x_temp,
+        workArr_temp_arr, store_wcs_invA, invA_arr, optim_mem);
+}
+
 template <bool BATCHED, bool STRIDED, typename T, typename S, typename U>
 rocblas_status rocsolver_sygst_hegst_template(rocblas_handle handle,
                                               const rocblas_eform itype,
@@ -148,8 +411,9 @@ rocblas_status rocsolver_sygst_hegst_template(rocblas_handle handle,
 
     rocblas_int nb = xxGST_BLOCKSIZE;
 
-    // if the matrix is too small, use the unblocked variant of the algorithm
-    if(n <= nb)
+    // if the matrix is too small, use the unblocked variant of the algorithm (or the small-size
+    // kernel when the whole problem fits in LDS)
+    if(n <= nb || sygs2_use_small<T>(n))
         return rocsolver_sygs2_hegs2_template<BATCHED, T>(
             handle, itype, uplo, n, A, shiftA, lda, strideA, B, shiftB, ldb, strideB, batch_count,
             scalars, work_x_temp, store_wcs_invA, (T**)workArr_temp_arr);
@@ -162,99 +426,14 @@ rocblas_status rocsolver_sygst_hegst_template(rocblas_handle handle,
     S s_one = 1;
     T t_one = 1;
     T t_half = 0.5;
-    T t_minone = -1;
-    T t_minhalf = -0.5;
 
     if(itype == rocblas_eform_ax)
     {
-        if(uplo == rocblas_fill_upper)
-        {
-            // Compute inv(U')*A*inv(U)
-            for(rocblas_int k = 0; k < n; k += nb)
-            {
-                rocblas_int kb = std::min(n - k, nb);
-
-                rocsolver_sygs2_hegs2_template<BATCHED, T>(
-                    handle, itype, uplo, kb, A, shiftA + idx2D(k, k, lda), lda, strideA, B,
-                    shiftB + idx2D(k, k, ldb), ldb, strideB, batch_count, scalars, work_x_temp,
-                    store_wcs_invA, (T**)workArr_temp_arr);
-
-                if(k + kb < n)
-                {
-                    rocsolver_trsm_upper<BATCHED, STRIDED, T>(
-                        handle, rocblas_side_left, rocblas_operation_conjugate_transpose,
-                        rocblas_diagonal_non_unit, kb, n - k - kb, B, shiftB + idx2D(k, k, ldb),
-                        ldb, strideB, A, shiftA + idx2D(k, k + kb, lda), lda, strideA, batch_count,
-                        optim_mem, work_x_temp, workArr_temp_arr, store_wcs_invA, invA_arr);
-
-                    rocblasCall_symm_hemm(handle, rocblas_side_left, uplo, kb, n - k - kb,
-                                          &t_minhalf, A, shiftA + idx2D(k, k, lda), lda, strideA, B,
-                                          shiftB + idx2D(k, k + kb, ldb), ldb, strideB, &t_one, A,
-                                          shiftA + idx2D(k, k + kb, lda), lda, strideA, batch_count);
-
-                    rocblasCall_syr2k_her2k<BATCHED, T>(
-                        handle, uplo, rocblas_operation_conjugate_transpose, n - k - kb, kb,
-                        &t_minone, A, shiftA + idx2D(k, k + kb, lda), lda, strideA, B,
-                        shiftB + idx2D(k, k + kb, ldb), ldb, strideB, &s_one, A,
-                        shiftA + idx2D(k + kb, k + kb, lda), lda, strideA, batch_count);
-
-                    rocblasCall_symm_hemm(handle, rocblas_side_left, uplo, kb, n - k - kb,
-                                          &t_minhalf, A, shiftA + idx2D(k, k, lda), lda, strideA, B,
-                                          shiftB + idx2D(k, k + kb, ldb), ldb, strideB, &t_one, A,
-                                          shiftA + idx2D(k, k + kb, lda), lda, strideA, batch_count);
-
-                    rocsolver_trsm_upper<BATCHED, STRIDED, T>(
-                        handle, rocblas_side_right, rocblas_operation_none, rocblas_diagonal_non_unit,
-                        kb, n - k - kb, B, shiftB + idx2D(k + kb, k + kb, ldb), ldb, strideB, A,
-                        shiftA + idx2D(k, k + kb, lda), lda, strideA, batch_count, optim_mem,
-                        work_x_temp, workArr_temp_arr, store_wcs_invA, invA_arr);
-                }
-            }
-        }
-        else
-        {
-            // Compute inv(L)*A*inv(L')
-            for(rocblas_int k = 0; k < n; k += nb)
-            {
-                rocblas_int kb = std::min(n - k, nb);
-
-                rocsolver_sygs2_hegs2_template<BATCHED, T>(
-                    handle, itype, uplo, kb, A, shiftA + idx2D(k, k, lda), lda, strideA, B,
-                    shiftB + idx2D(k, k, ldb), ldb, strideB, batch_count, scalars, work_x_temp,
-                    store_wcs_invA, (T**)workArr_temp_arr);
-
-                if(k + kb < n)
-                {
-                    rocsolver_trsm_lower<BATCHED, STRIDED, T>(
-                        handle, rocblas_side_right, rocblas_operation_conjugate_transpose,
-                        rocblas_diagonal_non_unit, n - k - kb, kb, B, shiftB + idx2D(k, k, ldb),
-                        ldb, strideB, A, shiftA + idx2D(k + kb, k, lda), lda, strideA, batch_count,
-                        optim_mem, work_x_temp, workArr_temp_arr, store_wcs_invA, invA_arr);
-
-                    rocblasCall_symm_hemm(handle, rocblas_side_right, uplo, n - k - kb, kb,
-                                          &t_minhalf, A, shiftA + idx2D(k, k, lda), lda, strideA, B,
-                                          shiftB + idx2D(k + kb, k, ldb), ldb, strideB, &t_one, A,
-                                          shiftA + idx2D(k + kb, k, lda), lda, strideA, batch_count);
-
-                    rocblasCall_syr2k_her2k<BATCHED, T>(
-                        handle, uplo, rocblas_operation_none, n - k - kb, kb, &t_minone, A,
-                        shiftA + idx2D(k + kb, k, lda), lda, strideA, B,
-                        shiftB + idx2D(k + kb, k, ldb), ldb, strideB, &s_one, A,
-                        shiftA + idx2D(k + kb, k + kb, lda), lda, strideA, batch_count);
-
-                    rocblasCall_symm_hemm(handle, rocblas_side_right, uplo, n - k - kb, kb,
-                                          &t_minhalf, A, shiftA + idx2D(k, k, lda), lda, strideA, B,
-                                          shiftB + idx2D(k + kb, k, ldb), ldb, strideB, &t_one, A,
-                                          shiftA + idx2D(k + kb, k, lda), lda, strideA, batch_count);
-
-                    rocsolver_trsm_lower<BATCHED, STRIDED, T>(
-                        handle, rocblas_side_left, rocblas_operation_none, rocblas_diagonal_non_unit,
-                        n - k - kb, kb, B, shiftB + idx2D(k + kb, k + kb, ldb), ldb, strideB, A,
-                        shiftA + idx2D(k + kb, k, lda), lda, strideA, batch_count, optim_mem,
-                        work_x_temp, workArr_temp_arr, store_wcs_invA, invA_arr);
-                }
-            }
-        }
+        // Compute inv(U')*A*inv(U) or inv(L)*A*inv(L')
+        // (recursively if n > xxGST_RECURSIVE_SWITCHSIZE)
+        sygst_hegst_ax_recursive<BATCHED, STRIDED, T, S>(
+            handle, uplo, n, A, shiftA, lda, strideA, B, shiftB, ldb, strideB, batch_count, scalars,
+            work_x_temp, workArr_temp_arr, store_wcs_invA, invA_arr, optim_mem);
     }
     else
     {
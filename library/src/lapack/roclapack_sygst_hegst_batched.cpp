@@ -64,7 +64,7 @@ rocblas_status rocsolver_sygst_hegst_batched_impl(rocblas_handle handle,
     rocblas_stride strideB = 0;
 
     // memory workspace sizes:
-    // size for constants in rocblas calls
+    // constants in rocblas calls (only whether they are needed, see set_device_scalars)
     size_t size_scalars;
     // size of reusable workspace (and for calling SYGS2/HEGS2 and TRSM)
     bool optim_mem;
@@ -74,13 +74,13 @@ rocblas_status rocsolver_sygst_hegst_batched_impl(rocblas_handle handle,
         &size_store_wcs_invA, &size_invA_arr, &optim_mem);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work_x_temp,
+        return rocblas_set_optimal_device_memory_size(handle, size_t(0), size_work_x_temp,
                                                       size_workArr_temp_arr, size_store_wcs_invA,
                                                       size_invA_arr);
 
     // memory workspace allocation
     void *scalars, *work_x_temp, *workArr_temp_arr, *store_invA, *invA_arr;
-    rocblas_device_malloc mem(handle, size_scalars, size_work_x_temp, size_workArr_temp_arr,
+    rocblas_device_malloc mem(handle, size_t(0), size_work_x_temp, size_workArr_temp_arr,
                               size_store_wcs_invA, size_invA_arr);
 
     if(!mem)
@@ -92,7 +92,7 @@ rocblas_status rocsolver_sygst_hegst_batched_impl(rocblas_handle handle,
     store_invA = mem[3];
     invA_arr = mem[4];
     if(size_scalars > 0)
-        init_scalars(handle, (T*)scalars);
+        ROCBLAS_CHECK(set_device_scalars<T>(scalars));
 
     // execution
     return rocsolver_sygst_hegst_template<true, false, T, S>(
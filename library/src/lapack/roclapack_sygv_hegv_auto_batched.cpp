@@ -0,0 +1,204 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "roclapack_sygv_hegv_auto.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_sygv_hegv_auto_batched_impl(rocblas_handle handle,
+                                                     const rocblas_eform itype,
+                                                     const rocblas_evect evect,
+                                                     const rocblas_fill uplo,
+                                                     const rocblas_int n,
+                                                     U A,
+                                                     const rocblas_int lda,
+                                                     U B,
+                                                     const rocblas_int ldb,
+                                                     S* D,
+                                                     const rocblas_stride strideD,
+                                                     S* E,
+                                                     const rocblas_stride strideE,
+                                                     rocblas_int* info,
+                                                     const rocblas_int batch_count)
+{
+    const char* name = (!rocblas_is_complex<T> ? "sygv_auto_batched" : "hegv_auto_batched");
+    ROCSOLVER_ENTER_TOP(
+        name, "--itype", itype, "--evect", evect, "--uplo", uplo, "-n", n, "--lda", lda, "--ldb",
+        ldb, "--strideD", strideD, "--strideE", strideE, "--batch_count", batch_count);
+    ROCSOLVER_INFO_SUMMARY(info, batch_count);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_sygv_hegv_argCheck(handle, itype, evect, uplo, n, lda, ldb, A, B,
+                                                     D, E, info, batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+    rocblas_int shiftB = 0;
+
+    // batched execution
+    rocblas_stride strideA = 0;
+    rocblas_stride strideB = 0;
+
+    // memory workspace sizes:
+    // (the first buffers hold the constants in rocblas calls and the reusable workspaces, as
+    // required by SYEV_AUTO/HEEV_AUTO, POTRF, SYGST/HEGST and TRSM)
+    bool optim_mem;
+    size_t size_work[SYEV_AUTO_NUM_WORKSPACES];
+    // extra requirements for calling POTRF and TRMM
+    size_t size_pivots_workArr;
+    // size of temporary info array
+    size_t size_iinfo;
+    rocsolver_sygv_hegv_auto_getMemorySize<true, false, T, S>(
+        itype, evect, uplo, n, batch_count, size_work, &size_pivots_workArr, &size_iinfo,
+        &optim_mem);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(
+            handle, size_t(0), size_work[1], size_work[2], size_work[3], size_work[4],
+            size_work[5], size_work[6], size_work[7], size_work[8], size_work[9],
+            size_pivots_workArr, size_iinfo);
+
+    // memory workspace allocation
+    void* work[SYEV_AUTO_NUM_WORKSPACES];
+    void *pivots_workArr, *iinfo;
+    rocblas_device_malloc mem(handle, size_t(0), size_work[1], size_work[2], size_work[3],
+                              size_work[4], size_work[5], size_work[6], size_work[7], size_work[8],
+                              size_work[9], size_pivots_workArr, size_iinfo);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    for(int i = 0; i < SYEV_AUTO_NUM_WORKSPACES; ++i)
+        work[i] = mem[i];
+    pivots_workArr = mem[SYEV_AUTO_NUM_WORKSPACES];
+    iinfo = mem[SYEV_AUTO_NUM_WORKSPACES + 1];
+    if(size_work[0] > 0)
+        ROCBLAS_CHECK(set_device_scalars<T>(work[0]));
+
+    // execution
+    return _info_summary_scope.commit(rocsolver_sygv_hegv_auto_template<true, false, T>(
+        handle, itype, evect, uplo, n, A, shiftA, lda, strideA, B, shiftB, ldb, strideB, D, strideD,
+        E, strideE, info, batch_count, work, pivots_workArr, (rocblas_int*)iinfo, optim_mem));
+}
+
+ROCSOLVER_END_NAMESPACE
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_ssygv_auto_batched(rocblas_handle handle,
+                                            const rocblas_eform itype,
+                                            const rocblas_evect evect,
+                                            const rocblas_fill uplo,
+                                            const rocblas_int n,
+                                            float* const A[],
+                                            const rocblas_int lda,
+                                            float* const B[],
+                                            const rocblas_int ldb,
+                                            float* D,
+                                            const rocblas_stride strideD,
+                                            float* E,
+                                            const rocblas_stride strideE,
+                                            rocblas_int* info,
+                                            const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_sygv_hegv_auto_batched_impl<float>(
+        handle, itype, evect, uplo, n, A, lda, B, ldb, D, strideD, E, strideE, info, batch_count);
+}
+
+rocblas_status rocsolver_dsygv_auto_batched(rocblas_handle handle,
+                                            const rocblas_eform itype,
+                                            const rocblas_evect evect,
+                                            const rocblas_fill uplo,
+                                            const rocblas_int n,
+                                            double* const A[],
+                                            const rocblas_int lda,
+                                            double* const B[],
+                                            const rocblas_int ldb,
+                                            double* D,
+                                            const rocblas_stride strideD,
+                                            double* E,
+                                            const rocblas_stride strideE,
+                                            rocblas_int* info,
+                                            const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_sygv_hegv_auto_batched_impl<double>(
+        handle, itype, evect, uplo, n, A, lda, B, ldb, D, strideD, E, strideE, info, batch_count);
+}
+
+rocblas_status rocsolver_chegv_auto_batched(rocblas_handle handle,
+                                            const rocblas_eform itype,
+                                            const rocblas_evect evect,
+                                            const rocblas_fill uplo,
+                                            const rocblas_int n,
+                                            rocblas_float_complex* const A[],
+                                            const rocblas_int lda,
+                                            rocblas_float_complex* const B[],
+                                            const rocblas_int ldb,
+                                            float* D,
+                                            const rocblas_stride strideD,
+                                            float* E,
+                                            const rocblas_stride strideE,
+                                            rocblas_int* info,
+                                            const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_sygv_hegv_auto_batched_impl<rocblas_float_complex>(
+        handle, itype, evect, uplo, n, A, lda, B, ldb, D, strideD, E, strideE, info, batch_count);
+}
+
+rocblas_status rocsolver_zhegv_auto_batched(rocblas_handle handle,
+                                            const rocblas_eform itype,
+                                            const rocblas_evect evect,
+                                            const rocblas_fill uplo,
+                                            const rocblas_int n,
+                                            rocblas_double_complex* const A[],
+                                            const rocblas_int lda,
+                                            rocblas_double_complex* const B[],
+                                            const rocblas_int ldb,
+                                            double* D,
+                                            const rocblas_stride strideD,
+                                            double* E,
+                                            const rocblas_stride strideE,
+                                            rocblas_int* info,
+                                            const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_sygv_hegv_auto_batched_impl<rocblas_double_complex>(
+        handle, itype, evect, uplo, n, A, lda, B, ldb, D, strideD, E, strideE, info, batch_count);
+}
+
+} // extern C
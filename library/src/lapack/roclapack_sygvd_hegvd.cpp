@@ -46,6 +46,7 @@ rocblas_status rocsolver_sygvd_hegvd_impl(rocblas_handle handle,
     const char* name = (!rocblas_is_complex<T> ? "sygvd" : "hegvd");
     ROCSOLVER_ENTER_TOP(name, "--itype", itype, "--evect", evect, "--uplo", uplo, "-n", n, "--lda",
                         lda, "--ldb", ldb);
+    ROCSOLVER_INFO_SUMMARY(info, 1);
 
     if(!handle)
         return rocblas_status_invalid_handle;
@@ -68,7 +69,7 @@ rocblas_status rocsolver_sygvd_hegvd_impl(rocblas_handle handle,
     rocblas_int batch_count = 1;
 
     // memory workspace sizes:
-    // size for constants in rocblas calls
+    // constants in rocblas calls (only whether they are needed, see set_device_scalars)
     size_t size_scalars;
     // size of reusable workspaces (and for calling TRSM, SYGST/HEGST, and SYEVD/HEEVD)
     bool optim_mem;
@@ -85,13 +86,13 @@ rocblas_status rocsolver_sygvd_hegvd_impl(rocblas_handle handle,
         &optim_mem);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work1, size_work2,
+        return rocblas_set_optimal_device_memory_size(handle, size_t(0), size_work1, size_work2,
                                                       size_work3, size_work4, size_tmpz, size_splits,
                                                       size_tau, size_pivots_workArr, size_iinfo);
 
     // memory workspace allocation
     void *scalars, *work1, *work2, *work3, *work4, *tmpz, *splits, *tau, *pivots_workArr, *iinfo;
-    rocblas_device_malloc mem(handle, size_scalars, size_work1, size_work2, size_work3, size_work4,
+    rocblas_device_malloc mem(handle, size_t(0), size_work1, size_work2, size_work3, size_work4,
                               size_tmpz, size_splits, size_tau, size_pivots_workArr, size_iinfo);
 
     if(!mem)
@@ -108,13 +109,13 @@ rocblas_status rocsolver_sygvd_hegvd_impl(rocblas_handle handle,
     pivots_workArr = mem[8];
     iinfo = mem[9];
     if(size_scalars > 0)
-        init_scalars(handle, (T*)scalars);
+        ROCBLAS_CHECK(set_device_scalars<T>(scalars));
 
     // execution
-    return rocsolver_sygvd_hegvd_template<false, false, T>(
+    return _info_summary_scope.commit(rocsolver_sygvd_hegvd_template<false, false, T>(
         handle, itype, evect, uplo, n, A, shiftA, lda, strideA, B, shiftB, ldb, strideB, D, strideD,
         E, strideE, info, batch_count, (T*)scalars, work1, work2, work3, work4, (S*)tmpz,
-        (rocblas_int*)splits, (T*)tau, pivots_workArr, (rocblas_int*)iinfo, optim_mem);
+        (rocblas_int*)splits, (T*)tau, pivots_workArr, (rocblas_int*)iinfo, optim_mem));
 }
 
 ROCSOLVER_END_NAMESPACE
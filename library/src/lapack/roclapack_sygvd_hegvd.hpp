@@ -57,7 +57,8 @@ void rocsolver_sygvd_hegvd_getMemorySize(const rocblas_eform itype,
                                          size_t* size_tau,
                                          size_t* size_pivots_workArr,
                                          size_t* size_iinfo,
-                                         bool* optim_mem)
+                                         bool* optim_mem,
+                                         const bool factored = false)
 {
     // if quick return no need of workspace
     if(n == 0 || batch_count == 0)
@@ -79,15 +80,28 @@ void rocsolver_sygvd_hegvd_getMemorySize(const rocblas_eform itype,
     bool opt1, opt2, opt3 = true;
     size_t unused, temp1, temp2, temp3, temp4, temp5;
 
-    // requirements for calling POTRF
-    rocsolver_potrf_getMemorySize<BATCHED, STRIDED, T>(n, uplo, batch_count, size_scalars,
-                                                       size_work1, size_work2, size_work3, size_work4,
-                                                       size_pivots_workArr, size_iinfo, &opt1);
+    // requirements for calling POTRF (not needed if B is already factorized)
+    if(factored)
+    {
+        *size_scalars = 0;
+        *size_work1 = 0;
+        *size_work2 = 0;
+        *size_work3 = 0;
+        *size_work4 = 0;
+        *size_pivots_workArr = 0;
+        *size_iinfo = 0;
+        opt1 = true;
+    }
+    else
+        rocsolver_potrf_getMemorySize<BATCHED, STRIDED, T>(
+            n, uplo, batch_count, size_scalars, size_work1, size_work2, size_work3, size_work4,
+            size_pivots_workArr, size_iinfo, &opt1);
     *size_iinfo = std::max(*size_iinfo, sizeof(rocblas_int) * batch_count);
 
     // requirements for calling SYGST/HEGST
-    rocsolver_sygst_hegst_getMemorySize<BATCHED, STRIDED, T>(uplo, itype, n, batch_count, &unused,
+    rocsolver_sygst_hegst_getMemorySize<BATCHED, STRIDED, T>(uplo, itype, n, batch_count, &temp5,
                                                              &temp1, &temp2, &temp3, &temp4, &opt2);
+    *size_scalars = std::max(*size_scalars, temp5);
     *size_work1 = std::max(*size_work1, temp1);
     *size_work2 = std::max(*size_work2, temp2);
     *size_work3 = std::max(*size_work3, temp3);
@@ -153,11 +167,12 @@ rocblas_status rocsolver_sygvd_hegvd_template(rocblas_handle handle,
                                               T* tau,
                                               void* pivots_workArr,
                                               rocblas_int* iinfo,
-                                              bool optim_mem)
+                                              bool optim_mem,
+                                              const bool factored = false)
 {
     ROCSOLVER_ENTER("sygvd_hegvd", "itype:", itype, "evect:", evect, "uplo:", uplo, "n:", n,
                     "shiftA:", shiftA, "lda:", lda, "shiftB:", shiftB, "ldb:", ldb,
-                    "bc:", batch_count);
+                    "bc:", batch_count, "factored:", factored);
 
     // quick return
     if(batch_count == 0)
@@ -185,10 +200,12 @@ rocblas_status rocsolver_sygvd_hegvd_template(rocblas_handle handle,
     // constants for rocblas functions calls
     T one = 1;
 
-    // perform Cholesky factorization of B
-    rocsolver_potrf_template<BATCHED, STRIDED, T, S>(handle, uplo, n, B, shiftB, ldb, strideB, info,
-                                                     batch_count, scalars, work1, work2, work3,
-                                                     work4, (T*)pivots_workArr, iinfo, optim_mem);
+    // perform Cholesky factorization of B, unless it is given already factorized (in which case
+    // B is only read, and all the problems of a strided batch can share it with strideB = 0)
+    if(!factored)
+        rocsolver_potrf_template<BATCHED, STRIDED, T, S>(
+            handle, uplo, n, B, shiftB, ldb, strideB, info, batch_count, scalars, work1, work2,
+            work3, work4, (T*)pivots_workArr, iinfo, optim_mem);
 
     /** (TODO: Strictly speaking, computations should stop here is B is not positive definite.
         A should not be modified in this case as no eigenvalues or eigenvectors can be computed.
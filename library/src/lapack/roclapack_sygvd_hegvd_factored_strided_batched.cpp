@@ -0,0 +1,223 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "roclapack_sygvd_hegvd.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_sygvd_hegvd_factored_strided_batched_impl(rocblas_handle handle,
+                                                                   const rocblas_eform itype,
+                                                                   const rocblas_evect evect,
+                                                                   const rocblas_fill uplo,
+                                                                   const rocblas_int n,
+                                                                   U A,
+                                                                   const rocblas_int lda,
+                                                                   const rocblas_stride strideA,
+                                                                   U B,
+                                                                   const rocblas_int ldb,
+                                                                   const rocblas_stride strideB,
+                                                                   S* D,
+                                                                   const rocblas_stride strideD,
+                                                                   S* E,
+                                                                   const rocblas_stride strideE,
+                                                                   rocblas_int* info,
+                                                                   const rocblas_int batch_count)
+{
+    const char* name = (!rocblas_is_complex<T> ? "sygvd_factored_strided_batched"
+                                               : "hegvd_factored_strided_batched");
+    ROCSOLVER_ENTER_TOP(name, "--itype", itype, "--evect", evect, "--uplo", uplo, "-n", n, "--lda",
+                        lda, "--strideA", strideA, "--ldb", ldb, "--strideB", strideB, "--strideD",
+                        strideD, "--strideE", strideE, "--batch_count", batch_count);
+    ROCSOLVER_INFO_SUMMARY(info, batch_count);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_sygv_hegv_argCheck(handle, itype, evect, uplo, n, lda, ldb, A, B,
+                                                     D, E, info, batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+    rocblas_int shiftB = 0;
+
+    // memory workspace sizes:
+    // constants in rocblas calls (only whether they are needed, see set_device_scalars)
+    size_t size_scalars;
+    // size of reusable workspaces (and for calling TRSM, SYGST/HEGST, and SYEVD/HEEVD)
+    bool optim_mem;
+    size_t size_work1, size_work2, size_work3, size_work4;
+    // extra requirements for calling SYEVD/HEEVD
+    size_t size_tau;
+    size_t size_pivots_workArr;
+    size_t size_splits, size_tmpz;
+    // size of temporary info array
+    size_t size_iinfo;
+    rocsolver_sygvd_hegvd_getMemorySize<false, true, T, S>(
+        itype, evect, uplo, n, batch_count, &size_scalars, &size_work1, &size_work2, &size_work3,
+        &size_work4, &size_tmpz, &size_splits, &size_tau, &size_pivots_workArr, &size_iinfo,
+        &optim_mem, true);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_t(0), size_work1, size_work2,
+                                                      size_work3, size_work4, size_tmpz, size_splits,
+                                                      size_tau, size_pivots_workArr, size_iinfo);
+
+    // memory workspace allocation
+    void *scalars, *work1, *work2, *work3, *work4, *tmpz, *splits, *tau, *pivots_workArr, *iinfo;
+    rocblas_device_malloc mem(handle, size_t(0), size_work1, size_work2, size_work3, size_work4,
+                              size_tmpz, size_splits, size_tau, size_pivots_workArr, size_iinfo);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    scalars = mem[0];
+    work1 = mem[1];
+    work2 = mem[2];
+    work3 = mem[3];
+    work4 = mem[4];
+    tmpz = mem[5];
+    splits = mem[6];
+    tau = mem[7];
+    pivots_workArr = mem[8];
+    iinfo = mem[9];
+    if(size_scalars > 0)
+        ROCBLAS_CHECK(set_device_scalars<T>(scalars));
+
+    // execution
+    return _info_summary_scope.commit(rocsolver_sygvd_hegvd_template<false, true, T>(
+        handle, itype, evect, uplo, n, A, shiftA, lda, strideA, B, shiftB, ldb, strideB, D, strideD,
+        E, strideE, info, batch_count, (T*)scalars, work1, work2, work3, work4, (S*)tmpz,
+        (rocblas_int*)splits, (T*)tau, pivots_workArr, (rocblas_int*)iinfo, optim_mem, true));
+}
+
+ROCSOLVER_END_NAMESPACE
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_ssygvd_factored_strided_batched(rocblas_handle handle,
+                                                         const rocblas_eform itype,
+                                                         const rocblas_evect evect,
+                                                         const rocblas_fill uplo,
+                                                         const rocblas_int n,
+                                                         float* A,
+                                                         const rocblas_int lda,
+                                                         const rocblas_stride strideA,
+                                                         float* B,
+                                                         const rocblas_int ldb,
+                                                         const rocblas_stride strideB,
+                                                         float* D,
+                                                         const rocblas_stride strideD,
+                                                         float* E,
+                                                         const rocblas_stride strideE,
+                                                         rocblas_int* info,
+                                                         const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_sygvd_hegvd_factored_strided_batched_impl<float>(
+        handle, itype, evect, uplo, n, A, lda, strideA, B, ldb, strideB, D, strideD, E, strideE,
+        info, batch_count);
+}
+
+rocblas_status rocsolver_dsygvd_factored_strided_batched(rocblas_handle handle,
+                                                         const rocblas_eform itype,
+                                                         const rocblas_evect evect,
+                                                         const rocblas_fill uplo,
+                                                         const rocblas_int n,
+                                                         double* A,
+                                                         const rocblas_int lda,
+                                                         const rocblas_stride strideA,
+                                                         double* B,
+                                                         const rocblas_int ldb,
+                                                         const rocblas_stride strideB,
+                                                         double* D,
+                                                         const rocblas_stride strideD,
+                                                         double* E,
+                                                         const rocblas_stride strideE,
+                                                         rocblas_int* info,
+                                                         const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_sygvd_hegvd_factored_strided_batched_impl<double>(
+        handle, itype, evect, uplo, n, A, lda, strideA, B, ldb, strideB, D, strideD, E, strideE,
+        info, batch_count);
+}
+
+rocblas_status rocsolver_chegvd_factored_strided_batched(rocblas_handle handle,
+                                                         const rocblas_eform itype,
+                                                         const rocblas_evect evect,
+                                                         const rocblas_fill uplo,
+                                                         const rocblas_int n,
+                                                         rocblas_float_complex* A,
+                                                         const rocblas_int lda,
+                                                         const rocblas_stride strideA,
+                                                         rocblas_float_complex* B,
+                                                         const rocblas_int ldb,
+                                                         const rocblas_stride strideB,
+                                                         float* D,
+                                                         const rocblas_stride strideD,
+                                                         float* E,
+                                                         const rocblas_stride strideE,
+                                                         rocblas_int* info,
+                                                         const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_sygvd_hegvd_factored_strided_batched_impl<rocblas_float_complex>(
+        handle, itype, evect, uplo, n, A, lda, strideA, B, ldb, strideB, D, strideD, E, strideE,
+        info, batch_count);
+}
+
+rocblas_status rocsolver_zhegvd_factored_strided_batched(rocblas_handle handle,
+                                                         const rocblas_eform itype,
+                                                         const rocblas_evect evect,
+                                                         const rocblas_fill uplo,
+                                                         const rocblas_int n,
+                                                         rocblas_double_complex* A,
+                                                         const rocblas_int lda,
+                                                         const rocblas_stride strideA,
+                                                         rocblas_double_complex* B,
+                                                         const rocblas_int ldb,
+                                                         const rocblas_stride strideB,
+                                                         double* D,
+                                                         const rocblas_stride strideD,
+                                                         double* E,
+                                                         const rocblas_stride strideE,
+                                                         rocblas_int* info,
+                                                         const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_sygvd_hegvd_factored_strided_batched_impl<rocblas_double_complex>(
+        handle, itype, evect, uplo, n, A, lda, strideA, B, ldb, strideB, D, strideD, E, strideE,
+        info, batch_count);
+}
+
+} // extern C
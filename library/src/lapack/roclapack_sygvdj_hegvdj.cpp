@@ -45,6 +45,7 @@ rocblas_status rocsolver_sygvdj_hegvdj_impl(rocblas_handle handle,
     const char* name = (!rocblas_is_complex<T> ? "sygvdj" : "hegvdj");
     ROCSOLVER_ENTER_TOP(name, "--itype", itype, "--evect", evect, "--uplo", uplo, "-n", n, "--lda",
                         lda, "--ldb", ldb);
+    ROCSOLVER_INFO_SUMMARY(info, 1);
 
     if(!handle)
         return rocblas_status_invalid_handle;
@@ -66,7 +67,7 @@ rocblas_status rocsolver_sygvdj_hegvdj_impl(rocblas_handle handle,
     rocblas_int batch_count = 1;
 
     // memory workspace sizes:
-    // size for constants in rocblas calls
+    // constants in rocblas calls (only whether they are needed, see set_device_scalars)
     size_t size_scalars;
     // size of reusable workspaces
     bool optim_mem;
@@ -87,13 +88,13 @@ rocblas_status rocsolver_sygvdj_hegvdj_impl(rocblas_handle handle,
 
     if(rocblas_is_device_memory_size_query(handle))
         return rocblas_set_optimal_device_memory_size(
-            handle, size_scalars, size_work1, size_work2, size_work3, size_work4, size_workE,
+            handle, size_t(0), size_work1, size_work2, size_work3, size_work4, size_workE,
             size_workTau, size_workVec, size_workSplits, size_iinfo, size_workArr);
 
     // memory workspace allocation
     void *scalars, *work1, *work2, *work3, *work4, *workE, *workTau, *workVec, *workSplits,
         *workArr, *iinfo;
-    rocblas_device_malloc mem(handle, size_scalars, size_work1, size_work2, size_work3, size_work4,
+    rocblas_device_malloc mem(handle, size_t(0), size_work1, size_work2, size_work3, size_work4,
                               size_workE, size_workTau, size_workVec, size_workSplits, size_iinfo,
                               size_workArr);
 
@@ -112,13 +113,13 @@ rocblas_status rocsolver_sygvdj_hegvdj_impl(rocblas_handle handle,
     iinfo = mem[9];
     workArr = mem[10];
     if(size_scalars > 0)
-        init_scalars(handle, (T*)scalars);
+        ROCBLAS_CHECK(set_device_scalars<T>(scalars));
 
     // execution
-    return rocsolver_sygvdj_hegvdj_template<false, false, T>(
+    return _info_summary_scope.commit(rocsolver_sygvdj_hegvdj_template<false, false, T>(
         handle, itype, evect, uplo, n, A, shiftA, lda, strideA, B, shiftB, ldb, strideB, D, strideD,
         info, batch_count, (T*)scalars, work1, work2, work3, work4, (S*)workE, (T*)workTau,
-        (T*)workVec, (rocblas_int*)workSplits, (rocblas_int*)iinfo, workArr, optim_mem);
+        (T*)workVec, (rocblas_int*)workSplits, (rocblas_int*)iinfo, workArr, optim_mem));
 }
 
 ROCSOLVER_END_NAMESPACE
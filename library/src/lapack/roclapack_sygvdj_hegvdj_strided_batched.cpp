@@ -50,6 +50,7 @@ rocblas_status rocsolver_sygvdj_hegvdj_strided_batched_impl(rocblas_handle handl
     ROCSOLVER_ENTER_TOP(name, "--itype", itype, "--evect", evect, "--uplo", uplo, "-n", n, "--lda",
                         lda, "--strideA", strideA, "--ldb", ldb, "--strideB", strideB, "--strideD",
                         strideD, "--batch_count", batch_count);
+    ROCSOLVER_INFO_SUMMARY(info, batch_count);
 
     if(!handle)
         return rocblas_status_invalid_handle;
@@ -65,7 +66,7 @@ rocblas_status rocsolver_sygvdj_hegvdj_strided_batched_impl(rocblas_handle handl
     rocblas_int shiftB = 0;
 
     // memory workspace sizes:
-    // size for constants in rocblas calls
+    // constants in rocblas calls (only whether they are needed, see set_device_scalars)
     size_t size_scalars;
     // size of reusable workspaces
     bool optim_mem;
@@ -86,13 +87,13 @@ rocblas_status rocsolver_sygvdj_hegvdj_strided_batched_impl(rocblas_handle handl
 
     if(rocblas_is_device_memory_size_query(handle))
         return rocblas_set_optimal_device_memory_size(
-            handle, size_scalars, size_work1, size_work2, size_work3, size_work4, size_workE,
+            handle, size_t(0), size_work1, size_work2, size_work3, size_work4, size_workE,
             size_workTau, size_workVec, size_workSplits, size_iinfo, size_workArr);
 
     // memory workspace allocation
     void *scalars, *work1, *work2, *work3, *work4, *workE, *workTau, *workVec, *workSplits,
         *workArr, *iinfo;
-    rocblas_device_malloc mem(handle, size_scalars, size_work1, size_work2, size_work3, size_work4,
+    rocblas_device_malloc mem(handle, size_t(0), size_work1, size_work2, size_work3, size_work4,
                               size_workE, size_workTau, size_workVec, size_workSplits, size_iinfo,
                               size_workArr);
 
@@ -111,13 +112,13 @@ rocblas_status rocsolver_sygvdj_hegvdj_strided_batched_impl(rocblas_handle handl
     iinfo = mem[9];
     workArr = mem[10];
     if(size_scalars > 0)
-        init_scalars(handle, (T*)scalars);
+        ROCBLAS_CHECK(set_device_scalars<T>(scalars));
 
     // execution
-    return rocsolver_sygvdj_hegvdj_template<false, true, T>(
+    return _info_summary_scope.commit(rocsolver_sygvdj_hegvdj_template<false, true, T>(
         handle, itype, evect, uplo, n, A, shiftA, lda, strideA, B, shiftB, ldb, strideB, D, strideD,
         info, batch_count, (T*)scalars, work1, work2, work3, work4, (S*)workE, (T*)workTau,
-        (T*)workVec, (rocblas_int*)workSplits, (rocblas_int*)iinfo, workArr, optim_mem);
+        (T*)workVec, (rocblas_int*)workSplits, (rocblas_int*)iinfo, workArr, optim_mem));
 }
 
 ROCSOLVER_END_NAMESPACE
@@ -56,6 +56,7 @@ rocblas_status rocsolver_sygvdx_hegvdx_batched_impl(rocblas_handle handle,
     ROCSOLVER_ENTER_TOP(name, "--itype", itype, "--evect", evect, "--erange", erange, "--uplo", uplo,
                         "-n", n, "--lda", lda, "--ldb", ldb, "--vl", vl, "--vu", vu, "--il", il,
                         "--iu", iu, "--strideW", strideW, "--ldz", ldz, "--batch_count", batch_count);
+    ROCSOLVER_INFO_SUMMARY(info, batch_count);
 
     if(!handle)
         return rocblas_status_invalid_handle;
@@ -78,7 +79,7 @@ rocblas_status rocsolver_sygvdx_hegvdx_batched_impl(rocblas_handle handle,
     rocblas_stride strideZ = 0;
 
     // memory workspace sizes:
-    // size for constants in rocblas calls
+    // constants in rocblas calls (only whether they are needed, see set_device_scalars)
     size_t size_scalars;
     // size of reusable workspaces (and for calling TRSM, SYGST/HEGST, and SYEVX/HEEVX)
     bool optim_mem;
@@ -96,14 +97,14 @@ rocblas_status rocsolver_sygvdx_hegvdx_batched_impl(rocblas_handle handle,
 
     if(rocblas_is_device_memory_size_query(handle))
         return rocblas_set_optimal_device_memory_size(
-            handle, size_scalars, size_work1, size_work2, size_work3, size_work4, size_work5,
+            handle, size_t(0), size_work1, size_work2, size_work3, size_work4, size_work5,
             size_work6_ifail, size_D, size_E, size_iblock, size_isplit, size_tau,
             size_work7_workArr, size_iinfo);
 
     // memory workspace allocation
     void *scalars, *work1, *work2, *work3, *work4, *work5, *work6_ifail, *D, *E, *iblock, *isplit,
         *tau, *work7_workArr, *iinfo;
-    rocblas_device_malloc mem(handle, size_scalars, size_work1, size_work2, size_work3, size_work4,
+    rocblas_device_malloc mem(handle, size_t(0), size_work1, size_work2, size_work3, size_work4,
                               size_work5, size_work6_ifail, size_D, size_E, size_iblock,
                               size_isplit, size_tau, size_work7_workArr, size_iinfo);
 
@@ -125,14 +126,14 @@ rocblas_status rocsolver_sygvdx_hegvdx_batched_impl(rocblas_handle handle,
     work7_workArr = mem[12];
     iinfo = mem[13];
     if(size_scalars > 0)
-        init_scalars(handle, (T*)scalars);
+        ROCBLAS_CHECK(set_device_scalars<T>(scalars));
 
     // execution
-    return rocsolver_sygvdx_hegvdx_template<true, false, T>(
+    return _info_summary_scope.commit(rocsolver_sygvdx_hegvdx_template<true, false, T>(
         handle, itype, evect, erange, uplo, n, A, shiftA, lda, strideA, B, shiftB, ldb, strideB, vl,
         vu, il, iu, nev, W, strideW, Z, shiftZ, ldz, strideZ, info, batch_count, (T*)scalars, work1,
         work2, work3, work4, work5, (rocblas_int*)work6_ifail, (S*)D, (S*)E, (rocblas_int*)iblock,
-        (rocblas_int*)isplit, (T*)tau, work7_workArr, (rocblas_int*)iinfo, optim_mem);
+        (rocblas_int*)isplit, (T*)tau, work7_workArr, (rocblas_int*)iinfo, optim_mem));
 }
 
 ROCSOLVER_END_NAMESPACE
@@ -34,6 +34,10 @@ ROCSOLVER_BEGIN_NAMESPACE
  *    sygvdx/hegvdx_inplace is not intended for inclusion in the public API. It
  *    exists to provide a sygvdx/hegvdx method with a signature identical to
  *    the cuSOLVER implementation, for use exclusively in hipSOLVER.
+ *
+ *    As with syevdx/heevdx_inplace, the stream is synchronized before returning
+ *    so that h_nev can be read right away, except in the _async versions, which
+ *    leave the copy to h_nev in the stream.
  * ===========================================================================
  */
 
@@ -55,12 +59,14 @@ rocblas_status rocsolver_sygvdx_hegvdx_inplace_impl(rocblas_handle handle,
                                                     const S abstol,
                                                     rocblas_int* h_nev,
                                                     S* W,
-                                                    rocblas_int* info)
+                                                    rocblas_int* info,
+                                                    const bool async_nev = false)
 {
     const char* name = (!rocblas_is_complex<T> ? "sygvdx_inplace" : "hegvdx_inplace");
     ROCSOLVER_ENTER_TOP(name, "--itype", itype, "--evect", evect, "--erange", erange, "--uplo",
                         uplo, "-n", n, "--lda", lda, "--ldb", ldb, "--vl", vl, "--vu", vu, "--il",
                         il, "--iu", iu, "--abstol", abstol);
+    ROCSOLVER_INFO_SUMMARY(info, 1);
 
     if(!handle)
         return rocblas_status_invalid_handle;
@@ -82,7 +88,7 @@ rocblas_status rocsolver_sygvdx_hegvdx_inplace_impl(rocblas_handle handle,
     rocblas_int batch_count = 1;
 
     // memory workspace sizes:
-    // size for constants in rocblas calls
+    // constants in rocblas calls (only whether they are needed, see set_device_scalars)
     size_t size_scalars;
     // size of reusable workspaces (and for calling TRSM, SYGST/HEGST, and SYEVDX/HEEVDX)
     bool optim_mem;
@@ -100,14 +106,14 @@ rocblas_status rocsolver_sygvdx_hegvdx_inplace_impl(rocblas_handle handle,
 
     if(rocblas_is_device_memory_size_query(handle))
         return rocblas_set_optimal_device_memory_size(
-            handle, size_scalars, size_work1, size_work2, size_work3, size_work4, size_work5,
+            handle, size_t(0), size_work1, size_work2, size_work3, size_work4, size_work5,
             size_work6_ifail, size_D, size_E, size_iblock, size_isplit, size_tau, size_nev,
             size_work7_workArr, size_iinfo);
 
     // memory workspace allocation
     void *scalars, *work1, *work2, *work3, *work4, *work5, *work6_ifail, *D, *E, *iblock, *isplit,
         *tau, *d_nev, *work7_workArr, *iinfo;
-    rocblas_device_malloc mem(handle, size_scalars, size_work1, size_work2, size_work3, size_work4,
+    rocblas_device_malloc mem(handle, size_t(0), size_work1, size_work2, size_work3, size_work4,
                               size_work5, size_work6_ifail, size_D, size_E, size_iblock,
                               size_isplit, size_tau, size_nev, size_work7_workArr, size_iinfo);
 
@@ -128,15 +134,15 @@ rocblas_status rocsolver_sygvdx_hegvdx_inplace_impl(rocblas_handle handle,
     work7_workArr = mem[13];
     iinfo = mem[14];
     if(size_scalars > 0)
-        init_scalars(handle, (T*)scalars);
+        ROCBLAS_CHECK(set_device_scalars<T>(scalars));
 
     // execution
-    return rocsolver_sygvdx_hegvdx_inplace_template<false, false, T>(
+    return _info_summary_scope.commit(rocsolver_sygvdx_hegvdx_inplace_template<false, false, T>(
         handle, itype, evect, erange, uplo, n, A, shiftA, lda, strideA, B, shiftB, ldb, strideB, vl,
         vu, il, iu, abstol, h_nev, W, strideW, info, batch_count, (T*)scalars, work1, work2, work3,
         work4, work5, (rocblas_int*)work6_ifail, (S*)D, (S*)E, (rocblas_int*)iblock,
         (rocblas_int*)isplit, (T*)tau, (rocblas_int*)d_nev, work7_workArr, (rocblas_int*)iinfo,
-        optim_mem);
+        optim_mem, async_nev));
 }
 
 ROCSOLVER_END_NAMESPACE
@@ -245,4 +251,100 @@ ROCSOLVER_EXPORT rocblas_status rocsolver_zhegvdx_inplace(rocblas_handle handle,
         info);
 }
 
+ROCSOLVER_EXPORT rocblas_status rocsolver_ssygvdx_inplace_async(rocblas_handle handle,
+                                                                const rocblas_eform itype,
+                                                                const rocblas_evect evect,
+                                                                const rocblas_erange erange,
+                                                                const rocblas_fill uplo,
+                                                                const rocblas_int n,
+                                                                float* A,
+                                                                const rocblas_int lda,
+                                                                float* B,
+                                                                const rocblas_int ldb,
+                                                                const float vl,
+                                                                const float vu,
+                                                                const rocblas_int il,
+                                                                const rocblas_int iu,
+                                                                const float abstol,
+                                                                rocblas_int* h_nev,
+                                                                float* W,
+                                                                rocblas_int* info)
+{
+    return rocsolver::rocsolver_sygvdx_hegvdx_inplace_impl<float>(
+        handle, itype, evect, erange, uplo, n, A, lda, B, ldb, vl, vu, il, iu, abstol, h_nev, W,
+        info, true);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dsygvdx_inplace_async(rocblas_handle handle,
+                                                                const rocblas_eform itype,
+                                                                const rocblas_evect evect,
+                                                                const rocblas_erange erange,
+                                                                const rocblas_fill uplo,
+                                                                const rocblas_int n,
+                                                                double* A,
+                                                                const rocblas_int lda,
+                                                                double* B,
+                                                                const rocblas_int ldb,
+                                                                const double vl,
+                                                                const double vu,
+                                                                const rocblas_int il,
+                                                                const rocblas_int iu,
+                                                                const double abstol,
+                                                                rocblas_int* h_nev,
+                                                                double* W,
+                                                                rocblas_int* info)
+{
+    return rocsolver::rocsolver_sygvdx_hegvdx_inplace_impl<double>(
+        handle, itype, evect, erange, uplo, n, A, lda, B, ldb, vl, vu, il, iu, abstol, h_nev, W,
+        info, true);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_chegvdx_inplace_async(rocblas_handle handle,
+                                                                const rocblas_eform itype,
+                                                                const rocblas_evect evect,
+                                                                const rocblas_erange erange,
+                                                                const rocblas_fill uplo,
+                                                                const rocblas_int n,
+                                                                rocblas_float_complex* A,
+                                                                const rocblas_int lda,
+                                                                rocblas_float_complex* B,
+                                                                const rocblas_int ldb,
+                                                                const float vl,
+                                                                const float vu,
+                                                                const rocblas_int il,
+                                                                const rocblas_int iu,
+                                                                const float abstol,
+                                                                rocblas_int* h_nev,
+                                                                float* W,
+                                                                rocblas_int* info)
+{
+    return rocsolver::rocsolver_sygvdx_hegvdx_inplace_impl<rocblas_float_complex>(
+        handle, itype, evect, erange, uplo, n, A, lda, B, ldb, vl, vu, il, iu, abstol, h_nev, W,
+        info, true);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zhegvdx_inplace_async(rocblas_handle handle,
+                                                                const rocblas_eform itype,
+                                                                const rocblas_evect evect,
+                                                                const rocblas_erange erange,
+                                                                const rocblas_fill uplo,
+                                                                const rocblas_int n,
+                                                                rocblas_double_complex* A,
+                                                                const rocblas_int lda,
+                                                                rocblas_double_complex* B,
+                                                                const rocblas_int ldb,
+                                                                const double vl,
+                                                                const double vu,
+                                                                const rocblas_int il,
+                                                                const rocblas_int iu,
+                                                                const double abstol,
+                                                                rocblas_int* h_nev,
+                                                                double* W,
+                                                                rocblas_int* info)
+{
+    return rocsolver::rocsolver_sygvdx_hegvdx_inplace_impl<rocblas_double_complex>(
+        handle, itype, evect, erange, uplo, n, A, lda, B, ldb, vl, vu, il, iu, abstol, h_nev, W,
+        info, true);
+}
+
 } // extern C
@@ -227,7 +227,8 @@ rocblas_status rocsolver_sygvdx_hegvdx_inplace_template(rocblas_handle handle,
                                                         rocblas_int* d_nev,
                                                         void* work7_workArr,
                                                         rocblas_int* iinfo,
-                                                        bool optim_mem)
+                                                        bool optim_mem,
+                                                        const bool async_nev = false)
 {
     ROCSOLVER_ENTER("sygvdx_hegvdx_inplace", "itype:", itype, "evect:", evect, "erange:", erange,
                     "uplo:", uplo, "n:", n, "shiftA:", shiftA, "lda:", lda, "shiftB:", shiftB,
@@ -320,11 +321,17 @@ rocblas_status rocsolver_sygvdx_hegvdx_inplace_template(rocblas_handle handle,
     }
 
     // copy nev from device to host
+    // (with async_nev, the copy is left in the stream and the caller must synchronize the stream
+    // before reading h_nev)
     if(h_nev)
     {
         HIP_CHECK(hipMemcpyAsync(h_nev, d_nev, sizeof(rocblas_int) * batch_count,
                                  hipMemcpyDeviceToHost, stream));
-        HIP_CHECK(hipStreamSynchronize(stream));
+        if(!async_nev)
+        {
+            rocsolver_stats_host_sync();
+            HIP_CHECK(hipStreamSynchronize(stream));
+        }
     }
 
     rocblas_set_pointer_mode(handle, old_mode);
@@ -52,6 +52,7 @@ rocblas_status rocsolver_sygvj_hegvj_batched_impl(rocblas_handle handle,
     ROCSOLVER_ENTER_TOP(name, "--itype", itype, "--evect", evect, "--uplo", uplo, "-n", n, "--lda",
                         lda, "--ldb", ldb, "--abstol", abstol, "--max_sweeps", max_sweeps,
                         "--strideW", strideW, "--batch_count", batch_count);
+    ROCSOLVER_INFO_SUMMARY_SWEEPS(info, batch_count, n_sweeps, residual);
 
     if(!handle)
         return rocblas_status_invalid_handle;
@@ -72,7 +73,7 @@ rocblas_status rocsolver_sygvj_hegvj_batched_impl(rocblas_handle handle,
     rocblas_stride strideB = 0;
 
     // memory workspace sizes:
-    // size for constants in rocblas calls
+    // constants in rocblas calls (only whether they are needed, see set_device_scalars)
     size_t size_scalars;
     // size of reusable workspaces (and for calling POTRF, TRSM, TRMM, SYGST/HEGST, SYEVJ/HEEVJ)
     bool optim_mem;
@@ -84,13 +85,13 @@ rocblas_status rocsolver_sygvj_hegvj_batched_impl(rocblas_handle handle,
         &size_work4, &size_work5, &size_work6, &size_iinfo, &optim_mem);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work1, size_work2,
+        return rocblas_set_optimal_device_memory_size(handle, size_t(0), size_work1, size_work2,
                                                       size_work3, size_work4, size_work5,
                                                       size_work6, size_iinfo);
 
     // memory workspace allocation
     void *scalars, *work1, *work2, *work3, *work4, *work5, *work6, *iinfo;
-    rocblas_device_malloc mem(handle, size_scalars, size_work1, size_work2, size_work3, size_work4,
+    rocblas_device_malloc mem(handle, size_t(0), size_work1, size_work2, size_work3, size_work4,
                               size_work5, size_work6, size_iinfo);
 
     if(!mem)
@@ -105,13 +106,13 @@ rocblas_status rocsolver_sygvj_hegvj_batched_impl(rocblas_handle handle,
     work6 = mem[6];
     iinfo = mem[7];
     if(size_scalars > 0)
-        init_scalars(handle, (T*)scalars);
+        ROCBLAS_CHECK(set_device_scalars<T>(scalars));
 
     // execution
-    return rocsolver_sygvj_hegvj_template<true, false, T>(
+    return _info_summary_scope.commit(rocsolver_sygvj_hegvj_template<true, false, T>(
         handle, itype, evect, uplo, n, A, shiftA, lda, strideA, B, shiftB, ldb, strideB, abstol,
         residual, max_sweeps, n_sweeps, W, strideW, info, batch_count, (T*)scalars, work1, work2,
-        work3, work4, work5, work6, (rocblas_int*)iinfo, optim_mem);
+        work3, work4, work5, work6, (rocblas_int*)iinfo, optim_mem));
 }
 
 ROCSOLVER_END_NAMESPACE
@@ -56,6 +56,7 @@ rocblas_status rocsolver_sygvx_hegvx_impl(rocblas_handle handle,
     ROCSOLVER_ENTER_TOP(name, "--itype", itype, "--evect", evect, "--erange", erange, "--uplo",
                         uplo, "-n", n, "--lda", lda, "--ldb", ldb, "--vl", vl, "--vu", vu, "--il",
                         il, "--iu", iu, "--abstol", abstol, "--ldz", ldz);
+    ROCSOLVER_INFO_SUMMARY(info, 1);
 
     if(!handle)
         return rocblas_status_invalid_handle;
@@ -81,7 +82,7 @@ rocblas_status rocsolver_sygvx_hegvx_impl(rocblas_handle handle,
     rocblas_int batch_count = 1;
 
     // memory workspace sizes:
-    // size for constants in rocblas calls
+    // constants in rocblas calls (only whether they are needed, see set_device_scalars)
     size_t size_scalars;
     // size of reusable workspaces (and for calling TRSM, SYGST/HEGST, and SYEVX/HEEVX)
     bool optim_mem;
@@ -98,7 +99,7 @@ rocblas_status rocsolver_sygvx_hegvx_impl(rocblas_handle handle,
         &size_tau, &size_work7_workArr, &size_iinfo, &optim_mem);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work1, size_work2,
+        return rocblas_set_optimal_device_memory_size(handle, size_t(0), size_work1, size_work2,
                                                       size_work3, size_work4, size_work5, size_work6,
                                                       size_D, size_E, size_iblock, size_isplit,
                                                       size_tau, size_work7_workArr, size_iinfo);
@@ -106,7 +107,7 @@ rocblas_status rocsolver_sygvx_hegvx_impl(rocblas_handle handle,
     // memory workspace allocation
     void *scalars, *work1, *work2, *work3, *work4, *work5, *work6, *D, *E, *iblock, *isplit, *tau,
         *work7_workArr, *iinfo;
-    rocblas_device_malloc mem(handle, size_scalars, size_work1, size_work2, size_work3, size_work4,
+    rocblas_device_malloc mem(handle, size_t(0), size_work1, size_work2, size_work3, size_work4,
                               size_work5, size_work6, size_D, size_E, size_iblock, size_isplit,
                               size_tau, size_work7_workArr, size_iinfo);
 
@@ -126,15 +127,15 @@ rocblas_status rocsolver_sygvx_hegvx_impl(rocblas_handle handle,
     work7_workArr = mem[12];
     iinfo = mem[13];
     if(size_scalars > 0)
-        init_scalars(handle, (T*)scalars);
+        ROCBLAS_CHECK(set_device_scalars<T>(scalars));
 
     // execution
-    return rocsolver_sygvx_hegvx_template<false, false, T>(
+    return _info_summary_scope.commit(rocsolver_sygvx_hegvx_template<false, false, T>(
         handle, itype, evect, erange, uplo, n, A, shiftA, lda, strideA, B, shiftB, ldb, strideB, vl,
         vu, il, iu, abstol, nev, W, strideW, Z, shiftZ, ldz, strideZ, ifail, strideF, info,
         batch_count, (T*)scalars, work1, work2, work3, work4, work5, work6, (S*)D, (S*)E,
         (rocblas_int*)iblock, (rocblas_int*)isplit, (T*)tau, work7_workArr, (rocblas_int*)iinfo,
-        optim_mem);
+        optim_mem));
 }
 
 ROCSOLVER_END_NAMESPACE
@@ -60,6 +60,7 @@ rocblas_status rocsolver_sygvx_hegvx_batched_impl(rocblas_handle handle,
                         uplo, "-n", n, "--lda", lda, "--ldb", ldb, "--vl", vl, "--vu", vu, "--il",
                         il, "--iu", iu, "--abstol", abstol, "--strideW", strideW, "--ldz", ldz,
                         "--strideF", strideF, "--batch_count", batch_count);
+    ROCSOLVER_INFO_SUMMARY(info, batch_count);
 
     if(!handle)
         return rocblas_status_invalid_handle;
@@ -82,7 +83,7 @@ rocblas_status rocsolver_sygvx_hegvx_batched_impl(rocblas_handle handle,
     rocblas_stride strideZ = 0;
 
     // memory workspace sizes:
-    // size for constants in rocblas calls
+    // constants in rocblas calls (only whether they are needed, see set_device_scalars)
     size_t size_scalars;
     // size of reusable workspaces (and for calling TRSM, SYGST/HEGST, and SYEVX/HEEVX)
     bool optim_mem;
@@ -99,7 +100,7 @@ rocblas_status rocsolver_sygvx_hegvx_batched_impl(rocblas_handle handle,
         &size_tau, &size_work7_workArr, &size_iinfo, &optim_mem);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work1, size_work2,
+        return rocblas_set_optimal_device_memory_size(handle, size_t(0), size_work1, size_work2,
                                                       size_work3, size_work4, size_work5, size_work6,
                                                       size_D, size_E, size_iblock, size_isplit,
                                                       size_tau, size_work7_workArr, size_iinfo);
@@ -107,7 +108,7 @@ rocblas_status rocsolver_sygvx_hegvx_batched_impl(rocblas_handle handle,
     // memory workspace allocation
     void *scalars, *work1, *work2, *work3, *work4, *work5, *work6, *D, *E, *iblock, *isplit, *tau,
         *work7_workArr, *iinfo;
-    rocblas_device_malloc mem(handle, size_scalars, size_work1, size_work2, size_work3, size_work4,
+    rocblas_device_malloc mem(handle, size_t(0), size_work1, size_work2, size_work3, size_work4,
                               size_work5, size_work6, size_D, size_E, size_iblock, size_isplit,
                               size_tau, size_work7_workArr, size_iinfo);
 
@@ -127,15 +128,15 @@ rocblas_status rocsolver_sygvx_hegvx_batched_impl(rocblas_handle handle,
     work7_workArr = mem[12];
     iinfo = mem[13];
     if(size_scalars > 0)
-        init_scalars(handle, (T*)scalars);
+        ROCBLAS_CHECK(set_device_scalars<T>(scalars));
 
     // execution
-    return rocsolver_sygvx_hegvx_template<true, false, T>(
+    return _info_summary_scope.commit(rocsolver_sygvx_hegvx_template<true, false, T>(
         handle, itype, evect, erange, uplo, n, A, shiftA, lda, strideA, B, shiftB, ldb, strideB, vl,
         vu, il, iu, abstol, nev, W, strideW, Z, shiftZ, ldz, strideZ, ifail, strideF, info,
         batch_count, (T*)scalars, work1, work2, work3, work4, work5, work6, (S*)D, (S*)E,
         (rocblas_int*)iblock, (rocblas_int*)isplit, (T*)tau, work7_workArr, (rocblas_int*)iinfo,
-        optim_mem);
+        optim_mem));
 }
 
 ROCSOLVER_END_NAMESPACE
@@ -35,6 +35,7 @@
 #include "auxiliary/rocauxiliary_larfg.hpp"
 #include "rocblas.hpp"
 #include "rocsolver/rocsolver.h"
+#include "rocsolver_run_specialized_kernels.hpp"
 
 ROCSOLVER_BEGIN_NAMESPACE
 
@@ -135,6 +136,14 @@ ROCSOLVER_KERNEL void set_tridiag(const rocblas_fill uplo,
     }
 }
 
+/** This function determines whether the matrix is reduced by a single launch of the
+    small-size kernel **/
+template <typename T>
+inline bool sytd2_use_small(const rocblas_int n)
+{
+    return n <= SYTD2_SPKER_MAX_N && n * n <= SYTD2_SPKER_MAX_SIZE(T);
+}
+
 template <bool BATCHED, typename T>
 void rocsolver_sytd2_hetd2_getMemorySize(const rocblas_int n,
                                          const rocblas_int batch_count,
@@ -237,6 +246,11 @@ rocblas_status rocsolver_sytd2_hetd2_template(rocblas_handle handle,
     if(n == 0 || batch_count == 0)
         return rocblas_status_success;
 
+    // if the matrix is small, keep it in LDS and reduce it with a single launch
+    if(sytd2_use_small<T>(n))
+        return sytd2_run_small<T>(handle, uplo, n, A, shiftA, lda, strideA, D, strideD, E, strideE,
+                                  tau, strideP, batch_count);
+
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
@@ -63,7 +63,7 @@ rocblas_status rocsolver_sytd2_hetd2_batched_impl(rocblas_handle handle,
     rocblas_stride strideA = 0;
 
     // memory workspace sizes:
-    // size for constants in rocblas calls
+    // constants in rocblas calls (only whether they are needed, see set_device_scalars)
     size_t size_scalars;
     // extra requirements for calling LARFG
     size_t size_norms, size_work;
@@ -75,12 +75,12 @@ rocblas_status rocsolver_sytd2_hetd2_batched_impl(rocblas_handle handle,
                                                  &size_norms, &size_tmptau, &size_workArr);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work, size_norms,
+        return rocblas_set_optimal_device_memory_size(handle, size_t(0), size_work, size_norms,
                                                       size_tmptau, size_workArr);
 
     // memory workspace allocation
     void *scalars, *work, *norms, *tmptau, *workArr;
-    rocblas_device_malloc mem(handle, size_scalars, size_work, size_norms, size_tmptau, size_workArr);
+    rocblas_device_malloc mem(handle, size_t(0), size_work, size_norms, size_tmptau, size_workArr);
 
     if(!mem)
         return rocblas_status_memory_error;
@@ -91,7 +91,7 @@ rocblas_status rocsolver_sytd2_hetd2_batched_impl(rocblas_handle handle,
     tmptau = mem[3];
     workArr = mem[4];
     if(size_scalars > 0)
-        init_scalars(handle, (T*)scalars);
+        ROCBLAS_CHECK(set_device_scalars<T>(scalars));
 
     // execution
     return rocsolver_sytd2_hetd2_template<T>(handle, uplo, n, A, shiftA, lda, strideA, D, strideD,
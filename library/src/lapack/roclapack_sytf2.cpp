@@ -39,6 +39,7 @@ rocblas_status rocsolver_sytf2_impl(rocblas_handle handle,
                                     rocblas_int* info)
 {
     ROCSOLVER_ENTER_TOP("sytf2", "--uplo", uplo, "-n", n, "--lda", lda);
+    ROCSOLVER_INFO_SUMMARY(info, 1);
 
     if(!handle)
         return rocblas_status_invalid_handle;
@@ -61,8 +62,8 @@ rocblas_status rocsolver_sytf2_impl(rocblas_handle handle,
         return rocblas_status_size_unchanged;
 
     // execution
-    return rocsolver_sytf2_template<T>(handle, uplo, n, A, shiftA, lda, strideA, ipiv, strideP,
-                                       info, batch_count);
+    return _info_summary_scope.commit(rocsolver_sytf2_template<T>(
+        handle, uplo, n, A, shiftA, lda, strideA, ipiv, strideP, info, batch_count));
 }
 
 ROCSOLVER_END_NAMESPACE
@@ -42,6 +42,7 @@ rocblas_status rocsolver_sytf2_batched_impl(rocblas_handle handle,
 {
     ROCSOLVER_ENTER_TOP("sytf2_batched", "--uplo", uplo, "-n", n, "--lda", lda, "--strideP",
                         strideP, "--batch_count", batch_count);
+    ROCSOLVER_INFO_SUMMARY(info, batch_count);
 
     if(!handle)
         return rocblas_status_invalid_handle;
@@ -63,8 +64,8 @@ rocblas_status rocsolver_sytf2_batched_impl(rocblas_handle handle,
         return rocblas_status_size_unchanged;
 
     // execution
-    return rocsolver_sytf2_template<T>(handle, uplo, n, A, shiftA, lda, strideA, ipiv, strideP,
-                                       info, batch_count);
+    return _info_summary_scope.commit(rocsolver_sytf2_template<T>(
+        handle, uplo, n, A, shiftA, lda, strideA, ipiv, strideP, info, batch_count));
 }
 
 ROCSOLVER_END_NAMESPACE
@@ -43,6 +43,7 @@ rocblas_status rocsolver_sytf2_strided_batched_impl(rocblas_handle handle,
 {
     ROCSOLVER_ENTER_TOP("sytf2_strided_batched", "--uplo", uplo, "-n", n, "--lda", lda, "--strideA",
                         strideA, "--strideP", strideP, "--batch_count", batch_count);
+    ROCSOLVER_INFO_SUMMARY(info, batch_count);
 
     if(!handle)
         return rocblas_status_invalid_handle;
@@ -61,8 +62,8 @@ rocblas_status rocsolver_sytf2_strided_batched_impl(rocblas_handle handle,
         return rocblas_status_size_unchanged;
 
     // execution
-    return rocsolver_sytf2_template<T>(handle, uplo, n, A, shiftA, lda, strideA, ipiv, strideP,
-                                       info, batch_count);
+    return _info_summary_scope.commit(rocsolver_sytf2_template<T>(
+        handle, uplo, n, A, shiftA, lda, strideA, ipiv, strideP, info, batch_count));
 }
 
 ROCSOLVER_END_NAMESPACE
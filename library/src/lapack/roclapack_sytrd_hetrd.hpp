@@ -72,6 +72,13 @@ void rocsolver_sytrd_hetrd_getMemorySize(const rocblas_int n,
     rocsolver_sytd2_hetd2_getMemorySize<BATCHED, T>(n, batch_count, size_scalars, size_work,
                                                     size_norms, &s2, size_workArr);
 
+    // extra requirements to call LATRD with the fused kernels
+    if(n > xxTRD_xxTD2_SWITCHSIZE && latrd_use_fused(xxTRD_BLOCKSIZE))
+    {
+        size_t w_temp = sizeof(T) * latrd_fused_stride(n, xxTRD_BLOCKSIZE) * batch_count;
+        *size_work = std::max(*size_work, w_temp);
+    }
+
     *size_tmptau_W = std::max(s1, s2);
 }
 
@@ -0,0 +1,782 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "auxiliary/rocauxiliary_larft.hpp"
+#include "auxiliary/rocauxiliary_ormlq_unmlq.hpp"
+#include "auxiliary/rocauxiliary_ormqr_unmqr.hpp"
+#include "rocblas.hpp"
+#include "roclapack_gelqf.hpp"
+#include "roclapack_geqrf.hpp"
+#include "rocsolver/rocsolver.h"
+#include "rocsolver_streams.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+#define SB2ST_MAX_THDS 1024 // Max number of threads per thread-block used in the bulge chasing
+
+/*
+ * ===========================================================================
+ *    The two-stage reduction to tridiagonal form first reduces the matrix A to a
+ *    band matrix B with nb sub-diagonals (A = Q1 * B * Q1'), using blocked
+ *    Householder transformations that are applied through matrix-matrix products.
+ *    B is then reduced to tridiagonal form T (B = Q2 * T * Q2') by bulge chasing.
+ *
+ *    Sweep s of the bulge chasing annihilates column s of B below its sub-diagonal.
+ *    Step 0 of the sweep generates a reflector of length nb from column s and applies
+ *    it to the diagonal block of rows s+1:s+nb. Step k > 0 applies the reflector of
+ *    step k-1 to the off-diagonal block of rows r = s+1+k*nb : r+nb-1, which creates
+ *    a bulge, generates a new reflector that annihilates the first column of the bulge,
+ *    and applies it to the rest of the block and to the diagonal block of rows r:r+nb-1.
+ *    Step k of sweep s only conflicts with steps k' <= k+1 of sweep s-1, so sweep s can
+ *    execute its step k at time t = 2s + k, concurrently with the other sweeps.
+ * ===========================================================================
+ */
+
+/** Number of steps (generated reflectors) of sweep s **/
+__host__ __device__ inline rocblas_int sb2st_nsteps(const rocblas_int n,
+                                                    const rocblas_int nb,
+                                                    const rocblas_int s)
+{
+    return (n - 2 - s) / nb + 1;
+}
+
+/** Number of time steps of the bulge chasing **/
+__host__ __device__ inline rocblas_int sb2st_ntimes(const rocblas_int n)
+{
+    return 2 * (n - 2) + 1;
+}
+
+/** Size (in elements per matrix) of the array that holds the Householder scalars of the first
+    stage, followed by the Householder scalars and vectors of the second stage. All the vectors
+    of the second stage are kept only if they are needed for the back-transformation **/
+inline rocblas_stride
+    sytrd_2stage_hous_size(const bool keepV, const rocblas_int n, const rocblas_int nb)
+{
+    rocblas_stride nv = keepV ? rocblas_stride(n - 1) * sb2st_nsteps(n, nb, 0) : n - 1;
+    return n + nv * (nb + 1);
+}
+
+/** SB2ST_ACTIVE_SWEEPS returns the number of sweeps that are active at time step t, and sets
+    smin to the first of them **/
+__device__ rocblas_int sb2st_active_sweeps(const rocblas_int n,
+                                           const rocblas_int nb,
+                                           const rocblas_int t,
+                                           rocblas_int& smin)
+{
+    rocblas_int smax = std::min(t / 2, n - 2);
+
+    // sweep s <= smax is active if t - 2s < nsteps(s); as this condition is monotone in s,
+    // the first active sweep can be found by bisection
+    rocblas_int lo = 0, hi = smax + 1, mid;
+    while(lo < hi)
+    {
+        mid = (lo + hi) / 2;
+        if(t - 2 * mid < sb2st_nsteps(n, nb, mid))
+            hi = mid;
+        else
+            lo = mid + 1;
+    }
+
+    smin = lo;
+    return smax - lo + 1;
+}
+
+/** Element (i,j), i >= j, of a lower band matrix stored in AB **/
+template <typename T>
+__device__ inline T&
+    sb2st_band(T* AB, const rocblas_int ldab, const rocblas_int i, const rocblas_int j)
+{
+    return AB[(i - j) + j * static_cast<int64_t>(ldab)];
+}
+
+/** SY2SB_COPY_V copies the Householder vectors of a panel factorization into the m-by-k matrix V
+    (unit lower trapezoidal). The vectors are stored in the columns of A if uplo is lower,
+    and (conjugated) in the rows of A if uplo is upper **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void sy2sb_copy_V(const rocblas_fill uplo,
+                                   const rocblas_int m,
+                                   const rocblas_int k,
+                                   U AA,
+                                   const rocblas_int shiftA,
+                                   const rocblas_int lda,
+                                   const rocblas_stride strideA,
+                                   T* VV,
+                                   const rocblas_int ldv,
+                                   const rocblas_stride strideV)
+{
+    rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocblas_int j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+    rocblas_int b = hipBlockIdx_z;
+
+    if(i < m && j < k)
+    {
+        T* A = load_ptr_batch<T>(AA, b, shiftA, strideA);
+        T* V = VV + b * strideV;
+        T val;
+
+        if(i == j)
+            val = 1;
+        else if(i < j)
+            val = 0;
+        else if(uplo == rocblas_fill_lower)
+            val = A[i + j * static_cast<int64_t>(lda)];
+        else
+            val = conj(A[j + i * static_cast<int64_t>(lda)]);
+
+        V[i + j * static_cast<int64_t>(ldv)] = val;
+    }
+}
+
+/** SY2SB_COPY_BAND copies the band of A with nb sub-diagonals into AB (in lower band storage),
+    and zeroes the extra ldab-nb-1 sub-diagonals that will hold the bulges **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void sy2sb_copy_band(const rocblas_fill uplo,
+                                      const rocblas_int n,
+                                      const rocblas_int nb,
+                                      U AA,
+                                      const rocblas_int shiftA,
+                                      const rocblas_int lda,
+                                      const rocblas_stride strideA,
+                                      T* ABB,
+                                      const rocblas_int ldab,
+                                      const rocblas_stride strideAB)
+{
+    rocblas_int d = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocblas_int j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+    rocblas_int b = hipBlockIdx_z;
+
+    if(d < ldab && j < n)
+    {
+        T* A = load_ptr_batch<T>(AA, b, shiftA, strideA);
+        T* AB = ABB + b * strideAB;
+        T val = 0;
+
+        if(d <= nb && j + d < n)
+        {
+            if(uplo == rocblas_fill_lower)
+                val = A[(j + d) + j * static_cast<int64_t>(lda)];
+            else
+                val = conj(A[j + (j + d) * static_cast<int64_t>(lda)]);
+        }
+
+        AB[d + j * static_cast<int64_t>(ldab)] = val;
+    }
+}
+
+/** SB2ST_KERNEL reduces the lower band matrix in AB (with nb sub-diagonals and ldab >= 2*nb)
+    to tridiagonal form by bulge chasing. It uses one thread-block per matrix; each task (step
+    of a sweep) is executed by a group of nb threads, and the active sweeps of every time step
+    are distributed among the groups. The diagonal and off-diagonal elements are returned in
+    D and E, and the Householder scalars and vectors are stored after the first n elements of
+    hous (if keepV = false, only the last reflector of each sweep is kept) **/
+template <typename T, typename S>
+ROCSOLVER_KERNEL void __launch_bounds__(SB2ST_MAX_THDS) sb2st_kernel(const rocblas_int n,
+                                                                     const rocblas_int nb,
+                                                                     T* ABB,
+                                                                     const rocblas_int ldab,
+                                                                     const rocblas_stride strideAB,
+                                                                     S* DD,
+                                                                     const rocblas_stride strideD,
+                                                                     S* EE,
+                                                                     const rocblas_stride strideE,
+                                                                     T* housA,
+                                                                     const rocblas_stride strideH,
+                                                                     const bool keepV)
+{
+    rocblas_int bid = hipBlockIdx_y;
+    rocblas_int tid = hipThreadIdx_x;
+    rocblas_int ngroups = hipBlockDim_x / nb;
+    rocblas_int q = tid / nb; // group of the thread
+    rocblas_int g = tid % nb; // index of the thread within its group
+
+    T* AB = ABB + bid * strideAB;
+    S* D = DD + bid * strideD;
+    S* E = EE + bid * strideE;
+
+    // Householder scalars and vectors of step k of sweep s are at position s*lds + k*ldk
+    rocblas_int nsteps0 = sb2st_nsteps(n, nb, 0);
+    rocblas_int lds = keepV ? nsteps0 : 1;
+    rocblas_int ldk = keepV ? 1 : 0;
+    rocblas_stride nv = rocblas_stride(n - 1) * lds;
+    T* tau2 = housA + bid * strideH + n;
+    T* V2 = tau2 + nv;
+
+    // shared memory for the generating column, the Householder vector and the work
+    // vector of each group
+    extern __shared__ double lmem[];
+    T* xs = reinterpret_cast<T*>(lmem) + q * 3 * nb;
+    T* vn = xs + nb;
+    T* w = vn + nb;
+
+    rocblas_int ntimes = sb2st_ntimes(n);
+    for(rocblas_int t = 0; t < ntimes; t++)
+    {
+        rocblas_int smin;
+        rocblas_int nact = sb2st_active_sweeps(n, nb, t, smin);
+
+        for(rocblas_int r0 = 0; r0 < nact; r0 += ngroups)
+        {
+            // the task of this group is step k of sweep s, acting on rows r:r+len-1
+            bool active = (r0 + q < nact);
+            rocblas_int s = smin + r0 + q;
+            rocblas_int k = t - 2 * s;
+            rocblas_int r = s + 1 + k * nb;
+            rocblas_int len = active ? std::min(nb, n - r) : 0;
+            rocblas_int col = (k == 0) ? s : r - nb;
+            rocblas_int pos = s * lds + k * ldk;
+
+            T tau = 0, scal;
+            S beta;
+
+            // 1. apply the previous reflector of the sweep from the right to the off-diagonal
+            // block B(r:r+len-1, col:col+nb-1), and load the column to be annihilated
+            if(g < len)
+            {
+                if(k > 0)
+                {
+                    rocblas_int ppos = pos - ldk;
+                    T* vp = V2 + ppos * nb;
+                    T tp = tau2[ppos];
+                    T y = 0;
+                    for(rocblas_int j = 0; j < nb; j++)
+                        y += sb2st_band(AB, ldab, r + g, col + j) * vp[j];
+                    y *= tp;
+                    for(rocblas_int j = 0; j < nb; j++)
+                        sb2st_band(AB, ldab, r + g, col + j) -= y * conj(vp[j]);
+                }
+                xs[g] = sb2st_band(AB, ldab, r + g, col);
+            }
+            __syncthreads();
+
+            // 2. generate the new reflector
+            if(active)
+            {
+                S xnorm2 = 0;
+                for(rocblas_int i = 1; i < len; i++)
+                    xnorm2 += std::norm(xs[i]);
+                larfg_set_taubeta(xs[0], xnorm2, tau, scal, beta);
+
+                if(g < len)
+                {
+                    T v = (g == 0) ? T(1) : xs[g] * scal;
+                    vn[g] = v;
+                    V2[pos * nb + g] = v;
+                    sb2st_band(AB, ldab, r + g, col) = (g == 0) ? T(beta) : T(0);
+                }
+                if(g == 0)
+                {
+                    tau2[pos] = tau;
+                    if(k == 0)
+                        E[s] = beta;
+                }
+            }
+            __syncthreads();
+
+            // 3. apply the new reflector from the left to the rest of the off-diagonal block,
+            // and compute w = B(r:r+len-1, r:r+len-1) * v
+            if(active)
+            {
+                if(k > 0 && g > 0)
+                {
+                    T z = 0;
+                    for(rocblas_int i = 0; i < len; i++)
+                        z += conj(vn[i]) * sb2st_band(AB, ldab, r + i, col + g);
+                    z *= conj(tau);
+                    for(rocblas_int i = 0; i < len; i++)
+                        sb2st_band(AB, ldab, r + i, col + g) -= vn[i] * z;
+                }
+                if(g < len)
+                {
+                    T y = 0;
+                    for(rocblas_int j = 0; j <= g; j++)
+                        y += sb2st_band(AB, ldab, r + g, r + j) * vn[j];
+                    for(rocblas_int j = g + 1; j < len; j++)
+                        y += conj(sb2st_band(AB, ldab, r + j, r + g)) * vn[j];
+                    w[g] = y;
+                }
+            }
+            __syncthreads();
+
+            // 4. apply the new reflector from both sides to the diagonal block
+            // (as in LARFY with scalar conj(tau))
+            if(g < len)
+            {
+                T ctau = conj(tau);
+                T alpha = 0;
+                for(rocblas_int i = 0; i < len; i++)
+                    alpha += conj(w[i]) * vn[i];
+                alpha *= T(-0.5) * ctau;
+
+                T wg = w[g] + alpha * vn[g];
+                for(rocblas_int j = 0; j <= g; j++)
+                {
+                    T wj = w[j] + alpha * vn[j];
+                    sb2st_band(AB, ldab, r + g, r + j)
+                        -= ctau * vn[g] * conj(wj) + tau * wg * conj(vn[j]);
+                }
+            }
+            __syncthreads();
+        }
+    }
+
+    // copy the diagonal
+    for(rocblas_int i = tid; i < n; i += hipBlockDim_x)
+        D[i] = std::real(sb2st_band(AB, ldab, i, i));
+}
+
+/** SB2ST_APPLY_Q overwrites the n-by-ncols matrix Z with Q2 * Z, where Q2 is the product of the
+    reflectors generated by SB2ST_KERNEL (with keepV = true). Each thread applies reflectors to
+    one column of Z; the reflectors of a time step act on disjoint rows and are applied in
+    parallel by the threads along x **/
+template <typename T>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) sb2st_apply_Q(const rocblas_int n,
+                                                           const rocblas_int ncols,
+                                                           const rocblas_int nb,
+                                                           T* housA,
+                                                           const rocblas_stride strideH,
+                                                           T* ZZ,
+                                                           const rocblas_int shiftZ,
+                                                           const rocblas_int ldz,
+                                                           const rocblas_stride strideZ)
+{
+    rocblas_int bid = hipBlockIdx_y;
+    rocblas_int c = hipBlockIdx_x * hipBlockDim_y + hipThreadIdx_y;
+    rocblas_int tx = hipThreadIdx_x;
+
+    rocblas_int nsteps0 = sb2st_nsteps(n, nb, 0);
+    rocblas_stride nv = rocblas_stride(n - 1) * nsteps0;
+    T* tau2 = housA + bid * strideH + n;
+    T* V2 = tau2 + nv;
+    T* Z = ZZ + bid * strideZ + shiftZ + c * static_cast<int64_t>(ldz);
+
+    // Q2 = H(first) * ... * H(last), so apply the time steps in reverse order
+    for(rocblas_int t = sb2st_ntimes(n) - 1; t >= 0; t--)
+    {
+        rocblas_int smin;
+        rocblas_int nact = sb2st_active_sweeps(n, nb, t, smin);
+
+        if(c < ncols)
+        {
+            for(rocblas_int i = tx; i < nact; i += hipBlockDim_x)
+            {
+                rocblas_int s = smin + i;
+                rocblas_int k = t - 2 * s;
+                rocblas_int r = s + 1 + k * nb;
+                rocblas_int len = std::min(nb, n - r);
+                rocblas_stride pos = rocblas_stride(s) * nsteps0 + k;
+                T* v = V2 + pos * nb;
+
+                T d = 0;
+                for(rocblas_int j = 0; j < len; j++)
+                    d += conj(v[j]) * Z[r + j];
+                d *= tau2[pos];
+                for(rocblas_int j = 0; j < len; j++)
+                    Z[r + j] -= v[j] * d;
+            }
+        }
+        __syncthreads();
+    }
+}
+
+/** Helper to calculate workspace sizes **/
+template <bool BATCHED, typename T>
+void rocsolver_sytrd_hetrd_2stage_getMemorySize(const rocblas_evect evect,
+                                                const rocblas_fill uplo,
+                                                const rocblas_int n,
+                                                const rocblas_int batch_count,
+                                                size_t* size_scalars,
+                                                size_t* size_work_workArr,
+                                                size_t* size_Abyx_norms_trfact,
+                                                size_t* size_diag_tmptr,
+                                                size_t* size_workArr,
+                                                size_t* size_tmpW,
+                                                size_t* size_hous)
+{
+    // if quick return no workspace needed
+    if(n == 0 || batch_count == 0)
+    {
+        *size_scalars = 0;
+        *size_work_workArr = 0;
+        *size_Abyx_norms_trfact = 0;
+        *size_diag_tmptr = 0;
+        *size_workArr = 0;
+        *size_tmpW = 0;
+        *size_hous = 0;
+        return;
+    }
+
+    const rocblas_int nb = xxTRD_2STAGE_BANDWIDTH;
+    size_t unused, w1 = 0, w2 = 0, a1 = 0, a2 = 0;
+
+    *size_scalars = 0;
+    *size_Abyx_norms_trfact = 0;
+    *size_diag_tmptr = 0;
+
+    if(n > nb)
+    {
+        rocblas_int m = n - nb;
+        rocblas_int jb = std::min(nb, m);
+
+        // requirements for the factorization of the largest panel
+        if(uplo == rocblas_fill_lower)
+            rocsolver_geqrf_getMemorySize<BATCHED, T>(m, jb, batch_count, size_scalars, &w1,
+                                                      size_Abyx_norms_trfact, size_diag_tmptr, &a1);
+        else
+            rocsolver_gelqf_getMemorySize<BATCHED, T>(jb, m, batch_count, size_scalars, &w1,
+                                                      size_Abyx_norms_trfact, size_diag_tmptr, &a1);
+
+        // requirements for calling LARFT
+        rocsolver_larft_getMemorySize<BATCHED, T>(m, jb, batch_count, &unused, &w2, &a2);
+    }
+
+    *size_work_workArr = std::max(w1, w2);
+
+    // size of array of pointers (for the BLAS calls with workspace arguments in the batched case)
+    *size_workArr = std::max(a1, a2);
+    if(BATCHED)
+        *size_workArr = std::max(*size_workArr, 2 * sizeof(T*) * batch_count);
+
+    // size of the band matrix (with room for the bulges), the explicit Householder vectors of
+    // a panel and the matrix W (n-by-nb each), and the triangular factor and a temporary
+    // matrix (nb-by-nb each)
+    *size_tmpW = sizeof(T) * (2 * nb * n + 2 * n * nb + 2 * nb * nb) * batch_count;
+
+    // size of the array of Householder scalars and vectors
+    *size_hous = sizeof(T) * sytrd_2stage_hous_size(evect == rocblas_evect_original, n, nb)
+        * batch_count;
+}
+
+/** SYTRD_HETRD_2STAGE reduces the symmetric/hermitian matrix A to tridiagonal form in two stages.
+    On exit, D and E contain the tridiagonal matrix, and the Householder vectors of the first
+    stage are stored in A (below/to the right of the band) with their scalars at the beginning
+    of hous. The Householder vectors and scalars of the second stage are stored in the rest of
+    hous **/
+template <bool BATCHED, bool STRIDED, typename T, typename S, typename U>
+rocblas_status rocsolver_sytrd_hetrd_2stage_template(rocblas_handle handle,
+                                                     const rocblas_evect evect,
+                                                     const rocblas_fill uplo,
+                                                     const rocblas_int n,
+                                                     U A,
+                                                     const rocblas_int shiftA,
+                                                     const rocblas_int lda,
+                                                     const rocblas_stride strideA,
+                                                     S* D,
+                                                     const rocblas_stride strideD,
+                                                     S* E,
+                                                     const rocblas_stride strideE,
+                                                     const rocblas_int batch_count,
+                                                     T* scalars,
+                                                     void* work_workArr,
+                                                     T* Abyx_norms_trfact,
+                                                     T* diag_tmptr,
+                                                     T** workArr,
+                                                     T* tmpW,
+                                                     T* hous)
+{
+    ROCSOLVER_ENTER("sytrd_hetrd_2stage", "evect:", evect, "uplo:", uplo, "n:", n,
+                    "shiftA:", shiftA, "lda:", lda, "bc:", batch_count);
+
+    // quick return
+    if(n == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // everything must be executed with scalars on the host
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+
+    // scalars for rocblas calls
+    T one = 1;
+    T zero = 0;
+    T minone = -1;
+    T minhalf = -0.5;
+    S sone = 1;
+
+    const rocblas_int nb = xxTRD_2STAGE_BANDWIDTH;
+    const bool keepV = (evect == rocblas_evect_original);
+    const rocblas_stride strideH = sytrd_2stage_hous_size(keepV, n, nb);
+
+    // tmpW holds the band matrix AB, the matrices V and W, the triangular factor Tf and
+    // the temporary matrix X of each problem
+    const rocblas_int ldab = 2 * nb;
+    const rocblas_int ldv = n;
+    const rocblas_int ldt = nb;
+    const rocblas_stride strideW = 2 * nb * n + 2 * n * nb + 2 * nb * nb;
+    T* AB = tmpW;
+    T* V = AB + ldab * n;
+    T* W = V + ldv * nb;
+    T* Tf = W + ldv * nb;
+    T* X = Tf + ldt * nb;
+
+    // 1. reduce A to band form
+    for(rocblas_int j = 0; j < n - nb; j += nb)
+    {
+        rocblas_int m = n - j - nb; // order of the trailing matrix
+        rocblas_int jb = std::min(nb, m); // number of reflectors of the panel
+        rocblas_int shiftP = shiftA
+            + (uplo == rocblas_fill_lower ? idx2D(j + nb, j, lda) : idx2D(j, j + nb, lda));
+        rocblas_int shiftT = shiftA + idx2D(j + nb, j + nb, lda);
+
+        // factorize the panel and compute the triangular factor of its block reflector
+        if(uplo == rocblas_fill_lower)
+        {
+            rocsolver_geqrf_template<BATCHED, STRIDED>(
+                handle, m, jb, A, shiftP, lda, strideA, (hous + j), strideH, batch_count, scalars,
+                work_workArr, Abyx_norms_trfact, diag_tmptr, workArr);
+
+            rocsolver_larft_template<T>(handle, rocblas_forward_direction, rocblas_column_wise, m,
+                                        jb, A, shiftP, lda, strideA, (hous + j), strideH, Tf, ldt,
+                                        strideW, batch_count, scalars, (T*)work_workArr, workArr);
+        }
+        else
+        {
+            rocsolver_gelqf_template<BATCHED, STRIDED>(
+                handle, jb, m, A, shiftP, lda, strideA, (hous + j), strideH, batch_count, scalars,
+                work_workArr, Abyx_norms_trfact, diag_tmptr, workArr);
+
+            rocsolver_larft_template<T>(handle, rocblas_forward_direction, rocblas_row_wise, m, jb,
+                                        A, shiftP, lda, strideA, (hous + j), strideH, Tf, ldt,
+                                        strideW, batch_count, scalars, (T*)work_workArr, workArr);
+        }
+
+        rocblas_int blocksx = (m - 1) / BS2 + 1;
+        rocblas_int blocksy = (jb - 1) / BS2 + 1;
+        ROCSOLVER_LAUNCH_KERNEL(sy2sb_copy_V<T>, dim3(blocksx, blocksy, batch_count),
+                                dim3(BS2, BS2), 0, stream, uplo, m, jb, A, shiftP, lda, strideA, V,
+                                ldv, strideW);
+
+        // W = A22 * V * Tf
+        rocblasCall_symm_hemm<T>(handle, rocblas_side_left, uplo, m, jb, &one, A, shiftT, lda,
+                                 strideA, V, 0, ldv, strideW, &zero, W, 0, ldv, strideW,
+                                 batch_count, workArr);
+
+        rocblasCall_trmm<T>(handle, rocblas_side_right, rocblas_fill_upper, rocblas_operation_none,
+                            rocblas_diagonal_non_unit, m, jb, &one, 0, Tf, 0, ldt, strideW, W, 0,
+                            ldv, strideW, batch_count);
+
+        // W = W - 1/2 * V * Tf' * V' * W
+        rocblasCall_gemm<T>(handle, rocblas_operation_conjugate_transpose, rocblas_operation_none,
+                            jb, jb, m, &one, V, 0, ldv, strideW, W, 0, ldv, strideW, &zero, X, 0,
+                            ldt, strideW, batch_count, workArr);
+
+        rocblasCall_trmm<T>(handle, rocblas_side_left, rocblas_fill_upper,
+                            rocblas_operation_conjugate_transpose, rocblas_diagonal_non_unit, jb,
+                            jb, &one, 0, Tf, 0, ldt, strideW, X, 0, ldt, strideW, batch_count);
+
+        rocblasCall_gemm<T>(handle, rocblas_operation_none, rocblas_operation_none, m, jb, jb,
+                            &minhalf, V, 0, ldv, strideW, X, 0, ldt, strideW, &one, W, 0, ldv,
+                            strideW, batch_count, workArr);
+
+        // update the trailing matrix as a rank-2k update
+        // A22 = A22 - V * W' - W * V'
+        rocblasCall_syr2k_her2k<BATCHED, T>(handle, uplo, rocblas_operation_none, m, jb, &minone,
+                                            V, 0, ldv, strideW, W, 0, ldv, strideW, &sone, A,
+                                            shiftT, lda, strideA, batch_count, workArr);
+    }
+
+    // 2. reduce the band matrix to tridiagonal form
+    rocblas_int blocksx = (ldab - 1) / BS2 + 1;
+    rocblas_int blocksy = (n - 1) / BS2 + 1;
+    ROCSOLVER_LAUNCH_KERNEL(sy2sb_copy_band<T>, dim3(blocksx, blocksy, batch_count),
+                            dim3(BS2, BS2), 0, stream, uplo, n, nb, A, shiftA, lda, strideA, AB,
+                            ldab, strideW);
+
+    rocblas_int ngroups = SB2ST_MAX_THDS / nb;
+    size_t lmemsize = sizeof(T) * 3 * nb * ngroups;
+    ROCSOLVER_LAUNCH_KERNEL(sb2st_kernel<T>, dim3(1, batch_count), dim3(nb * ngroups), lmemsize,
+                            stream, n, nb, AB, ldab, strideW, D, strideD, E, strideE, hous, strideH,
+                            keepV);
+
+    rocblas_set_pointer_mode(handle, old_mode);
+    return rocblas_status_success;
+}
+
+/** Helper to calculate workspace sizes **/
+template <bool BATCHED, typename T>
+void rocsolver_ormtr_unmtr_2stage_getMemorySize(const rocblas_fill uplo,
+                                                const rocblas_int n,
+                                                const rocblas_int ncols,
+                                                const rocblas_int batch_count,
+                                                size_t* size_scalars,
+                                                size_t* size_AbyxORwork,
+                                                size_t* size_diagORtmptr,
+                                                size_t* size_trfact,
+                                                size_t* size_workArr)
+{
+    const rocblas_int nq = std::max(n - xxTRD_2STAGE_BANDWIDTH, 0);
+
+    // requirements for applying the reflectors of the first stage
+    if(uplo == rocblas_fill_lower)
+        rocsolver_ormqr_unmqr_getMemorySize<BATCHED, T>(
+            rocblas_side_left, nq, ncols, nq, batch_count, size_scalars, size_AbyxORwork,
+            size_diagORtmptr, size_trfact, size_workArr);
+    else
+        rocsolver_ormlq_unmlq_getMemorySize<BATCHED, T>(
+            rocblas_side_left, nq, ncols, nq, batch_count, size_scalars, size_AbyxORwork,
+            size_diagORtmptr, size_trfact, size_workArr);
+
+    // size of array of pointers (the second half is used to pass the strided matrix Z in the
+    // batched case)
+    if(BATCHED)
+        *size_workArr = std::max(*size_workArr, 2 * sizeof(T*) * batch_count);
+}
+
+/** This function determines whether the back-transformation is pipelined by blocks of columns **/
+template <bool ISBATCHED>
+bool ormtr_unmtr_2stage_use_pipeline(const rocblas_int n, const rocblas_int ncols)
+{
+    return !ISBATCHED && n > xxTRD_2STAGE_BANDWIDTH && ncols > xxTRD_2STAGE_PIPELINE_COLS
+        && n <= xxTRD_2STAGE_PIPELINE_MAX_SIZE;
+}
+
+/** ORMTR_UNMTR_2STAGE overwrites the n-by-ncols matrix Z with Q * Z, where Q = Q1 * Q2 is the
+    unitary matrix of the two-stage reduction computed by SYTRD_HETRD_2STAGE (with
+    evect = original) **/
+template <bool BATCHED, bool STRIDED, typename T, typename U>
+rocblas_status rocsolver_ormtr_unmtr_2stage_template(rocblas_handle handle,
+                                                     const rocblas_fill uplo,
+                                                     const rocblas_int n,
+                                                     const rocblas_int ncols,
+                                                     U A,
+                                                     const rocblas_int shiftA,
+                                                     const rocblas_int lda,
+                                                     const rocblas_stride strideA,
+                                                     T* hous,
+                                                     T* Z,
+                                                     const rocblas_int shiftZ,
+                                                     const rocblas_int ldz,
+                                                     const rocblas_stride strideZ,
+                                                     const rocblas_int batch_count,
+                                                     T* scalars,
+                                                     T* AbyxORwork,
+                                                     T* diagORtmptr,
+                                                     T* trfact,
+                                                     T** workArr)
+{
+    ROCSOLVER_ENTER("ormtr_unmtr_2stage", "uplo:", uplo, "n:", n, "ncols:", ncols,
+                    "shiftA:", shiftA, "lda:", lda, "shiftZ:", shiftZ, "ldz:", ldz,
+                    "bc:", batch_count);
+
+    // quick return
+    if(n <= 1 || ncols == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    const rocblas_int nb = xxTRD_2STAGE_BANDWIDTH;
+    const rocblas_stride strideH = sytrd_2stage_hous_size(true, n, nb);
+    const rocblas_int nq = n - nb;
+
+    // Z(:,j:j+jc-1) = Q2 * Z(:,j:j+jc-1)
+    auto apply_Q2 = [&](const rocblas_int j, const rocblas_int jc, hipStream_t qstream) {
+        rocblas_int blocks = (jc - 1) / (BS1 / BS2) + 1;
+        ROCSOLVER_LAUNCH_KERNEL(sb2st_apply_Q<T>, dim3(blocks, batch_count), dim3(BS2, BS1 / BS2),
+                                0, qstream, n, jc, nb, hous, strideH, Z, shiftZ + idx2D(0, j, ldz),
+                                ldz, strideZ);
+    };
+
+    // Z(:,j:j+jc-1) = Q1 * Z(:,j:j+jc-1)
+    auto apply_Q1 = [&](const rocblas_int j, const rocblas_int jc) {
+        if(uplo == rocblas_fill_lower)
+            rocsolver_ormqr_unmqr_template<BATCHED, STRIDED, T>(
+                handle, rocblas_side_left, rocblas_operation_none, nq, jc, nq, A,
+                shiftA + idx2D(nb, 0, lda), lda, strideA, hous, strideH, Z,
+                shiftZ + idx2D(nb, j, ldz), ldz, strideZ, batch_count, scalars, AbyxORwork,
+                diagORtmptr, trfact, workArr, workArr + batch_count);
+        else
+            rocsolver_ormlq_unmlq_template<BATCHED, STRIDED, T>(
+                handle, rocblas_side_left,
+                (rocblas_is_complex<T> ? rocblas_operation_conjugate_transpose
+                                       : rocblas_operation_transpose),
+                nq, jc, nq, A, shiftA + idx2D(0, nb, lda), lda, strideA, hous, strideH, Z,
+                shiftZ + idx2D(nb, j, ldz), ldz, strideZ, batch_count, scalars, AbyxORwork,
+                diagORtmptr, trfact, workArr, workArr + batch_count);
+    };
+
+    // events to synchronize the side stream with the stream of the handle
+    // (NOTE: hipEventDestroy is deferred until the events have completed)
+    hipStream_t sstream;
+    hipEvent_t ready, applied;
+    bool pipeline = ormtr_unmtr_2stage_use_pipeline<BATCHED || STRIDED>(n, ncols)
+        && rocsolver_get_side_stream(handle, &sstream) == hipSuccess
+        && hipEventCreateWithFlags(&ready, hipEventDisableTiming) == hipSuccess;
+    if(pipeline && hipEventCreateWithFlags(&applied, hipEventDisableTiming) != hipSuccess)
+    {
+        hipEventDestroy(ready);
+        pipeline = false;
+    }
+
+    if(pipeline)
+    {
+        // Q2 is applied to the blocks of columns on the side stream, one block ahead
+        // of the application of Q1 on the stream of the handle
+        const rocblas_int cb = xxTRD_2STAGE_PIPELINE_COLS;
+        hipEventRecord(ready, stream);
+        hipStreamWaitEvent(sstream, ready, 0);
+        apply_Q2(0, std::min(cb, ncols), sstream);
+
+        for(rocblas_int j = 0; j < ncols; j += cb)
+        {
+            const rocblas_int jc = std::min(cb, ncols - j);
+
+            // wait for Q2 to be applied to the current block, and start with the next one
+            hipEventRecord(applied, sstream);
+            hipStreamWaitEvent(stream, applied, 0);
+            if(j + cb < ncols)
+                apply_Q2(j + cb, std::min(cb, ncols - j - cb), sstream);
+
+            apply_Q1(j, jc);
+        }
+
+        hipEventDestroy(ready);
+        hipEventDestroy(applied);
+    }
+    else
+    {
+        // Z = Q2 * Z
+        apply_Q2(0, ncols, stream);
+
+        // Z = Q1 * Z
+        if(nq > 0)
+            apply_Q1(0, ncols);
+    }
+
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
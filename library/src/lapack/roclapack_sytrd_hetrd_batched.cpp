@@ -63,7 +63,7 @@ rocblas_status rocsolver_sytrd_hetrd_batched_impl(rocblas_handle handle,
     rocblas_stride strideA = 0;
 
     // memory workspace sizes:
-    // size for constants in rocblas calls
+    // constants in rocblas calls (only whether they are needed, see set_device_scalars)
     size_t size_scalars;
     // extra requirements for calling SYTD2/HETD2
     size_t size_norms, size_work, size_tmptau_W;
@@ -73,12 +73,12 @@ rocblas_status rocsolver_sytrd_hetrd_batched_impl(rocblas_handle handle,
                                                  &size_norms, &size_tmptau_W, &size_workArr);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work, size_norms,
+        return rocblas_set_optimal_device_memory_size(handle, size_t(0), size_work, size_norms,
                                                       size_tmptau_W, size_workArr);
 
     // memory workspace allocation
     void *scalars, *work, *norms, *tmptau_W, *workArr;
-    rocblas_device_malloc mem(handle, size_scalars, size_work, size_norms, size_tmptau_W,
+    rocblas_device_malloc mem(handle, size_t(0), size_work, size_norms, size_tmptau_W,
                               size_workArr);
 
     if(!mem)
@@ -90,7 +90,7 @@ rocblas_status rocsolver_sytrd_hetrd_batched_impl(rocblas_handle handle,
     tmptau_W = mem[3];
     workArr = mem[4];
     if(size_scalars > 0)
-        init_scalars(handle, (T*)scalars);
+        ROCBLAS_CHECK(set_device_scalars<T>(scalars));
 
     // execution
     return rocsolver_sytrd_hetrd_template<true, T>(
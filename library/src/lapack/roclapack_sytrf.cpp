@@ -39,6 +39,7 @@ rocblas_status rocsolver_sytrf_impl(rocblas_handle handle,
                                     rocblas_int* info)
 {
     ROCSOLVER_ENTER_TOP("sytrf", "--uplo", uplo, "-n", n, "--lda", lda);
+    ROCSOLVER_INFO_SUMMARY(info, 1);
 
     if(!handle)
         return rocblas_status_invalid_handle;
@@ -74,8 +75,8 @@ rocblas_status rocsolver_sytrf_impl(rocblas_handle handle,
     work = mem[0];
 
     // execution
-    return rocsolver_sytrf_template<T>(handle, uplo, n, A, shiftA, lda, strideA, ipiv, strideP,
-                                       info, batch_count, (T*)work);
+    return _info_summary_scope.commit(rocsolver_sytrf_template<T>(
+        handle, uplo, n, A, shiftA, lda, strideA, ipiv, strideP, info, batch_count, (T*)work));
 }
 
 ROCSOLVER_END_NAMESPACE
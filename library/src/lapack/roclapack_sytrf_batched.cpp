@@ -42,6 +42,7 @@ rocblas_status rocsolver_sytrf_batched_impl(rocblas_handle handle,
 {
     ROCSOLVER_ENTER_TOP("sytrf_batched", "--uplo", uplo, "-n", n, "--lda", lda, "--strideP",
                         strideP, "--batch_count", batch_count);
+    ROCSOLVER_INFO_SUMMARY(info, batch_count);
 
     if(!handle)
         return rocblas_status_invalid_handle;
@@ -76,8 +77,8 @@ rocblas_status rocsolver_sytrf_batched_impl(rocblas_handle handle,
     work = mem[0];
 
     // execution
-    return rocsolver_sytrf_template<T>(handle, uplo, n, A, shiftA, lda, strideA, ipiv, strideP,
-                                       info, batch_count, (T*)work);
+    return _info_summary_scope.commit(rocsolver_sytrf_template<T>(
+        handle, uplo, n, A, shiftA, lda, strideA, ipiv, strideP, info, batch_count, (T*)work));
 }
 
 ROCSOLVER_END_NAMESPACE
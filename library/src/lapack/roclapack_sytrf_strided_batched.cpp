@@ -43,6 +43,7 @@ rocblas_status rocsolver_sytrf_strided_batched_impl(rocblas_handle handle,
 {
     ROCSOLVER_ENTER_TOP("sytrf_strided_batched", "--uplo", uplo, "-n", n, "--lda", lda, "--strideA",
                         strideA, "--strideP", strideP, "--batch_count", batch_count);
+    ROCSOLVER_INFO_SUMMARY(info, batch_count);
 
     if(!handle)
         return rocblas_status_invalid_handle;
@@ -74,8 +75,8 @@ rocblas_status rocsolver_sytrf_strided_batched_impl(rocblas_handle handle,
     work = mem[0];
 
     // execution
-    return rocsolver_sytrf_template<T>(handle, uplo, n, A, shiftA, lda, strideA, ipiv, strideP,
-                                       info, batch_count, (T*)work);
+    return _info_summary_scope.commit(rocsolver_sytrf_template<T>(
+        handle, uplo, n, A, shiftA, lda, strideA, ipiv, strideP, info, batch_count, (T*)work));
 }
 
 ROCSOLVER_END_NAMESPACE
@@ -0,0 +1,161 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "roclapack_sytrs.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+template <typename T>
+rocblas_status rocsolver_sytrs_impl(rocblas_handle handle,
+                                    const rocblas_fill uplo,
+                                    const rocblas_int n,
+                                    const rocblas_int nrhs,
+                                    T* A,
+                                    const rocblas_int lda,
+                                    const rocblas_int* ipiv,
+                                    T* B,
+                                    const rocblas_int ldb)
+{
+    ROCSOLVER_ENTER_TOP("sytrs", "--uplo", uplo, "-n", n, "--nrhs", nrhs, "--lda", lda, "--ldb",
+                        ldb);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_sytrs_argCheck(handle, uplo, n, nrhs, lda, ldb, A, B, ipiv);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // nominal flop count for the call statistics
+    rocsolver_stats_flops(rocsolver_sytrs_flops<T>(n, nrhs));
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+    rocblas_int shiftB = 0;
+
+    // normal (non-batched non-strided) execution
+    rocblas_stride strideA = 0;
+    rocblas_stride strideP = 0;
+    rocblas_stride strideB = 0;
+    rocblas_int batch_count = 1;
+
+    // memory workspace sizes:
+    // size of workspace (for calling TRSM)
+    bool optim_mem;
+    size_t size_work1, size_work2, size_work3, size_work4;
+    // size of array to store the off-diagonal elements of D
+    size_t size_work;
+    rocsolver_sytrs_getMemorySize<false, false, T>(n, nrhs, batch_count, &size_work1, &size_work2,
+                                                   &size_work3, &size_work4, &size_work,
+                                                   &optim_mem);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_work1, size_work2, size_work3,
+                                                      size_work4, size_work);
+
+    // memory workspace allocation
+    void *work1, *work2, *work3, *work4, *work;
+    rocblas_device_malloc mem(handle, size_work1, size_work2, size_work3, size_work4, size_work);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    work1 = mem[0];
+    work2 = mem[1];
+    work3 = mem[2];
+    work4 = mem[3];
+    work = mem[4];
+
+    // execution
+    return rocsolver_sytrs_template<false, false, T>(handle, uplo, n, nrhs, A, shiftA, lda, strideA,
+                                                     ipiv, strideP, B, shiftB, ldb, strideB,
+                                                     batch_count, work1, work2, work3, work4,
+                                                     (T*)work, optim_mem);
+}
+
+ROCSOLVER_END_NAMESPACE
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocblas_status rocsolver_ssytrs(rocblas_handle handle,
+                                           const rocblas_fill uplo,
+                                           const rocblas_int n,
+                                           const rocblas_int nrhs,
+                                           float* A,
+                                           const rocblas_int lda,
+                                           const rocblas_int* ipiv,
+                                           float* B,
+                                           const rocblas_int ldb)
+{
+    return rocsolver::rocsolver_sytrs_impl<float>(handle, uplo, n, nrhs, A, lda, ipiv, B, ldb);
+}
+
+extern "C" rocblas_status rocsolver_dsytrs(rocblas_handle handle,
+                                           const rocblas_fill uplo,
+                                           const rocblas_int n,
+                                           const rocblas_int nrhs,
+                                           double* A,
+                                           const rocblas_int lda,
+                                           const rocblas_int* ipiv,
+                                           double* B,
+                                           const rocblas_int ldb)
+{
+    return rocsolver::rocsolver_sytrs_impl<double>(handle, uplo, n, nrhs, A, lda, ipiv, B, ldb);
+}
+
+extern "C" rocblas_status rocsolver_csytrs(rocblas_handle handle,
+                                           const rocblas_fill uplo,
+                                           const rocblas_int n,
+                                           const rocblas_int nrhs,
+                                           rocblas_float_complex* A,
+                                           const rocblas_int lda,
+                                           const rocblas_int* ipiv,
+                                           rocblas_float_complex* B,
+                                           const rocblas_int ldb)
+{
+    return rocsolver::rocsolver_sytrs_impl<rocblas_float_complex>(handle, uplo, n, nrhs, A, lda,
+                                                                  ipiv, B, ldb);
+}
+
+extern "C" rocblas_status rocsolver_zsytrs(rocblas_handle handle,
+                                           const rocblas_fill uplo,
+                                           const rocblas_int n,
+                                           const rocblas_int nrhs,
+                                           rocblas_double_complex* A,
+                                           const rocblas_int lda,
+                                           const rocblas_int* ipiv,
+                                           rocblas_double_complex* B,
+                                           const rocblas_int ldb)
+{
+    return rocsolver::rocsolver_sytrs_impl<rocblas_double_complex>(handle, uplo, n, nrhs, A, lda,
+                                                                   ipiv, B, ldb);
+}
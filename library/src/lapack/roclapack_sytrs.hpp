@@ -0,0 +1,509 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "rocsolver/rocsolver.h"
+#include "rocsolver_run_specialized_kernels.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/** SYTRS_SYCONV converts column j of the factor U (or L) returned by SYTRF into a column
+    of a unit triangular matrix and back (as SYCONV in LAPACK). When converting (revert = false),
+    the off-diagonal element of the 2-by-2 block of D in column j is moved from A to E[j], and the
+    row interchanges are applied to the multipliers; when reverting, the interchanges are undone
+    and the element of E[j] is moved back to A. **/
+template <typename T>
+__device__ void sytrs_syconv(const rocblas_fill uplo,
+                             const bool revert,
+                             const rocblas_int n,
+                             const rocblas_int j,
+                             T* A,
+                             const rocblas_int lda,
+                             const rocblas_int* ipiv,
+                             T* E)
+{
+    // (indices i and j are 0-based, the pivot indices are 1-based)
+    rocblas_int i, ip;
+    bool paired = false;
+
+    if(uplo == rocblas_fill_upper)
+    {
+        // the interchanges of U(i) apply to the columns after the diagonal block
+        if(!revert)
+        {
+            T e = 0;
+            i = n - 1;
+            while(i >= 0)
+            {
+                if(ipiv[i] > 0)
+                {
+                    ip = ipiv[i] - 1;
+                    if(i < j)
+                        swap(A[ip + j * lda], A[i + j * lda]);
+                }
+                else
+                {
+                    ip = -ipiv[i] - 1;
+                    if(i == j)
+                    {
+                        e = A[(j - 1) + j * lda];
+                        A[(j - 1) + j * lda] = 0;
+                    }
+                    if(i < j)
+                        swap(A[ip + j * lda], A[(i - 1) + j * lda]);
+                    i--;
+                }
+                i--;
+            }
+            E[j] = e;
+        }
+        else
+        {
+            i = 0;
+            while(i < n)
+            {
+                if(ipiv[i] > 0)
+                {
+                    ip = ipiv[i] - 1;
+                    if(i < j)
+                        swap(A[i + j * lda], A[ip + j * lda]);
+                }
+                else
+                {
+                    ip = -ipiv[i] - 1;
+                    i++;
+                    if(i == j)
+                        paired = true;
+                    if(i < j)
+                        swap(A[(i - 1) + j * lda], A[ip + j * lda]);
+                }
+                i++;
+            }
+            if(paired)
+                A[(j - 1) + j * lda] = E[j];
+        }
+    }
+    else
+    {
+        // the interchanges of L(i) apply to the columns before the diagonal block
+        if(!revert)
+        {
+            T e = 0;
+            i = 0;
+            while(i < n)
+            {
+                if(ipiv[i] > 0)
+                {
+                    ip = ipiv[i] - 1;
+                    if(i > j)
+                        swap(A[ip + j * lda], A[i + j * lda]);
+                }
+                else
+                {
+                    ip = -ipiv[i] - 1;
+                    if(i == j)
+                    {
+                        e = A[(j + 1) + j * lda];
+                        A[(j + 1) + j * lda] = 0;
+                    }
+                    if(i > j)
+                        swap(A[ip + j * lda], A[(i + 1) + j * lda]);
+                    i++;
+                }
+                i++;
+            }
+            E[j] = e;
+        }
+        else
+        {
+            i = n - 1;
+            while(i >= 0)
+            {
+                if(ipiv[i] > 0)
+                {
+                    ip = ipiv[i] - 1;
+                    if(i > j)
+                        swap(A[i + j * lda], A[ip + j * lda]);
+                }
+                else
+                {
+                    ip = -ipiv[i] - 1;
+                    i--;
+                    if(i == j)
+                        paired = true;
+                    if(i > j)
+                        swap(A[(i + 1) + j * lda], A[ip + j * lda]);
+                }
+                i--;
+            }
+            if(paired)
+                A[(j + 1) + j * lda] = E[j];
+        }
+    }
+}
+
+/** SYTRS_PERMUTE applies the interchanges of the factorization returned by SYTRF to the
+    column B of the right hand side. If inverse = false, B is overwritten by P'*B, otherwise by
+    P*B. **/
+template <typename T>
+__device__ void sytrs_permute(const rocblas_fill uplo,
+                              const bool inverse,
+                              const rocblas_int n,
+                              const rocblas_int* ipiv,
+                              T* B)
+{
+    // (the interchanges are applied in the order of the factorization for P'*B, backwards
+    // otherwise; k is 0-based, the pivot indices are 1-based)
+    rocblas_int k, kp;
+    bool backward = (uplo == rocblas_fill_upper) != inverse;
+
+    if(backward)
+    {
+        k = n - 1;
+        while(k >= 0)
+        {
+            if(ipiv[k] > 0)
+            {
+                kp = ipiv[k] - 1;
+                if(kp != k)
+                    swap(B[k], B[kp]);
+                k--;
+            }
+            else
+            {
+                // 2-by-2 block in rows k-1 and k
+                kp = -ipiv[k] - 1;
+                if(uplo == rocblas_fill_upper)
+                    swap(B[k - 1], B[kp]);
+                else
+                    swap(B[k], B[kp]);
+                k -= 2;
+            }
+        }
+    }
+    else
+    {
+        k = 0;
+        while(k < n)
+        {
+            if(ipiv[k] > 0)
+            {
+                kp = ipiv[k] - 1;
+                if(kp != k)
+                    swap(B[k], B[kp]);
+                k++;
+            }
+            else
+            {
+                // 2-by-2 block in rows k and k+1
+                kp = -ipiv[k] - 1;
+                if(uplo == rocblas_fill_upper)
+                    swap(B[k], B[kp]);
+                else
+                    swap(B[k + 1], B[kp]);
+                k += 2;
+            }
+        }
+    }
+}
+
+/** SYTRS_SYCONV_PERMUTE_KERNEL fuses the conversion of the factor (or its reversal) with the
+    interchanges of the right hand sides. When revert = false, it converts the factor and
+    overwrites B with P'*B; when revert = true, it overwrites B with P*B and restores the factor.
+    Thread j works with column j of A (if j < n) and column j of B (if j < nrhs). **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void sytrs_syconv_permute_kernel(const rocblas_fill uplo,
+                                                  const bool revert,
+                                                  const rocblas_int n,
+                                                  const rocblas_int nrhs,
+                                                  U AA,
+                                                  const rocblas_int shiftA,
+                                                  const rocblas_int lda,
+                                                  const rocblas_stride strideA,
+                                                  const rocblas_int* ipivA,
+                                                  const rocblas_stride strideP,
+                                                  T* EE,
+                                                  U BB,
+                                                  const rocblas_int shiftB,
+                                                  const rocblas_int ldb,
+                                                  const rocblas_stride strideB)
+{
+    rocblas_int bid = hipBlockIdx_y;
+    rocblas_int j = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    // batch instance
+    const rocblas_int* ipiv = ipivA + bid * strideP;
+
+    if(j < n)
+    {
+        T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+        sytrs_syconv<T>(uplo, revert, n, j, A, lda, ipiv, EE + bid * n);
+    }
+
+    if(j < nrhs)
+    {
+        T* B = load_ptr_batch<T>(BB, bid, shiftB, strideB);
+        sytrs_permute<T>(uplo, revert, n, ipiv, B + j * ldb);
+    }
+}
+
+/** SYTRS_DIAG_KERNEL solves D*X = B, where D is the block diagonal matrix returned by SYTRF
+    (after the conversion by sytrs_syconv_kernel, the off-diagonal elements of its 2-by-2
+    blocks are in E). Each thread works with a different column of B. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void sytrs_diag_kernel(const rocblas_fill uplo,
+                                        const rocblas_int n,
+                                        const rocblas_int nrhs,
+                                        U AA,
+                                        const rocblas_int shiftA,
+                                        const rocblas_int lda,
+                                        const rocblas_stride strideA,
+                                        const rocblas_int* ipivA,
+                                        const rocblas_stride strideP,
+                                        T* EE,
+                                        U BB,
+                                        const rocblas_int shiftB,
+                                        const rocblas_int ldb,
+                                        const rocblas_stride strideB)
+{
+    rocblas_int bid = hipBlockIdx_y;
+    rocblas_int j = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(j >= nrhs)
+        return;
+
+    // batch instance
+    T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+    T* B = load_ptr_batch<T>(BB, bid, shiftB, strideB) + j * ldb;
+    const rocblas_int* ipiv = ipivA + bid * strideP;
+    T* E = EE + bid * n;
+
+    // the 2-by-2 blocks are in rows i and i+1 in both cases; the off-diagonal element is
+    // in E[i+1] if uplo is upper, or in E[i] if uplo is lower
+    rocblas_int i = 0;
+    while(i < n)
+    {
+        if(ipiv[i] > 0)
+        {
+            B[i] = B[i] / A[i + i * lda];
+            i++;
+        }
+        else
+        {
+            T akm1k = (uplo == rocblas_fill_upper) ? E[i + 1] : E[i];
+            T akm1 = A[i + i * lda] / akm1k;
+            T ak = A[(i + 1) + (i + 1) * lda] / akm1k;
+            T denom = akm1 * ak - T(1);
+            T bkm1 = B[i] / akm1k;
+            T bk = B[i + 1] / akm1k;
+            B[i] = (ak * bkm1 - bk) / denom;
+            B[i + 1] = (akm1 * bk - bkm1) / denom;
+            i += 2;
+        }
+    }
+}
+
+template <typename T>
+rocblas_status rocsolver_sytrs_argCheck(rocblas_handle handle,
+                                        const rocblas_fill uplo,
+                                        const rocblas_int n,
+                                        const rocblas_int nrhs,
+                                        const rocblas_int lda,
+                                        const rocblas_int ldb,
+                                        T A,
+                                        T B,
+                                        const rocblas_int* ipiv,
+                                        const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(n < 0 || nrhs < 0 || lda < n || ldb < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !A) || (n && !ipiv) || (nrhs && n && !B))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void rocsolver_sytrs_getMemorySize(const rocblas_int n,
+                                   const rocblas_int nrhs,
+                                   const rocblas_int batch_count,
+                                   size_t* size_work1,
+                                   size_t* size_work2,
+                                   size_t* size_work3,
+                                   size_t* size_work4,
+                                   size_t* size_work,
+                                   bool* optim_mem)
+{
+    // if quick return, no workspace is needed
+    if(n == 0 || nrhs == 0 || batch_count == 0)
+    {
+        *size_work1 = 0;
+        *size_work2 = 0;
+        *size_work3 = 0;
+        *size_work4 = 0;
+        *size_work = 0;
+        *optim_mem = true;
+        return;
+    }
+
+    // workspace required for calling TRSM
+    // call with both rocblas_operation_none and rocblas_operation_transpose and take maximum memory
+    size_t size_work1_temp1, size_work1_temp2, size_work2_temp1, size_work2_temp2, size_work3_temp1,
+        size_work3_temp2, size_work4_temp1, size_work4_temp2;
+    rocsolver_trsm_mem<BATCHED, STRIDED, T>(rocblas_side_left, rocblas_operation_none, n, nrhs,
+                                            batch_count, &size_work1_temp1, &size_work2_temp1,
+                                            &size_work3_temp1, &size_work4_temp1, optim_mem);
+    rocsolver_trsm_mem<BATCHED, STRIDED, T>(rocblas_side_left, rocblas_operation_transpose, n, nrhs,
+                                            batch_count, &size_work1_temp2, &size_work2_temp2,
+                                            &size_work3_temp2, &size_work4_temp2, optim_mem);
+
+    *size_work1 = std::max(size_work1_temp1, size_work1_temp2);
+    *size_work2 = std::max(size_work2_temp1, size_work2_temp2);
+    *size_work3 = std::max(size_work3_temp1, size_work3_temp2);
+    *size_work4 = std::max(size_work4_temp1, size_work4_temp2);
+
+    // size of array E with the off-diagonal elements of D
+    *size_work = sizeof(T) * n * batch_count;
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename U>
+rocblas_status rocsolver_sytrs_template(rocblas_handle handle,
+                                        const rocblas_fill uplo,
+                                        const rocblas_int n,
+                                        const rocblas_int nrhs,
+                                        U A,
+                                        const rocblas_int shiftA,
+                                        const rocblas_int lda,
+                                        const rocblas_stride strideA,
+                                        const rocblas_int* ipiv,
+                                        const rocblas_stride strideP,
+                                        U B,
+                                        const rocblas_int shiftB,
+                                        const rocblas_int ldb,
+                                        const rocblas_stride strideB,
+                                        const rocblas_int batch_count,
+                                        void* work1,
+                                        void* work2,
+                                        void* work3,
+                                        void* work4,
+                                        T* work,
+                                        bool optim_mem)
+{
+    ROCSOLVER_ENTER("sytrs", "uplo:", uplo, "n:", n, "nrhs:", nrhs, "shiftA:", shiftA, "lda:", lda,
+                    "shiftB:", shiftB, "ldb:", ldb, "bc:", batch_count);
+
+    // quick return
+    if(n == 0 || nrhs == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // everything must be executed with scalars on the host
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+
+    dim3 threads(BS1, 1, 1);
+    dim3 gridAB((std::max(n, nrhs) - 1) / BS1 + 1, batch_count, 1);
+    dim3 gridB((nrhs - 1) / BS1 + 1, batch_count, 1);
+
+    // convert the factor into a unit triangular matrix and compute B = P'*B
+    // (the off-diagonal elements of D are saved in work)
+    ROCSOLVER_LAUNCH_KERNEL((sytrs_syconv_permute_kernel<T>), gridAB, threads, 0, stream, uplo,
+                            false, n, nrhs, A, shiftA, lda, strideA, ipiv, strideP, work, B,
+                            shiftB, ldb, strideB);
+
+    if(uplo == rocblas_fill_upper)
+    {
+        // solve U*X = B, overwriting B with X
+        rocsolver_trsm_upper<BATCHED, STRIDED, T>(handle, rocblas_side_left, rocblas_operation_none,
+                                                  rocblas_diagonal_unit, n, nrhs, A, shiftA, lda,
+                                                  strideA, B, shiftB, ldb, strideB, batch_count,
+                                                  optim_mem, work1, work2, work3, work4);
+
+        // solve D*X = B, overwriting B with X
+        ROCSOLVER_LAUNCH_KERNEL((sytrs_diag_kernel<T>), gridB, threads, 0, stream, uplo, n, nrhs,
+                                A, shiftA, lda, strideA, ipiv, strideP, work, B, shiftB, ldb,
+                                strideB);
+
+        // solve U'*X = B, overwriting B with X
+        rocsolver_trsm_upper<BATCHED, STRIDED, T>(
+            handle, rocblas_side_left, rocblas_operation_transpose, rocblas_diagonal_unit, n, nrhs,
+            A, shiftA, lda, strideA, B, shiftB, ldb, strideB, batch_count, optim_mem, work1, work2,
+            work3, work4);
+    }
+    else
+    {
+        // solve L*X = B, overwriting B with X
+        rocsolver_trsm_lower<BATCHED, STRIDED, T>(handle, rocblas_side_left, rocblas_operation_none,
+                                                  rocblas_diagonal_unit, n, nrhs, A, shiftA, lda,
+                                                  strideA, B, shiftB, ldb, strideB, batch_count,
+                                                  optim_mem, work1, work2, work3, work4);
+
+        // solve D*X = B, overwriting B with X
+        ROCSOLVER_LAUNCH_KERNEL((sytrs_diag_kernel<T>), gridB, threads, 0, stream, uplo, n, nrhs,
+                                A, shiftA, lda, strideA, ipiv, strideP, work, B, shiftB, ldb,
+                                strideB);
+
+        // solve L'*X = B, overwriting B with X
+        rocsolver_trsm_lower<BATCHED, STRIDED, T>(
+            handle, rocblas_side_left, rocblas_operation_transpose, rocblas_diagonal_unit, n, nrhs,
+            A, shiftA, lda, strideA, B, shiftB, ldb, strideB, batch_count, optim_mem, work1, work2,
+            work3, work4);
+    }
+
+    // compute B = P*B and restore the factor
+    ROCSOLVER_LAUNCH_KERNEL((sytrs_syconv_permute_kernel<T>), gridAB, threads, 0, stream, uplo,
+                            true, n, nrhs, A, shiftA, lda, strideA, ipiv, strideP, work, B, shiftB,
+                            ldb, strideB);
+
+    rocblas_set_pointer_mode(handle, old_mode);
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
@@ -0,0 +1,158 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.9.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     November 2019
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "roclapack_trcon.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_trcon_impl(rocblas_handle handle,
+                                    const rocblas_fill uplo,
+                                    const rocblas_diagonal diag,
+                                    const rocblas_int n,
+                                    U A,
+                                    const rocblas_int lda,
+                                    S* rcond)
+{
+    ROCSOLVER_ENTER_TOP("trcon", "--uplo", uplo, "--diag", diag, "-n", n, "--lda", lda);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_trcon_argCheck(handle, uplo, diag, n, lda, A, rcond);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+
+    // normal (non-batched non-strided) execution
+    rocblas_stride strideA = 0;
+    rocblas_int batch_count = 1;
+
+    // memory workspace sizes:
+    // size of the vectors used in the norm estimation
+    size_t size_x;
+    // size of the estimates and states of the norm estimation
+    size_t size_est, size_state;
+    // size of the 1-norms of the matrices
+    size_t size_norm;
+    // extra requirements for calling TRSV
+    size_t size_iwork;
+    // size of array of pointers (only for batched case)
+    size_t size_workArr;
+    rocsolver_trcon_getMemorySize<false, T, S>(n, batch_count, &size_x, &size_est, &size_state,
+                                               &size_norm, &size_iwork, &size_workArr);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_x, size_est, size_state,
+                                                      size_norm, size_iwork, size_workArr);
+
+    // memory workspace allocation
+    void *x, *est, *state, *norm, *iwork, *workArr;
+    rocblas_device_malloc mem(handle, size_x, size_est, size_state, size_norm, size_iwork,
+                              size_workArr);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    x = mem[0];
+    est = mem[1];
+    state = mem[2];
+    norm = mem[3];
+    iwork = mem[4];
+    workArr = mem[5];
+
+    // execution
+    return rocsolver_trcon_template<T>(handle, uplo, diag, n, A, shiftA, lda, strideA, rcond,
+                                       batch_count, (T*)x, (S*)est, (rocblas_int*)state, (S*)norm,
+                                       (rocblas_int*)iwork, (T**)workArr);
+}
+
+ROCSOLVER_END_NAMESPACE
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_strcon(rocblas_handle handle,
+                                const rocblas_fill uplo,
+                                const rocblas_diagonal diag,
+                                const rocblas_int n,
+                                float* A,
+                                const rocblas_int lda,
+                                float* rcond)
+{
+    return rocsolver::rocsolver_trcon_impl<float>(handle, uplo, diag, n, A, lda, rcond);
+}
+
+rocblas_status rocsolver_dtrcon(rocblas_handle handle,
+                                const rocblas_fill uplo,
+                                const rocblas_diagonal diag,
+                                const rocblas_int n,
+                                double* A,
+                                const rocblas_int lda,
+                                double* rcond)
+{
+    return rocsolver::rocsolver_trcon_impl<double>(handle, uplo, diag, n, A, lda, rcond);
+}
+
+rocblas_status rocsolver_ctrcon(rocblas_handle handle,
+                                const rocblas_fill uplo,
+                                const rocblas_diagonal diag,
+                                const rocblas_int n,
+                                rocblas_float_complex* A,
+                                const rocblas_int lda,
+                                float* rcond)
+{
+    return rocsolver::rocsolver_trcon_impl<rocblas_float_complex>(handle, uplo, diag, n, A, lda,
+                                                                  rcond);
+}
+
+rocblas_status rocsolver_ztrcon(rocblas_handle handle,
+                                const rocblas_fill uplo,
+                                const rocblas_diagonal diag,
+                                const rocblas_int n,
+                                rocblas_double_complex* A,
+                                const rocblas_int lda,
+                                double* rcond)
+{
+    return rocsolver::rocsolver_trcon_impl<rocblas_double_complex>(handle, uplo, diag, n, A, lda,
+                                                                   rcond);
+}
+
+} // extern C
@@ -0,0 +1,236 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.9.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     November 2019
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "auxiliary/rocauxiliary_lacn2.hpp"
+#include "rocblas.hpp"
+#include "rocsolver/rocsolver.h"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/** TRCON_NORM1 computes the 1-norm of the triangular matrix A. Call this kernel with
+    batch_count groups in x, and BS1 threads in x. **/
+template <typename T, typename S, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) trcon_norm1(const rocblas_fill uplo,
+                                                         const rocblas_diagonal diag,
+                                                         const rocblas_int n,
+                                                         U AA,
+                                                         const rocblas_int shiftA,
+                                                         const rocblas_int lda,
+                                                         const rocblas_stride strideA,
+                                                         S* anormA)
+{
+    const rocblas_int b = hipBlockIdx_x;
+    const rocblas_int tid = hipThreadIdx_x;
+
+    T* A = load_ptr_batch<T>(AA, b, shiftA, strideA);
+    const int64_t la = lda;
+    const bool unit = (diag == rocblas_diagonal_unit);
+
+    // shared mem for the reduction
+    __shared__ S sval[BS1];
+
+    // every thread computes the sums of some columns
+    S vmax = 0;
+    for(rocblas_int j = tid; j < n; j += BS1)
+    {
+        rocblas_int i1 = (uplo == rocblas_fill_upper) ? 0 : j + (unit ? 1 : 0);
+        rocblas_int i2 = (uplo == rocblas_fill_upper) ? j - (unit ? 1 : 0) : n - 1;
+        S s = unit ? 1 : 0;
+        for(rocblas_int i = i1; i <= i2; i++)
+            s += std::sqrt(std::norm(A[i + j * la]));
+        vmax = (s > vmax) ? s : vmax;
+    }
+    sval[tid] = vmax;
+    __syncthreads();
+
+    for(rocblas_int r = BS1 / 2; r > 0; r /= 2)
+    {
+        if(tid < r)
+            sval[tid] = (sval[tid + r] > sval[tid]) ? sval[tid + r] : sval[tid];
+        __syncthreads();
+    }
+
+    if(tid == 0)
+        anormA[b] = sval[0];
+}
+
+template <bool BATCHED, typename T, typename S>
+void rocsolver_trcon_getMemorySize(const rocblas_int n,
+                                   const rocblas_int batch_count,
+                                   size_t* size_x,
+                                   size_t* size_est,
+                                   size_t* size_state,
+                                   size_t* size_norm,
+                                   size_t* size_iwork,
+                                   size_t* size_workArr)
+{
+    // if quick return no workspace needed
+    if(n == 0 || batch_count == 0)
+    {
+        *size_x = 0;
+        *size_est = 0;
+        *size_state = 0;
+        *size_norm = 0;
+        *size_iwork = 0;
+        *size_workArr = 0;
+        return;
+    }
+
+    // requirements for the norm estimation
+    rocsolver_lacn2_getMemorySize<T, S>(n, batch_count, size_x, size_est, size_state);
+
+    // the 1-norms of the matrices
+    *size_norm = sizeof(S) * batch_count;
+
+    // extra workspace (for calling TRSV)
+    *size_iwork = sizeof(rocblas_int) * batch_count;
+
+    // size of array of pointers (batched cases)
+    if(BATCHED)
+        *size_workArr = sizeof(T*) * batch_count;
+    else
+        *size_workArr = 0;
+}
+
+template <typename T, typename S>
+rocblas_status rocsolver_trcon_argCheck(rocblas_handle handle,
+                                        const rocblas_fill uplo,
+                                        const rocblas_diagonal diag,
+                                        const rocblas_int n,
+                                        const rocblas_int lda,
+                                        T A,
+                                        S* rcond,
+                                        const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+        return rocblas_status_invalid_value;
+    if(diag != rocblas_diagonal_unit && diag != rocblas_diagonal_non_unit)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(n < 0 || lda < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !A) || (batch_count && !rcond))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_trcon_template(rocblas_handle handle,
+                                        const rocblas_fill uplo,
+                                        const rocblas_diagonal diag,
+                                        const rocblas_int n,
+                                        U A,
+                                        const rocblas_int shiftA,
+                                        const rocblas_int lda,
+                                        const rocblas_stride strideA,
+                                        S* rcond,
+                                        const rocblas_int batch_count,
+                                        T* x,
+                                        S* est,
+                                        rocblas_int* state,
+                                        S* anorm,
+                                        rocblas_int* iwork,
+                                        T** workArr)
+{
+    ROCSOLVER_ENTER("trcon", "uplo:", uplo, "diag:", diag, "n:", n, "shiftA:", shiftA,
+                    "lda:", lda, "bc:", batch_count);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocksReset = (batch_count - 1) / BS1 + 1;
+    dim3 gridReset(blocksReset, 1, 1);
+    dim3 threads(BS1, 1, 1);
+
+    // quick return with rcond = 1
+    if(n == 0)
+    {
+        ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, rcond, batch_count, 1);
+        return rocblas_status_success;
+    }
+
+    // the estimations of the different problems run in separate groups
+    dim3 grid(batch_count, 1, 1);
+    rocblas_stride strideX = n;
+    T* xi = x + strideX * batch_count;
+
+    // compute the 1-norm of A
+    ROCSOLVER_LAUNCH_KERNEL((trcon_norm1<T>), grid, threads, 0, stream, uplo, diag, n, A, shiftA,
+                            lda, strideA, anorm);
+
+    // the reciprocal condition number is zero if A is exactly singular
+    ROCSOLVER_LAUNCH_KERNEL(lacn2_init<T>, grid, threads, 0, stream, n, A, shiftA, lda, strideA,
+                            diag == rocblas_diagonal_non_unit, anorm, est, state);
+
+    // estimate the 1-norm of inv(A)
+    for(rocblas_int r = 0; r < LACN2_ROUNDS; ++r)
+    {
+        rocblas_int kase = (r % 2 == 0) ? 1 : 2;
+        ROCSOLVER_LAUNCH_KERNEL(lacn2_kernel<T>, grid, threads, 0, stream, n, kase, x, xi, strideX,
+                                est, state);
+
+        // x = inv(A) * x or x = inv(A)' * x
+        rocblas_operation trans
+            = (kase == 1) ? rocblas_operation_none : rocblas_operation_conjugate_transpose;
+        rocblasCall_trsv(handle, uplo, trans, diag, n, A, shiftA, lda, strideA, x, 0, 1, strideX,
+                         batch_count, iwork, workArr);
+    }
+
+    // consume the result of the last product (no product follows)
+    ROCSOLVER_LAUNCH_KERNEL(lacn2_kernel<T>, grid, threads, 0, stream, n, 0, x, xi, strideX, est,
+                            state);
+
+    // rcond = 1 / (norm(A) * norm(inv(A)))
+    ROCSOLVER_LAUNCH_KERNEL(lacn2_rcond<S>, gridReset, threads, 0, stream, n, anorm, est, state,
+                            rcond, batch_count);
+
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
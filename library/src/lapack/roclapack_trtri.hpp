@@ -36,6 +36,7 @@
 #include "rocblas.hpp"
 #include "rocsolver/rocsolver.h"
 #include "rocsolver_run_specialized_kernels.hpp"
+#include "rocsolver_tuning.hpp"
 
 ROCSOLVER_BEGIN_NAMESPACE
 
@@ -76,19 +77,39 @@ rocblas_int trtri_get_blksize(const rocblas_int dim)
         rocblas_int size[] = {TRTRI_BATCH_BLKSIZES};
         rocblas_int intervals[] = {TRTRI_BATCH_INTERVALS};
         rocblas_int max = TRTRI_BATCH_NUM_INTERVALS;
-        blk = size[get_index(intervals, max, dim)];
+        blk = get_tuned_blksize("trtri_batch", size, intervals, max, dim);
     }
     else
     {
         rocblas_int size[] = {TRTRI_BLKSIZES};
         rocblas_int intervals[] = {TRTRI_INTERVALS};
         rocblas_int max = TRTRI_NUM_INTERVALS;
-        blk = size[get_index(intervals, max, dim)];
+        blk = get_tuned_blksize("trtri", size, intervals, max, dim);
     }
 
     return blk;
 }
 
+/** Returns the panel width of the blocked Gauss-Jordan kernel for the given size (batched cases
+    only), or 0 if the kernel is not used **/
+template <bool ISBATCHED>
+rocblas_int trtri_gj_get_blksize(const rocblas_int dim)
+{
+    rocblas_int blk = 0;
+
+#ifdef OPTIMAL
+    if(ISBATCHED && dim <= GETRI_BATCH_GJ_MAX_SIZE)
+    {
+        rocblas_int size[] = {TRTRI_BATCH_GJ_BLKSIZES};
+        rocblas_int intervals[] = {TRTRI_BATCH_GJ_INTERVALS};
+        rocblas_int max = TRTRI_BATCH_GJ_NUM_INTERVALS;
+        blk = std::max(0, get_tuned_blksize("trtri_batch_gj", size, intervals, max, dim));
+    }
+#endif
+
+    return blk;
+}
+
 template <bool BATCHED, bool STRIDED, typename T>
 void rocsolver_trtri_getMemorySize(const rocblas_diagonal diag,
                                    const rocblas_int n,
@@ -116,6 +137,42 @@ void rocsolver_trtri_getMemorySize(const rocblas_diagonal diag,
         return;
     }
 
+    // if the blocked Gauss-Jordan kernel is used, no workspace needed
+    if(trtri_gj_get_blksize<ISBATCHED>(n) > 0)
+    {
+        *size_work1 = 0;
+        *size_work2 = 0;
+        *size_work3 = 0;
+        *size_work4 = 0;
+        *size_tmpcopy = 0;
+        *size_workArr = 0;
+        *optim_mem = true;
+        return;
+    }
+
+    // size of array of pointers (batched cases)
+    if(BATCHED)
+        *size_workArr = sizeof(T*) * batch_count;
+    else
+        *size_workArr = 0;
+
+    if(n > TRTRI_RECURSIVE_SWITCHSIZE)
+    {
+        // requirements for the recursive algorithm: copy of A and TRTI2 on the leaves
+        *size_tmpcopy = (diag == rocblas_diagonal_unit) ? 0 : n * n * sizeof(T) * batch_count;
+#ifdef OPTIMAL
+        *size_work1 = 0;
+        *size_work3 = 0;
+#else
+        *size_work1 = TRTRI_MAX_COLS * sizeof(T) * batch_count;
+        *size_work3 = TRTRI_MAX_COLS * sizeof(T) * batch_count;
+#endif
+        *size_work2 = 0;
+        *size_work4 = 0;
+        *optim_mem = true;
+        return;
+    }
+
     // get block size
     rocblas_int blk = trtri_get_blksize<ISBATCHED>(n);
 
@@ -125,12 +182,6 @@ void rocsolver_trtri_getMemorySize(const rocblas_diagonal diag,
     else
         *size_tmpcopy = n * n * sizeof(T) * batch_count;
 
-    // size of array of pointers (batched cases)
-    if(BATCHED)
-        *size_workArr = sizeof(T*) * batch_count;
-    else
-        *size_workArr = 0;
-
     size_t w1a, w1b, w3a, w3b;
 
     // requirements for TRTI2
@@ -282,6 +333,68 @@ void trti2(rocblas_handle handle,
     rocblas_set_pointer_mode(handle, old_mode);
 }
 
+/** TRTRI_RECURSIVE inverts the triangular matrix A in place. The matrix is split in halves, the
+    diagonal blocks are inverted recursively, and the off-diagonal block is updated with two TRMMs
+    of size n/2, i.e. inv(A12) = -inv(A11) * A12 * inv(A22) for the upper case. The recursion stops
+    at blocks of at most TRTRI_MAX_COLS columns, which are inverted by TRTI2. All the scalars must
+    be on the host. **/
+template <typename T, typename U>
+void trtri_recursive(rocblas_handle handle,
+                     const rocblas_fill uplo,
+                     const rocblas_diagonal diag,
+                     const rocblas_int n,
+                     U A,
+                     const rocblas_int shiftA,
+                     const rocblas_int lda,
+                     const rocblas_stride strideA,
+                     const rocblas_int batch_count,
+                     T* work,
+                     T* alphas)
+{
+    if(n <= TRTRI_MAX_COLS)
+    {
+        trti2<T>(handle, uplo, diag, n, A, shiftA, lda, strideA, batch_count, work, alphas);
+        return;
+    }
+
+    T one = 1;
+    T minone = -1;
+
+    // split at a multiple of TRTRI_MAX_COLS close to n/2
+    rocblas_int n1 = std::max(TRTRI_MAX_COLS, ((n / 2 + TRTRI_MAX_COLS / 2) / TRTRI_MAX_COLS)
+                                                  * TRTRI_MAX_COLS);
+    rocblas_int n2 = n - n1;
+    rocblas_int shift11 = shiftA;
+    rocblas_int shift22 = shiftA + idx2D(n1, n1, lda);
+
+    // invert the diagonal blocks
+    trtri_recursive<T>(handle, uplo, diag, n1, A, shift11, lda, strideA, batch_count, work, alphas);
+    trtri_recursive<T>(handle, uplo, diag, n2, A, shift22, lda, strideA, batch_count, work, alphas);
+
+    if(uplo == rocblas_fill_upper)
+    {
+        rocblas_int shift12 = shiftA + idx2D(0, n1, lda);
+
+        // A12 = -inv(A11) * A12 * inv(A22)
+        rocblasCall_trmm(handle, rocblas_side_left, uplo, rocblas_operation_none, diag, n1, n2,
+                         &one, 0, A, shift11, lda, strideA, A, shift12, lda, strideA, batch_count);
+        rocblasCall_trmm(handle, rocblas_side_right, uplo, rocblas_operation_none, diag, n1, n2,
+                         &minone, 0, A, shift22, lda, strideA, A, shift12, lda, strideA,
+                         batch_count);
+    }
+    else
+    {
+        rocblas_int shift21 = shiftA + idx2D(n1, 0, lda);
+
+        // A21 = -inv(A22) * A21 * inv(A11)
+        rocblasCall_trmm(handle, rocblas_side_left, uplo, rocblas_operation_none, diag, n2, n1,
+                         &one, 0, A, shift22, lda, strideA, A, shift21, lda, strideA, batch_count);
+        rocblasCall_trmm(handle, rocblas_side_right, uplo, rocblas_operation_none, diag, n2, n1,
+                         &minone, 0, A, shift11, lda, strideA, A, shift21, lda, strideA,
+                         batch_count);
+    }
+}
+
 template <bool BATCHED, bool STRIDED, typename T, typename U>
 rocblas_status rocsolver_trtri_template(rocblas_handle handle,
                                         const rocblas_fill uplo,
@@ -313,14 +426,25 @@ rocblas_status rocsolver_trtri_template(rocblas_handle handle,
     static constexpr bool ISBATCHED = BATCHED || STRIDED;
 
     // start with info = 0
+    // (with a non-unit diagonal, info is set by the singularity check instead)
     rocblas_int blocks = (batch_count - 1) / 32 + 1;
-    ROCSOLVER_LAUNCH_KERNEL(reset_info, dim3(blocks, 1, 1), dim3(32, 1, 1), 0, stream, info,
-                            batch_count, 0);
+    if(n == 0 || diag == rocblas_diagonal_unit)
+        ROCSOLVER_LAUNCH_KERNEL(reset_info, dim3(blocks, 1, 1), dim3(32, 1, 1), 0, stream, info,
+                                batch_count, 0);
 
     // quick return if no dimensions
     if(n == 0)
         return rocblas_status_success;
 
+#ifdef OPTIMAL
+    // if medium size (batched cases), invert with a single launch of the blocked Gauss-Jordan
+    // kernel (it also checks for singularities)
+    rocblas_int gj_blk = trtri_gj_get_blksize<ISBATCHED>(n);
+    if(gj_blk > 0)
+        return getri_run_gj<T>(handle, uplo, diag, n, gj_blk, A, shiftA, lda, strideA,
+                               (rocblas_int*)nullptr, 0, 0, info, batch_count, true, false);
+#endif
+
     // everything must be executed with scalars on the host
     rocblas_pointer_mode old_mode;
     rocblas_get_pointer_mode(handle, &old_mode);
@@ -339,8 +463,9 @@ rocblas_status rocsolver_trtri_template(rocblas_handle handle,
                                 stream, n, A, shiftA, lda, strideA, info);
     }
 
-    // get block size
-    rocblas_int blk = trtri_get_blksize<ISBATCHED>(n);
+    // get block size (the recursive algorithm is used for large sizes)
+    bool recursive = (n > TRTRI_RECURSIVE_SWITCHSIZE);
+    rocblas_int blk = recursive ? 1 : trtri_get_blksize<ISBATCHED>(n);
     rocblas_int jb;
 
     if(diag == rocblas_diagonal_non_unit && blk > 0)
@@ -351,7 +476,14 @@ rocblas_status rocsolver_trtri_template(rocblas_handle handle,
                                 info_mask(info));
     }
 
-    if(blk == 0)
+    if(recursive)
+    {
+        // use the recursive algorithm
+        trtri_recursive<T>(handle, uplo, diag, n, A, shiftA, lda, strideA, batch_count, (T*)work1,
+                           (T*)work3);
+    }
+
+    else if(blk == 0)
     {
         // simply use rocblas_trtri
         rocblasCall_trtri(handle, uplo, diag, n, A, shiftA, lda, strideA, tmpcopy, 0, ldw, strideW,
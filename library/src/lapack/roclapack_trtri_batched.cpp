@@ -41,6 +41,7 @@ rocblas_status rocsolver_trtri_batched_impl(rocblas_handle handle,
 {
     ROCSOLVER_ENTER_TOP("trtri_batched", "--uplo", uplo, "--diag", diag, "-n", n, "--lda", lda,
                         "--batch_count", batch_count);
+    ROCSOLVER_INFO_SUMMARY(info, batch_count);
 
     if(!handle)
         return rocblas_status_invalid_handle;
@@ -88,9 +89,9 @@ rocblas_status rocsolver_trtri_batched_impl(rocblas_handle handle,
     workArr = mem[5];
 
     // execution
-    return rocsolver_trtri_template<true, false, T>(handle, uplo, diag, n, A, shiftA, lda, strideA,
-                                                    info, batch_count, work1, work2, work3, work4,
-                                                    (T*)tmpcopy, (T**)workArr, optim_mem);
+    return _info_summary_scope.commit(rocsolver_trtri_template<true, false, T>(
+        handle, uplo, diag, n, A, shiftA, lda, strideA, info, batch_count, work1, work2, work3,
+        work4, (T*)tmpcopy, (T**)workArr, optim_mem));
 }
 
 ROCSOLVER_END_NAMESPACE
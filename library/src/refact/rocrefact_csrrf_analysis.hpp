@@ -32,8 +32,438 @@
 #include "rocsolver_rfinfo.hpp"
 #include "rocsparse.hpp"
 
+#include <algorithm>
+#include <tuple>
+#include <vector>
+
 ROCSOLVER_BEGIN_NAMESPACE
 
+/** RF_BUILD_LEVELS computes, on the host, the structures used by the level-scheduled triangular
+    solves of csrrf_solve, and copies them to the device buffer owned by rfinfo.
+    - In LU mode, L is the strictly lower triangular part of T with unit diagonal, and U is the
+      upper triangular part of T.
+    - In Cholesky mode, L is the lower triangular part of T, and U = L'. The rows of U are the
+      columns of L, and their entries are read from valT through the position map.
+    The level of a row is the length of the longest chain of rows on which it depends; the rows
+    of each factor are sorted by level, which gives a valid order for the solves. **/
+inline rocblas_status rf_build_levels(hipStream_t stream,
+                                      rocsolver_rfinfo rfinfo,
+                                      const rocblas_int n,
+                                      const std::vector<rocblas_int>& hptrT,
+                                      const std::vector<rocblas_int>& hindT)
+{
+    const bool lu = (rfinfo->mode == rocsolver_rfinfo_mode_lu);
+
+    // count the off-diagonal entries of every row of L and U, and locate the diagonal
+    std::vector<rocblas_int> ptrL(n + 1, 0), ptrU(n + 1, 0), diagL(n, -1), diagU(n, -1);
+    for(rocblas_int i = 0; i < n; ++i)
+    {
+        for(rocblas_int k = hptrT[i]; k < hptrT[i + 1]; ++k)
+        {
+            rocblas_int c = hindT[k];
+            if(c < i)
+            {
+                ptrL[i + 1]++;
+                if(!lu)
+                    ptrU[c + 1]++;
+            }
+            else if(c == i)
+            {
+                diagU[i] = k;
+                if(!lu)
+                    diagL[i] = k;
+            }
+            else if(lu)
+                ptrU[i + 1]++;
+        }
+    }
+    for(rocblas_int i = 0; i < n; ++i)
+    {
+        ptrL[i + 1] += ptrL[i];
+        ptrU[i + 1] += ptrU[i];
+    }
+
+    // fill the column indices and the positions in valT
+    const rocblas_int nnzL = ptrL[n];
+    const rocblas_int nnzU = ptrU[n];
+    std::vector<rocblas_int> colL(nnzL), mapL(nnzL), colU(nnzU), mapU(nnzU);
+    std::vector<rocblas_int> nextL(ptrL.begin(), ptrL.end() - 1);
+    std::vector<rocblas_int> nextU(ptrU.begin(), ptrU.end() - 1);
+    for(rocblas_int i = 0; i < n; ++i)
+    {
+        for(rocblas_int k = hptrT[i]; k < hptrT[i + 1]; ++k)
+        {
+            rocblas_int c = hindT[k];
+            if(c < i)
+            {
+                colL[nextL[i]] = c;
+                mapL[nextL[i]++] = k;
+                if(!lu)
+                {
+                    colU[nextU[c]] = i;
+                    mapU[nextU[c]++] = k;
+                }
+            }
+            else if(c > i && lu)
+            {
+                colU[nextU[i]] = c;
+                mapU[nextU[i]++] = k;
+            }
+        }
+    }
+
+    // compute the levels and sort the rows by level
+    // (the rows of L depend on previous rows, and the rows of U on the following ones)
+    auto sort_by_level = [n](const bool lower, const std::vector<rocblas_int>& ptr,
+                             const std::vector<rocblas_int>& col, std::vector<rocblas_int>& ord,
+                             rocblas_int& nlev) {
+        std::vector<rocblas_int> level(n);
+        nlev = 0;
+        for(rocblas_int ii = 0; ii < n; ++ii)
+        {
+            rocblas_int i = lower ? ii : n - 1 - ii;
+            rocblas_int l = 0;
+            for(rocblas_int k = ptr[i]; k < ptr[i + 1]; ++k)
+                l = std::max(l, level[col[k]] + 1);
+            level[i] = l;
+            nlev = std::max(nlev, l + 1);
+        }
+
+        std::vector<rocblas_int> start(nlev + 1, 0);
+        for(rocblas_int i = 0; i < n; ++i)
+            start[level[i] + 1]++;
+        for(rocblas_int l = 0; l < nlev; ++l)
+            start[l + 1] += start[l];
+        ord.resize(n);
+        for(rocblas_int i = 0; i < n; ++i)
+            ord[start[level[i]]++] = i;
+    };
+    std::vector<rocblas_int> ordL, ordU;
+    sort_by_level(true, ptrL, colL, ordL, rfinfo->nlevL);
+    sort_by_level(false, ptrU, colU, ordU, rfinfo->nlevU);
+
+    // pack all the arrays and copy them to the device
+    const size_t size = sizeof(rocblas_int) * (2 * (n + 1) + 2 * (nnzL + nnzU) + 4 * n);
+    if(size > rfinfo->lvl_size)
+    {
+        if(rfinfo->lvl_data)
+            HIP_CHECK(hipFree(rfinfo->lvl_data));
+        rfinfo->lvl_data = nullptr;
+        rfinfo->lvl_size = 0;
+        HIP_CHECK(hipMalloc(&rfinfo->lvl_data, size));
+        rfinfo->lvl_size = size;
+    }
+
+    std::vector<rocblas_int> packed;
+    packed.reserve(size / sizeof(rocblas_int));
+    auto pack = [&](const std::vector<rocblas_int>& v) {
+        rocblas_int* d = rfinfo->lvl_data + packed.size();
+        packed.insert(packed.end(), v.begin(), v.end());
+        return d;
+    };
+    rfinfo->ptrL = pack(ptrL);
+    rfinfo->colL = pack(colL);
+    rfinfo->mapL = pack(mapL);
+    rfinfo->diagL = pack(diagL);
+    rfinfo->ordL = pack(ordL);
+    rfinfo->ptrU = pack(ptrU);
+    rfinfo->colU = pack(colU);
+    rfinfo->mapU = pack(mapU);
+    rfinfo->diagU = pack(diagU);
+    rfinfo->ordU = pack(ordU);
+
+    HIP_CHECK(hipMemcpyAsync(rfinfo->lvl_data, packed.data(), sizeof(rocblas_int) * packed.size(),
+                             hipMemcpyHostToDevice, stream));
+    rocsolver_stats_host_sync();
+    HIP_CHECK(hipStreamSynchronize(stream));
+
+    return rocblas_status_success;
+}
+
+/** RF_BUILD_SUPERNODES detects, on the host, the supernodes of the LU factorization with the
+    sparsity pattern of T (hptrT, hindT), and copies their position maps to the device buffer
+    owned by rfinfo. Column j + 1 joins the supernode of column j when the strictly lower part of
+    column j is {j + 1} plus the strictly lower part of column j + 1, and the strictly upper part
+    of row j is {j + 1} plus the strictly upper part of row j + 1 (fundamental supernodes).
+    Supernodes with more than RF_SUPERNODE_MAX_WIDTH columns are split. **/
+inline rocblas_status rf_build_supernodes(hipStream_t stream,
+                                          rocsolver_rfinfo rfinfo,
+                                          const rocblas_int n,
+                                          const std::vector<rocblas_int>& hptrT,
+                                          const std::vector<rocblas_int>& hindT)
+{
+    // rows of the strictly lower part of every column (in increasing order), and start of the
+    // strictly upper part of every row
+    std::vector<rocblas_int> ptrC(n + 1, 0), startU(n);
+    for(rocblas_int i = 0; i < n; ++i)
+    {
+        for(rocblas_int k = hptrT[i]; k < hptrT[i + 1]; ++k)
+            if(hindT[k] < i)
+                ptrC[hindT[k] + 1]++;
+        startU[i] = std::upper_bound(hindT.begin() + hptrT[i], hindT.begin() + hptrT[i + 1], i)
+            - hindT.begin();
+    }
+    for(rocblas_int i = 0; i < n; ++i)
+        ptrC[i + 1] += ptrC[i];
+    std::vector<rocblas_int> rowC(ptrC[n]);
+    std::vector<rocblas_int> nextC(ptrC.begin(), ptrC.end() - 1);
+    for(rocblas_int i = 0; i < n; ++i)
+        for(rocblas_int k = hptrT[i]; k < hptrT[i + 1]; ++k)
+            if(hindT[k] < i)
+                rowC[nextC[hindT[k]]++] = i;
+
+    // position in valT of entry (i, j), or -1 if it is not in the sparsity pattern
+    auto find = [&](const rocblas_int i, const rocblas_int j) -> rocblas_int {
+        auto first = hindT.begin() + hptrT[i];
+        auto last = hindT.begin() + hptrT[i + 1];
+        auto it = std::lower_bound(first, last, j);
+        return (it != last && *it == j) ? rocblas_int(it - hindT.begin()) : -1;
+    };
+
+    // true if column j + 1 can join the supernode of column j
+    auto chained = [&](const rocblas_int j) {
+        rocblas_int nl = ptrC[j + 1] - ptrC[j];
+        if(nl != ptrC[j + 2] - ptrC[j + 1] + 1 || rowC[ptrC[j]] != j + 1
+           || !std::equal(rowC.begin() + ptrC[j] + 1, rowC.begin() + ptrC[j + 1],
+                          rowC.begin() + ptrC[j + 1]))
+            return false;
+        rocblas_int nu = hptrT[j + 1] - startU[j];
+        return nu == hptrT[j + 2] - startU[j + 1] + 1 && hindT[startU[j]] == j + 1
+            && std::equal(hindT.begin() + startU[j] + 1, hindT.begin() + hptrT[j + 1],
+                          hindT.begin() + startU[j + 1]);
+    };
+
+    // detect the supernodes and build their position maps
+    // (for every supernode, the maps of [D U], L and L * U are contiguous)
+    std::vector<rocblas_int> maps;
+    std::vector<size_t> offsets;
+    rfinfo->supernodes.clear();
+    rfinfo->sn_max_width = rfinfo->sn_max_nrows = rfinfo->sn_max_ncols = 0;
+    rfinfo->sn_max_panel = 0;
+    for(rocblas_int f = 0; f < n;)
+    {
+        rocblas_int l = f + 1;
+        while(l < n && l - f < RF_SUPERNODE_MAX_WIDTH && chained(l - 1))
+            l++;
+
+        // the rows of L and the columns of U outside of the diagonal block are those of the
+        // last column of the supernode
+        rocsolver_rfinfo_supernode sn;
+        sn.first = f;
+        sn.width = l - f;
+        sn.nrows = ptrC[l] - ptrC[l - 1];
+        sn.ncols = hptrT[l] - startU[l - 1];
+        const rocblas_int* R = rowC.data() + ptrC[l - 1];
+        const rocblas_int* C = hindT.data() + startU[l - 1];
+
+        offsets.push_back(maps.size());
+        for(rocblas_int j = 0; j < sn.width + sn.ncols; ++j)
+            for(rocblas_int i = 0; i < sn.width; ++i)
+                maps.push_back(find(f + i, j < sn.width ? f + j : C[j - sn.width]));
+        for(rocblas_int j = 0; j < sn.width; ++j)
+            for(rocblas_int i = 0; i < sn.nrows; ++i)
+                maps.push_back(find(R[i], f + j));
+        for(rocblas_int j = 0; j < sn.ncols; ++j)
+            for(rocblas_int i = 0; i < sn.nrows; ++i)
+                maps.push_back(find(R[i], C[j]));
+
+        rfinfo->supernodes.push_back(sn);
+        rfinfo->sn_max_width = std::max(rfinfo->sn_max_width, sn.width);
+        rfinfo->sn_max_nrows = std::max(rfinfo->sn_max_nrows, sn.nrows);
+        rfinfo->sn_max_ncols = std::max(rfinfo->sn_max_ncols, sn.ncols);
+        rfinfo->sn_max_panel = std::max(rfinfo->sn_max_panel, maps.size() - offsets.back());
+        f = l;
+    }
+
+    // copy the maps to the device
+    const size_t size = sizeof(rocblas_int) * maps.size();
+    if(size > rfinfo->sn_size)
+    {
+        if(rfinfo->sn_data)
+            HIP_CHECK(hipFree(rfinfo->sn_data));
+        rfinfo->sn_data = nullptr;
+        rfinfo->sn_size = 0;
+        HIP_CHECK(hipMalloc(&rfinfo->sn_data, size));
+        rfinfo->sn_size = size;
+    }
+
+    for(size_t s = 0; s < rfinfo->supernodes.size(); ++s)
+    {
+        rocsolver_rfinfo_supernode& sn = rfinfo->supernodes[s];
+        sn.mapD = rfinfo->sn_data + offsets[s];
+        sn.mapL = sn.mapD + sn.width * (sn.width + sn.ncols);
+        sn.mapG = sn.mapL + sn.nrows * sn.width;
+    }
+
+    HIP_CHECK(hipMemcpyAsync(rfinfo->sn_data, maps.data(), size, hipMemcpyHostToDevice, stream));
+    rocsolver_stats_host_sync();
+    HIP_CHECK(hipStreamSynchronize(stream));
+
+    return rocblas_status_success;
+}
+
+/** RF_BUILD_FRONTS detects, on the host, the supernodes of the Cholesky factorization with the
+    sparsity pattern of the lower triangular part of T (hptrT, hindT), groups them into fronts,
+    and copies the position maps of the fronts to the device buffer owned by rfinfo. Column j + 1
+    joins the supernode of column j when the strictly lower part of column j is {j + 1} plus the
+    strictly lower part of column j + 1. The level of a supernode is one more than the largest
+    level of the supernodes that update it, so that the supernodes of the same level can be
+    factorized at the same time. Within a level, the supernodes are grouped by their width and
+    number of rows, both rounded up to a power of two. **/
+inline rocblas_status rf_build_fronts(hipStream_t stream,
+                                      rocsolver_rfinfo rfinfo,
+                                      const rocblas_int n,
+                                      const std::vector<rocblas_int>& hptrT,
+                                      const std::vector<rocblas_int>& hindT)
+{
+    // rows of the strictly lower part of every column (in increasing order)
+    std::vector<rocblas_int> ptrC(n + 1, 0);
+    for(rocblas_int i = 0; i < n; ++i)
+        for(rocblas_int k = hptrT[i]; k < hptrT[i + 1]; ++k)
+            if(hindT[k] < i)
+                ptrC[hindT[k] + 1]++;
+    for(rocblas_int i = 0; i < n; ++i)
+        ptrC[i + 1] += ptrC[i];
+    std::vector<rocblas_int> rowC(ptrC[n]);
+    std::vector<rocblas_int> nextC(ptrC.begin(), ptrC.end() - 1);
+    for(rocblas_int i = 0; i < n; ++i)
+        for(rocblas_int k = hptrT[i]; k < hptrT[i + 1]; ++k)
+            if(hindT[k] < i)
+                rowC[nextC[hindT[k]]++] = i;
+
+    // position in valT of entry (i, j) of the lower triangular part, or -1 if it is not in the
+    // sparsity pattern
+    auto find = [&](const rocblas_int i, const rocblas_int j) -> rocblas_int {
+        if(i < j)
+            return -1;
+        auto first = hindT.begin() + hptrT[i];
+        auto last = hindT.begin() + hptrT[i + 1];
+        auto it = std::lower_bound(first, last, j);
+        return (it != last && *it == j) ? rocblas_int(it - hindT.begin()) : -1;
+    };
+
+    // true if column j + 1 can join the supernode of column j
+    auto chained = [&](const rocblas_int j) {
+        rocblas_int nl = ptrC[j + 1] - ptrC[j];
+        return nl == ptrC[j + 2] - ptrC[j + 1] + 1 && rowC[ptrC[j]] == j + 1
+            && std::equal(rowC.begin() + ptrC[j] + 1, rowC.begin() + ptrC[j + 1],
+                          rowC.begin() + ptrC[j + 1]);
+    };
+
+    // size of a padded block
+    auto padded = [](const rocblas_int m) {
+        rocblas_int p = 1;
+        while(p < m)
+            p *= 2;
+        return (m == 0 ? 0 : p);
+    };
+
+    // detect the supernodes and their levels
+    // (a supernode updates the columns given by the rows of its block L)
+    std::vector<rocsolver_rfinfo_supernode> sns;
+    std::vector<rocblas_int> sn_of(n), level;
+    for(rocblas_int f = 0; f < n;)
+    {
+        rocblas_int l = f + 1;
+        while(l < n && l - f < RF_SUPERNODE_MAX_WIDTH && chained(l - 1))
+            l++;
+
+        rocsolver_rfinfo_supernode sn = {};
+        sn.first = f;
+        sn.width = l - f;
+        sn.nrows = ptrC[l] - ptrC[l - 1];
+        sns.push_back(sn);
+        level.push_back(0);
+        for(rocblas_int j = f; j < l; ++j)
+            sn_of[j] = sns.size() - 1;
+        f = l;
+    }
+    for(size_t s = 0; s < sns.size(); ++s)
+    {
+        rocblas_int l = sns[s].first + sns[s].width;
+        for(rocblas_int k = ptrC[l - 1]; k < ptrC[l]; ++k)
+        {
+            rocblas_int t = sn_of[rowC[k]];
+            level[t] = std::max(level[t], level[s] + 1);
+        }
+    }
+
+    // group the supernodes by level and padded size
+    std::vector<size_t> order(sns.size());
+    for(size_t s = 0; s < sns.size(); ++s)
+        order[s] = s;
+    auto key = [&](const size_t s) {
+        return std::make_tuple(level[s], padded(sns[s].width), padded(sns[s].nrows));
+    };
+    std::stable_sort(order.begin(), order.end(),
+                     [&](const size_t a, const size_t b) { return key(a) < key(b); });
+
+    // build the position maps of the fronts
+    // (for every group, the maps of all its fronts are contiguous)
+    std::vector<rocblas_int> maps;
+    std::vector<size_t> offsets;
+    rfinfo->supernodes.clear();
+    rfinfo->fronts.clear();
+    rfinfo->sn_max_width = rfinfo->sn_max_nrows = rfinfo->sn_max_ncols = 0;
+    rfinfo->sn_max_panel = 0;
+    for(size_t g = 0; g < order.size();)
+    {
+        rocsolver_rfinfo_front_group grp;
+        grp.width = padded(sns[order[g]].width);
+        grp.nrows = padded(sns[order[g]].nrows);
+        grp.nfronts = 0;
+        offsets.push_back(maps.size());
+
+        rocblas_int W = grp.width;
+        rocblas_int NR = grp.nrows;
+        const auto grp_key = key(order[g]);
+        for(; g < order.size() && key(order[g]) == grp_key; ++g)
+        {
+            const rocsolver_rfinfo_supernode& sn = sns[order[g]];
+            rocblas_int f = sn.first;
+            rocblas_int l = f + sn.width;
+            const rocblas_int* R = rowC.data() + ptrC[l - 1];
+            for(rocblas_int j = 0; j < W; ++j)
+                for(rocblas_int i = 0; i < W; ++i)
+                    maps.push_back(i < sn.width && j < sn.width ? find(f + i, f + j)
+                                                                : (i == j ? -2 : -1));
+            for(rocblas_int j = 0; j < W; ++j)
+                for(rocblas_int i = 0; i < NR; ++i)
+                    maps.push_back(i < sn.nrows && j < sn.width ? find(R[i], f + j) : -1);
+            for(rocblas_int j = 0; j < NR; ++j)
+                for(rocblas_int i = 0; i < NR; ++i)
+                    maps.push_back(i < sn.nrows && j < sn.nrows ? find(R[i], R[j]) : -1);
+            grp.nfronts++;
+        }
+
+        rfinfo->fronts.push_back(grp);
+        rfinfo->sn_max_width = std::max(rfinfo->sn_max_width, W);
+        rfinfo->sn_max_nrows = std::max(rfinfo->sn_max_nrows, NR);
+        rfinfo->sn_max_panel = std::max(rfinfo->sn_max_panel, maps.size() - offsets.back());
+    }
+
+    // copy the maps to the device
+    const size_t size = sizeof(rocblas_int) * maps.size();
+    if(size > rfinfo->sn_size)
+    {
+        if(rfinfo->sn_data)
+            HIP_CHECK(hipFree(rfinfo->sn_data));
+        rfinfo->sn_data = nullptr;
+        rfinfo->sn_size = 0;
+        HIP_CHECK(hipMalloc(&rfinfo->sn_data, size));
+        rfinfo->sn_size = size;
+    }
+
+    for(size_t g = 0; g < rfinfo->fronts.size(); ++g)
+        rfinfo->fronts[g].map = rfinfo->sn_data + offsets[g];
+
+    HIP_CHECK(hipMemcpyAsync(rfinfo->sn_data, maps.data(), size, hipMemcpyHostToDevice, stream));
+    rocsolver_stats_host_sync();
+    HIP_CHECK(hipStreamSynchronize(stream));
+
+    return rocblas_status_success;
+}
+
 template <typename T>
 rocblas_status rocsolver_csrrf_analysis_argCheck(rocblas_handle handle,
                                                  const rocblas_int n,
@@ -72,6 +502,17 @@ rocblas_status rocsolver_csrrf_analysis_argCheck(rocblas_handle handle,
     if(n && ((rfinfo->mode == rocsolver_rfinfo_mode_lu && !pivP) || !pivQ))
         return rocblas_status_invalid_pointer;
 
+    // 4. non-supported combination of modes
+    // (the mixed-precision mode needs the re-factorization and solves computed by rocSOLVER)
+    if(rfinfo->precision_mode == rocsolver_rfinfo_precision_mode_mixed
+       && (rfinfo->mode != rocsolver_rfinfo_mode_lu
+           || rfinfo->refact_mode != rocsolver_rfinfo_refact_mode_supernodal
+           || rfinfo->solve_mode != rocsolver_rfinfo_solve_mode_levels))
+        return rocblas_status_invalid_value;
+    // (the QR factorization has its own analysis, csrrf_analysisqr)
+    if(rfinfo->mode == rocsolver_rfinfo_mode_qr)
+        return rocblas_status_invalid_value;
+
     return rocblas_status_continue;
 }
 
@@ -103,10 +544,11 @@ void rocsolver_csrrf_analysis_getMemorySize(const rocblas_int n,
         size_t csrsm_L_buffer_size = 0;
         size_t csrsm_U_buffer_size = 0;
 
-        rocsparseCall_csrilu0_buffer_size(rfinfo->sphandle, n, nnzT, rfinfo->descrT, valT, ptrT,
-                                          indT, rfinfo->infoT, &csrilu0_buffer_size);
+        if(rfinfo->refact_mode == rocsolver_rfinfo_refact_mode_rocsparse)
+            rocsparseCall_csrilu0_buffer_size(rfinfo->sphandle, n, nnzT, rfinfo->descrT, valT,
+                                              ptrT, indT, rfinfo->infoT, &csrilu0_buffer_size);
 
-        if(nrhs > 0)
+        if(nrhs > 0 && rfinfo->solve_mode == rocsolver_rfinfo_solve_mode_rocsparse)
         {
             T alpha = 1.0;
 
@@ -133,10 +575,11 @@ void rocsolver_csrrf_analysis_getMemorySize(const rocblas_int n,
         size_t csrsm_L_buffer_size = 0;
         size_t csrsm_Lt_buffer_size = 0;
 
-        rocsparseCall_csric0_buffer_size(rfinfo->sphandle, n, nnzT, rfinfo->descrT, valT, ptrT,
-                                         indT, rfinfo->infoT, &csric0_buffer_size);
+        if(rfinfo->refact_mode == rocsolver_rfinfo_refact_mode_rocsparse)
+            rocsparseCall_csric0_buffer_size(rfinfo->sphandle, n, nnzT, rfinfo->descrT, valT,
+                                             ptrT, indT, rfinfo->infoT, &csric0_buffer_size);
 
-        if(nrhs > 0)
+        if(nrhs > 0 && rfinfo->solve_mode == rocsolver_rfinfo_solve_mode_rocsparse)
         {
             T alpha = 1.0;
 
@@ -185,7 +628,44 @@ rocblas_status rocsolver_csrrf_analysis_template(rocblas_handle handle,
     if(n == 0)
         return rocblas_status_success;
 
-    if(rfinfo->mode == rocsolver_rfinfo_mode_lu)
+    hipStream_t stream;
+    ROCBLAS_CHECK(rocblas_get_stream(handle, &stream));
+
+    // bind the sparse handle to the stream of the calling handle
+    // (rfinfo may have been created with a different handle or stream)
+    ROCSPARSE_CHECK(rocsparse_set_stream(rfinfo->sphandle, stream));
+
+    const bool supernodal = (rfinfo->refact_mode == rocsolver_rfinfo_refact_mode_supernodal);
+    const bool levels = (rfinfo->solve_mode == rocsolver_rfinfo_solve_mode_levels);
+
+    // the analysis done by rocSOLVER works on a host copy of the sparsity pattern of T
+    // (the hash of the pattern identifies the analysis when it is exported)
+    std::vector<rocblas_int> hptrT, hindT;
+    if(supernodal || levels)
+    {
+        hptrT.resize(n + 1);
+        hindT.resize(nnzT);
+        HIP_CHECK(hipMemcpyAsync(hptrT.data(), ptrT, sizeof(rocblas_int) * (n + 1),
+                                 hipMemcpyDeviceToHost, stream));
+        if(nnzT > 0)
+            HIP_CHECK(hipMemcpyAsync(hindT.data(), indT, sizeof(rocblas_int) * nnzT,
+                                     hipMemcpyDeviceToHost, stream));
+        rocsolver_stats_host_sync();
+        HIP_CHECK(hipStreamSynchronize(stream));
+        rfinfo->pattern_hash = rf_pattern_hash(n, nnzT, hptrT.data(), hindT.data());
+    }
+
+    if(supernodal && rfinfo->mode == rocsolver_rfinfo_mode_lu)
+    {
+        // supernodes for the supernodal LU re-factorization
+        ROCBLAS_CHECK(rf_build_supernodes(stream, rfinfo, n, hptrT, hindT));
+    }
+    else if(supernodal)
+    {
+        // fronts for the supernodal Cholesky re-factorization
+        ROCBLAS_CHECK(rf_build_fronts(stream, rfinfo, n, hptrT, hindT));
+    }
+    else if(rfinfo->mode == rocsolver_rfinfo_mode_lu)
     {
         // analysis for incomplete LU factorization
         ROCSPARSE_CHECK(rocsparseCall_csrilu0_analysis(
@@ -200,7 +680,12 @@ rocblas_status rocsolver_csrrf_analysis_template(rocblas_handle handle,
             rocsparse_analysis_policy_force, rfinfo->solve_policy, work));
     };
 
-    if(nrhs > 0)
+    if(levels)
+    {
+        // level sets for the triangular solves
+        ROCBLAS_CHECK(rf_build_levels(stream, rfinfo, n, hptrT, hindT));
+    }
+    else if(nrhs > 0)
     {
         T alpha = 1.0;
 
@@ -235,7 +720,12 @@ rocblas_status rocsolver_csrrf_analysis_template(rocblas_handle handle,
     }
 
     rfinfo->analyzed = true;
+    rfinfo->analyzed_n = n;
+    rfinfo->analyzed_nnzT = nnzT;
     rfinfo->analyzed_mode = rfinfo->mode;
+    rfinfo->analyzed_solve_mode = rfinfo->solve_mode;
+    rfinfo->analyzed_refact_mode = rfinfo->refact_mode;
+    rfinfo->low_bc = 0;
 
     return rocblas_status_success;
 }
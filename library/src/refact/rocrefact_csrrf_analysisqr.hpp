@@ -0,0 +1,331 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "rocrefact_csrrf_analysis.hpp"
+#include "rocsolver/rocsolver.h"
+#include "rocsolver_rfinfo.hpp"
+#include "rocsparse.hpp"
+
+#include <algorithm>
+#include <vector>
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/** RF_BUILD_QR computes, on the host, the structures used by the Givens re-factorization of
+    csrrf_refactqr, and copies them to the device buffer owned by rfinfo. The rows of R = L' are
+    the columns of the lower triangular part L of T (hptrT, hindT), and the parent of column k
+    in the column elimination tree is the first off-diagonal column of row k of R.
+    When a row of A(:, Q) is rotated into R, its non-zero elements must lie in the row of R
+    given by its first column, and every row of R (without its diagonal) must lie in the row of
+    its parent; otherwise, the sparsity pattern of T cannot hold the factor R, and
+    rocblas_status_invalid_value is returned. **/
+inline rocblas_status rf_build_qr(hipStream_t stream,
+                                  rocsolver_rfinfo rfinfo,
+                                  const rocblas_int m,
+                                  const rocblas_int n,
+                                  const std::vector<rocblas_int>& hptrM,
+                                  const std::vector<rocblas_int>& hindM,
+                                  const std::vector<rocblas_int>& hptrT,
+                                  const std::vector<rocblas_int>& hindT,
+                                  const std::vector<rocblas_int>& hpivQ)
+{
+    // rows of R, with the positions in valT of their entries (in increasing column order)
+    std::vector<rocblas_int> ptrR(n + 1, 0);
+    for(rocblas_int i = 0; i < n; ++i)
+        for(rocblas_int k = hptrT[i]; k < hptrT[i + 1]; ++k)
+            if(hindT[k] <= i)
+                ptrR[hindT[k] + 1]++;
+    for(rocblas_int i = 0; i < n; ++i)
+        ptrR[i + 1] += ptrR[i];
+    std::vector<rocblas_int> colR(ptrR[n]), posR(ptrR[n]);
+    std::vector<rocblas_int> nextR(ptrR.begin(), ptrR.end() - 1);
+    for(rocblas_int i = 0; i < n; ++i)
+        for(rocblas_int k = hptrT[i]; k < hptrT[i + 1]; ++k)
+            if(hindT[k] <= i)
+            {
+                colR[nextR[hindT[k]]] = i;
+                posR[nextR[hindT[k]]++] = k;
+            }
+
+    // the diagonal comes first in every row of R, followed by the parent
+    std::vector<rocblas_int> parent(n, -1);
+    for(rocblas_int k = 0; k < n; ++k)
+    {
+        if(ptrR[k] == ptrR[k + 1] || colR[ptrR[k]] != k)
+            return rocblas_status_invalid_value;
+        if(ptrR[k + 1] - ptrR[k] > 1)
+            parent[k] = colR[ptrR[k] + 1];
+    }
+
+    // the fill-in of the rotations must be in the sparsity pattern
+    auto rowR = [&](const rocblas_int k) {
+        return std::make_pair(colR.begin() + ptrR[k], colR.begin() + ptrR[k + 1]);
+    };
+    for(rocblas_int k = 0; k < n; ++k)
+    {
+        if(parent[k] < 0)
+            continue;
+        auto rk = rowR(k);
+        auto rp = rowR(parent[k]);
+        if(!std::includes(rp.first, rp.second, rk.first + 1, rk.second))
+            return rocblas_status_invalid_value;
+    }
+
+    std::vector<rocblas_int> invQ(n);
+    for(rocblas_int k = 0; k < n; ++k)
+        invQ[hpivQ[k]] = k;
+    std::vector<rocblas_int> cols;
+    for(rocblas_int i = 0; i < m; ++i)
+    {
+        cols.clear();
+        for(rocblas_int k = hptrM[i]; k < hptrM[i + 1]; ++k)
+            cols.push_back(invQ[hindM[k]]);
+        if(cols.empty())
+            continue;
+        std::sort(cols.begin(), cols.end());
+        auto rk = rowR(cols[0]);
+        if(!std::includes(rk.first, rk.second, cols.begin(), cols.end()))
+            return rocblas_status_invalid_value;
+    }
+
+    // copy the structures to the device
+    // (ptrR, colR, posR, parentR and invQ are contiguous)
+    const size_t nnzR = ptrR[n];
+    const size_t size = sizeof(rocblas_int) * (3 * size_t(n) + 1 + 2 * nnzR);
+    if(size > rfinfo->qr_size)
+    {
+        if(rfinfo->qr_data)
+            HIP_CHECK(hipFree(rfinfo->qr_data));
+        rfinfo->qr_data = nullptr;
+        rfinfo->qr_size = 0;
+        HIP_CHECK(hipMalloc(&rfinfo->qr_data, size));
+        rfinfo->qr_size = size;
+    }
+    rfinfo->ptrR = rfinfo->qr_data;
+    rfinfo->colR = rfinfo->ptrR + (n + 1);
+    rfinfo->posR = rfinfo->colR + nnzR;
+    rfinfo->parentR = rfinfo->posR + nnzR;
+    rfinfo->invQ = rfinfo->parentR + n;
+
+    HIP_CHECK(hipMemcpyAsync(rfinfo->ptrR, ptrR.data(), sizeof(rocblas_int) * (n + 1),
+                             hipMemcpyHostToDevice, stream));
+    if(nnzR > 0)
+    {
+        HIP_CHECK(hipMemcpyAsync(rfinfo->colR, colR.data(), sizeof(rocblas_int) * nnzR,
+                                 hipMemcpyHostToDevice, stream));
+        HIP_CHECK(hipMemcpyAsync(rfinfo->posR, posR.data(), sizeof(rocblas_int) * nnzR,
+                                 hipMemcpyHostToDevice, stream));
+    }
+    HIP_CHECK(hipMemcpyAsync(rfinfo->parentR, parent.data(), sizeof(rocblas_int) * n,
+                             hipMemcpyHostToDevice, stream));
+    HIP_CHECK(hipMemcpyAsync(rfinfo->invQ, invQ.data(), sizeof(rocblas_int) * n,
+                             hipMemcpyHostToDevice, stream));
+    rocsolver_stats_host_sync();
+    HIP_CHECK(hipStreamSynchronize(stream));
+
+    return rocblas_status_success;
+}
+
+template <typename T>
+rocblas_status rocsolver_csrrf_analysisqr_argCheck(rocblas_handle handle,
+                                                   const rocblas_int m,
+                                                   const rocblas_int n,
+                                                   const rocblas_int nrhs,
+                                                   const rocblas_int nnzM,
+                                                   rocblas_int* ptrM,
+                                                   rocblas_int* indM,
+                                                   const rocblas_int nnzT,
+                                                   rocblas_int* ptrT,
+                                                   rocblas_int* indT,
+                                                   T valT,
+                                                   rocblas_int* pivQ,
+                                                   T B,
+                                                   const rocblas_int ldb,
+                                                   rocsolver_rfinfo rfinfo)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    if(n < 0 || m < n || nnzM < 0 || nnzT < 0 || nrhs < 0 || ldb < m)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if(!rfinfo || !ptrM || !ptrT || (nnzM && !indM) || (nnzT && (!indT || !valT))
+       || (n && (!pivQ || (nrhs && !B))))
+        return rocblas_status_invalid_pointer;
+
+    // 4. non-supported combination of modes
+    // (R is always computed by rocSOLVER in the precision of the matrices)
+    if(rfinfo->mode != rocsolver_rfinfo_mode_qr
+       || rfinfo->precision_mode == rocsolver_rfinfo_precision_mode_mixed)
+        return rocblas_status_invalid_value;
+
+    return rocblas_status_continue;
+}
+
+template <typename T, typename U>
+void rocsolver_csrrf_analysisqr_getMemorySize(const rocblas_int n,
+                                              const rocblas_int nrhs,
+                                              const rocblas_int nnzT,
+                                              rocblas_int* ptrT,
+                                              rocblas_int* indT,
+                                              U valT,
+                                              U B,
+                                              const rocblas_int ldb,
+                                              rocsolver_rfinfo rfinfo,
+                                              size_t* size_work)
+{
+    *size_work = 0;
+
+    // if quick return, no need of workspace
+    if(n == 0)
+        return;
+
+    // requirements for the solves with R' and R, as in the Cholesky mode
+    if(nrhs > 0 && rfinfo->solve_mode == rocsolver_rfinfo_solve_mode_rocsparse)
+    {
+        T alpha = 1.0;
+        size_t csrsm_L_buffer_size = 0;
+        size_t csrsm_Lt_buffer_size = 0;
+
+        rocsparseCall_csrsm_buffer_size(rfinfo->sphandle, rocsparse_operation_none,
+                                        rocsparse_operation_none, n, nrhs, nnzT, &alpha,
+                                        rfinfo->descrL, valT, ptrT, indT, B, ldb, rfinfo->infoL,
+                                        rfinfo->solve_policy, &csrsm_L_buffer_size);
+
+        rocsparseCall_csrsm_buffer_size(rfinfo->sphandle, rocsparse_operation_conjugate_transpose,
+                                        rocsparse_operation_none, n, nrhs, nnzT, &alpha,
+                                        rfinfo->descrL, valT, ptrT, indT, B, ldb, rfinfo->infoU,
+                                        rfinfo->solve_policy, &csrsm_Lt_buffer_size);
+
+        *size_work = std::max(csrsm_L_buffer_size, csrsm_Lt_buffer_size);
+    }
+}
+
+template <typename T, typename U>
+rocblas_status rocsolver_csrrf_analysisqr_template(rocblas_handle handle,
+                                                   const rocblas_int m,
+                                                   const rocblas_int n,
+                                                   const rocblas_int nrhs,
+                                                   const rocblas_int nnzM,
+                                                   rocblas_int* ptrM,
+                                                   rocblas_int* indM,
+                                                   const rocblas_int nnzT,
+                                                   rocblas_int* ptrT,
+                                                   rocblas_int* indT,
+                                                   U valT,
+                                                   rocblas_int* pivQ,
+                                                   U B,
+                                                   const rocblas_int ldb,
+                                                   rocsolver_rfinfo rfinfo,
+                                                   void* work)
+{
+    ROCSOLVER_ENTER("csrrf_analysisqr", "m:", m, "n:", n, "nnzM:", nnzM, "nnzT:", nnzT,
+                    "nrhs:", nrhs, "ldb:", ldb);
+
+    rfinfo->analyzed = false;
+
+    // quick return
+    if(n == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    ROCBLAS_CHECK(rocblas_get_stream(handle, &stream));
+
+    // bind the sparse handle to the stream of the calling handle
+    // (rfinfo may have been created with a different handle or stream)
+    ROCSPARSE_CHECK(rocsparse_set_stream(rfinfo->sphandle, stream));
+
+    const bool levels = (rfinfo->solve_mode == rocsolver_rfinfo_solve_mode_levels);
+
+    // the analysis works on host copies of the sparsity patterns of A and T
+    std::vector<rocblas_int> hptrM(m + 1), hindM(nnzM), hptrT(n + 1), hindT(nnzT), hpivQ(n);
+    HIP_CHECK(hipMemcpyAsync(hptrM.data(), ptrM, sizeof(rocblas_int) * (m + 1),
+                             hipMemcpyDeviceToHost, stream));
+    if(nnzM > 0)
+        HIP_CHECK(hipMemcpyAsync(hindM.data(), indM, sizeof(rocblas_int) * nnzM,
+                                 hipMemcpyDeviceToHost, stream));
+    HIP_CHECK(hipMemcpyAsync(hptrT.data(), ptrT, sizeof(rocblas_int) * (n + 1),
+                             hipMemcpyDeviceToHost, stream));
+    if(nnzT > 0)
+        HIP_CHECK(hipMemcpyAsync(hindT.data(), indT, sizeof(rocblas_int) * nnzT,
+                                 hipMemcpyDeviceToHost, stream));
+    HIP_CHECK(hipMemcpyAsync(hpivQ.data(), pivQ, sizeof(rocblas_int) * n, hipMemcpyDeviceToHost,
+                             stream));
+    rocsolver_stats_host_sync();
+    HIP_CHECK(hipStreamSynchronize(stream));
+    rfinfo->pattern_hash = rf_pattern_hash(n, nnzT, hptrT.data(), hindT.data());
+
+    // column elimination tree and position maps for the Givens rotations
+    ROCBLAS_CHECK(rf_build_qr(stream, rfinfo, m, n, hptrM, hindM, hptrT, hindT, hpivQ));
+
+    // the least-squares solves are those of the Cholesky mode with the factor L = R'
+    if(levels)
+    {
+        // level sets for the triangular solves
+        ROCBLAS_CHECK(rf_build_levels(stream, rfinfo, n, hptrT, hindT));
+    }
+    else if(nrhs > 0)
+    {
+        T alpha = 1.0;
+
+        // analysis for solve with R'
+        ROCSPARSE_CHECK(rocsparseCall_csrsm_analysis(
+            rfinfo->sphandle, rocsparse_operation_none, rocsparse_operation_none, n, nrhs, nnzT,
+            &alpha, rfinfo->descrL, valT, ptrT, indT, B, ldb, rfinfo->infoL,
+            rfinfo->analysis_policy, rfinfo->solve_policy, work));
+
+        // analysis for solve with R
+        ROCSPARSE_CHECK(rocsparseCall_csrsm_analysis(
+            rfinfo->sphandle, rocsparse_operation_conjugate_transpose, rocsparse_operation_none, n,
+            nrhs, nnzT, &alpha, rfinfo->descrL, valT, ptrT, indT, B, ldb, rfinfo->infoU,
+            rfinfo->analysis_policy, rfinfo->solve_policy, work));
+    }
+
+    rfinfo->analyzed = true;
+    rfinfo->analyzed_m = m;
+    rfinfo->analyzed_n = n;
+    rfinfo->analyzed_nnzT = nnzT;
+    rfinfo->analyzed_mode = rfinfo->mode;
+    rfinfo->analyzed_solve_mode = rfinfo->solve_mode;
+    rfinfo->analyzed_refact_mode = rfinfo->refact_mode;
+    rfinfo->low_bc = 0;
+
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
@@ -60,31 +60,60 @@ rocblas_status rocsolver_csrrf_refactchol_impl(rocblas_handle handle,
     if(st != rocblas_status_continue)
         return st;
 
-    // TODO: add batched versions
     // working with unshifted arrays
     // normal (non-batched non-strided) execution
+    rocblas_stride strideA = 0;
+    rocblas_stride strideT = 0;
+    rocblas_int batch_count = 1;
 
     // memory workspace sizes:
     // size for temp buffer in refactlu calls
     size_t size_work = 0;
-
-    rocsolver_csrrf_refactchol_getMemorySize<T>(n, nnzT, ptrT, indT, valT, rfinfo, &size_work);
+    // constants in rocblas calls (only whether they are needed, see set_device_scalars)
+    size_t size_scalars;
+    // size of reusable workspace (for calling POTRF and TRSM in the supernodal factorization)
+    bool optim_mem;
+    size_t size_work1, size_work2, size_work3, size_work4;
+    // extra requirements for calling POTRF
+    size_t size_pivots, size_iinfo;
+    // size for the dense blocks of the fronts
+    size_t size_panel;
+
+    rocsolver_csrrf_refactchol_getMemorySize<T>(
+        n, nnzT, ptrT, indT, valT, rfinfo, batch_count, &size_work, &size_scalars, &size_work1,
+        &size_work2, &size_work3, &size_work4, &size_pivots, &size_iinfo, &size_panel, &optim_mem);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_work);
+        return rocblas_set_optimal_device_memory_size(handle, size_work, size_t(0), size_work1,
+                                                      size_work2, size_work3, size_work4,
+                                                      size_pivots, size_iinfo, size_panel);
 
     // memory workspace allocation
-    void* work = nullptr;
-    rocblas_device_malloc mem(handle, size_work);
+    void *work, *scalars, *work1, *work2, *work3, *work4, *pivots, *iinfo, *panel;
+    rocblas_device_malloc mem(handle, size_work, size_t(0), size_work1, size_work2, size_work3,
+                              size_work4, size_pivots, size_iinfo, size_panel);
 
     if(!mem)
         return rocblas_status_memory_error;
 
     work = mem[0];
+    scalars = mem[1];
+    work1 = mem[2];
+    work2 = mem[3];
+    work3 = mem[4];
+    work4 = mem[5];
+    pivots = mem[6];
+    iinfo = mem[7];
+    panel = mem[8];
+    if(size_scalars > 0)
+        ROCBLAS_CHECK(set_device_scalars<T>(scalars));
 
     // execution
-    return rocsolver_csrrf_refactchol_template<T, U>(handle, n, nnzA, ptrA, indA, valA, nnzT, ptrT,
-                                                     indT, valT, pivQ, rfinfo, work);
+    return rocsolver_csrrf_refactchol_template<T, U>(handle, n, nnzA, ptrA, indA, valA, strideA,
+                                                     nnzT, ptrT, indT, valT, strideT, pivQ, rfinfo,
+                                                     batch_count, work, (T*)scalars, work1,
+                                                     work2, work3, work4, (T*)pivots,
+                                                     (rocblas_int*)iinfo, (T*)panel, optim_mem);
 #else
     return rocblas_status_not_implemented;
 #endif
@@ -27,6 +27,7 @@
 
 #pragma once
 
+#include "lapack/roclapack_potrf.hpp"
 #include "rocblas.hpp"
 #include "rocsolver/rocsolver.h"
 #include "rocsolver_rfinfo.hpp"
@@ -52,13 +53,20 @@ ROCSOLVER_KERNEL void rf_add_QAQ_kernel(const rocblas_int n,
                                         const T alpha,
                                         rocblas_int* Ap,
                                         rocblas_int* Ai,
-                                        T* Ax,
+                                        T* AxA,
+                                        const rocblas_stride strideA,
                                         rocblas_int* LUp,
                                         rocblas_int* LUi,
-                                        T* LUx)
+                                        T* LUxA,
+                                        const rocblas_stride strideT)
 {
     rocblas_int tix = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
     rocblas_int tiy = hipThreadIdx_y;
+    rocblas_int bid = hipBlockIdx_y;
+
+    // all the matrices in the batch share the same sparsity pattern
+    T* Ax = AxA + bid * strideA;
+    T* LUx = LUxA + bid * strideT;
 
     // -------------------------------------------
     // If Q is NULL, then treat as identity permutation
@@ -113,6 +121,131 @@ ROCSOLVER_KERNEL void rf_add_QAQ_kernel(const rocblas_int n,
     }
 }
 
+/** RF_FRONT_GATHER_KERNEL copies the entries of the fronts of a group from valT to their dense
+    blocks. The positions in valT are given by map; the padded diagonal of D is set to one, and
+    the rest of the entries that are not in the sparsity pattern of T are set to zero. **/
+template <typename T>
+ROCSOLVER_KERNEL void rf_front_gather_kernel(const rocblas_int size,
+                                             rocblas_int* map,
+                                             T* valTA,
+                                             const rocblas_stride strideT,
+                                             T* panelA)
+{
+    rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocblas_int bid = hipBlockIdx_y;
+
+    if(i < size)
+    {
+        T* valT = valTA + bid * strideT;
+        rocblas_int p = map[i];
+        panelA[bid * size + i] = (p >= 0 ? valT[p] : (p == -2 ? T(1) : T(0)));
+    }
+}
+
+/** RF_FRONT_SCATTER_KERNEL copies the blocks D and L of the fronts of a group back to valT, and
+    subtracts their updates L * L' from valT. (The fronts of a group can update the same entries
+    of T, thus the updates are subtracted atomically.) **/
+template <typename T>
+ROCSOLVER_KERNEL void rf_front_scatter_kernel(const rocblas_int sizeP,
+                                              const rocblas_int sizeF,
+                                              const rocblas_int size,
+                                              rocblas_int* map,
+                                              T* valTA,
+                                              const rocblas_stride strideT,
+                                              T* panelA)
+{
+    rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocblas_int bid = hipBlockIdx_y;
+
+    if(i < size)
+    {
+        T* valT = valTA + bid * strideT;
+        rocblas_int p = map[i];
+        if(p >= 0)
+        {
+            if(i % sizeF < sizeP)
+                valT[p] = panelA[bid * size + i];
+            else
+                atomicAdd(valT + p, -panelA[bid * size + i]);
+        }
+    }
+}
+
+/** RF_SN_REFACTCHOL computes the supernodal Cholesky factorization of the matrices in valT
+    (which contain Q'*A*Q) in place. **/
+template <typename T>
+rocblas_status rf_sn_refactchol(rocblas_handle handle,
+                                hipStream_t stream,
+                                rocsolver_rfinfo rfinfo,
+                                T* valT,
+                                const rocblas_stride strideT,
+                                const rocblas_int batch_count,
+                                T* scalars,
+                                void* work1,
+                                void* work2,
+                                void* work3,
+                                void* work4,
+                                T* pivots,
+                                rocblas_int* iinfo,
+                                T* panel,
+                                const bool optim_mem)
+{
+    // -------------------------------------------------------------------
+    // multifrontal factorization of T: for every group of fronts (in order of level), gather
+    // the fronts of all the matrices in the batch, and compute
+    //     D <- chol(D),   L <- L * inv(D'),   G <- L * L'
+    // with a single call to batched POTRF, TRSM and SYRK. Then subtract the updates G from
+    // the columns of T that belong to the next levels.
+    // Note: as in the incomplete factorization, the entries of the update that are not
+    // in the sparsity pattern of T are dropped.
+    // -------------------------------------------------------------------
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+
+    T one = 1;
+    T zero = 0;
+
+    for(const rocsolver_rfinfo_front_group& grp : rfinfo->fronts)
+    {
+        rocblas_int w = grp.width;
+        rocblas_int nr = grp.nrows;
+        rocblas_int offL = w * w;
+        rocblas_int offG = offL + nr * w;
+        rocblas_int sizeF = offG + nr * nr;
+        rocblas_int size = grp.nfronts * sizeF;
+        rocblas_int bc = grp.nfronts * batch_count;
+
+        // (the fronts of the matrix in the batch with index b are stored one after the other,
+        // starting at position b * size of panel)
+        rocblas_int blocks = (size - 1) / BS1 + 1;
+        ROCSOLVER_LAUNCH_KERNEL(rf_front_gather_kernel<T>, dim3(blocks, batch_count), dim3(BS1), 0,
+                                stream, size, grp.map, valT, strideT, panel);
+
+        // (the arrays info and iinfo of POTRF share the same buffer)
+        ROCBLAS_CHECK((rocsolver_potrf_template<false, true, T, T>(
+            handle, rocblas_fill_lower, w, panel, 0, w, sizeF, iinfo, bc, scalars, work1, work2,
+            work3, work4, pivots, iinfo + bc, optim_mem)));
+
+        if(nr > 0)
+        {
+            rocblasCall_trsm(handle, rocblas_side_right, rocblas_fill_lower,
+                             rocblas_operation_conjugate_transpose, rocblas_diagonal_non_unit, nr,
+                             w, &one, panel, 0, w, sizeF, panel, offL, nr, sizeF, bc, optim_mem,
+                             work1, work2, work3, work4);
+            rocblasCall_syrk_herk<false, T>(handle, rocblas_fill_lower, rocblas_operation_none, nr,
+                                            w, &one, panel, offL, nr, sizeF, &zero, panel, offG,
+                                            nr, sizeF, bc);
+        }
+
+        ROCSOLVER_LAUNCH_KERNEL(rf_front_scatter_kernel<T>, dim3(blocks, batch_count), dim3(BS1),
+                                0, stream, offG, sizeF, size, grp.map, valT, strideT, panel);
+    }
+
+    rocblas_set_pointer_mode(handle, old_mode);
+    return rocblas_status_success;
+}
+
 template <typename T>
 rocblas_status rocsolver_csrrf_refactchol_argCheck(rocblas_handle handle,
                                                    const rocblas_int n,
@@ -125,7 +258,8 @@ rocblas_status rocsolver_csrrf_refactchol_argCheck(rocblas_handle handle,
                                                    rocblas_int* indT,
                                                    T valT,
                                                    rocblas_int* pivQ,
-                                                   rocsolver_rfinfo rfinfo)
+                                                   rocsolver_rfinfo rfinfo,
+                                                   const rocblas_int batch_count = 1)
 {
     // order is important for unit tests:
 
@@ -133,7 +267,7 @@ rocblas_status rocsolver_csrrf_refactchol_argCheck(rocblas_handle handle,
     // N/A
 
     // 2. invalid size
-    if(n < 0 || nnzA < 0 || nnzT < 0)
+    if(n < 0 || nnzA < 0 || nnzT < 0 || batch_count < 0)
         return rocblas_status_invalid_size;
 
     // skip pointer check if querying memory size
@@ -141,8 +275,8 @@ rocblas_status rocsolver_csrrf_refactchol_argCheck(rocblas_handle handle,
         return rocblas_status_continue;
 
     // 3. invalid pointers
-    if(!rfinfo || !ptrA || !ptrT || (n && !pivQ) || (nnzA && (!indA || !valA))
-       || (nnzT && (!indT || !valT)))
+    if(!rfinfo || !ptrA || !ptrT || (n && !pivQ) || (nnzA && (!indA || (batch_count && !valA)))
+       || (nnzT && (!indT || (batch_count && !valT))))
         return rocblas_status_invalid_pointer;
 
     return rocblas_status_continue;
@@ -155,16 +289,74 @@ void rocsolver_csrrf_refactchol_getMemorySize(const rocblas_int n,
                                               rocblas_int* indT,
                                               U valT,
                                               rocsolver_rfinfo rfinfo,
-                                              size_t* size_work)
+                                              const rocblas_int batch_count,
+                                              size_t* size_work,
+                                              size_t* size_scalars,
+                                              size_t* size_work1,
+                                              size_t* size_work2,
+                                              size_t* size_work3,
+                                              size_t* size_work4,
+                                              size_t* size_pivots,
+                                              size_t* size_iinfo,
+                                              size_t* size_panel,
+                                              bool* optim_mem)
 {
+    *size_scalars = 0;
+    *size_work1 = 0;
+    *size_work2 = 0;
+    *size_work3 = 0;
+    *size_work4 = 0;
+    *size_pivots = 0;
+    *size_iinfo = 0;
+    *size_panel = 0;
+    *optim_mem = true;
+
     // if quick return, no need of workspace
-    if(n == 0)
+    if(n == 0 || batch_count == 0)
     {
         *size_work = 0;
         return;
     }
 
+    if(rfinfo->refact_mode == rocsolver_rfinfo_refact_mode_supernodal)
+    {
+        // requirements for the supernodal factorization: the dense blocks of the fronts of the
+        // current group, and the workspace for calling POTRF and TRSM with every group
+        for(const rocsolver_rfinfo_front_group& grp : rfinfo->fronts)
+        {
+            size_t s0, w1, w2, w3, w4, s5, s6;
+            bool opt;
+            rocblas_int bc = grp.nfronts * batch_count;
+            rocsolver_potrf_getMemorySize<false, true, T>(grp.width, rocblas_fill_lower, bc, &s0,
+                                                          &w1, &w2, &w3, &w4, &s5, &s6, &opt);
+            *size_scalars = std::max(*size_scalars, s0);
+            *size_work1 = std::max(*size_work1, w1);
+            *size_work2 = std::max(*size_work2, w2);
+            *size_work3 = std::max(*size_work3, w3);
+            *size_work4 = std::max(*size_work4, w4);
+            *size_pivots = std::max(*size_pivots, s5);
+            *optim_mem = *optim_mem && opt;
+
+            // info and iinfo of POTRF
+            *size_iinfo = std::max(*size_iinfo, sizeof(rocblas_int) * 2 * bc);
+
+            rocblasCall_trsm_mem<false, T>(
+                rocblas_side_right, rocblas_operation_conjugate_transpose, grp.nrows, grp.width,
+                grp.width, std::max(grp.nrows, 1), bc, &w1, &w2, &w3, &w4);
+            *size_work1 = std::max(*size_work1, w1);
+            *size_work2 = std::max(*size_work2, w2);
+            *size_work3 = std::max(*size_work3, w3);
+            *size_work4 = std::max(*size_work4, w4);
+        }
+        *size_panel = sizeof(T) * rfinfo->sn_max_panel * batch_count;
+
+        // need size n integers to generate inverse permutation inv_pivQ
+        *size_work = sizeof(rocblas_int) * n;
+        return;
+    }
+
     // requirements for incomplete factorization
+    // (the buffer is re-used by all the matrices in the batch)
     rocsparseCall_csric0_buffer_size(rfinfo->sphandle, n, nnzT, rfinfo->descrT, valT, ptrT, indT,
                                      rfinfo->infoT, size_work);
 
@@ -179,34 +371,57 @@ rocblas_status rocsolver_csrrf_refactchol_template(rocblas_handle handle,
                                                    rocblas_int* ptrA,
                                                    rocblas_int* indA,
                                                    U valA,
+                                                   const rocblas_stride strideA,
                                                    const rocblas_int nnzT,
                                                    rocblas_int* ptrT,
                                                    rocblas_int* indT,
                                                    U valT,
+                                                   const rocblas_stride strideT,
                                                    rocblas_int* pivQ,
                                                    rocsolver_rfinfo rfinfo,
-                                                   void* work)
+                                                   const rocblas_int batch_count,
+                                                   void* work,
+                                                   T* scalars,
+                                                   void* work1,
+                                                   void* work2,
+                                                   void* work3,
+                                                   void* work4,
+                                                   T* pivots,
+                                                   rocblas_int* iinfo,
+                                                   T* panel,
+                                                   const bool optim_mem)
 {
-    ROCSOLVER_ENTER("csrrf_refactchol", "n:", n, "nnzA:", nnzA, "nnzT:", nnzT);
+    ROCSOLVER_ENTER("csrrf_refactchol", "n:", n, "nnzA:", nnzA, "nnzT:", nnzT,
+                    "bc:", batch_count);
 
     // quick return
-    if(n == 0)
+    if(n == 0 || batch_count == 0)
         return rocblas_status_success;
 
     // check state of rfinfo
     if(!rfinfo->analyzed || rfinfo->analyzed_mode != rocsolver_rfinfo_mode_cholesky
-       || rfinfo->mode != rocsolver_rfinfo_mode_cholesky)
+       || rfinfo->mode != rocsolver_rfinfo_mode_cholesky
+       || rfinfo->analyzed_refact_mode != rfinfo->refact_mode)
         return rocblas_status_internal_error;
 
     hipStream_t stream;
     ROCBLAS_CHECK(rocblas_get_stream(handle, &stream));
 
+    // bind the sparse handle to the stream of the calling handle
+    // (rfinfo may have been created with a different handle or stream)
+    ROCSPARSE_CHECK(rocsparse_set_stream(rfinfo->sphandle, stream));
+
     rocblas_int nblocks = (n - 1) / BS2 + 1;
     ROCSOLVER_LAUNCH_KERNEL(rf_ipvec_kernel<T>, dim3(nblocks), dim3(BS2), 0, stream, n, pivQ,
                             (rocblas_int*)work);
 
     // set T to zero
-    HIP_CHECK(hipMemsetAsync((void*)valT, 0, sizeof(T) * nnzT, stream));
+    if(nnzT > 0)
+    {
+        rocblas_int blocksT = (nnzT - 1) / BS1 + 1;
+        ROCSOLVER_LAUNCH_KERNEL(reset_batch_info<T>, dim3(blocksT, batch_count), dim3(BS1), 0,
+                                stream, valT, strideT, nnzT, 0);
+    }
 
     // --------------------------------------------------------------
     // copy Q'*A*Q into T
@@ -214,12 +429,20 @@ rocblas_status rocsolver_csrrf_refactchol_template(rocblas_handle handle,
     // Note: assume A and B are symmetric and ONLY the LOWER triangular parts of A and T are touched
     // --------------------------------------------------------------
     T const alpha = static_cast<T>(1);
-    ROCSOLVER_LAUNCH_KERNEL(rf_add_QAQ_kernel<T>, dim3(nblocks, 1), dim3(BS2, BS2), 0, stream, n,
-                            pivQ, (rocblas_int*)work, alpha, ptrA, indA, valA, ptrT, indT, valT);
+    ROCSOLVER_LAUNCH_KERNEL(rf_add_QAQ_kernel<T>, dim3(nblocks, batch_count), dim3(BS2, BS2), 0,
+                            stream, n, pivQ, (rocblas_int*)work, alpha, ptrA, indA, valA, strideA,
+                            ptrT, indT, valT, strideT);
+
+    if(rfinfo->refact_mode == rocsolver_rfinfo_refact_mode_supernodal)
+        return rf_sn_refactchol(handle, stream, rfinfo, valT, strideT, batch_count, scalars,
+                                work1, work2, work3, work4, pivots, iinfo, panel, optim_mem);
 
     // perform incomplete factorization of T
-    ROCSPARSE_CHECK(rocsparseCall_csric0(rfinfo->sphandle, n, nnzT, rfinfo->descrT, valT, ptrT,
-                                         indT, rfinfo->infoT, rocsparse_solve_policy_auto, work));
+    // (all the matrices share the sparsity pattern, and thus the analysis in rfinfo)
+    for(rocblas_int b = 0; b < batch_count; ++b)
+        ROCSPARSE_CHECK(rocsparseCall_csric0(rfinfo->sphandle, n, nnzT, rfinfo->descrT,
+                                             valT + b * strideT, ptrT, indT, rfinfo->infoT,
+                                             rocsparse_solve_policy_auto, work));
 
     return rocblas_status_success;
 }
@@ -61,31 +61,49 @@ rocblas_status rocsolver_csrrf_refactlu_impl(rocblas_handle handle,
     if(st != rocblas_status_continue)
         return st;
 
-    // TODO: add batched versions
     // working with unshifted arrays
     // normal (non-batched non-strided) execution
+    rocblas_stride strideA = 0;
+    rocblas_stride strideT = 0;
+    rocblas_int batch_count = 1;
 
     // memory workspace sizes:
     // size for temp buffer in refactlu calls
     size_t size_work = 0;
+    // size of reusable workspace (for calling TRSM in the supernodal factorization)
+    bool optim_mem;
+    size_t size_work1, size_work2, size_work3, size_work4;
+    // size for the dense panels of the supernodes
+    size_t size_panel;
 
-    rocsolver_csrrf_refactlu_getMemorySize<T>(n, nnzT, ptrT, indT, valT, rfinfo, &size_work);
+    rocsolver_csrrf_refactlu_getMemorySize<T>(n, nnzT, ptrT, indT, valT, rfinfo, batch_count,
+                                              &size_work, &size_work1, &size_work2, &size_work3,
+                                              &size_work4, &size_panel, &optim_mem);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_work);
+        return rocblas_set_optimal_device_memory_size(handle, size_work, size_work1, size_work2,
+                                                      size_work3, size_work4, size_panel);
 
     // memory workspace allocation
-    void* work = nullptr;
-    rocblas_device_malloc mem(handle, size_work);
+    void *work, *work1, *work2, *work3, *work4, *panel;
+    rocblas_device_malloc mem(handle, size_work, size_work1, size_work2, size_work3, size_work4,
+                              size_panel);
 
     if(!mem)
         return rocblas_status_memory_error;
 
     work = mem[0];
+    work1 = mem[1];
+    work2 = mem[2];
+    work3 = mem[3];
+    work4 = mem[4];
+    panel = mem[5];
 
     // execution
-    return rocsolver_csrrf_refactlu_template<T, U>(handle, n, nnzA, ptrA, indA, valA, nnzT, ptrT,
-                                                   indT, valT, pivP, pivQ, rfinfo, work);
+    return rocsolver_csrrf_refactlu_template<T, U>(handle, n, nnzA, ptrA, indA, valA, strideA, nnzT,
+                                                   ptrT, indT, valT, strideT, pivP, pivQ, rfinfo,
+                                                   batch_count, work, work1, work2, work3, work4,
+                                                   (T*)panel, optim_mem);
 #else
     return rocblas_status_not_implemented;
 #endif
@@ -52,13 +52,20 @@ ROCSOLVER_KERNEL void rf_add_PAQ_kernel(const rocblas_int n,
                                         const T alpha,
                                         rocblas_int* Ap,
                                         rocblas_int* Ai,
-                                        T* Ax,
+                                        T* AxA,
+                                        const rocblas_stride strideA,
                                         rocblas_int* LUp,
                                         rocblas_int* LUi,
-                                        T* LUx)
+                                        T* LUxA,
+                                        const rocblas_stride strideT)
 {
     rocblas_int tix = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
     rocblas_int tiy = hipThreadIdx_y;
+    rocblas_int bid = hipBlockIdx_y;
+
+    // all the matrices in the batch share the same sparsity pattern
+    T* Ax = AxA + bid * strideA;
+    T* LUx = LUxA + bid * strideT;
 
     // -------------------------------------------
     // If P or Q is NULL, then treat as identity permutation
@@ -92,6 +99,223 @@ ROCSOLVER_KERNEL void rf_add_PAQ_kernel(const rocblas_int n,
     }
 }
 
+/** RF_SN_GATHER_KERNEL copies the entries of a supernode from valT to its dense panels.
+    The positions in valT are given by map; the entries that are not in the sparsity pattern of T
+    are set to zero. **/
+template <typename T>
+ROCSOLVER_KERNEL void rf_sn_gather_kernel(const rocblas_int size,
+                                          rocblas_int* map,
+                                          T* valTA,
+                                          const rocblas_stride strideT,
+                                          T* panelA,
+                                          const rocblas_stride strideP)
+{
+    rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocblas_int bid = hipBlockIdx_y;
+
+    if(i < size)
+    {
+        T* valT = valTA + bid * strideT;
+        rocblas_int p = map[i];
+        panelA[bid * strideP + i] = (p >= 0 ? valT[p] : T(0));
+    }
+}
+
+/** RF_SN_SCATTER_KERNEL copies the first sizeP entries of the panels of a supernode back to
+    valT, and subtracts the rest of the entries (the update L * U) from valT. **/
+template <typename T>
+ROCSOLVER_KERNEL void rf_sn_scatter_kernel(const rocblas_int sizeP,
+                                           const rocblas_int size,
+                                           rocblas_int* map,
+                                           T* valTA,
+                                           const rocblas_stride strideT,
+                                           T* panelA,
+                                           const rocblas_stride strideP)
+{
+    rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocblas_int bid = hipBlockIdx_y;
+
+    if(i < size)
+    {
+        T* valT = valTA + bid * strideT;
+        rocblas_int p = map[i];
+        if(p >= 0)
+        {
+            if(i < sizeP)
+                valT[p] = panelA[bid * strideP + i];
+            else
+                valT[p] -= panelA[bid * strideP + i];
+        }
+    }
+}
+
+/** RF_DEMOTE_KERNEL copies the nnz values of the matrices in valT to the single precision
+    buffer lowT. **/
+template <typename T, typename S>
+ROCSOLVER_KERNEL void rf_demote_kernel(const rocblas_int nnz,
+                                       T* valTA,
+                                       const rocblas_stride strideT,
+                                       S* lowTA,
+                                       const rocblas_stride strideL)
+{
+    rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocblas_int bid = hipBlockIdx_y;
+
+    if(i < nnz)
+        lowTA[bid * strideL + i] = S(valTA[bid * strideT + i]);
+}
+
+/** RF_SN_GETF2_KERNEL computes the LU factorization without pivoting of the w-by-w diagonal
+    block of a supernode (stored with leading dimension w). If tol is not null, the pivots
+    smaller than tol in magnitude are replaced by +/- tol (static pivoting), and counted in
+    npert. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) rf_sn_getf2_kernel(const rocblas_int w,
+                                                                T* panelA,
+                                                                const rocblas_stride strideP,
+                                                                const U* tol,
+                                                                rocblas_int* npert)
+{
+    rocblas_int tid = hipThreadIdx_x;
+    rocblas_int bid = hipBlockIdx_y;
+    T* A = panelA + bid * strideP;
+
+    for(rocblas_int k = 0; k < w; ++k)
+    {
+        // perturb the pivot if needed
+        if(tol)
+        {
+            if(tid == 0)
+            {
+                T thr = T(tol[bid]);
+                T p = A[k + k * w];
+                if(std::abs(p) < thr)
+                {
+                    A[k + k * w] = (p < 0 ? -thr : thr);
+                    npert[bid]++;
+                }
+            }
+            __syncthreads();
+        }
+
+        // scale the k-th column below the diagonal
+        T pivot = A[k + k * w];
+        for(rocblas_int i = k + 1 + tid; i < w; i += hipBlockDim_x)
+            A[i + k * w] /= pivot;
+        __syncthreads();
+
+        // update the trailing block
+        rocblas_int m = w - k - 1;
+        for(rocblas_int t = tid; t < m * m; t += hipBlockDim_x)
+        {
+            rocblas_int i = k + 1 + t % m;
+            rocblas_int j = k + 1 + t / m;
+            A[i + j * w] -= A[i + k * w] * A[k + j * w];
+        }
+        __syncthreads();
+    }
+}
+
+/** RF_COUNT_BOOSTED_KERNEL counts in npert the diagonal elements of the factors U in valT that
+    are equal to tol, i.e. the pivots replaced by the numeric boost of the incomplete
+    factorization. (one thread per row; the rows of all the instances in the batch are
+    processed by a single grid) **/
+template <typename T>
+ROCSOLVER_KERNEL void rf_count_boosted_kernel(const rocblas_int n,
+                                              rocblas_int* ptrT,
+                                              rocblas_int* indT,
+                                              T* valTA,
+                                              const rocblas_stride strideT,
+                                              const T* tol,
+                                              rocblas_int* npert)
+{
+    rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocblas_int bid = hipBlockIdx_y;
+
+    if(i < n)
+    {
+        T* valT = valTA + bid * strideT;
+        rocblas_int d = rf_search<T>(indT, ptrT[i], ptrT[i + 1], i);
+        if(d != -1 && valT[d] == tol[bid])
+            atomicAdd(npert + bid, 1);
+    }
+}
+
+/** RF_SN_REFACTLU computes the supernodal LU factorization of the matrices in valT (which
+    contain P*A*Q) in place. S is the precision of the factorization. If tol is not null, the
+    tiny pivots are perturbed as in RF_SN_GETF2_KERNEL. **/
+template <typename S, typename U>
+rocblas_status rf_sn_refactlu(rocblas_handle handle,
+                              hipStream_t stream,
+                              rocsolver_rfinfo rfinfo,
+                              S* valT,
+                              const rocblas_stride strideT,
+                              const rocblas_int batch_count,
+                              void* work1,
+                              void* work2,
+                              void* work3,
+                              void* work4,
+                              S* panel,
+                              const bool optim_mem,
+                              const U* tol,
+                              rocblas_int* npert)
+{
+    // -------------------------------------------------------------------
+    // supernodal factorization of T: for every supernode (in order), factorize the
+    // diagonal block D, compute the blocks L and U of the factors as
+    //     U <- inv(L_D) * U,   L <- L * inv(U_D),
+    // and subtract the update L * U from the rest of T.
+    // Note: as in the incomplete factorization, the entries of the update that are not
+    // in the sparsity pattern of T are dropped.
+    // -------------------------------------------------------------------
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+
+    S one = 1;
+    S zero = 0;
+    rocblas_stride strideP = rfinfo->sn_max_panel;
+
+    for(const rocsolver_rfinfo_supernode& sn : rfinfo->supernodes)
+    {
+        rocblas_int w = sn.width;
+        rocblas_int nr = sn.nrows;
+        rocblas_int nc = sn.ncols;
+        rocblas_int offU = w * w;
+        rocblas_int offL = w * (w + nc);
+        rocblas_int offG = offL + nr * w;
+
+        // ([D U] and L are gathered, and updated with L * U, by a single kernel each)
+        rocblas_int blocksP = (offG - 1) / BS1 + 1;
+        rocblas_int blocksG = (offG + nr * nc - 1) / BS1 + 1;
+        ROCSOLVER_LAUNCH_KERNEL(rf_sn_gather_kernel<S>, dim3(blocksP, batch_count), dim3(BS1), 0,
+                                stream, offG, sn.mapD, valT, strideT, panel, strideP);
+        ROCSOLVER_LAUNCH_KERNEL((rf_sn_getf2_kernel<S, U>), dim3(1, batch_count), dim3(BS1), 0,
+                                stream, w, panel, strideP, tol, npert);
+
+        if(nc > 0)
+            rocblasCall_trsm(handle, rocblas_side_left, rocblas_fill_lower, rocblas_operation_none,
+                             rocblas_diagonal_unit, w, nc, &one, panel, 0, w, strideP, panel, offU,
+                             w, strideP, batch_count, optim_mem, work1, work2, work3, work4);
+        if(nr > 0)
+            rocblasCall_trsm(handle, rocblas_side_right, rocblas_fill_upper,
+                             rocblas_operation_none, rocblas_diagonal_non_unit, nr, w, &one, panel,
+                             0, w, strideP, panel, offL, nr, strideP, batch_count, optim_mem,
+                             work1, work2, work3, work4);
+        if(nr > 0 && nc > 0)
+            rocblasCall_gemm(handle, rocblas_operation_none, rocblas_operation_none, nr, nc, w,
+                             &one, panel, offL, nr, strideP, panel, offU, w, strideP, &zero, panel,
+                             offG, nr, strideP, batch_count, (S**)nullptr);
+
+        ROCSOLVER_LAUNCH_KERNEL(rf_sn_scatter_kernel<S>, dim3(blocksG, batch_count), dim3(BS1), 0,
+                                stream, offG, offG + nr * nc, sn.mapD, valT, strideT, panel,
+                                strideP);
+    }
+
+    rocblas_set_pointer_mode(handle, old_mode);
+    return rocblas_status_success;
+}
+
 template <typename T>
 rocblas_status rocsolver_csrrf_refactlu_argCheck(rocblas_handle handle,
                                                  const rocblas_int n,
@@ -105,7 +329,8 @@ rocblas_status rocsolver_csrrf_refactlu_argCheck(rocblas_handle handle,
                                                  T valT,
                                                  rocblas_int* pivP,
                                                  rocblas_int* pivQ,
-                                                 rocsolver_rfinfo rfinfo)
+                                                 rocsolver_rfinfo rfinfo,
+                                                 const rocblas_int batch_count = 1)
 {
     // order is important for unit tests:
 
@@ -113,7 +338,7 @@ rocblas_status rocsolver_csrrf_refactlu_argCheck(rocblas_handle handle,
     // N/A
 
     // 2. invalid size
-    if(n < 0 || nnzA < 0 || nnzT < 0)
+    if(n < 0 || nnzA < 0 || nnzT < 0 || batch_count < 0)
         return rocblas_status_invalid_size;
 
     // skip pointer check if querying memory size
@@ -121,8 +346,9 @@ rocblas_status rocsolver_csrrf_refactlu_argCheck(rocblas_handle handle,
         return rocblas_status_continue;
 
     // 3. invalid pointers
-    if(!rfinfo || !ptrA || !ptrT || (n && (!pivP || !pivQ)) || (nnzA && (!indA || !valA))
-       || (nnzT && (!indT || !valT)))
+    if(!rfinfo || !ptrA || !ptrT || (n && (!pivP || !pivQ))
+       || (nnzA && (!indA || (batch_count && !valA)))
+       || (nnzT && (!indT || (batch_count && !valT))))
         return rocblas_status_invalid_pointer;
 
     return rocblas_status_continue;
@@ -135,16 +361,75 @@ void rocsolver_csrrf_refactlu_getMemorySize(const rocblas_int n,
                                             rocblas_int* indT,
                                             U valT,
                                             rocsolver_rfinfo rfinfo,
-                                            size_t* size_work)
+                                            const rocblas_int batch_count,
+                                            size_t* size_work,
+                                            size_t* size_work1,
+                                            size_t* size_work2,
+                                            size_t* size_work3,
+                                            size_t* size_work4,
+                                            size_t* size_panel,
+                                            bool* optim_mem)
 {
+    *size_work1 = 0;
+    *size_work2 = 0;
+    *size_work3 = 0;
+    *size_work4 = 0;
+    *size_panel = 0;
+    *optim_mem = true;
+
     // if quick return, no need of workspace
-    if(n == 0)
+    if(n == 0 || batch_count == 0)
     {
         *size_work = 0;
         return;
     }
 
+    if(rfinfo->refact_mode == rocsolver_rfinfo_refact_mode_supernodal)
+    {
+        // requirements for the supernodal factorization: the dense panels of the current
+        // supernode, and the workspace for calling TRSM with the largest panels
+        size_t w1a, w2a, w3a, w4a, w1b, w2b, w3b, w4b;
+        rocblas_int w = rfinfo->sn_max_width;
+        rocblasCall_trsm_mem<false, T>(rocblas_side_left, rocblas_operation_none, w,
+                                       rfinfo->sn_max_ncols, w, w, batch_count, &w1a, &w2a, &w3a,
+                                       &w4a);
+        rocblasCall_trsm_mem<false, T>(rocblas_side_right, rocblas_operation_none,
+                                       rfinfo->sn_max_nrows, w, w,
+                                       std::max(rfinfo->sn_max_nrows, 1), batch_count, &w1b, &w2b,
+                                       &w3b, &w4b);
+        *size_work1 = std::max(w1a, w1b);
+        *size_work2 = std::max(w2a, w2b);
+        *size_work3 = std::max(w3a, w3b);
+        *size_work4 = std::max(w4a, w4b);
+        *size_panel = sizeof(T) * rfinfo->sn_max_panel * batch_count;
+
+        if constexpr(std::is_same<T, double>::value)
+        {
+            // in mixed precision, TRSM is called in single precision
+            // (the panels of double precision are also large enough)
+            if(rfinfo->precision_mode == rocsolver_rfinfo_precision_mode_mixed)
+            {
+                rocblasCall_trsm_mem<false, float>(rocblas_side_left, rocblas_operation_none, w,
+                                                   rfinfo->sn_max_ncols, w, w, batch_count, &w1a,
+                                                   &w2a, &w3a, &w4a);
+                rocblasCall_trsm_mem<false, float>(rocblas_side_right, rocblas_operation_none,
+                                                   rfinfo->sn_max_nrows, w, w,
+                                                   std::max(rfinfo->sn_max_nrows, 1), batch_count,
+                                                   &w1b, &w2b, &w3b, &w4b);
+                *size_work1 = std::max({*size_work1, w1a, w1b});
+                *size_work2 = std::max({*size_work2, w2a, w2b});
+                *size_work3 = std::max({*size_work3, w3a, w3b});
+                *size_work4 = std::max({*size_work4, w4a, w4b});
+            }
+        }
+
+        // need size n integers to generate inverse permutation inv_pivQ
+        *size_work = sizeof(rocblas_int) * n;
+        return;
+    }
+
     // requirements for incomplete factorization
+    // (the buffer is re-used by all the matrices in the batch)
     rocsparseCall_csrilu0_buffer_size(rfinfo->sphandle, n, nnzT, rfinfo->descrT, valT, ptrT, indT,
                                       rfinfo->infoT, size_work);
 
@@ -159,35 +444,54 @@ rocblas_status rocsolver_csrrf_refactlu_template(rocblas_handle handle,
                                                  rocblas_int* ptrA,
                                                  rocblas_int* indA,
                                                  U valA,
+                                                 const rocblas_stride strideA,
                                                  const rocblas_int nnzT,
                                                  rocblas_int* ptrT,
                                                  rocblas_int* indT,
                                                  U valT,
+                                                 const rocblas_stride strideT,
                                                  rocblas_int* pivP,
                                                  rocblas_int* pivQ,
                                                  rocsolver_rfinfo rfinfo,
-                                                 void* work)
+                                                 const rocblas_int batch_count,
+                                                 void* work,
+                                                 void* work1,
+                                                 void* work2,
+                                                 void* work3,
+                                                 void* work4,
+                                                 T* panel,
+                                                 const bool optim_mem)
 {
-    ROCSOLVER_ENTER("csrrf_refactlu", "n:", n, "nnzA:", nnzA, "nnzT:", nnzT);
+    ROCSOLVER_ENTER("csrrf_refactlu", "n:", n, "nnzA:", nnzA, "nnzT:", nnzT, "bc:", batch_count);
 
     // quick return
-    if(n == 0)
+    if(n == 0 || batch_count == 0)
         return rocblas_status_success;
 
     // check state of rfinfo
     if(!rfinfo->analyzed || rfinfo->analyzed_mode != rocsolver_rfinfo_mode_lu
-       || rfinfo->mode != rocsolver_rfinfo_mode_lu)
+       || rfinfo->mode != rocsolver_rfinfo_mode_lu
+       || rfinfo->analyzed_refact_mode != rfinfo->refact_mode)
         return rocblas_status_internal_error;
 
     hipStream_t stream;
     ROCBLAS_CHECK(rocblas_get_stream(handle, &stream));
 
+    // bind the sparse handle to the stream of the calling handle
+    // (rfinfo may have been created with a different handle or stream)
+    ROCSPARSE_CHECK(rocsparse_set_stream(rfinfo->sphandle, stream));
+
     rocblas_int nblocks = (n - 1) / BS2 + 1;
     ROCSOLVER_LAUNCH_KERNEL(rf_ipvec_kernel<T>, dim3(nblocks), dim3(BS2), 0, stream, n, pivQ,
                             (rocblas_int*)work);
 
     // set T to zero
-    HIP_CHECK(hipMemsetAsync((void*)valT, 0, sizeof(T) * nnzT, stream));
+    if(nnzT > 0)
+    {
+        rocblas_int blocksT = (nnzT - 1) / BS1 + 1;
+        ROCSOLVER_LAUNCH_KERNEL(reset_batch_info<T>, dim3(blocksT, batch_count), dim3(BS1), 0,
+                                stream, valT, strideT, nnzT, 0);
+    }
 
     // ---------------------------------------------------------------------
     // copy P*A*Q into T
@@ -196,12 +500,121 @@ rocblas_status rocsolver_csrrf_refactlu_template(rocblas_handle handle,
     // yields the complete factorization of A.
     // ---------------------------------------------------------------------
     T const alpha = static_cast<T>(1);
-    ROCSOLVER_LAUNCH_KERNEL(rf_add_PAQ_kernel<T>, dim3(nblocks, 1), dim3(BS2, BS2), 0, stream, n,
-                            pivP, (rocblas_int*)work, alpha, ptrA, indA, valA, ptrT, indT, valT);
+    ROCSOLVER_LAUNCH_KERNEL(rf_add_PAQ_kernel<T>, dim3(nblocks, batch_count), dim3(BS2, BS2), 0,
+                            stream, n, pivP, (rocblas_int*)work, alpha, ptrA, indA, valA, strideA,
+                            ptrT, indT, valT, strideT);
+
+    // ---------------------------------------------------------------------
+    // static pivoting: the pivots smaller than tol = threshold * ||P*A*Q||_inf in magnitude
+    // are replaced by +/- tol and counted (the buffer owned by rfinfo also keeps a copy
+    // of P*A*Q for the iterative refinement of csrrf_solve)
+    // ---------------------------------------------------------------------
+    rfinfo->pivot_bc = batch_count;
+    rfinfo->pivot_active = false;
+    T* tol = nullptr;
+    rocblas_int* npert = nullptr;
+    if(rfinfo->pivot_threshold > 0)
+    {
+        const bool refine = rf_pivot_refine<T>(rfinfo);
+        size_t size_valA = refine ? sizeof(T) * nnzT * batch_count : 0;
+        size_t size_pivot = size_valA + (sizeof(T) + sizeof(rocblas_int)) * batch_count;
+        if(rfinfo->pivot_size < size_pivot)
+        {
+            if(rfinfo->pivot_data)
+                HIP_CHECK(hipFree(rfinfo->pivot_data));
+            rfinfo->pivot_data = nullptr;
+            rfinfo->pivot_size = 0;
+            HIP_CHECK(hipMalloc(&rfinfo->pivot_data, size_pivot));
+            rfinfo->pivot_size = size_pivot;
+        }
+        char* data = static_cast<char*>(rfinfo->pivot_data);
+        tol = reinterpret_cast<T*>(data + size_valA);
+        npert = reinterpret_cast<rocblas_int*>(tol + batch_count);
+        rfinfo->pivot_valA = refine ? data : nullptr;
+        rfinfo->pivot_tol = tol;
+        rfinfo->pivot_count = npert;
+
+        if(refine && nnzT > 0)
+            HIP_CHECK(hipMemcpy2DAsync(rfinfo->pivot_valA, sizeof(T) * nnzT, valT,
+                                       sizeof(T) * std::max(strideT, rocblas_stride(nnzT)),
+                                       sizeof(T) * nnzT, batch_count, hipMemcpyDeviceToDevice,
+                                       stream));
+        ROCSOLVER_LAUNCH_KERNEL((rf_norm_kernel<T, T>), dim3(1, batch_count), dim3(BS1), 0, stream,
+                                n, ptrT, valT, strideT, T(rfinfo->pivot_threshold), tol);
+        HIP_CHECK(hipMemsetAsync(npert, 0, sizeof(rocblas_int) * batch_count, stream));
+        rfinfo->pivot_active = true;
+    }
+
+    if(rfinfo->refact_mode == rocsolver_rfinfo_refact_mode_supernodal)
+    {
+        if constexpr(std::is_same<T, double>::value)
+        {
+            if(rfinfo->precision_mode == rocsolver_rfinfo_precision_mode_mixed)
+            {
+                // mixed precision: factorize a single precision copy of T, owned by rfinfo,
+                // and keep P*A*Q in T for the residuals of the iterative refinement
+                size_t size_low = size_t(nnzT) * batch_count;
+                if(rfinfo->low_size < size_low)
+                {
+                    if(rfinfo->low_valT)
+                        HIP_CHECK(hipFree(rfinfo->low_valT));
+                    rfinfo->low_valT = nullptr;
+                    rfinfo->low_size = 0;
+                    HIP_CHECK(hipMalloc(&rfinfo->low_valT, sizeof(float) * size_low));
+                    rfinfo->low_size = size_low;
+                }
+
+                if(nnzT > 0)
+                {
+                    rocblas_int blocksT = (nnzT - 1) / BS1 + 1;
+                    ROCSOLVER_LAUNCH_KERNEL(rf_demote_kernel<T, float>, dim3(blocksT, batch_count),
+                                            dim3(BS1), 0, stream, nnzT, valT, strideT,
+                                            rfinfo->low_valT, rocblas_stride(nnzT));
+                }
+
+                ROCBLAS_CHECK(rf_sn_refactlu(handle, stream, rfinfo, rfinfo->low_valT,
+                                             rocblas_stride(nnzT), batch_count, work1, work2,
+                                             work3, work4, (float*)panel, optim_mem, tol, npert));
+                rfinfo->low_bc = batch_count;
+                return rocblas_status_success;
+            }
+        }
+
+        ROCBLAS_CHECK(rf_sn_refactlu(handle, stream, rfinfo, valT, strideT, batch_count, work1,
+                                     work2, work3, work4, panel, optim_mem, tol, npert));
+        rfinfo->low_bc = 0;
+        return rocblas_status_success;
+    }
 
     // perform incomplete factorization of T
-    ROCSPARSE_CHECK(rocsparseCall_csrilu0(rfinfo->sphandle, n, nnzT, rfinfo->descrT, valT, ptrT,
-                                          indT, rfinfo->infoT, rocsparse_solve_policy_auto, work));
+    // (all the matrices share the sparsity pattern, and thus the analysis in rfinfo;
+    // with static pivoting, the tiny pivots are replaced by +tol by the numeric boost
+    // of rocsparse, which reads tol from the device)
+    if(tol)
+        ROCSPARSE_CHECK(
+            rocsparse_set_pointer_mode(rfinfo->sphandle, rocsparse_pointer_mode_device));
+    for(rocblas_int b = 0; b < batch_count; ++b)
+    {
+        if(tol)
+            ROCSPARSE_CHECK(rocsparseCall_csrilu0_numeric_boost(rfinfo->sphandle, rfinfo->infoT,
+                                                                1, tol + b, tol + b));
+        ROCSPARSE_CHECK(rocsparseCall_csrilu0(rfinfo->sphandle, n, nnzT, rfinfo->descrT,
+                                              valT + b * strideT, ptrT, indT, rfinfo->infoT,
+                                              rocsparse_solve_policy_auto, work));
+    }
+    rfinfo->low_bc = 0;
+
+    if(tol)
+    {
+        ROCSPARSE_CHECK(rocsparse_set_pointer_mode(rfinfo->sphandle, rocsparse_pointer_mode_host));
+        ROCSPARSE_CHECK(rocsparseCall_csrilu0_numeric_boost(rfinfo->sphandle, rfinfo->infoT, 0,
+                                                            (T*)nullptr, (T*)nullptr));
+
+        // count the boosted pivots
+        rocblas_int blocks = (n - 1) / BS1 + 1;
+        ROCSOLVER_LAUNCH_KERNEL(rf_count_boosted_kernel<T>, dim3(blocks, batch_count), dim3(BS1),
+                                0, stream, n, ptrT, indT, valT, strideT, tol, npert);
+    }
 
     return rocblas_status_success;
 }
@@ -0,0 +1,168 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#ifdef HAVE_ROCSPARSE
+#include "rocrefact_csrrf_refactlu.hpp"
+#endif
+
+#include "rocblas.hpp"
+#include "rocsolver/rocsolver.h"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+template <typename T, typename U>
+rocblas_status rocsolver_csrrf_refactlu_strided_batched_impl(rocblas_handle handle,
+                                                             const rocblas_int n,
+                                                             const rocblas_int nnzA,
+                                                             rocblas_int* ptrA,
+                                                             rocblas_int* indA,
+                                                             U valA,
+                                                             const rocblas_stride strideA,
+                                                             const rocblas_int nnzT,
+                                                             rocblas_int* ptrT,
+                                                             rocblas_int* indT,
+                                                             U valT,
+                                                             const rocblas_stride strideT,
+                                                             rocblas_int* pivP,
+                                                             rocblas_int* pivQ,
+                                                             rocsolver_rfinfo rfinfo,
+                                                             const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER_TOP("csrrf_refactlu_strided_batched", "-n", n, "--nnzA", nnzA, "--strideA",
+                        strideA, "--nnzT", nnzT, "--strideT", strideT, "--batch_count",
+                        batch_count);
+
+#ifdef HAVE_ROCSPARSE
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st
+        = rocsolver_csrrf_refactlu_argCheck(handle, n, nnzA, ptrA, indA, valA, nnzT, ptrT, indT,
+                                            valT, pivP, pivQ, rfinfo, batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+
+    // memory workspace sizes:
+    // size for temp buffer in refactlu calls
+    size_t size_work = 0;
+    // size of reusable workspace (for calling TRSM in the supernodal factorization)
+    bool optim_mem;
+    size_t size_work1, size_work2, size_work3, size_work4;
+    // size for the dense panels of the supernodes
+    size_t size_panel;
+
+    rocsolver_csrrf_refactlu_getMemorySize<T>(n, nnzT, ptrT, indT, valT, rfinfo, batch_count,
+                                              &size_work, &size_work1, &size_work2, &size_work3,
+                                              &size_work4, &size_panel, &optim_mem);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_work, size_work1, size_work2,
+                                                      size_work3, size_work4, size_panel);
+
+    // memory workspace allocation
+    void *work, *work1, *work2, *work3, *work4, *panel;
+    rocblas_device_malloc mem(handle, size_work, size_work1, size_work2, size_work3, size_work4,
+                              size_panel);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    work = mem[0];
+    work1 = mem[1];
+    work2 = mem[2];
+    work3 = mem[3];
+    work4 = mem[4];
+    panel = mem[5];
+
+    // execution
+    return rocsolver_csrrf_refactlu_template<T, U>(handle, n, nnzA, ptrA, indA, valA, strideA, nnzT,
+                                                   ptrT, indT, valT, strideT, pivP, pivQ, rfinfo,
+                                                   batch_count, work, work1, work2, work3, work4,
+                                                   (T*)panel, optim_mem);
+#else
+    return rocblas_status_not_implemented;
+#endif
+}
+
+ROCSOLVER_END_NAMESPACE
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_scsrrf_refactlu_strided_batched(rocblas_handle handle,
+                                                         const rocblas_int n,
+                                                         const rocblas_int nnzA,
+                                                         rocblas_int* ptrA,
+                                                         rocblas_int* indA,
+                                                         float* valA,
+                                                         const rocblas_stride strideA,
+                                                         const rocblas_int nnzT,
+                                                         rocblas_int* ptrT,
+                                                         rocblas_int* indT,
+                                                         float* valT,
+                                                         const rocblas_stride strideT,
+                                                         rocblas_int* pivP,
+                                                         rocblas_int* pivQ,
+                                                         rocsolver_rfinfo rfinfo,
+                                                         const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_csrrf_refactlu_strided_batched_impl<float>(
+        handle, n, nnzA, ptrA, indA, valA, strideA, nnzT, ptrT, indT, valT, strideT, pivP, pivQ,
+        rfinfo, batch_count);
+}
+
+rocblas_status rocsolver_dcsrrf_refactlu_strided_batched(rocblas_handle handle,
+                                                         const rocblas_int n,
+                                                         const rocblas_int nnzA,
+                                                         rocblas_int* ptrA,
+                                                         rocblas_int* indA,
+                                                         double* valA,
+                                                         const rocblas_stride strideA,
+                                                         const rocblas_int nnzT,
+                                                         rocblas_int* ptrT,
+                                                         rocblas_int* indT,
+                                                         double* valT,
+                                                         const rocblas_stride strideT,
+                                                         rocblas_int* pivP,
+                                                         rocblas_int* pivQ,
+                                                         rocsolver_rfinfo rfinfo,
+                                                         const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_csrrf_refactlu_strided_batched_impl<double>(
+        handle, n, nnzA, ptrA, indA, valA, strideA, nnzT, ptrT, indT, valT, strideT, pivP, pivQ,
+        rfinfo, batch_count);
+}
+
+} // extern C
@@ -0,0 +1,236 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "rocsolver/rocsolver.h"
+#include "rocsolver_rfinfo.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/** RF_GIVENS_QR_KERNEL computes the factor R of the QR factorization of A(:, Q) by rotating
+    the rows of A, one after the other, into R (George-Heath). A row is scattered into the dense
+    vector w and, starting from its first column k, the Givens rotation that zeroes w[k] against
+    the diagonal of row k of R is applied to row k of R and to w; the next non-zero element of w
+    is then in the parent of k in the column elimination tree. R = L' is stored in the lower
+    triangular part of T, which must be zero on entry, as must be w.
+    (One thread-block per matrix of the batch; the rotations are applied by all the threads of
+    the block) **/
+template <typename T>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) rf_givens_qr_kernel(const rocblas_int m,
+                                                                 const rocblas_int n,
+                                                                 const rocblas_int* ptrA,
+                                                                 const rocblas_int* indA,
+                                                                 T* valAA,
+                                                                 const rocblas_stride strideA,
+                                                                 const rocblas_int* ptrR,
+                                                                 const rocblas_int* colR,
+                                                                 const rocblas_int* posR,
+                                                                 const rocblas_int* parentR,
+                                                                 const rocblas_int* invQ,
+                                                                 T* valTA,
+                                                                 const rocblas_stride strideT,
+                                                                 T* wA)
+{
+    const rocblas_int tid = hipThreadIdx_x;
+    const rocblas_int bid = hipBlockIdx_y;
+
+    T* valA = valAA + bid * strideA;
+    T* valT = valTA + bid * strideT;
+    T* w = wA + size_t(bid) * n;
+
+    __shared__ rocblas_int sfirst;
+    __shared__ T sc, ss;
+
+    for(rocblas_int i = 0; i < m; ++i)
+    {
+        // scatter row i of A(:, Q) into w, and find its first column
+        if(tid == 0)
+            sfirst = n;
+        __syncthreads();
+        rocblas_int first = n;
+        for(rocblas_int k = ptrA[i] + tid; k < ptrA[i + 1]; k += BS1)
+        {
+            const rocblas_int c = invQ[indA[k]];
+            w[c] = valA[k];
+            first = (c < first) ? c : first;
+        }
+        if(first < n)
+            atomicMin(&sfirst, first);
+        __syncthreads();
+        const rocblas_int kfirst = (sfirst < n) ? sfirst : -1;
+        __syncthreads();
+
+        // rotate w into the rows of R along the path from its first column to the root
+        for(rocblas_int k = kfirst; k >= 0; k = parentR[k])
+        {
+            const rocblas_int kstart = ptrR[k];
+            const rocblas_int kend = ptrR[k + 1];
+
+            if(tid == 0)
+            {
+                const T a = valT[posR[kstart]];
+                const T b = w[k];
+                T c = 1, s = 0;
+                if(b != 0)
+                {
+                    const T r = std::hypot(a, b);
+                    c = a / r;
+                    s = b / r;
+                }
+                sc = c;
+                ss = s;
+            }
+            __syncthreads();
+
+            const T c = sc;
+            const T s = ss;
+            if(s != 0)
+            {
+                for(rocblas_int e = kstart + tid; e < kend; e += BS1)
+                {
+                    const rocblas_int j = colR[e];
+                    const rocblas_int p = posR[e];
+                    const T r = valT[p];
+                    const T x = w[j];
+                    valT[p] = c * r + s * x;
+                    w[j] = (e == kstart) ? T(0) : c * x - s * r;
+                }
+            }
+            __syncthreads();
+        }
+    }
+}
+
+template <typename T>
+rocblas_status rocsolver_csrrf_refactqr_argCheck(rocblas_handle handle,
+                                                 const rocblas_int m,
+                                                 const rocblas_int n,
+                                                 const rocblas_int nnzA,
+                                                 rocblas_int* ptrA,
+                                                 rocblas_int* indA,
+                                                 T valA,
+                                                 const rocblas_int nnzT,
+                                                 rocblas_int* ptrT,
+                                                 rocblas_int* indT,
+                                                 T valT,
+                                                 rocblas_int* pivQ,
+                                                 rocsolver_rfinfo rfinfo,
+                                                 const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    if(n < 0 || m < n || nnzA < 0 || nnzT < 0 || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if(!rfinfo || !ptrA || !ptrT || (n && !pivQ) || (nnzA && (!indA || (batch_count && !valA)))
+       || (nnzT && (!indT || (batch_count && !valT))))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T>
+void rocsolver_csrrf_refactqr_getMemorySize(const rocblas_int n,
+                                            const rocblas_int batch_count,
+                                            size_t* size_work)
+{
+    // if quick return, no need of workspace
+    if(n == 0 || batch_count == 0)
+    {
+        *size_work = 0;
+        return;
+    }
+
+    // dense row w of every matrix in the batch
+    *size_work = sizeof(T) * n * batch_count;
+}
+
+template <typename T, typename U>
+rocblas_status rocsolver_csrrf_refactqr_template(rocblas_handle handle,
+                                                 const rocblas_int m,
+                                                 const rocblas_int n,
+                                                 const rocblas_int nnzA,
+                                                 rocblas_int* ptrA,
+                                                 rocblas_int* indA,
+                                                 U valA,
+                                                 const rocblas_stride strideA,
+                                                 const rocblas_int nnzT,
+                                                 rocblas_int* ptrT,
+                                                 rocblas_int* indT,
+                                                 U valT,
+                                                 const rocblas_stride strideT,
+                                                 rocblas_int* pivQ,
+                                                 rocsolver_rfinfo rfinfo,
+                                                 const rocblas_int batch_count,
+                                                 T* work)
+{
+    ROCSOLVER_ENTER("csrrf_refactqr", "m:", m, "n:", n, "nnzA:", nnzA, "nnzT:", nnzT,
+                    "bc:", batch_count);
+
+    // quick return
+    if(n == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    // check state of rfinfo
+    if(!rfinfo->analyzed || rfinfo->analyzed_mode != rocsolver_rfinfo_mode_qr
+       || rfinfo->mode != rocsolver_rfinfo_mode_qr || rfinfo->analyzed_m != m
+       || rfinfo->analyzed_n != n || rfinfo->analyzed_nnzT != nnzT)
+        return rocblas_status_internal_error;
+
+    hipStream_t stream;
+    ROCBLAS_CHECK(rocblas_get_stream(handle, &stream));
+
+    // set T and w to zero
+    if(nnzT > 0)
+    {
+        rocblas_int blocksT = (nnzT - 1) / BS1 + 1;
+        ROCSOLVER_LAUNCH_KERNEL(reset_batch_info<T>, dim3(blocksT, batch_count), dim3(BS1), 0,
+                                stream, valT, strideT, nnzT, 0);
+    }
+    HIP_CHECK(hipMemsetAsync(work, 0, sizeof(T) * n * batch_count, stream));
+
+    // rotate the rows of A(:, Q) into R
+    // (the pattern of the rows of R, given by rfinfo, holds all the fill-in)
+    ROCSOLVER_LAUNCH_KERNEL(rf_givens_qr_kernel<T>, dim3(1, batch_count), dim3(BS1), 0, stream, m,
+                            n, ptrA, indA, valA, strideA, rfinfo->ptrR, rfinfo->colR, rfinfo->posR,
+                            rfinfo->parentR, rfinfo->invQ, valT, strideT, work);
+
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
@@ -0,0 +1,184 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#ifdef HAVE_ROCSPARSE
+#include "rocrefact_csrrf_refactsolve.hpp"
+#endif
+
+#include "rocblas.hpp"
+#include "rocsolver/rocsolver.h"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+template <typename T, typename U>
+rocblas_status rocsolver_csrrf_refactsolve_impl(rocblas_handle handle,
+                                                const rocblas_int n,
+                                                const rocblas_int nrhs,
+                                                const rocblas_int nnzA,
+                                                rocblas_int* ptrA,
+                                                rocblas_int* indA,
+                                                U valA,
+                                                const rocblas_int nnzT,
+                                                rocblas_int* ptrT,
+                                                rocblas_int* indT,
+                                                U valT,
+                                                rocblas_int* pivP,
+                                                rocblas_int* pivQ,
+                                                U B,
+                                                const rocblas_int ldb,
+                                                rocsolver_rfinfo rfinfo)
+{
+    ROCSOLVER_ENTER_TOP("csrrf_refactsolve", "-n", n, "--nrhs", nrhs, "--nnzA", nnzA, "--nnzT",
+                        nnzT, "--ldb", ldb);
+
+#ifdef HAVE_ROCSPARSE
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_csrrf_refactsolve_argCheck(handle, n, nrhs, nnzA, ptrA, indA,
+                                                             valA, nnzT, ptrT, indT, valT, pivP,
+                                                             pivQ, B, ldb, rfinfo);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // memory workspace sizes:
+    // size for temp buffer in refactlu/refactchol and solve calls
+    size_t size_work = 0;
+    // constants in rocblas calls (only whether they are needed, see set_device_scalars)
+    size_t size_scalars;
+    // size of reusable workspace (for calling POTRF and TRSM in the supernodal factorization)
+    bool optim_mem;
+    size_t size_work1, size_work2, size_work3, size_work4;
+    // extra requirements for calling POTRF
+    size_t size_pivots, size_iinfo;
+    // size for the dense panels of the supernodes
+    size_t size_panel;
+    // size for the permuted right-hand sides
+    size_t size_temp;
+    // size for the iterative refinement in mixed precision
+    size_t size_refine;
+
+    rocsolver_csrrf_refactsolve_getMemorySize<T>(
+        n, nrhs, nnzT, ptrT, indT, valT, B, ldb, rfinfo, &size_work, &size_scalars, &size_work1,
+        &size_work2, &size_work3, &size_work4, &size_pivots, &size_iinfo, &size_panel, &size_temp,
+        &size_refine, &optim_mem);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_work, size_t(0), size_work1,
+                                                      size_work2, size_work3, size_work4,
+                                                      size_pivots, size_iinfo, size_panel,
+                                                      size_temp, size_refine);
+
+    // memory workspace allocation
+    void *work, *scalars, *work1, *work2, *work3, *work4, *pivots, *iinfo, *panel, *temp, *refine;
+    rocblas_device_malloc mem(handle, size_work, size_t(0), size_work1, size_work2, size_work3,
+                              size_work4, size_pivots, size_iinfo, size_panel, size_temp,
+                              size_refine);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    work = mem[0];
+    scalars = mem[1];
+    work1 = mem[2];
+    work2 = mem[3];
+    work3 = mem[4];
+    work4 = mem[5];
+    pivots = mem[6];
+    iinfo = mem[7];
+    panel = mem[8];
+    temp = mem[9];
+    refine = mem[10];
+    if(size_scalars > 0)
+        ROCBLAS_CHECK(set_device_scalars<T>(scalars));
+
+    // execution
+    return rocsolver_csrrf_refactsolve_template<T>(
+        handle, n, nrhs, nnzA, ptrA, indA, valA, nnzT, ptrT, indT, valT, pivP, pivQ, B, ldb,
+        rfinfo, work, (T*)scalars, work1, work2, work3, work4, (T*)pivots, (rocblas_int*)iinfo,
+        (T*)panel, (T*)temp, refine, optim_mem);
+#else
+    return rocblas_status_not_implemented;
+#endif
+}
+
+ROCSOLVER_END_NAMESPACE
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_scsrrf_refactsolve(rocblas_handle handle,
+                                            const rocblas_int n,
+                                            const rocblas_int nrhs,
+                                            const rocblas_int nnzA,
+                                            rocblas_int* ptrA,
+                                            rocblas_int* indA,
+                                            float* valA,
+                                            const rocblas_int nnzT,
+                                            rocblas_int* ptrT,
+                                            rocblas_int* indT,
+                                            float* valT,
+                                            rocblas_int* pivP,
+                                            rocblas_int* pivQ,
+                                            float* B,
+                                            const rocblas_int ldb,
+                                            rocsolver_rfinfo rfinfo)
+{
+    return rocsolver::rocsolver_csrrf_refactsolve_impl<float>(handle, n, nrhs, nnzA, ptrA, indA,
+                                                              valA, nnzT, ptrT, indT, valT, pivP,
+                                                              pivQ, B, ldb, rfinfo);
+}
+
+rocblas_status rocsolver_dcsrrf_refactsolve(rocblas_handle handle,
+                                            const rocblas_int n,
+                                            const rocblas_int nrhs,
+                                            const rocblas_int nnzA,
+                                            rocblas_int* ptrA,
+                                            rocblas_int* indA,
+                                            double* valA,
+                                            const rocblas_int nnzT,
+                                            rocblas_int* ptrT,
+                                            rocblas_int* indT,
+                                            double* valT,
+                                            rocblas_int* pivP,
+                                            rocblas_int* pivQ,
+                                            double* B,
+                                            const rocblas_int ldb,
+                                            rocsolver_rfinfo rfinfo)
+{
+    return rocsolver::rocsolver_csrrf_refactsolve_impl<double>(handle, n, nrhs, nnzA, ptrA, indA,
+                                                               valA, nnzT, ptrT, indT, valT, pivP,
+                                                               pivQ, B, ldb, rfinfo);
+}
+
+} // extern C
@@ -0,0 +1,184 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "rocsolver/rocsolver.h"
+#include "rocsolver_rfinfo.hpp"
+#include "rocsparse.hpp"
+
+#include "rocrefact_csrrf_refactchol.hpp"
+#include "rocrefact_csrrf_refactlu.hpp"
+#include "rocrefact_csrrf_solve.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+template <typename T>
+rocblas_status rocsolver_csrrf_refactsolve_argCheck(rocblas_handle handle,
+                                                    const rocblas_int n,
+                                                    const rocblas_int nrhs,
+                                                    const rocblas_int nnzA,
+                                                    rocblas_int* ptrA,
+                                                    rocblas_int* indA,
+                                                    T valA,
+                                                    const rocblas_int nnzT,
+                                                    rocblas_int* ptrT,
+                                                    rocblas_int* indT,
+                                                    T valT,
+                                                    rocblas_int* pivP,
+                                                    rocblas_int* pivQ,
+                                                    T B,
+                                                    const rocblas_int ldb,
+                                                    rocsolver_rfinfo rfinfo)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    if(n < 0 || nrhs < 0 || nnzA < 0 || nnzT < 0 || ldb < n)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if(!rfinfo || !ptrA || !ptrT || (nnzA && (!indA || !valA)) || (nnzT && (!indT || !valT))
+       || (nrhs * n && !B))
+        return rocblas_status_invalid_pointer;
+    if(n && ((rfinfo->mode == rocsolver_rfinfo_mode_lu && !pivP) || !pivQ))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T, typename U>
+void rocsolver_csrrf_refactsolve_getMemorySize(const rocblas_int n,
+                                               const rocblas_int nrhs,
+                                               const rocblas_int nnzT,
+                                               rocblas_int* ptrT,
+                                               rocblas_int* indT,
+                                               U valT,
+                                               U B,
+                                               const rocblas_int ldb,
+                                               rocsolver_rfinfo rfinfo,
+                                               size_t* size_work,
+                                               size_t* size_scalars,
+                                               size_t* size_work1,
+                                               size_t* size_work2,
+                                               size_t* size_work3,
+                                               size_t* size_work4,
+                                               size_t* size_pivots,
+                                               size_t* size_iinfo,
+                                               size_t* size_panel,
+                                               size_t* size_temp,
+                                               size_t* size_refine,
+                                               bool* optim_mem)
+{
+    // requirements for the re-factorization
+    size_t size_refact;
+    if(rfinfo->mode == rocsolver_rfinfo_mode_lu)
+    {
+        *size_scalars = 0;
+        *size_pivots = 0;
+        *size_iinfo = 0;
+        rocsolver_csrrf_refactlu_getMemorySize<T>(n, nnzT, ptrT, indT, valT, rfinfo, 1,
+                                                  &size_refact, size_work1, size_work2,
+                                                  size_work3, size_work4, size_panel, optim_mem);
+    }
+    else
+        rocsolver_csrrf_refactchol_getMemorySize<T>(
+            n, nnzT, ptrT, indT, valT, rfinfo, 1, &size_refact, size_scalars, size_work1,
+            size_work2, size_work3, size_work4, size_pivots, size_iinfo, size_panel, optim_mem);
+
+    // requirements for the solve
+    size_t size_solve;
+    rocsolver_csrrf_solve_getMemorySize<T>(n, nrhs, nnzT, ptrT, indT, valT, B, ldb, rfinfo, 1,
+                                           &size_solve, size_temp, size_refine);
+
+    // (the re-factorization and the solve are executed one after the other,
+    // they can share the same temp buffer)
+    *size_work = std::max(size_refact, size_solve);
+}
+
+template <typename T, typename U>
+rocblas_status rocsolver_csrrf_refactsolve_template(rocblas_handle handle,
+                                                    const rocblas_int n,
+                                                    const rocblas_int nrhs,
+                                                    const rocblas_int nnzA,
+                                                    rocblas_int* ptrA,
+                                                    rocblas_int* indA,
+                                                    U valA,
+                                                    const rocblas_int nnzT,
+                                                    rocblas_int* ptrT,
+                                                    rocblas_int* indT,
+                                                    U valT,
+                                                    rocblas_int* pivP,
+                                                    rocblas_int* pivQ,
+                                                    U B,
+                                                    const rocblas_int ldb,
+                                                    rocsolver_rfinfo rfinfo,
+                                                    void* work,
+                                                    T* scalars,
+                                                    void* work1,
+                                                    void* work2,
+                                                    void* work3,
+                                                    void* work4,
+                                                    T* pivots,
+                                                    rocblas_int* iinfo,
+                                                    T* panel,
+                                                    T* temp,
+                                                    void* refine,
+                                                    const bool optim_mem)
+{
+    ROCSOLVER_ENTER("csrrf_refactsolve", "n:", n, "nrhs:", nrhs, "nnzA:", nnzA, "nnzT:", nnzT,
+                    "ldb:", ldb);
+
+    // quick return
+    if(n == 0)
+        return rocblas_status_success;
+
+    // re-factorize T with the values of the new matrix A
+    if(rfinfo->mode == rocsolver_rfinfo_mode_lu)
+        ROCBLAS_CHECK(rocsolver_csrrf_refactlu_template<T>(
+            handle, n, nnzA, ptrA, indA, valA, 0, nnzT, ptrT, indT, valT, 0, pivP, pivQ, rfinfo, 1,
+            work, work1, work2, work3, work4, panel, optim_mem));
+    else
+        ROCBLAS_CHECK(rocsolver_csrrf_refactchol_template<T>(
+            handle, n, nnzA, ptrA, indA, valA, 0, nnzT, ptrT, indT, valT, 0, pivQ, rfinfo, 1, work,
+            scalars, work1, work2, work3, work4, pivots, iinfo, panel, optim_mem));
+
+    // solve with the new factors
+    // (T holds both factors, so no intermediate splitting is necessary)
+    return rocsolver_csrrf_solve_template<T>(handle, n, nrhs, nnzT, ptrT, indT, valT, 0, pivP,
+                                             pivQ, B, ldb, 0, rfinfo, 1, work, temp, refine);
+}
+
+ROCSOLVER_END_NAMESPACE
@@ -0,0 +1,102 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "rocrefact_csrrf_reorder.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+template <typename I>
+rocblas_status rocsolver_csrrf_reorder_impl(rocblas_handle handle,
+                                            const I n,
+                                            const I nnzM,
+                                            I* ptrM,
+                                            I* indM,
+                                            I* perm)
+{
+    ROCSOLVER_ENTER_TOP("csrrf_reorder", "-n", n, "--nnzM", nnzM);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_csrrf_reorder_argCheck(handle, n, nnzM, ptrM, indM, perm);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // memory workspace sizes:
+    // size for the graph of M + M^T and the state of the breadth-first search
+    size_t size_work = 0;
+    // size for the sorting keys of the levels
+    size_t size_keys = 0;
+    // size for the temporary storage of rocprim
+    size_t size_temp = 0;
+
+    ROCBLAS_CHECK(
+        rocsolver_csrrf_reorder_getMemorySize(n, nnzM, &size_work, &size_keys, &size_temp));
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_work, size_keys, size_temp);
+
+    // memory workspace allocation
+    void *work, *keys, *temp;
+    rocblas_device_malloc mem(handle, size_work, size_keys, size_temp);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    work = mem[0];
+    keys = mem[1];
+    temp = mem[2];
+
+    // execution
+    return rocsolver_csrrf_reorder_template(handle, n, nnzM, ptrM, indM, perm,
+                                            static_cast<I*>(work),
+                                            static_cast<unsigned long long*>(keys), temp,
+                                            size_temp);
+}
+
+ROCSOLVER_END_NAMESPACE
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_csrrf_reorder(rocblas_handle handle,
+                                       const rocblas_int n,
+                                       const rocblas_int nnzM,
+                                       rocblas_int* ptrM,
+                                       rocblas_int* indM,
+                                       rocblas_int* perm)
+{
+    return rocsolver::rocsolver_csrrf_reorder_impl<rocblas_int>(handle, n, nnzM, ptrM, indM, perm);
+}
+
+} // extern C
@@ -0,0 +1,364 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <climits>
+#include <rocprim/rocprim.hpp>
+
+#include "rocblas.hpp"
+#include "rocsolver/rocsolver.h"
+#include "rocsolver_stats.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/** RF_REORDER_COUNT_KERNEL counts the number of non-zero elements in every column of M.
+    (The counts are accumulated in cnt, which must be zero on entry) **/
+template <typename I>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1)
+    rf_reorder_count_kernel(const I nnzM, I const* const __restrict__ indM, I* const cnt)
+{
+    const I k = hipBlockIdx_x * static_cast<I>(BS1) + hipThreadIdx_x;
+    if(k < nnzM)
+        atomicAdd(cnt + indM[k], 1);
+}
+
+/** RF_REORDER_TRANSPOSE_KERNEL writes the sparsity pattern of the transpose of M, given the
+    positions of its rows in ptrMT, and computes the degrees of the nodes of the graph of
+    M + M^T. (One thread per row of M; the indices of the rows of M^T come out in no particular
+    order, which is fine for the breadth-first search. pos must be zero on entry) **/
+template <typename I>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1)
+    rf_reorder_transpose_kernel(const I n,
+                                I const* const __restrict__ ptrM,
+                                I const* const __restrict__ indM,
+                                I const* const __restrict__ ptrMT,
+                                I* const __restrict__ indMT,
+                                I* const pos,
+                                I* const __restrict__ deg)
+{
+    const I i = hipBlockIdx_x * static_cast<I>(BS1) + hipThreadIdx_x;
+    if(i < n)
+    {
+        for(I k = ptrM[i]; k < ptrM[i + 1]; ++k)
+        {
+            const I j = indM[k];
+            indMT[ptrMT[j] + atomicAdd(pos + j, 1)] = i;
+        }
+        deg[i] = (ptrM[i + 1] - ptrM[i]) + (ptrMT[i + 1] - ptrMT[i]);
+    }
+}
+
+/** RF_REORDER_SEED_KERNEL finds the node of minimum degree (the one with the smallest index
+    in case of a tie) among the nodes that have not been labeled yet. The result is packed as
+    (degree, node) in seed, which must be set to ULLONG_MAX on entry. **/
+template <typename I>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1)
+    rf_reorder_seed_kernel(const I n,
+                           I const* const __restrict__ deg,
+                           I const* const __restrict__ label,
+                           unsigned long long* const seed)
+{
+    const I i = hipBlockIdx_x * static_cast<I>(BS1) + hipThreadIdx_x;
+    if(i < n && label[i] < 0)
+        atomicMin(seed, (static_cast<unsigned long long>(deg[i]) << 32) | i);
+}
+
+/** RF_REORDER_START_KERNEL labels the node found by rf_reorder_seed_kernel as the first one
+    of a new connected component. **/
+template <typename I>
+ROCSOLVER_KERNEL void rf_reorder_start_kernel(const I labeled,
+                                              unsigned long long const* const seed,
+                                              I* const __restrict__ label,
+                                              I* const __restrict__ order)
+{
+    const I i = static_cast<I>(*seed & 0xffffffffULL);
+    label[i] = labeled;
+    order[labeled] = i;
+}
+
+/** RF_REORDER_EXPAND_KERNEL visits the neighbors of the nodes in the current level
+    order[s:e-1]. Every unlabeled neighbor v keeps in claim[v] the smallest label of the nodes
+    of the level adjacent to it, and the first thread that reaches v appends it to next.
+    (One thread per node in the level. claim must be INT_MAX for all the unlabeled nodes) **/
+template <typename I>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1)
+    rf_reorder_expand_kernel(const I s,
+                             const I e,
+                             I const* const __restrict__ ptrM,
+                             I const* const __restrict__ indM,
+                             I const* const __restrict__ ptrMT,
+                             I const* const __restrict__ indMT,
+                             I const* const __restrict__ order,
+                             I const* const label,
+                             I* const claim,
+                             I* const next,
+                             I* const count)
+{
+    const I t = s + hipBlockIdx_x * static_cast<I>(BS1) + hipThreadIdx_x;
+    if(t < e)
+    {
+        const I u = order[t];
+        const I lu = label[u];
+
+        for(int pass = 0; pass < 2; ++pass)
+        {
+            I const* const ptr = (pass == 0) ? ptrM : ptrMT;
+            I const* const ind = (pass == 0) ? indM : indMT;
+            for(I k = ptr[u]; k < ptr[u + 1]; ++k)
+            {
+                const I v = ind[k];
+                if(label[v] < 0 && atomicMin(claim + v, lu) == INT_MAX)
+                    next[atomicAdd(count, 1)] = v;
+            }
+        }
+    }
+}
+
+/** RF_REORDER_KEYS_KERNEL packs (claim, degree) as the sorting key of every node in next, so
+    that the nodes of the new level are ordered as in the sequential Cuthill-McKee algorithm:
+    by the label of their first labeled neighbor and then by increasing degree. **/
+template <typename I>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1)
+    rf_reorder_keys_kernel(const I cnt,
+                           I const* const __restrict__ next,
+                           I const* const __restrict__ claim,
+                           I const* const __restrict__ deg,
+                           unsigned long long* const __restrict__ keys)
+{
+    const I t = hipBlockIdx_x * static_cast<I>(BS1) + hipThreadIdx_x;
+    if(t < cnt)
+    {
+        const I v = next[t];
+        keys[t] = (static_cast<unsigned long long>(claim[v]) << 32) | deg[v];
+    }
+}
+
+/** RF_REORDER_LABEL_KERNEL labels the nodes of the new level order[e:e+cnt-1]. **/
+template <typename I>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1)
+    rf_reorder_label_kernel(const I e,
+                            const I cnt,
+                            I const* const __restrict__ order,
+                            I* const __restrict__ label)
+{
+    const I t = hipBlockIdx_x * static_cast<I>(BS1) + hipThreadIdx_x;
+    if(t < cnt)
+        label[order[e + t]] = e + t;
+}
+
+/** RF_REORDER_REVERSE_KERNEL writes the reversed Cuthill-McKee order into perm. **/
+template <typename I>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1)
+    rf_reorder_reverse_kernel(const I n,
+                              I const* const __restrict__ order,
+                              I* const __restrict__ perm)
+{
+    const I k = hipBlockIdx_x * static_cast<I>(BS1) + hipThreadIdx_x;
+    if(k < n)
+        perm[n - 1 - k] = order[k];
+}
+
+template <typename I>
+rocblas_status rocsolver_csrrf_reorder_getMemorySize(const I n,
+                                                     const I nnzM,
+                                                     size_t* size_work,
+                                                     size_t* size_keys,
+                                                     size_t* size_temp)
+{
+    // if quick return, no need of workspace
+    if(n == 0)
+    {
+        *size_work = 0;
+        *size_keys = 0;
+        *size_temp = 0;
+        return rocblas_status_success;
+    }
+
+    // ptrMT, indMT, positions, degrees, labels, claims, order, next level and its counter
+    *size_work = sizeof(I) * (7 * size_t(n) + 2 + nnzM);
+
+    // sorting keys of the next level (before and after the sort) and the seed
+    *size_keys = sizeof(unsigned long long) * (2 * size_t(n) + 1);
+
+    // temporary storage of the prefix sum and the radix sort
+    size_t scan_bytes = 0, sort_bytes = 0;
+    I* iptr = nullptr;
+    unsigned long long* kptr = nullptr;
+    HIP_CHECK(rocprim::inclusive_scan(nullptr, scan_bytes, iptr, iptr, n, rocprim::plus<I>()));
+    HIP_CHECK(rocprim::radix_sort_pairs(nullptr, sort_bytes, kptr, kptr, iptr, iptr, n));
+    *size_temp = std::max(scan_bytes, sort_bytes);
+
+    return rocblas_status_success;
+}
+
+template <typename I>
+rocblas_status rocsolver_csrrf_reorder_argCheck(rocblas_handle handle,
+                                                const I n,
+                                                const I nnzM,
+                                                I* ptrM,
+                                                I* indM,
+                                                I* perm)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+    if(handle == nullptr)
+    {
+        return rocblas_status_invalid_handle;
+    }
+
+    // 2. invalid size
+    if(n < 0 || nnzM < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if(!ptrM || (nnzM && !indM) || (n && !perm))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename I>
+rocblas_status rocsolver_csrrf_reorder_template(rocblas_handle handle,
+                                                const I n,
+                                                const I nnzM,
+                                                I* ptrM,
+                                                I* indM,
+                                                I* perm,
+                                                I* work,
+                                                unsigned long long* keys,
+                                                void* temp,
+                                                size_t size_temp)
+{
+    ROCSOLVER_ENTER("csrrf_reorder", "n:", n, "nnzM:", nnzM);
+
+    // quick return
+    if(n == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    ROCBLAS_CHECK(rocblas_get_stream(handle, &stream));
+
+    I* ptrMT = work;
+    I* pos = ptrMT + (n + 1);
+    I* deg = pos + n;
+    I* label = deg + n;
+    I* claim = label + n;
+    I* order = claim + n;
+    I* next = order + n;
+    I* count = next + n;
+    I* indMT = count + 1;
+    unsigned long long* keys_out = keys + n;
+    unsigned long long* seed = keys_out + n;
+
+    const I blocksN = (n - 1) / BS1 + 1;
+
+    // -------------------------------------------------------------
+    // the graph of M + M^T is given by the rows of M and the rows of M^T;
+    // the latter are obtained by a counting sort of the entries by column
+    // -------------------------------------------------------------
+    HIP_CHECK(hipMemsetAsync(pos, 0, sizeof(I) * n, stream));
+    HIP_CHECK(hipMemsetAsync(ptrMT, 0, sizeof(I), stream));
+    if(nnzM > 0)
+        ROCSOLVER_LAUNCH_KERNEL(rf_reorder_count_kernel<I>, dim3((nnzM - 1) / BS1 + 1),
+                                dim3(BS1), 0, stream, nnzM, indM, pos);
+    {
+        size_t storage_size_bytes = size_temp;
+        HIP_CHECK(rocprim::inclusive_scan(temp, storage_size_bytes, pos, ptrMT + 1, n,
+                                          rocprim::plus<I>(), stream));
+    }
+    HIP_CHECK(hipMemsetAsync(pos, 0, sizeof(I) * n, stream));
+    ROCSOLVER_LAUNCH_KERNEL(rf_reorder_transpose_kernel<I>, dim3(blocksN), dim3(BS1), 0, stream,
+                            n, ptrM, indM, ptrMT, indMT, pos, deg);
+
+    // all the nodes are unlabeled and unclaimed
+    // (0xff bytes give -1, and 0x7f bytes give INT_MAX)
+    HIP_CHECK(hipMemsetAsync(label, 0xff, sizeof(I) * n, stream));
+    HIP_CHECK(hipMemsetAsync(claim, 0x7f, sizeof(I) * n, stream));
+
+    // -------------------------------------------------------------
+    // level-synchronous breadth-first search: the nodes of every level are found by a
+    // single kernel and sorted as in the sequential Cuthill-McKee algorithm; only the size
+    // of the level is read back by the host. Each connected component starts from its
+    // unlabeled node of minimum degree.
+    // -------------------------------------------------------------
+    I labeled = 0;
+    while(labeled < n)
+    {
+        HIP_CHECK(hipMemsetAsync(seed, 0xff, sizeof(unsigned long long), stream));
+        ROCSOLVER_LAUNCH_KERNEL(rf_reorder_seed_kernel<I>, dim3(blocksN), dim3(BS1), 0, stream,
+                                n, deg, label, seed);
+        ROCSOLVER_LAUNCH_KERNEL(rf_reorder_start_kernel<I>, dim3(1), dim3(1), 0, stream, labeled,
+                                seed, label, order);
+
+        I s = labeled;
+        I e = labeled + 1;
+        while(s < e)
+        {
+            I cnt = 0;
+            HIP_CHECK(hipMemsetAsync(count, 0, sizeof(I), stream));
+            ROCSOLVER_LAUNCH_KERNEL(rf_reorder_expand_kernel<I>, dim3((e - s - 1) / BS1 + 1),
+                                    dim3(BS1), 0, stream, s, e, ptrM, indM, ptrMT, indMT, order,
+                                    label, claim, next, count);
+            HIP_CHECK(hipMemcpyAsync(&cnt, count, sizeof(I), hipMemcpyDeviceToHost, stream));
+            rocsolver_stats_host_sync();
+            HIP_CHECK(hipStreamSynchronize(stream));
+            if(cnt == 0)
+                break;
+
+            const I blocksC = (cnt - 1) / BS1 + 1;
+            ROCSOLVER_LAUNCH_KERNEL(rf_reorder_keys_kernel<I>, dim3(blocksC), dim3(BS1), 0,
+                                    stream, cnt, next, claim, deg, keys);
+            {
+                size_t storage_size_bytes = size_temp;
+                HIP_CHECK(rocprim::radix_sort_pairs(temp, storage_size_bytes, keys, keys_out,
+                                                    next, order + e, cnt, 0,
+                                                    8 * sizeof(unsigned long long), stream));
+            }
+            ROCSOLVER_LAUNCH_KERNEL(rf_reorder_label_kernel<I>, dim3(blocksC), dim3(BS1), 0,
+                                    stream, e, cnt, order, label);
+
+            s = e;
+            e += cnt;
+        }
+        labeled = e;
+    }
+
+    ROCSOLVER_LAUNCH_KERNEL(rf_reorder_reverse_kernel<I>, dim3(blocksN), dim3(BS1), 0, stream, n,
+                            order, perm);
+
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
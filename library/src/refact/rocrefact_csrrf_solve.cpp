@@ -60,35 +60,40 @@ rocblas_status rocsolver_csrrf_solve_impl(rocblas_handle handle,
     if(st != rocblas_status_continue)
         return st;
 
-    // TODO: add batched versions
     // working with unshifted arrays
     // normal (non-batched non-strided) execution
+    rocblas_stride strideT = 0;
+    rocblas_stride strideB = 0;
+    rocblas_int batch_count = 1;
 
     // memory workspace sizes:
     // size for temp buffer in solve calls
     size_t size_work = 0;
     size_t size_temp = 0;
+    // size for the iterative refinement in mixed precision
+    size_t size_refine = 0;
 
     rocsolver_csrrf_solve_getMemorySize<T>(n, nrhs, nnzT, ptrT, indT, valT, B, ldb, rfinfo,
-                                           &size_work, &size_temp);
+                                           batch_count, &size_work, &size_temp, &size_refine);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_work, size_temp);
+        return rocblas_set_optimal_device_memory_size(handle, size_work, size_temp, size_refine);
 
     // memory workspace allocation
-    void* work = nullptr;
-    void* temp = nullptr;
-    rocblas_device_malloc mem(handle, size_work, size_temp);
+    void *work = nullptr, *temp = nullptr, *refine = nullptr;
+    rocblas_device_malloc mem(handle, size_work, size_temp, size_refine);
 
     if(!mem)
         return rocblas_status_memory_error;
 
     work = mem[0];
     temp = mem[1];
+    refine = mem[2];
 
     // execution
-    return rocsolver_csrrf_solve_template<T>(handle, n, nrhs, nnzT, ptrT, indT, valT, pivP, pivQ, B,
-                                             ldb, rfinfo, work, static_cast<T*>(temp));
+    return rocsolver_csrrf_solve_template<T>(handle, n, nrhs, nnzT, ptrT, indT, valT, strideT, pivP,
+                                             pivQ, B, ldb, strideB, rfinfo, batch_count, work,
+                                             static_cast<T*>(temp), refine);
 #else
     return rocblas_status_not_implemented;
 #endif
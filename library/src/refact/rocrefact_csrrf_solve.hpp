@@ -32,27 +32,34 @@
 #include "rocsolver_rfinfo.hpp"
 #include "rocsparse.hpp"
 
+#include "refact_helpers.hpp"
+
 ROCSOLVER_BEGIN_NAMESPACE
 
 /**************** Solver Kernels and methods *********************/
 // ---------------------
 // gather operation
 // temp[i,*] = src[P[i],*]
-// src <-- temp
+// (one thread per row; the rows of all the instances in the batch are processed
+// by a single grid)
 // ---------------------
 template <typename T>
 ROCSOLVER_KERNEL void rf_gather_kernel(const rocblas_int n,
                                        const rocblas_int nrhs,
                                        const rocblas_int* P,
-                                       T* src,
+                                       T* srcA,
                                        const rocblas_int lds,
-                                       T* temp)
+                                       const rocblas_stride strideS,
+                                       T* tempA)
 {
-    rocblas_int tid = hipThreadIdx_x;
+    rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocblas_int bid = hipBlockIdx_y;
 
-    // execute permutations
-    for(size_t i = tid; i < n; i += hipBlockDim_x)
+    if(i < n)
     {
+        T* src = srcA + bid * strideS;
+        T* temp = tempA + size_t(bid) * n * nrhs;
+
         const rocblas_int ip = P[i];
         const bool is_valid = (0 <= ip) && (ip < n);
         if(is_valid)
@@ -61,49 +68,273 @@ ROCSOLVER_KERNEL void rf_gather_kernel(const rocblas_int n,
                 temp[i + j * n] = src[ip + j * lds];
         }
     }
-    __syncthreads();
-
-    // overwrite results
-    for(size_t i = tid; i < n; i += hipBlockDim_x)
-    {
-        for(size_t j = 0; j < nrhs; ++j)
-            src[i + j * lds] = temp[i + j * n];
-    }
 }
 
 // ---------------------
 // scatter operation
-// temp[P[i],*] = src[i,*]
-// src <-- temp
+// dst[P[i],*] = temp[i,*]
+// (one thread per row; the rows of all the instances in the batch are processed
+// by a single grid)
 // ---------------------
 template <typename T>
 ROCSOLVER_KERNEL void rf_scatter_kernel(const rocblas_int n,
                                         const rocblas_int nrhs,
                                         const rocblas_int* P,
-                                        T* src,
-                                        const rocblas_int lds,
-                                        T* temp)
+                                        T* tempA,
+                                        T* dstA,
+                                        const rocblas_int ldd,
+                                        const rocblas_stride strideD)
 {
-    rocblas_int tid = hipThreadIdx_x;
+    rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocblas_int bid = hipBlockIdx_y;
 
-    // execute permutations
-    for(size_t i = tid; i < n; i += hipBlockDim_x)
+    if(i < n)
     {
+        T* temp = tempA + size_t(bid) * n * nrhs;
+        T* dst = dstA + bid * strideD;
+
         const rocblas_int ip = P[i];
         const bool is_valid = (0 <= ip) && (ip < n);
         if(is_valid)
         {
             for(size_t j = 0; j < nrhs; ++j)
-                temp[ip + j * n] = src[i + j * lds];
+                dst[ip + j * ldd] = temp[i + j * n];
         }
     }
-    __syncthreads();
+}
 
-    // overwrite results
-    for(size_t i = tid; i < n; i += hipBlockDim_x)
+// -------------------------------------------
+// Level-scheduled solve of (L * U) * Xhat = Bhat
+//
+// Every wavefront takes a ticket from a counter: tickets 0 to n-1 are the rows of L and
+// tickets n to 2n-1 the rows of U, in the order given by their level sets. A row waits until
+// the rows on which it depends are solved (these always have smaller tickets, and thus
+// belong to wavefronts that are already running), computes its entries of the solution,
+// and marks itself as done.
+// Bhat is read from (and Y is written to) temp, and X is written to B, already reordered
+// by Q. The flags of each instance (2n done flags and the ticket counter) must be zero on entry.
+// The factors can be stored in a lower precision S; the solve is computed in precision T.
+// -------------------------------------------
+template <typename T, typename S = T>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) rf_levels_solve_kernel(const rocblas_int n,
+                                                                    const rocblas_int nrhs,
+                                                                    const rocblas_int* ptrL,
+                                                                    const rocblas_int* colL,
+                                                                    const rocblas_int* mapL,
+                                                                    const rocblas_int* diagL,
+                                                                    const rocblas_int* ordL,
+                                                                    const rocblas_int* ptrU,
+                                                                    const rocblas_int* colU,
+                                                                    const rocblas_int* mapU,
+                                                                    const rocblas_int* diagU,
+                                                                    const rocblas_int* ordU,
+                                                                    S* valTA,
+                                                                    const rocblas_stride strideT,
+                                                                    const rocblas_int* Q,
+                                                                    T* tempA,
+                                                                    T* BA,
+                                                                    const rocblas_int ldb,
+                                                                    const rocblas_stride strideB,
+                                                                    rocblas_int* flagsA)
+{
+    rocblas_int lane = hipThreadIdx_x % warpSize;
+    rocblas_int bid = hipBlockIdx_y;
+
+    S* valT = valTA + bid * strideT;
+    T* temp = tempA + size_t(bid) * n * nrhs;
+    T* B = BA + bid * strideB;
+    rocblas_int* done = flagsA + size_t(bid) * (2 * n + 1);
+    rocblas_int* ticket = done + 2 * n;
+
+    // get the next row to solve
+    rocblas_int task = 0;
+    if(lane == 0)
+        task = atomicAdd(ticket, 1);
+    task = __shfl(task, 0);
+    if(task >= 2 * n)
+        return;
+
+    const bool lower = (task < n);
+    const rocblas_int i = lower ? ordL[task] : ordU[task - n];
+    const rocblas_int* ptr = lower ? ptrL : ptrU;
+    const rocblas_int* col = lower ? colL : colU;
+    const rocblas_int* map = lower ? mapL : mapU;
+    const rocblas_int dpos = lower ? diagL[i] : diagU[i];
+    rocblas_int* rdone = lower ? done : done + n;
+
+    // wait for the rows on which row i depends
+    // (and, in the upper solve, for the lower solve of row i)
+    for(rocblas_int k = ptr[i] + lane; k < ptr[i + 1]; k += warpSize)
+    {
+        while(__hip_atomic_load(rdone + col[k], __ATOMIC_RELAXED, __HIP_MEMORY_SCOPE_AGENT) == 0)
+            ;
+    }
+    if(!lower && lane == 0)
+    {
+        while(__hip_atomic_load(done + i, __ATOMIC_RELAXED, __HIP_MEMORY_SCOPE_AGENT) == 0)
+            ;
+    }
+    __threadfence();
+
+    const T d = (dpos < 0) ? T(1) : T(valT[dpos]);
+    for(rocblas_int j = 0; j < nrhs; ++j)
     {
-        for(size_t j = 0; j < nrhs; ++j)
-            src[i + j * lds] = temp[i + j * n];
+        // dot product of row i with the solved entries
+        T sum = 0;
+        for(rocblas_int k = ptr[i] + lane; k < ptr[i + 1]; k += warpSize)
+        {
+            rocblas_int c = col[k];
+            sum += T(valT[map[k]]) * (lower ? temp[c + j * n] : B[Q[c] + j * ldb]);
+        }
+        for(int offset = warpSize / 2; offset > 0; offset /= 2)
+            sum += __shfl_down(sum, offset);
+
+        if(lane == 0)
+        {
+            T x = (temp[i + j * n] - sum) / d;
+            if(lower)
+                temp[i + j * n] = x;
+            else
+                B[Q[i] + j * ldb] = x;
+        }
+    }
+
+    // make the results visible before marking the row as done
+    __threadfence();
+    if(lane == 0)
+        __hip_atomic_store(rdone + i, 1, __ATOMIC_RELAXED, __HIP_MEMORY_SCOPE_AGENT);
+}
+
+// -------------------------------------------
+// Kernels of the iterative refinement (in mixed precision, or after static pivoting),
+// with the re-ordered matrix Ahat = P * A * Q stored in valT
+// -------------------------------------------
+
+/** RF_RESIDUAL_KERNEL computes the residuals Rhat = Bhat - Ahat * Xhat, where Xhat = inv(Q) * X
+    and X is stored in B. Bhat and Rhat have leading dimension n.
+    (one thread per row; the rows of all the instances in the batch are processed
+    by a single grid) **/
+template <typename T>
+ROCSOLVER_KERNEL void rf_residual_kernel(const rocblas_int n,
+                                         const rocblas_int nrhs,
+                                         const rocblas_int* ptrT,
+                                         const rocblas_int* indT,
+                                         T* valTA,
+                                         const rocblas_stride strideT,
+                                         const rocblas_int* Q,
+                                         T* BhatA,
+                                         T* BA,
+                                         const rocblas_int ldb,
+                                         const rocblas_stride strideB,
+                                         T* RhatA)
+{
+    rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocblas_int bid = hipBlockIdx_y;
+
+    if(i < n)
+    {
+        T* valT = valTA + bid * strideT;
+        T* Bhat = BhatA + size_t(bid) * n * nrhs;
+        T* B = BA + bid * strideB;
+        T* Rhat = RhatA + size_t(bid) * n * nrhs;
+
+        for(rocblas_int j = 0; j < nrhs; ++j)
+        {
+            T r = Bhat[i + j * n];
+            for(rocblas_int k = ptrT[i]; k < ptrT[i + 1]; ++k)
+                r -= valT[k] * B[Q[indT[k]] + j * ldb];
+            Rhat[i + j * n] = r;
+        }
+    }
+}
+
+/** RF_REFINE_CHECK_KERNEL checks the convergence of the refinement, i.e. whether
+    ||Rhat_j||_inf <= ||X_j||_inf * ||A||_inf * cte for all the columns j, sets converged
+    accordingly, and counts in counter the instances that have not converged.
+    Each thread-block processes one instance of the batch. **/
+template <typename T, typename S>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) rf_refine_check_kernel(const rocblas_int n,
+                                                                    const rocblas_int nrhs,
+                                                                    T* RhatA,
+                                                                    T* BA,
+                                                                    const rocblas_int ldb,
+                                                                    const rocblas_stride strideB,
+                                                                    const S* anorm,
+                                                                    const S cte,
+                                                                    rocblas_int* converged,
+                                                                    rocblas_int* counter)
+{
+    rocblas_int tid = hipThreadIdx_x;
+    rocblas_int bid = hipBlockIdx_y;
+    T* Rhat = RhatA + size_t(bid) * n * nrhs;
+    T* B = BA + bid * strideB;
+
+    __shared__ S sx[BS1];
+    __shared__ S sr[BS1];
+
+    bool conv = true;
+    for(rocblas_int j = 0; j < nrhs && conv; ++j)
+    {
+        S xnrm = 0, rnrm = 0;
+        for(rocblas_int i = tid; i < n; i += BS1)
+        {
+            S x = std::abs(B[i + j * ldb]);
+            S r = std::abs(Rhat[i + j * n]);
+            xnrm = x > xnrm ? x : xnrm;
+            // (a NaN in the residual is not considered converged)
+            rnrm = (r > rnrm || r != r) ? r : rnrm;
+        }
+        sx[tid] = xnrm;
+        sr[tid] = rnrm;
+        __syncthreads();
+
+        for(rocblas_int i = BS1 / 2; i > 0; i /= 2)
+        {
+            if(tid < i)
+            {
+                if(sx[tid + i] > sx[tid])
+                    sx[tid] = sx[tid + i];
+                if(sr[tid + i] > sr[tid] || sr[tid + i] != sr[tid + i])
+                    sr[tid] = sr[tid + i];
+            }
+            __syncthreads();
+        }
+
+        conv = (sr[0] <= sx[0] * anorm[bid] * cte);
+        __syncthreads();
+    }
+
+    if(tid == 0)
+    {
+        converged[bid] = conv ? 1 : 0;
+        if(!conv)
+            atomicAdd(counter, 1);
+    }
+}
+
+/** RF_REFINE_UPDATE_KERNEL adds the corrections D (with leading dimension n) to the solutions X
+    stored in B, for the instances that have not converged.
+    (one thread per row; the rows of all the instances in the batch are processed
+    by a single grid) **/
+template <typename T>
+ROCSOLVER_KERNEL void rf_refine_update_kernel(const rocblas_int n,
+                                              const rocblas_int nrhs,
+                                              T* DA,
+                                              T* BA,
+                                              const rocblas_int ldb,
+                                              const rocblas_stride strideB,
+                                              const rocblas_int* converged)
+{
+    rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocblas_int bid = hipBlockIdx_y;
+
+    if(i < n && !converged[bid])
+    {
+        T* D = DA + size_t(bid) * n * nrhs;
+        T* B = BA + bid * strideB;
+
+        for(rocblas_int j = 0; j < nrhs; ++j)
+            B[i + j * ldb] += D[i + j * n];
     }
 }
 
@@ -176,6 +407,99 @@ rocblas_status rf_lusolve(rocsolver_rfinfo rfinfo,
 
 /************************************************************************/
 
+/** RF_REFINE_SOLVE solves (P * A * Q) * Xhat = Bhat, with Bhat in temp, by level-scheduled
+    solves with the factors in lowT (stored in precision S), followed by iterative refinement in
+    precision T with the matrices Ahat = P * A * Q stored in valT. X = Q * Xhat is written
+    to B. **/
+template <typename T, typename S>
+rocblas_status rf_refine_solve(hipStream_t stream,
+                               const rocblas_int n,
+                               const rocblas_int nrhs,
+                               const rocblas_int nnzT,
+                               rocblas_int* ptrT,
+                               rocblas_int* indT,
+                               T* valT,
+                               const rocblas_stride strideT,
+                               const S* lowT,
+                               const rocblas_stride strideL,
+                               rocblas_int* pivQ,
+                               T* B,
+                               const rocblas_int ldb,
+                               const rocblas_stride strideB,
+                               rocsolver_rfinfo rfinfo,
+                               const rocblas_int batch_count,
+                               rocblas_int* flags,
+                               T* temp,
+                               void* refine)
+{
+    // workspace of the refinement: copy of Bhat, corrections D, norms of the matrices,
+    // convergence flags and counter of the instances that have not converged
+    const size_t size_rhs = size_t(n) * nrhs * batch_count;
+    T* Bhat = static_cast<T*>(refine);
+    T* D = Bhat + size_rhs;
+    T* anorm = D + size_rhs;
+    rocblas_int* converged = reinterpret_cast<rocblas_int*>(anorm + batch_count);
+    rocblas_int* counter = converged + batch_count;
+
+    const size_t size_flags = sizeof(rocblas_int) * (2 * n + 1) * batch_count;
+    const T cte = get_epsilon<T>() * std::sqrt(T(n));
+
+    HIP_CHECK(hipMemcpyAsync(Bhat, temp, sizeof(T) * size_rhs, hipMemcpyDeviceToDevice, stream));
+    ROCSOLVER_LAUNCH_KERNEL((rf_norm_kernel<T, T>), dim3(1, batch_count), dim3(BS1), 0, stream,
+                            n, ptrT, valT, strideT, T(1), anorm);
+
+    // initial solution X into B
+    rocblas_int blocks = (n - 1) / BS1 + 1;
+    rocblas_int sblocks = (2 * n - 1) / (BS1 / 32) + 1;
+    HIP_CHECK(hipMemsetAsync(flags, 0, size_flags, stream));
+    ROCSOLVER_LAUNCH_KERNEL((rf_levels_solve_kernel<T, const S>), dim3(sblocks, batch_count),
+                            dim3(BS1), 0, stream, n, nrhs, rfinfo->ptrL, rfinfo->colL,
+                            rfinfo->mapL, rfinfo->diagL, rfinfo->ordL, rfinfo->ptrU, rfinfo->colU,
+                            rfinfo->mapU, rfinfo->diagU, rfinfo->ordU, lowT, strideL, pivQ, temp,
+                            B, ldb, strideB, flags);
+
+    // the refinement loop is controlled on the device (the corrections are not applied to the
+    // converged instances); the host check is only an early-exit optimization, and is not
+    // allowed while the stream is being captured into a graph
+    bool host_check = !stream_is_capturing(stream);
+
+    rocblas_int h_counter;
+    for(rocblas_int iter = 0; iter < RF_REFINE_MAX_ITERS; ++iter)
+    {
+        // compute the residuals Rhat = Bhat - Ahat * Xhat into temp, and check convergence
+        ROCSOLVER_LAUNCH_KERNEL(rf_residual_kernel<T>, dim3(blocks, batch_count), dim3(BS1), 0,
+                                stream, n, nrhs, ptrT, indT, valT, strideT, pivQ, Bhat, B, ldb,
+                                strideB, temp);
+
+        HIP_CHECK(hipMemsetAsync(counter, 0, sizeof(rocblas_int), stream));
+        ROCSOLVER_LAUNCH_KERNEL((rf_refine_check_kernel<T, T>), dim3(1, batch_count), dim3(BS1), 0,
+                                stream, n, nrhs, temp, B, ldb, strideB, anorm, cte, converged,
+                                counter);
+        if(host_check)
+        {
+            HIP_CHECK(hipMemcpyAsync(&h_counter, counter, sizeof(rocblas_int),
+                                     hipMemcpyDeviceToHost, stream));
+            rocsolver_stats_host_sync();
+            HIP_CHECK(hipStreamSynchronize(stream));
+            if(h_counter == 0)
+                break;
+        }
+
+        // solve for the corrections D = Q * inv(L * U) * Rhat, and update X
+        HIP_CHECK(hipMemsetAsync(flags, 0, size_flags, stream));
+        ROCSOLVER_LAUNCH_KERNEL((rf_levels_solve_kernel<T, const S>),
+                                dim3(sblocks, batch_count), dim3(BS1), 0, stream, n, nrhs,
+                                rfinfo->ptrL, rfinfo->colL, rfinfo->mapL, rfinfo->diagL,
+                                rfinfo->ordL, rfinfo->ptrU, rfinfo->colU, rfinfo->mapU,
+                                rfinfo->diagU, rfinfo->ordU, lowT, strideL, pivQ, temp, D, n,
+                                rocblas_stride(n) * nrhs, flags);
+        ROCSOLVER_LAUNCH_KERNEL(rf_refine_update_kernel<T>, dim3(blocks, batch_count), dim3(BS1),
+                                0, stream, n, nrhs, D, B, ldb, strideB, converged);
+    }
+
+    return rocblas_status_success;
+}
+
 /************** Argument checking and buffer size auxiliaries *************/
 template <typename T>
 rocblas_status rocsolver_csrrf_solve_argCheck(rocblas_handle handle,
@@ -189,7 +513,8 @@ rocblas_status rocsolver_csrrf_solve_argCheck(rocblas_handle handle,
                                               rocblas_int* pivQ,
                                               T B,
                                               const rocblas_int ldb,
-                                              rocsolver_rfinfo rfinfo)
+                                              rocsolver_rfinfo rfinfo,
+                                              const rocblas_int batch_count = 1)
 {
     // order is important for unit tests:
 
@@ -199,7 +524,7 @@ rocblas_status rocsolver_csrrf_solve_argCheck(rocblas_handle handle,
         return rocblas_status_invalid_handle;
 
     // 2. invalid size
-    if(n < 0 || nrhs < 0 || nnzT < 0 || ldb < n)
+    if(n < 0 || nrhs < 0 || nnzT < 0 || ldb < n || batch_count < 0)
         return rocblas_status_invalid_size;
 
     // skip pointer check if querying memory size
@@ -207,7 +532,8 @@ rocblas_status rocsolver_csrrf_solve_argCheck(rocblas_handle handle,
         return rocblas_status_continue;
 
     // 3. invalid pointers
-    if(!rfinfo || !ptrT || (nnzT && (!indT || !valT)) || (nrhs * n && !B))
+    if(!rfinfo || !ptrT || (nnzT && (!indT || (batch_count && !valT)))
+       || (nrhs * n && batch_count && !B))
         return rocblas_status_invalid_pointer;
     if(n && ((rfinfo->mode == rocsolver_rfinfo_mode_lu && !pivP) || !pivQ))
         return rocblas_status_invalid_pointer;
@@ -225,26 +551,45 @@ void rocsolver_csrrf_solve_getMemorySize(const rocblas_int n,
                                          U B,
                                          const rocblas_int ldb,
                                          rocsolver_rfinfo rfinfo,
+                                         const rocblas_int batch_count,
                                          size_t* size_work,
-                                         size_t* size_temp)
+                                         size_t* size_temp,
+                                         size_t* size_refine)
 {
     // if quick return, no need of workspace
-    if(n == 0 || nrhs == 0)
+    if(n == 0 || nrhs == 0 || batch_count == 0)
     {
         *size_work = 0;
         *size_temp = 0;
+        *size_refine = 0;
         return;
     }
 
-    // temp storage for performing permutations
-    *size_temp = sizeof(T) * n * nrhs;
+    // temp storage for the permuted right-hand sides
+    // (the triangular solves are done in place on temp, with leading dimension n)
+    *size_temp = sizeof(T) * n * nrhs * batch_count;
+
+    // in mixed precision or with static pivoting, storage for the iterative refinement: a copy
+    // of the permuted right-hand sides and the corrections, the norms of the matrices, and the
+    // convergence flags
+    *size_refine = 0;
+    if((std::is_same<T, double>::value
+        && rfinfo->precision_mode == rocsolver_rfinfo_precision_mode_mixed)
+       || rf_pivot_refine<T>(rfinfo))
+        *size_refine = sizeof(T) * (2 * size_t(n) * nrhs + 1) * batch_count
+            + sizeof(rocblas_int) * (batch_count + 1);
 
     T alpha = 1.0;
-    if(rfinfo->mode == rocsolver_rfinfo_mode_lu)
+    if(rfinfo->solve_mode == rocsolver_rfinfo_solve_mode_levels)
+    {
+        // done flags and ticket counter of the level-scheduled solve
+        *size_work = sizeof(rocblas_int) * (2 * n + 1) * batch_count;
+    }
+    else if(rfinfo->mode == rocsolver_rfinfo_mode_lu)
     {
         // requirements for solve with L and U
         // (buffer size is the same for all routines if the sparsity pattern does not
-        // change)
+        // change; thus, the buffer is re-used by all the matrices in the batch)
         size_t csrsm_L_buffer_size = 0;
         size_t csrsm_U_buffer_size = 0;
 
@@ -253,7 +598,7 @@ void rocsolver_csrrf_solve_getMemorySize(const rocblas_int n,
         // ----------------------------------
         rocsparseCall_csrsm_buffer_size(rfinfo->sphandle, rocsparse_operation_none,
                                         rocsparse_operation_none, n, nrhs, nnzT, &alpha,
-                                        rfinfo->descrL, valT, ptrT, indT, B, ldb, rfinfo->infoL,
+                                        rfinfo->descrL, valT, ptrT, indT, B, n, rfinfo->infoL,
                                         rfinfo->solve_policy, &csrsm_L_buffer_size);
 
         // --------------------------------------
@@ -261,7 +606,7 @@ void rocsolver_csrrf_solve_getMemorySize(const rocblas_int n,
         // --------------------------------------
         rocsparseCall_csrsm_buffer_size(rfinfo->sphandle, rocsparse_operation_none,
                                         rocsparse_operation_none, n, nrhs, nnzT, &alpha,
-                                        rfinfo->descrU, valT, ptrT, indT, B, ldb, rfinfo->infoU,
+                                        rfinfo->descrU, valT, ptrT, indT, B, n, rfinfo->infoU,
                                         rfinfo->solve_policy, &csrsm_U_buffer_size);
 
         *size_work = std::max(csrsm_L_buffer_size, csrsm_U_buffer_size);
@@ -276,7 +621,7 @@ void rocsolver_csrrf_solve_getMemorySize(const rocblas_int n,
         // --------------------------------------
         rocsparseCall_csrsm_buffer_size(rfinfo->sphandle, rocsparse_operation_none,
                                         rocsparse_operation_none, n, nrhs, nnzT, &alpha,
-                                        rfinfo->descrL, valT, ptrT, indT, B, ldb, rfinfo->infoL,
+                                        rfinfo->descrL, valT, ptrT, indT, B, n, rfinfo->infoL,
                                         rfinfo->solve_policy, &csrsm_L_buffer_size);
 
         // --------------------------------
@@ -284,7 +629,7 @@ void rocsolver_csrrf_solve_getMemorySize(const rocblas_int n,
         // --------------------------------
         rocsparseCall_csrsm_buffer_size(rfinfo->sphandle, rocsparse_operation_conjugate_transpose,
                                         rocsparse_operation_none, n, nrhs, nnzT, &alpha,
-                                        rfinfo->descrL, valT, ptrT, indT, B, ldb, rfinfo->infoU,
+                                        rfinfo->descrL, valT, ptrT, indT, B, n, rfinfo->infoU,
                                         rfinfo->solve_policy, &csrsm_Lt_buffer_size);
 
         *size_work = std::max(csrsm_L_buffer_size, csrsm_Lt_buffer_size);
@@ -301,27 +646,39 @@ rocblas_status rocsolver_csrrf_solve_template(rocblas_handle handle,
                                               rocblas_int* ptrT,
                                               rocblas_int* indT,
                                               U valT,
+                                              const rocblas_stride strideT,
                                               rocblas_int* pivP,
                                               rocblas_int* pivQ,
                                               U B,
                                               const rocblas_int ldb,
+                                              const rocblas_stride strideB,
                                               rocsolver_rfinfo rfinfo,
+                                              const rocblas_int batch_count,
                                               void* work,
-                                              T* temp)
+                                              T* temp,
+                                              void* refine)
 {
-    ROCSOLVER_ENTER("csrrf_solve", "n:", n, "nrhs:", nrhs, "nnzT:", nnzT, "ldb:", ldb);
+    ROCSOLVER_ENTER("csrrf_solve", "n:", n, "nrhs:", nrhs, "nnzT:", nnzT, "ldb:", ldb,
+                    "bc:", batch_count);
 
     // quick return
-    if(n == 0 || nrhs == 0)
+    if(n == 0 || nrhs == 0 || batch_count == 0)
         return rocblas_status_success;
 
     // check state of rfinfo
-    if(!rfinfo->analyzed || rfinfo->analyzed_mode != rfinfo->mode)
+    // (the least-squares solve of the QR factorization is computed by csrrf_solveqr)
+    if(!rfinfo->analyzed || rfinfo->analyzed_mode != rfinfo->mode
+       || rfinfo->analyzed_solve_mode != rfinfo->solve_mode
+       || rfinfo->mode == rocsolver_rfinfo_mode_qr)
         return rocblas_status_internal_error;
 
     hipStream_t stream;
     ROCBLAS_CHECK(rocblas_get_stream(handle, &stream));
 
+    // bind the sparse handle to the stream of the calling handle
+    // (rfinfo may have been created with a different handle or stream)
+    ROCSPARSE_CHECK(rocsparse_set_stream(rfinfo->sphandle, stream));
+
     // -------------------------------------------------------------
     // solve A * X = B
     //   (P * A * Q) * (inv(Q) * X) = P * B
@@ -330,17 +687,68 @@ rocblas_status rocsolver_csrrf_solve_template(rocblas_handle handle,
     //                      Bhat = P * B
     // -------------------------------------------------------------
 
-    // compute Bhat (reordering of B)
+    // compute Bhat (reordering of B) into temp
     rocblas_int* pivot = (rfinfo->mode == rocsolver_rfinfo_mode_cholesky ? pivQ : pivP);
-    ROCSOLVER_LAUNCH_KERNEL(rf_gather_kernel<T>, dim3(1), dim3(BS1), 0, stream, n, nrhs, pivot, B,
-                            ldb, temp);
+    rocblas_int blocks = (n - 1) / BS1 + 1;
+    ROCSOLVER_LAUNCH_KERNEL(rf_gather_kernel<T>, dim3(blocks, batch_count), dim3(BS1), 0, stream,
+                            n, nrhs, pivot, B, ldb, strideB, temp);
+
+    if(rfinfo->solve_mode == rocsolver_rfinfo_solve_mode_levels)
+    {
+        // solve (L * U) * Xhat = Bhat and compute X (reordering of Xhat) into B,
+        // for all the instances in the batch at once
+        rocblas_int* flags = static_cast<rocblas_int*>(work);
+
+        if constexpr(std::is_same<T, double>::value)
+        {
+            if(rfinfo->precision_mode == rocsolver_rfinfo_precision_mode_mixed)
+            {
+                // mixed precision: the factors of all the instances must have been computed
+                // in single precision by the last re-factorization
+                if(rfinfo->low_bc < batch_count)
+                    return rocblas_status_internal_error;
+
+                return rf_refine_solve<T>(stream, n, nrhs, nnzT, ptrT, indT, valT, strideT,
+                                          (const float*)rfinfo->low_valT, rocblas_stride(nnzT),
+                                          pivQ, B, ldb, strideB, rfinfo, batch_count, flags, temp,
+                                          refine);
+            }
+        }
+
+        if(rf_pivot_refine<T>(rfinfo) && rfinfo->pivot_active && rfinfo->pivot_valA
+           && rfinfo->pivot_bc >= batch_count)
+        {
+            // static pivoting: the factors in T are those of a perturbed matrix; refine with
+            // the copy of P * A * Q kept by the last re-factorization
+            return rf_refine_solve<T>(stream, n, nrhs, nnzT, ptrT, indT, (T*)rfinfo->pivot_valA,
+                                      rocblas_stride(nnzT), (const T*)valT, strideT, pivQ, B, ldb,
+                                      strideB, rfinfo, batch_count, flags, temp, refine);
+        }
+
+        HIP_CHECK(hipMemsetAsync(flags, 0, sizeof(rocblas_int) * (2 * n + 1) * batch_count,
+                                 stream));
+
+        // (one wavefront per row; assume the smallest wavefront size when sizing the grid,
+        // the wavefronts without a row return immediately)
+        rocblas_int sblocks = (2 * n - 1) / (BS1 / 32) + 1;
+        ROCSOLVER_LAUNCH_KERNEL(rf_levels_solve_kernel<T>, dim3(sblocks, batch_count), dim3(BS1),
+                                0, stream, n, nrhs, rfinfo->ptrL, rfinfo->colL, rfinfo->mapL,
+                                rfinfo->diagL, rfinfo->ordL, rfinfo->ptrU, rfinfo->colU,
+                                rfinfo->mapU, rfinfo->diagU, rfinfo->ordU, valT, strideT, pivQ,
+                                temp, B, ldb, strideB, flags);
+
+        return rocblas_status_success;
+    }
 
-    // solve (L * U) * Xhat = Bhat
-    ROCBLAS_CHECK(rf_lusolve(rfinfo, n, nnzT, nrhs, ptrT, indT, valT, B, ldb, work));
+    // solve (L * U) * Xhat = Bhat in temp
+    // (all the matrices share the sparsity pattern, and thus the analysis in rfinfo)
+    for(rocblas_int b = 0; b < batch_count; ++b)
+        ROCBLAS_CHECK(rf_lusolve(rfinfo, n, nnzT, nrhs, ptrT, indT, valT + b * strideT,
+                                 temp + size_t(b) * n * nrhs, n, work));
 
-    // Compute X (reordering of Xhat)
-    ROCSOLVER_LAUNCH_KERNEL(rf_scatter_kernel<T>, dim3(1), dim3(BS1), 0, stream, n, nrhs, pivQ, B,
-                            ldb, temp);
+    // compute X (reordering of Xhat) back into B
+    ROCSOLVER_LAUNCH_KERNEL(rf_scatter_kernel<T>, dim3(blocks, batch_count), dim3(BS1), 0, stream,
+                            n, nrhs, pivQ, temp, B, ldb, strideB);
 
     return rocblas_status_success;
 }
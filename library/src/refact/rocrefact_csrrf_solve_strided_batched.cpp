@@ -0,0 +1,155 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#ifdef HAVE_ROCSPARSE
+#include "rocrefact_csrrf_solve.hpp"
+#endif
+
+#include "rocblas.hpp"
+#include "rocsolver/rocsolver.h"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+template <typename T, typename U>
+rocblas_status rocsolver_csrrf_solve_strided_batched_impl(rocblas_handle handle,
+                                                          const rocblas_int n,
+                                                          const rocblas_int nrhs,
+                                                          const rocblas_int nnzT,
+                                                          rocblas_int* ptrT,
+                                                          rocblas_int* indT,
+                                                          U valT,
+                                                          const rocblas_stride strideT,
+                                                          rocblas_int* pivP,
+                                                          rocblas_int* pivQ,
+                                                          U B,
+                                                          const rocblas_int ldb,
+                                                          const rocblas_stride strideB,
+                                                          rocsolver_rfinfo rfinfo,
+                                                          const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER_TOP("csrrf_solve_strided_batched", "-n", n, "--nrhs", nrhs, "--nnzT", nnzT,
+                        "--strideT", strideT, "--ldb", ldb, "--strideB", strideB, "--batch_count",
+                        batch_count);
+
+#ifdef HAVE_ROCSPARSE
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_csrrf_solve_argCheck(handle, n, nrhs, nnzT, ptrT, indT, valT,
+                                                       pivP, pivQ, B, ldb, rfinfo, batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+
+    // memory workspace sizes:
+    // size for temp buffer in solve calls
+    size_t size_work = 0;
+    size_t size_temp = 0;
+    // size for the iterative refinement in mixed precision
+    size_t size_refine = 0;
+
+    rocsolver_csrrf_solve_getMemorySize<T>(n, nrhs, nnzT, ptrT, indT, valT, B, ldb, rfinfo,
+                                           batch_count, &size_work, &size_temp, &size_refine);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_work, size_temp, size_refine);
+
+    // memory workspace allocation
+    void *work = nullptr, *temp = nullptr, *refine = nullptr;
+    rocblas_device_malloc mem(handle, size_work, size_temp, size_refine);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    work = mem[0];
+    temp = mem[1];
+    refine = mem[2];
+
+    // execution
+    return rocsolver_csrrf_solve_template<T>(handle, n, nrhs, nnzT, ptrT, indT, valT, strideT, pivP,
+                                             pivQ, B, ldb, strideB, rfinfo, batch_count, work,
+                                             static_cast<T*>(temp), refine);
+#else
+    return rocblas_status_not_implemented;
+#endif
+}
+
+ROCSOLVER_END_NAMESPACE
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_scsrrf_solve_strided_batched(rocblas_handle handle,
+                                                      const rocblas_int n,
+                                                      const rocblas_int nrhs,
+                                                      const rocblas_int nnzT,
+                                                      rocblas_int* ptrT,
+                                                      rocblas_int* indT,
+                                                      float* valT,
+                                                      const rocblas_stride strideT,
+                                                      rocblas_int* pivP,
+                                                      rocblas_int* pivQ,
+                                                      float* B,
+                                                      const rocblas_int ldb,
+                                                      const rocblas_stride strideB,
+                                                      rocsolver_rfinfo rfinfo,
+                                                      const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_csrrf_solve_strided_batched_impl<float>(
+        handle, n, nrhs, nnzT, ptrT, indT, valT, strideT, pivP, pivQ, B, ldb, strideB, rfinfo,
+        batch_count);
+}
+
+rocblas_status rocsolver_dcsrrf_solve_strided_batched(rocblas_handle handle,
+                                                      const rocblas_int n,
+                                                      const rocblas_int nrhs,
+                                                      const rocblas_int nnzT,
+                                                      rocblas_int* ptrT,
+                                                      rocblas_int* indT,
+                                                      double* valT,
+                                                      const rocblas_stride strideT,
+                                                      rocblas_int* pivP,
+                                                      rocblas_int* pivQ,
+                                                      double* B,
+                                                      const rocblas_int ldb,
+                                                      const rocblas_stride strideB,
+                                                      rocsolver_rfinfo rfinfo,
+                                                      const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_csrrf_solve_strided_batched_impl<double>(
+        handle, n, nrhs, nnzT, ptrT, indT, valT, strideT, pivP, pivQ, B, ldb, strideB, rfinfo,
+        batch_count);
+}
+
+} // extern C
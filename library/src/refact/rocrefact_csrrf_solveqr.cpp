@@ -0,0 +1,166 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#ifdef HAVE_ROCSPARSE
+#include "rocrefact_csrrf_solveqr.hpp"
+#endif
+
+#include "rocblas.hpp"
+#include "rocsolver/rocsolver.h"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+template <typename T, typename U>
+rocblas_status rocsolver_csrrf_solveqr_impl(rocblas_handle handle,
+                                            const rocblas_int m,
+                                            const rocblas_int n,
+                                            const rocblas_int nrhs,
+                                            const rocblas_int nnzA,
+                                            rocblas_int* ptrA,
+                                            rocblas_int* indA,
+                                            U valA,
+                                            const rocblas_int nnzT,
+                                            rocblas_int* ptrT,
+                                            rocblas_int* indT,
+                                            U valT,
+                                            rocblas_int* pivQ,
+                                            U B,
+                                            const rocblas_int ldb,
+                                            U X,
+                                            const rocblas_int ldx,
+                                            rocsolver_rfinfo rfinfo)
+{
+    ROCSOLVER_ENTER_TOP("csrrf_solveqr", "-m", m, "-n", n, "--nrhs", nrhs, "--nnzA", nnzA, "--nnzT",
+                        nnzT, "--ldb", ldb, "--ldx", ldx);
+
+#ifdef HAVE_ROCSPARSE
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_csrrf_solveqr_argCheck(handle, m, n, nrhs, nnzA, ptrA, indA, valA,
+                                                         nnzT, ptrT, indT, valT, pivQ, B, ldb, X,
+                                                         ldx, rfinfo);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    // normal (non-batched non-strided) execution
+
+    // memory workspace sizes:
+    // size for the triangular solves
+    size_t size_work = 0;
+    // size for the normal equations right-hand sides and their solutions
+    size_t size_temp = 0;
+    // size for the residuals
+    size_t size_resid = 0;
+
+    rocsolver_csrrf_solveqr_getMemorySize<T>(m, n, nrhs, nnzT, ptrT, indT, valT, X, rfinfo,
+                                             &size_work, &size_temp, &size_resid);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_work, size_temp, size_resid);
+
+    // memory workspace allocation
+    void *work, *temp, *resid;
+    rocblas_device_malloc mem(handle, size_work, size_temp, size_resid);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    work = mem[0];
+    temp = mem[1];
+    resid = mem[2];
+
+    // execution
+    return rocsolver_csrrf_solveqr_template<T>(handle, m, n, nrhs, nnzA, ptrA, indA, valA, nnzT,
+                                               ptrT, indT, valT, pivQ, B, ldb, X, ldx, rfinfo, work,
+                                               (T*)temp, (T*)resid);
+#else
+    return rocblas_status_not_implemented;
+#endif
+}
+
+ROCSOLVER_END_NAMESPACE
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_scsrrf_solveqr(rocblas_handle handle,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        const rocblas_int nrhs,
+                                        const rocblas_int nnzA,
+                                        rocblas_int* ptrA,
+                                        rocblas_int* indA,
+                                        float* valA,
+                                        const rocblas_int nnzT,
+                                        rocblas_int* ptrT,
+                                        rocblas_int* indT,
+                                        float* valT,
+                                        rocblas_int* pivQ,
+                                        float* B,
+                                        const rocblas_int ldb,
+                                        float* X,
+                                        const rocblas_int ldx,
+                                        rocsolver_rfinfo rfinfo)
+{
+    return rocsolver::rocsolver_csrrf_solveqr_impl<float>(handle, m, n, nrhs, nnzA, ptrA, indA,
+                                                          valA, nnzT, ptrT, indT, valT, pivQ, B,
+                                                          ldb, X, ldx, rfinfo);
+}
+
+rocblas_status rocsolver_dcsrrf_solveqr(rocblas_handle handle,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        const rocblas_int nrhs,
+                                        const rocblas_int nnzA,
+                                        rocblas_int* ptrA,
+                                        rocblas_int* indA,
+                                        double* valA,
+                                        const rocblas_int nnzT,
+                                        rocblas_int* ptrT,
+                                        rocblas_int* indT,
+                                        double* valT,
+                                        rocblas_int* pivQ,
+                                        double* B,
+                                        const rocblas_int ldb,
+                                        double* X,
+                                        const rocblas_int ldx,
+                                        rocsolver_rfinfo rfinfo)
+{
+    return rocsolver::rocsolver_csrrf_solveqr_impl<double>(handle, m, n, nrhs, nnzA, ptrA, indA,
+                                                           valA, nnzT, ptrT, indT, valT, pivQ, B,
+                                                           ldb, X, ldx, rfinfo);
+}
+
+} // extern C
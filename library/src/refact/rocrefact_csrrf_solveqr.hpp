@@ -0,0 +1,315 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "rocrefact_csrrf_solve.hpp"
+#include "rocsolver/rocsolver.h"
+#include "rocsolver_rfinfo.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/** RF_QR_ATB_KERNEL accumulates C = Q' * A' * B into temp (n-by-nrhs, leading dimension n),
+    which must be zero on entry. (One thread per row of A) **/
+template <typename T>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) rf_qr_atb_kernel(const rocblas_int m,
+                                                              const rocblas_int n,
+                                                              const rocblas_int nrhs,
+                                                              const rocblas_int* ptrA,
+                                                              const rocblas_int* indA,
+                                                              T* valA,
+                                                              const rocblas_int* invQ,
+                                                              T* B,
+                                                              const rocblas_int ldb,
+                                                              T* temp)
+{
+    const rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(i < m)
+    {
+        for(rocblas_int j = 0; j < nrhs; ++j)
+        {
+            const T b = B[i + j * ldb];
+            if(b == 0)
+                continue;
+            for(rocblas_int k = ptrA[i]; k < ptrA[i + 1]; ++k)
+                atomicAdd(temp + invQ[indA[k]] + j * n, valA[k] * b);
+        }
+    }
+}
+
+/** RF_QR_RESIDUAL_KERNEL computes the residuals R = B - A * X (m-by-nrhs, leading dimension
+    m). (One thread per row of A) **/
+template <typename T>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) rf_qr_residual_kernel(const rocblas_int m,
+                                                                   const rocblas_int nrhs,
+                                                                   const rocblas_int* ptrA,
+                                                                   const rocblas_int* indA,
+                                                                   T* valA,
+                                                                   T* B,
+                                                                   const rocblas_int ldb,
+                                                                   T* X,
+                                                                   const rocblas_int ldx,
+                                                                   T* R)
+{
+    const rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(i < m)
+    {
+        for(rocblas_int j = 0; j < nrhs; ++j)
+        {
+            T r = B[i + j * ldb];
+            for(rocblas_int k = ptrA[i]; k < ptrA[i + 1]; ++k)
+                r -= valA[k] * X[indA[k] + j * ldx];
+            R[i + j * m] = r;
+        }
+    }
+}
+
+/** RF_QR_UPDATE_KERNEL sets (or, if add is true, updates) X[P[i], *] (+)= Y[i, *], where Y has
+    leading dimension n, and P is the identity when it is null. (One thread per row) **/
+template <typename T>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) rf_qr_update_kernel(const rocblas_int n,
+                                                                 const rocblas_int nrhs,
+                                                                 const rocblas_int* P,
+                                                                 T* Y,
+                                                                 const bool add,
+                                                                 T* X,
+                                                                 const rocblas_int ldx)
+{
+    const rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(i < n)
+    {
+        const rocblas_int ip = P ? P[i] : i;
+        for(rocblas_int j = 0; j < nrhs; ++j)
+            X[ip + j * ldx] = (add ? X[ip + j * ldx] : T(0)) + Y[i + j * n];
+    }
+}
+
+/** RF_QR_NORMAL_SOLVE solves R' * R * Xhat = C, with C = Q' * A' * B in temp, and sets (or
+    updates) X with Q * Xhat. The solves with R' and R are those of the Cholesky mode with the
+    factor L = R' stored in the lower triangular part of T. **/
+template <typename T>
+rocblas_status rf_qr_normal_solve(hipStream_t stream,
+                                  rocsolver_rfinfo rfinfo,
+                                  const rocblas_int n,
+                                  const rocblas_int nrhs,
+                                  const rocblas_int nnzT,
+                                  rocblas_int* ptrT,
+                                  rocblas_int* indT,
+                                  T* valT,
+                                  rocblas_int* pivQ,
+                                  const bool add,
+                                  T* X,
+                                  const rocblas_int ldx,
+                                  void* work,
+                                  T* temp)
+{
+    const rocblas_int blocks = (n - 1) / BS1 + 1;
+
+    if(rfinfo->solve_mode == rocsolver_rfinfo_solve_mode_levels)
+    {
+        // the level-scheduled solve writes Q * Xhat into the second half of temp
+        rocblas_int* flags = static_cast<rocblas_int*>(work);
+        T* Y = temp + size_t(n) * nrhs;
+
+        HIP_CHECK(hipMemsetAsync(flags, 0, sizeof(rocblas_int) * (2 * n + 1), stream));
+
+        // (one wavefront per row; assume the smallest wavefront size when sizing the grid,
+        // the wavefronts without a row return immediately)
+        rocblas_int sblocks = (2 * n - 1) / (BS1 / 32) + 1;
+        ROCSOLVER_LAUNCH_KERNEL(rf_levels_solve_kernel<T>, dim3(sblocks, 1), dim3(BS1), 0, stream,
+                                n, nrhs, rfinfo->ptrL, rfinfo->colL, rfinfo->mapL, rfinfo->diagL,
+                                rfinfo->ordL, rfinfo->ptrU, rfinfo->colU, rfinfo->mapU,
+                                rfinfo->diagU, rfinfo->ordU, valT, 0, pivQ, temp, Y, n, 0, flags);
+        ROCSOLVER_LAUNCH_KERNEL(rf_qr_update_kernel<T>, dim3(blocks), dim3(BS1), 0, stream, n,
+                                nrhs, (rocblas_int*)nullptr, Y, add, X, ldx);
+    }
+    else
+    {
+        // Xhat overwrites temp
+        ROCBLAS_CHECK(rf_lusolve(rfinfo, n, nnzT, nrhs, ptrT, indT, valT, temp, n, work));
+        ROCSOLVER_LAUNCH_KERNEL(rf_qr_update_kernel<T>, dim3(blocks), dim3(BS1), 0, stream, n,
+                                nrhs, pivQ, temp, add, X, ldx);
+    }
+
+    return rocblas_status_success;
+}
+
+template <typename T>
+rocblas_status rocsolver_csrrf_solveqr_argCheck(rocblas_handle handle,
+                                                const rocblas_int m,
+                                                const rocblas_int n,
+                                                const rocblas_int nrhs,
+                                                const rocblas_int nnzA,
+                                                rocblas_int* ptrA,
+                                                rocblas_int* indA,
+                                                T valA,
+                                                const rocblas_int nnzT,
+                                                rocblas_int* ptrT,
+                                                rocblas_int* indT,
+                                                T valT,
+                                                rocblas_int* pivQ,
+                                                T B,
+                                                const rocblas_int ldb,
+                                                T X,
+                                                const rocblas_int ldx,
+                                                rocsolver_rfinfo rfinfo)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    if(n < 0 || m < n || nrhs < 0 || nnzA < 0 || nnzT < 0 || ldb < m || ldx < n)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if(!rfinfo || !ptrA || !ptrT || (nnzA && (!indA || !valA)) || (nnzT && (!indT || !valT))
+       || (n && !pivQ) || (nrhs * n && (!B || !X)))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T, typename U>
+void rocsolver_csrrf_solveqr_getMemorySize(const rocblas_int m,
+                                           const rocblas_int n,
+                                           const rocblas_int nrhs,
+                                           const rocblas_int nnzT,
+                                           rocblas_int* ptrT,
+                                           rocblas_int* indT,
+                                           U valT,
+                                           U X,
+                                           rocsolver_rfinfo rfinfo,
+                                           size_t* size_work,
+                                           size_t* size_temp,
+                                           size_t* size_resid)
+{
+    // if quick return, no need of workspace
+    if(n == 0 || nrhs == 0)
+    {
+        *size_work = 0;
+        *size_temp = 0;
+        *size_resid = 0;
+        return;
+    }
+
+    // requirements of the triangular solves, as in csrrf_solve
+    size_t size_refine;
+    rocsolver_csrrf_solve_getMemorySize<T>(n, nrhs, nnzT, ptrT, indT, valT, X, n, rfinfo, 1,
+                                           size_work, size_temp, &size_refine);
+
+    // right-hand sides of the normal equations and, for the level-scheduled solve, their
+    // solutions; residuals of the least-squares problems
+    *size_temp = sizeof(T) * 2 * size_t(n) * nrhs;
+    *size_resid = sizeof(T) * size_t(m) * nrhs;
+}
+
+template <typename T, typename U>
+rocblas_status rocsolver_csrrf_solveqr_template(rocblas_handle handle,
+                                                const rocblas_int m,
+                                                const rocblas_int n,
+                                                const rocblas_int nrhs,
+                                                const rocblas_int nnzA,
+                                                rocblas_int* ptrA,
+                                                rocblas_int* indA,
+                                                U valA,
+                                                const rocblas_int nnzT,
+                                                rocblas_int* ptrT,
+                                                rocblas_int* indT,
+                                                U valT,
+                                                rocblas_int* pivQ,
+                                                U B,
+                                                const rocblas_int ldb,
+                                                U X,
+                                                const rocblas_int ldx,
+                                                rocsolver_rfinfo rfinfo,
+                                                void* work,
+                                                T* temp,
+                                                T* resid)
+{
+    ROCSOLVER_ENTER("csrrf_solveqr", "m:", m, "n:", n, "nrhs:", nrhs, "nnzA:", nnzA,
+                    "nnzT:", nnzT, "ldb:", ldb, "ldx:", ldx);
+
+    // quick return
+    if(n == 0 || nrhs == 0)
+        return rocblas_status_success;
+
+    // check state of rfinfo
+    if(!rfinfo->analyzed || rfinfo->analyzed_mode != rocsolver_rfinfo_mode_qr
+       || rfinfo->mode != rocsolver_rfinfo_mode_qr
+       || rfinfo->analyzed_solve_mode != rfinfo->solve_mode || rfinfo->analyzed_m != m
+       || rfinfo->analyzed_n != n || rfinfo->analyzed_nnzT != nnzT)
+        return rocblas_status_internal_error;
+
+    hipStream_t stream;
+    ROCBLAS_CHECK(rocblas_get_stream(handle, &stream));
+
+    // bind the sparse handle to the stream of the calling handle
+    // (rfinfo may have been created with a different handle or stream)
+    ROCSPARSE_CHECK(rocsparse_set_stream(rfinfo->sphandle, stream));
+
+    // -------------------------------------------------------------
+    // solve min || A * X - B || with the corrected semi-normal equations:
+    //   (1) solve R' * R * Xhat = Q' * A' * B, and X = Q * Xhat,
+    //   (2) compute the residuals E = B - A * X,
+    //   (3) solve R' * R * Dhat = Q' * A' * E, and X = X + Q * Dhat.
+    // Q is not stored; the correction step recovers the accuracy of the QR factorization
+    // (the semi-normal equations alone are as sensitive as the normal equations).
+    // -------------------------------------------------------------
+    const rocblas_int blocksM = (m - 1) / BS1 + 1;
+    const size_t sizeC = sizeof(T) * n * nrhs;
+
+    for(int step = 0; step < 2; ++step)
+    {
+        T* rhs = (step == 0) ? B : resid;
+        const rocblas_int ldr = (step == 0) ? ldb : m;
+
+        if(step > 0)
+            ROCSOLVER_LAUNCH_KERNEL(rf_qr_residual_kernel<T>, dim3(blocksM), dim3(BS1), 0, stream,
+                                    m, nrhs, ptrA, indA, valA, B, ldb, X, ldx, resid);
+
+        HIP_CHECK(hipMemsetAsync(temp, 0, sizeC, stream));
+        ROCSOLVER_LAUNCH_KERNEL(rf_qr_atb_kernel<T>, dim3(blocksM), dim3(BS1), 0, stream, m, n,
+                                nrhs, ptrA, indA, valA, rfinfo->invQ, rhs, ldr, temp);
+
+        ROCBLAS_CHECK(rf_qr_normal_solve<T>(stream, rfinfo, n, nrhs, nnzT, ptrT, indT, valT, pivQ,
+                                            step > 0, X, ldx, work, temp));
+    }
+
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
@@ -60,15 +60,19 @@ rocblas_status rocsolver_csrrf_splitlu_impl(rocblas_handle handle,
     if(st != rocblas_status_continue)
         return st;
 
-    // TODO: add batched versions
     // working with unshifted arrays
     // normal (non-batched non-strided) execution
+    rocblas_stride strideT = 0;
+    rocblas_stride strideL = 0;
+    rocblas_stride strideU = 0;
+    rocblas_int batch_count = 1;
 
     // memory workspace sizes:
-    // size to store number of non-zeros per row
+    // size for the prefix sum of the number of non-zeros per row
     size_t size_work = 0;
 
-    ROCBLAS_CHECK(rocsolver_csrrf_splitlu_getMemorySize<T>(n, nnzT, ptrT, &size_work));
+    ROCBLAS_CHECK(
+        rocsolver_csrrf_splitlu_getMemorySize<T>(n, nnzT, ptrT, indT, batch_count, &size_work));
 
     if(rocblas_is_device_memory_size_query(handle))
         return rocblas_set_optimal_device_memory_size(handle, size_work);
@@ -83,8 +87,9 @@ rocblas_status rocsolver_csrrf_splitlu_impl(rocblas_handle handle,
     work = mem[0];
 
     // execution
-    return rocsolver_csrrf_splitlu_template<T>(handle, n, nnzT, ptrT, indT, valT, ptrL, indL, valL,
-                                               ptrU, indU, valU, static_cast<rocblas_int*>(work),
+    return rocsolver_csrrf_splitlu_template<T>(handle, n, nnzT, ptrT, indT, valT, strideT, ptrL,
+                                               indL, valL, strideL, ptrU, indU, valU, strideU,
+                                               batch_count, static_cast<rocblas_int*>(work),
                                                size_work);
 #else
     return rocblas_status_not_implemented;
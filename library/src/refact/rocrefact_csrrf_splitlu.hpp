@@ -37,10 +37,6 @@
 
 ROCSOLVER_BEGIN_NAMESPACE
 
-#ifndef SPLITLU_SWITCH_SIZE
-#define SPLITLU_SWITCH_SIZE 64
-#endif
-
 #ifndef SPLITLU_SETUP_THREADS
 #define SPLITLU_SETUP_THREADS(lid, wid, waveSize, nwaves)     \
     {                                                         \
@@ -80,132 +76,57 @@ __host__ __device__ static I cal_wave_size(I avg_nnzM)
     return wave_size;
 }
 
-template <typename T>
-ROCSOLVER_KERNEL __launch_bounds__(BS1) void check_nzLU_kernel(const rocblas_int n,
-                                                               const rocblas_int nnzT,
-                                                               rocblas_int const* const ptrT,
-                                                               rocblas_int const* const indT,
-                                                               rocblas_int* const nzLarray,
-                                                               rocblas_int* const nzUarray)
+/** RF_SPLITLU_NZU_OP returns the number of non-zero elements of row irow of T that belong
+    to U. (The column indices of every row are sorted, thus the diagonal is found by a binary
+    search, and the count can be generated on the fly by the prefix sum of ptrU). **/
+struct rf_splitLU_nzU_op
 {
-    auto const tid = hipThreadIdx_x + hipBlockIdx_x * hipBlockDim_x;
-    auto const nthreads = hipBlockDim_x * hipGridDim_x;
-    auto const irow_start = tid;
-    auto const irow_inc = nthreads;
+    rocblas_int const* Mp;
+    rocblas_int const* Mi;
 
-    __syncthreads();
-    for(rocblas_int irow = irow_start; irow < n; irow += irow_inc)
+    __host__ __device__ rocblas_int operator()(const rocblas_int irow) const
     {
-        auto const istart = ptrT[irow];
-        auto const iend = ptrT[irow + 1];
-        auto const nnzTrow = (iend - istart);
-
-        rocblas_int nnzLrow = 0;
-        rocblas_int nnzUrow = 0;
-        for(auto i = istart; i < iend; i++)
+        rocblas_int lo = Mp[irow];
+        rocblas_int hi = Mp[irow + 1];
+        const rocblas_int kend = hi;
+        while(lo < hi)
         {
-            auto const icol = indT[i];
-            bool const is_upper = (irow <= icol);
-            if(is_upper)
-            {
-                nnzUrow += 1;
-            }
+            const rocblas_int mid = lo + (hi - lo) / 2;
+            if(Mi[mid] < irow)
+                lo = mid + 1;
             else
-            {
-                nnzLrow += 1;
-            }
-        }
-        nnzLrow += 1; // add one for unit diagonal
-
-#ifdef NDEBUG
-#else
-        {
-            bool const isvalid = (nnzUrow == nzUarray[irow]) && (nnzLrow == nzLarray[irow])
-                && (nnzTrow == (nnzLrow - 1) + nnzUrow);
-
-            if(!isvalid)
-            {
-                printf("irow=%d,nnzTrow=%d,nnzLrow=%d,nzLarray[irow]=%d,nnzUrow=%d,nzUarray=%d\n",
-                       irow, nnzTrow, nnzLrow, nzLarray[irow], nnzUrow, nzUarray[irow]);
-            }
-            assert(isvalid);
+                hi = mid;
         }
-#endif
+        return kend - lo;
     }
-    __syncthreads();
-}
+};
 
-template <typename T>
-ROCSOLVER_KERNEL __launch_bounds__(BS1) void rf_splitLU_gen_nzLU_kernel(const rocblas_int n,
-                                                                        const rocblas_int nnzM,
-                                                                        rocblas_int const* const Mp,
-                                                                        rocblas_int const* const Mi,
-                                                                        rocblas_int* const nzLarray,
-                                                                        rocblas_int* const nzUarray)
+static auto rf_splitLU_nzU_iterator(rocblas_int const* Mp, rocblas_int const* Mi)
 {
-    rocblas_int wid = 0;
-    rocblas_int lid = 0;
-    rocblas_int waveSize = 0;
-    rocblas_int nwaves = 0;
-
-    SPLITLU_SETUP_THREADS(lid, wid, waveSize, nwaves);
-    auto const lwid = hipThreadIdx_y;
-
-    // ------------------------------------------------------------------
-    // Note: the code may not work correctly if number of threads in thread block
-    // is not a multiple of warpSize
-    // ------------------------------------------------------------------
-
-    auto const ld = waveSize;
-    auto idx2D = [=](auto i, auto j, auto ld) { return i + j * ld; };
-
-    for(auto irow = wid; irow < n; irow += nwaves)
-    {
-        const auto kstart = Mp[irow];
-        const auto kend = Mp[irow + 1];
-        const auto nnzTrow = (kend - kstart);
-
-        // -------------------------------------
-        // calculate number of non-zeros per row
-        // -------------------------------------
-
-        rocblas_int lnnzUrow = 0;
-        rocblas_int lnnzLrow = 0;
-
-        for(auto k = kstart + lid; (k < kend); k += waveSize)
-        {
-            const auto icol = Mi[k];
-            bool const is_upper_triangular = (irow <= icol);
-            if(is_upper_triangular)
-            {
-                lnnzUrow += 1;
-            }
-            else
-            {
-                lnnzLrow += 1;
-            }
-        }
-        atomicAdd(&(nzUarray[irow]), lnnzUrow);
-
-        // add 1 for unit diagonal
-        atomicAdd(&(nzLarray[irow]), (lid == 0) ? 1 + lnnzLrow : lnnzLrow);
-
-    } // end for irow
+    return rocprim::make_transform_iterator(rocprim::make_counting_iterator<rocblas_int>(0),
+                                            rf_splitLU_nzU_op{Mp, Mi});
 }
 
+/** RF_SPLITLU_COPY_KERNEL copies the entries of T into L and U, given the prefix sum of the
+    number of non-zero elements per row of U in Up[1:n]. The positions of the rows of L, as
+    well as Lp[0] = Up[0] = 0, are derived from Mp and Up in the same sweep.
+    (One virtual wave per row. The values of all the instances in the batch are copied by a
+    single grid; the sparsity patterns of L and U are written by the first instance only) **/
 template <typename T>
 ROCSOLVER_KERNEL void __launch_bounds__(BS1)
     rf_splitLU_copy_kernel(const rocblas_int n,
-                           const rocblas_int nnzM,
                            rocblas_int const* const __restrict__ Mp,
                            rocblas_int const* const __restrict__ Mi,
-                           T const* const __restrict__ Mx,
-                           rocblas_int const* const __restrict__ Lp,
+                           T const* const __restrict__ MxA,
+                           const rocblas_stride strideM,
+                           rocblas_int* const __restrict__ Lp,
                            rocblas_int* const __restrict__ Li,
-                           T* const __restrict__ Lx,
-                           rocblas_int const* const __restrict__ Up,
+                           T* const __restrict__ LxA,
+                           const rocblas_stride strideL,
+                           rocblas_int* const __restrict__ Up,
                            rocblas_int* const __restrict__ Ui,
-                           T* const __restrict__ Ux)
+                           T* const __restrict__ UxA,
+                           const rocblas_stride strideU)
 {
     rocblas_int wid = 0;
     rocblas_int lid = 0;
@@ -214,16 +135,36 @@ ROCSOLVER_KERNEL void __launch_bounds__(BS1)
 
     SPLITLU_SETUP_THREADS(lid, wid, waveSize, nwaves);
 
+    const rocblas_int bid = hipBlockIdx_y;
+    const bool first = (bid == 0);
+    T const* const Mx = MxA + bid * strideM;
+    T* const Lx = LxA + bid * strideL;
+    T* const Ux = UxA + bid * strideU;
+
     for(auto irow = wid; irow < n; irow += nwaves)
     {
         const auto kstart = Mp[irow];
         const auto kend = Mp[irow + 1];
-        const auto nz = (kend - kstart);
 
-        const auto nzU = (Up[irow + 1] - Up[irow]);
-        const auto nzL = nz - nzU;
+        // (Up[0] is set by this kernel, thus it is not read)
+        const auto ustart = (irow > 0) ? Up[irow] : 0;
+        const auto nzU = Up[irow + 1] - ustart;
+        const auto nzL = (kend - kstart) - nzU;
         const auto ubegin = kend - nzU; // start of upper triangular part
 
+        // Lp[irow] = (Mp[irow] - Mp[0]) - Up[irow] + irow (one unit diagonal per row)
+        const auto lstart = (kstart - Mp[0]) - ustart + irow;
+
+        if(first && lid == 0)
+        {
+            Lp[irow + 1] = lstart + nzL + 1;
+            if(irow == 0)
+            {
+                Lp[0] = 0;
+                Up[0] = 0;
+            }
+        }
+
         // ------------------------------------------------
         // Note: assume column indices are in increasing order
         // ------------------------------------------------
@@ -233,11 +174,10 @@ ROCSOLVER_KERNEL void __launch_bounds__(BS1)
         // ---------------------
         for(auto k = kstart + lid; k < ubegin; k += waveSize)
         {
-            const auto aij = Mx[k];
-            const auto icol = Mi[k];
-            const auto ip = Lp[irow] + (k - kstart);
-            Li[ip] = icol;
-            Lx[ip] = aij;
+            const auto ip = lstart + (k - kstart);
+            if(first)
+                Li[ip] = Mi[k];
+            Lx[ip] = Mx[k];
         }
 
         // ------------------------
@@ -245,8 +185,9 @@ ROCSOLVER_KERNEL void __launch_bounds__(BS1)
         // ------------------------
         if(lid == 0)
         {
-            const auto ip = Lp[irow + 1] - 1;
-            Li[ip] = irow;
+            const auto ip = lstart + nzL;
+            if(first)
+                Li[ip] = irow;
             Lx[ip] = static_cast<T>(1);
         }
 
@@ -255,204 +196,41 @@ ROCSOLVER_KERNEL void __launch_bounds__(BS1)
         // ---------------------
         for(auto k = ubegin + lid; k < kend; k += waveSize)
         {
-            const auto aij = Mx[k];
-            const auto icol = Mi[k];
-            const auto ip = Up[irow] + (k - ubegin);
-            Ui[ip] = icol;
-            Ux[ip] = aij;
+            const auto ip = ustart + (k - ubegin);
+            if(first)
+                Ui[ip] = Mi[k];
+            Ux[ip] = Mx[k];
         }
     } // end for irow
 }
 
-// ----------------------------------------------
-// Note: intended for execution on a single block
-// ----------------------------------------------
-template <typename T>
-ROCSOLVER_KERNEL void __launch_bounds__(BS1) rf_splitLU_kernel(const rocblas_int n,
-                                                               const rocblas_int nnzM,
-                                                               rocblas_int const* const Mp,
-                                                               rocblas_int const* const Mi,
-                                                               T const* const Mx,
-                                                               rocblas_int* const Lp,
-                                                               rocblas_int* const Li,
-                                                               T* const Lx,
-                                                               rocblas_int* const Up,
-                                                               rocblas_int* const Ui,
-                                                               T* const Ux,
-                                                               rocblas_int* work)
-{
-    if(hipBlockIdx_x != 0)
-    {
-        return;
-    }
-
-    rocblas_int wid = 0;
-    rocblas_int lid = 0;
-    rocblas_int waveSize = 0;
-    rocblas_int nwaves = 0;
-
-    SPLITLU_SETUP_THREADS(lid, wid, waveSize, nwaves);
-
-    auto const tid = hipThreadIdx_x + hipThreadIdx_y * hipBlockDim_x
-        + hipThreadIdx_z * (hipBlockDim_x * hipBlockDim_y);
-    auto const nthreads = (hipBlockDim_x * hipBlockDim_y) * hipBlockDim_z;
-
-    size_t const LDS_MAX_SIZE = 64 * 1024;
-    auto const N_MAX = LDS_MAX_SIZE / sizeof(rocblas_int);
-    __shared__ rocblas_int work_lds[N_MAX];
-
-    rocblas_int* const nnzUrow = (n <= N_MAX) ? &(work_lds[0]) : work;
-
-    // -------------------------------------------------
-    // 1st pass to determine number of non-zeros per row
-    // and set up Lp and Up
-    // -------------------------------------------------
-    __syncthreads();
-    for(auto irow = tid; irow < n; irow += nthreads)
-    {
-        nnzUrow[irow] = 0;
-    };
-    __syncthreads();
-
-    for(auto irow = wid; irow < n; irow += nwaves)
-    {
-        const rocblas_int istart = Mp[irow];
-        const rocblas_int iend = Mp[irow + 1];
-
-        rocblas_int lnnzUrow = 0;
-        for(auto i = istart + lid; i < iend; i += waveSize)
-        {
-            const auto icol = Mi[i];
-
-            bool const is_upper_triangular = (irow <= icol);
-            if(is_upper_triangular)
-            {
-                lnnzUrow += 1;
-            }
-        }
-        atomicAdd(&(nnzUrow[irow]), lnnzUrow);
-    }
-    __syncthreads();
-
-    // ---------------------------------
-    // prefix sum to setup Lp[] and Up[]
-    // ---------------------------------
-
-    __syncthreads();
-
-    if(tid == 0)
-    {
-        rocblas_int nnzL = 0;
-        rocblas_int nnzU = 0;
-
-        for(rocblas_int irow = 0; irow < n; irow++)
-        {
-            Lp[irow] = nnzL;
-            Up[irow] = nnzU;
-
-            const auto istart = Mp[irow];
-            const auto iend = Mp[irow + 1];
-            const auto nnzTrow = (iend - istart);
-
-            const auto nzUp_i = nnzUrow[irow];
-            const auto nzLp_i = (nnzTrow - nzUp_i) + 1; // add 1 for unit diagonal
-
-            nnzL += nzLp_i;
-            nnzU += nzUp_i;
-        }
-
-        Lp[n] = nnzL;
-        Up[n] = nnzU;
-    }
-    __syncthreads();
-#ifdef NDEBUG
-#else
-    {
-        // ------------------
-        // correctness  check
-        // ------------------
-        auto const nnzL = Lp[n] - Lp[0];
-        auto const nnzU = Up[n] - Up[0];
-        auto const nnzT = Mp[n] - Mp[0];
-        assert(nnzT == ((nnzL - n) + nnzU));
-    }
-#endif
-
-    // ------------------------------------
-    // 2nd pass to populate Li, Lx, Ui, Ux
-    // ------------------------------------
-    for(auto irow = wid; irow < n; irow += nwaves)
-    {
-        const auto istart = Mp[irow];
-        const auto iend = Mp[irow + 1];
-
-        auto const nnzUrow = Up[irow + 1] - Up[irow];
-        auto const Ustart = (iend - nnzUrow);
-        // --------------
-        // copy into L, U
-        // --------------
-        for(auto k = istart + lid; k < iend; k += waveSize)
-        {
-            const auto aij = Mx[k];
-            auto const icol = Mi[k];
-
-            bool const is_upper_triangular = (irow <= icol);
-            if(is_upper_triangular)
-            {
-                auto const offset = (k - Ustart);
-                auto const ip = Up[irow] + offset;
-                Ui[ip] = icol;
-                Ux[ip] = aij;
-            }
-            else
-            {
-                auto const offset = (k - istart);
-                auto const ip = Lp[irow] + offset;
-                Li[ip] = icol;
-                Lx[ip] = aij;
-            }
-        }
-    }
-
-    __syncthreads();
-    // -----------------------------
-    // set unit diagonal entry in L
-    // -----------------------------
-    for(auto irow = tid; irow < n; irow += nthreads)
-    {
-        const auto j = Lp[irow + 1] - 1;
-        Li[j] = irow;
-        Lx[j] = static_cast<T>(1);
-    }
-    __syncthreads();
-}
-
 template <typename T>
 rocblas_status rocsolver_csrrf_splitlu_getMemorySize(const rocblas_int n,
                                                      const rocblas_int nnzT,
                                                      rocblas_int* ptrT,
+                                                     rocblas_int* indT,
+                                                     const rocblas_int batch_count,
                                                      size_t* size_work)
 {
     // if quick return, no need of workspace
-    if(n == 0 || nnzT == 0)
+    if(n == 0 || batch_count == 0)
     {
         *size_work = 0;
         return rocblas_status_success;
     }
 
-    // space to store the number of non-zeros per row in L and U
-    const size_t size_work_LU = sizeof(rocblas_int) * 2 * n;
-
     // ------------------------------------------
     // query amount of temporary storage required
+    // by the prefix sum of the counts of U
     // ------------------------------------------
     size_t rocprim_size_bytes = 0;
     void* temp_ptr = nullptr;
 
-    HIP_CHECK(rocprim::inclusive_scan(temp_ptr, rocprim_size_bytes, ptrT, ptrT, n,
+    HIP_CHECK(rocprim::inclusive_scan(temp_ptr, rocprim_size_bytes,
+                                      rf_splitLU_nzU_iterator(ptrT, indT), ptrT, n,
                                       rocprim::plus<rocblas_int>()));
 
-    *size_work = (rocprim_size_bytes + size_work_LU);
+    *size_work = rocprim_size_bytes;
 
     return rocblas_status_success;
 }
@@ -469,7 +247,8 @@ rocblas_status rocsolver_csrrf_splitlu_argCheck(rocblas_handle handle,
                                                 T valL,
                                                 rocblas_int* ptrU,
                                                 rocblas_int* indU,
-                                                T valU)
+                                                T valU,
+                                                const rocblas_int batch_count = 1)
 {
     // order is important for unit tests:
 
@@ -481,7 +260,7 @@ rocblas_status rocsolver_csrrf_splitlu_argCheck(rocblas_handle handle,
     }
 
     // 2. invalid size
-    if(n < 0 || nnzT < 0)
+    if(n < 0 || nnzT < 0 || batch_count < 0)
         return rocblas_status_invalid_size;
 
     // skip pointer check if querying memory size
@@ -489,8 +268,8 @@ rocblas_status rocsolver_csrrf_splitlu_argCheck(rocblas_handle handle,
         return rocblas_status_continue;
 
     // 3. invalid pointers
-    if(!ptrL || !ptrU || !ptrT || (nnzT && (!indT || !valT || !indU || !valU))
-       || ((n || nnzT) && (!indL || !valL)))
+    if(!ptrL || !ptrU || !ptrT || (nnzT && (!indT || !indU || (batch_count && (!valT || !valU))))
+       || ((n || nnzT) && (!indL || (batch_count && !valL))))
         return rocblas_status_invalid_pointer;
 
     return rocblas_status_continue;
@@ -503,37 +282,43 @@ rocblas_status rocsolver_csrrf_splitlu_template(rocblas_handle handle,
                                                 rocblas_int* ptrT,
                                                 rocblas_int* indT,
                                                 U valT,
+                                                const rocblas_stride strideT,
                                                 rocblas_int* ptrL,
                                                 rocblas_int* indL,
                                                 U valL,
+                                                const rocblas_stride strideL,
                                                 rocblas_int* ptrU,
                                                 rocblas_int* indU,
                                                 U valU,
+                                                const rocblas_stride strideU,
+                                                const rocblas_int batch_count,
                                                 rocblas_int* work,
                                                 size_t size_work)
 {
-    ROCSOLVER_ENTER("csrrf_splitlu", "n:", n, "nnzT:", nnzT);
+    ROCSOLVER_ENTER("csrrf_splitlu", "n:", n, "nnzT:", nnzT, "bc:", batch_count);
 
     // quick return
-    if(n == 0)
+    if(n == 0 || batch_count == 0)
         return rocblas_status_success;
 
     hipStream_t stream;
     ROCBLAS_CHECK(rocblas_get_stream(handle, &stream));
 
-    // quick return with matrix zero
-    if(nnzT == 0)
+    // -------------------------------------------------------------
+    // the split is done in a single sweep over T:
+    // (1) the prefix sum of the number of non-zeros per row of U, generated on the fly
+    //     from the sparsity pattern of T, is written into ptrU[1:n],
+    // (2) a single kernel derives ptrL from ptrT and ptrU, and copies the entries of T
+    //     into L and U for all the instances in the batch.
+    // (matrix zero, nnzT = 0, requires no special treatment: L = I and U = 0)
+    // -------------------------------------------------------------
     {
-        // set ptrU = 0
-        const rocblas_int blocks = (n - 1) / BS1 + 1;
-        dim3 grid(blocks, 1, 1);
-        dim3 threads(BS1, 1, 1);
-        ROCSOLVER_LAUNCH_KERNEL(reset_info, grid, threads, 0, stream, ptrU, n + 1, 0);
-        ROCSOLVER_LAUNCH_KERNEL(reset_info, grid, threads, 0, stream, ptrL, n + 1, 0, 1);
-        ROCSOLVER_LAUNCH_KERNEL(reset_info, grid, threads, 0, stream, indL, n, 0, 1);
-        ROCSOLVER_LAUNCH_KERNEL(reset_info, grid, threads, 0, stream, valL, n, 1);
+        void* temp_ptr = static_cast<void*>(work);
+        size_t storage_size_bytes = size_work;
 
-        return rocblas_status_success;
+        HIP_CHECK(rocprim::inclusive_scan(temp_ptr, storage_size_bytes,
+                                          rf_splitLU_nzU_iterator(ptrT, indT), ptrU + 1, n,
+                                          rocprim::plus<rocblas_int>(), stream));
     }
 
     const rocblas_int avg_nnzM = std::max(1, nnzT / n);
@@ -543,81 +328,10 @@ rocblas_status rocsolver_csrrf_splitlu_template(rocblas_handle handle,
 
     assert(BS1 == (nx * ny));
 
-    bool const use_splitLU_kernel = (n <= SPLITLU_SWITCH_SIZE);
-
-    if(use_splitLU_kernel)
-    {
-        // --------------------------------
-        // note using a single thread block
-        // --------------------------------
-
-        const rocblas_int nblocks = 1;
-        ROCSOLVER_LAUNCH_KERNEL(rf_splitLU_kernel<T>, dim3(nblocks, 1, 1), dim3(nx, ny, 1), 0, stream,
-                                n, nnzT, ptrT, indT, valT, ptrL, indL, valL, ptrU, indU, valU, work);
-    }
-    else
-    {
-        rocblas_int const nblocks = std::max(1, std::min(1024, (n - 1) / BS1 + 1));
-
-        rocblas_int* const Lp = ptrL;
-        rocblas_int* const Up = ptrU;
-
-        // ------------------------------------------------
-        // setup number of nonzeros in each row of L and U
-        // note: reuse arrays Lp[] and Up[]
-        // ------------------------------------------------
-        HIP_CHECK(hipMemsetAsync(Lp, 0, sizeof(rocblas_int) * (n + 1), stream));
-        HIP_CHECK(hipMemsetAsync(Up, 0, sizeof(rocblas_int) * (n + 1), stream));
-
-        ROCSOLVER_LAUNCH_KERNEL(rf_splitLU_gen_nzLU_kernel<T>, dim3(nblocks, 1, 1), dim3(nx, ny, 1),
-                                0, stream, n, nnzT, ptrT, indT, Lp + 1, Up + 1);
-#ifdef NDEBUG
-#else
-        {
-            // ---------------------------------------------------
-            // double check result from rf_splitLU_gen_nzLU_kernel
-            // ---------------------------------------------------
-            ROCSOLVER_LAUNCH_KERNEL(check_nzLU_kernel<T>, dim3((n - 1) / BS1 + 1, 1, 1),
-                                    dim3(BS1, 1, 1), 0, stream, n, nnzT, ptrT, indT, Lp + 1, Up + 1);
-        }
-#endif
-
-        // -------------------------------------
-        // generate prefix sum for Lp[] and Up[]
-        // note: in-place prefix sum
-        // -------------------------
-        {
-            void* temp_ptr = static_cast<void*>(work);
-            size_t storage_size_bytes = size_work;
-
-            // ----------------------------------------
-            // perform inclusive scan for Lp[] and Up[]
-            // ----------------------------------------
-            HIP_CHECK(rocprim::inclusive_scan(temp_ptr, storage_size_bytes, (Lp + 1), (Lp + 1), n,
-                                              rocprim::plus<rocblas_int>(), stream));
-
-            HIP_CHECK(rocprim::inclusive_scan(temp_ptr, storage_size_bytes, (Up + 1), (Up + 1), n,
-                                              rocprim::plus<rocblas_int>(), stream));
-        }
-
-        // ------------------------
-        // set Lp[0] = 0, Up[0] = 0
-        // ------------------------
-        {
-            const rocblas_int ival = static_cast<rocblas_int>(0);
-
-            HIP_CHECK(hipMemcpyAsync(Lp, &ival, sizeof(rocblas_int), hipMemcpyHostToDevice, stream));
-
-            HIP_CHECK(hipMemcpyAsync(Up, &ival, sizeof(rocblas_int), hipMemcpyHostToDevice, stream));
-        }
-
-        // -----------------
-        // copy into L and U
-        // -----------------
-
-        ROCSOLVER_LAUNCH_KERNEL(rf_splitLU_copy_kernel<T>, dim3(nblocks, 1, 1), dim3(nx, ny, 1), 0,
-                                stream, n, nnzT, ptrT, indT, valT, Lp, indL, valL, Up, indU, valU);
-    }
+    const rocblas_int nblocks = std::max(1, std::min(1024, (n - 1) / ny + 1));
+    ROCSOLVER_LAUNCH_KERNEL(rf_splitLU_copy_kernel<T>, dim3(nblocks, batch_count, 1),
+                            dim3(nx, ny, 1), 0, stream, n, ptrT, indT, valT, strideT, ptrL, indL,
+                            valL, strideL, ptrU, indU, valU, strideU);
 
     return rocblas_status_success;
 }
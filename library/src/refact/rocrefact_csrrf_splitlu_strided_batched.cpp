@@ -0,0 +1,154 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#ifdef HAVE_ROCSPARSE
+#include "rocrefact_csrrf_splitlu.hpp"
+#endif
+
+#include "rocblas.hpp"
+#include "rocsolver/rocsolver.h"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+template <typename T, typename U>
+rocblas_status rocsolver_csrrf_splitlu_strided_batched_impl(rocblas_handle handle,
+                                                            const rocblas_int n,
+                                                            const rocblas_int nnzT,
+                                                            rocblas_int* ptrT,
+                                                            rocblas_int* indT,
+                                                            U valT,
+                                                            const rocblas_stride strideT,
+                                                            rocblas_int* ptrL,
+                                                            rocblas_int* indL,
+                                                            U valL,
+                                                            const rocblas_stride strideL,
+                                                            rocblas_int* ptrU,
+                                                            rocblas_int* indU,
+                                                            U valU,
+                                                            const rocblas_stride strideU,
+                                                            const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER_TOP("csrrf_splitlu_strided_batched", "-n", n, "--nnzT", nnzT, "--strideT",
+                        strideT, "--strideL", strideL, "--strideU", strideU, "--batch_count",
+                        batch_count);
+
+#ifdef HAVE_ROCSPARSE
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_csrrf_splitlu_argCheck(handle, n, nnzT, ptrT, indT, valT, ptrL,
+                                                         indL, valL, ptrU, indU, valU, batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+
+    // memory workspace sizes:
+    // size for the prefix sum of the number of non-zeros per row
+    size_t size_work = 0;
+
+    ROCBLAS_CHECK(
+        rocsolver_csrrf_splitlu_getMemorySize<T>(n, nnzT, ptrT, indT, batch_count, &size_work));
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_work);
+
+    // memory workspace allocation
+    void* work = nullptr;
+    rocblas_device_malloc mem(handle, size_work);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    work = mem[0];
+
+    // execution
+    return rocsolver_csrrf_splitlu_template<T>(handle, n, nnzT, ptrT, indT, valT, strideT, ptrL,
+                                               indL, valL, strideL, ptrU, indU, valU, strideU,
+                                               batch_count, static_cast<rocblas_int*>(work),
+                                               size_work);
+#else
+    return rocblas_status_not_implemented;
+#endif
+}
+
+ROCSOLVER_END_NAMESPACE
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_scsrrf_splitlu_strided_batched(rocblas_handle handle,
+                                                        const rocblas_int n,
+                                                        const rocblas_int nnzT,
+                                                        rocblas_int* ptrT,
+                                                        rocblas_int* indT,
+                                                        float* valT,
+                                                        const rocblas_stride strideT,
+                                                        rocblas_int* ptrL,
+                                                        rocblas_int* indL,
+                                                        float* valL,
+                                                        const rocblas_stride strideL,
+                                                        rocblas_int* ptrU,
+                                                        rocblas_int* indU,
+                                                        float* valU,
+                                                        const rocblas_stride strideU,
+                                                        const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_csrrf_splitlu_strided_batched_impl<float>(
+        handle, n, nnzT, ptrT, indT, valT, strideT, ptrL, indL, valL, strideL, ptrU, indU, valU,
+        strideU, batch_count);
+}
+
+rocblas_status rocsolver_dcsrrf_splitlu_strided_batched(rocblas_handle handle,
+                                                        const rocblas_int n,
+                                                        const rocblas_int nnzT,
+                                                        rocblas_int* ptrT,
+                                                        rocblas_int* indT,
+                                                        double* valT,
+                                                        const rocblas_stride strideT,
+                                                        rocblas_int* ptrL,
+                                                        rocblas_int* indL,
+                                                        double* valL,
+                                                        const rocblas_stride strideL,
+                                                        rocblas_int* ptrU,
+                                                        rocblas_int* indU,
+                                                        double* valU,
+                                                        const rocblas_stride strideU,
+                                                        const rocblas_int batch_count)
+{
+    return rocsolver::rocsolver_csrrf_splitlu_strided_batched_impl<double>(
+        handle, n, nnzT, ptrT, indT, valT, strideT, ptrL, indL, valL, strideL, ptrU, indU, valU,
+        strideU, batch_count);
+}
+
+} // extern C
@@ -0,0 +1,279 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <rocprim/rocprim.hpp>
+
+#include "rocblas.hpp"
+#include "rocsolver/rocsolver.h"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/** RF_SYMBOLIC_INIT_KERNEL computes the inverse permutation iperm of perm, and initializes
+    the first column of every row of the envelope to the diagonal. **/
+template <typename I>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1)
+    rf_symbolic_init_kernel(const I n,
+                            I const* const __restrict__ perm,
+                            I* const __restrict__ iperm,
+                            I* const __restrict__ first)
+{
+    const I k = hipBlockIdx_x * static_cast<I>(BS1) + hipThreadIdx_x;
+    if(k < n)
+    {
+        iperm[perm[k]] = k;
+        first[k] = k;
+    }
+}
+
+/** RF_SYMBOLIC_FIRST_KERNEL computes the first column of every row of the lower triangular
+    part of the re-ordered matrix P(M + M^T)P^T. Entry (i, j) of M becomes entry
+    (iperm[i], iperm[j]) of PMP^T, and it also lands in the lower triangular part of PM^TP^T
+    when iperm[j] > iperm[i]. (One thread per row of M) **/
+template <typename I>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1)
+    rf_symbolic_first_kernel(const I n,
+                             I const* const __restrict__ ptrM,
+                             I const* const __restrict__ indM,
+                             I const* const __restrict__ iperm,
+                             I* const first)
+{
+    const I i = hipBlockIdx_x * static_cast<I>(BS1) + hipThreadIdx_x;
+    if(i < n)
+    {
+        const I pi = iperm[i];
+        I fi = pi;
+        for(I k = ptrM[i]; k < ptrM[i + 1]; ++k)
+        {
+            const I pj = iperm[indM[k]];
+            if(pj < pi)
+                fi = std::min(fi, pj);
+            else if(pj > pi)
+                atomicMin(first + pj, pi);
+        }
+        if(fi < pi)
+            atomicMin(first + pi, fi);
+    }
+}
+
+/** RF_SYMBOLIC_REVERSE_OP reads the first columns of the envelope from the last row to the
+    first one; their prefix minimum gives the suffix minimum of the first columns, which is
+    non-decreasing with the row index. **/
+template <typename I>
+struct rf_symbolic_reverse_op
+{
+    I const* first;
+    I n;
+
+    __host__ __device__ I operator()(const I t) const
+    {
+        return first[n - 1 - t];
+    }
+};
+
+/** RF_SYMBOLIC_LEN_OP returns the number of non-zero elements in row i of T. Given the
+    non-decreasing first columns g (stored in reverse order in grev), row i of T spans the
+    columns from g[i] to the last row j with g[j] <= i, which is found by a binary search. **/
+template <typename I>
+struct rf_symbolic_len_op
+{
+    I const* grev;
+    I n;
+
+    __host__ __device__ I operator()(const I i) const
+    {
+        I lo = i;
+        I hi = n - 1;
+        while(lo < hi)
+        {
+            const I mid = hi - (hi - lo) / 2;
+            if(grev[n - 1 - mid] <= i)
+                lo = mid;
+            else
+                hi = mid - 1;
+        }
+        return lo - grev[n - 1 - i] + 1;
+    }
+};
+
+/** RF_SYMBOLIC_FILL_KERNEL writes the column indices of T, given the positions of its rows in
+    ptrT. (A virtual wave of hipBlockDim_x threads per row) **/
+template <typename I>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1)
+    rf_symbolic_fill_kernel(const I n,
+                            I const* const __restrict__ grev,
+                            I const* const __restrict__ ptrT,
+                            I* const __restrict__ indT)
+{
+    for(I i = hipBlockIdx_x * hipBlockDim_y + hipThreadIdx_y; i < n;
+        i += hipGridDim_x * hipBlockDim_y)
+    {
+        const I gi = grev[n - 1 - i];
+        const I start = ptrT[i];
+        const I len = ptrT[i + 1] - start;
+        for(I k = hipThreadIdx_x; k < len; k += hipBlockDim_x)
+            indT[start + k] = gi + k;
+    }
+}
+
+template <typename I>
+rocblas_status rocsolver_csrrf_symbolic_getMemorySize(const I n,
+                                                      const I nnzM,
+                                                      size_t* size_work,
+                                                      size_t* size_temp)
+{
+    // if quick return, no need of workspace
+    if(n == 0)
+    {
+        *size_work = 0;
+        *size_temp = 0;
+        return rocblas_status_success;
+    }
+
+    // inverse permutation, first columns and their suffix minimum
+    *size_work = sizeof(I) * 3 * size_t(n);
+
+    // temporary storage of the prefix min and the prefix sum
+    size_t min_bytes = 0, sum_bytes = 0;
+    I* iptr = nullptr;
+    auto grev = rocprim::make_transform_iterator(rocprim::make_counting_iterator<I>(0),
+                                                 rf_symbolic_reverse_op<I>{iptr, n});
+    auto lens = rocprim::make_transform_iterator(rocprim::make_counting_iterator<I>(0),
+                                                 rf_symbolic_len_op<I>{iptr, n});
+    HIP_CHECK(rocprim::inclusive_scan(nullptr, min_bytes, grev, iptr, n, rocprim::minimum<I>()));
+    HIP_CHECK(rocprim::inclusive_scan(nullptr, sum_bytes, lens, iptr, n, rocprim::plus<I>()));
+    *size_temp = std::max(min_bytes, sum_bytes);
+
+    return rocblas_status_success;
+}
+
+template <typename I>
+rocblas_status rocsolver_csrrf_symbolic_argCheck(rocblas_handle handle,
+                                                 const I n,
+                                                 const I nnzM,
+                                                 I* ptrM,
+                                                 I* indM,
+                                                 I* perm,
+                                                 I* ptrT)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+    if(handle == nullptr)
+    {
+        return rocblas_status_invalid_handle;
+    }
+
+    // 2. invalid size
+    if(n < 0 || nnzM < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    // (indT can be null when only ptrT is requested)
+    if(!ptrM || !ptrT || (nnzM && !indM) || (n && !perm))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename I>
+rocblas_status rocsolver_csrrf_symbolic_template(rocblas_handle handle,
+                                                 const I n,
+                                                 const I nnzM,
+                                                 I* ptrM,
+                                                 I* indM,
+                                                 I* perm,
+                                                 I* ptrT,
+                                                 I* indT,
+                                                 I* work,
+                                                 void* temp,
+                                                 size_t size_temp)
+{
+    ROCSOLVER_ENTER("csrrf_symbolic", "n:", n, "nnzM:", nnzM);
+
+    hipStream_t stream;
+    ROCBLAS_CHECK(rocblas_get_stream(handle, &stream));
+
+    HIP_CHECK(hipMemsetAsync(ptrT, 0, sizeof(I), stream));
+
+    // quick return
+    if(n == 0)
+        return rocblas_status_success;
+
+    I* iperm = work;
+    I* first = iperm + n;
+    I* grev = first + n;
+
+    const I blocksN = (n - 1) / BS1 + 1;
+
+    // -------------------------------------------------------------
+    // T is given by the envelope of P(M + M^T)P^T: row i of its lower triangular part spans
+    // the columns g[i] to i, where g is the suffix minimum of the first columns of the rows,
+    // and the upper triangular part is its transpose. Fill-in in a factorization without
+    // pivoting is confined to the envelope, and taking the suffix minimum makes every row of
+    // T contiguous at the price of a few more explicit zeros.
+    // -------------------------------------------------------------
+    ROCSOLVER_LAUNCH_KERNEL(rf_symbolic_init_kernel<I>, dim3(blocksN), dim3(BS1), 0, stream, n,
+                            perm, iperm, first);
+    ROCSOLVER_LAUNCH_KERNEL(rf_symbolic_first_kernel<I>, dim3(blocksN), dim3(BS1), 0, stream, n,
+                            ptrM, indM, iperm, first);
+    {
+        size_t storage_size_bytes = size_temp;
+        auto input = rocprim::make_transform_iterator(rocprim::make_counting_iterator<I>(0),
+                                                      rf_symbolic_reverse_op<I>{first, n});
+        HIP_CHECK(rocprim::inclusive_scan(temp, storage_size_bytes, input, grev, n,
+                                          rocprim::minimum<I>(), stream));
+    }
+    {
+        size_t storage_size_bytes = size_temp;
+        auto input = rocprim::make_transform_iterator(rocprim::make_counting_iterator<I>(0),
+                                                      rf_symbolic_len_op<I>{grev, n});
+        HIP_CHECK(rocprim::inclusive_scan(temp, storage_size_bytes, input, ptrT + 1, n,
+                                          rocprim::plus<I>(), stream));
+    }
+
+    // column indices
+    if(indT)
+    {
+        const I nx = 32;
+        const I ny = BS1 / nx;
+        const I nblocks = std::max(I(1), std::min(I(1024), (n - 1) / ny + 1));
+        ROCSOLVER_LAUNCH_KERNEL(rf_symbolic_fill_kernel<I>, dim3(nblocks), dim3(nx, ny), 0,
+                                stream, n, grev, ptrT, indT);
+    }
+
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
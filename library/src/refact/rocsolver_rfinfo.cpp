@@ -25,6 +25,8 @@
  * SUCH DAMAGE.
  * *************************************************************************/
 
+#include <cmath>
+#include <cstring>
 #include <new>
 
 #ifdef HAVE_ROCSPARSE
@@ -75,6 +77,7 @@ extern "C" rocblas_status rocsolver_create_rfinfo(rocsolver_rfinfo* rfinfo, rocb
     GOTO_IF_ROCSPARSE_ERROR(rocsparse_create_handle(&impl->sphandle), result, cleanup);
 
     // use handle->stream to sphandle->stream
+    // (the csrrf_* functions re-bind sphandle to the stream of the handle of every call)
     hipStream_t stream;
     GOTO_IF_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream), result, cleanup);
     GOTO_IF_ROCSPARSE_ERROR(rocsparse_set_stream(impl->sphandle, stream), result, cleanup);
@@ -82,6 +85,26 @@ extern "C" rocblas_status rocsolver_create_rfinfo(rocsolver_rfinfo* rfinfo, rocb
     // setup mode
     impl->mode = rocsolver_rfinfo_mode_lu;
     impl->analyzed = false;
+    impl->solve_mode = rocsolver_rfinfo_solve_mode_rocsparse;
+    impl->lvl_data = nullptr;
+    impl->lvl_size = 0;
+    impl->refact_mode = rocsolver_rfinfo_refact_mode_rocsparse;
+    impl->sn_data = nullptr;
+    impl->sn_size = 0;
+    impl->precision_mode = rocsolver_rfinfo_precision_mode_full;
+    impl->low_valT = nullptr;
+    impl->low_size = 0;
+    impl->low_bc = 0;
+    impl->pivot_threshold = 0;
+    impl->pivot_data = nullptr;
+    impl->pivot_size = 0;
+    impl->pivot_valA = nullptr;
+    impl->pivot_tol = nullptr;
+    impl->pivot_count = nullptr;
+    impl->pivot_bc = 0;
+    impl->pivot_active = false;
+    impl->qr_data = nullptr;
+    impl->qr_size = 0;
 
     // create and set matrix descriptors
 
@@ -154,6 +177,16 @@ extern "C" rocblas_status rocsolver_destroy_rfinfo(rocsolver_rfinfo rfinfo)
     ROCSPARSE_CHECK(rocsparse_destroy_mat_descr(rfinfo->descrL));
 
     ROCSPARSE_CHECK(rocsparse_destroy_handle(rfinfo->sphandle));
+    if(rfinfo->lvl_data && hipFree(rfinfo->lvl_data) != hipSuccess)
+        return rocblas_status_internal_error;
+    if(rfinfo->sn_data && hipFree(rfinfo->sn_data) != hipSuccess)
+        return rocblas_status_internal_error;
+    if(rfinfo->low_valT && hipFree(rfinfo->low_valT) != hipSuccess)
+        return rocblas_status_internal_error;
+    if(rfinfo->qr_data && hipFree(rfinfo->qr_data) != hipSuccess)
+        return rocblas_status_internal_error;
+    if(rfinfo->pivot_data && hipFree(rfinfo->pivot_data) != hipSuccess)
+        return rocblas_status_internal_error;
     delete rfinfo;
 
     return rocblas_status_success;
@@ -169,7 +202,8 @@ extern "C" rocblas_status rocsolver_set_rfinfo_mode(rocsolver_rfinfo rfinfo,
     if(!rfinfo)
         return rocblas_status_invalid_pointer;
 
-    if(mode != rocsolver_rfinfo_mode_lu && mode != rocsolver_rfinfo_mode_cholesky)
+    if(mode != rocsolver_rfinfo_mode_lu && mode != rocsolver_rfinfo_mode_cholesky
+       && mode != rocsolver_rfinfo_mode_qr)
         return rocblas_status_invalid_value;
 
     rfinfo->mode = mode;
@@ -205,3 +239,441 @@ extern "C" rocblas_status rocsolver_get_rfinfo_mode(rocsolver_rfinfo rfinfo,
     return rocblas_status_not_implemented;
 #endif
 }
+
+extern "C" rocblas_status rocsolver_set_rfinfo_solve_mode(rocsolver_rfinfo rfinfo,
+                                                          rocsolver_rfinfo_solve_mode solve_mode)
+{
+#ifdef HAVE_ROCSPARSE
+    if(!rfinfo)
+        return rocblas_status_invalid_pointer;
+
+    if(solve_mode != rocsolver_rfinfo_solve_mode_rocsparse
+       && solve_mode != rocsolver_rfinfo_solve_mode_levels)
+        return rocblas_status_invalid_value;
+
+    rfinfo->solve_mode = solve_mode;
+
+    return rocblas_status_success;
+#else
+    return rocblas_status_not_implemented;
+#endif
+}
+
+extern "C" rocblas_status rocsolver_get_rfinfo_solve_mode(rocsolver_rfinfo rfinfo,
+                                                          rocsolver_rfinfo_solve_mode* solve_mode)
+{
+#ifdef HAVE_ROCSPARSE
+    if(!rfinfo)
+        return rocblas_status_invalid_pointer;
+
+    if(!solve_mode)
+        return rocblas_status_invalid_pointer;
+
+    *solve_mode = rfinfo->solve_mode;
+
+    return rocblas_status_success;
+#else
+    return rocblas_status_not_implemented;
+#endif
+}
+
+extern "C" rocblas_status rocsolver_set_rfinfo_refact_mode(rocsolver_rfinfo rfinfo,
+                                                           rocsolver_rfinfo_refact_mode refact_mode)
+{
+#ifdef HAVE_ROCSPARSE
+    if(!rfinfo)
+        return rocblas_status_invalid_pointer;
+
+    if(refact_mode != rocsolver_rfinfo_refact_mode_rocsparse
+       && refact_mode != rocsolver_rfinfo_refact_mode_supernodal)
+        return rocblas_status_invalid_value;
+
+    rfinfo->refact_mode = refact_mode;
+
+    return rocblas_status_success;
+#else
+    return rocblas_status_not_implemented;
+#endif
+}
+
+extern "C" rocblas_status rocsolver_get_rfinfo_refact_mode(
+    rocsolver_rfinfo rfinfo, rocsolver_rfinfo_refact_mode* refact_mode)
+{
+#ifdef HAVE_ROCSPARSE
+    if(!rfinfo)
+        return rocblas_status_invalid_pointer;
+
+    if(!refact_mode)
+        return rocblas_status_invalid_pointer;
+
+    *refact_mode = rfinfo->refact_mode;
+
+    return rocblas_status_success;
+#else
+    return rocblas_status_not_implemented;
+#endif
+}
+
+extern "C" rocblas_status rocsolver_set_rfinfo_precision_mode(
+    rocsolver_rfinfo rfinfo, rocsolver_rfinfo_precision_mode precision_mode)
+{
+#ifdef HAVE_ROCSPARSE
+    if(!rfinfo)
+        return rocblas_status_invalid_pointer;
+
+    if(precision_mode != rocsolver_rfinfo_precision_mode_full
+       && precision_mode != rocsolver_rfinfo_precision_mode_mixed)
+        return rocblas_status_invalid_value;
+
+    rfinfo->precision_mode = precision_mode;
+
+    return rocblas_status_success;
+#else
+    return rocblas_status_not_implemented;
+#endif
+}
+
+extern "C" rocblas_status rocsolver_get_rfinfo_precision_mode(
+    rocsolver_rfinfo rfinfo, rocsolver_rfinfo_precision_mode* precision_mode)
+{
+#ifdef HAVE_ROCSPARSE
+    if(!rfinfo)
+        return rocblas_status_invalid_pointer;
+
+    if(!precision_mode)
+        return rocblas_status_invalid_pointer;
+
+    *precision_mode = rfinfo->precision_mode;
+
+    return rocblas_status_success;
+#else
+    return rocblas_status_not_implemented;
+#endif
+}
+
+extern "C" rocblas_status rocsolver_set_rfinfo_pivot_threshold(rocsolver_rfinfo rfinfo,
+                                                               const double threshold)
+{
+#ifdef HAVE_ROCSPARSE
+    if(!rfinfo)
+        return rocblas_status_invalid_pointer;
+
+    if(!(threshold >= 0 && std::isfinite(threshold)))
+        return rocblas_status_invalid_value;
+
+    rfinfo->pivot_threshold = threshold;
+
+    return rocblas_status_success;
+#else
+    return rocblas_status_not_implemented;
+#endif
+}
+
+extern "C" rocblas_status rocsolver_get_rfinfo_pivot_threshold(rocsolver_rfinfo rfinfo,
+                                                               double* threshold)
+{
+#ifdef HAVE_ROCSPARSE
+    if(!rfinfo)
+        return rocblas_status_invalid_pointer;
+
+    if(!threshold)
+        return rocblas_status_invalid_pointer;
+
+    *threshold = rfinfo->pivot_threshold;
+
+    return rocblas_status_success;
+#else
+    return rocblas_status_not_implemented;
+#endif
+}
+
+extern "C" rocblas_status rocsolver_get_rfinfo_perturbed_pivots(rocblas_handle handle,
+                                                                rocsolver_rfinfo rfinfo,
+                                                                rocblas_int* npert)
+{
+#ifdef HAVE_ROCSPARSE
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    if(!rfinfo)
+        return rocblas_status_invalid_pointer;
+
+    const rocblas_int bc = rfinfo->pivot_bc;
+    if(bc && !npert)
+        return rocblas_status_invalid_pointer;
+
+    if(bc == 0)
+        return rocblas_status_success;
+
+    // (stream-ordered device copy; no synchronization with the host)
+    hipStream_t stream;
+    ROCBLAS_CHECK(rocblas_get_stream(handle, &stream));
+    if(rfinfo->pivot_active)
+        HIP_CHECK(hipMemcpyAsync(npert, rfinfo->pivot_count, sizeof(rocblas_int) * bc,
+                                 hipMemcpyDeviceToDevice, stream));
+    else
+        HIP_CHECK(hipMemsetAsync(npert, 0, sizeof(rocblas_int) * bc, stream));
+
+    return rocblas_status_success;
+#else
+    return rocblas_status_not_implemented;
+#endif
+}
+
+#ifdef HAVE_ROCSPARSE
+ROCSOLVER_BEGIN_NAMESPACE
+
+// layout of an exported analysis: header, supernodes, level-scheduling arrays, and position
+// maps of the supernodes
+#define RF_EXPORT_MAGIC 0x66726c6f73636f72ull // "rocsolrf"
+#define RF_EXPORT_VERSION 1
+
+struct rf_export_header
+{
+    uint64_t magic;
+    uint32_t version;
+    int32_t n, nnzT;
+    uint64_t pattern_hash;
+    int32_t nlevL, nlevU;
+    int32_t sn_max_width, sn_max_nrows, sn_max_ncols;
+    uint64_t sn_max_panel;
+    uint64_t nsupernodes;
+    uint64_t lvl_size, sn_size;
+    // offsets of ptrL, colL, mapL, diagL, ordL, ptrU, colU, mapU, diagU and ordU in lvl_data
+    uint64_t lvl_offsets[10];
+};
+
+struct rf_export_supernode
+{
+    int32_t first, width, nrows, ncols;
+    // offset of mapD in sn_data
+    uint64_t offset;
+};
+
+// only the analysis computed by rocSOLVER can be exported
+static bool rf_exportable(rocsolver_rfinfo rfinfo)
+{
+    return rfinfo->analyzed && rfinfo->analyzed_mode == rocsolver_rfinfo_mode_lu
+        && rfinfo->analyzed_refact_mode == rocsolver_rfinfo_refact_mode_supernodal
+        && rfinfo->analyzed_solve_mode == rocsolver_rfinfo_solve_mode_levels;
+}
+
+rocblas_status rocsolver_export_rfinfo_impl(rocblas_handle handle,
+                                            rocsolver_rfinfo rfinfo,
+                                            void* buffer,
+                                            size_t* size)
+{
+    if(!rf_exportable(rfinfo))
+        return rocblas_status_invalid_value;
+
+    const rocblas_int n = rfinfo->analyzed_n;
+    const std::vector<rocsolver_rfinfo_supernode>& sns = rfinfo->supernodes;
+
+    rf_export_header h = {};
+    h.magic = RF_EXPORT_MAGIC;
+    h.version = RF_EXPORT_VERSION;
+    h.n = n;
+    h.nnzT = rfinfo->analyzed_nnzT;
+    h.pattern_hash = rfinfo->pattern_hash;
+    h.nlevL = rfinfo->nlevL;
+    h.nlevU = rfinfo->nlevU;
+    h.sn_max_width = rfinfo->sn_max_width;
+    h.sn_max_nrows = rfinfo->sn_max_nrows;
+    h.sn_max_ncols = rfinfo->sn_max_ncols;
+    h.sn_max_panel = rfinfo->sn_max_panel;
+    h.nsupernodes = sns.size();
+
+    // (the last arrays in the device buffers are ordU and the maps of the last supernode)
+    h.lvl_size = sizeof(rocblas_int) * (rfinfo->ordU + n - rfinfo->lvl_data);
+    const rocsolver_rfinfo_supernode& last = sns.back();
+    h.sn_size = sizeof(rocblas_int) * (last.mapG + last.nrows * last.ncols - rfinfo->sn_data);
+
+    rocblas_int* lvl[10] = {rfinfo->ptrL, rfinfo->colL, rfinfo->mapL, rfinfo->diagL, rfinfo->ordL,
+                            rfinfo->ptrU, rfinfo->colU, rfinfo->mapU, rfinfo->diagU, rfinfo->ordU};
+    for(int k = 0; k < 10; ++k)
+        h.lvl_offsets[k] = lvl[k] - rfinfo->lvl_data;
+
+    const size_t size_sn = sizeof(rf_export_supernode) * h.nsupernodes;
+    const size_t total = sizeof(rf_export_header) + size_sn + h.lvl_size + h.sn_size;
+
+    // size query
+    if(!buffer)
+    {
+        *size = total;
+        return rocblas_status_success;
+    }
+    if(*size < total)
+        return rocblas_status_invalid_size;
+
+    char* dst = static_cast<char*>(buffer);
+    std::memcpy(dst, &h, sizeof(rf_export_header));
+    dst += sizeof(rf_export_header);
+    for(const rocsolver_rfinfo_supernode& sn : sns)
+    {
+        rf_export_supernode e = {sn.first, sn.width, sn.nrows, sn.ncols,
+                                 uint64_t(sn.mapD - rfinfo->sn_data)};
+        std::memcpy(dst, &e, sizeof(rf_export_supernode));
+        dst += sizeof(rf_export_supernode);
+    }
+
+    hipStream_t stream;
+    ROCBLAS_CHECK(rocblas_get_stream(handle, &stream));
+    HIP_CHECK(hipMemcpyAsync(dst, rfinfo->lvl_data, h.lvl_size, hipMemcpyDeviceToHost, stream));
+    HIP_CHECK(hipMemcpyAsync(dst + h.lvl_size, rfinfo->sn_data, h.sn_size, hipMemcpyDeviceToHost,
+                             stream));
+    HIP_CHECK(hipStreamSynchronize(stream));
+
+    *size = total;
+    return rocblas_status_success;
+}
+
+rocblas_status rocsolver_import_rfinfo_impl(rocblas_handle handle,
+                                            const rocblas_int n,
+                                            const rocblas_int nnzT,
+                                            rocblas_int* ptrT,
+                                            rocblas_int* indT,
+                                            const void* buffer,
+                                            const size_t size,
+                                            rocsolver_rfinfo rfinfo)
+{
+    // check the header
+    rf_export_header h;
+    if(size < sizeof(rf_export_header))
+        return rocblas_status_invalid_size;
+    const char* src = static_cast<const char*>(buffer);
+    std::memcpy(&h, src, sizeof(rf_export_header));
+    src += sizeof(rf_export_header);
+
+    if(h.magic != RF_EXPORT_MAGIC || h.version != RF_EXPORT_VERSION || h.n != n || h.nnzT != nnzT)
+        return rocblas_status_invalid_value;
+    const size_t size_sn = sizeof(rf_export_supernode) * h.nsupernodes;
+    if(size < sizeof(rf_export_header) + size_sn + h.lvl_size + h.sn_size)
+        return rocblas_status_invalid_size;
+
+    // the sparsity pattern of T must be the one that was analyzed
+    hipStream_t stream;
+    ROCBLAS_CHECK(rocblas_get_stream(handle, &stream));
+    std::vector<rocblas_int> hptrT(n + 1), hindT(nnzT);
+    HIP_CHECK(hipMemcpyAsync(hptrT.data(), ptrT, sizeof(rocblas_int) * (n + 1),
+                             hipMemcpyDeviceToHost, stream));
+    if(nnzT > 0)
+        HIP_CHECK(hipMemcpyAsync(hindT.data(), indT, sizeof(rocblas_int) * nnzT,
+                                 hipMemcpyDeviceToHost, stream));
+    HIP_CHECK(hipStreamSynchronize(stream));
+    if(rf_pattern_hash(n, nnzT, hptrT.data(), hindT.data()) != h.pattern_hash)
+        return rocblas_status_invalid_value;
+
+    // copy the arrays to the device buffers owned by rfinfo
+    if(h.lvl_size > rfinfo->lvl_size)
+    {
+        if(rfinfo->lvl_data)
+            HIP_CHECK(hipFree(rfinfo->lvl_data));
+        rfinfo->lvl_data = nullptr;
+        rfinfo->lvl_size = 0;
+        HIP_CHECK(hipMalloc(&rfinfo->lvl_data, h.lvl_size));
+        rfinfo->lvl_size = h.lvl_size;
+    }
+    if(h.sn_size > rfinfo->sn_size)
+    {
+        if(rfinfo->sn_data)
+            HIP_CHECK(hipFree(rfinfo->sn_data));
+        rfinfo->sn_data = nullptr;
+        rfinfo->sn_size = 0;
+        HIP_CHECK(hipMalloc(&rfinfo->sn_data, h.sn_size));
+        rfinfo->sn_size = h.sn_size;
+    }
+    const char* data = src + size_sn;
+    HIP_CHECK(hipMemcpyAsync(rfinfo->lvl_data, data, h.lvl_size, hipMemcpyHostToDevice, stream));
+    HIP_CHECK(hipMemcpyAsync(rfinfo->sn_data, data + h.lvl_size, h.sn_size, hipMemcpyHostToDevice,
+                             stream));
+
+    rocblas_int** lvl[10] = {&rfinfo->ptrL, &rfinfo->colL, &rfinfo->mapL, &rfinfo->diagL,
+                             &rfinfo->ordL, &rfinfo->ptrU, &rfinfo->colU, &rfinfo->mapU,
+                             &rfinfo->diagU, &rfinfo->ordU};
+    for(int k = 0; k < 10; ++k)
+        *lvl[k] = rfinfo->lvl_data + h.lvl_offsets[k];
+    rfinfo->nlevL = h.nlevL;
+    rfinfo->nlevU = h.nlevU;
+
+    rfinfo->supernodes.resize(h.nsupernodes);
+    for(rocsolver_rfinfo_supernode& sn : rfinfo->supernodes)
+    {
+        rf_export_supernode e;
+        std::memcpy(&e, src, sizeof(rf_export_supernode));
+        src += sizeof(rf_export_supernode);
+        sn.first = e.first;
+        sn.width = e.width;
+        sn.nrows = e.nrows;
+        sn.ncols = e.ncols;
+        sn.mapD = rfinfo->sn_data + e.offset;
+        sn.mapL = sn.mapD + sn.width * (sn.width + sn.ncols);
+        sn.mapG = sn.mapL + sn.nrows * sn.width;
+    }
+    rfinfo->sn_max_width = h.sn_max_width;
+    rfinfo->sn_max_nrows = h.sn_max_nrows;
+    rfinfo->sn_max_ncols = h.sn_max_ncols;
+    rfinfo->sn_max_panel = h.sn_max_panel;
+    HIP_CHECK(hipStreamSynchronize(stream));
+
+    // rfinfo is now in the state left by csrrf_analysis
+    rfinfo->mode = rocsolver_rfinfo_mode_lu;
+    rfinfo->solve_mode = rocsolver_rfinfo_solve_mode_levels;
+    rfinfo->refact_mode = rocsolver_rfinfo_refact_mode_supernodal;
+    rfinfo->analyzed = true;
+    rfinfo->analyzed_mode = rfinfo->mode;
+    rfinfo->analyzed_solve_mode = rfinfo->solve_mode;
+    rfinfo->analyzed_refact_mode = rfinfo->refact_mode;
+    rfinfo->low_bc = 0;
+    rfinfo->analyzed_n = n;
+    rfinfo->analyzed_nnzT = nnzT;
+    rfinfo->pattern_hash = h.pattern_hash;
+
+    return rocblas_status_success;
+}
+
+ROCSOLVER_END_NAMESPACE
+#endif
+
+extern "C" rocblas_status rocsolver_export_rfinfo(rocblas_handle handle,
+                                                  rocsolver_rfinfo rfinfo,
+                                                  void* buffer,
+                                                  size_t* size)
+{
+#ifdef HAVE_ROCSPARSE
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    if(!rfinfo || !size)
+        return rocblas_status_invalid_pointer;
+
+    return rocsolver::rocsolver_export_rfinfo_impl(handle, rfinfo, buffer, size);
+#else
+    return rocblas_status_not_implemented;
+#endif
+}
+
+extern "C" rocblas_status rocsolver_import_rfinfo(rocblas_handle handle,
+                                                  const rocblas_int n,
+                                                  const rocblas_int nnzT,
+                                                  rocblas_int* ptrT,
+                                                  rocblas_int* indT,
+                                                  const void* buffer,
+                                                  const size_t size,
+                                                  rocsolver_rfinfo rfinfo)
+{
+#ifdef HAVE_ROCSPARSE
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    if(n < 0 || nnzT < 0)
+        return rocblas_status_invalid_size;
+
+    if(!rfinfo || !buffer || !ptrT || (nnzT && !indT))
+        return rocblas_status_invalid_pointer;
+
+    return rocsolver::rocsolver_import_rfinfo_impl(handle, n, nnzT, ptrT, indT, buffer, size,
+                                                   rfinfo);
+#else
+    return rocblas_status_not_implemented;
+#endif
+}
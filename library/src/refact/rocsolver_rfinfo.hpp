@@ -31,6 +31,35 @@
 #include "rocsolver/rocsolver.h"
 #include "rocsparse.hpp"
 
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+// a supernode of the LU factorization: the columns first, ..., first + width - 1 of L (and the
+// same rows of U) share their sparsity pattern outside of the dense diagonal block D
+struct rocsolver_rfinfo_supernode
+{
+    rocblas_int first, width;
+    // number of rows of L and of columns of U outside of the diagonal block
+    rocblas_int nrows, ncols;
+    // positions in valT of the entries of the column-major panels [D U] (width-by-(width +
+    // ncols)) and L (nrows-by-width), and of the update L * U (nrows-by-ncols; -1 for the
+    // entries that are not in the sparsity pattern of T)
+    rocblas_int *mapD, *mapL, *mapG;
+};
+
+// a group of fronts of the supernodal Cholesky factorization that are factorized together by
+// batched dense kernels: the supernodes of the same level of the elimination tree whose blocks,
+// padded to width-by-width (D) and nrows-by-width (L), have the same size
+struct rocsolver_rfinfo_front_group
+{
+    rocblas_int nfronts, width, nrows;
+    // positions in valT of the entries of the column-major blocks D, L and L * L' (nrows-by-nrows)
+    // of every front, stored one front after the other (-1 for the entries that are not in the
+    // sparsity pattern of T or in its lower triangular part, and -2 for the padded diagonal of D)
+    rocblas_int* map;
+};
+
 struct rocsolver_rfinfo_
 {
     rocsparse_handle sphandle;
@@ -48,4 +77,115 @@ struct rocsolver_rfinfo_
 
     rocsolver_rfinfo_mode mode, analyzed_mode;
     bool analyzed;
+    // size and hash of the sparsity pattern of T used by csrrf_analysis (the hash is only
+    // computed when the analysis is done by rocSOLVER, i.e. for the supernodal re-factorization
+    // or the level-scheduled solves)
+    rocblas_int analyzed_n, analyzed_nnzT;
+    uint64_t pattern_hash;
+
+    // level scheduling of the triangular solves (used when solve_mode is
+    // rocsolver_rfinfo_solve_mode_levels; the arrays are built by csrrf_analysis
+    // and live in the device buffer lvl_data, owned by rfinfo)
+    rocsolver_rfinfo_solve_mode solve_mode, analyzed_solve_mode;
+    rocblas_int* lvl_data;
+    size_t lvl_size;
+    rocblas_int nlevL, nlevU;
+    // for each factor F = L, U: row pointers, column indices, and positions in valT of the
+    // off-diagonal entries of every row of F; position in valT of the diagonal of every row
+    // (or -1 if unit diagonal); and the rows of F sorted by level
+    rocblas_int *ptrL, *colL, *mapL, *diagL, *ordL;
+    rocblas_int *ptrU, *colU, *mapU, *diagU, *ordU;
+
+    // supernodal re-factorization (used when refact_mode is
+    // rocsolver_rfinfo_refact_mode_supernodal; the supernodes are detected by csrrf_analysis,
+    // and their position maps live in the device buffer sn_data, owned by rfinfo)
+    rocsolver_rfinfo_refact_mode refact_mode, analyzed_refact_mode;
+    rocblas_int* sn_data;
+    size_t sn_size;
+    std::vector<rocsolver_rfinfo_supernode> supernodes;
+    // (in mode rocsolver_rfinfo_mode_cholesky, the supernodes are stored as groups of fronts,
+    // sorted by level)
+    std::vector<rocsolver_rfinfo_front_group> fronts;
+    // largest dimensions of the supernodes, and largest size of their panels [D U], L and L * U
+    // (or of the blocks of all the fronts of a group)
+    rocblas_int sn_max_width, sn_max_nrows, sn_max_ncols;
+    size_t sn_max_panel;
+
+    // mixed-precision re-factorization (used when precision_mode is
+    // rocsolver_rfinfo_precision_mode_mixed; the single precision factors of the last
+    // re-factorized batch, with nnzT elements per matrix, live in the device buffer low_valT,
+    // owned by rfinfo, and valT keeps the re-ordered matrix in double precision)
+    rocsolver_rfinfo_precision_mode precision_mode;
+    float* low_valT;
+    size_t low_size;
+    // number of matrices in the batch whose single precision factors are up to date
+    rocblas_int low_bc;
+
+    // static pivoting of csrrf_refactlu (used when pivot_threshold > 0): the pivots smaller than
+    // pivot_threshold * ||P*A*Q||_inf in magnitude are replaced by this value (with their sign).
+    // The device buffer pivot_data, owned by rfinfo, holds the copy of the re-ordered matrices
+    // used by the iterative refinement of csrrf_solve (pivot_valA, with nnzT elements per
+    // matrix, only when rf_pivot_refine is true), the tolerances (pivot_tol), and the number of
+    // perturbed pivots (pivot_count) of the pivot_bc matrices of the last re-factorized batch
+    double pivot_threshold;
+    void* pivot_data;
+    size_t pivot_size;
+    void* pivot_valA;
+    void* pivot_tol;
+    rocblas_int* pivot_count;
+    rocblas_int pivot_bc;
+    // whether the last re-factorization used static pivoting
+    bool pivot_active;
+
+    // QR re-factorization (used when mode is rocsolver_rfinfo_mode_qr; the structures are built
+    // by csrrf_analysisqr and live in the device buffer qr_data, owned by rfinfo)
+    rocblas_int analyzed_m;
+    rocblas_int* qr_data;
+    size_t qr_size;
+    // rows of R = L' (the columns of the lower triangular part of T, diagonal first) with their
+    // positions in valT, parent of every column in the column elimination tree (or -1 for the
+    // roots), and inverse of the column permutation Q
+    rocblas_int *ptrR, *colR, *posR, *parentR, *invQ;
 };
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/** RF_PATTERN_HASH computes the 64-bit FNV-1a hash of the sparsity pattern of an n-by-n CSR
+    matrix with nnz non-zero elements (host arrays). **/
+inline uint64_t rf_pattern_hash(const rocblas_int n,
+                                const rocblas_int nnz,
+                                const rocblas_int* ptr,
+                                const rocblas_int* ind)
+{
+    uint64_t h = 14695981039346656037ull;
+    auto add = [&h](const rocblas_int v) {
+        for(int b = 0; b < 4; ++b)
+        {
+            h ^= (uint32_t(v) >> (8 * b)) & 0xff;
+            h *= 1099511628211ull;
+        }
+    };
+    add(n);
+    add(nnz);
+    for(rocblas_int i = 0; i <= n; ++i)
+        add(ptr[i]);
+    for(rocblas_int k = 0; k < nnz; ++k)
+        add(ind[k]);
+    return h;
+}
+
+/** RF_PIVOT_REFINE returns whether the solutions computed by csrrf_solve with the factors of a
+    static-pivoting re-factorization are improved by iterative refinement (only with the
+    level-scheduled solves; in mixed precision, the refinement is always done). **/
+template <typename T>
+inline bool rf_pivot_refine(rocsolver_rfinfo rfinfo)
+{
+    if(std::is_same<T, double>::value
+       && rfinfo->precision_mode == rocsolver_rfinfo_precision_mode_mixed)
+        return false;
+
+    return rfinfo->pivot_threshold > 0 && rfinfo->mode == rocsolver_rfinfo_mode_lu
+        && rfinfo->solve_mode == rocsolver_rfinfo_solve_mode_levels;
+}
+
+ROCSOLVER_END_NAMESPACE
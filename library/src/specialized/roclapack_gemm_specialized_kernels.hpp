@@ -28,6 +28,7 @@
 #pragma once
 
 #include "rocsolver_run_specialized_kernels.hpp"
+#include "rocsolver_stats.hpp"
 
 #include <climits>
 
@@ -81,6 +82,386 @@ ROCSOLVER_KERNEL void gemm_noconj_kernel(const I m,
     }
 }
 
+/** Tile geometry of the small-GEMM kernel: each thread block of GEMM_SMALL_DIM x GEMM_SMALL_DIM
+    threads computes a GEMM_SMALL_TILE x GEMM_SMALL_TILE tile of C, and each thread a
+    GEMM_SMALL_REG x GEMM_SMALL_REG block of the tile, with the inner dimension traversed in
+    chunks of GEMM_SMALL_KC **/
+#define GEMM_SMALL_DIM 16
+#define GEMM_SMALL_REG 4
+#define GEMM_SMALL_TILE (GEMM_SMALL_DIM * GEMM_SMALL_REG)
+#define GEMM_SMALL_KC 16
+
+/** The rank-KC updates of the small-GEMM kernel use the 16x16x4 matrix-core (MFMA) instructions
+    when the target architecture has them: FP64 on gfx90a and gfx94x/gfx950, and FP32 on gfx908
+    or later. On the other architectures (e.g. RDNA), and for the complex types, the updates are
+    computed with scalar FMAs. **/
+#if defined(__gfx90a__) || defined(__gfx940__) || defined(__gfx941__) || defined(__gfx942__) \
+    || defined(__gfx950__)
+#define GEMM_SMALL_MFMA_F64 1
+#define GEMM_SMALL_MFMA_F32 1
+#elif defined(__gfx908__)
+#define GEMM_SMALL_MFMA_F32 1
+#endif
+
+template <typename T>
+constexpr bool gemm_small_mfma()
+{
+#if defined(GEMM_SMALL_MFMA_F64)
+    return std::is_same<T, double>::value || std::is_same<T, float>::value;
+#elif defined(GEMM_SMALL_MFMA_F32)
+    return std::is_same<T, float>::value;
+#else
+    return false;
+#endif
+}
+
+template <typename T>
+struct gemm_small_mfma_acc;
+template <>
+struct gemm_small_mfma_acc<float>
+{
+    typedef float type __attribute__((ext_vector_type(4)));
+};
+template <>
+struct gemm_small_mfma_acc<double>
+{
+    typedef double type __attribute__((ext_vector_type(4)));
+};
+
+/** GEMM_SMALL_MFMA_16X16X4 accumulates into c the 16x16 block of a 16x4 times 4x16 product.
+    Lane l of the wavefront provides the entries a = A[l % 16][l / 16] and b = B[l / 16][l % 16],
+    and holds the entries C[4 * (l / 16) + r][l % 16] of the block, with r = 0, ..., 3. **/
+__device__ inline void
+    gemm_small_mfma_16x16x4(float a, float b, gemm_small_mfma_acc<float>::type& c)
+{
+#if defined(GEMM_SMALL_MFMA_F32)
+    c = __builtin_amdgcn_mfma_f32_16x16x4f32(a, b, c, 0, 0, 0);
+#endif
+}
+
+__device__ inline void
+    gemm_small_mfma_16x16x4(double a, double b, gemm_small_mfma_acc<double>::type& c)
+{
+#if defined(GEMM_SMALL_MFMA_F64)
+    c = __builtin_amdgcn_mfma_f64_16x16x4f64(a, b, c, 0, 0, 0);
+#endif
+}
+
+/** GEMM_SMALL_KERNEL computes C = alpha * op(A) * op(B) + beta * C for batches of small matrices.
+    The chunks of op(A) and op(B) are staged in LDS (with the reads coalesced for every
+    operation), and the entries of the tile of C are accumulated in registers. As in rocBLAS, C
+    is not read when beta = 0.
+
+    Call this kernel with 'batch_count' groups in z, and enough groups in x and y to cover
+    all the 'm' rows and 'n' columns of C with tiles of GEMM_SMALL_TILE x GEMM_SMALL_TILE.
+    There should be GEMM_SMALL_DIM x GEMM_SMALL_DIM threads per group. **/
+template <typename T, typename I, typename V, typename U1, typename U2, typename U3>
+ROCSOLVER_KERNEL void __launch_bounds__(GEMM_SMALL_DIM * GEMM_SMALL_DIM)
+    gemm_small_kernel(const rocblas_operation transA,
+                      const rocblas_operation transB,
+                      const I m,
+                      const I n,
+                      const I k,
+                      V alpha,
+                      U1 AA,
+                      rocblas_stride shiftA,
+                      I lda,
+                      rocblas_stride strideA,
+                      U2 BB,
+                      rocblas_stride shiftB,
+                      I ldb,
+                      rocblas_stride strideB,
+                      V beta,
+                      U3 CC,
+                      rocblas_stride shiftC,
+                      I ldc,
+                      rocblas_stride strideC)
+{
+    // indices
+    I bid = hipBlockIdx_z;
+    I tx = hipThreadIdx_x;
+    I ty = hipThreadIdx_y;
+    I tid = tx + ty * GEMM_SMALL_DIM;
+    I i0 = hipBlockIdx_x * GEMM_SMALL_TILE;
+    I j0 = hipBlockIdx_y * GEMM_SMALL_TILE;
+
+    // batch instance
+    T a = load_scalar(alpha, bid, 0);
+    T b = load_scalar(beta, bid, 0);
+    T* A = load_ptr_batch(AA, bid, shiftA, strideA);
+    T* B = load_ptr_batch(BB, bid, shiftB, strideB);
+    T* C = load_ptr_batch(CC, bid, shiftC, strideC);
+
+    // chunks of op(A) and op(B), stored by columns of op(A) and rows of op(B)
+    __shared__ T sA[GEMM_SMALL_KC][GEMM_SMALL_TILE + 1];
+    __shared__ T sB[GEMM_SMALL_KC][GEMM_SMALL_TILE + 1];
+
+    // with MFMA, wavefront w accumulates the 16 x GEMM_SMALL_TILE strip w of the tile, in
+    // GEMM_SMALL_REG blocks of 16 x 16 (the same number of registers as the scalar blocks)
+    using Tv = std::conditional_t<gemm_small_mfma<T>(), T, float>;
+    using Acc = typename gemm_small_mfma_acc<Tv>::type;
+    const I wave = tid / 64;
+    const I lane = tid % 64;
+    Acc vacc[GEMM_SMALL_REG];
+
+    static_assert(GEMM_SMALL_DIM == 16 && GEMM_SMALL_REG == 4 && GEMM_SMALL_KC % 4 == 0);
+
+    T acc[GEMM_SMALL_REG][GEMM_SMALL_REG];
+    for(I r = 0; r < GEMM_SMALL_REG; r++)
+    {
+        for(I c = 0; c < GEMM_SMALL_REG; c++)
+        {
+            acc[r][c] = 0;
+            vacc[r][c] = 0;
+        }
+    }
+
+    for(I k0 = 0; k0 < k; k0 += GEMM_SMALL_KC)
+    {
+        // load op(A)(i0:i0+TILE-1, k0:k0+KC-1), walking along the columns of A
+        for(I e = tid; e < GEMM_SMALL_TILE * GEMM_SMALL_KC; e += GEMM_SMALL_DIM * GEMM_SMALL_DIM)
+        {
+            I ii, kk;
+            if(transA == rocblas_operation_none)
+            {
+                ii = e % GEMM_SMALL_TILE;
+                kk = e / GEMM_SMALL_TILE;
+            }
+            else
+            {
+                kk = e % GEMM_SMALL_KC;
+                ii = e / GEMM_SMALL_KC;
+            }
+
+            T v = 0;
+            if(i0 + ii < m && k0 + kk < k)
+            {
+                if(transA == rocblas_operation_none)
+                    v = A[(i0 + ii) + (k0 + kk) * lda];
+                else if(transA == rocblas_operation_transpose)
+                    v = A[(k0 + kk) + (i0 + ii) * lda];
+                else
+                    v = conj(A[(k0 + kk) + (i0 + ii) * lda]);
+            }
+            sA[kk][ii] = v;
+        }
+
+        // load op(B)(k0:k0+KC-1, j0:j0+TILE-1), walking along the columns of B
+        for(I e = tid; e < GEMM_SMALL_TILE * GEMM_SMALL_KC; e += GEMM_SMALL_DIM * GEMM_SMALL_DIM)
+        {
+            I jj, kk;
+            if(transB == rocblas_operation_none)
+            {
+                kk = e % GEMM_SMALL_KC;
+                jj = e / GEMM_SMALL_KC;
+            }
+            else
+            {
+                jj = e % GEMM_SMALL_TILE;
+                kk = e / GEMM_SMALL_TILE;
+            }
+
+            T v = 0;
+            if(j0 + jj < n && k0 + kk < k)
+            {
+                if(transB == rocblas_operation_none)
+                    v = B[(k0 + kk) + (j0 + jj) * ldb];
+                else if(transB == rocblas_operation_transpose)
+                    v = B[(j0 + jj) + (k0 + kk) * ldb];
+                else
+                    v = conj(B[(j0 + jj) + (k0 + kk) * ldb]);
+            }
+            sB[kk][jj] = v;
+        }
+        __syncthreads();
+
+        // rank-KC update of the block of the tile in registers
+        if constexpr(gemm_small_mfma<T>())
+        {
+            for(I kk = 0; kk < GEMM_SMALL_KC; kk += 4)
+            {
+                T ra = sA[kk + lane / 16][wave * 16 + lane % 16];
+                for(I c = 0; c < GEMM_SMALL_REG; c++)
+                    gemm_small_mfma_16x16x4(ra, sB[kk + lane / 16][c * 16 + lane % 16], vacc[c]);
+            }
+        }
+        else
+        {
+            for(I kk = 0; kk < GEMM_SMALL_KC; kk++)
+            {
+                T ra[GEMM_SMALL_REG], rb[GEMM_SMALL_REG];
+                for(I r = 0; r < GEMM_SMALL_REG; r++)
+                    ra[r] = sA[kk][tx + r * GEMM_SMALL_DIM];
+                for(I c = 0; c < GEMM_SMALL_REG; c++)
+                    rb[c] = sB[kk][ty + c * GEMM_SMALL_DIM];
+                for(I r = 0; r < GEMM_SMALL_REG; r++)
+                    for(I c = 0; c < GEMM_SMALL_REG; c++)
+                        acc[r][c] += ra[r] * rb[c];
+            }
+        }
+        __syncthreads();
+    }
+
+    // write back the block of the tile
+    if constexpr(gemm_small_mfma<T>())
+    {
+        for(I c = 0; c < GEMM_SMALL_REG; c++)
+            for(I r = 0; r < 4; r++)
+                acc[r][c] = vacc[c][r];
+    }
+    for(I c = 0; c < GEMM_SMALL_REG; c++)
+    {
+        I j = j0 + ty + c * GEMM_SMALL_DIM;
+        if constexpr(gemm_small_mfma<T>())
+            j = j0 + c * 16 + lane % 16;
+        for(I r = 0; r < GEMM_SMALL_REG; r++)
+        {
+            I i = i0 + tx + r * GEMM_SMALL_DIM;
+            if constexpr(gemm_small_mfma<T>())
+                i = i0 + wave * 16 + 4 * (lane / 16) + r;
+            if(i < m && j < n)
+                C[i + j * ldc] = (b == T(0) ? a * acc[r][c] : a * acc[r][c] + b * C[i + j * ldc]);
+        }
+    }
+}
+
+/** SYRK_HERK device function to compute C = alpha * A * A' + beta * C, or
+    C = alpha * A' * A + beta * C, updating only the uplo triangle of C. The
+    imaginary part of the diagonal of C is set to zero, as in HERK.
+
+    Call this kernel with 'batch_count' groups in z, and enough
+    groups in x and y to cover all the 'n' rows and columns of C. **/
+template <typename T, typename I, typename V, typename U>
+ROCSOLVER_KERNEL void syrk_herk_kernel(const bool upper,
+                                       const bool trans,
+                                       const I n,
+                                       const I k,
+                                       V alpha,
+                                       U AA,
+                                       rocblas_stride shiftA,
+                                       I lda,
+                                       rocblas_stride strideA,
+                                       V beta,
+                                       U CC,
+                                       rocblas_stride shiftC,
+                                       I ldc,
+                                       rocblas_stride strideC)
+{
+    // indices
+    I bid = hipBlockIdx_z;
+    I i = hipBlockIdx_x * static_cast<I>(hipBlockDim_x) + hipThreadIdx_x;
+    I j = hipBlockIdx_y * static_cast<I>(hipBlockDim_y) + hipThreadIdx_y;
+
+    // batch instance
+    auto a = load_scalar(alpha, bid, 0);
+    auto b = load_scalar(beta, bid, 0);
+    T* A = load_ptr_batch(AA, bid, shiftA, strideA);
+    T* C = load_ptr_batch(CC, bid, shiftC, strideC);
+
+    if(i < n && j < n && (upper ? i <= j : i >= j))
+    {
+        T temp = 0;
+        if(trans)
+        {
+            for(I idx = 0; idx < k; idx++)
+                temp += conj(A[idx + i * lda]) * A[idx + j * lda];
+        }
+        else
+        {
+            for(I idx = 0; idx < k; idx++)
+                temp += A[i + idx * lda] * conj(A[j + idx * lda]);
+        }
+
+        T c = T(a) * temp + T(b) * C[i + j * ldc];
+        C[i + j * ldc] = (i == j) ? T(std::real(c)) : c;
+    }
+}
+
+/** GEMM_3M_SPLIT device function to store the real part, the imaginary part and the sum of
+    both parts of the m-by-n complex matrix A (conjugated if conj is true) in the real
+    m-by-n matrices W, W + m*n and W + 2*m*n, with leading dimension m.
+
+    Call this kernel with 'batch_count' groups in z, and enough
+    groups in x and y to cover all the 'm' rows and 'n' columns of A. **/
+template <typename T, typename S, typename U>
+ROCSOLVER_KERNEL void gemm_3m_split_kernel(const rocblas_int m,
+                                           const rocblas_int n,
+                                           const bool conj,
+                                           U AA,
+                                           rocblas_stride shiftA,
+                                           rocblas_int lda,
+                                           rocblas_stride strideA,
+                                           S* WW,
+                                           rocblas_stride strideW)
+{
+    // indices
+    rocblas_int bid = hipBlockIdx_z;
+    rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocblas_int j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+
+    // batch instance
+    T* A = load_ptr_batch(AA, bid, shiftA, strideA);
+    S* W = WW + bid * strideW;
+
+    if(i < m && j < n)
+    {
+        rocblas_stride mn = rocblas_stride(m) * n;
+        rocblas_stride ij = i + rocblas_stride(j) * m;
+
+        T a = A[i + rocblas_stride(j) * lda];
+        S re = std::real(a);
+        S im = conj ? -std::imag(a) : std::imag(a);
+        W[ij] = re;
+        W[ij + mn] = im;
+        W[ij + 2 * mn] = re + im;
+    }
+}
+
+/** GEMM_3M_COMBINE device function to compute C = alpha * P + beta * C, where the m-by-n
+    complex product P = (P1 - P2) + i * (P3 - P1 - P2) is given by the three real products
+    P1 = Re(A) * Re(B), P2 = Im(A) * Im(B) and P3 = (Re(A) + Im(A)) * (Re(B) + Im(B)), stored
+    in PP, PP + m*n and PP + 2*m*n with leading dimension m. C is not read if beta is zero.
+
+    Call this kernel with 'batch_count' groups in z, and enough
+    groups in x and y to cover all the 'm' rows and 'n' columns of C. **/
+template <typename T, typename S, typename V, typename U>
+ROCSOLVER_KERNEL void gemm_3m_combine_kernel(const rocblas_int m,
+                                             const rocblas_int n,
+                                             V alpha,
+                                             const S* PP,
+                                             rocblas_stride strideP,
+                                             V beta,
+                                             U CC,
+                                             rocblas_stride shiftC,
+                                             rocblas_int ldc,
+                                             rocblas_stride strideC)
+{
+    // indices
+    rocblas_int bid = hipBlockIdx_z;
+    rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocblas_int j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+
+    // batch instance
+    T a = load_scalar(alpha, bid, 0);
+    T b = load_scalar(beta, bid, 0);
+    const S* P = PP + bid * strideP;
+    T* C = load_ptr_batch(CC, bid, shiftC, strideC);
+
+    if(i < m && j < n)
+    {
+        rocblas_stride mn = rocblas_stride(m) * n;
+        rocblas_stride ij = i + rocblas_stride(j) * m;
+
+        S p1 = P[ij];
+        S p2 = P[ij + mn];
+        S p3 = P[ij + 2 * mn];
+        T p = T(p1 - p2, p3 - p1 - p2);
+
+        T* c = C + i + rocblas_stride(j) * ldc;
+        *c = (b == T(0)) ? a * p : a * p + b * (*c);
+    }
+}
+
 // /** Optimized kernel that executes a simple gemm A = BC
 //     where A, B and C are sub blocks of the same matrix MM with
 //     leading dimension ldim and stride. A, B and C are
@@ -148,6 +529,190 @@ ROCSOLVER_KERNEL void gemm_noconj_kernel(const I m,
     Launchers of specialized kernels
 *************************************************************/
 
+/** ROCSOLVER_GEMM_SMALL computes C = alpha * op(A) * op(B) + beta * C with the small-GEMM
+    kernel. It is used instead of rocBLAS for the batches of small matrices (see
+    rocsolver_use_gemm_small), and A, B and C can be given as a mix of batched and strided
+    arrays. **/
+template <typename T, typename I, typename U1, typename U2, typename U3>
+rocblas_status rocsolver_gemm_small(rocblas_handle handle,
+                                    rocblas_operation transA,
+                                    rocblas_operation transB,
+                                    I m,
+                                    I n,
+                                    I k,
+                                    const T* alpha,
+                                    U1 A,
+                                    rocblas_stride shiftA,
+                                    I lda,
+                                    rocblas_stride strideA,
+                                    U2 B,
+                                    rocblas_stride shiftB,
+                                    I ldb,
+                                    rocblas_stride strideB,
+                                    const T* beta,
+                                    U3 C,
+                                    rocblas_stride shiftC,
+                                    I ldc,
+                                    rocblas_stride strideC,
+                                    I batch_count)
+{
+    ROCSOLVER_ENTER("gemm_small", "transA:", transA, "transB:", transB, "m:", m, "n:", n, "k:", k,
+                    "shiftA:", shiftA, "lda:", lda, "shiftB:", shiftB, "ldb:", ldb,
+                    "shiftC:", shiftC, "ldc:", ldc, "bc:", batch_count);
+
+    if(m == 0 || n == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_pointer_mode pmode;
+    rocblas_get_pointer_mode(handle, &pmode);
+
+    // launch specialized kernel
+    I blocksx = (m - 1) / GEMM_SMALL_TILE + 1;
+    I blocksy = (n - 1) / GEMM_SMALL_TILE + 1;
+    dim3 grid(blocksx, blocksy, batch_count);
+    dim3 threads(GEMM_SMALL_DIM, GEMM_SMALL_DIM, 1);
+    if(pmode == rocblas_pointer_mode_device)
+    {
+        ROCSOLVER_LAUNCH_KERNEL((gemm_small_kernel<T>), grid, threads, 0, stream, transA, transB,
+                                m, n, k, alpha, A, shiftA, lda, strideA, B, shiftB, ldb, strideB,
+                                beta, C, shiftC, ldc, strideC);
+    }
+    else
+    {
+        ROCSOLVER_LAUNCH_KERNEL((gemm_small_kernel<T>), grid, threads, 0, stream, transA, transB,
+                                m, n, k, *alpha, A, shiftA, lda, strideA, B, shiftB, ldb, strideB,
+                                *beta, C, shiftC, ldc, strideC);
+    }
+
+    return rocblas_status_success;
+}
+
+/** ROCSOLVER_GEMM_3M computes the complex GEMM C = alpha * op(A) * op(B) + beta * C with
+    the 3M method, i.e. with three real GEMMs of rocBLAS on the split real and imaginary parts of
+    A and B, when it is selected with rocsolver_set_gemm_mode (see rocsolver_use_gemm_3m). A, B
+    and C can be given as a mix of batched and strided arrays.
+
+    The split matrices and the real products are stored in a workspace of
+    3 * (m*k + k*n + m*n) real elements per batch instance, which is allocated in stream order
+    from the memory pool of the handle (or from the default pool of the device), as the device
+    memory of the handle is already in use by the calling function. Returns false (without
+    doing anything) if the workspace cannot be allocated, in which case the GEMM must be
+    computed with rocBLAS instead. **/
+template <typename T, typename U1, typename U2, typename U3>
+bool rocsolver_gemm_3m(rocblas_handle handle,
+                       rocblas_operation transA,
+                       rocblas_operation transB,
+                       rocblas_int m,
+                       rocblas_int n,
+                       rocblas_int k,
+                       const T* alpha,
+                       U1 A,
+                       rocblas_stride shiftA,
+                       rocblas_int lda,
+                       rocblas_stride strideA,
+                       U2 B,
+                       rocblas_stride shiftB,
+                       rocblas_int ldb,
+                       rocblas_stride strideB,
+                       const T* beta,
+                       U3 C,
+                       rocblas_stride shiftC,
+                       rocblas_int ldc,
+                       rocblas_stride strideC,
+                       rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER("gemm_3m", "transA:", transA, "transB:", transB, "m:", m, "n:", n, "k:", k,
+                    "shiftA:", shiftA, "lda:", lda, "shiftB:", shiftB, "ldb:", ldb,
+                    "shiftC:", shiftC, "ldc:", ldc, "bc:", batch_count);
+
+    using S = decltype(std::real(T{}));
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // the split matrices keep the shape in which A and B are stored; the conjugation is
+    // applied while splitting
+    rocblas_int rowsA = (transA == rocblas_operation_none ? m : k);
+    rocblas_int colsA = (transA == rocblas_operation_none ? k : m);
+    rocblas_int rowsB = (transB == rocblas_operation_none ? k : n);
+    rocblas_int colsB = (transB == rocblas_operation_none ? n : k);
+    rocblas_operation opA
+        = (transA == rocblas_operation_none ? rocblas_operation_none : rocblas_operation_transpose);
+    rocblas_operation opB
+        = (transB == rocblas_operation_none ? rocblas_operation_none : rocblas_operation_transpose);
+
+    rocblas_stride strideWA = 3 * rocblas_stride(m) * k;
+    rocblas_stride strideWB = 3 * rocblas_stride(k) * n;
+    rocblas_stride strideP = 3 * rocblas_stride(m) * n;
+    size_t size_work = sizeof(S) * (strideWA + strideWB + strideP) * batch_count;
+
+    // allocate the workspace
+    void* work = nullptr;
+    hipMemPool_t pool = get_workspace_pool(handle);
+    hipError_t alloc = pool ? hipMallocFromPoolAsync(&work, size_work, pool, stream)
+                            : hipMallocAsync(&work, size_work, stream);
+    if(alloc != hipSuccess)
+        return false;
+
+    S* WA = static_cast<S*>(work);
+    S* WB = WA + strideWA * batch_count;
+    S* P = WB + strideWB * batch_count;
+    rocblas_stride mk = rocblas_stride(m) * k;
+    rocblas_stride kn = rocblas_stride(k) * n;
+    rocblas_stride mn = rocblas_stride(m) * n;
+
+    // split A and B
+    dim3 threads(BS2, BS2, 1);
+    dim3 gridA((rowsA - 1) / BS2 + 1, (colsA - 1) / BS2 + 1, batch_count);
+    dim3 gridB((rowsB - 1) / BS2 + 1, (colsB - 1) / BS2 + 1, batch_count);
+    ROCSOLVER_LAUNCH_KERNEL((gemm_3m_split_kernel<T>), gridA, threads, 0, stream, rowsA, colsA,
+                            transA == rocblas_operation_conjugate_transpose, A, shiftA, lda,
+                            strideA, WA, strideWA);
+    ROCSOLVER_LAUNCH_KERNEL((gemm_3m_split_kernel<T>), gridB, threads, 0, stream, rowsB, colsB,
+                            transB == rocblas_operation_conjugate_transpose, B, shiftB, ldb,
+                            strideB, WB, strideWB);
+
+    // real products P1 = Re(A) * Re(B), P2 = Im(A) * Im(B) and
+    // P3 = (Re(A) + Im(A)) * (Re(B) + Im(B)), with the scalars on the host
+    rocblas_pointer_mode pmode;
+    rocblas_get_pointer_mode(handle, &pmode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+
+    S one = 1;
+    S zero = 0;
+    rocblas_status status = rocblas_status_success;
+    for(rocblas_int p = 0; p < 3 && status == rocblas_status_success; ++p)
+        status = rocblasCall_gemm(handle, opA, opB, m, n, k, &one, WA + p * mk, 0, rowsA,
+                                  strideWA, WB + p * kn, 0, rowsB, strideWB, &zero, P + p * mn, 0,
+                                  m, strideP, batch_count, static_cast<S**>(nullptr));
+
+    rocblas_set_pointer_mode(handle, pmode);
+
+    // C = alpha * P + beta * C (C is left unchanged if a real GEMM failed)
+    if(status == rocblas_status_success)
+    {
+        dim3 gridC((m - 1) / BS2 + 1, (n - 1) / BS2 + 1, batch_count);
+        if(pmode == rocblas_pointer_mode_device)
+        {
+            ROCSOLVER_LAUNCH_KERNEL((gemm_3m_combine_kernel<T>), gridC, threads, 0, stream, m, n,
+                                    alpha, (const S*)P, strideP, beta, C, shiftC, ldc, strideC);
+        }
+        else
+        {
+            ROCSOLVER_LAUNCH_KERNEL((gemm_3m_combine_kernel<T>), gridC, threads, 0, stream, m, n,
+                                    *alpha, (const S*)P, strideP, *beta, C, shiftC, ldc, strideC);
+        }
+    }
+
+    // the workspace is released in stream order, after the products are combined
+    (void)hipFreeAsync(work, stream);
+
+    return status == rocblas_status_success;
+}
+
 template <bool BATCHED, bool STRIDED, typename T, typename I, typename U>
 rocblas_status rocsolver_gemm(rocblas_handle handle,
                               rocblas_operation transA,
@@ -187,9 +752,45 @@ rocblas_status rocsolver_gemm(rocblas_handle handle,
         = (!std::is_same<I, int64_t>::value
            || (lda * k < INT_MAX && ldb * n < INT_MAX && ldc * n < INT_MAX && batch_count < INT_MAX));
     if(is_inc1 && is_32bit)
+    {
+        // the batches of small matrices are computed with the small-GEMM kernel, as the launch
+        // overhead of rocBLAS dominates for these sizes
+        if(rocsolver_use_gemm_small(m, n, k, batch_count))
+            return rocsolver_gemm_small<T>(handle, transA, transB, m, n, k, alpha, A, shiftA, lda,
+                                           strideA, B, shiftB, ldb, strideB, beta, C, shiftC, ldc,
+                                           strideC, batch_count);
+
+        // the large complex GEMMs can be computed with the 3M method, if selected with
+        // rocsolver_set_gemm_mode
+        if constexpr(rocblas_is_complex<T>)
+        {
+            if(rocsolver_use_gemm_3m<T>(handle, m, n, k, lda, ldb, ldc, batch_count)
+               && rocsolver_gemm_3m<T>(handle, transA, transB, rocblas_int(m), rocblas_int(n),
+                                       rocblas_int(k), alpha, A, shiftA, rocblas_int(lda),
+                                       strideA, B, shiftB, rocblas_int(ldb), strideB, beta, C,
+                                       shiftC, rocblas_int(ldc), strideC,
+                                       rocblas_int(batch_count)))
+                return rocblas_status_success;
+        }
+
         return rocblasCall_gemm(handle, transA, transB, m, n, k, alpha, A, shiftA, lda, strideA, B,
                                 shiftB, ldb, strideB, beta, C, shiftC, ldc, strideC, batch_count,
                                 work);
+    }
+
+    // if the matrices are stored by rows (ld = 1), C' = op(B)' * op(A)' is computed with
+    // rocBLAS on the column-major matrices A', B' and C' (the conjugate of a matrix cannot
+    // be expressed that way)
+    const bool is_ld1 = (lda == 1 && ldb == 1 && ldc == 1);
+    const bool is_32bit_t
+        = (!std::is_same<I, int64_t>::value
+           || (inca * k < INT_MAX && incb * n < INT_MAX && incc * n < INT_MAX
+               && batch_count < INT_MAX));
+    if(is_ld1 && is_32bit_t && transA != rocblas_operation_conjugate_transpose
+       && transB != rocblas_operation_conjugate_transpose)
+        return rocblasCall_gemm(handle, transB, transA, n, m, k, alpha, B, shiftB, incb, strideB, A,
+                                shiftA, inca, strideA, beta, C, shiftC, incc, strideC, batch_count,
+                                work);
 
     // TODO: add interleaved support for conjugate transpose
     if(transA == rocblas_operation_conjugate_transpose)
@@ -273,6 +874,69 @@ inline rocblas_status rocsolver_gemm(rocblas_handle handle,
                                                   C, shiftC, 1, ldc, strideC, batch_count, work);
 }
 
+/** ROCSOLVER_SYRK_HERK computes C = alpha * A * A' + beta * C (transA = none) or
+    C = alpha * A' * A + beta * C (transA = conjugate transpose). It calls rocBLAS
+    when all the dimensions fit in 32 bits, and the specialized kernel otherwise. **/
+template <bool BATCHED, bool STRIDED, typename T, typename I, typename S, typename U>
+rocblas_status rocsolver_syrk_herk(rocblas_handle handle,
+                                   rocblas_fill uplo,
+                                   rocblas_operation transA,
+                                   I n,
+                                   I k,
+                                   const S* alpha,
+                                   U A,
+                                   rocblas_stride shiftA,
+                                   I lda,
+                                   rocblas_stride strideA,
+                                   const S* beta,
+                                   U C,
+                                   rocblas_stride shiftC,
+                                   I ldc,
+                                   rocblas_stride strideC,
+                                   I batch_count)
+{
+    ROCSOLVER_ENTER("syrk_herk", "uplo:", uplo, "transA:", transA, "n:", n, "k:", k,
+                    "shiftA:", shiftA, "lda:", lda, "shiftC:", shiftC, "ldc:", ldc,
+                    "bc:", batch_count);
+
+    if(n == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    const bool is_32bit = (!std::is_same<I, int64_t>::value
+                           || (lda * std::max(n, k) < INT_MAX && ldc * n < INT_MAX
+                               && batch_count < INT_MAX));
+    if(is_32bit)
+        return rocblasCall_syrk_herk<BATCHED, T>(handle, uplo, transA, n, k, alpha, A, shiftA, lda,
+                                                 strideA, beta, C, shiftC, ldc, strideC,
+                                                 batch_count);
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_pointer_mode pmode;
+    rocblas_get_pointer_mode(handle, &pmode);
+
+    // launch specialized kernel
+    const bool upper = (uplo == rocblas_fill_upper);
+    const bool trans = (transA != rocblas_operation_none);
+    I blocks = (n - 1) / BS2 + 1;
+    dim3 grid(blocks, blocks, batch_count);
+    dim3 threads(BS2, BS2, 1);
+    if(pmode == rocblas_pointer_mode_device)
+    {
+        ROCSOLVER_LAUNCH_KERNEL((syrk_herk_kernel<T>), grid, threads, 0, stream, upper, trans, n,
+                                k, alpha, A, shiftA, lda, strideA, beta, C, shiftC, ldc, strideC);
+    }
+    else
+    {
+        ROCSOLVER_LAUNCH_KERNEL((syrk_herk_kernel<T>), grid, threads, 0, stream, upper, trans, n,
+                                k, *alpha, A, shiftA, lda, strideA, *beta, C, shiftC, ldc,
+                                strideC);
+    }
+
+    return rocblas_status_success;
+}
+
 /*************************************************************
     Instantiation macros
 *************************************************************/
@@ -284,4 +948,26 @@ inline rocblas_status rocsolver_gemm(rocblas_handle handle,
         rocblas_stride shiftB, I ldb, rocblas_stride strideB, const T* beta, U C,                 \
         rocblas_stride shiftC, I ldc, rocblas_stride strideC, I batch_count, T** work)
 
+#define INSTANTIATE_GEMM_SMALL(T, I, U1, U2, U3)                                                  \
+    template rocblas_status rocsolver_gemm_small<T, I, U1, U2, U3>(                               \
+        rocblas_handle handle, rocblas_operation transA, rocblas_operation transB, I m, I n, I k, \
+        const T* alpha, U1 A, rocblas_stride shiftA, I lda, rocblas_stride strideA, U2 B,         \
+        rocblas_stride shiftB, I ldb, rocblas_stride strideB, const T* beta, U3 C,                \
+        rocblas_stride shiftC, I ldc, rocblas_stride strideC, I batch_count)
+
+#define INSTANTIATE_GEMM_3M(T, U1, U2, U3)                                                        \
+    template bool rocsolver_gemm_3m<T, U1, U2, U3>(                                               \
+        rocblas_handle handle, rocblas_operation transA, rocblas_operation transB, rocblas_int m, \
+        rocblas_int n, rocblas_int k, const T* alpha, U1 A, rocblas_stride shiftA,                \
+        rocblas_int lda, rocblas_stride strideA, U2 B, rocblas_stride shiftB, rocblas_int ldb,    \
+        rocblas_stride strideB, const T* beta, U3 C, rocblas_stride shiftC, rocblas_int ldc,      \
+        rocblas_stride strideC, rocblas_int batch_count)
+
+#define INSTANTIATE_SYRK_HERK(BATCHED, STRIDED, T, I, S, U)                                       \
+    template rocblas_status rocsolver_syrk_herk<BATCHED, STRIDED, T, I, S, U>(                    \
+        rocblas_handle handle, rocblas_fill uplo, rocblas_operation transA, I n, I k,             \
+        const S* alpha, U A, rocblas_stride shiftA, I lda, rocblas_stride strideA,                \
+        const S* beta, U C, rocblas_stride shiftC, I ldc, rocblas_stride strideC,                 \
+        I batch_count)
+
 ROCSOLVER_END_NAMESPACE
@@ -37,11 +37,40 @@ INSTANTIATE_GEMM(0, 0, rocblas_float_complex, rocblas_int, rocblas_float_complex
 INSTANTIATE_GEMM(0, 1, rocblas_float_complex, rocblas_int, rocblas_float_complex*);
 INSTANTIATE_GEMM(1, 0, rocblas_float_complex, rocblas_int, rocblas_float_complex* const*);
 
+// combinations of batched and strided arrays used by LARFB
+INSTANTIATE_GEMM_SMALL(rocblas_float_complex, rocblas_int, rocblas_float_complex*,
+                       rocblas_float_complex*, rocblas_float_complex*);
+INSTANTIATE_GEMM_SMALL(rocblas_float_complex, rocblas_int, rocblas_float_complex* const*,
+                       rocblas_float_complex* const*, rocblas_float_complex*);
+INSTANTIATE_GEMM_SMALL(rocblas_float_complex, rocblas_int, rocblas_float_complex* const*,
+                       rocblas_float_complex*, rocblas_float_complex* const*);
+INSTANTIATE_GEMM_SMALL(rocblas_float_complex, rocblas_int, rocblas_float_complex*,
+                       rocblas_float_complex* const*, rocblas_float_complex* const*);
+
+// the same combinations for the 3M method
+INSTANTIATE_GEMM_3M(rocblas_float_complex, rocblas_float_complex*, rocblas_float_complex*,
+                    rocblas_float_complex*);
+INSTANTIATE_GEMM_3M(rocblas_float_complex, rocblas_float_complex* const*,
+                    rocblas_float_complex* const*, rocblas_float_complex*);
+INSTANTIATE_GEMM_3M(rocblas_float_complex, rocblas_float_complex* const*, rocblas_float_complex*,
+                    rocblas_float_complex* const*);
+INSTANTIATE_GEMM_3M(rocblas_float_complex, rocblas_float_complex*, rocblas_float_complex* const*,
+                    rocblas_float_complex* const*);
+
+INSTANTIATE_SYRK_HERK(0, 0, rocblas_float_complex, rocblas_int, float, rocblas_float_complex*);
+INSTANTIATE_SYRK_HERK(0, 1, rocblas_float_complex, rocblas_int, float, rocblas_float_complex*);
+INSTANTIATE_SYRK_HERK(1, 0, rocblas_float_complex, rocblas_int, float,
+                      rocblas_float_complex* const*);
+
 #ifdef HAVE_ROCBLAS_64
 // 64-bit APIs
 INSTANTIATE_GEMM(0, 0, rocblas_float_complex, int64_t, rocblas_float_complex*);
 INSTANTIATE_GEMM(0, 1, rocblas_float_complex, int64_t, rocblas_float_complex*);
 INSTANTIATE_GEMM(1, 0, rocblas_float_complex, int64_t, rocblas_float_complex* const*);
+
+INSTANTIATE_SYRK_HERK(0, 0, rocblas_float_complex, int64_t, float, rocblas_float_complex*);
+INSTANTIATE_SYRK_HERK(0, 1, rocblas_float_complex, int64_t, float, rocblas_float_complex*);
+INSTANTIATE_SYRK_HERK(1, 0, rocblas_float_complex, int64_t, float, rocblas_float_complex* const*);
 #endif /* HAVE_ROCBLAS_64 */
 
 ROCSOLVER_END_NAMESPACE
@@ -37,11 +37,25 @@ INSTANTIATE_GEMM(0, 0, double, rocblas_int, double*);
 INSTANTIATE_GEMM(0, 1, double, rocblas_int, double*);
 INSTANTIATE_GEMM(1, 0, double, rocblas_int, double* const*);
 
+// combinations of batched and strided arrays used by LARFB
+INSTANTIATE_GEMM_SMALL(double, rocblas_int, double*, double*, double*);
+INSTANTIATE_GEMM_SMALL(double, rocblas_int, double* const*, double* const*, double*);
+INSTANTIATE_GEMM_SMALL(double, rocblas_int, double* const*, double*, double* const*);
+INSTANTIATE_GEMM_SMALL(double, rocblas_int, double*, double* const*, double* const*);
+
+INSTANTIATE_SYRK_HERK(0, 0, double, rocblas_int, double, double*);
+INSTANTIATE_SYRK_HERK(0, 1, double, rocblas_int, double, double*);
+INSTANTIATE_SYRK_HERK(1, 0, double, rocblas_int, double, double* const*);
+
 #ifdef HAVE_ROCBLAS_64
 // 64-bit APIs
 INSTANTIATE_GEMM(0, 0, double, int64_t, double*);
 INSTANTIATE_GEMM(0, 1, double, int64_t, double*);
 INSTANTIATE_GEMM(1, 0, double, int64_t, double* const*);
+
+INSTANTIATE_SYRK_HERK(0, 0, double, int64_t, double, double*);
+INSTANTIATE_SYRK_HERK(0, 1, double, int64_t, double, double*);
+INSTANTIATE_SYRK_HERK(1, 0, double, int64_t, double, double* const*);
 #endif /* HAVE_ROCBLAS_64 */
 
 ROCSOLVER_END_NAMESPACE
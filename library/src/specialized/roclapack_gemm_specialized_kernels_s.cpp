@@ -37,11 +37,25 @@ INSTANTIATE_GEMM(0, 0, float, rocblas_int, float*);
 INSTANTIATE_GEMM(0, 1, float, rocblas_int, float*);
 INSTANTIATE_GEMM(1, 0, float, rocblas_int, float* const*);
 
+// combinations of batched and strided arrays used by LARFB
+INSTANTIATE_GEMM_SMALL(float, rocblas_int, float*, float*, float*);
+INSTANTIATE_GEMM_SMALL(float, rocblas_int, float* const*, float* const*, float*);
+INSTANTIATE_GEMM_SMALL(float, rocblas_int, float* const*, float*, float* const*);
+INSTANTIATE_GEMM_SMALL(float, rocblas_int, float*, float* const*, float* const*);
+
+INSTANTIATE_SYRK_HERK(0, 0, float, rocblas_int, float, float*);
+INSTANTIATE_SYRK_HERK(0, 1, float, rocblas_int, float, float*);
+INSTANTIATE_SYRK_HERK(1, 0, float, rocblas_int, float, float* const*);
+
 #ifdef HAVE_ROCBLAS_64
 // 64-bit APIs
 INSTANTIATE_GEMM(0, 0, float, int64_t, float*);
 INSTANTIATE_GEMM(0, 1, float, int64_t, float*);
 INSTANTIATE_GEMM(1, 0, float, int64_t, float* const*);
+
+INSTANTIATE_SYRK_HERK(0, 0, float, int64_t, float, float*);
+INSTANTIATE_SYRK_HERK(0, 1, float, int64_t, float, float*);
+INSTANTIATE_SYRK_HERK(1, 0, float, int64_t, float, float* const*);
 #endif /* HAVE_ROCBLAS_64 */
 
 ROCSOLVER_END_NAMESPACE
@@ -0,0 +1,270 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "rocsolver_run_specialized_kernels.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/** GEQR2_SET_TAUBETA computes the Householder scalars tau and beta, and the scaling factor of the
+    Householder vector, from alpha (overwritten with beta) and the squared norm of the rest of
+    the column (as set_taubeta in LARFG) **/
+template <typename T, std::enable_if_t<!rocblas_is_complex<T>, int> = 0>
+__device__ static void geqr2_set_taubeta(T& alpha, const T norm2, T& tau, T& scal)
+{
+    if(norm2 > 0)
+    {
+        T n = sqrt(norm2 + alpha * alpha);
+        n = alpha >= 0 ? -n : n;
+
+        // scaling factor:
+        scal = 1.0 / (alpha - n);
+
+        // tau:
+        tau = (n - alpha) / n;
+
+        // beta:
+        alpha = n;
+    }
+    else
+    {
+        scal = 1;
+        tau = 0;
+    }
+}
+
+template <typename T, std::enable_if_t<rocblas_is_complex<T>, int> = 0>
+__device__ static void geqr2_set_taubeta(T& alpha, const T norm2, T& tau, T& scal)
+{
+    using S = decltype(std::real(T{}));
+    S r, rr, ri;
+
+    S ar = alpha.real();
+    S ai = alpha.imag();
+    S m = ai * ai;
+
+    if(norm2.real() > 0 || m > 0)
+    {
+        m += ar * ar;
+        S n = sqrt(norm2.real() + m);
+        n = ar >= 0 ? -n : n;
+
+        // scaling factor:
+        //    scal = 1.0 / (alpha - n);
+        r = (ar - n) * (ar - n) + ai * ai;
+        rr = (ar - n) / r;
+        ri = -ai / r;
+        scal = rocblas_complex_num<S>(rr, ri);
+
+        // tau:
+        //    tau = (n - alpha) / n;
+        rr = (n - ar) / n;
+        ri = -ai / n;
+        tau = rocblas_complex_num<S>(rr, ri);
+
+        // beta:
+        alpha = n;
+    }
+    else
+    {
+        scal = 1;
+        tau = 0;
+    }
+}
+
+/*************************************************************
+    Templated kernels are instantiated in separate cpp
+    files in order to improve compilation times and reduce
+    the library size.
+*************************************************************/
+
+/** GEQR2_KERNEL_SMALL computes the QR factorization of a small m-by-n matrix in a single
+    launch. Each thread-block works with one matrix of the batch, which is kept entirely in LDS.
+    The x-dimension of the thread-block runs over the rows, and the y-dimension over the columns
+    of the trailing matrix when the Householder reflectors are applied. The scalars tau are
+    written directly to ipivA, which can be a strided array or an array of pointers.
+    (the number of threads in the x-dimension and the total number of threads must be
+    powers of 2) **/
+template <typename T, typename U, typename V>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) geqr2_kernel_small(const rocblas_int m,
+                                                                const rocblas_int n,
+                                                                U AA,
+                                                                const rocblas_int shiftA,
+                                                                const rocblas_int lda,
+                                                                const rocblas_stride strideA,
+                                                                V ipivA,
+                                                                const rocblas_stride strideP)
+{
+    const rocblas_int bid = hipBlockIdx_z;
+    const rocblas_int tx = hipThreadIdx_x;
+    const rocblas_int ty = hipThreadIdx_y;
+    const rocblas_int dimx = hipBlockDim_x;
+    const rocblas_int dimy = hipBlockDim_y;
+    const rocblas_int tid = tx + ty * dimx;
+    const rocblas_int nthds = dimx * dimy;
+    const rocblas_int dim = std::min(m, n);
+
+    // select batch instance
+    T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+    T* tau = load_ptr_batch<T>(ipivA, bid, 0, strideP);
+
+    // shared memory setup: the m-by-n matrix (with leading dimension m),
+    // followed by the workspace for the reductions
+    extern __shared__ rocblas_int lsmem[];
+    T* Ash = reinterpret_cast<T*>(lsmem);
+    T* sred = Ash + m * n;
+    __shared__ T stau, sscal;
+
+    // read matrix into LDS
+    for(rocblas_int k = tid; k < m * n; k += nthds)
+        Ash[k] = A[(k % m) + (k / m) * static_cast<int64_t>(lda)];
+    __syncthreads();
+
+    for(rocblas_int j = 0; j < dim; ++j)
+    {
+        // column j from the diagonal
+        T* v = Ash + j + j * m;
+        const rocblas_int mm = m - j;
+
+        // compute squared norm of v(1:mm-1)
+        T sum = 0;
+        for(rocblas_int i = tid + 1; i < mm; i += nthds)
+            sum += v[i] * conj(v[i]);
+        sred[tid] = sum;
+        __syncthreads();
+
+        for(rocblas_int s = nthds / 2; s > 0; s /= 2)
+        {
+            if(tid < s)
+                sred[tid] += sred[tid + s];
+            __syncthreads();
+        }
+
+        // generate Householder reflector to work on column j
+        if(tid == 0)
+        {
+            geqr2_set_taubeta(v[0], sred[0], stau, sscal);
+            tau[j] = stau;
+        }
+        __syncthreads();
+
+        const T scal = sscal;
+        for(rocblas_int i = tid + 1; i < mm; i += nthds)
+            v[i] *= scal;
+        __syncthreads();
+
+        // apply Householder reflector (conjugated) to the rest of the matrix from the left
+        // (v(0) = 1 is implicit)
+        const T ctau = conj(stau);
+        for(rocblas_int c0 = j + 1; c0 < n; c0 += dimy)
+        {
+            const rocblas_int c = c0 + ty;
+            T* a = Ash + j + c * m;
+
+            sum = 0;
+            if(c < n)
+            {
+                for(rocblas_int i = tx; i < mm; i += dimx)
+                    sum += (i == 0 ? a[0] : conj(v[i]) * a[i]);
+            }
+            sred[tid] = sum;
+            __syncthreads();
+
+            for(rocblas_int s = dimx / 2; s > 0; s /= 2)
+            {
+                if(tx < s)
+                    sred[tid] += sred[tid + s];
+                __syncthreads();
+            }
+
+            if(c < n)
+            {
+                const T w = ctau * sred[ty * dimx];
+                for(rocblas_int i = tx; i < mm; i += dimx)
+                    a[i] -= (i == 0 ? w : v[i] * w);
+            }
+            __syncthreads();
+        }
+    }
+
+    // write results to global memory
+    for(rocblas_int k = tid; k < m * n; k += nthds)
+        A[(k % m) + (k / m) * static_cast<int64_t>(lda)] = Ash[k];
+}
+
+/*************************************************************
+    Launchers of specilized kernels
+*************************************************************/
+
+template <typename T, typename U, typename V>
+rocblas_status geqr2_run_small(rocblas_handle handle,
+                               const rocblas_int m,
+                               const rocblas_int n,
+                               U A,
+                               const rocblas_int shiftA,
+                               const rocblas_int lda,
+                               const rocblas_stride strideA,
+                               V ipiv,
+                               const rocblas_stride strideP,
+                               const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER("geqr2_kernel_small", "m:", m, "n:", n, "shiftA:", shiftA, "lda:", lda,
+                    "bc:", batch_count);
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // the thread-block has BS1 threads; use a full wavefront for the rows
+    // unless the matrix is very short
+    rocblas_int dimx = (m <= 32) ? 32 : 64;
+    rocblas_int dimy = BS1 / dimx;
+    size_t lmemsize = sizeof(T) * (size_t(m) * n + BS1);
+
+    ROCSOLVER_LAUNCH_KERNEL((geqr2_kernel_small<T, U, V>), dim3(1, 1, batch_count),
+                            dim3(dimx, dimy, 1), lmemsize, stream, m, n, A, shiftA, lda, strideA,
+                            ipiv, strideP);
+
+    return rocblas_status_success;
+}
+
+/*************************************************************
+    Instantiation macros
+*************************************************************/
+
+#define INSTANTIATE_GEQR2_SMALL(T, U, V)                                                      \
+    template rocblas_status geqr2_run_small<T, U, V>(                                         \
+        rocblas_handle handle, const rocblas_int m, const rocblas_int n, U A,                 \
+        const rocblas_int shiftA, const rocblas_int lda, const rocblas_stride strideA, V ipiv, \
+        const rocblas_stride strideP, const rocblas_int batch_count)
+
+ROCSOLVER_END_NAMESPACE
@@ -0,0 +1,307 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "rocsolver_run_specialized_kernels.hpp"
+#include "rocsolver_specialized_module.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/*************************************************************
+    Templated kernels are instantiated in separate cpp
+    files in order to improve compilation times and reduce
+    the library size.
+*************************************************************/
+
+/** gesv_small_kernel solves the linear systems A * X = B of tiny size
+    n = DIM <= GESV_SMALL_MAX_SIZE. Every thread keeps a row of A and of B in registers; the LU factorization with partial
+    pivoting (as in getf2_small_kernel), the row interchanges of B, and the triangular solves
+    are all computed by the same thread group. **/
+template <int DIM, typename T, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(GETF2_SSKER_MAX_M)
+    gesv_small_kernel(const rocblas_int nrhs,
+                      U AA,
+                      const rocblas_int shiftA,
+                      const rocblas_int lda,
+                      const rocblas_stride strideA,
+                      rocblas_int* ipivA,
+                      const rocblas_stride strideP,
+                      U BB,
+                      const rocblas_int shiftB,
+                      const rocblas_int ldb,
+                      const rocblas_stride strideB,
+                      rocblas_int* infoA,
+                      const rocblas_int batch_count)
+{
+    using S = decltype(std::real(T{}));
+
+    rocblas_int myrow = hipThreadIdx_x;
+    const rocblas_int row = hipThreadIdx_x;
+    const rocblas_int ty = hipThreadIdx_y;
+    const rocblas_int id = hipBlockIdx_y * static_cast<rocblas_int>(hipBlockDim_y) + ty;
+
+    if(id >= batch_count)
+        return;
+
+    // batch instance
+    T* A = load_ptr_batch<T>(AA, id, shiftA, strideA);
+    T* B = load_ptr_batch<T>(BB, id, shiftB, strideB);
+    rocblas_int* ipiv = ipivA + id * strideP;
+    rocblas_int* info = infoA + id;
+
+    // shared memory (for communication between threads in group)
+    extern __shared__ double lmem[];
+    T* common = reinterpret_cast<T*>(lmem);
+    common += ty * DIM;
+
+    // local variables
+    T pivot_value;
+    T test_value;
+    rocblas_int pivot_index;
+    rocblas_int mypiv = myrow + 1; // to build ipiv
+    rocblas_int myinfo = 0; // to build info
+    T rA[DIM]; // to store this-row values of A
+    T rB[DIM]; // to store this-row values of a block of columns of B
+
+    // read corresponding row from global memory into local array
+#pragma unroll DIM
+    for(rocblas_int j = 0; j < DIM; ++j)
+        rA[j] = A[myrow + j * lda];
+
+        // LU factorization (main loop)
+#pragma unroll DIM
+    for(rocblas_int k = 0; k < DIM; ++k)
+    {
+        // share current column
+        common[myrow] = rA[k];
+        __syncthreads();
+
+        // search pivot index
+        pivot_index = k;
+        pivot_value = common[k];
+        for(rocblas_int i = k + 1; i < DIM; ++i)
+        {
+            test_value = common[i];
+            if(aabs<S>(pivot_value) < aabs<S>(test_value))
+            {
+                pivot_value = test_value;
+                pivot_index = i;
+            }
+        }
+
+        // check singularity and scale value for current column
+        if(pivot_value != T(0))
+            pivot_value = S(1) / pivot_value;
+        else if(myinfo == 0)
+            myinfo = k + 1;
+        __syncthreads();
+
+        // swap rows (lazy swaping)
+        if(myrow == pivot_index)
+        {
+            myrow = k;
+            // share pivot row
+            for(rocblas_int j = k + 1; j < DIM; ++j)
+                common[j] = rA[j];
+        }
+        else if(myrow == k)
+        {
+            myrow = pivot_index;
+            mypiv = pivot_index + 1;
+        }
+        __syncthreads();
+
+        // scale current column and update trailing matrix
+        if(myrow > k)
+        {
+            rA[k] *= pivot_value;
+            for(rocblas_int j = k + 1; j < DIM; ++j)
+                rA[j] -= rA[k] * common[j];
+        }
+        __syncthreads();
+    }
+
+    // write factorization to global memory
+    // (the thread that started with a row of A now holds the row myrow of P * A = L * U)
+    ipiv[myrow] = mypiv;
+    if(myrow == 0)
+        *info = myinfo;
+#pragma unroll DIM
+    for(rocblas_int j = 0; j < DIM; ++j)
+        A[myrow + j * lda] = rA[j];
+
+    // B is not modified if A is singular
+    // (all the threads of the group have the same value of myinfo; the substitutions are
+    // still executed so that all the groups in the block reach the same barriers)
+    const bool solve = (myinfo == 0);
+
+    // solve with blocks of up to DIM columns of B
+    // (reading the row of B that corresponds to the original row of A applies P to B)
+    for(rocblas_int c0 = 0; c0 < nrhs; c0 += DIM)
+    {
+        const rocblas_int nc = std::min(DIM, nrhs - c0);
+        for(rocblas_int c = 0; c < nc; ++c)
+            rB[c] = (solve ? B[row + (c0 + c) * ldb] : T(0));
+        __syncthreads();
+
+        // forward substitution with L (unit diagonal)
+        for(rocblas_int k = 0; k < DIM; ++k)
+        {
+            if(myrow == k)
+                for(rocblas_int c = 0; c < nc; ++c)
+                    common[c] = rB[c];
+            __syncthreads();
+
+            if(myrow > k)
+                for(rocblas_int c = 0; c < nc; ++c)
+                    rB[c] -= rA[k] * common[c];
+            __syncthreads();
+        }
+
+        // backward substitution with U
+        for(rocblas_int k = DIM - 1; k >= 0; --k)
+        {
+            if(myrow == k)
+                for(rocblas_int c = 0; c < nc; ++c)
+                {
+                    rB[c] /= rA[k];
+                    common[c] = rB[c];
+                }
+            __syncthreads();
+
+            if(myrow < k)
+                for(rocblas_int c = 0; c < nc; ++c)
+                    rB[c] -= rA[k] * common[c];
+            __syncthreads();
+        }
+
+        // write solution to global memory
+        if(solve)
+            for(rocblas_int c = 0; c < nc; ++c)
+                B[myrow + (c0 + c) * ldb] = rB[c];
+    }
+}
+
+/*************************************************************
+    Launchers of specialized kernels
+*************************************************************/
+
+/** launcher of gesv_small_kernel **/
+template <typename T, typename U>
+rocblas_status gesv_run_small(rocblas_handle handle,
+                              const rocblas_int n,
+                              const rocblas_int nrhs,
+                              U A,
+                              const rocblas_int shiftA,
+                              const rocblas_int lda,
+                              const rocblas_stride strideA,
+                              rocblas_int* ipiv,
+                              const rocblas_stride strideP,
+                              U B,
+                              const rocblas_int shiftB,
+                              const rocblas_int ldb,
+                              const rocblas_stride strideB,
+                              rocblas_int* info,
+                              const rocblas_int batch_count)
+{
+#define RUN_GESV_SMALL(DIM)                                                                  \
+    ROCSOLVER_LAUNCH_KERNEL((gesv_small_kernel<DIM, T>), grid, block, lmemsize, stream, nrhs, \
+                            A, shiftA, lda, strideA, ipiv, strideP, B, shiftB, ldb, strideB,  \
+                            info, batch_count)
+
+    // determine sizes
+    // (the number of groups per thread block is the same as in getf2_small_kernel)
+    rocblas_int opval[] = {GETF2_OPTIM_NGRP};
+    rocblas_int ngrp = (batch_count < 2) ? 1 : opval[n - 1];
+    rocblas_int blocks = (batch_count - 1) / ngrp + 1;
+
+    // prepare kernel launch
+    dim3 grid(1, blocks, 1);
+    dim3 block(n, ngrp, 1);
+    size_t lmemsize = n * ngrp * sizeof(T);
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // instantiate cases to make number of columns n known at compile time
+    // this should allow loop unrolling.
+    // kernel launch
+    switch(n)
+    {
+    case 1: RUN_GESV_SMALL(1); break;
+    case 2: RUN_GESV_SMALL(2); break;
+    case 3: RUN_GESV_SMALL(3); break;
+    case 4: RUN_GESV_SMALL(4); break;
+    case 5: RUN_GESV_SMALL(5); break;
+    case 6: RUN_GESV_SMALL(6); break;
+    case 7: RUN_GESV_SMALL(7); break;
+    case 8: RUN_GESV_SMALL(8); break;
+    case 9: RUN_GESV_SMALL(9); break;
+    case 10: RUN_GESV_SMALL(10); break;
+    case 11: RUN_GESV_SMALL(11); break;
+    case 12: RUN_GESV_SMALL(12); break;
+    case 13: RUN_GESV_SMALL(13); break;
+    case 14: RUN_GESV_SMALL(14); break;
+    case 15: RUN_GESV_SMALL(15); break;
+    case 16: RUN_GESV_SMALL(16); break;
+    case 17: RUN_GESV_SMALL(17); break;
+    case 18: RUN_GESV_SMALL(18); break;
+    case 19: RUN_GESV_SMALL(19); break;
+    case 20: RUN_GESV_SMALL(20); break;
+    case 21: RUN_GESV_SMALL(21); break;
+    case 22: RUN_GESV_SMALL(22); break;
+    case 23: RUN_GESV_SMALL(23); break;
+    case 24: RUN_GESV_SMALL(24); break;
+    case 25: RUN_GESV_SMALL(25); break;
+    case 26: RUN_GESV_SMALL(26); break;
+    case 27: RUN_GESV_SMALL(27); break;
+    case 28: RUN_GESV_SMALL(28); break;
+    case 29: RUN_GESV_SMALL(29); break;
+    case 30: RUN_GESV_SMALL(30); break;
+    case 31: RUN_GESV_SMALL(31); break;
+    case 32: RUN_GESV_SMALL(32); break;
+    default: ROCSOLVER_UNREACHABLE();
+    }
+
+    return rocblas_status_success;
+}
+
+/*************************************************************
+    Instantiation macros
+*************************************************************/
+
+#define INSTANTIATE_GESV_SMALL(T, U)                                                       \
+    ROCSOLVER_INSTANTIATE_SPECIALIZED(rocblas_status, gesv_run_small, (T, U),              \
+        (rocblas_handle handle, const rocblas_int n, const rocblas_int nrhs, U A,          \
+         const rocblas_int shiftA, const rocblas_int lda, const rocblas_stride strideA,    \
+         rocblas_int* ipiv, const rocblas_stride strideP, U B, const rocblas_int shiftB,   \
+         const rocblas_int ldb, const rocblas_stride strideB, rocblas_int* info,           \
+         const rocblas_int batch_count),                                                   \
+        (handle, n, nrhs, A, shiftA, lda, strideA, ipiv, strideP, B, shiftB, ldb, strideB, \
+         info, batch_count))
+
+ROCSOLVER_END_NAMESPACE
@@ -10,6 +10,10 @@
 #pragma once
 
 #include "rocsolver_run_specialized_kernels.hpp"
+#include "rocsolver_specialized_module.hpp"
+#include "rocsolver_streams.hpp"
+
+#include <hip/hip_cooperative_groups.h>
 
 ROCSOLVER_BEGIN_NAMESPACE
 
@@ -128,7 +132,7 @@ ROCSOLVER_KERNEL void __launch_bounds__(GETF2_SSKER_MAX_M)
     // write results to global memory
     if(myrow < DIM)
         ipiv[myrow] = mypiv + offset;
-    if(myrow == 0 && *info == 0 && myinfo > 0)
+    if(myrow == 0 && (offset == 0 || (*info == 0 && myinfo > 0)))
         *info = myinfo + offset;
 #pragma unroll DIM
     for(I j = 0; j < DIM; ++j)
@@ -207,7 +211,7 @@ ROCSOLVER_KERNEL void __launch_bounds__(GETF2_SSKER_MAX_M)
     }
 
     // write results to global memory
-    if(myrow == 0 && *info == 0 && myinfo > 0)
+    if(myrow == 0 && (offset == 0 || (*info == 0 && myinfo > 0)))
         *info = myinfo + offset;
 #pragma unroll DIM
     for(I j = 0; j < DIM; ++j)
@@ -374,7 +378,7 @@ ROCSOLVER_KERNEL void getf2_panel_kernel(const I m,
     }
 
     // update info
-    if(tx == 0 && *info == 0 && myinfo > 0 && ty == 0)
+    if(tx == 0 && ty == 0 && (offset == 0 || (*info == 0 && myinfo > 0)))
         *info = myinfo + offset;
 }
 
@@ -473,7 +477,224 @@ ROCSOLVER_KERNEL void getf2_npvt_panel_kernel(const I m,
     }
 
     // update info
-    if(tx == 0 && *info == 0 && myinfo > 0 && ty == 0)
+    if(tx == 0 && ty == 0 && (offset == 0 || (*info == 0 && myinfo > 0)))
+        *info = myinfo + offset;
+}
+
+/** getf2_coop_reduce_max finds, among the candidates (val, idx) of all the threads in the group,
+    the one of largest value (and smallest index in case of ties). The result is returned in
+    sval[0] and sidx[0] **/
+template <typename S, typename I>
+__device__ void getf2_coop_reduce_max(const I tx, const I bdx, S val1, I idx1, S* sval, I* sidx)
+{
+    S val2;
+    I idx2;
+
+    sval[tx] = val1;
+    sidx[tx] = idx1;
+    __syncthreads();
+
+    for(I i = bdx / 2; i > 0; i /= 2)
+    {
+        if(tx < i)
+        {
+            val2 = sval[tx + i];
+            idx2 = sidx[tx + i];
+            if((val1 < val2) || (val1 == val2 && idx1 > idx2))
+            {
+                sval[tx] = val1 = val2;
+                sidx[tx] = idx1 = idx2;
+            }
+        }
+        __syncthreads();
+    }
+}
+
+/** getf2_coop_panel_kernel takes care of tall matrices with GETF2_SPKER_MAX_M < m and
+    n <= GETF2_SPKER_MAX_N. The rows of the panel are split in contiguous chunks, one per group,
+    and the pivots are found by reducing the partial maxima of all the groups. It must be launched
+    as a cooperative kernel (all the groups must be resident at the same time) **/
+template <bool PIVOT, typename T, typename I, typename INFO, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(GETF2_COOP_THDS)
+    getf2_coop_panel_kernel(const I m,
+                            const I n,
+                            U AA,
+                            const rocblas_stride shiftA,
+                            const I lda,
+                            const rocblas_stride strideA,
+                            I* ipivA,
+                            const rocblas_stride shiftP,
+                            const rocblas_stride strideP,
+                            INFO* infoA,
+                            const I offset,
+                            I* permut_idx,
+                            const rocblas_stride stridePI,
+                            T* partval,
+                            I* partidx)
+{
+    using S = decltype(std::real(T{}));
+    cooperative_groups::grid_group grid = cooperative_groups::this_grid();
+
+    const I tx = hipThreadIdx_x;
+    const I bid = hipBlockIdx_x;
+    const I id = hipBlockIdx_z;
+    const I bdx = hipBlockDim_x;
+    const I nblk = hipGridDim_x;
+    const I dim = std::min(m, n);
+
+    // batch instance
+    T* A = load_ptr_batch<T>(AA, id, shiftA, strideA);
+    I* ipiv = (PIVOT ? load_ptr_batch<I>(ipivA, id, shiftP, strideP) : nullptr);
+    I* permut = (permut_idx != nullptr ? permut_idx + id * stridePI : nullptr);
+    INFO* info = infoA + id;
+    T* pval = (PIVOT ? partval + id * nblk : nullptr);
+    I* pidx = (PIVOT ? partidx + id * nblk : nullptr);
+
+    // rows of the panel owned by this group
+    const I chunk = (m - 1) / nblk + 1;
+    const I r0 = std::min(m, bid * chunk);
+    const I r1 = std::min(m, r0 + chunk);
+
+    // shared memory (for communication between threads in group)
+    extern __shared__ double lmem[];
+    T* y = reinterpret_cast<T*>(lmem); // pivot row
+    T* z = y + n; // row k before the interchange
+    S* sval = reinterpret_cast<S*>(z + n);
+    I* sidx = reinterpret_cast<I*>(sval + bdx);
+
+    // local variables
+    S val1, val2;
+    I idx1, idx2;
+    T pivot_val, l;
+    I pivot_idx;
+    INFO myinfo = 0; // to build info
+
+    // init step: partial maxima of column zero
+    if(PIVOT)
+    {
+        val1 = 0;
+        idx1 = r1;
+        for(I i = r0 + tx; i < r1; i += bdx)
+        {
+            val2 = aabs<S>(A[i]);
+            if(val1 < val2 || idx1 == r1)
+            {
+                val1 = val2;
+                idx1 = i;
+            }
+        }
+        getf2_coop_reduce_max(tx, bdx, val1, idx1, sval, sidx);
+        if(tx == 0)
+        {
+            pval[bid] = sval[0];
+            pidx[bid] = sidx[0];
+        }
+    }
+
+    // main loop (for each pivot)
+    for(I k = 0; k < dim; ++k)
+    {
+        grid.sync();
+
+        // find pivot (maximum of the partial maxima of all the groups)
+        pivot_idx = k;
+        if(PIVOT)
+        {
+            val1 = 0;
+            idx1 = m;
+            for(I b = tx; b < nblk; b += bdx)
+            {
+                val2 = std::real(pval[b]);
+                idx2 = pidx[b];
+                if((val1 < val2) || (val1 == val2 && idx1 > idx2))
+                {
+                    val1 = val2;
+                    idx1 = idx2;
+                }
+            }
+            getf2_coop_reduce_max(tx, bdx, val1, idx1, sval, sidx);
+            if(sval[0] != S(0))
+                pivot_idx = sidx[0];
+        }
+        pivot_val = A[pivot_idx + k * lda];
+
+        // check singularity and scale value for current column
+        if(pivot_val == T(0))
+        {
+            pivot_val = 1;
+            if(myinfo == 0)
+                myinfo = k + 1;
+        }
+        else
+            pivot_val = S(1) / pivot_val;
+
+        // put pivot row and row k in shared mem
+        for(I j = tx; j < n; j += bdx)
+        {
+            y[j] = A[pivot_idx + j * lda];
+            z[j] = A[k + j * lda];
+        }
+
+        // update ipiv
+        if(bid == 0 && tx == 0)
+        {
+            if(PIVOT)
+                ipiv[k] = pivot_idx + 1 + offset;
+            if(permut && pivot_idx != k)
+                swap(permut[k], permut[pivot_idx]);
+        }
+
+        // (rows k and pivot_idx cannot be overwritten until all the groups have read them)
+        grid.sync();
+
+        // swap pivot row with row k, and update the rows of the group
+        // (the partial maxima of the next column are computed on the fly)
+        val1 = 0;
+        idx1 = r1;
+        for(I i = std::max(r0, k) + tx; i < r1; i += bdx)
+        {
+            if(i == k)
+            {
+                for(I j = 0; j < n; ++j)
+                    A[k + j * lda] = y[j];
+                continue;
+            }
+
+            T* x = (i == pivot_idx) ? z : nullptr;
+            if(x)
+            {
+                for(I j = 0; j < k; ++j)
+                    A[i + j * lda] = x[j];
+            }
+            l = (x ? x[k] : A[i + k * lda]) * pivot_val;
+            A[i + k * lda] = l;
+            for(I j = k + 1; j < n; ++j)
+                A[i + j * lda] = (x ? x[j] : A[i + j * lda]) - l * y[j];
+
+            if(PIVOT && k + 1 < dim)
+            {
+                val2 = aabs<S>(A[i + (k + 1) * lda]);
+                if(val1 < val2 || idx1 == r1)
+                {
+                    val1 = val2;
+                    idx1 = i;
+                }
+            }
+        }
+
+        if(PIVOT && k + 1 < dim)
+        {
+            getf2_coop_reduce_max(tx, bdx, val1, idx1, sval, sidx);
+            if(tx == 0)
+            {
+                pval[bid] = sval[0];
+                pidx[bid] = sidx[0];
+            }
+        }
+    }
+
+    // update info
+    if(bid == 0 && tx == 0 && (offset == 0 || (*info == 0 && myinfo > 0)))
         *info = myinfo + offset;
 }
 
@@ -724,6 +945,82 @@ rocblas_status getf2_run_panel(rocblas_handle handle,
     return rocblas_status_success;
 }
 
+/** launcher of getf2_coop_panel_kernel. It returns rocblas_status_not_implemented (without
+    doing anything) when all the groups cannot be resident at the same time **/
+template <typename T, typename I, typename INFO, typename U>
+rocblas_status getf2_run_coop_panel(rocblas_handle handle,
+                                    const I m,
+                                    const I n,
+                                    U A,
+                                    const rocblas_stride shiftA,
+                                    const I lda,
+                                    const rocblas_stride strideA,
+                                    I* ipiv,
+                                    const rocblas_stride shiftP,
+                                    const rocblas_stride strideP,
+                                    INFO* info,
+                                    const I batch_count,
+                                    const bool pivot,
+                                    const I offset,
+                                    I* permut_idx,
+                                    const rocblas_stride stride,
+                                    T* pivotval,
+                                    I* pivotidx)
+{
+    using S = decltype(std::real(T{}));
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // determine the number of groups that can be resident
+    // (only on the CUs available to the handle, see rocsolver_set_cu_mask)
+    int device, coop = 0, numcu = 0, nres = 0;
+    size_t lmemsize = 2 * n * sizeof(T) + GETF2_COOP_THDS * (sizeof(S) + sizeof(I));
+    if(hipGetDevice(&device) != hipSuccess
+       || hipDeviceGetAttribute(&coop, hipDeviceAttributeCooperativeLaunch, device) != hipSuccess
+       || rocsolver_cu_count(handle, &numcu) != hipSuccess || !coop)
+        return rocblas_status_not_implemented;
+
+    hipError_t istat;
+    if(pivot)
+        istat = hipOccupancyMaxActiveBlocksPerMultiprocessor(
+            &nres, getf2_coop_panel_kernel<true, T, I, INFO, U>, GETF2_COOP_THDS, lmemsize);
+    else
+        istat = hipOccupancyMaxActiveBlocksPerMultiprocessor(
+            &nres, getf2_coop_panel_kernel<false, T, I, INFO, U>, GETF2_COOP_THDS, lmemsize);
+    if(istat != hipSuccess)
+        return rocblas_status_not_implemented;
+
+    // as many groups per matrix as possible, with GETF2_COOP_THDS rows or more each
+    int64_t nmax = int64_t(nres) * numcu / batch_count;
+    I nblk = I(std::min(int64_t((m - 1) / GETF2_COOP_THDS + 1), nmax));
+    if(nblk < 1)
+        return rocblas_status_not_implemented;
+
+    // prepare kernel launch
+    dim3 grid(nblk, 1, batch_count);
+    dim3 block(GETF2_COOP_THDS, 1, 1);
+    void* args[] = {(void*)&m, (void*)&n, (void*)&A, (void*)&shiftA, (void*)&lda, (void*)&strideA,
+                    (void*)&ipiv, (void*)&shiftP, (void*)&strideP, (void*)&info, (void*)&offset,
+                    (void*)&permut_idx, (void*)&stride, (void*)&pivotval, (void*)&pivotidx};
+
+    if(pivot)
+        ROCSOLVER_LAUNCH_COOPERATIVE_KERNEL(istat, (getf2_coop_panel_kernel<true, T, I, INFO, U>),
+                                            grid, block, args, lmemsize, stream);
+    else
+        ROCSOLVER_LAUNCH_COOPERATIVE_KERNEL(istat, (getf2_coop_panel_kernel<false, T, I, INFO, U>),
+                                            grid, block, args, lmemsize, stream);
+
+    if(istat != hipSuccess)
+    {
+        // (clear the error, so that the caller can fall back to the normal code)
+        (void)hipGetLastError();
+        return rocblas_status_not_implemented;
+    }
+
+    return rocblas_status_success;
+}
+
 /** launcher of getf2_scale_update_kernel **/
 template <typename T, typename I, typename U>
 void getf2_run_scale_update(rocblas_handle handle,
@@ -754,22 +1051,36 @@ void getf2_run_scale_update(rocblas_handle handle,
     Instantiation macros
 *************************************************************/
 
-#define INSTANTIATE_GETF2_SMALL(T, I, INFO, U)                                           \
-    template rocblas_status getf2_run_small<T, I, INFO, U>(                              \
-        rocblas_handle handle, const I m, const I n, U A, const rocblas_stride shiftA,   \
-        const I lda, const rocblas_stride strideA, I* ipiv, const rocblas_stride shiftP, \
-        const rocblas_stride strideP, INFO* info, const I batch_count, const bool pivot, \
-        const I offset, I* permut_idx, const rocblas_stride stride)
-#define INSTANTIATE_GETF2_PANEL(T, I, INFO, U)                                           \
-    template rocblas_status getf2_run_panel<T, I, INFO, U>(                              \
-        rocblas_handle handle, const I m, const I n, U A, const rocblas_stride shiftA,   \
-        const I lda, const rocblas_stride strideA, I* ipiv, const rocblas_stride shiftP, \
-        const rocblas_stride strideP, INFO* info, const I batch_count, const bool pivot, \
-        const I offset, I* permut_idx, const rocblas_stride stride)
-#define INSTANTIATE_GETF2_SCALE_UPDATE(T, I, U)                                                  \
-    template void getf2_run_scale_update<T, I, U>(rocblas_handle handle, const I m, const I n,   \
-                                                  T* pivotval, U A, const rocblas_stride shiftA, \
-                                                  const I lda, const rocblas_stride strideA,     \
-                                                  const I batch_count, const I dimx, const I dimy)
+#define INSTANTIATE_GETF2_SMALL(T, I, INFO, U)                                            \
+    ROCSOLVER_INSTANTIATE_SPECIALIZED(rocblas_status, getf2_run_small, (T, I, INFO, U),   \
+        (rocblas_handle handle, const I m, const I n, U A, const rocblas_stride shiftA,   \
+         const I lda, const rocblas_stride strideA, I* ipiv, const rocblas_stride shiftP, \
+         const rocblas_stride strideP, INFO* info, const I batch_count, const bool pivot, \
+         const I offset, I* permut_idx, const rocblas_stride stride),                     \
+        (handle, m, n, A, shiftA, lda, strideA, ipiv, shiftP, strideP, info, batch_count, \
+         pivot, offset, permut_idx, stride))
+#define INSTANTIATE_GETF2_PANEL(T, I, INFO, U)                                            \
+    ROCSOLVER_INSTANTIATE_SPECIALIZED(rocblas_status, getf2_run_panel, (T, I, INFO, U),   \
+        (rocblas_handle handle, const I m, const I n, U A, const rocblas_stride shiftA,   \
+         const I lda, const rocblas_stride strideA, I* ipiv, const rocblas_stride shiftP, \
+         const rocblas_stride strideP, INFO* info, const I batch_count, const bool pivot, \
+         const I offset, I* permut_idx, const rocblas_stride stride),                     \
+        (handle, m, n, A, shiftA, lda, strideA, ipiv, shiftP, strideP, info, batch_count, \
+         pivot, offset, permut_idx, stride))
+#define INSTANTIATE_GETF2_COOP_PANEL(T, I, INFO, U)                                          \
+    ROCSOLVER_INSTANTIATE_SPECIALIZED(rocblas_status, getf2_run_coop_panel, (T, I, INFO, U), \
+        (rocblas_handle handle, const I m, const I n, U A, const rocblas_stride shiftA,      \
+         const I lda, const rocblas_stride strideA, I* ipiv, const rocblas_stride shiftP,    \
+         const rocblas_stride strideP, INFO* info, const I batch_count, const bool pivot,    \
+         const I offset, I* permut_idx, const rocblas_stride stride, T* pivotval,            \
+         I* pivotidx),                                                                       \
+        (handle, m, n, A, shiftA, lda, strideA, ipiv, shiftP, strideP, info, batch_count,    \
+         pivot, offset, permut_idx, stride, pivotval, pivotidx))
+#define INSTANTIATE_GETF2_SCALE_UPDATE(T, I, U)                                     \
+    ROCSOLVER_INSTANTIATE_SPECIALIZED(void, getf2_run_scale_update, (T, I, U),      \
+        (rocblas_handle handle, const I m, const I n, T* pivotval, U A,             \
+         const rocblas_stride shiftA, const I lda, const rocblas_stride strideA,    \
+         const I batch_count, const I dimx, const I dimy),                          \
+        (handle, m, n, pivotval, A, shiftA, lda, strideA, batch_count, dimx, dimy))
 
 ROCSOLVER_END_NAMESPACE
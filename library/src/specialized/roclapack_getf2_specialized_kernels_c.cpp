@@ -36,6 +36,15 @@ ROCSOLVER_BEGIN_NAMESPACE
 INSTANTIATE_GETF2_PANEL(rocblas_float_complex, rocblas_int, rocblas_int, rocblas_float_complex*);
 INSTANTIATE_GETF2_PANEL(rocblas_float_complex, rocblas_int, rocblas_int, rocblas_float_complex* const*);
 
+INSTANTIATE_GETF2_COOP_PANEL(rocblas_float_complex,
+                             rocblas_int,
+                             rocblas_int,
+                             rocblas_float_complex*);
+INSTANTIATE_GETF2_COOP_PANEL(rocblas_float_complex,
+                             rocblas_int,
+                             rocblas_int,
+                             rocblas_float_complex* const*);
+
 INSTANTIATE_GETF2_SCALE_UPDATE(rocblas_float_complex, rocblas_int, rocblas_float_complex*);
 INSTANTIATE_GETF2_SCALE_UPDATE(rocblas_float_complex, rocblas_int, rocblas_float_complex* const*);
 
@@ -44,6 +53,12 @@ INSTANTIATE_GETF2_SCALE_UPDATE(rocblas_float_complex, rocblas_int, rocblas_float
 INSTANTIATE_GETF2_PANEL(rocblas_float_complex, int64_t, int64_t, rocblas_float_complex*);
 INSTANTIATE_GETF2_PANEL(rocblas_float_complex, int64_t, int64_t, rocblas_float_complex* const*);
 
+INSTANTIATE_GETF2_COOP_PANEL(rocblas_float_complex, int64_t, int64_t, rocblas_float_complex*);
+INSTANTIATE_GETF2_COOP_PANEL(rocblas_float_complex,
+                             int64_t,
+                             int64_t,
+                             rocblas_float_complex* const*);
+
 INSTANTIATE_GETF2_SCALE_UPDATE(rocblas_float_complex, int64_t, rocblas_float_complex*);
 INSTANTIATE_GETF2_SCALE_UPDATE(rocblas_float_complex, int64_t, rocblas_float_complex* const*);
 #endif /* HAVE_ROCBLAS_64 */
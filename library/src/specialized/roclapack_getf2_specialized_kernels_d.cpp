@@ -36,6 +36,9 @@ ROCSOLVER_BEGIN_NAMESPACE
 INSTANTIATE_GETF2_PANEL(double, rocblas_int, rocblas_int, double*);
 INSTANTIATE_GETF2_PANEL(double, rocblas_int, rocblas_int, double* const*);
 
+INSTANTIATE_GETF2_COOP_PANEL(double, rocblas_int, rocblas_int, double*);
+INSTANTIATE_GETF2_COOP_PANEL(double, rocblas_int, rocblas_int, double* const*);
+
 INSTANTIATE_GETF2_SCALE_UPDATE(double, rocblas_int, double*);
 INSTANTIATE_GETF2_SCALE_UPDATE(double, rocblas_int, double* const*);
 
@@ -44,6 +47,9 @@ INSTANTIATE_GETF2_SCALE_UPDATE(double, rocblas_int, double* const*);
 INSTANTIATE_GETF2_PANEL(double, int64_t, int64_t, double*);
 INSTANTIATE_GETF2_PANEL(double, int64_t, int64_t, double* const*);
 
+INSTANTIATE_GETF2_COOP_PANEL(double, int64_t, int64_t, double*);
+INSTANTIATE_GETF2_COOP_PANEL(double, int64_t, int64_t, double* const*);
+
 INSTANTIATE_GETF2_SCALE_UPDATE(double, int64_t, double*);
 INSTANTIATE_GETF2_SCALE_UPDATE(double, int64_t, double* const*);
 #endif /* HAVE_ROCBLAS_64 */
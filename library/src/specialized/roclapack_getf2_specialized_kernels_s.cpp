@@ -36,6 +36,9 @@ ROCSOLVER_BEGIN_NAMESPACE
 INSTANTIATE_GETF2_PANEL(float, rocblas_int, rocblas_int, float*);
 INSTANTIATE_GETF2_PANEL(float, rocblas_int, rocblas_int, float* const*);
 
+INSTANTIATE_GETF2_COOP_PANEL(float, rocblas_int, rocblas_int, float*);
+INSTANTIATE_GETF2_COOP_PANEL(float, rocblas_int, rocblas_int, float* const*);
+
 INSTANTIATE_GETF2_SCALE_UPDATE(float, rocblas_int, float*);
 INSTANTIATE_GETF2_SCALE_UPDATE(float, rocblas_int, float* const*);
 
@@ -44,6 +47,9 @@ INSTANTIATE_GETF2_SCALE_UPDATE(float, rocblas_int, float* const*);
 INSTANTIATE_GETF2_PANEL(float, int64_t, int64_t, float*);
 INSTANTIATE_GETF2_PANEL(float, int64_t, int64_t, float* const*);
 
+INSTANTIATE_GETF2_COOP_PANEL(float, int64_t, int64_t, float*);
+INSTANTIATE_GETF2_COOP_PANEL(float, int64_t, int64_t, float* const*);
+
 INSTANTIATE_GETF2_SCALE_UPDATE(float, int64_t, float*);
 INSTANTIATE_GETF2_SCALE_UPDATE(float, int64_t, float* const*);
 #endif /* HAVE_ROCBLAS_64 */
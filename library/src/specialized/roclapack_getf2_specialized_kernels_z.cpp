@@ -39,6 +39,15 @@ INSTANTIATE_GETF2_PANEL(rocblas_double_complex,
                         rocblas_int,
                         rocblas_double_complex* const*);
 
+INSTANTIATE_GETF2_COOP_PANEL(rocblas_double_complex,
+                             rocblas_int,
+                             rocblas_int,
+                             rocblas_double_complex*);
+INSTANTIATE_GETF2_COOP_PANEL(rocblas_double_complex,
+                             rocblas_int,
+                             rocblas_int,
+                             rocblas_double_complex* const*);
+
 INSTANTIATE_GETF2_SCALE_UPDATE(rocblas_double_complex, rocblas_int, rocblas_double_complex*);
 INSTANTIATE_GETF2_SCALE_UPDATE(rocblas_double_complex, rocblas_int, rocblas_double_complex* const*);
 
@@ -47,6 +56,12 @@ INSTANTIATE_GETF2_SCALE_UPDATE(rocblas_double_complex, rocblas_int, rocblas_doub
 INSTANTIATE_GETF2_PANEL(rocblas_double_complex, int64_t, int64_t, rocblas_double_complex*);
 INSTANTIATE_GETF2_PANEL(rocblas_double_complex, int64_t, int64_t, rocblas_double_complex* const*);
 
+INSTANTIATE_GETF2_COOP_PANEL(rocblas_double_complex, int64_t, int64_t, rocblas_double_complex*);
+INSTANTIATE_GETF2_COOP_PANEL(rocblas_double_complex,
+                             int64_t,
+                             int64_t,
+                             rocblas_double_complex* const*);
+
 INSTANTIATE_GETF2_SCALE_UPDATE(rocblas_double_complex, int64_t, rocblas_double_complex*);
 INSTANTIATE_GETF2_SCALE_UPDATE(rocblas_double_complex, int64_t, rocblas_double_complex* const*);
 #endif /* HAVE_ROCBLAS_64 */
@@ -33,6 +33,7 @@
 #pragma once
 
 #include "rocsolver_run_specialized_kernels.hpp"
+#include "rocsolver_specialized_module.hpp"
 
 ROCSOLVER_BEGIN_NAMESPACE
 
@@ -168,6 +169,332 @@ ROCSOLVER_KERNEL void __launch_bounds__(TRTRI_MAX_COLS)
         A[i + j * lda] = rA[j];
 }
 
+/** getri_kernel_medium inverts matrices with GETRI_MAX_COLS < n <= GETRI_BATCH_MEDIUM_SIZE
+    (one group per matrix, one thread per row). The computations are the same as in
+    getri_kernel_small, but the rows are kept in global memory, as they do not fit in registers.
+    Every thread only reads and writes its own row; the columns needed by all the threads are
+    shared through LDS **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(GETRI_BATCH_MEDIUM_SIZE)
+    getri_kernel_medium(const rocblas_int n,
+                        U AA,
+                        const rocblas_int shiftA,
+                        const rocblas_int lda,
+                        const rocblas_stride strideA,
+                        rocblas_int* ipivA,
+                        const rocblas_int shiftP,
+                        const rocblas_stride strideP,
+                        rocblas_int* info,
+                        const bool pivot)
+{
+    int b = hipBlockIdx_x;
+    int i = hipThreadIdx_x;
+
+    // batch instance
+    T* A = load_ptr_batch<T>(AA, b, shiftA, strideA);
+    rocblas_int* ipiv;
+    if(pivot)
+        ipiv = load_ptr_batch<rocblas_int>(ipivA, b, shiftP, strideP);
+
+    // shared memory (for communication between threads in group)
+    extern __shared__ double lmem[];
+    T* common = reinterpret_cast<T*>(lmem);
+    T* diag = common + n;
+    __shared__ rocblas_int _info;
+    T temp;
+    rocblas_int jp;
+
+    // compute info
+    if(i == 0)
+        _info = 0;
+    __syncthreads();
+    if(i < n && A[i + i * lda] == 0)
+    {
+        rocblas_int _info_temp = _info;
+        while(_info_temp == 0 || _info_temp > i + 1)
+            _info_temp = atomicCAS(&_info, _info_temp, i + 1);
+    }
+    __syncthreads();
+
+    if(i == 0)
+        info[b] = _info;
+    if(_info != 0)
+        return;
+
+    //--- TRTRI ---
+    // diagonal element
+    if(i < n)
+    {
+        temp = 1.0 / A[i + i * lda];
+        A[i + i * lda] = temp;
+        diag[i] = -temp;
+    }
+
+    // compute element i of each column j
+    for(rocblas_int j = 1; j < n; j++)
+    {
+        // share current column
+        if(i < j)
+            common[i] = A[i + j * lda];
+        __syncthreads();
+
+        if(i < j)
+        {
+            temp = 0;
+
+            for(rocblas_int ii = i; ii < j; ii++)
+                temp += A[i + ii * lda] * common[ii];
+
+            A[i + j * lda] = diag[j] * temp;
+        }
+        __syncthreads();
+    }
+
+    //--- GETRI ---
+    for(rocblas_int j = n - 2; j >= 0; j--)
+    {
+        // extract lower triangular column (copy_and_zero)
+        if(i > j && i < n)
+        {
+            common[i] = A[i + j * lda];
+            A[i + j * lda] = 0;
+        }
+        __syncthreads();
+
+        // update column j (gemv)
+        if(i < n)
+        {
+            temp = 0;
+
+            for(rocblas_int ii = j + 1; ii < n; ii++)
+                temp += A[i + ii * lda] * common[ii];
+
+            A[i + j * lda] -= temp;
+        }
+        __syncthreads();
+    }
+
+    // apply pivots (getri_pivot)
+    if(pivot && i < n)
+    {
+        for(rocblas_int j = n - 2; j >= 0; j--)
+        {
+            jp = ipiv[j] - 1;
+            if(jp != j)
+                swap(A[i + j * lda], A[i + jp * lda]);
+        }
+    }
+}
+
+/** getri_kernel_gj inverts matrices with n <= GETRI_BATCH_GJ_MAX_SIZE (one group per matrix,
+    one thread per row) with a blocked Gauss-Jordan scheme. Every step works with a panel of nb
+    columns that is kept in LDS: first, inv(U) is computed from left to right (each row above
+    the panel is multiplied by the panel and by the inverse of its diagonal block, which is
+    computed in LDS); then, inv(A) is obtained from right to left solving inv(A) * L = inv(U)
+    with the panels of L. Only the first stage is executed when trtri_only is true; in that case
+    a lower triangular matrix is inverted as the transpose of an upper triangular one. Every
+    thread only reads and writes its own row of the matrix, and the groups only synchronize
+    once per panel **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(GETRI_BATCH_GJ_MAX_SIZE)
+    getri_kernel_gj(const rocblas_fill uplo,
+                    const rocblas_diagonal diag,
+                    const rocblas_int n,
+                    const rocblas_int nb,
+                    U AA,
+                    const rocblas_int shiftA,
+                    const rocblas_int lda,
+                    const rocblas_stride strideA,
+                    rocblas_int* ipivA,
+                    const rocblas_int shiftP,
+                    const rocblas_stride strideP,
+                    rocblas_int* info,
+                    const bool trtri_only,
+                    const bool pivot)
+{
+    int b = hipBlockIdx_x;
+    int i = hipThreadIdx_x;
+
+    // batch instance
+    T* A = load_ptr_batch<T>(AA, b, shiftA, strideA);
+    rocblas_int* ipiv;
+    if(pivot)
+        ipiv = load_ptr_batch<rocblas_int>(ipivA, b, shiftP, strideP);
+
+    // element (r,c) of the upper triangular matrix (the transpose in the lower case)
+    const int64_t ldr = (uplo == rocblas_fill_upper) ? 1 : lda;
+    const int64_t ldc = (uplo == rocblas_fill_upper) ? lda : 1;
+    auto a = [=](rocblas_int r, rocblas_int c) -> T& { return A[r * ldr + c * ldc]; };
+    const bool unit = (diag == rocblas_diagonal_unit);
+
+    // shared memory: the current panel (n x nb) and the inverse of its diagonal block (nb x nb)
+    extern __shared__ double lmem[];
+    T* panel = reinterpret_cast<T*>(lmem);
+    T* invd = panel + n * nb;
+    __shared__ rocblas_int _info;
+    T temp;
+    rocblas_int jp;
+
+    // partial results of the current row (the panels have at most GETRI_BATCH_GJ_MAX_BLKSIZE
+    // columns, so that they can be kept in registers)
+    T y[GETRI_BATCH_GJ_MAX_BLKSIZE];
+
+    // compute info
+    if(i == 0)
+        _info = 0;
+    __syncthreads();
+    if(!unit && i < n && a(i, i) == 0)
+    {
+        rocblas_int _info_temp = _info;
+        while(_info_temp == 0 || _info_temp > i + 1)
+            _info_temp = atomicCAS(&_info, _info_temp, i + 1);
+    }
+    __syncthreads();
+
+    if(i == 0)
+        info[b] = _info;
+    if(_info != 0)
+        return;
+
+    //--- TRTRI ---
+    for(rocblas_int j = 0; j < n; j += nb)
+    {
+        const rocblas_int jb = std::min(nb, n - j);
+        const rocblas_int r = i - j;
+
+        // load panel U(0:j+jb-1, j:j+jb-1)
+        for(rocblas_int c = 0; c < jb; c++)
+        {
+            if(i <= j + c)
+                panel[i + c * n] = a(i, j + c);
+        }
+        __syncthreads();
+
+        // invert the diagonal block (thread j+r computes row r of the inverse)
+        if(r >= 0 && r < jb)
+            invd[r + r * nb] = unit ? T(1) : T(1) / panel[i + r * n];
+        __syncthreads();
+
+        if(r >= 0 && r < jb)
+        {
+            for(rocblas_int c = r + 1; c < jb; c++)
+            {
+                temp = 0;
+                for(rocblas_int k = r; k < c; k++)
+                    temp += invd[r + k * nb] * panel[j + k + c * n];
+                invd[r + c * nb] = -temp * invd[c + c * nb];
+            }
+        }
+        __syncthreads();
+
+        if(i < j)
+        {
+            // rows above the panel: X(i,J) = -X(i,0:j-1) * U(0:j-1,J) * inv(U(J,J))
+#pragma unroll
+            for(rocblas_int c = 0; c < GETRI_BATCH_GJ_MAX_BLKSIZE; c++)
+                y[c] = 0;
+
+            for(rocblas_int k = i; k < j; k++)
+            {
+                temp = a(i, k);
+#pragma unroll
+                for(rocblas_int c = 0; c < GETRI_BATCH_GJ_MAX_BLKSIZE; c++)
+                {
+                    if(c < jb)
+                        y[c] += temp * panel[k + c * n];
+                }
+            }
+
+#pragma unroll
+            for(rocblas_int c = 0; c < GETRI_BATCH_GJ_MAX_BLKSIZE; c++)
+            {
+                if(c < jb)
+                {
+                    temp = 0;
+#pragma unroll
+                    for(rocblas_int k = 0; k <= c; k++)
+                        temp += y[k] * invd[k + c * nb];
+                    a(i, j + c) = -temp;
+                }
+            }
+        }
+        else if(r < jb)
+        {
+            // rows of the panel: X(i,J) = inv(U(J,J))(r,:)
+            for(rocblas_int c = unit ? r + 1 : r; c < jb; c++)
+                a(i, j + c) = invd[r + c * nb];
+        }
+        __syncthreads();
+    }
+
+    if(trtri_only)
+        return;
+
+    //--- GETRI ---
+    for(rocblas_int j = ((n - 1) / nb) * nb; j >= 0; j -= nb)
+    {
+        const rocblas_int jb = std::min(nb, n - j);
+
+        // load panel L(j:n-1, j:j+jb-1)
+        for(rocblas_int c = 0; c < jb; c++)
+        {
+            if(i > j + c && i < n)
+                panel[i + c * n] = a(i, j + c);
+        }
+        __syncthreads();
+
+        if(i < n)
+        {
+            // Y = inv(U)(i,J) - X(i,j+jb:n-1) * L(j+jb:n-1,J)
+#pragma unroll
+            for(rocblas_int c = 0; c < GETRI_BATCH_GJ_MAX_BLKSIZE; c++)
+            {
+                if(c < jb)
+                    y[c] = (i > j + c) ? T(0) : a(i, j + c);
+            }
+
+            for(rocblas_int k = j + jb; k < n; k++)
+            {
+                temp = a(i, k);
+#pragma unroll
+                for(rocblas_int c = 0; c < GETRI_BATCH_GJ_MAX_BLKSIZE; c++)
+                {
+                    if(c < jb)
+                        y[c] -= temp * panel[k + c * n];
+                }
+            }
+
+            // solve X(i,J) * L(J,J) = Y (L has unit diagonal)
+#pragma unroll
+            for(rocblas_int c = GETRI_BATCH_GJ_MAX_BLKSIZE - 1; c >= 0; c--)
+            {
+                if(c < jb)
+                {
+#pragma unroll
+                    for(rocblas_int k = c + 1; k < GETRI_BATCH_GJ_MAX_BLKSIZE; k++)
+                    {
+                        if(k < jb)
+                            y[c] -= y[k] * panel[j + k + c * n];
+                    }
+                    a(i, j + c) = y[c];
+                }
+            }
+        }
+        __syncthreads();
+    }
+
+    // apply pivots (getri_pivot)
+    if(pivot && i < n)
+    {
+        for(rocblas_int j = n - 2; j >= 0; j--)
+        {
+            jp = ipiv[j] - 1;
+            if(jp != j)
+                swap(A[i + j * lda], A[i + jp * lda]);
+        }
+    }
+}
+
 /*************************************************************
     Launchers of specilized  kernels
 *************************************************************/
@@ -271,15 +598,105 @@ rocblas_status getri_run_small(rocblas_handle handle,
     return rocblas_status_success;
 }
 
+template <typename T, typename U>
+rocblas_status getri_run_medium(rocblas_handle handle,
+                                const rocblas_int n,
+                                U A,
+                                const rocblas_int shiftA,
+                                const rocblas_int lda,
+                                const rocblas_stride strideA,
+                                rocblas_int* ipiv,
+                                const rocblas_int shiftP,
+                                const rocblas_stride strideP,
+                                rocblas_int* info,
+                                const rocblas_int batch_count,
+                                const bool pivot)
+{
+    // (the threads are a multiple of the wavefront size)
+    rocblas_int threads = ((n - 1) / 64 + 1) * 64;
+    size_t lmemsize = 2 * n * sizeof(T);
+
+    dim3 grid(batch_count, 1, 1);
+    dim3 block(threads, 1, 1);
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    ROCSOLVER_LAUNCH_KERNEL((getri_kernel_medium<T>), grid, block, lmemsize, stream, n, A, shiftA,
+                            lda, strideA, ipiv, shiftP, strideP, info, pivot);
+
+    return rocblas_status_success;
+}
+
+template <typename T, typename U>
+rocblas_status getri_run_gj(rocblas_handle handle,
+                            const rocblas_fill uplo,
+                            const rocblas_diagonal diag,
+                            const rocblas_int n,
+                            const rocblas_int blk,
+                            U A,
+                            const rocblas_int shiftA,
+                            const rocblas_int lda,
+                            const rocblas_stride strideA,
+                            rocblas_int* ipiv,
+                            const rocblas_int shiftP,
+                            const rocblas_stride strideP,
+                            rocblas_int* info,
+                            const rocblas_int batch_count,
+                            const bool trtri_only,
+                            const bool pivot)
+{
+    // reduce the panel width until the panel fits in LDS
+    // (the amount of LDS shared memory is assumed to be at least 64 KB)
+    rocblas_int nb = std::max(1, std::min(blk, GETRI_BATCH_GJ_MAX_BLKSIZE));
+    while(nb > 1 && size_t(n + nb) * nb * sizeof(T) > 64 * 1024)
+        nb /= 2;
+
+    // (the threads are a multiple of the wavefront size)
+    rocblas_int threads = ((n - 1) / 64 + 1) * 64;
+    size_t lmemsize = size_t(n + nb) * nb * sizeof(T);
+
+    dim3 grid(batch_count, 1, 1);
+    dim3 block(threads, 1, 1);
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    ROCSOLVER_LAUNCH_KERNEL((getri_kernel_gj<T>), grid, block, lmemsize, stream, uplo, diag, n, nb,
+                            A, shiftA, lda, strideA, ipiv, shiftP, strideP, info, trtri_only,
+                            pivot);
+
+    return rocblas_status_success;
+}
+
 /*************************************************************
     Instantiation macros
 *************************************************************/
 
-#define INSTANTIATE_GETRI_SMALL(T, U)                                              \
-    template rocblas_status getri_run_small<T, U>(                                 \
-        rocblas_handle handle, const rocblas_int n, U A, const rocblas_int shiftA, \
-        const rocblas_int lda, const rocblas_stride strideA, rocblas_int* ipiv,    \
-        const rocblas_int shiftP, const rocblas_stride strideP, rocblas_int* info, \
-        const rocblas_int batch_count, const bool complete, const bool pivot)
+#define INSTANTIATE_GETRI_SMALL(T, U)                                                  \
+    ROCSOLVER_INSTANTIATE_SPECIALIZED(rocblas_status, getri_run_small, (T, U),         \
+        (rocblas_handle handle, const rocblas_int n, U A, const rocblas_int shiftA,    \
+         const rocblas_int lda, const rocblas_stride strideA, rocblas_int* ipiv,       \
+         const rocblas_int shiftP, const rocblas_stride strideP, rocblas_int* info,    \
+         const rocblas_int batch_count, const bool complete, const bool pivot),        \
+        (handle, n, A, shiftA, lda, strideA, ipiv, shiftP, strideP, info, batch_count, \
+         complete, pivot))
+#define INSTANTIATE_GETRI_MEDIUM(T, U)                                                 \
+    ROCSOLVER_INSTANTIATE_SPECIALIZED(rocblas_status, getri_run_medium, (T, U),        \
+        (rocblas_handle handle, const rocblas_int n, U A, const rocblas_int shiftA,    \
+         const rocblas_int lda, const rocblas_stride strideA, rocblas_int* ipiv,       \
+         const rocblas_int shiftP, const rocblas_stride strideP, rocblas_int* info,    \
+         const rocblas_int batch_count, const bool pivot),                             \
+        (handle, n, A, shiftA, lda, strideA, ipiv, shiftP, strideP, info, batch_count, \
+         pivot))
+#define INSTANTIATE_GETRI_GJ(T, U)                                                            \
+    ROCSOLVER_INSTANTIATE_SPECIALIZED(rocblas_status, getri_run_gj, (T, U),                   \
+        (rocblas_handle handle, const rocblas_fill uplo, const rocblas_diagonal diag,         \
+         const rocblas_int n, const rocblas_int blk, U A, const rocblas_int shiftA,           \
+         const rocblas_int lda, const rocblas_stride strideA, rocblas_int* ipiv,              \
+         const rocblas_int shiftP, const rocblas_stride strideP, rocblas_int* info,           \
+         const rocblas_int batch_count, const bool trtri_only, const bool pivot),             \
+        (handle, uplo, diag, n, blk, A, shiftA, lda, strideA, ipiv, shiftP, strideP, info,    \
+         batch_count, trtri_only, pivot))
 
 ROCSOLVER_END_NAMESPACE
@@ -36,4 +36,10 @@ ROCSOLVER_BEGIN_NAMESPACE
 INSTANTIATE_GETRI_SMALL(rocblas_float_complex, rocblas_float_complex*);
 INSTANTIATE_GETRI_SMALL(rocblas_float_complex, rocblas_float_complex* const*);
 
+INSTANTIATE_GETRI_MEDIUM(rocblas_float_complex, rocblas_float_complex*);
+INSTANTIATE_GETRI_MEDIUM(rocblas_float_complex, rocblas_float_complex* const*);
+
+INSTANTIATE_GETRI_GJ(rocblas_float_complex, rocblas_float_complex*);
+INSTANTIATE_GETRI_GJ(rocblas_float_complex, rocblas_float_complex* const*);
+
 ROCSOLVER_END_NAMESPACE
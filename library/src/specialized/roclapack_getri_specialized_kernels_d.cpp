@@ -36,4 +36,10 @@ ROCSOLVER_BEGIN_NAMESPACE
 INSTANTIATE_GETRI_SMALL(double, double*);
 INSTANTIATE_GETRI_SMALL(double, double* const*);
 
+INSTANTIATE_GETRI_MEDIUM(double, double*);
+INSTANTIATE_GETRI_MEDIUM(double, double* const*);
+
+INSTANTIATE_GETRI_GJ(double, double*);
+INSTANTIATE_GETRI_GJ(double, double* const*);
+
 ROCSOLVER_END_NAMESPACE
@@ -36,4 +36,10 @@ ROCSOLVER_BEGIN_NAMESPACE
 INSTANTIATE_GETRI_SMALL(float, float*);
 INSTANTIATE_GETRI_SMALL(float, float* const*);
 
+INSTANTIATE_GETRI_MEDIUM(float, float*);
+INSTANTIATE_GETRI_MEDIUM(float, float* const*);
+
+INSTANTIATE_GETRI_GJ(float, float*);
+INSTANTIATE_GETRI_GJ(float, float* const*);
+
 ROCSOLVER_END_NAMESPACE
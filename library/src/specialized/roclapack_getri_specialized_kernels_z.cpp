@@ -36,4 +36,10 @@ ROCSOLVER_BEGIN_NAMESPACE
 INSTANTIATE_GETRI_SMALL(rocblas_double_complex, rocblas_double_complex*);
 INSTANTIATE_GETRI_SMALL(rocblas_double_complex, rocblas_double_complex* const*);
 
+INSTANTIATE_GETRI_MEDIUM(rocblas_double_complex, rocblas_double_complex*);
+INSTANTIATE_GETRI_MEDIUM(rocblas_double_complex, rocblas_double_complex* const*);
+
+INSTANTIATE_GETRI_GJ(rocblas_double_complex, rocblas_double_complex*);
+INSTANTIATE_GETRI_GJ(rocblas_double_complex, rocblas_double_complex* const*);
+
 ROCSOLVER_END_NAMESPACE
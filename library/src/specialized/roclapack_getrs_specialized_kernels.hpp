@@ -0,0 +1,297 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "rocsolver_run_specialized_kernels.hpp"
+#include "rocsolver_specialized_module.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/*************************************************************
+    Templated kernels are instantiated in separate cpp
+    files in order to improve compilation times and reduce
+    the library size.
+*************************************************************/
+
+/** getrs_small_kernel solves the linear systems op(A) * X = B of tiny size
+    n = DIM <= GETRS_SMALL_MAX_SIZE, given the LU factorization of A computed by GETRF.
+    Every thread keeps a row of op(L\U) and of a block of columns of B in registers;
+    the row interchanges, and the forward and backward substitutions are all computed
+    by the same thread group, so that the factors and B are read only once. **/
+template <int DIM, typename T, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(GETRS_SMALL_MAX_THDS)
+    getrs_small_kernel(const rocblas_operation trans,
+                       const rocblas_int nrhs,
+                       U AA,
+                       const rocblas_stride shiftA,
+                       const rocblas_int lda,
+                       const rocblas_stride strideA,
+                       const rocblas_int* ipivA,
+                       const rocblas_stride strideP,
+                       U BB,
+                       const rocblas_stride shiftB,
+                       const rocblas_int ldb,
+                       const rocblas_stride strideB,
+                       const rocblas_int batch_count,
+                       const bool pivot)
+{
+    const rocblas_int myrow = hipThreadIdx_x;
+    const rocblas_int ty = hipThreadIdx_y;
+    const rocblas_int id = hipBlockIdx_y * static_cast<rocblas_int>(hipBlockDim_y) + ty;
+
+    if(id >= batch_count)
+        return;
+
+    // batch instance
+    T* A = load_ptr_batch<T>(AA, id, shiftA, strideA);
+    T* B = load_ptr_batch<T>(BB, id, shiftB, strideB);
+    const rocblas_int* ipiv = ipivA + id * strideP;
+
+    // shared memory (for communication between threads in group)
+    extern __shared__ double lmem[];
+    T* common = reinterpret_cast<T*>(lmem);
+    rocblas_int* perm = reinterpret_cast<rocblas_int*>(common + hipBlockDim_y * GETRS_SMALL_NB);
+    common += ty * GETRS_SMALL_NB;
+    perm += ty * DIM;
+
+    // local variables
+    const bool notrans = (trans == rocblas_operation_none);
+    const bool conjug = (trans == rocblas_operation_conjugate_transpose);
+    T rA[DIM]; // to store this-row values of op(A)
+    T rB[GETRS_SMALL_NB]; // to store this-row values of a block of columns of B
+
+    // read corresponding row of op(A) from global memory into local array
+    // (row myrow of op(A) is column myrow of A in the transposed cases)
+#pragma unroll DIM
+    for(rocblas_int j = 0; j < DIM; ++j)
+    {
+        if(notrans)
+            rA[j] = A[myrow + j * lda];
+        else
+            rA[j] = conjug ? conj(A[j + myrow * lda]) : A[j + myrow * lda];
+    }
+
+    // find the row of B that ends in position myrow after the row interchanges
+    // (every thread follows its own row through the interchanges)
+    rocblas_int pos = myrow;
+    if(pivot)
+    {
+        for(rocblas_int k = 0; k < DIM; ++k)
+        {
+            const rocblas_int p = ipiv[k] - 1;
+            if(pos == k)
+                pos = p;
+            else if(pos == p)
+                pos = k;
+        }
+    }
+    perm[pos] = myrow;
+    __syncthreads();
+    const rocblas_int src = perm[myrow];
+
+    // solve with blocks of up to GETRS_SMALL_NB columns of B
+    // (P is applied when reading B if trans = none, and P' when writing X otherwise)
+    for(rocblas_int c0 = 0; c0 < nrhs; c0 += GETRS_SMALL_NB)
+    {
+        const rocblas_int nc = std::min(GETRS_SMALL_NB, nrhs - c0);
+        for(rocblas_int c = 0; c < nc; ++c)
+            rB[c] = B[(notrans ? src : myrow) + (c0 + c) * ldb];
+        __syncthreads();
+
+        // forward substitution with L (unit diagonal) or U' (non-unit diagonal)
+        for(rocblas_int k = 0; k < DIM; ++k)
+        {
+            if(myrow == k)
+                for(rocblas_int c = 0; c < nc; ++c)
+                {
+                    if(!notrans)
+                        rB[c] /= rA[k];
+                    common[c] = rB[c];
+                }
+            __syncthreads();
+
+            if(myrow > k)
+                for(rocblas_int c = 0; c < nc; ++c)
+                    rB[c] -= rA[k] * common[c];
+            __syncthreads();
+        }
+
+        // backward substitution with U (non-unit diagonal) or L' (unit diagonal)
+        for(rocblas_int k = DIM - 1; k >= 0; --k)
+        {
+            if(myrow == k)
+                for(rocblas_int c = 0; c < nc; ++c)
+                {
+                    if(notrans)
+                        rB[c] /= rA[k];
+                    common[c] = rB[c];
+                }
+            __syncthreads();
+
+            if(myrow < k)
+                for(rocblas_int c = 0; c < nc; ++c)
+                    rB[c] -= rA[k] * common[c];
+            __syncthreads();
+        }
+
+        // write solution to global memory
+        for(rocblas_int c = 0; c < nc; ++c)
+            B[(notrans ? myrow : src) + (c0 + c) * ldb] = rB[c];
+    }
+}
+
+/*************************************************************
+    Launchers of specialized kernels
+*************************************************************/
+
+/** launcher of getrs_small_kernel **/
+template <typename T, typename U>
+rocblas_status getrs_run_small(rocblas_handle handle,
+                               const rocblas_operation trans,
+                               const rocblas_int n,
+                               const rocblas_int nrhs,
+                               U A,
+                               const rocblas_stride shiftA,
+                               const rocblas_int lda,
+                               const rocblas_stride strideA,
+                               const rocblas_int* ipiv,
+                               const rocblas_stride strideP,
+                               U B,
+                               const rocblas_stride shiftB,
+                               const rocblas_int ldb,
+                               const rocblas_stride strideB,
+                               const rocblas_int batch_count,
+                               const bool pivot)
+{
+#define RUN_GETRS_SMALL(DIM)                                                                   \
+    ROCSOLVER_LAUNCH_KERNEL((getrs_small_kernel<DIM, T>), grid, block, lmemsize, stream, trans, \
+                            nrhs, A, shiftA, lda, strideA, ipiv, strideP, B, shiftB, ldb,       \
+                            strideB, batch_count, pivot)
+
+    // determine sizes
+    // (as many groups of n threads per thread block as possible)
+    rocblas_int ngrp = std::max(1, std::min(batch_count, GETRS_SMALL_MAX_THDS / n));
+    rocblas_int blocks = (batch_count - 1) / ngrp + 1;
+
+    // prepare kernel launch
+    dim3 grid(1, blocks, 1);
+    dim3 block(n, ngrp, 1);
+    size_t lmemsize = ngrp * (GETRS_SMALL_NB * sizeof(T) + n * sizeof(rocblas_int));
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // instantiate cases to make number of columns n known at compile time
+    // this should allow loop unrolling.
+    // kernel launch
+    switch(n)
+    {
+    case 1: RUN_GETRS_SMALL(1); break;
+    case 2: RUN_GETRS_SMALL(2); break;
+    case 3: RUN_GETRS_SMALL(3); break;
+    case 4: RUN_GETRS_SMALL(4); break;
+    case 5: RUN_GETRS_SMALL(5); break;
+    case 6: RUN_GETRS_SMALL(6); break;
+    case 7: RUN_GETRS_SMALL(7); break;
+    case 8: RUN_GETRS_SMALL(8); break;
+    case 9: RUN_GETRS_SMALL(9); break;
+    case 10: RUN_GETRS_SMALL(10); break;
+    case 11: RUN_GETRS_SMALL(11); break;
+    case 12: RUN_GETRS_SMALL(12); break;
+    case 13: RUN_GETRS_SMALL(13); break;
+    case 14: RUN_GETRS_SMALL(14); break;
+    case 15: RUN_GETRS_SMALL(15); break;
+    case 16: RUN_GETRS_SMALL(16); break;
+    case 17: RUN_GETRS_SMALL(17); break;
+    case 18: RUN_GETRS_SMALL(18); break;
+    case 19: RUN_GETRS_SMALL(19); break;
+    case 20: RUN_GETRS_SMALL(20); break;
+    case 21: RUN_GETRS_SMALL(21); break;
+    case 22: RUN_GETRS_SMALL(22); break;
+    case 23: RUN_GETRS_SMALL(23); break;
+    case 24: RUN_GETRS_SMALL(24); break;
+    case 25: RUN_GETRS_SMALL(25); break;
+    case 26: RUN_GETRS_SMALL(26); break;
+    case 27: RUN_GETRS_SMALL(27); break;
+    case 28: RUN_GETRS_SMALL(28); break;
+    case 29: RUN_GETRS_SMALL(29); break;
+    case 30: RUN_GETRS_SMALL(30); break;
+    case 31: RUN_GETRS_SMALL(31); break;
+    case 32: RUN_GETRS_SMALL(32); break;
+    case 33: RUN_GETRS_SMALL(33); break;
+    case 34: RUN_GETRS_SMALL(34); break;
+    case 35: RUN_GETRS_SMALL(35); break;
+    case 36: RUN_GETRS_SMALL(36); break;
+    case 37: RUN_GETRS_SMALL(37); break;
+    case 38: RUN_GETRS_SMALL(38); break;
+    case 39: RUN_GETRS_SMALL(39); break;
+    case 40: RUN_GETRS_SMALL(40); break;
+    case 41: RUN_GETRS_SMALL(41); break;
+    case 42: RUN_GETRS_SMALL(42); break;
+    case 43: RUN_GETRS_SMALL(43); break;
+    case 44: RUN_GETRS_SMALL(44); break;
+    case 45: RUN_GETRS_SMALL(45); break;
+    case 46: RUN_GETRS_SMALL(46); break;
+    case 47: RUN_GETRS_SMALL(47); break;
+    case 48: RUN_GETRS_SMALL(48); break;
+    case 49: RUN_GETRS_SMALL(49); break;
+    case 50: RUN_GETRS_SMALL(50); break;
+    case 51: RUN_GETRS_SMALL(51); break;
+    case 52: RUN_GETRS_SMALL(52); break;
+    case 53: RUN_GETRS_SMALL(53); break;
+    case 54: RUN_GETRS_SMALL(54); break;
+    case 55: RUN_GETRS_SMALL(55); break;
+    case 56: RUN_GETRS_SMALL(56); break;
+    case 57: RUN_GETRS_SMALL(57); break;
+    case 58: RUN_GETRS_SMALL(58); break;
+    case 59: RUN_GETRS_SMALL(59); break;
+    case 60: RUN_GETRS_SMALL(60); break;
+    case 61: RUN_GETRS_SMALL(61); break;
+    case 62: RUN_GETRS_SMALL(62); break;
+    case 63: RUN_GETRS_SMALL(63); break;
+    case 64: RUN_GETRS_SMALL(64); break;
+    default: ROCSOLVER_UNREACHABLE();
+    }
+
+    return rocblas_status_success;
+}
+
+/*************************************************************
+    Instantiation macros
+*************************************************************/
+
+#define INSTANTIATE_GETRS_SMALL(T, U)                                                         \
+    ROCSOLVER_INSTANTIATE_SPECIALIZED(rocblas_status, getrs_run_small, (T, U),                \
+        (rocblas_handle handle, const rocblas_operation trans, const rocblas_int n,           \
+         const rocblas_int nrhs, U A, const rocblas_stride shiftA, const rocblas_int lda,     \
+         const rocblas_stride strideA, const rocblas_int* ipiv, const rocblas_stride strideP, \
+         U B, const rocblas_stride shiftB, const rocblas_int ldb,                             \
+         const rocblas_stride strideB, const rocblas_int batch_count, const bool pivot),      \
+        (handle, trans, n, nrhs, A, shiftA, lda, strideA, ipiv, strideP, B, shiftB, ldb,      \
+         strideB, batch_count, pivot))
+
+ROCSOLVER_END_NAMESPACE
@@ -0,0 +1,652 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "lapack_device_functions.hpp"
+#include "roclapack_geqr2_specialized_kernels.hpp"
+#include "rocsolver_run_specialized_kernels.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/** Geometry of the megakernels: the matrices are factorized by block columns of MEGAKERNEL_NB
+    columns, and the trailing updates are computed by tiles of MEGAKERNEL_TILE x MEGAKERNEL_TILE
+    entries, with MEGAKERNEL_DIM x MEGAKERNEL_DIM threads per thread-block (each thread updates
+    MEGAKERNEL_REG x MEGAKERNEL_REG entries of a tile) **/
+#define MEGAKERNEL_NB 32
+#define MEGAKERNEL_TILE 32
+#define MEGAKERNEL_DIM 16
+#define MEGAKERNEL_REG (MEGAKERNEL_TILE / MEGAKERNEL_DIM)
+#define MEGAKERNEL_THDS (MEGAKERNEL_DIM * MEGAKERNEL_DIM)
+
+/** POTRF_MK_GET returns the entry (i,j), i >= j, of the lower triangle of a Hermitian matrix
+    whose uplo triangle is stored in A, and POTRF_MK_SET sets it **/
+template <typename T>
+__device__ static T potrf_mk_get(const bool upper,
+                                 const T* A,
+                                 const rocblas_int lda,
+                                 const rocblas_int i,
+                                 const rocblas_int j)
+{
+    const int64_t ld = lda;
+    return upper ? conj(A[j + i * ld]) : A[i + j * ld];
+}
+
+template <typename T>
+__device__ static void potrf_mk_set(const bool upper,
+                                    T* A,
+                                    const rocblas_int lda,
+                                    const rocblas_int i,
+                                    const rocblas_int j,
+                                    const T val)
+{
+    const int64_t ld = lda;
+    if(upper)
+        A[j + i * ld] = conj(val);
+    else
+        A[i + j * ld] = val;
+}
+
+/*************************************************************
+    Templated kernels are instantiated in separate cpp
+    files in order to improve compilation times and reduce
+    the library size.
+*************************************************************/
+
+/** POTRF_MEGAKERNEL computes the Cholesky factorization of a mid-size matrix with the
+    right-looking blocked algorithm in a single launch. Each thread-block works with one matrix
+    of the batch, in global memory: the diagonal block is factorized in LDS, the block column
+    below it is solved with one thread per row, and the trailing matrix is updated by tiles,
+    with the corresponding rows of the block column staged in LDS. The factorization stops at
+    the first non-positive leading minor, whose order is written to info. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(MEGAKERNEL_THDS)
+    potrf_megakernel(const rocblas_fill uplo,
+                     const rocblas_int n,
+                     U AA,
+                     const rocblas_stride shiftA,
+                     const rocblas_int lda,
+                     const rocblas_stride strideA,
+                     rocblas_int* info)
+{
+    using S = decltype(std::real(T{}));
+
+    const rocblas_int bid = hipBlockIdx_z;
+    const rocblas_int tx = hipThreadIdx_x;
+    const rocblas_int ty = hipThreadIdx_y;
+    const rocblas_int tid = tx + ty * MEGAKERNEL_DIM;
+    const bool upper = (uplo == rocblas_fill_upper);
+
+    // select batch instance
+    T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+
+    // shared memory setup: the diagonal block, and the rows of the block column
+    // used by the current tile of the trailing matrix
+    __shared__ T sD[MEGAKERNEL_NB][MEGAKERNEL_NB + 1];
+    __shared__ T sI[MEGAKERNEL_TILE][MEGAKERNEL_NB + 1];
+    __shared__ T sJ[MEGAKERNEL_TILE][MEGAKERNEL_NB + 1];
+    __shared__ rocblas_int sinfo;
+
+    if(tid == 0)
+        sinfo = 0;
+    __syncthreads();
+
+    for(rocblas_int j0 = 0; j0 < n; j0 += MEGAKERNEL_NB)
+    {
+        const rocblas_int jb = std::min(MEGAKERNEL_NB, n - j0);
+
+        // factorize the diagonal block in LDS
+        for(rocblas_int e = tid; e < jb * jb; e += MEGAKERNEL_THDS)
+        {
+            rocblas_int i = e % jb;
+            rocblas_int j = e / jb;
+            if(i >= j)
+                sD[i][j] = potrf_mk_get(upper, A, lda, j0 + i, j0 + j);
+        }
+        __syncthreads();
+
+        for(rocblas_int k = 0; k < jb; k++)
+        {
+            if(tid == 0)
+            {
+                S d = std::real(sD[k][k]);
+                if(d > 0)
+                    sD[k][k] = T(sqrt(d));
+                else
+                    sinfo = j0 + k + 1;
+            }
+            __syncthreads();
+            if(sinfo != 0)
+                break;
+
+            const T rd = T(S(1) / std::real(sD[k][k]));
+            for(rocblas_int i = k + 1 + tid; i < jb; i += MEGAKERNEL_THDS)
+                sD[i][k] *= rd;
+            __syncthreads();
+
+            const rocblas_int r = jb - k - 1;
+            for(rocblas_int e = tid; e < r * r; e += MEGAKERNEL_THDS)
+            {
+                rocblas_int i = k + 1 + e % r;
+                rocblas_int j = k + 1 + e / r;
+                if(i >= j)
+                    sD[i][j] -= sD[i][k] * conj(sD[j][k]);
+            }
+            __syncthreads();
+        }
+
+        // write back the diagonal block
+        // (only partially factorized if the matrix is not positive definite)
+        for(rocblas_int e = tid; e < jb * jb; e += MEGAKERNEL_THDS)
+        {
+            rocblas_int i = e % jb;
+            rocblas_int j = e / jb;
+            if(i >= j)
+                potrf_mk_set(upper, A, lda, j0 + i, j0 + j, sD[i][j]);
+        }
+        if(sinfo != 0)
+            break;
+
+        // solve the block column below the diagonal block, L21 = A21 * inv(L11)',
+        // with one row per thread kept in registers
+        for(rocblas_int i = j0 + jb + tid; i < n; i += MEGAKERNEL_THDS)
+        {
+            T x[MEGAKERNEL_NB];
+#pragma unroll
+            for(rocblas_int k = 0; k < MEGAKERNEL_NB; k++)
+            {
+                if(k < jb)
+                    x[k] = potrf_mk_get(upper, A, lda, i, j0 + k);
+            }
+
+#pragma unroll
+            for(rocblas_int k = 0; k < MEGAKERNEL_NB; k++)
+            {
+                if(k < jb)
+                {
+                    T t = x[k];
+#pragma unroll
+                    for(rocblas_int l = 0; l < k; l++)
+                        t -= x[l] * conj(sD[k][l]);
+                    x[k] = t * T(S(1) / std::real(sD[k][k]));
+                }
+            }
+
+#pragma unroll
+            for(rocblas_int k = 0; k < MEGAKERNEL_NB; k++)
+            {
+                if(k < jb)
+                    potrf_mk_set(upper, A, lda, i, j0 + k, x[k]);
+            }
+        }
+        __syncthreads();
+
+        // update the lower triangle of the trailing matrix, A22 = A22 - L21 * L21'
+        const rocblas_int t0 = j0 + jb;
+        for(rocblas_int ti = t0; ti < n; ti += MEGAKERNEL_TILE)
+        {
+            for(rocblas_int tj = t0; tj <= ti; tj += MEGAKERNEL_TILE)
+            {
+                for(rocblas_int e = tid; e < MEGAKERNEL_TILE * jb; e += MEGAKERNEL_THDS)
+                {
+                    rocblas_int ii = e % MEGAKERNEL_TILE;
+                    rocblas_int k = e / MEGAKERNEL_TILE;
+                    sI[ii][k] = (ti + ii < n ? potrf_mk_get(upper, A, lda, ti + ii, j0 + k) : T(0));
+                    sJ[ii][k] = (tj + ii < n ? potrf_mk_get(upper, A, lda, tj + ii, j0 + k) : T(0));
+                }
+                __syncthreads();
+
+                for(rocblas_int r = 0; r < MEGAKERNEL_REG; r++)
+                {
+                    for(rocblas_int c = 0; c < MEGAKERNEL_REG; c++)
+                    {
+                        rocblas_int ii = tx + r * MEGAKERNEL_DIM;
+                        rocblas_int jj = ty + c * MEGAKERNEL_DIM;
+                        rocblas_int i = ti + ii;
+                        rocblas_int j = tj + jj;
+                        if(i < n && i >= j)
+                        {
+                            T t = 0;
+                            for(rocblas_int k = 0; k < jb; k++)
+                                t += sI[ii][k] * conj(sJ[jj][k]);
+                            t = potrf_mk_get(upper, A, lda, i, j) - t;
+                            potrf_mk_set(upper, A, lda, i, j, t);
+                        }
+                    }
+                }
+                __syncthreads();
+            }
+        }
+    }
+
+    if(tid == 0)
+        info[bid] = sinfo;
+}
+
+/** GETRF_MEGAKERNEL computes the LU factorization (with or without partial pivoting) of a
+    mid-size matrix with the right-looking blocked algorithm in a single launch. Each
+    thread-block works with one matrix of the batch, in global memory: the block column is
+    factorized one column at a time (the row interchanges are applied to the whole rows), the
+    block row is solved with one column per thread and L11 in LDS, and the trailing matrix is
+    updated by tiles, with the corresponding parts of the block column and block row staged in
+    LDS. As in LAPACK, info is the index of the first zero pivot, and the factorization is
+    completed anyway. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(MEGAKERNEL_THDS)
+    getrf_megakernel(const rocblas_int m,
+                     const rocblas_int n,
+                     U AA,
+                     const rocblas_stride shiftA,
+                     const rocblas_int lda,
+                     const rocblas_stride strideA,
+                     rocblas_int* ipivA,
+                     const rocblas_stride shiftP,
+                     const rocblas_stride strideP,
+                     rocblas_int* info,
+                     const bool pivot)
+{
+    using S = decltype(std::real(T{}));
+
+    const rocblas_int bid = hipBlockIdx_z;
+    const rocblas_int tx = hipThreadIdx_x;
+    const rocblas_int ty = hipThreadIdx_y;
+    const rocblas_int tid = tx + ty * MEGAKERNEL_DIM;
+    const int64_t ld = lda;
+
+    // select batch instance
+    T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+    rocblas_int* ipiv = pivot ? ipivA + shiftP + bid * strideP : nullptr;
+
+    // shared memory setup: L11, the rows of L21 and the columns of U12 used by the
+    // current tile of the trailing matrix, and the workspace for the pivot search
+    __shared__ T sD[MEGAKERNEL_NB][MEGAKERNEL_NB + 1];
+    __shared__ T sI[MEGAKERNEL_TILE][MEGAKERNEL_NB + 1];
+    __shared__ T sJ[MEGAKERNEL_NB][MEGAKERNEL_TILE + 1];
+    __shared__ S sval[MEGAKERNEL_THDS];
+    __shared__ rocblas_int sidx[MEGAKERNEL_THDS];
+    __shared__ rocblas_int sinfo;
+
+    if(tid == 0)
+        sinfo = 0;
+    __syncthreads();
+
+    const rocblas_int dim = std::min(m, n);
+    for(rocblas_int j0 = 0; j0 < dim; j0 += MEGAKERNEL_NB)
+    {
+        const rocblas_int jb = std::min(MEGAKERNEL_NB, dim - j0);
+
+        // factorize the block column, one column at a time
+        for(rocblas_int k = j0; k < j0 + jb; k++)
+        {
+            if(pivot)
+            {
+                // find the pivot, and interchange the rows
+                iamax<MEGAKERNEL_THDS>(tid, m - k, A + k + k * ld, 1, sval, sidx);
+                __syncthreads();
+
+                const rocblas_int p = k + sidx[0] - 1;
+                if(tid == 0)
+                    ipiv[k] = p + 1;
+                if(p != k)
+                {
+                    for(rocblas_int c = tid; c < n; c += MEGAKERNEL_THDS)
+                        swap(A[k + c * ld], A[p + c * ld]);
+                }
+                __syncthreads();
+            }
+
+            // scale the column below the pivot
+            const T piv = A[k + k * ld];
+            if(piv != T(0))
+            {
+                const T rpiv = T(1) / piv;
+                for(rocblas_int i = k + 1 + tid; i < m; i += MEGAKERNEL_THDS)
+                    A[i + k * ld] *= rpiv;
+            }
+            else if(tid == 0 && sinfo == 0)
+                sinfo = k + 1;
+            __syncthreads();
+
+            // update the rest of the block column
+            const rocblas_int rr = m - k - 1;
+            const rocblas_int cc = j0 + jb - k - 1;
+            for(rocblas_int e = tid; e < rr * cc; e += MEGAKERNEL_THDS)
+            {
+                rocblas_int i = k + 1 + e % rr;
+                rocblas_int c = k + 1 + e / rr;
+                A[i + c * ld] -= A[i + k * ld] * A[k + c * ld];
+            }
+            __syncthreads();
+        }
+
+        const rocblas_int t0 = j0 + jb;
+        if(t0 >= n)
+            break;
+
+        // solve the block row, U12 = inv(L11) * A12, with one column per thread kept
+        // in registers
+        for(rocblas_int e = tid; e < jb * jb; e += MEGAKERNEL_THDS)
+            sD[e % jb][e / jb] = A[(j0 + e % jb) + (j0 + e / jb) * ld];
+        __syncthreads();
+
+        for(rocblas_int c = t0 + tid; c < n; c += MEGAKERNEL_THDS)
+        {
+            T x[MEGAKERNEL_NB];
+#pragma unroll
+            for(rocblas_int k = 0; k < MEGAKERNEL_NB; k++)
+            {
+                if(k < jb)
+                    x[k] = A[(j0 + k) + c * ld];
+            }
+
+#pragma unroll
+            for(rocblas_int k = 0; k < MEGAKERNEL_NB; k++)
+            {
+                if(k < jb)
+                {
+                    T t = x[k];
+#pragma unroll
+                    for(rocblas_int l = 0; l < k; l++)
+                        t -= sD[k][l] * x[l];
+                    x[k] = t;
+                }
+            }
+
+#pragma unroll
+            for(rocblas_int k = 0; k < MEGAKERNEL_NB; k++)
+            {
+                if(k < jb)
+                    A[(j0 + k) + c * ld] = x[k];
+            }
+        }
+        __syncthreads();
+
+        // update the trailing matrix, A22 = A22 - L21 * U12
+        for(rocblas_int ti = t0; ti < m; ti += MEGAKERNEL_TILE)
+        {
+            for(rocblas_int tj = t0; tj < n; tj += MEGAKERNEL_TILE)
+            {
+                for(rocblas_int e = tid; e < MEGAKERNEL_TILE * jb; e += MEGAKERNEL_THDS)
+                {
+                    rocblas_int ii = e % MEGAKERNEL_TILE;
+                    rocblas_int k = e / MEGAKERNEL_TILE;
+                    sI[ii][k] = (ti + ii < m ? A[(ti + ii) + (j0 + k) * ld] : T(0));
+                }
+                for(rocblas_int e = tid; e < jb * MEGAKERNEL_TILE; e += MEGAKERNEL_THDS)
+                {
+                    rocblas_int k = e % jb;
+                    rocblas_int jj = e / jb;
+                    sJ[k][jj] = (tj + jj < n ? A[(j0 + k) + (tj + jj) * ld] : T(0));
+                }
+                __syncthreads();
+
+                for(rocblas_int r = 0; r < MEGAKERNEL_REG; r++)
+                {
+                    for(rocblas_int c = 0; c < MEGAKERNEL_REG; c++)
+                    {
+                        rocblas_int ii = tx + r * MEGAKERNEL_DIM;
+                        rocblas_int jj = ty + c * MEGAKERNEL_DIM;
+                        rocblas_int i = ti + ii;
+                        rocblas_int j = tj + jj;
+                        if(i < m && j < n)
+                        {
+                            T t = 0;
+                            for(rocblas_int k = 0; k < jb; k++)
+                                t += sI[ii][k] * sJ[k][jj];
+                            A[i + j * ld] -= t;
+                        }
+                    }
+                }
+                __syncthreads();
+            }
+        }
+    }
+
+    if(tid == 0)
+        info[bid] = sinfo;
+}
+
+/** GEQRF_MEGAKERNEL computes the QR factorization of a mid-size matrix in a single launch.
+    Each thread-block works with one matrix of the batch, in global memory. For every column,
+    the Householder vector is generated and kept in LDS, and the reflector is applied to the
+    trailing columns, with the x-dimension of the thread-block running over the rows and the
+    y-dimension over the columns (as in GEQR2_KERNEL_SMALL). The scalars tau are written
+    directly to ipivA. (m must be at most MEGAKERNEL_MAX_N, and the number of threads in the
+    x-dimension must be a power of 2) **/
+template <typename T, typename U, typename V>
+ROCSOLVER_KERNEL void __launch_bounds__(MEGAKERNEL_THDS)
+    geqrf_megakernel(const rocblas_int m,
+                     const rocblas_int n,
+                     U AA,
+                     const rocblas_stride shiftA,
+                     const rocblas_int lda,
+                     const rocblas_stride strideA,
+                     V ipivA,
+                     const rocblas_stride strideP)
+{
+    const rocblas_int bid = hipBlockIdx_z;
+    const rocblas_int tx = hipThreadIdx_x;
+    const rocblas_int ty = hipThreadIdx_y;
+    const rocblas_int dimx = hipBlockDim_x;
+    const rocblas_int dimy = hipBlockDim_y;
+    const rocblas_int tid = tx + ty * dimx;
+    const int64_t ld = lda;
+
+    // select batch instance
+    T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+    T* tau = load_ptr_batch<T>(ipivA, bid, 0, strideP);
+
+    // shared memory setup: the Householder vector and the workspace for the reductions
+    __shared__ T sv[MEGAKERNEL_MAX_N];
+    __shared__ T sred[MEGAKERNEL_THDS];
+    __shared__ T stau, sscal;
+
+    const rocblas_int dim = std::min(m, n);
+    for(rocblas_int j = 0; j < dim; ++j)
+    {
+        // column j from the diagonal
+        T* a = A + j + j * ld;
+        const rocblas_int mm = m - j;
+        for(rocblas_int i = tid; i < mm; i += MEGAKERNEL_THDS)
+            sv[i] = a[i];
+        __syncthreads();
+
+        // compute squared norm of v(1:mm-1)
+        T sum = 0;
+        for(rocblas_int i = tid + 1; i < mm; i += MEGAKERNEL_THDS)
+            sum += sv[i] * conj(sv[i]);
+        sred[tid] = sum;
+        __syncthreads();
+
+        for(rocblas_int s = MEGAKERNEL_THDS / 2; s > 0; s /= 2)
+        {
+            if(tid < s)
+                sred[tid] += sred[tid + s];
+            __syncthreads();
+        }
+
+        // generate Householder reflector to work on column j
+        if(tid == 0)
+        {
+            T alpha = sv[0];
+            geqr2_set_taubeta(alpha, sred[0], stau, sscal);
+            tau[j] = stau;
+            a[0] = alpha;
+        }
+        __syncthreads();
+
+        const T scal = sscal;
+        for(rocblas_int i = tid + 1; i < mm; i += MEGAKERNEL_THDS)
+        {
+            sv[i] *= scal;
+            a[i] = sv[i];
+        }
+        __syncthreads();
+
+        // apply Householder reflector (conjugated) to the rest of the matrix from the left
+        // (v(0) = 1 is implicit)
+        const T ctau = conj(stau);
+        for(rocblas_int c0 = j + 1; c0 < n; c0 += dimy)
+        {
+            const rocblas_int c = c0 + ty;
+            T* ac = A + j + c * ld;
+
+            sum = 0;
+            if(c < n)
+            {
+                for(rocblas_int i = tx; i < mm; i += dimx)
+                    sum += (i == 0 ? ac[0] : conj(sv[i]) * ac[i]);
+            }
+            sred[tid] = sum;
+            __syncthreads();
+
+            for(rocblas_int s = dimx / 2; s > 0; s /= 2)
+            {
+                if(tx < s)
+                    sred[tid] += sred[tid + s];
+                __syncthreads();
+            }
+
+            if(c < n)
+            {
+                const T w = ctau * sred[ty * dimx];
+                for(rocblas_int i = tx; i < mm; i += dimx)
+                    ac[i] -= (i == 0 ? w : sv[i] * w);
+            }
+            __syncthreads();
+        }
+    }
+}
+
+/*************************************************************
+    Launchers of specilized kernels
+*************************************************************/
+
+template <typename T, typename U>
+rocblas_status potrf_run_megakernel(rocblas_handle handle,
+                                    const rocblas_fill uplo,
+                                    const rocblas_int n,
+                                    U A,
+                                    const rocblas_stride shiftA,
+                                    const rocblas_int lda,
+                                    const rocblas_stride strideA,
+                                    rocblas_int* info,
+                                    const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER("potrf_megakernel", "uplo:", uplo, "n:", n, "shiftA:", shiftA, "lda:", lda,
+                    "bc:", batch_count);
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    ROCSOLVER_LAUNCH_KERNEL((potrf_megakernel<T, U>), dim3(1, 1, batch_count),
+                            dim3(MEGAKERNEL_DIM, MEGAKERNEL_DIM, 1), 0, stream, uplo, n, A, shiftA,
+                            lda, strideA, info);
+
+    return rocblas_status_success;
+}
+
+template <typename T, typename U>
+rocblas_status getrf_run_megakernel(rocblas_handle handle,
+                                    const rocblas_int m,
+                                    const rocblas_int n,
+                                    U A,
+                                    const rocblas_stride shiftA,
+                                    const rocblas_int lda,
+                                    const rocblas_stride strideA,
+                                    rocblas_int* ipiv,
+                                    const rocblas_stride shiftP,
+                                    const rocblas_stride strideP,
+                                    rocblas_int* info,
+                                    const rocblas_int batch_count,
+                                    const bool pivot)
+{
+    ROCSOLVER_ENTER("getrf_megakernel", "m:", m, "n:", n, "shiftA:", shiftA, "lda:", lda,
+                    "shiftP:", shiftP, "bc:", batch_count);
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    ROCSOLVER_LAUNCH_KERNEL((getrf_megakernel<T, U>), dim3(1, 1, batch_count),
+                            dim3(MEGAKERNEL_DIM, MEGAKERNEL_DIM, 1), 0, stream, m, n, A, shiftA,
+                            lda, strideA, ipiv, shiftP, strideP, info, pivot);
+
+    return rocblas_status_success;
+}
+
+template <typename T, typename U, typename V>
+rocblas_status geqrf_run_megakernel(rocblas_handle handle,
+                                    const rocblas_int m,
+                                    const rocblas_int n,
+                                    U A,
+                                    const rocblas_stride shiftA,
+                                    const rocblas_int lda,
+                                    const rocblas_stride strideA,
+                                    V ipiv,
+                                    const rocblas_stride strideP,
+                                    const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER("geqrf_megakernel", "m:", m, "n:", n, "shiftA:", shiftA, "lda:", lda,
+                    "bc:", batch_count);
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // use a full wavefront for the rows, as in GEQR2_KERNEL_SMALL
+    rocblas_int dimx = 64;
+    rocblas_int dimy = MEGAKERNEL_THDS / dimx;
+    ROCSOLVER_LAUNCH_KERNEL((geqrf_megakernel<T, U, V>), dim3(1, 1, batch_count),
+                            dim3(dimx, dimy, 1), 0, stream, m, n, A, shiftA, lda, strideA, ipiv,
+                            strideP);
+
+    return rocblas_status_success;
+}
+
+/*************************************************************
+    Instantiation macros
+*************************************************************/
+
+#define INSTANTIATE_POTRF_MEGAKERNEL(T, U)                                                    \
+    template rocblas_status potrf_run_megakernel<T, U>(                                       \
+        rocblas_handle handle, const rocblas_fill uplo, const rocblas_int n, U A,             \
+        const rocblas_stride shiftA, const rocblas_int lda, const rocblas_stride strideA,     \
+        rocblas_int* info, const rocblas_int batch_count)
+
+#define INSTANTIATE_GETRF_MEGAKERNEL(T, U)                                                    \
+    template rocblas_status getrf_run_megakernel<T, U>(                                       \
+        rocblas_handle handle, const rocblas_int m, const rocblas_int n, U A,                 \
+        const rocblas_stride shiftA, const rocblas_int lda, const rocblas_stride strideA,     \
+        rocblas_int* ipiv, const rocblas_stride shiftP, const rocblas_stride strideP,         \
+        rocblas_int* info, const rocblas_int batch_count, const bool pivot)
+
+#define INSTANTIATE_GEQRF_MEGAKERNEL(T, U, V)                                                 \
+    template rocblas_status geqrf_run_megakernel<T, U, V>(                                    \
+        rocblas_handle handle, const rocblas_int m, const rocblas_int n, U A,                 \
+        const rocblas_stride shiftA, const rocblas_int lda, const rocblas_stride strideA,     \
+        V ipiv, const rocblas_stride strideP, const rocblas_int batch_count)
+
+ROCSOLVER_END_NAMESPACE
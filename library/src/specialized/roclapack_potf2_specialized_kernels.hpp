@@ -36,6 +36,13 @@
 #include <algorithm>
 #include <cmath>
 
+#ifdef ROCSOLVER_JIT
+#include <string>
+#include <type_traits>
+
+#include "rocsolver_jit.hpp"
+#endif
+
 ROCSOLVER_BEGIN_NAMESPACE
 
 /**
@@ -86,10 +93,13 @@ __device__ static I idx_lower(I i, I j, I n)
  * ------------------------------------------------------
  * Perform Cholesky factorization for small n by n matrix.
  * The function executes in a single thread block.
+ * If info is zero, the first non-positive minor is
+ * reported in info shifted by offset.
  * ------------------------------------------------------
 **/
 template <typename T, typename I>
-__device__ static void potf2_simple(bool const is_upper, I const n, T* const A, I* const info)
+__device__ static void
+    potf2_simple(bool const is_upper, I const n, T* const A, I* const info, I const offset = 0)
 {
     auto const lda = n;
     bool const is_lower = (!is_upper);
@@ -136,7 +146,7 @@ __device__ static void potf2_simple(bool const is_upper, I const n, T* const A,
                     A[kk] = akk;
                     // Fortran 1-based index
                     if(*info == 0)
-                        *info = kcol + 1;
+                        *info = kcol + 1 + offset;
                 }
                 break;
             }
@@ -216,7 +226,7 @@ __device__ static void potf2_simple(bool const is_upper, I const n, T* const A,
                     A[kk] = akk;
                     // Fortran 1-based index
                     if(*info == 0)
-                        *info = kcol + 1;
+                        *info = kcol + 1 + offset;
                 }
 
                 break;
@@ -274,14 +284,15 @@ __device__ static void potf2_simple(bool const is_upper, I const n, T* const A,
     the library size.
 *************************************************************/
 
-template <typename T, typename U>
+template <typename T, typename I, typename U>
 ROCSOLVER_KERNEL void potf2_kernel_small(const bool is_upper,
-                                         const rocblas_int n,
+                                         const I n,
                                          U AA,
-                                         const rocblas_int shiftA,
-                                         const rocblas_int lda,
+                                         const rocblas_stride shiftA,
+                                         const I lda,
                                          const rocblas_stride strideA,
-                                         rocblas_int* const info)
+                                         I* const info,
+                                         const I offset)
 {
     bool const is_lower = (!is_upper);
 
@@ -299,7 +310,7 @@ ROCSOLVER_KERNEL void potf2_kernel_small(const bool is_upper,
     assert(info != nullptr);
 
     T* const A = load_ptr_batch(AA, bid, shiftA, strideA);
-    rocblas_int* const info_bid = info + bid;
+    I* const info_bid = info + bid;
 
     assert(A != nullptr);
 
@@ -322,9 +333,9 @@ ROCSOLVER_KERNEL void potf2_kernel_small(const bool is_upper,
 
     if(is_lower)
     {
-        for(rocblas_int j = j_start; j < n; j += j_inc)
+        for(I j = j_start; j < n; j += j_inc)
         {
-            for(rocblas_int i = j + i_start; i < n; i += i_inc)
+            for(I i = j + i_start; i < n; i += i_inc)
             {
                 auto const ij = i + j * static_cast<int64_t>(lda);
                 auto const ij_packed = idx_lower(i, j, n);
@@ -335,9 +346,9 @@ ROCSOLVER_KERNEL void potf2_kernel_small(const bool is_upper,
     }
     else
     {
-        for(rocblas_int j = j_start; j < n; j += j_inc)
+        for(I j = j_start; j < n; j += j_inc)
         {
-            for(rocblas_int i = i_start; i <= j; i += i_inc)
+            for(I i = i_start; i <= j; i += i_inc)
             {
                 auto const ij = i + j * static_cast<int64_t>(lda);
                 auto const ij_packed = (use_compute_lower) ? idx_lower(j, i, n) : idx_upper(i, j, n);
@@ -351,7 +362,7 @@ ROCSOLVER_KERNEL void potf2_kernel_small(const bool is_upper,
     __syncthreads();
 
     bool const is_up = (use_compute_lower) ? false : is_upper;
-    potf2_simple<T>(is_up, n, Ash, info_bid);
+    potf2_simple<T>(is_up, n, Ash, info_bid, offset);
 
     __syncthreads();
 
@@ -360,9 +371,9 @@ ROCSOLVER_KERNEL void potf2_kernel_small(const bool is_upper,
     // -------------------------------------
     if(is_lower)
     {
-        for(rocblas_int j = j_start; j < n; j += j_inc)
+        for(I j = j_start; j < n; j += j_inc)
         {
-            for(rocblas_int i = j + i_start; i < n; i += i_inc)
+            for(I i = j + i_start; i < n; i += i_inc)
             {
                 auto const ij = i + j * static_cast<int64_t>(lda);
                 auto const ij_packed = idx_lower(i, j, n);
@@ -373,9 +384,9 @@ ROCSOLVER_KERNEL void potf2_kernel_small(const bool is_upper,
     }
     else
     {
-        for(rocblas_int j = j_start; j < n; j += j_inc)
+        for(I j = j_start; j < n; j += j_inc)
         {
-            for(rocblas_int i = i_start; i <= j; i += i_inc)
+            for(I i = i_start; i <= j; i += i_inc)
             {
                 auto const ij = i + j * static_cast<int64_t>(lda);
                 auto const ij_packed = (use_compute_lower) ? idx_lower(j, i, n) : idx_upper(i, j, n);
@@ -389,32 +400,345 @@ ROCSOLVER_KERNEL void potf2_kernel_small(const bool is_upper,
     __syncthreads();
 }
 
+/** POSV_KERNEL_SMALL computes the Cholesky factorization of a small n by n matrix
+    in LDS, as potf2_kernel_small does, and then solves L*L' * X = B (or U'*U * X = B)
+    for blocks of nb columns of B without reading the factor back from global memory.
+    B is not modified if the matrix is not positive definite. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void posv_kernel_small(const bool is_upper,
+                                        const rocblas_int n,
+                                        const rocblas_int nrhs,
+                                        U AA,
+                                        const rocblas_int shiftA,
+                                        const rocblas_int lda,
+                                        const rocblas_stride strideA,
+                                        U BB,
+                                        const rocblas_int shiftB,
+                                        const rocblas_int ldb,
+                                        const rocblas_stride strideB,
+                                        rocblas_int* const info,
+                                        const rocblas_int nb)
+{
+    auto const i_start = hipThreadIdx_x;
+    auto const i_inc = hipBlockDim_x;
+    auto const j_start = hipThreadIdx_y;
+    auto const j_inc = hipBlockDim_y;
+
+    auto const bid = hipBlockIdx_z;
+    T* const A = load_ptr_batch(AA, bid, shiftA, strideA);
+    T* const B = load_ptr_batch(BB, bid, shiftB, strideB);
+    rocblas_int* const info_bid = info + bid;
+
+    // ---------------------------------------------------------
+    // the packed lower triangular factor is followed by an n by nb
+    // block of B in LDS
+    // ---------------------------------------------------------
+    extern __shared__ rocblas_int lsmem[];
+    T* Ash = reinterpret_cast<T*>(lsmem);
+    T* Bsh = Ash + (n * (n + 1)) / 2;
+
+    // the factorization is always computed in lower storage; if A is upper,
+    // L = U' and the solves are the same
+    for(rocblas_int j = j_start; j < n; j += j_inc)
+    {
+        for(rocblas_int i = j + i_start; i < n; i += i_inc)
+            Ash[idx_lower(i, j, n)] = is_upper ? conj(A[j + i * static_cast<int64_t>(lda)])
+                                               : A[i + j * static_cast<int64_t>(lda)];
+    }
+    __syncthreads();
+
+    potf2_simple<T>(false, n, Ash, info_bid);
+    __syncthreads();
+
+    // the factor is returned in A in any case
+    for(rocblas_int j = j_start; j < n; j += j_inc)
+    {
+        for(rocblas_int i = j + i_start; i < n; i += i_inc)
+        {
+            if(is_upper)
+                A[j + i * static_cast<int64_t>(lda)] = conj(Ash[idx_lower(i, j, n)]);
+            else
+                A[i + j * static_cast<int64_t>(lda)] = Ash[idx_lower(i, j, n)];
+        }
+    }
+
+    // info was written by thread 0 of this block; the check is uniform across the block
+    if(*info_bid != 0)
+        return;
+
+    for(rocblas_int jb = 0; jb < nrhs; jb += nb)
+    {
+        rocblas_int const jw = std::min(nb, nrhs - jb);
+
+        for(rocblas_int j = j_start; j < jw; j += j_inc)
+        {
+            for(rocblas_int i = i_start; i < n; i += i_inc)
+                Bsh[i + j * n] = B[i + (jb + j) * static_cast<int64_t>(ldb)];
+        }
+        __syncthreads();
+
+        // forward substitution with L
+        for(rocblas_int k = 0; k < n; k++)
+        {
+            auto const lkk = Ash[idx_lower(k, k, n)];
+            for(rocblas_int j = j_start; j < jw; j += j_inc)
+            {
+                auto const yk = Bsh[k + j * n] / lkk;
+                for(rocblas_int i = k + 1 + i_start; i < n; i += i_inc)
+                    Bsh[i + j * n] -= Ash[idx_lower(i, k, n)] * yk;
+            }
+            __syncthreads();
+
+            if(i_start == 0)
+            {
+                for(rocblas_int j = j_start; j < jw; j += j_inc)
+                    Bsh[k + j * n] = Bsh[k + j * n] / lkk;
+            }
+            __syncthreads();
+        }
+
+        // backward substitution with L'
+        for(rocblas_int k = n - 1; k >= 0; k--)
+        {
+            auto const lkk = conj(Ash[idx_lower(k, k, n)]);
+            for(rocblas_int j = j_start; j < jw; j += j_inc)
+            {
+                auto const xk = Bsh[k + j * n] / lkk;
+                for(rocblas_int i = i_start; i < k; i += i_inc)
+                    Bsh[i + j * n] -= conj(Ash[idx_lower(k, i, n)]) * xk;
+            }
+            __syncthreads();
+
+            if(i_start == 0)
+            {
+                for(rocblas_int j = j_start; j < jw; j += j_inc)
+                    Bsh[k + j * n] = Bsh[k + j * n] / lkk;
+            }
+            __syncthreads();
+        }
+
+        for(rocblas_int j = j_start; j < jw; j += j_inc)
+        {
+            for(rocblas_int i = i_start; i < n; i += i_inc)
+                B[i + (jb + j) * static_cast<int64_t>(ldb)] = Bsh[i + j * n];
+        }
+        __syncthreads();
+    }
+}
+
 /*************************************************************
     Launchers of specilized kernels
 *************************************************************/
 
-template <typename T, typename U>
+#ifdef ROCSOLVER_JIT
+/** POTF2_JIT_SOURCE is the source of the run-time compiled version of potf2_kernel_small
+    (see rocsolver_jit.hpp). It is compiled for a given type T, integer type I, storage
+    (BATCHED) and size N. Every thread keeps a row of the lower triangular factor in registers
+    (the upper triangular factor is factorized as its transpose), and the column of the current
+    step is shared through LDS. **/
+static const char potf2_jit_source[] = R"(
+#if BATCHED
+typedef T* const* ptr_t;
+#else
+typedef T* ptr_t;
+#endif
+
+extern "C" __global__ void __launch_bounds__(N) potf2_jit(const int is_upper,
+                                                          ptr_t AA,
+                                                          const long long shiftA,
+                                                          const I lda,
+                                                          const long long strideA,
+                                                          I* const info,
+                                                          const I offset)
+{
+    const int i = threadIdx.x;
+    const long long bid = blockIdx.x;
+#if BATCHED
+    T* const A = AA[bid] + shiftA;
+#else
+    T* const A = AA + shiftA + bid * strideA;
+#endif
+
+    __shared__ T diag;
+    __shared__ T col[N];
+
+    T a[N];
+#pragma unroll
+    for(int j = 0; j < N; ++j)
+        a[j] = (j > i) ? T(0) : is_upper ? A[j + i * (long long)lda] : A[i + j * (long long)lda];
+
+    int fail = 0;
+#pragma unroll
+    for(int k = 0; k < N; ++k)
+    {
+        if(i == k)
+            diag = a[k];
+        __syncthreads();
+
+        const T akk = diag;
+        if(!(akk > 0 && __builtin_isfinite(akk)))
+        {
+            fail = k + 1;
+            break;
+        }
+
+        const T lkk = sqrt(akk);
+        if(i == k)
+            a[k] = lkk;
+        else if(i > k)
+        {
+            a[k] = a[k] / lkk;
+            col[i] = a[k];
+        }
+        __syncthreads();
+
+        if(i > k)
+        {
+#pragma unroll
+            for(int j = k + 1; j < N; ++j)
+                if(j <= i)
+                    a[j] -= a[k] * col[j];
+        }
+    }
+
+    // Fortran 1-based index
+    if(fail && i == 0 && info[bid] == 0)
+        info[bid] = fail + offset;
+
+#pragma unroll
+    for(int j = 0; j < N; ++j)
+    {
+        if(j <= i)
+        {
+            if(is_upper)
+                A[j + i * (long long)lda] = a[j];
+            else
+                A[i + j * (long long)lda] = a[j];
+        }
+    }
+}
+)";
+
+/** POTF2_RUN_JIT launches the run-time compiled POTF2 kernel if it is available
+    for the given type and size, and returns false otherwise. **/
+template <typename T, typename I, typename U>
+bool potf2_run_jit(rocblas_handle handle,
+                   const rocblas_fill uplo,
+                   const I n,
+                   U A,
+                   const rocblas_stride shiftA,
+                   const I lda,
+                   const rocblas_stride strideA,
+                   I* info,
+                   const I batch_count,
+                   const I offset)
+{
+    if constexpr(rocblas_is_complex<T>)
+        return false;
+    else
+    {
+        if(n > POTF2_JIT_MAX_SIZE || !rocsolver_jit_enabled())
+            return false;
+
+        constexpr bool BATCHED = !std::is_same<U, T*>::value;
+        const char* tname = std::is_same<T, float>::value ? "float" : "double";
+        const char* iname = sizeof(I) == 4 ? "int" : "long long";
+        std::string key = std::string("potf2_") + (std::is_same<T, float>::value ? "s" : "d")
+            + (BATCHED ? "b" : "") + "_i" + std::to_string(8 * sizeof(I)) + "_n"
+            + std::to_string(n);
+        std::string source = "#define N " + std::to_string(n) + "\n#define BATCHED "
+            + (BATCHED ? "1" : "0") + "\ntypedef " + tname + " T;\ntypedef " + iname + " I;\n"
+            + potf2_jit_source;
+
+        hipFunction_t kernel = rocsolver_jit_kernel(key, "potf2_jit", source);
+        if(!kernel)
+            return false;
+
+        hipStream_t stream;
+        rocblas_get_stream(handle, &stream);
+
+        int is_upper = (uplo == rocblas_fill_upper);
+        U AA = A;
+        long long shift = shiftA, stride = strideA;
+        I ld = lda, off = offset;
+        I* iinfo = info;
+        void* args[] = {&is_upper, &AA, &shift, &ld, &stride, &iinfo, &off};
+
+        hipError_t status;
+        ROCSOLVER_LAUNCH_MODULE_KERNEL(status, "potf2_jit", kernel, batch_count, 1, 1, n, 1, 1, 0,
+                                       stream, args, nullptr);
+        return status == hipSuccess;
+    }
+}
+#endif
+
+template <typename T, typename I, typename U>
 rocblas_status potf2_run_small(rocblas_handle handle,
                                const rocblas_fill uplo,
-                               const rocblas_int n,
+                               const I n,
                                U A,
-                               const rocblas_int shiftA,
-                               const rocblas_int lda,
+                               const rocblas_stride shiftA,
+                               const I lda,
                                const rocblas_stride strideA,
-                               rocblas_int* info,
-                               const rocblas_int batch_count)
+                               I* info,
+                               const I batch_count,
+                               const I offset)
 {
     ROCSOLVER_ENTER("potf2_kernel_small", "uplo:", uplo, "n:", n, "shiftA:", shiftA, "lda:", lda,
                     "bc:", batch_count);
 
+#ifdef ROCSOLVER_JIT
+    if(potf2_run_jit<T>(handle, uplo, n, A, shiftA, lda, strideA, info, batch_count, offset))
+        return rocblas_status_success;
+#endif
+
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
     size_t lmemsize = sizeof(T) * (n * (n + 1)) / 2;
 
     bool const is_upper = (uplo == rocblas_fill_upper);
-    ROCSOLVER_LAUNCH_KERNEL((potf2_kernel_small<T, U>), dim3(1, 1, batch_count), dim3(BS2, BS2, 1),
-                            lmemsize, stream, is_upper, n, A, shiftA, lda, strideA, info);
+    ROCSOLVER_LAUNCH_KERNEL((potf2_kernel_small<T, I, U>), dim3(1, 1, batch_count),
+                            dim3(BS2, BS2, 1), lmemsize, stream, is_upper, n, A, shiftA, lda,
+                            strideA, info, offset);
+
+    return rocblas_status_success;
+}
+
+template <typename T, typename U>
+rocblas_status posv_run_small(rocblas_handle handle,
+                              const rocblas_fill uplo,
+                              const rocblas_int n,
+                              const rocblas_int nrhs,
+                              U A,
+                              const rocblas_int shiftA,
+                              const rocblas_int lda,
+                              const rocblas_stride strideA,
+                              U B,
+                              const rocblas_int shiftB,
+                              const rocblas_int ldb,
+                              const rocblas_stride strideB,
+                              rocblas_int* info,
+                              const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER("posv_kernel_small", "uplo:", uplo, "n:", n, "nrhs:", nrhs, "shiftA:", shiftA,
+                    "lda:", lda, "shiftB:", shiftB, "ldb:", ldb, "bc:", batch_count);
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // the block of B is as wide as the thread block, unless the LDS
+    // does not have room for it
+    size_t const lmemsizeA = sizeof(T) * (n * (n + 1)) / 2;
+    rocblas_int nb = std::min(nrhs, BS2);
+    while(nb > 1 && lmemsizeA + sizeof(T) * n * nb > 64 * 1024)
+        nb /= 2;
+    size_t lmemsize = lmemsizeA + sizeof(T) * n * nb;
+
+    bool const is_upper = (uplo == rocblas_fill_upper);
+    ROCSOLVER_LAUNCH_KERNEL((posv_kernel_small<T, U>), dim3(1, 1, batch_count), dim3(BS2, BS2, 1),
+                            lmemsize, stream, is_upper, n, nrhs, A, shiftA, lda, strideA, B,
+                            shiftB, ldb, strideB, info, nb);
 
     return rocblas_status_success;
 }
@@ -423,10 +747,17 @@ rocblas_status potf2_run_small(rocblas_handle handle,
     Instantiation macros
 *************************************************************/
 
-#define INSTANTIATE_POTF2_SMALL(T, U)                                                  \
-    template rocblas_status potf2_run_small<T, U>(                                     \
-        rocblas_handle handle, const rocblas_fill uplo, const rocblas_int n, U A,      \
-        const rocblas_int shiftA, const rocblas_int lda, const rocblas_stride strideA, \
-        rocblas_int* info, const rocblas_int batch_count)
+#define INSTANTIATE_POTF2_SMALL(T, I, U)                                                \
+    template rocblas_status potf2_run_small<T, I, U>(                                   \
+        rocblas_handle handle, const rocblas_fill uplo, const I n, U A,                 \
+        const rocblas_stride shiftA, const I lda, const rocblas_stride strideA, I* info, \
+        const I batch_count, const I offset)
+
+#define INSTANTIATE_POSV_SMALL(T, U)                                                        \
+    template rocblas_status posv_run_small<T, U>(                                           \
+        rocblas_handle handle, const rocblas_fill uplo, const rocblas_int n,                \
+        const rocblas_int nrhs, U A, const rocblas_int shiftA, const rocblas_int lda,       \
+        const rocblas_stride strideA, U B, const rocblas_int shiftB, const rocblas_int ldb, \
+        const rocblas_stride strideB, rocblas_int* info, const rocblas_int batch_count)
 
 ROCSOLVER_END_NAMESPACE
@@ -33,7 +33,16 @@ ROCSOLVER_BEGIN_NAMESPACE
     Instantiate template methods using macros
 *************************************************************/
 
-INSTANTIATE_POTF2_SMALL(rocblas_double_complex, rocblas_double_complex*);
-INSTANTIATE_POTF2_SMALL(rocblas_double_complex, rocblas_double_complex* const*);
+INSTANTIATE_POTF2_SMALL(rocblas_double_complex, rocblas_int, rocblas_double_complex*);
+INSTANTIATE_POTF2_SMALL(rocblas_double_complex, rocblas_int, rocblas_double_complex* const*);
+
+INSTANTIATE_POSV_SMALL(rocblas_double_complex, rocblas_double_complex*);
+INSTANTIATE_POSV_SMALL(rocblas_double_complex, rocblas_double_complex* const*);
+
+#ifdef HAVE_ROCBLAS_64
+// 64-bit APIs
+INSTANTIATE_POTF2_SMALL(rocblas_double_complex, int64_t, rocblas_double_complex*);
+INSTANTIATE_POTF2_SMALL(rocblas_double_complex, int64_t, rocblas_double_complex* const*);
+#endif /* HAVE_ROCBLAS_64 */
 
 ROCSOLVER_END_NAMESPACE
@@ -0,0 +1,259 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "roclapack_potf2_specialized_kernels.hpp"
+#include "rocsolver_run_specialized_kernels.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/*************************************************************
+    Templated kernels are instantiated in separate cpp
+    files in order to improve compilation times and reduce
+    the library size.
+*************************************************************/
+
+/** SYGS2_KERNEL_SMALL reduces a small Hermitian-definite (symmetric-definite) generalized
+    eigenproblem to standard form in a single launch. Each thread-block works with one problem of
+    the batch: the stored triangle of A and the Cholesky factor of B are kept in LDS as packed
+    lower-triangular matrices (the upper case is transformed with L = U' and the lower triangle
+    of A given by the conjugate of its upper triangle), and the column (itype = 1) or row
+    (itype = 2, 3) steps of the unblocked algorithm, i.e. the rank-2 updates and the triangular
+    solves or products, are computed without accessing global memory. Only the uplo triangle of
+    A is written back. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) sygs2_kernel_small(const rocblas_eform itype,
+                                                                const rocblas_fill uplo,
+                                                                const rocblas_int n,
+                                                                U AA,
+                                                                const rocblas_int shiftA,
+                                                                const rocblas_int lda,
+                                                                const rocblas_stride strideA,
+                                                                U BB,
+                                                                const rocblas_int shiftB,
+                                                                const rocblas_int ldb,
+                                                                const rocblas_stride strideB)
+{
+    using S = decltype(std::real(T{}));
+
+    const rocblas_int bid = hipBlockIdx_z;
+    const rocblas_int tid = hipThreadIdx_x;
+    const rocblas_int nthds = hipBlockDim_x;
+    const bool lower = (uplo == rocblas_fill_lower);
+
+    // select batch instance
+    T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+    T* B = load_ptr_batch<T>(BB, bid, shiftB, strideB);
+
+    // shared memory setup: the packed triangles of A and L, followed by the vector w
+    const rocblas_int np = n * (n + 1) / 2;
+    extern __shared__ rocblas_int lsmem[];
+    T* Ash = reinterpret_cast<T*>(lsmem);
+    T* Lsh = Ash + np;
+    T* w = Lsh + np;
+
+    // read the triangles into LDS
+    for(rocblas_int k = tid; k < n * n; k += nthds)
+    {
+        rocblas_int i = k % n;
+        rocblas_int j = k / n;
+        if(i < j)
+            continue;
+
+        rocblas_int p = idx_lower(i, j, n);
+        T a = lower ? A[i + j * static_cast<int64_t>(lda)]
+                    : conj(A[j + i * static_cast<int64_t>(lda)]);
+        T l = lower ? B[i + j * static_cast<int64_t>(ldb)]
+                    : conj(B[j + i * static_cast<int64_t>(ldb)]);
+        Ash[p] = (i == j) ? T(std::real(a)) : a;
+        Lsh[p] = l;
+    }
+    __syncthreads();
+
+    if(itype == rocblas_eform_ax)
+    {
+        // compute inv(L)*A*inv(L')
+        for(rocblas_int k = 0; k < n; ++k)
+        {
+            const rocblas_int kk = idx_lower(k, k, n);
+            const S bkk = std::real(Lsh[kk]);
+            const S akk = std::real(Ash[kk]) / (bkk * bkk);
+            const T rbkk = T(1 / bkk);
+            const T ct = T(-akk / 2);
+
+            // the column k below the diagonal is contiguous in the packed storage
+            T* a = Ash + kk - k;
+            T* b = Lsh + kk - k;
+
+            // a = a/bkk + ct*b
+            for(rocblas_int i = k + 1 + tid; i < n; i += nthds)
+                a[i] = a[i] * rbkk + ct * b[i];
+            __syncthreads();
+
+            if(tid == 0)
+                Ash[kk] = T(akk);
+
+            // A22 = A22 - a*b' - b*a'
+            const rocblas_int m = n - k - 1;
+            for(rocblas_int t = tid; t < m * m; t += nthds)
+            {
+                rocblas_int r = k + 1 + t % m;
+                rocblas_int c = k + 1 + t / m;
+                if(r >= c)
+                    Ash[idx_lower(r, c, n)] -= a[r] * conj(b[c]) + b[r] * conj(a[c]);
+            }
+            __syncthreads();
+
+            // a = a + ct*b
+            for(rocblas_int i = k + 1 + tid; i < n; i += nthds)
+                a[i] += ct * b[i];
+            __syncthreads();
+
+            // a = inv(L22)*a by forward substitution (the solution is gathered in w, so that
+            // only one synchronization is needed per element)
+            for(rocblas_int j = k + 1; j < n; ++j)
+            {
+                const T x = a[j] / Lsh[idx_lower(j, j, n)];
+                if(tid == 0)
+                    w[j] = x;
+                for(rocblas_int i = j + 1 + tid; i < n; i += nthds)
+                    a[i] -= Lsh[idx_lower(i, j, n)] * x;
+                __syncthreads();
+            }
+
+            for(rocblas_int i = k + 1 + tid; i < n; i += nthds)
+                a[i] = w[i];
+            __syncthreads();
+        }
+    }
+    else
+    {
+        // compute L'*A*L
+        for(rocblas_int k = 0; k < n; ++k)
+        {
+            const rocblas_int kk = idx_lower(k, k, n);
+            const S bkk = std::real(Lsh[kk]);
+            const S akk = std::real(Ash[kk]);
+            const T ct = T(akk / 2);
+
+            // w = L(0:k-1,0:k-1)'*a + ct*b, with a = conj(A(k,0:k-1)) and b = conj(L(k,0:k-1))
+            for(rocblas_int i = tid; i < k; i += nthds)
+            {
+                T sum = 0;
+                for(rocblas_int j = i; j < k; ++j)
+                    sum += conj(Lsh[idx_lower(j, i, n)]) * conj(Ash[idx_lower(k, j, n)]);
+                w[i] = sum + ct * conj(Lsh[idx_lower(k, i, n)]);
+            }
+            __syncthreads();
+
+            // A(0:k-1,0:k-1) = A(0:k-1,0:k-1) + w*b' + b*w'
+            for(rocblas_int t = tid; t < k * k; t += nthds)
+            {
+                rocblas_int r = t % k;
+                rocblas_int c = t / k;
+                if(r >= c)
+                    Ash[idx_lower(r, c, n)] += w[r] * Lsh[idx_lower(k, c, n)]
+                        + conj(Lsh[idx_lower(k, r, n)]) * conj(w[c]);
+            }
+
+            // A(k,0:k-1) = conj(bkk*(w + ct*b))
+            for(rocblas_int i = tid; i < k; i += nthds)
+            {
+                T x = w[i] + ct * conj(Lsh[idx_lower(k, i, n)]);
+                Ash[idx_lower(k, i, n)] = conj(T(bkk) * x);
+            }
+
+            if(tid == 0)
+                Ash[kk] = T(akk * bkk * bkk);
+            __syncthreads();
+        }
+    }
+
+    // write the results to global memory
+    for(rocblas_int k = tid; k < n * n; k += nthds)
+    {
+        rocblas_int i = k % n;
+        rocblas_int j = k / n;
+        if(i < j)
+            continue;
+
+        T a = Ash[idx_lower(i, j, n)];
+        if(lower)
+            A[i + j * static_cast<int64_t>(lda)] = a;
+        else
+            A[j + i * static_cast<int64_t>(lda)] = conj(a);
+    }
+}
+
+/*************************************************************
+    Launchers of specilized kernels
+*************************************************************/
+
+template <typename T, typename U>
+rocblas_status sygs2_run_small(rocblas_handle handle,
+                               const rocblas_eform itype,
+                               const rocblas_fill uplo,
+                               const rocblas_int n,
+                               U A,
+                               const rocblas_int shiftA,
+                               const rocblas_int lda,
+                               const rocblas_stride strideA,
+                               U B,
+                               const rocblas_int shiftB,
+                               const rocblas_int ldb,
+                               const rocblas_stride strideB,
+                               const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER("sygs2_kernel_small", "itype:", itype, "uplo:", uplo, "n:", n,
+                    "shiftA:", shiftA, "lda:", lda, "shiftB:", shiftB, "ldb:", ldb,
+                    "bc:", batch_count);
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    size_t lmemsize = sizeof(T) * (size_t(n) * (n + 1) + n);
+
+    ROCSOLVER_LAUNCH_KERNEL((sygs2_kernel_small<T, U>), dim3(1, 1, batch_count), dim3(BS1, 1, 1),
+                            lmemsize, stream, itype, uplo, n, A, shiftA, lda, strideA, B, shiftB,
+                            ldb, strideB);
+
+    return rocblas_status_success;
+}
+
+/*************************************************************
+    Instantiation macros
+*************************************************************/
+
+#define INSTANTIATE_SYGS2_SMALL(T, U)                                                            \
+    template rocblas_status sygs2_run_small<T, U>(                                               \
+        rocblas_handle handle, const rocblas_eform itype, const rocblas_fill uplo,               \
+        const rocblas_int n, U A, const rocblas_int shiftA, const rocblas_int lda,               \
+        const rocblas_stride strideA, U B, const rocblas_int shiftB, const rocblas_int ldb,      \
+        const rocblas_stride strideB, const rocblas_int batch_count)
+
+ROCSOLVER_END_NAMESPACE
@@ -0,0 +1,247 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "roclapack_geqr2_specialized_kernels.hpp"
+#include "rocsolver_run_specialized_kernels.hpp"
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+/*************************************************************
+    Templated kernels are instantiated in separate cpp
+    files in order to improve compilation times and reduce
+    the library size.
+*************************************************************/
+
+/** SYTD2_KERNEL_SMALL reduces a small n-by-n Hermitian (symmetric) matrix to tridiagonal form in
+    a single launch. Each thread-block works with one matrix of the batch, which is kept entirely
+    in LDS as a full matrix (built from the stored uplo triangle), so that the products with the
+    trailing matrix and the rank-2 updates of every column are computed without accessing global
+    memory. Only the uplo triangle is written back. (the number of threads must be a power of
+    2) **/
+template <typename T, typename S, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) sytd2_kernel_small(const rocblas_fill uplo,
+                                                                const rocblas_int n,
+                                                                U AA,
+                                                                const rocblas_int shiftA,
+                                                                const rocblas_int lda,
+                                                                const rocblas_stride strideA,
+                                                                S* DD,
+                                                                const rocblas_stride strideD,
+                                                                S* EE,
+                                                                const rocblas_stride strideE,
+                                                                T* tauA,
+                                                                const rocblas_stride strideP)
+{
+    const rocblas_int bid = hipBlockIdx_z;
+    const rocblas_int tid = hipThreadIdx_x;
+    const rocblas_int nthds = hipBlockDim_x;
+    const bool lower = (uplo == rocblas_fill_lower);
+
+    // select batch instance
+    T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+    S* D = DD + bid * strideD;
+    S* E = EE + bid * strideE;
+    T* tau = tauA + bid * strideP;
+
+    // shared memory setup: the n-by-n matrix (with leading dimension n), followed by the
+    // vector w and the workspace for the reductions
+    extern __shared__ rocblas_int lsmem[];
+    T* Ash = reinterpret_cast<T*>(lsmem);
+    T* w = Ash + n * n;
+    T* sred = w + n;
+    __shared__ T stau, sscal, salpha;
+
+    // read matrix into LDS
+    for(rocblas_int k = tid; k < n * n; k += nthds)
+    {
+        rocblas_int i = k % n;
+        rocblas_int j = k / n;
+        if(i == j)
+            Ash[k] = T(std::real(A[i + j * static_cast<int64_t>(lda)]));
+        else if((i > j) == lower)
+            Ash[k] = A[i + j * static_cast<int64_t>(lda)];
+        else
+            Ash[k] = conj(A[j + i * static_cast<int64_t>(lda)]);
+    }
+    __syncthreads();
+
+    for(rocblas_int jj = 0; jj < n - 1; ++jj)
+    {
+        // the reflector annihilates A(j+2:n-1,j) (lower case) or A(0:j-2,j) (upper case)
+        const rocblas_int j = lower ? jj : n - 1 - jj;
+        const rocblas_int lo = lower ? j + 1 : 0;
+        const rocblas_int mm = n - 1 - jj;
+        const rocblas_int ia = lower ? j + 1 : j - 1;
+        const rocblas_int ie = lower ? j : j - 1;
+        T* v = Ash + j * n;
+
+        // 1. generate Householder reflector
+        T sum = 0;
+        for(rocblas_int i = lo + tid; i < lo + mm; i += nthds)
+            sum += (i == ia ? T(0) : v[i] * conj(v[i]));
+        sred[tid] = sum;
+        __syncthreads();
+
+        for(rocblas_int s = nthds / 2; s > 0; s /= 2)
+        {
+            if(tid < s)
+                sred[tid] += sred[tid + s];
+            __syncthreads();
+        }
+
+        if(tid == 0)
+        {
+            T alpha = v[ia];
+            geqr2_set_taubeta(alpha, sred[0], stau, sscal);
+            E[ie] = std::real(alpha);
+            tau[ie] = stau;
+            v[ia] = 1;
+        }
+        __syncthreads();
+
+        const T scal = sscal;
+        for(rocblas_int i = lo + tid; i < lo + mm; i += nthds)
+        {
+            if(i != ia)
+                v[i] *= scal;
+        }
+        __syncthreads();
+
+        // 2. compute w = tau*A*v - 1/2*tau*(tau*v'*A*v)*v
+        const T t = stau;
+        for(rocblas_int i = lo + tid; i < lo + mm; i += nthds)
+        {
+            sum = 0;
+            for(rocblas_int k = lo; k < lo + mm; k++)
+                sum += Ash[i + k * n] * v[k];
+            w[i] = t * sum;
+        }
+        __syncthreads();
+
+        sum = 0;
+        for(rocblas_int i = lo + tid; i < lo + mm; i += nthds)
+            sum += conj(w[i]) * v[i];
+        sred[tid] = sum;
+        __syncthreads();
+
+        for(rocblas_int s = nthds / 2; s > 0; s /= 2)
+        {
+            if(tid < s)
+                sred[tid] += sred[tid + s];
+            __syncthreads();
+        }
+
+        if(tid == 0)
+            salpha = -0.5 * t * sred[0];
+        __syncthreads();
+
+        const T alpha = salpha;
+        for(rocblas_int i = lo + tid; i < lo + mm; i += nthds)
+            w[i] += alpha * v[i];
+        __syncthreads();
+
+        // 3. apply the Householder reflector to A as a rank-2 update:
+        // A = A - v*w' - w*v'
+        for(rocblas_int k = tid; k < mm * mm; k += nthds)
+        {
+            rocblas_int r = lo + k % mm;
+            rocblas_int c = lo + k / mm;
+            Ash[r + c * n] -= v[r] * conj(w[c]) + w[r] * conj(v[c]);
+        }
+        __syncthreads();
+
+        // 4. restore the off-diagonal element
+        if(tid == 0)
+            v[ia] = T(E[ie]);
+        __syncthreads();
+    }
+
+    // write results to global memory, and set the diagonal in D
+    for(rocblas_int k = tid; k < n * n; k += nthds)
+    {
+        rocblas_int i = k % n;
+        rocblas_int j = k / n;
+        if(i == j)
+        {
+            S d = std::real(Ash[k]);
+            D[i] = d;
+            A[i + j * static_cast<int64_t>(lda)] = T(d);
+        }
+        else if((i > j) == lower)
+            A[i + j * static_cast<int64_t>(lda)] = Ash[k];
+    }
+}
+
+/*************************************************************
+    Launchers of specilized kernels
+*************************************************************/
+
+template <typename T, typename S, typename U>
+rocblas_status sytd2_run_small(rocblas_handle handle,
+                               const rocblas_fill uplo,
+                               const rocblas_int n,
+                               U A,
+                               const rocblas_int shiftA,
+                               const rocblas_int lda,
+                               const rocblas_stride strideA,
+                               S* D,
+                               const rocblas_stride strideD,
+                               S* E,
+                               const rocblas_stride strideE,
+                               T* tau,
+                               const rocblas_stride strideP,
+                               const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER("sytd2_kernel_small", "uplo:", uplo, "n:", n, "shiftA:", shiftA, "lda:", lda,
+                    "bc:", batch_count);
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    size_t lmemsize = sizeof(T) * (size_t(n) * n + n + BS1);
+
+    ROCSOLVER_LAUNCH_KERNEL((sytd2_kernel_small<T, S, U>), dim3(1, 1, batch_count),
+                            dim3(BS1, 1, 1), lmemsize, stream, uplo, n, A, shiftA, lda, strideA,
+                            D, strideD, E, strideE, tau, strideP);
+
+    return rocblas_status_success;
+}
+
+/*************************************************************
+    Instantiation macros
+*************************************************************/
+
+#define INSTANTIATE_SYTD2_SMALL(T, S, U)                                                      \
+    template rocblas_status sytd2_run_small<T, S, U>(                                         \
+        rocblas_handle handle, const rocblas_fill uplo, const rocblas_int n, U A,             \
+        const rocblas_int shiftA, const rocblas_int lda, const rocblas_stride strideA, S* D,  \
+        const rocblas_stride strideD, S* E, const rocblas_stride strideE, T* tau,             \
+        const rocblas_stride strideP, const rocblas_int batch_count)
+
+ROCSOLVER_END_NAMESPACE
@@ -1,5 +1,5 @@
 /* **************************************************************************
- * Copyright (C) 2019-2024 Advanced Micro Devices, Inc. All rights reserved.
+ * Copyright (C) 2019-2025 Advanced Micro Devices, Inc. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions
@@ -28,6 +28,7 @@
 #pragma once
 
 #include "rocsolver_run_specialized_kernels.hpp"
+#include "rocsolver_tuning.hpp"
 
 ROCSOLVER_BEGIN_NAMESPACE
 
@@ -238,6 +239,9 @@ ROCSOLVER_KERNEL void unit_forward_substitution_kernel(const I nx,
         // move results back to global
         B[idb] = c;
     }
+
+    // make results visible to the kernels that update the remaining right/left-hand-sides
+    __threadfence();
 }
 
 template <typename T, typename I, typename U>
@@ -290,6 +294,9 @@ ROCSOLVER_KERNEL void conj_unit_forward_substitution_kernel(const I nx,
         // move results back to global
         B[idb] = c;
     }
+
+    // make results visible to the kernels that update the remaining right/left-hand-sides
+    __threadfence();
 }
 
 template <typename T, typename I, typename U>
@@ -347,6 +354,9 @@ ROCSOLVER_KERNEL void nonunit_forward_substitution_kernel(const I nx,
         // move results back to global
         B[idb] = c;
     }
+
+    // make results visible to the kernels that update the remaining right/left-hand-sides
+    __threadfence();
 }
 
 template <typename T, typename I, typename U>
@@ -404,6 +414,9 @@ ROCSOLVER_KERNEL void conj_nonunit_forward_substitution_kernel(const I nx,
         // move results back to global
         B[idb] = c;
     }
+
+    // make results visible to the kernels that update the remaining right/left-hand-sides
+    __threadfence();
 }
 
 // **************** backward substitution kernels ************************//
@@ -479,6 +492,9 @@ ROCSOLVER_KERNEL void unit_backward_substitution_kernel(const I nx,
         // move results back to global
         B[idb] = c;
     }
+
+    // make results visible to the kernels that update the remaining right/left-hand-sides
+    __threadfence();
 }
 
 template <typename T, typename I, typename U>
@@ -531,6 +547,9 @@ ROCSOLVER_KERNEL void conj_unit_backward_substitution_kernel(const I nx,
         // move results back to global
         B[idb] = c;
     }
+
+    // make results visible to the kernels that update the remaining right/left-hand-sides
+    __threadfence();
 }
 
 template <typename T, typename I, typename U>
@@ -588,6 +607,9 @@ ROCSOLVER_KERNEL void nonunit_backward_substitution_kernel(const I nx,
         // move results back to global
         B[idb] = c;
     }
+
+    // make results visible to the kernels that update the remaining right/left-hand-sides
+    __threadfence();
 }
 
 template <typename T, typename I, typename U>
@@ -645,6 +667,53 @@ ROCSOLVER_KERNEL void conj_nonunit_backward_substitution_kernel(const I nx,
         // move results back to global
         B[idb] = c;
     }
+
+    // make results visible to the kernels that update the remaining right/left-hand-sides
+    __threadfence();
+}
+
+/** TRSM_COPY_DIAG_BLOCKS copies the diagonal blocks of size blk of the triangular
+    matrix A into the workspace W, one block after the other. The opposite triangle
+    of every block is set to zero (and the diagonal to one if A is unit triangular), and
+    the last block is completed with the identity, so that the inverted blocks can be
+    applied with GEMM.
+
+    Call this kernel with one group in x per diagonal block and 'batch_count' groups
+    in z. **/
+template <typename T, typename I, typename U>
+ROCSOLVER_KERNEL void trsm_copy_diag_blocks(const rocblas_fill uplo,
+                                            const rocblas_diagonal diag,
+                                            const I m,
+                                            const I blk,
+                                            U AA,
+                                            const rocblas_stride shiftA,
+                                            const I lda,
+                                            const rocblas_stride strideA,
+                                            T* W)
+{
+    const I k = hipBlockIdx_x;
+    const I b = hipBlockIdx_z;
+    const I j0 = k * blk;
+    const I jb = std::min(blk, m - j0);
+    const bool upper = (uplo == rocblas_fill_upper);
+    const bool unit = (diag == rocblas_diagonal_unit);
+
+    // batch instance
+    T* A = load_ptr_batch<T>(AA, b, shiftA + idx2D(j0, j0, lda), strideA);
+    T* Wk = W + (rocblas_stride(b) * hipGridDim_x + k) * blk * blk;
+
+    for(I j = hipThreadIdx_y; j < blk; j += hipBlockDim_y)
+    {
+        for(I i = hipThreadIdx_x; i < blk; i += hipBlockDim_x)
+        {
+            T v = 0;
+            if(i == j)
+                v = (unit || i >= jb) ? T(1) : A[i + j * lda];
+            else if(i < jb && j < jb && (upper ? i < j : i > j))
+                v = A[i + j * lda];
+            Wk[i + j * blk] = v;
+        }
+    }
 }
 
 /*************************************************************
@@ -665,7 +734,8 @@ I rocsolver_trsm_blksize(const I m, const I n)
         I intervalsM[] = {TRSM_BATCH_INTERVALSROW_REAL};
         I intervalsN[] = {TRSM_BATCH_INTERVALSCOL_REAL};
         I size[][TRSM_BATCH_NUMCOLS_REAL] = {TRSM_BATCH_BLKSIZES_REAL};
-        blk = size[get_index(intervalsM, M, m)][get_index(intervalsN, N, n)];
+        blk = get_tuned_blksize("trsm_batch_real", &size[0][0], I(TRSM_BATCH_NUMCOLS_REAL),
+                                intervalsM, M, intervalsN, N, m, n);
     }
     else
     {
@@ -674,7 +744,8 @@ I rocsolver_trsm_blksize(const I m, const I n)
         I intervalsM[] = {TRSM_INTERVALSROW_REAL};
         I intervalsN[] = {TRSM_INTERVALSCOL_REAL};
         I size[][TRSM_NUMCOLS_REAL] = {TRSM_BLKSIZES_REAL};
-        blk = size[get_index(intervalsM, M, m)][get_index(intervalsN, N, n)];
+        blk = get_tuned_blksize("trsm_real", &size[0][0], I(TRSM_NUMCOLS_REAL), intervalsM, M,
+                                intervalsN, N, m, n);
     }
 
     if(blk == 1)
@@ -696,7 +767,8 @@ I rocsolver_trsm_blksize(const I m, const I n)
         I intervalsM[] = {TRSM_BATCH_INTERVALSROW_COMPLEX};
         I intervalsN[] = {TRSM_BATCH_INTERVALSCOL_COMPLEX};
         I size[][TRSM_BATCH_NUMCOLS_COMPLEX] = {TRSM_BATCH_BLKSIZES_COMPLEX};
-        blk = size[get_index(intervalsM, M, m)][get_index(intervalsN, N, n)];
+        blk = get_tuned_blksize("trsm_batch_complex", &size[0][0], I(TRSM_BATCH_NUMCOLS_COMPLEX),
+                                intervalsM, M, intervalsN, N, m, n);
     }
     else
     {
@@ -705,7 +777,8 @@ I rocsolver_trsm_blksize(const I m, const I n)
         I intervalsM[] = {TRSM_INTERVALSROW_COMPLEX};
         I intervalsN[] = {TRSM_INTERVALSCOL_COMPLEX};
         I size[][TRSM_NUMCOLS_COMPLEX] = {TRSM_BLKSIZES_COMPLEX};
-        blk = size[get_index(intervalsM, M, m)][get_index(intervalsN, N, n)];
+        blk = get_tuned_blksize("trsm_complex", &size[0][0], I(TRSM_NUMCOLS_COMPLEX), intervalsM, M,
+                                intervalsN, N, m, n);
     }
 
     if(blk == 1)
@@ -732,6 +805,13 @@ rocblas_status rocsolver_trsm_mem(const rocblas_side side,
                                   const I inca,
                                   const I incb)
 {
+    // matrices stored by rows are solved as the transposed problem (see rocsolver_trsm_lower)
+    if((inca != 1 || incb != 1) && lda == 1 && ldb == 1)
+        return rocsolver_trsm_mem<BATCHED, STRIDED, T>(
+            side == rocblas_side_left ? rocblas_side_right : rocblas_side_left, trans, n, m,
+            batch_count, size_work1, size_work2, size_work3, size_work4, optim_mem, inblocked,
+            inca, incb, I(1), I(1));
+
     // always allocate all required memory for TRSM optimal performance
     *optim_mem = true;
 
@@ -818,6 +898,15 @@ rocblas_status rocsolver_trsm_lower(rocblas_handle handle,
                     "shiftA:", shiftA, "lda:", lda, "shiftB:", shiftB, "ldb:", ldb,
                     "bc:", batch_count);
 
+    // if the matrices are stored by rows (ld = 1), op(A)*X = B is the same as X'*op(A') = B'
+    // with the column-major matrices A' (upper triangular) and B', which can be solved at full
+    // speed (the substitution kernels and GEMM updates with non-unit increments are slower)
+    if((inca != 1 || incb != 1) && lda == 1 && ldb == 1)
+        return rocsolver_trsm_upper<BATCHED, STRIDED, T>(
+            handle, side == rocblas_side_left ? rocblas_side_right : rocblas_side_left, trans, diag,
+            n, m, A, shiftA, I(1), inca, strideA, B, shiftB, I(1), incb, strideB, batch_count,
+            optim_mem, work1, work2, work3, work4);
+
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
     static constexpr bool ISBATCHED = BATCHED || STRIDED;
@@ -851,16 +940,6 @@ rocblas_status rocsolver_trsm_lower(rocblas_handle handle,
                                 optim_mem, work1, work2, work3, work4);
     }
 
-    // TODO: Some architectures require synchronization between rocSOLVER and rocBLAS kernels; more investigation needed
-    int device;
-    HIP_CHECK(hipGetDevice(&device));
-    hipDeviceProp_t deviceProperties;
-    HIP_CHECK(hipGetDeviceProperties(&deviceProperties, device));
-    std::string deviceFullString(deviceProperties.gcnArchName);
-    std::string deviceString = deviceFullString.substr(0, deviceFullString.find(":"));
-    bool do_sync = (deviceString.find("gfx940") != std::string::npos
-                    || deviceString.find("gfx941") != std::string::npos);
-
     // ****** MAIN LOOP ***********
     if(isleft)
     {
@@ -890,9 +969,6 @@ rocblas_status rocsolver_trsm_lower(rocblas_handle handle,
                 offB = idx2D(j, 0, incb, ldb);
                 FORWARD_SUBSTITUTIONS;
 
-                if(do_sync)
-                    HIP_CHECK(hipStreamSynchronize(stream));
-
                 // update right hand sides
                 ROCBLAS_CHECK(rocsolver_gemm<BATCHED, STRIDED, T>(
                     handle, rocblas_operation_none, rocblas_operation_none, m - nextpiv, n, blk,
@@ -934,9 +1010,6 @@ rocblas_status rocsolver_trsm_lower(rocblas_handle handle,
                 offB = idx2D(m - nextpiv, 0, incb, ldb);
                 BACKWARD_SUBSTITUTIONS;
 
-                if(do_sync)
-                    HIP_CHECK(hipStreamSynchronize(stream));
-
                 // update right hand sides
                 ROCBLAS_CHECK(rocsolver_gemm<BATCHED, STRIDED, T>(
                     handle, trans, rocblas_operation_none, m - nextpiv, n, blk, &minone, A,
@@ -990,9 +1063,6 @@ rocblas_status rocsolver_trsm_lower(rocblas_handle handle,
                 offB = idx2D(0, n - nextpiv, incb, ldb);
                 BACKWARD_SUBSTITUTIONS;
 
-                if(do_sync)
-                    HIP_CHECK(hipStreamSynchronize(stream));
-
                 // update left hand sides
                 ROCBLAS_CHECK(rocsolver_gemm<BATCHED, STRIDED, T>(
                     handle, rocblas_operation_none, rocblas_operation_none, m, n - nextpiv, blk,
@@ -1033,9 +1103,6 @@ rocblas_status rocsolver_trsm_lower(rocblas_handle handle,
                 offB = idx2D(0, j, incb, ldb);
                 FORWARD_SUBSTITUTIONS;
 
-                if(do_sync)
-                    HIP_CHECK(hipStreamSynchronize(stream));
-
                 // update left hand sides
                 ROCBLAS_CHECK(rocsolver_gemm<BATCHED, STRIDED, T>(
                     handle, rocblas_operation_none, trans, m, n - nextpiv, blk, &minone, B,
@@ -1101,6 +1168,14 @@ rocblas_status rocsolver_trsm_upper(rocblas_handle handle,
                     "shiftA:", shiftA, "lda:", lda, "shiftB:", shiftB, "ldb:", ldb,
                     "bc:", batch_count);
 
+    // if the matrices are stored by rows (ld = 1), solve the transposed problem with the
+    // column-major matrices A' (lower triangular) and B' (see rocsolver_trsm_lower)
+    if((inca != 1 || incb != 1) && lda == 1 && ldb == 1)
+        return rocsolver_trsm_lower<BATCHED, STRIDED, T>(
+            handle, side == rocblas_side_left ? rocblas_side_right : rocblas_side_left, trans, diag,
+            n, m, A, shiftA, I(1), inca, strideA, B, shiftB, I(1), incb, strideB, batch_count,
+            optim_mem, work1, work2, work3, work4);
+
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
     static constexpr bool ISBATCHED = BATCHED || STRIDED;
@@ -1134,16 +1209,6 @@ rocblas_status rocsolver_trsm_upper(rocblas_handle handle,
                                 optim_mem, work1, work2, work3, work4);
     }
 
-    // TODO: Some architectures require synchronization between rocSOLVER and rocBLAS kernels; more investigation needed
-    int device;
-    HIP_CHECK(hipGetDevice(&device));
-    hipDeviceProp_t deviceProperties;
-    HIP_CHECK(hipGetDeviceProperties(&deviceProperties, device));
-    std::string deviceFullString(deviceProperties.gcnArchName);
-    std::string deviceString = deviceFullString.substr(0, deviceFullString.find(":"));
-    bool do_sync = (deviceString.find("gfx940") != std::string::npos
-                    || deviceString.find("gfx941") != std::string::npos);
-
     // ****** MAIN LOOP ***********
     if(isleft)
     {
@@ -1173,9 +1238,6 @@ rocblas_status rocsolver_trsm_upper(rocblas_handle handle,
                 offB = idx2D(j, 0, incb, ldb);
                 FORWARD_SUBSTITUTIONS;
 
-                if(do_sync)
-                    HIP_CHECK(hipStreamSynchronize(stream));
-
                 // update right hand sides
                 ROCBLAS_CHECK(rocsolver_gemm<BATCHED, STRIDED, T>(
                     handle, trans, rocblas_operation_none, m - nextpiv, n, blk, &minone, A,
@@ -1217,9 +1279,6 @@ rocblas_status rocsolver_trsm_upper(rocblas_handle handle,
                 offB = idx2D(m - nextpiv, 0, incb, ldb);
                 BACKWARD_SUBSTITUTIONS;
 
-                if(do_sync)
-                    HIP_CHECK(hipStreamSynchronize(stream));
-
                 // update right hand sides
                 ROCBLAS_CHECK(rocsolver_gemm<BATCHED, STRIDED, T>(
                     handle, rocblas_operation_none, rocblas_operation_none, m - nextpiv, n, blk,
@@ -1273,9 +1332,6 @@ rocblas_status rocsolver_trsm_upper(rocblas_handle handle,
                 offB = idx2D(0, n - nextpiv, incb, ldb);
                 BACKWARD_SUBSTITUTIONS;
 
-                if(do_sync)
-                    HIP_CHECK(hipStreamSynchronize(stream));
-
                 // update left hand sides
                 ROCBLAS_CHECK(rocsolver_gemm<BATCHED, STRIDED, T>(
                     handle, rocblas_operation_none, trans, m, n - nextpiv, blk, &minone, B,
@@ -1316,9 +1372,6 @@ rocblas_status rocsolver_trsm_upper(rocblas_handle handle,
                 offB = idx2D(0, j, incb, ldb);
                 FORWARD_SUBSTITUTIONS;
 
-                if(do_sync)
-                    HIP_CHECK(hipStreamSynchronize(stream));
-
                 // update left hand sides
                 ROCBLAS_CHECK(rocsolver_gemm<BATCHED, STRIDED, T>(
                     handle, rocblas_operation_none, rocblas_operation_none, m, n - nextpiv, blk,
@@ -1406,6 +1459,191 @@ inline rocblas_status rocsolver_trsm_upper(rocblas_handle handle,
         batch_count, optim_mem, work1, work2, work3, work4);
 }
 
+/** This function returns the size of the diagonal blocks that are explicitly inverted
+    by the internal trsm with many right-hand sides (0 if the substitution kernels
+    should be used instead) **/
+template <bool ISBATCHED, typename T, typename I>
+I rocsolver_trsm_invdiag_blksize(const I m, const I n, const I inca, const I incb)
+{
+#ifdef OPTIMAL
+    // (the sizes for which rocBLAS TRSM is called already use inverted diagonal blocks)
+    if(inca == 1 && incb == 1 && m > TRSM_INVDIAG_MIN_SIZE && n >= m
+       && rocsolver_trsm_blksize<ISBATCHED, T, I>(m, n) > 0)
+        return TRTRI_MAX_COLS;
+#endif
+
+    return 0;
+}
+
+/** This function determine workspace size for the internal trsm with many right-hand sides **/
+template <bool BATCHED, bool STRIDED, typename T, typename I>
+rocblas_status rocsolver_trsm_left_invdiag_mem(const rocblas_operation trans,
+                                               const I m,
+                                               const I n,
+                                               const I batch_count,
+                                               size_t* size_work1,
+                                               size_t* size_work2,
+                                               size_t* size_work3,
+                                               size_t* size_work4,
+                                               bool* optim_mem,
+                                               const I lda,
+                                               const I ldb,
+                                               const I inca,
+                                               const I incb)
+{
+    static constexpr bool ISBATCHED = BATCHED || STRIDED;
+    const I blk = rocsolver_trsm_invdiag_blksize<ISBATCHED, T>(m, n, inca, incb);
+
+    if(blk == 0)
+        return rocsolver_trsm_mem<BATCHED, STRIDED, T>(rocblas_side_left, trans, m, n, batch_count,
+                                                       size_work1, size_work2, size_work3,
+                                                       size_work4, optim_mem, false, lda, ldb,
+                                                       inca, incb);
+
+    const I nblocks = (m - 1) / blk + 1;
+    *optim_mem = true;
+
+    // size of the inverted diagonal blocks
+    *size_work1 = sizeof(T) * blk * blk * nblocks * batch_count;
+
+    // size of the solved block row
+    *size_work2 = sizeof(T) * blk * n * batch_count;
+
+    // size of the arrays of pointers to the workspace (batched cases)
+    *size_work3 = BATCHED ? 2 * sizeof(T*) * batch_count : 0;
+    *size_work4 = 0;
+
+    return rocblas_status_success;
+}
+
+/** Internal TRSM (left side, many right-hand sides):
+    Solves the system op(A)X = B with A lower or upper triangular, overwriting B with X.
+
+    When there are at least as many right-hand sides as rows (see rocsolver_trsm_invdiag_blksize),
+    the diagonal blocks of A are inverted once with TRTI2, and every block row of X is computed
+    with GEMM instead of the substitution kernels. Otherwise, it calls rocsolver_trsm_lower
+    or rocsolver_trsm_upper. The workspace is given by rocsolver_trsm_left_invdiag_mem. **/
+template <bool BATCHED, bool STRIDED, typename T, typename I, typename U>
+rocblas_status rocsolver_trsm_left_invdiag(rocblas_handle handle,
+                                           const rocblas_fill uplo,
+                                           const rocblas_operation trans,
+                                           const rocblas_diagonal diag,
+                                           const I m,
+                                           const I n,
+                                           U A,
+                                           const rocblas_stride shiftA,
+                                           const I inca,
+                                           const I lda,
+                                           const rocblas_stride strideA,
+                                           U B,
+                                           const rocblas_stride shiftB,
+                                           const I incb,
+                                           const I ldb,
+                                           const rocblas_stride strideB,
+                                           const I batch_count,
+                                           const bool optim_mem,
+                                           void* work1,
+                                           void* work2,
+                                           void* work3,
+                                           void* work4)
+{
+    static constexpr bool ISBATCHED = BATCHED || STRIDED;
+    const I blk = rocsolver_trsm_invdiag_blksize<ISBATCHED, T>(m, n, inca, incb);
+
+    if(blk == 0)
+    {
+        if(uplo == rocblas_fill_lower)
+            return rocsolver_trsm_lower<BATCHED, STRIDED, T>(
+                handle, rocblas_side_left, trans, diag, m, n, A, shiftA, inca, lda, strideA, B,
+                shiftB, incb, ldb, strideB, batch_count, optim_mem, work1, work2, work3, work4);
+        else
+            return rocsolver_trsm_upper<BATCHED, STRIDED, T>(
+                handle, rocblas_side_left, trans, diag, m, n, A, shiftA, inca, lda, strideA, B,
+                shiftB, incb, ldb, strideB, batch_count, optim_mem, work1, work2, work3, work4);
+    }
+
+#ifdef OPTIMAL
+    ROCSOLVER_ENTER("trsm_left_invdiag", "uplo:", uplo, "trans:", trans, "diag:", diag, "m:", m,
+                    "n:", n, "shiftA:", shiftA, "lda:", lda, "shiftB:", shiftB, "ldb:", ldb,
+                    "bc:", batch_count);
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    T one = 1; // constant 1 in host
+    T zero = 0; // constant 0 in host
+    T minone = -1; // constant -1 in host
+
+    const I nblocks = (m - 1) / blk + 1;
+    const rocblas_stride strideW = rocblas_stride(blk) * blk * nblocks;
+    const rocblas_stride strideX = rocblas_stride(blk) * n;
+
+    // the block rows are solved from the top for LX = B and U'X = B,
+    // and from the bottom for UX = B and L'X = B
+    const bool lower = (uplo == rocblas_fill_lower);
+    const bool forward = (lower == (trans == rocblas_operation_none));
+
+    // W holds the inverted diagonal blocks and X the solved block row
+    U W, X;
+    if constexpr(BATCHED)
+    {
+        T** workArr = (T**)work3;
+        I blocks = (batch_count - 1) / BS1 + 1;
+        ROCSOLVER_LAUNCH_KERNEL(get_array, dim3(blocks), dim3(BS1), 0, stream, workArr, (T*)work1,
+                                strideW, batch_count);
+        ROCSOLVER_LAUNCH_KERNEL(get_array, dim3(blocks), dim3(BS1), 0, stream,
+                                workArr + batch_count, (T*)work2, strideX, batch_count);
+        W = workArr;
+        X = workArr + batch_count;
+    }
+    else
+    {
+        W = (T*)work1;
+        X = (T*)work2;
+    }
+
+    // invert all the diagonal blocks at once
+    ROCSOLVER_LAUNCH_KERNEL(trsm_copy_diag_blocks<T>, dim3(nblocks, 1, batch_count), dim3(32, 32),
+                            0, stream, uplo, diag, m, blk, A, shiftA, lda, strideA, (T*)work1);
+    trti2_run_small<T>(handle, uplo, diag, rocblas_int(blk), (T*)work1, 0, rocblas_int(blk),
+                       rocblas_stride(blk) * blk, rocblas_int(nblocks * batch_count));
+
+    for(I k = 0; k < nblocks; ++k)
+    {
+        const I j = (forward ? k : nblocks - 1 - k) * blk;
+        const I jb = std::min(blk, m - j);
+
+        // solve for current diagonal block: X = op(inv(A_jj)) * B_j
+        ROCBLAS_CHECK(rocsolver_gemm<BATCHED, STRIDED, T>(
+            handle, trans, rocblas_operation_none, jb, n, jb, &one, W, rocblas_stride(j) * blk, 1,
+            blk, strideW, B, shiftB + idx2D(j, 0, ldb), 1, ldb, strideB, &zero, X, 0, 1, blk,
+            strideX, batch_count, (T**)nullptr));
+
+        I blocksx = (jb - 1) / 32 + 1;
+        I blocksy = (n - 1) / 32 + 1;
+        ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, dim3(blocksx, blocksy, batch_count), dim3(32, 32), 0,
+                                stream, jb, n, X, 0, blk, strideX, B, shiftB + idx2D(j, 0, ldb),
+                                ldb, strideB);
+
+        // update right hand sides
+        if(forward && j + jb < m)
+            ROCBLAS_CHECK(rocsolver_gemm<BATCHED, STRIDED, T>(
+                handle, trans, rocblas_operation_none, m - j - jb, n, jb, &minone, A,
+                shiftA + (lower ? idx2D(j + jb, j, lda) : idx2D(j, j + jb, lda)), 1, lda, strideA,
+                B, shiftB + idx2D(j, 0, ldb), 1, ldb, strideB, &one, B,
+                shiftB + idx2D(j + jb, 0, ldb), 1, ldb, strideB, batch_count, (T**)nullptr));
+        else if(!forward && j > 0)
+            ROCBLAS_CHECK(rocsolver_gemm<BATCHED, STRIDED, T>(
+                handle, trans, rocblas_operation_none, j, n, jb, &minone, A,
+                shiftA + (lower ? idx2D(j, 0, lda) : idx2D(0, j, lda)), 1, lda, strideA, B,
+                shiftB + idx2D(j, 0, ldb), 1, ldb, strideB, &one, B, shiftB, 1, ldb, strideB,
+                batch_count, (T**)nullptr));
+    }
+#endif
+
+    return rocblas_status_success;
+}
+
 /*************************************************************
     Instantiation macros
 *************************************************************/
@@ -1430,5 +1668,18 @@ inline rocblas_status rocsolver_trsm_upper(rocblas_handle handle,
         const I lda, const rocblas_stride strideA, U B, const rocblas_stride shiftB, const I ldb, \
         const rocblas_stride strideB, const I batch_count, const bool optim_mem, void* work1,     \
         void* work2, void* work3, void* work4)
+#define INSTANTIATE_TRSM_LEFT_INVDIAG_MEM(BATCHED, STRIDED, T, I)                          \
+    template rocblas_status rocsolver_trsm_left_invdiag_mem<BATCHED, STRIDED, T, I>(       \
+        const rocblas_operation trans, const I m, const I n, const I batch_count,          \
+        size_t* size_work1, size_t* size_work2, size_t* size_work3, size_t* size_work4,    \
+        bool* optim_mem, const I lda, const I ldb, const I inca, const I incb)
+#define INSTANTIATE_TRSM_LEFT_INVDIAG(BATCHED, STRIDED, T, I, U)                                  \
+    template rocblas_status rocsolver_trsm_left_invdiag<BATCHED, STRIDED, T, I, U>(               \
+        rocblas_handle handle, const rocblas_fill uplo, const rocblas_operation trans,            \
+        const rocblas_diagonal diag, const I m, const I n, U A, const rocblas_stride shiftA,      \
+        const I inca, const I lda, const rocblas_stride strideA, U B,                             \
+        const rocblas_stride shiftB, const I incb, const I ldb, const rocblas_stride strideB,     \
+        const I batch_count, const bool optim_mem, void* work1, void* work2, void* work3,         \
+        void* work4)
 
 ROCSOLVER_END_NAMESPACE
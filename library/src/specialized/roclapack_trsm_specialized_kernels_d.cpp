@@ -1,5 +1,5 @@
 /* **************************************************************************
- * Copyright (C) 2019-2024 Advanced Micro Devices, Inc. All rights reserved.
+ * Copyright (C) 2019-2025 Advanced Micro Devices, Inc. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions
@@ -36,28 +36,40 @@ ROCSOLVER_BEGIN_NAMESPACE
 INSTANTIATE_TRSM_MEM(0, 0, double, rocblas_int);
 INSTANTIATE_TRSM_LOWER(0, 0, double, rocblas_int, double*);
 INSTANTIATE_TRSM_UPPER(0, 0, double, rocblas_int, double*);
+INSTANTIATE_TRSM_LEFT_INVDIAG_MEM(0, 0, double, rocblas_int);
+INSTANTIATE_TRSM_LEFT_INVDIAG(0, 0, double, rocblas_int, double*);
 
 INSTANTIATE_TRSM_MEM(0, 1, double, rocblas_int);
 INSTANTIATE_TRSM_LOWER(0, 1, double, rocblas_int, double*);
 INSTANTIATE_TRSM_UPPER(0, 1, double, rocblas_int, double*);
+INSTANTIATE_TRSM_LEFT_INVDIAG_MEM(0, 1, double, rocblas_int);
+INSTANTIATE_TRSM_LEFT_INVDIAG(0, 1, double, rocblas_int, double*);
 
 INSTANTIATE_TRSM_MEM(1, 0, double, rocblas_int);
 INSTANTIATE_TRSM_LOWER(1, 0, double, rocblas_int, double* const*);
 INSTANTIATE_TRSM_UPPER(1, 0, double, rocblas_int, double* const*);
+INSTANTIATE_TRSM_LEFT_INVDIAG_MEM(1, 0, double, rocblas_int);
+INSTANTIATE_TRSM_LEFT_INVDIAG(1, 0, double, rocblas_int, double* const*);
 
 #ifdef HAVE_ROCBLAS_64
 // 64-bit
 INSTANTIATE_TRSM_MEM(0, 0, double, int64_t);
 INSTANTIATE_TRSM_LOWER(0, 0, double, int64_t, double*);
 INSTANTIATE_TRSM_UPPER(0, 0, double, int64_t, double*);
+INSTANTIATE_TRSM_LEFT_INVDIAG_MEM(0, 0, double, int64_t);
+INSTANTIATE_TRSM_LEFT_INVDIAG(0, 0, double, int64_t, double*);
 
 INSTANTIATE_TRSM_MEM(0, 1, double, int64_t);
 INSTANTIATE_TRSM_LOWER(0, 1, double, int64_t, double*);
 INSTANTIATE_TRSM_UPPER(0, 1, double, int64_t, double*);
+INSTANTIATE_TRSM_LEFT_INVDIAG_MEM(0, 1, double, int64_t);
+INSTANTIATE_TRSM_LEFT_INVDIAG(0, 1, double, int64_t, double*);
 
 INSTANTIATE_TRSM_MEM(1, 0, double, int64_t);
 INSTANTIATE_TRSM_LOWER(1, 0, double, int64_t, double* const*);
 INSTANTIATE_TRSM_UPPER(1, 0, double, int64_t, double* const*);
+INSTANTIATE_TRSM_LEFT_INVDIAG_MEM(1, 0, double, int64_t);
+INSTANTIATE_TRSM_LEFT_INVDIAG(1, 0, double, int64_t, double* const*);
 #endif /* HAVE_ROCBLAS_64 */
 
 ROCSOLVER_END_NAMESPACE
@@ -33,6 +33,7 @@
 #pragma once
 
 #include "rocsolver_run_specialized_kernels.hpp"
+#include "rocsolver_specialized_module.hpp"
 
 ROCSOLVER_BEGIN_NAMESPACE
 
@@ -232,10 +233,11 @@ void trti2_run_small(rocblas_handle handle,
     Instantiation macros
 *************************************************************/
 
-#define INSTANTIATE_TRTI2_SMALL(T, U)                                                          \
-    template void trti2_run_small<T, U>(rocblas_handle handle, const rocblas_fill uplo,        \
-                                        const rocblas_diagonal diag, const rocblas_int n, U A, \
-                                        const rocblas_int shiftA, const rocblas_int lda,       \
-                                        const rocblas_stride strideA, const rocblas_int batch_count)
+#define INSTANTIATE_TRTI2_SMALL(T, U)                                                 \
+    ROCSOLVER_INSTANTIATE_SPECIALIZED(void, trti2_run_small, (T, U),                  \
+        (rocblas_handle handle, const rocblas_fill uplo, const rocblas_diagonal diag, \
+         const rocblas_int n, U A, const rocblas_int shiftA, const rocblas_int lda,   \
+         const rocblas_stride strideA, const rocblas_int batch_count),                \
+        (handle, uplo, diag, n, A, shiftA, lda, strideA, batch_count))
 
 ROCSOLVER_END_NAMESPACE
@@ -0,0 +1,63 @@
+/* **************************************************************************
+ * Copyright (C) 2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include <string>
+#include <unordered_map>
+
+#include "rocsolver_specialized_module.hpp"
+
+/***************************************************************************
+ * Registry of the launchers compiled into librocsolver-specialized. Every
+ * instantiation of the module registers itself (see
+ * ROCSOLVER_INSTANTIATE_SPECIALIZED) when the module is loaded, and the
+ * stubs in librocsolver look them up by name through
+ * rocsolver_specialized_lookup.
+ ***************************************************************************/
+
+ROCSOLVER_BEGIN_NAMESPACE
+
+static std::unordered_map<std::string, void*>& specialized_registry()
+{
+    static std::unordered_map<std::string, void*> registry;
+    return registry;
+}
+
+bool rocsolver_specialized_register(const char* name, void* launcher)
+{
+    specialized_registry()[name] = launcher;
+    return true;
+}
+
+ROCSOLVER_END_NAMESPACE
+
+extern "C" __attribute__((visibility("default"))) void*
+    rocsolver_specialized_lookup(const char* name)
+{
+    const auto& registry = rocsolver::specialized_registry();
+    auto it = registry.find(name);
+    return it != registry.end() ? it->second : nullptr;
+}